@@ -0,0 +1,6319 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_____fini__array__end[] __asm__("__fini_array_end");
+extern char X_____fini__array__start[] __asm__("__fini_array_start");
+extern char X_____init__array__end[] __asm__("__init_array_end");
+extern char X_____init__array__start[] __asm__("__init_array_start");
+extern char X_main[] __asm__("main");
+extern char X_rt_2esyscall0[] __asm__("rt.syscall0");
+extern char X_rt_2esyscall1[] __asm__("rt.syscall1");
+extern char X_rt_2esyscall2[] __asm__("rt.syscall2");
+extern char X_rt_2esyscall3[] __asm__("rt.syscall3");
+extern char X_rt_2esyscall4[] __asm__("rt.syscall4");
+extern char X_rt_2esyscall6[] __asm__("rt.syscall6");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2 { u8 f0[13]; };
+struct __attribute__((packed)) S_strliteral_2e3 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e4 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e5 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e6 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e7 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e8 { u8 f0[10]; };
+struct __attribute__((packed)) S_strliteral_2e9 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e10 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e11 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e12 { u8 f0[13]; };
+struct __attribute__((packed)) S_strliteral_2e13 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e14 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e15 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e16 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e17 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e18 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e19 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e20 { u8 f0[21]; };
+struct __attribute__((packed)) S_strliteral_2e21 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e22 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e23 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e24 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e25 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e26 { u8 f0[29]; };
+struct __attribute__((packed)) S_strliteral_2e27 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e28 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e29 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e63 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S__2efini_2efinifunc_2e0 { char *f0; };
+struct __attribute__((packed)) S_strdata_2e104 { u8 f0[62]; };
+struct __attribute__((packed)) S_strliteral_2e105 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e148 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e230 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e377 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; };
+struct __attribute__((packed)) S_abortsites_2e762 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e1460 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e1515 { u8 f0[30]; };
+struct __attribute__((packed)) S_strliteral_2e1516 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1562 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e1633 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e1634 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1679 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e1680 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1693 { u8 f0[1]; };
+struct __attribute__((packed)) S_strliteral_2e1694 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1717 { u8 f0[12]; u8 f1; };
+struct __attribute__((packed)) S_strliteral_2e1718 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1771 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e1772 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1810 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e1811 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1838 { u8 f0[9]; };
+struct __attribute__((packed)) S_strliteral_2e1839 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1855 { u8 f0; };
+struct __attribute__((packed)) S_strliteral_2e1856 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1895 { u8 f0[9]; };
+struct __attribute__((packed)) S_strliteral_2e1896 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1910 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1911 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1597 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; };
+struct __attribute__((packed)) S_abortsites_2e1955 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e1972 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1973 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1976 { u8 f0[1]; };
+struct __attribute__((packed)) S_strliteral_2e1977 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1979 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1980 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_rt_2eexit__status { u32 f0; };
+struct __attribute__((packed)) S_static_2e2 { u8 f0; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_abortsites_2e2049 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_strdata_2e2169 { u8 f0[35]; };
+struct __attribute__((packed)) S_strdata_2e2170 { u8 f0[21]; };
+struct __attribute__((packed)) S_strdata_2e2171 { u8 f0[13]; };
+struct __attribute__((packed)) S_strdata_2e2172 { u8 f0[36]; };
+struct __attribute__((packed)) S_strdata_2e2173 { u8 f0[16]; };
+struct __attribute__((packed)) S_strdata_2e2174 { u8 f0[50]; };
+struct __attribute__((packed)) S_strdata_2e2175 { u8 f0[16]; };
+struct __attribute__((packed)) S_strdata_2e2176 { u8 f0[14]; };
+struct __attribute__((packed)) S_rt_2ereasons { char *f0; u64 f1; u64 f2; char *f3; u64 f4; u64 f5; char *f6; u64 f7; u64 f8; char *f9; u64 f10; u64 f11; char *f12; u64 f13; u64 f14; char *f15; u64 f16; u64 f17; char *f18; u64 f19; u64 f20; char *f21; u64 f22; u64 f23; };
+struct __attribute__((packed)) S_strdata_2e2210 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e2211 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2216 { u8 f0[8]; };
+struct __attribute__((packed)) S_strliteral_2e2217 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2222 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e2223 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2228 { u8 f0[9]; };
+struct __attribute__((packed)) S_strliteral_2e2229 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2234 { u8 f0[9]; };
+struct __attribute__((packed)) S_strliteral_2e2235 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2240 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e2241 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e2250 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_static_2e3 { u8 f0; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8; u8 f9; u8 f10; };
+struct __attribute__((packed)) S_strdata_2e2295 { u8 f0[1]; };
+struct __attribute__((packed)) S_strliteral_2e2296 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2309 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e2310 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e2276 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; };
+struct __attribute__((packed)) S_abortsites_2e2453 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_rt_2eenvp { u64 f0; };
+struct __attribute__((packed)) S_rt_2eargv { u64 f0; };
+struct __attribute__((packed)) S_rt_2eargc { u64 f0; };
+struct __attribute__((packed)) S_rt_2ecur__chunk { u64 f0; u64 f1; };
+struct __attribute__((packed)) S_rt_2ecur__allocs { u64 f0; };
+struct __attribute__((packed)) S_strdata_2e2627 { u8 f0[57]; };
+struct __attribute__((packed)) S_strliteral_2e2628 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2672 { u8 f0[68]; };
+struct __attribute__((packed)) S_strliteral_2e2673 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2724 { u8 f0[52]; };
+struct __attribute__((packed)) S_strliteral_2e2725 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2735 { u8 f0[57]; };
+struct __attribute__((packed)) S_strliteral_2e2736 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2746 { u8 f0[70]; };
+struct __attribute__((packed)) S_strliteral_2e2747 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2761 { u8 f0[57]; };
+struct __attribute__((packed)) S_strliteral_2e2762 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2786 { u8 f0[70]; };
+struct __attribute__((packed)) S_strliteral_2e2787 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e2685 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e2812 { u8 f0[69]; };
+struct __attribute__((packed)) S_strliteral_2e2813 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2891 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e2892 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2917 { u8 f0[49]; };
+struct __attribute__((packed)) S_strliteral_2e2918 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e2868 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_rt_2ebins { u64 f0; u64 f1; u64 f2; u64 f3; u64 f4; u64 f5; u64 f6; u64 f7; u64 f8; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e2 D_strdata_2e2 __asm__("strdata.2") __attribute__((used, section(".rodata.strdata.2"), aligned(8)));
+static struct S_strliteral_2e3 D_strliteral_2e3 __asm__("strliteral.3") __attribute__((used, section(".data.rel.ro.strliteral.3"), aligned(8)));
+static const struct S_strdata_2e4 D_strdata_2e4 __asm__("strdata.4") __attribute__((used, section(".rodata.strdata.4"), aligned(8)));
+static struct S_strliteral_2e5 D_strliteral_2e5 __asm__("strliteral.5") __attribute__((used, section(".data.rel.ro.strliteral.5"), aligned(8)));
+static const struct S_strdata_2e6 D_strdata_2e6 __asm__("strdata.6") __attribute__((used, section(".rodata.strdata.6"), aligned(8)));
+static struct S_strliteral_2e7 D_strliteral_2e7 __asm__("strliteral.7") __attribute__((used, section(".data.rel.ro.strliteral.7"), aligned(8)));
+static const struct S_strdata_2e8 D_strdata_2e8 __asm__("strdata.8") __attribute__((used, section(".rodata.strdata.8"), aligned(8)));
+static struct S_strliteral_2e9 D_strliteral_2e9 __asm__("strliteral.9") __attribute__((used, section(".data.rel.ro.strliteral.9"), aligned(8)));
+static const struct S_strdata_2e10 D_strdata_2e10 __asm__("strdata.10") __attribute__((used, section(".rodata.strdata.10"), aligned(8)));
+static struct S_strliteral_2e11 D_strliteral_2e11 __asm__("strliteral.11") __attribute__((used, section(".data.rel.ro.strliteral.11"), aligned(8)));
+static const struct S_strdata_2e12 D_strdata_2e12 __asm__("strdata.12") __attribute__((used, section(".rodata.strdata.12"), aligned(8)));
+static struct S_strliteral_2e13 D_strliteral_2e13 __asm__("strliteral.13") __attribute__((used, section(".data.rel.ro.strliteral.13"), aligned(8)));
+static const struct S_strdata_2e14 D_strdata_2e14 __asm__("strdata.14") __attribute__((used, section(".rodata.strdata.14"), aligned(8)));
+static struct S_strliteral_2e15 D_strliteral_2e15 __asm__("strliteral.15") __attribute__((used, section(".data.rel.ro.strliteral.15"), aligned(8)));
+static const struct S_strdata_2e16 D_strdata_2e16 __asm__("strdata.16") __attribute__((used, section(".rodata.strdata.16"), aligned(8)));
+static struct S_strliteral_2e17 D_strliteral_2e17 __asm__("strliteral.17") __attribute__((used, section(".data.rel.ro.strliteral.17"), aligned(8)));
+static const struct S_strdata_2e18 D_strdata_2e18 __asm__("strdata.18") __attribute__((used, section(".rodata.strdata.18"), aligned(8)));
+static struct S_strliteral_2e19 D_strliteral_2e19 __asm__("strliteral.19") __attribute__((used, section(".data.rel.ro.strliteral.19"), aligned(8)));
+static const struct S_strdata_2e20 D_strdata_2e20 __asm__("strdata.20") __attribute__((used, section(".rodata.strdata.20"), aligned(8)));
+static struct S_strliteral_2e21 D_strliteral_2e21 __asm__("strliteral.21") __attribute__((used, section(".data.rel.ro.strliteral.21"), aligned(8)));
+static const struct S_strdata_2e22 D_strdata_2e22 __asm__("strdata.22") __attribute__((used, section(".rodata.strdata.22"), aligned(8)));
+static struct S_strliteral_2e23 D_strliteral_2e23 __asm__("strliteral.23") __attribute__((used, section(".data.rel.ro.strliteral.23"), aligned(8)));
+static const struct S_strdata_2e24 D_strdata_2e24 __asm__("strdata.24") __attribute__((used, section(".rodata.strdata.24"), aligned(8)));
+static struct S_strliteral_2e25 D_strliteral_2e25 __asm__("strliteral.25") __attribute__((used, section(".data.rel.ro.strliteral.25"), aligned(8)));
+static const struct S_strdata_2e26 D_strdata_2e26 __asm__("strdata.26") __attribute__((used, section(".rodata.strdata.26"), aligned(8)));
+static struct S_strliteral_2e27 D_strliteral_2e27 __asm__("strliteral.27") __attribute__((used, section(".data.rel.ro.strliteral.27"), aligned(8)));
+static const struct S_strdata_2e28 D_strdata_2e28 __asm__("strdata.28") __attribute__((used, section(".rodata.strdata.28"), aligned(8)));
+static struct S_strliteral_2e29 D_strliteral_2e29 __asm__("strliteral.29") __attribute__((used, section(".data.rel.ro.strliteral.29"), aligned(8)));
+static struct S_abortsites_2e63 D_abortsites_2e63 __asm__("abortsites.63") __attribute__((used, section(".data.rel.ro.abortsites.63"), aligned(8)));
+static struct S__2efini_2efinifunc_2e0 D__2efini_2efinifunc_2e0 __asm__(".fini.finifunc.0") __attribute__((used, section(".fini_array"), aligned(8)));
+static const struct S_strdata_2e104 D_strdata_2e104 __asm__("strdata.104") __attribute__((used, section(".rodata.strdata.104"), aligned(8)));
+static struct S_strliteral_2e105 D_strliteral_2e105 __asm__("strliteral.105") __attribute__((used, section(".data.rel.ro.strliteral.105"), aligned(8)));
+static struct S_abortsites_2e148 D_abortsites_2e148 __asm__("abortsites.148") __attribute__((used, section(".data.rel.ro.abortsites.148"), aligned(8)));
+static struct S_abortsites_2e230 D_abortsites_2e230 __asm__("abortsites.230") __attribute__((used, section(".data.rel.ro.abortsites.230"), aligned(8)));
+static struct S_abortsites_2e377 D_abortsites_2e377 __asm__("abortsites.377") __attribute__((used, section(".data.rel.ro.abortsites.377"), aligned(8)));
+static struct S_abortsites_2e762 D_abortsites_2e762 __asm__("abortsites.762") __attribute__((used, section(".data.rel.ro.abortsites.762"), aligned(8)));
+static struct S_abortsites_2e1460 D_abortsites_2e1460 __asm__("abortsites.1460") __attribute__((used, section(".data.rel.ro.abortsites.1460"), aligned(8)));
+static const struct S_strdata_2e1515 D_strdata_2e1515 __asm__("strdata.1515") __attribute__((used, section(".rodata.strdata.1515"), aligned(8)));
+static struct S_strliteral_2e1516 D_strliteral_2e1516 __asm__("strliteral.1516") __attribute__((used, section(".data.rel.ro.strliteral.1516"), aligned(8)));
+static struct S_abortsites_2e1562 D_abortsites_2e1562 __asm__("abortsites.1562") __attribute__((used, section(".data.rel.ro.abortsites.1562"), aligned(8)));
+static const struct S_strdata_2e1633 D_strdata_2e1633 __asm__("strdata.1633") __attribute__((used, section(".rodata.strdata.1633"), aligned(8)));
+static struct S_strliteral_2e1634 D_strliteral_2e1634 __asm__("strliteral.1634") __attribute__((used, section(".data.rel.ro.strliteral.1634"), aligned(8)));
+static const struct S_strdata_2e1679 D_strdata_2e1679 __asm__("strdata.1679") __attribute__((used, section(".rodata.strdata.1679"), aligned(8)));
+static struct S_strliteral_2e1680 D_strliteral_2e1680 __asm__("strliteral.1680") __attribute__((used, section(".data.rel.ro.strliteral.1680"), aligned(8)));
+static const struct S_strdata_2e1693 D_strdata_2e1693 __asm__("strdata.1693") __attribute__((used, section(".rodata.strdata.1693"), aligned(8)));
+static struct S_strliteral_2e1694 D_strliteral_2e1694 __asm__("strliteral.1694") __attribute__((used, section(".data.rel.ro.strliteral.1694"), aligned(8)));
+static const struct S_strdata_2e1717 D_strdata_2e1717 __asm__("strdata.1717") __attribute__((used, section(".rodata.strdata.1717"), aligned(8)));
+static struct S_strliteral_2e1718 D_strliteral_2e1718 __asm__("strliteral.1718") __attribute__((used, section(".data.rel.ro.strliteral.1718"), aligned(8)));
+static const struct S_strdata_2e1771 D_strdata_2e1771 __asm__("strdata.1771") __attribute__((used, section(".rodata.strdata.1771"), aligned(8)));
+static struct S_strliteral_2e1772 D_strliteral_2e1772 __asm__("strliteral.1772") __attribute__((used, section(".data.rel.ro.strliteral.1772"), aligned(8)));
+static const struct S_strdata_2e1810 D_strdata_2e1810 __asm__("strdata.1810") __attribute__((used, section(".rodata.strdata.1810"), aligned(8)));
+static struct S_strliteral_2e1811 D_strliteral_2e1811 __asm__("strliteral.1811") __attribute__((used, section(".data.rel.ro.strliteral.1811"), aligned(8)));
+static const struct S_strdata_2e1838 D_strdata_2e1838 __asm__("strdata.1838") __attribute__((used, section(".rodata.strdata.1838"), aligned(8)));
+static struct S_strliteral_2e1839 D_strliteral_2e1839 __asm__("strliteral.1839") __attribute__((used, section(".data.rel.ro.strliteral.1839"), aligned(8)));
+static const struct S_strdata_2e1855 D_strdata_2e1855 __asm__("strdata.1855") __attribute__((used, section(".rodata.strdata.1855"), aligned(8)));
+static struct S_strliteral_2e1856 D_strliteral_2e1856 __asm__("strliteral.1856") __attribute__((used, section(".data.rel.ro.strliteral.1856"), aligned(8)));
+static const struct S_strdata_2e1895 D_strdata_2e1895 __asm__("strdata.1895") __attribute__((used, section(".rodata.strdata.1895"), aligned(8)));
+static struct S_strliteral_2e1896 D_strliteral_2e1896 __asm__("strliteral.1896") __attribute__((used, section(".data.rel.ro.strliteral.1896"), aligned(8)));
+static const struct S_strdata_2e1910 D_strdata_2e1910 __asm__("strdata.1910") __attribute__((used, section(".rodata.strdata.1910"), aligned(8)));
+static struct S_strliteral_2e1911 D_strliteral_2e1911 __asm__("strliteral.1911") __attribute__((used, section(".data.rel.ro.strliteral.1911"), aligned(8)));
+static struct S_abortsites_2e1597 D_abortsites_2e1597 __asm__("abortsites.1597") __attribute__((used, section(".data.rel.ro.abortsites.1597"), aligned(8)));
+static struct S_abortsites_2e1955 D_abortsites_2e1955 __asm__("abortsites.1955") __attribute__((used, section(".data.rel.ro.abortsites.1955"), aligned(8)));
+static const struct S_strdata_2e1972 D_strdata_2e1972 __asm__("strdata.1972") __attribute__((used, section(".rodata.strdata.1972"), aligned(8)));
+static struct S_strliteral_2e1973 D_strliteral_2e1973 __asm__("strliteral.1973") __attribute__((used, section(".data.rel.ro.strliteral.1973"), aligned(8)));
+static const struct S_strdata_2e1976 D_strdata_2e1976 __asm__("strdata.1976") __attribute__((used, section(".rodata.strdata.1976"), aligned(8)));
+static struct S_strliteral_2e1977 D_strliteral_2e1977 __asm__("strliteral.1977") __attribute__((used, section(".data.rel.ro.strliteral.1977"), aligned(8)));
+static const struct S_strdata_2e1979 D_strdata_2e1979 __asm__("strdata.1979") __attribute__((used, section(".rodata.strdata.1979"), aligned(8)));
+static struct S_strliteral_2e1980 D_strliteral_2e1980 __asm__("strliteral.1980") __attribute__((used, section(".data.rel.ro.strliteral.1980"), aligned(8)));
+extern struct S_rt_2eexit__status D_rt_2eexit__status __asm__("rt.exit_status") __attribute__((used, section(".bss.rt.exit_status"), aligned(8)));
+static struct S_static_2e2 D_static_2e2 __asm__("static.2") __attribute__((used, section(".bss.static.2"), aligned(8)));
+static struct S_abortsites_2e2049 D_abortsites_2e2049 __asm__("abortsites.2049") __attribute__((used, section(".data.rel.ro.abortsites.2049"), aligned(8)));
+static const struct S_strdata_2e2169 D_strdata_2e2169 __asm__("strdata.2169") __attribute__((used, section(".rodata.strdata.2169"), aligned(8)));
+static const struct S_strdata_2e2170 D_strdata_2e2170 __asm__("strdata.2170") __attribute__((used, section(".rodata.strdata.2170"), aligned(8)));
+static const struct S_strdata_2e2171 D_strdata_2e2171 __asm__("strdata.2171") __attribute__((used, section(".rodata.strdata.2171"), aligned(8)));
+static const struct S_strdata_2e2172 D_strdata_2e2172 __asm__("strdata.2172") __attribute__((used, section(".rodata.strdata.2172"), aligned(8)));
+static const struct S_strdata_2e2173 D_strdata_2e2173 __asm__("strdata.2173") __attribute__((used, section(".rodata.strdata.2173"), aligned(8)));
+static const struct S_strdata_2e2174 D_strdata_2e2174 __asm__("strdata.2174") __attribute__((used, section(".rodata.strdata.2174"), aligned(8)));
+static const struct S_strdata_2e2175 D_strdata_2e2175 __asm__("strdata.2175") __attribute__((used, section(".rodata.strdata.2175"), aligned(8)));
+static const struct S_strdata_2e2176 D_strdata_2e2176 __asm__("strdata.2176") __attribute__((used, section(".rodata.strdata.2176"), aligned(8)));
+static struct S_rt_2ereasons D_rt_2ereasons __asm__("rt.reasons") __attribute__((used, section(".data.rt.reasons"), aligned(8)));
+static const struct S_strdata_2e2210 D_strdata_2e2210 __asm__("strdata.2210") __attribute__((used, section(".rodata.strdata.2210"), aligned(8)));
+static struct S_strliteral_2e2211 D_strliteral_2e2211 __asm__("strliteral.2211") __attribute__((used, section(".data.rel.ro.strliteral.2211"), aligned(8)));
+static const struct S_strdata_2e2216 D_strdata_2e2216 __asm__("strdata.2216") __attribute__((used, section(".rodata.strdata.2216"), aligned(8)));
+static struct S_strliteral_2e2217 D_strliteral_2e2217 __asm__("strliteral.2217") __attribute__((used, section(".data.rel.ro.strliteral.2217"), aligned(8)));
+static const struct S_strdata_2e2222 D_strdata_2e2222 __asm__("strdata.2222") __attribute__((used, section(".rodata.strdata.2222"), aligned(8)));
+static struct S_strliteral_2e2223 D_strliteral_2e2223 __asm__("strliteral.2223") __attribute__((used, section(".data.rel.ro.strliteral.2223"), aligned(8)));
+static const struct S_strdata_2e2228 D_strdata_2e2228 __asm__("strdata.2228") __attribute__((used, section(".rodata.strdata.2228"), aligned(8)));
+static struct S_strliteral_2e2229 D_strliteral_2e2229 __asm__("strliteral.2229") __attribute__((used, section(".data.rel.ro.strliteral.2229"), aligned(8)));
+static const struct S_strdata_2e2234 D_strdata_2e2234 __asm__("strdata.2234") __attribute__((used, section(".rodata.strdata.2234"), aligned(8)));
+static struct S_strliteral_2e2235 D_strliteral_2e2235 __asm__("strliteral.2235") __attribute__((used, section(".data.rel.ro.strliteral.2235"), aligned(8)));
+static const struct S_strdata_2e2240 D_strdata_2e2240 __asm__("strdata.2240") __attribute__((used, section(".rodata.strdata.2240"), aligned(8)));
+static struct S_strliteral_2e2241 D_strliteral_2e2241 __asm__("strliteral.2241") __attribute__((used, section(".data.rel.ro.strliteral.2241"), aligned(8)));
+static struct S_abortsites_2e2250 D_abortsites_2e2250 __asm__("abortsites.2250") __attribute__((used, section(".data.rel.ro.abortsites.2250"), aligned(8)));
+static struct S_static_2e3 D_static_2e3 __asm__("static.3") __attribute__((used, section(".bss.static.3"), aligned(8)));
+static const struct S_strdata_2e2295 D_strdata_2e2295 __asm__("strdata.2295") __attribute__((used, section(".rodata.strdata.2295"), aligned(8)));
+static struct S_strliteral_2e2296 D_strliteral_2e2296 __asm__("strliteral.2296") __attribute__((used, section(".data.rel.ro.strliteral.2296"), aligned(8)));
+static const struct S_strdata_2e2309 D_strdata_2e2309 __asm__("strdata.2309") __attribute__((used, section(".rodata.strdata.2309"), aligned(8)));
+static struct S_strliteral_2e2310 D_strliteral_2e2310 __asm__("strliteral.2310") __attribute__((used, section(".data.rel.ro.strliteral.2310"), aligned(8)));
+static struct S_abortsites_2e2276 D_abortsites_2e2276 __asm__("abortsites.2276") __attribute__((used, section(".data.rel.ro.abortsites.2276"), aligned(8)));
+static struct S_abortsites_2e2453 D_abortsites_2e2453 __asm__("abortsites.2453") __attribute__((used, section(".data.rel.ro.abortsites.2453"), aligned(8)));
+static struct S_rt_2eenvp D_rt_2eenvp __asm__("rt.envp") __attribute__((used, section(".bss.rt.envp"), aligned(8)));
+static struct S_rt_2eargv D_rt_2eargv __asm__("rt.argv") __attribute__((used, section(".bss.rt.argv"), aligned(8)));
+static struct S_rt_2eargc D_rt_2eargc __asm__("rt.argc") __attribute__((used, section(".bss.rt.argc"), aligned(8)));
+static struct S_rt_2ecur__chunk D_rt_2ecur__chunk __asm__("rt.cur_chunk") __attribute__((used, section(".data.rt.cur_chunk"), aligned(8)));
+static struct S_rt_2ecur__allocs D_rt_2ecur__allocs __asm__("rt.cur_allocs") __attribute__((used, section(".bss.rt.cur_allocs"), aligned(8)));
+static const struct S_strdata_2e2627 D_strdata_2e2627 __asm__("strdata.2627") __attribute__((used, section(".rodata.strdata.2627"), aligned(8)));
+static struct S_strliteral_2e2628 D_strliteral_2e2628 __asm__("strliteral.2628") __attribute__((used, section(".data.rel.ro.strliteral.2628"), aligned(8)));
+static const struct S_strdata_2e2672 D_strdata_2e2672 __asm__("strdata.2672") __attribute__((used, section(".rodata.strdata.2672"), aligned(8)));
+static struct S_strliteral_2e2673 D_strliteral_2e2673 __asm__("strliteral.2673") __attribute__((used, section(".data.rel.ro.strliteral.2673"), aligned(8)));
+static const struct S_strdata_2e2724 D_strdata_2e2724 __asm__("strdata.2724") __attribute__((used, section(".rodata.strdata.2724"), aligned(8)));
+static struct S_strliteral_2e2725 D_strliteral_2e2725 __asm__("strliteral.2725") __attribute__((used, section(".data.rel.ro.strliteral.2725"), aligned(8)));
+static const struct S_strdata_2e2735 D_strdata_2e2735 __asm__("strdata.2735") __attribute__((used, section(".rodata.strdata.2735"), aligned(8)));
+static struct S_strliteral_2e2736 D_strliteral_2e2736 __asm__("strliteral.2736") __attribute__((used, section(".data.rel.ro.strliteral.2736"), aligned(8)));
+static const struct S_strdata_2e2746 D_strdata_2e2746 __asm__("strdata.2746") __attribute__((used, section(".rodata.strdata.2746"), aligned(8)));
+static struct S_strliteral_2e2747 D_strliteral_2e2747 __asm__("strliteral.2747") __attribute__((used, section(".data.rel.ro.strliteral.2747"), aligned(8)));
+static const struct S_strdata_2e2761 D_strdata_2e2761 __asm__("strdata.2761") __attribute__((used, section(".rodata.strdata.2761"), aligned(8)));
+static struct S_strliteral_2e2762 D_strliteral_2e2762 __asm__("strliteral.2762") __attribute__((used, section(".data.rel.ro.strliteral.2762"), aligned(8)));
+static const struct S_strdata_2e2786 D_strdata_2e2786 __asm__("strdata.2786") __attribute__((used, section(".rodata.strdata.2786"), aligned(8)));
+static struct S_strliteral_2e2787 D_strliteral_2e2787 __asm__("strliteral.2787") __attribute__((used, section(".data.rel.ro.strliteral.2787"), aligned(8)));
+static struct S_abortsites_2e2685 D_abortsites_2e2685 __asm__("abortsites.2685") __attribute__((used, section(".data.rel.ro.abortsites.2685"), aligned(8)));
+static const struct S_strdata_2e2812 D_strdata_2e2812 __asm__("strdata.2812") __attribute__((used, section(".rodata.strdata.2812"), aligned(8)));
+static struct S_strliteral_2e2813 D_strliteral_2e2813 __asm__("strliteral.2813") __attribute__((used, section(".data.rel.ro.strliteral.2813"), aligned(8)));
+static const struct S_strdata_2e2891 D_strdata_2e2891 __asm__("strdata.2891") __attribute__((used, section(".rodata.strdata.2891"), aligned(8)));
+static struct S_strliteral_2e2892 D_strliteral_2e2892 __asm__("strliteral.2892") __attribute__((used, section(".data.rel.ro.strliteral.2892"), aligned(8)));
+static const struct S_strdata_2e2917 D_strdata_2e2917 __asm__("strdata.2917") __attribute__((used, section(".rodata.strdata.2917"), aligned(8)));
+static struct S_strliteral_2e2918 D_strliteral_2e2918 __asm__("strliteral.2918") __attribute__((used, section(".data.rel.ro.strliteral.2918"), aligned(8)));
+static struct S_abortsites_2e2868 D_abortsites_2e2868 __asm__("abortsites.2868") __attribute__((used, section(".data.rel.ro.abortsites.2868"), aligned(8)));
+static struct S_rt_2ebins D_rt_2ebins __asm__("rt.bins") __attribute__((used, section(".bss.rt.bins"), aligned(8)));
+static void F_finifunc_2e0(void) __asm__("finifunc.0") __attribute__((used, section(".text.finifunc.0")));
+u64 F_rt_2egetmeta(u64 p_p) __asm__("rt.getmeta") __attribute__((used, section(".text.rt.getmeta")));
+u64 F_rt_2erealloc(u64 p_p, u64 p_n) __asm__("rt.realloc") __attribute__((used, section(".text.rt.realloc")));
+void F_rt_2efree(u64 p_p) __asm__("rt.free") __attribute__((used, section(".text.rt.free")));
+u64 F_rt_2emalloc(u64 p_n) __asm__("rt.malloc") __attribute__((used, section(".text.rt.malloc")));
+void F_rt_2estart__ha(u64 p_iv) __asm__("rt.start_ha") __attribute__((used, section(".text.rt.start_ha")));
+u32 F_rt_2emprotect(u64 p_addr, u64 p_length, u32 p_prot) __asm__("rt.mprotect") __attribute__((used, section(".text.rt.mprotect")));
+u32 F_rt_2emunmap(u64 p_addr, u64 p_length) __asm__("rt.munmap") __attribute__((used, section(".text.rt.munmap")));
+u64 F_rt_2emmap(u64 p_addr, u64 p_length, u32 p_prot, u32 p_flags, u32 p_fd, u64 p_offs) __asm__("rt.mmap") __attribute__((used, section(".text.rt.mmap")));
+u32 F_rt_2epipe2(u64 p_pipefd, u32 p_flags) __asm__("rt.pipe2") __attribute__((used, section(".text.rt.pipe2")));
+u32 F_rt_2ekill(u32 p_pid, u32 p_signal) __asm__("rt.kill") __attribute__((used, section(".text.rt.kill")));
+u32 F_rt_2ewifsignaled(u32 p_status) __asm__("rt.wifsignaled") __attribute__((used, section(".text.rt.wifsignaled")));
+u32 F_rt_2ewtermsig(u32 p_status) __asm__("rt.wtermsig") __attribute__((used, section(".text.rt.wtermsig")));
+u32 F_rt_2ewexitstatus(u32 p_status) __asm__("rt.wexitstatus") __attribute__((used, section(".text.rt.wexitstatus")));
+u32 F_rt_2ewifexited(u32 p_status) __asm__("rt.wifexited") __attribute__((used, section(".text.rt.wifexited")));
+void F_rt_2ewait4(u32 p_pid, u64 p_status, u32 p_options, u64 p_rusage) __asm__("rt.wait4") __attribute__((used, section(".text.rt.wait4")));
+u32 F_rt_2eexecve(u64 p_path, u64 p_argv, u64 p_envp) __asm__("rt.execve") __attribute__((used, section(".text.rt.execve")));
+u32 F_rt_2efork(void) __asm__("rt.fork") __attribute__((used, section(".text.rt.fork")));
+void F_rt_2eexit(u32 p_status) __asm__("rt.exit") __attribute__((used, section(".text.rt.exit")));
+u32 F_rt_2egetpid(void) __asm__("rt.getpid") __attribute__((used, section(".text.rt.getpid")));
+u32 F_rt_2edup2(u32 p_old, u32 p_new) __asm__("rt.dup2") __attribute__((used, section(".text.rt.dup2")));
+u32 F_rt_2edup3(u32 p_old, u32 p_new, u32 p_flags) __asm__("rt.dup3") __attribute__((used, section(".text.rt.dup3")));
+u32 F_rt_2eclose(u32 p_fd) __asm__("rt.close") __attribute__((used, section(".text.rt.close")));
+u64 F_rt_2ewrite(u32 p_fd, u64 p_buf, u64 p_count) __asm__("rt.write") __attribute__((used, section(".text.rt.write")));
+u32 F_rt_2estrcmp(u64 p___a, u64 p___b) __asm__("rt.strcmp") __attribute__((used, section(".text.rt.strcmp")));
+void F_rt_2ememset(u64 p_dest, u32 p_val, u64 p_amt) __asm__("rt.memset") __attribute__((used, section(".text.rt.memset")));
+void F_rt_2ememmove(u64 p_dest, u64 p_src, u64 p_n) __asm__("rt.memmove") __attribute__((used, section(".text.rt.memmove")));
+void F_rt_2ememcpy(u64 p_dest, u64 p_src, u64 p_amt) __asm__("rt.memcpy") __attribute__((used, section(".text.rt.memcpy")));
+void F_rt_2eunensure(u64 p_s, u64 p_membsz) __asm__("rt.unensure") __attribute__((used, section(".text.rt.unensure")));
+void F_rt_2eensure(u64 p_s, u64 p_membsz) __asm__("rt.ensure") __attribute__((used, section(".text.rt.ensure")));
+u64 F_rt_2etoutf8(u64 __rp, u64 p_s) __asm__("rt.toutf8") __attribute__((used, section(".text.rt.toutf8")));
+u64 F_rt_2ecompile(u64 __rp, u64 p_expected, u64 p_src, u64 p_flags) __asm__("rt.compile") __attribute__((used, section(".text.rt.compile")));
+void F_rt_2eabort__fixed(u64 p_path, u64 p_line, u64 p_col, u64 p_i) __asm__("rt.abort_fixed") __attribute__((used, section(".text.rt.abort_fixed")));
+void F_rt_2eabort(u64 p_path, u64 p_line, u64 p_col, u64 p_msg) __asm__("rt.abort") __attribute__((used, section(".text.rt.abort")));
+static u64 F_rt_2eu64tos(u64 __rp, u64 p_u) __asm__("rt.u64tos") __attribute__((used, section(".text.rt.u64tos")));
+static u64 F_rt_2estrstatus(u64 __rp, u32 p_status) __asm__("rt.strstatus") __attribute__((used, section(".text.rt.strstatus")));
+static u64 F_rt_2eitos(u64 __rp, u32 p_i) __asm__("rt.itos") __attribute__((used, section(".text.rt.itos")));
+static u64 F_rt_2econstchar(u64 p_s) __asm__("rt.constchar") __attribute__((used, section(".text.rt.constchar")));
+static u64 F_rt_2ealloc__constchar(u64 p_s) __asm__("rt.alloc_constchar") __attribute__((used, section(".text.rt.alloc_constchar")));
+static u64 F_rt_2esegmalloc(u64 p_n) __asm__("rt.segmalloc") __attribute__((used, section(".text.rt.segmalloc")));
+static u64 F_rt_2esize__getbin(u64 p_sz) __asm__("rt.size_getbin") __attribute__((used, section(".text.rt.size_getbin")));
+static u32 F_rt_2esegfree(u64 p_p, u64 p_s) __asm__("rt.segfree") __attribute__((used, section(".text.rt.segfree")));
+static u32 F_rt_2esize__islarge(u64 p_sz) __asm__("rt.size_islarge") __attribute__((used, section(".text.rt.size_islarge")));
+static u64 F_rt_2erealsz(u64 p_sz) __asm__("rt.realsz") __attribute__((used, section(".text.rt.realsz")));
+static void F_rt_2evalidatemeta(u64 p_m, u32 p_shallow) __asm__("rt.validatemeta") __attribute__((used, section(".text.rt.validatemeta")));
+static u64 F_rt_2emeta__next(u64 p_m) __asm__("rt.meta_next") __attribute__((used, section(".text.rt.meta_next")));
+static u64 F_rt_2ebin__getsize(u64 p_bin) __asm__("rt.bin_getsize") __attribute__((used, section(".text.rt.bin_getsize")));
+static void F_rt_2echeckpoison(u64 p_m, u64 p_sz) __asm__("rt.checkpoison") __attribute__((used, section(".text.rt.checkpoison")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\162\164\057\141\142\157\162\164\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 11U, 11U };
+static const struct S_strdata_2e2 D_strdata_2e2 = { "\162\164\057\143\157\155\160\151\154\145\056\150\141" };
+static struct S_strliteral_2e3 D_strliteral_2e3 = { (char *)((char *)&D_strdata_2e2) + 0, 13U, 13U };
+static const struct S_strdata_2e4 D_strdata_2e4 = { "\162\164\057\143\163\164\162\151\156\147\163\056\150\141" };
+static struct S_strliteral_2e5 D_strliteral_2e5 = { (char *)((char *)&D_strdata_2e4) + 0, 14U, 14U };
+static const struct S_strdata_2e6 D_strdata_2e6 = { "\162\164\057\145\156\163\165\162\145\056\150\141" };
+static struct S_strliteral_2e7 D_strliteral_2e7 = { (char *)((char *)&D_strdata_2e6) + 0, 12U, 12U };
+static const struct S_strdata_2e8 D_strdata_2e8 = { "\162\164\057\151\164\157\163\056\150\141" };
+static struct S_strliteral_2e9 D_strliteral_2e9 = { (char *)((char *)&D_strdata_2e8) + 0, 10U, 10U };
+static const struct S_strdata_2e10 D_strdata_2e10 = { "\162\164\057\155\145\155\143\160\171\056\150\141" };
+static struct S_strliteral_2e11 D_strliteral_2e11 = { (char *)((char *)&D_strdata_2e10) + 0, 12U, 12U };
+static const struct S_strdata_2e12 D_strdata_2e12 = { "\162\164\057\155\145\155\155\157\166\145\056\150\141" };
+static struct S_strliteral_2e13 D_strliteral_2e13 = { (char *)((char *)&D_strdata_2e12) + 0, 13U, 13U };
+static const struct S_strdata_2e14 D_strdata_2e14 = { "\162\164\057\155\145\155\163\145\164\056\150\141" };
+static struct S_strliteral_2e15 D_strliteral_2e15 = { (char *)((char *)&D_strdata_2e14) + 0, 12U, 12U };
+static const struct S_strdata_2e16 D_strdata_2e16 = { "\162\164\057\163\164\162\143\155\160\056\150\141" };
+static struct S_strliteral_2e17 D_strliteral_2e17 = { (char *)((char *)&D_strdata_2e16) + 0, 12U, 12U };
+static const struct S_strdata_2e18 D_strdata_2e18 = { "\162\164\057\053\154\151\156\165\170\057\145\162\162\156\157\056\150\141" };
+static struct S_strliteral_2e19 D_strliteral_2e19 = { (char *)((char *)&D_strdata_2e18) + 0, 18U, 18U };
+static const struct S_strdata_2e20 D_strdata_2e20 = { "\162\164\057\053\154\151\156\165\170\057\163\171\163\143\141\154\154\163\056\150\141" };
+static struct S_strliteral_2e21 D_strliteral_2e21 = { (char *)((char *)&D_strdata_2e20) + 0, 21U, 21U };
+static const struct S_strdata_2e22 D_strdata_2e22 = { "\162\164\057\053\154\151\156\165\170\057\163\164\141\162\164\056\150\141" };
+static struct S_strliteral_2e23 D_strliteral_2e23 = { (char *)((char *)&D_strdata_2e22) + 0, 18U, 18U };
+static const struct S_strdata_2e24 D_strdata_2e24 = { "\162\164\057\155\141\154\154\157\143\056\150\141" };
+static struct S_strliteral_2e25 D_strliteral_2e25 = { (char *)((char *)&D_strdata_2e24) + 0, 12U, 12U };
+static const struct S_strdata_2e26 D_strdata_2e26 = { "\162\164\057\053\154\151\156\165\170\057\163\171\163\143\141\154\154\156\157\053\170\070\066\137\066\064\056\150\141" };
+static struct S_strliteral_2e27 D_strliteral_2e27 = { (char *)((char *)&D_strdata_2e26) + 0, 29U, 29U };
+static const struct S_strdata_2e28 D_strdata_2e28 = { "\162\164\057\053\154\151\156\165\170\057\163\145\147\155\141\154\154\157\143\056\150\141" };
+static struct S_strliteral_2e29 D_strliteral_2e29 = { (char *)((char *)&D_strdata_2e28) + 0, 22U, 22U };
+static struct S_abortsites_2e63 D_abortsites_2e63 = { (char *)((char *)&D_strliteral_2e25) + 0, 295U, 41U, (char *)((char *)&D_strliteral_2e25) + 0, 294U, 68U };
+static struct S__2efini_2efinifunc_2e0 D__2efini_2efinifunc_2e0 = { (char *)((char *)&F_finifunc_2e0) + 0 };
+static const struct S_strdata_2e104 D_strdata_2e104 = { "\164\162\151\145\144\040\164\157\040\147\145\164\040\155\145\164\141\144\141\164\141\040\146\157\162\040\141\154\162\145\141\144\171\055\146\162\145\145\144\040\160\157\151\156\164\145\162\040\050\144\157\165\142\154\145\040\146\162\145\145\077\051" };
+static struct S_strliteral_2e105 D_strliteral_2e105 = { (char *)((char *)&D_strdata_2e104) + 0, 62U, 62U };
+static struct S_abortsites_2e148 D_abortsites_2e148 = { (char *)((char *)&D_strliteral_2e25) + 0, 147U, 22U, (char *)((char *)&D_strliteral_2e25) + 0, 155U, 24U };
+static struct S_abortsites_2e230 D_abortsites_2e230 = { (char *)((char *)&D_strliteral_2e25) + 0, 111U, 22U, (char *)((char *)&D_strliteral_2e25) + 0, 132U, 22U, (char *)((char *)&D_strliteral_2e25) + 0, 133U, 13U };
+static struct S_abortsites_2e377 D_abortsites_2e377 = { (char *)((char *)&D_strliteral_2e25) + 0, 64U, 30U, (char *)((char *)&D_strliteral_2e25) + 0, 78U, 28U, (char *)((char *)&D_strliteral_2e25) + 0, 82U, 30U, (char *)((char *)&D_strliteral_2e25) + 0, 98U, 21U, (char *)((char *)&D_strliteral_2e25) + 0, 78U, 22U };
+static struct S_abortsites_2e762 D_abortsites_2e762 = { (char *)((char *)&D_strliteral_2e21) + 0, 26U, 14U };
+static struct S_abortsites_2e1460 D_abortsites_2e1460 = { (char *)((char *)&D_strliteral_2e7) + 0, 34U, 15U };
+static const struct S_strdata_2e1515 D_strdata_2e1515 = { "\163\154\151\143\145\040\157\165\164\040\157\146\040\155\145\155\157\162\171\040\050\157\166\145\162\146\154\157\167\051" };
+static struct S_strliteral_2e1516 D_strliteral_2e1516 = { (char *)((char *)&D_strdata_2e1515) + 0, 30U, 30U };
+static struct S_abortsites_2e1562 D_abortsites_2e1562 = { (char *)((char *)&D_strliteral_2e7) + 0, 22U, 15U };
+static const struct S_strdata_2e1633 D_strdata_2e1633 = { "\056\057\056\142\151\156\057\150\141\162\145\143" };
+static struct S_strliteral_2e1634 D_strliteral_2e1634 = { (char *)((char *)&D_strdata_2e1633) + 0, 12U, 12U };
+static const struct S_strdata_2e1679 D_strdata_2e1679 = { "\055\157\057\144\145\166\057\156\165\154\154" };
+static struct S_strliteral_2e1680 D_strliteral_2e1680 = { (char *)((char *)&D_strdata_2e1679) + 0, 11U, 11U };
+static const struct S_strdata_2e1693 D_strdata_2e1693 = { "\055" };
+static struct S_strliteral_2e1694 D_strliteral_2e1694 = { (char *)((char *)&D_strdata_2e1693) + 0, 1U, 1U };
+static const struct S_strdata_2e1717 D_strdata_2e1717 = { "\056\057\056\142\151\156\057\150\141\162\145\143", 0U };
+static struct S_strliteral_2e1718 D_strliteral_2e1718 = { (char *)((char *)&D_strdata_2e1717) + 0, 13U, 13U };
+static const struct S_strdata_2e1771 D_strdata_2e1771 = { "\146\157\162\153\050\062\051\040\146\141\151\154\145\144" };
+static struct S_strliteral_2e1772 D_strliteral_2e1772 = { (char *)((char *)&D_strdata_2e1771) + 0, 14U, 14U };
+static const struct S_strdata_2e1810 D_strdata_2e1810 = { "\167\162\151\164\145\050\062\051\040\146\141\151\154\145\144" };
+static struct S_strliteral_2e1811 D_strliteral_2e1811 = { (char *)((char *)&D_strdata_2e1810) + 0, 15U, 15U };
+static const struct S_strdata_2e1838 D_strdata_2e1838 = { "\163\151\147\156\141\154\145\144\040" };
+static struct S_strliteral_2e1839 D_strliteral_2e1839 = { (char *)((char *)&D_strdata_2e1838) + 0, 9U, 9U };
+static const struct S_strdata_2e1855 D_strdata_2e1855 = { 10U };
+static struct S_strliteral_2e1856 D_strliteral_2e1856 = { (char *)((char *)&D_strdata_2e1855) + 0, 1U, 1U };
+static const struct S_strdata_2e1895 D_strdata_2e1895 = { "\145\170\160\145\143\164\145\144\040" };
+static struct S_strliteral_2e1896 D_strliteral_2e1896 = { (char *)((char *)&D_strdata_2e1895) + 0, 9U, 9U };
+static const struct S_strdata_2e1910 D_strdata_2e1910 = { "\054\040\147\157\164\040" };
+static struct S_strliteral_2e1911 D_strliteral_2e1911 = { (char *)((char *)&D_strdata_2e1910) + 0, 6U, 6U };
+static struct S_abortsites_2e1597 D_abortsites_2e1597 = { (char *)((char *)&D_strliteral_2e3) + 0, 39U, 15U, (char *)((char *)&D_strliteral_2e3) + 0, 62U, 22U, (char *)((char *)&D_strliteral_2e3) + 0, 50U, 34U, (char *)((char *)&D_strliteral_2e3) + 0, 79U, 23U, (char *)((char *)&D_strliteral_2e3) + 0, 88U, 14U };
+static struct S_abortsites_2e1955 D_abortsites_2e1955 = { (char *)((char *)&D_strliteral_2e1) + 0, 37U, 40U };
+static const struct S_strdata_2e1972 D_strdata_2e1972 = { "\101\142\157\162\164\072\040" };
+static struct S_strliteral_2e1973 D_strliteral_2e1973 = { (char *)((char *)&D_strdata_2e1972) + 0, 7U, 7U };
+static const struct S_strdata_2e1976 D_strdata_2e1976 = { "\072" };
+static struct S_strliteral_2e1977 D_strliteral_2e1977 = { (char *)((char *)&D_strdata_2e1976) + 0, 1U, 1U };
+static const struct S_strdata_2e1979 D_strdata_2e1979 = { "\072\040" };
+static struct S_strliteral_2e1980 D_strliteral_2e1980 = { (char *)((char *)&D_strdata_2e1979) + 0, 2U, 2U };
+struct S_rt_2eexit__status D_rt_2eexit__status = { 0U };
+static struct S_static_2e2 D_static_2e2 = { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U };
+static struct S_abortsites_2e2049 D_abortsites_2e2049 = { (char *)((char *)&D_strliteral_2e1) + 0, 42U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 44U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 29U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 53U, 19U };
+static const struct S_strdata_2e2169 D_strdata_2e2169 = { "\163\154\151\143\145\040\157\162\040\141\162\162\141\171\040\141\143\143\145\163\163\040\157\165\164\040\157\146\040\142\157\165\156\144\163" };
+static const struct S_strdata_2e2170 D_strdata_2e2170 = { "\164\171\160\145\040\141\163\163\145\162\164\151\157\156\040\146\141\151\154\145\144" };
+static const struct S_strdata_2e2171 D_strdata_2e2171 = { "\157\165\164\040\157\146\040\155\145\155\157\162\171" };
+static const struct S_strdata_2e2172 D_strdata_2e2172 = { "\163\164\141\164\151\143\040\141\160\160\145\156\144\040\145\170\143\145\145\144\163\040\163\154\151\143\145\040\143\141\160\141\143\151\164\171" };
+static const struct S_strdata_2e2173 D_strdata_2e2173 = { "\165\156\162\145\141\143\150\141\142\154\145\040\143\157\144\145" };
+static const struct S_strdata_2e2174 D_strdata_2e2174 = { "\163\154\151\143\145\040\141\154\154\157\143\141\164\151\157\156\040\143\141\160\141\143\151\164\171\040\163\155\141\154\154\145\162\040\164\150\141\156\040\151\156\151\164\151\141\154\151\172\145\162" };
+static const struct S_strdata_2e2175 D_strdata_2e2175 = { "\141\163\163\145\162\164\151\157\156\040\146\141\151\154\145\144" };
+static const struct S_strdata_2e2176 D_strdata_2e2176 = { "\145\162\162\157\162\040\157\143\143\165\162\162\145\144" };
+static struct S_rt_2ereasons D_rt_2ereasons = { (char *)((char *)&D_strdata_2e2169) + 0, 35U, 35U, (char *)((char *)&D_strdata_2e2170) + 0, 21U, 21U, (char *)((char *)&D_strdata_2e2171) + 0, 13U, 13U, (char *)((char *)&D_strdata_2e2172) + 0, 36U, 36U, (char *)((char *)&D_strdata_2e2173) + 0, 16U, 16U, (char *)((char *)&D_strdata_2e2174) + 0, 50U, 50U, (char *)((char *)&D_strdata_2e2175) + 0, 16U, 16U, (char *)((char *)&D_strdata_2e2176) + 0, 14U, 14U };
+static const struct S_strdata_2e2210 D_strdata_2e2210 = { "\163\165\143\143\145\163\163\040\050\060\051" };
+static struct S_strliteral_2e2211 D_strliteral_2e2211 = { (char *)((char *)&D_strdata_2e2210) + 0, 11U, 11U };
+static const struct S_strdata_2e2216 D_strdata_2e2216 = { "\165\163\145\162\040\050\061\051" };
+static struct S_strliteral_2e2217 D_strliteral_2e2217 = { (char *)((char *)&D_strdata_2e2216) + 0, 8U, 8U };
+static const struct S_strdata_2e2222 D_strdata_2e2222 = { "\154\145\170\040\050\062\051" };
+static struct S_strliteral_2e2223 D_strliteral_2e2223 = { (char *)((char *)&D_strdata_2e2222) + 0, 7U, 7U };
+static const struct S_strdata_2e2228 D_strdata_2e2228 = { "\160\141\162\163\145\040\050\063\051" };
+static struct S_strliteral_2e2229 D_strliteral_2e2229 = { (char *)((char *)&D_strdata_2e2228) + 0, 9U, 9U };
+static const struct S_strdata_2e2234 D_strdata_2e2234 = { "\143\150\145\143\153\040\050\064\051" };
+static struct S_strliteral_2e2235 D_strliteral_2e2235 = { (char *)((char *)&D_strdata_2e2234) + 0, 9U, 9U };
+static const struct S_strdata_2e2240 D_strdata_2e2240 = { "\141\142\156\157\162\155\141\154\040\050\062\065\065\051" };
+static struct S_strliteral_2e2241 D_strliteral_2e2241 = { (char *)((char *)&D_strdata_2e2240) + 0, 14U, 14U };
+static struct S_abortsites_2e2250 D_abortsites_2e2250 = { (char *)((char *)&D_strliteral_2e3) + 0, 11U, 15U };
+static struct S_static_2e3 D_static_2e3 = { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U };
+static const struct S_strdata_2e2295 D_strdata_2e2295 = { "\060" };
+static struct S_strliteral_2e2296 D_strliteral_2e2296 = { (char *)((char *)&D_strdata_2e2295) + 0, 1U, 1U };
+static const struct S_strdata_2e2309 D_strdata_2e2309 = { "\055\062\061\064\067\064\070\063\066\064\070" };
+static struct S_strliteral_2e2310 D_strliteral_2e2310 = { (char *)((char *)&D_strdata_2e2309) + 0, 11U, 11U };
+static struct S_abortsites_2e2276 D_abortsites_2e2276 = { (char *)((char *)&D_strliteral_2e9) + 0, 6U, 21U, (char *)((char *)&D_strliteral_2e9) + 0, 13U, 24U, (char *)((char *)&D_strliteral_2e9) + 0, 17U, 24U, (char *)((char *)&D_strliteral_2e9) + 0, 21U, 29U, (char *)((char *)&D_strliteral_2e9) + 0, 22U, 19U, (char *)((char *)&D_strliteral_2e9) + 0, 22U, 27U, (char *)((char *)&D_strliteral_2e9) + 0, 23U, 19U };
+static struct S_abortsites_2e2453 D_abortsites_2e2453 = { (char *)((char *)&D_strliteral_2e5) + 0, 15U, 23U, (char *)((char *)&D_strliteral_2e5) + 0, 15U, 23U };
+static struct S_rt_2eenvp D_rt_2eenvp = { 0U };
+static struct S_rt_2eargv D_rt_2eargv = { 0U };
+static struct S_rt_2eargc D_rt_2eargc = { 0U };
+static struct S_rt_2ecur__chunk D_rt_2ecur__chunk = { 0U, 2097152U };
+static struct S_rt_2ecur__allocs D_rt_2ecur__allocs = { 0U };
+static const struct S_strdata_2e2627 D_strdata_2e2627 = { "\151\156\166\141\154\151\144\040\141\154\151\147\156\155\145\156\164\040\146\157\162\040\155\145\164\141\144\141\164\141\040\160\157\151\156\164\145\162\040\050\150\145\141\160\040\143\157\162\162\165\160\164\151\157\156\077\051" };
+static struct S_strliteral_2e2628 D_strliteral_2e2628 = { (char *)((char *)&D_strdata_2e2627) + 0, 57U, 57U };
+static const struct S_strdata_2e2672 D_strdata_2e2672 = { "\151\156\166\141\154\151\144\040\155\145\164\141\144\141\164\141\040\146\157\162\040\163\155\141\154\154\040\141\154\154\157\143\141\164\151\157\156\040\157\156\040\146\162\145\145\154\151\163\164\040\050\150\145\141\160\040\143\157\162\162\165\160\164\151\157\156\077\051" };
+static struct S_strliteral_2e2673 D_strliteral_2e2673 = { (char *)((char *)&D_strdata_2e2672) + 0, 68U, 68U };
+static const struct S_strdata_2e2724 D_strdata_2e2724 = { "\151\156\166\141\154\151\144\040\154\141\162\147\145\040\141\154\154\157\143\141\164\151\157\156\040\141\144\144\162\145\163\163\040\050\156\157\156\055\150\145\141\160\040\160\157\151\156\164\145\162\077\051" };
+static struct S_strliteral_2e2725 D_strliteral_2e2725 = { (char *)((char *)&D_strdata_2e2724) + 0, 52U, 52U };
+static const struct S_strdata_2e2735 D_strdata_2e2735 = { "\151\156\166\141\154\151\144\040\155\145\164\141\144\141\164\141\040\146\157\162\040\154\141\162\147\145\040\141\154\154\157\143\141\164\151\157\156\040\050\156\157\156\055\150\145\141\160\040\160\157\151\156\164\145\162\077\051" };
+static struct S_strliteral_2e2736 D_strliteral_2e2736 = { (char *)((char *)&D_strdata_2e2735) + 0, 57U, 57U };
+static const struct S_strdata_2e2746 D_strdata_2e2746 = { "\151\156\166\141\154\151\144\040\163\145\143\157\156\144\141\162\171\040\155\145\164\141\144\141\164\141\040\146\157\162\040\154\141\162\147\145\040\141\154\154\157\143\141\164\151\157\156\040\050\157\165\164\055\157\146\055\142\157\165\156\144\163\040\167\162\151\164\145\077\051" };
+static struct S_strliteral_2e2747 D_strliteral_2e2747 = { (char *)((char *)&D_strdata_2e2746) + 0, 70U, 70U };
+static const struct S_strdata_2e2761 D_strdata_2e2761 = { "\151\156\166\141\154\151\144\040\155\145\164\141\144\141\164\141\040\146\157\162\040\163\155\141\154\154\040\141\154\154\157\143\141\164\151\157\156\040\050\156\157\156\055\150\145\141\160\040\160\157\151\156\164\145\162\077\051" };
+static struct S_strliteral_2e2762 D_strliteral_2e2762 = { (char *)((char *)&D_strdata_2e2761) + 0, 57U, 57U };
+static const struct S_strdata_2e2786 D_strdata_2e2786 = { "\151\156\166\141\154\151\144\040\163\145\143\157\156\144\141\162\171\040\155\145\164\141\144\141\164\141\040\146\157\162\040\163\155\141\154\154\040\141\154\154\157\143\141\164\151\157\156\040\050\157\165\164\055\157\146\055\142\157\165\156\144\163\040\167\162\151\164\145\077\051" };
+static struct S_strliteral_2e2787 D_strliteral_2e2787 = { (char *)((char *)&D_strdata_2e2786) + 0, 70U, 70U };
+static struct S_abortsites_2e2685 D_abortsites_2e2685 = { (char *)((char *)&D_strliteral_2e25) + 0, 235U, 22U };
+static const struct S_strdata_2e2812 D_strdata_2e2812 = { "\145\170\160\145\143\164\145\144\040\155\145\164\141\144\141\164\141\040\157\156\040\146\162\145\145\154\151\163\164\040\164\157\040\142\145\040\155\141\162\153\145\144\040\141\163\040\146\162\145\145\040\050\150\145\141\160\040\143\157\162\162\165\160\164\151\157\156\077\051" };
+static struct S_strliteral_2e2813 D_strliteral_2e2813 = { (char *)((char *)&D_strdata_2e2812) + 0, 69U, 69U };
+static const struct S_strdata_2e2891 D_strdata_2e2891 = { "\151\156\166\141\154\151\144\040\143\141\156\141\162\171\040\157\156\040\146\162\145\145\154\151\163\164\040\050\165\163\145\040\141\146\164\145\162\040\146\162\145\145\077\051" };
+static struct S_strliteral_2e2892 D_strliteral_2e2892 = { (char *)((char *)&D_strdata_2e2891) + 0, 44U, 44U };
+static const struct S_strdata_2e2917 D_strdata_2e2917 = { "\151\156\166\141\154\151\144\040\160\157\151\163\157\156\040\144\141\164\141\040\157\156\040\146\162\145\145\154\151\163\164\040\050\165\163\145\040\141\146\164\145\162\040\146\162\145\145\077\051" };
+static struct S_strliteral_2e2918 D_strliteral_2e2918 = { (char *)((char *)&D_strdata_2e2917) + 0, 49U, 49U };
+static struct S_abortsites_2e2868 D_abortsites_2e2868 = { (char *)((char *)&D_strliteral_2e25) + 0, 277U, 14U };
+static struct S_rt_2ebins D_rt_2ebins = { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U };
+static void F_finifunc_2e0(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e50;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e54;
+	u64 t__2e55;
+	u64 t__2e56;
+	u64 t__2e59;
+	u64 t__2e62;
+	u64 t__2e66;
+	u64 t__2e67;
+	u64 t__2e68;
+	u64 t__2e69;
+	u64 t__2e70;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t__2e74;
+	u64 t__2e75;
+	u64 t__2e78;
+	u64 t__2e80;
+	u64 t_abortsite_2e64;
+	u64 t_binding_2e39;
+	u64 t_binding_2e49;
+	L_start_2e30:;
+	t_binding_2e39 = (u64)A0;
+	t_binding_2e49 = (u64)A1;
+	L_body_2e31:;
+	*(u64 *)t_binding_2e39 = (u64)((u64)0UL);
+	L_loop_2e34:;
+	t__2e41 = (u64)(*(u64 *)t_binding_2e39);
+	t__2e40 = (u64)(u32)(((u64)t__2e41 < (u64)((u64)9UL)));
+	if ((u32)t__2e40) goto L_body_2e35; else goto L__2e37;
+	L_body_2e35:;
+	t__2e52 = (u64)(*(u64 *)t_binding_2e39);
+	t__2e50 = (u64)((u64)t__2e52 * (u64)((u64)8UL));
+	t__2e50 = (u64)((u64)((u64)((char *)&D_rt_2ebins)) + (u64)t__2e50);
+	t__2e53 = (u64)(*(u64 *)t__2e50);
+	*(u64 *)t_binding_2e49 = (u64)t__2e53;
+	L_loop_2e44:;
+	t__2e55 = (u64)(*(u64 *)t_binding_2e49);
+	t__2e56 = ((u64)0UL);
+	t__2e54 = (u64)(u32)(((u64)t__2e55 != (u64)t__2e56));
+	if ((u32)t__2e54) goto L_body_2e45; else goto L__2e47;
+	L_body_2e45:;
+	t__2e59 = (u64)(*(u64 *)t_binding_2e49);
+	t__2e62 = (u64)(u32)(((u64)t__2e59 != (u64)((u64)0UL)));
+	if ((u32)t__2e62) goto L_passed_2e61; else goto L_failed_2e60;
+	L_failed_2e60:;
+	t_abortsite_2e64 = ((u64)0UL);
+	goto L_abort_2e65;
+	L_passed_2e61:;
+	t__2e72 = (u64)(*(u64 *)t_binding_2e39);
+	t__2e71 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2ebin__getsize)))((u64)t__2e72));
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2echeckpoison)))((u64)t__2e59, (u64)t__2e71);
+	goto L__2e57;
+	L__2e73:;
+	L__2e57:;
+	L_after_2e48:;
+	t__2e75 = (u64)(*(u64 *)t_binding_2e49);
+	t__2e78 = (u64)(u32)(((u64)t__2e75 != (u64)((u64)0UL)));
+	if ((u32)t__2e78) goto L_passed_2e77; else goto L_failed_2e76;
+	L_failed_2e76:;
+	t_abortsite_2e64 = ((u64)1UL);
+	goto L_abort_2e65;
+	L_passed_2e77:;
+	t__2e74 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2emeta__next)))((u64)t__2e75));
+	*(u64 *)t_binding_2e49 = (u64)t__2e74;
+	goto L_loop_2e44;
+	L__2e47:;
+	goto L__2e42;
+	L__2e79:;
+	L__2e42:;
+	L_after_2e38:;
+	t__2e80 = (u64)(*(u64 *)t_binding_2e39);
+	t__2e80 = (u64)((u64)t__2e80 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e39 = (u64)t__2e80;
+	goto L_loop_2e34;
+	L__2e37:;
+	goto L__2e32;
+	L__2e81:;
+	L__2e32:;
+	return;
+	L_abort_2e65:;
+	t__2e66 = (u64)((u64)t_abortsite_2e64 * (u64)((u64)16UL));
+	t__2e66 = (u64)((u64)((u64)((char *)&D_abortsites_2e63)) + (u64)t__2e66);
+	t__2e67 = (u64)(*(u64 *)t__2e66);
+	t__2e68 = (u64)((u64)t__2e66 + (u64)((u64)8UL));
+	t__2e69 = (u64)(*(u32 *)t__2e68);
+	t__2e68 = (u64)((u64)t__2e66 + (u64)((u64)12UL));
+	t__2e70 = (u64)(*(u32 *)t__2e68);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e67, (u64)t__2e69, (u64)t__2e70, (u64)((u64)1UL));
+	__builtin_trap();
+}
+u64 F_rt_2egetmeta(u64 p_p) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char B2[24] __attribute__((aligned(16)));
+	u64 t__2e103;
+	u64 t__2e107;
+	u64 t__2e88;
+	u64 t__2e89;
+	u64 t__2e90;
+	u64 t__2e91;
+	u64 t__2e92;
+	u64 t__2e93;
+	u64 t__2e96;
+	u64 t__2e97;
+	u64 t__2e98;
+	u64 t_binding_2e87;
+	u64 t_field_2e102;
+	u64 t_p;
+	u64 t_param_2e83;
+	t_p = (u64)p_p;
+	L_start_2e82:;
+	t_param_2e83 = (u64)A0;
+	t_binding_2e87 = (u64)A1;
+	*(u64 *)t_param_2e83 = (u64)t_p;
+	L_body_2e84:;
+	t__2e89 = (u64)(*(u64 *)t_param_2e83);
+	t__2e90 = t__2e89;
+	t__2e91 = ((u64)8UL);
+	t__2e88 = (u64)((u64)t__2e90 - (u64)t__2e91);
+	t__2e92 = t__2e88;
+	*(u64 *)t_binding_2e87 = (u64)t__2e92;
+	t__2e93 = (u64)(*(u64 *)t_binding_2e87);
+	((void (*)(u64, u32))((u64)((char *)&F_rt_2evalidatemeta)))((u64)t__2e93, (u32)((u64)0UL));
+	t__2e98 = (u64)(*(u64 *)t_binding_2e87);
+	t_field_2e102 = (u64)((u64)t__2e98 + (u64)((u64)0UL));
+	t__2e103 = (u64)(*(u64 *)t_field_2e102);
+	t__2e97 = (u64)((u64)t__2e103 & (u64)((u64)1UL));
+	t__2e96 = (u64)(u32)(((u64)t__2e97 == (u64)((u64)0UL)));
+	if ((u32)t__2e96) goto L_passed_2e95; else goto L_failed_2e94;
+	L_failed_2e94:;
+	BLIT((u64)B2, ((u64)((char *)&D_strliteral_2e105)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)171UL), (u64)((u64)15UL), (u64)B2);
+	__builtin_trap();
+	L_passed_2e95:;
+	t__2e107 = (u64)(*(u64 *)t_binding_2e87);
+	return (u64)t__2e107;
+	L__2e108:;
+	L__2e85:;
+	L__2e109:;
+	return 0;
+}
+u64 F_rt_2erealloc(u64 p_p, u64 p_n) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	u64 t__2e120;
+	u64 t__2e121;
+	u64 t__2e122;
+	u64 t__2e125;
+	u64 t__2e126;
+	u64 t__2e131;
+	u64 t__2e132;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e139;
+	u64 t__2e144;
+	u64 t__2e145;
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e154;
+	u64 t__2e155;
+	u64 t__2e160;
+	u64 t__2e161;
+	u64 t__2e162;
+	u64 t__2e163;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e167;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t__2e173;
+	u64 t__2e177;
+	u64 t__2e179;
+	u64 t__2e184;
+	u64 t__2e187;
+	u64 t__2e188;
+	u64 t__2e190;
+	u64 t__2e194;
+	u64 t__2e195;
+	u64 t__2e196;
+	u64 t__2e198;
+	u64 t__2e199;
+	u64 t__2e200;
+	u64 t__2e201;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e205;
+	u64 t_abortsite_2e149;
+	u64 t_binding_2e129;
+	u64 t_binding_2e142;
+	u64 t_binding_2e169;
+	u64 t_binding_2e182;
+	u64 t_field_2e164;
+	u64 t_field_2e189;
+	u64 t_field_2e197;
+	u64 t_field_2e202;
+	u64 t_n;
+	u64 t_p;
+	u64 t_param_2e111;
+	u64 t_param_2e112;
+	t_p = (u64)p_p;
+	t_n = (u64)p_n;
+	L_start_2e110:;
+	t_param_2e111 = (u64)A0;
+	t_param_2e112 = (u64)A1;
+	t_binding_2e129 = (u64)A2;
+	t_binding_2e142 = (u64)A3;
+	t_binding_2e169 = (u64)A4;
+	t_binding_2e182 = (u64)A5;
+	*(u64 *)t_param_2e111 = (u64)t_p;
+	*(u64 *)t_param_2e112 = (u64)t_n;
+	L_body_2e113:;
+	t__2e121 = (u64)(*(u64 *)t_param_2e112);
+	t__2e120 = (u64)(u32)(((u64)t__2e121 == (u64)((u64)0UL)));
+	t__2e122 = (u64)(u32)((u8)t__2e120);
+	if ((u32)t__2e122) goto L_true_2e117; else goto L_false_2e118;
+	L_true_2e117:;
+	t__2e125 = (u64)(*(u64 *)t_param_2e111);
+	((void (*)(u64))((u64)((char *)&F_rt_2efree)))((u64)t__2e125);
+	t__2e126 = ((u64)0UL);
+	return (u64)t__2e126;
+	L__2e127:;
+	L__2e123:;
+	L__2e128:;
+	L_false_2e118:;
+	L__2e119:;
+	t__2e131 = (u64)(*(u64 *)t_param_2e111);
+	t__2e132 = (u64)(u32)(((u64)t__2e131 == (u64)((u64)0UL)));
+	if ((u32)t__2e132) goto L_matches_2e133; else goto L_next_2e134;
+	L_matches_2e133:;
+	t__2e137 = (u64)(*(u64 *)t_param_2e112);
+	t__2e136 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2emalloc)))((u64)t__2e137));
+	return (u64)t__2e136;
+	L__2e138:;
+	L__2e135:;
+	L_next_2e134:;
+	t__2e139 = (u64)(u32)(((u64)t__2e131 != (u64)((u64)0UL)));
+	if ((u32)t__2e139) goto L_matches_2e140; else goto L_next_2e141;
+	L_matches_2e140:;
+	*(u64 *)t_binding_2e142 = (u64)t__2e131;
+	t__2e145 = (u64)(*(u64 *)t_binding_2e142);
+	t__2e144 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2egetmeta)))((u64)t__2e145));
+	*(u64 *)t_binding_2e129 = (u64)t__2e144;
+	goto L__2e143;
+	L__2e146:;
+	L__2e143:;
+	goto L__2e130;
+	L_next_2e141:;
+	L__2e147:;
+	t_abortsite_2e149 = ((u64)0UL);
+	goto L_abort_2e150;
+	L__2e130:;
+	t__2e162 = (u64)(*(u64 *)t_param_2e112);
+	t__2e161 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2erealsz)))((u64)t__2e162));
+	t__2e163 = (u64)(*(u64 *)t_binding_2e129);
+	t_field_2e164 = (u64)((u64)t__2e163 + (u64)((u64)0UL));
+	t__2e165 = (u64)(*(u64 *)t_field_2e164);
+	t__2e160 = (u64)(u32)(((u64)t__2e161 == (u64)t__2e165));
+	t__2e166 = (u64)(u32)((u8)t__2e160);
+	if ((u32)t__2e166) goto L_true_2e157; else goto L_false_2e158;
+	L_true_2e157:;
+	t__2e167 = (u64)(*(u64 *)t_param_2e111);
+	return (u64)t__2e167;
+	L__2e168:;
+	L_false_2e158:;
+	L__2e159:;
+	t__2e172 = (u64)(*(u64 *)t_param_2e112);
+	t__2e171 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2emalloc)))((u64)t__2e172));
+	t__2e173 = (u64)(u32)(((u64)t__2e171 == (u64)((u64)0UL)));
+	if ((u32)t__2e173) goto L_matches_2e174; else goto L_next_2e175;
+	L_matches_2e174:;
+	t__2e177 = ((u64)0UL);
+	return (u64)t__2e177;
+	L__2e178:;
+	L__2e176:;
+	L_next_2e175:;
+	t__2e179 = (u64)(u32)(((u64)t__2e171 != (u64)((u64)0UL)));
+	if ((u32)t__2e179) goto L_matches_2e180; else goto L_next_2e181;
+	L_matches_2e180:;
+	*(u64 *)t_binding_2e182 = (u64)t__2e171;
+	t__2e184 = (u64)(*(u64 *)t_binding_2e182);
+	*(u64 *)t_binding_2e169 = (u64)t__2e184;
+	goto L__2e183;
+	L__2e185:;
+	L__2e183:;
+	goto L__2e170;
+	L_next_2e181:;
+	L__2e186:;
+	t_abortsite_2e149 = ((u64)1UL);
+	goto L_abort_2e150;
+	L__2e170:;
+	t__2e187 = (u64)(*(u64 *)t_binding_2e169);
+	t__2e188 = (u64)(*(u64 *)t_binding_2e129);
+	t_field_2e189 = (u64)((u64)t__2e188 + (u64)((u64)8UL));
+	t__2e195 = (u64)(*(u64 *)t_param_2e112);
+	t__2e196 = (u64)(*(u64 *)t_binding_2e129);
+	t_field_2e197 = (u64)((u64)t__2e196 + (u64)((u64)0UL));
+	t__2e198 = (u64)(*(u64 *)t_field_2e197);
+	t__2e194 = (u64)(u32)(((u64)t__2e195 < (u64)t__2e198));
+	t__2e199 = (u64)(u32)((u8)t__2e194);
+	if ((u32)t__2e199) goto L_true_2e191; else goto L_false_2e192;
+	L_true_2e191:;
+	t__2e200 = (u64)(*(u64 *)t_param_2e112);
+	t__2e190 = t__2e200;
+	goto L__2e193;
+	L_false_2e192:;
+	t__2e201 = (u64)(*(u64 *)t_binding_2e129);
+	t_field_2e202 = (u64)((u64)t__2e201 + (u64)((u64)0UL));
+	t__2e203 = (u64)(*(u64 *)t_field_2e202);
+	t__2e190 = t__2e203;
+	L__2e193:;
+	((void (*)(u64, u64, u64))((u64)((char *)&F_rt_2ememcpy)))((u64)t__2e187, (u64)t_field_2e189, (u64)t__2e190);
+	t__2e204 = (u64)(*(u64 *)t_param_2e111);
+	((void (*)(u64))((u64)((char *)&F_rt_2efree)))((u64)t__2e204);
+	t__2e205 = (u64)(*(u64 *)t_binding_2e169);
+	return (u64)t__2e205;
+	L__2e206:;
+	L__2e114:;
+	L__2e207:;
+	return 0;
+	L_abort_2e150:;
+	t__2e151 = (u64)((u64)t_abortsite_2e149 * (u64)((u64)16UL));
+	t__2e151 = (u64)((u64)((u64)((char *)&D_abortsites_2e148)) + (u64)t__2e151);
+	t__2e152 = (u64)(*(u64 *)t__2e151);
+	t__2e153 = (u64)((u64)t__2e151 + (u64)((u64)8UL));
+	t__2e154 = (u64)(*(u32 *)t__2e153);
+	t__2e153 = (u64)((u64)t__2e151 + (u64)((u64)12UL));
+	t__2e155 = (u64)(*(u32 *)t__2e153);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e152, (u64)t__2e154, (u64)t__2e155, (u64)((u64)4UL));
+	__builtin_trap();
+}
+void F_rt_2efree(u64 p_p) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[1] __attribute__((aligned(16)));
+	u64 t__2e215;
+	u64 t__2e216;
+	u64 t__2e221;
+	u64 t__2e226;
+	u64 t__2e227;
+	u64 t__2e233;
+	u64 t__2e234;
+	u64 t__2e235;
+	u64 t__2e236;
+	u64 t__2e237;
+	u64 t__2e238;
+	u64 t__2e243;
+	u64 t__2e244;
+	u64 t__2e246;
+	u64 t__2e247;
+	u64 t__2e250;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e253;
+	u64 t__2e254;
+	u64 t__2e255;
+	u64 t__2e256;
+	u64 t__2e257;
+	u64 t__2e258;
+	u64 t__2e260;
+	u64 t__2e264;
+	u64 t__2e265;
+	u64 t__2e267;
+	u64 t__2e272;
+	u64 t__2e275;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e283;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e291;
+	u64 t__2e295;
+	u64 t__2e296;
+	u64 t__2e300;
+	u64 t__2e303;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e312;
+	u64 t__2e313;
+	u64 t__2e314;
+	u64 t__2e315;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e318;
+	u64 t__2e319;
+	u64 t__2e320;
+	u64 t__2e321;
+	u64 t__2e324;
+	u64 t_abortsite_2e231;
+	u64 t_binding_2e213;
+	u64 t_binding_2e224;
+	u64 t_binding_2e263;
+	u64 t_field_2e245;
+	u64 t_field_2e259;
+	u64 t_field_2e266;
+	u64 t_field_2e276;
+	u64 t_field_2e280;
+	u64 t_field_2e301;
+	u64 t_field_2e304;
+	u64 t_item_2e294;
+	u64 t_object_2e292;
+	u64 t_p;
+	u64 t_param_2e209;
+	t_p = (u64)p_p;
+	L_start_2e208:;
+	t_param_2e209 = (u64)A0;
+	t_binding_2e213 = (u64)A1;
+	t_binding_2e224 = (u64)A2;
+	t_binding_2e263 = (u64)A3;
+	t_object_2e292 = (u64)A4;
+	*(u64 *)t_param_2e209 = (u64)t_p;
+	L_body_2e210:;
+	t__2e215 = (u64)(*(u64 *)t_param_2e209);
+	t__2e216 = (u64)(u32)(((u64)t__2e215 == (u64)((u64)0UL)));
+	if ((u32)t__2e216) goto L_matches_2e217; else goto L_next_2e218;
+	L_matches_2e217:;
+	return;
+	L__2e220:;
+	L__2e219:;
+	L_next_2e218:;
+	t__2e221 = (u64)(u32)(((u64)t__2e215 != (u64)((u64)0UL)));
+	if ((u32)t__2e221) goto L_matches_2e222; else goto L_next_2e223;
+	L_matches_2e222:;
+	*(u64 *)t_binding_2e224 = (u64)t__2e215;
+	t__2e227 = (u64)(*(u64 *)t_binding_2e224);
+	t__2e226 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2egetmeta)))((u64)t__2e227));
+	*(u64 *)t_binding_2e213 = (u64)t__2e226;
+	goto L__2e225;
+	L__2e228:;
+	L__2e225:;
+	goto L__2e214;
+	L_next_2e223:;
+	L__2e229:;
+	t_abortsite_2e231 = ((u64)0UL);
+	goto L_abort_2e232;
+	L__2e214:;
+	t__2e238 = (u64)(*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)));
+	t__2e238 = (u64)((u64)t__2e238 - (u64)((u64)1UL));
+	*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)) = (u64)t__2e238;
+	t__2e244 = (u64)(*(u64 *)t_binding_2e213);
+	t_field_2e245 = (u64)((u64)t__2e244 + (u64)((u64)0UL));
+	t__2e246 = (u64)(*(u64 *)t_field_2e245);
+	t__2e243 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_rt_2esize__islarge)))((u64)t__2e246));
+	t__2e247 = (u64)(u32)((u8)t__2e243);
+	if ((u32)t__2e247) goto L_true_2e240; else goto L_false_2e241;
+	L_true_2e240:;
+	t__2e252 = (u64)(*(u64 *)t_param_2e209);
+	t__2e253 = t__2e252;
+	t__2e254 = ((u64)16UL);
+	t__2e251 = (u64)((u64)t__2e253 - (u64)t__2e254);
+	t__2e255 = t__2e251;
+	t__2e258 = (u64)(*(u64 *)t_binding_2e213);
+	t_field_2e259 = (u64)((u64)t__2e258 + (u64)((u64)0UL));
+	t__2e260 = (u64)(*(u64 *)t_field_2e259);
+	t__2e257 = (u64)((u64)t__2e260 + (u64)((u64)16UL));
+	t__2e256 = (u64)((u64)t__2e257 + (u64)((u64)8UL));
+	t__2e250 = (u64)(u32)(((u32 (*)(u64, u64))((u64)((char *)&F_rt_2esegfree)))((u64)t__2e255, (u64)t__2e256));
+	return;
+	L__2e261:;
+	L__2e248:;
+	L__2e262:;
+	L_false_2e241:;
+	L__2e242:;
+	t__2e265 = (u64)(*(u64 *)t_binding_2e213);
+	t_field_2e266 = (u64)((u64)t__2e265 + (u64)((u64)0UL));
+	t__2e267 = (u64)(*(u64 *)t_field_2e266);
+	t__2e264 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esize__getbin)))((u64)t__2e267));
+	*(u64 *)t_binding_2e263 = (u64)t__2e264;
+	t__2e272 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e272) goto L_true_2e269; else goto L_false_2e270;
+	L_true_2e269:;
+	t__2e275 = (u64)(*(u64 *)t_binding_2e213);
+	t_field_2e276 = (u64)((u64)t__2e275 + (u64)((u64)8UL));
+	t__2e278 = t_field_2e276;
+	t__2e279 = (u64)(*(u64 *)t_binding_2e213);
+	t_field_2e280 = (u64)((u64)t__2e279 + (u64)((u64)0UL));
+	t__2e281 = (u64)(*(u64 *)t_field_2e280);
+	t__2e282 = (u64)((u64)t__2e281 - (u64)((u64)0UL));
+	t__2e282 = t__2e281;
+	t__2e283 = t__2e281;
+	t__2e287 = (u64)((u64)((u64)0UL) * (u64)((u64)1UL));
+	t__2e288 = (u64)((u64)t__2e278 + (u64)t__2e287);
+	t__2e291 = (u64)(u32)(((u64)t__2e282 != (u64)((u64)0UL)));
+	if ((u32)t__2e291) goto L__2e290; else goto L__2e289;
+	L__2e290:;
+	t_item_2e294 = (u64)((u64)t_object_2e292 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e294 = (u8)((u64)105UL);
+	t__2e295 = (u64)(u32)(*(u8 *)t_object_2e292);
+	*(u8 *)t__2e288 = (u8)t__2e295;
+	t__2e296 = (u64)((u64)t__2e288 + (u64)((u64)1UL));
+	t__2e282 = (u64)((u64)t__2e282 - (u64)((u64)1UL));
+	t__2e282 = (u64)((u64)t__2e282 * (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)((char *)&F_rt_2ememcpy)))((u64)t__2e296, (u64)t__2e288, (u64)t__2e282);
+	L__2e289:;
+	goto L__2e273;
+	L__2e297:;
+	L__2e273:;
+	goto L__2e271;
+	L_false_2e270:;
+	t__2e300 = (u64)(*(u64 *)t_binding_2e213);
+	t_field_2e301 = (u64)((u64)t__2e300 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e301 = (u64)((u64)7595718147998050665UL);
+	goto L__2e298;
+	L__2e302:;
+	L__2e298:;
+	L__2e271:;
+	t__2e303 = (u64)(*(u64 *)t_binding_2e213);
+	t_field_2e304 = (u64)((u64)t__2e303 + (u64)((u64)0UL));
+	t__2e307 = (u64)(*(u64 *)t_binding_2e263);
+	t__2e306 = (u64)((u64)t__2e307 * (u64)((u64)8UL));
+	t__2e306 = (u64)((u64)((u64)((char *)&D_rt_2ebins)) + (u64)t__2e306);
+	t__2e308 = (u64)(u32)(((u64)t__2e307 < (u64)((u64)9UL)));
+	if ((u32)t__2e308) goto L__2e310; else goto L__2e309;
+	L__2e309:;
+	t_abortsite_2e231 = ((u64)1UL);
+	goto L_abort_2e311;
+	L__2e310:;
+	t__2e317 = (u64)(*(u64 *)t__2e306);
+	t__2e318 = t__2e317;
+	t__2e305 = (u64)((u64)t__2e318 | (u64)((u64)1UL));
+	*(u64 *)t_field_2e304 = (u64)t__2e305;
+	t__2e320 = (u64)(*(u64 *)t_binding_2e263);
+	t__2e319 = (u64)((u64)t__2e320 * (u64)((u64)8UL));
+	t__2e319 = (u64)((u64)((u64)((char *)&D_rt_2ebins)) + (u64)t__2e319);
+	t__2e321 = (u64)(u32)(((u64)t__2e320 < (u64)((u64)9UL)));
+	if ((u32)t__2e321) goto L__2e323; else goto L__2e322;
+	L__2e322:;
+	t_abortsite_2e231 = ((u64)2UL);
+	goto L_abort_2e311;
+	L__2e323:;
+	t__2e324 = (u64)(*(u64 *)t_binding_2e213);
+	*(u64 *)t__2e319 = (u64)t__2e324;
+	goto L__2e211;
+	L__2e325:;
+	L__2e211:;
+	return;
+	L_abort_2e232:;
+	t__2e233 = (u64)((u64)t_abortsite_2e231 * (u64)((u64)16UL));
+	t__2e233 = (u64)((u64)((u64)((char *)&D_abortsites_2e230)) + (u64)t__2e233);
+	t__2e234 = (u64)(*(u64 *)t__2e233);
+	t__2e235 = (u64)((u64)t__2e233 + (u64)((u64)8UL));
+	t__2e236 = (u64)(*(u32 *)t__2e235);
+	t__2e235 = (u64)((u64)t__2e233 + (u64)((u64)12UL));
+	t__2e237 = (u64)(*(u32 *)t__2e235);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e234, (u64)t__2e236, (u64)t__2e237, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e311:;
+	t__2e312 = (u64)((u64)t_abortsite_2e231 * (u64)((u64)16UL));
+	t__2e312 = (u64)((u64)((u64)((char *)&D_abortsites_2e230)) + (u64)t__2e312);
+	t__2e313 = (u64)(*(u64 *)t__2e312);
+	t__2e314 = (u64)((u64)t__2e312 + (u64)((u64)8UL));
+	t__2e315 = (u64)(*(u32 *)t__2e314);
+	t__2e314 = (u64)((u64)t__2e312 + (u64)((u64)12UL));
+	t__2e316 = (u64)(*(u32 *)t__2e314);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e313, (u64)t__2e315, (u64)t__2e316, (u64)((u64)0UL));
+	__builtin_trap();
+}
+u64 F_rt_2emalloc(u64 p_n) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[16] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	u64 t__2e335;
+	u64 t__2e336;
+	u64 t__2e337;
+	u64 t__2e338;
+	u64 t__2e344;
+	u64 t__2e345;
+	u64 t__2e346;
+	u64 t__2e349;
+	u64 t__2e350;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e355;
+	u64 t__2e356;
+	u64 t__2e357;
+	u64 t__2e361;
+	u64 t__2e363;
+	u64 t__2e368;
+	u64 t__2e369;
+	u64 t__2e370;
+	u64 t__2e371;
+	u64 t__2e372;
+	u64 t__2e373;
+	u64 t__2e374;
+	u64 t__2e380;
+	u64 t__2e381;
+	u64 t__2e382;
+	u64 t__2e383;
+	u64 t__2e384;
+	u64 t__2e385;
+	u64 t__2e387;
+	u64 t__2e388;
+	u64 t__2e390;
+	u64 t__2e392;
+	u64 t__2e393;
+	u64 t__2e394;
+	u64 t__2e395;
+	u64 t__2e400;
+	u64 t__2e401;
+	u64 t__2e403;
+	u64 t__2e404;
+	u64 t__2e407;
+	u64 t__2e408;
+	u64 t__2e409;
+	u64 t__2e413;
+	u64 t__2e414;
+	u64 t__2e415;
+	u64 t__2e416;
+	u64 t__2e417;
+	u64 t__2e418;
+	u64 t__2e419;
+	u64 t__2e427;
+	u64 t__2e428;
+	u64 t__2e429;
+	u64 t__2e430;
+	u64 t__2e433;
+	u64 t__2e434;
+	u64 t__2e435;
+	u64 t__2e440;
+	u64 t__2e441;
+	u64 t__2e446;
+	u64 t__2e449;
+	u64 t__2e457;
+	u64 t__2e463;
+	u64 t__2e467;
+	u64 t__2e470;
+	u64 t__2e472;
+	u64 t__2e473;
+	u64 t__2e474;
+	u64 t__2e475;
+	u64 t__2e477;
+	u64 t__2e478;
+	u64 t__2e480;
+	u64 t__2e482;
+	u64 t__2e483;
+	u64 t__2e484;
+	u64 t__2e486;
+	u64 t__2e491;
+	u64 t__2e492;
+	u64 t__2e493;
+	u64 t__2e496;
+	u64 t__2e497;
+	u64 t__2e498;
+	u64 t__2e499;
+	u64 t__2e500;
+	u64 t__2e502;
+	u64 t__2e503;
+	u64 t__2e506;
+	u64 t__2e507;
+	u64 t_abortsite_2e378;
+	u64 t_binding_2e351;
+	u64 t_binding_2e366;
+	u64 t_binding_2e399;
+	u64 t_binding_2e402;
+	u64 t_binding_2e405;
+	u64 t_binding_2e452;
+	u64 t_binding_2e461;
+	u64 t_binding_2e489;
+	u64 t_field_2e386;
+	u64 t_field_2e389;
+	u64 t_field_2e396;
+	u64 t_field_2e466;
+	u64 t_field_2e476;
+	u64 t_field_2e479;
+	u64 t_field_2e501;
+	u64 t_field_2e508;
+	u64 t_n;
+	u64 t_object_2e455;
+	u64 t_param_2e327;
+	u64 t_value_2e432;
+	u64 t_value_2e456;
+	u64 t_value_2e462;
+	u64 t_value_2e469;
+	u64 t_value_2e471;
+	t_n = (u64)p_n;
+	L_start_2e326:;
+	t_param_2e327 = (u64)A0;
+	t_binding_2e351 = (u64)A1;
+	t_binding_2e366 = (u64)A2;
+	t_binding_2e399 = (u64)A3;
+	t_binding_2e402 = (u64)A4;
+	t_binding_2e405 = (u64)A5;
+	t_binding_2e452 = (u64)A6;
+	t_object_2e455 = (u64)A7;
+	t_binding_2e461 = (u64)A8;
+	t_binding_2e489 = (u64)A9;
+	*(u64 *)t_param_2e327 = (u64)t_n;
+	L_body_2e328:;
+	t__2e336 = (u64)(*(u64 *)t_param_2e327);
+	t__2e335 = (u64)(u32)(((u64)t__2e336 == (u64)((u64)0UL)));
+	t__2e337 = (u64)(u32)((u8)t__2e335);
+	if ((u32)t__2e337) goto L_true_2e332; else goto L_false_2e333;
+	L_true_2e332:;
+	t__2e338 = ((u64)0UL);
+	return (u64)t__2e338;
+	L__2e339:;
+	L_false_2e333:;
+	L__2e334:;
+	t__2e345 = (u64)(*(u64 *)t_param_2e327);
+	t__2e344 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_rt_2esize__islarge)))((u64)t__2e345));
+	t__2e346 = (u64)(u32)((u8)t__2e344);
+	if ((u32)t__2e346) goto L_true_2e341; else goto L_false_2e342;
+	L_true_2e341:;
+	t__2e350 = (u64)(*(u64 *)t_param_2e327);
+	t__2e349 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2erealsz)))((u64)t__2e350));
+	*(u64 *)t_param_2e327 = (u64)t__2e349;
+	t__2e356 = (u64)(*(u64 *)t_param_2e327);
+	t__2e355 = (u64)((u64)t__2e356 + (u64)((u64)16UL));
+	t__2e354 = (u64)((u64)t__2e355 + (u64)((u64)8UL));
+	t__2e353 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esegmalloc)))((u64)t__2e354));
+	t__2e357 = (u64)(u32)(((u64)t__2e353 == (u64)((u64)0UL)));
+	if ((u32)t__2e357) goto L_matches_2e358; else goto L_next_2e359;
+	L_matches_2e358:;
+	t__2e361 = ((u64)0UL);
+	return (u64)t__2e361;
+	L__2e362:;
+	L__2e360:;
+	L_next_2e359:;
+	t__2e363 = (u64)(u32)(((u64)t__2e353 != (u64)((u64)0UL)));
+	if ((u32)t__2e363) goto L_matches_2e364; else goto L_next_2e365;
+	L_matches_2e364:;
+	*(u64 *)t_binding_2e366 = (u64)t__2e353;
+	t__2e370 = (u64)(*(u64 *)t_binding_2e366);
+	t__2e371 = t__2e370;
+	t__2e372 = ((u64)16UL);
+	t__2e369 = (u64)((u64)t__2e371 + (u64)t__2e372);
+	t__2e373 = ((u64)8UL);
+	t__2e368 = (u64)((u64)t__2e369 - (u64)t__2e373);
+	t__2e374 = t__2e368;
+	*(u64 *)t_binding_2e351 = (u64)t__2e374;
+	goto L__2e367;
+	L__2e375:;
+	L__2e367:;
+	goto L__2e352;
+	L_next_2e365:;
+	L__2e376:;
+	t_abortsite_2e378 = ((u64)0UL);
+	goto L_abort_2e379;
+	L__2e352:;
+	t__2e385 = (u64)(*(u64 *)t_binding_2e351);
+	t_field_2e386 = (u64)((u64)t__2e385 + (u64)((u64)0UL));
+	t__2e387 = (u64)(*(u64 *)t_param_2e327);
+	*(u64 *)t_field_2e386 = (u64)t__2e387;
+	t__2e388 = (u64)(*(u64 *)t_binding_2e351);
+	t_field_2e389 = (u64)((u64)t__2e388 + (u64)((u64)8UL));
+	t__2e392 = (u64)(*(u64 *)t_param_2e327);
+	t__2e390 = (u64)((u64)t__2e392 * (u64)((u64)1UL));
+	t__2e390 = (u64)((u64)t_field_2e389 + (u64)t__2e390);
+	t__2e393 = (u64)(*(u64 *)t_param_2e327);
+	*(u64 *)t__2e390 = (u64)t__2e393;
+	t__2e394 = (u64)(*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)));
+	t__2e394 = (u64)((u64)t__2e394 + (u64)((u64)1UL));
+	*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)) = (u64)t__2e394;
+	t__2e395 = (u64)(*(u64 *)t_binding_2e351);
+	t_field_2e396 = (u64)((u64)t__2e395 + (u64)((u64)8UL));
+	return (u64)t_field_2e396;
+	L__2e397:;
+	L__2e347:;
+	L__2e398:;
+	L_false_2e342:;
+	L__2e343:;
+	t__2e401 = (u64)(*(u64 *)t_param_2e327);
+	t__2e400 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esize__getbin)))((u64)t__2e401));
+	*(u64 *)t_binding_2e399 = (u64)t__2e400;
+	t__2e404 = (u64)(*(u64 *)t_binding_2e399);
+	t__2e403 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2ebin__getsize)))((u64)t__2e404));
+	*(u64 *)t_binding_2e402 = (u64)t__2e403;
+	t__2e408 = (u64)(*(u64 *)t_binding_2e399);
+	t__2e407 = (u64)((u64)t__2e408 * (u64)((u64)8UL));
+	t__2e407 = (u64)((u64)((u64)((char *)&D_rt_2ebins)) + (u64)t__2e407);
+	t__2e409 = (u64)(u32)(((u64)t__2e408 < (u64)((u64)9UL)));
+	if ((u32)t__2e409) goto L__2e411; else goto L__2e410;
+	L__2e410:;
+	t_abortsite_2e378 = ((u64)1UL);
+	goto L_abort_2e412;
+	L__2e411:;
+	t__2e418 = (u64)(*(u64 *)t__2e407);
+	t__2e419 = (u64)(u32)(((u64)t__2e418 == (u64)((u64)0UL)));
+	if ((u32)t__2e419) goto L_matches_2e420; else goto L_next_2e421;
+	L_matches_2e420:;
+	t_value_2e432 = (u64)((u64)((u64)((char *)&D_rt_2ecur__chunk)) + (u64)((u64)8UL));
+	t__2e433 = (u64)(*(u64 *)t_value_2e432);
+	t__2e430 = (u64)((u64)t__2e433 + (u64)((u64)8UL));
+	t__2e434 = (u64)(*(u64 *)t_binding_2e402);
+	t__2e429 = (u64)((u64)t__2e430 + (u64)t__2e434);
+	t__2e428 = (u64)((u64)t__2e429 + (u64)((u64)8UL));
+	t__2e427 = (u64)(u32)(((u64)t__2e428 > (u64)((u64)2097152UL)));
+	t__2e435 = (u64)(u32)((u8)t__2e427);
+	if ((u32)t__2e435) goto L_true_2e424; else goto L_false_2e425;
+	L_true_2e424:;
+	t__2e440 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esegmalloc)))((u64)((u64)2097152UL)));
+	t__2e441 = (u64)(u32)(((u64)t__2e440 == (u64)((u64)0UL)));
+	if ((u32)t__2e441) goto L_matches_2e442; else goto L_next_2e443;
+	L_matches_2e442:;
+	t__2e446 = ((u64)0UL);
+	return (u64)t__2e446;
+	L__2e447:;
+	L__2e444:;
+	L__2e448:;
+	L_next_2e443:;
+	t__2e449 = (u64)(u32)(((u64)t__2e440 != (u64)((u64)0UL)));
+	if ((u32)t__2e449) goto L_matches_2e450; else goto L_next_2e451;
+	L_matches_2e450:;
+	*(u64 *)t_binding_2e452 = (u64)t__2e440;
+	t_value_2e456 = (u64)((u64)t_object_2e455 + (u64)((u64)0UL));
+	t__2e457 = (u64)(*(u64 *)t_binding_2e452);
+	*(u64 *)t_value_2e456 = (u64)t__2e457;
+	t_value_2e456 = (u64)((u64)t_object_2e455 + (u64)((u64)8UL));
+	*(u64 *)t_value_2e456 = (u64)((u64)8UL);
+	BLIT(((u64)((char *)&D_rt_2ecur__chunk)), t_object_2e455, ((u64)16UL));
+	goto L__2e453;
+	L__2e458:;
+	L__2e453:;
+	goto L__2e439;
+	L_next_2e451:;
+	L__2e459:;
+	t_abortsite_2e378 = ((u64)2UL);
+	goto L_abort_2e379;
+	L__2e439:;
+	goto L__2e436;
+	L__2e460:;
+	L__2e436:;
+	goto L__2e426;
+	L_false_2e425:;
+	L__2e426:;
+	t_value_2e462 = (u64)((u64)((u64)((char *)&D_rt_2ecur__chunk)) + (u64)((u64)0UL));
+	t__2e463 = (u64)(*(u64 *)t_value_2e462);
+	t_field_2e466 = (u64)((u64)t__2e463 + (u64)((u64)0UL));
+	t_value_2e469 = (u64)((u64)((u64)((char *)&D_rt_2ecur__chunk)) + (u64)((u64)8UL));
+	t__2e470 = (u64)(*(u64 *)t_value_2e469);
+	t__2e467 = (u64)((u64)t__2e470 * (u64)((u64)1UL));
+	t__2e467 = (u64)((u64)t_field_2e466 + (u64)t__2e467);
+	*(u64 *)t_binding_2e461 = (u64)t__2e467;
+	t_value_2e471 = (u64)((u64)((u64)((char *)&D_rt_2ecur__chunk)) + (u64)((u64)8UL));
+	t__2e472 = (u64)(*(u64 *)t_value_2e471);
+	t__2e474 = (u64)(*(u64 *)t_binding_2e402);
+	t__2e473 = (u64)((u64)((u64)8UL) + (u64)t__2e474);
+	t__2e472 = (u64)((u64)t__2e472 + (u64)t__2e473);
+	*(u64 *)t_value_2e471 = (u64)t__2e472;
+	t__2e475 = (u64)(*(u64 *)t_binding_2e461);
+	t_field_2e476 = (u64)((u64)t__2e475 + (u64)((u64)0UL));
+	t__2e477 = (u64)(*(u64 *)t_binding_2e402);
+	*(u64 *)t_field_2e476 = (u64)t__2e477;
+	t__2e478 = (u64)(*(u64 *)t_binding_2e461);
+	t_field_2e479 = (u64)((u64)t__2e478 + (u64)((u64)8UL));
+	t__2e482 = (u64)(*(u64 *)t_binding_2e402);
+	t__2e480 = (u64)((u64)t__2e482 * (u64)((u64)1UL));
+	t__2e480 = (u64)((u64)t_field_2e479 + (u64)t__2e480);
+	t__2e483 = (u64)(*(u64 *)t_binding_2e402);
+	*(u64 *)t__2e480 = (u64)t__2e483;
+	t__2e484 = (u64)(*(u64 *)t_binding_2e461);
+	*(u64 *)t_binding_2e405 = (u64)t__2e484;
+	goto L__2e422;
+	L__2e485:;
+	L__2e422:;
+	goto L__2e406;
+	L_next_2e421:;
+	t__2e486 = (u64)(u32)(((u64)t__2e418 != (u64)((u64)0UL)));
+	if ((u32)t__2e486) goto L_matches_2e487; else goto L_next_2e488;
+	L_matches_2e487:;
+	*(u64 *)t_binding_2e489 = (u64)t__2e418;
+	t__2e492 = (u64)(*(u64 *)t_binding_2e399);
+	t__2e491 = (u64)((u64)t__2e492 * (u64)((u64)8UL));
+	t__2e491 = (u64)((u64)((u64)((char *)&D_rt_2ebins)) + (u64)t__2e491);
+	t__2e493 = (u64)(u32)(((u64)t__2e492 < (u64)((u64)9UL)));
+	if ((u32)t__2e493) goto L__2e495; else goto L__2e494;
+	L__2e494:;
+	t_abortsite_2e378 = ((u64)3UL);
+	goto L_abort_2e412;
+	L__2e495:;
+	t__2e497 = (u64)(*(u64 *)t_binding_2e489);
+	t__2e496 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2emeta__next)))((u64)t__2e497));
+	*(u64 *)t__2e491 = (u64)t__2e496;
+	t__2e498 = (u64)(*(u64 *)t_binding_2e489);
+	t__2e499 = (u64)(*(u64 *)t_binding_2e402);
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2echeckpoison)))((u64)t__2e498, (u64)t__2e499);
+	t__2e500 = (u64)(*(u64 *)t_binding_2e489);
+	t_field_2e501 = (u64)((u64)t__2e500 + (u64)((u64)0UL));
+	t__2e502 = (u64)(*(u64 *)t_binding_2e402);
+	*(u64 *)t_field_2e501 = (u64)t__2e502;
+	t__2e503 = (u64)(*(u64 *)t_binding_2e489);
+	*(u64 *)t_binding_2e405 = (u64)t__2e503;
+	goto L__2e490;
+	L__2e504:;
+	L__2e490:;
+	goto L__2e406;
+	L_next_2e488:;
+	L__2e505:;
+	t_abortsite_2e378 = ((u64)4UL);
+	goto L_abort_2e379;
+	L__2e406:;
+	t__2e506 = (u64)(*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)));
+	t__2e506 = (u64)((u64)t__2e506 + (u64)((u64)1UL));
+	*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)) = (u64)t__2e506;
+	t__2e507 = (u64)(*(u64 *)t_binding_2e405);
+	t_field_2e508 = (u64)((u64)t__2e507 + (u64)((u64)8UL));
+	return (u64)t_field_2e508;
+	L__2e509:;
+	L__2e329:;
+	L__2e510:;
+	return 0;
+	L_abort_2e379:;
+	t__2e380 = (u64)((u64)t_abortsite_2e378 * (u64)((u64)16UL));
+	t__2e380 = (u64)((u64)((u64)((char *)&D_abortsites_2e377)) + (u64)t__2e380);
+	t__2e381 = (u64)(*(u64 *)t__2e380);
+	t__2e382 = (u64)((u64)t__2e380 + (u64)((u64)8UL));
+	t__2e383 = (u64)(*(u32 *)t__2e382);
+	t__2e382 = (u64)((u64)t__2e380 + (u64)((u64)12UL));
+	t__2e384 = (u64)(*(u32 *)t__2e382);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e381, (u64)t__2e383, (u64)t__2e384, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e412:;
+	t__2e413 = (u64)((u64)t_abortsite_2e378 * (u64)((u64)16UL));
+	t__2e413 = (u64)((u64)((u64)((char *)&D_abortsites_2e377)) + (u64)t__2e413);
+	t__2e414 = (u64)(*(u64 *)t__2e413);
+	t__2e415 = (u64)((u64)t__2e413 + (u64)((u64)8UL));
+	t__2e416 = (u64)(*(u32 *)t__2e415);
+	t__2e415 = (u64)((u64)t__2e413 + (u64)((u64)12UL));
+	t__2e417 = (u64)(*(u32 *)t__2e415);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e414, (u64)t__2e416, (u64)t__2e417, (u64)((u64)0UL));
+	__builtin_trap();
+}
+void F_rt_2estart__ha(u64 p_iv) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	u64 t__2e517;
+	u64 t__2e518;
+	u64 t__2e519;
+	u64 t__2e520;
+	u64 t__2e521;
+	u64 t__2e528;
+	u64 t__2e529;
+	u64 t__2e530;
+	u64 t__2e533;
+	u64 t__2e535;
+	u64 t__2e536;
+	u64 t__2e538;
+	u64 t__2e539;
+	u64 t__2e540;
+	u64 t__2e542;
+	u64 t__2e543;
+	u64 t__2e544;
+	u64 t__2e545;
+	u64 t__2e546;
+	u64 t__2e548;
+	u64 t__2e549;
+	u64 t__2e550;
+	u64 t__2e552;
+	u64 t__2e553;
+	u64 t__2e555;
+	u64 t__2e556;
+	u64 t__2e557;
+	u64 t__2e558;
+	u64 t__2e559;
+	u64 t__2e566;
+	u64 t__2e567;
+	u64 t__2e568;
+	u64 t__2e571;
+	u64 t__2e573;
+	u64 t__2e574;
+	u64 t__2e576;
+	u64 t__2e577;
+	u64 t_binding_2e516;
+	u64 t_binding_2e527;
+	u64 t_binding_2e554;
+	u64 t_binding_2e565;
+	u64 t_iv;
+	u64 t_param_2e512;
+	t_iv = (u64)p_iv;
+	L_start_2e511:;
+	t_param_2e512 = (u64)A0;
+	t_binding_2e516 = (u64)A1;
+	t_binding_2e527 = (u64)A2;
+	t_binding_2e554 = (u64)A3;
+	t_binding_2e565 = (u64)A4;
+	*(u64 *)t_param_2e512 = (u64)t_iv;
+	L_body_2e513:;
+	t__2e519 = ((u64)X_____init__array__end);
+	t__2e520 = ((u64)X_____init__array__start);
+	t__2e518 = (u64)((u64)t__2e519 - (u64)t__2e520);
+	t__2e521 = t__2e518;
+	t__2e517 = (u64)((u64)t__2e521 >> (((u64)3UL) & 63));
+	*(u64 *)t_binding_2e516 = (u64)t__2e517;
+	*(u64 *)t_binding_2e527 = (u64)((u64)0UL);
+	L_loop_2e522:;
+	t__2e529 = (u64)(*(u64 *)t_binding_2e527);
+	t__2e530 = (u64)(*(u64 *)t_binding_2e516);
+	t__2e528 = (u64)(u32)(((u64)t__2e529 < (u64)t__2e530));
+	if ((u32)t__2e528) goto L_body_2e523; else goto L__2e525;
+	L_body_2e523:;
+	t__2e535 = (u64)(*(u64 *)t_binding_2e527);
+	t__2e533 = (u64)((u64)t__2e535 * (u64)((u64)8UL));
+	t__2e533 = (u64)((u64)((u64)X_____init__array__start) + (u64)t__2e533);
+	t__2e536 = (u64)(*(u64 *)t__2e533);
+	((void (*)(void))t__2e536)();
+	goto L__2e531;
+	L__2e537:;
+	L__2e531:;
+	L_after_2e526:;
+	t__2e538 = (u64)(*(u64 *)t_binding_2e527);
+	t__2e538 = (u64)((u64)t__2e538 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e527 = (u64)t__2e538;
+	goto L_loop_2e522;
+	L__2e525:;
+	t__2e539 = (u64)(*(u64 *)t_param_2e512);
+	t__2e542 = (u64)((i64)(i32)((u64)0UL));
+	t__2e540 = (u64)((u64)t__2e542 * (u64)((u64)8UL));
+	t__2e540 = (u64)((u64)t__2e539 + (u64)t__2e540);
+	t__2e543 = (u64)(*(u64 *)t__2e540);
+	t__2e544 = t__2e543;
+	*(u64 *)((u64)((char *)&D_rt_2eargc)) = (u64)t__2e544;
+	t__2e545 = (u64)(*(u64 *)t_param_2e512);
+	t__2e548 = (u64)((i64)(i32)((u64)1UL));
+	t__2e546 = (u64)((u64)t__2e548 * (u64)((u64)8UL));
+	t__2e546 = (u64)((u64)t__2e545 + (u64)t__2e546);
+	*(u64 *)((u64)((char *)&D_rt_2eargv)) = (u64)t__2e546;
+	t__2e549 = (u64)(*(u64 *)((u64)((char *)&D_rt_2eargv)));
+	t__2e553 = (u64)(*(u64 *)((u64)((char *)&D_rt_2eargc)));
+	t__2e552 = (u64)((u64)t__2e553 + (u64)((u64)1UL));
+	t__2e550 = (u64)((u64)t__2e552 * (u64)((u64)8UL));
+	t__2e550 = (u64)((u64)t__2e549 + (u64)t__2e550);
+	*(u64 *)((u64)((char *)&D_rt_2eenvp)) = (u64)t__2e550;
+	((void (*)(void))((u64)X_main))();
+	t__2e557 = ((u64)X_____fini__array__end);
+	t__2e558 = ((u64)X_____fini__array__start);
+	t__2e556 = (u64)((u64)t__2e557 - (u64)t__2e558);
+	t__2e559 = t__2e556;
+	t__2e555 = (u64)((u64)t__2e559 >> (((u64)3UL) & 63));
+	*(u64 *)t_binding_2e554 = (u64)t__2e555;
+	*(u64 *)t_binding_2e565 = (u64)((u64)0UL);
+	L_loop_2e560:;
+	t__2e567 = (u64)(*(u64 *)t_binding_2e565);
+	t__2e568 = (u64)(*(u64 *)t_binding_2e554);
+	t__2e566 = (u64)(u32)(((u64)t__2e567 < (u64)t__2e568));
+	if ((u32)t__2e566) goto L_body_2e561; else goto L__2e563;
+	L_body_2e561:;
+	t__2e573 = (u64)(*(u64 *)t_binding_2e565);
+	t__2e571 = (u64)((u64)t__2e573 * (u64)((u64)8UL));
+	t__2e571 = (u64)((u64)((u64)X_____fini__array__start) + (u64)t__2e571);
+	t__2e574 = (u64)(*(u64 *)t__2e571);
+	((void (*)(void))t__2e574)();
+	goto L__2e569;
+	L__2e575:;
+	L__2e569:;
+	L_after_2e564:;
+	t__2e576 = (u64)(*(u64 *)t_binding_2e565);
+	t__2e576 = (u64)((u64)t__2e576 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e565 = (u64)t__2e576;
+	goto L_loop_2e560;
+	L__2e563:;
+	t__2e577 = (u64)(u32)(*(i32 *)((u64)((char *)&D_rt_2eexit__status)));
+	((void (*)(u32))((u64)((char *)&F_rt_2eexit)))((u32)t__2e577);
+	__builtin_trap();
+	L__2e578:;
+	L__2e514:;
+	L__2e579:;
+	__builtin_trap();
+}
+u32 F_rt_2emprotect(u64 p_addr, u64 p_length, u32 p_prot) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	u64 t__2e585;
+	u64 t__2e586;
+	u64 t__2e587;
+	u64 t__2e588;
+	u64 t__2e589;
+	u64 t__2e590;
+	u64 t__2e591;
+	u64 t__2e592;
+	u64 t__2e593;
+	u64 t_addr;
+	u64 t_length;
+	u64 t_param_2e581;
+	u64 t_param_2e582;
+	u64 t_param_2e583;
+	u64 t_prot;
+	t_addr = (u64)p_addr;
+	t_length = (u64)p_length;
+	t_prot = (u64)p_prot;
+	L_start_2e580:;
+	t_param_2e581 = (u64)A0;
+	t_param_2e582 = (u64)A1;
+	t_param_2e583 = (u64)A2;
+	*(u64 *)t_param_2e581 = (u64)t_addr;
+	*(u64 *)t_param_2e582 = (u64)t_length;
+	*(u32 *)t_param_2e583 = (u32)t_prot;
+	L_body_2e584:;
+	t__2e586 = (u64)(*(u64 *)t_param_2e581);
+	t__2e587 = t__2e586;
+	t__2e588 = t__2e587;
+	t__2e589 = (u64)(*(u64 *)t_param_2e582);
+	t__2e590 = t__2e589;
+	t__2e591 = (u64)(u32)(*(u32 *)t_param_2e583);
+	t__2e592 = (u64)((u32)t__2e591);
+	t__2e585 = (u64)(((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2esyscall3))((u64)((u64)10UL), (u64)t__2e588, (u64)t__2e590, (u64)t__2e592));
+	t__2e593 = (u64)(u32)t__2e585;
+	return (u32)t__2e593;
+}
+u32 F_rt_2emunmap(u64 p_addr, u64 p_length) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e598;
+	u64 t__2e599;
+	u64 t__2e600;
+	u64 t__2e601;
+	u64 t__2e602;
+	u64 t__2e603;
+	u64 t__2e604;
+	u64 t_addr;
+	u64 t_length;
+	u64 t_param_2e595;
+	u64 t_param_2e596;
+	t_addr = (u64)p_addr;
+	t_length = (u64)p_length;
+	L_start_2e594:;
+	t_param_2e595 = (u64)A0;
+	t_param_2e596 = (u64)A1;
+	*(u64 *)t_param_2e595 = (u64)t_addr;
+	*(u64 *)t_param_2e596 = (u64)t_length;
+	L_body_2e597:;
+	t__2e599 = (u64)(*(u64 *)t_param_2e595);
+	t__2e600 = t__2e599;
+	t__2e601 = t__2e600;
+	t__2e602 = (u64)(*(u64 *)t_param_2e596);
+	t__2e603 = t__2e602;
+	t__2e598 = (u64)(((u64 (*)(u64, u64, u64))((u64)X_rt_2esyscall2))((u64)((u64)11UL), (u64)t__2e601, (u64)t__2e603));
+	t__2e604 = (u64)(u32)t__2e598;
+	return (u32)t__2e604;
+}
+u64 F_rt_2emmap(u64 p_addr, u64 p_length, u32 p_prot, u32 p_flags, u32 p_fd, u64 p_offs) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[4] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	u64 t__2e616;
+	u64 t__2e617;
+	u64 t__2e618;
+	u64 t__2e619;
+	u64 t__2e620;
+	u64 t__2e621;
+	u64 t__2e622;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e627;
+	u64 t__2e628;
+	u64 t__2e629;
+	u64 t__2e630;
+	u64 t__2e634;
+	u64 t__2e637;
+	u64 t__2e640;
+	u64 t__2e643;
+	u64 t__2e644;
+	u64 t__2e645;
+	u64 t__2e646;
+	u64 t__2e647;
+	u64 t__2e648;
+	u64 t__2e649;
+	u64 t__2e650;
+	u64 t__2e651;
+	u64 t__2e652;
+	u64 t__2e653;
+	u64 t__2e654;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t__2e658;
+	u64 t__2e659;
+	u64 t__2e660;
+	u64 t__2e661;
+	u64 t__2e663;
+	u64 t__2e664;
+	u64 t__2e665;
+	u64 t_addr;
+	u64 t_binding_2e615;
+	u64 t_fd;
+	u64 t_flags;
+	u64 t_length;
+	u64 t_offs;
+	u64 t_param_2e606;
+	u64 t_param_2e607;
+	u64 t_param_2e608;
+	u64 t_param_2e609;
+	u64 t_param_2e610;
+	u64 t_param_2e611;
+	u64 t_prot;
+	t_addr = (u64)p_addr;
+	t_length = (u64)p_length;
+	t_prot = (u64)p_prot;
+	t_flags = (u64)p_flags;
+	t_fd = (u64)p_fd;
+	t_offs = (u64)p_offs;
+	L_start_2e605:;
+	t_param_2e606 = (u64)A0;
+	t_param_2e607 = (u64)A1;
+	t_param_2e608 = (u64)A2;
+	t_param_2e609 = (u64)A3;
+	t_param_2e610 = (u64)A4;
+	t_param_2e611 = (u64)A5;
+	t_binding_2e615 = (u64)A6;
+	*(u64 *)t_param_2e606 = (u64)t_addr;
+	*(u64 *)t_param_2e607 = (u64)t_length;
+	*(u32 *)t_param_2e608 = (u32)t_prot;
+	*(u32 *)t_param_2e609 = (u32)t_flags;
+	*(u32 *)t_param_2e610 = (u32)t_fd;
+	*(u64 *)t_param_2e611 = (u64)t_offs;
+	L_body_2e612:;
+	t__2e617 = (u64)(*(u64 *)t_param_2e606);
+	t__2e618 = t__2e617;
+	t__2e619 = t__2e618;
+	t__2e620 = (u64)(*(u64 *)t_param_2e607);
+	t__2e621 = t__2e620;
+	t__2e622 = (u64)(u32)(*(u32 *)t_param_2e608);
+	t__2e623 = (u64)((u32)t__2e622);
+	t__2e624 = (u64)(u32)(*(u32 *)t_param_2e609);
+	t__2e625 = (u64)((u32)t__2e624);
+	t__2e626 = (u64)(u32)(*(i32 *)t_param_2e610);
+	t__2e627 = (u64)((i64)(i32)t__2e626);
+	t__2e628 = (u64)(*(u64 *)t_param_2e611);
+	t__2e629 = t__2e628;
+	t__2e616 = (u64)(((u64 (*)(u64, u64, u64, u64, u64, u64, u64))((u64)X_rt_2esyscall6))((u64)((u64)9UL), (u64)t__2e619, (u64)t__2e621, (u64)t__2e623, (u64)t__2e625, (u64)t__2e627, (u64)t__2e629));
+	*(u64 *)t_binding_2e615 = (u64)t__2e616;
+	t__2e644 = (u64)(*(u64 *)t_binding_2e615);
+	t__2e645 = (u64)(u32)t__2e644;
+	t__2e646 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e643 = (u64)(u32)(((u32)t__2e645 == (u32)t__2e646));
+	t__2e640 = (u64)(u32)t__2e643;
+	if ((u32)t__2e640) goto L__2e641; else goto L__2e642;
+	L__2e641:;
+	t__2e648 = (u64)(*(u64 *)t_param_2e606);
+	t__2e649 = ((u64)0UL);
+	t__2e647 = (u64)(u32)(((u64)t__2e648 == (u64)t__2e649));
+	t__2e640 = (u64)(u32)t__2e647;
+	goto L__2e642;
+	L__2e642:;
+	t__2e637 = (u64)(u32)t__2e640;
+	if ((u32)t__2e637) goto L__2e638; else goto L__2e639;
+	L__2e638:;
+	t__2e652 = (u64)(u32)(*(u32 *)t_param_2e609);
+	t__2e651 = (u64)(u32)((u32)t__2e652 & (u32)((u64)32UL));
+	t__2e650 = (u64)(u32)(((u32)t__2e651 > (u32)((u64)0UL)));
+	t__2e637 = (u64)(u32)t__2e650;
+	goto L__2e639;
+	L__2e639:;
+	t__2e634 = (u64)(u32)t__2e637;
+	if ((u32)t__2e634) goto L__2e635; else goto L__2e636;
+	L__2e635:;
+	t__2e655 = (u64)(u32)(*(u32 *)t_param_2e609);
+	t__2e654 = (u64)(u32)((u32)t__2e655 & (u32)((u64)16UL));
+	t__2e653 = (u64)(u32)(((u32)t__2e654 == (u32)((u64)0UL)));
+	t__2e634 = (u64)(u32)t__2e653;
+	goto L__2e636;
+	L__2e636:;
+	t__2e656 = (u64)(u32)((u8)t__2e634);
+	if ((u32)t__2e656) goto L_true_2e631; else goto L_false_2e632;
+	L_true_2e631:;
+	t__2e659 = (u64)(u32)(-(u32)((u64)12UL));
+	t__2e660 = (u64)((i64)(i32)t__2e659);
+	t__2e661 = t__2e660;
+	t__2e658 = t__2e661;
+	goto L__2e657;
+	L__2e662:;
+	L__2e657:;
+	t__2e630 = t__2e658;
+	goto L__2e633;
+	L_false_2e632:;
+	t__2e663 = (u64)(*(u64 *)t_binding_2e615);
+	t__2e664 = t__2e663;
+	t__2e665 = t__2e664;
+	t__2e630 = t__2e665;
+	L__2e633:;
+	return (u64)t__2e630;
+	L__2e666:;
+	L__2e613:;
+	L__2e667:;
+	return 0;
+}
+u32 F_rt_2epipe2(u64 p_pipefd, u32 p_flags) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e672;
+	u64 t__2e673;
+	u64 t__2e674;
+	u64 t__2e675;
+	u64 t__2e676;
+	u64 t__2e677;
+	u64 t__2e678;
+	u64 t_flags;
+	u64 t_param_2e669;
+	u64 t_param_2e670;
+	u64 t_pipefd;
+	t_pipefd = (u64)p_pipefd;
+	t_flags = (u64)p_flags;
+	L_start_2e668:;
+	t_param_2e669 = (u64)A0;
+	t_param_2e670 = (u64)A1;
+	*(u64 *)t_param_2e669 = (u64)t_pipefd;
+	*(u32 *)t_param_2e670 = (u32)t_flags;
+	L_body_2e671:;
+	t__2e673 = (u64)(*(u64 *)t_param_2e669);
+	t__2e674 = t__2e673;
+	t__2e675 = t__2e674;
+	t__2e676 = (u64)(u32)(*(i32 *)t_param_2e670);
+	t__2e677 = (u64)((i64)(i32)t__2e676);
+	t__2e672 = (u64)(((u64 (*)(u64, u64, u64))((u64)X_rt_2esyscall2))((u64)((u64)293UL), (u64)t__2e675, (u64)t__2e677));
+	t__2e678 = (u64)(u32)t__2e672;
+	return (u32)t__2e678;
+}
+u32 F_rt_2ekill(u32 p_pid, u32 p_signal) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e683;
+	u64 t__2e684;
+	u64 t__2e685;
+	u64 t__2e686;
+	u64 t__2e687;
+	u64 t__2e688;
+	u64 t_param_2e680;
+	u64 t_param_2e681;
+	u64 t_pid;
+	u64 t_signal;
+	t_pid = (u64)p_pid;
+	t_signal = (u64)p_signal;
+	L_start_2e679:;
+	t_param_2e680 = (u64)A0;
+	t_param_2e681 = (u64)A1;
+	*(u32 *)t_param_2e680 = (u32)t_pid;
+	*(u32 *)t_param_2e681 = (u32)t_signal;
+	L_body_2e682:;
+	t__2e684 = (u64)(u32)(*(i32 *)t_param_2e680);
+	t__2e685 = (u64)((i64)(i32)t__2e684);
+	t__2e686 = (u64)(u32)(*(i32 *)t_param_2e681);
+	t__2e687 = (u64)((i64)(i32)t__2e686);
+	t__2e683 = (u64)(((u64 (*)(u64, u64, u64))((u64)X_rt_2esyscall2))((u64)((u64)62UL), (u64)t__2e685, (u64)t__2e687));
+	t__2e688 = (u64)(u32)t__2e683;
+	return (u32)t__2e688;
+}
+u32 F_rt_2ewifsignaled(u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e692;
+	u64 t__2e693;
+	u64 t__2e694;
+	u64 t__2e695;
+	u64 t_param_2e690;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e689:;
+	t_param_2e690 = (u64)A0;
+	*(u32 *)t_param_2e690 = (u32)t_status;
+	L_body_2e691:;
+	t__2e695 = (u64)(u32)(*(i32 *)t_param_2e690);
+	t__2e694 = (u64)(u32)((u32)t__2e695 & (u32)((u64)65535UL));
+	t__2e693 = (u64)(u32)((u32)t__2e694 - (u32)((u64)1UL));
+	t__2e692 = (u64)(u32)(((i32)t__2e693 < (i32)((u64)255UL)));
+	return (u32)t__2e692;
+}
+u32 F_rt_2ewtermsig(u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e699;
+	u64 t__2e700;
+	u64 t_param_2e697;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e696:;
+	t_param_2e697 = (u64)A0;
+	*(u32 *)t_param_2e697 = (u32)t_status;
+	L_body_2e698:;
+	t__2e700 = (u64)(u32)(*(i32 *)t_param_2e697);
+	t__2e699 = (u64)(u32)((u32)t__2e700 & (u32)((u64)127UL));
+	return (u32)t__2e699;
+}
+u32 F_rt_2ewexitstatus(u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e704;
+	u64 t__2e705;
+	u64 t__2e706;
+	u64 t_param_2e702;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e701:;
+	t_param_2e702 = (u64)A0;
+	*(u32 *)t_param_2e702 = (u32)t_status;
+	L_body_2e703:;
+	t__2e706 = (u64)(u32)(*(i32 *)t_param_2e702);
+	t__2e705 = (u64)(u32)((u32)t__2e706 & (u32)((u64)65280UL));
+	t__2e704 = (u64)(u32)((i32)t__2e705 >> (((u64)8UL) & 31));
+	return (u32)t__2e704;
+}
+u32 F_rt_2ewifexited(u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e710;
+	u64 t__2e711;
+	u64 t__2e712;
+	u64 t_param_2e708;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e707:;
+	t_param_2e708 = (u64)A0;
+	*(u32 *)t_param_2e708 = (u32)t_status;
+	L_body_2e709:;
+	t__2e712 = (u64)(u32)(*(i32 *)t_param_2e708);
+	t__2e711 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_rt_2ewtermsig)))((u32)t__2e712));
+	t__2e710 = (u64)(u32)(((u32)t__2e711 == (u32)((u64)0UL)));
+	return (u32)t__2e710;
+}
+void F_rt_2ewait4(u32 p_pid, u64 p_status, u32 p_options, u64 p_rusage) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e721;
+	u64 t__2e722;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e725;
+	u64 t__2e726;
+	u64 t__2e727;
+	u64 t__2e728;
+	u64 t__2e729;
+	u64 t__2e730;
+	u64 t__2e731;
+	u64 t_options;
+	u64 t_param_2e714;
+	u64 t_param_2e715;
+	u64 t_param_2e716;
+	u64 t_param_2e717;
+	u64 t_pid;
+	u64 t_rusage;
+	u64 t_status;
+	t_pid = (u64)p_pid;
+	t_status = (u64)p_status;
+	t_options = (u64)p_options;
+	t_rusage = (u64)p_rusage;
+	L_start_2e713:;
+	t_param_2e714 = (u64)A0;
+	t_param_2e715 = (u64)A1;
+	t_param_2e716 = (u64)A2;
+	t_param_2e717 = (u64)A3;
+	*(u32 *)t_param_2e714 = (u32)t_pid;
+	*(u64 *)t_param_2e715 = (u64)t_status;
+	*(u32 *)t_param_2e716 = (u32)t_options;
+	*(u64 *)t_param_2e717 = (u64)t_rusage;
+	L_body_2e718:;
+	t__2e722 = (u64)(u32)(*(i32 *)t_param_2e714);
+	t__2e723 = (u64)((i64)(i32)t__2e722);
+	t__2e724 = (u64)(*(u64 *)t_param_2e715);
+	t__2e725 = t__2e724;
+	t__2e726 = t__2e725;
+	t__2e727 = (u64)(u32)(*(i32 *)t_param_2e716);
+	t__2e728 = (u64)((i64)(i32)t__2e727);
+	t__2e729 = (u64)(*(u64 *)t_param_2e717);
+	t__2e730 = t__2e729;
+	t__2e731 = t__2e730;
+	t__2e721 = (u64)(((u64 (*)(u64, u64, u64, u64, u64))((u64)X_rt_2esyscall4))((u64)((u64)61UL), (u64)t__2e723, (u64)t__2e726, (u64)t__2e728, (u64)t__2e731));
+	goto L__2e719;
+	L__2e732:;
+	L__2e719:;
+	return;
+}
+u32 F_rt_2eexecve(u64 p_path, u64 p_argv, u64 p_envp) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e738;
+	u64 t__2e739;
+	u64 t__2e740;
+	u64 t__2e741;
+	u64 t__2e742;
+	u64 t__2e743;
+	u64 t__2e744;
+	u64 t__2e745;
+	u64 t__2e746;
+	u64 t__2e747;
+	u64 t__2e748;
+	u64 t_argv;
+	u64 t_envp;
+	u64 t_param_2e734;
+	u64 t_param_2e735;
+	u64 t_param_2e736;
+	u64 t_path;
+	t_path = (u64)p_path;
+	t_argv = (u64)p_argv;
+	t_envp = (u64)p_envp;
+	L_start_2e733:;
+	t_param_2e734 = (u64)A0;
+	t_param_2e735 = (u64)A1;
+	t_param_2e736 = (u64)A2;
+	*(u64 *)t_param_2e734 = (u64)t_path;
+	*(u64 *)t_param_2e735 = (u64)t_argv;
+	*(u64 *)t_param_2e736 = (u64)t_envp;
+	L_body_2e737:;
+	t__2e739 = (u64)(*(u64 *)t_param_2e734);
+	t__2e740 = t__2e739;
+	t__2e741 = t__2e740;
+	t__2e742 = (u64)(*(u64 *)t_param_2e735);
+	t__2e743 = t__2e742;
+	t__2e744 = t__2e743;
+	t__2e745 = (u64)(*(u64 *)t_param_2e736);
+	t__2e746 = t__2e745;
+	t__2e747 = t__2e746;
+	t__2e738 = (u64)(((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2esyscall3))((u64)((u64)59UL), (u64)t__2e741, (u64)t__2e744, (u64)t__2e747));
+	t__2e748 = (u64)(u32)t__2e738;
+	return (u32)t__2e748;
+}
+u32 F_rt_2efork(void) {
+	u64 t__2e751;
+	u64 t__2e752;
+	u64 t__2e753;
+	L_start_2e749:;
+	L_body_2e750:;
+	t__2e752 = (u64)((i64)(i32)((u64)17UL));
+	t__2e751 = (u64)(((u64 (*)(u64, u64, u64))((u64)X_rt_2esyscall2))((u64)((u64)56UL), (u64)t__2e752, (u64)((u64)0UL)));
+	t__2e753 = (u64)(u32)t__2e751;
+	return (u32)t__2e753;
+}
+void F_rt_2eexit(u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e759;
+	u64 t__2e760;
+	u64 t__2e761;
+	u64 t__2e765;
+	u64 t__2e766;
+	u64 t__2e767;
+	u64 t__2e768;
+	u64 t__2e769;
+	u64 t_abortsite_2e763;
+	u64 t_param_2e755;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e754:;
+	t_param_2e755 = (u64)A0;
+	*(u32 *)t_param_2e755 = (u32)t_status;
+	L_body_2e756:;
+	t__2e760 = (u64)(u32)(*(i32 *)t_param_2e755);
+	t__2e761 = (u64)((i64)(i32)t__2e760);
+	t__2e759 = (u64)(((u64 (*)(u64, u64))((u64)X_rt_2esyscall1))((u64)((u64)60UL), (u64)t__2e761));
+	t_abortsite_2e763 = ((u64)0UL);
+	goto L_abort_2e764;
+	L__2e770:;
+	L__2e757:;
+	L__2e771:;
+	__builtin_trap();
+	L_abort_2e764:;
+	t__2e765 = (u64)((u64)t_abortsite_2e763 * (u64)((u64)16UL));
+	t__2e765 = (u64)((u64)((u64)((char *)&D_abortsites_2e762)) + (u64)t__2e765);
+	t__2e766 = (u64)(*(u64 *)t__2e765);
+	t__2e767 = (u64)((u64)t__2e765 + (u64)((u64)8UL));
+	t__2e768 = (u64)(*(u32 *)t__2e767);
+	t__2e767 = (u64)((u64)t__2e765 + (u64)((u64)12UL));
+	t__2e769 = (u64)(*(u32 *)t__2e767);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e766, (u64)t__2e768, (u64)t__2e769, (u64)((u64)6UL));
+	__builtin_trap();
+}
+u32 F_rt_2egetpid(void) {
+	u64 t__2e774;
+	u64 t__2e775;
+	L_start_2e772:;
+	L_body_2e773:;
+	t__2e774 = (u64)(((u64 (*)(u64))((u64)X_rt_2esyscall0))((u64)((u64)39UL)));
+	t__2e775 = (u64)(u32)t__2e774;
+	return (u32)t__2e775;
+}
+u32 F_rt_2edup2(u32 p_old, u32 p_new) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e780;
+	u64 t__2e781;
+	u64 t__2e782;
+	u64 t__2e783;
+	u64 t__2e784;
+	u64 t__2e785;
+	u64 t_new;
+	u64 t_old;
+	u64 t_param_2e777;
+	u64 t_param_2e778;
+	t_old = (u64)p_old;
+	t_new = (u64)p_new;
+	L_start_2e776:;
+	t_param_2e777 = (u64)A0;
+	t_param_2e778 = (u64)A1;
+	*(u32 *)t_param_2e777 = (u32)t_old;
+	*(u32 *)t_param_2e778 = (u32)t_new;
+	L_body_2e779:;
+	t__2e781 = (u64)(u32)(*(i32 *)t_param_2e777);
+	t__2e782 = (u64)((i64)(i32)t__2e781);
+	t__2e783 = (u64)(u32)(*(i32 *)t_param_2e778);
+	t__2e784 = (u64)((i64)(i32)t__2e783);
+	t__2e780 = (u64)(((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2esyscall3))((u64)((u64)292UL), (u64)t__2e782, (u64)t__2e784, (u64)((u64)0UL)));
+	t__2e785 = (u64)(u32)t__2e780;
+	return (u32)t__2e785;
+}
+u32 F_rt_2edup3(u32 p_old, u32 p_new, u32 p_flags) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	u64 t__2e791;
+	u64 t__2e792;
+	u64 t__2e793;
+	u64 t__2e794;
+	u64 t__2e795;
+	u64 t__2e796;
+	u64 t__2e797;
+	u64 t__2e798;
+	u64 t_flags;
+	u64 t_new;
+	u64 t_old;
+	u64 t_param_2e787;
+	u64 t_param_2e788;
+	u64 t_param_2e789;
+	t_old = (u64)p_old;
+	t_new = (u64)p_new;
+	t_flags = (u64)p_flags;
+	L_start_2e786:;
+	t_param_2e787 = (u64)A0;
+	t_param_2e788 = (u64)A1;
+	t_param_2e789 = (u64)A2;
+	*(u32 *)t_param_2e787 = (u32)t_old;
+	*(u32 *)t_param_2e788 = (u32)t_new;
+	*(u32 *)t_param_2e789 = (u32)t_flags;
+	L_body_2e790:;
+	t__2e792 = (u64)(u32)(*(i32 *)t_param_2e787);
+	t__2e793 = (u64)((i64)(i32)t__2e792);
+	t__2e794 = (u64)(u32)(*(i32 *)t_param_2e788);
+	t__2e795 = (u64)((i64)(i32)t__2e794);
+	t__2e796 = (u64)(u32)(*(i32 *)t_param_2e789);
+	t__2e797 = (u64)((i64)(i32)t__2e796);
+	t__2e791 = (u64)(((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2esyscall3))((u64)((u64)292UL), (u64)t__2e793, (u64)t__2e795, (u64)t__2e797));
+	t__2e798 = (u64)(u32)t__2e791;
+	return (u32)t__2e798;
+}
+u32 F_rt_2eclose(u32 p_fd) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e802;
+	u64 t__2e803;
+	u64 t__2e804;
+	u64 t__2e805;
+	u64 t_fd;
+	u64 t_param_2e800;
+	t_fd = (u64)p_fd;
+	L_start_2e799:;
+	t_param_2e800 = (u64)A0;
+	*(u32 *)t_param_2e800 = (u32)t_fd;
+	L_body_2e801:;
+	t__2e803 = (u64)(u32)(*(i32 *)t_param_2e800);
+	t__2e804 = (u64)((i64)(i32)t__2e803);
+	t__2e802 = (u64)(((u64 (*)(u64, u64))((u64)X_rt_2esyscall1))((u64)((u64)3UL), (u64)t__2e804));
+	t__2e805 = (u64)(u32)t__2e802;
+	return (u32)t__2e805;
+}
+u64 F_rt_2ewrite(u32 p_fd, u64 p_buf, u64 p_count) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e811;
+	u64 t__2e812;
+	u64 t__2e813;
+	u64 t__2e814;
+	u64 t__2e815;
+	u64 t__2e816;
+	u64 t__2e817;
+	u64 t__2e818;
+	u64 t__2e819;
+	u64 t_buf;
+	u64 t_count;
+	u64 t_fd;
+	u64 t_param_2e807;
+	u64 t_param_2e808;
+	u64 t_param_2e809;
+	t_fd = (u64)p_fd;
+	t_buf = (u64)p_buf;
+	t_count = (u64)p_count;
+	L_start_2e806:;
+	t_param_2e807 = (u64)A0;
+	t_param_2e808 = (u64)A1;
+	t_param_2e809 = (u64)A2;
+	*(u32 *)t_param_2e807 = (u32)t_fd;
+	*(u64 *)t_param_2e808 = (u64)t_buf;
+	*(u64 *)t_param_2e809 = (u64)t_count;
+	L_body_2e810:;
+	t__2e812 = (u64)(u32)(*(i32 *)t_param_2e807);
+	t__2e813 = (u64)((i64)(i32)t__2e812);
+	t__2e814 = (u64)(*(u64 *)t_param_2e808);
+	t__2e815 = t__2e814;
+	t__2e816 = t__2e815;
+	t__2e817 = (u64)(*(u64 *)t_param_2e809);
+	t__2e818 = t__2e817;
+	t__2e811 = (u64)(((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2esyscall3))((u64)((u64)1UL), (u64)t__2e813, (u64)t__2e816, (u64)t__2e818));
+	t__2e819 = t__2e811;
+	return (u64)t__2e819;
+}
+u32 F_rt_2estrcmp(u64 p___a, u64 p___b) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	u64 t__2e828;
+	u64 t__2e829;
+	u64 t__2e830;
+	u64 t__2e831;
+	u64 t__2e832;
+	u64 t__2e833;
+	u64 t__2e834;
+	u64 t__2e835;
+	u64 t__2e843;
+	u64 t__2e846;
+	u64 t__2e848;
+	u64 t__2e850;
+	u64 t__2e857;
+	u64 t__2e858;
+	u64 t__2e859;
+	u64 t__2e860;
+	u64 t__2e861;
+	u64 t__2e868;
+	u64 t__2e869;
+	u64 t__2e870;
+	u64 t__2e872;
+	u64 t__2e873;
+	u64 t__2e874;
+	u64 t__2e875;
+	u64 t__2e877;
+	u64 t__2e878;
+	u64 t__2e879;
+	u64 t__2e880;
+	u64 t__2e881;
+	u64 t__2e887;
+	u64 t___a;
+	u64 t___b;
+	u64 t_binding_2e840;
+	u64 t_binding_2e844;
+	u64 t_binding_2e847;
+	u64 t_binding_2e849;
+	u64 t_binding_2e856;
+	u64 t_field_2e842;
+	u64 t_field_2e845;
+	t___a = p___a;
+	t___b = p___b;
+	L_start_2e820:;
+	t_binding_2e840 = (u64)A0;
+	t_binding_2e844 = (u64)A1;
+	t_binding_2e847 = (u64)A2;
+	t_binding_2e849 = (u64)A3;
+	t_binding_2e856 = (u64)A4;
+	L_body_2e821:;
+	t__2e829 = (u64)((u64)t___a + (u64)((u64)8UL));
+	t__2e830 = (u64)((u64)t___a + (u64)((u64)16UL));
+	t__2e831 = (u64)(*(u64 *)t__2e829);
+	t__2e832 = (u64)((u64)t___b + (u64)((u64)8UL));
+	t__2e833 = (u64)((u64)t___b + (u64)((u64)16UL));
+	t__2e834 = (u64)(*(u64 *)t__2e832);
+	t__2e828 = (u64)(u32)(((u64)t__2e831 != (u64)t__2e834));
+	t__2e835 = (u64)(u32)((u8)t__2e828);
+	if ((u32)t__2e835) goto L_true_2e825; else goto L_false_2e826;
+	L_true_2e825:;
+	return (u32)((u64)0UL);
+	L__2e838:;
+	L__2e836:;
+	L__2e839:;
+	L_false_2e826:;
+	L__2e827:;
+	t_field_2e842 = (u64)((u64)t___a + (u64)((u64)0UL));
+	t__2e843 = (u64)(*(u64 *)t_field_2e842);
+	*(u64 *)t_binding_2e840 = (u64)t__2e843;
+	t_field_2e845 = (u64)((u64)t___b + (u64)((u64)0UL));
+	t__2e846 = (u64)(*(u64 *)t_field_2e845);
+	*(u64 *)t_binding_2e844 = (u64)t__2e846;
+	t__2e848 = (u64)(*(u64 *)t_binding_2e840);
+	*(u64 *)t_binding_2e847 = (u64)t__2e848;
+	t__2e850 = (u64)(*(u64 *)t_binding_2e844);
+	*(u64 *)t_binding_2e849 = (u64)t__2e850;
+	*(u64 *)t_binding_2e856 = (u64)((u64)0UL);
+	L_loop_2e851:;
+	t__2e858 = (u64)(*(u64 *)t_binding_2e856);
+	t__2e859 = (u64)((u64)t___a + (u64)((u64)8UL));
+	t__2e860 = (u64)((u64)t___a + (u64)((u64)16UL));
+	t__2e861 = (u64)(*(u64 *)t__2e859);
+	t__2e857 = (u64)(u32)(((u64)t__2e858 < (u64)t__2e861));
+	if ((u32)t__2e857) goto L_body_2e852; else goto L__2e854;
+	L_body_2e852:;
+	t__2e869 = (u64)(*(u64 *)t_binding_2e847);
+	t__2e872 = (u64)(*(u64 *)t_binding_2e856);
+	t__2e870 = (u64)((u64)t__2e872 * (u64)((u64)1UL));
+	t__2e870 = (u64)((u64)t__2e869 + (u64)t__2e870);
+	t__2e873 = (u64)(u32)(*(u8 *)t__2e870);
+	t__2e874 = (u64)(*(u64 *)t_binding_2e849);
+	t__2e877 = (u64)(*(u64 *)t_binding_2e856);
+	t__2e875 = (u64)((u64)t__2e877 * (u64)((u64)1UL));
+	t__2e875 = (u64)((u64)t__2e874 + (u64)t__2e875);
+	t__2e878 = (u64)(u32)(*(u8 *)t__2e875);
+	t__2e879 = (u64)(u32)((u8)t__2e873);
+	t__2e880 = (u64)(u32)((u8)t__2e878);
+	t__2e868 = (u64)(u32)(((u32)t__2e879 != (u32)t__2e880));
+	t__2e881 = (u64)(u32)((u8)t__2e868);
+	if ((u32)t__2e881) goto L_true_2e865; else goto L_false_2e866;
+	L_true_2e865:;
+	return (u32)((u64)0UL);
+	L__2e884:;
+	L__2e882:;
+	L__2e885:;
+	L_false_2e866:;
+	L__2e867:;
+	goto L__2e862;
+	L__2e886:;
+	L__2e862:;
+	L_after_2e855:;
+	t__2e887 = (u64)(*(u64 *)t_binding_2e856);
+	t__2e887 = (u64)((u64)t__2e887 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e856 = (u64)t__2e887;
+	goto L_loop_2e851;
+	L__2e854:;
+	return (u32)((u64)1UL);
+	L__2e888:;
+	L__2e822:;
+	L__2e889:;
+	return 0;
+}
+void F_rt_2ememset(u64 p_dest, u32 p_val, u64 p_amt) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	u64 t__2e1000;
+	u64 t__2e1007;
+	u64 t__2e1008;
+	u64 t__2e1009;
+	u64 t__2e1012;
+	u64 t__2e1013;
+	u64 t__2e1015;
+	u64 t__2e1016;
+	u64 t__2e1018;
+	u64 t__2e898;
+	u64 t__2e904;
+	u64 t__2e905;
+	u64 t__2e906;
+	u64 t__2e914;
+	u64 t__2e915;
+	u64 t__2e916;
+	u64 t__2e917;
+	u64 t__2e919;
+	u64 t__2e920;
+	u64 t__2e923;
+	u64 t__2e924;
+	u64 t__2e926;
+	u64 t__2e927;
+	u64 t__2e929;
+	u64 t__2e931;
+	u64 t__2e932;
+	u64 t__2e934;
+	u64 t__2e936;
+	u64 t__2e937;
+	u64 t__2e938;
+	u64 t__2e940;
+	u64 t__2e941;
+	u64 t__2e942;
+	u64 t__2e943;
+	u64 t__2e950;
+	u64 t__2e951;
+	u64 t__2e952;
+	u64 t__2e953;
+	u64 t__2e956;
+	u64 t__2e957;
+	u64 t__2e959;
+	u64 t__2e960;
+	u64 t__2e961;
+	u64 t__2e962;
+	u64 t__2e964;
+	u64 t__2e965;
+	u64 t__2e966;
+	u64 t__2e967;
+	u64 t__2e968;
+	u64 t__2e970;
+	u64 t__2e971;
+	u64 t__2e972;
+	u64 t__2e973;
+	u64 t__2e974;
+	u64 t__2e976;
+	u64 t__2e977;
+	u64 t__2e978;
+	u64 t__2e980;
+	u64 t__2e986;
+	u64 t__2e987;
+	u64 t__2e988;
+	u64 t__2e991;
+	u64 t__2e992;
+	u64 t__2e994;
+	u64 t__2e995;
+	u64 t__2e997;
+	u64 t__2e998;
+	u64 t__2e999;
+	u64 t_amt;
+	u64 t_binding_2e897;
+	u64 t_binding_2e899;
+	u64 t_binding_2e930;
+	u64 t_binding_2e935;
+	u64 t_binding_2e939;
+	u64 t_binding_2e944;
+	u64 t_dest;
+	u64 t_param_2e891;
+	u64 t_param_2e892;
+	u64 t_param_2e893;
+	u64 t_val;
+	t_dest = (u64)p_dest;
+	t_val = (u64)p_val;
+	t_amt = (u64)p_amt;
+	L_start_2e890:;
+	t_param_2e891 = (u64)A0;
+	t_param_2e892 = (u64)A1;
+	t_param_2e893 = (u64)A2;
+	t_binding_2e897 = (u64)A3;
+	t_binding_2e899 = (u64)A4;
+	t_binding_2e930 = (u64)A5;
+	t_binding_2e935 = (u64)A6;
+	t_binding_2e939 = (u64)A7;
+	t_binding_2e944 = (u64)A8;
+	*(u64 *)t_param_2e891 = (u64)t_dest;
+	*(u8 *)t_param_2e892 = (u8)t_val;
+	*(u64 *)t_param_2e893 = (u64)t_amt;
+	L_body_2e894:;
+	t__2e898 = (u64)(*(u64 *)t_param_2e891);
+	*(u64 *)t_binding_2e897 = (u64)t__2e898;
+	*(u64 *)t_binding_2e899 = (u64)((u64)0UL);
+	t__2e905 = (u64)(*(u64 *)t_param_2e893);
+	t__2e904 = (u64)(u32)(((u64)t__2e905 >= (u64)((u64)16UL)));
+	t__2e906 = (u64)(u32)((u8)t__2e904);
+	if ((u32)t__2e906) goto L_true_2e901; else goto L_false_2e902;
+	L_true_2e901:;
+	L_loop_2e909:;
+	t__2e916 = (u64)(*(u64 *)t_binding_2e897);
+	t__2e919 = (u64)(*(u64 *)t_binding_2e899);
+	t__2e917 = (u64)((u64)t__2e919 * (u64)((u64)1UL));
+	t__2e917 = (u64)((u64)t__2e916 + (u64)t__2e917);
+	t__2e920 = t__2e917;
+	t__2e915 = (u64)((u64)t__2e920 & (u64)((u64)7UL));
+	t__2e914 = (u64)(u32)(((u64)t__2e915 != (u64)((u64)0UL)));
+	if ((u32)t__2e914) goto L_body_2e910; else goto L__2e912;
+	L_body_2e910:;
+	t__2e923 = (u64)(*(u64 *)t_binding_2e897);
+	t__2e926 = (u64)(*(u64 *)t_binding_2e899);
+	t__2e924 = (u64)((u64)t__2e926 * (u64)((u64)1UL));
+	t__2e924 = (u64)((u64)t__2e923 + (u64)t__2e924);
+	t__2e927 = (u64)(u32)(*(u8 *)t_param_2e892);
+	*(u8 *)t__2e924 = (u8)t__2e927;
+	goto L__2e921;
+	L__2e928:;
+	L__2e921:;
+	L_after_2e913:;
+	t__2e929 = (u64)(*(u64 *)t_binding_2e899);
+	t__2e929 = (u64)((u64)t__2e929 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e899 = (u64)t__2e929;
+	goto L_loop_2e909;
+	L__2e912:;
+	t__2e931 = (u64)(*(u64 *)t_binding_2e897);
+	t__2e934 = (u64)(*(u64 *)t_binding_2e899);
+	t__2e932 = (u64)((u64)t__2e934 * (u64)((u64)1UL));
+	t__2e932 = (u64)((u64)t__2e931 + (u64)t__2e932);
+	*(u64 *)t_binding_2e930 = (u64)t__2e932;
+	t__2e937 = (u64)(u32)(*(u8 *)t_param_2e892);
+	t__2e938 = (u64)((u8)t__2e937);
+	t__2e936 = (u64)((u64)t__2e938 * (u64)((u64)72340172838076673UL));
+	*(u64 *)t_binding_2e935 = (u64)t__2e936;
+	t__2e942 = (u64)(*(u64 *)t_param_2e893);
+	t__2e943 = (u64)(*(u64 *)t_binding_2e899);
+	t__2e941 = (u64)((u64)t__2e942 - (u64)t__2e943);
+	t__2e940 = (u64)((u64)t__2e941 >> (((u64)3UL) & 63));
+	*(u64 *)t_binding_2e939 = (u64)t__2e940;
+	*(u64 *)t_binding_2e944 = (u64)((u64)0UL);
+	L_loop_2e945:;
+	t__2e952 = (u64)(*(u64 *)t_binding_2e944);
+	t__2e951 = (u64)((u64)t__2e952 + (u64)((u64)4UL));
+	t__2e953 = (u64)(*(u64 *)t_binding_2e939);
+	t__2e950 = (u64)(u32)(((u64)t__2e951 <= (u64)t__2e953));
+	if ((u32)t__2e950) goto L_body_2e946; else goto L__2e948;
+	L_body_2e946:;
+	t__2e956 = (u64)(*(u64 *)t_binding_2e930);
+	t__2e959 = (u64)(*(u64 *)t_binding_2e944);
+	t__2e957 = (u64)((u64)t__2e959 * (u64)((u64)8UL));
+	t__2e957 = (u64)((u64)t__2e956 + (u64)t__2e957);
+	t__2e960 = (u64)(*(u64 *)t_binding_2e935);
+	*(u64 *)t__2e957 = (u64)t__2e960;
+	t__2e961 = (u64)(*(u64 *)t_binding_2e930);
+	t__2e965 = (u64)(*(u64 *)t_binding_2e944);
+	t__2e964 = (u64)((u64)t__2e965 + (u64)((u64)1UL));
+	t__2e962 = (u64)((u64)t__2e964 * (u64)((u64)8UL));
+	t__2e962 = (u64)((u64)t__2e961 + (u64)t__2e962);
+	t__2e966 = (u64)(*(u64 *)t_binding_2e935);
+	*(u64 *)t__2e962 = (u64)t__2e966;
+	t__2e967 = (u64)(*(u64 *)t_binding_2e930);
+	t__2e971 = (u64)(*(u64 *)t_binding_2e944);
+	t__2e970 = (u64)((u64)t__2e971 + (u64)((u64)2UL));
+	t__2e968 = (u64)((u64)t__2e970 * (u64)((u64)8UL));
+	t__2e968 = (u64)((u64)t__2e967 + (u64)t__2e968);
+	t__2e972 = (u64)(*(u64 *)t_binding_2e935);
+	*(u64 *)t__2e968 = (u64)t__2e972;
+	t__2e973 = (u64)(*(u64 *)t_binding_2e930);
+	t__2e977 = (u64)(*(u64 *)t_binding_2e944);
+	t__2e976 = (u64)((u64)t__2e977 + (u64)((u64)3UL));
+	t__2e974 = (u64)((u64)t__2e976 * (u64)((u64)8UL));
+	t__2e974 = (u64)((u64)t__2e973 + (u64)t__2e974);
+	t__2e978 = (u64)(*(u64 *)t_binding_2e935);
+	*(u64 *)t__2e974 = (u64)t__2e978;
+	goto L__2e954;
+	L__2e979:;
+	L__2e954:;
+	L_after_2e949:;
+	t__2e980 = (u64)(*(u64 *)t_binding_2e944);
+	t__2e980 = (u64)((u64)t__2e980 + (u64)((u64)4UL));
+	*(u64 *)t_binding_2e944 = (u64)t__2e980;
+	goto L_loop_2e945;
+	L__2e948:;
+	L_loop_2e981:;
+	t__2e987 = (u64)(*(u64 *)t_binding_2e944);
+	t__2e988 = (u64)(*(u64 *)t_binding_2e939);
+	t__2e986 = (u64)(u32)(((u64)t__2e987 < (u64)t__2e988));
+	if ((u32)t__2e986) goto L_body_2e982; else goto L__2e984;
+	L_body_2e982:;
+	t__2e991 = (u64)(*(u64 *)t_binding_2e930);
+	t__2e994 = (u64)(*(u64 *)t_binding_2e944);
+	t__2e992 = (u64)((u64)t__2e994 * (u64)((u64)8UL));
+	t__2e992 = (u64)((u64)t__2e991 + (u64)t__2e992);
+	t__2e995 = (u64)(*(u64 *)t_binding_2e935);
+	*(u64 *)t__2e992 = (u64)t__2e995;
+	goto L__2e989;
+	L__2e996:;
+	L__2e989:;
+	L_after_2e985:;
+	t__2e997 = (u64)(*(u64 *)t_binding_2e944);
+	t__2e997 = (u64)((u64)t__2e997 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e944 = (u64)t__2e997;
+	goto L_loop_2e981;
+	L__2e984:;
+	t__2e998 = (u64)(*(u64 *)t_binding_2e899);
+	t__2e1000 = (u64)(*(u64 *)t_binding_2e939);
+	t__2e999 = (u64)((u64)t__2e1000 << (((u64)3UL) & 63));
+	t__2e998 = (u64)((u64)t__2e998 + (u64)t__2e999);
+	*(u64 *)t_binding_2e899 = (u64)t__2e998;
+	goto L__2e907;
+	L__2e1001:;
+	L__2e907:;
+	goto L__2e903;
+	L_false_2e902:;
+	L__2e903:;
+	L_loop_2e1002:;
+	t__2e1008 = (u64)(*(u64 *)t_binding_2e899);
+	t__2e1009 = (u64)(*(u64 *)t_param_2e893);
+	t__2e1007 = (u64)(u32)(((u64)t__2e1008 < (u64)t__2e1009));
+	if ((u32)t__2e1007) goto L_body_2e1003; else goto L__2e1005;
+	L_body_2e1003:;
+	t__2e1012 = (u64)(*(u64 *)t_binding_2e897);
+	t__2e1015 = (u64)(*(u64 *)t_binding_2e899);
+	t__2e1013 = (u64)((u64)t__2e1015 * (u64)((u64)1UL));
+	t__2e1013 = (u64)((u64)t__2e1012 + (u64)t__2e1013);
+	t__2e1016 = (u64)(u32)(*(u8 *)t_param_2e892);
+	*(u8 *)t__2e1013 = (u8)t__2e1016;
+	goto L__2e1010;
+	L__2e1017:;
+	L__2e1010:;
+	L_after_2e1006:;
+	t__2e1018 = (u64)(*(u64 *)t_binding_2e899);
+	t__2e1018 = (u64)((u64)t__2e1018 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e899 = (u64)t__2e1018;
+	goto L_loop_2e1002;
+	L__2e1005:;
+	goto L__2e895;
+	L__2e1019:;
+	L__2e895:;
+	return;
+}
+void F_rt_2ememmove(u64 p_dest, u64 p_src, u64 p_n) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	u64 t__2e1028;
+	u64 t__2e1030;
+	u64 t__2e1035;
+	u64 t__2e1036;
+	u64 t__2e1037;
+	u64 t__2e1038;
+	u64 t__2e1039;
+	u64 t__2e1040;
+	u64 t__2e1049;
+	u64 t__2e1050;
+	u64 t__2e1051;
+	u64 t__2e1052;
+	u64 t__2e1053;
+	u64 t__2e1054;
+	u64 t__2e1057;
+	u64 t__2e1058;
+	u64 t__2e1059;
+	u64 t__2e1063;
+	u64 t__2e1068;
+	u64 t__2e1071;
+	u64 t__2e1072;
+	u64 t__2e1073;
+	u64 t__2e1074;
+	u64 t__2e1075;
+	u64 t__2e1076;
+	u64 t__2e1077;
+	u64 t__2e1078;
+	u64 t__2e1079;
+	u64 t__2e1080;
+	u64 t__2e1084;
+	u64 t__2e1085;
+	u64 t__2e1086;
+	u64 t__2e1087;
+	u64 t__2e1088;
+	u64 t__2e1089;
+	u64 t__2e1091;
+	u64 t__2e1092;
+	u64 t__2e1093;
+	u64 t__2e1094;
+	u64 t__2e1100;
+	u64 t__2e1101;
+	u64 t__2e1102;
+	u64 t__2e1103;
+	u64 t__2e1104;
+	u64 t__2e1105;
+	u64 t__2e1108;
+	u64 t__2e1109;
+	u64 t__2e1111;
+	u64 t__2e1112;
+	u64 t__2e1113;
+	u64 t__2e1114;
+	u64 t__2e1116;
+	u64 t__2e1117;
+	u64 t__2e1118;
+	u64 t__2e1120;
+	u64 t__2e1122;
+	u64 t__2e1123;
+	u64 t__2e1125;
+	u64 t__2e1127;
+	u64 t__2e1128;
+	u64 t__2e1130;
+	u64 t__2e1136;
+	u64 t__2e1137;
+	u64 t__2e1140;
+	u64 t__2e1141;
+	u64 t__2e1143;
+	u64 t__2e1144;
+	u64 t__2e1145;
+	u64 t__2e1146;
+	u64 t__2e1148;
+	u64 t__2e1149;
+	u64 t__2e1150;
+	u64 t__2e1151;
+	u64 t__2e1152;
+	u64 t__2e1154;
+	u64 t__2e1155;
+	u64 t__2e1156;
+	u64 t__2e1157;
+	u64 t__2e1159;
+	u64 t__2e1160;
+	u64 t__2e1161;
+	u64 t__2e1162;
+	u64 t__2e1163;
+	u64 t__2e1165;
+	u64 t__2e1166;
+	u64 t__2e1167;
+	u64 t__2e1168;
+	u64 t__2e1170;
+	u64 t__2e1171;
+	u64 t__2e1172;
+	u64 t__2e1173;
+	u64 t__2e1174;
+	u64 t__2e1176;
+	u64 t__2e1177;
+	u64 t__2e1178;
+	u64 t__2e1179;
+	u64 t__2e1181;
+	u64 t__2e1182;
+	u64 t__2e1183;
+	u64 t__2e1185;
+	u64 t__2e1191;
+	u64 t__2e1192;
+	u64 t__2e1195;
+	u64 t__2e1196;
+	u64 t__2e1198;
+	u64 t__2e1199;
+	u64 t__2e1200;
+	u64 t__2e1201;
+	u64 t__2e1203;
+	u64 t__2e1204;
+	u64 t__2e1205;
+	u64 t__2e1207;
+	u64 t__2e1208;
+	u64 t__2e1215;
+	u64 t__2e1216;
+	u64 t__2e1219;
+	u64 t__2e1220;
+	u64 t__2e1222;
+	u64 t__2e1223;
+	u64 t__2e1224;
+	u64 t__2e1225;
+	u64 t__2e1227;
+	u64 t__2e1228;
+	u64 t__2e1229;
+	u64 t__2e1231;
+	u64 t_binding_2e1027;
+	u64 t_binding_2e1029;
+	u64 t_binding_2e1062;
+	u64 t_binding_2e1083;
+	u64 t_binding_2e1090;
+	u64 t_binding_2e1121;
+	u64 t_binding_2e1126;
+	u64 t_dest;
+	u64 t_n;
+	u64 t_param_2e1021;
+	u64 t_param_2e1022;
+	u64 t_param_2e1023;
+	u64 t_src;
+	t_dest = (u64)p_dest;
+	t_src = (u64)p_src;
+	t_n = (u64)p_n;
+	L_start_2e1020:;
+	t_param_2e1021 = (u64)A0;
+	t_param_2e1022 = (u64)A1;
+	t_param_2e1023 = (u64)A2;
+	t_binding_2e1027 = (u64)A3;
+	t_binding_2e1029 = (u64)A4;
+	t_binding_2e1062 = (u64)A5;
+	t_binding_2e1083 = (u64)A6;
+	t_binding_2e1090 = (u64)A7;
+	t_binding_2e1121 = (u64)A8;
+	t_binding_2e1126 = (u64)A9;
+	*(u64 *)t_param_2e1021 = (u64)t_dest;
+	*(u64 *)t_param_2e1022 = (u64)t_src;
+	*(u64 *)t_param_2e1023 = (u64)t_n;
+	L_body_2e1024:;
+	t__2e1028 = (u64)(*(u64 *)t_param_2e1021);
+	*(u64 *)t_binding_2e1027 = (u64)t__2e1028;
+	t__2e1030 = (u64)(*(u64 *)t_param_2e1022);
+	*(u64 *)t_binding_2e1029 = (u64)t__2e1030;
+	t__2e1036 = (u64)(*(u64 *)t_binding_2e1027);
+	t__2e1037 = t__2e1036;
+	t__2e1038 = (u64)(*(u64 *)t_binding_2e1029);
+	t__2e1039 = t__2e1038;
+	t__2e1035 = (u64)(u32)(((u64)t__2e1037 == (u64)t__2e1039));
+	t__2e1040 = (u64)(u32)((u8)t__2e1035);
+	if ((u32)t__2e1040) goto L_true_2e1032; else goto L_false_2e1033;
+	L_true_2e1032:;
+	return;
+	L__2e1043:;
+	L__2e1041:;
+	L__2e1044:;
+	L_false_2e1033:;
+	L__2e1034:;
+	t__2e1050 = (u64)(*(u64 *)t_binding_2e1027);
+	t__2e1051 = t__2e1050;
+	t__2e1052 = (u64)(*(u64 *)t_binding_2e1029);
+	t__2e1053 = t__2e1052;
+	t__2e1049 = (u64)(u32)(((u64)t__2e1051 < (u64)t__2e1053));
+	t__2e1054 = (u64)(u32)((u8)t__2e1049);
+	if ((u32)t__2e1054) goto L_true_2e1046; else goto L_false_2e1047;
+	L_true_2e1046:;
+	t__2e1057 = (u64)(*(u64 *)t_param_2e1021);
+	t__2e1058 = (u64)(*(u64 *)t_param_2e1022);
+	t__2e1059 = (u64)(*(u64 *)t_param_2e1023);
+	((void (*)(u64, u64, u64))((u64)((char *)&F_rt_2ememcpy)))((u64)t__2e1057, (u64)t__2e1058, (u64)t__2e1059);
+	return;
+	L__2e1060:;
+	L__2e1055:;
+	L__2e1061:;
+	L_false_2e1047:;
+	L__2e1048:;
+	t__2e1063 = (u64)(*(u64 *)t_param_2e1023);
+	*(u64 *)t_binding_2e1062 = (u64)t__2e1063;
+	t__2e1072 = (u64)(*(u64 *)t_param_2e1023);
+	t__2e1071 = (u64)(u32)(((u64)t__2e1072 >= (u64)((u64)16UL)));
+	t__2e1068 = (u64)(u32)t__2e1071;
+	if ((u32)t__2e1068) goto L__2e1069; else goto L__2e1070;
+	L__2e1069:;
+	t__2e1076 = (u64)(*(u64 *)t_binding_2e1027);
+	t__2e1077 = t__2e1076;
+	t__2e1078 = (u64)(*(u64 *)t_binding_2e1029);
+	t__2e1079 = t__2e1078;
+	t__2e1075 = (u64)((u64)t__2e1077 ^ (u64)t__2e1079);
+	t__2e1074 = (u64)((u64)t__2e1075 & (u64)((u64)7UL));
+	t__2e1073 = (u64)(u32)(((u64)t__2e1074 == (u64)((u64)0UL)));
+	t__2e1068 = (u64)(u32)t__2e1073;
+	goto L__2e1070;
+	L__2e1070:;
+	t__2e1080 = (u64)(u32)((u8)t__2e1068);
+	if ((u32)t__2e1080) goto L_true_2e1065; else goto L_false_2e1066;
+	L_true_2e1065:;
+	t__2e1087 = (u64)(*(u64 *)t_binding_2e1027);
+	t__2e1088 = t__2e1087;
+	t__2e1086 = (u64)((u64)t__2e1088 & (u64)((u64)7UL));
+	t__2e1085 = (u64)((u64)((u64)8UL) - (u64)t__2e1086);
+	t__2e1084 = (u64)((u64)t__2e1085 & (u64)((u64)7UL));
+	t__2e1089 = t__2e1084;
+	*(u64 *)t_binding_2e1083 = (u64)t__2e1089;
+	t__2e1093 = (u64)(*(u64 *)t_param_2e1023);
+	t__2e1094 = (u64)(*(u64 *)t_binding_2e1083);
+	t__2e1092 = (u64)((u64)t__2e1093 - (u64)t__2e1094);
+	t__2e1091 = (u64)((u64)t__2e1092 >> (((u64)3UL) & 63));
+	*(u64 *)t_binding_2e1090 = (u64)t__2e1091;
+	L_loop_2e1095:;
+	t__2e1101 = (u64)(*(u64 *)t_binding_2e1062);
+	t__2e1103 = (u64)(*(u64 *)t_binding_2e1083);
+	t__2e1105 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1104 = (u64)((u64)t__2e1105 << (((u64)3UL) & 63));
+	t__2e1102 = (u64)((u64)t__2e1103 + (u64)t__2e1104);
+	t__2e1100 = (u64)(u32)(((u64)t__2e1101 > (u64)t__2e1102));
+	if ((u32)t__2e1100) goto L_body_2e1096; else goto L__2e1098;
+	L_body_2e1096:;
+	t__2e1108 = (u64)(*(u64 *)t_binding_2e1027);
+	t__2e1112 = (u64)(*(u64 *)t_binding_2e1062);
+	t__2e1111 = (u64)((u64)t__2e1112 - (u64)((u64)1UL));
+	t__2e1109 = (u64)((u64)t__2e1111 * (u64)((u64)1UL));
+	t__2e1109 = (u64)((u64)t__2e1108 + (u64)t__2e1109);
+	t__2e1113 = (u64)(*(u64 *)t_binding_2e1029);
+	t__2e1117 = (u64)(*(u64 *)t_binding_2e1062);
+	t__2e1116 = (u64)((u64)t__2e1117 - (u64)((u64)1UL));
+	t__2e1114 = (u64)((u64)t__2e1116 * (u64)((u64)1UL));
+	t__2e1114 = (u64)((u64)t__2e1113 + (u64)t__2e1114);
+	t__2e1118 = (u64)(u32)(*(u8 *)t__2e1114);
+	*(u8 *)t__2e1109 = (u8)t__2e1118;
+	goto L__2e1106;
+	L__2e1119:;
+	L__2e1106:;
+	L_after_2e1099:;
+	t__2e1120 = (u64)(*(u64 *)t_binding_2e1062);
+	t__2e1120 = (u64)((u64)t__2e1120 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1062 = (u64)t__2e1120;
+	goto L_loop_2e1095;
+	L__2e1098:;
+	t__2e1122 = (u64)(*(u64 *)t_binding_2e1027);
+	t__2e1125 = (u64)(*(u64 *)t_binding_2e1083);
+	t__2e1123 = (u64)((u64)t__2e1125 * (u64)((u64)1UL));
+	t__2e1123 = (u64)((u64)t__2e1122 + (u64)t__2e1123);
+	*(u64 *)t_binding_2e1121 = (u64)t__2e1123;
+	t__2e1127 = (u64)(*(u64 *)t_binding_2e1029);
+	t__2e1130 = (u64)(*(u64 *)t_binding_2e1083);
+	t__2e1128 = (u64)((u64)t__2e1130 * (u64)((u64)1UL));
+	t__2e1128 = (u64)((u64)t__2e1127 + (u64)t__2e1128);
+	*(u64 *)t_binding_2e1126 = (u64)t__2e1128;
+	L_loop_2e1131:;
+	t__2e1137 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1136 = (u64)(u32)(((u64)t__2e1137 >= (u64)((u64)4UL)));
+	if ((u32)t__2e1136) goto L_body_2e1132; else goto L__2e1134;
+	L_body_2e1132:;
+	t__2e1140 = (u64)(*(u64 *)t_binding_2e1121);
+	t__2e1144 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1143 = (u64)((u64)t__2e1144 - (u64)((u64)1UL));
+	t__2e1141 = (u64)((u64)t__2e1143 * (u64)((u64)8UL));
+	t__2e1141 = (u64)((u64)t__2e1140 + (u64)t__2e1141);
+	t__2e1145 = (u64)(*(u64 *)t_binding_2e1126);
+	t__2e1149 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1148 = (u64)((u64)t__2e1149 - (u64)((u64)1UL));
+	t__2e1146 = (u64)((u64)t__2e1148 * (u64)((u64)8UL));
+	t__2e1146 = (u64)((u64)t__2e1145 + (u64)t__2e1146);
+	t__2e1150 = (u64)(*(u64 *)t__2e1146);
+	*(u64 *)t__2e1141 = (u64)t__2e1150;
+	t__2e1151 = (u64)(*(u64 *)t_binding_2e1121);
+	t__2e1155 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1154 = (u64)((u64)t__2e1155 - (u64)((u64)2UL));
+	t__2e1152 = (u64)((u64)t__2e1154 * (u64)((u64)8UL));
+	t__2e1152 = (u64)((u64)t__2e1151 + (u64)t__2e1152);
+	t__2e1156 = (u64)(*(u64 *)t_binding_2e1126);
+	t__2e1160 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1159 = (u64)((u64)t__2e1160 - (u64)((u64)2UL));
+	t__2e1157 = (u64)((u64)t__2e1159 * (u64)((u64)8UL));
+	t__2e1157 = (u64)((u64)t__2e1156 + (u64)t__2e1157);
+	t__2e1161 = (u64)(*(u64 *)t__2e1157);
+	*(u64 *)t__2e1152 = (u64)t__2e1161;
+	t__2e1162 = (u64)(*(u64 *)t_binding_2e1121);
+	t__2e1166 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1165 = (u64)((u64)t__2e1166 - (u64)((u64)3UL));
+	t__2e1163 = (u64)((u64)t__2e1165 * (u64)((u64)8UL));
+	t__2e1163 = (u64)((u64)t__2e1162 + (u64)t__2e1163);
+	t__2e1167 = (u64)(*(u64 *)t_binding_2e1126);
+	t__2e1171 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1170 = (u64)((u64)t__2e1171 - (u64)((u64)3UL));
+	t__2e1168 = (u64)((u64)t__2e1170 * (u64)((u64)8UL));
+	t__2e1168 = (u64)((u64)t__2e1167 + (u64)t__2e1168);
+	t__2e1172 = (u64)(*(u64 *)t__2e1168);
+	*(u64 *)t__2e1163 = (u64)t__2e1172;
+	t__2e1173 = (u64)(*(u64 *)t_binding_2e1121);
+	t__2e1177 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1176 = (u64)((u64)t__2e1177 - (u64)((u64)4UL));
+	t__2e1174 = (u64)((u64)t__2e1176 * (u64)((u64)8UL));
+	t__2e1174 = (u64)((u64)t__2e1173 + (u64)t__2e1174);
+	t__2e1178 = (u64)(*(u64 *)t_binding_2e1126);
+	t__2e1182 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1181 = (u64)((u64)t__2e1182 - (u64)((u64)4UL));
+	t__2e1179 = (u64)((u64)t__2e1181 * (u64)((u64)8UL));
+	t__2e1179 = (u64)((u64)t__2e1178 + (u64)t__2e1179);
+	t__2e1183 = (u64)(*(u64 *)t__2e1179);
+	*(u64 *)t__2e1174 = (u64)t__2e1183;
+	goto L__2e1138;
+	L__2e1184:;
+	L__2e1138:;
+	L_after_2e1135:;
+	t__2e1185 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1185 = (u64)((u64)t__2e1185 - (u64)((u64)4UL));
+	*(u64 *)t_binding_2e1090 = (u64)t__2e1185;
+	goto L_loop_2e1131;
+	L__2e1134:;
+	L_loop_2e1186:;
+	t__2e1192 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1191 = (u64)(u32)(((u64)t__2e1192 > (u64)((u64)0UL)));
+	if ((u32)t__2e1191) goto L_body_2e1187; else goto L__2e1189;
+	L_body_2e1187:;
+	t__2e1195 = (u64)(*(u64 *)t_binding_2e1121);
+	t__2e1199 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1198 = (u64)((u64)t__2e1199 - (u64)((u64)1UL));
+	t__2e1196 = (u64)((u64)t__2e1198 * (u64)((u64)8UL));
+	t__2e1196 = (u64)((u64)t__2e1195 + (u64)t__2e1196);
+	t__2e1200 = (u64)(*(u64 *)t_binding_2e1126);
+	t__2e1204 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1203 = (u64)((u64)t__2e1204 - (u64)((u64)1UL));
+	t__2e1201 = (u64)((u64)t__2e1203 * (u64)((u64)8UL));
+	t__2e1201 = (u64)((u64)t__2e1200 + (u64)t__2e1201);
+	t__2e1205 = (u64)(*(u64 *)t__2e1201);
+	*(u64 *)t__2e1196 = (u64)t__2e1205;
+	goto L__2e1193;
+	L__2e1206:;
+	L__2e1193:;
+	L_after_2e1190:;
+	t__2e1207 = (u64)(*(u64 *)t_binding_2e1090);
+	t__2e1207 = (u64)((u64)t__2e1207 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1090 = (u64)t__2e1207;
+	goto L_loop_2e1186;
+	L__2e1189:;
+	t__2e1208 = (u64)(*(u64 *)t_binding_2e1083);
+	*(u64 *)t_binding_2e1062 = (u64)t__2e1208;
+	goto L__2e1081;
+	L__2e1209:;
+	L__2e1081:;
+	goto L__2e1067;
+	L_false_2e1066:;
+	L__2e1067:;
+	L_loop_2e1210:;
+	t__2e1216 = (u64)(*(u64 *)t_binding_2e1062);
+	t__2e1215 = (u64)(u32)(((u64)t__2e1216 > (u64)((u64)0UL)));
+	if ((u32)t__2e1215) goto L_body_2e1211; else goto L__2e1213;
+	L_body_2e1211:;
+	t__2e1219 = (u64)(*(u64 *)t_binding_2e1027);
+	t__2e1223 = (u64)(*(u64 *)t_binding_2e1062);
+	t__2e1222 = (u64)((u64)t__2e1223 - (u64)((u64)1UL));
+	t__2e1220 = (u64)((u64)t__2e1222 * (u64)((u64)1UL));
+	t__2e1220 = (u64)((u64)t__2e1219 + (u64)t__2e1220);
+	t__2e1224 = (u64)(*(u64 *)t_binding_2e1029);
+	t__2e1228 = (u64)(*(u64 *)t_binding_2e1062);
+	t__2e1227 = (u64)((u64)t__2e1228 - (u64)((u64)1UL));
+	t__2e1225 = (u64)((u64)t__2e1227 * (u64)((u64)1UL));
+	t__2e1225 = (u64)((u64)t__2e1224 + (u64)t__2e1225);
+	t__2e1229 = (u64)(u32)(*(u8 *)t__2e1225);
+	*(u8 *)t__2e1220 = (u8)t__2e1229;
+	goto L__2e1217;
+	L__2e1230:;
+	L__2e1217:;
+	L_after_2e1214:;
+	t__2e1231 = (u64)(*(u64 *)t_binding_2e1062);
+	t__2e1231 = (u64)((u64)t__2e1231 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1062 = (u64)t__2e1231;
+	goto L_loop_2e1210;
+	L__2e1213:;
+	goto L__2e1025;
+	L__2e1232:;
+	L__2e1025:;
+	return;
+}
+void F_rt_2ememcpy(u64 p_dest, u64 p_src, u64 p_amt) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	u64 t__2e1241;
+	u64 t__2e1243;
+	u64 t__2e1249;
+	u64 t__2e1252;
+	u64 t__2e1253;
+	u64 t__2e1254;
+	u64 t__2e1255;
+	u64 t__2e1256;
+	u64 t__2e1257;
+	u64 t__2e1258;
+	u64 t__2e1259;
+	u64 t__2e1260;
+	u64 t__2e1261;
+	u64 t__2e1269;
+	u64 t__2e1270;
+	u64 t__2e1271;
+	u64 t__2e1272;
+	u64 t__2e1274;
+	u64 t__2e1275;
+	u64 t__2e1278;
+	u64 t__2e1279;
+	u64 t__2e1281;
+	u64 t__2e1282;
+	u64 t__2e1283;
+	u64 t__2e1285;
+	u64 t__2e1286;
+	u64 t__2e1288;
+	u64 t__2e1290;
+	u64 t__2e1291;
+	u64 t__2e1293;
+	u64 t__2e1295;
+	u64 t__2e1296;
+	u64 t__2e1298;
+	u64 t__2e1300;
+	u64 t__2e1301;
+	u64 t__2e1302;
+	u64 t__2e1303;
+	u64 t__2e1310;
+	u64 t__2e1311;
+	u64 t__2e1312;
+	u64 t__2e1313;
+	u64 t__2e1316;
+	u64 t__2e1317;
+	u64 t__2e1319;
+	u64 t__2e1320;
+	u64 t__2e1321;
+	u64 t__2e1323;
+	u64 t__2e1324;
+	u64 t__2e1325;
+	u64 t__2e1326;
+	u64 t__2e1328;
+	u64 t__2e1329;
+	u64 t__2e1330;
+	u64 t__2e1331;
+	u64 t__2e1333;
+	u64 t__2e1334;
+	u64 t__2e1335;
+	u64 t__2e1336;
+	u64 t__2e1337;
+	u64 t__2e1339;
+	u64 t__2e1340;
+	u64 t__2e1341;
+	u64 t__2e1342;
+	u64 t__2e1344;
+	u64 t__2e1345;
+	u64 t__2e1346;
+	u64 t__2e1347;
+	u64 t__2e1348;
+	u64 t__2e1350;
+	u64 t__2e1351;
+	u64 t__2e1352;
+	u64 t__2e1353;
+	u64 t__2e1355;
+	u64 t__2e1356;
+	u64 t__2e1357;
+	u64 t__2e1359;
+	u64 t__2e1365;
+	u64 t__2e1366;
+	u64 t__2e1367;
+	u64 t__2e1370;
+	u64 t__2e1371;
+	u64 t__2e1373;
+	u64 t__2e1374;
+	u64 t__2e1375;
+	u64 t__2e1377;
+	u64 t__2e1378;
+	u64 t__2e1380;
+	u64 t__2e1381;
+	u64 t__2e1382;
+	u64 t__2e1383;
+	u64 t__2e1390;
+	u64 t__2e1391;
+	u64 t__2e1392;
+	u64 t__2e1395;
+	u64 t__2e1396;
+	u64 t__2e1398;
+	u64 t__2e1399;
+	u64 t__2e1400;
+	u64 t__2e1402;
+	u64 t__2e1403;
+	u64 t__2e1405;
+	u64 t_amt;
+	u64 t_binding_2e1240;
+	u64 t_binding_2e1242;
+	u64 t_binding_2e1244;
+	u64 t_binding_2e1289;
+	u64 t_binding_2e1294;
+	u64 t_binding_2e1299;
+	u64 t_binding_2e1304;
+	u64 t_dest;
+	u64 t_param_2e1234;
+	u64 t_param_2e1235;
+	u64 t_param_2e1236;
+	u64 t_src;
+	t_dest = (u64)p_dest;
+	t_src = (u64)p_src;
+	t_amt = (u64)p_amt;
+	L_start_2e1233:;
+	t_param_2e1234 = (u64)A0;
+	t_param_2e1235 = (u64)A1;
+	t_param_2e1236 = (u64)A2;
+	t_binding_2e1240 = (u64)A3;
+	t_binding_2e1242 = (u64)A4;
+	t_binding_2e1244 = (u64)A5;
+	t_binding_2e1289 = (u64)A6;
+	t_binding_2e1294 = (u64)A7;
+	t_binding_2e1299 = (u64)A8;
+	t_binding_2e1304 = (u64)A9;
+	*(u64 *)t_param_2e1234 = (u64)t_dest;
+	*(u64 *)t_param_2e1235 = (u64)t_src;
+	*(u64 *)t_param_2e1236 = (u64)t_amt;
+	L_body_2e1237:;
+	t__2e1241 = (u64)(*(u64 *)t_param_2e1234);
+	*(u64 *)t_binding_2e1240 = (u64)t__2e1241;
+	t__2e1243 = (u64)(*(u64 *)t_param_2e1235);
+	*(u64 *)t_binding_2e1242 = (u64)t__2e1243;
+	*(u64 *)t_binding_2e1244 = (u64)((u64)0UL);
+	t__2e1253 = (u64)(*(u64 *)t_param_2e1236);
+	t__2e1252 = (u64)(u32)(((u64)t__2e1253 >= (u64)((u64)16UL)));
+	t__2e1249 = (u64)(u32)t__2e1252;
+	if ((u32)t__2e1249) goto L__2e1250; else goto L__2e1251;
+	L__2e1250:;
+	t__2e1257 = (u64)(*(u64 *)t_binding_2e1240);
+	t__2e1258 = t__2e1257;
+	t__2e1259 = (u64)(*(u64 *)t_binding_2e1242);
+	t__2e1260 = t__2e1259;
+	t__2e1256 = (u64)((u64)t__2e1258 ^ (u64)t__2e1260);
+	t__2e1255 = (u64)((u64)t__2e1256 & (u64)((u64)7UL));
+	t__2e1254 = (u64)(u32)(((u64)t__2e1255 == (u64)((u64)0UL)));
+	t__2e1249 = (u64)(u32)t__2e1254;
+	goto L__2e1251;
+	L__2e1251:;
+	t__2e1261 = (u64)(u32)((u8)t__2e1249);
+	if ((u32)t__2e1261) goto L_true_2e1246; else goto L_false_2e1247;
+	L_true_2e1246:;
+	L_loop_2e1264:;
+	t__2e1271 = (u64)(*(u64 *)t_binding_2e1240);
+	t__2e1274 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1272 = (u64)((u64)t__2e1274 * (u64)((u64)1UL));
+	t__2e1272 = (u64)((u64)t__2e1271 + (u64)t__2e1272);
+	t__2e1275 = t__2e1272;
+	t__2e1270 = (u64)((u64)t__2e1275 & (u64)((u64)7UL));
+	t__2e1269 = (u64)(u32)(((u64)t__2e1270 != (u64)((u64)0UL)));
+	if ((u32)t__2e1269) goto L_body_2e1265; else goto L__2e1267;
+	L_body_2e1265:;
+	t__2e1278 = (u64)(*(u64 *)t_binding_2e1240);
+	t__2e1281 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1279 = (u64)((u64)t__2e1281 * (u64)((u64)1UL));
+	t__2e1279 = (u64)((u64)t__2e1278 + (u64)t__2e1279);
+	t__2e1282 = (u64)(*(u64 *)t_binding_2e1242);
+	t__2e1285 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1283 = (u64)((u64)t__2e1285 * (u64)((u64)1UL));
+	t__2e1283 = (u64)((u64)t__2e1282 + (u64)t__2e1283);
+	t__2e1286 = (u64)(u32)(*(u8 *)t__2e1283);
+	*(u8 *)t__2e1279 = (u8)t__2e1286;
+	goto L__2e1276;
+	L__2e1287:;
+	L__2e1276:;
+	L_after_2e1268:;
+	t__2e1288 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1288 = (u64)((u64)t__2e1288 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1244 = (u64)t__2e1288;
+	goto L_loop_2e1264;
+	L__2e1267:;
+	t__2e1290 = (u64)(*(u64 *)t_binding_2e1240);
+	t__2e1293 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1291 = (u64)((u64)t__2e1293 * (u64)((u64)1UL));
+	t__2e1291 = (u64)((u64)t__2e1290 + (u64)t__2e1291);
+	*(u64 *)t_binding_2e1289 = (u64)t__2e1291;
+	t__2e1295 = (u64)(*(u64 *)t_binding_2e1242);
+	t__2e1298 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1296 = (u64)((u64)t__2e1298 * (u64)((u64)1UL));
+	t__2e1296 = (u64)((u64)t__2e1295 + (u64)t__2e1296);
+	*(u64 *)t_binding_2e1294 = (u64)t__2e1296;
+	t__2e1302 = (u64)(*(u64 *)t_param_2e1236);
+	t__2e1303 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1301 = (u64)((u64)t__2e1302 - (u64)t__2e1303);
+	t__2e1300 = (u64)((u64)t__2e1301 >> (((u64)3UL) & 63));
+	*(u64 *)t_binding_2e1299 = (u64)t__2e1300;
+	*(u64 *)t_binding_2e1304 = (u64)((u64)0UL);
+	L_loop_2e1305:;
+	t__2e1312 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1311 = (u64)((u64)t__2e1312 + (u64)((u64)4UL));
+	t__2e1313 = (u64)(*(u64 *)t_binding_2e1299);
+	t__2e1310 = (u64)(u32)(((u64)t__2e1311 <= (u64)t__2e1313));
+	if ((u32)t__2e1310) goto L_body_2e1306; else goto L__2e1308;
+	L_body_2e1306:;
+	t__2e1316 = (u64)(*(u64 *)t_binding_2e1289);
+	t__2e1319 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1317 = (u64)((u64)t__2e1319 * (u64)((u64)8UL));
+	t__2e1317 = (u64)((u64)t__2e1316 + (u64)t__2e1317);
+	t__2e1320 = (u64)(*(u64 *)t_binding_2e1294);
+	t__2e1323 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1321 = (u64)((u64)t__2e1323 * (u64)((u64)8UL));
+	t__2e1321 = (u64)((u64)t__2e1320 + (u64)t__2e1321);
+	t__2e1324 = (u64)(*(u64 *)t__2e1321);
+	*(u64 *)t__2e1317 = (u64)t__2e1324;
+	t__2e1325 = (u64)(*(u64 *)t_binding_2e1289);
+	t__2e1329 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1328 = (u64)((u64)t__2e1329 + (u64)((u64)1UL));
+	t__2e1326 = (u64)((u64)t__2e1328 * (u64)((u64)8UL));
+	t__2e1326 = (u64)((u64)t__2e1325 + (u64)t__2e1326);
+	t__2e1330 = (u64)(*(u64 *)t_binding_2e1294);
+	t__2e1334 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1333 = (u64)((u64)t__2e1334 + (u64)((u64)1UL));
+	t__2e1331 = (u64)((u64)t__2e1333 * (u64)((u64)8UL));
+	t__2e1331 = (u64)((u64)t__2e1330 + (u64)t__2e1331);
+	t__2e1335 = (u64)(*(u64 *)t__2e1331);
+	*(u64 *)t__2e1326 = (u64)t__2e1335;
+	t__2e1336 = (u64)(*(u64 *)t_binding_2e1289);
+	t__2e1340 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1339 = (u64)((u64)t__2e1340 + (u64)((u64)2UL));
+	t__2e1337 = (u64)((u64)t__2e1339 * (u64)((u64)8UL));
+	t__2e1337 = (u64)((u64)t__2e1336 + (u64)t__2e1337);
+	t__2e1341 = (u64)(*(u64 *)t_binding_2e1294);
+	t__2e1345 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1344 = (u64)((u64)t__2e1345 + (u64)((u64)2UL));
+	t__2e1342 = (u64)((u64)t__2e1344 * (u64)((u64)8UL));
+	t__2e1342 = (u64)((u64)t__2e1341 + (u64)t__2e1342);
+	t__2e1346 = (u64)(*(u64 *)t__2e1342);
+	*(u64 *)t__2e1337 = (u64)t__2e1346;
+	t__2e1347 = (u64)(*(u64 *)t_binding_2e1289);
+	t__2e1351 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1350 = (u64)((u64)t__2e1351 + (u64)((u64)3UL));
+	t__2e1348 = (u64)((u64)t__2e1350 * (u64)((u64)8UL));
+	t__2e1348 = (u64)((u64)t__2e1347 + (u64)t__2e1348);
+	t__2e1352 = (u64)(*(u64 *)t_binding_2e1294);
+	t__2e1356 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1355 = (u64)((u64)t__2e1356 + (u64)((u64)3UL));
+	t__2e1353 = (u64)((u64)t__2e1355 * (u64)((u64)8UL));
+	t__2e1353 = (u64)((u64)t__2e1352 + (u64)t__2e1353);
+	t__2e1357 = (u64)(*(u64 *)t__2e1353);
+	*(u64 *)t__2e1348 = (u64)t__2e1357;
+	goto L__2e1314;
+	L__2e1358:;
+	L__2e1314:;
+	L_after_2e1309:;
+	t__2e1359 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1359 = (u64)((u64)t__2e1359 + (u64)((u64)4UL));
+	*(u64 *)t_binding_2e1304 = (u64)t__2e1359;
+	goto L_loop_2e1305;
+	L__2e1308:;
+	L_loop_2e1360:;
+	t__2e1366 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1367 = (u64)(*(u64 *)t_binding_2e1299);
+	t__2e1365 = (u64)(u32)(((u64)t__2e1366 < (u64)t__2e1367));
+	if ((u32)t__2e1365) goto L_body_2e1361; else goto L__2e1363;
+	L_body_2e1361:;
+	t__2e1370 = (u64)(*(u64 *)t_binding_2e1289);
+	t__2e1373 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1371 = (u64)((u64)t__2e1373 * (u64)((u64)8UL));
+	t__2e1371 = (u64)((u64)t__2e1370 + (u64)t__2e1371);
+	t__2e1374 = (u64)(*(u64 *)t_binding_2e1294);
+	t__2e1377 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1375 = (u64)((u64)t__2e1377 * (u64)((u64)8UL));
+	t__2e1375 = (u64)((u64)t__2e1374 + (u64)t__2e1375);
+	t__2e1378 = (u64)(*(u64 *)t__2e1375);
+	*(u64 *)t__2e1371 = (u64)t__2e1378;
+	goto L__2e1368;
+	L__2e1379:;
+	L__2e1368:;
+	L_after_2e1364:;
+	t__2e1380 = (u64)(*(u64 *)t_binding_2e1304);
+	t__2e1380 = (u64)((u64)t__2e1380 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1304 = (u64)t__2e1380;
+	goto L_loop_2e1360;
+	L__2e1363:;
+	t__2e1381 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1383 = (u64)(*(u64 *)t_binding_2e1299);
+	t__2e1382 = (u64)((u64)t__2e1383 << (((u64)3UL) & 63));
+	t__2e1381 = (u64)((u64)t__2e1381 + (u64)t__2e1382);
+	*(u64 *)t_binding_2e1244 = (u64)t__2e1381;
+	goto L__2e1262;
+	L__2e1384:;
+	L__2e1262:;
+	goto L__2e1248;
+	L_false_2e1247:;
+	L__2e1248:;
+	L_loop_2e1385:;
+	t__2e1391 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1392 = (u64)(*(u64 *)t_param_2e1236);
+	t__2e1390 = (u64)(u32)(((u64)t__2e1391 < (u64)t__2e1392));
+	if ((u32)t__2e1390) goto L_body_2e1386; else goto L__2e1388;
+	L_body_2e1386:;
+	t__2e1395 = (u64)(*(u64 *)t_binding_2e1240);
+	t__2e1398 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1396 = (u64)((u64)t__2e1398 * (u64)((u64)1UL));
+	t__2e1396 = (u64)((u64)t__2e1395 + (u64)t__2e1396);
+	t__2e1399 = (u64)(*(u64 *)t_binding_2e1242);
+	t__2e1402 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1400 = (u64)((u64)t__2e1402 * (u64)((u64)1UL));
+	t__2e1400 = (u64)((u64)t__2e1399 + (u64)t__2e1400);
+	t__2e1403 = (u64)(u32)(*(u8 *)t__2e1400);
+	*(u8 *)t__2e1396 = (u8)t__2e1403;
+	goto L__2e1393;
+	L__2e1404:;
+	L__2e1393:;
+	L_after_2e1389:;
+	t__2e1405 = (u64)(*(u64 *)t_binding_2e1244);
+	t__2e1405 = (u64)((u64)t__2e1405 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1244 = (u64)t__2e1405;
+	goto L_loop_2e1385;
+	L__2e1388:;
+	goto L__2e1238;
+	L__2e1406:;
+	L__2e1238:;
+	return;
+}
+void F_rt_2eunensure(u64 p_s, u64 p_membsz) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e1414;
+	u64 t__2e1417;
+	u64 t__2e1423;
+	u64 t__2e1424;
+	u64 t__2e1425;
+	u64 t__2e1427;
+	u64 t__2e1430;
+	u64 t__2e1432;
+	u64 t__2e1433;
+	u64 t__2e1435;
+	u64 t__2e1437;
+	u64 t__2e1438;
+	u64 t__2e1440;
+	u64 t__2e1441;
+	u64 t__2e1442;
+	u64 t__2e1444;
+	u64 t__2e1445;
+	u64 t__2e1448;
+	u64 t__2e1451;
+	u64 t__2e1452;
+	u64 t__2e1453;
+	u64 t__2e1454;
+	u64 t__2e1455;
+	u64 t__2e1456;
+	u64 t__2e1458;
+	u64 t__2e1459;
+	u64 t__2e1463;
+	u64 t__2e1464;
+	u64 t__2e1465;
+	u64 t__2e1466;
+	u64 t__2e1467;
+	u64 t__2e1468;
+	u64 t__2e1470;
+	u64 t_abortsite_2e1461;
+	u64 t_binding_2e1413;
+	u64 t_binding_2e1436;
+	u64 t_field_2e1416;
+	u64 t_field_2e1426;
+	u64 t_field_2e1434;
+	u64 t_field_2e1439;
+	u64 t_field_2e1443;
+	u64 t_field_2e1457;
+	u64 t_field_2e1469;
+	u64 t_membsz;
+	u64 t_param_2e1408;
+	u64 t_param_2e1409;
+	u64 t_s;
+	t_s = (u64)p_s;
+	t_membsz = (u64)p_membsz;
+	L_start_2e1407:;
+	t_param_2e1408 = (u64)A0;
+	t_param_2e1409 = (u64)A1;
+	t_binding_2e1413 = (u64)A2;
+	t_binding_2e1436 = (u64)A3;
+	*(u64 *)t_param_2e1408 = (u64)t_s;
+	*(u64 *)t_param_2e1409 = (u64)t_membsz;
+	L_body_2e1410:;
+	t__2e1414 = (u64)(*(u64 *)t_param_2e1408);
+	t_field_2e1416 = (u64)((u64)t__2e1414 + (u64)((u64)16UL));
+	t__2e1417 = (u64)(*(u64 *)t_field_2e1416);
+	*(u64 *)t_binding_2e1413 = (u64)t__2e1417;
+	L_loop_2e1418:;
+	t__2e1424 = (u64)(*(u64 *)t_binding_2e1413);
+	t__2e1425 = (u64)(*(u64 *)t_param_2e1408);
+	t_field_2e1426 = (u64)((u64)t__2e1425 + (u64)((u64)8UL));
+	t__2e1427 = (u64)(*(u64 *)t_field_2e1426);
+	t__2e1423 = (u64)(u32)(((u64)t__2e1424 > (u64)t__2e1427));
+	if ((u32)t__2e1423) goto L_body_2e1419; else goto L__2e1421;
+	L_body_2e1419:;
+	t__2e1430 = (u64)(*(u64 *)t_binding_2e1413);
+	t__2e1430 = (u64)((u64)t__2e1430 >> (((u64)1UL) & 63));
+	*(u64 *)t_binding_2e1413 = (u64)t__2e1430;
+	goto L__2e1428;
+	L__2e1431:;
+	L__2e1428:;
+	L_after_2e1422:;
+	goto L_loop_2e1418;
+	L__2e1421:;
+	t__2e1432 = (u64)(*(u64 *)t_binding_2e1413);
+	t__2e1432 = (u64)((u64)t__2e1432 << (((u64)1UL) & 63));
+	*(u64 *)t_binding_2e1413 = (u64)t__2e1432;
+	t__2e1433 = (u64)(*(u64 *)t_param_2e1408);
+	t_field_2e1434 = (u64)((u64)t__2e1433 + (u64)((u64)16UL));
+	t__2e1435 = (u64)(*(u64 *)t_binding_2e1413);
+	*(u64 *)t_field_2e1434 = (u64)t__2e1435;
+	t__2e1438 = (u64)(*(u64 *)t_param_2e1408);
+	t_field_2e1439 = (u64)((u64)t__2e1438 + (u64)((u64)0UL));
+	t__2e1440 = (u64)(*(u64 *)t_field_2e1439);
+	t__2e1442 = (u64)(*(u64 *)t_param_2e1408);
+	t_field_2e1443 = (u64)((u64)t__2e1442 + (u64)((u64)16UL));
+	t__2e1444 = (u64)(*(u64 *)t_field_2e1443);
+	t__2e1445 = (u64)(*(u64 *)t_param_2e1409);
+	t__2e1441 = (u64)((u64)t__2e1444 * (u64)t__2e1445);
+	t__2e1437 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_rt_2erealloc)))((u64)t__2e1440, (u64)t__2e1441));
+	*(u64 *)t_binding_2e1436 = (u64)t__2e1437;
+	t__2e1452 = (u64)(*(u64 *)t_binding_2e1436);
+	t__2e1453 = ((u64)0UL);
+	t__2e1451 = (u64)(u32)(((u64)t__2e1452 != (u64)t__2e1453));
+	t__2e1448 = (u64)(u32)t__2e1451;
+	if ((u32)t__2e1448) goto L__2e1450; else goto L__2e1449;
+	L__2e1449:;
+	t__2e1456 = (u64)(*(u64 *)t_param_2e1408);
+	t_field_2e1457 = (u64)((u64)t__2e1456 + (u64)((u64)16UL));
+	t__2e1458 = (u64)(*(u64 *)t_field_2e1457);
+	t__2e1459 = (u64)(*(u64 *)t_param_2e1409);
+	t__2e1455 = (u64)((u64)t__2e1458 * (u64)t__2e1459);
+	t__2e1454 = (u64)(u32)(((u64)t__2e1455 == (u64)((u64)0UL)));
+	t__2e1448 = (u64)(u32)t__2e1454;
+	goto L__2e1450;
+	L__2e1450:;
+	if ((u32)t__2e1448) goto L_passed_2e1447; else goto L_failed_2e1446;
+	L_failed_2e1446:;
+	t_abortsite_2e1461 = ((u64)0UL);
+	goto L_abort_2e1462;
+	L_passed_2e1447:;
+	t__2e1468 = (u64)(*(u64 *)t_param_2e1408);
+	t_field_2e1469 = (u64)((u64)t__2e1468 + (u64)((u64)0UL));
+	t__2e1470 = (u64)(*(u64 *)t_binding_2e1436);
+	*(u64 *)t_field_2e1469 = (u64)t__2e1470;
+	goto L__2e1411;
+	L__2e1471:;
+	L__2e1411:;
+	return;
+	L_abort_2e1462:;
+	t__2e1463 = (u64)((u64)t_abortsite_2e1461 * (u64)((u64)16UL));
+	t__2e1463 = (u64)((u64)((u64)((char *)&D_abortsites_2e1460)) + (u64)t__2e1463);
+	t__2e1464 = (u64)(*(u64 *)t__2e1463);
+	t__2e1465 = (u64)((u64)t__2e1463 + (u64)((u64)8UL));
+	t__2e1466 = (u64)(*(u32 *)t__2e1465);
+	t__2e1465 = (u64)((u64)t__2e1463 + (u64)((u64)12UL));
+	t__2e1467 = (u64)(*(u32 *)t__2e1465);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e1464, (u64)t__2e1466, (u64)t__2e1467, (u64)((u64)6UL));
+	__builtin_trap();
+}
+void F_rt_2eensure(u64 p_s, u64 p_membsz) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	u64 t__2e1479;
+	u64 t__2e1481;
+	u64 t__2e1486;
+	u64 t__2e1487;
+	u64 t__2e1488;
+	u64 t__2e1490;
+	u64 t__2e1491;
+	u64 t__2e1501;
+	u64 t__2e1502;
+	u64 t__2e1503;
+	u64 t__2e1505;
+	u64 t__2e1510;
+	u64 t__2e1511;
+	u64 t__2e1512;
+	u64 t__2e1514;
+	u64 t__2e1521;
+	u64 t__2e1522;
+	u64 t__2e1523;
+	u64 t__2e1526;
+	u64 t__2e1528;
+	u64 t__2e1532;
+	u64 t__2e1535;
+	u64 t__2e1537;
+	u64 t__2e1539;
+	u64 t__2e1540;
+	u64 t__2e1542;
+	u64 t__2e1543;
+	u64 t__2e1544;
+	u64 t__2e1546;
+	u64 t__2e1547;
+	u64 t__2e1550;
+	u64 t__2e1553;
+	u64 t__2e1554;
+	u64 t__2e1555;
+	u64 t__2e1556;
+	u64 t__2e1557;
+	u64 t__2e1558;
+	u64 t__2e1560;
+	u64 t__2e1561;
+	u64 t__2e1565;
+	u64 t__2e1566;
+	u64 t__2e1567;
+	u64 t__2e1568;
+	u64 t__2e1569;
+	u64 t__2e1570;
+	u64 t__2e1572;
+	u64 t_abortsite_2e1563;
+	u64 t_binding_2e1478;
+	u64 t_binding_2e1538;
+	u64 t_field_2e1480;
+	u64 t_field_2e1489;
+	u64 t_field_2e1504;
+	u64 t_field_2e1513;
+	u64 t_field_2e1527;
+	u64 t_field_2e1536;
+	u64 t_field_2e1541;
+	u64 t_field_2e1545;
+	u64 t_field_2e1559;
+	u64 t_field_2e1571;
+	u64 t_membsz;
+	u64 t_param_2e1473;
+	u64 t_param_2e1474;
+	u64 t_s;
+	t_s = (u64)p_s;
+	t_membsz = (u64)p_membsz;
+	L_start_2e1472:;
+	t_param_2e1473 = (u64)A0;
+	t_param_2e1474 = (u64)A1;
+	t_binding_2e1478 = (u64)A2;
+	t_binding_2e1538 = (u64)A3;
+	*(u64 *)t_param_2e1473 = (u64)t_s;
+	*(u64 *)t_param_2e1474 = (u64)t_membsz;
+	L_body_2e1475:;
+	t__2e1479 = (u64)(*(u64 *)t_param_2e1473);
+	t_field_2e1480 = (u64)((u64)t__2e1479 + (u64)((u64)16UL));
+	t__2e1481 = (u64)(*(u64 *)t_field_2e1480);
+	*(u64 *)t_binding_2e1478 = (u64)t__2e1481;
+	t__2e1487 = (u64)(*(u64 *)t_binding_2e1478);
+	t__2e1488 = (u64)(*(u64 *)t_param_2e1473);
+	t_field_2e1489 = (u64)((u64)t__2e1488 + (u64)((u64)8UL));
+	t__2e1490 = (u64)(*(u64 *)t_field_2e1489);
+	t__2e1486 = (u64)(u32)(((u64)t__2e1487 >= (u64)t__2e1490));
+	t__2e1491 = (u64)(u32)((u8)t__2e1486);
+	if ((u32)t__2e1491) goto L_true_2e1483; else goto L_false_2e1484;
+	L_true_2e1483:;
+	return;
+	L__2e1494:;
+	L__2e1492:;
+	L__2e1495:;
+	L_false_2e1484:;
+	L__2e1485:;
+	L_loop_2e1496:;
+	t__2e1502 = (u64)(*(u64 *)t_binding_2e1478);
+	t__2e1503 = (u64)(*(u64 *)t_param_2e1473);
+	t_field_2e1504 = (u64)((u64)t__2e1503 + (u64)((u64)8UL));
+	t__2e1505 = (u64)(*(u64 *)t_field_2e1504);
+	t__2e1501 = (u64)(u32)(((u64)t__2e1502 < (u64)t__2e1505));
+	if ((u32)t__2e1501) goto L_body_2e1497; else goto L__2e1499;
+	L_body_2e1497:;
+	t__2e1511 = (u64)(*(u64 *)t_binding_2e1478);
+	t__2e1512 = (u64)(*(u64 *)t_param_2e1473);
+	t_field_2e1513 = (u64)((u64)t__2e1512 + (u64)((u64)16UL));
+	t__2e1514 = (u64)(*(u64 *)t_field_2e1513);
+	t__2e1510 = (u64)(u32)(((u64)t__2e1511 >= (u64)t__2e1514));
+	if ((u32)t__2e1510) goto L_passed_2e1509; else goto L_failed_2e1508;
+	L_failed_2e1508:;
+	BLIT((u64)B4, ((u64)((char *)&D_strliteral_2e1516)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e7)), (u64)((u64)13UL), (u64)((u64)23UL), (u64)B4);
+	__builtin_trap();
+	L_passed_2e1509:;
+	t__2e1522 = (u64)(*(u64 *)t_binding_2e1478);
+	t__2e1521 = (u64)(u32)(((u64)t__2e1522 == (u64)((u64)0UL)));
+	t__2e1523 = (u64)(u32)((u8)t__2e1521);
+	if ((u32)t__2e1523) goto L_true_2e1518; else goto L_false_2e1519;
+	L_true_2e1518:;
+	t__2e1526 = (u64)(*(u64 *)t_param_2e1473);
+	t_field_2e1527 = (u64)((u64)t__2e1526 + (u64)((u64)8UL));
+	t__2e1528 = (u64)(*(u64 *)t_field_2e1527);
+	*(u64 *)t_binding_2e1478 = (u64)t__2e1528;
+	goto L__2e1524;
+	L__2e1529:;
+	L__2e1524:;
+	goto L__2e1520;
+	L_false_2e1519:;
+	t__2e1532 = (u64)(*(u64 *)t_binding_2e1478);
+	t__2e1532 = (u64)((u64)t__2e1532 << (((u64)1UL) & 63));
+	*(u64 *)t_binding_2e1478 = (u64)t__2e1532;
+	goto L__2e1530;
+	L__2e1533:;
+	L__2e1530:;
+	L__2e1520:;
+	goto L__2e1506;
+	L__2e1534:;
+	L__2e1506:;
+	L_after_2e1500:;
+	goto L_loop_2e1496;
+	L__2e1499:;
+	t__2e1535 = (u64)(*(u64 *)t_param_2e1473);
+	t_field_2e1536 = (u64)((u64)t__2e1535 + (u64)((u64)16UL));
+	t__2e1537 = (u64)(*(u64 *)t_binding_2e1478);
+	*(u64 *)t_field_2e1536 = (u64)t__2e1537;
+	t__2e1540 = (u64)(*(u64 *)t_param_2e1473);
+	t_field_2e1541 = (u64)((u64)t__2e1540 + (u64)((u64)0UL));
+	t__2e1542 = (u64)(*(u64 *)t_field_2e1541);
+	t__2e1544 = (u64)(*(u64 *)t_param_2e1473);
+	t_field_2e1545 = (u64)((u64)t__2e1544 + (u64)((u64)16UL));
+	t__2e1546 = (u64)(*(u64 *)t_field_2e1545);
+	t__2e1547 = (u64)(*(u64 *)t_param_2e1474);
+	t__2e1543 = (u64)((u64)t__2e1546 * (u64)t__2e1547);
+	t__2e1539 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_rt_2erealloc)))((u64)t__2e1542, (u64)t__2e1543));
+	*(u64 *)t_binding_2e1538 = (u64)t__2e1539;
+	t__2e1554 = (u64)(*(u64 *)t_binding_2e1538);
+	t__2e1555 = ((u64)0UL);
+	t__2e1553 = (u64)(u32)(((u64)t__2e1554 != (u64)t__2e1555));
+	t__2e1550 = (u64)(u32)t__2e1553;
+	if ((u32)t__2e1550) goto L__2e1552; else goto L__2e1551;
+	L__2e1551:;
+	t__2e1558 = (u64)(*(u64 *)t_param_2e1473);
+	t_field_2e1559 = (u64)((u64)t__2e1558 + (u64)((u64)16UL));
+	t__2e1560 = (u64)(*(u64 *)t_field_2e1559);
+	t__2e1561 = (u64)(*(u64 *)t_param_2e1474);
+	t__2e1557 = (u64)((u64)t__2e1560 * (u64)t__2e1561);
+	t__2e1556 = (u64)(u32)(((u64)t__2e1557 == (u64)((u64)0UL)));
+	t__2e1550 = (u64)(u32)t__2e1556;
+	goto L__2e1552;
+	L__2e1552:;
+	if ((u32)t__2e1550) goto L_passed_2e1549; else goto L_failed_2e1548;
+	L_failed_2e1548:;
+	t_abortsite_2e1563 = ((u64)0UL);
+	goto L_abort_2e1564;
+	L_passed_2e1549:;
+	t__2e1570 = (u64)(*(u64 *)t_param_2e1473);
+	t_field_2e1571 = (u64)((u64)t__2e1570 + (u64)((u64)0UL));
+	t__2e1572 = (u64)(*(u64 *)t_binding_2e1538);
+	*(u64 *)t_field_2e1571 = (u64)t__2e1572;
+	goto L__2e1476;
+	L__2e1573:;
+	L__2e1476:;
+	return;
+	L_abort_2e1564:;
+	t__2e1565 = (u64)((u64)t_abortsite_2e1563 * (u64)((u64)16UL));
+	t__2e1565 = (u64)((u64)((u64)((char *)&D_abortsites_2e1562)) + (u64)t__2e1565);
+	t__2e1566 = (u64)(*(u64 *)t__2e1565);
+	t__2e1567 = (u64)((u64)t__2e1565 + (u64)((u64)8UL));
+	t__2e1568 = (u64)(*(u32 *)t__2e1567);
+	t__2e1567 = (u64)((u64)t__2e1565 + (u64)((u64)12UL));
+	t__2e1569 = (u64)(*(u32 *)t__2e1567);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e1566, (u64)t__2e1568, (u64)t__2e1569, (u64)((u64)6UL));
+	__builtin_trap();
+}
+u64 F_rt_2etoutf8(u64 __rp, u64 p_s) {
+	u64 t_s;
+	t_s = p_s;
+	L_start_2e1574:;
+	L_body_2e1576:;
+	BLIT(__rp, t_s, 24); return __rp;
+}
+u64 F_rt_2ecompile(u64 __rp, u64 p_expected, u64 p_src, u64 p_flags) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char A11[4] __attribute__((aligned(16)));
+	char A12[4] __attribute__((aligned(16)));
+	char A13[4] __attribute__((aligned(16)));
+	char A14[24] __attribute__((aligned(16)));
+	char A15[4] __attribute__((aligned(16)));
+	char B16[24] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char R25[24] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char R29[24] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char B31[24] __attribute__((aligned(16)));
+	char R32[24] __attribute__((aligned(16)));
+	char B33[24] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	u64 t__2e1591;
+	u64 t__2e1592;
+	u64 t__2e1595;
+	u64 t__2e1596;
+	u64 t__2e1600;
+	u64 t__2e1601;
+	u64 t__2e1602;
+	u64 t__2e1603;
+	u64 t__2e1604;
+	u64 t__2e1606;
+	u64 t__2e1611;
+	u64 t__2e1612;
+	u64 t__2e1613;
+	u64 t__2e1616;
+	u64 t__2e1617;
+	u64 t__2e1618;
+	u64 t__2e1619;
+	u64 t__2e1620;
+	u64 t__2e1621;
+	u64 t__2e1622;
+	u64 t__2e1623;
+	u64 t__2e1624;
+	u64 t__2e1625;
+	u64 t__2e1627;
+	u64 t__2e1629;
+	u64 t__2e1630;
+	u64 t__2e1631;
+	u64 t__2e1632;
+	u64 t__2e1635;
+	u64 t__2e1636;
+	u64 t__2e1637;
+	u64 t__2e1640;
+	u64 t__2e1641;
+	u64 t__2e1642;
+	u64 t__2e1649;
+	u64 t__2e1650;
+	u64 t__2e1651;
+	u64 t__2e1652;
+	u64 t__2e1653;
+	u64 t__2e1656;
+	u64 t__2e1657;
+	u64 t__2e1658;
+	u64 t__2e1659;
+	u64 t__2e1660;
+	u64 t__2e1661;
+	u64 t__2e1662;
+	u64 t__2e1663;
+	u64 t__2e1664;
+	u64 t__2e1665;
+	u64 t__2e1666;
+	u64 t__2e1667;
+	u64 t__2e1670;
+	u64 t__2e1671;
+	u64 t__2e1672;
+	u64 t__2e1674;
+	u64 t__2e1675;
+	u64 t__2e1676;
+	u64 t__2e1677;
+	u64 t__2e1678;
+	u64 t__2e1681;
+	u64 t__2e1682;
+	u64 t__2e1683;
+	u64 t__2e1686;
+	u64 t__2e1687;
+	u64 t__2e1688;
+	u64 t__2e1689;
+	u64 t__2e1690;
+	u64 t__2e1691;
+	u64 t__2e1692;
+	u64 t__2e1695;
+	u64 t__2e1696;
+	u64 t__2e1697;
+	u64 t__2e1700;
+	u64 t__2e1701;
+	u64 t__2e1702;
+	u64 t__2e1703;
+	u64 t__2e1704;
+	u64 t__2e1705;
+	u64 t__2e1706;
+	u64 t__2e1707;
+	u64 t__2e1708;
+	u64 t__2e1709;
+	u64 t__2e1712;
+	u64 t__2e1713;
+	u64 t__2e1714;
+	u64 t__2e1715;
+	u64 t__2e1716;
+	u64 t__2e1719;
+	u64 t__2e1720;
+	u64 t__2e1722;
+	u64 t__2e1723;
+	u64 t__2e1724;
+	u64 t__2e1725;
+	u64 t__2e1726;
+	u64 t__2e1738;
+	u64 t__2e1739;
+	u64 t__2e1740;
+	u64 t__2e1741;
+	u64 t__2e1742;
+	u64 t__2e1745;
+	u64 t__2e1746;
+	u64 t__2e1747;
+	u64 t__2e1748;
+	u64 t__2e1749;
+	u64 t__2e1750;
+	u64 t__2e1751;
+	u64 t__2e1755;
+	u64 t__2e1756;
+	u64 t__2e1757;
+	u64 t__2e1758;
+	u64 t__2e1759;
+	u64 t__2e1760;
+	u64 t__2e1762;
+	u64 t__2e1768;
+	u64 t__2e1769;
+	u64 t__2e1770;
+	u64 t__2e1773;
+	u64 t__2e1774;
+	u64 t__2e1775;
+	u64 t__2e1776;
+	u64 t__2e1778;
+	u64 t__2e1785;
+	u64 t__2e1786;
+	u64 t__2e1787;
+	u64 t__2e1788;
+	u64 t__2e1789;
+	u64 t__2e1793;
+	u64 t__2e1794;
+	u64 t__2e1795;
+	u64 t__2e1796;
+	u64 t__2e1797;
+	u64 t__2e1798;
+	u64 t__2e1800;
+	u64 t__2e1801;
+	u64 t__2e1802;
+	u64 t__2e1803;
+	u64 t__2e1804;
+	u64 t__2e1805;
+	u64 t__2e1808;
+	u64 t__2e1809;
+	u64 t__2e1812;
+	u64 t__2e1813;
+	u64 t__2e1815;
+	u64 t__2e1816;
+	u64 t__2e1817;
+	u64 t__2e1818;
+	u64 t__2e1819;
+	u64 t__2e1820;
+	u64 t__2e1826;
+	u64 t__2e1827;
+	u64 t__2e1828;
+	u64 t__2e1829;
+	u64 t__2e1830;
+	u64 t__2e1835;
+	u64 t__2e1836;
+	u64 t__2e1840;
+	u64 t__2e1841;
+	u64 t__2e1842;
+	u64 t__2e1843;
+	u64 t__2e1844;
+	u64 t__2e1845;
+	u64 t__2e1846;
+	u64 t__2e1847;
+	u64 t__2e1848;
+	u64 t__2e1849;
+	u64 t__2e1850;
+	u64 t__2e1851;
+	u64 t__2e1852;
+	u64 t__2e1853;
+	u64 t__2e1854;
+	u64 t__2e1869;
+	u64 t__2e1871;
+	u64 t__2e1876;
+	u64 t__2e1877;
+	u64 t__2e1881;
+	u64 t__2e1882;
+	u64 t__2e1887;
+	u64 t__2e1888;
+	u64 t__2e1889;
+	u64 t__2e1890;
+	u64 t__2e1891;
+	u64 t__2e1897;
+	u64 t__2e1898;
+	u64 t__2e1899;
+	u64 t__2e1900;
+	u64 t__2e1901;
+	u64 t__2e1902;
+	u64 t__2e1903;
+	u64 t__2e1904;
+	u64 t__2e1905;
+	u64 t__2e1906;
+	u64 t__2e1907;
+	u64 t__2e1908;
+	u64 t__2e1909;
+	u64 t__2e1912;
+	u64 t__2e1913;
+	u64 t__2e1914;
+	u64 t__2e1915;
+	u64 t__2e1916;
+	u64 t__2e1917;
+	u64 t__2e1918;
+	u64 t__2e1919;
+	u64 t__2e1920;
+	u64 t__2e1921;
+	u64 t__2e1922;
+	u64 t__2e1923;
+	u64 t__2e1924;
+	u64 t__2e1925;
+	u64 t__2e1931;
+	u64 t__2e1932;
+	u64 t__2e1933;
+	u64 t__2e1934;
+	u64 t__2e1935;
+	u64 t_abortsite_2e1598;
+	u64 t_binding_2e1587;
+	u64 t_binding_2e1588;
+	u64 t_binding_2e1605;
+	u64 t_binding_2e1626;
+	u64 t_binding_2e1648;
+	u64 t_binding_2e1737;
+	u64 t_binding_2e1777;
+	u64 t_binding_2e1784;
+	u64 t_binding_2e1792;
+	u64 t_binding_2e1837;
+	u64 t_binding_2e1875;
+	u64 t_binding_2e1880;
+	u64 t_binding_2e1894;
+	u64 t_cleanup_2e1727;
+	u64 t_expected;
+	u64 t_flags;
+	u64 t_item_2e1590;
+	u64 t_object_2e1584;
+	u64 t_object_2e1857;
+	u64 t_object_2e1926;
+	u64 t_src;
+	u64 t_tag_2e1861;
+	t_expected = p_expected;
+	t_src = p_src;
+	t_flags = p_flags;
+	L_start_2e1577:;
+	t_object_2e1584 = (u64)A0;
+	t_binding_2e1587 = (u64)A1;
+	t_binding_2e1588 = (u64)A2;
+	t_binding_2e1605 = (u64)A3;
+	t_binding_2e1626 = (u64)A4;
+	t_binding_2e1648 = (u64)A5;
+	t_binding_2e1737 = (u64)A6;
+	t_binding_2e1777 = (u64)A7;
+	t_binding_2e1784 = (u64)A8;
+	t_binding_2e1792 = (u64)A9;
+	t_binding_2e1837 = (u64)A10;
+	t_object_2e1857 = (u64)A11;
+	t_binding_2e1875 = (u64)A12;
+	t_binding_2e1880 = (u64)A13;
+	t_binding_2e1894 = (u64)A14;
+	t_object_2e1926 = (u64)A15;
+	L_body_2e1583:;
+	*(u32 *)t_object_2e1584 = (u32)((u64)3012680272UL);
+	*(u32 *)t_binding_2e1587 = (u32)((u64)0UL);
+	t_item_2e1590 = (u64)((u64)t_binding_2e1588 + (u64)((u64)0UL));
+	t__2e1591 = (u64)(u32)(-(u32)((u64)1UL));
+	*(u32 *)t_item_2e1590 = (u32)t__2e1591;
+	t_item_2e1590 = (u64)((u64)t_binding_2e1588 + (u64)((u64)4UL));
+	t__2e1592 = (u64)(u32)(-(u32)((u64)1UL));
+	*(u32 *)t_item_2e1590 = (u32)t__2e1592;
+	t__2e1596 = (u64)(u32)(((u32 (*)(u64, u32))((u64)((char *)&F_rt_2epipe2)))((u64)t_binding_2e1588, (u32)((u64)0UL)));
+	t__2e1595 = (u64)(u32)(((u32)t__2e1596 == (u32)((u64)0UL)));
+	if ((u32)t__2e1595) goto L_passed_2e1594; else goto L_failed_2e1593;
+	L_failed_2e1593:;
+	t_abortsite_2e1598 = ((u64)0UL);
+	goto L_abort_2e1599;
+	L_passed_2e1594:;
+	t__2e1606 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_rt_2efork)))());
+	*(u32 *)t_binding_2e1605 = (u32)t__2e1606;
+	t__2e1612 = (u64)(u32)(*(i32 *)t_binding_2e1605);
+	t__2e1611 = (u64)(u32)(((u32)t__2e1612 == (u32)((u64)0UL)));
+	t__2e1613 = (u64)(u32)((u8)t__2e1611);
+	if ((u32)t__2e1613) goto L_true_2e1608; else goto L_false_2e1609;
+	L_true_2e1608:;
+	t__2e1618 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1617 = (u64)((u64)t__2e1618 * (u64)((u64)4UL));
+	t__2e1617 = (u64)((u64)t_binding_2e1588 + (u64)t__2e1617);
+	t__2e1619 = (u64)(u32)(*(i32 *)t__2e1617);
+	t__2e1616 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_rt_2eclose)))((u32)t__2e1619));
+	t__2e1622 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1621 = (u64)((u64)t__2e1622 * (u64)((u64)4UL));
+	t__2e1621 = (u64)((u64)t_binding_2e1588 + (u64)t__2e1621);
+	t__2e1623 = (u64)(u32)(*(i32 *)t__2e1621);
+	t__2e1620 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rt_2edup2)))((u32)t__2e1623, (u32)((u64)0UL)));
+	t__2e1624 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_rt_2eclose)))((u32)((u64)1UL)));
+	t__2e1625 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_rt_2eclose)))((u32)((u64)2UL)));
+	*(u64 *)t_binding_2e1626 = (u64)((u64)0UL);
+	t__2e1627 = (u64)((u64)t_binding_2e1626 + (u64)((u64)8UL));
+	*(u64 *)t__2e1627 = (u64)((u64)0UL);
+	t__2e1627 = (u64)((u64)t__2e1627 + (u64)((u64)8UL));
+	*(u64 *)t__2e1627 = (u64)((u64)0UL);
+	t__2e1629 = (u64)((u64)t_binding_2e1626 + (u64)((u64)8UL));
+	t__2e1630 = (u64)((u64)t_binding_2e1626 + (u64)((u64)16UL));
+	t__2e1631 = (u64)(*(u64 *)t__2e1629);
+	BLIT((u64)B16, ((u64)((char *)&D_strliteral_2e1634)), 24);
+	t__2e1632 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2ealloc__constchar)))((u64)B16));
+	t__2e1635 = (u64)((u64)t__2e1631 + (u64)((u64)1UL));
+	*(u64 *)t__2e1629 = (u64)t__2e1635;
+	t__2e1637 = (u64)(*(u64 *)t__2e1630);
+	t__2e1640 = (u64)(u32)(((u64)t__2e1635 <= (u64)t__2e1637));
+	if ((u32)t__2e1640) goto L__2e1638; else goto L__2e1639;
+	L__2e1639:;
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2eensure)))((u64)t_binding_2e1626, (u64)((u64)8UL));
+	goto L__2e1638;
+	L__2e1638:;
+	t__2e1641 = (u64)(*(u64 *)t_binding_2e1626);
+	t__2e1636 = (u64)((u64)t__2e1631 * (u64)((u64)8UL));
+	t__2e1636 = (u64)((u64)t__2e1641 + (u64)t__2e1636);
+	t__2e1642 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1636 = (u64)t__2e1632;
+	*(u64 *)t_binding_2e1648 = (u64)((u64)0UL);
+	L_loop_2e1643:;
+	t__2e1650 = (u64)(*(u64 *)t_binding_2e1648);
+	t__2e1651 = (u64)((u64)t_flags + (u64)((u64)8UL));
+	t__2e1652 = (u64)((u64)t_flags + (u64)((u64)16UL));
+	t__2e1653 = (u64)(*(u64 *)t__2e1651);
+	t__2e1649 = (u64)(u32)(((u64)t__2e1650 < (u64)t__2e1653));
+	if ((u32)t__2e1649) goto L_body_2e1644; else goto L__2e1646;
+	L_body_2e1644:;
+	t__2e1656 = (u64)((u64)t_binding_2e1626 + (u64)((u64)8UL));
+	t__2e1657 = (u64)((u64)t_binding_2e1626 + (u64)((u64)16UL));
+	t__2e1658 = (u64)(*(u64 *)t__2e1656);
+	t__2e1661 = (u64)((u64)t_flags + (u64)((u64)8UL));
+	t__2e1662 = (u64)((u64)t_flags + (u64)((u64)16UL));
+	t__2e1663 = (u64)(*(u64 *)t_flags);
+	t__2e1664 = (u64)(*(u64 *)t_binding_2e1648);
+	t__2e1660 = (u64)((u64)t__2e1664 * (u64)((u64)24UL));
+	t__2e1660 = (u64)((u64)t__2e1663 + (u64)t__2e1660);
+	BLIT((u64)B17, t__2e1660, 24);
+	t__2e1659 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2ealloc__constchar)))((u64)B17));
+	t__2e1665 = (u64)((u64)t__2e1658 + (u64)((u64)1UL));
+	*(u64 *)t__2e1656 = (u64)t__2e1665;
+	t__2e1667 = (u64)(*(u64 *)t__2e1657);
+	t__2e1670 = (u64)(u32)(((u64)t__2e1665 <= (u64)t__2e1667));
+	if ((u32)t__2e1670) goto L__2e1668; else goto L__2e1669;
+	L__2e1669:;
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2eensure)))((u64)t_binding_2e1626, (u64)((u64)8UL));
+	goto L__2e1668;
+	L__2e1668:;
+	t__2e1671 = (u64)(*(u64 *)t_binding_2e1626);
+	t__2e1666 = (u64)((u64)t__2e1658 * (u64)((u64)8UL));
+	t__2e1666 = (u64)((u64)t__2e1671 + (u64)t__2e1666);
+	t__2e1672 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1666 = (u64)t__2e1659;
+	goto L__2e1654;
+	L__2e1673:;
+	L__2e1654:;
+	L_after_2e1647:;
+	t__2e1674 = (u64)(*(u64 *)t_binding_2e1648);
+	t__2e1674 = (u64)((u64)t__2e1674 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1648 = (u64)t__2e1674;
+	goto L_loop_2e1643;
+	L__2e1646:;
+	t__2e1675 = (u64)((u64)t_binding_2e1626 + (u64)((u64)8UL));
+	t__2e1676 = (u64)((u64)t_binding_2e1626 + (u64)((u64)16UL));
+	t__2e1677 = (u64)(*(u64 *)t__2e1675);
+	BLIT((u64)B18, ((u64)((char *)&D_strliteral_2e1680)), 24);
+	t__2e1678 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2ealloc__constchar)))((u64)B18));
+	t__2e1681 = (u64)((u64)t__2e1677 + (u64)((u64)1UL));
+	*(u64 *)t__2e1675 = (u64)t__2e1681;
+	t__2e1683 = (u64)(*(u64 *)t__2e1676);
+	t__2e1686 = (u64)(u32)(((u64)t__2e1681 <= (u64)t__2e1683));
+	if ((u32)t__2e1686) goto L__2e1684; else goto L__2e1685;
+	L__2e1685:;
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2eensure)))((u64)t_binding_2e1626, (u64)((u64)8UL));
+	goto L__2e1684;
+	L__2e1684:;
+	t__2e1687 = (u64)(*(u64 *)t_binding_2e1626);
+	t__2e1682 = (u64)((u64)t__2e1677 * (u64)((u64)8UL));
+	t__2e1682 = (u64)((u64)t__2e1687 + (u64)t__2e1682);
+	t__2e1688 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1682 = (u64)t__2e1678;
+	t__2e1689 = (u64)((u64)t_binding_2e1626 + (u64)((u64)8UL));
+	t__2e1690 = (u64)((u64)t_binding_2e1626 + (u64)((u64)16UL));
+	t__2e1691 = (u64)(*(u64 *)t__2e1689);
+	BLIT((u64)B19, ((u64)((char *)&D_strliteral_2e1694)), 24);
+	t__2e1692 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2ealloc__constchar)))((u64)B19));
+	t__2e1695 = (u64)((u64)t__2e1691 + (u64)((u64)1UL));
+	*(u64 *)t__2e1689 = (u64)t__2e1695;
+	t__2e1697 = (u64)(*(u64 *)t__2e1690);
+	t__2e1700 = (u64)(u32)(((u64)t__2e1695 <= (u64)t__2e1697));
+	if ((u32)t__2e1700) goto L__2e1698; else goto L__2e1699;
+	L__2e1699:;
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2eensure)))((u64)t_binding_2e1626, (u64)((u64)8UL));
+	goto L__2e1698;
+	L__2e1698:;
+	t__2e1701 = (u64)(*(u64 *)t_binding_2e1626);
+	t__2e1696 = (u64)((u64)t__2e1691 * (u64)((u64)8UL));
+	t__2e1696 = (u64)((u64)t__2e1701 + (u64)t__2e1696);
+	t__2e1702 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1696 = (u64)t__2e1692;
+	t__2e1703 = (u64)((u64)t_binding_2e1626 + (u64)((u64)8UL));
+	t__2e1704 = (u64)((u64)t_binding_2e1626 + (u64)((u64)16UL));
+	t__2e1705 = (u64)(*(u64 *)t__2e1703);
+	t__2e1706 = ((u64)0UL);
+	t__2e1707 = (u64)((u64)t__2e1705 + (u64)((u64)1UL));
+	*(u64 *)t__2e1703 = (u64)t__2e1707;
+	t__2e1709 = (u64)(*(u64 *)t__2e1704);
+	t__2e1712 = (u64)(u32)(((u64)t__2e1707 <= (u64)t__2e1709));
+	if ((u32)t__2e1712) goto L__2e1710; else goto L__2e1711;
+	L__2e1711:;
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2eensure)))((u64)t_binding_2e1626, (u64)((u64)8UL));
+	goto L__2e1710;
+	L__2e1710:;
+	t__2e1713 = (u64)(*(u64 *)t_binding_2e1626);
+	t__2e1708 = (u64)((u64)t__2e1705 * (u64)((u64)8UL));
+	t__2e1708 = (u64)((u64)t__2e1713 + (u64)t__2e1708);
+	t__2e1714 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1708 = (u64)t__2e1706;
+	BLIT((u64)B20, ((u64)((char *)&D_strliteral_2e1718)), 24);
+	t__2e1716 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B20));
+	t__2e1719 = (u64)(*(u64 *)t_binding_2e1626);
+	t__2e1720 = (u64)(*(u64 *)((u64)((char *)&D_rt_2eenvp)));
+	t__2e1715 = (u64)(u32)(((u32 (*)(u64, u64, u64))((u64)((char *)&F_rt_2eexecve)))((u64)t__2e1716, (u64)t__2e1719, (u64)t__2e1720));
+	t_abortsite_2e1598 = ((u64)1UL);
+	goto L_abort_2e1721;
+	L__2e1730:;
+	goto L__2e1731;
+	L_defer_2e1728:;
+	*(u64 *)t_binding_2e1737 = (u64)((u64)0UL);
+	L_loop_2e1732:;
+	t__2e1739 = (u64)(*(u64 *)t_binding_2e1737);
+	t__2e1740 = (u64)((u64)t_binding_2e1626 + (u64)((u64)8UL));
+	t__2e1741 = (u64)((u64)t_binding_2e1626 + (u64)((u64)16UL));
+	t__2e1742 = (u64)(*(u64 *)t__2e1740);
+	t__2e1738 = (u64)(u32)(((u64)t__2e1739 < (u64)t__2e1742));
+	if ((u32)t__2e1738) goto L_body_2e1733; else goto L__2e1735;
+	L_body_2e1733:;
+	t__2e1746 = (u64)((u64)t_binding_2e1626 + (u64)((u64)8UL));
+	t__2e1747 = (u64)((u64)t_binding_2e1626 + (u64)((u64)16UL));
+	t__2e1748 = (u64)(*(u64 *)t_binding_2e1626);
+	t__2e1749 = (u64)(*(u64 *)t__2e1746);
+	t__2e1750 = (u64)(*(u64 *)t_binding_2e1737);
+	t__2e1745 = (u64)((u64)t__2e1750 * (u64)((u64)8UL));
+	t__2e1745 = (u64)((u64)t__2e1748 + (u64)t__2e1745);
+	t__2e1751 = (u64)(u32)(((u64)t__2e1750 < (u64)t__2e1749));
+	if ((u32)t__2e1751) goto L__2e1753; else goto L__2e1752;
+	L__2e1752:;
+	t_abortsite_2e1598 = ((u64)2UL);
+	goto L_abort_2e1754;
+	L__2e1753:;
+	t__2e1760 = (u64)(*(u64 *)t__2e1745);
+	((void (*)(u64))((u64)((char *)&F_rt_2efree)))((u64)t__2e1760);
+	goto L__2e1743;
+	L__2e1761:;
+	L__2e1743:;
+	L_after_2e1736:;
+	t__2e1762 = (u64)(*(u64 *)t_binding_2e1737);
+	t__2e1762 = (u64)((u64)t__2e1762 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1737 = (u64)t__2e1762;
+	goto L_loop_2e1732;
+	L__2e1735:;
+	goto L_resume_2e1729;
+	L__2e1731:;
+	L__2e1614:;
+	L__2e1763:;
+	L_false_2e1609:;
+	t__2e1769 = (u64)(u32)(*(i32 *)t_binding_2e1605);
+	t__2e1770 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e1768 = (u64)(u32)(((u32)t__2e1769 != (u32)t__2e1770));
+	if ((u32)t__2e1768) goto L_passed_2e1767; else goto L_failed_2e1766;
+	L_failed_2e1766:;
+	BLIT((u64)B21, ((u64)((char *)&D_strliteral_2e1772)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e3)), (u64)((u64)64UL), (u64)((u64)23UL), (u64)B21);
+	__builtin_trap();
+	L_passed_2e1767:;
+	t__2e1775 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1774 = (u64)((u64)t__2e1775 * (u64)((u64)4UL));
+	t__2e1774 = (u64)((u64)t_binding_2e1588 + (u64)t__2e1774);
+	t__2e1776 = (u64)(u32)(*(i32 *)t__2e1774);
+	t__2e1773 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_rt_2eclose)))((u32)t__2e1776));
+	BLIT((u64)B22, t_src, 24);
+	t__2e1778 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B22));
+	*(u64 *)t_binding_2e1777 = (u64)t__2e1778;
+	*(u64 *)t_binding_2e1784 = (u64)((u64)0UL);
+	L_loop_2e1779:;
+	t__2e1786 = (u64)(*(u64 *)t_binding_2e1784);
+	t__2e1787 = (u64)((u64)t_src + (u64)((u64)8UL));
+	t__2e1788 = (u64)((u64)t_src + (u64)((u64)16UL));
+	t__2e1789 = (u64)(*(u64 *)t__2e1787);
+	t__2e1785 = (u64)(u32)(((u64)t__2e1786 < (u64)t__2e1789));
+	if ((u32)t__2e1785) goto L_body_2e1780; else goto L__2e1782;
+	L_body_2e1780:;
+	t__2e1795 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1794 = (u64)((u64)t__2e1795 * (u64)((u64)4UL));
+	t__2e1794 = (u64)((u64)t_binding_2e1588 + (u64)t__2e1794);
+	t__2e1796 = (u64)(u32)(*(i32 *)t__2e1794);
+	t__2e1797 = (u64)(*(u64 *)t_binding_2e1777);
+	t__2e1800 = (u64)(*(u64 *)t_binding_2e1784);
+	t__2e1798 = (u64)((u64)t__2e1800 * (u64)((u64)1UL));
+	t__2e1798 = (u64)((u64)t__2e1797 + (u64)t__2e1798);
+	t__2e1802 = (u64)((u64)t_src + (u64)((u64)8UL));
+	t__2e1803 = (u64)((u64)t_src + (u64)((u64)16UL));
+	t__2e1804 = (u64)(*(u64 *)t__2e1802);
+	t__2e1805 = (u64)(*(u64 *)t_binding_2e1784);
+	t__2e1801 = (u64)((u64)t__2e1804 - (u64)t__2e1805);
+	t__2e1793 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)t__2e1796, (u64)t__2e1798, (u64)t__2e1801));
+	*(u64 *)t_binding_2e1792 = (u64)t__2e1793;
+	t__2e1809 = (u64)(*(u64 *)t_binding_2e1792);
+	t__2e1808 = (u64)(u32)(((u64)t__2e1809 > (u64)((u64)0UL)));
+	if ((u32)t__2e1808) goto L_passed_2e1807; else goto L_failed_2e1806;
+	L_failed_2e1806:;
+	BLIT((u64)B23, ((u64)((char *)&D_strliteral_2e1811)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e3)), (u64)((u64)70UL), (u64)((u64)31UL), (u64)B23);
+	__builtin_trap();
+	L_passed_2e1807:;
+	t__2e1812 = (u64)(*(u64 *)t_binding_2e1784);
+	t__2e1813 = (u64)(*(u64 *)t_binding_2e1792);
+	t__2e1812 = (u64)((u64)t__2e1812 + (u64)t__2e1813);
+	*(u64 *)t_binding_2e1784 = (u64)t__2e1812;
+	goto L__2e1790;
+	L__2e1814:;
+	L__2e1790:;
+	L_after_2e1783:;
+	goto L_loop_2e1779;
+	L__2e1782:;
+	t__2e1817 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1816 = (u64)((u64)t__2e1817 * (u64)((u64)4UL));
+	t__2e1816 = (u64)((u64)t_binding_2e1588 + (u64)t__2e1816);
+	t__2e1818 = (u64)(u32)(*(i32 *)t__2e1816);
+	t__2e1815 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_rt_2eclose)))((u32)t__2e1818));
+	t__2e1819 = (u64)(u32)(*(i32 *)t_binding_2e1605);
+	t__2e1820 = ((u64)0UL);
+	((void (*)(u32, u64, u32, u64))((u64)((char *)&F_rt_2ewait4)))((u32)t__2e1819, (u64)t_binding_2e1587, (u32)((u64)0UL), (u64)t__2e1820);
+	goto L__2e1764;
+	L__2e1821:;
+	L__2e1764:;
+	L__2e1610:;
+	t__2e1827 = (u64)(u32)(*(i32 *)t_binding_2e1587);
+	t__2e1826 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_rt_2ewifexited)))((u32)t__2e1827));
+	t__2e1829 = (u64)(u32)((u8)t__2e1826);
+	t__2e1828 = (u64)(u32)(((u32)t__2e1829 == (u32)((u64)0UL)));
+	t__2e1830 = (u64)(u32)((u8)t__2e1828);
+	if ((u32)t__2e1830) goto L_true_2e1823; else goto L_false_2e1824;
+	L_true_2e1823:;
+	t__2e1836 = (u64)(u32)(*(i32 *)t_binding_2e1587);
+	t__2e1835 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_rt_2ewifsignaled)))((u32)t__2e1836));
+	if ((u32)t__2e1835) goto L_passed_2e1834; else goto L_failed_2e1833;
+	L_failed_2e1833:;
+	t_abortsite_2e1598 = ((u64)3UL);
+	goto L_abort_2e1599;
+	L_passed_2e1834:;
+	BLIT(t_binding_2e1837, ((u64)((char *)&D_strliteral_2e1839)), ((u64)24UL));
+	BLIT((u64)B24, t_binding_2e1837, 24);
+	t__2e1841 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B24));
+	t__2e1842 = (u64)((u64)t_binding_2e1837 + (u64)((u64)8UL));
+	t__2e1843 = (u64)((u64)t_binding_2e1837 + (u64)((u64)16UL));
+	t__2e1844 = (u64)(*(u64 *)t__2e1842);
+	t__2e1840 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1841, (u64)t__2e1844));
+	t__2e1847 = (u64)(u32)(*(i32 *)t_binding_2e1587);
+	t__2e1846 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_rt_2ewtermsig)))((u32)t__2e1847));
+	t__2e1845 = ((u64 (*)(u64, u32))((u64)((char *)&F_rt_2eitos)))((u64)R25, (u32)t__2e1846);
+	BLIT(t_binding_2e1837, t__2e1845, ((u64)24UL));
+	BLIT((u64)B26, t_binding_2e1837, 24);
+	t__2e1849 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B26));
+	t__2e1850 = (u64)((u64)t_binding_2e1837 + (u64)((u64)8UL));
+	t__2e1851 = (u64)((u64)t_binding_2e1837 + (u64)((u64)16UL));
+	t__2e1852 = (u64)(*(u64 *)t__2e1850);
+	t__2e1848 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1849, (u64)t__2e1852));
+	BLIT((u64)B27, ((u64)((char *)&D_strliteral_2e1856)), 24);
+	t__2e1854 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B27));
+	t__2e1853 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1854, (u64)((u64)1UL)));
+	*(u32 *)t_object_2e1857 = (u32)((u64)583903339UL);
+	BLIT(__rp, t_object_2e1857, 4); return __rp;
+	L__2e1858:;
+	L__2e1831:;
+	L__2e1859:;
+	L_false_2e1824:;
+	L__2e1825:;
+	t_tag_2e1861 = (u64)(*(u32 *)t_expected);
+	t__2e1869 = (u64)(u32)(((u32)t_tag_2e1861 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1869) goto L_member_2e1866; else goto L__2e1868;
+	L__2e1868:;
+	t__2e1871 = (u64)(u32)(((u32)t_tag_2e1861 == (u32)((u64)3532310079UL)));
+	if ((u32)t__2e1871) goto L_member_2e1867; else goto L__2e1870;
+	L__2e1870:;
+	goto L__2e1863;
+	L_member_2e1866:;
+	goto L_matches_2e1864;
+	L_member_2e1867:;
+	goto L_matches_2e1865;
+	L_matches_2e1864:;
+	goto L__2e1872;
+	L__2e1874:;
+	L__2e1872:;
+	goto L__2e1862;
+	L_matches_2e1865:;
+	t__2e1876 = (u64)((u64)t_expected + (u64)((u64)4UL));
+	t__2e1877 = (u64)(u32)(*(i32 *)t__2e1876);
+	*(u32 *)t_binding_2e1875 = (u32)t__2e1877;
+	t__2e1882 = (u64)(u32)(*(i32 *)t_binding_2e1587);
+	t__2e1881 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_rt_2ewexitstatus)))((u32)t__2e1882));
+	*(u32 *)t_binding_2e1880 = (u32)t__2e1881;
+	t__2e1888 = (u64)(u32)(*(i32 *)t_binding_2e1880);
+	t__2e1889 = (u64)(u32)t__2e1888;
+	t__2e1890 = (u64)(u32)(*(i32 *)t_binding_2e1875);
+	t__2e1887 = (u64)(u32)(((u32)t__2e1889 != (u32)t__2e1890));
+	t__2e1891 = (u64)(u32)((u8)t__2e1887);
+	if ((u32)t__2e1891) goto L_true_2e1884; else goto L_false_2e1885;
+	L_true_2e1884:;
+	BLIT(t_binding_2e1894, ((u64)((char *)&D_strliteral_2e1896)), ((u64)24UL));
+	BLIT((u64)B28, t_binding_2e1894, 24);
+	t__2e1898 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B28));
+	t__2e1899 = (u64)((u64)t_binding_2e1894 + (u64)((u64)8UL));
+	t__2e1900 = (u64)((u64)t_binding_2e1894 + (u64)((u64)16UL));
+	t__2e1901 = (u64)(*(u64 *)t__2e1899);
+	t__2e1897 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1898, (u64)t__2e1901));
+	t__2e1903 = (u64)(u32)(*(i32 *)t_binding_2e1875);
+	t__2e1904 = (u64)(u32)t__2e1903;
+	t__2e1902 = ((u64 (*)(u64, u32))((u64)((char *)&F_rt_2estrstatus)))((u64)R29, (u32)t__2e1904);
+	BLIT(t_binding_2e1894, t__2e1902, ((u64)24UL));
+	BLIT((u64)B30, t_binding_2e1894, 24);
+	t__2e1906 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B30));
+	t__2e1907 = (u64)((u64)t_binding_2e1894 + (u64)((u64)8UL));
+	t__2e1908 = (u64)((u64)t_binding_2e1894 + (u64)((u64)16UL));
+	t__2e1909 = (u64)(*(u64 *)t__2e1907);
+	t__2e1905 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1906, (u64)t__2e1909));
+	BLIT(t_binding_2e1894, ((u64)((char *)&D_strliteral_2e1911)), ((u64)24UL));
+	BLIT((u64)B31, t_binding_2e1894, 24);
+	t__2e1913 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B31));
+	t__2e1914 = (u64)((u64)t_binding_2e1894 + (u64)((u64)8UL));
+	t__2e1915 = (u64)((u64)t_binding_2e1894 + (u64)((u64)16UL));
+	t__2e1916 = (u64)(*(u64 *)t__2e1914);
+	t__2e1912 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1913, (u64)t__2e1916));
+	t__2e1918 = (u64)(u32)(*(i32 *)t_binding_2e1880);
+	t__2e1917 = ((u64 (*)(u64, u32))((u64)((char *)&F_rt_2estrstatus)))((u64)R32, (u32)t__2e1918);
+	BLIT(t_binding_2e1894, t__2e1917, ((u64)24UL));
+	BLIT((u64)B33, t_binding_2e1894, 24);
+	t__2e1920 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B33));
+	t__2e1921 = (u64)((u64)t_binding_2e1894 + (u64)((u64)8UL));
+	t__2e1922 = (u64)((u64)t_binding_2e1894 + (u64)((u64)16UL));
+	t__2e1923 = (u64)(*(u64 *)t__2e1921);
+	t__2e1919 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1920, (u64)t__2e1923));
+	BLIT((u64)B34, ((u64)((char *)&D_strliteral_2e1856)), 24);
+	t__2e1925 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B34));
+	t__2e1924 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1925, (u64)((u64)1UL)));
+	*(u32 *)t_object_2e1926 = (u32)((u64)583903339UL);
+	BLIT(__rp, t_object_2e1926, 4); return __rp;
+	L__2e1927:;
+	L__2e1892:;
+	L__2e1928:;
+	L_false_2e1885:;
+	L__2e1886:;
+	goto L__2e1878;
+	L__2e1929:;
+	L__2e1878:;
+	goto L__2e1862;
+	L__2e1863:;
+	t_abortsite_2e1598 = ((u64)4UL);
+	goto L_abort_2e1930;
+	L__2e1862:;
+	goto L__2e1585;
+	L__2e1936:;
+	L__2e1585:;
+	BLIT(__rp, t_object_2e1584, 4); return __rp;
+	L_abort_2e1599:;
+	t__2e1600 = (u64)((u64)t_abortsite_2e1598 * (u64)((u64)16UL));
+	t__2e1600 = (u64)((u64)((u64)((char *)&D_abortsites_2e1597)) + (u64)t__2e1600);
+	t__2e1601 = (u64)(*(u64 *)t__2e1600);
+	t__2e1602 = (u64)((u64)t__2e1600 + (u64)((u64)8UL));
+	t__2e1603 = (u64)(*(u32 *)t__2e1602);
+	t__2e1602 = (u64)((u64)t__2e1600 + (u64)((u64)12UL));
+	t__2e1604 = (u64)(*(u32 *)t__2e1602);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e1601, (u64)t__2e1603, (u64)t__2e1604, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1721:;
+	t__2e1722 = (u64)((u64)t_abortsite_2e1598 * (u64)((u64)16UL));
+	t__2e1722 = (u64)((u64)((u64)((char *)&D_abortsites_2e1597)) + (u64)t__2e1722);
+	t__2e1723 = (u64)(*(u64 *)t__2e1722);
+	t__2e1724 = (u64)((u64)t__2e1722 + (u64)((u64)8UL));
+	t__2e1725 = (u64)(*(u32 *)t__2e1724);
+	t__2e1724 = (u64)((u64)t__2e1722 + (u64)((u64)12UL));
+	t__2e1726 = (u64)(*(u32 *)t__2e1724);
+	t_cleanup_2e1727 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e1728;
+	L_resume_2e1729:;
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e1723, (u64)t__2e1725, (u64)t__2e1726, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1754:;
+	t__2e1755 = (u64)((u64)t_abortsite_2e1598 * (u64)((u64)16UL));
+	t__2e1755 = (u64)((u64)((u64)((char *)&D_abortsites_2e1597)) + (u64)t__2e1755);
+	t__2e1756 = (u64)(*(u64 *)t__2e1755);
+	t__2e1757 = (u64)((u64)t__2e1755 + (u64)((u64)8UL));
+	t__2e1758 = (u64)(*(u32 *)t__2e1757);
+	t__2e1757 = (u64)((u64)t__2e1755 + (u64)((u64)12UL));
+	t__2e1759 = (u64)(*(u32 *)t__2e1757);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e1756, (u64)t__2e1758, (u64)t__2e1759, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e1930:;
+	t__2e1931 = (u64)((u64)t_abortsite_2e1598 * (u64)((u64)16UL));
+	t__2e1931 = (u64)((u64)((u64)((char *)&D_abortsites_2e1597)) + (u64)t__2e1931);
+	t__2e1932 = (u64)(*(u64 *)t__2e1931);
+	t__2e1933 = (u64)((u64)t__2e1931 + (u64)((u64)8UL));
+	t__2e1934 = (u64)(*(u32 *)t__2e1933);
+	t__2e1933 = (u64)((u64)t__2e1931 + (u64)((u64)12UL));
+	t__2e1935 = (u64)(*(u32 *)t__2e1933);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e1932, (u64)t__2e1934, (u64)t__2e1935, (u64)((u64)4UL));
+	__builtin_trap();
+}
+void F_rt_2eabort__fixed(u64 p_path, u64 p_line, u64 p_col, u64 p_i) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	u64 t__2e1945;
+	u64 t__2e1946;
+	u64 t__2e1947;
+	u64 t__2e1948;
+	u64 t__2e1950;
+	u64 t__2e1951;
+	u64 t__2e1952;
+	u64 t__2e1958;
+	u64 t__2e1959;
+	u64 t__2e1960;
+	u64 t__2e1961;
+	u64 t__2e1962;
+	u64 t_abortsite_2e1956;
+	u64 t_col;
+	u64 t_i;
+	u64 t_line;
+	u64 t_param_2e1938;
+	u64 t_param_2e1939;
+	u64 t_param_2e1940;
+	u64 t_param_2e1941;
+	u64 t_path;
+	t_path = (u64)p_path;
+	t_line = (u64)p_line;
+	t_col = (u64)p_col;
+	t_i = (u64)p_i;
+	L_start_2e1937:;
+	t_param_2e1938 = (u64)A0;
+	t_param_2e1939 = (u64)A1;
+	t_param_2e1940 = (u64)A2;
+	t_param_2e1941 = (u64)A3;
+	*(u64 *)t_param_2e1938 = (u64)t_path;
+	*(u64 *)t_param_2e1939 = (u64)t_line;
+	*(u64 *)t_param_2e1940 = (u64)t_col;
+	*(u64 *)t_param_2e1941 = (u64)t_i;
+	L_body_2e1942:;
+	t__2e1945 = (u64)(*(u64 *)t_param_2e1938);
+	t__2e1946 = (u64)(*(u64 *)t_param_2e1939);
+	t__2e1947 = (u64)(*(u64 *)t_param_2e1940);
+	t__2e1950 = (u64)(*(u64 *)t_param_2e1941);
+	t__2e1951 = t__2e1950;
+	t__2e1948 = (u64)((u64)t__2e1951 * (u64)((u64)24UL));
+	t__2e1948 = (u64)((u64)((u64)((char *)&D_rt_2ereasons)) + (u64)t__2e1948);
+	t__2e1952 = (u64)(u32)(((u64)t__2e1951 < (u64)((u64)8UL)));
+	if ((u32)t__2e1952) goto L__2e1954; else goto L__2e1953;
+	L__2e1953:;
+	t_abortsite_2e1956 = ((u64)0UL);
+	goto L_abort_2e1957;
+	L__2e1954:;
+	BLIT((u64)B4, t__2e1948, 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)t__2e1945, (u64)t__2e1946, (u64)t__2e1947, (u64)B4);
+	goto L__2e1943;
+	L__2e1963:;
+	L__2e1943:;
+	return;
+	L_abort_2e1957:;
+	t__2e1958 = (u64)((u64)t_abortsite_2e1956 * (u64)((u64)16UL));
+	t__2e1958 = (u64)((u64)((u64)((char *)&D_abortsites_2e1955)) + (u64)t__2e1958);
+	t__2e1959 = (u64)(*(u64 *)t__2e1958);
+	t__2e1960 = (u64)((u64)t__2e1958 + (u64)((u64)8UL));
+	t__2e1961 = (u64)(*(u32 *)t__2e1960);
+	t__2e1960 = (u64)((u64)t__2e1958 + (u64)((u64)12UL));
+	t__2e1962 = (u64)(*(u32 *)t__2e1960);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e1959, (u64)t__2e1961, (u64)t__2e1962, (u64)((u64)0UL));
+	__builtin_trap();
+}
+void F_rt_2eabort(u64 p_path, u64 p_line, u64 p_col, u64 p_msg) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char R9[16] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[16] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	u64 t__2e1981;
+	u64 t__2e1982;
+	u64 t__2e1983;
+	u64 t__2e1984;
+	u64 t__2e1985;
+	u64 t__2e1986;
+	u64 t__2e1987;
+	u64 t__2e1988;
+	u64 t__2e1989;
+	u64 t__2e1990;
+	u64 t__2e1991;
+	u64 t__2e1992;
+	u64 t__2e1993;
+	u64 t__2e1994;
+	u64 t__2e1995;
+	u64 t__2e1996;
+	u64 t__2e1997;
+	u64 t__2e1998;
+	u64 t__2e2000;
+	u64 t__2e2003;
+	u64 t__2e2004;
+	u64 t__2e2005;
+	u64 t__2e2006;
+	u64 t__2e2007;
+	u64 t__2e2008;
+	u64 t__2e2009;
+	u64 t__2e2010;
+	u64 t__2e2011;
+	u64 t__2e2012;
+	u64 t__2e2015;
+	u64 t__2e2016;
+	u64 t__2e2017;
+	u64 t__2e2018;
+	u64 t__2e2019;
+	u64 t__2e2020;
+	u64 t__2e2021;
+	u64 t__2e2022;
+	u64 t__2e2023;
+	u64 t__2e2024;
+	u64 t__2e2025;
+	u64 t__2e2026;
+	u64 t__2e2027;
+	u64 t__2e2028;
+	u64 t__2e2029;
+	u64 t__2e2030;
+	u64 t__2e2031;
+	u64 t_binding_2e1971;
+	u64 t_binding_2e1975;
+	u64 t_binding_2e1978;
+	u64 t_binding_2e2001;
+	u64 t_binding_2e2002;
+	u64 t_binding_2e2013;
+	u64 t_binding_2e2014;
+	u64 t_col;
+	u64 t_line;
+	u64 t_msg;
+	u64 t_param_2e1965;
+	u64 t_param_2e1966;
+	u64 t_param_2e1967;
+	u64 t_path;
+	t_path = (u64)p_path;
+	t_line = (u64)p_line;
+	t_col = (u64)p_col;
+	t_msg = p_msg;
+	L_start_2e1964:;
+	t_param_2e1965 = (u64)A0;
+	t_param_2e1966 = (u64)A1;
+	t_param_2e1967 = (u64)A2;
+	t_binding_2e1971 = (u64)A3;
+	t_binding_2e1975 = (u64)A4;
+	t_binding_2e1978 = (u64)A5;
+	*(u64 *)t_param_2e1965 = (u64)t_path;
+	*(u64 *)t_param_2e1966 = (u64)t_line;
+	*(u64 *)t_param_2e1967 = (u64)t_col;
+	L_body_2e1968:;
+	BLIT(t_binding_2e1971, ((u64)((char *)&D_strliteral_2e1973)), ((u64)24UL));
+	BLIT(t_binding_2e1975, ((u64)((char *)&D_strliteral_2e1977)), ((u64)24UL));
+	BLIT(t_binding_2e1978, ((u64)((char *)&D_strliteral_2e1980)), ((u64)24UL));
+	BLIT((u64)B6, t_binding_2e1971, 24);
+	t__2e1982 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B6));
+	t__2e1983 = (u64)((u64)t_binding_2e1971 + (u64)((u64)8UL));
+	t__2e1984 = (u64)((u64)t_binding_2e1971 + (u64)((u64)16UL));
+	t__2e1985 = (u64)(*(u64 *)t__2e1983);
+	t__2e1981 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1982, (u64)t__2e1985));
+	t__2e1988 = (u64)(*(u64 *)t_param_2e1965);
+	BLIT((u64)B7, t__2e1988, 24);
+	t__2e1987 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B7));
+	t__2e1989 = (u64)(*(u64 *)t_param_2e1965);
+	t__2e1990 = (u64)((u64)t__2e1989 + (u64)((u64)8UL));
+	t__2e1991 = (u64)((u64)t__2e1989 + (u64)((u64)16UL));
+	t__2e1992 = (u64)(*(u64 *)t__2e1990);
+	t__2e1986 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1987, (u64)t__2e1992));
+	BLIT((u64)B8, t_binding_2e1975, 24);
+	t__2e1994 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B8));
+	t__2e1995 = (u64)((u64)t_binding_2e1975 + (u64)((u64)8UL));
+	t__2e1996 = (u64)((u64)t_binding_2e1975 + (u64)((u64)16UL));
+	t__2e1997 = (u64)(*(u64 *)t__2e1995);
+	t__2e1993 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1994, (u64)t__2e1997));
+	t__2e2000 = (u64)(*(u64 *)t_param_2e1966);
+	t__2e1998 = ((u64 (*)(u64, u64))((u64)((char *)&F_rt_2eu64tos)))((u64)R9, (u64)t__2e2000);
+	t_binding_2e2001 = (u64)((u64)t__2e1998 + (u64)((u64)0UL));
+	t_binding_2e2002 = (u64)((u64)t__2e1998 + (u64)((u64)8UL));
+	t__2e2004 = (u64)(*(u64 *)t_binding_2e2001);
+	t__2e2005 = (u64)(*(u64 *)t_binding_2e2002);
+	t__2e2003 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e2004, (u64)t__2e2005));
+	BLIT((u64)B10, t_binding_2e1975, 24);
+	t__2e2007 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B10));
+	t__2e2008 = (u64)((u64)t_binding_2e1975 + (u64)((u64)8UL));
+	t__2e2009 = (u64)((u64)t_binding_2e1975 + (u64)((u64)16UL));
+	t__2e2010 = (u64)(*(u64 *)t__2e2008);
+	t__2e2006 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e2007, (u64)t__2e2010));
+	t__2e2012 = (u64)(*(u64 *)t_param_2e1967);
+	t__2e2011 = ((u64 (*)(u64, u64))((u64)((char *)&F_rt_2eu64tos)))((u64)R11, (u64)t__2e2012);
+	t_binding_2e2013 = (u64)((u64)t__2e2011 + (u64)((u64)0UL));
+	t_binding_2e2014 = (u64)((u64)t__2e2011 + (u64)((u64)8UL));
+	t__2e2016 = (u64)(*(u64 *)t_binding_2e2013);
+	t__2e2017 = (u64)(*(u64 *)t_binding_2e2014);
+	t__2e2015 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e2016, (u64)t__2e2017));
+	BLIT((u64)B12, t_binding_2e1978, 24);
+	t__2e2019 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B12));
+	t__2e2020 = (u64)((u64)t_binding_2e1978 + (u64)((u64)8UL));
+	t__2e2021 = (u64)((u64)t_binding_2e1978 + (u64)((u64)16UL));
+	t__2e2022 = (u64)(*(u64 *)t__2e2020);
+	t__2e2018 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e2019, (u64)t__2e2022));
+	BLIT((u64)B13, t_msg, 24);
+	t__2e2024 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B13));
+	t__2e2025 = (u64)((u64)t_msg + (u64)((u64)8UL));
+	t__2e2026 = (u64)((u64)t_msg + (u64)((u64)16UL));
+	t__2e2027 = (u64)(*(u64 *)t__2e2025);
+	t__2e2023 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e2024, (u64)t__2e2027));
+	BLIT((u64)B14, ((u64)((char *)&D_strliteral_2e1856)), 24);
+	t__2e2029 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B14));
+	t__2e2028 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e2029, (u64)((u64)1UL)));
+	t__2e2031 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_rt_2egetpid)))());
+	t__2e2030 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rt_2ekill)))((u32)t__2e2031, (u32)((u64)6UL)));
+	goto L__2e1969;
+	L__2e2032:;
+	L__2e1969:;
+	return;
+}
+static u64 F_rt_2eu64tos(u64 __rp, u64 p_u) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[1] __attribute__((aligned(16)));
+	char A5[16] __attribute__((aligned(16)));
+	u64 t__2e2040;
+	u64 t__2e2041;
+	u64 t__2e2042;
+	u64 t__2e2043;
+	u64 t__2e2046;
+	u64 t__2e2052;
+	u64 t__2e2053;
+	u64 t__2e2054;
+	u64 t__2e2055;
+	u64 t__2e2056;
+	u64 t__2e2058;
+	u64 t__2e2063;
+	u64 t__2e2064;
+	u64 t__2e2065;
+	u64 t__2e2068;
+	u64 t__2e2069;
+	u64 t__2e2070;
+	u64 t__2e2071;
+	u64 t__2e2072;
+	u64 t__2e2073;
+	u64 t__2e2076;
+	u64 t__2e2077;
+	u64 t__2e2078;
+	u64 t__2e2085;
+	u64 t__2e2086;
+	u64 t__2e2089;
+	u64 t__2e2090;
+	u64 t__2e2091;
+	u64 t__2e2092;
+	u64 t__2e2093;
+	u64 t__2e2094;
+	u64 t__2e2095;
+	u64 t__2e2096;
+	u64 t__2e2097;
+	u64 t__2e2098;
+	u64 t__2e2101;
+	u64 t__2e2102;
+	u64 t__2e2103;
+	u64 t__2e2104;
+	u64 t__2e2113;
+	u64 t__2e2114;
+	u64 t__2e2115;
+	u64 t__2e2116;
+	u64 t__2e2117;
+	u64 t__2e2118;
+	u64 t__2e2119;
+	u64 t__2e2123;
+	u64 t__2e2124;
+	u64 t__2e2125;
+	u64 t__2e2126;
+	u64 t__2e2127;
+	u64 t__2e2128;
+	u64 t__2e2129;
+	u64 t__2e2132;
+	u64 t__2e2133;
+	u64 t__2e2134;
+	u64 t__2e2135;
+	u64 t__2e2136;
+	u64 t__2e2137;
+	u64 t__2e2138;
+	u64 t__2e2139;
+	u64 t__2e2140;
+	u64 t__2e2141;
+	u64 t__2e2142;
+	u64 t__2e2143;
+	u64 t__2e2144;
+	u64 t__2e2147;
+	u64 t__2e2148;
+	u64 t__2e2149;
+	u64 t__2e2150;
+	u64 t__2e2151;
+	u64 t__2e2152;
+	u64 t__2e2153;
+	u64 t__2e2154;
+	u64 t__2e2157;
+	u64 t__2e2158;
+	u64 t__2e2159;
+	u64 t__2e2163;
+	u64 t__2e2164;
+	u64 t__2e2165;
+	u64 t__2e2166;
+	u64 t_abortsite_2e2050;
+	u64 t_binding_2e2038;
+	u64 t_binding_2e2111;
+	u64 t_binding_2e2112;
+	u64 t_binding_2e2122;
+	u64 t_data_2e2057;
+	u64 t_object_2e2161;
+	u64 t_param_2e2034;
+	u64 t_u;
+	u64 t_value_2e2162;
+	t_u = (u64)p_u;
+	L_start_2e2033:;
+	t_param_2e2034 = (u64)A0;
+	t_binding_2e2038 = (u64)A1;
+	t_binding_2e2111 = (u64)A2;
+	t_binding_2e2112 = (u64)A3;
+	t_binding_2e2122 = (u64)A4;
+	t_object_2e2161 = (u64)A5;
+	*(u64 *)t_param_2e2034 = (u64)t_u;
+	L_body_2e2035:;
+	t__2e2040 = ((u64)((char *)&D_static_2e2));
+	t__2e2041 = (u64)((i64)(i32)((u64)0UL));
+	t__2e2042 = (u64)((u64)t__2e2041 - (u64)((u64)0UL));
+	t__2e2046 = (u64)(u32)(((u64)t__2e2041 <= (u64)((u64)20UL)));
+	t__2e2042 = t__2e2041;
+	t__2e2043 = ((u64)20UL);
+	if ((u32)t__2e2046) goto L__2e2048; else goto L__2e2047;
+	L__2e2047:;
+	t_abortsite_2e2050 = ((u64)0UL);
+	goto L_abort_2e2051;
+	L__2e2048:;
+	t_data_2e2057 = (u64)((u64)((u64)0UL) * (u64)((u64)1UL));
+	t_data_2e2057 = (u64)((u64)t__2e2040 + (u64)t_data_2e2057);
+	*(u64 *)t_binding_2e2038 = (u64)t_data_2e2057;
+	t__2e2058 = (u64)((u64)t_binding_2e2038 + (u64)((u64)8UL));
+	*(u64 *)t__2e2058 = (u64)t__2e2042;
+	t__2e2058 = (u64)((u64)t_binding_2e2038 + (u64)((u64)16UL));
+	*(u64 *)t__2e2058 = (u64)t__2e2043;
+	t__2e2064 = (u64)(*(u64 *)t_param_2e2034);
+	t__2e2063 = (u64)(u32)(((u64)t__2e2064 == (u64)((u64)0UL)));
+	t__2e2065 = (u64)(u32)((u8)t__2e2063);
+	if ((u32)t__2e2065) goto L_true_2e2060; else goto L_false_2e2061;
+	L_true_2e2060:;
+	t__2e2068 = (u64)((u64)t_binding_2e2038 + (u64)((u64)8UL));
+	t__2e2069 = (u64)((u64)t_binding_2e2038 + (u64)((u64)16UL));
+	t__2e2070 = (u64)(*(u64 *)t__2e2068);
+	t__2e2071 = (u64)((u64)t__2e2070 + (u64)((u64)1UL));
+	*(u64 *)t__2e2068 = (u64)t__2e2071;
+	t__2e2073 = (u64)(*(u64 *)t__2e2069);
+	t__2e2076 = (u64)(u32)(((u64)t__2e2071 <= (u64)t__2e2073));
+	if ((u32)t__2e2076) goto L__2e2074; else goto L__2e2075;
+	L__2e2075:;
+	t_abortsite_2e2050 = ((u64)1UL);
+	goto L_abort_2e2051;
+	L__2e2074:;
+	t__2e2077 = (u64)(*(u64 *)t_binding_2e2038);
+	t__2e2072 = (u64)((u64)t__2e2070 * (u64)((u64)1UL));
+	t__2e2072 = (u64)((u64)t__2e2077 + (u64)t__2e2072);
+	t__2e2078 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	*(u8 *)t__2e2072 = (u8)((u64)48UL);
+	goto L__2e2066;
+	L__2e2079:;
+	L__2e2066:;
+	goto L__2e2062;
+	L_false_2e2061:;
+	L__2e2062:;
+	L_loop_2e2080:;
+	t__2e2086 = (u64)(*(u64 *)t_param_2e2034);
+	t__2e2085 = (u64)(u32)(((u64)t__2e2086 > (u64)((u64)0UL)));
+	if ((u32)t__2e2085) goto L_body_2e2081; else goto L__2e2083;
+	L_body_2e2081:;
+	t__2e2089 = (u64)((u64)t_binding_2e2038 + (u64)((u64)8UL));
+	t__2e2090 = (u64)((u64)t_binding_2e2038 + (u64)((u64)16UL));
+	t__2e2091 = (u64)(*(u64 *)t__2e2089);
+	t__2e2094 = (u64)(*(u64 *)t_param_2e2034);
+	t__2e2093 = (u64)((u64)t__2e2094 % (u64)((u64)10UL));
+	t__2e2095 = (u64)(u32)t__2e2093;
+	t__2e2092 = (u64)(u32)((u32)t__2e2095 + (u32)((u64)48UL));
+	t__2e2096 = (u64)((u64)t__2e2091 + (u64)((u64)1UL));
+	*(u64 *)t__2e2089 = (u64)t__2e2096;
+	t__2e2098 = (u64)(*(u64 *)t__2e2090);
+	t__2e2101 = (u64)(u32)(((u64)t__2e2096 <= (u64)t__2e2098));
+	if ((u32)t__2e2101) goto L__2e2099; else goto L__2e2100;
+	L__2e2100:;
+	t_abortsite_2e2050 = ((u64)2UL);
+	goto L_abort_2e2051;
+	L__2e2099:;
+	t__2e2102 = (u64)(*(u64 *)t_binding_2e2038);
+	t__2e2097 = (u64)((u64)t__2e2091 * (u64)((u64)1UL));
+	t__2e2097 = (u64)((u64)t__2e2102 + (u64)t__2e2097);
+	t__2e2103 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	*(u8 *)t__2e2097 = (u8)t__2e2092;
+	t__2e2104 = (u64)(*(u64 *)t_param_2e2034);
+	t__2e2104 = (u64)((u64)t__2e2104 / (u64)((u64)10UL));
+	*(u64 *)t_param_2e2034 = (u64)t__2e2104;
+	goto L__2e2087;
+	L__2e2105:;
+	L__2e2087:;
+	L_after_2e2084:;
+	goto L_loop_2e2080;
+	L__2e2083:;
+	*(u64 *)t_binding_2e2111 = (u64)((u64)0UL);
+	t__2e2114 = (u64)((u64)t_binding_2e2038 + (u64)((u64)8UL));
+	t__2e2115 = (u64)((u64)t_binding_2e2038 + (u64)((u64)16UL));
+	t__2e2116 = (u64)(*(u64 *)t__2e2114);
+	t__2e2113 = (u64)((u64)t__2e2116 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e2112 = (u64)t__2e2113;
+	L_loop_2e2106:;
+	t__2e2118 = (u64)(*(u64 *)t_binding_2e2111);
+	t__2e2119 = (u64)(*(u64 *)t_binding_2e2112);
+	t__2e2117 = (u64)(u32)(((u64)t__2e2118 < (u64)t__2e2119));
+	if ((u32)t__2e2117) goto L_body_2e2107; else goto L__2e2109;
+	L_body_2e2107:;
+	t__2e2124 = (u64)((u64)t_binding_2e2038 + (u64)((u64)8UL));
+	t__2e2125 = (u64)((u64)t_binding_2e2038 + (u64)((u64)16UL));
+	t__2e2126 = (u64)(*(u64 *)t_binding_2e2038);
+	t__2e2127 = (u64)(*(u64 *)t__2e2124);
+	t__2e2128 = (u64)(*(u64 *)t_binding_2e2111);
+	t__2e2123 = (u64)((u64)t__2e2128 * (u64)((u64)1UL));
+	t__2e2123 = (u64)((u64)t__2e2126 + (u64)t__2e2123);
+	t__2e2129 = (u64)(u32)(((u64)t__2e2128 < (u64)t__2e2127));
+	if ((u32)t__2e2129) goto L__2e2131; else goto L__2e2130;
+	L__2e2130:;
+	t_abortsite_2e2050 = ((u64)3UL);
+	goto L_abort_2e2051;
+	L__2e2131:;
+	t__2e2132 = (u64)(u32)(*(u8 *)t__2e2123);
+	*(u8 *)t_binding_2e2122 = (u8)t__2e2132;
+	t__2e2134 = (u64)((u64)t_binding_2e2038 + (u64)((u64)8UL));
+	t__2e2135 = (u64)((u64)t_binding_2e2038 + (u64)((u64)16UL));
+	t__2e2136 = (u64)(*(u64 *)t_binding_2e2038);
+	t__2e2137 = (u64)(*(u64 *)t_binding_2e2111);
+	t__2e2133 = (u64)((u64)t__2e2137 * (u64)((u64)1UL));
+	t__2e2133 = (u64)((u64)t__2e2136 + (u64)t__2e2133);
+	t__2e2139 = (u64)((u64)t_binding_2e2038 + (u64)((u64)8UL));
+	t__2e2140 = (u64)((u64)t_binding_2e2038 + (u64)((u64)16UL));
+	t__2e2141 = (u64)(*(u64 *)t_binding_2e2038);
+	t__2e2142 = (u64)(*(u64 *)t__2e2139);
+	t__2e2143 = (u64)(*(u64 *)t_binding_2e2112);
+	t__2e2138 = (u64)((u64)t__2e2143 * (u64)((u64)1UL));
+	t__2e2138 = (u64)((u64)t__2e2141 + (u64)t__2e2138);
+	t__2e2144 = (u64)(u32)(((u64)t__2e2143 < (u64)t__2e2142));
+	if ((u32)t__2e2144) goto L__2e2146; else goto L__2e2145;
+	L__2e2145:;
+	t_abortsite_2e2050 = ((u64)4UL);
+	goto L_abort_2e2051;
+	L__2e2146:;
+	t__2e2147 = (u64)(u32)(*(u8 *)t__2e2138);
+	*(u8 *)t__2e2133 = (u8)t__2e2147;
+	t__2e2149 = (u64)((u64)t_binding_2e2038 + (u64)((u64)8UL));
+	t__2e2150 = (u64)((u64)t_binding_2e2038 + (u64)((u64)16UL));
+	t__2e2151 = (u64)(*(u64 *)t_binding_2e2038);
+	t__2e2152 = (u64)(*(u64 *)t__2e2149);
+	t__2e2153 = (u64)(*(u64 *)t_binding_2e2112);
+	t__2e2148 = (u64)((u64)t__2e2153 * (u64)((u64)1UL));
+	t__2e2148 = (u64)((u64)t__2e2151 + (u64)t__2e2148);
+	t__2e2154 = (u64)(u32)(((u64)t__2e2153 < (u64)t__2e2152));
+	if ((u32)t__2e2154) goto L__2e2156; else goto L__2e2155;
+	L__2e2155:;
+	t_abortsite_2e2050 = ((u64)5UL);
+	goto L_abort_2e2051;
+	L__2e2156:;
+	t__2e2157 = (u64)(u32)(*(u8 *)t_binding_2e2122);
+	*(u8 *)t__2e2148 = (u8)t__2e2157;
+	t__2e2158 = (u64)(*(u64 *)t_binding_2e2111);
+	t__2e2158 = (u64)((u64)t__2e2158 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e2111 = (u64)t__2e2158;
+	t__2e2159 = (u64)(*(u64 *)t_binding_2e2112);
+	t__2e2159 = (u64)((u64)t__2e2159 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e2112 = (u64)t__2e2159;
+	goto L__2e2120;
+	L__2e2160:;
+	L__2e2120:;
+	L_after_2e2110:;
+	goto L_loop_2e2106;
+	L__2e2109:;
+	t_value_2e2162 = (u64)((u64)t_object_2e2161 + (u64)((u64)0UL));
+	t__2e2163 = (u64)(*(u64 *)t_binding_2e2038);
+	*(u64 *)t_value_2e2162 = (u64)t__2e2163;
+	t_value_2e2162 = (u64)((u64)t_object_2e2161 + (u64)((u64)8UL));
+	t__2e2164 = (u64)((u64)t_binding_2e2038 + (u64)((u64)8UL));
+	t__2e2165 = (u64)((u64)t_binding_2e2038 + (u64)((u64)16UL));
+	t__2e2166 = (u64)(*(u64 *)t__2e2164);
+	*(u64 *)t_value_2e2162 = (u64)t__2e2166;
+	BLIT(__rp, t_object_2e2161, 16); return __rp;
+	L__2e2167:;
+	L__2e2036:;
+	L__2e2168:;
+	return 0;
+	L_abort_2e2051:;
+	t__2e2052 = (u64)((u64)t_abortsite_2e2050 * (u64)((u64)16UL));
+	t__2e2052 = (u64)((u64)((u64)((char *)&D_abortsites_2e2049)) + (u64)t__2e2052);
+	t__2e2053 = (u64)(*(u64 *)t__2e2052);
+	t__2e2054 = (u64)((u64)t__2e2052 + (u64)((u64)8UL));
+	t__2e2055 = (u64)(*(u32 *)t__2e2054);
+	t__2e2054 = (u64)((u64)t__2e2052 + (u64)((u64)12UL));
+	t__2e2056 = (u64)(*(u32 *)t__2e2054);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e2053, (u64)t__2e2055, (u64)t__2e2056, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static u64 F_rt_2estrstatus(u64 __rp, u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	char R1[24] __attribute__((aligned(16)));
+	u64 t__2e2185;
+	u64 t__2e2195;
+	u64 t__2e2197;
+	u64 t__2e2199;
+	u64 t__2e2201;
+	u64 t__2e2203;
+	u64 t__2e2205;
+	u64 t__2e2207;
+	u64 t__2e2246;
+	u64 t__2e2247;
+	u64 t__2e2253;
+	u64 t__2e2254;
+	u64 t__2e2255;
+	u64 t__2e2256;
+	u64 t__2e2257;
+	u64 t_abortsite_2e2251;
+	u64 t_param_2e2178;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e2177:;
+	t_param_2e2178 = (u64)A0;
+	*(u32 *)t_param_2e2178 = (u32)t_status;
+	L_body_2e2179:;
+	t__2e2185 = (u64)(u32)(*(i32 *)t_param_2e2178);
+	t__2e2195 = (u64)(u32)(((i32)t__2e2185 < (i32)((u64)3UL)));
+	if ((u32)t__2e2195) goto L_switch_2elt_2e2193; else goto L_switch_2ege_2e2194;
+	L_switch_2elt_2e2193:;
+	t__2e2197 = (u64)(u32)(((u32)t__2e2185 == (u32)((u64)0UL)));
+	if ((u32)t__2e2197) goto L_matches_2e2186; else goto L__2e2196;
+	L__2e2196:;
+	t__2e2199 = (u64)(u32)(((u32)t__2e2185 == (u32)((u64)1UL)));
+	if ((u32)t__2e2199) goto L_matches_2e2187; else goto L__2e2198;
+	L__2e2198:;
+	t__2e2201 = (u64)(u32)(((u32)t__2e2185 == (u32)((u64)2UL)));
+	if ((u32)t__2e2201) goto L_matches_2e2188; else goto L__2e2200;
+	L__2e2200:;
+	goto L_matches_2e2192;
+	L_switch_2ege_2e2194:;
+	t__2e2203 = (u64)(u32)(((u32)t__2e2185 == (u32)((u64)3UL)));
+	if ((u32)t__2e2203) goto L_matches_2e2189; else goto L__2e2202;
+	L__2e2202:;
+	t__2e2205 = (u64)(u32)(((u32)t__2e2185 == (u32)((u64)4UL)));
+	if ((u32)t__2e2205) goto L_matches_2e2190; else goto L__2e2204;
+	L__2e2204:;
+	t__2e2207 = (u64)(u32)(((u32)t__2e2185 == (u32)((u64)255UL)));
+	if ((u32)t__2e2207) goto L_matches_2e2191; else goto L__2e2206;
+	L__2e2206:;
+	goto L_matches_2e2192;
+	L_matches_2e2186:;
+	BLIT(__rp, ((u64)((char *)&D_strliteral_2e2211)), 24); return __rp;
+	L__2e2212:;
+	L__2e2208:;
+	L__2e2213:;
+	L_matches_2e2187:;
+	BLIT(__rp, ((u64)((char *)&D_strliteral_2e2217)), 24); return __rp;
+	L__2e2218:;
+	L__2e2214:;
+	L__2e2219:;
+	L_matches_2e2188:;
+	BLIT(__rp, ((u64)((char *)&D_strliteral_2e2223)), 24); return __rp;
+	L__2e2224:;
+	L__2e2220:;
+	L__2e2225:;
+	L_matches_2e2189:;
+	BLIT(__rp, ((u64)((char *)&D_strliteral_2e2229)), 24); return __rp;
+	L__2e2230:;
+	L__2e2226:;
+	L__2e2231:;
+	L_matches_2e2190:;
+	BLIT(__rp, ((u64)((char *)&D_strliteral_2e2235)), 24); return __rp;
+	L__2e2236:;
+	L__2e2232:;
+	L__2e2237:;
+	L_matches_2e2191:;
+	BLIT(__rp, ((u64)((char *)&D_strliteral_2e2241)), 24); return __rp;
+	L__2e2242:;
+	L__2e2238:;
+	L__2e2243:;
+	L_matches_2e2192:;
+	t__2e2247 = (u64)(u32)(*(i32 *)t_param_2e2178);
+	t__2e2246 = ((u64 (*)(u64, u32))((u64)((char *)&F_rt_2eitos)))((u64)R1, (u32)t__2e2247);
+	BLIT(__rp, t__2e2246, 24); return __rp;
+	L__2e2248:;
+	L__2e2244:;
+	L__2e2249:;
+	L__2e2184:;
+	t_abortsite_2e2251 = ((u64)0UL);
+	goto L_abort_2e2252;
+	L__2e2183:;
+	L__2e2258:;
+	L__2e2180:;
+	L__2e2259:;
+	return 0;
+	L_abort_2e2252:;
+	t__2e2253 = (u64)((u64)t_abortsite_2e2251 * (u64)((u64)16UL));
+	t__2e2253 = (u64)((u64)((u64)((char *)&D_abortsites_2e2250)) + (u64)t__2e2253);
+	t__2e2254 = (u64)(*(u64 *)t__2e2253);
+	t__2e2255 = (u64)((u64)t__2e2253 + (u64)((u64)8UL));
+	t__2e2256 = (u64)(*(u32 *)t__2e2255);
+	t__2e2255 = (u64)((u64)t__2e2253 + (u64)((u64)12UL));
+	t__2e2257 = (u64)(*(u32 *)t__2e2255);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e2254, (u64)t__2e2256, (u64)t__2e2257, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u64 F_rt_2eitos(u64 __rp, u32 p_i) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[1] __attribute__((aligned(16)));
+	u64 t__2e2267;
+	u64 t__2e2268;
+	u64 t__2e2269;
+	u64 t__2e2270;
+	u64 t__2e2273;
+	u64 t__2e2279;
+	u64 t__2e2280;
+	u64 t__2e2281;
+	u64 t__2e2282;
+	u64 t__2e2283;
+	u64 t__2e2285;
+	u64 t__2e2290;
+	u64 t__2e2291;
+	u64 t__2e2292;
+	u64 t__2e2303;
+	u64 t__2e2304;
+	u64 t__2e2305;
+	u64 t__2e2306;
+	u64 t__2e2317;
+	u64 t__2e2318;
+	u64 t__2e2319;
+	u64 t__2e2322;
+	u64 t__2e2323;
+	u64 t__2e2324;
+	u64 t__2e2325;
+	u64 t__2e2326;
+	u64 t__2e2327;
+	u64 t__2e2330;
+	u64 t__2e2331;
+	u64 t__2e2332;
+	u64 t__2e2333;
+	u64 t__2e2334;
+	u64 t__2e2341;
+	u64 t__2e2342;
+	u64 t__2e2345;
+	u64 t__2e2346;
+	u64 t__2e2347;
+	u64 t__2e2348;
+	u64 t__2e2349;
+	u64 t__2e2350;
+	u64 t__2e2351;
+	u64 t__2e2352;
+	u64 t__2e2353;
+	u64 t__2e2354;
+	u64 t__2e2355;
+	u64 t__2e2356;
+	u64 t__2e2357;
+	u64 t__2e2358;
+	u64 t__2e2361;
+	u64 t__2e2362;
+	u64 t__2e2363;
+	u64 t__2e2364;
+	u64 t__2e2365;
+	u64 t__2e2366;
+	u64 t__2e2367;
+	u64 t__2e2368;
+	u64 t__2e2377;
+	u64 t__2e2378;
+	u64 t__2e2379;
+	u64 t__2e2380;
+	u64 t__2e2381;
+	u64 t__2e2382;
+	u64 t__2e2383;
+	u64 t__2e2387;
+	u64 t__2e2388;
+	u64 t__2e2389;
+	u64 t__2e2390;
+	u64 t__2e2391;
+	u64 t__2e2392;
+	u64 t__2e2393;
+	u64 t__2e2396;
+	u64 t__2e2397;
+	u64 t__2e2398;
+	u64 t__2e2399;
+	u64 t__2e2400;
+	u64 t__2e2401;
+	u64 t__2e2402;
+	u64 t__2e2403;
+	u64 t__2e2406;
+	u64 t__2e2407;
+	u64 t__2e2408;
+	u64 t__2e2409;
+	u64 t__2e2410;
+	u64 t__2e2411;
+	u64 t__2e2412;
+	u64 t__2e2415;
+	u64 t__2e2416;
+	u64 t__2e2417;
+	u64 t__2e2418;
+	u64 t__2e2419;
+	u64 t__2e2420;
+	u64 t__2e2421;
+	u64 t__2e2422;
+	u64 t__2e2425;
+	u64 t__2e2426;
+	u64 t__2e2427;
+	u64 t_abortsite_2e2277;
+	u64 t_binding_2e2265;
+	u64 t_binding_2e2375;
+	u64 t_binding_2e2376;
+	u64 t_binding_2e2386;
+	u64 t_data_2e2284;
+	u64 t_i;
+	u64 t_param_2e2261;
+	t_i = (u64)p_i;
+	L_start_2e2260:;
+	t_param_2e2261 = (u64)A0;
+	t_binding_2e2265 = (u64)A1;
+	t_binding_2e2375 = (u64)A2;
+	t_binding_2e2376 = (u64)A3;
+	t_binding_2e2386 = (u64)A4;
+	*(u32 *)t_param_2e2261 = (u32)t_i;
+	L_body_2e2262:;
+	t__2e2267 = ((u64)((char *)&D_static_2e3));
+	t__2e2268 = (u64)((i64)(i32)((u64)0UL));
+	t__2e2269 = (u64)((u64)t__2e2268 - (u64)((u64)0UL));
+	t__2e2273 = (u64)(u32)(((u64)t__2e2268 <= (u64)((u64)11UL)));
+	t__2e2269 = t__2e2268;
+	t__2e2270 = ((u64)11UL);
+	if ((u32)t__2e2273) goto L__2e2275; else goto L__2e2274;
+	L__2e2274:;
+	t_abortsite_2e2277 = ((u64)0UL);
+	goto L_abort_2e2278;
+	L__2e2275:;
+	t_data_2e2284 = (u64)((u64)((u64)0UL) * (u64)((u64)1UL));
+	t_data_2e2284 = (u64)((u64)t__2e2267 + (u64)t_data_2e2284);
+	*(u64 *)t_binding_2e2265 = (u64)t_data_2e2284;
+	t__2e2285 = (u64)((u64)t_binding_2e2265 + (u64)((u64)8UL));
+	*(u64 *)t__2e2285 = (u64)t__2e2269;
+	t__2e2285 = (u64)((u64)t_binding_2e2265 + (u64)((u64)16UL));
+	*(u64 *)t__2e2285 = (u64)t__2e2270;
+	t__2e2291 = (u64)(u32)(*(i32 *)t_param_2e2261);
+	t__2e2290 = (u64)(u32)(((u32)t__2e2291 == (u32)((u64)0UL)));
+	t__2e2292 = (u64)(u32)((u8)t__2e2290);
+	if ((u32)t__2e2292) goto L_true_2e2287; else goto L_false_2e2288;
+	L_true_2e2287:;
+	BLIT(__rp, ((u64)((char *)&D_strliteral_2e2296)), 24); return __rp;
+	L__2e2297:;
+	L__2e2293:;
+	L__2e2298:;
+	L_false_2e2288:;
+	t__2e2304 = (u64)(u32)(*(i32 *)t_param_2e2261);
+	t__2e2305 = (u64)(u32)(-(u32)((u64)2147483648UL));
+	t__2e2303 = (u64)(u32)(((u32)t__2e2304 == (u32)t__2e2305));
+	t__2e2306 = (u64)(u32)((u8)t__2e2303);
+	if ((u32)t__2e2306) goto L_true_2e2300; else goto L_false_2e2301;
+	L_true_2e2300:;
+	BLIT(__rp, ((u64)((char *)&D_strliteral_2e2310)), 24); return __rp;
+	L__2e2311:;
+	L__2e2307:;
+	L__2e2312:;
+	L_false_2e2301:;
+	L__2e2302:;
+	L__2e2289:;
+	t__2e2318 = (u64)(u32)(*(i32 *)t_param_2e2261);
+	t__2e2317 = (u64)(u32)(((i32)t__2e2318 < (i32)((u64)0UL)));
+	t__2e2319 = (u64)(u32)((u8)t__2e2317);
+	if ((u32)t__2e2319) goto L_true_2e2314; else goto L_false_2e2315;
+	L_true_2e2314:;
+	t__2e2322 = (u64)((u64)t_binding_2e2265 + (u64)((u64)8UL));
+	t__2e2323 = (u64)((u64)t_binding_2e2265 + (u64)((u64)16UL));
+	t__2e2324 = (u64)(*(u64 *)t__2e2322);
+	t__2e2325 = (u64)((u64)t__2e2324 + (u64)((u64)1UL));
+	*(u64 *)t__2e2322 = (u64)t__2e2325;
+	t__2e2327 = (u64)(*(u64 *)t__2e2323);
+	t__2e2330 = (u64)(u32)(((u64)t__2e2325 <= (u64)t__2e2327));
+	if ((u32)t__2e2330) goto L__2e2328; else goto L__2e2329;
+	L__2e2329:;
+	t_abortsite_2e2277 = ((u64)1UL);
+	goto L_abort_2e2278;
+	L__2e2328:;
+	t__2e2331 = (u64)(*(u64 *)t_binding_2e2265);
+	t__2e2326 = (u64)((u64)t__2e2324 * (u64)((u64)1UL));
+	t__2e2326 = (u64)((u64)t__2e2331 + (u64)t__2e2326);
+	t__2e2332 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	*(u8 *)t__2e2326 = (u8)((u64)45UL);
+	t__2e2333 = (u64)(u32)(*(i32 *)t_param_2e2261);
+	t__2e2334 = (u64)(u32)(-(u32)t__2e2333);
+	*(u32 *)t_param_2e2261 = (u32)t__2e2334;
+	goto L__2e2320;
+	L__2e2335:;
+	L__2e2320:;
+	goto L__2e2316;
+	L_false_2e2315:;
+	L__2e2316:;
+	L_loop_2e2336:;
+	t__2e2342 = (u64)(u32)(*(i32 *)t_param_2e2261);
+	t__2e2341 = (u64)(u32)(((i32)t__2e2342 > (i32)((u64)0UL)));
+	if ((u32)t__2e2341) goto L_body_2e2337; else goto L__2e2339;
+	L_body_2e2337:;
+	t__2e2345 = (u64)((u64)t_binding_2e2265 + (u64)((u64)8UL));
+	t__2e2346 = (u64)((u64)t_binding_2e2265 + (u64)((u64)16UL));
+	t__2e2347 = (u64)(*(u64 *)t__2e2345);
+	t__2e2350 = (u64)(u32)(*(i32 *)t_param_2e2261);
+	t__2e2351 = (u64)((i64)(i32)t__2e2350);
+	t__2e2352 = (u64)((u64)t__2e2351 * (u64)((u64)1717986919UL));
+	t__2e2353 = (u64)((i64)t__2e2352 >> (((u64)34UL) & 63));
+	t__2e2354 = (u64)((u64)t__2e2351 >> (((u64)63UL) & 63));
+	t__2e2353 = (u64)((u64)t__2e2353 + (u64)t__2e2354);
+	t__2e2353 = (u64)((u64)t__2e2353 * (u64)((u64)10UL));
+	t__2e2353 = (u64)((u64)t__2e2351 - (u64)t__2e2353);
+	t__2e2349 = (u64)(u32)t__2e2353;
+	t__2e2355 = (u64)(u32)t__2e2349;
+	t__2e2348 = (u64)(u32)((u32)t__2e2355 + (u32)((u64)48UL));
+	t__2e2356 = (u64)((u64)t__2e2347 + (u64)((u64)1UL));
+	*(u64 *)t__2e2345 = (u64)t__2e2356;
+	t__2e2358 = (u64)(*(u64 *)t__2e2346);
+	t__2e2361 = (u64)(u32)(((u64)t__2e2356 <= (u64)t__2e2358));
+	if ((u32)t__2e2361) goto L__2e2359; else goto L__2e2360;
+	L__2e2360:;
+	t_abortsite_2e2277 = ((u64)2UL);
+	goto L_abort_2e2278;
+	L__2e2359:;
+	t__2e2362 = (u64)(*(u64 *)t_binding_2e2265);
+	t__2e2357 = (u64)((u64)t__2e2347 * (u64)((u64)1UL));
+	t__2e2357 = (u64)((u64)t__2e2362 + (u64)t__2e2357);
+	t__2e2363 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	*(u8 *)t__2e2357 = (u8)t__2e2348;
+	t__2e2364 = (u64)(u32)(*(i32 *)t_param_2e2261);
+	t__2e2365 = (u64)((i64)(i32)t__2e2364);
+	t__2e2366 = (u64)((u64)t__2e2365 * (u64)((u64)1717986919UL));
+	t__2e2367 = (u64)((i64)t__2e2366 >> (((u64)34UL) & 63));
+	t__2e2368 = (u64)((u64)t__2e2365 >> (((u64)63UL) & 63));
+	t__2e2367 = (u64)((u64)t__2e2367 + (u64)t__2e2368);
+	t__2e2364 = (u64)(u32)t__2e2367;
+	*(u32 *)t_param_2e2261 = (u32)t__2e2364;
+	goto L__2e2343;
+	L__2e2369:;
+	L__2e2343:;
+	L_after_2e2340:;
+	goto L_loop_2e2336;
+	L__2e2339:;
+	*(u64 *)t_binding_2e2375 = (u64)((u64)0UL);
+	t__2e2378 = (u64)((u64)t_binding_2e2265 + (u64)((u64)8UL));
+	t__2e2379 = (u64)((u64)t_binding_2e2265 + (u64)((u64)16UL));
+	t__2e2380 = (u64)(*(u64 *)t__2e2378);
+	t__2e2377 = (u64)((u64)t__2e2380 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e2376 = (u64)t__2e2377;
+	L_loop_2e2370:;
+	t__2e2382 = (u64)(*(u64 *)t_binding_2e2375);
+	t__2e2383 = (u64)(*(u64 *)t_binding_2e2376);
+	t__2e2381 = (u64)(u32)(((u64)t__2e2382 < (u64)t__2e2383));
+	if ((u32)t__2e2381) goto L_body_2e2371; else goto L__2e2373;
+	L_body_2e2371:;
+	t__2e2388 = (u64)((u64)t_binding_2e2265 + (u64)((u64)8UL));
+	t__2e2389 = (u64)((u64)t_binding_2e2265 + (u64)((u64)16UL));
+	t__2e2390 = (u64)(*(u64 *)t_binding_2e2265);
+	t__2e2391 = (u64)(*(u64 *)t__2e2388);
+	t__2e2392 = (u64)(*(u64 *)t_binding_2e2375);
+	t__2e2387 = (u64)((u64)t__2e2392 * (u64)((u64)1UL));
+	t__2e2387 = (u64)((u64)t__2e2390 + (u64)t__2e2387);
+	t__2e2393 = (u64)(u32)(((u64)t__2e2392 < (u64)t__2e2391));
+	if ((u32)t__2e2393) goto L__2e2395; else goto L__2e2394;
+	L__2e2394:;
+	t_abortsite_2e2277 = ((u64)3UL);
+	goto L_abort_2e2278;
+	L__2e2395:;
+	t__2e2396 = (u64)(u32)(*(u8 *)t__2e2387);
+	*(u8 *)t_binding_2e2386 = (u8)t__2e2396;
+	t__2e2398 = (u64)((u64)t_binding_2e2265 + (u64)((u64)8UL));
+	t__2e2399 = (u64)((u64)t_binding_2e2265 + (u64)((u64)16UL));
+	t__2e2400 = (u64)(*(u64 *)t_binding_2e2265);
+	t__2e2401 = (u64)(*(u64 *)t__2e2398);
+	t__2e2402 = (u64)(*(u64 *)t_binding_2e2375);
+	t__2e2397 = (u64)((u64)t__2e2402 * (u64)((u64)1UL));
+	t__2e2397 = (u64)((u64)t__2e2400 + (u64)t__2e2397);
+	t__2e2403 = (u64)(u32)(((u64)t__2e2402 < (u64)t__2e2401));
+	if ((u32)t__2e2403) goto L__2e2405; else goto L__2e2404;
+	L__2e2404:;
+	t_abortsite_2e2277 = ((u64)4UL);
+	goto L_abort_2e2278;
+	L__2e2405:;
+	t__2e2407 = (u64)((u64)t_binding_2e2265 + (u64)((u64)8UL));
+	t__2e2408 = (u64)((u64)t_binding_2e2265 + (u64)((u64)16UL));
+	t__2e2409 = (u64)(*(u64 *)t_binding_2e2265);
+	t__2e2410 = (u64)(*(u64 *)t__2e2407);
+	t__2e2411 = (u64)(*(u64 *)t_binding_2e2376);
+	t__2e2406 = (u64)((u64)t__2e2411 * (u64)((u64)1UL));
+	t__2e2406 = (u64)((u64)t__2e2409 + (u64)t__2e2406);
+	t__2e2412 = (u64)(u32)(((u64)t__2e2411 < (u64)t__2e2410));
+	if ((u32)t__2e2412) goto L__2e2414; else goto L__2e2413;
+	L__2e2413:;
+	t_abortsite_2e2277 = ((u64)5UL);
+	goto L_abort_2e2278;
+	L__2e2414:;
+	t__2e2415 = (u64)(u32)(*(u8 *)t__2e2406);
+	*(u8 *)t__2e2397 = (u8)t__2e2415;
+	t__2e2417 = (u64)((u64)t_binding_2e2265 + (u64)((u64)8UL));
+	t__2e2418 = (u64)((u64)t_binding_2e2265 + (u64)((u64)16UL));
+	t__2e2419 = (u64)(*(u64 *)t_binding_2e2265);
+	t__2e2420 = (u64)(*(u64 *)t__2e2417);
+	t__2e2421 = (u64)(*(u64 *)t_binding_2e2376);
+	t__2e2416 = (u64)((u64)t__2e2421 * (u64)((u64)1UL));
+	t__2e2416 = (u64)((u64)t__2e2419 + (u64)t__2e2416);
+	t__2e2422 = (u64)(u32)(((u64)t__2e2421 < (u64)t__2e2420));
+	if ((u32)t__2e2422) goto L__2e2424; else goto L__2e2423;
+	L__2e2423:;
+	t_abortsite_2e2277 = ((u64)6UL);
+	goto L_abort_2e2278;
+	L__2e2424:;
+	t__2e2425 = (u64)(u32)(*(u8 *)t_binding_2e2386);
+	*(u8 *)t__2e2416 = (u8)t__2e2425;
+	t__2e2426 = (u64)(*(u64 *)t_binding_2e2375);
+	t__2e2426 = (u64)((u64)t__2e2426 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e2375 = (u64)t__2e2426;
+	t__2e2427 = (u64)(*(u64 *)t_binding_2e2376);
+	t__2e2427 = (u64)((u64)t__2e2427 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e2376 = (u64)t__2e2427;
+	goto L__2e2384;
+	L__2e2428:;
+	L__2e2384:;
+	L_after_2e2374:;
+	goto L_loop_2e2370;
+	L__2e2373:;
+	BLIT(__rp, t_binding_2e2265, 24); return __rp;
+	L__2e2429:;
+	L__2e2263:;
+	L__2e2430:;
+	return 0;
+	L_abort_2e2278:;
+	t__2e2279 = (u64)((u64)t_abortsite_2e2277 * (u64)((u64)16UL));
+	t__2e2279 = (u64)((u64)((u64)((char *)&D_abortsites_2e2276)) + (u64)t__2e2279);
+	t__2e2280 = (u64)(*(u64 *)t__2e2279);
+	t__2e2281 = (u64)((u64)t__2e2279 + (u64)((u64)8UL));
+	t__2e2282 = (u64)(*(u32 *)t__2e2281);
+	t__2e2281 = (u64)((u64)t__2e2279 + (u64)((u64)12UL));
+	t__2e2283 = (u64)(*(u32 *)t__2e2281);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e2280, (u64)t__2e2282, (u64)t__2e2283, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static u64 F_rt_2econstchar(u64 p_s) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e2436;
+	u64 t__2e2438;
+	u64 t_binding_2e2435;
+	u64 t_field_2e2437;
+	u64 t_s;
+	t_s = p_s;
+	L_start_2e2431:;
+	t_binding_2e2435 = (u64)A0;
+	L_body_2e2432:;
+	*(u64 *)t_binding_2e2435 = (u64)t_s;
+	t__2e2436 = (u64)(*(u64 *)t_binding_2e2435);
+	t_field_2e2437 = (u64)((u64)t__2e2436 + (u64)((u64)0UL));
+	t__2e2438 = (u64)(*(u64 *)t_field_2e2437);
+	return (u64)t__2e2438;
+	L__2e2439:;
+	L__2e2433:;
+	L__2e2440:;
+	return 0;
+}
+static u64 F_rt_2ealloc__constchar(u64 p_s) {
+	char A0[24] __attribute__((aligned(16)));
+	char B1[24] __attribute__((aligned(16)));
+	u64 t__2e2446;
+	u64 t__2e2447;
+	u64 t__2e2448;
+	u64 t__2e2449;
+	u64 t__2e2450;
+	u64 t__2e2456;
+	u64 t__2e2457;
+	u64 t__2e2458;
+	u64 t__2e2459;
+	u64 t__2e2460;
+	u64 t__2e2461;
+	u64 t__2e2464;
+	u64 t__2e2467;
+	u64 t__2e2468;
+	u64 t__2e2469;
+	u64 t__2e2470;
+	u64 t__2e2471;
+	u64 t__2e2472;
+	u64 t__2e2475;
+	u64 t__2e2476;
+	u64 t__2e2477;
+	u64 t__2e2478;
+	u64 t__2e2479;
+	u64 t__2e2480;
+	u64 t__2e2481;
+	u64 t__2e2482;
+	u64 t__2e2485;
+	u64 t__2e2486;
+	u64 t__2e2487;
+	u64 t__2e2488;
+	u64 t__2e2489;
+	u64 t__2e2490;
+	u64 t__2e2491;
+	u64 t__2e2492;
+	u64 t__2e2493;
+	u64 t__2e2494;
+	u64 t__2e2497;
+	u64 t__2e2498;
+	u64 t__2e2499;
+	u64 t__2e2500;
+	u64 t_abortsite_2e2454;
+	u64 t_binding_2e2445;
+	u64 t_s;
+	t_s = p_s;
+	L_start_2e2441:;
+	t_binding_2e2445 = (u64)A0;
+	L_body_2e2442:;
+	t__2e2447 = (u64)((u64)t_s + (u64)((u64)8UL));
+	t__2e2448 = (u64)((u64)t_s + (u64)((u64)16UL));
+	t__2e2449 = (u64)(*(u64 *)t__2e2447);
+	t__2e2446 = (u64)((u64)t__2e2449 + (u64)((u64)1UL));
+	t__2e2450 = (u64)(u32)(((u64)((u64)0UL) <= (u64)t__2e2446));
+	if ((u32)t__2e2450) goto L__2e2451; else goto L__2e2452;
+	L__2e2452:;
+	t_abortsite_2e2454 = ((u64)0UL);
+	goto L_abort_2e2455;
+	L__2e2451:;
+	t__2e2461 = (u64)((u64)t__2e2446 * (u64)((u64)1UL));
+	t__2e2464 = ((u64)0UL);
+	t__2e2450 = (u64)(u32)(((u64)t__2e2461 != (u64)((u64)0UL)));
+	if ((u32)t__2e2450) goto L__2e2463; else goto L__2e2462;
+	L__2e2463:;
+	t__2e2464 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2emalloc)))((u64)t__2e2461));
+	t__2e2450 = (u64)(u32)(((u64)t__2e2464 != (u64)((u64)0UL)));
+	if ((u32)t__2e2450) goto L__2e2462; else goto L__2e2465;
+	L__2e2465:;
+	t_abortsite_2e2454 = ((u64)1UL);
+	goto L_abort_2e2466;
+	L__2e2462:;
+	*(u64 *)t_binding_2e2445 = (u64)t__2e2464;
+	t__2e2472 = (u64)((u64)t_binding_2e2445 + (u64)((u64)8UL));
+	*(u64 *)t__2e2472 = (u64)((u64)0UL);
+	t__2e2472 = (u64)((u64)t_binding_2e2445 + (u64)((u64)16UL));
+	*(u64 *)t__2e2472 = (u64)t__2e2446;
+	t__2e2475 = (u64)((u64)t_binding_2e2445 + (u64)((u64)8UL));
+	t__2e2476 = (u64)((u64)t_binding_2e2445 + (u64)((u64)16UL));
+	t__2e2477 = (u64)(*(u64 *)t__2e2475);
+	t__2e2479 = (u64)((u64)t_s + (u64)((u64)8UL));
+	t__2e2478 = (u64)(*(u64 *)t__2e2479);
+	t__2e2480 = (u64)((u64)t__2e2477 + (u64)t__2e2478);
+	*(u64 *)t__2e2475 = (u64)t__2e2480;
+	t__2e2482 = (u64)(*(u64 *)t__2e2476);
+	t__2e2485 = (u64)(u32)(((u64)t__2e2480 <= (u64)t__2e2482));
+	if ((u32)t__2e2485) goto L__2e2483; else goto L__2e2484;
+	L__2e2484:;
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2eensure)))((u64)t_binding_2e2445, (u64)((u64)1UL));
+	goto L__2e2483;
+	L__2e2483:;
+	t__2e2486 = (u64)(*(u64 *)t_binding_2e2445);
+	t__2e2481 = (u64)((u64)t__2e2477 * (u64)((u64)1UL));
+	t__2e2481 = (u64)((u64)t__2e2486 + (u64)t__2e2481);
+	t__2e2487 = (u64)((u64)t__2e2478 * (u64)((u64)1UL));
+	t__2e2488 = (u64)(*(u64 *)t_s);
+	((void (*)(u64, u64, u64))((u64)((char *)&F_rt_2ememmove)))((u64)t__2e2481, (u64)t__2e2488, (u64)t__2e2487);
+	t__2e2489 = (u64)((u64)t_binding_2e2445 + (u64)((u64)8UL));
+	t__2e2490 = (u64)((u64)t_binding_2e2445 + (u64)((u64)16UL));
+	t__2e2491 = (u64)(*(u64 *)t__2e2489);
+	t__2e2492 = (u64)((u64)t__2e2491 + (u64)((u64)1UL));
+	*(u64 *)t__2e2489 = (u64)t__2e2492;
+	t__2e2494 = (u64)(*(u64 *)t__2e2490);
+	t__2e2497 = (u64)(u32)(((u64)t__2e2492 <= (u64)t__2e2494));
+	if ((u32)t__2e2497) goto L__2e2495; else goto L__2e2496;
+	L__2e2496:;
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2eensure)))((u64)t_binding_2e2445, (u64)((u64)1UL));
+	goto L__2e2495;
+	L__2e2495:;
+	t__2e2498 = (u64)(*(u64 *)t_binding_2e2445);
+	t__2e2493 = (u64)((u64)t__2e2491 * (u64)((u64)1UL));
+	t__2e2493 = (u64)((u64)t__2e2498 + (u64)t__2e2493);
+	t__2e2499 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	*(u8 *)t__2e2493 = (u8)((u64)0UL);
+	BLIT((u64)B1, t_binding_2e2445, 24);
+	t__2e2500 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2econstchar)))((u64)B1));
+	return (u64)t__2e2500;
+	L__2e2501:;
+	L__2e2443:;
+	L__2e2502:;
+	return 0;
+	L_abort_2e2455:;
+	t__2e2456 = (u64)((u64)t_abortsite_2e2454 * (u64)((u64)16UL));
+	t__2e2456 = (u64)((u64)((u64)((char *)&D_abortsites_2e2453)) + (u64)t__2e2456);
+	t__2e2457 = (u64)(*(u64 *)t__2e2456);
+	t__2e2458 = (u64)((u64)t__2e2456 + (u64)((u64)8UL));
+	t__2e2459 = (u64)(*(u32 *)t__2e2458);
+	t__2e2458 = (u64)((u64)t__2e2456 + (u64)((u64)12UL));
+	t__2e2460 = (u64)(*(u32 *)t__2e2458);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e2457, (u64)t__2e2459, (u64)t__2e2460, (u64)((u64)5UL));
+	__builtin_trap();
+	L_abort_2e2466:;
+	t__2e2467 = (u64)((u64)t_abortsite_2e2454 * (u64)((u64)16UL));
+	t__2e2467 = (u64)((u64)((u64)((char *)&D_abortsites_2e2453)) + (u64)t__2e2467);
+	t__2e2468 = (u64)(*(u64 *)t__2e2467);
+	t__2e2469 = (u64)((u64)t__2e2467 + (u64)((u64)8UL));
+	t__2e2470 = (u64)(*(u32 *)t__2e2469);
+	t__2e2469 = (u64)((u64)t__2e2467 + (u64)((u64)12UL));
+	t__2e2471 = (u64)(*(u32 *)t__2e2469);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e2468, (u64)t__2e2470, (u64)t__2e2471, (u64)((u64)2UL));
+	__builtin_trap();
+}
+static u64 F_rt_2esegmalloc(u64 p_n) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e2509;
+	u64 t__2e2510;
+	u64 t__2e2511;
+	u64 t__2e2512;
+	u64 t__2e2513;
+	u64 t__2e2514;
+	u64 t__2e2515;
+	u64 t__2e2519;
+	u64 t__2e2520;
+	u64 t__2e2521;
+	u64 t__2e2522;
+	u64 t__2e2523;
+	u64 t__2e2524;
+	u64 t__2e2525;
+	u64 t__2e2526;
+	u64 t_binding_2e2508;
+	u64 t_n;
+	u64 t_param_2e2504;
+	t_n = (u64)p_n;
+	L_start_2e2503:;
+	t_param_2e2504 = (u64)A0;
+	t_binding_2e2508 = (u64)A1;
+	*(u64 *)t_param_2e2504 = (u64)t_n;
+	L_body_2e2505:;
+	t__2e2510 = ((u64)0UL);
+	t__2e2511 = (u64)(*(u64 *)t_param_2e2504);
+	t__2e2512 = (u64)(u32)((u32)((u64)1UL) | (u32)((u64)2UL));
+	t__2e2513 = (u64)(u32)((u32)((u64)2UL) | (u32)((u64)32UL));
+	t__2e2514 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e2509 = (u64)(((u64 (*)(u64, u64, u32, u32, u32, u64))((u64)((char *)&F_rt_2emmap)))((u64)t__2e2510, (u64)t__2e2511, (u32)t__2e2512, (u32)t__2e2513, (u32)t__2e2514, (u64)((u64)0UL)));
+	*(u64 *)t_binding_2e2508 = (u64)t__2e2509;
+	t__2e2520 = (u64)(*(u64 *)t_binding_2e2508);
+	t__2e2521 = t__2e2520;
+	t__2e2522 = (u64)(u32)t__2e2521;
+	t__2e2523 = (u64)(u32)(-(u32)((u64)12UL));
+	t__2e2519 = (u64)(u32)(((u32)t__2e2522 == (u32)t__2e2523));
+	t__2e2524 = (u64)(u32)((u8)t__2e2519);
+	if ((u32)t__2e2524) goto L_true_2e2516; else goto L_false_2e2517;
+	L_true_2e2516:;
+	t__2e2525 = ((u64)0UL);
+	t__2e2515 = t__2e2525;
+	goto L__2e2518;
+	L_false_2e2517:;
+	t__2e2526 = (u64)(*(u64 *)t_binding_2e2508);
+	t__2e2515 = t__2e2526;
+	L__2e2518:;
+	return (u64)t__2e2515;
+	L__2e2527:;
+	L__2e2506:;
+	L__2e2528:;
+	return 0;
+}
+static u64 F_rt_2esize__getbin(u64 p_sz) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e2534;
+	u64 t__2e2535;
+	u64 t__2e2536;
+	u64 t__2e2537;
+	u64 t__2e2542;
+	u64 t__2e2543;
+	u64 t__2e2544;
+	u64 t__2e2552;
+	u64 t__2e2553;
+	u64 t__2e2554;
+	u64 t__2e2555;
+	u64 t__2e2556;
+	u64 t__2e2557;
+	u64 t__2e2558;
+	u64 t_binding_2e2546;
+	u64 t_param_2e2530;
+	u64 t_sz;
+	t_sz = (u64)p_sz;
+	L_start_2e2529:;
+	t_param_2e2530 = (u64)A0;
+	t_binding_2e2546 = (u64)A1;
+	*(u64 *)t_param_2e2530 = (u64)t_sz;
+	L_body_2e2531:;
+	t__2e2537 = (u64)(*(u64 *)t_param_2e2530);
+	t__2e2536 = (u64)((u64)t__2e2537 + (u64)((u64)8UL));
+	t__2e2535 = (u64)((u64)t__2e2536 - (u64)((u64)1UL));
+	t__2e2534 = (u64)((u64)t__2e2535 >> (((u64)4UL) & 63));
+	*(u64 *)t_param_2e2530 = (u64)t__2e2534;
+	t__2e2543 = (u64)(*(u64 *)t_param_2e2530);
+	t__2e2542 = (u64)(u32)(((u64)t__2e2543 == (u64)((u64)0UL)));
+	t__2e2544 = (u64)(u32)((u8)t__2e2542);
+	if ((u32)t__2e2544) goto L_true_2e2539; else goto L_false_2e2540;
+	L_true_2e2539:;
+	return (u64)((u64)0UL);
+	L__2e2545:;
+	L_false_2e2540:;
+	L__2e2541:;
+	*(u64 *)t_binding_2e2546 = (u64)((u64)0UL);
+	L_loop_2e2547:;
+	t__2e2554 = (u64)(*(u64 *)t_binding_2e2546);
+	t__2e2553 = (u64)((u64)((u64)1UL) << (t__2e2554 & 63));
+	t__2e2555 = (u64)(*(u64 *)t_param_2e2530);
+	t__2e2552 = (u64)(u32)(((u64)t__2e2553 < (u64)t__2e2555));
+	if ((u32)t__2e2552) goto L_body_2e2548; else goto L__2e2550;
+	L_body_2e2548:;
+	L_after_2e2551:;
+	t__2e2556 = (u64)(*(u64 *)t_binding_2e2546);
+	t__2e2556 = (u64)((u64)t__2e2556 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e2546 = (u64)t__2e2556;
+	goto L_loop_2e2547;
+	L__2e2550:;
+	t__2e2558 = (u64)(*(u64 *)t_binding_2e2546);
+	t__2e2557 = (u64)((u64)t__2e2558 + (u64)((u64)1UL));
+	return (u64)t__2e2557;
+	L__2e2559:;
+	L__2e2532:;
+	L__2e2560:;
+	return 0;
+}
+static u32 F_rt_2esegfree(u64 p_p, u64 p_s) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e2565;
+	u64 t__2e2566;
+	u64 t__2e2567;
+	u64 t_p;
+	u64 t_param_2e2562;
+	u64 t_param_2e2563;
+	u64 t_s;
+	t_p = (u64)p_p;
+	t_s = (u64)p_s;
+	L_start_2e2561:;
+	t_param_2e2562 = (u64)A0;
+	t_param_2e2563 = (u64)A1;
+	*(u64 *)t_param_2e2562 = (u64)t_p;
+	*(u64 *)t_param_2e2563 = (u64)t_s;
+	L_body_2e2564:;
+	t__2e2566 = (u64)(*(u64 *)t_param_2e2562);
+	t__2e2567 = (u64)(*(u64 *)t_param_2e2563);
+	t__2e2565 = (u64)(u32)(((u32 (*)(u64, u64))((u64)((char *)&F_rt_2emunmap)))((u64)t__2e2566, (u64)t__2e2567));
+	return (u32)t__2e2565;
+}
+static u32 F_rt_2esize__islarge(u64 p_sz) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e2571;
+	u64 t__2e2572;
+	u64 t__2e2573;
+	u64 t__2e2574;
+	u64 t_param_2e2569;
+	u64 t_sz;
+	t_sz = (u64)p_sz;
+	L_start_2e2568:;
+	t_param_2e2569 = (u64)A0;
+	*(u64 *)t_param_2e2569 = (u64)t_sz;
+	L_body_2e2570:;
+	t__2e2572 = (u64)(*(u64 *)t_param_2e2569);
+	t__2e2574 = (u64)((u64)((u64)9UL) - (u64)((u64)1UL));
+	t__2e2573 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2ebin__getsize)))((u64)t__2e2574));
+	t__2e2571 = (u64)(u32)(((u64)t__2e2572 > (u64)t__2e2573));
+	return (u32)t__2e2571;
+}
+static u64 F_rt_2erealsz(u64 p_sz) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e2584;
+	u64 t__2e2585;
+	u64 t__2e2586;
+	u64 t__2e2589;
+	u64 t__2e2590;
+	u64 t__2e2595;
+	u64 t__2e2596;
+	u64 t__2e2597;
+	u64 t__2e2598;
+	u64 t__2e2599;
+	u64 t__2e2600;
+	u64 t__2e2601;
+	u64 t__2e2602;
+	u64 t__2e2603;
+	u64 t__2e2604;
+	u64 t__2e2605;
+	u64 t__2e2608;
+	u64 t__2e2609;
+	u64 t__2e2610;
+	u64 t_param_2e2576;
+	u64 t_sz;
+	t_sz = (u64)p_sz;
+	L_start_2e2575:;
+	t_param_2e2576 = (u64)A0;
+	*(u64 *)t_param_2e2576 = (u64)t_sz;
+	L_body_2e2577:;
+	t__2e2585 = (u64)(*(u64 *)t_param_2e2576);
+	t__2e2584 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_rt_2esize__islarge)))((u64)t__2e2585));
+	t__2e2586 = (u64)(u32)((u8)t__2e2584);
+	if ((u32)t__2e2586) goto L_true_2e2581; else goto L_false_2e2582;
+	L_true_2e2581:;
+	t__2e2589 = (u64)(*(u64 *)t_param_2e2576);
+	t__2e2590 = (u64)((u64)((u64)16UL) + (u64)((u64)8UL));
+	t__2e2589 = (u64)((u64)t__2e2589 + (u64)t__2e2590);
+	*(u64 *)t_param_2e2576 = (u64)t__2e2589;
+	t__2e2597 = (u64)(*(u64 *)t_param_2e2576);
+	t__2e2596 = (u64)((u64)t__2e2597 & (u64)((u64)4095UL));
+	t__2e2595 = (u64)(u32)(((u64)t__2e2596 != (u64)((u64)0UL)));
+	t__2e2598 = (u64)(u32)((u8)t__2e2595);
+	if ((u32)t__2e2598) goto L_true_2e2592; else goto L_false_2e2593;
+	L_true_2e2592:;
+	t__2e2599 = (u64)(*(u64 *)t_param_2e2576);
+	t__2e2602 = (u64)(*(u64 *)t_param_2e2576);
+	t__2e2601 = (u64)((u64)t__2e2602 & (u64)((u64)4095UL));
+	t__2e2600 = (u64)((u64)((u64)4096UL) - (u64)t__2e2601);
+	t__2e2599 = (u64)((u64)t__2e2599 + (u64)t__2e2600);
+	*(u64 *)t_param_2e2576 = (u64)t__2e2599;
+	goto L__2e2594;
+	L_false_2e2593:;
+	L__2e2594:;
+	t__2e2605 = (u64)(*(u64 *)t_param_2e2576);
+	t__2e2604 = (u64)((u64)t__2e2605 - (u64)((u64)16UL));
+	t__2e2603 = (u64)((u64)t__2e2604 - (u64)((u64)8UL));
+	return (u64)t__2e2603;
+	L__2e2606:;
+	L__2e2587:;
+	L__2e2607:;
+	L_false_2e2582:;
+	L__2e2583:;
+	t__2e2610 = (u64)(*(u64 *)t_param_2e2576);
+	t__2e2609 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esize__getbin)))((u64)t__2e2610));
+	t__2e2608 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2ebin__getsize)))((u64)t__2e2609));
+	return (u64)t__2e2608;
+	L__2e2611:;
+	L__2e2578:;
+	L__2e2612:;
+	return 0;
+}
+static void F_rt_2evalidatemeta(u64 p_m, u32 p_shallow) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	u64 t__2e2621;
+	u64 t__2e2622;
+	u64 t__2e2623;
+	u64 t__2e2625;
+	u64 t__2e2626;
+	u64 t__2e2633;
+	u64 t__2e2636;
+	u64 t__2e2637;
+	u64 t__2e2638;
+	u64 t__2e2640;
+	u64 t__2e2641;
+	u64 t__2e2642;
+	u64 t__2e2643;
+	u64 t__2e2644;
+	u64 t__2e2645;
+	u64 t__2e2650;
+	u64 t__2e2651;
+	u64 t__2e2652;
+	u64 t__2e2658;
+	u64 t__2e2666;
+	u64 t__2e2667;
+	u64 t__2e2668;
+	u64 t__2e2669;
+	u64 t__2e2670;
+	u64 t__2e2671;
+	u64 t__2e2678;
+	u64 t__2e2679;
+	u64 t__2e2680;
+	u64 t__2e2681;
+	u64 t__2e2682;
+	u64 t__2e2688;
+	u64 t__2e2689;
+	u64 t__2e2690;
+	u64 t__2e2691;
+	u64 t__2e2692;
+	u64 t__2e2696;
+	u64 t__2e2698;
+	u64 t__2e2700;
+	u64 t__2e2702;
+	u64 t__2e2707;
+	u64 t__2e2708;
+	u64 t__2e2710;
+	u64 t__2e2711;
+	u64 t__2e2716;
+	u64 t__2e2717;
+	u64 t__2e2718;
+	u64 t__2e2719;
+	u64 t__2e2721;
+	u64 t__2e2722;
+	u64 t__2e2723;
+	u64 t__2e2728;
+	u64 t__2e2729;
+	u64 t__2e2730;
+	u64 t__2e2731;
+	u64 t__2e2732;
+	u64 t__2e2734;
+	u64 t__2e2739;
+	u64 t__2e2740;
+	u64 t__2e2742;
+	u64 t__2e2743;
+	u64 t__2e2745;
+	u64 t__2e2752;
+	u64 t__2e2753;
+	u64 t__2e2754;
+	u64 t__2e2755;
+	u64 t__2e2757;
+	u64 t__2e2758;
+	u64 t__2e2760;
+	u64 t__2e2767;
+	u64 t__2e2768;
+	u64 t__2e2769;
+	u64 t__2e2771;
+	u64 t__2e2772;
+	u64 t__2e2775;
+	u64 t__2e2780;
+	u64 t__2e2781;
+	u64 t__2e2783;
+	u64 t__2e2784;
+	u64 t__2e2785;
+	u64 t__2e2790;
+	u64 t__2e2791;
+	u64 t__2e2792;
+	u64 t__2e2793;
+	u64 t__2e2795;
+	u64 t__2e2796;
+	u64 t__2e2798;
+	u64 t_abortsite_2e2686;
+	u64 t_binding_2e2661;
+	u64 t_binding_2e2695;
+	u64 t_field_2e2624;
+	u64 t_field_2e2639;
+	u64 t_field_2e2697;
+	u64 t_field_2e2701;
+	u64 t_field_2e2709;
+	u64 t_field_2e2720;
+	u64 t_field_2e2733;
+	u64 t_field_2e2741;
+	u64 t_field_2e2744;
+	u64 t_field_2e2756;
+	u64 t_field_2e2759;
+	u64 t_field_2e2770;
+	u64 t_field_2e2782;
+	u64 t_field_2e2794;
+	u64 t_field_2e2797;
+	u64 t_m;
+	u64 t_param_2e2614;
+	u64 t_param_2e2615;
+	u64 t_shallow;
+	t_m = (u64)p_m;
+	t_shallow = (u64)p_shallow;
+	L_start_2e2613:;
+	t_param_2e2614 = (u64)A0;
+	t_param_2e2615 = (u64)A1;
+	t_binding_2e2661 = (u64)A2;
+	t_binding_2e2695 = (u64)A3;
+	*(u64 *)t_param_2e2614 = (u64)t_m;
+	*(u8 *)t_param_2e2615 = (u8)t_shallow;
+	L_body_2e2616:;
+	t__2e2623 = (u64)(*(u64 *)t_param_2e2614);
+	t_field_2e2624 = (u64)((u64)t__2e2623 + (u64)((u64)8UL));
+	t__2e2625 = t_field_2e2624;
+	t__2e2626 = ((u64)16UL);
+	t__2e2622 = (u64)((u64)t__2e2625 % (u64)t__2e2626);
+	t__2e2621 = (u64)(u32)(((u64)t__2e2622 == (u64)((u64)0UL)));
+	if ((u32)t__2e2621) goto L_passed_2e2620; else goto L_failed_2e2619;
+	L_failed_2e2619:;
+	BLIT((u64)B4, ((u64)((char *)&D_strliteral_2e2628)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)228UL), (u64)((u64)15UL), (u64)B4);
+	__builtin_trap();
+	L_passed_2e2620:;
+	t__2e2638 = (u64)(*(u64 *)t_param_2e2614);
+	t_field_2e2639 = (u64)((u64)t__2e2638 + (u64)((u64)0UL));
+	t__2e2640 = (u64)(*(u64 *)t_field_2e2639);
+	t__2e2637 = (u64)((u64)t__2e2640 & (u64)((u64)1UL));
+	t__2e2636 = (u64)(u32)(((u64)t__2e2637 == (u64)((u64)1UL)));
+	t__2e2633 = (u64)(u32)t__2e2636;
+	if ((u32)t__2e2633) goto L__2e2635; else goto L__2e2634;
+	L__2e2634:;
+	t__2e2642 = (u64)(u32)(*(u8 *)t_param_2e2615);
+	t__2e2643 = (u64)(u32)((u8)t__2e2642);
+	t__2e2644 = (u64)(u32)((u8)((u64)1UL));
+	t__2e2641 = (u64)(u32)(((u32)t__2e2643 == (u32)t__2e2644));
+	t__2e2633 = (u64)(u32)t__2e2641;
+	goto L__2e2635;
+	L__2e2635:;
+	t__2e2645 = (u64)(u32)((u8)t__2e2633);
+	if ((u32)t__2e2645) goto L_true_2e2630; else goto L_false_2e2631;
+	L_true_2e2630:;
+	t__2e2651 = (u64)(*(u64 *)t_param_2e2614);
+	t__2e2650 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2emeta__next)))((u64)t__2e2651));
+	t__2e2652 = (u64)(u32)(((u64)t__2e2650 == (u64)((u64)0UL)));
+	if ((u32)t__2e2652) goto L_matches_2e2653; else goto L_next_2e2654;
+	L_matches_2e2653:;
+	goto L__2e2655;
+	L__2e2657:;
+	L__2e2655:;
+	goto L__2e2649;
+	L_next_2e2654:;
+	t__2e2658 = (u64)(u32)(((u64)t__2e2650 != (u64)((u64)0UL)));
+	if ((u32)t__2e2658) goto L_matches_2e2659; else goto L_next_2e2660;
+	L_matches_2e2659:;
+	*(u64 *)t_binding_2e2661 = (u64)t__2e2650;
+	t__2e2668 = (u64)(*(u64 *)t_binding_2e2661);
+	t__2e2669 = t__2e2668;
+	t__2e2670 = ((u64)16UL);
+	t__2e2667 = (u64)((u64)t__2e2669 % (u64)t__2e2670);
+	t__2e2671 = ((u64)8UL);
+	t__2e2666 = (u64)(u32)(((u64)t__2e2667 == (u64)t__2e2671));
+	if ((u32)t__2e2666) goto L_passed_2e2665; else goto L_failed_2e2664;
+	L_failed_2e2664:;
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e2673)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)238UL), (u64)((u64)31UL), (u64)B5);
+	__builtin_trap();
+	L_passed_2e2665:;
+	t__2e2678 = (u64)(u32)(*(u8 *)t_param_2e2615);
+	t__2e2680 = (u64)(u32)((u8)t__2e2678);
+	t__2e2679 = (u64)(u32)(((u32)t__2e2680 == (u32)((u64)0UL)));
+	t__2e2681 = (u64)(u32)((u8)t__2e2679);
+	if ((u32)t__2e2681) goto L_true_2e2675; else goto L_false_2e2676;
+	L_true_2e2675:;
+	t__2e2682 = (u64)(*(u64 *)t_binding_2e2661);
+	((void (*)(u64, u32))((u64)((char *)&F_rt_2evalidatemeta)))((u64)t__2e2682, (u32)((u64)1UL));
+	goto L__2e2677;
+	L_false_2e2676:;
+	L__2e2677:;
+	goto L__2e2662;
+	L__2e2683:;
+	L__2e2662:;
+	goto L__2e2649;
+	L_next_2e2660:;
+	L__2e2684:;
+	t_abortsite_2e2686 = ((u64)0UL);
+	goto L_abort_2e2687;
+	L__2e2649:;
+	return;
+	L__2e2693:;
+	L__2e2646:;
+	L__2e2694:;
+	L_false_2e2631:;
+	L__2e2632:;
+	t__2e2696 = (u64)(*(u64 *)t_param_2e2614);
+	t_field_2e2697 = (u64)((u64)t__2e2696 + (u64)((u64)8UL));
+	t__2e2700 = (u64)(*(u64 *)t_param_2e2614);
+	t_field_2e2701 = (u64)((u64)t__2e2700 + (u64)((u64)0UL));
+	t__2e2702 = (u64)(*(u64 *)t_field_2e2701);
+	t__2e2698 = (u64)((u64)t__2e2702 * (u64)((u64)1UL));
+	t__2e2698 = (u64)((u64)t_field_2e2697 + (u64)t__2e2698);
+	*(u64 *)t_binding_2e2695 = (u64)t__2e2698;
+	t__2e2708 = (u64)(*(u64 *)t_param_2e2614);
+	t_field_2e2709 = (u64)((u64)t__2e2708 + (u64)((u64)0UL));
+	t__2e2710 = (u64)(*(u64 *)t_field_2e2709);
+	t__2e2707 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_rt_2esize__islarge)))((u64)t__2e2710));
+	t__2e2711 = (u64)(u32)((u8)t__2e2707);
+	if ((u32)t__2e2711) goto L_true_2e2704; else goto L_false_2e2705;
+	L_true_2e2704:;
+	t__2e2719 = (u64)(*(u64 *)t_param_2e2614);
+	t_field_2e2720 = (u64)((u64)t__2e2719 + (u64)((u64)8UL));
+	t__2e2721 = t_field_2e2720;
+	t__2e2722 = ((u64)16UL);
+	t__2e2718 = (u64)((u64)t__2e2721 - (u64)t__2e2722);
+	t__2e2723 = ((u64)4096UL);
+	t__2e2717 = (u64)((u64)t__2e2718 % (u64)t__2e2723);
+	t__2e2716 = (u64)(u32)(((u64)t__2e2717 == (u64)((u64)0UL)));
+	if ((u32)t__2e2716) goto L_passed_2e2715; else goto L_failed_2e2714;
+	L_failed_2e2714:;
+	BLIT((u64)B6, ((u64)((char *)&D_strliteral_2e2725)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)248UL), (u64)((u64)23UL), (u64)B6);
+	__builtin_trap();
+	L_passed_2e2715:;
+	t__2e2732 = (u64)(*(u64 *)t_param_2e2614);
+	t_field_2e2733 = (u64)((u64)t__2e2732 + (u64)((u64)0UL));
+	t__2e2734 = (u64)(*(u64 *)t_field_2e2733);
+	t__2e2731 = (u64)((u64)t__2e2734 + (u64)((u64)16UL));
+	t__2e2730 = (u64)((u64)t__2e2731 + (u64)((u64)8UL));
+	t__2e2729 = (u64)((u64)t__2e2730 & (u64)((u64)4095UL));
+	t__2e2728 = (u64)(u32)(((u64)t__2e2729 == (u64)((u64)0UL)));
+	if ((u32)t__2e2728) goto L_passed_2e2727; else goto L_failed_2e2726;
+	L_failed_2e2726:;
+	BLIT((u64)B7, ((u64)((char *)&D_strliteral_2e2736)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)250UL), (u64)((u64)23UL), (u64)B7);
+	__builtin_trap();
+	L_passed_2e2727:;
+	t__2e2740 = (u64)(*(u64 *)t_binding_2e2695);
+	t_field_2e2741 = (u64)((u64)t__2e2740 + (u64)((u64)0UL));
+	t__2e2742 = (u64)(*(u64 *)t_field_2e2741);
+	t__2e2743 = (u64)(*(u64 *)t_param_2e2614);
+	t_field_2e2744 = (u64)((u64)t__2e2743 + (u64)((u64)0UL));
+	t__2e2745 = (u64)(*(u64 *)t_field_2e2744);
+	t__2e2739 = (u64)(u32)(((u64)t__2e2742 == (u64)t__2e2745));
+	if ((u32)t__2e2739) goto L_passed_2e2738; else goto L_failed_2e2737;
+	L_failed_2e2737:;
+	BLIT((u64)B8, ((u64)((char *)&D_strliteral_2e2747)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)252UL), (u64)((u64)23UL), (u64)B8);
+	__builtin_trap();
+	L_passed_2e2738:;
+	return;
+	L__2e2748:;
+	L__2e2712:;
+	L__2e2749:;
+	L_false_2e2705:;
+	L__2e2706:;
+	t__2e2755 = (u64)(*(u64 *)t_param_2e2614);
+	t_field_2e2756 = (u64)((u64)t__2e2755 + (u64)((u64)0UL));
+	t__2e2757 = (u64)(*(u64 *)t_field_2e2756);
+	t__2e2754 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esize__getbin)))((u64)t__2e2757));
+	t__2e2753 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2ebin__getsize)))((u64)t__2e2754));
+	t__2e2758 = (u64)(*(u64 *)t_param_2e2614);
+	t_field_2e2759 = (u64)((u64)t__2e2758 + (u64)((u64)0UL));
+	t__2e2760 = (u64)(*(u64 *)t_field_2e2759);
+	t__2e2752 = (u64)(u32)(((u64)t__2e2753 == (u64)t__2e2760));
+	if ((u32)t__2e2752) goto L_passed_2e2751; else goto L_failed_2e2750;
+	L_failed_2e2750:;
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e2762)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)257UL), (u64)((u64)15UL), (u64)B9);
+	__builtin_trap();
+	L_passed_2e2751:;
+	t__2e2769 = (u64)(*(u64 *)t_binding_2e2695);
+	t_field_2e2770 = (u64)((u64)t__2e2769 + (u64)((u64)0UL));
+	t__2e2771 = (u64)(*(u64 *)t_field_2e2770);
+	t__2e2768 = (u64)((u64)t__2e2771 & (u64)((u64)1UL));
+	t__2e2767 = (u64)(u32)(((u64)t__2e2768 == (u64)((u64)1UL)));
+	t__2e2772 = (u64)(u32)((u8)t__2e2767);
+	if ((u32)t__2e2772) goto L_true_2e2764; else goto L_false_2e2765;
+	L_true_2e2764:;
+	t__2e2775 = (u64)(*(u64 *)t_binding_2e2695);
+	((void (*)(u64, u32))((u64)((char *)&F_rt_2evalidatemeta)))((u64)t__2e2775, (u32)((u64)0UL));
+	return;
+	L__2e2776:;
+	L__2e2773:;
+	L__2e2777:;
+	L_false_2e2765:;
+	L__2e2766:;
+	t__2e2781 = (u64)(*(u64 *)t_binding_2e2695);
+	t_field_2e2782 = (u64)((u64)t__2e2781 + (u64)((u64)0UL));
+	t__2e2783 = (u64)(*(u64 *)t_field_2e2782);
+	t__2e2780 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_rt_2esize__islarge)))((u64)t__2e2783));
+	t__2e2785 = (u64)(u32)((u8)t__2e2780);
+	t__2e2784 = (u64)(u32)(((u32)t__2e2785 == (u32)((u64)0UL)));
+	if ((u32)t__2e2784) goto L_passed_2e2779; else goto L_failed_2e2778;
+	L_failed_2e2778:;
+	BLIT((u64)B10, ((u64)((char *)&D_strliteral_2e2787)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)269UL), (u64)((u64)15UL), (u64)B10);
+	__builtin_trap();
+	L_passed_2e2779:;
+	t__2e2793 = (u64)(*(u64 *)t_binding_2e2695);
+	t_field_2e2794 = (u64)((u64)t__2e2793 + (u64)((u64)0UL));
+	t__2e2795 = (u64)(*(u64 *)t_field_2e2794);
+	t__2e2792 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esize__getbin)))((u64)t__2e2795));
+	t__2e2791 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2ebin__getsize)))((u64)t__2e2792));
+	t__2e2796 = (u64)(*(u64 *)t_binding_2e2695);
+	t_field_2e2797 = (u64)((u64)t__2e2796 + (u64)((u64)0UL));
+	t__2e2798 = (u64)(*(u64 *)t_field_2e2797);
+	t__2e2790 = (u64)(u32)(((u64)t__2e2791 == (u64)t__2e2798));
+	if ((u32)t__2e2790) goto L_passed_2e2789; else goto L_failed_2e2788;
+	L_failed_2e2788:;
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e2787)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)271UL), (u64)((u64)15UL), (u64)B11);
+	__builtin_trap();
+	L_passed_2e2789:;
+	goto L__2e2617;
+	L__2e2799:;
+	L__2e2617:;
+	return;
+	L_abort_2e2687:;
+	t__2e2688 = (u64)((u64)t_abortsite_2e2686 * (u64)((u64)16UL));
+	t__2e2688 = (u64)((u64)((u64)((char *)&D_abortsites_2e2685)) + (u64)t__2e2688);
+	t__2e2689 = (u64)(*(u64 *)t__2e2688);
+	t__2e2690 = (u64)((u64)t__2e2688 + (u64)((u64)8UL));
+	t__2e2691 = (u64)(*(u32 *)t__2e2690);
+	t__2e2690 = (u64)((u64)t__2e2688 + (u64)((u64)12UL));
+	t__2e2692 = (u64)(*(u32 *)t__2e2690);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e2689, (u64)t__2e2691, (u64)t__2e2692, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u64 F_rt_2emeta__next(u64 p_m) {
+	char A0[8] __attribute__((aligned(16)));
+	char B1[24] __attribute__((aligned(16)));
+	u64 t__2e2807;
+	u64 t__2e2808;
+	u64 t__2e2809;
+	u64 t__2e2811;
+	u64 t__2e2814;
+	u64 t__2e2815;
+	u64 t__2e2817;
+	u64 t__2e2818;
+	u64 t__2e2819;
+	u64 t_field_2e2810;
+	u64 t_field_2e2816;
+	u64 t_m;
+	u64 t_param_2e2801;
+	t_m = (u64)p_m;
+	L_start_2e2800:;
+	t_param_2e2801 = (u64)A0;
+	*(u64 *)t_param_2e2801 = (u64)t_m;
+	L_body_2e2802:;
+	t__2e2809 = (u64)(*(u64 *)t_param_2e2801);
+	t_field_2e2810 = (u64)((u64)t__2e2809 + (u64)((u64)0UL));
+	t__2e2811 = (u64)(*(u64 *)t_field_2e2810);
+	t__2e2808 = (u64)((u64)t__2e2811 & (u64)((u64)1UL));
+	t__2e2807 = (u64)(u32)(((u64)t__2e2808 == (u64)((u64)1UL)));
+	if ((u32)t__2e2807) goto L_passed_2e2806; else goto L_failed_2e2805;
+	L_failed_2e2805:;
+	BLIT((u64)B1, ((u64)((char *)&D_strliteral_2e2813)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)208UL), (u64)((u64)15UL), (u64)B1);
+	__builtin_trap();
+	L_passed_2e2806:;
+	t__2e2815 = (u64)(*(u64 *)t_param_2e2801);
+	t_field_2e2816 = (u64)((u64)t__2e2815 + (u64)((u64)0UL));
+	t__2e2817 = (u64)(*(u64 *)t_field_2e2816);
+	t__2e2818 = (u64)((u64)((u64)1UL) ^ (u64)((u64)18446744073709551615UL));
+	t__2e2814 = (u64)((u64)t__2e2817 & (u64)t__2e2818);
+	t__2e2819 = t__2e2814;
+	return (u64)t__2e2819;
+	L__2e2820:;
+	L__2e2803:;
+	L__2e2821:;
+	return 0;
+}
+static u64 F_rt_2ebin__getsize(u64 p_bin) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e2831;
+	u64 t__2e2832;
+	u64 t__2e2833;
+	u64 t__2e2834;
+	u64 t__2e2835;
+	u64 t__2e2836;
+	u64 t__2e2837;
+	u64 t__2e2838;
+	u64 t__2e2839;
+	u64 t__2e2840;
+	u64 t_bin;
+	u64 t_binding_2e2827;
+	u64 t_param_2e2823;
+	t_bin = (u64)p_bin;
+	L_start_2e2822:;
+	t_param_2e2823 = (u64)A0;
+	t_binding_2e2827 = (u64)A1;
+	*(u64 *)t_param_2e2823 = (u64)t_bin;
+	L_body_2e2824:;
+	t__2e2832 = (u64)(*(u64 *)t_param_2e2823);
+	t__2e2831 = (u64)(u32)(((u64)t__2e2832 == (u64)((u64)0UL)));
+	t__2e2833 = (u64)(u32)((u8)t__2e2831);
+	if ((u32)t__2e2833) goto L_true_2e2828; else goto L_false_2e2829;
+	L_true_2e2828:;
+	*(u64 *)t_binding_2e2827 = (u64)((u64)0UL);
+	goto L__2e2830;
+	L_false_2e2829:;
+	t__2e2836 = (u64)(*(u64 *)t_param_2e2823);
+	t__2e2835 = (u64)((u64)t__2e2836 - (u64)((u64)1UL));
+	t__2e2834 = (u64)((u64)((u64)1UL) << (t__2e2835 & 63));
+	*(u64 *)t_binding_2e2827 = (u64)t__2e2834;
+	L__2e2830:;
+	t__2e2840 = (u64)(*(u64 *)t_binding_2e2827);
+	t__2e2839 = (u64)((u64)t__2e2840 << (((u64)4UL) & 63));
+	t__2e2838 = (u64)((u64)t__2e2839 + (u64)((u64)16UL));
+	t__2e2837 = (u64)((u64)t__2e2838 - (u64)((u64)8UL));
+	return (u64)t__2e2837;
+	L__2e2841:;
+	L__2e2825:;
+	L__2e2842:;
+	return 0;
+}
+static void F_rt_2echeckpoison(u64 p_m, u64 p_sz) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	u64 t__2e2851;
+	u64 t__2e2852;
+	u64 t__2e2853;
+	u64 t__2e2859;
+	u64 t__2e2865;
+	u64 t__2e2871;
+	u64 t__2e2872;
+	u64 t__2e2873;
+	u64 t__2e2874;
+	u64 t__2e2875;
+	u64 t__2e2880;
+	u64 t__2e2881;
+	u64 t__2e2882;
+	u64 t__2e2887;
+	u64 t__2e2888;
+	u64 t__2e2890;
+	u64 t__2e2901;
+	u64 t__2e2902;
+	u64 t__2e2903;
+	u64 t__2e2908;
+	u64 t__2e2909;
+	u64 t__2e2911;
+	u64 t__2e2913;
+	u64 t__2e2914;
+	u64 t__2e2915;
+	u64 t__2e2916;
+	u64 t__2e2920;
+	u64 t_abortsite_2e2869;
+	u64 t_binding_2e2862;
+	u64 t_binding_2e2900;
+	u64 t_field_2e2889;
+	u64 t_field_2e2910;
+	u64 t_m;
+	u64 t_param_2e2844;
+	u64 t_param_2e2845;
+	u64 t_sz;
+	t_m = (u64)p_m;
+	t_sz = (u64)p_sz;
+	L_start_2e2843:;
+	t_param_2e2844 = (u64)A0;
+	t_param_2e2845 = (u64)A1;
+	t_binding_2e2862 = (u64)A2;
+	t_binding_2e2900 = (u64)A3;
+	*(u64 *)t_param_2e2844 = (u64)t_m;
+	*(u64 *)t_param_2e2845 = (u64)t_sz;
+	L_body_2e2846:;
+	t__2e2852 = (u64)(*(u64 *)t_param_2e2844);
+	t__2e2851 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2emeta__next)))((u64)t__2e2852));
+	t__2e2853 = (u64)(u32)(((u64)t__2e2851 == (u64)((u64)0UL)));
+	if ((u32)t__2e2853) goto L_matches_2e2854; else goto L_next_2e2855;
+	L_matches_2e2854:;
+	goto L__2e2856;
+	L__2e2858:;
+	L__2e2856:;
+	goto L__2e2850;
+	L_next_2e2855:;
+	t__2e2859 = (u64)(u32)(((u64)t__2e2851 != (u64)((u64)0UL)));
+	if ((u32)t__2e2859) goto L_matches_2e2860; else goto L_next_2e2861;
+	L_matches_2e2860:;
+	*(u64 *)t_binding_2e2862 = (u64)t__2e2851;
+	t__2e2865 = (u64)(*(u64 *)t_binding_2e2862);
+	((void (*)(u64, u32))((u64)((char *)&F_rt_2evalidatemeta)))((u64)t__2e2865, (u32)((u64)0UL));
+	goto L__2e2863;
+	L__2e2866:;
+	L__2e2863:;
+	goto L__2e2850;
+	L_next_2e2861:;
+	L__2e2867:;
+	t_abortsite_2e2869 = ((u64)0UL);
+	goto L_abort_2e2870;
+	L__2e2850:;
+	t__2e2881 = (u64)(u32)((u8)((u64)1UL));
+	t__2e2880 = (u64)(u32)(((u32)t__2e2881 == (u32)((u64)0UL)));
+	t__2e2882 = (u64)(u32)((u8)t__2e2880);
+	if ((u32)t__2e2882) goto L_true_2e2877; else goto L_false_2e2878;
+	L_true_2e2877:;
+	t__2e2888 = (u64)(*(u64 *)t_param_2e2844);
+	t_field_2e2889 = (u64)((u64)t__2e2888 + (u64)((u64)8UL));
+	t__2e2890 = (u64)(*(u64 *)t_field_2e2889);
+	t__2e2887 = (u64)(u32)(((u64)t__2e2890 == (u64)((u64)7595718147998050665UL)));
+	if ((u32)t__2e2887) goto L_passed_2e2886; else goto L_failed_2e2885;
+	L_failed_2e2885:;
+	BLIT((u64)B4, ((u64)((char *)&D_strliteral_2e2892)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)283UL), (u64)((u64)23UL), (u64)B4);
+	__builtin_trap();
+	L_passed_2e2886:;
+	return;
+	L__2e2893:;
+	L__2e2883:;
+	L__2e2894:;
+	L_false_2e2878:;
+	L__2e2879:;
+	*(u64 *)t_binding_2e2900 = (u64)((u64)0UL);
+	L_loop_2e2895:;
+	t__2e2902 = (u64)(*(u64 *)t_binding_2e2900);
+	t__2e2903 = (u64)(*(u64 *)t_param_2e2845);
+	t__2e2901 = (u64)(u32)(((u64)t__2e2902 < (u64)t__2e2903));
+	if ((u32)t__2e2901) goto L_body_2e2896; else goto L__2e2898;
+	L_body_2e2896:;
+	t__2e2909 = (u64)(*(u64 *)t_param_2e2844);
+	t_field_2e2910 = (u64)((u64)t__2e2909 + (u64)((u64)8UL));
+	t__2e2913 = (u64)(*(u64 *)t_binding_2e2900);
+	t__2e2911 = (u64)((u64)t__2e2913 * (u64)((u64)1UL));
+	t__2e2911 = (u64)((u64)t_field_2e2910 + (u64)t__2e2911);
+	t__2e2914 = (u64)(u32)(*(u8 *)t__2e2911);
+	t__2e2915 = (u64)(u32)((u8)t__2e2914);
+	t__2e2916 = (u64)(u32)((u8)((u64)105UL));
+	t__2e2908 = (u64)(u32)(((u32)t__2e2915 == (u32)t__2e2916));
+	if ((u32)t__2e2908) goto L_passed_2e2907; else goto L_failed_2e2906;
+	L_failed_2e2906:;
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e2918)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e25)), (u64)((u64)288UL), (u64)((u64)23UL), (u64)B5);
+	__builtin_trap();
+	L_passed_2e2907:;
+	goto L__2e2904;
+	L__2e2919:;
+	L__2e2904:;
+	L_after_2e2899:;
+	t__2e2920 = (u64)(*(u64 *)t_binding_2e2900);
+	t__2e2920 = (u64)((u64)t__2e2920 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e2900 = (u64)t__2e2920;
+	goto L_loop_2e2895;
+	L__2e2898:;
+	goto L__2e2847;
+	L__2e2921:;
+	L__2e2847:;
+	return;
+	L_abort_2e2870:;
+	t__2e2871 = (u64)((u64)t_abortsite_2e2869 * (u64)((u64)16UL));
+	t__2e2871 = (u64)((u64)((u64)((char *)&D_abortsites_2e2868)) + (u64)t__2e2871);
+	t__2e2872 = (u64)(*(u64 *)t__2e2871);
+	t__2e2873 = (u64)((u64)t__2e2871 + (u64)((u64)8UL));
+	t__2e2874 = (u64)(*(u32 *)t__2e2873);
+	t__2e2873 = (u64)((u64)t__2e2871 + (u64)((u64)12UL));
+	t__2e2875 = (u64)(*(u32 *)t__2e2873);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e2872, (u64)t__2e2874, (u64)t__2e2875, (u64)((u64)4UL));
+	__builtin_trap();
+}
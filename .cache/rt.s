@@ -0,0 +1,3562 @@
+	.file	"rt.qbe.c"
+	.text
+	.type	BLIT, @function
+BLIT:
+	testq	%rdx, %rdx
+	je	.L1
+	addq	%rsi, %rdx
+	movq	%rsi, %rax
+	subq	%rsi, %rdi
+.L3:
+	leaq	(%rdi,%rax), %rcx
+	movzbl	(%rax), %esi
+	movb	%sil, (%rcx)
+	addq	$1, %rax
+	cmpq	%rdx, %rax
+	jne	.L3
+.L1:
+	ret
+	.size	BLIT, .-BLIT
+	.section	.text.rt.mprotect,"ax",@progbits
+	.globl	rt.mprotect
+	.type	rt.mprotect, @function
+rt.mprotect:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movl	%edx, %ecx
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	movl	$10, %edi
+	movabsq	$rt.syscall3, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.mprotect, .-rt.mprotect
+	.section	.text.rt.munmap,"ax",@progbits
+	.globl	rt.munmap
+	.type	rt.munmap, @function
+rt.munmap:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	movl	$11, %edi
+	movabsq	$rt.syscall2, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.munmap, .-rt.munmap
+	.section	.text.rt.mmap,"ax",@progbits
+	.globl	rt.mmap
+	.type	rt.mmap, @function
+rt.mmap:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	movq	%rdi, %r12
+	movl	%ecx, %ebx
+	movl	%edx, %ecx
+	subq	$8, %rsp
+	pushq	%r9
+	movslq	%r8d, %r9
+	movl	%ebx, %r8d
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	movl	$9, %edi
+	movabsq	$rt.syscall6, %rax
+	call	*%rax
+	addq	$16, %rsp
+	cmpl	$-1, %eax
+	je	.L12
+.L10:
+.L9:
+	leaq	-16(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L12:
+	testq	%r12, %r12
+	jne	.L9
+	testb	$32, %bl
+	je	.L9
+	testb	$16, %bl
+	movq	$-12, %rdx
+	cmove	%rdx, %rax
+	jmp	.L9
+	.size	rt.mmap, .-rt.mmap
+	.section	.text.rt.pipe2,"ax",@progbits
+	.globl	rt.pipe2
+	.type	rt.pipe2, @function
+rt.pipe2:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%esi, %rdx
+	movq	%rdi, %rsi
+	movl	$293, %edi
+	movabsq	$rt.syscall2, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.pipe2, .-rt.pipe2
+	.section	.text.rt.kill,"ax",@progbits
+	.globl	rt.kill
+	.type	rt.kill, @function
+rt.kill:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%esi, %rdx
+	movslq	%edi, %rsi
+	movl	$62, %edi
+	movabsq	$rt.syscall2, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.kill, .-rt.kill
+	.section	.text.rt.wifsignaled,"ax",@progbits
+	.globl	rt.wifsignaled
+	.type	rt.wifsignaled, @function
+rt.wifsignaled:
+	movzwl	%di, %edi
+	subl	$1, %edi
+	cmpl	$254, %edi
+	setle	%al
+	movzbl	%al, %eax
+	ret
+	.size	rt.wifsignaled, .-rt.wifsignaled
+	.section	.text.rt.wtermsig,"ax",@progbits
+	.globl	rt.wtermsig
+	.type	rt.wtermsig, @function
+rt.wtermsig:
+	movl	%edi, %eax
+	andl	$127, %eax
+	ret
+	.size	rt.wtermsig, .-rt.wtermsig
+	.section	.text.rt.wexitstatus,"ax",@progbits
+	.globl	rt.wexitstatus
+	.type	rt.wexitstatus, @function
+rt.wexitstatus:
+	movl	%edi, %eax
+	movzbl	%ah, %eax
+	ret
+	.size	rt.wexitstatus, .-rt.wexitstatus
+	.section	.text.rt.wifexited,"ax",@progbits
+	.globl	rt.wifexited
+	.type	rt.wifexited, @function
+rt.wifexited:
+	testb	$127, %dil
+	sete	%al
+	movzbl	%al, %eax
+	ret
+	.size	rt.wifexited, .-rt.wifexited
+	.section	.text.rt.wait4,"ax",@progbits
+	.globl	rt.wait4
+	.type	rt.wait4, @function
+rt.wait4:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	%rsi, %rax
+	movq	%rcx, %r8
+	movslq	%edx, %rcx
+	movslq	%edi, %rsi
+	movq	%rax, %rdx
+	movl	$61, %edi
+	movabsq	$rt.syscall4, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.wait4, .-rt.wait4
+	.section	.text.rt.execve,"ax",@progbits
+	.globl	rt.execve
+	.type	rt.execve, @function
+rt.execve:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	%rdx, %rcx
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	movl	$59, %edi
+	movabsq	$rt.syscall3, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.execve, .-rt.execve
+	.section	.text.rt.fork,"ax",@progbits
+	.globl	rt.fork
+	.type	rt.fork, @function
+rt.fork:
+	pushq	%rbp
+	movq	%rsp, %rbp
+.L26:
+	movl	$0, %edx
+	movl	$17, %esi
+	movl	$56, %edi
+	movabsq	$rt.syscall2, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.fork, .-rt.fork
+	.section	.text.rt.getpid,"ax",@progbits
+	.globl	rt.getpid
+	.type	rt.getpid, @function
+rt.getpid:
+	pushq	%rbp
+	movq	%rsp, %rbp
+.L29:
+	movl	$39, %edi
+	movabsq	$rt.syscall0, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.getpid, .-rt.getpid
+	.section	.text.rt.dup2,"ax",@progbits
+	.globl	rt.dup2
+	.type	rt.dup2, @function
+rt.dup2:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%esi, %rdx
+	movslq	%edi, %rsi
+	movl	$0, %ecx
+	movl	$292, %edi
+	movabsq	$rt.syscall3, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.dup2, .-rt.dup2
+	.section	.text.rt.dup3,"ax",@progbits
+	.globl	rt.dup3
+	.type	rt.dup3, @function
+rt.dup3:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%edx, %rcx
+	movslq	%esi, %rdx
+	movslq	%edi, %rsi
+	movl	$292, %edi
+	movabsq	$rt.syscall3, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.dup3, .-rt.dup3
+	.section	.text.rt.close,"ax",@progbits
+	.globl	rt.close
+	.type	rt.close, @function
+rt.close:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%edi, %rsi
+	movl	$3, %edi
+	movabsq	$rt.syscall1, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.close, .-rt.close
+	.section	.text.rt.write,"ax",@progbits
+	.globl	rt.write
+	.type	rt.write, @function
+rt.write:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	%rsi, %rax
+	movq	%rdx, %rcx
+	movslq	%edi, %rsi
+	movq	%rax, %rdx
+	movl	$1, %edi
+	movabsq	$rt.syscall3, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.write, .-rt.write
+	.section	.text.rt.strcmp,"ax",@progbits
+	.globl	rt.strcmp
+	.type	rt.strcmp, @function
+rt.strcmp:
+	movq	8(%rdi), %rdx
+	movl	$0, %eax
+	cmpq	8(%rsi), %rdx
+	je	.L46
+.L39:
+	ret
+.L46:
+	movq	(%rdi), %rdi
+	movq	(%rsi), %rcx
+	testq	%rdx, %rdx
+	je	.L43
+	addq	%rdi, %rdx
+	movq	%rdi, %rax
+	subq	%rdi, %rcx
+.L41:
+	movzbl	(%rcx,%rax), %esi
+	cmpb	%sil, (%rax)
+	jne	.L44
+	addq	$1, %rax
+	cmpq	%rdx, %rax
+	jne	.L41
+	movl	$1, %eax
+	ret
+.L43:
+	movl	$1, %eax
+	ret
+.L44:
+	movl	$0, %eax
+	jmp	.L39
+	.size	rt.strcmp, .-rt.strcmp
+	.section	.text.rt.memset,"ax",@progbits
+	.globl	rt.memset
+	.type	rt.memset, @function
+rt.memset:
+	movq	%rdx, %r8
+	movl	%esi, %r9d
+	movl	$0, %eax
+	cmpq	$15, %rdx
+	jbe	.L66
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	movq	%rdi, %r11
+	andl	$7, %r11d
+	je	.L49
+	movq	%rdi, %rcx
+.L50:
+	movb	%r9b, (%rcx)
+	movq	%rcx, %rax
+	addq	$1, %rcx
+	movq	%rcx, %rbx
+	andl	$7, %ebx
+	jne	.L50
+	subq	%rdi, %rax
+	leaq	1(%rax), %r11
+	movzbl	%sil, %edx
+	movabsq	$72340172838076673, %rax
+	imulq	%rax, %rdx
+	movq	%r8, %rax
+	subq	%r11, %rax
+	movq	%rax, %r12
+	shrq	$3, %r12
+	cmpq	$31, %rax
+	jbe	.L55
+.L51:
+	movq	%rcx, %rsi
+	movl	$4, %r10d
+.L54:
+	movq	%rdx, (%rsi)
+	movq	%rdx, 8(%rsi)
+	movq	%rdx, 16(%rsi)
+	movq	%rdx, 24(%rsi)
+	movq	%r10, %rbx
+	addq	$4, %r10
+	addq	$32, %rsi
+	cmpq	%r10, %r12
+	jnb	.L54
+.L55:
+	cmpq	%r12, %rbx
+	jnb	.L53
+.L52:
+	leaq	(%rcx,%rbx,8), %rsi
+	leaq	(%rcx,%r12,8), %rcx
+.L56:
+	movq	%rdx, (%rsi)
+	addq	$8, %rsi
+	cmpq	%rsi, %rcx
+	jne	.L56
+.L53:
+	andq	$-8, %rax
+	addq	%r11, %rax
+	cmpq	%r8, %rax
+	jnb	.L47
+	addq	%rdi, %rax
+	addq	%rdi, %r8
+.L58:
+	movb	%r9b, (%rax)
+	addq	$1, %rax
+	cmpq	%r8, %rax
+	jne	.L58
+.L47:
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L49:
+	movzbl	%sil, %edx
+	movabsq	$72340172838076673, %rax
+	imulq	%rax, %rdx
+	movq	%r8, %r12
+	shrq	$3, %r12
+	movq	%rdi, %rcx
+	movq	%r8, %rax
+	movq	%r11, %rbx
+	cmpq	$31, %r8
+	ja	.L51
+	jmp	.L52
+.L66:
+	cmpq	%rdx, %rax
+	jnb	.L68
+	addq	%rdi, %rax
+	addq	%rdi, %r8
+.L69:
+	movb	%r9b, (%rax)
+	addq	$1, %rax
+	cmpq	%r8, %rax
+	jne	.L69
+.L68:
+	ret
+	.size	rt.memset, .-rt.memset
+	.section	.text.rt.memcpy,"ax",@progbits
+	.globl	rt.memcpy
+	.type	rt.memcpy, @function
+rt.memcpy:
+	movq	%rdi, %r9
+	movq	%rsi, %r10
+	movq	%rdx, %r11
+	cmpq	$15, %rdx
+	jbe	.L86
+	movq	%rdi, %rax
+	xorq	%rsi, %rax
+	testb	$7, %al
+	jne	.L87
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	movq	%rdi, %rbx
+	andl	$7, %ebx
+	je	.L76
+	movq	%rdi, %rdx
+	movq	%rsi, %rcx
+	subq	%rdi, %rcx
+.L77:
+	movzbl	(%rcx,%rdx), %eax
+	movb	%al, (%rdx)
+	movq	%rdx, %rax
+	addq	$1, %rdx
+	movq	%rdx, %r8
+	andl	$7, %r8d
+	jne	.L77
+	subq	%r9, %rax
+	leaq	1(%rax), %rbx
+	leaq	(%r10,%rbx), %r13
+	movq	%r11, %rax
+	subq	%rbx, %rax
+	movq	%rax, %r12
+	shrq	$3, %r12
+	cmpq	$31, %rax
+	jbe	.L82
+.L78:
+	movq	%rdx, %rsi
+	movq	%r13, %rcx
+	movl	$4, %edi
+.L81:
+	movq	(%rcx), %r8
+	movq	%r8, (%rsi)
+	movq	8(%rcx), %r8
+	movq	%r8, 8(%rsi)
+	movq	16(%rcx), %r8
+	movq	%r8, 16(%rsi)
+	movq	24(%rcx), %r8
+	movq	%r8, 24(%rsi)
+	movq	%rdi, %r8
+	addq	$4, %rdi
+	addq	$32, %rcx
+	addq	$32, %rsi
+	cmpq	%rdi, %r12
+	jnb	.L81
+.L82:
+	cmpq	%r12, %r8
+	jnb	.L80
+.L79:
+	leaq	0(%r13,%r8,8), %rcx
+	leaq	0(%r13,%r12,8), %rdi
+	subq	%r13, %rdx
+.L83:
+	movq	(%rcx), %rsi
+	movq	%rsi, (%rdx,%rcx)
+	addq	$8, %rcx
+	cmpq	%rdi, %rcx
+	jne	.L83
+.L80:
+	andq	$-8, %rax
+	addq	%rbx, %rax
+	cmpq	%r11, %rax
+	jnb	.L73
+	addq	%r10, %rax
+	leaq	(%r10,%r11), %rsi
+	movq	%r9, %rcx
+	subq	%r10, %rcx
+.L85:
+	movzbl	(%rax), %edx
+	movb	%dl, (%rcx,%rax)
+	addq	$1, %rax
+	cmpq	%rax, %rsi
+	jne	.L85
+.L73:
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	ret
+.L87:
+	movl	$0, %eax
+	jmp	.L95
+.L76:
+	movq	%rdx, %r12
+	shrq	$3, %r12
+	movq	%rdi, %rdx
+	movq	%r11, %rax
+	movq	%rsi, %r13
+	movq	%rbx, %r8
+	cmpq	$31, %r11
+	ja	.L78
+	jmp	.L79
+.L86:
+	movl	$0, %eax
+	cmpq	%rdx, %rax
+	jnb	.L97
+.L95:
+	addq	%r10, %rax
+	leaq	(%r10,%r11), %rsi
+	movq	%r9, %rcx
+	subq	%r10, %rcx
+.L98:
+	movzbl	(%rax), %edx
+	movb	%dl, (%rcx,%rax)
+	addq	$1, %rax
+	cmpq	%rax, %rsi
+	jne	.L98
+.L97:
+	ret
+	.size	rt.memcpy, .-rt.memcpy
+	.section	.text.rt.memmove,"ax",@progbits
+	.globl	rt.memmove
+	.type	rt.memmove, @function
+rt.memmove:
+	cmpq	%rsi, %rdi
+	je	.L119
+	jb	.L122
+	cmpq	$15, %rdx
+	jbe	.L105
+	movq	%rdi, %rax
+	xorq	%rsi, %rax
+	testb	$7, %al
+	jne	.L106
+	movq	%rdi, %r9
+	negq	%r9
+	andl	$7, %r9d
+	movq	%rdx, %rax
+	subq	%r9, %rax
+	movq	%rax, %rcx
+	shrq	$3, %rcx
+	andq	$-8, %rax
+	orq	%r9, %rax
+	movq	%rax, %r8
+	cmpq	%rdx, %rax
+	jnb	.L107
+	leaq	-1(%rsi,%rdx), %rax
+	leaq	-1(%r8,%rsi), %r10
+	movq	%rdi, %r8
+	subq	%rsi, %r8
+.L108:
+	movzbl	(%rax), %edx
+	movb	%dl, (%r8,%rax)
+	subq	$1, %rax
+	cmpq	%r10, %rax
+	jne	.L108
+.L107:
+	leaq	(%rdi,%r9), %rdx
+	leaq	(%rsi,%r9), %r11
+	cmpq	$3, %rcx
+	jbe	.L109
+	leaq	-8(,%rcx,8), %r8
+	leaq	(%r11,%r8), %rax
+	addq	%r8, %rdx
+	leaq	-40(%r11,%rcx,8), %r10
+	leaq	-32(,%rcx,8), %r8
+	andq	$-32, %r8
+	subq	%r8, %r10
+.L110:
+	movq	(%rax), %r8
+	movq	%r8, (%rdx)
+	movq	-8(%rax), %r8
+	movq	%r8, -8(%rdx)
+	movq	-16(%rax), %r8
+	movq	%r8, -16(%rdx)
+	movq	-24(%rax), %r8
+	movq	%r8, -24(%rdx)
+	subq	$32, %rax
+	subq	$32, %rdx
+	cmpq	%r10, %rax
+	jne	.L110
+	andl	$3, %ecx
+	je	.L111
+.L109:
+	leaq	-8(%r11,%rcx,8), %rax
+	movq	%rdi, %r8
+	subq	%rsi, %r8
+.L112:
+	movq	(%rax), %rdx
+	movq	%rdx, (%r8,%rax)
+	subq	$8, %rax
+	subq	$1, %rcx
+	jne	.L112
+.L111:
+	movq	%r9, %rdx
+.L105:
+	testq	%rdx, %rdx
+	je	.L119
+.L106:
+	leaq	-1(%rsi,%rdx), %rax
+	subq	%rsi, %rdi
+.L113:
+	movzbl	(%rax), %edx
+	movb	%dl, (%rdi,%rax)
+	movq	%rax, %rdx
+	subq	$1, %rax
+	cmpq	%rsi, %rdx
+	jne	.L113
+	ret
+.L122:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movabsq	$rt.memcpy, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+.L103:
+.L119:
+	ret
+	.size	rt.memmove, .-rt.memmove
+	.section	.text.rt.toutf8,"ax",@progbits
+	.globl	rt.toutf8
+	.type	rt.toutf8, @function
+rt.toutf8:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%rbx
+	subq	$8, %rsp
+	movq	%rdi, %rbx
+	movl	$24, %edx
+	movabsq	$BLIT, %rax
+	call	*%rax
+	movq	%rbx, %rax
+	movq	-8(%rbp), %rbx
+	leave
+	ret
+	.size	rt.toutf8, .-rt.toutf8
+	.section	.text.rt.u64tos,"ax",@progbits
+	.type	rt.u64tos, @function
+rt.u64tos:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%rbx
+	subq	$56, %rsp
+	movq	%rdi, %rbx
+	movabsq	$static.2, %rax
+	movq	%rax, -48(%rbp)
+	movq	$0, -40(%rbp)
+	movq	$20, -32(%rbp)
+	movq	%rsi, %rcx
+	movabsq	$-3689348814741910323, %rdi
+	testq	%rsi, %rsi
+	jne	.L126
+	movq	-40(%rbp), %rax
+	leaq	1(%rax), %rdx
+	movq	%rdx, -40(%rbp)
+	cmpq	%rdx, -32(%rbp)
+	jb	.L134
+	movq	-48(%rbp), %rdx
+	movb	$48, (%rdx,%rax)
+	jmp	.L128
+.L135:
+	movq	%rdx, %rcx
+.L126:
+	movq	-40(%rbp), %rsi
+	movq	%rcx, %rax
+	mulq	%rdi
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rdx
+	addq	%rdx, %rdx
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	addl	$48, %eax
+	leaq	1(%rsi), %rdx
+	movq	%rdx, -40(%rbp)
+	cmpq	%rdx, -32(%rbp)
+	jb	.L144
+	movq	-48(%rbp), %rdx
+	movb	%al, (%rdx,%rsi)
+	movq	%rcx, %rax
+	mulq	%rdi
+	shrq	$3, %rdx
+	cmpq	$9, %rcx
+	ja	.L135
+.L128:
+	movq	-40(%rbp), %rax
+	movl	$0, %edx
+	movq	-48(%rbp), %rcx
+	leaq	-1(%rax,%rcx), %rdi
+	subq	$1, %rax
+	je	.L131
+.L133:
+	movq	-40(%rbp), %rcx
+	cmpq	%rcx, %rdx
+	jnb	.L145
+	movq	%rdi, %rsi
+	subq	%rax, %rsi
+	movzbl	(%rsi), %r8d
+	cmpq	%rcx, %rax
+	jnb	.L136
+	movq	%rdi, %rcx
+	subq	%rdx, %rcx
+	movzbl	(%rcx), %r9d
+	movb	%r9b, (%rsi)
+	cmpq	-40(%rbp), %rax
+	jnb	.L137
+	movb	%r8b, (%rcx)
+	addq	$1, %rdx
+	subq	$1, %rax
+	cmpq	%rax, %rdx
+	jb	.L133
+.L131:
+	movq	-48(%rbp), %rax
+	movq	%rax, -64(%rbp)
+	movq	-40(%rbp), %rax
+	movq	%rax, -56(%rbp)
+	movl	$16, %edx
+	leaq	-64(%rbp), %rsi
+	movq	%rbx, %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	movq	%rbx, %rax
+	movq	-8(%rbp), %rbx
+	leave
+	ret
+.L144:
+	movl	$2, %eax
+	jmp	.L127
+.L145:
+	movl	$3, %eax
+.L127:
+	salq	$4, %rax
+	movabsq	$abortsites.2049, %rdx
+	addq	%rdx, %rax
+	movl	12(%rax), %edx
+	movl	8(%rax), %esi
+	movq	(%rax), %rdi
+	movl	$0, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+.L134:
+	movl	$1, %eax
+	jmp	.L127
+.L136:
+	movl	$4, %eax
+	jmp	.L127
+.L137:
+	movl	$5, %eax
+	jmp	.L127
+	.size	rt.u64tos, .-rt.u64tos
+	.section	.text.rt.abort,"ax",@progbits
+	.globl	rt.abort
+	.type	rt.abort, @function
+rt.abort:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$376, %rsp
+	movq	%rdi, %r14
+	movq	%rsi, %r15
+	movq	%rdx, -408(%rbp)
+	movq	%rcx, %r13
+	movl	$24, %edx
+	movabsq	$strliteral.1973, %rsi
+	leaq	-80(%rbp), %rdi
+	movabsq	$BLIT, %rbx
+	call	*%rbx
+	movl	$24, %edx
+	movabsq	$strliteral.1977, %rsi
+	leaq	-112(%rbp), %rdi
+	call	*%rbx
+	movl	$24, %edx
+	movabsq	$strliteral.1980, %rsi
+	leaq	-144(%rbp), %rdi
+	call	*%rbx
+	movl	$24, %edx
+	leaq	-80(%rbp), %rax
+	movq	%rax, %rsi
+	leaq	-176(%rbp), %rdi
+	call	*%rbx
+	movq	-72(%rbp), %rdx
+	movq	-176(%rbp), %rsi
+	movl	$2, %edi
+	movabsq	$rt.write, %r12
+	call	*%r12
+	movl	$24, %edx
+	movq	%r14, %rsi
+	leaq	-208(%rbp), %rdi
+	call	*%rbx
+	movq	8(%r14), %rdx
+	movq	-208(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	leaq	-112(%rbp), %rax
+	movq	%rax, %rsi
+	leaq	-240(%rbp), %rdi
+	call	*%rbx
+	movq	-104(%rbp), %rdx
+	movq	-240(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movq	%r15, %rsi
+	leaq	-256(%rbp), %rdi
+	movabsq	$rt.u64tos, %r14
+	call	*%r14
+	movq	8(%rax), %rdx
+	movq	(%rax), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	leaq	-112(%rbp), %rax
+	movq	%rax, %rsi
+	leaq	-288(%rbp), %rdi
+	call	*%rbx
+	movq	-104(%rbp), %rdx
+	movq	-288(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movq	-408(%rbp), %rsi
+	leaq	-304(%rbp), %rdi
+	call	*%r14
+	movq	8(%rax), %rdx
+	movq	(%rax), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	leaq	-144(%rbp), %rsi
+	leaq	-336(%rbp), %rdi
+	call	*%rbx
+	movq	-136(%rbp), %rdx
+	movq	-336(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	movq	%r13, %rsi
+	leaq	-368(%rbp), %rdi
+	call	*%rbx
+	movq	8(%r13), %rdx
+	movq	-368(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	movabsq	$strliteral.1856, %rsi
+	leaq	-400(%rbp), %rdi
+	call	*%rbx
+	movl	$1, %edx
+	movq	-400(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movabsq	$rt.getpid, %rax
+	call	*%rax
+	movl	%eax, %edi
+	movl	$6, %esi
+	movabsq	$rt.kill, %rax
+	call	*%rax
+	addq	$376, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	ret
+	.size	rt.abort, .-rt.abort
+	.section	.text.rt.abort_fixed,"ax",@progbits
+	.globl	rt.abort_fixed
+	.type	rt.abort_fixed, @function
+rt.abort_fixed:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$40, %rsp
+	movq	%rsi, %r12
+	movq	%rdx, %r13
+	leaq	(%rcx,%rcx,2), %rdx
+	movabsq	$rt.reasons, %rax
+	leaq	(%rax,%rdx,8), %rsi
+	cmpq	$7, %rcx
+	ja	.L149
+	movq	%rdi, %rbx
+	movl	$24, %edx
+	leaq	-64(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-64(%rbp), %rcx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	addq	$40, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	ret
+.L149:
+	movabsq	$abortsites.1955, %rax
+	movl	12(%rax), %edx
+	movl	8(%rax), %esi
+	movl	$0, %ecx
+	movq	(%rax), %rdi
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+	.size	rt.abort_fixed, .-rt.abort_fixed
+	.section	.text.rt.exit,"ax",@progbits
+	.globl	rt.exit
+	.type	rt.exit, @function
+rt.exit:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%edi, %rsi
+	movl	$60, %edi
+	movabsq	$rt.syscall1, %rax
+	call	*%rax
+	movabsq	$abortsites.762, %rax
+	movl	12(%rax), %edx
+	movl	8(%rax), %esi
+	movq	(%rax), %rdi
+	movl	$6, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+	.size	rt.exit, .-rt.exit
+	.section	.text.rt.start_ha,"ax",@progbits
+	.globl	rt.start_ha
+	.type	rt.start_ha, @function
+rt.start_ha:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$8, %rsp
+	movq	%rdi, %r13
+	movabsq	$__init_array_start, %rbx
+	movabsq	$__init_array_end, %rax
+	subq	%rbx, %rax
+	shrq	$3, %rax
+	je	.L155
+	leaq	(%rbx,%rax,8), %r12
+.L156:
+	call	*(%rbx)
+	addq	$8, %rbx
+	cmpq	%r12, %rbx
+	jne	.L156
+.L155:
+	movq	0(%r13), %rdx
+	movq	%rdx, %rax
+	movabsq	%rax, rt.argc
+	leaq	8(%r13), %rax
+	movabsq	%rax, rt.argv
+	leaq	8(%rax,%rdx,8), %rax
+	movabsq	%rax, rt.envp
+	movabsq	$main, %rax
+	call	*%rax
+	movabsq	$__fini_array_start, %rbx
+	movabsq	$__fini_array_end, %rax
+	subq	%rbx, %rax
+	shrq	$3, %rax
+	je	.L157
+	leaq	(%rbx,%rax,8), %r12
+.L158:
+	call	*(%rbx)
+	addq	$8, %rbx
+	cmpq	%rbx, %r12
+	jne	.L158
+.L157:
+	movabsq	$rt.exit_status, %rax
+	movl	(%rax), %edi
+	movabsq	$rt.exit, %rax
+	call	*%rax
+	.size	rt.start_ha, .-rt.start_ha
+	.section	.text.rt.itos,"ax",@progbits
+	.type	rt.itos, @function
+rt.itos:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%rbx
+	subq	$40, %rsp
+	movq	%rdi, %rbx
+	movabsq	$static.3, %rax
+	movq	%rax, -48(%rbp)
+	movq	$0, -40(%rbp)
+	movq	$11, -32(%rbp)
+	testl	%esi, %esi
+	je	.L182
+	cmpl	$-2147483648, %esi
+	je	.L183
+	testl	%esi, %esi
+	js	.L184
+.L166:
+	movl	%esi, %eax
+	testl	%esi, %esi
+	jle	.L168
+.L172:
+	movq	-40(%rbp), %rsi
+	cltq
+	imulq	$1717986919, %rax, %rcx
+	sarq	$34, %rcx
+	movq	%rax, %rdx
+	shrq	$63, %rdx
+	addq	%rcx, %rdx
+	leaq	(%rdx,%rdx,4), %rcx
+	addq	%rcx, %rcx
+	subq	%rcx, %rax
+	addl	$48, %eax
+	leaq	1(%rsi), %rcx
+	movq	%rcx, -40(%rbp)
+	cmpq	%rcx, -32(%rbp)
+	jb	.L185
+	movq	-48(%rbp), %rcx
+	movb	%al, (%rcx,%rsi)
+	movl	%edx, %eax
+	testl	%edx, %edx
+	jg	.L172
+.L168:
+	movq	-40(%rbp), %rax
+	movl	$0, %edx
+	movq	-48(%rbp), %rcx
+	leaq	-1(%rax,%rcx), %rdi
+	subq	$1, %rax
+	je	.L171
+.L174:
+	movq	-40(%rbp), %rcx
+	cmpq	%rcx, %rdx
+	jnb	.L186
+	movq	%rdi, %rsi
+	subq	%rax, %rsi
+	movzbl	(%rsi), %r8d
+	cmpq	%rcx, %rax
+	jnb	.L176
+	movq	%rdi, %rcx
+	subq	%rdx, %rcx
+	movzbl	(%rcx), %r9d
+	movb	%r9b, (%rsi)
+	cmpq	-40(%rbp), %rax
+	jnb	.L177
+	movb	%r8b, (%rcx)
+	addq	$1, %rdx
+	subq	$1, %rax
+	cmpq	%rax, %rdx
+	jb	.L174
+.L171:
+	movl	$24, %edx
+	leaq	-48(%rbp), %rsi
+	movq	%rbx, %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+.L164:
+	movq	%rbx, %rax
+	movq	-8(%rbp), %rbx
+	leave
+	ret
+.L182:
+	movl	$24, %edx
+	movabsq	$strliteral.2296, %rsi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L164
+.L183:
+	movl	$24, %edx
+	movabsq	$strliteral.2310, %rsi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L164
+.L184:
+	movq	-40(%rbp), %rax
+	leaq	1(%rax), %rdx
+	movq	%rdx, -40(%rbp)
+	cmpq	%rdx, -32(%rbp)
+	jb	.L175
+	movq	-48(%rbp), %rdx
+	movb	$45, (%rdx,%rax)
+	negl	%esi
+	jmp	.L166
+.L185:
+	movl	$2, %eax
+	jmp	.L167
+.L186:
+	movl	$3, %eax
+.L167:
+	salq	$4, %rax
+	movabsq	$abortsites.2276, %rdx
+	addq	%rdx, %rax
+	movl	12(%rax), %edx
+	movl	8(%rax), %esi
+	movq	(%rax), %rdi
+	movl	$0, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+.L175:
+	movl	$1, %eax
+	jmp	.L167
+.L176:
+	movl	$5, %eax
+	jmp	.L167
+.L177:
+	movl	$6, %eax
+	jmp	.L167
+	.size	rt.itos, .-rt.itos
+	.section	.text.rt.strstatus,"ax",@progbits
+	.type	rt.strstatus, @function
+rt.strstatus:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%rbx
+	subq	$40, %rsp
+	movq	%rdi, %rbx
+	cmpl	$2, %esi
+	jg	.L188
+	testl	%esi, %esi
+	je	.L200
+	cmpl	$1, %esi
+	je	.L201
+	cmpl	$2, %esi
+	jne	.L195
+	movl	$24, %edx
+	movabsq	$strliteral.2223, %rsi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L193
+.L188:
+	cmpl	$3, %esi
+	je	.L202
+	cmpl	$4, %esi
+	je	.L203
+	cmpl	$255, %esi
+	je	.L204
+.L195:
+	leaq	-48(%rbp), %rdi
+	movabsq	$rt.itos, %rax
+	call	*%rax
+	movq	%rax, %rsi
+	movl	$24, %edx
+	movq	%rbx, %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+.L193:
+	movq	%rbx, %rax
+	movq	-8(%rbp), %rbx
+	leave
+	ret
+.L200:
+	movl	$24, %edx
+	movabsq	$strliteral.2211, %rsi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L193
+.L201:
+	movl	$24, %edx
+	movabsq	$strliteral.2217, %rsi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L193
+.L202:
+	movl	$24, %edx
+	movabsq	$strliteral.2229, %rsi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L193
+.L203:
+	movl	$24, %edx
+	movabsq	$strliteral.2235, %rsi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L193
+.L204:
+	movl	$24, %edx
+	movabsq	$strliteral.2241, %rsi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L193
+	.size	rt.strstatus, .-rt.strstatus
+	.section	.text.rt.constchar,"ax",@progbits
+	.type	rt.constchar, @function
+rt.constchar:
+	movq	(%rdi), %rax
+	ret
+	.size	rt.constchar, .-rt.constchar
+	.section	.text.rt.segmalloc,"ax",@progbits
+	.type	rt.segmalloc, @function
+rt.segmalloc:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	%rdi, %rsi
+	movl	$0, %r9d
+	movl	$-1, %r8d
+	movl	$34, %ecx
+	movl	$3, %edx
+	movl	$0, %edi
+	movabsq	$rt.mmap, %rax
+	call	*%rax
+	cmpl	$-12, %eax
+	movl	$0, %edx
+	cmove	%rdx, %rax
+	popq	%rbp
+	ret
+.L207:
+	.size	rt.segmalloc, .-rt.segmalloc
+	.section	.text.rt.size_getbin,"ax",@progbits
+	.type	rt.size_getbin, @function
+rt.size_getbin:
+	leaq	7(%rdi), %rax
+	shrq	$4, %rax
+	je	.L209
+	cmpq	$1, %rax
+	jbe	.L213
+	movl	$0, %ecx
+	movl	$1, %esi
+.L212:
+	addq	$1, %rcx
+	movq	%rsi, %rdx
+	salq	%cl, %rdx
+	cmpq	%rax, %rdx
+	jb	.L212
+.L211:
+	leaq	1(%rcx), %rax
+.L209:
+	ret
+.L213:
+	movl	$0, %ecx
+	jmp	.L211
+	.size	rt.size_getbin, .-rt.size_getbin
+	.section	.text.rt.segfree,"ax",@progbits
+	.type	rt.segfree, @function
+rt.segfree:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movabsq	$rt.munmap, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.segfree, .-rt.segfree
+	.section	.text.rt.meta_next,"ax",@progbits
+	.type	rt.meta_next, @function
+rt.meta_next:
+	movq	(%rdi), %rax
+	testb	$1, %al
+	je	.L224
+	andq	$-2, %rax
+	ret
+.L224:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	movl	$24, %edx
+	movabsq	$strliteral.2813, %rsi
+	leaq	-32(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-32(%rbp), %rcx
+	movl	$15, %edx
+	movl	$208, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+	.size	rt.meta_next, .-rt.meta_next
+	.section	.text.rt.bin_getsize,"ax",@progbits
+	.type	rt.bin_getsize, @function
+rt.bin_getsize:
+	testq	%rdi, %rdi
+	je	.L226
+	leaq	-1(%rdi), %rcx
+	movl	$1, %edi
+	salq	%cl, %rdi
+.L226:
+	salq	$4, %rdi
+	leaq	8(%rdi), %rax
+	ret
+	.size	rt.bin_getsize, .-rt.bin_getsize
+	.section	.text.rt.size_islarge,"ax",@progbits
+	.type	rt.size_islarge, @function
+rt.size_islarge:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%rbx
+	subq	$8, %rsp
+	movq	%rdi, %rbx
+	movl	$8, %edi
+	movabsq	$rt.bin_getsize, %rax
+	call	*%rax
+	cmpq	%rbx, %rax
+	setb	%al
+	movzbl	%al, %eax
+	movq	-8(%rbp), %rbx
+	leave
+	ret
+	.size	rt.size_islarge, .-rt.size_islarge
+	.section	.text.rt.realsz,"ax",@progbits
+	.type	rt.realsz, @function
+rt.realsz:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%rbx
+	subq	$8, %rsp
+	movq	%rdi, %rbx
+	movabsq	$rt.size_islarge, %rax
+	call	*%rax
+	testb	%al, %al
+	je	.L230
+	leaq	24(%rbx), %rax
+	andl	$4095, %eax
+	leaq	4120(%rbx), %rdx
+	subq	%rax, %rdx
+	addq	$24, %rbx
+	testq	%rax, %rax
+	movq	%rdx, %rax
+	cmove	%rbx, %rax
+.L232:
+	subq	$24, %rax
+.L229:
+	movq	-8(%rbp), %rbx
+	leave
+	ret
+.L230:
+	movq	%rbx, %rdi
+	movabsq	$rt.size_getbin, %rax
+	call	*%rax
+	movq	%rax, %rdi
+	movabsq	$rt.bin_getsize, %rax
+	call	*%rax
+	jmp	.L229
+	.size	rt.realsz, .-rt.realsz
+	.section	.text.rt.validatemeta,"ax",@progbits
+	.type	rt.validatemeta, @function
+rt.validatemeta:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$264, %rsp
+	leaq	8(%rdi), %rax
+	testb	$15, %al
+	jne	.L236
+	movq	%rdi, %rbx
+	movl	%esi, %r13d
+	movq	(%rdi), %r12
+	testb	$1, %r12b
+	jne	.L237
+	cmpb	$1, %sil
+	je	.L237
+	leaq	(%rax,%r12), %r13
+	movq	%r12, %rdi
+	movabsq	$rt.size_islarge, %rax
+	call	*%rax
+	testb	%al, %al
+	je	.L268
+	subq	$8, %rbx
+	testl	$4095, %ebx
+	jne	.L269
+	leaq	24(%r12), %rax
+	testl	$4095, %eax
+	jne	.L270
+	cmpq	0(%r13), %r12
+	jne	.L271
+.L240:
+.L257:
+.L235:
+	addq	$264, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	ret
+.L236:
+	movl	$24, %edx
+	movabsq	$strliteral.2628, %rsi
+	leaq	-64(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-64(%rbp), %rcx
+	movl	$15, %edx
+	movl	$228, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L237:
+	movq	%rbx, %rdi
+	movabsq	$rt.meta_next, %rax
+	call	*%rax
+	movq	%rax, %rdi
+	testq	%rax, %rax
+	je	.L235
+	andl	$15, %eax
+	cmpq	$8, %rax
+	jne	.L244
+	testb	%r13b, %r13b
+	jne	.L235
+	movl	$1, %esi
+	movabsq	$rt.validatemeta, %rax
+	call	*%rax
+	jmp	.L235
+.L244:
+	movl	$24, %edx
+	movabsq	$strliteral.2673, %rsi
+	leaq	-96(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-96(%rbp), %rcx
+	movl	$31, %edx
+	movl	$238, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L268:
+	movq	%r12, %rdi
+	movabsq	$rt.size_getbin, %rax
+	call	*%rax
+	movq	%rax, %rdi
+	movabsq	$rt.bin_getsize, %rax
+	call	*%rax
+	cmpq	%rax, %r12
+	jne	.L272
+	movq	0(%r13), %rbx
+	testb	$1, %bl
+	jne	.L273
+	movq	%rbx, %rdi
+	movabsq	$rt.size_islarge, %rax
+	call	*%rax
+	testb	%al, %al
+	jne	.L255
+	movq	%rbx, %rdi
+	movabsq	$rt.size_getbin, %rax
+	call	*%rax
+	movq	%rax, %rdi
+	movabsq	$rt.bin_getsize, %rax
+	call	*%rax
+	cmpq	%rax, %rbx
+	je	.L235
+	movl	$24, %edx
+	movabsq	$strliteral.2787, %rsi
+	leaq	-288(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-288(%rbp), %rcx
+	movl	$15, %edx
+	movl	$271, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L269:
+	movl	$24, %edx
+	movabsq	$strliteral.2725, %rsi
+	leaq	-128(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-128(%rbp), %rcx
+	movl	$23, %edx
+	movl	$248, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L270:
+	movl	$24, %edx
+	movabsq	$strliteral.2736, %rsi
+	leaq	-160(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-160(%rbp), %rcx
+	movl	$23, %edx
+	movl	$250, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L271:
+	movl	$24, %edx
+	movabsq	$strliteral.2747, %rsi
+	leaq	-192(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-192(%rbp), %rcx
+	movl	$23, %edx
+	movl	$252, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L272:
+	movl	$24, %edx
+	movabsq	$strliteral.2762, %rsi
+	leaq	-224(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-224(%rbp), %rcx
+	movl	$15, %edx
+	movl	$257, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L273:
+	movl	$0, %esi
+	movq	%r13, %rdi
+	movabsq	$rt.validatemeta, %rax
+	call	*%rax
+	jmp	.L235
+.L255:
+	movl	$24, %edx
+	movabsq	$strliteral.2787, %rsi
+	leaq	-256(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-256(%rbp), %rcx
+	movl	$15, %edx
+	movl	$269, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+	.size	rt.validatemeta, .-rt.validatemeta
+	.section	.text.rt.getmeta,"ax",@progbits
+	.globl	rt.getmeta
+	.type	rt.getmeta, @function
+rt.getmeta:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	subq	$32, %rsp
+	movq	%rdi, %rbx
+	leaq	-8(%rdi), %r12
+	movl	$0, %esi
+	movq	%r12, %rdi
+	movabsq	$rt.validatemeta, %rax
+	call	*%rax
+	testb	$1, -8(%rbx)
+	jne	.L278
+	movq	%r12, %rax
+	addq	$32, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L278:
+	movl	$24, %edx
+	movabsq	$strliteral.105, %rsi
+	leaq	-48(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-48(%rbp), %rcx
+	movl	$15, %edx
+	movl	$171, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+	.size	rt.getmeta, .-rt.getmeta
+	.section	.text.rt.free,"ax",@progbits
+	.globl	rt.free
+	.type	rt.free, @function
+rt.free:
+	testq	%rdi, %rdi
+	jne	.L288
+	ret
+.L288:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$8, %rsp
+	movq	%rdi, %rbx
+	movabsq	$rt.getmeta, %rax
+	call	*%rax
+	movq	%rax, %r12
+	movabsq	$rt.cur_allocs, %rax
+	subq	$1, (%rax)
+	movq	(%r12), %r13
+	movq	%r13, %rdi
+	movabsq	$rt.size_islarge, %rax
+	call	*%rax
+	testb	%al, %al
+	je	.L281
+	leaq	24(%r13), %rsi
+	leaq	-16(%rbx), %rdi
+	movabsq	$rt.segfree, %rax
+	call	*%rax
+.L280:
+.L279:
+	addq	$8, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	ret
+.L281:
+	movq	%r13, %rdi
+	movabsq	$rt.size_getbin, %rax
+	call	*%rax
+	movq	%rax, %rbx
+	testq	%r13, %r13
+	jne	.L289
+.L282:
+	movabsq	$rt.bins, %rax
+	leaq	(%rax,%rbx,8), %rdx
+	cmpq	$8, %rbx
+	ja	.L283
+	movq	(%rdx), %rax
+	orq	$1, %rax
+	movq	%rax, (%r12)
+	movq	%r12, (%rdx)
+	jmp	.L279
+.L289:
+	leaq	8(%r12), %rsi
+	movb	$105, 8(%r12)
+	leaq	-1(%r13), %rdx
+	leaq	9(%r12), %rdi
+	movabsq	$rt.memcpy, %rax
+	call	*%rax
+	jmp	.L282
+.L283:
+	movabsq	$abortsites.230, %rax
+	movl	28(%rax), %edx
+	movl	24(%rax), %esi
+	movq	16(%rax), %rdi
+	movl	$0, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+	.size	rt.free, .-rt.free
+	.section	.text.rt.checkpoison,"ax",@progbits
+	.type	rt.checkpoison, @function
+rt.checkpoison:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	subq	$32, %rsp
+	movq	%rdi, %rbx
+	movq	%rsi, %r12
+	movabsq	$rt.meta_next, %rax
+	call	*%rax
+	testq	%rax, %rax
+	jne	.L299
+.L291:
+	testq	%r12, %r12
+	je	.L290
+	leaq	8(%rbx), %rax
+	leaq	8(%rbx,%r12), %rdx
+.L295:
+	cmpb	$105, (%rax)
+	jne	.L297
+	addq	$1, %rax
+	cmpq	%rax, %rdx
+	jne	.L295
+.L290:
+	addq	$32, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L299:
+	movl	$0, %esi
+	movq	%rax, %rdi
+	movabsq	$rt.validatemeta, %rax
+	call	*%rax
+	jmp	.L291
+.L297:
+	movl	$24, %edx
+	movabsq	$strliteral.2918, %rsi
+	leaq	-48(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-48(%rbp), %rcx
+	movl	$23, %edx
+	movl	$288, %esi
+	movabsq	$strliteral.25, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+	.size	rt.checkpoison, .-rt.checkpoison
+	.section	.text.finifunc.0,"ax",@progbits
+	.type	finifunc.0, @function
+finifunc.0:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$8, %rsp
+.L301:
+	movl	$0, %r15d
+	movabsq	$rt.checkpoison, %r14
+	movabsq	$rt.meta_next, %r13
+	jmp	.L304
+.L303:
+	addq	$1, %r15
+	cmpq	$9, %r15
+	je	.L311
+.L304:
+	movabsq	$rt.bins, %rax
+	movq	(%rax,%r15,8), %rbx
+	testq	%rbx, %rbx
+	je	.L303
+	movq	%r15, %rdi
+	movabsq	$rt.bin_getsize, %rax
+	call	*%rax
+	movq	%rax, %r12
+.L306:
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	*%r14
+	movq	%rbx, %rdi
+	call	*%r13
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	jne	.L306
+	jmp	.L303
+.L311:
+	addq	$8, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	ret
+	.size	finifunc.0, .-finifunc.0
+	.section	.text.rt.malloc,"ax",@progbits
+	.globl	rt.malloc
+	.type	rt.malloc, @function
+rt.malloc:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$24, %rsp
+	movq	%rdi, %rbx
+	testq	%rdi, %rdi
+	je	.L313
+	movabsq	$rt.size_islarge, %rax
+	call	*%rax
+	testb	%al, %al
+	je	.L314
+	movq	%rbx, %rdi
+	movabsq	$rt.realsz, %rax
+	call	*%rax
+	movq	%rax, %r12
+	leaq	24(%rax), %rdi
+	movabsq	$rt.segmalloc, %rax
+	call	*%rax
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L313
+	movq	%r12, 8(%rax)
+	movq	%r12, 16(%r12,%rax)
+	movabsq	$rt.cur_allocs, %rax
+	addq	$1, (%rax)
+	leaq	16(%rbx), %rbx
+	jmp	.L313
+.L314:
+	movq	%rbx, %rdi
+	movabsq	$rt.size_getbin, %rax
+	call	*%rax
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	movabsq	$rt.bin_getsize, %rax
+	call	*%rax
+	movq	%rax, %r12
+	movabsq	$rt.bins, %rax
+	leaq	(%rax,%rbx,8), %r13
+	cmpq	$8, %rbx
+	ja	.L325
+	movq	0(%r13), %rbx
+	testq	%rbx, %rbx
+	jne	.L318
+	movabsq	$rt.cur_chunk+8, %r13
+	movq	0(%r13), %rax
+	leaq	16(%r12,%rax), %rax
+	cmpq	$2097152, %rax
+	ja	.L326
+.L320:
+	movq	0(%r13), %rdx
+	movabsq	rt.cur_chunk, %rax
+	leaq	(%rdx,%rax), %rbx
+	leaq	8(%r12,%rdx), %rax
+	movq	%rax, 0(%r13)
+	movq	%r12, (%rbx)
+	movq	%r12, 8(%r12,%rbx)
+	jmp	.L321
+.L318:
+	movq	%rbx, %rdi
+	movabsq	$rt.meta_next, %rax
+	call	*%rax
+	movq	%rax, 0(%r13)
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	movabsq	$rt.checkpoison, %rax
+	call	*%rax
+	movq	%r12, (%rbx)
+.L321:
+	movabsq	$rt.cur_allocs, %rax
+	addq	$1, (%rax)
+	addq	$8, %rbx
+.L313:
+	movq	%rbx, %rax
+	addq	$24, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	ret
+.L326:
+	movl	$2097152, %edi
+	movabsq	$rt.segmalloc, %rax
+	call	*%rax
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L313
+	movq	%rax, -48(%rbp)
+	movq	$8, -40(%rbp)
+	movl	$16, %edx
+	leaq	-48(%rbp), %rsi
+	movabsq	$rt.cur_chunk, %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L320
+.L325:
+.L317:
+	movabsq	$abortsites.377, %rax
+	movl	28(%rax), %edx
+	movl	24(%rax), %esi
+	movq	16(%rax), %rdi
+	movl	$0, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+	.size	rt.malloc, .-rt.malloc
+	.section	.text.rt.realloc,"ax",@progbits
+	.globl	rt.realloc
+	.type	rt.realloc, @function
+rt.realloc:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	movq	%rdi, %r12
+	movq	%rsi, %rbx
+	testq	%rsi, %rsi
+	je	.L333
+	testq	%rdi, %rdi
+	jne	.L330
+	movq	%rsi, %rdi
+	movabsq	$rt.malloc, %rax
+	call	*%rax
+	movq	%rax, %r13
+.L327:
+	movq	%r13, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	ret
+.L333:
+	movabsq	$rt.free, %rax
+	call	*%rax
+	movq	%rbx, %r13
+	jmp	.L327
+.L330:
+	movabsq	$rt.getmeta, %rax
+	call	*%rax
+	movq	%rax, %r14
+	movq	%rbx, %rdi
+	movabsq	$rt.realsz, %rax
+	call	*%rax
+	movq	%r12, %r13
+	cmpq	(%r14), %rax
+	je	.L327
+	movq	%rbx, %rdi
+	movabsq	$rt.malloc, %rax
+	call	*%rax
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L327
+	movq	(%r14), %rax
+	cmpq	%rax, %rbx
+	cmovbe	%rbx, %rax
+	movq	%rax, %rdx
+	leaq	8(%r14), %rsi
+	movq	%r13, %rdi
+	movabsq	$rt.memcpy, %rax
+	call	*%rax
+	movq	%r12, %rdi
+	movabsq	$rt.free, %rax
+	call	*%rax
+	jmp	.L327
+	.size	rt.realloc, .-rt.realloc
+	.section	.text.rt.unensure,"ax",@progbits
+	.globl	rt.unensure
+	.type	rt.unensure, @function
+rt.unensure:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	movq	%rdi, %rbx
+	movq	%rsi, %r12
+	movq	16(%rdi), %rsi
+	movq	8(%rdi), %rax
+	cmpq	%rsi, %rax
+	jnb	.L335
+.L336:
+	shrq	%rsi
+	cmpq	%rsi, %rax
+	jb	.L336
+.L335:
+	addq	%rsi, %rsi
+	movq	%rsi, 16(%rbx)
+	imulq	%r12, %rsi
+	movq	(%rbx), %rdi
+	movabsq	$rt.realloc, %rax
+	call	*%rax
+	testq	%rax, %rax
+	jne	.L337
+	imulq	16(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L338
+.L337:
+	movq	%rax, (%rbx)
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L338:
+	movabsq	$abortsites.1460, %rax
+	movl	12(%rax), %edx
+	movl	8(%rax), %esi
+	movl	$6, %ecx
+	movq	(%rax), %rdi
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+	.size	rt.unensure, .-rt.unensure
+	.section	.text.rt.ensure,"ax",@progbits
+	.globl	rt.ensure
+	.type	rt.ensure, @function
+rt.ensure:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	subq	$32, %rsp
+	movq	%rsi, %r12
+	movq	16(%rdi), %rdx
+	movq	8(%rdi), %rsi
+	cmpq	%rsi, %rdx
+	jnb	.L342
+	movq	%rdi, %rbx
+	movq	%rdx, %rax
+	jmp	.L344
+.L358:
+	movl	$24, %edx
+	movabsq	$strliteral.1516, %rsi
+	leaq	-48(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-48(%rbp), %rcx
+	movl	$23, %edx
+	movl	$13, %esi
+	movabsq	$strliteral.7, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L359:
+	addq	%rax, %rax
+	cmpq	%rsi, %rax
+	jnb	.L357
+	cmpq	%rdx, %rax
+	jb	.L358
+.L344:
+	testq	%rax, %rax
+	jne	.L359
+.L348:
+	movq	%rsi, 16(%rbx)
+	imulq	%r12, %rsi
+	movq	(%rbx), %rdi
+	movabsq	$rt.realloc, %rax
+	call	*%rax
+	testq	%rax, %rax
+	jne	.L346
+	imulq	16(%rbx), %r12
+	testq	%r12, %r12
+	jne	.L351
+.L346:
+	movq	%rax, (%rbx)
+.L343:
+.L342:
+	addq	$32, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L357:
+	movq	%rax, %rsi
+	jmp	.L348
+.L351:
+	movabsq	$abortsites.1562, %rax
+	movl	12(%rax), %edx
+	movl	8(%rax), %esi
+	movl	$6, %ecx
+	movq	(%rax), %rdi
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+	.size	rt.ensure, .-rt.ensure
+	.section	.text.rt.alloc_constchar,"ax",@progbits
+	.type	rt.alloc_constchar, @function
+rt.alloc_constchar:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	subq	$64, %rsp
+	movq	%rdi, %r12
+	movq	8(%rdi), %rax
+	leaq	1(%rax), %rbx
+	movq	%rbx, %rax
+	testq	%rbx, %rbx
+	jne	.L366
+.L361:
+	movq	%rax, -48(%rbp)
+	movq	$0, -40(%rbp)
+	movq	%rbx, -32(%rbp)
+	movq	8(%r12), %rbx
+	movq	%rbx, -40(%rbp)
+	cmpq	%rbx, -32(%rbp)
+	jb	.L367
+.L362:
+	movq	(%r12), %rsi
+	movq	%rbx, %rdx
+	movq	-48(%rbp), %rdi
+	movabsq	$rt.memmove, %rax
+	call	*%rax
+	movq	-40(%rbp), %rbx
+	leaq	1(%rbx), %rax
+	movq	%rax, -40(%rbp)
+	cmpq	%rax, -32(%rbp)
+	jb	.L368
+.L363:
+	movq	-48(%rbp), %rax
+	movb	$0, (%rax,%rbx)
+	movl	$24, %edx
+	leaq	-48(%rbp), %rsi
+	leaq	-80(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	movq	-80(%rbp), %rax
+	addq	$64, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L366:
+	movq	%rbx, %rdi
+	movabsq	$rt.malloc, %rax
+	call	*%rax
+	testq	%rax, %rax
+	jne	.L361
+	movabsq	$abortsites.2453, %rax
+	movl	28(%rax), %edx
+	movl	24(%rax), %esi
+	movq	16(%rax), %rdi
+	movl	$2, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+.L367:
+	movl	$1, %esi
+	leaq	-48(%rbp), %rdi
+	movabsq	$rt.ensure, %rax
+	call	*%rax
+	jmp	.L362
+.L368:
+	movl	$1, %esi
+	leaq	-48(%rbp), %rdi
+	movabsq	$rt.ensure, %rax
+	call	*%rax
+	jmp	.L363
+	.size	rt.alloc_constchar, .-rt.alloc_constchar
+	.section	.text.rt.compile,"ax",@progbits
+	.globl	rt.compile
+	.type	rt.compile, @function
+rt.compile:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$808, %rsp
+	movq	%rdi, -840(%rbp)
+	movq	%rsi, -848(%rbp)
+	movq	%rdx, %rbx
+	movq	%rcx, %r14
+	movl	$-1282287024, -64(%rbp)
+	movl	$0, -80(%rbp)
+	movl	$-1, -96(%rbp)
+	movl	$-1, -92(%rbp)
+	movl	$0, %esi
+	leaq	-96(%rbp), %rdi
+	movabsq	$rt.pipe2, %rax
+	call	*%rax
+	testl	%eax, %eax
+	jne	.L398
+	movabsq	$rt.fork, %rax
+	call	*%rax
+	movl	%eax, %r15d
+	testl	%eax, %eax
+	je	.L412
+	cmpl	$-1, %eax
+	je	.L413
+	movl	-96(%rbp), %edi
+	movabsq	$rt.close, %rax
+	call	*%rax
+	movl	$24, %edx
+	movq	%rbx, %rsi
+	leaq	-448(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	movq	-448(%rbp), %r14
+	leaq	8(%rbx), %r13
+	movq	8(%rbx), %rdx
+	movl	$0, %ebx
+	movabsq	$rt.write, %r12
+	testq	%rdx, %rdx
+	je	.L387
+.L386:
+	subq	%rbx, %rdx
+	leaq	(%rbx,%r14), %rsi
+	movl	-92(%rbp), %edi
+	call	*%r12
+	testq	%rax, %rax
+	je	.L414
+	addq	%rax, %rbx
+	movq	0(%r13), %rdx
+	cmpq	%rdx, %rbx
+	jb	.L386
+.L387:
+	movl	-92(%rbp), %edi
+	movabsq	$rt.close, %rax
+	call	*%rax
+	movl	$0, %ecx
+	movl	$0, %edx
+	leaq	-80(%rbp), %rsi
+	movl	%r15d, %edi
+	movabsq	$rt.wait4, %rax
+	call	*%rax
+	movl	-80(%rbp), %eax
+	testb	$127, %al
+	jne	.L390
+	movq	-848(%rbp), %rcx
+	movl	(%rcx), %edx
+	cmpl	$-1282287024, %edx
+	je	.L393
+	cmpl	$-762657217, %edx
+	jne	.L396
+	movq	-848(%rbp), %rcx
+	movl	4(%rcx), %r13d
+	movzbl	%ah, %ebx
+	cmpl	%ebx, %r13d
+	jne	.L415
+.L393:
+	movl	$4, %edx
+	leaq	-64(%rbp), %rsi
+	movq	-840(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L395
+.L412:
+	movl	-92(%rbp), %edi
+	movabsq	$rt.close, %rbx
+	call	*%rbx
+	movl	$0, %esi
+	movl	-96(%rbp), %edi
+	movabsq	$rt.dup2, %rax
+	call	*%rax
+	movl	$1, %edi
+	call	*%rbx
+	movl	$2, %edi
+	call	*%rbx
+	movq	$0, -128(%rbp)
+	movq	$0, -120(%rbp)
+	movq	$0, -112(%rbp)
+	movl	$24, %edx
+	movabsq	$strliteral.1634, %rsi
+	leaq	-256(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-256(%rbp), %rdi
+	movabsq	$rt.alloc_constchar, %rax
+	call	*%rax
+	movq	%rax, %rbx
+	movq	$1, -120(%rbp)
+	cmpq	$0, -112(%rbp)
+	je	.L416
+.L372:
+	movq	-128(%rbp), %rax
+	movq	%rbx, (%rax)
+	leaq	8(%r14), %r15
+	cmpq	$0, 8(%r14)
+	je	.L376
+	movl	$0, %ebx
+	jmp	.L381
+.L416:
+	movl	$8, %esi
+	leaq	-128(%rbp), %rdi
+	movabsq	$rt.ensure, %rax
+	call	*%rax
+	jmp	.L372
+.L376:
+	movq	-120(%rbp), %r12
+	movl	$24, %edx
+	movabsq	$strliteral.1680, %rsi
+	leaq	-320(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-320(%rbp), %rdi
+	movabsq	$rt.alloc_constchar, %rax
+	call	*%rax
+	movq	%rax, %rbx
+	leaq	1(%r12), %rax
+	movq	%rax, -120(%rbp)
+	cmpq	%rax, -112(%rbp)
+	jb	.L417
+.L379:
+	movq	-128(%rbp), %rax
+	movq	%rbx, (%rax,%r12,8)
+	movq	-120(%rbp), %r12
+	movl	$24, %edx
+	movabsq	$strliteral.1694, %rsi
+	leaq	-352(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-352(%rbp), %rdi
+	movabsq	$rt.alloc_constchar, %rax
+	call	*%rax
+	movq	%rax, %rbx
+	leaq	1(%r12), %rax
+	movq	%rax, -120(%rbp)
+	cmpq	%rax, -112(%rbp)
+	jb	.L418
+.L382:
+	movq	-128(%rbp), %rax
+	movq	%rbx, (%rax,%r12,8)
+	movq	-120(%rbp), %r12
+	leaq	1(%r12), %rax
+	movq	%rax, -120(%rbp)
+	cmpq	%rax, -112(%rbp)
+	jb	.L419
+.L383:
+	movq	-128(%rbp), %rbx
+	movq	$0, (%rbx,%r12,8)
+	movl	$24, %edx
+	movabsq	$strliteral.1718, %rsi
+	leaq	-384(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	movabsq	$rt.envp, %rax
+	movq	(%rax), %rdx
+	movq	%rbx, %rsi
+	movq	-384(%rbp), %rdi
+	movabsq	$rt.execve, %rax
+	call	*%rax
+	movabsq	$abortsites.1597, %rax
+	movq	16(%rax), %r15
+	movl	24(%rax), %ecx
+	movl	%ecx, -840(%rbp)
+	movl	28(%rax), %r14d
+	cmpq	$0, -120(%rbp)
+	je	.L384
+	movl	$0, %r12d
+	movabsq	$rt.free, %r13
+.L385:
+	movq	(%rbx), %rdi
+	call	*%r13
+	addq	$1, %r12
+	addq	$8, %rbx
+	cmpq	-120(%rbp), %r12
+	jb	.L385
+.L384:
+	movl	%r14d, %edx
+	movl	-840(%rbp), %esi
+	movl	$6, %ecx
+	movq	%r15, %rdi
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+.L377:
+	movq	-128(%rbp), %rax
+	movq	%r12, (%rax,%r13,8)
+	addq	$1, %rbx
+	cmpq	(%r15), %rbx
+	jnb	.L376
+.L381:
+	movq	-120(%rbp), %r13
+	leaq	(%rbx,%rbx,2), %rax
+	movq	(%r14), %rdx
+	leaq	(%rdx,%rax,8), %rsi
+	movl	$24, %edx
+	leaq	-288(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-288(%rbp), %rdi
+	movabsq	$rt.alloc_constchar, %rax
+	call	*%rax
+	movq	%rax, %r12
+	leaq	1(%r13), %rax
+	movq	%rax, -120(%rbp)
+	cmpq	%rax, -112(%rbp)
+	jnb	.L377
+	movl	$8, %esi
+	leaq	-128(%rbp), %rdi
+	movabsq	$rt.ensure, %rax
+	call	*%rax
+	jmp	.L377
+.L417:
+	movl	$8, %esi
+	leaq	-128(%rbp), %rdi
+	movabsq	$rt.ensure, %rax
+	call	*%rax
+	jmp	.L379
+.L418:
+	movl	$8, %esi
+	leaq	-128(%rbp), %rdi
+	movabsq	$rt.ensure, %rax
+	call	*%rax
+	jmp	.L382
+.L419:
+	movl	$8, %esi
+	leaq	-128(%rbp), %rdi
+	movabsq	$rt.ensure, %rax
+	call	*%rax
+	jmp	.L383
+.L413:
+	movl	$24, %edx
+	movabsq	$strliteral.1772, %rsi
+	leaq	-416(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-416(%rbp), %rcx
+	movl	$23, %edx
+	movl	$64, %esi
+	movabsq	$strliteral.3, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L414:
+	movl	$24, %edx
+	movabsq	$strliteral.1811, %rsi
+	leaq	-480(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-480(%rbp), %rcx
+	movl	$31, %edx
+	movl	$70, %esi
+	movabsq	$strliteral.3, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L390:
+	movzwl	%ax, %eax
+	subl	$1, %eax
+	cmpl	$254, %eax
+	jg	.L420
+	movl	$24, %edx
+	movabsq	$strliteral.1839, %rsi
+	leaq	-160(%rbp), %rdi
+	movabsq	$BLIT, %rbx
+	call	*%rbx
+	movl	$24, %edx
+	leaq	-160(%rbp), %rsi
+	leaq	-512(%rbp), %rdi
+	call	*%rbx
+	movq	-152(%rbp), %rdx
+	movq	-512(%rbp), %rsi
+	movl	$2, %edi
+	movabsq	$rt.write, %r12
+	call	*%r12
+	movl	-80(%rbp), %esi
+	andl	$127, %esi
+	leaq	-544(%rbp), %rdi
+	movabsq	$rt.itos, %rax
+	call	*%rax
+	movq	%rax, %rsi
+	movl	$24, %edx
+	leaq	-160(%rbp), %rdi
+	call	*%rbx
+	movl	$24, %edx
+	leaq	-160(%rbp), %rsi
+	leaq	-576(%rbp), %rdi
+	call	*%rbx
+	movq	-152(%rbp), %rdx
+	movq	-576(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	movabsq	$strliteral.1856, %rsi
+	leaq	-608(%rbp), %rdi
+	call	*%rbx
+	movl	$1, %edx
+	movq	-608(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$583903339, -176(%rbp)
+	movl	$4, %edx
+	leaq	-176(%rbp), %rsi
+	movq	-840(%rbp), %rdi
+	call	*%rbx
+.L395:
+	movq	-840(%rbp), %rax
+	addq	$808, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	ret
+.L420:
+	movl	$3, %eax
+	jmp	.L370
+.L396:
+	movabsq	$abortsites.1597, %rax
+	movl	76(%rax), %edx
+	movl	72(%rax), %esi
+	movq	64(%rax), %rdi
+	movl	$4, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+.L415:
+	movl	$24, %edx
+	movabsq	$strliteral.1896, %rsi
+	leaq	-208(%rbp), %rdi
+	movabsq	$BLIT, %r12
+	call	*%r12
+	movl	$24, %edx
+	leaq	-208(%rbp), %rsi
+	leaq	-640(%rbp), %rdi
+	call	*%r12
+	movq	-200(%rbp), %rdx
+	movq	-640(%rbp), %rsi
+	movl	$2, %edi
+	movabsq	$rt.write, %r14
+	call	*%r14
+	movl	%r13d, %esi
+	leaq	-672(%rbp), %rdi
+	movabsq	$rt.strstatus, %r13
+	call	*%r13
+	movq	%rax, %rsi
+	movl	$24, %edx
+	leaq	-208(%rbp), %rdi
+	call	*%r12
+	movl	$24, %edx
+	leaq	-208(%rbp), %rsi
+	leaq	-704(%rbp), %rdi
+	call	*%r12
+	movq	-200(%rbp), %rdx
+	movq	-704(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r14
+	movl	$24, %edx
+	movabsq	$strliteral.1911, %rsi
+	leaq	-208(%rbp), %rdi
+	call	*%r12
+	movl	$24, %edx
+	leaq	-208(%rbp), %rsi
+	leaq	-736(%rbp), %rdi
+	call	*%r12
+	movq	-200(%rbp), %rdx
+	movq	-736(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r14
+	movl	%ebx, %esi
+	leaq	-768(%rbp), %rdi
+	call	*%r13
+	movq	%rax, %rsi
+	movl	$24, %edx
+	leaq	-208(%rbp), %rdi
+	call	*%r12
+	movl	$24, %edx
+	leaq	-208(%rbp), %rsi
+	leaq	-800(%rbp), %rdi
+	call	*%r12
+	movq	-200(%rbp), %rdx
+	movq	-800(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r14
+	movl	$24, %edx
+	movabsq	$strliteral.1856, %rsi
+	leaq	-832(%rbp), %rdi
+	call	*%r12
+	movl	$1, %edx
+	movq	-832(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r14
+	movl	$583903339, -224(%rbp)
+	movl	$4, %edx
+	leaq	-224(%rbp), %rsi
+	movq	-840(%rbp), %rdi
+	call	*%r12
+	jmp	.L395
+.L398:
+	movl	$0, %eax
+.L370:
+	salq	$4, %rax
+	movabsq	$abortsites.1597, %rdx
+	addq	%rdx, %rax
+	movl	12(%rax), %edx
+	movl	8(%rax), %esi
+	movl	$6, %ecx
+	movq	(%rax), %rdi
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+	.size	rt.compile, .-rt.compile
+	.section	.bss.rt.bins,"aw",@nobits
+	.align 8
+	.type	rt.bins, @object
+	.size	rt.bins, 72
+rt.bins:
+	.zero	72
+	.section	.data.rel.ro.abortsites.2868,"aw"
+	.align 8
+	.type	abortsites.2868, @object
+	.size	abortsites.2868, 16
+abortsites.2868:
+	.quad	strliteral.25
+	.long	277
+	.long	14
+	.section	.data.rel.ro.strliteral.2918,"aw"
+	.align 8
+	.type	strliteral.2918, @object
+	.size	strliteral.2918, 24
+strliteral.2918:
+	.quad	strdata.2917
+	.quad	49
+	.quad	49
+	.section	.rodata.strdata.2917,"a"
+	.align 8
+	.type	strdata.2917, @object
+	.size	strdata.2917, 49
+strdata.2917:
+	.ascii	"invalid poison data on freelist (use after free?)"
+	.section	.data.rel.ro.strliteral.2892,"aw"
+	.align 8
+	.type	strliteral.2892, @object
+	.size	strliteral.2892, 24
+strliteral.2892:
+	.quad	strdata.2891
+	.quad	44
+	.quad	44
+	.section	.rodata.strdata.2891,"a"
+	.align 8
+	.type	strdata.2891, @object
+	.size	strdata.2891, 44
+strdata.2891:
+	.ascii	"invalid canary on freelist (use after free?)"
+	.section	.data.rel.ro.strliteral.2813,"aw"
+	.align 8
+	.type	strliteral.2813, @object
+	.size	strliteral.2813, 24
+strliteral.2813:
+	.quad	strdata.2812
+	.quad	69
+	.quad	69
+	.section	.rodata.strdata.2812,"a"
+	.align 8
+	.type	strdata.2812, @object
+	.size	strdata.2812, 69
+strdata.2812:
+	.ascii	"expected metadata on freelist to be marked as free (heap cor"
+	.ascii	"ruption?)"
+	.section	.data.rel.ro.abortsites.2685,"aw"
+	.align 8
+	.type	abortsites.2685, @object
+	.size	abortsites.2685, 16
+abortsites.2685:
+	.quad	strliteral.25
+	.long	235
+	.long	22
+	.section	.data.rel.ro.strliteral.2787,"aw"
+	.align 8
+	.type	strliteral.2787, @object
+	.size	strliteral.2787, 24
+strliteral.2787:
+	.quad	strdata.2786
+	.quad	70
+	.quad	70
+	.section	.rodata.strdata.2786,"a"
+	.align 8
+	.type	strdata.2786, @object
+	.size	strdata.2786, 70
+strdata.2786:
+	.ascii	"invalid secondary metadata for small allocation (out-of-boun"
+	.ascii	"ds write?)"
+	.section	.data.rel.ro.strliteral.2762,"aw"
+	.align 8
+	.type	strliteral.2762, @object
+	.size	strliteral.2762, 24
+strliteral.2762:
+	.quad	strdata.2761
+	.quad	57
+	.quad	57
+	.section	.rodata.strdata.2761,"a"
+	.align 8
+	.type	strdata.2761, @object
+	.size	strdata.2761, 57
+strdata.2761:
+	.ascii	"invalid metadata for small allocation (non-heap pointer?)"
+	.section	.data.rel.ro.strliteral.2747,"aw"
+	.align 8
+	.type	strliteral.2747, @object
+	.size	strliteral.2747, 24
+strliteral.2747:
+	.quad	strdata.2746
+	.quad	70
+	.quad	70
+	.section	.rodata.strdata.2746,"a"
+	.align 8
+	.type	strdata.2746, @object
+	.size	strdata.2746, 70
+strdata.2746:
+	.ascii	"invalid secondary metadata for large allocation (out-of-boun"
+	.ascii	"ds write?)"
+	.section	.data.rel.ro.strliteral.2736,"aw"
+	.align 8
+	.type	strliteral.2736, @object
+	.size	strliteral.2736, 24
+strliteral.2736:
+	.quad	strdata.2735
+	.quad	57
+	.quad	57
+	.section	.rodata.strdata.2735,"a"
+	.align 8
+	.type	strdata.2735, @object
+	.size	strdata.2735, 57
+strdata.2735:
+	.ascii	"invalid metadata for large allocation (non-heap pointer?)"
+	.section	.data.rel.ro.strliteral.2725,"aw"
+	.align 8
+	.type	strliteral.2725, @object
+	.size	strliteral.2725, 24
+strliteral.2725:
+	.quad	strdata.2724
+	.quad	52
+	.quad	52
+	.section	.rodata.strdata.2724,"a"
+	.align 8
+	.type	strdata.2724, @object
+	.size	strdata.2724, 52
+strdata.2724:
+	.ascii	"invalid large allocation address (non-heap pointer?)"
+	.section	.data.rel.ro.strliteral.2673,"aw"
+	.align 8
+	.type	strliteral.2673, @object
+	.size	strliteral.2673, 24
+strliteral.2673:
+	.quad	strdata.2672
+	.quad	68
+	.quad	68
+	.section	.rodata.strdata.2672,"a"
+	.align 8
+	.type	strdata.2672, @object
+	.size	strdata.2672, 68
+strdata.2672:
+	.ascii	"invalid metadata for small allocation on freelist (heap corr"
+	.ascii	"uption?)"
+	.section	.data.rel.ro.strliteral.2628,"aw"
+	.align 8
+	.type	strliteral.2628, @object
+	.size	strliteral.2628, 24
+strliteral.2628:
+	.quad	strdata.2627
+	.quad	57
+	.quad	57
+	.section	.rodata.strdata.2627,"a"
+	.align 8
+	.type	strdata.2627, @object
+	.size	strdata.2627, 57
+strdata.2627:
+	.ascii	"invalid alignment for metadata pointer (heap corruption?)"
+	.section	.bss.rt.cur_allocs,"aw",@nobits
+	.align 8
+	.type	rt.cur_allocs, @object
+	.size	rt.cur_allocs, 8
+rt.cur_allocs:
+	.zero	8
+	.section	.data.rt.cur_chunk,"aw"
+	.align 8
+	.type	rt.cur_chunk, @object
+	.size	rt.cur_chunk, 16
+rt.cur_chunk:
+	.quad	0
+	.quad	2097152
+	.section	.bss.rt.argc,"aw",@nobits
+	.align 8
+	.type	rt.argc, @object
+	.size	rt.argc, 8
+rt.argc:
+	.zero	8
+	.section	.bss.rt.argv,"aw",@nobits
+	.align 8
+	.type	rt.argv, @object
+	.size	rt.argv, 8
+rt.argv:
+	.zero	8
+	.section	.bss.rt.envp,"aw",@nobits
+	.align 8
+	.type	rt.envp, @object
+	.size	rt.envp, 8
+rt.envp:
+	.zero	8
+	.section	.data.rel.ro.abortsites.2453,"aw"
+	.align 8
+	.type	abortsites.2453, @object
+	.size	abortsites.2453, 32
+abortsites.2453:
+	.quad	strliteral.5
+	.long	15
+	.long	23
+	.quad	strliteral.5
+	.long	15
+	.long	23
+	.section	.data.rel.ro.abortsites.2276,"aw"
+	.align 8
+	.type	abortsites.2276, @object
+	.size	abortsites.2276, 112
+abortsites.2276:
+	.quad	strliteral.9
+	.long	6
+	.long	21
+	.quad	strliteral.9
+	.long	13
+	.long	24
+	.quad	strliteral.9
+	.long	17
+	.long	24
+	.quad	strliteral.9
+	.long	21
+	.long	29
+	.quad	strliteral.9
+	.long	22
+	.long	19
+	.quad	strliteral.9
+	.long	22
+	.long	27
+	.quad	strliteral.9
+	.long	23
+	.long	19
+	.section	.data.rel.ro.strliteral.2310,"aw"
+	.align 8
+	.type	strliteral.2310, @object
+	.size	strliteral.2310, 24
+strliteral.2310:
+	.quad	strdata.2309
+	.quad	11
+	.quad	11
+	.section	.rodata.strdata.2309,"a"
+	.align 8
+	.type	strdata.2309, @object
+	.size	strdata.2309, 11
+strdata.2309:
+	.ascii	"-2147483648"
+	.section	.data.rel.ro.strliteral.2296,"aw"
+	.align 8
+	.type	strliteral.2296, @object
+	.size	strliteral.2296, 24
+strliteral.2296:
+	.quad	strdata.2295
+	.quad	1
+	.quad	1
+	.section	.rodata.strdata.2295,"a"
+	.align 8
+	.type	strdata.2295, @object
+	.size	strdata.2295, 1
+strdata.2295:
+	.ascii	"0"
+	.section	.bss.static.3,"aw",@nobits
+	.align 8
+	.type	static.3, @object
+	.size	static.3, 11
+static.3:
+	.zero	11
+	.section	.data.rel.ro.abortsites.2250,"aw"
+	.align 8
+	.type	abortsites.2250, @object
+	.size	abortsites.2250, 16
+abortsites.2250:
+	.quad	strliteral.3
+	.long	11
+	.long	15
+	.section	.data.rel.ro.strliteral.2241,"aw"
+	.align 8
+	.type	strliteral.2241, @object
+	.size	strliteral.2241, 24
+strliteral.2241:
+	.quad	strdata.2240
+	.quad	14
+	.quad	14
+	.section	.rodata.strdata.2240,"a"
+	.align 8
+	.type	strdata.2240, @object
+	.size	strdata.2240, 14
+strdata.2240:
+	.ascii	"abnormal (255)"
+	.section	.data.rel.ro.strliteral.2235,"aw"
+	.align 8
+	.type	strliteral.2235, @object
+	.size	strliteral.2235, 24
+strliteral.2235:
+	.quad	strdata.2234
+	.quad	9
+	.quad	9
+	.section	.rodata.strdata.2234,"a"
+	.align 8
+	.type	strdata.2234, @object
+	.size	strdata.2234, 9
+strdata.2234:
+	.ascii	"check (4)"
+	.section	.data.rel.ro.strliteral.2229,"aw"
+	.align 8
+	.type	strliteral.2229, @object
+	.size	strliteral.2229, 24
+strliteral.2229:
+	.quad	strdata.2228
+	.quad	9
+	.quad	9
+	.section	.rodata.strdata.2228,"a"
+	.align 8
+	.type	strdata.2228, @object
+	.size	strdata.2228, 9
+strdata.2228:
+	.ascii	"parse (3)"
+	.section	.data.rel.ro.strliteral.2223,"aw"
+	.align 8
+	.type	strliteral.2223, @object
+	.size	strliteral.2223, 24
+strliteral.2223:
+	.quad	strdata.2222
+	.quad	7
+	.quad	7
+	.section	.rodata.strdata.2222,"a"
+	.align 8
+	.type	strdata.2222, @object
+	.size	strdata.2222, 7
+strdata.2222:
+	.ascii	"lex (2)"
+	.section	.data.rel.ro.strliteral.2217,"aw"
+	.align 8
+	.type	strliteral.2217, @object
+	.size	strliteral.2217, 24
+strliteral.2217:
+	.quad	strdata.2216
+	.quad	8
+	.quad	8
+	.section	.rodata.strdata.2216,"a"
+	.align 8
+	.type	strdata.2216, @object
+	.size	strdata.2216, 8
+strdata.2216:
+	.ascii	"user (1)"
+	.section	.data.rel.ro.strliteral.2211,"aw"
+	.align 8
+	.type	strliteral.2211, @object
+	.size	strliteral.2211, 24
+strliteral.2211:
+	.quad	strdata.2210
+	.quad	11
+	.quad	11
+	.section	.rodata.strdata.2210,"a"
+	.align 8
+	.type	strdata.2210, @object
+	.size	strdata.2210, 11
+strdata.2210:
+	.ascii	"success (0)"
+	.section	.data.rt.reasons,"aw"
+	.align 8
+	.type	rt.reasons, @object
+	.size	rt.reasons, 192
+rt.reasons:
+	.quad	strdata.2169
+	.quad	35
+	.quad	35
+	.quad	strdata.2170
+	.quad	21
+	.quad	21
+	.quad	strdata.2171
+	.quad	13
+	.quad	13
+	.quad	strdata.2172
+	.quad	36
+	.quad	36
+	.quad	strdata.2173
+	.quad	16
+	.quad	16
+	.quad	strdata.2174
+	.quad	50
+	.quad	50
+	.quad	strdata.2175
+	.quad	16
+	.quad	16
+	.quad	strdata.2176
+	.quad	14
+	.quad	14
+	.section	.rodata.strdata.2176,"a"
+	.align 8
+	.type	strdata.2176, @object
+	.size	strdata.2176, 14
+strdata.2176:
+	.ascii	"error occurred"
+	.section	.rodata.strdata.2175,"a"
+	.align 8
+	.type	strdata.2175, @object
+	.size	strdata.2175, 16
+strdata.2175:
+	.ascii	"assertion failed"
+	.section	.rodata.strdata.2174,"a"
+	.align 8
+	.type	strdata.2174, @object
+	.size	strdata.2174, 50
+strdata.2174:
+	.ascii	"slice allocation capacity smaller than initializer"
+	.section	.rodata.strdata.2173,"a"
+	.align 8
+	.type	strdata.2173, @object
+	.size	strdata.2173, 16
+strdata.2173:
+	.ascii	"unreachable code"
+	.section	.rodata.strdata.2172,"a"
+	.align 8
+	.type	strdata.2172, @object
+	.size	strdata.2172, 36
+strdata.2172:
+	.ascii	"static append exceeds slice capacity"
+	.section	.rodata.strdata.2171,"a"
+	.align 8
+	.type	strdata.2171, @object
+	.size	strdata.2171, 13
+strdata.2171:
+	.ascii	"out of memory"
+	.section	.rodata.strdata.2170,"a"
+	.align 8
+	.type	strdata.2170, @object
+	.size	strdata.2170, 21
+strdata.2170:
+	.ascii	"type assertion failed"
+	.section	.rodata.strdata.2169,"a"
+	.align 8
+	.type	strdata.2169, @object
+	.size	strdata.2169, 35
+strdata.2169:
+	.ascii	"slice or array access out of bounds"
+	.section	.data.rel.ro.abortsites.2049,"aw"
+	.align 8
+	.type	abortsites.2049, @object
+	.size	abortsites.2049, 96
+abortsites.2049:
+	.quad	strliteral.1
+	.long	42
+	.long	21
+	.quad	strliteral.1
+	.long	44
+	.long	24
+	.quad	strliteral.1
+	.long	47
+	.long	24
+	.quad	strliteral.1
+	.long	51
+	.long	29
+	.quad	strliteral.1
+	.long	52
+	.long	27
+	.quad	strliteral.1
+	.long	53
+	.long	19
+	.section	.bss.static.2,"aw",@nobits
+	.align 8
+	.type	static.2, @object
+	.size	static.2, 20
+static.2:
+	.zero	20
+	.globl	rt.exit_status
+	.section	.bss.rt.exit_status,"aw",@nobits
+	.align 8
+	.type	rt.exit_status, @object
+	.size	rt.exit_status, 4
+rt.exit_status:
+	.zero	4
+	.section	.data.rel.ro.strliteral.1980,"aw"
+	.align 8
+	.type	strliteral.1980, @object
+	.size	strliteral.1980, 24
+strliteral.1980:
+	.quad	strdata.1979
+	.quad	2
+	.quad	2
+	.section	.rodata.strdata.1979,"a"
+	.align 8
+	.type	strdata.1979, @object
+	.size	strdata.1979, 2
+strdata.1979:
+	.ascii	": "
+	.section	.data.rel.ro.strliteral.1977,"aw"
+	.align 8
+	.type	strliteral.1977, @object
+	.size	strliteral.1977, 24
+strliteral.1977:
+	.quad	strdata.1976
+	.quad	1
+	.quad	1
+	.section	.rodata.strdata.1976,"a"
+	.align 8
+	.type	strdata.1976, @object
+	.size	strdata.1976, 1
+strdata.1976:
+	.ascii	":"
+	.section	.data.rel.ro.strliteral.1973,"aw"
+	.align 8
+	.type	strliteral.1973, @object
+	.size	strliteral.1973, 24
+strliteral.1973:
+	.quad	strdata.1972
+	.quad	7
+	.quad	7
+	.section	.rodata.strdata.1972,"a"
+	.align 8
+	.type	strdata.1972, @object
+	.size	strdata.1972, 7
+strdata.1972:
+	.ascii	"Abort: "
+	.section	.data.rel.ro.abortsites.1955,"aw"
+	.align 8
+	.type	abortsites.1955, @object
+	.size	abortsites.1955, 16
+abortsites.1955:
+	.quad	strliteral.1
+	.long	37
+	.long	40
+	.section	.data.rel.ro.abortsites.1597,"aw"
+	.align 8
+	.type	abortsites.1597, @object
+	.size	abortsites.1597, 80
+abortsites.1597:
+	.quad	strliteral.3
+	.long	39
+	.long	15
+	.quad	strliteral.3
+	.long	62
+	.long	22
+	.quad	strliteral.3
+	.long	50
+	.long	34
+	.quad	strliteral.3
+	.long	79
+	.long	23
+	.quad	strliteral.3
+	.long	88
+	.long	14
+	.section	.data.rel.ro.strliteral.1911,"aw"
+	.align 8
+	.type	strliteral.1911, @object
+	.size	strliteral.1911, 24
+strliteral.1911:
+	.quad	strdata.1910
+	.quad	6
+	.quad	6
+	.section	.rodata.strdata.1910,"a"
+	.align 8
+	.type	strdata.1910, @object
+	.size	strdata.1910, 6
+strdata.1910:
+	.ascii	", got "
+	.section	.data.rel.ro.strliteral.1896,"aw"
+	.align 8
+	.type	strliteral.1896, @object
+	.size	strliteral.1896, 24
+strliteral.1896:
+	.quad	strdata.1895
+	.quad	9
+	.quad	9
+	.section	.rodata.strdata.1895,"a"
+	.align 8
+	.type	strdata.1895, @object
+	.size	strdata.1895, 9
+strdata.1895:
+	.ascii	"expected "
+	.section	.data.rel.ro.strliteral.1856,"aw"
+	.align 8
+	.type	strliteral.1856, @object
+	.size	strliteral.1856, 24
+strliteral.1856:
+	.quad	strdata.1855
+	.quad	1
+	.quad	1
+	.section	.rodata.strdata.1855,"a"
+	.align 8
+	.type	strdata.1855, @object
+	.size	strdata.1855, 1
+strdata.1855:
+	.byte	10
+	.section	.data.rel.ro.strliteral.1839,"aw"
+	.align 8
+	.type	strliteral.1839, @object
+	.size	strliteral.1839, 24
+strliteral.1839:
+	.quad	strdata.1838
+	.quad	9
+	.quad	9
+	.section	.rodata.strdata.1838,"a"
+	.align 8
+	.type	strdata.1838, @object
+	.size	strdata.1838, 9
+strdata.1838:
+	.ascii	"signaled "
+	.section	.data.rel.ro.strliteral.1811,"aw"
+	.align 8
+	.type	strliteral.1811, @object
+	.size	strliteral.1811, 24
+strliteral.1811:
+	.quad	strdata.1810
+	.quad	15
+	.quad	15
+	.section	.rodata.strdata.1810,"a"
+	.align 8
+	.type	strdata.1810, @object
+	.size	strdata.1810, 15
+strdata.1810:
+	.ascii	"write(2) failed"
+	.section	.data.rel.ro.strliteral.1772,"aw"
+	.align 8
+	.type	strliteral.1772, @object
+	.size	strliteral.1772, 24
+strliteral.1772:
+	.quad	strdata.1771
+	.quad	14
+	.quad	14
+	.section	.rodata.strdata.1771,"a"
+	.align 8
+	.type	strdata.1771, @object
+	.size	strdata.1771, 14
+strdata.1771:
+	.ascii	"fork(2) failed"
+	.section	.data.rel.ro.strliteral.1718,"aw"
+	.align 8
+	.type	strliteral.1718, @object
+	.size	strliteral.1718, 24
+strliteral.1718:
+	.quad	strdata.1717
+	.quad	13
+	.quad	13
+	.section	.rodata.strdata.1717,"a"
+	.align 8
+	.type	strdata.1717, @object
+	.size	strdata.1717, 13
+strdata.1717:
+	.ascii	"./.bin/harec"
+	.byte	0
+	.section	.data.rel.ro.strliteral.1694,"aw"
+	.align 8
+	.type	strliteral.1694, @object
+	.size	strliteral.1694, 24
+strliteral.1694:
+	.quad	strdata.1693
+	.quad	1
+	.quad	1
+	.section	.rodata.strdata.1693,"a"
+	.align 8
+	.type	strdata.1693, @object
+	.size	strdata.1693, 1
+strdata.1693:
+	.ascii	"-"
+	.section	.data.rel.ro.strliteral.1680,"aw"
+	.align 8
+	.type	strliteral.1680, @object
+	.size	strliteral.1680, 24
+strliteral.1680:
+	.quad	strdata.1679
+	.quad	11
+	.quad	11
+	.section	.rodata.strdata.1679,"a"
+	.align 8
+	.type	strdata.1679, @object
+	.size	strdata.1679, 11
+strdata.1679:
+	.ascii	"-o/dev/null"
+	.section	.data.rel.ro.strliteral.1634,"aw"
+	.align 8
+	.type	strliteral.1634, @object
+	.size	strliteral.1634, 24
+strliteral.1634:
+	.quad	strdata.1633
+	.quad	12
+	.quad	12
+	.section	.rodata.strdata.1633,"a"
+	.align 8
+	.type	strdata.1633, @object
+	.size	strdata.1633, 12
+strdata.1633:
+	.ascii	"./.bin/harec"
+	.section	.data.rel.ro.abortsites.1562,"aw"
+	.align 8
+	.type	abortsites.1562, @object
+	.size	abortsites.1562, 16
+abortsites.1562:
+	.quad	strliteral.7
+	.long	22
+	.long	15
+	.section	.data.rel.ro.strliteral.1516,"aw"
+	.align 8
+	.type	strliteral.1516, @object
+	.size	strliteral.1516, 24
+strliteral.1516:
+	.quad	strdata.1515
+	.quad	30
+	.quad	30
+	.section	.rodata.strdata.1515,"a"
+	.align 8
+	.type	strdata.1515, @object
+	.size	strdata.1515, 30
+strdata.1515:
+	.ascii	"slice out of memory (overflow)"
+	.section	.data.rel.ro.abortsites.1460,"aw"
+	.align 8
+	.type	abortsites.1460, @object
+	.size	abortsites.1460, 16
+abortsites.1460:
+	.quad	strliteral.7
+	.long	34
+	.long	15
+	.section	.data.rel.ro.abortsites.762,"aw"
+	.align 8
+	.type	abortsites.762, @object
+	.size	abortsites.762, 16
+abortsites.762:
+	.quad	strliteral.21
+	.long	26
+	.long	14
+	.section	.data.rel.ro.abortsites.377,"aw"
+	.align 8
+	.type	abortsites.377, @object
+	.size	abortsites.377, 80
+abortsites.377:
+	.quad	strliteral.25
+	.long	64
+	.long	30
+	.quad	strliteral.25
+	.long	78
+	.long	28
+	.quad	strliteral.25
+	.long	82
+	.long	30
+	.quad	strliteral.25
+	.long	98
+	.long	21
+	.quad	strliteral.25
+	.long	78
+	.long	22
+	.section	.data.rel.ro.abortsites.230,"aw"
+	.align 8
+	.type	abortsites.230, @object
+	.size	abortsites.230, 48
+abortsites.230:
+	.quad	strliteral.25
+	.long	111
+	.long	22
+	.quad	strliteral.25
+	.long	132
+	.long	22
+	.quad	strliteral.25
+	.long	133
+	.long	13
+	.section	.data.rel.ro.abortsites.148,"aw"
+	.align 8
+	.type	abortsites.148, @object
+	.size	abortsites.148, 32
+abortsites.148:
+	.quad	strliteral.25
+	.long	147
+	.long	22
+	.quad	strliteral.25
+	.long	155
+	.long	24
+	.section	.data.rel.ro.strliteral.105,"aw"
+	.align 8
+	.type	strliteral.105, @object
+	.size	strliteral.105, 24
+strliteral.105:
+	.quad	strdata.104
+	.quad	62
+	.quad	62
+	.section	.rodata.strdata.104,"a"
+	.align 8
+	.type	strdata.104, @object
+	.size	strdata.104, 62
+strdata.104:
+	.ascii	"tried to get metadata for already-freed pointer (double free"
+	.ascii	"?)"
+	.section	.fini_array,"aw"
+	.align 8
+	.type	.fini.finifunc.0, @object
+	.size	.fini.finifunc.0, 8
+.fini.finifunc.0:
+	.quad	finifunc.0
+	.section	.data.rel.ro.abortsites.63,"aw"
+	.align 8
+	.type	abortsites.63, @object
+	.size	abortsites.63, 32
+abortsites.63:
+	.quad	strliteral.25
+	.long	295
+	.long	41
+	.quad	strliteral.25
+	.long	294
+	.long	68
+	.section	.data.rel.ro.strliteral.29,"aw"
+	.align 8
+	.type	strliteral.29, @object
+	.size	strliteral.29, 24
+strliteral.29:
+	.quad	strdata.28
+	.quad	22
+	.quad	22
+	.section	.rodata.strdata.28,"a"
+	.align 8
+	.type	strdata.28, @object
+	.size	strdata.28, 22
+strdata.28:
+	.ascii	"rt/+linux/segmalloc.ha"
+	.section	.data.rel.ro.strliteral.27,"aw"
+	.align 8
+	.type	strliteral.27, @object
+	.size	strliteral.27, 24
+strliteral.27:
+	.quad	strdata.26
+	.quad	29
+	.quad	29
+	.section	.rodata.strdata.26,"a"
+	.align 8
+	.type	strdata.26, @object
+	.size	strdata.26, 29
+strdata.26:
+	.ascii	"rt/+linux/syscallno+x86_64.ha"
+	.section	.data.rel.ro.strliteral.25,"aw"
+	.align 8
+	.type	strliteral.25, @object
+	.size	strliteral.25, 24
+strliteral.25:
+	.quad	strdata.24
+	.quad	12
+	.quad	12
+	.section	.rodata.strdata.24,"a"
+	.align 8
+	.type	strdata.24, @object
+	.size	strdata.24, 12
+strdata.24:
+	.ascii	"rt/malloc.ha"
+	.section	.data.rel.ro.strliteral.23,"aw"
+	.align 8
+	.type	strliteral.23, @object
+	.size	strliteral.23, 24
+strliteral.23:
+	.quad	strdata.22
+	.quad	18
+	.quad	18
+	.section	.rodata.strdata.22,"a"
+	.align 8
+	.type	strdata.22, @object
+	.size	strdata.22, 18
+strdata.22:
+	.ascii	"rt/+linux/start.ha"
+	.section	.data.rel.ro.strliteral.21,"aw"
+	.align 8
+	.type	strliteral.21, @object
+	.size	strliteral.21, 24
+strliteral.21:
+	.quad	strdata.20
+	.quad	21
+	.quad	21
+	.section	.rodata.strdata.20,"a"
+	.align 8
+	.type	strdata.20, @object
+	.size	strdata.20, 21
+strdata.20:
+	.ascii	"rt/+linux/syscalls.ha"
+	.section	.data.rel.ro.strliteral.19,"aw"
+	.align 8
+	.type	strliteral.19, @object
+	.size	strliteral.19, 24
+strliteral.19:
+	.quad	strdata.18
+	.quad	18
+	.quad	18
+	.section	.rodata.strdata.18,"a"
+	.align 8
+	.type	strdata.18, @object
+	.size	strdata.18, 18
+strdata.18:
+	.ascii	"rt/+linux/errno.ha"
+	.section	.data.rel.ro.strliteral.17,"aw"
+	.align 8
+	.type	strliteral.17, @object
+	.size	strliteral.17, 24
+strliteral.17:
+	.quad	strdata.16
+	.quad	12
+	.quad	12
+	.section	.rodata.strdata.16,"a"
+	.align 8
+	.type	strdata.16, @object
+	.size	strdata.16, 12
+strdata.16:
+	.ascii	"rt/strcmp.ha"
+	.section	.data.rel.ro.strliteral.15,"aw"
+	.align 8
+	.type	strliteral.15, @object
+	.size	strliteral.15, 24
+strliteral.15:
+	.quad	strdata.14
+	.quad	12
+	.quad	12
+	.section	.rodata.strdata.14,"a"
+	.align 8
+	.type	strdata.14, @object
+	.size	strdata.14, 12
+strdata.14:
+	.ascii	"rt/memset.ha"
+	.section	.data.rel.ro.strliteral.13,"aw"
+	.align 8
+	.type	strliteral.13, @object
+	.size	strliteral.13, 24
+strliteral.13:
+	.quad	strdata.12
+	.quad	13
+	.quad	13
+	.section	.rodata.strdata.12,"a"
+	.align 8
+	.type	strdata.12, @object
+	.size	strdata.12, 13
+strdata.12:
+	.ascii	"rt/memmove.ha"
+	.section	.data.rel.ro.strliteral.11,"aw"
+	.align 8
+	.type	strliteral.11, @object
+	.size	strliteral.11, 24
+strliteral.11:
+	.quad	strdata.10
+	.quad	12
+	.quad	12
+	.section	.rodata.strdata.10,"a"
+	.align 8
+	.type	strdata.10, @object
+	.size	strdata.10, 12
+strdata.10:
+	.ascii	"rt/memcpy.ha"
+	.section	.data.rel.ro.strliteral.9,"aw"
+	.align 8
+	.type	strliteral.9, @object
+	.size	strliteral.9, 24
+strliteral.9:
+	.quad	strdata.8
+	.quad	10
+	.quad	10
+	.section	.rodata.strdata.8,"a"
+	.align 8
+	.type	strdata.8, @object
+	.size	strdata.8, 10
+strdata.8:
+	.ascii	"rt/itos.ha"
+	.section	.data.rel.ro.strliteral.7,"aw"
+	.align 8
+	.type	strliteral.7, @object
+	.size	strliteral.7, 24
+strliteral.7:
+	.quad	strdata.6
+	.quad	12
+	.quad	12
+	.section	.rodata.strdata.6,"a"
+	.align 8
+	.type	strdata.6, @object
+	.size	strdata.6, 12
+strdata.6:
+	.ascii	"rt/ensure.ha"
+	.section	.data.rel.ro.strliteral.5,"aw"
+	.align 8
+	.type	strliteral.5, @object
+	.size	strliteral.5, 24
+strliteral.5:
+	.quad	strdata.4
+	.quad	14
+	.quad	14
+	.section	.rodata.strdata.4,"a"
+	.align 8
+	.type	strdata.4, @object
+	.size	strdata.4, 14
+strdata.4:
+	.ascii	"rt/cstrings.ha"
+	.section	.data.rel.ro.strliteral.3,"aw"
+	.align 8
+	.type	strliteral.3, @object
+	.size	strliteral.3, 24
+strliteral.3:
+	.quad	strdata.2
+	.quad	13
+	.quad	13
+	.section	.rodata.strdata.2,"a"
+	.align 8
+	.type	strdata.2, @object
+	.size	strdata.2, 13
+strdata.2:
+	.ascii	"rt/compile.ha"
+	.section	.data.rel.ro.strliteral.1,"aw"
+	.align 8
+	.type	strliteral.1, @object
+	.size	strliteral.1, 24
+strliteral.1:
+	.quad	strdata.0
+	.quad	11
+	.quad	11
+	.section	.rodata.strdata.0,"a"
+	.align 8
+	.type	strdata.0, @object
+	.size	strdata.0, 11
+strdata.0:
+	.ascii	"rt/abort.ha"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
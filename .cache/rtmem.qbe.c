@@ -0,0 +1,3943 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2esyscall0[] __asm__("rt.syscall0");
+extern char X_rt_2esyscall1[] __asm__("rt.syscall1");
+extern char X_rt_2esyscall2[] __asm__("rt.syscall2");
+extern char X_rt_2esyscall3[] __asm__("rt.syscall3");
+extern char X_rt_2esyscall4[] __asm__("rt.syscall4");
+extern char X_rt_2esyscall6[] __asm__("rt.syscall6");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e3 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e4 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e5 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e6 { u8 f0[13]; };
+struct __attribute__((packed)) S_strliteral_2e7 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e8 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e9 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e10 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e11 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e12 { u8 f0[21]; };
+struct __attribute__((packed)) S_strliteral_2e13 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e14 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e15 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e16 { u8 f0[29]; };
+struct __attribute__((packed)) S_strliteral_2e17 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e18 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e19 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e103 { u8 f0[69]; };
+struct __attribute__((packed)) S_strliteral_2e104 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e53 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S__2efini_2efinifunc_2e0 { char *f0; };
+struct __attribute__((packed)) S_strdata_2e136 { u8 f0[62]; };
+struct __attribute__((packed)) S_strliteral_2e137 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e179 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e261 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e408 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; };
+struct __attribute__((packed)) S_abortsites_2e767 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e1363 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e1380 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1381 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1384 { u8 f0[1]; };
+struct __attribute__((packed)) S_strliteral_2e1385 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1387 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1388 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1498 { u8 f0; };
+struct __attribute__((packed)) S_strliteral_2e1499 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_static_2e2 { u8 f0; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_abortsites_2e1530 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_strdata_2e1650 { u8 f0[35]; };
+struct __attribute__((packed)) S_strdata_2e1651 { u8 f0[21]; };
+struct __attribute__((packed)) S_strdata_2e1652 { u8 f0[13]; };
+struct __attribute__((packed)) S_strdata_2e1653 { u8 f0[36]; };
+struct __attribute__((packed)) S_strdata_2e1654 { u8 f0[16]; };
+struct __attribute__((packed)) S_strdata_2e1655 { u8 f0[50]; };
+struct __attribute__((packed)) S_strdata_2e1656 { u8 f0[16]; };
+struct __attribute__((packed)) S_strdata_2e1657 { u8 f0[14]; };
+struct __attribute__((packed)) S_rt_2ereasons { char *f0; u64 f1; u64 f2; char *f3; u64 f4; u64 f5; char *f6; u64 f7; u64 f8; char *f9; u64 f10; u64 f11; char *f12; u64 f13; u64 f14; char *f15; u64 f16; u64 f17; char *f18; u64 f19; u64 f20; char *f21; u64 f22; u64 f23; };
+struct __attribute__((packed)) S_rt_2ecur__chunk { u64 f0; u64 f1; };
+struct __attribute__((packed)) S_rt_2ecur__allocs { u64 f0; };
+struct __attribute__((packed)) S_strdata_2e1822 { u8 f0[57]; };
+struct __attribute__((packed)) S_strliteral_2e1823 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1886 { u8 f0[68]; };
+struct __attribute__((packed)) S_strliteral_2e1887 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1938 { u8 f0[52]; };
+struct __attribute__((packed)) S_strliteral_2e1939 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1949 { u8 f0[57]; };
+struct __attribute__((packed)) S_strliteral_2e1950 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1960 { u8 f0[70]; };
+struct __attribute__((packed)) S_strliteral_2e1961 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1995 { u8 f0[57]; };
+struct __attribute__((packed)) S_strliteral_2e1996 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2020 { u8 f0[70]; };
+struct __attribute__((packed)) S_strliteral_2e2021 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1899 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e2121 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e2122 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2147 { u8 f0[49]; };
+struct __attribute__((packed)) S_strliteral_2e2148 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e2098 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_rt_2ebins { u64 f0; u64 f1; u64 f2; u64 f3; u64 f4; u64 f5; u64 f6; u64 f7; u64 f8; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e2 D_strdata_2e2 __asm__("strdata.2") __attribute__((used, section(".rodata.strdata.2"), aligned(8)));
+static struct S_strliteral_2e3 D_strliteral_2e3 __asm__("strliteral.3") __attribute__((used, section(".data.rel.ro.strliteral.3"), aligned(8)));
+static const struct S_strdata_2e4 D_strdata_2e4 __asm__("strdata.4") __attribute__((used, section(".rodata.strdata.4"), aligned(8)));
+static struct S_strliteral_2e5 D_strliteral_2e5 __asm__("strliteral.5") __attribute__((used, section(".data.rel.ro.strliteral.5"), aligned(8)));
+static const struct S_strdata_2e6 D_strdata_2e6 __asm__("strdata.6") __attribute__((used, section(".rodata.strdata.6"), aligned(8)));
+static struct S_strliteral_2e7 D_strliteral_2e7 __asm__("strliteral.7") __attribute__((used, section(".data.rel.ro.strliteral.7"), aligned(8)));
+static const struct S_strdata_2e8 D_strdata_2e8 __asm__("strdata.8") __attribute__((used, section(".rodata.strdata.8"), aligned(8)));
+static struct S_strliteral_2e9 D_strliteral_2e9 __asm__("strliteral.9") __attribute__((used, section(".data.rel.ro.strliteral.9"), aligned(8)));
+static const struct S_strdata_2e10 D_strdata_2e10 __asm__("strdata.10") __attribute__((used, section(".rodata.strdata.10"), aligned(8)));
+static struct S_strliteral_2e11 D_strliteral_2e11 __asm__("strliteral.11") __attribute__((used, section(".data.rel.ro.strliteral.11"), aligned(8)));
+static const struct S_strdata_2e12 D_strdata_2e12 __asm__("strdata.12") __attribute__((used, section(".rodata.strdata.12"), aligned(8)));
+static struct S_strliteral_2e13 D_strliteral_2e13 __asm__("strliteral.13") __attribute__((used, section(".data.rel.ro.strliteral.13"), aligned(8)));
+static const struct S_strdata_2e14 D_strdata_2e14 __asm__("strdata.14") __attribute__((used, section(".rodata.strdata.14"), aligned(8)));
+static struct S_strliteral_2e15 D_strliteral_2e15 __asm__("strliteral.15") __attribute__((used, section(".data.rel.ro.strliteral.15"), aligned(8)));
+static const struct S_strdata_2e16 D_strdata_2e16 __asm__("strdata.16") __attribute__((used, section(".rodata.strdata.16"), aligned(8)));
+static struct S_strliteral_2e17 D_strliteral_2e17 __asm__("strliteral.17") __attribute__((used, section(".data.rel.ro.strliteral.17"), aligned(8)));
+static const struct S_strdata_2e18 D_strdata_2e18 __asm__("strdata.18") __attribute__((used, section(".rodata.strdata.18"), aligned(8)));
+static struct S_strliteral_2e19 D_strliteral_2e19 __asm__("strliteral.19") __attribute__((used, section(".data.rel.ro.strliteral.19"), aligned(8)));
+static const struct S_strdata_2e103 D_strdata_2e103 __asm__("strdata.103") __attribute__((used, section(".rodata.strdata.103"), aligned(8)));
+static struct S_strliteral_2e104 D_strliteral_2e104 __asm__("strliteral.104") __attribute__((used, section(".data.rel.ro.strliteral.104"), aligned(8)));
+static struct S_abortsites_2e53 D_abortsites_2e53 __asm__("abortsites.53") __attribute__((used, section(".data.rel.ro.abortsites.53"), aligned(8)));
+static struct S__2efini_2efinifunc_2e0 D__2efini_2efinifunc_2e0 __asm__(".fini.finifunc.0") __attribute__((used, section(".fini_array"), aligned(8)));
+static const struct S_strdata_2e136 D_strdata_2e136 __asm__("strdata.136") __attribute__((used, section(".rodata.strdata.136"), aligned(8)));
+static struct S_strliteral_2e137 D_strliteral_2e137 __asm__("strliteral.137") __attribute__((used, section(".data.rel.ro.strliteral.137"), aligned(8)));
+static struct S_abortsites_2e179 D_abortsites_2e179 __asm__("abortsites.179") __attribute__((used, section(".data.rel.ro.abortsites.179"), aligned(8)));
+static struct S_abortsites_2e261 D_abortsites_2e261 __asm__("abortsites.261") __attribute__((used, section(".data.rel.ro.abortsites.261"), aligned(8)));
+static struct S_abortsites_2e408 D_abortsites_2e408 __asm__("abortsites.408") __attribute__((used, section(".data.rel.ro.abortsites.408"), aligned(8)));
+static struct S_abortsites_2e767 D_abortsites_2e767 __asm__("abortsites.767") __attribute__((used, section(".data.rel.ro.abortsites.767"), aligned(8)));
+static struct S_abortsites_2e1363 D_abortsites_2e1363 __asm__("abortsites.1363") __attribute__((used, section(".data.rel.ro.abortsites.1363"), aligned(8)));
+static const struct S_strdata_2e1380 D_strdata_2e1380 __asm__("strdata.1380") __attribute__((used, section(".rodata.strdata.1380"), aligned(8)));
+static struct S_strliteral_2e1381 D_strliteral_2e1381 __asm__("strliteral.1381") __attribute__((used, section(".data.rel.ro.strliteral.1381"), aligned(8)));
+static const struct S_strdata_2e1384 D_strdata_2e1384 __asm__("strdata.1384") __attribute__((used, section(".rodata.strdata.1384"), aligned(8)));
+static struct S_strliteral_2e1385 D_strliteral_2e1385 __asm__("strliteral.1385") __attribute__((used, section(".data.rel.ro.strliteral.1385"), aligned(8)));
+static const struct S_strdata_2e1387 D_strdata_2e1387 __asm__("strdata.1387") __attribute__((used, section(".rodata.strdata.1387"), aligned(8)));
+static struct S_strliteral_2e1388 D_strliteral_2e1388 __asm__("strliteral.1388") __attribute__((used, section(".data.rel.ro.strliteral.1388"), aligned(8)));
+static const struct S_strdata_2e1498 D_strdata_2e1498 __asm__("strdata.1498") __attribute__((used, section(".rodata.strdata.1498"), aligned(8)));
+static struct S_strliteral_2e1499 D_strliteral_2e1499 __asm__("strliteral.1499") __attribute__((used, section(".data.rel.ro.strliteral.1499"), aligned(8)));
+static struct S_static_2e2 D_static_2e2 __asm__("static.2") __attribute__((used, section(".bss.static.2"), aligned(8)));
+static struct S_abortsites_2e1530 D_abortsites_2e1530 __asm__("abortsites.1530") __attribute__((used, section(".data.rel.ro.abortsites.1530"), aligned(8)));
+static const struct S_strdata_2e1650 D_strdata_2e1650 __asm__("strdata.1650") __attribute__((used, section(".rodata.strdata.1650"), aligned(8)));
+static const struct S_strdata_2e1651 D_strdata_2e1651 __asm__("strdata.1651") __attribute__((used, section(".rodata.strdata.1651"), aligned(8)));
+static const struct S_strdata_2e1652 D_strdata_2e1652 __asm__("strdata.1652") __attribute__((used, section(".rodata.strdata.1652"), aligned(8)));
+static const struct S_strdata_2e1653 D_strdata_2e1653 __asm__("strdata.1653") __attribute__((used, section(".rodata.strdata.1653"), aligned(8)));
+static const struct S_strdata_2e1654 D_strdata_2e1654 __asm__("strdata.1654") __attribute__((used, section(".rodata.strdata.1654"), aligned(8)));
+static const struct S_strdata_2e1655 D_strdata_2e1655 __asm__("strdata.1655") __attribute__((used, section(".rodata.strdata.1655"), aligned(8)));
+static const struct S_strdata_2e1656 D_strdata_2e1656 __asm__("strdata.1656") __attribute__((used, section(".rodata.strdata.1656"), aligned(8)));
+static const struct S_strdata_2e1657 D_strdata_2e1657 __asm__("strdata.1657") __attribute__((used, section(".rodata.strdata.1657"), aligned(8)));
+static struct S_rt_2ereasons D_rt_2ereasons __asm__("rt.reasons") __attribute__((used, section(".data.rt.reasons"), aligned(8)));
+static struct S_rt_2ecur__chunk D_rt_2ecur__chunk __asm__("rt.cur_chunk") __attribute__((used, section(".data.rt.cur_chunk"), aligned(8)));
+static struct S_rt_2ecur__allocs D_rt_2ecur__allocs __asm__("rt.cur_allocs") __attribute__((used, section(".bss.rt.cur_allocs"), aligned(8)));
+static const struct S_strdata_2e1822 D_strdata_2e1822 __asm__("strdata.1822") __attribute__((used, section(".rodata.strdata.1822"), aligned(8)));
+static struct S_strliteral_2e1823 D_strliteral_2e1823 __asm__("strliteral.1823") __attribute__((used, section(".data.rel.ro.strliteral.1823"), aligned(8)));
+static const struct S_strdata_2e1886 D_strdata_2e1886 __asm__("strdata.1886") __attribute__((used, section(".rodata.strdata.1886"), aligned(8)));
+static struct S_strliteral_2e1887 D_strliteral_2e1887 __asm__("strliteral.1887") __attribute__((used, section(".data.rel.ro.strliteral.1887"), aligned(8)));
+static const struct S_strdata_2e1938 D_strdata_2e1938 __asm__("strdata.1938") __attribute__((used, section(".rodata.strdata.1938"), aligned(8)));
+static struct S_strliteral_2e1939 D_strliteral_2e1939 __asm__("strliteral.1939") __attribute__((used, section(".data.rel.ro.strliteral.1939"), aligned(8)));
+static const struct S_strdata_2e1949 D_strdata_2e1949 __asm__("strdata.1949") __attribute__((used, section(".rodata.strdata.1949"), aligned(8)));
+static struct S_strliteral_2e1950 D_strliteral_2e1950 __asm__("strliteral.1950") __attribute__((used, section(".data.rel.ro.strliteral.1950"), aligned(8)));
+static const struct S_strdata_2e1960 D_strdata_2e1960 __asm__("strdata.1960") __attribute__((used, section(".rodata.strdata.1960"), aligned(8)));
+static struct S_strliteral_2e1961 D_strliteral_2e1961 __asm__("strliteral.1961") __attribute__((used, section(".data.rel.ro.strliteral.1961"), aligned(8)));
+static const struct S_strdata_2e1995 D_strdata_2e1995 __asm__("strdata.1995") __attribute__((used, section(".rodata.strdata.1995"), aligned(8)));
+static struct S_strliteral_2e1996 D_strliteral_2e1996 __asm__("strliteral.1996") __attribute__((used, section(".data.rel.ro.strliteral.1996"), aligned(8)));
+static const struct S_strdata_2e2020 D_strdata_2e2020 __asm__("strdata.2020") __attribute__((used, section(".rodata.strdata.2020"), aligned(8)));
+static struct S_strliteral_2e2021 D_strliteral_2e2021 __asm__("strliteral.2021") __attribute__((used, section(".data.rel.ro.strliteral.2021"), aligned(8)));
+static struct S_abortsites_2e1899 D_abortsites_2e1899 __asm__("abortsites.1899") __attribute__((used, section(".data.rel.ro.abortsites.1899"), aligned(8)));
+static const struct S_strdata_2e2121 D_strdata_2e2121 __asm__("strdata.2121") __attribute__((used, section(".rodata.strdata.2121"), aligned(8)));
+static struct S_strliteral_2e2122 D_strliteral_2e2122 __asm__("strliteral.2122") __attribute__((used, section(".data.rel.ro.strliteral.2122"), aligned(8)));
+static const struct S_strdata_2e2147 D_strdata_2e2147 __asm__("strdata.2147") __attribute__((used, section(".rodata.strdata.2147"), aligned(8)));
+static struct S_strliteral_2e2148 D_strliteral_2e2148 __asm__("strliteral.2148") __attribute__((used, section(".data.rel.ro.strliteral.2148"), aligned(8)));
+static struct S_abortsites_2e2098 D_abortsites_2e2098 __asm__("abortsites.2098") __attribute__((used, section(".data.rel.ro.abortsites.2098"), aligned(8)));
+static struct S_rt_2ebins D_rt_2ebins __asm__("rt.bins") __attribute__((used, section(".bss.rt.bins"), aligned(8)));
+static void F_finifunc_2e0(void) __asm__("finifunc.0") __attribute__((used, section(".text.finifunc.0")));
+u64 F_rt_2egetmeta(u64 p_p) __asm__("rt.getmeta") __attribute__((used, section(".text.rt.getmeta")));
+u64 F_rt_2erealloc(u64 p_p, u64 p_n) __asm__("rt.realloc") __attribute__((used, section(".text.rt.realloc")));
+void F_rt_2efree(u64 p_p) __asm__("rt.free") __attribute__((used, section(".text.rt.free")));
+u64 F_rt_2emalloc(u64 p_n) __asm__("rt.malloc") __attribute__((used, section(".text.rt.malloc")));
+u32 F_rt_2emprotect(u64 p_addr, u64 p_length, u32 p_prot) __asm__("rt.mprotect") __attribute__((used, section(".text.rt.mprotect")));
+u32 F_rt_2emunmap(u64 p_addr, u64 p_length) __asm__("rt.munmap") __attribute__((used, section(".text.rt.munmap")));
+u64 F_rt_2emmap(u64 p_addr, u64 p_length, u32 p_prot, u32 p_flags, u32 p_fd, u64 p_offs) __asm__("rt.mmap") __attribute__((used, section(".text.rt.mmap")));
+u32 F_rt_2epipe2(u64 p_pipefd, u32 p_flags) __asm__("rt.pipe2") __attribute__((used, section(".text.rt.pipe2")));
+u32 F_rt_2ekill(u32 p_pid, u32 p_signal) __asm__("rt.kill") __attribute__((used, section(".text.rt.kill")));
+u32 F_rt_2ewifsignaled(u32 p_status) __asm__("rt.wifsignaled") __attribute__((used, section(".text.rt.wifsignaled")));
+u32 F_rt_2ewtermsig(u32 p_status) __asm__("rt.wtermsig") __attribute__((used, section(".text.rt.wtermsig")));
+u32 F_rt_2ewexitstatus(u32 p_status) __asm__("rt.wexitstatus") __attribute__((used, section(".text.rt.wexitstatus")));
+u32 F_rt_2ewifexited(u32 p_status) __asm__("rt.wifexited") __attribute__((used, section(".text.rt.wifexited")));
+void F_rt_2ewait4(u32 p_pid, u64 p_status, u32 p_options, u64 p_rusage) __asm__("rt.wait4") __attribute__((used, section(".text.rt.wait4")));
+u32 F_rt_2eexecve(u64 p_path, u64 p_argv, u64 p_envp) __asm__("rt.execve") __attribute__((used, section(".text.rt.execve")));
+u32 F_rt_2efork(void) __asm__("rt.fork") __attribute__((used, section(".text.rt.fork")));
+void F_rt_2eexit(u32 p_status) __asm__("rt.exit") __attribute__((used, section(".text.rt.exit")));
+u32 F_rt_2egetpid(void) __asm__("rt.getpid") __attribute__((used, section(".text.rt.getpid")));
+u32 F_rt_2edup2(u32 p_old, u32 p_new) __asm__("rt.dup2") __attribute__((used, section(".text.rt.dup2")));
+u32 F_rt_2edup3(u32 p_old, u32 p_new, u32 p_flags) __asm__("rt.dup3") __attribute__((used, section(".text.rt.dup3")));
+u32 F_rt_2eclose(u32 p_fd) __asm__("rt.close") __attribute__((used, section(".text.rt.close")));
+u64 F_rt_2ewrite(u32 p_fd, u64 p_buf, u64 p_count) __asm__("rt.write") __attribute__((used, section(".text.rt.write")));
+void F_rt_2ememset(u64 p_dest, u32 p_val, u64 p_amt) __asm__("rt.memset") __attribute__((used, section(".text.rt.memset")));
+void F_rt_2ememmove(u64 p_dest, u64 p_src, u64 p_n) __asm__("rt.memmove") __attribute__((used, section(".text.rt.memmove")));
+void F_rt_2ememcpy(u64 p_dest, u64 p_src, u64 p_amt) __asm__("rt.memcpy") __attribute__((used, section(".text.rt.memcpy")));
+u64 F_rt_2etoutf8(u64 __rp, u64 p_s) __asm__("rt.toutf8") __attribute__((used, section(".text.rt.toutf8")));
+void F_rt_2eabort__fixed(u64 p_path, u64 p_line, u64 p_col, u64 p_i) __asm__("rt.abort_fixed") __attribute__((used, section(".text.rt.abort_fixed")));
+void F_rt_2eabort(u64 p_path, u64 p_line, u64 p_col, u64 p_msg) __asm__("rt.abort") __attribute__((used, section(".text.rt.abort")));
+static u64 F_rt_2eu64tos(u64 __rp, u64 p_u) __asm__("rt.u64tos") __attribute__((used, section(".text.rt.u64tos")));
+static u64 F_rt_2esegmalloc(u64 p_n) __asm__("rt.segmalloc") __attribute__((used, section(".text.rt.segmalloc")));
+static u64 F_rt_2esize__getbin(u64 p_sz) __asm__("rt.size_getbin") __attribute__((used, section(".text.rt.size_getbin")));
+static u32 F_rt_2esegfree(u64 p_p, u64 p_s) __asm__("rt.segfree") __attribute__((used, section(".text.rt.segfree")));
+static u32 F_rt_2esize__islarge(u64 p_sz) __asm__("rt.size_islarge") __attribute__((used, section(".text.rt.size_islarge")));
+static u64 F_rt_2erealsz(u64 p_sz) __asm__("rt.realsz") __attribute__((used, section(".text.rt.realsz")));
+static void F_rt_2evalidatemeta(u64 p_m, u32 p_shallow) __asm__("rt.validatemeta") __attribute__((used, section(".text.rt.validatemeta")));
+static void F_rt_2echeckpoison(u64 p_m, u64 p_sz) __asm__("rt.checkpoison") __attribute__((used, section(".text.rt.checkpoison")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\162\164\057\141\142\157\162\164\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 11U, 11U };
+static const struct S_strdata_2e2 D_strdata_2e2 = { "\162\164\057\143\163\164\162\151\156\147\163\056\150\141" };
+static struct S_strliteral_2e3 D_strliteral_2e3 = { (char *)((char *)&D_strdata_2e2) + 0, 14U, 14U };
+static const struct S_strdata_2e4 D_strdata_2e4 = { "\162\164\057\155\145\155\143\160\171\056\150\141" };
+static struct S_strliteral_2e5 D_strliteral_2e5 = { (char *)((char *)&D_strdata_2e4) + 0, 12U, 12U };
+static const struct S_strdata_2e6 D_strdata_2e6 = { "\162\164\057\155\145\155\155\157\166\145\056\150\141" };
+static struct S_strliteral_2e7 D_strliteral_2e7 = { (char *)((char *)&D_strdata_2e6) + 0, 13U, 13U };
+static const struct S_strdata_2e8 D_strdata_2e8 = { "\162\164\057\155\145\155\163\145\164\056\150\141" };
+static struct S_strliteral_2e9 D_strliteral_2e9 = { (char *)((char *)&D_strdata_2e8) + 0, 12U, 12U };
+static const struct S_strdata_2e10 D_strdata_2e10 = { "\162\164\057\053\154\151\156\165\170\057\145\162\162\156\157\056\150\141" };
+static struct S_strliteral_2e11 D_strliteral_2e11 = { (char *)((char *)&D_strdata_2e10) + 0, 18U, 18U };
+static const struct S_strdata_2e12 D_strdata_2e12 = { "\162\164\057\053\154\151\156\165\170\057\163\171\163\143\141\154\154\163\056\150\141" };
+static struct S_strliteral_2e13 D_strliteral_2e13 = { (char *)((char *)&D_strdata_2e12) + 0, 21U, 21U };
+static const struct S_strdata_2e14 D_strdata_2e14 = { "\162\164\057\155\141\154\154\157\143\056\150\141" };
+static struct S_strliteral_2e15 D_strliteral_2e15 = { (char *)((char *)&D_strdata_2e14) + 0, 12U, 12U };
+static const struct S_strdata_2e16 D_strdata_2e16 = { "\162\164\057\053\154\151\156\165\170\057\163\171\163\143\141\154\154\156\157\053\170\070\066\137\066\064\056\150\141" };
+static struct S_strliteral_2e17 D_strliteral_2e17 = { (char *)((char *)&D_strdata_2e16) + 0, 29U, 29U };
+static const struct S_strdata_2e18 D_strdata_2e18 = { "\162\164\057\053\154\151\156\165\170\057\163\145\147\155\141\154\154\157\143\056\150\141" };
+static struct S_strliteral_2e19 D_strliteral_2e19 = { (char *)((char *)&D_strdata_2e18) + 0, 22U, 22U };
+static const struct S_strdata_2e103 D_strdata_2e103 = { "\145\170\160\145\143\164\145\144\040\155\145\164\141\144\141\164\141\040\157\156\040\146\162\145\145\154\151\163\164\040\164\157\040\142\145\040\155\141\162\153\145\144\040\141\163\040\146\162\145\145\040\050\150\145\141\160\040\143\157\162\162\165\160\164\151\157\156\077\051" };
+static struct S_strliteral_2e104 D_strliteral_2e104 = { (char *)((char *)&D_strdata_2e103) + 0, 69U, 69U };
+static struct S_abortsites_2e53 D_abortsites_2e53 = { (char *)((char *)&D_strliteral_2e15) + 0, 295U, 41U, (char *)((char *)&D_strliteral_2e15) + 0, 294U, 68U };
+static struct S__2efini_2efinifunc_2e0 D__2efini_2efinifunc_2e0 = { (char *)((char *)&F_finifunc_2e0) + 0 };
+static const struct S_strdata_2e136 D_strdata_2e136 = { "\164\162\151\145\144\040\164\157\040\147\145\164\040\155\145\164\141\144\141\164\141\040\146\157\162\040\141\154\162\145\141\144\171\055\146\162\145\145\144\040\160\157\151\156\164\145\162\040\050\144\157\165\142\154\145\040\146\162\145\145\077\051" };
+static struct S_strliteral_2e137 D_strliteral_2e137 = { (char *)((char *)&D_strdata_2e136) + 0, 62U, 62U };
+static struct S_abortsites_2e179 D_abortsites_2e179 = { (char *)((char *)&D_strliteral_2e15) + 0, 147U, 22U, (char *)((char *)&D_strliteral_2e15) + 0, 155U, 24U };
+static struct S_abortsites_2e261 D_abortsites_2e261 = { (char *)((char *)&D_strliteral_2e15) + 0, 111U, 22U, (char *)((char *)&D_strliteral_2e15) + 0, 132U, 22U, (char *)((char *)&D_strliteral_2e15) + 0, 133U, 13U };
+static struct S_abortsites_2e408 D_abortsites_2e408 = { (char *)((char *)&D_strliteral_2e15) + 0, 64U, 30U, (char *)((char *)&D_strliteral_2e15) + 0, 78U, 28U, (char *)((char *)&D_strliteral_2e15) + 0, 82U, 30U, (char *)((char *)&D_strliteral_2e15) + 0, 98U, 21U, (char *)((char *)&D_strliteral_2e15) + 0, 78U, 22U };
+static struct S_abortsites_2e767 D_abortsites_2e767 = { (char *)((char *)&D_strliteral_2e13) + 0, 26U, 14U };
+static struct S_abortsites_2e1363 D_abortsites_2e1363 = { (char *)((char *)&D_strliteral_2e1) + 0, 37U, 40U };
+static const struct S_strdata_2e1380 D_strdata_2e1380 = { "\101\142\157\162\164\072\040" };
+static struct S_strliteral_2e1381 D_strliteral_2e1381 = { (char *)((char *)&D_strdata_2e1380) + 0, 7U, 7U };
+static const struct S_strdata_2e1384 D_strdata_2e1384 = { "\072" };
+static struct S_strliteral_2e1385 D_strliteral_2e1385 = { (char *)((char *)&D_strdata_2e1384) + 0, 1U, 1U };
+static const struct S_strdata_2e1387 D_strdata_2e1387 = { "\072\040" };
+static struct S_strliteral_2e1388 D_strliteral_2e1388 = { (char *)((char *)&D_strdata_2e1387) + 0, 2U, 2U };
+static const struct S_strdata_2e1498 D_strdata_2e1498 = { 10U };
+static struct S_strliteral_2e1499 D_strliteral_2e1499 = { (char *)((char *)&D_strdata_2e1498) + 0, 1U, 1U };
+static struct S_static_2e2 D_static_2e2 = { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U };
+static struct S_abortsites_2e1530 D_abortsites_2e1530 = { (char *)((char *)&D_strliteral_2e1) + 0, 42U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 44U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 29U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 53U, 19U };
+static const struct S_strdata_2e1650 D_strdata_2e1650 = { "\163\154\151\143\145\040\157\162\040\141\162\162\141\171\040\141\143\143\145\163\163\040\157\165\164\040\157\146\040\142\157\165\156\144\163" };
+static const struct S_strdata_2e1651 D_strdata_2e1651 = { "\164\171\160\145\040\141\163\163\145\162\164\151\157\156\040\146\141\151\154\145\144" };
+static const struct S_strdata_2e1652 D_strdata_2e1652 = { "\157\165\164\040\157\146\040\155\145\155\157\162\171" };
+static const struct S_strdata_2e1653 D_strdata_2e1653 = { "\163\164\141\164\151\143\040\141\160\160\145\156\144\040\145\170\143\145\145\144\163\040\163\154\151\143\145\040\143\141\160\141\143\151\164\171" };
+static const struct S_strdata_2e1654 D_strdata_2e1654 = { "\165\156\162\145\141\143\150\141\142\154\145\040\143\157\144\145" };
+static const struct S_strdata_2e1655 D_strdata_2e1655 = { "\163\154\151\143\145\040\141\154\154\157\143\141\164\151\157\156\040\143\141\160\141\143\151\164\171\040\163\155\141\154\154\145\162\040\164\150\141\156\040\151\156\151\164\151\141\154\151\172\145\162" };
+static const struct S_strdata_2e1656 D_strdata_2e1656 = { "\141\163\163\145\162\164\151\157\156\040\146\141\151\154\145\144" };
+static const struct S_strdata_2e1657 D_strdata_2e1657 = { "\145\162\162\157\162\040\157\143\143\165\162\162\145\144" };
+static struct S_rt_2ereasons D_rt_2ereasons = { (char *)((char *)&D_strdata_2e1650) + 0, 35U, 35U, (char *)((char *)&D_strdata_2e1651) + 0, 21U, 21U, (char *)((char *)&D_strdata_2e1652) + 0, 13U, 13U, (char *)((char *)&D_strdata_2e1653) + 0, 36U, 36U, (char *)((char *)&D_strdata_2e1654) + 0, 16U, 16U, (char *)((char *)&D_strdata_2e1655) + 0, 50U, 50U, (char *)((char *)&D_strdata_2e1656) + 0, 16U, 16U, (char *)((char *)&D_strdata_2e1657) + 0, 14U, 14U };
+static struct S_rt_2ecur__chunk D_rt_2ecur__chunk = { 0U, 2097152U };
+static struct S_rt_2ecur__allocs D_rt_2ecur__allocs = { 0U };
+static const struct S_strdata_2e1822 D_strdata_2e1822 = { "\151\156\166\141\154\151\144\040\141\154\151\147\156\155\145\156\164\040\146\157\162\040\155\145\164\141\144\141\164\141\040\160\157\151\156\164\145\162\040\050\150\145\141\160\040\143\157\162\162\165\160\164\151\157\156\077\051" };
+static struct S_strliteral_2e1823 D_strliteral_2e1823 = { (char *)((char *)&D_strdata_2e1822) + 0, 57U, 57U };
+static const struct S_strdata_2e1886 D_strdata_2e1886 = { "\151\156\166\141\154\151\144\040\155\145\164\141\144\141\164\141\040\146\157\162\040\163\155\141\154\154\040\141\154\154\157\143\141\164\151\157\156\040\157\156\040\146\162\145\145\154\151\163\164\040\050\150\145\141\160\040\143\157\162\162\165\160\164\151\157\156\077\051" };
+static struct S_strliteral_2e1887 D_strliteral_2e1887 = { (char *)((char *)&D_strdata_2e1886) + 0, 68U, 68U };
+static const struct S_strdata_2e1938 D_strdata_2e1938 = { "\151\156\166\141\154\151\144\040\154\141\162\147\145\040\141\154\154\157\143\141\164\151\157\156\040\141\144\144\162\145\163\163\040\050\156\157\156\055\150\145\141\160\040\160\157\151\156\164\145\162\077\051" };
+static struct S_strliteral_2e1939 D_strliteral_2e1939 = { (char *)((char *)&D_strdata_2e1938) + 0, 52U, 52U };
+static const struct S_strdata_2e1949 D_strdata_2e1949 = { "\151\156\166\141\154\151\144\040\155\145\164\141\144\141\164\141\040\146\157\162\040\154\141\162\147\145\040\141\154\154\157\143\141\164\151\157\156\040\050\156\157\156\055\150\145\141\160\040\160\157\151\156\164\145\162\077\051" };
+static struct S_strliteral_2e1950 D_strliteral_2e1950 = { (char *)((char *)&D_strdata_2e1949) + 0, 57U, 57U };
+static const struct S_strdata_2e1960 D_strdata_2e1960 = { "\151\156\166\141\154\151\144\040\163\145\143\157\156\144\141\162\171\040\155\145\164\141\144\141\164\141\040\146\157\162\040\154\141\162\147\145\040\141\154\154\157\143\141\164\151\157\156\040\050\157\165\164\055\157\146\055\142\157\165\156\144\163\040\167\162\151\164\145\077\051" };
+static struct S_strliteral_2e1961 D_strliteral_2e1961 = { (char *)((char *)&D_strdata_2e1960) + 0, 70U, 70U };
+static const struct S_strdata_2e1995 D_strdata_2e1995 = { "\151\156\166\141\154\151\144\040\155\145\164\141\144\141\164\141\040\146\157\162\040\163\155\141\154\154\040\141\154\154\157\143\141\164\151\157\156\040\050\156\157\156\055\150\145\141\160\040\160\157\151\156\164\145\162\077\051" };
+static struct S_strliteral_2e1996 D_strliteral_2e1996 = { (char *)((char *)&D_strdata_2e1995) + 0, 57U, 57U };
+static const struct S_strdata_2e2020 D_strdata_2e2020 = { "\151\156\166\141\154\151\144\040\163\145\143\157\156\144\141\162\171\040\155\145\164\141\144\141\164\141\040\146\157\162\040\163\155\141\154\154\040\141\154\154\157\143\141\164\151\157\156\040\050\157\165\164\055\157\146\055\142\157\165\156\144\163\040\167\162\151\164\145\077\051" };
+static struct S_strliteral_2e2021 D_strliteral_2e2021 = { (char *)((char *)&D_strdata_2e2020) + 0, 70U, 70U };
+static struct S_abortsites_2e1899 D_abortsites_2e1899 = { (char *)((char *)&D_strliteral_2e15) + 0, 235U, 22U };
+static const struct S_strdata_2e2121 D_strdata_2e2121 = { "\151\156\166\141\154\151\144\040\143\141\156\141\162\171\040\157\156\040\146\162\145\145\154\151\163\164\040\050\165\163\145\040\141\146\164\145\162\040\146\162\145\145\077\051" };
+static struct S_strliteral_2e2122 D_strliteral_2e2122 = { (char *)((char *)&D_strdata_2e2121) + 0, 44U, 44U };
+static const struct S_strdata_2e2147 D_strdata_2e2147 = { "\151\156\166\141\154\151\144\040\160\157\151\163\157\156\040\144\141\164\141\040\157\156\040\146\162\145\145\154\151\163\164\040\050\165\163\145\040\141\146\164\145\162\040\146\162\145\145\077\051" };
+static struct S_strliteral_2e2148 D_strliteral_2e2148 = { (char *)((char *)&D_strdata_2e2147) + 0, 49U, 49U };
+static struct S_abortsites_2e2098 D_abortsites_2e2098 = { (char *)((char *)&D_strliteral_2e15) + 0, 277U, 14U };
+static struct S_rt_2ebins D_rt_2ebins = { 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U };
+static void F_finifunc_2e0(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	u64 t__2e102;
+	u64 t__2e106;
+	u64 t__2e107;
+	u64 t__2e109;
+	u64 t__2e115;
+	u64 t__2e30;
+	u64 t__2e31;
+	u64 t__2e40;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e44;
+	u64 t__2e45;
+	u64 t__2e49;
+	u64 t__2e52;
+	u64 t__2e56;
+	u64 t__2e57;
+	u64 t__2e58;
+	u64 t__2e59;
+	u64 t__2e60;
+	u64 t__2e61;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t__2e73;
+	u64 t__2e74;
+	u64 t__2e75;
+	u64 t__2e76;
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e80;
+	u64 t__2e84;
+	u64 t__2e87;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e97;
+	u64 t_abortsite_2e54;
+	u64 t_binding_2e29;
+	u64 t_binding_2e39;
+	u64 t_binding_2e67;
+	u64 t_param_2e62;
+	u64 t_param_2e88;
+	L_start_2e20:;
+	t_binding_2e29 = (u64)A0;
+	t_binding_2e39 = (u64)A1;
+	t_param_2e62 = (u64)A2;
+	t_binding_2e67 = (u64)A3;
+	t_param_2e88 = (u64)A4;
+	L_body_2e21:;
+	*(u64 *)t_binding_2e29 = (u64)((u64)0UL);
+	L_loop_2e24:;
+	t__2e31 = (u64)(*(u64 *)t_binding_2e29);
+	t__2e30 = (u64)(u32)(((u64)t__2e31 < (u64)((u64)9UL)));
+	if ((u32)t__2e30) goto L_body_2e25; else goto L__2e22;
+	L_body_2e25:;
+	t__2e42 = (u64)(*(u64 *)t_binding_2e29);
+	t__2e40 = (u64)((u64)t__2e42 * (u64)((u64)8UL));
+	t__2e40 = (u64)((u64)((u64)((char *)&D_rt_2ebins)) + (u64)t__2e40);
+	t__2e43 = (u64)(*(u64 *)t__2e40);
+	*(u64 *)t_binding_2e39 = (u64)t__2e43;
+	L_loop_2e34:;
+	t__2e45 = (u64)(*(u64 *)t_binding_2e39);
+	t__2e44 = (u64)(u32)(((u64)t__2e45 != (u64)((u64)0UL)));
+	if ((u32)t__2e44) goto L_body_2e35; else goto L__2e32;
+	L_body_2e35:;
+	t__2e49 = (u64)(*(u64 *)t_binding_2e39);
+	t__2e52 = (u64)(u32)(((u64)t__2e49 != (u64)((u64)0UL)));
+	if ((u32)t__2e52) goto L_passed_2e51; else goto L_failed_2e50;
+	L_failed_2e50:;
+	t_abortsite_2e54 = ((u64)0UL);
+	goto L_abort_2e55;
+	L_passed_2e51:;
+	t__2e61 = (u64)(*(u64 *)t_binding_2e29);
+	*(u64 *)t_param_2e62 = (u64)t__2e61;
+	t__2e72 = (u64)(*(u64 *)t_param_2e62);
+	t__2e71 = (u64)(u32)(((u64)t__2e72 == (u64)((u64)0UL)));
+	t__2e73 = (u64)(u32)((u8)t__2e71);
+	if ((u32)t__2e73) goto L_true_2e68; else goto L_false_2e69;
+	L_true_2e68:;
+	*(u64 *)t_binding_2e67 = (u64)((u64)0UL);
+	goto L__2e70;
+	L_false_2e69:;
+	t__2e76 = (u64)(*(u64 *)t_param_2e62);
+	t__2e75 = (u64)((u64)t__2e76 - (u64)((u64)1UL));
+	t__2e74 = (u64)((u64)((u64)1UL) << (t__2e75 & 63));
+	*(u64 *)t_binding_2e67 = (u64)t__2e74;
+	L__2e70:;
+	t__2e80 = (u64)(*(u64 *)t_binding_2e67);
+	t__2e79 = (u64)((u64)t__2e80 << (((u64)4UL) & 63));
+	t__2e78 = (u64)((u64)t__2e79 + (u64)((u64)16UL));
+	t__2e77 = (u64)((u64)t__2e78 - (u64)((u64)8UL));
+	goto L__2e63;
+	L__2e63:;
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2echeckpoison)))((u64)t__2e49, (u64)t__2e77);
+	goto L__2e47;
+	L__2e47:;
+	L_after_2e38:;
+	t__2e84 = (u64)(*(u64 *)t_binding_2e39);
+	t__2e87 = (u64)(u32)(((u64)t__2e84 != (u64)((u64)0UL)));
+	if ((u32)t__2e87) goto L_passed_2e86; else goto L_failed_2e85;
+	L_failed_2e85:;
+	t_abortsite_2e54 = ((u64)1UL);
+	goto L_abort_2e55;
+	L_passed_2e86:;
+	*(u64 *)t_param_2e88 = (u64)t__2e84;
+	t__2e97 = (u64)(*(u64 *)t_param_2e88);
+	t__2e102 = (u64)(*(u64 *)t__2e97);
+	t__2e96 = (u64)((u64)t__2e102 & (u64)((u64)1UL));
+	t__2e95 = (u64)(u32)(((u64)t__2e96 == (u64)((u64)1UL)));
+	if ((u32)t__2e95) goto L_passed_2e94; else goto L_failed_2e93;
+	L_failed_2e93:;
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e104)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)208UL), (u64)((u64)15UL), (u64)B5);
+	__builtin_trap();
+	L_passed_2e94:;
+	t__2e107 = (u64)(*(u64 *)t_param_2e88);
+	t__2e109 = (u64)(*(u64 *)t__2e107);
+	t__2e106 = (u64)((u64)t__2e109 & (u64)((u64)18446744073709551614UL));
+	goto L__2e89;
+	L__2e89:;
+	*(u64 *)t_binding_2e39 = (u64)t__2e106;
+	goto L_loop_2e34;
+	L__2e32:;
+	L_after_2e28:;
+	t__2e115 = (u64)(*(u64 *)t_binding_2e29);
+	t__2e115 = (u64)((u64)t__2e115 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e29 = (u64)t__2e115;
+	goto L_loop_2e24;
+	L__2e22:;
+	return;
+	L_abort_2e55:;
+	t__2e56 = (u64)((u64)t_abortsite_2e54 * (u64)((u64)16UL));
+	t__2e56 = (u64)((u64)((u64)((char *)&D_abortsites_2e53)) + (u64)t__2e56);
+	t__2e57 = (u64)(*(u64 *)t__2e56);
+	t__2e58 = (u64)((u64)t__2e56 + (u64)((u64)8UL));
+	t__2e59 = (u64)(*(u32 *)t__2e58);
+	t__2e58 = (u64)((u64)t__2e56 + (u64)((u64)12UL));
+	t__2e60 = (u64)(*(u32 *)t__2e58);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e57, (u64)t__2e59, (u64)t__2e60, (u64)((u64)1UL));
+	__builtin_trap();
+}
+u64 F_rt_2egetmeta(u64 p_p) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char B2[24] __attribute__((aligned(16)));
+	u64 t__2e123;
+	u64 t__2e124;
+	u64 t__2e128;
+	u64 t__2e131;
+	u64 t__2e132;
+	u64 t__2e133;
+	u64 t__2e135;
+	u64 t__2e138;
+	u64 t_binding_2e122;
+	u64 t_p;
+	u64 t_param_2e118;
+	t_p = (u64)p_p;
+	L_start_2e117:;
+	t_param_2e118 = (u64)A0;
+	t_binding_2e122 = (u64)A1;
+	*(u64 *)t_param_2e118 = (u64)t_p;
+	L_body_2e119:;
+	t__2e124 = (u64)(*(u64 *)t_param_2e118);
+	t__2e123 = (u64)((u64)t__2e124 - (u64)((u64)8UL));
+	*(u64 *)t_binding_2e122 = (u64)t__2e123;
+	t__2e128 = (u64)(*(u64 *)t_binding_2e122);
+	((void (*)(u64, u32))((u64)((char *)&F_rt_2evalidatemeta)))((u64)t__2e128, (u32)((u64)0UL));
+	t__2e133 = (u64)(*(u64 *)t_binding_2e122);
+	t__2e135 = (u64)(*(u64 *)t__2e133);
+	t__2e132 = (u64)((u64)t__2e135 & (u64)((u64)1UL));
+	t__2e131 = (u64)(u32)(((u64)t__2e132 == (u64)((u64)0UL)));
+	if ((u32)t__2e131) goto L_passed_2e130; else goto L_failed_2e129;
+	L_failed_2e129:;
+	BLIT((u64)B2, ((u64)((char *)&D_strliteral_2e137)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)171UL), (u64)((u64)15UL), (u64)B2);
+	__builtin_trap();
+	L_passed_2e130:;
+	t__2e138 = (u64)(*(u64 *)t_binding_2e122);
+	return (u64)t__2e138;
+}
+u64 F_rt_2erealloc(u64 p_p, u64 p_n) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e156;
+	u64 t__2e162;
+	u64 t__2e163;
+	u64 t__2e167;
+	u64 t__2e168;
+	u64 t__2e170;
+	u64 t__2e175;
+	u64 t__2e176;
+	u64 t__2e182;
+	u64 t__2e183;
+	u64 t__2e184;
+	u64 t__2e185;
+	u64 t__2e186;
+	u64 t__2e191;
+	u64 t__2e192;
+	u64 t__2e193;
+	u64 t__2e194;
+	u64 t__2e196;
+	u64 t__2e197;
+	u64 t__2e198;
+	u64 t__2e202;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e210;
+	u64 t__2e215;
+	u64 t__2e218;
+	u64 t__2e219;
+	u64 t__2e221;
+	u64 t__2e225;
+	u64 t__2e226;
+	u64 t__2e229;
+	u64 t__2e230;
+	u64 t__2e231;
+	u64 t__2e232;
+	u64 t__2e234;
+	u64 t__2e235;
+	u64 t__2e236;
+	u64 t_abortsite_2e180;
+	u64 t_binding_2e160;
+	u64 t_binding_2e173;
+	u64 t_binding_2e200;
+	u64 t_binding_2e213;
+	u64 t_field_2e220;
+	u64 t_n;
+	u64 t_p;
+	u64 t_param_2e142;
+	u64 t_param_2e143;
+	t_p = (u64)p_p;
+	t_n = (u64)p_n;
+	L_start_2e141:;
+	t_param_2e142 = (u64)A0;
+	t_param_2e143 = (u64)A1;
+	t_binding_2e160 = (u64)A2;
+	t_binding_2e173 = (u64)A3;
+	t_binding_2e200 = (u64)A4;
+	t_binding_2e213 = (u64)A5;
+	*(u64 *)t_param_2e142 = (u64)t_p;
+	*(u64 *)t_param_2e143 = (u64)t_n;
+	L_body_2e144:;
+	t__2e152 = (u64)(*(u64 *)t_param_2e143);
+	t__2e151 = (u64)(u32)(((u64)t__2e152 == (u64)((u64)0UL)));
+	t__2e153 = (u64)(u32)((u8)t__2e151);
+	if ((u32)t__2e153) goto L_true_2e148; else goto L_false_2e149;
+	L_true_2e148:;
+	t__2e156 = (u64)(*(u64 *)t_param_2e142);
+	((void (*)(u64))((u64)((char *)&F_rt_2efree)))((u64)t__2e156);
+	return (u64)((u64)0UL);
+	L_false_2e149:;
+	L__2e150:;
+	t__2e162 = (u64)(*(u64 *)t_param_2e142);
+	t__2e163 = (u64)(u32)(((u64)t__2e162 == (u64)((u64)0UL)));
+	if ((u32)t__2e163) goto L_matches_2e164; else goto L_next_2e165;
+	L_matches_2e164:;
+	t__2e168 = (u64)(*(u64 *)t_param_2e143);
+	t__2e167 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2emalloc)))((u64)t__2e168));
+	return (u64)t__2e167;
+	L_next_2e165:;
+	t__2e170 = (u64)(u32)(((u64)t__2e162 != (u64)((u64)0UL)));
+	if ((u32)t__2e170) goto L_matches_2e171; else goto L_next_2e172;
+	L_matches_2e171:;
+	*(u64 *)t_binding_2e173 = (u64)t__2e162;
+	t__2e176 = (u64)(*(u64 *)t_binding_2e173);
+	t__2e175 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2egetmeta)))((u64)t__2e176));
+	*(u64 *)t_binding_2e160 = (u64)t__2e175;
+	goto L__2e161;
+	L_next_2e172:;
+	L__2e178:;
+	t_abortsite_2e180 = ((u64)0UL);
+	goto L_abort_2e181;
+	L__2e161:;
+	t__2e193 = (u64)(*(u64 *)t_param_2e143);
+	t__2e192 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2erealsz)))((u64)t__2e193));
+	t__2e194 = (u64)(*(u64 *)t_binding_2e160);
+	t__2e196 = (u64)(*(u64 *)t__2e194);
+	t__2e191 = (u64)(u32)(((u64)t__2e192 == (u64)t__2e196));
+	t__2e197 = (u64)(u32)((u8)t__2e191);
+	if ((u32)t__2e197) goto L_true_2e188; else goto L_false_2e189;
+	L_true_2e188:;
+	t__2e198 = (u64)(*(u64 *)t_param_2e142);
+	return (u64)t__2e198;
+	L_false_2e189:;
+	L__2e190:;
+	t__2e203 = (u64)(*(u64 *)t_param_2e143);
+	t__2e202 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2emalloc)))((u64)t__2e203));
+	t__2e204 = (u64)(u32)(((u64)t__2e202 == (u64)((u64)0UL)));
+	if ((u32)t__2e204) goto L_matches_2e205; else goto L_next_2e206;
+	L_matches_2e205:;
+	return (u64)((u64)0UL);
+	L_next_2e206:;
+	t__2e210 = (u64)(u32)(((u64)t__2e202 != (u64)((u64)0UL)));
+	if ((u32)t__2e210) goto L_matches_2e211; else goto L_next_2e212;
+	L_matches_2e211:;
+	*(u64 *)t_binding_2e213 = (u64)t__2e202;
+	t__2e215 = (u64)(*(u64 *)t_binding_2e213);
+	*(u64 *)t_binding_2e200 = (u64)t__2e215;
+	goto L__2e201;
+	L_next_2e212:;
+	L__2e217:;
+	t_abortsite_2e180 = ((u64)1UL);
+	goto L_abort_2e181;
+	L__2e201:;
+	t__2e218 = (u64)(*(u64 *)t_binding_2e200);
+	t__2e219 = (u64)(*(u64 *)t_binding_2e160);
+	t_field_2e220 = (u64)((u64)t__2e219 + (u64)((u64)8UL));
+	t__2e226 = (u64)(*(u64 *)t_param_2e143);
+	t__2e229 = (u64)(*(u64 *)t__2e219);
+	t__2e225 = (u64)(u32)(((u64)t__2e226 < (u64)t__2e229));
+	t__2e230 = (u64)(u32)((u8)t__2e225);
+	if ((u32)t__2e230) goto L_true_2e222; else goto L_false_2e223;
+	L_true_2e222:;
+	t__2e231 = (u64)(*(u64 *)t_param_2e143);
+	t__2e221 = t__2e231;
+	goto L__2e224;
+	L_false_2e223:;
+	t__2e232 = (u64)(*(u64 *)t_binding_2e160);
+	t__2e234 = (u64)(*(u64 *)t__2e232);
+	t__2e221 = t__2e234;
+	L__2e224:;
+	((void (*)(u64, u64, u64))((u64)((char *)&F_rt_2ememcpy)))((u64)t__2e218, (u64)t_field_2e220, (u64)t__2e221);
+	t__2e235 = (u64)(*(u64 *)t_param_2e142);
+	((void (*)(u64))((u64)((char *)&F_rt_2efree)))((u64)t__2e235);
+	t__2e236 = (u64)(*(u64 *)t_binding_2e200);
+	return (u64)t__2e236;
+	L_abort_2e181:;
+	t__2e182 = (u64)((u64)t_abortsite_2e180 * (u64)((u64)16UL));
+	t__2e182 = (u64)((u64)((u64)((char *)&D_abortsites_2e179)) + (u64)t__2e182);
+	t__2e183 = (u64)(*(u64 *)t__2e182);
+	t__2e184 = (u64)((u64)t__2e182 + (u64)((u64)8UL));
+	t__2e185 = (u64)(*(u32 *)t__2e184);
+	t__2e184 = (u64)((u64)t__2e182 + (u64)((u64)12UL));
+	t__2e186 = (u64)(*(u32 *)t__2e184);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e183, (u64)t__2e185, (u64)t__2e186, (u64)((u64)4UL));
+	__builtin_trap();
+}
+void F_rt_2efree(u64 p_p) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[1] __attribute__((aligned(16)));
+	u64 t__2e246;
+	u64 t__2e247;
+	u64 t__2e252;
+	u64 t__2e257;
+	u64 t__2e258;
+	u64 t__2e264;
+	u64 t__2e265;
+	u64 t__2e266;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e269;
+	u64 t__2e274;
+	u64 t__2e275;
+	u64 t__2e277;
+	u64 t__2e278;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e283;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e289;
+	u64 t__2e291;
+	u64 t__2e295;
+	u64 t__2e296;
+	u64 t__2e298;
+	u64 t__2e306;
+	u64 t__2e312;
+	u64 t__2e313;
+	u64 t__2e322;
+	u64 t__2e326;
+	u64 t__2e327;
+	u64 t__2e334;
+	u64 t__2e336;
+	u64 t__2e337;
+	u64 t__2e338;
+	u64 t__2e339;
+	u64 t__2e343;
+	u64 t__2e344;
+	u64 t__2e345;
+	u64 t__2e346;
+	u64 t__2e347;
+	u64 t__2e348;
+	u64 t__2e350;
+	u64 t__2e351;
+	u64 t__2e352;
+	u64 t__2e355;
+	u64 t_abortsite_2e262;
+	u64 t_binding_2e244;
+	u64 t_binding_2e255;
+	u64 t_binding_2e294;
+	u64 t_field_2e307;
+	u64 t_item_2e325;
+	u64 t_object_2e323;
+	u64 t_p;
+	u64 t_param_2e240;
+	t_p = (u64)p_p;
+	L_start_2e239:;
+	t_param_2e240 = (u64)A0;
+	t_binding_2e244 = (u64)A1;
+	t_binding_2e255 = (u64)A2;
+	t_binding_2e294 = (u64)A3;
+	t_object_2e323 = (u64)A4;
+	*(u64 *)t_param_2e240 = (u64)t_p;
+	L_body_2e241:;
+	t__2e246 = (u64)(*(u64 *)t_param_2e240);
+	t__2e247 = (u64)(u32)(((u64)t__2e246 == (u64)((u64)0UL)));
+	if ((u32)t__2e247) goto L_matches_2e248; else goto L_next_2e249;
+	L_matches_2e248:;
+	return;
+	L_next_2e249:;
+	t__2e252 = (u64)(u32)(((u64)t__2e246 != (u64)((u64)0UL)));
+	if ((u32)t__2e252) goto L_matches_2e253; else goto L_next_2e254;
+	L_matches_2e253:;
+	*(u64 *)t_binding_2e255 = (u64)t__2e246;
+	t__2e258 = (u64)(*(u64 *)t_binding_2e255);
+	t__2e257 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2egetmeta)))((u64)t__2e258));
+	*(u64 *)t_binding_2e244 = (u64)t__2e257;
+	goto L__2e245;
+	L_next_2e254:;
+	L__2e260:;
+	t_abortsite_2e262 = ((u64)0UL);
+	goto L_abort_2e263;
+	L__2e245:;
+	t__2e269 = (u64)(*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)));
+	t__2e269 = (u64)((u64)t__2e269 - (u64)((u64)1UL));
+	*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)) = (u64)t__2e269;
+	t__2e275 = (u64)(*(u64 *)t_binding_2e244);
+	t__2e277 = (u64)(*(u64 *)t__2e275);
+	t__2e274 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_rt_2esize__islarge)))((u64)t__2e277));
+	t__2e278 = (u64)(u32)((u8)t__2e274);
+	if ((u32)t__2e278) goto L_true_2e271; else goto L_false_2e272;
+	L_true_2e271:;
+	t__2e283 = (u64)(*(u64 *)t_param_2e240);
+	t__2e282 = (u64)((u64)t__2e283 - (u64)((u64)16UL));
+	t__2e289 = (u64)(*(u64 *)t_binding_2e244);
+	t__2e291 = (u64)(*(u64 *)t__2e289);
+	t__2e288 = (u64)((u64)t__2e291 + (u64)((u64)16UL));
+	t__2e287 = (u64)((u64)t__2e288 + (u64)((u64)8UL));
+	t__2e281 = (u64)(u32)(((u32 (*)(u64, u64))((u64)((char *)&F_rt_2esegfree)))((u64)t__2e282, (u64)t__2e287));
+	return;
+	L_false_2e272:;
+	L__2e273:;
+	t__2e296 = (u64)(*(u64 *)t_binding_2e244);
+	t__2e298 = (u64)(*(u64 *)t__2e296);
+	t__2e295 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esize__getbin)))((u64)t__2e298));
+	*(u64 *)t_binding_2e294 = (u64)t__2e295;
+	goto L_true_2e300;
+	L_true_2e300:;
+	t__2e306 = (u64)(*(u64 *)t_binding_2e244);
+	t_field_2e307 = (u64)((u64)t__2e306 + (u64)((u64)8UL));
+	t__2e312 = (u64)(*(u64 *)t__2e306);
+	t__2e313 = t__2e312;
+	t__2e313 = t__2e312;
+	t__2e322 = (u64)(u32)(((u64)t__2e313 != (u64)((u64)0UL)));
+	if ((u32)t__2e322) goto L__2e321; else goto L__2e302;
+	L__2e321:;
+	t_item_2e325 = (u64)((u64)t_object_2e323 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e325 = (u8)((u64)105UL);
+	t__2e326 = (u64)(u32)(*(u8 *)t_object_2e323);
+	*(u8 *)t_field_2e307 = (u8)t__2e326;
+	t__2e327 = (u64)((u64)t_field_2e307 + (u64)((u64)1UL));
+	t__2e313 = (u64)((u64)t__2e313 - (u64)((u64)1UL));
+	t__2e313 = t__2e313;
+	((void (*)(u64, u64, u64))((u64)((char *)&F_rt_2ememcpy)))((u64)t__2e327, (u64)t_field_2e307, (u64)t__2e313);
+	L__2e320:;
+	goto L__2e302;
+	L__2e302:;
+	t__2e334 = (u64)(*(u64 *)t_binding_2e244);
+	t__2e338 = (u64)(*(u64 *)t_binding_2e294);
+	t__2e337 = (u64)((u64)t__2e338 * (u64)((u64)8UL));
+	t__2e337 = (u64)((u64)((u64)((char *)&D_rt_2ebins)) + (u64)t__2e337);
+	t__2e339 = (u64)(u32)(((u64)t__2e338 < (u64)((u64)9UL)));
+	if ((u32)t__2e339) goto L__2e341; else goto L__2e340;
+	L__2e340:;
+	t_abortsite_2e262 = ((u64)1UL);
+	goto L_abort_2e342;
+	L__2e341:;
+	t__2e348 = (u64)(*(u64 *)t__2e337);
+	t__2e336 = (u64)((u64)t__2e348 | (u64)((u64)1UL));
+	*(u64 *)t__2e334 = (u64)t__2e336;
+	t__2e351 = (u64)(*(u64 *)t_binding_2e294);
+	t__2e350 = (u64)((u64)t__2e351 * (u64)((u64)8UL));
+	t__2e350 = (u64)((u64)((u64)((char *)&D_rt_2ebins)) + (u64)t__2e350);
+	t__2e352 = (u64)(u32)(((u64)t__2e351 < (u64)((u64)9UL)));
+	if ((u32)t__2e352) goto L__2e354; else goto L__2e353;
+	L__2e353:;
+	t_abortsite_2e262 = ((u64)2UL);
+	goto L_abort_2e342;
+	L__2e354:;
+	t__2e355 = (u64)(*(u64 *)t_binding_2e244);
+	*(u64 *)t__2e350 = (u64)t__2e355;
+	goto L__2e242;
+	L__2e242:;
+	return;
+	L_abort_2e263:;
+	t__2e264 = (u64)((u64)t_abortsite_2e262 * (u64)((u64)16UL));
+	t__2e264 = (u64)((u64)((u64)((char *)&D_abortsites_2e261)) + (u64)t__2e264);
+	t__2e265 = (u64)(*(u64 *)t__2e264);
+	t__2e266 = (u64)((u64)t__2e264 + (u64)((u64)8UL));
+	t__2e267 = (u64)(*(u32 *)t__2e266);
+	t__2e266 = (u64)((u64)t__2e264 + (u64)((u64)12UL));
+	t__2e268 = (u64)(*(u32 *)t__2e266);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e265, (u64)t__2e267, (u64)t__2e268, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e342:;
+	t__2e343 = (u64)((u64)t_abortsite_2e262 * (u64)((u64)16UL));
+	t__2e343 = (u64)((u64)((u64)((char *)&D_abortsites_2e261)) + (u64)t__2e343);
+	t__2e344 = (u64)(*(u64 *)t__2e343);
+	t__2e345 = (u64)((u64)t__2e343 + (u64)((u64)8UL));
+	t__2e346 = (u64)(*(u32 *)t__2e345);
+	t__2e345 = (u64)((u64)t__2e343 + (u64)((u64)12UL));
+	t__2e347 = (u64)(*(u32 *)t__2e345);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e344, (u64)t__2e346, (u64)t__2e347, (u64)((u64)0UL));
+	__builtin_trap();
+}
+u64 F_rt_2emalloc(u64 p_n) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[16] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	u64 t__2e366;
+	u64 t__2e367;
+	u64 t__2e368;
+	u64 t__2e375;
+	u64 t__2e376;
+	u64 t__2e377;
+	u64 t__2e380;
+	u64 t__2e381;
+	u64 t__2e384;
+	u64 t__2e385;
+	u64 t__2e386;
+	u64 t__2e387;
+	u64 t__2e388;
+	u64 t__2e394;
+	u64 t__2e399;
+	u64 t__2e400;
+	u64 t__2e401;
+	u64 t__2e411;
+	u64 t__2e412;
+	u64 t__2e413;
+	u64 t__2e414;
+	u64 t__2e415;
+	u64 t__2e416;
+	u64 t__2e418;
+	u64 t__2e419;
+	u64 t__2e421;
+	u64 t__2e423;
+	u64 t__2e425;
+	u64 t__2e426;
+	u64 t__2e431;
+	u64 t__2e432;
+	u64 t__2e434;
+	u64 t__2e444;
+	u64 t__2e445;
+	u64 t__2e446;
+	u64 t__2e447;
+	u64 t__2e448;
+	u64 t__2e449;
+	u64 t__2e450;
+	u64 t__2e451;
+	u64 t__2e452;
+	u64 t__2e453;
+	u64 t__2e458;
+	u64 t__2e459;
+	u64 t__2e460;
+	u64 t__2e464;
+	u64 t__2e465;
+	u64 t__2e466;
+	u64 t__2e467;
+	u64 t__2e468;
+	u64 t__2e469;
+	u64 t__2e470;
+	u64 t__2e478;
+	u64 t__2e479;
+	u64 t__2e480;
+	u64 t__2e481;
+	u64 t__2e484;
+	u64 t__2e485;
+	u64 t__2e486;
+	u64 t__2e491;
+	u64 t__2e492;
+	u64 t__2e500;
+	u64 t__2e508;
+	u64 t__2e514;
+	u64 t__2e518;
+	u64 t__2e521;
+	u64 t__2e523;
+	u64 t__2e524;
+	u64 t__2e525;
+	u64 t__2e526;
+	u64 t__2e528;
+	u64 t__2e529;
+	u64 t__2e531;
+	u64 t__2e533;
+	u64 t__2e535;
+	u64 t__2e537;
+	u64 t__2e542;
+	u64 t__2e543;
+	u64 t__2e544;
+	u64 t__2e547;
+	u64 t__2e555;
+	u64 t__2e556;
+	u64 t__2e557;
+	u64 t__2e559;
+	u64 t__2e560;
+	u64 t__2e561;
+	u64 t__2e563;
+	u64 t__2e568;
+	u64 t__2e569;
+	u64 t__2e570;
+	u64 t__2e572;
+	u64 t__2e573;
+	u64 t__2e576;
+	u64 t__2e577;
+	u64 t_abortsite_2e409;
+	u64 t_binding_2e382;
+	u64 t_binding_2e397;
+	u64 t_binding_2e430;
+	u64 t_binding_2e433;
+	u64 t_binding_2e440;
+	u64 t_binding_2e456;
+	u64 t_binding_2e503;
+	u64 t_binding_2e512;
+	u64 t_binding_2e540;
+	u64 t_field_2e420;
+	u64 t_field_2e427;
+	u64 t_field_2e530;
+	u64 t_field_2e578;
+	u64 t_n;
+	u64 t_object_2e506;
+	u64 t_param_2e358;
+	u64 t_param_2e435;
+	u64 t_param_2e548;
+	u64 t_value_2e483;
+	u64 t_value_2e507;
+	u64 t_value_2e513;
+	u64 t_value_2e520;
+	u64 t_value_2e522;
+	t_n = (u64)p_n;
+	L_start_2e357:;
+	t_param_2e358 = (u64)A0;
+	t_binding_2e382 = (u64)A1;
+	t_binding_2e397 = (u64)A2;
+	t_binding_2e430 = (u64)A3;
+	t_binding_2e433 = (u64)A4;
+	t_param_2e435 = (u64)A5;
+	t_binding_2e440 = (u64)A6;
+	t_binding_2e456 = (u64)A7;
+	t_binding_2e503 = (u64)A8;
+	t_object_2e506 = (u64)A9;
+	t_binding_2e512 = (u64)A10;
+	t_binding_2e540 = (u64)A11;
+	t_param_2e548 = (u64)A12;
+	*(u64 *)t_param_2e358 = (u64)t_n;
+	L_body_2e359:;
+	t__2e367 = (u64)(*(u64 *)t_param_2e358);
+	t__2e366 = (u64)(u32)(((u64)t__2e367 == (u64)((u64)0UL)));
+	t__2e368 = (u64)(u32)((u8)t__2e366);
+	if ((u32)t__2e368) goto L_true_2e363; else goto L_false_2e364;
+	L_true_2e363:;
+	return (u64)((u64)0UL);
+	L_false_2e364:;
+	L__2e365:;
+	t__2e376 = (u64)(*(u64 *)t_param_2e358);
+	t__2e375 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_rt_2esize__islarge)))((u64)t__2e376));
+	t__2e377 = (u64)(u32)((u8)t__2e375);
+	if ((u32)t__2e377) goto L_true_2e372; else goto L_false_2e373;
+	L_true_2e372:;
+	t__2e381 = (u64)(*(u64 *)t_param_2e358);
+	t__2e380 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2erealsz)))((u64)t__2e381));
+	*(u64 *)t_param_2e358 = (u64)t__2e380;
+	t__2e387 = (u64)(*(u64 *)t_param_2e358);
+	t__2e386 = (u64)((u64)t__2e387 + (u64)((u64)16UL));
+	t__2e385 = (u64)((u64)t__2e386 + (u64)((u64)8UL));
+	t__2e384 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esegmalloc)))((u64)t__2e385));
+	t__2e388 = (u64)(u32)(((u64)t__2e384 == (u64)((u64)0UL)));
+	if ((u32)t__2e388) goto L_matches_2e389; else goto L_next_2e390;
+	L_matches_2e389:;
+	return (u64)((u64)0UL);
+	L_next_2e390:;
+	t__2e394 = (u64)(u32)(((u64)t__2e384 != (u64)((u64)0UL)));
+	if ((u32)t__2e394) goto L_matches_2e395; else goto L_next_2e396;
+	L_matches_2e395:;
+	*(u64 *)t_binding_2e397 = (u64)t__2e384;
+	t__2e401 = (u64)(*(u64 *)t_binding_2e397);
+	t__2e400 = (u64)((u64)t__2e401 + (u64)((u64)16UL));
+	t__2e399 = (u64)((u64)t__2e400 - (u64)((u64)8UL));
+	*(u64 *)t_binding_2e382 = (u64)t__2e399;
+	goto L__2e383;
+	L_next_2e396:;
+	L__2e407:;
+	t_abortsite_2e409 = ((u64)0UL);
+	goto L_abort_2e410;
+	L__2e383:;
+	t__2e416 = (u64)(*(u64 *)t_binding_2e382);
+	t__2e418 = (u64)(*(u64 *)t_param_2e358);
+	*(u64 *)t__2e416 = (u64)t__2e418;
+	t__2e419 = (u64)(*(u64 *)t_binding_2e382);
+	t_field_2e420 = (u64)((u64)t__2e419 + (u64)((u64)8UL));
+	t__2e423 = (u64)(*(u64 *)t_param_2e358);
+	t__2e421 = t__2e423;
+	t__2e421 = (u64)((u64)t_field_2e420 + (u64)t__2e421);
+	*(u64 *)t__2e421 = (u64)t__2e423;
+	t__2e425 = (u64)(*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)));
+	t__2e425 = (u64)((u64)t__2e425 + (u64)((u64)1UL));
+	*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)) = (u64)t__2e425;
+	t__2e426 = (u64)(*(u64 *)t_binding_2e382);
+	t_field_2e427 = (u64)((u64)t__2e426 + (u64)((u64)8UL));
+	return (u64)t_field_2e427;
+	L_false_2e373:;
+	L__2e374:;
+	t__2e432 = (u64)(*(u64 *)t_param_2e358);
+	t__2e431 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esize__getbin)))((u64)t__2e432));
+	*(u64 *)t_binding_2e430 = (u64)t__2e431;
+	t__2e434 = (u64)(*(u64 *)t_binding_2e430);
+	*(u64 *)t_param_2e435 = (u64)t__2e434;
+	t__2e445 = (u64)(*(u64 *)t_param_2e435);
+	t__2e444 = (u64)(u32)(((u64)t__2e445 == (u64)((u64)0UL)));
+	t__2e446 = (u64)(u32)((u8)t__2e444);
+	if ((u32)t__2e446) goto L_true_2e441; else goto L_false_2e442;
+	L_true_2e441:;
+	*(u64 *)t_binding_2e440 = (u64)((u64)0UL);
+	goto L__2e443;
+	L_false_2e442:;
+	t__2e449 = (u64)(*(u64 *)t_param_2e435);
+	t__2e448 = (u64)((u64)t__2e449 - (u64)((u64)1UL));
+	t__2e447 = (u64)((u64)((u64)1UL) << (t__2e448 & 63));
+	*(u64 *)t_binding_2e440 = (u64)t__2e447;
+	L__2e443:;
+	t__2e453 = (u64)(*(u64 *)t_binding_2e440);
+	t__2e452 = (u64)((u64)t__2e453 << (((u64)4UL) & 63));
+	t__2e451 = (u64)((u64)t__2e452 + (u64)((u64)16UL));
+	t__2e450 = (u64)((u64)t__2e451 - (u64)((u64)8UL));
+	goto L__2e436;
+	L__2e436:;
+	*(u64 *)t_binding_2e433 = (u64)t__2e450;
+	t__2e459 = (u64)(*(u64 *)t_binding_2e430);
+	t__2e458 = (u64)((u64)t__2e459 * (u64)((u64)8UL));
+	t__2e458 = (u64)((u64)((u64)((char *)&D_rt_2ebins)) + (u64)t__2e458);
+	t__2e460 = (u64)(u32)(((u64)t__2e459 < (u64)((u64)9UL)));
+	if ((u32)t__2e460) goto L__2e462; else goto L__2e461;
+	L__2e461:;
+	t_abortsite_2e409 = ((u64)1UL);
+	goto L_abort_2e463;
+	L__2e462:;
+	t__2e469 = (u64)(*(u64 *)t__2e458);
+	t__2e470 = (u64)(u32)(((u64)t__2e469 == (u64)((u64)0UL)));
+	if ((u32)t__2e470) goto L_matches_2e471; else goto L_next_2e472;
+	L_matches_2e471:;
+	t_value_2e483 = (u64)((u64)((u64)((char *)&D_rt_2ecur__chunk)) + (u64)((u64)8UL));
+	t__2e484 = (u64)(*(u64 *)t_value_2e483);
+	t__2e481 = (u64)((u64)t__2e484 + (u64)((u64)8UL));
+	t__2e485 = (u64)(*(u64 *)t_binding_2e433);
+	t__2e480 = (u64)((u64)t__2e481 + (u64)t__2e485);
+	t__2e479 = (u64)((u64)t__2e480 + (u64)((u64)8UL));
+	t__2e478 = (u64)(u32)(((u64)t__2e479 > (u64)((u64)2097152UL)));
+	t__2e486 = (u64)(u32)((u8)t__2e478);
+	if ((u32)t__2e486) goto L_true_2e475; else goto L_false_2e476;
+	L_true_2e475:;
+	t__2e491 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esegmalloc)))((u64)((u64)2097152UL)));
+	t__2e492 = (u64)(u32)(((u64)t__2e491 == (u64)((u64)0UL)));
+	if ((u32)t__2e492) goto L_matches_2e493; else goto L_next_2e494;
+	L_matches_2e493:;
+	return (u64)((u64)0UL);
+	L_next_2e494:;
+	t__2e500 = (u64)(u32)(((u64)t__2e491 != (u64)((u64)0UL)));
+	if ((u32)t__2e500) goto L_matches_2e501; else goto L_next_2e502;
+	L_matches_2e501:;
+	*(u64 *)t_binding_2e503 = (u64)t__2e491;
+	t_value_2e507 = t_object_2e506;
+	t__2e508 = (u64)(*(u64 *)t_binding_2e503);
+	*(u64 *)t_value_2e507 = (u64)t__2e508;
+	t_value_2e507 = (u64)((u64)t_object_2e506 + (u64)((u64)8UL));
+	*(u64 *)t_value_2e507 = (u64)((u64)8UL);
+	BLIT(((u64)((char *)&D_rt_2ecur__chunk)), t_object_2e506, ((u64)16UL));
+	goto L__2e477;
+	L_next_2e502:;
+	L__2e510:;
+	t_abortsite_2e409 = ((u64)2UL);
+	goto L_abort_2e410;
+	L_false_2e476:;
+	L__2e477:;
+	t_value_2e513 = (u64)((u64)((u64)((char *)&D_rt_2ecur__chunk)) + (u64)((u64)0UL));
+	t__2e514 = (u64)(*(u64 *)t_value_2e513);
+	t_value_2e520 = (u64)((u64)((u64)((char *)&D_rt_2ecur__chunk)) + (u64)((u64)8UL));
+	t__2e521 = (u64)(*(u64 *)t_value_2e520);
+	t__2e518 = t__2e521;
+	t__2e518 = (u64)((u64)t__2e514 + (u64)t__2e518);
+	*(u64 *)t_binding_2e512 = (u64)t__2e518;
+	t_value_2e522 = (u64)((u64)((u64)((char *)&D_rt_2ecur__chunk)) + (u64)((u64)8UL));
+	t__2e523 = (u64)(*(u64 *)t_value_2e522);
+	t__2e525 = (u64)(*(u64 *)t_binding_2e433);
+	t__2e524 = (u64)((u64)((u64)8UL) + (u64)t__2e525);
+	t__2e523 = (u64)((u64)t__2e523 + (u64)t__2e524);
+	*(u64 *)t_value_2e522 = (u64)t__2e523;
+	t__2e526 = (u64)(*(u64 *)t_binding_2e512);
+	t__2e528 = (u64)(*(u64 *)t_binding_2e433);
+	*(u64 *)t__2e526 = (u64)t__2e528;
+	t__2e529 = (u64)(*(u64 *)t_binding_2e512);
+	t_field_2e530 = (u64)((u64)t__2e529 + (u64)((u64)8UL));
+	t__2e533 = (u64)(*(u64 *)t_binding_2e433);
+	t__2e531 = t__2e533;
+	t__2e531 = (u64)((u64)t_field_2e530 + (u64)t__2e531);
+	*(u64 *)t__2e531 = (u64)t__2e533;
+	t__2e535 = (u64)(*(u64 *)t_binding_2e512);
+	*(u64 *)t_binding_2e456 = (u64)t__2e535;
+	goto L__2e457;
+	L_next_2e472:;
+	t__2e537 = (u64)(u32)(((u64)t__2e469 != (u64)((u64)0UL)));
+	if ((u32)t__2e537) goto L_matches_2e538; else goto L_next_2e539;
+	L_matches_2e538:;
+	*(u64 *)t_binding_2e540 = (u64)t__2e469;
+	t__2e543 = (u64)(*(u64 *)t_binding_2e430);
+	t__2e542 = (u64)((u64)t__2e543 * (u64)((u64)8UL));
+	t__2e542 = (u64)((u64)((u64)((char *)&D_rt_2ebins)) + (u64)t__2e542);
+	t__2e544 = (u64)(u32)(((u64)t__2e543 < (u64)((u64)9UL)));
+	if ((u32)t__2e544) goto L__2e546; else goto L__2e545;
+	L__2e545:;
+	t_abortsite_2e409 = ((u64)3UL);
+	goto L_abort_2e463;
+	L__2e546:;
+	t__2e547 = (u64)(*(u64 *)t_binding_2e540);
+	*(u64 *)t_param_2e548 = (u64)t__2e547;
+	t__2e557 = (u64)(*(u64 *)t_param_2e548);
+	t__2e559 = (u64)(*(u64 *)t__2e557);
+	t__2e556 = (u64)((u64)t__2e559 & (u64)((u64)1UL));
+	t__2e555 = (u64)(u32)(((u64)t__2e556 == (u64)((u64)1UL)));
+	if ((u32)t__2e555) goto L_passed_2e554; else goto L_failed_2e553;
+	L_failed_2e553:;
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e104)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)208UL), (u64)((u64)15UL), (u64)B13);
+	__builtin_trap();
+	L_passed_2e554:;
+	t__2e561 = (u64)(*(u64 *)t_param_2e548);
+	t__2e563 = (u64)(*(u64 *)t__2e561);
+	t__2e560 = (u64)((u64)t__2e563 & (u64)((u64)18446744073709551614UL));
+	goto L__2e549;
+	L__2e549:;
+	*(u64 *)t__2e542 = (u64)t__2e560;
+	t__2e568 = (u64)(*(u64 *)t_binding_2e540);
+	t__2e569 = (u64)(*(u64 *)t_binding_2e433);
+	((void (*)(u64, u64))((u64)((char *)&F_rt_2echeckpoison)))((u64)t__2e568, (u64)t__2e569);
+	t__2e570 = (u64)(*(u64 *)t_binding_2e540);
+	t__2e572 = (u64)(*(u64 *)t_binding_2e433);
+	*(u64 *)t__2e570 = (u64)t__2e572;
+	t__2e573 = (u64)(*(u64 *)t_binding_2e540);
+	*(u64 *)t_binding_2e456 = (u64)t__2e573;
+	goto L__2e457;
+	L_next_2e539:;
+	L__2e575:;
+	t_abortsite_2e409 = ((u64)4UL);
+	goto L_abort_2e410;
+	L__2e457:;
+	t__2e576 = (u64)(*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)));
+	t__2e576 = (u64)((u64)t__2e576 + (u64)((u64)1UL));
+	*(u64 *)((u64)((char *)&D_rt_2ecur__allocs)) = (u64)t__2e576;
+	t__2e577 = (u64)(*(u64 *)t_binding_2e456);
+	t_field_2e578 = (u64)((u64)t__2e577 + (u64)((u64)8UL));
+	return (u64)t_field_2e578;
+	L_abort_2e410:;
+	t__2e411 = (u64)((u64)t_abortsite_2e409 * (u64)((u64)16UL));
+	t__2e411 = (u64)((u64)((u64)((char *)&D_abortsites_2e408)) + (u64)t__2e411);
+	t__2e412 = (u64)(*(u64 *)t__2e411);
+	t__2e413 = (u64)((u64)t__2e411 + (u64)((u64)8UL));
+	t__2e414 = (u64)(*(u32 *)t__2e413);
+	t__2e413 = (u64)((u64)t__2e411 + (u64)((u64)12UL));
+	t__2e415 = (u64)(*(u32 *)t__2e413);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e412, (u64)t__2e414, (u64)t__2e415, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e463:;
+	t__2e464 = (u64)((u64)t_abortsite_2e409 * (u64)((u64)16UL));
+	t__2e464 = (u64)((u64)((u64)((char *)&D_abortsites_2e408)) + (u64)t__2e464);
+	t__2e465 = (u64)(*(u64 *)t__2e464);
+	t__2e466 = (u64)((u64)t__2e464 + (u64)((u64)8UL));
+	t__2e467 = (u64)(*(u32 *)t__2e466);
+	t__2e466 = (u64)((u64)t__2e464 + (u64)((u64)12UL));
+	t__2e468 = (u64)(*(u32 *)t__2e466);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e465, (u64)t__2e467, (u64)t__2e468, (u64)((u64)0UL));
+	__builtin_trap();
+}
+u32 F_rt_2emprotect(u64 p_addr, u64 p_length, u32 p_prot) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	u64 t__2e586;
+	u64 t__2e587;
+	u64 t__2e590;
+	u64 t__2e592;
+	u64 t__2e593;
+	u64 t__2e594;
+	u64 t_addr;
+	u64 t_length;
+	u64 t_param_2e582;
+	u64 t_param_2e583;
+	u64 t_param_2e584;
+	u64 t_prot;
+	t_addr = (u64)p_addr;
+	t_length = (u64)p_length;
+	t_prot = (u64)p_prot;
+	L_start_2e581:;
+	t_param_2e582 = (u64)A0;
+	t_param_2e583 = (u64)A1;
+	t_param_2e584 = (u64)A2;
+	*(u64 *)t_param_2e582 = (u64)t_addr;
+	*(u64 *)t_param_2e583 = (u64)t_length;
+	*(u32 *)t_param_2e584 = (u32)t_prot;
+	L_body_2e585:;
+	t__2e587 = (u64)(*(u64 *)t_param_2e582);
+	t__2e590 = (u64)(*(u64 *)t_param_2e583);
+	t__2e592 = (u64)(u32)(*(u32 *)t_param_2e584);
+	t__2e593 = (u64)((u32)t__2e592);
+	t__2e586 = (u64)(((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2esyscall3))((u64)((u64)10UL), (u64)t__2e587, (u64)t__2e590, (u64)t__2e593));
+	t__2e594 = (u64)(u32)t__2e586;
+	return (u32)t__2e594;
+}
+u32 F_rt_2emunmap(u64 p_addr, u64 p_length) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e599;
+	u64 t__2e600;
+	u64 t__2e603;
+	u64 t__2e605;
+	u64 t_addr;
+	u64 t_length;
+	u64 t_param_2e596;
+	u64 t_param_2e597;
+	t_addr = (u64)p_addr;
+	t_length = (u64)p_length;
+	L_start_2e595:;
+	t_param_2e596 = (u64)A0;
+	t_param_2e597 = (u64)A1;
+	*(u64 *)t_param_2e596 = (u64)t_addr;
+	*(u64 *)t_param_2e597 = (u64)t_length;
+	L_body_2e598:;
+	t__2e600 = (u64)(*(u64 *)t_param_2e596);
+	t__2e603 = (u64)(*(u64 *)t_param_2e597);
+	t__2e599 = (u64)(((u64 (*)(u64, u64, u64))((u64)X_rt_2esyscall2))((u64)((u64)11UL), (u64)t__2e600, (u64)t__2e603));
+	t__2e605 = (u64)(u32)t__2e599;
+	return (u32)t__2e605;
+}
+u64 F_rt_2emmap(u64 p_addr, u64 p_length, u32 p_prot, u32 p_flags, u32 p_fd, u64 p_offs) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[4] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	u64 t__2e617;
+	u64 t__2e618;
+	u64 t__2e621;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e627;
+	u64 t__2e628;
+	u64 t__2e629;
+	u64 t__2e631;
+	u64 t__2e635;
+	u64 t__2e638;
+	u64 t__2e641;
+	u64 t__2e644;
+	u64 t__2e645;
+	u64 t__2e646;
+	u64 t__2e648;
+	u64 t__2e649;
+	u64 t__2e651;
+	u64 t__2e652;
+	u64 t__2e653;
+	u64 t__2e654;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t__2e657;
+	u64 t__2e664;
+	u64 t_addr;
+	u64 t_binding_2e616;
+	u64 t_fd;
+	u64 t_flags;
+	u64 t_length;
+	u64 t_offs;
+	u64 t_param_2e607;
+	u64 t_param_2e608;
+	u64 t_param_2e609;
+	u64 t_param_2e610;
+	u64 t_param_2e611;
+	u64 t_param_2e612;
+	u64 t_prot;
+	t_addr = (u64)p_addr;
+	t_length = (u64)p_length;
+	t_prot = (u64)p_prot;
+	t_flags = (u64)p_flags;
+	t_fd = (u64)p_fd;
+	t_offs = (u64)p_offs;
+	L_start_2e606:;
+	t_param_2e607 = (u64)A0;
+	t_param_2e608 = (u64)A1;
+	t_param_2e609 = (u64)A2;
+	t_param_2e610 = (u64)A3;
+	t_param_2e611 = (u64)A4;
+	t_param_2e612 = (u64)A5;
+	t_binding_2e616 = (u64)A6;
+	*(u64 *)t_param_2e607 = (u64)t_addr;
+	*(u64 *)t_param_2e608 = (u64)t_length;
+	*(u32 *)t_param_2e609 = (u32)t_prot;
+	*(u32 *)t_param_2e610 = (u32)t_flags;
+	*(u32 *)t_param_2e611 = (u32)t_fd;
+	*(u64 *)t_param_2e612 = (u64)t_offs;
+	L_body_2e613:;
+	t__2e618 = (u64)(*(u64 *)t_param_2e607);
+	t__2e621 = (u64)(*(u64 *)t_param_2e608);
+	t__2e623 = (u64)(u32)(*(u32 *)t_param_2e609);
+	t__2e624 = (u64)((u32)t__2e623);
+	t__2e625 = (u64)(u32)(*(u32 *)t_param_2e610);
+	t__2e626 = (u64)((u32)t__2e625);
+	t__2e627 = (u64)(u32)(*(i32 *)t_param_2e611);
+	t__2e628 = (u64)((i64)(i32)t__2e627);
+	t__2e629 = (u64)(*(u64 *)t_param_2e612);
+	t__2e617 = (u64)(((u64 (*)(u64, u64, u64, u64, u64, u64, u64))((u64)X_rt_2esyscall6))((u64)((u64)9UL), (u64)t__2e618, (u64)t__2e621, (u64)t__2e624, (u64)t__2e626, (u64)t__2e628, (u64)t__2e629));
+	*(u64 *)t_binding_2e616 = (u64)t__2e617;
+	t__2e645 = (u64)(*(u64 *)t_binding_2e616);
+	t__2e646 = (u64)(u32)t__2e645;
+	t__2e644 = (u64)(u32)(((u32)t__2e646 == (u32)((u64)4294967295UL)));
+	t__2e641 = (u64)(u32)t__2e644;
+	if ((u32)t__2e641) goto L__2e642; else goto L__2e643;
+	L__2e642:;
+	t__2e649 = (u64)(*(u64 *)t_param_2e607);
+	t__2e648 = (u64)(u32)(((u64)t__2e649 == (u64)((u64)0UL)));
+	t__2e641 = (u64)(u32)t__2e648;
+	goto L__2e643;
+	L__2e643:;
+	t__2e638 = (u64)(u32)t__2e641;
+	if ((u32)t__2e638) goto L__2e639; else goto L__2e640;
+	L__2e639:;
+	t__2e653 = (u64)(u32)(*(u32 *)t_param_2e610);
+	t__2e652 = (u64)(u32)((u32)t__2e653 & (u32)((u64)32UL));
+	t__2e651 = (u64)(u32)(((u32)t__2e652 > (u32)((u64)0UL)));
+	t__2e638 = (u64)(u32)t__2e651;
+	goto L__2e640;
+	L__2e640:;
+	t__2e635 = (u64)(u32)t__2e638;
+	if ((u32)t__2e635) goto L__2e636; else goto L__2e637;
+	L__2e636:;
+	t__2e656 = (u64)(u32)(*(u32 *)t_param_2e610);
+	t__2e655 = (u64)(u32)((u32)t__2e656 & (u32)((u64)16UL));
+	t__2e654 = (u64)(u32)(((u32)t__2e655 == (u32)((u64)0UL)));
+	t__2e635 = (u64)(u32)t__2e654;
+	goto L__2e637;
+	L__2e637:;
+	t__2e657 = (u64)(u32)((u8)t__2e635);
+	if ((u32)t__2e657) goto L_true_2e632; else goto L_false_2e633;
+	L_true_2e632:;
+	goto L__2e658;
+	L__2e658:;
+	t__2e631 = ((u64)18446744073709551604UL);
+	goto L__2e634;
+	L_false_2e633:;
+	t__2e664 = (u64)(*(u64 *)t_binding_2e616);
+	t__2e631 = t__2e664;
+	L__2e634:;
+	return (u64)t__2e631;
+}
+u32 F_rt_2epipe2(u64 p_pipefd, u32 p_flags) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e673;
+	u64 t__2e674;
+	u64 t__2e677;
+	u64 t__2e678;
+	u64 t__2e679;
+	u64 t_flags;
+	u64 t_param_2e670;
+	u64 t_param_2e671;
+	u64 t_pipefd;
+	t_pipefd = (u64)p_pipefd;
+	t_flags = (u64)p_flags;
+	L_start_2e669:;
+	t_param_2e670 = (u64)A0;
+	t_param_2e671 = (u64)A1;
+	*(u64 *)t_param_2e670 = (u64)t_pipefd;
+	*(u32 *)t_param_2e671 = (u32)t_flags;
+	L_body_2e672:;
+	t__2e674 = (u64)(*(u64 *)t_param_2e670);
+	t__2e677 = (u64)(u32)(*(i32 *)t_param_2e671);
+	t__2e678 = (u64)((i64)(i32)t__2e677);
+	t__2e673 = (u64)(((u64 (*)(u64, u64, u64))((u64)X_rt_2esyscall2))((u64)((u64)293UL), (u64)t__2e674, (u64)t__2e678));
+	t__2e679 = (u64)(u32)t__2e673;
+	return (u32)t__2e679;
+}
+u32 F_rt_2ekill(u32 p_pid, u32 p_signal) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e684;
+	u64 t__2e685;
+	u64 t__2e686;
+	u64 t__2e687;
+	u64 t__2e688;
+	u64 t__2e689;
+	u64 t_param_2e681;
+	u64 t_param_2e682;
+	u64 t_pid;
+	u64 t_signal;
+	t_pid = (u64)p_pid;
+	t_signal = (u64)p_signal;
+	L_start_2e680:;
+	t_param_2e681 = (u64)A0;
+	t_param_2e682 = (u64)A1;
+	*(u32 *)t_param_2e681 = (u32)t_pid;
+	*(u32 *)t_param_2e682 = (u32)t_signal;
+	L_body_2e683:;
+	t__2e685 = (u64)(u32)(*(i32 *)t_param_2e681);
+	t__2e686 = (u64)((i64)(i32)t__2e685);
+	t__2e687 = (u64)(u32)(*(i32 *)t_param_2e682);
+	t__2e688 = (u64)((i64)(i32)t__2e687);
+	t__2e684 = (u64)(((u64 (*)(u64, u64, u64))((u64)X_rt_2esyscall2))((u64)((u64)62UL), (u64)t__2e686, (u64)t__2e688));
+	t__2e689 = (u64)(u32)t__2e684;
+	return (u32)t__2e689;
+}
+u32 F_rt_2ewifsignaled(u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e693;
+	u64 t__2e694;
+	u64 t__2e695;
+	u64 t__2e696;
+	u64 t_param_2e691;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e690:;
+	t_param_2e691 = (u64)A0;
+	*(u32 *)t_param_2e691 = (u32)t_status;
+	L_body_2e692:;
+	t__2e696 = (u64)(u32)(*(i32 *)t_param_2e691);
+	t__2e695 = (u64)(u32)((u32)t__2e696 & (u32)((u64)65535UL));
+	t__2e694 = (u64)(u32)((u32)t__2e695 - (u32)((u64)1UL));
+	t__2e693 = (u64)(u32)(((i32)t__2e694 < (i32)((u64)255UL)));
+	return (u32)t__2e693;
+}
+u32 F_rt_2ewtermsig(u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e700;
+	u64 t__2e701;
+	u64 t_param_2e698;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e697:;
+	t_param_2e698 = (u64)A0;
+	*(u32 *)t_param_2e698 = (u32)t_status;
+	L_body_2e699:;
+	t__2e701 = (u64)(u32)(*(i32 *)t_param_2e698);
+	t__2e700 = (u64)(u32)((u32)t__2e701 & (u32)((u64)127UL));
+	return (u32)t__2e700;
+}
+u32 F_rt_2ewexitstatus(u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e705;
+	u64 t__2e706;
+	u64 t__2e707;
+	u64 t_param_2e703;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e702:;
+	t_param_2e703 = (u64)A0;
+	*(u32 *)t_param_2e703 = (u32)t_status;
+	L_body_2e704:;
+	t__2e707 = (u64)(u32)(*(i32 *)t_param_2e703);
+	t__2e706 = (u64)(u32)((u32)t__2e707 & (u32)((u64)65280UL));
+	t__2e705 = (u64)(u32)((i32)t__2e706 >> (((u64)8UL) & 31));
+	return (u32)t__2e705;
+}
+u32 F_rt_2ewifexited(u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e711;
+	u64 t__2e712;
+	u64 t__2e716;
+	u64 t__2e717;
+	u64 t_param_2e709;
+	u64 t_param_2e713;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e708:;
+	t_param_2e709 = (u64)A0;
+	t_param_2e713 = (u64)A1;
+	*(u32 *)t_param_2e709 = (u32)t_status;
+	L_body_2e710:;
+	t__2e712 = (u64)(u32)(*(i32 *)t_param_2e709);
+	*(u32 *)t_param_2e713 = (u32)t__2e712;
+	t__2e717 = (u64)(u32)(*(i32 *)t_param_2e713);
+	t__2e716 = (u64)(u32)((u32)t__2e717 & (u32)((u64)127UL));
+	L__2e714:;
+	t__2e711 = (u64)(u32)(((u32)t__2e716 == (u32)((u64)0UL)));
+	return (u32)t__2e711;
+}
+void F_rt_2ewait4(u32 p_pid, u64 p_status, u32 p_options, u64 p_rusage) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e726;
+	u64 t__2e727;
+	u64 t__2e728;
+	u64 t__2e729;
+	u64 t__2e732;
+	u64 t__2e733;
+	u64 t__2e734;
+	u64 t_options;
+	u64 t_param_2e719;
+	u64 t_param_2e720;
+	u64 t_param_2e721;
+	u64 t_param_2e722;
+	u64 t_pid;
+	u64 t_rusage;
+	u64 t_status;
+	t_pid = (u64)p_pid;
+	t_status = (u64)p_status;
+	t_options = (u64)p_options;
+	t_rusage = (u64)p_rusage;
+	L_start_2e718:;
+	t_param_2e719 = (u64)A0;
+	t_param_2e720 = (u64)A1;
+	t_param_2e721 = (u64)A2;
+	t_param_2e722 = (u64)A3;
+	*(u32 *)t_param_2e719 = (u32)t_pid;
+	*(u64 *)t_param_2e720 = (u64)t_status;
+	*(u32 *)t_param_2e721 = (u32)t_options;
+	*(u64 *)t_param_2e722 = (u64)t_rusage;
+	L_body_2e723:;
+	t__2e727 = (u64)(u32)(*(i32 *)t_param_2e719);
+	t__2e728 = (u64)((i64)(i32)t__2e727);
+	t__2e729 = (u64)(*(u64 *)t_param_2e720);
+	t__2e732 = (u64)(u32)(*(i32 *)t_param_2e721);
+	t__2e733 = (u64)((i64)(i32)t__2e732);
+	t__2e734 = (u64)(*(u64 *)t_param_2e722);
+	t__2e726 = (u64)(((u64 (*)(u64, u64, u64, u64, u64))((u64)X_rt_2esyscall4))((u64)((u64)61UL), (u64)t__2e728, (u64)t__2e729, (u64)t__2e733, (u64)t__2e734));
+	goto L__2e724;
+	L__2e724:;
+	return;
+}
+u32 F_rt_2eexecve(u64 p_path, u64 p_argv, u64 p_envp) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e743;
+	u64 t__2e744;
+	u64 t__2e747;
+	u64 t__2e750;
+	u64 t__2e753;
+	u64 t_argv;
+	u64 t_envp;
+	u64 t_param_2e739;
+	u64 t_param_2e740;
+	u64 t_param_2e741;
+	u64 t_path;
+	t_path = (u64)p_path;
+	t_argv = (u64)p_argv;
+	t_envp = (u64)p_envp;
+	L_start_2e738:;
+	t_param_2e739 = (u64)A0;
+	t_param_2e740 = (u64)A1;
+	t_param_2e741 = (u64)A2;
+	*(u64 *)t_param_2e739 = (u64)t_path;
+	*(u64 *)t_param_2e740 = (u64)t_argv;
+	*(u64 *)t_param_2e741 = (u64)t_envp;
+	L_body_2e742:;
+	t__2e744 = (u64)(*(u64 *)t_param_2e739);
+	t__2e747 = (u64)(*(u64 *)t_param_2e740);
+	t__2e750 = (u64)(*(u64 *)t_param_2e741);
+	t__2e743 = (u64)(((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2esyscall3))((u64)((u64)59UL), (u64)t__2e744, (u64)t__2e747, (u64)t__2e750));
+	t__2e753 = (u64)(u32)t__2e743;
+	return (u32)t__2e753;
+}
+u32 F_rt_2efork(void) {
+	u64 t__2e756;
+	u64 t__2e758;
+	L_start_2e754:;
+	L_body_2e755:;
+	t__2e756 = (u64)(((u64 (*)(u64, u64, u64))((u64)X_rt_2esyscall2))((u64)((u64)56UL), (u64)((u64)17UL), (u64)((u64)0UL)));
+	t__2e758 = (u64)(u32)t__2e756;
+	return (u32)t__2e758;
+}
+void F_rt_2eexit(u32 p_status) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e764;
+	u64 t__2e765;
+	u64 t__2e766;
+	u64 t__2e770;
+	u64 t__2e771;
+	u64 t__2e772;
+	u64 t__2e773;
+	u64 t__2e774;
+	u64 t_param_2e760;
+	u64 t_status;
+	t_status = (u64)p_status;
+	L_start_2e759:;
+	t_param_2e760 = (u64)A0;
+	*(u32 *)t_param_2e760 = (u32)t_status;
+	L_body_2e761:;
+	t__2e765 = (u64)(u32)(*(i32 *)t_param_2e760);
+	t__2e766 = (u64)((i64)(i32)t__2e765);
+	t__2e764 = (u64)(((u64 (*)(u64, u64))((u64)X_rt_2esyscall1))((u64)((u64)60UL), (u64)t__2e766));
+	goto L_abort_2e769;
+	L_abort_2e769:;
+	t__2e770 = ((u64)0UL);
+	t__2e770 = (u64)((u64)((u64)((char *)&D_abortsites_2e767)) + (u64)t__2e770);
+	t__2e771 = (u64)(*(u64 *)t__2e770);
+	t__2e772 = (u64)((u64)t__2e770 + (u64)((u64)8UL));
+	t__2e773 = (u64)(*(u32 *)t__2e772);
+	t__2e772 = (u64)((u64)t__2e770 + (u64)((u64)12UL));
+	t__2e774 = (u64)(*(u32 *)t__2e772);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e771, (u64)t__2e773, (u64)t__2e774, (u64)((u64)6UL));
+	__builtin_trap();
+}
+u32 F_rt_2egetpid(void) {
+	u64 t__2e779;
+	u64 t__2e780;
+	L_start_2e777:;
+	L_body_2e778:;
+	t__2e779 = (u64)(((u64 (*)(u64))((u64)X_rt_2esyscall0))((u64)((u64)39UL)));
+	t__2e780 = (u64)(u32)t__2e779;
+	return (u32)t__2e780;
+}
+u32 F_rt_2edup2(u32 p_old, u32 p_new) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e787;
+	u64 t__2e788;
+	u64 t__2e789;
+	u64 t__2e790;
+	u64 t_new;
+	u64 t_old;
+	u64 t_param_2e782;
+	u64 t_param_2e783;
+	t_old = (u64)p_old;
+	t_new = (u64)p_new;
+	L_start_2e781:;
+	t_param_2e782 = (u64)A0;
+	t_param_2e783 = (u64)A1;
+	*(u32 *)t_param_2e782 = (u32)t_old;
+	*(u32 *)t_param_2e783 = (u32)t_new;
+	L_body_2e784:;
+	t__2e786 = (u64)(u32)(*(i32 *)t_param_2e782);
+	t__2e787 = (u64)((i64)(i32)t__2e786);
+	t__2e788 = (u64)(u32)(*(i32 *)t_param_2e783);
+	t__2e789 = (u64)((i64)(i32)t__2e788);
+	t__2e785 = (u64)(((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2esyscall3))((u64)((u64)292UL), (u64)t__2e787, (u64)t__2e789, (u64)((u64)0UL)));
+	t__2e790 = (u64)(u32)t__2e785;
+	return (u32)t__2e790;
+}
+u32 F_rt_2edup3(u32 p_old, u32 p_new, u32 p_flags) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	u64 t__2e796;
+	u64 t__2e797;
+	u64 t__2e798;
+	u64 t__2e799;
+	u64 t__2e800;
+	u64 t__2e801;
+	u64 t__2e802;
+	u64 t__2e803;
+	u64 t_flags;
+	u64 t_new;
+	u64 t_old;
+	u64 t_param_2e792;
+	u64 t_param_2e793;
+	u64 t_param_2e794;
+	t_old = (u64)p_old;
+	t_new = (u64)p_new;
+	t_flags = (u64)p_flags;
+	L_start_2e791:;
+	t_param_2e792 = (u64)A0;
+	t_param_2e793 = (u64)A1;
+	t_param_2e794 = (u64)A2;
+	*(u32 *)t_param_2e792 = (u32)t_old;
+	*(u32 *)t_param_2e793 = (u32)t_new;
+	*(u32 *)t_param_2e794 = (u32)t_flags;
+	L_body_2e795:;
+	t__2e797 = (u64)(u32)(*(i32 *)t_param_2e792);
+	t__2e798 = (u64)((i64)(i32)t__2e797);
+	t__2e799 = (u64)(u32)(*(i32 *)t_param_2e793);
+	t__2e800 = (u64)((i64)(i32)t__2e799);
+	t__2e801 = (u64)(u32)(*(i32 *)t_param_2e794);
+	t__2e802 = (u64)((i64)(i32)t__2e801);
+	t__2e796 = (u64)(((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2esyscall3))((u64)((u64)292UL), (u64)t__2e798, (u64)t__2e800, (u64)t__2e802));
+	t__2e803 = (u64)(u32)t__2e796;
+	return (u32)t__2e803;
+}
+u32 F_rt_2eclose(u32 p_fd) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e807;
+	u64 t__2e808;
+	u64 t__2e809;
+	u64 t__2e810;
+	u64 t_fd;
+	u64 t_param_2e805;
+	t_fd = (u64)p_fd;
+	L_start_2e804:;
+	t_param_2e805 = (u64)A0;
+	*(u32 *)t_param_2e805 = (u32)t_fd;
+	L_body_2e806:;
+	t__2e808 = (u64)(u32)(*(i32 *)t_param_2e805);
+	t__2e809 = (u64)((i64)(i32)t__2e808);
+	t__2e807 = (u64)(((u64 (*)(u64, u64))((u64)X_rt_2esyscall1))((u64)((u64)3UL), (u64)t__2e809));
+	t__2e810 = (u64)(u32)t__2e807;
+	return (u32)t__2e810;
+}
+u64 F_rt_2ewrite(u32 p_fd, u64 p_buf, u64 p_count) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e816;
+	u64 t__2e817;
+	u64 t__2e818;
+	u64 t__2e819;
+	u64 t__2e822;
+	u64 t_buf;
+	u64 t_count;
+	u64 t_fd;
+	u64 t_param_2e812;
+	u64 t_param_2e813;
+	u64 t_param_2e814;
+	t_fd = (u64)p_fd;
+	t_buf = (u64)p_buf;
+	t_count = (u64)p_count;
+	L_start_2e811:;
+	t_param_2e812 = (u64)A0;
+	t_param_2e813 = (u64)A1;
+	t_param_2e814 = (u64)A2;
+	*(u32 *)t_param_2e812 = (u32)t_fd;
+	*(u64 *)t_param_2e813 = (u64)t_buf;
+	*(u64 *)t_param_2e814 = (u64)t_count;
+	L_body_2e815:;
+	t__2e817 = (u64)(u32)(*(i32 *)t_param_2e812);
+	t__2e818 = (u64)((i64)(i32)t__2e817);
+	t__2e819 = (u64)(*(u64 *)t_param_2e813);
+	t__2e822 = (u64)(*(u64 *)t_param_2e814);
+	t__2e816 = (u64)(((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2esyscall3))((u64)((u64)1UL), (u64)t__2e818, (u64)t__2e819, (u64)t__2e822));
+	return (u64)t__2e816;
+}
+void F_rt_2ememset(u64 p_dest, u32 p_val, u64 p_amt) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	u64 t__2e833;
+	u64 t__2e839;
+	u64 t__2e840;
+	u64 t__2e841;
+	u64 t__2e849;
+	u64 t__2e850;
+	u64 t__2e851;
+	u64 t__2e852;
+	u64 t__2e854;
+	u64 t__2e855;
+	u64 t__2e858;
+	u64 t__2e859;
+	u64 t__2e861;
+	u64 t__2e862;
+	u64 t__2e864;
+	u64 t__2e866;
+	u64 t__2e867;
+	u64 t__2e869;
+	u64 t__2e871;
+	u64 t__2e872;
+	u64 t__2e873;
+	u64 t__2e875;
+	u64 t__2e876;
+	u64 t__2e877;
+	u64 t__2e878;
+	u64 t__2e885;
+	u64 t__2e886;
+	u64 t__2e887;
+	u64 t__2e888;
+	u64 t__2e891;
+	u64 t__2e892;
+	u64 t__2e894;
+	u64 t__2e895;
+	u64 t__2e896;
+	u64 t__2e897;
+	u64 t__2e899;
+	u64 t__2e900;
+	u64 t__2e901;
+	u64 t__2e902;
+	u64 t__2e903;
+	u64 t__2e905;
+	u64 t__2e906;
+	u64 t__2e907;
+	u64 t__2e908;
+	u64 t__2e909;
+	u64 t__2e911;
+	u64 t__2e912;
+	u64 t__2e913;
+	u64 t__2e915;
+	u64 t__2e921;
+	u64 t__2e922;
+	u64 t__2e923;
+	u64 t__2e926;
+	u64 t__2e927;
+	u64 t__2e929;
+	u64 t__2e930;
+	u64 t__2e932;
+	u64 t__2e933;
+	u64 t__2e934;
+	u64 t__2e935;
+	u64 t__2e942;
+	u64 t__2e943;
+	u64 t__2e944;
+	u64 t__2e947;
+	u64 t__2e948;
+	u64 t__2e950;
+	u64 t__2e951;
+	u64 t__2e953;
+	u64 t_amt;
+	u64 t_binding_2e832;
+	u64 t_binding_2e834;
+	u64 t_binding_2e865;
+	u64 t_binding_2e870;
+	u64 t_binding_2e874;
+	u64 t_binding_2e879;
+	u64 t_dest;
+	u64 t_param_2e826;
+	u64 t_param_2e827;
+	u64 t_param_2e828;
+	u64 t_val;
+	t_dest = (u64)p_dest;
+	t_val = (u64)p_val;
+	t_amt = (u64)p_amt;
+	L_start_2e825:;
+	t_param_2e826 = (u64)A0;
+	t_param_2e827 = (u64)A1;
+	t_param_2e828 = (u64)A2;
+	t_binding_2e832 = (u64)A3;
+	t_binding_2e834 = (u64)A4;
+	t_binding_2e865 = (u64)A5;
+	t_binding_2e870 = (u64)A6;
+	t_binding_2e874 = (u64)A7;
+	t_binding_2e879 = (u64)A8;
+	*(u64 *)t_param_2e826 = (u64)t_dest;
+	*(u8 *)t_param_2e827 = (u8)t_val;
+	*(u64 *)t_param_2e828 = (u64)t_amt;
+	L_body_2e829:;
+	t__2e833 = (u64)(*(u64 *)t_param_2e826);
+	*(u64 *)t_binding_2e832 = (u64)t__2e833;
+	*(u64 *)t_binding_2e834 = (u64)((u64)0UL);
+	t__2e840 = (u64)(*(u64 *)t_param_2e828);
+	t__2e839 = (u64)(u32)(((u64)t__2e840 >= (u64)((u64)16UL)));
+	t__2e841 = (u64)(u32)((u8)t__2e839);
+	if ((u32)t__2e841) goto L_true_2e836; else goto L_false_2e837;
+	L_true_2e836:;
+	L_loop_2e844:;
+	t__2e851 = (u64)(*(u64 *)t_binding_2e832);
+	t__2e854 = (u64)(*(u64 *)t_binding_2e834);
+	t__2e852 = t__2e854;
+	t__2e852 = (u64)((u64)t__2e851 + (u64)t__2e852);
+	t__2e855 = t__2e852;
+	t__2e850 = (u64)((u64)t__2e855 & (u64)((u64)7UL));
+	t__2e849 = (u64)(u32)(((u64)t__2e850 != (u64)((u64)0UL)));
+	if ((u32)t__2e849) goto L_body_2e845; else goto L__2e847;
+	L_body_2e845:;
+	t__2e858 = (u64)(*(u64 *)t_binding_2e832);
+	t__2e861 = (u64)(*(u64 *)t_binding_2e834);
+	t__2e859 = t__2e861;
+	t__2e859 = (u64)((u64)t__2e858 + (u64)t__2e859);
+	t__2e862 = (u64)(u32)(*(u8 *)t_param_2e827);
+	*(u8 *)t__2e859 = (u8)t__2e862;
+	goto L__2e856;
+	L__2e856:;
+	L_after_2e848:;
+	t__2e864 = (u64)(*(u64 *)t_binding_2e834);
+	t__2e864 = (u64)((u64)t__2e864 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e834 = (u64)t__2e864;
+	goto L_loop_2e844;
+	L__2e847:;
+	t__2e866 = (u64)(*(u64 *)t_binding_2e832);
+	t__2e869 = (u64)(*(u64 *)t_binding_2e834);
+	t__2e867 = t__2e869;
+	t__2e867 = (u64)((u64)t__2e866 + (u64)t__2e867);
+	*(u64 *)t_binding_2e865 = (u64)t__2e867;
+	t__2e872 = (u64)(u32)(*(u8 *)t_param_2e827);
+	t__2e873 = (u64)((u8)t__2e872);
+	t__2e871 = (u64)((u64)t__2e873 * (u64)((u64)72340172838076673UL));
+	*(u64 *)t_binding_2e870 = (u64)t__2e871;
+	t__2e877 = (u64)(*(u64 *)t_param_2e828);
+	t__2e878 = (u64)(*(u64 *)t_binding_2e834);
+	t__2e876 = (u64)((u64)t__2e877 - (u64)t__2e878);
+	t__2e875 = (u64)((u64)t__2e876 >> (((u64)3UL) & 63));
+	*(u64 *)t_binding_2e874 = (u64)t__2e875;
+	*(u64 *)t_binding_2e879 = (u64)((u64)0UL);
+	L_loop_2e880:;
+	t__2e887 = (u64)(*(u64 *)t_binding_2e879);
+	t__2e886 = (u64)((u64)t__2e887 + (u64)((u64)4UL));
+	t__2e888 = (u64)(*(u64 *)t_binding_2e874);
+	t__2e885 = (u64)(u32)(((u64)t__2e886 <= (u64)t__2e888));
+	if ((u32)t__2e885) goto L_body_2e881; else goto L__2e883;
+	L_body_2e881:;
+	t__2e891 = (u64)(*(u64 *)t_binding_2e865);
+	t__2e894 = (u64)(*(u64 *)t_binding_2e879);
+	t__2e892 = (u64)((u64)t__2e894 * (u64)((u64)8UL));
+	t__2e892 = (u64)((u64)t__2e891 + (u64)t__2e892);
+	t__2e895 = (u64)(*(u64 *)t_binding_2e870);
+	*(u64 *)t__2e892 = (u64)t__2e895;
+	t__2e896 = (u64)(*(u64 *)t_binding_2e865);
+	t__2e900 = (u64)(*(u64 *)t_binding_2e879);
+	t__2e899 = (u64)((u64)t__2e900 + (u64)((u64)1UL));
+	t__2e897 = (u64)((u64)t__2e899 * (u64)((u64)8UL));
+	t__2e897 = (u64)((u64)t__2e896 + (u64)t__2e897);
+	t__2e901 = (u64)(*(u64 *)t_binding_2e870);
+	*(u64 *)t__2e897 = (u64)t__2e901;
+	t__2e902 = (u64)(*(u64 *)t_binding_2e865);
+	t__2e906 = (u64)(*(u64 *)t_binding_2e879);
+	t__2e905 = (u64)((u64)t__2e906 + (u64)((u64)2UL));
+	t__2e903 = (u64)((u64)t__2e905 * (u64)((u64)8UL));
+	t__2e903 = (u64)((u64)t__2e902 + (u64)t__2e903);
+	t__2e907 = (u64)(*(u64 *)t_binding_2e870);
+	*(u64 *)t__2e903 = (u64)t__2e907;
+	t__2e908 = (u64)(*(u64 *)t_binding_2e865);
+	t__2e912 = (u64)(*(u64 *)t_binding_2e879);
+	t__2e911 = (u64)((u64)t__2e912 + (u64)((u64)3UL));
+	t__2e909 = (u64)((u64)t__2e911 * (u64)((u64)8UL));
+	t__2e909 = (u64)((u64)t__2e908 + (u64)t__2e909);
+	t__2e913 = (u64)(*(u64 *)t_binding_2e870);
+	*(u64 *)t__2e909 = (u64)t__2e913;
+	goto L__2e889;
+	L__2e889:;
+	L_after_2e884:;
+	t__2e915 = (u64)(*(u64 *)t_binding_2e879);
+	t__2e915 = (u64)((u64)t__2e915 + (u64)((u64)4UL));
+	*(u64 *)t_binding_2e879 = (u64)t__2e915;
+	goto L_loop_2e880;
+	L__2e883:;
+	L_loop_2e916:;
+	t__2e922 = (u64)(*(u64 *)t_binding_2e879);
+	t__2e923 = (u64)(*(u64 *)t_binding_2e874);
+	t__2e921 = (u64)(u32)(((u64)t__2e922 < (u64)t__2e923));
+	if ((u32)t__2e921) goto L_body_2e917; else goto L__2e919;
+	L_body_2e917:;
+	t__2e926 = (u64)(*(u64 *)t_binding_2e865);
+	t__2e929 = (u64)(*(u64 *)t_binding_2e879);
+	t__2e927 = (u64)((u64)t__2e929 * (u64)((u64)8UL));
+	t__2e927 = (u64)((u64)t__2e926 + (u64)t__2e927);
+	t__2e930 = (u64)(*(u64 *)t_binding_2e870);
+	*(u64 *)t__2e927 = (u64)t__2e930;
+	goto L__2e924;
+	L__2e924:;
+	L_after_2e920:;
+	t__2e932 = (u64)(*(u64 *)t_binding_2e879);
+	t__2e932 = (u64)((u64)t__2e932 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e879 = (u64)t__2e932;
+	goto L_loop_2e916;
+	L__2e919:;
+	t__2e933 = (u64)(*(u64 *)t_binding_2e834);
+	t__2e935 = (u64)(*(u64 *)t_binding_2e874);
+	t__2e934 = (u64)((u64)t__2e935 << (((u64)3UL) & 63));
+	t__2e933 = (u64)((u64)t__2e933 + (u64)t__2e934);
+	*(u64 *)t_binding_2e834 = (u64)t__2e933;
+	goto L__2e838;
+	L_false_2e837:;
+	L__2e838:;
+	L_loop_2e937:;
+	t__2e943 = (u64)(*(u64 *)t_binding_2e834);
+	t__2e944 = (u64)(*(u64 *)t_param_2e828);
+	t__2e942 = (u64)(u32)(((u64)t__2e943 < (u64)t__2e944));
+	if ((u32)t__2e942) goto L_body_2e938; else goto L__2e830;
+	L_body_2e938:;
+	t__2e947 = (u64)(*(u64 *)t_binding_2e832);
+	t__2e950 = (u64)(*(u64 *)t_binding_2e834);
+	t__2e948 = t__2e950;
+	t__2e948 = (u64)((u64)t__2e947 + (u64)t__2e948);
+	t__2e951 = (u64)(u32)(*(u8 *)t_param_2e827);
+	*(u8 *)t__2e948 = (u8)t__2e951;
+	goto L__2e945;
+	L__2e945:;
+	L_after_2e941:;
+	t__2e953 = (u64)(*(u64 *)t_binding_2e834);
+	t__2e953 = (u64)((u64)t__2e953 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e834 = (u64)t__2e953;
+	goto L_loop_2e937;
+	L__2e830:;
+	return;
+}
+void F_rt_2ememmove(u64 p_dest, u64 p_src, u64 p_n) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	u64 t__2e1003;
+	u64 t__2e1006;
+	u64 t__2e1007;
+	u64 t__2e1008;
+	u64 t__2e1009;
+	u64 t__2e1010;
+	u64 t__2e1011;
+	u64 t__2e1013;
+	u64 t__2e1015;
+	u64 t__2e1019;
+	u64 t__2e1020;
+	u64 t__2e1021;
+	u64 t__2e1022;
+	u64 t__2e1026;
+	u64 t__2e1027;
+	u64 t__2e1028;
+	u64 t__2e1029;
+	u64 t__2e1035;
+	u64 t__2e1036;
+	u64 t__2e1037;
+	u64 t__2e1038;
+	u64 t__2e1039;
+	u64 t__2e1040;
+	u64 t__2e1043;
+	u64 t__2e1044;
+	u64 t__2e1046;
+	u64 t__2e1047;
+	u64 t__2e1048;
+	u64 t__2e1049;
+	u64 t__2e1051;
+	u64 t__2e1053;
+	u64 t__2e1055;
+	u64 t__2e1057;
+	u64 t__2e1058;
+	u64 t__2e1060;
+	u64 t__2e1062;
+	u64 t__2e1063;
+	u64 t__2e1065;
+	u64 t__2e1071;
+	u64 t__2e1072;
+	u64 t__2e1075;
+	u64 t__2e1076;
+	u64 t__2e1078;
+	u64 t__2e1079;
+	u64 t__2e1080;
+	u64 t__2e1081;
+	u64 t__2e1083;
+	u64 t__2e1085;
+	u64 t__2e1086;
+	u64 t__2e1087;
+	u64 t__2e1089;
+	u64 t__2e1090;
+	u64 t__2e1091;
+	u64 t__2e1092;
+	u64 t__2e1094;
+	u64 t__2e1096;
+	u64 t__2e1097;
+	u64 t__2e1098;
+	u64 t__2e1100;
+	u64 t__2e1101;
+	u64 t__2e1102;
+	u64 t__2e1103;
+	u64 t__2e1105;
+	u64 t__2e1107;
+	u64 t__2e1108;
+	u64 t__2e1109;
+	u64 t__2e1111;
+	u64 t__2e1112;
+	u64 t__2e1113;
+	u64 t__2e1114;
+	u64 t__2e1116;
+	u64 t__2e1118;
+	u64 t__2e1120;
+	u64 t__2e1126;
+	u64 t__2e1127;
+	u64 t__2e1130;
+	u64 t__2e1131;
+	u64 t__2e1133;
+	u64 t__2e1134;
+	u64 t__2e1135;
+	u64 t__2e1136;
+	u64 t__2e1138;
+	u64 t__2e1140;
+	u64 t__2e1142;
+	u64 t__2e1143;
+	u64 t__2e1150;
+	u64 t__2e1151;
+	u64 t__2e1154;
+	u64 t__2e1155;
+	u64 t__2e1157;
+	u64 t__2e1158;
+	u64 t__2e1159;
+	u64 t__2e1160;
+	u64 t__2e1162;
+	u64 t__2e1164;
+	u64 t__2e1166;
+	u64 t__2e963;
+	u64 t__2e965;
+	u64 t__2e970;
+	u64 t__2e971;
+	u64 t__2e973;
+	u64 t__2e975;
+	u64 t__2e984;
+	u64 t__2e985;
+	u64 t__2e987;
+	u64 t__2e989;
+	u64 t__2e992;
+	u64 t__2e993;
+	u64 t__2e994;
+	u64 t__2e998;
+	u64 t_binding_2e1018;
+	u64 t_binding_2e1025;
+	u64 t_binding_2e1056;
+	u64 t_binding_2e1061;
+	u64 t_binding_2e962;
+	u64 t_binding_2e964;
+	u64 t_binding_2e997;
+	u64 t_dest;
+	u64 t_n;
+	u64 t_param_2e956;
+	u64 t_param_2e957;
+	u64 t_param_2e958;
+	u64 t_src;
+	t_dest = (u64)p_dest;
+	t_src = (u64)p_src;
+	t_n = (u64)p_n;
+	L_start_2e955:;
+	t_param_2e956 = (u64)A0;
+	t_param_2e957 = (u64)A1;
+	t_param_2e958 = (u64)A2;
+	t_binding_2e962 = (u64)A3;
+	t_binding_2e964 = (u64)A4;
+	t_binding_2e997 = (u64)A5;
+	t_binding_2e1018 = (u64)A6;
+	t_binding_2e1025 = (u64)A7;
+	t_binding_2e1056 = (u64)A8;
+	t_binding_2e1061 = (u64)A9;
+	*(u64 *)t_param_2e956 = (u64)t_dest;
+	*(u64 *)t_param_2e957 = (u64)t_src;
+	*(u64 *)t_param_2e958 = (u64)t_n;
+	L_body_2e959:;
+	t__2e963 = (u64)(*(u64 *)t_param_2e956);
+	*(u64 *)t_binding_2e962 = (u64)t__2e963;
+	t__2e965 = (u64)(*(u64 *)t_param_2e957);
+	*(u64 *)t_binding_2e964 = (u64)t__2e965;
+	t__2e971 = (u64)(*(u64 *)t_binding_2e962);
+	t__2e973 = (u64)(*(u64 *)t_binding_2e964);
+	t__2e970 = (u64)(u32)(((u64)t__2e971 == (u64)t__2e973));
+	t__2e975 = (u64)(u32)((u8)t__2e970);
+	if ((u32)t__2e975) goto L_true_2e967; else goto L_false_2e968;
+	L_true_2e967:;
+	return;
+	L_false_2e968:;
+	L__2e969:;
+	t__2e985 = (u64)(*(u64 *)t_binding_2e962);
+	t__2e987 = (u64)(*(u64 *)t_binding_2e964);
+	t__2e984 = (u64)(u32)(((u64)t__2e985 < (u64)t__2e987));
+	t__2e989 = (u64)(u32)((u8)t__2e984);
+	if ((u32)t__2e989) goto L_true_2e981; else goto L_false_2e982;
+	L_true_2e981:;
+	t__2e992 = (u64)(*(u64 *)t_param_2e956);
+	t__2e993 = (u64)(*(u64 *)t_param_2e957);
+	t__2e994 = (u64)(*(u64 *)t_param_2e958);
+	((void (*)(u64, u64, u64))((u64)((char *)&F_rt_2ememcpy)))((u64)t__2e992, (u64)t__2e993, (u64)t__2e994);
+	return;
+	L_false_2e982:;
+	L__2e983:;
+	t__2e998 = (u64)(*(u64 *)t_param_2e958);
+	*(u64 *)t_binding_2e997 = (u64)t__2e998;
+	t__2e1007 = (u64)(*(u64 *)t_param_2e958);
+	t__2e1006 = (u64)(u32)(((u64)t__2e1007 >= (u64)((u64)16UL)));
+	t__2e1003 = (u64)(u32)t__2e1006;
+	if ((u32)t__2e1003) goto L__2e1004; else goto L__2e1005;
+	L__2e1004:;
+	t__2e1011 = (u64)(*(u64 *)t_binding_2e962);
+	t__2e1013 = (u64)(*(u64 *)t_binding_2e964);
+	t__2e1010 = (u64)((u64)t__2e1011 ^ (u64)t__2e1013);
+	t__2e1009 = (u64)((u64)t__2e1010 & (u64)((u64)7UL));
+	t__2e1008 = (u64)(u32)(((u64)t__2e1009 == (u64)((u64)0UL)));
+	t__2e1003 = (u64)(u32)t__2e1008;
+	goto L__2e1005;
+	L__2e1005:;
+	t__2e1015 = (u64)(u32)((u8)t__2e1003);
+	if ((u32)t__2e1015) goto L_true_2e1000; else goto L_false_2e1001;
+	L_true_2e1000:;
+	t__2e1022 = (u64)(*(u64 *)t_binding_2e962);
+	t__2e1021 = (u64)((u64)t__2e1022 & (u64)((u64)7UL));
+	t__2e1020 = (u64)((u64)((u64)8UL) - (u64)t__2e1021);
+	t__2e1019 = (u64)((u64)t__2e1020 & (u64)((u64)7UL));
+	*(u64 *)t_binding_2e1018 = (u64)t__2e1019;
+	t__2e1028 = (u64)(*(u64 *)t_param_2e958);
+	t__2e1029 = (u64)(*(u64 *)t_binding_2e1018);
+	t__2e1027 = (u64)((u64)t__2e1028 - (u64)t__2e1029);
+	t__2e1026 = (u64)((u64)t__2e1027 >> (((u64)3UL) & 63));
+	*(u64 *)t_binding_2e1025 = (u64)t__2e1026;
+	L_loop_2e1030:;
+	t__2e1036 = (u64)(*(u64 *)t_binding_2e997);
+	t__2e1038 = (u64)(*(u64 *)t_binding_2e1018);
+	t__2e1040 = (u64)(*(u64 *)t_binding_2e1025);
+	t__2e1039 = (u64)((u64)t__2e1040 << (((u64)3UL) & 63));
+	t__2e1037 = (u64)((u64)t__2e1038 + (u64)t__2e1039);
+	t__2e1035 = (u64)(u32)(((u64)t__2e1036 > (u64)t__2e1037));
+	if ((u32)t__2e1035) goto L_body_2e1031; else goto L__2e1033;
+	L_body_2e1031:;
+	t__2e1043 = (u64)(*(u64 *)t_binding_2e962);
+	t__2e1047 = (u64)(*(u64 *)t_binding_2e997);
+	t__2e1046 = (u64)((u64)t__2e1047 - (u64)((u64)1UL));
+	t__2e1044 = t__2e1046;
+	t__2e1044 = (u64)((u64)t__2e1043 + (u64)t__2e1044);
+	t__2e1048 = (u64)(*(u64 *)t_binding_2e964);
+	t__2e1051 = (u64)((u64)t__2e1047 - (u64)((u64)1UL));
+	t__2e1049 = t__2e1051;
+	t__2e1049 = (u64)((u64)t__2e1048 + (u64)t__2e1049);
+	t__2e1053 = (u64)(u32)(*(u8 *)t__2e1049);
+	*(u8 *)t__2e1044 = (u8)t__2e1053;
+	goto L__2e1041;
+	L__2e1041:;
+	L_after_2e1034:;
+	t__2e1055 = (u64)(*(u64 *)t_binding_2e997);
+	t__2e1055 = (u64)((u64)t__2e1055 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e997 = (u64)t__2e1055;
+	goto L_loop_2e1030;
+	L__2e1033:;
+	t__2e1057 = (u64)(*(u64 *)t_binding_2e962);
+	t__2e1060 = (u64)(*(u64 *)t_binding_2e1018);
+	t__2e1058 = t__2e1060;
+	t__2e1058 = (u64)((u64)t__2e1057 + (u64)t__2e1058);
+	*(u64 *)t_binding_2e1056 = (u64)t__2e1058;
+	t__2e1062 = (u64)(*(u64 *)t_binding_2e964);
+	t__2e1065 = (u64)(*(u64 *)t_binding_2e1018);
+	t__2e1063 = t__2e1065;
+	t__2e1063 = (u64)((u64)t__2e1062 + (u64)t__2e1063);
+	*(u64 *)t_binding_2e1061 = (u64)t__2e1063;
+	L_loop_2e1066:;
+	t__2e1072 = (u64)(*(u64 *)t_binding_2e1025);
+	t__2e1071 = (u64)(u32)(((u64)t__2e1072 >= (u64)((u64)4UL)));
+	if ((u32)t__2e1071) goto L_body_2e1067; else goto L__2e1069;
+	L_body_2e1067:;
+	t__2e1075 = (u64)(*(u64 *)t_binding_2e1056);
+	t__2e1079 = (u64)(*(u64 *)t_binding_2e1025);
+	t__2e1078 = (u64)((u64)t__2e1079 - (u64)((u64)1UL));
+	t__2e1076 = (u64)((u64)t__2e1078 * (u64)((u64)8UL));
+	t__2e1076 = (u64)((u64)t__2e1075 + (u64)t__2e1076);
+	t__2e1080 = (u64)(*(u64 *)t_binding_2e1061);
+	t__2e1083 = (u64)((u64)t__2e1079 - (u64)((u64)1UL));
+	t__2e1081 = (u64)((u64)t__2e1083 * (u64)((u64)8UL));
+	t__2e1081 = (u64)((u64)t__2e1080 + (u64)t__2e1081);
+	t__2e1085 = (u64)(*(u64 *)t__2e1081);
+	*(u64 *)t__2e1076 = (u64)t__2e1085;
+	t__2e1086 = (u64)(*(u64 *)t_binding_2e1056);
+	t__2e1090 = (u64)(*(u64 *)t_binding_2e1025);
+	t__2e1089 = (u64)((u64)t__2e1090 - (u64)((u64)2UL));
+	t__2e1087 = (u64)((u64)t__2e1089 * (u64)((u64)8UL));
+	t__2e1087 = (u64)((u64)t__2e1086 + (u64)t__2e1087);
+	t__2e1091 = (u64)(*(u64 *)t_binding_2e1061);
+	t__2e1094 = (u64)((u64)t__2e1090 - (u64)((u64)2UL));
+	t__2e1092 = (u64)((u64)t__2e1094 * (u64)((u64)8UL));
+	t__2e1092 = (u64)((u64)t__2e1091 + (u64)t__2e1092);
+	t__2e1096 = (u64)(*(u64 *)t__2e1092);
+	*(u64 *)t__2e1087 = (u64)t__2e1096;
+	t__2e1097 = (u64)(*(u64 *)t_binding_2e1056);
+	t__2e1101 = (u64)(*(u64 *)t_binding_2e1025);
+	t__2e1100 = (u64)((u64)t__2e1101 - (u64)((u64)3UL));
+	t__2e1098 = (u64)((u64)t__2e1100 * (u64)((u64)8UL));
+	t__2e1098 = (u64)((u64)t__2e1097 + (u64)t__2e1098);
+	t__2e1102 = (u64)(*(u64 *)t_binding_2e1061);
+	t__2e1105 = (u64)((u64)t__2e1101 - (u64)((u64)3UL));
+	t__2e1103 = (u64)((u64)t__2e1105 * (u64)((u64)8UL));
+	t__2e1103 = (u64)((u64)t__2e1102 + (u64)t__2e1103);
+	t__2e1107 = (u64)(*(u64 *)t__2e1103);
+	*(u64 *)t__2e1098 = (u64)t__2e1107;
+	t__2e1108 = (u64)(*(u64 *)t_binding_2e1056);
+	t__2e1112 = (u64)(*(u64 *)t_binding_2e1025);
+	t__2e1111 = (u64)((u64)t__2e1112 - (u64)((u64)4UL));
+	t__2e1109 = (u64)((u64)t__2e1111 * (u64)((u64)8UL));
+	t__2e1109 = (u64)((u64)t__2e1108 + (u64)t__2e1109);
+	t__2e1113 = (u64)(*(u64 *)t_binding_2e1061);
+	t__2e1116 = (u64)((u64)t__2e1112 - (u64)((u64)4UL));
+	t__2e1114 = (u64)((u64)t__2e1116 * (u64)((u64)8UL));
+	t__2e1114 = (u64)((u64)t__2e1113 + (u64)t__2e1114);
+	t__2e1118 = (u64)(*(u64 *)t__2e1114);
+	*(u64 *)t__2e1109 = (u64)t__2e1118;
+	goto L__2e1073;
+	L__2e1073:;
+	L_after_2e1070:;
+	t__2e1120 = (u64)(*(u64 *)t_binding_2e1025);
+	t__2e1120 = (u64)((u64)t__2e1120 - (u64)((u64)4UL));
+	*(u64 *)t_binding_2e1025 = (u64)t__2e1120;
+	goto L_loop_2e1066;
+	L__2e1069:;
+	L_loop_2e1121:;
+	t__2e1127 = (u64)(*(u64 *)t_binding_2e1025);
+	t__2e1126 = (u64)(u32)(((u64)t__2e1127 > (u64)((u64)0UL)));
+	if ((u32)t__2e1126) goto L_body_2e1122; else goto L__2e1124;
+	L_body_2e1122:;
+	t__2e1130 = (u64)(*(u64 *)t_binding_2e1056);
+	t__2e1134 = (u64)(*(u64 *)t_binding_2e1025);
+	t__2e1133 = (u64)((u64)t__2e1134 - (u64)((u64)1UL));
+	t__2e1131 = (u64)((u64)t__2e1133 * (u64)((u64)8UL));
+	t__2e1131 = (u64)((u64)t__2e1130 + (u64)t__2e1131);
+	t__2e1135 = (u64)(*(u64 *)t_binding_2e1061);
+	t__2e1138 = (u64)((u64)t__2e1134 - (u64)((u64)1UL));
+	t__2e1136 = (u64)((u64)t__2e1138 * (u64)((u64)8UL));
+	t__2e1136 = (u64)((u64)t__2e1135 + (u64)t__2e1136);
+	t__2e1140 = (u64)(*(u64 *)t__2e1136);
+	*(u64 *)t__2e1131 = (u64)t__2e1140;
+	goto L__2e1128;
+	L__2e1128:;
+	L_after_2e1125:;
+	t__2e1142 = (u64)(*(u64 *)t_binding_2e1025);
+	t__2e1142 = (u64)((u64)t__2e1142 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1025 = (u64)t__2e1142;
+	goto L_loop_2e1121;
+	L__2e1124:;
+	t__2e1143 = (u64)(*(u64 *)t_binding_2e1018);
+	*(u64 *)t_binding_2e997 = (u64)t__2e1143;
+	goto L__2e1002;
+	L_false_2e1001:;
+	L__2e1002:;
+	L_loop_2e1145:;
+	t__2e1151 = (u64)(*(u64 *)t_binding_2e997);
+	t__2e1150 = (u64)(u32)(((u64)t__2e1151 > (u64)((u64)0UL)));
+	if ((u32)t__2e1150) goto L_body_2e1146; else goto L__2e960;
+	L_body_2e1146:;
+	t__2e1154 = (u64)(*(u64 *)t_binding_2e962);
+	t__2e1158 = (u64)(*(u64 *)t_binding_2e997);
+	t__2e1157 = (u64)((u64)t__2e1158 - (u64)((u64)1UL));
+	t__2e1155 = t__2e1157;
+	t__2e1155 = (u64)((u64)t__2e1154 + (u64)t__2e1155);
+	t__2e1159 = (u64)(*(u64 *)t_binding_2e964);
+	t__2e1162 = (u64)((u64)t__2e1158 - (u64)((u64)1UL));
+	t__2e1160 = t__2e1162;
+	t__2e1160 = (u64)((u64)t__2e1159 + (u64)t__2e1160);
+	t__2e1164 = (u64)(u32)(*(u8 *)t__2e1160);
+	*(u8 *)t__2e1155 = (u8)t__2e1164;
+	goto L__2e1152;
+	L__2e1152:;
+	L_after_2e1149:;
+	t__2e1166 = (u64)(*(u64 *)t_binding_2e997);
+	t__2e1166 = (u64)((u64)t__2e1166 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e997 = (u64)t__2e1166;
+	goto L_loop_2e1145;
+	L__2e960:;
+	return;
+}
+void F_rt_2ememcpy(u64 p_dest, u64 p_src, u64 p_amt) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	u64 t__2e1176;
+	u64 t__2e1178;
+	u64 t__2e1184;
+	u64 t__2e1187;
+	u64 t__2e1188;
+	u64 t__2e1189;
+	u64 t__2e1190;
+	u64 t__2e1191;
+	u64 t__2e1192;
+	u64 t__2e1194;
+	u64 t__2e1196;
+	u64 t__2e1204;
+	u64 t__2e1205;
+	u64 t__2e1206;
+	u64 t__2e1207;
+	u64 t__2e1209;
+	u64 t__2e1210;
+	u64 t__2e1213;
+	u64 t__2e1214;
+	u64 t__2e1216;
+	u64 t__2e1217;
+	u64 t__2e1218;
+	u64 t__2e1221;
+	u64 t__2e1223;
+	u64 t__2e1225;
+	u64 t__2e1226;
+	u64 t__2e1228;
+	u64 t__2e1230;
+	u64 t__2e1231;
+	u64 t__2e1233;
+	u64 t__2e1235;
+	u64 t__2e1236;
+	u64 t__2e1237;
+	u64 t__2e1238;
+	u64 t__2e1245;
+	u64 t__2e1246;
+	u64 t__2e1247;
+	u64 t__2e1248;
+	u64 t__2e1251;
+	u64 t__2e1252;
+	u64 t__2e1254;
+	u64 t__2e1255;
+	u64 t__2e1256;
+	u64 t__2e1259;
+	u64 t__2e1260;
+	u64 t__2e1261;
+	u64 t__2e1263;
+	u64 t__2e1264;
+	u64 t__2e1265;
+	u64 t__2e1266;
+	u64 t__2e1268;
+	u64 t__2e1270;
+	u64 t__2e1271;
+	u64 t__2e1272;
+	u64 t__2e1274;
+	u64 t__2e1275;
+	u64 t__2e1276;
+	u64 t__2e1277;
+	u64 t__2e1279;
+	u64 t__2e1281;
+	u64 t__2e1282;
+	u64 t__2e1283;
+	u64 t__2e1285;
+	u64 t__2e1286;
+	u64 t__2e1287;
+	u64 t__2e1288;
+	u64 t__2e1290;
+	u64 t__2e1292;
+	u64 t__2e1294;
+	u64 t__2e1300;
+	u64 t__2e1301;
+	u64 t__2e1302;
+	u64 t__2e1305;
+	u64 t__2e1306;
+	u64 t__2e1308;
+	u64 t__2e1309;
+	u64 t__2e1310;
+	u64 t__2e1313;
+	u64 t__2e1315;
+	u64 t__2e1316;
+	u64 t__2e1317;
+	u64 t__2e1318;
+	u64 t__2e1325;
+	u64 t__2e1326;
+	u64 t__2e1327;
+	u64 t__2e1330;
+	u64 t__2e1331;
+	u64 t__2e1333;
+	u64 t__2e1334;
+	u64 t__2e1335;
+	u64 t__2e1338;
+	u64 t__2e1340;
+	u64 t_amt;
+	u64 t_binding_2e1175;
+	u64 t_binding_2e1177;
+	u64 t_binding_2e1179;
+	u64 t_binding_2e1224;
+	u64 t_binding_2e1229;
+	u64 t_binding_2e1234;
+	u64 t_binding_2e1239;
+	u64 t_dest;
+	u64 t_param_2e1169;
+	u64 t_param_2e1170;
+	u64 t_param_2e1171;
+	u64 t_src;
+	t_dest = (u64)p_dest;
+	t_src = (u64)p_src;
+	t_amt = (u64)p_amt;
+	L_start_2e1168:;
+	t_param_2e1169 = (u64)A0;
+	t_param_2e1170 = (u64)A1;
+	t_param_2e1171 = (u64)A2;
+	t_binding_2e1175 = (u64)A3;
+	t_binding_2e1177 = (u64)A4;
+	t_binding_2e1179 = (u64)A5;
+	t_binding_2e1224 = (u64)A6;
+	t_binding_2e1229 = (u64)A7;
+	t_binding_2e1234 = (u64)A8;
+	t_binding_2e1239 = (u64)A9;
+	*(u64 *)t_param_2e1169 = (u64)t_dest;
+	*(u64 *)t_param_2e1170 = (u64)t_src;
+	*(u64 *)t_param_2e1171 = (u64)t_amt;
+	L_body_2e1172:;
+	t__2e1176 = (u64)(*(u64 *)t_param_2e1169);
+	*(u64 *)t_binding_2e1175 = (u64)t__2e1176;
+	t__2e1178 = (u64)(*(u64 *)t_param_2e1170);
+	*(u64 *)t_binding_2e1177 = (u64)t__2e1178;
+	*(u64 *)t_binding_2e1179 = (u64)((u64)0UL);
+	t__2e1188 = (u64)(*(u64 *)t_param_2e1171);
+	t__2e1187 = (u64)(u32)(((u64)t__2e1188 >= (u64)((u64)16UL)));
+	t__2e1184 = (u64)(u32)t__2e1187;
+	if ((u32)t__2e1184) goto L__2e1185; else goto L__2e1186;
+	L__2e1185:;
+	t__2e1192 = (u64)(*(u64 *)t_binding_2e1175);
+	t__2e1194 = (u64)(*(u64 *)t_binding_2e1177);
+	t__2e1191 = (u64)((u64)t__2e1192 ^ (u64)t__2e1194);
+	t__2e1190 = (u64)((u64)t__2e1191 & (u64)((u64)7UL));
+	t__2e1189 = (u64)(u32)(((u64)t__2e1190 == (u64)((u64)0UL)));
+	t__2e1184 = (u64)(u32)t__2e1189;
+	goto L__2e1186;
+	L__2e1186:;
+	t__2e1196 = (u64)(u32)((u8)t__2e1184);
+	if ((u32)t__2e1196) goto L_true_2e1181; else goto L_false_2e1182;
+	L_true_2e1181:;
+	L_loop_2e1199:;
+	t__2e1206 = (u64)(*(u64 *)t_binding_2e1175);
+	t__2e1209 = (u64)(*(u64 *)t_binding_2e1179);
+	t__2e1207 = t__2e1209;
+	t__2e1207 = (u64)((u64)t__2e1206 + (u64)t__2e1207);
+	t__2e1210 = t__2e1207;
+	t__2e1205 = (u64)((u64)t__2e1210 & (u64)((u64)7UL));
+	t__2e1204 = (u64)(u32)(((u64)t__2e1205 != (u64)((u64)0UL)));
+	if ((u32)t__2e1204) goto L_body_2e1200; else goto L__2e1202;
+	L_body_2e1200:;
+	t__2e1213 = (u64)(*(u64 *)t_binding_2e1175);
+	t__2e1216 = (u64)(*(u64 *)t_binding_2e1179);
+	t__2e1214 = t__2e1216;
+	t__2e1214 = (u64)((u64)t__2e1213 + (u64)t__2e1214);
+	t__2e1217 = (u64)(*(u64 *)t_binding_2e1177);
+	t__2e1218 = t__2e1216;
+	t__2e1218 = (u64)((u64)t__2e1217 + (u64)t__2e1218);
+	t__2e1221 = (u64)(u32)(*(u8 *)t__2e1218);
+	*(u8 *)t__2e1214 = (u8)t__2e1221;
+	goto L__2e1211;
+	L__2e1211:;
+	L_after_2e1203:;
+	t__2e1223 = (u64)(*(u64 *)t_binding_2e1179);
+	t__2e1223 = (u64)((u64)t__2e1223 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1179 = (u64)t__2e1223;
+	goto L_loop_2e1199;
+	L__2e1202:;
+	t__2e1225 = (u64)(*(u64 *)t_binding_2e1175);
+	t__2e1228 = (u64)(*(u64 *)t_binding_2e1179);
+	t__2e1226 = t__2e1228;
+	t__2e1226 = (u64)((u64)t__2e1225 + (u64)t__2e1226);
+	*(u64 *)t_binding_2e1224 = (u64)t__2e1226;
+	t__2e1230 = (u64)(*(u64 *)t_binding_2e1177);
+	t__2e1233 = (u64)(*(u64 *)t_binding_2e1179);
+	t__2e1231 = t__2e1233;
+	t__2e1231 = (u64)((u64)t__2e1230 + (u64)t__2e1231);
+	*(u64 *)t_binding_2e1229 = (u64)t__2e1231;
+	t__2e1237 = (u64)(*(u64 *)t_param_2e1171);
+	t__2e1238 = (u64)(*(u64 *)t_binding_2e1179);
+	t__2e1236 = (u64)((u64)t__2e1237 - (u64)t__2e1238);
+	t__2e1235 = (u64)((u64)t__2e1236 >> (((u64)3UL) & 63));
+	*(u64 *)t_binding_2e1234 = (u64)t__2e1235;
+	*(u64 *)t_binding_2e1239 = (u64)((u64)0UL);
+	L_loop_2e1240:;
+	t__2e1247 = (u64)(*(u64 *)t_binding_2e1239);
+	t__2e1246 = (u64)((u64)t__2e1247 + (u64)((u64)4UL));
+	t__2e1248 = (u64)(*(u64 *)t_binding_2e1234);
+	t__2e1245 = (u64)(u32)(((u64)t__2e1246 <= (u64)t__2e1248));
+	if ((u32)t__2e1245) goto L_body_2e1241; else goto L__2e1243;
+	L_body_2e1241:;
+	t__2e1251 = (u64)(*(u64 *)t_binding_2e1224);
+	t__2e1254 = (u64)(*(u64 *)t_binding_2e1239);
+	t__2e1252 = (u64)((u64)t__2e1254 * (u64)((u64)8UL));
+	t__2e1252 = (u64)((u64)t__2e1251 + (u64)t__2e1252);
+	t__2e1255 = (u64)(*(u64 *)t_binding_2e1229);
+	t__2e1256 = (u64)((u64)t__2e1254 * (u64)((u64)8UL));
+	t__2e1256 = (u64)((u64)t__2e1255 + (u64)t__2e1256);
+	t__2e1259 = (u64)(*(u64 *)t__2e1256);
+	*(u64 *)t__2e1252 = (u64)t__2e1259;
+	t__2e1260 = (u64)(*(u64 *)t_binding_2e1224);
+	t__2e1264 = (u64)(*(u64 *)t_binding_2e1239);
+	t__2e1263 = (u64)((u64)t__2e1264 + (u64)((u64)1UL));
+	t__2e1261 = (u64)((u64)t__2e1263 * (u64)((u64)8UL));
+	t__2e1261 = (u64)((u64)t__2e1260 + (u64)t__2e1261);
+	t__2e1265 = (u64)(*(u64 *)t_binding_2e1229);
+	t__2e1268 = (u64)((u64)t__2e1264 + (u64)((u64)1UL));
+	t__2e1266 = (u64)((u64)t__2e1268 * (u64)((u64)8UL));
+	t__2e1266 = (u64)((u64)t__2e1265 + (u64)t__2e1266);
+	t__2e1270 = (u64)(*(u64 *)t__2e1266);
+	*(u64 *)t__2e1261 = (u64)t__2e1270;
+	t__2e1271 = (u64)(*(u64 *)t_binding_2e1224);
+	t__2e1275 = (u64)(*(u64 *)t_binding_2e1239);
+	t__2e1274 = (u64)((u64)t__2e1275 + (u64)((u64)2UL));
+	t__2e1272 = (u64)((u64)t__2e1274 * (u64)((u64)8UL));
+	t__2e1272 = (u64)((u64)t__2e1271 + (u64)t__2e1272);
+	t__2e1276 = (u64)(*(u64 *)t_binding_2e1229);
+	t__2e1279 = (u64)((u64)t__2e1275 + (u64)((u64)2UL));
+	t__2e1277 = (u64)((u64)t__2e1279 * (u64)((u64)8UL));
+	t__2e1277 = (u64)((u64)t__2e1276 + (u64)t__2e1277);
+	t__2e1281 = (u64)(*(u64 *)t__2e1277);
+	*(u64 *)t__2e1272 = (u64)t__2e1281;
+	t__2e1282 = (u64)(*(u64 *)t_binding_2e1224);
+	t__2e1286 = (u64)(*(u64 *)t_binding_2e1239);
+	t__2e1285 = (u64)((u64)t__2e1286 + (u64)((u64)3UL));
+	t__2e1283 = (u64)((u64)t__2e1285 * (u64)((u64)8UL));
+	t__2e1283 = (u64)((u64)t__2e1282 + (u64)t__2e1283);
+	t__2e1287 = (u64)(*(u64 *)t_binding_2e1229);
+	t__2e1290 = (u64)((u64)t__2e1286 + (u64)((u64)3UL));
+	t__2e1288 = (u64)((u64)t__2e1290 * (u64)((u64)8UL));
+	t__2e1288 = (u64)((u64)t__2e1287 + (u64)t__2e1288);
+	t__2e1292 = (u64)(*(u64 *)t__2e1288);
+	*(u64 *)t__2e1283 = (u64)t__2e1292;
+	goto L__2e1249;
+	L__2e1249:;
+	L_after_2e1244:;
+	t__2e1294 = (u64)(*(u64 *)t_binding_2e1239);
+	t__2e1294 = (u64)((u64)t__2e1294 + (u64)((u64)4UL));
+	*(u64 *)t_binding_2e1239 = (u64)t__2e1294;
+	goto L_loop_2e1240;
+	L__2e1243:;
+	L_loop_2e1295:;
+	t__2e1301 = (u64)(*(u64 *)t_binding_2e1239);
+	t__2e1302 = (u64)(*(u64 *)t_binding_2e1234);
+	t__2e1300 = (u64)(u32)(((u64)t__2e1301 < (u64)t__2e1302));
+	if ((u32)t__2e1300) goto L_body_2e1296; else goto L__2e1298;
+	L_body_2e1296:;
+	t__2e1305 = (u64)(*(u64 *)t_binding_2e1224);
+	t__2e1308 = (u64)(*(u64 *)t_binding_2e1239);
+	t__2e1306 = (u64)((u64)t__2e1308 * (u64)((u64)8UL));
+	t__2e1306 = (u64)((u64)t__2e1305 + (u64)t__2e1306);
+	t__2e1309 = (u64)(*(u64 *)t_binding_2e1229);
+	t__2e1310 = (u64)((u64)t__2e1308 * (u64)((u64)8UL));
+	t__2e1310 = (u64)((u64)t__2e1309 + (u64)t__2e1310);
+	t__2e1313 = (u64)(*(u64 *)t__2e1310);
+	*(u64 *)t__2e1306 = (u64)t__2e1313;
+	goto L__2e1303;
+	L__2e1303:;
+	L_after_2e1299:;
+	t__2e1315 = (u64)(*(u64 *)t_binding_2e1239);
+	t__2e1315 = (u64)((u64)t__2e1315 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1239 = (u64)t__2e1315;
+	goto L_loop_2e1295;
+	L__2e1298:;
+	t__2e1316 = (u64)(*(u64 *)t_binding_2e1179);
+	t__2e1318 = (u64)(*(u64 *)t_binding_2e1234);
+	t__2e1317 = (u64)((u64)t__2e1318 << (((u64)3UL) & 63));
+	t__2e1316 = (u64)((u64)t__2e1316 + (u64)t__2e1317);
+	*(u64 *)t_binding_2e1179 = (u64)t__2e1316;
+	goto L__2e1183;
+	L_false_2e1182:;
+	L__2e1183:;
+	L_loop_2e1320:;
+	t__2e1326 = (u64)(*(u64 *)t_binding_2e1179);
+	t__2e1327 = (u64)(*(u64 *)t_param_2e1171);
+	t__2e1325 = (u64)(u32)(((u64)t__2e1326 < (u64)t__2e1327));
+	if ((u32)t__2e1325) goto L_body_2e1321; else goto L__2e1173;
+	L_body_2e1321:;
+	t__2e1330 = (u64)(*(u64 *)t_binding_2e1175);
+	t__2e1333 = (u64)(*(u64 *)t_binding_2e1179);
+	t__2e1331 = t__2e1333;
+	t__2e1331 = (u64)((u64)t__2e1330 + (u64)t__2e1331);
+	t__2e1334 = (u64)(*(u64 *)t_binding_2e1177);
+	t__2e1335 = t__2e1333;
+	t__2e1335 = (u64)((u64)t__2e1334 + (u64)t__2e1335);
+	t__2e1338 = (u64)(u32)(*(u8 *)t__2e1335);
+	*(u8 *)t__2e1331 = (u8)t__2e1338;
+	goto L__2e1328;
+	L__2e1328:;
+	L_after_2e1324:;
+	t__2e1340 = (u64)(*(u64 *)t_binding_2e1179);
+	t__2e1340 = (u64)((u64)t__2e1340 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1179 = (u64)t__2e1340;
+	goto L_loop_2e1320;
+	L__2e1173:;
+	return;
+}
+u64 F_rt_2etoutf8(u64 __rp, u64 p_s) {
+	u64 t_s;
+	t_s = p_s;
+	L_start_2e1342:;
+	L_body_2e1344:;
+	BLIT(__rp, t_s, 24); return __rp;
+}
+void F_rt_2eabort__fixed(u64 p_path, u64 p_line, u64 p_col, u64 p_i) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	u64 t__2e1353;
+	u64 t__2e1354;
+	u64 t__2e1355;
+	u64 t__2e1356;
+	u64 t__2e1358;
+	u64 t__2e1360;
+	u64 t__2e1366;
+	u64 t__2e1367;
+	u64 t__2e1368;
+	u64 t__2e1369;
+	u64 t__2e1370;
+	u64 t_col;
+	u64 t_i;
+	u64 t_line;
+	u64 t_param_2e1346;
+	u64 t_param_2e1347;
+	u64 t_param_2e1348;
+	u64 t_param_2e1349;
+	u64 t_path;
+	t_path = (u64)p_path;
+	t_line = (u64)p_line;
+	t_col = (u64)p_col;
+	t_i = (u64)p_i;
+	L_start_2e1345:;
+	t_param_2e1346 = (u64)A0;
+	t_param_2e1347 = (u64)A1;
+	t_param_2e1348 = (u64)A2;
+	t_param_2e1349 = (u64)A3;
+	*(u64 *)t_param_2e1346 = (u64)t_path;
+	*(u64 *)t_param_2e1347 = (u64)t_line;
+	*(u64 *)t_param_2e1348 = (u64)t_col;
+	*(u64 *)t_param_2e1349 = (u64)t_i;
+	L_body_2e1350:;
+	t__2e1353 = (u64)(*(u64 *)t_param_2e1346);
+	t__2e1354 = (u64)(*(u64 *)t_param_2e1347);
+	t__2e1355 = (u64)(*(u64 *)t_param_2e1348);
+	t__2e1358 = (u64)(*(u64 *)t_param_2e1349);
+	t__2e1356 = (u64)((u64)t__2e1358 * (u64)((u64)24UL));
+	t__2e1356 = (u64)((u64)((u64)((char *)&D_rt_2ereasons)) + (u64)t__2e1356);
+	t__2e1360 = (u64)(u32)(((u64)t__2e1358 < (u64)((u64)8UL)));
+	if ((u32)t__2e1360) goto L__2e1362; else goto L__2e1361;
+	L__2e1361:;
+	goto L_abort_2e1365;
+	L__2e1362:;
+	BLIT((u64)B4, t__2e1356, 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)t__2e1353, (u64)t__2e1354, (u64)t__2e1355, (u64)B4);
+	goto L__2e1351;
+	L__2e1351:;
+	return;
+	L_abort_2e1365:;
+	t__2e1366 = ((u64)0UL);
+	t__2e1366 = (u64)((u64)((u64)((char *)&D_abortsites_2e1363)) + (u64)t__2e1366);
+	t__2e1367 = (u64)(*(u64 *)t__2e1366);
+	t__2e1368 = (u64)((u64)t__2e1366 + (u64)((u64)8UL));
+	t__2e1369 = (u64)(*(u32 *)t__2e1368);
+	t__2e1368 = (u64)((u64)t__2e1366 + (u64)((u64)12UL));
+	t__2e1370 = (u64)(*(u32 *)t__2e1368);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e1367, (u64)t__2e1369, (u64)t__2e1370, (u64)((u64)0UL));
+	__builtin_trap();
+}
+void F_rt_2eabort(u64 p_path, u64 p_line, u64 p_col, u64 p_msg) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	char A12[24] __attribute__((aligned(16)));
+	char A13[8] __attribute__((aligned(16)));
+	char A14[24] __attribute__((aligned(16)));
+	char A15[8] __attribute__((aligned(16)));
+	char A16[24] __attribute__((aligned(16)));
+	char A17[8] __attribute__((aligned(16)));
+	char A18[24] __attribute__((aligned(16)));
+	char A19[8] __attribute__((aligned(16)));
+	char R20[16] __attribute__((aligned(16)));
+	char R21[16] __attribute__((aligned(16)));
+	u64 t__2e1389;
+	u64 t__2e1396;
+	u64 t__2e1399;
+	u64 t__2e1402;
+	u64 t__2e1404;
+	u64 t__2e1405;
+	u64 t__2e1406;
+	u64 t__2e1413;
+	u64 t__2e1415;
+	u64 t__2e1418;
+	u64 t__2e1419;
+	u64 t__2e1421;
+	u64 t__2e1422;
+	u64 t__2e1429;
+	u64 t__2e1431;
+	u64 t__2e1434;
+	u64 t__2e1436;
+	u64 t__2e1437;
+	u64 t__2e1439;
+	u64 t__2e1442;
+	u64 t__2e1443;
+	u64 t__2e1444;
+	u64 t__2e1445;
+	u64 t__2e1452;
+	u64 t__2e1454;
+	u64 t__2e1457;
+	u64 t__2e1459;
+	u64 t__2e1460;
+	u64 t__2e1461;
+	u64 t__2e1464;
+	u64 t__2e1465;
+	u64 t__2e1466;
+	u64 t__2e1467;
+	u64 t__2e1474;
+	u64 t__2e1476;
+	u64 t__2e1479;
+	u64 t__2e1481;
+	u64 t__2e1482;
+	u64 t__2e1489;
+	u64 t__2e1491;
+	u64 t__2e1494;
+	u64 t__2e1496;
+	u64 t__2e1497;
+	u64 t__2e1506;
+	u64 t__2e1508;
+	u64 t__2e1511;
+	u64 t__2e1512;
+	u64 t_binding_2e1379;
+	u64 t_binding_2e1383;
+	u64 t_binding_2e1386;
+	u64 t_binding_2e1395;
+	u64 t_binding_2e1412;
+	u64 t_binding_2e1428;
+	u64 t_binding_2e1440;
+	u64 t_binding_2e1441;
+	u64 t_binding_2e1451;
+	u64 t_binding_2e1462;
+	u64 t_binding_2e1463;
+	u64 t_binding_2e1473;
+	u64 t_binding_2e1488;
+	u64 t_binding_2e1505;
+	u64 t_col;
+	u64 t_line;
+	u64 t_msg;
+	u64 t_param_2e1373;
+	u64 t_param_2e1374;
+	u64 t_param_2e1375;
+	u64 t_param_2e1390;
+	u64 t_param_2e1407;
+	u64 t_param_2e1423;
+	u64 t_param_2e1446;
+	u64 t_param_2e1468;
+	u64 t_param_2e1483;
+	u64 t_param_2e1500;
+	u64 t_path;
+	t_path = (u64)p_path;
+	t_line = (u64)p_line;
+	t_col = (u64)p_col;
+	t_msg = p_msg;
+	L_start_2e1372:;
+	t_param_2e1373 = (u64)A0;
+	t_param_2e1374 = (u64)A1;
+	t_param_2e1375 = (u64)A2;
+	t_binding_2e1379 = (u64)A3;
+	t_binding_2e1383 = (u64)A4;
+	t_binding_2e1386 = (u64)A5;
+	t_param_2e1390 = (u64)A6;
+	t_binding_2e1395 = (u64)A7;
+	t_param_2e1407 = (u64)A8;
+	t_binding_2e1412 = (u64)A9;
+	t_param_2e1423 = (u64)A10;
+	t_binding_2e1428 = (u64)A11;
+	t_param_2e1446 = (u64)A12;
+	t_binding_2e1451 = (u64)A13;
+	t_param_2e1468 = (u64)A14;
+	t_binding_2e1473 = (u64)A15;
+	t_param_2e1483 = (u64)A16;
+	t_binding_2e1488 = (u64)A17;
+	t_param_2e1500 = (u64)A18;
+	t_binding_2e1505 = (u64)A19;
+	*(u64 *)t_param_2e1373 = (u64)t_path;
+	*(u64 *)t_param_2e1374 = (u64)t_line;
+	*(u64 *)t_param_2e1375 = (u64)t_col;
+	L_body_2e1376:;
+	BLIT(t_binding_2e1379, ((u64)((char *)&D_strliteral_2e1381)), ((u64)24UL));
+	BLIT(t_binding_2e1383, ((u64)((char *)&D_strliteral_2e1385)), ((u64)24UL));
+	BLIT(t_binding_2e1386, ((u64)((char *)&D_strliteral_2e1388)), ((u64)24UL));
+	BLIT(t_param_2e1390, t_binding_2e1379, ((u64)24UL));
+	*(u64 *)t_binding_2e1395 = (u64)t_param_2e1390;
+	t__2e1396 = (u64)(*(u64 *)t_binding_2e1395);
+	t__2e1399 = (u64)(*(u64 *)t__2e1396);
+	goto L__2e1391;
+	L__2e1391:;
+	t__2e1402 = (u64)((u64)t_binding_2e1379 + (u64)((u64)8UL));
+	t__2e1404 = (u64)(*(u64 *)t__2e1402);
+	t__2e1389 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1399, (u64)t__2e1404));
+	t__2e1406 = (u64)(*(u64 *)t_param_2e1373);
+	BLIT(t_param_2e1407, t__2e1406, ((u64)24UL));
+	*(u64 *)t_binding_2e1412 = (u64)t_param_2e1407;
+	t__2e1413 = (u64)(*(u64 *)t_binding_2e1412);
+	t__2e1415 = (u64)(*(u64 *)t__2e1413);
+	goto L__2e1408;
+	L__2e1408:;
+	t__2e1418 = (u64)(*(u64 *)t_param_2e1373);
+	t__2e1419 = (u64)((u64)t__2e1418 + (u64)((u64)8UL));
+	t__2e1421 = (u64)(*(u64 *)t__2e1419);
+	t__2e1405 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1415, (u64)t__2e1421));
+	BLIT(t_param_2e1423, t_binding_2e1383, ((u64)24UL));
+	*(u64 *)t_binding_2e1428 = (u64)t_param_2e1423;
+	t__2e1429 = (u64)(*(u64 *)t_binding_2e1428);
+	t__2e1431 = (u64)(*(u64 *)t__2e1429);
+	goto L__2e1424;
+	L__2e1424:;
+	t__2e1434 = (u64)((u64)t_binding_2e1383 + (u64)((u64)8UL));
+	t__2e1436 = (u64)(*(u64 *)t__2e1434);
+	t__2e1422 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1431, (u64)t__2e1436));
+	t__2e1439 = (u64)(*(u64 *)t_param_2e1374);
+	t__2e1437 = ((u64 (*)(u64, u64))((u64)((char *)&F_rt_2eu64tos)))((u64)R20, (u64)t__2e1439);
+	t_binding_2e1440 = (u64)((u64)t__2e1437 + (u64)((u64)0UL));
+	t_binding_2e1441 = (u64)((u64)t__2e1437 + (u64)((u64)8UL));
+	t__2e1443 = (u64)(*(u64 *)t_binding_2e1440);
+	t__2e1444 = (u64)(*(u64 *)t_binding_2e1441);
+	t__2e1442 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1443, (u64)t__2e1444));
+	BLIT(t_param_2e1446, t_binding_2e1383, ((u64)24UL));
+	*(u64 *)t_binding_2e1451 = (u64)t_param_2e1446;
+	t__2e1452 = (u64)(*(u64 *)t_binding_2e1451);
+	t__2e1454 = (u64)(*(u64 *)t__2e1452);
+	goto L__2e1447;
+	L__2e1447:;
+	t__2e1457 = (u64)((u64)t_binding_2e1383 + (u64)((u64)8UL));
+	t__2e1459 = (u64)(*(u64 *)t__2e1457);
+	t__2e1445 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1454, (u64)t__2e1459));
+	t__2e1461 = (u64)(*(u64 *)t_param_2e1375);
+	t__2e1460 = ((u64 (*)(u64, u64))((u64)((char *)&F_rt_2eu64tos)))((u64)R21, (u64)t__2e1461);
+	t_binding_2e1462 = (u64)((u64)t__2e1460 + (u64)((u64)0UL));
+	t_binding_2e1463 = (u64)((u64)t__2e1460 + (u64)((u64)8UL));
+	t__2e1465 = (u64)(*(u64 *)t_binding_2e1462);
+	t__2e1466 = (u64)(*(u64 *)t_binding_2e1463);
+	t__2e1464 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1465, (u64)t__2e1466));
+	BLIT(t_param_2e1468, t_binding_2e1386, ((u64)24UL));
+	*(u64 *)t_binding_2e1473 = (u64)t_param_2e1468;
+	t__2e1474 = (u64)(*(u64 *)t_binding_2e1473);
+	t__2e1476 = (u64)(*(u64 *)t__2e1474);
+	goto L__2e1469;
+	L__2e1469:;
+	t__2e1479 = (u64)((u64)t_binding_2e1386 + (u64)((u64)8UL));
+	t__2e1481 = (u64)(*(u64 *)t__2e1479);
+	t__2e1467 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1476, (u64)t__2e1481));
+	BLIT(t_param_2e1483, t_msg, ((u64)24UL));
+	*(u64 *)t_binding_2e1488 = (u64)t_param_2e1483;
+	t__2e1489 = (u64)(*(u64 *)t_binding_2e1488);
+	t__2e1491 = (u64)(*(u64 *)t__2e1489);
+	goto L__2e1484;
+	L__2e1484:;
+	t__2e1494 = (u64)((u64)t_msg + (u64)((u64)8UL));
+	t__2e1496 = (u64)(*(u64 *)t__2e1494);
+	t__2e1482 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1491, (u64)t__2e1496));
+	BLIT(t_param_2e1500, ((u64)((char *)&D_strliteral_2e1499)), ((u64)24UL));
+	*(u64 *)t_binding_2e1505 = (u64)t_param_2e1500;
+	t__2e1506 = (u64)(*(u64 *)t_binding_2e1505);
+	t__2e1508 = (u64)(*(u64 *)t__2e1506);
+	goto L__2e1501;
+	L__2e1501:;
+	t__2e1497 = (u64)(((u64 (*)(u32, u64, u64))((u64)((char *)&F_rt_2ewrite)))((u32)((u64)2UL), (u64)t__2e1508, (u64)((u64)1UL)));
+	t__2e1512 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_rt_2egetpid)))());
+	t__2e1511 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rt_2ekill)))((u32)t__2e1512, (u32)((u64)6UL)));
+	goto L__2e1377;
+	L__2e1377:;
+	return;
+}
+static u64 F_rt_2eu64tos(u64 __rp, u64 p_u) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[1] __attribute__((aligned(16)));
+	char A5[16] __attribute__((aligned(16)));
+	u64 t__2e1523;
+	u64 t__2e1533;
+	u64 t__2e1534;
+	u64 t__2e1535;
+	u64 t__2e1536;
+	u64 t__2e1537;
+	u64 t__2e1539;
+	u64 t__2e1544;
+	u64 t__2e1545;
+	u64 t__2e1546;
+	u64 t__2e1549;
+	u64 t__2e1550;
+	u64 t__2e1551;
+	u64 t__2e1552;
+	u64 t__2e1553;
+	u64 t__2e1554;
+	u64 t__2e1557;
+	u64 t__2e1558;
+	u64 t__2e1566;
+	u64 t__2e1567;
+	u64 t__2e1570;
+	u64 t__2e1571;
+	u64 t__2e1572;
+	u64 t__2e1573;
+	u64 t__2e1574;
+	u64 t__2e1575;
+	u64 t__2e1576;
+	u64 t__2e1577;
+	u64 t__2e1578;
+	u64 t__2e1579;
+	u64 t__2e1582;
+	u64 t__2e1583;
+	u64 t__2e1585;
+	u64 t__2e1594;
+	u64 t__2e1595;
+	u64 t__2e1597;
+	u64 t__2e1598;
+	u64 t__2e1599;
+	u64 t__2e1600;
+	u64 t__2e1604;
+	u64 t__2e1605;
+	u64 t__2e1607;
+	u64 t__2e1608;
+	u64 t__2e1609;
+	u64 t__2e1610;
+	u64 t__2e1613;
+	u64 t__2e1614;
+	u64 t__2e1617;
+	u64 t__2e1618;
+	u64 t__2e1619;
+	u64 t__2e1620;
+	u64 t__2e1623;
+	u64 t__2e1624;
+	u64 t__2e1625;
+	u64 t__2e1628;
+	u64 t__2e1629;
+	u64 t__2e1630;
+	u64 t__2e1632;
+	u64 t__2e1633;
+	u64 t__2e1634;
+	u64 t__2e1635;
+	u64 t__2e1638;
+	u64 t__2e1639;
+	u64 t__2e1640;
+	u64 t__2e1644;
+	u64 t__2e1645;
+	u64 t__2e1647;
+	u64 t_abortsite_2e1531;
+	u64 t_binding_2e1519;
+	u64 t_binding_2e1592;
+	u64 t_binding_2e1593;
+	u64 t_binding_2e1603;
+	u64 t_data_2e1538;
+	u64 t_object_2e1642;
+	u64 t_param_2e1515;
+	u64 t_u;
+	u64 t_value_2e1643;
+	t_u = (u64)p_u;
+	L_start_2e1514:;
+	t_param_2e1515 = (u64)A0;
+	t_binding_2e1519 = (u64)A1;
+	t_binding_2e1592 = (u64)A2;
+	t_binding_2e1593 = (u64)A3;
+	t_binding_2e1603 = (u64)A4;
+	t_object_2e1642 = (u64)A5;
+	*(u64 *)t_param_2e1515 = (u64)t_u;
+	L_body_2e1516:;
+	t__2e1523 = ((u64)0UL);
+	t__2e1523 = ((u64)0UL);
+	goto L__2e1529;
+	L__2e1529:;
+	t_data_2e1538 = ((u64)0UL);
+	t_data_2e1538 = (u64)((u64)((u64)((char *)&D_static_2e2)) + (u64)t_data_2e1538);
+	*(u64 *)t_binding_2e1519 = (u64)t_data_2e1538;
+	t__2e1539 = (u64)((u64)t_binding_2e1519 + (u64)((u64)8UL));
+	*(u64 *)t__2e1539 = (u64)t__2e1523;
+	t__2e1539 = (u64)((u64)t_binding_2e1519 + (u64)((u64)16UL));
+	*(u64 *)t__2e1539 = (u64)((u64)20UL);
+	t__2e1545 = (u64)(*(u64 *)t_param_2e1515);
+	t__2e1544 = (u64)(u32)(((u64)t__2e1545 == (u64)((u64)0UL)));
+	t__2e1546 = (u64)(u32)((u8)t__2e1544);
+	if ((u32)t__2e1546) goto L_true_2e1541; else goto L_false_2e1542;
+	L_true_2e1541:;
+	t__2e1549 = (u64)((u64)t_binding_2e1519 + (u64)((u64)8UL));
+	t__2e1550 = (u64)((u64)t_binding_2e1519 + (u64)((u64)16UL));
+	t__2e1551 = (u64)(*(u64 *)t__2e1549);
+	t__2e1552 = (u64)((u64)t__2e1551 + (u64)((u64)1UL));
+	*(u64 *)t__2e1549 = (u64)t__2e1552;
+	t__2e1554 = (u64)(*(u64 *)t__2e1550);
+	t__2e1557 = (u64)(u32)(((u64)t__2e1552 <= (u64)t__2e1554));
+	if ((u32)t__2e1557) goto L__2e1555; else goto L__2e1556;
+	L__2e1556:;
+	t_abortsite_2e1531 = ((u64)1UL);
+	goto L_abort_2e1532;
+	L__2e1555:;
+	t__2e1558 = (u64)(*(u64 *)t_binding_2e1519);
+	t__2e1553 = t__2e1551;
+	t__2e1553 = (u64)((u64)t__2e1558 + (u64)t__2e1553);
+	*(u8 *)t__2e1553 = (u8)((u64)48UL);
+	goto L__2e1543;
+	L_false_2e1542:;
+	L__2e1543:;
+	L_loop_2e1561:;
+	t__2e1567 = (u64)(*(u64 *)t_param_2e1515);
+	t__2e1566 = (u64)(u32)(((u64)t__2e1567 > (u64)((u64)0UL)));
+	if ((u32)t__2e1566) goto L_body_2e1562; else goto L__2e1564;
+	L_body_2e1562:;
+	t__2e1570 = (u64)((u64)t_binding_2e1519 + (u64)((u64)8UL));
+	t__2e1571 = (u64)((u64)t_binding_2e1519 + (u64)((u64)16UL));
+	t__2e1572 = (u64)(*(u64 *)t__2e1570);
+	t__2e1575 = (u64)(*(u64 *)t_param_2e1515);
+	t__2e1574 = (u64)((u64)t__2e1575 % (u64)((u64)10UL));
+	t__2e1576 = (u64)(u32)t__2e1574;
+	t__2e1573 = (u64)(u32)((u32)t__2e1576 + (u32)((u64)48UL));
+	t__2e1577 = (u64)((u64)t__2e1572 + (u64)((u64)1UL));
+	*(u64 *)t__2e1570 = (u64)t__2e1577;
+	t__2e1579 = (u64)(*(u64 *)t__2e1571);
+	t__2e1582 = (u64)(u32)(((u64)t__2e1577 <= (u64)t__2e1579));
+	if ((u32)t__2e1582) goto L__2e1580; else goto L__2e1581;
+	L__2e1581:;
+	t_abortsite_2e1531 = ((u64)2UL);
+	goto L_abort_2e1532;
+	L__2e1580:;
+	t__2e1583 = (u64)(*(u64 *)t_binding_2e1519);
+	t__2e1578 = t__2e1572;
+	t__2e1578 = (u64)((u64)t__2e1583 + (u64)t__2e1578);
+	*(u8 *)t__2e1578 = (u8)t__2e1573;
+	t__2e1585 = (u64)(*(u64 *)t_param_2e1515);
+	t__2e1585 = (u64)((u64)t__2e1585 / (u64)((u64)10UL));
+	*(u64 *)t_param_2e1515 = (u64)t__2e1585;
+	goto L_loop_2e1561;
+	L__2e1564:;
+	*(u64 *)t_binding_2e1592 = (u64)((u64)0UL);
+	t__2e1595 = (u64)((u64)t_binding_2e1519 + (u64)((u64)8UL));
+	t__2e1597 = (u64)(*(u64 *)t__2e1595);
+	t__2e1594 = (u64)((u64)t__2e1597 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1593 = (u64)t__2e1594;
+	L_loop_2e1587:;
+	t__2e1599 = (u64)(*(u64 *)t_binding_2e1592);
+	t__2e1600 = (u64)(*(u64 *)t_binding_2e1593);
+	t__2e1598 = (u64)(u32)(((u64)t__2e1599 < (u64)t__2e1600));
+	if ((u32)t__2e1598) goto L_body_2e1588; else goto L__2e1590;
+	L_body_2e1588:;
+	t__2e1605 = (u64)((u64)t_binding_2e1519 + (u64)((u64)8UL));
+	t__2e1607 = (u64)(*(u64 *)t_binding_2e1519);
+	t__2e1608 = (u64)(*(u64 *)t__2e1605);
+	t__2e1609 = (u64)(*(u64 *)t_binding_2e1592);
+	t__2e1604 = t__2e1609;
+	t__2e1604 = (u64)((u64)t__2e1607 + (u64)t__2e1604);
+	t__2e1610 = (u64)(u32)(((u64)t__2e1609 < (u64)t__2e1608));
+	if ((u32)t__2e1610) goto L__2e1612; else goto L__2e1611;
+	L__2e1611:;
+	t_abortsite_2e1531 = ((u64)3UL);
+	goto L_abort_2e1532;
+	L__2e1612:;
+	t__2e1613 = (u64)(u32)(*(u8 *)t__2e1604);
+	*(u8 *)t_binding_2e1603 = (u8)t__2e1613;
+	t__2e1617 = (u64)(*(u64 *)t_binding_2e1519);
+	t__2e1618 = (u64)(*(u64 *)t_binding_2e1592);
+	t__2e1614 = t__2e1618;
+	t__2e1614 = (u64)((u64)t__2e1617 + (u64)t__2e1614);
+	t__2e1620 = (u64)((u64)t_binding_2e1519 + (u64)((u64)8UL));
+	t__2e1623 = (u64)(*(u64 *)t__2e1620);
+	t__2e1624 = (u64)(*(u64 *)t_binding_2e1593);
+	t__2e1619 = t__2e1624;
+	t__2e1619 = (u64)((u64)t__2e1617 + (u64)t__2e1619);
+	t__2e1625 = (u64)(u32)(((u64)t__2e1624 < (u64)t__2e1623));
+	if ((u32)t__2e1625) goto L__2e1627; else goto L__2e1626;
+	L__2e1626:;
+	t_abortsite_2e1531 = ((u64)4UL);
+	goto L_abort_2e1532;
+	L__2e1627:;
+	t__2e1628 = (u64)(u32)(*(u8 *)t__2e1619);
+	*(u8 *)t__2e1614 = (u8)t__2e1628;
+	t__2e1630 = (u64)((u64)t_binding_2e1519 + (u64)((u64)8UL));
+	t__2e1632 = (u64)(*(u64 *)t_binding_2e1519);
+	t__2e1633 = (u64)(*(u64 *)t__2e1630);
+	t__2e1634 = (u64)(*(u64 *)t_binding_2e1593);
+	t__2e1629 = t__2e1634;
+	t__2e1629 = (u64)((u64)t__2e1632 + (u64)t__2e1629);
+	t__2e1635 = (u64)(u32)(((u64)t__2e1634 < (u64)t__2e1633));
+	if ((u32)t__2e1635) goto L__2e1637; else goto L__2e1636;
+	L__2e1636:;
+	t_abortsite_2e1531 = ((u64)5UL);
+	goto L_abort_2e1532;
+	L__2e1637:;
+	t__2e1638 = (u64)(u32)(*(u8 *)t_binding_2e1603);
+	*(u8 *)t__2e1629 = (u8)t__2e1638;
+	t__2e1639 = (u64)(*(u64 *)t_binding_2e1592);
+	t__2e1639 = (u64)((u64)t__2e1639 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1592 = (u64)t__2e1639;
+	t__2e1640 = (u64)(*(u64 *)t_binding_2e1593);
+	t__2e1640 = (u64)((u64)t__2e1640 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1593 = (u64)t__2e1640;
+	goto L_loop_2e1587;
+	L__2e1590:;
+	t_value_2e1643 = t_object_2e1642;
+	t__2e1644 = (u64)(*(u64 *)t_binding_2e1519);
+	*(u64 *)t_value_2e1643 = (u64)t__2e1644;
+	t_value_2e1643 = (u64)((u64)t_object_2e1642 + (u64)((u64)8UL));
+	t__2e1645 = (u64)((u64)t_binding_2e1519 + (u64)((u64)8UL));
+	t__2e1647 = (u64)(*(u64 *)t__2e1645);
+	*(u64 *)t_value_2e1643 = (u64)t__2e1647;
+	BLIT(__rp, t_object_2e1642, 16); return __rp;
+	L_abort_2e1532:;
+	t__2e1533 = (u64)((u64)t_abortsite_2e1531 * (u64)((u64)16UL));
+	t__2e1533 = (u64)((u64)((u64)((char *)&D_abortsites_2e1530)) + (u64)t__2e1533);
+	t__2e1534 = (u64)(*(u64 *)t__2e1533);
+	t__2e1535 = (u64)((u64)t__2e1533 + (u64)((u64)8UL));
+	t__2e1536 = (u64)(*(u32 *)t__2e1535);
+	t__2e1535 = (u64)((u64)t__2e1533 + (u64)((u64)12UL));
+	t__2e1537 = (u64)(*(u32 *)t__2e1535);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e1534, (u64)t__2e1536, (u64)t__2e1537, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static u64 F_rt_2esegmalloc(u64 p_n) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e1664;
+	u64 t__2e1666;
+	u64 t__2e1670;
+	u64 t__2e1674;
+	u64 t__2e1675;
+	u64 t__2e1677;
+	u64 t__2e1679;
+	u64 t__2e1681;
+	u64 t_binding_2e1663;
+	u64 t_n;
+	u64 t_param_2e1659;
+	t_n = (u64)p_n;
+	L_start_2e1658:;
+	t_param_2e1659 = (u64)A0;
+	t_binding_2e1663 = (u64)A1;
+	*(u64 *)t_param_2e1659 = (u64)t_n;
+	L_body_2e1660:;
+	t__2e1666 = (u64)(*(u64 *)t_param_2e1659);
+	t__2e1664 = (u64)(((u64 (*)(u64, u64, u32, u32, u32, u64))((u64)((char *)&F_rt_2emmap)))((u64)((u64)0UL), (u64)t__2e1666, (u32)((u64)3UL), (u32)((u64)34UL), (u32)((u64)4294967295UL), (u64)((u64)0UL)));
+	*(u64 *)t_binding_2e1663 = (u64)t__2e1664;
+	t__2e1675 = (u64)(*(u64 *)t_binding_2e1663);
+	t__2e1677 = (u64)(u32)t__2e1675;
+	t__2e1674 = (u64)(u32)(((u32)t__2e1677 == (u32)((u64)4294967284UL)));
+	t__2e1679 = (u64)(u32)((u8)t__2e1674);
+	if ((u32)t__2e1679) goto L_true_2e1671; else goto L_false_2e1672;
+	L_true_2e1671:;
+	t__2e1670 = ((u64)0UL);
+	goto L__2e1673;
+	L_false_2e1672:;
+	t__2e1681 = (u64)(*(u64 *)t_binding_2e1663);
+	t__2e1670 = t__2e1681;
+	L__2e1673:;
+	return (u64)t__2e1670;
+}
+static u64 F_rt_2esize__getbin(u64 p_sz) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e1689;
+	u64 t__2e1690;
+	u64 t__2e1691;
+	u64 t__2e1692;
+	u64 t__2e1697;
+	u64 t__2e1698;
+	u64 t__2e1699;
+	u64 t__2e1707;
+	u64 t__2e1708;
+	u64 t__2e1709;
+	u64 t__2e1710;
+	u64 t__2e1711;
+	u64 t__2e1712;
+	u64 t__2e1713;
+	u64 t_binding_2e1701;
+	u64 t_param_2e1685;
+	u64 t_sz;
+	t_sz = (u64)p_sz;
+	L_start_2e1684:;
+	t_param_2e1685 = (u64)A0;
+	t_binding_2e1701 = (u64)A1;
+	*(u64 *)t_param_2e1685 = (u64)t_sz;
+	L_body_2e1686:;
+	t__2e1692 = (u64)(*(u64 *)t_param_2e1685);
+	t__2e1691 = (u64)((u64)t__2e1692 + (u64)((u64)8UL));
+	t__2e1690 = (u64)((u64)t__2e1691 - (u64)((u64)1UL));
+	t__2e1689 = (u64)((u64)t__2e1690 >> (((u64)4UL) & 63));
+	*(u64 *)t_param_2e1685 = (u64)t__2e1689;
+	t__2e1698 = (u64)(*(u64 *)t_param_2e1685);
+	t__2e1697 = (u64)(u32)(((u64)t__2e1698 == (u64)((u64)0UL)));
+	t__2e1699 = (u64)(u32)((u8)t__2e1697);
+	if ((u32)t__2e1699) goto L_true_2e1694; else goto L_false_2e1695;
+	L_true_2e1694:;
+	return (u64)((u64)0UL);
+	L_false_2e1695:;
+	L__2e1696:;
+	*(u64 *)t_binding_2e1701 = (u64)((u64)0UL);
+	L_loop_2e1702:;
+	t__2e1709 = (u64)(*(u64 *)t_binding_2e1701);
+	t__2e1708 = (u64)((u64)((u64)1UL) << (t__2e1709 & 63));
+	t__2e1710 = (u64)(*(u64 *)t_param_2e1685);
+	t__2e1707 = (u64)(u32)(((u64)t__2e1708 < (u64)t__2e1710));
+	if ((u32)t__2e1707) goto L_body_2e1703; else goto L__2e1705;
+	L_body_2e1703:;
+	L_after_2e1706:;
+	t__2e1711 = (u64)(*(u64 *)t_binding_2e1701);
+	t__2e1711 = (u64)((u64)t__2e1711 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1701 = (u64)t__2e1711;
+	goto L_loop_2e1702;
+	L__2e1705:;
+	t__2e1713 = (u64)(*(u64 *)t_binding_2e1701);
+	t__2e1712 = (u64)((u64)t__2e1713 + (u64)((u64)1UL));
+	return (u64)t__2e1712;
+}
+static u32 F_rt_2esegfree(u64 p_p, u64 p_s) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e1720;
+	u64 t__2e1721;
+	u64 t__2e1722;
+	u64 t_p;
+	u64 t_param_2e1717;
+	u64 t_param_2e1718;
+	u64 t_s;
+	t_p = (u64)p_p;
+	t_s = (u64)p_s;
+	L_start_2e1716:;
+	t_param_2e1717 = (u64)A0;
+	t_param_2e1718 = (u64)A1;
+	*(u64 *)t_param_2e1717 = (u64)t_p;
+	*(u64 *)t_param_2e1718 = (u64)t_s;
+	L_body_2e1719:;
+	t__2e1721 = (u64)(*(u64 *)t_param_2e1717);
+	t__2e1722 = (u64)(*(u64 *)t_param_2e1718);
+	t__2e1720 = (u64)(u32)(((u32 (*)(u64, u64))((u64)((char *)&F_rt_2emunmap)))((u64)t__2e1721, (u64)t__2e1722));
+	return (u32)t__2e1720;
+}
+static u32 F_rt_2esize__islarge(u64 p_sz) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e1726;
+	u64 t__2e1727;
+	u64 t__2e1738;
+	u64 t__2e1739;
+	u64 t__2e1740;
+	u64 t__2e1741;
+	u64 t__2e1742;
+	u64 t__2e1743;
+	u64 t__2e1744;
+	u64 t__2e1745;
+	u64 t__2e1746;
+	u64 t__2e1747;
+	u64 t_binding_2e1734;
+	u64 t_param_2e1724;
+	u64 t_param_2e1729;
+	u64 t_sz;
+	t_sz = (u64)p_sz;
+	L_start_2e1723:;
+	t_param_2e1724 = (u64)A0;
+	t_param_2e1729 = (u64)A1;
+	t_binding_2e1734 = (u64)A2;
+	*(u64 *)t_param_2e1724 = (u64)t_sz;
+	L_body_2e1725:;
+	t__2e1727 = (u64)(*(u64 *)t_param_2e1724);
+	*(u64 *)t_param_2e1729 = (u64)((u64)8UL);
+	t__2e1739 = (u64)(*(u64 *)t_param_2e1729);
+	t__2e1738 = (u64)(u32)(((u64)t__2e1739 == (u64)((u64)0UL)));
+	t__2e1740 = (u64)(u32)((u8)t__2e1738);
+	if ((u32)t__2e1740) goto L_true_2e1735; else goto L_false_2e1736;
+	L_true_2e1735:;
+	*(u64 *)t_binding_2e1734 = (u64)((u64)0UL);
+	goto L__2e1737;
+	L_false_2e1736:;
+	t__2e1743 = (u64)(*(u64 *)t_param_2e1729);
+	t__2e1742 = (u64)((u64)t__2e1743 - (u64)((u64)1UL));
+	t__2e1741 = (u64)((u64)((u64)1UL) << (t__2e1742 & 63));
+	*(u64 *)t_binding_2e1734 = (u64)t__2e1741;
+	L__2e1737:;
+	t__2e1747 = (u64)(*(u64 *)t_binding_2e1734);
+	t__2e1746 = (u64)((u64)t__2e1747 << (((u64)4UL) & 63));
+	t__2e1745 = (u64)((u64)t__2e1746 + (u64)((u64)16UL));
+	t__2e1744 = (u64)((u64)t__2e1745 - (u64)((u64)8UL));
+	goto L__2e1730;
+	L__2e1730:;
+	t__2e1726 = (u64)(u32)(((u64)t__2e1727 > (u64)t__2e1744));
+	return (u32)t__2e1726;
+}
+static u64 F_rt_2erealsz(u64 p_sz) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e1759;
+	u64 t__2e1760;
+	u64 t__2e1761;
+	u64 t__2e1764;
+	u64 t__2e1770;
+	u64 t__2e1771;
+	u64 t__2e1772;
+	u64 t__2e1773;
+	u64 t__2e1774;
+	u64 t__2e1775;
+	u64 t__2e1776;
+	u64 t__2e1777;
+	u64 t__2e1778;
+	u64 t__2e1779;
+	u64 t__2e1780;
+	u64 t__2e1783;
+	u64 t__2e1784;
+	u64 t__2e1794;
+	u64 t__2e1795;
+	u64 t__2e1796;
+	u64 t__2e1797;
+	u64 t__2e1798;
+	u64 t__2e1799;
+	u64 t__2e1800;
+	u64 t__2e1801;
+	u64 t__2e1802;
+	u64 t__2e1803;
+	u64 t_binding_2e1790;
+	u64 t_param_2e1751;
+	u64 t_param_2e1785;
+	u64 t_sz;
+	t_sz = (u64)p_sz;
+	L_start_2e1750:;
+	t_param_2e1751 = (u64)A0;
+	t_param_2e1785 = (u64)A1;
+	t_binding_2e1790 = (u64)A2;
+	*(u64 *)t_param_2e1751 = (u64)t_sz;
+	L_body_2e1752:;
+	t__2e1760 = (u64)(*(u64 *)t_param_2e1751);
+	t__2e1759 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_rt_2esize__islarge)))((u64)t__2e1760));
+	t__2e1761 = (u64)(u32)((u8)t__2e1759);
+	if ((u32)t__2e1761) goto L_true_2e1756; else goto L_false_2e1757;
+	L_true_2e1756:;
+	t__2e1764 = (u64)(*(u64 *)t_param_2e1751);
+	t__2e1764 = (u64)((u64)t__2e1764 + (u64)((u64)24UL));
+	*(u64 *)t_param_2e1751 = (u64)t__2e1764;
+	t__2e1772 = (u64)(*(u64 *)t_param_2e1751);
+	t__2e1771 = (u64)((u64)t__2e1772 & (u64)((u64)4095UL));
+	t__2e1770 = (u64)(u32)(((u64)t__2e1771 != (u64)((u64)0UL)));
+	t__2e1773 = (u64)(u32)((u8)t__2e1770);
+	if ((u32)t__2e1773) goto L_true_2e1767; else goto L_false_2e1768;
+	L_true_2e1767:;
+	t__2e1774 = (u64)(*(u64 *)t_param_2e1751);
+	t__2e1777 = t__2e1774;
+	t__2e1776 = (u64)((u64)t__2e1777 & (u64)((u64)4095UL));
+	t__2e1775 = (u64)((u64)((u64)4096UL) - (u64)t__2e1776);
+	t__2e1774 = (u64)((u64)t__2e1774 + (u64)t__2e1775);
+	*(u64 *)t_param_2e1751 = (u64)t__2e1774;
+	goto L__2e1769;
+	L_false_2e1768:;
+	L__2e1769:;
+	t__2e1780 = (u64)(*(u64 *)t_param_2e1751);
+	t__2e1779 = (u64)((u64)t__2e1780 - (u64)((u64)16UL));
+	t__2e1778 = (u64)((u64)t__2e1779 - (u64)((u64)8UL));
+	return (u64)t__2e1778;
+	L_false_2e1757:;
+	L__2e1758:;
+	t__2e1784 = (u64)(*(u64 *)t_param_2e1751);
+	t__2e1783 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esize__getbin)))((u64)t__2e1784));
+	*(u64 *)t_param_2e1785 = (u64)t__2e1783;
+	t__2e1795 = (u64)(*(u64 *)t_param_2e1785);
+	t__2e1794 = (u64)(u32)(((u64)t__2e1795 == (u64)((u64)0UL)));
+	t__2e1796 = (u64)(u32)((u8)t__2e1794);
+	if ((u32)t__2e1796) goto L_true_2e1791; else goto L_false_2e1792;
+	L_true_2e1791:;
+	*(u64 *)t_binding_2e1790 = (u64)((u64)0UL);
+	goto L__2e1793;
+	L_false_2e1792:;
+	t__2e1799 = (u64)(*(u64 *)t_param_2e1785);
+	t__2e1798 = (u64)((u64)t__2e1799 - (u64)((u64)1UL));
+	t__2e1797 = (u64)((u64)((u64)1UL) << (t__2e1798 & 63));
+	*(u64 *)t_binding_2e1790 = (u64)t__2e1797;
+	L__2e1793:;
+	t__2e1803 = (u64)(*(u64 *)t_binding_2e1790);
+	t__2e1802 = (u64)((u64)t__2e1803 << (((u64)4UL) & 63));
+	t__2e1801 = (u64)((u64)t__2e1802 + (u64)((u64)16UL));
+	t__2e1800 = (u64)((u64)t__2e1801 - (u64)((u64)8UL));
+	goto L__2e1786;
+	L__2e1786:;
+	return (u64)t__2e1800;
+}
+static void F_rt_2evalidatemeta(u64 p_m, u32 p_shallow) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char B16[24] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	u64 t__2e1816;
+	u64 t__2e1817;
+	u64 t__2e1818;
+	u64 t__2e1828;
+	u64 t__2e1831;
+	u64 t__2e1832;
+	u64 t__2e1833;
+	u64 t__2e1835;
+	u64 t__2e1836;
+	u64 t__2e1837;
+	u64 t__2e1838;
+	u64 t__2e1840;
+	u64 t__2e1845;
+	u64 t__2e1853;
+	u64 t__2e1854;
+	u64 t__2e1855;
+	u64 t__2e1857;
+	u64 t__2e1858;
+	u64 t__2e1859;
+	u64 t__2e1861;
+	u64 t__2e1866;
+	u64 t__2e1872;
+	u64 t__2e1880;
+	u64 t__2e1881;
+	u64 t__2e1882;
+	u64 t__2e1892;
+	u64 t__2e1893;
+	u64 t__2e1894;
+	u64 t__2e1895;
+	u64 t__2e1896;
+	u64 t__2e1902;
+	u64 t__2e1903;
+	u64 t__2e1904;
+	u64 t__2e1905;
+	u64 t__2e1906;
+	u64 t__2e1910;
+	u64 t__2e1912;
+	u64 t__2e1916;
+	u64 t__2e1921;
+	u64 t__2e1922;
+	u64 t__2e1924;
+	u64 t__2e1925;
+	u64 t__2e1930;
+	u64 t__2e1931;
+	u64 t__2e1932;
+	u64 t__2e1933;
+	u64 t__2e1942;
+	u64 t__2e1943;
+	u64 t__2e1944;
+	u64 t__2e1945;
+	u64 t__2e1946;
+	u64 t__2e1948;
+	u64 t__2e1953;
+	u64 t__2e1954;
+	u64 t__2e1956;
+	u64 t__2e1957;
+	u64 t__2e1959;
+	u64 t__2e1966;
+	u64 t__2e1967;
+	u64 t__2e1968;
+	u64 t__2e1970;
+	u64 t__2e1980;
+	u64 t__2e1981;
+	u64 t__2e1982;
+	u64 t__2e1983;
+	u64 t__2e1984;
+	u64 t__2e1985;
+	u64 t__2e1986;
+	u64 t__2e1987;
+	u64 t__2e1988;
+	u64 t__2e1989;
+	u64 t__2e1992;
+	u64 t__2e1994;
+	u64 t__2e2001;
+	u64 t__2e2002;
+	u64 t__2e2003;
+	u64 t__2e2005;
+	u64 t__2e2006;
+	u64 t__2e2009;
+	u64 t__2e2014;
+	u64 t__2e2015;
+	u64 t__2e2017;
+	u64 t__2e2018;
+	u64 t__2e2019;
+	u64 t__2e2024;
+	u64 t__2e2025;
+	u64 t__2e2026;
+	u64 t__2e2028;
+	u64 t__2e2038;
+	u64 t__2e2039;
+	u64 t__2e2040;
+	u64 t__2e2041;
+	u64 t__2e2042;
+	u64 t__2e2043;
+	u64 t__2e2044;
+	u64 t__2e2045;
+	u64 t__2e2046;
+	u64 t__2e2047;
+	u64 t__2e2050;
+	u64 t__2e2052;
+	u64 t_binding_2e1875;
+	u64 t_binding_2e1909;
+	u64 t_binding_2e1976;
+	u64 t_binding_2e2034;
+	u64 t_field_2e1819;
+	u64 t_field_2e1911;
+	u64 t_field_2e1934;
+	u64 t_m;
+	u64 t_param_2e1809;
+	u64 t_param_2e1810;
+	u64 t_param_2e1846;
+	u64 t_param_2e1971;
+	u64 t_param_2e2029;
+	u64 t_shallow;
+	t_m = (u64)p_m;
+	t_shallow = (u64)p_shallow;
+	L_start_2e1808:;
+	t_param_2e1809 = (u64)A0;
+	t_param_2e1810 = (u64)A1;
+	t_param_2e1846 = (u64)A2;
+	t_binding_2e1875 = (u64)A3;
+	t_binding_2e1909 = (u64)A4;
+	t_param_2e1971 = (u64)A5;
+	t_binding_2e1976 = (u64)A6;
+	t_param_2e2029 = (u64)A7;
+	t_binding_2e2034 = (u64)A8;
+	*(u64 *)t_param_2e1809 = (u64)t_m;
+	*(u8 *)t_param_2e1810 = (u8)t_shallow;
+	L_body_2e1811:;
+	t__2e1818 = (u64)(*(u64 *)t_param_2e1809);
+	t_field_2e1819 = (u64)((u64)t__2e1818 + (u64)((u64)8UL));
+	t__2e1817 = (u64)((u64)t_field_2e1819 % (u64)((u64)16UL));
+	t__2e1816 = (u64)(u32)(((u64)t__2e1817 == (u64)((u64)0UL)));
+	if ((u32)t__2e1816) goto L_passed_2e1815; else goto L_failed_2e1814;
+	L_failed_2e1814:;
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e1823)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)228UL), (u64)((u64)15UL), (u64)B9);
+	__builtin_trap();
+	L_passed_2e1815:;
+	t__2e1833 = (u64)(*(u64 *)t_param_2e1809);
+	t__2e1835 = (u64)(*(u64 *)t__2e1833);
+	t__2e1832 = (u64)((u64)t__2e1835 & (u64)((u64)1UL));
+	t__2e1831 = (u64)(u32)(((u64)t__2e1832 == (u64)((u64)1UL)));
+	t__2e1828 = (u64)(u32)t__2e1831;
+	if ((u32)t__2e1828) goto L__2e1830; else goto L__2e1829;
+	L__2e1829:;
+	t__2e1837 = (u64)(u32)(*(u8 *)t_param_2e1810);
+	t__2e1838 = (u64)(u32)((u8)t__2e1837);
+	t__2e1836 = (u64)(u32)(((u32)t__2e1838 == (u32)((u64)1UL)));
+	t__2e1828 = (u64)(u32)t__2e1836;
+	goto L__2e1830;
+	L__2e1830:;
+	t__2e1840 = (u64)(u32)((u8)t__2e1828);
+	if ((u32)t__2e1840) goto L_true_2e1825; else goto L_false_2e1826;
+	L_true_2e1825:;
+	t__2e1845 = (u64)(*(u64 *)t_param_2e1809);
+	*(u64 *)t_param_2e1846 = (u64)t__2e1845;
+	t__2e1855 = (u64)(*(u64 *)t_param_2e1846);
+	t__2e1857 = (u64)(*(u64 *)t__2e1855);
+	t__2e1854 = (u64)((u64)t__2e1857 & (u64)((u64)1UL));
+	t__2e1853 = (u64)(u32)(((u64)t__2e1854 == (u64)((u64)1UL)));
+	if ((u32)t__2e1853) goto L_passed_2e1852; else goto L_failed_2e1851;
+	L_failed_2e1851:;
+	BLIT((u64)B10, ((u64)((char *)&D_strliteral_2e104)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)208UL), (u64)((u64)15UL), (u64)B10);
+	__builtin_trap();
+	L_passed_2e1852:;
+	t__2e1859 = (u64)(*(u64 *)t_param_2e1846);
+	t__2e1861 = (u64)(*(u64 *)t__2e1859);
+	t__2e1858 = (u64)((u64)t__2e1861 & (u64)((u64)18446744073709551614UL));
+	goto L__2e1847;
+	L__2e1847:;
+	t__2e1866 = (u64)(u32)(((u64)t__2e1858 == (u64)((u64)0UL)));
+	if ((u32)t__2e1866) goto L__2e1844; else goto L_next_2e1868;
+	L_next_2e1868:;
+	t__2e1872 = (u64)(u32)(((u64)t__2e1858 != (u64)((u64)0UL)));
+	if ((u32)t__2e1872) goto L_matches_2e1873; else goto L_next_2e1874;
+	L_matches_2e1873:;
+	*(u64 *)t_binding_2e1875 = (u64)t__2e1858;
+	t__2e1882 = (u64)(*(u64 *)t_binding_2e1875);
+	t__2e1881 = (u64)((u64)t__2e1882 % (u64)((u64)16UL));
+	t__2e1880 = (u64)(u32)(((u64)t__2e1881 == (u64)((u64)8UL)));
+	if ((u32)t__2e1880) goto L_passed_2e1879; else goto L_failed_2e1878;
+	L_failed_2e1878:;
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e1887)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)238UL), (u64)((u64)31UL), (u64)B11);
+	__builtin_trap();
+	L_passed_2e1879:;
+	t__2e1892 = (u64)(u32)(*(u8 *)t_param_2e1810);
+	t__2e1894 = (u64)(u32)((u8)t__2e1892);
+	t__2e1893 = (u64)(u32)(((u32)t__2e1894 == (u32)((u64)0UL)));
+	t__2e1895 = (u64)(u32)((u8)t__2e1893);
+	if ((u32)t__2e1895) goto L_true_2e1889; else goto L__2e1844;
+	L_true_2e1889:;
+	t__2e1896 = (u64)(*(u64 *)t_binding_2e1875);
+	((void (*)(u64, u32))((u64)((char *)&F_rt_2evalidatemeta)))((u64)t__2e1896, (u32)((u64)1UL));
+	goto L__2e1844;
+	L_next_2e1874:;
+	L__2e1898:;
+	goto L_abort_2e1901;
+	L__2e1844:;
+	return;
+	L_false_2e1826:;
+	L__2e1827:;
+	t__2e1910 = (u64)(*(u64 *)t_param_2e1809);
+	t_field_2e1911 = (u64)((u64)t__2e1910 + (u64)((u64)8UL));
+	t__2e1916 = (u64)(*(u64 *)t__2e1910);
+	t__2e1912 = t__2e1916;
+	t__2e1912 = (u64)((u64)t_field_2e1911 + (u64)t__2e1912);
+	*(u64 *)t_binding_2e1909 = (u64)t__2e1912;
+	t__2e1922 = (u64)(*(u64 *)t_param_2e1809);
+	t__2e1924 = (u64)(*(u64 *)t__2e1922);
+	t__2e1921 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_rt_2esize__islarge)))((u64)t__2e1924));
+	t__2e1925 = (u64)(u32)((u8)t__2e1921);
+	if ((u32)t__2e1925) goto L_true_2e1918; else goto L_false_2e1919;
+	L_true_2e1918:;
+	t__2e1933 = (u64)(*(u64 *)t_param_2e1809);
+	t_field_2e1934 = (u64)((u64)t__2e1933 + (u64)((u64)8UL));
+	t__2e1932 = (u64)((u64)t_field_2e1934 - (u64)((u64)16UL));
+	t__2e1931 = (u64)((u64)t__2e1932 % (u64)((u64)4096UL));
+	t__2e1930 = (u64)(u32)(((u64)t__2e1931 == (u64)((u64)0UL)));
+	if ((u32)t__2e1930) goto L_passed_2e1929; else goto L_failed_2e1928;
+	L_failed_2e1928:;
+	BLIT((u64)B12, ((u64)((char *)&D_strliteral_2e1939)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)248UL), (u64)((u64)23UL), (u64)B12);
+	__builtin_trap();
+	L_passed_2e1929:;
+	t__2e1946 = (u64)(*(u64 *)t_param_2e1809);
+	t__2e1948 = (u64)(*(u64 *)t__2e1946);
+	t__2e1945 = (u64)((u64)t__2e1948 + (u64)((u64)16UL));
+	t__2e1944 = (u64)((u64)t__2e1945 + (u64)((u64)8UL));
+	t__2e1943 = (u64)((u64)t__2e1944 & (u64)((u64)4095UL));
+	t__2e1942 = (u64)(u32)(((u64)t__2e1943 == (u64)((u64)0UL)));
+	if ((u32)t__2e1942) goto L_passed_2e1941; else goto L_failed_2e1940;
+	L_failed_2e1940:;
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e1950)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)250UL), (u64)((u64)23UL), (u64)B13);
+	__builtin_trap();
+	L_passed_2e1941:;
+	t__2e1954 = (u64)(*(u64 *)t_binding_2e1909);
+	t__2e1956 = (u64)(*(u64 *)t__2e1954);
+	t__2e1957 = (u64)(*(u64 *)t_param_2e1809);
+	t__2e1959 = (u64)(*(u64 *)t__2e1957);
+	t__2e1953 = (u64)(u32)(((u64)t__2e1956 == (u64)t__2e1959));
+	if ((u32)t__2e1953) goto L_passed_2e1952; else goto L_failed_2e1951;
+	L_failed_2e1951:;
+	BLIT((u64)B14, ((u64)((char *)&D_strliteral_2e1961)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)252UL), (u64)((u64)23UL), (u64)B14);
+	__builtin_trap();
+	L_passed_2e1952:;
+	return;
+	L_false_2e1919:;
+	L__2e1920:;
+	t__2e1968 = (u64)(*(u64 *)t_param_2e1809);
+	t__2e1970 = (u64)(*(u64 *)t__2e1968);
+	t__2e1967 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esize__getbin)))((u64)t__2e1970));
+	*(u64 *)t_param_2e1971 = (u64)t__2e1967;
+	t__2e1981 = (u64)(*(u64 *)t_param_2e1971);
+	t__2e1980 = (u64)(u32)(((u64)t__2e1981 == (u64)((u64)0UL)));
+	t__2e1982 = (u64)(u32)((u8)t__2e1980);
+	if ((u32)t__2e1982) goto L_true_2e1977; else goto L_false_2e1978;
+	L_true_2e1977:;
+	*(u64 *)t_binding_2e1976 = (u64)((u64)0UL);
+	goto L__2e1979;
+	L_false_2e1978:;
+	t__2e1985 = (u64)(*(u64 *)t_param_2e1971);
+	t__2e1984 = (u64)((u64)t__2e1985 - (u64)((u64)1UL));
+	t__2e1983 = (u64)((u64)((u64)1UL) << (t__2e1984 & 63));
+	*(u64 *)t_binding_2e1976 = (u64)t__2e1983;
+	L__2e1979:;
+	t__2e1989 = (u64)(*(u64 *)t_binding_2e1976);
+	t__2e1988 = (u64)((u64)t__2e1989 << (((u64)4UL) & 63));
+	t__2e1987 = (u64)((u64)t__2e1988 + (u64)((u64)16UL));
+	t__2e1986 = (u64)((u64)t__2e1987 - (u64)((u64)8UL));
+	goto L__2e1972;
+	L__2e1972:;
+	t__2e1992 = (u64)(*(u64 *)t_param_2e1809);
+	t__2e1994 = (u64)(*(u64 *)t__2e1992);
+	t__2e1966 = (u64)(u32)(((u64)t__2e1986 == (u64)t__2e1994));
+	if ((u32)t__2e1966) goto L_passed_2e1965; else goto L_failed_2e1964;
+	L_failed_2e1964:;
+	BLIT((u64)B15, ((u64)((char *)&D_strliteral_2e1996)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)257UL), (u64)((u64)15UL), (u64)B15);
+	__builtin_trap();
+	L_passed_2e1965:;
+	t__2e2003 = (u64)(*(u64 *)t_binding_2e1909);
+	t__2e2005 = (u64)(*(u64 *)t__2e2003);
+	t__2e2002 = (u64)((u64)t__2e2005 & (u64)((u64)1UL));
+	t__2e2001 = (u64)(u32)(((u64)t__2e2002 == (u64)((u64)1UL)));
+	t__2e2006 = (u64)(u32)((u8)t__2e2001);
+	if ((u32)t__2e2006) goto L_true_2e1998; else goto L_false_2e1999;
+	L_true_2e1998:;
+	t__2e2009 = (u64)(*(u64 *)t_binding_2e1909);
+	((void (*)(u64, u32))((u64)((char *)&F_rt_2evalidatemeta)))((u64)t__2e2009, (u32)((u64)0UL));
+	return;
+	L_false_2e1999:;
+	L__2e2000:;
+	t__2e2015 = (u64)(*(u64 *)t_binding_2e1909);
+	t__2e2017 = (u64)(*(u64 *)t__2e2015);
+	t__2e2014 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_rt_2esize__islarge)))((u64)t__2e2017));
+	t__2e2019 = (u64)(u32)((u8)t__2e2014);
+	t__2e2018 = (u64)(u32)(((u32)t__2e2019 == (u32)((u64)0UL)));
+	if ((u32)t__2e2018) goto L_passed_2e2013; else goto L_failed_2e2012;
+	L_failed_2e2012:;
+	BLIT((u64)B16, ((u64)((char *)&D_strliteral_2e2021)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)269UL), (u64)((u64)15UL), (u64)B16);
+	__builtin_trap();
+	L_passed_2e2013:;
+	t__2e2026 = (u64)(*(u64 *)t_binding_2e1909);
+	t__2e2028 = (u64)(*(u64 *)t__2e2026);
+	t__2e2025 = (u64)(((u64 (*)(u64))((u64)((char *)&F_rt_2esize__getbin)))((u64)t__2e2028));
+	*(u64 *)t_param_2e2029 = (u64)t__2e2025;
+	t__2e2039 = (u64)(*(u64 *)t_param_2e2029);
+	t__2e2038 = (u64)(u32)(((u64)t__2e2039 == (u64)((u64)0UL)));
+	t__2e2040 = (u64)(u32)((u8)t__2e2038);
+	if ((u32)t__2e2040) goto L_true_2e2035; else goto L_false_2e2036;
+	L_true_2e2035:;
+	*(u64 *)t_binding_2e2034 = (u64)((u64)0UL);
+	goto L__2e2037;
+	L_false_2e2036:;
+	t__2e2043 = (u64)(*(u64 *)t_param_2e2029);
+	t__2e2042 = (u64)((u64)t__2e2043 - (u64)((u64)1UL));
+	t__2e2041 = (u64)((u64)((u64)1UL) << (t__2e2042 & 63));
+	*(u64 *)t_binding_2e2034 = (u64)t__2e2041;
+	L__2e2037:;
+	t__2e2047 = (u64)(*(u64 *)t_binding_2e2034);
+	t__2e2046 = (u64)((u64)t__2e2047 << (((u64)4UL) & 63));
+	t__2e2045 = (u64)((u64)t__2e2046 + (u64)((u64)16UL));
+	t__2e2044 = (u64)((u64)t__2e2045 - (u64)((u64)8UL));
+	goto L__2e2030;
+	L__2e2030:;
+	t__2e2050 = (u64)(*(u64 *)t_binding_2e1909);
+	t__2e2052 = (u64)(*(u64 *)t__2e2050);
+	t__2e2024 = (u64)(u32)(((u64)t__2e2044 == (u64)t__2e2052));
+	if ((u32)t__2e2024) goto L__2e1812; else goto L_failed_2e2022;
+	L_failed_2e2022:;
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e2021)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)271UL), (u64)((u64)15UL), (u64)B17);
+	__builtin_trap();
+	L__2e1812:;
+	return;
+	L_abort_2e1901:;
+	t__2e1902 = ((u64)0UL);
+	t__2e1902 = (u64)((u64)((u64)((char *)&D_abortsites_2e1899)) + (u64)t__2e1902);
+	t__2e1903 = (u64)(*(u64 *)t__2e1902);
+	t__2e1904 = (u64)((u64)t__2e1902 + (u64)((u64)8UL));
+	t__2e1905 = (u64)(*(u32 *)t__2e1904);
+	t__2e1904 = (u64)((u64)t__2e1902 + (u64)((u64)12UL));
+	t__2e1906 = (u64)(*(u32 *)t__2e1904);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e1903, (u64)t__2e1905, (u64)t__2e1906, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_rt_2echeckpoison(u64 p_m, u64 p_sz) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	u64 t__2e2062;
+	u64 t__2e2070;
+	u64 t__2e2071;
+	u64 t__2e2072;
+	u64 t__2e2074;
+	u64 t__2e2075;
+	u64 t__2e2076;
+	u64 t__2e2078;
+	u64 t__2e2083;
+	u64 t__2e2089;
+	u64 t__2e2095;
+	u64 t__2e2101;
+	u64 t__2e2102;
+	u64 t__2e2103;
+	u64 t__2e2104;
+	u64 t__2e2105;
+	u64 t__2e2131;
+	u64 t__2e2132;
+	u64 t__2e2133;
+	u64 t__2e2138;
+	u64 t__2e2139;
+	u64 t__2e2141;
+	u64 t__2e2143;
+	u64 t__2e2144;
+	u64 t__2e2145;
+	u64 t__2e2150;
+	u64 t_binding_2e2092;
+	u64 t_binding_2e2130;
+	u64 t_field_2e2140;
+	u64 t_m;
+	u64 t_param_2e2055;
+	u64 t_param_2e2056;
+	u64 t_param_2e2063;
+	u64 t_sz;
+	t_m = (u64)p_m;
+	t_sz = (u64)p_sz;
+	L_start_2e2054:;
+	t_param_2e2055 = (u64)A0;
+	t_param_2e2056 = (u64)A1;
+	t_param_2e2063 = (u64)A2;
+	t_binding_2e2092 = (u64)A3;
+	t_binding_2e2130 = (u64)A4;
+	*(u64 *)t_param_2e2055 = (u64)t_m;
+	*(u64 *)t_param_2e2056 = (u64)t_sz;
+	L_body_2e2057:;
+	t__2e2062 = (u64)(*(u64 *)t_param_2e2055);
+	*(u64 *)t_param_2e2063 = (u64)t__2e2062;
+	t__2e2072 = (u64)(*(u64 *)t_param_2e2063);
+	t__2e2074 = (u64)(*(u64 *)t__2e2072);
+	t__2e2071 = (u64)((u64)t__2e2074 & (u64)((u64)1UL));
+	t__2e2070 = (u64)(u32)(((u64)t__2e2071 == (u64)((u64)1UL)));
+	if ((u32)t__2e2070) goto L_passed_2e2069; else goto L_failed_2e2068;
+	L_failed_2e2068:;
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e104)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)208UL), (u64)((u64)15UL), (u64)B5);
+	__builtin_trap();
+	L_passed_2e2069:;
+	t__2e2076 = (u64)(*(u64 *)t_param_2e2063);
+	t__2e2078 = (u64)(*(u64 *)t__2e2076);
+	t__2e2075 = (u64)((u64)t__2e2078 & (u64)((u64)18446744073709551614UL));
+	goto L__2e2064;
+	L__2e2064:;
+	t__2e2083 = (u64)(u32)(((u64)t__2e2075 == (u64)((u64)0UL)));
+	if ((u32)t__2e2083) goto L__2e2061; else goto L_next_2e2085;
+	L_next_2e2085:;
+	t__2e2089 = (u64)(u32)(((u64)t__2e2075 != (u64)((u64)0UL)));
+	if ((u32)t__2e2089) goto L_matches_2e2090; else goto L_next_2e2091;
+	L_matches_2e2090:;
+	*(u64 *)t_binding_2e2092 = (u64)t__2e2075;
+	t__2e2095 = (u64)(*(u64 *)t_binding_2e2092);
+	((void (*)(u64, u32))((u64)((char *)&F_rt_2evalidatemeta)))((u64)t__2e2095, (u32)((u64)0UL));
+	goto L__2e2061;
+	L_next_2e2091:;
+	L__2e2097:;
+	goto L_abort_2e2100;
+	L__2e2061:;
+	goto L_false_2e2108;
+	L_false_2e2108:;
+	L__2e2109:;
+	*(u64 *)t_binding_2e2130 = (u64)((u64)0UL);
+	L_loop_2e2125:;
+	t__2e2132 = (u64)(*(u64 *)t_binding_2e2130);
+	t__2e2133 = (u64)(*(u64 *)t_param_2e2056);
+	t__2e2131 = (u64)(u32)(((u64)t__2e2132 < (u64)t__2e2133));
+	if ((u32)t__2e2131) goto L_body_2e2126; else goto L__2e2058;
+	L_body_2e2126:;
+	t__2e2139 = (u64)(*(u64 *)t_param_2e2055);
+	t_field_2e2140 = (u64)((u64)t__2e2139 + (u64)((u64)8UL));
+	t__2e2143 = (u64)(*(u64 *)t_binding_2e2130);
+	t__2e2141 = t__2e2143;
+	t__2e2141 = (u64)((u64)t_field_2e2140 + (u64)t__2e2141);
+	t__2e2144 = (u64)(u32)(*(u8 *)t__2e2141);
+	t__2e2145 = (u64)(u32)((u8)t__2e2144);
+	t__2e2138 = (u64)(u32)(((u32)t__2e2145 == (u32)((u64)105UL)));
+	if ((u32)t__2e2138) goto L__2e2134; else goto L_failed_2e2136;
+	L_failed_2e2136:;
+	BLIT((u64)B6, ((u64)((char *)&D_strliteral_2e2148)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort)))((u64)((u64)((char *)&D_strliteral_2e15)), (u64)((u64)288UL), (u64)((u64)23UL), (u64)B6);
+	__builtin_trap();
+	L__2e2134:;
+	L_after_2e2129:;
+	t__2e2150 = (u64)(*(u64 *)t_binding_2e2130);
+	t__2e2150 = (u64)((u64)t__2e2150 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e2130 = (u64)t__2e2150;
+	goto L_loop_2e2125;
+	L__2e2058:;
+	return;
+	L_abort_2e2100:;
+	t__2e2101 = ((u64)0UL);
+	t__2e2101 = (u64)((u64)((u64)((char *)&D_abortsites_2e2098)) + (u64)t__2e2101);
+	t__2e2102 = (u64)(*(u64 *)t__2e2101);
+	t__2e2103 = (u64)((u64)t__2e2101 + (u64)((u64)8UL));
+	t__2e2104 = (u64)(*(u32 *)t__2e2103);
+	t__2e2103 = (u64)((u64)t__2e2101 + (u64)((u64)12UL));
+	t__2e2105 = (u64)(*(u32 *)t__2e2103);
+	((void (*)(u64, u64, u64, u64))((u64)((char *)&F_rt_2eabort__fixed)))((u64)t__2e2102, (u64)t__2e2104, (u64)t__2e2105, (u64)((u64)4UL));
+	__builtin_trap();
+}
@@ -0,0 +1,2207 @@
+	.file	"rtmem.qbe.c"
+	.text
+	.type	BLIT, @function
+BLIT:
+	testq	%rdx, %rdx
+	je	.L1
+	addq	%rsi, %rdx
+	movq	%rsi, %rax
+	subq	%rsi, %rdi
+.L3:
+	leaq	(%rdi,%rax), %rcx
+	movzbl	(%rax), %esi
+	movb	%sil, (%rcx)
+	addq	$1, %rax
+	cmpq	%rdx, %rax
+	jne	.L3
+.L1:
+	ret
+	.size	BLIT, .-BLIT
+	.section	.text.rt.mprotect,"ax",@progbits
+	.globl	rt.mprotect
+	.type	rt.mprotect, @function
+rt.mprotect:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movl	%edx, %ecx
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	movl	$10, %edi
+	movabsq	$rt.syscall3, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.mprotect, .-rt.mprotect
+	.section	.text.rt.munmap,"ax",@progbits
+	.globl	rt.munmap
+	.type	rt.munmap, @function
+rt.munmap:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	movl	$11, %edi
+	movabsq	$rt.syscall2, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.munmap, .-rt.munmap
+	.section	.text.rt.mmap,"ax",@progbits
+	.globl	rt.mmap
+	.type	rt.mmap, @function
+rt.mmap:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	movq	%rdi, %r12
+	movl	%ecx, %ebx
+	movl	%edx, %ecx
+	subq	$8, %rsp
+	pushq	%r9
+	movslq	%r8d, %r9
+	movl	%ebx, %r8d
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	movl	$9, %edi
+	movabsq	$rt.syscall6, %rax
+	call	*%rax
+	addq	$16, %rsp
+	cmpl	$-1, %eax
+	je	.L12
+.L10:
+.L9:
+	leaq	-16(%rbp), %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L12:
+	testq	%r12, %r12
+	jne	.L9
+	testb	$32, %bl
+	je	.L9
+	testb	$16, %bl
+	movq	$-12, %rdx
+	cmove	%rdx, %rax
+	jmp	.L9
+	.size	rt.mmap, .-rt.mmap
+	.section	.text.rt.pipe2,"ax",@progbits
+	.globl	rt.pipe2
+	.type	rt.pipe2, @function
+rt.pipe2:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%esi, %rdx
+	movq	%rdi, %rsi
+	movl	$293, %edi
+	movabsq	$rt.syscall2, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.pipe2, .-rt.pipe2
+	.section	.text.rt.kill,"ax",@progbits
+	.globl	rt.kill
+	.type	rt.kill, @function
+rt.kill:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%esi, %rdx
+	movslq	%edi, %rsi
+	movl	$62, %edi
+	movabsq	$rt.syscall2, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.kill, .-rt.kill
+	.section	.text.rt.wifsignaled,"ax",@progbits
+	.globl	rt.wifsignaled
+	.type	rt.wifsignaled, @function
+rt.wifsignaled:
+	movzwl	%di, %edi
+	subl	$1, %edi
+	cmpl	$254, %edi
+	setle	%al
+	movzbl	%al, %eax
+	ret
+	.size	rt.wifsignaled, .-rt.wifsignaled
+	.section	.text.rt.wtermsig,"ax",@progbits
+	.globl	rt.wtermsig
+	.type	rt.wtermsig, @function
+rt.wtermsig:
+	movl	%edi, %eax
+	andl	$127, %eax
+	ret
+	.size	rt.wtermsig, .-rt.wtermsig
+	.section	.text.rt.wexitstatus,"ax",@progbits
+	.globl	rt.wexitstatus
+	.type	rt.wexitstatus, @function
+rt.wexitstatus:
+	movl	%edi, %eax
+	movzbl	%ah, %eax
+	ret
+	.size	rt.wexitstatus, .-rt.wexitstatus
+	.section	.text.rt.wifexited,"ax",@progbits
+	.globl	rt.wifexited
+	.type	rt.wifexited, @function
+rt.wifexited:
+	testb	$127, %dil
+	sete	%al
+	movzbl	%al, %eax
+	ret
+	.size	rt.wifexited, .-rt.wifexited
+	.section	.text.rt.wait4,"ax",@progbits
+	.globl	rt.wait4
+	.type	rt.wait4, @function
+rt.wait4:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	%rsi, %rax
+	movq	%rcx, %r8
+	movslq	%edx, %rcx
+	movslq	%edi, %rsi
+	movq	%rax, %rdx
+	movl	$61, %edi
+	movabsq	$rt.syscall4, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.wait4, .-rt.wait4
+	.section	.text.rt.execve,"ax",@progbits
+	.globl	rt.execve
+	.type	rt.execve, @function
+rt.execve:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	%rdx, %rcx
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	movl	$59, %edi
+	movabsq	$rt.syscall3, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.execve, .-rt.execve
+	.section	.text.rt.fork,"ax",@progbits
+	.globl	rt.fork
+	.type	rt.fork, @function
+rt.fork:
+	pushq	%rbp
+	movq	%rsp, %rbp
+.L26:
+	movl	$0, %edx
+	movl	$17, %esi
+	movl	$56, %edi
+	movabsq	$rt.syscall2, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.fork, .-rt.fork
+	.section	.text.rt.getpid,"ax",@progbits
+	.globl	rt.getpid
+	.type	rt.getpid, @function
+rt.getpid:
+	pushq	%rbp
+	movq	%rsp, %rbp
+.L29:
+	movl	$39, %edi
+	movabsq	$rt.syscall0, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.getpid, .-rt.getpid
+	.section	.text.rt.dup2,"ax",@progbits
+	.globl	rt.dup2
+	.type	rt.dup2, @function
+rt.dup2:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%esi, %rdx
+	movslq	%edi, %rsi
+	movl	$0, %ecx
+	movl	$292, %edi
+	movabsq	$rt.syscall3, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.dup2, .-rt.dup2
+	.section	.text.rt.dup3,"ax",@progbits
+	.globl	rt.dup3
+	.type	rt.dup3, @function
+rt.dup3:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%edx, %rcx
+	movslq	%esi, %rdx
+	movslq	%edi, %rsi
+	movl	$292, %edi
+	movabsq	$rt.syscall3, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.dup3, .-rt.dup3
+	.section	.text.rt.close,"ax",@progbits
+	.globl	rt.close
+	.type	rt.close, @function
+rt.close:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%edi, %rsi
+	movl	$3, %edi
+	movabsq	$rt.syscall1, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.close, .-rt.close
+	.section	.text.rt.write,"ax",@progbits
+	.globl	rt.write
+	.type	rt.write, @function
+rt.write:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	%rsi, %rax
+	movq	%rdx, %rcx
+	movslq	%edi, %rsi
+	movq	%rax, %rdx
+	movl	$1, %edi
+	movabsq	$rt.syscall3, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.write, .-rt.write
+	.section	.text.rt.memset,"ax",@progbits
+	.globl	rt.memset
+	.type	rt.memset, @function
+rt.memset:
+	movq	%rdx, %r8
+	movl	%esi, %r9d
+	movl	$0, %eax
+	cmpq	$15, %rdx
+	jbe	.L58
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	movq	%rdi, %r11
+	andl	$7, %r11d
+	je	.L41
+	movq	%rdi, %rcx
+.L42:
+	movb	%r9b, (%rcx)
+	movq	%rcx, %rax
+	addq	$1, %rcx
+	movq	%rcx, %rbx
+	andl	$7, %ebx
+	jne	.L42
+	subq	%rdi, %rax
+	leaq	1(%rax), %r11
+	movzbl	%sil, %edx
+	movabsq	$72340172838076673, %rax
+	imulq	%rax, %rdx
+	movq	%r8, %rax
+	subq	%r11, %rax
+	movq	%rax, %r12
+	shrq	$3, %r12
+	cmpq	$31, %rax
+	jbe	.L47
+.L43:
+	movq	%rcx, %rsi
+	movl	$4, %r10d
+.L46:
+	movq	%rdx, (%rsi)
+	movq	%rdx, 8(%rsi)
+	movq	%rdx, 16(%rsi)
+	movq	%rdx, 24(%rsi)
+	movq	%r10, %rbx
+	addq	$4, %r10
+	addq	$32, %rsi
+	cmpq	%r10, %r12
+	jnb	.L46
+.L47:
+	cmpq	%r12, %rbx
+	jnb	.L45
+.L44:
+	leaq	(%rcx,%rbx,8), %rsi
+	leaq	(%rcx,%r12,8), %rcx
+.L48:
+	movq	%rdx, (%rsi)
+	addq	$8, %rsi
+	cmpq	%rsi, %rcx
+	jne	.L48
+.L45:
+	andq	$-8, %rax
+	addq	%r11, %rax
+	cmpq	%r8, %rax
+	jnb	.L39
+	addq	%rdi, %rax
+	addq	%rdi, %r8
+.L50:
+	movb	%r9b, (%rax)
+	addq	$1, %rax
+	cmpq	%r8, %rax
+	jne	.L50
+.L39:
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L41:
+	movzbl	%sil, %edx
+	movabsq	$72340172838076673, %rax
+	imulq	%rax, %rdx
+	movq	%r8, %r12
+	shrq	$3, %r12
+	movq	%rdi, %rcx
+	movq	%r8, %rax
+	movq	%r11, %rbx
+	cmpq	$31, %r8
+	ja	.L43
+	jmp	.L44
+.L58:
+	cmpq	%rdx, %rax
+	jnb	.L60
+	addq	%rdi, %rax
+	addq	%rdi, %r8
+.L61:
+	movb	%r9b, (%rax)
+	addq	$1, %rax
+	cmpq	%r8, %rax
+	jne	.L61
+.L60:
+	ret
+	.size	rt.memset, .-rt.memset
+	.section	.text.rt.memcpy,"ax",@progbits
+	.globl	rt.memcpy
+	.type	rt.memcpy, @function
+rt.memcpy:
+	movq	%rdi, %r9
+	movq	%rsi, %r10
+	movq	%rdx, %r11
+	cmpq	$15, %rdx
+	jbe	.L78
+	movq	%rdi, %rax
+	xorq	%rsi, %rax
+	testb	$7, %al
+	jne	.L79
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	movq	%rdi, %rbx
+	andl	$7, %ebx
+	je	.L68
+	movq	%rdi, %rdx
+	movq	%rsi, %rcx
+	subq	%rdi, %rcx
+.L69:
+	movzbl	(%rcx,%rdx), %eax
+	movb	%al, (%rdx)
+	movq	%rdx, %rax
+	addq	$1, %rdx
+	movq	%rdx, %r8
+	andl	$7, %r8d
+	jne	.L69
+	subq	%r9, %rax
+	leaq	1(%rax), %rbx
+	leaq	(%r10,%rbx), %r13
+	movq	%r11, %rax
+	subq	%rbx, %rax
+	movq	%rax, %r12
+	shrq	$3, %r12
+	cmpq	$31, %rax
+	jbe	.L74
+.L70:
+	movq	%rdx, %rsi
+	movq	%r13, %rcx
+	movl	$4, %edi
+.L73:
+	movq	(%rcx), %r8
+	movq	%r8, (%rsi)
+	movq	8(%rcx), %r8
+	movq	%r8, 8(%rsi)
+	movq	16(%rcx), %r8
+	movq	%r8, 16(%rsi)
+	movq	24(%rcx), %r8
+	movq	%r8, 24(%rsi)
+	movq	%rdi, %r8
+	addq	$4, %rdi
+	addq	$32, %rcx
+	addq	$32, %rsi
+	cmpq	%rdi, %r12
+	jnb	.L73
+.L74:
+	cmpq	%r12, %r8
+	jnb	.L72
+.L71:
+	leaq	0(%r13,%r8,8), %rcx
+	leaq	0(%r13,%r12,8), %rdi
+	subq	%r13, %rdx
+.L75:
+	movq	(%rcx), %rsi
+	movq	%rsi, (%rdx,%rcx)
+	addq	$8, %rcx
+	cmpq	%rdi, %rcx
+	jne	.L75
+.L72:
+	andq	$-8, %rax
+	addq	%rbx, %rax
+	cmpq	%r11, %rax
+	jnb	.L65
+	addq	%r10, %rax
+	leaq	(%r10,%r11), %rsi
+	movq	%r9, %rcx
+	subq	%r10, %rcx
+.L77:
+	movzbl	(%rax), %edx
+	movb	%dl, (%rcx,%rax)
+	addq	$1, %rax
+	cmpq	%rax, %rsi
+	jne	.L77
+.L65:
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	ret
+.L79:
+	movl	$0, %eax
+	jmp	.L87
+.L68:
+	movq	%rdx, %r12
+	shrq	$3, %r12
+	movq	%rdi, %rdx
+	movq	%r11, %rax
+	movq	%rsi, %r13
+	movq	%rbx, %r8
+	cmpq	$31, %r11
+	ja	.L70
+	jmp	.L71
+.L78:
+	movl	$0, %eax
+	cmpq	%rdx, %rax
+	jnb	.L89
+.L87:
+	addq	%r10, %rax
+	leaq	(%r10,%r11), %rsi
+	movq	%r9, %rcx
+	subq	%r10, %rcx
+.L90:
+	movzbl	(%rax), %edx
+	movb	%dl, (%rcx,%rax)
+	addq	$1, %rax
+	cmpq	%rax, %rsi
+	jne	.L90
+.L89:
+	ret
+	.size	rt.memcpy, .-rt.memcpy
+	.section	.text.rt.memmove,"ax",@progbits
+	.globl	rt.memmove
+	.type	rt.memmove, @function
+rt.memmove:
+	cmpq	%rsi, %rdi
+	je	.L111
+	jb	.L114
+	cmpq	$15, %rdx
+	jbe	.L97
+	movq	%rdi, %rax
+	xorq	%rsi, %rax
+	testb	$7, %al
+	jne	.L98
+	movq	%rdi, %r9
+	negq	%r9
+	andl	$7, %r9d
+	movq	%rdx, %rax
+	subq	%r9, %rax
+	movq	%rax, %rcx
+	shrq	$3, %rcx
+	andq	$-8, %rax
+	orq	%r9, %rax
+	movq	%rax, %r8
+	cmpq	%rdx, %rax
+	jnb	.L99
+	leaq	-1(%rsi,%rdx), %rax
+	leaq	-1(%r8,%rsi), %r10
+	movq	%rdi, %r8
+	subq	%rsi, %r8
+.L100:
+	movzbl	(%rax), %edx
+	movb	%dl, (%r8,%rax)
+	subq	$1, %rax
+	cmpq	%r10, %rax
+	jne	.L100
+.L99:
+	leaq	(%rdi,%r9), %rdx
+	leaq	(%rsi,%r9), %r11
+	cmpq	$3, %rcx
+	jbe	.L101
+	leaq	-8(,%rcx,8), %r8
+	leaq	(%r11,%r8), %rax
+	addq	%r8, %rdx
+	leaq	-40(%r11,%rcx,8), %r10
+	leaq	-32(,%rcx,8), %r8
+	andq	$-32, %r8
+	subq	%r8, %r10
+.L102:
+	movq	(%rax), %r8
+	movq	%r8, (%rdx)
+	movq	-8(%rax), %r8
+	movq	%r8, -8(%rdx)
+	movq	-16(%rax), %r8
+	movq	%r8, -16(%rdx)
+	movq	-24(%rax), %r8
+	movq	%r8, -24(%rdx)
+	subq	$32, %rax
+	subq	$32, %rdx
+	cmpq	%r10, %rax
+	jne	.L102
+	andl	$3, %ecx
+	je	.L103
+.L101:
+	leaq	-8(%r11,%rcx,8), %rax
+	movq	%rdi, %r8
+	subq	%rsi, %r8
+.L104:
+	movq	(%rax), %rdx
+	movq	%rdx, (%r8,%rax)
+	subq	$8, %rax
+	subq	$1, %rcx
+	jne	.L104
+.L103:
+	movq	%r9, %rdx
+.L97:
+	testq	%rdx, %rdx
+	je	.L111
+.L98:
+	leaq	-1(%rsi,%rdx), %rax
+	subq	%rsi, %rdi
+.L105:
+	movzbl	(%rax), %edx
+	movb	%dl, (%rdi,%rax)
+	movq	%rax, %rdx
+	subq	$1, %rax
+	cmpq	%rsi, %rdx
+	jne	.L105
+	ret
+.L114:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movabsq	$rt.memcpy, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+.L111:
+	ret
+	.size	rt.memmove, .-rt.memmove
+	.section	.text.rt.toutf8,"ax",@progbits
+	.globl	rt.toutf8
+	.type	rt.toutf8, @function
+rt.toutf8:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%rbx
+	subq	$8, %rsp
+	movq	%rdi, %rbx
+	movl	$24, %edx
+	movabsq	$BLIT, %rax
+	call	*%rax
+	movq	%rbx, %rax
+	movq	-8(%rbp), %rbx
+	leave
+	ret
+	.size	rt.toutf8, .-rt.toutf8
+	.section	.text.rt.u64tos,"ax",@progbits
+	.type	rt.u64tos, @function
+rt.u64tos:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%rbx
+	subq	$56, %rsp
+	movq	%rdi, %rbx
+	movabsq	$static.2, %rax
+	movq	%rax, -48(%rbp)
+	movq	$0, -40(%rbp)
+	movq	$20, -32(%rbp)
+	movq	%rsi, %rcx
+	movabsq	$-3689348814741910323, %rdi
+	testq	%rsi, %rsi
+	jne	.L118
+	movq	-40(%rbp), %rax
+	leaq	1(%rax), %rdx
+	movq	%rdx, -40(%rbp)
+	cmpq	%rdx, -32(%rbp)
+	jb	.L126
+	movq	-48(%rbp), %rdx
+	movb	$48, (%rdx,%rax)
+	jmp	.L120
+.L127:
+	movq	%rdx, %rcx
+.L118:
+	movq	-40(%rbp), %rsi
+	movq	%rcx, %rax
+	mulq	%rdi
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rdx
+	addq	%rdx, %rdx
+	movq	%rcx, %rax
+	subq	%rdx, %rax
+	addl	$48, %eax
+	leaq	1(%rsi), %rdx
+	movq	%rdx, -40(%rbp)
+	cmpq	%rdx, -32(%rbp)
+	jb	.L136
+	movq	-48(%rbp), %rdx
+	movb	%al, (%rdx,%rsi)
+	movq	%rcx, %rax
+	mulq	%rdi
+	shrq	$3, %rdx
+	cmpq	$9, %rcx
+	ja	.L127
+.L120:
+	movq	-40(%rbp), %rax
+	movl	$0, %edx
+	movq	-48(%rbp), %rcx
+	leaq	-1(%rax,%rcx), %rdi
+	subq	$1, %rax
+	je	.L123
+.L125:
+	movq	-40(%rbp), %rcx
+	cmpq	%rcx, %rdx
+	jnb	.L137
+	movq	%rdi, %rsi
+	subq	%rax, %rsi
+	movzbl	(%rsi), %r8d
+	cmpq	%rcx, %rax
+	jnb	.L128
+	movq	%rdi, %rcx
+	subq	%rdx, %rcx
+	movzbl	(%rcx), %r9d
+	movb	%r9b, (%rsi)
+	cmpq	-40(%rbp), %rax
+	jnb	.L129
+	movb	%r8b, (%rcx)
+	addq	$1, %rdx
+	subq	$1, %rax
+	cmpq	%rax, %rdx
+	jb	.L125
+.L123:
+	movq	-48(%rbp), %rax
+	movq	%rax, -64(%rbp)
+	movq	-40(%rbp), %rax
+	movq	%rax, -56(%rbp)
+	movl	$16, %edx
+	leaq	-64(%rbp), %rsi
+	movq	%rbx, %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	movq	%rbx, %rax
+	movq	-8(%rbp), %rbx
+	leave
+	ret
+.L136:
+	movl	$2, %eax
+	jmp	.L119
+.L137:
+	movl	$3, %eax
+.L119:
+	salq	$4, %rax
+	movabsq	$abortsites.1530, %rdx
+	addq	%rdx, %rax
+	movl	12(%rax), %edx
+	movl	8(%rax), %esi
+	movq	(%rax), %rdi
+	movl	$0, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+.L126:
+	movl	$1, %eax
+	jmp	.L119
+.L128:
+	movl	$4, %eax
+	jmp	.L119
+.L129:
+	movl	$5, %eax
+	jmp	.L119
+	.size	rt.u64tos, .-rt.u64tos
+	.section	.text.rt.abort,"ax",@progbits
+	.globl	rt.abort
+	.type	rt.abort, @function
+rt.abort:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$376, %rsp
+	movq	%rdi, %r14
+	movq	%rsi, %r15
+	movq	%rdx, -408(%rbp)
+	movq	%rcx, %r13
+	movl	$24, %edx
+	movabsq	$strliteral.1381, %rsi
+	leaq	-80(%rbp), %rdi
+	movabsq	$BLIT, %rbx
+	call	*%rbx
+	movl	$24, %edx
+	movabsq	$strliteral.1385, %rsi
+	leaq	-112(%rbp), %rdi
+	call	*%rbx
+	movl	$24, %edx
+	movabsq	$strliteral.1388, %rsi
+	leaq	-144(%rbp), %rdi
+	call	*%rbx
+	movl	$24, %edx
+	leaq	-80(%rbp), %rax
+	movq	%rax, %rsi
+	leaq	-176(%rbp), %rdi
+	call	*%rbx
+	movq	-72(%rbp), %rdx
+	movq	-176(%rbp), %rsi
+	movl	$2, %edi
+	movabsq	$rt.write, %r12
+	call	*%r12
+	movl	$24, %edx
+	movq	%r14, %rsi
+	leaq	-208(%rbp), %rdi
+	call	*%rbx
+	movq	8(%r14), %rdx
+	movq	-208(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	leaq	-112(%rbp), %rax
+	movq	%rax, %rsi
+	leaq	-240(%rbp), %rdi
+	call	*%rbx
+	movq	-104(%rbp), %rdx
+	movq	-240(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movq	%r15, %rsi
+	leaq	-384(%rbp), %rdi
+	movabsq	$rt.u64tos, %r14
+	call	*%r14
+	movq	8(%rax), %rdx
+	movq	(%rax), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	leaq	-112(%rbp), %rax
+	movq	%rax, %rsi
+	leaq	-272(%rbp), %rdi
+	call	*%rbx
+	movq	-104(%rbp), %rdx
+	movq	-272(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movq	-408(%rbp), %rsi
+	leaq	-400(%rbp), %rdi
+	call	*%r14
+	movq	8(%rax), %rdx
+	movq	(%rax), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	leaq	-144(%rbp), %rsi
+	leaq	-304(%rbp), %rdi
+	call	*%rbx
+	movq	-136(%rbp), %rdx
+	movq	-304(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	movq	%r13, %rsi
+	leaq	-336(%rbp), %rdi
+	call	*%rbx
+	movq	8(%r13), %rdx
+	movq	-336(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movl	$24, %edx
+	movabsq	$strliteral.1499, %rsi
+	leaq	-368(%rbp), %rdi
+	call	*%rbx
+	movl	$1, %edx
+	movq	-368(%rbp), %rsi
+	movl	$2, %edi
+	call	*%r12
+	movabsq	$rt.getpid, %rax
+	call	*%rax
+	movl	%eax, %edi
+	movl	$6, %esi
+	movabsq	$rt.kill, %rax
+	call	*%rax
+	addq	$376, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	ret
+	.size	rt.abort, .-rt.abort
+	.section	.text.rt.abort_fixed,"ax",@progbits
+	.globl	rt.abort_fixed
+	.type	rt.abort_fixed, @function
+rt.abort_fixed:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$40, %rsp
+	movq	%rsi, %r12
+	movq	%rdx, %r13
+	leaq	(%rcx,%rcx,2), %rdx
+	movabsq	$rt.reasons, %rax
+	leaq	(%rax,%rdx,8), %rsi
+	cmpq	$7, %rcx
+	ja	.L141
+	movq	%rdi, %rbx
+	movl	$24, %edx
+	leaq	-64(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-64(%rbp), %rcx
+	movq	%r13, %rdx
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	addq	$40, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	ret
+.L141:
+	movabsq	$abortsites.1363, %rax
+	movl	12(%rax), %edx
+	movl	8(%rax), %esi
+	movl	$0, %ecx
+	movq	(%rax), %rdi
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+	.size	rt.abort_fixed, .-rt.abort_fixed
+	.section	.text.rt.exit,"ax",@progbits
+	.globl	rt.exit
+	.type	rt.exit, @function
+rt.exit:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movslq	%edi, %rsi
+	movl	$60, %edi
+	movabsq	$rt.syscall1, %rax
+	call	*%rax
+	movabsq	$abortsites.767, %rax
+	movl	12(%rax), %edx
+	movl	8(%rax), %esi
+	movq	(%rax), %rdi
+	movl	$6, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+	.size	rt.exit, .-rt.exit
+	.section	.text.rt.segmalloc,"ax",@progbits
+	.type	rt.segmalloc, @function
+rt.segmalloc:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	%rdi, %rsi
+	movl	$0, %r9d
+	movl	$-1, %r8d
+	movl	$34, %ecx
+	movl	$3, %edx
+	movl	$0, %edi
+	movabsq	$rt.mmap, %rax
+	call	*%rax
+	cmpl	$-12, %eax
+	movl	$0, %edx
+	cmove	%rdx, %rax
+	popq	%rbp
+	ret
+.L147:
+	.size	rt.segmalloc, .-rt.segmalloc
+	.section	.text.rt.size_getbin,"ax",@progbits
+	.type	rt.size_getbin, @function
+rt.size_getbin:
+	leaq	7(%rdi), %rax
+	shrq	$4, %rax
+	je	.L149
+	cmpq	$1, %rax
+	jbe	.L153
+	movl	$0, %ecx
+	movl	$1, %esi
+.L152:
+	addq	$1, %rcx
+	movq	%rsi, %rdx
+	salq	%cl, %rdx
+	cmpq	%rax, %rdx
+	jb	.L152
+.L151:
+	leaq	1(%rcx), %rax
+.L149:
+	ret
+.L153:
+	movl	$0, %ecx
+	jmp	.L151
+	.size	rt.size_getbin, .-rt.size_getbin
+	.section	.text.rt.segfree,"ax",@progbits
+	.type	rt.segfree, @function
+rt.segfree:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movabsq	$rt.munmap, %rax
+	call	*%rax
+	popq	%rbp
+	ret
+	.size	rt.segfree, .-rt.segfree
+	.section	.text.rt.size_islarge,"ax",@progbits
+	.type	rt.size_islarge, @function
+rt.size_islarge:
+	cmpq	$2056, %rdi
+	seta	%al
+	movzbl	%al, %eax
+	ret
+	.size	rt.size_islarge, .-rt.size_islarge
+	.section	.text.rt.realsz,"ax",@progbits
+	.type	rt.realsz, @function
+rt.realsz:
+	cmpq	$2056, %rdi
+	jbe	.L159
+	leaq	24(%rdi), %rax
+	andl	$4095, %eax
+	leaq	4120(%rdi), %rdx
+	subq	%rax, %rdx
+	addq	$24, %rdi
+	testq	%rax, %rax
+	movq	%rdx, %rax
+	cmove	%rdi, %rax
+.L161:
+	subq	$24, %rax
+	ret
+.L159:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movabsq	$rt.size_getbin, %rax
+	call	*%rax
+	testq	%rax, %rax
+	je	.L162
+	leaq	-1(%rax), %rcx
+	movl	$1, %eax
+	salq	%cl, %rax
+.L162:
+	salq	$4, %rax
+	addq	$8, %rax
+	popq	%rbp
+	ret
+	.size	rt.realsz, .-rt.realsz
+	.section	.text.rt.validatemeta,"ax",@progbits
+	.type	rt.validatemeta, @function
+rt.validatemeta:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	subq	$288, %rsp
+	leaq	8(%rdi), %rax
+	testb	$15, %al
+	jne	.L169
+	movq	(%rdi), %rbx
+	testb	$1, %bl
+	jne	.L170
+	cmpb	$1, %sil
+	je	.L172
+	leaq	(%rax,%rbx), %r12
+	cmpq	$2056, %rbx
+	jbe	.L202
+	subq	$8, %rdi
+	testl	$4095, %edi
+	jne	.L203
+	leaq	24(%rbx), %rax
+	testl	$4095, %eax
+	jne	.L204
+	cmpq	(%r12), %rbx
+	jne	.L205
+.L168:
+	addq	$288, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L169:
+	movl	$24, %edx
+	movabsq	$strliteral.1823, %rsi
+	leaq	-48(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-48(%rbp), %rcx
+	movl	$15, %edx
+	movl	$228, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L172:
+	movl	$24, %edx
+	movabsq	$strliteral.104, %rsi
+	leaq	-80(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-80(%rbp), %rcx
+	movl	$15, %edx
+	movl	$208, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L175:
+	movl	$24, %edx
+	movabsq	$strliteral.1887, %rsi
+	leaq	-112(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-112(%rbp), %rcx
+	movl	$31, %edx
+	movl	$238, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L202:
+	movq	%rbx, %rdi
+	movabsq	$rt.size_getbin, %rax
+	call	*%rax
+	testq	%rax, %rax
+	je	.L180
+	leaq	-1(%rax), %rcx
+	movl	$1, %eax
+	salq	%cl, %rax
+.L180:
+	salq	$4, %rax
+	addq	$8, %rax
+	cmpq	%rax, %rbx
+	jne	.L185
+	movq	(%r12), %rbx
+	testb	$1, %bl
+	jne	.L206
+	cmpq	$2056, %rbx
+	ja	.L188
+	movq	%rbx, %rdi
+	movabsq	$rt.size_getbin, %rax
+	call	*%rax
+	testq	%rax, %rax
+	je	.L189
+	leaq	-1(%rax), %rcx
+	movl	$1, %eax
+	salq	%cl, %rax
+.L189:
+	salq	$4, %rax
+	addq	$8, %rax
+	cmpq	%rax, %rbx
+	je	.L168
+	movl	$24, %edx
+	movabsq	$strliteral.2021, %rsi
+	leaq	-304(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-304(%rbp), %rcx
+	movl	$15, %edx
+	movl	$271, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L203:
+	movl	$24, %edx
+	movabsq	$strliteral.1939, %rsi
+	leaq	-144(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-144(%rbp), %rcx
+	movl	$23, %edx
+	movl	$248, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L204:
+	movl	$24, %edx
+	movabsq	$strliteral.1950, %rsi
+	leaq	-176(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-176(%rbp), %rcx
+	movl	$23, %edx
+	movl	$250, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L205:
+	movl	$24, %edx
+	movabsq	$strliteral.1961, %rsi
+	leaq	-208(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-208(%rbp), %rcx
+	movl	$23, %edx
+	movl	$252, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L185:
+	movl	$24, %edx
+	movabsq	$strliteral.1996, %rsi
+	leaq	-240(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-240(%rbp), %rcx
+	movl	$15, %edx
+	movl	$257, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L206:
+	movl	$0, %esi
+	movq	%r12, %rdi
+	movabsq	$rt.validatemeta, %rax
+	call	*%rax
+	jmp	.L168
+.L188:
+	movl	$24, %edx
+	movabsq	$strliteral.2021, %rsi
+	leaq	-272(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-272(%rbp), %rcx
+	movl	$15, %edx
+	movl	$269, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L177:
+.L170:
+	movq	%rbx, %rdi
+	andq	$-2, %rdi
+	je	.L168
+	andl	$14, %ebx
+	cmpq	$8, %rbx
+	jne	.L175
+	testb	%sil, %sil
+	jne	.L168
+	movl	$1, %esi
+	movabsq	$rt.validatemeta, %rax
+	call	*%rax
+	jmp	.L168
+	.size	rt.validatemeta, .-rt.validatemeta
+	.section	.text.rt.getmeta,"ax",@progbits
+	.globl	rt.getmeta
+	.type	rt.getmeta, @function
+rt.getmeta:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	subq	$32, %rsp
+	movq	%rdi, %rbx
+	leaq	-8(%rdi), %r12
+	movl	$0, %esi
+	movq	%r12, %rdi
+	movabsq	$rt.validatemeta, %rax
+	call	*%rax
+	testb	$1, -8(%rbx)
+	jne	.L211
+	movq	%r12, %rax
+	addq	$32, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L211:
+	movl	$24, %edx
+	movabsq	$strliteral.137, %rsi
+	leaq	-48(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-48(%rbp), %rcx
+	movl	$15, %edx
+	movl	$171, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+	.size	rt.getmeta, .-rt.getmeta
+	.section	.text.rt.free,"ax",@progbits
+	.globl	rt.free
+	.type	rt.free, @function
+rt.free:
+	testq	%rdi, %rdi
+	jne	.L221
+	ret
+.L221:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$8, %rsp
+	movq	%rdi, %rbx
+	movabsq	$rt.getmeta, %rax
+	call	*%rax
+	movq	%rax, %r12
+	movabsq	$rt.cur_allocs, %rax
+	subq	$1, (%rax)
+	movq	(%r12), %r13
+	cmpq	$2056, %r13
+	jbe	.L214
+	leaq	24(%r13), %rsi
+	leaq	-16(%rbx), %rdi
+	movabsq	$rt.segfree, %rax
+	call	*%rax
+.L213:
+.L212:
+	addq	$8, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%rbp
+	ret
+.L214:
+	movq	%r13, %rdi
+	movabsq	$rt.size_getbin, %rax
+	call	*%rax
+	movq	%rax, %rbx
+	testq	%r13, %r13
+	jne	.L222
+.L215:
+	movabsq	$rt.bins, %rax
+	leaq	(%rax,%rbx,8), %rdx
+	cmpq	$8, %rbx
+	ja	.L216
+	movq	(%rdx), %rax
+	orq	$1, %rax
+	movq	%rax, (%r12)
+	movq	%r12, (%rdx)
+	jmp	.L212
+.L222:
+	leaq	8(%r12), %rsi
+	movb	$105, 8(%r12)
+	leaq	-1(%r13), %rdx
+	leaq	9(%r12), %rdi
+	movabsq	$rt.memcpy, %rax
+	call	*%rax
+	jmp	.L215
+.L216:
+	movabsq	$abortsites.261, %rax
+	movl	28(%rax), %edx
+	movl	24(%rax), %esi
+	movq	16(%rax), %rdi
+	movl	$0, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+	.size	rt.free, .-rt.free
+	.section	.text.rt.checkpoison,"ax",@progbits
+	.type	rt.checkpoison, @function
+rt.checkpoison:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r12
+	pushq	%rbx
+	subq	$64, %rsp
+	movq	%rdi, %rbx
+	movq	(%rdi), %rdi
+	testb	$1, %dil
+	je	.L224
+	movq	%rsi, %r12
+	andq	$-2, %rdi
+	jne	.L235
+.L225:
+	testq	%r12, %r12
+	je	.L223
+	leaq	8(%rbx), %rax
+	leaq	8(%rbx,%r12), %rdx
+.L230:
+	cmpb	$105, (%rax)
+	jne	.L233
+	addq	$1, %rax
+	cmpq	%rax, %rdx
+	jne	.L230
+.L223:
+	addq	$64, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%rbp
+	ret
+.L224:
+	movl	$24, %edx
+	movabsq	$strliteral.104, %rsi
+	leaq	-48(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-48(%rbp), %rcx
+	movl	$15, %edx
+	movl	$208, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L235:
+	movl	$0, %esi
+	movabsq	$rt.validatemeta, %rax
+	call	*%rax
+	jmp	.L225
+.L233:
+	movl	$24, %edx
+	movabsq	$strliteral.2148, %rsi
+	leaq	-80(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-80(%rbp), %rcx
+	movl	$23, %edx
+	movl	$288, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+	.size	rt.checkpoison, .-rt.checkpoison
+	.section	.text.finifunc.0,"ax",@progbits
+	.type	finifunc.0, @function
+finifunc.0:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$40, %rsp
+.L237:
+	movl	$0, %r14d
+	movabsq	$rt.bins, %r15
+	movabsq	$rt.checkpoison, %r13
+	jmp	.L240
+.L239:
+	addq	$1, %r14
+	cmpq	$9, %r14
+	je	.L248
+.L240:
+	movq	(%r15,%r14,8), %rbx
+	testq	%rbx, %rbx
+	je	.L239
+	leal	-1(%r14), %ecx
+	movl	$1, %r12d
+	salq	%cl, %r12
+	testq	%r14, %r14
+	movl	$0, %eax
+	cmove	%rax, %r12
+	salq	$4, %r12
+	addq	$8, %r12
+.L243:
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	*%r13
+	movq	(%rbx), %rbx
+	testb	$1, %bl
+	je	.L242
+	andq	$-2, %rbx
+	jne	.L243
+	jmp	.L239
+.L242:
+	movl	$24, %edx
+	movabsq	$strliteral.104, %rsi
+	leaq	-80(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-80(%rbp), %rcx
+	movl	$15, %edx
+	movl	$208, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L248:
+	addq	$40, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	popq	%rbp
+	ret
+	.size	finifunc.0, .-finifunc.0
+	.section	.text.rt.malloc,"ax",@progbits
+	.globl	rt.malloc
+	.type	rt.malloc, @function
+rt.malloc:
+	movq	%rdi, %rax
+	testq	%rdi, %rdi
+	je	.L268
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	subq	$48, %rsp
+	cmpq	$2056, %rdi
+	jbe	.L251
+	movabsq	$rt.realsz, %rax
+	call	*%rax
+	movq	%rax, %rbx
+	leaq	24(%rax), %rdi
+	movabsq	$rt.segmalloc, %rax
+	call	*%rax
+	testq	%rax, %rax
+	je	.L263
+	movq	%rbx, 8(%rax)
+	movq	%rbx, 16(%rbx,%rax)
+	movabsq	$rt.cur_allocs, %rdx
+	addq	$1, (%rdx)
+	leaq	16(%rax), %rax
+	jmp	.L263
+.L251:
+	movabsq	$rt.size_getbin, %rax
+	call	*%rax
+	testq	%rax, %rax
+	je	.L253
+	leaq	-1(%rax), %rcx
+	movl	$1, %r12d
+	salq	%cl, %r12
+	salq	$4, %r12
+	leaq	16(%r12), %r14
+	addq	$8, %r12
+	movabsq	$rt.bins, %rdx
+	leaq	(%rdx,%rax,8), %rdx
+	cmpq	$8, %rax
+	jbe	.L262
+.L255:
+	movabsq	$abortsites.408, %rax
+	movl	28(%rax), %edx
+	movl	24(%rax), %esi
+	movq	16(%rax), %rdi
+	movl	$0, %ecx
+	movabsq	$rt.abort_fixed, %rax
+	call	*%rax
+	ud2
+.L256:
+	movq	(%rbx), %rax
+	testb	$1, %al
+	je	.L271
+	andq	$-2, %rax
+	movq	%rax, (%rdx)
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	movabsq	$rt.checkpoison, %rax
+	call	*%rax
+	movq	%r12, (%rbx)
+.L261:
+	movabsq	$rt.cur_allocs, %rax
+	addq	$1, (%rax)
+	leaq	8(%rbx), %rax
+.L263:
+	addq	$48, %rsp
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	ret
+.L272:
+	movl	$2097152, %edi
+	movabsq	$rt.segmalloc, %rax
+	call	*%rax
+	testq	%rax, %rax
+	je	.L263
+	movq	%rax, -48(%rbp)
+	movq	$8, -40(%rbp)
+	movl	$16, %edx
+	leaq	-48(%rbp), %rsi
+	movabsq	$rt.cur_chunk, %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	jmp	.L258
+.L271:
+	movl	$24, %edx
+	movabsq	$strliteral.104, %rsi
+	leaq	-80(%rbp), %rdi
+	movabsq	$BLIT, %rax
+	call	*%rax
+	leaq	-80(%rbp), %rcx
+	movl	$15, %edx
+	movl	$208, %esi
+	movabsq	$strliteral.15, %rdi
+	movabsq	$rt.abort, %rax
+	call	*%rax
+	ud2
+.L253:
+	movabsq	$rt.bins, %rdx
+	movl	$8, %r12d
+	movl	$16, %r14d
+.L262:
+	movq	(%rdx), %rbx
+	testq	%rbx, %rbx
+	jne	.L256
+	movabsq	$rt.cur_chunk+8, %r13
+	movq	0(%r13), %rax
+	leaq	16(%r12,%rax), %rax
+	cmpq	$2097152, %rax
+	ja	.L272
+.L258:
+	movq	0(%r13), %rdx
+	movabsq	rt.cur_chunk, %rax
+	leaq	(%rdx,%rax), %rbx
+	addq	%r14, %rdx
+	movq	%rdx, 0(%r13)
+	movq	%r12, (%rbx)
+	movq	%r12, 8(%r12,%rbx)
+	jmp	.L261
+.L268:
+	ret
+	.size	rt.malloc, .-rt.malloc
+	.section	.text.rt.realloc,"ax",@progbits
+	.globl	rt.realloc
+	.type	rt.realloc, @function
+rt.realloc:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbx
+	movq	%rdi, %r12
+	movq	%rsi, %rbx
+	testq	%rsi, %rsi
+	je	.L279
+	testq	%rdi, %rdi
+	jne	.L276
+	movq	%rsi, %rdi
+	movabsq	$rt.malloc, %rax
+	call	*%rax
+	movq	%rax, %r13
+.L273:
+	movq	%r13, %rax
+	popq	%rbx
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%rbp
+	ret
+.L279:
+	movabsq	$rt.free, %rax
+	call	*%rax
+	movq	%rbx, %r13
+	jmp	.L273
+.L276:
+	movabsq	$rt.getmeta, %rax
+	call	*%rax
+	movq	%rax, %r14
+	movq	%rbx, %rdi
+	movabsq	$rt.realsz, %rax
+	call	*%rax
+	movq	%r12, %r13
+	cmpq	(%r14), %rax
+	je	.L273
+	movq	%rbx, %rdi
+	movabsq	$rt.malloc, %rax
+	call	*%rax
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L273
+	movq	(%r14), %rax
+	cmpq	%rax, %rbx
+	cmovbe	%rbx, %rax
+	movq	%rax, %rdx
+	leaq	8(%r14), %rsi
+	movq	%r13, %rdi
+	movabsq	$rt.memcpy, %rax
+	call	*%rax
+	movq	%r12, %rdi
+	movabsq	$rt.free, %rax
+	call	*%rax
+	jmp	.L273
+	.size	rt.realloc, .-rt.realloc
+	.section	.bss.rt.bins,"aw",@nobits
+	.align 8
+	.type	rt.bins, @object
+	.size	rt.bins, 72
+rt.bins:
+	.zero	72
+	.section	.data.rel.ro.abortsites.2098,"aw"
+	.align 8
+	.type	abortsites.2098, @object
+	.size	abortsites.2098, 16
+abortsites.2098:
+	.quad	strliteral.15
+	.long	277
+	.long	14
+	.section	.data.rel.ro.strliteral.2148,"aw"
+	.align 8
+	.type	strliteral.2148, @object
+	.size	strliteral.2148, 24
+strliteral.2148:
+	.quad	strdata.2147
+	.quad	49
+	.quad	49
+	.section	.rodata.strdata.2147,"a"
+	.align 8
+	.type	strdata.2147, @object
+	.size	strdata.2147, 49
+strdata.2147:
+	.ascii	"invalid poison data on freelist (use after free?)"
+	.section	.data.rel.ro.strliteral.2122,"aw"
+	.align 8
+	.type	strliteral.2122, @object
+	.size	strliteral.2122, 24
+strliteral.2122:
+	.quad	strdata.2121
+	.quad	44
+	.quad	44
+	.section	.rodata.strdata.2121,"a"
+	.align 8
+	.type	strdata.2121, @object
+	.size	strdata.2121, 44
+strdata.2121:
+	.ascii	"invalid canary on freelist (use after free?)"
+	.section	.data.rel.ro.abortsites.1899,"aw"
+	.align 8
+	.type	abortsites.1899, @object
+	.size	abortsites.1899, 16
+abortsites.1899:
+	.quad	strliteral.15
+	.long	235
+	.long	22
+	.section	.data.rel.ro.strliteral.2021,"aw"
+	.align 8
+	.type	strliteral.2021, @object
+	.size	strliteral.2021, 24
+strliteral.2021:
+	.quad	strdata.2020
+	.quad	70
+	.quad	70
+	.section	.rodata.strdata.2020,"a"
+	.align 8
+	.type	strdata.2020, @object
+	.size	strdata.2020, 70
+strdata.2020:
+	.ascii	"invalid secondary metadata for small allocation (out-of-boun"
+	.ascii	"ds write?)"
+	.section	.data.rel.ro.strliteral.1996,"aw"
+	.align 8
+	.type	strliteral.1996, @object
+	.size	strliteral.1996, 24
+strliteral.1996:
+	.quad	strdata.1995
+	.quad	57
+	.quad	57
+	.section	.rodata.strdata.1995,"a"
+	.align 8
+	.type	strdata.1995, @object
+	.size	strdata.1995, 57
+strdata.1995:
+	.ascii	"invalid metadata for small allocation (non-heap pointer?)"
+	.section	.data.rel.ro.strliteral.1961,"aw"
+	.align 8
+	.type	strliteral.1961, @object
+	.size	strliteral.1961, 24
+strliteral.1961:
+	.quad	strdata.1960
+	.quad	70
+	.quad	70
+	.section	.rodata.strdata.1960,"a"
+	.align 8
+	.type	strdata.1960, @object
+	.size	strdata.1960, 70
+strdata.1960:
+	.ascii	"invalid secondary metadata for large allocation (out-of-boun"
+	.ascii	"ds write?)"
+	.section	.data.rel.ro.strliteral.1950,"aw"
+	.align 8
+	.type	strliteral.1950, @object
+	.size	strliteral.1950, 24
+strliteral.1950:
+	.quad	strdata.1949
+	.quad	57
+	.quad	57
+	.section	.rodata.strdata.1949,"a"
+	.align 8
+	.type	strdata.1949, @object
+	.size	strdata.1949, 57
+strdata.1949:
+	.ascii	"invalid metadata for large allocation (non-heap pointer?)"
+	.section	.data.rel.ro.strliteral.1939,"aw"
+	.align 8
+	.type	strliteral.1939, @object
+	.size	strliteral.1939, 24
+strliteral.1939:
+	.quad	strdata.1938
+	.quad	52
+	.quad	52
+	.section	.rodata.strdata.1938,"a"
+	.align 8
+	.type	strdata.1938, @object
+	.size	strdata.1938, 52
+strdata.1938:
+	.ascii	"invalid large allocation address (non-heap pointer?)"
+	.section	.data.rel.ro.strliteral.1887,"aw"
+	.align 8
+	.type	strliteral.1887, @object
+	.size	strliteral.1887, 24
+strliteral.1887:
+	.quad	strdata.1886
+	.quad	68
+	.quad	68
+	.section	.rodata.strdata.1886,"a"
+	.align 8
+	.type	strdata.1886, @object
+	.size	strdata.1886, 68
+strdata.1886:
+	.ascii	"invalid metadata for small allocation on freelist (heap corr"
+	.ascii	"uption?)"
+	.section	.data.rel.ro.strliteral.1823,"aw"
+	.align 8
+	.type	strliteral.1823, @object
+	.size	strliteral.1823, 24
+strliteral.1823:
+	.quad	strdata.1822
+	.quad	57
+	.quad	57
+	.section	.rodata.strdata.1822,"a"
+	.align 8
+	.type	strdata.1822, @object
+	.size	strdata.1822, 57
+strdata.1822:
+	.ascii	"invalid alignment for metadata pointer (heap corruption?)"
+	.section	.bss.rt.cur_allocs,"aw",@nobits
+	.align 8
+	.type	rt.cur_allocs, @object
+	.size	rt.cur_allocs, 8
+rt.cur_allocs:
+	.zero	8
+	.section	.data.rt.cur_chunk,"aw"
+	.align 8
+	.type	rt.cur_chunk, @object
+	.size	rt.cur_chunk, 16
+rt.cur_chunk:
+	.quad	0
+	.quad	2097152
+	.section	.data.rt.reasons,"aw"
+	.align 8
+	.type	rt.reasons, @object
+	.size	rt.reasons, 192
+rt.reasons:
+	.quad	strdata.1650
+	.quad	35
+	.quad	35
+	.quad	strdata.1651
+	.quad	21
+	.quad	21
+	.quad	strdata.1652
+	.quad	13
+	.quad	13
+	.quad	strdata.1653
+	.quad	36
+	.quad	36
+	.quad	strdata.1654
+	.quad	16
+	.quad	16
+	.quad	strdata.1655
+	.quad	50
+	.quad	50
+	.quad	strdata.1656
+	.quad	16
+	.quad	16
+	.quad	strdata.1657
+	.quad	14
+	.quad	14
+	.section	.rodata.strdata.1657,"a"
+	.align 8
+	.type	strdata.1657, @object
+	.size	strdata.1657, 14
+strdata.1657:
+	.ascii	"error occurred"
+	.section	.rodata.strdata.1656,"a"
+	.align 8
+	.type	strdata.1656, @object
+	.size	strdata.1656, 16
+strdata.1656:
+	.ascii	"assertion failed"
+	.section	.rodata.strdata.1655,"a"
+	.align 8
+	.type	strdata.1655, @object
+	.size	strdata.1655, 50
+strdata.1655:
+	.ascii	"slice allocation capacity smaller than initializer"
+	.section	.rodata.strdata.1654,"a"
+	.align 8
+	.type	strdata.1654, @object
+	.size	strdata.1654, 16
+strdata.1654:
+	.ascii	"unreachable code"
+	.section	.rodata.strdata.1653,"a"
+	.align 8
+	.type	strdata.1653, @object
+	.size	strdata.1653, 36
+strdata.1653:
+	.ascii	"static append exceeds slice capacity"
+	.section	.rodata.strdata.1652,"a"
+	.align 8
+	.type	strdata.1652, @object
+	.size	strdata.1652, 13
+strdata.1652:
+	.ascii	"out of memory"
+	.section	.rodata.strdata.1651,"a"
+	.align 8
+	.type	strdata.1651, @object
+	.size	strdata.1651, 21
+strdata.1651:
+	.ascii	"type assertion failed"
+	.section	.rodata.strdata.1650,"a"
+	.align 8
+	.type	strdata.1650, @object
+	.size	strdata.1650, 35
+strdata.1650:
+	.ascii	"slice or array access out of bounds"
+	.section	.data.rel.ro.abortsites.1530,"aw"
+	.align 8
+	.type	abortsites.1530, @object
+	.size	abortsites.1530, 96
+abortsites.1530:
+	.quad	strliteral.1
+	.long	42
+	.long	21
+	.quad	strliteral.1
+	.long	44
+	.long	24
+	.quad	strliteral.1
+	.long	47
+	.long	24
+	.quad	strliteral.1
+	.long	51
+	.long	29
+	.quad	strliteral.1
+	.long	52
+	.long	27
+	.quad	strliteral.1
+	.long	53
+	.long	19
+	.section	.bss.static.2,"aw",@nobits
+	.align 8
+	.type	static.2, @object
+	.size	static.2, 20
+static.2:
+	.zero	20
+	.section	.data.rel.ro.strliteral.1499,"aw"
+	.align 8
+	.type	strliteral.1499, @object
+	.size	strliteral.1499, 24
+strliteral.1499:
+	.quad	strdata.1498
+	.quad	1
+	.quad	1
+	.section	.rodata.strdata.1498,"a"
+	.align 8
+	.type	strdata.1498, @object
+	.size	strdata.1498, 1
+strdata.1498:
+	.byte	10
+	.section	.data.rel.ro.strliteral.1388,"aw"
+	.align 8
+	.type	strliteral.1388, @object
+	.size	strliteral.1388, 24
+strliteral.1388:
+	.quad	strdata.1387
+	.quad	2
+	.quad	2
+	.section	.rodata.strdata.1387,"a"
+	.align 8
+	.type	strdata.1387, @object
+	.size	strdata.1387, 2
+strdata.1387:
+	.ascii	": "
+	.section	.data.rel.ro.strliteral.1385,"aw"
+	.align 8
+	.type	strliteral.1385, @object
+	.size	strliteral.1385, 24
+strliteral.1385:
+	.quad	strdata.1384
+	.quad	1
+	.quad	1
+	.section	.rodata.strdata.1384,"a"
+	.align 8
+	.type	strdata.1384, @object
+	.size	strdata.1384, 1
+strdata.1384:
+	.ascii	":"
+	.section	.data.rel.ro.strliteral.1381,"aw"
+	.align 8
+	.type	strliteral.1381, @object
+	.size	strliteral.1381, 24
+strliteral.1381:
+	.quad	strdata.1380
+	.quad	7
+	.quad	7
+	.section	.rodata.strdata.1380,"a"
+	.align 8
+	.type	strdata.1380, @object
+	.size	strdata.1380, 7
+strdata.1380:
+	.ascii	"Abort: "
+	.section	.data.rel.ro.abortsites.1363,"aw"
+	.align 8
+	.type	abortsites.1363, @object
+	.size	abortsites.1363, 16
+abortsites.1363:
+	.quad	strliteral.1
+	.long	37
+	.long	40
+	.section	.data.rel.ro.abortsites.767,"aw"
+	.align 8
+	.type	abortsites.767, @object
+	.size	abortsites.767, 16
+abortsites.767:
+	.quad	strliteral.13
+	.long	26
+	.long	14
+	.section	.data.rel.ro.abortsites.408,"aw"
+	.align 8
+	.type	abortsites.408, @object
+	.size	abortsites.408, 80
+abortsites.408:
+	.quad	strliteral.15
+	.long	64
+	.long	30
+	.quad	strliteral.15
+	.long	78
+	.long	28
+	.quad	strliteral.15
+	.long	82
+	.long	30
+	.quad	strliteral.15
+	.long	98
+	.long	21
+	.quad	strliteral.15
+	.long	78
+	.long	22
+	.section	.data.rel.ro.abortsites.261,"aw"
+	.align 8
+	.type	abortsites.261, @object
+	.size	abortsites.261, 48
+abortsites.261:
+	.quad	strliteral.15
+	.long	111
+	.long	22
+	.quad	strliteral.15
+	.long	132
+	.long	22
+	.quad	strliteral.15
+	.long	133
+	.long	13
+	.section	.data.rel.ro.abortsites.179,"aw"
+	.align 8
+	.type	abortsites.179, @object
+	.size	abortsites.179, 32
+abortsites.179:
+	.quad	strliteral.15
+	.long	147
+	.long	22
+	.quad	strliteral.15
+	.long	155
+	.long	24
+	.section	.data.rel.ro.strliteral.137,"aw"
+	.align 8
+	.type	strliteral.137, @object
+	.size	strliteral.137, 24
+strliteral.137:
+	.quad	strdata.136
+	.quad	62
+	.quad	62
+	.section	.rodata.strdata.136,"a"
+	.align 8
+	.type	strdata.136, @object
+	.size	strdata.136, 62
+strdata.136:
+	.ascii	"tried to get metadata for already-freed pointer (double free"
+	.ascii	"?)"
+	.section	.fini_array,"aw"
+	.align 8
+	.type	.fini.finifunc.0, @object
+	.size	.fini.finifunc.0, 8
+.fini.finifunc.0:
+	.quad	finifunc.0
+	.section	.data.rel.ro.abortsites.53,"aw"
+	.align 8
+	.type	abortsites.53, @object
+	.size	abortsites.53, 32
+abortsites.53:
+	.quad	strliteral.15
+	.long	295
+	.long	41
+	.quad	strliteral.15
+	.long	294
+	.long	68
+	.section	.data.rel.ro.strliteral.104,"aw"
+	.align 8
+	.type	strliteral.104, @object
+	.size	strliteral.104, 24
+strliteral.104:
+	.quad	strdata.103
+	.quad	69
+	.quad	69
+	.section	.rodata.strdata.103,"a"
+	.align 8
+	.type	strdata.103, @object
+	.size	strdata.103, 69
+strdata.103:
+	.ascii	"expected metadata on freelist to be marked as free (heap cor"
+	.ascii	"ruption?)"
+	.section	.data.rel.ro.strliteral.19,"aw"
+	.align 8
+	.type	strliteral.19, @object
+	.size	strliteral.19, 24
+strliteral.19:
+	.quad	strdata.18
+	.quad	22
+	.quad	22
+	.section	.rodata.strdata.18,"a"
+	.align 8
+	.type	strdata.18, @object
+	.size	strdata.18, 22
+strdata.18:
+	.ascii	"rt/+linux/segmalloc.ha"
+	.section	.data.rel.ro.strliteral.17,"aw"
+	.align 8
+	.type	strliteral.17, @object
+	.size	strliteral.17, 24
+strliteral.17:
+	.quad	strdata.16
+	.quad	29
+	.quad	29
+	.section	.rodata.strdata.16,"a"
+	.align 8
+	.type	strdata.16, @object
+	.size	strdata.16, 29
+strdata.16:
+	.ascii	"rt/+linux/syscallno+x86_64.ha"
+	.section	.data.rel.ro.strliteral.15,"aw"
+	.align 8
+	.type	strliteral.15, @object
+	.size	strliteral.15, 24
+strliteral.15:
+	.quad	strdata.14
+	.quad	12
+	.quad	12
+	.section	.rodata.strdata.14,"a"
+	.align 8
+	.type	strdata.14, @object
+	.size	strdata.14, 12
+strdata.14:
+	.ascii	"rt/malloc.ha"
+	.section	.data.rel.ro.strliteral.13,"aw"
+	.align 8
+	.type	strliteral.13, @object
+	.size	strliteral.13, 24
+strliteral.13:
+	.quad	strdata.12
+	.quad	21
+	.quad	21
+	.section	.rodata.strdata.12,"a"
+	.align 8
+	.type	strdata.12, @object
+	.size	strdata.12, 21
+strdata.12:
+	.ascii	"rt/+linux/syscalls.ha"
+	.section	.data.rel.ro.strliteral.11,"aw"
+	.align 8
+	.type	strliteral.11, @object
+	.size	strliteral.11, 24
+strliteral.11:
+	.quad	strdata.10
+	.quad	18
+	.quad	18
+	.section	.rodata.strdata.10,"a"
+	.align 8
+	.type	strdata.10, @object
+	.size	strdata.10, 18
+strdata.10:
+	.ascii	"rt/+linux/errno.ha"
+	.section	.data.rel.ro.strliteral.9,"aw"
+	.align 8
+	.type	strliteral.9, @object
+	.size	strliteral.9, 24
+strliteral.9:
+	.quad	strdata.8
+	.quad	12
+	.quad	12
+	.section	.rodata.strdata.8,"a"
+	.align 8
+	.type	strdata.8, @object
+	.size	strdata.8, 12
+strdata.8:
+	.ascii	"rt/memset.ha"
+	.section	.data.rel.ro.strliteral.7,"aw"
+	.align 8
+	.type	strliteral.7, @object
+	.size	strliteral.7, 24
+strliteral.7:
+	.quad	strdata.6
+	.quad	13
+	.quad	13
+	.section	.rodata.strdata.6,"a"
+	.align 8
+	.type	strdata.6, @object
+	.size	strdata.6, 13
+strdata.6:
+	.ascii	"rt/memmove.ha"
+	.section	.data.rel.ro.strliteral.5,"aw"
+	.align 8
+	.type	strliteral.5, @object
+	.size	strliteral.5, 24
+strliteral.5:
+	.quad	strdata.4
+	.quad	12
+	.quad	12
+	.section	.rodata.strdata.4,"a"
+	.align 8
+	.type	strdata.4, @object
+	.size	strdata.4, 12
+strdata.4:
+	.ascii	"rt/memcpy.ha"
+	.section	.data.rel.ro.strliteral.3,"aw"
+	.align 8
+	.type	strliteral.3, @object
+	.size	strliteral.3, 24
+strliteral.3:
+	.quad	strdata.2
+	.quad	14
+	.quad	14
+	.section	.rodata.strdata.2,"a"
+	.align 8
+	.type	strdata.2, @object
+	.size	strdata.2, 14
+strdata.2:
+	.ascii	"rt/cstrings.ha"
+	.section	.data.rel.ro.strliteral.1,"aw"
+	.align 8
+	.type	strliteral.1, @object
+	.size	strliteral.1, 24
+strliteral.1:
+	.quad	strdata.0
+	.quad	11
+	.quad	11
+	.section	.rodata.strdata.0,"a"
+	.align 8
+	.type	strdata.0, @object
+	.size	strdata.0, 11
+strdata.0:
+	.ascii	"rt/abort.ha"
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
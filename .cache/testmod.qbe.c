@@ -0,0 +1,31 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e3 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_s__y { u32 f0; };
+struct __attribute__((packed)) S_testmod_2eval4 { u32 f0; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e2 D_strdata_2e2 __asm__("strdata.2") __attribute__((used, section(".rodata.strdata.2"), aligned(8)));
+static struct S_strliteral_2e3 D_strliteral_2e3 __asm__("strliteral.3") __attribute__((used, section(".data.rel.ro.strliteral.3"), aligned(8)));
+extern struct S_s__y D_s__y __asm__("s_y") __attribute__((used, section(".data.s_y"), aligned(8)));
+extern struct S_testmod_2eval4 D_testmod_2eval4 __asm__("testmod.val4") __attribute__((used, section(".data.testmod.val4"), aligned(8)));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\155\157\144\057\155\145\141\163\165\162\145\155\145\156\164\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 22U, 22U };
+static const struct S_strdata_2e2 D_strdata_2e2 = { "\164\145\163\164\155\157\144\057\164\145\163\164\155\157\144\056\150\141" };
+static struct S_strliteral_2e3 D_strliteral_2e3 = { (char *)((char *)&D_strdata_2e2) + 0, 18U, 18U };
+struct S_s__y D_s__y = { 1U };
+struct S_testmod_2eval4 D_testmod_2eval4 = { 69U };
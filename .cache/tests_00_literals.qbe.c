@@ -0,0 +1,6030 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2efree[] __asm__("rt.free");
+extern char X_rt_2emalloc[] __asm__("rt.malloc");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+extern char X_rt_2ememmove[] __asm__("rt.memmove");
+extern char X_rt_2etoutf8[] __asm__("rt.toutf8");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[20]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e24 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; };
+struct __attribute__((packed)) S_strdata_2e362 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e363 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e364 { u8 f0[48]; };
+struct __attribute__((packed)) S_strliteral_2e365 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e366 { u8 f0[41]; };
+struct __attribute__((packed)) S_strliteral_2e367 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e368 { u8 f0[38]; };
+struct __attribute__((packed)) S_strliteral_2e369 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e370 { u8 f0[90]; };
+struct __attribute__((packed)) S_strliteral_2e371 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e372 { u8 f0[57]; };
+struct __attribute__((packed)) S_strliteral_2e373 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e374 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e375 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e376 { u8 f0[39]; };
+struct __attribute__((packed)) S_strliteral_2e377 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e378 { u8 f0[75]; };
+struct __attribute__((packed)) S_strliteral_2e379 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e380 { u8 f0[41]; };
+struct __attribute__((packed)) S_strliteral_2e381 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e382 { u8 f0[41]; };
+struct __attribute__((packed)) S_strliteral_2e383 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e384 { u8 f0[24]; u8 f1; u8 f2; u8 f3[11]; };
+struct __attribute__((packed)) S_strliteral_2e385 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e386 { u8 f0[65]; };
+struct __attribute__((packed)) S_strliteral_2e387 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e388 { u8 f0[59]; };
+struct __attribute__((packed)) S_strliteral_2e389 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e390 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e391 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e392 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e393 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e394 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e395 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e396 { u8 f0[90]; };
+struct __attribute__((packed)) S_strliteral_2e397 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e398 { u8 f0[59]; };
+struct __attribute__((packed)) S_strliteral_2e399 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e400 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e401 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e402 { u8 f0[41]; };
+struct __attribute__((packed)) S_strliteral_2e403 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e404 { u8 f0[77]; };
+struct __attribute__((packed)) S_strliteral_2e405 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e406 { u8 f0[43]; };
+struct __attribute__((packed)) S_strliteral_2e407 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e408 { u8 f0[43]; };
+struct __attribute__((packed)) S_strliteral_2e409 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e410 { u8 f0[24]; u8 f1; u8 f2; u8 f3[13]; };
+struct __attribute__((packed)) S_strliteral_2e411 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e412 { u8 f0[89]; };
+struct __attribute__((packed)) S_strliteral_2e413 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e414 { u8 f0[61]; };
+struct __attribute__((packed)) S_strliteral_2e415 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e416 { u8 f0[43]; };
+struct __attribute__((packed)) S_strliteral_2e417 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e418 { u8 f0[59]; };
+struct __attribute__((packed)) S_strliteral_2e419 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e420 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e421 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e422 { u8 f0[41]; };
+struct __attribute__((packed)) S_strliteral_2e423 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e424 { u8 f0[77]; };
+struct __attribute__((packed)) S_strliteral_2e425 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e426 { u8 f0[43]; };
+struct __attribute__((packed)) S_strliteral_2e427 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e428 { u8 f0[43]; };
+struct __attribute__((packed)) S_strliteral_2e429 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e430 { u8 f0[24]; u8 f1; u8 f2; u8 f3[13]; };
+struct __attribute__((packed)) S_strliteral_2e431 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e432 { u8 f0[67]; };
+struct __attribute__((packed)) S_strliteral_2e433 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e434 { u8 f0[61]; };
+struct __attribute__((packed)) S_strliteral_2e435 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e436 { u8 f0[29]; u8 f1; u8 f2; u8 f3[5]; };
+struct __attribute__((packed)) S_strliteral_2e437 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e347 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_strdata_2e1040 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1041 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1042 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1043 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1044 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1045 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1046 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1047 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1048 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1049 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1050 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1051 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1052 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1053 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1054 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1055 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1056 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1057 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1058 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1059 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1060 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1061 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1062 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1063 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1064 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1065 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1066 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1067 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1068 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1069 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1070 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1071 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1072 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1073 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1074 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1075 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1076 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1077 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1078 { u8 f0[8]; };
+struct __attribute__((packed)) S_strliteral_2e1079 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1080 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e1081 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1082 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1083 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1084 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1085 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1086 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1087 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1088 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1089 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1090 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1091 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1092 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1093 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1094 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1095 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1096 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1097 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1098 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1099 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1100 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1101 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1102 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1103 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1104 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1105 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1106 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1107 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1108 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1109 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1110 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1111 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1112 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1113 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1114 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1115 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1116 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1117 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1118 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1119 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1120 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1121 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1122 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1123 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1124 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1125 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1126 { u8 f0[8]; };
+struct __attribute__((packed)) S_strliteral_2e1127 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1128 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1129 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1130 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1131 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1132 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1133 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1134 { u8 f0[10]; };
+struct __attribute__((packed)) S_strliteral_2e1135 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1136 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1137 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1138 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1139 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1140 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1141 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1142 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e1143 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1144 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1145 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1146 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1147 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1148 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1149 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1150 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e1151 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1152 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1153 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1154 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1155 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1156 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1157 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1158 { u8 f0[10]; };
+struct __attribute__((packed)) S_strliteral_2e1159 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1160 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1161 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1162 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1163 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1164 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1165 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1166 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e1167 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1168 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1169 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1170 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1171 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1172 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1173 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1174 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e1175 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1176 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1177 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1178 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1179 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1180 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1181 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1182 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1183 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1184 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1185 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1186 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1187 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1188 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1189 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1190 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1191 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1192 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1193 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1194 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1195 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1196 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1197 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1198 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1199 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1200 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1201 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1202 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1203 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1204 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1205 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1206 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1207 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1208 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1209 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1210 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1211 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1212 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1213 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1214 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1215 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1216 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1217 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1218 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1219 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1220 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1221 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1222 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1223 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1224 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1225 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1226 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1227 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1228 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1229 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1230 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1231 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1232 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1233 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1234 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1235 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1236 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1237 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1238 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1239 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1240 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1241 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1242 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1243 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1244 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1245 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1246 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1247 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1248 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1249 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1250 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1251 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1252 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1253 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1254 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1255 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1256 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1257 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1258 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1259 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1260 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1261 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1262 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1263 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1264 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1265 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1266 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1267 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1268 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1269 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1270 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1271 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1272 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1273 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1274 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1275 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1276 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1277 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1278 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1279 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1280 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1281 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1282 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1283 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1284 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1285 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1286 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1287 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1288 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1289 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1290 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1291 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1292 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1293 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1294 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1295 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1296 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1297 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1298 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1299 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1300 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1301 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1302 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1303 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1304 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1305 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1306 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1307 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1308 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1309 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1310 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1311 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1312 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1313 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1314 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1315 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1316 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1317 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1318 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1319 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1320 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1321 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1322 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1323 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1324 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1325 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1326 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1327 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1328 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1329 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1330 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1331 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1332 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1333 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1334 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1335 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1336 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1337 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1338 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1339 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1340 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1341 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1342 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1343 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1344 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1345 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1346 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1347 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1348 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1349 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1350 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1351 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1352 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e1353 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1354 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1355 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1356 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1357 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1358 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1359 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1360 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1361 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1362 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1363 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1364 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1365 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1366 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1367 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1368 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1369 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1370 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1371 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1372 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1373 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1374 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1375 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1376 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1377 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1378 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1379 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1380 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1381 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1382 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1383 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1384 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1385 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1386 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1387 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1388 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1389 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1390 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1391 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1392 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1393 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1394 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1395 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1396 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1397 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1398 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1399 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1400 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1401 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1402 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1403 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1404 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1405 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1406 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1407 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1408 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1409 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1410 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1411 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1412 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1413 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1414 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1415 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1416 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1417 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1418 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1419 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1420 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1421 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1422 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1423 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1424 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1425 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1426 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1427 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1428 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1429 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1430 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1431 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1432 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1433 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1434 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1435 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1436 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e1437 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1441 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e1442 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1443 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e1444 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1445 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e1446 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1447 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e1448 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1449 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1450 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1451 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1452 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1453 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1454 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1455 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1456 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1457 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1458 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1459 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1460 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1461 { u8 f0[20]; };
+struct __attribute__((packed)) S_strliteral_2e1462 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1466 { u8 f0[1]; };
+struct __attribute__((packed)) S_strliteral_2e1467 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1468 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1469 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1470 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e1471 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1472 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1473 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1523 { u8 f0[8]; };
+struct __attribute__((packed)) S_strliteral_2e1524 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e604 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; char *f81; u32 f82; u32 f83; char *f84; u32 f85; u32 f86; char *f87; u32 f88; u32 f89; char *f90; u32 f91; u32 f92; char *f93; u32 f94; u32 f95; char *f96; u32 f97; u32 f98; char *f99; u32 f100; u32 f101; char *f102; u32 f103; u32 f104; char *f105; u32 f106; u32 f107; char *f108; u32 f109; u32 f110; char *f111; u32 f112; u32 f113; char *f114; u32 f115; u32 f116; char *f117; u32 f118; u32 f119; char *f120; u32 f121; u32 f122; char *f123; u32 f124; u32 f125; char *f126; u32 f127; u32 f128; char *f129; u32 f130; u32 f131; char *f132; u32 f133; u32 f134; char *f135; u32 f136; u32 f137; char *f138; u32 f139; u32 f140; char *f141; u32 f142; u32 f143; char *f144; u32 f145; u32 f146; char *f147; u32 f148; u32 f149; char *f150; u32 f151; u32 f152; char *f153; u32 f154; u32 f155; char *f156; u32 f157; u32 f158; char *f159; u32 f160; u32 f161; char *f162; u32 f163; u32 f164; char *f165; u32 f166; u32 f167; char *f168; u32 f169; u32 f170; char *f171; u32 f172; u32 f173; char *f174; u32 f175; u32 f176; char *f177; u32 f178; u32 f179; char *f180; u32 f181; u32 f182; char *f183; u32 f184; u32 f185; };
+struct __attribute__((packed)) S_strdata_2e1650 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e1651 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1684 { u8 f0[9]; u8 f1; u8 f2[5]; };
+struct __attribute__((packed)) S_strliteral_2e1685 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1704 { u8 f0[9]; u8 f1; u8 f2[5]; };
+struct __attribute__((packed)) S_strliteral_2e1705 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1724 { u8 f0[9]; u8 f1; u8 f2[6]; };
+struct __attribute__((packed)) S_strliteral_2e1725 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1744 { u8 f0[9]; u8 f1; u8 f2[5]; };
+struct __attribute__((packed)) S_strliteral_2e1745 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1764 { u8 f0[9]; u8 f1; u8 f2[10]; };
+struct __attribute__((packed)) S_strliteral_2e1765 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1784 { u8 f0[9]; u8 f1; u8 f2[5]; };
+struct __attribute__((packed)) S_strliteral_2e1785 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1804 { u8 f0[9]; u8 f1; u8 f2[7]; };
+struct __attribute__((packed)) S_strliteral_2e1805 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1824 { u8 f0[9]; u8 f1; u8 f2[11]; };
+struct __attribute__((packed)) S_strliteral_2e1825 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1665 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e24 D_abortsites_2e24 __asm__("abortsites.24") __attribute__((used, section(".data.rel.ro.abortsites.24"), aligned(8)));
+static const struct S_strdata_2e362 D_strdata_2e362 __asm__("strdata.362") __attribute__((used, section(".rodata.strdata.362"), aligned(8)));
+static struct S_strliteral_2e363 D_strliteral_2e363 __asm__("strliteral.363") __attribute__((used, section(".data.rel.ro.strliteral.363"), aligned(8)));
+static const struct S_strdata_2e364 D_strdata_2e364 __asm__("strdata.364") __attribute__((used, section(".rodata.strdata.364"), aligned(8)));
+static struct S_strliteral_2e365 D_strliteral_2e365 __asm__("strliteral.365") __attribute__((used, section(".data.rel.ro.strliteral.365"), aligned(8)));
+static const struct S_strdata_2e366 D_strdata_2e366 __asm__("strdata.366") __attribute__((used, section(".rodata.strdata.366"), aligned(8)));
+static struct S_strliteral_2e367 D_strliteral_2e367 __asm__("strliteral.367") __attribute__((used, section(".data.rel.ro.strliteral.367"), aligned(8)));
+static const struct S_strdata_2e368 D_strdata_2e368 __asm__("strdata.368") __attribute__((used, section(".rodata.strdata.368"), aligned(8)));
+static struct S_strliteral_2e369 D_strliteral_2e369 __asm__("strliteral.369") __attribute__((used, section(".data.rel.ro.strliteral.369"), aligned(8)));
+static const struct S_strdata_2e370 D_strdata_2e370 __asm__("strdata.370") __attribute__((used, section(".rodata.strdata.370"), aligned(8)));
+static struct S_strliteral_2e371 D_strliteral_2e371 __asm__("strliteral.371") __attribute__((used, section(".data.rel.ro.strliteral.371"), aligned(8)));
+static const struct S_strdata_2e372 D_strdata_2e372 __asm__("strdata.372") __attribute__((used, section(".rodata.strdata.372"), aligned(8)));
+static struct S_strliteral_2e373 D_strliteral_2e373 __asm__("strliteral.373") __attribute__((used, section(".data.rel.ro.strliteral.373"), aligned(8)));
+static const struct S_strdata_2e374 D_strdata_2e374 __asm__("strdata.374") __attribute__((used, section(".rodata.strdata.374"), aligned(8)));
+static struct S_strliteral_2e375 D_strliteral_2e375 __asm__("strliteral.375") __attribute__((used, section(".data.rel.ro.strliteral.375"), aligned(8)));
+static const struct S_strdata_2e376 D_strdata_2e376 __asm__("strdata.376") __attribute__((used, section(".rodata.strdata.376"), aligned(8)));
+static struct S_strliteral_2e377 D_strliteral_2e377 __asm__("strliteral.377") __attribute__((used, section(".data.rel.ro.strliteral.377"), aligned(8)));
+static const struct S_strdata_2e378 D_strdata_2e378 __asm__("strdata.378") __attribute__((used, section(".rodata.strdata.378"), aligned(8)));
+static struct S_strliteral_2e379 D_strliteral_2e379 __asm__("strliteral.379") __attribute__((used, section(".data.rel.ro.strliteral.379"), aligned(8)));
+static const struct S_strdata_2e380 D_strdata_2e380 __asm__("strdata.380") __attribute__((used, section(".rodata.strdata.380"), aligned(8)));
+static struct S_strliteral_2e381 D_strliteral_2e381 __asm__("strliteral.381") __attribute__((used, section(".data.rel.ro.strliteral.381"), aligned(8)));
+static const struct S_strdata_2e382 D_strdata_2e382 __asm__("strdata.382") __attribute__((used, section(".rodata.strdata.382"), aligned(8)));
+static struct S_strliteral_2e383 D_strliteral_2e383 __asm__("strliteral.383") __attribute__((used, section(".data.rel.ro.strliteral.383"), aligned(8)));
+static const struct S_strdata_2e384 D_strdata_2e384 __asm__("strdata.384") __attribute__((used, section(".rodata.strdata.384"), aligned(8)));
+static struct S_strliteral_2e385 D_strliteral_2e385 __asm__("strliteral.385") __attribute__((used, section(".data.rel.ro.strliteral.385"), aligned(8)));
+static const struct S_strdata_2e386 D_strdata_2e386 __asm__("strdata.386") __attribute__((used, section(".rodata.strdata.386"), aligned(8)));
+static struct S_strliteral_2e387 D_strliteral_2e387 __asm__("strliteral.387") __attribute__((used, section(".data.rel.ro.strliteral.387"), aligned(8)));
+static const struct S_strdata_2e388 D_strdata_2e388 __asm__("strdata.388") __attribute__((used, section(".rodata.strdata.388"), aligned(8)));
+static struct S_strliteral_2e389 D_strliteral_2e389 __asm__("strliteral.389") __attribute__((used, section(".data.rel.ro.strliteral.389"), aligned(8)));
+static const struct S_strdata_2e390 D_strdata_2e390 __asm__("strdata.390") __attribute__((used, section(".rodata.strdata.390"), aligned(8)));
+static struct S_strliteral_2e391 D_strliteral_2e391 __asm__("strliteral.391") __attribute__((used, section(".data.rel.ro.strliteral.391"), aligned(8)));
+static const struct S_strdata_2e392 D_strdata_2e392 __asm__("strdata.392") __attribute__((used, section(".rodata.strdata.392"), aligned(8)));
+static struct S_strliteral_2e393 D_strliteral_2e393 __asm__("strliteral.393") __attribute__((used, section(".data.rel.ro.strliteral.393"), aligned(8)));
+static const struct S_strdata_2e394 D_strdata_2e394 __asm__("strdata.394") __attribute__((used, section(".rodata.strdata.394"), aligned(8)));
+static struct S_strliteral_2e395 D_strliteral_2e395 __asm__("strliteral.395") __attribute__((used, section(".data.rel.ro.strliteral.395"), aligned(8)));
+static const struct S_strdata_2e396 D_strdata_2e396 __asm__("strdata.396") __attribute__((used, section(".rodata.strdata.396"), aligned(8)));
+static struct S_strliteral_2e397 D_strliteral_2e397 __asm__("strliteral.397") __attribute__((used, section(".data.rel.ro.strliteral.397"), aligned(8)));
+static const struct S_strdata_2e398 D_strdata_2e398 __asm__("strdata.398") __attribute__((used, section(".rodata.strdata.398"), aligned(8)));
+static struct S_strliteral_2e399 D_strliteral_2e399 __asm__("strliteral.399") __attribute__((used, section(".data.rel.ro.strliteral.399"), aligned(8)));
+static const struct S_strdata_2e400 D_strdata_2e400 __asm__("strdata.400") __attribute__((used, section(".rodata.strdata.400"), aligned(8)));
+static struct S_strliteral_2e401 D_strliteral_2e401 __asm__("strliteral.401") __attribute__((used, section(".data.rel.ro.strliteral.401"), aligned(8)));
+static const struct S_strdata_2e402 D_strdata_2e402 __asm__("strdata.402") __attribute__((used, section(".rodata.strdata.402"), aligned(8)));
+static struct S_strliteral_2e403 D_strliteral_2e403 __asm__("strliteral.403") __attribute__((used, section(".data.rel.ro.strliteral.403"), aligned(8)));
+static const struct S_strdata_2e404 D_strdata_2e404 __asm__("strdata.404") __attribute__((used, section(".rodata.strdata.404"), aligned(8)));
+static struct S_strliteral_2e405 D_strliteral_2e405 __asm__("strliteral.405") __attribute__((used, section(".data.rel.ro.strliteral.405"), aligned(8)));
+static const struct S_strdata_2e406 D_strdata_2e406 __asm__("strdata.406") __attribute__((used, section(".rodata.strdata.406"), aligned(8)));
+static struct S_strliteral_2e407 D_strliteral_2e407 __asm__("strliteral.407") __attribute__((used, section(".data.rel.ro.strliteral.407"), aligned(8)));
+static const struct S_strdata_2e408 D_strdata_2e408 __asm__("strdata.408") __attribute__((used, section(".rodata.strdata.408"), aligned(8)));
+static struct S_strliteral_2e409 D_strliteral_2e409 __asm__("strliteral.409") __attribute__((used, section(".data.rel.ro.strliteral.409"), aligned(8)));
+static const struct S_strdata_2e410 D_strdata_2e410 __asm__("strdata.410") __attribute__((used, section(".rodata.strdata.410"), aligned(8)));
+static struct S_strliteral_2e411 D_strliteral_2e411 __asm__("strliteral.411") __attribute__((used, section(".data.rel.ro.strliteral.411"), aligned(8)));
+static const struct S_strdata_2e412 D_strdata_2e412 __asm__("strdata.412") __attribute__((used, section(".rodata.strdata.412"), aligned(8)));
+static struct S_strliteral_2e413 D_strliteral_2e413 __asm__("strliteral.413") __attribute__((used, section(".data.rel.ro.strliteral.413"), aligned(8)));
+static const struct S_strdata_2e414 D_strdata_2e414 __asm__("strdata.414") __attribute__((used, section(".rodata.strdata.414"), aligned(8)));
+static struct S_strliteral_2e415 D_strliteral_2e415 __asm__("strliteral.415") __attribute__((used, section(".data.rel.ro.strliteral.415"), aligned(8)));
+static const struct S_strdata_2e416 D_strdata_2e416 __asm__("strdata.416") __attribute__((used, section(".rodata.strdata.416"), aligned(8)));
+static struct S_strliteral_2e417 D_strliteral_2e417 __asm__("strliteral.417") __attribute__((used, section(".data.rel.ro.strliteral.417"), aligned(8)));
+static const struct S_strdata_2e418 D_strdata_2e418 __asm__("strdata.418") __attribute__((used, section(".rodata.strdata.418"), aligned(8)));
+static struct S_strliteral_2e419 D_strliteral_2e419 __asm__("strliteral.419") __attribute__((used, section(".data.rel.ro.strliteral.419"), aligned(8)));
+static const struct S_strdata_2e420 D_strdata_2e420 __asm__("strdata.420") __attribute__((used, section(".rodata.strdata.420"), aligned(8)));
+static struct S_strliteral_2e421 D_strliteral_2e421 __asm__("strliteral.421") __attribute__((used, section(".data.rel.ro.strliteral.421"), aligned(8)));
+static const struct S_strdata_2e422 D_strdata_2e422 __asm__("strdata.422") __attribute__((used, section(".rodata.strdata.422"), aligned(8)));
+static struct S_strliteral_2e423 D_strliteral_2e423 __asm__("strliteral.423") __attribute__((used, section(".data.rel.ro.strliteral.423"), aligned(8)));
+static const struct S_strdata_2e424 D_strdata_2e424 __asm__("strdata.424") __attribute__((used, section(".rodata.strdata.424"), aligned(8)));
+static struct S_strliteral_2e425 D_strliteral_2e425 __asm__("strliteral.425") __attribute__((used, section(".data.rel.ro.strliteral.425"), aligned(8)));
+static const struct S_strdata_2e426 D_strdata_2e426 __asm__("strdata.426") __attribute__((used, section(".rodata.strdata.426"), aligned(8)));
+static struct S_strliteral_2e427 D_strliteral_2e427 __asm__("strliteral.427") __attribute__((used, section(".data.rel.ro.strliteral.427"), aligned(8)));
+static const struct S_strdata_2e428 D_strdata_2e428 __asm__("strdata.428") __attribute__((used, section(".rodata.strdata.428"), aligned(8)));
+static struct S_strliteral_2e429 D_strliteral_2e429 __asm__("strliteral.429") __attribute__((used, section(".data.rel.ro.strliteral.429"), aligned(8)));
+static const struct S_strdata_2e430 D_strdata_2e430 __asm__("strdata.430") __attribute__((used, section(".rodata.strdata.430"), aligned(8)));
+static struct S_strliteral_2e431 D_strliteral_2e431 __asm__("strliteral.431") __attribute__((used, section(".data.rel.ro.strliteral.431"), aligned(8)));
+static const struct S_strdata_2e432 D_strdata_2e432 __asm__("strdata.432") __attribute__((used, section(".rodata.strdata.432"), aligned(8)));
+static struct S_strliteral_2e433 D_strliteral_2e433 __asm__("strliteral.433") __attribute__((used, section(".data.rel.ro.strliteral.433"), aligned(8)));
+static const struct S_strdata_2e434 D_strdata_2e434 __asm__("strdata.434") __attribute__((used, section(".rodata.strdata.434"), aligned(8)));
+static struct S_strliteral_2e435 D_strliteral_2e435 __asm__("strliteral.435") __attribute__((used, section(".data.rel.ro.strliteral.435"), aligned(8)));
+static const struct S_strdata_2e436 D_strdata_2e436 __asm__("strdata.436") __attribute__((used, section(".rodata.strdata.436"), aligned(8)));
+static struct S_strliteral_2e437 D_strliteral_2e437 __asm__("strliteral.437") __attribute__((used, section(".data.rel.ro.strliteral.437"), aligned(8)));
+static struct S_abortsites_2e347 D_abortsites_2e347 __asm__("abortsites.347") __attribute__((used, section(".data.rel.ro.abortsites.347"), aligned(8)));
+static const struct S_strdata_2e1040 D_strdata_2e1040 __asm__("strdata.1040") __attribute__((used, section(".rodata.strdata.1040"), aligned(8)));
+static struct S_strliteral_2e1041 D_strliteral_2e1041 __asm__("strliteral.1041") __attribute__((used, section(".data.rel.ro.strliteral.1041"), aligned(8)));
+static const struct S_strdata_2e1042 D_strdata_2e1042 __asm__("strdata.1042") __attribute__((used, section(".rodata.strdata.1042"), aligned(8)));
+static struct S_strliteral_2e1043 D_strliteral_2e1043 __asm__("strliteral.1043") __attribute__((used, section(".data.rel.ro.strliteral.1043"), aligned(8)));
+static const struct S_strdata_2e1044 D_strdata_2e1044 __asm__("strdata.1044") __attribute__((used, section(".rodata.strdata.1044"), aligned(8)));
+static struct S_strliteral_2e1045 D_strliteral_2e1045 __asm__("strliteral.1045") __attribute__((used, section(".data.rel.ro.strliteral.1045"), aligned(8)));
+static const struct S_strdata_2e1046 D_strdata_2e1046 __asm__("strdata.1046") __attribute__((used, section(".rodata.strdata.1046"), aligned(8)));
+static struct S_strliteral_2e1047 D_strliteral_2e1047 __asm__("strliteral.1047") __attribute__((used, section(".data.rel.ro.strliteral.1047"), aligned(8)));
+static const struct S_strdata_2e1048 D_strdata_2e1048 __asm__("strdata.1048") __attribute__((used, section(".rodata.strdata.1048"), aligned(8)));
+static struct S_strliteral_2e1049 D_strliteral_2e1049 __asm__("strliteral.1049") __attribute__((used, section(".data.rel.ro.strliteral.1049"), aligned(8)));
+static const struct S_strdata_2e1050 D_strdata_2e1050 __asm__("strdata.1050") __attribute__((used, section(".rodata.strdata.1050"), aligned(8)));
+static struct S_strliteral_2e1051 D_strliteral_2e1051 __asm__("strliteral.1051") __attribute__((used, section(".data.rel.ro.strliteral.1051"), aligned(8)));
+static const struct S_strdata_2e1052 D_strdata_2e1052 __asm__("strdata.1052") __attribute__((used, section(".rodata.strdata.1052"), aligned(8)));
+static struct S_strliteral_2e1053 D_strliteral_2e1053 __asm__("strliteral.1053") __attribute__((used, section(".data.rel.ro.strliteral.1053"), aligned(8)));
+static const struct S_strdata_2e1054 D_strdata_2e1054 __asm__("strdata.1054") __attribute__((used, section(".rodata.strdata.1054"), aligned(8)));
+static struct S_strliteral_2e1055 D_strliteral_2e1055 __asm__("strliteral.1055") __attribute__((used, section(".data.rel.ro.strliteral.1055"), aligned(8)));
+static const struct S_strdata_2e1056 D_strdata_2e1056 __asm__("strdata.1056") __attribute__((used, section(".rodata.strdata.1056"), aligned(8)));
+static struct S_strliteral_2e1057 D_strliteral_2e1057 __asm__("strliteral.1057") __attribute__((used, section(".data.rel.ro.strliteral.1057"), aligned(8)));
+static const struct S_strdata_2e1058 D_strdata_2e1058 __asm__("strdata.1058") __attribute__((used, section(".rodata.strdata.1058"), aligned(8)));
+static struct S_strliteral_2e1059 D_strliteral_2e1059 __asm__("strliteral.1059") __attribute__((used, section(".data.rel.ro.strliteral.1059"), aligned(8)));
+static const struct S_strdata_2e1060 D_strdata_2e1060 __asm__("strdata.1060") __attribute__((used, section(".rodata.strdata.1060"), aligned(8)));
+static struct S_strliteral_2e1061 D_strliteral_2e1061 __asm__("strliteral.1061") __attribute__((used, section(".data.rel.ro.strliteral.1061"), aligned(8)));
+static const struct S_strdata_2e1062 D_strdata_2e1062 __asm__("strdata.1062") __attribute__((used, section(".rodata.strdata.1062"), aligned(8)));
+static struct S_strliteral_2e1063 D_strliteral_2e1063 __asm__("strliteral.1063") __attribute__((used, section(".data.rel.ro.strliteral.1063"), aligned(8)));
+static const struct S_strdata_2e1064 D_strdata_2e1064 __asm__("strdata.1064") __attribute__((used, section(".rodata.strdata.1064"), aligned(8)));
+static struct S_strliteral_2e1065 D_strliteral_2e1065 __asm__("strliteral.1065") __attribute__((used, section(".data.rel.ro.strliteral.1065"), aligned(8)));
+static const struct S_strdata_2e1066 D_strdata_2e1066 __asm__("strdata.1066") __attribute__((used, section(".rodata.strdata.1066"), aligned(8)));
+static struct S_strliteral_2e1067 D_strliteral_2e1067 __asm__("strliteral.1067") __attribute__((used, section(".data.rel.ro.strliteral.1067"), aligned(8)));
+static const struct S_strdata_2e1068 D_strdata_2e1068 __asm__("strdata.1068") __attribute__((used, section(".rodata.strdata.1068"), aligned(8)));
+static struct S_strliteral_2e1069 D_strliteral_2e1069 __asm__("strliteral.1069") __attribute__((used, section(".data.rel.ro.strliteral.1069"), aligned(8)));
+static const struct S_strdata_2e1070 D_strdata_2e1070 __asm__("strdata.1070") __attribute__((used, section(".rodata.strdata.1070"), aligned(8)));
+static struct S_strliteral_2e1071 D_strliteral_2e1071 __asm__("strliteral.1071") __attribute__((used, section(".data.rel.ro.strliteral.1071"), aligned(8)));
+static const struct S_strdata_2e1072 D_strdata_2e1072 __asm__("strdata.1072") __attribute__((used, section(".rodata.strdata.1072"), aligned(8)));
+static struct S_strliteral_2e1073 D_strliteral_2e1073 __asm__("strliteral.1073") __attribute__((used, section(".data.rel.ro.strliteral.1073"), aligned(8)));
+static const struct S_strdata_2e1074 D_strdata_2e1074 __asm__("strdata.1074") __attribute__((used, section(".rodata.strdata.1074"), aligned(8)));
+static struct S_strliteral_2e1075 D_strliteral_2e1075 __asm__("strliteral.1075") __attribute__((used, section(".data.rel.ro.strliteral.1075"), aligned(8)));
+static const struct S_strdata_2e1076 D_strdata_2e1076 __asm__("strdata.1076") __attribute__((used, section(".rodata.strdata.1076"), aligned(8)));
+static struct S_strliteral_2e1077 D_strliteral_2e1077 __asm__("strliteral.1077") __attribute__((used, section(".data.rel.ro.strliteral.1077"), aligned(8)));
+static const struct S_strdata_2e1078 D_strdata_2e1078 __asm__("strdata.1078") __attribute__((used, section(".rodata.strdata.1078"), aligned(8)));
+static struct S_strliteral_2e1079 D_strliteral_2e1079 __asm__("strliteral.1079") __attribute__((used, section(".data.rel.ro.strliteral.1079"), aligned(8)));
+static const struct S_strdata_2e1080 D_strdata_2e1080 __asm__("strdata.1080") __attribute__((used, section(".rodata.strdata.1080"), aligned(8)));
+static struct S_strliteral_2e1081 D_strliteral_2e1081 __asm__("strliteral.1081") __attribute__((used, section(".data.rel.ro.strliteral.1081"), aligned(8)));
+static const struct S_strdata_2e1082 D_strdata_2e1082 __asm__("strdata.1082") __attribute__((used, section(".rodata.strdata.1082"), aligned(8)));
+static struct S_strliteral_2e1083 D_strliteral_2e1083 __asm__("strliteral.1083") __attribute__((used, section(".data.rel.ro.strliteral.1083"), aligned(8)));
+static const struct S_strdata_2e1084 D_strdata_2e1084 __asm__("strdata.1084") __attribute__((used, section(".rodata.strdata.1084"), aligned(8)));
+static struct S_strliteral_2e1085 D_strliteral_2e1085 __asm__("strliteral.1085") __attribute__((used, section(".data.rel.ro.strliteral.1085"), aligned(8)));
+static const struct S_strdata_2e1086 D_strdata_2e1086 __asm__("strdata.1086") __attribute__((used, section(".rodata.strdata.1086"), aligned(8)));
+static struct S_strliteral_2e1087 D_strliteral_2e1087 __asm__("strliteral.1087") __attribute__((used, section(".data.rel.ro.strliteral.1087"), aligned(8)));
+static const struct S_strdata_2e1088 D_strdata_2e1088 __asm__("strdata.1088") __attribute__((used, section(".rodata.strdata.1088"), aligned(8)));
+static struct S_strliteral_2e1089 D_strliteral_2e1089 __asm__("strliteral.1089") __attribute__((used, section(".data.rel.ro.strliteral.1089"), aligned(8)));
+static const struct S_strdata_2e1090 D_strdata_2e1090 __asm__("strdata.1090") __attribute__((used, section(".rodata.strdata.1090"), aligned(8)));
+static struct S_strliteral_2e1091 D_strliteral_2e1091 __asm__("strliteral.1091") __attribute__((used, section(".data.rel.ro.strliteral.1091"), aligned(8)));
+static const struct S_strdata_2e1092 D_strdata_2e1092 __asm__("strdata.1092") __attribute__((used, section(".rodata.strdata.1092"), aligned(8)));
+static struct S_strliteral_2e1093 D_strliteral_2e1093 __asm__("strliteral.1093") __attribute__((used, section(".data.rel.ro.strliteral.1093"), aligned(8)));
+static const struct S_strdata_2e1094 D_strdata_2e1094 __asm__("strdata.1094") __attribute__((used, section(".rodata.strdata.1094"), aligned(8)));
+static struct S_strliteral_2e1095 D_strliteral_2e1095 __asm__("strliteral.1095") __attribute__((used, section(".data.rel.ro.strliteral.1095"), aligned(8)));
+static const struct S_strdata_2e1096 D_strdata_2e1096 __asm__("strdata.1096") __attribute__((used, section(".rodata.strdata.1096"), aligned(8)));
+static struct S_strliteral_2e1097 D_strliteral_2e1097 __asm__("strliteral.1097") __attribute__((used, section(".data.rel.ro.strliteral.1097"), aligned(8)));
+static const struct S_strdata_2e1098 D_strdata_2e1098 __asm__("strdata.1098") __attribute__((used, section(".rodata.strdata.1098"), aligned(8)));
+static struct S_strliteral_2e1099 D_strliteral_2e1099 __asm__("strliteral.1099") __attribute__((used, section(".data.rel.ro.strliteral.1099"), aligned(8)));
+static const struct S_strdata_2e1100 D_strdata_2e1100 __asm__("strdata.1100") __attribute__((used, section(".rodata.strdata.1100"), aligned(8)));
+static struct S_strliteral_2e1101 D_strliteral_2e1101 __asm__("strliteral.1101") __attribute__((used, section(".data.rel.ro.strliteral.1101"), aligned(8)));
+static const struct S_strdata_2e1102 D_strdata_2e1102 __asm__("strdata.1102") __attribute__((used, section(".rodata.strdata.1102"), aligned(8)));
+static struct S_strliteral_2e1103 D_strliteral_2e1103 __asm__("strliteral.1103") __attribute__((used, section(".data.rel.ro.strliteral.1103"), aligned(8)));
+static const struct S_strdata_2e1104 D_strdata_2e1104 __asm__("strdata.1104") __attribute__((used, section(".rodata.strdata.1104"), aligned(8)));
+static struct S_strliteral_2e1105 D_strliteral_2e1105 __asm__("strliteral.1105") __attribute__((used, section(".data.rel.ro.strliteral.1105"), aligned(8)));
+static const struct S_strdata_2e1106 D_strdata_2e1106 __asm__("strdata.1106") __attribute__((used, section(".rodata.strdata.1106"), aligned(8)));
+static struct S_strliteral_2e1107 D_strliteral_2e1107 __asm__("strliteral.1107") __attribute__((used, section(".data.rel.ro.strliteral.1107"), aligned(8)));
+static const struct S_strdata_2e1108 D_strdata_2e1108 __asm__("strdata.1108") __attribute__((used, section(".rodata.strdata.1108"), aligned(8)));
+static struct S_strliteral_2e1109 D_strliteral_2e1109 __asm__("strliteral.1109") __attribute__((used, section(".data.rel.ro.strliteral.1109"), aligned(8)));
+static const struct S_strdata_2e1110 D_strdata_2e1110 __asm__("strdata.1110") __attribute__((used, section(".rodata.strdata.1110"), aligned(8)));
+static struct S_strliteral_2e1111 D_strliteral_2e1111 __asm__("strliteral.1111") __attribute__((used, section(".data.rel.ro.strliteral.1111"), aligned(8)));
+static const struct S_strdata_2e1112 D_strdata_2e1112 __asm__("strdata.1112") __attribute__((used, section(".rodata.strdata.1112"), aligned(8)));
+static struct S_strliteral_2e1113 D_strliteral_2e1113 __asm__("strliteral.1113") __attribute__((used, section(".data.rel.ro.strliteral.1113"), aligned(8)));
+static const struct S_strdata_2e1114 D_strdata_2e1114 __asm__("strdata.1114") __attribute__((used, section(".rodata.strdata.1114"), aligned(8)));
+static struct S_strliteral_2e1115 D_strliteral_2e1115 __asm__("strliteral.1115") __attribute__((used, section(".data.rel.ro.strliteral.1115"), aligned(8)));
+static const struct S_strdata_2e1116 D_strdata_2e1116 __asm__("strdata.1116") __attribute__((used, section(".rodata.strdata.1116"), aligned(8)));
+static struct S_strliteral_2e1117 D_strliteral_2e1117 __asm__("strliteral.1117") __attribute__((used, section(".data.rel.ro.strliteral.1117"), aligned(8)));
+static const struct S_strdata_2e1118 D_strdata_2e1118 __asm__("strdata.1118") __attribute__((used, section(".rodata.strdata.1118"), aligned(8)));
+static struct S_strliteral_2e1119 D_strliteral_2e1119 __asm__("strliteral.1119") __attribute__((used, section(".data.rel.ro.strliteral.1119"), aligned(8)));
+static const struct S_strdata_2e1120 D_strdata_2e1120 __asm__("strdata.1120") __attribute__((used, section(".rodata.strdata.1120"), aligned(8)));
+static struct S_strliteral_2e1121 D_strliteral_2e1121 __asm__("strliteral.1121") __attribute__((used, section(".data.rel.ro.strliteral.1121"), aligned(8)));
+static const struct S_strdata_2e1122 D_strdata_2e1122 __asm__("strdata.1122") __attribute__((used, section(".rodata.strdata.1122"), aligned(8)));
+static struct S_strliteral_2e1123 D_strliteral_2e1123 __asm__("strliteral.1123") __attribute__((used, section(".data.rel.ro.strliteral.1123"), aligned(8)));
+static const struct S_strdata_2e1124 D_strdata_2e1124 __asm__("strdata.1124") __attribute__((used, section(".rodata.strdata.1124"), aligned(8)));
+static struct S_strliteral_2e1125 D_strliteral_2e1125 __asm__("strliteral.1125") __attribute__((used, section(".data.rel.ro.strliteral.1125"), aligned(8)));
+static const struct S_strdata_2e1126 D_strdata_2e1126 __asm__("strdata.1126") __attribute__((used, section(".rodata.strdata.1126"), aligned(8)));
+static struct S_strliteral_2e1127 D_strliteral_2e1127 __asm__("strliteral.1127") __attribute__((used, section(".data.rel.ro.strliteral.1127"), aligned(8)));
+static const struct S_strdata_2e1128 D_strdata_2e1128 __asm__("strdata.1128") __attribute__((used, section(".rodata.strdata.1128"), aligned(8)));
+static struct S_strliteral_2e1129 D_strliteral_2e1129 __asm__("strliteral.1129") __attribute__((used, section(".data.rel.ro.strliteral.1129"), aligned(8)));
+static const struct S_strdata_2e1130 D_strdata_2e1130 __asm__("strdata.1130") __attribute__((used, section(".rodata.strdata.1130"), aligned(8)));
+static struct S_strliteral_2e1131 D_strliteral_2e1131 __asm__("strliteral.1131") __attribute__((used, section(".data.rel.ro.strliteral.1131"), aligned(8)));
+static const struct S_strdata_2e1132 D_strdata_2e1132 __asm__("strdata.1132") __attribute__((used, section(".rodata.strdata.1132"), aligned(8)));
+static struct S_strliteral_2e1133 D_strliteral_2e1133 __asm__("strliteral.1133") __attribute__((used, section(".data.rel.ro.strliteral.1133"), aligned(8)));
+static const struct S_strdata_2e1134 D_strdata_2e1134 __asm__("strdata.1134") __attribute__((used, section(".rodata.strdata.1134"), aligned(8)));
+static struct S_strliteral_2e1135 D_strliteral_2e1135 __asm__("strliteral.1135") __attribute__((used, section(".data.rel.ro.strliteral.1135"), aligned(8)));
+static const struct S_strdata_2e1136 D_strdata_2e1136 __asm__("strdata.1136") __attribute__((used, section(".rodata.strdata.1136"), aligned(8)));
+static struct S_strliteral_2e1137 D_strliteral_2e1137 __asm__("strliteral.1137") __attribute__((used, section(".data.rel.ro.strliteral.1137"), aligned(8)));
+static const struct S_strdata_2e1138 D_strdata_2e1138 __asm__("strdata.1138") __attribute__((used, section(".rodata.strdata.1138"), aligned(8)));
+static struct S_strliteral_2e1139 D_strliteral_2e1139 __asm__("strliteral.1139") __attribute__((used, section(".data.rel.ro.strliteral.1139"), aligned(8)));
+static const struct S_strdata_2e1140 D_strdata_2e1140 __asm__("strdata.1140") __attribute__((used, section(".rodata.strdata.1140"), aligned(8)));
+static struct S_strliteral_2e1141 D_strliteral_2e1141 __asm__("strliteral.1141") __attribute__((used, section(".data.rel.ro.strliteral.1141"), aligned(8)));
+static const struct S_strdata_2e1142 D_strdata_2e1142 __asm__("strdata.1142") __attribute__((used, section(".rodata.strdata.1142"), aligned(8)));
+static struct S_strliteral_2e1143 D_strliteral_2e1143 __asm__("strliteral.1143") __attribute__((used, section(".data.rel.ro.strliteral.1143"), aligned(8)));
+static const struct S_strdata_2e1144 D_strdata_2e1144 __asm__("strdata.1144") __attribute__((used, section(".rodata.strdata.1144"), aligned(8)));
+static struct S_strliteral_2e1145 D_strliteral_2e1145 __asm__("strliteral.1145") __attribute__((used, section(".data.rel.ro.strliteral.1145"), aligned(8)));
+static const struct S_strdata_2e1146 D_strdata_2e1146 __asm__("strdata.1146") __attribute__((used, section(".rodata.strdata.1146"), aligned(8)));
+static struct S_strliteral_2e1147 D_strliteral_2e1147 __asm__("strliteral.1147") __attribute__((used, section(".data.rel.ro.strliteral.1147"), aligned(8)));
+static const struct S_strdata_2e1148 D_strdata_2e1148 __asm__("strdata.1148") __attribute__((used, section(".rodata.strdata.1148"), aligned(8)));
+static struct S_strliteral_2e1149 D_strliteral_2e1149 __asm__("strliteral.1149") __attribute__((used, section(".data.rel.ro.strliteral.1149"), aligned(8)));
+static const struct S_strdata_2e1150 D_strdata_2e1150 __asm__("strdata.1150") __attribute__((used, section(".rodata.strdata.1150"), aligned(8)));
+static struct S_strliteral_2e1151 D_strliteral_2e1151 __asm__("strliteral.1151") __attribute__((used, section(".data.rel.ro.strliteral.1151"), aligned(8)));
+static const struct S_strdata_2e1152 D_strdata_2e1152 __asm__("strdata.1152") __attribute__((used, section(".rodata.strdata.1152"), aligned(8)));
+static struct S_strliteral_2e1153 D_strliteral_2e1153 __asm__("strliteral.1153") __attribute__((used, section(".data.rel.ro.strliteral.1153"), aligned(8)));
+static const struct S_strdata_2e1154 D_strdata_2e1154 __asm__("strdata.1154") __attribute__((used, section(".rodata.strdata.1154"), aligned(8)));
+static struct S_strliteral_2e1155 D_strliteral_2e1155 __asm__("strliteral.1155") __attribute__((used, section(".data.rel.ro.strliteral.1155"), aligned(8)));
+static const struct S_strdata_2e1156 D_strdata_2e1156 __asm__("strdata.1156") __attribute__((used, section(".rodata.strdata.1156"), aligned(8)));
+static struct S_strliteral_2e1157 D_strliteral_2e1157 __asm__("strliteral.1157") __attribute__((used, section(".data.rel.ro.strliteral.1157"), aligned(8)));
+static const struct S_strdata_2e1158 D_strdata_2e1158 __asm__("strdata.1158") __attribute__((used, section(".rodata.strdata.1158"), aligned(8)));
+static struct S_strliteral_2e1159 D_strliteral_2e1159 __asm__("strliteral.1159") __attribute__((used, section(".data.rel.ro.strliteral.1159"), aligned(8)));
+static const struct S_strdata_2e1160 D_strdata_2e1160 __asm__("strdata.1160") __attribute__((used, section(".rodata.strdata.1160"), aligned(8)));
+static struct S_strliteral_2e1161 D_strliteral_2e1161 __asm__("strliteral.1161") __attribute__((used, section(".data.rel.ro.strliteral.1161"), aligned(8)));
+static const struct S_strdata_2e1162 D_strdata_2e1162 __asm__("strdata.1162") __attribute__((used, section(".rodata.strdata.1162"), aligned(8)));
+static struct S_strliteral_2e1163 D_strliteral_2e1163 __asm__("strliteral.1163") __attribute__((used, section(".data.rel.ro.strliteral.1163"), aligned(8)));
+static const struct S_strdata_2e1164 D_strdata_2e1164 __asm__("strdata.1164") __attribute__((used, section(".rodata.strdata.1164"), aligned(8)));
+static struct S_strliteral_2e1165 D_strliteral_2e1165 __asm__("strliteral.1165") __attribute__((used, section(".data.rel.ro.strliteral.1165"), aligned(8)));
+static const struct S_strdata_2e1166 D_strdata_2e1166 __asm__("strdata.1166") __attribute__((used, section(".rodata.strdata.1166"), aligned(8)));
+static struct S_strliteral_2e1167 D_strliteral_2e1167 __asm__("strliteral.1167") __attribute__((used, section(".data.rel.ro.strliteral.1167"), aligned(8)));
+static const struct S_strdata_2e1168 D_strdata_2e1168 __asm__("strdata.1168") __attribute__((used, section(".rodata.strdata.1168"), aligned(8)));
+static struct S_strliteral_2e1169 D_strliteral_2e1169 __asm__("strliteral.1169") __attribute__((used, section(".data.rel.ro.strliteral.1169"), aligned(8)));
+static const struct S_strdata_2e1170 D_strdata_2e1170 __asm__("strdata.1170") __attribute__((used, section(".rodata.strdata.1170"), aligned(8)));
+static struct S_strliteral_2e1171 D_strliteral_2e1171 __asm__("strliteral.1171") __attribute__((used, section(".data.rel.ro.strliteral.1171"), aligned(8)));
+static const struct S_strdata_2e1172 D_strdata_2e1172 __asm__("strdata.1172") __attribute__((used, section(".rodata.strdata.1172"), aligned(8)));
+static struct S_strliteral_2e1173 D_strliteral_2e1173 __asm__("strliteral.1173") __attribute__((used, section(".data.rel.ro.strliteral.1173"), aligned(8)));
+static const struct S_strdata_2e1174 D_strdata_2e1174 __asm__("strdata.1174") __attribute__((used, section(".rodata.strdata.1174"), aligned(8)));
+static struct S_strliteral_2e1175 D_strliteral_2e1175 __asm__("strliteral.1175") __attribute__((used, section(".data.rel.ro.strliteral.1175"), aligned(8)));
+static const struct S_strdata_2e1176 D_strdata_2e1176 __asm__("strdata.1176") __attribute__((used, section(".rodata.strdata.1176"), aligned(8)));
+static struct S_strliteral_2e1177 D_strliteral_2e1177 __asm__("strliteral.1177") __attribute__((used, section(".data.rel.ro.strliteral.1177"), aligned(8)));
+static const struct S_strdata_2e1178 D_strdata_2e1178 __asm__("strdata.1178") __attribute__((used, section(".rodata.strdata.1178"), aligned(8)));
+static struct S_strliteral_2e1179 D_strliteral_2e1179 __asm__("strliteral.1179") __attribute__((used, section(".data.rel.ro.strliteral.1179"), aligned(8)));
+static const struct S_strdata_2e1180 D_strdata_2e1180 __asm__("strdata.1180") __attribute__((used, section(".rodata.strdata.1180"), aligned(8)));
+static struct S_strliteral_2e1181 D_strliteral_2e1181 __asm__("strliteral.1181") __attribute__((used, section(".data.rel.ro.strliteral.1181"), aligned(8)));
+static const struct S_strdata_2e1182 D_strdata_2e1182 __asm__("strdata.1182") __attribute__((used, section(".rodata.strdata.1182"), aligned(8)));
+static struct S_strliteral_2e1183 D_strliteral_2e1183 __asm__("strliteral.1183") __attribute__((used, section(".data.rel.ro.strliteral.1183"), aligned(8)));
+static const struct S_strdata_2e1184 D_strdata_2e1184 __asm__("strdata.1184") __attribute__((used, section(".rodata.strdata.1184"), aligned(8)));
+static struct S_strliteral_2e1185 D_strliteral_2e1185 __asm__("strliteral.1185") __attribute__((used, section(".data.rel.ro.strliteral.1185"), aligned(8)));
+static const struct S_strdata_2e1186 D_strdata_2e1186 __asm__("strdata.1186") __attribute__((used, section(".rodata.strdata.1186"), aligned(8)));
+static struct S_strliteral_2e1187 D_strliteral_2e1187 __asm__("strliteral.1187") __attribute__((used, section(".data.rel.ro.strliteral.1187"), aligned(8)));
+static const struct S_strdata_2e1188 D_strdata_2e1188 __asm__("strdata.1188") __attribute__((used, section(".rodata.strdata.1188"), aligned(8)));
+static struct S_strliteral_2e1189 D_strliteral_2e1189 __asm__("strliteral.1189") __attribute__((used, section(".data.rel.ro.strliteral.1189"), aligned(8)));
+static const struct S_strdata_2e1190 D_strdata_2e1190 __asm__("strdata.1190") __attribute__((used, section(".rodata.strdata.1190"), aligned(8)));
+static struct S_strliteral_2e1191 D_strliteral_2e1191 __asm__("strliteral.1191") __attribute__((used, section(".data.rel.ro.strliteral.1191"), aligned(8)));
+static const struct S_strdata_2e1192 D_strdata_2e1192 __asm__("strdata.1192") __attribute__((used, section(".rodata.strdata.1192"), aligned(8)));
+static struct S_strliteral_2e1193 D_strliteral_2e1193 __asm__("strliteral.1193") __attribute__((used, section(".data.rel.ro.strliteral.1193"), aligned(8)));
+static const struct S_strdata_2e1194 D_strdata_2e1194 __asm__("strdata.1194") __attribute__((used, section(".rodata.strdata.1194"), aligned(8)));
+static struct S_strliteral_2e1195 D_strliteral_2e1195 __asm__("strliteral.1195") __attribute__((used, section(".data.rel.ro.strliteral.1195"), aligned(8)));
+static const struct S_strdata_2e1196 D_strdata_2e1196 __asm__("strdata.1196") __attribute__((used, section(".rodata.strdata.1196"), aligned(8)));
+static struct S_strliteral_2e1197 D_strliteral_2e1197 __asm__("strliteral.1197") __attribute__((used, section(".data.rel.ro.strliteral.1197"), aligned(8)));
+static const struct S_strdata_2e1198 D_strdata_2e1198 __asm__("strdata.1198") __attribute__((used, section(".rodata.strdata.1198"), aligned(8)));
+static struct S_strliteral_2e1199 D_strliteral_2e1199 __asm__("strliteral.1199") __attribute__((used, section(".data.rel.ro.strliteral.1199"), aligned(8)));
+static const struct S_strdata_2e1200 D_strdata_2e1200 __asm__("strdata.1200") __attribute__((used, section(".rodata.strdata.1200"), aligned(8)));
+static struct S_strliteral_2e1201 D_strliteral_2e1201 __asm__("strliteral.1201") __attribute__((used, section(".data.rel.ro.strliteral.1201"), aligned(8)));
+static const struct S_strdata_2e1202 D_strdata_2e1202 __asm__("strdata.1202") __attribute__((used, section(".rodata.strdata.1202"), aligned(8)));
+static struct S_strliteral_2e1203 D_strliteral_2e1203 __asm__("strliteral.1203") __attribute__((used, section(".data.rel.ro.strliteral.1203"), aligned(8)));
+static const struct S_strdata_2e1204 D_strdata_2e1204 __asm__("strdata.1204") __attribute__((used, section(".rodata.strdata.1204"), aligned(8)));
+static struct S_strliteral_2e1205 D_strliteral_2e1205 __asm__("strliteral.1205") __attribute__((used, section(".data.rel.ro.strliteral.1205"), aligned(8)));
+static const struct S_strdata_2e1206 D_strdata_2e1206 __asm__("strdata.1206") __attribute__((used, section(".rodata.strdata.1206"), aligned(8)));
+static struct S_strliteral_2e1207 D_strliteral_2e1207 __asm__("strliteral.1207") __attribute__((used, section(".data.rel.ro.strliteral.1207"), aligned(8)));
+static const struct S_strdata_2e1208 D_strdata_2e1208 __asm__("strdata.1208") __attribute__((used, section(".rodata.strdata.1208"), aligned(8)));
+static struct S_strliteral_2e1209 D_strliteral_2e1209 __asm__("strliteral.1209") __attribute__((used, section(".data.rel.ro.strliteral.1209"), aligned(8)));
+static const struct S_strdata_2e1210 D_strdata_2e1210 __asm__("strdata.1210") __attribute__((used, section(".rodata.strdata.1210"), aligned(8)));
+static struct S_strliteral_2e1211 D_strliteral_2e1211 __asm__("strliteral.1211") __attribute__((used, section(".data.rel.ro.strliteral.1211"), aligned(8)));
+static const struct S_strdata_2e1212 D_strdata_2e1212 __asm__("strdata.1212") __attribute__((used, section(".rodata.strdata.1212"), aligned(8)));
+static struct S_strliteral_2e1213 D_strliteral_2e1213 __asm__("strliteral.1213") __attribute__((used, section(".data.rel.ro.strliteral.1213"), aligned(8)));
+static const struct S_strdata_2e1214 D_strdata_2e1214 __asm__("strdata.1214") __attribute__((used, section(".rodata.strdata.1214"), aligned(8)));
+static struct S_strliteral_2e1215 D_strliteral_2e1215 __asm__("strliteral.1215") __attribute__((used, section(".data.rel.ro.strliteral.1215"), aligned(8)));
+static const struct S_strdata_2e1216 D_strdata_2e1216 __asm__("strdata.1216") __attribute__((used, section(".rodata.strdata.1216"), aligned(8)));
+static struct S_strliteral_2e1217 D_strliteral_2e1217 __asm__("strliteral.1217") __attribute__((used, section(".data.rel.ro.strliteral.1217"), aligned(8)));
+static const struct S_strdata_2e1218 D_strdata_2e1218 __asm__("strdata.1218") __attribute__((used, section(".rodata.strdata.1218"), aligned(8)));
+static struct S_strliteral_2e1219 D_strliteral_2e1219 __asm__("strliteral.1219") __attribute__((used, section(".data.rel.ro.strliteral.1219"), aligned(8)));
+static const struct S_strdata_2e1220 D_strdata_2e1220 __asm__("strdata.1220") __attribute__((used, section(".rodata.strdata.1220"), aligned(8)));
+static struct S_strliteral_2e1221 D_strliteral_2e1221 __asm__("strliteral.1221") __attribute__((used, section(".data.rel.ro.strliteral.1221"), aligned(8)));
+static const struct S_strdata_2e1222 D_strdata_2e1222 __asm__("strdata.1222") __attribute__((used, section(".rodata.strdata.1222"), aligned(8)));
+static struct S_strliteral_2e1223 D_strliteral_2e1223 __asm__("strliteral.1223") __attribute__((used, section(".data.rel.ro.strliteral.1223"), aligned(8)));
+static const struct S_strdata_2e1224 D_strdata_2e1224 __asm__("strdata.1224") __attribute__((used, section(".rodata.strdata.1224"), aligned(8)));
+static struct S_strliteral_2e1225 D_strliteral_2e1225 __asm__("strliteral.1225") __attribute__((used, section(".data.rel.ro.strliteral.1225"), aligned(8)));
+static const struct S_strdata_2e1226 D_strdata_2e1226 __asm__("strdata.1226") __attribute__((used, section(".rodata.strdata.1226"), aligned(8)));
+static struct S_strliteral_2e1227 D_strliteral_2e1227 __asm__("strliteral.1227") __attribute__((used, section(".data.rel.ro.strliteral.1227"), aligned(8)));
+static const struct S_strdata_2e1228 D_strdata_2e1228 __asm__("strdata.1228") __attribute__((used, section(".rodata.strdata.1228"), aligned(8)));
+static struct S_strliteral_2e1229 D_strliteral_2e1229 __asm__("strliteral.1229") __attribute__((used, section(".data.rel.ro.strliteral.1229"), aligned(8)));
+static const struct S_strdata_2e1230 D_strdata_2e1230 __asm__("strdata.1230") __attribute__((used, section(".rodata.strdata.1230"), aligned(8)));
+static struct S_strliteral_2e1231 D_strliteral_2e1231 __asm__("strliteral.1231") __attribute__((used, section(".data.rel.ro.strliteral.1231"), aligned(8)));
+static const struct S_strdata_2e1232 D_strdata_2e1232 __asm__("strdata.1232") __attribute__((used, section(".rodata.strdata.1232"), aligned(8)));
+static struct S_strliteral_2e1233 D_strliteral_2e1233 __asm__("strliteral.1233") __attribute__((used, section(".data.rel.ro.strliteral.1233"), aligned(8)));
+static const struct S_strdata_2e1234 D_strdata_2e1234 __asm__("strdata.1234") __attribute__((used, section(".rodata.strdata.1234"), aligned(8)));
+static struct S_strliteral_2e1235 D_strliteral_2e1235 __asm__("strliteral.1235") __attribute__((used, section(".data.rel.ro.strliteral.1235"), aligned(8)));
+static const struct S_strdata_2e1236 D_strdata_2e1236 __asm__("strdata.1236") __attribute__((used, section(".rodata.strdata.1236"), aligned(8)));
+static struct S_strliteral_2e1237 D_strliteral_2e1237 __asm__("strliteral.1237") __attribute__((used, section(".data.rel.ro.strliteral.1237"), aligned(8)));
+static const struct S_strdata_2e1238 D_strdata_2e1238 __asm__("strdata.1238") __attribute__((used, section(".rodata.strdata.1238"), aligned(8)));
+static struct S_strliteral_2e1239 D_strliteral_2e1239 __asm__("strliteral.1239") __attribute__((used, section(".data.rel.ro.strliteral.1239"), aligned(8)));
+static const struct S_strdata_2e1240 D_strdata_2e1240 __asm__("strdata.1240") __attribute__((used, section(".rodata.strdata.1240"), aligned(8)));
+static struct S_strliteral_2e1241 D_strliteral_2e1241 __asm__("strliteral.1241") __attribute__((used, section(".data.rel.ro.strliteral.1241"), aligned(8)));
+static const struct S_strdata_2e1242 D_strdata_2e1242 __asm__("strdata.1242") __attribute__((used, section(".rodata.strdata.1242"), aligned(8)));
+static struct S_strliteral_2e1243 D_strliteral_2e1243 __asm__("strliteral.1243") __attribute__((used, section(".data.rel.ro.strliteral.1243"), aligned(8)));
+static const struct S_strdata_2e1244 D_strdata_2e1244 __asm__("strdata.1244") __attribute__((used, section(".rodata.strdata.1244"), aligned(8)));
+static struct S_strliteral_2e1245 D_strliteral_2e1245 __asm__("strliteral.1245") __attribute__((used, section(".data.rel.ro.strliteral.1245"), aligned(8)));
+static const struct S_strdata_2e1246 D_strdata_2e1246 __asm__("strdata.1246") __attribute__((used, section(".rodata.strdata.1246"), aligned(8)));
+static struct S_strliteral_2e1247 D_strliteral_2e1247 __asm__("strliteral.1247") __attribute__((used, section(".data.rel.ro.strliteral.1247"), aligned(8)));
+static const struct S_strdata_2e1248 D_strdata_2e1248 __asm__("strdata.1248") __attribute__((used, section(".rodata.strdata.1248"), aligned(8)));
+static struct S_strliteral_2e1249 D_strliteral_2e1249 __asm__("strliteral.1249") __attribute__((used, section(".data.rel.ro.strliteral.1249"), aligned(8)));
+static const struct S_strdata_2e1250 D_strdata_2e1250 __asm__("strdata.1250") __attribute__((used, section(".rodata.strdata.1250"), aligned(8)));
+static struct S_strliteral_2e1251 D_strliteral_2e1251 __asm__("strliteral.1251") __attribute__((used, section(".data.rel.ro.strliteral.1251"), aligned(8)));
+static const struct S_strdata_2e1252 D_strdata_2e1252 __asm__("strdata.1252") __attribute__((used, section(".rodata.strdata.1252"), aligned(8)));
+static struct S_strliteral_2e1253 D_strliteral_2e1253 __asm__("strliteral.1253") __attribute__((used, section(".data.rel.ro.strliteral.1253"), aligned(8)));
+static const struct S_strdata_2e1254 D_strdata_2e1254 __asm__("strdata.1254") __attribute__((used, section(".rodata.strdata.1254"), aligned(8)));
+static struct S_strliteral_2e1255 D_strliteral_2e1255 __asm__("strliteral.1255") __attribute__((used, section(".data.rel.ro.strliteral.1255"), aligned(8)));
+static const struct S_strdata_2e1256 D_strdata_2e1256 __asm__("strdata.1256") __attribute__((used, section(".rodata.strdata.1256"), aligned(8)));
+static struct S_strliteral_2e1257 D_strliteral_2e1257 __asm__("strliteral.1257") __attribute__((used, section(".data.rel.ro.strliteral.1257"), aligned(8)));
+static const struct S_strdata_2e1258 D_strdata_2e1258 __asm__("strdata.1258") __attribute__((used, section(".rodata.strdata.1258"), aligned(8)));
+static struct S_strliteral_2e1259 D_strliteral_2e1259 __asm__("strliteral.1259") __attribute__((used, section(".data.rel.ro.strliteral.1259"), aligned(8)));
+static const struct S_strdata_2e1260 D_strdata_2e1260 __asm__("strdata.1260") __attribute__((used, section(".rodata.strdata.1260"), aligned(8)));
+static struct S_strliteral_2e1261 D_strliteral_2e1261 __asm__("strliteral.1261") __attribute__((used, section(".data.rel.ro.strliteral.1261"), aligned(8)));
+static const struct S_strdata_2e1262 D_strdata_2e1262 __asm__("strdata.1262") __attribute__((used, section(".rodata.strdata.1262"), aligned(8)));
+static struct S_strliteral_2e1263 D_strliteral_2e1263 __asm__("strliteral.1263") __attribute__((used, section(".data.rel.ro.strliteral.1263"), aligned(8)));
+static const struct S_strdata_2e1264 D_strdata_2e1264 __asm__("strdata.1264") __attribute__((used, section(".rodata.strdata.1264"), aligned(8)));
+static struct S_strliteral_2e1265 D_strliteral_2e1265 __asm__("strliteral.1265") __attribute__((used, section(".data.rel.ro.strliteral.1265"), aligned(8)));
+static const struct S_strdata_2e1266 D_strdata_2e1266 __asm__("strdata.1266") __attribute__((used, section(".rodata.strdata.1266"), aligned(8)));
+static struct S_strliteral_2e1267 D_strliteral_2e1267 __asm__("strliteral.1267") __attribute__((used, section(".data.rel.ro.strliteral.1267"), aligned(8)));
+static const struct S_strdata_2e1268 D_strdata_2e1268 __asm__("strdata.1268") __attribute__((used, section(".rodata.strdata.1268"), aligned(8)));
+static struct S_strliteral_2e1269 D_strliteral_2e1269 __asm__("strliteral.1269") __attribute__((used, section(".data.rel.ro.strliteral.1269"), aligned(8)));
+static const struct S_strdata_2e1270 D_strdata_2e1270 __asm__("strdata.1270") __attribute__((used, section(".rodata.strdata.1270"), aligned(8)));
+static struct S_strliteral_2e1271 D_strliteral_2e1271 __asm__("strliteral.1271") __attribute__((used, section(".data.rel.ro.strliteral.1271"), aligned(8)));
+static const struct S_strdata_2e1272 D_strdata_2e1272 __asm__("strdata.1272") __attribute__((used, section(".rodata.strdata.1272"), aligned(8)));
+static struct S_strliteral_2e1273 D_strliteral_2e1273 __asm__("strliteral.1273") __attribute__((used, section(".data.rel.ro.strliteral.1273"), aligned(8)));
+static const struct S_strdata_2e1274 D_strdata_2e1274 __asm__("strdata.1274") __attribute__((used, section(".rodata.strdata.1274"), aligned(8)));
+static struct S_strliteral_2e1275 D_strliteral_2e1275 __asm__("strliteral.1275") __attribute__((used, section(".data.rel.ro.strliteral.1275"), aligned(8)));
+static const struct S_strdata_2e1276 D_strdata_2e1276 __asm__("strdata.1276") __attribute__((used, section(".rodata.strdata.1276"), aligned(8)));
+static struct S_strliteral_2e1277 D_strliteral_2e1277 __asm__("strliteral.1277") __attribute__((used, section(".data.rel.ro.strliteral.1277"), aligned(8)));
+static const struct S_strdata_2e1278 D_strdata_2e1278 __asm__("strdata.1278") __attribute__((used, section(".rodata.strdata.1278"), aligned(8)));
+static struct S_strliteral_2e1279 D_strliteral_2e1279 __asm__("strliteral.1279") __attribute__((used, section(".data.rel.ro.strliteral.1279"), aligned(8)));
+static const struct S_strdata_2e1280 D_strdata_2e1280 __asm__("strdata.1280") __attribute__((used, section(".rodata.strdata.1280"), aligned(8)));
+static struct S_strliteral_2e1281 D_strliteral_2e1281 __asm__("strliteral.1281") __attribute__((used, section(".data.rel.ro.strliteral.1281"), aligned(8)));
+static const struct S_strdata_2e1282 D_strdata_2e1282 __asm__("strdata.1282") __attribute__((used, section(".rodata.strdata.1282"), aligned(8)));
+static struct S_strliteral_2e1283 D_strliteral_2e1283 __asm__("strliteral.1283") __attribute__((used, section(".data.rel.ro.strliteral.1283"), aligned(8)));
+static const struct S_strdata_2e1284 D_strdata_2e1284 __asm__("strdata.1284") __attribute__((used, section(".rodata.strdata.1284"), aligned(8)));
+static struct S_strliteral_2e1285 D_strliteral_2e1285 __asm__("strliteral.1285") __attribute__((used, section(".data.rel.ro.strliteral.1285"), aligned(8)));
+static const struct S_strdata_2e1286 D_strdata_2e1286 __asm__("strdata.1286") __attribute__((used, section(".rodata.strdata.1286"), aligned(8)));
+static struct S_strliteral_2e1287 D_strliteral_2e1287 __asm__("strliteral.1287") __attribute__((used, section(".data.rel.ro.strliteral.1287"), aligned(8)));
+static const struct S_strdata_2e1288 D_strdata_2e1288 __asm__("strdata.1288") __attribute__((used, section(".rodata.strdata.1288"), aligned(8)));
+static struct S_strliteral_2e1289 D_strliteral_2e1289 __asm__("strliteral.1289") __attribute__((used, section(".data.rel.ro.strliteral.1289"), aligned(8)));
+static const struct S_strdata_2e1290 D_strdata_2e1290 __asm__("strdata.1290") __attribute__((used, section(".rodata.strdata.1290"), aligned(8)));
+static struct S_strliteral_2e1291 D_strliteral_2e1291 __asm__("strliteral.1291") __attribute__((used, section(".data.rel.ro.strliteral.1291"), aligned(8)));
+static const struct S_strdata_2e1292 D_strdata_2e1292 __asm__("strdata.1292") __attribute__((used, section(".rodata.strdata.1292"), aligned(8)));
+static struct S_strliteral_2e1293 D_strliteral_2e1293 __asm__("strliteral.1293") __attribute__((used, section(".data.rel.ro.strliteral.1293"), aligned(8)));
+static const struct S_strdata_2e1294 D_strdata_2e1294 __asm__("strdata.1294") __attribute__((used, section(".rodata.strdata.1294"), aligned(8)));
+static struct S_strliteral_2e1295 D_strliteral_2e1295 __asm__("strliteral.1295") __attribute__((used, section(".data.rel.ro.strliteral.1295"), aligned(8)));
+static const struct S_strdata_2e1296 D_strdata_2e1296 __asm__("strdata.1296") __attribute__((used, section(".rodata.strdata.1296"), aligned(8)));
+static struct S_strliteral_2e1297 D_strliteral_2e1297 __asm__("strliteral.1297") __attribute__((used, section(".data.rel.ro.strliteral.1297"), aligned(8)));
+static const struct S_strdata_2e1298 D_strdata_2e1298 __asm__("strdata.1298") __attribute__((used, section(".rodata.strdata.1298"), aligned(8)));
+static struct S_strliteral_2e1299 D_strliteral_2e1299 __asm__("strliteral.1299") __attribute__((used, section(".data.rel.ro.strliteral.1299"), aligned(8)));
+static const struct S_strdata_2e1300 D_strdata_2e1300 __asm__("strdata.1300") __attribute__((used, section(".rodata.strdata.1300"), aligned(8)));
+static struct S_strliteral_2e1301 D_strliteral_2e1301 __asm__("strliteral.1301") __attribute__((used, section(".data.rel.ro.strliteral.1301"), aligned(8)));
+static const struct S_strdata_2e1302 D_strdata_2e1302 __asm__("strdata.1302") __attribute__((used, section(".rodata.strdata.1302"), aligned(8)));
+static struct S_strliteral_2e1303 D_strliteral_2e1303 __asm__("strliteral.1303") __attribute__((used, section(".data.rel.ro.strliteral.1303"), aligned(8)));
+static const struct S_strdata_2e1304 D_strdata_2e1304 __asm__("strdata.1304") __attribute__((used, section(".rodata.strdata.1304"), aligned(8)));
+static struct S_strliteral_2e1305 D_strliteral_2e1305 __asm__("strliteral.1305") __attribute__((used, section(".data.rel.ro.strliteral.1305"), aligned(8)));
+static const struct S_strdata_2e1306 D_strdata_2e1306 __asm__("strdata.1306") __attribute__((used, section(".rodata.strdata.1306"), aligned(8)));
+static struct S_strliteral_2e1307 D_strliteral_2e1307 __asm__("strliteral.1307") __attribute__((used, section(".data.rel.ro.strliteral.1307"), aligned(8)));
+static const struct S_strdata_2e1308 D_strdata_2e1308 __asm__("strdata.1308") __attribute__((used, section(".rodata.strdata.1308"), aligned(8)));
+static struct S_strliteral_2e1309 D_strliteral_2e1309 __asm__("strliteral.1309") __attribute__((used, section(".data.rel.ro.strliteral.1309"), aligned(8)));
+static const struct S_strdata_2e1310 D_strdata_2e1310 __asm__("strdata.1310") __attribute__((used, section(".rodata.strdata.1310"), aligned(8)));
+static struct S_strliteral_2e1311 D_strliteral_2e1311 __asm__("strliteral.1311") __attribute__((used, section(".data.rel.ro.strliteral.1311"), aligned(8)));
+static const struct S_strdata_2e1312 D_strdata_2e1312 __asm__("strdata.1312") __attribute__((used, section(".rodata.strdata.1312"), aligned(8)));
+static struct S_strliteral_2e1313 D_strliteral_2e1313 __asm__("strliteral.1313") __attribute__((used, section(".data.rel.ro.strliteral.1313"), aligned(8)));
+static const struct S_strdata_2e1314 D_strdata_2e1314 __asm__("strdata.1314") __attribute__((used, section(".rodata.strdata.1314"), aligned(8)));
+static struct S_strliteral_2e1315 D_strliteral_2e1315 __asm__("strliteral.1315") __attribute__((used, section(".data.rel.ro.strliteral.1315"), aligned(8)));
+static const struct S_strdata_2e1316 D_strdata_2e1316 __asm__("strdata.1316") __attribute__((used, section(".rodata.strdata.1316"), aligned(8)));
+static struct S_strliteral_2e1317 D_strliteral_2e1317 __asm__("strliteral.1317") __attribute__((used, section(".data.rel.ro.strliteral.1317"), aligned(8)));
+static const struct S_strdata_2e1318 D_strdata_2e1318 __asm__("strdata.1318") __attribute__((used, section(".rodata.strdata.1318"), aligned(8)));
+static struct S_strliteral_2e1319 D_strliteral_2e1319 __asm__("strliteral.1319") __attribute__((used, section(".data.rel.ro.strliteral.1319"), aligned(8)));
+static const struct S_strdata_2e1320 D_strdata_2e1320 __asm__("strdata.1320") __attribute__((used, section(".rodata.strdata.1320"), aligned(8)));
+static struct S_strliteral_2e1321 D_strliteral_2e1321 __asm__("strliteral.1321") __attribute__((used, section(".data.rel.ro.strliteral.1321"), aligned(8)));
+static const struct S_strdata_2e1322 D_strdata_2e1322 __asm__("strdata.1322") __attribute__((used, section(".rodata.strdata.1322"), aligned(8)));
+static struct S_strliteral_2e1323 D_strliteral_2e1323 __asm__("strliteral.1323") __attribute__((used, section(".data.rel.ro.strliteral.1323"), aligned(8)));
+static const struct S_strdata_2e1324 D_strdata_2e1324 __asm__("strdata.1324") __attribute__((used, section(".rodata.strdata.1324"), aligned(8)));
+static struct S_strliteral_2e1325 D_strliteral_2e1325 __asm__("strliteral.1325") __attribute__((used, section(".data.rel.ro.strliteral.1325"), aligned(8)));
+static const struct S_strdata_2e1326 D_strdata_2e1326 __asm__("strdata.1326") __attribute__((used, section(".rodata.strdata.1326"), aligned(8)));
+static struct S_strliteral_2e1327 D_strliteral_2e1327 __asm__("strliteral.1327") __attribute__((used, section(".data.rel.ro.strliteral.1327"), aligned(8)));
+static const struct S_strdata_2e1328 D_strdata_2e1328 __asm__("strdata.1328") __attribute__((used, section(".rodata.strdata.1328"), aligned(8)));
+static struct S_strliteral_2e1329 D_strliteral_2e1329 __asm__("strliteral.1329") __attribute__((used, section(".data.rel.ro.strliteral.1329"), aligned(8)));
+static const struct S_strdata_2e1330 D_strdata_2e1330 __asm__("strdata.1330") __attribute__((used, section(".rodata.strdata.1330"), aligned(8)));
+static struct S_strliteral_2e1331 D_strliteral_2e1331 __asm__("strliteral.1331") __attribute__((used, section(".data.rel.ro.strliteral.1331"), aligned(8)));
+static const struct S_strdata_2e1332 D_strdata_2e1332 __asm__("strdata.1332") __attribute__((used, section(".rodata.strdata.1332"), aligned(8)));
+static struct S_strliteral_2e1333 D_strliteral_2e1333 __asm__("strliteral.1333") __attribute__((used, section(".data.rel.ro.strliteral.1333"), aligned(8)));
+static const struct S_strdata_2e1334 D_strdata_2e1334 __asm__("strdata.1334") __attribute__((used, section(".rodata.strdata.1334"), aligned(8)));
+static struct S_strliteral_2e1335 D_strliteral_2e1335 __asm__("strliteral.1335") __attribute__((used, section(".data.rel.ro.strliteral.1335"), aligned(8)));
+static const struct S_strdata_2e1336 D_strdata_2e1336 __asm__("strdata.1336") __attribute__((used, section(".rodata.strdata.1336"), aligned(8)));
+static struct S_strliteral_2e1337 D_strliteral_2e1337 __asm__("strliteral.1337") __attribute__((used, section(".data.rel.ro.strliteral.1337"), aligned(8)));
+static const struct S_strdata_2e1338 D_strdata_2e1338 __asm__("strdata.1338") __attribute__((used, section(".rodata.strdata.1338"), aligned(8)));
+static struct S_strliteral_2e1339 D_strliteral_2e1339 __asm__("strliteral.1339") __attribute__((used, section(".data.rel.ro.strliteral.1339"), aligned(8)));
+static const struct S_strdata_2e1340 D_strdata_2e1340 __asm__("strdata.1340") __attribute__((used, section(".rodata.strdata.1340"), aligned(8)));
+static struct S_strliteral_2e1341 D_strliteral_2e1341 __asm__("strliteral.1341") __attribute__((used, section(".data.rel.ro.strliteral.1341"), aligned(8)));
+static const struct S_strdata_2e1342 D_strdata_2e1342 __asm__("strdata.1342") __attribute__((used, section(".rodata.strdata.1342"), aligned(8)));
+static struct S_strliteral_2e1343 D_strliteral_2e1343 __asm__("strliteral.1343") __attribute__((used, section(".data.rel.ro.strliteral.1343"), aligned(8)));
+static const struct S_strdata_2e1344 D_strdata_2e1344 __asm__("strdata.1344") __attribute__((used, section(".rodata.strdata.1344"), aligned(8)));
+static struct S_strliteral_2e1345 D_strliteral_2e1345 __asm__("strliteral.1345") __attribute__((used, section(".data.rel.ro.strliteral.1345"), aligned(8)));
+static const struct S_strdata_2e1346 D_strdata_2e1346 __asm__("strdata.1346") __attribute__((used, section(".rodata.strdata.1346"), aligned(8)));
+static struct S_strliteral_2e1347 D_strliteral_2e1347 __asm__("strliteral.1347") __attribute__((used, section(".data.rel.ro.strliteral.1347"), aligned(8)));
+static const struct S_strdata_2e1348 D_strdata_2e1348 __asm__("strdata.1348") __attribute__((used, section(".rodata.strdata.1348"), aligned(8)));
+static struct S_strliteral_2e1349 D_strliteral_2e1349 __asm__("strliteral.1349") __attribute__((used, section(".data.rel.ro.strliteral.1349"), aligned(8)));
+static const struct S_strdata_2e1350 D_strdata_2e1350 __asm__("strdata.1350") __attribute__((used, section(".rodata.strdata.1350"), aligned(8)));
+static struct S_strliteral_2e1351 D_strliteral_2e1351 __asm__("strliteral.1351") __attribute__((used, section(".data.rel.ro.strliteral.1351"), aligned(8)));
+static const struct S_strdata_2e1352 D_strdata_2e1352 __asm__("strdata.1352") __attribute__((used, section(".rodata.strdata.1352"), aligned(8)));
+static struct S_strliteral_2e1353 D_strliteral_2e1353 __asm__("strliteral.1353") __attribute__((used, section(".data.rel.ro.strliteral.1353"), aligned(8)));
+static const struct S_strdata_2e1354 D_strdata_2e1354 __asm__("strdata.1354") __attribute__((used, section(".rodata.strdata.1354"), aligned(8)));
+static struct S_strliteral_2e1355 D_strliteral_2e1355 __asm__("strliteral.1355") __attribute__((used, section(".data.rel.ro.strliteral.1355"), aligned(8)));
+static const struct S_strdata_2e1356 D_strdata_2e1356 __asm__("strdata.1356") __attribute__((used, section(".rodata.strdata.1356"), aligned(8)));
+static struct S_strliteral_2e1357 D_strliteral_2e1357 __asm__("strliteral.1357") __attribute__((used, section(".data.rel.ro.strliteral.1357"), aligned(8)));
+static const struct S_strdata_2e1358 D_strdata_2e1358 __asm__("strdata.1358") __attribute__((used, section(".rodata.strdata.1358"), aligned(8)));
+static struct S_strliteral_2e1359 D_strliteral_2e1359 __asm__("strliteral.1359") __attribute__((used, section(".data.rel.ro.strliteral.1359"), aligned(8)));
+static const struct S_strdata_2e1360 D_strdata_2e1360 __asm__("strdata.1360") __attribute__((used, section(".rodata.strdata.1360"), aligned(8)));
+static struct S_strliteral_2e1361 D_strliteral_2e1361 __asm__("strliteral.1361") __attribute__((used, section(".data.rel.ro.strliteral.1361"), aligned(8)));
+static const struct S_strdata_2e1362 D_strdata_2e1362 __asm__("strdata.1362") __attribute__((used, section(".rodata.strdata.1362"), aligned(8)));
+static struct S_strliteral_2e1363 D_strliteral_2e1363 __asm__("strliteral.1363") __attribute__((used, section(".data.rel.ro.strliteral.1363"), aligned(8)));
+static const struct S_strdata_2e1364 D_strdata_2e1364 __asm__("strdata.1364") __attribute__((used, section(".rodata.strdata.1364"), aligned(8)));
+static struct S_strliteral_2e1365 D_strliteral_2e1365 __asm__("strliteral.1365") __attribute__((used, section(".data.rel.ro.strliteral.1365"), aligned(8)));
+static const struct S_strdata_2e1366 D_strdata_2e1366 __asm__("strdata.1366") __attribute__((used, section(".rodata.strdata.1366"), aligned(8)));
+static struct S_strliteral_2e1367 D_strliteral_2e1367 __asm__("strliteral.1367") __attribute__((used, section(".data.rel.ro.strliteral.1367"), aligned(8)));
+static const struct S_strdata_2e1368 D_strdata_2e1368 __asm__("strdata.1368") __attribute__((used, section(".rodata.strdata.1368"), aligned(8)));
+static struct S_strliteral_2e1369 D_strliteral_2e1369 __asm__("strliteral.1369") __attribute__((used, section(".data.rel.ro.strliteral.1369"), aligned(8)));
+static const struct S_strdata_2e1370 D_strdata_2e1370 __asm__("strdata.1370") __attribute__((used, section(".rodata.strdata.1370"), aligned(8)));
+static struct S_strliteral_2e1371 D_strliteral_2e1371 __asm__("strliteral.1371") __attribute__((used, section(".data.rel.ro.strliteral.1371"), aligned(8)));
+static const struct S_strdata_2e1372 D_strdata_2e1372 __asm__("strdata.1372") __attribute__((used, section(".rodata.strdata.1372"), aligned(8)));
+static struct S_strliteral_2e1373 D_strliteral_2e1373 __asm__("strliteral.1373") __attribute__((used, section(".data.rel.ro.strliteral.1373"), aligned(8)));
+static const struct S_strdata_2e1374 D_strdata_2e1374 __asm__("strdata.1374") __attribute__((used, section(".rodata.strdata.1374"), aligned(8)));
+static struct S_strliteral_2e1375 D_strliteral_2e1375 __asm__("strliteral.1375") __attribute__((used, section(".data.rel.ro.strliteral.1375"), aligned(8)));
+static const struct S_strdata_2e1376 D_strdata_2e1376 __asm__("strdata.1376") __attribute__((used, section(".rodata.strdata.1376"), aligned(8)));
+static struct S_strliteral_2e1377 D_strliteral_2e1377 __asm__("strliteral.1377") __attribute__((used, section(".data.rel.ro.strliteral.1377"), aligned(8)));
+static const struct S_strdata_2e1378 D_strdata_2e1378 __asm__("strdata.1378") __attribute__((used, section(".rodata.strdata.1378"), aligned(8)));
+static struct S_strliteral_2e1379 D_strliteral_2e1379 __asm__("strliteral.1379") __attribute__((used, section(".data.rel.ro.strliteral.1379"), aligned(8)));
+static const struct S_strdata_2e1380 D_strdata_2e1380 __asm__("strdata.1380") __attribute__((used, section(".rodata.strdata.1380"), aligned(8)));
+static struct S_strliteral_2e1381 D_strliteral_2e1381 __asm__("strliteral.1381") __attribute__((used, section(".data.rel.ro.strliteral.1381"), aligned(8)));
+static const struct S_strdata_2e1382 D_strdata_2e1382 __asm__("strdata.1382") __attribute__((used, section(".rodata.strdata.1382"), aligned(8)));
+static struct S_strliteral_2e1383 D_strliteral_2e1383 __asm__("strliteral.1383") __attribute__((used, section(".data.rel.ro.strliteral.1383"), aligned(8)));
+static const struct S_strdata_2e1384 D_strdata_2e1384 __asm__("strdata.1384") __attribute__((used, section(".rodata.strdata.1384"), aligned(8)));
+static struct S_strliteral_2e1385 D_strliteral_2e1385 __asm__("strliteral.1385") __attribute__((used, section(".data.rel.ro.strliteral.1385"), aligned(8)));
+static const struct S_strdata_2e1386 D_strdata_2e1386 __asm__("strdata.1386") __attribute__((used, section(".rodata.strdata.1386"), aligned(8)));
+static struct S_strliteral_2e1387 D_strliteral_2e1387 __asm__("strliteral.1387") __attribute__((used, section(".data.rel.ro.strliteral.1387"), aligned(8)));
+static const struct S_strdata_2e1388 D_strdata_2e1388 __asm__("strdata.1388") __attribute__((used, section(".rodata.strdata.1388"), aligned(8)));
+static struct S_strliteral_2e1389 D_strliteral_2e1389 __asm__("strliteral.1389") __attribute__((used, section(".data.rel.ro.strliteral.1389"), aligned(8)));
+static const struct S_strdata_2e1390 D_strdata_2e1390 __asm__("strdata.1390") __attribute__((used, section(".rodata.strdata.1390"), aligned(8)));
+static struct S_strliteral_2e1391 D_strliteral_2e1391 __asm__("strliteral.1391") __attribute__((used, section(".data.rel.ro.strliteral.1391"), aligned(8)));
+static const struct S_strdata_2e1392 D_strdata_2e1392 __asm__("strdata.1392") __attribute__((used, section(".rodata.strdata.1392"), aligned(8)));
+static struct S_strliteral_2e1393 D_strliteral_2e1393 __asm__("strliteral.1393") __attribute__((used, section(".data.rel.ro.strliteral.1393"), aligned(8)));
+static const struct S_strdata_2e1394 D_strdata_2e1394 __asm__("strdata.1394") __attribute__((used, section(".rodata.strdata.1394"), aligned(8)));
+static struct S_strliteral_2e1395 D_strliteral_2e1395 __asm__("strliteral.1395") __attribute__((used, section(".data.rel.ro.strliteral.1395"), aligned(8)));
+static const struct S_strdata_2e1396 D_strdata_2e1396 __asm__("strdata.1396") __attribute__((used, section(".rodata.strdata.1396"), aligned(8)));
+static struct S_strliteral_2e1397 D_strliteral_2e1397 __asm__("strliteral.1397") __attribute__((used, section(".data.rel.ro.strliteral.1397"), aligned(8)));
+static const struct S_strdata_2e1398 D_strdata_2e1398 __asm__("strdata.1398") __attribute__((used, section(".rodata.strdata.1398"), aligned(8)));
+static struct S_strliteral_2e1399 D_strliteral_2e1399 __asm__("strliteral.1399") __attribute__((used, section(".data.rel.ro.strliteral.1399"), aligned(8)));
+static const struct S_strdata_2e1400 D_strdata_2e1400 __asm__("strdata.1400") __attribute__((used, section(".rodata.strdata.1400"), aligned(8)));
+static struct S_strliteral_2e1401 D_strliteral_2e1401 __asm__("strliteral.1401") __attribute__((used, section(".data.rel.ro.strliteral.1401"), aligned(8)));
+static const struct S_strdata_2e1402 D_strdata_2e1402 __asm__("strdata.1402") __attribute__((used, section(".rodata.strdata.1402"), aligned(8)));
+static struct S_strliteral_2e1403 D_strliteral_2e1403 __asm__("strliteral.1403") __attribute__((used, section(".data.rel.ro.strliteral.1403"), aligned(8)));
+static const struct S_strdata_2e1404 D_strdata_2e1404 __asm__("strdata.1404") __attribute__((used, section(".rodata.strdata.1404"), aligned(8)));
+static struct S_strliteral_2e1405 D_strliteral_2e1405 __asm__("strliteral.1405") __attribute__((used, section(".data.rel.ro.strliteral.1405"), aligned(8)));
+static const struct S_strdata_2e1406 D_strdata_2e1406 __asm__("strdata.1406") __attribute__((used, section(".rodata.strdata.1406"), aligned(8)));
+static struct S_strliteral_2e1407 D_strliteral_2e1407 __asm__("strliteral.1407") __attribute__((used, section(".data.rel.ro.strliteral.1407"), aligned(8)));
+static const struct S_strdata_2e1408 D_strdata_2e1408 __asm__("strdata.1408") __attribute__((used, section(".rodata.strdata.1408"), aligned(8)));
+static struct S_strliteral_2e1409 D_strliteral_2e1409 __asm__("strliteral.1409") __attribute__((used, section(".data.rel.ro.strliteral.1409"), aligned(8)));
+static const struct S_strdata_2e1410 D_strdata_2e1410 __asm__("strdata.1410") __attribute__((used, section(".rodata.strdata.1410"), aligned(8)));
+static struct S_strliteral_2e1411 D_strliteral_2e1411 __asm__("strliteral.1411") __attribute__((used, section(".data.rel.ro.strliteral.1411"), aligned(8)));
+static const struct S_strdata_2e1412 D_strdata_2e1412 __asm__("strdata.1412") __attribute__((used, section(".rodata.strdata.1412"), aligned(8)));
+static struct S_strliteral_2e1413 D_strliteral_2e1413 __asm__("strliteral.1413") __attribute__((used, section(".data.rel.ro.strliteral.1413"), aligned(8)));
+static const struct S_strdata_2e1414 D_strdata_2e1414 __asm__("strdata.1414") __attribute__((used, section(".rodata.strdata.1414"), aligned(8)));
+static struct S_strliteral_2e1415 D_strliteral_2e1415 __asm__("strliteral.1415") __attribute__((used, section(".data.rel.ro.strliteral.1415"), aligned(8)));
+static const struct S_strdata_2e1416 D_strdata_2e1416 __asm__("strdata.1416") __attribute__((used, section(".rodata.strdata.1416"), aligned(8)));
+static struct S_strliteral_2e1417 D_strliteral_2e1417 __asm__("strliteral.1417") __attribute__((used, section(".data.rel.ro.strliteral.1417"), aligned(8)));
+static const struct S_strdata_2e1418 D_strdata_2e1418 __asm__("strdata.1418") __attribute__((used, section(".rodata.strdata.1418"), aligned(8)));
+static struct S_strliteral_2e1419 D_strliteral_2e1419 __asm__("strliteral.1419") __attribute__((used, section(".data.rel.ro.strliteral.1419"), aligned(8)));
+static const struct S_strdata_2e1420 D_strdata_2e1420 __asm__("strdata.1420") __attribute__((used, section(".rodata.strdata.1420"), aligned(8)));
+static struct S_strliteral_2e1421 D_strliteral_2e1421 __asm__("strliteral.1421") __attribute__((used, section(".data.rel.ro.strliteral.1421"), aligned(8)));
+static const struct S_strdata_2e1422 D_strdata_2e1422 __asm__("strdata.1422") __attribute__((used, section(".rodata.strdata.1422"), aligned(8)));
+static struct S_strliteral_2e1423 D_strliteral_2e1423 __asm__("strliteral.1423") __attribute__((used, section(".data.rel.ro.strliteral.1423"), aligned(8)));
+static const struct S_strdata_2e1424 D_strdata_2e1424 __asm__("strdata.1424") __attribute__((used, section(".rodata.strdata.1424"), aligned(8)));
+static struct S_strliteral_2e1425 D_strliteral_2e1425 __asm__("strliteral.1425") __attribute__((used, section(".data.rel.ro.strliteral.1425"), aligned(8)));
+static const struct S_strdata_2e1426 D_strdata_2e1426 __asm__("strdata.1426") __attribute__((used, section(".rodata.strdata.1426"), aligned(8)));
+static struct S_strliteral_2e1427 D_strliteral_2e1427 __asm__("strliteral.1427") __attribute__((used, section(".data.rel.ro.strliteral.1427"), aligned(8)));
+static const struct S_strdata_2e1428 D_strdata_2e1428 __asm__("strdata.1428") __attribute__((used, section(".rodata.strdata.1428"), aligned(8)));
+static struct S_strliteral_2e1429 D_strliteral_2e1429 __asm__("strliteral.1429") __attribute__((used, section(".data.rel.ro.strliteral.1429"), aligned(8)));
+static const struct S_strdata_2e1430 D_strdata_2e1430 __asm__("strdata.1430") __attribute__((used, section(".rodata.strdata.1430"), aligned(8)));
+static struct S_strliteral_2e1431 D_strliteral_2e1431 __asm__("strliteral.1431") __attribute__((used, section(".data.rel.ro.strliteral.1431"), aligned(8)));
+static const struct S_strdata_2e1432 D_strdata_2e1432 __asm__("strdata.1432") __attribute__((used, section(".rodata.strdata.1432"), aligned(8)));
+static struct S_strliteral_2e1433 D_strliteral_2e1433 __asm__("strliteral.1433") __attribute__((used, section(".data.rel.ro.strliteral.1433"), aligned(8)));
+static const struct S_strdata_2e1434 D_strdata_2e1434 __asm__("strdata.1434") __attribute__((used, section(".rodata.strdata.1434"), aligned(8)));
+static struct S_strliteral_2e1435 D_strliteral_2e1435 __asm__("strliteral.1435") __attribute__((used, section(".data.rel.ro.strliteral.1435"), aligned(8)));
+static const struct S_strdata_2e1436 D_strdata_2e1436 __asm__("strdata.1436") __attribute__((used, section(".rodata.strdata.1436"), aligned(8)));
+static struct S_strliteral_2e1437 D_strliteral_2e1437 __asm__("strliteral.1437") __attribute__((used, section(".data.rel.ro.strliteral.1437"), aligned(8)));
+static const struct S_strdata_2e1441 D_strdata_2e1441 __asm__("strdata.1441") __attribute__((used, section(".rodata.strdata.1441"), aligned(8)));
+static struct S_strliteral_2e1442 D_strliteral_2e1442 __asm__("strliteral.1442") __attribute__((used, section(".data.rel.ro.strliteral.1442"), aligned(8)));
+static const struct S_strdata_2e1443 D_strdata_2e1443 __asm__("strdata.1443") __attribute__((used, section(".rodata.strdata.1443"), aligned(8)));
+static struct S_strliteral_2e1444 D_strliteral_2e1444 __asm__("strliteral.1444") __attribute__((used, section(".data.rel.ro.strliteral.1444"), aligned(8)));
+static const struct S_strdata_2e1445 D_strdata_2e1445 __asm__("strdata.1445") __attribute__((used, section(".rodata.strdata.1445"), aligned(8)));
+static struct S_strliteral_2e1446 D_strliteral_2e1446 __asm__("strliteral.1446") __attribute__((used, section(".data.rel.ro.strliteral.1446"), aligned(8)));
+static const struct S_strdata_2e1447 D_strdata_2e1447 __asm__("strdata.1447") __attribute__((used, section(".rodata.strdata.1447"), aligned(8)));
+static struct S_strliteral_2e1448 D_strliteral_2e1448 __asm__("strliteral.1448") __attribute__((used, section(".data.rel.ro.strliteral.1448"), aligned(8)));
+static const struct S_strdata_2e1449 D_strdata_2e1449 __asm__("strdata.1449") __attribute__((used, section(".rodata.strdata.1449"), aligned(8)));
+static struct S_strliteral_2e1450 D_strliteral_2e1450 __asm__("strliteral.1450") __attribute__((used, section(".data.rel.ro.strliteral.1450"), aligned(8)));
+static const struct S_strdata_2e1451 D_strdata_2e1451 __asm__("strdata.1451") __attribute__((used, section(".rodata.strdata.1451"), aligned(8)));
+static struct S_strliteral_2e1452 D_strliteral_2e1452 __asm__("strliteral.1452") __attribute__((used, section(".data.rel.ro.strliteral.1452"), aligned(8)));
+static const struct S_strdata_2e1453 D_strdata_2e1453 __asm__("strdata.1453") __attribute__((used, section(".rodata.strdata.1453"), aligned(8)));
+static struct S_strliteral_2e1454 D_strliteral_2e1454 __asm__("strliteral.1454") __attribute__((used, section(".data.rel.ro.strliteral.1454"), aligned(8)));
+static const struct S_strdata_2e1455 D_strdata_2e1455 __asm__("strdata.1455") __attribute__((used, section(".rodata.strdata.1455"), aligned(8)));
+static struct S_strliteral_2e1456 D_strliteral_2e1456 __asm__("strliteral.1456") __attribute__((used, section(".data.rel.ro.strliteral.1456"), aligned(8)));
+static const struct S_strdata_2e1457 D_strdata_2e1457 __asm__("strdata.1457") __attribute__((used, section(".rodata.strdata.1457"), aligned(8)));
+static struct S_strliteral_2e1458 D_strliteral_2e1458 __asm__("strliteral.1458") __attribute__((used, section(".data.rel.ro.strliteral.1458"), aligned(8)));
+static const struct S_strdata_2e1459 D_strdata_2e1459 __asm__("strdata.1459") __attribute__((used, section(".rodata.strdata.1459"), aligned(8)));
+static struct S_strliteral_2e1460 D_strliteral_2e1460 __asm__("strliteral.1460") __attribute__((used, section(".data.rel.ro.strliteral.1460"), aligned(8)));
+static const struct S_strdata_2e1461 D_strdata_2e1461 __asm__("strdata.1461") __attribute__((used, section(".rodata.strdata.1461"), aligned(8)));
+static struct S_strliteral_2e1462 D_strliteral_2e1462 __asm__("strliteral.1462") __attribute__((used, section(".data.rel.ro.strliteral.1462"), aligned(8)));
+static const struct S_strdata_2e1466 D_strdata_2e1466 __asm__("strdata.1466") __attribute__((used, section(".rodata.strdata.1466"), aligned(8)));
+static struct S_strliteral_2e1467 D_strliteral_2e1467 __asm__("strliteral.1467") __attribute__((used, section(".data.rel.ro.strliteral.1467"), aligned(8)));
+static const struct S_strdata_2e1468 D_strdata_2e1468 __asm__("strdata.1468") __attribute__((used, section(".rodata.strdata.1468"), aligned(8)));
+static struct S_strliteral_2e1469 D_strliteral_2e1469 __asm__("strliteral.1469") __attribute__((used, section(".data.rel.ro.strliteral.1469"), aligned(8)));
+static const struct S_strdata_2e1470 D_strdata_2e1470 __asm__("strdata.1470") __attribute__((used, section(".rodata.strdata.1470"), aligned(8)));
+static struct S_strliteral_2e1471 D_strliteral_2e1471 __asm__("strliteral.1471") __attribute__((used, section(".data.rel.ro.strliteral.1471"), aligned(8)));
+static const struct S_strdata_2e1472 D_strdata_2e1472 __asm__("strdata.1472") __attribute__((used, section(".rodata.strdata.1472"), aligned(8)));
+static struct S_strliteral_2e1473 D_strliteral_2e1473 __asm__("strliteral.1473") __attribute__((used, section(".data.rel.ro.strliteral.1473"), aligned(8)));
+static const struct S_strdata_2e1523 D_strdata_2e1523 __asm__("strdata.1523") __attribute__((used, section(".rodata.strdata.1523"), aligned(8)));
+static struct S_strliteral_2e1524 D_strliteral_2e1524 __asm__("strliteral.1524") __attribute__((used, section(".data.rel.ro.strliteral.1524"), aligned(8)));
+static struct S_abortsites_2e604 D_abortsites_2e604 __asm__("abortsites.604") __attribute__((used, section(".data.rel.ro.abortsites.604"), aligned(8)));
+static const struct S_strdata_2e1650 D_strdata_2e1650 __asm__("strdata.1650") __attribute__((used, section(".rodata.strdata.1650"), aligned(8)));
+static struct S_strliteral_2e1651 D_strliteral_2e1651 __asm__("strliteral.1651") __attribute__((used, section(".data.rel.ro.strliteral.1651"), aligned(8)));
+static const struct S_strdata_2e1684 D_strdata_2e1684 __asm__("strdata.1684") __attribute__((used, section(".rodata.strdata.1684"), aligned(8)));
+static struct S_strliteral_2e1685 D_strliteral_2e1685 __asm__("strliteral.1685") __attribute__((used, section(".data.rel.ro.strliteral.1685"), aligned(8)));
+static const struct S_strdata_2e1704 D_strdata_2e1704 __asm__("strdata.1704") __attribute__((used, section(".rodata.strdata.1704"), aligned(8)));
+static struct S_strliteral_2e1705 D_strliteral_2e1705 __asm__("strliteral.1705") __attribute__((used, section(".data.rel.ro.strliteral.1705"), aligned(8)));
+static const struct S_strdata_2e1724 D_strdata_2e1724 __asm__("strdata.1724") __attribute__((used, section(".rodata.strdata.1724"), aligned(8)));
+static struct S_strliteral_2e1725 D_strliteral_2e1725 __asm__("strliteral.1725") __attribute__((used, section(".data.rel.ro.strliteral.1725"), aligned(8)));
+static const struct S_strdata_2e1744 D_strdata_2e1744 __asm__("strdata.1744") __attribute__((used, section(".rodata.strdata.1744"), aligned(8)));
+static struct S_strliteral_2e1745 D_strliteral_2e1745 __asm__("strliteral.1745") __attribute__((used, section(".data.rel.ro.strliteral.1745"), aligned(8)));
+static const struct S_strdata_2e1764 D_strdata_2e1764 __asm__("strdata.1764") __attribute__((used, section(".rodata.strdata.1764"), aligned(8)));
+static struct S_strliteral_2e1765 D_strliteral_2e1765 __asm__("strliteral.1765") __attribute__((used, section(".data.rel.ro.strliteral.1765"), aligned(8)));
+static const struct S_strdata_2e1784 D_strdata_2e1784 __asm__("strdata.1784") __attribute__((used, section(".rodata.strdata.1784"), aligned(8)));
+static struct S_strliteral_2e1785 D_strliteral_2e1785 __asm__("strliteral.1785") __attribute__((used, section(".data.rel.ro.strliteral.1785"), aligned(8)));
+static const struct S_strdata_2e1804 D_strdata_2e1804 __asm__("strdata.1804") __attribute__((used, section(".rodata.strdata.1804"), aligned(8)));
+static struct S_strliteral_2e1805 D_strliteral_2e1805 __asm__("strliteral.1805") __attribute__((used, section(".data.rel.ro.strliteral.1805"), aligned(8)));
+static const struct S_strdata_2e1824 D_strdata_2e1824 __asm__("strdata.1824") __attribute__((used, section(".rodata.strdata.1824"), aligned(8)));
+static struct S_strliteral_2e1825 D_strliteral_2e1825 __asm__("strliteral.1825") __attribute__((used, section(".data.rel.ro.strliteral.1825"), aligned(8)));
+static struct S_abortsites_2e1665 D_abortsites_2e1665 __asm__("abortsites.1665") __attribute__((used, section(".data.rel.ro.abortsites.1665"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_aggregates(void) __asm__("aggregates") __attribute__((used, section(".text.aggregates")));
+static void F_assignment(void) __asm__("assignment") __attribute__((used, section(".text.assignment")));
+static void F_numeric(void) __asm__("numeric") __attribute__((used, section(".text.numeric")));
+static void F_basics(void) __asm__("basics") __attribute__((used, section(".text.basics")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\060\060\055\154\151\164\145\162\141\154\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 20U, 20U };
+static struct S_abortsites_2e24 D_abortsites_2e24 = { (char *)((char *)&D_strliteral_2e1) + 0, 133U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 135U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 136U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 137U, 37U, (char *)((char *)&D_strliteral_2e1) + 0, 138U, 28U, (char *)((char *)&D_strliteral_2e1) + 0, 139U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 140U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 141U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 142U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 144U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 145U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 146U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 147U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 149U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 156U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 160U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 162U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 164U, 17U };
+static const struct S_strdata_2e362 D_strdata_2e362 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\151\040\075\040\060\151\070\073\040\151\040\075\040\061\062\070\073\040\175\073" };
+static struct S_strliteral_2e363 D_strliteral_2e363 = { (char *)((char *)&D_strdata_2e362) + 0, 40U, 40U };
+static const struct S_strdata_2e364 D_strdata_2e364 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\165\040\075\040\060\165\063\062\073\040\165\040\075\040\064\062\071\064\071\066\067\062\071\066\073\040\175\073" };
+static struct S_strliteral_2e365 D_strliteral_2e365 = { (char *)((char *)&D_strdata_2e364) + 0, 48U, 48U };
+static const struct S_strdata_2e366 D_strdata_2e366 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\146\040\075\040\060\056\060\146\066\064\073\040\146\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e367 D_strliteral_2e367 = { (char *)((char *)&D_strdata_2e366) + 0, 41U, 41U };
+static const struct S_strdata_2e368 D_strdata_2e368 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\162\040\075\040\047\141\047\073\040\162\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e369 D_strliteral_2e369 = { (char *)((char *)&D_strdata_2e368) + 0, 38U, 38U };
+static const struct S_strdata_2e370 D_strdata_2e370 = { "\164\171\160\145\040\155\171\137\145\156\165\155\040\075\040\145\156\165\155\040\165\070\040\173\040\106\117\117\040\175\073\040\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\145\072\040\155\171\137\145\156\165\155\040\075\040\155\171\137\145\156\165\155\072\072\106\117\117\073\040\145\040\075\040\062\065\066\073\040\175\073" };
+static struct S_strliteral_2e371 D_strliteral_2e371 = { (char *)((char *)&D_strdata_2e370) + 0, 90U, 90U };
+static const struct S_strdata_2e372 D_strdata_2e372 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\160\072\040\156\165\154\154\141\142\154\145\040\052\157\160\141\161\165\145\040\075\040\156\165\154\154\073\040\160\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e373 D_strliteral_2e373 = { (char *)((char *)&D_strdata_2e372) + 0, 57U, 57U };
+static const struct S_strdata_2e374 D_strdata_2e374 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\142\040\075\040\146\141\154\163\145\073\040\142\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e375 D_strliteral_2e375 = { (char *)((char *)&D_strdata_2e374) + 0, 40U, 40U };
+static const struct S_strdata_2e376 D_strdata_2e376 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\156\040\075\040\156\165\154\154\073\040\156\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e377 D_strliteral_2e377 = { (char *)((char *)&D_strdata_2e376) + 0, 39U, 39U };
+static const struct S_strdata_2e378 D_strdata_2e378 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\072\040\163\164\162\165\143\164\040\173\040\151\072\040\151\156\164\040\175\040\075\040\163\164\162\165\143\164\040\173\040\151\072\040\151\156\164\040\075\040\060\040\175\073\040\163\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e379 D_strliteral_2e379 = { (char *)((char *)&D_strdata_2e378) + 0, 75U, 75U };
+static const struct S_strdata_2e380 D_strdata_2e380 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\164\040\075\040\050\060\054\040\061\051\073\040\164\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e381 D_strliteral_2e381 = { (char *)((char *)&D_strdata_2e380) + 0, 41U, 41U };
+static const struct S_strdata_2e382 D_strdata_2e382 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\133\060\054\040\061\135\073\040\141\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e383 D_strliteral_2e383 = { (char *)((char *)&D_strdata_2e382) + 0, 41U, 41U };
+static const struct S_strdata_2e384 D_strdata_2e384 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\040\075\040", 34U, 34U, "\073\040\163\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e385 D_strliteral_2e385 = { (char *)((char *)&D_strdata_2e384) + 0, 37U, 37U };
+static const struct S_strdata_2e386 D_strdata_2e386 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\151\164\165\064\072\040\050\165\063\062\040\174\040\165\066\064\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\151\164\165\064\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e387 D_strliteral_2e387 = { (char *)((char *)&D_strdata_2e386) + 0, 65U, 65U };
+static const struct S_strdata_2e388 D_strdata_2e388 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\151\164\165\065\072\040\050\163\164\162\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\151\164\165\065\040\075\040\060\073\040\175\073" };
+static struct S_strliteral_2e389 D_strliteral_2e389 = { (char *)((char *)&D_strdata_2e388) + 0, 59U, 59U };
+static const struct S_strdata_2e390 D_strdata_2e390 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\151\040\075\040\060\151\070\073\040\151\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e391 D_strliteral_2e391 = { (char *)((char *)&D_strdata_2e390) + 0, 40U, 40U };
+static const struct S_strdata_2e392 D_strdata_2e392 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\165\040\075\040\060\165\070\073\040\165\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e393 D_strliteral_2e393 = { (char *)((char *)&D_strdata_2e392) + 0, 40U, 40U };
+static const struct S_strdata_2e394 D_strdata_2e394 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\162\040\075\040\047\141\047\073\040\162\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e395 D_strliteral_2e395 = { (char *)((char *)&D_strdata_2e394) + 0, 40U, 40U };
+static const struct S_strdata_2e396 D_strdata_2e396 = { "\164\171\160\145\040\155\171\137\145\156\165\155\040\075\040\145\156\165\155\040\165\070\040\173\040\106\117\117\040\175\073\040\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\145\072\040\155\171\137\145\156\165\155\040\075\040\155\171\137\145\156\165\155\072\072\106\117\117\073\040\145\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e397 D_strliteral_2e397 = { (char *)((char *)&D_strdata_2e396) + 0, 90U, 90U };
+static const struct S_strdata_2e398 D_strdata_2e398 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\160\072\040\156\165\154\154\141\142\154\145\040\052\157\160\141\161\165\145\040\075\040\156\165\154\154\073\040\160\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e399 D_strliteral_2e399 = { (char *)((char *)&D_strdata_2e398) + 0, 59U, 59U };
+static const struct S_strdata_2e400 D_strdata_2e400 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\142\040\075\040\146\141\154\163\145\073\040\142\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e401 D_strliteral_2e401 = { (char *)((char *)&D_strdata_2e400) + 0, 42U, 42U };
+static const struct S_strdata_2e402 D_strdata_2e402 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\156\040\075\040\156\165\154\154\073\040\156\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e403 D_strliteral_2e403 = { (char *)((char *)&D_strdata_2e402) + 0, 41U, 41U };
+static const struct S_strdata_2e404 D_strdata_2e404 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\072\040\163\164\162\165\143\164\040\173\040\151\072\040\151\156\164\040\175\040\075\040\163\164\162\165\143\164\040\173\040\151\072\040\151\156\164\040\075\040\060\040\175\073\040\163\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e405 D_strliteral_2e405 = { (char *)((char *)&D_strdata_2e404) + 0, 77U, 77U };
+static const struct S_strdata_2e406 D_strdata_2e406 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\164\040\075\040\050\060\054\040\061\051\073\040\164\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e407 D_strliteral_2e407 = { (char *)((char *)&D_strdata_2e406) + 0, 43U, 43U };
+static const struct S_strdata_2e408 D_strdata_2e408 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\133\060\054\040\061\135\073\040\141\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e409 D_strliteral_2e409 = { (char *)((char *)&D_strdata_2e408) + 0, 43U, 43U };
+static const struct S_strdata_2e410 D_strdata_2e410 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\040\075\040", 34U, 34U, "\073\040\163\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e411 D_strliteral_2e411 = { (char *)((char *)&D_strdata_2e410) + 0, 39U, 39U };
+static const struct S_strdata_2e412 D_strdata_2e412 = { "\164\171\160\145\040\155\171\137\146\063\062\040\075\040\146\063\062\073\040\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\146\164\165\064\072\040\050\146\063\062\040\174\040\155\171\137\146\063\062\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\146\164\165\064\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e413 D_strliteral_2e413 = { (char *)((char *)&D_strdata_2e412) + 0, 89U, 89U };
+static const struct S_strdata_2e414 D_strdata_2e414 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\146\164\165\065\072\040\050\163\164\162\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\146\164\165\065\040\075\040\060\056\060\073\040\175\073" };
+static struct S_strliteral_2e415 D_strliteral_2e415 = { (char *)((char *)&D_strdata_2e414) + 0, 61U, 61U };
+static const struct S_strdata_2e416 D_strdata_2e416 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\146\040\075\040\060\056\060\146\066\064\073\040\146\040\075\040\047\141\047\073\040\175\073" };
+static struct S_strliteral_2e417 D_strliteral_2e417 = { (char *)((char *)&D_strdata_2e416) + 0, 43U, 43U };
+static const struct S_strdata_2e418 D_strdata_2e418 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\160\072\040\156\165\154\154\141\142\154\145\040\052\157\160\141\161\165\145\040\075\040\156\165\154\154\073\040\160\040\075\040\047\141\047\073\040\175\073" };
+static struct S_strliteral_2e419 D_strliteral_2e419 = { (char *)((char *)&D_strdata_2e418) + 0, 59U, 59U };
+static const struct S_strdata_2e420 D_strdata_2e420 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\142\040\075\040\146\141\154\163\145\073\040\142\040\075\040\047\141\047\073\040\175\073" };
+static struct S_strliteral_2e421 D_strliteral_2e421 = { (char *)((char *)&D_strdata_2e420) + 0, 42U, 42U };
+static const struct S_strdata_2e422 D_strdata_2e422 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\156\040\075\040\156\165\154\154\073\040\156\040\075\040\047\141\047\073\040\175\073" };
+static struct S_strliteral_2e423 D_strliteral_2e423 = { (char *)((char *)&D_strdata_2e422) + 0, 41U, 41U };
+static const struct S_strdata_2e424 D_strdata_2e424 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\072\040\163\164\162\165\143\164\040\173\040\151\072\040\151\156\164\040\175\040\075\040\163\164\162\165\143\164\040\173\040\151\072\040\151\156\164\040\075\040\060\040\175\073\040\163\040\075\040\047\141\047\073\040\175\073" };
+static struct S_strliteral_2e425 D_strliteral_2e425 = { (char *)((char *)&D_strdata_2e424) + 0, 77U, 77U };
+static const struct S_strdata_2e426 D_strdata_2e426 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\164\040\075\040\050\060\054\040\061\051\073\040\164\040\075\040\047\141\047\073\040\175\073" };
+static struct S_strliteral_2e427 D_strliteral_2e427 = { (char *)((char *)&D_strdata_2e426) + 0, 43U, 43U };
+static const struct S_strdata_2e428 D_strdata_2e428 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\133\060\054\040\061\135\073\040\141\040\075\040\047\141\047\073\040\175\073" };
+static struct S_strliteral_2e429 D_strliteral_2e429 = { (char *)((char *)&D_strdata_2e428) + 0, 43U, 43U };
+static const struct S_strdata_2e430 D_strdata_2e430 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\040\075\040", 34U, 34U, "\073\040\163\040\075\040\047\141\047\073\040\175\073" };
+static struct S_strliteral_2e431 D_strliteral_2e431 = { (char *)((char *)&D_strdata_2e430) + 0, 39U, 39U };
+static const struct S_strdata_2e432 D_strdata_2e432 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\162\164\165\064\072\040\050\165\063\062\040\174\040\165\066\064\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\162\164\165\064\040\075\040\047\141\047\073\040\175\073" };
+static struct S_strliteral_2e433 D_strliteral_2e433 = { (char *)((char *)&D_strdata_2e432) + 0, 67U, 67U };
+static const struct S_strdata_2e434 D_strdata_2e434 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\162\164\165\065\072\040\050\163\164\162\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\162\164\165\065\040\075\040\047\141\047\073\040\175\073" };
+static struct S_strliteral_2e435 D_strliteral_2e435 = { (char *)((char *)&D_strdata_2e434) + 0, 61U, 61U };
+static const struct S_strdata_2e436 D_strdata_2e436 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\151\072\040\165\070\040\075\040\047", 18446744073709551556U, 18446744073709551488U, "\047\073\040\175\073" };
+static struct S_strliteral_2e437 D_strliteral_2e437 = { (char *)((char *)&D_strdata_2e436) + 0, 36U, 36U };
+static struct S_abortsites_2e347 D_abortsites_2e347 = { (char *)((char *)&D_strliteral_2e1) + 0, 56U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 53U };
+static const struct S_strdata_2e1040 D_strdata_2e1040 = { "\060\142" };
+static struct S_strliteral_2e1041 D_strliteral_2e1041 = { (char *)((char *)&D_strdata_2e1040) + 0, 2U, 2U };
+static const struct S_strdata_2e1042 D_strdata_2e1042 = { "\060\157" };
+static struct S_strliteral_2e1043 D_strliteral_2e1043 = { (char *)((char *)&D_strdata_2e1042) + 0, 2U, 2U };
+static const struct S_strdata_2e1044 D_strdata_2e1044 = { "\060\060\142" };
+static struct S_strliteral_2e1045 D_strliteral_2e1045 = { (char *)((char *)&D_strdata_2e1044) + 0, 3U, 3U };
+static const struct S_strdata_2e1046 D_strdata_2e1046 = { "\060\060\157" };
+static struct S_strliteral_2e1047 D_strliteral_2e1047 = { (char *)((char *)&D_strdata_2e1046) + 0, 3U, 3U };
+static const struct S_strdata_2e1048 D_strdata_2e1048 = { "\060\060\170" };
+static struct S_strliteral_2e1049 D_strliteral_2e1049 = { (char *)((char *)&D_strdata_2e1048) + 0, 3U, 3U };
+static const struct S_strdata_2e1050 D_strdata_2e1050 = { "\060\061\142" };
+static struct S_strliteral_2e1051 D_strliteral_2e1051 = { (char *)((char *)&D_strdata_2e1050) + 0, 3U, 3U };
+static const struct S_strdata_2e1052 D_strdata_2e1052 = { "\060\061\157" };
+static struct S_strliteral_2e1053 D_strliteral_2e1053 = { (char *)((char *)&D_strdata_2e1052) + 0, 3U, 3U };
+static const struct S_strdata_2e1054 D_strdata_2e1054 = { "\060\061\170" };
+static struct S_strliteral_2e1055 D_strliteral_2e1055 = { (char *)((char *)&D_strdata_2e1054) + 0, 3U, 3U };
+static const struct S_strdata_2e1056 D_strdata_2e1056 = { "\061\142" };
+static struct S_strliteral_2e1057 D_strliteral_2e1057 = { (char *)((char *)&D_strdata_2e1056) + 0, 2U, 2U };
+static const struct S_strdata_2e1058 D_strdata_2e1058 = { "\061\157" };
+static struct S_strliteral_2e1059 D_strliteral_2e1059 = { (char *)((char *)&D_strdata_2e1058) + 0, 2U, 2U };
+static const struct S_strdata_2e1060 D_strdata_2e1060 = { "\061\170" };
+static struct S_strliteral_2e1061 D_strliteral_2e1061 = { (char *)((char *)&D_strdata_2e1060) + 0, 2U, 2U };
+static const struct S_strdata_2e1062 D_strdata_2e1062 = { "\061\061\142" };
+static struct S_strliteral_2e1063 D_strliteral_2e1063 = { (char *)((char *)&D_strdata_2e1062) + 0, 3U, 3U };
+static const struct S_strdata_2e1064 D_strdata_2e1064 = { "\061\061\157" };
+static struct S_strliteral_2e1065 D_strliteral_2e1065 = { (char *)((char *)&D_strdata_2e1064) + 0, 3U, 3U };
+static const struct S_strdata_2e1066 D_strdata_2e1066 = { "\061\061\170" };
+static struct S_strliteral_2e1067 D_strliteral_2e1067 = { (char *)((char *)&D_strdata_2e1066) + 0, 3U, 3U };
+static const struct S_strdata_2e1068 D_strdata_2e1068 = { "\060\142\061\145\061" };
+static struct S_strliteral_2e1069 D_strliteral_2e1069 = { (char *)((char *)&D_strdata_2e1068) + 0, 5U, 5U };
+static const struct S_strdata_2e1070 D_strdata_2e1070 = { "\060\142\061\160\061" };
+static struct S_strliteral_2e1071 D_strliteral_2e1071 = { (char *)((char *)&D_strdata_2e1070) + 0, 5U, 5U };
+static const struct S_strdata_2e1072 D_strdata_2e1072 = { "\060\157\061\145\061" };
+static struct S_strliteral_2e1073 D_strliteral_2e1073 = { (char *)((char *)&D_strdata_2e1072) + 0, 5U, 5U };
+static const struct S_strdata_2e1074 D_strdata_2e1074 = { "\060\157\061\160\061" };
+static struct S_strliteral_2e1075 D_strliteral_2e1075 = { (char *)((char *)&D_strdata_2e1074) + 0, 5U, 5U };
+static const struct S_strdata_2e1076 D_strdata_2e1076 = { "\060\142\145\061" };
+static struct S_strliteral_2e1077 D_strliteral_2e1077 = { (char *)((char *)&D_strdata_2e1076) + 0, 4U, 4U };
+static const struct S_strdata_2e1078 D_strdata_2e1078 = { "\060\142\160\061\060\157\145\061" };
+static struct S_strliteral_2e1079 D_strliteral_2e1079 = { (char *)((char *)&D_strdata_2e1078) + 0, 8U, 8U };
+static const struct S_strdata_2e1080 D_strdata_2e1080 = { "\060\157\160\061\060\170\160\061\060\142\061\145\053\061" };
+static struct S_strliteral_2e1081 D_strliteral_2e1081 = { (char *)((char *)&D_strdata_2e1080) + 0, 14U, 14U };
+static const struct S_strdata_2e1082 D_strdata_2e1082 = { "\060\142\061\160\053\061" };
+static struct S_strliteral_2e1083 D_strliteral_2e1083 = { (char *)((char *)&D_strdata_2e1082) + 0, 6U, 6U };
+static const struct S_strdata_2e1084 D_strdata_2e1084 = { "\060\157\061\145\053\061" };
+static struct S_strliteral_2e1085 D_strliteral_2e1085 = { (char *)((char *)&D_strdata_2e1084) + 0, 6U, 6U };
+static const struct S_strdata_2e1086 D_strdata_2e1086 = { "\060\157\061\160\053\061" };
+static struct S_strliteral_2e1087 D_strliteral_2e1087 = { (char *)((char *)&D_strdata_2e1086) + 0, 6U, 6U };
+static const struct S_strdata_2e1088 D_strdata_2e1088 = { "\060\142\145\053\061" };
+static struct S_strliteral_2e1089 D_strliteral_2e1089 = { (char *)((char *)&D_strdata_2e1088) + 0, 5U, 5U };
+static const struct S_strdata_2e1090 D_strdata_2e1090 = { "\060\142\160\053\061" };
+static struct S_strliteral_2e1091 D_strliteral_2e1091 = { (char *)((char *)&D_strdata_2e1090) + 0, 5U, 5U };
+static const struct S_strdata_2e1092 D_strdata_2e1092 = { "\060\157\145\053\061" };
+static struct S_strliteral_2e1093 D_strliteral_2e1093 = { (char *)((char *)&D_strdata_2e1092) + 0, 5U, 5U };
+static const struct S_strdata_2e1094 D_strdata_2e1094 = { "\060\157\160\053\061" };
+static struct S_strliteral_2e1095 D_strliteral_2e1095 = { (char *)((char *)&D_strdata_2e1094) + 0, 5U, 5U };
+static const struct S_strdata_2e1096 D_strdata_2e1096 = { "\060\170\160\053\061" };
+static struct S_strliteral_2e1097 D_strliteral_2e1097 = { (char *)((char *)&D_strdata_2e1096) + 0, 5U, 5U };
+static const struct S_strdata_2e1098 D_strdata_2e1098 = { "\060\142\061\145\055\061" };
+static struct S_strliteral_2e1099 D_strliteral_2e1099 = { (char *)((char *)&D_strdata_2e1098) + 0, 6U, 6U };
+static const struct S_strdata_2e1100 D_strdata_2e1100 = { "\060\142\061\160\055\061" };
+static struct S_strliteral_2e1101 D_strliteral_2e1101 = { (char *)((char *)&D_strdata_2e1100) + 0, 6U, 6U };
+static const struct S_strdata_2e1102 D_strdata_2e1102 = { "\060\157\061\145\055\061" };
+static struct S_strliteral_2e1103 D_strliteral_2e1103 = { (char *)((char *)&D_strdata_2e1102) + 0, 6U, 6U };
+static const struct S_strdata_2e1104 D_strdata_2e1104 = { "\060\157\061\160\055\061" };
+static struct S_strliteral_2e1105 D_strliteral_2e1105 = { (char *)((char *)&D_strdata_2e1104) + 0, 6U, 6U };
+static const struct S_strdata_2e1106 D_strdata_2e1106 = { "\060\142\145\055\061" };
+static struct S_strliteral_2e1107 D_strliteral_2e1107 = { (char *)((char *)&D_strdata_2e1106) + 0, 5U, 5U };
+static const struct S_strdata_2e1108 D_strdata_2e1108 = { "\060\142\160\055\061" };
+static struct S_strliteral_2e1109 D_strliteral_2e1109 = { (char *)((char *)&D_strdata_2e1108) + 0, 5U, 5U };
+static const struct S_strdata_2e1110 D_strdata_2e1110 = { "\060\157\145\055\061" };
+static struct S_strliteral_2e1111 D_strliteral_2e1111 = { (char *)((char *)&D_strdata_2e1110) + 0, 5U, 5U };
+static const struct S_strdata_2e1112 D_strdata_2e1112 = { "\060\157\160\055\061" };
+static struct S_strliteral_2e1113 D_strliteral_2e1113 = { (char *)((char *)&D_strdata_2e1112) + 0, 5U, 5U };
+static const struct S_strdata_2e1114 D_strdata_2e1114 = { "\060\170\160\055\061" };
+static struct S_strliteral_2e1115 D_strliteral_2e1115 = { (char *)((char *)&D_strdata_2e1114) + 0, 5U, 5U };
+static const struct S_strdata_2e1116 D_strdata_2e1116 = { "\060\142\064\061" };
+static struct S_strliteral_2e1117 D_strliteral_2e1117 = { (char *)((char *)&D_strdata_2e1116) + 0, 4U, 4U };
+static const struct S_strdata_2e1118 D_strdata_2e1118 = { "\060\142\061\064" };
+static struct S_strliteral_2e1119 D_strliteral_2e1119 = { (char *)((char *)&D_strdata_2e1118) + 0, 4U, 4U };
+static const struct S_strdata_2e1120 D_strdata_2e1120 = { "\060\157\070\062" };
+static struct S_strliteral_2e1121 D_strliteral_2e1121 = { (char *)((char *)&D_strdata_2e1120) + 0, 4U, 4U };
+static const struct S_strdata_2e1122 D_strdata_2e1122 = { "\060\157\062\070" };
+static struct S_strliteral_2e1123 D_strliteral_2e1123 = { (char *)((char *)&D_strdata_2e1122) + 0, 4U, 4U };
+static const struct S_strdata_2e1124 D_strdata_2e1124 = { "\060\065" };
+static struct S_strliteral_2e1125 D_strliteral_2e1125 = { (char *)((char *)&D_strdata_2e1124) + 0, 2U, 2U };
+static const struct S_strdata_2e1126 D_strdata_2e1126 = { "\060\060\060\060\060\060\061\060" };
+static struct S_strliteral_2e1127 D_strliteral_2e1127 = { (char *)((char *)&D_strdata_2e1126) + 0, 8U, 8U };
+static const struct S_strdata_2e1128 D_strdata_2e1128 = { "\060\060\056\060" };
+static struct S_strliteral_2e1129 D_strliteral_2e1129 = { (char *)((char *)&D_strdata_2e1128) + 0, 4U, 4U };
+static const struct S_strdata_2e1130 D_strdata_2e1130 = { "\060\061\056\060" };
+static struct S_strliteral_2e1131 D_strliteral_2e1131 = { (char *)((char *)&D_strdata_2e1130) + 0, 4U, 4U };
+static const struct S_strdata_2e1132 D_strdata_2e1132 = { "\060\065\145\063" };
+static struct S_strliteral_2e1133 D_strliteral_2e1133 = { (char *)((char *)&D_strdata_2e1132) + 0, 4U, 4U };
+static const struct S_strdata_2e1134 D_strdata_2e1134 = { "\060\060\060\060\060\060\061\060\145\063" };
+static struct S_strliteral_2e1135 D_strliteral_2e1135 = { (char *)((char *)&D_strdata_2e1134) + 0, 10U, 10U };
+static const struct S_strdata_2e1136 D_strdata_2e1136 = { "\060\060\056\060\145\063" };
+static struct S_strliteral_2e1137 D_strliteral_2e1137 = { (char *)((char *)&D_strdata_2e1136) + 0, 6U, 6U };
+static const struct S_strdata_2e1138 D_strdata_2e1138 = { "\060\061\056\060\145\063" };
+static struct S_strliteral_2e1139 D_strliteral_2e1139 = { (char *)((char *)&D_strdata_2e1138) + 0, 6U, 6U };
+static const struct S_strdata_2e1140 D_strdata_2e1140 = { "\060\065\145\053\063" };
+static struct S_strliteral_2e1141 D_strliteral_2e1141 = { (char *)((char *)&D_strdata_2e1140) + 0, 5U, 5U };
+static const struct S_strdata_2e1142 D_strdata_2e1142 = { "\060\060\060\060\060\060\061\060\145\053\063" };
+static struct S_strliteral_2e1143 D_strliteral_2e1143 = { (char *)((char *)&D_strdata_2e1142) + 0, 11U, 11U };
+static const struct S_strdata_2e1144 D_strdata_2e1144 = { "\060\060\056\060\145\053\063" };
+static struct S_strliteral_2e1145 D_strliteral_2e1145 = { (char *)((char *)&D_strdata_2e1144) + 0, 7U, 7U };
+static const struct S_strdata_2e1146 D_strdata_2e1146 = { "\060\061\056\060\145\053\063" };
+static struct S_strliteral_2e1147 D_strliteral_2e1147 = { (char *)((char *)&D_strdata_2e1146) + 0, 7U, 7U };
+static const struct S_strdata_2e1148 D_strdata_2e1148 = { "\060\065\145\055\063" };
+static struct S_strliteral_2e1149 D_strliteral_2e1149 = { (char *)((char *)&D_strdata_2e1148) + 0, 5U, 5U };
+static const struct S_strdata_2e1150 D_strdata_2e1150 = { "\060\060\060\060\060\060\061\060\145\055\063" };
+static struct S_strliteral_2e1151 D_strliteral_2e1151 = { (char *)((char *)&D_strdata_2e1150) + 0, 11U, 11U };
+static const struct S_strdata_2e1152 D_strdata_2e1152 = { "\060\060\056\060\145\055\063" };
+static struct S_strliteral_2e1153 D_strliteral_2e1153 = { (char *)((char *)&D_strdata_2e1152) + 0, 7U, 7U };
+static const struct S_strdata_2e1154 D_strdata_2e1154 = { "\060\061\056\060\145\055\063" };
+static struct S_strliteral_2e1155 D_strliteral_2e1155 = { (char *)((char *)&D_strdata_2e1154) + 0, 7U, 7U };
+static const struct S_strdata_2e1156 D_strdata_2e1156 = { "\060\065\160\063" };
+static struct S_strliteral_2e1157 D_strliteral_2e1157 = { (char *)((char *)&D_strdata_2e1156) + 0, 4U, 4U };
+static const struct S_strdata_2e1158 D_strdata_2e1158 = { "\060\060\060\060\060\060\061\060\160\063" };
+static struct S_strliteral_2e1159 D_strliteral_2e1159 = { (char *)((char *)&D_strdata_2e1158) + 0, 10U, 10U };
+static const struct S_strdata_2e1160 D_strdata_2e1160 = { "\060\060\056\060\160\063" };
+static struct S_strliteral_2e1161 D_strliteral_2e1161 = { (char *)((char *)&D_strdata_2e1160) + 0, 6U, 6U };
+static const struct S_strdata_2e1162 D_strdata_2e1162 = { "\060\061\056\060\160\063" };
+static struct S_strliteral_2e1163 D_strliteral_2e1163 = { (char *)((char *)&D_strdata_2e1162) + 0, 6U, 6U };
+static const struct S_strdata_2e1164 D_strdata_2e1164 = { "\060\065\160\053\063" };
+static struct S_strliteral_2e1165 D_strliteral_2e1165 = { (char *)((char *)&D_strdata_2e1164) + 0, 5U, 5U };
+static const struct S_strdata_2e1166 D_strdata_2e1166 = { "\060\060\060\060\060\060\061\060\160\053\063" };
+static struct S_strliteral_2e1167 D_strliteral_2e1167 = { (char *)((char *)&D_strdata_2e1166) + 0, 11U, 11U };
+static const struct S_strdata_2e1168 D_strdata_2e1168 = { "\060\060\056\060\160\053\063" };
+static struct S_strliteral_2e1169 D_strliteral_2e1169 = { (char *)((char *)&D_strdata_2e1168) + 0, 7U, 7U };
+static const struct S_strdata_2e1170 D_strdata_2e1170 = { "\060\061\056\060\160\053\063" };
+static struct S_strliteral_2e1171 D_strliteral_2e1171 = { (char *)((char *)&D_strdata_2e1170) + 0, 7U, 7U };
+static const struct S_strdata_2e1172 D_strdata_2e1172 = { "\060\065\160\055\063" };
+static struct S_strliteral_2e1173 D_strliteral_2e1173 = { (char *)((char *)&D_strdata_2e1172) + 0, 5U, 5U };
+static const struct S_strdata_2e1174 D_strdata_2e1174 = { "\060\060\060\060\060\060\061\060\160\055\063" };
+static struct S_strliteral_2e1175 D_strliteral_2e1175 = { (char *)((char *)&D_strdata_2e1174) + 0, 11U, 11U };
+static const struct S_strdata_2e1176 D_strdata_2e1176 = { "\060\060\056\060\160\055\063" };
+static struct S_strliteral_2e1177 D_strliteral_2e1177 = { (char *)((char *)&D_strdata_2e1176) + 0, 7U, 7U };
+static const struct S_strdata_2e1178 D_strdata_2e1178 = { "\060\061\056\060\160\055\063" };
+static struct S_strliteral_2e1179 D_strliteral_2e1179 = { (char *)((char *)&D_strdata_2e1178) + 0, 7U, 7U };
+static const struct S_strdata_2e1180 D_strdata_2e1180 = { "\061\056" };
+static struct S_strliteral_2e1181 D_strliteral_2e1181 = { (char *)((char *)&D_strdata_2e1180) + 0, 2U, 2U };
+static const struct S_strdata_2e1182 D_strdata_2e1182 = { "\061\056\056" };
+static struct S_strliteral_2e1183 D_strliteral_2e1183 = { (char *)((char *)&D_strdata_2e1182) + 0, 3U, 3U };
+static const struct S_strdata_2e1184 D_strdata_2e1184 = { "\061\056\056\061" };
+static struct S_strliteral_2e1185 D_strliteral_2e1185 = { (char *)((char *)&D_strdata_2e1184) + 0, 4U, 4U };
+static const struct S_strdata_2e1186 D_strdata_2e1186 = { "\061\056\061\056" };
+static struct S_strliteral_2e1187 D_strliteral_2e1187 = { (char *)((char *)&D_strdata_2e1186) + 0, 4U, 4U };
+static const struct S_strdata_2e1188 D_strdata_2e1188 = { "\061\056\061\056\061" };
+static struct S_strliteral_2e1189 D_strliteral_2e1189 = { (char *)((char *)&D_strdata_2e1188) + 0, 5U, 5U };
+static const struct S_strdata_2e1190 D_strdata_2e1190 = { "\061\145" };
+static struct S_strliteral_2e1191 D_strliteral_2e1191 = { (char *)((char *)&D_strdata_2e1190) + 0, 2U, 2U };
+static const struct S_strdata_2e1192 D_strdata_2e1192 = { "\061\145\053" };
+static struct S_strliteral_2e1193 D_strliteral_2e1193 = { (char *)((char *)&D_strdata_2e1192) + 0, 3U, 3U };
+static const struct S_strdata_2e1194 D_strdata_2e1194 = { "\061\145\055" };
+static struct S_strliteral_2e1195 D_strliteral_2e1195 = { (char *)((char *)&D_strdata_2e1194) + 0, 3U, 3U };
+static const struct S_strdata_2e1196 D_strdata_2e1196 = { "\061\160" };
+static struct S_strliteral_2e1197 D_strliteral_2e1197 = { (char *)((char *)&D_strdata_2e1196) + 0, 2U, 2U };
+static const struct S_strdata_2e1198 D_strdata_2e1198 = { "\061\160\053" };
+static struct S_strliteral_2e1199 D_strliteral_2e1199 = { (char *)((char *)&D_strdata_2e1198) + 0, 3U, 3U };
+static const struct S_strdata_2e1200 D_strdata_2e1200 = { "\061\160\055" };
+static struct S_strliteral_2e1201 D_strliteral_2e1201 = { (char *)((char *)&D_strdata_2e1200) + 0, 3U, 3U };
+static const struct S_strdata_2e1202 D_strdata_2e1202 = { "\061\145\061\053" };
+static struct S_strliteral_2e1203 D_strliteral_2e1203 = { (char *)((char *)&D_strdata_2e1202) + 0, 4U, 4U };
+static const struct S_strdata_2e1204 D_strdata_2e1204 = { "\061\145\061\055" };
+static struct S_strliteral_2e1205 D_strliteral_2e1205 = { (char *)((char *)&D_strdata_2e1204) + 0, 4U, 4U };
+static const struct S_strdata_2e1206 D_strdata_2e1206 = { "\061\160\061\053" };
+static struct S_strliteral_2e1207 D_strliteral_2e1207 = { (char *)((char *)&D_strdata_2e1206) + 0, 4U, 4U };
+static const struct S_strdata_2e1208 D_strdata_2e1208 = { "\061\160\061\055" };
+static struct S_strliteral_2e1209 D_strliteral_2e1209 = { (char *)((char *)&D_strdata_2e1208) + 0, 4U, 4U };
+static const struct S_strdata_2e1210 D_strdata_2e1210 = { "\061\145\145" };
+static struct S_strliteral_2e1211 D_strliteral_2e1211 = { (char *)((char *)&D_strdata_2e1210) + 0, 3U, 3U };
+static const struct S_strdata_2e1212 D_strdata_2e1212 = { "\061\145\053\145" };
+static struct S_strliteral_2e1213 D_strliteral_2e1213 = { (char *)((char *)&D_strdata_2e1212) + 0, 4U, 4U };
+static const struct S_strdata_2e1214 D_strdata_2e1214 = { "\061\145\145\053" };
+static struct S_strliteral_2e1215 D_strliteral_2e1215 = { (char *)((char *)&D_strdata_2e1214) + 0, 4U, 4U };
+static const struct S_strdata_2e1216 D_strdata_2e1216 = { "\061\145\053\145\053" };
+static struct S_strliteral_2e1217 D_strliteral_2e1217 = { (char *)((char *)&D_strdata_2e1216) + 0, 5U, 5U };
+static const struct S_strdata_2e1218 D_strdata_2e1218 = { "\061\145\055\145" };
+static struct S_strliteral_2e1219 D_strliteral_2e1219 = { (char *)((char *)&D_strdata_2e1218) + 0, 4U, 4U };
+static const struct S_strdata_2e1220 D_strdata_2e1220 = { "\061\145\145\055" };
+static struct S_strliteral_2e1221 D_strliteral_2e1221 = { (char *)((char *)&D_strdata_2e1220) + 0, 4U, 4U };
+static const struct S_strdata_2e1222 D_strdata_2e1222 = { "\061\145\055\145\055" };
+static struct S_strliteral_2e1223 D_strliteral_2e1223 = { (char *)((char *)&D_strdata_2e1222) + 0, 5U, 5U };
+static const struct S_strdata_2e1224 D_strdata_2e1224 = { "\061\145\053\145\055" };
+static struct S_strliteral_2e1225 D_strliteral_2e1225 = { (char *)((char *)&D_strdata_2e1224) + 0, 5U, 5U };
+static const struct S_strdata_2e1226 D_strdata_2e1226 = { "\061\145\055\145\053" };
+static struct S_strliteral_2e1227 D_strliteral_2e1227 = { (char *)((char *)&D_strdata_2e1226) + 0, 5U, 5U };
+static const struct S_strdata_2e1228 D_strdata_2e1228 = { "\061\160\160" };
+static struct S_strliteral_2e1229 D_strliteral_2e1229 = { (char *)((char *)&D_strdata_2e1228) + 0, 3U, 3U };
+static const struct S_strdata_2e1230 D_strdata_2e1230 = { "\061\160\053\160" };
+static struct S_strliteral_2e1231 D_strliteral_2e1231 = { (char *)((char *)&D_strdata_2e1230) + 0, 4U, 4U };
+static const struct S_strdata_2e1232 D_strdata_2e1232 = { "\061\160\160\053" };
+static struct S_strliteral_2e1233 D_strliteral_2e1233 = { (char *)((char *)&D_strdata_2e1232) + 0, 4U, 4U };
+static const struct S_strdata_2e1234 D_strdata_2e1234 = { "\061\160\053\160\053" };
+static struct S_strliteral_2e1235 D_strliteral_2e1235 = { (char *)((char *)&D_strdata_2e1234) + 0, 5U, 5U };
+static const struct S_strdata_2e1236 D_strdata_2e1236 = { "\061\160\055\160" };
+static struct S_strliteral_2e1237 D_strliteral_2e1237 = { (char *)((char *)&D_strdata_2e1236) + 0, 4U, 4U };
+static const struct S_strdata_2e1238 D_strdata_2e1238 = { "\061\160\160\055" };
+static struct S_strliteral_2e1239 D_strliteral_2e1239 = { (char *)((char *)&D_strdata_2e1238) + 0, 4U, 4U };
+static const struct S_strdata_2e1240 D_strdata_2e1240 = { "\061\160\055\160\055" };
+static struct S_strliteral_2e1241 D_strliteral_2e1241 = { (char *)((char *)&D_strdata_2e1240) + 0, 5U, 5U };
+static const struct S_strdata_2e1242 D_strdata_2e1242 = { "\061\160\053\160\055" };
+static struct S_strliteral_2e1243 D_strliteral_2e1243 = { (char *)((char *)&D_strdata_2e1242) + 0, 5U, 5U };
+static const struct S_strdata_2e1244 D_strdata_2e1244 = { "\061\160\055\160\053" };
+static struct S_strliteral_2e1245 D_strliteral_2e1245 = { (char *)((char *)&D_strdata_2e1244) + 0, 5U, 5U };
+static const struct S_strdata_2e1246 D_strdata_2e1246 = { "\061\145\145\061" };
+static struct S_strliteral_2e1247 D_strliteral_2e1247 = { (char *)((char *)&D_strdata_2e1246) + 0, 4U, 4U };
+static const struct S_strdata_2e1248 D_strdata_2e1248 = { "\061\145\053\145\061" };
+static struct S_strliteral_2e1249 D_strliteral_2e1249 = { (char *)((char *)&D_strdata_2e1248) + 0, 5U, 5U };
+static const struct S_strdata_2e1250 D_strdata_2e1250 = { "\061\145\145\053\061" };
+static struct S_strliteral_2e1251 D_strliteral_2e1251 = { (char *)((char *)&D_strdata_2e1250) + 0, 5U, 5U };
+static const struct S_strdata_2e1252 D_strdata_2e1252 = { "\061\145\053\145\053\061" };
+static struct S_strliteral_2e1253 D_strliteral_2e1253 = { (char *)((char *)&D_strdata_2e1252) + 0, 6U, 6U };
+static const struct S_strdata_2e1254 D_strdata_2e1254 = { "\061\145\055\145\061" };
+static struct S_strliteral_2e1255 D_strliteral_2e1255 = { (char *)((char *)&D_strdata_2e1254) + 0, 5U, 5U };
+static const struct S_strdata_2e1256 D_strdata_2e1256 = { "\061\145\145\055\061" };
+static struct S_strliteral_2e1257 D_strliteral_2e1257 = { (char *)((char *)&D_strdata_2e1256) + 0, 5U, 5U };
+static const struct S_strdata_2e1258 D_strdata_2e1258 = { "\061\145\055\145\055\061" };
+static struct S_strliteral_2e1259 D_strliteral_2e1259 = { (char *)((char *)&D_strdata_2e1258) + 0, 6U, 6U };
+static const struct S_strdata_2e1260 D_strdata_2e1260 = { "\061\145\053\145\055\061" };
+static struct S_strliteral_2e1261 D_strliteral_2e1261 = { (char *)((char *)&D_strdata_2e1260) + 0, 6U, 6U };
+static const struct S_strdata_2e1262 D_strdata_2e1262 = { "\061\145\055\145\053\061" };
+static struct S_strliteral_2e1263 D_strliteral_2e1263 = { (char *)((char *)&D_strdata_2e1262) + 0, 6U, 6U };
+static const struct S_strdata_2e1264 D_strdata_2e1264 = { "\061\160\160\061" };
+static struct S_strliteral_2e1265 D_strliteral_2e1265 = { (char *)((char *)&D_strdata_2e1264) + 0, 4U, 4U };
+static const struct S_strdata_2e1266 D_strdata_2e1266 = { "\061\160\053\160\061" };
+static struct S_strliteral_2e1267 D_strliteral_2e1267 = { (char *)((char *)&D_strdata_2e1266) + 0, 5U, 5U };
+static const struct S_strdata_2e1268 D_strdata_2e1268 = { "\061\160\160\053\061" };
+static struct S_strliteral_2e1269 D_strliteral_2e1269 = { (char *)((char *)&D_strdata_2e1268) + 0, 5U, 5U };
+static const struct S_strdata_2e1270 D_strdata_2e1270 = { "\061\160\053\160\053\061" };
+static struct S_strliteral_2e1271 D_strliteral_2e1271 = { (char *)((char *)&D_strdata_2e1270) + 0, 6U, 6U };
+static const struct S_strdata_2e1272 D_strdata_2e1272 = { "\061\160\055\160\061" };
+static struct S_strliteral_2e1273 D_strliteral_2e1273 = { (char *)((char *)&D_strdata_2e1272) + 0, 5U, 5U };
+static const struct S_strdata_2e1274 D_strdata_2e1274 = { "\061\160\160\055\061" };
+static struct S_strliteral_2e1275 D_strliteral_2e1275 = { (char *)((char *)&D_strdata_2e1274) + 0, 5U, 5U };
+static const struct S_strdata_2e1276 D_strdata_2e1276 = { "\061\160\055\160\055\061" };
+static struct S_strliteral_2e1277 D_strliteral_2e1277 = { (char *)((char *)&D_strdata_2e1276) + 0, 6U, 6U };
+static const struct S_strdata_2e1278 D_strdata_2e1278 = { "\061\160\053\160\055\061" };
+static struct S_strliteral_2e1279 D_strliteral_2e1279 = { (char *)((char *)&D_strdata_2e1278) + 0, 6U, 6U };
+static const struct S_strdata_2e1280 D_strdata_2e1280 = { "\061\160\055\160\053\061" };
+static struct S_strliteral_2e1281 D_strliteral_2e1281 = { (char *)((char *)&D_strdata_2e1280) + 0, 6U, 6U };
+static const struct S_strdata_2e1282 D_strdata_2e1282 = { "\061\145\061\145" };
+static struct S_strliteral_2e1283 D_strliteral_2e1283 = { (char *)((char *)&D_strdata_2e1282) + 0, 4U, 4U };
+static const struct S_strdata_2e1284 D_strdata_2e1284 = { "\061\145\053\061\145" };
+static struct S_strliteral_2e1285 D_strliteral_2e1285 = { (char *)((char *)&D_strdata_2e1284) + 0, 5U, 5U };
+static const struct S_strdata_2e1286 D_strdata_2e1286 = { "\061\145\061\145\053" };
+static struct S_strliteral_2e1287 D_strliteral_2e1287 = { (char *)((char *)&D_strdata_2e1286) + 0, 5U, 5U };
+static const struct S_strdata_2e1288 D_strdata_2e1288 = { "\061\145\053\061\145\053" };
+static struct S_strliteral_2e1289 D_strliteral_2e1289 = { (char *)((char *)&D_strdata_2e1288) + 0, 6U, 6U };
+static const struct S_strdata_2e1290 D_strdata_2e1290 = { "\061\145\055\061\145" };
+static struct S_strliteral_2e1291 D_strliteral_2e1291 = { (char *)((char *)&D_strdata_2e1290) + 0, 5U, 5U };
+static const struct S_strdata_2e1292 D_strdata_2e1292 = { "\061\145\061\145\055" };
+static struct S_strliteral_2e1293 D_strliteral_2e1293 = { (char *)((char *)&D_strdata_2e1292) + 0, 5U, 5U };
+static const struct S_strdata_2e1294 D_strdata_2e1294 = { "\061\145\055\061\145\055" };
+static struct S_strliteral_2e1295 D_strliteral_2e1295 = { (char *)((char *)&D_strdata_2e1294) + 0, 6U, 6U };
+static const struct S_strdata_2e1296 D_strdata_2e1296 = { "\061\145\053\061\145\055" };
+static struct S_strliteral_2e1297 D_strliteral_2e1297 = { (char *)((char *)&D_strdata_2e1296) + 0, 6U, 6U };
+static const struct S_strdata_2e1298 D_strdata_2e1298 = { "\061\145\055\061\145\053" };
+static struct S_strliteral_2e1299 D_strliteral_2e1299 = { (char *)((char *)&D_strdata_2e1298) + 0, 6U, 6U };
+static const struct S_strdata_2e1300 D_strdata_2e1300 = { "\061\160\061\160" };
+static struct S_strliteral_2e1301 D_strliteral_2e1301 = { (char *)((char *)&D_strdata_2e1300) + 0, 4U, 4U };
+static const struct S_strdata_2e1302 D_strdata_2e1302 = { "\061\160\053\061\160" };
+static struct S_strliteral_2e1303 D_strliteral_2e1303 = { (char *)((char *)&D_strdata_2e1302) + 0, 5U, 5U };
+static const struct S_strdata_2e1304 D_strdata_2e1304 = { "\061\160\061\160\053" };
+static struct S_strliteral_2e1305 D_strliteral_2e1305 = { (char *)((char *)&D_strdata_2e1304) + 0, 5U, 5U };
+static const struct S_strdata_2e1306 D_strdata_2e1306 = { "\061\160\053\061\160\053" };
+static struct S_strliteral_2e1307 D_strliteral_2e1307 = { (char *)((char *)&D_strdata_2e1306) + 0, 6U, 6U };
+static const struct S_strdata_2e1308 D_strdata_2e1308 = { "\061\160\055\061\160" };
+static struct S_strliteral_2e1309 D_strliteral_2e1309 = { (char *)((char *)&D_strdata_2e1308) + 0, 5U, 5U };
+static const struct S_strdata_2e1310 D_strdata_2e1310 = { "\061\160\061\160\055" };
+static struct S_strliteral_2e1311 D_strliteral_2e1311 = { (char *)((char *)&D_strdata_2e1310) + 0, 5U, 5U };
+static const struct S_strdata_2e1312 D_strdata_2e1312 = { "\061\160\055\061\160\055" };
+static struct S_strliteral_2e1313 D_strliteral_2e1313 = { (char *)((char *)&D_strdata_2e1312) + 0, 6U, 6U };
+static const struct S_strdata_2e1314 D_strdata_2e1314 = { "\061\160\053\061\160\055" };
+static struct S_strliteral_2e1315 D_strliteral_2e1315 = { (char *)((char *)&D_strdata_2e1314) + 0, 6U, 6U };
+static const struct S_strdata_2e1316 D_strdata_2e1316 = { "\061\160\055\061\160\053" };
+static struct S_strliteral_2e1317 D_strliteral_2e1317 = { (char *)((char *)&D_strdata_2e1316) + 0, 6U, 6U };
+static const struct S_strdata_2e1318 D_strdata_2e1318 = { "\061\145\061\145\061" };
+static struct S_strliteral_2e1319 D_strliteral_2e1319 = { (char *)((char *)&D_strdata_2e1318) + 0, 5U, 5U };
+static const struct S_strdata_2e1320 D_strdata_2e1320 = { "\061\145\053\061\145\061" };
+static struct S_strliteral_2e1321 D_strliteral_2e1321 = { (char *)((char *)&D_strdata_2e1320) + 0, 6U, 6U };
+static const struct S_strdata_2e1322 D_strdata_2e1322 = { "\061\145\061\145\053\061" };
+static struct S_strliteral_2e1323 D_strliteral_2e1323 = { (char *)((char *)&D_strdata_2e1322) + 0, 6U, 6U };
+static const struct S_strdata_2e1324 D_strdata_2e1324 = { "\061\145\053\061\145\053\061" };
+static struct S_strliteral_2e1325 D_strliteral_2e1325 = { (char *)((char *)&D_strdata_2e1324) + 0, 7U, 7U };
+static const struct S_strdata_2e1326 D_strdata_2e1326 = { "\061\145\055\061\145\061" };
+static struct S_strliteral_2e1327 D_strliteral_2e1327 = { (char *)((char *)&D_strdata_2e1326) + 0, 6U, 6U };
+static const struct S_strdata_2e1328 D_strdata_2e1328 = { "\061\145\061\145\055\061" };
+static struct S_strliteral_2e1329 D_strliteral_2e1329 = { (char *)((char *)&D_strdata_2e1328) + 0, 6U, 6U };
+static const struct S_strdata_2e1330 D_strdata_2e1330 = { "\061\145\055\061\145\055\061" };
+static struct S_strliteral_2e1331 D_strliteral_2e1331 = { (char *)((char *)&D_strdata_2e1330) + 0, 7U, 7U };
+static const struct S_strdata_2e1332 D_strdata_2e1332 = { "\061\145\053\061\145\055\061" };
+static struct S_strliteral_2e1333 D_strliteral_2e1333 = { (char *)((char *)&D_strdata_2e1332) + 0, 7U, 7U };
+static const struct S_strdata_2e1334 D_strdata_2e1334 = { "\061\145\055\061\145\053\061" };
+static struct S_strliteral_2e1335 D_strliteral_2e1335 = { (char *)((char *)&D_strdata_2e1334) + 0, 7U, 7U };
+static const struct S_strdata_2e1336 D_strdata_2e1336 = { "\061\160\061\160\061" };
+static struct S_strliteral_2e1337 D_strliteral_2e1337 = { (char *)((char *)&D_strdata_2e1336) + 0, 5U, 5U };
+static const struct S_strdata_2e1338 D_strdata_2e1338 = { "\061\160\053\061\160\061" };
+static struct S_strliteral_2e1339 D_strliteral_2e1339 = { (char *)((char *)&D_strdata_2e1338) + 0, 6U, 6U };
+static const struct S_strdata_2e1340 D_strdata_2e1340 = { "\061\160\061\160\053\061" };
+static struct S_strliteral_2e1341 D_strliteral_2e1341 = { (char *)((char *)&D_strdata_2e1340) + 0, 6U, 6U };
+static const struct S_strdata_2e1342 D_strdata_2e1342 = { "\061\160\053\061\160\053\061" };
+static struct S_strliteral_2e1343 D_strliteral_2e1343 = { (char *)((char *)&D_strdata_2e1342) + 0, 7U, 7U };
+static const struct S_strdata_2e1344 D_strdata_2e1344 = { "\061\160\055\061\160\061" };
+static struct S_strliteral_2e1345 D_strliteral_2e1345 = { (char *)((char *)&D_strdata_2e1344) + 0, 6U, 6U };
+static const struct S_strdata_2e1346 D_strdata_2e1346 = { "\061\160\061\160\055\061" };
+static struct S_strliteral_2e1347 D_strliteral_2e1347 = { (char *)((char *)&D_strdata_2e1346) + 0, 6U, 6U };
+static const struct S_strdata_2e1348 D_strdata_2e1348 = { "\061\160\055\061\160\055\061" };
+static struct S_strliteral_2e1349 D_strliteral_2e1349 = { (char *)((char *)&D_strdata_2e1348) + 0, 7U, 7U };
+static const struct S_strdata_2e1350 D_strdata_2e1350 = { "\061\160\053\061\160\055\061" };
+static struct S_strliteral_2e1351 D_strliteral_2e1351 = { (char *)((char *)&D_strdata_2e1350) + 0, 7U, 7U };
+static const struct S_strdata_2e1352 D_strdata_2e1352 = { "\061\160\055\061\160\053\061" };
+static struct S_strliteral_2e1353 D_strliteral_2e1353 = { (char *)((char *)&D_strdata_2e1352) + 0, 7U, 7U };
+static const struct S_strdata_2e1354 D_strdata_2e1354 = { "\061\056\145" };
+static struct S_strliteral_2e1355 D_strliteral_2e1355 = { (char *)((char *)&D_strdata_2e1354) + 0, 3U, 3U };
+static const struct S_strdata_2e1356 D_strdata_2e1356 = { "\061\145\056" };
+static struct S_strliteral_2e1357 D_strliteral_2e1357 = { (char *)((char *)&D_strdata_2e1356) + 0, 3U, 3U };
+static const struct S_strdata_2e1358 D_strdata_2e1358 = { "\061\056\145\061" };
+static struct S_strliteral_2e1359 D_strliteral_2e1359 = { (char *)((char *)&D_strdata_2e1358) + 0, 4U, 4U };
+static const struct S_strdata_2e1360 D_strdata_2e1360 = { "\061\145\056\061" };
+static struct S_strliteral_2e1361 D_strliteral_2e1361 = { (char *)((char *)&D_strdata_2e1360) + 0, 4U, 4U };
+static const struct S_strdata_2e1362 D_strdata_2e1362 = { "\061\056\061\145" };
+static struct S_strliteral_2e1363 D_strliteral_2e1363 = { (char *)((char *)&D_strdata_2e1362) + 0, 4U, 4U };
+static const struct S_strdata_2e1364 D_strdata_2e1364 = { "\061\145\061\056" };
+static struct S_strliteral_2e1365 D_strliteral_2e1365 = { (char *)((char *)&D_strdata_2e1364) + 0, 4U, 4U };
+static const struct S_strdata_2e1366 D_strdata_2e1366 = { "\061\145\061\056\061" };
+static struct S_strliteral_2e1367 D_strliteral_2e1367 = { (char *)((char *)&D_strdata_2e1366) + 0, 5U, 5U };
+static const struct S_strdata_2e1368 D_strdata_2e1368 = { "\061\056\160" };
+static struct S_strliteral_2e1369 D_strliteral_2e1369 = { (char *)((char *)&D_strdata_2e1368) + 0, 3U, 3U };
+static const struct S_strdata_2e1370 D_strdata_2e1370 = { "\061\160\056" };
+static struct S_strliteral_2e1371 D_strliteral_2e1371 = { (char *)((char *)&D_strdata_2e1370) + 0, 3U, 3U };
+static const struct S_strdata_2e1372 D_strdata_2e1372 = { "\061\056\160\061" };
+static struct S_strliteral_2e1373 D_strliteral_2e1373 = { (char *)((char *)&D_strdata_2e1372) + 0, 4U, 4U };
+static const struct S_strdata_2e1374 D_strdata_2e1374 = { "\061\160\056\061" };
+static struct S_strliteral_2e1375 D_strliteral_2e1375 = { (char *)((char *)&D_strdata_2e1374) + 0, 4U, 4U };
+static const struct S_strdata_2e1376 D_strdata_2e1376 = { "\061\056\061\160" };
+static struct S_strliteral_2e1377 D_strliteral_2e1377 = { (char *)((char *)&D_strdata_2e1376) + 0, 4U, 4U };
+static const struct S_strdata_2e1378 D_strdata_2e1378 = { "\061\160\061\056" };
+static struct S_strliteral_2e1379 D_strliteral_2e1379 = { (char *)((char *)&D_strdata_2e1378) + 0, 4U, 4U };
+static const struct S_strdata_2e1380 D_strdata_2e1380 = { "\061\160\061\056\061" };
+static struct S_strliteral_2e1381 D_strliteral_2e1381 = { (char *)((char *)&D_strdata_2e1380) + 0, 5U, 5U };
+static const struct S_strdata_2e1382 D_strdata_2e1382 = { "\061\056\145\053" };
+static struct S_strliteral_2e1383 D_strliteral_2e1383 = { (char *)((char *)&D_strdata_2e1382) + 0, 4U, 4U };
+static const struct S_strdata_2e1384 D_strdata_2e1384 = { "\061\145\053\056" };
+static struct S_strliteral_2e1385 D_strliteral_2e1385 = { (char *)((char *)&D_strdata_2e1384) + 0, 4U, 4U };
+static const struct S_strdata_2e1386 D_strdata_2e1386 = { "\061\056\145\053\061" };
+static struct S_strliteral_2e1387 D_strliteral_2e1387 = { (char *)((char *)&D_strdata_2e1386) + 0, 5U, 5U };
+static const struct S_strdata_2e1388 D_strdata_2e1388 = { "\061\145\053\056\061" };
+static struct S_strliteral_2e1389 D_strliteral_2e1389 = { (char *)((char *)&D_strdata_2e1388) + 0, 5U, 5U };
+static const struct S_strdata_2e1390 D_strdata_2e1390 = { "\061\056\061\145\053" };
+static struct S_strliteral_2e1391 D_strliteral_2e1391 = { (char *)((char *)&D_strdata_2e1390) + 0, 5U, 5U };
+static const struct S_strdata_2e1392 D_strdata_2e1392 = { "\061\145\053\061\056" };
+static struct S_strliteral_2e1393 D_strliteral_2e1393 = { (char *)((char *)&D_strdata_2e1392) + 0, 5U, 5U };
+static const struct S_strdata_2e1394 D_strdata_2e1394 = { "\061\145\053\061\056\061" };
+static struct S_strliteral_2e1395 D_strliteral_2e1395 = { (char *)((char *)&D_strdata_2e1394) + 0, 6U, 6U };
+static const struct S_strdata_2e1396 D_strdata_2e1396 = { "\061\056\160\053" };
+static struct S_strliteral_2e1397 D_strliteral_2e1397 = { (char *)((char *)&D_strdata_2e1396) + 0, 4U, 4U };
+static const struct S_strdata_2e1398 D_strdata_2e1398 = { "\061\160\053\056" };
+static struct S_strliteral_2e1399 D_strliteral_2e1399 = { (char *)((char *)&D_strdata_2e1398) + 0, 4U, 4U };
+static const struct S_strdata_2e1400 D_strdata_2e1400 = { "\061\056\160\053\061" };
+static struct S_strliteral_2e1401 D_strliteral_2e1401 = { (char *)((char *)&D_strdata_2e1400) + 0, 5U, 5U };
+static const struct S_strdata_2e1402 D_strdata_2e1402 = { "\061\160\053\056\061" };
+static struct S_strliteral_2e1403 D_strliteral_2e1403 = { (char *)((char *)&D_strdata_2e1402) + 0, 5U, 5U };
+static const struct S_strdata_2e1404 D_strdata_2e1404 = { "\061\056\061\160\053" };
+static struct S_strliteral_2e1405 D_strliteral_2e1405 = { (char *)((char *)&D_strdata_2e1404) + 0, 5U, 5U };
+static const struct S_strdata_2e1406 D_strdata_2e1406 = { "\061\160\053\061\056" };
+static struct S_strliteral_2e1407 D_strliteral_2e1407 = { (char *)((char *)&D_strdata_2e1406) + 0, 5U, 5U };
+static const struct S_strdata_2e1408 D_strdata_2e1408 = { "\061\160\053\061\056\061" };
+static struct S_strliteral_2e1409 D_strliteral_2e1409 = { (char *)((char *)&D_strdata_2e1408) + 0, 6U, 6U };
+static const struct S_strdata_2e1410 D_strdata_2e1410 = { "\061\056\145\055" };
+static struct S_strliteral_2e1411 D_strliteral_2e1411 = { (char *)((char *)&D_strdata_2e1410) + 0, 4U, 4U };
+static const struct S_strdata_2e1412 D_strdata_2e1412 = { "\061\145\055\056" };
+static struct S_strliteral_2e1413 D_strliteral_2e1413 = { (char *)((char *)&D_strdata_2e1412) + 0, 4U, 4U };
+static const struct S_strdata_2e1414 D_strdata_2e1414 = { "\061\056\145\055\061" };
+static struct S_strliteral_2e1415 D_strliteral_2e1415 = { (char *)((char *)&D_strdata_2e1414) + 0, 5U, 5U };
+static const struct S_strdata_2e1416 D_strdata_2e1416 = { "\061\145\055\056\061" };
+static struct S_strliteral_2e1417 D_strliteral_2e1417 = { (char *)((char *)&D_strdata_2e1416) + 0, 5U, 5U };
+static const struct S_strdata_2e1418 D_strdata_2e1418 = { "\061\056\061\145\055" };
+static struct S_strliteral_2e1419 D_strliteral_2e1419 = { (char *)((char *)&D_strdata_2e1418) + 0, 5U, 5U };
+static const struct S_strdata_2e1420 D_strdata_2e1420 = { "\061\145\055\061\056" };
+static struct S_strliteral_2e1421 D_strliteral_2e1421 = { (char *)((char *)&D_strdata_2e1420) + 0, 5U, 5U };
+static const struct S_strdata_2e1422 D_strdata_2e1422 = { "\061\145\055\061\056\061" };
+static struct S_strliteral_2e1423 D_strliteral_2e1423 = { (char *)((char *)&D_strdata_2e1422) + 0, 6U, 6U };
+static const struct S_strdata_2e1424 D_strdata_2e1424 = { "\061\056\160\055" };
+static struct S_strliteral_2e1425 D_strliteral_2e1425 = { (char *)((char *)&D_strdata_2e1424) + 0, 4U, 4U };
+static const struct S_strdata_2e1426 D_strdata_2e1426 = { "\061\160\055\056" };
+static struct S_strliteral_2e1427 D_strliteral_2e1427 = { (char *)((char *)&D_strdata_2e1426) + 0, 4U, 4U };
+static const struct S_strdata_2e1428 D_strdata_2e1428 = { "\061\056\160\055\061" };
+static struct S_strliteral_2e1429 D_strliteral_2e1429 = { (char *)((char *)&D_strdata_2e1428) + 0, 5U, 5U };
+static const struct S_strdata_2e1430 D_strdata_2e1430 = { "\061\160\055\056\061" };
+static struct S_strliteral_2e1431 D_strliteral_2e1431 = { (char *)((char *)&D_strdata_2e1430) + 0, 5U, 5U };
+static const struct S_strdata_2e1432 D_strdata_2e1432 = { "\061\056\061\160\055" };
+static struct S_strliteral_2e1433 D_strliteral_2e1433 = { (char *)((char *)&D_strdata_2e1432) + 0, 5U, 5U };
+static const struct S_strdata_2e1434 D_strdata_2e1434 = { "\061\160\055\061\056" };
+static struct S_strliteral_2e1435 D_strliteral_2e1435 = { (char *)((char *)&D_strdata_2e1434) + 0, 5U, 5U };
+static const struct S_strdata_2e1436 D_strdata_2e1436 = { "\061\160\055\061\056\061" };
+static struct S_strliteral_2e1437 D_strliteral_2e1437 = { (char *)((char *)&D_strdata_2e1436) + 0, 6U, 6U };
+static const struct S_strdata_2e1441 D_strdata_2e1441 = { "\154\145\164\040\164\040\075\040\064\145\055\060\151\073" };
+static struct S_strliteral_2e1442 D_strliteral_2e1442 = { (char *)((char *)&D_strdata_2e1441) + 0, 14U, 14U };
+static const struct S_strdata_2e1443 D_strdata_2e1443 = { "\154\145\164\040\164\040\075\040\064\145\055\061\151\073" };
+static struct S_strliteral_2e1444 D_strliteral_2e1444 = { (char *)((char *)&D_strdata_2e1443) + 0, 14U, 14U };
+static const struct S_strdata_2e1445 D_strdata_2e1445 = { "\154\145\164\040\164\040\075\040\064\145\055\060\151\070\073" };
+static struct S_strliteral_2e1446 D_strliteral_2e1446 = { (char *)((char *)&D_strdata_2e1445) + 0, 15U, 15U };
+static const struct S_strdata_2e1447 D_strdata_2e1447 = { "\154\145\164\040\164\040\075\040\064\145\055\061\151\070\073" };
+static struct S_strliteral_2e1448 D_strliteral_2e1448 = { (char *)((char *)&D_strdata_2e1447) + 0, 15U, 15U };
+static const struct S_strdata_2e1449 D_strdata_2e1449 = { "\154\145\164\040\164\040\075\040\060\142\061\145\055\061\146\063\062\073" };
+static struct S_strliteral_2e1450 D_strliteral_2e1450 = { (char *)((char *)&D_strdata_2e1449) + 0, 18U, 18U };
+static const struct S_strdata_2e1451 D_strdata_2e1451 = { "\154\145\164\040\164\040\075\040\060\157\061\145\055\061\146\063\062\073" };
+static struct S_strliteral_2e1452 D_strliteral_2e1452 = { (char *)((char *)&D_strdata_2e1451) + 0, 18U, 18U };
+static const struct S_strdata_2e1453 D_strdata_2e1453 = { "\154\145\164\040\164\040\075\040\060\170\061\145\053\061\146\063\062\073" };
+static struct S_strliteral_2e1454 D_strliteral_2e1454 = { (char *)((char *)&D_strdata_2e1453) + 0, 18U, 18U };
+static const struct S_strdata_2e1455 D_strdata_2e1455 = { "\154\145\164\040\164\040\075\040\060\170\061\145\055\061\146\063\062\073" };
+static struct S_strliteral_2e1456 D_strliteral_2e1456 = { (char *)((char *)&D_strdata_2e1455) + 0, 18U, 18U };
+static const struct S_strdata_2e1457 D_strdata_2e1457 = { "\154\145\164\040\164\040\075\040\060\142\061\160\055\061\146\063\062\073" };
+static struct S_strliteral_2e1458 D_strliteral_2e1458 = { (char *)((char *)&D_strdata_2e1457) + 0, 18U, 18U };
+static const struct S_strdata_2e1459 D_strdata_2e1459 = { "\154\145\164\040\164\040\075\040\060\157\061\160\055\061\146\063\062\073" };
+static struct S_strliteral_2e1460 D_strliteral_2e1460 = { (char *)((char *)&D_strdata_2e1459) + 0, 18U, 18U };
+static const struct S_strdata_2e1461 D_strdata_2e1461 = { "\154\145\164\040\164\072\040\165\066\064\040\075\040\061\145\061\060\060\060\073" };
+static struct S_strliteral_2e1462 D_strliteral_2e1462 = { (char *)((char *)&D_strdata_2e1461) + 0, 20U, 20U };
+static const struct S_strdata_2e1466 D_strdata_2e1466 = { "\073" };
+static struct S_strliteral_2e1467 D_strliteral_2e1467 = { (char *)((char *)&D_strdata_2e1466) + 0, 1U, 1U };
+static const struct S_strdata_2e1468 D_strdata_2e1468 = { "\151\073" };
+static struct S_strliteral_2e1469 D_strliteral_2e1469 = { (char *)((char *)&D_strdata_2e1468) + 0, 2U, 2U };
+static const struct S_strdata_2e1470 D_strdata_2e1470 = { "\151\070\073" };
+static struct S_strliteral_2e1471 D_strliteral_2e1471 = { (char *)((char *)&D_strdata_2e1470) + 0, 3U, 3U };
+static const struct S_strdata_2e1472 D_strdata_2e1472 = { "\146\063\062\073" };
+static struct S_strliteral_2e1473 D_strliteral_2e1473 = { (char *)((char *)&D_strdata_2e1472) + 0, 4U, 4U };
+static const struct S_strdata_2e1523 D_strdata_2e1523 = { "\154\145\164\040\164\040\075\040" };
+static struct S_strliteral_2e1524 D_strliteral_2e1524 = { (char *)((char *)&D_strdata_2e1523) + 0, 8U, 8U };
+static struct S_abortsites_2e604 D_abortsites_2e604 = { (char *)((char *)&D_strliteral_2e1) + 0, 212U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 255U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 265U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 278U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 291U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 295U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 296U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 300U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 302U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 303U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 304U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 305U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 306U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 307U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 309U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 310U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 311U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 312U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 313U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 314U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 316U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 317U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 318U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 319U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 320U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 321U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 323U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 324U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 325U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 326U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 327U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 328U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 329U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 330U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 331U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 334U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 335U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 336U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 337U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 340U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 341U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 342U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 343U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 344U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 345U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 349U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 350U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 351U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 352U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 353U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 354U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 355U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 356U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 359U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 501U, 38U, (char *)((char *)&D_strliteral_2e1) + 0, 502U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 503U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 504U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 505U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 505U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 509U, 41U, (char *)((char *)&D_strliteral_2e1) + 0, 509U, 41U };
+static const struct S_strdata_2e1650 D_strdata_2e1650 = { "\154\145\164\040\162\040\075\040\047\141\142\143\047\073" };
+static struct S_strliteral_2e1651 D_strliteral_2e1651 = { (char *)((char *)&D_strdata_2e1650) + 0, 14U, 14U };
+static const struct S_strdata_2e1684 D_strdata_2e1684 = { "\154\145\164\040\162\040\075\040\047", 92U, "\060\063\063\047\073" };
+static struct S_strliteral_2e1685 D_strliteral_2e1685 = { (char *)((char *)&D_strdata_2e1684) + 0, 15U, 15U };
+static const struct S_strdata_2e1704 D_strdata_2e1704 = { "\154\145\164\040\162\040\075\040\047", 92U, "\170\143\063\047\073" };
+static struct S_strliteral_2e1705 D_strliteral_2e1705 = { (char *)((char *)&D_strdata_2e1704) + 0, 15U, 15U };
+static const struct S_strdata_2e1724 D_strdata_2e1724 = { "\154\145\164\040\162\040\075\040\047", 92U, "\170\061\062\063\047\073" };
+static struct S_strliteral_2e1725 D_strliteral_2e1725 = { (char *)((char *)&D_strdata_2e1724) + 0, 16U, 16U };
+static const struct S_strdata_2e1744 D_strdata_2e1744 = { "\154\145\164\040\162\040\075\040\047", 92U, "\165\066\071\047\073" };
+static struct S_strliteral_2e1745 D_strliteral_2e1745 = { (char *)((char *)&D_strdata_2e1744) + 0, 15U, 15U };
+static const struct S_strdata_2e1764 D_strdata_2e1764 = { "\154\145\164\040\162\040\075\040\047", 92U, "\125\061\062\063\064\065\066\067\047\073" };
+static struct S_strliteral_2e1765 D_strliteral_2e1765 = { (char *)((char *)&D_strdata_2e1764) + 0, 20U, 20U };
+static const struct S_strdata_2e1784 D_strdata_2e1784 = { "\154\145\164\040\162\040\075\040\047", 92U, "\170\141\150\047\073" };
+static struct S_strliteral_2e1785 D_strliteral_2e1785 = { (char *)((char *)&D_strdata_2e1784) + 0, 15U, 15U };
+static const struct S_strdata_2e1804 D_strdata_2e1804 = { "\154\145\164\040\162\040\075\040\047", 92U, "\165\141\150\151\152\047\073" };
+static struct S_strliteral_2e1805 D_strliteral_2e1805 = { (char *)((char *)&D_strdata_2e1804) + 0, 17U, 17U };
+static const struct S_strdata_2e1824 D_strdata_2e1824 = { "\154\145\164\040\162\040\075\040\047", 92U, "\125\141\150\151\152\153\154\155\156\047\073" };
+static struct S_strliteral_2e1825 D_strliteral_2e1825 = { (char *)((char *)&D_strdata_2e1824) + 0, 21U, 21U };
+static struct S_abortsites_2e1665 D_abortsites_2e1665 = { (char *)((char *)&D_strliteral_2e1) + 0, 525U, 48U, (char *)((char *)&D_strliteral_2e1) + 0, 525U, 48U, (char *)((char *)&D_strliteral_2e1) + 0, 526U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 526U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 527U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 527U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 528U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 528U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 529U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 529U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 530U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 530U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 531U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 531U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 532U, 51U, (char *)((char *)&D_strliteral_2e1) + 0, 532U, 51U, (char *)((char *)&D_strliteral_2e1) + 0, 533U, 55U, (char *)((char *)&D_strliteral_2e1) + 0, 533U, 55U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_basics)))();
+	((void (*)(void))((u64)((char *)&F_numeric)))();
+	((void (*)(void))((u64)((char *)&F_assignment)))();
+	((void (*)(void))((u64)((char *)&F_aggregates)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_aggregates(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[16] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	char A3[16] __attribute__((aligned(16)));
+	char A4[16] __attribute__((aligned(16)));
+	char A5[16] __attribute__((aligned(16)));
+	char A6[16] __attribute__((aligned(16)));
+	char A7[16] __attribute__((aligned(16)));
+	char A8[32] __attribute__((aligned(16)));
+	char A9[16] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e101;
+	u64 t__2e105;
+	u64 t__2e108;
+	u64 t__2e113;
+	u64 t__2e114;
+	u64 t__2e115;
+	u64 t__2e116;
+	u64 t__2e119;
+	u64 t__2e120;
+	u64 t__2e124;
+	u64 t__2e127;
+	u64 t__2e132;
+	u64 t__2e133;
+	u64 t__2e134;
+	u64 t__2e135;
+	u64 t__2e138;
+	u64 t__2e139;
+	u64 t__2e140;
+	u64 t__2e144;
+	u64 t__2e147;
+	u64 t__2e15;
+	u64 t__2e152;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e161;
+	u64 t__2e162;
+	u64 t__2e166;
+	u64 t__2e169;
+	u64 t__2e174;
+	u64 t__2e178;
+	u64 t__2e179;
+	u64 t__2e180;
+	u64 t__2e183;
+	u64 t__2e184;
+	u64 t__2e188;
+	u64 t__2e19;
+	u64 t__2e191;
+	u64 t__2e196;
+	u64 t__2e20;
+	u64 t__2e201;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e208;
+	u64 t__2e21;
+	u64 t__2e215;
+	u64 t__2e220;
+	u64 t__2e222;
+	u64 t__2e223;
+	u64 t__2e227;
+	u64 t__2e234;
+	u64 t__2e239;
+	u64 t__2e241;
+	u64 t__2e242;
+	u64 t__2e246;
+	u64 t__2e253;
+	u64 t__2e254;
+	u64 t__2e256;
+	u64 t__2e257;
+	u64 t__2e261;
+	u64 t__2e27;
+	u64 t__2e28;
+	u64 t__2e29;
+	u64 t__2e30;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t__2e33;
+	u64 t__2e37;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e44;
+	u64 t__2e45;
+	u64 t__2e46;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e54;
+	u64 t__2e57;
+	u64 t__2e58;
+	u64 t__2e59;
+	u64 t__2e63;
+	u64 t__2e66;
+	u64 t__2e71;
+	u64 t__2e75;
+	u64 t__2e76;
+	u64 t__2e77;
+	u64 t__2e80;
+	u64 t__2e81;
+	u64 t__2e85;
+	u64 t__2e88;
+	u64 t__2e93;
+	u64 t__2e94;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e99;
+	u64 t_abortsite_2e25;
+	u64 t_binding_2e109;
+	u64 t_binding_2e11;
+	u64 t_binding_2e128;
+	u64 t_binding_2e148;
+	u64 t_binding_2e170;
+	u64 t_binding_2e192;
+	u64 t_binding_2e211;
+	u64 t_binding_2e230;
+	u64 t_binding_2e249;
+	u64 t_binding_2e47;
+	u64 t_binding_2e67;
+	u64 t_binding_2e89;
+	u64 t_item_2e221;
+	u64 t_item_2e240;
+	u64 t_item_2e255;
+	u64 t_subval_2e104;
+	u64 t_subval_2e123;
+	u64 t_subval_2e143;
+	u64 t_subval_2e165;
+	u64 t_subval_2e187;
+	u64 t_subval_2e207;
+	u64 t_subval_2e226;
+	u64 t_subval_2e245;
+	u64 t_subval_2e260;
+	u64 t_subval_2e36;
+	u64 t_subval_2e62;
+	u64 t_subval_2e84;
+	u64 t_value_2e202;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	t_binding_2e47 = (u64)A1;
+	t_binding_2e67 = (u64)A2;
+	t_binding_2e89 = (u64)A3;
+	t_binding_2e109 = (u64)A4;
+	t_binding_2e128 = (u64)A5;
+	t_binding_2e148 = (u64)A6;
+	t_binding_2e170 = (u64)A7;
+	t_binding_2e192 = (u64)A8;
+	t_binding_2e211 = (u64)A9;
+	t_binding_2e230 = (u64)A10;
+	t_binding_2e249 = (u64)A11;
+	L_body_2e8:;
+	t__2e15 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e15) goto L_true_2e12; else goto L_false_2e13;
+	L_true_2e12:;
+	*(u32 *)t_binding_2e11 = (u32)((u64)379429472UL);
+	t__2e19 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e20 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)4UL)));
+	t__2e21 = (u64)(u32)(((u64)t__2e20 != (u64)((u64)0UL)));
+	if ((u32)t__2e21) goto L__2e23; else goto L__2e22;
+	L__2e22:;
+	t_abortsite_2e25 = ((u64)0UL);
+	goto L_abort_2e26;
+	L__2e23:;
+	*(u32 *)t__2e20 = (u32)((u64)2147483647UL);
+	*(u64 *)t__2e19 = (u64)t__2e20;
+	goto L__2e14;
+	L_false_2e13:;
+	*(u32 *)t_binding_2e11 = (u32)((u64)3012680272UL);
+	L__2e14:;
+	t__2e32 = t_binding_2e11;
+	t__2e33 = (u64)(u32)(*(u32 *)t_binding_2e11);
+	t_subval_2e36 = t_binding_2e11;
+	t__2e37 = (u64)(u32)(((u32)t__2e33 == (u32)((u64)379429472UL)));
+	if ((u32)t__2e37) goto L_subtype_2e39; else goto L_failed_2e35;
+	L_subtype_2e39:;
+	goto L_passed_2e34;
+	L_failed_2e35:;
+	t_abortsite_2e25 = ((u64)1UL);
+	goto L_abort_2e40;
+	L_passed_2e34:;
+	t__2e32 = (u64)((u64)t__2e32 + (u64)((u64)8UL));
+	t__2e46 = (u64)(*(u64 *)t__2e32);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e46);
+	t__2e51 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e51) goto L_true_2e48; else goto L_false_2e49;
+	L_true_2e48:;
+	*(u32 *)t_binding_2e47 = (u32)((u64)379429472UL);
+	t__2e52 = (u64)((u64)t_binding_2e47 + (u64)((u64)8UL));
+	t__2e53 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)4UL)));
+	t__2e54 = (u64)(u32)(((u64)t__2e53 != (u64)((u64)0UL)));
+	if ((u32)t__2e54) goto L__2e56; else goto L__2e55;
+	L__2e55:;
+	t_abortsite_2e25 = ((u64)2UL);
+	goto L_abort_2e26;
+	L__2e56:;
+	t__2e57 = (u64)(u32)(-(u32)((u64)2147483648UL));
+	*(u32 *)t__2e53 = (u32)t__2e57;
+	*(u64 *)t__2e52 = (u64)t__2e53;
+	goto L__2e50;
+	L_false_2e49:;
+	*(u32 *)t_binding_2e47 = (u32)((u64)3012680272UL);
+	L__2e50:;
+	t__2e58 = t_binding_2e47;
+	t__2e59 = (u64)(u32)(*(u32 *)t_binding_2e47);
+	t_subval_2e62 = t_binding_2e47;
+	t__2e63 = (u64)(u32)(((u32)t__2e59 == (u32)((u64)379429472UL)));
+	if ((u32)t__2e63) goto L_subtype_2e65; else goto L_failed_2e61;
+	L_subtype_2e65:;
+	goto L_passed_2e60;
+	L_failed_2e61:;
+	t_abortsite_2e25 = ((u64)3UL);
+	goto L_abort_2e40;
+	L_passed_2e60:;
+	t__2e58 = (u64)((u64)t__2e58 + (u64)((u64)8UL));
+	t__2e66 = (u64)(*(u64 *)t__2e58);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e66);
+	t__2e71 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e71) goto L_true_2e68; else goto L_false_2e69;
+	L_true_2e68:;
+	*(u32 *)t_binding_2e67 = (u32)((u64)1891994570UL);
+	t__2e75 = (u64)((u64)t_binding_2e67 + (u64)((u64)8UL));
+	t__2e76 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)8UL)));
+	t__2e77 = (u64)(u32)(((u64)t__2e76 != (u64)((u64)0UL)));
+	if ((u32)t__2e77) goto L__2e79; else goto L__2e78;
+	L__2e78:;
+	t_abortsite_2e25 = ((u64)4UL);
+	goto L_abort_2e26;
+	L__2e79:;
+	*(u64 *)t__2e76 = (u64)((u64)2147483648UL);
+	*(u64 *)t__2e75 = (u64)t__2e76;
+	goto L__2e70;
+	L_false_2e69:;
+	*(u32 *)t_binding_2e67 = (u32)((u64)3012680272UL);
+	L__2e70:;
+	t__2e80 = t_binding_2e67;
+	t__2e81 = (u64)(u32)(*(u32 *)t_binding_2e67);
+	t_subval_2e84 = t_binding_2e67;
+	t__2e85 = (u64)(u32)(((u32)t__2e81 == (u32)((u64)1891994570UL)));
+	if ((u32)t__2e85) goto L_subtype_2e87; else goto L_failed_2e83;
+	L_subtype_2e87:;
+	goto L_passed_2e82;
+	L_failed_2e83:;
+	t_abortsite_2e25 = ((u64)5UL);
+	goto L_abort_2e40;
+	L_passed_2e82:;
+	t__2e80 = (u64)((u64)t__2e80 + (u64)((u64)8UL));
+	t__2e88 = (u64)(*(u64 *)t__2e80);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e88);
+	t__2e93 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e93) goto L_true_2e90; else goto L_false_2e91;
+	L_true_2e90:;
+	*(u32 *)t_binding_2e89 = (u32)((u64)1891994570UL);
+	t__2e94 = (u64)((u64)t_binding_2e89 + (u64)((u64)8UL));
+	t__2e95 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)8UL)));
+	t__2e96 = (u64)(u32)(((u64)t__2e95 != (u64)((u64)0UL)));
+	if ((u32)t__2e96) goto L__2e98; else goto L__2e97;
+	L__2e97:;
+	t_abortsite_2e25 = ((u64)6UL);
+	goto L_abort_2e26;
+	L__2e98:;
+	t__2e99 = (u64)(-(u64)((u64)2147483649UL));
+	*(u64 *)t__2e95 = (u64)t__2e99;
+	*(u64 *)t__2e94 = (u64)t__2e95;
+	goto L__2e92;
+	L_false_2e91:;
+	*(u32 *)t_binding_2e89 = (u32)((u64)3012680272UL);
+	L__2e92:;
+	t__2e100 = t_binding_2e89;
+	t__2e101 = (u64)(u32)(*(u32 *)t_binding_2e89);
+	t_subval_2e104 = t_binding_2e89;
+	t__2e105 = (u64)(u32)(((u32)t__2e101 == (u32)((u64)1891994570UL)));
+	if ((u32)t__2e105) goto L_subtype_2e107; else goto L_failed_2e103;
+	L_subtype_2e107:;
+	goto L_passed_2e102;
+	L_failed_2e103:;
+	t_abortsite_2e25 = ((u64)7UL);
+	goto L_abort_2e40;
+	L_passed_2e102:;
+	t__2e100 = (u64)((u64)t__2e100 + (u64)((u64)8UL));
+	t__2e108 = (u64)(*(u64 *)t__2e100);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e108);
+	t__2e113 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e113) goto L_true_2e110; else goto L_false_2e111;
+	L_true_2e110:;
+	*(u32 *)t_binding_2e109 = (u32)((u64)1891994570UL);
+	t__2e114 = (u64)((u64)t_binding_2e109 + (u64)((u64)8UL));
+	t__2e115 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)8UL)));
+	t__2e116 = (u64)(u32)(((u64)t__2e115 != (u64)((u64)0UL)));
+	if ((u32)t__2e116) goto L__2e118; else goto L__2e117;
+	L__2e117:;
+	t_abortsite_2e25 = ((u64)8UL);
+	goto L_abort_2e26;
+	L__2e118:;
+	*(u64 *)t__2e115 = (u64)((u64)9223372036854775807UL);
+	*(u64 *)t__2e114 = (u64)t__2e115;
+	goto L__2e112;
+	L_false_2e111:;
+	*(u32 *)t_binding_2e109 = (u32)((u64)3012680272UL);
+	L__2e112:;
+	t__2e119 = t_binding_2e109;
+	t__2e120 = (u64)(u32)(*(u32 *)t_binding_2e109);
+	t_subval_2e123 = t_binding_2e109;
+	t__2e124 = (u64)(u32)(((u32)t__2e120 == (u32)((u64)1891994570UL)));
+	if ((u32)t__2e124) goto L_subtype_2e126; else goto L_failed_2e122;
+	L_subtype_2e126:;
+	goto L_passed_2e121;
+	L_failed_2e122:;
+	t_abortsite_2e25 = ((u64)9UL);
+	goto L_abort_2e40;
+	L_passed_2e121:;
+	t__2e119 = (u64)((u64)t__2e119 + (u64)((u64)8UL));
+	t__2e127 = (u64)(*(u64 *)t__2e119);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e127);
+	t__2e132 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e132) goto L_true_2e129; else goto L_false_2e130;
+	L_true_2e129:;
+	*(u32 *)t_binding_2e128 = (u32)((u64)1891994570UL);
+	t__2e133 = (u64)((u64)t_binding_2e128 + (u64)((u64)8UL));
+	t__2e134 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)8UL)));
+	t__2e135 = (u64)(u32)(((u64)t__2e134 != (u64)((u64)0UL)));
+	if ((u32)t__2e135) goto L__2e137; else goto L__2e136;
+	L__2e136:;
+	t_abortsite_2e25 = ((u64)10UL);
+	goto L_abort_2e26;
+	L__2e137:;
+	t__2e138 = (u64)(-(u64)((u64)9223372036854775807UL));
+	*(u64 *)t__2e134 = (u64)t__2e138;
+	*(u64 *)t__2e133 = (u64)t__2e134;
+	goto L__2e131;
+	L_false_2e130:;
+	*(u32 *)t_binding_2e128 = (u32)((u64)3012680272UL);
+	L__2e131:;
+	t__2e139 = t_binding_2e128;
+	t__2e140 = (u64)(u32)(*(u32 *)t_binding_2e128);
+	t_subval_2e143 = t_binding_2e128;
+	t__2e144 = (u64)(u32)(((u32)t__2e140 == (u32)((u64)1891994570UL)));
+	if ((u32)t__2e144) goto L_subtype_2e146; else goto L_failed_2e142;
+	L_subtype_2e146:;
+	goto L_passed_2e141;
+	L_failed_2e142:;
+	t_abortsite_2e25 = ((u64)11UL);
+	goto L_abort_2e40;
+	L_passed_2e141:;
+	t__2e139 = (u64)((u64)t__2e139 + (u64)((u64)8UL));
+	t__2e147 = (u64)(*(u64 *)t__2e139);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e147);
+	t__2e152 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e152) goto L_true_2e149; else goto L_false_2e150;
+	L_true_2e149:;
+	*(u32 *)t_binding_2e148 = (u32)((u64)1249569693UL);
+	t__2e156 = (u64)((u64)t_binding_2e148 + (u64)((u64)8UL));
+	t__2e157 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)8UL)));
+	t__2e158 = (u64)(u32)(((u64)t__2e157 != (u64)((u64)0UL)));
+	if ((u32)t__2e158) goto L__2e160; else goto L__2e159;
+	L__2e159:;
+	t_abortsite_2e25 = ((u64)12UL);
+	goto L_abort_2e26;
+	L__2e160:;
+	*(u64 *)t__2e157 = (u64)((u64)0UL);
+	*(u64 *)t__2e156 = (u64)t__2e157;
+	goto L__2e151;
+	L_false_2e150:;
+	*(u32 *)t_binding_2e148 = (u32)((u64)3012680272UL);
+	L__2e151:;
+	t__2e161 = t_binding_2e148;
+	t__2e162 = (u64)(u32)(*(u32 *)t_binding_2e148);
+	t_subval_2e165 = t_binding_2e148;
+	t__2e166 = (u64)(u32)(((u32)t__2e162 == (u32)((u64)1249569693UL)));
+	if ((u32)t__2e166) goto L_subtype_2e168; else goto L_failed_2e164;
+	L_subtype_2e168:;
+	goto L_passed_2e163;
+	L_failed_2e164:;
+	t_abortsite_2e25 = ((u64)13UL);
+	goto L_abort_2e40;
+	L_passed_2e163:;
+	t__2e161 = (u64)((u64)t__2e161 + (u64)((u64)8UL));
+	t__2e169 = (u64)(*(u64 *)t__2e161);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e169);
+	t__2e174 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e174) goto L_true_2e171; else goto L_false_2e172;
+	L_true_2e171:;
+	*(u32 *)t_binding_2e170 = (u32)((u64)1873593300UL);
+	t__2e178 = (u64)((u64)t_binding_2e170 + (u64)((u64)8UL));
+	t__2e179 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)4UL)));
+	t__2e180 = (u64)(u32)(((u64)t__2e179 != (u64)((u64)0UL)));
+	if ((u32)t__2e180) goto L__2e182; else goto L__2e181;
+	L__2e181:;
+	t_abortsite_2e25 = ((u64)14UL);
+	goto L_abort_2e26;
+	L__2e182:;
+	*(u32 *)t__2e179 = (u32)((u64)97UL);
+	*(u64 *)t__2e178 = (u64)t__2e179;
+	goto L__2e173;
+	L_false_2e172:;
+	*(u32 *)t_binding_2e170 = (u32)((u64)3012680272UL);
+	L__2e173:;
+	t__2e183 = t_binding_2e170;
+	t__2e184 = (u64)(u32)(*(u32 *)t_binding_2e170);
+	t_subval_2e187 = t_binding_2e170;
+	t__2e188 = (u64)(u32)(((u32)t__2e184 == (u32)((u64)1873593300UL)));
+	if ((u32)t__2e188) goto L_subtype_2e190; else goto L_failed_2e186;
+	L_subtype_2e190:;
+	goto L_passed_2e185;
+	L_failed_2e186:;
+	t_abortsite_2e25 = ((u64)15UL);
+	goto L_abort_2e40;
+	L_passed_2e185:;
+	t__2e183 = (u64)((u64)t__2e183 + (u64)((u64)8UL));
+	t__2e191 = (u64)(*(u64 *)t__2e183);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e191);
+	t__2e196 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e196) goto L_true_2e193; else goto L_false_2e194;
+	L_true_2e193:;
+	*(u32 *)t_binding_2e192 = (u32)((u64)712634143UL);
+	t__2e201 = (u64)((u64)t_binding_2e192 + (u64)((u64)8UL));
+	t_value_2e202 = (u64)((u64)t__2e201 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e202 = (u32)((u64)2147483647UL);
+	t_value_2e202 = (u64)((u64)t__2e201 + (u64)((u64)8UL));
+	*(u64 *)t_value_2e202 = (u64)((u64)0UL);
+	t_value_2e202 = (u64)((u64)t__2e201 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e202 = (u32)((u64)97UL);
+	goto L__2e195;
+	L_false_2e194:;
+	*(u32 *)t_binding_2e192 = (u32)((u64)3012680272UL);
+	L__2e195:;
+	t__2e203 = t_binding_2e192;
+	t__2e204 = (u64)(u32)(*(u32 *)t_binding_2e192);
+	t_subval_2e207 = t_binding_2e192;
+	t__2e208 = (u64)(u32)(((u32)t__2e204 == (u32)((u64)712634143UL)));
+	if ((u32)t__2e208) goto L_subtype_2e210; else goto L_failed_2e206;
+	L_subtype_2e210:;
+	goto L_passed_2e205;
+	L_failed_2e206:;
+	t_abortsite_2e25 = ((u64)16UL);
+	goto L_abort_2e40;
+	L_passed_2e205:;
+	t__2e203 = (u64)((u64)t__2e203 + (u64)((u64)8UL));
+	t__2e215 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e215) goto L_true_2e212; else goto L_false_2e213;
+	L_true_2e212:;
+	*(u32 *)t_binding_2e211 = (u32)((u64)2660991904UL);
+	t__2e220 = (u64)((u64)t_binding_2e211 + (u64)((u64)4UL));
+	t_item_2e221 = (u64)((u64)t__2e220 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e221 = (u32)((u64)0UL);
+	t_item_2e221 = (u64)((u64)t__2e220 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e221 = (u32)((u64)1UL);
+	t_item_2e221 = (u64)((u64)t__2e220 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e221 = (u32)((u64)2UL);
+	goto L__2e214;
+	L_false_2e213:;
+	*(u32 *)t_binding_2e211 = (u32)((u64)3012680272UL);
+	L__2e214:;
+	t__2e222 = t_binding_2e211;
+	t__2e223 = (u64)(u32)(*(u32 *)t_binding_2e211);
+	t_subval_2e226 = t_binding_2e211;
+	t__2e227 = (u64)(u32)(((u32)t__2e223 == (u32)((u64)2660991904UL)));
+	if ((u32)t__2e227) goto L_subtype_2e229; else goto L_failed_2e225;
+	L_subtype_2e229:;
+	goto L_passed_2e224;
+	L_failed_2e225:;
+	t_abortsite_2e25 = ((u64)17UL);
+	goto L_abort_2e40;
+	L_passed_2e224:;
+	t__2e222 = (u64)((u64)t__2e222 + (u64)((u64)4UL));
+	t__2e234 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e234) goto L_true_2e231; else goto L_false_2e232;
+	L_true_2e231:;
+	*(u32 *)t_binding_2e230 = (u32)((u64)2906644947UL);
+	t__2e239 = (u64)((u64)t_binding_2e230 + (u64)((u64)4UL));
+	t_item_2e240 = (u64)((u64)t__2e239 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e240 = (u8)((u64)0UL);
+	t_item_2e240 = (u64)((u64)t__2e239 + (u64)((u64)1UL));
+	*(u8 *)t_item_2e240 = (u8)((u64)1UL);
+	t_item_2e240 = (u64)((u64)t__2e239 + (u64)((u64)2UL));
+	*(u8 *)t_item_2e240 = (u8)((u64)2UL);
+	goto L__2e233;
+	L_false_2e232:;
+	*(u32 *)t_binding_2e230 = (u32)((u64)3012680272UL);
+	L__2e233:;
+	t__2e241 = t_binding_2e230;
+	t__2e242 = (u64)(u32)(*(u32 *)t_binding_2e230);
+	t_subval_2e245 = t_binding_2e230;
+	t__2e246 = (u64)(u32)(((u32)t__2e242 == (u32)((u64)2906644947UL)));
+	if ((u32)t__2e246) goto L_subtype_2e248; else goto L_failed_2e244;
+	L_subtype_2e248:;
+	goto L_passed_2e243;
+	L_failed_2e244:;
+	t_abortsite_2e25 = ((u64)18UL);
+	goto L_abort_2e40;
+	L_passed_2e243:;
+	t__2e241 = (u64)((u64)t__2e241 + (u64)((u64)4UL));
+	t__2e253 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e253) goto L_true_2e250; else goto L_false_2e251;
+	L_true_2e250:;
+	*(u32 *)t_binding_2e249 = (u32)((u64)2906644947UL);
+	t__2e254 = (u64)((u64)t_binding_2e249 + (u64)((u64)4UL));
+	t_item_2e255 = (u64)((u64)t__2e254 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e255 = (u8)((u64)0UL);
+	t_item_2e255 = (u64)((u64)t__2e254 + (u64)((u64)1UL));
+	*(u8 *)t_item_2e255 = (u8)((u64)1UL);
+	t_item_2e255 = (u64)((u64)t__2e254 + (u64)((u64)2UL));
+	*(u8 *)t_item_2e255 = (u8)((u64)2UL);
+	goto L__2e252;
+	L_false_2e251:;
+	*(u32 *)t_binding_2e249 = (u32)((u64)3012680272UL);
+	L__2e252:;
+	t__2e256 = t_binding_2e249;
+	t__2e257 = (u64)(u32)(*(u32 *)t_binding_2e249);
+	t_subval_2e260 = t_binding_2e249;
+	t__2e261 = (u64)(u32)(((u32)t__2e257 == (u32)((u64)2906644947UL)));
+	if ((u32)t__2e261) goto L_subtype_2e263; else goto L_failed_2e259;
+	L_subtype_2e263:;
+	goto L_passed_2e258;
+	L_failed_2e259:;
+	t_abortsite_2e25 = ((u64)19UL);
+	goto L_abort_2e40;
+	L_passed_2e258:;
+	t__2e256 = (u64)((u64)t__2e256 + (u64)((u64)4UL));
+	goto L__2e9;
+	L__2e264:;
+	L__2e9:;
+	return;
+	L_abort_2e26:;
+	t__2e27 = (u64)((u64)t_abortsite_2e25 * (u64)((u64)16UL));
+	t__2e27 = (u64)((u64)((u64)((char *)&D_abortsites_2e24)) + (u64)t__2e27);
+	t__2e28 = (u64)(*(u64 *)t__2e27);
+	t__2e29 = (u64)((u64)t__2e27 + (u64)((u64)8UL));
+	t__2e30 = (u64)(*(u32 *)t__2e29);
+	t__2e29 = (u64)((u64)t__2e27 + (u64)((u64)12UL));
+	t__2e31 = (u64)(*(u32 *)t__2e29);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e28, (u64)t__2e30, (u64)t__2e31, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e40:;
+	t__2e41 = (u64)((u64)t_abortsite_2e25 * (u64)((u64)16UL));
+	t__2e41 = (u64)((u64)((u64)((char *)&D_abortsites_2e24)) + (u64)t__2e41);
+	t__2e42 = (u64)(*(u64 *)t__2e41);
+	t__2e43 = (u64)((u64)t__2e41 + (u64)((u64)8UL));
+	t__2e44 = (u64)(*(u32 *)t__2e43);
+	t__2e43 = (u64)((u64)t__2e41 + (u64)((u64)12UL));
+	t__2e45 = (u64)(*(u32 *)t__2e43);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e42, (u64)t__2e44, (u64)t__2e45, (u64)((u64)1UL));
+	__builtin_trap();
+}
+static void F_assignment(void) {
+	char A0[1] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[1] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[16] __attribute__((aligned(16)));
+	char A7[16] __attribute__((aligned(16)));
+	char A8[16] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[16] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	char A12[16] __attribute__((aligned(16)));
+	char A13[8] __attribute__((aligned(16)));
+	char A14[16] __attribute__((aligned(16)));
+	char A15[8] __attribute__((aligned(16)));
+	char A16[16] __attribute__((aligned(16)));
+	char A17[16] __attribute__((aligned(16)));
+	char A18[16] __attribute__((aligned(16)));
+	char A19[8] __attribute__((aligned(16)));
+	char A20[16] __attribute__((aligned(16)));
+	char A21[8] __attribute__((aligned(16)));
+	char A22[16] __attribute__((aligned(16)));
+	char A23[8] __attribute__((aligned(16)));
+	char A24[16] __attribute__((aligned(16)));
+	char A25[4] __attribute__((aligned(16)));
+	char A26[8] __attribute__((aligned(16)));
+	char A27[8] __attribute__((aligned(16)));
+	char A28[960] __attribute__((aligned(16)));
+	char A29[8] __attribute__((aligned(16)));
+	char A30[8] __attribute__((aligned(16)));
+	char A31[24] __attribute__((aligned(16)));
+	char B32[8] __attribute__((aligned(16)));
+	char B33[24] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char R35[4] __attribute__((aligned(16)));
+	u64 t__2e320;
+	u64 t__2e322;
+	u64 t__2e324;
+	u64 t__2e326;
+	u64 t__2e328;
+	u64 t__2e330;
+	u64 t__2e332;
+	u64 t__2e334;
+	u64 t__2e336;
+	u64 t__2e338;
+	u64 t__2e341;
+	u64 t__2e344;
+	u64 t__2e350;
+	u64 t__2e351;
+	u64 t__2e352;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e444;
+	u64 t__2e445;
+	u64 t__2e449;
+	u64 t__2e455;
+	u64 t__2e456;
+	u64 t__2e457;
+	u64 t__2e460;
+	u64 t__2e469;
+	u64 t__2e471;
+	u64 t__2e473;
+	u64 t__2e474;
+	u64 t__2e475;
+	u64 t__2e476;
+	u64 t__2e477;
+	u64 t__2e480;
+	u64 t__2e481;
+	u64 t__2e482;
+	u64 t__2e483;
+	u64 t__2e484;
+	u64 t__2e486;
+	u64 t_abortsite_2e348;
+	u64 t_binding_2e269;
+	u64 t_binding_2e270;
+	u64 t_binding_2e271;
+	u64 t_binding_2e272;
+	u64 t_binding_2e273;
+	u64 t_binding_2e274;
+	u64 t_binding_2e278;
+	u64 t_binding_2e282;
+	u64 t_binding_2e288;
+	u64 t_binding_2e292;
+	u64 t_binding_2e296;
+	u64 t_binding_2e302;
+	u64 t_binding_2e306;
+	u64 t_binding_2e307;
+	u64 t_binding_2e311;
+	u64 t_binding_2e355;
+	u64 t_binding_2e356;
+	u64 t_binding_2e357;
+	u64 t_binding_2e358;
+	u64 t_binding_2e443;
+	u64 t_item_2e361;
+	u64 t_object_2e319;
+	u64 t_object_2e321;
+	u64 t_object_2e323;
+	u64 t_object_2e325;
+	u64 t_object_2e327;
+	u64 t_object_2e329;
+	u64 t_object_2e331;
+	u64 t_object_2e333;
+	u64 t_object_2e335;
+	u64 t_object_2e337;
+	u64 t_object_2e451;
+	u64 t_object_2e458;
+	u64 t_subval_2e343;
+	u64 t_tag_2e461;
+	L_start_2e265:;
+	t_binding_2e269 = (u64)A0;
+	t_binding_2e270 = (u64)A1;
+	t_binding_2e271 = (u64)A2;
+	t_binding_2e272 = (u64)A3;
+	t_binding_2e273 = (u64)A4;
+	t_binding_2e274 = (u64)A5;
+	t_binding_2e278 = (u64)A6;
+	t_binding_2e282 = (u64)A7;
+	t_binding_2e288 = (u64)A8;
+	t_binding_2e292 = (u64)A9;
+	t_binding_2e296 = (u64)A10;
+	t_binding_2e302 = (u64)A11;
+	t_binding_2e306 = (u64)A12;
+	t_binding_2e307 = (u64)A13;
+	t_binding_2e311 = (u64)A14;
+	t_object_2e319 = (u64)A15;
+	t_object_2e321 = (u64)A16;
+	t_object_2e323 = (u64)A17;
+	t_object_2e325 = (u64)A18;
+	t_object_2e327 = (u64)A19;
+	t_object_2e329 = (u64)A20;
+	t_object_2e331 = (u64)A21;
+	t_object_2e333 = (u64)A22;
+	t_object_2e335 = (u64)A23;
+	t_object_2e337 = (u64)A24;
+	t_binding_2e355 = (u64)A25;
+	t_binding_2e356 = (u64)A26;
+	t_binding_2e357 = (u64)A27;
+	t_binding_2e358 = (u64)A28;
+	t_binding_2e443 = (u64)A29;
+	t_object_2e451 = (u64)A30;
+	t_object_2e458 = (u64)A31;
+	L_body_2e266:;
+	*(u8 *)t_binding_2e269 = (u8)((u64)0UL);
+	*(u64 *)t_binding_2e270 = (u64)((u64)0UL);
+	*(u64 *)t_binding_2e271 = (u64)((u64)0UL);
+	*(u32 *)t_binding_2e272 = (u32)((u64)97UL);
+	*(u8 *)t_binding_2e273 = (u8)((u64)0UL);
+	*(u32 *)t_binding_2e274 = (u32)((u64)3012680272UL);
+	*(u32 *)t_binding_2e278 = (u32)((u64)3012680272UL);
+	*(u32 *)t_binding_2e282 = (u32)((u64)3012680272UL);
+	*(u32 *)t_binding_2e288 = (u32)((u64)3012680272UL);
+	*(u32 *)t_binding_2e292 = (u32)((u64)3012680272UL);
+	*(u32 *)t_binding_2e296 = (u32)((u64)3012680272UL);
+	*(u32 *)t_binding_2e302 = (u32)((u64)3012680272UL);
+	*(u32 *)t_binding_2e306 = (u32)((u64)3012680272UL);
+	*(u32 *)t_binding_2e307 = (u32)((u64)3012680272UL);
+	*(u32 *)t_binding_2e311 = (u32)((u64)3012680272UL);
+	*(u8 *)t_binding_2e269 = (u8)((u64)127UL);
+	*(u64 *)t_binding_2e270 = (u64)((u64)18446744073709551615UL);
+	*(u8 *)t_binding_2e273 = (u8)((u64)0UL);
+	*(u32 *)t_object_2e319 = (u32)((u64)1099590421UL);
+	t__2e320 = (u64)((u64)t_object_2e319 + (u64)((u64)4UL));
+	*(u32 *)t__2e320 = (u32)((u64)0UL);
+	BLIT(t_binding_2e274, t_object_2e319, ((u64)8UL));
+	*(u32 *)t_object_2e321 = (u32)((u64)1268499444UL);
+	t__2e322 = (u64)((u64)t_object_2e321 + (u64)((u64)8UL));
+	*(u64 *)t__2e322 = (u64)((u64)0UL);
+	BLIT(t_binding_2e278, t_object_2e321, ((u64)16UL));
+	*(u32 *)t_object_2e323 = (u32)((u64)1099590421UL);
+	t__2e324 = (u64)((u64)t_object_2e323 + (u64)((u64)4UL));
+	*(u32 *)t__2e324 = (u32)((u64)0UL);
+	BLIT(t_binding_2e282, t_object_2e323, ((u64)16UL));
+	*(u64 *)t_binding_2e271 = (u64)((u64)0UL);
+	*(u32 *)t_object_2e325 = (u32)((u64)930681398UL);
+	t__2e326 = (u64)((u64)t_object_2e325 + (u64)((u64)8UL));
+	*(u64 *)t__2e326 = (u64)((u64)0UL);
+	BLIT(t_binding_2e288, t_object_2e325, ((u64)16UL));
+	*(u32 *)t_object_2e327 = (u32)((u64)1568378015UL);
+	t__2e328 = (u64)((u64)t_object_2e327 + (u64)((u64)4UL));
+	*(u32 *)t__2e328 = (u32)((u64)0UL);
+	BLIT(t_binding_2e292, t_object_2e327, ((u64)8UL));
+	*(u32 *)t_object_2e329 = (u32)((u64)930681398UL);
+	t__2e330 = (u64)((u64)t_object_2e329 + (u64)((u64)8UL));
+	*(u64 *)t__2e330 = (u64)((u64)0UL);
+	BLIT(t_binding_2e296, t_object_2e329, ((u64)16UL));
+	*(u8 *)t_binding_2e269 = (u8)((u64)97UL);
+	*(u64 *)t_binding_2e270 = (u64)((u64)97UL);
+	*(u32 *)t_binding_2e272 = (u32)((u64)97UL);
+	*(u8 *)t_binding_2e273 = (u8)((u64)97UL);
+	*(u32 *)t_object_2e331 = (u32)((u64)2843771249UL);
+	t__2e332 = (u64)((u64)t_object_2e331 + (u64)((u64)4UL));
+	*(u32 *)t__2e332 = (u32)((u64)97UL);
+	BLIT(t_binding_2e302, t_object_2e331, ((u64)8UL));
+	*(u32 *)t_object_2e333 = (u32)((u64)1268499444UL);
+	t__2e334 = (u64)((u64)t_object_2e333 + (u64)((u64)8UL));
+	*(u64 *)t__2e334 = (u64)((u64)256UL);
+	BLIT(t_binding_2e306, t_object_2e333, ((u64)16UL));
+	*(u32 *)t_object_2e335 = (u32)((u64)3181589295UL);
+	t__2e336 = (u64)((u64)t_object_2e335 + (u64)((u64)4UL));
+	*(u8 *)t__2e336 = (u8)((u64)97UL);
+	BLIT(t_binding_2e307, t_object_2e335, ((u64)8UL));
+	*(u32 *)t_object_2e337 = (u32)((u64)2843771249UL);
+	t__2e338 = (u64)((u64)t_object_2e337 + (u64)((u64)4UL));
+	*(u32 *)t__2e338 = (u32)((u64)97UL);
+	BLIT(t_binding_2e311, t_object_2e337, ((u64)16UL));
+	t__2e341 = (u64)(u32)(*(u32 *)t_binding_2e311);
+	t_subval_2e343 = t_binding_2e311;
+	t__2e344 = (u64)(u32)(((u32)t__2e341 == (u32)((u64)2843771249UL)));
+	if ((u32)t__2e344) goto L_subtype_2e346; else goto L_passed_2e342;
+	L_subtype_2e346:;
+	goto L_passed_2e342;
+	L_passed_2e342:;
+	if ((u32)t__2e344) goto L_passed_2e340; else goto L_failed_2e339;
+	L_failed_2e339:;
+	t_abortsite_2e348 = ((u64)0UL);
+	goto L_abort_2e349;
+	L_passed_2e340:;
+	*(u32 *)t_binding_2e355 = (u32)((u64)97UL);
+	*(u64 *)t_binding_2e356 = (u64)((u64)97UL);
+	*(u64 *)t_binding_2e357 = (u64)((u64)97UL);
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)0UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e363)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)24UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e365)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)48UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e367)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)72UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e369)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)96UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e371)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)120UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e373)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)144UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e375)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)168UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e377)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)192UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e379)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)216UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e381)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)240UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e383)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)264UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e385)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)288UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e387)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)312UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e389)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)336UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e391)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)360UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e393)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)384UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e395)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)408UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e397)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)432UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e399)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)456UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e401)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)480UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e403)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)504UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e405)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)528UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e407)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)552UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e409)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)576UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e411)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)600UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e413)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)624UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e415)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)648UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e413)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)672UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e415)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)696UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e417)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)720UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e419)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)744UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e421)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)768UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e423)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)792UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e425)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)816UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e427)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)840UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e429)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)864UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e431)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)888UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e433)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)912UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e435)), ((u64)24UL));
+	t_item_2e361 = (u64)((u64)t_binding_2e358 + (u64)((u64)936UL));
+	BLIT(t_item_2e361, ((u64)((char *)&D_strliteral_2e437)), ((u64)24UL));
+	*(u64 *)t_binding_2e443 = (u64)((u64)0UL);
+	L_loop_2e438:;
+	t__2e445 = (u64)(*(u64 *)t_binding_2e443);
+	t__2e444 = (u64)(u32)(((u64)t__2e445 < (u64)((u64)40UL)));
+	if ((u32)t__2e444) goto L_body_2e439; else goto L__2e441;
+	L_body_2e439:;
+	*(u32 *)t_object_2e451 = (u32)((u64)3532310079UL);
+	t__2e455 = (u64)((u64)t_object_2e451 + (u64)((u64)4UL));
+	*(u32 *)t__2e455 = (u32)((u64)4UL);
+	t__2e457 = (u64)(*(u64 *)t_binding_2e443);
+	t__2e456 = (u64)((u64)t__2e457 * (u64)((u64)24UL));
+	t__2e456 = (u64)((u64)t_binding_2e358 + (u64)t__2e456);
+	*(u64 *)t_object_2e458 = (u64)((u64)0UL);
+	t__2e460 = (u64)((u64)t_object_2e458 + (u64)((u64)8UL));
+	*(u64 *)t__2e460 = (u64)((u64)0UL);
+	t__2e460 = (u64)((u64)t__2e460 + (u64)((u64)8UL));
+	*(u64 *)t__2e460 = (u64)((u64)0UL);
+	BLIT((u64)B32, t_object_2e451, 8);
+	BLIT((u64)B33, t__2e456, 24);
+	BLIT((u64)B34, t_object_2e458, 24);
+	t__2e449 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R35, (u64)B32, (u64)B33, (u64)B34);
+	t_tag_2e461 = (u64)(*(u32 *)t__2e449);
+	t__2e469 = (u64)(u32)(((u32)t_tag_2e461 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e469) goto L_member_2e466; else goto L__2e468;
+	L__2e468:;
+	t__2e471 = (u64)(u32)(((u32)t_tag_2e461 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e471) goto L_member_2e467; else goto L__2e470;
+	L__2e470:;
+	goto L_matches_2e465;
+	L_member_2e466:;
+	goto L_matches_2e465;
+	L_member_2e467:;
+	goto L_matches_2e464;
+	L_matches_2e464:;
+	goto L__2e462;
+	L_matches_2e465:;
+	t_abortsite_2e348 = ((u64)1UL);
+	goto L_abort_2e472;
+	L__2e478:;
+	L__2e463:;
+	t_abortsite_2e348 = ((u64)2UL);
+	goto L_abort_2e479;
+	L__2e462:;
+	goto L__2e446;
+	L__2e485:;
+	L__2e446:;
+	L_after_2e442:;
+	t__2e486 = (u64)(*(u64 *)t_binding_2e443);
+	t__2e486 = (u64)((u64)t__2e486 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e443 = (u64)t__2e486;
+	goto L_loop_2e438;
+	L__2e441:;
+	goto L__2e267;
+	L__2e487:;
+	L__2e267:;
+	return;
+	L_abort_2e349:;
+	t__2e350 = (u64)((u64)t_abortsite_2e348 * (u64)((u64)16UL));
+	t__2e350 = (u64)((u64)((u64)((char *)&D_abortsites_2e347)) + (u64)t__2e350);
+	t__2e351 = (u64)(*(u64 *)t__2e350);
+	t__2e352 = (u64)((u64)t__2e350 + (u64)((u64)8UL));
+	t__2e353 = (u64)(*(u32 *)t__2e352);
+	t__2e352 = (u64)((u64)t__2e350 + (u64)((u64)12UL));
+	t__2e354 = (u64)(*(u32 *)t__2e352);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e351, (u64)t__2e353, (u64)t__2e354, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e472:;
+	t__2e473 = (u64)((u64)t_abortsite_2e348 * (u64)((u64)16UL));
+	t__2e473 = (u64)((u64)((u64)((char *)&D_abortsites_2e347)) + (u64)t__2e473);
+	t__2e474 = (u64)(*(u64 *)t__2e473);
+	t__2e475 = (u64)((u64)t__2e473 + (u64)((u64)8UL));
+	t__2e476 = (u64)(*(u32 *)t__2e475);
+	t__2e475 = (u64)((u64)t__2e473 + (u64)((u64)12UL));
+	t__2e477 = (u64)(*(u32 *)t__2e475);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e474, (u64)t__2e476, (u64)t__2e477, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e479:;
+	t__2e480 = (u64)((u64)t_abortsite_2e348 * (u64)((u64)16UL));
+	t__2e480 = (u64)((u64)((u64)((char *)&D_abortsites_2e347)) + (u64)t__2e480);
+	t__2e481 = (u64)(*(u64 *)t__2e480);
+	t__2e482 = (u64)((u64)t__2e480 + (u64)((u64)8UL));
+	t__2e483 = (u64)(*(u32 *)t__2e482);
+	t__2e482 = (u64)((u64)t__2e480 + (u64)((u64)12UL));
+	t__2e484 = (u64)(*(u32 *)t__2e482);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e481, (u64)t__2e483, (u64)t__2e484, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_numeric(void) {
+	char A0[208] __attribute__((aligned(16)));
+	char A1[624] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[832] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[304] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[220] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[440] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[12] __attribute__((aligned(16)));
+	char A14[4] __attribute__((aligned(16)));
+	char A15[4776] __attribute__((aligned(16)));
+	char A16[264] __attribute__((aligned(16)));
+	char A17[96] __attribute__((aligned(16)));
+	char A18[256] __attribute__((aligned(16)));
+	char A19[8] __attribute__((aligned(16)));
+	char A20[8] __attribute__((aligned(16)));
+	char A21[24] __attribute__((aligned(16)));
+	char A22[8] __attribute__((aligned(16)));
+	char A23[24] __attribute__((aligned(16)));
+	char A24[8] __attribute__((aligned(16)));
+	char A25[8] __attribute__((aligned(16)));
+	char A26[24] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char R28[24] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char R30[24] __attribute__((aligned(16)));
+	char B31[24] __attribute__((aligned(16)));
+	char R32[24] __attribute__((aligned(16)));
+	char B33[8] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char B35[24] __attribute__((aligned(16)));
+	char R36[4] __attribute__((aligned(16)));
+	char B37[8] __attribute__((aligned(16)));
+	char B38[24] __attribute__((aligned(16)));
+	char B39[24] __attribute__((aligned(16)));
+	char R40[4] __attribute__((aligned(16)));
+	u64 t__2e1002;
+	u64 t__2e1005;
+	u64 t__2e1006;
+	u64 t__2e1009;
+	u64 t__2e1010;
+	u64 t__2e1013;
+	u64 t__2e1016;
+	u64 t__2e1017;
+	u64 t__2e1020;
+	u64 t__2e1021;
+	u64 t__2e1024;
+	u64 t__2e1027;
+	u64 t__2e1032;
+	u64 t__2e1035;
+	u64 t__2e1036;
+	u64 t__2e1477;
+	u64 t__2e1478;
+	u64 t__2e1486;
+	u64 t__2e1487;
+	u64 t__2e1496;
+	u64 t__2e1497;
+	u64 t__2e1501;
+	u64 t__2e1502;
+	u64 t__2e1503;
+	u64 t__2e1504;
+	u64 t__2e1507;
+	u64 t__2e1511;
+	u64 t__2e1512;
+	u64 t__2e1513;
+	u64 t__2e1514;
+	u64 t__2e1515;
+	u64 t__2e1518;
+	u64 t__2e1519;
+	u64 t__2e1520;
+	u64 t__2e1521;
+	u64 t__2e1522;
+	u64 t__2e1525;
+	u64 t__2e1526;
+	u64 t__2e1527;
+	u64 t__2e1528;
+	u64 t__2e1529;
+	u64 t__2e1532;
+	u64 t__2e1533;
+	u64 t__2e1534;
+	u64 t__2e1535;
+	u64 t__2e1536;
+	u64 t__2e1537;
+	u64 t__2e1538;
+	u64 t__2e1539;
+	u64 t__2e1540;
+	u64 t__2e1541;
+	u64 t__2e1542;
+	u64 t__2e1543;
+	u64 t__2e1544;
+	u64 t__2e1545;
+	u64 t__2e1546;
+	u64 t__2e1549;
+	u64 t__2e1550;
+	u64 t__2e1551;
+	u64 t__2e1552;
+	u64 t__2e1553;
+	u64 t__2e1554;
+	u64 t__2e1555;
+	u64 t__2e1556;
+	u64 t__2e1557;
+	u64 t__2e1558;
+	u64 t__2e1559;
+	u64 t__2e1560;
+	u64 t__2e1561;
+	u64 t__2e1562;
+	u64 t__2e1563;
+	u64 t__2e1566;
+	u64 t__2e1567;
+	u64 t__2e1568;
+	u64 t__2e1569;
+	u64 t__2e1571;
+	u64 t__2e1574;
+	u64 t__2e1583;
+	u64 t__2e1585;
+	u64 t__2e1587;
+	u64 t__2e1588;
+	u64 t__2e1589;
+	u64 t__2e1590;
+	u64 t__2e1591;
+	u64 t__2e1594;
+	u64 t__2e1595;
+	u64 t__2e1596;
+	u64 t__2e1597;
+	u64 t__2e1598;
+	u64 t__2e1600;
+	u64 t__2e1602;
+	u64 t__2e1609;
+	u64 t__2e1610;
+	u64 t__2e1614;
+	u64 t__2e1616;
+	u64 t__2e1617;
+	u64 t__2e1619;
+	u64 t__2e1628;
+	u64 t__2e1630;
+	u64 t__2e1633;
+	u64 t__2e531;
+	u64 t__2e532;
+	u64 t__2e536;
+	u64 t__2e537;
+	u64 t__2e540;
+	u64 t__2e543;
+	u64 t__2e546;
+	u64 t__2e549;
+	u64 t__2e552;
+	u64 t__2e555;
+	u64 t__2e556;
+	u64 t__2e557;
+	u64 t__2e558;
+	u64 t__2e559;
+	u64 t__2e561;
+	u64 t__2e562;
+	u64 t__2e563;
+	u64 t__2e564;
+	u64 t__2e566;
+	u64 t__2e567;
+	u64 t__2e569;
+	u64 t__2e570;
+	u64 t__2e571;
+	u64 t__2e573;
+	u64 t__2e574;
+	u64 t__2e576;
+	u64 t__2e577;
+	u64 t__2e578;
+	u64 t__2e579;
+	u64 t__2e581;
+	u64 t__2e582;
+	u64 t__2e583;
+	u64 t__2e585;
+	u64 t__2e586;
+	u64 t__2e587;
+	u64 t__2e588;
+	u64 t__2e589;
+	u64 t__2e591;
+	u64 t__2e592;
+	u64 t__2e593;
+	u64 t__2e595;
+	u64 t__2e596;
+	u64 t__2e597;
+	u64 t__2e599;
+	u64 t__2e600;
+	u64 t__2e601;
+	u64 t__2e603;
+	u64 t__2e607;
+	u64 t__2e608;
+	u64 t__2e609;
+	u64 t__2e610;
+	u64 t__2e611;
+	u64 t__2e613;
+	u64 t__2e650;
+	u64 t__2e651;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t__2e659;
+	u64 t__2e662;
+	u64 t__2e665;
+	u64 t__2e668;
+	u64 t__2e671;
+	u64 t__2e674;
+	u64 t__2e675;
+	u64 t__2e676;
+	u64 t__2e677;
+	u64 t__2e678;
+	u64 t__2e679;
+	u64 t__2e681;
+	u64 t__2e682;
+	u64 t__2e683;
+	u64 t__2e684;
+	u64 t__2e686;
+	u64 t__2e687;
+	u64 t__2e688;
+	u64 t__2e690;
+	u64 t__2e691;
+	u64 t__2e692;
+	u64 t__2e693;
+	u64 t__2e695;
+	u64 t__2e696;
+	u64 t__2e698;
+	u64 t__2e699;
+	u64 t__2e700;
+	u64 t__2e701;
+	u64 t__2e703;
+	u64 t__2e704;
+	u64 t__2e705;
+	u64 t__2e707;
+	u64 t__2e708;
+	u64 t__2e709;
+	u64 t__2e710;
+	u64 t__2e711;
+	u64 t__2e713;
+	u64 t__2e714;
+	u64 t__2e715;
+	u64 t__2e717;
+	u64 t__2e718;
+	u64 t__2e719;
+	u64 t__2e721;
+	u64 t__2e722;
+	u64 t__2e723;
+	u64 t__2e725;
+	u64 t__2e727;
+	u64 t__2e737;
+	u64 t__2e738;
+	u64 t__2e743;
+	u64 t__2e744;
+	u64 t__2e745;
+	u64 t__2e746;
+	u64 t__2e748;
+	u64 t__2e758;
+	u64 t__2e759;
+	u64 t__2e764;
+	u64 t__2e765;
+	u64 t__2e766;
+	u64 t__2e767;
+	u64 t__2e769;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e787;
+	u64 t__2e788;
+	u64 t__2e790;
+	u64 t__2e793;
+	u64 t__2e796;
+	u64 t__2e804;
+	u64 t__2e807;
+	u64 t__2e810;
+	u64 t__2e813;
+	u64 t__2e816;
+	u64 t__2e819;
+	u64 t__2e822;
+	u64 t__2e825;
+	u64 t__2e828;
+	u64 t__2e831;
+	u64 t__2e834;
+	u64 t__2e837;
+	u64 t__2e840;
+	u64 t__2e843;
+	u64 t__2e846;
+	u64 t__2e849;
+	u64 t__2e852;
+	u64 t__2e855;
+	u64 t__2e858;
+	u64 t__2e861;
+	u64 t__2e864;
+	u64 t__2e867;
+	u64 t__2e870;
+	u64 t__2e873;
+	u64 t__2e876;
+	u64 t__2e879;
+	u64 t__2e882;
+	u64 t__2e885;
+	u64 t__2e888;
+	u64 t__2e891;
+	u64 t__2e894;
+	u64 t__2e897;
+	u64 t__2e900;
+	u64 t__2e903;
+	u64 t__2e906;
+	u64 t__2e909;
+	u64 t__2e912;
+	u64 t__2e915;
+	u64 t__2e918;
+	u64 t__2e921;
+	u64 t__2e924;
+	u64 t__2e927;
+	u64 t__2e930;
+	u64 t__2e933;
+	u64 t__2e936;
+	u64 t__2e939;
+	u64 t__2e942;
+	u64 t__2e945;
+	u64 t__2e948;
+	u64 t__2e951;
+	u64 t__2e954;
+	u64 t__2e957;
+	u64 t__2e960;
+	u64 t__2e963;
+	u64 t__2e966;
+	u64 t__2e969;
+	u64 t__2e972;
+	u64 t__2e975;
+	u64 t__2e978;
+	u64 t__2e981;
+	u64 t__2e984;
+	u64 t__2e987;
+	u64 t__2e990;
+	u64 t__2e993;
+	u64 t__2e996;
+	u64 t__2e999;
+	u64 t_abortsite_2e605;
+	u64 t_binding_2e1028;
+	u64 t_binding_2e1037;
+	u64 t_binding_2e1438;
+	u64 t_binding_2e1463;
+	u64 t_binding_2e1474;
+	u64 t_binding_2e1485;
+	u64 t_binding_2e1495;
+	u64 t_binding_2e1500;
+	u64 t_binding_2e1608;
+	u64 t_binding_2e492;
+	u64 t_binding_2e495;
+	u64 t_binding_2e530;
+	u64 t_binding_2e535;
+	u64 t_binding_2e614;
+	u64 t_binding_2e649;
+	u64 t_binding_2e654;
+	u64 t_binding_2e728;
+	u64 t_binding_2e736;
+	u64 t_binding_2e749;
+	u64 t_binding_2e757;
+	u64 t_binding_2e770;
+	u64 t_binding_2e778;
+	u64 t_binding_2e797;
+	u64 t_data_2e1516;
+	u64 t_item_2e1039;
+	u64 t_item_2e1440;
+	u64 t_item_2e1465;
+	u64 t_item_2e1476;
+	u64 t_item_2e1479;
+	u64 t_item_2e494;
+	u64 t_item_2e498;
+	u64 t_item_2e617;
+	u64 t_item_2e730;
+	u64 t_item_2e751;
+	u64 t_item_2e772;
+	u64 t_object_2e1572;
+	u64 t_object_2e1573;
+	u64 t_object_2e1615;
+	u64 t_object_2e1618;
+	u64 t_tag_2e1575;
+	u64 t_tag_2e1620;
+	u64 t_value_2e499;
+	u64 t_value_2e500;
+	u64 t_value_2e501;
+	u64 t_value_2e502;
+	u64 t_value_2e503;
+	u64 t_value_2e504;
+	u64 t_value_2e505;
+	u64 t_value_2e506;
+	u64 t_value_2e507;
+	u64 t_value_2e508;
+	u64 t_value_2e509;
+	u64 t_value_2e510;
+	u64 t_value_2e511;
+	u64 t_value_2e512;
+	u64 t_value_2e513;
+	u64 t_value_2e514;
+	u64 t_value_2e515;
+	u64 t_value_2e516;
+	u64 t_value_2e517;
+	u64 t_value_2e518;
+	u64 t_value_2e519;
+	u64 t_value_2e520;
+	u64 t_value_2e521;
+	u64 t_value_2e522;
+	u64 t_value_2e523;
+	u64 t_value_2e524;
+	u64 t_value_2e560;
+	u64 t_value_2e565;
+	u64 t_value_2e568;
+	u64 t_value_2e572;
+	u64 t_value_2e575;
+	u64 t_value_2e580;
+	u64 t_value_2e584;
+	u64 t_value_2e590;
+	u64 t_value_2e594;
+	u64 t_value_2e598;
+	u64 t_value_2e602;
+	u64 t_value_2e618;
+	u64 t_value_2e619;
+	u64 t_value_2e620;
+	u64 t_value_2e621;
+	u64 t_value_2e622;
+	u64 t_value_2e623;
+	u64 t_value_2e624;
+	u64 t_value_2e625;
+	u64 t_value_2e626;
+	u64 t_value_2e627;
+	u64 t_value_2e628;
+	u64 t_value_2e629;
+	u64 t_value_2e630;
+	u64 t_value_2e631;
+	u64 t_value_2e632;
+	u64 t_value_2e633;
+	u64 t_value_2e634;
+	u64 t_value_2e635;
+	u64 t_value_2e636;
+	u64 t_value_2e637;
+	u64 t_value_2e638;
+	u64 t_value_2e639;
+	u64 t_value_2e640;
+	u64 t_value_2e641;
+	u64 t_value_2e642;
+	u64 t_value_2e643;
+	u64 t_value_2e680;
+	u64 t_value_2e685;
+	u64 t_value_2e689;
+	u64 t_value_2e694;
+	u64 t_value_2e697;
+	u64 t_value_2e702;
+	u64 t_value_2e706;
+	u64 t_value_2e712;
+	u64 t_value_2e716;
+	u64 t_value_2e720;
+	u64 t_value_2e724;
+	u64 t_value_2e800;
+	u64 t_value_2e801;
+	u64 t_value_2e805;
+	u64 t_value_2e806;
+	u64 t_value_2e811;
+	u64 t_value_2e812;
+	u64 t_value_2e817;
+	u64 t_value_2e818;
+	u64 t_value_2e823;
+	u64 t_value_2e824;
+	u64 t_value_2e829;
+	u64 t_value_2e830;
+	u64 t_value_2e835;
+	u64 t_value_2e836;
+	u64 t_value_2e841;
+	u64 t_value_2e842;
+	u64 t_value_2e847;
+	u64 t_value_2e848;
+	u64 t_value_2e853;
+	u64 t_value_2e854;
+	u64 t_value_2e859;
+	u64 t_value_2e860;
+	u64 t_value_2e865;
+	u64 t_value_2e866;
+	u64 t_value_2e871;
+	u64 t_value_2e872;
+	u64 t_value_2e877;
+	u64 t_value_2e878;
+	u64 t_value_2e883;
+	u64 t_value_2e884;
+	u64 t_value_2e889;
+	u64 t_value_2e890;
+	u64 t_value_2e895;
+	u64 t_value_2e896;
+	u64 t_value_2e901;
+	u64 t_value_2e902;
+	u64 t_value_2e907;
+	u64 t_value_2e908;
+	u64 t_value_2e913;
+	u64 t_value_2e914;
+	u64 t_value_2e919;
+	u64 t_value_2e920;
+	u64 t_value_2e925;
+	u64 t_value_2e926;
+	u64 t_value_2e931;
+	u64 t_value_2e932;
+	u64 t_value_2e937;
+	u64 t_value_2e938;
+	u64 t_value_2e943;
+	u64 t_value_2e944;
+	u64 t_value_2e949;
+	u64 t_value_2e950;
+	u64 t_value_2e955;
+	u64 t_value_2e956;
+	u64 t_value_2e961;
+	u64 t_value_2e962;
+	u64 t_value_2e967;
+	u64 t_value_2e968;
+	L_start_2e488:;
+	t_binding_2e492 = (u64)A0;
+	t_binding_2e495 = (u64)A1;
+	t_binding_2e530 = (u64)A2;
+	t_binding_2e535 = (u64)A3;
+	t_binding_2e614 = (u64)A4;
+	t_binding_2e649 = (u64)A5;
+	t_binding_2e654 = (u64)A6;
+	t_binding_2e728 = (u64)A7;
+	t_binding_2e736 = (u64)A8;
+	t_binding_2e749 = (u64)A9;
+	t_binding_2e757 = (u64)A10;
+	t_binding_2e770 = (u64)A11;
+	t_binding_2e778 = (u64)A12;
+	t_binding_2e797 = (u64)A13;
+	t_binding_2e1028 = (u64)A14;
+	t_binding_2e1037 = (u64)A15;
+	t_binding_2e1438 = (u64)A16;
+	t_binding_2e1463 = (u64)A17;
+	t_binding_2e1474 = (u64)A18;
+	t_binding_2e1485 = (u64)A19;
+	t_binding_2e1495 = (u64)A20;
+	t_binding_2e1500 = (u64)A21;
+	t_object_2e1572 = (u64)A22;
+	t_object_2e1573 = (u64)A23;
+	t_binding_2e1608 = (u64)A24;
+	t_object_2e1615 = (u64)A25;
+	t_object_2e1618 = (u64)A26;
+	L_body_2e489:;
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)42UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)8UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)42UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)16UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)42UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)24UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)42UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)32UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)42UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)40UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)42UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)48UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)42UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)56UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)42UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)64UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)0UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)72UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)0UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)80UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)0UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)88UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)0UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)96UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)1UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)104UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)1UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)112UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)1UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)120UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)1UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)128UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)0UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)136UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)0UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)144UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)0UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)152UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)1UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)160UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)1UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)168UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)1UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)176UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)100UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)184UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)100UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)192UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)100UL);
+	t_item_2e494 = (u64)((u64)t_binding_2e492 + (u64)((u64)200UL));
+	*(u64 *)t_item_2e494 = (u64)((u64)100UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)0UL));
+	t_value_2e499 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e499 = (u32)((u64)42UL);
+	t_value_2e499 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e499 = (u32)((u64)42UL);
+	t_value_2e499 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e499 = (u8)((u64)42UL);
+	t_value_2e499 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e499 = (u16)((u64)42UL);
+	t_value_2e499 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e499 = (u32)((u64)42UL);
+	t_value_2e499 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e499 = (u64)((u64)42UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)24UL));
+	t_value_2e500 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e500 = (u32)((u64)42UL);
+	t_value_2e500 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e500 = (u32)((u64)42UL);
+	t_value_2e500 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e500 = (u8)((u64)42UL);
+	t_value_2e500 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e500 = (u16)((u64)42UL);
+	t_value_2e500 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e500 = (u32)((u64)42UL);
+	t_value_2e500 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e500 = (u64)((u64)42UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)48UL));
+	t_value_2e501 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e501 = (u32)((u64)42UL);
+	t_value_2e501 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e501 = (u32)((u64)42UL);
+	t_value_2e501 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e501 = (u8)((u64)42UL);
+	t_value_2e501 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e501 = (u16)((u64)42UL);
+	t_value_2e501 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e501 = (u32)((u64)42UL);
+	t_value_2e501 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e501 = (u64)((u64)42UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)72UL));
+	t_value_2e502 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e502 = (u32)((u64)42UL);
+	t_value_2e502 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e502 = (u32)((u64)42UL);
+	t_value_2e502 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e502 = (u8)((u64)42UL);
+	t_value_2e502 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e502 = (u16)((u64)42UL);
+	t_value_2e502 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e502 = (u32)((u64)42UL);
+	t_value_2e502 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e502 = (u64)((u64)42UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)96UL));
+	t_value_2e503 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e503 = (u32)((u64)42UL);
+	t_value_2e503 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e503 = (u32)((u64)42UL);
+	t_value_2e503 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e503 = (u8)((u64)42UL);
+	t_value_2e503 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e503 = (u16)((u64)42UL);
+	t_value_2e503 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e503 = (u32)((u64)42UL);
+	t_value_2e503 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e503 = (u64)((u64)42UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)120UL));
+	t_value_2e504 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e504 = (u32)((u64)42UL);
+	t_value_2e504 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e504 = (u32)((u64)42UL);
+	t_value_2e504 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e504 = (u8)((u64)42UL);
+	t_value_2e504 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e504 = (u16)((u64)42UL);
+	t_value_2e504 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e504 = (u32)((u64)42UL);
+	t_value_2e504 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e504 = (u64)((u64)42UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)144UL));
+	t_value_2e505 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e505 = (u32)((u64)42UL);
+	t_value_2e505 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e505 = (u32)((u64)42UL);
+	t_value_2e505 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e505 = (u8)((u64)42UL);
+	t_value_2e505 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e505 = (u16)((u64)42UL);
+	t_value_2e505 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e505 = (u32)((u64)42UL);
+	t_value_2e505 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e505 = (u64)((u64)42UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)168UL));
+	t_value_2e506 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e506 = (u32)((u64)42UL);
+	t_value_2e506 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e506 = (u32)((u64)42UL);
+	t_value_2e506 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e506 = (u8)((u64)42UL);
+	t_value_2e506 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e506 = (u16)((u64)42UL);
+	t_value_2e506 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e506 = (u32)((u64)42UL);
+	t_value_2e506 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e506 = (u64)((u64)42UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)192UL));
+	t_value_2e507 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e507 = (u32)((u64)0UL);
+	t_value_2e507 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e507 = (u32)((u64)0UL);
+	t_value_2e507 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e507 = (u8)((u64)0UL);
+	t_value_2e507 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e507 = (u16)((u64)0UL);
+	t_value_2e507 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e507 = (u32)((u64)0UL);
+	t_value_2e507 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e507 = (u64)((u64)0UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)216UL));
+	t_value_2e508 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e508 = (u32)((u64)0UL);
+	t_value_2e508 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e508 = (u32)((u64)0UL);
+	t_value_2e508 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e508 = (u8)((u64)0UL);
+	t_value_2e508 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e508 = (u16)((u64)0UL);
+	t_value_2e508 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e508 = (u32)((u64)0UL);
+	t_value_2e508 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e508 = (u64)((u64)0UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)240UL));
+	t_value_2e509 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e509 = (u32)((u64)0UL);
+	t_value_2e509 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e509 = (u32)((u64)0UL);
+	t_value_2e509 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e509 = (u8)((u64)0UL);
+	t_value_2e509 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e509 = (u16)((u64)0UL);
+	t_value_2e509 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e509 = (u32)((u64)0UL);
+	t_value_2e509 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e509 = (u64)((u64)0UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)264UL));
+	t_value_2e510 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e510 = (u32)((u64)0UL);
+	t_value_2e510 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e510 = (u32)((u64)0UL);
+	t_value_2e510 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e510 = (u8)((u64)0UL);
+	t_value_2e510 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e510 = (u16)((u64)0UL);
+	t_value_2e510 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e510 = (u32)((u64)0UL);
+	t_value_2e510 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e510 = (u64)((u64)0UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)288UL));
+	t_value_2e511 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e511 = (u32)((u64)1UL);
+	t_value_2e511 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e511 = (u32)((u64)1UL);
+	t_value_2e511 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e511 = (u8)((u64)1UL);
+	t_value_2e511 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e511 = (u16)((u64)1UL);
+	t_value_2e511 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e511 = (u32)((u64)1UL);
+	t_value_2e511 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e511 = (u64)((u64)1UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)312UL));
+	t_value_2e512 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e512 = (u32)((u64)1UL);
+	t_value_2e512 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e512 = (u32)((u64)1UL);
+	t_value_2e512 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e512 = (u8)((u64)1UL);
+	t_value_2e512 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e512 = (u16)((u64)1UL);
+	t_value_2e512 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e512 = (u32)((u64)1UL);
+	t_value_2e512 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e512 = (u64)((u64)1UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)336UL));
+	t_value_2e513 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e513 = (u32)((u64)1UL);
+	t_value_2e513 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e513 = (u32)((u64)1UL);
+	t_value_2e513 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e513 = (u8)((u64)1UL);
+	t_value_2e513 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e513 = (u16)((u64)1UL);
+	t_value_2e513 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e513 = (u32)((u64)1UL);
+	t_value_2e513 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e513 = (u64)((u64)1UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)360UL));
+	t_value_2e514 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e514 = (u32)((u64)1UL);
+	t_value_2e514 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e514 = (u32)((u64)1UL);
+	t_value_2e514 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e514 = (u8)((u64)1UL);
+	t_value_2e514 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e514 = (u16)((u64)1UL);
+	t_value_2e514 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e514 = (u32)((u64)1UL);
+	t_value_2e514 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e514 = (u64)((u64)1UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)384UL));
+	t_value_2e515 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e515 = (u32)((u64)0UL);
+	t_value_2e515 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e515 = (u32)((u64)0UL);
+	t_value_2e515 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e515 = (u8)((u64)0UL);
+	t_value_2e515 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e515 = (u16)((u64)0UL);
+	t_value_2e515 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e515 = (u32)((u64)0UL);
+	t_value_2e515 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e515 = (u64)((u64)0UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)408UL));
+	t_value_2e516 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e516 = (u32)((u64)0UL);
+	t_value_2e516 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e516 = (u32)((u64)0UL);
+	t_value_2e516 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e516 = (u8)((u64)0UL);
+	t_value_2e516 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e516 = (u16)((u64)0UL);
+	t_value_2e516 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e516 = (u32)((u64)0UL);
+	t_value_2e516 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e516 = (u64)((u64)0UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)432UL));
+	t_value_2e517 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e517 = (u32)((u64)0UL);
+	t_value_2e517 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e517 = (u32)((u64)0UL);
+	t_value_2e517 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e517 = (u8)((u64)0UL);
+	t_value_2e517 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e517 = (u16)((u64)0UL);
+	t_value_2e517 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e517 = (u32)((u64)0UL);
+	t_value_2e517 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e517 = (u64)((u64)0UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)456UL));
+	t_value_2e518 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e518 = (u32)((u64)1UL);
+	t_value_2e518 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e518 = (u32)((u64)1UL);
+	t_value_2e518 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e518 = (u8)((u64)1UL);
+	t_value_2e518 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e518 = (u16)((u64)1UL);
+	t_value_2e518 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e518 = (u32)((u64)1UL);
+	t_value_2e518 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e518 = (u64)((u64)1UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)480UL));
+	t_value_2e519 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e519 = (u32)((u64)1UL);
+	t_value_2e519 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e519 = (u32)((u64)1UL);
+	t_value_2e519 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e519 = (u8)((u64)1UL);
+	t_value_2e519 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e519 = (u16)((u64)1UL);
+	t_value_2e519 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e519 = (u32)((u64)1UL);
+	t_value_2e519 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e519 = (u64)((u64)1UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)504UL));
+	t_value_2e520 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e520 = (u32)((u64)1UL);
+	t_value_2e520 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e520 = (u32)((u64)1UL);
+	t_value_2e520 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e520 = (u8)((u64)1UL);
+	t_value_2e520 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e520 = (u16)((u64)1UL);
+	t_value_2e520 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e520 = (u32)((u64)1UL);
+	t_value_2e520 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e520 = (u64)((u64)1UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)528UL));
+	t_value_2e521 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e521 = (u32)((u64)100UL);
+	t_value_2e521 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e521 = (u32)((u64)100UL);
+	t_value_2e521 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e521 = (u8)((u64)100UL);
+	t_value_2e521 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e521 = (u16)((u64)100UL);
+	t_value_2e521 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e521 = (u32)((u64)100UL);
+	t_value_2e521 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e521 = (u64)((u64)100UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)552UL));
+	t_value_2e522 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e522 = (u32)((u64)100UL);
+	t_value_2e522 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e522 = (u32)((u64)100UL);
+	t_value_2e522 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e522 = (u8)((u64)100UL);
+	t_value_2e522 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e522 = (u16)((u64)100UL);
+	t_value_2e522 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e522 = (u32)((u64)100UL);
+	t_value_2e522 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e522 = (u64)((u64)100UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)576UL));
+	t_value_2e523 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e523 = (u32)((u64)100UL);
+	t_value_2e523 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e523 = (u32)((u64)100UL);
+	t_value_2e523 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e523 = (u8)((u64)100UL);
+	t_value_2e523 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e523 = (u16)((u64)100UL);
+	t_value_2e523 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e523 = (u32)((u64)100UL);
+	t_value_2e523 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e523 = (u64)((u64)100UL);
+	t_item_2e498 = (u64)((u64)t_binding_2e495 + (u64)((u64)600UL));
+	t_value_2e524 = (u64)((u64)t_item_2e498 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e524 = (u32)((u64)100UL);
+	t_value_2e524 = (u64)((u64)t_item_2e498 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e524 = (u32)((u64)100UL);
+	t_value_2e524 = (u64)((u64)t_item_2e498 + (u64)((u64)8UL));
+	*(u8 *)t_value_2e524 = (u8)((u64)100UL);
+	t_value_2e524 = (u64)((u64)t_item_2e498 + (u64)((u64)10UL));
+	*(u16 *)t_value_2e524 = (u16)((u64)100UL);
+	t_value_2e524 = (u64)((u64)t_item_2e498 + (u64)((u64)12UL));
+	*(u32 *)t_value_2e524 = (u32)((u64)100UL);
+	t_value_2e524 = (u64)((u64)t_item_2e498 + (u64)((u64)16UL));
+	*(u64 *)t_value_2e524 = (u64)((u64)100UL);
+	*(u64 *)t_binding_2e530 = (u64)((u64)0UL);
+	L_loop_2e525:;
+	t__2e532 = (u64)(*(u64 *)t_binding_2e530);
+	t__2e531 = (u64)(u32)(((u64)t__2e532 < (u64)((u64)26UL)));
+	if ((u32)t__2e531) goto L_body_2e526; else goto L__2e528;
+	L_body_2e526:;
+	t__2e537 = (u64)(*(u64 *)t_binding_2e530);
+	t__2e536 = (u64)((u64)t__2e537 * (u64)((u64)24UL));
+	t__2e536 = (u64)((u64)t_binding_2e495 + (u64)t__2e536);
+	*(u64 *)t_binding_2e535 = (u64)t__2e536;
+	t__2e557 = (u64)(*(u64 *)t_binding_2e530);
+	t__2e556 = (u64)((u64)t__2e557 * (u64)((u64)8UL));
+	t__2e556 = (u64)((u64)t_binding_2e492 + (u64)t__2e556);
+	t__2e558 = (u64)(*(u64 *)t__2e556);
+	t__2e559 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e560 = (u64)((u64)t__2e559 + (u64)((u64)0UL));
+	t__2e561 = (u64)(u32)(*(i32 *)t_value_2e560);
+	t__2e562 = (u64)((i64)(i32)t__2e561);
+	t__2e555 = (u64)(u32)(((u64)t__2e558 == (u64)t__2e562));
+	t__2e552 = (u64)(u32)t__2e555;
+	if ((u32)t__2e552) goto L__2e553; else goto L__2e554;
+	L__2e553:;
+	t__2e564 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e565 = (u64)((u64)t__2e564 + (u64)((u64)0UL));
+	t__2e566 = (u64)(u32)(*(i32 *)t_value_2e565);
+	t__2e567 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e568 = (u64)((u64)t__2e567 + (u64)((u64)4UL));
+	t__2e569 = (u64)(u32)(*(i32 *)t_value_2e568);
+	t__2e563 = (u64)(u32)(((u32)t__2e566 == (u32)t__2e569));
+	t__2e552 = (u64)(u32)t__2e563;
+	goto L__2e554;
+	L__2e554:;
+	t__2e549 = (u64)(u32)t__2e552;
+	if ((u32)t__2e549) goto L__2e550; else goto L__2e551;
+	L__2e550:;
+	t__2e571 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e572 = (u64)((u64)t__2e571 + (u64)((u64)4UL));
+	t__2e573 = (u64)(u32)(*(i32 *)t_value_2e572);
+	t__2e574 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e575 = (u64)((u64)t__2e574 + (u64)((u64)8UL));
+	t__2e576 = (u64)(u32)(*(i8 *)t_value_2e575);
+	t__2e577 = (u64)(u32)((i64)(i8)t__2e576);
+	t__2e570 = (u64)(u32)(((u32)t__2e573 == (u32)t__2e577));
+	t__2e549 = (u64)(u32)t__2e570;
+	goto L__2e551;
+	L__2e551:;
+	t__2e546 = (u64)(u32)t__2e549;
+	if ((u32)t__2e546) goto L__2e547; else goto L__2e548;
+	L__2e547:;
+	t__2e579 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e580 = (u64)((u64)t__2e579 + (u64)((u64)8UL));
+	t__2e581 = (u64)(u32)(*(i8 *)t_value_2e580);
+	t__2e582 = (u64)(u32)((i64)(i8)t__2e581);
+	t__2e583 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e584 = (u64)((u64)t__2e583 + (u64)((u64)10UL));
+	t__2e585 = (u64)(u32)(*(i16 *)t_value_2e584);
+	t__2e586 = (u64)(u32)((i64)(i16)t__2e582);
+	t__2e587 = (u64)(u32)((i64)(i16)t__2e585);
+	t__2e578 = (u64)(u32)(((u32)t__2e586 == (u32)t__2e587));
+	t__2e546 = (u64)(u32)t__2e578;
+	goto L__2e548;
+	L__2e548:;
+	t__2e543 = (u64)(u32)t__2e546;
+	if ((u32)t__2e543) goto L__2e544; else goto L__2e545;
+	L__2e544:;
+	t__2e589 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e590 = (u64)((u64)t__2e589 + (u64)((u64)10UL));
+	t__2e591 = (u64)(u32)(*(i16 *)t_value_2e590);
+	t__2e592 = (u64)(u32)((i64)(i16)t__2e591);
+	t__2e593 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e594 = (u64)((u64)t__2e593 + (u64)((u64)12UL));
+	t__2e595 = (u64)(u32)(*(i32 *)t_value_2e594);
+	t__2e588 = (u64)(u32)(((u32)t__2e592 == (u32)t__2e595));
+	t__2e543 = (u64)(u32)t__2e588;
+	goto L__2e545;
+	L__2e545:;
+	t__2e540 = (u64)(u32)t__2e543;
+	if ((u32)t__2e540) goto L__2e541; else goto L__2e542;
+	L__2e541:;
+	t__2e597 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e598 = (u64)((u64)t__2e597 + (u64)((u64)12UL));
+	t__2e599 = (u64)(u32)(*(i32 *)t_value_2e598);
+	t__2e600 = (u64)((i64)(i32)t__2e599);
+	t__2e601 = (u64)(*(u64 *)t_binding_2e535);
+	t_value_2e602 = (u64)((u64)t__2e601 + (u64)((u64)16UL));
+	t__2e603 = (u64)(*(u64 *)t_value_2e602);
+	t__2e596 = (u64)(u32)(((u64)t__2e600 == (u64)t__2e603));
+	t__2e540 = (u64)(u32)t__2e596;
+	goto L__2e542;
+	L__2e542:;
+	if ((u32)t__2e540) goto L_passed_2e539; else goto L_failed_2e538;
+	L_failed_2e538:;
+	t_abortsite_2e605 = ((u64)0UL);
+	goto L_abort_2e606;
+	L_passed_2e539:;
+	goto L__2e533;
+	L__2e612:;
+	L__2e533:;
+	L_after_2e529:;
+	t__2e613 = (u64)(*(u64 *)t_binding_2e530);
+	t__2e613 = (u64)((u64)t__2e613 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e530 = (u64)t__2e613;
+	goto L_loop_2e525;
+	L__2e528:;
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)0UL));
+	t_value_2e618 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e618 = (u64)((u64)42UL);
+	t_value_2e618 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e618 = (u32)((u64)42UL);
+	t_value_2e618 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e618 = (u8)((u64)42UL);
+	t_value_2e618 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e618 = (u16)((u64)42UL);
+	t_value_2e618 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e618 = (u32)((u64)42UL);
+	t_value_2e618 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e618 = (u64)((u64)42UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)32UL));
+	t_value_2e619 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e619 = (u64)((u64)42UL);
+	t_value_2e619 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e619 = (u32)((u64)42UL);
+	t_value_2e619 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e619 = (u8)((u64)42UL);
+	t_value_2e619 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e619 = (u16)((u64)42UL);
+	t_value_2e619 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e619 = (u32)((u64)42UL);
+	t_value_2e619 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e619 = (u64)((u64)42UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)64UL));
+	t_value_2e620 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e620 = (u64)((u64)42UL);
+	t_value_2e620 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e620 = (u32)((u64)42UL);
+	t_value_2e620 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e620 = (u8)((u64)42UL);
+	t_value_2e620 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e620 = (u16)((u64)42UL);
+	t_value_2e620 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e620 = (u32)((u64)42UL);
+	t_value_2e620 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e620 = (u64)((u64)42UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)96UL));
+	t_value_2e621 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e621 = (u64)((u64)42UL);
+	t_value_2e621 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e621 = (u32)((u64)42UL);
+	t_value_2e621 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e621 = (u8)((u64)42UL);
+	t_value_2e621 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e621 = (u16)((u64)42UL);
+	t_value_2e621 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e621 = (u32)((u64)42UL);
+	t_value_2e621 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e621 = (u64)((u64)42UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)128UL));
+	t_value_2e622 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e622 = (u64)((u64)42UL);
+	t_value_2e622 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e622 = (u32)((u64)42UL);
+	t_value_2e622 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e622 = (u8)((u64)42UL);
+	t_value_2e622 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e622 = (u16)((u64)42UL);
+	t_value_2e622 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e622 = (u32)((u64)42UL);
+	t_value_2e622 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e622 = (u64)((u64)42UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)160UL));
+	t_value_2e623 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e623 = (u64)((u64)42UL);
+	t_value_2e623 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e623 = (u32)((u64)42UL);
+	t_value_2e623 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e623 = (u8)((u64)42UL);
+	t_value_2e623 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e623 = (u16)((u64)42UL);
+	t_value_2e623 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e623 = (u32)((u64)42UL);
+	t_value_2e623 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e623 = (u64)((u64)42UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)192UL));
+	t_value_2e624 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e624 = (u64)((u64)42UL);
+	t_value_2e624 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e624 = (u32)((u64)42UL);
+	t_value_2e624 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e624 = (u8)((u64)42UL);
+	t_value_2e624 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e624 = (u16)((u64)42UL);
+	t_value_2e624 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e624 = (u32)((u64)42UL);
+	t_value_2e624 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e624 = (u64)((u64)42UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)224UL));
+	t_value_2e625 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e625 = (u64)((u64)42UL);
+	t_value_2e625 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e625 = (u32)((u64)42UL);
+	t_value_2e625 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e625 = (u8)((u64)42UL);
+	t_value_2e625 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e625 = (u16)((u64)42UL);
+	t_value_2e625 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e625 = (u32)((u64)42UL);
+	t_value_2e625 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e625 = (u64)((u64)42UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)256UL));
+	t_value_2e626 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e626 = (u64)((u64)0UL);
+	t_value_2e626 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e626 = (u32)((u64)0UL);
+	t_value_2e626 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e626 = (u8)((u64)0UL);
+	t_value_2e626 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e626 = (u16)((u64)0UL);
+	t_value_2e626 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e626 = (u32)((u64)0UL);
+	t_value_2e626 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e626 = (u64)((u64)0UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)288UL));
+	t_value_2e627 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e627 = (u64)((u64)0UL);
+	t_value_2e627 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e627 = (u32)((u64)0UL);
+	t_value_2e627 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e627 = (u8)((u64)0UL);
+	t_value_2e627 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e627 = (u16)((u64)0UL);
+	t_value_2e627 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e627 = (u32)((u64)0UL);
+	t_value_2e627 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e627 = (u64)((u64)0UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)320UL));
+	t_value_2e628 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e628 = (u64)((u64)0UL);
+	t_value_2e628 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e628 = (u32)((u64)0UL);
+	t_value_2e628 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e628 = (u8)((u64)0UL);
+	t_value_2e628 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e628 = (u16)((u64)0UL);
+	t_value_2e628 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e628 = (u32)((u64)0UL);
+	t_value_2e628 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e628 = (u64)((u64)0UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)352UL));
+	t_value_2e629 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e629 = (u64)((u64)0UL);
+	t_value_2e629 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e629 = (u32)((u64)0UL);
+	t_value_2e629 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e629 = (u8)((u64)0UL);
+	t_value_2e629 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e629 = (u16)((u64)0UL);
+	t_value_2e629 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e629 = (u32)((u64)0UL);
+	t_value_2e629 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e629 = (u64)((u64)0UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)384UL));
+	t_value_2e630 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e630 = (u64)((u64)1UL);
+	t_value_2e630 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e630 = (u32)((u64)1UL);
+	t_value_2e630 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e630 = (u8)((u64)1UL);
+	t_value_2e630 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e630 = (u16)((u64)1UL);
+	t_value_2e630 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e630 = (u32)((u64)1UL);
+	t_value_2e630 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e630 = (u64)((u64)1UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)416UL));
+	t_value_2e631 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e631 = (u64)((u64)1UL);
+	t_value_2e631 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e631 = (u32)((u64)1UL);
+	t_value_2e631 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e631 = (u8)((u64)1UL);
+	t_value_2e631 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e631 = (u16)((u64)1UL);
+	t_value_2e631 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e631 = (u32)((u64)1UL);
+	t_value_2e631 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e631 = (u64)((u64)1UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)448UL));
+	t_value_2e632 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e632 = (u64)((u64)1UL);
+	t_value_2e632 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e632 = (u32)((u64)1UL);
+	t_value_2e632 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e632 = (u8)((u64)1UL);
+	t_value_2e632 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e632 = (u16)((u64)1UL);
+	t_value_2e632 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e632 = (u32)((u64)1UL);
+	t_value_2e632 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e632 = (u64)((u64)1UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)480UL));
+	t_value_2e633 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e633 = (u64)((u64)1UL);
+	t_value_2e633 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e633 = (u32)((u64)1UL);
+	t_value_2e633 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e633 = (u8)((u64)1UL);
+	t_value_2e633 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e633 = (u16)((u64)1UL);
+	t_value_2e633 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e633 = (u32)((u64)1UL);
+	t_value_2e633 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e633 = (u64)((u64)1UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)512UL));
+	t_value_2e634 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e634 = (u64)((u64)0UL);
+	t_value_2e634 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e634 = (u32)((u64)0UL);
+	t_value_2e634 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e634 = (u8)((u64)0UL);
+	t_value_2e634 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e634 = (u16)((u64)0UL);
+	t_value_2e634 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e634 = (u32)((u64)0UL);
+	t_value_2e634 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e634 = (u64)((u64)0UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)544UL));
+	t_value_2e635 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e635 = (u64)((u64)0UL);
+	t_value_2e635 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e635 = (u32)((u64)0UL);
+	t_value_2e635 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e635 = (u8)((u64)0UL);
+	t_value_2e635 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e635 = (u16)((u64)0UL);
+	t_value_2e635 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e635 = (u32)((u64)0UL);
+	t_value_2e635 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e635 = (u64)((u64)0UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)576UL));
+	t_value_2e636 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e636 = (u64)((u64)0UL);
+	t_value_2e636 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e636 = (u32)((u64)0UL);
+	t_value_2e636 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e636 = (u8)((u64)0UL);
+	t_value_2e636 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e636 = (u16)((u64)0UL);
+	t_value_2e636 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e636 = (u32)((u64)0UL);
+	t_value_2e636 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e636 = (u64)((u64)0UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)608UL));
+	t_value_2e637 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e637 = (u64)((u64)1UL);
+	t_value_2e637 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e637 = (u32)((u64)1UL);
+	t_value_2e637 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e637 = (u8)((u64)1UL);
+	t_value_2e637 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e637 = (u16)((u64)1UL);
+	t_value_2e637 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e637 = (u32)((u64)1UL);
+	t_value_2e637 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e637 = (u64)((u64)1UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)640UL));
+	t_value_2e638 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e638 = (u64)((u64)1UL);
+	t_value_2e638 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e638 = (u32)((u64)1UL);
+	t_value_2e638 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e638 = (u8)((u64)1UL);
+	t_value_2e638 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e638 = (u16)((u64)1UL);
+	t_value_2e638 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e638 = (u32)((u64)1UL);
+	t_value_2e638 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e638 = (u64)((u64)1UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)672UL));
+	t_value_2e639 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e639 = (u64)((u64)1UL);
+	t_value_2e639 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e639 = (u32)((u64)1UL);
+	t_value_2e639 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e639 = (u8)((u64)1UL);
+	t_value_2e639 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e639 = (u16)((u64)1UL);
+	t_value_2e639 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e639 = (u32)((u64)1UL);
+	t_value_2e639 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e639 = (u64)((u64)1UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)704UL));
+	t_value_2e640 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e640 = (u64)((u64)100UL);
+	t_value_2e640 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e640 = (u32)((u64)100UL);
+	t_value_2e640 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e640 = (u8)((u64)100UL);
+	t_value_2e640 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e640 = (u16)((u64)100UL);
+	t_value_2e640 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e640 = (u32)((u64)100UL);
+	t_value_2e640 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e640 = (u64)((u64)100UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)736UL));
+	t_value_2e641 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e641 = (u64)((u64)100UL);
+	t_value_2e641 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e641 = (u32)((u64)100UL);
+	t_value_2e641 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e641 = (u8)((u64)100UL);
+	t_value_2e641 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e641 = (u16)((u64)100UL);
+	t_value_2e641 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e641 = (u32)((u64)100UL);
+	t_value_2e641 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e641 = (u64)((u64)100UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)768UL));
+	t_value_2e642 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e642 = (u64)((u64)100UL);
+	t_value_2e642 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e642 = (u32)((u64)100UL);
+	t_value_2e642 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e642 = (u8)((u64)100UL);
+	t_value_2e642 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e642 = (u16)((u64)100UL);
+	t_value_2e642 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e642 = (u32)((u64)100UL);
+	t_value_2e642 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e642 = (u64)((u64)100UL);
+	t_item_2e617 = (u64)((u64)t_binding_2e614 + (u64)((u64)800UL));
+	t_value_2e643 = (u64)((u64)t_item_2e617 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e643 = (u64)((u64)100UL);
+	t_value_2e643 = (u64)((u64)t_item_2e617 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e643 = (u32)((u64)100UL);
+	t_value_2e643 = (u64)((u64)t_item_2e617 + (u64)((u64)12UL));
+	*(u8 *)t_value_2e643 = (u8)((u64)100UL);
+	t_value_2e643 = (u64)((u64)t_item_2e617 + (u64)((u64)14UL));
+	*(u16 *)t_value_2e643 = (u16)((u64)100UL);
+	t_value_2e643 = (u64)((u64)t_item_2e617 + (u64)((u64)16UL));
+	*(u32 *)t_value_2e643 = (u32)((u64)100UL);
+	t_value_2e643 = (u64)((u64)t_item_2e617 + (u64)((u64)24UL));
+	*(u64 *)t_value_2e643 = (u64)((u64)100UL);
+	*(u64 *)t_binding_2e649 = (u64)((u64)0UL);
+	L_loop_2e644:;
+	t__2e651 = (u64)(*(u64 *)t_binding_2e649);
+	t__2e650 = (u64)(u32)(((u64)t__2e651 < (u64)((u64)26UL)));
+	if ((u32)t__2e650) goto L_body_2e645; else goto L__2e647;
+	L_body_2e645:;
+	t__2e656 = (u64)(*(u64 *)t_binding_2e649);
+	t__2e655 = (u64)((u64)t__2e656 * (u64)((u64)32UL));
+	t__2e655 = (u64)((u64)t_binding_2e614 + (u64)t__2e655);
+	*(u64 *)t_binding_2e654 = (u64)t__2e655;
+	t__2e676 = (u64)(*(u64 *)t_binding_2e649);
+	t__2e675 = (u64)((u64)t__2e676 * (u64)((u64)8UL));
+	t__2e675 = (u64)((u64)t_binding_2e492 + (u64)t__2e675);
+	t__2e677 = (u64)(*(u64 *)t__2e675);
+	t__2e678 = t__2e677;
+	t__2e679 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e680 = (u64)((u64)t__2e679 + (u64)((u64)0UL));
+	t__2e681 = (u64)(*(u64 *)t_value_2e680);
+	t__2e682 = t__2e681;
+	t__2e674 = (u64)(u32)(((u64)t__2e678 == (u64)t__2e682));
+	t__2e671 = (u64)(u32)t__2e674;
+	if ((u32)t__2e671) goto L__2e672; else goto L__2e673;
+	L__2e672:;
+	t__2e684 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e685 = (u64)((u64)t__2e684 + (u64)((u64)0UL));
+	t__2e686 = (u64)(*(u64 *)t_value_2e685);
+	t__2e687 = t__2e686;
+	t__2e688 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e689 = (u64)((u64)t__2e688 + (u64)((u64)8UL));
+	t__2e690 = (u64)(u32)(*(u32 *)t_value_2e689);
+	t__2e691 = (u64)((u32)t__2e690);
+	t__2e683 = (u64)(u32)(((u64)t__2e687 == (u64)t__2e691));
+	t__2e671 = (u64)(u32)t__2e683;
+	goto L__2e673;
+	L__2e673:;
+	t__2e668 = (u64)(u32)t__2e671;
+	if ((u32)t__2e668) goto L__2e669; else goto L__2e670;
+	L__2e669:;
+	t__2e693 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e694 = (u64)((u64)t__2e693 + (u64)((u64)8UL));
+	t__2e695 = (u64)(u32)(*(u32 *)t_value_2e694);
+	t__2e696 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e697 = (u64)((u64)t__2e696 + (u64)((u64)12UL));
+	t__2e698 = (u64)(u32)(*(u8 *)t_value_2e697);
+	t__2e699 = (u64)(u32)((u8)t__2e698);
+	t__2e692 = (u64)(u32)(((u32)t__2e695 == (u32)t__2e699));
+	t__2e668 = (u64)(u32)t__2e692;
+	goto L__2e670;
+	L__2e670:;
+	t__2e665 = (u64)(u32)t__2e668;
+	if ((u32)t__2e665) goto L__2e666; else goto L__2e667;
+	L__2e666:;
+	t__2e701 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e702 = (u64)((u64)t__2e701 + (u64)((u64)12UL));
+	t__2e703 = (u64)(u32)(*(u8 *)t_value_2e702);
+	t__2e704 = (u64)(u32)((u8)t__2e703);
+	t__2e705 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e706 = (u64)((u64)t__2e705 + (u64)((u64)14UL));
+	t__2e707 = (u64)(u32)(*(u16 *)t_value_2e706);
+	t__2e708 = (u64)(u32)((u16)t__2e704);
+	t__2e709 = (u64)(u32)((u16)t__2e707);
+	t__2e700 = (u64)(u32)(((u32)t__2e708 == (u32)t__2e709));
+	t__2e665 = (u64)(u32)t__2e700;
+	goto L__2e667;
+	L__2e667:;
+	t__2e662 = (u64)(u32)t__2e665;
+	if ((u32)t__2e662) goto L__2e663; else goto L__2e664;
+	L__2e663:;
+	t__2e711 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e712 = (u64)((u64)t__2e711 + (u64)((u64)14UL));
+	t__2e713 = (u64)(u32)(*(u16 *)t_value_2e712);
+	t__2e714 = (u64)(u32)((u16)t__2e713);
+	t__2e715 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e716 = (u64)((u64)t__2e715 + (u64)((u64)16UL));
+	t__2e717 = (u64)(u32)(*(u32 *)t_value_2e716);
+	t__2e710 = (u64)(u32)(((u32)t__2e714 == (u32)t__2e717));
+	t__2e662 = (u64)(u32)t__2e710;
+	goto L__2e664;
+	L__2e664:;
+	t__2e659 = (u64)(u32)t__2e662;
+	if ((u32)t__2e659) goto L__2e660; else goto L__2e661;
+	L__2e660:;
+	t__2e719 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e720 = (u64)((u64)t__2e719 + (u64)((u64)16UL));
+	t__2e721 = (u64)(u32)(*(u32 *)t_value_2e720);
+	t__2e722 = (u64)((u32)t__2e721);
+	t__2e723 = (u64)(*(u64 *)t_binding_2e654);
+	t_value_2e724 = (u64)((u64)t__2e723 + (u64)((u64)24UL));
+	t__2e725 = (u64)(*(u64 *)t_value_2e724);
+	t__2e718 = (u64)(u32)(((u64)t__2e722 == (u64)t__2e725));
+	t__2e659 = (u64)(u32)t__2e718;
+	goto L__2e661;
+	L__2e661:;
+	if ((u32)t__2e659) goto L_passed_2e658; else goto L_failed_2e657;
+	L_failed_2e657:;
+	t_abortsite_2e605 = ((u64)1UL);
+	goto L_abort_2e606;
+	L_passed_2e658:;
+	goto L__2e652;
+	L__2e726:;
+	L__2e652:;
+	L_after_2e648:;
+	t__2e727 = (u64)(*(u64 *)t_binding_2e649);
+	t__2e727 = (u64)((u64)t__2e727 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e649 = (u64)t__2e727;
+	goto L_loop_2e644;
+	L__2e647:;
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)8UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)16UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)24UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)32UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)40UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)48UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)56UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)64UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)72UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)80UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)88UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)96UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)104UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)112UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)120UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)128UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)136UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)144UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)152UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)160UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)168UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)176UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)184UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)192UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)200UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)208UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)216UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)224UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)232UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)240UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)248UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)256UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)264UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)272UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)280UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)288UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	t_item_2e730 = (u64)((u64)t_binding_2e728 + (u64)((u64)296UL));
+	*(u64 *)t_item_2e730 = (u64)((u64)0UL);
+	*(u64 *)t_binding_2e736 = (u64)((u64)0UL);
+	L_loop_2e731:;
+	t__2e738 = (u64)(*(u64 *)t_binding_2e736);
+	t__2e737 = (u64)(u32)(((u64)t__2e738 < (u64)((u64)38UL)));
+	if ((u32)t__2e737) goto L_body_2e732; else goto L__2e734;
+	L_body_2e732:;
+	t__2e745 = (u64)(*(u64 *)t_binding_2e736);
+	t__2e744 = (u64)((u64)t__2e745 * (u64)((u64)8UL));
+	t__2e744 = (u64)((u64)t_binding_2e728 + (u64)t__2e744);
+	t__2e746 = (u64)(*(u64 *)t__2e744);
+	t__2e743 = (u64)(u32)((BD(t__2e746) == BD(((u64)0UL))));
+	if ((u32)t__2e743) goto L_passed_2e742; else goto L_failed_2e741;
+	L_failed_2e741:;
+	t_abortsite_2e605 = ((u64)2UL);
+	goto L_abort_2e606;
+	L_passed_2e742:;
+	goto L__2e739;
+	L__2e747:;
+	L__2e739:;
+	L_after_2e735:;
+	t__2e748 = (u64)(*(u64 *)t_binding_2e736);
+	t__2e748 = (u64)((u64)t__2e748 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e736 = (u64)t__2e748;
+	goto L_loop_2e731;
+	L__2e734:;
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)20UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)24UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)28UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)32UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)36UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)40UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)44UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)48UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)52UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)56UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)60UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)64UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)68UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)72UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)76UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)80UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)84UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)88UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)92UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)96UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)100UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)104UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)108UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)112UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)116UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)120UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)124UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)128UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)132UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)136UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)140UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)144UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)148UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)152UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)156UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)160UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)164UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)168UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)172UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)176UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)180UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)184UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)188UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)192UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)196UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)200UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)204UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)208UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)212UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	t_item_2e751 = (u64)((u64)t_binding_2e749 + (u64)((u64)216UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)0UL);
+	*(u64 *)t_binding_2e757 = (u64)((u64)0UL);
+	L_loop_2e752:;
+	t__2e759 = (u64)(*(u64 *)t_binding_2e757);
+	t__2e758 = (u64)(u32)(((u64)t__2e759 < (u64)((u64)55UL)));
+	if ((u32)t__2e758) goto L_body_2e753; else goto L__2e755;
+	L_body_2e753:;
+	t__2e766 = (u64)(*(u64 *)t_binding_2e757);
+	t__2e765 = (u64)((u64)t__2e766 * (u64)((u64)4UL));
+	t__2e765 = (u64)((u64)t_binding_2e749 + (u64)t__2e765);
+	t__2e767 = (u64)(*(u32 *)t__2e765);
+	t__2e764 = (u64)(u32)((BF(t__2e767) == BF(((u64)0UL))));
+	if ((u32)t__2e764) goto L_passed_2e763; else goto L_failed_2e762;
+	L_failed_2e762:;
+	t_abortsite_2e605 = ((u64)3UL);
+	goto L_abort_2e606;
+	L_passed_2e763:;
+	goto L__2e760;
+	L__2e768:;
+	L__2e760:;
+	L_after_2e756:;
+	t__2e769 = (u64)(*(u64 *)t_binding_2e757);
+	t__2e769 = (u64)((u64)t__2e769 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e757 = (u64)t__2e769;
+	goto L_loop_2e752;
+	L__2e755:;
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)8UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)16UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)24UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)32UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)40UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)48UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)56UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)64UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)72UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)80UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)88UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)96UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)104UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)112UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)120UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)128UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)136UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)144UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)152UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)160UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)168UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)176UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)184UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)192UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)200UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)208UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)216UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)224UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)232UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)240UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)248UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)256UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)264UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)272UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)280UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)288UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)296UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)304UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)312UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)320UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)328UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)336UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)344UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)352UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)360UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)368UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)376UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)384UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)392UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)400UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)408UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)416UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)424UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	t_item_2e772 = (u64)((u64)t_binding_2e770 + (u64)((u64)432UL));
+	*(u64 *)t_item_2e772 = (u64)((u64)0UL);
+	*(u64 *)t_binding_2e778 = (u64)((u64)0UL);
+	L_loop_2e773:;
+	t__2e780 = (u64)(*(u64 *)t_binding_2e778);
+	t__2e779 = (u64)(u32)(((u64)t__2e780 < (u64)((u64)55UL)));
+	if ((u32)t__2e779) goto L_body_2e774; else goto L__2e776;
+	L_body_2e774:;
+	t__2e787 = (u64)(*(u64 *)t_binding_2e778);
+	t__2e786 = (u64)((u64)t__2e787 * (u64)((u64)8UL));
+	t__2e786 = (u64)((u64)t_binding_2e770 + (u64)t__2e786);
+	t__2e788 = (u64)(*(u64 *)t__2e786);
+	t__2e785 = (u64)(u32)((BD(t__2e788) == BD(((u64)0UL))));
+	if ((u32)t__2e785) goto L_passed_2e784; else goto L_failed_2e783;
+	L_failed_2e783:;
+	t_abortsite_2e605 = ((u64)4UL);
+	goto L_abort_2e606;
+	L_passed_2e784:;
+	goto L__2e781;
+	L__2e789:;
+	L__2e781:;
+	L_after_2e777:;
+	t__2e790 = (u64)(*(u64 *)t_binding_2e778);
+	t__2e790 = (u64)((u64)t__2e790 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e778 = (u64)t__2e790;
+	goto L_loop_2e773;
+	L__2e776:;
+	t__2e793 = (u64)(u32)((BD(((u64)0UL)) == BD(((u64)0UL))));
+	if ((u32)t__2e793) goto L_passed_2e792; else goto L_failed_2e791;
+	L_failed_2e791:;
+	t_abortsite_2e605 = ((u64)5UL);
+	goto L_abort_2e606;
+	L_passed_2e792:;
+	t__2e796 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e796) goto L_passed_2e795; else goto L_failed_2e794;
+	L_failed_2e794:;
+	t_abortsite_2e605 = ((u64)6UL);
+	goto L_abort_2e606;
+	L_passed_2e795:;
+	t_value_2e800 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e801 = (u64)((u64)t_value_2e800 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e801 = (u32)((u64)97UL);
+	t_value_2e801 = (u64)((u64)t_value_2e800 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e801 = (u32)((u64)98UL);
+	t_value_2e800 = (u64)((u64)t_binding_2e797 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e800 = (u32)((u64)99UL);
+	t_value_2e805 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e806 = (u64)((u64)t_value_2e805 + (u64)((u64)0UL));
+	t__2e807 = (u64)(u32)(*(u32 *)t_value_2e806);
+	t__2e804 = (u64)(u32)(((u32)t__2e807 == (u32)((u64)97UL)));
+	if ((u32)t__2e804) goto L_passed_2e803; else goto L_failed_2e802;
+	L_failed_2e802:;
+	t_abortsite_2e605 = ((u64)7UL);
+	goto L_abort_2e606;
+	L_passed_2e803:;
+	t_value_2e811 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e812 = (u64)((u64)t_value_2e811 + (u64)((u64)0UL));
+	t__2e813 = (u64)(u32)(*(u32 *)t_value_2e812);
+	t__2e810 = (u64)(u32)(((u32)t__2e813 == (u32)((u64)97UL)));
+	if ((u32)t__2e810) goto L_passed_2e809; else goto L_failed_2e808;
+	L_failed_2e808:;
+	t_abortsite_2e605 = ((u64)8UL);
+	goto L_abort_2e606;
+	L_passed_2e809:;
+	t_value_2e817 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e818 = (u64)((u64)t_value_2e817 + (u64)((u64)0UL));
+	t__2e819 = (u64)(u32)(*(u32 *)t_value_2e818);
+	t__2e816 = (u64)(u32)(((u32)t__2e819 == (u32)((u64)97UL)));
+	if ((u32)t__2e816) goto L_passed_2e815; else goto L_failed_2e814;
+	L_failed_2e814:;
+	t_abortsite_2e605 = ((u64)9UL);
+	goto L_abort_2e606;
+	L_passed_2e815:;
+	t_value_2e823 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e824 = (u64)((u64)t_value_2e823 + (u64)((u64)0UL));
+	t__2e825 = (u64)(u32)(*(u32 *)t_value_2e824);
+	t__2e822 = (u64)(u32)(((u32)t__2e825 == (u32)((u64)97UL)));
+	if ((u32)t__2e822) goto L_passed_2e821; else goto L_failed_2e820;
+	L_failed_2e820:;
+	t_abortsite_2e605 = ((u64)10UL);
+	goto L_abort_2e606;
+	L_passed_2e821:;
+	t_value_2e829 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e830 = (u64)((u64)t_value_2e829 + (u64)((u64)0UL));
+	t__2e831 = (u64)(u32)(*(u32 *)t_value_2e830);
+	t__2e828 = (u64)(u32)(((u32)t__2e831 == (u32)((u64)97UL)));
+	if ((u32)t__2e828) goto L_passed_2e827; else goto L_failed_2e826;
+	L_failed_2e826:;
+	t_abortsite_2e605 = ((u64)11UL);
+	goto L_abort_2e606;
+	L_passed_2e827:;
+	t_value_2e835 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e836 = (u64)((u64)t_value_2e835 + (u64)((u64)0UL));
+	t__2e837 = (u64)(u32)(*(u32 *)t_value_2e836);
+	t__2e834 = (u64)(u32)(((u32)t__2e837 == (u32)((u64)97UL)));
+	if ((u32)t__2e834) goto L_passed_2e833; else goto L_failed_2e832;
+	L_failed_2e832:;
+	t_abortsite_2e605 = ((u64)12UL);
+	goto L_abort_2e606;
+	L_passed_2e833:;
+	t_value_2e841 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e842 = (u64)((u64)t_value_2e841 + (u64)((u64)0UL));
+	t__2e843 = (u64)(u32)(*(u32 *)t_value_2e842);
+	t__2e840 = (u64)(u32)(((u32)t__2e843 == (u32)((u64)97UL)));
+	if ((u32)t__2e840) goto L_passed_2e839; else goto L_failed_2e838;
+	L_failed_2e838:;
+	t_abortsite_2e605 = ((u64)13UL);
+	goto L_abort_2e606;
+	L_passed_2e839:;
+	t_value_2e847 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e848 = (u64)((u64)t_value_2e847 + (u64)((u64)0UL));
+	t__2e849 = (u64)(u32)(*(u32 *)t_value_2e848);
+	t__2e846 = (u64)(u32)(((u32)t__2e849 == (u32)((u64)97UL)));
+	if ((u32)t__2e846) goto L_passed_2e845; else goto L_failed_2e844;
+	L_failed_2e844:;
+	t_abortsite_2e605 = ((u64)14UL);
+	goto L_abort_2e606;
+	L_passed_2e845:;
+	t_value_2e853 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e854 = (u64)((u64)t_value_2e853 + (u64)((u64)0UL));
+	t__2e855 = (u64)(u32)(*(u32 *)t_value_2e854);
+	t__2e852 = (u64)(u32)(((u32)t__2e855 == (u32)((u64)97UL)));
+	if ((u32)t__2e852) goto L_passed_2e851; else goto L_failed_2e850;
+	L_failed_2e850:;
+	t_abortsite_2e605 = ((u64)15UL);
+	goto L_abort_2e606;
+	L_passed_2e851:;
+	t_value_2e859 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e860 = (u64)((u64)t_value_2e859 + (u64)((u64)0UL));
+	t__2e861 = (u64)(u32)(*(u32 *)t_value_2e860);
+	t__2e858 = (u64)(u32)(((u32)t__2e861 == (u32)((u64)97UL)));
+	if ((u32)t__2e858) goto L_passed_2e857; else goto L_failed_2e856;
+	L_failed_2e856:;
+	t_abortsite_2e605 = ((u64)16UL);
+	goto L_abort_2e606;
+	L_passed_2e857:;
+	t_value_2e865 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e866 = (u64)((u64)t_value_2e865 + (u64)((u64)0UL));
+	t__2e867 = (u64)(u32)(*(u32 *)t_value_2e866);
+	t__2e864 = (u64)(u32)(((u32)t__2e867 == (u32)((u64)97UL)));
+	if ((u32)t__2e864) goto L_passed_2e863; else goto L_failed_2e862;
+	L_failed_2e862:;
+	t_abortsite_2e605 = ((u64)17UL);
+	goto L_abort_2e606;
+	L_passed_2e863:;
+	t_value_2e871 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e872 = (u64)((u64)t_value_2e871 + (u64)((u64)0UL));
+	t__2e873 = (u64)(u32)(*(u32 *)t_value_2e872);
+	t__2e870 = (u64)(u32)(((u32)t__2e873 == (u32)((u64)97UL)));
+	if ((u32)t__2e870) goto L_passed_2e869; else goto L_failed_2e868;
+	L_failed_2e868:;
+	t_abortsite_2e605 = ((u64)18UL);
+	goto L_abort_2e606;
+	L_passed_2e869:;
+	t_value_2e877 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e878 = (u64)((u64)t_value_2e877 + (u64)((u64)0UL));
+	t__2e879 = (u64)(u32)(*(u32 *)t_value_2e878);
+	t__2e876 = (u64)(u32)(((u32)t__2e879 == (u32)((u64)97UL)));
+	if ((u32)t__2e876) goto L_passed_2e875; else goto L_failed_2e874;
+	L_failed_2e874:;
+	t_abortsite_2e605 = ((u64)19UL);
+	goto L_abort_2e606;
+	L_passed_2e875:;
+	t_value_2e883 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e884 = (u64)((u64)t_value_2e883 + (u64)((u64)0UL));
+	t__2e885 = (u64)(u32)(*(u32 *)t_value_2e884);
+	t__2e882 = (u64)(u32)(((u32)t__2e885 == (u32)((u64)97UL)));
+	if ((u32)t__2e882) goto L_passed_2e881; else goto L_failed_2e880;
+	L_failed_2e880:;
+	t_abortsite_2e605 = ((u64)20UL);
+	goto L_abort_2e606;
+	L_passed_2e881:;
+	t_value_2e889 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e890 = (u64)((u64)t_value_2e889 + (u64)((u64)0UL));
+	t__2e891 = (u64)(u32)(*(u32 *)t_value_2e890);
+	t__2e888 = (u64)(u32)(((u32)t__2e891 == (u32)((u64)97UL)));
+	if ((u32)t__2e888) goto L_passed_2e887; else goto L_failed_2e886;
+	L_failed_2e886:;
+	t_abortsite_2e605 = ((u64)21UL);
+	goto L_abort_2e606;
+	L_passed_2e887:;
+	t_value_2e895 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e896 = (u64)((u64)t_value_2e895 + (u64)((u64)0UL));
+	t__2e897 = (u64)(u32)(*(u32 *)t_value_2e896);
+	t__2e894 = (u64)(u32)(((u32)t__2e897 == (u32)((u64)97UL)));
+	if ((u32)t__2e894) goto L_passed_2e893; else goto L_failed_2e892;
+	L_failed_2e892:;
+	t_abortsite_2e605 = ((u64)22UL);
+	goto L_abort_2e606;
+	L_passed_2e893:;
+	t_value_2e901 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e902 = (u64)((u64)t_value_2e901 + (u64)((u64)0UL));
+	t__2e903 = (u64)(u32)(*(u32 *)t_value_2e902);
+	t__2e900 = (u64)(u32)(((u32)t__2e903 == (u32)((u64)97UL)));
+	if ((u32)t__2e900) goto L_passed_2e899; else goto L_failed_2e898;
+	L_failed_2e898:;
+	t_abortsite_2e605 = ((u64)23UL);
+	goto L_abort_2e606;
+	L_passed_2e899:;
+	t_value_2e907 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e908 = (u64)((u64)t_value_2e907 + (u64)((u64)0UL));
+	t__2e909 = (u64)(u32)(*(u32 *)t_value_2e908);
+	t__2e906 = (u64)(u32)(((u32)t__2e909 == (u32)((u64)97UL)));
+	if ((u32)t__2e906) goto L_passed_2e905; else goto L_failed_2e904;
+	L_failed_2e904:;
+	t_abortsite_2e605 = ((u64)24UL);
+	goto L_abort_2e606;
+	L_passed_2e905:;
+	t_value_2e913 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e914 = (u64)((u64)t_value_2e913 + (u64)((u64)0UL));
+	t__2e915 = (u64)(u32)(*(u32 *)t_value_2e914);
+	t__2e912 = (u64)(u32)(((u32)t__2e915 == (u32)((u64)97UL)));
+	if ((u32)t__2e912) goto L_passed_2e911; else goto L_failed_2e910;
+	L_failed_2e910:;
+	t_abortsite_2e605 = ((u64)25UL);
+	goto L_abort_2e606;
+	L_passed_2e911:;
+	t_value_2e919 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e920 = (u64)((u64)t_value_2e919 + (u64)((u64)0UL));
+	t__2e921 = (u64)(u32)(*(u32 *)t_value_2e920);
+	t__2e918 = (u64)(u32)(((u32)t__2e921 == (u32)((u64)97UL)));
+	if ((u32)t__2e918) goto L_passed_2e917; else goto L_failed_2e916;
+	L_failed_2e916:;
+	t_abortsite_2e605 = ((u64)26UL);
+	goto L_abort_2e606;
+	L_passed_2e917:;
+	t_value_2e925 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e926 = (u64)((u64)t_value_2e925 + (u64)((u64)0UL));
+	t__2e927 = (u64)(u32)(*(u32 *)t_value_2e926);
+	t__2e924 = (u64)(u32)(((u32)t__2e927 == (u32)((u64)97UL)));
+	if ((u32)t__2e924) goto L_passed_2e923; else goto L_failed_2e922;
+	L_failed_2e922:;
+	t_abortsite_2e605 = ((u64)27UL);
+	goto L_abort_2e606;
+	L_passed_2e923:;
+	t_value_2e931 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e932 = (u64)((u64)t_value_2e931 + (u64)((u64)0UL));
+	t__2e933 = (u64)(u32)(*(u32 *)t_value_2e932);
+	t__2e930 = (u64)(u32)(((u32)t__2e933 == (u32)((u64)97UL)));
+	if ((u32)t__2e930) goto L_passed_2e929; else goto L_failed_2e928;
+	L_failed_2e928:;
+	t_abortsite_2e605 = ((u64)28UL);
+	goto L_abort_2e606;
+	L_passed_2e929:;
+	t_value_2e937 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e938 = (u64)((u64)t_value_2e937 + (u64)((u64)0UL));
+	t__2e939 = (u64)(u32)(*(u32 *)t_value_2e938);
+	t__2e936 = (u64)(u32)(((u32)t__2e939 == (u32)((u64)97UL)));
+	if ((u32)t__2e936) goto L_passed_2e935; else goto L_failed_2e934;
+	L_failed_2e934:;
+	t_abortsite_2e605 = ((u64)29UL);
+	goto L_abort_2e606;
+	L_passed_2e935:;
+	t_value_2e943 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e944 = (u64)((u64)t_value_2e943 + (u64)((u64)0UL));
+	t__2e945 = (u64)(u32)(*(u32 *)t_value_2e944);
+	t__2e942 = (u64)(u32)(((u32)t__2e945 == (u32)((u64)97UL)));
+	if ((u32)t__2e942) goto L_passed_2e941; else goto L_failed_2e940;
+	L_failed_2e940:;
+	t_abortsite_2e605 = ((u64)30UL);
+	goto L_abort_2e606;
+	L_passed_2e941:;
+	t_value_2e949 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e950 = (u64)((u64)t_value_2e949 + (u64)((u64)0UL));
+	t__2e951 = (u64)(u32)(*(u32 *)t_value_2e950);
+	t__2e948 = (u64)(u32)(((u32)t__2e951 == (u32)((u64)97UL)));
+	if ((u32)t__2e948) goto L_passed_2e947; else goto L_failed_2e946;
+	L_failed_2e946:;
+	t_abortsite_2e605 = ((u64)31UL);
+	goto L_abort_2e606;
+	L_passed_2e947:;
+	t_value_2e955 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e956 = (u64)((u64)t_value_2e955 + (u64)((u64)0UL));
+	t__2e957 = (u64)(u32)(*(u32 *)t_value_2e956);
+	t__2e954 = (u64)(u32)(((u32)t__2e957 == (u32)((u64)97UL)));
+	if ((u32)t__2e954) goto L_passed_2e953; else goto L_failed_2e952;
+	L_failed_2e952:;
+	t_abortsite_2e605 = ((u64)32UL);
+	goto L_abort_2e606;
+	L_passed_2e953:;
+	t_value_2e961 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e962 = (u64)((u64)t_value_2e961 + (u64)((u64)0UL));
+	t__2e963 = (u64)(u32)(*(u32 *)t_value_2e962);
+	t__2e960 = (u64)(u32)(((u32)t__2e963 == (u32)((u64)97UL)));
+	if ((u32)t__2e960) goto L_passed_2e959; else goto L_failed_2e958;
+	L_failed_2e958:;
+	t_abortsite_2e605 = ((u64)33UL);
+	goto L_abort_2e606;
+	L_passed_2e959:;
+	t_value_2e967 = (u64)((u64)t_binding_2e797 + (u64)((u64)0UL));
+	t_value_2e968 = (u64)((u64)t_value_2e967 + (u64)((u64)0UL));
+	t__2e969 = (u64)(u32)(*(u32 *)t_value_2e968);
+	t__2e966 = (u64)(u32)(((u32)t__2e969 == (u32)((u64)97UL)));
+	if ((u32)t__2e966) goto L_passed_2e965; else goto L_failed_2e964;
+	L_failed_2e964:;
+	t_abortsite_2e605 = ((u64)34UL);
+	goto L_abort_2e606;
+	L_passed_2e965:;
+	t__2e972 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e972) goto L_passed_2e971; else goto L_failed_2e970;
+	L_failed_2e970:;
+	t_abortsite_2e605 = ((u64)35UL);
+	goto L_abort_2e606;
+	L_passed_2e971:;
+	t__2e975 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e975) goto L_passed_2e974; else goto L_failed_2e973;
+	L_failed_2e973:;
+	t_abortsite_2e605 = ((u64)36UL);
+	goto L_abort_2e606;
+	L_passed_2e974:;
+	t__2e978 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e978) goto L_passed_2e977; else goto L_failed_2e976;
+	L_failed_2e976:;
+	t_abortsite_2e605 = ((u64)37UL);
+	goto L_abort_2e606;
+	L_passed_2e977:;
+	t__2e981 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e981) goto L_passed_2e980; else goto L_failed_2e979;
+	L_failed_2e979:;
+	t_abortsite_2e605 = ((u64)38UL);
+	goto L_abort_2e606;
+	L_passed_2e980:;
+	t__2e984 = (u64)(u32)(((u32)((u64)3890UL) == (u32)((u64)3890UL)));
+	if ((u32)t__2e984) goto L_passed_2e983; else goto L_failed_2e982;
+	L_failed_2e982:;
+	t_abortsite_2e605 = ((u64)39UL);
+	goto L_abort_2e606;
+	L_passed_2e983:;
+	t__2e987 = (u64)(u32)(((u32)((u64)3940UL) == (u32)((u64)3940UL)));
+	if ((u32)t__2e987) goto L_passed_2e986; else goto L_failed_2e985;
+	L_failed_2e985:;
+	t_abortsite_2e605 = ((u64)40UL);
+	goto L_abort_2e606;
+	L_passed_2e986:;
+	t__2e990 = (u64)(u32)(((u32)((u64)7986UL) == (u32)((u64)7986UL)));
+	if ((u32)t__2e990) goto L_passed_2e989; else goto L_failed_2e988;
+	L_failed_2e988:;
+	t_abortsite_2e605 = ((u64)41UL);
+	goto L_abort_2e606;
+	L_passed_2e989:;
+	t__2e993 = (u64)(u32)(((u32)((u64)8036UL) == (u32)((u64)8036UL)));
+	if ((u32)t__2e993) goto L_passed_2e992; else goto L_failed_2e991;
+	L_failed_2e991:;
+	t_abortsite_2e605 = ((u64)42UL);
+	goto L_abort_2e606;
+	L_passed_2e992:;
+	t__2e996 = (u64)(u32)(((u32)((u64)62241UL) == (u32)((u64)62241UL)));
+	if ((u32)t__2e996) goto L_passed_2e995; else goto L_failed_2e994;
+	L_failed_2e994:;
+	t_abortsite_2e605 = ((u64)43UL);
+	goto L_abort_2e606;
+	L_passed_2e995:;
+	t__2e999 = (u64)(u32)(((u32)((u64)63041UL) == (u32)((u64)63041UL)));
+	if ((u32)t__2e999) goto L_passed_2e998; else goto L_failed_2e997;
+	L_failed_2e997:;
+	t_abortsite_2e605 = ((u64)44UL);
+	goto L_abort_2e606;
+	L_passed_2e998:;
+	t__2e1002 = (u64)(u32)(((u32)((u64)14UL) == (u32)((u64)14UL)));
+	if ((u32)t__2e1002) goto L_passed_2e1001; else goto L_failed_2e1000;
+	L_failed_2e1000:;
+	t_abortsite_2e605 = ((u64)45UL);
+	goto L_abort_2e606;
+	L_passed_2e1001:;
+	t__2e1006 = (u64)(u32)((u32)((u64)14UL) + (u32)((u64)1UL));
+	t__2e1005 = (u64)(u32)(((u32)t__2e1006 == (u32)((u64)15UL)));
+	if ((u32)t__2e1005) goto L_passed_2e1004; else goto L_failed_2e1003;
+	L_failed_2e1003:;
+	t_abortsite_2e605 = ((u64)46UL);
+	goto L_abort_2e606;
+	L_passed_2e1004:;
+	t__2e1010 = (u64)(u32)((u32)((u64)14UL) - (u32)((u64)1UL));
+	t__2e1009 = (u64)(u32)(((u32)t__2e1010 == (u32)((u64)13UL)));
+	if ((u32)t__2e1009) goto L_passed_2e1008; else goto L_failed_2e1007;
+	L_failed_2e1007:;
+	t_abortsite_2e605 = ((u64)47UL);
+	goto L_abort_2e606;
+	L_passed_2e1008:;
+	t__2e1013 = (u64)(u32)(((u32)((u64)30UL) == (u32)((u64)30UL)));
+	if ((u32)t__2e1013) goto L_passed_2e1012; else goto L_failed_2e1011;
+	L_failed_2e1011:;
+	t_abortsite_2e605 = ((u64)48UL);
+	goto L_abort_2e606;
+	L_passed_2e1012:;
+	t__2e1017 = (u64)(u32)((u32)((u64)30UL) + (u32)((u64)1UL));
+	t__2e1016 = (u64)(u32)(((u32)t__2e1017 == (u32)((u64)31UL)));
+	if ((u32)t__2e1016) goto L_passed_2e1015; else goto L_failed_2e1014;
+	L_failed_2e1014:;
+	t_abortsite_2e605 = ((u64)49UL);
+	goto L_abort_2e606;
+	L_passed_2e1015:;
+	t__2e1021 = (u64)(u32)((u32)((u64)30UL) - (u32)((u64)1UL));
+	t__2e1020 = (u64)(u32)(((u32)t__2e1021 == (u32)((u64)29UL)));
+	if ((u32)t__2e1020) goto L_passed_2e1019; else goto L_failed_2e1018;
+	L_failed_2e1018:;
+	t_abortsite_2e605 = ((u64)50UL);
+	goto L_abort_2e606;
+	L_passed_2e1019:;
+	t__2e1024 = (u64)(u32)(((u32)((u64)481UL) == (u32)((u64)481UL)));
+	if ((u32)t__2e1024) goto L_passed_2e1023; else goto L_failed_2e1022;
+	L_failed_2e1022:;
+	t_abortsite_2e605 = ((u64)51UL);
+	goto L_abort_2e606;
+	L_passed_2e1023:;
+	t__2e1027 = (u64)(u32)(((u32)((u64)1974066UL) == (u32)((u64)1974066UL)));
+	if ((u32)t__2e1027) goto L_passed_2e1026; else goto L_failed_2e1025;
+	L_failed_2e1025:;
+	t_abortsite_2e605 = ((u64)52UL);
+	goto L_abort_2e606;
+	L_passed_2e1026:;
+	t__2e1032 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e1032) goto L_true_2e1029; else goto L_false_2e1030;
+	L_true_2e1029:;
+	*(u32 *)t_binding_2e1028 = (u32)((u64)5UL);
+	goto L__2e1031;
+	L_false_2e1030:;
+	*(u32 *)t_binding_2e1028 = (u32)((u64)10UL);
+	L__2e1031:;
+	t__2e1036 = (u64)(u32)(*(i32 *)t_binding_2e1028);
+	t__2e1035 = (u64)(u32)(((u32)t__2e1036 == (u32)((u64)5UL)));
+	if ((u32)t__2e1035) goto L_passed_2e1034; else goto L_failed_2e1033;
+	L_failed_2e1033:;
+	t_abortsite_2e605 = ((u64)53UL);
+	goto L_abort_2e606;
+	L_passed_2e1034:;
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)0UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1041)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)24UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1043)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)48UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1045)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)72UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1047)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)96UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1049)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)120UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1051)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)144UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1053)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)168UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1055)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)192UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1057)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)216UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1059)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)240UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1061)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)264UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1063)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)288UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1065)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)312UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1067)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)336UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1069)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)360UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1071)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)384UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1073)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)408UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1075)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)432UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1077)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)456UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1079)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)480UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1081)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)504UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1083)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)528UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1085)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)552UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1087)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)576UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1089)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)600UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1091)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)624UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1093)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)648UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1095)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)672UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1097)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)696UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1099)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)720UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1101)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)744UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1103)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)768UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1105)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)792UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1107)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)816UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1109)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)840UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1111)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)864UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1113)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)888UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1115)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)912UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1117)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)936UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1119)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)960UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1121)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)984UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1123)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1008UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1125)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1032UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1127)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1056UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1129)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1080UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1131)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1104UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1133)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1128UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1135)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1152UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1137)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1176UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1139)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1200UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1141)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1224UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1143)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1248UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1145)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1272UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1147)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1296UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1149)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1320UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1151)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1344UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1153)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1368UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1155)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1392UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1157)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1416UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1159)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1440UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1161)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1464UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1163)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1488UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1165)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1512UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1167)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1536UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1169)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1560UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1171)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1584UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1173)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1608UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1175)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1632UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1177)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1656UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1179)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1680UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1181)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1704UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1183)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1728UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1185)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1752UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1187)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1776UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1189)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1800UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1191)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1824UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1193)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1848UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1195)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1872UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1197)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1896UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1199)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1920UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1201)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1944UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1203)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1968UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1205)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)1992UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1207)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2016UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1209)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2040UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1211)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2064UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1213)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2088UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1215)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2112UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1217)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2136UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1219)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2160UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1221)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2184UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1223)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2208UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1225)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2232UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1227)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2256UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1229)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2280UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1231)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2304UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1233)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2328UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1235)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2352UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1237)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2376UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1239)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2400UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1241)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2424UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1243)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2448UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1245)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2472UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1247)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2496UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1249)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2520UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1251)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2544UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1253)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2568UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1255)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2592UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1257)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2616UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1259)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2640UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1261)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2664UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1263)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2688UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1265)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2712UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1267)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2736UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1269)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2760UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1271)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2784UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1273)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2808UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1275)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2832UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1277)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2856UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1279)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2880UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1281)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2904UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1283)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2928UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1285)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2952UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1287)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)2976UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1289)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3000UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1291)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3024UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1293)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3048UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1295)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3072UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1297)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3096UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1299)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3120UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1301)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3144UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1303)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3168UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1305)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3192UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1307)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3216UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1309)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3240UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1311)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3264UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1313)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3288UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1315)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3312UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1317)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3336UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1319)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3360UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1321)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3384UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1323)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3408UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1325)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3432UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1327)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3456UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1329)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3480UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1331)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3504UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1333)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3528UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1335)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3552UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1337)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3576UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1339)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3600UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1341)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3624UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1343)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3648UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1345)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3672UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1347)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3696UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1349)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3720UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1351)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3744UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1353)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3768UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1355)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3792UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1357)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3816UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1359)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3840UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1361)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3864UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1363)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3888UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1365)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3912UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1367)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3936UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1369)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3960UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1371)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)3984UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1373)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4008UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1375)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4032UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1377)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4056UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1379)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4080UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1381)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4104UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1383)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4128UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1385)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4152UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1387)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4176UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1389)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4200UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1391)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4224UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1393)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4248UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1395)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4272UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1397)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4296UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1399)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4320UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1401)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4344UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1403)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4368UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1405)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4392UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1407)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4416UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1409)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4440UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1411)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4464UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1413)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4488UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1415)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4512UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1417)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4536UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1419)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4560UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1421)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4584UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1423)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4608UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1425)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4632UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1427)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4656UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1429)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4680UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1431)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4704UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1433)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4728UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1435)), ((u64)24UL));
+	t_item_2e1039 = (u64)((u64)t_binding_2e1037 + (u64)((u64)4752UL));
+	BLIT(t_item_2e1039, ((u64)((char *)&D_strliteral_2e1437)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)0UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1442)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)24UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1444)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)48UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1446)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)72UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1448)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)96UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1450)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)120UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1452)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)144UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1454)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)168UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1456)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)192UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1458)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)216UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1460)), ((u64)24UL));
+	t_item_2e1440 = (u64)((u64)t_binding_2e1438 + (u64)((u64)240UL));
+	BLIT(t_item_2e1440, ((u64)((char *)&D_strliteral_2e1462)), ((u64)24UL));
+	t_item_2e1465 = (u64)((u64)t_binding_2e1463 + (u64)((u64)0UL));
+	BLIT(t_item_2e1465, ((u64)((char *)&D_strliteral_2e1467)), ((u64)24UL));
+	t_item_2e1465 = (u64)((u64)t_binding_2e1463 + (u64)((u64)24UL));
+	BLIT(t_item_2e1465, ((u64)((char *)&D_strliteral_2e1469)), ((u64)24UL));
+	t_item_2e1465 = (u64)((u64)t_binding_2e1463 + (u64)((u64)48UL));
+	BLIT(t_item_2e1465, ((u64)((char *)&D_strliteral_2e1471)), ((u64)24UL));
+	t_item_2e1465 = (u64)((u64)t_binding_2e1463 + (u64)((u64)72UL));
+	BLIT(t_item_2e1465, ((u64)((char *)&D_strliteral_2e1473)), ((u64)24UL));
+	t_item_2e1476 = (u64)((u64)t_binding_2e1474 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e1476 = (u8)((u64)0UL);
+	t__2e1477 = (u64)((u64)t_binding_2e1474 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e1477, (u64)t_item_2e1476, (u64)((u64)255UL));
+	t_item_2e1479 = (u64)((u64)t_binding_2e1474 + (u64)((u64)0UL));
+	t__2e1478 = (u64)((u64)t_binding_2e1474 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e1478, (u64)t_item_2e1479, (u64)((u64)255UL));
+	*(u64 *)t_binding_2e1485 = (u64)((u64)0UL);
+	L_loop_2e1480:;
+	t__2e1487 = (u64)(*(u64 *)t_binding_2e1485);
+	t__2e1486 = (u64)(u32)(((u64)t__2e1487 < (u64)((u64)199UL)));
+	if ((u32)t__2e1486) goto L_body_2e1481; else goto L__2e1483;
+	L_body_2e1481:;
+	*(u64 *)t_binding_2e1495 = (u64)((u64)0UL);
+	L_loop_2e1490:;
+	t__2e1497 = (u64)(*(u64 *)t_binding_2e1495);
+	t__2e1496 = (u64)(u32)(((u64)t__2e1497 < (u64)((u64)4UL)));
+	if ((u32)t__2e1496) goto L_body_2e1491; else goto L__2e1493;
+	L_body_2e1491:;
+	t__2e1501 = t_binding_2e1474;
+	t__2e1502 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1503 = (u64)((u64)t__2e1502 - (u64)((u64)0UL));
+	t__2e1507 = (u64)(u32)(((u64)t__2e1502 <= (u64)((u64)256UL)));
+	t__2e1503 = t__2e1502;
+	t__2e1504 = ((u64)256UL);
+	if ((u32)t__2e1507) goto L__2e1509; else goto L__2e1508;
+	L__2e1508:;
+	t_abortsite_2e605 = ((u64)54UL);
+	goto L_abort_2e1510;
+	L__2e1509:;
+	t_data_2e1516 = (u64)((u64)((u64)0UL) * (u64)((u64)1UL));
+	t_data_2e1516 = (u64)((u64)t__2e1501 + (u64)t_data_2e1516);
+	*(u64 *)t_binding_2e1500 = (u64)t_data_2e1516;
+	t__2e1518 = (u64)((u64)t_binding_2e1500 + (u64)((u64)8UL));
+	*(u64 *)t__2e1518 = (u64)t__2e1503;
+	t__2e1518 = (u64)((u64)t_binding_2e1500 + (u64)((u64)16UL));
+	*(u64 *)t__2e1518 = (u64)t__2e1504;
+	t__2e1519 = (u64)((u64)t_binding_2e1500 + (u64)((u64)8UL));
+	t__2e1520 = (u64)((u64)t_binding_2e1500 + (u64)((u64)16UL));
+	t__2e1521 = (u64)(*(u64 *)t__2e1519);
+	BLIT((u64)B27, ((u64)((char *)&D_strliteral_2e1524)), 24);
+	t__2e1522 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R28, (u64)B27);
+	t__2e1526 = (u64)((u64)t__2e1522 + (u64)((u64)8UL));
+	t__2e1525 = (u64)(*(u64 *)t__2e1526);
+	t__2e1527 = (u64)((u64)t__2e1521 + (u64)t__2e1525);
+	*(u64 *)t__2e1519 = (u64)t__2e1527;
+	t__2e1529 = (u64)(*(u64 *)t__2e1520);
+	t__2e1532 = (u64)(u32)(((u64)t__2e1527 <= (u64)t__2e1529));
+	if ((u32)t__2e1532) goto L__2e1530; else goto L__2e1531;
+	L__2e1531:;
+	t_abortsite_2e605 = ((u64)55UL);
+	goto L_abort_2e1510;
+	L__2e1530:;
+	t__2e1533 = (u64)(*(u64 *)t_binding_2e1500);
+	t__2e1528 = (u64)((u64)t__2e1521 * (u64)((u64)1UL));
+	t__2e1528 = (u64)((u64)t__2e1533 + (u64)t__2e1528);
+	t__2e1534 = (u64)((u64)t__2e1525 * (u64)((u64)1UL));
+	t__2e1535 = (u64)(*(u64 *)t__2e1522);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1528, (u64)t__2e1535, (u64)t__2e1534);
+	t__2e1536 = (u64)((u64)t_binding_2e1500 + (u64)((u64)8UL));
+	t__2e1537 = (u64)((u64)t_binding_2e1500 + (u64)((u64)16UL));
+	t__2e1538 = (u64)(*(u64 *)t__2e1536);
+	t__2e1541 = (u64)(*(u64 *)t_binding_2e1485);
+	t__2e1540 = (u64)((u64)t__2e1541 * (u64)((u64)24UL));
+	t__2e1540 = (u64)((u64)t_binding_2e1037 + (u64)t__2e1540);
+	BLIT((u64)B29, t__2e1540, 24);
+	t__2e1539 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R30, (u64)B29);
+	t__2e1543 = (u64)((u64)t__2e1539 + (u64)((u64)8UL));
+	t__2e1542 = (u64)(*(u64 *)t__2e1543);
+	t__2e1544 = (u64)((u64)t__2e1538 + (u64)t__2e1542);
+	*(u64 *)t__2e1536 = (u64)t__2e1544;
+	t__2e1546 = (u64)(*(u64 *)t__2e1537);
+	t__2e1549 = (u64)(u32)(((u64)t__2e1544 <= (u64)t__2e1546));
+	if ((u32)t__2e1549) goto L__2e1547; else goto L__2e1548;
+	L__2e1548:;
+	t_abortsite_2e605 = ((u64)56UL);
+	goto L_abort_2e1510;
+	L__2e1547:;
+	t__2e1550 = (u64)(*(u64 *)t_binding_2e1500);
+	t__2e1545 = (u64)((u64)t__2e1538 * (u64)((u64)1UL));
+	t__2e1545 = (u64)((u64)t__2e1550 + (u64)t__2e1545);
+	t__2e1551 = (u64)((u64)t__2e1542 * (u64)((u64)1UL));
+	t__2e1552 = (u64)(*(u64 *)t__2e1539);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1545, (u64)t__2e1552, (u64)t__2e1551);
+	t__2e1553 = (u64)((u64)t_binding_2e1500 + (u64)((u64)8UL));
+	t__2e1554 = (u64)((u64)t_binding_2e1500 + (u64)((u64)16UL));
+	t__2e1555 = (u64)(*(u64 *)t__2e1553);
+	t__2e1558 = (u64)(*(u64 *)t_binding_2e1495);
+	t__2e1557 = (u64)((u64)t__2e1558 * (u64)((u64)24UL));
+	t__2e1557 = (u64)((u64)t_binding_2e1463 + (u64)t__2e1557);
+	BLIT((u64)B31, t__2e1557, 24);
+	t__2e1556 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R32, (u64)B31);
+	t__2e1560 = (u64)((u64)t__2e1556 + (u64)((u64)8UL));
+	t__2e1559 = (u64)(*(u64 *)t__2e1560);
+	t__2e1561 = (u64)((u64)t__2e1555 + (u64)t__2e1559);
+	*(u64 *)t__2e1553 = (u64)t__2e1561;
+	t__2e1563 = (u64)(*(u64 *)t__2e1554);
+	t__2e1566 = (u64)(u32)(((u64)t__2e1561 <= (u64)t__2e1563));
+	if ((u32)t__2e1566) goto L__2e1564; else goto L__2e1565;
+	L__2e1565:;
+	t_abortsite_2e605 = ((u64)57UL);
+	goto L_abort_2e1510;
+	L__2e1564:;
+	t__2e1567 = (u64)(*(u64 *)t_binding_2e1500);
+	t__2e1562 = (u64)((u64)t__2e1555 * (u64)((u64)1UL));
+	t__2e1562 = (u64)((u64)t__2e1567 + (u64)t__2e1562);
+	t__2e1568 = (u64)((u64)t__2e1559 * (u64)((u64)1UL));
+	t__2e1569 = (u64)(*(u64 *)t__2e1556);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1562, (u64)t__2e1569, (u64)t__2e1568);
+	*(u32 *)t_object_2e1572 = (u32)((u64)3012680272UL);
+	*(u64 *)t_object_2e1573 = (u64)((u64)0UL);
+	t__2e1574 = (u64)((u64)t_object_2e1573 + (u64)((u64)8UL));
+	*(u64 *)t__2e1574 = (u64)((u64)0UL);
+	t__2e1574 = (u64)((u64)t__2e1574 + (u64)((u64)8UL));
+	*(u64 *)t__2e1574 = (u64)((u64)0UL);
+	BLIT((u64)B33, t_object_2e1572, 8);
+	BLIT((u64)B34, t_binding_2e1500, 24);
+	BLIT((u64)B35, t_object_2e1573, 24);
+	t__2e1571 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R36, (u64)B33, (u64)B34, (u64)B35);
+	t_tag_2e1575 = (u64)(*(u32 *)t__2e1571);
+	t__2e1583 = (u64)(u32)(((u32)t_tag_2e1575 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1583) goto L_member_2e1580; else goto L__2e1582;
+	L__2e1582:;
+	t__2e1585 = (u64)(u32)(((u32)t_tag_2e1575 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1585) goto L_member_2e1581; else goto L__2e1584;
+	L__2e1584:;
+	goto L_matches_2e1579;
+	L_member_2e1580:;
+	goto L_matches_2e1579;
+	L_member_2e1581:;
+	goto L_matches_2e1578;
+	L_matches_2e1578:;
+	goto L__2e1576;
+	L_matches_2e1579:;
+	t_abortsite_2e605 = ((u64)58UL);
+	goto L_abort_2e1586;
+	L__2e1592:;
+	L__2e1577:;
+	t_abortsite_2e605 = ((u64)59UL);
+	goto L_abort_2e1593;
+	L__2e1576:;
+	goto L__2e1498;
+	L__2e1599:;
+	L__2e1498:;
+	L_after_2e1494:;
+	t__2e1600 = (u64)(*(u64 *)t_binding_2e1495);
+	t__2e1600 = (u64)((u64)t__2e1600 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1495 = (u64)t__2e1600;
+	goto L_loop_2e1490;
+	L__2e1493:;
+	goto L__2e1488;
+	L__2e1601:;
+	L__2e1488:;
+	L_after_2e1484:;
+	t__2e1602 = (u64)(*(u64 *)t_binding_2e1485);
+	t__2e1602 = (u64)((u64)t__2e1602 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1485 = (u64)t__2e1602;
+	goto L_loop_2e1480;
+	L__2e1483:;
+	*(u64 *)t_binding_2e1608 = (u64)((u64)0UL);
+	L_loop_2e1603:;
+	t__2e1610 = (u64)(*(u64 *)t_binding_2e1608);
+	t__2e1609 = (u64)(u32)(((u64)t__2e1610 < (u64)((u64)11UL)));
+	if ((u32)t__2e1609) goto L_body_2e1604; else goto L__2e1606;
+	L_body_2e1604:;
+	*(u32 *)t_object_2e1615 = (u32)((u64)3012680272UL);
+	t__2e1617 = (u64)(*(u64 *)t_binding_2e1608);
+	t__2e1616 = (u64)((u64)t__2e1617 * (u64)((u64)24UL));
+	t__2e1616 = (u64)((u64)t_binding_2e1438 + (u64)t__2e1616);
+	*(u64 *)t_object_2e1618 = (u64)((u64)0UL);
+	t__2e1619 = (u64)((u64)t_object_2e1618 + (u64)((u64)8UL));
+	*(u64 *)t__2e1619 = (u64)((u64)0UL);
+	t__2e1619 = (u64)((u64)t__2e1619 + (u64)((u64)8UL));
+	*(u64 *)t__2e1619 = (u64)((u64)0UL);
+	BLIT((u64)B37, t_object_2e1615, 8);
+	BLIT((u64)B38, t__2e1616, 24);
+	BLIT((u64)B39, t_object_2e1618, 24);
+	t__2e1614 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R40, (u64)B37, (u64)B38, (u64)B39);
+	t_tag_2e1620 = (u64)(*(u32 *)t__2e1614);
+	t__2e1628 = (u64)(u32)(((u32)t_tag_2e1620 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1628) goto L_member_2e1625; else goto L__2e1627;
+	L__2e1627:;
+	t__2e1630 = (u64)(u32)(((u32)t_tag_2e1620 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1630) goto L_member_2e1626; else goto L__2e1629;
+	L__2e1629:;
+	goto L_matches_2e1624;
+	L_member_2e1625:;
+	goto L_matches_2e1624;
+	L_member_2e1626:;
+	goto L_matches_2e1623;
+	L_matches_2e1623:;
+	goto L__2e1621;
+	L_matches_2e1624:;
+	t_abortsite_2e605 = ((u64)60UL);
+	goto L_abort_2e1586;
+	L__2e1631:;
+	L__2e1622:;
+	t_abortsite_2e605 = ((u64)61UL);
+	goto L_abort_2e1593;
+	L__2e1621:;
+	goto L__2e1611;
+	L__2e1632:;
+	L__2e1611:;
+	L_after_2e1607:;
+	t__2e1633 = (u64)(*(u64 *)t_binding_2e1608);
+	t__2e1633 = (u64)((u64)t__2e1633 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1608 = (u64)t__2e1633;
+	goto L_loop_2e1603;
+	L__2e1606:;
+	goto L__2e490;
+	L__2e1634:;
+	L__2e490:;
+	return;
+	L_abort_2e606:;
+	t__2e607 = (u64)((u64)t_abortsite_2e605 * (u64)((u64)16UL));
+	t__2e607 = (u64)((u64)((u64)((char *)&D_abortsites_2e604)) + (u64)t__2e607);
+	t__2e608 = (u64)(*(u64 *)t__2e607);
+	t__2e609 = (u64)((u64)t__2e607 + (u64)((u64)8UL));
+	t__2e610 = (u64)(*(u32 *)t__2e609);
+	t__2e609 = (u64)((u64)t__2e607 + (u64)((u64)12UL));
+	t__2e611 = (u64)(*(u32 *)t__2e609);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e608, (u64)t__2e610, (u64)t__2e611, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1510:;
+	t__2e1511 = (u64)((u64)t_abortsite_2e605 * (u64)((u64)16UL));
+	t__2e1511 = (u64)((u64)((u64)((char *)&D_abortsites_2e604)) + (u64)t__2e1511);
+	t__2e1512 = (u64)(*(u64 *)t__2e1511);
+	t__2e1513 = (u64)((u64)t__2e1511 + (u64)((u64)8UL));
+	t__2e1514 = (u64)(*(u32 *)t__2e1513);
+	t__2e1513 = (u64)((u64)t__2e1511 + (u64)((u64)12UL));
+	t__2e1515 = (u64)(*(u32 *)t__2e1513);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1512, (u64)t__2e1514, (u64)t__2e1515, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e1586:;
+	t__2e1587 = (u64)((u64)t_abortsite_2e605 * (u64)((u64)16UL));
+	t__2e1587 = (u64)((u64)((u64)((char *)&D_abortsites_2e604)) + (u64)t__2e1587);
+	t__2e1588 = (u64)(*(u64 *)t__2e1587);
+	t__2e1589 = (u64)((u64)t__2e1587 + (u64)((u64)8UL));
+	t__2e1590 = (u64)(*(u32 *)t__2e1589);
+	t__2e1589 = (u64)((u64)t__2e1587 + (u64)((u64)12UL));
+	t__2e1591 = (u64)(*(u32 *)t__2e1589);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1588, (u64)t__2e1590, (u64)t__2e1591, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e1593:;
+	t__2e1594 = (u64)((u64)t_abortsite_2e605 * (u64)((u64)16UL));
+	t__2e1594 = (u64)((u64)((u64)((char *)&D_abortsites_2e604)) + (u64)t__2e1594);
+	t__2e1595 = (u64)(*(u64 *)t__2e1594);
+	t__2e1596 = (u64)((u64)t__2e1594 + (u64)((u64)8UL));
+	t__2e1597 = (u64)(*(u32 *)t__2e1596);
+	t__2e1596 = (u64)((u64)t__2e1594 + (u64)((u64)12UL));
+	t__2e1598 = (u64)(*(u32 *)t__2e1596);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1595, (u64)t__2e1597, (u64)t__2e1598, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_basics(void) {
+	char A0[1] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[68] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char A20[8] __attribute__((aligned(16)));
+	char A21[24] __attribute__((aligned(16)));
+	char B22[8] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char R25[4] __attribute__((aligned(16)));
+	char B26[8] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char R29[4] __attribute__((aligned(16)));
+	char B30[8] __attribute__((aligned(16)));
+	char B31[24] __attribute__((aligned(16)));
+	char B32[24] __attribute__((aligned(16)));
+	char R33[4] __attribute__((aligned(16)));
+	char B34[8] __attribute__((aligned(16)));
+	char B35[24] __attribute__((aligned(16)));
+	char B36[24] __attribute__((aligned(16)));
+	char R37[4] __attribute__((aligned(16)));
+	char B38[8] __attribute__((aligned(16)));
+	char B39[24] __attribute__((aligned(16)));
+	char B40[24] __attribute__((aligned(16)));
+	char R41[4] __attribute__((aligned(16)));
+	char B42[8] __attribute__((aligned(16)));
+	char B43[24] __attribute__((aligned(16)));
+	char B44[24] __attribute__((aligned(16)));
+	char R45[4] __attribute__((aligned(16)));
+	char B46[8] __attribute__((aligned(16)));
+	char B47[24] __attribute__((aligned(16)));
+	char B48[24] __attribute__((aligned(16)));
+	char R49[4] __attribute__((aligned(16)));
+	char B50[8] __attribute__((aligned(16)));
+	char B51[24] __attribute__((aligned(16)));
+	char B52[24] __attribute__((aligned(16)));
+	char R53[4] __attribute__((aligned(16)));
+	char B54[8] __attribute__((aligned(16)));
+	char B55[24] __attribute__((aligned(16)));
+	char B56[24] __attribute__((aligned(16)));
+	char R57[4] __attribute__((aligned(16)));
+	u64 t__2e1642;
+	u64 t__2e1647;
+	u64 t__2e1649;
+	u64 t__2e1653;
+	u64 t__2e1662;
+	u64 t__2e1664;
+	u64 t__2e1668;
+	u64 t__2e1669;
+	u64 t__2e1670;
+	u64 t__2e1671;
+	u64 t__2e1672;
+	u64 t__2e1675;
+	u64 t__2e1676;
+	u64 t__2e1677;
+	u64 t__2e1678;
+	u64 t__2e1679;
+	u64 t__2e1681;
+	u64 t__2e1683;
+	u64 t__2e1687;
+	u64 t__2e1696;
+	u64 t__2e1698;
+	u64 t__2e1701;
+	u64 t__2e1703;
+	u64 t__2e1707;
+	u64 t__2e1716;
+	u64 t__2e1718;
+	u64 t__2e1721;
+	u64 t__2e1723;
+	u64 t__2e1727;
+	u64 t__2e1736;
+	u64 t__2e1738;
+	u64 t__2e1741;
+	u64 t__2e1743;
+	u64 t__2e1747;
+	u64 t__2e1756;
+	u64 t__2e1758;
+	u64 t__2e1761;
+	u64 t__2e1763;
+	u64 t__2e1767;
+	u64 t__2e1776;
+	u64 t__2e1778;
+	u64 t__2e1781;
+	u64 t__2e1783;
+	u64 t__2e1787;
+	u64 t__2e1796;
+	u64 t__2e1798;
+	u64 t__2e1801;
+	u64 t__2e1803;
+	u64 t__2e1807;
+	u64 t__2e1816;
+	u64 t__2e1818;
+	u64 t__2e1821;
+	u64 t__2e1823;
+	u64 t__2e1827;
+	u64 t__2e1836;
+	u64 t__2e1838;
+	u64 t_abortsite_2e1666;
+	u64 t_binding_2e1639;
+	u64 t_binding_2e1640;
+	u64 t_binding_2e1641;
+	u64 t_binding_2e1643;
+	u64 t_item_2e1645;
+	u64 t_object_2e1648;
+	u64 t_object_2e1652;
+	u64 t_object_2e1682;
+	u64 t_object_2e1686;
+	u64 t_object_2e1702;
+	u64 t_object_2e1706;
+	u64 t_object_2e1722;
+	u64 t_object_2e1726;
+	u64 t_object_2e1742;
+	u64 t_object_2e1746;
+	u64 t_object_2e1762;
+	u64 t_object_2e1766;
+	u64 t_object_2e1782;
+	u64 t_object_2e1786;
+	u64 t_object_2e1802;
+	u64 t_object_2e1806;
+	u64 t_object_2e1822;
+	u64 t_object_2e1826;
+	u64 t_tag_2e1654;
+	u64 t_tag_2e1688;
+	u64 t_tag_2e1708;
+	u64 t_tag_2e1728;
+	u64 t_tag_2e1748;
+	u64 t_tag_2e1768;
+	u64 t_tag_2e1788;
+	u64 t_tag_2e1808;
+	u64 t_tag_2e1828;
+	L_start_2e1635:;
+	t_binding_2e1639 = (u64)A0;
+	t_binding_2e1640 = (u64)A1;
+	t_binding_2e1641 = (u64)A2;
+	t_binding_2e1643 = (u64)A3;
+	t_object_2e1648 = (u64)A4;
+	t_object_2e1652 = (u64)A5;
+	t_object_2e1682 = (u64)A6;
+	t_object_2e1686 = (u64)A7;
+	t_object_2e1702 = (u64)A8;
+	t_object_2e1706 = (u64)A9;
+	t_object_2e1722 = (u64)A10;
+	t_object_2e1726 = (u64)A11;
+	t_object_2e1742 = (u64)A12;
+	t_object_2e1746 = (u64)A13;
+	t_object_2e1762 = (u64)A14;
+	t_object_2e1766 = (u64)A15;
+	t_object_2e1782 = (u64)A16;
+	t_object_2e1786 = (u64)A17;
+	t_object_2e1802 = (u64)A18;
+	t_object_2e1806 = (u64)A19;
+	t_object_2e1822 = (u64)A20;
+	t_object_2e1826 = (u64)A21;
+	L_body_2e1636:;
+	*(u8 *)t_binding_2e1639 = (u8)((u64)1UL);
+	*(u8 *)t_binding_2e1640 = (u8)((u64)0UL);
+	t__2e1642 = ((u64)0UL);
+	*(u64 *)t_binding_2e1641 = (u64)t__2e1642;
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)120UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)10UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)4660UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)0UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)7UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)20UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)8UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)24UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)12UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)28UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)10UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)32UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)13UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)36UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)9UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)40UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)11UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)44UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)92UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)48UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)39UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)52UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)34UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)56UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)1193046UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)60UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)128UL);
+	t_item_2e1645 = (u64)((u64)t_binding_2e1643 + (u64)((u64)64UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)128UL);
+	*(u32 *)t_object_2e1648 = (u32)((u64)3532310079UL);
+	t__2e1649 = (u64)((u64)t_object_2e1648 + (u64)((u64)4UL));
+	*(u32 *)t__2e1649 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e1652 = (u64)((u64)0UL);
+	t__2e1653 = (u64)((u64)t_object_2e1652 + (u64)((u64)8UL));
+	*(u64 *)t__2e1653 = (u64)((u64)0UL);
+	t__2e1653 = (u64)((u64)t__2e1653 + (u64)((u64)8UL));
+	*(u64 *)t__2e1653 = (u64)((u64)0UL);
+	BLIT((u64)B22, t_object_2e1648, 8);
+	BLIT((u64)B23, ((u64)((char *)&D_strliteral_2e1651)), 24);
+	BLIT((u64)B24, t_object_2e1652, 24);
+	t__2e1647 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R25, (u64)B22, (u64)B23, (u64)B24);
+	t_tag_2e1654 = (u64)(*(u32 *)t__2e1647);
+	t__2e1662 = (u64)(u32)(((u32)t_tag_2e1654 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1662) goto L_member_2e1659; else goto L__2e1661;
+	L__2e1661:;
+	t__2e1664 = (u64)(u32)(((u32)t_tag_2e1654 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1664) goto L_member_2e1660; else goto L__2e1663;
+	L__2e1663:;
+	goto L_matches_2e1658;
+	L_member_2e1659:;
+	goto L_matches_2e1658;
+	L_member_2e1660:;
+	goto L_matches_2e1657;
+	L_matches_2e1657:;
+	goto L__2e1655;
+	L_matches_2e1658:;
+	t_abortsite_2e1666 = ((u64)0UL);
+	goto L_abort_2e1667;
+	L__2e1673:;
+	L__2e1656:;
+	t_abortsite_2e1666 = ((u64)1UL);
+	goto L_abort_2e1674;
+	L__2e1655:;
+	*(u32 *)t_object_2e1682 = (u32)((u64)3532310079UL);
+	t__2e1683 = (u64)((u64)t_object_2e1682 + (u64)((u64)4UL));
+	*(u32 *)t__2e1683 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e1686 = (u64)((u64)0UL);
+	t__2e1687 = (u64)((u64)t_object_2e1686 + (u64)((u64)8UL));
+	*(u64 *)t__2e1687 = (u64)((u64)0UL);
+	t__2e1687 = (u64)((u64)t__2e1687 + (u64)((u64)8UL));
+	*(u64 *)t__2e1687 = (u64)((u64)0UL);
+	BLIT((u64)B26, t_object_2e1682, 8);
+	BLIT((u64)B27, ((u64)((char *)&D_strliteral_2e1685)), 24);
+	BLIT((u64)B28, t_object_2e1686, 24);
+	t__2e1681 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R29, (u64)B26, (u64)B27, (u64)B28);
+	t_tag_2e1688 = (u64)(*(u32 *)t__2e1681);
+	t__2e1696 = (u64)(u32)(((u32)t_tag_2e1688 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1696) goto L_member_2e1693; else goto L__2e1695;
+	L__2e1695:;
+	t__2e1698 = (u64)(u32)(((u32)t_tag_2e1688 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1698) goto L_member_2e1694; else goto L__2e1697;
+	L__2e1697:;
+	goto L_matches_2e1692;
+	L_member_2e1693:;
+	goto L_matches_2e1692;
+	L_member_2e1694:;
+	goto L_matches_2e1691;
+	L_matches_2e1691:;
+	goto L__2e1689;
+	L_matches_2e1692:;
+	t_abortsite_2e1666 = ((u64)2UL);
+	goto L_abort_2e1667;
+	L__2e1699:;
+	L__2e1690:;
+	t_abortsite_2e1666 = ((u64)3UL);
+	goto L_abort_2e1674;
+	L__2e1689:;
+	*(u32 *)t_object_2e1702 = (u32)((u64)3532310079UL);
+	t__2e1703 = (u64)((u64)t_object_2e1702 + (u64)((u64)4UL));
+	*(u32 *)t__2e1703 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e1706 = (u64)((u64)0UL);
+	t__2e1707 = (u64)((u64)t_object_2e1706 + (u64)((u64)8UL));
+	*(u64 *)t__2e1707 = (u64)((u64)0UL);
+	t__2e1707 = (u64)((u64)t__2e1707 + (u64)((u64)8UL));
+	*(u64 *)t__2e1707 = (u64)((u64)0UL);
+	BLIT((u64)B30, t_object_2e1702, 8);
+	BLIT((u64)B31, ((u64)((char *)&D_strliteral_2e1705)), 24);
+	BLIT((u64)B32, t_object_2e1706, 24);
+	t__2e1701 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R33, (u64)B30, (u64)B31, (u64)B32);
+	t_tag_2e1708 = (u64)(*(u32 *)t__2e1701);
+	t__2e1716 = (u64)(u32)(((u32)t_tag_2e1708 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1716) goto L_member_2e1713; else goto L__2e1715;
+	L__2e1715:;
+	t__2e1718 = (u64)(u32)(((u32)t_tag_2e1708 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1718) goto L_member_2e1714; else goto L__2e1717;
+	L__2e1717:;
+	goto L_matches_2e1712;
+	L_member_2e1713:;
+	goto L_matches_2e1712;
+	L_member_2e1714:;
+	goto L_matches_2e1711;
+	L_matches_2e1711:;
+	goto L__2e1709;
+	L_matches_2e1712:;
+	t_abortsite_2e1666 = ((u64)4UL);
+	goto L_abort_2e1667;
+	L__2e1719:;
+	L__2e1710:;
+	t_abortsite_2e1666 = ((u64)5UL);
+	goto L_abort_2e1674;
+	L__2e1709:;
+	*(u32 *)t_object_2e1722 = (u32)((u64)3532310079UL);
+	t__2e1723 = (u64)((u64)t_object_2e1722 + (u64)((u64)4UL));
+	*(u32 *)t__2e1723 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e1726 = (u64)((u64)0UL);
+	t__2e1727 = (u64)((u64)t_object_2e1726 + (u64)((u64)8UL));
+	*(u64 *)t__2e1727 = (u64)((u64)0UL);
+	t__2e1727 = (u64)((u64)t__2e1727 + (u64)((u64)8UL));
+	*(u64 *)t__2e1727 = (u64)((u64)0UL);
+	BLIT((u64)B34, t_object_2e1722, 8);
+	BLIT((u64)B35, ((u64)((char *)&D_strliteral_2e1725)), 24);
+	BLIT((u64)B36, t_object_2e1726, 24);
+	t__2e1721 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R37, (u64)B34, (u64)B35, (u64)B36);
+	t_tag_2e1728 = (u64)(*(u32 *)t__2e1721);
+	t__2e1736 = (u64)(u32)(((u32)t_tag_2e1728 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1736) goto L_member_2e1733; else goto L__2e1735;
+	L__2e1735:;
+	t__2e1738 = (u64)(u32)(((u32)t_tag_2e1728 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1738) goto L_member_2e1734; else goto L__2e1737;
+	L__2e1737:;
+	goto L_matches_2e1732;
+	L_member_2e1733:;
+	goto L_matches_2e1732;
+	L_member_2e1734:;
+	goto L_matches_2e1731;
+	L_matches_2e1731:;
+	goto L__2e1729;
+	L_matches_2e1732:;
+	t_abortsite_2e1666 = ((u64)6UL);
+	goto L_abort_2e1667;
+	L__2e1739:;
+	L__2e1730:;
+	t_abortsite_2e1666 = ((u64)7UL);
+	goto L_abort_2e1674;
+	L__2e1729:;
+	*(u32 *)t_object_2e1742 = (u32)((u64)3532310079UL);
+	t__2e1743 = (u64)((u64)t_object_2e1742 + (u64)((u64)4UL));
+	*(u32 *)t__2e1743 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e1746 = (u64)((u64)0UL);
+	t__2e1747 = (u64)((u64)t_object_2e1746 + (u64)((u64)8UL));
+	*(u64 *)t__2e1747 = (u64)((u64)0UL);
+	t__2e1747 = (u64)((u64)t__2e1747 + (u64)((u64)8UL));
+	*(u64 *)t__2e1747 = (u64)((u64)0UL);
+	BLIT((u64)B38, t_object_2e1742, 8);
+	BLIT((u64)B39, ((u64)((char *)&D_strliteral_2e1745)), 24);
+	BLIT((u64)B40, t_object_2e1746, 24);
+	t__2e1741 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R41, (u64)B38, (u64)B39, (u64)B40);
+	t_tag_2e1748 = (u64)(*(u32 *)t__2e1741);
+	t__2e1756 = (u64)(u32)(((u32)t_tag_2e1748 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1756) goto L_member_2e1753; else goto L__2e1755;
+	L__2e1755:;
+	t__2e1758 = (u64)(u32)(((u32)t_tag_2e1748 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1758) goto L_member_2e1754; else goto L__2e1757;
+	L__2e1757:;
+	goto L_matches_2e1752;
+	L_member_2e1753:;
+	goto L_matches_2e1752;
+	L_member_2e1754:;
+	goto L_matches_2e1751;
+	L_matches_2e1751:;
+	goto L__2e1749;
+	L_matches_2e1752:;
+	t_abortsite_2e1666 = ((u64)8UL);
+	goto L_abort_2e1667;
+	L__2e1759:;
+	L__2e1750:;
+	t_abortsite_2e1666 = ((u64)9UL);
+	goto L_abort_2e1674;
+	L__2e1749:;
+	*(u32 *)t_object_2e1762 = (u32)((u64)3532310079UL);
+	t__2e1763 = (u64)((u64)t_object_2e1762 + (u64)((u64)4UL));
+	*(u32 *)t__2e1763 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e1766 = (u64)((u64)0UL);
+	t__2e1767 = (u64)((u64)t_object_2e1766 + (u64)((u64)8UL));
+	*(u64 *)t__2e1767 = (u64)((u64)0UL);
+	t__2e1767 = (u64)((u64)t__2e1767 + (u64)((u64)8UL));
+	*(u64 *)t__2e1767 = (u64)((u64)0UL);
+	BLIT((u64)B42, t_object_2e1762, 8);
+	BLIT((u64)B43, ((u64)((char *)&D_strliteral_2e1765)), 24);
+	BLIT((u64)B44, t_object_2e1766, 24);
+	t__2e1761 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R45, (u64)B42, (u64)B43, (u64)B44);
+	t_tag_2e1768 = (u64)(*(u32 *)t__2e1761);
+	t__2e1776 = (u64)(u32)(((u32)t_tag_2e1768 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1776) goto L_member_2e1773; else goto L__2e1775;
+	L__2e1775:;
+	t__2e1778 = (u64)(u32)(((u32)t_tag_2e1768 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1778) goto L_member_2e1774; else goto L__2e1777;
+	L__2e1777:;
+	goto L_matches_2e1772;
+	L_member_2e1773:;
+	goto L_matches_2e1772;
+	L_member_2e1774:;
+	goto L_matches_2e1771;
+	L_matches_2e1771:;
+	goto L__2e1769;
+	L_matches_2e1772:;
+	t_abortsite_2e1666 = ((u64)10UL);
+	goto L_abort_2e1667;
+	L__2e1779:;
+	L__2e1770:;
+	t_abortsite_2e1666 = ((u64)11UL);
+	goto L_abort_2e1674;
+	L__2e1769:;
+	*(u32 *)t_object_2e1782 = (u32)((u64)3532310079UL);
+	t__2e1783 = (u64)((u64)t_object_2e1782 + (u64)((u64)4UL));
+	*(u32 *)t__2e1783 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e1786 = (u64)((u64)0UL);
+	t__2e1787 = (u64)((u64)t_object_2e1786 + (u64)((u64)8UL));
+	*(u64 *)t__2e1787 = (u64)((u64)0UL);
+	t__2e1787 = (u64)((u64)t__2e1787 + (u64)((u64)8UL));
+	*(u64 *)t__2e1787 = (u64)((u64)0UL);
+	BLIT((u64)B46, t_object_2e1782, 8);
+	BLIT((u64)B47, ((u64)((char *)&D_strliteral_2e1785)), 24);
+	BLIT((u64)B48, t_object_2e1786, 24);
+	t__2e1781 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R49, (u64)B46, (u64)B47, (u64)B48);
+	t_tag_2e1788 = (u64)(*(u32 *)t__2e1781);
+	t__2e1796 = (u64)(u32)(((u32)t_tag_2e1788 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1796) goto L_member_2e1793; else goto L__2e1795;
+	L__2e1795:;
+	t__2e1798 = (u64)(u32)(((u32)t_tag_2e1788 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1798) goto L_member_2e1794; else goto L__2e1797;
+	L__2e1797:;
+	goto L_matches_2e1792;
+	L_member_2e1793:;
+	goto L_matches_2e1792;
+	L_member_2e1794:;
+	goto L_matches_2e1791;
+	L_matches_2e1791:;
+	goto L__2e1789;
+	L_matches_2e1792:;
+	t_abortsite_2e1666 = ((u64)12UL);
+	goto L_abort_2e1667;
+	L__2e1799:;
+	L__2e1790:;
+	t_abortsite_2e1666 = ((u64)13UL);
+	goto L_abort_2e1674;
+	L__2e1789:;
+	*(u32 *)t_object_2e1802 = (u32)((u64)3532310079UL);
+	t__2e1803 = (u64)((u64)t_object_2e1802 + (u64)((u64)4UL));
+	*(u32 *)t__2e1803 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e1806 = (u64)((u64)0UL);
+	t__2e1807 = (u64)((u64)t_object_2e1806 + (u64)((u64)8UL));
+	*(u64 *)t__2e1807 = (u64)((u64)0UL);
+	t__2e1807 = (u64)((u64)t__2e1807 + (u64)((u64)8UL));
+	*(u64 *)t__2e1807 = (u64)((u64)0UL);
+	BLIT((u64)B50, t_object_2e1802, 8);
+	BLIT((u64)B51, ((u64)((char *)&D_strliteral_2e1805)), 24);
+	BLIT((u64)B52, t_object_2e1806, 24);
+	t__2e1801 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R53, (u64)B50, (u64)B51, (u64)B52);
+	t_tag_2e1808 = (u64)(*(u32 *)t__2e1801);
+	t__2e1816 = (u64)(u32)(((u32)t_tag_2e1808 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1816) goto L_member_2e1813; else goto L__2e1815;
+	L__2e1815:;
+	t__2e1818 = (u64)(u32)(((u32)t_tag_2e1808 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1818) goto L_member_2e1814; else goto L__2e1817;
+	L__2e1817:;
+	goto L_matches_2e1812;
+	L_member_2e1813:;
+	goto L_matches_2e1812;
+	L_member_2e1814:;
+	goto L_matches_2e1811;
+	L_matches_2e1811:;
+	goto L__2e1809;
+	L_matches_2e1812:;
+	t_abortsite_2e1666 = ((u64)14UL);
+	goto L_abort_2e1667;
+	L__2e1819:;
+	L__2e1810:;
+	t_abortsite_2e1666 = ((u64)15UL);
+	goto L_abort_2e1674;
+	L__2e1809:;
+	*(u32 *)t_object_2e1822 = (u32)((u64)3532310079UL);
+	t__2e1823 = (u64)((u64)t_object_2e1822 + (u64)((u64)4UL));
+	*(u32 *)t__2e1823 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e1826 = (u64)((u64)0UL);
+	t__2e1827 = (u64)((u64)t_object_2e1826 + (u64)((u64)8UL));
+	*(u64 *)t__2e1827 = (u64)((u64)0UL);
+	t__2e1827 = (u64)((u64)t__2e1827 + (u64)((u64)8UL));
+	*(u64 *)t__2e1827 = (u64)((u64)0UL);
+	BLIT((u64)B54, t_object_2e1822, 8);
+	BLIT((u64)B55, ((u64)((char *)&D_strliteral_2e1825)), 24);
+	BLIT((u64)B56, t_object_2e1826, 24);
+	t__2e1821 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R57, (u64)B54, (u64)B55, (u64)B56);
+	t_tag_2e1828 = (u64)(*(u32 *)t__2e1821);
+	t__2e1836 = (u64)(u32)(((u32)t_tag_2e1828 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1836) goto L_member_2e1833; else goto L__2e1835;
+	L__2e1835:;
+	t__2e1838 = (u64)(u32)(((u32)t_tag_2e1828 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1838) goto L_member_2e1834; else goto L__2e1837;
+	L__2e1837:;
+	goto L_matches_2e1832;
+	L_member_2e1833:;
+	goto L_matches_2e1832;
+	L_member_2e1834:;
+	goto L_matches_2e1831;
+	L_matches_2e1831:;
+	goto L__2e1829;
+	L_matches_2e1832:;
+	t_abortsite_2e1666 = ((u64)16UL);
+	goto L_abort_2e1667;
+	L__2e1839:;
+	L__2e1830:;
+	t_abortsite_2e1666 = ((u64)17UL);
+	goto L_abort_2e1674;
+	L__2e1829:;
+	goto L__2e1637;
+	L__2e1840:;
+	L__2e1637:;
+	return;
+	L_abort_2e1667:;
+	t__2e1668 = (u64)((u64)t_abortsite_2e1666 * (u64)((u64)16UL));
+	t__2e1668 = (u64)((u64)((u64)((char *)&D_abortsites_2e1665)) + (u64)t__2e1668);
+	t__2e1669 = (u64)(*(u64 *)t__2e1668);
+	t__2e1670 = (u64)((u64)t__2e1668 + (u64)((u64)8UL));
+	t__2e1671 = (u64)(*(u32 *)t__2e1670);
+	t__2e1670 = (u64)((u64)t__2e1668 + (u64)((u64)12UL));
+	t__2e1672 = (u64)(*(u32 *)t__2e1670);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1669, (u64)t__2e1671, (u64)t__2e1672, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e1674:;
+	t__2e1675 = (u64)((u64)t_abortsite_2e1666 * (u64)((u64)16UL));
+	t__2e1675 = (u64)((u64)((u64)((char *)&D_abortsites_2e1665)) + (u64)t__2e1675);
+	t__2e1676 = (u64)(*(u64 *)t__2e1675);
+	t__2e1677 = (u64)((u64)t__2e1675 + (u64)((u64)8UL));
+	t__2e1678 = (u64)(*(u32 *)t__2e1677);
+	t__2e1677 = (u64)((u64)t__2e1675 + (u64)((u64)12UL));
+	t__2e1679 = (u64)(*(u32 *)t__2e1677);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1676, (u64)t__2e1678, (u64)t__2e1679, (u64)((u64)4UL));
+	__builtin_trap();
+}
@@ -0,0 +1,2194 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e22 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e23 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e58 { u8 f0[46]; };
+struct __attribute__((packed)) S_strliteral_2e59 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e78 { u8 f0[41]; };
+struct __attribute__((packed)) S_strliteral_2e79 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e98 { u8 f0[29]; };
+struct __attribute__((packed)) S_strliteral_2e99 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e39 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; };
+struct __attribute__((packed)) S_static_2e4 { u32 f0; u32 f1; };
+struct __attribute__((packed)) S_abortsites_2e154 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e210 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; };
+struct __attribute__((packed)) S_abortsites_2e361 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e418 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_strdata_2e527 { u8 f0; u8 f1; u8 f2; u8 f3[25]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[28]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[16]; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18; u8 f19[23]; u8 f20; u8 f21; u8 f22; u8 f23; u8 f24[9]; u8 f25; u8 f26; u8 f27; u8 f28[2]; u8 f29; u8 f30; };
+struct __attribute__((packed)) S_strliteral_2e528 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e559 { u8 f0; u8 f1; u8 f2; u8 f3[25]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[30]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[17]; u8 f14; u8 f15[1]; u8 f16; u8 f17[2]; u8 f18; u8 f19[1]; u8 f20; u8 f21[2]; u8 f22; u8 f23[1]; u8 f24; u8 f25[2]; u8 f26; u8 f27; u8 f28; u8 f29; u8 f30[7]; u8 f31; u8 f32; u8 f33; u8 f34[2]; u8 f35; u8 f36; };
+struct __attribute__((packed)) S_strliteral_2e560 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e579 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[21]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[18]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e580 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e481 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; };
+struct __attribute__((packed)) S_abortsites_2e613 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e649 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; };
+struct __attribute__((packed)) S_strdata_2e861 { u8 f0; u8 f1; u8 f2; u8 f3[25]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[18]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[5]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e862 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e733 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e22 D_strdata_2e22 __asm__("strdata.22") __attribute__((used, section(".rodata.strdata.22"), aligned(8)));
+static struct S_strliteral_2e23 D_strliteral_2e23 __asm__("strliteral.23") __attribute__((used, section(".data.rel.ro.strliteral.23"), aligned(8)));
+static const struct S_strdata_2e58 D_strdata_2e58 __asm__("strdata.58") __attribute__((used, section(".rodata.strdata.58"), aligned(8)));
+static struct S_strliteral_2e59 D_strliteral_2e59 __asm__("strliteral.59") __attribute__((used, section(".data.rel.ro.strliteral.59"), aligned(8)));
+static const struct S_strdata_2e78 D_strdata_2e78 __asm__("strdata.78") __attribute__((used, section(".rodata.strdata.78"), aligned(8)));
+static struct S_strliteral_2e79 D_strliteral_2e79 __asm__("strliteral.79") __attribute__((used, section(".data.rel.ro.strliteral.79"), aligned(8)));
+static const struct S_strdata_2e98 D_strdata_2e98 __asm__("strdata.98") __attribute__((used, section(".rodata.strdata.98"), aligned(8)));
+static struct S_strliteral_2e99 D_strliteral_2e99 __asm__("strliteral.99") __attribute__((used, section(".data.rel.ro.strliteral.99"), aligned(8)));
+static struct S_abortsites_2e39 D_abortsites_2e39 __asm__("abortsites.39") __attribute__((used, section(".data.rel.ro.abortsites.39"), aligned(8)));
+static struct S_static_2e4 D_static_2e4 __asm__("static.4") __attribute__((used, section(".data.static.4"), aligned(8)));
+static struct S_abortsites_2e154 D_abortsites_2e154 __asm__("abortsites.154") __attribute__((used, section(".data.rel.ro.abortsites.154"), aligned(8)));
+static struct S_abortsites_2e210 D_abortsites_2e210 __asm__("abortsites.210") __attribute__((used, section(".data.rel.ro.abortsites.210"), aligned(8)));
+static struct S_abortsites_2e361 D_abortsites_2e361 __asm__("abortsites.361") __attribute__((used, section(".data.rel.ro.abortsites.361"), aligned(8)));
+static struct S_abortsites_2e418 D_abortsites_2e418 __asm__("abortsites.418") __attribute__((used, section(".data.rel.ro.abortsites.418"), aligned(8)));
+static const struct S_strdata_2e527 D_strdata_2e527 __asm__("strdata.527") __attribute__((used, section(".rodata.strdata.527"), aligned(8)));
+static struct S_strliteral_2e528 D_strliteral_2e528 __asm__("strliteral.528") __attribute__((used, section(".data.rel.ro.strliteral.528"), aligned(8)));
+static const struct S_strdata_2e559 D_strdata_2e559 __asm__("strdata.559") __attribute__((used, section(".rodata.strdata.559"), aligned(8)));
+static struct S_strliteral_2e560 D_strliteral_2e560 __asm__("strliteral.560") __attribute__((used, section(".data.rel.ro.strliteral.560"), aligned(8)));
+static const struct S_strdata_2e579 D_strdata_2e579 __asm__("strdata.579") __attribute__((used, section(".rodata.strdata.579"), aligned(8)));
+static struct S_strliteral_2e580 D_strliteral_2e580 __asm__("strliteral.580") __attribute__((used, section(".data.rel.ro.strliteral.580"), aligned(8)));
+static struct S_abortsites_2e481 D_abortsites_2e481 __asm__("abortsites.481") __attribute__((used, section(".data.rel.ro.abortsites.481"), aligned(8)));
+static struct S_abortsites_2e613 D_abortsites_2e613 __asm__("abortsites.613") __attribute__((used, section(".data.rel.ro.abortsites.613"), aligned(8)));
+static struct S_abortsites_2e649 D_abortsites_2e649 __asm__("abortsites.649") __attribute__((used, section(".data.rel.ro.abortsites.649"), aligned(8)));
+static const struct S_strdata_2e861 D_strdata_2e861 __asm__("strdata.861") __attribute__((used, section(".rodata.strdata.861"), aligned(8)));
+static struct S_strliteral_2e862 D_strliteral_2e862 __asm__("strliteral.862") __attribute__((used, section(".data.rel.ro.strliteral.862"), aligned(8)));
+static struct S_abortsites_2e733 D_abortsites_2e733 __asm__("abortsites.733") __attribute__((used, section(".data.rel.ro.abortsites.733"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_eval__access(void) __asm__("eval_access") __attribute__((used, section(".text.eval_access")));
+static void F_eval__array(void) __asm__("eval_array") __attribute__((used, section(".text.eval_array")));
+static void F_extype(void) __asm__("extype") __attribute__((used, section(".text.extype")));
+static void F_expanded(void) __asm__("expanded") __attribute__((used, section(".text.expanded")));
+static void F_nested(void) __asm__("nested") __attribute__((used, section(".text.nested")));
+static void F_param(u64 p_x) __asm__("param") __attribute__((used, section(".text.param")));
+static void F_assignment(void) __asm__("assignment") __attribute__((used, section(".text.assignment")));
+static void F_storage(void) __asm__("storage") __attribute__((used, section(".text.storage")));
+static void F_measurements(void) __asm__("measurements") __attribute__((used, section(".text.measurements")));
+static void F_indexing(void) __asm__("indexing") __attribute__((used, section(".text.indexing")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\060\061\055\141\162\162\141\171\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 18U, 18U };
+static const struct S_strdata_2e22 D_strdata_2e22 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\156\165\154\154\072\040\052\133\052\135\133\052\135\151\156\164\073\040\175\073" };
+static struct S_strliteral_2e23 D_strliteral_2e23 = { (char *)((char *)&D_strdata_2e22) + 0, 44U, 44U };
+static const struct S_strdata_2e58 D_strdata_2e58 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\156\165\154\154\072\040\052\133\052\135\146\156\040\050\051\151\156\164\073\040\175\073" };
+static struct S_strliteral_2e59 D_strliteral_2e59 = { (char *)((char *)&D_strdata_2e58) + 0, 46U, 46U };
+static const struct S_strdata_2e78 D_strdata_2e78 = { "\154\145\164\040\170\072\040\133\052\135\151\156\164\073\040\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\170\040\075\040\133\135\073\040\175\073" };
+static struct S_strliteral_2e79 D_strliteral_2e79 = { (char *)((char *)&D_strdata_2e78) + 0, 41U, 41U };
+static const struct S_strdata_2e98 D_strdata_2e98 = { "\154\145\164\040\170\072\040\133\135\151\156\164\073\040\154\145\164\040\171\040\075\040\154\145\156\050\170\051\073" };
+static struct S_strliteral_2e99 D_strliteral_2e99 = { (char *)((char *)&D_strdata_2e98) + 0, 29U, 29U };
+static struct S_abortsites_2e39 D_abortsites_2e39 = { (char *)((char *)&D_strliteral_2e1) + 0, 173U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 173U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 174U, 82U, (char *)((char *)&D_strliteral_2e1) + 0, 174U, 82U, (char *)((char *)&D_strliteral_2e1) + 0, 177U, 77U, (char *)((char *)&D_strliteral_2e1) + 0, 177U, 77U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 65U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 65U };
+static struct S_static_2e4 D_static_2e4 = { 1U, 2U };
+static struct S_abortsites_2e154 D_abortsites_2e154 = { (char *)((char *)&D_strliteral_2e1) + 0, 156U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 159U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 160U, 15U };
+static struct S_abortsites_2e210 D_abortsites_2e210 = { (char *)((char *)&D_strliteral_2e1) + 0, 126U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 140U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 146U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 149U, 23U };
+static struct S_abortsites_2e361 D_abortsites_2e361 = { (char *)((char *)&D_strliteral_2e1) + 0, 116U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 117U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 118U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 120U, 15U };
+static struct S_abortsites_2e418 D_abortsites_2e418 = { (char *)((char *)&D_strliteral_2e1) + 0, 108U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 109U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 111U, 15U };
+static const struct S_strdata_2e527 D_strdata_2e527 = { 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\133\063\135\165\151\156\164\040\075\040\133\061\165\054\062\165\054\063\165\135\073", 10U, 9U, 9U, 9U, "\154\145\164\040\142\072\040\165\151\156\164\040\075\040\060\073", 10U, 10U, 9U, 9U, 9U, "\154\145\164\040\160\164\162\072\040\052\133\063\135\165\151\156\164\040\075\040\046\141\073", 10U, 9U, 9U, 9U, "\160\164\162\040\075\040\046\142\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e528 D_strliteral_2e528 = { (char *)((char *)&D_strdata_2e527) + 0, 128U, 128U };
+static const struct S_strdata_2e559 D_strdata_2e559 = { 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\052\133\052\135\165\151\156\164\040\075\040\046\133\061\165\054\062\165\054\063\165\135\073", 10U, 9U, 9U, 9U, "\154\145\164\040\142\072\040\133\063\135\163\164\162\040\075\040\133", 34U, "\141", 34U, "\054\040", 34U, "\142", 34U, "\054\040", 34U, "\143", 34U, "\135\073", 10U, 9U, 9U, 9U, "\141\040\075\040\046\142\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e560 D_strliteral_2e560 = { (char *)((char *)&D_strdata_2e559) + 0, 116U, 116U };
+static const struct S_strdata_2e579 D_strdata_2e579 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\133\061\165\054\040\062\165\054\040\063\165\135\073", 10U, 9U, 9U, 9U, "\141\040\053\075\040\133\063\165\054\040\062\165\054\040\061\165\135\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e580 D_strliteral_2e580 = { (char *)((char *)&D_strdata_2e579) + 0, 72U, 72U };
+static struct S_abortsites_2e481 D_abortsites_2e481 = { (char *)((char *)&D_strliteral_2e1) + 0, 76U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 77U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 78U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 97U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 97U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 12U };
+static struct S_abortsites_2e613 D_abortsites_2e613 = { (char *)((char *)&D_strliteral_2e1) + 0, 64U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 65U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 66U, 15U };
+static struct S_abortsites_2e649 D_abortsites_2e649 = { (char *)((char *)&D_strliteral_2e1) + 0, 33U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 34U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 35U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 46U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 48U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 49U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 50U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 53U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 54U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 55U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 56U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 58U, 15U };
+static const struct S_strdata_2e861 D_strdata_2e861 = { 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\133\061\054\040\062\054\040\063\135\073", 10U, 9U, 9U, 9U, "\141\133\063\135\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e862 D_strliteral_2e862 = { (char *)((char *)&D_strdata_2e861) + 0, 66U, 66U };
+static struct S_abortsites_2e733 D_abortsites_2e733 = { (char *)((char *)&D_strliteral_2e1) + 0, 7U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 8U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 14U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 15U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 26U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 26U, 12U };
+void F_main(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char B1[12] __attribute__((aligned(16)));
+	u64 t_item_2e8;
+	u64 t_object_2e6;
+	L_start_2e2:;
+	t_object_2e6 = (u64)A0;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_indexing)))();
+	((void (*)(void))((u64)((char *)&F_measurements)))();
+	((void (*)(void))((u64)((char *)&F_storage)))();
+	((void (*)(void))((u64)((char *)&F_assignment)))();
+	t_item_2e8 = (u64)((u64)t_object_2e6 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e8 = (u32)((u64)1UL);
+	t_item_2e8 = (u64)((u64)t_object_2e6 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e8 = (u32)((u64)2UL);
+	t_item_2e8 = (u64)((u64)t_object_2e6 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e8 = (u32)((u64)3UL);
+	BLIT((u64)B1, t_object_2e6, 12);
+	((void (*)(u64))((u64)((char *)&F_param)))((u64)B1);
+	((void (*)(void))((u64)((char *)&F_nested)))();
+	((void (*)(void))((u64)((char *)&F_expanded)))();
+	((void (*)(void))((u64)((char *)&F_extype)))();
+	((void (*)(void))((u64)((char *)&F_eval__array)))();
+	((void (*)(void))((u64)((char *)&F_eval__access)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	goto L__2e4;
+	L__2e9:;
+	L__2e4:;
+	return;
+}
+static void F_reject(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char B8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[4] __attribute__((aligned(16)));
+	char B12[8] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char R15[4] __attribute__((aligned(16)));
+	char B16[8] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char R19[4] __attribute__((aligned(16)));
+	char B20[8] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char R23[4] __attribute__((aligned(16)));
+	u64 t__2e101;
+	u64 t__2e110;
+	u64 t__2e112;
+	u64 t__2e15;
+	u64 t__2e21;
+	u64 t__2e27;
+	u64 t__2e36;
+	u64 t__2e38;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e44;
+	u64 t__2e45;
+	u64 t__2e46;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e55;
+	u64 t__2e57;
+	u64 t__2e61;
+	u64 t__2e70;
+	u64 t__2e72;
+	u64 t__2e75;
+	u64 t__2e77;
+	u64 t__2e81;
+	u64 t__2e90;
+	u64 t__2e92;
+	u64 t__2e95;
+	u64 t__2e97;
+	u64 t_abortsite_2e40;
+	u64 t_object_2e100;
+	u64 t_object_2e17;
+	u64 t_object_2e25;
+	u64 t_object_2e56;
+	u64 t_object_2e60;
+	u64 t_object_2e76;
+	u64 t_object_2e80;
+	u64 t_object_2e96;
+	u64 t_tag_2e102;
+	u64 t_tag_2e28;
+	u64 t_tag_2e62;
+	u64 t_tag_2e82;
+	L_start_2e10:;
+	t_object_2e17 = (u64)A0;
+	t_object_2e25 = (u64)A1;
+	t_object_2e56 = (u64)A2;
+	t_object_2e60 = (u64)A3;
+	t_object_2e76 = (u64)A4;
+	t_object_2e80 = (u64)A5;
+	t_object_2e96 = (u64)A6;
+	t_object_2e100 = (u64)A7;
+	L_body_2e11:;
+	*(u32 *)t_object_2e17 = (u32)((u64)3532310079UL);
+	t__2e21 = (u64)((u64)t_object_2e17 + (u64)((u64)4UL));
+	*(u32 *)t__2e21 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e25 = (u64)((u64)0UL);
+	t__2e27 = (u64)((u64)t_object_2e25 + (u64)((u64)8UL));
+	*(u64 *)t__2e27 = (u64)((u64)0UL);
+	t__2e27 = (u64)((u64)t__2e27 + (u64)((u64)8UL));
+	*(u64 *)t__2e27 = (u64)((u64)0UL);
+	BLIT((u64)B8, t_object_2e17, 8);
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e23)), 24);
+	BLIT((u64)B10, t_object_2e25, 24);
+	t__2e15 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R11, (u64)B8, (u64)B9, (u64)B10);
+	t_tag_2e28 = (u64)(*(u32 *)t__2e15);
+	t__2e36 = (u64)(u32)(((u32)t_tag_2e28 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e36) goto L_member_2e33; else goto L__2e35;
+	L__2e35:;
+	t__2e38 = (u64)(u32)(((u32)t_tag_2e28 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e38) goto L_member_2e34; else goto L__2e37;
+	L__2e37:;
+	goto L_matches_2e32;
+	L_member_2e33:;
+	goto L_matches_2e32;
+	L_member_2e34:;
+	goto L_matches_2e31;
+	L_matches_2e31:;
+	goto L__2e29;
+	L_matches_2e32:;
+	t_abortsite_2e40 = ((u64)0UL);
+	goto L_abort_2e41;
+	L__2e47:;
+	L__2e30:;
+	t_abortsite_2e40 = ((u64)1UL);
+	goto L_abort_2e48;
+	L__2e29:;
+	*(u32 *)t_object_2e56 = (u32)((u64)3532310079UL);
+	t__2e57 = (u64)((u64)t_object_2e56 + (u64)((u64)4UL));
+	*(u32 *)t__2e57 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e60 = (u64)((u64)0UL);
+	t__2e61 = (u64)((u64)t_object_2e60 + (u64)((u64)8UL));
+	*(u64 *)t__2e61 = (u64)((u64)0UL);
+	t__2e61 = (u64)((u64)t__2e61 + (u64)((u64)8UL));
+	*(u64 *)t__2e61 = (u64)((u64)0UL);
+	BLIT((u64)B12, t_object_2e56, 8);
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e59)), 24);
+	BLIT((u64)B14, t_object_2e60, 24);
+	t__2e55 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R15, (u64)B12, (u64)B13, (u64)B14);
+	t_tag_2e62 = (u64)(*(u32 *)t__2e55);
+	t__2e70 = (u64)(u32)(((u32)t_tag_2e62 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e70) goto L_member_2e67; else goto L__2e69;
+	L__2e69:;
+	t__2e72 = (u64)(u32)(((u32)t_tag_2e62 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e72) goto L_member_2e68; else goto L__2e71;
+	L__2e71:;
+	goto L_matches_2e66;
+	L_member_2e67:;
+	goto L_matches_2e66;
+	L_member_2e68:;
+	goto L_matches_2e65;
+	L_matches_2e65:;
+	goto L__2e63;
+	L_matches_2e66:;
+	t_abortsite_2e40 = ((u64)2UL);
+	goto L_abort_2e41;
+	L__2e73:;
+	L__2e64:;
+	t_abortsite_2e40 = ((u64)3UL);
+	goto L_abort_2e48;
+	L__2e63:;
+	*(u32 *)t_object_2e76 = (u32)((u64)3532310079UL);
+	t__2e77 = (u64)((u64)t_object_2e76 + (u64)((u64)4UL));
+	*(u32 *)t__2e77 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e80 = (u64)((u64)0UL);
+	t__2e81 = (u64)((u64)t_object_2e80 + (u64)((u64)8UL));
+	*(u64 *)t__2e81 = (u64)((u64)0UL);
+	t__2e81 = (u64)((u64)t__2e81 + (u64)((u64)8UL));
+	*(u64 *)t__2e81 = (u64)((u64)0UL);
+	BLIT((u64)B16, t_object_2e76, 8);
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e79)), 24);
+	BLIT((u64)B18, t_object_2e80, 24);
+	t__2e75 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R19, (u64)B16, (u64)B17, (u64)B18);
+	t_tag_2e82 = (u64)(*(u32 *)t__2e75);
+	t__2e90 = (u64)(u32)(((u32)t_tag_2e82 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e90) goto L_member_2e87; else goto L__2e89;
+	L__2e89:;
+	t__2e92 = (u64)(u32)(((u32)t_tag_2e82 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e92) goto L_member_2e88; else goto L__2e91;
+	L__2e91:;
+	goto L_matches_2e86;
+	L_member_2e87:;
+	goto L_matches_2e86;
+	L_member_2e88:;
+	goto L_matches_2e85;
+	L_matches_2e85:;
+	goto L__2e83;
+	L_matches_2e86:;
+	t_abortsite_2e40 = ((u64)4UL);
+	goto L_abort_2e41;
+	L__2e93:;
+	L__2e84:;
+	t_abortsite_2e40 = ((u64)5UL);
+	goto L_abort_2e48;
+	L__2e83:;
+	*(u32 *)t_object_2e96 = (u32)((u64)3532310079UL);
+	t__2e97 = (u64)((u64)t_object_2e96 + (u64)((u64)4UL));
+	*(u32 *)t__2e97 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e100 = (u64)((u64)0UL);
+	t__2e101 = (u64)((u64)t_object_2e100 + (u64)((u64)8UL));
+	*(u64 *)t__2e101 = (u64)((u64)0UL);
+	t__2e101 = (u64)((u64)t__2e101 + (u64)((u64)8UL));
+	*(u64 *)t__2e101 = (u64)((u64)0UL);
+	BLIT((u64)B20, t_object_2e96, 8);
+	BLIT((u64)B21, ((u64)((char *)&D_strliteral_2e99)), 24);
+	BLIT((u64)B22, t_object_2e100, 24);
+	t__2e95 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R23, (u64)B20, (u64)B21, (u64)B22);
+	t_tag_2e102 = (u64)(*(u32 *)t__2e95);
+	t__2e110 = (u64)(u32)(((u32)t_tag_2e102 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e110) goto L_member_2e107; else goto L__2e109;
+	L__2e109:;
+	t__2e112 = (u64)(u32)(((u32)t_tag_2e102 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e112) goto L_member_2e108; else goto L__2e111;
+	L__2e111:;
+	goto L_matches_2e106;
+	L_member_2e107:;
+	goto L_matches_2e106;
+	L_member_2e108:;
+	goto L_matches_2e105;
+	L_matches_2e105:;
+	goto L__2e103;
+	L_matches_2e106:;
+	t_abortsite_2e40 = ((u64)6UL);
+	goto L_abort_2e41;
+	L__2e113:;
+	L__2e104:;
+	t_abortsite_2e40 = ((u64)7UL);
+	goto L_abort_2e48;
+	L__2e103:;
+	goto L__2e12;
+	L__2e114:;
+	L__2e12:;
+	return;
+	L_abort_2e41:;
+	t__2e42 = (u64)((u64)t_abortsite_2e40 * (u64)((u64)16UL));
+	t__2e42 = (u64)((u64)((u64)((char *)&D_abortsites_2e39)) + (u64)t__2e42);
+	t__2e43 = (u64)(*(u64 *)t__2e42);
+	t__2e44 = (u64)((u64)t__2e42 + (u64)((u64)8UL));
+	t__2e45 = (u64)(*(u32 *)t__2e44);
+	t__2e44 = (u64)((u64)t__2e42 + (u64)((u64)12UL));
+	t__2e46 = (u64)(*(u32 *)t__2e44);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e43, (u64)t__2e45, (u64)t__2e46, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e48:;
+	t__2e49 = (u64)((u64)t_abortsite_2e40 * (u64)((u64)16UL));
+	t__2e49 = (u64)((u64)((u64)((char *)&D_abortsites_2e39)) + (u64)t__2e49);
+	t__2e50 = (u64)(*(u64 *)t__2e49);
+	t__2e51 = (u64)((u64)t__2e49 + (u64)((u64)8UL));
+	t__2e52 = (u64)(*(u32 *)t__2e51);
+	t__2e51 = (u64)((u64)t__2e49 + (u64)((u64)12UL));
+	t__2e53 = (u64)(*(u32 *)t__2e51);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e50, (u64)t__2e52, (u64)t__2e53, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_eval__access(void) {
+	L_start_2e115:;
+	L_body_2e116:;
+	goto L__2e117;
+	L__2e119:;
+	L__2e117:;
+	return;
+}
+static void F_eval__array(void) {
+	L_start_2e120:;
+	L_body_2e121:;
+	goto L__2e122;
+	L__2e124:;
+	L__2e122:;
+	return;
+}
+static void F_extype(void) {
+	char A0[5] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e132;
+	u64 t__2e133;
+	u64 t__2e135;
+	u64 t__2e142;
+	u64 t__2e143;
+	u64 t__2e148;
+	u64 t__2e149;
+	u64 t__2e150;
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e159;
+	u64 t__2e160;
+	u64 t__2e161;
+	u64 t__2e163;
+	u64 t__2e164;
+	u64 t__2e165;
+	u64 t__2e168;
+	u64 t__2e169;
+	u64 t__2e170;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t__2e173;
+	u64 t__2e176;
+	u64 t__2e177;
+	u64 t__2e178;
+	u64 t__2e179;
+	u64 t__2e180;
+	u64 t__2e181;
+	u64 t_abortsite_2e155;
+	u64 t_binding_2e129;
+	u64 t_binding_2e141;
+	u64 t_item_2e131;
+	u64 t_item_2e134;
+	L_start_2e125:;
+	t_binding_2e129 = (u64)A0;
+	t_binding_2e141 = (u64)A1;
+	L_body_2e126:;
+	t_item_2e131 = (u64)((u64)t_binding_2e129 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e131 = (u8)((u64)42UL);
+	t__2e132 = (u64)((u64)t_binding_2e129 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e132, (u64)t_item_2e131, (u64)((u64)4UL));
+	t_item_2e134 = (u64)((u64)t_binding_2e129 + (u64)((u64)0UL));
+	t__2e135 = (u64)(u32)(*(u8 *)t_item_2e134);
+	t__2e133 = (u64)((u64)t_binding_2e129 + (u64)((u64)1UL));
+	*(u8 *)t__2e133 = (u8)t__2e135;
+	t__2e133 = (u64)((u64)t_binding_2e129 + (u64)((u64)2UL));
+	*(u8 *)t__2e133 = (u8)t__2e135;
+	t__2e133 = (u64)((u64)t_binding_2e129 + (u64)((u64)3UL));
+	*(u8 *)t__2e133 = (u8)t__2e135;
+	t__2e133 = (u64)((u64)t_binding_2e129 + (u64)((u64)4UL));
+	*(u8 *)t__2e133 = (u8)t__2e135;
+	*(u64 *)t_binding_2e141 = (u64)((u64)0UL);
+	L_loop_2e136:;
+	t__2e143 = (u64)(*(u64 *)t_binding_2e141);
+	t__2e142 = (u64)(u32)(((u64)t__2e143 < (u64)((u64)5UL)));
+	if ((u32)t__2e142) goto L_body_2e137; else goto L__2e139;
+	L_body_2e137:;
+	t__2e150 = (u64)(*(u64 *)t_binding_2e141);
+	t__2e149 = (u64)((u64)t__2e150 * (u64)((u64)1UL));
+	t__2e149 = (u64)((u64)t_binding_2e129 + (u64)t__2e149);
+	t__2e151 = (u64)(u32)(*(u8 *)t__2e149);
+	t__2e152 = (u64)(u32)((u8)t__2e151);
+	t__2e153 = (u64)(u32)((u8)((u64)42UL));
+	t__2e148 = (u64)(u32)(((u32)t__2e152 == (u32)t__2e153));
+	if ((u32)t__2e148) goto L_passed_2e147; else goto L_failed_2e146;
+	L_failed_2e146:;
+	t_abortsite_2e155 = ((u64)0UL);
+	goto L_abort_2e156;
+	L_passed_2e147:;
+	goto L__2e144;
+	L__2e162:;
+	L__2e144:;
+	L_after_2e140:;
+	t__2e163 = (u64)(*(u64 *)t_binding_2e141);
+	t__2e163 = (u64)((u64)t__2e163 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e141 = (u64)t__2e163;
+	goto L_loop_2e136;
+	L__2e139:;
+	t__2e165 = (u64)((i64)(i32)((u64)0UL));
+	t__2e164 = (u64)((u64)t__2e165 * (u64)((u64)1UL));
+	t__2e164 = (u64)((u64)t_binding_2e129 + (u64)t__2e164);
+	*(u8 *)t__2e164 = (u8)((u64)24UL);
+	t__2e170 = (u64)((i64)(i32)((u64)0UL));
+	t__2e169 = (u64)((u64)t__2e170 * (u64)((u64)1UL));
+	t__2e169 = (u64)((u64)t_binding_2e129 + (u64)t__2e169);
+	t__2e171 = (u64)(u32)(*(u8 *)t__2e169);
+	t__2e172 = (u64)(u32)((u8)t__2e171);
+	t__2e173 = (u64)(u32)((u8)((u64)24UL));
+	t__2e168 = (u64)(u32)(((u32)t__2e172 == (u32)t__2e173));
+	if ((u32)t__2e168) goto L_passed_2e167; else goto L_failed_2e166;
+	L_failed_2e166:;
+	t_abortsite_2e155 = ((u64)1UL);
+	goto L_abort_2e156;
+	L_passed_2e167:;
+	t__2e178 = (u64)((i64)(i32)((u64)1UL));
+	t__2e177 = (u64)((u64)t__2e178 * (u64)((u64)1UL));
+	t__2e177 = (u64)((u64)t_binding_2e129 + (u64)t__2e177);
+	t__2e179 = (u64)(u32)(*(u8 *)t__2e177);
+	t__2e180 = (u64)(u32)((u8)t__2e179);
+	t__2e181 = (u64)(u32)((u8)((u64)42UL));
+	t__2e176 = (u64)(u32)(((u32)t__2e180 == (u32)t__2e181));
+	if ((u32)t__2e176) goto L_passed_2e175; else goto L_failed_2e174;
+	L_failed_2e174:;
+	t_abortsite_2e155 = ((u64)2UL);
+	goto L_abort_2e156;
+	L_passed_2e175:;
+	goto L__2e127;
+	L__2e182:;
+	L__2e127:;
+	return;
+	L_abort_2e156:;
+	t__2e157 = (u64)((u64)t_abortsite_2e155 * (u64)((u64)16UL));
+	t__2e157 = (u64)((u64)((u64)((char *)&D_abortsites_2e154)) + (u64)t__2e157);
+	t__2e158 = (u64)(*(u64 *)t__2e157);
+	t__2e159 = (u64)((u64)t__2e157 + (u64)((u64)8UL));
+	t__2e160 = (u64)(*(u32 *)t__2e159);
+	t__2e159 = (u64)((u64)t__2e157 + (u64)((u64)12UL));
+	t__2e161 = (u64)(*(u32 *)t__2e159);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e158, (u64)t__2e160, (u64)t__2e161, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_expanded(void) {
+	char A0[20] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[40] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[20] __attribute__((aligned(16)));
+	char A6[20] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[262140] __attribute__((aligned(16)));
+	char A9[12] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	u64 t__2e190;
+	u64 t__2e191;
+	u64 t__2e193;
+	u64 t__2e200;
+	u64 t__2e201;
+	u64 t__2e206;
+	u64 t__2e207;
+	u64 t__2e208;
+	u64 t__2e209;
+	u64 t__2e213;
+	u64 t__2e214;
+	u64 t__2e215;
+	u64 t__2e216;
+	u64 t__2e217;
+	u64 t__2e219;
+	u64 t__2e227;
+	u64 t__2e228;
+	u64 t__2e236;
+	u64 t__2e237;
+	u64 t__2e242;
+	u64 t__2e245;
+	u64 t__2e246;
+	u64 t__2e247;
+	u64 t__2e249;
+	u64 t__2e250;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e254;
+	u64 t__2e256;
+	u64 t__2e259;
+	u64 t__2e260;
+	u64 t__2e262;
+	u64 t__2e271;
+	u64 t__2e272;
+	u64 t__2e277;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t__2e280;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e283;
+	u64 t__2e285;
+	u64 t__2e289;
+	u64 t__2e290;
+	u64 t__2e300;
+	u64 t__2e301;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t__2e311;
+	u64 t__2e312;
+	u64 t__2e314;
+	u64 t__2e321;
+	u64 t__2e322;
+	u64 t__2e327;
+	u64 t__2e328;
+	u64 t__2e329;
+	u64 t__2e330;
+	u64 t__2e332;
+	u64 t_abortsite_2e211;
+	u64 t_binding_2e187;
+	u64 t_binding_2e199;
+	u64 t_binding_2e220;
+	u64 t_binding_2e235;
+	u64 t_binding_2e257;
+	u64 t_binding_2e263;
+	u64 t_binding_2e270;
+	u64 t_binding_2e286;
+	u64 t_binding_2e292;
+	u64 t_binding_2e299;
+	u64 t_binding_2e320;
+	u64 t_field_2e226;
+	u64 t_field_2e248;
+	u64 t_field_2e253;
+	u64 t_item_2e189;
+	u64 t_item_2e192;
+	u64 t_item_2e223;
+	u64 t_item_2e229;
+	u64 t_item_2e258;
+	u64 t_item_2e261;
+	u64 t_item_2e264;
+	u64 t_item_2e288;
+	u64 t_item_2e291;
+	u64 t_item_2e293;
+	u64 t_object_2e224;
+	L_start_2e183:;
+	t_binding_2e187 = (u64)A0;
+	t_binding_2e199 = (u64)A1;
+	t_binding_2e220 = (u64)A2;
+	t_object_2e224 = (u64)A3;
+	t_binding_2e235 = (u64)A4;
+	t_binding_2e257 = (u64)A5;
+	t_binding_2e263 = (u64)A6;
+	t_binding_2e270 = (u64)A7;
+	t_binding_2e286 = (u64)A8;
+	t_binding_2e292 = (u64)A9;
+	t_binding_2e299 = (u64)A10;
+	t_binding_2e320 = (u64)A11;
+	L_body_2e184:;
+	t_item_2e189 = (u64)((u64)t_binding_2e187 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e189 = (u32)((u64)1337UL);
+	t__2e190 = (u64)((u64)t_binding_2e187 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e190, (u64)t_item_2e189, (u64)((u64)16UL));
+	t_item_2e192 = (u64)((u64)t_binding_2e187 + (u64)((u64)0UL));
+	t__2e193 = (u64)(u32)(*(i32 *)t_item_2e192);
+	t__2e191 = (u64)((u64)t_binding_2e187 + (u64)((u64)4UL));
+	*(u32 *)t__2e191 = (u32)t__2e193;
+	t__2e191 = (u64)((u64)t_binding_2e187 + (u64)((u64)8UL));
+	*(u32 *)t__2e191 = (u32)t__2e193;
+	t__2e191 = (u64)((u64)t_binding_2e187 + (u64)((u64)12UL));
+	*(u32 *)t__2e191 = (u32)t__2e193;
+	t__2e191 = (u64)((u64)t_binding_2e187 + (u64)((u64)16UL));
+	*(u32 *)t__2e191 = (u32)t__2e193;
+	*(u64 *)t_binding_2e199 = (u64)((u64)0UL);
+	L_loop_2e194:;
+	t__2e201 = (u64)(*(u64 *)t_binding_2e199);
+	t__2e200 = (u64)(u32)(((u64)t__2e201 < (u64)((u64)5UL)));
+	if ((u32)t__2e200) goto L_body_2e195; else goto L__2e197;
+	L_body_2e195:;
+	t__2e208 = (u64)(*(u64 *)t_binding_2e199);
+	t__2e207 = (u64)((u64)t__2e208 * (u64)((u64)4UL));
+	t__2e207 = (u64)((u64)t_binding_2e187 + (u64)t__2e207);
+	t__2e209 = (u64)(u32)(*(i32 *)t__2e207);
+	t__2e206 = (u64)(u32)(((u32)t__2e209 == (u32)((u64)1337UL)));
+	if ((u32)t__2e206) goto L_passed_2e205; else goto L_failed_2e204;
+	L_failed_2e204:;
+	t_abortsite_2e211 = ((u64)0UL);
+	goto L_abort_2e212;
+	L_passed_2e205:;
+	goto L__2e202;
+	L__2e218:;
+	L__2e202:;
+	L_after_2e198:;
+	t__2e219 = (u64)(*(u64 *)t_binding_2e199);
+	t__2e219 = (u64)((u64)t__2e219 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e199 = (u64)t__2e219;
+	goto L_loop_2e194;
+	L__2e197:;
+	t_item_2e223 = (u64)((u64)t_binding_2e220 + (u64)((u64)0UL));
+	t_field_2e226 = (u64)((u64)t_object_2e224 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e226 = (u32)((u64)10UL);
+	t_field_2e226 = (u64)((u64)t_object_2e224 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e226 = (u32)((u64)20UL);
+	BLIT(t_item_2e223, t_object_2e224, ((u64)8UL));
+	t__2e227 = (u64)((u64)t_binding_2e220 + (u64)((u64)8UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e227, (u64)t_item_2e223, (u64)((u64)32UL));
+	t_item_2e229 = (u64)((u64)t_binding_2e220 + (u64)((u64)0UL));
+	t__2e228 = (u64)((u64)t_binding_2e220 + (u64)((u64)8UL));
+	BLIT(t__2e228, t_item_2e229, ((u64)8UL));
+	t__2e228 = (u64)((u64)t_binding_2e220 + (u64)((u64)16UL));
+	BLIT(t__2e228, t_item_2e229, ((u64)8UL));
+	t__2e228 = (u64)((u64)t_binding_2e220 + (u64)((u64)24UL));
+	BLIT(t__2e228, t_item_2e229, ((u64)8UL));
+	t__2e228 = (u64)((u64)t_binding_2e220 + (u64)((u64)32UL));
+	BLIT(t__2e228, t_item_2e229, ((u64)8UL));
+	*(u64 *)t_binding_2e235 = (u64)((u64)0UL);
+	L_loop_2e230:;
+	t__2e237 = (u64)(*(u64 *)t_binding_2e235);
+	t__2e236 = (u64)(u32)(((u64)t__2e237 < (u64)((u64)5UL)));
+	if ((u32)t__2e236) goto L_body_2e231; else goto L__2e233;
+	L_body_2e231:;
+	t__2e247 = (u64)(*(u64 *)t_binding_2e235);
+	t__2e246 = (u64)((u64)t__2e247 * (u64)((u64)8UL));
+	t__2e246 = (u64)((u64)t_binding_2e220 + (u64)t__2e246);
+	t_field_2e248 = (u64)((u64)t__2e246 + (u64)((u64)0UL));
+	t__2e249 = (u64)(u32)(*(i32 *)t_field_2e248);
+	t__2e245 = (u64)(u32)(((u32)t__2e249 == (u32)((u64)10UL)));
+	t__2e242 = (u64)(u32)t__2e245;
+	if ((u32)t__2e242) goto L__2e243; else goto L__2e244;
+	L__2e243:;
+	t__2e252 = (u64)(*(u64 *)t_binding_2e235);
+	t__2e251 = (u64)((u64)t__2e252 * (u64)((u64)8UL));
+	t__2e251 = (u64)((u64)t_binding_2e220 + (u64)t__2e251);
+	t_field_2e253 = (u64)((u64)t__2e251 + (u64)((u64)4UL));
+	t__2e254 = (u64)(u32)(*(i32 *)t_field_2e253);
+	t__2e250 = (u64)(u32)(((u32)t__2e254 == (u32)((u64)20UL)));
+	t__2e242 = (u64)(u32)t__2e250;
+	goto L__2e244;
+	L__2e244:;
+	if ((u32)t__2e242) goto L_passed_2e241; else goto L_failed_2e240;
+	L_failed_2e240:;
+	t_abortsite_2e211 = ((u64)1UL);
+	goto L_abort_2e212;
+	L_passed_2e241:;
+	goto L__2e238;
+	L__2e255:;
+	L__2e238:;
+	L_after_2e234:;
+	t__2e256 = (u64)(*(u64 *)t_binding_2e235);
+	t__2e256 = (u64)((u64)t__2e256 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e235 = (u64)t__2e256;
+	goto L_loop_2e230;
+	L__2e233:;
+	t_item_2e258 = (u64)((u64)t_binding_2e257 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e258 = (u32)((u64)1UL);
+	t_item_2e258 = (u64)((u64)t_binding_2e257 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e258 = (u32)((u64)2UL);
+	t_item_2e258 = (u64)((u64)t_binding_2e257 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e258 = (u32)((u64)3UL);
+	t__2e259 = (u64)((u64)t_binding_2e257 + (u64)((u64)12UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e259, (u64)t_item_2e258, (u64)((u64)8UL));
+	t_item_2e261 = (u64)((u64)t_binding_2e257 + (u64)((u64)8UL));
+	t__2e262 = (u64)(u32)(*(i32 *)t_item_2e261);
+	t__2e260 = (u64)((u64)t_binding_2e257 + (u64)((u64)12UL));
+	*(u32 *)t__2e260 = (u32)t__2e262;
+	t__2e260 = (u64)((u64)t_binding_2e257 + (u64)((u64)16UL));
+	*(u32 *)t__2e260 = (u32)t__2e262;
+	t_item_2e264 = (u64)((u64)t_binding_2e263 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e264 = (u32)((u64)1UL);
+	t_item_2e264 = (u64)((u64)t_binding_2e263 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e264 = (u32)((u64)2UL);
+	t_item_2e264 = (u64)((u64)t_binding_2e263 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e264 = (u32)((u64)3UL);
+	t_item_2e264 = (u64)((u64)t_binding_2e263 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e264 = (u32)((u64)3UL);
+	t_item_2e264 = (u64)((u64)t_binding_2e263 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e264 = (u32)((u64)3UL);
+	*(u64 *)t_binding_2e270 = (u64)((u64)0UL);
+	L_loop_2e265:;
+	t__2e272 = (u64)(*(u64 *)t_binding_2e270);
+	t__2e271 = (u64)(u32)(((u64)t__2e272 < (u64)((u64)5UL)));
+	if ((u32)t__2e271) goto L_body_2e266; else goto L__2e268;
+	L_body_2e266:;
+	t__2e279 = (u64)(*(u64 *)t_binding_2e270);
+	t__2e278 = (u64)((u64)t__2e279 * (u64)((u64)4UL));
+	t__2e278 = (u64)((u64)t_binding_2e257 + (u64)t__2e278);
+	t__2e280 = (u64)(u32)(*(i32 *)t__2e278);
+	t__2e282 = (u64)(*(u64 *)t_binding_2e270);
+	t__2e281 = (u64)((u64)t__2e282 * (u64)((u64)4UL));
+	t__2e281 = (u64)((u64)t_binding_2e263 + (u64)t__2e281);
+	t__2e283 = (u64)(u32)(*(i32 *)t__2e281);
+	t__2e277 = (u64)(u32)(((u32)t__2e280 == (u32)t__2e283));
+	if ((u32)t__2e277) goto L_passed_2e276; else goto L_failed_2e275;
+	L_failed_2e275:;
+	t_abortsite_2e211 = ((u64)2UL);
+	goto L_abort_2e212;
+	L_passed_2e276:;
+	goto L__2e273;
+	L__2e284:;
+	L__2e273:;
+	L_after_2e269:;
+	t__2e285 = (u64)(*(u64 *)t_binding_2e270);
+	t__2e285 = (u64)((u64)t__2e285 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e270 = (u64)t__2e285;
+	goto L_loop_2e265;
+	L__2e268:;
+	t_item_2e288 = (u64)((u64)t_binding_2e286 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e288 = (u32)((u64)1UL);
+	t_item_2e288 = (u64)((u64)t_binding_2e286 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e288 = (u32)((u64)2UL);
+	t_item_2e288 = (u64)((u64)t_binding_2e286 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e288 = (u32)((u64)3UL);
+	t__2e289 = (u64)((u64)t_binding_2e286 + (u64)((u64)12UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e289, (u64)t_item_2e288, (u64)((u64)262128UL));
+	t_item_2e291 = (u64)((u64)t_binding_2e286 + (u64)((u64)8UL));
+	t__2e290 = (u64)((u64)t_binding_2e286 + (u64)((u64)12UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e290, (u64)t_item_2e291, (u64)((u64)262128UL));
+	t_item_2e293 = (u64)((u64)t_binding_2e292 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e293 = (u32)((u64)1UL);
+	t_item_2e293 = (u64)((u64)t_binding_2e292 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e293 = (u32)((u64)2UL);
+	t_item_2e293 = (u64)((u64)t_binding_2e292 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e293 = (u32)((u64)3UL);
+	*(u64 *)t_binding_2e299 = (u64)((u64)0UL);
+	L_loop_2e294:;
+	t__2e301 = (u64)(*(u64 *)t_binding_2e299);
+	t__2e300 = (u64)(u32)(((u64)t__2e301 < (u64)((u64)3UL)));
+	if ((u32)t__2e300) goto L_body_2e295; else goto L__2e297;
+	L_body_2e295:;
+	t__2e308 = (u64)(*(u64 *)t_binding_2e299);
+	t__2e307 = (u64)((u64)t__2e308 * (u64)((u64)4UL));
+	t__2e307 = (u64)((u64)t_binding_2e286 + (u64)t__2e307);
+	t__2e309 = (u64)(u32)(*(i32 *)t__2e307);
+	t__2e311 = (u64)(*(u64 *)t_binding_2e299);
+	t__2e310 = (u64)((u64)t__2e311 * (u64)((u64)4UL));
+	t__2e310 = (u64)((u64)t_binding_2e292 + (u64)t__2e310);
+	t__2e312 = (u64)(u32)(*(i32 *)t__2e310);
+	t__2e306 = (u64)(u32)(((u32)t__2e309 == (u32)t__2e312));
+	if ((u32)t__2e306) goto L_passed_2e305; else goto L_failed_2e304;
+	L_failed_2e304:;
+	t_abortsite_2e211 = ((u64)3UL);
+	goto L_abort_2e212;
+	L_passed_2e305:;
+	goto L__2e302;
+	L__2e313:;
+	L__2e302:;
+	L_after_2e298:;
+	t__2e314 = (u64)(*(u64 *)t_binding_2e299);
+	t__2e314 = (u64)((u64)t__2e314 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e299 = (u64)t__2e314;
+	goto L_loop_2e294;
+	L__2e297:;
+	*(u64 *)t_binding_2e320 = (u64)((u64)3UL);
+	L_loop_2e315:;
+	t__2e322 = (u64)(*(u64 *)t_binding_2e320);
+	t__2e321 = (u64)(u32)(((u64)t__2e322 < (u64)((u64)65535UL)));
+	if ((u32)t__2e321) goto L_body_2e316; else goto L__2e318;
+	L_body_2e316:;
+	t__2e329 = (u64)(*(u64 *)t_binding_2e320);
+	t__2e328 = (u64)((u64)t__2e329 * (u64)((u64)4UL));
+	t__2e328 = (u64)((u64)t_binding_2e286 + (u64)t__2e328);
+	t__2e330 = (u64)(u32)(*(i32 *)t__2e328);
+	t__2e327 = (u64)(u32)(((u32)t__2e330 == (u32)((u64)3UL)));
+	if ((u32)t__2e327) goto L_passed_2e326; else goto L_failed_2e325;
+	L_failed_2e325:;
+	t_abortsite_2e211 = ((u64)4UL);
+	goto L_abort_2e212;
+	L_passed_2e326:;
+	goto L__2e323;
+	L__2e331:;
+	L__2e323:;
+	L_after_2e319:;
+	t__2e332 = (u64)(*(u64 *)t_binding_2e320);
+	t__2e332 = (u64)((u64)t__2e332 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e320 = (u64)t__2e332;
+	goto L_loop_2e315;
+	L__2e318:;
+	goto L__2e185;
+	L__2e333:;
+	L__2e185:;
+	return;
+	L_abort_2e212:;
+	t__2e213 = (u64)((u64)t_abortsite_2e211 * (u64)((u64)16UL));
+	t__2e213 = (u64)((u64)((u64)((char *)&D_abortsites_2e210)) + (u64)t__2e213);
+	t__2e214 = (u64)(*(u64 *)t__2e213);
+	t__2e215 = (u64)((u64)t__2e213 + (u64)((u64)8UL));
+	t__2e216 = (u64)(*(u32 *)t__2e215);
+	t__2e215 = (u64)((u64)t__2e213 + (u64)((u64)12UL));
+	t__2e217 = (u64)(*(u32 *)t__2e215);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e214, (u64)t__2e216, (u64)t__2e217, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_nested(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e346;
+	u64 t__2e349;
+	u64 t__2e350;
+	u64 t__2e351;
+	u64 t__2e352;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e355;
+	u64 t__2e356;
+	u64 t__2e357;
+	u64 t__2e358;
+	u64 t__2e359;
+	u64 t__2e360;
+	u64 t__2e364;
+	u64 t__2e365;
+	u64 t__2e366;
+	u64 t__2e367;
+	u64 t__2e368;
+	u64 t__2e371;
+	u64 t__2e374;
+	u64 t__2e375;
+	u64 t__2e376;
+	u64 t__2e377;
+	u64 t__2e378;
+	u64 t__2e379;
+	u64 t__2e380;
+	u64 t__2e381;
+	u64 t__2e382;
+	u64 t__2e383;
+	u64 t__2e384;
+	u64 t__2e385;
+	u64 t__2e388;
+	u64 t__2e389;
+	u64 t__2e390;
+	u64 t__2e395;
+	u64 t__2e398;
+	u64 t__2e399;
+	u64 t__2e400;
+	u64 t__2e401;
+	u64 t__2e402;
+	u64 t__2e403;
+	u64 t__2e404;
+	u64 t__2e405;
+	u64 t__2e406;
+	u64 t__2e407;
+	u64 t__2e408;
+	u64 t__2e409;
+	u64 t_abortsite_2e362;
+	u64 t_binding_2e338;
+	u64 t_item_2e341;
+	u64 t_item_2e342;
+	u64 t_item_2e343;
+	u64 t_item_2e392;
+	u64 t_object_2e391;
+	L_start_2e334:;
+	t_binding_2e338 = (u64)A0;
+	t_object_2e391 = (u64)A1;
+	L_body_2e335:;
+	t_item_2e341 = (u64)((u64)t_binding_2e338 + (u64)((u64)0UL));
+	t_item_2e342 = (u64)((u64)t_item_2e341 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e342 = (u32)((u64)1UL);
+	t_item_2e342 = (u64)((u64)t_item_2e341 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e342 = (u32)((u64)2UL);
+	t_item_2e341 = (u64)((u64)t_binding_2e338 + (u64)((u64)8UL));
+	t_item_2e343 = (u64)((u64)t_item_2e341 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e343 = (u32)((u64)3UL);
+	t_item_2e343 = (u64)((u64)t_item_2e341 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e343 = (u32)((u64)4UL);
+	t__2e351 = (u64)((i64)(i32)((u64)0UL));
+	t__2e350 = (u64)((u64)t__2e351 * (u64)((u64)8UL));
+	t__2e350 = (u64)((u64)t_binding_2e338 + (u64)t__2e350);
+	t__2e353 = (u64)((i64)(i32)((u64)0UL));
+	t__2e352 = (u64)((u64)t__2e353 * (u64)((u64)4UL));
+	t__2e352 = (u64)((u64)t__2e350 + (u64)t__2e352);
+	t__2e354 = (u64)(u32)(*(i32 *)t__2e352);
+	t__2e349 = (u64)(u32)(((u32)t__2e354 == (u32)((u64)1UL)));
+	t__2e346 = (u64)(u32)t__2e349;
+	if ((u32)t__2e346) goto L__2e347; else goto L__2e348;
+	L__2e347:;
+	t__2e357 = (u64)((i64)(i32)((u64)0UL));
+	t__2e356 = (u64)((u64)t__2e357 * (u64)((u64)8UL));
+	t__2e356 = (u64)((u64)t_binding_2e338 + (u64)t__2e356);
+	t__2e359 = (u64)((i64)(i32)((u64)1UL));
+	t__2e358 = (u64)((u64)t__2e359 * (u64)((u64)4UL));
+	t__2e358 = (u64)((u64)t__2e356 + (u64)t__2e358);
+	t__2e360 = (u64)(u32)(*(i32 *)t__2e358);
+	t__2e355 = (u64)(u32)(((u32)t__2e360 == (u32)((u64)2UL)));
+	t__2e346 = (u64)(u32)t__2e355;
+	goto L__2e348;
+	L__2e348:;
+	if ((u32)t__2e346) goto L_passed_2e345; else goto L_failed_2e344;
+	L_failed_2e344:;
+	t_abortsite_2e362 = ((u64)0UL);
+	goto L_abort_2e363;
+	L_passed_2e345:;
+	t__2e376 = (u64)((i64)(i32)((u64)1UL));
+	t__2e375 = (u64)((u64)t__2e376 * (u64)((u64)8UL));
+	t__2e375 = (u64)((u64)t_binding_2e338 + (u64)t__2e375);
+	t__2e378 = (u64)((i64)(i32)((u64)0UL));
+	t__2e377 = (u64)((u64)t__2e378 * (u64)((u64)4UL));
+	t__2e377 = (u64)((u64)t__2e375 + (u64)t__2e377);
+	t__2e379 = (u64)(u32)(*(i32 *)t__2e377);
+	t__2e374 = (u64)(u32)(((u32)t__2e379 == (u32)((u64)3UL)));
+	t__2e371 = (u64)(u32)t__2e374;
+	if ((u32)t__2e371) goto L__2e372; else goto L__2e373;
+	L__2e372:;
+	t__2e382 = (u64)((i64)(i32)((u64)1UL));
+	t__2e381 = (u64)((u64)t__2e382 * (u64)((u64)8UL));
+	t__2e381 = (u64)((u64)t_binding_2e338 + (u64)t__2e381);
+	t__2e384 = (u64)((i64)(i32)((u64)1UL));
+	t__2e383 = (u64)((u64)t__2e384 * (u64)((u64)4UL));
+	t__2e383 = (u64)((u64)t__2e381 + (u64)t__2e383);
+	t__2e385 = (u64)(u32)(*(i32 *)t__2e383);
+	t__2e380 = (u64)(u32)(((u32)t__2e385 == (u32)((u64)4UL)));
+	t__2e371 = (u64)(u32)t__2e380;
+	goto L__2e373;
+	L__2e373:;
+	if ((u32)t__2e371) goto L_passed_2e370; else goto L_failed_2e369;
+	L_failed_2e369:;
+	t_abortsite_2e362 = ((u64)1UL);
+	goto L_abort_2e363;
+	L_passed_2e370:;
+	t__2e388 = (u64)(u32)(((u64)((u64)2UL) == (u64)((u64)2UL)));
+	if ((u32)t__2e388) goto L_passed_2e387; else goto L_failed_2e386;
+	L_failed_2e386:;
+	t_abortsite_2e362 = ((u64)2UL);
+	goto L_abort_2e363;
+	L_passed_2e387:;
+	t__2e390 = (u64)((i64)(i32)((u64)1UL));
+	t__2e389 = (u64)((u64)t__2e390 * (u64)((u64)8UL));
+	t__2e389 = (u64)((u64)t_binding_2e338 + (u64)t__2e389);
+	t_item_2e392 = (u64)((u64)t_object_2e391 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e392 = (u32)((u64)5UL);
+	t_item_2e392 = (u64)((u64)t_object_2e391 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e392 = (u32)((u64)6UL);
+	BLIT(t__2e389, t_object_2e391, ((u64)8UL));
+	t__2e400 = (u64)((i64)(i32)((u64)1UL));
+	t__2e399 = (u64)((u64)t__2e400 * (u64)((u64)8UL));
+	t__2e399 = (u64)((u64)t_binding_2e338 + (u64)t__2e399);
+	t__2e402 = (u64)((i64)(i32)((u64)0UL));
+	t__2e401 = (u64)((u64)t__2e402 * (u64)((u64)4UL));
+	t__2e401 = (u64)((u64)t__2e399 + (u64)t__2e401);
+	t__2e403 = (u64)(u32)(*(i32 *)t__2e401);
+	t__2e398 = (u64)(u32)(((u32)t__2e403 == (u32)((u64)5UL)));
+	t__2e395 = (u64)(u32)t__2e398;
+	if ((u32)t__2e395) goto L__2e396; else goto L__2e397;
+	L__2e396:;
+	t__2e406 = (u64)((i64)(i32)((u64)1UL));
+	t__2e405 = (u64)((u64)t__2e406 * (u64)((u64)8UL));
+	t__2e405 = (u64)((u64)t_binding_2e338 + (u64)t__2e405);
+	t__2e408 = (u64)((i64)(i32)((u64)1UL));
+	t__2e407 = (u64)((u64)t__2e408 * (u64)((u64)4UL));
+	t__2e407 = (u64)((u64)t__2e405 + (u64)t__2e407);
+	t__2e409 = (u64)(u32)(*(i32 *)t__2e407);
+	t__2e404 = (u64)(u32)(((u32)t__2e409 == (u32)((u64)6UL)));
+	t__2e395 = (u64)(u32)t__2e404;
+	goto L__2e397;
+	L__2e397:;
+	if ((u32)t__2e395) goto L_passed_2e394; else goto L_failed_2e393;
+	L_failed_2e393:;
+	t_abortsite_2e362 = ((u64)3UL);
+	goto L_abort_2e363;
+	L_passed_2e394:;
+	goto L__2e336;
+	L__2e410:;
+	L__2e336:;
+	return;
+	L_abort_2e363:;
+	t__2e364 = (u64)((u64)t_abortsite_2e362 * (u64)((u64)16UL));
+	t__2e364 = (u64)((u64)((u64)((char *)&D_abortsites_2e361)) + (u64)t__2e364);
+	t__2e365 = (u64)(*(u64 *)t__2e364);
+	t__2e366 = (u64)((u64)t__2e364 + (u64)((u64)8UL));
+	t__2e367 = (u64)(*(u32 *)t__2e366);
+	t__2e366 = (u64)((u64)t__2e364 + (u64)((u64)12UL));
+	t__2e368 = (u64)(*(u32 *)t__2e366);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e365, (u64)t__2e367, (u64)t__2e368, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_param(u64 p_x) {
+	u64 t__2e417;
+	u64 t__2e421;
+	u64 t__2e422;
+	u64 t__2e423;
+	u64 t__2e424;
+	u64 t__2e425;
+	u64 t__2e428;
+	u64 t__2e429;
+	u64 t__2e430;
+	u64 t__2e431;
+	u64 t__2e434;
+	u64 t__2e435;
+	u64 t__2e436;
+	u64 t__2e437;
+	u64 t__2e440;
+	u64 t__2e441;
+	u64 t__2e442;
+	u64 t__2e443;
+	u64 t_abortsite_2e419;
+	u64 t_x;
+	t_x = p_x;
+	L_start_2e411:;
+	L_body_2e412:;
+	t__2e417 = (u64)(u32)(((u64)((u64)3UL) == (u64)((u64)3UL)));
+	if ((u32)t__2e417) goto L_passed_2e416; else goto L_failed_2e415;
+	L_failed_2e415:;
+	t_abortsite_2e419 = ((u64)0UL);
+	goto L_abort_2e420;
+	L_passed_2e416:;
+	t__2e430 = (u64)((i64)(i32)((u64)0UL));
+	t__2e429 = (u64)((u64)t__2e430 * (u64)((u64)4UL));
+	t__2e429 = (u64)((u64)t_x + (u64)t__2e429);
+	t__2e431 = (u64)(u32)(*(i32 *)t__2e429);
+	t__2e428 = (u64)(u32)(((u32)t__2e431 == (u32)((u64)1UL)));
+	if ((u32)t__2e428) goto L_passed_2e427; else goto L_failed_2e426;
+	L_failed_2e426:;
+	t_abortsite_2e419 = ((u64)1UL);
+	goto L_abort_2e420;
+	L_passed_2e427:;
+	t__2e436 = (u64)((i64)(i32)((u64)1UL));
+	t__2e435 = (u64)((u64)t__2e436 * (u64)((u64)4UL));
+	t__2e435 = (u64)((u64)t_x + (u64)t__2e435);
+	t__2e437 = (u64)(u32)(*(i32 *)t__2e435);
+	t__2e434 = (u64)(u32)(((u32)t__2e437 == (u32)((u64)2UL)));
+	if ((u32)t__2e434) goto L_passed_2e433; else goto L_failed_2e432;
+	L_failed_2e432:;
+	t_abortsite_2e419 = ((u64)2UL);
+	goto L_abort_2e420;
+	L_passed_2e433:;
+	t__2e442 = (u64)((i64)(i32)((u64)2UL));
+	t__2e441 = (u64)((u64)t__2e442 * (u64)((u64)4UL));
+	t__2e441 = (u64)((u64)t_x + (u64)t__2e441);
+	t__2e443 = (u64)(u32)(*(i32 *)t__2e441);
+	t__2e440 = (u64)(u32)(((u32)t__2e443 == (u32)((u64)3UL)));
+	if ((u32)t__2e440) goto L_passed_2e439; else goto L_failed_2e438;
+	L_failed_2e438:;
+	t_abortsite_2e419 = ((u64)3UL);
+	goto L_abort_2e420;
+	L_passed_2e439:;
+	goto L__2e413;
+	L__2e444:;
+	L__2e413:;
+	return;
+	L_abort_2e420:;
+	t__2e421 = (u64)((u64)t_abortsite_2e419 * (u64)((u64)16UL));
+	t__2e421 = (u64)((u64)((u64)((char *)&D_abortsites_2e418)) + (u64)t__2e421);
+	t__2e422 = (u64)(*(u64 *)t__2e421);
+	t__2e423 = (u64)((u64)t__2e421 + (u64)((u64)8UL));
+	t__2e424 = (u64)(*(u32 *)t__2e423);
+	t__2e423 = (u64)((u64)t__2e421 + (u64)((u64)12UL));
+	t__2e425 = (u64)(*(u32 *)t__2e423);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e422, (u64)t__2e424, (u64)t__2e425, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_assignment(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char A1[12] __attribute__((aligned(16)));
+	char A2[12] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char B12[8] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char R15[4] __attribute__((aligned(16)));
+	char B16[8] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char R19[4] __attribute__((aligned(16)));
+	char B20[8] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char R23[4] __attribute__((aligned(16)));
+	u64 t__2e458;
+	u64 t__2e459;
+	u64 t__2e460;
+	u64 t__2e463;
+	u64 t__2e466;
+	u64 t__2e469;
+	u64 t__2e470;
+	u64 t__2e471;
+	u64 t__2e472;
+	u64 t__2e473;
+	u64 t__2e474;
+	u64 t__2e475;
+	u64 t__2e476;
+	u64 t__2e477;
+	u64 t__2e478;
+	u64 t__2e479;
+	u64 t__2e480;
+	u64 t__2e484;
+	u64 t__2e485;
+	u64 t__2e486;
+	u64 t__2e487;
+	u64 t__2e488;
+	u64 t__2e491;
+	u64 t__2e494;
+	u64 t__2e497;
+	u64 t__2e498;
+	u64 t__2e499;
+	u64 t__2e500;
+	u64 t__2e501;
+	u64 t__2e502;
+	u64 t__2e503;
+	u64 t__2e504;
+	u64 t__2e505;
+	u64 t__2e506;
+	u64 t__2e507;
+	u64 t__2e508;
+	u64 t__2e511;
+	u64 t__2e514;
+	u64 t__2e515;
+	u64 t__2e516;
+	u64 t__2e517;
+	u64 t__2e518;
+	u64 t__2e519;
+	u64 t__2e520;
+	u64 t__2e521;
+	u64 t__2e524;
+	u64 t__2e526;
+	u64 t__2e530;
+	u64 t__2e539;
+	u64 t__2e541;
+	u64 t__2e543;
+	u64 t__2e544;
+	u64 t__2e545;
+	u64 t__2e546;
+	u64 t__2e547;
+	u64 t__2e550;
+	u64 t__2e551;
+	u64 t__2e552;
+	u64 t__2e553;
+	u64 t__2e554;
+	u64 t__2e556;
+	u64 t__2e558;
+	u64 t__2e562;
+	u64 t__2e571;
+	u64 t__2e573;
+	u64 t__2e576;
+	u64 t__2e578;
+	u64 t__2e582;
+	u64 t__2e591;
+	u64 t__2e593;
+	u64 t_abortsite_2e482;
+	u64 t_binding_2e449;
+	u64 t_binding_2e451;
+	u64 t_binding_2e452;
+	u64 t_binding_2e454;
+	u64 t_binding_2e522;
+	u64 t_item_2e450;
+	u64 t_item_2e453;
+	u64 t_item_2e455;
+	u64 t_item_2e457;
+	u64 t_object_2e456;
+	u64 t_object_2e525;
+	u64 t_object_2e529;
+	u64 t_object_2e557;
+	u64 t_object_2e561;
+	u64 t_object_2e577;
+	u64 t_object_2e581;
+	u64 t_tag_2e531;
+	u64 t_tag_2e563;
+	u64 t_tag_2e583;
+	L_start_2e445:;
+	t_binding_2e449 = (u64)A0;
+	t_binding_2e451 = (u64)A1;
+	t_binding_2e452 = (u64)A2;
+	t_binding_2e454 = (u64)A3;
+	t_object_2e456 = (u64)A4;
+	t_binding_2e522 = (u64)A5;
+	t_object_2e525 = (u64)A6;
+	t_object_2e529 = (u64)A7;
+	t_object_2e557 = (u64)A8;
+	t_object_2e561 = (u64)A9;
+	t_object_2e577 = (u64)A10;
+	t_object_2e581 = (u64)A11;
+	L_body_2e446:;
+	t_item_2e450 = (u64)((u64)t_binding_2e449 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e450 = (u32)((u64)1UL);
+	t_item_2e450 = (u64)((u64)t_binding_2e449 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e450 = (u32)((u64)2UL);
+	t_item_2e450 = (u64)((u64)t_binding_2e449 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e450 = (u32)((u64)3UL);
+	BLIT(t_binding_2e451, t_binding_2e449, ((u64)12UL));
+	t_item_2e453 = (u64)((u64)t_binding_2e452 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e453 = (u32)((u64)0UL);
+	t_item_2e453 = (u64)((u64)t_binding_2e452 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e453 = (u32)((u64)0UL);
+	t_item_2e453 = (u64)((u64)t_binding_2e452 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e453 = (u32)((u64)0UL);
+	BLIT(t_binding_2e452, t_binding_2e451, ((u64)12UL));
+	t_item_2e455 = (u64)((u64)t_binding_2e454 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e455 = (u32)((u64)1UL);
+	t_item_2e455 = (u64)((u64)t_binding_2e454 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e455 = (u32)((u64)0UL);
+	t_item_2e457 = (u64)((u64)t_object_2e456 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e457 = (u32)((u64)2UL);
+	t_item_2e457 = (u64)((u64)t_object_2e456 + (u64)((u64)4UL));
+	t__2e459 = (u64)((i64)(i32)((u64)0UL));
+	t__2e458 = (u64)((u64)t__2e459 * (u64)((u64)4UL));
+	t__2e458 = (u64)((u64)t_binding_2e454 + (u64)t__2e458);
+	t__2e460 = (u64)(u32)(*(i32 *)t__2e458);
+	*(u32 *)t_item_2e457 = (u32)t__2e460;
+	BLIT(t_binding_2e454, t_object_2e456, ((u64)8UL));
+	t__2e471 = (u64)((i64)(i32)((u64)0UL));
+	t__2e470 = (u64)((u64)t__2e471 * (u64)((u64)4UL));
+	t__2e470 = (u64)((u64)t_binding_2e451 + (u64)t__2e470);
+	t__2e472 = (u64)(u32)(*(i32 *)t__2e470);
+	t__2e469 = (u64)(u32)(((u32)t__2e472 == (u32)((u64)1UL)));
+	t__2e466 = (u64)(u32)t__2e469;
+	if ((u32)t__2e466) goto L__2e467; else goto L__2e468;
+	L__2e467:;
+	t__2e475 = (u64)((i64)(i32)((u64)1UL));
+	t__2e474 = (u64)((u64)t__2e475 * (u64)((u64)4UL));
+	t__2e474 = (u64)((u64)t_binding_2e451 + (u64)t__2e474);
+	t__2e476 = (u64)(u32)(*(i32 *)t__2e474);
+	t__2e473 = (u64)(u32)(((u32)t__2e476 == (u32)((u64)2UL)));
+	t__2e466 = (u64)(u32)t__2e473;
+	goto L__2e468;
+	L__2e468:;
+	t__2e463 = (u64)(u32)t__2e466;
+	if ((u32)t__2e463) goto L__2e464; else goto L__2e465;
+	L__2e464:;
+	t__2e479 = (u64)((i64)(i32)((u64)2UL));
+	t__2e478 = (u64)((u64)t__2e479 * (u64)((u64)4UL));
+	t__2e478 = (u64)((u64)t_binding_2e451 + (u64)t__2e478);
+	t__2e480 = (u64)(u32)(*(i32 *)t__2e478);
+	t__2e477 = (u64)(u32)(((u32)t__2e480 == (u32)((u64)3UL)));
+	t__2e463 = (u64)(u32)t__2e477;
+	goto L__2e465;
+	L__2e465:;
+	if ((u32)t__2e463) goto L_passed_2e462; else goto L_failed_2e461;
+	L_failed_2e461:;
+	t_abortsite_2e482 = ((u64)0UL);
+	goto L_abort_2e483;
+	L_passed_2e462:;
+	t__2e499 = (u64)((i64)(i32)((u64)0UL));
+	t__2e498 = (u64)((u64)t__2e499 * (u64)((u64)4UL));
+	t__2e498 = (u64)((u64)t_binding_2e452 + (u64)t__2e498);
+	t__2e500 = (u64)(u32)(*(i32 *)t__2e498);
+	t__2e497 = (u64)(u32)(((u32)t__2e500 == (u32)((u64)1UL)));
+	t__2e494 = (u64)(u32)t__2e497;
+	if ((u32)t__2e494) goto L__2e495; else goto L__2e496;
+	L__2e495:;
+	t__2e503 = (u64)((i64)(i32)((u64)1UL));
+	t__2e502 = (u64)((u64)t__2e503 * (u64)((u64)4UL));
+	t__2e502 = (u64)((u64)t_binding_2e452 + (u64)t__2e502);
+	t__2e504 = (u64)(u32)(*(i32 *)t__2e502);
+	t__2e501 = (u64)(u32)(((u32)t__2e504 == (u32)((u64)2UL)));
+	t__2e494 = (u64)(u32)t__2e501;
+	goto L__2e496;
+	L__2e496:;
+	t__2e491 = (u64)(u32)t__2e494;
+	if ((u32)t__2e491) goto L__2e492; else goto L__2e493;
+	L__2e492:;
+	t__2e507 = (u64)((i64)(i32)((u64)2UL));
+	t__2e506 = (u64)((u64)t__2e507 * (u64)((u64)4UL));
+	t__2e506 = (u64)((u64)t_binding_2e452 + (u64)t__2e506);
+	t__2e508 = (u64)(u32)(*(i32 *)t__2e506);
+	t__2e505 = (u64)(u32)(((u32)t__2e508 == (u32)((u64)3UL)));
+	t__2e491 = (u64)(u32)t__2e505;
+	goto L__2e493;
+	L__2e493:;
+	if ((u32)t__2e491) goto L_passed_2e490; else goto L_failed_2e489;
+	L_failed_2e489:;
+	t_abortsite_2e482 = ((u64)1UL);
+	goto L_abort_2e483;
+	L_passed_2e490:;
+	t__2e516 = (u64)((i64)(i32)((u64)0UL));
+	t__2e515 = (u64)((u64)t__2e516 * (u64)((u64)4UL));
+	t__2e515 = (u64)((u64)t_binding_2e454 + (u64)t__2e515);
+	t__2e517 = (u64)(u32)(*(i32 *)t__2e515);
+	t__2e514 = (u64)(u32)(((u32)t__2e517 == (u32)((u64)2UL)));
+	t__2e511 = (u64)(u32)t__2e514;
+	if ((u32)t__2e511) goto L__2e512; else goto L__2e513;
+	L__2e512:;
+	t__2e520 = (u64)((i64)(i32)((u64)1UL));
+	t__2e519 = (u64)((u64)t__2e520 * (u64)((u64)4UL));
+	t__2e519 = (u64)((u64)t_binding_2e454 + (u64)t__2e519);
+	t__2e521 = (u64)(u32)(*(i32 *)t__2e519);
+	t__2e518 = (u64)(u32)(((u32)t__2e521 == (u32)((u64)1UL)));
+	t__2e511 = (u64)(u32)t__2e518;
+	goto L__2e513;
+	L__2e513:;
+	if ((u32)t__2e511) goto L_passed_2e510; else goto L_failed_2e509;
+	L_failed_2e509:;
+	t_abortsite_2e482 = ((u64)2UL);
+	goto L_abort_2e483;
+	L_passed_2e510:;
+	*(u64 *)t_binding_2e522 = (u64)t_binding_2e449;
+	*(u32 *)t_object_2e525 = (u32)((u64)3532310079UL);
+	t__2e526 = (u64)((u64)t_object_2e525 + (u64)((u64)4UL));
+	*(u32 *)t__2e526 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e529 = (u64)((u64)0UL);
+	t__2e530 = (u64)((u64)t_object_2e529 + (u64)((u64)8UL));
+	*(u64 *)t__2e530 = (u64)((u64)0UL);
+	t__2e530 = (u64)((u64)t__2e530 + (u64)((u64)8UL));
+	*(u64 *)t__2e530 = (u64)((u64)0UL);
+	BLIT((u64)B12, t_object_2e525, 8);
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e528)), 24);
+	BLIT((u64)B14, t_object_2e529, 24);
+	t__2e524 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R15, (u64)B12, (u64)B13, (u64)B14);
+	t_tag_2e531 = (u64)(*(u32 *)t__2e524);
+	t__2e539 = (u64)(u32)(((u32)t_tag_2e531 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e539) goto L_member_2e536; else goto L__2e538;
+	L__2e538:;
+	t__2e541 = (u64)(u32)(((u32)t_tag_2e531 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e541) goto L_member_2e537; else goto L__2e540;
+	L__2e540:;
+	goto L_matches_2e535;
+	L_member_2e536:;
+	goto L_matches_2e535;
+	L_member_2e537:;
+	goto L_matches_2e534;
+	L_matches_2e534:;
+	goto L__2e532;
+	L_matches_2e535:;
+	t_abortsite_2e482 = ((u64)3UL);
+	goto L_abort_2e542;
+	L__2e548:;
+	L__2e533:;
+	t_abortsite_2e482 = ((u64)4UL);
+	goto L_abort_2e549;
+	L__2e532:;
+	*(u32 *)t_object_2e557 = (u32)((u64)3532310079UL);
+	t__2e558 = (u64)((u64)t_object_2e557 + (u64)((u64)4UL));
+	*(u32 *)t__2e558 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e561 = (u64)((u64)0UL);
+	t__2e562 = (u64)((u64)t_object_2e561 + (u64)((u64)8UL));
+	*(u64 *)t__2e562 = (u64)((u64)0UL);
+	t__2e562 = (u64)((u64)t__2e562 + (u64)((u64)8UL));
+	*(u64 *)t__2e562 = (u64)((u64)0UL);
+	BLIT((u64)B16, t_object_2e557, 8);
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e560)), 24);
+	BLIT((u64)B18, t_object_2e561, 24);
+	t__2e556 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R19, (u64)B16, (u64)B17, (u64)B18);
+	t_tag_2e563 = (u64)(*(u32 *)t__2e556);
+	t__2e571 = (u64)(u32)(((u32)t_tag_2e563 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e571) goto L_member_2e568; else goto L__2e570;
+	L__2e570:;
+	t__2e573 = (u64)(u32)(((u32)t_tag_2e563 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e573) goto L_member_2e569; else goto L__2e572;
+	L__2e572:;
+	goto L_matches_2e567;
+	L_member_2e568:;
+	goto L_matches_2e567;
+	L_member_2e569:;
+	goto L_matches_2e566;
+	L_matches_2e566:;
+	goto L__2e564;
+	L_matches_2e567:;
+	t_abortsite_2e482 = ((u64)5UL);
+	goto L_abort_2e542;
+	L__2e574:;
+	L__2e565:;
+	t_abortsite_2e482 = ((u64)6UL);
+	goto L_abort_2e549;
+	L__2e564:;
+	*(u32 *)t_object_2e577 = (u32)((u64)3532310079UL);
+	t__2e578 = (u64)((u64)t_object_2e577 + (u64)((u64)4UL));
+	*(u32 *)t__2e578 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e581 = (u64)((u64)0UL);
+	t__2e582 = (u64)((u64)t_object_2e581 + (u64)((u64)8UL));
+	*(u64 *)t__2e582 = (u64)((u64)0UL);
+	t__2e582 = (u64)((u64)t__2e582 + (u64)((u64)8UL));
+	*(u64 *)t__2e582 = (u64)((u64)0UL);
+	BLIT((u64)B20, t_object_2e577, 8);
+	BLIT((u64)B21, ((u64)((char *)&D_strliteral_2e580)), 24);
+	BLIT((u64)B22, t_object_2e581, 24);
+	t__2e576 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R23, (u64)B20, (u64)B21, (u64)B22);
+	t_tag_2e583 = (u64)(*(u32 *)t__2e576);
+	t__2e591 = (u64)(u32)(((u32)t_tag_2e583 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e591) goto L_member_2e588; else goto L__2e590;
+	L__2e590:;
+	t__2e593 = (u64)(u32)(((u32)t_tag_2e583 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e593) goto L_member_2e589; else goto L__2e592;
+	L__2e592:;
+	goto L_matches_2e587;
+	L_member_2e588:;
+	goto L_matches_2e587;
+	L_member_2e589:;
+	goto L_matches_2e586;
+	L_matches_2e586:;
+	goto L__2e584;
+	L_matches_2e587:;
+	t_abortsite_2e482 = ((u64)7UL);
+	goto L_abort_2e542;
+	L__2e594:;
+	L__2e585:;
+	t_abortsite_2e482 = ((u64)8UL);
+	goto L_abort_2e549;
+	L__2e584:;
+	goto L__2e447;
+	L__2e595:;
+	L__2e447:;
+	return;
+	L_abort_2e483:;
+	t__2e484 = (u64)((u64)t_abortsite_2e482 * (u64)((u64)16UL));
+	t__2e484 = (u64)((u64)((u64)((char *)&D_abortsites_2e481)) + (u64)t__2e484);
+	t__2e485 = (u64)(*(u64 *)t__2e484);
+	t__2e486 = (u64)((u64)t__2e484 + (u64)((u64)8UL));
+	t__2e487 = (u64)(*(u32 *)t__2e486);
+	t__2e486 = (u64)((u64)t__2e484 + (u64)((u64)12UL));
+	t__2e488 = (u64)(*(u32 *)t__2e486);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e485, (u64)t__2e487, (u64)t__2e488, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e542:;
+	t__2e543 = (u64)((u64)t_abortsite_2e482 * (u64)((u64)16UL));
+	t__2e543 = (u64)((u64)((u64)((char *)&D_abortsites_2e481)) + (u64)t__2e543);
+	t__2e544 = (u64)(*(u64 *)t__2e543);
+	t__2e545 = (u64)((u64)t__2e543 + (u64)((u64)8UL));
+	t__2e546 = (u64)(*(u32 *)t__2e545);
+	t__2e545 = (u64)((u64)t__2e543 + (u64)((u64)12UL));
+	t__2e547 = (u64)(*(u32 *)t__2e545);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e544, (u64)t__2e546, (u64)t__2e547, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e549:;
+	t__2e550 = (u64)((u64)t_abortsite_2e482 * (u64)((u64)16UL));
+	t__2e550 = (u64)((u64)((u64)((char *)&D_abortsites_2e481)) + (u64)t__2e550);
+	t__2e551 = (u64)(*(u64 *)t__2e550);
+	t__2e552 = (u64)((u64)t__2e550 + (u64)((u64)8UL));
+	t__2e553 = (u64)(*(u32 *)t__2e552);
+	t__2e552 = (u64)((u64)t__2e550 + (u64)((u64)12UL));
+	t__2e554 = (u64)(*(u32 *)t__2e552);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e551, (u64)t__2e553, (u64)t__2e554, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_storage(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e603;
+	u64 t__2e606;
+	u64 t__2e607;
+	u64 t__2e608;
+	u64 t__2e609;
+	u64 t__2e610;
+	u64 t__2e611;
+	u64 t__2e612;
+	u64 t__2e616;
+	u64 t__2e617;
+	u64 t__2e618;
+	u64 t__2e619;
+	u64 t__2e620;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e627;
+	u64 t__2e628;
+	u64 t__2e629;
+	u64 t__2e632;
+	u64 t__2e633;
+	u64 t__2e634;
+	u64 t__2e635;
+	u64 t__2e636;
+	u64 t__2e637;
+	u64 t__2e638;
+	u64 t_abortsite_2e614;
+	u64 t_binding_2e600;
+	u64 t_binding_2e602;
+	u64 t_item_2e601;
+	L_start_2e596:;
+	t_binding_2e600 = (u64)A0;
+	t_binding_2e602 = (u64)A1;
+	L_body_2e597:;
+	t_item_2e601 = (u64)((u64)t_binding_2e600 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e601 = (u32)((u64)1UL);
+	t_item_2e601 = (u64)((u64)t_binding_2e600 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e601 = (u32)((u64)2UL);
+	t_item_2e601 = (u64)((u64)t_binding_2e600 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e601 = (u32)((u64)3UL);
+	t__2e603 = t_binding_2e600;
+	*(u64 *)t_binding_2e602 = (u64)t__2e603;
+	t__2e608 = (u64)(*(u64 *)t_binding_2e602);
+	t__2e609 = (u64)((u64)((u64)0UL) << (((u64)2UL) & 63));
+	t__2e610 = t__2e609;
+	t__2e607 = (u64)((u64)t__2e608 + (u64)t__2e610);
+	t__2e611 = t__2e607;
+	t__2e612 = (u64)(u32)(*(i32 *)t__2e611);
+	t__2e606 = (u64)(u32)(((u32)t__2e612 == (u32)((u64)1UL)));
+	if ((u32)t__2e606) goto L_passed_2e605; else goto L_failed_2e604;
+	L_failed_2e604:;
+	t_abortsite_2e614 = ((u64)0UL);
+	goto L_abort_2e615;
+	L_passed_2e605:;
+	t__2e625 = (u64)(*(u64 *)t_binding_2e602);
+	t__2e626 = (u64)((u64)((u64)1UL) << (((u64)2UL) & 63));
+	t__2e627 = t__2e626;
+	t__2e624 = (u64)((u64)t__2e625 + (u64)t__2e627);
+	t__2e628 = t__2e624;
+	t__2e629 = (u64)(u32)(*(i32 *)t__2e628);
+	t__2e623 = (u64)(u32)(((u32)t__2e629 == (u32)((u64)2UL)));
+	if ((u32)t__2e623) goto L_passed_2e622; else goto L_failed_2e621;
+	L_failed_2e621:;
+	t_abortsite_2e614 = ((u64)1UL);
+	goto L_abort_2e615;
+	L_passed_2e622:;
+	t__2e634 = (u64)(*(u64 *)t_binding_2e602);
+	t__2e635 = (u64)((u64)((u64)4UL) << (((u64)1UL) & 63));
+	t__2e636 = t__2e635;
+	t__2e633 = (u64)((u64)t__2e634 + (u64)t__2e636);
+	t__2e637 = t__2e633;
+	t__2e638 = (u64)(u32)(*(i32 *)t__2e637);
+	t__2e632 = (u64)(u32)(((u32)t__2e638 == (u32)((u64)3UL)));
+	if ((u32)t__2e632) goto L_passed_2e631; else goto L_failed_2e630;
+	L_failed_2e630:;
+	t_abortsite_2e614 = ((u64)2UL);
+	goto L_abort_2e615;
+	L_passed_2e631:;
+	goto L__2e598;
+	L__2e639:;
+	L__2e598:;
+	return;
+	L_abort_2e615:;
+	t__2e616 = (u64)((u64)t_abortsite_2e614 * (u64)((u64)16UL));
+	t__2e616 = (u64)((u64)((u64)((char *)&D_abortsites_2e613)) + (u64)t__2e616);
+	t__2e617 = (u64)(*(u64 *)t__2e616);
+	t__2e618 = (u64)((u64)t__2e616 + (u64)((u64)8UL));
+	t__2e619 = (u64)(*(u32 *)t__2e618);
+	t__2e618 = (u64)((u64)t__2e616 + (u64)((u64)12UL));
+	t__2e620 = (u64)(*(u32 *)t__2e618);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e617, (u64)t__2e619, (u64)t__2e620, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_measurements(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char A1[12] __attribute__((aligned(16)));
+	u64 t__2e648;
+	u64 t__2e652;
+	u64 t__2e653;
+	u64 t__2e654;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t__2e659;
+	u64 t__2e660;
+	u64 t__2e663;
+	u64 t__2e667;
+	u64 t__2e670;
+	u64 t__2e673;
+	u64 t__2e676;
+	u64 t__2e679;
+	u64 t__2e682;
+	u64 t__2e685;
+	u64 t__2e688;
+	u64 t__2e691;
+	u64 t__2e694;
+	u64 t__2e697;
+	u64 t__2e700;
+	u64 t__2e703;
+	u64 t_abortsite_2e650;
+	u64 t_binding_2e644;
+	u64 t_binding_2e664;
+	u64 t_item_2e645;
+	L_start_2e640:;
+	t_binding_2e644 = (u64)A0;
+	t_binding_2e664 = (u64)A1;
+	L_body_2e641:;
+	t_item_2e645 = (u64)((u64)t_binding_2e644 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e645 = (u32)((u64)1UL);
+	t_item_2e645 = (u64)((u64)t_binding_2e644 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e645 = (u32)((u64)2UL);
+	t_item_2e645 = (u64)((u64)t_binding_2e644 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e645 = (u32)((u64)3UL);
+	t__2e648 = (u64)(u32)(((u64)((u64)3UL) == (u64)((u64)3UL)));
+	if ((u32)t__2e648) goto L_passed_2e647; else goto L_failed_2e646;
+	L_failed_2e646:;
+	t_abortsite_2e650 = ((u64)0UL);
+	goto L_abort_2e651;
+	L_passed_2e647:;
+	t__2e660 = (u64)((u64)((u64)3UL) << (((u64)2UL) & 63));
+	t__2e659 = (u64)(u32)(((u64)((u64)12UL) == (u64)t__2e660));
+	if ((u32)t__2e659) goto L_passed_2e658; else goto L_failed_2e657;
+	L_failed_2e657:;
+	t_abortsite_2e650 = ((u64)1UL);
+	goto L_abort_2e651;
+	L_passed_2e658:;
+	t__2e663 = (u64)(u32)(((u64)((u64)0UL) == (u64)((u64)0UL)));
+	if ((u32)t__2e663) goto L_passed_2e662; else goto L_failed_2e661;
+	L_failed_2e661:;
+	t_abortsite_2e650 = ((u64)2UL);
+	goto L_abort_2e651;
+	L_passed_2e662:;
+	BLIT(t_binding_2e664, t_binding_2e644, ((u64)12UL));
+	t__2e667 = (u64)(u32)(((u64)((u64)1UL) == (u64)((u64)1UL)));
+	if ((u32)t__2e667) goto L_passed_2e666; else goto L_failed_2e665;
+	L_failed_2e665:;
+	t_abortsite_2e650 = ((u64)3UL);
+	goto L_abort_2e651;
+	L_passed_2e666:;
+	t__2e670 = (u64)(u32)(((u64)((u64)2UL) == (u64)((u64)2UL)));
+	if ((u32)t__2e670) goto L_passed_2e669; else goto L_failed_2e668;
+	L_failed_2e668:;
+	t_abortsite_2e650 = ((u64)4UL);
+	goto L_abort_2e651;
+	L_passed_2e669:;
+	t__2e673 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e673) goto L_passed_2e672; else goto L_failed_2e671;
+	L_failed_2e671:;
+	t_abortsite_2e650 = ((u64)5UL);
+	goto L_abort_2e651;
+	L_passed_2e672:;
+	t__2e676 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e676) goto L_passed_2e675; else goto L_failed_2e674;
+	L_failed_2e674:;
+	t_abortsite_2e650 = ((u64)6UL);
+	goto L_abort_2e651;
+	L_passed_2e675:;
+	t__2e679 = (u64)(u32)(((u64)((u64)1UL) == (u64)((u64)1UL)));
+	if ((u32)t__2e679) goto L_passed_2e678; else goto L_failed_2e677;
+	L_failed_2e677:;
+	t_abortsite_2e650 = ((u64)7UL);
+	goto L_abort_2e651;
+	L_passed_2e678:;
+	t__2e682 = (u64)(u32)(((u64)((u64)2UL) == (u64)((u64)2UL)));
+	if ((u32)t__2e682) goto L_passed_2e681; else goto L_failed_2e680;
+	L_failed_2e680:;
+	t_abortsite_2e650 = ((u64)8UL);
+	goto L_abort_2e651;
+	L_passed_2e681:;
+	t__2e685 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e685) goto L_passed_2e684; else goto L_failed_2e683;
+	L_failed_2e683:;
+	t_abortsite_2e650 = ((u64)9UL);
+	goto L_abort_2e651;
+	L_passed_2e684:;
+	t__2e688 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e688) goto L_passed_2e687; else goto L_failed_2e686;
+	L_failed_2e686:;
+	t_abortsite_2e650 = ((u64)10UL);
+	goto L_abort_2e651;
+	L_passed_2e687:;
+	t__2e691 = (u64)(u32)(((u64)((u64)1UL) == (u64)((u64)1UL)));
+	if ((u32)t__2e691) goto L_passed_2e690; else goto L_failed_2e689;
+	L_failed_2e689:;
+	t_abortsite_2e650 = ((u64)11UL);
+	goto L_abort_2e651;
+	L_passed_2e690:;
+	t__2e694 = (u64)(u32)(((u64)((u64)2UL) == (u64)((u64)2UL)));
+	if ((u32)t__2e694) goto L_passed_2e693; else goto L_failed_2e692;
+	L_failed_2e692:;
+	t_abortsite_2e650 = ((u64)12UL);
+	goto L_abort_2e651;
+	L_passed_2e693:;
+	t__2e697 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e697) goto L_passed_2e696; else goto L_failed_2e695;
+	L_failed_2e695:;
+	t_abortsite_2e650 = ((u64)13UL);
+	goto L_abort_2e651;
+	L_passed_2e696:;
+	t__2e700 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e700) goto L_passed_2e699; else goto L_failed_2e698;
+	L_failed_2e698:;
+	t_abortsite_2e650 = ((u64)14UL);
+	goto L_abort_2e651;
+	L_passed_2e699:;
+	t__2e703 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e703) goto L_passed_2e702; else goto L_failed_2e701;
+	L_failed_2e701:;
+	t_abortsite_2e650 = ((u64)15UL);
+	goto L_abort_2e651;
+	L_passed_2e702:;
+	goto L__2e642;
+	L__2e704:;
+	L__2e642:;
+	return;
+	L_abort_2e651:;
+	t__2e652 = (u64)((u64)t_abortsite_2e650 * (u64)((u64)16UL));
+	t__2e652 = (u64)((u64)((u64)((char *)&D_abortsites_2e649)) + (u64)t__2e652);
+	t__2e653 = (u64)(*(u64 *)t__2e652);
+	t__2e654 = (u64)((u64)t__2e652 + (u64)((u64)8UL));
+	t__2e655 = (u64)(*(u32 *)t__2e654);
+	t__2e654 = (u64)((u64)t__2e652 + (u64)((u64)12UL));
+	t__2e656 = (u64)(*(u32 *)t__2e654);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e653, (u64)t__2e655, (u64)t__2e656, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_indexing(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char B6[8] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char R9[4] __attribute__((aligned(16)));
+	u64 t__2e715;
+	u64 t__2e718;
+	u64 t__2e721;
+	u64 t__2e722;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e725;
+	u64 t__2e726;
+	u64 t__2e727;
+	u64 t__2e728;
+	u64 t__2e729;
+	u64 t__2e730;
+	u64 t__2e731;
+	u64 t__2e732;
+	u64 t__2e736;
+	u64 t__2e737;
+	u64 t__2e738;
+	u64 t__2e739;
+	u64 t__2e740;
+	u64 t__2e743;
+	u64 t__2e746;
+	u64 t__2e749;
+	u64 t__2e750;
+	u64 t__2e751;
+	u64 t__2e752;
+	u64 t__2e753;
+	u64 t__2e754;
+	u64 t__2e755;
+	u64 t__2e756;
+	u64 t__2e757;
+	u64 t__2e758;
+	u64 t__2e759;
+	u64 t__2e760;
+	u64 t__2e761;
+	u64 t__2e762;
+	u64 t__2e763;
+	u64 t__2e766;
+	u64 t__2e769;
+	u64 t__2e772;
+	u64 t__2e773;
+	u64 t__2e774;
+	u64 t__2e775;
+	u64 t__2e776;
+	u64 t__2e777;
+	u64 t__2e778;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e781;
+	u64 t__2e782;
+	u64 t__2e783;
+	u64 t__2e784;
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e787;
+	u64 t__2e788;
+	u64 t__2e789;
+	u64 t__2e790;
+	u64 t__2e791;
+	u64 t__2e792;
+	u64 t__2e793;
+	u64 t__2e794;
+	u64 t__2e795;
+	u64 t__2e798;
+	u64 t__2e801;
+	u64 t__2e804;
+	u64 t__2e805;
+	u64 t__2e806;
+	u64 t__2e807;
+	u64 t__2e808;
+	u64 t__2e809;
+	u64 t__2e810;
+	u64 t__2e811;
+	u64 t__2e812;
+	u64 t__2e813;
+	u64 t__2e814;
+	u64 t__2e815;
+	u64 t__2e818;
+	u64 t__2e821;
+	u64 t__2e824;
+	u64 t__2e825;
+	u64 t__2e826;
+	u64 t__2e827;
+	u64 t__2e828;
+	u64 t__2e829;
+	u64 t__2e830;
+	u64 t__2e831;
+	u64 t__2e832;
+	u64 t__2e833;
+	u64 t__2e834;
+	u64 t__2e835;
+	u64 t__2e836;
+	u64 t__2e837;
+	u64 t__2e838;
+	u64 t__2e840;
+	u64 t__2e841;
+	u64 t__2e842;
+	u64 t__2e845;
+	u64 t__2e848;
+	u64 t__2e849;
+	u64 t__2e850;
+	u64 t__2e851;
+	u64 t__2e852;
+	u64 t__2e853;
+	u64 t__2e854;
+	u64 t__2e855;
+	u64 t__2e856;
+	u64 t__2e858;
+	u64 t__2e860;
+	u64 t__2e864;
+	u64 t__2e873;
+	u64 t__2e875;
+	u64 t__2e877;
+	u64 t__2e878;
+	u64 t__2e879;
+	u64 t__2e880;
+	u64 t__2e881;
+	u64 t__2e884;
+	u64 t__2e885;
+	u64 t__2e886;
+	u64 t__2e887;
+	u64 t__2e888;
+	u64 t_abortsite_2e734;
+	u64 t_binding_2e709;
+	u64 t_binding_2e711;
+	u64 t_binding_2e712;
+	u64 t_binding_2e839;
+	u64 t_item_2e710;
+	u64 t_object_2e859;
+	u64 t_object_2e863;
+	u64 t_tag_2e865;
+	L_start_2e705:;
+	t_binding_2e709 = (u64)A0;
+	t_binding_2e711 = (u64)A1;
+	t_binding_2e712 = (u64)A2;
+	t_binding_2e839 = (u64)A3;
+	t_object_2e859 = (u64)A4;
+	t_object_2e863 = (u64)A5;
+	L_body_2e706:;
+	t_item_2e710 = (u64)((u64)t_binding_2e709 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e710 = (u32)((u64)1UL);
+	t_item_2e710 = (u64)((u64)t_binding_2e709 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e710 = (u32)((u64)2UL);
+	t_item_2e710 = (u64)((u64)t_binding_2e709 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e710 = (u32)((u64)3UL);
+	*(u64 *)t_binding_2e711 = (u64)t_binding_2e709;
+	*(u64 *)t_binding_2e712 = (u64)t_binding_2e711;
+	t__2e723 = (u64)((i64)(i32)((u64)0UL));
+	t__2e722 = (u64)((u64)t__2e723 * (u64)((u64)4UL));
+	t__2e722 = (u64)((u64)t_binding_2e709 + (u64)t__2e722);
+	t__2e724 = (u64)(u32)(*(i32 *)t__2e722);
+	t__2e721 = (u64)(u32)(((u32)t__2e724 == (u32)((u64)1UL)));
+	t__2e718 = (u64)(u32)t__2e721;
+	if ((u32)t__2e718) goto L__2e719; else goto L__2e720;
+	L__2e719:;
+	t__2e727 = (u64)((i64)(i32)((u64)1UL));
+	t__2e726 = (u64)((u64)t__2e727 * (u64)((u64)4UL));
+	t__2e726 = (u64)((u64)t_binding_2e709 + (u64)t__2e726);
+	t__2e728 = (u64)(u32)(*(i32 *)t__2e726);
+	t__2e725 = (u64)(u32)(((u32)t__2e728 == (u32)((u64)2UL)));
+	t__2e718 = (u64)(u32)t__2e725;
+	goto L__2e720;
+	L__2e720:;
+	t__2e715 = (u64)(u32)t__2e718;
+	if ((u32)t__2e715) goto L__2e716; else goto L__2e717;
+	L__2e716:;
+	t__2e731 = (u64)((i64)(i32)((u64)2UL));
+	t__2e730 = (u64)((u64)t__2e731 * (u64)((u64)4UL));
+	t__2e730 = (u64)((u64)t_binding_2e709 + (u64)t__2e730);
+	t__2e732 = (u64)(u32)(*(i32 *)t__2e730);
+	t__2e729 = (u64)(u32)(((u32)t__2e732 == (u32)((u64)3UL)));
+	t__2e715 = (u64)(u32)t__2e729;
+	goto L__2e717;
+	L__2e717:;
+	if ((u32)t__2e715) goto L_passed_2e714; else goto L_failed_2e713;
+	L_failed_2e713:;
+	t_abortsite_2e734 = ((u64)0UL);
+	goto L_abort_2e735;
+	L_passed_2e714:;
+	t__2e750 = (u64)(*(u64 *)t_binding_2e711);
+	t__2e752 = (u64)((i64)(i32)((u64)0UL));
+	t__2e751 = (u64)((u64)t__2e752 * (u64)((u64)4UL));
+	t__2e751 = (u64)((u64)t__2e750 + (u64)t__2e751);
+	t__2e753 = (u64)(u32)(*(i32 *)t__2e751);
+	t__2e749 = (u64)(u32)(((u32)t__2e753 == (u32)((u64)1UL)));
+	t__2e746 = (u64)(u32)t__2e749;
+	if ((u32)t__2e746) goto L__2e747; else goto L__2e748;
+	L__2e747:;
+	t__2e755 = (u64)(*(u64 *)t_binding_2e711);
+	t__2e757 = (u64)((i64)(i32)((u64)1UL));
+	t__2e756 = (u64)((u64)t__2e757 * (u64)((u64)4UL));
+	t__2e756 = (u64)((u64)t__2e755 + (u64)t__2e756);
+	t__2e758 = (u64)(u32)(*(i32 *)t__2e756);
+	t__2e754 = (u64)(u32)(((u32)t__2e758 == (u32)((u64)2UL)));
+	t__2e746 = (u64)(u32)t__2e754;
+	goto L__2e748;
+	L__2e748:;
+	t__2e743 = (u64)(u32)t__2e746;
+	if ((u32)t__2e743) goto L__2e744; else goto L__2e745;
+	L__2e744:;
+	t__2e760 = (u64)(*(u64 *)t_binding_2e711);
+	t__2e762 = (u64)((i64)(i32)((u64)2UL));
+	t__2e761 = (u64)((u64)t__2e762 * (u64)((u64)4UL));
+	t__2e761 = (u64)((u64)t__2e760 + (u64)t__2e761);
+	t__2e763 = (u64)(u32)(*(i32 *)t__2e761);
+	t__2e759 = (u64)(u32)(((u32)t__2e763 == (u32)((u64)3UL)));
+	t__2e743 = (u64)(u32)t__2e759;
+	goto L__2e745;
+	L__2e745:;
+	if ((u32)t__2e743) goto L_passed_2e742; else goto L_failed_2e741;
+	L_failed_2e741:;
+	t_abortsite_2e734 = ((u64)1UL);
+	goto L_abort_2e735;
+	L_passed_2e742:;
+	t__2e773 = (u64)(*(u64 *)t_binding_2e712);
+	t__2e774 = (u64)(*(u64 *)t__2e773);
+	t__2e776 = (u64)((i64)(i32)((u64)0UL));
+	t__2e775 = (u64)((u64)t__2e776 * (u64)((u64)4UL));
+	t__2e775 = (u64)((u64)t__2e774 + (u64)t__2e775);
+	t__2e777 = (u64)(u32)(*(i32 *)t__2e775);
+	t__2e772 = (u64)(u32)(((u32)t__2e777 == (u32)((u64)1UL)));
+	t__2e769 = (u64)(u32)t__2e772;
+	if ((u32)t__2e769) goto L__2e770; else goto L__2e771;
+	L__2e770:;
+	t__2e779 = (u64)(*(u64 *)t_binding_2e712);
+	t__2e780 = (u64)(*(u64 *)t__2e779);
+	t__2e782 = (u64)((i64)(i32)((u64)1UL));
+	t__2e781 = (u64)((u64)t__2e782 * (u64)((u64)4UL));
+	t__2e781 = (u64)((u64)t__2e780 + (u64)t__2e781);
+	t__2e783 = (u64)(u32)(*(i32 *)t__2e781);
+	t__2e778 = (u64)(u32)(((u32)t__2e783 == (u32)((u64)2UL)));
+	t__2e769 = (u64)(u32)t__2e778;
+	goto L__2e771;
+	L__2e771:;
+	t__2e766 = (u64)(u32)t__2e769;
+	if ((u32)t__2e766) goto L__2e767; else goto L__2e768;
+	L__2e767:;
+	t__2e785 = (u64)(*(u64 *)t_binding_2e712);
+	t__2e786 = (u64)(*(u64 *)t__2e785);
+	t__2e788 = (u64)((i64)(i32)((u64)2UL));
+	t__2e787 = (u64)((u64)t__2e788 * (u64)((u64)4UL));
+	t__2e787 = (u64)((u64)t__2e786 + (u64)t__2e787);
+	t__2e789 = (u64)(u32)(*(i32 *)t__2e787);
+	t__2e784 = (u64)(u32)(((u32)t__2e789 == (u32)((u64)3UL)));
+	t__2e766 = (u64)(u32)t__2e784;
+	goto L__2e768;
+	L__2e768:;
+	if ((u32)t__2e766) goto L_passed_2e765; else goto L_failed_2e764;
+	L_failed_2e764:;
+	t_abortsite_2e734 = ((u64)2UL);
+	goto L_abort_2e735;
+	L_passed_2e765:;
+	t__2e791 = (u64)((i64)(i32)((u64)0UL));
+	t__2e790 = (u64)((u64)t__2e791 * (u64)((u64)4UL));
+	t__2e790 = (u64)((u64)t_binding_2e709 + (u64)t__2e790);
+	*(u32 *)t__2e790 = (u32)((u64)5UL);
+	t__2e793 = (u64)((i64)(i32)((u64)1UL));
+	t__2e792 = (u64)((u64)t__2e793 * (u64)((u64)4UL));
+	t__2e792 = (u64)((u64)t_binding_2e709 + (u64)t__2e792);
+	*(u32 *)t__2e792 = (u32)((u64)6UL);
+	t__2e795 = (u64)((i64)(i32)((u64)2UL));
+	t__2e794 = (u64)((u64)t__2e795 * (u64)((u64)4UL));
+	t__2e794 = (u64)((u64)t_binding_2e709 + (u64)t__2e794);
+	*(u32 *)t__2e794 = (u32)((u64)7UL);
+	t__2e806 = (u64)((i64)(i32)((u64)0UL));
+	t__2e805 = (u64)((u64)t__2e806 * (u64)((u64)4UL));
+	t__2e805 = (u64)((u64)t_binding_2e709 + (u64)t__2e805);
+	t__2e807 = (u64)(u32)(*(i32 *)t__2e805);
+	t__2e804 = (u64)(u32)(((u32)t__2e807 == (u32)((u64)5UL)));
+	t__2e801 = (u64)(u32)t__2e804;
+	if ((u32)t__2e801) goto L__2e802; else goto L__2e803;
+	L__2e802:;
+	t__2e810 = (u64)((i64)(i32)((u64)1UL));
+	t__2e809 = (u64)((u64)t__2e810 * (u64)((u64)4UL));
+	t__2e809 = (u64)((u64)t_binding_2e709 + (u64)t__2e809);
+	t__2e811 = (u64)(u32)(*(i32 *)t__2e809);
+	t__2e808 = (u64)(u32)(((u32)t__2e811 == (u32)((u64)6UL)));
+	t__2e801 = (u64)(u32)t__2e808;
+	goto L__2e803;
+	L__2e803:;
+	t__2e798 = (u64)(u32)t__2e801;
+	if ((u32)t__2e798) goto L__2e799; else goto L__2e800;
+	L__2e799:;
+	t__2e814 = (u64)((i64)(i32)((u64)2UL));
+	t__2e813 = (u64)((u64)t__2e814 * (u64)((u64)4UL));
+	t__2e813 = (u64)((u64)t_binding_2e709 + (u64)t__2e813);
+	t__2e815 = (u64)(u32)(*(i32 *)t__2e813);
+	t__2e812 = (u64)(u32)(((u32)t__2e815 == (u32)((u64)7UL)));
+	t__2e798 = (u64)(u32)t__2e812;
+	goto L__2e800;
+	L__2e800:;
+	if ((u32)t__2e798) goto L_passed_2e797; else goto L_failed_2e796;
+	L_failed_2e796:;
+	t_abortsite_2e734 = ((u64)3UL);
+	goto L_abort_2e735;
+	L_passed_2e797:;
+	t__2e825 = (u64)(*(u64 *)t_binding_2e711);
+	t__2e827 = (u64)((i64)(i32)((u64)0UL));
+	t__2e826 = (u64)((u64)t__2e827 * (u64)((u64)4UL));
+	t__2e826 = (u64)((u64)t__2e825 + (u64)t__2e826);
+	t__2e828 = (u64)(u32)(*(i32 *)t__2e826);
+	t__2e824 = (u64)(u32)(((u32)t__2e828 == (u32)((u64)5UL)));
+	t__2e821 = (u64)(u32)t__2e824;
+	if ((u32)t__2e821) goto L__2e822; else goto L__2e823;
+	L__2e822:;
+	t__2e830 = (u64)(*(u64 *)t_binding_2e711);
+	t__2e832 = (u64)((i64)(i32)((u64)1UL));
+	t__2e831 = (u64)((u64)t__2e832 * (u64)((u64)4UL));
+	t__2e831 = (u64)((u64)t__2e830 + (u64)t__2e831);
+	t__2e833 = (u64)(u32)(*(i32 *)t__2e831);
+	t__2e829 = (u64)(u32)(((u32)t__2e833 == (u32)((u64)6UL)));
+	t__2e821 = (u64)(u32)t__2e829;
+	goto L__2e823;
+	L__2e823:;
+	t__2e818 = (u64)(u32)t__2e821;
+	if ((u32)t__2e818) goto L__2e819; else goto L__2e820;
+	L__2e819:;
+	t__2e835 = (u64)(*(u64 *)t_binding_2e711);
+	t__2e837 = (u64)((i64)(i32)((u64)2UL));
+	t__2e836 = (u64)((u64)t__2e837 * (u64)((u64)4UL));
+	t__2e836 = (u64)((u64)t__2e835 + (u64)t__2e836);
+	t__2e838 = (u64)(u32)(*(i32 *)t__2e836);
+	t__2e834 = (u64)(u32)(((u32)t__2e838 == (u32)((u64)7UL)));
+	t__2e818 = (u64)(u32)t__2e834;
+	goto L__2e820;
+	L__2e820:;
+	if ((u32)t__2e818) goto L_passed_2e817; else goto L_failed_2e816;
+	L_failed_2e816:;
+	t_abortsite_2e734 = ((u64)4UL);
+	goto L_abort_2e735;
+	L_passed_2e817:;
+	t__2e841 = (u64)((i64)(i32)((u64)0UL));
+	t__2e840 = (u64)((u64)t__2e841 * (u64)((u64)4UL));
+	t__2e840 = (u64)((u64)t_binding_2e709 + (u64)t__2e840);
+	*(u64 *)t_binding_2e839 = (u64)t__2e840;
+	t__2e842 = (u64)(*(u64 *)t_binding_2e839);
+	*(u32 *)t__2e842 = (u32)((u64)1337UL);
+	t__2e850 = (u64)((i64)(i32)((u64)0UL));
+	t__2e849 = (u64)((u64)t__2e850 * (u64)((u64)4UL));
+	t__2e849 = (u64)((u64)t_binding_2e709 + (u64)t__2e849);
+	t__2e851 = (u64)(u32)(*(i32 *)t__2e849);
+	t__2e848 = (u64)(u32)(((u32)t__2e851 == (u32)((u64)1337UL)));
+	t__2e845 = (u64)(u32)t__2e848;
+	if ((u32)t__2e845) goto L__2e846; else goto L__2e847;
+	L__2e846:;
+	t__2e853 = (u64)(*(u64 *)t_binding_2e711);
+	t__2e855 = (u64)((i64)(i32)((u64)0UL));
+	t__2e854 = (u64)((u64)t__2e855 * (u64)((u64)4UL));
+	t__2e854 = (u64)((u64)t__2e853 + (u64)t__2e854);
+	t__2e856 = (u64)(u32)(*(i32 *)t__2e854);
+	t__2e852 = (u64)(u32)(((u32)t__2e856 == (u32)((u64)1337UL)));
+	t__2e845 = (u64)(u32)t__2e852;
+	goto L__2e847;
+	L__2e847:;
+	if ((u32)t__2e845) goto L_passed_2e844; else goto L_failed_2e843;
+	L_failed_2e843:;
+	t_abortsite_2e734 = ((u64)5UL);
+	goto L_abort_2e735;
+	L_passed_2e844:;
+	*(u32 *)t_object_2e859 = (u32)((u64)3532310079UL);
+	t__2e860 = (u64)((u64)t_object_2e859 + (u64)((u64)4UL));
+	*(u32 *)t__2e860 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e863 = (u64)((u64)0UL);
+	t__2e864 = (u64)((u64)t_object_2e863 + (u64)((u64)8UL));
+	*(u64 *)t__2e864 = (u64)((u64)0UL);
+	t__2e864 = (u64)((u64)t__2e864 + (u64)((u64)8UL));
+	*(u64 *)t__2e864 = (u64)((u64)0UL);
+	BLIT((u64)B6, t_object_2e859, 8);
+	BLIT((u64)B7, ((u64)((char *)&D_strliteral_2e862)), 24);
+	BLIT((u64)B8, t_object_2e863, 24);
+	t__2e858 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R9, (u64)B6, (u64)B7, (u64)B8);
+	t_tag_2e865 = (u64)(*(u32 *)t__2e858);
+	t__2e873 = (u64)(u32)(((u32)t_tag_2e865 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e873) goto L_member_2e870; else goto L__2e872;
+	L__2e872:;
+	t__2e875 = (u64)(u32)(((u32)t_tag_2e865 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e875) goto L_member_2e871; else goto L__2e874;
+	L__2e874:;
+	goto L_matches_2e869;
+	L_member_2e870:;
+	goto L_matches_2e869;
+	L_member_2e871:;
+	goto L_matches_2e868;
+	L_matches_2e868:;
+	goto L__2e866;
+	L_matches_2e869:;
+	t_abortsite_2e734 = ((u64)6UL);
+	goto L_abort_2e876;
+	L__2e882:;
+	L__2e867:;
+	t_abortsite_2e734 = ((u64)7UL);
+	goto L_abort_2e883;
+	L__2e866:;
+	goto L__2e707;
+	L__2e889:;
+	L__2e707:;
+	return;
+	L_abort_2e735:;
+	t__2e736 = (u64)((u64)t_abortsite_2e734 * (u64)((u64)16UL));
+	t__2e736 = (u64)((u64)((u64)((char *)&D_abortsites_2e733)) + (u64)t__2e736);
+	t__2e737 = (u64)(*(u64 *)t__2e736);
+	t__2e738 = (u64)((u64)t__2e736 + (u64)((u64)8UL));
+	t__2e739 = (u64)(*(u32 *)t__2e738);
+	t__2e738 = (u64)((u64)t__2e736 + (u64)((u64)12UL));
+	t__2e740 = (u64)(*(u32 *)t__2e738);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e737, (u64)t__2e739, (u64)t__2e740, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e876:;
+	t__2e877 = (u64)((u64)t_abortsite_2e734 * (u64)((u64)16UL));
+	t__2e877 = (u64)((u64)((u64)((char *)&D_abortsites_2e733)) + (u64)t__2e877);
+	t__2e878 = (u64)(*(u64 *)t__2e877);
+	t__2e879 = (u64)((u64)t__2e877 + (u64)((u64)8UL));
+	t__2e880 = (u64)(*(u32 *)t__2e879);
+	t__2e879 = (u64)((u64)t__2e877 + (u64)((u64)12UL));
+	t__2e881 = (u64)(*(u32 *)t__2e879);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e878, (u64)t__2e880, (u64)t__2e881, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e883:;
+	t__2e884 = (u64)((u64)t_abortsite_2e734 * (u64)((u64)16UL));
+	t__2e884 = (u64)((u64)((u64)((char *)&D_abortsites_2e733)) + (u64)t__2e884);
+	t__2e885 = (u64)(*(u64 *)t__2e884);
+	t__2e886 = (u64)((u64)t__2e884 + (u64)((u64)8UL));
+	t__2e887 = (u64)(*(u32 *)t__2e886);
+	t__2e886 = (u64)((u64)t__2e884 + (u64)((u64)12UL));
+	t__2e888 = (u64)(*(u32 *)t__2e886);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e885, (u64)t__2e887, (u64)t__2e888, (u64)((u64)4UL));
+	__builtin_trap();
+}
@@ -0,0 +1,373 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[20]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e23 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e23 D_abortsites_2e23 __asm__("abortsites.23") __attribute__((used, section(".data.rel.ro.abortsites.23"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_dimensions(void) __asm__("dimensions") __attribute__((used, section(".text.dimensions")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\060\062\055\151\156\164\145\147\145\162\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 20U, 20U };
+static struct S_abortsites_2e23 D_abortsites_2e23 = { (char *)((char *)&D_strliteral_2e1) + 0, 3U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 4U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 5U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 6U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 7U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 8U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 10U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 12U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 14U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 15U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 17U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_dimensions)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_dimensions(void) {
+	u64 t__2e100;
+	u64 t__2e101;
+	u64 t__2e102;
+	u64 t__2e105;
+	u64 t__2e108;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e113;
+	u64 t__2e114;
+	u64 t__2e117;
+	u64 t__2e120;
+	u64 t__2e123;
+	u64 t__2e124;
+	u64 t__2e125;
+	u64 t__2e126;
+	u64 t__2e129;
+	u64 t__2e13;
+	u64 t__2e132;
+	u64 t__2e135;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e141;
+	u64 t__2e142;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e149;
+	u64 t__2e152;
+	u64 t__2e155;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e16;
+	u64 t__2e19;
+	u64 t__2e20;
+	u64 t__2e21;
+	u64 t__2e22;
+	u64 t__2e26;
+	u64 t__2e27;
+	u64 t__2e28;
+	u64 t__2e29;
+	u64 t__2e30;
+	u64 t__2e33;
+	u64 t__2e36;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e45;
+	u64 t__2e48;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e54;
+	u64 t__2e57;
+	u64 t__2e60;
+	u64 t__2e63;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e66;
+	u64 t__2e69;
+	u64 t__2e72;
+	u64 t__2e75;
+	u64 t__2e76;
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e81;
+	u64 t__2e84;
+	u64 t__2e87;
+	u64 t__2e88;
+	u64 t__2e89;
+	u64 t__2e90;
+	u64 t__2e93;
+	u64 t__2e96;
+	u64 t__2e99;
+	u64 t_abortsite_2e24;
+	L_start_2e7:;
+	L_body_2e8:;
+	t__2e19 = (u64)(u32)(((u64)((u64)1UL) == (u64)((u64)1UL)));
+	t__2e16 = (u64)(u32)t__2e19;
+	if ((u32)t__2e16) goto L__2e17; else goto L__2e18;
+	L__2e17:;
+	t__2e20 = (u64)(u32)(((u64)((u64)1UL) == (u64)((u64)1UL)));
+	t__2e16 = (u64)(u32)t__2e20;
+	goto L__2e18;
+	L__2e18:;
+	t__2e13 = (u64)(u32)t__2e16;
+	if ((u32)t__2e13) goto L__2e14; else goto L__2e15;
+	L__2e14:;
+	t__2e22 = (u64)((u64)((u64)1UL) % (u64)((u64)1UL));
+	t__2e21 = (u64)(u32)(((u64)t__2e22 == (u64)((u64)0UL)));
+	t__2e13 = (u64)(u32)t__2e21;
+	goto L__2e15;
+	L__2e15:;
+	if ((u32)t__2e13) goto L_passed_2e12; else goto L_failed_2e11;
+	L_failed_2e11:;
+	t_abortsite_2e24 = ((u64)0UL);
+	goto L_abort_2e25;
+	L_passed_2e12:;
+	t__2e39 = (u64)(u32)(((u64)((u64)2UL) == (u64)((u64)2UL)));
+	t__2e36 = (u64)(u32)t__2e39;
+	if ((u32)t__2e36) goto L__2e37; else goto L__2e38;
+	L__2e37:;
+	t__2e40 = (u64)(u32)(((u64)((u64)2UL) == (u64)((u64)2UL)));
+	t__2e36 = (u64)(u32)t__2e40;
+	goto L__2e38;
+	L__2e38:;
+	t__2e33 = (u64)(u32)t__2e36;
+	if ((u32)t__2e33) goto L__2e34; else goto L__2e35;
+	L__2e34:;
+	t__2e42 = (u64)((u64)((u64)2UL) & (u64)((u64)1UL));
+	t__2e41 = (u64)(u32)(((u64)t__2e42 == (u64)((u64)0UL)));
+	t__2e33 = (u64)(u32)t__2e41;
+	goto L__2e35;
+	L__2e35:;
+	if ((u32)t__2e33) goto L_passed_2e32; else goto L_failed_2e31;
+	L_failed_2e31:;
+	t_abortsite_2e24 = ((u64)1UL);
+	goto L_abort_2e25;
+	L_passed_2e32:;
+	t__2e51 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	t__2e48 = (u64)(u32)t__2e51;
+	if ((u32)t__2e48) goto L__2e49; else goto L__2e50;
+	L__2e49:;
+	t__2e52 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	t__2e48 = (u64)(u32)t__2e52;
+	goto L__2e50;
+	L__2e50:;
+	t__2e45 = (u64)(u32)t__2e48;
+	if ((u32)t__2e45) goto L__2e46; else goto L__2e47;
+	L__2e46:;
+	t__2e54 = (u64)((u64)((u64)4UL) & (u64)((u64)3UL));
+	t__2e53 = (u64)(u32)(((u64)t__2e54 == (u64)((u64)0UL)));
+	t__2e45 = (u64)(u32)t__2e53;
+	goto L__2e47;
+	L__2e47:;
+	if ((u32)t__2e45) goto L_passed_2e44; else goto L_failed_2e43;
+	L_failed_2e43:;
+	t_abortsite_2e24 = ((u64)2UL);
+	goto L_abort_2e25;
+	L_passed_2e44:;
+	t__2e63 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	t__2e60 = (u64)(u32)t__2e63;
+	if ((u32)t__2e60) goto L__2e61; else goto L__2e62;
+	L__2e61:;
+	t__2e64 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	t__2e60 = (u64)(u32)t__2e64;
+	goto L__2e62;
+	L__2e62:;
+	t__2e57 = (u64)(u32)t__2e60;
+	if ((u32)t__2e57) goto L__2e58; else goto L__2e59;
+	L__2e58:;
+	t__2e66 = (u64)((u64)((u64)8UL) & (u64)((u64)7UL));
+	t__2e65 = (u64)(u32)(((u64)t__2e66 == (u64)((u64)0UL)));
+	t__2e57 = (u64)(u32)t__2e65;
+	goto L__2e59;
+	L__2e59:;
+	if ((u32)t__2e57) goto L_passed_2e56; else goto L_failed_2e55;
+	L_failed_2e55:;
+	t_abortsite_2e24 = ((u64)3UL);
+	goto L_abort_2e25;
+	L_passed_2e56:;
+	t__2e75 = (u64)(u32)(((u64)((u64)1UL) == (u64)((u64)1UL)));
+	t__2e72 = (u64)(u32)t__2e75;
+	if ((u32)t__2e72) goto L__2e73; else goto L__2e74;
+	L__2e73:;
+	t__2e76 = (u64)(u32)(((u64)((u64)1UL) == (u64)((u64)1UL)));
+	t__2e72 = (u64)(u32)t__2e76;
+	goto L__2e74;
+	L__2e74:;
+	t__2e69 = (u64)(u32)t__2e72;
+	if ((u32)t__2e69) goto L__2e70; else goto L__2e71;
+	L__2e70:;
+	t__2e78 = (u64)((u64)((u64)1UL) % (u64)((u64)1UL));
+	t__2e77 = (u64)(u32)(((u64)t__2e78 == (u64)((u64)0UL)));
+	t__2e69 = (u64)(u32)t__2e77;
+	goto L__2e71;
+	L__2e71:;
+	if ((u32)t__2e69) goto L_passed_2e68; else goto L_failed_2e67;
+	L_failed_2e67:;
+	t_abortsite_2e24 = ((u64)4UL);
+	goto L_abort_2e25;
+	L_passed_2e68:;
+	t__2e87 = (u64)(u32)(((u64)((u64)2UL) == (u64)((u64)2UL)));
+	t__2e84 = (u64)(u32)t__2e87;
+	if ((u32)t__2e84) goto L__2e85; else goto L__2e86;
+	L__2e85:;
+	t__2e88 = (u64)(u32)(((u64)((u64)2UL) == (u64)((u64)2UL)));
+	t__2e84 = (u64)(u32)t__2e88;
+	goto L__2e86;
+	L__2e86:;
+	t__2e81 = (u64)(u32)t__2e84;
+	if ((u32)t__2e81) goto L__2e82; else goto L__2e83;
+	L__2e82:;
+	t__2e90 = (u64)((u64)((u64)2UL) & (u64)((u64)1UL));
+	t__2e89 = (u64)(u32)(((u64)t__2e90 == (u64)((u64)0UL)));
+	t__2e81 = (u64)(u32)t__2e89;
+	goto L__2e83;
+	L__2e83:;
+	if ((u32)t__2e81) goto L_passed_2e80; else goto L_failed_2e79;
+	L_failed_2e79:;
+	t_abortsite_2e24 = ((u64)5UL);
+	goto L_abort_2e25;
+	L_passed_2e80:;
+	t__2e99 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	t__2e96 = (u64)(u32)t__2e99;
+	if ((u32)t__2e96) goto L__2e97; else goto L__2e98;
+	L__2e97:;
+	t__2e100 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	t__2e96 = (u64)(u32)t__2e100;
+	goto L__2e98;
+	L__2e98:;
+	t__2e93 = (u64)(u32)t__2e96;
+	if ((u32)t__2e93) goto L__2e94; else goto L__2e95;
+	L__2e94:;
+	t__2e102 = (u64)((u64)((u64)4UL) & (u64)((u64)3UL));
+	t__2e101 = (u64)(u32)(((u64)t__2e102 == (u64)((u64)0UL)));
+	t__2e93 = (u64)(u32)t__2e101;
+	goto L__2e95;
+	L__2e95:;
+	if ((u32)t__2e93) goto L_passed_2e92; else goto L_failed_2e91;
+	L_failed_2e91:;
+	t_abortsite_2e24 = ((u64)6UL);
+	goto L_abort_2e25;
+	L_passed_2e92:;
+	t__2e111 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	t__2e108 = (u64)(u32)t__2e111;
+	if ((u32)t__2e108) goto L__2e109; else goto L__2e110;
+	L__2e109:;
+	t__2e112 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	t__2e108 = (u64)(u32)t__2e112;
+	goto L__2e110;
+	L__2e110:;
+	t__2e105 = (u64)(u32)t__2e108;
+	if ((u32)t__2e105) goto L__2e106; else goto L__2e107;
+	L__2e106:;
+	t__2e114 = (u64)((u64)((u64)8UL) & (u64)((u64)7UL));
+	t__2e113 = (u64)(u32)(((u64)t__2e114 == (u64)((u64)0UL)));
+	t__2e105 = (u64)(u32)t__2e113;
+	goto L__2e107;
+	L__2e107:;
+	if ((u32)t__2e105) goto L_passed_2e104; else goto L_failed_2e103;
+	L_failed_2e103:;
+	t_abortsite_2e24 = ((u64)7UL);
+	goto L_abort_2e25;
+	L_passed_2e104:;
+	t__2e123 = (u64)(u32)(((u64)((u64)4UL) >= (u64)((u64)4UL)));
+	t__2e120 = (u64)(u32)t__2e123;
+	if ((u32)t__2e120) goto L__2e121; else goto L__2e122;
+	L__2e121:;
+	t__2e124 = (u64)(u32)(((u64)((u64)4UL) >= (u64)((u64)4UL)));
+	t__2e120 = (u64)(u32)t__2e124;
+	goto L__2e122;
+	L__2e122:;
+	t__2e117 = (u64)(u32)t__2e120;
+	if ((u32)t__2e117) goto L__2e118; else goto L__2e119;
+	L__2e118:;
+	t__2e126 = (u64)((u64)((u64)4UL) & (u64)((u64)3UL));
+	t__2e125 = (u64)(u32)(((u64)t__2e126 == (u64)((u64)0UL)));
+	t__2e117 = (u64)(u32)t__2e125;
+	goto L__2e119;
+	L__2e119:;
+	if ((u32)t__2e117) goto L_passed_2e116; else goto L_failed_2e115;
+	L_failed_2e115:;
+	t_abortsite_2e24 = ((u64)8UL);
+	goto L_abort_2e25;
+	L_passed_2e116:;
+	t__2e135 = (u64)(u32)(((u64)((u64)4UL) >= (u64)((u64)4UL)));
+	t__2e132 = (u64)(u32)t__2e135;
+	if ((u32)t__2e132) goto L__2e133; else goto L__2e134;
+	L__2e133:;
+	t__2e136 = (u64)(u32)(((u64)((u64)4UL) >= (u64)((u64)4UL)));
+	t__2e132 = (u64)(u32)t__2e136;
+	goto L__2e134;
+	L__2e134:;
+	t__2e129 = (u64)(u32)t__2e132;
+	if ((u32)t__2e129) goto L__2e130; else goto L__2e131;
+	L__2e130:;
+	t__2e138 = (u64)((u64)((u64)4UL) & (u64)((u64)3UL));
+	t__2e137 = (u64)(u32)(((u64)t__2e138 == (u64)((u64)0UL)));
+	t__2e129 = (u64)(u32)t__2e137;
+	goto L__2e131;
+	L__2e131:;
+	if ((u32)t__2e129) goto L_passed_2e128; else goto L_failed_2e127;
+	L_failed_2e127:;
+	t_abortsite_2e24 = ((u64)9UL);
+	goto L_abort_2e25;
+	L_passed_2e128:;
+	t__2e142 = (u64)((u64)((u64)8UL) & (u64)((u64)7UL));
+	t__2e141 = (u64)(u32)(((u64)t__2e142 == (u64)((u64)0UL)));
+	if ((u32)t__2e141) goto L_passed_2e140; else goto L_failed_2e139;
+	L_failed_2e139:;
+	t_abortsite_2e24 = ((u64)10UL);
+	goto L_abort_2e25;
+	L_passed_2e140:;
+	t__2e146 = (u64)((u64)((u64)8UL) & (u64)((u64)7UL));
+	t__2e145 = (u64)(u32)(((u64)t__2e146 == (u64)((u64)0UL)));
+	if ((u32)t__2e145) goto L_passed_2e144; else goto L_failed_2e143;
+	L_failed_2e143:;
+	t_abortsite_2e24 = ((u64)11UL);
+	goto L_abort_2e25;
+	L_passed_2e144:;
+	t__2e155 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	t__2e152 = (u64)(u32)t__2e155;
+	if ((u32)t__2e152) goto L__2e153; else goto L__2e154;
+	L__2e153:;
+	t__2e156 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	t__2e152 = (u64)(u32)t__2e156;
+	goto L__2e154;
+	L__2e154:;
+	t__2e149 = (u64)(u32)t__2e152;
+	if ((u32)t__2e149) goto L__2e150; else goto L__2e151;
+	L__2e150:;
+	t__2e158 = (u64)((u64)((u64)4UL) & (u64)((u64)3UL));
+	t__2e157 = (u64)(u32)(((u64)t__2e158 == (u64)((u64)0UL)));
+	t__2e149 = (u64)(u32)t__2e157;
+	goto L__2e151;
+	L__2e151:;
+	if ((u32)t__2e149) goto L_passed_2e148; else goto L_failed_2e147;
+	L_failed_2e147:;
+	t_abortsite_2e24 = ((u64)12UL);
+	goto L_abort_2e25;
+	L_passed_2e148:;
+	goto L__2e9;
+	L__2e159:;
+	L__2e9:;
+	return;
+	L_abort_2e25:;
+	t__2e26 = (u64)((u64)t_abortsite_2e24 * (u64)((u64)16UL));
+	t__2e26 = (u64)((u64)((u64)((char *)&D_abortsites_2e23)) + (u64)t__2e26);
+	t__2e27 = (u64)(*(u64 *)t__2e26);
+	t__2e28 = (u64)((u64)t__2e26 + (u64)((u64)8UL));
+	t__2e29 = (u64)(*(u32 *)t__2e28);
+	t__2e28 = (u64)((u64)t__2e26 + (u64)((u64)12UL));
+	t__2e30 = (u64)(*(u32 *)t__2e28);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e27, (u64)t__2e29, (u64)t__2e30, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,2707 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[20]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e19 { u8 f0; u8 f1; u8 f2; u8 f3[14]; u8 f4; u8 f5; u8 f6; u8 f7[18]; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12[5]; u8 f13; u8 f14; u8 f15; u8 f16[2]; u8 f17; u8 f18; };
+struct __attribute__((packed)) S_strliteral_2e20 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e55 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7[18]; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12[5]; u8 f13; u8 f14; u8 f15; u8 f16[2]; u8 f17; u8 f18; };
+struct __attribute__((packed)) S_strliteral_2e56 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e75 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[14]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e76 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e95 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[17]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e96 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e115 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[32]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e116 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e135 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[28]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[18]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e136 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e155 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[18]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e156 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e175 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[23]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e176 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e195 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[15]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e196 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e215 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[24]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e216 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e235 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[13]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e236 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e255 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[26]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[9]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e256 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e275 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[26]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[10]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e276 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e295 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[17]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[18]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e296 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e315 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7[17]; u8 f8; u8 f9; u8 f10; u8 f11[16]; u8 f12; u8 f13; };
+struct __attribute__((packed)) S_strliteral_2e316 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e335 { u8 f0; u8 f1; u8 f2; u8 f3[16]; u8 f4; u8 f5; u8 f6; u8 f7[18]; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12[15]; u8 f13; u8 f14; u8 f15; u8 f16[2]; u8 f17; u8 f18; };
+struct __attribute__((packed)) S_strliteral_2e336 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e355 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[19]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e356 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e375 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[14]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e376 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e395 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[11]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e396 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e415 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[29]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e416 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e435 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[19]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e436 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e455 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[27]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e456 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e475 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[18]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e476 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e495 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[13]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[9]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e496 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e515 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[13]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[17]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e516 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e535 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[13]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[8]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e536 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e555 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[17]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e556 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e575 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[23]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e576 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e595 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[9]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e596 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e615 { u8 f0; u8 f1; u8 f2; u8 f3[33]; u8 f4; u8 f5; };
+struct __attribute__((packed)) S_strliteral_2e616 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e635 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[14]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e636 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e673 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[22]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e674 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e693 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[23]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e694 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e713 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[22]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e714 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e733 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[35]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e734 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e753 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[49]; u8 f9; u8 f10; u8 f11; u8 f12[2]; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e754 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e36 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; char *f81; u32 f82; u32 f83; char *f84; u32 f85; u32 f86; char *f87; u32 f88; u32 f89; char *f90; u32 f91; u32 f92; char *f93; u32 f94; u32 f95; char *f96; u32 f97; u32 f98; char *f99; u32 f100; u32 f101; char *f102; u32 f103; u32 f104; char *f105; u32 f106; u32 f107; char *f108; u32 f109; u32 f110; char *f111; u32 f112; u32 f113; char *f114; u32 f115; u32 f116; char *f117; u32 f118; u32 f119; char *f120; u32 f121; u32 f122; char *f123; u32 f124; u32 f125; char *f126; u32 f127; u32 f128; char *f129; u32 f130; u32 f131; char *f132; u32 f133; u32 f134; char *f135; u32 f136; u32 f137; char *f138; u32 f139; u32 f140; char *f141; u32 f142; u32 f143; char *f144; u32 f145; u32 f146; char *f147; u32 f148; u32 f149; char *f150; u32 f151; u32 f152; char *f153; u32 f154; u32 f155; char *f156; u32 f157; u32 f158; char *f159; u32 f160; u32 f161; char *f162; u32 f163; u32 f164; char *f165; u32 f166; u32 f167; char *f168; u32 f169; u32 f170; char *f171; u32 f172; u32 f173; char *f174; u32 f175; u32 f176; char *f177; u32 f178; u32 f179; char *f180; u32 f181; u32 f182; char *f183; u32 f184; u32 f185; char *f186; u32 f187; u32 f188; char *f189; u32 f190; u32 f191; char *f192; u32 f193; u32 f194; char *f195; u32 f196; u32 f197; char *f198; u32 f199; u32 f200; char *f201; u32 f202; u32 f203; char *f204; u32 f205; u32 f206; char *f207; u32 f208; u32 f209; char *f210; u32 f211; u32 f212; char *f213; u32 f214; u32 f215; char *f216; u32 f217; u32 f218; char *f219; u32 f220; u32 f221; };
+struct __attribute__((packed)) S_abortsites_2e791 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; };
+struct __attribute__((packed)) S_strdata_2e910 { u8 f0[62]; };
+struct __attribute__((packed)) S_strliteral_2e911 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e892 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e950 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e19 D_strdata_2e19 __asm__("strdata.19") __attribute__((used, section(".rodata.strdata.19"), aligned(8)));
+static struct S_strliteral_2e20 D_strliteral_2e20 __asm__("strliteral.20") __attribute__((used, section(".data.rel.ro.strliteral.20"), aligned(8)));
+static const struct S_strdata_2e55 D_strdata_2e55 __asm__("strdata.55") __attribute__((used, section(".rodata.strdata.55"), aligned(8)));
+static struct S_strliteral_2e56 D_strliteral_2e56 __asm__("strliteral.56") __attribute__((used, section(".data.rel.ro.strliteral.56"), aligned(8)));
+static const struct S_strdata_2e75 D_strdata_2e75 __asm__("strdata.75") __attribute__((used, section(".rodata.strdata.75"), aligned(8)));
+static struct S_strliteral_2e76 D_strliteral_2e76 __asm__("strliteral.76") __attribute__((used, section(".data.rel.ro.strliteral.76"), aligned(8)));
+static const struct S_strdata_2e95 D_strdata_2e95 __asm__("strdata.95") __attribute__((used, section(".rodata.strdata.95"), aligned(8)));
+static struct S_strliteral_2e96 D_strliteral_2e96 __asm__("strliteral.96") __attribute__((used, section(".data.rel.ro.strliteral.96"), aligned(8)));
+static const struct S_strdata_2e115 D_strdata_2e115 __asm__("strdata.115") __attribute__((used, section(".rodata.strdata.115"), aligned(8)));
+static struct S_strliteral_2e116 D_strliteral_2e116 __asm__("strliteral.116") __attribute__((used, section(".data.rel.ro.strliteral.116"), aligned(8)));
+static const struct S_strdata_2e135 D_strdata_2e135 __asm__("strdata.135") __attribute__((used, section(".rodata.strdata.135"), aligned(8)));
+static struct S_strliteral_2e136 D_strliteral_2e136 __asm__("strliteral.136") __attribute__((used, section(".data.rel.ro.strliteral.136"), aligned(8)));
+static const struct S_strdata_2e155 D_strdata_2e155 __asm__("strdata.155") __attribute__((used, section(".rodata.strdata.155"), aligned(8)));
+static struct S_strliteral_2e156 D_strliteral_2e156 __asm__("strliteral.156") __attribute__((used, section(".data.rel.ro.strliteral.156"), aligned(8)));
+static const struct S_strdata_2e175 D_strdata_2e175 __asm__("strdata.175") __attribute__((used, section(".rodata.strdata.175"), aligned(8)));
+static struct S_strliteral_2e176 D_strliteral_2e176 __asm__("strliteral.176") __attribute__((used, section(".data.rel.ro.strliteral.176"), aligned(8)));
+static const struct S_strdata_2e195 D_strdata_2e195 __asm__("strdata.195") __attribute__((used, section(".rodata.strdata.195"), aligned(8)));
+static struct S_strliteral_2e196 D_strliteral_2e196 __asm__("strliteral.196") __attribute__((used, section(".data.rel.ro.strliteral.196"), aligned(8)));
+static const struct S_strdata_2e215 D_strdata_2e215 __asm__("strdata.215") __attribute__((used, section(".rodata.strdata.215"), aligned(8)));
+static struct S_strliteral_2e216 D_strliteral_2e216 __asm__("strliteral.216") __attribute__((used, section(".data.rel.ro.strliteral.216"), aligned(8)));
+static const struct S_strdata_2e235 D_strdata_2e235 __asm__("strdata.235") __attribute__((used, section(".rodata.strdata.235"), aligned(8)));
+static struct S_strliteral_2e236 D_strliteral_2e236 __asm__("strliteral.236") __attribute__((used, section(".data.rel.ro.strliteral.236"), aligned(8)));
+static const struct S_strdata_2e255 D_strdata_2e255 __asm__("strdata.255") __attribute__((used, section(".rodata.strdata.255"), aligned(8)));
+static struct S_strliteral_2e256 D_strliteral_2e256 __asm__("strliteral.256") __attribute__((used, section(".data.rel.ro.strliteral.256"), aligned(8)));
+static const struct S_strdata_2e275 D_strdata_2e275 __asm__("strdata.275") __attribute__((used, section(".rodata.strdata.275"), aligned(8)));
+static struct S_strliteral_2e276 D_strliteral_2e276 __asm__("strliteral.276") __attribute__((used, section(".data.rel.ro.strliteral.276"), aligned(8)));
+static const struct S_strdata_2e295 D_strdata_2e295 __asm__("strdata.295") __attribute__((used, section(".rodata.strdata.295"), aligned(8)));
+static struct S_strliteral_2e296 D_strliteral_2e296 __asm__("strliteral.296") __attribute__((used, section(".data.rel.ro.strliteral.296"), aligned(8)));
+static const struct S_strdata_2e315 D_strdata_2e315 __asm__("strdata.315") __attribute__((used, section(".rodata.strdata.315"), aligned(8)));
+static struct S_strliteral_2e316 D_strliteral_2e316 __asm__("strliteral.316") __attribute__((used, section(".data.rel.ro.strliteral.316"), aligned(8)));
+static const struct S_strdata_2e335 D_strdata_2e335 __asm__("strdata.335") __attribute__((used, section(".rodata.strdata.335"), aligned(8)));
+static struct S_strliteral_2e336 D_strliteral_2e336 __asm__("strliteral.336") __attribute__((used, section(".data.rel.ro.strliteral.336"), aligned(8)));
+static const struct S_strdata_2e355 D_strdata_2e355 __asm__("strdata.355") __attribute__((used, section(".rodata.strdata.355"), aligned(8)));
+static struct S_strliteral_2e356 D_strliteral_2e356 __asm__("strliteral.356") __attribute__((used, section(".data.rel.ro.strliteral.356"), aligned(8)));
+static const struct S_strdata_2e375 D_strdata_2e375 __asm__("strdata.375") __attribute__((used, section(".rodata.strdata.375"), aligned(8)));
+static struct S_strliteral_2e376 D_strliteral_2e376 __asm__("strliteral.376") __attribute__((used, section(".data.rel.ro.strliteral.376"), aligned(8)));
+static const struct S_strdata_2e395 D_strdata_2e395 __asm__("strdata.395") __attribute__((used, section(".rodata.strdata.395"), aligned(8)));
+static struct S_strliteral_2e396 D_strliteral_2e396 __asm__("strliteral.396") __attribute__((used, section(".data.rel.ro.strliteral.396"), aligned(8)));
+static const struct S_strdata_2e415 D_strdata_2e415 __asm__("strdata.415") __attribute__((used, section(".rodata.strdata.415"), aligned(8)));
+static struct S_strliteral_2e416 D_strliteral_2e416 __asm__("strliteral.416") __attribute__((used, section(".data.rel.ro.strliteral.416"), aligned(8)));
+static const struct S_strdata_2e435 D_strdata_2e435 __asm__("strdata.435") __attribute__((used, section(".rodata.strdata.435"), aligned(8)));
+static struct S_strliteral_2e436 D_strliteral_2e436 __asm__("strliteral.436") __attribute__((used, section(".data.rel.ro.strliteral.436"), aligned(8)));
+static const struct S_strdata_2e455 D_strdata_2e455 __asm__("strdata.455") __attribute__((used, section(".rodata.strdata.455"), aligned(8)));
+static struct S_strliteral_2e456 D_strliteral_2e456 __asm__("strliteral.456") __attribute__((used, section(".data.rel.ro.strliteral.456"), aligned(8)));
+static const struct S_strdata_2e475 D_strdata_2e475 __asm__("strdata.475") __attribute__((used, section(".rodata.strdata.475"), aligned(8)));
+static struct S_strliteral_2e476 D_strliteral_2e476 __asm__("strliteral.476") __attribute__((used, section(".data.rel.ro.strliteral.476"), aligned(8)));
+static const struct S_strdata_2e495 D_strdata_2e495 __asm__("strdata.495") __attribute__((used, section(".rodata.strdata.495"), aligned(8)));
+static struct S_strliteral_2e496 D_strliteral_2e496 __asm__("strliteral.496") __attribute__((used, section(".data.rel.ro.strliteral.496"), aligned(8)));
+static const struct S_strdata_2e515 D_strdata_2e515 __asm__("strdata.515") __attribute__((used, section(".rodata.strdata.515"), aligned(8)));
+static struct S_strliteral_2e516 D_strliteral_2e516 __asm__("strliteral.516") __attribute__((used, section(".data.rel.ro.strliteral.516"), aligned(8)));
+static const struct S_strdata_2e535 D_strdata_2e535 __asm__("strdata.535") __attribute__((used, section(".rodata.strdata.535"), aligned(8)));
+static struct S_strliteral_2e536 D_strliteral_2e536 __asm__("strliteral.536") __attribute__((used, section(".data.rel.ro.strliteral.536"), aligned(8)));
+static const struct S_strdata_2e555 D_strdata_2e555 __asm__("strdata.555") __attribute__((used, section(".rodata.strdata.555"), aligned(8)));
+static struct S_strliteral_2e556 D_strliteral_2e556 __asm__("strliteral.556") __attribute__((used, section(".data.rel.ro.strliteral.556"), aligned(8)));
+static const struct S_strdata_2e575 D_strdata_2e575 __asm__("strdata.575") __attribute__((used, section(".rodata.strdata.575"), aligned(8)));
+static struct S_strliteral_2e576 D_strliteral_2e576 __asm__("strliteral.576") __attribute__((used, section(".data.rel.ro.strliteral.576"), aligned(8)));
+static const struct S_strdata_2e595 D_strdata_2e595 __asm__("strdata.595") __attribute__((used, section(".rodata.strdata.595"), aligned(8)));
+static struct S_strliteral_2e596 D_strliteral_2e596 __asm__("strliteral.596") __attribute__((used, section(".data.rel.ro.strliteral.596"), aligned(8)));
+static const struct S_strdata_2e615 D_strdata_2e615 __asm__("strdata.615") __attribute__((used, section(".rodata.strdata.615"), aligned(8)));
+static struct S_strliteral_2e616 D_strliteral_2e616 __asm__("strliteral.616") __attribute__((used, section(".data.rel.ro.strliteral.616"), aligned(8)));
+static const struct S_strdata_2e635 D_strdata_2e635 __asm__("strdata.635") __attribute__((used, section(".rodata.strdata.635"), aligned(8)));
+static struct S_strliteral_2e636 D_strliteral_2e636 __asm__("strliteral.636") __attribute__((used, section(".data.rel.ro.strliteral.636"), aligned(8)));
+static const struct S_strdata_2e673 D_strdata_2e673 __asm__("strdata.673") __attribute__((used, section(".rodata.strdata.673"), aligned(8)));
+static struct S_strliteral_2e674 D_strliteral_2e674 __asm__("strliteral.674") __attribute__((used, section(".data.rel.ro.strliteral.674"), aligned(8)));
+static const struct S_strdata_2e693 D_strdata_2e693 __asm__("strdata.693") __attribute__((used, section(".rodata.strdata.693"), aligned(8)));
+static struct S_strliteral_2e694 D_strliteral_2e694 __asm__("strliteral.694") __attribute__((used, section(".data.rel.ro.strliteral.694"), aligned(8)));
+static const struct S_strdata_2e713 D_strdata_2e713 __asm__("strdata.713") __attribute__((used, section(".rodata.strdata.713"), aligned(8)));
+static struct S_strliteral_2e714 D_strliteral_2e714 __asm__("strliteral.714") __attribute__((used, section(".data.rel.ro.strliteral.714"), aligned(8)));
+static const struct S_strdata_2e733 D_strdata_2e733 __asm__("strdata.733") __attribute__((used, section(".rodata.strdata.733"), aligned(8)));
+static struct S_strliteral_2e734 D_strliteral_2e734 __asm__("strliteral.734") __attribute__((used, section(".data.rel.ro.strliteral.734"), aligned(8)));
+static const struct S_strdata_2e753 D_strdata_2e753 __asm__("strdata.753") __attribute__((used, section(".rodata.strdata.753"), aligned(8)));
+static struct S_strliteral_2e754 D_strliteral_2e754 __asm__("strliteral.754") __attribute__((used, section(".data.rel.ro.strliteral.754"), aligned(8)));
+static struct S_abortsites_2e36 D_abortsites_2e36 __asm__("abortsites.36") __attribute__((used, section(".data.rel.ro.abortsites.36"), aligned(8)));
+static struct S_abortsites_2e791 D_abortsites_2e791 __asm__("abortsites.791") __attribute__((used, section(".data.rel.ro.abortsites.791"), aligned(8)));
+static const struct S_strdata_2e910 D_strdata_2e910 __asm__("strdata.910") __attribute__((used, section(".rodata.strdata.910"), aligned(8)));
+static struct S_strliteral_2e911 D_strliteral_2e911 __asm__("strliteral.911") __attribute__((used, section(".data.rel.ro.strliteral.911"), aligned(8)));
+static struct S_abortsites_2e892 D_abortsites_2e892 __asm__("abortsites.892") __attribute__((used, section(".data.rel.ro.abortsites.892"), aligned(8)));
+static struct S_abortsites_2e950 D_abortsites_2e950 __asm__("abortsites.950") __attribute__((used, section(".data.rel.ro.abortsites.950"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_casts(void) __asm__("casts") __attribute__((used, section(".text.casts")));
+static void F___nullable(void) __asm__("_nullable") __attribute__((used, section(".text._nullable")));
+static void F_basics(void) __asm__("basics") __attribute__((used, section(".text.basics")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\060\063\055\160\157\151\156\164\145\162\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 20U, 20U };
+static const struct S_strdata_2e19 D_strdata_2e19 = { 10U, 9U, 9U, "\164\171\160\145\040\163\040\075\040\156\165\154\154\073", 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e20 D_strliteral_2e20 = { (char *)((char *)&D_strdata_2e19) + 0, 54U, 54U };
+static const struct S_strdata_2e55 D_strdata_2e55 = { 10U, 9U, 9U, "\164\171\160\145\040\163\040\075\040\052\156\165\154\154\073", 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e56 D_strliteral_2e56 = { (char *)((char *)&D_strdata_2e55) + 0, 55U, 55U };
+static const struct S_strdata_2e75 D_strdata_2e75 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\156\165\154\154\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e76 D_strliteral_2e76 = { (char *)((char *)&D_strdata_2e75) + 0, 46U, 46U };
+static const struct S_strdata_2e95 D_strdata_2e95 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\063\072\040\156\165\154\154\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e96 D_strliteral_2e96 = { (char *)((char *)&D_strdata_2e95) + 0, 49U, 49U };
+static const struct S_strdata_2e115 D_strdata_2e115 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\156\165\154\154\141\142\154\145\040\052\151\156\164\040\075\040\046\063\072\040\156\165\154\154\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e116 D_strliteral_2e116 = { (char *)((char *)&D_strdata_2e115) + 0, 64U, 64U };
+static const struct S_strdata_2e135 D_strdata_2e135 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\142\072\040\156\165\154\154\141\142\154\145\040\052\151\156\164\040\075\040\156\165\154\154\073", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\142\040\141\163\040\156\165\154\154\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e136 D_strliteral_2e136 = { (char *)((char *)&D_strdata_2e135) + 0, 82U, 82U };
+static const struct S_strdata_2e155 D_strdata_2e155 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\050\156\165\154\154\054\040\063\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e156 D_strliteral_2e156 = { (char *)((char *)&D_strdata_2e155) + 0, 50U, 50U };
+static const struct S_strdata_2e175 D_strdata_2e175 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\133\135\156\165\154\154\040\075\040\133\156\165\154\154\135\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e176 D_strliteral_2e176 = { (char *)((char *)&D_strdata_2e175) + 0, 55U, 55U };
+static const struct S_strdata_2e195 D_strdata_2e195 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\133\156\165\154\154\135\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e196 D_strliteral_2e196 = { (char *)((char *)&D_strdata_2e195) + 0, 47U, 47U };
+static const struct S_strdata_2e215 D_strdata_2e215 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\133\137\135\156\165\154\154\040\075\040\133\156\165\154\154\135\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e216 D_strliteral_2e216 = { (char *)((char *)&D_strdata_2e215) + 0, 56U, 56U };
+static const struct S_strdata_2e235 D_strdata_2e235 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\156\165\154\154\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e236 D_strliteral_2e236 = { (char *)((char *)&D_strdata_2e235) + 0, 45U, 45U };
+static const struct S_strdata_2e255 D_strdata_2e255 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\156\165\154\154\141\142\154\145\040\052\151\156\164\040\075\040\046\064\073", 10U, 9U, 9U, 9U, "\141\040\141\163\040\151\156\164\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e256 D_strliteral_2e256 = { (char *)((char *)&D_strdata_2e255) + 0, 71U, 71U };
+static const struct S_strdata_2e275 D_strdata_2e275 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\156\165\154\154\141\142\154\145\040\052\151\156\164\040\075\040\046\064\073", 10U, 9U, 9U, 9U, "\141\040\141\163\040\052\163\164\162\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e276 D_strliteral_2e276 = { (char *)((char *)&D_strdata_2e275) + 0, 72U, 72U };
+static const struct S_strdata_2e295 D_strdata_2e295 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\052\151\156\164\040\075\040\046\064\073", 10U, 9U, 9U, 9U, "\141\163\163\145\162\164\050\141\040\141\163\040\052\151\156\164\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e296 D_strliteral_2e296 = { (char *)((char *)&D_strdata_2e295) + 0, 71U, 71U };
+static const struct S_strdata_2e315 D_strdata_2e315 = { 10U, 9U, 9U, "\154\145\164\040\141\072\040\151\156\164\040\075\040\060\073", 10U, 9U, 9U, "\154\145\164\040\142\072\040\052\151\156\164\040\075\040\046\141\073", 10U, 9U, 9U, "\154\145\164\040\143\072\040\151\156\164\040\075\040\052\142\073", 10U, 9U };
+static struct S_strliteral_2e316 D_strliteral_2e316 = { (char *)((char *)&D_strdata_2e315) + 0, 59U, 59U };
+static const struct S_strdata_2e335 D_strdata_2e335 = { 10U, 9U, 9U, "\164\171\160\145\040\164\040\075\040\157\160\141\161\165\145\073", 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\052\164\040\075\040\046\060\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e336 D_strliteral_2e336 = { (char *)((char *)&D_strdata_2e335) + 0, 66U, 66U };
+static const struct S_strdata_2e355 D_strdata_2e355 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\052\166\157\151\144\040\075\040\046\061\062\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e356 D_strliteral_2e356 = { (char *)((char *)&D_strdata_2e355) + 0, 51U, 51U };
+static const struct S_strdata_2e375 D_strdata_2e375 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e376 D_strliteral_2e376 = { (char *)((char *)&D_strdata_2e375) + 0, 46U, 46U };
+static const struct S_strdata_2e395 D_strdata_2e395 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\046\061\062\072\040\052\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e396 D_strliteral_2e396 = { (char *)((char *)&D_strdata_2e395) + 0, 43U, 43U };
+static const struct S_strdata_2e415 D_strdata_2e415 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\156\165\154\154\141\142\154\145\040\052\166\157\151\144\040\075\040\156\165\154\154\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e416 D_strliteral_2e416 = { (char *)((char *)&D_strdata_2e415) + 0, 58U, 58U };
+static const struct S_strdata_2e435 D_strdata_2e435 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\061\062\151\040\053\040\046\070\151\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e436 D_strliteral_2e436 = { (char *)((char *)&D_strdata_2e435) + 0, 48U, 48U };
+static const struct S_strdata_2e455 D_strdata_2e455 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\061\062\151\040\053\040\070\151\072\040\165\151\156\164\160\164\162\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e456 D_strliteral_2e456 = { (char *)((char *)&D_strdata_2e455) + 0, 56U, 56U };
+static const struct S_strdata_2e475 D_strdata_2e475 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\061\062\151\040\053\040\070\151\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e476 D_strliteral_2e476 = { (char *)((char *)&D_strdata_2e475) + 0, 47U, 47U };
+static const struct S_strdata_2e495 D_strdata_2e495 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\061\062\151\073", 10U, 9U, 9U, 9U, "\141\040\053\075\040\046\070\151\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e496 D_strliteral_2e496 = { (char *)((char *)&D_strdata_2e495) + 0, 55U, 55U };
+static const struct S_strdata_2e515 D_strdata_2e515 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\061\062\151\073", 10U, 9U, 9U, 9U, "\141\040\053\075\040\070\151\072\040\165\151\156\164\160\164\162\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e516 D_strliteral_2e516 = { (char *)((char *)&D_strdata_2e515) + 0, 63U, 63U };
+static const struct S_strdata_2e535 D_strdata_2e535 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\061\062\151\073", 10U, 9U, 9U, 9U, "\141\040\053\075\040\070\151\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e536 D_strliteral_2e536 = { (char *)((char *)&D_strdata_2e535) + 0, 54U, 54U };
+static const struct S_strdata_2e555 D_strdata_2e555 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\052\163\164\162\040\075\040\046\060\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e556 D_strliteral_2e556 = { (char *)((char *)&D_strdata_2e555) + 0, 49U, 49U };
+static const struct S_strdata_2e575 D_strdata_2e575 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\052\163\164\162\040\075\040\141\154\154\157\143\050\060\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e576 D_strliteral_2e576 = { (char *)((char *)&D_strdata_2e575) + 0, 55U, 55U };
+static const struct S_strdata_2e595 D_strdata_2e595 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\046\141\142\157\162\164\050\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e596 D_strliteral_2e596 = { (char *)((char *)&D_strdata_2e595) + 0, 41U, 41U };
+static const struct S_strdata_2e615 D_strdata_2e615 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\156\165\154\154\141\142\154\145\040\052\156\145\166\145\162\040\075\040\156\165\154\154\073", 10U, 9U };
+static struct S_strliteral_2e616 D_strliteral_2e616 = { (char *)((char *)&D_strdata_2e615) + 0, 38U, 38U };
+static const struct S_strdata_2e635 D_strdata_2e635 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\052\050\046\060\072\040\052\156\145\166\145\162\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e636 D_strliteral_2e636 = { (char *)((char *)&D_strdata_2e635) + 0, 46U, 46U };
+static const struct S_strdata_2e673 D_strdata_2e673 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\050\166\157\151\144\054\040\166\157\151\144\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e674 D_strliteral_2e674 = { (char *)((char *)&D_strdata_2e673) + 0, 54U, 54U };
+static const struct S_strdata_2e693 D_strdata_2e693 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\050\151\156\164\054\040\166\157\151\144\051\056\061\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e694 D_strliteral_2e694 = { (char *)((char *)&D_strdata_2e693) + 0, 55U, 55U };
+static const struct S_strdata_2e713 D_strdata_2e713 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\050\133\135\072\040\133\060\135\151\156\164\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e714 D_strliteral_2e714 = { (char *)((char *)&D_strdata_2e713) + 0, 54U, 54U };
+static const struct S_strdata_2e733 D_strdata_2e733 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\163\164\162\165\143\164\040\173\040\166\072\040\166\157\151\144\040\075\040\166\157\151\144\040\175\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e734 D_strliteral_2e734 = { (char *)((char *)&D_strdata_2e733) + 0, 67U, 67U };
+static const struct S_strdata_2e753 D_strdata_2e753 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\040\075\040\046\163\164\162\165\143\164\040\173\040\151\072\040\151\156\164\040\075\040\060\054\040\166\072\040\166\157\151\144\040\075\040\166\157\151\144\040\175\056\166\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e754 D_strliteral_2e754 = { (char *)((char *)&D_strdata_2e753) + 0, 81U, 81U };
+static struct S_abortsites_2e36 D_abortsites_2e36 = { (char *)((char *)&D_strliteral_2e1) + 0, 73U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 73U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 84U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 84U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 115U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 115U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 120U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 120U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 125U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 125U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 131U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 131U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 137U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 137U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 145U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 145U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 152U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 152U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 160U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 160U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 167U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 167U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 173U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 173U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 179U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 179U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 185U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 185U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 192U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 192U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 198U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 198U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 204U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 204U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 211U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 211U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 218U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 218U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 225U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 225U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 232U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 232U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 238U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 238U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 245U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 245U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 249U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 249U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 255U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 255U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 262U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 262U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 268U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 268U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 274U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 274U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 280U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 280U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 286U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 286U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 292U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 292U, 12U };
+static struct S_abortsites_2e791 D_abortsites_2e791 = { (char *)((char *)&D_strliteral_2e1) + 0, 42U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 46U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 49U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 50U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 53U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 56U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 64U, 15U };
+static const struct S_strdata_2e910 D_strdata_2e910 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\156\165\154\154\141\142\154\145\040\052\151\156\164\040\075\040\156\165\154\154\073\040\154\145\164\040\172\040\075\040\052\170\073\040\175\073" };
+static struct S_strliteral_2e911 D_strliteral_2e911 = { (char *)((char *)&D_strdata_2e910) + 0, 62U, 62U };
+static struct S_abortsites_2e892 D_abortsites_2e892 = { (char *)((char *)&D_strliteral_2e1) + 0, 29U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 32U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 35U, 83U, (char *)((char *)&D_strliteral_2e1) + 0, 35U, 83U };
+static struct S_abortsites_2e950 D_abortsites_2e950 = { (char *)((char *)&D_strliteral_2e1) + 0, 11U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 15U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 17U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 23U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 24U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_basics)))();
+	((void (*)(void))((u64)((char *)&F___nullable)))();
+	((void (*)(void))((u64)((char *)&F_casts)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_reject(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char A20[8] __attribute__((aligned(16)));
+	char A21[24] __attribute__((aligned(16)));
+	char A22[8] __attribute__((aligned(16)));
+	char A23[24] __attribute__((aligned(16)));
+	char A24[8] __attribute__((aligned(16)));
+	char A25[24] __attribute__((aligned(16)));
+	char A26[8] __attribute__((aligned(16)));
+	char A27[24] __attribute__((aligned(16)));
+	char A28[8] __attribute__((aligned(16)));
+	char A29[24] __attribute__((aligned(16)));
+	char A30[8] __attribute__((aligned(16)));
+	char A31[24] __attribute__((aligned(16)));
+	char A32[8] __attribute__((aligned(16)));
+	char A33[24] __attribute__((aligned(16)));
+	char A34[8] __attribute__((aligned(16)));
+	char A35[24] __attribute__((aligned(16)));
+	char A36[8] __attribute__((aligned(16)));
+	char A37[24] __attribute__((aligned(16)));
+	char A38[8] __attribute__((aligned(16)));
+	char A39[24] __attribute__((aligned(16)));
+	char A40[8] __attribute__((aligned(16)));
+	char A41[24] __attribute__((aligned(16)));
+	char A42[8] __attribute__((aligned(16)));
+	char A43[24] __attribute__((aligned(16)));
+	char A44[8] __attribute__((aligned(16)));
+	char A45[24] __attribute__((aligned(16)));
+	char A46[8] __attribute__((aligned(16)));
+	char A47[24] __attribute__((aligned(16)));
+	char A48[8] __attribute__((aligned(16)));
+	char A49[24] __attribute__((aligned(16)));
+	char A50[8] __attribute__((aligned(16)));
+	char A51[24] __attribute__((aligned(16)));
+	char A52[8] __attribute__((aligned(16)));
+	char A53[24] __attribute__((aligned(16)));
+	char A54[8] __attribute__((aligned(16)));
+	char A55[24] __attribute__((aligned(16)));
+	char A56[8] __attribute__((aligned(16)));
+	char A57[24] __attribute__((aligned(16)));
+	char A58[8] __attribute__((aligned(16)));
+	char A59[24] __attribute__((aligned(16)));
+	char A60[8] __attribute__((aligned(16)));
+	char A61[24] __attribute__((aligned(16)));
+	char A62[8] __attribute__((aligned(16)));
+	char A63[24] __attribute__((aligned(16)));
+	char A64[8] __attribute__((aligned(16)));
+	char A65[24] __attribute__((aligned(16)));
+	char A66[8] __attribute__((aligned(16)));
+	char A67[24] __attribute__((aligned(16)));
+	char A68[8] __attribute__((aligned(16)));
+	char A69[24] __attribute__((aligned(16)));
+	char A70[8] __attribute__((aligned(16)));
+	char A71[24] __attribute__((aligned(16)));
+	char A72[8] __attribute__((aligned(16)));
+	char A73[24] __attribute__((aligned(16)));
+	char B74[8] __attribute__((aligned(16)));
+	char B75[24] __attribute__((aligned(16)));
+	char B76[24] __attribute__((aligned(16)));
+	char R77[4] __attribute__((aligned(16)));
+	char B78[8] __attribute__((aligned(16)));
+	char B79[24] __attribute__((aligned(16)));
+	char B80[24] __attribute__((aligned(16)));
+	char R81[4] __attribute__((aligned(16)));
+	char B82[8] __attribute__((aligned(16)));
+	char B83[24] __attribute__((aligned(16)));
+	char B84[24] __attribute__((aligned(16)));
+	char R85[4] __attribute__((aligned(16)));
+	char B86[8] __attribute__((aligned(16)));
+	char B87[24] __attribute__((aligned(16)));
+	char B88[24] __attribute__((aligned(16)));
+	char R89[4] __attribute__((aligned(16)));
+	char B90[8] __attribute__((aligned(16)));
+	char B91[24] __attribute__((aligned(16)));
+	char B92[24] __attribute__((aligned(16)));
+	char R93[4] __attribute__((aligned(16)));
+	char B94[8] __attribute__((aligned(16)));
+	char B95[24] __attribute__((aligned(16)));
+	char B96[24] __attribute__((aligned(16)));
+	char R97[4] __attribute__((aligned(16)));
+	char B98[8] __attribute__((aligned(16)));
+	char B99[24] __attribute__((aligned(16)));
+	char B100[24] __attribute__((aligned(16)));
+	char R101[4] __attribute__((aligned(16)));
+	char B102[8] __attribute__((aligned(16)));
+	char B103[24] __attribute__((aligned(16)));
+	char B104[24] __attribute__((aligned(16)));
+	char R105[4] __attribute__((aligned(16)));
+	char B106[8] __attribute__((aligned(16)));
+	char B107[24] __attribute__((aligned(16)));
+	char B108[24] __attribute__((aligned(16)));
+	char R109[4] __attribute__((aligned(16)));
+	char B110[8] __attribute__((aligned(16)));
+	char B111[24] __attribute__((aligned(16)));
+	char B112[24] __attribute__((aligned(16)));
+	char R113[4] __attribute__((aligned(16)));
+	char B114[8] __attribute__((aligned(16)));
+	char B115[24] __attribute__((aligned(16)));
+	char B116[24] __attribute__((aligned(16)));
+	char R117[4] __attribute__((aligned(16)));
+	char B118[8] __attribute__((aligned(16)));
+	char B119[24] __attribute__((aligned(16)));
+	char B120[24] __attribute__((aligned(16)));
+	char R121[4] __attribute__((aligned(16)));
+	char B122[8] __attribute__((aligned(16)));
+	char B123[24] __attribute__((aligned(16)));
+	char B124[24] __attribute__((aligned(16)));
+	char R125[4] __attribute__((aligned(16)));
+	char B126[8] __attribute__((aligned(16)));
+	char B127[24] __attribute__((aligned(16)));
+	char B128[24] __attribute__((aligned(16)));
+	char R129[4] __attribute__((aligned(16)));
+	char B130[8] __attribute__((aligned(16)));
+	char B131[24] __attribute__((aligned(16)));
+	char B132[24] __attribute__((aligned(16)));
+	char R133[4] __attribute__((aligned(16)));
+	char B134[8] __attribute__((aligned(16)));
+	char B135[24] __attribute__((aligned(16)));
+	char B136[24] __attribute__((aligned(16)));
+	char R137[4] __attribute__((aligned(16)));
+	char B138[8] __attribute__((aligned(16)));
+	char B139[24] __attribute__((aligned(16)));
+	char B140[24] __attribute__((aligned(16)));
+	char R141[4] __attribute__((aligned(16)));
+	char B142[8] __attribute__((aligned(16)));
+	char B143[24] __attribute__((aligned(16)));
+	char B144[24] __attribute__((aligned(16)));
+	char R145[4] __attribute__((aligned(16)));
+	char B146[8] __attribute__((aligned(16)));
+	char B147[24] __attribute__((aligned(16)));
+	char B148[24] __attribute__((aligned(16)));
+	char R149[4] __attribute__((aligned(16)));
+	char B150[8] __attribute__((aligned(16)));
+	char B151[24] __attribute__((aligned(16)));
+	char B152[24] __attribute__((aligned(16)));
+	char R153[4] __attribute__((aligned(16)));
+	char B154[8] __attribute__((aligned(16)));
+	char B155[24] __attribute__((aligned(16)));
+	char B156[24] __attribute__((aligned(16)));
+	char R157[4] __attribute__((aligned(16)));
+	char B158[8] __attribute__((aligned(16)));
+	char B159[24] __attribute__((aligned(16)));
+	char B160[24] __attribute__((aligned(16)));
+	char R161[4] __attribute__((aligned(16)));
+	char B162[8] __attribute__((aligned(16)));
+	char B163[24] __attribute__((aligned(16)));
+	char B164[24] __attribute__((aligned(16)));
+	char R165[4] __attribute__((aligned(16)));
+	char B166[8] __attribute__((aligned(16)));
+	char B167[24] __attribute__((aligned(16)));
+	char B168[24] __attribute__((aligned(16)));
+	char R169[4] __attribute__((aligned(16)));
+	char B170[8] __attribute__((aligned(16)));
+	char B171[24] __attribute__((aligned(16)));
+	char B172[24] __attribute__((aligned(16)));
+	char R173[4] __attribute__((aligned(16)));
+	char B174[8] __attribute__((aligned(16)));
+	char B175[24] __attribute__((aligned(16)));
+	char B176[24] __attribute__((aligned(16)));
+	char R177[4] __attribute__((aligned(16)));
+	char B178[8] __attribute__((aligned(16)));
+	char B179[24] __attribute__((aligned(16)));
+	char B180[24] __attribute__((aligned(16)));
+	char R181[4] __attribute__((aligned(16)));
+	char B182[8] __attribute__((aligned(16)));
+	char B183[24] __attribute__((aligned(16)));
+	char B184[24] __attribute__((aligned(16)));
+	char R185[4] __attribute__((aligned(16)));
+	char B186[8] __attribute__((aligned(16)));
+	char B187[24] __attribute__((aligned(16)));
+	char B188[24] __attribute__((aligned(16)));
+	char R189[4] __attribute__((aligned(16)));
+	char B190[8] __attribute__((aligned(16)));
+	char B191[24] __attribute__((aligned(16)));
+	char B192[24] __attribute__((aligned(16)));
+	char R193[4] __attribute__((aligned(16)));
+	char B194[8] __attribute__((aligned(16)));
+	char B195[24] __attribute__((aligned(16)));
+	char B196[24] __attribute__((aligned(16)));
+	char R197[4] __attribute__((aligned(16)));
+	char B198[8] __attribute__((aligned(16)));
+	char B199[24] __attribute__((aligned(16)));
+	char B200[24] __attribute__((aligned(16)));
+	char R201[4] __attribute__((aligned(16)));
+	char B202[8] __attribute__((aligned(16)));
+	char B203[24] __attribute__((aligned(16)));
+	char B204[24] __attribute__((aligned(16)));
+	char R205[4] __attribute__((aligned(16)));
+	char B206[8] __attribute__((aligned(16)));
+	char B207[24] __attribute__((aligned(16)));
+	char B208[24] __attribute__((aligned(16)));
+	char R209[4] __attribute__((aligned(16)));
+	char B210[8] __attribute__((aligned(16)));
+	char B211[24] __attribute__((aligned(16)));
+	char B212[24] __attribute__((aligned(16)));
+	char R213[4] __attribute__((aligned(16)));
+	char B214[8] __attribute__((aligned(16)));
+	char B215[24] __attribute__((aligned(16)));
+	char B216[24] __attribute__((aligned(16)));
+	char R217[4] __attribute__((aligned(16)));
+	char B218[8] __attribute__((aligned(16)));
+	char B219[24] __attribute__((aligned(16)));
+	char B220[24] __attribute__((aligned(16)));
+	char R221[4] __attribute__((aligned(16)));
+	u64 t__2e107;
+	u64 t__2e109;
+	u64 t__2e112;
+	u64 t__2e114;
+	u64 t__2e118;
+	u64 t__2e12;
+	u64 t__2e127;
+	u64 t__2e129;
+	u64 t__2e132;
+	u64 t__2e134;
+	u64 t__2e138;
+	u64 t__2e147;
+	u64 t__2e149;
+	u64 t__2e152;
+	u64 t__2e154;
+	u64 t__2e158;
+	u64 t__2e167;
+	u64 t__2e169;
+	u64 t__2e172;
+	u64 t__2e174;
+	u64 t__2e178;
+	u64 t__2e18;
+	u64 t__2e187;
+	u64 t__2e189;
+	u64 t__2e192;
+	u64 t__2e194;
+	u64 t__2e198;
+	u64 t__2e207;
+	u64 t__2e209;
+	u64 t__2e212;
+	u64 t__2e214;
+	u64 t__2e218;
+	u64 t__2e227;
+	u64 t__2e229;
+	u64 t__2e232;
+	u64 t__2e234;
+	u64 t__2e238;
+	u64 t__2e24;
+	u64 t__2e247;
+	u64 t__2e249;
+	u64 t__2e252;
+	u64 t__2e254;
+	u64 t__2e258;
+	u64 t__2e267;
+	u64 t__2e269;
+	u64 t__2e272;
+	u64 t__2e274;
+	u64 t__2e278;
+	u64 t__2e287;
+	u64 t__2e289;
+	u64 t__2e292;
+	u64 t__2e294;
+	u64 t__2e298;
+	u64 t__2e307;
+	u64 t__2e309;
+	u64 t__2e312;
+	u64 t__2e314;
+	u64 t__2e318;
+	u64 t__2e327;
+	u64 t__2e329;
+	u64 t__2e33;
+	u64 t__2e332;
+	u64 t__2e334;
+	u64 t__2e338;
+	u64 t__2e347;
+	u64 t__2e349;
+	u64 t__2e35;
+	u64 t__2e352;
+	u64 t__2e354;
+	u64 t__2e358;
+	u64 t__2e367;
+	u64 t__2e369;
+	u64 t__2e372;
+	u64 t__2e374;
+	u64 t__2e378;
+	u64 t__2e387;
+	u64 t__2e389;
+	u64 t__2e39;
+	u64 t__2e392;
+	u64 t__2e394;
+	u64 t__2e398;
+	u64 t__2e40;
+	u64 t__2e407;
+	u64 t__2e409;
+	u64 t__2e41;
+	u64 t__2e412;
+	u64 t__2e414;
+	u64 t__2e418;
+	u64 t__2e42;
+	u64 t__2e427;
+	u64 t__2e429;
+	u64 t__2e43;
+	u64 t__2e432;
+	u64 t__2e434;
+	u64 t__2e438;
+	u64 t__2e447;
+	u64 t__2e449;
+	u64 t__2e452;
+	u64 t__2e454;
+	u64 t__2e458;
+	u64 t__2e46;
+	u64 t__2e467;
+	u64 t__2e469;
+	u64 t__2e47;
+	u64 t__2e472;
+	u64 t__2e474;
+	u64 t__2e478;
+	u64 t__2e48;
+	u64 t__2e487;
+	u64 t__2e489;
+	u64 t__2e49;
+	u64 t__2e492;
+	u64 t__2e494;
+	u64 t__2e498;
+	u64 t__2e50;
+	u64 t__2e507;
+	u64 t__2e509;
+	u64 t__2e512;
+	u64 t__2e514;
+	u64 t__2e518;
+	u64 t__2e52;
+	u64 t__2e527;
+	u64 t__2e529;
+	u64 t__2e532;
+	u64 t__2e534;
+	u64 t__2e538;
+	u64 t__2e54;
+	u64 t__2e547;
+	u64 t__2e549;
+	u64 t__2e552;
+	u64 t__2e554;
+	u64 t__2e558;
+	u64 t__2e567;
+	u64 t__2e569;
+	u64 t__2e572;
+	u64 t__2e574;
+	u64 t__2e578;
+	u64 t__2e58;
+	u64 t__2e587;
+	u64 t__2e589;
+	u64 t__2e592;
+	u64 t__2e594;
+	u64 t__2e598;
+	u64 t__2e607;
+	u64 t__2e609;
+	u64 t__2e612;
+	u64 t__2e614;
+	u64 t__2e618;
+	u64 t__2e627;
+	u64 t__2e629;
+	u64 t__2e632;
+	u64 t__2e634;
+	u64 t__2e638;
+	u64 t__2e647;
+	u64 t__2e649;
+	u64 t__2e652;
+	u64 t__2e654;
+	u64 t__2e656;
+	u64 t__2e665;
+	u64 t__2e667;
+	u64 t__2e67;
+	u64 t__2e670;
+	u64 t__2e672;
+	u64 t__2e676;
+	u64 t__2e685;
+	u64 t__2e687;
+	u64 t__2e69;
+	u64 t__2e690;
+	u64 t__2e692;
+	u64 t__2e696;
+	u64 t__2e705;
+	u64 t__2e707;
+	u64 t__2e710;
+	u64 t__2e712;
+	u64 t__2e716;
+	u64 t__2e72;
+	u64 t__2e725;
+	u64 t__2e727;
+	u64 t__2e730;
+	u64 t__2e732;
+	u64 t__2e736;
+	u64 t__2e74;
+	u64 t__2e745;
+	u64 t__2e747;
+	u64 t__2e750;
+	u64 t__2e752;
+	u64 t__2e756;
+	u64 t__2e765;
+	u64 t__2e767;
+	u64 t__2e78;
+	u64 t__2e87;
+	u64 t__2e89;
+	u64 t__2e92;
+	u64 t__2e94;
+	u64 t__2e98;
+	u64 t_abortsite_2e37;
+	u64 t_object_2e113;
+	u64 t_object_2e117;
+	u64 t_object_2e133;
+	u64 t_object_2e137;
+	u64 t_object_2e14;
+	u64 t_object_2e153;
+	u64 t_object_2e157;
+	u64 t_object_2e173;
+	u64 t_object_2e177;
+	u64 t_object_2e193;
+	u64 t_object_2e197;
+	u64 t_object_2e213;
+	u64 t_object_2e217;
+	u64 t_object_2e22;
+	u64 t_object_2e233;
+	u64 t_object_2e237;
+	u64 t_object_2e253;
+	u64 t_object_2e257;
+	u64 t_object_2e273;
+	u64 t_object_2e277;
+	u64 t_object_2e293;
+	u64 t_object_2e297;
+	u64 t_object_2e313;
+	u64 t_object_2e317;
+	u64 t_object_2e333;
+	u64 t_object_2e337;
+	u64 t_object_2e353;
+	u64 t_object_2e357;
+	u64 t_object_2e373;
+	u64 t_object_2e377;
+	u64 t_object_2e393;
+	u64 t_object_2e397;
+	u64 t_object_2e413;
+	u64 t_object_2e417;
+	u64 t_object_2e433;
+	u64 t_object_2e437;
+	u64 t_object_2e453;
+	u64 t_object_2e457;
+	u64 t_object_2e473;
+	u64 t_object_2e477;
+	u64 t_object_2e493;
+	u64 t_object_2e497;
+	u64 t_object_2e513;
+	u64 t_object_2e517;
+	u64 t_object_2e53;
+	u64 t_object_2e533;
+	u64 t_object_2e537;
+	u64 t_object_2e553;
+	u64 t_object_2e557;
+	u64 t_object_2e57;
+	u64 t_object_2e573;
+	u64 t_object_2e577;
+	u64 t_object_2e593;
+	u64 t_object_2e597;
+	u64 t_object_2e613;
+	u64 t_object_2e617;
+	u64 t_object_2e633;
+	u64 t_object_2e637;
+	u64 t_object_2e653;
+	u64 t_object_2e655;
+	u64 t_object_2e671;
+	u64 t_object_2e675;
+	u64 t_object_2e691;
+	u64 t_object_2e695;
+	u64 t_object_2e711;
+	u64 t_object_2e715;
+	u64 t_object_2e73;
+	u64 t_object_2e731;
+	u64 t_object_2e735;
+	u64 t_object_2e751;
+	u64 t_object_2e755;
+	u64 t_object_2e77;
+	u64 t_object_2e93;
+	u64 t_object_2e97;
+	u64 t_tag_2e119;
+	u64 t_tag_2e139;
+	u64 t_tag_2e159;
+	u64 t_tag_2e179;
+	u64 t_tag_2e199;
+	u64 t_tag_2e219;
+	u64 t_tag_2e239;
+	u64 t_tag_2e25;
+	u64 t_tag_2e259;
+	u64 t_tag_2e279;
+	u64 t_tag_2e299;
+	u64 t_tag_2e319;
+	u64 t_tag_2e339;
+	u64 t_tag_2e359;
+	u64 t_tag_2e379;
+	u64 t_tag_2e399;
+	u64 t_tag_2e419;
+	u64 t_tag_2e439;
+	u64 t_tag_2e459;
+	u64 t_tag_2e479;
+	u64 t_tag_2e499;
+	u64 t_tag_2e519;
+	u64 t_tag_2e539;
+	u64 t_tag_2e559;
+	u64 t_tag_2e579;
+	u64 t_tag_2e59;
+	u64 t_tag_2e599;
+	u64 t_tag_2e619;
+	u64 t_tag_2e639;
+	u64 t_tag_2e657;
+	u64 t_tag_2e677;
+	u64 t_tag_2e697;
+	u64 t_tag_2e717;
+	u64 t_tag_2e737;
+	u64 t_tag_2e757;
+	u64 t_tag_2e79;
+	u64 t_tag_2e99;
+	L_start_2e7:;
+	t_object_2e14 = (u64)A0;
+	t_object_2e22 = (u64)A1;
+	t_object_2e53 = (u64)A2;
+	t_object_2e57 = (u64)A3;
+	t_object_2e73 = (u64)A4;
+	t_object_2e77 = (u64)A5;
+	t_object_2e93 = (u64)A6;
+	t_object_2e97 = (u64)A7;
+	t_object_2e113 = (u64)A8;
+	t_object_2e117 = (u64)A9;
+	t_object_2e133 = (u64)A10;
+	t_object_2e137 = (u64)A11;
+	t_object_2e153 = (u64)A12;
+	t_object_2e157 = (u64)A13;
+	t_object_2e173 = (u64)A14;
+	t_object_2e177 = (u64)A15;
+	t_object_2e193 = (u64)A16;
+	t_object_2e197 = (u64)A17;
+	t_object_2e213 = (u64)A18;
+	t_object_2e217 = (u64)A19;
+	t_object_2e233 = (u64)A20;
+	t_object_2e237 = (u64)A21;
+	t_object_2e253 = (u64)A22;
+	t_object_2e257 = (u64)A23;
+	t_object_2e273 = (u64)A24;
+	t_object_2e277 = (u64)A25;
+	t_object_2e293 = (u64)A26;
+	t_object_2e297 = (u64)A27;
+	t_object_2e313 = (u64)A28;
+	t_object_2e317 = (u64)A29;
+	t_object_2e333 = (u64)A30;
+	t_object_2e337 = (u64)A31;
+	t_object_2e353 = (u64)A32;
+	t_object_2e357 = (u64)A33;
+	t_object_2e373 = (u64)A34;
+	t_object_2e377 = (u64)A35;
+	t_object_2e393 = (u64)A36;
+	t_object_2e397 = (u64)A37;
+	t_object_2e413 = (u64)A38;
+	t_object_2e417 = (u64)A39;
+	t_object_2e433 = (u64)A40;
+	t_object_2e437 = (u64)A41;
+	t_object_2e453 = (u64)A42;
+	t_object_2e457 = (u64)A43;
+	t_object_2e473 = (u64)A44;
+	t_object_2e477 = (u64)A45;
+	t_object_2e493 = (u64)A46;
+	t_object_2e497 = (u64)A47;
+	t_object_2e513 = (u64)A48;
+	t_object_2e517 = (u64)A49;
+	t_object_2e533 = (u64)A50;
+	t_object_2e537 = (u64)A51;
+	t_object_2e553 = (u64)A52;
+	t_object_2e557 = (u64)A53;
+	t_object_2e573 = (u64)A54;
+	t_object_2e577 = (u64)A55;
+	t_object_2e593 = (u64)A56;
+	t_object_2e597 = (u64)A57;
+	t_object_2e613 = (u64)A58;
+	t_object_2e617 = (u64)A59;
+	t_object_2e633 = (u64)A60;
+	t_object_2e637 = (u64)A61;
+	t_object_2e653 = (u64)A62;
+	t_object_2e655 = (u64)A63;
+	t_object_2e671 = (u64)A64;
+	t_object_2e675 = (u64)A65;
+	t_object_2e691 = (u64)A66;
+	t_object_2e695 = (u64)A67;
+	t_object_2e711 = (u64)A68;
+	t_object_2e715 = (u64)A69;
+	t_object_2e731 = (u64)A70;
+	t_object_2e735 = (u64)A71;
+	t_object_2e751 = (u64)A72;
+	t_object_2e755 = (u64)A73;
+	L_body_2e8:;
+	*(u32 *)t_object_2e14 = (u32)((u64)3532310079UL);
+	t__2e18 = (u64)((u64)t_object_2e14 + (u64)((u64)4UL));
+	*(u32 *)t__2e18 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e22 = (u64)((u64)0UL);
+	t__2e24 = (u64)((u64)t_object_2e22 + (u64)((u64)8UL));
+	*(u64 *)t__2e24 = (u64)((u64)0UL);
+	t__2e24 = (u64)((u64)t__2e24 + (u64)((u64)8UL));
+	*(u64 *)t__2e24 = (u64)((u64)0UL);
+	BLIT((u64)B74, t_object_2e14, 8);
+	BLIT((u64)B75, ((u64)((char *)&D_strliteral_2e20)), 24);
+	BLIT((u64)B76, t_object_2e22, 24);
+	t__2e12 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R77, (u64)B74, (u64)B75, (u64)B76);
+	t_tag_2e25 = (u64)(*(u32 *)t__2e12);
+	t__2e33 = (u64)(u32)(((u32)t_tag_2e25 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e33) goto L_member_2e30; else goto L__2e32;
+	L__2e32:;
+	t__2e35 = (u64)(u32)(((u32)t_tag_2e25 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e35) goto L_member_2e31; else goto L__2e34;
+	L__2e34:;
+	goto L_matches_2e29;
+	L_member_2e30:;
+	goto L_matches_2e29;
+	L_member_2e31:;
+	goto L_matches_2e28;
+	L_matches_2e28:;
+	goto L__2e26;
+	L_matches_2e29:;
+	t_abortsite_2e37 = ((u64)0UL);
+	goto L_abort_2e38;
+	L__2e44:;
+	L__2e27:;
+	t_abortsite_2e37 = ((u64)1UL);
+	goto L_abort_2e45;
+	L__2e26:;
+	*(u32 *)t_object_2e53 = (u32)((u64)3532310079UL);
+	t__2e54 = (u64)((u64)t_object_2e53 + (u64)((u64)4UL));
+	*(u32 *)t__2e54 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e57 = (u64)((u64)0UL);
+	t__2e58 = (u64)((u64)t_object_2e57 + (u64)((u64)8UL));
+	*(u64 *)t__2e58 = (u64)((u64)0UL);
+	t__2e58 = (u64)((u64)t__2e58 + (u64)((u64)8UL));
+	*(u64 *)t__2e58 = (u64)((u64)0UL);
+	BLIT((u64)B78, t_object_2e53, 8);
+	BLIT((u64)B79, ((u64)((char *)&D_strliteral_2e56)), 24);
+	BLIT((u64)B80, t_object_2e57, 24);
+	t__2e52 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R81, (u64)B78, (u64)B79, (u64)B80);
+	t_tag_2e59 = (u64)(*(u32 *)t__2e52);
+	t__2e67 = (u64)(u32)(((u32)t_tag_2e59 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e67) goto L_member_2e64; else goto L__2e66;
+	L__2e66:;
+	t__2e69 = (u64)(u32)(((u32)t_tag_2e59 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e69) goto L_member_2e65; else goto L__2e68;
+	L__2e68:;
+	goto L_matches_2e63;
+	L_member_2e64:;
+	goto L_matches_2e63;
+	L_member_2e65:;
+	goto L_matches_2e62;
+	L_matches_2e62:;
+	goto L__2e60;
+	L_matches_2e63:;
+	t_abortsite_2e37 = ((u64)2UL);
+	goto L_abort_2e38;
+	L__2e70:;
+	L__2e61:;
+	t_abortsite_2e37 = ((u64)3UL);
+	goto L_abort_2e45;
+	L__2e60:;
+	*(u32 *)t_object_2e73 = (u32)((u64)3532310079UL);
+	t__2e74 = (u64)((u64)t_object_2e73 + (u64)((u64)4UL));
+	*(u32 *)t__2e74 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e77 = (u64)((u64)0UL);
+	t__2e78 = (u64)((u64)t_object_2e77 + (u64)((u64)8UL));
+	*(u64 *)t__2e78 = (u64)((u64)0UL);
+	t__2e78 = (u64)((u64)t__2e78 + (u64)((u64)8UL));
+	*(u64 *)t__2e78 = (u64)((u64)0UL);
+	BLIT((u64)B82, t_object_2e73, 8);
+	BLIT((u64)B83, ((u64)((char *)&D_strliteral_2e76)), 24);
+	BLIT((u64)B84, t_object_2e77, 24);
+	t__2e72 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R85, (u64)B82, (u64)B83, (u64)B84);
+	t_tag_2e79 = (u64)(*(u32 *)t__2e72);
+	t__2e87 = (u64)(u32)(((u32)t_tag_2e79 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e87) goto L_member_2e84; else goto L__2e86;
+	L__2e86:;
+	t__2e89 = (u64)(u32)(((u32)t_tag_2e79 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e89) goto L_member_2e85; else goto L__2e88;
+	L__2e88:;
+	goto L_matches_2e83;
+	L_member_2e84:;
+	goto L_matches_2e83;
+	L_member_2e85:;
+	goto L_matches_2e82;
+	L_matches_2e82:;
+	goto L__2e80;
+	L_matches_2e83:;
+	t_abortsite_2e37 = ((u64)4UL);
+	goto L_abort_2e38;
+	L__2e90:;
+	L__2e81:;
+	t_abortsite_2e37 = ((u64)5UL);
+	goto L_abort_2e45;
+	L__2e80:;
+	*(u32 *)t_object_2e93 = (u32)((u64)3532310079UL);
+	t__2e94 = (u64)((u64)t_object_2e93 + (u64)((u64)4UL));
+	*(u32 *)t__2e94 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e97 = (u64)((u64)0UL);
+	t__2e98 = (u64)((u64)t_object_2e97 + (u64)((u64)8UL));
+	*(u64 *)t__2e98 = (u64)((u64)0UL);
+	t__2e98 = (u64)((u64)t__2e98 + (u64)((u64)8UL));
+	*(u64 *)t__2e98 = (u64)((u64)0UL);
+	BLIT((u64)B86, t_object_2e93, 8);
+	BLIT((u64)B87, ((u64)((char *)&D_strliteral_2e96)), 24);
+	BLIT((u64)B88, t_object_2e97, 24);
+	t__2e92 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R89, (u64)B86, (u64)B87, (u64)B88);
+	t_tag_2e99 = (u64)(*(u32 *)t__2e92);
+	t__2e107 = (u64)(u32)(((u32)t_tag_2e99 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e107) goto L_member_2e104; else goto L__2e106;
+	L__2e106:;
+	t__2e109 = (u64)(u32)(((u32)t_tag_2e99 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e109) goto L_member_2e105; else goto L__2e108;
+	L__2e108:;
+	goto L_matches_2e103;
+	L_member_2e104:;
+	goto L_matches_2e103;
+	L_member_2e105:;
+	goto L_matches_2e102;
+	L_matches_2e102:;
+	goto L__2e100;
+	L_matches_2e103:;
+	t_abortsite_2e37 = ((u64)6UL);
+	goto L_abort_2e38;
+	L__2e110:;
+	L__2e101:;
+	t_abortsite_2e37 = ((u64)7UL);
+	goto L_abort_2e45;
+	L__2e100:;
+	*(u32 *)t_object_2e113 = (u32)((u64)3532310079UL);
+	t__2e114 = (u64)((u64)t_object_2e113 + (u64)((u64)4UL));
+	*(u32 *)t__2e114 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e117 = (u64)((u64)0UL);
+	t__2e118 = (u64)((u64)t_object_2e117 + (u64)((u64)8UL));
+	*(u64 *)t__2e118 = (u64)((u64)0UL);
+	t__2e118 = (u64)((u64)t__2e118 + (u64)((u64)8UL));
+	*(u64 *)t__2e118 = (u64)((u64)0UL);
+	BLIT((u64)B90, t_object_2e113, 8);
+	BLIT((u64)B91, ((u64)((char *)&D_strliteral_2e116)), 24);
+	BLIT((u64)B92, t_object_2e117, 24);
+	t__2e112 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R93, (u64)B90, (u64)B91, (u64)B92);
+	t_tag_2e119 = (u64)(*(u32 *)t__2e112);
+	t__2e127 = (u64)(u32)(((u32)t_tag_2e119 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e127) goto L_member_2e124; else goto L__2e126;
+	L__2e126:;
+	t__2e129 = (u64)(u32)(((u32)t_tag_2e119 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e129) goto L_member_2e125; else goto L__2e128;
+	L__2e128:;
+	goto L_matches_2e123;
+	L_member_2e124:;
+	goto L_matches_2e123;
+	L_member_2e125:;
+	goto L_matches_2e122;
+	L_matches_2e122:;
+	goto L__2e120;
+	L_matches_2e123:;
+	t_abortsite_2e37 = ((u64)8UL);
+	goto L_abort_2e38;
+	L__2e130:;
+	L__2e121:;
+	t_abortsite_2e37 = ((u64)9UL);
+	goto L_abort_2e45;
+	L__2e120:;
+	*(u32 *)t_object_2e133 = (u32)((u64)3532310079UL);
+	t__2e134 = (u64)((u64)t_object_2e133 + (u64)((u64)4UL));
+	*(u32 *)t__2e134 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e137 = (u64)((u64)0UL);
+	t__2e138 = (u64)((u64)t_object_2e137 + (u64)((u64)8UL));
+	*(u64 *)t__2e138 = (u64)((u64)0UL);
+	t__2e138 = (u64)((u64)t__2e138 + (u64)((u64)8UL));
+	*(u64 *)t__2e138 = (u64)((u64)0UL);
+	BLIT((u64)B94, t_object_2e133, 8);
+	BLIT((u64)B95, ((u64)((char *)&D_strliteral_2e136)), 24);
+	BLIT((u64)B96, t_object_2e137, 24);
+	t__2e132 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R97, (u64)B94, (u64)B95, (u64)B96);
+	t_tag_2e139 = (u64)(*(u32 *)t__2e132);
+	t__2e147 = (u64)(u32)(((u32)t_tag_2e139 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e147) goto L_member_2e144; else goto L__2e146;
+	L__2e146:;
+	t__2e149 = (u64)(u32)(((u32)t_tag_2e139 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e149) goto L_member_2e145; else goto L__2e148;
+	L__2e148:;
+	goto L_matches_2e143;
+	L_member_2e144:;
+	goto L_matches_2e143;
+	L_member_2e145:;
+	goto L_matches_2e142;
+	L_matches_2e142:;
+	goto L__2e140;
+	L_matches_2e143:;
+	t_abortsite_2e37 = ((u64)10UL);
+	goto L_abort_2e38;
+	L__2e150:;
+	L__2e141:;
+	t_abortsite_2e37 = ((u64)11UL);
+	goto L_abort_2e45;
+	L__2e140:;
+	*(u32 *)t_object_2e153 = (u32)((u64)3532310079UL);
+	t__2e154 = (u64)((u64)t_object_2e153 + (u64)((u64)4UL));
+	*(u32 *)t__2e154 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e157 = (u64)((u64)0UL);
+	t__2e158 = (u64)((u64)t_object_2e157 + (u64)((u64)8UL));
+	*(u64 *)t__2e158 = (u64)((u64)0UL);
+	t__2e158 = (u64)((u64)t__2e158 + (u64)((u64)8UL));
+	*(u64 *)t__2e158 = (u64)((u64)0UL);
+	BLIT((u64)B98, t_object_2e153, 8);
+	BLIT((u64)B99, ((u64)((char *)&D_strliteral_2e156)), 24);
+	BLIT((u64)B100, t_object_2e157, 24);
+	t__2e152 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R101, (u64)B98, (u64)B99, (u64)B100);
+	t_tag_2e159 = (u64)(*(u32 *)t__2e152);
+	t__2e167 = (u64)(u32)(((u32)t_tag_2e159 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e167) goto L_member_2e164; else goto L__2e166;
+	L__2e166:;
+	t__2e169 = (u64)(u32)(((u32)t_tag_2e159 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e169) goto L_member_2e165; else goto L__2e168;
+	L__2e168:;
+	goto L_matches_2e163;
+	L_member_2e164:;
+	goto L_matches_2e163;
+	L_member_2e165:;
+	goto L_matches_2e162;
+	L_matches_2e162:;
+	goto L__2e160;
+	L_matches_2e163:;
+	t_abortsite_2e37 = ((u64)12UL);
+	goto L_abort_2e38;
+	L__2e170:;
+	L__2e161:;
+	t_abortsite_2e37 = ((u64)13UL);
+	goto L_abort_2e45;
+	L__2e160:;
+	*(u32 *)t_object_2e173 = (u32)((u64)3532310079UL);
+	t__2e174 = (u64)((u64)t_object_2e173 + (u64)((u64)4UL));
+	*(u32 *)t__2e174 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e177 = (u64)((u64)0UL);
+	t__2e178 = (u64)((u64)t_object_2e177 + (u64)((u64)8UL));
+	*(u64 *)t__2e178 = (u64)((u64)0UL);
+	t__2e178 = (u64)((u64)t__2e178 + (u64)((u64)8UL));
+	*(u64 *)t__2e178 = (u64)((u64)0UL);
+	BLIT((u64)B102, t_object_2e173, 8);
+	BLIT((u64)B103, ((u64)((char *)&D_strliteral_2e176)), 24);
+	BLIT((u64)B104, t_object_2e177, 24);
+	t__2e172 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R105, (u64)B102, (u64)B103, (u64)B104);
+	t_tag_2e179 = (u64)(*(u32 *)t__2e172);
+	t__2e187 = (u64)(u32)(((u32)t_tag_2e179 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e187) goto L_member_2e184; else goto L__2e186;
+	L__2e186:;
+	t__2e189 = (u64)(u32)(((u32)t_tag_2e179 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e189) goto L_member_2e185; else goto L__2e188;
+	L__2e188:;
+	goto L_matches_2e183;
+	L_member_2e184:;
+	goto L_matches_2e183;
+	L_member_2e185:;
+	goto L_matches_2e182;
+	L_matches_2e182:;
+	goto L__2e180;
+	L_matches_2e183:;
+	t_abortsite_2e37 = ((u64)14UL);
+	goto L_abort_2e38;
+	L__2e190:;
+	L__2e181:;
+	t_abortsite_2e37 = ((u64)15UL);
+	goto L_abort_2e45;
+	L__2e180:;
+	*(u32 *)t_object_2e193 = (u32)((u64)3532310079UL);
+	t__2e194 = (u64)((u64)t_object_2e193 + (u64)((u64)4UL));
+	*(u32 *)t__2e194 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e197 = (u64)((u64)0UL);
+	t__2e198 = (u64)((u64)t_object_2e197 + (u64)((u64)8UL));
+	*(u64 *)t__2e198 = (u64)((u64)0UL);
+	t__2e198 = (u64)((u64)t__2e198 + (u64)((u64)8UL));
+	*(u64 *)t__2e198 = (u64)((u64)0UL);
+	BLIT((u64)B106, t_object_2e193, 8);
+	BLIT((u64)B107, ((u64)((char *)&D_strliteral_2e196)), 24);
+	BLIT((u64)B108, t_object_2e197, 24);
+	t__2e192 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R109, (u64)B106, (u64)B107, (u64)B108);
+	t_tag_2e199 = (u64)(*(u32 *)t__2e192);
+	t__2e207 = (u64)(u32)(((u32)t_tag_2e199 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e207) goto L_member_2e204; else goto L__2e206;
+	L__2e206:;
+	t__2e209 = (u64)(u32)(((u32)t_tag_2e199 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e209) goto L_member_2e205; else goto L__2e208;
+	L__2e208:;
+	goto L_matches_2e203;
+	L_member_2e204:;
+	goto L_matches_2e203;
+	L_member_2e205:;
+	goto L_matches_2e202;
+	L_matches_2e202:;
+	goto L__2e200;
+	L_matches_2e203:;
+	t_abortsite_2e37 = ((u64)16UL);
+	goto L_abort_2e38;
+	L__2e210:;
+	L__2e201:;
+	t_abortsite_2e37 = ((u64)17UL);
+	goto L_abort_2e45;
+	L__2e200:;
+	*(u32 *)t_object_2e213 = (u32)((u64)3532310079UL);
+	t__2e214 = (u64)((u64)t_object_2e213 + (u64)((u64)4UL));
+	*(u32 *)t__2e214 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e217 = (u64)((u64)0UL);
+	t__2e218 = (u64)((u64)t_object_2e217 + (u64)((u64)8UL));
+	*(u64 *)t__2e218 = (u64)((u64)0UL);
+	t__2e218 = (u64)((u64)t__2e218 + (u64)((u64)8UL));
+	*(u64 *)t__2e218 = (u64)((u64)0UL);
+	BLIT((u64)B110, t_object_2e213, 8);
+	BLIT((u64)B111, ((u64)((char *)&D_strliteral_2e216)), 24);
+	BLIT((u64)B112, t_object_2e217, 24);
+	t__2e212 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R113, (u64)B110, (u64)B111, (u64)B112);
+	t_tag_2e219 = (u64)(*(u32 *)t__2e212);
+	t__2e227 = (u64)(u32)(((u32)t_tag_2e219 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e227) goto L_member_2e224; else goto L__2e226;
+	L__2e226:;
+	t__2e229 = (u64)(u32)(((u32)t_tag_2e219 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e229) goto L_member_2e225; else goto L__2e228;
+	L__2e228:;
+	goto L_matches_2e223;
+	L_member_2e224:;
+	goto L_matches_2e223;
+	L_member_2e225:;
+	goto L_matches_2e222;
+	L_matches_2e222:;
+	goto L__2e220;
+	L_matches_2e223:;
+	t_abortsite_2e37 = ((u64)18UL);
+	goto L_abort_2e38;
+	L__2e230:;
+	L__2e221:;
+	t_abortsite_2e37 = ((u64)19UL);
+	goto L_abort_2e45;
+	L__2e220:;
+	*(u32 *)t_object_2e233 = (u32)((u64)3532310079UL);
+	t__2e234 = (u64)((u64)t_object_2e233 + (u64)((u64)4UL));
+	*(u32 *)t__2e234 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e237 = (u64)((u64)0UL);
+	t__2e238 = (u64)((u64)t_object_2e237 + (u64)((u64)8UL));
+	*(u64 *)t__2e238 = (u64)((u64)0UL);
+	t__2e238 = (u64)((u64)t__2e238 + (u64)((u64)8UL));
+	*(u64 *)t__2e238 = (u64)((u64)0UL);
+	BLIT((u64)B114, t_object_2e233, 8);
+	BLIT((u64)B115, ((u64)((char *)&D_strliteral_2e236)), 24);
+	BLIT((u64)B116, t_object_2e237, 24);
+	t__2e232 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R117, (u64)B114, (u64)B115, (u64)B116);
+	t_tag_2e239 = (u64)(*(u32 *)t__2e232);
+	t__2e247 = (u64)(u32)(((u32)t_tag_2e239 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e247) goto L_member_2e244; else goto L__2e246;
+	L__2e246:;
+	t__2e249 = (u64)(u32)(((u32)t_tag_2e239 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e249) goto L_member_2e245; else goto L__2e248;
+	L__2e248:;
+	goto L_matches_2e243;
+	L_member_2e244:;
+	goto L_matches_2e243;
+	L_member_2e245:;
+	goto L_matches_2e242;
+	L_matches_2e242:;
+	goto L__2e240;
+	L_matches_2e243:;
+	t_abortsite_2e37 = ((u64)20UL);
+	goto L_abort_2e38;
+	L__2e250:;
+	L__2e241:;
+	t_abortsite_2e37 = ((u64)21UL);
+	goto L_abort_2e45;
+	L__2e240:;
+	*(u32 *)t_object_2e253 = (u32)((u64)3532310079UL);
+	t__2e254 = (u64)((u64)t_object_2e253 + (u64)((u64)4UL));
+	*(u32 *)t__2e254 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e257 = (u64)((u64)0UL);
+	t__2e258 = (u64)((u64)t_object_2e257 + (u64)((u64)8UL));
+	*(u64 *)t__2e258 = (u64)((u64)0UL);
+	t__2e258 = (u64)((u64)t__2e258 + (u64)((u64)8UL));
+	*(u64 *)t__2e258 = (u64)((u64)0UL);
+	BLIT((u64)B118, t_object_2e253, 8);
+	BLIT((u64)B119, ((u64)((char *)&D_strliteral_2e256)), 24);
+	BLIT((u64)B120, t_object_2e257, 24);
+	t__2e252 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R121, (u64)B118, (u64)B119, (u64)B120);
+	t_tag_2e259 = (u64)(*(u32 *)t__2e252);
+	t__2e267 = (u64)(u32)(((u32)t_tag_2e259 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e267) goto L_member_2e264; else goto L__2e266;
+	L__2e266:;
+	t__2e269 = (u64)(u32)(((u32)t_tag_2e259 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e269) goto L_member_2e265; else goto L__2e268;
+	L__2e268:;
+	goto L_matches_2e263;
+	L_member_2e264:;
+	goto L_matches_2e263;
+	L_member_2e265:;
+	goto L_matches_2e262;
+	L_matches_2e262:;
+	goto L__2e260;
+	L_matches_2e263:;
+	t_abortsite_2e37 = ((u64)22UL);
+	goto L_abort_2e38;
+	L__2e270:;
+	L__2e261:;
+	t_abortsite_2e37 = ((u64)23UL);
+	goto L_abort_2e45;
+	L__2e260:;
+	*(u32 *)t_object_2e273 = (u32)((u64)3532310079UL);
+	t__2e274 = (u64)((u64)t_object_2e273 + (u64)((u64)4UL));
+	*(u32 *)t__2e274 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e277 = (u64)((u64)0UL);
+	t__2e278 = (u64)((u64)t_object_2e277 + (u64)((u64)8UL));
+	*(u64 *)t__2e278 = (u64)((u64)0UL);
+	t__2e278 = (u64)((u64)t__2e278 + (u64)((u64)8UL));
+	*(u64 *)t__2e278 = (u64)((u64)0UL);
+	BLIT((u64)B122, t_object_2e273, 8);
+	BLIT((u64)B123, ((u64)((char *)&D_strliteral_2e276)), 24);
+	BLIT((u64)B124, t_object_2e277, 24);
+	t__2e272 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R125, (u64)B122, (u64)B123, (u64)B124);
+	t_tag_2e279 = (u64)(*(u32 *)t__2e272);
+	t__2e287 = (u64)(u32)(((u32)t_tag_2e279 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e287) goto L_member_2e284; else goto L__2e286;
+	L__2e286:;
+	t__2e289 = (u64)(u32)(((u32)t_tag_2e279 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e289) goto L_member_2e285; else goto L__2e288;
+	L__2e288:;
+	goto L_matches_2e283;
+	L_member_2e284:;
+	goto L_matches_2e283;
+	L_member_2e285:;
+	goto L_matches_2e282;
+	L_matches_2e282:;
+	goto L__2e280;
+	L_matches_2e283:;
+	t_abortsite_2e37 = ((u64)24UL);
+	goto L_abort_2e38;
+	L__2e290:;
+	L__2e281:;
+	t_abortsite_2e37 = ((u64)25UL);
+	goto L_abort_2e45;
+	L__2e280:;
+	*(u32 *)t_object_2e293 = (u32)((u64)3532310079UL);
+	t__2e294 = (u64)((u64)t_object_2e293 + (u64)((u64)4UL));
+	*(u32 *)t__2e294 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e297 = (u64)((u64)0UL);
+	t__2e298 = (u64)((u64)t_object_2e297 + (u64)((u64)8UL));
+	*(u64 *)t__2e298 = (u64)((u64)0UL);
+	t__2e298 = (u64)((u64)t__2e298 + (u64)((u64)8UL));
+	*(u64 *)t__2e298 = (u64)((u64)0UL);
+	BLIT((u64)B126, t_object_2e293, 8);
+	BLIT((u64)B127, ((u64)((char *)&D_strliteral_2e296)), 24);
+	BLIT((u64)B128, t_object_2e297, 24);
+	t__2e292 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R129, (u64)B126, (u64)B127, (u64)B128);
+	t_tag_2e299 = (u64)(*(u32 *)t__2e292);
+	t__2e307 = (u64)(u32)(((u32)t_tag_2e299 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e307) goto L_member_2e304; else goto L__2e306;
+	L__2e306:;
+	t__2e309 = (u64)(u32)(((u32)t_tag_2e299 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e309) goto L_member_2e305; else goto L__2e308;
+	L__2e308:;
+	goto L_matches_2e303;
+	L_member_2e304:;
+	goto L_matches_2e303;
+	L_member_2e305:;
+	goto L_matches_2e302;
+	L_matches_2e302:;
+	goto L__2e300;
+	L_matches_2e303:;
+	t_abortsite_2e37 = ((u64)26UL);
+	goto L_abort_2e38;
+	L__2e310:;
+	L__2e301:;
+	t_abortsite_2e37 = ((u64)27UL);
+	goto L_abort_2e45;
+	L__2e300:;
+	*(u32 *)t_object_2e313 = (u32)((u64)3532310079UL);
+	t__2e314 = (u64)((u64)t_object_2e313 + (u64)((u64)4UL));
+	*(u32 *)t__2e314 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e317 = (u64)((u64)0UL);
+	t__2e318 = (u64)((u64)t_object_2e317 + (u64)((u64)8UL));
+	*(u64 *)t__2e318 = (u64)((u64)0UL);
+	t__2e318 = (u64)((u64)t__2e318 + (u64)((u64)8UL));
+	*(u64 *)t__2e318 = (u64)((u64)0UL);
+	BLIT((u64)B130, t_object_2e313, 8);
+	BLIT((u64)B131, ((u64)((char *)&D_strliteral_2e316)), 24);
+	BLIT((u64)B132, t_object_2e317, 24);
+	t__2e312 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R133, (u64)B130, (u64)B131, (u64)B132);
+	t_tag_2e319 = (u64)(*(u32 *)t__2e312);
+	t__2e327 = (u64)(u32)(((u32)t_tag_2e319 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e327) goto L_member_2e324; else goto L__2e326;
+	L__2e326:;
+	t__2e329 = (u64)(u32)(((u32)t_tag_2e319 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e329) goto L_member_2e325; else goto L__2e328;
+	L__2e328:;
+	goto L_matches_2e323;
+	L_member_2e324:;
+	goto L_matches_2e323;
+	L_member_2e325:;
+	goto L_matches_2e322;
+	L_matches_2e322:;
+	goto L__2e320;
+	L_matches_2e323:;
+	t_abortsite_2e37 = ((u64)28UL);
+	goto L_abort_2e38;
+	L__2e330:;
+	L__2e321:;
+	t_abortsite_2e37 = ((u64)29UL);
+	goto L_abort_2e45;
+	L__2e320:;
+	*(u32 *)t_object_2e333 = (u32)((u64)3532310079UL);
+	t__2e334 = (u64)((u64)t_object_2e333 + (u64)((u64)4UL));
+	*(u32 *)t__2e334 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e337 = (u64)((u64)0UL);
+	t__2e338 = (u64)((u64)t_object_2e337 + (u64)((u64)8UL));
+	*(u64 *)t__2e338 = (u64)((u64)0UL);
+	t__2e338 = (u64)((u64)t__2e338 + (u64)((u64)8UL));
+	*(u64 *)t__2e338 = (u64)((u64)0UL);
+	BLIT((u64)B134, t_object_2e333, 8);
+	BLIT((u64)B135, ((u64)((char *)&D_strliteral_2e336)), 24);
+	BLIT((u64)B136, t_object_2e337, 24);
+	t__2e332 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R137, (u64)B134, (u64)B135, (u64)B136);
+	t_tag_2e339 = (u64)(*(u32 *)t__2e332);
+	t__2e347 = (u64)(u32)(((u32)t_tag_2e339 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e347) goto L_member_2e344; else goto L__2e346;
+	L__2e346:;
+	t__2e349 = (u64)(u32)(((u32)t_tag_2e339 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e349) goto L_member_2e345; else goto L__2e348;
+	L__2e348:;
+	goto L_matches_2e343;
+	L_member_2e344:;
+	goto L_matches_2e343;
+	L_member_2e345:;
+	goto L_matches_2e342;
+	L_matches_2e342:;
+	goto L__2e340;
+	L_matches_2e343:;
+	t_abortsite_2e37 = ((u64)30UL);
+	goto L_abort_2e38;
+	L__2e350:;
+	L__2e341:;
+	t_abortsite_2e37 = ((u64)31UL);
+	goto L_abort_2e45;
+	L__2e340:;
+	*(u32 *)t_object_2e353 = (u32)((u64)3532310079UL);
+	t__2e354 = (u64)((u64)t_object_2e353 + (u64)((u64)4UL));
+	*(u32 *)t__2e354 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e357 = (u64)((u64)0UL);
+	t__2e358 = (u64)((u64)t_object_2e357 + (u64)((u64)8UL));
+	*(u64 *)t__2e358 = (u64)((u64)0UL);
+	t__2e358 = (u64)((u64)t__2e358 + (u64)((u64)8UL));
+	*(u64 *)t__2e358 = (u64)((u64)0UL);
+	BLIT((u64)B138, t_object_2e353, 8);
+	BLIT((u64)B139, ((u64)((char *)&D_strliteral_2e356)), 24);
+	BLIT((u64)B140, t_object_2e357, 24);
+	t__2e352 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R141, (u64)B138, (u64)B139, (u64)B140);
+	t_tag_2e359 = (u64)(*(u32 *)t__2e352);
+	t__2e367 = (u64)(u32)(((u32)t_tag_2e359 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e367) goto L_member_2e364; else goto L__2e366;
+	L__2e366:;
+	t__2e369 = (u64)(u32)(((u32)t_tag_2e359 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e369) goto L_member_2e365; else goto L__2e368;
+	L__2e368:;
+	goto L_matches_2e363;
+	L_member_2e364:;
+	goto L_matches_2e363;
+	L_member_2e365:;
+	goto L_matches_2e362;
+	L_matches_2e362:;
+	goto L__2e360;
+	L_matches_2e363:;
+	t_abortsite_2e37 = ((u64)32UL);
+	goto L_abort_2e38;
+	L__2e370:;
+	L__2e361:;
+	t_abortsite_2e37 = ((u64)33UL);
+	goto L_abort_2e45;
+	L__2e360:;
+	*(u32 *)t_object_2e373 = (u32)((u64)3532310079UL);
+	t__2e374 = (u64)((u64)t_object_2e373 + (u64)((u64)4UL));
+	*(u32 *)t__2e374 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e377 = (u64)((u64)0UL);
+	t__2e378 = (u64)((u64)t_object_2e377 + (u64)((u64)8UL));
+	*(u64 *)t__2e378 = (u64)((u64)0UL);
+	t__2e378 = (u64)((u64)t__2e378 + (u64)((u64)8UL));
+	*(u64 *)t__2e378 = (u64)((u64)0UL);
+	BLIT((u64)B142, t_object_2e373, 8);
+	BLIT((u64)B143, ((u64)((char *)&D_strliteral_2e376)), 24);
+	BLIT((u64)B144, t_object_2e377, 24);
+	t__2e372 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R145, (u64)B142, (u64)B143, (u64)B144);
+	t_tag_2e379 = (u64)(*(u32 *)t__2e372);
+	t__2e387 = (u64)(u32)(((u32)t_tag_2e379 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e387) goto L_member_2e384; else goto L__2e386;
+	L__2e386:;
+	t__2e389 = (u64)(u32)(((u32)t_tag_2e379 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e389) goto L_member_2e385; else goto L__2e388;
+	L__2e388:;
+	goto L_matches_2e383;
+	L_member_2e384:;
+	goto L_matches_2e383;
+	L_member_2e385:;
+	goto L_matches_2e382;
+	L_matches_2e382:;
+	goto L__2e380;
+	L_matches_2e383:;
+	t_abortsite_2e37 = ((u64)34UL);
+	goto L_abort_2e38;
+	L__2e390:;
+	L__2e381:;
+	t_abortsite_2e37 = ((u64)35UL);
+	goto L_abort_2e45;
+	L__2e380:;
+	*(u32 *)t_object_2e393 = (u32)((u64)3532310079UL);
+	t__2e394 = (u64)((u64)t_object_2e393 + (u64)((u64)4UL));
+	*(u32 *)t__2e394 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e397 = (u64)((u64)0UL);
+	t__2e398 = (u64)((u64)t_object_2e397 + (u64)((u64)8UL));
+	*(u64 *)t__2e398 = (u64)((u64)0UL);
+	t__2e398 = (u64)((u64)t__2e398 + (u64)((u64)8UL));
+	*(u64 *)t__2e398 = (u64)((u64)0UL);
+	BLIT((u64)B146, t_object_2e393, 8);
+	BLIT((u64)B147, ((u64)((char *)&D_strliteral_2e396)), 24);
+	BLIT((u64)B148, t_object_2e397, 24);
+	t__2e392 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R149, (u64)B146, (u64)B147, (u64)B148);
+	t_tag_2e399 = (u64)(*(u32 *)t__2e392);
+	t__2e407 = (u64)(u32)(((u32)t_tag_2e399 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e407) goto L_member_2e404; else goto L__2e406;
+	L__2e406:;
+	t__2e409 = (u64)(u32)(((u32)t_tag_2e399 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e409) goto L_member_2e405; else goto L__2e408;
+	L__2e408:;
+	goto L_matches_2e403;
+	L_member_2e404:;
+	goto L_matches_2e403;
+	L_member_2e405:;
+	goto L_matches_2e402;
+	L_matches_2e402:;
+	goto L__2e400;
+	L_matches_2e403:;
+	t_abortsite_2e37 = ((u64)36UL);
+	goto L_abort_2e38;
+	L__2e410:;
+	L__2e401:;
+	t_abortsite_2e37 = ((u64)37UL);
+	goto L_abort_2e45;
+	L__2e400:;
+	*(u32 *)t_object_2e413 = (u32)((u64)3532310079UL);
+	t__2e414 = (u64)((u64)t_object_2e413 + (u64)((u64)4UL));
+	*(u32 *)t__2e414 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e417 = (u64)((u64)0UL);
+	t__2e418 = (u64)((u64)t_object_2e417 + (u64)((u64)8UL));
+	*(u64 *)t__2e418 = (u64)((u64)0UL);
+	t__2e418 = (u64)((u64)t__2e418 + (u64)((u64)8UL));
+	*(u64 *)t__2e418 = (u64)((u64)0UL);
+	BLIT((u64)B150, t_object_2e413, 8);
+	BLIT((u64)B151, ((u64)((char *)&D_strliteral_2e416)), 24);
+	BLIT((u64)B152, t_object_2e417, 24);
+	t__2e412 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R153, (u64)B150, (u64)B151, (u64)B152);
+	t_tag_2e419 = (u64)(*(u32 *)t__2e412);
+	t__2e427 = (u64)(u32)(((u32)t_tag_2e419 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e427) goto L_member_2e424; else goto L__2e426;
+	L__2e426:;
+	t__2e429 = (u64)(u32)(((u32)t_tag_2e419 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e429) goto L_member_2e425; else goto L__2e428;
+	L__2e428:;
+	goto L_matches_2e423;
+	L_member_2e424:;
+	goto L_matches_2e423;
+	L_member_2e425:;
+	goto L_matches_2e422;
+	L_matches_2e422:;
+	goto L__2e420;
+	L_matches_2e423:;
+	t_abortsite_2e37 = ((u64)38UL);
+	goto L_abort_2e38;
+	L__2e430:;
+	L__2e421:;
+	t_abortsite_2e37 = ((u64)39UL);
+	goto L_abort_2e45;
+	L__2e420:;
+	*(u32 *)t_object_2e433 = (u32)((u64)3532310079UL);
+	t__2e434 = (u64)((u64)t_object_2e433 + (u64)((u64)4UL));
+	*(u32 *)t__2e434 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e437 = (u64)((u64)0UL);
+	t__2e438 = (u64)((u64)t_object_2e437 + (u64)((u64)8UL));
+	*(u64 *)t__2e438 = (u64)((u64)0UL);
+	t__2e438 = (u64)((u64)t__2e438 + (u64)((u64)8UL));
+	*(u64 *)t__2e438 = (u64)((u64)0UL);
+	BLIT((u64)B154, t_object_2e433, 8);
+	BLIT((u64)B155, ((u64)((char *)&D_strliteral_2e436)), 24);
+	BLIT((u64)B156, t_object_2e437, 24);
+	t__2e432 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R157, (u64)B154, (u64)B155, (u64)B156);
+	t_tag_2e439 = (u64)(*(u32 *)t__2e432);
+	t__2e447 = (u64)(u32)(((u32)t_tag_2e439 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e447) goto L_member_2e444; else goto L__2e446;
+	L__2e446:;
+	t__2e449 = (u64)(u32)(((u32)t_tag_2e439 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e449) goto L_member_2e445; else goto L__2e448;
+	L__2e448:;
+	goto L_matches_2e443;
+	L_member_2e444:;
+	goto L_matches_2e443;
+	L_member_2e445:;
+	goto L_matches_2e442;
+	L_matches_2e442:;
+	goto L__2e440;
+	L_matches_2e443:;
+	t_abortsite_2e37 = ((u64)40UL);
+	goto L_abort_2e38;
+	L__2e450:;
+	L__2e441:;
+	t_abortsite_2e37 = ((u64)41UL);
+	goto L_abort_2e45;
+	L__2e440:;
+	*(u32 *)t_object_2e453 = (u32)((u64)3532310079UL);
+	t__2e454 = (u64)((u64)t_object_2e453 + (u64)((u64)4UL));
+	*(u32 *)t__2e454 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e457 = (u64)((u64)0UL);
+	t__2e458 = (u64)((u64)t_object_2e457 + (u64)((u64)8UL));
+	*(u64 *)t__2e458 = (u64)((u64)0UL);
+	t__2e458 = (u64)((u64)t__2e458 + (u64)((u64)8UL));
+	*(u64 *)t__2e458 = (u64)((u64)0UL);
+	BLIT((u64)B158, t_object_2e453, 8);
+	BLIT((u64)B159, ((u64)((char *)&D_strliteral_2e456)), 24);
+	BLIT((u64)B160, t_object_2e457, 24);
+	t__2e452 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R161, (u64)B158, (u64)B159, (u64)B160);
+	t_tag_2e459 = (u64)(*(u32 *)t__2e452);
+	t__2e467 = (u64)(u32)(((u32)t_tag_2e459 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e467) goto L_member_2e464; else goto L__2e466;
+	L__2e466:;
+	t__2e469 = (u64)(u32)(((u32)t_tag_2e459 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e469) goto L_member_2e465; else goto L__2e468;
+	L__2e468:;
+	goto L_matches_2e463;
+	L_member_2e464:;
+	goto L_matches_2e463;
+	L_member_2e465:;
+	goto L_matches_2e462;
+	L_matches_2e462:;
+	goto L__2e460;
+	L_matches_2e463:;
+	t_abortsite_2e37 = ((u64)42UL);
+	goto L_abort_2e38;
+	L__2e470:;
+	L__2e461:;
+	t_abortsite_2e37 = ((u64)43UL);
+	goto L_abort_2e45;
+	L__2e460:;
+	*(u32 *)t_object_2e473 = (u32)((u64)3532310079UL);
+	t__2e474 = (u64)((u64)t_object_2e473 + (u64)((u64)4UL));
+	*(u32 *)t__2e474 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e477 = (u64)((u64)0UL);
+	t__2e478 = (u64)((u64)t_object_2e477 + (u64)((u64)8UL));
+	*(u64 *)t__2e478 = (u64)((u64)0UL);
+	t__2e478 = (u64)((u64)t__2e478 + (u64)((u64)8UL));
+	*(u64 *)t__2e478 = (u64)((u64)0UL);
+	BLIT((u64)B162, t_object_2e473, 8);
+	BLIT((u64)B163, ((u64)((char *)&D_strliteral_2e476)), 24);
+	BLIT((u64)B164, t_object_2e477, 24);
+	t__2e472 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R165, (u64)B162, (u64)B163, (u64)B164);
+	t_tag_2e479 = (u64)(*(u32 *)t__2e472);
+	t__2e487 = (u64)(u32)(((u32)t_tag_2e479 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e487) goto L_member_2e484; else goto L__2e486;
+	L__2e486:;
+	t__2e489 = (u64)(u32)(((u32)t_tag_2e479 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e489) goto L_member_2e485; else goto L__2e488;
+	L__2e488:;
+	goto L_matches_2e483;
+	L_member_2e484:;
+	goto L_matches_2e483;
+	L_member_2e485:;
+	goto L_matches_2e482;
+	L_matches_2e482:;
+	goto L__2e480;
+	L_matches_2e483:;
+	t_abortsite_2e37 = ((u64)44UL);
+	goto L_abort_2e38;
+	L__2e490:;
+	L__2e481:;
+	t_abortsite_2e37 = ((u64)45UL);
+	goto L_abort_2e45;
+	L__2e480:;
+	*(u32 *)t_object_2e493 = (u32)((u64)3532310079UL);
+	t__2e494 = (u64)((u64)t_object_2e493 + (u64)((u64)4UL));
+	*(u32 *)t__2e494 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e497 = (u64)((u64)0UL);
+	t__2e498 = (u64)((u64)t_object_2e497 + (u64)((u64)8UL));
+	*(u64 *)t__2e498 = (u64)((u64)0UL);
+	t__2e498 = (u64)((u64)t__2e498 + (u64)((u64)8UL));
+	*(u64 *)t__2e498 = (u64)((u64)0UL);
+	BLIT((u64)B166, t_object_2e493, 8);
+	BLIT((u64)B167, ((u64)((char *)&D_strliteral_2e496)), 24);
+	BLIT((u64)B168, t_object_2e497, 24);
+	t__2e492 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R169, (u64)B166, (u64)B167, (u64)B168);
+	t_tag_2e499 = (u64)(*(u32 *)t__2e492);
+	t__2e507 = (u64)(u32)(((u32)t_tag_2e499 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e507) goto L_member_2e504; else goto L__2e506;
+	L__2e506:;
+	t__2e509 = (u64)(u32)(((u32)t_tag_2e499 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e509) goto L_member_2e505; else goto L__2e508;
+	L__2e508:;
+	goto L_matches_2e503;
+	L_member_2e504:;
+	goto L_matches_2e503;
+	L_member_2e505:;
+	goto L_matches_2e502;
+	L_matches_2e502:;
+	goto L__2e500;
+	L_matches_2e503:;
+	t_abortsite_2e37 = ((u64)46UL);
+	goto L_abort_2e38;
+	L__2e510:;
+	L__2e501:;
+	t_abortsite_2e37 = ((u64)47UL);
+	goto L_abort_2e45;
+	L__2e500:;
+	*(u32 *)t_object_2e513 = (u32)((u64)3532310079UL);
+	t__2e514 = (u64)((u64)t_object_2e513 + (u64)((u64)4UL));
+	*(u32 *)t__2e514 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e517 = (u64)((u64)0UL);
+	t__2e518 = (u64)((u64)t_object_2e517 + (u64)((u64)8UL));
+	*(u64 *)t__2e518 = (u64)((u64)0UL);
+	t__2e518 = (u64)((u64)t__2e518 + (u64)((u64)8UL));
+	*(u64 *)t__2e518 = (u64)((u64)0UL);
+	BLIT((u64)B170, t_object_2e513, 8);
+	BLIT((u64)B171, ((u64)((char *)&D_strliteral_2e516)), 24);
+	BLIT((u64)B172, t_object_2e517, 24);
+	t__2e512 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R173, (u64)B170, (u64)B171, (u64)B172);
+	t_tag_2e519 = (u64)(*(u32 *)t__2e512);
+	t__2e527 = (u64)(u32)(((u32)t_tag_2e519 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e527) goto L_member_2e524; else goto L__2e526;
+	L__2e526:;
+	t__2e529 = (u64)(u32)(((u32)t_tag_2e519 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e529) goto L_member_2e525; else goto L__2e528;
+	L__2e528:;
+	goto L_matches_2e523;
+	L_member_2e524:;
+	goto L_matches_2e523;
+	L_member_2e525:;
+	goto L_matches_2e522;
+	L_matches_2e522:;
+	goto L__2e520;
+	L_matches_2e523:;
+	t_abortsite_2e37 = ((u64)48UL);
+	goto L_abort_2e38;
+	L__2e530:;
+	L__2e521:;
+	t_abortsite_2e37 = ((u64)49UL);
+	goto L_abort_2e45;
+	L__2e520:;
+	*(u32 *)t_object_2e533 = (u32)((u64)3532310079UL);
+	t__2e534 = (u64)((u64)t_object_2e533 + (u64)((u64)4UL));
+	*(u32 *)t__2e534 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e537 = (u64)((u64)0UL);
+	t__2e538 = (u64)((u64)t_object_2e537 + (u64)((u64)8UL));
+	*(u64 *)t__2e538 = (u64)((u64)0UL);
+	t__2e538 = (u64)((u64)t__2e538 + (u64)((u64)8UL));
+	*(u64 *)t__2e538 = (u64)((u64)0UL);
+	BLIT((u64)B174, t_object_2e533, 8);
+	BLIT((u64)B175, ((u64)((char *)&D_strliteral_2e536)), 24);
+	BLIT((u64)B176, t_object_2e537, 24);
+	t__2e532 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R177, (u64)B174, (u64)B175, (u64)B176);
+	t_tag_2e539 = (u64)(*(u32 *)t__2e532);
+	t__2e547 = (u64)(u32)(((u32)t_tag_2e539 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e547) goto L_member_2e544; else goto L__2e546;
+	L__2e546:;
+	t__2e549 = (u64)(u32)(((u32)t_tag_2e539 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e549) goto L_member_2e545; else goto L__2e548;
+	L__2e548:;
+	goto L_matches_2e543;
+	L_member_2e544:;
+	goto L_matches_2e543;
+	L_member_2e545:;
+	goto L_matches_2e542;
+	L_matches_2e542:;
+	goto L__2e540;
+	L_matches_2e543:;
+	t_abortsite_2e37 = ((u64)50UL);
+	goto L_abort_2e38;
+	L__2e550:;
+	L__2e541:;
+	t_abortsite_2e37 = ((u64)51UL);
+	goto L_abort_2e45;
+	L__2e540:;
+	*(u32 *)t_object_2e553 = (u32)((u64)3532310079UL);
+	t__2e554 = (u64)((u64)t_object_2e553 + (u64)((u64)4UL));
+	*(u32 *)t__2e554 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e557 = (u64)((u64)0UL);
+	t__2e558 = (u64)((u64)t_object_2e557 + (u64)((u64)8UL));
+	*(u64 *)t__2e558 = (u64)((u64)0UL);
+	t__2e558 = (u64)((u64)t__2e558 + (u64)((u64)8UL));
+	*(u64 *)t__2e558 = (u64)((u64)0UL);
+	BLIT((u64)B178, t_object_2e553, 8);
+	BLIT((u64)B179, ((u64)((char *)&D_strliteral_2e556)), 24);
+	BLIT((u64)B180, t_object_2e557, 24);
+	t__2e552 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R181, (u64)B178, (u64)B179, (u64)B180);
+	t_tag_2e559 = (u64)(*(u32 *)t__2e552);
+	t__2e567 = (u64)(u32)(((u32)t_tag_2e559 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e567) goto L_member_2e564; else goto L__2e566;
+	L__2e566:;
+	t__2e569 = (u64)(u32)(((u32)t_tag_2e559 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e569) goto L_member_2e565; else goto L__2e568;
+	L__2e568:;
+	goto L_matches_2e563;
+	L_member_2e564:;
+	goto L_matches_2e563;
+	L_member_2e565:;
+	goto L_matches_2e562;
+	L_matches_2e562:;
+	goto L__2e560;
+	L_matches_2e563:;
+	t_abortsite_2e37 = ((u64)52UL);
+	goto L_abort_2e38;
+	L__2e570:;
+	L__2e561:;
+	t_abortsite_2e37 = ((u64)53UL);
+	goto L_abort_2e45;
+	L__2e560:;
+	*(u32 *)t_object_2e573 = (u32)((u64)3532310079UL);
+	t__2e574 = (u64)((u64)t_object_2e573 + (u64)((u64)4UL));
+	*(u32 *)t__2e574 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e577 = (u64)((u64)0UL);
+	t__2e578 = (u64)((u64)t_object_2e577 + (u64)((u64)8UL));
+	*(u64 *)t__2e578 = (u64)((u64)0UL);
+	t__2e578 = (u64)((u64)t__2e578 + (u64)((u64)8UL));
+	*(u64 *)t__2e578 = (u64)((u64)0UL);
+	BLIT((u64)B182, t_object_2e573, 8);
+	BLIT((u64)B183, ((u64)((char *)&D_strliteral_2e576)), 24);
+	BLIT((u64)B184, t_object_2e577, 24);
+	t__2e572 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R185, (u64)B182, (u64)B183, (u64)B184);
+	t_tag_2e579 = (u64)(*(u32 *)t__2e572);
+	t__2e587 = (u64)(u32)(((u32)t_tag_2e579 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e587) goto L_member_2e584; else goto L__2e586;
+	L__2e586:;
+	t__2e589 = (u64)(u32)(((u32)t_tag_2e579 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e589) goto L_member_2e585; else goto L__2e588;
+	L__2e588:;
+	goto L_matches_2e583;
+	L_member_2e584:;
+	goto L_matches_2e583;
+	L_member_2e585:;
+	goto L_matches_2e582;
+	L_matches_2e582:;
+	goto L__2e580;
+	L_matches_2e583:;
+	t_abortsite_2e37 = ((u64)54UL);
+	goto L_abort_2e38;
+	L__2e590:;
+	L__2e581:;
+	t_abortsite_2e37 = ((u64)55UL);
+	goto L_abort_2e45;
+	L__2e580:;
+	*(u32 *)t_object_2e593 = (u32)((u64)3532310079UL);
+	t__2e594 = (u64)((u64)t_object_2e593 + (u64)((u64)4UL));
+	*(u32 *)t__2e594 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e597 = (u64)((u64)0UL);
+	t__2e598 = (u64)((u64)t_object_2e597 + (u64)((u64)8UL));
+	*(u64 *)t__2e598 = (u64)((u64)0UL);
+	t__2e598 = (u64)((u64)t__2e598 + (u64)((u64)8UL));
+	*(u64 *)t__2e598 = (u64)((u64)0UL);
+	BLIT((u64)B186, t_object_2e593, 8);
+	BLIT((u64)B187, ((u64)((char *)&D_strliteral_2e596)), 24);
+	BLIT((u64)B188, t_object_2e597, 24);
+	t__2e592 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R189, (u64)B186, (u64)B187, (u64)B188);
+	t_tag_2e599 = (u64)(*(u32 *)t__2e592);
+	t__2e607 = (u64)(u32)(((u32)t_tag_2e599 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e607) goto L_member_2e604; else goto L__2e606;
+	L__2e606:;
+	t__2e609 = (u64)(u32)(((u32)t_tag_2e599 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e609) goto L_member_2e605; else goto L__2e608;
+	L__2e608:;
+	goto L_matches_2e603;
+	L_member_2e604:;
+	goto L_matches_2e603;
+	L_member_2e605:;
+	goto L_matches_2e602;
+	L_matches_2e602:;
+	goto L__2e600;
+	L_matches_2e603:;
+	t_abortsite_2e37 = ((u64)56UL);
+	goto L_abort_2e38;
+	L__2e610:;
+	L__2e601:;
+	t_abortsite_2e37 = ((u64)57UL);
+	goto L_abort_2e45;
+	L__2e600:;
+	*(u32 *)t_object_2e613 = (u32)((u64)3532310079UL);
+	t__2e614 = (u64)((u64)t_object_2e613 + (u64)((u64)4UL));
+	*(u32 *)t__2e614 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e617 = (u64)((u64)0UL);
+	t__2e618 = (u64)((u64)t_object_2e617 + (u64)((u64)8UL));
+	*(u64 *)t__2e618 = (u64)((u64)0UL);
+	t__2e618 = (u64)((u64)t__2e618 + (u64)((u64)8UL));
+	*(u64 *)t__2e618 = (u64)((u64)0UL);
+	BLIT((u64)B190, t_object_2e613, 8);
+	BLIT((u64)B191, ((u64)((char *)&D_strliteral_2e616)), 24);
+	BLIT((u64)B192, t_object_2e617, 24);
+	t__2e612 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R193, (u64)B190, (u64)B191, (u64)B192);
+	t_tag_2e619 = (u64)(*(u32 *)t__2e612);
+	t__2e627 = (u64)(u32)(((u32)t_tag_2e619 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e627) goto L_member_2e624; else goto L__2e626;
+	L__2e626:;
+	t__2e629 = (u64)(u32)(((u32)t_tag_2e619 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e629) goto L_member_2e625; else goto L__2e628;
+	L__2e628:;
+	goto L_matches_2e623;
+	L_member_2e624:;
+	goto L_matches_2e623;
+	L_member_2e625:;
+	goto L_matches_2e622;
+	L_matches_2e622:;
+	goto L__2e620;
+	L_matches_2e623:;
+	t_abortsite_2e37 = ((u64)58UL);
+	goto L_abort_2e38;
+	L__2e630:;
+	L__2e621:;
+	t_abortsite_2e37 = ((u64)59UL);
+	goto L_abort_2e45;
+	L__2e620:;
+	*(u32 *)t_object_2e633 = (u32)((u64)3532310079UL);
+	t__2e634 = (u64)((u64)t_object_2e633 + (u64)((u64)4UL));
+	*(u32 *)t__2e634 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e637 = (u64)((u64)0UL);
+	t__2e638 = (u64)((u64)t_object_2e637 + (u64)((u64)8UL));
+	*(u64 *)t__2e638 = (u64)((u64)0UL);
+	t__2e638 = (u64)((u64)t__2e638 + (u64)((u64)8UL));
+	*(u64 *)t__2e638 = (u64)((u64)0UL);
+	BLIT((u64)B194, t_object_2e633, 8);
+	BLIT((u64)B195, ((u64)((char *)&D_strliteral_2e636)), 24);
+	BLIT((u64)B196, t_object_2e637, 24);
+	t__2e632 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R197, (u64)B194, (u64)B195, (u64)B196);
+	t_tag_2e639 = (u64)(*(u32 *)t__2e632);
+	t__2e647 = (u64)(u32)(((u32)t_tag_2e639 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e647) goto L_member_2e644; else goto L__2e646;
+	L__2e646:;
+	t__2e649 = (u64)(u32)(((u32)t_tag_2e639 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e649) goto L_member_2e645; else goto L__2e648;
+	L__2e648:;
+	goto L_matches_2e643;
+	L_member_2e644:;
+	goto L_matches_2e643;
+	L_member_2e645:;
+	goto L_matches_2e642;
+	L_matches_2e642:;
+	goto L__2e640;
+	L_matches_2e643:;
+	t_abortsite_2e37 = ((u64)60UL);
+	goto L_abort_2e38;
+	L__2e650:;
+	L__2e641:;
+	t_abortsite_2e37 = ((u64)61UL);
+	goto L_abort_2e45;
+	L__2e640:;
+	*(u32 *)t_object_2e653 = (u32)((u64)3532310079UL);
+	t__2e654 = (u64)((u64)t_object_2e653 + (u64)((u64)4UL));
+	*(u32 *)t__2e654 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e655 = (u64)((u64)0UL);
+	t__2e656 = (u64)((u64)t_object_2e655 + (u64)((u64)8UL));
+	*(u64 *)t__2e656 = (u64)((u64)0UL);
+	t__2e656 = (u64)((u64)t__2e656 + (u64)((u64)8UL));
+	*(u64 *)t__2e656 = (u64)((u64)0UL);
+	BLIT((u64)B198, t_object_2e653, 8);
+	BLIT((u64)B199, ((u64)((char *)&D_strliteral_2e376)), 24);
+	BLIT((u64)B200, t_object_2e655, 24);
+	t__2e652 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R201, (u64)B198, (u64)B199, (u64)B200);
+	t_tag_2e657 = (u64)(*(u32 *)t__2e652);
+	t__2e665 = (u64)(u32)(((u32)t_tag_2e657 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e665) goto L_member_2e662; else goto L__2e664;
+	L__2e664:;
+	t__2e667 = (u64)(u32)(((u32)t_tag_2e657 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e667) goto L_member_2e663; else goto L__2e666;
+	L__2e666:;
+	goto L_matches_2e661;
+	L_member_2e662:;
+	goto L_matches_2e661;
+	L_member_2e663:;
+	goto L_matches_2e660;
+	L_matches_2e660:;
+	goto L__2e658;
+	L_matches_2e661:;
+	t_abortsite_2e37 = ((u64)62UL);
+	goto L_abort_2e38;
+	L__2e668:;
+	L__2e659:;
+	t_abortsite_2e37 = ((u64)63UL);
+	goto L_abort_2e45;
+	L__2e658:;
+	*(u32 *)t_object_2e671 = (u32)((u64)3532310079UL);
+	t__2e672 = (u64)((u64)t_object_2e671 + (u64)((u64)4UL));
+	*(u32 *)t__2e672 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e675 = (u64)((u64)0UL);
+	t__2e676 = (u64)((u64)t_object_2e675 + (u64)((u64)8UL));
+	*(u64 *)t__2e676 = (u64)((u64)0UL);
+	t__2e676 = (u64)((u64)t__2e676 + (u64)((u64)8UL));
+	*(u64 *)t__2e676 = (u64)((u64)0UL);
+	BLIT((u64)B202, t_object_2e671, 8);
+	BLIT((u64)B203, ((u64)((char *)&D_strliteral_2e674)), 24);
+	BLIT((u64)B204, t_object_2e675, 24);
+	t__2e670 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R205, (u64)B202, (u64)B203, (u64)B204);
+	t_tag_2e677 = (u64)(*(u32 *)t__2e670);
+	t__2e685 = (u64)(u32)(((u32)t_tag_2e677 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e685) goto L_member_2e682; else goto L__2e684;
+	L__2e684:;
+	t__2e687 = (u64)(u32)(((u32)t_tag_2e677 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e687) goto L_member_2e683; else goto L__2e686;
+	L__2e686:;
+	goto L_matches_2e681;
+	L_member_2e682:;
+	goto L_matches_2e681;
+	L_member_2e683:;
+	goto L_matches_2e680;
+	L_matches_2e680:;
+	goto L__2e678;
+	L_matches_2e681:;
+	t_abortsite_2e37 = ((u64)64UL);
+	goto L_abort_2e38;
+	L__2e688:;
+	L__2e679:;
+	t_abortsite_2e37 = ((u64)65UL);
+	goto L_abort_2e45;
+	L__2e678:;
+	*(u32 *)t_object_2e691 = (u32)((u64)3532310079UL);
+	t__2e692 = (u64)((u64)t_object_2e691 + (u64)((u64)4UL));
+	*(u32 *)t__2e692 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e695 = (u64)((u64)0UL);
+	t__2e696 = (u64)((u64)t_object_2e695 + (u64)((u64)8UL));
+	*(u64 *)t__2e696 = (u64)((u64)0UL);
+	t__2e696 = (u64)((u64)t__2e696 + (u64)((u64)8UL));
+	*(u64 *)t__2e696 = (u64)((u64)0UL);
+	BLIT((u64)B206, t_object_2e691, 8);
+	BLIT((u64)B207, ((u64)((char *)&D_strliteral_2e694)), 24);
+	BLIT((u64)B208, t_object_2e695, 24);
+	t__2e690 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R209, (u64)B206, (u64)B207, (u64)B208);
+	t_tag_2e697 = (u64)(*(u32 *)t__2e690);
+	t__2e705 = (u64)(u32)(((u32)t_tag_2e697 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e705) goto L_member_2e702; else goto L__2e704;
+	L__2e704:;
+	t__2e707 = (u64)(u32)(((u32)t_tag_2e697 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e707) goto L_member_2e703; else goto L__2e706;
+	L__2e706:;
+	goto L_matches_2e701;
+	L_member_2e702:;
+	goto L_matches_2e701;
+	L_member_2e703:;
+	goto L_matches_2e700;
+	L_matches_2e700:;
+	goto L__2e698;
+	L_matches_2e701:;
+	t_abortsite_2e37 = ((u64)66UL);
+	goto L_abort_2e38;
+	L__2e708:;
+	L__2e699:;
+	t_abortsite_2e37 = ((u64)67UL);
+	goto L_abort_2e45;
+	L__2e698:;
+	*(u32 *)t_object_2e711 = (u32)((u64)3532310079UL);
+	t__2e712 = (u64)((u64)t_object_2e711 + (u64)((u64)4UL));
+	*(u32 *)t__2e712 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e715 = (u64)((u64)0UL);
+	t__2e716 = (u64)((u64)t_object_2e715 + (u64)((u64)8UL));
+	*(u64 *)t__2e716 = (u64)((u64)0UL);
+	t__2e716 = (u64)((u64)t__2e716 + (u64)((u64)8UL));
+	*(u64 *)t__2e716 = (u64)((u64)0UL);
+	BLIT((u64)B210, t_object_2e711, 8);
+	BLIT((u64)B211, ((u64)((char *)&D_strliteral_2e714)), 24);
+	BLIT((u64)B212, t_object_2e715, 24);
+	t__2e710 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R213, (u64)B210, (u64)B211, (u64)B212);
+	t_tag_2e717 = (u64)(*(u32 *)t__2e710);
+	t__2e725 = (u64)(u32)(((u32)t_tag_2e717 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e725) goto L_member_2e722; else goto L__2e724;
+	L__2e724:;
+	t__2e727 = (u64)(u32)(((u32)t_tag_2e717 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e727) goto L_member_2e723; else goto L__2e726;
+	L__2e726:;
+	goto L_matches_2e721;
+	L_member_2e722:;
+	goto L_matches_2e721;
+	L_member_2e723:;
+	goto L_matches_2e720;
+	L_matches_2e720:;
+	goto L__2e718;
+	L_matches_2e721:;
+	t_abortsite_2e37 = ((u64)68UL);
+	goto L_abort_2e38;
+	L__2e728:;
+	L__2e719:;
+	t_abortsite_2e37 = ((u64)69UL);
+	goto L_abort_2e45;
+	L__2e718:;
+	*(u32 *)t_object_2e731 = (u32)((u64)3532310079UL);
+	t__2e732 = (u64)((u64)t_object_2e731 + (u64)((u64)4UL));
+	*(u32 *)t__2e732 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e735 = (u64)((u64)0UL);
+	t__2e736 = (u64)((u64)t_object_2e735 + (u64)((u64)8UL));
+	*(u64 *)t__2e736 = (u64)((u64)0UL);
+	t__2e736 = (u64)((u64)t__2e736 + (u64)((u64)8UL));
+	*(u64 *)t__2e736 = (u64)((u64)0UL);
+	BLIT((u64)B214, t_object_2e731, 8);
+	BLIT((u64)B215, ((u64)((char *)&D_strliteral_2e734)), 24);
+	BLIT((u64)B216, t_object_2e735, 24);
+	t__2e730 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R217, (u64)B214, (u64)B215, (u64)B216);
+	t_tag_2e737 = (u64)(*(u32 *)t__2e730);
+	t__2e745 = (u64)(u32)(((u32)t_tag_2e737 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e745) goto L_member_2e742; else goto L__2e744;
+	L__2e744:;
+	t__2e747 = (u64)(u32)(((u32)t_tag_2e737 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e747) goto L_member_2e743; else goto L__2e746;
+	L__2e746:;
+	goto L_matches_2e741;
+	L_member_2e742:;
+	goto L_matches_2e741;
+	L_member_2e743:;
+	goto L_matches_2e740;
+	L_matches_2e740:;
+	goto L__2e738;
+	L_matches_2e741:;
+	t_abortsite_2e37 = ((u64)70UL);
+	goto L_abort_2e38;
+	L__2e748:;
+	L__2e739:;
+	t_abortsite_2e37 = ((u64)71UL);
+	goto L_abort_2e45;
+	L__2e738:;
+	*(u32 *)t_object_2e751 = (u32)((u64)3532310079UL);
+	t__2e752 = (u64)((u64)t_object_2e751 + (u64)((u64)4UL));
+	*(u32 *)t__2e752 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e755 = (u64)((u64)0UL);
+	t__2e756 = (u64)((u64)t_object_2e755 + (u64)((u64)8UL));
+	*(u64 *)t__2e756 = (u64)((u64)0UL);
+	t__2e756 = (u64)((u64)t__2e756 + (u64)((u64)8UL));
+	*(u64 *)t__2e756 = (u64)((u64)0UL);
+	BLIT((u64)B218, t_object_2e751, 8);
+	BLIT((u64)B219, ((u64)((char *)&D_strliteral_2e754)), 24);
+	BLIT((u64)B220, t_object_2e755, 24);
+	t__2e750 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R221, (u64)B218, (u64)B219, (u64)B220);
+	t_tag_2e757 = (u64)(*(u32 *)t__2e750);
+	t__2e765 = (u64)(u32)(((u32)t_tag_2e757 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e765) goto L_member_2e762; else goto L__2e764;
+	L__2e764:;
+	t__2e767 = (u64)(u32)(((u32)t_tag_2e757 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e767) goto L_member_2e763; else goto L__2e766;
+	L__2e766:;
+	goto L_matches_2e761;
+	L_member_2e762:;
+	goto L_matches_2e761;
+	L_member_2e763:;
+	goto L_matches_2e760;
+	L_matches_2e760:;
+	goto L__2e758;
+	L_matches_2e761:;
+	t_abortsite_2e37 = ((u64)72UL);
+	goto L_abort_2e38;
+	L__2e768:;
+	L__2e759:;
+	t_abortsite_2e37 = ((u64)73UL);
+	goto L_abort_2e45;
+	L__2e758:;
+	goto L__2e9;
+	L__2e769:;
+	L__2e9:;
+	return;
+	L_abort_2e38:;
+	t__2e39 = (u64)((u64)t_abortsite_2e37 * (u64)((u64)16UL));
+	t__2e39 = (u64)((u64)((u64)((char *)&D_abortsites_2e36)) + (u64)t__2e39);
+	t__2e40 = (u64)(*(u64 *)t__2e39);
+	t__2e41 = (u64)((u64)t__2e39 + (u64)((u64)8UL));
+	t__2e42 = (u64)(*(u32 *)t__2e41);
+	t__2e41 = (u64)((u64)t__2e39 + (u64)((u64)12UL));
+	t__2e43 = (u64)(*(u32 *)t__2e41);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e40, (u64)t__2e42, (u64)t__2e43, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e45:;
+	t__2e46 = (u64)((u64)t_abortsite_2e37 * (u64)((u64)16UL));
+	t__2e46 = (u64)((u64)((u64)((char *)&D_abortsites_2e36)) + (u64)t__2e46);
+	t__2e47 = (u64)(*(u64 *)t__2e46);
+	t__2e48 = (u64)((u64)t__2e46 + (u64)((u64)8UL));
+	t__2e49 = (u64)(*(u32 *)t__2e48);
+	t__2e48 = (u64)((u64)t__2e46 + (u64)((u64)12UL));
+	t__2e50 = (u64)(*(u32 *)t__2e48);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e47, (u64)t__2e49, (u64)t__2e50, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_casts(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[4] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[4] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[4] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[8] __attribute__((aligned(16)));
+	char A14[4] __attribute__((aligned(16)));
+	char A15[8] __attribute__((aligned(16)));
+	char A16[4] __attribute__((aligned(16)));
+	char A17[8] __attribute__((aligned(16)));
+	u64 t__2e775;
+	u64 t__2e777;
+	u64 t__2e779;
+	u64 t__2e782;
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e787;
+	u64 t__2e788;
+	u64 t__2e789;
+	u64 t__2e790;
+	u64 t__2e794;
+	u64 t__2e795;
+	u64 t__2e796;
+	u64 t__2e797;
+	u64 t__2e798;
+	u64 t__2e800;
+	u64 t__2e802;
+	u64 t__2e805;
+	u64 t__2e808;
+	u64 t__2e809;
+	u64 t__2e810;
+	u64 t__2e811;
+	u64 t__2e812;
+	u64 t__2e813;
+	u64 t__2e815;
+	u64 t__2e817;
+	u64 t__2e820;
+	u64 t__2e822;
+	u64 t__2e823;
+	u64 t__2e824;
+	u64 t__2e825;
+	u64 t__2e826;
+	u64 t__2e829;
+	u64 t__2e832;
+	u64 t__2e833;
+	u64 t__2e834;
+	u64 t__2e835;
+	u64 t__2e836;
+	u64 t__2e837;
+	u64 t__2e839;
+	u64 t__2e842;
+	u64 t__2e843;
+	u64 t__2e845;
+	u64 t__2e848;
+	u64 t__2e849;
+	u64 t__2e852;
+	u64 t__2e853;
+	u64 t__2e856;
+	u64 t__2e857;
+	u64 t__2e858;
+	u64 t__2e860;
+	u64 t__2e863;
+	u64 t__2e864;
+	u64 t__2e866;
+	u64 t__2e868;
+	u64 t__2e871;
+	u64 t__2e874;
+	u64 t__2e875;
+	u64 t__2e876;
+	u64 t__2e877;
+	u64 t__2e878;
+	u64 t__2e879;
+	u64 t_abortsite_2e792;
+	u64 t_binding_2e774;
+	u64 t_binding_2e776;
+	u64 t_binding_2e778;
+	u64 t_binding_2e799;
+	u64 t_binding_2e801;
+	u64 t_binding_2e814;
+	u64 t_binding_2e816;
+	u64 t_binding_2e838;
+	u64 t_binding_2e844;
+	u64 t_binding_2e859;
+	u64 t_binding_2e865;
+	u64 t_binding_2e867;
+	L_start_2e770:;
+	t_binding_2e774 = (u64)A0;
+	t__2e775 = (u64)A1;
+	t_binding_2e776 = (u64)A2;
+	t_binding_2e778 = (u64)A3;
+	t_binding_2e799 = (u64)A4;
+	t__2e800 = (u64)A5;
+	t_binding_2e801 = (u64)A6;
+	t_binding_2e814 = (u64)A7;
+	t__2e815 = (u64)A8;
+	t_binding_2e816 = (u64)A9;
+	t_binding_2e838 = (u64)A10;
+	t__2e839 = (u64)A11;
+	t_binding_2e844 = (u64)A12;
+	t_binding_2e859 = (u64)A13;
+	t__2e860 = (u64)A14;
+	t_binding_2e865 = (u64)A15;
+	t__2e866 = (u64)A16;
+	t_binding_2e867 = (u64)A17;
+	L_body_2e771:;
+	*(u32 *)t__2e775 = (u32)((u64)4UL);
+	*(u64 *)t_binding_2e774 = (u64)t__2e775;
+	t__2e777 = (u64)(*(u64 *)t_binding_2e774);
+	*(u64 *)t_binding_2e776 = (u64)t__2e777;
+	t__2e779 = (u64)(*(u64 *)t_binding_2e776);
+	*(u64 *)t_binding_2e778 = (u64)t__2e779;
+	t__2e786 = (u64)(*(u64 *)t_binding_2e774);
+	t__2e787 = (u64)(*(u64 *)t_binding_2e778);
+	t__2e785 = (u64)(u32)(((u64)t__2e786 == (u64)t__2e787));
+	t__2e782 = (u64)(u32)t__2e785;
+	if ((u32)t__2e782) goto L__2e783; else goto L__2e784;
+	L__2e783:;
+	t__2e789 = (u64)(*(u64 *)t_binding_2e778);
+	t__2e790 = (u64)(u32)(*(u32 *)t__2e789);
+	t__2e788 = (u64)(u32)(((u32)t__2e790 == (u32)((u64)4UL)));
+	t__2e782 = (u64)(u32)t__2e788;
+	goto L__2e784;
+	L__2e784:;
+	if ((u32)t__2e782) goto L_passed_2e781; else goto L_failed_2e780;
+	L_failed_2e780:;
+	t_abortsite_2e792 = ((u64)0UL);
+	goto L_abort_2e793;
+	L_passed_2e781:;
+	*(u32 *)t__2e800 = (u32)((u64)7UL);
+	*(u64 *)t_binding_2e799 = (u64)t__2e800;
+	t__2e802 = (u64)(*(u64 *)t_binding_2e799);
+	*(u64 *)t_binding_2e801 = (u64)t__2e802;
+	t__2e809 = (u64)(*(u64 *)t_binding_2e801);
+	t__2e810 = (u64)(*(u64 *)t_binding_2e799);
+	t__2e808 = (u64)(u32)(((u64)t__2e809 == (u64)t__2e810));
+	t__2e805 = (u64)(u32)t__2e808;
+	if ((u32)t__2e805) goto L__2e806; else goto L__2e807;
+	L__2e806:;
+	t__2e812 = (u64)(*(u64 *)t_binding_2e801);
+	t__2e813 = (u64)(u32)(*(u32 *)t__2e812);
+	t__2e811 = (u64)(u32)(((u32)t__2e813 == (u32)((u64)7UL)));
+	t__2e805 = (u64)(u32)t__2e811;
+	goto L__2e807;
+	L__2e807:;
+	if ((u32)t__2e805) goto L_passed_2e804; else goto L_failed_2e803;
+	L_failed_2e803:;
+	t_abortsite_2e792 = ((u64)1UL);
+	goto L_abort_2e793;
+	L_passed_2e804:;
+	*(u32 *)t__2e815 = (u32)((u64)10UL);
+	*(u64 *)t_binding_2e814 = (u64)t__2e815;
+	t__2e817 = (u64)(*(u64 *)t_binding_2e814);
+	t__2e820 = (u64)(u32)(((u64)t__2e817 != (u64)((u64)0UL)));
+	if ((u32)t__2e820) goto L_passed_2e819; else goto L_failed_2e818;
+	L_failed_2e818:;
+	t_abortsite_2e792 = ((u64)2UL);
+	goto L_abort_2e821;
+	L_passed_2e819:;
+	*(u64 *)t_binding_2e816 = (u64)t__2e817;
+	t__2e833 = (u64)(*(u64 *)t_binding_2e816);
+	t__2e834 = (u64)(*(u64 *)t_binding_2e814);
+	t__2e832 = (u64)(u32)(((u64)t__2e833 == (u64)t__2e834));
+	t__2e829 = (u64)(u32)t__2e832;
+	if ((u32)t__2e829) goto L__2e830; else goto L__2e831;
+	L__2e830:;
+	t__2e836 = (u64)(*(u64 *)t_binding_2e816);
+	t__2e837 = (u64)(u32)(*(u32 *)t__2e836);
+	t__2e835 = (u64)(u32)(((u32)t__2e837 == (u32)((u64)10UL)));
+	t__2e829 = (u64)(u32)t__2e835;
+	goto L__2e831;
+	L__2e831:;
+	if ((u32)t__2e829) goto L_passed_2e828; else goto L_failed_2e827;
+	L_failed_2e827:;
+	t_abortsite_2e792 = ((u64)3UL);
+	goto L_abort_2e793;
+	L_passed_2e828:;
+	*(u32 *)t__2e839 = (u32)((u64)4UL);
+	*(u64 *)t_binding_2e838 = (u64)t__2e839;
+	t__2e842 = (u64)(*(u64 *)t_binding_2e838);
+	t__2e843 = (u64)(u32)(((u64)t__2e842 != (u64)((u64)0UL)));
+	if ((u32)t__2e843) goto L_passed_2e841; else goto L_failed_2e840;
+	L_failed_2e840:;
+	t_abortsite_2e792 = ((u64)4UL);
+	goto L_abort_2e793;
+	L_passed_2e841:;
+	t__2e845 = ((u64)0UL);
+	*(u64 *)t_binding_2e844 = (u64)t__2e845;
+	t__2e848 = (u64)(*(u64 *)t_binding_2e844);
+	t__2e849 = (u64)(u32)(((u64)t__2e848 == (u64)((u64)0UL)));
+	if ((u32)t__2e849) goto L_passed_2e847; else goto L_failed_2e846;
+	L_failed_2e846:;
+	t_abortsite_2e792 = ((u64)5UL);
+	goto L_abort_2e793;
+	L_passed_2e847:;
+	t__2e853 = (u64)(*(u64 *)t_binding_2e844);
+	t__2e856 = (u64)(u32)(((u64)t__2e853 == (u64)((u64)0UL)));
+	if ((u32)t__2e856) goto L_passed_2e855; else goto L_failed_2e854;
+	L_failed_2e854:;
+	t_abortsite_2e792 = ((u64)6UL);
+	goto L_abort_2e821;
+	L_passed_2e855:;
+	t__2e857 = ((u64)0UL);
+	t__2e858 = ((u64)0UL);
+	t__2e852 = (u64)(u32)(((u64)t__2e857 == (u64)t__2e858));
+	if ((u32)t__2e852) goto L_passed_2e851; else goto L_failed_2e850;
+	L_failed_2e850:;
+	t_abortsite_2e792 = ((u64)7UL);
+	goto L_abort_2e793;
+	L_passed_2e851:;
+	*(u32 *)t__2e860 = (u32)((u64)4UL);
+	*(u64 *)t_binding_2e859 = (u64)t__2e860;
+	t__2e863 = (u64)(*(u64 *)t_binding_2e859);
+	t__2e864 = (u64)(u32)(((u64)t__2e863 != (u64)((u64)0UL)));
+	if ((u32)t__2e864) goto L_passed_2e862; else goto L_failed_2e861;
+	L_failed_2e861:;
+	t_abortsite_2e792 = ((u64)8UL);
+	goto L_abort_2e793;
+	L_passed_2e862:;
+	*(u32 *)t__2e866 = (u32)((u64)42UL);
+	*(u64 *)t_binding_2e865 = (u64)t__2e866;
+	t__2e868 = (u64)(*(u64 *)t_binding_2e865);
+	*(u64 *)t_binding_2e867 = (u64)t__2e868;
+	t__2e875 = (u64)(*(u64 *)t_binding_2e867);
+	t__2e876 = (u64)(*(u64 *)t_binding_2e865);
+	t__2e874 = (u64)(u32)(((u64)t__2e875 == (u64)t__2e876));
+	t__2e871 = (u64)(u32)t__2e874;
+	if ((u32)t__2e871) goto L__2e872; else goto L__2e873;
+	L__2e872:;
+	t__2e878 = (u64)(*(u64 *)t_binding_2e867);
+	t__2e879 = (u64)(u32)(*(i32 *)t__2e878);
+	t__2e877 = (u64)(u32)(((u32)t__2e879 == (u32)((u64)42UL)));
+	t__2e871 = (u64)(u32)t__2e877;
+	goto L__2e873;
+	L__2e873:;
+	if ((u32)t__2e871) goto L_passed_2e870; else goto L_failed_2e869;
+	L_failed_2e869:;
+	t_abortsite_2e792 = ((u64)9UL);
+	goto L_abort_2e793;
+	L_passed_2e870:;
+	goto L__2e772;
+	L__2e880:;
+	L__2e772:;
+	return;
+	L_abort_2e793:;
+	t__2e794 = (u64)((u64)t_abortsite_2e792 * (u64)((u64)16UL));
+	t__2e794 = (u64)((u64)((u64)((char *)&D_abortsites_2e791)) + (u64)t__2e794);
+	t__2e795 = (u64)(*(u64 *)t__2e794);
+	t__2e796 = (u64)((u64)t__2e794 + (u64)((u64)8UL));
+	t__2e797 = (u64)(*(u32 *)t__2e796);
+	t__2e796 = (u64)((u64)t__2e794 + (u64)((u64)12UL));
+	t__2e798 = (u64)(*(u32 *)t__2e796);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e795, (u64)t__2e797, (u64)t__2e798, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e821:;
+	t__2e822 = (u64)((u64)t_abortsite_2e792 * (u64)((u64)16UL));
+	t__2e822 = (u64)((u64)((u64)((char *)&D_abortsites_2e791)) + (u64)t__2e822);
+	t__2e823 = (u64)(*(u64 *)t__2e822);
+	t__2e824 = (u64)((u64)t__2e822 + (u64)((u64)8UL));
+	t__2e825 = (u64)(*(u32 *)t__2e824);
+	t__2e824 = (u64)((u64)t__2e822 + (u64)((u64)12UL));
+	t__2e826 = (u64)(*(u32 *)t__2e824);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e823, (u64)t__2e825, (u64)t__2e826, (u64)((u64)1UL));
+	__builtin_trap();
+}
+static void F___nullable(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char B4[8] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char R7[4] __attribute__((aligned(16)));
+	u64 t__2e886;
+	u64 t__2e889;
+	u64 t__2e890;
+	u64 t__2e891;
+	u64 t__2e895;
+	u64 t__2e896;
+	u64 t__2e897;
+	u64 t__2e898;
+	u64 t__2e899;
+	u64 t__2e903;
+	u64 t__2e904;
+	u64 t__2e905;
+	u64 t__2e907;
+	u64 t__2e909;
+	u64 t__2e913;
+	u64 t__2e922;
+	u64 t__2e924;
+	u64 t__2e926;
+	u64 t__2e927;
+	u64 t__2e928;
+	u64 t__2e929;
+	u64 t__2e930;
+	u64 t__2e933;
+	u64 t__2e934;
+	u64 t__2e935;
+	u64 t__2e936;
+	u64 t__2e937;
+	u64 t_abortsite_2e893;
+	u64 t_binding_2e885;
+	u64 t_binding_2e900;
+	u64 t_object_2e908;
+	u64 t_object_2e912;
+	u64 t_tag_2e914;
+	L_start_2e881:;
+	t_binding_2e885 = (u64)A0;
+	t_binding_2e900 = (u64)A1;
+	t_object_2e908 = (u64)A2;
+	t_object_2e912 = (u64)A3;
+	L_body_2e882:;
+	t__2e886 = ((u64)0UL);
+	*(u64 *)t_binding_2e885 = (u64)t__2e886;
+	t__2e890 = (u64)(*(u64 *)t_binding_2e885);
+	t__2e891 = ((u64)0UL);
+	t__2e889 = (u64)(u32)(((u64)t__2e890 == (u64)t__2e891));
+	if ((u32)t__2e889) goto L_passed_2e888; else goto L_failed_2e887;
+	L_failed_2e887:;
+	t_abortsite_2e893 = ((u64)0UL);
+	goto L_abort_2e894;
+	L_passed_2e888:;
+	*(u32 *)t_binding_2e900 = (u32)((u64)42UL);
+	*(u64 *)t_binding_2e885 = (u64)t_binding_2e900;
+	t__2e904 = (u64)(*(u64 *)t_binding_2e885);
+	t__2e905 = (u64)(u32)(*(i32 *)t__2e904);
+	t__2e903 = (u64)(u32)(((u32)t__2e905 == (u32)((u64)42UL)));
+	if ((u32)t__2e903) goto L_passed_2e902; else goto L_failed_2e901;
+	L_failed_2e901:;
+	t_abortsite_2e893 = ((u64)1UL);
+	goto L_abort_2e894;
+	L_passed_2e902:;
+	*(u32 *)t_object_2e908 = (u32)((u64)3532310079UL);
+	t__2e909 = (u64)((u64)t_object_2e908 + (u64)((u64)4UL));
+	*(u32 *)t__2e909 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e912 = (u64)((u64)0UL);
+	t__2e913 = (u64)((u64)t_object_2e912 + (u64)((u64)8UL));
+	*(u64 *)t__2e913 = (u64)((u64)0UL);
+	t__2e913 = (u64)((u64)t__2e913 + (u64)((u64)8UL));
+	*(u64 *)t__2e913 = (u64)((u64)0UL);
+	BLIT((u64)B4, t_object_2e908, 8);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e911)), 24);
+	BLIT((u64)B6, t_object_2e912, 24);
+	t__2e907 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R7, (u64)B4, (u64)B5, (u64)B6);
+	t_tag_2e914 = (u64)(*(u32 *)t__2e907);
+	t__2e922 = (u64)(u32)(((u32)t_tag_2e914 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e922) goto L_member_2e919; else goto L__2e921;
+	L__2e921:;
+	t__2e924 = (u64)(u32)(((u32)t_tag_2e914 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e924) goto L_member_2e920; else goto L__2e923;
+	L__2e923:;
+	goto L_matches_2e918;
+	L_member_2e919:;
+	goto L_matches_2e918;
+	L_member_2e920:;
+	goto L_matches_2e917;
+	L_matches_2e917:;
+	goto L__2e915;
+	L_matches_2e918:;
+	t_abortsite_2e893 = ((u64)2UL);
+	goto L_abort_2e925;
+	L__2e931:;
+	L__2e916:;
+	t_abortsite_2e893 = ((u64)3UL);
+	goto L_abort_2e932;
+	L__2e915:;
+	goto L__2e883;
+	L__2e938:;
+	L__2e883:;
+	return;
+	L_abort_2e894:;
+	t__2e895 = (u64)((u64)t_abortsite_2e893 * (u64)((u64)16UL));
+	t__2e895 = (u64)((u64)((u64)((char *)&D_abortsites_2e892)) + (u64)t__2e895);
+	t__2e896 = (u64)(*(u64 *)t__2e895);
+	t__2e897 = (u64)((u64)t__2e895 + (u64)((u64)8UL));
+	t__2e898 = (u64)(*(u32 *)t__2e897);
+	t__2e897 = (u64)((u64)t__2e895 + (u64)((u64)12UL));
+	t__2e899 = (u64)(*(u32 *)t__2e897);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e896, (u64)t__2e898, (u64)t__2e899, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e925:;
+	t__2e926 = (u64)((u64)t_abortsite_2e893 * (u64)((u64)16UL));
+	t__2e926 = (u64)((u64)((u64)((char *)&D_abortsites_2e892)) + (u64)t__2e926);
+	t__2e927 = (u64)(*(u64 *)t__2e926);
+	t__2e928 = (u64)((u64)t__2e926 + (u64)((u64)8UL));
+	t__2e929 = (u64)(*(u32 *)t__2e928);
+	t__2e928 = (u64)((u64)t__2e926 + (u64)((u64)12UL));
+	t__2e930 = (u64)(*(u32 *)t__2e928);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e927, (u64)t__2e929, (u64)t__2e930, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e932:;
+	t__2e933 = (u64)((u64)t_abortsite_2e893 * (u64)((u64)16UL));
+	t__2e933 = (u64)((u64)((u64)((char *)&D_abortsites_2e892)) + (u64)t__2e933);
+	t__2e934 = (u64)(*(u64 *)t__2e933);
+	t__2e935 = (u64)((u64)t__2e933 + (u64)((u64)8UL));
+	t__2e936 = (u64)(*(u32 *)t__2e935);
+	t__2e935 = (u64)((u64)t__2e933 + (u64)((u64)12UL));
+	t__2e937 = (u64)(*(u32 *)t__2e935);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e934, (u64)t__2e936, (u64)t__2e937, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_basics(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[4] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[4] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[4] __attribute__((aligned(16)));
+	u64 t__2e947;
+	u64 t__2e948;
+	u64 t__2e949;
+	u64 t__2e953;
+	u64 t__2e954;
+	u64 t__2e955;
+	u64 t__2e956;
+	u64 t__2e957;
+	u64 t__2e959;
+	u64 t__2e962;
+	u64 t__2e963;
+	u64 t__2e964;
+	u64 t__2e965;
+	u64 t__2e968;
+	u64 t__2e969;
+	u64 t__2e971;
+	u64 t__2e974;
+	u64 t__2e975;
+	u64 t__2e976;
+	u64 t__2e978;
+	u64 t__2e981;
+	u64 t__2e982;
+	u64 t__2e983;
+	u64 t__2e986;
+	u64 t__2e989;
+	u64 t__2e992;
+	u64 t_abortsite_2e951;
+	u64 t_binding_2e943;
+	u64 t_binding_2e944;
+	u64 t_binding_2e958;
+	u64 t_binding_2e970;
+	u64 t_binding_2e977;
+	u64 t_binding_2e984;
+	u64 t_binding_2e985;
+	L_start_2e939:;
+	t_binding_2e943 = (u64)A0;
+	t_binding_2e944 = (u64)A1;
+	t_binding_2e958 = (u64)A2;
+	t_binding_2e970 = (u64)A3;
+	t__2e971 = (u64)A4;
+	t_binding_2e977 = (u64)A5;
+	t__2e978 = (u64)A6;
+	t_binding_2e984 = (u64)A7;
+	t_binding_2e985 = (u64)A8;
+	t__2e986 = (u64)A9;
+	L_body_2e940:;
+	*(u32 *)t_binding_2e943 = (u32)((u64)42UL);
+	*(u64 *)t_binding_2e944 = (u64)t_binding_2e943;
+	t__2e948 = (u64)(*(u64 *)t_binding_2e944);
+	t__2e949 = (u64)(u32)(*(i32 *)t__2e948);
+	t__2e947 = (u64)(u32)(((u32)t__2e949 == (u32)((u64)42UL)));
+	if ((u32)t__2e947) goto L_passed_2e946; else goto L_failed_2e945;
+	L_failed_2e945:;
+	t_abortsite_2e951 = ((u64)0UL);
+	goto L_abort_2e952;
+	L_passed_2e946:;
+	t__2e959 = (u64)(*(u64 *)t_binding_2e944);
+	*(u64 *)t_binding_2e958 = (u64)t__2e959;
+	t__2e963 = (u64)(*(u64 *)t_binding_2e958);
+	t__2e964 = (u64)(u32)(*(i32 *)t__2e963);
+	t__2e962 = (u64)(u32)(((u32)t__2e964 == (u32)((u64)42UL)));
+	if ((u32)t__2e962) goto L_passed_2e961; else goto L_failed_2e960;
+	L_failed_2e960:;
+	t_abortsite_2e951 = ((u64)1UL);
+	goto L_abort_2e952;
+	L_passed_2e961:;
+	t__2e965 = (u64)(*(u64 *)t_binding_2e958);
+	*(u32 *)t__2e965 = (u32)((u64)1337UL);
+	t__2e969 = (u64)(u32)(*(i32 *)t_binding_2e943);
+	t__2e968 = (u64)(u32)(((u32)t__2e969 == (u32)((u64)1337UL)));
+	if ((u32)t__2e968) goto L_passed_2e967; else goto L_failed_2e966;
+	L_failed_2e966:;
+	t_abortsite_2e951 = ((u64)2UL);
+	goto L_abort_2e952;
+	L_passed_2e967:;
+	*(u32 *)t__2e971 = (u32)((u64)42UL);
+	*(u64 *)t_binding_2e970 = (u64)t__2e971;
+	t__2e975 = (u64)(*(u64 *)t_binding_2e970);
+	t__2e976 = (u64)(u32)(*(i32 *)t__2e975);
+	t__2e974 = (u64)(u32)(((u32)t__2e976 == (u32)((u64)42UL)));
+	if ((u32)t__2e974) goto L_passed_2e973; else goto L_failed_2e972;
+	L_failed_2e972:;
+	t_abortsite_2e951 = ((u64)3UL);
+	goto L_abort_2e952;
+	L_passed_2e973:;
+	*(u32 *)t__2e978 = (u32)((u64)42UL);
+	*(u64 *)t_binding_2e977 = (u64)t__2e978;
+	t__2e982 = (u64)(*(u64 *)t_binding_2e977);
+	t__2e983 = (u64)(u32)(*(u32 *)t__2e982);
+	t__2e981 = (u64)(u32)(((u32)t__2e983 == (u32)((u64)42UL)));
+	if ((u32)t__2e981) goto L_passed_2e980; else goto L_failed_2e979;
+	L_failed_2e979:;
+	t_abortsite_2e951 = ((u64)4UL);
+	goto L_abort_2e952;
+	L_passed_2e980:;
+	*(u64 *)t_binding_2e984 = (u64)((u64)((char *)&F_basics));
+	*(u32 *)t__2e986 = (u32)((u64)42UL);
+	*(u64 *)t_binding_2e985 = (u64)t__2e986;
+	t__2e989 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e989) goto L_passed_2e988; else goto L_failed_2e987;
+	L_failed_2e987:;
+	t_abortsite_2e951 = ((u64)5UL);
+	goto L_abort_2e952;
+	L_passed_2e988:;
+	t__2e992 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e992) goto L_passed_2e991; else goto L_failed_2e990;
+	L_failed_2e990:;
+	t_abortsite_2e951 = ((u64)6UL);
+	goto L_abort_2e952;
+	L_passed_2e991:;
+	goto L__2e941;
+	L__2e993:;
+	L__2e941:;
+	return;
+	L_abort_2e952:;
+	t__2e953 = (u64)((u64)t_abortsite_2e951 * (u64)((u64)16UL));
+	t__2e953 = (u64)((u64)((u64)((char *)&D_abortsites_2e950)) + (u64)t__2e953);
+	t__2e954 = (u64)(*(u64 *)t__2e953);
+	t__2e955 = (u64)((u64)t__2e953 + (u64)((u64)8UL));
+	t__2e956 = (u64)(*(u32 *)t__2e955);
+	t__2e955 = (u64)((u64)t__2e953 + (u64)((u64)12UL));
+	t__2e957 = (u64)(*(u32 *)t__2e955);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e954, (u64)t__2e956, (u64)t__2e957, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,1571 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2estrcmp[] __asm__("rt.strcmp");
+extern char X_rt_2etoutf8[] __asm__("rt.toutf8");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e19 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[8]; u8 f9; u8 f10[4]; u8 f11; u8 f12[3]; u8 f13; u8 f14[4]; u8 f15; u8 f16[1]; u8 f17; u8 f18; u8 f19; u8 f20[2]; u8 f21; u8 f22; };
+struct __attribute__((packed)) S_strliteral_2e20 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e55 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[8]; u8 f9; u8 f10[4]; u8 f11; u8 f12[1]; u8 f13; u8 f14; u8 f15; u8 f16; u8 f17[5]; u8 f18; u8 f19[4]; u8 f20; u8 f21[1]; u8 f22; u8 f23; u8 f24; u8 f25[2]; u8 f26; u8 f27; };
+struct __attribute__((packed)) S_strliteral_2e56 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e75 { u8 f0[8]; u8 f1; u8 f2; u8 f3[3]; u8 f4; u8 f5[1]; };
+struct __attribute__((packed)) S_strliteral_2e76 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e95 { u8 f0[8]; u8 f1; u8 f2; u8 f3[3]; u8 f4; u8 f5[3]; u8 f6; u8 f7[1]; };
+struct __attribute__((packed)) S_strliteral_2e96 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e115 { u8 f0[8]; u8 f1; u8 f2; u8 f3[4]; u8 f4; u8 f5[1]; };
+struct __attribute__((packed)) S_strliteral_2e116 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e135 { u8 f0[8]; u8 f1; u8 f2; u8 f3[3]; u8 f4; u8 f5[1]; u8 f6; u8 f7; u8 f8[3]; u8 f9; u8 f10[1]; };
+struct __attribute__((packed)) S_strliteral_2e136 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e155 { u8 f0[8]; u8 f1; u8 f2; u8 f3[2]; u8 f4; u8 f5[1]; };
+struct __attribute__((packed)) S_strliteral_2e156 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e175 { u8 f0[8]; u8 f1; u8 f2; u8 f3[3]; u8 f4; u8 f5[1]; };
+struct __attribute__((packed)) S_strliteral_2e176 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e195 { u8 f0[8]; u8 f1; u8 f2; u8 f3[8]; u8 f4; u8 f5[1]; };
+struct __attribute__((packed)) S_strliteral_2e196 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e215 { u8 f0[8]; u8 f1; u8 f2; u8 f3[3]; u8 f4; u8 f5[1]; };
+struct __attribute__((packed)) S_strliteral_2e216 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e235 { u8 f0[8]; u8 f1; u8 f2; u8 f3[5]; u8 f4; u8 f5[1]; };
+struct __attribute__((packed)) S_strliteral_2e236 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e255 { u8 f0[8]; u8 f1; u8 f2; u8 f3[9]; u8 f4; u8 f5[1]; };
+struct __attribute__((packed)) S_strliteral_2e256 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e36 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; };
+struct __attribute__((packed)) S_strdata_2e279 { u8 f0[6]; u8 f1; u8 f2; u8 f3[6]; };
+struct __attribute__((packed)) S_strliteral_2e280 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e281 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e295 { u8 f0; u8 f1; };
+struct __attribute__((packed)) S_strliteral_2e296 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e369 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e370 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e374 { u8 f0; u8 f1[2]; };
+struct __attribute__((packed)) S_strliteral_2e375 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e301 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; };
+struct __attribute__((packed)) S_strdata_2e384 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e385 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e386 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e387 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e399 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e400 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e407 { u8 f0[3]; u8 f1; u8 f2[3]; };
+struct __attribute__((packed)) S_strliteral_2e408 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e409 { u8 f0[3]; u8 f1; u8 f2[3]; };
+struct __attribute__((packed)) S_strliteral_2e410 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e388 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_strdata_2e417 { u8 f0[13]; };
+struct __attribute__((packed)) S_strliteral_2e418 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e448 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e464 { u8 f0; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13; u8 f14; };
+struct __attribute__((packed)) S_strliteral_2e465 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strliteral_2e520 { u64 f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e481 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_strdata_2e536 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e537 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e561 { u8 f0[6]; u8 f1; };
+struct __attribute__((packed)) S_strliteral_2e562 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e569 { u8 f0[2]; u8 f1; u8 f2[4]; };
+struct __attribute__((packed)) S_strliteral_2e570 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e544 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e19 D_strdata_2e19 __asm__("strdata.19") __attribute__((used, section(".rodata.strdata.19"), aligned(8)));
+static struct S_strliteral_2e20 D_strliteral_2e20 __asm__("strliteral.20") __attribute__((used, section(".data.rel.ro.strliteral.20"), aligned(8)));
+static const struct S_strdata_2e55 D_strdata_2e55 __asm__("strdata.55") __attribute__((used, section(".rodata.strdata.55"), aligned(8)));
+static struct S_strliteral_2e56 D_strliteral_2e56 __asm__("strliteral.56") __attribute__((used, section(".data.rel.ro.strliteral.56"), aligned(8)));
+static const struct S_strdata_2e75 D_strdata_2e75 __asm__("strdata.75") __attribute__((used, section(".rodata.strdata.75"), aligned(8)));
+static struct S_strliteral_2e76 D_strliteral_2e76 __asm__("strliteral.76") __attribute__((used, section(".data.rel.ro.strliteral.76"), aligned(8)));
+static const struct S_strdata_2e95 D_strdata_2e95 __asm__("strdata.95") __attribute__((used, section(".rodata.strdata.95"), aligned(8)));
+static struct S_strliteral_2e96 D_strliteral_2e96 __asm__("strliteral.96") __attribute__((used, section(".data.rel.ro.strliteral.96"), aligned(8)));
+static const struct S_strdata_2e115 D_strdata_2e115 __asm__("strdata.115") __attribute__((used, section(".rodata.strdata.115"), aligned(8)));
+static struct S_strliteral_2e116 D_strliteral_2e116 __asm__("strliteral.116") __attribute__((used, section(".data.rel.ro.strliteral.116"), aligned(8)));
+static const struct S_strdata_2e135 D_strdata_2e135 __asm__("strdata.135") __attribute__((used, section(".rodata.strdata.135"), aligned(8)));
+static struct S_strliteral_2e136 D_strliteral_2e136 __asm__("strliteral.136") __attribute__((used, section(".data.rel.ro.strliteral.136"), aligned(8)));
+static const struct S_strdata_2e155 D_strdata_2e155 __asm__("strdata.155") __attribute__((used, section(".rodata.strdata.155"), aligned(8)));
+static struct S_strliteral_2e156 D_strliteral_2e156 __asm__("strliteral.156") __attribute__((used, section(".data.rel.ro.strliteral.156"), aligned(8)));
+static const struct S_strdata_2e175 D_strdata_2e175 __asm__("strdata.175") __attribute__((used, section(".rodata.strdata.175"), aligned(8)));
+static struct S_strliteral_2e176 D_strliteral_2e176 __asm__("strliteral.176") __attribute__((used, section(".data.rel.ro.strliteral.176"), aligned(8)));
+static const struct S_strdata_2e195 D_strdata_2e195 __asm__("strdata.195") __attribute__((used, section(".rodata.strdata.195"), aligned(8)));
+static struct S_strliteral_2e196 D_strliteral_2e196 __asm__("strliteral.196") __attribute__((used, section(".data.rel.ro.strliteral.196"), aligned(8)));
+static const struct S_strdata_2e215 D_strdata_2e215 __asm__("strdata.215") __attribute__((used, section(".rodata.strdata.215"), aligned(8)));
+static struct S_strliteral_2e216 D_strliteral_2e216 __asm__("strliteral.216") __attribute__((used, section(".data.rel.ro.strliteral.216"), aligned(8)));
+static const struct S_strdata_2e235 D_strdata_2e235 __asm__("strdata.235") __attribute__((used, section(".rodata.strdata.235"), aligned(8)));
+static struct S_strliteral_2e236 D_strliteral_2e236 __asm__("strliteral.236") __attribute__((used, section(".data.rel.ro.strliteral.236"), aligned(8)));
+static const struct S_strdata_2e255 D_strdata_2e255 __asm__("strdata.255") __attribute__((used, section(".rodata.strdata.255"), aligned(8)));
+static struct S_strliteral_2e256 D_strliteral_2e256 __asm__("strliteral.256") __attribute__((used, section(".data.rel.ro.strliteral.256"), aligned(8)));
+static struct S_abortsites_2e36 D_abortsites_2e36 __asm__("abortsites.36") __attribute__((used, section(".data.rel.ro.abortsites.36"), aligned(8)));
+static const struct S_strdata_2e279 D_strdata_2e279 __asm__("strdata.279") __attribute__((used, section(".rodata.strdata.279"), aligned(8)));
+static struct S_strliteral_2e280 D_strliteral_2e280 __asm__("strliteral.280") __attribute__((used, section(".data.rel.ro.strliteral.280"), aligned(8)));
+static struct S_abortsites_2e281 D_abortsites_2e281 __asm__("abortsites.281") __attribute__((used, section(".data.rel.ro.abortsites.281"), aligned(8)));
+static const struct S_strdata_2e295 D_strdata_2e295 __asm__("strdata.295") __attribute__((used, section(".rodata.strdata.295"), aligned(8)));
+static struct S_strliteral_2e296 D_strliteral_2e296 __asm__("strliteral.296") __attribute__((used, section(".data.rel.ro.strliteral.296"), aligned(8)));
+static const struct S_strdata_2e369 D_strdata_2e369 __asm__("strdata.369") __attribute__((used, section(".rodata.strdata.369"), aligned(8)));
+static struct S_strliteral_2e370 D_strliteral_2e370 __asm__("strliteral.370") __attribute__((used, section(".data.rel.ro.strliteral.370"), aligned(8)));
+static const struct S_strdata_2e374 D_strdata_2e374 __asm__("strdata.374") __attribute__((used, section(".rodata.strdata.374"), aligned(8)));
+static struct S_strliteral_2e375 D_strliteral_2e375 __asm__("strliteral.375") __attribute__((used, section(".data.rel.ro.strliteral.375"), aligned(8)));
+static struct S_abortsites_2e301 D_abortsites_2e301 __asm__("abortsites.301") __attribute__((used, section(".data.rel.ro.abortsites.301"), aligned(8)));
+static const struct S_strdata_2e384 D_strdata_2e384 __asm__("strdata.384") __attribute__((used, section(".rodata.strdata.384"), aligned(8)));
+static struct S_strliteral_2e385 D_strliteral_2e385 __asm__("strliteral.385") __attribute__((used, section(".data.rel.ro.strliteral.385"), aligned(8)));
+static const struct S_strdata_2e386 D_strdata_2e386 __asm__("strdata.386") __attribute__((used, section(".rodata.strdata.386"), aligned(8)));
+static struct S_strliteral_2e387 D_strliteral_2e387 __asm__("strliteral.387") __attribute__((used, section(".data.rel.ro.strliteral.387"), aligned(8)));
+static const struct S_strdata_2e399 D_strdata_2e399 __asm__("strdata.399") __attribute__((used, section(".rodata.strdata.399"), aligned(8)));
+static struct S_strliteral_2e400 D_strliteral_2e400 __asm__("strliteral.400") __attribute__((used, section(".data.rel.ro.strliteral.400"), aligned(8)));
+static const struct S_strdata_2e407 D_strdata_2e407 __asm__("strdata.407") __attribute__((used, section(".rodata.strdata.407"), aligned(8)));
+static struct S_strliteral_2e408 D_strliteral_2e408 __asm__("strliteral.408") __attribute__((used, section(".data.rel.ro.strliteral.408"), aligned(8)));
+static const struct S_strdata_2e409 D_strdata_2e409 __asm__("strdata.409") __attribute__((used, section(".rodata.strdata.409"), aligned(8)));
+static struct S_strliteral_2e410 D_strliteral_2e410 __asm__("strliteral.410") __attribute__((used, section(".data.rel.ro.strliteral.410"), aligned(8)));
+static struct S_abortsites_2e388 D_abortsites_2e388 __asm__("abortsites.388") __attribute__((used, section(".data.rel.ro.abortsites.388"), aligned(8)));
+static const struct S_strdata_2e417 D_strdata_2e417 __asm__("strdata.417") __attribute__((used, section(".rodata.strdata.417"), aligned(8)));
+static struct S_strliteral_2e418 D_strliteral_2e418 __asm__("strliteral.418") __attribute__((used, section(".data.rel.ro.strliteral.418"), aligned(8)));
+static struct S_abortsites_2e448 D_abortsites_2e448 __asm__("abortsites.448") __attribute__((used, section(".data.rel.ro.abortsites.448"), aligned(8)));
+static const struct S_strdata_2e464 D_strdata_2e464 __asm__("strdata.464") __attribute__((used, section(".rodata.strdata.464"), aligned(8)));
+static struct S_strliteral_2e465 D_strliteral_2e465 __asm__("strliteral.465") __attribute__((used, section(".data.rel.ro.strliteral.465"), aligned(8)));
+static const struct S_strliteral_2e520 D_strliteral_2e520 __asm__("strliteral.520") __attribute__((used, section(".rodata.strliteral.520"), aligned(8)));
+static struct S_abortsites_2e481 D_abortsites_2e481 __asm__("abortsites.481") __attribute__((used, section(".data.rel.ro.abortsites.481"), aligned(8)));
+static const struct S_strdata_2e536 D_strdata_2e536 __asm__("strdata.536") __attribute__((used, section(".rodata.strdata.536"), aligned(8)));
+static struct S_strliteral_2e537 D_strliteral_2e537 __asm__("strliteral.537") __attribute__((used, section(".data.rel.ro.strliteral.537"), aligned(8)));
+static const struct S_strdata_2e561 D_strdata_2e561 __asm__("strdata.561") __attribute__((used, section(".rodata.strdata.561"), aligned(8)));
+static struct S_strliteral_2e562 D_strliteral_2e562 __asm__("strliteral.562") __attribute__((used, section(".data.rel.ro.strliteral.562"), aligned(8)));
+static const struct S_strdata_2e569 D_strdata_2e569 __asm__("strdata.569") __attribute__((used, section(".rodata.strdata.569"), aligned(8)));
+static struct S_strliteral_2e570 D_strliteral_2e570 __asm__("strliteral.570") __attribute__((used, section(".data.rel.ro.strliteral.570"), aligned(8)));
+static struct S_abortsites_2e544 D_abortsites_2e544 __asm__("abortsites.544") __attribute__((used, section(".data.rel.ro.abortsites.544"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_raw(void) __asm__("raw") __attribute__((used, section(".text.raw")));
+static void F_escapes(void) __asm__("escapes") __attribute__((used, section(".text.escapes")));
+static void F_equality(void) __asm__("equality") __attribute__((used, section(".text.equality")));
+static void F_concat(void) __asm__("concat") __attribute__((used, section(".text.concat")));
+static void F_storage(void) __asm__("storage") __attribute__((used, section(".text.storage")));
+static void F_measurements(void) __asm__("measurements") __attribute__((used, section(".text.measurements")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\060\064\055\163\164\162\151\156\147\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 19U, 19U };
+static const struct S_strdata_2e19 D_strdata_2e19 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\040\075\040", 34U, "\141\163\144\146", 34U, "\040\053\040", 34U, "\146\144\163\141", 34U, "\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e20 D_strliteral_2e20 = { (char *)((char *)&D_strdata_2e19) + 0, 53U, 53U };
+static const struct S_strdata_2e55 D_strdata_2e55 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\040\075\040", 34U, "\141\163\144\146", 34U, "\073", 10U, 9U, 9U, 9U, "\170\040\053\075\040", 34U, "\146\144\163\141", 34U, "\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e56 D_strliteral_2e56 = { (char *)((char *)&D_strdata_2e55) + 0, 60U, 60U };
+static const struct S_strdata_2e75 D_strdata_2e75 = { "\154\145\164\040\163\040\075\040", 34U, 92U, "\170\143\063", 34U, "\073" };
+static struct S_strliteral_2e76 D_strliteral_2e76 = { (char *)((char *)&D_strdata_2e75) + 0, 15U, 15U };
+static const struct S_strdata_2e95 D_strdata_2e95 = { "\154\145\164\040\163\040\075\040", 34U, 92U, "\170\143\063", 92U, "\170\060\060", 34U, "\073" };
+static struct S_strliteral_2e96 D_strliteral_2e96 = { (char *)((char *)&D_strdata_2e95) + 0, 19U, 19U };
+static const struct S_strdata_2e115 D_strdata_2e115 = { "\154\145\164\040\163\040\075\040", 34U, 92U, "\170\143\063\060", 34U, "\073" };
+static struct S_strliteral_2e116 D_strliteral_2e116 = { (char *)((char *)&D_strdata_2e115) + 0, 16U, 16U };
+static const struct S_strdata_2e135 D_strdata_2e135 = { "\154\145\164\040\163\040\075\040", 34U, 92U, "\170\143\063", 34U, "\040", 34U, 92U, "\170\143\063", 34U, "\073" };
+static struct S_strliteral_2e136 D_strliteral_2e136 = { (char *)((char *)&D_strdata_2e135) + 0, 22U, 22U };
+static const struct S_strdata_2e155 D_strdata_2e155 = { "\154\145\164\040\163\040\075\040", 34U, 92U, "\170\141", 34U, "\073" };
+static struct S_strliteral_2e156 D_strliteral_2e156 = { (char *)((char *)&D_strdata_2e155) + 0, 14U, 14U };
+static const struct S_strdata_2e175 D_strdata_2e175 = { "\154\145\164\040\163\040\075\040", 34U, 92U, "\165\066\071", 34U, "\073" };
+static struct S_strliteral_2e176 D_strliteral_2e176 = { (char *)((char *)&D_strdata_2e175) + 0, 15U, 15U };
+static const struct S_strdata_2e195 D_strdata_2e195 = { "\154\145\164\040\163\040\075\040", 34U, 92U, "\125\061\062\063\064\065\066\067", 34U, "\073" };
+static struct S_strliteral_2e196 D_strliteral_2e196 = { (char *)((char *)&D_strdata_2e195) + 0, 20U, 20U };
+static const struct S_strdata_2e215 D_strdata_2e215 = { "\154\145\164\040\163\040\075\040", 34U, 92U, "\170\141\150", 34U, "\073" };
+static struct S_strliteral_2e216 D_strliteral_2e216 = { (char *)((char *)&D_strdata_2e215) + 0, 15U, 15U };
+static const struct S_strdata_2e235 D_strdata_2e235 = { "\154\145\164\040\163\040\075\040", 34U, 92U, "\165\141\150\151\152", 34U, "\073" };
+static struct S_strliteral_2e236 D_strliteral_2e236 = { (char *)((char *)&D_strdata_2e235) + 0, 17U, 17U };
+static const struct S_strdata_2e255 D_strdata_2e255 = { "\154\145\164\040\163\040\075\040", 34U, 92U, "\125\141\150\151\152\153\154\155\156", 34U, "\073" };
+static struct S_strliteral_2e256 D_strliteral_2e256 = { (char *)((char *)&D_strdata_2e255) + 0, 21U, 21U };
+static struct S_abortsites_2e36 D_abortsites_2e36 = { (char *)((char *)&D_strliteral_2e1) + 0, 90U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 90U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 96U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 96U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 98U, 51U, (char *)((char *)&D_strliteral_2e1) + 0, 98U, 51U, (char *)((char *)&D_strliteral_2e1) + 0, 99U, 55U, (char *)((char *)&D_strliteral_2e1) + 0, 99U, 55U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 52U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 52U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 58U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 58U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 48U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 48U, (char *)((char *)&D_strliteral_2e1) + 0, 103U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 103U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 51U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 51U, (char *)((char *)&D_strliteral_2e1) + 0, 107U, 55U, (char *)((char *)&D_strliteral_2e1) + 0, 107U, 55U };
+static const struct S_strdata_2e279 D_strdata_2e279 = { "\150\145\154\154\157\040", 92U, 34U, "\040\167\157\162\154\144" };
+static struct S_strliteral_2e280 D_strliteral_2e280 = { (char *)((char *)&D_strdata_2e279) + 0, 14U, 14U };
+static struct S_abortsites_2e281 D_abortsites_2e281 = { (char *)((char *)&D_strliteral_2e1) + 0, 82U, 15U };
+static const struct S_strdata_2e295 D_strdata_2e295 = { 18446744073709551555U, 18446744073709551520U };
+static struct S_strliteral_2e296 D_strliteral_2e296 = { (char *)((char *)&D_strdata_2e295) + 0, 2U, 2U };
+static const struct S_strdata_2e369 D_strdata_2e369 = { "\064\065" };
+static struct S_strliteral_2e370 D_strliteral_2e370 = { (char *)((char *)&D_strdata_2e369) + 0, 2U, 2U };
+static const struct S_strdata_2e374 D_strdata_2e374 = { 0U, "\063\063" };
+static struct S_strliteral_2e375 D_strliteral_2e375 = { (char *)((char *)&D_strdata_2e374) + 0, 3U, 3U };
+static struct S_abortsites_2e301 D_abortsites_2e301 = { (char *)((char *)&D_strliteral_2e1) + 0, 70U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 71U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 72U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 73U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 48U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 77U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 78U, 15U };
+static const struct S_strdata_2e384 D_strdata_2e384 = { "\146\157\157" };
+static struct S_strliteral_2e385 D_strliteral_2e385 = { (char *)((char *)&D_strdata_2e384) + 0, 3U, 3U };
+static const struct S_strdata_2e386 D_strdata_2e386 = { "\142\141\162" };
+static struct S_strliteral_2e387 D_strliteral_2e387 = { (char *)((char *)&D_strdata_2e386) + 0, 3U, 3U };
+static const struct S_strdata_2e399 D_strdata_2e399 = { "\146\157\157\142\141\162" };
+static struct S_strliteral_2e400 D_strliteral_2e400 = { (char *)((char *)&D_strdata_2e399) + 0, 6U, 6U };
+static const struct S_strdata_2e407 D_strdata_2e407 = { "\146\157\157", 0U, "\142\141\162" };
+static struct S_strliteral_2e408 D_strliteral_2e408 = { (char *)((char *)&D_strdata_2e407) + 0, 7U, 7U };
+static const struct S_strdata_2e409 D_strdata_2e409 = { "\146\157\157", 0U, "\146\157\157" };
+static struct S_strliteral_2e410 D_strliteral_2e410 = { (char *)((char *)&D_strdata_2e409) + 0, 7U, 7U };
+static struct S_abortsites_2e388 D_abortsites_2e388 = { (char *)((char *)&D_strliteral_2e1) + 0, 58U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 61U, 15U };
+static const struct S_strdata_2e417 D_strdata_2e417 = { "\110\145\154\154\157\054\040\167\157\162\154\144\041" };
+static struct S_strliteral_2e418 D_strliteral_2e418 = { (char *)((char *)&D_strdata_2e417) + 0, 13U, 13U };
+static struct S_abortsites_2e448 D_abortsites_2e448 = { (char *)((char *)&D_strliteral_2e1) + 0, 53U, 23U };
+static const struct S_strdata_2e464 D_strdata_2e464 = { 18446744073709551587U, 18446744073709551489U, 18446744073709551507U, 18446744073709551587U, 18446744073709551490U, 18446744073709551507U, 18446744073709551587U, 18446744073709551489U, 18446744073709551531U, 18446744073709551587U, 18446744073709551489U, 18446744073709551521U, 18446744073709551587U, 18446744073709551489U, 18446744073709551535U };
+static struct S_strliteral_2e465 D_strliteral_2e465 = { (char *)((char *)&D_strdata_2e464) + 0, 15U, 15U };
+static const struct S_strliteral_2e520 D_strliteral_2e520 = { 0U, 0U, 0U };
+static struct S_abortsites_2e481 D_abortsites_2e481 = { (char *)((char *)&D_strliteral_2e1) + 0, 25U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 33U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 42U, 15U };
+static const struct S_strdata_2e536 D_strdata_2e536 = { "\110\145\154\154\157\041" };
+static struct S_strliteral_2e537 D_strliteral_2e537 = { (char *)((char *)&D_strdata_2e536) + 0, 6U, 6U };
+static const struct S_strdata_2e561 D_strdata_2e561 = { "\110\145\154\154\157\041", 0U };
+static struct S_strliteral_2e562 D_strliteral_2e562 = { (char *)((char *)&D_strdata_2e561) + 0, 7U, 7U };
+static const struct S_strdata_2e569 D_strdata_2e569 = { "\110\145", 0U, "\154\154\157\041" };
+static struct S_strliteral_2e570 D_strliteral_2e570 = { (char *)((char *)&D_strdata_2e569) + 0, 7U, 7U };
+static struct S_abortsites_2e544 D_abortsites_2e544 = { (char *)((char *)&D_strliteral_2e1) + 0, 5U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 6U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 7U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 8U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_measurements)))();
+	((void (*)(void))((u64)((char *)&F_storage)))();
+	((void (*)(void))((u64)((char *)&F_concat)))();
+	((void (*)(void))((u64)((char *)&F_equality)))();
+	((void (*)(void))((u64)((char *)&F_escapes)))();
+	((void (*)(void))((u64)((char *)&F_raw)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_reject(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char A20[8] __attribute__((aligned(16)));
+	char A21[24] __attribute__((aligned(16)));
+	char A22[8] __attribute__((aligned(16)));
+	char A23[24] __attribute__((aligned(16)));
+	char B24[8] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char R27[4] __attribute__((aligned(16)));
+	char B28[8] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char R31[4] __attribute__((aligned(16)));
+	char B32[8] __attribute__((aligned(16)));
+	char B33[24] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char R35[4] __attribute__((aligned(16)));
+	char B36[8] __attribute__((aligned(16)));
+	char B37[24] __attribute__((aligned(16)));
+	char B38[24] __attribute__((aligned(16)));
+	char R39[4] __attribute__((aligned(16)));
+	char B40[8] __attribute__((aligned(16)));
+	char B41[24] __attribute__((aligned(16)));
+	char B42[24] __attribute__((aligned(16)));
+	char R43[4] __attribute__((aligned(16)));
+	char B44[8] __attribute__((aligned(16)));
+	char B45[24] __attribute__((aligned(16)));
+	char B46[24] __attribute__((aligned(16)));
+	char R47[4] __attribute__((aligned(16)));
+	char B48[8] __attribute__((aligned(16)));
+	char B49[24] __attribute__((aligned(16)));
+	char B50[24] __attribute__((aligned(16)));
+	char R51[4] __attribute__((aligned(16)));
+	char B52[8] __attribute__((aligned(16)));
+	char B53[24] __attribute__((aligned(16)));
+	char B54[24] __attribute__((aligned(16)));
+	char R55[4] __attribute__((aligned(16)));
+	char B56[8] __attribute__((aligned(16)));
+	char B57[24] __attribute__((aligned(16)));
+	char B58[24] __attribute__((aligned(16)));
+	char R59[4] __attribute__((aligned(16)));
+	char B60[8] __attribute__((aligned(16)));
+	char B61[24] __attribute__((aligned(16)));
+	char B62[24] __attribute__((aligned(16)));
+	char R63[4] __attribute__((aligned(16)));
+	char B64[8] __attribute__((aligned(16)));
+	char B65[24] __attribute__((aligned(16)));
+	char B66[24] __attribute__((aligned(16)));
+	char R67[4] __attribute__((aligned(16)));
+	char B68[8] __attribute__((aligned(16)));
+	char B69[24] __attribute__((aligned(16)));
+	char B70[24] __attribute__((aligned(16)));
+	char R71[4] __attribute__((aligned(16)));
+	u64 t__2e107;
+	u64 t__2e109;
+	u64 t__2e112;
+	u64 t__2e114;
+	u64 t__2e118;
+	u64 t__2e12;
+	u64 t__2e127;
+	u64 t__2e129;
+	u64 t__2e132;
+	u64 t__2e134;
+	u64 t__2e138;
+	u64 t__2e147;
+	u64 t__2e149;
+	u64 t__2e152;
+	u64 t__2e154;
+	u64 t__2e158;
+	u64 t__2e167;
+	u64 t__2e169;
+	u64 t__2e172;
+	u64 t__2e174;
+	u64 t__2e178;
+	u64 t__2e18;
+	u64 t__2e187;
+	u64 t__2e189;
+	u64 t__2e192;
+	u64 t__2e194;
+	u64 t__2e198;
+	u64 t__2e207;
+	u64 t__2e209;
+	u64 t__2e212;
+	u64 t__2e214;
+	u64 t__2e218;
+	u64 t__2e227;
+	u64 t__2e229;
+	u64 t__2e232;
+	u64 t__2e234;
+	u64 t__2e238;
+	u64 t__2e24;
+	u64 t__2e247;
+	u64 t__2e249;
+	u64 t__2e252;
+	u64 t__2e254;
+	u64 t__2e258;
+	u64 t__2e267;
+	u64 t__2e269;
+	u64 t__2e33;
+	u64 t__2e35;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e46;
+	u64 t__2e47;
+	u64 t__2e48;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e52;
+	u64 t__2e54;
+	u64 t__2e58;
+	u64 t__2e67;
+	u64 t__2e69;
+	u64 t__2e72;
+	u64 t__2e74;
+	u64 t__2e78;
+	u64 t__2e87;
+	u64 t__2e89;
+	u64 t__2e92;
+	u64 t__2e94;
+	u64 t__2e98;
+	u64 t_abortsite_2e37;
+	u64 t_object_2e113;
+	u64 t_object_2e117;
+	u64 t_object_2e133;
+	u64 t_object_2e137;
+	u64 t_object_2e14;
+	u64 t_object_2e153;
+	u64 t_object_2e157;
+	u64 t_object_2e173;
+	u64 t_object_2e177;
+	u64 t_object_2e193;
+	u64 t_object_2e197;
+	u64 t_object_2e213;
+	u64 t_object_2e217;
+	u64 t_object_2e22;
+	u64 t_object_2e233;
+	u64 t_object_2e237;
+	u64 t_object_2e253;
+	u64 t_object_2e257;
+	u64 t_object_2e53;
+	u64 t_object_2e57;
+	u64 t_object_2e73;
+	u64 t_object_2e77;
+	u64 t_object_2e93;
+	u64 t_object_2e97;
+	u64 t_tag_2e119;
+	u64 t_tag_2e139;
+	u64 t_tag_2e159;
+	u64 t_tag_2e179;
+	u64 t_tag_2e199;
+	u64 t_tag_2e219;
+	u64 t_tag_2e239;
+	u64 t_tag_2e25;
+	u64 t_tag_2e259;
+	u64 t_tag_2e59;
+	u64 t_tag_2e79;
+	u64 t_tag_2e99;
+	L_start_2e7:;
+	t_object_2e14 = (u64)A0;
+	t_object_2e22 = (u64)A1;
+	t_object_2e53 = (u64)A2;
+	t_object_2e57 = (u64)A3;
+	t_object_2e73 = (u64)A4;
+	t_object_2e77 = (u64)A5;
+	t_object_2e93 = (u64)A6;
+	t_object_2e97 = (u64)A7;
+	t_object_2e113 = (u64)A8;
+	t_object_2e117 = (u64)A9;
+	t_object_2e133 = (u64)A10;
+	t_object_2e137 = (u64)A11;
+	t_object_2e153 = (u64)A12;
+	t_object_2e157 = (u64)A13;
+	t_object_2e173 = (u64)A14;
+	t_object_2e177 = (u64)A15;
+	t_object_2e193 = (u64)A16;
+	t_object_2e197 = (u64)A17;
+	t_object_2e213 = (u64)A18;
+	t_object_2e217 = (u64)A19;
+	t_object_2e233 = (u64)A20;
+	t_object_2e237 = (u64)A21;
+	t_object_2e253 = (u64)A22;
+	t_object_2e257 = (u64)A23;
+	L_body_2e8:;
+	*(u32 *)t_object_2e14 = (u32)((u64)3532310079UL);
+	t__2e18 = (u64)((u64)t_object_2e14 + (u64)((u64)4UL));
+	*(u32 *)t__2e18 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e22 = (u64)((u64)0UL);
+	t__2e24 = (u64)((u64)t_object_2e22 + (u64)((u64)8UL));
+	*(u64 *)t__2e24 = (u64)((u64)0UL);
+	t__2e24 = (u64)((u64)t__2e24 + (u64)((u64)8UL));
+	*(u64 *)t__2e24 = (u64)((u64)0UL);
+	BLIT((u64)B24, t_object_2e14, 8);
+	BLIT((u64)B25, ((u64)((char *)&D_strliteral_2e20)), 24);
+	BLIT((u64)B26, t_object_2e22, 24);
+	t__2e12 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R27, (u64)B24, (u64)B25, (u64)B26);
+	t_tag_2e25 = (u64)(*(u32 *)t__2e12);
+	t__2e33 = (u64)(u32)(((u32)t_tag_2e25 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e33) goto L_member_2e30; else goto L__2e32;
+	L__2e32:;
+	t__2e35 = (u64)(u32)(((u32)t_tag_2e25 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e35) goto L_member_2e31; else goto L__2e34;
+	L__2e34:;
+	goto L_matches_2e29;
+	L_member_2e30:;
+	goto L_matches_2e29;
+	L_member_2e31:;
+	goto L_matches_2e28;
+	L_matches_2e28:;
+	goto L__2e26;
+	L_matches_2e29:;
+	t_abortsite_2e37 = ((u64)0UL);
+	goto L_abort_2e38;
+	L__2e44:;
+	L__2e27:;
+	t_abortsite_2e37 = ((u64)1UL);
+	goto L_abort_2e45;
+	L__2e26:;
+	*(u32 *)t_object_2e53 = (u32)((u64)3532310079UL);
+	t__2e54 = (u64)((u64)t_object_2e53 + (u64)((u64)4UL));
+	*(u32 *)t__2e54 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e57 = (u64)((u64)0UL);
+	t__2e58 = (u64)((u64)t_object_2e57 + (u64)((u64)8UL));
+	*(u64 *)t__2e58 = (u64)((u64)0UL);
+	t__2e58 = (u64)((u64)t__2e58 + (u64)((u64)8UL));
+	*(u64 *)t__2e58 = (u64)((u64)0UL);
+	BLIT((u64)B28, t_object_2e53, 8);
+	BLIT((u64)B29, ((u64)((char *)&D_strliteral_2e56)), 24);
+	BLIT((u64)B30, t_object_2e57, 24);
+	t__2e52 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R31, (u64)B28, (u64)B29, (u64)B30);
+	t_tag_2e59 = (u64)(*(u32 *)t__2e52);
+	t__2e67 = (u64)(u32)(((u32)t_tag_2e59 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e67) goto L_member_2e64; else goto L__2e66;
+	L__2e66:;
+	t__2e69 = (u64)(u32)(((u32)t_tag_2e59 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e69) goto L_member_2e65; else goto L__2e68;
+	L__2e68:;
+	goto L_matches_2e63;
+	L_member_2e64:;
+	goto L_matches_2e63;
+	L_member_2e65:;
+	goto L_matches_2e62;
+	L_matches_2e62:;
+	goto L__2e60;
+	L_matches_2e63:;
+	t_abortsite_2e37 = ((u64)2UL);
+	goto L_abort_2e38;
+	L__2e70:;
+	L__2e61:;
+	t_abortsite_2e37 = ((u64)3UL);
+	goto L_abort_2e45;
+	L__2e60:;
+	*(u32 *)t_object_2e73 = (u32)((u64)3532310079UL);
+	t__2e74 = (u64)((u64)t_object_2e73 + (u64)((u64)4UL));
+	*(u32 *)t__2e74 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e77 = (u64)((u64)0UL);
+	t__2e78 = (u64)((u64)t_object_2e77 + (u64)((u64)8UL));
+	*(u64 *)t__2e78 = (u64)((u64)0UL);
+	t__2e78 = (u64)((u64)t__2e78 + (u64)((u64)8UL));
+	*(u64 *)t__2e78 = (u64)((u64)0UL);
+	BLIT((u64)B32, t_object_2e73, 8);
+	BLIT((u64)B33, ((u64)((char *)&D_strliteral_2e76)), 24);
+	BLIT((u64)B34, t_object_2e77, 24);
+	t__2e72 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R35, (u64)B32, (u64)B33, (u64)B34);
+	t_tag_2e79 = (u64)(*(u32 *)t__2e72);
+	t__2e87 = (u64)(u32)(((u32)t_tag_2e79 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e87) goto L_member_2e84; else goto L__2e86;
+	L__2e86:;
+	t__2e89 = (u64)(u32)(((u32)t_tag_2e79 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e89) goto L_member_2e85; else goto L__2e88;
+	L__2e88:;
+	goto L_matches_2e83;
+	L_member_2e84:;
+	goto L_matches_2e83;
+	L_member_2e85:;
+	goto L_matches_2e82;
+	L_matches_2e82:;
+	goto L__2e80;
+	L_matches_2e83:;
+	t_abortsite_2e37 = ((u64)4UL);
+	goto L_abort_2e38;
+	L__2e90:;
+	L__2e81:;
+	t_abortsite_2e37 = ((u64)5UL);
+	goto L_abort_2e45;
+	L__2e80:;
+	*(u32 *)t_object_2e93 = (u32)((u64)3532310079UL);
+	t__2e94 = (u64)((u64)t_object_2e93 + (u64)((u64)4UL));
+	*(u32 *)t__2e94 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e97 = (u64)((u64)0UL);
+	t__2e98 = (u64)((u64)t_object_2e97 + (u64)((u64)8UL));
+	*(u64 *)t__2e98 = (u64)((u64)0UL);
+	t__2e98 = (u64)((u64)t__2e98 + (u64)((u64)8UL));
+	*(u64 *)t__2e98 = (u64)((u64)0UL);
+	BLIT((u64)B36, t_object_2e93, 8);
+	BLIT((u64)B37, ((u64)((char *)&D_strliteral_2e96)), 24);
+	BLIT((u64)B38, t_object_2e97, 24);
+	t__2e92 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R39, (u64)B36, (u64)B37, (u64)B38);
+	t_tag_2e99 = (u64)(*(u32 *)t__2e92);
+	t__2e107 = (u64)(u32)(((u32)t_tag_2e99 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e107) goto L_member_2e104; else goto L__2e106;
+	L__2e106:;
+	t__2e109 = (u64)(u32)(((u32)t_tag_2e99 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e109) goto L_member_2e105; else goto L__2e108;
+	L__2e108:;
+	goto L_matches_2e103;
+	L_member_2e104:;
+	goto L_matches_2e103;
+	L_member_2e105:;
+	goto L_matches_2e102;
+	L_matches_2e102:;
+	goto L__2e100;
+	L_matches_2e103:;
+	t_abortsite_2e37 = ((u64)6UL);
+	goto L_abort_2e38;
+	L__2e110:;
+	L__2e101:;
+	t_abortsite_2e37 = ((u64)7UL);
+	goto L_abort_2e45;
+	L__2e100:;
+	*(u32 *)t_object_2e113 = (u32)((u64)3532310079UL);
+	t__2e114 = (u64)((u64)t_object_2e113 + (u64)((u64)4UL));
+	*(u32 *)t__2e114 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e117 = (u64)((u64)0UL);
+	t__2e118 = (u64)((u64)t_object_2e117 + (u64)((u64)8UL));
+	*(u64 *)t__2e118 = (u64)((u64)0UL);
+	t__2e118 = (u64)((u64)t__2e118 + (u64)((u64)8UL));
+	*(u64 *)t__2e118 = (u64)((u64)0UL);
+	BLIT((u64)B40, t_object_2e113, 8);
+	BLIT((u64)B41, ((u64)((char *)&D_strliteral_2e116)), 24);
+	BLIT((u64)B42, t_object_2e117, 24);
+	t__2e112 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R43, (u64)B40, (u64)B41, (u64)B42);
+	t_tag_2e119 = (u64)(*(u32 *)t__2e112);
+	t__2e127 = (u64)(u32)(((u32)t_tag_2e119 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e127) goto L_member_2e124; else goto L__2e126;
+	L__2e126:;
+	t__2e129 = (u64)(u32)(((u32)t_tag_2e119 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e129) goto L_member_2e125; else goto L__2e128;
+	L__2e128:;
+	goto L_matches_2e123;
+	L_member_2e124:;
+	goto L_matches_2e123;
+	L_member_2e125:;
+	goto L_matches_2e122;
+	L_matches_2e122:;
+	goto L__2e120;
+	L_matches_2e123:;
+	t_abortsite_2e37 = ((u64)8UL);
+	goto L_abort_2e38;
+	L__2e130:;
+	L__2e121:;
+	t_abortsite_2e37 = ((u64)9UL);
+	goto L_abort_2e45;
+	L__2e120:;
+	*(u32 *)t_object_2e133 = (u32)((u64)3532310079UL);
+	t__2e134 = (u64)((u64)t_object_2e133 + (u64)((u64)4UL));
+	*(u32 *)t__2e134 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e137 = (u64)((u64)0UL);
+	t__2e138 = (u64)((u64)t_object_2e137 + (u64)((u64)8UL));
+	*(u64 *)t__2e138 = (u64)((u64)0UL);
+	t__2e138 = (u64)((u64)t__2e138 + (u64)((u64)8UL));
+	*(u64 *)t__2e138 = (u64)((u64)0UL);
+	BLIT((u64)B44, t_object_2e133, 8);
+	BLIT((u64)B45, ((u64)((char *)&D_strliteral_2e136)), 24);
+	BLIT((u64)B46, t_object_2e137, 24);
+	t__2e132 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R47, (u64)B44, (u64)B45, (u64)B46);
+	t_tag_2e139 = (u64)(*(u32 *)t__2e132);
+	t__2e147 = (u64)(u32)(((u32)t_tag_2e139 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e147) goto L_member_2e144; else goto L__2e146;
+	L__2e146:;
+	t__2e149 = (u64)(u32)(((u32)t_tag_2e139 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e149) goto L_member_2e145; else goto L__2e148;
+	L__2e148:;
+	goto L_matches_2e143;
+	L_member_2e144:;
+	goto L_matches_2e143;
+	L_member_2e145:;
+	goto L_matches_2e142;
+	L_matches_2e142:;
+	goto L__2e140;
+	L_matches_2e143:;
+	t_abortsite_2e37 = ((u64)10UL);
+	goto L_abort_2e38;
+	L__2e150:;
+	L__2e141:;
+	t_abortsite_2e37 = ((u64)11UL);
+	goto L_abort_2e45;
+	L__2e140:;
+	*(u32 *)t_object_2e153 = (u32)((u64)3532310079UL);
+	t__2e154 = (u64)((u64)t_object_2e153 + (u64)((u64)4UL));
+	*(u32 *)t__2e154 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e157 = (u64)((u64)0UL);
+	t__2e158 = (u64)((u64)t_object_2e157 + (u64)((u64)8UL));
+	*(u64 *)t__2e158 = (u64)((u64)0UL);
+	t__2e158 = (u64)((u64)t__2e158 + (u64)((u64)8UL));
+	*(u64 *)t__2e158 = (u64)((u64)0UL);
+	BLIT((u64)B48, t_object_2e153, 8);
+	BLIT((u64)B49, ((u64)((char *)&D_strliteral_2e156)), 24);
+	BLIT((u64)B50, t_object_2e157, 24);
+	t__2e152 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R51, (u64)B48, (u64)B49, (u64)B50);
+	t_tag_2e159 = (u64)(*(u32 *)t__2e152);
+	t__2e167 = (u64)(u32)(((u32)t_tag_2e159 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e167) goto L_member_2e164; else goto L__2e166;
+	L__2e166:;
+	t__2e169 = (u64)(u32)(((u32)t_tag_2e159 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e169) goto L_member_2e165; else goto L__2e168;
+	L__2e168:;
+	goto L_matches_2e163;
+	L_member_2e164:;
+	goto L_matches_2e163;
+	L_member_2e165:;
+	goto L_matches_2e162;
+	L_matches_2e162:;
+	goto L__2e160;
+	L_matches_2e163:;
+	t_abortsite_2e37 = ((u64)12UL);
+	goto L_abort_2e38;
+	L__2e170:;
+	L__2e161:;
+	t_abortsite_2e37 = ((u64)13UL);
+	goto L_abort_2e45;
+	L__2e160:;
+	*(u32 *)t_object_2e173 = (u32)((u64)3532310079UL);
+	t__2e174 = (u64)((u64)t_object_2e173 + (u64)((u64)4UL));
+	*(u32 *)t__2e174 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e177 = (u64)((u64)0UL);
+	t__2e178 = (u64)((u64)t_object_2e177 + (u64)((u64)8UL));
+	*(u64 *)t__2e178 = (u64)((u64)0UL);
+	t__2e178 = (u64)((u64)t__2e178 + (u64)((u64)8UL));
+	*(u64 *)t__2e178 = (u64)((u64)0UL);
+	BLIT((u64)B52, t_object_2e173, 8);
+	BLIT((u64)B53, ((u64)((char *)&D_strliteral_2e176)), 24);
+	BLIT((u64)B54, t_object_2e177, 24);
+	t__2e172 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R55, (u64)B52, (u64)B53, (u64)B54);
+	t_tag_2e179 = (u64)(*(u32 *)t__2e172);
+	t__2e187 = (u64)(u32)(((u32)t_tag_2e179 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e187) goto L_member_2e184; else goto L__2e186;
+	L__2e186:;
+	t__2e189 = (u64)(u32)(((u32)t_tag_2e179 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e189) goto L_member_2e185; else goto L__2e188;
+	L__2e188:;
+	goto L_matches_2e183;
+	L_member_2e184:;
+	goto L_matches_2e183;
+	L_member_2e185:;
+	goto L_matches_2e182;
+	L_matches_2e182:;
+	goto L__2e180;
+	L_matches_2e183:;
+	t_abortsite_2e37 = ((u64)14UL);
+	goto L_abort_2e38;
+	L__2e190:;
+	L__2e181:;
+	t_abortsite_2e37 = ((u64)15UL);
+	goto L_abort_2e45;
+	L__2e180:;
+	*(u32 *)t_object_2e193 = (u32)((u64)3532310079UL);
+	t__2e194 = (u64)((u64)t_object_2e193 + (u64)((u64)4UL));
+	*(u32 *)t__2e194 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e197 = (u64)((u64)0UL);
+	t__2e198 = (u64)((u64)t_object_2e197 + (u64)((u64)8UL));
+	*(u64 *)t__2e198 = (u64)((u64)0UL);
+	t__2e198 = (u64)((u64)t__2e198 + (u64)((u64)8UL));
+	*(u64 *)t__2e198 = (u64)((u64)0UL);
+	BLIT((u64)B56, t_object_2e193, 8);
+	BLIT((u64)B57, ((u64)((char *)&D_strliteral_2e196)), 24);
+	BLIT((u64)B58, t_object_2e197, 24);
+	t__2e192 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R59, (u64)B56, (u64)B57, (u64)B58);
+	t_tag_2e199 = (u64)(*(u32 *)t__2e192);
+	t__2e207 = (u64)(u32)(((u32)t_tag_2e199 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e207) goto L_member_2e204; else goto L__2e206;
+	L__2e206:;
+	t__2e209 = (u64)(u32)(((u32)t_tag_2e199 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e209) goto L_member_2e205; else goto L__2e208;
+	L__2e208:;
+	goto L_matches_2e203;
+	L_member_2e204:;
+	goto L_matches_2e203;
+	L_member_2e205:;
+	goto L_matches_2e202;
+	L_matches_2e202:;
+	goto L__2e200;
+	L_matches_2e203:;
+	t_abortsite_2e37 = ((u64)16UL);
+	goto L_abort_2e38;
+	L__2e210:;
+	L__2e201:;
+	t_abortsite_2e37 = ((u64)17UL);
+	goto L_abort_2e45;
+	L__2e200:;
+	*(u32 *)t_object_2e213 = (u32)((u64)3532310079UL);
+	t__2e214 = (u64)((u64)t_object_2e213 + (u64)((u64)4UL));
+	*(u32 *)t__2e214 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e217 = (u64)((u64)0UL);
+	t__2e218 = (u64)((u64)t_object_2e217 + (u64)((u64)8UL));
+	*(u64 *)t__2e218 = (u64)((u64)0UL);
+	t__2e218 = (u64)((u64)t__2e218 + (u64)((u64)8UL));
+	*(u64 *)t__2e218 = (u64)((u64)0UL);
+	BLIT((u64)B60, t_object_2e213, 8);
+	BLIT((u64)B61, ((u64)((char *)&D_strliteral_2e216)), 24);
+	BLIT((u64)B62, t_object_2e217, 24);
+	t__2e212 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R63, (u64)B60, (u64)B61, (u64)B62);
+	t_tag_2e219 = (u64)(*(u32 *)t__2e212);
+	t__2e227 = (u64)(u32)(((u32)t_tag_2e219 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e227) goto L_member_2e224; else goto L__2e226;
+	L__2e226:;
+	t__2e229 = (u64)(u32)(((u32)t_tag_2e219 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e229) goto L_member_2e225; else goto L__2e228;
+	L__2e228:;
+	goto L_matches_2e223;
+	L_member_2e224:;
+	goto L_matches_2e223;
+	L_member_2e225:;
+	goto L_matches_2e222;
+	L_matches_2e222:;
+	goto L__2e220;
+	L_matches_2e223:;
+	t_abortsite_2e37 = ((u64)18UL);
+	goto L_abort_2e38;
+	L__2e230:;
+	L__2e221:;
+	t_abortsite_2e37 = ((u64)19UL);
+	goto L_abort_2e45;
+	L__2e220:;
+	*(u32 *)t_object_2e233 = (u32)((u64)3532310079UL);
+	t__2e234 = (u64)((u64)t_object_2e233 + (u64)((u64)4UL));
+	*(u32 *)t__2e234 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e237 = (u64)((u64)0UL);
+	t__2e238 = (u64)((u64)t_object_2e237 + (u64)((u64)8UL));
+	*(u64 *)t__2e238 = (u64)((u64)0UL);
+	t__2e238 = (u64)((u64)t__2e238 + (u64)((u64)8UL));
+	*(u64 *)t__2e238 = (u64)((u64)0UL);
+	BLIT((u64)B64, t_object_2e233, 8);
+	BLIT((u64)B65, ((u64)((char *)&D_strliteral_2e236)), 24);
+	BLIT((u64)B66, t_object_2e237, 24);
+	t__2e232 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R67, (u64)B64, (u64)B65, (u64)B66);
+	t_tag_2e239 = (u64)(*(u32 *)t__2e232);
+	t__2e247 = (u64)(u32)(((u32)t_tag_2e239 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e247) goto L_member_2e244; else goto L__2e246;
+	L__2e246:;
+	t__2e249 = (u64)(u32)(((u32)t_tag_2e239 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e249) goto L_member_2e245; else goto L__2e248;
+	L__2e248:;
+	goto L_matches_2e243;
+	L_member_2e244:;
+	goto L_matches_2e243;
+	L_member_2e245:;
+	goto L_matches_2e242;
+	L_matches_2e242:;
+	goto L__2e240;
+	L_matches_2e243:;
+	t_abortsite_2e37 = ((u64)20UL);
+	goto L_abort_2e38;
+	L__2e250:;
+	L__2e241:;
+	t_abortsite_2e37 = ((u64)21UL);
+	goto L_abort_2e45;
+	L__2e240:;
+	*(u32 *)t_object_2e253 = (u32)((u64)3532310079UL);
+	t__2e254 = (u64)((u64)t_object_2e253 + (u64)((u64)4UL));
+	*(u32 *)t__2e254 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e257 = (u64)((u64)0UL);
+	t__2e258 = (u64)((u64)t_object_2e257 + (u64)((u64)8UL));
+	*(u64 *)t__2e258 = (u64)((u64)0UL);
+	t__2e258 = (u64)((u64)t__2e258 + (u64)((u64)8UL));
+	*(u64 *)t__2e258 = (u64)((u64)0UL);
+	BLIT((u64)B68, t_object_2e253, 8);
+	BLIT((u64)B69, ((u64)((char *)&D_strliteral_2e256)), 24);
+	BLIT((u64)B70, t_object_2e257, 24);
+	t__2e252 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R71, (u64)B68, (u64)B69, (u64)B70);
+	t_tag_2e259 = (u64)(*(u32 *)t__2e252);
+	t__2e267 = (u64)(u32)(((u32)t_tag_2e259 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e267) goto L_member_2e264; else goto L__2e266;
+	L__2e266:;
+	t__2e269 = (u64)(u32)(((u32)t_tag_2e259 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e269) goto L_member_2e265; else goto L__2e268;
+	L__2e268:;
+	goto L_matches_2e263;
+	L_member_2e264:;
+	goto L_matches_2e263;
+	L_member_2e265:;
+	goto L_matches_2e262;
+	L_matches_2e262:;
+	goto L__2e260;
+	L_matches_2e263:;
+	t_abortsite_2e37 = ((u64)22UL);
+	goto L_abort_2e38;
+	L__2e270:;
+	L__2e261:;
+	t_abortsite_2e37 = ((u64)23UL);
+	goto L_abort_2e45;
+	L__2e260:;
+	goto L__2e9;
+	L__2e271:;
+	L__2e9:;
+	return;
+	L_abort_2e38:;
+	t__2e39 = (u64)((u64)t_abortsite_2e37 * (u64)((u64)16UL));
+	t__2e39 = (u64)((u64)((u64)((char *)&D_abortsites_2e36)) + (u64)t__2e39);
+	t__2e40 = (u64)(*(u64 *)t__2e39);
+	t__2e41 = (u64)((u64)t__2e39 + (u64)((u64)8UL));
+	t__2e42 = (u64)(*(u32 *)t__2e41);
+	t__2e41 = (u64)((u64)t__2e39 + (u64)((u64)12UL));
+	t__2e43 = (u64)(*(u32 *)t__2e41);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e40, (u64)t__2e42, (u64)t__2e43, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e45:;
+	t__2e46 = (u64)((u64)t_abortsite_2e37 * (u64)((u64)16UL));
+	t__2e46 = (u64)((u64)((u64)((char *)&D_abortsites_2e36)) + (u64)t__2e46);
+	t__2e47 = (u64)(*(u64 *)t__2e46);
+	t__2e48 = (u64)((u64)t__2e46 + (u64)((u64)8UL));
+	t__2e49 = (u64)(*(u32 *)t__2e48);
+	t__2e48 = (u64)((u64)t__2e46 + (u64)((u64)12UL));
+	t__2e50 = (u64)(*(u32 *)t__2e48);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e47, (u64)t__2e49, (u64)t__2e50, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_raw(void) {
+	char B0[24] __attribute__((aligned(16)));
+	char B1[24] __attribute__((aligned(16)));
+	u64 t__2e278;
+	u64 t__2e284;
+	u64 t__2e285;
+	u64 t__2e286;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t_abortsite_2e282;
+	L_start_2e272:;
+	L_body_2e273:;
+	BLIT((u64)B0, ((u64)((char *)&D_strliteral_2e280)), 24);
+	BLIT((u64)B1, ((u64)((char *)&D_strliteral_2e280)), 24);
+	t__2e278 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B0, (u64)B1));
+	if ((u32)t__2e278) goto L_passed_2e277; else goto L_failed_2e276;
+	L_failed_2e276:;
+	t_abortsite_2e282 = ((u64)0UL);
+	goto L_abort_2e283;
+	L_passed_2e277:;
+	goto L__2e274;
+	L__2e289:;
+	L__2e274:;
+	return;
+	L_abort_2e283:;
+	t__2e284 = (u64)((u64)t_abortsite_2e282 * (u64)((u64)16UL));
+	t__2e284 = (u64)((u64)((u64)((char *)&D_abortsites_2e281)) + (u64)t__2e284);
+	t__2e285 = (u64)(*(u64 *)t__2e284);
+	t__2e286 = (u64)((u64)t__2e284 + (u64)((u64)8UL));
+	t__2e287 = (u64)(*(u32 *)t__2e286);
+	t__2e286 = (u64)((u64)t__2e284 + (u64)((u64)12UL));
+	t__2e288 = (u64)(*(u32 *)t__2e286);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e285, (u64)t__2e287, (u64)t__2e288, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_escapes(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char B2[24] __attribute__((aligned(16)));
+	char B3[24] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	u64 t__2e300;
+	u64 t__2e304;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e311;
+	u64 t__2e314;
+	u64 t__2e317;
+	u64 t__2e319;
+	u64 t__2e324;
+	u64 t__2e327;
+	u64 t__2e330;
+	u64 t__2e331;
+	u64 t__2e332;
+	u64 t__2e333;
+	u64 t__2e334;
+	u64 t__2e335;
+	u64 t__2e336;
+	u64 t__2e337;
+	u64 t__2e338;
+	u64 t__2e339;
+	u64 t__2e340;
+	u64 t__2e341;
+	u64 t__2e345;
+	u64 t__2e346;
+	u64 t__2e347;
+	u64 t__2e348;
+	u64 t__2e349;
+	u64 t__2e350;
+	u64 t__2e351;
+	u64 t__2e352;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e355;
+	u64 t__2e356;
+	u64 t__2e357;
+	u64 t__2e358;
+	u64 t__2e359;
+	u64 t__2e360;
+	u64 t__2e363;
+	u64 t__2e364;
+	u64 t__2e365;
+	u64 t__2e368;
+	u64 t__2e373;
+	u64 t_abortsite_2e302;
+	u64 t_binding_2e294;
+	u64 t_binding_2e318;
+	L_start_2e290:;
+	t_binding_2e294 = (u64)A0;
+	t_binding_2e318 = (u64)A1;
+	L_body_2e291:;
+	BLIT(t_binding_2e294, ((u64)((char *)&D_strliteral_2e296)), ((u64)24UL));
+	BLIT((u64)B2, t_binding_2e294, 24);
+	BLIT((u64)B3, ((u64)((char *)&D_strliteral_2e296)), 24);
+	t__2e300 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B2, (u64)B3));
+	if ((u32)t__2e300) goto L_passed_2e299; else goto L_failed_2e298;
+	L_failed_2e298:;
+	t_abortsite_2e302 = ((u64)0UL);
+	goto L_abort_2e303;
+	L_passed_2e299:;
+	BLIT((u64)B4, t_binding_2e294, 24);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e296)), 24);
+	t__2e311 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B4, (u64)B5));
+	if ((u32)t__2e311) goto L_passed_2e310; else goto L_failed_2e309;
+	L_failed_2e309:;
+	t_abortsite_2e302 = ((u64)1UL);
+	goto L_abort_2e303;
+	L_passed_2e310:;
+	BLIT((u64)B6, t_binding_2e294, 24);
+	BLIT((u64)B7, ((u64)((char *)&D_strliteral_2e296)), 24);
+	t__2e314 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B6, (u64)B7));
+	if ((u32)t__2e314) goto L_passed_2e313; else goto L_failed_2e312;
+	L_failed_2e312:;
+	t_abortsite_2e302 = ((u64)2UL);
+	goto L_abort_2e303;
+	L_passed_2e313:;
+	BLIT((u64)B8, t_binding_2e294, 24);
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e296)), 24);
+	t__2e317 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B8, (u64)B9));
+	if ((u32)t__2e317) goto L_passed_2e316; else goto L_failed_2e315;
+	L_failed_2e315:;
+	t_abortsite_2e302 = ((u64)3UL);
+	goto L_abort_2e303;
+	L_passed_2e316:;
+	BLIT((u64)B10, t_binding_2e294, 24);
+	t__2e319 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R11, (u64)B10);
+	BLIT(t_binding_2e318, t__2e319, ((u64)24UL));
+	t__2e331 = (u64)((u64)t_binding_2e318 + (u64)((u64)8UL));
+	t__2e332 = (u64)((u64)t_binding_2e318 + (u64)((u64)16UL));
+	t__2e333 = (u64)(*(u64 *)t__2e331);
+	t__2e330 = (u64)(u32)(((u64)t__2e333 == (u64)((u64)2UL)));
+	t__2e327 = (u64)(u32)t__2e330;
+	if ((u32)t__2e327) goto L__2e328; else goto L__2e329;
+	L__2e328:;
+	t__2e336 = (u64)((u64)t_binding_2e318 + (u64)((u64)8UL));
+	t__2e337 = (u64)((u64)t_binding_2e318 + (u64)((u64)16UL));
+	t__2e338 = (u64)(*(u64 *)t_binding_2e318);
+	t__2e339 = (u64)(*(u64 *)t__2e336);
+	t__2e340 = (u64)((i64)(i32)((u64)0UL));
+	t__2e335 = (u64)((u64)t__2e340 * (u64)((u64)1UL));
+	t__2e335 = (u64)((u64)t__2e338 + (u64)t__2e335);
+	t__2e341 = (u64)(u32)(((u64)t__2e340 < (u64)t__2e339));
+	if ((u32)t__2e341) goto L__2e343; else goto L__2e342;
+	L__2e342:;
+	t_abortsite_2e302 = ((u64)4UL);
+	goto L_abort_2e344;
+	L__2e343:;
+	t__2e350 = (u64)(u32)(*(u8 *)t__2e335);
+	t__2e351 = (u64)(u32)((u8)t__2e350);
+	t__2e352 = (u64)(u32)((u8)((u64)195UL));
+	t__2e334 = (u64)(u32)(((u32)t__2e351 == (u32)t__2e352));
+	t__2e327 = (u64)(u32)t__2e334;
+	goto L__2e329;
+	L__2e329:;
+	t__2e324 = (u64)(u32)t__2e327;
+	if ((u32)t__2e324) goto L__2e325; else goto L__2e326;
+	L__2e325:;
+	t__2e355 = (u64)((u64)t_binding_2e318 + (u64)((u64)8UL));
+	t__2e356 = (u64)((u64)t_binding_2e318 + (u64)((u64)16UL));
+	t__2e357 = (u64)(*(u64 *)t_binding_2e318);
+	t__2e358 = (u64)(*(u64 *)t__2e355);
+	t__2e359 = (u64)((i64)(i32)((u64)1UL));
+	t__2e354 = (u64)((u64)t__2e359 * (u64)((u64)1UL));
+	t__2e354 = (u64)((u64)t__2e357 + (u64)t__2e354);
+	t__2e360 = (u64)(u32)(((u64)t__2e359 < (u64)t__2e358));
+	if ((u32)t__2e360) goto L__2e362; else goto L__2e361;
+	L__2e361:;
+	t_abortsite_2e302 = ((u64)5UL);
+	goto L_abort_2e344;
+	L__2e362:;
+	t__2e363 = (u64)(u32)(*(u8 *)t__2e354);
+	t__2e364 = (u64)(u32)((u8)t__2e363);
+	t__2e365 = (u64)(u32)((u8)((u64)160UL));
+	t__2e353 = (u64)(u32)(((u32)t__2e364 == (u32)t__2e365));
+	t__2e324 = (u64)(u32)t__2e353;
+	goto L__2e326;
+	L__2e326:;
+	if ((u32)t__2e324) goto L_passed_2e323; else goto L_failed_2e322;
+	L_failed_2e322:;
+	t_abortsite_2e302 = ((u64)6UL);
+	goto L_abort_2e303;
+	L_passed_2e323:;
+	BLIT((u64)B12, ((u64)((char *)&D_strliteral_2e370)), 24);
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e370)), 24);
+	t__2e368 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B12, (u64)B13));
+	if ((u32)t__2e368) goto L_passed_2e367; else goto L_failed_2e366;
+	L_failed_2e366:;
+	t_abortsite_2e302 = ((u64)7UL);
+	goto L_abort_2e303;
+	L_passed_2e367:;
+	BLIT((u64)B14, ((u64)((char *)&D_strliteral_2e375)), 24);
+	BLIT((u64)B15, ((u64)((char *)&D_strliteral_2e375)), 24);
+	t__2e373 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B14, (u64)B15));
+	if ((u32)t__2e373) goto L_passed_2e372; else goto L_failed_2e371;
+	L_failed_2e371:;
+	t_abortsite_2e302 = ((u64)8UL);
+	goto L_abort_2e303;
+	L_passed_2e372:;
+	goto L__2e292;
+	L__2e376:;
+	L__2e292:;
+	return;
+	L_abort_2e303:;
+	t__2e304 = (u64)((u64)t_abortsite_2e302 * (u64)((u64)16UL));
+	t__2e304 = (u64)((u64)((u64)((char *)&D_abortsites_2e301)) + (u64)t__2e304);
+	t__2e305 = (u64)(*(u64 *)t__2e304);
+	t__2e306 = (u64)((u64)t__2e304 + (u64)((u64)8UL));
+	t__2e307 = (u64)(*(u32 *)t__2e306);
+	t__2e306 = (u64)((u64)t__2e304 + (u64)((u64)12UL));
+	t__2e308 = (u64)(*(u32 *)t__2e306);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e305, (u64)t__2e307, (u64)t__2e308, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e344:;
+	t__2e345 = (u64)((u64)t_abortsite_2e302 * (u64)((u64)16UL));
+	t__2e345 = (u64)((u64)((u64)((char *)&D_abortsites_2e301)) + (u64)t__2e345);
+	t__2e346 = (u64)(*(u64 *)t__2e345);
+	t__2e347 = (u64)((u64)t__2e345 + (u64)((u64)8UL));
+	t__2e348 = (u64)(*(u32 *)t__2e347);
+	t__2e347 = (u64)((u64)t__2e345 + (u64)((u64)12UL));
+	t__2e349 = (u64)(*(u32 *)t__2e347);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e346, (u64)t__2e348, (u64)t__2e349, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_equality(void) {
+	char B0[24] __attribute__((aligned(16)));
+	char B1[24] __attribute__((aligned(16)));
+	char B2[24] __attribute__((aligned(16)));
+	char B3[24] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	u64 t__2e383;
+	u64 t__2e391;
+	u64 t__2e392;
+	u64 t__2e393;
+	u64 t__2e394;
+	u64 t__2e395;
+	u64 t__2e398;
+	u64 t__2e403;
+	u64 t__2e406;
+	u64 t_abortsite_2e389;
+	L_start_2e377:;
+	L_body_2e378:;
+	BLIT((u64)B0, ((u64)((char *)&D_strliteral_2e385)), 24);
+	BLIT((u64)B1, ((u64)((char *)&D_strliteral_2e387)), 24);
+	t__2e383 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B0, (u64)B1));
+	t__2e383 = (u64)(u32)((u32)t__2e383 ^ (u32)((u64)1UL));
+	if ((u32)t__2e383) goto L_passed_2e382; else goto L_failed_2e381;
+	L_failed_2e381:;
+	t_abortsite_2e389 = ((u64)0UL);
+	goto L_abort_2e390;
+	L_passed_2e382:;
+	BLIT((u64)B2, ((u64)((char *)&D_strliteral_2e385)), 24);
+	BLIT((u64)B3, ((u64)((char *)&D_strliteral_2e400)), 24);
+	t__2e398 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B2, (u64)B3));
+	t__2e398 = (u64)(u32)((u32)t__2e398 ^ (u32)((u64)1UL));
+	if ((u32)t__2e398) goto L_passed_2e397; else goto L_failed_2e396;
+	L_failed_2e396:;
+	t_abortsite_2e389 = ((u64)1UL);
+	goto L_abort_2e390;
+	L_passed_2e397:;
+	BLIT((u64)B4, ((u64)((char *)&D_strliteral_2e400)), 24);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e400)), 24);
+	t__2e403 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B4, (u64)B5));
+	if ((u32)t__2e403) goto L_passed_2e402; else goto L_failed_2e401;
+	L_failed_2e401:;
+	t_abortsite_2e389 = ((u64)2UL);
+	goto L_abort_2e390;
+	L_passed_2e402:;
+	BLIT((u64)B6, ((u64)((char *)&D_strliteral_2e408)), 24);
+	BLIT((u64)B7, ((u64)((char *)&D_strliteral_2e410)), 24);
+	t__2e406 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B6, (u64)B7));
+	t__2e406 = (u64)(u32)((u32)t__2e406 ^ (u32)((u64)1UL));
+	if ((u32)t__2e406) goto L_passed_2e405; else goto L_failed_2e404;
+	L_failed_2e404:;
+	t_abortsite_2e389 = ((u64)3UL);
+	goto L_abort_2e390;
+	L_passed_2e405:;
+	goto L__2e379;
+	L__2e411:;
+	L__2e379:;
+	return;
+	L_abort_2e390:;
+	t__2e391 = (u64)((u64)t_abortsite_2e389 * (u64)((u64)16UL));
+	t__2e391 = (u64)((u64)((u64)((char *)&D_abortsites_2e388)) + (u64)t__2e391);
+	t__2e392 = (u64)(*(u64 *)t__2e391);
+	t__2e393 = (u64)((u64)t__2e391 + (u64)((u64)8UL));
+	t__2e394 = (u64)(*(u32 *)t__2e393);
+	t__2e393 = (u64)((u64)t__2e391 + (u64)((u64)12UL));
+	t__2e395 = (u64)(*(u32 *)t__2e393);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e392, (u64)t__2e394, (u64)t__2e395, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_concat(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[52] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e420;
+	u64 t__2e430;
+	u64 t__2e431;
+	u64 t__2e436;
+	u64 t__2e437;
+	u64 t__2e438;
+	u64 t__2e440;
+	u64 t__2e441;
+	u64 t__2e442;
+	u64 t__2e443;
+	u64 t__2e444;
+	u64 t__2e445;
+	u64 t__2e446;
+	u64 t__2e447;
+	u64 t__2e451;
+	u64 t__2e452;
+	u64 t__2e453;
+	u64 t__2e454;
+	u64 t__2e455;
+	u64 t__2e457;
+	u64 t_abortsite_2e449;
+	u64 t_binding_2e416;
+	u64 t_binding_2e419;
+	u64 t_binding_2e421;
+	u64 t_binding_2e429;
+	u64 t_item_2e423;
+	L_start_2e412:;
+	t_binding_2e416 = (u64)A0;
+	t_binding_2e419 = (u64)A1;
+	t_binding_2e421 = (u64)A2;
+	t_binding_2e429 = (u64)A3;
+	L_body_2e413:;
+	BLIT(t_binding_2e416, ((u64)((char *)&D_strliteral_2e418)), ((u64)24UL));
+	t__2e420 = (u64)(*(u64 *)t_binding_2e416);
+	*(u64 *)t_binding_2e419 = (u64)t__2e420;
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)72UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)101UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)108UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)108UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)111UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)20UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)44UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)24UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)32UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)28UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)119UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)32UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)111UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)36UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)114UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)40UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)108UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)44UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)100UL);
+	t_item_2e423 = (u64)((u64)t_binding_2e421 + (u64)((u64)48UL));
+	*(u32 *)t_item_2e423 = (u32)((u64)33UL);
+	*(u64 *)t_binding_2e429 = (u64)((u64)0UL);
+	L_loop_2e424:;
+	t__2e431 = (u64)(*(u64 *)t_binding_2e429);
+	t__2e430 = (u64)(u32)(((u64)t__2e431 < (u64)((u64)13UL)));
+	if ((u32)t__2e430) goto L_body_2e425; else goto L__2e427;
+	L_body_2e425:;
+	t__2e437 = (u64)(*(u64 *)t_binding_2e419);
+	t__2e440 = (u64)(*(u64 *)t_binding_2e429);
+	t__2e438 = (u64)((u64)t__2e440 * (u64)((u64)1UL));
+	t__2e438 = (u64)((u64)t__2e437 + (u64)t__2e438);
+	t__2e441 = (u64)(u32)(*(u8 *)t__2e438);
+	t__2e443 = (u64)(*(u64 *)t_binding_2e429);
+	t__2e442 = (u64)((u64)t__2e443 * (u64)((u64)4UL));
+	t__2e442 = (u64)((u64)t_binding_2e421 + (u64)t__2e442);
+	t__2e444 = (u64)(u32)(*(u32 *)t__2e442);
+	t__2e445 = (u64)(u32)t__2e444;
+	t__2e446 = (u64)(u32)((u8)t__2e441);
+	t__2e447 = (u64)(u32)((u8)t__2e445);
+	t__2e436 = (u64)(u32)(((u32)t__2e446 == (u32)t__2e447));
+	if ((u32)t__2e436) goto L_passed_2e435; else goto L_failed_2e434;
+	L_failed_2e434:;
+	t_abortsite_2e449 = ((u64)0UL);
+	goto L_abort_2e450;
+	L_passed_2e435:;
+	goto L__2e432;
+	L__2e456:;
+	L__2e432:;
+	L_after_2e428:;
+	t__2e457 = (u64)(*(u64 *)t_binding_2e429);
+	t__2e457 = (u64)((u64)t__2e457 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e429 = (u64)t__2e457;
+	goto L_loop_2e424;
+	L__2e427:;
+	goto L__2e414;
+	L__2e458:;
+	L__2e414:;
+	return;
+	L_abort_2e450:;
+	t__2e451 = (u64)((u64)t_abortsite_2e449 * (u64)((u64)16UL));
+	t__2e451 = (u64)((u64)((u64)((char *)&D_abortsites_2e448)) + (u64)t__2e451);
+	t__2e452 = (u64)(*(u64 *)t__2e451);
+	t__2e453 = (u64)((u64)t__2e451 + (u64)((u64)8UL));
+	t__2e454 = (u64)(*(u32 *)t__2e453);
+	t__2e453 = (u64)((u64)t__2e451 + (u64)((u64)12UL));
+	t__2e455 = (u64)(*(u32 *)t__2e453);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e452, (u64)t__2e454, (u64)t__2e455, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_storage(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[15] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	u64 t__2e469;
+	u64 t__2e472;
+	u64 t__2e473;
+	u64 t__2e476;
+	u64 t__2e477;
+	u64 t__2e478;
+	u64 t__2e480;
+	u64 t__2e484;
+	u64 t__2e485;
+	u64 t__2e486;
+	u64 t__2e487;
+	u64 t__2e488;
+	u64 t__2e498;
+	u64 t__2e499;
+	u64 t__2e504;
+	u64 t__2e505;
+	u64 t__2e507;
+	u64 t__2e508;
+	u64 t__2e510;
+	u64 t__2e511;
+	u64 t__2e512;
+	u64 t__2e513;
+	u64 t__2e514;
+	u64 t__2e515;
+	u64 t__2e516;
+	u64 t__2e518;
+	u64 t__2e524;
+	u64 t__2e525;
+	u64 t__2e528;
+	u64 t__2e529;
+	u64 t_abortsite_2e482;
+	u64 t_binding_2e463;
+	u64 t_binding_2e466;
+	u64 t_binding_2e489;
+	u64 t_binding_2e497;
+	u64 t_binding_2e519;
+	u64 t_binding_2e521;
+	u64 t_field_2e475;
+	u64 t_field_2e479;
+	u64 t_field_2e506;
+	u64 t_field_2e527;
+	u64 t_item_2e491;
+	L_start_2e459:;
+	t_binding_2e463 = (u64)A0;
+	t_binding_2e466 = (u64)A1;
+	t_binding_2e489 = (u64)A2;
+	t_binding_2e497 = (u64)A3;
+	t_binding_2e519 = (u64)A4;
+	t_binding_2e521 = (u64)A5;
+	L_body_2e460:;
+	BLIT(t_binding_2e463, ((u64)((char *)&D_strliteral_2e465)), ((u64)24UL));
+	*(u64 *)t_binding_2e466 = (u64)t_binding_2e463;
+	t__2e473 = (u64)(*(u64 *)t_binding_2e466);
+	t_field_2e475 = (u64)((u64)t__2e473 + (u64)((u64)8UL));
+	t__2e476 = (u64)(*(u64 *)t_field_2e475);
+	t__2e472 = (u64)(u32)(((u64)t__2e476 == (u64)((u64)15UL)));
+	t__2e469 = (u64)(u32)t__2e472;
+	if ((u32)t__2e469) goto L__2e470; else goto L__2e471;
+	L__2e470:;
+	t__2e478 = (u64)(*(u64 *)t_binding_2e466);
+	t_field_2e479 = (u64)((u64)t__2e478 + (u64)((u64)16UL));
+	t__2e480 = (u64)(*(u64 *)t_field_2e479);
+	t__2e477 = (u64)(u32)(((u64)t__2e480 == (u64)((u64)15UL)));
+	t__2e469 = (u64)(u32)t__2e477;
+	goto L__2e471;
+	L__2e471:;
+	if ((u32)t__2e469) goto L_passed_2e468; else goto L_failed_2e467;
+	L_failed_2e467:;
+	t_abortsite_2e482 = ((u64)0UL);
+	goto L_abort_2e483;
+	L_passed_2e468:;
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)227UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)1UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)129UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)2UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)147UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)3UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)227UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)4UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)130UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)5UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)147UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)6UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)227UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)7UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)129UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)8UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)171UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)9UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)227UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)10UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)129UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)11UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)161UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)12UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)227UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)13UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)129UL);
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)14UL));
+	*(u8 *)t_item_2e491 = (u8)((u64)175UL);
+	*(u64 *)t_binding_2e497 = (u64)((u64)0UL);
+	L_loop_2e492:;
+	t__2e499 = (u64)(*(u64 *)t_binding_2e497);
+	t__2e498 = (u64)(u32)(((u64)t__2e499 < (u64)((u64)15UL)));
+	if ((u32)t__2e498) goto L_body_2e493; else goto L__2e495;
+	L_body_2e493:;
+	t__2e505 = (u64)(*(u64 *)t_binding_2e466);
+	t_field_2e506 = (u64)((u64)t__2e505 + (u64)((u64)0UL));
+	t__2e507 = (u64)(*(u64 *)t_field_2e506);
+	t__2e510 = (u64)(*(u64 *)t_binding_2e497);
+	t__2e508 = (u64)((u64)t__2e510 * (u64)((u64)1UL));
+	t__2e508 = (u64)((u64)t__2e507 + (u64)t__2e508);
+	t__2e511 = (u64)(u32)(*(u8 *)t__2e508);
+	t__2e513 = (u64)(*(u64 *)t_binding_2e497);
+	t__2e512 = (u64)((u64)t__2e513 * (u64)((u64)1UL));
+	t__2e512 = (u64)((u64)t_binding_2e489 + (u64)t__2e512);
+	t__2e514 = (u64)(u32)(*(u8 *)t__2e512);
+	t__2e515 = (u64)(u32)((u8)t__2e511);
+	t__2e516 = (u64)(u32)((u8)t__2e514);
+	t__2e504 = (u64)(u32)(((u32)t__2e515 == (u32)t__2e516));
+	if ((u32)t__2e504) goto L_passed_2e503; else goto L_failed_2e502;
+	L_failed_2e502:;
+	t_abortsite_2e482 = ((u64)1UL);
+	goto L_abort_2e483;
+	L_passed_2e503:;
+	goto L__2e500;
+	L__2e517:;
+	L__2e500:;
+	L_after_2e496:;
+	t__2e518 = (u64)(*(u64 *)t_binding_2e497);
+	t__2e518 = (u64)((u64)t__2e518 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e497 = (u64)t__2e518;
+	goto L_loop_2e492;
+	L__2e495:;
+	BLIT(t_binding_2e519, ((u64)((char *)&D_strliteral_2e520)), ((u64)24UL));
+	*(u64 *)t_binding_2e521 = (u64)t_binding_2e519;
+	t__2e525 = (u64)(*(u64 *)t_binding_2e521);
+	t_field_2e527 = (u64)((u64)t__2e525 + (u64)((u64)0UL));
+	t__2e528 = (u64)(*(u64 *)t_field_2e527);
+	t__2e529 = ((u64)0UL);
+	t__2e524 = (u64)(u32)(((u64)t__2e528 == (u64)t__2e529));
+	if ((u32)t__2e524) goto L_passed_2e523; else goto L_failed_2e522;
+	L_failed_2e522:;
+	t_abortsite_2e482 = ((u64)2UL);
+	goto L_abort_2e483;
+	L_passed_2e523:;
+	goto L__2e461;
+	L__2e530:;
+	L__2e461:;
+	return;
+	L_abort_2e483:;
+	t__2e484 = (u64)((u64)t_abortsite_2e482 * (u64)((u64)16UL));
+	t__2e484 = (u64)((u64)((u64)((char *)&D_abortsites_2e481)) + (u64)t__2e484);
+	t__2e485 = (u64)(*(u64 *)t__2e484);
+	t__2e486 = (u64)((u64)t__2e484 + (u64)((u64)8UL));
+	t__2e487 = (u64)(*(u32 *)t__2e486);
+	t__2e486 = (u64)((u64)t__2e484 + (u64)((u64)12UL));
+	t__2e488 = (u64)(*(u32 *)t__2e486);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e485, (u64)t__2e487, (u64)t__2e488, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_measurements(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e540;
+	u64 t__2e541;
+	u64 t__2e542;
+	u64 t__2e543;
+	u64 t__2e547;
+	u64 t__2e548;
+	u64 t__2e549;
+	u64 t__2e550;
+	u64 t__2e551;
+	u64 t__2e554;
+	u64 t__2e555;
+	u64 t__2e556;
+	u64 t__2e557;
+	u64 t__2e560;
+	u64 t__2e563;
+	u64 t__2e564;
+	u64 t__2e565;
+	u64 t__2e568;
+	u64 t__2e571;
+	u64 t__2e572;
+	u64 t__2e573;
+	u64 t__2e576;
+	u64 t__2e577;
+	u64 t__2e578;
+	u64 t__2e583;
+	u64 t__2e584;
+	u64 t__2e587;
+	u64 t__2e588;
+	u64 t__2e589;
+	u64 t_abortsite_2e545;
+	u64 t_binding_2e535;
+	u64 t_binding_2e579;
+	L_start_2e531:;
+	t_binding_2e535 = (u64)A0;
+	t_binding_2e579 = (u64)A1;
+	L_body_2e532:;
+	BLIT(t_binding_2e535, ((u64)((char *)&D_strliteral_2e537)), ((u64)24UL));
+	t__2e541 = (u64)((u64)t_binding_2e535 + (u64)((u64)8UL));
+	t__2e542 = (u64)((u64)t_binding_2e535 + (u64)((u64)16UL));
+	t__2e543 = (u64)(*(u64 *)t__2e541);
+	t__2e540 = (u64)(u32)(((u64)t__2e543 == (u64)((u64)6UL)));
+	if ((u32)t__2e540) goto L_passed_2e539; else goto L_failed_2e538;
+	L_failed_2e538:;
+	t_abortsite_2e545 = ((u64)0UL);
+	goto L_abort_2e546;
+	L_passed_2e539:;
+	t__2e555 = (u64)((u64)((u64)((char *)&D_strliteral_2e537)) + (u64)((u64)8UL));
+	t__2e556 = (u64)((u64)((u64)((char *)&D_strliteral_2e537)) + (u64)((u64)16UL));
+	t__2e557 = (u64)(*(u64 *)t__2e555);
+	t__2e554 = (u64)(u32)(((u64)t__2e557 == (u64)((u64)6UL)));
+	if ((u32)t__2e554) goto L_passed_2e553; else goto L_failed_2e552;
+	L_failed_2e552:;
+	t_abortsite_2e545 = ((u64)1UL);
+	goto L_abort_2e546;
+	L_passed_2e553:;
+	t__2e563 = (u64)((u64)((u64)((char *)&D_strliteral_2e562)) + (u64)((u64)8UL));
+	t__2e564 = (u64)((u64)((u64)((char *)&D_strliteral_2e562)) + (u64)((u64)16UL));
+	t__2e565 = (u64)(*(u64 *)t__2e563);
+	t__2e560 = (u64)(u32)(((u64)t__2e565 == (u64)((u64)7UL)));
+	if ((u32)t__2e560) goto L_passed_2e559; else goto L_failed_2e558;
+	L_failed_2e558:;
+	t_abortsite_2e545 = ((u64)2UL);
+	goto L_abort_2e546;
+	L_passed_2e559:;
+	t__2e571 = (u64)((u64)((u64)((char *)&D_strliteral_2e570)) + (u64)((u64)8UL));
+	t__2e572 = (u64)((u64)((u64)((char *)&D_strliteral_2e570)) + (u64)((u64)16UL));
+	t__2e573 = (u64)(*(u64 *)t__2e571);
+	t__2e568 = (u64)(u32)(((u64)t__2e573 == (u64)((u64)7UL)));
+	if ((u32)t__2e568) goto L_passed_2e567; else goto L_failed_2e566;
+	L_failed_2e566:;
+	t_abortsite_2e545 = ((u64)3UL);
+	goto L_abort_2e546;
+	L_passed_2e567:;
+	t__2e578 = (u64)((u64)((u64)8UL) << (((u64)1UL) & 63));
+	t__2e577 = (u64)((u64)((u64)8UL) + (u64)t__2e578);
+	t__2e576 = (u64)(u32)(((u64)((u64)24UL) == (u64)t__2e577));
+	if ((u32)t__2e576) goto L_passed_2e575; else goto L_failed_2e574;
+	L_failed_2e574:;
+	t_abortsite_2e545 = ((u64)4UL);
+	goto L_abort_2e546;
+	L_passed_2e575:;
+	t__2e583 = (u64)(u32)(((u64)((u64)8UL) > (u64)((u64)8UL)));
+	t__2e584 = (u64)(u32)((u8)t__2e583);
+	if ((u32)t__2e584) goto L_true_2e580; else goto L_false_2e581;
+	L_true_2e580:;
+	*(u64 *)t_binding_2e579 = (u64)((u64)8UL);
+	goto L__2e582;
+	L_false_2e581:;
+	*(u64 *)t_binding_2e579 = (u64)((u64)8UL);
+	L__2e582:;
+	t__2e589 = (u64)(*(u64 *)t_binding_2e579);
+	t__2e588 = (u64)((u64)((u64)8UL) % (u64)t__2e589);
+	t__2e587 = (u64)(u32)(((u64)t__2e588 == (u64)((u64)0UL)));
+	if ((u32)t__2e587) goto L_passed_2e586; else goto L_failed_2e585;
+	L_failed_2e585:;
+	t_abortsite_2e545 = ((u64)5UL);
+	goto L_abort_2e546;
+	L_passed_2e586:;
+	goto L__2e533;
+	L__2e590:;
+	L__2e533:;
+	return;
+	L_abort_2e546:;
+	t__2e547 = (u64)((u64)t_abortsite_2e545 * (u64)((u64)16UL));
+	t__2e547 = (u64)((u64)((u64)((char *)&D_abortsites_2e544)) + (u64)t__2e547);
+	t__2e548 = (u64)(*(u64 *)t__2e547);
+	t__2e549 = (u64)((u64)t__2e547 + (u64)((u64)8UL));
+	t__2e550 = (u64)(*(u32 *)t__2e549);
+	t__2e549 = (u64)((u64)t__2e547 + (u64)((u64)12UL));
+	t__2e551 = (u64)(*(u32 *)t__2e549);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e548, (u64)t__2e550, (u64)t__2e551, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,1641 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2ememset[] __asm__("rt.memset");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[26]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e10 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e33 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e88 { u8 f0[41]; };
+struct __attribute__((packed)) S_strliteral_2e89 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e137 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e138 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e162 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e163 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e182 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e183 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e202 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e203 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e222 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e223 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e242 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e243 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e262 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e263 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e282 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e283 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e302 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e303 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e322 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e323 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e342 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e343 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e362 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e363 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e382 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e383 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e402 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e403 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e422 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e423 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e442 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e443 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e486 { u8 f0[67]; };
+struct __attribute__((packed)) S_strliteral_2e487 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e506 { u8 f0[74]; };
+struct __attribute__((packed)) S_strliteral_2e507 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e526 { u8 f0[62]; };
+struct __attribute__((packed)) S_strliteral_2e527 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e546 { u8 f0[62]; };
+struct __attribute__((packed)) S_strliteral_2e547 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e566 { u8 f0[76]; };
+struct __attribute__((packed)) S_strliteral_2e567 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e586 { u8 f0[71]; };
+struct __attribute__((packed)) S_strliteral_2e587 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e105 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; char *f81; u32 f82; u32 f83; char *f84; u32 f85; u32 f86; char *f87; u32 f88; u32 f89; char *f90; u32 f91; u32 f92; char *f93; u32 f94; u32 f95; char *f96; u32 f97; u32 f98; char *f99; u32 f100; u32 f101; char *f102; u32 f103; u32 f104; char *f105; u32 f106; u32 f107; char *f108; u32 f109; u32 f110; char *f111; u32 f112; u32 f113; char *f114; u32 f115; u32 f116; char *f117; u32 f118; u32 f119; char *f120; u32 f121; u32 f122; char *f123; u32 f124; u32 f125; char *f126; u32 f127; u32 f128; char *f129; u32 f130; u32 f131; char *f132; u32 f133; u32 f134; char *f135; u32 f136; u32 f137; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e10 D_abortsites_2e10 __asm__("abortsites.10") __attribute__((used, section(".data.rel.ro.abortsites.10"), aligned(8)));
+static struct S_abortsites_2e33 D_abortsites_2e33 __asm__("abortsites.33") __attribute__((used, section(".data.rel.ro.abortsites.33"), aligned(8)));
+static const struct S_strdata_2e88 D_strdata_2e88 __asm__("strdata.88") __attribute__((used, section(".rodata.strdata.88"), aligned(8)));
+static struct S_strliteral_2e89 D_strliteral_2e89 __asm__("strliteral.89") __attribute__((used, section(".data.rel.ro.strliteral.89"), aligned(8)));
+static const struct S_strdata_2e137 D_strdata_2e137 __asm__("strdata.137") __attribute__((used, section(".rodata.strdata.137"), aligned(8)));
+static struct S_strliteral_2e138 D_strliteral_2e138 __asm__("strliteral.138") __attribute__((used, section(".data.rel.ro.strliteral.138"), aligned(8)));
+static const struct S_strdata_2e162 D_strdata_2e162 __asm__("strdata.162") __attribute__((used, section(".rodata.strdata.162"), aligned(8)));
+static struct S_strliteral_2e163 D_strliteral_2e163 __asm__("strliteral.163") __attribute__((used, section(".data.rel.ro.strliteral.163"), aligned(8)));
+static const struct S_strdata_2e182 D_strdata_2e182 __asm__("strdata.182") __attribute__((used, section(".rodata.strdata.182"), aligned(8)));
+static struct S_strliteral_2e183 D_strliteral_2e183 __asm__("strliteral.183") __attribute__((used, section(".data.rel.ro.strliteral.183"), aligned(8)));
+static const struct S_strdata_2e202 D_strdata_2e202 __asm__("strdata.202") __attribute__((used, section(".rodata.strdata.202"), aligned(8)));
+static struct S_strliteral_2e203 D_strliteral_2e203 __asm__("strliteral.203") __attribute__((used, section(".data.rel.ro.strliteral.203"), aligned(8)));
+static const struct S_strdata_2e222 D_strdata_2e222 __asm__("strdata.222") __attribute__((used, section(".rodata.strdata.222"), aligned(8)));
+static struct S_strliteral_2e223 D_strliteral_2e223 __asm__("strliteral.223") __attribute__((used, section(".data.rel.ro.strliteral.223"), aligned(8)));
+static const struct S_strdata_2e242 D_strdata_2e242 __asm__("strdata.242") __attribute__((used, section(".rodata.strdata.242"), aligned(8)));
+static struct S_strliteral_2e243 D_strliteral_2e243 __asm__("strliteral.243") __attribute__((used, section(".data.rel.ro.strliteral.243"), aligned(8)));
+static const struct S_strdata_2e262 D_strdata_2e262 __asm__("strdata.262") __attribute__((used, section(".rodata.strdata.262"), aligned(8)));
+static struct S_strliteral_2e263 D_strliteral_2e263 __asm__("strliteral.263") __attribute__((used, section(".data.rel.ro.strliteral.263"), aligned(8)));
+static const struct S_strdata_2e282 D_strdata_2e282 __asm__("strdata.282") __attribute__((used, section(".rodata.strdata.282"), aligned(8)));
+static struct S_strliteral_2e283 D_strliteral_2e283 __asm__("strliteral.283") __attribute__((used, section(".data.rel.ro.strliteral.283"), aligned(8)));
+static const struct S_strdata_2e302 D_strdata_2e302 __asm__("strdata.302") __attribute__((used, section(".rodata.strdata.302"), aligned(8)));
+static struct S_strliteral_2e303 D_strliteral_2e303 __asm__("strliteral.303") __attribute__((used, section(".data.rel.ro.strliteral.303"), aligned(8)));
+static const struct S_strdata_2e322 D_strdata_2e322 __asm__("strdata.322") __attribute__((used, section(".rodata.strdata.322"), aligned(8)));
+static struct S_strliteral_2e323 D_strliteral_2e323 __asm__("strliteral.323") __attribute__((used, section(".data.rel.ro.strliteral.323"), aligned(8)));
+static const struct S_strdata_2e342 D_strdata_2e342 __asm__("strdata.342") __attribute__((used, section(".rodata.strdata.342"), aligned(8)));
+static struct S_strliteral_2e343 D_strliteral_2e343 __asm__("strliteral.343") __attribute__((used, section(".data.rel.ro.strliteral.343"), aligned(8)));
+static const struct S_strdata_2e362 D_strdata_2e362 __asm__("strdata.362") __attribute__((used, section(".rodata.strdata.362"), aligned(8)));
+static struct S_strliteral_2e363 D_strliteral_2e363 __asm__("strliteral.363") __attribute__((used, section(".data.rel.ro.strliteral.363"), aligned(8)));
+static const struct S_strdata_2e382 D_strdata_2e382 __asm__("strdata.382") __attribute__((used, section(".rodata.strdata.382"), aligned(8)));
+static struct S_strliteral_2e383 D_strliteral_2e383 __asm__("strliteral.383") __attribute__((used, section(".data.rel.ro.strliteral.383"), aligned(8)));
+static const struct S_strdata_2e402 D_strdata_2e402 __asm__("strdata.402") __attribute__((used, section(".rodata.strdata.402"), aligned(8)));
+static struct S_strliteral_2e403 D_strliteral_2e403 __asm__("strliteral.403") __attribute__((used, section(".data.rel.ro.strliteral.403"), aligned(8)));
+static const struct S_strdata_2e422 D_strdata_2e422 __asm__("strdata.422") __attribute__((used, section(".rodata.strdata.422"), aligned(8)));
+static struct S_strliteral_2e423 D_strliteral_2e423 __asm__("strliteral.423") __attribute__((used, section(".data.rel.ro.strliteral.423"), aligned(8)));
+static const struct S_strdata_2e442 D_strdata_2e442 __asm__("strdata.442") __attribute__((used, section(".rodata.strdata.442"), aligned(8)));
+static struct S_strliteral_2e443 D_strliteral_2e443 __asm__("strliteral.443") __attribute__((used, section(".data.rel.ro.strliteral.443"), aligned(8)));
+static const struct S_strdata_2e486 D_strdata_2e486 __asm__("strdata.486") __attribute__((used, section(".rodata.strdata.486"), aligned(8)));
+static struct S_strliteral_2e487 D_strliteral_2e487 __asm__("strliteral.487") __attribute__((used, section(".data.rel.ro.strliteral.487"), aligned(8)));
+static const struct S_strdata_2e506 D_strdata_2e506 __asm__("strdata.506") __attribute__((used, section(".rodata.strdata.506"), aligned(8)));
+static struct S_strliteral_2e507 D_strliteral_2e507 __asm__("strliteral.507") __attribute__((used, section(".data.rel.ro.strliteral.507"), aligned(8)));
+static const struct S_strdata_2e526 D_strdata_2e526 __asm__("strdata.526") __attribute__((used, section(".rodata.strdata.526"), aligned(8)));
+static struct S_strliteral_2e527 D_strliteral_2e527 __asm__("strliteral.527") __attribute__((used, section(".data.rel.ro.strliteral.527"), aligned(8)));
+static const struct S_strdata_2e546 D_strdata_2e546 __asm__("strdata.546") __attribute__((used, section(".rodata.strdata.546"), aligned(8)));
+static struct S_strliteral_2e547 D_strliteral_2e547 __asm__("strliteral.547") __attribute__((used, section(".data.rel.ro.strliteral.547"), aligned(8)));
+static const struct S_strdata_2e566 D_strdata_2e566 __asm__("strdata.566") __attribute__((used, section(".rodata.strdata.566"), aligned(8)));
+static struct S_strliteral_2e567 D_strliteral_2e567 __asm__("strliteral.567") __attribute__((used, section(".data.rel.ro.strliteral.567"), aligned(8)));
+static const struct S_strdata_2e586 D_strdata_2e586 __asm__("strdata.586") __attribute__((used, section(".rodata.strdata.586"), aligned(8)));
+static struct S_strliteral_2e587 D_strliteral_2e587 __asm__("strliteral.587") __attribute__((used, section(".data.rel.ro.strliteral.587"), aligned(8)));
+static struct S_abortsites_2e105 D_abortsites_2e105 __asm__("abortsites.105") __attribute__((used, section(".data.rel.ro.abortsites.105"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_calls(void) __asm__("calls") __attribute__((used, section(".text.calls")));
+static void F_callme(u64 p_in) __asm__("callme") __attribute__((used, section(".text.callme")));
+static u64 F_rvalue(void) __asm__("rvalue") __attribute__((used, section(".text.rvalue")));
+static void F_rules(void) __asm__("rules") __attribute__((used, section(".text.rules")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\060\065\055\151\155\160\154\151\143\151\164\055\143\141\163\164\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 26U, 26U };
+static struct S_abortsites_2e10 D_abortsites_2e10 = { (char *)((char *)&D_strliteral_2e1) + 0, 140U, 15U };
+static struct S_abortsites_2e33 D_abortsites_2e33 = { (char *)((char *)&D_strliteral_2e1) + 0, 131U, 15U };
+static const struct S_strdata_2e88 D_strdata_2e88 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\151\072\040\151\156\164\040\075\040\064\062\151\066\064\073\040\175\073" };
+static struct S_strliteral_2e89 D_strliteral_2e89 = { (char *)((char *)&D_strdata_2e88) + 0, 41U, 41U };
+static const struct S_strdata_2e137 D_strdata_2e137 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\165\072\040\165\151\156\164\040\075\040\064\062\165\066\064\073\040\175\073" };
+static struct S_strliteral_2e138 D_strliteral_2e138 = { (char *)((char *)&D_strdata_2e137) + 0, 42U, 42U };
+static const struct S_strdata_2e162 D_strdata_2e162 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\151\070\072\040\151\070\040\075\040\064\062\151\061\066\073\040\175\073" };
+static struct S_strliteral_2e163 D_strliteral_2e163 = { (char *)((char *)&D_strdata_2e162) + 0, 42U, 42U };
+static const struct S_strdata_2e182 D_strdata_2e182 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\151\070\072\040\151\070\040\075\040\064\062\151\063\062\073\040\175\073" };
+static struct S_strliteral_2e183 D_strliteral_2e183 = { (char *)((char *)&D_strdata_2e182) + 0, 42U, 42U };
+static const struct S_strdata_2e202 D_strdata_2e202 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\151\070\072\040\151\070\040\075\040\064\062\151\066\064\073\040\175\073" };
+static struct S_strliteral_2e203 D_strliteral_2e203 = { (char *)((char *)&D_strdata_2e202) + 0, 42U, 42U };
+static const struct S_strdata_2e222 D_strdata_2e222 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\151\070\072\040\151\070\040\075\040\064\062\151\073\040\175\073" };
+static struct S_strliteral_2e223 D_strliteral_2e223 = { (char *)((char *)&D_strdata_2e222) + 0, 40U, 40U };
+static const struct S_strdata_2e242 D_strdata_2e242 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\151\061\066\072\040\151\061\066\040\075\040\064\062\151\063\062\073\040\175\073" };
+static struct S_strliteral_2e243 D_strliteral_2e243 = { (char *)((char *)&D_strdata_2e242) + 0, 44U, 44U };
+static const struct S_strdata_2e262 D_strdata_2e262 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\151\061\066\072\040\151\061\066\040\075\040\064\062\151\066\064\073\040\175\073" };
+static struct S_strliteral_2e263 D_strliteral_2e263 = { (char *)((char *)&D_strdata_2e262) + 0, 44U, 44U };
+static const struct S_strdata_2e282 D_strdata_2e282 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\151\063\062\072\040\151\063\062\040\075\040\064\062\151\066\064\073\040\175\073" };
+static struct S_strliteral_2e283 D_strliteral_2e283 = { (char *)((char *)&D_strdata_2e282) + 0, 44U, 44U };
+static const struct S_strdata_2e302 D_strdata_2e302 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\165\070\072\040\165\070\040\075\040\064\062\165\061\066\073\040\175\073" };
+static struct S_strliteral_2e303 D_strliteral_2e303 = { (char *)((char *)&D_strdata_2e302) + 0, 42U, 42U };
+static const struct S_strdata_2e322 D_strdata_2e322 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\165\070\072\040\165\070\040\075\040\064\062\165\063\062\073\040\175\073" };
+static struct S_strliteral_2e323 D_strliteral_2e323 = { (char *)((char *)&D_strdata_2e322) + 0, 42U, 42U };
+static const struct S_strdata_2e342 D_strdata_2e342 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\165\070\072\040\165\070\040\075\040\064\062\165\066\064\073\040\175\073" };
+static struct S_strliteral_2e343 D_strliteral_2e343 = { (char *)((char *)&D_strdata_2e342) + 0, 42U, 42U };
+static const struct S_strdata_2e362 D_strdata_2e362 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\165\070\072\040\165\070\040\075\040\064\062\165\073\040\175\073" };
+static struct S_strliteral_2e363 D_strliteral_2e363 = { (char *)((char *)&D_strdata_2e362) + 0, 40U, 40U };
+static const struct S_strdata_2e382 D_strdata_2e382 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\165\061\066\072\040\165\061\066\040\075\040\064\062\165\063\062\073\040\175\073" };
+static struct S_strliteral_2e383 D_strliteral_2e383 = { (char *)((char *)&D_strdata_2e382) + 0, 44U, 44U };
+static const struct S_strdata_2e402 D_strdata_2e402 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\165\061\066\072\040\165\061\066\040\075\040\064\062\165\066\064\073\040\175\073" };
+static struct S_strliteral_2e403 D_strliteral_2e403 = { (char *)((char *)&D_strdata_2e402) + 0, 44U, 44U };
+static const struct S_strdata_2e422 D_strdata_2e422 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\165\063\062\072\040\165\063\062\040\075\040\064\062\165\066\064\073\040\175\073" };
+static struct S_strliteral_2e423 D_strliteral_2e423 = { (char *)((char *)&D_strdata_2e422) + 0, 44U, 44U };
+static const struct S_strdata_2e442 D_strdata_2e442 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\137\146\063\062\072\040\146\063\062\040\075\040\064\062\146\066\064\073\040\175\073" };
+static struct S_strliteral_2e443 D_strliteral_2e443 = { (char *)((char *)&D_strdata_2e442) + 0, 44U, 44U };
+static const struct S_strdata_2e486 D_strdata_2e486 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\156\165\154\154\141\142\154\145\040\052\151\156\164\040\075\040\156\165\154\154\073\040\154\145\164\040\171\072\040\052\151\156\164\040\075\040\170\073\040\175\073" };
+static struct S_strliteral_2e487 D_strliteral_2e487 = { (char *)((char *)&D_strdata_2e486) + 0, 67U, 67U };
+static const struct S_strdata_2e506 D_strdata_2e506 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\151\156\164\040\075\040\061\060\073\040\154\145\164\040\171\072\040\052\151\156\164\040\075\040\046\170\073\040\154\145\164\040\171\072\040\052\165\151\156\164\040\075\040\170\073\040\175\073" };
+static struct S_strliteral_2e507 D_strliteral_2e507 = { (char *)((char *)&D_strdata_2e506) + 0, 74U, 74U };
+static const struct S_strdata_2e526 D_strdata_2e526 = { "\164\171\160\145\040\151\040\075\040\151\156\164\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\046\064\062\073\040\154\145\164\040\171\072\040\052\151\040\075\040\170\073\040\175\073" };
+static struct S_strliteral_2e527 D_strliteral_2e527 = { (char *)((char *)&D_strdata_2e526) + 0, 62U, 62U };
+static const struct S_strdata_2e546 D_strdata_2e546 = { "\164\171\160\145\040\166\040\075\040\166\157\151\144\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\046\060\073\040\154\145\164\040\170\072\040\052\166\040\075\040\170\073\040\175\073" };
+static struct S_strliteral_2e547 D_strliteral_2e547 = { (char *)((char *)&D_strdata_2e546) + 0, 62U, 62U };
+static const struct S_strdata_2e566 D_strdata_2e566 = { "\164\171\160\145\040\151\040\075\040\151\156\164\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\133\135\151\156\164\040\075\040\133\061\054\040\062\054\040\063\135\073\040\154\145\164\040\171\072\040\133\135\151\040\075\040\170\073\040\175\073" };
+static struct S_strliteral_2e567 D_strliteral_2e567 = { (char *)((char *)&D_strdata_2e566) + 0, 76U, 76U };
+static const struct S_strdata_2e586 D_strdata_2e586 = { "\164\171\160\145\040\166\040\075\040\166\157\151\144\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\133\135\151\156\164\040\075\040\133\060\135\073\040\154\145\164\040\170\072\040\133\135\166\040\075\040\170\073\040\175\073" };
+static struct S_strliteral_2e587 D_strliteral_2e587 = { (char *)((char *)&D_strdata_2e586) + 0, 71U, 71U };
+static struct S_abortsites_2e105 D_abortsites_2e105 = { (char *)((char *)&D_strliteral_2e1) + 0, 49U, 87U, (char *)((char *)&D_strliteral_2e1) + 0, 49U, 87U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 88U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 88U, (char *)((char *)&D_strliteral_2e1) + 0, 65U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 65U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 66U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 66U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 67U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 67U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 68U, 76U, (char *)((char *)&D_strliteral_2e1) + 0, 68U, 76U, (char *)((char *)&D_strliteral_2e1) + 0, 69U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 69U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 70U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 70U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 71U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 71U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 72U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 72U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 73U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 73U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 74U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 74U, 78U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 76U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 76U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 77U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 77U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 78U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 78U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 80U, (char *)((char *)&D_strliteral_2e1) + 0, 98U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 98U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 109U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 109U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 115U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 115U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 119U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 119U, 11U };
+void F_main(void) {
+	u64 t__2e13;
+	u64 t__2e14;
+	u64 t__2e15;
+	u64 t__2e16;
+	u64 t__2e17;
+	u64 t__2e8;
+	u64 t__2e9;
+	u64 t_abortsite_2e11;
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_rules)))();
+	t__2e9 = (u64)(((u64 (*)(void))((u64)((char *)&F_rvalue)))());
+	t__2e8 = (u64)(u32)(((u64)t__2e9 == (u64)((u64)1234UL)));
+	if ((u32)t__2e8) goto L_passed_2e7; else goto L_failed_2e6;
+	L_failed_2e6:;
+	t_abortsite_2e11 = ((u64)0UL);
+	goto L_abort_2e12;
+	L_passed_2e7:;
+	((void (*)(void))((u64)((char *)&F_calls)))();
+	goto L__2e4;
+	L__2e18:;
+	L__2e4:;
+	return;
+	L_abort_2e12:;
+	t__2e13 = (u64)((u64)t_abortsite_2e11 * (u64)((u64)16UL));
+	t__2e13 = (u64)((u64)((u64)((char *)&D_abortsites_2e10)) + (u64)t__2e13);
+	t__2e14 = (u64)(*(u64 *)t__2e13);
+	t__2e15 = (u64)((u64)t__2e13 + (u64)((u64)8UL));
+	t__2e16 = (u64)(*(u32 *)t__2e15);
+	t__2e15 = (u64)((u64)t__2e13 + (u64)((u64)12UL));
+	t__2e17 = (u64)(*(u32 *)t__2e15);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e14, (u64)t__2e16, (u64)t__2e17, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_calls(void) {
+	L_start_2e19:;
+	L_body_2e20:;
+	((void (*)(u64))((u64)((char *)&F_callme)))((u64)((u64)1234UL));
+	goto L__2e21;
+	L__2e23:;
+	L__2e21:;
+	return;
+}
+static void F_callme(u64 p_in) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t__2e36;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t_abortsite_2e34;
+	u64 t_in;
+	u64 t_param_2e25;
+	t_in = (u64)p_in;
+	L_start_2e24:;
+	t_param_2e25 = (u64)A0;
+	*(u64 *)t_param_2e25 = (u64)t_in;
+	L_body_2e26:;
+	t__2e32 = (u64)(*(u64 *)t_param_2e25);
+	t__2e31 = (u64)(u32)(((u64)t__2e32 == (u64)((u64)1234UL)));
+	if ((u32)t__2e31) goto L_passed_2e30; else goto L_failed_2e29;
+	L_failed_2e29:;
+	t_abortsite_2e34 = ((u64)0UL);
+	goto L_abort_2e35;
+	L_passed_2e30:;
+	goto L__2e27;
+	L__2e41:;
+	L__2e27:;
+	return;
+	L_abort_2e35:;
+	t__2e36 = (u64)((u64)t_abortsite_2e34 * (u64)((u64)16UL));
+	t__2e36 = (u64)((u64)((u64)((char *)&D_abortsites_2e33)) + (u64)t__2e36);
+	t__2e37 = (u64)(*(u64 *)t__2e36);
+	t__2e38 = (u64)((u64)t__2e36 + (u64)((u64)8UL));
+	t__2e39 = (u64)(*(u32 *)t__2e38);
+	t__2e38 = (u64)((u64)t__2e36 + (u64)((u64)12UL));
+	t__2e40 = (u64)(*(u32 *)t__2e38);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e37, (u64)t__2e39, (u64)t__2e40, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u64 F_rvalue(void) {
+	L_start_2e42:;
+	L_body_2e43:;
+	return (u64)((u64)1234UL);
+	L__2e46:;
+	L__2e44:;
+	L__2e47:;
+	return 0;
+}
+static void F_rules(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[2] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[4] __attribute__((aligned(16)));
+	char A5[2] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[4] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char A11[4] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char A20[8] __attribute__((aligned(16)));
+	char A21[24] __attribute__((aligned(16)));
+	char A22[8] __attribute__((aligned(16)));
+	char A23[24] __attribute__((aligned(16)));
+	char A24[8] __attribute__((aligned(16)));
+	char A25[24] __attribute__((aligned(16)));
+	char A26[8] __attribute__((aligned(16)));
+	char A27[24] __attribute__((aligned(16)));
+	char A28[8] __attribute__((aligned(16)));
+	char A29[24] __attribute__((aligned(16)));
+	char A30[8] __attribute__((aligned(16)));
+	char A31[24] __attribute__((aligned(16)));
+	char A32[8] __attribute__((aligned(16)));
+	char A33[24] __attribute__((aligned(16)));
+	char A34[8] __attribute__((aligned(16)));
+	char A35[24] __attribute__((aligned(16)));
+	char A36[8] __attribute__((aligned(16)));
+	char A37[24] __attribute__((aligned(16)));
+	char A38[8] __attribute__((aligned(16)));
+	char A39[24] __attribute__((aligned(16)));
+	char A40[8] __attribute__((aligned(16)));
+	char A41[24] __attribute__((aligned(16)));
+	char A42[8] __attribute__((aligned(16)));
+	char A43[8] __attribute__((aligned(16)));
+	char A44[24] __attribute__((aligned(16)));
+	char A45[12] __attribute__((aligned(16)));
+	char A46[24] __attribute__((aligned(16)));
+	char A47[8] __attribute__((aligned(16)));
+	char A48[8] __attribute__((aligned(16)));
+	char A49[8] __attribute__((aligned(16)));
+	char A50[8] __attribute__((aligned(16)));
+	char A51[8] __attribute__((aligned(16)));
+	char A52[8] __attribute__((aligned(16)));
+	char A53[8] __attribute__((aligned(16)));
+	char A54[24] __attribute__((aligned(16)));
+	char A55[8] __attribute__((aligned(16)));
+	char A56[24] __attribute__((aligned(16)));
+	char A57[8] __attribute__((aligned(16)));
+	char A58[24] __attribute__((aligned(16)));
+	char A59[8] __attribute__((aligned(16)));
+	char A60[24] __attribute__((aligned(16)));
+	char A61[8] __attribute__((aligned(16)));
+	char A62[24] __attribute__((aligned(16)));
+	char A63[8] __attribute__((aligned(16)));
+	char A64[24] __attribute__((aligned(16)));
+	char A65[4] __attribute__((aligned(16)));
+	char A66[4] __attribute__((aligned(16)));
+	char B67[8] __attribute__((aligned(16)));
+	char B68[24] __attribute__((aligned(16)));
+	char B69[24] __attribute__((aligned(16)));
+	char R70[4] __attribute__((aligned(16)));
+	char B71[8] __attribute__((aligned(16)));
+	char B72[24] __attribute__((aligned(16)));
+	char B73[24] __attribute__((aligned(16)));
+	char R74[4] __attribute__((aligned(16)));
+	char B75[8] __attribute__((aligned(16)));
+	char B76[24] __attribute__((aligned(16)));
+	char B77[24] __attribute__((aligned(16)));
+	char R78[4] __attribute__((aligned(16)));
+	char B79[8] __attribute__((aligned(16)));
+	char B80[24] __attribute__((aligned(16)));
+	char B81[24] __attribute__((aligned(16)));
+	char R82[4] __attribute__((aligned(16)));
+	char B83[8] __attribute__((aligned(16)));
+	char B84[24] __attribute__((aligned(16)));
+	char B85[24] __attribute__((aligned(16)));
+	char R86[4] __attribute__((aligned(16)));
+	char B87[8] __attribute__((aligned(16)));
+	char B88[24] __attribute__((aligned(16)));
+	char B89[24] __attribute__((aligned(16)));
+	char R90[4] __attribute__((aligned(16)));
+	char B91[8] __attribute__((aligned(16)));
+	char B92[24] __attribute__((aligned(16)));
+	char B93[24] __attribute__((aligned(16)));
+	char R94[4] __attribute__((aligned(16)));
+	char B95[8] __attribute__((aligned(16)));
+	char B96[24] __attribute__((aligned(16)));
+	char B97[24] __attribute__((aligned(16)));
+	char R98[4] __attribute__((aligned(16)));
+	char B99[8] __attribute__((aligned(16)));
+	char B100[24] __attribute__((aligned(16)));
+	char B101[24] __attribute__((aligned(16)));
+	char R102[4] __attribute__((aligned(16)));
+	char B103[8] __attribute__((aligned(16)));
+	char B104[24] __attribute__((aligned(16)));
+	char B105[24] __attribute__((aligned(16)));
+	char R106[4] __attribute__((aligned(16)));
+	char B107[8] __attribute__((aligned(16)));
+	char B108[24] __attribute__((aligned(16)));
+	char B109[24] __attribute__((aligned(16)));
+	char R110[4] __attribute__((aligned(16)));
+	char B111[8] __attribute__((aligned(16)));
+	char B112[24] __attribute__((aligned(16)));
+	char B113[24] __attribute__((aligned(16)));
+	char R114[4] __attribute__((aligned(16)));
+	char B115[8] __attribute__((aligned(16)));
+	char B116[24] __attribute__((aligned(16)));
+	char B117[24] __attribute__((aligned(16)));
+	char R118[4] __attribute__((aligned(16)));
+	char B119[8] __attribute__((aligned(16)));
+	char B120[24] __attribute__((aligned(16)));
+	char B121[24] __attribute__((aligned(16)));
+	char R122[4] __attribute__((aligned(16)));
+	char B123[8] __attribute__((aligned(16)));
+	char B124[24] __attribute__((aligned(16)));
+	char B125[24] __attribute__((aligned(16)));
+	char R126[4] __attribute__((aligned(16)));
+	char B127[8] __attribute__((aligned(16)));
+	char B128[24] __attribute__((aligned(16)));
+	char B129[24] __attribute__((aligned(16)));
+	char R130[4] __attribute__((aligned(16)));
+	char B131[8] __attribute__((aligned(16)));
+	char B132[24] __attribute__((aligned(16)));
+	char B133[24] __attribute__((aligned(16)));
+	char R134[4] __attribute__((aligned(16)));
+	char B135[8] __attribute__((aligned(16)));
+	char B136[24] __attribute__((aligned(16)));
+	char B137[24] __attribute__((aligned(16)));
+	char R138[4] __attribute__((aligned(16)));
+	char B139[8] __attribute__((aligned(16)));
+	char B140[24] __attribute__((aligned(16)));
+	char B141[24] __attribute__((aligned(16)));
+	char R142[4] __attribute__((aligned(16)));
+	char B143[8] __attribute__((aligned(16)));
+	char B144[24] __attribute__((aligned(16)));
+	char B145[24] __attribute__((aligned(16)));
+	char R146[4] __attribute__((aligned(16)));
+	char B147[8] __attribute__((aligned(16)));
+	char B148[24] __attribute__((aligned(16)));
+	char B149[24] __attribute__((aligned(16)));
+	char R150[4] __attribute__((aligned(16)));
+	char B151[8] __attribute__((aligned(16)));
+	char B152[24] __attribute__((aligned(16)));
+	char B153[24] __attribute__((aligned(16)));
+	char R154[4] __attribute__((aligned(16)));
+	char B155[8] __attribute__((aligned(16)));
+	char B156[24] __attribute__((aligned(16)));
+	char B157[24] __attribute__((aligned(16)));
+	char R158[4] __attribute__((aligned(16)));
+	u64 t__2e102;
+	u64 t__2e104;
+	u64 t__2e108;
+	u64 t__2e109;
+	u64 t__2e110;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e115;
+	u64 t__2e116;
+	u64 t__2e117;
+	u64 t__2e118;
+	u64 t__2e119;
+	u64 t__2e122;
+	u64 t__2e123;
+	u64 t__2e124;
+	u64 t__2e129;
+	u64 t__2e130;
+	u64 t__2e134;
+	u64 t__2e136;
+	u64 t__2e140;
+	u64 t__2e149;
+	u64 t__2e151;
+	u64 t__2e155;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e159;
+	u64 t__2e161;
+	u64 t__2e165;
+	u64 t__2e174;
+	u64 t__2e176;
+	u64 t__2e179;
+	u64 t__2e181;
+	u64 t__2e185;
+	u64 t__2e194;
+	u64 t__2e196;
+	u64 t__2e199;
+	u64 t__2e201;
+	u64 t__2e205;
+	u64 t__2e214;
+	u64 t__2e216;
+	u64 t__2e219;
+	u64 t__2e221;
+	u64 t__2e225;
+	u64 t__2e234;
+	u64 t__2e236;
+	u64 t__2e239;
+	u64 t__2e241;
+	u64 t__2e245;
+	u64 t__2e254;
+	u64 t__2e256;
+	u64 t__2e259;
+	u64 t__2e261;
+	u64 t__2e265;
+	u64 t__2e274;
+	u64 t__2e276;
+	u64 t__2e279;
+	u64 t__2e281;
+	u64 t__2e285;
+	u64 t__2e294;
+	u64 t__2e296;
+	u64 t__2e299;
+	u64 t__2e301;
+	u64 t__2e305;
+	u64 t__2e314;
+	u64 t__2e316;
+	u64 t__2e319;
+	u64 t__2e321;
+	u64 t__2e325;
+	u64 t__2e334;
+	u64 t__2e336;
+	u64 t__2e339;
+	u64 t__2e341;
+	u64 t__2e345;
+	u64 t__2e354;
+	u64 t__2e356;
+	u64 t__2e359;
+	u64 t__2e361;
+	u64 t__2e365;
+	u64 t__2e374;
+	u64 t__2e376;
+	u64 t__2e379;
+	u64 t__2e381;
+	u64 t__2e385;
+	u64 t__2e394;
+	u64 t__2e396;
+	u64 t__2e399;
+	u64 t__2e401;
+	u64 t__2e405;
+	u64 t__2e414;
+	u64 t__2e416;
+	u64 t__2e419;
+	u64 t__2e421;
+	u64 t__2e425;
+	u64 t__2e434;
+	u64 t__2e436;
+	u64 t__2e439;
+	u64 t__2e441;
+	u64 t__2e445;
+	u64 t__2e454;
+	u64 t__2e456;
+	u64 t__2e459;
+	u64 t__2e461;
+	u64 t__2e466;
+	u64 t__2e470;
+	u64 t__2e475;
+	u64 t__2e479;
+	u64 t__2e483;
+	u64 t__2e485;
+	u64 t__2e489;
+	u64 t__2e498;
+	u64 t__2e500;
+	u64 t__2e503;
+	u64 t__2e505;
+	u64 t__2e509;
+	u64 t__2e518;
+	u64 t__2e520;
+	u64 t__2e523;
+	u64 t__2e525;
+	u64 t__2e529;
+	u64 t__2e53;
+	u64 t__2e538;
+	u64 t__2e54;
+	u64 t__2e540;
+	u64 t__2e543;
+	u64 t__2e545;
+	u64 t__2e549;
+	u64 t__2e55;
+	u64 t__2e558;
+	u64 t__2e56;
+	u64 t__2e560;
+	u64 t__2e563;
+	u64 t__2e565;
+	u64 t__2e569;
+	u64 t__2e578;
+	u64 t__2e58;
+	u64 t__2e580;
+	u64 t__2e583;
+	u64 t__2e585;
+	u64 t__2e589;
+	u64 t__2e59;
+	u64 t__2e598;
+	u64 t__2e600;
+	u64 t__2e604;
+	u64 t__2e61;
+	u64 t__2e63;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e66;
+	u64 t__2e68;
+	u64 t__2e69;
+	u64 t__2e71;
+	u64 t__2e76;
+	u64 t__2e77;
+	u64 t__2e81;
+	u64 t__2e87;
+	u64 t__2e93;
+	u64 t_abortsite_2e106;
+	u64 t_binding_2e121;
+	u64 t_binding_2e154;
+	u64 t_binding_2e458;
+	u64 t_binding_2e460;
+	u64 t_binding_2e462;
+	u64 t_binding_2e467;
+	u64 t_binding_2e469;
+	u64 t_binding_2e474;
+	u64 t_binding_2e478;
+	u64 t_binding_2e52;
+	u64 t_binding_2e57;
+	u64 t_binding_2e60;
+	u64 t_binding_2e602;
+	u64 t_binding_2e603;
+	u64 t_binding_2e62;
+	u64 t_binding_2e67;
+	u64 t_binding_2e70;
+	u64 t_item_2e465;
+	u64 t_object_2e135;
+	u64 t_object_2e139;
+	u64 t_object_2e160;
+	u64 t_object_2e164;
+	u64 t_object_2e180;
+	u64 t_object_2e184;
+	u64 t_object_2e200;
+	u64 t_object_2e204;
+	u64 t_object_2e220;
+	u64 t_object_2e224;
+	u64 t_object_2e240;
+	u64 t_object_2e244;
+	u64 t_object_2e260;
+	u64 t_object_2e264;
+	u64 t_object_2e280;
+	u64 t_object_2e284;
+	u64 t_object_2e300;
+	u64 t_object_2e304;
+	u64 t_object_2e320;
+	u64 t_object_2e324;
+	u64 t_object_2e340;
+	u64 t_object_2e344;
+	u64 t_object_2e360;
+	u64 t_object_2e364;
+	u64 t_object_2e380;
+	u64 t_object_2e384;
+	u64 t_object_2e400;
+	u64 t_object_2e404;
+	u64 t_object_2e420;
+	u64 t_object_2e424;
+	u64 t_object_2e440;
+	u64 t_object_2e444;
+	u64 t_object_2e463;
+	u64 t_object_2e484;
+	u64 t_object_2e488;
+	u64 t_object_2e504;
+	u64 t_object_2e508;
+	u64 t_object_2e524;
+	u64 t_object_2e528;
+	u64 t_object_2e544;
+	u64 t_object_2e548;
+	u64 t_object_2e564;
+	u64 t_object_2e568;
+	u64 t_object_2e584;
+	u64 t_object_2e588;
+	u64 t_object_2e83;
+	u64 t_object_2e91;
+	u64 t_tag_2e141;
+	u64 t_tag_2e166;
+	u64 t_tag_2e186;
+	u64 t_tag_2e206;
+	u64 t_tag_2e226;
+	u64 t_tag_2e246;
+	u64 t_tag_2e266;
+	u64 t_tag_2e286;
+	u64 t_tag_2e306;
+	u64 t_tag_2e326;
+	u64 t_tag_2e346;
+	u64 t_tag_2e366;
+	u64 t_tag_2e386;
+	u64 t_tag_2e406;
+	u64 t_tag_2e426;
+	u64 t_tag_2e446;
+	u64 t_tag_2e490;
+	u64 t_tag_2e510;
+	u64 t_tag_2e530;
+	u64 t_tag_2e550;
+	u64 t_tag_2e570;
+	u64 t_tag_2e590;
+	u64 t_tag_2e94;
+	L_start_2e48:;
+	t_binding_2e52 = (u64)A0;
+	t_binding_2e57 = (u64)A1;
+	t_binding_2e60 = (u64)A2;
+	t_binding_2e62 = (u64)A3;
+	t_binding_2e67 = (u64)A4;
+	t_binding_2e70 = (u64)A5;
+	t_object_2e83 = (u64)A6;
+	t_object_2e91 = (u64)A7;
+	t_binding_2e121 = (u64)A8;
+	t_object_2e135 = (u64)A9;
+	t_object_2e139 = (u64)A10;
+	t_binding_2e154 = (u64)A11;
+	t_object_2e160 = (u64)A12;
+	t_object_2e164 = (u64)A13;
+	t_object_2e180 = (u64)A14;
+	t_object_2e184 = (u64)A15;
+	t_object_2e200 = (u64)A16;
+	t_object_2e204 = (u64)A17;
+	t_object_2e220 = (u64)A18;
+	t_object_2e224 = (u64)A19;
+	t_object_2e240 = (u64)A20;
+	t_object_2e244 = (u64)A21;
+	t_object_2e260 = (u64)A22;
+	t_object_2e264 = (u64)A23;
+	t_object_2e280 = (u64)A24;
+	t_object_2e284 = (u64)A25;
+	t_object_2e300 = (u64)A26;
+	t_object_2e304 = (u64)A27;
+	t_object_2e320 = (u64)A28;
+	t_object_2e324 = (u64)A29;
+	t_object_2e340 = (u64)A30;
+	t_object_2e344 = (u64)A31;
+	t_object_2e360 = (u64)A32;
+	t_object_2e364 = (u64)A33;
+	t_object_2e380 = (u64)A34;
+	t_object_2e384 = (u64)A35;
+	t_object_2e400 = (u64)A36;
+	t_object_2e404 = (u64)A37;
+	t_object_2e420 = (u64)A38;
+	t_object_2e424 = (u64)A39;
+	t_object_2e440 = (u64)A40;
+	t_object_2e444 = (u64)A41;
+	t_binding_2e458 = (u64)A42;
+	t_binding_2e460 = (u64)A43;
+	t_binding_2e462 = (u64)A44;
+	t_object_2e463 = (u64)A45;
+	t_binding_2e467 = (u64)A46;
+	t_binding_2e469 = (u64)A47;
+	t__2e470 = (u64)A48;
+	t_binding_2e474 = (u64)A49;
+	t__2e475 = (u64)A50;
+	t_binding_2e478 = (u64)A51;
+	t__2e479 = (u64)A52;
+	t_object_2e484 = (u64)A53;
+	t_object_2e488 = (u64)A54;
+	t_object_2e504 = (u64)A55;
+	t_object_2e508 = (u64)A56;
+	t_object_2e524 = (u64)A57;
+	t_object_2e528 = (u64)A58;
+	t_object_2e544 = (u64)A59;
+	t_object_2e548 = (u64)A60;
+	t_object_2e564 = (u64)A61;
+	t_object_2e568 = (u64)A62;
+	t_object_2e584 = (u64)A63;
+	t_object_2e588 = (u64)A64;
+	t_binding_2e602 = (u64)A65;
+	t_binding_2e603 = (u64)A66;
+	L_body_2e49:;
+	*(u64 *)t_binding_2e52 = (u64)((u64)0UL);
+	t__2e53 = (u64)((i64)(i8)((u64)42UL));
+	*(u64 *)t_binding_2e52 = (u64)t__2e53;
+	t__2e54 = (u64)((i64)(i16)((u64)42UL));
+	*(u64 *)t_binding_2e52 = (u64)t__2e54;
+	t__2e55 = (u64)((i64)(i32)((u64)42UL));
+	*(u64 *)t_binding_2e52 = (u64)t__2e55;
+	t__2e56 = (u64)((i64)(i32)((u64)42UL));
+	*(u64 *)t_binding_2e52 = (u64)t__2e56;
+	*(u32 *)t_binding_2e57 = (u32)((u64)0UL);
+	t__2e58 = (u64)(u32)((i64)(i8)((u64)42UL));
+	*(u32 *)t_binding_2e57 = (u32)t__2e58;
+	t__2e59 = (u64)(u32)((i64)(i16)((u64)42UL));
+	*(u32 *)t_binding_2e57 = (u32)t__2e59;
+	*(u16 *)t_binding_2e60 = (u16)((u64)0UL);
+	t__2e61 = (u64)(u32)((i64)(i8)((u64)42UL));
+	*(u16 *)t_binding_2e60 = (u16)t__2e61;
+	*(u64 *)t_binding_2e62 = (u64)((u64)0UL);
+	t__2e63 = (u64)((u8)((u64)42UL));
+	*(u64 *)t_binding_2e62 = (u64)t__2e63;
+	t__2e64 = (u64)((u16)((u64)42UL));
+	*(u64 *)t_binding_2e62 = (u64)t__2e64;
+	t__2e65 = (u64)((u32)((u64)42UL));
+	*(u64 *)t_binding_2e62 = (u64)t__2e65;
+	t__2e66 = (u64)((u32)((u64)42UL));
+	*(u64 *)t_binding_2e62 = (u64)t__2e66;
+	*(u32 *)t_binding_2e67 = (u32)((u64)0UL);
+	t__2e68 = (u64)(u32)((u8)((u64)42UL));
+	*(u32 *)t_binding_2e67 = (u32)t__2e68;
+	t__2e69 = (u64)(u32)((u16)((u64)42UL));
+	*(u32 *)t_binding_2e67 = (u32)t__2e69;
+	*(u16 *)t_binding_2e70 = (u16)((u64)0UL);
+	t__2e71 = (u64)(u32)((u8)((u64)42UL));
+	*(u16 *)t_binding_2e70 = (u16)t__2e71;
+	t__2e76 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)8UL)));
+	t__2e77 = (u64)(u32)((u8)t__2e76);
+	if ((u32)t__2e77) goto L_true_2e73; else goto L_false_2e74;
+	L_true_2e73:;
+	*(u32 *)t_object_2e83 = (u32)((u64)3532310079UL);
+	t__2e87 = (u64)((u64)t_object_2e83 + (u64)((u64)4UL));
+	*(u32 *)t__2e87 = (u32)((u64)0UL);
+	*(u64 *)t_object_2e91 = (u64)((u64)0UL);
+	t__2e93 = (u64)((u64)t_object_2e91 + (u64)((u64)8UL));
+	*(u64 *)t__2e93 = (u64)((u64)0UL);
+	t__2e93 = (u64)((u64)t__2e93 + (u64)((u64)8UL));
+	*(u64 *)t__2e93 = (u64)((u64)0UL);
+	BLIT((u64)B67, t_object_2e83, 8);
+	BLIT((u64)B68, ((u64)((char *)&D_strliteral_2e89)), 24);
+	BLIT((u64)B69, t_object_2e91, 24);
+	t__2e81 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R70, (u64)B67, (u64)B68, (u64)B69);
+	t_tag_2e94 = (u64)(*(u32 *)t__2e81);
+	t__2e102 = (u64)(u32)(((u32)t_tag_2e94 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e102) goto L_member_2e99; else goto L__2e101;
+	L__2e101:;
+	t__2e104 = (u64)(u32)(((u32)t_tag_2e94 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e104) goto L_member_2e100; else goto L__2e103;
+	L__2e103:;
+	goto L_matches_2e98;
+	L_member_2e99:;
+	goto L_matches_2e98;
+	L_member_2e100:;
+	goto L_matches_2e97;
+	L_matches_2e97:;
+	goto L__2e95;
+	L_matches_2e98:;
+	t_abortsite_2e106 = ((u64)0UL);
+	goto L_abort_2e107;
+	L__2e113:;
+	L__2e96:;
+	t_abortsite_2e106 = ((u64)1UL);
+	goto L_abort_2e114;
+	L__2e95:;
+	goto L__2e78;
+	L__2e120:;
+	L__2e78:;
+	goto L__2e75;
+	L_false_2e74:;
+	L__2e75:;
+	*(u32 *)t_binding_2e121 = (u32)((u64)42UL);
+	t__2e122 = (u64)(u32)((u64)42UL);
+	*(u32 *)t_binding_2e121 = (u32)t__2e122;
+	t__2e123 = (u64)(u32)((i64)(i16)((u64)42UL));
+	*(u32 *)t_binding_2e121 = (u32)t__2e123;
+	t__2e124 = (u64)(u32)((i64)(i8)((u64)42UL));
+	*(u32 *)t_binding_2e121 = (u32)t__2e124;
+	t__2e129 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)8UL)));
+	t__2e130 = (u64)(u32)((u8)t__2e129);
+	if ((u32)t__2e130) goto L_true_2e126; else goto L_false_2e127;
+	L_true_2e126:;
+	*(u32 *)t_object_2e135 = (u32)((u64)3532310079UL);
+	t__2e136 = (u64)((u64)t_object_2e135 + (u64)((u64)4UL));
+	*(u32 *)t__2e136 = (u32)((u64)0UL);
+	*(u64 *)t_object_2e139 = (u64)((u64)0UL);
+	t__2e140 = (u64)((u64)t_object_2e139 + (u64)((u64)8UL));
+	*(u64 *)t__2e140 = (u64)((u64)0UL);
+	t__2e140 = (u64)((u64)t__2e140 + (u64)((u64)8UL));
+	*(u64 *)t__2e140 = (u64)((u64)0UL);
+	BLIT((u64)B71, t_object_2e135, 8);
+	BLIT((u64)B72, ((u64)((char *)&D_strliteral_2e138)), 24);
+	BLIT((u64)B73, t_object_2e139, 24);
+	t__2e134 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R74, (u64)B71, (u64)B72, (u64)B73);
+	t_tag_2e141 = (u64)(*(u32 *)t__2e134);
+	t__2e149 = (u64)(u32)(((u32)t_tag_2e141 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e149) goto L_member_2e146; else goto L__2e148;
+	L__2e148:;
+	t__2e151 = (u64)(u32)(((u32)t_tag_2e141 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e151) goto L_member_2e147; else goto L__2e150;
+	L__2e150:;
+	goto L_matches_2e145;
+	L_member_2e146:;
+	goto L_matches_2e145;
+	L_member_2e147:;
+	goto L_matches_2e144;
+	L_matches_2e144:;
+	goto L__2e142;
+	L_matches_2e145:;
+	t_abortsite_2e106 = ((u64)2UL);
+	goto L_abort_2e107;
+	L__2e152:;
+	L__2e143:;
+	t_abortsite_2e106 = ((u64)3UL);
+	goto L_abort_2e114;
+	L__2e142:;
+	goto L__2e131;
+	L__2e153:;
+	L__2e131:;
+	goto L__2e128;
+	L_false_2e127:;
+	L__2e128:;
+	*(u32 *)t_binding_2e154 = (u32)((u64)42UL);
+	t__2e155 = (u64)(u32)((u64)42UL);
+	*(u32 *)t_binding_2e154 = (u32)t__2e155;
+	t__2e156 = (u64)(u32)((u16)((u64)42UL));
+	*(u32 *)t_binding_2e154 = (u32)t__2e156;
+	t__2e157 = (u64)(u32)((u8)((u64)42UL));
+	*(u32 *)t_binding_2e154 = (u32)t__2e157;
+	*(u32 *)t_object_2e160 = (u32)((u64)3532310079UL);
+	t__2e161 = (u64)((u64)t_object_2e160 + (u64)((u64)4UL));
+	*(u32 *)t__2e161 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e164 = (u64)((u64)0UL);
+	t__2e165 = (u64)((u64)t_object_2e164 + (u64)((u64)8UL));
+	*(u64 *)t__2e165 = (u64)((u64)0UL);
+	t__2e165 = (u64)((u64)t__2e165 + (u64)((u64)8UL));
+	*(u64 *)t__2e165 = (u64)((u64)0UL);
+	BLIT((u64)B75, t_object_2e160, 8);
+	BLIT((u64)B76, ((u64)((char *)&D_strliteral_2e163)), 24);
+	BLIT((u64)B77, t_object_2e164, 24);
+	t__2e159 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R78, (u64)B75, (u64)B76, (u64)B77);
+	t_tag_2e166 = (u64)(*(u32 *)t__2e159);
+	t__2e174 = (u64)(u32)(((u32)t_tag_2e166 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e174) goto L_member_2e171; else goto L__2e173;
+	L__2e173:;
+	t__2e176 = (u64)(u32)(((u32)t_tag_2e166 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e176) goto L_member_2e172; else goto L__2e175;
+	L__2e175:;
+	goto L_matches_2e170;
+	L_member_2e171:;
+	goto L_matches_2e170;
+	L_member_2e172:;
+	goto L_matches_2e169;
+	L_matches_2e169:;
+	goto L__2e167;
+	L_matches_2e170:;
+	t_abortsite_2e106 = ((u64)4UL);
+	goto L_abort_2e107;
+	L__2e177:;
+	L__2e168:;
+	t_abortsite_2e106 = ((u64)5UL);
+	goto L_abort_2e114;
+	L__2e167:;
+	*(u32 *)t_object_2e180 = (u32)((u64)3532310079UL);
+	t__2e181 = (u64)((u64)t_object_2e180 + (u64)((u64)4UL));
+	*(u32 *)t__2e181 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e184 = (u64)((u64)0UL);
+	t__2e185 = (u64)((u64)t_object_2e184 + (u64)((u64)8UL));
+	*(u64 *)t__2e185 = (u64)((u64)0UL);
+	t__2e185 = (u64)((u64)t__2e185 + (u64)((u64)8UL));
+	*(u64 *)t__2e185 = (u64)((u64)0UL);
+	BLIT((u64)B79, t_object_2e180, 8);
+	BLIT((u64)B80, ((u64)((char *)&D_strliteral_2e183)), 24);
+	BLIT((u64)B81, t_object_2e184, 24);
+	t__2e179 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R82, (u64)B79, (u64)B80, (u64)B81);
+	t_tag_2e186 = (u64)(*(u32 *)t__2e179);
+	t__2e194 = (u64)(u32)(((u32)t_tag_2e186 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e194) goto L_member_2e191; else goto L__2e193;
+	L__2e193:;
+	t__2e196 = (u64)(u32)(((u32)t_tag_2e186 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e196) goto L_member_2e192; else goto L__2e195;
+	L__2e195:;
+	goto L_matches_2e190;
+	L_member_2e191:;
+	goto L_matches_2e190;
+	L_member_2e192:;
+	goto L_matches_2e189;
+	L_matches_2e189:;
+	goto L__2e187;
+	L_matches_2e190:;
+	t_abortsite_2e106 = ((u64)6UL);
+	goto L_abort_2e107;
+	L__2e197:;
+	L__2e188:;
+	t_abortsite_2e106 = ((u64)7UL);
+	goto L_abort_2e114;
+	L__2e187:;
+	*(u32 *)t_object_2e200 = (u32)((u64)3532310079UL);
+	t__2e201 = (u64)((u64)t_object_2e200 + (u64)((u64)4UL));
+	*(u32 *)t__2e201 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e204 = (u64)((u64)0UL);
+	t__2e205 = (u64)((u64)t_object_2e204 + (u64)((u64)8UL));
+	*(u64 *)t__2e205 = (u64)((u64)0UL);
+	t__2e205 = (u64)((u64)t__2e205 + (u64)((u64)8UL));
+	*(u64 *)t__2e205 = (u64)((u64)0UL);
+	BLIT((u64)B83, t_object_2e200, 8);
+	BLIT((u64)B84, ((u64)((char *)&D_strliteral_2e203)), 24);
+	BLIT((u64)B85, t_object_2e204, 24);
+	t__2e199 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R86, (u64)B83, (u64)B84, (u64)B85);
+	t_tag_2e206 = (u64)(*(u32 *)t__2e199);
+	t__2e214 = (u64)(u32)(((u32)t_tag_2e206 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e214) goto L_member_2e211; else goto L__2e213;
+	L__2e213:;
+	t__2e216 = (u64)(u32)(((u32)t_tag_2e206 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e216) goto L_member_2e212; else goto L__2e215;
+	L__2e215:;
+	goto L_matches_2e210;
+	L_member_2e211:;
+	goto L_matches_2e210;
+	L_member_2e212:;
+	goto L_matches_2e209;
+	L_matches_2e209:;
+	goto L__2e207;
+	L_matches_2e210:;
+	t_abortsite_2e106 = ((u64)8UL);
+	goto L_abort_2e107;
+	L__2e217:;
+	L__2e208:;
+	t_abortsite_2e106 = ((u64)9UL);
+	goto L_abort_2e114;
+	L__2e207:;
+	*(u32 *)t_object_2e220 = (u32)((u64)3532310079UL);
+	t__2e221 = (u64)((u64)t_object_2e220 + (u64)((u64)4UL));
+	*(u32 *)t__2e221 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e224 = (u64)((u64)0UL);
+	t__2e225 = (u64)((u64)t_object_2e224 + (u64)((u64)8UL));
+	*(u64 *)t__2e225 = (u64)((u64)0UL);
+	t__2e225 = (u64)((u64)t__2e225 + (u64)((u64)8UL));
+	*(u64 *)t__2e225 = (u64)((u64)0UL);
+	BLIT((u64)B87, t_object_2e220, 8);
+	BLIT((u64)B88, ((u64)((char *)&D_strliteral_2e223)), 24);
+	BLIT((u64)B89, t_object_2e224, 24);
+	t__2e219 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R90, (u64)B87, (u64)B88, (u64)B89);
+	t_tag_2e226 = (u64)(*(u32 *)t__2e219);
+	t__2e234 = (u64)(u32)(((u32)t_tag_2e226 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e234) goto L_member_2e231; else goto L__2e233;
+	L__2e233:;
+	t__2e236 = (u64)(u32)(((u32)t_tag_2e226 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e236) goto L_member_2e232; else goto L__2e235;
+	L__2e235:;
+	goto L_matches_2e230;
+	L_member_2e231:;
+	goto L_matches_2e230;
+	L_member_2e232:;
+	goto L_matches_2e229;
+	L_matches_2e229:;
+	goto L__2e227;
+	L_matches_2e230:;
+	t_abortsite_2e106 = ((u64)10UL);
+	goto L_abort_2e107;
+	L__2e237:;
+	L__2e228:;
+	t_abortsite_2e106 = ((u64)11UL);
+	goto L_abort_2e114;
+	L__2e227:;
+	*(u32 *)t_object_2e240 = (u32)((u64)3532310079UL);
+	t__2e241 = (u64)((u64)t_object_2e240 + (u64)((u64)4UL));
+	*(u32 *)t__2e241 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e244 = (u64)((u64)0UL);
+	t__2e245 = (u64)((u64)t_object_2e244 + (u64)((u64)8UL));
+	*(u64 *)t__2e245 = (u64)((u64)0UL);
+	t__2e245 = (u64)((u64)t__2e245 + (u64)((u64)8UL));
+	*(u64 *)t__2e245 = (u64)((u64)0UL);
+	BLIT((u64)B91, t_object_2e240, 8);
+	BLIT((u64)B92, ((u64)((char *)&D_strliteral_2e243)), 24);
+	BLIT((u64)B93, t_object_2e244, 24);
+	t__2e239 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R94, (u64)B91, (u64)B92, (u64)B93);
+	t_tag_2e246 = (u64)(*(u32 *)t__2e239);
+	t__2e254 = (u64)(u32)(((u32)t_tag_2e246 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e254) goto L_member_2e251; else goto L__2e253;
+	L__2e253:;
+	t__2e256 = (u64)(u32)(((u32)t_tag_2e246 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e256) goto L_member_2e252; else goto L__2e255;
+	L__2e255:;
+	goto L_matches_2e250;
+	L_member_2e251:;
+	goto L_matches_2e250;
+	L_member_2e252:;
+	goto L_matches_2e249;
+	L_matches_2e249:;
+	goto L__2e247;
+	L_matches_2e250:;
+	t_abortsite_2e106 = ((u64)12UL);
+	goto L_abort_2e107;
+	L__2e257:;
+	L__2e248:;
+	t_abortsite_2e106 = ((u64)13UL);
+	goto L_abort_2e114;
+	L__2e247:;
+	*(u32 *)t_object_2e260 = (u32)((u64)3532310079UL);
+	t__2e261 = (u64)((u64)t_object_2e260 + (u64)((u64)4UL));
+	*(u32 *)t__2e261 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e264 = (u64)((u64)0UL);
+	t__2e265 = (u64)((u64)t_object_2e264 + (u64)((u64)8UL));
+	*(u64 *)t__2e265 = (u64)((u64)0UL);
+	t__2e265 = (u64)((u64)t__2e265 + (u64)((u64)8UL));
+	*(u64 *)t__2e265 = (u64)((u64)0UL);
+	BLIT((u64)B95, t_object_2e260, 8);
+	BLIT((u64)B96, ((u64)((char *)&D_strliteral_2e263)), 24);
+	BLIT((u64)B97, t_object_2e264, 24);
+	t__2e259 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R98, (u64)B95, (u64)B96, (u64)B97);
+	t_tag_2e266 = (u64)(*(u32 *)t__2e259);
+	t__2e274 = (u64)(u32)(((u32)t_tag_2e266 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e274) goto L_member_2e271; else goto L__2e273;
+	L__2e273:;
+	t__2e276 = (u64)(u32)(((u32)t_tag_2e266 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e276) goto L_member_2e272; else goto L__2e275;
+	L__2e275:;
+	goto L_matches_2e270;
+	L_member_2e271:;
+	goto L_matches_2e270;
+	L_member_2e272:;
+	goto L_matches_2e269;
+	L_matches_2e269:;
+	goto L__2e267;
+	L_matches_2e270:;
+	t_abortsite_2e106 = ((u64)14UL);
+	goto L_abort_2e107;
+	L__2e277:;
+	L__2e268:;
+	t_abortsite_2e106 = ((u64)15UL);
+	goto L_abort_2e114;
+	L__2e267:;
+	*(u32 *)t_object_2e280 = (u32)((u64)3532310079UL);
+	t__2e281 = (u64)((u64)t_object_2e280 + (u64)((u64)4UL));
+	*(u32 *)t__2e281 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e284 = (u64)((u64)0UL);
+	t__2e285 = (u64)((u64)t_object_2e284 + (u64)((u64)8UL));
+	*(u64 *)t__2e285 = (u64)((u64)0UL);
+	t__2e285 = (u64)((u64)t__2e285 + (u64)((u64)8UL));
+	*(u64 *)t__2e285 = (u64)((u64)0UL);
+	BLIT((u64)B99, t_object_2e280, 8);
+	BLIT((u64)B100, ((u64)((char *)&D_strliteral_2e283)), 24);
+	BLIT((u64)B101, t_object_2e284, 24);
+	t__2e279 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R102, (u64)B99, (u64)B100, (u64)B101);
+	t_tag_2e286 = (u64)(*(u32 *)t__2e279);
+	t__2e294 = (u64)(u32)(((u32)t_tag_2e286 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e294) goto L_member_2e291; else goto L__2e293;
+	L__2e293:;
+	t__2e296 = (u64)(u32)(((u32)t_tag_2e286 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e296) goto L_member_2e292; else goto L__2e295;
+	L__2e295:;
+	goto L_matches_2e290;
+	L_member_2e291:;
+	goto L_matches_2e290;
+	L_member_2e292:;
+	goto L_matches_2e289;
+	L_matches_2e289:;
+	goto L__2e287;
+	L_matches_2e290:;
+	t_abortsite_2e106 = ((u64)16UL);
+	goto L_abort_2e107;
+	L__2e297:;
+	L__2e288:;
+	t_abortsite_2e106 = ((u64)17UL);
+	goto L_abort_2e114;
+	L__2e287:;
+	*(u32 *)t_object_2e300 = (u32)((u64)3532310079UL);
+	t__2e301 = (u64)((u64)t_object_2e300 + (u64)((u64)4UL));
+	*(u32 *)t__2e301 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e304 = (u64)((u64)0UL);
+	t__2e305 = (u64)((u64)t_object_2e304 + (u64)((u64)8UL));
+	*(u64 *)t__2e305 = (u64)((u64)0UL);
+	t__2e305 = (u64)((u64)t__2e305 + (u64)((u64)8UL));
+	*(u64 *)t__2e305 = (u64)((u64)0UL);
+	BLIT((u64)B103, t_object_2e300, 8);
+	BLIT((u64)B104, ((u64)((char *)&D_strliteral_2e303)), 24);
+	BLIT((u64)B105, t_object_2e304, 24);
+	t__2e299 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R106, (u64)B103, (u64)B104, (u64)B105);
+	t_tag_2e306 = (u64)(*(u32 *)t__2e299);
+	t__2e314 = (u64)(u32)(((u32)t_tag_2e306 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e314) goto L_member_2e311; else goto L__2e313;
+	L__2e313:;
+	t__2e316 = (u64)(u32)(((u32)t_tag_2e306 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e316) goto L_member_2e312; else goto L__2e315;
+	L__2e315:;
+	goto L_matches_2e310;
+	L_member_2e311:;
+	goto L_matches_2e310;
+	L_member_2e312:;
+	goto L_matches_2e309;
+	L_matches_2e309:;
+	goto L__2e307;
+	L_matches_2e310:;
+	t_abortsite_2e106 = ((u64)18UL);
+	goto L_abort_2e107;
+	L__2e317:;
+	L__2e308:;
+	t_abortsite_2e106 = ((u64)19UL);
+	goto L_abort_2e114;
+	L__2e307:;
+	*(u32 *)t_object_2e320 = (u32)((u64)3532310079UL);
+	t__2e321 = (u64)((u64)t_object_2e320 + (u64)((u64)4UL));
+	*(u32 *)t__2e321 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e324 = (u64)((u64)0UL);
+	t__2e325 = (u64)((u64)t_object_2e324 + (u64)((u64)8UL));
+	*(u64 *)t__2e325 = (u64)((u64)0UL);
+	t__2e325 = (u64)((u64)t__2e325 + (u64)((u64)8UL));
+	*(u64 *)t__2e325 = (u64)((u64)0UL);
+	BLIT((u64)B107, t_object_2e320, 8);
+	BLIT((u64)B108, ((u64)((char *)&D_strliteral_2e323)), 24);
+	BLIT((u64)B109, t_object_2e324, 24);
+	t__2e319 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R110, (u64)B107, (u64)B108, (u64)B109);
+	t_tag_2e326 = (u64)(*(u32 *)t__2e319);
+	t__2e334 = (u64)(u32)(((u32)t_tag_2e326 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e334) goto L_member_2e331; else goto L__2e333;
+	L__2e333:;
+	t__2e336 = (u64)(u32)(((u32)t_tag_2e326 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e336) goto L_member_2e332; else goto L__2e335;
+	L__2e335:;
+	goto L_matches_2e330;
+	L_member_2e331:;
+	goto L_matches_2e330;
+	L_member_2e332:;
+	goto L_matches_2e329;
+	L_matches_2e329:;
+	goto L__2e327;
+	L_matches_2e330:;
+	t_abortsite_2e106 = ((u64)20UL);
+	goto L_abort_2e107;
+	L__2e337:;
+	L__2e328:;
+	t_abortsite_2e106 = ((u64)21UL);
+	goto L_abort_2e114;
+	L__2e327:;
+	*(u32 *)t_object_2e340 = (u32)((u64)3532310079UL);
+	t__2e341 = (u64)((u64)t_object_2e340 + (u64)((u64)4UL));
+	*(u32 *)t__2e341 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e344 = (u64)((u64)0UL);
+	t__2e345 = (u64)((u64)t_object_2e344 + (u64)((u64)8UL));
+	*(u64 *)t__2e345 = (u64)((u64)0UL);
+	t__2e345 = (u64)((u64)t__2e345 + (u64)((u64)8UL));
+	*(u64 *)t__2e345 = (u64)((u64)0UL);
+	BLIT((u64)B111, t_object_2e340, 8);
+	BLIT((u64)B112, ((u64)((char *)&D_strliteral_2e343)), 24);
+	BLIT((u64)B113, t_object_2e344, 24);
+	t__2e339 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R114, (u64)B111, (u64)B112, (u64)B113);
+	t_tag_2e346 = (u64)(*(u32 *)t__2e339);
+	t__2e354 = (u64)(u32)(((u32)t_tag_2e346 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e354) goto L_member_2e351; else goto L__2e353;
+	L__2e353:;
+	t__2e356 = (u64)(u32)(((u32)t_tag_2e346 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e356) goto L_member_2e352; else goto L__2e355;
+	L__2e355:;
+	goto L_matches_2e350;
+	L_member_2e351:;
+	goto L_matches_2e350;
+	L_member_2e352:;
+	goto L_matches_2e349;
+	L_matches_2e349:;
+	goto L__2e347;
+	L_matches_2e350:;
+	t_abortsite_2e106 = ((u64)22UL);
+	goto L_abort_2e107;
+	L__2e357:;
+	L__2e348:;
+	t_abortsite_2e106 = ((u64)23UL);
+	goto L_abort_2e114;
+	L__2e347:;
+	*(u32 *)t_object_2e360 = (u32)((u64)3532310079UL);
+	t__2e361 = (u64)((u64)t_object_2e360 + (u64)((u64)4UL));
+	*(u32 *)t__2e361 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e364 = (u64)((u64)0UL);
+	t__2e365 = (u64)((u64)t_object_2e364 + (u64)((u64)8UL));
+	*(u64 *)t__2e365 = (u64)((u64)0UL);
+	t__2e365 = (u64)((u64)t__2e365 + (u64)((u64)8UL));
+	*(u64 *)t__2e365 = (u64)((u64)0UL);
+	BLIT((u64)B115, t_object_2e360, 8);
+	BLIT((u64)B116, ((u64)((char *)&D_strliteral_2e363)), 24);
+	BLIT((u64)B117, t_object_2e364, 24);
+	t__2e359 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R118, (u64)B115, (u64)B116, (u64)B117);
+	t_tag_2e366 = (u64)(*(u32 *)t__2e359);
+	t__2e374 = (u64)(u32)(((u32)t_tag_2e366 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e374) goto L_member_2e371; else goto L__2e373;
+	L__2e373:;
+	t__2e376 = (u64)(u32)(((u32)t_tag_2e366 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e376) goto L_member_2e372; else goto L__2e375;
+	L__2e375:;
+	goto L_matches_2e370;
+	L_member_2e371:;
+	goto L_matches_2e370;
+	L_member_2e372:;
+	goto L_matches_2e369;
+	L_matches_2e369:;
+	goto L__2e367;
+	L_matches_2e370:;
+	t_abortsite_2e106 = ((u64)24UL);
+	goto L_abort_2e107;
+	L__2e377:;
+	L__2e368:;
+	t_abortsite_2e106 = ((u64)25UL);
+	goto L_abort_2e114;
+	L__2e367:;
+	*(u32 *)t_object_2e380 = (u32)((u64)3532310079UL);
+	t__2e381 = (u64)((u64)t_object_2e380 + (u64)((u64)4UL));
+	*(u32 *)t__2e381 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e384 = (u64)((u64)0UL);
+	t__2e385 = (u64)((u64)t_object_2e384 + (u64)((u64)8UL));
+	*(u64 *)t__2e385 = (u64)((u64)0UL);
+	t__2e385 = (u64)((u64)t__2e385 + (u64)((u64)8UL));
+	*(u64 *)t__2e385 = (u64)((u64)0UL);
+	BLIT((u64)B119, t_object_2e380, 8);
+	BLIT((u64)B120, ((u64)((char *)&D_strliteral_2e383)), 24);
+	BLIT((u64)B121, t_object_2e384, 24);
+	t__2e379 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R122, (u64)B119, (u64)B120, (u64)B121);
+	t_tag_2e386 = (u64)(*(u32 *)t__2e379);
+	t__2e394 = (u64)(u32)(((u32)t_tag_2e386 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e394) goto L_member_2e391; else goto L__2e393;
+	L__2e393:;
+	t__2e396 = (u64)(u32)(((u32)t_tag_2e386 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e396) goto L_member_2e392; else goto L__2e395;
+	L__2e395:;
+	goto L_matches_2e390;
+	L_member_2e391:;
+	goto L_matches_2e390;
+	L_member_2e392:;
+	goto L_matches_2e389;
+	L_matches_2e389:;
+	goto L__2e387;
+	L_matches_2e390:;
+	t_abortsite_2e106 = ((u64)26UL);
+	goto L_abort_2e107;
+	L__2e397:;
+	L__2e388:;
+	t_abortsite_2e106 = ((u64)27UL);
+	goto L_abort_2e114;
+	L__2e387:;
+	*(u32 *)t_object_2e400 = (u32)((u64)3532310079UL);
+	t__2e401 = (u64)((u64)t_object_2e400 + (u64)((u64)4UL));
+	*(u32 *)t__2e401 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e404 = (u64)((u64)0UL);
+	t__2e405 = (u64)((u64)t_object_2e404 + (u64)((u64)8UL));
+	*(u64 *)t__2e405 = (u64)((u64)0UL);
+	t__2e405 = (u64)((u64)t__2e405 + (u64)((u64)8UL));
+	*(u64 *)t__2e405 = (u64)((u64)0UL);
+	BLIT((u64)B123, t_object_2e400, 8);
+	BLIT((u64)B124, ((u64)((char *)&D_strliteral_2e403)), 24);
+	BLIT((u64)B125, t_object_2e404, 24);
+	t__2e399 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R126, (u64)B123, (u64)B124, (u64)B125);
+	t_tag_2e406 = (u64)(*(u32 *)t__2e399);
+	t__2e414 = (u64)(u32)(((u32)t_tag_2e406 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e414) goto L_member_2e411; else goto L__2e413;
+	L__2e413:;
+	t__2e416 = (u64)(u32)(((u32)t_tag_2e406 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e416) goto L_member_2e412; else goto L__2e415;
+	L__2e415:;
+	goto L_matches_2e410;
+	L_member_2e411:;
+	goto L_matches_2e410;
+	L_member_2e412:;
+	goto L_matches_2e409;
+	L_matches_2e409:;
+	goto L__2e407;
+	L_matches_2e410:;
+	t_abortsite_2e106 = ((u64)28UL);
+	goto L_abort_2e107;
+	L__2e417:;
+	L__2e408:;
+	t_abortsite_2e106 = ((u64)29UL);
+	goto L_abort_2e114;
+	L__2e407:;
+	*(u32 *)t_object_2e420 = (u32)((u64)3532310079UL);
+	t__2e421 = (u64)((u64)t_object_2e420 + (u64)((u64)4UL));
+	*(u32 *)t__2e421 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e424 = (u64)((u64)0UL);
+	t__2e425 = (u64)((u64)t_object_2e424 + (u64)((u64)8UL));
+	*(u64 *)t__2e425 = (u64)((u64)0UL);
+	t__2e425 = (u64)((u64)t__2e425 + (u64)((u64)8UL));
+	*(u64 *)t__2e425 = (u64)((u64)0UL);
+	BLIT((u64)B127, t_object_2e420, 8);
+	BLIT((u64)B128, ((u64)((char *)&D_strliteral_2e423)), 24);
+	BLIT((u64)B129, t_object_2e424, 24);
+	t__2e419 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R130, (u64)B127, (u64)B128, (u64)B129);
+	t_tag_2e426 = (u64)(*(u32 *)t__2e419);
+	t__2e434 = (u64)(u32)(((u32)t_tag_2e426 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e434) goto L_member_2e431; else goto L__2e433;
+	L__2e433:;
+	t__2e436 = (u64)(u32)(((u32)t_tag_2e426 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e436) goto L_member_2e432; else goto L__2e435;
+	L__2e435:;
+	goto L_matches_2e430;
+	L_member_2e431:;
+	goto L_matches_2e430;
+	L_member_2e432:;
+	goto L_matches_2e429;
+	L_matches_2e429:;
+	goto L__2e427;
+	L_matches_2e430:;
+	t_abortsite_2e106 = ((u64)30UL);
+	goto L_abort_2e107;
+	L__2e437:;
+	L__2e428:;
+	t_abortsite_2e106 = ((u64)31UL);
+	goto L_abort_2e114;
+	L__2e427:;
+	*(u32 *)t_object_2e440 = (u32)((u64)3532310079UL);
+	t__2e441 = (u64)((u64)t_object_2e440 + (u64)((u64)4UL));
+	*(u32 *)t__2e441 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e444 = (u64)((u64)0UL);
+	t__2e445 = (u64)((u64)t_object_2e444 + (u64)((u64)8UL));
+	*(u64 *)t__2e445 = (u64)((u64)0UL);
+	t__2e445 = (u64)((u64)t__2e445 + (u64)((u64)8UL));
+	*(u64 *)t__2e445 = (u64)((u64)0UL);
+	BLIT((u64)B131, t_object_2e440, 8);
+	BLIT((u64)B132, ((u64)((char *)&D_strliteral_2e443)), 24);
+	BLIT((u64)B133, t_object_2e444, 24);
+	t__2e439 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R134, (u64)B131, (u64)B132, (u64)B133);
+	t_tag_2e446 = (u64)(*(u32 *)t__2e439);
+	t__2e454 = (u64)(u32)(((u32)t_tag_2e446 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e454) goto L_member_2e451; else goto L__2e453;
+	L__2e453:;
+	t__2e456 = (u64)(u32)(((u32)t_tag_2e446 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e456) goto L_member_2e452; else goto L__2e455;
+	L__2e455:;
+	goto L_matches_2e450;
+	L_member_2e451:;
+	goto L_matches_2e450;
+	L_member_2e452:;
+	goto L_matches_2e449;
+	L_matches_2e449:;
+	goto L__2e447;
+	L_matches_2e450:;
+	t_abortsite_2e106 = ((u64)32UL);
+	goto L_abort_2e107;
+	L__2e457:;
+	L__2e448:;
+	t_abortsite_2e106 = ((u64)33UL);
+	goto L_abort_2e114;
+	L__2e447:;
+	t__2e459 = ((u64)0UL);
+	*(u64 *)t_binding_2e458 = (u64)t__2e459;
+	*(u64 *)t_binding_2e458 = (u64)t_binding_2e121;
+	t__2e461 = (u64)(*(u64 *)t_binding_2e458);
+	*(u64 *)t_binding_2e460 = (u64)t__2e461;
+	t_item_2e465 = (u64)((u64)t_object_2e463 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e465 = (u32)((u64)1UL);
+	t_item_2e465 = (u64)((u64)t_object_2e463 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e465 = (u32)((u64)2UL);
+	t_item_2e465 = (u64)((u64)t_object_2e463 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e465 = (u32)((u64)3UL);
+	*(u64 *)t_binding_2e462 = (u64)t_object_2e463;
+	t__2e466 = (u64)((u64)t_binding_2e462 + (u64)((u64)8UL));
+	*(u64 *)t__2e466 = (u64)((u64)3UL);
+	t__2e466 = (u64)((u64)t__2e466 + (u64)((u64)8UL));
+	*(u64 *)t__2e466 = (u64)((u64)3UL);
+	BLIT(t_binding_2e467, t_binding_2e462, ((u64)24UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t__2e470, (u64)((u64)0UL), (u64)((u64)8UL));
+	*(u64 *)t_binding_2e469 = (u64)t__2e470;
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t__2e475, (u64)((u64)0UL), (u64)((u64)8UL));
+	*(u64 *)t_binding_2e474 = (u64)t__2e475;
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t__2e479, (u64)((u64)0UL), (u64)((u64)8UL));
+	*(u64 *)t_binding_2e478 = (u64)t__2e479;
+	*(u32 *)t_object_2e484 = (u32)((u64)3532310079UL);
+	t__2e485 = (u64)((u64)t_object_2e484 + (u64)((u64)4UL));
+	*(u32 *)t__2e485 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e488 = (u64)((u64)0UL);
+	t__2e489 = (u64)((u64)t_object_2e488 + (u64)((u64)8UL));
+	*(u64 *)t__2e489 = (u64)((u64)0UL);
+	t__2e489 = (u64)((u64)t__2e489 + (u64)((u64)8UL));
+	*(u64 *)t__2e489 = (u64)((u64)0UL);
+	BLIT((u64)B135, t_object_2e484, 8);
+	BLIT((u64)B136, ((u64)((char *)&D_strliteral_2e487)), 24);
+	BLIT((u64)B137, t_object_2e488, 24);
+	t__2e483 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R138, (u64)B135, (u64)B136, (u64)B137);
+	t_tag_2e490 = (u64)(*(u32 *)t__2e483);
+	t__2e498 = (u64)(u32)(((u32)t_tag_2e490 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e498) goto L_member_2e495; else goto L__2e497;
+	L__2e497:;
+	t__2e500 = (u64)(u32)(((u32)t_tag_2e490 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e500) goto L_member_2e496; else goto L__2e499;
+	L__2e499:;
+	goto L_matches_2e494;
+	L_member_2e495:;
+	goto L_matches_2e494;
+	L_member_2e496:;
+	goto L_matches_2e493;
+	L_matches_2e493:;
+	goto L__2e491;
+	L_matches_2e494:;
+	t_abortsite_2e106 = ((u64)34UL);
+	goto L_abort_2e107;
+	L__2e501:;
+	L__2e492:;
+	t_abortsite_2e106 = ((u64)35UL);
+	goto L_abort_2e114;
+	L__2e491:;
+	*(u32 *)t_object_2e504 = (u32)((u64)3532310079UL);
+	t__2e505 = (u64)((u64)t_object_2e504 + (u64)((u64)4UL));
+	*(u32 *)t__2e505 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e508 = (u64)((u64)0UL);
+	t__2e509 = (u64)((u64)t_object_2e508 + (u64)((u64)8UL));
+	*(u64 *)t__2e509 = (u64)((u64)0UL);
+	t__2e509 = (u64)((u64)t__2e509 + (u64)((u64)8UL));
+	*(u64 *)t__2e509 = (u64)((u64)0UL);
+	BLIT((u64)B139, t_object_2e504, 8);
+	BLIT((u64)B140, ((u64)((char *)&D_strliteral_2e507)), 24);
+	BLIT((u64)B141, t_object_2e508, 24);
+	t__2e503 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R142, (u64)B139, (u64)B140, (u64)B141);
+	t_tag_2e510 = (u64)(*(u32 *)t__2e503);
+	t__2e518 = (u64)(u32)(((u32)t_tag_2e510 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e518) goto L_member_2e515; else goto L__2e517;
+	L__2e517:;
+	t__2e520 = (u64)(u32)(((u32)t_tag_2e510 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e520) goto L_member_2e516; else goto L__2e519;
+	L__2e519:;
+	goto L_matches_2e514;
+	L_member_2e515:;
+	goto L_matches_2e514;
+	L_member_2e516:;
+	goto L_matches_2e513;
+	L_matches_2e513:;
+	goto L__2e511;
+	L_matches_2e514:;
+	t_abortsite_2e106 = ((u64)36UL);
+	goto L_abort_2e107;
+	L__2e521:;
+	L__2e512:;
+	t_abortsite_2e106 = ((u64)37UL);
+	goto L_abort_2e114;
+	L__2e511:;
+	*(u32 *)t_object_2e524 = (u32)((u64)3532310079UL);
+	t__2e525 = (u64)((u64)t_object_2e524 + (u64)((u64)4UL));
+	*(u32 *)t__2e525 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e528 = (u64)((u64)0UL);
+	t__2e529 = (u64)((u64)t_object_2e528 + (u64)((u64)8UL));
+	*(u64 *)t__2e529 = (u64)((u64)0UL);
+	t__2e529 = (u64)((u64)t__2e529 + (u64)((u64)8UL));
+	*(u64 *)t__2e529 = (u64)((u64)0UL);
+	BLIT((u64)B143, t_object_2e524, 8);
+	BLIT((u64)B144, ((u64)((char *)&D_strliteral_2e527)), 24);
+	BLIT((u64)B145, t_object_2e528, 24);
+	t__2e523 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R146, (u64)B143, (u64)B144, (u64)B145);
+	t_tag_2e530 = (u64)(*(u32 *)t__2e523);
+	t__2e538 = (u64)(u32)(((u32)t_tag_2e530 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e538) goto L_member_2e535; else goto L__2e537;
+	L__2e537:;
+	t__2e540 = (u64)(u32)(((u32)t_tag_2e530 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e540) goto L_member_2e536; else goto L__2e539;
+	L__2e539:;
+	goto L_matches_2e534;
+	L_member_2e535:;
+	goto L_matches_2e534;
+	L_member_2e536:;
+	goto L_matches_2e533;
+	L_matches_2e533:;
+	goto L__2e531;
+	L_matches_2e534:;
+	t_abortsite_2e106 = ((u64)38UL);
+	goto L_abort_2e107;
+	L__2e541:;
+	L__2e532:;
+	t_abortsite_2e106 = ((u64)39UL);
+	goto L_abort_2e114;
+	L__2e531:;
+	*(u32 *)t_object_2e544 = (u32)((u64)3532310079UL);
+	t__2e545 = (u64)((u64)t_object_2e544 + (u64)((u64)4UL));
+	*(u32 *)t__2e545 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e548 = (u64)((u64)0UL);
+	t__2e549 = (u64)((u64)t_object_2e548 + (u64)((u64)8UL));
+	*(u64 *)t__2e549 = (u64)((u64)0UL);
+	t__2e549 = (u64)((u64)t__2e549 + (u64)((u64)8UL));
+	*(u64 *)t__2e549 = (u64)((u64)0UL);
+	BLIT((u64)B147, t_object_2e544, 8);
+	BLIT((u64)B148, ((u64)((char *)&D_strliteral_2e547)), 24);
+	BLIT((u64)B149, t_object_2e548, 24);
+	t__2e543 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R150, (u64)B147, (u64)B148, (u64)B149);
+	t_tag_2e550 = (u64)(*(u32 *)t__2e543);
+	t__2e558 = (u64)(u32)(((u32)t_tag_2e550 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e558) goto L_member_2e555; else goto L__2e557;
+	L__2e557:;
+	t__2e560 = (u64)(u32)(((u32)t_tag_2e550 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e560) goto L_member_2e556; else goto L__2e559;
+	L__2e559:;
+	goto L_matches_2e554;
+	L_member_2e555:;
+	goto L_matches_2e554;
+	L_member_2e556:;
+	goto L_matches_2e553;
+	L_matches_2e553:;
+	goto L__2e551;
+	L_matches_2e554:;
+	t_abortsite_2e106 = ((u64)40UL);
+	goto L_abort_2e107;
+	L__2e561:;
+	L__2e552:;
+	t_abortsite_2e106 = ((u64)41UL);
+	goto L_abort_2e114;
+	L__2e551:;
+	*(u32 *)t_object_2e564 = (u32)((u64)3532310079UL);
+	t__2e565 = (u64)((u64)t_object_2e564 + (u64)((u64)4UL));
+	*(u32 *)t__2e565 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e568 = (u64)((u64)0UL);
+	t__2e569 = (u64)((u64)t_object_2e568 + (u64)((u64)8UL));
+	*(u64 *)t__2e569 = (u64)((u64)0UL);
+	t__2e569 = (u64)((u64)t__2e569 + (u64)((u64)8UL));
+	*(u64 *)t__2e569 = (u64)((u64)0UL);
+	BLIT((u64)B151, t_object_2e564, 8);
+	BLIT((u64)B152, ((u64)((char *)&D_strliteral_2e567)), 24);
+	BLIT((u64)B153, t_object_2e568, 24);
+	t__2e563 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R154, (u64)B151, (u64)B152, (u64)B153);
+	t_tag_2e570 = (u64)(*(u32 *)t__2e563);
+	t__2e578 = (u64)(u32)(((u32)t_tag_2e570 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e578) goto L_member_2e575; else goto L__2e577;
+	L__2e577:;
+	t__2e580 = (u64)(u32)(((u32)t_tag_2e570 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e580) goto L_member_2e576; else goto L__2e579;
+	L__2e579:;
+	goto L_matches_2e574;
+	L_member_2e575:;
+	goto L_matches_2e574;
+	L_member_2e576:;
+	goto L_matches_2e573;
+	L_matches_2e573:;
+	goto L__2e571;
+	L_matches_2e574:;
+	t_abortsite_2e106 = ((u64)42UL);
+	goto L_abort_2e107;
+	L__2e581:;
+	L__2e572:;
+	t_abortsite_2e106 = ((u64)43UL);
+	goto L_abort_2e114;
+	L__2e571:;
+	*(u32 *)t_object_2e584 = (u32)((u64)3532310079UL);
+	t__2e585 = (u64)((u64)t_object_2e584 + (u64)((u64)4UL));
+	*(u32 *)t__2e585 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e588 = (u64)((u64)0UL);
+	t__2e589 = (u64)((u64)t_object_2e588 + (u64)((u64)8UL));
+	*(u64 *)t__2e589 = (u64)((u64)0UL);
+	t__2e589 = (u64)((u64)t__2e589 + (u64)((u64)8UL));
+	*(u64 *)t__2e589 = (u64)((u64)0UL);
+	BLIT((u64)B155, t_object_2e584, 8);
+	BLIT((u64)B156, ((u64)((char *)&D_strliteral_2e587)), 24);
+	BLIT((u64)B157, t_object_2e588, 24);
+	t__2e583 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R158, (u64)B155, (u64)B156, (u64)B157);
+	t_tag_2e590 = (u64)(*(u32 *)t__2e583);
+	t__2e598 = (u64)(u32)(((u32)t_tag_2e590 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e598) goto L_member_2e595; else goto L__2e597;
+	L__2e597:;
+	t__2e600 = (u64)(u32)(((u32)t_tag_2e590 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e600) goto L_member_2e596; else goto L__2e599;
+	L__2e599:;
+	goto L_matches_2e594;
+	L_member_2e595:;
+	goto L_matches_2e594;
+	L_member_2e596:;
+	goto L_matches_2e593;
+	L_matches_2e593:;
+	goto L__2e591;
+	L_matches_2e594:;
+	t_abortsite_2e106 = ((u64)44UL);
+	goto L_abort_2e107;
+	L__2e601:;
+	L__2e592:;
+	t_abortsite_2e106 = ((u64)45UL);
+	goto L_abort_2e114;
+	L__2e591:;
+	*(u32 *)t_binding_2e602 = (u32)((u64)10UL);
+	t__2e604 = (u64)(u32)(*(i32 *)t_binding_2e602);
+	*(u32 *)t_binding_2e603 = (u32)t__2e604;
+	goto L__2e50;
+	L__2e605:;
+	L__2e50:;
+	return;
+	L_abort_2e107:;
+	t__2e108 = (u64)((u64)t_abortsite_2e106 * (u64)((u64)16UL));
+	t__2e108 = (u64)((u64)((u64)((char *)&D_abortsites_2e105)) + (u64)t__2e108);
+	t__2e109 = (u64)(*(u64 *)t__2e108);
+	t__2e110 = (u64)((u64)t__2e108 + (u64)((u64)8UL));
+	t__2e111 = (u64)(*(u32 *)t__2e110);
+	t__2e110 = (u64)((u64)t__2e108 + (u64)((u64)12UL));
+	t__2e112 = (u64)(*(u32 *)t__2e110);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e109, (u64)t__2e111, (u64)t__2e112, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e114:;
+	t__2e115 = (u64)((u64)t_abortsite_2e106 * (u64)((u64)16UL));
+	t__2e115 = (u64)((u64)((u64)((char *)&D_abortsites_2e105)) + (u64)t__2e115);
+	t__2e116 = (u64)(*(u64 *)t__2e115);
+	t__2e117 = (u64)((u64)t__2e115 + (u64)((u64)8UL));
+	t__2e118 = (u64)(*(u32 *)t__2e117);
+	t__2e117 = (u64)((u64)t__2e115 + (u64)((u64)12UL));
+	t__2e119 = (u64)(*(u32 *)t__2e117);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e116, (u64)t__2e118, (u64)t__2e119, (u64)((u64)4UL));
+	__builtin_trap();
+}
@@ -0,0 +1,3991 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2ememset[] __asm__("rt.memset");
+extern char X_rt_2estrcmp[] __asm__("rt.strcmp");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e48 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; };
+struct __attribute__((packed)) S_static_2e3 { u8 f0; u8 f1[3]; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e186 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_g1 { u32 f0; u8 f1; u8 f2[3]; u32 f3; u32 f4; u32 f5; u8 f6[4]; u32 f7; u8 f8[0]; u32 f9; u8 f10[4]; u64 f11; u64 f12; u64 f13; u32 f14; u8 f15[4]; u64 f16; };
+struct __attribute__((packed)) S_strdata_2e249 { u8 f0[31]; };
+struct __attribute__((packed)) S_strliteral_2e250 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e285 { u8 f0[30]; };
+struct __attribute__((packed)) S_strliteral_2e286 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e304 { u8 f0[73]; };
+struct __attribute__((packed)) S_strliteral_2e305 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e306 { u8 f0; u8 f1; u8 f2[40]; u8 f3; u8 f4; u8 f5; u8 f6[18]; u8 f7; u8 f8; u8 f9; u8 f10[46]; u8 f11; u8 f12; u8 f13[2]; u8 f14; u8 f15; };
+struct __attribute__((packed)) S_strliteral_2e307 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e308 { u8 f0[61]; };
+struct __attribute__((packed)) S_strliteral_2e309 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e310 { u8 f0[86]; };
+struct __attribute__((packed)) S_strliteral_2e311 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e312 { u8 f0[85]; };
+struct __attribute__((packed)) S_strliteral_2e313 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e314 { u8 f0[321]; };
+struct __attribute__((packed)) S_strliteral_2e315 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e316 { u8 f0[46]; };
+struct __attribute__((packed)) S_strliteral_2e317 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e318 { u8 f0[66]; };
+struct __attribute__((packed)) S_strliteral_2e319 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e320 { u8 f0[66]; };
+struct __attribute__((packed)) S_strliteral_2e321 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e322 { u8 f0[65]; };
+struct __attribute__((packed)) S_strliteral_2e323 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e324 { u8 f0[69]; };
+struct __attribute__((packed)) S_strliteral_2e325 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e326 { u8 f0[38]; };
+struct __attribute__((packed)) S_strliteral_2e327 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e328 { u8 f0[77]; };
+struct __attribute__((packed)) S_strliteral_2e329 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e330 { u8 f0[48]; };
+struct __attribute__((packed)) S_strliteral_2e331 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e332 { u8 f0[38]; };
+struct __attribute__((packed)) S_strliteral_2e333 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e334 { u8 f0[80]; };
+struct __attribute__((packed)) S_strliteral_2e335 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e336 { u8 f0[84]; };
+struct __attribute__((packed)) S_strliteral_2e337 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e338 { u8 f0[104]; };
+struct __attribute__((packed)) S_strliteral_2e339 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e340 { u8 f0[75]; };
+struct __attribute__((packed)) S_strliteral_2e341 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e342 { u8 f0[89]; };
+struct __attribute__((packed)) S_strliteral_2e343 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e344 { u8 f0[117]; };
+struct __attribute__((packed)) S_strliteral_2e345 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e346 { u8 f0[80]; };
+struct __attribute__((packed)) S_strliteral_2e347 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e348 { u8 f0[84]; };
+struct __attribute__((packed)) S_strliteral_2e349 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e350 { u8 f0[119]; };
+struct __attribute__((packed)) S_strliteral_2e351 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e352 { u8 f0[123]; };
+struct __attribute__((packed)) S_strliteral_2e353 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e354 { u8 f0[59]; };
+struct __attribute__((packed)) S_strliteral_2e355 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e356 { u8 f0[48]; };
+struct __attribute__((packed)) S_strliteral_2e357 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e266 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_strliteral_2e478 { u64 f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e409 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; };
+struct __attribute__((packed)) S_g6 { u32 f0; u8 f1; u8 f2[3]; u32 f3; u32 f4; u32 f5; u8 f6[4]; u32 f7; u8 f8[4]; u32 f9; u8 f10[4]; u64 f11; u64 f12; u64 f13; u32 f14; u8 f15[4]; u64 f16; };
+struct __attribute__((packed)) S_g5 { u32 f0; u8 f1; u8 f2[3]; u32 f3; u32 f4; u32 f5; u8 f6[4]; u32 f7; u8 f8[0]; u32 f9; u8 f10[4]; u64 f11; u64 f12; u64 f13; u32 f14; u8 f15[4]; u64 f16; };
+struct __attribute__((packed)) S_g4 { u32 f0; u8 f1; u8 f2[3]; u32 f3; u32 f4; u32 f5; u8 f6[4]; u32 f7; u8 f8[0]; u32 f9; u8 f10[4]; u64 f11; u64 f12; u64 f13; u32 f14; u8 f15[4]; u64 f16; };
+struct __attribute__((packed)) S_g3 { u32 f0; u8 f1; u8 f2[3]; u32 f3; u32 f4; u32 f5; u8 f6[4]; u32 f7; u8 f8[0]; u32 f9; u8 f10[4]; u64 f11; u64 f12; u64 f13; u32 f14; u8 f15[4]; u64 f16; };
+struct __attribute__((packed)) S_g2 { u32 f0; u8 f1; u8 f2[3]; u32 f3; u32 f4; u32 f5; u8 f6[4]; u32 f7; u8 f8[0]; u32 f9; u8 f10[4]; u64 f11; u64 f12; u64 f13; u32 f14; u8 f15[4]; u64 f16; };
+struct __attribute__((packed)) S_abortsites_2e1225 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; };
+struct __attribute__((packed)) S_abortsites_2e1308 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e1337 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; };
+struct __attribute__((packed)) S_abortsites_2e1509 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e1591 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e1640 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e1656 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e48 D_abortsites_2e48 __asm__("abortsites.48") __attribute__((used, section(".data.rel.ro.abortsites.48"), aligned(8)));
+static struct S_static_2e3 D_static_2e3 __asm__("static.3") __attribute__((used, section(".data.static.3"), aligned(8)));
+static struct S_abortsites_2e186 D_abortsites_2e186 __asm__("abortsites.186") __attribute__((used, section(".data.rel.ro.abortsites.186"), aligned(8)));
+static struct S_g1 D_g1 __asm__("g1") __attribute__((used, section(".data.g1"), aligned(8)));
+static const struct S_strdata_2e249 D_strdata_2e249 __asm__("strdata.249") __attribute__((used, section(".rodata.strdata.249"), aligned(8)));
+static struct S_strliteral_2e250 D_strliteral_2e250 __asm__("strliteral.250") __attribute__((used, section(".data.rel.ro.strliteral.250"), aligned(8)));
+static const struct S_strdata_2e285 D_strdata_2e285 __asm__("strdata.285") __attribute__((used, section(".rodata.strdata.285"), aligned(8)));
+static struct S_strliteral_2e286 D_strliteral_2e286 __asm__("strliteral.286") __attribute__((used, section(".data.rel.ro.strliteral.286"), aligned(8)));
+static const struct S_strdata_2e304 D_strdata_2e304 __asm__("strdata.304") __attribute__((used, section(".rodata.strdata.304"), aligned(8)));
+static struct S_strliteral_2e305 D_strliteral_2e305 __asm__("strliteral.305") __attribute__((used, section(".data.rel.ro.strliteral.305"), aligned(8)));
+static const struct S_strdata_2e306 D_strdata_2e306 __asm__("strdata.306") __attribute__((used, section(".rodata.strdata.306"), aligned(8)));
+static struct S_strliteral_2e307 D_strliteral_2e307 __asm__("strliteral.307") __attribute__((used, section(".data.rel.ro.strliteral.307"), aligned(8)));
+static const struct S_strdata_2e308 D_strdata_2e308 __asm__("strdata.308") __attribute__((used, section(".rodata.strdata.308"), aligned(8)));
+static struct S_strliteral_2e309 D_strliteral_2e309 __asm__("strliteral.309") __attribute__((used, section(".data.rel.ro.strliteral.309"), aligned(8)));
+static const struct S_strdata_2e310 D_strdata_2e310 __asm__("strdata.310") __attribute__((used, section(".rodata.strdata.310"), aligned(8)));
+static struct S_strliteral_2e311 D_strliteral_2e311 __asm__("strliteral.311") __attribute__((used, section(".data.rel.ro.strliteral.311"), aligned(8)));
+static const struct S_strdata_2e312 D_strdata_2e312 __asm__("strdata.312") __attribute__((used, section(".rodata.strdata.312"), aligned(8)));
+static struct S_strliteral_2e313 D_strliteral_2e313 __asm__("strliteral.313") __attribute__((used, section(".data.rel.ro.strliteral.313"), aligned(8)));
+static const struct S_strdata_2e314 D_strdata_2e314 __asm__("strdata.314") __attribute__((used, section(".rodata.strdata.314"), aligned(8)));
+static struct S_strliteral_2e315 D_strliteral_2e315 __asm__("strliteral.315") __attribute__((used, section(".data.rel.ro.strliteral.315"), aligned(8)));
+static const struct S_strdata_2e316 D_strdata_2e316 __asm__("strdata.316") __attribute__((used, section(".rodata.strdata.316"), aligned(8)));
+static struct S_strliteral_2e317 D_strliteral_2e317 __asm__("strliteral.317") __attribute__((used, section(".data.rel.ro.strliteral.317"), aligned(8)));
+static const struct S_strdata_2e318 D_strdata_2e318 __asm__("strdata.318") __attribute__((used, section(".rodata.strdata.318"), aligned(8)));
+static struct S_strliteral_2e319 D_strliteral_2e319 __asm__("strliteral.319") __attribute__((used, section(".data.rel.ro.strliteral.319"), aligned(8)));
+static const struct S_strdata_2e320 D_strdata_2e320 __asm__("strdata.320") __attribute__((used, section(".rodata.strdata.320"), aligned(8)));
+static struct S_strliteral_2e321 D_strliteral_2e321 __asm__("strliteral.321") __attribute__((used, section(".data.rel.ro.strliteral.321"), aligned(8)));
+static const struct S_strdata_2e322 D_strdata_2e322 __asm__("strdata.322") __attribute__((used, section(".rodata.strdata.322"), aligned(8)));
+static struct S_strliteral_2e323 D_strliteral_2e323 __asm__("strliteral.323") __attribute__((used, section(".data.rel.ro.strliteral.323"), aligned(8)));
+static const struct S_strdata_2e324 D_strdata_2e324 __asm__("strdata.324") __attribute__((used, section(".rodata.strdata.324"), aligned(8)));
+static struct S_strliteral_2e325 D_strliteral_2e325 __asm__("strliteral.325") __attribute__((used, section(".data.rel.ro.strliteral.325"), aligned(8)));
+static const struct S_strdata_2e326 D_strdata_2e326 __asm__("strdata.326") __attribute__((used, section(".rodata.strdata.326"), aligned(8)));
+static struct S_strliteral_2e327 D_strliteral_2e327 __asm__("strliteral.327") __attribute__((used, section(".data.rel.ro.strliteral.327"), aligned(8)));
+static const struct S_strdata_2e328 D_strdata_2e328 __asm__("strdata.328") __attribute__((used, section(".rodata.strdata.328"), aligned(8)));
+static struct S_strliteral_2e329 D_strliteral_2e329 __asm__("strliteral.329") __attribute__((used, section(".data.rel.ro.strliteral.329"), aligned(8)));
+static const struct S_strdata_2e330 D_strdata_2e330 __asm__("strdata.330") __attribute__((used, section(".rodata.strdata.330"), aligned(8)));
+static struct S_strliteral_2e331 D_strliteral_2e331 __asm__("strliteral.331") __attribute__((used, section(".data.rel.ro.strliteral.331"), aligned(8)));
+static const struct S_strdata_2e332 D_strdata_2e332 __asm__("strdata.332") __attribute__((used, section(".rodata.strdata.332"), aligned(8)));
+static struct S_strliteral_2e333 D_strliteral_2e333 __asm__("strliteral.333") __attribute__((used, section(".data.rel.ro.strliteral.333"), aligned(8)));
+static const struct S_strdata_2e334 D_strdata_2e334 __asm__("strdata.334") __attribute__((used, section(".rodata.strdata.334"), aligned(8)));
+static struct S_strliteral_2e335 D_strliteral_2e335 __asm__("strliteral.335") __attribute__((used, section(".data.rel.ro.strliteral.335"), aligned(8)));
+static const struct S_strdata_2e336 D_strdata_2e336 __asm__("strdata.336") __attribute__((used, section(".rodata.strdata.336"), aligned(8)));
+static struct S_strliteral_2e337 D_strliteral_2e337 __asm__("strliteral.337") __attribute__((used, section(".data.rel.ro.strliteral.337"), aligned(8)));
+static const struct S_strdata_2e338 D_strdata_2e338 __asm__("strdata.338") __attribute__((used, section(".rodata.strdata.338"), aligned(8)));
+static struct S_strliteral_2e339 D_strliteral_2e339 __asm__("strliteral.339") __attribute__((used, section(".data.rel.ro.strliteral.339"), aligned(8)));
+static const struct S_strdata_2e340 D_strdata_2e340 __asm__("strdata.340") __attribute__((used, section(".rodata.strdata.340"), aligned(8)));
+static struct S_strliteral_2e341 D_strliteral_2e341 __asm__("strliteral.341") __attribute__((used, section(".data.rel.ro.strliteral.341"), aligned(8)));
+static const struct S_strdata_2e342 D_strdata_2e342 __asm__("strdata.342") __attribute__((used, section(".rodata.strdata.342"), aligned(8)));
+static struct S_strliteral_2e343 D_strliteral_2e343 __asm__("strliteral.343") __attribute__((used, section(".data.rel.ro.strliteral.343"), aligned(8)));
+static const struct S_strdata_2e344 D_strdata_2e344 __asm__("strdata.344") __attribute__((used, section(".rodata.strdata.344"), aligned(8)));
+static struct S_strliteral_2e345 D_strliteral_2e345 __asm__("strliteral.345") __attribute__((used, section(".data.rel.ro.strliteral.345"), aligned(8)));
+static const struct S_strdata_2e346 D_strdata_2e346 __asm__("strdata.346") __attribute__((used, section(".rodata.strdata.346"), aligned(8)));
+static struct S_strliteral_2e347 D_strliteral_2e347 __asm__("strliteral.347") __attribute__((used, section(".data.rel.ro.strliteral.347"), aligned(8)));
+static const struct S_strdata_2e348 D_strdata_2e348 __asm__("strdata.348") __attribute__((used, section(".rodata.strdata.348"), aligned(8)));
+static struct S_strliteral_2e349 D_strliteral_2e349 __asm__("strliteral.349") __attribute__((used, section(".data.rel.ro.strliteral.349"), aligned(8)));
+static const struct S_strdata_2e350 D_strdata_2e350 __asm__("strdata.350") __attribute__((used, section(".rodata.strdata.350"), aligned(8)));
+static struct S_strliteral_2e351 D_strliteral_2e351 __asm__("strliteral.351") __attribute__((used, section(".data.rel.ro.strliteral.351"), aligned(8)));
+static const struct S_strdata_2e352 D_strdata_2e352 __asm__("strdata.352") __attribute__((used, section(".rodata.strdata.352"), aligned(8)));
+static struct S_strliteral_2e353 D_strliteral_2e353 __asm__("strliteral.353") __attribute__((used, section(".data.rel.ro.strliteral.353"), aligned(8)));
+static const struct S_strdata_2e354 D_strdata_2e354 __asm__("strdata.354") __attribute__((used, section(".rodata.strdata.354"), aligned(8)));
+static struct S_strliteral_2e355 D_strliteral_2e355 __asm__("strliteral.355") __attribute__((used, section(".data.rel.ro.strliteral.355"), aligned(8)));
+static const struct S_strdata_2e356 D_strdata_2e356 __asm__("strdata.356") __attribute__((used, section(".rodata.strdata.356"), aligned(8)));
+static struct S_strliteral_2e357 D_strliteral_2e357 __asm__("strliteral.357") __attribute__((used, section(".data.rel.ro.strliteral.357"), aligned(8)));
+static struct S_abortsites_2e266 D_abortsites_2e266 __asm__("abortsites.266") __attribute__((used, section(".data.rel.ro.abortsites.266"), aligned(8)));
+static const struct S_strliteral_2e478 D_strliteral_2e478 __asm__("strliteral.478") __attribute__((used, section(".rodata.strliteral.478"), aligned(8)));
+static struct S_abortsites_2e409 D_abortsites_2e409 __asm__("abortsites.409") __attribute__((used, section(".data.rel.ro.abortsites.409"), aligned(8)));
+static struct S_g6 D_g6 __asm__("g6") __attribute__((used, section(".bss.g6"), aligned(8)));
+static struct S_g5 D_g5 __asm__("g5") __attribute__((used, section(".data.g5"), aligned(8)));
+static struct S_g4 D_g4 __asm__("g4") __attribute__((used, section(".data.g4"), aligned(8)));
+static struct S_g3 D_g3 __asm__("g3") __attribute__((used, section(".data.g3"), aligned(8)));
+static struct S_g2 D_g2 __asm__("g2") __attribute__((used, section(".data.g2"), aligned(8)));
+static struct S_abortsites_2e1225 D_abortsites_2e1225 __asm__("abortsites.1225") __attribute__((used, section(".data.rel.ro.abortsites.1225"), aligned(8)));
+static struct S_abortsites_2e1308 D_abortsites_2e1308 __asm__("abortsites.1308") __attribute__((used, section(".data.rel.ro.abortsites.1308"), aligned(8)));
+static struct S_abortsites_2e1337 D_abortsites_2e1337 __asm__("abortsites.1337") __attribute__((used, section(".data.rel.ro.abortsites.1337"), aligned(8)));
+static struct S_abortsites_2e1509 D_abortsites_2e1509 __asm__("abortsites.1509") __attribute__((used, section(".data.rel.ro.abortsites.1509"), aligned(8)));
+static struct S_abortsites_2e1591 D_abortsites_2e1591 __asm__("abortsites.1591") __attribute__((used, section(".data.rel.ro.abortsites.1591"), aligned(8)));
+static struct S_abortsites_2e1640 D_abortsites_2e1640 __asm__("abortsites.1640") __attribute__((used, section(".data.rel.ro.abortsites.1640"), aligned(8)));
+static struct S_abortsites_2e1656 D_abortsites_2e1656 __asm__("abortsites.1656") __attribute__((used, section(".data.rel.ro.abortsites.1656"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_results(void) __asm__("results") __attribute__((used, section(".text.results")));
+static u64 F_mktuple(u64 __rp, u32 p_n) __asm__("mktuple") __attribute__((used, section(".text.mktuple")));
+static u64 F_mkpoint(u64 __rp, u32 p_n) __asm__("mkpoint") __attribute__((used, section(".text.mkpoint")));
+static void F_eval(void) __asm__("eval") __attribute__((used, section(".text.eval")));
+static void F_fields(void) __asm__("fields") __attribute__((used, section(".text.fields")));
+static void F_invariants(void) __asm__("invariants") __attribute__((used, section(".text.invariants")));
+static void F_autofill(void) __asm__("autofill") __attribute__((used, section(".text.autofill")));
+static void F___offset(void) __asm__("_offset") __attribute__((used, section(".text._offset")));
+static void F_named(void) __asm__("named") __attribute__((used, section(".text.named")));
+static void F_nested(void) __asm__("nested") __attribute__((used, section(".text.nested")));
+static void F_deref(void) __asm__("deref") __attribute__((used, section(".text.deref")));
+static void F_assignment(void) __asm__("assignment") __attribute__((used, section(".text.assignment")));
+static void F_storage(void) __asm__("storage") __attribute__((used, section(".text.storage")));
+static void F_padding(void) __asm__("padding") __attribute__((used, section(".text.padding")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\060\066\055\163\164\162\165\143\164\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 19U, 19U };
+static struct S_abortsites_2e48 D_abortsites_2e48 = { (char *)((char *)&D_strliteral_2e1) + 0, 394U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 398U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 399U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 404U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 407U, 15U };
+static struct S_static_2e3 D_static_2e3 = { 69U, {0}, 1337U };
+static struct S_abortsites_2e186 D_abortsites_2e186 = { (char *)((char *)&D_strliteral_2e1) + 0, 337U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 338U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 339U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 350U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 351U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 352U, 15U };
+static struct S_g1 D_g1 = { 0U, 4U, {0}, 4294967295U, 4294967294U, 4294967293U, {0}, 20U, {0}, 0U, {0}, 0U, 0U, 0U, 0U, {0}, 0U };
+static const struct S_strdata_2e249 D_strdata_2e249 = { "\164\171\160\145\040\164\040\075\040\163\164\162\165\143\164\040\173\040\165\070\054\040\170\072\040\151\156\164\040\175\073" };
+static struct S_strliteral_2e250 D_strliteral_2e250 = { (char *)((char *)&D_strdata_2e249) + 0, 31U, 31U };
+static const struct S_strdata_2e285 D_strdata_2e285 = { "\164\171\160\145\040\164\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\054\040\165\070\175\073" };
+static struct S_strliteral_2e286 D_strliteral_2e286 = { (char *)((char *)&D_strdata_2e285) + 0, 30U, 30U };
+static const struct S_strdata_2e304 D_strdata_2e304 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\163\164\162\165\143\164\040\173\040\171\072\040\151\156\164\040\175\040\075\040\163\164\162\165\143\164\040\173\040\171\072\040\151\156\164\040\075\040\061\060\165\040\175\073\040\175\073" };
+static struct S_strliteral_2e305 D_strliteral_2e305 = { (char *)((char *)&D_strdata_2e304) + 0, 73U, 73U };
+static const struct S_strdata_2e306 D_strdata_2e306 = { 10U, 9U, "\164\171\160\145\040\143\157\157\162\144\163\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\054\040\171\072\040\151\156\164\040\175\073", 10U, 10U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\143\157\157\162\144\163\040\173\040\170\072\040\151\156\164\040\075\040\061\060\165\054\040\171\072\040\151\156\164\040\075\040\062\060\165\040\175\073", 10U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e307 D_strliteral_2e307 = { (char *)((char *)&D_strdata_2e306) + 0, 118U, 118U };
+static const struct S_strdata_2e308 D_strdata_2e308 = { "\164\171\160\145\040\163\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\040\175\073\040\146\156\040\164\145\163\164\050\051\040\163\040\075\040\163\040\173\040\170\040\075\040\065\054\040\170\040\075\040\067\040\175\073" };
+static struct S_strliteral_2e309 D_strliteral_2e309 = { (char *)((char *)&D_strdata_2e308) + 0, 61U, 61U };
+static const struct S_strdata_2e310 D_strdata_2e310 = { "\164\171\160\145\040\145\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\040\175\054\040\163\040\075\040\163\164\162\165\143\164\040\173\040\171\072\040\151\156\164\054\040\145\040\175\073\146\156\040\164\145\163\164\050\051\040\163\040\075\040\163\040\173\040\170\040\075\040\065\054\040\170\040\075\040\067\040\175\073" };
+static struct S_strliteral_2e311 D_strliteral_2e311 = { (char *)((char *)&D_strdata_2e310) + 0, 86U, 86U };
+static const struct S_strdata_2e312 D_strdata_2e312 = { "\164\171\160\145\040\145\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\040\175\054\040\163\040\075\040\163\164\162\165\143\164\040\173\040\145\054\040\171\072\040\151\156\164\175\073\146\156\040\164\145\163\164\050\051\040\163\040\075\040\163\040\173\040\170\040\075\040\065\054\040\170\040\075\040\067\040\175\073" };
+static struct S_strliteral_2e313 D_strliteral_2e313 = { (char *)((char *)&D_strdata_2e312) + 0, 85U, 85U };
+static const struct S_strdata_2e314 D_strdata_2e314 = { "\164\171\160\145\040\164\040\075\040\163\164\162\165\143\164\040\173\040\141\054\040\170\072\040\151\156\164\040\175\073\164\171\160\145\040\164\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\054\040\141\040\175\073\164\171\160\145\040\141\040\075\040\163\164\162\073\040\164\171\160\145\040\164\040\075\040\163\164\162\165\143\164\040\173\040\141\054\040\170\072\040\151\156\164\040\175\073\164\171\160\145\040\141\040\075\040\163\164\162\073\040\164\171\160\145\040\164\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\054\040\141\040\175\073\154\145\164\040\141\072\040\151\156\164\040\075\040\066\073\040\164\171\160\145\040\164\040\075\040\163\164\162\165\143\164\040\173\040\141\054\040\170\072\040\151\156\164\040\175\073\154\145\164\040\141\072\040\151\156\164\040\075\040\066\073\040\164\171\160\145\040\164\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\054\040\141\040\175\073\164\171\160\145\040\163\040\075\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\054\040\141\072\040\151\156\164\040\175\073\164\171\160\145\040\163\040\075\040\163\164\162\165\143\164\040\173\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\040\175\054\040\141\072\040\151\156\164\040\175\073" };
+static struct S_strliteral_2e315 D_strliteral_2e315 = { (char *)((char *)&D_strdata_2e314) + 0, 321U, 321U };
+static const struct S_strdata_2e316 D_strdata_2e316 = { "\164\171\160\145\040\163\040\075\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\054\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\040\175\040\175\073" };
+static struct S_strliteral_2e317 D_strliteral_2e317 = { (char *)((char *)&D_strdata_2e316) + 0, 46U, 46U };
+static const struct S_strdata_2e318 D_strdata_2e318 = { "\164\171\160\145\040\145\155\142\145\144\040\075\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\040\175\073\040\164\171\160\145\040\163\040\075\040\163\164\162\165\143\164\040\173\040\145\155\142\145\144\054\040\141\072\040\151\156\164\040\175\073" };
+static struct S_strliteral_2e319 D_strliteral_2e319 = { (char *)((char *)&D_strdata_2e318) + 0, 66U, 66U };
+static const struct S_strdata_2e320 D_strdata_2e320 = { "\164\171\160\145\040\145\155\142\145\144\040\075\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\040\175\073\040\164\171\160\145\040\163\040\075\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\054\040\145\155\142\145\144\040\175\073" };
+static struct S_strliteral_2e321 D_strliteral_2e321 = { (char *)((char *)&D_strdata_2e320) + 0, 66U, 66U };
+static const struct S_strdata_2e322 D_strdata_2e322 = { "\164\171\160\145\040\145\155\142\145\144\040\075\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\040\175\073\040\164\171\160\145\040\163\040\075\040\163\164\162\165\143\164\040\173\040\145\155\142\145\144\054\040\145\155\142\145\144\040\175\073" };
+static struct S_strliteral_2e323 D_strliteral_2e323 = { (char *)((char *)&D_strdata_2e322) + 0, 65U, 65U };
+static const struct S_strdata_2e324 D_strdata_2e324 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\156\165\154\154\141\142\154\145\040\052\163\164\162\165\143\164\040\173\040\171\072\040\151\156\164\040\175\040\075\040\156\165\154\154\073\040\170\056\171\073\040\175\073" };
+static struct S_strliteral_2e325 D_strliteral_2e325 = { (char *)((char *)&D_strdata_2e324) + 0, 69U, 69U };
+static const struct S_strdata_2e326 D_strdata_2e326 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\061\060\073\040\170\056\171\073\040\175\073" };
+static struct S_strliteral_2e327 D_strliteral_2e327 = { (char *)((char *)&D_strdata_2e326) + 0, 38U, 38U };
+static const struct S_strdata_2e328 D_strdata_2e328 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\163\164\162\165\143\164\040\173\040\171\072\040\151\156\164\040\175\040\075\040\163\164\162\165\143\164\040\173\040\171\072\040\151\156\164\040\075\040\061\060\040\175\073\040\170\056\172\073\040\175\073" };
+static struct S_strliteral_2e329 D_strliteral_2e329 = { (char *)((char *)&D_strdata_2e328) + 0, 77U, 77U };
+static const struct S_strdata_2e330 D_strdata_2e330 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\163\164\162\165\143\164\040\173\040\170\040\075\040\061\060\040\175\073\040\175\073" };
+static struct S_strliteral_2e331 D_strliteral_2e331 = { (char *)((char *)&D_strdata_2e330) + 0, 48U, 48U };
+static const struct S_strdata_2e332 D_strdata_2e332 = { "\164\171\160\145\040\163\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\133\052\135\151\156\164\054\040\141\072\040\163\164\162\040\175\073" };
+static struct S_strliteral_2e333 D_strliteral_2e333 = { (char *)((char *)&D_strdata_2e332) + 0, 38U, 38U };
+static const struct S_strdata_2e334 D_strdata_2e334 = { "\164\171\160\145\040\163\040\075\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\040\175\073\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\163\040\173\040\141\040\075\040\063\040\175\040\053\040\163\040\173\040\141\040\075\040\065\040\175\073\040\175\073" };
+static struct S_strliteral_2e335 D_strliteral_2e335 = { (char *)((char *)&D_strdata_2e334) + 0, 80U, 80U };
+static const struct S_strdata_2e336 D_strdata_2e336 = { "\164\171\160\145\040\163\040\075\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\040\175\073\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\163\040\173\040\141\040\075\040\063\040\175\073\040\170\040\053\075\040\163\040\173\040\141\040\075\040\065\040\175\073\040\175\073" };
+static struct S_strliteral_2e337 D_strliteral_2e337 = { (char *)((char *)&D_strdata_2e336) + 0, 84U, 84U };
+static const struct S_strdata_2e338 D_strdata_2e338 = { "\164\171\160\145\040\146\157\157\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\050\166\157\151\144\040\174\040\151\156\164\051\054\040\171\072\040\050\166\157\151\144\040\174\040\151\156\164\051\040\175\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\146\157\157\040\173\040\170\040\075\040\060\054\040\056\056\056\040\175\073\040\175\073" };
+static struct S_strliteral_2e339 D_strliteral_2e339 = { (char *)((char *)&D_strdata_2e338) + 0, 104U, 104U };
+static const struct S_strdata_2e340 D_strdata_2e340 = { "\164\171\160\145\040\146\157\157\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\133\061\135\052\151\156\164\040\175\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\146\157\157\040\173\040\056\056\056\040\175\073\040\175\073" };
+static struct S_strliteral_2e341 D_strliteral_2e341 = { (char *)((char *)&D_strdata_2e340) + 0, 75U, 75U };
+static const struct S_strdata_2e342 D_strdata_2e342 = { "\164\171\160\145\040\146\157\157\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\054\040\171\072\040\133\052\135\151\156\164\040\175\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\146\157\157\040\173\040\170\040\075\040\060\054\040\056\056\056\040\175\073\040\175\073" };
+static struct S_strliteral_2e343 D_strliteral_2e343 = { (char *)((char *)&D_strdata_2e342) + 0, 89U, 89U };
+static const struct S_strdata_2e344 D_strdata_2e344 = { "\164\171\160\145\040\146\157\157\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\054\040\171\072\040\163\164\162\165\143\164\040\173\040\172\072\040\151\156\164\054\040\141\072\040\050\166\157\151\144\040\174\040\151\156\164\051\040\175\040\175\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\146\157\157\040\173\040\170\040\075\040\060\054\040\056\056\056\040\175\073\040\175\073" };
+static struct S_strliteral_2e345 D_strliteral_2e345 = { (char *)((char *)&D_strdata_2e344) + 0, 117U, 117U };
+static const struct S_strdata_2e346 D_strdata_2e346 = { "\164\171\160\145\040\146\157\157\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\052\151\156\164\054\040\171\072\040\151\156\164\040\175\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\146\157\157\040\173\040\056\056\056\040\175\073\040\175\073" };
+static struct S_strliteral_2e347 D_strliteral_2e347 = { (char *)((char *)&D_strdata_2e346) + 0, 80U, 80U };
+static const struct S_strdata_2e348 D_strdata_2e348 = { "\164\171\160\145\040\141\040\075\040\052\151\156\164\073\040\164\171\160\145\040\146\157\157\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\141\040\175\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\146\157\157\040\173\040\056\056\056\040\175\073\040\175\073" };
+static struct S_strliteral_2e349 D_strliteral_2e349 = { (char *)((char *)&D_strdata_2e348) + 0, 84U, 84U };
+static const struct S_strdata_2e350 D_strdata_2e350 = { "\164\171\160\145\040\146\157\157\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\054\040\171\072\040\142\141\162\040\175\073\164\171\160\145\040\142\141\162\040\075\040\145\156\165\155\040\173\040\101\040\075\040\061\054\040\102\040\075\040\062\040\175\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\146\157\157\040\173\040\170\040\075\040\060\054\040\056\056\056\040\175\073\040\175\073" };
+static struct S_strliteral_2e351 D_strliteral_2e351 = { (char *)((char *)&D_strdata_2e350) + 0, 119U, 119U };
+static const struct S_strdata_2e352 D_strdata_2e352 = { "\164\171\160\145\040\146\157\157\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\054\040\171\072\040\142\141\162\040\175\073\164\171\160\145\040\142\141\162\040\075\040\145\156\165\155\040\173\040\101\040\075\040\061\054\040\102\054\040\103\040\075\040\055\061\040\175\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\146\157\157\040\173\040\170\040\075\040\060\054\040\056\056\056\040\175\073\040\175\073" };
+static struct S_strliteral_2e353 D_strliteral_2e353 = { (char *)((char *)&D_strdata_2e352) + 0, 123U, 123U };
+static const struct S_strdata_2e354 D_strdata_2e354 = { "\164\171\160\145\040\146\157\157\040\075\040\163\164\162\165\143\164\040\173\040\100\157\146\146\163\145\164\050\064\051\040\170\072\040\151\156\164\054\040\100\157\146\146\163\145\164\050\060\051\040\171\072\040\151\156\164\040\175\073" };
+static struct S_strliteral_2e355 D_strliteral_2e355 = { (char *)((char *)&D_strdata_2e354) + 0, 59U, 59U };
+static const struct S_strdata_2e356 D_strdata_2e356 = { "\164\171\160\145\040\146\157\157\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\165\066\064\054\040\100\157\146\146\163\145\164\050\064\051\040\171\072\040\165\063\062\040\175\073" };
+static struct S_strliteral_2e357 D_strliteral_2e357 = { (char *)((char *)&D_strdata_2e356) + 0, 48U, 48U };
+static struct S_abortsites_2e266 D_abortsites_2e266 = { (char *)((char *)&D_strliteral_2e1) + 0, 229U, 67U, (char *)((char *)&D_strliteral_2e1) + 0, 229U, 67U, (char *)((char *)&D_strliteral_2e1) + 0, 230U, 66U, (char *)((char *)&D_strliteral_2e1) + 0, 230U, 66U, (char *)((char *)&D_strliteral_2e1) + 0, 321U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 321U, 53U };
+static const struct S_strliteral_2e478 D_strliteral_2e478 = { 0U, 0U, 0U };
+static struct S_abortsites_2e409 D_abortsites_2e409 = { (char *)((char *)&D_strliteral_2e1) + 0, 203U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 205U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 206U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 207U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 208U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 209U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 210U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 219U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 220U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 221U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 222U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 223U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 224U, 15U };
+static struct S_g6 D_g6 = { 0U, 0U, {0}, 0U, 0U, 0U, {0}, 0U, {0}, 0U, {0}, 0U, 0U, 0U, 0U, {0}, 0U };
+static struct S_g5 D_g5 = { 0U, 0U, {0}, 0U, 0U, 0U, {0}, 20U, {0}, 0U, {0}, 0U, 0U, 0U, 0U, {0}, 0U };
+static struct S_g4 D_g4 = { 0U, 0U, {0}, 0U, 0U, 4294967293U, {0}, 20U, {0}, 0U, {0}, 0U, 0U, 0U, 0U, {0}, 0U };
+static struct S_g3 D_g3 = { 0U, 0U, {0}, 0U, 4294967294U, 4294967293U, {0}, 20U, {0}, 0U, {0}, 0U, 0U, 0U, 0U, {0}, 0U };
+static struct S_g2 D_g2 = { 0U, 0U, {0}, 4294967295U, 4294967294U, 4294967293U, {0}, 20U, {0}, 0U, {0}, 0U, 0U, 0U, 0U, {0}, 0U };
+static struct S_abortsites_2e1225 D_abortsites_2e1225 = { (char *)((char *)&D_strliteral_2e1) + 0, 178U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 179U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 181U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 182U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 184U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 185U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 186U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 187U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 188U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 191U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 192U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 193U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 194U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 195U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 196U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 197U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 198U, 15U };
+static struct S_abortsites_2e1308 D_abortsites_2e1308 = { (char *)((char *)&D_strliteral_2e1) + 0, 163U, 15U };
+static struct S_abortsites_2e1337 D_abortsites_2e1337 = { (char *)((char *)&D_strliteral_2e1) + 0, 100U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 107U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 132U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 133U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 135U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 136U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 137U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 140U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 144U, 15U };
+static struct S_abortsites_2e1509 D_abortsites_2e1509 = { (char *)((char *)&D_strliteral_2e1) + 0, 54U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 56U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 58U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 61U, 15U };
+static struct S_abortsites_2e1591 D_abortsites_2e1591 = { (char *)((char *)&D_strliteral_2e1) + 0, 40U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 42U, 15U };
+static struct S_abortsites_2e1640 D_abortsites_2e1640 = { (char *)((char *)&D_strliteral_2e1) + 0, 33U, 15U };
+static struct S_abortsites_2e1656 D_abortsites_2e1656 = { (char *)((char *)&D_strliteral_2e1) + 0, 4U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 5U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 6U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 7U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 8U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 17U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 18U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 20U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_padding)))();
+	((void (*)(void))((u64)((char *)&F_storage)))();
+	((void (*)(void))((u64)((char *)&F_assignment)))();
+	((void (*)(void))((u64)((char *)&F_deref)))();
+	((void (*)(void))((u64)((char *)&F_nested)))();
+	((void (*)(void))((u64)((char *)&F_named)))();
+	((void (*)(void))((u64)((char *)&F___offset)))();
+	((void (*)(void))((u64)((char *)&F_autofill)))();
+	((void (*)(void))((u64)((char *)&F_invariants)))();
+	((void (*)(void))((u64)((char *)&F_fields)))();
+	((void (*)(void))((u64)((char *)&F_eval)))();
+	((void (*)(void))((u64)((char *)&F_results)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_results(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char R2[24] __attribute__((aligned(16)));
+	char R3[24] __attribute__((aligned(16)));
+	char R4[28] __attribute__((aligned(16)));
+	char R5[28] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e103;
+	u64 t__2e104;
+	u64 t__2e105;
+	u64 t__2e107;
+	u64 t__2e108;
+	u64 t__2e110;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e113;
+	u64 t__2e119;
+	u64 t__2e122;
+	u64 t__2e125;
+	u64 t__2e126;
+	u64 t__2e127;
+	u64 t__2e129;
+	u64 t__2e130;
+	u64 t__2e132;
+	u64 t__2e14;
+	u64 t__2e15;
+	u64 t__2e22;
+	u64 t__2e23;
+	u64 t__2e26;
+	u64 t__2e31;
+	u64 t__2e34;
+	u64 t__2e37;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e45;
+	u64 t__2e46;
+	u64 t__2e47;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e54;
+	u64 t__2e55;
+	u64 t__2e58;
+	u64 t__2e59;
+	u64 t__2e60;
+	u64 t__2e63;
+	u64 t__2e66;
+	u64 t__2e68;
+	u64 t__2e69;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t__2e73;
+	u64 t__2e76;
+	u64 t__2e79;
+	u64 t__2e81;
+	u64 t__2e82;
+	u64 t__2e84;
+	u64 t__2e85;
+	u64 t__2e86;
+	u64 t__2e87;
+	u64 t__2e88;
+	u64 t__2e90;
+	u64 t__2e91;
+	u64 t__2e97;
+	u64 t_abortsite_2e49;
+	u64 t_binding_2e11;
+	u64 t_binding_2e114;
+	u64 t_binding_2e115;
+	u64 t_binding_2e21;
+	u64 t_binding_2e93;
+	u64 t_binding_2e94;
+	u64 t_field_2e106;
+	u64 t_field_2e109;
+	u64 t_field_2e116;
+	u64 t_field_2e128;
+	u64 t_field_2e131;
+	u64 t_field_2e38;
+	u64 t_field_2e41;
+	u64 t_field_2e44;
+	u64 t_field_2e56;
+	u64 t_field_2e57;
+	u64 t_field_2e67;
+	u64 t_field_2e70;
+	u64 t_field_2e80;
+	u64 t_field_2e83;
+	u64 t_item_2e13;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	t_binding_2e21 = (u64)A1;
+	L_body_2e8:;
+	t_item_2e13 = (u64)((u64)t_binding_2e11 + (u64)((u64)0UL));
+	t__2e14 = ((u64)0UL);
+	*(u64 *)t_item_2e13 = (u64)t__2e14;
+	t_item_2e13 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e15 = ((u64)0UL);
+	*(u64 *)t_item_2e13 = (u64)t__2e15;
+	*(u64 *)t_binding_2e21 = (u64)((u64)0UL);
+	L_loop_2e16:;
+	t__2e23 = (u64)(*(u64 *)t_binding_2e21);
+	t__2e22 = (u64)(u32)(((u64)t__2e23 < (u64)((u64)2UL)));
+	if ((u32)t__2e22) goto L_body_2e17; else goto L__2e19;
+	L_body_2e17:;
+	t__2e26 = ((u64 (*)(u64, u32))((u64)((char *)&F_mkpoint)))((u64)R2, (u32)((u64)1UL));
+	t_field_2e38 = (u64)((u64)t__2e26 + (u64)((u64)0UL));
+	t__2e39 = (u64)(u32)(*(i32 *)t_field_2e38);
+	t__2e37 = (u64)(u32)(((u32)t__2e39 == (u32)((u64)1UL)));
+	t__2e34 = (u64)(u32)t__2e37;
+	if ((u32)t__2e34) goto L__2e35; else goto L__2e36;
+	L__2e35:;
+	t_field_2e41 = (u64)((u64)t__2e26 + (u64)((u64)4UL));
+	t__2e42 = (u64)(u32)(*(i32 *)t_field_2e41);
+	t__2e40 = (u64)(u32)(((u32)t__2e42 == (u32)((u64)2UL)));
+	t__2e34 = (u64)(u32)t__2e40;
+	goto L__2e36;
+	L__2e36:;
+	t__2e31 = (u64)(u32)t__2e34;
+	if ((u32)t__2e31) goto L__2e32; else goto L__2e33;
+	L__2e32:;
+	t_field_2e44 = (u64)((u64)t__2e26 + (u64)((u64)8UL));
+	t__2e46 = (u64)((i64)(i32)((u64)3UL));
+	t__2e45 = (u64)((u64)t__2e46 * (u64)((u64)4UL));
+	t__2e45 = (u64)((u64)t_field_2e44 + (u64)t__2e45);
+	t__2e47 = (u64)(u32)(*(i32 *)t__2e45);
+	t__2e43 = (u64)(u32)(((u32)t__2e47 == (u32)((u64)6UL)));
+	t__2e31 = (u64)(u32)t__2e43;
+	goto L__2e33;
+	L__2e33:;
+	if ((u32)t__2e31) goto L_passed_2e30; else goto L_failed_2e29;
+	L_failed_2e29:;
+	t_abortsite_2e49 = ((u64)0UL);
+	goto L_abort_2e50;
+	L_passed_2e30:;
+	t_field_2e56 = (u64)((u64)t__2e26 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e56 = (u32)((u64)10UL);
+	t_field_2e57 = (u64)((u64)t__2e26 + (u64)((u64)8UL));
+	t__2e59 = (u64)((i64)(i32)((u64)3UL));
+	t__2e58 = (u64)((u64)t__2e59 * (u64)((u64)4UL));
+	t__2e58 = (u64)((u64)t_field_2e57 + (u64)t__2e58);
+	*(u32 *)t__2e58 = (u32)((u64)60UL);
+	t__2e60 = ((u64 (*)(u64, u32))((u64)((char *)&F_mkpoint)))((u64)R3, (u32)((u64)0UL));
+	t_field_2e67 = (u64)((u64)t__2e60 + (u64)((u64)0UL));
+	t__2e68 = (u64)(u32)(*(i32 *)t_field_2e67);
+	t__2e66 = (u64)(u32)(((u32)t__2e68 == (u32)((u64)1UL)));
+	t__2e63 = (u64)(u32)t__2e66;
+	if ((u32)t__2e63) goto L__2e64; else goto L__2e65;
+	L__2e64:;
+	t_field_2e70 = (u64)((u64)t__2e60 + (u64)((u64)8UL));
+	t__2e72 = (u64)((i64)(i32)((u64)3UL));
+	t__2e71 = (u64)((u64)t__2e72 * (u64)((u64)4UL));
+	t__2e71 = (u64)((u64)t_field_2e70 + (u64)t__2e71);
+	t__2e73 = (u64)(u32)(*(i32 *)t__2e71);
+	t__2e69 = (u64)(u32)(((u32)t__2e73 == (u32)((u64)6UL)));
+	t__2e63 = (u64)(u32)t__2e69;
+	goto L__2e65;
+	L__2e65:;
+	if ((u32)t__2e63) goto L_passed_2e62; else goto L_failed_2e61;
+	L_failed_2e61:;
+	t_abortsite_2e49 = ((u64)1UL);
+	goto L_abort_2e50;
+	L_passed_2e62:;
+	t_field_2e80 = (u64)((u64)t__2e26 + (u64)((u64)0UL));
+	t__2e81 = (u64)(u32)(*(i32 *)t_field_2e80);
+	t__2e79 = (u64)(u32)(((u32)t__2e81 == (u32)((u64)10UL)));
+	t__2e76 = (u64)(u32)t__2e79;
+	if ((u32)t__2e76) goto L__2e77; else goto L__2e78;
+	L__2e77:;
+	t_field_2e83 = (u64)((u64)t__2e26 + (u64)((u64)8UL));
+	t__2e85 = (u64)((i64)(i32)((u64)3UL));
+	t__2e84 = (u64)((u64)t__2e85 * (u64)((u64)4UL));
+	t__2e84 = (u64)((u64)t_field_2e83 + (u64)t__2e84);
+	t__2e86 = (u64)(u32)(*(i32 *)t__2e84);
+	t__2e82 = (u64)(u32)(((u32)t__2e86 == (u32)((u64)60UL)));
+	t__2e76 = (u64)(u32)t__2e82;
+	goto L__2e78;
+	L__2e78:;
+	if ((u32)t__2e76) goto L_passed_2e75; else goto L_failed_2e74;
+	L_failed_2e74:;
+	t_abortsite_2e49 = ((u64)2UL);
+	goto L_abort_2e50;
+	L_passed_2e75:;
+	t__2e88 = (u64)(*(u64 *)t_binding_2e21);
+	t__2e87 = (u64)((u64)t__2e88 * (u64)((u64)8UL));
+	t__2e87 = (u64)((u64)t_binding_2e11 + (u64)t__2e87);
+	*(u64 *)t__2e87 = (u64)t__2e26;
+	goto L__2e24;
+	L__2e89:;
+	L__2e24:;
+	L_after_2e20:;
+	t__2e90 = (u64)(*(u64 *)t_binding_2e21);
+	t__2e90 = (u64)((u64)t__2e90 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e21 = (u64)t__2e90;
+	goto L_loop_2e16;
+	L__2e19:;
+	t__2e91 = ((u64 (*)(u64, u32))((u64)((char *)&F_mktuple)))((u64)R4, (u32)((u64)2UL));
+	t_binding_2e93 = (u64)((u64)t__2e91 + (u64)((u64)0UL));
+	t_binding_2e94 = (u64)((u64)t__2e91 + (u64)((u64)4UL));
+	t__2e104 = (u64)(u32)(*(i32 *)t_binding_2e93);
+	t__2e103 = (u64)(u32)(((u32)t__2e104 == (u32)((u64)2UL)));
+	t__2e100 = (u64)(u32)t__2e103;
+	if ((u32)t__2e100) goto L__2e101; else goto L__2e102;
+	L__2e101:;
+	t_field_2e106 = (u64)((u64)t_binding_2e94 + (u64)((u64)0UL));
+	t__2e107 = (u64)(u32)(*(i32 *)t_field_2e106);
+	t__2e105 = (u64)(u32)(((u32)t__2e107 == (u32)((u64)1UL)));
+	t__2e100 = (u64)(u32)t__2e105;
+	goto L__2e102;
+	L__2e102:;
+	t__2e97 = (u64)(u32)t__2e100;
+	if ((u32)t__2e97) goto L__2e98; else goto L__2e99;
+	L__2e98:;
+	t_field_2e109 = (u64)((u64)t_binding_2e94 + (u64)((u64)8UL));
+	t__2e111 = (u64)((i64)(i32)((u64)0UL));
+	t__2e110 = (u64)((u64)t__2e111 * (u64)((u64)4UL));
+	t__2e110 = (u64)((u64)t_field_2e109 + (u64)t__2e110);
+	t__2e112 = (u64)(u32)(*(i32 *)t__2e110);
+	t__2e108 = (u64)(u32)(((u32)t__2e112 == (u32)((u64)3UL)));
+	t__2e97 = (u64)(u32)t__2e108;
+	goto L__2e99;
+	L__2e99:;
+	if ((u32)t__2e97) goto L_passed_2e96; else goto L_failed_2e95;
+	L_failed_2e95:;
+	t_abortsite_2e49 = ((u64)3UL);
+	goto L_abort_2e50;
+	L_passed_2e96:;
+	t__2e113 = ((u64 (*)(u64, u32))((u64)((char *)&F_mktuple)))((u64)R5, (u32)((u64)3UL));
+	t_binding_2e114 = (u64)((u64)t__2e113 + (u64)((u64)0UL));
+	t_binding_2e115 = (u64)((u64)t__2e113 + (u64)((u64)4UL));
+	t_field_2e116 = (u64)((u64)t_binding_2e94 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e116 = (u32)((u64)20UL);
+	t__2e126 = (u64)(u32)(*(i32 *)t_binding_2e114);
+	t__2e125 = (u64)(u32)(((u32)t__2e126 == (u32)((u64)3UL)));
+	t__2e122 = (u64)(u32)t__2e125;
+	if ((u32)t__2e122) goto L__2e123; else goto L__2e124;
+	L__2e123:;
+	t_field_2e128 = (u64)((u64)t_binding_2e115 + (u64)((u64)4UL));
+	t__2e129 = (u64)(u32)(*(i32 *)t_field_2e128);
+	t__2e127 = (u64)(u32)(((u32)t__2e129 == (u32)((u64)2UL)));
+	t__2e122 = (u64)(u32)t__2e127;
+	goto L__2e124;
+	L__2e124:;
+	t__2e119 = (u64)(u32)t__2e122;
+	if ((u32)t__2e119) goto L__2e120; else goto L__2e121;
+	L__2e120:;
+	t_field_2e131 = (u64)((u64)t_binding_2e94 + (u64)((u64)4UL));
+	t__2e132 = (u64)(u32)(*(i32 *)t_field_2e131);
+	t__2e130 = (u64)(u32)(((u32)t__2e132 == (u32)((u64)20UL)));
+	t__2e119 = (u64)(u32)t__2e130;
+	goto L__2e121;
+	L__2e121:;
+	if ((u32)t__2e119) goto L_passed_2e118; else goto L_failed_2e117;
+	L_failed_2e117:;
+	t_abortsite_2e49 = ((u64)4UL);
+	goto L_abort_2e50;
+	L_passed_2e118:;
+	goto L__2e9;
+	L__2e133:;
+	L__2e9:;
+	return;
+	L_abort_2e50:;
+	t__2e51 = (u64)((u64)t_abortsite_2e49 * (u64)((u64)16UL));
+	t__2e51 = (u64)((u64)((u64)((char *)&D_abortsites_2e48)) + (u64)t__2e51);
+	t__2e52 = (u64)(*(u64 *)t__2e51);
+	t__2e53 = (u64)((u64)t__2e51 + (u64)((u64)8UL));
+	t__2e54 = (u64)(*(u32 *)t__2e53);
+	t__2e53 = (u64)((u64)t__2e51 + (u64)((u64)12UL));
+	t__2e55 = (u64)(*(u32 *)t__2e53);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e52, (u64)t__2e54, (u64)t__2e55, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u64 F_mktuple(u64 __rp, u32 p_n) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[28] __attribute__((aligned(16)));
+	char R2[24] __attribute__((aligned(16)));
+	u64 t__2e139;
+	u64 t__2e140;
+	u64 t__2e141;
+	u64 t_n;
+	u64 t_object_2e137;
+	u64 t_param_2e135;
+	u64 t_value_2e138;
+	t_n = (u64)p_n;
+	L_start_2e134:;
+	t_param_2e135 = (u64)A0;
+	t_object_2e137 = (u64)A1;
+	*(u32 *)t_param_2e135 = (u32)t_n;
+	L_body_2e136:;
+	t_value_2e138 = (u64)((u64)t_object_2e137 + (u64)((u64)0UL));
+	t__2e139 = (u64)(u32)(*(i32 *)t_param_2e135);
+	*(u32 *)t_value_2e138 = (u32)t__2e139;
+	t_value_2e138 = (u64)((u64)t_object_2e137 + (u64)((u64)4UL));
+	t__2e141 = (u64)(u32)(*(i32 *)t_param_2e135);
+	t__2e140 = ((u64 (*)(u64, u32))((u64)((char *)&F_mkpoint)))((u64)R2, (u32)t__2e141);
+	BLIT(t_value_2e138, t__2e140, ((u64)24UL));
+	BLIT(__rp, t_object_2e137, 28); return __rp;
+}
+static u64 F_mkpoint(u64 __rp, u32 p_n) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char R2[24] __attribute__((aligned(16)));
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t_field_2e162;
+	u64 t_item_2e163;
+	u64 t_n;
+	u64 t_object_2e161;
+	u64 t_param_2e143;
+	t_n = (u64)p_n;
+	L_start_2e142:;
+	t_param_2e143 = (u64)A0;
+	t_object_2e161 = (u64)A1;
+	*(u32 *)t_param_2e143 = (u32)t_n;
+	L_body_2e144:;
+	t__2e152 = (u64)(u32)(*(i32 *)t_param_2e143);
+	t__2e151 = (u64)(u32)(((i32)t__2e152 > (i32)((u64)0UL)));
+	t__2e153 = (u64)(u32)((u8)t__2e151);
+	if ((u32)t__2e153) goto L_true_2e148; else goto L_false_2e149;
+	L_true_2e148:;
+	t__2e158 = (u64)(u32)(*(i32 *)t_param_2e143);
+	t__2e157 = (u64)(u32)((u32)t__2e158 - (u32)((u64)1UL));
+	t__2e156 = ((u64 (*)(u64, u32))((u64)((char *)&F_mkpoint)))((u64)R2, (u32)t__2e157);
+	BLIT(__rp, t__2e156, 24); return __rp;
+	L__2e159:;
+	L__2e154:;
+	L__2e160:;
+	L_false_2e149:;
+	L__2e150:;
+	t_field_2e162 = (u64)((u64)t_object_2e161 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e162 = (u32)((u64)1UL);
+	t_field_2e162 = (u64)((u64)t_object_2e161 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e162 = (u32)((u64)2UL);
+	t_field_2e162 = (u64)((u64)t_object_2e161 + (u64)((u64)8UL));
+	t_item_2e163 = (u64)((u64)t_field_2e162 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e163 = (u32)((u64)3UL);
+	t_item_2e163 = (u64)((u64)t_field_2e162 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e163 = (u32)((u64)4UL);
+	t_item_2e163 = (u64)((u64)t_field_2e162 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e163 = (u32)((u64)5UL);
+	t_item_2e163 = (u64)((u64)t_field_2e162 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e163 = (u32)((u64)6UL);
+	BLIT(__rp, t_object_2e161, 24); return __rp;
+	L__2e164:;
+	L__2e145:;
+	L__2e165:;
+	return 0;
+}
+static void F_eval(void) {
+	L_start_2e166:;
+	L_body_2e167:;
+	goto L__2e168;
+	L__2e170:;
+	L__2e168:;
+	return;
+}
+static void F_fields(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e179;
+	u64 t__2e180;
+	u64 t__2e184;
+	u64 t__2e185;
+	u64 t__2e189;
+	u64 t__2e190;
+	u64 t__2e191;
+	u64 t__2e192;
+	u64 t__2e193;
+	u64 t__2e196;
+	u64 t__2e197;
+	u64 t__2e199;
+	u64 t__2e200;
+	u64 t__2e201;
+	u64 t__2e204;
+	u64 t__2e205;
+	u64 t__2e207;
+	u64 t__2e208;
+	u64 t__2e212;
+	u64 t__2e213;
+	u64 t__2e218;
+	u64 t__2e219;
+	u64 t__2e222;
+	u64 t__2e223;
+	u64 t__2e225;
+	u64 t__2e226;
+	u64 t__2e227;
+	u64 t__2e230;
+	u64 t__2e231;
+	u64 t__2e233;
+	u64 t__2e234;
+	u64 t__2e235;
+	u64 t_abortsite_2e187;
+	u64 t_binding_2e175;
+	u64 t_binding_2e176;
+	u64 t_binding_2e209;
+	u64 t_field_2e183;
+	u64 t_field_2e198;
+	u64 t_field_2e206;
+	u64 t_field_2e217;
+	u64 t_field_2e224;
+	u64 t_field_2e232;
+	L_start_2e171:;
+	t_binding_2e175 = (u64)A0;
+	t_binding_2e176 = (u64)A1;
+	t_binding_2e209 = (u64)A2;
+	L_body_2e172:;
+	*(u32 *)t_binding_2e175 = (u32)((u64)0UL);
+	*(u64 *)t_binding_2e176 = (u64)t_binding_2e175;
+	t__2e180 = (u64)(*(u64 *)t_binding_2e176);
+	t_field_2e183 = (u64)((u64)t__2e180 + (u64)((u64)0UL));
+	t__2e184 = t_field_2e183;
+	t__2e185 = t_binding_2e175;
+	t__2e179 = (u64)(u32)(((u64)t__2e184 == (u64)t__2e185));
+	if ((u32)t__2e179) goto L_passed_2e178; else goto L_failed_2e177;
+	L_failed_2e177:;
+	t_abortsite_2e187 = ((u64)0UL);
+	goto L_abort_2e188;
+	L_passed_2e178:;
+	t__2e197 = (u64)(*(u64 *)t_binding_2e176);
+	t_field_2e198 = (u64)((u64)t__2e197 + (u64)((u64)1UL));
+	t__2e199 = t_field_2e198;
+	t__2e201 = t_binding_2e175;
+	t__2e200 = (u64)((u64)t__2e201 + (u64)((u64)1UL));
+	t__2e196 = (u64)(u32)(((u64)t__2e199 == (u64)t__2e200));
+	if ((u32)t__2e196) goto L_passed_2e195; else goto L_failed_2e194;
+	L_failed_2e194:;
+	t_abortsite_2e187 = ((u64)1UL);
+	goto L_abort_2e188;
+	L_passed_2e195:;
+	t__2e205 = (u64)(*(u64 *)t_binding_2e176);
+	t_field_2e206 = (u64)((u64)t__2e205 + (u64)((u64)0UL));
+	t__2e207 = t_field_2e206;
+	t__2e208 = t_binding_2e175;
+	t__2e204 = (u64)(u32)(((u64)t__2e207 == (u64)t__2e208));
+	if ((u32)t__2e204) goto L_passed_2e203; else goto L_failed_2e202;
+	L_failed_2e202:;
+	t_abortsite_2e187 = ((u64)2UL);
+	goto L_abort_2e188;
+	L_passed_2e203:;
+	*(u64 *)t_binding_2e209 = (u64)t_binding_2e175;
+	t__2e213 = (u64)(*(u64 *)t_binding_2e209);
+	t_field_2e217 = (u64)((u64)t__2e213 + (u64)((u64)0UL));
+	t__2e218 = t_field_2e217;
+	t__2e219 = t_binding_2e175;
+	t__2e212 = (u64)(u32)(((u64)t__2e218 == (u64)t__2e219));
+	if ((u32)t__2e212) goto L_passed_2e211; else goto L_failed_2e210;
+	L_failed_2e210:;
+	t_abortsite_2e187 = ((u64)3UL);
+	goto L_abort_2e188;
+	L_passed_2e211:;
+	t__2e223 = (u64)(*(u64 *)t_binding_2e209);
+	t_field_2e224 = (u64)((u64)t__2e223 + (u64)((u64)1UL));
+	t__2e225 = t_field_2e224;
+	t__2e227 = t_binding_2e175;
+	t__2e226 = (u64)((u64)t__2e227 + (u64)((u64)1UL));
+	t__2e222 = (u64)(u32)(((u64)t__2e225 == (u64)t__2e226));
+	if ((u32)t__2e222) goto L_passed_2e221; else goto L_failed_2e220;
+	L_failed_2e220:;
+	t_abortsite_2e187 = ((u64)4UL);
+	goto L_abort_2e188;
+	L_passed_2e221:;
+	t__2e231 = (u64)(*(u64 *)t_binding_2e209);
+	t_field_2e232 = (u64)((u64)t__2e231 + (u64)((u64)2UL));
+	t__2e233 = t_field_2e232;
+	t__2e235 = t_binding_2e175;
+	t__2e234 = (u64)((u64)t__2e235 + (u64)((u64)2UL));
+	t__2e230 = (u64)(u32)(((u64)t__2e233 == (u64)t__2e234));
+	if ((u32)t__2e230) goto L_passed_2e229; else goto L_failed_2e228;
+	L_failed_2e228:;
+	t_abortsite_2e187 = ((u64)5UL);
+	goto L_abort_2e188;
+	L_passed_2e229:;
+	goto L__2e173;
+	L__2e236:;
+	L__2e173:;
+	return;
+	L_abort_2e188:;
+	t__2e189 = (u64)((u64)t_abortsite_2e187 * (u64)((u64)16UL));
+	t__2e189 = (u64)((u64)((u64)((char *)&D_abortsites_2e186)) + (u64)t__2e189);
+	t__2e190 = (u64)(*(u64 *)t__2e189);
+	t__2e191 = (u64)((u64)t__2e189 + (u64)((u64)8UL));
+	t__2e192 = (u64)(*(u32 *)t__2e191);
+	t__2e191 = (u64)((u64)t__2e189 + (u64)((u64)12UL));
+	t__2e193 = (u64)(*(u32 *)t__2e191);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e190, (u64)t__2e192, (u64)t__2e193, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_invariants(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[648] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char B8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[4] __attribute__((aligned(16)));
+	char B12[8] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char R15[4] __attribute__((aligned(16)));
+	char B16[8] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char R19[4] __attribute__((aligned(16)));
+	u64 t__2e242;
+	u64 t__2e248;
+	u64 t__2e254;
+	u64 t__2e263;
+	u64 t__2e265;
+	u64 t__2e269;
+	u64 t__2e270;
+	u64 t__2e271;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e276;
+	u64 t__2e277;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t__2e280;
+	u64 t__2e282;
+	u64 t__2e284;
+	u64 t__2e288;
+	u64 t__2e297;
+	u64 t__2e299;
+	u64 t__2e364;
+	u64 t__2e365;
+	u64 t__2e369;
+	u64 t__2e371;
+	u64 t__2e372;
+	u64 t__2e373;
+	u64 t__2e375;
+	u64 t__2e384;
+	u64 t__2e386;
+	u64 t__2e389;
+	u64 t_abortsite_2e267;
+	u64 t_binding_2e301;
+	u64 t_binding_2e363;
+	u64 t_item_2e303;
+	u64 t_object_2e244;
+	u64 t_object_2e252;
+	u64 t_object_2e283;
+	u64 t_object_2e287;
+	u64 t_object_2e370;
+	u64 t_object_2e374;
+	u64 t_tag_2e255;
+	u64 t_tag_2e289;
+	u64 t_tag_2e376;
+	L_start_2e237:;
+	t_object_2e244 = (u64)A0;
+	t_object_2e252 = (u64)A1;
+	t_object_2e283 = (u64)A2;
+	t_object_2e287 = (u64)A3;
+	t_binding_2e301 = (u64)A4;
+	t_binding_2e363 = (u64)A5;
+	t_object_2e370 = (u64)A6;
+	t_object_2e374 = (u64)A7;
+	L_body_2e238:;
+	*(u32 *)t_object_2e244 = (u32)((u64)3532310079UL);
+	t__2e248 = (u64)((u64)t_object_2e244 + (u64)((u64)4UL));
+	*(u32 *)t__2e248 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e252 = (u64)((u64)0UL);
+	t__2e254 = (u64)((u64)t_object_2e252 + (u64)((u64)8UL));
+	*(u64 *)t__2e254 = (u64)((u64)0UL);
+	t__2e254 = (u64)((u64)t__2e254 + (u64)((u64)8UL));
+	*(u64 *)t__2e254 = (u64)((u64)0UL);
+	BLIT((u64)B8, t_object_2e244, 8);
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e250)), 24);
+	BLIT((u64)B10, t_object_2e252, 24);
+	t__2e242 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R11, (u64)B8, (u64)B9, (u64)B10);
+	t_tag_2e255 = (u64)(*(u32 *)t__2e242);
+	t__2e263 = (u64)(u32)(((u32)t_tag_2e255 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e263) goto L_member_2e260; else goto L__2e262;
+	L__2e262:;
+	t__2e265 = (u64)(u32)(((u32)t_tag_2e255 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e265) goto L_member_2e261; else goto L__2e264;
+	L__2e264:;
+	goto L_matches_2e259;
+	L_member_2e260:;
+	goto L_matches_2e259;
+	L_member_2e261:;
+	goto L_matches_2e258;
+	L_matches_2e258:;
+	goto L__2e256;
+	L_matches_2e259:;
+	t_abortsite_2e267 = ((u64)0UL);
+	goto L_abort_2e268;
+	L__2e274:;
+	L__2e257:;
+	t_abortsite_2e267 = ((u64)1UL);
+	goto L_abort_2e275;
+	L__2e256:;
+	*(u32 *)t_object_2e283 = (u32)((u64)3532310079UL);
+	t__2e284 = (u64)((u64)t_object_2e283 + (u64)((u64)4UL));
+	*(u32 *)t__2e284 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e287 = (u64)((u64)0UL);
+	t__2e288 = (u64)((u64)t_object_2e287 + (u64)((u64)8UL));
+	*(u64 *)t__2e288 = (u64)((u64)0UL);
+	t__2e288 = (u64)((u64)t__2e288 + (u64)((u64)8UL));
+	*(u64 *)t__2e288 = (u64)((u64)0UL);
+	BLIT((u64)B12, t_object_2e283, 8);
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e286)), 24);
+	BLIT((u64)B14, t_object_2e287, 24);
+	t__2e282 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R15, (u64)B12, (u64)B13, (u64)B14);
+	t_tag_2e289 = (u64)(*(u32 *)t__2e282);
+	t__2e297 = (u64)(u32)(((u32)t_tag_2e289 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e297) goto L_member_2e294; else goto L__2e296;
+	L__2e296:;
+	t__2e299 = (u64)(u32)(((u32)t_tag_2e289 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e299) goto L_member_2e295; else goto L__2e298;
+	L__2e298:;
+	goto L_matches_2e293;
+	L_member_2e294:;
+	goto L_matches_2e293;
+	L_member_2e295:;
+	goto L_matches_2e292;
+	L_matches_2e292:;
+	goto L__2e290;
+	L_matches_2e293:;
+	t_abortsite_2e267 = ((u64)2UL);
+	goto L_abort_2e268;
+	L__2e300:;
+	L__2e291:;
+	t_abortsite_2e267 = ((u64)3UL);
+	goto L_abort_2e275;
+	L__2e290:;
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)0UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e305)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)24UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e307)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)48UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e309)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)72UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e311)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)96UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e313)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)120UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e315)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)144UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e317)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)168UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e319)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)192UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e321)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)216UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e323)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)240UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e325)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)264UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e327)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)288UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e329)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)312UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e331)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)336UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e333)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)360UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e335)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)384UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e337)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)408UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e339)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)432UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e341)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)456UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e343)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)480UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e345)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)504UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e347)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)528UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e349)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)552UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e351)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)576UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e353)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)600UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e355)), ((u64)24UL));
+	t_item_2e303 = (u64)((u64)t_binding_2e301 + (u64)((u64)624UL));
+	BLIT(t_item_2e303, ((u64)((char *)&D_strliteral_2e357)), ((u64)24UL));
+	*(u64 *)t_binding_2e363 = (u64)((u64)0UL);
+	L_loop_2e358:;
+	t__2e365 = (u64)(*(u64 *)t_binding_2e363);
+	t__2e364 = (u64)(u32)(((u64)t__2e365 < (u64)((u64)27UL)));
+	if ((u32)t__2e364) goto L_body_2e359; else goto L__2e361;
+	L_body_2e359:;
+	*(u32 *)t_object_2e370 = (u32)((u64)3532310079UL);
+	t__2e371 = (u64)((u64)t_object_2e370 + (u64)((u64)4UL));
+	*(u32 *)t__2e371 = (u32)((u64)4UL);
+	t__2e373 = (u64)(*(u64 *)t_binding_2e363);
+	t__2e372 = (u64)((u64)t__2e373 * (u64)((u64)24UL));
+	t__2e372 = (u64)((u64)t_binding_2e301 + (u64)t__2e372);
+	*(u64 *)t_object_2e374 = (u64)((u64)0UL);
+	t__2e375 = (u64)((u64)t_object_2e374 + (u64)((u64)8UL));
+	*(u64 *)t__2e375 = (u64)((u64)0UL);
+	t__2e375 = (u64)((u64)t__2e375 + (u64)((u64)8UL));
+	*(u64 *)t__2e375 = (u64)((u64)0UL);
+	BLIT((u64)B16, t_object_2e370, 8);
+	BLIT((u64)B17, t__2e372, 24);
+	BLIT((u64)B18, t_object_2e374, 24);
+	t__2e369 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R19, (u64)B16, (u64)B17, (u64)B18);
+	t_tag_2e376 = (u64)(*(u32 *)t__2e369);
+	t__2e384 = (u64)(u32)(((u32)t_tag_2e376 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e384) goto L_member_2e381; else goto L__2e383;
+	L__2e383:;
+	t__2e386 = (u64)(u32)(((u32)t_tag_2e376 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e386) goto L_member_2e382; else goto L__2e385;
+	L__2e385:;
+	goto L_matches_2e380;
+	L_member_2e381:;
+	goto L_matches_2e380;
+	L_member_2e382:;
+	goto L_matches_2e379;
+	L_matches_2e379:;
+	goto L__2e377;
+	L_matches_2e380:;
+	t_abortsite_2e267 = ((u64)4UL);
+	goto L_abort_2e268;
+	L__2e387:;
+	L__2e378:;
+	t_abortsite_2e267 = ((u64)5UL);
+	goto L_abort_2e275;
+	L__2e377:;
+	goto L__2e366;
+	L__2e388:;
+	L__2e366:;
+	L_after_2e362:;
+	t__2e389 = (u64)(*(u64 *)t_binding_2e363);
+	t__2e389 = (u64)((u64)t__2e389 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e363 = (u64)t__2e389;
+	goto L_loop_2e358;
+	L__2e361:;
+	goto L__2e239;
+	L__2e390:;
+	L__2e239:;
+	return;
+	L_abort_2e268:;
+	t__2e269 = (u64)((u64)t_abortsite_2e267 * (u64)((u64)16UL));
+	t__2e269 = (u64)((u64)((u64)((char *)&D_abortsites_2e266)) + (u64)t__2e269);
+	t__2e270 = (u64)(*(u64 *)t__2e269);
+	t__2e271 = (u64)((u64)t__2e269 + (u64)((u64)8UL));
+	t__2e272 = (u64)(*(u32 *)t__2e271);
+	t__2e271 = (u64)((u64)t__2e269 + (u64)((u64)12UL));
+	t__2e273 = (u64)(*(u32 *)t__2e271);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e270, (u64)t__2e272, (u64)t__2e273, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e275:;
+	t__2e276 = (u64)((u64)t_abortsite_2e267 * (u64)((u64)16UL));
+	t__2e276 = (u64)((u64)((u64)((char *)&D_abortsites_2e266)) + (u64)t__2e276);
+	t__2e277 = (u64)(*(u64 *)t__2e276);
+	t__2e278 = (u64)((u64)t__2e276 + (u64)((u64)8UL));
+	t__2e279 = (u64)(*(u32 *)t__2e278);
+	t__2e278 = (u64)((u64)t__2e276 + (u64)((u64)12UL));
+	t__2e280 = (u64)(*(u32 *)t__2e278);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e277, (u64)t__2e279, (u64)t__2e280, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_autofill(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[80] __attribute__((aligned(16)));
+	char A2[80] __attribute__((aligned(16)));
+	char A3[80] __attribute__((aligned(16)));
+	char A4[80] __attribute__((aligned(16)));
+	char A5[80] __attribute__((aligned(16)));
+	char A6[80] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char B16[24] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	u64 t__2e1000;
+	u64 t__2e1002;
+	u64 t__2e1003;
+	u64 t__2e1004;
+	u64 t__2e1006;
+	u64 t__2e1007;
+	u64 t__2e1008;
+	u64 t__2e1010;
+	u64 t__2e1011;
+	u64 t__2e1014;
+	u64 t__2e1015;
+	u64 t__2e1018;
+	u64 t__2e1020;
+	u64 t__2e1021;
+	u64 t__2e1023;
+	u64 t__2e1024;
+	u64 t__2e1027;
+	u64 t__2e1030;
+	u64 t__2e1033;
+	u64 t__2e1036;
+	u64 t__2e1039;
+	u64 t__2e1042;
+	u64 t__2e1045;
+	u64 t__2e1048;
+	u64 t__2e1051;
+	u64 t__2e1054;
+	u64 t__2e1056;
+	u64 t__2e1057;
+	u64 t__2e1059;
+	u64 t__2e1060;
+	u64 t__2e1061;
+	u64 t__2e1062;
+	u64 t__2e1064;
+	u64 t__2e1065;
+	u64 t__2e1067;
+	u64 t__2e1068;
+	u64 t__2e1070;
+	u64 t__2e1071;
+	u64 t__2e1072;
+	u64 t__2e1074;
+	u64 t__2e1075;
+	u64 t__2e1078;
+	u64 t__2e1079;
+	u64 t__2e1082;
+	u64 t__2e1084;
+	u64 t__2e1085;
+	u64 t__2e1087;
+	u64 t__2e1088;
+	u64 t__2e1091;
+	u64 t__2e1094;
+	u64 t__2e1097;
+	u64 t__2e1100;
+	u64 t__2e1103;
+	u64 t__2e1106;
+	u64 t__2e1109;
+	u64 t__2e1112;
+	u64 t__2e1115;
+	u64 t__2e1118;
+	u64 t__2e1120;
+	u64 t__2e1121;
+	u64 t__2e1123;
+	u64 t__2e1124;
+	u64 t__2e1125;
+	u64 t__2e1126;
+	u64 t__2e1128;
+	u64 t__2e1129;
+	u64 t__2e1131;
+	u64 t__2e1132;
+	u64 t__2e1134;
+	u64 t__2e1135;
+	u64 t__2e1137;
+	u64 t__2e1138;
+	u64 t__2e1141;
+	u64 t__2e1142;
+	u64 t__2e1145;
+	u64 t__2e1147;
+	u64 t__2e1148;
+	u64 t__2e1150;
+	u64 t__2e1151;
+	u64 t__2e1154;
+	u64 t__2e1157;
+	u64 t__2e1160;
+	u64 t__2e1163;
+	u64 t__2e1166;
+	u64 t__2e1169;
+	u64 t__2e1172;
+	u64 t__2e1175;
+	u64 t__2e1178;
+	u64 t__2e1181;
+	u64 t__2e1183;
+	u64 t__2e1184;
+	u64 t__2e1186;
+	u64 t__2e1187;
+	u64 t__2e1188;
+	u64 t__2e1189;
+	u64 t__2e1191;
+	u64 t__2e1192;
+	u64 t__2e1194;
+	u64 t__2e1195;
+	u64 t__2e1197;
+	u64 t__2e1198;
+	u64 t__2e1200;
+	u64 t__2e1201;
+	u64 t__2e1204;
+	u64 t__2e1205;
+	u64 t__2e1208;
+	u64 t__2e1210;
+	u64 t__2e1211;
+	u64 t__2e1213;
+	u64 t__2e1214;
+	u64 t__2e400;
+	u64 t__2e403;
+	u64 t__2e405;
+	u64 t__2e406;
+	u64 t__2e408;
+	u64 t__2e412;
+	u64 t__2e413;
+	u64 t__2e414;
+	u64 t__2e415;
+	u64 t__2e416;
+	u64 t__2e419;
+	u64 t__2e422;
+	u64 t__2e425;
+	u64 t__2e428;
+	u64 t__2e431;
+	u64 t__2e434;
+	u64 t__2e437;
+	u64 t__2e440;
+	u64 t__2e443;
+	u64 t__2e446;
+	u64 t__2e449;
+	u64 t__2e450;
+	u64 t__2e452;
+	u64 t__2e453;
+	u64 t__2e454;
+	u64 t__2e455;
+	u64 t__2e457;
+	u64 t__2e458;
+	u64 t__2e459;
+	u64 t__2e461;
+	u64 t__2e462;
+	u64 t__2e463;
+	u64 t__2e465;
+	u64 t__2e466;
+	u64 t__2e467;
+	u64 t__2e469;
+	u64 t__2e470;
+	u64 t__2e474;
+	u64 t__2e475;
+	u64 t__2e479;
+	u64 t__2e481;
+	u64 t__2e482;
+	u64 t__2e484;
+	u64 t__2e485;
+	u64 t__2e488;
+	u64 t__2e491;
+	u64 t__2e494;
+	u64 t__2e497;
+	u64 t__2e500;
+	u64 t__2e503;
+	u64 t__2e506;
+	u64 t__2e509;
+	u64 t__2e512;
+	u64 t__2e515;
+	u64 t__2e517;
+	u64 t__2e518;
+	u64 t__2e520;
+	u64 t__2e521;
+	u64 t__2e522;
+	u64 t__2e523;
+	u64 t__2e525;
+	u64 t__2e526;
+	u64 t__2e527;
+	u64 t__2e529;
+	u64 t__2e530;
+	u64 t__2e531;
+	u64 t__2e533;
+	u64 t__2e534;
+	u64 t__2e535;
+	u64 t__2e537;
+	u64 t__2e538;
+	u64 t__2e541;
+	u64 t__2e542;
+	u64 t__2e545;
+	u64 t__2e547;
+	u64 t__2e548;
+	u64 t__2e550;
+	u64 t__2e551;
+	u64 t__2e554;
+	u64 t__2e557;
+	u64 t__2e560;
+	u64 t__2e563;
+	u64 t__2e566;
+	u64 t__2e569;
+	u64 t__2e572;
+	u64 t__2e575;
+	u64 t__2e578;
+	u64 t__2e581;
+	u64 t__2e583;
+	u64 t__2e584;
+	u64 t__2e586;
+	u64 t__2e587;
+	u64 t__2e588;
+	u64 t__2e589;
+	u64 t__2e591;
+	u64 t__2e592;
+	u64 t__2e594;
+	u64 t__2e595;
+	u64 t__2e596;
+	u64 t__2e598;
+	u64 t__2e599;
+	u64 t__2e600;
+	u64 t__2e602;
+	u64 t__2e603;
+	u64 t__2e606;
+	u64 t__2e607;
+	u64 t__2e610;
+	u64 t__2e612;
+	u64 t__2e613;
+	u64 t__2e615;
+	u64 t__2e616;
+	u64 t__2e619;
+	u64 t__2e622;
+	u64 t__2e625;
+	u64 t__2e628;
+	u64 t__2e631;
+	u64 t__2e634;
+	u64 t__2e637;
+	u64 t__2e640;
+	u64 t__2e643;
+	u64 t__2e646;
+	u64 t__2e648;
+	u64 t__2e649;
+	u64 t__2e651;
+	u64 t__2e652;
+	u64 t__2e653;
+	u64 t__2e654;
+	u64 t__2e656;
+	u64 t__2e657;
+	u64 t__2e659;
+	u64 t__2e660;
+	u64 t__2e662;
+	u64 t__2e663;
+	u64 t__2e664;
+	u64 t__2e666;
+	u64 t__2e667;
+	u64 t__2e670;
+	u64 t__2e671;
+	u64 t__2e674;
+	u64 t__2e676;
+	u64 t__2e677;
+	u64 t__2e679;
+	u64 t__2e680;
+	u64 t__2e683;
+	u64 t__2e686;
+	u64 t__2e689;
+	u64 t__2e692;
+	u64 t__2e695;
+	u64 t__2e698;
+	u64 t__2e701;
+	u64 t__2e704;
+	u64 t__2e707;
+	u64 t__2e710;
+	u64 t__2e712;
+	u64 t__2e713;
+	u64 t__2e715;
+	u64 t__2e716;
+	u64 t__2e717;
+	u64 t__2e718;
+	u64 t__2e720;
+	u64 t__2e721;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e726;
+	u64 t__2e727;
+	u64 t__2e729;
+	u64 t__2e730;
+	u64 t__2e733;
+	u64 t__2e734;
+	u64 t__2e737;
+	u64 t__2e739;
+	u64 t__2e740;
+	u64 t__2e742;
+	u64 t__2e743;
+	u64 t__2e746;
+	u64 t__2e749;
+	u64 t__2e752;
+	u64 t__2e755;
+	u64 t__2e758;
+	u64 t__2e761;
+	u64 t__2e764;
+	u64 t__2e767;
+	u64 t__2e770;
+	u64 t__2e773;
+	u64 t__2e775;
+	u64 t__2e776;
+	u64 t__2e778;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e781;
+	u64 t__2e783;
+	u64 t__2e784;
+	u64 t__2e786;
+	u64 t__2e787;
+	u64 t__2e789;
+	u64 t__2e790;
+	u64 t__2e792;
+	u64 t__2e793;
+	u64 t__2e796;
+	u64 t__2e797;
+	u64 t__2e800;
+	u64 t__2e802;
+	u64 t__2e803;
+	u64 t__2e805;
+	u64 t__2e806;
+	u64 t__2e809;
+	u64 t__2e810;
+	u64 t__2e811;
+	u64 t__2e814;
+	u64 t__2e815;
+	u64 t__2e816;
+	u64 t__2e819;
+	u64 t__2e820;
+	u64 t__2e823;
+	u64 t__2e830;
+	u64 t__2e833;
+	u64 t__2e836;
+	u64 t__2e839;
+	u64 t__2e842;
+	u64 t__2e845;
+	u64 t__2e848;
+	u64 t__2e851;
+	u64 t__2e854;
+	u64 t__2e857;
+	u64 t__2e859;
+	u64 t__2e860;
+	u64 t__2e862;
+	u64 t__2e863;
+	u64 t__2e864;
+	u64 t__2e865;
+	u64 t__2e867;
+	u64 t__2e868;
+	u64 t__2e869;
+	u64 t__2e871;
+	u64 t__2e872;
+	u64 t__2e873;
+	u64 t__2e875;
+	u64 t__2e876;
+	u64 t__2e877;
+	u64 t__2e879;
+	u64 t__2e880;
+	u64 t__2e883;
+	u64 t__2e884;
+	u64 t__2e887;
+	u64 t__2e889;
+	u64 t__2e890;
+	u64 t__2e892;
+	u64 t__2e893;
+	u64 t__2e896;
+	u64 t__2e899;
+	u64 t__2e902;
+	u64 t__2e905;
+	u64 t__2e908;
+	u64 t__2e911;
+	u64 t__2e914;
+	u64 t__2e917;
+	u64 t__2e920;
+	u64 t__2e923;
+	u64 t__2e925;
+	u64 t__2e926;
+	u64 t__2e928;
+	u64 t__2e929;
+	u64 t__2e930;
+	u64 t__2e931;
+	u64 t__2e933;
+	u64 t__2e934;
+	u64 t__2e935;
+	u64 t__2e937;
+	u64 t__2e938;
+	u64 t__2e939;
+	u64 t__2e941;
+	u64 t__2e942;
+	u64 t__2e943;
+	u64 t__2e945;
+	u64 t__2e946;
+	u64 t__2e949;
+	u64 t__2e950;
+	u64 t__2e953;
+	u64 t__2e955;
+	u64 t__2e956;
+	u64 t__2e958;
+	u64 t__2e959;
+	u64 t__2e962;
+	u64 t__2e965;
+	u64 t__2e968;
+	u64 t__2e971;
+	u64 t__2e974;
+	u64 t__2e977;
+	u64 t__2e980;
+	u64 t__2e983;
+	u64 t__2e986;
+	u64 t__2e989;
+	u64 t__2e991;
+	u64 t__2e992;
+	u64 t__2e994;
+	u64 t__2e995;
+	u64 t__2e996;
+	u64 t__2e997;
+	u64 t__2e999;
+	u64 t_abortsite_2e410;
+	u64 t_binding_2e395;
+	u64 t_binding_2e807;
+	u64 t_binding_2e812;
+	u64 t_binding_2e817;
+	u64 t_binding_2e821;
+	u64 t_binding_2e824;
+	u64 t_binding_2e826;
+	u64 t_field_2e1001;
+	u64 t_field_2e1005;
+	u64 t_field_2e1009;
+	u64 t_field_2e1012;
+	u64 t_field_2e1016;
+	u64 t_field_2e1019;
+	u64 t_field_2e1022;
+	u64 t_field_2e1055;
+	u64 t_field_2e1058;
+	u64 t_field_2e1063;
+	u64 t_field_2e1066;
+	u64 t_field_2e1069;
+	u64 t_field_2e1073;
+	u64 t_field_2e1076;
+	u64 t_field_2e1080;
+	u64 t_field_2e1083;
+	u64 t_field_2e1086;
+	u64 t_field_2e1119;
+	u64 t_field_2e1122;
+	u64 t_field_2e1127;
+	u64 t_field_2e1130;
+	u64 t_field_2e1133;
+	u64 t_field_2e1136;
+	u64 t_field_2e1139;
+	u64 t_field_2e1143;
+	u64 t_field_2e1146;
+	u64 t_field_2e1149;
+	u64 t_field_2e1182;
+	u64 t_field_2e1185;
+	u64 t_field_2e1190;
+	u64 t_field_2e1193;
+	u64 t_field_2e1196;
+	u64 t_field_2e1199;
+	u64 t_field_2e1202;
+	u64 t_field_2e1206;
+	u64 t_field_2e1209;
+	u64 t_field_2e1212;
+	u64 t_field_2e397;
+	u64 t_field_2e404;
+	u64 t_field_2e407;
+	u64 t_field_2e448;
+	u64 t_field_2e451;
+	u64 t_field_2e456;
+	u64 t_field_2e460;
+	u64 t_field_2e464;
+	u64 t_field_2e468;
+	u64 t_field_2e471;
+	u64 t_field_2e476;
+	u64 t_field_2e480;
+	u64 t_field_2e483;
+	u64 t_field_2e516;
+	u64 t_field_2e519;
+	u64 t_field_2e524;
+	u64 t_field_2e528;
+	u64 t_field_2e532;
+	u64 t_field_2e536;
+	u64 t_field_2e539;
+	u64 t_field_2e543;
+	u64 t_field_2e546;
+	u64 t_field_2e549;
+	u64 t_field_2e582;
+	u64 t_field_2e585;
+	u64 t_field_2e590;
+	u64 t_field_2e593;
+	u64 t_field_2e597;
+	u64 t_field_2e601;
+	u64 t_field_2e604;
+	u64 t_field_2e608;
+	u64 t_field_2e611;
+	u64 t_field_2e614;
+	u64 t_field_2e647;
+	u64 t_field_2e650;
+	u64 t_field_2e655;
+	u64 t_field_2e658;
+	u64 t_field_2e661;
+	u64 t_field_2e665;
+	u64 t_field_2e668;
+	u64 t_field_2e672;
+	u64 t_field_2e675;
+	u64 t_field_2e678;
+	u64 t_field_2e711;
+	u64 t_field_2e714;
+	u64 t_field_2e719;
+	u64 t_field_2e722;
+	u64 t_field_2e725;
+	u64 t_field_2e728;
+	u64 t_field_2e731;
+	u64 t_field_2e735;
+	u64 t_field_2e738;
+	u64 t_field_2e741;
+	u64 t_field_2e774;
+	u64 t_field_2e777;
+	u64 t_field_2e782;
+	u64 t_field_2e785;
+	u64 t_field_2e788;
+	u64 t_field_2e791;
+	u64 t_field_2e794;
+	u64 t_field_2e798;
+	u64 t_field_2e801;
+	u64 t_field_2e804;
+	u64 t_field_2e808;
+	u64 t_field_2e813;
+	u64 t_field_2e818;
+	u64 t_field_2e822;
+	u64 t_field_2e825;
+	u64 t_field_2e858;
+	u64 t_field_2e861;
+	u64 t_field_2e866;
+	u64 t_field_2e870;
+	u64 t_field_2e874;
+	u64 t_field_2e878;
+	u64 t_field_2e881;
+	u64 t_field_2e885;
+	u64 t_field_2e888;
+	u64 t_field_2e891;
+	u64 t_field_2e924;
+	u64 t_field_2e927;
+	u64 t_field_2e932;
+	u64 t_field_2e936;
+	u64 t_field_2e940;
+	u64 t_field_2e944;
+	u64 t_field_2e947;
+	u64 t_field_2e951;
+	u64 t_field_2e954;
+	u64 t_field_2e957;
+	u64 t_field_2e990;
+	u64 t_field_2e993;
+	u64 t_field_2e998;
+	u64 t_value_2e1013;
+	u64 t_value_2e1017;
+	u64 t_value_2e1077;
+	u64 t_value_2e1081;
+	u64 t_value_2e1140;
+	u64 t_value_2e1144;
+	u64 t_value_2e1203;
+	u64 t_value_2e1207;
+	u64 t_value_2e473;
+	u64 t_value_2e477;
+	u64 t_value_2e540;
+	u64 t_value_2e544;
+	u64 t_value_2e605;
+	u64 t_value_2e609;
+	u64 t_value_2e669;
+	u64 t_value_2e673;
+	u64 t_value_2e732;
+	u64 t_value_2e736;
+	u64 t_value_2e795;
+	u64 t_value_2e799;
+	u64 t_value_2e882;
+	u64 t_value_2e886;
+	u64 t_value_2e948;
+	u64 t_value_2e952;
+	L_start_2e391:;
+	t_binding_2e395 = (u64)A0;
+	t_binding_2e807 = (u64)A1;
+	t_binding_2e812 = (u64)A2;
+	t_binding_2e817 = (u64)A3;
+	t_binding_2e821 = (u64)A4;
+	t_binding_2e824 = (u64)A5;
+	t_binding_2e826 = (u64)A6;
+	L_body_2e392:;
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t_binding_2e395, (u64)((u64)0UL), (u64)((u64)8UL));
+	t_field_2e397 = (u64)((u64)t_binding_2e395 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e397 = (u32)((u64)10UL);
+	t_field_2e404 = (u64)((u64)t_binding_2e395 + (u64)((u64)0UL));
+	t__2e405 = (u64)(u32)(*(i32 *)t_field_2e404);
+	t__2e403 = (u64)(u32)(((u32)t__2e405 == (u32)((u64)10UL)));
+	t__2e400 = (u64)(u32)t__2e403;
+	if ((u32)t__2e400) goto L__2e401; else goto L__2e402;
+	L__2e401:;
+	t_field_2e407 = (u64)((u64)t_binding_2e395 + (u64)((u64)4UL));
+	t__2e408 = (u64)(u32)(*(i32 *)t_field_2e407);
+	t__2e406 = (u64)(u32)(((u32)t__2e408 == (u32)((u64)0UL)));
+	t__2e400 = (u64)(u32)t__2e406;
+	goto L__2e402;
+	L__2e402:;
+	if ((u32)t__2e400) goto L_passed_2e399; else goto L_failed_2e398;
+	L_failed_2e398:;
+	t_abortsite_2e410 = ((u64)0UL);
+	goto L_abort_2e411;
+	L_passed_2e399:;
+	t_field_2e448 = (u64)((u64)((u64)((char *)&D_g1)) + (u64)((u64)0UL));
+	t__2e449 = (u64)(u32)(*(u32 *)t_field_2e448);
+	t__2e446 = (u64)(u32)(((u32)t__2e449 == (u32)((u64)0UL)));
+	t__2e443 = (u64)(u32)t__2e446;
+	if ((u32)t__2e443) goto L__2e444; else goto L__2e445;
+	L__2e444:;
+	t_field_2e451 = (u64)((u64)((u64)((char *)&D_g1)) + (u64)((u64)4UL));
+	t__2e452 = (u64)(u32)(*(u8 *)t_field_2e451);
+	t__2e453 = (u64)(u32)((u8)t__2e452);
+	t__2e454 = (u64)(u32)((u8)((u64)4UL));
+	t__2e450 = (u64)(u32)(((u32)t__2e453 == (u32)t__2e454));
+	t__2e443 = (u64)(u32)t__2e450;
+	goto L__2e445;
+	L__2e445:;
+	t__2e440 = (u64)(u32)t__2e443;
+	if ((u32)t__2e440) goto L__2e441; else goto L__2e442;
+	L__2e441:;
+	t_field_2e456 = (u64)((u64)((u64)((char *)&D_g1)) + (u64)((u64)8UL));
+	t__2e457 = (u64)(u32)(*(i32 *)t_field_2e456);
+	t__2e458 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e455 = (u64)(u32)(((u32)t__2e457 == (u32)t__2e458));
+	t__2e440 = (u64)(u32)t__2e455;
+	goto L__2e442;
+	L__2e442:;
+	t__2e437 = (u64)(u32)t__2e440;
+	if ((u32)t__2e437) goto L__2e438; else goto L__2e439;
+	L__2e438:;
+	t_field_2e460 = (u64)((u64)((u64)((char *)&D_g1)) + (u64)((u64)12UL));
+	t__2e461 = (u64)(u32)(*(i32 *)t_field_2e460);
+	t__2e462 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e459 = (u64)(u32)(((u32)t__2e461 == (u32)t__2e462));
+	t__2e437 = (u64)(u32)t__2e459;
+	goto L__2e439;
+	L__2e439:;
+	t__2e434 = (u64)(u32)t__2e437;
+	if ((u32)t__2e434) goto L__2e435; else goto L__2e436;
+	L__2e435:;
+	t_field_2e464 = (u64)((u64)((u64)((char *)&D_g1)) + (u64)((u64)16UL));
+	t__2e465 = (u64)(u32)(*(i32 *)t_field_2e464);
+	t__2e466 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e463 = (u64)(u32)(((u32)t__2e465 == (u32)t__2e466));
+	t__2e434 = (u64)(u32)t__2e463;
+	goto L__2e436;
+	L__2e436:;
+	t__2e431 = (u64)(u32)t__2e434;
+	if ((u32)t__2e431) goto L__2e432; else goto L__2e433;
+	L__2e432:;
+	t_field_2e468 = (u64)((u64)((u64)((char *)&D_g1)) + (u64)((u64)24UL));
+	t__2e469 = (u64)(u32)(*(i32 *)t_field_2e468);
+	t__2e467 = (u64)(u32)(((u32)t__2e469 == (u32)((u64)20UL)));
+	t__2e431 = (u64)(u32)t__2e467;
+	goto L__2e433;
+	L__2e433:;
+	t__2e428 = (u64)(u32)t__2e431;
+	if ((u32)t__2e428) goto L__2e429; else goto L__2e430;
+	L__2e429:;
+	t_field_2e471 = (u64)((u64)((u64)((char *)&D_g1)) + (u64)((u64)32UL));
+	t_value_2e473 = (u64)((u64)t_field_2e471 + (u64)((u64)0UL));
+	t__2e474 = (u64)(u32)(*(i32 *)t_value_2e473);
+	t__2e470 = (u64)(u32)(((u32)t__2e474 == (u32)((u64)0UL)));
+	t__2e428 = (u64)(u32)t__2e470;
+	goto L__2e430;
+	L__2e430:;
+	t__2e425 = (u64)(u32)t__2e428;
+	if ((u32)t__2e425) goto L__2e426; else goto L__2e427;
+	L__2e426:;
+	t_field_2e476 = (u64)((u64)((u64)((char *)&D_g1)) + (u64)((u64)32UL));
+	t_value_2e477 = (u64)((u64)t_field_2e476 + (u64)((u64)8UL));
+	BLIT((u64)B7, t_value_2e477, 24);
+	BLIT((u64)B8, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e475 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B7, (u64)B8));
+	t__2e425 = (u64)(u32)t__2e475;
+	goto L__2e427;
+	L__2e427:;
+	t__2e422 = (u64)(u32)t__2e425;
+	if ((u32)t__2e422) goto L__2e423; else goto L__2e424;
+	L__2e423:;
+	t_field_2e480 = (u64)((u64)((u64)((char *)&D_g1)) + (u64)((u64)64UL));
+	t__2e481 = (u64)(u32)(*(i32 *)t_field_2e480);
+	t__2e479 = (u64)(u32)(((u32)t__2e481 == (u32)((u64)0UL)));
+	t__2e422 = (u64)(u32)t__2e479;
+	goto L__2e424;
+	L__2e424:;
+	t__2e419 = (u64)(u32)t__2e422;
+	if ((u32)t__2e419) goto L__2e420; else goto L__2e421;
+	L__2e420:;
+	t_field_2e483 = (u64)((u64)((u64)((char *)&D_g1)) + (u64)((u64)72UL));
+	t__2e484 = (u64)(*(u64 *)t_field_2e483);
+	t__2e485 = ((u64)0UL);
+	t__2e482 = (u64)(u32)(((u64)t__2e484 == (u64)t__2e485));
+	t__2e419 = (u64)(u32)t__2e482;
+	goto L__2e421;
+	L__2e421:;
+	if ((u32)t__2e419) goto L_passed_2e418; else goto L_failed_2e417;
+	L_failed_2e417:;
+	t_abortsite_2e410 = ((u64)1UL);
+	goto L_abort_2e411;
+	L_passed_2e418:;
+	t_field_2e516 = (u64)((u64)((u64)((char *)&D_g2)) + (u64)((u64)0UL));
+	t__2e517 = (u64)(u32)(*(u32 *)t_field_2e516);
+	t__2e515 = (u64)(u32)(((u32)t__2e517 == (u32)((u64)0UL)));
+	t__2e512 = (u64)(u32)t__2e515;
+	if ((u32)t__2e512) goto L__2e513; else goto L__2e514;
+	L__2e513:;
+	t_field_2e519 = (u64)((u64)((u64)((char *)&D_g2)) + (u64)((u64)4UL));
+	t__2e520 = (u64)(u32)(*(u8 *)t_field_2e519);
+	t__2e521 = (u64)(u32)((u8)t__2e520);
+	t__2e522 = (u64)(u32)((u8)((u64)0UL));
+	t__2e518 = (u64)(u32)(((u32)t__2e521 == (u32)t__2e522));
+	t__2e512 = (u64)(u32)t__2e518;
+	goto L__2e514;
+	L__2e514:;
+	t__2e509 = (u64)(u32)t__2e512;
+	if ((u32)t__2e509) goto L__2e510; else goto L__2e511;
+	L__2e510:;
+	t_field_2e524 = (u64)((u64)((u64)((char *)&D_g2)) + (u64)((u64)8UL));
+	t__2e525 = (u64)(u32)(*(i32 *)t_field_2e524);
+	t__2e526 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e523 = (u64)(u32)(((u32)t__2e525 == (u32)t__2e526));
+	t__2e509 = (u64)(u32)t__2e523;
+	goto L__2e511;
+	L__2e511:;
+	t__2e506 = (u64)(u32)t__2e509;
+	if ((u32)t__2e506) goto L__2e507; else goto L__2e508;
+	L__2e507:;
+	t_field_2e528 = (u64)((u64)((u64)((char *)&D_g2)) + (u64)((u64)12UL));
+	t__2e529 = (u64)(u32)(*(i32 *)t_field_2e528);
+	t__2e530 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e527 = (u64)(u32)(((u32)t__2e529 == (u32)t__2e530));
+	t__2e506 = (u64)(u32)t__2e527;
+	goto L__2e508;
+	L__2e508:;
+	t__2e503 = (u64)(u32)t__2e506;
+	if ((u32)t__2e503) goto L__2e504; else goto L__2e505;
+	L__2e504:;
+	t_field_2e532 = (u64)((u64)((u64)((char *)&D_g2)) + (u64)((u64)16UL));
+	t__2e533 = (u64)(u32)(*(i32 *)t_field_2e532);
+	t__2e534 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e531 = (u64)(u32)(((u32)t__2e533 == (u32)t__2e534));
+	t__2e503 = (u64)(u32)t__2e531;
+	goto L__2e505;
+	L__2e505:;
+	t__2e500 = (u64)(u32)t__2e503;
+	if ((u32)t__2e500) goto L__2e501; else goto L__2e502;
+	L__2e501:;
+	t_field_2e536 = (u64)((u64)((u64)((char *)&D_g2)) + (u64)((u64)24UL));
+	t__2e537 = (u64)(u32)(*(i32 *)t_field_2e536);
+	t__2e535 = (u64)(u32)(((u32)t__2e537 == (u32)((u64)20UL)));
+	t__2e500 = (u64)(u32)t__2e535;
+	goto L__2e502;
+	L__2e502:;
+	t__2e497 = (u64)(u32)t__2e500;
+	if ((u32)t__2e497) goto L__2e498; else goto L__2e499;
+	L__2e498:;
+	t_field_2e539 = (u64)((u64)((u64)((char *)&D_g2)) + (u64)((u64)32UL));
+	t_value_2e540 = (u64)((u64)t_field_2e539 + (u64)((u64)0UL));
+	t__2e541 = (u64)(u32)(*(i32 *)t_value_2e540);
+	t__2e538 = (u64)(u32)(((u32)t__2e541 == (u32)((u64)0UL)));
+	t__2e497 = (u64)(u32)t__2e538;
+	goto L__2e499;
+	L__2e499:;
+	t__2e494 = (u64)(u32)t__2e497;
+	if ((u32)t__2e494) goto L__2e495; else goto L__2e496;
+	L__2e495:;
+	t_field_2e543 = (u64)((u64)((u64)((char *)&D_g2)) + (u64)((u64)32UL));
+	t_value_2e544 = (u64)((u64)t_field_2e543 + (u64)((u64)8UL));
+	BLIT((u64)B9, t_value_2e544, 24);
+	BLIT((u64)B10, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e542 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B9, (u64)B10));
+	t__2e494 = (u64)(u32)t__2e542;
+	goto L__2e496;
+	L__2e496:;
+	t__2e491 = (u64)(u32)t__2e494;
+	if ((u32)t__2e491) goto L__2e492; else goto L__2e493;
+	L__2e492:;
+	t_field_2e546 = (u64)((u64)((u64)((char *)&D_g2)) + (u64)((u64)64UL));
+	t__2e547 = (u64)(u32)(*(i32 *)t_field_2e546);
+	t__2e545 = (u64)(u32)(((u32)t__2e547 == (u32)((u64)0UL)));
+	t__2e491 = (u64)(u32)t__2e545;
+	goto L__2e493;
+	L__2e493:;
+	t__2e488 = (u64)(u32)t__2e491;
+	if ((u32)t__2e488) goto L__2e489; else goto L__2e490;
+	L__2e489:;
+	t_field_2e549 = (u64)((u64)((u64)((char *)&D_g2)) + (u64)((u64)72UL));
+	t__2e550 = (u64)(*(u64 *)t_field_2e549);
+	t__2e551 = ((u64)0UL);
+	t__2e548 = (u64)(u32)(((u64)t__2e550 == (u64)t__2e551));
+	t__2e488 = (u64)(u32)t__2e548;
+	goto L__2e490;
+	L__2e490:;
+	if ((u32)t__2e488) goto L_passed_2e487; else goto L_failed_2e486;
+	L_failed_2e486:;
+	t_abortsite_2e410 = ((u64)2UL);
+	goto L_abort_2e411;
+	L_passed_2e487:;
+	t_field_2e582 = (u64)((u64)((u64)((char *)&D_g3)) + (u64)((u64)0UL));
+	t__2e583 = (u64)(u32)(*(u32 *)t_field_2e582);
+	t__2e581 = (u64)(u32)(((u32)t__2e583 == (u32)((u64)0UL)));
+	t__2e578 = (u64)(u32)t__2e581;
+	if ((u32)t__2e578) goto L__2e579; else goto L__2e580;
+	L__2e579:;
+	t_field_2e585 = (u64)((u64)((u64)((char *)&D_g3)) + (u64)((u64)4UL));
+	t__2e586 = (u64)(u32)(*(u8 *)t_field_2e585);
+	t__2e587 = (u64)(u32)((u8)t__2e586);
+	t__2e588 = (u64)(u32)((u8)((u64)0UL));
+	t__2e584 = (u64)(u32)(((u32)t__2e587 == (u32)t__2e588));
+	t__2e578 = (u64)(u32)t__2e584;
+	goto L__2e580;
+	L__2e580:;
+	t__2e575 = (u64)(u32)t__2e578;
+	if ((u32)t__2e575) goto L__2e576; else goto L__2e577;
+	L__2e576:;
+	t_field_2e590 = (u64)((u64)((u64)((char *)&D_g3)) + (u64)((u64)8UL));
+	t__2e591 = (u64)(u32)(*(i32 *)t_field_2e590);
+	t__2e589 = (u64)(u32)(((u32)t__2e591 == (u32)((u64)0UL)));
+	t__2e575 = (u64)(u32)t__2e589;
+	goto L__2e577;
+	L__2e577:;
+	t__2e572 = (u64)(u32)t__2e575;
+	if ((u32)t__2e572) goto L__2e573; else goto L__2e574;
+	L__2e573:;
+	t_field_2e593 = (u64)((u64)((u64)((char *)&D_g3)) + (u64)((u64)12UL));
+	t__2e594 = (u64)(u32)(*(i32 *)t_field_2e593);
+	t__2e595 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e592 = (u64)(u32)(((u32)t__2e594 == (u32)t__2e595));
+	t__2e572 = (u64)(u32)t__2e592;
+	goto L__2e574;
+	L__2e574:;
+	t__2e569 = (u64)(u32)t__2e572;
+	if ((u32)t__2e569) goto L__2e570; else goto L__2e571;
+	L__2e570:;
+	t_field_2e597 = (u64)((u64)((u64)((char *)&D_g3)) + (u64)((u64)16UL));
+	t__2e598 = (u64)(u32)(*(i32 *)t_field_2e597);
+	t__2e599 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e596 = (u64)(u32)(((u32)t__2e598 == (u32)t__2e599));
+	t__2e569 = (u64)(u32)t__2e596;
+	goto L__2e571;
+	L__2e571:;
+	t__2e566 = (u64)(u32)t__2e569;
+	if ((u32)t__2e566) goto L__2e567; else goto L__2e568;
+	L__2e567:;
+	t_field_2e601 = (u64)((u64)((u64)((char *)&D_g3)) + (u64)((u64)24UL));
+	t__2e602 = (u64)(u32)(*(i32 *)t_field_2e601);
+	t__2e600 = (u64)(u32)(((u32)t__2e602 == (u32)((u64)20UL)));
+	t__2e566 = (u64)(u32)t__2e600;
+	goto L__2e568;
+	L__2e568:;
+	t__2e563 = (u64)(u32)t__2e566;
+	if ((u32)t__2e563) goto L__2e564; else goto L__2e565;
+	L__2e564:;
+	t_field_2e604 = (u64)((u64)((u64)((char *)&D_g3)) + (u64)((u64)32UL));
+	t_value_2e605 = (u64)((u64)t_field_2e604 + (u64)((u64)0UL));
+	t__2e606 = (u64)(u32)(*(i32 *)t_value_2e605);
+	t__2e603 = (u64)(u32)(((u32)t__2e606 == (u32)((u64)0UL)));
+	t__2e563 = (u64)(u32)t__2e603;
+	goto L__2e565;
+	L__2e565:;
+	t__2e560 = (u64)(u32)t__2e563;
+	if ((u32)t__2e560) goto L__2e561; else goto L__2e562;
+	L__2e561:;
+	t_field_2e608 = (u64)((u64)((u64)((char *)&D_g3)) + (u64)((u64)32UL));
+	t_value_2e609 = (u64)((u64)t_field_2e608 + (u64)((u64)8UL));
+	BLIT((u64)B11, t_value_2e609, 24);
+	BLIT((u64)B12, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e607 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B11, (u64)B12));
+	t__2e560 = (u64)(u32)t__2e607;
+	goto L__2e562;
+	L__2e562:;
+	t__2e557 = (u64)(u32)t__2e560;
+	if ((u32)t__2e557) goto L__2e558; else goto L__2e559;
+	L__2e558:;
+	t_field_2e611 = (u64)((u64)((u64)((char *)&D_g3)) + (u64)((u64)64UL));
+	t__2e612 = (u64)(u32)(*(i32 *)t_field_2e611);
+	t__2e610 = (u64)(u32)(((u32)t__2e612 == (u32)((u64)0UL)));
+	t__2e557 = (u64)(u32)t__2e610;
+	goto L__2e559;
+	L__2e559:;
+	t__2e554 = (u64)(u32)t__2e557;
+	if ((u32)t__2e554) goto L__2e555; else goto L__2e556;
+	L__2e555:;
+	t_field_2e614 = (u64)((u64)((u64)((char *)&D_g3)) + (u64)((u64)72UL));
+	t__2e615 = (u64)(*(u64 *)t_field_2e614);
+	t__2e616 = ((u64)0UL);
+	t__2e613 = (u64)(u32)(((u64)t__2e615 == (u64)t__2e616));
+	t__2e554 = (u64)(u32)t__2e613;
+	goto L__2e556;
+	L__2e556:;
+	if ((u32)t__2e554) goto L_passed_2e553; else goto L_failed_2e552;
+	L_failed_2e552:;
+	t_abortsite_2e410 = ((u64)3UL);
+	goto L_abort_2e411;
+	L_passed_2e553:;
+	t_field_2e647 = (u64)((u64)((u64)((char *)&D_g4)) + (u64)((u64)0UL));
+	t__2e648 = (u64)(u32)(*(u32 *)t_field_2e647);
+	t__2e646 = (u64)(u32)(((u32)t__2e648 == (u32)((u64)0UL)));
+	t__2e643 = (u64)(u32)t__2e646;
+	if ((u32)t__2e643) goto L__2e644; else goto L__2e645;
+	L__2e644:;
+	t_field_2e650 = (u64)((u64)((u64)((char *)&D_g4)) + (u64)((u64)4UL));
+	t__2e651 = (u64)(u32)(*(u8 *)t_field_2e650);
+	t__2e652 = (u64)(u32)((u8)t__2e651);
+	t__2e653 = (u64)(u32)((u8)((u64)0UL));
+	t__2e649 = (u64)(u32)(((u32)t__2e652 == (u32)t__2e653));
+	t__2e643 = (u64)(u32)t__2e649;
+	goto L__2e645;
+	L__2e645:;
+	t__2e640 = (u64)(u32)t__2e643;
+	if ((u32)t__2e640) goto L__2e641; else goto L__2e642;
+	L__2e641:;
+	t_field_2e655 = (u64)((u64)((u64)((char *)&D_g4)) + (u64)((u64)8UL));
+	t__2e656 = (u64)(u32)(*(i32 *)t_field_2e655);
+	t__2e654 = (u64)(u32)(((u32)t__2e656 == (u32)((u64)0UL)));
+	t__2e640 = (u64)(u32)t__2e654;
+	goto L__2e642;
+	L__2e642:;
+	t__2e637 = (u64)(u32)t__2e640;
+	if ((u32)t__2e637) goto L__2e638; else goto L__2e639;
+	L__2e638:;
+	t_field_2e658 = (u64)((u64)((u64)((char *)&D_g4)) + (u64)((u64)12UL));
+	t__2e659 = (u64)(u32)(*(i32 *)t_field_2e658);
+	t__2e657 = (u64)(u32)(((u32)t__2e659 == (u32)((u64)0UL)));
+	t__2e637 = (u64)(u32)t__2e657;
+	goto L__2e639;
+	L__2e639:;
+	t__2e634 = (u64)(u32)t__2e637;
+	if ((u32)t__2e634) goto L__2e635; else goto L__2e636;
+	L__2e635:;
+	t_field_2e661 = (u64)((u64)((u64)((char *)&D_g4)) + (u64)((u64)16UL));
+	t__2e662 = (u64)(u32)(*(i32 *)t_field_2e661);
+	t__2e663 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e660 = (u64)(u32)(((u32)t__2e662 == (u32)t__2e663));
+	t__2e634 = (u64)(u32)t__2e660;
+	goto L__2e636;
+	L__2e636:;
+	t__2e631 = (u64)(u32)t__2e634;
+	if ((u32)t__2e631) goto L__2e632; else goto L__2e633;
+	L__2e632:;
+	t_field_2e665 = (u64)((u64)((u64)((char *)&D_g4)) + (u64)((u64)24UL));
+	t__2e666 = (u64)(u32)(*(i32 *)t_field_2e665);
+	t__2e664 = (u64)(u32)(((u32)t__2e666 == (u32)((u64)20UL)));
+	t__2e631 = (u64)(u32)t__2e664;
+	goto L__2e633;
+	L__2e633:;
+	t__2e628 = (u64)(u32)t__2e631;
+	if ((u32)t__2e628) goto L__2e629; else goto L__2e630;
+	L__2e629:;
+	t_field_2e668 = (u64)((u64)((u64)((char *)&D_g4)) + (u64)((u64)32UL));
+	t_value_2e669 = (u64)((u64)t_field_2e668 + (u64)((u64)0UL));
+	t__2e670 = (u64)(u32)(*(i32 *)t_value_2e669);
+	t__2e667 = (u64)(u32)(((u32)t__2e670 == (u32)((u64)0UL)));
+	t__2e628 = (u64)(u32)t__2e667;
+	goto L__2e630;
+	L__2e630:;
+	t__2e625 = (u64)(u32)t__2e628;
+	if ((u32)t__2e625) goto L__2e626; else goto L__2e627;
+	L__2e626:;
+	t_field_2e672 = (u64)((u64)((u64)((char *)&D_g4)) + (u64)((u64)32UL));
+	t_value_2e673 = (u64)((u64)t_field_2e672 + (u64)((u64)8UL));
+	BLIT((u64)B13, t_value_2e673, 24);
+	BLIT((u64)B14, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e671 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B13, (u64)B14));
+	t__2e625 = (u64)(u32)t__2e671;
+	goto L__2e627;
+	L__2e627:;
+	t__2e622 = (u64)(u32)t__2e625;
+	if ((u32)t__2e622) goto L__2e623; else goto L__2e624;
+	L__2e623:;
+	t_field_2e675 = (u64)((u64)((u64)((char *)&D_g4)) + (u64)((u64)64UL));
+	t__2e676 = (u64)(u32)(*(i32 *)t_field_2e675);
+	t__2e674 = (u64)(u32)(((u32)t__2e676 == (u32)((u64)0UL)));
+	t__2e622 = (u64)(u32)t__2e674;
+	goto L__2e624;
+	L__2e624:;
+	t__2e619 = (u64)(u32)t__2e622;
+	if ((u32)t__2e619) goto L__2e620; else goto L__2e621;
+	L__2e620:;
+	t_field_2e678 = (u64)((u64)((u64)((char *)&D_g4)) + (u64)((u64)72UL));
+	t__2e679 = (u64)(*(u64 *)t_field_2e678);
+	t__2e680 = ((u64)0UL);
+	t__2e677 = (u64)(u32)(((u64)t__2e679 == (u64)t__2e680));
+	t__2e619 = (u64)(u32)t__2e677;
+	goto L__2e621;
+	L__2e621:;
+	if ((u32)t__2e619) goto L_passed_2e618; else goto L_failed_2e617;
+	L_failed_2e617:;
+	t_abortsite_2e410 = ((u64)4UL);
+	goto L_abort_2e411;
+	L_passed_2e618:;
+	t_field_2e711 = (u64)((u64)((u64)((char *)&D_g5)) + (u64)((u64)0UL));
+	t__2e712 = (u64)(u32)(*(u32 *)t_field_2e711);
+	t__2e710 = (u64)(u32)(((u32)t__2e712 == (u32)((u64)0UL)));
+	t__2e707 = (u64)(u32)t__2e710;
+	if ((u32)t__2e707) goto L__2e708; else goto L__2e709;
+	L__2e708:;
+	t_field_2e714 = (u64)((u64)((u64)((char *)&D_g5)) + (u64)((u64)4UL));
+	t__2e715 = (u64)(u32)(*(u8 *)t_field_2e714);
+	t__2e716 = (u64)(u32)((u8)t__2e715);
+	t__2e717 = (u64)(u32)((u8)((u64)0UL));
+	t__2e713 = (u64)(u32)(((u32)t__2e716 == (u32)t__2e717));
+	t__2e707 = (u64)(u32)t__2e713;
+	goto L__2e709;
+	L__2e709:;
+	t__2e704 = (u64)(u32)t__2e707;
+	if ((u32)t__2e704) goto L__2e705; else goto L__2e706;
+	L__2e705:;
+	t_field_2e719 = (u64)((u64)((u64)((char *)&D_g5)) + (u64)((u64)8UL));
+	t__2e720 = (u64)(u32)(*(i32 *)t_field_2e719);
+	t__2e718 = (u64)(u32)(((u32)t__2e720 == (u32)((u64)0UL)));
+	t__2e704 = (u64)(u32)t__2e718;
+	goto L__2e706;
+	L__2e706:;
+	t__2e701 = (u64)(u32)t__2e704;
+	if ((u32)t__2e701) goto L__2e702; else goto L__2e703;
+	L__2e702:;
+	t_field_2e722 = (u64)((u64)((u64)((char *)&D_g5)) + (u64)((u64)12UL));
+	t__2e723 = (u64)(u32)(*(i32 *)t_field_2e722);
+	t__2e721 = (u64)(u32)(((u32)t__2e723 == (u32)((u64)0UL)));
+	t__2e701 = (u64)(u32)t__2e721;
+	goto L__2e703;
+	L__2e703:;
+	t__2e698 = (u64)(u32)t__2e701;
+	if ((u32)t__2e698) goto L__2e699; else goto L__2e700;
+	L__2e699:;
+	t_field_2e725 = (u64)((u64)((u64)((char *)&D_g5)) + (u64)((u64)16UL));
+	t__2e726 = (u64)(u32)(*(i32 *)t_field_2e725);
+	t__2e724 = (u64)(u32)(((u32)t__2e726 == (u32)((u64)0UL)));
+	t__2e698 = (u64)(u32)t__2e724;
+	goto L__2e700;
+	L__2e700:;
+	t__2e695 = (u64)(u32)t__2e698;
+	if ((u32)t__2e695) goto L__2e696; else goto L__2e697;
+	L__2e696:;
+	t_field_2e728 = (u64)((u64)((u64)((char *)&D_g5)) + (u64)((u64)24UL));
+	t__2e729 = (u64)(u32)(*(i32 *)t_field_2e728);
+	t__2e727 = (u64)(u32)(((u32)t__2e729 == (u32)((u64)20UL)));
+	t__2e695 = (u64)(u32)t__2e727;
+	goto L__2e697;
+	L__2e697:;
+	t__2e692 = (u64)(u32)t__2e695;
+	if ((u32)t__2e692) goto L__2e693; else goto L__2e694;
+	L__2e693:;
+	t_field_2e731 = (u64)((u64)((u64)((char *)&D_g5)) + (u64)((u64)32UL));
+	t_value_2e732 = (u64)((u64)t_field_2e731 + (u64)((u64)0UL));
+	t__2e733 = (u64)(u32)(*(i32 *)t_value_2e732);
+	t__2e730 = (u64)(u32)(((u32)t__2e733 == (u32)((u64)0UL)));
+	t__2e692 = (u64)(u32)t__2e730;
+	goto L__2e694;
+	L__2e694:;
+	t__2e689 = (u64)(u32)t__2e692;
+	if ((u32)t__2e689) goto L__2e690; else goto L__2e691;
+	L__2e690:;
+	t_field_2e735 = (u64)((u64)((u64)((char *)&D_g5)) + (u64)((u64)32UL));
+	t_value_2e736 = (u64)((u64)t_field_2e735 + (u64)((u64)8UL));
+	BLIT((u64)B15, t_value_2e736, 24);
+	BLIT((u64)B16, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e734 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B15, (u64)B16));
+	t__2e689 = (u64)(u32)t__2e734;
+	goto L__2e691;
+	L__2e691:;
+	t__2e686 = (u64)(u32)t__2e689;
+	if ((u32)t__2e686) goto L__2e687; else goto L__2e688;
+	L__2e687:;
+	t_field_2e738 = (u64)((u64)((u64)((char *)&D_g5)) + (u64)((u64)64UL));
+	t__2e739 = (u64)(u32)(*(i32 *)t_field_2e738);
+	t__2e737 = (u64)(u32)(((u32)t__2e739 == (u32)((u64)0UL)));
+	t__2e686 = (u64)(u32)t__2e737;
+	goto L__2e688;
+	L__2e688:;
+	t__2e683 = (u64)(u32)t__2e686;
+	if ((u32)t__2e683) goto L__2e684; else goto L__2e685;
+	L__2e684:;
+	t_field_2e741 = (u64)((u64)((u64)((char *)&D_g5)) + (u64)((u64)72UL));
+	t__2e742 = (u64)(*(u64 *)t_field_2e741);
+	t__2e743 = ((u64)0UL);
+	t__2e740 = (u64)(u32)(((u64)t__2e742 == (u64)t__2e743));
+	t__2e683 = (u64)(u32)t__2e740;
+	goto L__2e685;
+	L__2e685:;
+	if ((u32)t__2e683) goto L_passed_2e682; else goto L_failed_2e681;
+	L_failed_2e681:;
+	t_abortsite_2e410 = ((u64)5UL);
+	goto L_abort_2e411;
+	L_passed_2e682:;
+	t_field_2e774 = (u64)((u64)((u64)((char *)&D_g6)) + (u64)((u64)0UL));
+	t__2e775 = (u64)(u32)(*(u32 *)t_field_2e774);
+	t__2e773 = (u64)(u32)(((u32)t__2e775 == (u32)((u64)0UL)));
+	t__2e770 = (u64)(u32)t__2e773;
+	if ((u32)t__2e770) goto L__2e771; else goto L__2e772;
+	L__2e771:;
+	t_field_2e777 = (u64)((u64)((u64)((char *)&D_g6)) + (u64)((u64)4UL));
+	t__2e778 = (u64)(u32)(*(u8 *)t_field_2e777);
+	t__2e779 = (u64)(u32)((u8)t__2e778);
+	t__2e780 = (u64)(u32)((u8)((u64)0UL));
+	t__2e776 = (u64)(u32)(((u32)t__2e779 == (u32)t__2e780));
+	t__2e770 = (u64)(u32)t__2e776;
+	goto L__2e772;
+	L__2e772:;
+	t__2e767 = (u64)(u32)t__2e770;
+	if ((u32)t__2e767) goto L__2e768; else goto L__2e769;
+	L__2e768:;
+	t_field_2e782 = (u64)((u64)((u64)((char *)&D_g6)) + (u64)((u64)8UL));
+	t__2e783 = (u64)(u32)(*(i32 *)t_field_2e782);
+	t__2e781 = (u64)(u32)(((u32)t__2e783 == (u32)((u64)0UL)));
+	t__2e767 = (u64)(u32)t__2e781;
+	goto L__2e769;
+	L__2e769:;
+	t__2e764 = (u64)(u32)t__2e767;
+	if ((u32)t__2e764) goto L__2e765; else goto L__2e766;
+	L__2e765:;
+	t_field_2e785 = (u64)((u64)((u64)((char *)&D_g6)) + (u64)((u64)12UL));
+	t__2e786 = (u64)(u32)(*(i32 *)t_field_2e785);
+	t__2e784 = (u64)(u32)(((u32)t__2e786 == (u32)((u64)0UL)));
+	t__2e764 = (u64)(u32)t__2e784;
+	goto L__2e766;
+	L__2e766:;
+	t__2e761 = (u64)(u32)t__2e764;
+	if ((u32)t__2e761) goto L__2e762; else goto L__2e763;
+	L__2e762:;
+	t_field_2e788 = (u64)((u64)((u64)((char *)&D_g6)) + (u64)((u64)16UL));
+	t__2e789 = (u64)(u32)(*(i32 *)t_field_2e788);
+	t__2e787 = (u64)(u32)(((u32)t__2e789 == (u32)((u64)0UL)));
+	t__2e761 = (u64)(u32)t__2e787;
+	goto L__2e763;
+	L__2e763:;
+	t__2e758 = (u64)(u32)t__2e761;
+	if ((u32)t__2e758) goto L__2e759; else goto L__2e760;
+	L__2e759:;
+	t_field_2e791 = (u64)((u64)((u64)((char *)&D_g6)) + (u64)((u64)24UL));
+	t__2e792 = (u64)(u32)(*(i32 *)t_field_2e791);
+	t__2e790 = (u64)(u32)(((u32)t__2e792 == (u32)((u64)0UL)));
+	t__2e758 = (u64)(u32)t__2e790;
+	goto L__2e760;
+	L__2e760:;
+	t__2e755 = (u64)(u32)t__2e758;
+	if ((u32)t__2e755) goto L__2e756; else goto L__2e757;
+	L__2e756:;
+	t_field_2e794 = (u64)((u64)((u64)((char *)&D_g6)) + (u64)((u64)32UL));
+	t_value_2e795 = (u64)((u64)t_field_2e794 + (u64)((u64)0UL));
+	t__2e796 = (u64)(u32)(*(i32 *)t_value_2e795);
+	t__2e793 = (u64)(u32)(((u32)t__2e796 == (u32)((u64)0UL)));
+	t__2e755 = (u64)(u32)t__2e793;
+	goto L__2e757;
+	L__2e757:;
+	t__2e752 = (u64)(u32)t__2e755;
+	if ((u32)t__2e752) goto L__2e753; else goto L__2e754;
+	L__2e753:;
+	t_field_2e798 = (u64)((u64)((u64)((char *)&D_g6)) + (u64)((u64)32UL));
+	t_value_2e799 = (u64)((u64)t_field_2e798 + (u64)((u64)8UL));
+	BLIT((u64)B17, t_value_2e799, 24);
+	BLIT((u64)B18, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e797 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B17, (u64)B18));
+	t__2e752 = (u64)(u32)t__2e797;
+	goto L__2e754;
+	L__2e754:;
+	t__2e749 = (u64)(u32)t__2e752;
+	if ((u32)t__2e749) goto L__2e750; else goto L__2e751;
+	L__2e750:;
+	t_field_2e801 = (u64)((u64)((u64)((char *)&D_g6)) + (u64)((u64)64UL));
+	t__2e802 = (u64)(u32)(*(i32 *)t_field_2e801);
+	t__2e800 = (u64)(u32)(((u32)t__2e802 == (u32)((u64)0UL)));
+	t__2e749 = (u64)(u32)t__2e800;
+	goto L__2e751;
+	L__2e751:;
+	t__2e746 = (u64)(u32)t__2e749;
+	if ((u32)t__2e746) goto L__2e747; else goto L__2e748;
+	L__2e747:;
+	t_field_2e804 = (u64)((u64)((u64)((char *)&D_g6)) + (u64)((u64)72UL));
+	t__2e805 = (u64)(*(u64 *)t_field_2e804);
+	t__2e806 = ((u64)0UL);
+	t__2e803 = (u64)(u32)(((u64)t__2e805 == (u64)t__2e806));
+	t__2e746 = (u64)(u32)t__2e803;
+	goto L__2e748;
+	L__2e748:;
+	if ((u32)t__2e746) goto L_passed_2e745; else goto L_failed_2e744;
+	L_failed_2e744:;
+	t_abortsite_2e410 = ((u64)6UL);
+	goto L_abort_2e411;
+	L_passed_2e745:;
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t_binding_2e807, (u64)((u64)0UL), (u64)((u64)80UL));
+	t_field_2e808 = (u64)((u64)t_binding_2e807 + (u64)((u64)4UL));
+	*(u8 *)t_field_2e808 = (u8)((u64)4UL);
+	t_field_2e808 = (u64)((u64)t_binding_2e807 + (u64)((u64)8UL));
+	t__2e809 = (u64)(u32)(-(u32)((u64)1UL));
+	*(u32 *)t_field_2e808 = (u32)t__2e809;
+	t_field_2e808 = (u64)((u64)t_binding_2e807 + (u64)((u64)12UL));
+	t__2e810 = (u64)(u32)(-(u32)((u64)2UL));
+	*(u32 *)t_field_2e808 = (u32)t__2e810;
+	t_field_2e808 = (u64)((u64)t_binding_2e807 + (u64)((u64)16UL));
+	t__2e811 = (u64)(u32)(-(u32)((u64)3UL));
+	*(u32 *)t_field_2e808 = (u32)t__2e811;
+	t_field_2e808 = (u64)((u64)t_binding_2e807 + (u64)((u64)24UL));
+	*(u32 *)t_field_2e808 = (u32)((u64)20UL);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t_binding_2e812, (u64)((u64)0UL), (u64)((u64)80UL));
+	t_field_2e813 = (u64)((u64)t_binding_2e812 + (u64)((u64)8UL));
+	t__2e814 = (u64)(u32)(-(u32)((u64)1UL));
+	*(u32 *)t_field_2e813 = (u32)t__2e814;
+	t_field_2e813 = (u64)((u64)t_binding_2e812 + (u64)((u64)12UL));
+	t__2e815 = (u64)(u32)(-(u32)((u64)2UL));
+	*(u32 *)t_field_2e813 = (u32)t__2e815;
+	t_field_2e813 = (u64)((u64)t_binding_2e812 + (u64)((u64)16UL));
+	t__2e816 = (u64)(u32)(-(u32)((u64)3UL));
+	*(u32 *)t_field_2e813 = (u32)t__2e816;
+	t_field_2e813 = (u64)((u64)t_binding_2e812 + (u64)((u64)24UL));
+	*(u32 *)t_field_2e813 = (u32)((u64)20UL);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t_binding_2e817, (u64)((u64)0UL), (u64)((u64)80UL));
+	t_field_2e818 = (u64)((u64)t_binding_2e817 + (u64)((u64)12UL));
+	t__2e819 = (u64)(u32)(-(u32)((u64)2UL));
+	*(u32 *)t_field_2e818 = (u32)t__2e819;
+	t_field_2e818 = (u64)((u64)t_binding_2e817 + (u64)((u64)16UL));
+	t__2e820 = (u64)(u32)(-(u32)((u64)3UL));
+	*(u32 *)t_field_2e818 = (u32)t__2e820;
+	t_field_2e818 = (u64)((u64)t_binding_2e817 + (u64)((u64)24UL));
+	*(u32 *)t_field_2e818 = (u32)((u64)20UL);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t_binding_2e821, (u64)((u64)0UL), (u64)((u64)80UL));
+	t_field_2e822 = (u64)((u64)t_binding_2e821 + (u64)((u64)16UL));
+	t__2e823 = (u64)(u32)(-(u32)((u64)3UL));
+	*(u32 *)t_field_2e822 = (u32)t__2e823;
+	t_field_2e822 = (u64)((u64)t_binding_2e821 + (u64)((u64)24UL));
+	*(u32 *)t_field_2e822 = (u32)((u64)20UL);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t_binding_2e824, (u64)((u64)0UL), (u64)((u64)80UL));
+	t_field_2e825 = (u64)((u64)t_binding_2e824 + (u64)((u64)24UL));
+	*(u32 *)t_field_2e825 = (u32)((u64)20UL);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t_binding_2e826, (u64)((u64)0UL), (u64)((u64)80UL));
+	t_field_2e858 = (u64)((u64)t_binding_2e807 + (u64)((u64)0UL));
+	t__2e859 = (u64)(u32)(*(u32 *)t_field_2e858);
+	t__2e857 = (u64)(u32)(((u32)t__2e859 == (u32)((u64)0UL)));
+	t__2e854 = (u64)(u32)t__2e857;
+	if ((u32)t__2e854) goto L__2e855; else goto L__2e856;
+	L__2e855:;
+	t_field_2e861 = (u64)((u64)t_binding_2e807 + (u64)((u64)4UL));
+	t__2e862 = (u64)(u32)(*(u8 *)t_field_2e861);
+	t__2e863 = (u64)(u32)((u8)t__2e862);
+	t__2e864 = (u64)(u32)((u8)((u64)4UL));
+	t__2e860 = (u64)(u32)(((u32)t__2e863 == (u32)t__2e864));
+	t__2e854 = (u64)(u32)t__2e860;
+	goto L__2e856;
+	L__2e856:;
+	t__2e851 = (u64)(u32)t__2e854;
+	if ((u32)t__2e851) goto L__2e852; else goto L__2e853;
+	L__2e852:;
+	t_field_2e866 = (u64)((u64)t_binding_2e807 + (u64)((u64)8UL));
+	t__2e867 = (u64)(u32)(*(i32 *)t_field_2e866);
+	t__2e868 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e865 = (u64)(u32)(((u32)t__2e867 == (u32)t__2e868));
+	t__2e851 = (u64)(u32)t__2e865;
+	goto L__2e853;
+	L__2e853:;
+	t__2e848 = (u64)(u32)t__2e851;
+	if ((u32)t__2e848) goto L__2e849; else goto L__2e850;
+	L__2e849:;
+	t_field_2e870 = (u64)((u64)t_binding_2e807 + (u64)((u64)12UL));
+	t__2e871 = (u64)(u32)(*(i32 *)t_field_2e870);
+	t__2e872 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e869 = (u64)(u32)(((u32)t__2e871 == (u32)t__2e872));
+	t__2e848 = (u64)(u32)t__2e869;
+	goto L__2e850;
+	L__2e850:;
+	t__2e845 = (u64)(u32)t__2e848;
+	if ((u32)t__2e845) goto L__2e846; else goto L__2e847;
+	L__2e846:;
+	t_field_2e874 = (u64)((u64)t_binding_2e807 + (u64)((u64)16UL));
+	t__2e875 = (u64)(u32)(*(i32 *)t_field_2e874);
+	t__2e876 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e873 = (u64)(u32)(((u32)t__2e875 == (u32)t__2e876));
+	t__2e845 = (u64)(u32)t__2e873;
+	goto L__2e847;
+	L__2e847:;
+	t__2e842 = (u64)(u32)t__2e845;
+	if ((u32)t__2e842) goto L__2e843; else goto L__2e844;
+	L__2e843:;
+	t_field_2e878 = (u64)((u64)t_binding_2e807 + (u64)((u64)24UL));
+	t__2e879 = (u64)(u32)(*(i32 *)t_field_2e878);
+	t__2e877 = (u64)(u32)(((u32)t__2e879 == (u32)((u64)20UL)));
+	t__2e842 = (u64)(u32)t__2e877;
+	goto L__2e844;
+	L__2e844:;
+	t__2e839 = (u64)(u32)t__2e842;
+	if ((u32)t__2e839) goto L__2e840; else goto L__2e841;
+	L__2e840:;
+	t_field_2e881 = (u64)((u64)t_binding_2e807 + (u64)((u64)32UL));
+	t_value_2e882 = (u64)((u64)t_field_2e881 + (u64)((u64)0UL));
+	t__2e883 = (u64)(u32)(*(i32 *)t_value_2e882);
+	t__2e880 = (u64)(u32)(((u32)t__2e883 == (u32)((u64)0UL)));
+	t__2e839 = (u64)(u32)t__2e880;
+	goto L__2e841;
+	L__2e841:;
+	t__2e836 = (u64)(u32)t__2e839;
+	if ((u32)t__2e836) goto L__2e837; else goto L__2e838;
+	L__2e837:;
+	t_field_2e885 = (u64)((u64)t_binding_2e807 + (u64)((u64)32UL));
+	t_value_2e886 = (u64)((u64)t_field_2e885 + (u64)((u64)8UL));
+	BLIT((u64)B19, t_value_2e886, 24);
+	BLIT((u64)B20, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e884 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B19, (u64)B20));
+	t__2e836 = (u64)(u32)t__2e884;
+	goto L__2e838;
+	L__2e838:;
+	t__2e833 = (u64)(u32)t__2e836;
+	if ((u32)t__2e833) goto L__2e834; else goto L__2e835;
+	L__2e834:;
+	t_field_2e888 = (u64)((u64)t_binding_2e807 + (u64)((u64)64UL));
+	t__2e889 = (u64)(u32)(*(i32 *)t_field_2e888);
+	t__2e887 = (u64)(u32)(((u32)t__2e889 == (u32)((u64)0UL)));
+	t__2e833 = (u64)(u32)t__2e887;
+	goto L__2e835;
+	L__2e835:;
+	t__2e830 = (u64)(u32)t__2e833;
+	if ((u32)t__2e830) goto L__2e831; else goto L__2e832;
+	L__2e831:;
+	t_field_2e891 = (u64)((u64)t_binding_2e807 + (u64)((u64)72UL));
+	t__2e892 = (u64)(*(u64 *)t_field_2e891);
+	t__2e893 = ((u64)0UL);
+	t__2e890 = (u64)(u32)(((u64)t__2e892 == (u64)t__2e893));
+	t__2e830 = (u64)(u32)t__2e890;
+	goto L__2e832;
+	L__2e832:;
+	if ((u32)t__2e830) goto L_passed_2e829; else goto L_failed_2e828;
+	L_failed_2e828:;
+	t_abortsite_2e410 = ((u64)7UL);
+	goto L_abort_2e411;
+	L_passed_2e829:;
+	t_field_2e924 = (u64)((u64)t_binding_2e812 + (u64)((u64)0UL));
+	t__2e925 = (u64)(u32)(*(u32 *)t_field_2e924);
+	t__2e923 = (u64)(u32)(((u32)t__2e925 == (u32)((u64)0UL)));
+	t__2e920 = (u64)(u32)t__2e923;
+	if ((u32)t__2e920) goto L__2e921; else goto L__2e922;
+	L__2e921:;
+	t_field_2e927 = (u64)((u64)t_binding_2e812 + (u64)((u64)4UL));
+	t__2e928 = (u64)(u32)(*(u8 *)t_field_2e927);
+	t__2e929 = (u64)(u32)((u8)t__2e928);
+	t__2e930 = (u64)(u32)((u8)((u64)0UL));
+	t__2e926 = (u64)(u32)(((u32)t__2e929 == (u32)t__2e930));
+	t__2e920 = (u64)(u32)t__2e926;
+	goto L__2e922;
+	L__2e922:;
+	t__2e917 = (u64)(u32)t__2e920;
+	if ((u32)t__2e917) goto L__2e918; else goto L__2e919;
+	L__2e918:;
+	t_field_2e932 = (u64)((u64)t_binding_2e812 + (u64)((u64)8UL));
+	t__2e933 = (u64)(u32)(*(i32 *)t_field_2e932);
+	t__2e934 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e931 = (u64)(u32)(((u32)t__2e933 == (u32)t__2e934));
+	t__2e917 = (u64)(u32)t__2e931;
+	goto L__2e919;
+	L__2e919:;
+	t__2e914 = (u64)(u32)t__2e917;
+	if ((u32)t__2e914) goto L__2e915; else goto L__2e916;
+	L__2e915:;
+	t_field_2e936 = (u64)((u64)t_binding_2e812 + (u64)((u64)12UL));
+	t__2e937 = (u64)(u32)(*(i32 *)t_field_2e936);
+	t__2e938 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e935 = (u64)(u32)(((u32)t__2e937 == (u32)t__2e938));
+	t__2e914 = (u64)(u32)t__2e935;
+	goto L__2e916;
+	L__2e916:;
+	t__2e911 = (u64)(u32)t__2e914;
+	if ((u32)t__2e911) goto L__2e912; else goto L__2e913;
+	L__2e912:;
+	t_field_2e940 = (u64)((u64)t_binding_2e812 + (u64)((u64)16UL));
+	t__2e941 = (u64)(u32)(*(i32 *)t_field_2e940);
+	t__2e942 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e939 = (u64)(u32)(((u32)t__2e941 == (u32)t__2e942));
+	t__2e911 = (u64)(u32)t__2e939;
+	goto L__2e913;
+	L__2e913:;
+	t__2e908 = (u64)(u32)t__2e911;
+	if ((u32)t__2e908) goto L__2e909; else goto L__2e910;
+	L__2e909:;
+	t_field_2e944 = (u64)((u64)t_binding_2e812 + (u64)((u64)24UL));
+	t__2e945 = (u64)(u32)(*(i32 *)t_field_2e944);
+	t__2e943 = (u64)(u32)(((u32)t__2e945 == (u32)((u64)20UL)));
+	t__2e908 = (u64)(u32)t__2e943;
+	goto L__2e910;
+	L__2e910:;
+	t__2e905 = (u64)(u32)t__2e908;
+	if ((u32)t__2e905) goto L__2e906; else goto L__2e907;
+	L__2e906:;
+	t_field_2e947 = (u64)((u64)t_binding_2e812 + (u64)((u64)32UL));
+	t_value_2e948 = (u64)((u64)t_field_2e947 + (u64)((u64)0UL));
+	t__2e949 = (u64)(u32)(*(i32 *)t_value_2e948);
+	t__2e946 = (u64)(u32)(((u32)t__2e949 == (u32)((u64)0UL)));
+	t__2e905 = (u64)(u32)t__2e946;
+	goto L__2e907;
+	L__2e907:;
+	t__2e902 = (u64)(u32)t__2e905;
+	if ((u32)t__2e902) goto L__2e903; else goto L__2e904;
+	L__2e903:;
+	t_field_2e951 = (u64)((u64)t_binding_2e812 + (u64)((u64)32UL));
+	t_value_2e952 = (u64)((u64)t_field_2e951 + (u64)((u64)8UL));
+	BLIT((u64)B21, t_value_2e952, 24);
+	BLIT((u64)B22, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e950 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B21, (u64)B22));
+	t__2e902 = (u64)(u32)t__2e950;
+	goto L__2e904;
+	L__2e904:;
+	t__2e899 = (u64)(u32)t__2e902;
+	if ((u32)t__2e899) goto L__2e900; else goto L__2e901;
+	L__2e900:;
+	t_field_2e954 = (u64)((u64)t_binding_2e812 + (u64)((u64)64UL));
+	t__2e955 = (u64)(u32)(*(i32 *)t_field_2e954);
+	t__2e953 = (u64)(u32)(((u32)t__2e955 == (u32)((u64)0UL)));
+	t__2e899 = (u64)(u32)t__2e953;
+	goto L__2e901;
+	L__2e901:;
+	t__2e896 = (u64)(u32)t__2e899;
+	if ((u32)t__2e896) goto L__2e897; else goto L__2e898;
+	L__2e897:;
+	t_field_2e957 = (u64)((u64)t_binding_2e812 + (u64)((u64)72UL));
+	t__2e958 = (u64)(*(u64 *)t_field_2e957);
+	t__2e959 = ((u64)0UL);
+	t__2e956 = (u64)(u32)(((u64)t__2e958 == (u64)t__2e959));
+	t__2e896 = (u64)(u32)t__2e956;
+	goto L__2e898;
+	L__2e898:;
+	if ((u32)t__2e896) goto L_passed_2e895; else goto L_failed_2e894;
+	L_failed_2e894:;
+	t_abortsite_2e410 = ((u64)8UL);
+	goto L_abort_2e411;
+	L_passed_2e895:;
+	t_field_2e990 = (u64)((u64)t_binding_2e817 + (u64)((u64)0UL));
+	t__2e991 = (u64)(u32)(*(u32 *)t_field_2e990);
+	t__2e989 = (u64)(u32)(((u32)t__2e991 == (u32)((u64)0UL)));
+	t__2e986 = (u64)(u32)t__2e989;
+	if ((u32)t__2e986) goto L__2e987; else goto L__2e988;
+	L__2e987:;
+	t_field_2e993 = (u64)((u64)t_binding_2e817 + (u64)((u64)4UL));
+	t__2e994 = (u64)(u32)(*(u8 *)t_field_2e993);
+	t__2e995 = (u64)(u32)((u8)t__2e994);
+	t__2e996 = (u64)(u32)((u8)((u64)0UL));
+	t__2e992 = (u64)(u32)(((u32)t__2e995 == (u32)t__2e996));
+	t__2e986 = (u64)(u32)t__2e992;
+	goto L__2e988;
+	L__2e988:;
+	t__2e983 = (u64)(u32)t__2e986;
+	if ((u32)t__2e983) goto L__2e984; else goto L__2e985;
+	L__2e984:;
+	t_field_2e998 = (u64)((u64)t_binding_2e817 + (u64)((u64)8UL));
+	t__2e999 = (u64)(u32)(*(i32 *)t_field_2e998);
+	t__2e997 = (u64)(u32)(((u32)t__2e999 == (u32)((u64)0UL)));
+	t__2e983 = (u64)(u32)t__2e997;
+	goto L__2e985;
+	L__2e985:;
+	t__2e980 = (u64)(u32)t__2e983;
+	if ((u32)t__2e980) goto L__2e981; else goto L__2e982;
+	L__2e981:;
+	t_field_2e1001 = (u64)((u64)t_binding_2e817 + (u64)((u64)12UL));
+	t__2e1002 = (u64)(u32)(*(i32 *)t_field_2e1001);
+	t__2e1003 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e1000 = (u64)(u32)(((u32)t__2e1002 == (u32)t__2e1003));
+	t__2e980 = (u64)(u32)t__2e1000;
+	goto L__2e982;
+	L__2e982:;
+	t__2e977 = (u64)(u32)t__2e980;
+	if ((u32)t__2e977) goto L__2e978; else goto L__2e979;
+	L__2e978:;
+	t_field_2e1005 = (u64)((u64)t_binding_2e817 + (u64)((u64)16UL));
+	t__2e1006 = (u64)(u32)(*(i32 *)t_field_2e1005);
+	t__2e1007 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e1004 = (u64)(u32)(((u32)t__2e1006 == (u32)t__2e1007));
+	t__2e977 = (u64)(u32)t__2e1004;
+	goto L__2e979;
+	L__2e979:;
+	t__2e974 = (u64)(u32)t__2e977;
+	if ((u32)t__2e974) goto L__2e975; else goto L__2e976;
+	L__2e975:;
+	t_field_2e1009 = (u64)((u64)t_binding_2e817 + (u64)((u64)24UL));
+	t__2e1010 = (u64)(u32)(*(i32 *)t_field_2e1009);
+	t__2e1008 = (u64)(u32)(((u32)t__2e1010 == (u32)((u64)20UL)));
+	t__2e974 = (u64)(u32)t__2e1008;
+	goto L__2e976;
+	L__2e976:;
+	t__2e971 = (u64)(u32)t__2e974;
+	if ((u32)t__2e971) goto L__2e972; else goto L__2e973;
+	L__2e972:;
+	t_field_2e1012 = (u64)((u64)t_binding_2e817 + (u64)((u64)32UL));
+	t_value_2e1013 = (u64)((u64)t_field_2e1012 + (u64)((u64)0UL));
+	t__2e1014 = (u64)(u32)(*(i32 *)t_value_2e1013);
+	t__2e1011 = (u64)(u32)(((u32)t__2e1014 == (u32)((u64)0UL)));
+	t__2e971 = (u64)(u32)t__2e1011;
+	goto L__2e973;
+	L__2e973:;
+	t__2e968 = (u64)(u32)t__2e971;
+	if ((u32)t__2e968) goto L__2e969; else goto L__2e970;
+	L__2e969:;
+	t_field_2e1016 = (u64)((u64)t_binding_2e817 + (u64)((u64)32UL));
+	t_value_2e1017 = (u64)((u64)t_field_2e1016 + (u64)((u64)8UL));
+	BLIT((u64)B23, t_value_2e1017, 24);
+	BLIT((u64)B24, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e1015 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B23, (u64)B24));
+	t__2e968 = (u64)(u32)t__2e1015;
+	goto L__2e970;
+	L__2e970:;
+	t__2e965 = (u64)(u32)t__2e968;
+	if ((u32)t__2e965) goto L__2e966; else goto L__2e967;
+	L__2e966:;
+	t_field_2e1019 = (u64)((u64)t_binding_2e817 + (u64)((u64)64UL));
+	t__2e1020 = (u64)(u32)(*(i32 *)t_field_2e1019);
+	t__2e1018 = (u64)(u32)(((u32)t__2e1020 == (u32)((u64)0UL)));
+	t__2e965 = (u64)(u32)t__2e1018;
+	goto L__2e967;
+	L__2e967:;
+	t__2e962 = (u64)(u32)t__2e965;
+	if ((u32)t__2e962) goto L__2e963; else goto L__2e964;
+	L__2e963:;
+	t_field_2e1022 = (u64)((u64)t_binding_2e817 + (u64)((u64)72UL));
+	t__2e1023 = (u64)(*(u64 *)t_field_2e1022);
+	t__2e1024 = ((u64)0UL);
+	t__2e1021 = (u64)(u32)(((u64)t__2e1023 == (u64)t__2e1024));
+	t__2e962 = (u64)(u32)t__2e1021;
+	goto L__2e964;
+	L__2e964:;
+	if ((u32)t__2e962) goto L_passed_2e961; else goto L_failed_2e960;
+	L_failed_2e960:;
+	t_abortsite_2e410 = ((u64)9UL);
+	goto L_abort_2e411;
+	L_passed_2e961:;
+	t_field_2e1055 = (u64)((u64)t_binding_2e821 + (u64)((u64)0UL));
+	t__2e1056 = (u64)(u32)(*(u32 *)t_field_2e1055);
+	t__2e1054 = (u64)(u32)(((u32)t__2e1056 == (u32)((u64)0UL)));
+	t__2e1051 = (u64)(u32)t__2e1054;
+	if ((u32)t__2e1051) goto L__2e1052; else goto L__2e1053;
+	L__2e1052:;
+	t_field_2e1058 = (u64)((u64)t_binding_2e821 + (u64)((u64)4UL));
+	t__2e1059 = (u64)(u32)(*(u8 *)t_field_2e1058);
+	t__2e1060 = (u64)(u32)((u8)t__2e1059);
+	t__2e1061 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1057 = (u64)(u32)(((u32)t__2e1060 == (u32)t__2e1061));
+	t__2e1051 = (u64)(u32)t__2e1057;
+	goto L__2e1053;
+	L__2e1053:;
+	t__2e1048 = (u64)(u32)t__2e1051;
+	if ((u32)t__2e1048) goto L__2e1049; else goto L__2e1050;
+	L__2e1049:;
+	t_field_2e1063 = (u64)((u64)t_binding_2e821 + (u64)((u64)8UL));
+	t__2e1064 = (u64)(u32)(*(i32 *)t_field_2e1063);
+	t__2e1062 = (u64)(u32)(((u32)t__2e1064 == (u32)((u64)0UL)));
+	t__2e1048 = (u64)(u32)t__2e1062;
+	goto L__2e1050;
+	L__2e1050:;
+	t__2e1045 = (u64)(u32)t__2e1048;
+	if ((u32)t__2e1045) goto L__2e1046; else goto L__2e1047;
+	L__2e1046:;
+	t_field_2e1066 = (u64)((u64)t_binding_2e821 + (u64)((u64)12UL));
+	t__2e1067 = (u64)(u32)(*(i32 *)t_field_2e1066);
+	t__2e1065 = (u64)(u32)(((u32)t__2e1067 == (u32)((u64)0UL)));
+	t__2e1045 = (u64)(u32)t__2e1065;
+	goto L__2e1047;
+	L__2e1047:;
+	t__2e1042 = (u64)(u32)t__2e1045;
+	if ((u32)t__2e1042) goto L__2e1043; else goto L__2e1044;
+	L__2e1043:;
+	t_field_2e1069 = (u64)((u64)t_binding_2e821 + (u64)((u64)16UL));
+	t__2e1070 = (u64)(u32)(*(i32 *)t_field_2e1069);
+	t__2e1071 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e1068 = (u64)(u32)(((u32)t__2e1070 == (u32)t__2e1071));
+	t__2e1042 = (u64)(u32)t__2e1068;
+	goto L__2e1044;
+	L__2e1044:;
+	t__2e1039 = (u64)(u32)t__2e1042;
+	if ((u32)t__2e1039) goto L__2e1040; else goto L__2e1041;
+	L__2e1040:;
+	t_field_2e1073 = (u64)((u64)t_binding_2e821 + (u64)((u64)24UL));
+	t__2e1074 = (u64)(u32)(*(i32 *)t_field_2e1073);
+	t__2e1072 = (u64)(u32)(((u32)t__2e1074 == (u32)((u64)20UL)));
+	t__2e1039 = (u64)(u32)t__2e1072;
+	goto L__2e1041;
+	L__2e1041:;
+	t__2e1036 = (u64)(u32)t__2e1039;
+	if ((u32)t__2e1036) goto L__2e1037; else goto L__2e1038;
+	L__2e1037:;
+	t_field_2e1076 = (u64)((u64)t_binding_2e821 + (u64)((u64)32UL));
+	t_value_2e1077 = (u64)((u64)t_field_2e1076 + (u64)((u64)0UL));
+	t__2e1078 = (u64)(u32)(*(i32 *)t_value_2e1077);
+	t__2e1075 = (u64)(u32)(((u32)t__2e1078 == (u32)((u64)0UL)));
+	t__2e1036 = (u64)(u32)t__2e1075;
+	goto L__2e1038;
+	L__2e1038:;
+	t__2e1033 = (u64)(u32)t__2e1036;
+	if ((u32)t__2e1033) goto L__2e1034; else goto L__2e1035;
+	L__2e1034:;
+	t_field_2e1080 = (u64)((u64)t_binding_2e821 + (u64)((u64)32UL));
+	t_value_2e1081 = (u64)((u64)t_field_2e1080 + (u64)((u64)8UL));
+	BLIT((u64)B25, t_value_2e1081, 24);
+	BLIT((u64)B26, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e1079 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B25, (u64)B26));
+	t__2e1033 = (u64)(u32)t__2e1079;
+	goto L__2e1035;
+	L__2e1035:;
+	t__2e1030 = (u64)(u32)t__2e1033;
+	if ((u32)t__2e1030) goto L__2e1031; else goto L__2e1032;
+	L__2e1031:;
+	t_field_2e1083 = (u64)((u64)t_binding_2e821 + (u64)((u64)64UL));
+	t__2e1084 = (u64)(u32)(*(i32 *)t_field_2e1083);
+	t__2e1082 = (u64)(u32)(((u32)t__2e1084 == (u32)((u64)0UL)));
+	t__2e1030 = (u64)(u32)t__2e1082;
+	goto L__2e1032;
+	L__2e1032:;
+	t__2e1027 = (u64)(u32)t__2e1030;
+	if ((u32)t__2e1027) goto L__2e1028; else goto L__2e1029;
+	L__2e1028:;
+	t_field_2e1086 = (u64)((u64)t_binding_2e821 + (u64)((u64)72UL));
+	t__2e1087 = (u64)(*(u64 *)t_field_2e1086);
+	t__2e1088 = ((u64)0UL);
+	t__2e1085 = (u64)(u32)(((u64)t__2e1087 == (u64)t__2e1088));
+	t__2e1027 = (u64)(u32)t__2e1085;
+	goto L__2e1029;
+	L__2e1029:;
+	if ((u32)t__2e1027) goto L_passed_2e1026; else goto L_failed_2e1025;
+	L_failed_2e1025:;
+	t_abortsite_2e410 = ((u64)10UL);
+	goto L_abort_2e411;
+	L_passed_2e1026:;
+	t_field_2e1119 = (u64)((u64)t_binding_2e824 + (u64)((u64)0UL));
+	t__2e1120 = (u64)(u32)(*(u32 *)t_field_2e1119);
+	t__2e1118 = (u64)(u32)(((u32)t__2e1120 == (u32)((u64)0UL)));
+	t__2e1115 = (u64)(u32)t__2e1118;
+	if ((u32)t__2e1115) goto L__2e1116; else goto L__2e1117;
+	L__2e1116:;
+	t_field_2e1122 = (u64)((u64)t_binding_2e824 + (u64)((u64)4UL));
+	t__2e1123 = (u64)(u32)(*(u8 *)t_field_2e1122);
+	t__2e1124 = (u64)(u32)((u8)t__2e1123);
+	t__2e1125 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1121 = (u64)(u32)(((u32)t__2e1124 == (u32)t__2e1125));
+	t__2e1115 = (u64)(u32)t__2e1121;
+	goto L__2e1117;
+	L__2e1117:;
+	t__2e1112 = (u64)(u32)t__2e1115;
+	if ((u32)t__2e1112) goto L__2e1113; else goto L__2e1114;
+	L__2e1113:;
+	t_field_2e1127 = (u64)((u64)t_binding_2e824 + (u64)((u64)8UL));
+	t__2e1128 = (u64)(u32)(*(i32 *)t_field_2e1127);
+	t__2e1126 = (u64)(u32)(((u32)t__2e1128 == (u32)((u64)0UL)));
+	t__2e1112 = (u64)(u32)t__2e1126;
+	goto L__2e1114;
+	L__2e1114:;
+	t__2e1109 = (u64)(u32)t__2e1112;
+	if ((u32)t__2e1109) goto L__2e1110; else goto L__2e1111;
+	L__2e1110:;
+	t_field_2e1130 = (u64)((u64)t_binding_2e824 + (u64)((u64)12UL));
+	t__2e1131 = (u64)(u32)(*(i32 *)t_field_2e1130);
+	t__2e1129 = (u64)(u32)(((u32)t__2e1131 == (u32)((u64)0UL)));
+	t__2e1109 = (u64)(u32)t__2e1129;
+	goto L__2e1111;
+	L__2e1111:;
+	t__2e1106 = (u64)(u32)t__2e1109;
+	if ((u32)t__2e1106) goto L__2e1107; else goto L__2e1108;
+	L__2e1107:;
+	t_field_2e1133 = (u64)((u64)t_binding_2e824 + (u64)((u64)16UL));
+	t__2e1134 = (u64)(u32)(*(i32 *)t_field_2e1133);
+	t__2e1132 = (u64)(u32)(((u32)t__2e1134 == (u32)((u64)0UL)));
+	t__2e1106 = (u64)(u32)t__2e1132;
+	goto L__2e1108;
+	L__2e1108:;
+	t__2e1103 = (u64)(u32)t__2e1106;
+	if ((u32)t__2e1103) goto L__2e1104; else goto L__2e1105;
+	L__2e1104:;
+	t_field_2e1136 = (u64)((u64)t_binding_2e824 + (u64)((u64)24UL));
+	t__2e1137 = (u64)(u32)(*(i32 *)t_field_2e1136);
+	t__2e1135 = (u64)(u32)(((u32)t__2e1137 == (u32)((u64)20UL)));
+	t__2e1103 = (u64)(u32)t__2e1135;
+	goto L__2e1105;
+	L__2e1105:;
+	t__2e1100 = (u64)(u32)t__2e1103;
+	if ((u32)t__2e1100) goto L__2e1101; else goto L__2e1102;
+	L__2e1101:;
+	t_field_2e1139 = (u64)((u64)t_binding_2e824 + (u64)((u64)32UL));
+	t_value_2e1140 = (u64)((u64)t_field_2e1139 + (u64)((u64)0UL));
+	t__2e1141 = (u64)(u32)(*(i32 *)t_value_2e1140);
+	t__2e1138 = (u64)(u32)(((u32)t__2e1141 == (u32)((u64)0UL)));
+	t__2e1100 = (u64)(u32)t__2e1138;
+	goto L__2e1102;
+	L__2e1102:;
+	t__2e1097 = (u64)(u32)t__2e1100;
+	if ((u32)t__2e1097) goto L__2e1098; else goto L__2e1099;
+	L__2e1098:;
+	t_field_2e1143 = (u64)((u64)t_binding_2e824 + (u64)((u64)32UL));
+	t_value_2e1144 = (u64)((u64)t_field_2e1143 + (u64)((u64)8UL));
+	BLIT((u64)B27, t_value_2e1144, 24);
+	BLIT((u64)B28, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e1142 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B27, (u64)B28));
+	t__2e1097 = (u64)(u32)t__2e1142;
+	goto L__2e1099;
+	L__2e1099:;
+	t__2e1094 = (u64)(u32)t__2e1097;
+	if ((u32)t__2e1094) goto L__2e1095; else goto L__2e1096;
+	L__2e1095:;
+	t_field_2e1146 = (u64)((u64)t_binding_2e824 + (u64)((u64)64UL));
+	t__2e1147 = (u64)(u32)(*(i32 *)t_field_2e1146);
+	t__2e1145 = (u64)(u32)(((u32)t__2e1147 == (u32)((u64)0UL)));
+	t__2e1094 = (u64)(u32)t__2e1145;
+	goto L__2e1096;
+	L__2e1096:;
+	t__2e1091 = (u64)(u32)t__2e1094;
+	if ((u32)t__2e1091) goto L__2e1092; else goto L__2e1093;
+	L__2e1092:;
+	t_field_2e1149 = (u64)((u64)t_binding_2e824 + (u64)((u64)72UL));
+	t__2e1150 = (u64)(*(u64 *)t_field_2e1149);
+	t__2e1151 = ((u64)0UL);
+	t__2e1148 = (u64)(u32)(((u64)t__2e1150 == (u64)t__2e1151));
+	t__2e1091 = (u64)(u32)t__2e1148;
+	goto L__2e1093;
+	L__2e1093:;
+	if ((u32)t__2e1091) goto L_passed_2e1090; else goto L_failed_2e1089;
+	L_failed_2e1089:;
+	t_abortsite_2e410 = ((u64)11UL);
+	goto L_abort_2e411;
+	L_passed_2e1090:;
+	t_field_2e1182 = (u64)((u64)t_binding_2e826 + (u64)((u64)0UL));
+	t__2e1183 = (u64)(u32)(*(u32 *)t_field_2e1182);
+	t__2e1181 = (u64)(u32)(((u32)t__2e1183 == (u32)((u64)0UL)));
+	t__2e1178 = (u64)(u32)t__2e1181;
+	if ((u32)t__2e1178) goto L__2e1179; else goto L__2e1180;
+	L__2e1179:;
+	t_field_2e1185 = (u64)((u64)t_binding_2e826 + (u64)((u64)4UL));
+	t__2e1186 = (u64)(u32)(*(u8 *)t_field_2e1185);
+	t__2e1187 = (u64)(u32)((u8)t__2e1186);
+	t__2e1188 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1184 = (u64)(u32)(((u32)t__2e1187 == (u32)t__2e1188));
+	t__2e1178 = (u64)(u32)t__2e1184;
+	goto L__2e1180;
+	L__2e1180:;
+	t__2e1175 = (u64)(u32)t__2e1178;
+	if ((u32)t__2e1175) goto L__2e1176; else goto L__2e1177;
+	L__2e1176:;
+	t_field_2e1190 = (u64)((u64)t_binding_2e826 + (u64)((u64)8UL));
+	t__2e1191 = (u64)(u32)(*(i32 *)t_field_2e1190);
+	t__2e1189 = (u64)(u32)(((u32)t__2e1191 == (u32)((u64)0UL)));
+	t__2e1175 = (u64)(u32)t__2e1189;
+	goto L__2e1177;
+	L__2e1177:;
+	t__2e1172 = (u64)(u32)t__2e1175;
+	if ((u32)t__2e1172) goto L__2e1173; else goto L__2e1174;
+	L__2e1173:;
+	t_field_2e1193 = (u64)((u64)t_binding_2e826 + (u64)((u64)12UL));
+	t__2e1194 = (u64)(u32)(*(i32 *)t_field_2e1193);
+	t__2e1192 = (u64)(u32)(((u32)t__2e1194 == (u32)((u64)0UL)));
+	t__2e1172 = (u64)(u32)t__2e1192;
+	goto L__2e1174;
+	L__2e1174:;
+	t__2e1169 = (u64)(u32)t__2e1172;
+	if ((u32)t__2e1169) goto L__2e1170; else goto L__2e1171;
+	L__2e1170:;
+	t_field_2e1196 = (u64)((u64)t_binding_2e826 + (u64)((u64)16UL));
+	t__2e1197 = (u64)(u32)(*(i32 *)t_field_2e1196);
+	t__2e1195 = (u64)(u32)(((u32)t__2e1197 == (u32)((u64)0UL)));
+	t__2e1169 = (u64)(u32)t__2e1195;
+	goto L__2e1171;
+	L__2e1171:;
+	t__2e1166 = (u64)(u32)t__2e1169;
+	if ((u32)t__2e1166) goto L__2e1167; else goto L__2e1168;
+	L__2e1167:;
+	t_field_2e1199 = (u64)((u64)t_binding_2e826 + (u64)((u64)24UL));
+	t__2e1200 = (u64)(u32)(*(i32 *)t_field_2e1199);
+	t__2e1198 = (u64)(u32)(((u32)t__2e1200 == (u32)((u64)0UL)));
+	t__2e1166 = (u64)(u32)t__2e1198;
+	goto L__2e1168;
+	L__2e1168:;
+	t__2e1163 = (u64)(u32)t__2e1166;
+	if ((u32)t__2e1163) goto L__2e1164; else goto L__2e1165;
+	L__2e1164:;
+	t_field_2e1202 = (u64)((u64)t_binding_2e826 + (u64)((u64)32UL));
+	t_value_2e1203 = (u64)((u64)t_field_2e1202 + (u64)((u64)0UL));
+	t__2e1204 = (u64)(u32)(*(i32 *)t_value_2e1203);
+	t__2e1201 = (u64)(u32)(((u32)t__2e1204 == (u32)((u64)0UL)));
+	t__2e1163 = (u64)(u32)t__2e1201;
+	goto L__2e1165;
+	L__2e1165:;
+	t__2e1160 = (u64)(u32)t__2e1163;
+	if ((u32)t__2e1160) goto L__2e1161; else goto L__2e1162;
+	L__2e1161:;
+	t_field_2e1206 = (u64)((u64)t_binding_2e826 + (u64)((u64)32UL));
+	t_value_2e1207 = (u64)((u64)t_field_2e1206 + (u64)((u64)8UL));
+	BLIT((u64)B29, t_value_2e1207, 24);
+	BLIT((u64)B30, ((u64)((char *)&D_strliteral_2e478)), 24);
+	t__2e1205 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B29, (u64)B30));
+	t__2e1160 = (u64)(u32)t__2e1205;
+	goto L__2e1162;
+	L__2e1162:;
+	t__2e1157 = (u64)(u32)t__2e1160;
+	if ((u32)t__2e1157) goto L__2e1158; else goto L__2e1159;
+	L__2e1158:;
+	t_field_2e1209 = (u64)((u64)t_binding_2e826 + (u64)((u64)64UL));
+	t__2e1210 = (u64)(u32)(*(i32 *)t_field_2e1209);
+	t__2e1208 = (u64)(u32)(((u32)t__2e1210 == (u32)((u64)0UL)));
+	t__2e1157 = (u64)(u32)t__2e1208;
+	goto L__2e1159;
+	L__2e1159:;
+	t__2e1154 = (u64)(u32)t__2e1157;
+	if ((u32)t__2e1154) goto L__2e1155; else goto L__2e1156;
+	L__2e1155:;
+	t_field_2e1212 = (u64)((u64)t_binding_2e826 + (u64)((u64)72UL));
+	t__2e1213 = (u64)(*(u64 *)t_field_2e1212);
+	t__2e1214 = ((u64)0UL);
+	t__2e1211 = (u64)(u32)(((u64)t__2e1213 == (u64)t__2e1214));
+	t__2e1154 = (u64)(u32)t__2e1211;
+	goto L__2e1156;
+	L__2e1156:;
+	if ((u32)t__2e1154) goto L_passed_2e1153; else goto L_failed_2e1152;
+	L_failed_2e1152:;
+	t_abortsite_2e410 = ((u64)12UL);
+	goto L_abort_2e411;
+	L_passed_2e1153:;
+	goto L__2e393;
+	L__2e1215:;
+	L__2e393:;
+	return;
+	L_abort_2e411:;
+	t__2e412 = (u64)((u64)t_abortsite_2e410 * (u64)((u64)16UL));
+	t__2e412 = (u64)((u64)((u64)((char *)&D_abortsites_2e409)) + (u64)t__2e412);
+	t__2e413 = (u64)(*(u64 *)t__2e412);
+	t__2e414 = (u64)((u64)t__2e412 + (u64)((u64)8UL));
+	t__2e415 = (u64)(*(u32 *)t__2e414);
+	t__2e414 = (u64)((u64)t__2e412 + (u64)((u64)12UL));
+	t__2e416 = (u64)(*(u32 *)t__2e414);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e413, (u64)t__2e415, (u64)t__2e416, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F___offset(void) {
+	char A0[80] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	u64 t__2e1224;
+	u64 t__2e1228;
+	u64 t__2e1229;
+	u64 t__2e1230;
+	u64 t__2e1231;
+	u64 t__2e1232;
+	u64 t__2e1235;
+	u64 t__2e1238;
+	u64 t__2e1241;
+	u64 t__2e1244;
+	u64 t__2e1247;
+	u64 t__2e1250;
+	u64 t__2e1253;
+	u64 t__2e1256;
+	u64 t__2e1259;
+	u64 t__2e1262;
+	u64 t__2e1268;
+	u64 t__2e1271;
+	u64 t__2e1274;
+	u64 t__2e1277;
+	u64 t__2e1280;
+	u64 t__2e1283;
+	u64 t__2e1286;
+	u64 t__2e1289;
+	u64 t_abortsite_2e1226;
+	u64 t_binding_2e1220;
+	u64 t_binding_2e1263;
+	L_start_2e1216:;
+	t_binding_2e1220 = (u64)A0;
+	t_binding_2e1263 = (u64)A1;
+	L_body_2e1217:;
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t_binding_2e1220, (u64)((u64)0UL), (u64)((u64)80UL));
+	t__2e1224 = (u64)(u32)(((u64)((u64)0UL) == (u64)((u64)0UL)));
+	if ((u32)t__2e1224) goto L_passed_2e1223; else goto L_failed_2e1222;
+	L_failed_2e1222:;
+	t_abortsite_2e1226 = ((u64)0UL);
+	goto L_abort_2e1227;
+	L_passed_2e1223:;
+	t__2e1235 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e1235) goto L_passed_2e1234; else goto L_failed_2e1233;
+	L_failed_2e1233:;
+	t_abortsite_2e1226 = ((u64)1UL);
+	goto L_abort_2e1227;
+	L_passed_2e1234:;
+	t__2e1238 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e1238) goto L_passed_2e1237; else goto L_failed_2e1236;
+	L_failed_2e1236:;
+	t_abortsite_2e1226 = ((u64)2UL);
+	goto L_abort_2e1227;
+	L_passed_2e1237:;
+	t__2e1241 = (u64)(u32)(((u64)((u64)12UL) == (u64)((u64)12UL)));
+	if ((u32)t__2e1241) goto L_passed_2e1240; else goto L_failed_2e1239;
+	L_failed_2e1239:;
+	t_abortsite_2e1226 = ((u64)3UL);
+	goto L_abort_2e1227;
+	L_passed_2e1240:;
+	t__2e1244 = (u64)(u32)(((u64)((u64)16UL) == (u64)((u64)16UL)));
+	if ((u32)t__2e1244) goto L_passed_2e1243; else goto L_failed_2e1242;
+	L_failed_2e1242:;
+	t_abortsite_2e1226 = ((u64)4UL);
+	goto L_abort_2e1227;
+	L_passed_2e1243:;
+	t__2e1247 = (u64)(u32)(((u64)((u64)24UL) == (u64)((u64)24UL)));
+	if ((u32)t__2e1247) goto L_passed_2e1246; else goto L_failed_2e1245;
+	L_failed_2e1245:;
+	t_abortsite_2e1226 = ((u64)5UL);
+	goto L_abort_2e1227;
+	L_passed_2e1246:;
+	t__2e1250 = (u64)(u32)(((u64)((u64)24UL) == (u64)((u64)24UL)));
+	if ((u32)t__2e1250) goto L_passed_2e1249; else goto L_failed_2e1248;
+	L_failed_2e1248:;
+	t_abortsite_2e1226 = ((u64)6UL);
+	goto L_abort_2e1227;
+	L_passed_2e1249:;
+	t__2e1253 = (u64)(u32)(((u64)((u64)32UL) == (u64)((u64)32UL)));
+	if ((u32)t__2e1253) goto L_passed_2e1252; else goto L_failed_2e1251;
+	L_failed_2e1251:;
+	t_abortsite_2e1226 = ((u64)7UL);
+	goto L_abort_2e1227;
+	L_passed_2e1252:;
+	t__2e1256 = (u64)(u32)(((u64)((u64)64UL) == (u64)((u64)64UL)));
+	if ((u32)t__2e1256) goto L_passed_2e1255; else goto L_failed_2e1254;
+	L_failed_2e1254:;
+	t_abortsite_2e1226 = ((u64)8UL);
+	goto L_abort_2e1227;
+	L_passed_2e1255:;
+	t__2e1259 = (u64)(u32)(((u64)((u64)72UL) == (u64)((u64)72UL)));
+	if ((u32)t__2e1259) goto L_passed_2e1258; else goto L_failed_2e1257;
+	L_failed_2e1257:;
+	t_abortsite_2e1226 = ((u64)9UL);
+	goto L_abort_2e1227;
+	L_passed_2e1258:;
+	t__2e1262 = (u64)(u32)(((u64)((u64)80UL) == (u64)((u64)80UL)));
+	if ((u32)t__2e1262) goto L_passed_2e1261; else goto L_failed_2e1260;
+	L_failed_2e1260:;
+	t_abortsite_2e1226 = ((u64)10UL);
+	goto L_abort_2e1227;
+	L_passed_2e1261:;
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t_binding_2e1263, (u64)((u64)0UL), (u64)((u64)24UL));
+	t__2e1268 = (u64)(u32)(((u64)((u64)0UL) == (u64)((u64)0UL)));
+	if ((u32)t__2e1268) goto L_passed_2e1267; else goto L_failed_2e1266;
+	L_failed_2e1266:;
+	t_abortsite_2e1226 = ((u64)11UL);
+	goto L_abort_2e1227;
+	L_passed_2e1267:;
+	t__2e1271 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e1271) goto L_passed_2e1270; else goto L_failed_2e1269;
+	L_failed_2e1269:;
+	t_abortsite_2e1226 = ((u64)12UL);
+	goto L_abort_2e1227;
+	L_passed_2e1270:;
+	t__2e1274 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e1274) goto L_passed_2e1273; else goto L_failed_2e1272;
+	L_failed_2e1272:;
+	t_abortsite_2e1226 = ((u64)13UL);
+	goto L_abort_2e1227;
+	L_passed_2e1273:;
+	t__2e1277 = (u64)(u32)(((u64)((u64)16UL) == (u64)((u64)16UL)));
+	if ((u32)t__2e1277) goto L_passed_2e1276; else goto L_failed_2e1275;
+	L_failed_2e1275:;
+	t_abortsite_2e1226 = ((u64)14UL);
+	goto L_abort_2e1227;
+	L_passed_2e1276:;
+	t__2e1280 = (u64)(u32)(((u64)((u64)16UL) == (u64)((u64)16UL)));
+	if ((u32)t__2e1280) goto L_passed_2e1279; else goto L_failed_2e1278;
+	L_failed_2e1278:;
+	t_abortsite_2e1226 = ((u64)15UL);
+	goto L_abort_2e1227;
+	L_passed_2e1279:;
+	t__2e1283 = (u64)(u32)(((u64)((u64)24UL) == (u64)((u64)24UL)));
+	if ((u32)t__2e1283) goto L_passed_2e1282; else goto L_failed_2e1281;
+	L_failed_2e1281:;
+	t_abortsite_2e1226 = ((u64)16UL);
+	goto L_abort_2e1227;
+	L_passed_2e1282:;
+	t__2e1286 = (u64)(u32)(((u64)((u64)24UL) == (u64)((u64)24UL)));
+	if ((u32)t__2e1286) goto L_passed_2e1285; else goto L_failed_2e1284;
+	L_failed_2e1284:;
+	t_abortsite_2e1226 = ((u64)17UL);
+	goto L_abort_2e1227;
+	L_passed_2e1285:;
+	t__2e1289 = (u64)(u32)(((u64)((u64)24UL) == (u64)((u64)24UL)));
+	if ((u32)t__2e1289) goto L_passed_2e1288; else goto L_failed_2e1287;
+	L_failed_2e1287:;
+	t_abortsite_2e1226 = ((u64)18UL);
+	goto L_abort_2e1227;
+	L_passed_2e1288:;
+	goto L__2e1218;
+	L__2e1290:;
+	L__2e1218:;
+	return;
+	L_abort_2e1227:;
+	t__2e1228 = (u64)((u64)t_abortsite_2e1226 * (u64)((u64)16UL));
+	t__2e1228 = (u64)((u64)((u64)((char *)&D_abortsites_2e1225)) + (u64)t__2e1228);
+	t__2e1229 = (u64)(*(u64 *)t__2e1228);
+	t__2e1230 = (u64)((u64)t__2e1228 + (u64)((u64)8UL));
+	t__2e1231 = (u64)(*(u32 *)t__2e1230);
+	t__2e1230 = (u64)((u64)t__2e1228 + (u64)((u64)12UL));
+	t__2e1232 = (u64)(*(u32 *)t__2e1230);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1229, (u64)t__2e1231, (u64)t__2e1232, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_named(void) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e1299;
+	u64 t__2e1302;
+	u64 t__2e1304;
+	u64 t__2e1305;
+	u64 t__2e1307;
+	u64 t__2e1311;
+	u64 t__2e1312;
+	u64 t__2e1313;
+	u64 t__2e1314;
+	u64 t__2e1315;
+	u64 t_abortsite_2e1309;
+	u64 t_binding_2e1295;
+	u64 t_field_2e1296;
+	u64 t_field_2e1303;
+	u64 t_field_2e1306;
+	L_start_2e1291:;
+	t_binding_2e1295 = (u64)A0;
+	L_body_2e1292:;
+	t_field_2e1296 = (u64)((u64)t_binding_2e1295 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1296 = (u32)((u64)10UL);
+	t_field_2e1296 = (u64)((u64)t_binding_2e1295 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1296 = (u32)((u64)20UL);
+	t_field_2e1303 = (u64)((u64)t_binding_2e1295 + (u64)((u64)0UL));
+	t__2e1304 = (u64)(u32)(*(i32 *)t_field_2e1303);
+	t__2e1302 = (u64)(u32)(((u32)t__2e1304 == (u32)((u64)20UL)));
+	t__2e1299 = (u64)(u32)t__2e1302;
+	if ((u32)t__2e1299) goto L__2e1300; else goto L__2e1301;
+	L__2e1300:;
+	t_field_2e1306 = (u64)((u64)t_binding_2e1295 + (u64)((u64)4UL));
+	t__2e1307 = (u64)(u32)(*(i32 *)t_field_2e1306);
+	t__2e1305 = (u64)(u32)(((u32)t__2e1307 == (u32)((u64)10UL)));
+	t__2e1299 = (u64)(u32)t__2e1305;
+	goto L__2e1301;
+	L__2e1301:;
+	if ((u32)t__2e1299) goto L_passed_2e1298; else goto L_failed_2e1297;
+	L_failed_2e1297:;
+	t_abortsite_2e1309 = ((u64)0UL);
+	goto L_abort_2e1310;
+	L_passed_2e1298:;
+	goto L__2e1293;
+	L__2e1316:;
+	L__2e1293:;
+	return;
+	L_abort_2e1310:;
+	t__2e1311 = (u64)((u64)t_abortsite_2e1309 * (u64)((u64)16UL));
+	t__2e1311 = (u64)((u64)((u64)((char *)&D_abortsites_2e1308)) + (u64)t__2e1311);
+	t__2e1312 = (u64)(*(u64 *)t__2e1311);
+	t__2e1313 = (u64)((u64)t__2e1311 + (u64)((u64)8UL));
+	t__2e1314 = (u64)(*(u32 *)t__2e1313);
+	t__2e1313 = (u64)((u64)t__2e1311 + (u64)((u64)12UL));
+	t__2e1315 = (u64)(*(u32 *)t__2e1313);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1312, (u64)t__2e1314, (u64)t__2e1315, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_nested(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[20] __attribute__((aligned(16)));
+	char A5[20] __attribute__((aligned(16)));
+	char A6[16] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	u64 t__2e1328;
+	u64 t__2e1331;
+	u64 t__2e1334;
+	u64 t__2e1335;
+	u64 t__2e1336;
+	u64 t__2e1340;
+	u64 t__2e1341;
+	u64 t__2e1342;
+	u64 t__2e1343;
+	u64 t__2e1344;
+	u64 t__2e1347;
+	u64 t__2e1350;
+	u64 t__2e1353;
+	u64 t__2e1355;
+	u64 t__2e1356;
+	u64 t__2e1357;
+	u64 t__2e1358;
+	u64 t__2e1360;
+	u64 t__2e1361;
+	u64 t__2e1362;
+	u64 t__2e1363;
+	u64 t__2e1365;
+	u64 t__2e1373;
+	u64 t__2e1376;
+	u64 t__2e1379;
+	u64 t__2e1380;
+	u64 t__2e1381;
+	u64 t__2e1384;
+	u64 t__2e1387;
+	u64 t__2e1390;
+	u64 t__2e1392;
+	u64 t__2e1393;
+	u64 t__2e1394;
+	u64 t__2e1395;
+	u64 t__2e1397;
+	u64 t__2e1398;
+	u64 t__2e1399;
+	u64 t__2e1400;
+	u64 t__2e1402;
+	u64 t__2e1425;
+	u64 t__2e1427;
+	u64 t__2e1430;
+	u64 t__2e1433;
+	u64 t__2e1436;
+	u64 t__2e1439;
+	u64 t__2e1442;
+	u64 t__2e1446;
+	u64 t__2e1449;
+	u64 t__2e1453;
+	u64 t__2e1456;
+	u64 t__2e1458;
+	u64 t__2e1461;
+	u64 t__2e1465;
+	u64 t__2e1467;
+	u64 t__2e1474;
+	u64 t__2e1478;
+	u64 t__2e1481;
+	u64 t__2e1485;
+	u64 t_abortsite_2e1338;
+	u64 t_binding_2e1321;
+	u64 t_binding_2e1366;
+	u64 t_binding_2e1403;
+	u64 t_binding_2e1406;
+	u64 t_binding_2e1410;
+	u64 t_field_2e1325;
+	u64 t_field_2e1354;
+	u64 t_field_2e1359;
+	u64 t_field_2e1364;
+	u64 t_field_2e1370;
+	u64 t_field_2e1391;
+	u64 t_field_2e1396;
+	u64 t_field_2e1401;
+	u64 t_field_2e1405;
+	u64 t_field_2e1409;
+	u64 t_field_2e1415;
+	u64 t_field_2e1418;
+	u64 t_field_2e1421;
+	u64 t_field_2e1426;
+	u64 t_field_2e1431;
+	u64 t_field_2e1432;
+	u64 t_field_2e1437;
+	u64 t_field_2e1438;
+	u64 t_field_2e1443;
+	u64 t_field_2e1444;
+	u64 t_field_2e1445;
+	u64 t_field_2e1450;
+	u64 t_field_2e1451;
+	u64 t_field_2e1452;
+	u64 t_field_2e1457;
+	u64 t_field_2e1459;
+	u64 t_field_2e1460;
+	u64 t_field_2e1462;
+	u64 t_field_2e1466;
+	u64 t_field_2e1468;
+	u64 t_field_2e1469;
+	u64 t_field_2e1471;
+	u64 t_field_2e1475;
+	u64 t_field_2e1476;
+	u64 t_field_2e1477;
+	u64 t_field_2e1482;
+	u64 t_field_2e1483;
+	u64 t_field_2e1484;
+	u64 t_object_2e1411;
+	u64 t_object_2e1416;
+	u64 t_object_2e1419;
+	u64 t_object_2e1470;
+	L_start_2e1317:;
+	t_binding_2e1321 = (u64)A0;
+	t_binding_2e1366 = (u64)A1;
+	t_binding_2e1403 = (u64)A2;
+	t_binding_2e1406 = (u64)A3;
+	t_binding_2e1410 = (u64)A4;
+	t_object_2e1411 = (u64)A5;
+	t_object_2e1416 = (u64)A6;
+	t_object_2e1419 = (u64)A7;
+	t_object_2e1470 = (u64)A8;
+	L_body_2e1318:;
+	t_field_2e1325 = (u64)((u64)t_binding_2e1321 + (u64)((u64)0UL));
+	*(u8 *)t_field_2e1325 = (u8)((u64)42UL);
+	t_field_2e1325 = (u64)((u64)t_binding_2e1321 + (u64)((u64)8UL));
+	*(u8 *)t_field_2e1325 = (u8)((u64)69UL);
+	t_field_2e1325 = (u64)((u64)t_binding_2e1321 + (u64)((u64)16UL));
+	*(u64 *)t_field_2e1325 = (u64)((u64)1337UL);
+	t__2e1334 = (u64)(u32)(((u64)((u64)0UL) == (u64)((u64)0UL)));
+	t__2e1331 = (u64)(u32)t__2e1334;
+	if ((u32)t__2e1331) goto L__2e1332; else goto L__2e1333;
+	L__2e1332:;
+	t__2e1335 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	t__2e1331 = (u64)(u32)t__2e1335;
+	goto L__2e1333;
+	L__2e1333:;
+	t__2e1328 = (u64)(u32)t__2e1331;
+	if ((u32)t__2e1328) goto L__2e1329; else goto L__2e1330;
+	L__2e1329:;
+	t__2e1336 = (u64)(u32)(((u64)((u64)16UL) == (u64)((u64)16UL)));
+	t__2e1328 = (u64)(u32)t__2e1336;
+	goto L__2e1330;
+	L__2e1330:;
+	if ((u32)t__2e1328) goto L_passed_2e1327; else goto L_failed_2e1326;
+	L_failed_2e1326:;
+	t_abortsite_2e1338 = ((u64)0UL);
+	goto L_abort_2e1339;
+	L_passed_2e1327:;
+	t_field_2e1354 = (u64)((u64)t_binding_2e1321 + (u64)((u64)0UL));
+	t__2e1355 = (u64)(u32)(*(u8 *)t_field_2e1354);
+	t__2e1356 = (u64)(u32)((u8)t__2e1355);
+	t__2e1357 = (u64)(u32)((u8)((u64)42UL));
+	t__2e1353 = (u64)(u32)(((u32)t__2e1356 == (u32)t__2e1357));
+	t__2e1350 = (u64)(u32)t__2e1353;
+	if ((u32)t__2e1350) goto L__2e1351; else goto L__2e1352;
+	L__2e1351:;
+	t_field_2e1359 = (u64)((u64)t_binding_2e1321 + (u64)((u64)8UL));
+	t__2e1360 = (u64)(u32)(*(u8 *)t_field_2e1359);
+	t__2e1361 = (u64)(u32)((u8)t__2e1360);
+	t__2e1362 = (u64)(u32)((u8)((u64)69UL));
+	t__2e1358 = (u64)(u32)(((u32)t__2e1361 == (u32)t__2e1362));
+	t__2e1350 = (u64)(u32)t__2e1358;
+	goto L__2e1352;
+	L__2e1352:;
+	t__2e1347 = (u64)(u32)t__2e1350;
+	if ((u32)t__2e1347) goto L__2e1348; else goto L__2e1349;
+	L__2e1348:;
+	t_field_2e1364 = (u64)((u64)t_binding_2e1321 + (u64)((u64)16UL));
+	t__2e1365 = (u64)(*(u64 *)t_field_2e1364);
+	t__2e1363 = (u64)(u32)(((u64)t__2e1365 == (u64)((u64)1337UL)));
+	t__2e1347 = (u64)(u32)t__2e1363;
+	goto L__2e1349;
+	L__2e1349:;
+	if ((u32)t__2e1347) goto L_passed_2e1346; else goto L_failed_2e1345;
+	L_failed_2e1345:;
+	t_abortsite_2e1338 = ((u64)1UL);
+	goto L_abort_2e1339;
+	L_passed_2e1346:;
+	t_field_2e1370 = (u64)((u64)t_binding_2e1366 + (u64)((u64)16UL));
+	*(u8 *)t_field_2e1370 = (u8)((u64)42UL);
+	t_field_2e1370 = (u64)((u64)t_binding_2e1366 + (u64)((u64)0UL));
+	*(u8 *)t_field_2e1370 = (u8)((u64)69UL);
+	t_field_2e1370 = (u64)((u64)t_binding_2e1366 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e1370 = (u64)((u64)1337UL);
+	t__2e1379 = (u64)(u32)(((u64)((u64)0UL) == (u64)((u64)0UL)));
+	t__2e1376 = (u64)(u32)t__2e1379;
+	if ((u32)t__2e1376) goto L__2e1377; else goto L__2e1378;
+	L__2e1377:;
+	t__2e1380 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	t__2e1376 = (u64)(u32)t__2e1380;
+	goto L__2e1378;
+	L__2e1378:;
+	t__2e1373 = (u64)(u32)t__2e1376;
+	if ((u32)t__2e1373) goto L__2e1374; else goto L__2e1375;
+	L__2e1374:;
+	t__2e1381 = (u64)(u32)(((u64)((u64)16UL) == (u64)((u64)16UL)));
+	t__2e1373 = (u64)(u32)t__2e1381;
+	goto L__2e1375;
+	L__2e1375:;
+	if ((u32)t__2e1373) goto L_passed_2e1372; else goto L_failed_2e1371;
+	L_failed_2e1371:;
+	t_abortsite_2e1338 = ((u64)2UL);
+	goto L_abort_2e1339;
+	L_passed_2e1372:;
+	t_field_2e1391 = (u64)((u64)t_binding_2e1366 + (u64)((u64)16UL));
+	t__2e1392 = (u64)(u32)(*(u8 *)t_field_2e1391);
+	t__2e1393 = (u64)(u32)((u8)t__2e1392);
+	t__2e1394 = (u64)(u32)((u8)((u64)42UL));
+	t__2e1390 = (u64)(u32)(((u32)t__2e1393 == (u32)t__2e1394));
+	t__2e1387 = (u64)(u32)t__2e1390;
+	if ((u32)t__2e1387) goto L__2e1388; else goto L__2e1389;
+	L__2e1388:;
+	t_field_2e1396 = (u64)((u64)t_binding_2e1366 + (u64)((u64)0UL));
+	t__2e1397 = (u64)(u32)(*(u8 *)t_field_2e1396);
+	t__2e1398 = (u64)(u32)((u8)t__2e1397);
+	t__2e1399 = (u64)(u32)((u8)((u64)69UL));
+	t__2e1395 = (u64)(u32)(((u32)t__2e1398 == (u32)t__2e1399));
+	t__2e1387 = (u64)(u32)t__2e1395;
+	goto L__2e1389;
+	L__2e1389:;
+	t__2e1384 = (u64)(u32)t__2e1387;
+	if ((u32)t__2e1384) goto L__2e1385; else goto L__2e1386;
+	L__2e1385:;
+	t_field_2e1401 = (u64)((u64)t_binding_2e1366 + (u64)((u64)8UL));
+	t__2e1402 = (u64)(*(u64 *)t_field_2e1401);
+	t__2e1400 = (u64)(u32)(((u64)t__2e1402 == (u64)((u64)1337UL)));
+	t__2e1384 = (u64)(u32)t__2e1400;
+	goto L__2e1386;
+	L__2e1386:;
+	if ((u32)t__2e1384) goto L_passed_2e1383; else goto L_failed_2e1382;
+	L_failed_2e1382:;
+	t_abortsite_2e1338 = ((u64)3UL);
+	goto L_abort_2e1339;
+	L_passed_2e1383:;
+	t_field_2e1405 = (u64)((u64)t_binding_2e1403 + (u64)((u64)0UL));
+	*(u8 *)t_field_2e1405 = (u8)((u64)42UL);
+	t_field_2e1405 = (u64)((u64)t_binding_2e1403 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1405 = (u32)((u64)69UL);
+	t_field_2e1409 = (u64)((u64)t_binding_2e1406 + (u64)((u64)4UL));
+	*(u8 *)t_field_2e1409 = (u8)((u64)42UL);
+	t_field_2e1409 = (u64)((u64)t_binding_2e1406 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1409 = (u32)((u64)69UL);
+	t_field_2e1415 = (u64)((u64)t_object_2e1411 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1415 = (u32)((u64)10UL);
+	t_field_2e1415 = (u64)((u64)t_object_2e1411 + (u64)((u64)4UL));
+	t_field_2e1418 = (u64)((u64)t_object_2e1416 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1418 = (u32)((u64)20UL);
+	t_field_2e1418 = (u64)((u64)t_object_2e1416 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1418 = (u32)((u64)30UL);
+	t_field_2e1418 = (u64)((u64)t_object_2e1416 + (u64)((u64)8UL));
+	t_field_2e1421 = (u64)((u64)t_object_2e1419 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1421 = (u32)((u64)42UL);
+	t_field_2e1421 = (u64)((u64)t_object_2e1419 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1421 = (u32)((u64)24UL);
+	BLIT(t_field_2e1418, t_object_2e1419, ((u64)8UL));
+	BLIT(t_field_2e1415, t_object_2e1416, ((u64)16UL));
+	BLIT(t_binding_2e1410, t_object_2e1411, ((u64)20UL));
+	t_field_2e1426 = (u64)((u64)t_binding_2e1410 + (u64)((u64)0UL));
+	t__2e1427 = (u64)(u32)(*(i32 *)t_field_2e1426);
+	t__2e1425 = (u64)(u32)(((u32)t__2e1427 == (u32)((u64)10UL)));
+	if ((u32)t__2e1425) goto L_passed_2e1424; else goto L_failed_2e1423;
+	L_failed_2e1423:;
+	t_abortsite_2e1338 = ((u64)4UL);
+	goto L_abort_2e1339;
+	L_passed_2e1424:;
+	t_field_2e1431 = (u64)((u64)t_binding_2e1410 + (u64)((u64)4UL));
+	t_field_2e1432 = (u64)((u64)t_field_2e1431 + (u64)((u64)0UL));
+	t__2e1433 = (u64)(u32)(*(i32 *)t_field_2e1432);
+	t__2e1430 = (u64)(u32)(((u32)t__2e1433 == (u32)((u64)20UL)));
+	if ((u32)t__2e1430) goto L_passed_2e1429; else goto L_failed_2e1428;
+	L_failed_2e1428:;
+	t_abortsite_2e1338 = ((u64)5UL);
+	goto L_abort_2e1339;
+	L_passed_2e1429:;
+	t_field_2e1437 = (u64)((u64)t_binding_2e1410 + (u64)((u64)4UL));
+	t_field_2e1438 = (u64)((u64)t_field_2e1437 + (u64)((u64)4UL));
+	t__2e1439 = (u64)(u32)(*(i32 *)t_field_2e1438);
+	t__2e1436 = (u64)(u32)(((u32)t__2e1439 == (u32)((u64)30UL)));
+	if ((u32)t__2e1436) goto L_passed_2e1435; else goto L_failed_2e1434;
+	L_failed_2e1434:;
+	t_abortsite_2e1338 = ((u64)6UL);
+	goto L_abort_2e1339;
+	L_passed_2e1435:;
+	t_field_2e1443 = (u64)((u64)t_binding_2e1410 + (u64)((u64)4UL));
+	t_field_2e1444 = (u64)((u64)t_field_2e1443 + (u64)((u64)8UL));
+	t_field_2e1445 = (u64)((u64)t_field_2e1444 + (u64)((u64)0UL));
+	t__2e1446 = (u64)(u32)(*(i32 *)t_field_2e1445);
+	t__2e1442 = (u64)(u32)(((u32)t__2e1446 == (u32)((u64)42UL)));
+	if ((u32)t__2e1442) goto L_passed_2e1441; else goto L_failed_2e1440;
+	L_failed_2e1440:;
+	t_abortsite_2e1338 = ((u64)7UL);
+	goto L_abort_2e1339;
+	L_passed_2e1441:;
+	t_field_2e1450 = (u64)((u64)t_binding_2e1410 + (u64)((u64)4UL));
+	t_field_2e1451 = (u64)((u64)t_field_2e1450 + (u64)((u64)8UL));
+	t_field_2e1452 = (u64)((u64)t_field_2e1451 + (u64)((u64)4UL));
+	t__2e1453 = (u64)(u32)(*(i32 *)t_field_2e1452);
+	t__2e1449 = (u64)(u32)(((u32)t__2e1453 == (u32)((u64)24UL)));
+	if ((u32)t__2e1449) goto L_passed_2e1448; else goto L_failed_2e1447;
+	L_failed_2e1447:;
+	t_abortsite_2e1338 = ((u64)8UL);
+	goto L_abort_2e1339;
+	L_passed_2e1448:;
+	t_field_2e1457 = (u64)((u64)t_binding_2e1410 + (u64)((u64)4UL));
+	t__2e1458 = t_field_2e1457;
+	t_field_2e1459 = (u64)((u64)t_binding_2e1410 + (u64)((u64)4UL));
+	t_field_2e1460 = (u64)((u64)t_field_2e1459 + (u64)((u64)0UL));
+	t__2e1461 = t_field_2e1460;
+	t__2e1456 = (u64)(u32)(((u64)t__2e1458 == (u64)t__2e1461));
+	if ((u32)t__2e1456) goto L_passed_2e1455; else goto L_failed_2e1454;
+	L_failed_2e1454:;
+	t_abortsite_2e1338 = ((u64)9UL);
+	goto L_abort_2e1339;
+	L_passed_2e1455:;
+	t_field_2e1462 = (u64)((u64)t_binding_2e1410 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1462 = (u32)((u64)1337UL);
+	t_field_2e1466 = (u64)((u64)t_binding_2e1410 + (u64)((u64)0UL));
+	t__2e1467 = (u64)(u32)(*(i32 *)t_field_2e1466);
+	t__2e1465 = (u64)(u32)(((u32)t__2e1467 == (u32)((u64)1337UL)));
+	if ((u32)t__2e1465) goto L_passed_2e1464; else goto L_failed_2e1463;
+	L_failed_2e1463:;
+	t_abortsite_2e1338 = ((u64)10UL);
+	goto L_abort_2e1339;
+	L_passed_2e1464:;
+	t_field_2e1468 = (u64)((u64)t_binding_2e1410 + (u64)((u64)4UL));
+	t_field_2e1469 = (u64)((u64)t_field_2e1468 + (u64)((u64)8UL));
+	t_field_2e1471 = (u64)((u64)t_object_2e1470 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1471 = (u32)((u64)1337UL);
+	t_field_2e1471 = (u64)((u64)t_object_2e1470 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1471 = (u32)((u64)7331UL);
+	BLIT(t_field_2e1469, t_object_2e1470, ((u64)8UL));
+	t_field_2e1475 = (u64)((u64)t_binding_2e1410 + (u64)((u64)4UL));
+	t_field_2e1476 = (u64)((u64)t_field_2e1475 + (u64)((u64)8UL));
+	t_field_2e1477 = (u64)((u64)t_field_2e1476 + (u64)((u64)0UL));
+	t__2e1478 = (u64)(u32)(*(i32 *)t_field_2e1477);
+	t__2e1474 = (u64)(u32)(((u32)t__2e1478 == (u32)((u64)1337UL)));
+	if ((u32)t__2e1474) goto L_passed_2e1473; else goto L_failed_2e1472;
+	L_failed_2e1472:;
+	t_abortsite_2e1338 = ((u64)11UL);
+	goto L_abort_2e1339;
+	L_passed_2e1473:;
+	t_field_2e1482 = (u64)((u64)t_binding_2e1410 + (u64)((u64)4UL));
+	t_field_2e1483 = (u64)((u64)t_field_2e1482 + (u64)((u64)8UL));
+	t_field_2e1484 = (u64)((u64)t_field_2e1483 + (u64)((u64)4UL));
+	t__2e1485 = (u64)(u32)(*(i32 *)t_field_2e1484);
+	t__2e1481 = (u64)(u32)(((u32)t__2e1485 == (u32)((u64)7331UL)));
+	if ((u32)t__2e1481) goto L_passed_2e1480; else goto L_failed_2e1479;
+	L_failed_2e1479:;
+	t_abortsite_2e1338 = ((u64)12UL);
+	goto L_abort_2e1339;
+	L_passed_2e1480:;
+	goto L__2e1319;
+	L__2e1486:;
+	L__2e1319:;
+	return;
+	L_abort_2e1339:;
+	t__2e1340 = (u64)((u64)t_abortsite_2e1338 * (u64)((u64)16UL));
+	t__2e1340 = (u64)((u64)((u64)((char *)&D_abortsites_2e1337)) + (u64)t__2e1340);
+	t__2e1341 = (u64)(*(u64 *)t__2e1340);
+	t__2e1342 = (u64)((u64)t__2e1340 + (u64)((u64)8UL));
+	t__2e1343 = (u64)(*(u32 *)t__2e1342);
+	t__2e1342 = (u64)((u64)t__2e1340 + (u64)((u64)12UL));
+	t__2e1344 = (u64)(*(u32 *)t__2e1342);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1341, (u64)t__2e1343, (u64)t__2e1344, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_deref(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	u64 t__2e1498;
+	u64 t__2e1501;
+	u64 t__2e1502;
+	u64 t__2e1504;
+	u64 t__2e1505;
+	u64 t__2e1506;
+	u64 t__2e1508;
+	u64 t__2e1512;
+	u64 t__2e1513;
+	u64 t__2e1514;
+	u64 t__2e1515;
+	u64 t__2e1516;
+	u64 t__2e1520;
+	u64 t__2e1523;
+	u64 t__2e1524;
+	u64 t__2e1525;
+	u64 t__2e1527;
+	u64 t__2e1528;
+	u64 t__2e1529;
+	u64 t__2e1530;
+	u64 t__2e1532;
+	u64 t__2e1536;
+	u64 t__2e1539;
+	u64 t__2e1540;
+	u64 t__2e1541;
+	u64 t__2e1542;
+	u64 t__2e1544;
+	u64 t__2e1545;
+	u64 t__2e1546;
+	u64 t__2e1547;
+	u64 t__2e1548;
+	u64 t__2e1550;
+	u64 t__2e1551;
+	u64 t__2e1552;
+	u64 t__2e1553;
+	u64 t__2e1555;
+	u64 t__2e1556;
+	u64 t__2e1557;
+	u64 t__2e1561;
+	u64 t__2e1564;
+	u64 t__2e1566;
+	u64 t__2e1567;
+	u64 t__2e1569;
+	u64 t_abortsite_2e1510;
+	u64 t_binding_2e1491;
+	u64 t_binding_2e1495;
+	u64 t_binding_2e1517;
+	u64 t_binding_2e1533;
+	u64 t_field_2e1494;
+	u64 t_field_2e1503;
+	u64 t_field_2e1507;
+	u64 t_field_2e1526;
+	u64 t_field_2e1531;
+	u64 t_field_2e1543;
+	u64 t_field_2e1549;
+	u64 t_field_2e1554;
+	u64 t_field_2e1558;
+	u64 t_field_2e1565;
+	u64 t_field_2e1568;
+	u64 t_object_2e1492;
+	L_start_2e1487:;
+	t_binding_2e1491 = (u64)A0;
+	t_object_2e1492 = (u64)A1;
+	t_binding_2e1495 = (u64)A2;
+	t_binding_2e1517 = (u64)A3;
+	t_binding_2e1533 = (u64)A4;
+	L_body_2e1488:;
+	t_field_2e1494 = (u64)((u64)t_object_2e1492 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1494 = (u32)((u64)20UL);
+	t_field_2e1494 = (u64)((u64)t_object_2e1492 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1494 = (u32)((u64)30UL);
+	BLIT(t_binding_2e1491, t_object_2e1492, ((u64)8UL));
+	*(u64 *)t_binding_2e1495 = (u64)t_binding_2e1491;
+	t__2e1502 = (u64)(*(u64 *)t_binding_2e1495);
+	t_field_2e1503 = (u64)((u64)t__2e1502 + (u64)((u64)0UL));
+	t__2e1504 = (u64)(u32)(*(i32 *)t_field_2e1503);
+	t__2e1501 = (u64)(u32)(((u32)t__2e1504 == (u32)((u64)20UL)));
+	t__2e1498 = (u64)(u32)t__2e1501;
+	if ((u32)t__2e1498) goto L__2e1499; else goto L__2e1500;
+	L__2e1499:;
+	t__2e1506 = (u64)(*(u64 *)t_binding_2e1495);
+	t_field_2e1507 = (u64)((u64)t__2e1506 + (u64)((u64)4UL));
+	t__2e1508 = (u64)(u32)(*(i32 *)t_field_2e1507);
+	t__2e1505 = (u64)(u32)(((u32)t__2e1508 == (u32)((u64)30UL)));
+	t__2e1498 = (u64)(u32)t__2e1505;
+	goto L__2e1500;
+	L__2e1500:;
+	if ((u32)t__2e1498) goto L_passed_2e1497; else goto L_failed_2e1496;
+	L_failed_2e1496:;
+	t_abortsite_2e1510 = ((u64)0UL);
+	goto L_abort_2e1511;
+	L_passed_2e1497:;
+	*(u64 *)t_binding_2e1517 = (u64)t_binding_2e1495;
+	t__2e1524 = (u64)(*(u64 *)t_binding_2e1517);
+	t__2e1525 = (u64)(*(u64 *)t__2e1524);
+	t_field_2e1526 = (u64)((u64)t__2e1525 + (u64)((u64)0UL));
+	t__2e1527 = (u64)(u32)(*(i32 *)t_field_2e1526);
+	t__2e1523 = (u64)(u32)(((u32)t__2e1527 == (u32)((u64)20UL)));
+	t__2e1520 = (u64)(u32)t__2e1523;
+	if ((u32)t__2e1520) goto L__2e1521; else goto L__2e1522;
+	L__2e1521:;
+	t__2e1529 = (u64)(*(u64 *)t_binding_2e1517);
+	t__2e1530 = (u64)(*(u64 *)t__2e1529);
+	t_field_2e1531 = (u64)((u64)t__2e1530 + (u64)((u64)4UL));
+	t__2e1532 = (u64)(u32)(*(i32 *)t_field_2e1531);
+	t__2e1528 = (u64)(u32)(((u32)t__2e1532 == (u32)((u64)30UL)));
+	t__2e1520 = (u64)(u32)t__2e1528;
+	goto L__2e1522;
+	L__2e1522:;
+	if ((u32)t__2e1520) goto L_passed_2e1519; else goto L_failed_2e1518;
+	L_failed_2e1518:;
+	t_abortsite_2e1510 = ((u64)1UL);
+	goto L_abort_2e1511;
+	L_passed_2e1519:;
+	*(u64 *)t_binding_2e1533 = (u64)t_binding_2e1517;
+	t__2e1540 = (u64)(*(u64 *)t_binding_2e1533);
+	t__2e1541 = (u64)(*(u64 *)t__2e1540);
+	t__2e1542 = (u64)(*(u64 *)t__2e1541);
+	t_field_2e1543 = (u64)((u64)t__2e1542 + (u64)((u64)0UL));
+	t__2e1544 = (u64)(u32)(*(i32 *)t_field_2e1543);
+	t__2e1539 = (u64)(u32)(((u32)t__2e1544 == (u32)((u64)20UL)));
+	t__2e1536 = (u64)(u32)t__2e1539;
+	if ((u32)t__2e1536) goto L__2e1537; else goto L__2e1538;
+	L__2e1537:;
+	t__2e1546 = (u64)(*(u64 *)t_binding_2e1533);
+	t__2e1547 = (u64)(*(u64 *)t__2e1546);
+	t__2e1548 = (u64)(*(u64 *)t__2e1547);
+	t_field_2e1549 = (u64)((u64)t__2e1548 + (u64)((u64)4UL));
+	t__2e1550 = (u64)(u32)(*(i32 *)t_field_2e1549);
+	t__2e1545 = (u64)(u32)(((u32)t__2e1550 == (u32)((u64)30UL)));
+	t__2e1536 = (u64)(u32)t__2e1545;
+	goto L__2e1538;
+	L__2e1538:;
+	if ((u32)t__2e1536) goto L_passed_2e1535; else goto L_failed_2e1534;
+	L_failed_2e1534:;
+	t_abortsite_2e1510 = ((u64)2UL);
+	goto L_abort_2e1511;
+	L_passed_2e1535:;
+	t__2e1551 = (u64)(*(u64 *)t_binding_2e1533);
+	t__2e1552 = (u64)(*(u64 *)t__2e1551);
+	t__2e1553 = (u64)(*(u64 *)t__2e1552);
+	t_field_2e1554 = (u64)((u64)t__2e1553 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1554 = (u32)((u64)42UL);
+	t__2e1555 = (u64)(*(u64 *)t_binding_2e1533);
+	t__2e1556 = (u64)(*(u64 *)t__2e1555);
+	t__2e1557 = (u64)(*(u64 *)t__2e1556);
+	t_field_2e1558 = (u64)((u64)t__2e1557 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1558 = (u32)((u64)96UL);
+	t_field_2e1565 = (u64)((u64)t_binding_2e1491 + (u64)((u64)0UL));
+	t__2e1566 = (u64)(u32)(*(i32 *)t_field_2e1565);
+	t__2e1564 = (u64)(u32)(((u32)t__2e1566 == (u32)((u64)42UL)));
+	t__2e1561 = (u64)(u32)t__2e1564;
+	if ((u32)t__2e1561) goto L__2e1562; else goto L__2e1563;
+	L__2e1562:;
+	t_field_2e1568 = (u64)((u64)t_binding_2e1491 + (u64)((u64)4UL));
+	t__2e1569 = (u64)(u32)(*(i32 *)t_field_2e1568);
+	t__2e1567 = (u64)(u32)(((u32)t__2e1569 == (u32)((u64)96UL)));
+	t__2e1561 = (u64)(u32)t__2e1567;
+	goto L__2e1563;
+	L__2e1563:;
+	if ((u32)t__2e1561) goto L_passed_2e1560; else goto L_failed_2e1559;
+	L_failed_2e1559:;
+	t_abortsite_2e1510 = ((u64)3UL);
+	goto L_abort_2e1511;
+	L_passed_2e1560:;
+	goto L__2e1489;
+	L__2e1570:;
+	L__2e1489:;
+	return;
+	L_abort_2e1511:;
+	t__2e1512 = (u64)((u64)t_abortsite_2e1510 * (u64)((u64)16UL));
+	t__2e1512 = (u64)((u64)((u64)((char *)&D_abortsites_2e1509)) + (u64)t__2e1512);
+	t__2e1513 = (u64)(*(u64 *)t__2e1512);
+	t__2e1514 = (u64)((u64)t__2e1512 + (u64)((u64)8UL));
+	t__2e1515 = (u64)(*(u32 *)t__2e1514);
+	t__2e1514 = (u64)((u64)t__2e1512 + (u64)((u64)12UL));
+	t__2e1516 = (u64)(*(u32 *)t__2e1514);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1513, (u64)t__2e1515, (u64)t__2e1516, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_assignment(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e1582;
+	u64 t__2e1585;
+	u64 t__2e1587;
+	u64 t__2e1588;
+	u64 t__2e1590;
+	u64 t__2e1594;
+	u64 t__2e1595;
+	u64 t__2e1596;
+	u64 t__2e1597;
+	u64 t__2e1598;
+	u64 t__2e1603;
+	u64 t__2e1606;
+	u64 t__2e1608;
+	u64 t__2e1609;
+	u64 t__2e1611;
+	u64 t_abortsite_2e1592;
+	u64 t_binding_2e1575;
+	u64 t_field_2e1577;
+	u64 t_field_2e1578;
+	u64 t_field_2e1579;
+	u64 t_field_2e1586;
+	u64 t_field_2e1589;
+	u64 t_field_2e1600;
+	u64 t_field_2e1607;
+	u64 t_field_2e1610;
+	u64 t_object_2e1576;
+	u64 t_object_2e1599;
+	L_start_2e1571:;
+	t_binding_2e1575 = (u64)A0;
+	t_object_2e1576 = (u64)A1;
+	t_object_2e1599 = (u64)A2;
+	L_body_2e1572:;
+	t_field_2e1577 = (u64)((u64)t_object_2e1576 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1577 = (u32)((u64)20UL);
+	t_field_2e1577 = (u64)((u64)t_object_2e1576 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1577 = (u32)((u64)30UL);
+	BLIT(t_binding_2e1575, t_object_2e1576, ((u64)8UL));
+	t_field_2e1578 = (u64)((u64)t_binding_2e1575 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1578 = (u32)((u64)40UL);
+	t_field_2e1579 = (u64)((u64)t_binding_2e1575 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1579 = (u32)((u64)50UL);
+	t_field_2e1586 = (u64)((u64)t_binding_2e1575 + (u64)((u64)0UL));
+	t__2e1587 = (u64)(u32)(*(i32 *)t_field_2e1586);
+	t__2e1585 = (u64)(u32)(((u32)t__2e1587 == (u32)((u64)40UL)));
+	t__2e1582 = (u64)(u32)t__2e1585;
+	if ((u32)t__2e1582) goto L__2e1583; else goto L__2e1584;
+	L__2e1583:;
+	t_field_2e1589 = (u64)((u64)t_binding_2e1575 + (u64)((u64)4UL));
+	t__2e1590 = (u64)(u32)(*(i32 *)t_field_2e1589);
+	t__2e1588 = (u64)(u32)(((u32)t__2e1590 == (u32)((u64)50UL)));
+	t__2e1582 = (u64)(u32)t__2e1588;
+	goto L__2e1584;
+	L__2e1584:;
+	if ((u32)t__2e1582) goto L_passed_2e1581; else goto L_failed_2e1580;
+	L_failed_2e1580:;
+	t_abortsite_2e1592 = ((u64)0UL);
+	goto L_abort_2e1593;
+	L_passed_2e1581:;
+	t_field_2e1600 = (u64)((u64)t_object_2e1599 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1600 = (u32)((u64)60UL);
+	t_field_2e1600 = (u64)((u64)t_object_2e1599 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1600 = (u32)((u64)70UL);
+	BLIT(t_binding_2e1575, t_object_2e1599, ((u64)8UL));
+	t_field_2e1607 = (u64)((u64)t_binding_2e1575 + (u64)((u64)0UL));
+	t__2e1608 = (u64)(u32)(*(i32 *)t_field_2e1607);
+	t__2e1606 = (u64)(u32)(((u32)t__2e1608 == (u32)((u64)60UL)));
+	t__2e1603 = (u64)(u32)t__2e1606;
+	if ((u32)t__2e1603) goto L__2e1604; else goto L__2e1605;
+	L__2e1604:;
+	t_field_2e1610 = (u64)((u64)t_binding_2e1575 + (u64)((u64)4UL));
+	t__2e1611 = (u64)(u32)(*(i32 *)t_field_2e1610);
+	t__2e1609 = (u64)(u32)(((u32)t__2e1611 == (u32)((u64)70UL)));
+	t__2e1603 = (u64)(u32)t__2e1609;
+	goto L__2e1605;
+	L__2e1605:;
+	if ((u32)t__2e1603) goto L_passed_2e1602; else goto L_failed_2e1601;
+	L_failed_2e1601:;
+	t_abortsite_2e1592 = ((u64)1UL);
+	goto L_abort_2e1593;
+	L_passed_2e1602:;
+	goto L__2e1573;
+	L__2e1612:;
+	L__2e1573:;
+	return;
+	L_abort_2e1593:;
+	t__2e1594 = (u64)((u64)t_abortsite_2e1592 * (u64)((u64)16UL));
+	t__2e1594 = (u64)((u64)((u64)((char *)&D_abortsites_2e1591)) + (u64)t__2e1594);
+	t__2e1595 = (u64)(*(u64 *)t__2e1594);
+	t__2e1596 = (u64)((u64)t__2e1594 + (u64)((u64)8UL));
+	t__2e1597 = (u64)(*(u32 *)t__2e1596);
+	t__2e1596 = (u64)((u64)t__2e1594 + (u64)((u64)12UL));
+	t__2e1598 = (u64)(*(u32 *)t__2e1596);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1595, (u64)t__2e1597, (u64)t__2e1598, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_storage(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e1625;
+	u64 t__2e1628;
+	u64 t__2e1629;
+	u64 t__2e1630;
+	u64 t__2e1632;
+	u64 t__2e1633;
+	u64 t__2e1634;
+	u64 t__2e1635;
+	u64 t__2e1636;
+	u64 t__2e1638;
+	u64 t__2e1639;
+	u64 t__2e1643;
+	u64 t__2e1644;
+	u64 t__2e1645;
+	u64 t__2e1646;
+	u64 t__2e1647;
+	u64 t_abortsite_2e1641;
+	u64 t_binding_2e1617;
+	u64 t_binding_2e1622;
+	u64 t_field_2e1620;
+	u64 t_object_2e1618;
+	L_start_2e1613:;
+	t_binding_2e1617 = (u64)A0;
+	t_object_2e1618 = (u64)A1;
+	t_binding_2e1622 = (u64)A2;
+	L_body_2e1614:;
+	t_field_2e1620 = (u64)((u64)t_object_2e1618 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1620 = (u32)((u64)10UL);
+	t_field_2e1620 = (u64)((u64)t_object_2e1618 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1620 = (u32)((u64)20UL);
+	BLIT(t_binding_2e1617, t_object_2e1618, ((u64)8UL));
+	*(u64 *)t_binding_2e1622 = (u64)t_binding_2e1617;
+	t__2e1629 = (u64)(*(u64 *)t_binding_2e1622);
+	t__2e1632 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1630 = (u64)((u64)t__2e1632 * (u64)((u64)4UL));
+	t__2e1630 = (u64)((u64)t__2e1629 + (u64)t__2e1630);
+	t__2e1633 = (u64)(u32)(*(i32 *)t__2e1630);
+	t__2e1628 = (u64)(u32)(((u32)t__2e1633 == (u32)((u64)10UL)));
+	t__2e1625 = (u64)(u32)t__2e1628;
+	if ((u32)t__2e1625) goto L__2e1626; else goto L__2e1627;
+	L__2e1626:;
+	t__2e1635 = (u64)(*(u64 *)t_binding_2e1622);
+	t__2e1638 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1636 = (u64)((u64)t__2e1638 * (u64)((u64)4UL));
+	t__2e1636 = (u64)((u64)t__2e1635 + (u64)t__2e1636);
+	t__2e1639 = (u64)(u32)(*(i32 *)t__2e1636);
+	t__2e1634 = (u64)(u32)(((u32)t__2e1639 == (u32)((u64)20UL)));
+	t__2e1625 = (u64)(u32)t__2e1634;
+	goto L__2e1627;
+	L__2e1627:;
+	if ((u32)t__2e1625) goto L_passed_2e1624; else goto L_failed_2e1623;
+	L_failed_2e1623:;
+	t_abortsite_2e1641 = ((u64)0UL);
+	goto L_abort_2e1642;
+	L_passed_2e1624:;
+	goto L__2e1615;
+	L__2e1648:;
+	L__2e1615:;
+	return;
+	L_abort_2e1642:;
+	t__2e1643 = (u64)((u64)t_abortsite_2e1641 * (u64)((u64)16UL));
+	t__2e1643 = (u64)((u64)((u64)((char *)&D_abortsites_2e1640)) + (u64)t__2e1643);
+	t__2e1644 = (u64)(*(u64 *)t__2e1643);
+	t__2e1645 = (u64)((u64)t__2e1643 + (u64)((u64)8UL));
+	t__2e1646 = (u64)(*(u32 *)t__2e1645);
+	t__2e1645 = (u64)((u64)t__2e1643 + (u64)((u64)12UL));
+	t__2e1647 = (u64)(*(u32 *)t__2e1645);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1644, (u64)t__2e1646, (u64)t__2e1647, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_padding(void) {
+	char A0[16] __attribute__((aligned(16)));
+	u64 t__2e1655;
+	u64 t__2e1659;
+	u64 t__2e1660;
+	u64 t__2e1661;
+	u64 t__2e1662;
+	u64 t__2e1663;
+	u64 t__2e1666;
+	u64 t__2e1669;
+	u64 t__2e1672;
+	u64 t__2e1675;
+	u64 t__2e1678;
+	u64 t__2e1684;
+	u64 t__2e1685;
+	u64 t__2e1687;
+	u64 t__2e1688;
+	u64 t__2e1691;
+	u64 t__2e1692;
+	u64 t__2e1694;
+	u64 t__2e1695;
+	u64 t__2e1698;
+	u64 t__2e1699;
+	u64 t__2e1701;
+	u64 t__2e1702;
+	u64 t__2e1705;
+	u64 t__2e1706;
+	u64 t__2e1708;
+	u64 t__2e1709;
+	u64 t_abortsite_2e1657;
+	u64 t_binding_2e1679;
+	u64 t_field_2e1681;
+	u64 t_field_2e1686;
+	u64 t_field_2e1693;
+	u64 t_field_2e1700;
+	u64 t_field_2e1707;
+	L_start_2e1649:;
+	t_binding_2e1679 = (u64)A0;
+	L_body_2e1650:;
+	t__2e1655 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e1655) goto L_passed_2e1654; else goto L_failed_2e1653;
+	L_failed_2e1653:;
+	t_abortsite_2e1657 = ((u64)0UL);
+	goto L_abort_2e1658;
+	L_passed_2e1654:;
+	t__2e1666 = (u64)(u32)(((u64)((u64)16UL) == (u64)((u64)16UL)));
+	if ((u32)t__2e1666) goto L_passed_2e1665; else goto L_failed_2e1664;
+	L_failed_2e1664:;
+	t_abortsite_2e1657 = ((u64)1UL);
+	goto L_abort_2e1658;
+	L_passed_2e1665:;
+	t__2e1669 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e1669) goto L_passed_2e1668; else goto L_failed_2e1667;
+	L_failed_2e1667:;
+	t_abortsite_2e1657 = ((u64)2UL);
+	goto L_abort_2e1658;
+	L_passed_2e1668:;
+	t__2e1672 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e1672) goto L_passed_2e1671; else goto L_failed_2e1670;
+	L_failed_2e1670:;
+	t_abortsite_2e1657 = ((u64)3UL);
+	goto L_abort_2e1658;
+	L_passed_2e1671:;
+	t__2e1675 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e1675) goto L_passed_2e1674; else goto L_failed_2e1673;
+	L_failed_2e1673:;
+	t_abortsite_2e1657 = ((u64)4UL);
+	goto L_abort_2e1658;
+	L_passed_2e1674:;
+	t__2e1678 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e1678) goto L_passed_2e1677; else goto L_failed_2e1676;
+	L_failed_2e1676:;
+	t_abortsite_2e1657 = ((u64)5UL);
+	goto L_abort_2e1658;
+	L_passed_2e1677:;
+	t_field_2e1681 = (u64)((u64)t_binding_2e1679 + (u64)((u64)0UL));
+	*(u8 *)t_field_2e1681 = (u8)((u64)10UL);
+	t_field_2e1681 = (u64)((u64)t_binding_2e1679 + (u64)((u64)2UL));
+	*(u16 *)t_field_2e1681 = (u16)((u64)20UL);
+	t_field_2e1681 = (u64)((u64)t_binding_2e1679 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1681 = (u32)((u64)30UL);
+	t_field_2e1681 = (u64)((u64)t_binding_2e1679 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e1681 = (u64)((u64)40UL);
+	t_field_2e1686 = (u64)((u64)t_binding_2e1679 + (u64)((u64)0UL));
+	t__2e1687 = t_field_2e1686;
+	t__2e1688 = t__2e1687;
+	t__2e1685 = (u64)((u64)t__2e1688 % (u64)((u64)1UL));
+	t__2e1684 = (u64)(u32)(((u64)t__2e1685 == (u64)((u64)0UL)));
+	if ((u32)t__2e1684) goto L_passed_2e1683; else goto L_failed_2e1682;
+	L_failed_2e1682:;
+	t_abortsite_2e1657 = ((u64)6UL);
+	goto L_abort_2e1658;
+	L_passed_2e1683:;
+	t_field_2e1693 = (u64)((u64)t_binding_2e1679 + (u64)((u64)2UL));
+	t__2e1694 = t_field_2e1693;
+	t__2e1695 = t__2e1694;
+	t__2e1692 = (u64)((u64)t__2e1695 & (u64)((u64)1UL));
+	t__2e1691 = (u64)(u32)(((u64)t__2e1692 == (u64)((u64)0UL)));
+	if ((u32)t__2e1691) goto L_passed_2e1690; else goto L_failed_2e1689;
+	L_failed_2e1689:;
+	t_abortsite_2e1657 = ((u64)7UL);
+	goto L_abort_2e1658;
+	L_passed_2e1690:;
+	t_field_2e1700 = (u64)((u64)t_binding_2e1679 + (u64)((u64)4UL));
+	t__2e1701 = t_field_2e1700;
+	t__2e1702 = t__2e1701;
+	t__2e1699 = (u64)((u64)t__2e1702 & (u64)((u64)3UL));
+	t__2e1698 = (u64)(u32)(((u64)t__2e1699 == (u64)((u64)0UL)));
+	if ((u32)t__2e1698) goto L_passed_2e1697; else goto L_failed_2e1696;
+	L_failed_2e1696:;
+	t_abortsite_2e1657 = ((u64)8UL);
+	goto L_abort_2e1658;
+	L_passed_2e1697:;
+	t_field_2e1707 = (u64)((u64)t_binding_2e1679 + (u64)((u64)8UL));
+	t__2e1708 = t_field_2e1707;
+	t__2e1709 = t__2e1708;
+	t__2e1706 = (u64)((u64)t__2e1709 & (u64)((u64)7UL));
+	t__2e1705 = (u64)(u32)(((u64)t__2e1706 == (u64)((u64)0UL)));
+	if ((u32)t__2e1705) goto L_passed_2e1704; else goto L_failed_2e1703;
+	L_failed_2e1703:;
+	t_abortsite_2e1657 = ((u64)9UL);
+	goto L_abort_2e1658;
+	L_passed_2e1704:;
+	goto L__2e1651;
+	L__2e1710:;
+	L__2e1651:;
+	return;
+	L_abort_2e1658:;
+	t__2e1659 = (u64)((u64)t_abortsite_2e1657 * (u64)((u64)16UL));
+	t__2e1659 = (u64)((u64)((u64)((char *)&D_abortsites_2e1656)) + (u64)t__2e1659);
+	t__2e1660 = (u64)(*(u64 *)t__2e1659);
+	t__2e1661 = (u64)((u64)t__2e1659 + (u64)((u64)8UL));
+	t__2e1662 = (u64)(*(u32 *)t__2e1661);
+	t__2e1661 = (u64)((u64)t__2e1659 + (u64)((u64)12UL));
+	t__2e1663 = (u64)(*(u32 *)t__2e1661);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1660, (u64)t__2e1662, (u64)t__2e1663, (u64)((u64)6UL));
+	__builtin_trap();
+}
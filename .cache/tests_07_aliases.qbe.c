@@ -0,0 +1,1156 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort[] __asm__("rt.abort");
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e18 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; };
+struct __attribute__((packed)) S_abortsites_2e90 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e125 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e126 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e116 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e158 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e159 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e180 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e181 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e171 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e205 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e206 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e218 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e219 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e233 { u8 f0[20]; };
+struct __attribute__((packed)) S_strliteral_2e234 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e250 { u8 f0[26]; };
+struct __attribute__((packed)) S_strliteral_2e251 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e274 { u8 f0[8]; };
+struct __attribute__((packed)) S_strliteral_2e275 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e283 { u8 f0[12]; };
+struct __attribute__((packed)) S_strliteral_2e284 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e293 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e294 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e342 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e343 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e367 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e368 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e395 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e396 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e427 { u8 f0[25]; };
+struct __attribute__((packed)) S_strliteral_2e428 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e333 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_strdata_2e465 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e466 { char *f0; u64 f1; u64 f2; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e18 D_abortsites_2e18 __asm__("abortsites.18") __attribute__((used, section(".data.rel.ro.abortsites.18"), aligned(8)));
+static struct S_abortsites_2e90 D_abortsites_2e90 __asm__("abortsites.90") __attribute__((used, section(".data.rel.ro.abortsites.90"), aligned(8)));
+static const struct S_strdata_2e125 D_strdata_2e125 __asm__("strdata.125") __attribute__((used, section(".rodata.strdata.125"), aligned(8)));
+static struct S_strliteral_2e126 D_strliteral_2e126 __asm__("strliteral.126") __attribute__((used, section(".data.rel.ro.strliteral.126"), aligned(8)));
+static struct S_abortsites_2e116 D_abortsites_2e116 __asm__("abortsites.116") __attribute__((used, section(".data.rel.ro.abortsites.116"), aligned(8)));
+static const struct S_strdata_2e158 D_strdata_2e158 __asm__("strdata.158") __attribute__((used, section(".rodata.strdata.158"), aligned(8)));
+static struct S_strliteral_2e159 D_strliteral_2e159 __asm__("strliteral.159") __attribute__((used, section(".data.rel.ro.strliteral.159"), aligned(8)));
+static const struct S_strdata_2e180 D_strdata_2e180 __asm__("strdata.180") __attribute__((used, section(".rodata.strdata.180"), aligned(8)));
+static struct S_strliteral_2e181 D_strliteral_2e181 __asm__("strliteral.181") __attribute__((used, section(".data.rel.ro.strliteral.181"), aligned(8)));
+static struct S_abortsites_2e171 D_abortsites_2e171 __asm__("abortsites.171") __attribute__((used, section(".data.rel.ro.abortsites.171"), aligned(8)));
+static const struct S_strdata_2e205 D_strdata_2e205 __asm__("strdata.205") __attribute__((used, section(".rodata.strdata.205"), aligned(8)));
+static struct S_strliteral_2e206 D_strliteral_2e206 __asm__("strliteral.206") __attribute__((used, section(".data.rel.ro.strliteral.206"), aligned(8)));
+static const struct S_strdata_2e218 D_strdata_2e218 __asm__("strdata.218") __attribute__((used, section(".rodata.strdata.218"), aligned(8)));
+static struct S_strliteral_2e219 D_strliteral_2e219 __asm__("strliteral.219") __attribute__((used, section(".data.rel.ro.strliteral.219"), aligned(8)));
+static const struct S_strdata_2e233 D_strdata_2e233 __asm__("strdata.233") __attribute__((used, section(".rodata.strdata.233"), aligned(8)));
+static struct S_strliteral_2e234 D_strliteral_2e234 __asm__("strliteral.234") __attribute__((used, section(".data.rel.ro.strliteral.234"), aligned(8)));
+static const struct S_strdata_2e250 D_strdata_2e250 __asm__("strdata.250") __attribute__((used, section(".rodata.strdata.250"), aligned(8)));
+static struct S_strliteral_2e251 D_strliteral_2e251 __asm__("strliteral.251") __attribute__((used, section(".data.rel.ro.strliteral.251"), aligned(8)));
+static const struct S_strdata_2e274 D_strdata_2e274 __asm__("strdata.274") __attribute__((used, section(".rodata.strdata.274"), aligned(8)));
+static struct S_strliteral_2e275 D_strliteral_2e275 __asm__("strliteral.275") __attribute__((used, section(".data.rel.ro.strliteral.275"), aligned(8)));
+static const struct S_strdata_2e283 D_strdata_2e283 __asm__("strdata.283") __attribute__((used, section(".rodata.strdata.283"), aligned(8)));
+static struct S_strliteral_2e284 D_strliteral_2e284 __asm__("strliteral.284") __attribute__((used, section(".data.rel.ro.strliteral.284"), aligned(8)));
+static const struct S_strdata_2e293 D_strdata_2e293 __asm__("strdata.293") __attribute__((used, section(".rodata.strdata.293"), aligned(8)));
+static struct S_strliteral_2e294 D_strliteral_2e294 __asm__("strliteral.294") __attribute__((used, section(".data.rel.ro.strliteral.294"), aligned(8)));
+static const struct S_strdata_2e342 D_strdata_2e342 __asm__("strdata.342") __attribute__((used, section(".rodata.strdata.342"), aligned(8)));
+static struct S_strliteral_2e343 D_strliteral_2e343 __asm__("strliteral.343") __attribute__((used, section(".data.rel.ro.strliteral.343"), aligned(8)));
+static const struct S_strdata_2e367 D_strdata_2e367 __asm__("strdata.367") __attribute__((used, section(".rodata.strdata.367"), aligned(8)));
+static struct S_strliteral_2e368 D_strliteral_2e368 __asm__("strliteral.368") __attribute__((used, section(".data.rel.ro.strliteral.368"), aligned(8)));
+static const struct S_strdata_2e395 D_strdata_2e395 __asm__("strdata.395") __attribute__((used, section(".rodata.strdata.395"), aligned(8)));
+static struct S_strliteral_2e396 D_strliteral_2e396 __asm__("strliteral.396") __attribute__((used, section(".data.rel.ro.strliteral.396"), aligned(8)));
+static const struct S_strdata_2e427 D_strdata_2e427 __asm__("strdata.427") __attribute__((used, section(".rodata.strdata.427"), aligned(8)));
+static struct S_strliteral_2e428 D_strliteral_2e428 __asm__("strliteral.428") __attribute__((used, section(".data.rel.ro.strliteral.428"), aligned(8)));
+static struct S_abortsites_2e333 D_abortsites_2e333 __asm__("abortsites.333") __attribute__((used, section(".data.rel.ro.abortsites.333"), aligned(8)));
+static const struct S_strdata_2e465 D_strdata_2e465 __asm__("strdata.465") __attribute__((used, section(".rodata.strdata.465"), aligned(8)));
+static struct S_strliteral_2e466 D_strliteral_2e466 __asm__("strliteral.466") __attribute__((used, section(".data.rel.ro.strliteral.466"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_measurement(void) __asm__("measurement") __attribute__((used, section(".text.measurement")));
+static void F_recursive(void) __asm__("recursive") __attribute__((used, section(".text.recursive")));
+static void F_alias__alias(void) __asm__("alias_alias") __attribute__((used, section(".text.alias_alias")));
+static void F_alias__tagged(void) __asm__("alias_tagged") __attribute__((used, section(".text.alias_tagged")));
+static void F_alias__struct(void) __asm__("alias_struct") __attribute__((used, section(".text.alias_struct")));
+static void F_alias__fn(void) __asm__("alias_fn") __attribute__((used, section(".text.alias_fn")));
+static u32 F_foo(u32 p_n) __asm__("foo") __attribute__((used, section(".text.foo")));
+static void F_alias__array(void) __asm__("alias_array") __attribute__((used, section(".text.alias_array")));
+static void F_alias__builtin(void) __asm__("alias_builtin") __attribute__((used, section(".text.alias_builtin")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\060\067\055\141\154\151\141\163\145\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 19U, 19U };
+static struct S_abortsites_2e18 D_abortsites_2e18 = { (char *)((char *)&D_strliteral_2e1) + 0, 109U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 111U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 113U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 114U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 115U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 117U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 118U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 119U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 120U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 121U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 123U, 15U };
+static struct S_abortsites_2e90 D_abortsites_2e90 = { (char *)((char *)&D_strliteral_2e1) + 0, 105U, 15U };
+static const struct S_strdata_2e125 D_strdata_2e125 = { "\141\154\151\141\163\040\141\154\151\141\163" };
+static struct S_strliteral_2e126 D_strliteral_2e126 = { (char *)((char *)&D_strdata_2e125) + 0, 11U, 11U };
+static struct S_abortsites_2e116 D_abortsites_2e116 = { (char *)((char *)&D_strliteral_2e1) + 0, 91U, 17U };
+static const struct S_strdata_2e158 D_strdata_2e158 = { "\164\141\147" };
+static struct S_strliteral_2e159 D_strliteral_2e159 = { (char *)((char *)&D_strdata_2e158) + 0, 3U, 3U };
+static const struct S_strdata_2e180 D_strdata_2e180 = { "\166\141\154\165\145" };
+static struct S_strliteral_2e181 D_strliteral_2e181 = { (char *)((char *)&D_strdata_2e180) + 0, 5U, 5U };
+static struct S_abortsites_2e171 D_abortsites_2e171 = { (char *)((char *)&D_strliteral_2e1) + 0, 82U, 20U };
+static const struct S_strdata_2e205 D_strdata_2e205 = { "\163\164\162\165\143\164\040\141\154\151\141\163" };
+static struct S_strliteral_2e206 D_strliteral_2e206 = { (char *)((char *)&D_strdata_2e205) + 0, 12U, 12U };
+static const struct S_strdata_2e218 D_strdata_2e218 = { "\163\164\162\165\143\164\040\141\154\151\141\163\040\160\164\162" };
+static struct S_strliteral_2e219 D_strliteral_2e219 = { (char *)((char *)&D_strdata_2e218) + 0, 16U, 16U };
+static const struct S_strdata_2e233 D_strdata_2e233 = { "\163\164\162\165\143\164\040\141\154\151\141\163\040\160\164\162\040\160\164\162" };
+static struct S_strliteral_2e234 D_strliteral_2e234 = { (char *)((char *)&D_strdata_2e233) + 0, 20U, 20U };
+static const struct S_strdata_2e250 D_strdata_2e250 = { "\163\164\162\165\143\164\040\141\154\151\141\163\040\160\164\162\040\160\164\162\040\141\154\151\141\163" };
+static struct S_strliteral_2e251 D_strliteral_2e251 = { (char *)((char *)&D_strdata_2e250) + 0, 26U, 26U };
+static const struct S_strdata_2e274 D_strdata_2e274 = { "\146\156\040\141\154\151\141\163" };
+static struct S_strliteral_2e275 D_strliteral_2e275 = { (char *)((char *)&D_strdata_2e274) + 0, 8U, 8U };
+static const struct S_strdata_2e283 D_strdata_2e283 = { "\146\156\040\160\164\162\040\141\154\151\141\163" };
+static struct S_strliteral_2e284 D_strliteral_2e284 = { (char *)((char *)&D_strdata_2e283) + 0, 12U, 12U };
+static const struct S_strdata_2e293 D_strdata_2e293 = { "\146\156\040\160\164\162\040\160\164\162\040\141\154\151\141\163" };
+static struct S_strliteral_2e294 D_strliteral_2e294 = { (char *)((char *)&D_strdata_2e293) + 0, 16U, 16U };
+static const struct S_strdata_2e342 D_strdata_2e342 = { "\141\162\162\141\171\040\141\154\151\141\163" };
+static struct S_strliteral_2e343 D_strliteral_2e343 = { (char *)((char *)&D_strdata_2e342) + 0, 11U, 11U };
+static const struct S_strdata_2e367 D_strdata_2e367 = { "\141\162\162\141\171\040\160\164\162\040\141\154\151\141\163" };
+static struct S_strliteral_2e368 D_strliteral_2e368 = { (char *)((char *)&D_strdata_2e367) + 0, 15U, 15U };
+static const struct S_strdata_2e395 D_strdata_2e395 = { "\141\162\162\141\171\040\160\164\162\040\160\164\162\040\141\154\151\141\163" };
+static struct S_strliteral_2e396 D_strliteral_2e396 = { (char *)((char *)&D_strdata_2e395) + 0, 19U, 19U };
+static const struct S_strdata_2e427 D_strdata_2e427 = { "\141\162\162\141\171\040\160\164\162\040\160\164\162\040\163\154\151\143\145\040\141\154\151\141\163" };
+static struct S_strliteral_2e428 D_strliteral_2e428 = { (char *)((char *)&D_strdata_2e427) + 0, 25U, 25U };
+static struct S_abortsites_2e333 D_abortsites_2e333 = { (char *)((char *)&D_strliteral_2e1) + 0, 24U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 30U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 33U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 34U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 35U, 17U };
+static const struct S_strdata_2e465 D_strdata_2e465 = { "\142\165\151\154\164\055\151\156\040\141\154\151\141\163" };
+static struct S_strliteral_2e466 D_strliteral_2e466 = { (char *)((char *)&D_strdata_2e465) + 0, 14U, 14U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_alias__builtin)))();
+	((void (*)(void))((u64)((char *)&F_alias__array)))();
+	((void (*)(void))((u64)((char *)&F_alias__fn)))();
+	((void (*)(void))((u64)((char *)&F_alias__struct)))();
+	((void (*)(void))((u64)((char *)&F_alias__tagged)))();
+	((void (*)(void))((u64)((char *)&F_alias__alias)))();
+	((void (*)(void))((u64)((char *)&F_recursive)))();
+	((void (*)(void))((u64)((char *)&F_measurement)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_measurement(void) {
+	u64 t__2e13;
+	u64 t__2e16;
+	u64 t__2e17;
+	u64 t__2e21;
+	u64 t__2e22;
+	u64 t__2e23;
+	u64 t__2e24;
+	u64 t__2e25;
+	u64 t__2e28;
+	u64 t__2e31;
+	u64 t__2e34;
+	u64 t__2e37;
+	u64 t__2e40;
+	u64 t__2e43;
+	u64 t__2e46;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e53;
+	u64 t__2e56;
+	u64 t__2e59;
+	u64 t__2e62;
+	u64 t__2e65;
+	u64 t__2e68;
+	u64 t_abortsite_2e19;
+	L_start_2e7:;
+	L_body_2e8:;
+	t__2e16 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	t__2e13 = (u64)(u32)t__2e16;
+	if ((u32)t__2e13) goto L__2e14; else goto L__2e15;
+	L__2e14:;
+	t__2e17 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	t__2e13 = (u64)(u32)t__2e17;
+	goto L__2e15;
+	L__2e15:;
+	if ((u32)t__2e13) goto L_passed_2e12; else goto L_failed_2e11;
+	L_failed_2e11:;
+	t_abortsite_2e19 = ((u64)0UL);
+	goto L_abort_2e20;
+	L_passed_2e12:;
+	t__2e28 = (u64)(u32)(((u64)((u64)12UL) == (u64)((u64)12UL)));
+	if ((u32)t__2e28) goto L_passed_2e27; else goto L_failed_2e26;
+	L_failed_2e26:;
+	t_abortsite_2e19 = ((u64)1UL);
+	goto L_abort_2e20;
+	L_passed_2e27:;
+	t__2e31 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e31) goto L_passed_2e30; else goto L_failed_2e29;
+	L_failed_2e29:;
+	t_abortsite_2e19 = ((u64)2UL);
+	goto L_abort_2e20;
+	L_passed_2e30:;
+	t__2e34 = (u64)(u32)(((u64)((u64)24UL) == (u64)((u64)24UL)));
+	if ((u32)t__2e34) goto L_passed_2e33; else goto L_failed_2e32;
+	L_failed_2e32:;
+	t_abortsite_2e19 = ((u64)3UL);
+	goto L_abort_2e20;
+	L_passed_2e33:;
+	t__2e37 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e37) goto L_passed_2e36; else goto L_failed_2e35;
+	L_failed_2e35:;
+	t_abortsite_2e19 = ((u64)4UL);
+	goto L_abort_2e20;
+	L_passed_2e36:;
+	t__2e40 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e40) goto L_passed_2e39; else goto L_failed_2e38;
+	L_failed_2e38:;
+	t_abortsite_2e19 = ((u64)5UL);
+	goto L_abort_2e20;
+	L_passed_2e39:;
+	t__2e43 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e43) goto L_passed_2e42; else goto L_failed_2e41;
+	L_failed_2e41:;
+	t_abortsite_2e19 = ((u64)6UL);
+	goto L_abort_2e20;
+	L_passed_2e42:;
+	t__2e49 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	t__2e46 = (u64)(u32)t__2e49;
+	if ((u32)t__2e46) goto L__2e47; else goto L__2e48;
+	L__2e47:;
+	t__2e50 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	t__2e46 = (u64)(u32)t__2e50;
+	goto L__2e48;
+	L__2e48:;
+	if ((u32)t__2e46) goto L_passed_2e45; else goto L_failed_2e44;
+	L_failed_2e44:;
+	t_abortsite_2e19 = ((u64)7UL);
+	goto L_abort_2e20;
+	L_passed_2e45:;
+	t__2e53 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e53) goto L_passed_2e52; else goto L_failed_2e51;
+	L_failed_2e51:;
+	t_abortsite_2e19 = ((u64)8UL);
+	goto L_abort_2e20;
+	L_passed_2e52:;
+	t__2e56 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e56) goto L_passed_2e55; else goto L_failed_2e54;
+	L_failed_2e54:;
+	t_abortsite_2e19 = ((u64)9UL);
+	goto L_abort_2e20;
+	L_passed_2e55:;
+	t__2e59 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e59) goto L_passed_2e58; else goto L_failed_2e57;
+	L_failed_2e57:;
+	t_abortsite_2e19 = ((u64)10UL);
+	goto L_abort_2e20;
+	L_passed_2e58:;
+	t__2e62 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e62) goto L_passed_2e61; else goto L_failed_2e60;
+	L_failed_2e60:;
+	t_abortsite_2e19 = ((u64)11UL);
+	goto L_abort_2e20;
+	L_passed_2e61:;
+	t__2e65 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e65) goto L_passed_2e64; else goto L_failed_2e63;
+	L_failed_2e63:;
+	t_abortsite_2e19 = ((u64)12UL);
+	goto L_abort_2e20;
+	L_passed_2e64:;
+	t__2e68 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e68) goto L_passed_2e67; else goto L_failed_2e66;
+	L_failed_2e66:;
+	t_abortsite_2e19 = ((u64)13UL);
+	goto L_abort_2e20;
+	L_passed_2e67:;
+	goto L__2e9;
+	L__2e69:;
+	L__2e9:;
+	return;
+	L_abort_2e20:;
+	t__2e21 = (u64)((u64)t_abortsite_2e19 * (u64)((u64)16UL));
+	t__2e21 = (u64)((u64)((u64)((char *)&D_abortsites_2e18)) + (u64)t__2e21);
+	t__2e22 = (u64)(*(u64 *)t__2e21);
+	t__2e23 = (u64)((u64)t__2e21 + (u64)((u64)8UL));
+	t__2e24 = (u64)(*(u32 *)t__2e23);
+	t__2e23 = (u64)((u64)t__2e21 + (u64)((u64)12UL));
+	t__2e25 = (u64)(*(u32 *)t__2e23);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e22, (u64)t__2e24, (u64)t__2e25, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_recursive(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e78;
+	u64 t__2e83;
+	u64 t__2e85;
+	u64 t__2e87;
+	u64 t__2e89;
+	u64 t__2e93;
+	u64 t__2e94;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e97;
+	u64 t_abortsite_2e91;
+	u64 t_binding_2e74;
+	u64 t_field_2e77;
+	u64 t_field_2e80;
+	u64 t_field_2e84;
+	u64 t_field_2e86;
+	u64 t_field_2e88;
+	u64 t_object_2e75;
+	L_start_2e70:;
+	t_binding_2e74 = (u64)A0;
+	t_object_2e75 = (u64)A1;
+	L_body_2e71:;
+	t_field_2e77 = (u64)((u64)t_object_2e75 + (u64)((u64)0UL));
+	t__2e78 = ((u64)0UL);
+	*(u64 *)t_field_2e77 = (u64)t__2e78;
+	BLIT(t_binding_2e74, t_object_2e75, ((u64)8UL));
+	t_field_2e80 = (u64)((u64)t_binding_2e74 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e80 = (u64)t_binding_2e74;
+	t_field_2e84 = (u64)((u64)t_binding_2e74 + (u64)((u64)0UL));
+	t__2e85 = (u64)(*(u64 *)t_field_2e84);
+	t_field_2e86 = (u64)((u64)t_binding_2e74 + (u64)((u64)0UL));
+	t__2e87 = (u64)(*(u64 *)t_field_2e86);
+	t_field_2e88 = (u64)((u64)t__2e87 + (u64)((u64)0UL));
+	t__2e89 = (u64)(*(u64 *)t_field_2e88);
+	t__2e83 = (u64)(u32)(((u64)t__2e85 == (u64)t__2e89));
+	if ((u32)t__2e83) goto L_passed_2e82; else goto L_failed_2e81;
+	L_failed_2e81:;
+	t_abortsite_2e91 = ((u64)0UL);
+	goto L_abort_2e92;
+	L_passed_2e82:;
+	goto L__2e72;
+	L__2e98:;
+	L__2e72:;
+	return;
+	L_abort_2e92:;
+	t__2e93 = (u64)((u64)t_abortsite_2e91 * (u64)((u64)16UL));
+	t__2e93 = (u64)((u64)((u64)((char *)&D_abortsites_2e90)) + (u64)t__2e93);
+	t__2e94 = (u64)(*(u64 *)t__2e93);
+	t__2e95 = (u64)((u64)t__2e93 + (u64)((u64)8UL));
+	t__2e96 = (u64)(*(u32 *)t__2e95);
+	t__2e95 = (u64)((u64)t__2e93 + (u64)((u64)12UL));
+	t__2e97 = (u64)(*(u32 *)t__2e95);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e94, (u64)t__2e96, (u64)t__2e97, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_alias__alias(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char B2[24] __attribute__((aligned(16)));
+	char B3[24] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	u64 t__2e109;
+	u64 t__2e110;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e113;
+	u64 t__2e119;
+	u64 t__2e120;
+	u64 t__2e121;
+	u64 t__2e122;
+	u64 t__2e123;
+	u64 t__2e124;
+	u64 t__2e130;
+	u64 t__2e131;
+	u64 t__2e132;
+	u64 t__2e133;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e139;
+	u64 t_abortsite_2e117;
+	u64 t_binding_2e103;
+	u64 t_binding_2e106;
+	u64 t_item_2e105;
+	L_start_2e99:;
+	t_binding_2e103 = (u64)A0;
+	t_binding_2e106 = (u64)A1;
+	L_body_2e100:;
+	t_item_2e105 = (u64)((u64)t_binding_2e103 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e105 = (u32)((u64)1UL);
+	t_item_2e105 = (u64)((u64)t_binding_2e103 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e105 = (u32)((u64)2UL);
+	t_item_2e105 = (u64)((u64)t_binding_2e103 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e105 = (u32)((u64)3UL);
+	*(u32 *)t_binding_2e106 = (u32)((u64)0UL);
+	t__2e111 = (u64)(u32)(*(i32 *)t_binding_2e106);
+	t__2e112 = (u64)((i64)(i32)t__2e111);
+	t__2e110 = (u64)((u64)t__2e112 * (u64)((u64)4UL));
+	t__2e110 = (u64)((u64)t_binding_2e103 + (u64)t__2e110);
+	t__2e113 = (u64)(u32)(((u64)t__2e112 < (u64)((u64)3UL)));
+	if ((u32)t__2e113) goto L__2e115; else goto L__2e114;
+	L__2e114:;
+	t_abortsite_2e117 = ((u64)0UL);
+	goto L_abort_2e118;
+	L__2e115:;
+	t__2e124 = (u64)(u32)(*(i32 *)t__2e110);
+	t__2e109 = (u64)(u32)(((u32)t__2e124 == (u32)((u64)1UL)));
+	if ((u32)t__2e109) goto L_passed_2e108; else goto L_failed_2e107;
+	L_failed_2e107:;
+	BLIT((u64)B2, ((u64)((char *)&D_strliteral_2e126)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)91UL), (u64)((u64)15UL), (u64)B2);
+	__builtin_trap();
+	L_passed_2e108:;
+	t__2e132 = (u64)((i64)(i32)((u64)1UL));
+	t__2e131 = (u64)((u64)t__2e132 * (u64)((u64)4UL));
+	t__2e131 = (u64)((u64)t_binding_2e103 + (u64)t__2e131);
+	t__2e133 = (u64)(u32)(*(i32 *)t__2e131);
+	t__2e130 = (u64)(u32)(((u32)t__2e133 == (u32)((u64)2UL)));
+	if ((u32)t__2e130) goto L_passed_2e129; else goto L_failed_2e128;
+	L_failed_2e128:;
+	BLIT((u64)B3, ((u64)((char *)&D_strliteral_2e126)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)92UL), (u64)((u64)15UL), (u64)B3);
+	__builtin_trap();
+	L_passed_2e129:;
+	t__2e138 = (u64)((i64)(i32)((u64)2UL));
+	t__2e137 = (u64)((u64)t__2e138 * (u64)((u64)4UL));
+	t__2e137 = (u64)((u64)t_binding_2e103 + (u64)t__2e137);
+	t__2e139 = (u64)(u32)(*(i32 *)t__2e137);
+	t__2e136 = (u64)(u32)(((u32)t__2e139 == (u32)((u64)3UL)));
+	if ((u32)t__2e136) goto L_passed_2e135; else goto L_failed_2e134;
+	L_failed_2e134:;
+	BLIT((u64)B4, ((u64)((char *)&D_strliteral_2e126)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)93UL), (u64)((u64)15UL), (u64)B4);
+	__builtin_trap();
+	L_passed_2e135:;
+	goto L__2e101;
+	L__2e140:;
+	L__2e101:;
+	return;
+	L_abort_2e118:;
+	t__2e119 = (u64)((u64)t_abortsite_2e117 * (u64)((u64)16UL));
+	t__2e119 = (u64)((u64)((u64)((char *)&D_abortsites_2e116)) + (u64)t__2e119);
+	t__2e120 = (u64)(*(u64 *)t__2e119);
+	t__2e121 = (u64)((u64)t__2e119 + (u64)((u64)8UL));
+	t__2e122 = (u64)(*(u32 *)t__2e121);
+	t__2e121 = (u64)((u64)t__2e119 + (u64)((u64)12UL));
+	t__2e123 = (u64)(*(u32 *)t__2e121);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e120, (u64)t__2e122, (u64)t__2e123, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_alias__tagged(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char B1[24] __attribute__((aligned(16)));
+	char B2[24] __attribute__((aligned(16)));
+	u64 t__2e149;
+	u64 t__2e152;
+	u64 t__2e155;
+	u64 t__2e162;
+	u64 t__2e163;
+	u64 t__2e164;
+	u64 t__2e168;
+	u64 t__2e174;
+	u64 t__2e175;
+	u64 t__2e176;
+	u64 t__2e177;
+	u64 t__2e178;
+	u64 t__2e179;
+	u64 t_abortsite_2e172;
+	u64 t_binding_2e145;
+	u64 t_subval_2e154;
+	u64 t_subval_2e167;
+	L_start_2e141:;
+	t_binding_2e145 = (u64)A0;
+	L_body_2e142:;
+	*(u32 *)t_binding_2e145 = (u32)((u64)1099590421UL);
+	t__2e149 = (u64)((u64)t_binding_2e145 + (u64)((u64)4UL));
+	*(u32 *)t__2e149 = (u32)((u64)42UL);
+	t__2e152 = (u64)(u32)(*(u32 *)t_binding_2e145);
+	t_subval_2e154 = t_binding_2e145;
+	t__2e155 = (u64)(u32)(((u32)t__2e152 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e155) goto L_subtype_2e157; else goto L_passed_2e153;
+	L_subtype_2e157:;
+	goto L_passed_2e153;
+	L_passed_2e153:;
+	if ((u32)t__2e155) goto L_passed_2e151; else goto L_failed_2e150;
+	L_failed_2e150:;
+	BLIT((u64)B1, ((u64)((char *)&D_strliteral_2e159)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)81UL), (u64)((u64)15UL), (u64)B1);
+	__builtin_trap();
+	L_passed_2e151:;
+	t__2e163 = t_binding_2e145;
+	t__2e164 = (u64)(u32)(*(u32 *)t_binding_2e145);
+	t_subval_2e167 = t_binding_2e145;
+	t__2e168 = (u64)(u32)(((u32)t__2e164 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e168) goto L_subtype_2e170; else goto L_failed_2e166;
+	L_subtype_2e170:;
+	goto L_passed_2e165;
+	L_failed_2e166:;
+	t_abortsite_2e172 = ((u64)0UL);
+	goto L_abort_2e173;
+	L_passed_2e165:;
+	t__2e163 = (u64)((u64)t__2e163 + (u64)((u64)4UL));
+	t__2e179 = (u64)(u32)(*(i32 *)t__2e163);
+	t__2e162 = (u64)(u32)(((u32)t__2e179 == (u32)((u64)42UL)));
+	if ((u32)t__2e162) goto L_passed_2e161; else goto L_failed_2e160;
+	L_failed_2e160:;
+	BLIT((u64)B2, ((u64)((char *)&D_strliteral_2e181)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)82UL), (u64)((u64)15UL), (u64)B2);
+	__builtin_trap();
+	L_passed_2e161:;
+	goto L__2e143;
+	L__2e182:;
+	L__2e143:;
+	return;
+	L_abort_2e173:;
+	t__2e174 = (u64)((u64)t_abortsite_2e172 * (u64)((u64)16UL));
+	t__2e174 = (u64)((u64)((u64)((char *)&D_abortsites_2e171)) + (u64)t__2e174);
+	t__2e175 = (u64)(*(u64 *)t__2e174);
+	t__2e176 = (u64)((u64)t__2e174 + (u64)((u64)8UL));
+	t__2e177 = (u64)(*(u32 *)t__2e176);
+	t__2e176 = (u64)((u64)t__2e174 + (u64)((u64)12UL));
+	t__2e178 = (u64)(*(u32 *)t__2e176);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e175, (u64)t__2e177, (u64)t__2e178, (u64)((u64)1UL));
+	__builtin_trap();
+}
+static void F_alias__struct(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	u64 t__2e198;
+	u64 t__2e202;
+	u64 t__2e204;
+	u64 t__2e209;
+	u64 t__2e211;
+	u64 t__2e214;
+	u64 t__2e215;
+	u64 t__2e217;
+	u64 t__2e222;
+	u64 t__2e223;
+	u64 t__2e225;
+	u64 t__2e228;
+	u64 t__2e229;
+	u64 t__2e230;
+	u64 t__2e232;
+	u64 t__2e237;
+	u64 t__2e238;
+	u64 t__2e239;
+	u64 t__2e241;
+	u64 t__2e244;
+	u64 t__2e246;
+	u64 t__2e247;
+	u64 t__2e249;
+	u64 t__2e254;
+	u64 t__2e256;
+	u64 t__2e257;
+	u64 t__2e259;
+	u64 t_binding_2e187;
+	u64 t_binding_2e192;
+	u64 t_binding_2e193;
+	u64 t_binding_2e194;
+	u64 t_field_2e190;
+	u64 t_field_2e197;
+	u64 t_field_2e203;
+	u64 t_field_2e210;
+	u64 t_field_2e216;
+	u64 t_field_2e224;
+	u64 t_field_2e231;
+	u64 t_field_2e240;
+	u64 t_field_2e245;
+	u64 t_field_2e248;
+	u64 t_field_2e255;
+	u64 t_field_2e258;
+	u64 t_object_2e188;
+	u64 t_object_2e195;
+	L_start_2e183:;
+	t_binding_2e187 = (u64)A0;
+	t_object_2e188 = (u64)A1;
+	t_binding_2e192 = (u64)A2;
+	t_binding_2e193 = (u64)A3;
+	t_binding_2e194 = (u64)A4;
+	t_object_2e195 = (u64)A5;
+	L_body_2e184:;
+	t_field_2e190 = (u64)((u64)t_object_2e188 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e190 = (u32)((u64)42UL);
+	t_field_2e190 = (u64)((u64)t_object_2e188 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e190 = (u32)((u64)69UL);
+	BLIT(t_binding_2e187, t_object_2e188, ((u64)8UL));
+	*(u64 *)t_binding_2e192 = (u64)t_binding_2e187;
+	*(u64 *)t_binding_2e193 = (u64)t_binding_2e192;
+	t_field_2e197 = (u64)((u64)t_object_2e195 + (u64)((u64)0UL));
+	t__2e198 = (u64)(*(u64 *)t_binding_2e193);
+	*(u64 *)t_field_2e197 = (u64)t__2e198;
+	BLIT(t_binding_2e194, t_object_2e195, ((u64)8UL));
+	t_field_2e203 = (u64)((u64)t_binding_2e187 + (u64)((u64)0UL));
+	t__2e204 = (u64)(u32)(*(i32 *)t_field_2e203);
+	t__2e202 = (u64)(u32)(((u32)t__2e204 == (u32)((u64)42UL)));
+	if ((u32)t__2e202) goto L_passed_2e201; else goto L_failed_2e200;
+	L_failed_2e200:;
+	BLIT((u64)B6, ((u64)((char *)&D_strliteral_2e206)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)67UL), (u64)((u64)15UL), (u64)B6);
+	__builtin_trap();
+	L_passed_2e201:;
+	t_field_2e210 = (u64)((u64)t_binding_2e187 + (u64)((u64)4UL));
+	t__2e211 = (u64)(u32)(*(i32 *)t_field_2e210);
+	t__2e209 = (u64)(u32)(((u32)t__2e211 == (u32)((u64)69UL)));
+	if ((u32)t__2e209) goto L_passed_2e208; else goto L_failed_2e207;
+	L_failed_2e207:;
+	BLIT((u64)B7, ((u64)((char *)&D_strliteral_2e206)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)68UL), (u64)((u64)15UL), (u64)B7);
+	__builtin_trap();
+	L_passed_2e208:;
+	t__2e215 = (u64)(*(u64 *)t_binding_2e192);
+	t_field_2e216 = (u64)((u64)t__2e215 + (u64)((u64)0UL));
+	t__2e217 = (u64)(u32)(*(i32 *)t_field_2e216);
+	t__2e214 = (u64)(u32)(((u32)t__2e217 == (u32)((u64)42UL)));
+	if ((u32)t__2e214) goto L_passed_2e213; else goto L_failed_2e212;
+	L_failed_2e212:;
+	BLIT((u64)B8, ((u64)((char *)&D_strliteral_2e219)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)69UL), (u64)((u64)15UL), (u64)B8);
+	__builtin_trap();
+	L_passed_2e213:;
+	t__2e223 = (u64)(*(u64 *)t_binding_2e192);
+	t_field_2e224 = (u64)((u64)t__2e223 + (u64)((u64)4UL));
+	t__2e225 = (u64)(u32)(*(i32 *)t_field_2e224);
+	t__2e222 = (u64)(u32)(((u32)t__2e225 == (u32)((u64)69UL)));
+	if ((u32)t__2e222) goto L_passed_2e221; else goto L_failed_2e220;
+	L_failed_2e220:;
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e219)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)70UL), (u64)((u64)15UL), (u64)B9);
+	__builtin_trap();
+	L_passed_2e221:;
+	t__2e229 = (u64)(*(u64 *)t_binding_2e193);
+	t__2e230 = (u64)(*(u64 *)t__2e229);
+	t_field_2e231 = (u64)((u64)t__2e230 + (u64)((u64)0UL));
+	t__2e232 = (u64)(u32)(*(i32 *)t_field_2e231);
+	t__2e228 = (u64)(u32)(((u32)t__2e232 == (u32)((u64)42UL)));
+	if ((u32)t__2e228) goto L_passed_2e227; else goto L_failed_2e226;
+	L_failed_2e226:;
+	BLIT((u64)B10, ((u64)((char *)&D_strliteral_2e234)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)71UL), (u64)((u64)15UL), (u64)B10);
+	__builtin_trap();
+	L_passed_2e227:;
+	t__2e238 = (u64)(*(u64 *)t_binding_2e193);
+	t__2e239 = (u64)(*(u64 *)t__2e238);
+	t_field_2e240 = (u64)((u64)t__2e239 + (u64)((u64)4UL));
+	t__2e241 = (u64)(u32)(*(i32 *)t_field_2e240);
+	t__2e237 = (u64)(u32)(((u32)t__2e241 == (u32)((u64)69UL)));
+	if ((u32)t__2e237) goto L_passed_2e236; else goto L_failed_2e235;
+	L_failed_2e235:;
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e234)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)72UL), (u64)((u64)15UL), (u64)B11);
+	__builtin_trap();
+	L_passed_2e236:;
+	t_field_2e245 = (u64)((u64)t_binding_2e194 + (u64)((u64)0UL));
+	t__2e246 = (u64)(*(u64 *)t_field_2e245);
+	t__2e247 = (u64)(*(u64 *)t__2e246);
+	t_field_2e248 = (u64)((u64)t__2e247 + (u64)((u64)0UL));
+	t__2e249 = (u64)(u32)(*(i32 *)t_field_2e248);
+	t__2e244 = (u64)(u32)(((u32)t__2e249 == (u32)((u64)42UL)));
+	if ((u32)t__2e244) goto L_passed_2e243; else goto L_failed_2e242;
+	L_failed_2e242:;
+	BLIT((u64)B12, ((u64)((char *)&D_strliteral_2e251)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)73UL), (u64)((u64)15UL), (u64)B12);
+	__builtin_trap();
+	L_passed_2e243:;
+	t_field_2e255 = (u64)((u64)t_binding_2e194 + (u64)((u64)0UL));
+	t__2e256 = (u64)(*(u64 *)t_field_2e255);
+	t__2e257 = (u64)(*(u64 *)t__2e256);
+	t_field_2e258 = (u64)((u64)t__2e257 + (u64)((u64)4UL));
+	t__2e259 = (u64)(u32)(*(i32 *)t_field_2e258);
+	t__2e254 = (u64)(u32)(((u32)t__2e259 == (u32)((u64)69UL)));
+	if ((u32)t__2e254) goto L_passed_2e253; else goto L_failed_2e252;
+	L_failed_2e252:;
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e251)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)74UL), (u64)((u64)15UL), (u64)B13);
+	__builtin_trap();
+	L_passed_2e253:;
+	goto L__2e185;
+	L__2e260:;
+	L__2e185:;
+	return;
+}
+static void F_alias__fn(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char B3[24] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	u64 t__2e270;
+	u64 t__2e271;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t__2e280;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e289;
+	u64 t__2e290;
+	u64 t__2e291;
+	u64 t__2e292;
+	u64 t_binding_2e265;
+	u64 t_binding_2e266;
+	u64 t_binding_2e267;
+	L_start_2e261:;
+	t_binding_2e265 = (u64)A0;
+	t_binding_2e266 = (u64)A1;
+	t_binding_2e267 = (u64)A2;
+	L_body_2e262:;
+	*(u64 *)t_binding_2e265 = (u64)((u64)((char *)&F_foo));
+	*(u64 *)t_binding_2e266 = (u64)t_binding_2e265;
+	*(u64 *)t_binding_2e267 = (u64)t_binding_2e266;
+	t__2e271 = (u64)(*(u64 *)t_binding_2e265);
+	t__2e272 = (u64)(u32)(((u32 (*)(u32))t__2e271)((u32)((u64)0UL)));
+	t__2e273 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_foo)))((u32)((u64)0UL)));
+	t__2e270 = (u64)(u32)(((u32)t__2e272 == (u32)t__2e273));
+	if ((u32)t__2e270) goto L_passed_2e269; else goto L_failed_2e268;
+	L_failed_2e268:;
+	BLIT((u64)B3, ((u64)((char *)&D_strliteral_2e275)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)49UL), (u64)((u64)15UL), (u64)B3);
+	__builtin_trap();
+	L_passed_2e269:;
+	t__2e279 = (u64)(*(u64 *)t_binding_2e266);
+	t__2e280 = (u64)(*(u64 *)t__2e279);
+	t__2e281 = (u64)(u32)(((u32 (*)(u32))t__2e280)((u32)((u64)0UL)));
+	t__2e282 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_foo)))((u32)((u64)0UL)));
+	t__2e278 = (u64)(u32)(((u32)t__2e281 == (u32)t__2e282));
+	if ((u32)t__2e278) goto L_passed_2e277; else goto L_failed_2e276;
+	L_failed_2e276:;
+	BLIT((u64)B4, ((u64)((char *)&D_strliteral_2e284)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)50UL), (u64)((u64)15UL), (u64)B4);
+	__builtin_trap();
+	L_passed_2e277:;
+	t__2e288 = (u64)(*(u64 *)t_binding_2e267);
+	t__2e289 = (u64)(*(u64 *)t__2e288);
+	t__2e290 = (u64)(*(u64 *)t__2e289);
+	t__2e291 = (u64)(u32)(((u32 (*)(u32))t__2e290)((u32)((u64)0UL)));
+	t__2e292 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_foo)))((u32)((u64)0UL)));
+	t__2e287 = (u64)(u32)(((u32)t__2e291 == (u32)t__2e292));
+	if ((u32)t__2e287) goto L_passed_2e286; else goto L_failed_2e285;
+	L_failed_2e285:;
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e294)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)51UL), (u64)((u64)15UL), (u64)B5);
+	__builtin_trap();
+	L_passed_2e286:;
+	goto L__2e263;
+	L__2e295:;
+	L__2e263:;
+	return;
+}
+static u32 F_foo(u32 p_n) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e299;
+	u64 t__2e300;
+	u64 t__2e301;
+	u64 t_n;
+	u64 t_param_2e297;
+	t_n = (u64)p_n;
+	L_start_2e296:;
+	t_param_2e297 = (u64)A0;
+	*(u32 *)t_param_2e297 = (u32)t_n;
+	L_body_2e298:;
+	t__2e301 = (u64)(u32)(*(i32 *)t_param_2e297);
+	t__2e300 = (u64)(u32)((u32)t__2e301 + (u32)((u64)1UL));
+	t__2e299 = (u64)(u32)((u32)t__2e300 << (((u64)1UL) & 31));
+	return (u32)t__2e299;
+}
+static void F_alias__array(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char B16[24] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	u64 t__2e314;
+	u64 t__2e315;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e318;
+	u64 t__2e323;
+	u64 t__2e326;
+	u64 t__2e327;
+	u64 t__2e328;
+	u64 t__2e329;
+	u64 t__2e330;
+	u64 t__2e336;
+	u64 t__2e337;
+	u64 t__2e338;
+	u64 t__2e339;
+	u64 t__2e340;
+	u64 t__2e341;
+	u64 t__2e346;
+	u64 t__2e347;
+	u64 t__2e348;
+	u64 t__2e349;
+	u64 t__2e352;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e355;
+	u64 t__2e358;
+	u64 t__2e359;
+	u64 t__2e360;
+	u64 t__2e361;
+	u64 t__2e362;
+	u64 t__2e363;
+	u64 t__2e366;
+	u64 t__2e371;
+	u64 t__2e372;
+	u64 t__2e373;
+	u64 t__2e374;
+	u64 t__2e375;
+	u64 t__2e378;
+	u64 t__2e379;
+	u64 t__2e380;
+	u64 t__2e381;
+	u64 t__2e382;
+	u64 t__2e385;
+	u64 t__2e386;
+	u64 t__2e387;
+	u64 t__2e388;
+	u64 t__2e389;
+	u64 t__2e390;
+	u64 t__2e391;
+	u64 t__2e394;
+	u64 t__2e399;
+	u64 t__2e400;
+	u64 t__2e401;
+	u64 t__2e402;
+	u64 t__2e403;
+	u64 t__2e404;
+	u64 t__2e407;
+	u64 t__2e408;
+	u64 t__2e409;
+	u64 t__2e410;
+	u64 t__2e411;
+	u64 t__2e412;
+	u64 t__2e415;
+	u64 t__2e416;
+	u64 t__2e417;
+	u64 t__2e418;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e421;
+	u64 t__2e422;
+	u64 t__2e423;
+	u64 t__2e426;
+	u64 t__2e431;
+	u64 t__2e432;
+	u64 t__2e433;
+	u64 t__2e434;
+	u64 t__2e435;
+	u64 t__2e436;
+	u64 t__2e437;
+	u64 t__2e438;
+	u64 t__2e441;
+	u64 t__2e444;
+	u64 t__2e445;
+	u64 t__2e446;
+	u64 t__2e447;
+	u64 t__2e448;
+	u64 t__2e449;
+	u64 t__2e450;
+	u64 t__2e451;
+	u64 t__2e454;
+	u64 t_abortsite_2e334;
+	u64 t_binding_2e306;
+	u64 t_binding_2e308;
+	u64 t_binding_2e309;
+	u64 t_binding_2e310;
+	u64 t_binding_2e311;
+	u64 t_data_2e322;
+	u64 t_item_2e307;
+	u64 t_object_2e312;
+	L_start_2e302:;
+	t_binding_2e306 = (u64)A0;
+	t_binding_2e308 = (u64)A1;
+	t_binding_2e309 = (u64)A2;
+	t_binding_2e310 = (u64)A3;
+	t_binding_2e311 = (u64)A4;
+	t_object_2e312 = (u64)A5;
+	L_body_2e303:;
+	t_item_2e307 = (u64)((u64)t_binding_2e306 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e307 = (u32)((u64)1UL);
+	t_item_2e307 = (u64)((u64)t_binding_2e306 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e307 = (u32)((u64)2UL);
+	t_item_2e307 = (u64)((u64)t_binding_2e306 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e307 = (u32)((u64)3UL);
+	*(u32 *)t_binding_2e308 = (u32)((u64)0UL);
+	*(u64 *)t_binding_2e309 = (u64)t_binding_2e306;
+	*(u64 *)t_binding_2e310 = (u64)t_binding_2e309;
+	t__2e314 = (u64)(*(u64 *)t_binding_2e310);
+	t__2e315 = (u64)(*(u64 *)t__2e314);
+	t__2e316 = t__2e315;
+	t__2e317 = (u64)((u64)((u64)3UL) - (u64)((u64)0UL));
+	t__2e317 = ((u64)3UL);
+	t__2e318 = ((u64)3UL);
+	t_data_2e322 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e322 = (u64)((u64)t__2e316 + (u64)t_data_2e322);
+	*(u64 *)t_object_2e312 = (u64)t_data_2e322;
+	t__2e323 = (u64)((u64)t_object_2e312 + (u64)((u64)8UL));
+	*(u64 *)t__2e323 = (u64)t__2e317;
+	t__2e323 = (u64)((u64)t_object_2e312 + (u64)((u64)16UL));
+	*(u64 *)t__2e323 = (u64)t__2e318;
+	BLIT(t_binding_2e311, t_object_2e312, ((u64)24UL));
+	t__2e328 = (u64)(u32)(*(i32 *)t_binding_2e308);
+	t__2e329 = (u64)((i64)(i32)t__2e328);
+	t__2e327 = (u64)((u64)t__2e329 * (u64)((u64)4UL));
+	t__2e327 = (u64)((u64)t_binding_2e306 + (u64)t__2e327);
+	t__2e330 = (u64)(u32)(((u64)t__2e329 < (u64)((u64)3UL)));
+	if ((u32)t__2e330) goto L__2e332; else goto L__2e331;
+	L__2e331:;
+	t_abortsite_2e334 = ((u64)0UL);
+	goto L_abort_2e335;
+	L__2e332:;
+	t__2e341 = (u64)(u32)(*(i32 *)t__2e327);
+	t__2e326 = (u64)(u32)(((u32)t__2e341 == (u32)((u64)1UL)));
+	if ((u32)t__2e326) goto L_passed_2e325; else goto L_failed_2e324;
+	L_failed_2e324:;
+	BLIT((u64)B6, ((u64)((char *)&D_strliteral_2e343)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)24UL), (u64)((u64)15UL), (u64)B6);
+	__builtin_trap();
+	L_passed_2e325:;
+	t__2e348 = (u64)((i64)(i32)((u64)1UL));
+	t__2e347 = (u64)((u64)t__2e348 * (u64)((u64)4UL));
+	t__2e347 = (u64)((u64)t_binding_2e306 + (u64)t__2e347);
+	t__2e349 = (u64)(u32)(*(i32 *)t__2e347);
+	t__2e346 = (u64)(u32)(((u32)t__2e349 == (u32)((u64)2UL)));
+	if ((u32)t__2e346) goto L_passed_2e345; else goto L_failed_2e344;
+	L_failed_2e344:;
+	BLIT((u64)B7, ((u64)((char *)&D_strliteral_2e343)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)25UL), (u64)((u64)15UL), (u64)B7);
+	__builtin_trap();
+	L_passed_2e345:;
+	t__2e354 = (u64)((i64)(i32)((u64)2UL));
+	t__2e353 = (u64)((u64)t__2e354 * (u64)((u64)4UL));
+	t__2e353 = (u64)((u64)t_binding_2e306 + (u64)t__2e353);
+	t__2e355 = (u64)(u32)(*(i32 *)t__2e353);
+	t__2e352 = (u64)(u32)(((u32)t__2e355 == (u32)((u64)3UL)));
+	if ((u32)t__2e352) goto L_passed_2e351; else goto L_failed_2e350;
+	L_failed_2e350:;
+	BLIT((u64)B8, ((u64)((char *)&D_strliteral_2e343)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)26UL), (u64)((u64)15UL), (u64)B8);
+	__builtin_trap();
+	L_passed_2e351:;
+	t__2e359 = (u64)(*(u64 *)t_binding_2e309);
+	t__2e361 = (u64)(u32)(*(i32 *)t_binding_2e308);
+	t__2e362 = (u64)((i64)(i32)t__2e361);
+	t__2e360 = (u64)((u64)t__2e362 * (u64)((u64)4UL));
+	t__2e360 = (u64)((u64)t__2e359 + (u64)t__2e360);
+	t__2e363 = (u64)(u32)(((u64)t__2e362 < (u64)((u64)3UL)));
+	if ((u32)t__2e363) goto L__2e365; else goto L__2e364;
+	L__2e364:;
+	t_abortsite_2e334 = ((u64)1UL);
+	goto L_abort_2e335;
+	L__2e365:;
+	t__2e366 = (u64)(u32)(*(i32 *)t__2e360);
+	t__2e358 = (u64)(u32)(((u32)t__2e366 == (u32)((u64)1UL)));
+	if ((u32)t__2e358) goto L_passed_2e357; else goto L_failed_2e356;
+	L_failed_2e356:;
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e368)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)27UL), (u64)((u64)15UL), (u64)B9);
+	__builtin_trap();
+	L_passed_2e357:;
+	t__2e372 = (u64)(*(u64 *)t_binding_2e309);
+	t__2e374 = (u64)((i64)(i32)((u64)1UL));
+	t__2e373 = (u64)((u64)t__2e374 * (u64)((u64)4UL));
+	t__2e373 = (u64)((u64)t__2e372 + (u64)t__2e373);
+	t__2e375 = (u64)(u32)(*(i32 *)t__2e373);
+	t__2e371 = (u64)(u32)(((u32)t__2e375 == (u32)((u64)2UL)));
+	if ((u32)t__2e371) goto L_passed_2e370; else goto L_failed_2e369;
+	L_failed_2e369:;
+	BLIT((u64)B10, ((u64)((char *)&D_strliteral_2e368)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)28UL), (u64)((u64)15UL), (u64)B10);
+	__builtin_trap();
+	L_passed_2e370:;
+	t__2e379 = (u64)(*(u64 *)t_binding_2e309);
+	t__2e381 = (u64)((i64)(i32)((u64)2UL));
+	t__2e380 = (u64)((u64)t__2e381 * (u64)((u64)4UL));
+	t__2e380 = (u64)((u64)t__2e379 + (u64)t__2e380);
+	t__2e382 = (u64)(u32)(*(i32 *)t__2e380);
+	t__2e378 = (u64)(u32)(((u32)t__2e382 == (u32)((u64)3UL)));
+	if ((u32)t__2e378) goto L_passed_2e377; else goto L_failed_2e376;
+	L_failed_2e376:;
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e368)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)29UL), (u64)((u64)15UL), (u64)B11);
+	__builtin_trap();
+	L_passed_2e377:;
+	t__2e386 = (u64)(*(u64 *)t_binding_2e310);
+	t__2e387 = (u64)(*(u64 *)t__2e386);
+	t__2e389 = (u64)(u32)(*(i32 *)t_binding_2e308);
+	t__2e390 = (u64)((i64)(i32)t__2e389);
+	t__2e388 = (u64)((u64)t__2e390 * (u64)((u64)4UL));
+	t__2e388 = (u64)((u64)t__2e387 + (u64)t__2e388);
+	t__2e391 = (u64)(u32)(((u64)t__2e390 < (u64)((u64)3UL)));
+	if ((u32)t__2e391) goto L__2e393; else goto L__2e392;
+	L__2e392:;
+	t_abortsite_2e334 = ((u64)2UL);
+	goto L_abort_2e335;
+	L__2e393:;
+	t__2e394 = (u64)(u32)(*(i32 *)t__2e388);
+	t__2e385 = (u64)(u32)(((u32)t__2e394 == (u32)((u64)1UL)));
+	if ((u32)t__2e385) goto L_passed_2e384; else goto L_failed_2e383;
+	L_failed_2e383:;
+	BLIT((u64)B12, ((u64)((char *)&D_strliteral_2e396)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)30UL), (u64)((u64)15UL), (u64)B12);
+	__builtin_trap();
+	L_passed_2e384:;
+	t__2e400 = (u64)(*(u64 *)t_binding_2e310);
+	t__2e401 = (u64)(*(u64 *)t__2e400);
+	t__2e403 = (u64)((i64)(i32)((u64)1UL));
+	t__2e402 = (u64)((u64)t__2e403 * (u64)((u64)4UL));
+	t__2e402 = (u64)((u64)t__2e401 + (u64)t__2e402);
+	t__2e404 = (u64)(u32)(*(i32 *)t__2e402);
+	t__2e399 = (u64)(u32)(((u32)t__2e404 == (u32)((u64)2UL)));
+	if ((u32)t__2e399) goto L_passed_2e398; else goto L_failed_2e397;
+	L_failed_2e397:;
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e396)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)31UL), (u64)((u64)15UL), (u64)B13);
+	__builtin_trap();
+	L_passed_2e398:;
+	t__2e408 = (u64)(*(u64 *)t_binding_2e310);
+	t__2e409 = (u64)(*(u64 *)t__2e408);
+	t__2e411 = (u64)((i64)(i32)((u64)2UL));
+	t__2e410 = (u64)((u64)t__2e411 * (u64)((u64)4UL));
+	t__2e410 = (u64)((u64)t__2e409 + (u64)t__2e410);
+	t__2e412 = (u64)(u32)(*(i32 *)t__2e410);
+	t__2e407 = (u64)(u32)(((u32)t__2e412 == (u32)((u64)3UL)));
+	if ((u32)t__2e407) goto L_passed_2e406; else goto L_failed_2e405;
+	L_failed_2e405:;
+	BLIT((u64)B14, ((u64)((char *)&D_strliteral_2e396)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)32UL), (u64)((u64)15UL), (u64)B14);
+	__builtin_trap();
+	L_passed_2e406:;
+	t__2e417 = (u64)((u64)t_binding_2e311 + (u64)((u64)8UL));
+	t__2e418 = (u64)((u64)t_binding_2e311 + (u64)((u64)16UL));
+	t__2e419 = (u64)(*(u64 *)t_binding_2e311);
+	t__2e420 = (u64)(*(u64 *)t__2e417);
+	t__2e421 = (u64)(u32)(*(i32 *)t_binding_2e308);
+	t__2e422 = (u64)((i64)(i32)t__2e421);
+	t__2e416 = (u64)((u64)t__2e422 * (u64)((u64)4UL));
+	t__2e416 = (u64)((u64)t__2e419 + (u64)t__2e416);
+	t__2e423 = (u64)(u32)(((u64)t__2e422 < (u64)t__2e420));
+	if ((u32)t__2e423) goto L__2e425; else goto L__2e424;
+	L__2e424:;
+	t_abortsite_2e334 = ((u64)3UL);
+	goto L_abort_2e335;
+	L__2e425:;
+	t__2e426 = (u64)(u32)(*(i32 *)t__2e416);
+	t__2e415 = (u64)(u32)(((u32)t__2e426 == (u32)((u64)1UL)));
+	if ((u32)t__2e415) goto L_passed_2e414; else goto L_failed_2e413;
+	L_failed_2e413:;
+	BLIT((u64)B15, ((u64)((char *)&D_strliteral_2e428)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)33UL), (u64)((u64)15UL), (u64)B15);
+	__builtin_trap();
+	L_passed_2e414:;
+	t__2e433 = (u64)((u64)t_binding_2e311 + (u64)((u64)8UL));
+	t__2e434 = (u64)((u64)t_binding_2e311 + (u64)((u64)16UL));
+	t__2e435 = (u64)(*(u64 *)t_binding_2e311);
+	t__2e436 = (u64)(*(u64 *)t__2e433);
+	t__2e437 = (u64)((i64)(i32)((u64)1UL));
+	t__2e432 = (u64)((u64)t__2e437 * (u64)((u64)4UL));
+	t__2e432 = (u64)((u64)t__2e435 + (u64)t__2e432);
+	t__2e438 = (u64)(u32)(((u64)t__2e437 < (u64)t__2e436));
+	if ((u32)t__2e438) goto L__2e440; else goto L__2e439;
+	L__2e439:;
+	t_abortsite_2e334 = ((u64)4UL);
+	goto L_abort_2e335;
+	L__2e440:;
+	t__2e441 = (u64)(u32)(*(i32 *)t__2e432);
+	t__2e431 = (u64)(u32)(((u32)t__2e441 == (u32)((u64)2UL)));
+	if ((u32)t__2e431) goto L_passed_2e430; else goto L_failed_2e429;
+	L_failed_2e429:;
+	BLIT((u64)B16, ((u64)((char *)&D_strliteral_2e428)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)34UL), (u64)((u64)15UL), (u64)B16);
+	__builtin_trap();
+	L_passed_2e430:;
+	t__2e446 = (u64)((u64)t_binding_2e311 + (u64)((u64)8UL));
+	t__2e447 = (u64)((u64)t_binding_2e311 + (u64)((u64)16UL));
+	t__2e448 = (u64)(*(u64 *)t_binding_2e311);
+	t__2e449 = (u64)(*(u64 *)t__2e446);
+	t__2e450 = (u64)((i64)(i32)((u64)2UL));
+	t__2e445 = (u64)((u64)t__2e450 * (u64)((u64)4UL));
+	t__2e445 = (u64)((u64)t__2e448 + (u64)t__2e445);
+	t__2e451 = (u64)(u32)(((u64)t__2e450 < (u64)t__2e449));
+	if ((u32)t__2e451) goto L__2e453; else goto L__2e452;
+	L__2e452:;
+	t_abortsite_2e334 = ((u64)5UL);
+	goto L_abort_2e335;
+	L__2e453:;
+	t__2e454 = (u64)(u32)(*(i32 *)t__2e445);
+	t__2e444 = (u64)(u32)(((u32)t__2e454 == (u32)((u64)3UL)));
+	if ((u32)t__2e444) goto L_passed_2e443; else goto L_failed_2e442;
+	L_failed_2e442:;
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e428)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)35UL), (u64)((u64)15UL), (u64)B17);
+	__builtin_trap();
+	L_passed_2e443:;
+	goto L__2e304;
+	L__2e455:;
+	L__2e304:;
+	return;
+	L_abort_2e335:;
+	t__2e336 = (u64)((u64)t_abortsite_2e334 * (u64)((u64)16UL));
+	t__2e336 = (u64)((u64)((u64)((char *)&D_abortsites_2e333)) + (u64)t__2e336);
+	t__2e337 = (u64)(*(u64 *)t__2e336);
+	t__2e338 = (u64)((u64)t__2e336 + (u64)((u64)8UL));
+	t__2e339 = (u64)(*(u32 *)t__2e338);
+	t__2e338 = (u64)((u64)t__2e336 + (u64)((u64)12UL));
+	t__2e340 = (u64)(*(u32 *)t__2e338);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e337, (u64)t__2e339, (u64)t__2e340, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_alias__builtin(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char B1[24] __attribute__((aligned(16)));
+	u64 t__2e463;
+	u64 t__2e464;
+	u64 t_binding_2e460;
+	L_start_2e456:;
+	t_binding_2e460 = (u64)A0;
+	L_body_2e457:;
+	*(u32 *)t_binding_2e460 = (u32)((u64)1234UL);
+	t__2e464 = (u64)(u32)(*(i32 *)t_binding_2e460);
+	t__2e463 = (u64)(u32)(((u32)t__2e464 == (u32)((u64)1234UL)));
+	if ((u32)t__2e463) goto L_passed_2e462; else goto L_failed_2e461;
+	L_failed_2e461:;
+	BLIT((u64)B1, ((u64)((char *)&D_strliteral_2e466)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)5UL), (u64)((u64)15UL), (u64)B1);
+	__builtin_trap();
+	L_passed_2e462:;
+	goto L__2e458;
+	L__2e467:;
+	L__2e458:;
+	return;
+}
@@ -0,0 +1,5081 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort[] __asm__("rt.abort");
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+extern char X_rt_2ememmove[] __asm__("rt.memmove");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e31 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_strdata_2e113 { u8 f0[43]; };
+struct __attribute__((packed)) S_strliteral_2e114 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e149 { u8 f0[47]; };
+struct __attribute__((packed)) S_strliteral_2e150 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e169 { u8 f0[33]; };
+struct __attribute__((packed)) S_strliteral_2e170 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e189 { u8 f0[52]; };
+struct __attribute__((packed)) S_strliteral_2e190 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e209 { u8 f0[34]; };
+struct __attribute__((packed)) S_strliteral_2e210 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e130 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; };
+struct __attribute__((packed)) S_abortsites_2e247 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; };
+struct __attribute__((packed)) S_strdata_2e395 { u8 f0[32]; };
+struct __attribute__((packed)) S_strliteral_2e396 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e431 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e918 { u8 f0[27]; u8 f1; u8 f2[4]; u8 f3; u8 f4[13]; };
+struct __attribute__((packed)) S_strliteral_2e919 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e950 { u8 f0[40]; u8 f1; u8 f2[2]; u8 f3; u8 f4[7]; };
+struct __attribute__((packed)) S_strliteral_2e951 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e970 { u8 f0[49]; };
+struct __attribute__((packed)) S_strliteral_2e971 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e990 { u8 f0[48]; };
+struct __attribute__((packed)) S_strliteral_2e991 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e474 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; char *f81; u32 f82; u32 f83; char *f84; u32 f85; u32 f86; char *f87; u32 f88; u32 f89; char *f90; u32 f91; u32 f92; char *f93; u32 f94; u32 f95; char *f96; u32 f97; u32 f98; char *f99; u32 f100; u32 f101; char *f102; u32 f103; u32 f104; char *f105; u32 f106; u32 f107; char *f108; u32 f109; u32 f110; char *f111; u32 f112; u32 f113; char *f114; u32 f115; u32 f116; };
+struct __attribute__((packed)) S_abortsites_2e1024 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_strdata_2e1560 { u8 f0[60]; };
+struct __attribute__((packed)) S_strliteral_2e1561 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1592 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e1593 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1612 { u8 f0[70]; };
+struct __attribute__((packed)) S_strliteral_2e1613 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1090 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; char *f81; u32 f82; u32 f83; char *f84; u32 f85; u32 f86; char *f87; u32 f88; u32 f89; char *f90; u32 f91; u32 f92; char *f93; u32 f94; u32 f95; char *f96; u32 f97; u32 f98; char *f99; u32 f100; u32 f101; char *f102; u32 f103; u32 f104; char *f105; u32 f106; u32 f107; char *f108; u32 f109; u32 f110; char *f111; u32 f112; u32 f113; char *f114; u32 f115; u32 f116; char *f117; u32 f118; u32 f119; char *f120; u32 f121; u32 f122; char *f123; u32 f124; u32 f125; char *f126; u32 f127; u32 f128; char *f129; u32 f130; u32 f131; char *f132; u32 f133; u32 f134; char *f135; u32 f136; u32 f137; };
+struct __attribute__((packed)) S_abortsites_2e1652 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e1708 { u8 f0[47]; u8 f1; u8 f2[5]; u8 f3; u8 f4[5]; };
+struct __attribute__((packed)) S_strliteral_2e1709 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1740 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e1741 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1760 { u8 f0[76]; };
+struct __attribute__((packed)) S_strliteral_2e1761 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1696 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; };
+struct __attribute__((packed)) S_strdata_2e1838 { u8 f0[61]; };
+struct __attribute__((packed)) S_strliteral_2e1839 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1790 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; };
+struct __attribute__((packed)) S_abortsites_2e1885 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e1960 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e31 D_abortsites_2e31 __asm__("abortsites.31") __attribute__((used, section(".data.rel.ro.abortsites.31"), aligned(8)));
+static const struct S_strdata_2e113 D_strdata_2e113 __asm__("strdata.113") __attribute__((used, section(".rodata.strdata.113"), aligned(8)));
+static struct S_strliteral_2e114 D_strliteral_2e114 __asm__("strliteral.114") __attribute__((used, section(".data.rel.ro.strliteral.114"), aligned(8)));
+static const struct S_strdata_2e149 D_strdata_2e149 __asm__("strdata.149") __attribute__((used, section(".rodata.strdata.149"), aligned(8)));
+static struct S_strliteral_2e150 D_strliteral_2e150 __asm__("strliteral.150") __attribute__((used, section(".data.rel.ro.strliteral.150"), aligned(8)));
+static const struct S_strdata_2e169 D_strdata_2e169 __asm__("strdata.169") __attribute__((used, section(".rodata.strdata.169"), aligned(8)));
+static struct S_strliteral_2e170 D_strliteral_2e170 __asm__("strliteral.170") __attribute__((used, section(".data.rel.ro.strliteral.170"), aligned(8)));
+static const struct S_strdata_2e189 D_strdata_2e189 __asm__("strdata.189") __attribute__((used, section(".rodata.strdata.189"), aligned(8)));
+static struct S_strliteral_2e190 D_strliteral_2e190 __asm__("strliteral.190") __attribute__((used, section(".data.rel.ro.strliteral.190"), aligned(8)));
+static const struct S_strdata_2e209 D_strdata_2e209 __asm__("strdata.209") __attribute__((used, section(".rodata.strdata.209"), aligned(8)));
+static struct S_strliteral_2e210 D_strliteral_2e210 __asm__("strliteral.210") __attribute__((used, section(".data.rel.ro.strliteral.210"), aligned(8)));
+static struct S_abortsites_2e130 D_abortsites_2e130 __asm__("abortsites.130") __attribute__((used, section(".data.rel.ro.abortsites.130"), aligned(8)));
+static struct S_abortsites_2e247 D_abortsites_2e247 __asm__("abortsites.247") __attribute__((used, section(".data.rel.ro.abortsites.247"), aligned(8)));
+static const struct S_strdata_2e395 D_strdata_2e395 __asm__("strdata.395") __attribute__((used, section(".rodata.strdata.395"), aligned(8)));
+static struct S_strliteral_2e396 D_strliteral_2e396 __asm__("strliteral.396") __attribute__((used, section(".data.rel.ro.strliteral.396"), aligned(8)));
+static struct S_abortsites_2e431 D_abortsites_2e431 __asm__("abortsites.431") __attribute__((used, section(".data.rel.ro.abortsites.431"), aligned(8)));
+static const struct S_strdata_2e918 D_strdata_2e918 __asm__("strdata.918") __attribute__((used, section(".rodata.strdata.918"), aligned(8)));
+static struct S_strliteral_2e919 D_strliteral_2e919 __asm__("strliteral.919") __attribute__((used, section(".data.rel.ro.strliteral.919"), aligned(8)));
+static const struct S_strdata_2e950 D_strdata_2e950 __asm__("strdata.950") __attribute__((used, section(".rodata.strdata.950"), aligned(8)));
+static struct S_strliteral_2e951 D_strliteral_2e951 __asm__("strliteral.951") __attribute__((used, section(".data.rel.ro.strliteral.951"), aligned(8)));
+static const struct S_strdata_2e970 D_strdata_2e970 __asm__("strdata.970") __attribute__((used, section(".rodata.strdata.970"), aligned(8)));
+static struct S_strliteral_2e971 D_strliteral_2e971 __asm__("strliteral.971") __attribute__((used, section(".data.rel.ro.strliteral.971"), aligned(8)));
+static const struct S_strdata_2e990 D_strdata_2e990 __asm__("strdata.990") __attribute__((used, section(".rodata.strdata.990"), aligned(8)));
+static struct S_strliteral_2e991 D_strliteral_2e991 __asm__("strliteral.991") __attribute__((used, section(".data.rel.ro.strliteral.991"), aligned(8)));
+static struct S_abortsites_2e474 D_abortsites_2e474 __asm__("abortsites.474") __attribute__((used, section(".data.rel.ro.abortsites.474"), aligned(8)));
+static struct S_abortsites_2e1024 D_abortsites_2e1024 __asm__("abortsites.1024") __attribute__((used, section(".data.rel.ro.abortsites.1024"), aligned(8)));
+static const struct S_strdata_2e1560 D_strdata_2e1560 __asm__("strdata.1560") __attribute__((used, section(".rodata.strdata.1560"), aligned(8)));
+static struct S_strliteral_2e1561 D_strliteral_2e1561 __asm__("strliteral.1561") __attribute__((used, section(".data.rel.ro.strliteral.1561"), aligned(8)));
+static const struct S_strdata_2e1592 D_strdata_2e1592 __asm__("strdata.1592") __attribute__((used, section(".rodata.strdata.1592"), aligned(8)));
+static struct S_strliteral_2e1593 D_strliteral_2e1593 __asm__("strliteral.1593") __attribute__((used, section(".data.rel.ro.strliteral.1593"), aligned(8)));
+static const struct S_strdata_2e1612 D_strdata_2e1612 __asm__("strdata.1612") __attribute__((used, section(".rodata.strdata.1612"), aligned(8)));
+static struct S_strliteral_2e1613 D_strliteral_2e1613 __asm__("strliteral.1613") __attribute__((used, section(".data.rel.ro.strliteral.1613"), aligned(8)));
+static struct S_abortsites_2e1090 D_abortsites_2e1090 __asm__("abortsites.1090") __attribute__((used, section(".data.rel.ro.abortsites.1090"), aligned(8)));
+static struct S_abortsites_2e1652 D_abortsites_2e1652 __asm__("abortsites.1652") __attribute__((used, section(".data.rel.ro.abortsites.1652"), aligned(8)));
+static const struct S_strdata_2e1708 D_strdata_2e1708 __asm__("strdata.1708") __attribute__((used, section(".rodata.strdata.1708"), aligned(8)));
+static struct S_strliteral_2e1709 D_strliteral_2e1709 __asm__("strliteral.1709") __attribute__((used, section(".data.rel.ro.strliteral.1709"), aligned(8)));
+static const struct S_strdata_2e1740 D_strdata_2e1740 __asm__("strdata.1740") __attribute__((used, section(".rodata.strdata.1740"), aligned(8)));
+static struct S_strliteral_2e1741 D_strliteral_2e1741 __asm__("strliteral.1741") __attribute__((used, section(".data.rel.ro.strliteral.1741"), aligned(8)));
+static const struct S_strdata_2e1760 D_strdata_2e1760 __asm__("strdata.1760") __attribute__((used, section(".rodata.strdata.1760"), aligned(8)));
+static struct S_strliteral_2e1761 D_strliteral_2e1761 __asm__("strliteral.1761") __attribute__((used, section(".data.rel.ro.strliteral.1761"), aligned(8)));
+static struct S_abortsites_2e1696 D_abortsites_2e1696 __asm__("abortsites.1696") __attribute__((used, section(".data.rel.ro.abortsites.1696"), aligned(8)));
+static const struct S_strdata_2e1838 D_strdata_2e1838 __asm__("strdata.1838") __attribute__((used, section(".rodata.strdata.1838"), aligned(8)));
+static struct S_strliteral_2e1839 D_strliteral_2e1839 __asm__("strliteral.1839") __attribute__((used, section(".data.rel.ro.strliteral.1839"), aligned(8)));
+static struct S_abortsites_2e1790 D_abortsites_2e1790 __asm__("abortsites.1790") __attribute__((used, section(".data.rel.ro.abortsites.1790"), aligned(8)));
+static struct S_abortsites_2e1885 D_abortsites_2e1885 __asm__("abortsites.1885") __attribute__((used, section(".data.rel.ro.abortsites.1885"), aligned(8)));
+static struct S_abortsites_2e1960 D_abortsites_2e1960 __asm__("abortsites.1960") __attribute__((used, section(".data.rel.ro.abortsites.1960"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_cap__borrowed(void) __asm__("cap_borrowed") __attribute__((used, section(".text.cap_borrowed")));
+static u64 F_lencap(u64 __rp, u64 p_s) __asm__("lencap") __attribute__((used, section(".text.lencap")));
+static void F_misc__reject(void) __asm__("misc_reject") __attribute__((used, section(".text.misc_reject")));
+static void F_expandable(void) __asm__("expandable") __attribute__((used, section(".text.expandable")));
+static void F_recursive__structure(void) __asm__("recursive_structure") __attribute__((used, section(".text.recursive_structure")));
+static u64 F_sum__tree(u64 p_t) __asm__("sum_tree") __attribute__((used, section(".text.sum_tree")));
+static void F_slicing(void) __asm__("slicing") __attribute__((used, section(".text.slicing")));
+static u64 F_cap(u64 p_s) __asm__("cap") __attribute__((used, section(".text.cap")));
+static void F_assert__slice__eq(u64 p_actual, u64 p_expected) __asm__("assert_slice_eq") __attribute__((used, section(".text.assert_slice_eq")));
+static void F_assignment(void) __asm__("assignment") __attribute__((used, section(".text.assignment")));
+static void F_zero3(u64 p_s) __asm__("zero3") __attribute__((used, section(".text.zero3")));
+static void F_indexing(void) __asm__("indexing") __attribute__((used, section(".text.indexing")));
+static void F_measurements(void) __asm__("measurements") __attribute__((used, section(".text.measurements")));
+static void F_storage(void) __asm__("storage") __attribute__((used, section(".text.storage")));
+static void F_from__array(void) __asm__("from_array") __attribute__((used, section(".text.from_array")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\060\070\055\163\154\151\143\145\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 18U, 18U };
+static struct S_abortsites_2e31 D_abortsites_2e31 = { (char *)((char *)&D_strliteral_2e1) + 0, 266U, 42U, (char *)((char *)&D_strliteral_2e1) + 0, 267U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 268U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 272U, 43U, (char *)((char *)&D_strliteral_2e1) + 0, 273U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 274U, 15U };
+static const struct S_strdata_2e113 D_strdata_2e113 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\133\135\166\157\151\144\040\075\040\133\061\062\135\073\040\175\073" };
+static struct S_strliteral_2e114 D_strliteral_2e114 = { (char *)((char *)&D_strdata_2e113) + 0, 43U, 43U };
+static const struct S_strdata_2e149 D_strdata_2e149 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\133\166\157\151\144\135\072\040\133\135\157\160\141\161\165\145\073\040\175\073" };
+static struct S_strliteral_2e150 D_strliteral_2e150 = { (char *)((char *)&D_strdata_2e149) + 0, 47U, 47U };
+static const struct S_strdata_2e169 D_strdata_2e169 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\133\135\072\040\133\135\166\157\151\144\073\040\175\073" };
+static struct S_strliteral_2e170 D_strliteral_2e170 = { (char *)((char *)&D_strdata_2e169) + 0, 33U, 33U };
+static const struct S_strdata_2e189 D_strdata_2e189 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\050\133\135\166\157\151\144\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\175\073" };
+static struct S_strliteral_2e190 D_strliteral_2e190 = { (char *)((char *)&D_strdata_2e189) + 0, 52U, 52U };
+static const struct S_strdata_2e209 D_strdata_2e209 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\133\135\072\040\133\135\156\145\166\145\162\073\040\175\073" };
+static struct S_strliteral_2e210 D_strliteral_2e210 = { (char *)((char *)&D_strdata_2e209) + 0, 34U, 34U };
+static struct S_abortsites_2e130 D_abortsites_2e130 = { (char *)((char *)&D_strliteral_2e1) + 0, 243U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 243U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 246U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 246U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 249U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 249U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 252U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 252U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 255U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 255U, 11U };
+static struct S_abortsites_2e247 D_abortsites_2e247 = { (char *)((char *)&D_strliteral_2e1) + 0, 222U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 223U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 225U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 226U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 227U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 228U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 229U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 231U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 232U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 233U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 234U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 235U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 236U, 15U };
+static const struct S_strdata_2e395 D_strdata_2e395 = { "\162\145\143\165\162\163\151\166\145\040\163\164\162\165\143\164\165\162\145\040\165\163\151\156\147\040\163\154\151\143\145\163" };
+static struct S_strliteral_2e396 D_strliteral_2e396 = { (char *)((char *)&D_strdata_2e395) + 0, 32U, 32U };
+static struct S_abortsites_2e431 D_abortsites_2e431 = { (char *)((char *)&D_strliteral_2e1) + 0, 197U, 43U };
+static const struct S_strdata_2e918 D_strdata_2e918 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040", 34U, "\164\145\163\164", 34U, "\073\040\170\133\061\056\056\063\135\073\040\175\073" };
+static struct S_strliteral_2e919 D_strliteral_2e919 = { (char *)((char *)&D_strdata_2e918) + 0, 46U, 46U };
+static const struct S_strdata_2e950 D_strdata_2e950 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\133\061\054\040\062\054\040\063\135\073\040\170\133", 34U, "\150\151", 34U, "\056\056\135\073\040\175\073" };
+static struct S_strliteral_2e951 D_strliteral_2e951 = { (char *)((char *)&D_strdata_2e950) + 0, 51U, 51U };
+static const struct S_strdata_2e970 D_strdata_2e970 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\133\061\054\040\062\054\040\063\135\073\040\170\133\062\056\056\061\135\073\040\175\073" };
+static struct S_strliteral_2e971 D_strliteral_2e971 = { (char *)((char *)&D_strdata_2e970) + 0, 49U, 49U };
+static const struct S_strdata_2e990 D_strdata_2e990 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\133\061\054\040\062\054\040\063\135\073\040\170\133\056\056\064\135\073\040\175\073" };
+static struct S_strliteral_2e991 D_strliteral_2e991 = { (char *)((char *)&D_strdata_2e990) + 0, 48U, 48U };
+static struct S_abortsites_2e474 D_abortsites_2e474 = { (char *)((char *)&D_strliteral_2e1) + 0, 143U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 144U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 145U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 146U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 149U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 149U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 150U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 151U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 151U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 152U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 152U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 154U, 18U, (char *)((char *)&D_strliteral_2e1) + 0, 155U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 155U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 156U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 156U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 157U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 158U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 158U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 159U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 159U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 163U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 164U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 165U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 166U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 170U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 171U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 172U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 173U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 177U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 177U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 186U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 186U, 11U };
+static struct S_abortsites_2e1024 D_abortsites_2e1024 = { (char *)((char *)&D_strliteral_2e1) + 0, 132U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 23U };
+static const struct S_strdata_2e1560 D_strdata_2e1560 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\072\040\133\135\151\156\164\040\075\040\133\061\135\073\040\141\133\056\056\135\040\053\075\040\141\073\040\175\073" };
+static struct S_strliteral_2e1561 D_strliteral_2e1561 = { (char *)((char *)&D_strdata_2e1560) + 0, 60U, 60U };
+static const struct S_strdata_2e1592 D_strdata_2e1592 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\072\040\133\135\151\156\164\040\075\040\133\061\135\040\053\040\133\062\135\073\040\175\073" };
+static struct S_strliteral_2e1593 D_strliteral_2e1593 = { (char *)((char *)&D_strdata_2e1592) + 0, 44U, 44U };
+static const struct S_strdata_2e1612 D_strdata_2e1612 = { "\164\171\160\145\040\164\040\075\040\157\160\141\161\165\145\073\040\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\133\135\151\156\164\040\075\040\133\135\073\040\154\145\164\040\170\072\040\133\135\164\040\075\040\170\073\040\175\073" };
+static struct S_strliteral_2e1613 D_strliteral_2e1613 = { (char *)((char *)&D_strdata_2e1612) + 0, 70U, 70U };
+static struct S_abortsites_2e1090 D_abortsites_2e1090 = { (char *)((char *)&D_strliteral_2e1) + 0, 91U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 92U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 93U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 43U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 95U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 98U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 99U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 43U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 43U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 107U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 107U, 34U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 44U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 58U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 74U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 109U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 109U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 44U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 57U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 70U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 114U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 114U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 125U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 125U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 128U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 128U, 11U };
+static struct S_abortsites_2e1652 D_abortsites_2e1652 = { (char *)((char *)&D_strliteral_2e1) + 0, 83U, 26U };
+static const struct S_strdata_2e1708 D_strdata_2e1708 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\133\135\151\156\164\040\075\040\133\061\054\040\062\054\040\063\135\073\040\170\133", 34U, "\150\145\154\154\157", 34U, "\135\073\040\175\073" };
+static struct S_strliteral_2e1709 D_strliteral_2e1709 = { (char *)((char *)&D_strdata_2e1708) + 0, 59U, 59U };
+static const struct S_strdata_2e1740 D_strdata_2e1740 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\061\060\073\040\170\133\061\060\135\073\040\175\073" };
+static struct S_strliteral_2e1741 D_strliteral_2e1741 = { (char *)((char *)&D_strdata_2e1740) + 0, 40U, 40U };
+static const struct S_strdata_2e1760 D_strdata_2e1760 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\072\040\133\135\165\070\040\075\040\133\135\073\040\154\145\164\040\163\163\040\075\040\163\072\040\133\135\157\160\141\161\165\145\073\040\163\163\133\060\135\040\075\040\163\163\133\061\135\073\040\175\073" };
+static struct S_strliteral_2e1761 D_strliteral_2e1761 = { (char *)((char *)&D_strdata_2e1760) + 0, 76U, 76U };
+static struct S_abortsites_2e1696 D_abortsites_2e1696 = { (char *)((char *)&D_strliteral_2e1) + 0, 70U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 73U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 73U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 11U };
+static const struct S_strdata_2e1838 D_strdata_2e1838 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\133\135\073\040\163\164\141\164\151\143\040\141\163\163\145\162\164\050\154\145\156\050\170\051\040\075\075\040\060\051\073\040\175\073" };
+static struct S_strliteral_2e1839 D_strliteral_2e1839 = { (char *)((char *)&D_strdata_2e1838) + 0, 61U, 61U };
+static struct S_abortsites_2e1790 D_abortsites_2e1790 = { (char *)((char *)&D_strliteral_2e1) + 0, 56U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 18U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 65U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 65U, 11U };
+static struct S_abortsites_2e1885 D_abortsites_2e1885 = { (char *)((char *)&D_strliteral_2e1) + 0, 26U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 30U, 25U, (char *)((char *)&D_strliteral_2e1) + 0, 30U, 23U };
+static struct S_abortsites_2e1960 D_abortsites_2e1960 = { (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 17U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_from__array)))();
+	((void (*)(void))((u64)((char *)&F_storage)))();
+	((void (*)(void))((u64)((char *)&F_measurements)))();
+	((void (*)(void))((u64)((char *)&F_indexing)))();
+	((void (*)(void))((u64)((char *)&F_assignment)))();
+	((void (*)(void))((u64)((char *)&F_slicing)))();
+	((void (*)(void))((u64)((char *)&F_recursive__structure)))();
+	((void (*)(void))((u64)((char *)&F_expandable)))();
+	((void (*)(void))((u64)((char *)&F_misc__reject)))();
+	((void (*)(void))((u64)((char *)&F_cap__borrowed)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_cap__borrowed(void) {
+	char A0[168] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char R5[16] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char R7[16] __attribute__((aligned(16)));
+	u64 t__2e14;
+	u64 t__2e15;
+	u64 t__2e17;
+	u64 t__2e21;
+	u64 t__2e22;
+	u64 t__2e23;
+	u64 t__2e24;
+	u64 t__2e25;
+	u64 t__2e26;
+	u64 t__2e27;
+	u64 t__2e28;
+	u64 t__2e34;
+	u64 t__2e35;
+	u64 t__2e36;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e40;
+	u64 t__2e45;
+	u64 t__2e46;
+	u64 t__2e48;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e55;
+	u64 t__2e56;
+	u64 t__2e58;
+	u64 t__2e60;
+	u64 t__2e62;
+	u64 t__2e63;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e66;
+	u64 t__2e69;
+	u64 t__2e73;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e82;
+	u64 t__2e83;
+	u64 t_abortsite_2e32;
+	u64 t_binding_2e11;
+	u64 t_binding_2e41;
+	u64 t_binding_2e42;
+	u64 t_binding_2e57;
+	u64 t_binding_2e74;
+	u64 t_binding_2e75;
+	u64 t_data_2e39;
+	u64 t_data_2e72;
+	u64 t_item_2e13;
+	u64 t_item_2e16;
+	u64 t_object_2e19;
+	u64 t_object_2e59;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	t_object_2e19 = (u64)A1;
+	t_binding_2e57 = (u64)A2;
+	t_object_2e59 = (u64)A3;
+	L_body_2e8:;
+	t_item_2e13 = (u64)((u64)t_binding_2e11 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e13 = (u32)((u64)0UL);
+	t__2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e14, (u64)t_item_2e13, (u64)((u64)164UL));
+	t_item_2e16 = (u64)((u64)t_binding_2e11 + (u64)((u64)0UL));
+	t__2e15 = (u64)((u64)t_binding_2e11 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e15, (u64)t_item_2e16, (u64)((u64)164UL));
+	t__2e21 = t_binding_2e11;
+	t__2e22 = (u64)((i64)(i32)((u64)20UL));
+	t__2e23 = (u64)((i64)(i32)((u64)25UL));
+	t__2e24 = (u64)((u64)t__2e23 - (u64)t__2e22);
+	t__2e27 = (u64)(u32)(((u64)t__2e22 <= (u64)t__2e23));
+	t__2e26 = (u64)(u32)(((u64)t__2e23 <= (u64)((u64)42UL)));
+	t__2e28 = (u64)(u32)((u32)t__2e27 & (u32)t__2e26);
+	t__2e24 = (u64)((u64)t__2e23 - (u64)t__2e22);
+	t__2e25 = (u64)((u64)((u64)42UL) - (u64)t__2e22);
+	if ((u32)t__2e28) goto L__2e30; else goto L__2e29;
+	L__2e29:;
+	t_abortsite_2e32 = ((u64)0UL);
+	goto L_abort_2e33;
+	L__2e30:;
+	t_data_2e39 = (u64)((u64)t__2e22 * (u64)((u64)4UL));
+	t_data_2e39 = (u64)((u64)t__2e21 + (u64)t_data_2e39);
+	*(u64 *)t_object_2e19 = (u64)t_data_2e39;
+	t__2e40 = (u64)((u64)t_object_2e19 + (u64)((u64)8UL));
+	*(u64 *)t__2e40 = (u64)t__2e24;
+	t__2e40 = (u64)((u64)t_object_2e19 + (u64)((u64)16UL));
+	*(u64 *)t__2e40 = (u64)t__2e25;
+	BLIT((u64)B4, t_object_2e19, 24);
+	t__2e17 = ((u64 (*)(u64, u64))((u64)((char *)&F_lencap)))((u64)R5, (u64)B4);
+	t_binding_2e41 = (u64)((u64)t__2e17 + (u64)((u64)0UL));
+	t_binding_2e42 = (u64)((u64)t__2e17 + (u64)((u64)8UL));
+	t__2e46 = (u64)(*(u64 *)t_binding_2e41);
+	t__2e45 = (u64)(u32)(((u64)t__2e46 == (u64)((u64)5UL)));
+	if ((u32)t__2e45) goto L_passed_2e44; else goto L_failed_2e43;
+	L_failed_2e43:;
+	t_abortsite_2e32 = ((u64)1UL);
+	goto L_abort_2e47;
+	L_passed_2e44:;
+	t__2e56 = (u64)(*(u64 *)t_binding_2e42);
+	t__2e55 = (u64)(u32)(((u64)t__2e56 == (u64)((u64)22UL)));
+	if ((u32)t__2e55) goto L_passed_2e54; else goto L_failed_2e53;
+	L_failed_2e53:;
+	t_abortsite_2e32 = ((u64)2UL);
+	goto L_abort_2e47;
+	L_passed_2e54:;
+	*(u64 *)t_binding_2e57 = (u64)t_binding_2e11;
+	t__2e60 = (u64)(*(u64 *)t_binding_2e57);
+	t__2e62 = t__2e60;
+	t__2e63 = (u64)((i64)(i32)((u64)20UL));
+	t__2e64 = (u64)((i64)(i32)((u64)25UL));
+	t__2e65 = (u64)((u64)t__2e64 - (u64)t__2e63);
+	t__2e69 = (u64)(u32)(((u64)t__2e63 <= (u64)t__2e64));
+	t__2e65 = (u64)((u64)t__2e64 - (u64)t__2e63);
+	t__2e66 = t__2e65;
+	if ((u32)t__2e69) goto L__2e71; else goto L__2e70;
+	L__2e70:;
+	t_abortsite_2e32 = ((u64)3UL);
+	goto L_abort_2e33;
+	L__2e71:;
+	t_data_2e72 = (u64)((u64)t__2e63 * (u64)((u64)4UL));
+	t_data_2e72 = (u64)((u64)t__2e62 + (u64)t_data_2e72);
+	*(u64 *)t_object_2e59 = (u64)t_data_2e72;
+	t__2e73 = (u64)((u64)t_object_2e59 + (u64)((u64)8UL));
+	*(u64 *)t__2e73 = (u64)t__2e65;
+	t__2e73 = (u64)((u64)t_object_2e59 + (u64)((u64)16UL));
+	*(u64 *)t__2e73 = (u64)t__2e66;
+	BLIT((u64)B6, t_object_2e59, 24);
+	t__2e58 = ((u64 (*)(u64, u64))((u64)((char *)&F_lencap)))((u64)R7, (u64)B6);
+	t_binding_2e74 = (u64)((u64)t__2e58 + (u64)((u64)0UL));
+	t_binding_2e75 = (u64)((u64)t__2e58 + (u64)((u64)8UL));
+	t__2e79 = (u64)(*(u64 *)t_binding_2e74);
+	t__2e78 = (u64)(u32)(((u64)t__2e79 == (u64)((u64)5UL)));
+	if ((u32)t__2e78) goto L_passed_2e77; else goto L_failed_2e76;
+	L_failed_2e76:;
+	t_abortsite_2e32 = ((u64)4UL);
+	goto L_abort_2e47;
+	L_passed_2e77:;
+	t__2e83 = (u64)(*(u64 *)t_binding_2e75);
+	t__2e82 = (u64)(u32)(((u64)t__2e83 == (u64)((u64)5UL)));
+	if ((u32)t__2e82) goto L_passed_2e81; else goto L_failed_2e80;
+	L_failed_2e80:;
+	t_abortsite_2e32 = ((u64)5UL);
+	goto L_abort_2e47;
+	L_passed_2e81:;
+	goto L__2e9;
+	L__2e84:;
+	L__2e9:;
+	return;
+	L_abort_2e33:;
+	t__2e34 = (u64)((u64)t_abortsite_2e32 * (u64)((u64)16UL));
+	t__2e34 = (u64)((u64)((u64)((char *)&D_abortsites_2e31)) + (u64)t__2e34);
+	t__2e35 = (u64)(*(u64 *)t__2e34);
+	t__2e36 = (u64)((u64)t__2e34 + (u64)((u64)8UL));
+	t__2e37 = (u64)(*(u32 *)t__2e36);
+	t__2e36 = (u64)((u64)t__2e34 + (u64)((u64)12UL));
+	t__2e38 = (u64)(*(u32 *)t__2e36);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e35, (u64)t__2e37, (u64)t__2e38, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e47:;
+	t__2e48 = (u64)((u64)t_abortsite_2e32 * (u64)((u64)16UL));
+	t__2e48 = (u64)((u64)((u64)((char *)&D_abortsites_2e31)) + (u64)t__2e48);
+	t__2e49 = (u64)(*(u64 *)t__2e48);
+	t__2e50 = (u64)((u64)t__2e48 + (u64)((u64)8UL));
+	t__2e51 = (u64)(*(u32 *)t__2e50);
+	t__2e50 = (u64)((u64)t__2e48 + (u64)((u64)12UL));
+	t__2e52 = (u64)(*(u32 *)t__2e50);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e49, (u64)t__2e51, (u64)t__2e52, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u64 F_lencap(u64 __rp, u64 p_s) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[16] __attribute__((aligned(16)));
+	u64 t__2e92;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e98;
+	u64 t_binding_2e89;
+	u64 t_field_2e94;
+	u64 t_field_2e97;
+	u64 t_object_2e90;
+	u64 t_s;
+	u64 t_value_2e91;
+	t_s = p_s;
+	L_start_2e85:;
+	t_binding_2e89 = (u64)A0;
+	t_object_2e90 = (u64)A1;
+	L_body_2e86:;
+	*(u64 *)t_binding_2e89 = (u64)t_s;
+	t_value_2e91 = (u64)((u64)t_object_2e90 + (u64)((u64)0UL));
+	t__2e92 = (u64)(*(u64 *)t_binding_2e89);
+	t_field_2e94 = (u64)((u64)t__2e92 + (u64)((u64)8UL));
+	t__2e95 = (u64)(*(u64 *)t_field_2e94);
+	*(u64 *)t_value_2e91 = (u64)t__2e95;
+	t_value_2e91 = (u64)((u64)t_object_2e90 + (u64)((u64)8UL));
+	t__2e96 = (u64)(*(u64 *)t_binding_2e89);
+	t_field_2e97 = (u64)((u64)t__2e96 + (u64)((u64)16UL));
+	t__2e98 = (u64)(*(u64 *)t_field_2e97);
+	*(u64 *)t_value_2e91 = (u64)t__2e98;
+	BLIT(__rp, t_object_2e90, 16); return __rp;
+	L__2e99:;
+	L__2e87:;
+	L__2e100:;
+	return 0;
+}
+static void F_misc__reject(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char B10[8] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char R13[4] __attribute__((aligned(16)));
+	char B14[8] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char B16[24] __attribute__((aligned(16)));
+	char R17[4] __attribute__((aligned(16)));
+	char B18[8] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	char R21[4] __attribute__((aligned(16)));
+	char B22[8] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char R25[4] __attribute__((aligned(16)));
+	char B26[8] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char R29[4] __attribute__((aligned(16)));
+	u64 t__2e106;
+	u64 t__2e112;
+	u64 t__2e118;
+	u64 t__2e127;
+	u64 t__2e129;
+	u64 t__2e133;
+	u64 t__2e134;
+	u64 t__2e135;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e140;
+	u64 t__2e141;
+	u64 t__2e142;
+	u64 t__2e143;
+	u64 t__2e144;
+	u64 t__2e146;
+	u64 t__2e148;
+	u64 t__2e152;
+	u64 t__2e161;
+	u64 t__2e163;
+	u64 t__2e166;
+	u64 t__2e168;
+	u64 t__2e172;
+	u64 t__2e181;
+	u64 t__2e183;
+	u64 t__2e186;
+	u64 t__2e188;
+	u64 t__2e192;
+	u64 t__2e201;
+	u64 t__2e203;
+	u64 t__2e206;
+	u64 t__2e208;
+	u64 t__2e212;
+	u64 t__2e221;
+	u64 t__2e223;
+	u64 t_abortsite_2e131;
+	u64 t_object_2e108;
+	u64 t_object_2e116;
+	u64 t_object_2e147;
+	u64 t_object_2e151;
+	u64 t_object_2e167;
+	u64 t_object_2e171;
+	u64 t_object_2e187;
+	u64 t_object_2e191;
+	u64 t_object_2e207;
+	u64 t_object_2e211;
+	u64 t_tag_2e119;
+	u64 t_tag_2e153;
+	u64 t_tag_2e173;
+	u64 t_tag_2e193;
+	u64 t_tag_2e213;
+	L_start_2e101:;
+	t_object_2e108 = (u64)A0;
+	t_object_2e116 = (u64)A1;
+	t_object_2e147 = (u64)A2;
+	t_object_2e151 = (u64)A3;
+	t_object_2e167 = (u64)A4;
+	t_object_2e171 = (u64)A5;
+	t_object_2e187 = (u64)A6;
+	t_object_2e191 = (u64)A7;
+	t_object_2e207 = (u64)A8;
+	t_object_2e211 = (u64)A9;
+	L_body_2e102:;
+	*(u32 *)t_object_2e108 = (u32)((u64)3532310079UL);
+	t__2e112 = (u64)((u64)t_object_2e108 + (u64)((u64)4UL));
+	*(u32 *)t__2e112 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e116 = (u64)((u64)0UL);
+	t__2e118 = (u64)((u64)t_object_2e116 + (u64)((u64)8UL));
+	*(u64 *)t__2e118 = (u64)((u64)0UL);
+	t__2e118 = (u64)((u64)t__2e118 + (u64)((u64)8UL));
+	*(u64 *)t__2e118 = (u64)((u64)0UL);
+	BLIT((u64)B10, t_object_2e108, 8);
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e114)), 24);
+	BLIT((u64)B12, t_object_2e116, 24);
+	t__2e106 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R13, (u64)B10, (u64)B11, (u64)B12);
+	t_tag_2e119 = (u64)(*(u32 *)t__2e106);
+	t__2e127 = (u64)(u32)(((u32)t_tag_2e119 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e127) goto L_member_2e124; else goto L__2e126;
+	L__2e126:;
+	t__2e129 = (u64)(u32)(((u32)t_tag_2e119 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e129) goto L_member_2e125; else goto L__2e128;
+	L__2e128:;
+	goto L_matches_2e123;
+	L_member_2e124:;
+	goto L_matches_2e123;
+	L_member_2e125:;
+	goto L_matches_2e122;
+	L_matches_2e122:;
+	goto L__2e120;
+	L_matches_2e123:;
+	t_abortsite_2e131 = ((u64)0UL);
+	goto L_abort_2e132;
+	L__2e138:;
+	L__2e121:;
+	t_abortsite_2e131 = ((u64)1UL);
+	goto L_abort_2e139;
+	L__2e120:;
+	*(u32 *)t_object_2e147 = (u32)((u64)3532310079UL);
+	t__2e148 = (u64)((u64)t_object_2e147 + (u64)((u64)4UL));
+	*(u32 *)t__2e148 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e151 = (u64)((u64)0UL);
+	t__2e152 = (u64)((u64)t_object_2e151 + (u64)((u64)8UL));
+	*(u64 *)t__2e152 = (u64)((u64)0UL);
+	t__2e152 = (u64)((u64)t__2e152 + (u64)((u64)8UL));
+	*(u64 *)t__2e152 = (u64)((u64)0UL);
+	BLIT((u64)B14, t_object_2e147, 8);
+	BLIT((u64)B15, ((u64)((char *)&D_strliteral_2e150)), 24);
+	BLIT((u64)B16, t_object_2e151, 24);
+	t__2e146 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R17, (u64)B14, (u64)B15, (u64)B16);
+	t_tag_2e153 = (u64)(*(u32 *)t__2e146);
+	t__2e161 = (u64)(u32)(((u32)t_tag_2e153 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e161) goto L_member_2e158; else goto L__2e160;
+	L__2e160:;
+	t__2e163 = (u64)(u32)(((u32)t_tag_2e153 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e163) goto L_member_2e159; else goto L__2e162;
+	L__2e162:;
+	goto L_matches_2e157;
+	L_member_2e158:;
+	goto L_matches_2e157;
+	L_member_2e159:;
+	goto L_matches_2e156;
+	L_matches_2e156:;
+	goto L__2e154;
+	L_matches_2e157:;
+	t_abortsite_2e131 = ((u64)2UL);
+	goto L_abort_2e132;
+	L__2e164:;
+	L__2e155:;
+	t_abortsite_2e131 = ((u64)3UL);
+	goto L_abort_2e139;
+	L__2e154:;
+	*(u32 *)t_object_2e167 = (u32)((u64)3532310079UL);
+	t__2e168 = (u64)((u64)t_object_2e167 + (u64)((u64)4UL));
+	*(u32 *)t__2e168 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e171 = (u64)((u64)0UL);
+	t__2e172 = (u64)((u64)t_object_2e171 + (u64)((u64)8UL));
+	*(u64 *)t__2e172 = (u64)((u64)0UL);
+	t__2e172 = (u64)((u64)t__2e172 + (u64)((u64)8UL));
+	*(u64 *)t__2e172 = (u64)((u64)0UL);
+	BLIT((u64)B18, t_object_2e167, 8);
+	BLIT((u64)B19, ((u64)((char *)&D_strliteral_2e170)), 24);
+	BLIT((u64)B20, t_object_2e171, 24);
+	t__2e166 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R21, (u64)B18, (u64)B19, (u64)B20);
+	t_tag_2e173 = (u64)(*(u32 *)t__2e166);
+	t__2e181 = (u64)(u32)(((u32)t_tag_2e173 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e181) goto L_member_2e178; else goto L__2e180;
+	L__2e180:;
+	t__2e183 = (u64)(u32)(((u32)t_tag_2e173 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e183) goto L_member_2e179; else goto L__2e182;
+	L__2e182:;
+	goto L_matches_2e177;
+	L_member_2e178:;
+	goto L_matches_2e177;
+	L_member_2e179:;
+	goto L_matches_2e176;
+	L_matches_2e176:;
+	goto L__2e174;
+	L_matches_2e177:;
+	t_abortsite_2e131 = ((u64)4UL);
+	goto L_abort_2e132;
+	L__2e184:;
+	L__2e175:;
+	t_abortsite_2e131 = ((u64)5UL);
+	goto L_abort_2e139;
+	L__2e174:;
+	*(u32 *)t_object_2e187 = (u32)((u64)3532310079UL);
+	t__2e188 = (u64)((u64)t_object_2e187 + (u64)((u64)4UL));
+	*(u32 *)t__2e188 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e191 = (u64)((u64)0UL);
+	t__2e192 = (u64)((u64)t_object_2e191 + (u64)((u64)8UL));
+	*(u64 *)t__2e192 = (u64)((u64)0UL);
+	t__2e192 = (u64)((u64)t__2e192 + (u64)((u64)8UL));
+	*(u64 *)t__2e192 = (u64)((u64)0UL);
+	BLIT((u64)B22, t_object_2e187, 8);
+	BLIT((u64)B23, ((u64)((char *)&D_strliteral_2e190)), 24);
+	BLIT((u64)B24, t_object_2e191, 24);
+	t__2e186 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R25, (u64)B22, (u64)B23, (u64)B24);
+	t_tag_2e193 = (u64)(*(u32 *)t__2e186);
+	t__2e201 = (u64)(u32)(((u32)t_tag_2e193 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e201) goto L_member_2e198; else goto L__2e200;
+	L__2e200:;
+	t__2e203 = (u64)(u32)(((u32)t_tag_2e193 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e203) goto L_member_2e199; else goto L__2e202;
+	L__2e202:;
+	goto L_matches_2e197;
+	L_member_2e198:;
+	goto L_matches_2e197;
+	L_member_2e199:;
+	goto L_matches_2e196;
+	L_matches_2e196:;
+	goto L__2e194;
+	L_matches_2e197:;
+	t_abortsite_2e131 = ((u64)6UL);
+	goto L_abort_2e132;
+	L__2e204:;
+	L__2e195:;
+	t_abortsite_2e131 = ((u64)7UL);
+	goto L_abort_2e139;
+	L__2e194:;
+	*(u32 *)t_object_2e207 = (u32)((u64)3532310079UL);
+	t__2e208 = (u64)((u64)t_object_2e207 + (u64)((u64)4UL));
+	*(u32 *)t__2e208 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e211 = (u64)((u64)0UL);
+	t__2e212 = (u64)((u64)t_object_2e211 + (u64)((u64)8UL));
+	*(u64 *)t__2e212 = (u64)((u64)0UL);
+	t__2e212 = (u64)((u64)t__2e212 + (u64)((u64)8UL));
+	*(u64 *)t__2e212 = (u64)((u64)0UL);
+	BLIT((u64)B26, t_object_2e207, 8);
+	BLIT((u64)B27, ((u64)((char *)&D_strliteral_2e210)), 24);
+	BLIT((u64)B28, t_object_2e211, 24);
+	t__2e206 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R29, (u64)B26, (u64)B27, (u64)B28);
+	t_tag_2e213 = (u64)(*(u32 *)t__2e206);
+	t__2e221 = (u64)(u32)(((u32)t_tag_2e213 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e221) goto L_member_2e218; else goto L__2e220;
+	L__2e220:;
+	t__2e223 = (u64)(u32)(((u32)t_tag_2e213 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e223) goto L_member_2e219; else goto L__2e222;
+	L__2e222:;
+	goto L_matches_2e217;
+	L_member_2e218:;
+	goto L_matches_2e217;
+	L_member_2e219:;
+	goto L_matches_2e216;
+	L_matches_2e216:;
+	goto L__2e214;
+	L_matches_2e217:;
+	t_abortsite_2e131 = ((u64)8UL);
+	goto L_abort_2e132;
+	L__2e224:;
+	L__2e215:;
+	t_abortsite_2e131 = ((u64)9UL);
+	goto L_abort_2e139;
+	L__2e214:;
+	goto L__2e103;
+	L__2e225:;
+	L__2e103:;
+	return;
+	L_abort_2e132:;
+	t__2e133 = (u64)((u64)t_abortsite_2e131 * (u64)((u64)16UL));
+	t__2e133 = (u64)((u64)((u64)((char *)&D_abortsites_2e130)) + (u64)t__2e133);
+	t__2e134 = (u64)(*(u64 *)t__2e133);
+	t__2e135 = (u64)((u64)t__2e133 + (u64)((u64)8UL));
+	t__2e136 = (u64)(*(u32 *)t__2e135);
+	t__2e135 = (u64)((u64)t__2e133 + (u64)((u64)12UL));
+	t__2e137 = (u64)(*(u32 *)t__2e135);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e134, (u64)t__2e136, (u64)t__2e137, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e139:;
+	t__2e140 = (u64)((u64)t_abortsite_2e131 * (u64)((u64)16UL));
+	t__2e140 = (u64)((u64)((u64)((char *)&D_abortsites_2e130)) + (u64)t__2e140);
+	t__2e141 = (u64)(*(u64 *)t__2e140);
+	t__2e142 = (u64)((u64)t__2e140 + (u64)((u64)8UL));
+	t__2e143 = (u64)(*(u32 *)t__2e142);
+	t__2e142 = (u64)((u64)t__2e140 + (u64)((u64)12UL));
+	t__2e144 = (u64)(*(u32 *)t__2e142);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e141, (u64)t__2e143, (u64)t__2e144, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_expandable(void) {
+	char A0[48] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e233;
+	u64 t__2e234;
+	u64 t__2e236;
+	u64 t__2e237;
+	u64 t__2e238;
+	u64 t__2e239;
+	u64 t__2e240;
+	u64 t__2e241;
+	u64 t__2e242;
+	u64 t__2e243;
+	u64 t__2e244;
+	u64 t__2e250;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e253;
+	u64 t__2e254;
+	u64 t__2e255;
+	u64 t__2e256;
+	u64 t__2e259;
+	u64 t__2e263;
+	u64 t__2e264;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e269;
+	u64 t__2e270;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e275;
+	u64 t__2e276;
+	u64 t__2e277;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t__2e280;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e283;
+	u64 t__2e284;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e291;
+	u64 t__2e294;
+	u64 t__2e295;
+	u64 t__2e298;
+	u64 t__2e299;
+	u64 t__2e300;
+	u64 t__2e301;
+	u64 t__2e304;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e310;
+	u64 t__2e311;
+	u64 t__2e312;
+	u64 t__2e313;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e318;
+	u64 t__2e319;
+	u64 t__2e320;
+	u64 t__2e321;
+	u64 t__2e322;
+	u64 t__2e323;
+	u64 t__2e326;
+	u64 t__2e329;
+	u64 t__2e330;
+	u64 t__2e333;
+	u64 t__2e336;
+	u64 t__2e337;
+	u64 t__2e340;
+	u64 t__2e341;
+	u64 t__2e342;
+	u64 t__2e343;
+	u64 t__2e346;
+	u64 t__2e347;
+	u64 t__2e348;
+	u64 t__2e349;
+	u64 t__2e352;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e355;
+	u64 t__2e358;
+	u64 t__2e359;
+	u64 t__2e360;
+	u64 t__2e361;
+	u64 t__2e364;
+	u64 t__2e365;
+	u64 t__2e366;
+	u64 t__2e367;
+	u64 t_abortsite_2e248;
+	u64 t_binding_2e230;
+	u64 t_item_2e232;
+	u64 t_item_2e235;
+	u64 t_item_2e262;
+	u64 t_item_2e293;
+	u64 t_item_2e335;
+	u64 t_object_2e260;
+	u64 t_object_2e292;
+	u64 t_object_2e334;
+	L_start_2e226:;
+	t_binding_2e230 = (u64)A0;
+	t_object_2e260 = (u64)A1;
+	t_object_2e292 = (u64)A2;
+	t_object_2e334 = (u64)A3;
+	L_body_2e227:;
+	t_item_2e232 = (u64)((u64)t_binding_2e230 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e232 = (u64)((u64)0UL);
+	t__2e233 = (u64)((u64)t_binding_2e230 + (u64)((u64)8UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e233, (u64)t_item_2e232, (u64)((u64)40UL));
+	t_item_2e235 = (u64)((u64)t_binding_2e230 + (u64)((u64)0UL));
+	t__2e236 = (u64)(*(u64 *)t_item_2e235);
+	t__2e234 = (u64)((u64)t_binding_2e230 + (u64)((u64)8UL));
+	*(u64 *)t__2e234 = (u64)t__2e236;
+	t__2e234 = (u64)((u64)t_binding_2e230 + (u64)((u64)16UL));
+	*(u64 *)t__2e234 = (u64)t__2e236;
+	t__2e234 = (u64)((u64)t_binding_2e230 + (u64)((u64)24UL));
+	*(u64 *)t__2e234 = (u64)t__2e236;
+	t__2e234 = (u64)((u64)t_binding_2e230 + (u64)((u64)32UL));
+	*(u64 *)t__2e234 = (u64)t__2e236;
+	t__2e234 = (u64)((u64)t_binding_2e230 + (u64)((u64)40UL));
+	*(u64 *)t__2e234 = (u64)t__2e236;
+	t__2e237 = t_binding_2e230;
+	t__2e238 = (u64)((i64)(i32)((u64)2UL));
+	t__2e239 = (u64)((i64)(i32)((u64)2UL));
+	t__2e240 = (u64)((u64)t__2e239 - (u64)t__2e238);
+	t__2e243 = (u64)(u32)(((u64)t__2e238 <= (u64)t__2e239));
+	t__2e242 = (u64)(u32)(((u64)t__2e239 <= (u64)((u64)6UL)));
+	t__2e244 = (u64)(u32)((u32)t__2e243 & (u32)t__2e242);
+	t__2e240 = (u64)((u64)t__2e239 - (u64)t__2e238);
+	t__2e241 = (u64)((u64)((u64)6UL) - (u64)t__2e238);
+	if ((u32)t__2e244) goto L__2e246; else goto L__2e245;
+	L__2e245:;
+	t_abortsite_2e248 = ((u64)0UL);
+	goto L_abort_2e249;
+	L__2e246:;
+	t__2e255 = (u64)((u64)t__2e238 * (u64)((u64)8UL));
+	t__2e256 = (u64)((u64)t__2e237 + (u64)t__2e255);
+	t__2e259 = (u64)(u32)(((u64)t__2e240 != (u64)((u64)0UL)));
+	if ((u32)t__2e259) goto L__2e258; else goto L__2e257;
+	L__2e258:;
+	t_item_2e262 = (u64)((u64)t_object_2e260 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e262 = (u64)((u64)1UL);
+	t__2e263 = (u64)(*(u64 *)t_object_2e260);
+	*(u64 *)t__2e256 = (u64)t__2e263;
+	t__2e264 = (u64)((u64)t__2e256 + (u64)((u64)8UL));
+	t__2e240 = (u64)((u64)t__2e240 - (u64)((u64)1UL));
+	t__2e240 = (u64)((u64)t__2e240 * (u64)((u64)8UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e264, (u64)t__2e256, (u64)t__2e240);
+	L__2e257:;
+	t__2e269 = (u64)((i64)(i32)((u64)2UL));
+	t__2e268 = (u64)((u64)t__2e269 * (u64)((u64)8UL));
+	t__2e268 = (u64)((u64)t_binding_2e230 + (u64)t__2e268);
+	t__2e270 = (u64)(*(u64 *)t__2e268);
+	t__2e267 = (u64)(u32)(((u64)t__2e270 == (u64)((u64)0UL)));
+	if ((u32)t__2e267) goto L_passed_2e266; else goto L_failed_2e265;
+	L_failed_2e265:;
+	t_abortsite_2e248 = ((u64)1UL);
+	goto L_abort_2e271;
+	L_passed_2e266:;
+	t__2e277 = t_binding_2e230;
+	t__2e278 = (u64)((i64)(i32)((u64)1UL));
+	t__2e279 = (u64)((i64)(i32)((u64)3UL));
+	t__2e280 = (u64)((u64)t__2e279 - (u64)t__2e278);
+	t__2e283 = (u64)(u32)(((u64)t__2e278 <= (u64)t__2e279));
+	t__2e282 = (u64)(u32)(((u64)t__2e279 <= (u64)((u64)6UL)));
+	t__2e284 = (u64)(u32)((u32)t__2e283 & (u32)t__2e282);
+	t__2e280 = (u64)((u64)t__2e279 - (u64)t__2e278);
+	t__2e281 = (u64)((u64)((u64)6UL) - (u64)t__2e278);
+	if ((u32)t__2e284) goto L__2e286; else goto L__2e285;
+	L__2e285:;
+	t_abortsite_2e248 = ((u64)2UL);
+	goto L_abort_2e249;
+	L__2e286:;
+	t__2e287 = (u64)((u64)t__2e278 * (u64)((u64)8UL));
+	t__2e288 = (u64)((u64)t__2e277 + (u64)t__2e287);
+	t__2e291 = (u64)(u32)(((u64)t__2e280 != (u64)((u64)0UL)));
+	if ((u32)t__2e291) goto L__2e290; else goto L__2e289;
+	L__2e290:;
+	t_item_2e293 = (u64)((u64)t_object_2e292 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e293 = (u64)((u64)1UL);
+	t__2e294 = (u64)(*(u64 *)t_object_2e292);
+	*(u64 *)t__2e288 = (u64)t__2e294;
+	t__2e295 = (u64)((u64)t__2e288 + (u64)((u64)8UL));
+	t__2e280 = (u64)((u64)t__2e280 - (u64)((u64)1UL));
+	t__2e280 = (u64)((u64)t__2e280 * (u64)((u64)8UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e295, (u64)t__2e288, (u64)t__2e280);
+	L__2e289:;
+	t__2e300 = (u64)((i64)(i32)((u64)0UL));
+	t__2e299 = (u64)((u64)t__2e300 * (u64)((u64)8UL));
+	t__2e299 = (u64)((u64)t_binding_2e230 + (u64)t__2e299);
+	t__2e301 = (u64)(*(u64 *)t__2e299);
+	t__2e298 = (u64)(u32)(((u64)t__2e301 == (u64)((u64)0UL)));
+	if ((u32)t__2e298) goto L_passed_2e297; else goto L_failed_2e296;
+	L_failed_2e296:;
+	t_abortsite_2e248 = ((u64)3UL);
+	goto L_abort_2e271;
+	L_passed_2e297:;
+	t__2e306 = (u64)((i64)(i32)((u64)1UL));
+	t__2e305 = (u64)((u64)t__2e306 * (u64)((u64)8UL));
+	t__2e305 = (u64)((u64)t_binding_2e230 + (u64)t__2e305);
+	t__2e307 = (u64)(*(u64 *)t__2e305);
+	t__2e304 = (u64)(u32)(((u64)t__2e307 == (u64)((u64)1UL)));
+	if ((u32)t__2e304) goto L_passed_2e303; else goto L_failed_2e302;
+	L_failed_2e302:;
+	t_abortsite_2e248 = ((u64)4UL);
+	goto L_abort_2e271;
+	L_passed_2e303:;
+	t__2e312 = (u64)((i64)(i32)((u64)2UL));
+	t__2e311 = (u64)((u64)t__2e312 * (u64)((u64)8UL));
+	t__2e311 = (u64)((u64)t_binding_2e230 + (u64)t__2e311);
+	t__2e313 = (u64)(*(u64 *)t__2e311);
+	t__2e310 = (u64)(u32)(((u64)t__2e313 == (u64)((u64)1UL)));
+	if ((u32)t__2e310) goto L_passed_2e309; else goto L_failed_2e308;
+	L_failed_2e308:;
+	t_abortsite_2e248 = ((u64)5UL);
+	goto L_abort_2e271;
+	L_passed_2e309:;
+	t__2e318 = (u64)((i64)(i32)((u64)3UL));
+	t__2e317 = (u64)((u64)t__2e318 * (u64)((u64)8UL));
+	t__2e317 = (u64)((u64)t_binding_2e230 + (u64)t__2e317);
+	t__2e319 = (u64)(*(u64 *)t__2e317);
+	t__2e316 = (u64)(u32)(((u64)t__2e319 == (u64)((u64)0UL)));
+	if ((u32)t__2e316) goto L_passed_2e315; else goto L_failed_2e314;
+	L_failed_2e314:;
+	t_abortsite_2e248 = ((u64)6UL);
+	goto L_abort_2e271;
+	L_passed_2e315:;
+	t__2e320 = t_binding_2e230;
+	t__2e321 = (u64)((i64)(i32)((u64)2UL));
+	t__2e322 = (u64)((u64)((u64)6UL) - (u64)t__2e321);
+	t__2e326 = (u64)(u32)(((u64)t__2e321 <= (u64)((u64)6UL)));
+	t__2e322 = (u64)((u64)((u64)6UL) - (u64)t__2e321);
+	t__2e323 = (u64)((u64)((u64)6UL) - (u64)t__2e321);
+	if ((u32)t__2e326) goto L__2e328; else goto L__2e327;
+	L__2e327:;
+	t_abortsite_2e248 = ((u64)7UL);
+	goto L_abort_2e249;
+	L__2e328:;
+	t__2e329 = (u64)((u64)t__2e321 * (u64)((u64)8UL));
+	t__2e330 = (u64)((u64)t__2e320 + (u64)t__2e329);
+	t__2e333 = (u64)(u32)(((u64)t__2e322 != (u64)((u64)0UL)));
+	if ((u32)t__2e333) goto L__2e332; else goto L__2e331;
+	L__2e332:;
+	t_item_2e335 = (u64)((u64)t_object_2e334 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e335 = (u64)((u64)123UL);
+	t__2e336 = (u64)(*(u64 *)t_object_2e334);
+	*(u64 *)t__2e330 = (u64)t__2e336;
+	t__2e337 = (u64)((u64)t__2e330 + (u64)((u64)8UL));
+	t__2e322 = (u64)((u64)t__2e322 - (u64)((u64)1UL));
+	t__2e322 = (u64)((u64)t__2e322 * (u64)((u64)8UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e337, (u64)t__2e330, (u64)t__2e322);
+	L__2e331:;
+	t__2e342 = (u64)((i64)(i32)((u64)1UL));
+	t__2e341 = (u64)((u64)t__2e342 * (u64)((u64)8UL));
+	t__2e341 = (u64)((u64)t_binding_2e230 + (u64)t__2e341);
+	t__2e343 = (u64)(*(u64 *)t__2e341);
+	t__2e340 = (u64)(u32)(((u64)t__2e343 == (u64)((u64)1UL)));
+	if ((u32)t__2e340) goto L_passed_2e339; else goto L_failed_2e338;
+	L_failed_2e338:;
+	t_abortsite_2e248 = ((u64)8UL);
+	goto L_abort_2e271;
+	L_passed_2e339:;
+	t__2e348 = (u64)((i64)(i32)((u64)2UL));
+	t__2e347 = (u64)((u64)t__2e348 * (u64)((u64)8UL));
+	t__2e347 = (u64)((u64)t_binding_2e230 + (u64)t__2e347);
+	t__2e349 = (u64)(*(u64 *)t__2e347);
+	t__2e346 = (u64)(u32)(((u64)t__2e349 == (u64)((u64)123UL)));
+	if ((u32)t__2e346) goto L_passed_2e345; else goto L_failed_2e344;
+	L_failed_2e344:;
+	t_abortsite_2e248 = ((u64)9UL);
+	goto L_abort_2e271;
+	L_passed_2e345:;
+	t__2e354 = (u64)((i64)(i32)((u64)3UL));
+	t__2e353 = (u64)((u64)t__2e354 * (u64)((u64)8UL));
+	t__2e353 = (u64)((u64)t_binding_2e230 + (u64)t__2e353);
+	t__2e355 = (u64)(*(u64 *)t__2e353);
+	t__2e352 = (u64)(u32)(((u64)t__2e355 == (u64)((u64)123UL)));
+	if ((u32)t__2e352) goto L_passed_2e351; else goto L_failed_2e350;
+	L_failed_2e350:;
+	t_abortsite_2e248 = ((u64)10UL);
+	goto L_abort_2e271;
+	L_passed_2e351:;
+	t__2e360 = (u64)((i64)(i32)((u64)4UL));
+	t__2e359 = (u64)((u64)t__2e360 * (u64)((u64)8UL));
+	t__2e359 = (u64)((u64)t_binding_2e230 + (u64)t__2e359);
+	t__2e361 = (u64)(*(u64 *)t__2e359);
+	t__2e358 = (u64)(u32)(((u64)t__2e361 == (u64)((u64)123UL)));
+	if ((u32)t__2e358) goto L_passed_2e357; else goto L_failed_2e356;
+	L_failed_2e356:;
+	t_abortsite_2e248 = ((u64)11UL);
+	goto L_abort_2e271;
+	L_passed_2e357:;
+	t__2e366 = (u64)((i64)(i32)((u64)5UL));
+	t__2e365 = (u64)((u64)t__2e366 * (u64)((u64)8UL));
+	t__2e365 = (u64)((u64)t_binding_2e230 + (u64)t__2e365);
+	t__2e367 = (u64)(*(u64 *)t__2e365);
+	t__2e364 = (u64)(u32)(((u64)t__2e367 == (u64)((u64)123UL)));
+	if ((u32)t__2e364) goto L_passed_2e363; else goto L_failed_2e362;
+	L_failed_2e362:;
+	t_abortsite_2e248 = ((u64)12UL);
+	goto L_abort_2e271;
+	L_passed_2e363:;
+	goto L__2e228;
+	L__2e368:;
+	L__2e228:;
+	return;
+	L_abort_2e249:;
+	t__2e250 = (u64)((u64)t_abortsite_2e248 * (u64)((u64)16UL));
+	t__2e250 = (u64)((u64)((u64)((char *)&D_abortsites_2e247)) + (u64)t__2e250);
+	t__2e251 = (u64)(*(u64 *)t__2e250);
+	t__2e252 = (u64)((u64)t__2e250 + (u64)((u64)8UL));
+	t__2e253 = (u64)(*(u32 *)t__2e252);
+	t__2e252 = (u64)((u64)t__2e250 + (u64)((u64)12UL));
+	t__2e254 = (u64)(*(u32 *)t__2e252);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e251, (u64)t__2e253, (u64)t__2e254, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e271:;
+	t__2e272 = (u64)((u64)t_abortsite_2e248 * (u64)((u64)16UL));
+	t__2e272 = (u64)((u64)((u64)((char *)&D_abortsites_2e247)) + (u64)t__2e272);
+	t__2e273 = (u64)(*(u64 *)t__2e272);
+	t__2e274 = (u64)((u64)t__2e272 + (u64)((u64)8UL));
+	t__2e275 = (u64)(*(u32 *)t__2e274);
+	t__2e274 = (u64)((u64)t__2e272 + (u64)((u64)12UL));
+	t__2e276 = (u64)(*(u32 *)t__2e274);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e273, (u64)t__2e275, (u64)t__2e276, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_recursive__structure(void) {
+	char A0[32] __attribute__((aligned(16)));
+	char A1[32] __attribute__((aligned(16)));
+	char A2[32] __attribute__((aligned(16)));
+	char A3[64] __attribute__((aligned(16)));
+	char B4[32] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	u64 t__2e386;
+	u64 t__2e388;
+	u64 t__2e389;
+	u64 t__2e390;
+	u64 t__2e393;
+	u64 t__2e394;
+	u64 t_binding_2e373;
+	u64 t_field_2e377;
+	u64 t_field_2e381;
+	u64 t_field_2e385;
+	u64 t_field_2e387;
+	u64 t_item_2e380;
+	u64 t_item_2e384;
+	u64 t_object_2e374;
+	u64 t_object_2e378;
+	u64 t_object_2e382;
+	L_start_2e369:;
+	t_binding_2e373 = (u64)A0;
+	t_object_2e374 = (u64)A1;
+	t_object_2e378 = (u64)A2;
+	t_object_2e382 = (u64)A3;
+	L_body_2e370:;
+	t_field_2e377 = (u64)((u64)t_object_2e374 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e377 = (u64)((u64)15UL);
+	t_field_2e377 = (u64)((u64)t_object_2e374 + (u64)((u64)8UL));
+	t_item_2e380 = (u64)((u64)t_object_2e378 + (u64)((u64)0UL));
+	t_field_2e381 = (u64)((u64)t_item_2e380 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e381 = (u64)((u64)23UL);
+	t_field_2e381 = (u64)((u64)t_item_2e380 + (u64)((u64)8UL));
+	t_item_2e384 = (u64)((u64)t_object_2e382 + (u64)((u64)0UL));
+	t_field_2e385 = (u64)((u64)t_item_2e384 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e385 = (u64)((u64)62UL);
+	t_field_2e385 = (u64)((u64)t_item_2e384 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e385 = (u64)((u64)0UL);
+	t__2e386 = (u64)((u64)t_field_2e385 + (u64)((u64)8UL));
+	*(u64 *)t__2e386 = (u64)((u64)0UL);
+	t__2e386 = (u64)((u64)t__2e386 + (u64)((u64)8UL));
+	*(u64 *)t__2e386 = (u64)((u64)0UL);
+	t_item_2e384 = (u64)((u64)t_object_2e382 + (u64)((u64)32UL));
+	t_field_2e387 = (u64)((u64)t_item_2e384 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e387 = (u64)((u64)34UL);
+	t_field_2e387 = (u64)((u64)t_item_2e384 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e387 = (u64)((u64)0UL);
+	t__2e388 = (u64)((u64)t_field_2e387 + (u64)((u64)8UL));
+	*(u64 *)t__2e388 = (u64)((u64)0UL);
+	t__2e388 = (u64)((u64)t__2e388 + (u64)((u64)8UL));
+	*(u64 *)t__2e388 = (u64)((u64)0UL);
+	*(u64 *)t_field_2e381 = (u64)t_object_2e382;
+	t__2e389 = (u64)((u64)t_field_2e381 + (u64)((u64)8UL));
+	*(u64 *)t__2e389 = (u64)((u64)2UL);
+	t__2e389 = (u64)((u64)t__2e389 + (u64)((u64)8UL));
+	*(u64 *)t__2e389 = (u64)((u64)2UL);
+	*(u64 *)t_field_2e377 = (u64)t_object_2e378;
+	t__2e390 = (u64)((u64)t_field_2e377 + (u64)((u64)8UL));
+	*(u64 *)t__2e390 = (u64)((u64)1UL);
+	t__2e390 = (u64)((u64)t__2e390 + (u64)((u64)8UL));
+	*(u64 *)t__2e390 = (u64)((u64)1UL);
+	BLIT(t_binding_2e373, t_object_2e374, ((u64)32UL));
+	BLIT((u64)B4, t_binding_2e373, 32);
+	t__2e394 = (u64)(((u64 (*)(u64))((u64)((char *)&F_sum__tree)))((u64)B4));
+	t__2e393 = (u64)(u32)(((u64)t__2e394 == (u64)((u64)134UL)));
+	if ((u32)t__2e393) goto L_passed_2e392; else goto L_failed_2e391;
+	L_failed_2e391:;
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e396)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)216UL), (u64)((u64)15UL), (u64)B5);
+	__builtin_trap();
+	L_passed_2e392:;
+	goto L__2e371;
+	L__2e397:;
+	L__2e371:;
+	return;
+}
+static u64 F_sum__tree(u64 p_t) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char B2[32] __attribute__((aligned(16)));
+	u64 t__2e404;
+	u64 t__2e411;
+	u64 t__2e412;
+	u64 t__2e414;
+	u64 t__2e415;
+	u64 t__2e416;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e422;
+	u64 t__2e423;
+	u64 t__2e424;
+	u64 t__2e425;
+	u64 t__2e426;
+	u64 t__2e427;
+	u64 t__2e428;
+	u64 t__2e434;
+	u64 t__2e435;
+	u64 t__2e436;
+	u64 t__2e437;
+	u64 t__2e438;
+	u64 t__2e440;
+	u64 t__2e441;
+	u64 t_abortsite_2e432;
+	u64 t_binding_2e402;
+	u64 t_binding_2e410;
+	u64 t_field_2e403;
+	u64 t_field_2e413;
+	u64 t_field_2e421;
+	u64 t_t;
+	t_t = p_t;
+	L_start_2e398:;
+	t_binding_2e402 = (u64)A0;
+	t_binding_2e410 = (u64)A1;
+	L_body_2e399:;
+	t_field_2e403 = (u64)((u64)t_t + (u64)((u64)0UL));
+	t__2e404 = (u64)(*(u64 *)t_field_2e403);
+	*(u64 *)t_binding_2e402 = (u64)t__2e404;
+	*(u64 *)t_binding_2e410 = (u64)((u64)0UL);
+	L_loop_2e405:;
+	t__2e412 = (u64)(*(u64 *)t_binding_2e410);
+	t_field_2e413 = (u64)((u64)t_t + (u64)((u64)8UL));
+	t__2e414 = (u64)((u64)t_field_2e413 + (u64)((u64)8UL));
+	t__2e415 = (u64)((u64)t_field_2e413 + (u64)((u64)16UL));
+	t__2e416 = (u64)(*(u64 *)t__2e414);
+	t__2e411 = (u64)(u32)(((u64)t__2e412 < (u64)t__2e416));
+	if ((u32)t__2e411) goto L_body_2e406; else goto L__2e408;
+	L_body_2e406:;
+	t__2e419 = (u64)(*(u64 *)t_binding_2e402);
+	t_field_2e421 = (u64)((u64)t_t + (u64)((u64)8UL));
+	t__2e423 = (u64)((u64)t_field_2e421 + (u64)((u64)8UL));
+	t__2e424 = (u64)((u64)t_field_2e421 + (u64)((u64)16UL));
+	t__2e425 = (u64)(*(u64 *)t_field_2e421);
+	t__2e426 = (u64)(*(u64 *)t__2e423);
+	t__2e427 = (u64)(*(u64 *)t_binding_2e410);
+	t__2e422 = (u64)((u64)t__2e427 * (u64)((u64)32UL));
+	t__2e422 = (u64)((u64)t__2e425 + (u64)t__2e422);
+	t__2e428 = (u64)(u32)(((u64)t__2e427 < (u64)t__2e426));
+	if ((u32)t__2e428) goto L__2e430; else goto L__2e429;
+	L__2e429:;
+	t_abortsite_2e432 = ((u64)0UL);
+	goto L_abort_2e433;
+	L__2e430:;
+	BLIT((u64)B2, t__2e422, 32);
+	t__2e420 = (u64)(((u64 (*)(u64))((u64)((char *)&F_sum__tree)))((u64)B2));
+	t__2e419 = (u64)((u64)t__2e419 + (u64)t__2e420);
+	*(u64 *)t_binding_2e402 = (u64)t__2e419;
+	goto L__2e417;
+	L__2e439:;
+	L__2e417:;
+	L_after_2e409:;
+	t__2e440 = (u64)(*(u64 *)t_binding_2e410);
+	t__2e440 = (u64)((u64)t__2e440 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e410 = (u64)t__2e440;
+	goto L_loop_2e405;
+	L__2e408:;
+	t__2e441 = (u64)(*(u64 *)t_binding_2e402);
+	return (u64)t__2e441;
+	L__2e442:;
+	L__2e400:;
+	L__2e443:;
+	return 0;
+	L_abort_2e433:;
+	t__2e434 = (u64)((u64)t_abortsite_2e432 * (u64)((u64)16UL));
+	t__2e434 = (u64)((u64)((u64)((char *)&D_abortsites_2e431)) + (u64)t__2e434);
+	t__2e435 = (u64)(*(u64 *)t__2e434);
+	t__2e436 = (u64)((u64)t__2e434 + (u64)((u64)8UL));
+	t__2e437 = (u64)(*(u32 *)t__2e436);
+	t__2e436 = (u64)((u64)t__2e434 + (u64)((u64)12UL));
+	t__2e438 = (u64)(*(u32 *)t__2e436);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e435, (u64)t__2e437, (u64)t__2e438, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_slicing(void) {
+	char A0[20] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[20] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[12] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[16] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[24] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[24] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[24] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char A20[24] __attribute__((aligned(16)));
+	char A21[24] __attribute__((aligned(16)));
+	char A22[24] __attribute__((aligned(16)));
+	char A23[24] __attribute__((aligned(16)));
+	char A24[24] __attribute__((aligned(16)));
+	char A25[24] __attribute__((aligned(16)));
+	char A26[24] __attribute__((aligned(16)));
+	char A27[20] __attribute__((aligned(16)));
+	char A28[24] __attribute__((aligned(16)));
+	char A29[24] __attribute__((aligned(16)));
+	char A30[20] __attribute__((aligned(16)));
+	char A31[24] __attribute__((aligned(16)));
+	char A32[24] __attribute__((aligned(16)));
+	char A33[12] __attribute__((aligned(16)));
+	char A34[24] __attribute__((aligned(16)));
+	char A35[24] __attribute__((aligned(16)));
+	char A36[8] __attribute__((aligned(16)));
+	char A37[24] __attribute__((aligned(16)));
+	char A38[24] __attribute__((aligned(16)));
+	char A39[16] __attribute__((aligned(16)));
+	char A40[24] __attribute__((aligned(16)));
+	char A41[24] __attribute__((aligned(16)));
+	char A42[8] __attribute__((aligned(16)));
+	char A43[24] __attribute__((aligned(16)));
+	char A44[24] __attribute__((aligned(16)));
+	char A45[20] __attribute__((aligned(16)));
+	char A46[24] __attribute__((aligned(16)));
+	char A47[24] __attribute__((aligned(16)));
+	char A48[12] __attribute__((aligned(16)));
+	char A49[24] __attribute__((aligned(16)));
+	char A50[24] __attribute__((aligned(16)));
+	char A51[8] __attribute__((aligned(16)));
+	char A52[24] __attribute__((aligned(16)));
+	char A53[24] __attribute__((aligned(16)));
+	char A54[16] __attribute__((aligned(16)));
+	char A55[24] __attribute__((aligned(16)));
+	char A56[24] __attribute__((aligned(16)));
+	char A57[8] __attribute__((aligned(16)));
+	char A58[24] __attribute__((aligned(16)));
+	char A59[8] __attribute__((aligned(16)));
+	char A60[24] __attribute__((aligned(16)));
+	char A61[8] __attribute__((aligned(16)));
+	char A62[24] __attribute__((aligned(16)));
+	char A63[8] __attribute__((aligned(16)));
+	char A64[24] __attribute__((aligned(16)));
+	char B65[24] __attribute__((aligned(16)));
+	char B66[24] __attribute__((aligned(16)));
+	char B67[24] __attribute__((aligned(16)));
+	char B68[24] __attribute__((aligned(16)));
+	char B69[24] __attribute__((aligned(16)));
+	char B70[24] __attribute__((aligned(16)));
+	char B71[24] __attribute__((aligned(16)));
+	char B72[24] __attribute__((aligned(16)));
+	char B73[24] __attribute__((aligned(16)));
+	char B74[24] __attribute__((aligned(16)));
+	char B75[24] __attribute__((aligned(16)));
+	char B76[24] __attribute__((aligned(16)));
+	char B77[24] __attribute__((aligned(16)));
+	char B78[24] __attribute__((aligned(16)));
+	char B79[24] __attribute__((aligned(16)));
+	char B80[24] __attribute__((aligned(16)));
+	char B81[24] __attribute__((aligned(16)));
+	char B82[24] __attribute__((aligned(16)));
+	char B83[24] __attribute__((aligned(16)));
+	char B84[24] __attribute__((aligned(16)));
+	char B85[24] __attribute__((aligned(16)));
+	char B86[24] __attribute__((aligned(16)));
+	char B87[24] __attribute__((aligned(16)));
+	char B88[24] __attribute__((aligned(16)));
+	char B89[24] __attribute__((aligned(16)));
+	char B90[24] __attribute__((aligned(16)));
+	char B91[24] __attribute__((aligned(16)));
+	char B92[24] __attribute__((aligned(16)));
+	char B93[24] __attribute__((aligned(16)));
+	char B94[24] __attribute__((aligned(16)));
+	char B95[24] __attribute__((aligned(16)));
+	char B96[24] __attribute__((aligned(16)));
+	char B97[24] __attribute__((aligned(16)));
+	char B98[24] __attribute__((aligned(16)));
+	char B99[24] __attribute__((aligned(16)));
+	char B100[24] __attribute__((aligned(16)));
+	char B101[24] __attribute__((aligned(16)));
+	char B102[24] __attribute__((aligned(16)));
+	char B103[24] __attribute__((aligned(16)));
+	char B104[24] __attribute__((aligned(16)));
+	char B105[8] __attribute__((aligned(16)));
+	char B106[24] __attribute__((aligned(16)));
+	char B107[24] __attribute__((aligned(16)));
+	char R108[4] __attribute__((aligned(16)));
+	char B109[8] __attribute__((aligned(16)));
+	char B110[24] __attribute__((aligned(16)));
+	char B111[24] __attribute__((aligned(16)));
+	char R112[4] __attribute__((aligned(16)));
+	char B113[8] __attribute__((aligned(16)));
+	char B114[24] __attribute__((aligned(16)));
+	char B115[24] __attribute__((aligned(16)));
+	char R116[4] __attribute__((aligned(16)));
+	char B117[8] __attribute__((aligned(16)));
+	char B118[24] __attribute__((aligned(16)));
+	char B119[24] __attribute__((aligned(16)));
+	char R120[4] __attribute__((aligned(16)));
+	u64 t__2e1002;
+	u64 t__2e1004;
+	u64 t__2e452;
+	u64 t__2e453;
+	u64 t__2e454;
+	u64 t__2e459;
+	u64 t__2e463;
+	u64 t__2e465;
+	u64 t__2e466;
+	u64 t__2e467;
+	u64 t__2e468;
+	u64 t__2e471;
+	u64 t__2e477;
+	u64 t__2e478;
+	u64 t__2e479;
+	u64 t__2e480;
+	u64 t__2e481;
+	u64 t__2e483;
+	u64 t__2e488;
+	u64 t__2e490;
+	u64 t__2e491;
+	u64 t__2e492;
+	u64 t__2e493;
+	u64 t__2e494;
+	u64 t__2e495;
+	u64 t__2e496;
+	u64 t__2e497;
+	u64 t__2e501;
+	u64 t__2e506;
+	u64 t__2e508;
+	u64 t__2e509;
+	u64 t__2e510;
+	u64 t__2e511;
+	u64 t__2e514;
+	u64 t__2e518;
+	u64 t__2e523;
+	u64 t__2e525;
+	u64 t__2e526;
+	u64 t__2e527;
+	u64 t__2e528;
+	u64 t__2e531;
+	u64 t__2e535;
+	u64 t__2e537;
+	u64 t__2e540;
+	u64 t__2e541;
+	u64 t__2e543;
+	u64 t__2e544;
+	u64 t__2e545;
+	u64 t__2e546;
+	u64 t__2e549;
+	u64 t__2e553;
+	u64 t__2e555;
+	u64 t__2e556;
+	u64 t__2e557;
+	u64 t__2e558;
+	u64 t__2e559;
+	u64 t__2e562;
+	u64 t__2e563;
+	u64 t__2e565;
+	u64 t__2e566;
+	u64 t__2e567;
+	u64 t__2e568;
+	u64 t__2e571;
+	u64 t__2e575;
+	u64 t__2e578;
+	u64 t__2e579;
+	u64 t__2e581;
+	u64 t__2e582;
+	u64 t__2e583;
+	u64 t__2e588;
+	u64 t__2e591;
+	u64 t__2e592;
+	u64 t__2e594;
+	u64 t__2e595;
+	u64 t__2e596;
+	u64 t__2e597;
+	u64 t__2e600;
+	u64 t__2e604;
+	u64 t__2e605;
+	u64 t__2e608;
+	u64 t__2e609;
+	u64 t__2e611;
+	u64 t__2e612;
+	u64 t__2e613;
+	u64 t__2e614;
+	u64 t__2e617;
+	u64 t__2e621;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e629;
+	u64 t__2e633;
+	u64 t__2e636;
+	u64 t__2e637;
+	u64 t__2e639;
+	u64 t__2e640;
+	u64 t__2e641;
+	u64 t__2e642;
+	u64 t__2e643;
+	u64 t__2e644;
+	u64 t__2e645;
+	u64 t__2e646;
+	u64 t__2e649;
+	u64 t__2e653;
+	u64 t__2e656;
+	u64 t__2e657;
+	u64 t__2e659;
+	u64 t__2e660;
+	u64 t__2e661;
+	u64 t__2e662;
+	u64 t__2e663;
+	u64 t__2e664;
+	u64 t__2e665;
+	u64 t__2e666;
+	u64 t__2e669;
+	u64 t__2e673;
+	u64 t__2e676;
+	u64 t__2e677;
+	u64 t__2e679;
+	u64 t__2e680;
+	u64 t__2e681;
+	u64 t__2e682;
+	u64 t__2e683;
+	u64 t__2e684;
+	u64 t__2e685;
+	u64 t__2e690;
+	u64 t__2e693;
+	u64 t__2e694;
+	u64 t__2e696;
+	u64 t__2e697;
+	u64 t__2e698;
+	u64 t__2e699;
+	u64 t__2e700;
+	u64 t__2e701;
+	u64 t__2e702;
+	u64 t__2e703;
+	u64 t__2e706;
+	u64 t__2e710;
+	u64 t__2e711;
+	u64 t__2e714;
+	u64 t__2e715;
+	u64 t__2e717;
+	u64 t__2e718;
+	u64 t__2e719;
+	u64 t__2e720;
+	u64 t__2e721;
+	u64 t__2e722;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e727;
+	u64 t__2e731;
+	u64 t__2e735;
+	u64 t__2e737;
+	u64 t__2e738;
+	u64 t__2e739;
+	u64 t__2e740;
+	u64 t__2e741;
+	u64 t__2e742;
+	u64 t__2e743;
+	u64 t__2e748;
+	u64 t__2e752;
+	u64 t__2e754;
+	u64 t__2e755;
+	u64 t__2e756;
+	u64 t__2e757;
+	u64 t__2e758;
+	u64 t__2e759;
+	u64 t__2e760;
+	u64 t__2e761;
+	u64 t__2e764;
+	u64 t__2e768;
+	u64 t__2e772;
+	u64 t__2e774;
+	u64 t__2e775;
+	u64 t__2e776;
+	u64 t__2e777;
+	u64 t__2e778;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e781;
+	u64 t__2e782;
+	u64 t__2e783;
+	u64 t__2e784;
+	u64 t__2e785;
+	u64 t__2e789;
+	u64 t__2e793;
+	u64 t__2e795;
+	u64 t__2e796;
+	u64 t__2e797;
+	u64 t__2e798;
+	u64 t__2e799;
+	u64 t__2e800;
+	u64 t__2e801;
+	u64 t__2e802;
+	u64 t__2e805;
+	u64 t__2e809;
+	u64 t__2e813;
+	u64 t__2e815;
+	u64 t__2e816;
+	u64 t__2e817;
+	u64 t__2e818;
+	u64 t__2e819;
+	u64 t__2e820;
+	u64 t__2e821;
+	u64 t__2e822;
+	u64 t__2e825;
+	u64 t__2e829;
+	u64 t__2e831;
+	u64 t__2e834;
+	u64 t__2e835;
+	u64 t__2e836;
+	u64 t__2e837;
+	u64 t__2e842;
+	u64 t__2e846;
+	u64 t__2e848;
+	u64 t__2e849;
+	u64 t__2e850;
+	u64 t__2e851;
+	u64 t__2e852;
+	u64 t__2e855;
+	u64 t__2e859;
+	u64 t__2e863;
+	u64 t__2e865;
+	u64 t__2e866;
+	u64 t__2e867;
+	u64 t__2e868;
+	u64 t__2e869;
+	u64 t__2e870;
+	u64 t__2e871;
+	u64 t__2e872;
+	u64 t__2e873;
+	u64 t__2e877;
+	u64 t__2e881;
+	u64 t__2e883;
+	u64 t__2e884;
+	u64 t__2e885;
+	u64 t__2e886;
+	u64 t__2e887;
+	u64 t__2e890;
+	u64 t__2e894;
+	u64 t__2e898;
+	u64 t__2e900;
+	u64 t__2e901;
+	u64 t__2e902;
+	u64 t__2e903;
+	u64 t__2e904;
+	u64 t__2e907;
+	u64 t__2e911;
+	u64 t__2e913;
+	u64 t__2e915;
+	u64 t__2e917;
+	u64 t__2e921;
+	u64 t__2e930;
+	u64 t__2e932;
+	u64 t__2e934;
+	u64 t__2e935;
+	u64 t__2e936;
+	u64 t__2e937;
+	u64 t__2e938;
+	u64 t__2e941;
+	u64 t__2e942;
+	u64 t__2e943;
+	u64 t__2e944;
+	u64 t__2e945;
+	u64 t__2e947;
+	u64 t__2e949;
+	u64 t__2e953;
+	u64 t__2e962;
+	u64 t__2e964;
+	u64 t__2e967;
+	u64 t__2e969;
+	u64 t__2e973;
+	u64 t__2e982;
+	u64 t__2e984;
+	u64 t__2e987;
+	u64 t__2e989;
+	u64 t__2e993;
+	u64 t_abortsite_2e475;
+	u64 t_binding_2e448;
+	u64 t_binding_2e622;
+	u64 t_binding_2e732;
+	u64 t_binding_2e832;
+	u64 t_data_2e458;
+	u64 t_data_2e482;
+	u64 t_data_2e500;
+	u64 t_data_2e517;
+	u64 t_data_2e534;
+	u64 t_data_2e552;
+	u64 t_data_2e574;
+	u64 t_data_2e587;
+	u64 t_data_2e603;
+	u64 t_data_2e620;
+	u64 t_data_2e632;
+	u64 t_data_2e652;
+	u64 t_data_2e672;
+	u64 t_data_2e689;
+	u64 t_data_2e709;
+	u64 t_data_2e730;
+	u64 t_data_2e747;
+	u64 t_data_2e767;
+	u64 t_data_2e788;
+	u64 t_data_2e808;
+	u64 t_data_2e828;
+	u64 t_data_2e841;
+	u64 t_data_2e858;
+	u64 t_data_2e876;
+	u64 t_data_2e893;
+	u64 t_data_2e910;
+	u64 t_item_2e450;
+	u64 t_item_2e462;
+	u64 t_item_2e487;
+	u64 t_item_2e505;
+	u64 t_item_2e522;
+	u64 t_item_2e734;
+	u64 t_item_2e751;
+	u64 t_item_2e771;
+	u64 t_item_2e792;
+	u64 t_item_2e812;
+	u64 t_item_2e845;
+	u64 t_item_2e862;
+	u64 t_item_2e880;
+	u64 t_item_2e897;
+	u64 t_object_2e451;
+	u64 t_object_2e460;
+	u64 t_object_2e461;
+	u64 t_object_2e464;
+	u64 t_object_2e484;
+	u64 t_object_2e485;
+	u64 t_object_2e489;
+	u64 t_object_2e502;
+	u64 t_object_2e503;
+	u64 t_object_2e507;
+	u64 t_object_2e519;
+	u64 t_object_2e520;
+	u64 t_object_2e524;
+	u64 t_object_2e536;
+	u64 t_object_2e542;
+	u64 t_object_2e564;
+	u64 t_object_2e580;
+	u64 t_object_2e593;
+	u64 t_object_2e610;
+	u64 t_object_2e638;
+	u64 t_object_2e658;
+	u64 t_object_2e678;
+	u64 t_object_2e695;
+	u64 t_object_2e716;
+	u64 t_object_2e733;
+	u64 t_object_2e736;
+	u64 t_object_2e749;
+	u64 t_object_2e750;
+	u64 t_object_2e753;
+	u64 t_object_2e769;
+	u64 t_object_2e770;
+	u64 t_object_2e773;
+	u64 t_object_2e790;
+	u64 t_object_2e791;
+	u64 t_object_2e794;
+	u64 t_object_2e810;
+	u64 t_object_2e811;
+	u64 t_object_2e814;
+	u64 t_object_2e830;
+	u64 t_object_2e833;
+	u64 t_object_2e843;
+	u64 t_object_2e844;
+	u64 t_object_2e847;
+	u64 t_object_2e860;
+	u64 t_object_2e861;
+	u64 t_object_2e864;
+	u64 t_object_2e878;
+	u64 t_object_2e879;
+	u64 t_object_2e882;
+	u64 t_object_2e895;
+	u64 t_object_2e896;
+	u64 t_object_2e899;
+	u64 t_object_2e912;
+	u64 t_object_2e916;
+	u64 t_object_2e920;
+	u64 t_object_2e948;
+	u64 t_object_2e952;
+	u64 t_object_2e968;
+	u64 t_object_2e972;
+	u64 t_object_2e988;
+	u64 t_object_2e992;
+	u64 t_tag_2e922;
+	u64 t_tag_2e954;
+	u64 t_tag_2e974;
+	u64 t_tag_2e994;
+	L_start_2e444:;
+	t_binding_2e448 = (u64)A0;
+	t_object_2e451 = (u64)A1;
+	t_object_2e460 = (u64)A2;
+	t_object_2e461 = (u64)A3;
+	t_object_2e464 = (u64)A4;
+	t_object_2e484 = (u64)A5;
+	t_object_2e485 = (u64)A6;
+	t_object_2e489 = (u64)A7;
+	t_object_2e502 = (u64)A8;
+	t_object_2e503 = (u64)A9;
+	t_object_2e507 = (u64)A10;
+	t_object_2e519 = (u64)A11;
+	t_object_2e520 = (u64)A12;
+	t_object_2e524 = (u64)A13;
+	t_object_2e536 = (u64)A14;
+	t_object_2e542 = (u64)A15;
+	t_object_2e564 = (u64)A16;
+	t_object_2e580 = (u64)A17;
+	t_object_2e593 = (u64)A18;
+	t_object_2e610 = (u64)A19;
+	t_binding_2e622 = (u64)A20;
+	t_object_2e638 = (u64)A21;
+	t_object_2e658 = (u64)A22;
+	t_object_2e678 = (u64)A23;
+	t_object_2e695 = (u64)A24;
+	t_object_2e716 = (u64)A25;
+	t_binding_2e732 = (u64)A26;
+	t_object_2e733 = (u64)A27;
+	t_object_2e736 = (u64)A28;
+	t_object_2e749 = (u64)A29;
+	t_object_2e750 = (u64)A30;
+	t_object_2e753 = (u64)A31;
+	t_object_2e769 = (u64)A32;
+	t_object_2e770 = (u64)A33;
+	t_object_2e773 = (u64)A34;
+	t_object_2e790 = (u64)A35;
+	t_object_2e791 = (u64)A36;
+	t_object_2e794 = (u64)A37;
+	t_object_2e810 = (u64)A38;
+	t_object_2e811 = (u64)A39;
+	t_object_2e814 = (u64)A40;
+	t_object_2e830 = (u64)A41;
+	t_binding_2e832 = (u64)A42;
+	t_object_2e833 = (u64)A43;
+	t_object_2e843 = (u64)A44;
+	t_object_2e844 = (u64)A45;
+	t_object_2e847 = (u64)A46;
+	t_object_2e860 = (u64)A47;
+	t_object_2e861 = (u64)A48;
+	t_object_2e864 = (u64)A49;
+	t_object_2e878 = (u64)A50;
+	t_object_2e879 = (u64)A51;
+	t_object_2e882 = (u64)A52;
+	t_object_2e895 = (u64)A53;
+	t_object_2e896 = (u64)A54;
+	t_object_2e899 = (u64)A55;
+	t_object_2e912 = (u64)A56;
+	t_object_2e916 = (u64)A57;
+	t_object_2e920 = (u64)A58;
+	t_object_2e948 = (u64)A59;
+	t_object_2e952 = (u64)A60;
+	t_object_2e968 = (u64)A61;
+	t_object_2e972 = (u64)A62;
+	t_object_2e988 = (u64)A63;
+	t_object_2e992 = (u64)A64;
+	L_body_2e445:;
+	t_item_2e450 = (u64)((u64)t_binding_2e448 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e450 = (u32)((u64)1UL);
+	t_item_2e450 = (u64)((u64)t_binding_2e448 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e450 = (u32)((u64)2UL);
+	t_item_2e450 = (u64)((u64)t_binding_2e448 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e450 = (u32)((u64)3UL);
+	t_item_2e450 = (u64)((u64)t_binding_2e448 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e450 = (u32)((u64)4UL);
+	t_item_2e450 = (u64)((u64)t_binding_2e448 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e450 = (u32)((u64)5UL);
+	t__2e452 = t_binding_2e448;
+	t__2e453 = (u64)((u64)((u64)5UL) - (u64)((u64)0UL));
+	t__2e453 = ((u64)5UL);
+	t__2e454 = ((u64)5UL);
+	t_data_2e458 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e458 = (u64)((u64)t__2e452 + (u64)t_data_2e458);
+	*(u64 *)t_object_2e451 = (u64)t_data_2e458;
+	t__2e459 = (u64)((u64)t_object_2e451 + (u64)((u64)8UL));
+	*(u64 *)t__2e459 = (u64)t__2e453;
+	t__2e459 = (u64)((u64)t_object_2e451 + (u64)((u64)16UL));
+	*(u64 *)t__2e459 = (u64)t__2e454;
+	t_item_2e462 = (u64)((u64)t_object_2e461 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e462 = (u32)((u64)1UL);
+	t_item_2e462 = (u64)((u64)t_object_2e461 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e462 = (u32)((u64)2UL);
+	t_item_2e462 = (u64)((u64)t_object_2e461 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e462 = (u32)((u64)3UL);
+	t_item_2e462 = (u64)((u64)t_object_2e461 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e462 = (u32)((u64)4UL);
+	t_item_2e462 = (u64)((u64)t_object_2e461 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e462 = (u32)((u64)5UL);
+	*(u64 *)t_object_2e460 = (u64)t_object_2e461;
+	t__2e463 = (u64)((u64)t_object_2e460 + (u64)((u64)8UL));
+	*(u64 *)t__2e463 = (u64)((u64)5UL);
+	t__2e463 = (u64)((u64)t__2e463 + (u64)((u64)8UL));
+	*(u64 *)t__2e463 = (u64)((u64)5UL);
+	BLIT((u64)B65, t_object_2e451, 24);
+	BLIT((u64)B66, t_object_2e460, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B65, (u64)B66);
+	t__2e465 = t_binding_2e448;
+	t__2e466 = (u64)((i64)(i32)((u64)3UL));
+	t__2e467 = (u64)((u64)t__2e466 - (u64)((u64)0UL));
+	t__2e471 = (u64)(u32)(((u64)t__2e466 <= (u64)((u64)5UL)));
+	t__2e467 = t__2e466;
+	t__2e468 = ((u64)5UL);
+	if ((u32)t__2e471) goto L__2e473; else goto L__2e472;
+	L__2e472:;
+	t_abortsite_2e475 = ((u64)0UL);
+	goto L_abort_2e476;
+	L__2e473:;
+	t_data_2e482 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e482 = (u64)((u64)t__2e465 + (u64)t_data_2e482);
+	*(u64 *)t_object_2e464 = (u64)t_data_2e482;
+	t__2e483 = (u64)((u64)t_object_2e464 + (u64)((u64)8UL));
+	*(u64 *)t__2e483 = (u64)t__2e467;
+	t__2e483 = (u64)((u64)t_object_2e464 + (u64)((u64)16UL));
+	*(u64 *)t__2e483 = (u64)t__2e468;
+	t_item_2e487 = (u64)((u64)t_object_2e485 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e487 = (u32)((u64)1UL);
+	t_item_2e487 = (u64)((u64)t_object_2e485 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e487 = (u32)((u64)2UL);
+	t_item_2e487 = (u64)((u64)t_object_2e485 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e487 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e484 = (u64)t_object_2e485;
+	t__2e488 = (u64)((u64)t_object_2e484 + (u64)((u64)8UL));
+	*(u64 *)t__2e488 = (u64)((u64)3UL);
+	t__2e488 = (u64)((u64)t__2e488 + (u64)((u64)8UL));
+	*(u64 *)t__2e488 = (u64)((u64)3UL);
+	BLIT((u64)B67, t_object_2e464, 24);
+	BLIT((u64)B68, t_object_2e484, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B67, (u64)B68);
+	t__2e490 = t_binding_2e448;
+	t__2e491 = (u64)((i64)(i32)((u64)1UL));
+	t__2e492 = (u64)((i64)(i32)((u64)3UL));
+	t__2e493 = (u64)((u64)t__2e492 - (u64)t__2e491);
+	t__2e496 = (u64)(u32)(((u64)t__2e491 <= (u64)t__2e492));
+	t__2e495 = (u64)(u32)(((u64)t__2e492 <= (u64)((u64)5UL)));
+	t__2e497 = (u64)(u32)((u32)t__2e496 & (u32)t__2e495);
+	t__2e493 = (u64)((u64)t__2e492 - (u64)t__2e491);
+	t__2e494 = (u64)((u64)((u64)5UL) - (u64)t__2e491);
+	if ((u32)t__2e497) goto L__2e499; else goto L__2e498;
+	L__2e498:;
+	t_abortsite_2e475 = ((u64)1UL);
+	goto L_abort_2e476;
+	L__2e499:;
+	t_data_2e500 = (u64)((u64)t__2e491 * (u64)((u64)4UL));
+	t_data_2e500 = (u64)((u64)t__2e490 + (u64)t_data_2e500);
+	*(u64 *)t_object_2e489 = (u64)t_data_2e500;
+	t__2e501 = (u64)((u64)t_object_2e489 + (u64)((u64)8UL));
+	*(u64 *)t__2e501 = (u64)t__2e493;
+	t__2e501 = (u64)((u64)t_object_2e489 + (u64)((u64)16UL));
+	*(u64 *)t__2e501 = (u64)t__2e494;
+	t_item_2e505 = (u64)((u64)t_object_2e503 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e505 = (u32)((u64)2UL);
+	t_item_2e505 = (u64)((u64)t_object_2e503 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e505 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e502 = (u64)t_object_2e503;
+	t__2e506 = (u64)((u64)t_object_2e502 + (u64)((u64)8UL));
+	*(u64 *)t__2e506 = (u64)((u64)2UL);
+	t__2e506 = (u64)((u64)t__2e506 + (u64)((u64)8UL));
+	*(u64 *)t__2e506 = (u64)((u64)2UL);
+	BLIT((u64)B69, t_object_2e489, 24);
+	BLIT((u64)B70, t_object_2e502, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B69, (u64)B70);
+	t__2e508 = t_binding_2e448;
+	t__2e509 = (u64)((i64)(i32)((u64)1UL));
+	t__2e510 = (u64)((u64)((u64)5UL) - (u64)t__2e509);
+	t__2e514 = (u64)(u32)(((u64)t__2e509 <= (u64)((u64)5UL)));
+	t__2e510 = (u64)((u64)((u64)5UL) - (u64)t__2e509);
+	t__2e511 = (u64)((u64)((u64)5UL) - (u64)t__2e509);
+	if ((u32)t__2e514) goto L__2e516; else goto L__2e515;
+	L__2e515:;
+	t_abortsite_2e475 = ((u64)2UL);
+	goto L_abort_2e476;
+	L__2e516:;
+	t_data_2e517 = (u64)((u64)t__2e509 * (u64)((u64)4UL));
+	t_data_2e517 = (u64)((u64)t__2e508 + (u64)t_data_2e517);
+	*(u64 *)t_object_2e507 = (u64)t_data_2e517;
+	t__2e518 = (u64)((u64)t_object_2e507 + (u64)((u64)8UL));
+	*(u64 *)t__2e518 = (u64)t__2e510;
+	t__2e518 = (u64)((u64)t_object_2e507 + (u64)((u64)16UL));
+	*(u64 *)t__2e518 = (u64)t__2e511;
+	t_item_2e522 = (u64)((u64)t_object_2e520 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e522 = (u32)((u64)2UL);
+	t_item_2e522 = (u64)((u64)t_object_2e520 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e522 = (u32)((u64)3UL);
+	t_item_2e522 = (u64)((u64)t_object_2e520 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e522 = (u32)((u64)4UL);
+	t_item_2e522 = (u64)((u64)t_object_2e520 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e522 = (u32)((u64)5UL);
+	*(u64 *)t_object_2e519 = (u64)t_object_2e520;
+	t__2e523 = (u64)((u64)t_object_2e519 + (u64)((u64)8UL));
+	*(u64 *)t__2e523 = (u64)((u64)4UL);
+	t__2e523 = (u64)((u64)t__2e523 + (u64)((u64)8UL));
+	*(u64 *)t__2e523 = (u64)((u64)4UL);
+	BLIT((u64)B71, t_object_2e507, 24);
+	BLIT((u64)B72, t_object_2e519, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B71, (u64)B72);
+	t__2e525 = t_binding_2e448;
+	t__2e526 = (u64)((i64)(i32)((u64)5UL));
+	t__2e527 = (u64)((u64)((u64)5UL) - (u64)t__2e526);
+	t__2e531 = (u64)(u32)(((u64)t__2e526 <= (u64)((u64)5UL)));
+	t__2e527 = (u64)((u64)((u64)5UL) - (u64)t__2e526);
+	t__2e528 = (u64)((u64)((u64)5UL) - (u64)t__2e526);
+	if ((u32)t__2e531) goto L__2e533; else goto L__2e532;
+	L__2e532:;
+	t_abortsite_2e475 = ((u64)3UL);
+	goto L_abort_2e476;
+	L__2e533:;
+	t_data_2e534 = (u64)((u64)t__2e526 * (u64)((u64)4UL));
+	t_data_2e534 = (u64)((u64)t__2e525 + (u64)t_data_2e534);
+	*(u64 *)t_object_2e524 = (u64)t_data_2e534;
+	t__2e535 = (u64)((u64)t_object_2e524 + (u64)((u64)8UL));
+	*(u64 *)t__2e535 = (u64)t__2e527;
+	t__2e535 = (u64)((u64)t_object_2e524 + (u64)((u64)16UL));
+	*(u64 *)t__2e535 = (u64)t__2e528;
+	*(u64 *)t_object_2e536 = (u64)((u64)0UL);
+	t__2e537 = (u64)((u64)t_object_2e536 + (u64)((u64)8UL));
+	*(u64 *)t__2e537 = (u64)((u64)0UL);
+	t__2e537 = (u64)((u64)t__2e537 + (u64)((u64)8UL));
+	*(u64 *)t__2e537 = (u64)((u64)0UL);
+	BLIT((u64)B73, t_object_2e524, 24);
+	BLIT((u64)B74, t_object_2e536, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B73, (u64)B74);
+	t__2e543 = t_binding_2e448;
+	t__2e544 = (u64)((i64)(i32)((u64)0UL));
+	t__2e545 = (u64)((u64)t__2e544 - (u64)((u64)0UL));
+	t__2e549 = (u64)(u32)(((u64)t__2e544 <= (u64)((u64)5UL)));
+	t__2e545 = t__2e544;
+	t__2e546 = ((u64)5UL);
+	if ((u32)t__2e549) goto L__2e551; else goto L__2e550;
+	L__2e550:;
+	t_abortsite_2e475 = ((u64)4UL);
+	goto L_abort_2e476;
+	L__2e551:;
+	t_data_2e552 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e552 = (u64)((u64)t__2e543 + (u64)t_data_2e552);
+	*(u64 *)t_object_2e542 = (u64)t_data_2e552;
+	t__2e553 = (u64)((u64)t_object_2e542 + (u64)((u64)8UL));
+	*(u64 *)t__2e553 = (u64)t__2e545;
+	t__2e553 = (u64)((u64)t_object_2e542 + (u64)((u64)16UL));
+	*(u64 *)t__2e553 = (u64)t__2e546;
+	BLIT((u64)B75, t_object_2e542, 24);
+	t__2e541 = (u64)(((u64 (*)(u64))((u64)((char *)&F_cap)))((u64)B75));
+	t__2e540 = (u64)(u32)(((u64)t__2e541 == (u64)((u64)5UL)));
+	if ((u32)t__2e540) goto L_passed_2e539; else goto L_failed_2e538;
+	L_failed_2e538:;
+	t_abortsite_2e475 = ((u64)5UL);
+	goto L_abort_2e554;
+	L_passed_2e539:;
+	t__2e565 = t_binding_2e448;
+	t__2e566 = (u64)((i64)(i32)((u64)2UL));
+	t__2e567 = (u64)((u64)t__2e566 - (u64)((u64)0UL));
+	t__2e571 = (u64)(u32)(((u64)t__2e566 <= (u64)((u64)5UL)));
+	t__2e567 = t__2e566;
+	t__2e568 = ((u64)5UL);
+	if ((u32)t__2e571) goto L__2e573; else goto L__2e572;
+	L__2e572:;
+	t_abortsite_2e475 = ((u64)6UL);
+	goto L_abort_2e476;
+	L__2e573:;
+	t_data_2e574 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e574 = (u64)((u64)t__2e565 + (u64)t_data_2e574);
+	*(u64 *)t_object_2e564 = (u64)t_data_2e574;
+	t__2e575 = (u64)((u64)t_object_2e564 + (u64)((u64)8UL));
+	*(u64 *)t__2e575 = (u64)t__2e567;
+	t__2e575 = (u64)((u64)t_object_2e564 + (u64)((u64)16UL));
+	*(u64 *)t__2e575 = (u64)t__2e568;
+	BLIT((u64)B76, t_object_2e564, 24);
+	t__2e563 = (u64)(((u64 (*)(u64))((u64)((char *)&F_cap)))((u64)B76));
+	t__2e562 = (u64)(u32)(((u64)t__2e563 == (u64)((u64)5UL)));
+	if ((u32)t__2e562) goto L_passed_2e561; else goto L_failed_2e560;
+	L_failed_2e560:;
+	t_abortsite_2e475 = ((u64)7UL);
+	goto L_abort_2e554;
+	L_passed_2e561:;
+	t__2e581 = t_binding_2e448;
+	t__2e582 = (u64)((u64)((u64)5UL) - (u64)((u64)0UL));
+	t__2e582 = ((u64)5UL);
+	t__2e583 = ((u64)5UL);
+	t_data_2e587 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e587 = (u64)((u64)t__2e581 + (u64)t_data_2e587);
+	*(u64 *)t_object_2e580 = (u64)t_data_2e587;
+	t__2e588 = (u64)((u64)t_object_2e580 + (u64)((u64)8UL));
+	*(u64 *)t__2e588 = (u64)t__2e582;
+	t__2e588 = (u64)((u64)t_object_2e580 + (u64)((u64)16UL));
+	*(u64 *)t__2e588 = (u64)t__2e583;
+	BLIT((u64)B77, t_object_2e580, 24);
+	t__2e579 = (u64)(((u64 (*)(u64))((u64)((char *)&F_cap)))((u64)B77));
+	t__2e578 = (u64)(u32)(((u64)t__2e579 == (u64)((u64)5UL)));
+	if ((u32)t__2e578) goto L_passed_2e577; else goto L_failed_2e576;
+	L_failed_2e576:;
+	t_abortsite_2e475 = ((u64)8UL);
+	goto L_abort_2e554;
+	L_passed_2e577:;
+	t__2e594 = t_binding_2e448;
+	t__2e595 = (u64)((i64)(i32)((u64)2UL));
+	t__2e596 = (u64)((u64)((u64)5UL) - (u64)t__2e595);
+	t__2e600 = (u64)(u32)(((u64)t__2e595 <= (u64)((u64)5UL)));
+	t__2e596 = (u64)((u64)((u64)5UL) - (u64)t__2e595);
+	t__2e597 = (u64)((u64)((u64)5UL) - (u64)t__2e595);
+	if ((u32)t__2e600) goto L__2e602; else goto L__2e601;
+	L__2e601:;
+	t_abortsite_2e475 = ((u64)9UL);
+	goto L_abort_2e476;
+	L__2e602:;
+	t_data_2e603 = (u64)((u64)t__2e595 * (u64)((u64)4UL));
+	t_data_2e603 = (u64)((u64)t__2e594 + (u64)t_data_2e603);
+	*(u64 *)t_object_2e593 = (u64)t_data_2e603;
+	t__2e604 = (u64)((u64)t_object_2e593 + (u64)((u64)8UL));
+	*(u64 *)t__2e604 = (u64)t__2e596;
+	t__2e604 = (u64)((u64)t_object_2e593 + (u64)((u64)16UL));
+	*(u64 *)t__2e604 = (u64)t__2e597;
+	BLIT((u64)B78, t_object_2e593, 24);
+	t__2e592 = (u64)(((u64 (*)(u64))((u64)((char *)&F_cap)))((u64)B78));
+	t__2e605 = (u64)((u64)((u64)5UL) - (u64)((u64)2UL));
+	t__2e591 = (u64)(u32)(((u64)t__2e592 == (u64)t__2e605));
+	if ((u32)t__2e591) goto L_passed_2e590; else goto L_failed_2e589;
+	L_failed_2e589:;
+	t_abortsite_2e475 = ((u64)10UL);
+	goto L_abort_2e554;
+	L_passed_2e590:;
+	t__2e611 = t_binding_2e448;
+	t__2e612 = (u64)((i64)(i32)((u64)5UL));
+	t__2e613 = (u64)((u64)((u64)5UL) - (u64)t__2e612);
+	t__2e617 = (u64)(u32)(((u64)t__2e612 <= (u64)((u64)5UL)));
+	t__2e613 = (u64)((u64)((u64)5UL) - (u64)t__2e612);
+	t__2e614 = (u64)((u64)((u64)5UL) - (u64)t__2e612);
+	if ((u32)t__2e617) goto L__2e619; else goto L__2e618;
+	L__2e618:;
+	t_abortsite_2e475 = ((u64)11UL);
+	goto L_abort_2e476;
+	L__2e619:;
+	t_data_2e620 = (u64)((u64)t__2e612 * (u64)((u64)4UL));
+	t_data_2e620 = (u64)((u64)t__2e611 + (u64)t_data_2e620);
+	*(u64 *)t_object_2e610 = (u64)t_data_2e620;
+	t__2e621 = (u64)((u64)t_object_2e610 + (u64)((u64)8UL));
+	*(u64 *)t__2e621 = (u64)t__2e613;
+	t__2e621 = (u64)((u64)t_object_2e610 + (u64)((u64)16UL));
+	*(u64 *)t__2e621 = (u64)t__2e614;
+	BLIT((u64)B79, t_object_2e610, 24);
+	t__2e609 = (u64)(((u64 (*)(u64))((u64)((char *)&F_cap)))((u64)B79));
+	t__2e608 = (u64)(u32)(((u64)t__2e609 == (u64)((u64)0UL)));
+	if ((u32)t__2e608) goto L_passed_2e607; else goto L_failed_2e606;
+	L_failed_2e606:;
+	t_abortsite_2e475 = ((u64)12UL);
+	goto L_abort_2e554;
+	L_passed_2e607:;
+	t__2e623 = t_binding_2e448;
+	t__2e624 = (u64)((i64)(i32)((u64)3UL));
+	t__2e625 = (u64)((u64)t__2e624 - (u64)((u64)0UL));
+	t__2e629 = (u64)(u32)(((u64)t__2e624 <= (u64)((u64)5UL)));
+	t__2e625 = t__2e624;
+	t__2e626 = ((u64)5UL);
+	if ((u32)t__2e629) goto L__2e631; else goto L__2e630;
+	L__2e630:;
+	t_abortsite_2e475 = ((u64)13UL);
+	goto L_abort_2e476;
+	L__2e631:;
+	t_data_2e632 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e632 = (u64)((u64)t__2e623 + (u64)t_data_2e632);
+	*(u64 *)t_binding_2e622 = (u64)t_data_2e632;
+	t__2e633 = (u64)((u64)t_binding_2e622 + (u64)((u64)8UL));
+	*(u64 *)t__2e633 = (u64)t__2e625;
+	t__2e633 = (u64)((u64)t_binding_2e622 + (u64)((u64)16UL));
+	*(u64 *)t__2e633 = (u64)t__2e626;
+	t__2e639 = (u64)((u64)t_binding_2e622 + (u64)((u64)8UL));
+	t__2e640 = (u64)((u64)t_binding_2e622 + (u64)((u64)16UL));
+	t__2e641 = (u64)(*(u64 *)t_binding_2e622);
+	t__2e642 = (u64)(*(u64 *)t__2e639);
+	t__2e643 = (u64)(*(u64 *)t__2e640);
+	t__2e644 = (u64)((i64)(i32)((u64)0UL));
+	t__2e645 = (u64)((u64)t__2e644 - (u64)((u64)0UL));
+	t__2e649 = (u64)(u32)(((u64)t__2e644 <= (u64)t__2e642));
+	t__2e645 = t__2e644;
+	t__2e646 = t__2e643;
+	if ((u32)t__2e649) goto L__2e651; else goto L__2e650;
+	L__2e650:;
+	t_abortsite_2e475 = ((u64)14UL);
+	goto L_abort_2e476;
+	L__2e651:;
+	t_data_2e652 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e652 = (u64)((u64)t__2e641 + (u64)t_data_2e652);
+	*(u64 *)t_object_2e638 = (u64)t_data_2e652;
+	t__2e653 = (u64)((u64)t_object_2e638 + (u64)((u64)8UL));
+	*(u64 *)t__2e653 = (u64)t__2e645;
+	t__2e653 = (u64)((u64)t_object_2e638 + (u64)((u64)16UL));
+	*(u64 *)t__2e653 = (u64)t__2e646;
+	BLIT((u64)B80, t_object_2e638, 24);
+	t__2e637 = (u64)(((u64 (*)(u64))((u64)((char *)&F_cap)))((u64)B80));
+	t__2e636 = (u64)(u32)(((u64)t__2e637 == (u64)((u64)5UL)));
+	if ((u32)t__2e636) goto L_passed_2e635; else goto L_failed_2e634;
+	L_failed_2e634:;
+	t_abortsite_2e475 = ((u64)15UL);
+	goto L_abort_2e554;
+	L_passed_2e635:;
+	t__2e659 = (u64)((u64)t_binding_2e622 + (u64)((u64)8UL));
+	t__2e660 = (u64)((u64)t_binding_2e622 + (u64)((u64)16UL));
+	t__2e661 = (u64)(*(u64 *)t_binding_2e622);
+	t__2e662 = (u64)(*(u64 *)t__2e659);
+	t__2e663 = (u64)(*(u64 *)t__2e660);
+	t__2e664 = (u64)((i64)(i32)((u64)2UL));
+	t__2e665 = (u64)((u64)t__2e664 - (u64)((u64)0UL));
+	t__2e669 = (u64)(u32)(((u64)t__2e664 <= (u64)t__2e662));
+	t__2e665 = t__2e664;
+	t__2e666 = t__2e663;
+	if ((u32)t__2e669) goto L__2e671; else goto L__2e670;
+	L__2e670:;
+	t_abortsite_2e475 = ((u64)16UL);
+	goto L_abort_2e476;
+	L__2e671:;
+	t_data_2e672 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e672 = (u64)((u64)t__2e661 + (u64)t_data_2e672);
+	*(u64 *)t_object_2e658 = (u64)t_data_2e672;
+	t__2e673 = (u64)((u64)t_object_2e658 + (u64)((u64)8UL));
+	*(u64 *)t__2e673 = (u64)t__2e665;
+	t__2e673 = (u64)((u64)t_object_2e658 + (u64)((u64)16UL));
+	*(u64 *)t__2e673 = (u64)t__2e666;
+	BLIT((u64)B81, t_object_2e658, 24);
+	t__2e657 = (u64)(((u64 (*)(u64))((u64)((char *)&F_cap)))((u64)B81));
+	t__2e656 = (u64)(u32)(((u64)t__2e657 == (u64)((u64)5UL)));
+	if ((u32)t__2e656) goto L_passed_2e655; else goto L_failed_2e654;
+	L_failed_2e654:;
+	t_abortsite_2e475 = ((u64)17UL);
+	goto L_abort_2e554;
+	L_passed_2e655:;
+	t__2e679 = (u64)((u64)t_binding_2e622 + (u64)((u64)8UL));
+	t__2e680 = (u64)((u64)t_binding_2e622 + (u64)((u64)16UL));
+	t__2e681 = (u64)(*(u64 *)t_binding_2e622);
+	t__2e682 = (u64)(*(u64 *)t__2e679);
+	t__2e683 = (u64)(*(u64 *)t__2e680);
+	t__2e684 = (u64)((u64)t__2e682 - (u64)((u64)0UL));
+	t__2e684 = t__2e682;
+	t__2e685 = t__2e683;
+	t_data_2e689 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e689 = (u64)((u64)t__2e681 + (u64)t_data_2e689);
+	*(u64 *)t_object_2e678 = (u64)t_data_2e689;
+	t__2e690 = (u64)((u64)t_object_2e678 + (u64)((u64)8UL));
+	*(u64 *)t__2e690 = (u64)t__2e684;
+	t__2e690 = (u64)((u64)t_object_2e678 + (u64)((u64)16UL));
+	*(u64 *)t__2e690 = (u64)t__2e685;
+	BLIT((u64)B82, t_object_2e678, 24);
+	t__2e677 = (u64)(((u64 (*)(u64))((u64)((char *)&F_cap)))((u64)B82));
+	t__2e676 = (u64)(u32)(((u64)t__2e677 == (u64)((u64)5UL)));
+	if ((u32)t__2e676) goto L_passed_2e675; else goto L_failed_2e674;
+	L_failed_2e674:;
+	t_abortsite_2e475 = ((u64)18UL);
+	goto L_abort_2e554;
+	L_passed_2e675:;
+	t__2e696 = (u64)((u64)t_binding_2e622 + (u64)((u64)8UL));
+	t__2e697 = (u64)((u64)t_binding_2e622 + (u64)((u64)16UL));
+	t__2e698 = (u64)(*(u64 *)t_binding_2e622);
+	t__2e699 = (u64)(*(u64 *)t__2e696);
+	t__2e700 = (u64)(*(u64 *)t__2e697);
+	t__2e701 = (u64)((i64)(i32)((u64)2UL));
+	t__2e702 = (u64)((u64)t__2e699 - (u64)t__2e701);
+	t__2e706 = (u64)(u32)(((u64)t__2e701 <= (u64)t__2e699));
+	t__2e702 = (u64)((u64)t__2e699 - (u64)t__2e701);
+	t__2e703 = (u64)((u64)t__2e700 - (u64)t__2e701);
+	if ((u32)t__2e706) goto L__2e708; else goto L__2e707;
+	L__2e707:;
+	t_abortsite_2e475 = ((u64)19UL);
+	goto L_abort_2e476;
+	L__2e708:;
+	t_data_2e709 = (u64)((u64)t__2e701 * (u64)((u64)4UL));
+	t_data_2e709 = (u64)((u64)t__2e698 + (u64)t_data_2e709);
+	*(u64 *)t_object_2e695 = (u64)t_data_2e709;
+	t__2e710 = (u64)((u64)t_object_2e695 + (u64)((u64)8UL));
+	*(u64 *)t__2e710 = (u64)t__2e702;
+	t__2e710 = (u64)((u64)t_object_2e695 + (u64)((u64)16UL));
+	*(u64 *)t__2e710 = (u64)t__2e703;
+	BLIT((u64)B83, t_object_2e695, 24);
+	t__2e694 = (u64)(((u64 (*)(u64))((u64)((char *)&F_cap)))((u64)B83));
+	t__2e711 = (u64)((u64)((u64)5UL) - (u64)((u64)2UL));
+	t__2e693 = (u64)(u32)(((u64)t__2e694 == (u64)t__2e711));
+	if ((u32)t__2e693) goto L_passed_2e692; else goto L_failed_2e691;
+	L_failed_2e691:;
+	t_abortsite_2e475 = ((u64)20UL);
+	goto L_abort_2e554;
+	L_passed_2e692:;
+	t__2e717 = (u64)((u64)t_binding_2e622 + (u64)((u64)8UL));
+	t__2e718 = (u64)((u64)t_binding_2e622 + (u64)((u64)16UL));
+	t__2e719 = (u64)(*(u64 *)t_binding_2e622);
+	t__2e720 = (u64)(*(u64 *)t__2e717);
+	t__2e721 = (u64)(*(u64 *)t__2e718);
+	t__2e722 = (u64)((i64)(i32)((u64)3UL));
+	t__2e723 = (u64)((u64)t__2e720 - (u64)t__2e722);
+	t__2e727 = (u64)(u32)(((u64)t__2e722 <= (u64)t__2e720));
+	t__2e723 = (u64)((u64)t__2e720 - (u64)t__2e722);
+	t__2e724 = (u64)((u64)t__2e721 - (u64)t__2e722);
+	if ((u32)t__2e727) goto L__2e729; else goto L__2e728;
+	L__2e728:;
+	t_abortsite_2e475 = ((u64)21UL);
+	goto L_abort_2e476;
+	L__2e729:;
+	t_data_2e730 = (u64)((u64)t__2e722 * (u64)((u64)4UL));
+	t_data_2e730 = (u64)((u64)t__2e719 + (u64)t_data_2e730);
+	*(u64 *)t_object_2e716 = (u64)t_data_2e730;
+	t__2e731 = (u64)((u64)t_object_2e716 + (u64)((u64)8UL));
+	*(u64 *)t__2e731 = (u64)t__2e723;
+	t__2e731 = (u64)((u64)t_object_2e716 + (u64)((u64)16UL));
+	*(u64 *)t__2e731 = (u64)t__2e724;
+	BLIT((u64)B84, t_object_2e716, 24);
+	t__2e715 = (u64)(((u64 (*)(u64))((u64)((char *)&F_cap)))((u64)B84));
+	t__2e714 = (u64)(u32)(((u64)t__2e715 == (u64)((u64)2UL)));
+	if ((u32)t__2e714) goto L_passed_2e713; else goto L_failed_2e712;
+	L_failed_2e712:;
+	t_abortsite_2e475 = ((u64)22UL);
+	goto L_abort_2e554;
+	L_passed_2e713:;
+	t_item_2e734 = (u64)((u64)t_object_2e733 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e734 = (u32)((u64)1UL);
+	t_item_2e734 = (u64)((u64)t_object_2e733 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e734 = (u32)((u64)2UL);
+	t_item_2e734 = (u64)((u64)t_object_2e733 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e734 = (u32)((u64)3UL);
+	t_item_2e734 = (u64)((u64)t_object_2e733 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e734 = (u32)((u64)4UL);
+	t_item_2e734 = (u64)((u64)t_object_2e733 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e734 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e732 = (u64)t_object_2e733;
+	t__2e735 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	*(u64 *)t__2e735 = (u64)((u64)5UL);
+	t__2e735 = (u64)((u64)t__2e735 + (u64)((u64)8UL));
+	*(u64 *)t__2e735 = (u64)((u64)5UL);
+	t__2e737 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	t__2e738 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	t__2e739 = (u64)(*(u64 *)t_binding_2e732);
+	t__2e740 = (u64)(*(u64 *)t__2e737);
+	t__2e741 = (u64)(*(u64 *)t__2e738);
+	t__2e742 = (u64)((u64)t__2e740 - (u64)((u64)0UL));
+	t__2e742 = t__2e740;
+	t__2e743 = t__2e741;
+	t_data_2e747 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e747 = (u64)((u64)t__2e739 + (u64)t_data_2e747);
+	*(u64 *)t_object_2e736 = (u64)t_data_2e747;
+	t__2e748 = (u64)((u64)t_object_2e736 + (u64)((u64)8UL));
+	*(u64 *)t__2e748 = (u64)t__2e742;
+	t__2e748 = (u64)((u64)t_object_2e736 + (u64)((u64)16UL));
+	*(u64 *)t__2e748 = (u64)t__2e743;
+	t_item_2e751 = (u64)((u64)t_object_2e750 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)1UL);
+	t_item_2e751 = (u64)((u64)t_object_2e750 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)2UL);
+	t_item_2e751 = (u64)((u64)t_object_2e750 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)3UL);
+	t_item_2e751 = (u64)((u64)t_object_2e750 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)4UL);
+	t_item_2e751 = (u64)((u64)t_object_2e750 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e751 = (u32)((u64)5UL);
+	*(u64 *)t_object_2e749 = (u64)t_object_2e750;
+	t__2e752 = (u64)((u64)t_object_2e749 + (u64)((u64)8UL));
+	*(u64 *)t__2e752 = (u64)((u64)5UL);
+	t__2e752 = (u64)((u64)t__2e752 + (u64)((u64)8UL));
+	*(u64 *)t__2e752 = (u64)((u64)5UL);
+	BLIT((u64)B85, t_object_2e736, 24);
+	BLIT((u64)B86, t_object_2e749, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B85, (u64)B86);
+	t__2e754 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	t__2e755 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	t__2e756 = (u64)(*(u64 *)t_binding_2e732);
+	t__2e757 = (u64)(*(u64 *)t__2e754);
+	t__2e758 = (u64)(*(u64 *)t__2e755);
+	t__2e759 = (u64)((i64)(i32)((u64)3UL));
+	t__2e760 = (u64)((u64)t__2e759 - (u64)((u64)0UL));
+	t__2e764 = (u64)(u32)(((u64)t__2e759 <= (u64)t__2e757));
+	t__2e760 = t__2e759;
+	t__2e761 = t__2e758;
+	if ((u32)t__2e764) goto L__2e766; else goto L__2e765;
+	L__2e765:;
+	t_abortsite_2e475 = ((u64)23UL);
+	goto L_abort_2e476;
+	L__2e766:;
+	t_data_2e767 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e767 = (u64)((u64)t__2e756 + (u64)t_data_2e767);
+	*(u64 *)t_object_2e753 = (u64)t_data_2e767;
+	t__2e768 = (u64)((u64)t_object_2e753 + (u64)((u64)8UL));
+	*(u64 *)t__2e768 = (u64)t__2e760;
+	t__2e768 = (u64)((u64)t_object_2e753 + (u64)((u64)16UL));
+	*(u64 *)t__2e768 = (u64)t__2e761;
+	t_item_2e771 = (u64)((u64)t_object_2e770 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e771 = (u32)((u64)1UL);
+	t_item_2e771 = (u64)((u64)t_object_2e770 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e771 = (u32)((u64)2UL);
+	t_item_2e771 = (u64)((u64)t_object_2e770 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e771 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e769 = (u64)t_object_2e770;
+	t__2e772 = (u64)((u64)t_object_2e769 + (u64)((u64)8UL));
+	*(u64 *)t__2e772 = (u64)((u64)3UL);
+	t__2e772 = (u64)((u64)t__2e772 + (u64)((u64)8UL));
+	*(u64 *)t__2e772 = (u64)((u64)3UL);
+	BLIT((u64)B87, t_object_2e753, 24);
+	BLIT((u64)B88, t_object_2e769, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B87, (u64)B88);
+	t__2e774 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	t__2e775 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	t__2e776 = (u64)(*(u64 *)t_binding_2e732);
+	t__2e777 = (u64)(*(u64 *)t__2e774);
+	t__2e778 = (u64)(*(u64 *)t__2e775);
+	t__2e779 = (u64)((i64)(i32)((u64)1UL));
+	t__2e780 = (u64)((i64)(i32)((u64)3UL));
+	t__2e781 = (u64)((u64)t__2e780 - (u64)t__2e779);
+	t__2e784 = (u64)(u32)(((u64)t__2e779 <= (u64)t__2e780));
+	t__2e783 = (u64)(u32)(((u64)t__2e780 <= (u64)t__2e777));
+	t__2e785 = (u64)(u32)((u32)t__2e784 & (u32)t__2e783);
+	t__2e781 = (u64)((u64)t__2e780 - (u64)t__2e779);
+	t__2e782 = (u64)((u64)t__2e778 - (u64)t__2e779);
+	if ((u32)t__2e785) goto L__2e787; else goto L__2e786;
+	L__2e786:;
+	t_abortsite_2e475 = ((u64)24UL);
+	goto L_abort_2e476;
+	L__2e787:;
+	t_data_2e788 = (u64)((u64)t__2e779 * (u64)((u64)4UL));
+	t_data_2e788 = (u64)((u64)t__2e776 + (u64)t_data_2e788);
+	*(u64 *)t_object_2e773 = (u64)t_data_2e788;
+	t__2e789 = (u64)((u64)t_object_2e773 + (u64)((u64)8UL));
+	*(u64 *)t__2e789 = (u64)t__2e781;
+	t__2e789 = (u64)((u64)t_object_2e773 + (u64)((u64)16UL));
+	*(u64 *)t__2e789 = (u64)t__2e782;
+	t_item_2e792 = (u64)((u64)t_object_2e791 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e792 = (u32)((u64)2UL);
+	t_item_2e792 = (u64)((u64)t_object_2e791 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e792 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e790 = (u64)t_object_2e791;
+	t__2e793 = (u64)((u64)t_object_2e790 + (u64)((u64)8UL));
+	*(u64 *)t__2e793 = (u64)((u64)2UL);
+	t__2e793 = (u64)((u64)t__2e793 + (u64)((u64)8UL));
+	*(u64 *)t__2e793 = (u64)((u64)2UL);
+	BLIT((u64)B89, t_object_2e773, 24);
+	BLIT((u64)B90, t_object_2e790, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B89, (u64)B90);
+	t__2e795 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	t__2e796 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	t__2e797 = (u64)(*(u64 *)t_binding_2e732);
+	t__2e798 = (u64)(*(u64 *)t__2e795);
+	t__2e799 = (u64)(*(u64 *)t__2e796);
+	t__2e800 = (u64)((i64)(i32)((u64)1UL));
+	t__2e801 = (u64)((u64)t__2e798 - (u64)t__2e800);
+	t__2e805 = (u64)(u32)(((u64)t__2e800 <= (u64)t__2e798));
+	t__2e801 = (u64)((u64)t__2e798 - (u64)t__2e800);
+	t__2e802 = (u64)((u64)t__2e799 - (u64)t__2e800);
+	if ((u32)t__2e805) goto L__2e807; else goto L__2e806;
+	L__2e806:;
+	t_abortsite_2e475 = ((u64)25UL);
+	goto L_abort_2e476;
+	L__2e807:;
+	t_data_2e808 = (u64)((u64)t__2e800 * (u64)((u64)4UL));
+	t_data_2e808 = (u64)((u64)t__2e797 + (u64)t_data_2e808);
+	*(u64 *)t_object_2e794 = (u64)t_data_2e808;
+	t__2e809 = (u64)((u64)t_object_2e794 + (u64)((u64)8UL));
+	*(u64 *)t__2e809 = (u64)t__2e801;
+	t__2e809 = (u64)((u64)t_object_2e794 + (u64)((u64)16UL));
+	*(u64 *)t__2e809 = (u64)t__2e802;
+	t_item_2e812 = (u64)((u64)t_object_2e811 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e812 = (u32)((u64)2UL);
+	t_item_2e812 = (u64)((u64)t_object_2e811 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e812 = (u32)((u64)3UL);
+	t_item_2e812 = (u64)((u64)t_object_2e811 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e812 = (u32)((u64)4UL);
+	t_item_2e812 = (u64)((u64)t_object_2e811 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e812 = (u32)((u64)5UL);
+	*(u64 *)t_object_2e810 = (u64)t_object_2e811;
+	t__2e813 = (u64)((u64)t_object_2e810 + (u64)((u64)8UL));
+	*(u64 *)t__2e813 = (u64)((u64)4UL);
+	t__2e813 = (u64)((u64)t__2e813 + (u64)((u64)8UL));
+	*(u64 *)t__2e813 = (u64)((u64)4UL);
+	BLIT((u64)B91, t_object_2e794, 24);
+	BLIT((u64)B92, t_object_2e810, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B91, (u64)B92);
+	t__2e815 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	t__2e816 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	t__2e817 = (u64)(*(u64 *)t_binding_2e732);
+	t__2e818 = (u64)(*(u64 *)t__2e815);
+	t__2e819 = (u64)(*(u64 *)t__2e816);
+	t__2e820 = (u64)((i64)(i32)((u64)5UL));
+	t__2e821 = (u64)((u64)t__2e818 - (u64)t__2e820);
+	t__2e825 = (u64)(u32)(((u64)t__2e820 <= (u64)t__2e818));
+	t__2e821 = (u64)((u64)t__2e818 - (u64)t__2e820);
+	t__2e822 = (u64)((u64)t__2e819 - (u64)t__2e820);
+	if ((u32)t__2e825) goto L__2e827; else goto L__2e826;
+	L__2e826:;
+	t_abortsite_2e475 = ((u64)26UL);
+	goto L_abort_2e476;
+	L__2e827:;
+	t_data_2e828 = (u64)((u64)t__2e820 * (u64)((u64)4UL));
+	t_data_2e828 = (u64)((u64)t__2e817 + (u64)t_data_2e828);
+	*(u64 *)t_object_2e814 = (u64)t_data_2e828;
+	t__2e829 = (u64)((u64)t_object_2e814 + (u64)((u64)8UL));
+	*(u64 *)t__2e829 = (u64)t__2e821;
+	t__2e829 = (u64)((u64)t_object_2e814 + (u64)((u64)16UL));
+	*(u64 *)t__2e829 = (u64)t__2e822;
+	*(u64 *)t_object_2e830 = (u64)((u64)0UL);
+	t__2e831 = (u64)((u64)t_object_2e830 + (u64)((u64)8UL));
+	*(u64 *)t__2e831 = (u64)((u64)0UL);
+	t__2e831 = (u64)((u64)t__2e831 + (u64)((u64)8UL));
+	*(u64 *)t__2e831 = (u64)((u64)0UL);
+	BLIT((u64)B93, t_object_2e814, 24);
+	BLIT((u64)B94, t_object_2e830, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B93, (u64)B94);
+	*(u64 *)t_binding_2e832 = (u64)t_binding_2e448;
+	t__2e834 = (u64)(*(u64 *)t_binding_2e832);
+	t__2e835 = t__2e834;
+	t__2e836 = (u64)((u64)((u64)5UL) - (u64)((u64)0UL));
+	t__2e836 = ((u64)5UL);
+	t__2e837 = ((u64)5UL);
+	t_data_2e841 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e841 = (u64)((u64)t__2e835 + (u64)t_data_2e841);
+	*(u64 *)t_object_2e833 = (u64)t_data_2e841;
+	t__2e842 = (u64)((u64)t_object_2e833 + (u64)((u64)8UL));
+	*(u64 *)t__2e842 = (u64)t__2e836;
+	t__2e842 = (u64)((u64)t_object_2e833 + (u64)((u64)16UL));
+	*(u64 *)t__2e842 = (u64)t__2e837;
+	t_item_2e845 = (u64)((u64)t_object_2e844 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e845 = (u32)((u64)1UL);
+	t_item_2e845 = (u64)((u64)t_object_2e844 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e845 = (u32)((u64)2UL);
+	t_item_2e845 = (u64)((u64)t_object_2e844 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e845 = (u32)((u64)3UL);
+	t_item_2e845 = (u64)((u64)t_object_2e844 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e845 = (u32)((u64)4UL);
+	t_item_2e845 = (u64)((u64)t_object_2e844 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e845 = (u32)((u64)5UL);
+	*(u64 *)t_object_2e843 = (u64)t_object_2e844;
+	t__2e846 = (u64)((u64)t_object_2e843 + (u64)((u64)8UL));
+	*(u64 *)t__2e846 = (u64)((u64)5UL);
+	t__2e846 = (u64)((u64)t__2e846 + (u64)((u64)8UL));
+	*(u64 *)t__2e846 = (u64)((u64)5UL);
+	BLIT((u64)B95, t_object_2e833, 24);
+	BLIT((u64)B96, t_object_2e843, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B95, (u64)B96);
+	t__2e848 = (u64)(*(u64 *)t_binding_2e832);
+	t__2e849 = t__2e848;
+	t__2e850 = (u64)((i64)(i32)((u64)3UL));
+	t__2e851 = (u64)((u64)t__2e850 - (u64)((u64)0UL));
+	t__2e855 = (u64)(u32)(((u64)t__2e850 <= (u64)((u64)5UL)));
+	t__2e851 = t__2e850;
+	t__2e852 = ((u64)5UL);
+	if ((u32)t__2e855) goto L__2e857; else goto L__2e856;
+	L__2e856:;
+	t_abortsite_2e475 = ((u64)27UL);
+	goto L_abort_2e476;
+	L__2e857:;
+	t_data_2e858 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e858 = (u64)((u64)t__2e849 + (u64)t_data_2e858);
+	*(u64 *)t_object_2e847 = (u64)t_data_2e858;
+	t__2e859 = (u64)((u64)t_object_2e847 + (u64)((u64)8UL));
+	*(u64 *)t__2e859 = (u64)t__2e851;
+	t__2e859 = (u64)((u64)t_object_2e847 + (u64)((u64)16UL));
+	*(u64 *)t__2e859 = (u64)t__2e852;
+	t_item_2e862 = (u64)((u64)t_object_2e861 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e862 = (u32)((u64)1UL);
+	t_item_2e862 = (u64)((u64)t_object_2e861 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e862 = (u32)((u64)2UL);
+	t_item_2e862 = (u64)((u64)t_object_2e861 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e862 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e860 = (u64)t_object_2e861;
+	t__2e863 = (u64)((u64)t_object_2e860 + (u64)((u64)8UL));
+	*(u64 *)t__2e863 = (u64)((u64)3UL);
+	t__2e863 = (u64)((u64)t__2e863 + (u64)((u64)8UL));
+	*(u64 *)t__2e863 = (u64)((u64)3UL);
+	BLIT((u64)B97, t_object_2e847, 24);
+	BLIT((u64)B98, t_object_2e860, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B97, (u64)B98);
+	t__2e865 = (u64)(*(u64 *)t_binding_2e832);
+	t__2e866 = t__2e865;
+	t__2e867 = (u64)((i64)(i32)((u64)1UL));
+	t__2e868 = (u64)((i64)(i32)((u64)3UL));
+	t__2e869 = (u64)((u64)t__2e868 - (u64)t__2e867);
+	t__2e872 = (u64)(u32)(((u64)t__2e867 <= (u64)t__2e868));
+	t__2e871 = (u64)(u32)(((u64)t__2e868 <= (u64)((u64)5UL)));
+	t__2e873 = (u64)(u32)((u32)t__2e872 & (u32)t__2e871);
+	t__2e869 = (u64)((u64)t__2e868 - (u64)t__2e867);
+	t__2e870 = (u64)((u64)((u64)5UL) - (u64)t__2e867);
+	if ((u32)t__2e873) goto L__2e875; else goto L__2e874;
+	L__2e874:;
+	t_abortsite_2e475 = ((u64)28UL);
+	goto L_abort_2e476;
+	L__2e875:;
+	t_data_2e876 = (u64)((u64)t__2e867 * (u64)((u64)4UL));
+	t_data_2e876 = (u64)((u64)t__2e866 + (u64)t_data_2e876);
+	*(u64 *)t_object_2e864 = (u64)t_data_2e876;
+	t__2e877 = (u64)((u64)t_object_2e864 + (u64)((u64)8UL));
+	*(u64 *)t__2e877 = (u64)t__2e869;
+	t__2e877 = (u64)((u64)t_object_2e864 + (u64)((u64)16UL));
+	*(u64 *)t__2e877 = (u64)t__2e870;
+	t_item_2e880 = (u64)((u64)t_object_2e879 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e880 = (u32)((u64)2UL);
+	t_item_2e880 = (u64)((u64)t_object_2e879 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e880 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e878 = (u64)t_object_2e879;
+	t__2e881 = (u64)((u64)t_object_2e878 + (u64)((u64)8UL));
+	*(u64 *)t__2e881 = (u64)((u64)2UL);
+	t__2e881 = (u64)((u64)t__2e881 + (u64)((u64)8UL));
+	*(u64 *)t__2e881 = (u64)((u64)2UL);
+	BLIT((u64)B99, t_object_2e864, 24);
+	BLIT((u64)B100, t_object_2e878, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B99, (u64)B100);
+	t__2e883 = (u64)(*(u64 *)t_binding_2e832);
+	t__2e884 = t__2e883;
+	t__2e885 = (u64)((i64)(i32)((u64)1UL));
+	t__2e886 = (u64)((u64)((u64)5UL) - (u64)t__2e885);
+	t__2e890 = (u64)(u32)(((u64)t__2e885 <= (u64)((u64)5UL)));
+	t__2e886 = (u64)((u64)((u64)5UL) - (u64)t__2e885);
+	t__2e887 = (u64)((u64)((u64)5UL) - (u64)t__2e885);
+	if ((u32)t__2e890) goto L__2e892; else goto L__2e891;
+	L__2e891:;
+	t_abortsite_2e475 = ((u64)29UL);
+	goto L_abort_2e476;
+	L__2e892:;
+	t_data_2e893 = (u64)((u64)t__2e885 * (u64)((u64)4UL));
+	t_data_2e893 = (u64)((u64)t__2e884 + (u64)t_data_2e893);
+	*(u64 *)t_object_2e882 = (u64)t_data_2e893;
+	t__2e894 = (u64)((u64)t_object_2e882 + (u64)((u64)8UL));
+	*(u64 *)t__2e894 = (u64)t__2e886;
+	t__2e894 = (u64)((u64)t_object_2e882 + (u64)((u64)16UL));
+	*(u64 *)t__2e894 = (u64)t__2e887;
+	t_item_2e897 = (u64)((u64)t_object_2e896 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e897 = (u32)((u64)2UL);
+	t_item_2e897 = (u64)((u64)t_object_2e896 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e897 = (u32)((u64)3UL);
+	t_item_2e897 = (u64)((u64)t_object_2e896 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e897 = (u32)((u64)4UL);
+	t_item_2e897 = (u64)((u64)t_object_2e896 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e897 = (u32)((u64)5UL);
+	*(u64 *)t_object_2e895 = (u64)t_object_2e896;
+	t__2e898 = (u64)((u64)t_object_2e895 + (u64)((u64)8UL));
+	*(u64 *)t__2e898 = (u64)((u64)4UL);
+	t__2e898 = (u64)((u64)t__2e898 + (u64)((u64)8UL));
+	*(u64 *)t__2e898 = (u64)((u64)4UL);
+	BLIT((u64)B101, t_object_2e882, 24);
+	BLIT((u64)B102, t_object_2e895, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B101, (u64)B102);
+	t__2e900 = (u64)(*(u64 *)t_binding_2e832);
+	t__2e901 = t__2e900;
+	t__2e902 = (u64)((i64)(i32)((u64)5UL));
+	t__2e903 = (u64)((u64)((u64)5UL) - (u64)t__2e902);
+	t__2e907 = (u64)(u32)(((u64)t__2e902 <= (u64)((u64)5UL)));
+	t__2e903 = (u64)((u64)((u64)5UL) - (u64)t__2e902);
+	t__2e904 = (u64)((u64)((u64)5UL) - (u64)t__2e902);
+	if ((u32)t__2e907) goto L__2e909; else goto L__2e908;
+	L__2e908:;
+	t_abortsite_2e475 = ((u64)30UL);
+	goto L_abort_2e476;
+	L__2e909:;
+	t_data_2e910 = (u64)((u64)t__2e902 * (u64)((u64)4UL));
+	t_data_2e910 = (u64)((u64)t__2e901 + (u64)t_data_2e910);
+	*(u64 *)t_object_2e899 = (u64)t_data_2e910;
+	t__2e911 = (u64)((u64)t_object_2e899 + (u64)((u64)8UL));
+	*(u64 *)t__2e911 = (u64)t__2e903;
+	t__2e911 = (u64)((u64)t_object_2e899 + (u64)((u64)16UL));
+	*(u64 *)t__2e911 = (u64)t__2e904;
+	*(u64 *)t_object_2e912 = (u64)((u64)0UL);
+	t__2e913 = (u64)((u64)t_object_2e912 + (u64)((u64)8UL));
+	*(u64 *)t__2e913 = (u64)((u64)0UL);
+	t__2e913 = (u64)((u64)t__2e913 + (u64)((u64)8UL));
+	*(u64 *)t__2e913 = (u64)((u64)0UL);
+	BLIT((u64)B103, t_object_2e899, 24);
+	BLIT((u64)B104, t_object_2e912, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_assert__slice__eq)))((u64)B103, (u64)B104);
+	*(u32 *)t_object_2e916 = (u32)((u64)3532310079UL);
+	t__2e917 = (u64)((u64)t_object_2e916 + (u64)((u64)4UL));
+	*(u32 *)t__2e917 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e920 = (u64)((u64)0UL);
+	t__2e921 = (u64)((u64)t_object_2e920 + (u64)((u64)8UL));
+	*(u64 *)t__2e921 = (u64)((u64)0UL);
+	t__2e921 = (u64)((u64)t__2e921 + (u64)((u64)8UL));
+	*(u64 *)t__2e921 = (u64)((u64)0UL);
+	BLIT((u64)B105, t_object_2e916, 8);
+	BLIT((u64)B106, ((u64)((char *)&D_strliteral_2e919)), 24);
+	BLIT((u64)B107, t_object_2e920, 24);
+	t__2e915 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R108, (u64)B105, (u64)B106, (u64)B107);
+	t_tag_2e922 = (u64)(*(u32 *)t__2e915);
+	t__2e930 = (u64)(u32)(((u32)t_tag_2e922 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e930) goto L_member_2e927; else goto L__2e929;
+	L__2e929:;
+	t__2e932 = (u64)(u32)(((u32)t_tag_2e922 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e932) goto L_member_2e928; else goto L__2e931;
+	L__2e931:;
+	goto L_matches_2e926;
+	L_member_2e927:;
+	goto L_matches_2e926;
+	L_member_2e928:;
+	goto L_matches_2e925;
+	L_matches_2e925:;
+	goto L__2e923;
+	L_matches_2e926:;
+	t_abortsite_2e475 = ((u64)31UL);
+	goto L_abort_2e933;
+	L__2e939:;
+	L__2e924:;
+	t_abortsite_2e475 = ((u64)32UL);
+	goto L_abort_2e940;
+	L__2e923:;
+	*(u32 *)t_object_2e948 = (u32)((u64)3532310079UL);
+	t__2e949 = (u64)((u64)t_object_2e948 + (u64)((u64)4UL));
+	*(u32 *)t__2e949 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e952 = (u64)((u64)0UL);
+	t__2e953 = (u64)((u64)t_object_2e952 + (u64)((u64)8UL));
+	*(u64 *)t__2e953 = (u64)((u64)0UL);
+	t__2e953 = (u64)((u64)t__2e953 + (u64)((u64)8UL));
+	*(u64 *)t__2e953 = (u64)((u64)0UL);
+	BLIT((u64)B109, t_object_2e948, 8);
+	BLIT((u64)B110, ((u64)((char *)&D_strliteral_2e951)), 24);
+	BLIT((u64)B111, t_object_2e952, 24);
+	t__2e947 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R112, (u64)B109, (u64)B110, (u64)B111);
+	t_tag_2e954 = (u64)(*(u32 *)t__2e947);
+	t__2e962 = (u64)(u32)(((u32)t_tag_2e954 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e962) goto L_member_2e959; else goto L__2e961;
+	L__2e961:;
+	t__2e964 = (u64)(u32)(((u32)t_tag_2e954 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e964) goto L_member_2e960; else goto L__2e963;
+	L__2e963:;
+	goto L_matches_2e958;
+	L_member_2e959:;
+	goto L_matches_2e958;
+	L_member_2e960:;
+	goto L_matches_2e957;
+	L_matches_2e957:;
+	goto L__2e955;
+	L_matches_2e958:;
+	t_abortsite_2e475 = ((u64)33UL);
+	goto L_abort_2e933;
+	L__2e965:;
+	L__2e956:;
+	t_abortsite_2e475 = ((u64)34UL);
+	goto L_abort_2e940;
+	L__2e955:;
+	*(u32 *)t_object_2e968 = (u32)((u64)3532310079UL);
+	t__2e969 = (u64)((u64)t_object_2e968 + (u64)((u64)4UL));
+	*(u32 *)t__2e969 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e972 = (u64)((u64)0UL);
+	t__2e973 = (u64)((u64)t_object_2e972 + (u64)((u64)8UL));
+	*(u64 *)t__2e973 = (u64)((u64)0UL);
+	t__2e973 = (u64)((u64)t__2e973 + (u64)((u64)8UL));
+	*(u64 *)t__2e973 = (u64)((u64)0UL);
+	BLIT((u64)B113, t_object_2e968, 8);
+	BLIT((u64)B114, ((u64)((char *)&D_strliteral_2e971)), 24);
+	BLIT((u64)B115, t_object_2e972, 24);
+	t__2e967 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R116, (u64)B113, (u64)B114, (u64)B115);
+	t_tag_2e974 = (u64)(*(u32 *)t__2e967);
+	t__2e982 = (u64)(u32)(((u32)t_tag_2e974 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e982) goto L_member_2e979; else goto L__2e981;
+	L__2e981:;
+	t__2e984 = (u64)(u32)(((u32)t_tag_2e974 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e984) goto L_member_2e980; else goto L__2e983;
+	L__2e983:;
+	goto L_matches_2e978;
+	L_member_2e979:;
+	goto L_matches_2e978;
+	L_member_2e980:;
+	goto L_matches_2e977;
+	L_matches_2e977:;
+	goto L__2e975;
+	L_matches_2e978:;
+	t_abortsite_2e475 = ((u64)35UL);
+	goto L_abort_2e933;
+	L__2e985:;
+	L__2e976:;
+	t_abortsite_2e475 = ((u64)36UL);
+	goto L_abort_2e940;
+	L__2e975:;
+	*(u32 *)t_object_2e988 = (u32)((u64)3532310079UL);
+	t__2e989 = (u64)((u64)t_object_2e988 + (u64)((u64)4UL));
+	*(u32 *)t__2e989 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e992 = (u64)((u64)0UL);
+	t__2e993 = (u64)((u64)t_object_2e992 + (u64)((u64)8UL));
+	*(u64 *)t__2e993 = (u64)((u64)0UL);
+	t__2e993 = (u64)((u64)t__2e993 + (u64)((u64)8UL));
+	*(u64 *)t__2e993 = (u64)((u64)0UL);
+	BLIT((u64)B117, t_object_2e988, 8);
+	BLIT((u64)B118, ((u64)((char *)&D_strliteral_2e991)), 24);
+	BLIT((u64)B119, t_object_2e992, 24);
+	t__2e987 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R120, (u64)B117, (u64)B118, (u64)B119);
+	t_tag_2e994 = (u64)(*(u32 *)t__2e987);
+	t__2e1002 = (u64)(u32)(((u32)t_tag_2e994 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1002) goto L_member_2e999; else goto L__2e1001;
+	L__2e1001:;
+	t__2e1004 = (u64)(u32)(((u32)t_tag_2e994 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1004) goto L_member_2e1000; else goto L__2e1003;
+	L__2e1003:;
+	goto L_matches_2e998;
+	L_member_2e999:;
+	goto L_matches_2e998;
+	L_member_2e1000:;
+	goto L_matches_2e997;
+	L_matches_2e997:;
+	goto L__2e995;
+	L_matches_2e998:;
+	t_abortsite_2e475 = ((u64)37UL);
+	goto L_abort_2e933;
+	L__2e1005:;
+	L__2e996:;
+	t_abortsite_2e475 = ((u64)38UL);
+	goto L_abort_2e940;
+	L__2e995:;
+	goto L__2e446;
+	L__2e1006:;
+	L__2e446:;
+	return;
+	L_abort_2e476:;
+	t__2e477 = (u64)((u64)t_abortsite_2e475 * (u64)((u64)16UL));
+	t__2e477 = (u64)((u64)((u64)((char *)&D_abortsites_2e474)) + (u64)t__2e477);
+	t__2e478 = (u64)(*(u64 *)t__2e477);
+	t__2e479 = (u64)((u64)t__2e477 + (u64)((u64)8UL));
+	t__2e480 = (u64)(*(u32 *)t__2e479);
+	t__2e479 = (u64)((u64)t__2e477 + (u64)((u64)12UL));
+	t__2e481 = (u64)(*(u32 *)t__2e479);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e478, (u64)t__2e480, (u64)t__2e481, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e554:;
+	t__2e555 = (u64)((u64)t_abortsite_2e475 * (u64)((u64)16UL));
+	t__2e555 = (u64)((u64)((u64)((char *)&D_abortsites_2e474)) + (u64)t__2e555);
+	t__2e556 = (u64)(*(u64 *)t__2e555);
+	t__2e557 = (u64)((u64)t__2e555 + (u64)((u64)8UL));
+	t__2e558 = (u64)(*(u32 *)t__2e557);
+	t__2e557 = (u64)((u64)t__2e555 + (u64)((u64)12UL));
+	t__2e559 = (u64)(*(u32 *)t__2e557);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e556, (u64)t__2e558, (u64)t__2e559, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e933:;
+	t__2e934 = (u64)((u64)t_abortsite_2e475 * (u64)((u64)16UL));
+	t__2e934 = (u64)((u64)((u64)((char *)&D_abortsites_2e474)) + (u64)t__2e934);
+	t__2e935 = (u64)(*(u64 *)t__2e934);
+	t__2e936 = (u64)((u64)t__2e934 + (u64)((u64)8UL));
+	t__2e937 = (u64)(*(u32 *)t__2e936);
+	t__2e936 = (u64)((u64)t__2e934 + (u64)((u64)12UL));
+	t__2e938 = (u64)(*(u32 *)t__2e936);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e935, (u64)t__2e937, (u64)t__2e938, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e940:;
+	t__2e941 = (u64)((u64)t_abortsite_2e475 * (u64)((u64)16UL));
+	t__2e941 = (u64)((u64)((u64)((char *)&D_abortsites_2e474)) + (u64)t__2e941);
+	t__2e942 = (u64)(*(u64 *)t__2e941);
+	t__2e943 = (u64)((u64)t__2e941 + (u64)((u64)8UL));
+	t__2e944 = (u64)(*(u32 *)t__2e943);
+	t__2e943 = (u64)((u64)t__2e941 + (u64)((u64)12UL));
+	t__2e945 = (u64)(*(u32 *)t__2e943);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e942, (u64)t__2e944, (u64)t__2e945, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u64 F_cap(u64 p_s) {
+	u64 t__2e1010;
+	u64 t_field_2e1009;
+	u64 t_s;
+	t_s = p_s;
+	L_start_2e1007:;
+	L_body_2e1008:;
+	t_field_2e1009 = (u64)((u64)t_s + (u64)((u64)16UL));
+	t__2e1010 = (u64)(*(u64 *)t_field_2e1009);
+	return (u64)t__2e1010;
+}
+static void F_assert__slice__eq(u64 p_actual, u64 p_expected) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e1017;
+	u64 t__2e1018;
+	u64 t__2e1019;
+	u64 t__2e1020;
+	u64 t__2e1021;
+	u64 t__2e1022;
+	u64 t__2e1023;
+	u64 t__2e1027;
+	u64 t__2e1028;
+	u64 t__2e1029;
+	u64 t__2e1030;
+	u64 t__2e1031;
+	u64 t__2e1038;
+	u64 t__2e1039;
+	u64 t__2e1040;
+	u64 t__2e1041;
+	u64 t__2e1042;
+	u64 t__2e1047;
+	u64 t__2e1048;
+	u64 t__2e1049;
+	u64 t__2e1050;
+	u64 t__2e1051;
+	u64 t__2e1052;
+	u64 t__2e1053;
+	u64 t__2e1054;
+	u64 t__2e1055;
+	u64 t__2e1056;
+	u64 t__2e1057;
+	u64 t__2e1058;
+	u64 t__2e1059;
+	u64 t__2e1060;
+	u64 t__2e1064;
+	u64 t__2e1065;
+	u64 t__2e1066;
+	u64 t__2e1067;
+	u64 t__2e1068;
+	u64 t__2e1069;
+	u64 t__2e1071;
+	u64 t_abortsite_2e1025;
+	u64 t_actual;
+	u64 t_binding_2e1037;
+	u64 t_expected;
+	t_actual = p_actual;
+	t_expected = p_expected;
+	L_start_2e1011:;
+	t_binding_2e1037 = (u64)A0;
+	L_body_2e1012:;
+	t__2e1018 = (u64)((u64)t_expected + (u64)((u64)8UL));
+	t__2e1019 = (u64)((u64)t_expected + (u64)((u64)16UL));
+	t__2e1020 = (u64)(*(u64 *)t__2e1018);
+	t__2e1021 = (u64)((u64)t_actual + (u64)((u64)8UL));
+	t__2e1022 = (u64)((u64)t_actual + (u64)((u64)16UL));
+	t__2e1023 = (u64)(*(u64 *)t__2e1021);
+	t__2e1017 = (u64)(u32)(((u64)t__2e1020 == (u64)t__2e1023));
+	if ((u32)t__2e1017) goto L_passed_2e1016; else goto L_failed_2e1015;
+	L_failed_2e1015:;
+	t_abortsite_2e1025 = ((u64)0UL);
+	goto L_abort_2e1026;
+	L_passed_2e1016:;
+	*(u64 *)t_binding_2e1037 = (u64)((u64)0UL);
+	L_loop_2e1032:;
+	t__2e1039 = (u64)(*(u64 *)t_binding_2e1037);
+	t__2e1040 = (u64)((u64)t_expected + (u64)((u64)8UL));
+	t__2e1041 = (u64)((u64)t_expected + (u64)((u64)16UL));
+	t__2e1042 = (u64)(*(u64 *)t__2e1040);
+	t__2e1038 = (u64)(u32)(((u64)t__2e1039 < (u64)t__2e1042));
+	if ((u32)t__2e1038) goto L_body_2e1033; else goto L__2e1035;
+	L_body_2e1033:;
+	t__2e1049 = (u64)((u64)t_expected + (u64)((u64)8UL));
+	t__2e1050 = (u64)((u64)t_expected + (u64)((u64)16UL));
+	t__2e1051 = (u64)(*(u64 *)t_expected);
+	t__2e1052 = (u64)(*(u64 *)t_binding_2e1037);
+	t__2e1048 = (u64)((u64)t__2e1052 * (u64)((u64)4UL));
+	t__2e1048 = (u64)((u64)t__2e1051 + (u64)t__2e1048);
+	t__2e1053 = (u64)(u32)(*(i32 *)t__2e1048);
+	t__2e1055 = (u64)((u64)t_actual + (u64)((u64)8UL));
+	t__2e1056 = (u64)((u64)t_actual + (u64)((u64)16UL));
+	t__2e1057 = (u64)(*(u64 *)t_actual);
+	t__2e1058 = (u64)(*(u64 *)t__2e1055);
+	t__2e1059 = (u64)(*(u64 *)t_binding_2e1037);
+	t__2e1054 = (u64)((u64)t__2e1059 * (u64)((u64)4UL));
+	t__2e1054 = (u64)((u64)t__2e1057 + (u64)t__2e1054);
+	t__2e1060 = (u64)(u32)(((u64)t__2e1059 < (u64)t__2e1058));
+	if ((u32)t__2e1060) goto L__2e1062; else goto L__2e1061;
+	L__2e1061:;
+	t_abortsite_2e1025 = ((u64)1UL);
+	goto L_abort_2e1063;
+	L__2e1062:;
+	t__2e1069 = (u64)(u32)(*(i32 *)t__2e1054);
+	t__2e1047 = (u64)(u32)(((u32)t__2e1053 == (u32)t__2e1069));
+	if ((u32)t__2e1047) goto L_passed_2e1046; else goto L_failed_2e1045;
+	L_failed_2e1045:;
+	t_abortsite_2e1025 = ((u64)2UL);
+	goto L_abort_2e1026;
+	L_passed_2e1046:;
+	goto L__2e1043;
+	L__2e1070:;
+	L__2e1043:;
+	L_after_2e1036:;
+	t__2e1071 = (u64)(*(u64 *)t_binding_2e1037);
+	t__2e1071 = (u64)((u64)t__2e1071 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1037 = (u64)t__2e1071;
+	goto L_loop_2e1032;
+	L__2e1035:;
+	goto L__2e1013;
+	L__2e1072:;
+	L__2e1013:;
+	return;
+	L_abort_2e1026:;
+	t__2e1027 = (u64)((u64)t_abortsite_2e1025 * (u64)((u64)16UL));
+	t__2e1027 = (u64)((u64)((u64)((char *)&D_abortsites_2e1024)) + (u64)t__2e1027);
+	t__2e1028 = (u64)(*(u64 *)t__2e1027);
+	t__2e1029 = (u64)((u64)t__2e1027 + (u64)((u64)8UL));
+	t__2e1030 = (u64)(*(u32 *)t__2e1029);
+	t__2e1029 = (u64)((u64)t__2e1027 + (u64)((u64)12UL));
+	t__2e1031 = (u64)(*(u32 *)t__2e1029);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1028, (u64)t__2e1030, (u64)t__2e1031, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1063:;
+	t__2e1064 = (u64)((u64)t_abortsite_2e1025 * (u64)((u64)16UL));
+	t__2e1064 = (u64)((u64)((u64)((char *)&D_abortsites_2e1024)) + (u64)t__2e1064);
+	t__2e1065 = (u64)(*(u64 *)t__2e1064);
+	t__2e1066 = (u64)((u64)t__2e1064 + (u64)((u64)8UL));
+	t__2e1067 = (u64)(*(u32 *)t__2e1066);
+	t__2e1066 = (u64)((u64)t__2e1064 + (u64)((u64)12UL));
+	t__2e1068 = (u64)(*(u32 *)t__2e1066);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1065, (u64)t__2e1067, (u64)t__2e1068, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_assignment(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[12] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[20] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char A7[12] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[24] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	char B21[8] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char R24[4] __attribute__((aligned(16)));
+	char B25[8] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char R28[4] __attribute__((aligned(16)));
+	char B29[8] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char B31[24] __attribute__((aligned(16)));
+	char R32[4] __attribute__((aligned(16)));
+	u64 t__2e1080;
+	u64 t__2e1081;
+	u64 t__2e1082;
+	u64 t__2e1083;
+	u64 t__2e1084;
+	u64 t__2e1085;
+	u64 t__2e1086;
+	u64 t__2e1087;
+	u64 t__2e1093;
+	u64 t__2e1094;
+	u64 t__2e1095;
+	u64 t__2e1096;
+	u64 t__2e1097;
+	u64 t__2e1098;
+	u64 t__2e1099;
+	u64 t__2e1100;
+	u64 t__2e1101;
+	u64 t__2e1102;
+	u64 t__2e1103;
+	u64 t__2e1104;
+	u64 t__2e1107;
+	u64 t__2e1108;
+	u64 t__2e1109;
+	u64 t__2e1110;
+	u64 t__2e1111;
+	u64 t__2e1112;
+	u64 t__2e1113;
+	u64 t__2e1118;
+	u64 t__2e1121;
+	u64 t__2e1124;
+	u64 t__2e1125;
+	u64 t__2e1126;
+	u64 t__2e1127;
+	u64 t__2e1128;
+	u64 t__2e1129;
+	u64 t__2e1130;
+	u64 t__2e1131;
+	u64 t__2e1134;
+	u64 t__2e1135;
+	u64 t__2e1136;
+	u64 t__2e1137;
+	u64 t__2e1138;
+	u64 t__2e1139;
+	u64 t__2e1140;
+	u64 t__2e1141;
+	u64 t__2e1142;
+	u64 t__2e1145;
+	u64 t__2e1146;
+	u64 t__2e1147;
+	u64 t__2e1148;
+	u64 t__2e1149;
+	u64 t__2e1150;
+	u64 t__2e1151;
+	u64 t__2e1152;
+	u64 t__2e1153;
+	u64 t__2e1156;
+	u64 t__2e1158;
+	u64 t__2e1159;
+	u64 t__2e1160;
+	u64 t__2e1161;
+	u64 t__2e1162;
+	u64 t__2e1165;
+	u64 t__2e1168;
+	u64 t__2e1171;
+	u64 t__2e1172;
+	u64 t__2e1173;
+	u64 t__2e1174;
+	u64 t__2e1175;
+	u64 t__2e1176;
+	u64 t__2e1177;
+	u64 t__2e1178;
+	u64 t__2e1179;
+	u64 t__2e1180;
+	u64 t__2e1181;
+	u64 t__2e1182;
+	u64 t__2e1186;
+	u64 t__2e1187;
+	u64 t__2e1188;
+	u64 t__2e1189;
+	u64 t__2e1190;
+	u64 t__2e1191;
+	u64 t__2e1192;
+	u64 t__2e1193;
+	u64 t__2e1196;
+	u64 t__2e1197;
+	u64 t__2e1198;
+	u64 t__2e1199;
+	u64 t__2e1200;
+	u64 t__2e1201;
+	u64 t__2e1202;
+	u64 t__2e1205;
+	u64 t__2e1206;
+	u64 t__2e1207;
+	u64 t__2e1208;
+	u64 t__2e1209;
+	u64 t__2e1210;
+	u64 t__2e1211;
+	u64 t__2e1216;
+	u64 t__2e1219;
+	u64 t__2e1222;
+	u64 t__2e1223;
+	u64 t__2e1224;
+	u64 t__2e1225;
+	u64 t__2e1226;
+	u64 t__2e1227;
+	u64 t__2e1228;
+	u64 t__2e1229;
+	u64 t__2e1232;
+	u64 t__2e1233;
+	u64 t__2e1234;
+	u64 t__2e1235;
+	u64 t__2e1236;
+	u64 t__2e1237;
+	u64 t__2e1238;
+	u64 t__2e1239;
+	u64 t__2e1240;
+	u64 t__2e1243;
+	u64 t__2e1244;
+	u64 t__2e1245;
+	u64 t__2e1246;
+	u64 t__2e1247;
+	u64 t__2e1248;
+	u64 t__2e1249;
+	u64 t__2e1250;
+	u64 t__2e1251;
+	u64 t__2e1254;
+	u64 t__2e1257;
+	u64 t__2e1260;
+	u64 t__2e1263;
+	u64 t__2e1264;
+	u64 t__2e1265;
+	u64 t__2e1266;
+	u64 t__2e1267;
+	u64 t__2e1268;
+	u64 t__2e1269;
+	u64 t__2e1270;
+	u64 t__2e1271;
+	u64 t__2e1272;
+	u64 t__2e1273;
+	u64 t__2e1274;
+	u64 t__2e1277;
+	u64 t__2e1280;
+	u64 t__2e1283;
+	u64 t__2e1284;
+	u64 t__2e1285;
+	u64 t__2e1286;
+	u64 t__2e1287;
+	u64 t__2e1288;
+	u64 t__2e1289;
+	u64 t__2e1290;
+	u64 t__2e1293;
+	u64 t__2e1294;
+	u64 t__2e1295;
+	u64 t__2e1296;
+	u64 t__2e1297;
+	u64 t__2e1298;
+	u64 t__2e1299;
+	u64 t__2e1300;
+	u64 t__2e1301;
+	u64 t__2e1304;
+	u64 t__2e1305;
+	u64 t__2e1306;
+	u64 t__2e1307;
+	u64 t__2e1308;
+	u64 t__2e1309;
+	u64 t__2e1310;
+	u64 t__2e1311;
+	u64 t__2e1312;
+	u64 t__2e1315;
+	u64 t__2e1319;
+	u64 t__2e1320;
+	u64 t__2e1321;
+	u64 t__2e1322;
+	u64 t__2e1323;
+	u64 t__2e1324;
+	u64 t__2e1325;
+	u64 t__2e1326;
+	u64 t__2e1327;
+	u64 t__2e1328;
+	u64 t__2e1329;
+	u64 t__2e1330;
+	u64 t__2e1331;
+	u64 t__2e1337;
+	u64 t__2e1338;
+	u64 t__2e1339;
+	u64 t__2e1342;
+	u64 t__2e1343;
+	u64 t__2e1344;
+	u64 t__2e1347;
+	u64 t__2e1350;
+	u64 t__2e1353;
+	u64 t__2e1356;
+	u64 t__2e1359;
+	u64 t__2e1360;
+	u64 t__2e1361;
+	u64 t__2e1362;
+	u64 t__2e1363;
+	u64 t__2e1364;
+	u64 t__2e1365;
+	u64 t__2e1366;
+	u64 t__2e1369;
+	u64 t__2e1370;
+	u64 t__2e1371;
+	u64 t__2e1372;
+	u64 t__2e1373;
+	u64 t__2e1374;
+	u64 t__2e1375;
+	u64 t__2e1376;
+	u64 t__2e1377;
+	u64 t__2e1380;
+	u64 t__2e1381;
+	u64 t__2e1382;
+	u64 t__2e1383;
+	u64 t__2e1384;
+	u64 t__2e1385;
+	u64 t__2e1386;
+	u64 t__2e1387;
+	u64 t__2e1388;
+	u64 t__2e1391;
+	u64 t__2e1392;
+	u64 t__2e1393;
+	u64 t__2e1394;
+	u64 t__2e1395;
+	u64 t__2e1396;
+	u64 t__2e1397;
+	u64 t__2e1398;
+	u64 t__2e1399;
+	u64 t__2e1402;
+	u64 t__2e1403;
+	u64 t__2e1404;
+	u64 t__2e1405;
+	u64 t__2e1406;
+	u64 t__2e1407;
+	u64 t__2e1408;
+	u64 t__2e1409;
+	u64 t__2e1410;
+	u64 t__2e1413;
+	u64 t__2e1414;
+	u64 t__2e1415;
+	u64 t__2e1416;
+	u64 t__2e1417;
+	u64 t__2e1418;
+	u64 t__2e1419;
+	u64 t__2e1420;
+	u64 t__2e1421;
+	u64 t__2e1422;
+	u64 t__2e1423;
+	u64 t__2e1424;
+	u64 t__2e1425;
+	u64 t__2e1428;
+	u64 t__2e1429;
+	u64 t__2e1432;
+	u64 t__2e1433;
+	u64 t__2e1434;
+	u64 t__2e1437;
+	u64 t__2e1440;
+	u64 t__2e1443;
+	u64 t__2e1446;
+	u64 t__2e1449;
+	u64 t__2e1450;
+	u64 t__2e1451;
+	u64 t__2e1452;
+	u64 t__2e1453;
+	u64 t__2e1454;
+	u64 t__2e1455;
+	u64 t__2e1456;
+	u64 t__2e1459;
+	u64 t__2e1460;
+	u64 t__2e1461;
+	u64 t__2e1462;
+	u64 t__2e1463;
+	u64 t__2e1464;
+	u64 t__2e1465;
+	u64 t__2e1466;
+	u64 t__2e1467;
+	u64 t__2e1470;
+	u64 t__2e1471;
+	u64 t__2e1472;
+	u64 t__2e1473;
+	u64 t__2e1474;
+	u64 t__2e1475;
+	u64 t__2e1476;
+	u64 t__2e1477;
+	u64 t__2e1478;
+	u64 t__2e1481;
+	u64 t__2e1482;
+	u64 t__2e1483;
+	u64 t__2e1484;
+	u64 t__2e1485;
+	u64 t__2e1486;
+	u64 t__2e1487;
+	u64 t__2e1488;
+	u64 t__2e1489;
+	u64 t__2e1492;
+	u64 t__2e1493;
+	u64 t__2e1494;
+	u64 t__2e1495;
+	u64 t__2e1496;
+	u64 t__2e1497;
+	u64 t__2e1498;
+	u64 t__2e1499;
+	u64 t__2e1500;
+	u64 t__2e1503;
+	u64 t__2e1505;
+	u64 t__2e1506;
+	u64 t__2e1507;
+	u64 t__2e1508;
+	u64 t__2e1509;
+	u64 t__2e1510;
+	u64 t__2e1511;
+	u64 t__2e1512;
+	u64 t__2e1513;
+	u64 t__2e1514;
+	u64 t__2e1515;
+	u64 t__2e1516;
+	u64 t__2e1519;
+	u64 t__2e1520;
+	u64 t__2e1523;
+	u64 t__2e1524;
+	u64 t__2e1525;
+	u64 t__2e1527;
+	u64 t__2e1528;
+	u64 t__2e1529;
+	u64 t__2e1530;
+	u64 t__2e1531;
+	u64 t__2e1532;
+	u64 t__2e1533;
+	u64 t__2e1534;
+	u64 t__2e1535;
+	u64 t__2e1536;
+	u64 t__2e1537;
+	u64 t__2e1538;
+	u64 t__2e1539;
+	u64 t__2e1542;
+	u64 t__2e1543;
+	u64 t__2e1546;
+	u64 t__2e1547;
+	u64 t__2e1548;
+	u64 t__2e1550;
+	u64 t__2e1555;
+	u64 t__2e1557;
+	u64 t__2e1559;
+	u64 t__2e1563;
+	u64 t__2e1572;
+	u64 t__2e1574;
+	u64 t__2e1576;
+	u64 t__2e1577;
+	u64 t__2e1578;
+	u64 t__2e1579;
+	u64 t__2e1580;
+	u64 t__2e1583;
+	u64 t__2e1584;
+	u64 t__2e1585;
+	u64 t__2e1586;
+	u64 t__2e1587;
+	u64 t__2e1589;
+	u64 t__2e1591;
+	u64 t__2e1595;
+	u64 t__2e1604;
+	u64 t__2e1606;
+	u64 t__2e1609;
+	u64 t__2e1611;
+	u64 t__2e1615;
+	u64 t__2e1624;
+	u64 t__2e1626;
+	u64 t_abortsite_2e1091;
+	u64 t_binding_2e1077;
+	u64 t_binding_2e1079;
+	u64 t_binding_2e1183;
+	u64 t_binding_2e1316;
+	u64 t_binding_2e1504;
+	u64 t_binding_2e1526;
+	u64 t_binding_2e1549;
+	u64 t_binding_2e1551;
+	u64 t_binding_2e1553;
+	u64 t_item_2e1078;
+	u64 t_item_2e1185;
+	u64 t_item_2e1318;
+	u64 t_item_2e1336;
+	u64 t_object_2e1184;
+	u64 t_object_2e1317;
+	u64 t_object_2e1334;
+	u64 t_object_2e1335;
+	u64 t_object_2e1554;
+	u64 t_object_2e1558;
+	u64 t_object_2e1562;
+	u64 t_object_2e1590;
+	u64 t_object_2e1594;
+	u64 t_object_2e1610;
+	u64 t_object_2e1614;
+	u64 t_tag_2e1564;
+	u64 t_tag_2e1596;
+	u64 t_tag_2e1616;
+	L_start_2e1073:;
+	t_binding_2e1077 = (u64)A0;
+	t_binding_2e1079 = (u64)A1;
+	t_binding_2e1183 = (u64)A2;
+	t_object_2e1184 = (u64)A3;
+	t_binding_2e1316 = (u64)A4;
+	t_object_2e1317 = (u64)A5;
+	t_object_2e1334 = (u64)A6;
+	t_object_2e1335 = (u64)A7;
+	t_binding_2e1504 = (u64)A8;
+	t_binding_2e1526 = (u64)A9;
+	t_binding_2e1549 = (u64)A10;
+	t_binding_2e1551 = (u64)A11;
+	t_binding_2e1553 = (u64)A12;
+	t_object_2e1554 = (u64)A13;
+	t_object_2e1558 = (u64)A14;
+	t_object_2e1562 = (u64)A15;
+	t_object_2e1590 = (u64)A16;
+	t_object_2e1594 = (u64)A17;
+	t_object_2e1610 = (u64)A18;
+	t_object_2e1614 = (u64)A19;
+	L_body_2e1074:;
+	t_item_2e1078 = (u64)((u64)t_binding_2e1077 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1078 = (u32)((u64)1UL);
+	t_item_2e1078 = (u64)((u64)t_binding_2e1077 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1078 = (u32)((u64)2UL);
+	t_item_2e1078 = (u64)((u64)t_binding_2e1077 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1078 = (u32)((u64)3UL);
+	*(u64 *)t_binding_2e1079 = (u64)t_binding_2e1077;
+	t__2e1080 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	*(u64 *)t__2e1080 = (u64)((u64)3UL);
+	t__2e1080 = (u64)((u64)t__2e1080 + (u64)((u64)8UL));
+	*(u64 *)t__2e1080 = (u64)((u64)3UL);
+	t__2e1082 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1083 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1084 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1085 = (u64)(*(u64 *)t__2e1082);
+	t__2e1086 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1081 = (u64)((u64)t__2e1086 * (u64)((u64)4UL));
+	t__2e1081 = (u64)((u64)t__2e1084 + (u64)t__2e1081);
+	t__2e1087 = (u64)(u32)(((u64)t__2e1086 < (u64)t__2e1085));
+	if ((u32)t__2e1087) goto L__2e1089; else goto L__2e1088;
+	L__2e1088:;
+	t_abortsite_2e1091 = ((u64)0UL);
+	goto L_abort_2e1092;
+	L__2e1089:;
+	*(u32 *)t__2e1081 = (u32)((u64)4UL);
+	t__2e1099 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1100 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1101 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1102 = (u64)(*(u64 *)t__2e1099);
+	t__2e1103 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1098 = (u64)((u64)t__2e1103 * (u64)((u64)4UL));
+	t__2e1098 = (u64)((u64)t__2e1101 + (u64)t__2e1098);
+	t__2e1104 = (u64)(u32)(((u64)t__2e1103 < (u64)t__2e1102));
+	if ((u32)t__2e1104) goto L__2e1106; else goto L__2e1105;
+	L__2e1105:;
+	t_abortsite_2e1091 = ((u64)1UL);
+	goto L_abort_2e1092;
+	L__2e1106:;
+	*(u32 *)t__2e1098 = (u32)((u64)5UL);
+	t__2e1108 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1109 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1110 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1111 = (u64)(*(u64 *)t__2e1108);
+	t__2e1112 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1107 = (u64)((u64)t__2e1112 * (u64)((u64)4UL));
+	t__2e1107 = (u64)((u64)t__2e1110 + (u64)t__2e1107);
+	t__2e1113 = (u64)(u32)(((u64)t__2e1112 < (u64)t__2e1111));
+	if ((u32)t__2e1113) goto L__2e1115; else goto L__2e1114;
+	L__2e1114:;
+	t_abortsite_2e1091 = ((u64)2UL);
+	goto L_abort_2e1092;
+	L__2e1115:;
+	*(u32 *)t__2e1107 = (u32)((u64)6UL);
+	t__2e1126 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1127 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1128 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1129 = (u64)(*(u64 *)t__2e1126);
+	t__2e1130 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1125 = (u64)((u64)t__2e1130 * (u64)((u64)4UL));
+	t__2e1125 = (u64)((u64)t__2e1128 + (u64)t__2e1125);
+	t__2e1131 = (u64)(u32)(((u64)t__2e1130 < (u64)t__2e1129));
+	if ((u32)t__2e1131) goto L__2e1133; else goto L__2e1132;
+	L__2e1132:;
+	t_abortsite_2e1091 = ((u64)3UL);
+	goto L_abort_2e1092;
+	L__2e1133:;
+	t__2e1134 = (u64)(u32)(*(i32 *)t__2e1125);
+	t__2e1124 = (u64)(u32)(((u32)t__2e1134 == (u32)((u64)4UL)));
+	t__2e1121 = (u64)(u32)t__2e1124;
+	if ((u32)t__2e1121) goto L__2e1122; else goto L__2e1123;
+	L__2e1122:;
+	t__2e1137 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1138 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1139 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1140 = (u64)(*(u64 *)t__2e1137);
+	t__2e1141 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1136 = (u64)((u64)t__2e1141 * (u64)((u64)4UL));
+	t__2e1136 = (u64)((u64)t__2e1139 + (u64)t__2e1136);
+	t__2e1142 = (u64)(u32)(((u64)t__2e1141 < (u64)t__2e1140));
+	if ((u32)t__2e1142) goto L__2e1144; else goto L__2e1143;
+	L__2e1143:;
+	t_abortsite_2e1091 = ((u64)4UL);
+	goto L_abort_2e1092;
+	L__2e1144:;
+	t__2e1145 = (u64)(u32)(*(i32 *)t__2e1136);
+	t__2e1135 = (u64)(u32)(((u32)t__2e1145 == (u32)((u64)5UL)));
+	t__2e1121 = (u64)(u32)t__2e1135;
+	goto L__2e1123;
+	L__2e1123:;
+	t__2e1118 = (u64)(u32)t__2e1121;
+	if ((u32)t__2e1118) goto L__2e1119; else goto L__2e1120;
+	L__2e1119:;
+	t__2e1148 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1149 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1150 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1151 = (u64)(*(u64 *)t__2e1148);
+	t__2e1152 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1147 = (u64)((u64)t__2e1152 * (u64)((u64)4UL));
+	t__2e1147 = (u64)((u64)t__2e1150 + (u64)t__2e1147);
+	t__2e1153 = (u64)(u32)(((u64)t__2e1152 < (u64)t__2e1151));
+	if ((u32)t__2e1153) goto L__2e1155; else goto L__2e1154;
+	L__2e1154:;
+	t_abortsite_2e1091 = ((u64)5UL);
+	goto L_abort_2e1092;
+	L__2e1155:;
+	t__2e1156 = (u64)(u32)(*(i32 *)t__2e1147);
+	t__2e1146 = (u64)(u32)(((u32)t__2e1156 == (u32)((u64)6UL)));
+	t__2e1118 = (u64)(u32)t__2e1146;
+	goto L__2e1120;
+	L__2e1120:;
+	if ((u32)t__2e1118) goto L_passed_2e1117; else goto L_failed_2e1116;
+	L_failed_2e1116:;
+	t_abortsite_2e1091 = ((u64)6UL);
+	goto L_abort_2e1157;
+	L_passed_2e1117:;
+	t__2e1173 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1172 = (u64)((u64)t__2e1173 * (u64)((u64)4UL));
+	t__2e1172 = (u64)((u64)t_binding_2e1077 + (u64)t__2e1172);
+	t__2e1174 = (u64)(u32)(*(i32 *)t__2e1172);
+	t__2e1171 = (u64)(u32)(((u32)t__2e1174 == (u32)((u64)4UL)));
+	t__2e1168 = (u64)(u32)t__2e1171;
+	if ((u32)t__2e1168) goto L__2e1169; else goto L__2e1170;
+	L__2e1169:;
+	t__2e1177 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1176 = (u64)((u64)t__2e1177 * (u64)((u64)4UL));
+	t__2e1176 = (u64)((u64)t_binding_2e1077 + (u64)t__2e1176);
+	t__2e1178 = (u64)(u32)(*(i32 *)t__2e1176);
+	t__2e1175 = (u64)(u32)(((u32)t__2e1178 == (u32)((u64)5UL)));
+	t__2e1168 = (u64)(u32)t__2e1175;
+	goto L__2e1170;
+	L__2e1170:;
+	t__2e1165 = (u64)(u32)t__2e1168;
+	if ((u32)t__2e1165) goto L__2e1166; else goto L__2e1167;
+	L__2e1166:;
+	t__2e1181 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1180 = (u64)((u64)t__2e1181 * (u64)((u64)4UL));
+	t__2e1180 = (u64)((u64)t_binding_2e1077 + (u64)t__2e1180);
+	t__2e1182 = (u64)(u32)(*(i32 *)t__2e1180);
+	t__2e1179 = (u64)(u32)(((u32)t__2e1182 == (u32)((u64)6UL)));
+	t__2e1165 = (u64)(u32)t__2e1179;
+	goto L__2e1167;
+	L__2e1167:;
+	if ((u32)t__2e1165) goto L_passed_2e1164; else goto L_failed_2e1163;
+	L_failed_2e1163:;
+	t_abortsite_2e1091 = ((u64)7UL);
+	goto L_abort_2e1157;
+	L_passed_2e1164:;
+	t_item_2e1185 = (u64)((u64)t_object_2e1184 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1185 = (u32)((u64)4UL);
+	t_item_2e1185 = (u64)((u64)t_object_2e1184 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1185 = (u32)((u64)5UL);
+	t_item_2e1185 = (u64)((u64)t_object_2e1184 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1185 = (u32)((u64)6UL);
+	*(u64 *)t_binding_2e1183 = (u64)t_object_2e1184;
+	t__2e1186 = (u64)((u64)t_binding_2e1183 + (u64)((u64)8UL));
+	*(u64 *)t__2e1186 = (u64)((u64)3UL);
+	t__2e1186 = (u64)((u64)t__2e1186 + (u64)((u64)8UL));
+	*(u64 *)t__2e1186 = (u64)((u64)3UL);
+	BLIT(t_binding_2e1079, t_binding_2e1183, ((u64)24UL));
+	t__2e1188 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1189 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1190 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1191 = (u64)(*(u64 *)t__2e1188);
+	t__2e1192 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1187 = (u64)((u64)t__2e1192 * (u64)((u64)4UL));
+	t__2e1187 = (u64)((u64)t__2e1190 + (u64)t__2e1187);
+	t__2e1193 = (u64)(u32)(((u64)t__2e1192 < (u64)t__2e1191));
+	if ((u32)t__2e1193) goto L__2e1195; else goto L__2e1194;
+	L__2e1194:;
+	t_abortsite_2e1091 = ((u64)8UL);
+	goto L_abort_2e1092;
+	L__2e1195:;
+	*(u32 *)t__2e1187 = (u32)((u64)7UL);
+	t__2e1197 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1198 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1199 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1200 = (u64)(*(u64 *)t__2e1197);
+	t__2e1201 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1196 = (u64)((u64)t__2e1201 * (u64)((u64)4UL));
+	t__2e1196 = (u64)((u64)t__2e1199 + (u64)t__2e1196);
+	t__2e1202 = (u64)(u32)(((u64)t__2e1201 < (u64)t__2e1200));
+	if ((u32)t__2e1202) goto L__2e1204; else goto L__2e1203;
+	L__2e1203:;
+	t_abortsite_2e1091 = ((u64)9UL);
+	goto L_abort_2e1092;
+	L__2e1204:;
+	*(u32 *)t__2e1196 = (u32)((u64)8UL);
+	t__2e1206 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1207 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1208 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1209 = (u64)(*(u64 *)t__2e1206);
+	t__2e1210 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1205 = (u64)((u64)t__2e1210 * (u64)((u64)4UL));
+	t__2e1205 = (u64)((u64)t__2e1208 + (u64)t__2e1205);
+	t__2e1211 = (u64)(u32)(((u64)t__2e1210 < (u64)t__2e1209));
+	if ((u32)t__2e1211) goto L__2e1213; else goto L__2e1212;
+	L__2e1212:;
+	t_abortsite_2e1091 = ((u64)10UL);
+	goto L_abort_2e1092;
+	L__2e1213:;
+	*(u32 *)t__2e1205 = (u32)((u64)9UL);
+	t__2e1224 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1225 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1226 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1227 = (u64)(*(u64 *)t__2e1224);
+	t__2e1228 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1223 = (u64)((u64)t__2e1228 * (u64)((u64)4UL));
+	t__2e1223 = (u64)((u64)t__2e1226 + (u64)t__2e1223);
+	t__2e1229 = (u64)(u32)(((u64)t__2e1228 < (u64)t__2e1227));
+	if ((u32)t__2e1229) goto L__2e1231; else goto L__2e1230;
+	L__2e1230:;
+	t_abortsite_2e1091 = ((u64)11UL);
+	goto L_abort_2e1092;
+	L__2e1231:;
+	t__2e1232 = (u64)(u32)(*(i32 *)t__2e1223);
+	t__2e1222 = (u64)(u32)(((u32)t__2e1232 == (u32)((u64)7UL)));
+	t__2e1219 = (u64)(u32)t__2e1222;
+	if ((u32)t__2e1219) goto L__2e1220; else goto L__2e1221;
+	L__2e1220:;
+	t__2e1235 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1236 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1237 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1238 = (u64)(*(u64 *)t__2e1235);
+	t__2e1239 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1234 = (u64)((u64)t__2e1239 * (u64)((u64)4UL));
+	t__2e1234 = (u64)((u64)t__2e1237 + (u64)t__2e1234);
+	t__2e1240 = (u64)(u32)(((u64)t__2e1239 < (u64)t__2e1238));
+	if ((u32)t__2e1240) goto L__2e1242; else goto L__2e1241;
+	L__2e1241:;
+	t_abortsite_2e1091 = ((u64)12UL);
+	goto L_abort_2e1092;
+	L__2e1242:;
+	t__2e1243 = (u64)(u32)(*(i32 *)t__2e1234);
+	t__2e1233 = (u64)(u32)(((u32)t__2e1243 == (u32)((u64)8UL)));
+	t__2e1219 = (u64)(u32)t__2e1233;
+	goto L__2e1221;
+	L__2e1221:;
+	t__2e1216 = (u64)(u32)t__2e1219;
+	if ((u32)t__2e1216) goto L__2e1217; else goto L__2e1218;
+	L__2e1217:;
+	t__2e1246 = (u64)((u64)t_binding_2e1079 + (u64)((u64)8UL));
+	t__2e1247 = (u64)((u64)t_binding_2e1079 + (u64)((u64)16UL));
+	t__2e1248 = (u64)(*(u64 *)t_binding_2e1079);
+	t__2e1249 = (u64)(*(u64 *)t__2e1246);
+	t__2e1250 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1245 = (u64)((u64)t__2e1250 * (u64)((u64)4UL));
+	t__2e1245 = (u64)((u64)t__2e1248 + (u64)t__2e1245);
+	t__2e1251 = (u64)(u32)(((u64)t__2e1250 < (u64)t__2e1249));
+	if ((u32)t__2e1251) goto L__2e1253; else goto L__2e1252;
+	L__2e1252:;
+	t_abortsite_2e1091 = ((u64)13UL);
+	goto L_abort_2e1092;
+	L__2e1253:;
+	t__2e1254 = (u64)(u32)(*(i32 *)t__2e1245);
+	t__2e1244 = (u64)(u32)(((u32)t__2e1254 == (u32)((u64)9UL)));
+	t__2e1216 = (u64)(u32)t__2e1244;
+	goto L__2e1218;
+	L__2e1218:;
+	if ((u32)t__2e1216) goto L_passed_2e1215; else goto L_failed_2e1214;
+	L_failed_2e1214:;
+	t_abortsite_2e1091 = ((u64)14UL);
+	goto L_abort_2e1157;
+	L_passed_2e1215:;
+	t__2e1265 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1264 = (u64)((u64)t__2e1265 * (u64)((u64)4UL));
+	t__2e1264 = (u64)((u64)t_binding_2e1077 + (u64)t__2e1264);
+	t__2e1266 = (u64)(u32)(*(i32 *)t__2e1264);
+	t__2e1263 = (u64)(u32)(((u32)t__2e1266 == (u32)((u64)4UL)));
+	t__2e1260 = (u64)(u32)t__2e1263;
+	if ((u32)t__2e1260) goto L__2e1261; else goto L__2e1262;
+	L__2e1261:;
+	t__2e1269 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1268 = (u64)((u64)t__2e1269 * (u64)((u64)4UL));
+	t__2e1268 = (u64)((u64)t_binding_2e1077 + (u64)t__2e1268);
+	t__2e1270 = (u64)(u32)(*(i32 *)t__2e1268);
+	t__2e1267 = (u64)(u32)(((u32)t__2e1270 == (u32)((u64)5UL)));
+	t__2e1260 = (u64)(u32)t__2e1267;
+	goto L__2e1262;
+	L__2e1262:;
+	t__2e1257 = (u64)(u32)t__2e1260;
+	if ((u32)t__2e1257) goto L__2e1258; else goto L__2e1259;
+	L__2e1258:;
+	t__2e1273 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1272 = (u64)((u64)t__2e1273 * (u64)((u64)4UL));
+	t__2e1272 = (u64)((u64)t_binding_2e1077 + (u64)t__2e1272);
+	t__2e1274 = (u64)(u32)(*(i32 *)t__2e1272);
+	t__2e1271 = (u64)(u32)(((u32)t__2e1274 == (u32)((u64)6UL)));
+	t__2e1257 = (u64)(u32)t__2e1271;
+	goto L__2e1259;
+	L__2e1259:;
+	if ((u32)t__2e1257) goto L_passed_2e1256; else goto L_failed_2e1255;
+	L_failed_2e1255:;
+	t_abortsite_2e1091 = ((u64)15UL);
+	goto L_abort_2e1157;
+	L_passed_2e1256:;
+	BLIT((u64)B20, t_binding_2e1183, 24);
+	((void (*)(u64))((u64)((char *)&F_zero3)))((u64)B20);
+	t__2e1285 = (u64)((u64)t_binding_2e1183 + (u64)((u64)8UL));
+	t__2e1286 = (u64)((u64)t_binding_2e1183 + (u64)((u64)16UL));
+	t__2e1287 = (u64)(*(u64 *)t_binding_2e1183);
+	t__2e1288 = (u64)(*(u64 *)t__2e1285);
+	t__2e1289 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1284 = (u64)((u64)t__2e1289 * (u64)((u64)4UL));
+	t__2e1284 = (u64)((u64)t__2e1287 + (u64)t__2e1284);
+	t__2e1290 = (u64)(u32)(((u64)t__2e1289 < (u64)t__2e1288));
+	if ((u32)t__2e1290) goto L__2e1292; else goto L__2e1291;
+	L__2e1291:;
+	t_abortsite_2e1091 = ((u64)16UL);
+	goto L_abort_2e1092;
+	L__2e1292:;
+	t__2e1293 = (u64)(u32)(*(i32 *)t__2e1284);
+	t__2e1283 = (u64)(u32)(((u32)t__2e1293 == (u32)((u64)0UL)));
+	t__2e1280 = (u64)(u32)t__2e1283;
+	if ((u32)t__2e1280) goto L__2e1281; else goto L__2e1282;
+	L__2e1281:;
+	t__2e1296 = (u64)((u64)t_binding_2e1183 + (u64)((u64)8UL));
+	t__2e1297 = (u64)((u64)t_binding_2e1183 + (u64)((u64)16UL));
+	t__2e1298 = (u64)(*(u64 *)t_binding_2e1183);
+	t__2e1299 = (u64)(*(u64 *)t__2e1296);
+	t__2e1300 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1295 = (u64)((u64)t__2e1300 * (u64)((u64)4UL));
+	t__2e1295 = (u64)((u64)t__2e1298 + (u64)t__2e1295);
+	t__2e1301 = (u64)(u32)(((u64)t__2e1300 < (u64)t__2e1299));
+	if ((u32)t__2e1301) goto L__2e1303; else goto L__2e1302;
+	L__2e1302:;
+	t_abortsite_2e1091 = ((u64)17UL);
+	goto L_abort_2e1092;
+	L__2e1303:;
+	t__2e1304 = (u64)(u32)(*(i32 *)t__2e1295);
+	t__2e1294 = (u64)(u32)(((u32)t__2e1304 == (u32)((u64)0UL)));
+	t__2e1280 = (u64)(u32)t__2e1294;
+	goto L__2e1282;
+	L__2e1282:;
+	t__2e1277 = (u64)(u32)t__2e1280;
+	if ((u32)t__2e1277) goto L__2e1278; else goto L__2e1279;
+	L__2e1278:;
+	t__2e1307 = (u64)((u64)t_binding_2e1183 + (u64)((u64)8UL));
+	t__2e1308 = (u64)((u64)t_binding_2e1183 + (u64)((u64)16UL));
+	t__2e1309 = (u64)(*(u64 *)t_binding_2e1183);
+	t__2e1310 = (u64)(*(u64 *)t__2e1307);
+	t__2e1311 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1306 = (u64)((u64)t__2e1311 * (u64)((u64)4UL));
+	t__2e1306 = (u64)((u64)t__2e1309 + (u64)t__2e1306);
+	t__2e1312 = (u64)(u32)(((u64)t__2e1311 < (u64)t__2e1310));
+	if ((u32)t__2e1312) goto L__2e1314; else goto L__2e1313;
+	L__2e1313:;
+	t_abortsite_2e1091 = ((u64)18UL);
+	goto L_abort_2e1092;
+	L__2e1314:;
+	t__2e1315 = (u64)(u32)(*(i32 *)t__2e1306);
+	t__2e1305 = (u64)(u32)(((u32)t__2e1315 == (u32)((u64)0UL)));
+	t__2e1277 = (u64)(u32)t__2e1305;
+	goto L__2e1279;
+	L__2e1279:;
+	if ((u32)t__2e1277) goto L_passed_2e1276; else goto L_failed_2e1275;
+	L_failed_2e1275:;
+	t_abortsite_2e1091 = ((u64)19UL);
+	goto L_abort_2e1157;
+	L_passed_2e1276:;
+	t_item_2e1318 = (u64)((u64)t_object_2e1317 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1318 = (u32)((u64)1UL);
+	t_item_2e1318 = (u64)((u64)t_object_2e1317 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1318 = (u32)((u64)2UL);
+	t_item_2e1318 = (u64)((u64)t_object_2e1317 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1318 = (u32)((u64)3UL);
+	t_item_2e1318 = (u64)((u64)t_object_2e1317 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e1318 = (u32)((u64)4UL);
+	t_item_2e1318 = (u64)((u64)t_object_2e1317 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e1318 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e1316 = (u64)t_object_2e1317;
+	t__2e1319 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	*(u64 *)t__2e1319 = (u64)((u64)5UL);
+	t__2e1319 = (u64)((u64)t__2e1319 + (u64)((u64)8UL));
+	*(u64 *)t__2e1319 = (u64)((u64)5UL);
+	t__2e1320 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1321 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1322 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1323 = (u64)(*(u64 *)t__2e1320);
+	t__2e1324 = (u64)(*(u64 *)t__2e1321);
+	t__2e1325 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1326 = (u64)((i64)(i32)((u64)4UL));
+	t__2e1327 = (u64)((u64)t__2e1326 - (u64)t__2e1325);
+	t__2e1330 = (u64)(u32)(((u64)t__2e1325 <= (u64)t__2e1326));
+	t__2e1329 = (u64)(u32)(((u64)t__2e1326 <= (u64)t__2e1323));
+	t__2e1331 = (u64)(u32)((u32)t__2e1330 & (u32)t__2e1329);
+	t__2e1327 = (u64)((u64)t__2e1326 - (u64)t__2e1325);
+	t__2e1328 = (u64)((u64)t__2e1324 - (u64)t__2e1325);
+	if ((u32)t__2e1331) goto L__2e1333; else goto L__2e1332;
+	L__2e1332:;
+	t_abortsite_2e1091 = ((u64)20UL);
+	goto L_abort_2e1092;
+	L__2e1333:;
+	t_item_2e1336 = (u64)((u64)t_object_2e1335 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1336 = (u32)((u64)42UL);
+	t_item_2e1336 = (u64)((u64)t_object_2e1335 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1336 = (u32)((u64)69UL);
+	t_item_2e1336 = (u64)((u64)t_object_2e1335 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1336 = (u32)((u64)1337UL);
+	*(u64 *)t_object_2e1334 = (u64)t_object_2e1335;
+	t__2e1337 = (u64)((u64)t_object_2e1334 + (u64)((u64)8UL));
+	*(u64 *)t__2e1337 = (u64)((u64)3UL);
+	t__2e1337 = (u64)((u64)t__2e1337 + (u64)((u64)8UL));
+	*(u64 *)t__2e1337 = (u64)((u64)3UL);
+	t__2e1339 = (u64)((u64)t_object_2e1334 + (u64)((u64)8UL));
+	t__2e1338 = (u64)(*(u64 *)t__2e1339);
+	t__2e1342 = (u64)(((u64)t__2e1327 == (u64)t__2e1338));
+	if ((u32)t__2e1342) goto L__2e1341; else goto L__2e1340;
+	L__2e1340:;
+	t_abortsite_2e1091 = ((u64)21UL);
+	goto L_abort_2e1092;
+	L__2e1341:;
+	t__2e1344 = (u64)((u64)t__2e1325 * (u64)((u64)4UL));
+	t__2e1322 = (u64)((u64)t__2e1322 + (u64)t__2e1344);
+	t__2e1343 = (u64)(*(u64 *)t_object_2e1334);
+	t__2e1327 = (u64)((u64)t__2e1327 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1322, (u64)t__2e1343, (u64)t__2e1327);
+	t__2e1361 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1362 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1363 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1364 = (u64)(*(u64 *)t__2e1361);
+	t__2e1365 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1360 = (u64)((u64)t__2e1365 * (u64)((u64)4UL));
+	t__2e1360 = (u64)((u64)t__2e1363 + (u64)t__2e1360);
+	t__2e1366 = (u64)(u32)(((u64)t__2e1365 < (u64)t__2e1364));
+	if ((u32)t__2e1366) goto L__2e1368; else goto L__2e1367;
+	L__2e1367:;
+	t_abortsite_2e1091 = ((u64)22UL);
+	goto L_abort_2e1092;
+	L__2e1368:;
+	t__2e1369 = (u64)(u32)(*(i32 *)t__2e1360);
+	t__2e1359 = (u64)(u32)(((u32)t__2e1369 == (u32)((u64)1UL)));
+	t__2e1356 = (u64)(u32)t__2e1359;
+	if ((u32)t__2e1356) goto L__2e1357; else goto L__2e1358;
+	L__2e1357:;
+	t__2e1372 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1373 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1374 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1375 = (u64)(*(u64 *)t__2e1372);
+	t__2e1376 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1371 = (u64)((u64)t__2e1376 * (u64)((u64)4UL));
+	t__2e1371 = (u64)((u64)t__2e1374 + (u64)t__2e1371);
+	t__2e1377 = (u64)(u32)(((u64)t__2e1376 < (u64)t__2e1375));
+	if ((u32)t__2e1377) goto L__2e1379; else goto L__2e1378;
+	L__2e1378:;
+	t_abortsite_2e1091 = ((u64)23UL);
+	goto L_abort_2e1092;
+	L__2e1379:;
+	t__2e1380 = (u64)(u32)(*(i32 *)t__2e1371);
+	t__2e1370 = (u64)(u32)(((u32)t__2e1380 == (u32)((u64)42UL)));
+	t__2e1356 = (u64)(u32)t__2e1370;
+	goto L__2e1358;
+	L__2e1358:;
+	t__2e1353 = (u64)(u32)t__2e1356;
+	if ((u32)t__2e1353) goto L__2e1354; else goto L__2e1355;
+	L__2e1354:;
+	t__2e1383 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1384 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1385 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1386 = (u64)(*(u64 *)t__2e1383);
+	t__2e1387 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1382 = (u64)((u64)t__2e1387 * (u64)((u64)4UL));
+	t__2e1382 = (u64)((u64)t__2e1385 + (u64)t__2e1382);
+	t__2e1388 = (u64)(u32)(((u64)t__2e1387 < (u64)t__2e1386));
+	if ((u32)t__2e1388) goto L__2e1390; else goto L__2e1389;
+	L__2e1389:;
+	t_abortsite_2e1091 = ((u64)24UL);
+	goto L_abort_2e1092;
+	L__2e1390:;
+	t__2e1391 = (u64)(u32)(*(i32 *)t__2e1382);
+	t__2e1381 = (u64)(u32)(((u32)t__2e1391 == (u32)((u64)69UL)));
+	t__2e1353 = (u64)(u32)t__2e1381;
+	goto L__2e1355;
+	L__2e1355:;
+	t__2e1350 = (u64)(u32)t__2e1353;
+	if ((u32)t__2e1350) goto L__2e1351; else goto L__2e1352;
+	L__2e1351:;
+	t__2e1394 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1395 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1396 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1397 = (u64)(*(u64 *)t__2e1394);
+	t__2e1398 = (u64)((i64)(i32)((u64)3UL));
+	t__2e1393 = (u64)((u64)t__2e1398 * (u64)((u64)4UL));
+	t__2e1393 = (u64)((u64)t__2e1396 + (u64)t__2e1393);
+	t__2e1399 = (u64)(u32)(((u64)t__2e1398 < (u64)t__2e1397));
+	if ((u32)t__2e1399) goto L__2e1401; else goto L__2e1400;
+	L__2e1400:;
+	t_abortsite_2e1091 = ((u64)25UL);
+	goto L_abort_2e1092;
+	L__2e1401:;
+	t__2e1402 = (u64)(u32)(*(i32 *)t__2e1393);
+	t__2e1392 = (u64)(u32)(((u32)t__2e1402 == (u32)((u64)1337UL)));
+	t__2e1350 = (u64)(u32)t__2e1392;
+	goto L__2e1352;
+	L__2e1352:;
+	t__2e1347 = (u64)(u32)t__2e1350;
+	if ((u32)t__2e1347) goto L__2e1348; else goto L__2e1349;
+	L__2e1348:;
+	t__2e1405 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1406 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1407 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1408 = (u64)(*(u64 *)t__2e1405);
+	t__2e1409 = (u64)((i64)(i32)((u64)4UL));
+	t__2e1404 = (u64)((u64)t__2e1409 * (u64)((u64)4UL));
+	t__2e1404 = (u64)((u64)t__2e1407 + (u64)t__2e1404);
+	t__2e1410 = (u64)(u32)(((u64)t__2e1409 < (u64)t__2e1408));
+	if ((u32)t__2e1410) goto L__2e1412; else goto L__2e1411;
+	L__2e1411:;
+	t_abortsite_2e1091 = ((u64)26UL);
+	goto L_abort_2e1092;
+	L__2e1412:;
+	t__2e1413 = (u64)(u32)(*(i32 *)t__2e1404);
+	t__2e1403 = (u64)(u32)(((u32)t__2e1413 == (u32)((u64)5UL)));
+	t__2e1347 = (u64)(u32)t__2e1403;
+	goto L__2e1349;
+	L__2e1349:;
+	if ((u32)t__2e1347) goto L_passed_2e1346; else goto L_failed_2e1345;
+	L_failed_2e1345:;
+	t_abortsite_2e1091 = ((u64)27UL);
+	goto L_abort_2e1157;
+	L_passed_2e1346:;
+	t__2e1414 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1415 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1416 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1417 = (u64)(*(u64 *)t__2e1414);
+	t__2e1418 = (u64)(*(u64 *)t__2e1415);
+	t__2e1419 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1420 = (u64)((i64)(i32)((u64)5UL));
+	t__2e1421 = (u64)((u64)t__2e1420 - (u64)t__2e1419);
+	t__2e1424 = (u64)(u32)(((u64)t__2e1419 <= (u64)t__2e1420));
+	t__2e1423 = (u64)(u32)(((u64)t__2e1420 <= (u64)t__2e1417));
+	t__2e1425 = (u64)(u32)((u32)t__2e1424 & (u32)t__2e1423);
+	t__2e1421 = (u64)((u64)t__2e1420 - (u64)t__2e1419);
+	t__2e1422 = (u64)((u64)t__2e1418 - (u64)t__2e1419);
+	if ((u32)t__2e1425) goto L__2e1427; else goto L__2e1426;
+	L__2e1426:;
+	t_abortsite_2e1091 = ((u64)28UL);
+	goto L_abort_2e1092;
+	L__2e1427:;
+	t__2e1429 = (u64)((u64)t_binding_2e1183 + (u64)((u64)8UL));
+	t__2e1428 = (u64)(*(u64 *)t__2e1429);
+	t__2e1432 = (u64)(((u64)t__2e1421 == (u64)t__2e1428));
+	if ((u32)t__2e1432) goto L__2e1431; else goto L__2e1430;
+	L__2e1430:;
+	t_abortsite_2e1091 = ((u64)29UL);
+	goto L_abort_2e1092;
+	L__2e1431:;
+	t__2e1434 = (u64)((u64)t__2e1419 * (u64)((u64)4UL));
+	t__2e1416 = (u64)((u64)t__2e1416 + (u64)t__2e1434);
+	t__2e1433 = (u64)(*(u64 *)t_binding_2e1183);
+	t__2e1421 = (u64)((u64)t__2e1421 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1416, (u64)t__2e1433, (u64)t__2e1421);
+	t__2e1451 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1452 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1453 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1454 = (u64)(*(u64 *)t__2e1451);
+	t__2e1455 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1450 = (u64)((u64)t__2e1455 * (u64)((u64)4UL));
+	t__2e1450 = (u64)((u64)t__2e1453 + (u64)t__2e1450);
+	t__2e1456 = (u64)(u32)(((u64)t__2e1455 < (u64)t__2e1454));
+	if ((u32)t__2e1456) goto L__2e1458; else goto L__2e1457;
+	L__2e1457:;
+	t_abortsite_2e1091 = ((u64)30UL);
+	goto L_abort_2e1092;
+	L__2e1458:;
+	t__2e1459 = (u64)(u32)(*(i32 *)t__2e1450);
+	t__2e1449 = (u64)(u32)(((u32)t__2e1459 == (u32)((u64)1UL)));
+	t__2e1446 = (u64)(u32)t__2e1449;
+	if ((u32)t__2e1446) goto L__2e1447; else goto L__2e1448;
+	L__2e1447:;
+	t__2e1462 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1463 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1464 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1465 = (u64)(*(u64 *)t__2e1462);
+	t__2e1466 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1461 = (u64)((u64)t__2e1466 * (u64)((u64)4UL));
+	t__2e1461 = (u64)((u64)t__2e1464 + (u64)t__2e1461);
+	t__2e1467 = (u64)(u32)(((u64)t__2e1466 < (u64)t__2e1465));
+	if ((u32)t__2e1467) goto L__2e1469; else goto L__2e1468;
+	L__2e1468:;
+	t_abortsite_2e1091 = ((u64)31UL);
+	goto L_abort_2e1092;
+	L__2e1469:;
+	t__2e1470 = (u64)(u32)(*(i32 *)t__2e1461);
+	t__2e1460 = (u64)(u32)(((u32)t__2e1470 == (u32)((u64)42UL)));
+	t__2e1446 = (u64)(u32)t__2e1460;
+	goto L__2e1448;
+	L__2e1448:;
+	t__2e1443 = (u64)(u32)t__2e1446;
+	if ((u32)t__2e1443) goto L__2e1444; else goto L__2e1445;
+	L__2e1444:;
+	t__2e1473 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1474 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1475 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1476 = (u64)(*(u64 *)t__2e1473);
+	t__2e1477 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1472 = (u64)((u64)t__2e1477 * (u64)((u64)4UL));
+	t__2e1472 = (u64)((u64)t__2e1475 + (u64)t__2e1472);
+	t__2e1478 = (u64)(u32)(((u64)t__2e1477 < (u64)t__2e1476));
+	if ((u32)t__2e1478) goto L__2e1480; else goto L__2e1479;
+	L__2e1479:;
+	t_abortsite_2e1091 = ((u64)32UL);
+	goto L_abort_2e1092;
+	L__2e1480:;
+	t__2e1481 = (u64)(u32)(*(i32 *)t__2e1472);
+	t__2e1471 = (u64)(u32)(((u32)t__2e1481 == (u32)((u64)0UL)));
+	t__2e1443 = (u64)(u32)t__2e1471;
+	goto L__2e1445;
+	L__2e1445:;
+	t__2e1440 = (u64)(u32)t__2e1443;
+	if ((u32)t__2e1440) goto L__2e1441; else goto L__2e1442;
+	L__2e1441:;
+	t__2e1484 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1485 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1486 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1487 = (u64)(*(u64 *)t__2e1484);
+	t__2e1488 = (u64)((i64)(i32)((u64)3UL));
+	t__2e1483 = (u64)((u64)t__2e1488 * (u64)((u64)4UL));
+	t__2e1483 = (u64)((u64)t__2e1486 + (u64)t__2e1483);
+	t__2e1489 = (u64)(u32)(((u64)t__2e1488 < (u64)t__2e1487));
+	if ((u32)t__2e1489) goto L__2e1491; else goto L__2e1490;
+	L__2e1490:;
+	t_abortsite_2e1091 = ((u64)33UL);
+	goto L_abort_2e1092;
+	L__2e1491:;
+	t__2e1492 = (u64)(u32)(*(i32 *)t__2e1483);
+	t__2e1482 = (u64)(u32)(((u32)t__2e1492 == (u32)((u64)0UL)));
+	t__2e1440 = (u64)(u32)t__2e1482;
+	goto L__2e1442;
+	L__2e1442:;
+	t__2e1437 = (u64)(u32)t__2e1440;
+	if ((u32)t__2e1437) goto L__2e1438; else goto L__2e1439;
+	L__2e1438:;
+	t__2e1495 = (u64)((u64)t_binding_2e1316 + (u64)((u64)8UL));
+	t__2e1496 = (u64)((u64)t_binding_2e1316 + (u64)((u64)16UL));
+	t__2e1497 = (u64)(*(u64 *)t_binding_2e1316);
+	t__2e1498 = (u64)(*(u64 *)t__2e1495);
+	t__2e1499 = (u64)((i64)(i32)((u64)4UL));
+	t__2e1494 = (u64)((u64)t__2e1499 * (u64)((u64)4UL));
+	t__2e1494 = (u64)((u64)t__2e1497 + (u64)t__2e1494);
+	t__2e1500 = (u64)(u32)(((u64)t__2e1499 < (u64)t__2e1498));
+	if ((u32)t__2e1500) goto L__2e1502; else goto L__2e1501;
+	L__2e1501:;
+	t_abortsite_2e1091 = ((u64)34UL);
+	goto L_abort_2e1092;
+	L__2e1502:;
+	t__2e1503 = (u64)(u32)(*(i32 *)t__2e1494);
+	t__2e1493 = (u64)(u32)(((u32)t__2e1503 == (u32)((u64)0UL)));
+	t__2e1437 = (u64)(u32)t__2e1493;
+	goto L__2e1439;
+	L__2e1439:;
+	if ((u32)t__2e1437) goto L_passed_2e1436; else goto L_failed_2e1435;
+	L_failed_2e1435:;
+	t_abortsite_2e1091 = ((u64)35UL);
+	goto L_abort_2e1157;
+	L_passed_2e1436:;
+	BLIT(t_binding_2e1504, t_binding_2e1316, ((u64)24UL));
+	t__2e1505 = (u64)((u64)t_binding_2e1504 + (u64)((u64)8UL));
+	t__2e1506 = (u64)((u64)t_binding_2e1504 + (u64)((u64)16UL));
+	t__2e1507 = (u64)(*(u64 *)t_binding_2e1504);
+	t__2e1508 = (u64)(*(u64 *)t__2e1505);
+	t__2e1509 = (u64)(*(u64 *)t__2e1506);
+	t__2e1510 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1511 = (u64)((i64)(i32)((u64)5UL));
+	t__2e1512 = (u64)((u64)t__2e1511 - (u64)t__2e1510);
+	t__2e1515 = (u64)(u32)(((u64)t__2e1510 <= (u64)t__2e1511));
+	t__2e1514 = (u64)(u32)(((u64)t__2e1511 <= (u64)t__2e1508));
+	t__2e1516 = (u64)(u32)((u32)t__2e1515 & (u32)t__2e1514);
+	t__2e1512 = (u64)((u64)t__2e1511 - (u64)t__2e1510);
+	t__2e1513 = (u64)((u64)t__2e1509 - (u64)t__2e1510);
+	if ((u32)t__2e1516) goto L__2e1518; else goto L__2e1517;
+	L__2e1517:;
+	t_abortsite_2e1091 = ((u64)36UL);
+	goto L_abort_2e1092;
+	L__2e1518:;
+	t__2e1520 = (u64)((u64)t_binding_2e1183 + (u64)((u64)8UL));
+	t__2e1519 = (u64)(*(u64 *)t__2e1520);
+	t__2e1523 = (u64)(((u64)t__2e1512 == (u64)t__2e1519));
+	if ((u32)t__2e1523) goto L__2e1522; else goto L__2e1521;
+	L__2e1521:;
+	t_abortsite_2e1091 = ((u64)37UL);
+	goto L_abort_2e1092;
+	L__2e1522:;
+	t__2e1525 = (u64)((u64)t__2e1510 * (u64)((u64)4UL));
+	t__2e1507 = (u64)((u64)t__2e1507 + (u64)t__2e1525);
+	t__2e1524 = (u64)(*(u64 *)t_binding_2e1183);
+	t__2e1512 = (u64)((u64)t__2e1512 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1507, (u64)t__2e1524, (u64)t__2e1512);
+	*(u64 *)t_binding_2e1526 = (u64)t_binding_2e1504;
+	t__2e1527 = (u64)(*(u64 *)t_binding_2e1526);
+	t__2e1528 = (u64)((u64)t__2e1527 + (u64)((u64)8UL));
+	t__2e1529 = (u64)((u64)t__2e1527 + (u64)((u64)16UL));
+	t__2e1530 = (u64)(*(u64 *)t__2e1527);
+	t__2e1531 = (u64)(*(u64 *)t__2e1528);
+	t__2e1532 = (u64)(*(u64 *)t__2e1529);
+	t__2e1533 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1534 = (u64)((i64)(i32)((u64)5UL));
+	t__2e1535 = (u64)((u64)t__2e1534 - (u64)t__2e1533);
+	t__2e1538 = (u64)(u32)(((u64)t__2e1533 <= (u64)t__2e1534));
+	t__2e1537 = (u64)(u32)(((u64)t__2e1534 <= (u64)t__2e1531));
+	t__2e1539 = (u64)(u32)((u32)t__2e1538 & (u32)t__2e1537);
+	t__2e1535 = (u64)((u64)t__2e1534 - (u64)t__2e1533);
+	t__2e1536 = (u64)((u64)t__2e1532 - (u64)t__2e1533);
+	if ((u32)t__2e1539) goto L__2e1541; else goto L__2e1540;
+	L__2e1540:;
+	t_abortsite_2e1091 = ((u64)38UL);
+	goto L_abort_2e1092;
+	L__2e1541:;
+	t__2e1543 = (u64)((u64)t_binding_2e1183 + (u64)((u64)8UL));
+	t__2e1542 = (u64)(*(u64 *)t__2e1543);
+	t__2e1546 = (u64)(((u64)t__2e1535 == (u64)t__2e1542));
+	if ((u32)t__2e1546) goto L__2e1545; else goto L__2e1544;
+	L__2e1544:;
+	t_abortsite_2e1091 = ((u64)39UL);
+	goto L_abort_2e1092;
+	L__2e1545:;
+	t__2e1548 = (u64)((u64)t__2e1533 * (u64)((u64)4UL));
+	t__2e1530 = (u64)((u64)t__2e1530 + (u64)t__2e1548);
+	t__2e1547 = (u64)(*(u64 *)t_binding_2e1183);
+	t__2e1535 = (u64)((u64)t__2e1535 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1530, (u64)t__2e1547, (u64)t__2e1535);
+	*(u64 *)t_binding_2e1549 = (u64)((u64)0UL);
+	t__2e1550 = (u64)((u64)t_binding_2e1549 + (u64)((u64)8UL));
+	*(u64 *)t__2e1550 = (u64)((u64)0UL);
+	t__2e1550 = (u64)((u64)t__2e1550 + (u64)((u64)8UL));
+	*(u64 *)t__2e1550 = (u64)((u64)0UL);
+	BLIT(t_binding_2e1551, t_binding_2e1549, ((u64)24UL));
+	*(u64 *)t_object_2e1554 = (u64)((u64)0UL);
+	t__2e1555 = (u64)((u64)t_object_2e1554 + (u64)((u64)8UL));
+	*(u64 *)t__2e1555 = (u64)((u64)0UL);
+	t__2e1555 = (u64)((u64)t__2e1555 + (u64)((u64)8UL));
+	*(u64 *)t__2e1555 = (u64)((u64)0UL);
+	BLIT(t_binding_2e1553, t_object_2e1554, ((u64)24UL));
+	*(u32 *)t_object_2e1558 = (u32)((u64)3532310079UL);
+	t__2e1559 = (u64)((u64)t_object_2e1558 + (u64)((u64)4UL));
+	*(u32 *)t__2e1559 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1562 = (u64)((u64)0UL);
+	t__2e1563 = (u64)((u64)t_object_2e1562 + (u64)((u64)8UL));
+	*(u64 *)t__2e1563 = (u64)((u64)0UL);
+	t__2e1563 = (u64)((u64)t__2e1563 + (u64)((u64)8UL));
+	*(u64 *)t__2e1563 = (u64)((u64)0UL);
+	BLIT((u64)B21, t_object_2e1558, 8);
+	BLIT((u64)B22, ((u64)((char *)&D_strliteral_2e1561)), 24);
+	BLIT((u64)B23, t_object_2e1562, 24);
+	t__2e1557 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R24, (u64)B21, (u64)B22, (u64)B23);
+	t_tag_2e1564 = (u64)(*(u32 *)t__2e1557);
+	t__2e1572 = (u64)(u32)(((u32)t_tag_2e1564 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1572) goto L_member_2e1569; else goto L__2e1571;
+	L__2e1571:;
+	t__2e1574 = (u64)(u32)(((u32)t_tag_2e1564 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1574) goto L_member_2e1570; else goto L__2e1573;
+	L__2e1573:;
+	goto L_matches_2e1568;
+	L_member_2e1569:;
+	goto L_matches_2e1568;
+	L_member_2e1570:;
+	goto L_matches_2e1567;
+	L_matches_2e1567:;
+	goto L__2e1565;
+	L_matches_2e1568:;
+	t_abortsite_2e1091 = ((u64)40UL);
+	goto L_abort_2e1575;
+	L__2e1581:;
+	L__2e1566:;
+	t_abortsite_2e1091 = ((u64)41UL);
+	goto L_abort_2e1582;
+	L__2e1565:;
+	*(u32 *)t_object_2e1590 = (u32)((u64)3532310079UL);
+	t__2e1591 = (u64)((u64)t_object_2e1590 + (u64)((u64)4UL));
+	*(u32 *)t__2e1591 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1594 = (u64)((u64)0UL);
+	t__2e1595 = (u64)((u64)t_object_2e1594 + (u64)((u64)8UL));
+	*(u64 *)t__2e1595 = (u64)((u64)0UL);
+	t__2e1595 = (u64)((u64)t__2e1595 + (u64)((u64)8UL));
+	*(u64 *)t__2e1595 = (u64)((u64)0UL);
+	BLIT((u64)B25, t_object_2e1590, 8);
+	BLIT((u64)B26, ((u64)((char *)&D_strliteral_2e1593)), 24);
+	BLIT((u64)B27, t_object_2e1594, 24);
+	t__2e1589 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R28, (u64)B25, (u64)B26, (u64)B27);
+	t_tag_2e1596 = (u64)(*(u32 *)t__2e1589);
+	t__2e1604 = (u64)(u32)(((u32)t_tag_2e1596 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1604) goto L_member_2e1601; else goto L__2e1603;
+	L__2e1603:;
+	t__2e1606 = (u64)(u32)(((u32)t_tag_2e1596 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1606) goto L_member_2e1602; else goto L__2e1605;
+	L__2e1605:;
+	goto L_matches_2e1600;
+	L_member_2e1601:;
+	goto L_matches_2e1600;
+	L_member_2e1602:;
+	goto L_matches_2e1599;
+	L_matches_2e1599:;
+	goto L__2e1597;
+	L_matches_2e1600:;
+	t_abortsite_2e1091 = ((u64)42UL);
+	goto L_abort_2e1575;
+	L__2e1607:;
+	L__2e1598:;
+	t_abortsite_2e1091 = ((u64)43UL);
+	goto L_abort_2e1582;
+	L__2e1597:;
+	*(u32 *)t_object_2e1610 = (u32)((u64)3532310079UL);
+	t__2e1611 = (u64)((u64)t_object_2e1610 + (u64)((u64)4UL));
+	*(u32 *)t__2e1611 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1614 = (u64)((u64)0UL);
+	t__2e1615 = (u64)((u64)t_object_2e1614 + (u64)((u64)8UL));
+	*(u64 *)t__2e1615 = (u64)((u64)0UL);
+	t__2e1615 = (u64)((u64)t__2e1615 + (u64)((u64)8UL));
+	*(u64 *)t__2e1615 = (u64)((u64)0UL);
+	BLIT((u64)B29, t_object_2e1610, 8);
+	BLIT((u64)B30, ((u64)((char *)&D_strliteral_2e1613)), 24);
+	BLIT((u64)B31, t_object_2e1614, 24);
+	t__2e1609 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R32, (u64)B29, (u64)B30, (u64)B31);
+	t_tag_2e1616 = (u64)(*(u32 *)t__2e1609);
+	t__2e1624 = (u64)(u32)(((u32)t_tag_2e1616 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1624) goto L_member_2e1621; else goto L__2e1623;
+	L__2e1623:;
+	t__2e1626 = (u64)(u32)(((u32)t_tag_2e1616 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1626) goto L_member_2e1622; else goto L__2e1625;
+	L__2e1625:;
+	goto L_matches_2e1620;
+	L_member_2e1621:;
+	goto L_matches_2e1620;
+	L_member_2e1622:;
+	goto L_matches_2e1619;
+	L_matches_2e1619:;
+	goto L__2e1617;
+	L_matches_2e1620:;
+	t_abortsite_2e1091 = ((u64)44UL);
+	goto L_abort_2e1575;
+	L__2e1627:;
+	L__2e1618:;
+	t_abortsite_2e1091 = ((u64)45UL);
+	goto L_abort_2e1582;
+	L__2e1617:;
+	goto L__2e1075;
+	L__2e1628:;
+	L__2e1075:;
+	return;
+	L_abort_2e1092:;
+	t__2e1093 = (u64)((u64)t_abortsite_2e1091 * (u64)((u64)16UL));
+	t__2e1093 = (u64)((u64)((u64)((char *)&D_abortsites_2e1090)) + (u64)t__2e1093);
+	t__2e1094 = (u64)(*(u64 *)t__2e1093);
+	t__2e1095 = (u64)((u64)t__2e1093 + (u64)((u64)8UL));
+	t__2e1096 = (u64)(*(u32 *)t__2e1095);
+	t__2e1095 = (u64)((u64)t__2e1093 + (u64)((u64)12UL));
+	t__2e1097 = (u64)(*(u32 *)t__2e1095);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1094, (u64)t__2e1096, (u64)t__2e1097, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e1157:;
+	t__2e1158 = (u64)((u64)t_abortsite_2e1091 * (u64)((u64)16UL));
+	t__2e1158 = (u64)((u64)((u64)((char *)&D_abortsites_2e1090)) + (u64)t__2e1158);
+	t__2e1159 = (u64)(*(u64 *)t__2e1158);
+	t__2e1160 = (u64)((u64)t__2e1158 + (u64)((u64)8UL));
+	t__2e1161 = (u64)(*(u32 *)t__2e1160);
+	t__2e1160 = (u64)((u64)t__2e1158 + (u64)((u64)12UL));
+	t__2e1162 = (u64)(*(u32 *)t__2e1160);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1159, (u64)t__2e1161, (u64)t__2e1162, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1575:;
+	t__2e1576 = (u64)((u64)t_abortsite_2e1091 * (u64)((u64)16UL));
+	t__2e1576 = (u64)((u64)((u64)((char *)&D_abortsites_2e1090)) + (u64)t__2e1576);
+	t__2e1577 = (u64)(*(u64 *)t__2e1576);
+	t__2e1578 = (u64)((u64)t__2e1576 + (u64)((u64)8UL));
+	t__2e1579 = (u64)(*(u32 *)t__2e1578);
+	t__2e1578 = (u64)((u64)t__2e1576 + (u64)((u64)12UL));
+	t__2e1580 = (u64)(*(u32 *)t__2e1578);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1577, (u64)t__2e1579, (u64)t__2e1580, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e1582:;
+	t__2e1583 = (u64)((u64)t_abortsite_2e1091 * (u64)((u64)16UL));
+	t__2e1583 = (u64)((u64)((u64)((char *)&D_abortsites_2e1090)) + (u64)t__2e1583);
+	t__2e1584 = (u64)(*(u64 *)t__2e1583);
+	t__2e1585 = (u64)((u64)t__2e1583 + (u64)((u64)8UL));
+	t__2e1586 = (u64)(*(u32 *)t__2e1585);
+	t__2e1585 = (u64)((u64)t__2e1583 + (u64)((u64)12UL));
+	t__2e1587 = (u64)(*(u32 *)t__2e1585);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1584, (u64)t__2e1586, (u64)t__2e1587, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_zero3(u64 p_s) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[12] __attribute__((aligned(16)));
+	u64 t__2e1633;
+	u64 t__2e1634;
+	u64 t__2e1635;
+	u64 t__2e1636;
+	u64 t__2e1637;
+	u64 t__2e1638;
+	u64 t__2e1639;
+	u64 t__2e1646;
+	u64 t__2e1647;
+	u64 t__2e1648;
+	u64 t__2e1651;
+	u64 t__2e1655;
+	u64 t__2e1656;
+	u64 t__2e1657;
+	u64 t__2e1658;
+	u64 t__2e1659;
+	u64 t__2e1660;
+	u64 t__2e1661;
+	u64 t_abortsite_2e1653;
+	u64 t_item_2e1645;
+	u64 t_object_2e1643;
+	u64 t_object_2e1644;
+	u64 t_s;
+	t_s = p_s;
+	L_start_2e1629:;
+	t_object_2e1643 = (u64)A0;
+	t_object_2e1644 = (u64)A1;
+	L_body_2e1630:;
+	t__2e1633 = (u64)((u64)t_s + (u64)((u64)8UL));
+	t__2e1634 = (u64)((u64)t_s + (u64)((u64)16UL));
+	t__2e1635 = (u64)(*(u64 *)t_s);
+	t__2e1636 = (u64)(*(u64 *)t__2e1633);
+	t__2e1637 = (u64)(*(u64 *)t__2e1634);
+	t__2e1638 = (u64)((u64)t__2e1636 - (u64)((u64)0UL));
+	t__2e1638 = t__2e1636;
+	t__2e1639 = t__2e1637;
+	t_item_2e1645 = (u64)((u64)t_object_2e1644 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)0UL);
+	t_item_2e1645 = (u64)((u64)t_object_2e1644 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)0UL);
+	t_item_2e1645 = (u64)((u64)t_object_2e1644 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1645 = (u32)((u64)0UL);
+	*(u64 *)t_object_2e1643 = (u64)t_object_2e1644;
+	t__2e1646 = (u64)((u64)t_object_2e1643 + (u64)((u64)8UL));
+	*(u64 *)t__2e1646 = (u64)((u64)3UL);
+	t__2e1646 = (u64)((u64)t__2e1646 + (u64)((u64)8UL));
+	*(u64 *)t__2e1646 = (u64)((u64)3UL);
+	t__2e1648 = (u64)((u64)t_object_2e1643 + (u64)((u64)8UL));
+	t__2e1647 = (u64)(*(u64 *)t__2e1648);
+	t__2e1651 = (u64)(((u64)t__2e1638 == (u64)t__2e1647));
+	if ((u32)t__2e1651) goto L__2e1650; else goto L__2e1649;
+	L__2e1649:;
+	t_abortsite_2e1653 = ((u64)0UL);
+	goto L_abort_2e1654;
+	L__2e1650:;
+	t__2e1661 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t__2e1635 = (u64)((u64)t__2e1635 + (u64)t__2e1661);
+	t__2e1660 = (u64)(*(u64 *)t_object_2e1643);
+	t__2e1638 = (u64)((u64)t__2e1638 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1635, (u64)t__2e1660, (u64)t__2e1638);
+	goto L__2e1631;
+	L__2e1662:;
+	L__2e1631:;
+	return;
+	L_abort_2e1654:;
+	t__2e1655 = (u64)((u64)t_abortsite_2e1653 * (u64)((u64)16UL));
+	t__2e1655 = (u64)((u64)((u64)((char *)&D_abortsites_2e1652)) + (u64)t__2e1655);
+	t__2e1656 = (u64)(*(u64 *)t__2e1655);
+	t__2e1657 = (u64)((u64)t__2e1655 + (u64)((u64)8UL));
+	t__2e1658 = (u64)(*(u32 *)t__2e1657);
+	t__2e1657 = (u64)((u64)t__2e1655 + (u64)((u64)12UL));
+	t__2e1659 = (u64)(*(u32 *)t__2e1657);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1656, (u64)t__2e1658, (u64)t__2e1659, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_indexing(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char B7[8] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char R10[4] __attribute__((aligned(16)));
+	char B11[8] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char R14[4] __attribute__((aligned(16)));
+	char B15[8] __attribute__((aligned(16)));
+	char B16[24] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char R18[4] __attribute__((aligned(16)));
+	u64 t__2e1671;
+	u64 t__2e1674;
+	u64 t__2e1677;
+	u64 t__2e1680;
+	u64 t__2e1681;
+	u64 t__2e1682;
+	u64 t__2e1683;
+	u64 t__2e1684;
+	u64 t__2e1685;
+	u64 t__2e1686;
+	u64 t__2e1687;
+	u64 t__2e1688;
+	u64 t__2e1689;
+	u64 t__2e1690;
+	u64 t__2e1691;
+	u64 t__2e1692;
+	u64 t__2e1693;
+	u64 t__2e1694;
+	u64 t__2e1695;
+	u64 t__2e1699;
+	u64 t__2e1700;
+	u64 t__2e1701;
+	u64 t__2e1702;
+	u64 t__2e1703;
+	u64 t__2e1705;
+	u64 t__2e1707;
+	u64 t__2e1711;
+	u64 t__2e1720;
+	u64 t__2e1722;
+	u64 t__2e1724;
+	u64 t__2e1725;
+	u64 t__2e1726;
+	u64 t__2e1727;
+	u64 t__2e1728;
+	u64 t__2e1731;
+	u64 t__2e1732;
+	u64 t__2e1733;
+	u64 t__2e1734;
+	u64 t__2e1735;
+	u64 t__2e1737;
+	u64 t__2e1739;
+	u64 t__2e1743;
+	u64 t__2e1752;
+	u64 t__2e1754;
+	u64 t__2e1757;
+	u64 t__2e1759;
+	u64 t__2e1763;
+	u64 t__2e1772;
+	u64 t__2e1774;
+	u64 t_abortsite_2e1697;
+	u64 t_binding_2e1667;
+	u64 t_item_2e1668;
+	u64 t_object_2e1706;
+	u64 t_object_2e1710;
+	u64 t_object_2e1738;
+	u64 t_object_2e1742;
+	u64 t_object_2e1758;
+	u64 t_object_2e1762;
+	u64 t_tag_2e1712;
+	u64 t_tag_2e1744;
+	u64 t_tag_2e1764;
+	L_start_2e1663:;
+	t_binding_2e1667 = (u64)A0;
+	t_object_2e1706 = (u64)A1;
+	t_object_2e1710 = (u64)A2;
+	t_object_2e1738 = (u64)A3;
+	t_object_2e1742 = (u64)A4;
+	t_object_2e1758 = (u64)A5;
+	t_object_2e1762 = (u64)A6;
+	L_body_2e1664:;
+	t_item_2e1668 = (u64)((u64)t_binding_2e1667 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1668 = (u32)((u64)1UL);
+	t_item_2e1668 = (u64)((u64)t_binding_2e1667 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1668 = (u32)((u64)3UL);
+	t_item_2e1668 = (u64)((u64)t_binding_2e1667 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1668 = (u32)((u64)3UL);
+	t_item_2e1668 = (u64)((u64)t_binding_2e1667 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e1668 = (u32)((u64)7UL);
+	t__2e1682 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1681 = (u64)((u64)t__2e1682 * (u64)((u64)4UL));
+	t__2e1681 = (u64)((u64)t_binding_2e1667 + (u64)t__2e1681);
+	t__2e1683 = (u64)(u32)(*(i32 *)t__2e1681);
+	t__2e1680 = (u64)(u32)(((u32)t__2e1683 == (u32)((u64)1UL)));
+	t__2e1677 = (u64)(u32)t__2e1680;
+	if ((u32)t__2e1677) goto L__2e1678; else goto L__2e1679;
+	L__2e1678:;
+	t__2e1686 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1685 = (u64)((u64)t__2e1686 * (u64)((u64)4UL));
+	t__2e1685 = (u64)((u64)t_binding_2e1667 + (u64)t__2e1685);
+	t__2e1687 = (u64)(u32)(*(i32 *)t__2e1685);
+	t__2e1684 = (u64)(u32)(((u32)t__2e1687 == (u32)((u64)3UL)));
+	t__2e1677 = (u64)(u32)t__2e1684;
+	goto L__2e1679;
+	L__2e1679:;
+	t__2e1674 = (u64)(u32)t__2e1677;
+	if ((u32)t__2e1674) goto L__2e1675; else goto L__2e1676;
+	L__2e1675:;
+	t__2e1690 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1689 = (u64)((u64)t__2e1690 * (u64)((u64)4UL));
+	t__2e1689 = (u64)((u64)t_binding_2e1667 + (u64)t__2e1689);
+	t__2e1691 = (u64)(u32)(*(i32 *)t__2e1689);
+	t__2e1688 = (u64)(u32)(((u32)t__2e1691 == (u32)((u64)3UL)));
+	t__2e1674 = (u64)(u32)t__2e1688;
+	goto L__2e1676;
+	L__2e1676:;
+	t__2e1671 = (u64)(u32)t__2e1674;
+	if ((u32)t__2e1671) goto L__2e1672; else goto L__2e1673;
+	L__2e1672:;
+	t__2e1694 = (u64)((i64)(i32)((u64)3UL));
+	t__2e1693 = (u64)((u64)t__2e1694 * (u64)((u64)4UL));
+	t__2e1693 = (u64)((u64)t_binding_2e1667 + (u64)t__2e1693);
+	t__2e1695 = (u64)(u32)(*(i32 *)t__2e1693);
+	t__2e1692 = (u64)(u32)(((u32)t__2e1695 == (u32)((u64)7UL)));
+	t__2e1671 = (u64)(u32)t__2e1692;
+	goto L__2e1673;
+	L__2e1673:;
+	if ((u32)t__2e1671) goto L_passed_2e1670; else goto L_failed_2e1669;
+	L_failed_2e1669:;
+	t_abortsite_2e1697 = ((u64)0UL);
+	goto L_abort_2e1698;
+	L_passed_2e1670:;
+	*(u32 *)t_object_2e1706 = (u32)((u64)3532310079UL);
+	t__2e1707 = (u64)((u64)t_object_2e1706 + (u64)((u64)4UL));
+	*(u32 *)t__2e1707 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1710 = (u64)((u64)0UL);
+	t__2e1711 = (u64)((u64)t_object_2e1710 + (u64)((u64)8UL));
+	*(u64 *)t__2e1711 = (u64)((u64)0UL);
+	t__2e1711 = (u64)((u64)t__2e1711 + (u64)((u64)8UL));
+	*(u64 *)t__2e1711 = (u64)((u64)0UL);
+	BLIT((u64)B7, t_object_2e1706, 8);
+	BLIT((u64)B8, ((u64)((char *)&D_strliteral_2e1709)), 24);
+	BLIT((u64)B9, t_object_2e1710, 24);
+	t__2e1705 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R10, (u64)B7, (u64)B8, (u64)B9);
+	t_tag_2e1712 = (u64)(*(u32 *)t__2e1705);
+	t__2e1720 = (u64)(u32)(((u32)t_tag_2e1712 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1720) goto L_member_2e1717; else goto L__2e1719;
+	L__2e1719:;
+	t__2e1722 = (u64)(u32)(((u32)t_tag_2e1712 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1722) goto L_member_2e1718; else goto L__2e1721;
+	L__2e1721:;
+	goto L_matches_2e1716;
+	L_member_2e1717:;
+	goto L_matches_2e1716;
+	L_member_2e1718:;
+	goto L_matches_2e1715;
+	L_matches_2e1715:;
+	goto L__2e1713;
+	L_matches_2e1716:;
+	t_abortsite_2e1697 = ((u64)1UL);
+	goto L_abort_2e1723;
+	L__2e1729:;
+	L__2e1714:;
+	t_abortsite_2e1697 = ((u64)2UL);
+	goto L_abort_2e1730;
+	L__2e1713:;
+	*(u32 *)t_object_2e1738 = (u32)((u64)3532310079UL);
+	t__2e1739 = (u64)((u64)t_object_2e1738 + (u64)((u64)4UL));
+	*(u32 *)t__2e1739 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1742 = (u64)((u64)0UL);
+	t__2e1743 = (u64)((u64)t_object_2e1742 + (u64)((u64)8UL));
+	*(u64 *)t__2e1743 = (u64)((u64)0UL);
+	t__2e1743 = (u64)((u64)t__2e1743 + (u64)((u64)8UL));
+	*(u64 *)t__2e1743 = (u64)((u64)0UL);
+	BLIT((u64)B11, t_object_2e1738, 8);
+	BLIT((u64)B12, ((u64)((char *)&D_strliteral_2e1741)), 24);
+	BLIT((u64)B13, t_object_2e1742, 24);
+	t__2e1737 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R14, (u64)B11, (u64)B12, (u64)B13);
+	t_tag_2e1744 = (u64)(*(u32 *)t__2e1737);
+	t__2e1752 = (u64)(u32)(((u32)t_tag_2e1744 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1752) goto L_member_2e1749; else goto L__2e1751;
+	L__2e1751:;
+	t__2e1754 = (u64)(u32)(((u32)t_tag_2e1744 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1754) goto L_member_2e1750; else goto L__2e1753;
+	L__2e1753:;
+	goto L_matches_2e1748;
+	L_member_2e1749:;
+	goto L_matches_2e1748;
+	L_member_2e1750:;
+	goto L_matches_2e1747;
+	L_matches_2e1747:;
+	goto L__2e1745;
+	L_matches_2e1748:;
+	t_abortsite_2e1697 = ((u64)3UL);
+	goto L_abort_2e1723;
+	L__2e1755:;
+	L__2e1746:;
+	t_abortsite_2e1697 = ((u64)4UL);
+	goto L_abort_2e1730;
+	L__2e1745:;
+	*(u32 *)t_object_2e1758 = (u32)((u64)3532310079UL);
+	t__2e1759 = (u64)((u64)t_object_2e1758 + (u64)((u64)4UL));
+	*(u32 *)t__2e1759 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1762 = (u64)((u64)0UL);
+	t__2e1763 = (u64)((u64)t_object_2e1762 + (u64)((u64)8UL));
+	*(u64 *)t__2e1763 = (u64)((u64)0UL);
+	t__2e1763 = (u64)((u64)t__2e1763 + (u64)((u64)8UL));
+	*(u64 *)t__2e1763 = (u64)((u64)0UL);
+	BLIT((u64)B15, t_object_2e1758, 8);
+	BLIT((u64)B16, ((u64)((char *)&D_strliteral_2e1761)), 24);
+	BLIT((u64)B17, t_object_2e1762, 24);
+	t__2e1757 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R18, (u64)B15, (u64)B16, (u64)B17);
+	t_tag_2e1764 = (u64)(*(u32 *)t__2e1757);
+	t__2e1772 = (u64)(u32)(((u32)t_tag_2e1764 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1772) goto L_member_2e1769; else goto L__2e1771;
+	L__2e1771:;
+	t__2e1774 = (u64)(u32)(((u32)t_tag_2e1764 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1774) goto L_member_2e1770; else goto L__2e1773;
+	L__2e1773:;
+	goto L_matches_2e1768;
+	L_member_2e1769:;
+	goto L_matches_2e1768;
+	L_member_2e1770:;
+	goto L_matches_2e1767;
+	L_matches_2e1767:;
+	goto L__2e1765;
+	L_matches_2e1768:;
+	t_abortsite_2e1697 = ((u64)5UL);
+	goto L_abort_2e1723;
+	L__2e1775:;
+	L__2e1766:;
+	t_abortsite_2e1697 = ((u64)6UL);
+	goto L_abort_2e1730;
+	L__2e1765:;
+	goto L__2e1665;
+	L__2e1776:;
+	L__2e1665:;
+	return;
+	L_abort_2e1698:;
+	t__2e1699 = (u64)((u64)t_abortsite_2e1697 * (u64)((u64)16UL));
+	t__2e1699 = (u64)((u64)((u64)((char *)&D_abortsites_2e1696)) + (u64)t__2e1699);
+	t__2e1700 = (u64)(*(u64 *)t__2e1699);
+	t__2e1701 = (u64)((u64)t__2e1699 + (u64)((u64)8UL));
+	t__2e1702 = (u64)(*(u32 *)t__2e1701);
+	t__2e1701 = (u64)((u64)t__2e1699 + (u64)((u64)12UL));
+	t__2e1703 = (u64)(*(u32 *)t__2e1701);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1700, (u64)t__2e1702, (u64)t__2e1703, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1723:;
+	t__2e1724 = (u64)((u64)t_abortsite_2e1697 * (u64)((u64)16UL));
+	t__2e1724 = (u64)((u64)((u64)((char *)&D_abortsites_2e1696)) + (u64)t__2e1724);
+	t__2e1725 = (u64)(*(u64 *)t__2e1724);
+	t__2e1726 = (u64)((u64)t__2e1724 + (u64)((u64)8UL));
+	t__2e1727 = (u64)(*(u32 *)t__2e1726);
+	t__2e1726 = (u64)((u64)t__2e1724 + (u64)((u64)12UL));
+	t__2e1728 = (u64)(*(u32 *)t__2e1726);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1725, (u64)t__2e1727, (u64)t__2e1728, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e1730:;
+	t__2e1731 = (u64)((u64)t_abortsite_2e1697 * (u64)((u64)16UL));
+	t__2e1731 = (u64)((u64)((u64)((char *)&D_abortsites_2e1696)) + (u64)t__2e1731);
+	t__2e1732 = (u64)(*(u64 *)t__2e1731);
+	t__2e1733 = (u64)((u64)t__2e1731 + (u64)((u64)8UL));
+	t__2e1734 = (u64)(*(u32 *)t__2e1733);
+	t__2e1733 = (u64)((u64)t__2e1731 + (u64)((u64)12UL));
+	t__2e1735 = (u64)(*(u32 *)t__2e1733);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1732, (u64)t__2e1734, (u64)t__2e1735, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_measurements(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[20] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char B4[8] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char R7[4] __attribute__((aligned(16)));
+	u64 t__2e1784;
+	u64 t__2e1787;
+	u64 t__2e1788;
+	u64 t__2e1789;
+	u64 t__2e1793;
+	u64 t__2e1794;
+	u64 t__2e1795;
+	u64 t__2e1796;
+	u64 t__2e1797;
+	u64 t__2e1800;
+	u64 t__2e1801;
+	u64 t__2e1805;
+	u64 t__2e1806;
+	u64 t__2e1809;
+	u64 t__2e1810;
+	u64 t__2e1811;
+	u64 t__2e1812;
+	u64 t__2e1815;
+	u64 t__2e1816;
+	u64 t__2e1817;
+	u64 t__2e1818;
+	u64 t__2e1819;
+	u64 t__2e1820;
+	u64 t__2e1821;
+	u64 t__2e1822;
+	u64 t__2e1823;
+	u64 t__2e1827;
+	u64 t__2e1828;
+	u64 t__2e1829;
+	u64 t__2e1830;
+	u64 t__2e1831;
+	u64 t__2e1832;
+	u64 t__2e1833;
+	u64 t__2e1835;
+	u64 t__2e1837;
+	u64 t__2e1841;
+	u64 t__2e1850;
+	u64 t__2e1852;
+	u64 t__2e1854;
+	u64 t__2e1855;
+	u64 t__2e1856;
+	u64 t__2e1857;
+	u64 t__2e1858;
+	u64 t__2e1861;
+	u64 t__2e1862;
+	u64 t__2e1863;
+	u64 t__2e1864;
+	u64 t__2e1865;
+	u64 t_abortsite_2e1791;
+	u64 t_binding_2e1781;
+	u64 t_item_2e1783;
+	u64 t_object_2e1782;
+	u64 t_object_2e1836;
+	u64 t_object_2e1840;
+	u64 t_tag_2e1842;
+	L_start_2e1777:;
+	t_binding_2e1781 = (u64)A0;
+	t_object_2e1782 = (u64)A1;
+	t_object_2e1836 = (u64)A2;
+	t_object_2e1840 = (u64)A3;
+	L_body_2e1778:;
+	t_item_2e1783 = (u64)((u64)t_object_2e1782 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1783 = (u32)((u64)1UL);
+	t_item_2e1783 = (u64)((u64)t_object_2e1782 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1783 = (u32)((u64)2UL);
+	t_item_2e1783 = (u64)((u64)t_object_2e1782 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1783 = (u32)((u64)3UL);
+	t_item_2e1783 = (u64)((u64)t_object_2e1782 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e1783 = (u32)((u64)4UL);
+	t_item_2e1783 = (u64)((u64)t_object_2e1782 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e1783 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e1781 = (u64)t_object_2e1782;
+	t__2e1784 = (u64)((u64)t_binding_2e1781 + (u64)((u64)8UL));
+	*(u64 *)t__2e1784 = (u64)((u64)5UL);
+	t__2e1784 = (u64)((u64)t__2e1784 + (u64)((u64)8UL));
+	*(u64 *)t__2e1784 = (u64)((u64)5UL);
+	t__2e1789 = (u64)((u64)((u64)8UL) << (((u64)1UL) & 63));
+	t__2e1788 = (u64)((u64)((u64)8UL) + (u64)t__2e1789);
+	t__2e1787 = (u64)(u32)(((u64)((u64)24UL) == (u64)t__2e1788));
+	if ((u32)t__2e1787) goto L_passed_2e1786; else goto L_failed_2e1785;
+	L_failed_2e1785:;
+	t_abortsite_2e1791 = ((u64)0UL);
+	goto L_abort_2e1792;
+	L_passed_2e1786:;
+	t__2e1805 = (u64)(u32)(((u64)((u64)8UL) > (u64)((u64)8UL)));
+	t__2e1806 = (u64)(u32)((u8)t__2e1805);
+	if ((u32)t__2e1806) goto L_true_2e1802; else goto L_false_2e1803;
+	L_true_2e1802:;
+	t__2e1801 = ((u64)8UL);
+	goto L__2e1804;
+	L_false_2e1803:;
+	t__2e1801 = ((u64)8UL);
+	L__2e1804:;
+	t__2e1800 = (u64)(u32)(((u64)((u64)8UL) == (u64)t__2e1801));
+	if ((u32)t__2e1800) goto L_passed_2e1799; else goto L_failed_2e1798;
+	L_failed_2e1798:;
+	t_abortsite_2e1791 = ((u64)1UL);
+	goto L_abort_2e1792;
+	L_passed_2e1799:;
+	t__2e1810 = (u64)((u64)t_binding_2e1781 + (u64)((u64)8UL));
+	t__2e1811 = (u64)((u64)t_binding_2e1781 + (u64)((u64)16UL));
+	t__2e1812 = (u64)(*(u64 *)t__2e1810);
+	t__2e1809 = (u64)(u32)(((u64)t__2e1812 == (u64)((u64)5UL)));
+	if ((u32)t__2e1809) goto L_passed_2e1808; else goto L_failed_2e1807;
+	L_failed_2e1807:;
+	t_abortsite_2e1791 = ((u64)2UL);
+	goto L_abort_2e1792;
+	L_passed_2e1808:;
+	t__2e1818 = (u64)((u64)t_binding_2e1781 + (u64)((u64)8UL));
+	t__2e1819 = (u64)((u64)t_binding_2e1781 + (u64)((u64)16UL));
+	t__2e1820 = (u64)(*(u64 *)t_binding_2e1781);
+	t__2e1821 = (u64)(*(u64 *)t__2e1818);
+	t__2e1822 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1817 = (u64)((u64)t__2e1822 * (u64)((u64)4UL));
+	t__2e1817 = (u64)((u64)t__2e1820 + (u64)t__2e1817);
+	t__2e1823 = (u64)(u32)(((u64)t__2e1822 < (u64)t__2e1821));
+	if ((u32)t__2e1823) goto L__2e1825; else goto L__2e1824;
+	L__2e1824:;
+	t_abortsite_2e1791 = ((u64)3UL);
+	goto L_abort_2e1826;
+	L__2e1825:;
+	t__2e1832 = t__2e1817;
+	t__2e1833 = t__2e1832;
+	t__2e1816 = (u64)((u64)t__2e1833 & (u64)((u64)3UL));
+	t__2e1815 = (u64)(u32)(((u64)t__2e1816 == (u64)((u64)0UL)));
+	if ((u32)t__2e1815) goto L_passed_2e1814; else goto L_failed_2e1813;
+	L_failed_2e1813:;
+	t_abortsite_2e1791 = ((u64)4UL);
+	goto L_abort_2e1792;
+	L_passed_2e1814:;
+	*(u32 *)t_object_2e1836 = (u32)((u64)3532310079UL);
+	t__2e1837 = (u64)((u64)t_object_2e1836 + (u64)((u64)4UL));
+	*(u32 *)t__2e1837 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1840 = (u64)((u64)0UL);
+	t__2e1841 = (u64)((u64)t_object_2e1840 + (u64)((u64)8UL));
+	*(u64 *)t__2e1841 = (u64)((u64)0UL);
+	t__2e1841 = (u64)((u64)t__2e1841 + (u64)((u64)8UL));
+	*(u64 *)t__2e1841 = (u64)((u64)0UL);
+	BLIT((u64)B4, t_object_2e1836, 8);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e1839)), 24);
+	BLIT((u64)B6, t_object_2e1840, 24);
+	t__2e1835 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R7, (u64)B4, (u64)B5, (u64)B6);
+	t_tag_2e1842 = (u64)(*(u32 *)t__2e1835);
+	t__2e1850 = (u64)(u32)(((u32)t_tag_2e1842 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1850) goto L_member_2e1847; else goto L__2e1849;
+	L__2e1849:;
+	t__2e1852 = (u64)(u32)(((u32)t_tag_2e1842 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1852) goto L_member_2e1848; else goto L__2e1851;
+	L__2e1851:;
+	goto L_matches_2e1846;
+	L_member_2e1847:;
+	goto L_matches_2e1846;
+	L_member_2e1848:;
+	goto L_matches_2e1845;
+	L_matches_2e1845:;
+	goto L__2e1843;
+	L_matches_2e1846:;
+	t_abortsite_2e1791 = ((u64)5UL);
+	goto L_abort_2e1853;
+	L__2e1859:;
+	L__2e1844:;
+	t_abortsite_2e1791 = ((u64)6UL);
+	goto L_abort_2e1860;
+	L__2e1843:;
+	goto L__2e1779;
+	L__2e1866:;
+	L__2e1779:;
+	return;
+	L_abort_2e1792:;
+	t__2e1793 = (u64)((u64)t_abortsite_2e1791 * (u64)((u64)16UL));
+	t__2e1793 = (u64)((u64)((u64)((char *)&D_abortsites_2e1790)) + (u64)t__2e1793);
+	t__2e1794 = (u64)(*(u64 *)t__2e1793);
+	t__2e1795 = (u64)((u64)t__2e1793 + (u64)((u64)8UL));
+	t__2e1796 = (u64)(*(u32 *)t__2e1795);
+	t__2e1795 = (u64)((u64)t__2e1793 + (u64)((u64)12UL));
+	t__2e1797 = (u64)(*(u32 *)t__2e1795);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1794, (u64)t__2e1796, (u64)t__2e1797, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1826:;
+	t__2e1827 = (u64)((u64)t_abortsite_2e1791 * (u64)((u64)16UL));
+	t__2e1827 = (u64)((u64)((u64)((char *)&D_abortsites_2e1790)) + (u64)t__2e1827);
+	t__2e1828 = (u64)(*(u64 *)t__2e1827);
+	t__2e1829 = (u64)((u64)t__2e1827 + (u64)((u64)8UL));
+	t__2e1830 = (u64)(*(u32 *)t__2e1829);
+	t__2e1829 = (u64)((u64)t__2e1827 + (u64)((u64)12UL));
+	t__2e1831 = (u64)(*(u32 *)t__2e1829);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1828, (u64)t__2e1830, (u64)t__2e1831, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e1853:;
+	t__2e1854 = (u64)((u64)t_abortsite_2e1791 * (u64)((u64)16UL));
+	t__2e1854 = (u64)((u64)((u64)((char *)&D_abortsites_2e1790)) + (u64)t__2e1854);
+	t__2e1855 = (u64)(*(u64 *)t__2e1854);
+	t__2e1856 = (u64)((u64)t__2e1854 + (u64)((u64)8UL));
+	t__2e1857 = (u64)(*(u32 *)t__2e1856);
+	t__2e1856 = (u64)((u64)t__2e1854 + (u64)((u64)12UL));
+	t__2e1858 = (u64)(*(u32 *)t__2e1856);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1855, (u64)t__2e1857, (u64)t__2e1858, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e1860:;
+	t__2e1861 = (u64)((u64)t_abortsite_2e1791 * (u64)((u64)16UL));
+	t__2e1861 = (u64)((u64)((u64)((char *)&D_abortsites_2e1790)) + (u64)t__2e1861);
+	t__2e1862 = (u64)(*(u64 *)t__2e1861);
+	t__2e1863 = (u64)((u64)t__2e1861 + (u64)((u64)8UL));
+	t__2e1864 = (u64)(*(u32 *)t__2e1863);
+	t__2e1863 = (u64)((u64)t__2e1861 + (u64)((u64)12UL));
+	t__2e1865 = (u64)(*(u32 *)t__2e1863);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1862, (u64)t__2e1864, (u64)t__2e1865, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_storage(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[20] __attribute__((aligned(16)));
+	char A2[20] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[1] __attribute__((aligned(16)));
+	u64 t__2e1874;
+	u64 t__2e1881;
+	u64 t__2e1882;
+	u64 t__2e1883;
+	u64 t__2e1884;
+	u64 t__2e1888;
+	u64 t__2e1889;
+	u64 t__2e1890;
+	u64 t__2e1891;
+	u64 t__2e1892;
+	u64 t__2e1895;
+	u64 t__2e1898;
+	u64 t__2e1899;
+	u64 t__2e1901;
+	u64 t__2e1902;
+	u64 t__2e1903;
+	u64 t__2e1905;
+	u64 t__2e1912;
+	u64 t__2e1913;
+	u64 t__2e1918;
+	u64 t__2e1919;
+	u64 t__2e1920;
+	u64 t__2e1921;
+	u64 t__2e1922;
+	u64 t__2e1923;
+	u64 t__2e1924;
+	u64 t__2e1925;
+	u64 t__2e1929;
+	u64 t__2e1930;
+	u64 t__2e1931;
+	u64 t__2e1932;
+	u64 t__2e1933;
+	u64 t__2e1934;
+	u64 t__2e1935;
+	u64 t__2e1936;
+	u64 t__2e1937;
+	u64 t__2e1939;
+	u64 t__2e1941;
+	u64 t_abortsite_2e1886;
+	u64 t_binding_2e1871;
+	u64 t_binding_2e1875;
+	u64 t_binding_2e1878;
+	u64 t_binding_2e1911;
+	u64 t_binding_2e1940;
+	u64 t_field_2e1900;
+	u64 t_field_2e1904;
+	u64 t_item_2e1873;
+	u64 t_item_2e1877;
+	u64 t_item_2e1943;
+	u64 t_object_2e1872;
+	L_start_2e1867:;
+	t_binding_2e1871 = (u64)A0;
+	t_object_2e1872 = (u64)A1;
+	t_binding_2e1875 = (u64)A2;
+	t_binding_2e1878 = (u64)A3;
+	t_binding_2e1911 = (u64)A4;
+	t_binding_2e1940 = (u64)A5;
+	t__2e1941 = (u64)A6;
+	L_body_2e1868:;
+	t_item_2e1873 = (u64)((u64)t_object_2e1872 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1873 = (u32)((u64)1UL);
+	t_item_2e1873 = (u64)((u64)t_object_2e1872 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1873 = (u32)((u64)2UL);
+	t_item_2e1873 = (u64)((u64)t_object_2e1872 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1873 = (u32)((u64)3UL);
+	t_item_2e1873 = (u64)((u64)t_object_2e1872 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e1873 = (u32)((u64)4UL);
+	t_item_2e1873 = (u64)((u64)t_object_2e1872 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e1873 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e1871 = (u64)t_object_2e1872;
+	t__2e1874 = (u64)((u64)t_binding_2e1871 + (u64)((u64)8UL));
+	*(u64 *)t__2e1874 = (u64)((u64)5UL);
+	t__2e1874 = (u64)((u64)t__2e1874 + (u64)((u64)8UL));
+	*(u64 *)t__2e1874 = (u64)((u64)5UL);
+	t_item_2e1877 = (u64)((u64)t_binding_2e1875 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1877 = (u32)((u64)1UL);
+	t_item_2e1877 = (u64)((u64)t_binding_2e1875 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1877 = (u32)((u64)2UL);
+	t_item_2e1877 = (u64)((u64)t_binding_2e1875 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1877 = (u32)((u64)3UL);
+	t_item_2e1877 = (u64)((u64)t_binding_2e1875 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e1877 = (u32)((u64)4UL);
+	t_item_2e1877 = (u64)((u64)t_binding_2e1875 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e1877 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e1878 = (u64)t_binding_2e1871;
+	t__2e1882 = (u64)((u64)t_binding_2e1871 + (u64)((u64)8UL));
+	t__2e1883 = (u64)((u64)t_binding_2e1871 + (u64)((u64)16UL));
+	t__2e1884 = (u64)(*(u64 *)t__2e1882);
+	t__2e1881 = (u64)(u32)(((u64)t__2e1884 == (u64)((u64)5UL)));
+	if ((u32)t__2e1881) goto L_passed_2e1880; else goto L_failed_2e1879;
+	L_failed_2e1879:;
+	t_abortsite_2e1886 = ((u64)0UL);
+	goto L_abort_2e1887;
+	L_passed_2e1880:;
+	t__2e1899 = (u64)(*(u64 *)t_binding_2e1878);
+	t_field_2e1900 = (u64)((u64)t__2e1899 + (u64)((u64)8UL));
+	t__2e1901 = (u64)(*(u64 *)t_field_2e1900);
+	t__2e1898 = (u64)(u32)(((u64)t__2e1901 == (u64)((u64)5UL)));
+	t__2e1895 = (u64)(u32)t__2e1898;
+	if ((u32)t__2e1895) goto L__2e1896; else goto L__2e1897;
+	L__2e1896:;
+	t__2e1903 = (u64)(*(u64 *)t_binding_2e1878);
+	t_field_2e1904 = (u64)((u64)t__2e1903 + (u64)((u64)16UL));
+	t__2e1905 = (u64)(*(u64 *)t_field_2e1904);
+	t__2e1902 = (u64)(u32)(((u64)t__2e1905 == (u64)((u64)5UL)));
+	t__2e1895 = (u64)(u32)t__2e1902;
+	goto L__2e1897;
+	L__2e1897:;
+	if ((u32)t__2e1895) goto L_passed_2e1894; else goto L_failed_2e1893;
+	L_failed_2e1893:;
+	t_abortsite_2e1886 = ((u64)1UL);
+	goto L_abort_2e1887;
+	L_passed_2e1894:;
+	*(u64 *)t_binding_2e1911 = (u64)((u64)0UL);
+	L_loop_2e1906:;
+	t__2e1913 = (u64)(*(u64 *)t_binding_2e1911);
+	t__2e1912 = (u64)(u32)(((u64)t__2e1913 < (u64)((u64)5UL)));
+	if ((u32)t__2e1912) goto L_body_2e1907; else goto L__2e1909;
+	L_body_2e1907:;
+	t__2e1920 = (u64)((u64)t_binding_2e1871 + (u64)((u64)8UL));
+	t__2e1921 = (u64)((u64)t_binding_2e1871 + (u64)((u64)16UL));
+	t__2e1922 = (u64)(*(u64 *)t_binding_2e1871);
+	t__2e1923 = (u64)(*(u64 *)t__2e1920);
+	t__2e1924 = (u64)(*(u64 *)t_binding_2e1911);
+	t__2e1919 = (u64)((u64)t__2e1924 * (u64)((u64)4UL));
+	t__2e1919 = (u64)((u64)t__2e1922 + (u64)t__2e1919);
+	t__2e1925 = (u64)(u32)(((u64)t__2e1924 < (u64)t__2e1923));
+	if ((u32)t__2e1925) goto L__2e1927; else goto L__2e1926;
+	L__2e1926:;
+	t_abortsite_2e1886 = ((u64)2UL);
+	goto L_abort_2e1928;
+	L__2e1927:;
+	t__2e1934 = (u64)(u32)(*(i32 *)t__2e1919);
+	t__2e1936 = (u64)(*(u64 *)t_binding_2e1911);
+	t__2e1935 = (u64)((u64)t__2e1936 * (u64)((u64)4UL));
+	t__2e1935 = (u64)((u64)t_binding_2e1875 + (u64)t__2e1935);
+	t__2e1937 = (u64)(u32)(*(i32 *)t__2e1935);
+	t__2e1918 = (u64)(u32)(((u32)t__2e1934 == (u32)t__2e1937));
+	if ((u32)t__2e1918) goto L_passed_2e1917; else goto L_failed_2e1916;
+	L_failed_2e1916:;
+	t_abortsite_2e1886 = ((u64)3UL);
+	goto L_abort_2e1887;
+	L_passed_2e1917:;
+	goto L__2e1914;
+	L__2e1938:;
+	L__2e1914:;
+	L_after_2e1910:;
+	t__2e1939 = (u64)(*(u64 *)t_binding_2e1911);
+	t__2e1939 = (u64)((u64)t__2e1939 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1911 = (u64)t__2e1939;
+	goto L_loop_2e1906;
+	L__2e1909:;
+	t_item_2e1943 = (u64)((u64)t__2e1941 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e1943 = (u8)((u64)0UL);
+	*(u64 *)t_binding_2e1940 = (u64)t__2e1941;
+	goto L__2e1869;
+	L__2e1944:;
+	L__2e1869:;
+	return;
+	L_abort_2e1887:;
+	t__2e1888 = (u64)((u64)t_abortsite_2e1886 * (u64)((u64)16UL));
+	t__2e1888 = (u64)((u64)((u64)((char *)&D_abortsites_2e1885)) + (u64)t__2e1888);
+	t__2e1889 = (u64)(*(u64 *)t__2e1888);
+	t__2e1890 = (u64)((u64)t__2e1888 + (u64)((u64)8UL));
+	t__2e1891 = (u64)(*(u32 *)t__2e1890);
+	t__2e1890 = (u64)((u64)t__2e1888 + (u64)((u64)12UL));
+	t__2e1892 = (u64)(*(u32 *)t__2e1890);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1889, (u64)t__2e1891, (u64)t__2e1892, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1928:;
+	t__2e1929 = (u64)((u64)t_abortsite_2e1886 * (u64)((u64)16UL));
+	t__2e1929 = (u64)((u64)((u64)((char *)&D_abortsites_2e1885)) + (u64)t__2e1929);
+	t__2e1930 = (u64)(*(u64 *)t__2e1929);
+	t__2e1931 = (u64)((u64)t__2e1929 + (u64)((u64)8UL));
+	t__2e1932 = (u64)(*(u32 *)t__2e1931);
+	t__2e1931 = (u64)((u64)t__2e1929 + (u64)((u64)12UL));
+	t__2e1933 = (u64)(*(u32 *)t__2e1931);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1930, (u64)t__2e1932, (u64)t__2e1933, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_from__array(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	u64 t__2e1952;
+	u64 t__2e1956;
+	u64 t__2e1957;
+	u64 t__2e1959;
+	u64 t__2e1963;
+	u64 t__2e1964;
+	u64 t__2e1965;
+	u64 t__2e1966;
+	u64 t__2e1967;
+	u64 t__2e1969;
+	u64 t__2e1973;
+	u64 t__2e1974;
+	u64 t__2e1976;
+	u64 t__2e1977;
+	u64 t_abortsite_2e1961;
+	u64 t_binding_2e1949;
+	u64 t_binding_2e1951;
+	u64 t_binding_2e1953;
+	u64 t_binding_2e1968;
+	u64 t_binding_2e1970;
+	u64 t_field_2e1958;
+	u64 t_field_2e1975;
+	u64 t_item_2e1950;
+	L_start_2e1945:;
+	t_binding_2e1949 = (u64)A0;
+	t_binding_2e1951 = (u64)A1;
+	t_binding_2e1953 = (u64)A2;
+	t_binding_2e1968 = (u64)A3;
+	t_binding_2e1970 = (u64)A4;
+	L_body_2e1946:;
+	t_item_2e1950 = (u64)((u64)t_binding_2e1949 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1950 = (u32)((u64)1UL);
+	t_item_2e1950 = (u64)((u64)t_binding_2e1949 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1950 = (u32)((u64)2UL);
+	t_item_2e1950 = (u64)((u64)t_binding_2e1949 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1950 = (u32)((u64)3UL);
+	*(u64 *)t_binding_2e1951 = (u64)t_binding_2e1949;
+	t__2e1952 = (u64)((u64)t_binding_2e1951 + (u64)((u64)8UL));
+	*(u64 *)t__2e1952 = (u64)((u64)3UL);
+	t__2e1952 = (u64)((u64)t__2e1952 + (u64)((u64)8UL));
+	*(u64 *)t__2e1952 = (u64)((u64)3UL);
+	*(u64 *)t_binding_2e1953 = (u64)t_binding_2e1951;
+	t__2e1957 = (u64)(*(u64 *)t_binding_2e1953);
+	t_field_2e1958 = (u64)((u64)t__2e1957 + (u64)((u64)0UL));
+	t__2e1959 = (u64)(*(u64 *)t_field_2e1958);
+	t__2e1956 = (u64)(u32)(((u64)t__2e1959 == (u64)t_binding_2e1949));
+	if ((u32)t__2e1956) goto L_passed_2e1955; else goto L_failed_2e1954;
+	L_failed_2e1954:;
+	t_abortsite_2e1961 = ((u64)0UL);
+	goto L_abort_2e1962;
+	L_passed_2e1955:;
+	*(u64 *)t_binding_2e1968 = (u64)((u64)0UL);
+	t__2e1969 = (u64)((u64)t_binding_2e1968 + (u64)((u64)8UL));
+	*(u64 *)t__2e1969 = (u64)((u64)0UL);
+	t__2e1969 = (u64)((u64)t__2e1969 + (u64)((u64)8UL));
+	*(u64 *)t__2e1969 = (u64)((u64)0UL);
+	*(u64 *)t_binding_2e1970 = (u64)t_binding_2e1968;
+	t__2e1974 = (u64)(*(u64 *)t_binding_2e1970);
+	t_field_2e1975 = (u64)((u64)t__2e1974 + (u64)((u64)0UL));
+	t__2e1976 = (u64)(*(u64 *)t_field_2e1975);
+	t__2e1977 = ((u64)0UL);
+	t__2e1973 = (u64)(u32)(((u64)t__2e1976 == (u64)t__2e1977));
+	if ((u32)t__2e1973) goto L_passed_2e1972; else goto L_failed_2e1971;
+	L_failed_2e1971:;
+	t_abortsite_2e1961 = ((u64)1UL);
+	goto L_abort_2e1962;
+	L_passed_2e1972:;
+	goto L__2e1947;
+	L__2e1978:;
+	L__2e1947:;
+	return;
+	L_abort_2e1962:;
+	t__2e1963 = (u64)((u64)t_abortsite_2e1961 * (u64)((u64)16UL));
+	t__2e1963 = (u64)((u64)((u64)((char *)&D_abortsites_2e1960)) + (u64)t__2e1963);
+	t__2e1964 = (u64)(*(u64 *)t__2e1963);
+	t__2e1965 = (u64)((u64)t__2e1963 + (u64)((u64)8UL));
+	t__2e1966 = (u64)(*(u32 *)t__2e1965);
+	t__2e1965 = (u64)((u64)t__2e1963 + (u64)((u64)12UL));
+	t__2e1967 = (u64)(*(u32 *)t__2e1965);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1964, (u64)t__2e1966, (u64)t__2e1967, (u64)((u64)6UL));
+	__builtin_trap();
+}
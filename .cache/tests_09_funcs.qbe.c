@@ -0,0 +1,2504 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2eexit[] __asm__("rt.exit");
+extern char X_rt_2eexit__status[] __asm__("rt.exit_status");
+extern char X_rt_2estrcmp[] __asm__("rt.strcmp");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e10 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S__2efini_2efinifunc_2e6 { char *f0; };
+struct __attribute__((packed)) S__2efini_2efinifunc_2e4 { char *f0; };
+struct __attribute__((packed)) S__2einit_2einitfunc_2e2 { char *f0; };
+struct __attribute__((packed)) S__2einit_2einitfunc_2e0 { char *f0; };
+struct __attribute__((packed)) S_abortsites_2e60 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e81 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e116 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e117 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e122 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e123 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e183 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e184 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e99 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; };
+struct __attribute__((packed)) S_abortsites_2e277 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_strdata_2e352 { u8 f0[28]; };
+struct __attribute__((packed)) S_strliteral_2e353 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e354 { u8 f0[27]; };
+struct __attribute__((packed)) S_strliteral_2e355 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e356 { u8 f0[35]; };
+struct __attribute__((packed)) S_strliteral_2e357 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e358 { u8 f0[36]; };
+struct __attribute__((packed)) S_strliteral_2e359 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e360 { u8 f0[28]; u8 f1; u8 f2[3]; u8 f3; u8 f4[16]; };
+struct __attribute__((packed)) S_strliteral_2e361 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e362 { u8 f0[78]; };
+struct __attribute__((packed)) S_strliteral_2e363 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e364 { u8 f0[34]; };
+struct __attribute__((packed)) S_strliteral_2e365 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e366 { u8 f0[32]; };
+struct __attribute__((packed)) S_strliteral_2e367 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e368 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e369 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e370 { u8 f0[23]; };
+struct __attribute__((packed)) S_strliteral_2e371 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e372 { u8 f0[35]; };
+struct __attribute__((packed)) S_strliteral_2e373 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e374 { u8 f0[41]; };
+struct __attribute__((packed)) S_strliteral_2e375 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e376 { u8 f0[37]; };
+struct __attribute__((packed)) S_strliteral_2e377 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e378 { u8 f0[34]; };
+struct __attribute__((packed)) S_strliteral_2e379 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e380 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e381 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e382 { u8 f0[29]; };
+struct __attribute__((packed)) S_strliteral_2e383 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e418 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_x { u32 f0; };
+struct __attribute__((packed)) S_strdata_2e440 { u8 f0[1]; };
+struct __attribute__((packed)) S_strliteral_2e441 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e456 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_abortsites_2e498 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e544 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e619 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e677 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e727 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; };
+struct __attribute__((packed)) S_abortsites_2e872 { char *f0; u32 f1; u32 f2; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e10 D_abortsites_2e10 __asm__("abortsites.10") __attribute__((used, section(".data.rel.ro.abortsites.10"), aligned(8)));
+static struct S__2efini_2efinifunc_2e6 D__2efini_2efinifunc_2e6 __asm__(".fini.finifunc.6") __attribute__((used, section(".fini_array"), aligned(8)));
+static struct S__2efini_2efinifunc_2e4 D__2efini_2efinifunc_2e4 __asm__(".fini.finifunc.4") __attribute__((used, section(".fini_array"), aligned(8)));
+static struct S__2einit_2einitfunc_2e2 D__2einit_2einitfunc_2e2 __asm__(".init.initfunc.2") __attribute__((used, section(".init_array"), aligned(8)));
+static struct S__2einit_2einitfunc_2e0 D__2einit_2einitfunc_2e0 __asm__(".init.initfunc.0") __attribute__((used, section(".init_array"), aligned(8)));
+static struct S_abortsites_2e60 D_abortsites_2e60 __asm__("abortsites.60") __attribute__((used, section(".data.rel.ro.abortsites.60"), aligned(8)));
+static struct S_abortsites_2e81 D_abortsites_2e81 __asm__("abortsites.81") __attribute__((used, section(".data.rel.ro.abortsites.81"), aligned(8)));
+static const struct S_strdata_2e116 D_strdata_2e116 __asm__("strdata.116") __attribute__((used, section(".rodata.strdata.116"), aligned(8)));
+static struct S_strliteral_2e117 D_strliteral_2e117 __asm__("strliteral.117") __attribute__((used, section(".data.rel.ro.strliteral.117"), aligned(8)));
+static const struct S_strdata_2e122 D_strdata_2e122 __asm__("strdata.122") __attribute__((used, section(".rodata.strdata.122"), aligned(8)));
+static struct S_strliteral_2e123 D_strliteral_2e123 __asm__("strliteral.123") __attribute__((used, section(".data.rel.ro.strliteral.123"), aligned(8)));
+static const struct S_strdata_2e183 D_strdata_2e183 __asm__("strdata.183") __attribute__((used, section(".rodata.strdata.183"), aligned(8)));
+static struct S_strliteral_2e184 D_strliteral_2e184 __asm__("strliteral.184") __attribute__((used, section(".data.rel.ro.strliteral.184"), aligned(8)));
+static struct S_abortsites_2e99 D_abortsites_2e99 __asm__("abortsites.99") __attribute__((used, section(".data.rel.ro.abortsites.99"), aligned(8)));
+static struct S_abortsites_2e277 D_abortsites_2e277 __asm__("abortsites.277") __attribute__((used, section(".data.rel.ro.abortsites.277"), aligned(8)));
+static const struct S_strdata_2e352 D_strdata_2e352 __asm__("strdata.352") __attribute__((used, section(".rodata.strdata.352"), aligned(8)));
+static struct S_strliteral_2e353 D_strliteral_2e353 __asm__("strliteral.353") __attribute__((used, section(".data.rel.ro.strliteral.353"), aligned(8)));
+static const struct S_strdata_2e354 D_strdata_2e354 __asm__("strdata.354") __attribute__((used, section(".rodata.strdata.354"), aligned(8)));
+static struct S_strliteral_2e355 D_strliteral_2e355 __asm__("strliteral.355") __attribute__((used, section(".data.rel.ro.strliteral.355"), aligned(8)));
+static const struct S_strdata_2e356 D_strdata_2e356 __asm__("strdata.356") __attribute__((used, section(".rodata.strdata.356"), aligned(8)));
+static struct S_strliteral_2e357 D_strliteral_2e357 __asm__("strliteral.357") __attribute__((used, section(".data.rel.ro.strliteral.357"), aligned(8)));
+static const struct S_strdata_2e358 D_strdata_2e358 __asm__("strdata.358") __attribute__((used, section(".rodata.strdata.358"), aligned(8)));
+static struct S_strliteral_2e359 D_strliteral_2e359 __asm__("strliteral.359") __attribute__((used, section(".data.rel.ro.strliteral.359"), aligned(8)));
+static const struct S_strdata_2e360 D_strdata_2e360 __asm__("strdata.360") __attribute__((used, section(".rodata.strdata.360"), aligned(8)));
+static struct S_strliteral_2e361 D_strliteral_2e361 __asm__("strliteral.361") __attribute__((used, section(".data.rel.ro.strliteral.361"), aligned(8)));
+static const struct S_strdata_2e362 D_strdata_2e362 __asm__("strdata.362") __attribute__((used, section(".rodata.strdata.362"), aligned(8)));
+static struct S_strliteral_2e363 D_strliteral_2e363 __asm__("strliteral.363") __attribute__((used, section(".data.rel.ro.strliteral.363"), aligned(8)));
+static const struct S_strdata_2e364 D_strdata_2e364 __asm__("strdata.364") __attribute__((used, section(".rodata.strdata.364"), aligned(8)));
+static struct S_strliteral_2e365 D_strliteral_2e365 __asm__("strliteral.365") __attribute__((used, section(".data.rel.ro.strliteral.365"), aligned(8)));
+static const struct S_strdata_2e366 D_strdata_2e366 __asm__("strdata.366") __attribute__((used, section(".rodata.strdata.366"), aligned(8)));
+static struct S_strliteral_2e367 D_strliteral_2e367 __asm__("strliteral.367") __attribute__((used, section(".data.rel.ro.strliteral.367"), aligned(8)));
+static const struct S_strdata_2e368 D_strdata_2e368 __asm__("strdata.368") __attribute__((used, section(".rodata.strdata.368"), aligned(8)));
+static struct S_strliteral_2e369 D_strliteral_2e369 __asm__("strliteral.369") __attribute__((used, section(".data.rel.ro.strliteral.369"), aligned(8)));
+static const struct S_strdata_2e370 D_strdata_2e370 __asm__("strdata.370") __attribute__((used, section(".rodata.strdata.370"), aligned(8)));
+static struct S_strliteral_2e371 D_strliteral_2e371 __asm__("strliteral.371") __attribute__((used, section(".data.rel.ro.strliteral.371"), aligned(8)));
+static const struct S_strdata_2e372 D_strdata_2e372 __asm__("strdata.372") __attribute__((used, section(".rodata.strdata.372"), aligned(8)));
+static struct S_strliteral_2e373 D_strliteral_2e373 __asm__("strliteral.373") __attribute__((used, section(".data.rel.ro.strliteral.373"), aligned(8)));
+static const struct S_strdata_2e374 D_strdata_2e374 __asm__("strdata.374") __attribute__((used, section(".rodata.strdata.374"), aligned(8)));
+static struct S_strliteral_2e375 D_strliteral_2e375 __asm__("strliteral.375") __attribute__((used, section(".data.rel.ro.strliteral.375"), aligned(8)));
+static const struct S_strdata_2e376 D_strdata_2e376 __asm__("strdata.376") __attribute__((used, section(".rodata.strdata.376"), aligned(8)));
+static struct S_strliteral_2e377 D_strliteral_2e377 __asm__("strliteral.377") __attribute__((used, section(".data.rel.ro.strliteral.377"), aligned(8)));
+static const struct S_strdata_2e378 D_strdata_2e378 __asm__("strdata.378") __attribute__((used, section(".rodata.strdata.378"), aligned(8)));
+static struct S_strliteral_2e379 D_strliteral_2e379 __asm__("strliteral.379") __attribute__((used, section(".data.rel.ro.strliteral.379"), aligned(8)));
+static const struct S_strdata_2e380 D_strdata_2e380 __asm__("strdata.380") __attribute__((used, section(".rodata.strdata.380"), aligned(8)));
+static struct S_strliteral_2e381 D_strliteral_2e381 __asm__("strliteral.381") __attribute__((used, section(".data.rel.ro.strliteral.381"), aligned(8)));
+static const struct S_strdata_2e382 D_strdata_2e382 __asm__("strdata.382") __attribute__((used, section(".rodata.strdata.382"), aligned(8)));
+static struct S_strliteral_2e383 D_strliteral_2e383 __asm__("strliteral.383") __attribute__((used, section(".data.rel.ro.strliteral.383"), aligned(8)));
+static struct S_abortsites_2e418 D_abortsites_2e418 __asm__("abortsites.418") __attribute__((used, section(".data.rel.ro.abortsites.418"), aligned(8)));
+static struct S_x D_x __asm__("x") __attribute__((used, section(".data.x"), aligned(8)));
+static const struct S_strdata_2e440 D_strdata_2e440 __asm__("strdata.440") __attribute__((used, section(".rodata.strdata.440"), aligned(8)));
+static struct S_strliteral_2e441 D_strliteral_2e441 __asm__("strliteral.441") __attribute__((used, section(".data.rel.ro.strliteral.441"), aligned(8)));
+static struct S_abortsites_2e456 D_abortsites_2e456 __asm__("abortsites.456") __attribute__((used, section(".data.rel.ro.abortsites.456"), aligned(8)));
+static struct S_abortsites_2e498 D_abortsites_2e498 __asm__("abortsites.498") __attribute__((used, section(".data.rel.ro.abortsites.498"), aligned(8)));
+static struct S_abortsites_2e544 D_abortsites_2e544 __asm__("abortsites.544") __attribute__((used, section(".data.rel.ro.abortsites.544"), aligned(8)));
+static struct S_abortsites_2e619 D_abortsites_2e619 __asm__("abortsites.619") __attribute__((used, section(".data.rel.ro.abortsites.619"), aligned(8)));
+static struct S_abortsites_2e677 D_abortsites_2e677 __asm__("abortsites.677") __attribute__((used, section(".data.rel.ro.abortsites.677"), aligned(8)));
+static struct S_abortsites_2e727 D_abortsites_2e727 __asm__("abortsites.727") __attribute__((used, section(".data.rel.ro.abortsites.727"), aligned(8)));
+static struct S_abortsites_2e872 D_abortsites_2e872 __asm__("abortsites.872") __attribute__((used, section(".data.rel.ro.abortsites.872"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_finifunc_2e6(void) __asm__("finifunc.6") __attribute__((used, section(".text.finifunc.6")));
+static void F_finifunc_2e4(void) __asm__("finifunc.4") __attribute__((used, section(".text.finifunc.4")));
+static void F_initfunc_2e2(void) __asm__("initfunc.2") __attribute__((used, section(".text.initfunc.2")));
+static void F_initfunc_2e0(void) __asm__("initfunc.0") __attribute__((used, section(".text.initfunc.0")));
+static void F___never(void) __asm__("_never") __attribute__((used, section(".text._never")));
+static void F_neverfunc(u32 p_x) __asm__("neverfunc") __attribute__((used, section(".text.neverfunc")));
+static void F_optional__params(void) __asm__("optional_params") __attribute__((used, section(".text.optional_params")));
+static u32 F_optional__ptr(u64 p_x) __asm__("optional_ptr") __attribute__((used, section(".text.optional_ptr")));
+static u32 F_optional__slc2(u64 p_x) __asm__("optional_slc2") __attribute__((used, section(".text.optional_slc2")));
+static u64 F_optional__slc(u64 p_x) __asm__("optional_slc") __attribute__((used, section(".text.optional_slc")));
+static u32 F_optional__alias2(u32 p_x) __asm__("optional_alias2") __attribute__((used, section(".text.optional_alias2")));
+static u32 F_optional__alias(u32 p_x) __asm__("optional_alias") __attribute__((used, section(".text.optional_alias")));
+static u64 F_optional__tuple(u64 __rp, u64 p_x) __asm__("optional_tuple") __attribute__((used, section(".text.optional_tuple")));
+static u64 F_optional__tagged(u64 __rp, u64 p_x) __asm__("optional_tagged") __attribute__((used, section(".text.optional_tagged")));
+static u32 F_optional__add(u32 p_a, u32 p_b) __asm__("optional_add") __attribute__((used, section(".text.optional_add")));
+static u64 F_optional__str(u64 __rp, u64 p_x) __asm__("optional_str") __attribute__((used, section(".text.optional_str")));
+static u32 F_optional__simple(u32 p_a, u32 p_b) __asm__("optional_simple") __attribute__((used, section(".text.optional_simple")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_zerosizeparams(void) __asm__("zerosizeparams") __attribute__((used, section(".text.zerosizeparams")));
+static void F_zeroparamfunc(u32 p_a, u64 p_c, double p_e, u64 p_h, u32 p_j) __asm__("zeroparamfunc") __attribute__((used, section(".text.zeroparamfunc")));
+static void F_cvaargs(void) __asm__("cvaargs") __attribute__((used, section(".text.cvaargs")));
+static void F_cvafn2(u64 __va0, ...) __asm__("cvafn2") __attribute__((used, section(".text.cvafn2")));
+static void F_cvafn(u32 p_n, ...) __asm__("cvafn") __attribute__((used, section(".text.cvafn")));
+static void F_vaargs(void) __asm__("vaargs") __attribute__((used, section(".text.vaargs")));
+static void F_vafn(u64 p_expected, u64 p_values) __asm__("vafn") __attribute__((used, section(".text.vafn")));
+static void F_pointers(void) __asm__("pointers") __attribute__((used, section(".text.pointers")));
+static void F_addone(u64 p_x) __asm__("addone") __attribute__((used, section(".text.addone")));
+static void F_inlining(void) __asm__("inlining") __attribute__((used, section(".text.inlining")));
+static u32 F_first(u64 p_s, u64 p_i) __asm__("first") __attribute__((used, section(".text.first")));
+static u32 F_yielded(u32 p_x) __asm__("yielded") __attribute__((used, section(".text.yielded")));
+static u32 F_deferred(u64 p_x, u32 p_early) __asm__("deferred") __attribute__((used, section(".text.deferred")));
+static u32 F_clamp(u32 p_x, u32 p_lo, u32 p_hi) __asm__("clamp") __attribute__((used, section(".text.clamp")));
+static u64 F_swapped(u64 __rp, u64 p_p) __asm__("swapped") __attribute__((used, section(".text.swapped")));
+static u32 F_simple(void) __asm__("simple") __attribute__((used, section(".text.simple")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\060\071\055\146\165\156\143\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 17U, 17U };
+static struct S_abortsites_2e10 D_abortsites_2e10 = { (char *)((char *)&D_strliteral_2e1) + 0, 287U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 293U, 15U };
+static struct S__2efini_2efinifunc_2e6 D__2efini_2efinifunc_2e6 = { (char *)((char *)&F_finifunc_2e6) + 0 };
+static struct S__2efini_2efinifunc_2e4 D__2efini_2efinifunc_2e4 = { (char *)((char *)&F_finifunc_2e4) + 0 };
+static struct S__2einit_2einitfunc_2e2 D__2einit_2einitfunc_2e2 = { (char *)((char *)&F_initfunc_2e2) + 0 };
+static struct S__2einit_2einitfunc_2e0 D__2einit_2einitfunc_2e0 = { (char *)((char *)&F_initfunc_2e0) + 0 };
+static struct S_abortsites_2e60 D_abortsites_2e60 = { (char *)((char *)&D_strliteral_2e1) + 0, 165U, 14U };
+static struct S_abortsites_2e81 D_abortsites_2e81 = { (char *)((char *)&D_strliteral_2e1) + 0, 160U, 60U };
+static const struct S_strdata_2e116 D_strdata_2e116 = { "\150\151" };
+static struct S_strliteral_2e117 D_strliteral_2e117 = { (char *)((char *)&D_strdata_2e116) + 0, 2U, 2U };
+static const struct S_strdata_2e122 D_strdata_2e122 = { "\150\145\154\154\157" };
+static struct S_strliteral_2e123 D_strliteral_2e123 = { (char *)((char *)&D_strdata_2e122) + 0, 5U, 5U };
+static const struct S_strdata_2e183 D_strdata_2e183 = { "\167\157\167" };
+static struct S_strliteral_2e184 D_strliteral_2e184 = { (char *)((char *)&D_strdata_2e183) + 0, 3U, 3U };
+static struct S_abortsites_2e99 D_abortsites_2e99 = { (char *)((char *)&D_strliteral_2e1) + 0, 187U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 188U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 189U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 190U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 191U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 192U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 193U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 194U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 195U, 37U, (char *)((char *)&D_strliteral_2e1) + 0, 195U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 196U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 197U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 198U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 199U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 200U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 201U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 202U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 203U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 205U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 206U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 208U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 210U, 15U };
+static struct S_abortsites_2e277 D_abortsites_2e277 = { (char *)((char *)&D_strliteral_2e1) + 0, 180U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 181U, 10U, (char *)((char *)&D_strliteral_2e1) + 0, 182U, 17U };
+static const struct S_strdata_2e352 D_strdata_2e352 = { "\146\156\040\146\050\170\072\040\133\052\135\151\156\164\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e353 D_strliteral_2e353 = { (char *)((char *)&D_strdata_2e352) + 0, 28U, 28U };
+static const struct S_strdata_2e354 D_strdata_2e354 = { "\146\156\040\146\050\170\072\040\151\156\164\051\040\133\052\135\151\156\164\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e355 D_strliteral_2e355 = { (char *)((char *)&D_strdata_2e354) + 0, 27U, 27U };
+static const struct S_strdata_2e356 D_strdata_2e356 = { "\154\145\164\040\170\072\040\163\151\172\145\040\075\040\163\151\172\145\050\146\156\050\170\072\040\151\156\164\051\040\151\156\164\051\073" };
+static struct S_strliteral_2e357 D_strliteral_2e357 = { (char *)((char *)&D_strdata_2e356) + 0, 35U, 35U };
+static const struct S_strdata_2e358 D_strdata_2e358 = { "\154\145\164\040\170\072\040\163\151\172\145\040\075\040\141\154\151\147\156\050\146\156\050\170\072\040\151\156\164\051\040\151\156\164\051\073" };
+static struct S_strliteral_2e359 D_strliteral_2e359 = { (char *)((char *)&D_strdata_2e358) + 0, 36U, 36U };
+static const struct S_strdata_2e360 D_strdata_2e360 = { "\100\164\145\163\164\040\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\064\062\040\053\040", 34U, "\146\157\157", 34U, "\073\154\145\164\040\170\072\040\151\156\164\040\075\040\064\073" };
+static struct S_strliteral_2e361 D_strliteral_2e361 = { (char *)((char *)&D_strdata_2e360) + 0, 49U, 49U };
+static const struct S_strdata_2e362 D_strdata_2e362 = { "\146\156\040\146\050\170\072\040\151\156\164\051\040\166\157\151\144\040\075\040\166\157\151\144\073\146\156\040\147\050\170\072\040\151\156\164\051\040\166\157\151\144\040\075\040\166\157\151\144\073\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\146\040\053\040\147\073\040\175\073" };
+static struct S_strliteral_2e363 D_strliteral_2e363 = { (char *)((char *)&D_strdata_2e362) + 0, 78U, 78U };
+static const struct S_strdata_2e364 D_strdata_2e364 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\164\145\163\164\040\075\040\164\145\163\164\073\040\175\073" };
+static struct S_strliteral_2e365 D_strliteral_2e365 = { (char *)((char *)&D_strdata_2e364) + 0, 34U, 34U };
+static const struct S_strdata_2e366 D_strdata_2e366 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\163\151\172\145\050\052\156\145\166\145\162\051\073\040\175\073" };
+static struct S_strliteral_2e367 D_strliteral_2e367 = { (char *)((char *)&D_strdata_2e366) + 0, 32U, 32U };
+static const struct S_strdata_2e368 D_strdata_2e368 = { "\146\156\040\146\050\151\156\164\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e369 D_strliteral_2e369 = { (char *)((char *)&D_strdata_2e368) + 0, 22U, 22U };
+static const struct S_strdata_2e370 D_strdata_2e370 = { "\146\156\040\146\050\052\151\156\164\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e371 D_strliteral_2e371 = { (char *)((char *)&D_strdata_2e370) + 0, 23U, 23U };
+static const struct S_strdata_2e372 D_strdata_2e372 = { "\164\171\160\145\040\164\040\075\040\166\157\151\144\073\040\146\156\040\146\050\164\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e373 D_strliteral_2e373 = { (char *)((char *)&D_strdata_2e372) + 0, 35U, 35U };
+static const struct S_strdata_2e374 D_strdata_2e374 = { "\146\156\040\146\050\141\162\147\072\040\124\056\056\056\051\040\166\157\151\144\073\040\146\156\040\147\050\051\040\166\157\151\144\040\075\040\146\050\061\051\073" };
+static struct S_strliteral_2e375 D_strliteral_2e375 = { (char *)((char *)&D_strdata_2e374) + 0, 41U, 41U };
+static const struct S_strdata_2e376 D_strdata_2e376 = { "\146\156\040\146\050\141\072\040\151\156\164\040\075\040\065\054\040\142\072\040\151\156\164\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e377 D_strliteral_2e377 = { (char *)((char *)&D_strdata_2e376) + 0, 37U, 37U };
+static const struct S_strdata_2e378 D_strdata_2e378 = { "\146\156\040\146\050\141\072\040\151\156\164\040\075\040\065\054\040\056\056\056\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e379 D_strliteral_2e379 = { (char *)((char *)&D_strdata_2e378) + 0, 34U, 34U };
+static const struct S_strdata_2e380 D_strdata_2e380 = { "\146\156\040\146\050\141\072\040\151\156\164\040\075\040\065\054\040\142\072\040\151\156\164\056\056\056\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e381 D_strliteral_2e381 = { (char *)((char *)&D_strdata_2e380) + 0, 40U, 40U };
+static const struct S_strdata_2e382 D_strdata_2e382 = { "\146\156\040\146\050\141\072\040\163\164\162\040\075\040\065\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e383 D_strliteral_2e383 = { (char *)((char *)&D_strdata_2e382) + 0, 29U, 29U };
+static struct S_abortsites_2e418 D_abortsites_2e418 = { (char *)((char *)&D_strliteral_2e1) + 0, 123U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 123U, 53U };
+static struct S_x D_x = { 42U };
+static const struct S_strdata_2e440 D_strdata_2e440 = { "\062" };
+static struct S_strliteral_2e441 D_strliteral_2e441 = { (char *)((char *)&D_strdata_2e440) + 0, 1U, 1U };
+static struct S_abortsites_2e456 D_abortsites_2e456 = { (char *)((char *)&D_strliteral_2e1) + 0, 142U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 144U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 146U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 147U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 150U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 152U, 15U };
+static struct S_abortsites_2e498 D_abortsites_2e498 = { (char *)((char *)&D_strliteral_2e1) + 0, 73U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 74U, 15U };
+static struct S_abortsites_2e544 D_abortsites_2e544 = { (char *)((char *)&D_strliteral_2e1) + 0, 62U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 66U, 23U };
+static struct S_abortsites_2e619 D_abortsites_2e619 = { (char *)((char *)&D_strliteral_2e1) + 0, 23U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 25U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 25U, 23U };
+static struct S_abortsites_2e677 D_abortsites_2e677 = { (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 16U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 15U };
+static struct S_abortsites_2e727 D_abortsites_2e727 = { (char *)((char *)&D_strliteral_2e1) + 0, 256U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 257U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 258U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 260U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 261U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 262U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 267U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 268U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 269U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 270U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 272U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 274U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 275U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 278U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 283U, 15U };
+static struct S_abortsites_2e872 D_abortsites_2e872 = { (char *)((char *)&D_strliteral_2e1) + 0, 251U, 36U };
+void F_main(void) {
+	u64 t__2e13;
+	u64 t__2e14;
+	u64 t__2e15;
+	u64 t__2e16;
+	u64 t__2e17;
+	u64 t__2e20;
+	u64 t__2e21;
+	u64 t__2e8;
+	u64 t__2e9;
+	u64 t_abortsite_2e11;
+	L_start_2e2:;
+	L_body_2e3:;
+	t__2e9 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_simple)))());
+	t__2e8 = (u64)(u32)(((u32)t__2e9 == (u32)((u64)69UL)));
+	if ((u32)t__2e8) goto L_passed_2e7; else goto L_failed_2e6;
+	L_failed_2e6:;
+	t_abortsite_2e11 = ((u64)0UL);
+	goto L_abort_2e12;
+	L_passed_2e7:;
+	((void (*)(void))((u64)((char *)&F_inlining)))();
+	((void (*)(void))((u64)((char *)&F_pointers)))();
+	((void (*)(void))((u64)((char *)&F_vaargs)))();
+	((void (*)(void))((u64)((char *)&F_cvaargs)))();
+	((void (*)(void))((u64)((char *)&F_zerosizeparams)))();
+	t__2e21 = (u64)(u32)(*(i32 *)((u64)((char *)&D_x)));
+	t__2e20 = (u64)(u32)(((u32)t__2e21 == (u32)((u64)1337UL)));
+	if ((u32)t__2e20) goto L_passed_2e19; else goto L_failed_2e18;
+	L_failed_2e18:;
+	t_abortsite_2e11 = ((u64)1UL);
+	goto L_abort_2e12;
+	L_passed_2e19:;
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	((void (*)(void))((u64)((char *)&F_optional__params)))();
+	((void (*)(void))((u64)((char *)&F___never)))();
+	goto L__2e4;
+	L__2e22:;
+	L__2e4:;
+	return;
+	L_abort_2e12:;
+	t__2e13 = (u64)((u64)t_abortsite_2e11 * (u64)((u64)16UL));
+	t__2e13 = (u64)((u64)((u64)((char *)&D_abortsites_2e10)) + (u64)t__2e13);
+	t__2e14 = (u64)(*(u64 *)t__2e13);
+	t__2e15 = (u64)((u64)t__2e13 + (u64)((u64)8UL));
+	t__2e16 = (u64)(*(u32 *)t__2e15);
+	t__2e15 = (u64)((u64)t__2e13 + (u64)((u64)12UL));
+	t__2e17 = (u64)(*(u32 *)t__2e15);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e14, (u64)t__2e16, (u64)t__2e17, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_finifunc_2e6(void) {
+	L_start_2e23:;
+	L_body_2e24:;
+	goto L__2e25;
+	L__2e27:;
+	L__2e25:;
+	return;
+}
+static void F_finifunc_2e4(void) {
+	L_start_2e28:;
+	L_body_2e29:;
+	*(u32 *)((u64)X_rt_2eexit__status) = (u32)((u64)0UL);
+	goto L__2e30;
+	L__2e32:;
+	L__2e30:;
+	return;
+}
+static void F_initfunc_2e2(void) {
+	L_start_2e33:;
+	L_body_2e34:;
+	goto L__2e35;
+	L__2e37:;
+	L__2e35:;
+	return;
+}
+static void F_initfunc_2e0(void) {
+	L_start_2e38:;
+	L_body_2e39:;
+	*(u32 *)((u64)((char *)&D_x)) = (u32)((u64)1337UL);
+	*(u32 *)((u64)X_rt_2eexit__status) = (u32)((u64)42UL);
+	goto L__2e40;
+	L__2e42:;
+	L__2e40:;
+	return;
+}
+static void F___never(void) {
+	u64 t__2e51;
+	u64 t__2e57;
+	u64 t__2e63;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e66;
+	u64 t__2e67;
+	u64 t_abortsite_2e61;
+	L_start_2e43:;
+	L_body_2e44:;
+	t__2e51 = (u64)(u32)((u8)((u64)0UL));
+	if ((u32)t__2e51) goto L_true_2e48; else goto L_false_2e49;
+	L_true_2e48:;
+	((void (*)(u32))((u64)((char *)&F_neverfunc)))((u32)((u64)0UL));
+	__builtin_trap();
+	L__2e52:;
+	L_false_2e49:;
+	L__2e50:;
+	t__2e57 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e57) goto L_true_2e54; else goto L_false_2e55;
+	L_true_2e54:;
+	((void (*)(u32))((u64)((char *)&F_neverfunc)))((u32)((u64)1UL));
+	__builtin_trap();
+	L__2e58:;
+	L__2e59:;
+	L_false_2e55:;
+	L__2e56:;
+	t_abortsite_2e61 = ((u64)0UL);
+	goto L_abort_2e62;
+	L__2e68:;
+	L__2e45:;
+	L__2e69:;
+	return;
+	L_abort_2e62:;
+	t__2e63 = (u64)((u64)t_abortsite_2e61 * (u64)((u64)16UL));
+	t__2e63 = (u64)((u64)((u64)((char *)&D_abortsites_2e60)) + (u64)t__2e63);
+	t__2e64 = (u64)(*(u64 *)t__2e63);
+	t__2e65 = (u64)((u64)t__2e63 + (u64)((u64)8UL));
+	t__2e66 = (u64)(*(u32 *)t__2e65);
+	t__2e65 = (u64)((u64)t__2e63 + (u64)((u64)12UL));
+	t__2e67 = (u64)(*(u32 *)t__2e65);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e64, (u64)t__2e66, (u64)t__2e67, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_neverfunc(u32 p_x) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e84;
+	u64 t__2e85;
+	u64 t__2e86;
+	u64 t__2e87;
+	u64 t__2e88;
+	u64 t_abortsite_2e82;
+	u64 t_param_2e71;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e70:;
+	t_param_2e71 = (u64)A0;
+	*(u32 *)t_param_2e71 = (u32)t_x;
+	L_body_2e72:;
+	t__2e78 = (u64)(u32)(*(i32 *)t_param_2e71);
+	t__2e77 = (u64)(u32)(((u32)t__2e78 == (u32)((u64)1UL)));
+	t__2e79 = (u64)(u32)((u8)t__2e77);
+	if ((u32)t__2e79) goto L_true_2e74; else goto L_false_2e75;
+	L_true_2e74:;
+	((void (*)(u32))((u64)X_rt_2eexit))((u32)((u64)0UL));
+	__builtin_trap();
+	L__2e80:;
+	L_false_2e75:;
+	t_abortsite_2e82 = ((u64)0UL);
+	goto L_abort_2e83;
+	L__2e89:;
+	L__2e76:;
+	L__2e90:;
+	__builtin_trap();
+	L_abort_2e83:;
+	t__2e84 = (u64)((u64)t_abortsite_2e82 * (u64)((u64)16UL));
+	t__2e84 = (u64)((u64)((u64)((char *)&D_abortsites_2e81)) + (u64)t__2e84);
+	t__2e85 = (u64)(*(u64 *)t__2e84);
+	t__2e86 = (u64)((u64)t__2e84 + (u64)((u64)8UL));
+	t__2e87 = (u64)(*(u32 *)t__2e86);
+	t__2e86 = (u64)((u64)t__2e84 + (u64)((u64)12UL));
+	t__2e88 = (u64)(*(u32 *)t__2e86);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e85, (u64)t__2e87, (u64)t__2e88, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_optional__params(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[32] __attribute__((aligned(16)));
+	char A3[32] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[12] __attribute__((aligned(16)));
+	char A7[4] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char A9[2] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	char A12[4] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char R14[24] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char B16[24] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char R18[24] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	char B21[8] __attribute__((aligned(16)));
+	char R22[8] __attribute__((aligned(16)));
+	char B23[8] __attribute__((aligned(16)));
+	char R24[8] __attribute__((aligned(16)));
+	char B25[32] __attribute__((aligned(16)));
+	char R26[24] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char B29[32] __attribute__((aligned(16)));
+	char R30[24] __attribute__((aligned(16)));
+	char B31[24] __attribute__((aligned(16)));
+	char B32[24] __attribute__((aligned(16)));
+	char B33[24] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char B35[24] __attribute__((aligned(16)));
+	char B36[24] __attribute__((aligned(16)));
+	u64 t__2e102;
+	u64 t__2e103;
+	u64 t__2e104;
+	u64 t__2e105;
+	u64 t__2e106;
+	u64 t__2e109;
+	u64 t__2e110;
+	u64 t__2e113;
+	u64 t__2e114;
+	u64 t__2e120;
+	u64 t__2e121;
+	u64 t__2e126;
+	u64 t__2e127;
+	u64 t__2e130;
+	u64 t__2e131;
+	u64 t__2e134;
+	u64 t__2e135;
+	u64 t__2e138;
+	u64 t__2e143;
+	u64 t__2e146;
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e154;
+	u64 t__2e155;
+	u64 t__2e156;
+	u64 t__2e160;
+	u64 t__2e164;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e167;
+	u64 t__2e168;
+	u64 t__2e169;
+	u64 t__2e172;
+	u64 t__2e173;
+	u64 t__2e179;
+	u64 t__2e180;
+	u64 t__2e187;
+	u64 t__2e188;
+	u64 t__2e191;
+	u64 t__2e192;
+	u64 t__2e195;
+	u64 t__2e196;
+	u64 t__2e199;
+	u64 t__2e200;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e207;
+	u64 t__2e210;
+	u64 t__2e211;
+	u64 t__2e216;
+	u64 t__2e223;
+	u64 t__2e224;
+	u64 t__2e229;
+	u64 t__2e230;
+	u64 t__2e234;
+	u64 t__2e237;
+	u64 t__2e238;
+	u64 t__2e243;
+	u64 t__2e245;
+	u64 t__2e248;
+	u64 t__2e252;
+	u64 t__2e253;
+	u64 t__2e254;
+	u64 t__2e97;
+	u64 t__2e98;
+	u64 t_abortsite_2e100;
+	u64 t_binding_2e222;
+	u64 t_binding_2e249;
+	u64 t_field_2e176;
+	u64 t_item_2e215;
+	u64 t_item_2e233;
+	u64 t_item_2e242;
+	u64 t_object_2e142;
+	u64 t_object_2e153;
+	u64 t_object_2e174;
+	u64 t_object_2e181;
+	u64 t_object_2e205;
+	u64 t_object_2e212;
+	u64 t_object_2e213;
+	u64 t_object_2e231;
+	u64 t_object_2e232;
+	u64 t_object_2e239;
+	u64 t_object_2e240;
+	u64 t_subval_2e145;
+	u64 t_subval_2e159;
+	u64 t_value_2e182;
+	L_start_2e91:;
+	t_object_2e142 = (u64)A0;
+	t_object_2e153 = (u64)A1;
+	t_object_2e174 = (u64)A2;
+	t_object_2e181 = (u64)A3;
+	t_object_2e205 = (u64)A4;
+	t_object_2e212 = (u64)A5;
+	t_object_2e213 = (u64)A6;
+	t_binding_2e222 = (u64)A7;
+	t_object_2e231 = (u64)A8;
+	t_object_2e232 = (u64)A9;
+	t_object_2e239 = (u64)A10;
+	t_object_2e240 = (u64)A11;
+	t_binding_2e249 = (u64)A12;
+	L_body_2e92:;
+	t__2e98 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_optional__simple)))((u32)((u64)5UL), (u32)((u64)1UL)));
+	t__2e97 = (u64)(u32)(((u32)t__2e98 == (u32)((u64)1UL)));
+	if ((u32)t__2e97) goto L_passed_2e96; else goto L_failed_2e95;
+	L_failed_2e95:;
+	t_abortsite_2e100 = ((u64)0UL);
+	goto L_abort_2e101;
+	L_passed_2e96:;
+	t__2e110 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_optional__simple)))((u32)((u64)5UL), (u32)((u64)3UL)));
+	t__2e109 = (u64)(u32)(((u32)t__2e110 == (u32)((u64)3UL)));
+	if ((u32)t__2e109) goto L_passed_2e108; else goto L_failed_2e107;
+	L_failed_2e107:;
+	t_abortsite_2e100 = ((u64)1UL);
+	goto L_abort_2e101;
+	L_passed_2e108:;
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e117)), 24);
+	t__2e114 = ((u64 (*)(u64, u64))((u64)((char *)&F_optional__str)))((u64)R14, (u64)B13);
+	BLIT((u64)B15, t__2e114, 24);
+	BLIT((u64)B16, ((u64)((char *)&D_strliteral_2e117)), 24);
+	t__2e113 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B15, (u64)B16));
+	if ((u32)t__2e113) goto L_passed_2e112; else goto L_failed_2e111;
+	L_failed_2e111:;
+	t_abortsite_2e100 = ((u64)2UL);
+	goto L_abort_2e101;
+	L_passed_2e112:;
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e123)), 24);
+	t__2e121 = ((u64 (*)(u64, u64))((u64)((char *)&F_optional__str)))((u64)R18, (u64)B17);
+	BLIT((u64)B19, t__2e121, 24);
+	BLIT((u64)B20, ((u64)((char *)&D_strliteral_2e123)), 24);
+	t__2e120 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B19, (u64)B20));
+	if ((u32)t__2e120) goto L_passed_2e119; else goto L_failed_2e118;
+	L_failed_2e118:;
+	t_abortsite_2e100 = ((u64)3UL);
+	goto L_abort_2e101;
+	L_passed_2e119:;
+	t__2e127 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_optional__add)))((u32)((u64)3UL), (u32)((u64)2UL)));
+	t__2e126 = (u64)(u32)(((u32)t__2e127 == (u32)((u64)5UL)));
+	if ((u32)t__2e126) goto L_passed_2e125; else goto L_failed_2e124;
+	L_failed_2e124:;
+	t_abortsite_2e100 = ((u64)4UL);
+	goto L_abort_2e101;
+	L_passed_2e125:;
+	t__2e131 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_optional__add)))((u32)((u64)1UL), (u32)((u64)2UL)));
+	t__2e130 = (u64)(u32)(((u32)t__2e131 == (u32)((u64)3UL)));
+	if ((u32)t__2e130) goto L_passed_2e129; else goto L_failed_2e128;
+	L_failed_2e128:;
+	t_abortsite_2e100 = ((u64)5UL);
+	goto L_abort_2e101;
+	L_passed_2e129:;
+	t__2e135 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_optional__add)))((u32)((u64)1UL), (u32)((u64)1UL)));
+	t__2e134 = (u64)(u32)(((u32)t__2e135 == (u32)((u64)2UL)));
+	if ((u32)t__2e134) goto L_passed_2e133; else goto L_failed_2e132;
+	L_failed_2e132:;
+	t_abortsite_2e100 = ((u64)6UL);
+	goto L_abort_2e101;
+	L_passed_2e133:;
+	*(u32 *)t_object_2e142 = (u32)((u64)3012680272UL);
+	BLIT((u64)B21, t_object_2e142, 8);
+	t__2e138 = ((u64 (*)(u64, u64))((u64)((char *)&F_optional__tagged)))((u64)R22, (u64)B21);
+	t__2e143 = (u64)(u32)(*(u32 *)t__2e138);
+	t_subval_2e145 = t__2e138;
+	t__2e146 = (u64)(u32)(((u32)t__2e143 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e146) goto L_subtype_2e148; else goto L_passed_2e144;
+	L_subtype_2e148:;
+	goto L_passed_2e144;
+	L_passed_2e144:;
+	if ((u32)t__2e146) goto L_passed_2e137; else goto L_failed_2e136;
+	L_failed_2e136:;
+	t_abortsite_2e100 = ((u64)7UL);
+	goto L_abort_2e101;
+	L_passed_2e137:;
+	*(u32 *)t_object_2e153 = (u32)((u64)1099590421UL);
+	t__2e154 = (u64)((u64)t_object_2e153 + (u64)((u64)4UL));
+	*(u32 *)t__2e154 = (u32)((u64)5UL);
+	BLIT((u64)B23, t_object_2e153, 8);
+	t__2e152 = ((u64 (*)(u64, u64))((u64)((char *)&F_optional__tagged)))((u64)R24, (u64)B23);
+	t__2e155 = t__2e152;
+	t__2e156 = (u64)(u32)(*(u32 *)t__2e152);
+	t_subval_2e159 = t__2e152;
+	t__2e160 = (u64)(u32)(((u32)t__2e156 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e160) goto L_subtype_2e162; else goto L_failed_2e158;
+	L_subtype_2e162:;
+	goto L_passed_2e157;
+	L_failed_2e158:;
+	t_abortsite_2e100 = ((u64)8UL);
+	goto L_abort_2e163;
+	L_passed_2e157:;
+	t__2e155 = (u64)((u64)t__2e155 + (u64)((u64)4UL));
+	t__2e169 = (u64)(u32)(*(i32 *)t__2e155);
+	t__2e151 = (u64)(u32)(((u32)t__2e169 == (u32)((u64)5UL)));
+	if ((u32)t__2e151) goto L_passed_2e150; else goto L_failed_2e149;
+	L_failed_2e149:;
+	t_abortsite_2e100 = ((u64)9UL);
+	goto L_abort_2e101;
+	L_passed_2e150:;
+	t_field_2e176 = (u64)((u64)t_object_2e174 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e176 = (u32)((u64)42UL);
+	t_field_2e176 = (u64)((u64)t_object_2e174 + (u64)((u64)8UL));
+	BLIT(t_field_2e176, ((u64)((char *)&D_strliteral_2e117)), ((u64)24UL));
+	BLIT((u64)B25, t_object_2e174, 32);
+	t__2e173 = ((u64 (*)(u64, u64))((u64)((char *)&F_optional__tuple)))((u64)R26, (u64)B25);
+	BLIT((u64)B27, t__2e173, 24);
+	BLIT((u64)B28, ((u64)((char *)&D_strliteral_2e117)), 24);
+	t__2e172 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B27, (u64)B28));
+	if ((u32)t__2e172) goto L_passed_2e171; else goto L_failed_2e170;
+	L_failed_2e170:;
+	t_abortsite_2e100 = ((u64)10UL);
+	goto L_abort_2e101;
+	L_passed_2e171:;
+	t_value_2e182 = (u64)((u64)t_object_2e181 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e182 = (u32)((u64)12UL);
+	t_value_2e182 = (u64)((u64)t_object_2e181 + (u64)((u64)8UL));
+	BLIT(t_value_2e182, ((u64)((char *)&D_strliteral_2e184)), ((u64)24UL));
+	BLIT((u64)B29, t_object_2e181, 32);
+	t__2e180 = ((u64 (*)(u64, u64))((u64)((char *)&F_optional__tuple)))((u64)R30, (u64)B29);
+	BLIT((u64)B31, t__2e180, 24);
+	BLIT((u64)B32, ((u64)((char *)&D_strliteral_2e184)), 24);
+	t__2e179 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B31, (u64)B32));
+	if ((u32)t__2e179) goto L_passed_2e178; else goto L_failed_2e177;
+	L_failed_2e177:;
+	t_abortsite_2e100 = ((u64)11UL);
+	goto L_abort_2e101;
+	L_passed_2e178:;
+	t__2e188 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_optional__alias)))((u32)((u64)3UL)));
+	t__2e187 = (u64)(u32)(((u32)t__2e188 == (u32)((u64)3UL)));
+	if ((u32)t__2e187) goto L_passed_2e186; else goto L_failed_2e185;
+	L_failed_2e185:;
+	t_abortsite_2e100 = ((u64)12UL);
+	goto L_abort_2e101;
+	L_passed_2e186:;
+	t__2e192 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_optional__alias)))((u32)((u64)1UL)));
+	t__2e191 = (u64)(u32)(((u32)t__2e192 == (u32)((u64)1UL)));
+	if ((u32)t__2e191) goto L_passed_2e190; else goto L_failed_2e189;
+	L_failed_2e189:;
+	t_abortsite_2e100 = ((u64)13UL);
+	goto L_abort_2e101;
+	L_passed_2e190:;
+	t__2e196 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_optional__alias2)))((u32)((u64)3UL)));
+	t__2e195 = (u64)(u32)(((u32)t__2e196 == (u32)((u64)3UL)));
+	if ((u32)t__2e195) goto L_passed_2e194; else goto L_failed_2e193;
+	L_failed_2e193:;
+	t_abortsite_2e100 = ((u64)14UL);
+	goto L_abort_2e101;
+	L_passed_2e194:;
+	t__2e200 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_optional__alias2)))((u32)((u64)1UL)));
+	t__2e199 = (u64)(u32)(((u32)t__2e200 == (u32)((u64)1UL)));
+	if ((u32)t__2e199) goto L_passed_2e198; else goto L_failed_2e197;
+	L_failed_2e197:;
+	t_abortsite_2e100 = ((u64)15UL);
+	goto L_abort_2e101;
+	L_passed_2e198:;
+	*(u64 *)t_object_2e205 = (u64)((u64)0UL);
+	t__2e207 = (u64)((u64)t_object_2e205 + (u64)((u64)8UL));
+	*(u64 *)t__2e207 = (u64)((u64)0UL);
+	t__2e207 = (u64)((u64)t__2e207 + (u64)((u64)8UL));
+	*(u64 *)t__2e207 = (u64)((u64)0UL);
+	BLIT((u64)B33, t_object_2e205, 24);
+	t__2e204 = (u64)(((u64 (*)(u64))((u64)((char *)&F_optional__slc)))((u64)B33));
+	t__2e203 = (u64)(u32)(((u64)t__2e204 == (u64)((u64)0UL)));
+	if ((u32)t__2e203) goto L_passed_2e202; else goto L_failed_2e201;
+	L_failed_2e201:;
+	t_abortsite_2e100 = ((u64)16UL);
+	goto L_abort_2e101;
+	L_passed_2e202:;
+	t_item_2e215 = (u64)((u64)t_object_2e213 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e215 = (u32)((u64)1UL);
+	t_item_2e215 = (u64)((u64)t_object_2e213 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e215 = (u32)((u64)2UL);
+	t_item_2e215 = (u64)((u64)t_object_2e213 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e215 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e212 = (u64)t_object_2e213;
+	t__2e216 = (u64)((u64)t_object_2e212 + (u64)((u64)8UL));
+	*(u64 *)t__2e216 = (u64)((u64)3UL);
+	t__2e216 = (u64)((u64)t__2e216 + (u64)((u64)8UL));
+	*(u64 *)t__2e216 = (u64)((u64)3UL);
+	BLIT((u64)B34, t_object_2e212, 24);
+	t__2e211 = (u64)(((u64 (*)(u64))((u64)((char *)&F_optional__slc)))((u64)B34));
+	t__2e210 = (u64)(u32)(((u64)t__2e211 == (u64)((u64)3UL)));
+	if ((u32)t__2e210) goto L_passed_2e209; else goto L_failed_2e208;
+	L_failed_2e208:;
+	t_abortsite_2e100 = ((u64)17UL);
+	goto L_abort_2e101;
+	L_passed_2e209:;
+	*(u32 *)t_binding_2e222 = (u32)((u64)0UL);
+	L_loop_2e217:;
+	t__2e224 = (u64)(u32)(*(i32 *)t_binding_2e222);
+	t__2e223 = (u64)(u32)(((i32)t__2e224 < (i32)((u64)3UL)));
+	if ((u32)t__2e223) goto L_body_2e218; else goto L__2e220;
+	L_body_2e218:;
+	t_item_2e233 = (u64)((u64)t_object_2e232 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e233 = (u32)((u64)1UL);
+	t_item_2e233 = (u64)((u64)t_object_2e232 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e233 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e231 = (u64)t_object_2e232;
+	t__2e234 = (u64)((u64)t_object_2e231 + (u64)((u64)8UL));
+	*(u64 *)t__2e234 = (u64)((u64)2UL);
+	t__2e234 = (u64)((u64)t__2e234 + (u64)((u64)8UL));
+	*(u64 *)t__2e234 = (u64)((u64)2UL);
+	BLIT((u64)B35, t_object_2e231, 24);
+	t__2e230 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_optional__slc2)))((u64)B35));
+	t__2e229 = (u64)(u32)(((u32)t__2e230 == (u32)((u64)1UL)));
+	if ((u32)t__2e229) goto L_passed_2e228; else goto L_failed_2e227;
+	L_failed_2e227:;
+	t_abortsite_2e100 = ((u64)18UL);
+	goto L_abort_2e101;
+	L_passed_2e228:;
+	t_item_2e242 = (u64)((u64)t_object_2e240 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e242 = (u32)((u64)2UL);
+	t_item_2e242 = (u64)((u64)t_object_2e240 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e242 = (u32)((u64)2UL);
+	*(u64 *)t_object_2e239 = (u64)t_object_2e240;
+	t__2e243 = (u64)((u64)t_object_2e239 + (u64)((u64)8UL));
+	*(u64 *)t__2e243 = (u64)((u64)2UL);
+	t__2e243 = (u64)((u64)t__2e243 + (u64)((u64)8UL));
+	*(u64 *)t__2e243 = (u64)((u64)2UL);
+	BLIT((u64)B36, t_object_2e239, 24);
+	t__2e238 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_optional__slc2)))((u64)B36));
+	t__2e237 = (u64)(u32)(((u32)t__2e238 == (u32)((u64)2UL)));
+	if ((u32)t__2e237) goto L_passed_2e236; else goto L_failed_2e235;
+	L_failed_2e235:;
+	t_abortsite_2e100 = ((u64)19UL);
+	goto L_abort_2e101;
+	L_passed_2e236:;
+	goto L__2e225;
+	L__2e244:;
+	L__2e225:;
+	L_after_2e221:;
+	t__2e245 = (u64)(u32)(*(i32 *)t_binding_2e222);
+	t__2e245 = (u64)(u32)((u32)t__2e245 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e222 = (u32)t__2e245;
+	goto L_loop_2e217;
+	L__2e220:;
+	t__2e248 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_optional__ptr)))((u64)((u64)0UL)));
+	if ((u32)t__2e248) goto L_passed_2e247; else goto L_failed_2e246;
+	L_failed_2e246:;
+	t_abortsite_2e100 = ((u64)20UL);
+	goto L_abort_2e101;
+	L_passed_2e247:;
+	*(u32 *)t_binding_2e249 = (u32)((u64)0UL);
+	t__2e252 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_optional__ptr)))((u64)t_binding_2e249));
+	t__2e254 = (u64)(u32)((u8)t__2e252);
+	t__2e253 = (u64)(u32)(((u32)t__2e254 == (u32)((u64)0UL)));
+	if ((u32)t__2e253) goto L_passed_2e251; else goto L_failed_2e250;
+	L_failed_2e250:;
+	t_abortsite_2e100 = ((u64)21UL);
+	goto L_abort_2e101;
+	L_passed_2e251:;
+	goto L__2e93;
+	L__2e255:;
+	L__2e93:;
+	return;
+	L_abort_2e101:;
+	t__2e102 = (u64)((u64)t_abortsite_2e100 * (u64)((u64)16UL));
+	t__2e102 = (u64)((u64)((u64)((char *)&D_abortsites_2e99)) + (u64)t__2e102);
+	t__2e103 = (u64)(*(u64 *)t__2e102);
+	t__2e104 = (u64)((u64)t__2e102 + (u64)((u64)8UL));
+	t__2e105 = (u64)(*(u32 *)t__2e104);
+	t__2e104 = (u64)((u64)t__2e102 + (u64)((u64)12UL));
+	t__2e106 = (u64)(*(u32 *)t__2e104);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e103, (u64)t__2e105, (u64)t__2e106, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e163:;
+	t__2e164 = (u64)((u64)t_abortsite_2e100 * (u64)((u64)16UL));
+	t__2e164 = (u64)((u64)((u64)((char *)&D_abortsites_2e99)) + (u64)t__2e164);
+	t__2e165 = (u64)(*(u64 *)t__2e164);
+	t__2e166 = (u64)((u64)t__2e164 + (u64)((u64)8UL));
+	t__2e167 = (u64)(*(u32 *)t__2e166);
+	t__2e166 = (u64)((u64)t__2e164 + (u64)((u64)12UL));
+	t__2e168 = (u64)(*(u32 *)t__2e166);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e165, (u64)t__2e167, (u64)t__2e168, (u64)((u64)1UL));
+	__builtin_trap();
+}
+static u32 F_optional__ptr(u64 p_x) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e259;
+	u64 t__2e260;
+	u64 t_param_2e257;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e256:;
+	t_param_2e257 = (u64)A0;
+	*(u64 *)t_param_2e257 = (u64)t_x;
+	L_body_2e258:;
+	t__2e259 = (u64)(*(u64 *)t_param_2e257);
+	t__2e260 = (u64)(u32)(((u64)t__2e259 == (u64)((u64)0UL)));
+	return (u32)t__2e260;
+}
+static u32 F_optional__slc2(u64 p_x) {
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e269;
+	u64 t__2e270;
+	u64 t__2e271;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e280;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e283;
+	u64 t__2e284;
+	u64 t__2e285;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e289;
+	u64 t__2e290;
+	u64 t__2e291;
+	u64 t__2e292;
+	u64 t__2e293;
+	u64 t__2e294;
+	u64 t__2e295;
+	u64 t__2e296;
+	u64 t__2e297;
+	u64 t__2e298;
+	u64 t__2e301;
+	u64 t__2e302;
+	u64 t__2e303;
+	u64 t__2e304;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e310;
+	u64 t_abortsite_2e278;
+	u64 t_x;
+	t_x = p_x;
+	L_start_2e261:;
+	L_body_2e262:;
+	t__2e269 = (u64)((u64)t_x + (u64)((u64)8UL));
+	t__2e270 = (u64)((u64)t_x + (u64)((u64)16UL));
+	t__2e271 = (u64)(*(u64 *)t_x);
+	t__2e272 = (u64)(*(u64 *)t__2e269);
+	t__2e273 = (u64)((i64)(i32)((u64)1UL));
+	t__2e268 = (u64)((u64)t__2e273 * (u64)((u64)4UL));
+	t__2e268 = (u64)((u64)t__2e271 + (u64)t__2e268);
+	t__2e274 = (u64)(u32)(((u64)t__2e273 < (u64)t__2e272));
+	if ((u32)t__2e274) goto L__2e276; else goto L__2e275;
+	L__2e275:;
+	t_abortsite_2e278 = ((u64)0UL);
+	goto L_abort_2e279;
+	L__2e276:;
+	t__2e285 = (u64)(u32)(*(i32 *)t__2e268);
+	t__2e267 = (u64)(u32)(((u32)t__2e285 == (u32)((u64)2UL)));
+	if ((u32)t__2e267) goto L_passed_2e266; else goto L_failed_2e265;
+	L_failed_2e265:;
+	t_abortsite_2e278 = ((u64)1UL);
+	goto L_abort_2e286;
+	L_passed_2e266:;
+	t__2e293 = (u64)((u64)t_x + (u64)((u64)8UL));
+	t__2e294 = (u64)((u64)t_x + (u64)((u64)16UL));
+	t__2e295 = (u64)(*(u64 *)t_x);
+	t__2e296 = (u64)(*(u64 *)t__2e293);
+	t__2e297 = (u64)((i64)(i32)((u64)1UL));
+	t__2e292 = (u64)((u64)t__2e297 * (u64)((u64)4UL));
+	t__2e292 = (u64)((u64)t__2e295 + (u64)t__2e292);
+	t__2e298 = (u64)(u32)(((u64)t__2e297 < (u64)t__2e296));
+	if ((u32)t__2e298) goto L__2e300; else goto L__2e299;
+	L__2e299:;
+	t_abortsite_2e278 = ((u64)2UL);
+	goto L_abort_2e279;
+	L__2e300:;
+	*(u32 *)t__2e292 = (u32)((u64)3UL);
+	t__2e302 = (u64)((u64)t_x + (u64)((u64)8UL));
+	t__2e303 = (u64)((u64)t_x + (u64)((u64)16UL));
+	t__2e304 = (u64)(*(u64 *)t_x);
+	t__2e305 = (u64)(*(u64 *)t__2e302);
+	t__2e306 = (u64)((i64)(i32)((u64)0UL));
+	t__2e301 = (u64)((u64)t__2e306 * (u64)((u64)4UL));
+	t__2e301 = (u64)((u64)t__2e304 + (u64)t__2e301);
+	t__2e307 = (u64)(u32)(((u64)t__2e306 < (u64)t__2e305));
+	if ((u32)t__2e307) goto L__2e309; else goto L__2e308;
+	L__2e308:;
+	t_abortsite_2e278 = ((u64)3UL);
+	goto L_abort_2e279;
+	L__2e309:;
+	t__2e310 = (u64)(u32)(*(i32 *)t__2e301);
+	return (u32)t__2e310;
+	L__2e311:;
+	L__2e263:;
+	L__2e312:;
+	return 0;
+	L_abort_2e279:;
+	t__2e280 = (u64)((u64)t_abortsite_2e278 * (u64)((u64)16UL));
+	t__2e280 = (u64)((u64)((u64)((char *)&D_abortsites_2e277)) + (u64)t__2e280);
+	t__2e281 = (u64)(*(u64 *)t__2e280);
+	t__2e282 = (u64)((u64)t__2e280 + (u64)((u64)8UL));
+	t__2e283 = (u64)(*(u32 *)t__2e282);
+	t__2e282 = (u64)((u64)t__2e280 + (u64)((u64)12UL));
+	t__2e284 = (u64)(*(u32 *)t__2e282);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e281, (u64)t__2e283, (u64)t__2e284, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e286:;
+	t__2e287 = (u64)((u64)t_abortsite_2e278 * (u64)((u64)16UL));
+	t__2e287 = (u64)((u64)((u64)((char *)&D_abortsites_2e277)) + (u64)t__2e287);
+	t__2e288 = (u64)(*(u64 *)t__2e287);
+	t__2e289 = (u64)((u64)t__2e287 + (u64)((u64)8UL));
+	t__2e290 = (u64)(*(u32 *)t__2e289);
+	t__2e289 = (u64)((u64)t__2e287 + (u64)((u64)12UL));
+	t__2e291 = (u64)(*(u32 *)t__2e289);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e288, (u64)t__2e290, (u64)t__2e291, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u64 F_optional__slc(u64 p_x) {
+	u64 t__2e315;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t_x;
+	t_x = p_x;
+	L_start_2e313:;
+	L_body_2e314:;
+	t__2e315 = (u64)((u64)t_x + (u64)((u64)8UL));
+	t__2e316 = (u64)((u64)t_x + (u64)((u64)16UL));
+	t__2e317 = (u64)(*(u64 *)t__2e315);
+	return (u64)t__2e317;
+}
+static u32 F_optional__alias2(u32 p_x) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e321;
+	u64 t_param_2e319;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e318:;
+	t_param_2e319 = (u64)A0;
+	*(u32 *)t_param_2e319 = (u32)t_x;
+	L_body_2e320:;
+	t__2e321 = (u64)(u32)(*(i32 *)t_param_2e319);
+	return (u32)t__2e321;
+}
+static u32 F_optional__alias(u32 p_x) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e325;
+	u64 t_param_2e323;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e322:;
+	t_param_2e323 = (u64)A0;
+	*(u32 *)t_param_2e323 = (u32)t_x;
+	L_body_2e324:;
+	t__2e325 = (u64)(u32)(*(i32 *)t_param_2e323);
+	return (u32)t__2e325;
+}
+static u64 F_optional__tuple(u64 __rp, u64 p_x) {
+	u64 t_value_2e328;
+	u64 t_x;
+	t_x = p_x;
+	L_start_2e326:;
+	L_body_2e327:;
+	t_value_2e328 = (u64)((u64)t_x + (u64)((u64)8UL));
+	BLIT(__rp, t_value_2e328, 24); return __rp;
+}
+static u64 F_optional__tagged(u64 __rp, u64 p_x) {
+	u64 t_x;
+	t_x = p_x;
+	L_start_2e329:;
+	L_body_2e330:;
+	BLIT(__rp, t_x, 8); return __rp;
+}
+static u32 F_optional__add(u32 p_a, u32 p_b) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e335;
+	u64 t__2e336;
+	u64 t__2e337;
+	u64 t_a;
+	u64 t_b;
+	u64 t_param_2e332;
+	u64 t_param_2e333;
+	t_a = (u64)p_a;
+	t_b = (u64)p_b;
+	L_start_2e331:;
+	t_param_2e332 = (u64)A0;
+	t_param_2e333 = (u64)A1;
+	*(u32 *)t_param_2e332 = (u32)t_a;
+	*(u32 *)t_param_2e333 = (u32)t_b;
+	L_body_2e334:;
+	t__2e336 = (u64)(u32)(*(i32 *)t_param_2e332);
+	t__2e337 = (u64)(u32)(*(i32 *)t_param_2e333);
+	t__2e335 = (u64)(u32)((u32)t__2e336 + (u32)t__2e337);
+	return (u32)t__2e335;
+}
+static u64 F_optional__str(u64 __rp, u64 p_x) {
+	u64 t_x;
+	t_x = p_x;
+	L_start_2e338:;
+	L_body_2e339:;
+	BLIT(__rp, t_x, 24); return __rp;
+}
+static u32 F_optional__simple(u32 p_a, u32 p_b) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e344;
+	u64 t_a;
+	u64 t_b;
+	u64 t_param_2e341;
+	u64 t_param_2e342;
+	t_a = (u64)p_a;
+	t_b = (u64)p_b;
+	L_start_2e340:;
+	t_param_2e341 = (u64)A0;
+	t_param_2e342 = (u64)A1;
+	*(u32 *)t_param_2e341 = (u32)t_a;
+	*(u32 *)t_param_2e342 = (u32)t_b;
+	L_body_2e343:;
+	t__2e344 = (u64)(u32)(*(i32 *)t_param_2e342);
+	return (u32)t__2e344;
+}
+static void F_reject(void) {
+	char A0[384] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char B4[8] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char R7[4] __attribute__((aligned(16)));
+	u64 t__2e390;
+	u64 t__2e391;
+	u64 t__2e395;
+	u64 t__2e401;
+	u64 t__2e402;
+	u64 t__2e403;
+	u64 t__2e406;
+	u64 t__2e415;
+	u64 t__2e417;
+	u64 t__2e421;
+	u64 t__2e422;
+	u64 t__2e423;
+	u64 t__2e424;
+	u64 t__2e425;
+	u64 t__2e428;
+	u64 t__2e429;
+	u64 t__2e430;
+	u64 t__2e431;
+	u64 t__2e432;
+	u64 t__2e434;
+	u64 t_abortsite_2e419;
+	u64 t_binding_2e349;
+	u64 t_binding_2e389;
+	u64 t_item_2e351;
+	u64 t_object_2e397;
+	u64 t_object_2e404;
+	u64 t_tag_2e407;
+	L_start_2e345:;
+	t_binding_2e349 = (u64)A0;
+	t_binding_2e389 = (u64)A1;
+	t_object_2e397 = (u64)A2;
+	t_object_2e404 = (u64)A3;
+	L_body_2e346:;
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)0UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e353)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)24UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e355)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)48UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e357)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)72UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e359)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)96UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e361)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)120UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e363)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)144UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e365)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)168UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e367)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)192UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e369)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)216UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e371)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)240UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e373)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)264UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e375)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)288UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e377)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)312UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e379)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)336UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e381)), ((u64)24UL));
+	t_item_2e351 = (u64)((u64)t_binding_2e349 + (u64)((u64)360UL));
+	BLIT(t_item_2e351, ((u64)((char *)&D_strliteral_2e383)), ((u64)24UL));
+	*(u64 *)t_binding_2e389 = (u64)((u64)0UL);
+	L_loop_2e384:;
+	t__2e391 = (u64)(*(u64 *)t_binding_2e389);
+	t__2e390 = (u64)(u32)(((u64)t__2e391 < (u64)((u64)16UL)));
+	if ((u32)t__2e390) goto L_body_2e385; else goto L__2e387;
+	L_body_2e385:;
+	*(u32 *)t_object_2e397 = (u32)((u64)3532310079UL);
+	t__2e401 = (u64)((u64)t_object_2e397 + (u64)((u64)4UL));
+	*(u32 *)t__2e401 = (u32)((u64)4UL);
+	t__2e403 = (u64)(*(u64 *)t_binding_2e389);
+	t__2e402 = (u64)((u64)t__2e403 * (u64)((u64)24UL));
+	t__2e402 = (u64)((u64)t_binding_2e349 + (u64)t__2e402);
+	*(u64 *)t_object_2e404 = (u64)((u64)0UL);
+	t__2e406 = (u64)((u64)t_object_2e404 + (u64)((u64)8UL));
+	*(u64 *)t__2e406 = (u64)((u64)0UL);
+	t__2e406 = (u64)((u64)t__2e406 + (u64)((u64)8UL));
+	*(u64 *)t__2e406 = (u64)((u64)0UL);
+	BLIT((u64)B4, t_object_2e397, 8);
+	BLIT((u64)B5, t__2e402, 24);
+	BLIT((u64)B6, t_object_2e404, 24);
+	t__2e395 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R7, (u64)B4, (u64)B5, (u64)B6);
+	t_tag_2e407 = (u64)(*(u32 *)t__2e395);
+	t__2e415 = (u64)(u32)(((u32)t_tag_2e407 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e415) goto L_member_2e412; else goto L__2e414;
+	L__2e414:;
+	t__2e417 = (u64)(u32)(((u32)t_tag_2e407 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e417) goto L_member_2e413; else goto L__2e416;
+	L__2e416:;
+	goto L_matches_2e411;
+	L_member_2e412:;
+	goto L_matches_2e411;
+	L_member_2e413:;
+	goto L_matches_2e410;
+	L_matches_2e410:;
+	goto L__2e408;
+	L_matches_2e411:;
+	t_abortsite_2e419 = ((u64)0UL);
+	goto L_abort_2e420;
+	L__2e426:;
+	L__2e409:;
+	t_abortsite_2e419 = ((u64)1UL);
+	goto L_abort_2e427;
+	L__2e408:;
+	goto L__2e392;
+	L__2e433:;
+	L__2e392:;
+	L_after_2e388:;
+	t__2e434 = (u64)(*(u64 *)t_binding_2e389);
+	t__2e434 = (u64)((u64)t__2e434 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e389 = (u64)t__2e434;
+	goto L_loop_2e384;
+	L__2e387:;
+	goto L__2e347;
+	L__2e435:;
+	L__2e347:;
+	return;
+	L_abort_2e420:;
+	t__2e421 = (u64)((u64)t_abortsite_2e419 * (u64)((u64)16UL));
+	t__2e421 = (u64)((u64)((u64)((char *)&D_abortsites_2e418)) + (u64)t__2e421);
+	t__2e422 = (u64)(*(u64 *)t__2e421);
+	t__2e423 = (u64)((u64)t__2e421 + (u64)((u64)8UL));
+	t__2e424 = (u64)(*(u32 *)t__2e423);
+	t__2e423 = (u64)((u64)t__2e421 + (u64)((u64)12UL));
+	t__2e425 = (u64)(*(u32 *)t__2e423);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e422, (u64)t__2e424, (u64)t__2e425, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e427:;
+	t__2e428 = (u64)((u64)t_abortsite_2e419 * (u64)((u64)16UL));
+	t__2e428 = (u64)((u64)((u64)((char *)&D_abortsites_2e418)) + (u64)t__2e428);
+	t__2e429 = (u64)(*(u64 *)t__2e428);
+	t__2e430 = (u64)((u64)t__2e428 + (u64)((u64)8UL));
+	t__2e431 = (u64)(*(u32 *)t__2e430);
+	t__2e430 = (u64)((u64)t__2e428 + (u64)((u64)12UL));
+	t__2e432 = (u64)(*(u32 *)t__2e430);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e429, (u64)t__2e431, (u64)t__2e432, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_zerosizeparams(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char B1[24] __attribute__((aligned(16)));
+	u64 t__2e442;
+	L_start_2e436:;
+	t__2e442 = (u64)A0;
+	L_body_2e437:;
+	*(u32 *)t__2e442 = (u32)((u64)4UL);
+	BLIT((u64)B1, ((u64)((char *)&D_strliteral_2e441)), 24);
+	((void (*)(u32, u64, double, u64, u32))((u64)((char *)&F_zeroparamfunc)))((u32)((u64)1UL), (u64)B1, BD(((u64)4613937818241073152UL)), (u64)t__2e442, (u32)((u64)5UL));
+	goto L__2e438;
+	L__2e443:;
+	L__2e438:;
+	return;
+}
+static void F_zeroparamfunc(u32 p_a, u64 p_c, double p_e, u64 p_h, u32 p_j) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	u64 t__2e454;
+	u64 t__2e455;
+	u64 t__2e459;
+	u64 t__2e460;
+	u64 t__2e461;
+	u64 t__2e462;
+	u64 t__2e463;
+	u64 t__2e466;
+	u64 t__2e469;
+	u64 t__2e472;
+	u64 t__2e473;
+	u64 t__2e476;
+	u64 t__2e477;
+	u64 t__2e478;
+	u64 t__2e481;
+	u64 t__2e482;
+	u64 t_a;
+	u64 t_abortsite_2e457;
+	u64 t_c;
+	u64 t_e;
+	u64 t_h;
+	u64 t_j;
+	u64 t_param_2e445;
+	u64 t_param_2e446;
+	u64 t_param_2e447;
+	u64 t_param_2e448;
+	t_a = (u64)p_a;
+	t_c = p_c;
+	t_e = DB(p_e);
+	t_h = (u64)p_h;
+	t_j = (u64)p_j;
+	L_start_2e444:;
+	t_param_2e445 = (u64)A0;
+	t_param_2e446 = (u64)A1;
+	t_param_2e447 = (u64)A2;
+	t_param_2e448 = (u64)A3;
+	*(u32 *)t_param_2e445 = (u32)t_a;
+	*(u64 *)t_param_2e446 = (u64)t_e;
+	*(u64 *)t_param_2e447 = (u64)t_h;
+	*(u32 *)t_param_2e448 = (u32)t_j;
+	L_body_2e449:;
+	t__2e455 = (u64)(u32)(*(i32 *)t_param_2e445);
+	t__2e454 = (u64)(u32)(((u32)t__2e455 == (u32)((u64)1UL)));
+	if ((u32)t__2e454) goto L_passed_2e453; else goto L_failed_2e452;
+	L_failed_2e452:;
+	t_abortsite_2e457 = ((u64)0UL);
+	goto L_abort_2e458;
+	L_passed_2e453:;
+	BLIT((u64)B4, t_c, 24);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e441)), 24);
+	t__2e466 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B4, (u64)B5));
+	if ((u32)t__2e466) goto L_passed_2e465; else goto L_failed_2e464;
+	L_failed_2e464:;
+	t_abortsite_2e457 = ((u64)1UL);
+	goto L_abort_2e458;
+	L_passed_2e465:;
+	t__2e469 = (u64)(u32)(((u64)((u64)0UL) == (u64)((u64)0UL)));
+	if ((u32)t__2e469) goto L_passed_2e468; else goto L_failed_2e467;
+	L_failed_2e467:;
+	t_abortsite_2e457 = ((u64)2UL);
+	goto L_abort_2e458;
+	L_passed_2e468:;
+	t__2e473 = (u64)(*(u64 *)t_param_2e446);
+	t__2e472 = (u64)(u32)((BD(t__2e473) == BD(((u64)4613937818241073152UL))));
+	if ((u32)t__2e472) goto L_passed_2e471; else goto L_failed_2e470;
+	L_failed_2e470:;
+	t_abortsite_2e457 = ((u64)3UL);
+	goto L_abort_2e458;
+	L_passed_2e471:;
+	t__2e477 = (u64)(*(u64 *)t_param_2e447);
+	t__2e478 = (u64)(u32)(*(i32 *)t__2e477);
+	t__2e476 = (u64)(u32)(((u32)t__2e478 == (u32)((u64)4UL)));
+	if ((u32)t__2e476) goto L_passed_2e475; else goto L_failed_2e474;
+	L_failed_2e474:;
+	t_abortsite_2e457 = ((u64)4UL);
+	goto L_abort_2e458;
+	L_passed_2e475:;
+	t__2e482 = (u64)(u32)(*(i32 *)t_param_2e448);
+	t__2e481 = (u64)(u32)(((u32)t__2e482 == (u32)((u64)5UL)));
+	if ((u32)t__2e481) goto L_passed_2e480; else goto L_failed_2e479;
+	L_failed_2e479:;
+	t_abortsite_2e457 = ((u64)5UL);
+	goto L_abort_2e458;
+	L_passed_2e480:;
+	goto L__2e450;
+	L__2e483:;
+	L__2e450:;
+	return;
+	L_abort_2e458:;
+	t__2e459 = (u64)((u64)t_abortsite_2e457 * (u64)((u64)16UL));
+	t__2e459 = (u64)((u64)((u64)((char *)&D_abortsites_2e456)) + (u64)t__2e459);
+	t__2e460 = (u64)(*(u64 *)t__2e459);
+	t__2e461 = (u64)((u64)t__2e459 + (u64)((u64)8UL));
+	t__2e462 = (u64)(*(u32 *)t__2e461);
+	t__2e461 = (u64)((u64)t__2e459 + (u64)((u64)12UL));
+	t__2e463 = (u64)(*(u32 *)t__2e461);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e460, (u64)t__2e462, (u64)t__2e463, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_cvaargs(void) {
+	L_start_2e484:;
+	L_body_2e485:;
+	((void (*)(u32, ...))((u64)((char *)&F_cvafn)))((u32)((u64)3UL), (u32)((u64)1UL), (u32)((u64)2UL), (u32)((u64)3UL));
+	((void (*)(u32, ...))((u64)((char *)&F_cvafn2)))((u32)((u64)1337UL), (u32)((u64)42UL));
+	((void (*)(u32, ...))((u64)((char *)&F_cvafn)))((u32)((u64)3UL), (u32)((u64)1UL), (u32)((u64)2UL), (u32)((u64)3UL));
+	((void (*)(u32, ...))((u64)((char *)&F_cvafn2)))((u32)((u64)1337UL), (u32)((u64)42UL));
+	goto L__2e486;
+	L__2e488:;
+	L__2e486:;
+	return;
+}
+static void F_cvafn2(u64 __va0, ...) {
+	char A0[24] __attribute__((aligned(16)));
+	u64 t__2e496;
+	u64 t__2e497;
+	u64 t__2e501;
+	u64 t__2e502;
+	u64 t__2e503;
+	u64 t__2e504;
+	u64 t__2e505;
+	u64 t__2e511;
+	u64 t__2e512;
+	u64 t__2e517;
+	u64 t_abortsite_2e499;
+	u64 t_binding_2e493;
+	u64 t_cleanup_2e506;
+	L_start_2e489:;
+	t_binding_2e493 = (u64)A0;
+	L_body_2e490:;
+	__builtin_va_start(*(va_list *)t_binding_2e493, __va0); ((struct gpva *)t_binding_2e493)->gp -= 8; ((u64 *)((struct gpva *)t_binding_2e493)->rs)[0] = __va0;
+	t__2e497 = (u64)(u32)(__builtin_va_arg(*(va_list *)t_binding_2e493, u32));
+	t__2e496 = (u64)(u32)(((u32)t__2e497 == (u32)((u64)1337UL)));
+	if ((u32)t__2e496) goto L_passed_2e495; else goto L_failed_2e494;
+	L_failed_2e494:;
+	t_abortsite_2e499 = ((u64)0UL);
+	goto L_abort_2e500;
+	L_passed_2e495:;
+	t__2e512 = (u64)(u32)(__builtin_va_arg(*(va_list *)t_binding_2e493, u32));
+	t__2e511 = (u64)(u32)(((u32)t__2e512 == (u32)((u64)42UL)));
+	if ((u32)t__2e511) goto L_passed_2e510; else goto L_failed_2e509;
+	L_failed_2e509:;
+	t_abortsite_2e499 = ((u64)1UL);
+	goto L_abort_2e500;
+	L_passed_2e510:;
+	t_cleanup_2e506 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e507;
+	L_resume_2e513:;
+	goto L__2e491;
+	L__2e514:;
+	goto L__2e515;
+	L_defer_2e507:;
+	t__2e517 = (u64)(u32)(((u32)t_cleanup_2e506 == (u32)((u64)1UL)));
+	if ((u32)t__2e517) goto L_resume_2e513; else goto L__2e516;
+	L__2e516:;
+	goto L_resume_2e508;
+	L__2e515:;
+	L__2e491:;
+	return;
+	L_abort_2e500:;
+	t__2e501 = (u64)((u64)t_abortsite_2e499 * (u64)((u64)16UL));
+	t__2e501 = (u64)((u64)((u64)((char *)&D_abortsites_2e498)) + (u64)t__2e501);
+	t__2e502 = (u64)(*(u64 *)t__2e501);
+	t__2e503 = (u64)((u64)t__2e501 + (u64)((u64)8UL));
+	t__2e504 = (u64)(*(u32 *)t__2e503);
+	t__2e503 = (u64)((u64)t__2e501 + (u64)((u64)12UL));
+	t__2e505 = (u64)(*(u32 *)t__2e503);
+	t_cleanup_2e506 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e507;
+	L_resume_2e508:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e502, (u64)t__2e504, (u64)t__2e505, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_cvafn(u32 p_n, ...) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[4] __attribute__((aligned(16)));
+	char A5[4] __attribute__((aligned(16)));
+	char A6[4] __attribute__((aligned(16)));
+	u64 t__2e531;
+	u64 t__2e532;
+	u64 t__2e533;
+	u64 t__2e537;
+	u64 t__2e540;
+	u64 t__2e541;
+	u64 t__2e542;
+	u64 t__2e543;
+	u64 t__2e547;
+	u64 t__2e548;
+	u64 t__2e549;
+	u64 t__2e550;
+	u64 t__2e551;
+	u64 t__2e556;
+	u64 t__2e563;
+	u64 t__2e564;
+	u64 t__2e565;
+	u64 t__2e569;
+	u64 t__2e572;
+	u64 t__2e573;
+	u64 t__2e574;
+	u64 t__2e575;
+	u64 t__2e577;
+	u64 t__2e582;
+	u64 t_abortsite_2e545;
+	u64 t_binding_2e523;
+	u64 t_binding_2e524;
+	u64 t_binding_2e530;
+	u64 t_binding_2e536;
+	u64 t_binding_2e562;
+	u64 t_binding_2e568;
+	u64 t_cleanup_2e552;
+	u64 t_n;
+	u64 t_param_2e519;
+	t_n = (u64)p_n;
+	L_start_2e518:;
+	t_param_2e519 = (u64)A0;
+	t_binding_2e523 = (u64)A1;
+	t_binding_2e524 = (u64)A2;
+	t_binding_2e530 = (u64)A3;
+	t_binding_2e536 = (u64)A4;
+	t_binding_2e562 = (u64)A5;
+	t_binding_2e568 = (u64)A6;
+	*(u32 *)t_param_2e519 = (u32)t_n;
+	L_body_2e520:;
+	__builtin_va_start(*(va_list *)t_binding_2e523, p_n);
+	BLIT(t_binding_2e524, t_binding_2e523, ((u64)24UL));
+	*(u32 *)t_binding_2e530 = (u32)((u64)0UL);
+	L_loop_2e525:;
+	t__2e532 = (u64)(u32)(*(i32 *)t_binding_2e530);
+	t__2e533 = (u64)(u32)(*(i32 *)t_param_2e519);
+	t__2e531 = (u64)(u32)(((i32)t__2e532 < (i32)t__2e533));
+	if ((u32)t__2e531) goto L_body_2e526; else goto L__2e528;
+	L_body_2e526:;
+	t__2e537 = (u64)(u32)(__builtin_va_arg(*(va_list *)t_binding_2e523, u32));
+	*(u32 *)t_binding_2e536 = (u32)t__2e537;
+	t__2e541 = (u64)(u32)(*(i32 *)t_binding_2e536);
+	t__2e543 = (u64)(u32)(*(i32 *)t_binding_2e530);
+	t__2e542 = (u64)(u32)((u32)t__2e543 + (u32)((u64)1UL));
+	t__2e540 = (u64)(u32)(((u32)t__2e541 == (u32)t__2e542));
+	if ((u32)t__2e540) goto L_passed_2e539; else goto L_failed_2e538;
+	L_failed_2e538:;
+	t_abortsite_2e545 = ((u64)0UL);
+	goto L_abort_2e546;
+	L_passed_2e539:;
+	goto L__2e534;
+	L__2e555:;
+	L__2e534:;
+	L_after_2e529:;
+	t__2e556 = (u64)(u32)(*(i32 *)t_binding_2e530);
+	t__2e556 = (u64)(u32)((u32)t__2e556 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e530 = (u32)t__2e556;
+	goto L_loop_2e525;
+	L__2e528:;
+	*(u32 *)t_binding_2e562 = (u32)((u64)0UL);
+	L_loop_2e557:;
+	t__2e564 = (u64)(u32)(*(i32 *)t_binding_2e562);
+	t__2e565 = (u64)(u32)(*(i32 *)t_param_2e519);
+	t__2e563 = (u64)(u32)(((i32)t__2e564 < (i32)t__2e565));
+	if ((u32)t__2e563) goto L_body_2e558; else goto L__2e560;
+	L_body_2e558:;
+	t__2e569 = (u64)(u32)(__builtin_va_arg(*(va_list *)t_binding_2e524, u32));
+	*(u32 *)t_binding_2e568 = (u32)t__2e569;
+	t__2e573 = (u64)(u32)(*(i32 *)t_binding_2e568);
+	t__2e575 = (u64)(u32)(*(i32 *)t_binding_2e562);
+	t__2e574 = (u64)(u32)((u32)t__2e575 + (u32)((u64)1UL));
+	t__2e572 = (u64)(u32)(((u32)t__2e573 == (u32)t__2e574));
+	if ((u32)t__2e572) goto L_passed_2e571; else goto L_failed_2e570;
+	L_failed_2e570:;
+	t_abortsite_2e545 = ((u64)1UL);
+	goto L_abort_2e546;
+	L_passed_2e571:;
+	goto L__2e566;
+	L__2e576:;
+	L__2e566:;
+	L_after_2e561:;
+	t__2e577 = (u64)(u32)(*(i32 *)t_binding_2e562);
+	t__2e577 = (u64)(u32)((u32)t__2e577 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e562 = (u32)t__2e577;
+	goto L_loop_2e557;
+	L__2e560:;
+	t_cleanup_2e552 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e553;
+	L_resume_2e578:;
+	goto L__2e521;
+	L__2e579:;
+	goto L__2e580;
+	L_defer_2e553:;
+	t__2e582 = (u64)(u32)(((u32)t_cleanup_2e552 == (u32)((u64)1UL)));
+	if ((u32)t__2e582) goto L_resume_2e578; else goto L__2e581;
+	L__2e581:;
+	goto L_resume_2e554;
+	L__2e580:;
+	L__2e521:;
+	return;
+	L_abort_2e546:;
+	t__2e547 = (u64)((u64)t_abortsite_2e545 * (u64)((u64)16UL));
+	t__2e547 = (u64)((u64)((u64)((char *)&D_abortsites_2e544)) + (u64)t__2e547);
+	t__2e548 = (u64)(*(u64 *)t__2e547);
+	t__2e549 = (u64)((u64)t__2e547 + (u64)((u64)8UL));
+	t__2e550 = (u64)(*(u32 *)t__2e549);
+	t__2e549 = (u64)((u64)t__2e547 + (u64)((u64)12UL));
+	t__2e551 = (u64)(*(u32 *)t__2e549);
+	t_cleanup_2e552 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e553;
+	L_resume_2e554:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e548, (u64)t__2e550, (u64)t__2e551, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_vaargs(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[12] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[12] __attribute__((aligned(16)));
+	char A4[12] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	u64 t__2e590;
+	u64 t__2e594;
+	u64 t__2e598;
+	u64 t__2e600;
+	u64 t__2e602;
+	u64 t__2e604;
+	u64 t_binding_2e595;
+	u64 t_item_2e589;
+	u64 t_item_2e593;
+	u64 t_item_2e596;
+	u64 t_object_2e587;
+	u64 t_object_2e588;
+	u64 t_object_2e591;
+	u64 t_object_2e592;
+	u64 t_object_2e597;
+	u64 t_object_2e599;
+	u64 t_object_2e601;
+	u64 t_object_2e603;
+	L_start_2e583:;
+	t_object_2e587 = (u64)A0;
+	t_object_2e588 = (u64)A1;
+	t_object_2e591 = (u64)A2;
+	t_object_2e592 = (u64)A3;
+	t_binding_2e595 = (u64)A4;
+	t_object_2e597 = (u64)A5;
+	t_object_2e599 = (u64)A6;
+	t_object_2e601 = (u64)A7;
+	t_object_2e603 = (u64)A8;
+	L_body_2e584:;
+	t_item_2e589 = (u64)((u64)t_object_2e588 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e589 = (u32)((u64)1UL);
+	t_item_2e589 = (u64)((u64)t_object_2e588 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e589 = (u32)((u64)2UL);
+	t_item_2e589 = (u64)((u64)t_object_2e588 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e589 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e587 = (u64)t_object_2e588;
+	t__2e590 = (u64)((u64)t_object_2e587 + (u64)((u64)8UL));
+	*(u64 *)t__2e590 = (u64)((u64)3UL);
+	t__2e590 = (u64)((u64)t__2e590 + (u64)((u64)8UL));
+	*(u64 *)t__2e590 = (u64)((u64)3UL);
+	t_item_2e593 = (u64)((u64)t_object_2e592 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e593 = (u32)((u64)1UL);
+	t_item_2e593 = (u64)((u64)t_object_2e592 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e593 = (u32)((u64)2UL);
+	t_item_2e593 = (u64)((u64)t_object_2e592 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e593 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e591 = (u64)t_object_2e592;
+	t__2e594 = (u64)((u64)t_object_2e591 + (u64)((u64)8UL));
+	*(u64 *)t__2e594 = (u64)((u64)3UL);
+	t__2e594 = (u64)((u64)t__2e594 + (u64)((u64)8UL));
+	*(u64 *)t__2e594 = (u64)((u64)3UL);
+	BLIT((u64)B9, t_object_2e587, 24);
+	BLIT((u64)B10, t_object_2e591, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_vafn)))((u64)B9, (u64)B10);
+	t_item_2e596 = (u64)((u64)t_binding_2e595 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e596 = (u32)((u64)1UL);
+	t_item_2e596 = (u64)((u64)t_binding_2e595 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e596 = (u32)((u64)2UL);
+	t_item_2e596 = (u64)((u64)t_binding_2e595 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e596 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e597 = (u64)t_binding_2e595;
+	t__2e598 = (u64)((u64)t_object_2e597 + (u64)((u64)8UL));
+	*(u64 *)t__2e598 = (u64)((u64)3UL);
+	t__2e598 = (u64)((u64)t__2e598 + (u64)((u64)8UL));
+	*(u64 *)t__2e598 = (u64)((u64)3UL);
+	*(u64 *)t_object_2e599 = (u64)t_binding_2e595;
+	t__2e600 = (u64)((u64)t_object_2e599 + (u64)((u64)8UL));
+	*(u64 *)t__2e600 = (u64)((u64)3UL);
+	t__2e600 = (u64)((u64)t__2e600 + (u64)((u64)8UL));
+	*(u64 *)t__2e600 = (u64)((u64)3UL);
+	BLIT((u64)B11, t_object_2e597, 24);
+	BLIT((u64)B12, t_object_2e599, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_vafn)))((u64)B11, (u64)B12);
+	*(u64 *)t_object_2e601 = (u64)((u64)0UL);
+	t__2e602 = (u64)((u64)t_object_2e601 + (u64)((u64)8UL));
+	*(u64 *)t__2e602 = (u64)((u64)0UL);
+	t__2e602 = (u64)((u64)t__2e602 + (u64)((u64)8UL));
+	*(u64 *)t__2e602 = (u64)((u64)0UL);
+	*(u64 *)t_object_2e603 = (u64)((u64)0UL);
+	t__2e604 = (u64)((u64)t_object_2e603 + (u64)((u64)8UL));
+	*(u64 *)t__2e604 = (u64)((u64)0UL);
+	t__2e604 = (u64)((u64)t__2e604 + (u64)((u64)8UL));
+	*(u64 *)t__2e604 = (u64)((u64)0UL);
+	BLIT((u64)B13, t_object_2e601, 24);
+	BLIT((u64)B14, t_object_2e603, 24);
+	((void (*)(u64, u64))((u64)((char *)&F_vafn)))((u64)B13, (u64)B14);
+	goto L__2e585;
+	L__2e605:;
+	L__2e585:;
+	return;
+}
+static void F_vafn(u64 p_expected, u64 p_values) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e612;
+	u64 t__2e613;
+	u64 t__2e614;
+	u64 t__2e615;
+	u64 t__2e616;
+	u64 t__2e617;
+	u64 t__2e618;
+	u64 t__2e622;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e633;
+	u64 t__2e634;
+	u64 t__2e635;
+	u64 t__2e636;
+	u64 t__2e637;
+	u64 t__2e642;
+	u64 t__2e643;
+	u64 t__2e644;
+	u64 t__2e645;
+	u64 t__2e646;
+	u64 t__2e647;
+	u64 t__2e648;
+	u64 t__2e649;
+	u64 t__2e653;
+	u64 t__2e654;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t__2e657;
+	u64 t__2e658;
+	u64 t__2e659;
+	u64 t__2e660;
+	u64 t__2e661;
+	u64 t__2e662;
+	u64 t__2e663;
+	u64 t__2e664;
+	u64 t__2e666;
+	u64 t_abortsite_2e620;
+	u64 t_binding_2e632;
+	u64 t_expected;
+	u64 t_values;
+	t_expected = p_expected;
+	t_values = p_values;
+	L_start_2e606:;
+	t_binding_2e632 = (u64)A0;
+	L_body_2e607:;
+	t__2e613 = (u64)((u64)t_expected + (u64)((u64)8UL));
+	t__2e614 = (u64)((u64)t_expected + (u64)((u64)16UL));
+	t__2e615 = (u64)(*(u64 *)t__2e613);
+	t__2e616 = (u64)((u64)t_values + (u64)((u64)8UL));
+	t__2e617 = (u64)((u64)t_values + (u64)((u64)16UL));
+	t__2e618 = (u64)(*(u64 *)t__2e616);
+	t__2e612 = (u64)(u32)(((u64)t__2e615 == (u64)t__2e618));
+	if ((u32)t__2e612) goto L_passed_2e611; else goto L_failed_2e610;
+	L_failed_2e610:;
+	t_abortsite_2e620 = ((u64)0UL);
+	goto L_abort_2e621;
+	L_passed_2e611:;
+	*(u64 *)t_binding_2e632 = (u64)((u64)0UL);
+	L_loop_2e627:;
+	t__2e634 = (u64)(*(u64 *)t_binding_2e632);
+	t__2e635 = (u64)((u64)t_values + (u64)((u64)8UL));
+	t__2e636 = (u64)((u64)t_values + (u64)((u64)16UL));
+	t__2e637 = (u64)(*(u64 *)t__2e635);
+	t__2e633 = (u64)(u32)(((u64)t__2e634 < (u64)t__2e637));
+	if ((u32)t__2e633) goto L_body_2e628; else goto L__2e630;
+	L_body_2e628:;
+	t__2e644 = (u64)((u64)t_expected + (u64)((u64)8UL));
+	t__2e645 = (u64)((u64)t_expected + (u64)((u64)16UL));
+	t__2e646 = (u64)(*(u64 *)t_expected);
+	t__2e647 = (u64)(*(u64 *)t__2e644);
+	t__2e648 = (u64)(*(u64 *)t_binding_2e632);
+	t__2e643 = (u64)((u64)t__2e648 * (u64)((u64)4UL));
+	t__2e643 = (u64)((u64)t__2e646 + (u64)t__2e643);
+	t__2e649 = (u64)(u32)(((u64)t__2e648 < (u64)t__2e647));
+	if ((u32)t__2e649) goto L__2e651; else goto L__2e650;
+	L__2e650:;
+	t_abortsite_2e620 = ((u64)1UL);
+	goto L_abort_2e652;
+	L__2e651:;
+	t__2e658 = (u64)(u32)(*(i32 *)t__2e643);
+	t__2e660 = (u64)((u64)t_values + (u64)((u64)8UL));
+	t__2e661 = (u64)((u64)t_values + (u64)((u64)16UL));
+	t__2e662 = (u64)(*(u64 *)t_values);
+	t__2e663 = (u64)(*(u64 *)t_binding_2e632);
+	t__2e659 = (u64)((u64)t__2e663 * (u64)((u64)4UL));
+	t__2e659 = (u64)((u64)t__2e662 + (u64)t__2e659);
+	t__2e664 = (u64)(u32)(*(i32 *)t__2e659);
+	t__2e642 = (u64)(u32)(((u32)t__2e658 == (u32)t__2e664));
+	if ((u32)t__2e642) goto L_passed_2e641; else goto L_failed_2e640;
+	L_failed_2e640:;
+	t_abortsite_2e620 = ((u64)2UL);
+	goto L_abort_2e621;
+	L_passed_2e641:;
+	goto L__2e638;
+	L__2e665:;
+	L__2e638:;
+	L_after_2e631:;
+	t__2e666 = (u64)(*(u64 *)t_binding_2e632);
+	t__2e666 = (u64)((u64)t__2e666 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e632 = (u64)t__2e666;
+	goto L_loop_2e627;
+	L__2e630:;
+	goto L__2e608;
+	L__2e667:;
+	L__2e608:;
+	return;
+	L_abort_2e621:;
+	t__2e622 = (u64)((u64)t_abortsite_2e620 * (u64)((u64)16UL));
+	t__2e622 = (u64)((u64)((u64)((char *)&D_abortsites_2e619)) + (u64)t__2e622);
+	t__2e623 = (u64)(*(u64 *)t__2e622);
+	t__2e624 = (u64)((u64)t__2e622 + (u64)((u64)8UL));
+	t__2e625 = (u64)(*(u32 *)t__2e624);
+	t__2e624 = (u64)((u64)t__2e622 + (u64)((u64)12UL));
+	t__2e626 = (u64)(*(u32 *)t__2e624);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e623, (u64)t__2e625, (u64)t__2e626, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e652:;
+	t__2e653 = (u64)((u64)t_abortsite_2e620 * (u64)((u64)16UL));
+	t__2e653 = (u64)((u64)((u64)((char *)&D_abortsites_2e619)) + (u64)t__2e653);
+	t__2e654 = (u64)(*(u64 *)t__2e653);
+	t__2e655 = (u64)((u64)t__2e653 + (u64)((u64)8UL));
+	t__2e656 = (u64)(*(u32 *)t__2e655);
+	t__2e655 = (u64)((u64)t__2e653 + (u64)((u64)12UL));
+	t__2e657 = (u64)(*(u32 *)t__2e655);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e654, (u64)t__2e656, (u64)t__2e657, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_pointers(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e675;
+	u64 t__2e676;
+	u64 t__2e680;
+	u64 t__2e681;
+	u64 t__2e682;
+	u64 t__2e683;
+	u64 t__2e684;
+	u64 t__2e686;
+	u64 t__2e689;
+	u64 t__2e690;
+	u64 t__2e692;
+	u64 t__2e693;
+	u64 t__2e696;
+	u64 t__2e697;
+	u64 t_abortsite_2e678;
+	u64 t_binding_2e672;
+	u64 t_binding_2e685;
+	u64 t_binding_2e691;
+	L_start_2e668:;
+	t_binding_2e672 = (u64)A0;
+	t_binding_2e685 = (u64)A1;
+	t_binding_2e691 = (u64)A2;
+	L_body_2e669:;
+	*(u32 *)t_binding_2e672 = (u32)((u64)0UL);
+	((void (*)(u64))((u64)((char *)&F_addone)))((u64)t_binding_2e672);
+	t__2e676 = (u64)(u32)(*(i32 *)t_binding_2e672);
+	t__2e675 = (u64)(u32)(((u32)t__2e676 == (u32)((u64)1UL)));
+	if ((u32)t__2e675) goto L_passed_2e674; else goto L_failed_2e673;
+	L_failed_2e673:;
+	t_abortsite_2e678 = ((u64)0UL);
+	goto L_abort_2e679;
+	L_passed_2e674:;
+	*(u64 *)t_binding_2e685 = (u64)((u64)((char *)&F_addone));
+	t__2e686 = (u64)(*(u64 *)t_binding_2e685);
+	((void (*)(u64))t__2e686)((u64)t_binding_2e672);
+	t__2e690 = (u64)(u32)(*(i32 *)t_binding_2e672);
+	t__2e689 = (u64)(u32)(((u32)t__2e690 == (u32)((u64)2UL)));
+	if ((u32)t__2e689) goto L_passed_2e688; else goto L_failed_2e687;
+	L_failed_2e687:;
+	t_abortsite_2e678 = ((u64)1UL);
+	goto L_abort_2e679;
+	L_passed_2e688:;
+	*(u64 *)t_binding_2e691 = (u64)t_binding_2e685;
+	t__2e692 = (u64)(*(u64 *)t_binding_2e691);
+	t__2e693 = (u64)(*(u64 *)t__2e692);
+	((void (*)(u64))t__2e693)((u64)t_binding_2e672);
+	t__2e697 = (u64)(u32)(*(i32 *)t_binding_2e672);
+	t__2e696 = (u64)(u32)(((u32)t__2e697 == (u32)((u64)3UL)));
+	if ((u32)t__2e696) goto L_passed_2e695; else goto L_failed_2e694;
+	L_failed_2e694:;
+	t_abortsite_2e678 = ((u64)2UL);
+	goto L_abort_2e679;
+	L_passed_2e695:;
+	goto L__2e670;
+	L__2e698:;
+	L__2e670:;
+	return;
+	L_abort_2e679:;
+	t__2e680 = (u64)((u64)t_abortsite_2e678 * (u64)((u64)16UL));
+	t__2e680 = (u64)((u64)((u64)((char *)&D_abortsites_2e677)) + (u64)t__2e680);
+	t__2e681 = (u64)(*(u64 *)t__2e680);
+	t__2e682 = (u64)((u64)t__2e680 + (u64)((u64)8UL));
+	t__2e683 = (u64)(*(u32 *)t__2e682);
+	t__2e682 = (u64)((u64)t__2e680 + (u64)((u64)12UL));
+	t__2e684 = (u64)(*(u32 *)t__2e682);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e681, (u64)t__2e683, (u64)t__2e684, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_addone(u64 p_x) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e704;
+	u64 t__2e705;
+	u64 t_param_2e700;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e699:;
+	t_param_2e700 = (u64)A0;
+	*(u64 *)t_param_2e700 = (u64)t_x;
+	L_body_2e701:;
+	t__2e704 = (u64)(*(u64 *)t_param_2e700);
+	t__2e705 = (u64)(u32)(*(i32 *)t__2e704);
+	t__2e705 = (u64)(u32)((u32)t__2e705 + (u32)((u64)1UL));
+	*(u32 *)t__2e704 = (u32)t__2e705;
+	goto L__2e702;
+	L__2e706:;
+	L__2e702:;
+	return;
+}
+static void F_inlining(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[12] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char A7[4] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char B11[8] __attribute__((aligned(16)));
+	char R12[8] __attribute__((aligned(16)));
+	char B13[8] __attribute__((aligned(16)));
+	char R14[8] __attribute__((aligned(16)));
+	char B15[8] __attribute__((aligned(16)));
+	char R16[8] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	u64 t__2e715;
+	u64 t__2e718;
+	u64 t__2e721;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e726;
+	u64 t__2e730;
+	u64 t__2e731;
+	u64 t__2e732;
+	u64 t__2e733;
+	u64 t__2e734;
+	u64 t__2e737;
+	u64 t__2e740;
+	u64 t__2e742;
+	u64 t__2e743;
+	u64 t__2e745;
+	u64 t__2e748;
+	u64 t__2e749;
+	u64 t__2e750;
+	u64 t__2e752;
+	u64 t__2e755;
+	u64 t__2e756;
+	u64 t__2e757;
+	u64 t__2e760;
+	u64 t__2e761;
+	u64 t__2e764;
+	u64 t__2e765;
+	u64 t__2e766;
+	u64 t__2e772;
+	u64 t__2e773;
+	u64 t__2e775;
+	u64 t__2e776;
+	u64 t__2e777;
+	u64 t__2e778;
+	u64 t__2e779;
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e789;
+	u64 t__2e790;
+	u64 t__2e793;
+	u64 t__2e794;
+	u64 t__2e798;
+	u64 t__2e800;
+	u64 t__2e803;
+	u64 t__2e804;
+	u64 t__2e807;
+	u64 t__2e808;
+	u64 t__2e811;
+	u64 t__2e812;
+	u64 t__2e821;
+	u64 t__2e824;
+	u64 t__2e825;
+	u64 t__2e827;
+	u64 t__2e828;
+	u64 t__2e829;
+	u64 t__2e831;
+	u64 t__2e839;
+	u64 t__2e840;
+	u64 t__2e843;
+	u64 t__2e844;
+	u64 t__2e845;
+	u64 t__2e847;
+	u64 t__2e848;
+	u64 t__2e849;
+	u64 t__2e851;
+	u64 t__2e852;
+	u64 t__2e854;
+	u64 t__2e857;
+	u64 t__2e858;
+	u64 t_abortsite_2e728;
+	u64 t_binding_2e711;
+	u64 t_binding_2e714;
+	u64 t_binding_2e767;
+	u64 t_binding_2e813;
+	u64 t_binding_2e816;
+	u64 t_binding_2e832;
+	u64 t_binding_2e838;
+	u64 t_cleanup_2e780;
+	u64 t_field_2e713;
+	u64 t_field_2e722;
+	u64 t_field_2e725;
+	u64 t_field_2e741;
+	u64 t_field_2e744;
+	u64 t_field_2e751;
+	u64 t_item_2e815;
+	u64 t_item_2e818;
+	u64 t_object_2e826;
+	u64 t_object_2e830;
+	u64 t_object_2e846;
+	u64 t_object_2e850;
+	L_start_2e707:;
+	t_binding_2e711 = (u64)A0;
+	t_binding_2e714 = (u64)A1;
+	t_binding_2e767 = (u64)A2;
+	t_binding_2e813 = (u64)A3;
+	t_binding_2e816 = (u64)A4;
+	t_object_2e826 = (u64)A5;
+	t_object_2e830 = (u64)A6;
+	t_binding_2e832 = (u64)A7;
+	t_binding_2e838 = (u64)A8;
+	t_object_2e846 = (u64)A9;
+	t_object_2e850 = (u64)A10;
+	L_body_2e708:;
+	t_field_2e713 = (u64)((u64)t_binding_2e711 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e713 = (u32)((u64)1UL);
+	t_field_2e713 = (u64)((u64)t_binding_2e711 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e713 = (u32)((u64)2UL);
+	BLIT((u64)B11, t_binding_2e711, 8);
+	t__2e715 = ((u64 (*)(u64, u64))((u64)((char *)&F_swapped)))((u64)R12, (u64)B11);
+	BLIT(t_binding_2e714, t__2e715, ((u64)8UL));
+	t_field_2e722 = (u64)((u64)t_binding_2e711 + (u64)((u64)0UL));
+	t__2e723 = (u64)(u32)(*(i32 *)t_field_2e722);
+	t__2e721 = (u64)(u32)(((u32)t__2e723 == (u32)((u64)1UL)));
+	t__2e718 = (u64)(u32)t__2e721;
+	if ((u32)t__2e718) goto L__2e719; else goto L__2e720;
+	L__2e719:;
+	t_field_2e725 = (u64)((u64)t_binding_2e711 + (u64)((u64)4UL));
+	t__2e726 = (u64)(u32)(*(i32 *)t_field_2e725);
+	t__2e724 = (u64)(u32)(((u32)t__2e726 == (u32)((u64)2UL)));
+	t__2e718 = (u64)(u32)t__2e724;
+	goto L__2e720;
+	L__2e720:;
+	if ((u32)t__2e718) goto L_passed_2e717; else goto L_failed_2e716;
+	L_failed_2e716:;
+	t_abortsite_2e728 = ((u64)0UL);
+	goto L_abort_2e729;
+	L_passed_2e717:;
+	t_field_2e741 = (u64)((u64)t_binding_2e714 + (u64)((u64)0UL));
+	t__2e742 = (u64)(u32)(*(i32 *)t_field_2e741);
+	t__2e740 = (u64)(u32)(((u32)t__2e742 == (u32)((u64)2UL)));
+	t__2e737 = (u64)(u32)t__2e740;
+	if ((u32)t__2e737) goto L__2e738; else goto L__2e739;
+	L__2e738:;
+	t_field_2e744 = (u64)((u64)t_binding_2e714 + (u64)((u64)4UL));
+	t__2e745 = (u64)(u32)(*(i32 *)t_field_2e744);
+	t__2e743 = (u64)(u32)(((u32)t__2e745 == (u32)((u64)1UL)));
+	t__2e737 = (u64)(u32)t__2e743;
+	goto L__2e739;
+	L__2e739:;
+	if ((u32)t__2e737) goto L_passed_2e736; else goto L_failed_2e735;
+	L_failed_2e735:;
+	t_abortsite_2e728 = ((u64)1UL);
+	goto L_abort_2e729;
+	L_passed_2e736:;
+	BLIT((u64)B13, t_binding_2e711, 8);
+	t__2e750 = ((u64 (*)(u64, u64))((u64)((char *)&F_swapped)))((u64)R14, (u64)B13);
+	BLIT((u64)B15, t__2e750, 8);
+	t__2e749 = ((u64 (*)(u64, u64))((u64)((char *)&F_swapped)))((u64)R16, (u64)B15);
+	t_field_2e751 = (u64)((u64)t__2e749 + (u64)((u64)0UL));
+	t__2e752 = (u64)(u32)(*(i32 *)t_field_2e751);
+	t__2e748 = (u64)(u32)(((u32)t__2e752 == (u32)((u64)1UL)));
+	if ((u32)t__2e748) goto L_passed_2e747; else goto L_failed_2e746;
+	L_failed_2e746:;
+	t_abortsite_2e728 = ((u64)2UL);
+	goto L_abort_2e729;
+	L_passed_2e747:;
+	t__2e757 = (u64)(u32)(-(u32)((u64)5UL));
+	t__2e756 = (u64)(u32)(((u32 (*)(u32, u32, u32))((u64)((char *)&F_clamp)))((u32)t__2e757, (u32)((u64)0UL), (u32)((u64)10UL)));
+	t__2e755 = (u64)(u32)(((u32)t__2e756 == (u32)((u64)0UL)));
+	if ((u32)t__2e755) goto L_passed_2e754; else goto L_failed_2e753;
+	L_failed_2e753:;
+	t_abortsite_2e728 = ((u64)3UL);
+	goto L_abort_2e729;
+	L_passed_2e754:;
+	t__2e761 = (u64)(u32)(((u32 (*)(u32, u32, u32))((u64)((char *)&F_clamp)))((u32)((u64)15UL), (u32)((u64)0UL), (u32)((u64)10UL)));
+	t__2e760 = (u64)(u32)(((u32)t__2e761 == (u32)((u64)10UL)));
+	if ((u32)t__2e760) goto L_passed_2e759; else goto L_failed_2e758;
+	L_failed_2e758:;
+	t_abortsite_2e728 = ((u64)4UL);
+	goto L_abort_2e729;
+	L_passed_2e759:;
+	t__2e766 = (u64)(u32)(((u32 (*)(u32, u32, u32))((u64)((char *)&F_clamp)))((u32)((u64)7UL), (u32)((u64)0UL), (u32)((u64)5UL)));
+	t__2e765 = (u64)(u32)(((u32 (*)(u32, u32, u32))((u64)((char *)&F_clamp)))((u32)t__2e766, (u32)((u64)6UL), (u32)((u64)10UL)));
+	t__2e764 = (u64)(u32)(((u32)t__2e765 == (u32)((u64)6UL)));
+	if ((u32)t__2e764) goto L_passed_2e763; else goto L_failed_2e762;
+	L_failed_2e762:;
+	t_abortsite_2e728 = ((u64)5UL);
+	goto L_abort_2e729;
+	L_passed_2e763:;
+	*(u32 *)t_binding_2e767 = (u32)((u64)1UL);
+	t__2e773 = (u64)(u32)(((u32 (*)(u64, u32))((u64)((char *)&F_deferred)))((u64)t_binding_2e767, (u32)((u64)1UL)));
+	t__2e772 = (u64)(u32)(((u32)t__2e773 == (u32)((u64)1UL)));
+	if ((u32)t__2e772) goto L_passed_2e771; else goto L_failed_2e770;
+	L_failed_2e770:;
+	t_abortsite_2e728 = ((u64)6UL);
+	goto L_abort_2e774;
+	L_passed_2e771:;
+	t__2e786 = (u64)(u32)(*(i32 *)t_binding_2e767);
+	t__2e785 = (u64)(u32)(((u32)t__2e786 == (u32)((u64)2UL)));
+	if ((u32)t__2e785) goto L_passed_2e784; else goto L_failed_2e783;
+	L_failed_2e783:;
+	t_abortsite_2e728 = ((u64)7UL);
+	goto L_abort_2e774;
+	L_passed_2e784:;
+	t__2e790 = (u64)(u32)(((u32 (*)(u64, u32))((u64)((char *)&F_deferred)))((u64)t_binding_2e767, (u32)((u64)0UL)));
+	t__2e789 = (u64)(u32)(((u32)t__2e790 == (u32)((u64)20UL)));
+	if ((u32)t__2e789) goto L_passed_2e788; else goto L_failed_2e787;
+	L_failed_2e787:;
+	t_abortsite_2e728 = ((u64)8UL);
+	goto L_abort_2e774;
+	L_passed_2e788:;
+	t__2e794 = (u64)(u32)(*(i32 *)t_binding_2e767);
+	t__2e793 = (u64)(u32)(((u32)t__2e794 == (u32)((u64)21UL)));
+	if ((u32)t__2e793) goto L_passed_2e792; else goto L_failed_2e791;
+	L_failed_2e791:;
+	t_abortsite_2e728 = ((u64)9UL);
+	goto L_abort_2e774;
+	L_passed_2e792:;
+	t_cleanup_2e780 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e781;
+	L_resume_2e795:;
+	goto L__2e768;
+	L__2e796:;
+	goto L__2e797;
+	L_defer_2e781:;
+	t__2e798 = (u64)(u32)(*(i32 *)t_binding_2e767);
+	t__2e798 = (u64)(u32)((u32)t__2e798 + (u32)((u64)100UL));
+	*(u32 *)t_binding_2e767 = (u32)t__2e798;
+	t__2e800 = (u64)(u32)(((u32)t_cleanup_2e780 == (u32)((u64)1UL)));
+	if ((u32)t__2e800) goto L_resume_2e795; else goto L__2e799;
+	L__2e799:;
+	goto L_resume_2e782;
+	L__2e797:;
+	L__2e768:;
+	t__2e804 = (u64)(u32)(*(i32 *)t_binding_2e767);
+	t__2e803 = (u64)(u32)(((u32)t__2e804 == (u32)((u64)121UL)));
+	if ((u32)t__2e803) goto L_passed_2e802; else goto L_failed_2e801;
+	L_failed_2e801:;
+	t_abortsite_2e728 = ((u64)10UL);
+	goto L_abort_2e729;
+	L_passed_2e802:;
+	t__2e808 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_yielded)))((u32)((u64)3UL)));
+	t__2e807 = (u64)(u32)(((u32)t__2e808 == (u32)((u64)1UL)));
+	if ((u32)t__2e807) goto L_passed_2e806; else goto L_failed_2e805;
+	L_failed_2e805:;
+	t_abortsite_2e728 = ((u64)11UL);
+	goto L_abort_2e729;
+	L_passed_2e806:;
+	t__2e812 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_yielded)))((u32)((u64)20UL)));
+	t__2e811 = (u64)(u32)(((u32)t__2e812 == (u32)((u64)21UL)));
+	if ((u32)t__2e811) goto L_passed_2e810; else goto L_failed_2e809;
+	L_failed_2e809:;
+	t_abortsite_2e728 = ((u64)12UL);
+	goto L_abort_2e729;
+	L_passed_2e810:;
+	t_item_2e815 = (u64)((u64)t_binding_2e813 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e815 = (u32)((u64)1UL);
+	t_item_2e815 = (u64)((u64)t_binding_2e813 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e815 = (u32)((u64)2UL);
+	t_item_2e815 = (u64)((u64)t_binding_2e813 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e815 = (u32)((u64)3UL);
+	t_item_2e818 = (u64)((u64)t_binding_2e816 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e818 = (u32)((u64)4UL);
+	t_item_2e818 = (u64)((u64)t_binding_2e816 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e818 = (u32)((u64)5UL);
+	*(u64 *)t_object_2e826 = (u64)t_binding_2e813;
+	t__2e827 = (u64)((u64)t_object_2e826 + (u64)((u64)8UL));
+	*(u64 *)t__2e827 = (u64)((u64)3UL);
+	t__2e827 = (u64)((u64)t__2e827 + (u64)((u64)8UL));
+	*(u64 *)t__2e827 = (u64)((u64)3UL);
+	BLIT((u64)B17, t_object_2e826, 24);
+	t__2e825 = (u64)(u32)(((u32 (*)(u64, u64))((u64)((char *)&F_first)))((u64)B17, (u64)((u64)2UL)));
+	t__2e824 = (u64)(u32)(((u32)t__2e825 == (u32)((u64)3UL)));
+	t__2e821 = (u64)(u32)t__2e824;
+	if ((u32)t__2e821) goto L__2e822; else goto L__2e823;
+	L__2e822:;
+	*(u64 *)t_object_2e830 = (u64)t_binding_2e816;
+	t__2e831 = (u64)((u64)t_object_2e830 + (u64)((u64)8UL));
+	*(u64 *)t__2e831 = (u64)((u64)2UL);
+	t__2e831 = (u64)((u64)t__2e831 + (u64)((u64)8UL));
+	*(u64 *)t__2e831 = (u64)((u64)2UL);
+	BLIT((u64)B18, t_object_2e830, 24);
+	t__2e829 = (u64)(u32)(((u32 (*)(u64, u64))((u64)((char *)&F_first)))((u64)B18, (u64)((u64)1UL)));
+	t__2e828 = (u64)(u32)(((u32)t__2e829 == (u32)((u64)5UL)));
+	t__2e821 = (u64)(u32)t__2e828;
+	goto L__2e823;
+	L__2e823:;
+	if ((u32)t__2e821) goto L_passed_2e820; else goto L_failed_2e819;
+	L_failed_2e819:;
+	t_abortsite_2e728 = ((u64)13UL);
+	goto L_abort_2e729;
+	L_passed_2e820:;
+	*(u32 *)t_binding_2e832 = (u32)((u64)0UL);
+	*(u64 *)t_binding_2e838 = (u64)((u64)0UL);
+	L_loop_2e833:;
+	t__2e840 = (u64)(*(u64 *)t_binding_2e838);
+	t__2e839 = (u64)(u32)(((u64)t__2e840 < (u64)((u64)2UL)));
+	if ((u32)t__2e839) goto L_body_2e834; else goto L__2e836;
+	L_body_2e834:;
+	t__2e843 = (u64)(u32)(*(i32 *)t_binding_2e832);
+	*(u64 *)t_object_2e846 = (u64)t_binding_2e813;
+	t__2e847 = (u64)((u64)t_object_2e846 + (u64)((u64)8UL));
+	*(u64 *)t__2e847 = (u64)((u64)3UL);
+	t__2e847 = (u64)((u64)t__2e847 + (u64)((u64)8UL));
+	*(u64 *)t__2e847 = (u64)((u64)3UL);
+	t__2e848 = (u64)(*(u64 *)t_binding_2e838);
+	BLIT((u64)B19, t_object_2e846, 24);
+	t__2e845 = (u64)(u32)(((u32 (*)(u64, u64))((u64)((char *)&F_first)))((u64)B19, (u64)t__2e848));
+	*(u64 *)t_object_2e850 = (u64)t_binding_2e816;
+	t__2e851 = (u64)((u64)t_object_2e850 + (u64)((u64)8UL));
+	*(u64 *)t__2e851 = (u64)((u64)2UL);
+	t__2e851 = (u64)((u64)t__2e851 + (u64)((u64)8UL));
+	*(u64 *)t__2e851 = (u64)((u64)2UL);
+	t__2e852 = (u64)(*(u64 *)t_binding_2e838);
+	BLIT((u64)B20, t_object_2e850, 24);
+	t__2e849 = (u64)(u32)(((u32 (*)(u64, u64))((u64)((char *)&F_first)))((u64)B20, (u64)t__2e852));
+	t__2e844 = (u64)(u32)((u32)t__2e845 + (u32)t__2e849);
+	t__2e843 = (u64)(u32)((u32)t__2e843 + (u32)t__2e844);
+	*(u32 *)t_binding_2e832 = (u32)t__2e843;
+	goto L__2e841;
+	L__2e853:;
+	L__2e841:;
+	L_after_2e837:;
+	t__2e854 = (u64)(*(u64 *)t_binding_2e838);
+	t__2e854 = (u64)((u64)t__2e854 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e838 = (u64)t__2e854;
+	goto L_loop_2e833;
+	L__2e836:;
+	t__2e858 = (u64)(u32)(*(i32 *)t_binding_2e832);
+	t__2e857 = (u64)(u32)(((u32)t__2e858 == (u32)((u64)12UL)));
+	if ((u32)t__2e857) goto L_passed_2e856; else goto L_failed_2e855;
+	L_failed_2e855:;
+	t_abortsite_2e728 = ((u64)14UL);
+	goto L_abort_2e729;
+	L_passed_2e856:;
+	goto L__2e709;
+	L__2e859:;
+	L__2e709:;
+	return;
+	L_abort_2e729:;
+	t__2e730 = (u64)((u64)t_abortsite_2e728 * (u64)((u64)16UL));
+	t__2e730 = (u64)((u64)((u64)((char *)&D_abortsites_2e727)) + (u64)t__2e730);
+	t__2e731 = (u64)(*(u64 *)t__2e730);
+	t__2e732 = (u64)((u64)t__2e730 + (u64)((u64)8UL));
+	t__2e733 = (u64)(*(u32 *)t__2e732);
+	t__2e732 = (u64)((u64)t__2e730 + (u64)((u64)12UL));
+	t__2e734 = (u64)(*(u32 *)t__2e732);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e731, (u64)t__2e733, (u64)t__2e734, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e774:;
+	t__2e775 = (u64)((u64)t_abortsite_2e728 * (u64)((u64)16UL));
+	t__2e775 = (u64)((u64)((u64)((char *)&D_abortsites_2e727)) + (u64)t__2e775);
+	t__2e776 = (u64)(*(u64 *)t__2e775);
+	t__2e777 = (u64)((u64)t__2e775 + (u64)((u64)8UL));
+	t__2e778 = (u64)(*(u32 *)t__2e777);
+	t__2e777 = (u64)((u64)t__2e775 + (u64)((u64)12UL));
+	t__2e779 = (u64)(*(u32 *)t__2e777);
+	t_cleanup_2e780 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e781;
+	L_resume_2e782:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e776, (u64)t__2e778, (u64)t__2e779, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_first(u64 p_s, u64 p_i) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e863;
+	u64 t__2e864;
+	u64 t__2e865;
+	u64 t__2e866;
+	u64 t__2e867;
+	u64 t__2e868;
+	u64 t__2e869;
+	u64 t__2e875;
+	u64 t__2e876;
+	u64 t__2e877;
+	u64 t__2e878;
+	u64 t__2e879;
+	u64 t__2e880;
+	u64 t_abortsite_2e873;
+	u64 t_i;
+	u64 t_param_2e861;
+	u64 t_s;
+	t_s = p_s;
+	t_i = (u64)p_i;
+	L_start_2e860:;
+	t_param_2e861 = (u64)A0;
+	*(u64 *)t_param_2e861 = (u64)t_i;
+	L_body_2e862:;
+	t__2e864 = (u64)((u64)t_s + (u64)((u64)8UL));
+	t__2e865 = (u64)((u64)t_s + (u64)((u64)16UL));
+	t__2e866 = (u64)(*(u64 *)t_s);
+	t__2e867 = (u64)(*(u64 *)t__2e864);
+	t__2e868 = (u64)(*(u64 *)t_param_2e861);
+	t__2e863 = (u64)((u64)t__2e868 * (u64)((u64)4UL));
+	t__2e863 = (u64)((u64)t__2e866 + (u64)t__2e863);
+	t__2e869 = (u64)(u32)(((u64)t__2e868 < (u64)t__2e867));
+	if ((u32)t__2e869) goto L__2e871; else goto L__2e870;
+	L__2e870:;
+	t_abortsite_2e873 = ((u64)0UL);
+	goto L_abort_2e874;
+	L__2e871:;
+	t__2e880 = (u64)(u32)(*(i32 *)t__2e863);
+	return (u32)t__2e880;
+	L_abort_2e874:;
+	t__2e875 = (u64)((u64)t_abortsite_2e873 * (u64)((u64)16UL));
+	t__2e875 = (u64)((u64)((u64)((char *)&D_abortsites_2e872)) + (u64)t__2e875);
+	t__2e876 = (u64)(*(u64 *)t__2e875);
+	t__2e877 = (u64)((u64)t__2e875 + (u64)((u64)8UL));
+	t__2e878 = (u64)(*(u32 *)t__2e877);
+	t__2e877 = (u64)((u64)t__2e875 + (u64)((u64)12UL));
+	t__2e879 = (u64)(*(u32 *)t__2e877);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e876, (u64)t__2e878, (u64)t__2e879, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static u32 F_yielded(u32 p_x) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e888;
+	u64 t__2e893;
+	u64 t__2e894;
+	u64 t__2e895;
+	u64 t__2e898;
+	u64 t__2e902;
+	u64 t__2e903;
+	u64 t_binding_2e886;
+	u64 t_param_2e882;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e881:;
+	t_param_2e882 = (u64)A0;
+	t_binding_2e886 = (u64)A1;
+	*(u32 *)t_param_2e882 = (u32)t_x;
+	L_body_2e883:;
+	t__2e894 = (u64)(u32)(*(i32 *)t_param_2e882);
+	t__2e893 = (u64)(u32)(((i32)t__2e894 > (i32)((u64)5UL)));
+	t__2e895 = (u64)(u32)((u8)t__2e893);
+	if ((u32)t__2e895) goto L_true_2e890; else goto L_false_2e891;
+	L_true_2e890:;
+	t__2e898 = (u64)(u32)(*(i32 *)t_param_2e882);
+	t__2e888 = (u64)(u32)t__2e898;
+	goto L__2e887;
+	L__2e899:;
+	L__2e896:;
+	L__2e900:;
+	L_false_2e891:;
+	L__2e892:;
+	t__2e888 = (u64)(u32)((u64)0UL);
+	goto L__2e887;
+	L__2e901:;
+	L__2e887:;
+	*(u32 *)t_binding_2e886 = (u32)t__2e888;
+	t__2e903 = (u64)(u32)(*(i32 *)t_binding_2e886);
+	t__2e902 = (u64)(u32)((u32)t__2e903 + (u32)((u64)1UL));
+	return (u32)t__2e902;
+	L__2e904:;
+	L__2e884:;
+	L__2e905:;
+	return 0;
+}
+static u32 F_deferred(u64 p_x, u32 p_early) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	u64 t__2e916;
+	u64 t__2e917;
+	u64 t__2e920;
+	u64 t__2e921;
+	u64 t__2e927;
+	u64 t__2e928;
+	u64 t__2e929;
+	u64 t__2e930;
+	u64 t__2e934;
+	u64 t__2e935;
+	u64 t__2e937;
+	u64 t_cleanup_2e922;
+	u64 t_early;
+	u64 t_param_2e907;
+	u64 t_param_2e908;
+	u64 t_x;
+	t_x = (u64)p_x;
+	t_early = (u64)p_early;
+	L_start_2e906:;
+	t_param_2e907 = (u64)A0;
+	t_param_2e908 = (u64)A1;
+	*(u64 *)t_param_2e907 = (u64)t_x;
+	*(u8 *)t_param_2e908 = (u8)t_early;
+	L_body_2e909:;
+	t__2e916 = (u64)(u32)(*(u8 *)t_param_2e908);
+	t__2e917 = (u64)(u32)((u8)t__2e916);
+	if ((u32)t__2e917) goto L_true_2e913; else goto L_false_2e914;
+	L_true_2e913:;
+	t__2e920 = (u64)(*(u64 *)t_param_2e907);
+	t__2e921 = (u64)(u32)(*(i32 *)t__2e920);
+	t_cleanup_2e922 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e923;
+	L_resume_2e924:;
+	return (u32)t__2e921;
+	L__2e925:;
+	L__2e918:;
+	L__2e926:;
+	L_false_2e914:;
+	L__2e915:;
+	t__2e927 = (u64)(*(u64 *)t_param_2e907);
+	t__2e928 = (u64)(u32)(*(i32 *)t__2e927);
+	t__2e928 = (u64)(u32)((u32)t__2e928 * (u32)((u64)10UL));
+	*(u32 *)t__2e927 = (u32)t__2e928;
+	t__2e929 = (u64)(*(u64 *)t_param_2e907);
+	t__2e930 = (u64)(u32)(*(i32 *)t__2e929);
+	t_cleanup_2e922 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e923;
+	L_resume_2e931:;
+	return (u32)t__2e930;
+	L__2e932:;
+	goto L__2e933;
+	L_defer_2e923:;
+	t__2e934 = (u64)(*(u64 *)t_param_2e907);
+	t__2e935 = (u64)(u32)(*(i32 *)t__2e934);
+	t__2e935 = (u64)(u32)((u32)t__2e935 + (u32)((u64)1UL));
+	*(u32 *)t__2e934 = (u32)t__2e935;
+	t__2e937 = (u64)(u32)(((u32)t_cleanup_2e922 == (u32)((u64)1UL)));
+	if ((u32)t__2e937) goto L_resume_2e931; else goto L__2e936;
+	L__2e936:;
+	goto L_resume_2e924;
+	L__2e933:;
+	L__2e910:;
+	L__2e938:;
+	return 0;
+}
+static u32 F_clamp(u32 p_x, u32 p_lo, u32 p_hi) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	u64 t__2e950;
+	u64 t__2e951;
+	u64 t__2e952;
+	u64 t__2e953;
+	u64 t__2e956;
+	u64 t__2e963;
+	u64 t__2e964;
+	u64 t__2e965;
+	u64 t__2e966;
+	u64 t__2e969;
+	u64 t__2e972;
+	u64 t_hi;
+	u64 t_lo;
+	u64 t_param_2e940;
+	u64 t_param_2e941;
+	u64 t_param_2e942;
+	u64 t_x;
+	t_x = (u64)p_x;
+	t_lo = (u64)p_lo;
+	t_hi = (u64)p_hi;
+	L_start_2e939:;
+	t_param_2e940 = (u64)A0;
+	t_param_2e941 = (u64)A1;
+	t_param_2e942 = (u64)A2;
+	*(u32 *)t_param_2e940 = (u32)t_x;
+	*(u32 *)t_param_2e941 = (u32)t_lo;
+	*(u32 *)t_param_2e942 = (u32)t_hi;
+	L_body_2e943:;
+	t__2e951 = (u64)(u32)(*(i32 *)t_param_2e940);
+	t__2e952 = (u64)(u32)(*(i32 *)t_param_2e941);
+	t__2e950 = (u64)(u32)(((i32)t__2e951 < (i32)t__2e952));
+	t__2e953 = (u64)(u32)((u8)t__2e950);
+	if ((u32)t__2e953) goto L_true_2e947; else goto L_false_2e948;
+	L_true_2e947:;
+	t__2e956 = (u64)(u32)(*(i32 *)t_param_2e941);
+	return (u32)t__2e956;
+	L__2e957:;
+	L__2e954:;
+	L__2e958:;
+	L_false_2e948:;
+	L__2e949:;
+	t__2e964 = (u64)(u32)(*(i32 *)t_param_2e940);
+	t__2e965 = (u64)(u32)(*(i32 *)t_param_2e942);
+	t__2e963 = (u64)(u32)(((i32)t__2e964 > (i32)t__2e965));
+	t__2e966 = (u64)(u32)((u8)t__2e963);
+	if ((u32)t__2e966) goto L_true_2e960; else goto L_false_2e961;
+	L_true_2e960:;
+	t__2e969 = (u64)(u32)(*(i32 *)t_param_2e942);
+	return (u32)t__2e969;
+	L__2e970:;
+	L__2e967:;
+	L__2e971:;
+	L_false_2e961:;
+	L__2e962:;
+	t__2e972 = (u64)(u32)(*(i32 *)t_param_2e940);
+	return (u32)t__2e972;
+	L__2e973:;
+	L__2e944:;
+	L__2e974:;
+	return 0;
+}
+static u64 F_swapped(u64 __rp, u64 p_p) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e981;
+	u64 t__2e984;
+	u64 t__2e986;
+	u64 t_binding_2e979;
+	u64 t_field_2e980;
+	u64 t_field_2e982;
+	u64 t_field_2e983;
+	u64 t_field_2e985;
+	u64 t_p;
+	t_p = p_p;
+	L_start_2e975:;
+	t_binding_2e979 = (u64)A0;
+	L_body_2e976:;
+	t_field_2e980 = (u64)((u64)t_p + (u64)((u64)0UL));
+	t__2e981 = (u64)(u32)(*(i32 *)t_field_2e980);
+	*(u32 *)t_binding_2e979 = (u32)t__2e981;
+	t_field_2e982 = (u64)((u64)t_p + (u64)((u64)0UL));
+	t_field_2e983 = (u64)((u64)t_p + (u64)((u64)4UL));
+	t__2e984 = (u64)(u32)(*(i32 *)t_field_2e983);
+	*(u32 *)t_field_2e982 = (u32)t__2e984;
+	t_field_2e985 = (u64)((u64)t_p + (u64)((u64)4UL));
+	t__2e986 = (u64)(u32)(*(i32 *)t_binding_2e979);
+	*(u32 *)t_field_2e985 = (u32)t__2e986;
+	BLIT(__rp, t_p, 8); return __rp;
+	L__2e987:;
+	L__2e977:;
+	L__2e988:;
+	return 0;
+}
+static u32 F_simple(void) {
+	L_start_2e989:;
+	L_body_2e990:;
+	return (u32)((u64)69UL);
+	L__2e991:;
+	return 0;
+}
@@ -0,0 +1,4722 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e19 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e20 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e55 { u8 f0[28]; };
+struct __attribute__((packed)) S_strliteral_2e56 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e75 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e76 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e95 { u8 f0[28]; };
+struct __attribute__((packed)) S_strliteral_2e96 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e36 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; };
+struct __attribute__((packed)) S_abortsites_2e161 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; };
+struct __attribute__((packed)) S_abortsites_2e478 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; };
+struct __attribute__((packed)) S_abortsites_2e684 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; };
+struct __attribute__((packed)) S_abortsites_2e910 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; };
+struct __attribute__((packed)) S_abortsites_2e1291 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; };
+struct __attribute__((packed)) S_b { u8 f0; };
+struct __attribute__((packed)) S_a { u8 f0; };
+struct __attribute__((packed)) S_abortsites_2e1351 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; };
+struct __attribute__((packed)) S_abortsites_2e1395 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; char *f81; u32 f82; u32 f83; char *f84; u32 f85; u32 f86; char *f87; u32 f88; u32 f89; char *f90; u32 f91; u32 f92; char *f93; u32 f94; u32 f95; char *f96; u32 f97; u32 f98; char *f99; u32 f100; u32 f101; char *f102; u32 f103; u32 f104; };
+struct __attribute__((packed)) S_abortsites_2e1681 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; };
+struct __attribute__((packed)) S_abortsites_2e1744 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; char *f81; u32 f82; u32 f83; char *f84; u32 f85; u32 f86; char *f87; u32 f88; u32 f89; char *f90; u32 f91; u32 f92; };
+struct __attribute__((packed)) S_abortsites_2e1998 { char *f0; u32 f1; u32 f2; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e19 D_strdata_2e19 __asm__("strdata.19") __attribute__((used, section(".rodata.strdata.19"), aligned(8)));
+static struct S_strliteral_2e20 D_strliteral_2e20 __asm__("strliteral.20") __attribute__((used, section(".data.rel.ro.strliteral.20"), aligned(8)));
+static const struct S_strdata_2e55 D_strdata_2e55 __asm__("strdata.55") __attribute__((used, section(".rodata.strdata.55"), aligned(8)));
+static struct S_strliteral_2e56 D_strliteral_2e56 __asm__("strliteral.56") __attribute__((used, section(".data.rel.ro.strliteral.56"), aligned(8)));
+static const struct S_strdata_2e75 D_strdata_2e75 __asm__("strdata.75") __attribute__((used, section(".rodata.strdata.75"), aligned(8)));
+static struct S_strliteral_2e76 D_strliteral_2e76 __asm__("strliteral.76") __attribute__((used, section(".data.rel.ro.strliteral.76"), aligned(8)));
+static const struct S_strdata_2e95 D_strdata_2e95 __asm__("strdata.95") __attribute__((used, section(".rodata.strdata.95"), aligned(8)));
+static struct S_strliteral_2e96 D_strliteral_2e96 __asm__("strliteral.96") __attribute__((used, section(".data.rel.ro.strliteral.96"), aligned(8)));
+static struct S_abortsites_2e36 D_abortsites_2e36 __asm__("abortsites.36") __attribute__((used, section(".data.rel.ro.abortsites.36"), aligned(8)));
+static struct S_abortsites_2e161 D_abortsites_2e161 __asm__("abortsites.161") __attribute__((used, section(".data.rel.ro.abortsites.161"), aligned(8)));
+static struct S_abortsites_2e478 D_abortsites_2e478 __asm__("abortsites.478") __attribute__((used, section(".data.rel.ro.abortsites.478"), aligned(8)));
+static struct S_abortsites_2e684 D_abortsites_2e684 __asm__("abortsites.684") __attribute__((used, section(".data.rel.ro.abortsites.684"), aligned(8)));
+static struct S_abortsites_2e910 D_abortsites_2e910 __asm__("abortsites.910") __attribute__((used, section(".data.rel.ro.abortsites.910"), aligned(8)));
+static struct S_abortsites_2e1291 D_abortsites_2e1291 __asm__("abortsites.1291") __attribute__((used, section(".data.rel.ro.abortsites.1291"), aligned(8)));
+static struct S_b D_b __asm__("b") __attribute__((used, section(".data.b"), aligned(8)));
+static struct S_a D_a __asm__("a") __attribute__((used, section(".data.a"), aligned(8)));
+static struct S_abortsites_2e1351 D_abortsites_2e1351 __asm__("abortsites.1351") __attribute__((used, section(".data.rel.ro.abortsites.1351"), aligned(8)));
+static struct S_abortsites_2e1395 D_abortsites_2e1395 __asm__("abortsites.1395") __attribute__((used, section(".data.rel.ro.abortsites.1395"), aligned(8)));
+static struct S_abortsites_2e1681 D_abortsites_2e1681 __asm__("abortsites.1681") __attribute__((used, section(".data.rel.ro.abortsites.1681"), aligned(8)));
+static struct S_abortsites_2e1744 D_abortsites_2e1744 __asm__("abortsites.1744") __attribute__((used, section(".data.rel.ro.abortsites.1744"), aligned(8)));
+static struct S_abortsites_2e1998 D_abortsites_2e1998 __asm__("abortsites.1998") __attribute__((used, section(".data.rel.ro.abortsites.1998"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_constdiv(void) __asm__("constdiv") __attribute__((used, section(".text.constdiv")));
+static void F_check64(u64 p_x, u64 p_u) __asm__("check64") __attribute__((used, section(".text.check64")));
+static u64 F_urem64(u64 p_x, u64 p_y) __asm__("urem64") __attribute__((used, section(".text.urem64")));
+static u64 F_udiv64(u64 p_x, u64 p_y) __asm__("udiv64") __attribute__((used, section(".text.udiv64")));
+static u64 F_rem64(u64 p_x, u64 p_y) __asm__("rem64") __attribute__((used, section(".text.rem64")));
+static u64 F_div64(u64 p_x, u64 p_y) __asm__("div64") __attribute__((used, section(".text.div64")));
+static void F_checku32(u32 p_x) __asm__("checku32") __attribute__((used, section(".text.checku32")));
+static u32 F_urem32(u32 p_x, u32 p_y) __asm__("urem32") __attribute__((used, section(".text.urem32")));
+static u32 F_udiv32(u32 p_x, u32 p_y) __asm__("udiv32") __attribute__((used, section(".text.udiv32")));
+static void F_check32(u32 p_x) __asm__("check32") __attribute__((used, section(".text.check32")));
+static u32 F_rem32(u32 p_x, u32 p_y) __asm__("rem32") __attribute__((used, section(".text.rem32")));
+static u32 F_div32(u32 p_x, u32 p_y) __asm__("div32") __attribute__((used, section(".text.div32")));
+static u32 F_urem8(u32 p_x, u32 p_y) __asm__("urem8") __attribute__((used, section(".text.urem8")));
+static u32 F_udiv8(u32 p_x, u32 p_y) __asm__("udiv8") __attribute__((used, section(".text.udiv8")));
+static u32 F_rem8(u32 p_x, u32 p_y) __asm__("rem8") __attribute__((used, section(".text.rem8")));
+static u32 F_div8(u32 p_x, u32 p_y) __asm__("div8") __attribute__((used, section(".text.div8")));
+static void F_eval(void) __asm__("eval") __attribute__((used, section(".text.eval")));
+static void F_comparison(void) __asm__("comparison") __attribute__((used, section(".text.comparison")));
+static void F_arithmetic(void) __asm__("arithmetic") __attribute__((used, section(".text.arithmetic")));
+static void F_sar__shr(void) __asm__("sar_shr") __attribute__((used, section(".text.sar_shr")));
+static void F_andorxor(void) __asm__("andorxor") __attribute__((used, section(".text.andorxor")));
+static u32 F_set(u64 p_x) __asm__("set") __attribute__((used, section(".text.set")));
+static u32 F_error(void) __asm__("error") __attribute__((used, section(".text.error")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\061\060\055\142\151\156\141\162\151\164\150\155\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 22U, 22U };
+static const struct S_strdata_2e19 D_strdata_2e19 = { "\154\145\164\040\170\040\075\040\061\040\057\040\060\073" };
+static struct S_strliteral_2e20 D_strliteral_2e20 = { (char *)((char *)&D_strdata_2e19) + 0, 14U, 14U };
+static const struct S_strdata_2e55 D_strdata_2e55 = { "\154\145\164\040\170\040\075\040\055\062\061\064\067\064\070\063\066\064\070\151\063\062\040\057\040\055\061\073" };
+static struct S_strliteral_2e56 D_strliteral_2e56 = { (char *)((char *)&D_strdata_2e55) + 0, 28U, 28U };
+static const struct S_strdata_2e75 D_strdata_2e75 = { "\154\145\164\040\170\040\075\040\061\040\045\040\060\073" };
+static struct S_strliteral_2e76 D_strliteral_2e76 = { (char *)((char *)&D_strdata_2e75) + 0, 14U, 14U };
+static const struct S_strdata_2e95 D_strdata_2e95 = { "\154\145\164\040\170\040\075\040\055\062\061\064\067\064\070\063\066\064\070\151\063\062\040\045\040\055\061\073" };
+static struct S_strliteral_2e96 D_strliteral_2e96 = { (char *)((char *)&D_strdata_2e95) + 0, 28U, 28U };
+static struct S_abortsites_2e36 D_abortsites_2e36 = { (char *)((char *)&D_strliteral_2e1) + 0, 345U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 345U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 346U, 64U, (char *)((char *)&D_strliteral_2e1) + 0, 346U, 64U, (char *)((char *)&D_strliteral_2e1) + 0, 347U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 347U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 348U, 64U, (char *)((char *)&D_strliteral_2e1) + 0, 348U, 64U };
+static struct S_abortsites_2e161 D_abortsites_2e161 = { (char *)((char *)&D_strliteral_2e1) + 0, 310U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 311U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 312U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 313U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 314U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 316U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 317U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 318U, 23U };
+static struct S_abortsites_2e478 D_abortsites_2e478 = { (char *)((char *)&D_strliteral_2e1) + 0, 293U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 294U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 295U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 296U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 297U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 298U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 299U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 300U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 301U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 302U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 303U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 304U, 15U };
+static struct S_abortsites_2e684 D_abortsites_2e684 = { (char *)((char *)&D_strliteral_2e1) + 0, 274U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 275U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 276U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 277U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 278U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 279U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 280U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 281U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 282U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 283U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 284U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 285U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 289U, 15U };
+static struct S_abortsites_2e910 D_abortsites_2e910 = { (char *)((char *)&D_strliteral_2e1) + 0, 247U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 248U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 249U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 250U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 251U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 252U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 253U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 254U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 255U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 256U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 257U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 258U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 259U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 260U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 261U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 262U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 263U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 267U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 270U, 15U };
+static struct S_abortsites_2e1291 D_abortsites_2e1291 = { (char *)((char *)&D_strliteral_2e1) + 0, 214U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 215U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 216U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 217U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 218U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 219U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 220U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 221U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 222U, 15U };
+static struct S_b D_b = { 131U };
+static struct S_a D_a = { 131U };
+static struct S_abortsites_2e1351 D_abortsites_2e1351 = { (char *)((char *)&D_strliteral_2e1) + 0, 184U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 185U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 186U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 187U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 188U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 189U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 190U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 191U, 15U };
+static struct S_abortsites_2e1395 D_abortsites_2e1395 = { (char *)((char *)&D_strliteral_2e1) + 0, 110U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 111U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 113U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 114U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 115U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 117U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 118U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 119U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 120U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 121U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 123U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 124U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 125U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 126U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 127U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 128U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 129U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 130U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 131U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 132U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 133U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 135U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 136U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 137U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 138U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 139U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 140U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 141U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 142U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 144U, 15U };
+static struct S_abortsites_2e1681 D_abortsites_2e1681 = { (char *)((char *)&D_strliteral_2e1) + 0, 88U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 92U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 98U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 15U };
+static struct S_abortsites_2e1744 D_abortsites_2e1744 = { (char *)((char *)&D_strliteral_2e1) + 0, 14U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 15U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 16U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 17U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 18U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 20U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 21U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 33U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 34U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 38U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 40U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 41U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 42U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 43U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 44U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 46U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 58U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 61U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 64U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 66U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 67U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 68U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 69U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 78U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 80U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 82U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 84U, 15U };
+static struct S_abortsites_2e1998 D_abortsites_2e1998 = { (char *)((char *)&D_strliteral_2e1) + 0, 5U, 14U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_andorxor)))();
+	((void (*)(void))((u64)((char *)&F_sar__shr)))();
+	((void (*)(void))((u64)((char *)&F_arithmetic)))();
+	((void (*)(void))((u64)((char *)&F_comparison)))();
+	((void (*)(void))((u64)((char *)&F_eval)))();
+	((void (*)(void))((u64)((char *)&F_constdiv)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_reject(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char B8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[4] __attribute__((aligned(16)));
+	char B12[8] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char R15[4] __attribute__((aligned(16)));
+	char B16[8] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char R19[4] __attribute__((aligned(16)));
+	char B20[8] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char R23[4] __attribute__((aligned(16)));
+	u64 t__2e107;
+	u64 t__2e109;
+	u64 t__2e12;
+	u64 t__2e18;
+	u64 t__2e24;
+	u64 t__2e33;
+	u64 t__2e35;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e46;
+	u64 t__2e47;
+	u64 t__2e48;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e52;
+	u64 t__2e54;
+	u64 t__2e58;
+	u64 t__2e67;
+	u64 t__2e69;
+	u64 t__2e72;
+	u64 t__2e74;
+	u64 t__2e78;
+	u64 t__2e87;
+	u64 t__2e89;
+	u64 t__2e92;
+	u64 t__2e94;
+	u64 t__2e98;
+	u64 t_abortsite_2e37;
+	u64 t_object_2e14;
+	u64 t_object_2e22;
+	u64 t_object_2e53;
+	u64 t_object_2e57;
+	u64 t_object_2e73;
+	u64 t_object_2e77;
+	u64 t_object_2e93;
+	u64 t_object_2e97;
+	u64 t_tag_2e25;
+	u64 t_tag_2e59;
+	u64 t_tag_2e79;
+	u64 t_tag_2e99;
+	L_start_2e7:;
+	t_object_2e14 = (u64)A0;
+	t_object_2e22 = (u64)A1;
+	t_object_2e53 = (u64)A2;
+	t_object_2e57 = (u64)A3;
+	t_object_2e73 = (u64)A4;
+	t_object_2e77 = (u64)A5;
+	t_object_2e93 = (u64)A6;
+	t_object_2e97 = (u64)A7;
+	L_body_2e8:;
+	*(u32 *)t_object_2e14 = (u32)((u64)3532310079UL);
+	t__2e18 = (u64)((u64)t_object_2e14 + (u64)((u64)4UL));
+	*(u32 *)t__2e18 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e22 = (u64)((u64)0UL);
+	t__2e24 = (u64)((u64)t_object_2e22 + (u64)((u64)8UL));
+	*(u64 *)t__2e24 = (u64)((u64)0UL);
+	t__2e24 = (u64)((u64)t__2e24 + (u64)((u64)8UL));
+	*(u64 *)t__2e24 = (u64)((u64)0UL);
+	BLIT((u64)B8, t_object_2e14, 8);
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e20)), 24);
+	BLIT((u64)B10, t_object_2e22, 24);
+	t__2e12 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R11, (u64)B8, (u64)B9, (u64)B10);
+	t_tag_2e25 = (u64)(*(u32 *)t__2e12);
+	t__2e33 = (u64)(u32)(((u32)t_tag_2e25 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e33) goto L_member_2e30; else goto L__2e32;
+	L__2e32:;
+	t__2e35 = (u64)(u32)(((u32)t_tag_2e25 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e35) goto L_member_2e31; else goto L__2e34;
+	L__2e34:;
+	goto L_matches_2e29;
+	L_member_2e30:;
+	goto L_matches_2e29;
+	L_member_2e31:;
+	goto L_matches_2e28;
+	L_matches_2e28:;
+	goto L__2e26;
+	L_matches_2e29:;
+	t_abortsite_2e37 = ((u64)0UL);
+	goto L_abort_2e38;
+	L__2e44:;
+	L__2e27:;
+	t_abortsite_2e37 = ((u64)1UL);
+	goto L_abort_2e45;
+	L__2e26:;
+	*(u32 *)t_object_2e53 = (u32)((u64)3532310079UL);
+	t__2e54 = (u64)((u64)t_object_2e53 + (u64)((u64)4UL));
+	*(u32 *)t__2e54 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e57 = (u64)((u64)0UL);
+	t__2e58 = (u64)((u64)t_object_2e57 + (u64)((u64)8UL));
+	*(u64 *)t__2e58 = (u64)((u64)0UL);
+	t__2e58 = (u64)((u64)t__2e58 + (u64)((u64)8UL));
+	*(u64 *)t__2e58 = (u64)((u64)0UL);
+	BLIT((u64)B12, t_object_2e53, 8);
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e56)), 24);
+	BLIT((u64)B14, t_object_2e57, 24);
+	t__2e52 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R15, (u64)B12, (u64)B13, (u64)B14);
+	t_tag_2e59 = (u64)(*(u32 *)t__2e52);
+	t__2e67 = (u64)(u32)(((u32)t_tag_2e59 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e67) goto L_member_2e64; else goto L__2e66;
+	L__2e66:;
+	t__2e69 = (u64)(u32)(((u32)t_tag_2e59 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e69) goto L_member_2e65; else goto L__2e68;
+	L__2e68:;
+	goto L_matches_2e63;
+	L_member_2e64:;
+	goto L_matches_2e63;
+	L_member_2e65:;
+	goto L_matches_2e62;
+	L_matches_2e62:;
+	goto L__2e60;
+	L_matches_2e63:;
+	t_abortsite_2e37 = ((u64)2UL);
+	goto L_abort_2e38;
+	L__2e70:;
+	L__2e61:;
+	t_abortsite_2e37 = ((u64)3UL);
+	goto L_abort_2e45;
+	L__2e60:;
+	*(u32 *)t_object_2e73 = (u32)((u64)3532310079UL);
+	t__2e74 = (u64)((u64)t_object_2e73 + (u64)((u64)4UL));
+	*(u32 *)t__2e74 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e77 = (u64)((u64)0UL);
+	t__2e78 = (u64)((u64)t_object_2e77 + (u64)((u64)8UL));
+	*(u64 *)t__2e78 = (u64)((u64)0UL);
+	t__2e78 = (u64)((u64)t__2e78 + (u64)((u64)8UL));
+	*(u64 *)t__2e78 = (u64)((u64)0UL);
+	BLIT((u64)B16, t_object_2e73, 8);
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e76)), 24);
+	BLIT((u64)B18, t_object_2e77, 24);
+	t__2e72 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R19, (u64)B16, (u64)B17, (u64)B18);
+	t_tag_2e79 = (u64)(*(u32 *)t__2e72);
+	t__2e87 = (u64)(u32)(((u32)t_tag_2e79 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e87) goto L_member_2e84; else goto L__2e86;
+	L__2e86:;
+	t__2e89 = (u64)(u32)(((u32)t_tag_2e79 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e89) goto L_member_2e85; else goto L__2e88;
+	L__2e88:;
+	goto L_matches_2e83;
+	L_member_2e84:;
+	goto L_matches_2e83;
+	L_member_2e85:;
+	goto L_matches_2e82;
+	L_matches_2e82:;
+	goto L__2e80;
+	L_matches_2e83:;
+	t_abortsite_2e37 = ((u64)4UL);
+	goto L_abort_2e38;
+	L__2e90:;
+	L__2e81:;
+	t_abortsite_2e37 = ((u64)5UL);
+	goto L_abort_2e45;
+	L__2e80:;
+	*(u32 *)t_object_2e93 = (u32)((u64)3532310079UL);
+	t__2e94 = (u64)((u64)t_object_2e93 + (u64)((u64)4UL));
+	*(u32 *)t__2e94 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e97 = (u64)((u64)0UL);
+	t__2e98 = (u64)((u64)t_object_2e97 + (u64)((u64)8UL));
+	*(u64 *)t__2e98 = (u64)((u64)0UL);
+	t__2e98 = (u64)((u64)t__2e98 + (u64)((u64)8UL));
+	*(u64 *)t__2e98 = (u64)((u64)0UL);
+	BLIT((u64)B20, t_object_2e93, 8);
+	BLIT((u64)B21, ((u64)((char *)&D_strliteral_2e96)), 24);
+	BLIT((u64)B22, t_object_2e97, 24);
+	t__2e92 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R23, (u64)B20, (u64)B21, (u64)B22);
+	t_tag_2e99 = (u64)(*(u32 *)t__2e92);
+	t__2e107 = (u64)(u32)(((u32)t_tag_2e99 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e107) goto L_member_2e104; else goto L__2e106;
+	L__2e106:;
+	t__2e109 = (u64)(u32)(((u32)t_tag_2e99 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e109) goto L_member_2e105; else goto L__2e108;
+	L__2e108:;
+	goto L_matches_2e103;
+	L_member_2e104:;
+	goto L_matches_2e103;
+	L_member_2e105:;
+	goto L_matches_2e102;
+	L_matches_2e102:;
+	goto L__2e100;
+	L_matches_2e103:;
+	t_abortsite_2e37 = ((u64)6UL);
+	goto L_abort_2e38;
+	L__2e110:;
+	L__2e101:;
+	t_abortsite_2e37 = ((u64)7UL);
+	goto L_abort_2e45;
+	L__2e100:;
+	goto L__2e9;
+	L__2e111:;
+	L__2e9:;
+	return;
+	L_abort_2e38:;
+	t__2e39 = (u64)((u64)t_abortsite_2e37 * (u64)((u64)16UL));
+	t__2e39 = (u64)((u64)((u64)((char *)&D_abortsites_2e36)) + (u64)t__2e39);
+	t__2e40 = (u64)(*(u64 *)t__2e39);
+	t__2e41 = (u64)((u64)t__2e39 + (u64)((u64)8UL));
+	t__2e42 = (u64)(*(u32 *)t__2e41);
+	t__2e41 = (u64)((u64)t__2e39 + (u64)((u64)12UL));
+	t__2e43 = (u64)(*(u32 *)t__2e41);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e40, (u64)t__2e42, (u64)t__2e43, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e45:;
+	t__2e46 = (u64)((u64)t_abortsite_2e37 * (u64)((u64)16UL));
+	t__2e46 = (u64)((u64)((u64)((char *)&D_abortsites_2e36)) + (u64)t__2e46);
+	t__2e47 = (u64)(*(u64 *)t__2e46);
+	t__2e48 = (u64)((u64)t__2e46 + (u64)((u64)8UL));
+	t__2e49 = (u64)(*(u32 *)t__2e48);
+	t__2e48 = (u64)((u64)t__2e46 + (u64)((u64)12UL));
+	t__2e50 = (u64)(*(u32 *)t__2e48);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e47, (u64)t__2e49, (u64)t__2e50, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_constdiv(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	char A2[1] __attribute__((aligned(16)));
+	char A3[192] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	u64 t__2e122;
+	u64 t__2e123;
+	u64 t__2e124;
+	u64 t__2e128;
+	u64 t__2e129;
+	u64 t__2e132;
+	u64 t__2e135;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e139;
+	u64 t__2e140;
+	u64 t__2e141;
+	u64 t__2e142;
+	u64 t__2e143;
+	u64 t__2e144;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e147;
+	u64 t__2e148;
+	u64 t__2e149;
+	u64 t__2e150;
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e154;
+	u64 t__2e155;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e159;
+	u64 t__2e160;
+	u64 t__2e164;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e167;
+	u64 t__2e168;
+	u64 t__2e171;
+	u64 t__2e174;
+	u64 t__2e175;
+	u64 t__2e176;
+	u64 t__2e177;
+	u64 t__2e178;
+	u64 t__2e179;
+	u64 t__2e180;
+	u64 t__2e181;
+	u64 t__2e182;
+	u64 t__2e183;
+	u64 t__2e184;
+	u64 t__2e185;
+	u64 t__2e186;
+	u64 t__2e187;
+	u64 t__2e188;
+	u64 t__2e189;
+	u64 t__2e190;
+	u64 t__2e191;
+	u64 t__2e192;
+	u64 t__2e193;
+	u64 t__2e194;
+	u64 t__2e195;
+	u64 t__2e198;
+	u64 t__2e201;
+	u64 t__2e202;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e205;
+	u64 t__2e206;
+	u64 t__2e207;
+	u64 t__2e208;
+	u64 t__2e209;
+	u64 t__2e210;
+	u64 t__2e211;
+	u64 t__2e212;
+	u64 t__2e213;
+	u64 t__2e214;
+	u64 t__2e215;
+	u64 t__2e216;
+	u64 t__2e217;
+	u64 t__2e218;
+	u64 t__2e219;
+	u64 t__2e220;
+	u64 t__2e221;
+	u64 t__2e222;
+	u64 t__2e223;
+	u64 t__2e224;
+	u64 t__2e225;
+	u64 t__2e226;
+	u64 t__2e229;
+	u64 t__2e232;
+	u64 t__2e233;
+	u64 t__2e234;
+	u64 t__2e235;
+	u64 t__2e236;
+	u64 t__2e237;
+	u64 t__2e238;
+	u64 t__2e239;
+	u64 t__2e240;
+	u64 t__2e241;
+	u64 t__2e242;
+	u64 t__2e243;
+	u64 t__2e244;
+	u64 t__2e245;
+	u64 t__2e246;
+	u64 t__2e247;
+	u64 t__2e248;
+	u64 t__2e249;
+	u64 t__2e250;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e253;
+	u64 t__2e254;
+	u64 t__2e255;
+	u64 t__2e256;
+	u64 t__2e257;
+	u64 t__2e258;
+	u64 t__2e259;
+	u64 t__2e260;
+	u64 t__2e261;
+	u64 t__2e264;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e269;
+	u64 t__2e270;
+	u64 t__2e271;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e275;
+	u64 t__2e276;
+	u64 t__2e277;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t__2e280;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e283;
+	u64 t__2e284;
+	u64 t__2e285;
+	u64 t__2e286;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e289;
+	u64 t__2e290;
+	u64 t__2e291;
+	u64 t__2e292;
+	u64 t__2e294;
+	u64 t__2e295;
+	u64 t__2e298;
+	u64 t__2e301;
+	u64 t__2e302;
+	u64 t__2e303;
+	u64 t__2e304;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t__2e311;
+	u64 t__2e312;
+	u64 t__2e313;
+	u64 t__2e314;
+	u64 t__2e315;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e318;
+	u64 t__2e319;
+	u64 t__2e320;
+	u64 t__2e321;
+	u64 t__2e322;
+	u64 t__2e323;
+	u64 t__2e324;
+	u64 t__2e327;
+	u64 t__2e330;
+	u64 t__2e331;
+	u64 t__2e332;
+	u64 t__2e333;
+	u64 t__2e334;
+	u64 t__2e335;
+	u64 t__2e336;
+	u64 t__2e337;
+	u64 t__2e338;
+	u64 t__2e339;
+	u64 t__2e340;
+	u64 t__2e341;
+	u64 t__2e342;
+	u64 t__2e343;
+	u64 t__2e344;
+	u64 t__2e345;
+	u64 t__2e346;
+	u64 t__2e347;
+	u64 t__2e350;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e355;
+	u64 t__2e356;
+	u64 t__2e357;
+	u64 t__2e358;
+	u64 t__2e359;
+	u64 t__2e360;
+	u64 t__2e361;
+	u64 t__2e362;
+	u64 t__2e363;
+	u64 t__2e364;
+	u64 t__2e365;
+	u64 t__2e366;
+	u64 t__2e367;
+	u64 t__2e368;
+	u64 t__2e369;
+	u64 t__2e370;
+	u64 t__2e371;
+	u64 t__2e372;
+	u64 t__2e373;
+	u64 t__2e374;
+	u64 t__2e375;
+	u64 t__2e376;
+	u64 t__2e378;
+	u64 t__2e391;
+	u64 t__2e400;
+	u64 t__2e401;
+	u64 t__2e402;
+	u64 t__2e406;
+	u64 t__2e407;
+	u64 t__2e408;
+	u64 t__2e409;
+	u64 t__2e410;
+	u64 t__2e411;
+	u64 t__2e412;
+	u64 t__2e413;
+	u64 t__2e414;
+	u64 t__2e415;
+	u64 t__2e416;
+	u64 t__2e417;
+	u64 t__2e418;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e421;
+	u64 t__2e422;
+	u64 t__2e423;
+	u64 t__2e424;
+	u64 t__2e425;
+	u64 t__2e426;
+	u64 t__2e428;
+	u64 t__2e436;
+	u64 t__2e437;
+	u64 t__2e438;
+	u64 t__2e441;
+	u64 t__2e442;
+	u64 t__2e443;
+	u64 t__2e444;
+	u64 t__2e445;
+	u64 t__2e446;
+	u64 t__2e447;
+	u64 t__2e448;
+	u64 t__2e449;
+	u64 t__2e451;
+	u64 t_abortsite_2e162;
+	u64 t_binding_2e121;
+	u64 t_binding_2e127;
+	u64 t_binding_2e293;
+	u64 t_binding_2e379;
+	u64 t_binding_2e399;
+	u64 t_binding_2e405;
+	u64 t_binding_2e435;
+	u64 t_cur__object_2e388;
+	u64 t_end_2e389;
+	u64 t_item_2e381;
+	u64 t_ptr_2e387;
+	u64 t_valid_2e390;
+	L_start_2e112:;
+	t_binding_2e121 = (u64)A0;
+	t_binding_2e127 = (u64)A1;
+	t_binding_2e293 = (u64)A2;
+	t_binding_2e379 = (u64)A3;
+	t_cur__object_2e388 = (u64)A4;
+	t_binding_2e399 = (u64)A5;
+	t_binding_2e405 = (u64)A6;
+	t_binding_2e435 = (u64)A7;
+	L_body_2e113:;
+	t__2e122 = (u64)(u32)(-(u32)((u64)128UL));
+	*(u32 *)t_binding_2e121 = (u32)t__2e122;
+	L_loop_2e116:;
+	t__2e124 = (u64)(u32)(*(i32 *)t_binding_2e121);
+	t__2e123 = (u64)(u32)(((i32)t__2e124 < (i32)((u64)128UL)));
+	if ((u32)t__2e123) goto L_body_2e117; else goto L__2e119;
+	L_body_2e117:;
+	t__2e128 = (u64)(u32)(*(i32 *)t_binding_2e121);
+	t__2e129 = (u64)(u32)t__2e128;
+	*(u8 *)t_binding_2e127 = (u8)t__2e129;
+	t__2e137 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e138 = (u64)(u32)((i64)(i8)t__2e137);
+	t__2e139 = (u64)(u32)((i64)(i8)((u64)3UL));
+	t__2e140 = (u64)((i64)(i32)t__2e138);
+	t__2e141 = (u64)((u64)t__2e140 * (u64)((u64)2863311531UL));
+	t__2e142 = (u64)((i64)t__2e141 >> (((u64)33UL) & 63));
+	t__2e143 = (u64)((u64)t__2e140 >> (((u64)63UL) & 63));
+	t__2e142 = (u64)((u64)t__2e142 + (u64)t__2e143);
+	t__2e136 = (u64)(u32)t__2e142;
+	t__2e145 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e144 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div8)))((u32)t__2e145, (u32)((u64)3UL)));
+	t__2e146 = (u64)(u32)((i64)(i8)t__2e136);
+	t__2e147 = (u64)(u32)((i64)(i8)t__2e144);
+	t__2e135 = (u64)(u32)(((u32)t__2e146 == (u32)t__2e147));
+	t__2e132 = (u64)(u32)t__2e135;
+	if ((u32)t__2e132) goto L__2e133; else goto L__2e134;
+	L__2e133:;
+	t__2e150 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e151 = (u64)(u32)((i64)(i8)t__2e150);
+	t__2e152 = (u64)(u32)((i64)(i8)((u64)3UL));
+	t__2e153 = (u64)((i64)(i32)t__2e151);
+	t__2e154 = (u64)((u64)t__2e153 * (u64)((u64)2863311531UL));
+	t__2e155 = (u64)((i64)t__2e154 >> (((u64)33UL) & 63));
+	t__2e156 = (u64)((u64)t__2e153 >> (((u64)63UL) & 63));
+	t__2e155 = (u64)((u64)t__2e155 + (u64)t__2e156);
+	t__2e155 = (u64)((u64)t__2e155 * (u64)((u64)3UL));
+	t__2e155 = (u64)((u64)t__2e153 - (u64)t__2e155);
+	t__2e149 = (u64)(u32)t__2e155;
+	t__2e158 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e157 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem8)))((u32)t__2e158, (u32)((u64)3UL)));
+	t__2e159 = (u64)(u32)((i64)(i8)t__2e149);
+	t__2e160 = (u64)(u32)((i64)(i8)t__2e157);
+	t__2e148 = (u64)(u32)(((u32)t__2e159 == (u32)t__2e160));
+	t__2e132 = (u64)(u32)t__2e148;
+	goto L__2e134;
+	L__2e134:;
+	if ((u32)t__2e132) goto L_passed_2e131; else goto L_failed_2e130;
+	L_failed_2e130:;
+	t_abortsite_2e162 = ((u64)0UL);
+	goto L_abort_2e163;
+	L_passed_2e131:;
+	t__2e176 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e177 = (u64)(u32)((i64)(i8)t__2e176);
+	t__2e178 = (u64)(u32)((i64)(i8)((u64)4UL));
+	t__2e179 = (u64)(u32)((i32)t__2e177 >> (((u64)31UL) & 31));
+	t__2e179 = (u64)(u32)((u32)t__2e179 >> (((u64)30UL) & 31));
+	t__2e180 = (u64)(u32)((u32)t__2e177 + (u32)t__2e179);
+	t__2e175 = (u64)(u32)((i32)t__2e180 >> (((u64)2UL) & 31));
+	t__2e182 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e181 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div8)))((u32)t__2e182, (u32)((u64)4UL)));
+	t__2e183 = (u64)(u32)((i64)(i8)t__2e175);
+	t__2e184 = (u64)(u32)((i64)(i8)t__2e181);
+	t__2e174 = (u64)(u32)(((u32)t__2e183 == (u32)t__2e184));
+	t__2e171 = (u64)(u32)t__2e174;
+	if ((u32)t__2e171) goto L__2e172; else goto L__2e173;
+	L__2e172:;
+	t__2e187 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e188 = (u64)(u32)((i64)(i8)t__2e187);
+	t__2e189 = (u64)(u32)((i64)(i8)((u64)4UL));
+	t__2e190 = (u64)(u32)((i32)t__2e188 >> (((u64)31UL) & 31));
+	t__2e190 = (u64)(u32)((u32)t__2e190 >> (((u64)30UL) & 31));
+	t__2e191 = (u64)(u32)((u32)t__2e188 + (u32)t__2e190);
+	t__2e191 = (u64)(u32)((u32)t__2e191 & (u32)((u64)4294967292UL));
+	t__2e186 = (u64)(u32)((u32)t__2e188 - (u32)t__2e191);
+	t__2e193 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e192 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem8)))((u32)t__2e193, (u32)((u64)4UL)));
+	t__2e194 = (u64)(u32)((i64)(i8)t__2e186);
+	t__2e195 = (u64)(u32)((i64)(i8)t__2e192);
+	t__2e185 = (u64)(u32)(((u32)t__2e194 == (u32)t__2e195));
+	t__2e171 = (u64)(u32)t__2e185;
+	goto L__2e173;
+	L__2e173:;
+	if ((u32)t__2e171) goto L_passed_2e170; else goto L_failed_2e169;
+	L_failed_2e169:;
+	t_abortsite_2e162 = ((u64)1UL);
+	goto L_abort_2e163;
+	L_passed_2e170:;
+	t__2e203 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e204 = (u64)(u32)((i64)(i8)t__2e203);
+	t__2e205 = (u64)(u32)((i64)(i8)((u64)100UL));
+	t__2e206 = (u64)((i64)(i32)t__2e204);
+	t__2e207 = (u64)((u64)t__2e206 * (u64)((u64)1374389535UL));
+	t__2e208 = (u64)((i64)t__2e207 >> (((u64)37UL) & 63));
+	t__2e209 = (u64)((u64)t__2e206 >> (((u64)63UL) & 63));
+	t__2e208 = (u64)((u64)t__2e208 + (u64)t__2e209);
+	t__2e202 = (u64)(u32)t__2e208;
+	t__2e211 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e210 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div8)))((u32)t__2e211, (u32)((u64)100UL)));
+	t__2e212 = (u64)(u32)((i64)(i8)t__2e202);
+	t__2e213 = (u64)(u32)((i64)(i8)t__2e210);
+	t__2e201 = (u64)(u32)(((u32)t__2e212 == (u32)t__2e213));
+	t__2e198 = (u64)(u32)t__2e201;
+	if ((u32)t__2e198) goto L__2e199; else goto L__2e200;
+	L__2e199:;
+	t__2e216 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e217 = (u64)(u32)((i64)(i8)t__2e216);
+	t__2e218 = (u64)(u32)((i64)(i8)((u64)100UL));
+	t__2e219 = (u64)((i64)(i32)t__2e217);
+	t__2e220 = (u64)((u64)t__2e219 * (u64)((u64)1374389535UL));
+	t__2e221 = (u64)((i64)t__2e220 >> (((u64)37UL) & 63));
+	t__2e222 = (u64)((u64)t__2e219 >> (((u64)63UL) & 63));
+	t__2e221 = (u64)((u64)t__2e221 + (u64)t__2e222);
+	t__2e221 = (u64)((u64)t__2e221 * (u64)((u64)100UL));
+	t__2e221 = (u64)((u64)t__2e219 - (u64)t__2e221);
+	t__2e215 = (u64)(u32)t__2e221;
+	t__2e224 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e223 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem8)))((u32)t__2e224, (u32)((u64)100UL)));
+	t__2e225 = (u64)(u32)((i64)(i8)t__2e215);
+	t__2e226 = (u64)(u32)((i64)(i8)t__2e223);
+	t__2e214 = (u64)(u32)(((u32)t__2e225 == (u32)t__2e226));
+	t__2e198 = (u64)(u32)t__2e214;
+	goto L__2e200;
+	L__2e200:;
+	if ((u32)t__2e198) goto L_passed_2e197; else goto L_failed_2e196;
+	L_failed_2e196:;
+	t_abortsite_2e162 = ((u64)2UL);
+	goto L_abort_2e163;
+	L_passed_2e197:;
+	t__2e234 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e235 = (u64)(u32)(-(u32)((u64)7UL));
+	t__2e236 = (u64)(u32)((i64)(i8)t__2e234);
+	t__2e237 = (u64)(u32)((i64)(i8)t__2e235);
+	t__2e238 = (u64)((i64)(i32)t__2e236);
+	t__2e239 = (u64)((u64)t__2e238 * (u64)((u64)2454267027UL));
+	t__2e240 = (u64)((i64)t__2e239 >> (((u64)34UL) & 63));
+	t__2e241 = (u64)((u64)t__2e238 >> (((u64)63UL) & 63));
+	t__2e240 = (u64)((u64)t__2e240 + (u64)t__2e241);
+	t__2e240 = (u64)(-(u64)t__2e240);
+	t__2e233 = (u64)(u32)t__2e240;
+	t__2e243 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e244 = (u64)(u32)(-(u32)((u64)7UL));
+	t__2e242 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div8)))((u32)t__2e243, (u32)t__2e244));
+	t__2e245 = (u64)(u32)((i64)(i8)t__2e233);
+	t__2e246 = (u64)(u32)((i64)(i8)t__2e242);
+	t__2e232 = (u64)(u32)(((u32)t__2e245 == (u32)t__2e246));
+	t__2e229 = (u64)(u32)t__2e232;
+	if ((u32)t__2e229) goto L__2e230; else goto L__2e231;
+	L__2e230:;
+	t__2e249 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e250 = (u64)(u32)(-(u32)((u64)7UL));
+	t__2e251 = (u64)(u32)((i64)(i8)t__2e249);
+	t__2e252 = (u64)(u32)((i64)(i8)t__2e250);
+	t__2e253 = (u64)((i64)(i32)t__2e251);
+	t__2e254 = (u64)((u64)t__2e253 * (u64)((u64)2454267027UL));
+	t__2e255 = (u64)((i64)t__2e254 >> (((u64)34UL) & 63));
+	t__2e256 = (u64)((u64)t__2e253 >> (((u64)63UL) & 63));
+	t__2e255 = (u64)((u64)t__2e255 + (u64)t__2e256);
+	t__2e255 = (u64)((u64)t__2e255 * (u64)((u64)7UL));
+	t__2e255 = (u64)((u64)t__2e253 - (u64)t__2e255);
+	t__2e248 = (u64)(u32)t__2e255;
+	t__2e258 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e259 = (u64)(u32)(-(u32)((u64)7UL));
+	t__2e257 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem8)))((u32)t__2e258, (u32)t__2e259));
+	t__2e260 = (u64)(u32)((i64)(i8)t__2e248);
+	t__2e261 = (u64)(u32)((i64)(i8)t__2e257);
+	t__2e247 = (u64)(u32)(((u32)t__2e260 == (u32)t__2e261));
+	t__2e229 = (u64)(u32)t__2e247;
+	goto L__2e231;
+	L__2e231:;
+	if ((u32)t__2e229) goto L_passed_2e228; else goto L_failed_2e227;
+	L_failed_2e227:;
+	t_abortsite_2e162 = ((u64)3UL);
+	goto L_abort_2e163;
+	L_passed_2e228:;
+	t__2e269 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e270 = (u64)(u32)(-(u32)((u64)64UL));
+	t__2e271 = (u64)(u32)((i64)(i8)t__2e269);
+	t__2e272 = (u64)(u32)((i64)(i8)t__2e270);
+	t__2e273 = (u64)(u32)((i32)t__2e271 >> (((u64)31UL) & 31));
+	t__2e273 = (u64)(u32)((u32)t__2e273 >> (((u64)26UL) & 31));
+	t__2e274 = (u64)(u32)((u32)t__2e271 + (u32)t__2e273);
+	t__2e268 = (u64)(u32)((i32)t__2e274 >> (((u64)6UL) & 31));
+	t__2e268 = (u64)(u32)(-(u32)t__2e268);
+	t__2e276 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e277 = (u64)(u32)(-(u32)((u64)64UL));
+	t__2e275 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div8)))((u32)t__2e276, (u32)t__2e277));
+	t__2e278 = (u64)(u32)((i64)(i8)t__2e268);
+	t__2e279 = (u64)(u32)((i64)(i8)t__2e275);
+	t__2e267 = (u64)(u32)(((u32)t__2e278 == (u32)t__2e279));
+	t__2e264 = (u64)(u32)t__2e267;
+	if ((u32)t__2e264) goto L__2e265; else goto L__2e266;
+	L__2e265:;
+	t__2e282 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e283 = (u64)(u32)(-(u32)((u64)64UL));
+	t__2e284 = (u64)(u32)((i64)(i8)t__2e282);
+	t__2e285 = (u64)(u32)((i64)(i8)t__2e283);
+	t__2e286 = (u64)(u32)((i32)t__2e284 >> (((u64)31UL) & 31));
+	t__2e286 = (u64)(u32)((u32)t__2e286 >> (((u64)26UL) & 31));
+	t__2e287 = (u64)(u32)((u32)t__2e284 + (u32)t__2e286);
+	t__2e287 = (u64)(u32)((u32)t__2e287 & (u32)((u64)4294967232UL));
+	t__2e281 = (u64)(u32)((u32)t__2e284 - (u32)t__2e287);
+	t__2e289 = (u64)(u32)(*(i8 *)t_binding_2e127);
+	t__2e290 = (u64)(u32)(-(u32)((u64)64UL));
+	t__2e288 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem8)))((u32)t__2e289, (u32)t__2e290));
+	t__2e291 = (u64)(u32)((i64)(i8)t__2e281);
+	t__2e292 = (u64)(u32)((i64)(i8)t__2e288);
+	t__2e280 = (u64)(u32)(((u32)t__2e291 == (u32)t__2e292));
+	t__2e264 = (u64)(u32)t__2e280;
+	goto L__2e266;
+	L__2e266:;
+	if ((u32)t__2e264) goto L_passed_2e263; else goto L_failed_2e262;
+	L_failed_2e262:;
+	t_abortsite_2e162 = ((u64)4UL);
+	goto L_abort_2e163;
+	L_passed_2e263:;
+	t__2e294 = (u64)(u32)(*(i32 *)t_binding_2e121);
+	t__2e295 = (u64)(u32)t__2e294;
+	*(u8 *)t_binding_2e293 = (u8)t__2e295;
+	t__2e303 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e304 = (u64)(u32)((u8)t__2e303);
+	t__2e305 = (u64)(u32)((u8)((u64)3UL));
+	t__2e306 = (u64)((u32)t__2e304);
+	t__2e307 = (u64)((u64)t__2e306 * (u64)((u64)2863311531UL));
+	t__2e308 = (u64)((u64)t__2e307 >> (((u64)33UL) & 63));
+	t__2e302 = (u64)(u32)t__2e308;
+	t__2e310 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e309 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv8)))((u32)t__2e310, (u32)((u64)3UL)));
+	t__2e311 = (u64)(u32)((u8)t__2e302);
+	t__2e312 = (u64)(u32)((u8)t__2e309);
+	t__2e301 = (u64)(u32)(((u32)t__2e311 == (u32)t__2e312));
+	t__2e298 = (u64)(u32)t__2e301;
+	if ((u32)t__2e298) goto L__2e299; else goto L__2e300;
+	L__2e299:;
+	t__2e315 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e316 = (u64)(u32)((u8)t__2e315);
+	t__2e317 = (u64)(u32)((u8)((u64)3UL));
+	t__2e318 = (u64)((u32)t__2e316);
+	t__2e319 = (u64)((u64)t__2e318 * (u64)((u64)2863311531UL));
+	t__2e320 = (u64)((u64)t__2e319 >> (((u64)33UL) & 63));
+	t__2e320 = (u64)((u64)t__2e320 * (u64)((u64)3UL));
+	t__2e320 = (u64)((u64)t__2e318 - (u64)t__2e320);
+	t__2e314 = (u64)(u32)t__2e320;
+	t__2e322 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e321 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem8)))((u32)t__2e322, (u32)((u64)3UL)));
+	t__2e323 = (u64)(u32)((u8)t__2e314);
+	t__2e324 = (u64)(u32)((u8)t__2e321);
+	t__2e313 = (u64)(u32)(((u32)t__2e323 == (u32)t__2e324));
+	t__2e298 = (u64)(u32)t__2e313;
+	goto L__2e300;
+	L__2e300:;
+	if ((u32)t__2e298) goto L_passed_2e297; else goto L_failed_2e296;
+	L_failed_2e296:;
+	t_abortsite_2e162 = ((u64)5UL);
+	goto L_abort_2e163;
+	L_passed_2e297:;
+	t__2e332 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e333 = (u64)(u32)((u8)t__2e332);
+	t__2e334 = (u64)(u32)((u8)((u64)16UL));
+	t__2e331 = (u64)(u32)((u32)t__2e333 >> (((u64)4UL) & 31));
+	t__2e336 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e335 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv8)))((u32)t__2e336, (u32)((u64)16UL)));
+	t__2e337 = (u64)(u32)((u8)t__2e331);
+	t__2e338 = (u64)(u32)((u8)t__2e335);
+	t__2e330 = (u64)(u32)(((u32)t__2e337 == (u32)t__2e338));
+	t__2e327 = (u64)(u32)t__2e330;
+	if ((u32)t__2e327) goto L__2e328; else goto L__2e329;
+	L__2e328:;
+	t__2e341 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e342 = (u64)(u32)((u8)t__2e341);
+	t__2e343 = (u64)(u32)((u8)((u64)16UL));
+	t__2e340 = (u64)(u32)((u32)t__2e342 & (u32)((u64)15UL));
+	t__2e345 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e344 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem8)))((u32)t__2e345, (u32)((u64)16UL)));
+	t__2e346 = (u64)(u32)((u8)t__2e340);
+	t__2e347 = (u64)(u32)((u8)t__2e344);
+	t__2e339 = (u64)(u32)(((u32)t__2e346 == (u32)t__2e347));
+	t__2e327 = (u64)(u32)t__2e339;
+	goto L__2e329;
+	L__2e329:;
+	if ((u32)t__2e327) goto L_passed_2e326; else goto L_failed_2e325;
+	L_failed_2e325:;
+	t_abortsite_2e162 = ((u64)6UL);
+	goto L_abort_2e163;
+	L_passed_2e326:;
+	t__2e355 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e356 = (u64)(u32)((u8)t__2e355);
+	t__2e357 = (u64)(u32)((u8)((u64)255UL));
+	t__2e358 = (u64)((u32)t__2e356);
+	t__2e359 = (u64)((u64)t__2e358 * (u64)((u64)2155905153UL));
+	t__2e360 = (u64)((u64)t__2e359 >> (((u64)39UL) & 63));
+	t__2e354 = (u64)(u32)t__2e360;
+	t__2e362 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e361 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv8)))((u32)t__2e362, (u32)((u64)255UL)));
+	t__2e363 = (u64)(u32)((u8)t__2e354);
+	t__2e364 = (u64)(u32)((u8)t__2e361);
+	t__2e353 = (u64)(u32)(((u32)t__2e363 == (u32)t__2e364));
+	t__2e350 = (u64)(u32)t__2e353;
+	if ((u32)t__2e350) goto L__2e351; else goto L__2e352;
+	L__2e351:;
+	t__2e367 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e368 = (u64)(u32)((u8)t__2e367);
+	t__2e369 = (u64)(u32)((u8)((u64)255UL));
+	t__2e370 = (u64)((u32)t__2e368);
+	t__2e371 = (u64)((u64)t__2e370 * (u64)((u64)2155905153UL));
+	t__2e372 = (u64)((u64)t__2e371 >> (((u64)39UL) & 63));
+	t__2e372 = (u64)((u64)t__2e372 * (u64)((u64)255UL));
+	t__2e372 = (u64)((u64)t__2e370 - (u64)t__2e372);
+	t__2e366 = (u64)(u32)t__2e372;
+	t__2e374 = (u64)(u32)(*(u8 *)t_binding_2e293);
+	t__2e373 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem8)))((u32)t__2e374, (u32)((u64)255UL)));
+	t__2e375 = (u64)(u32)((u8)t__2e366);
+	t__2e376 = (u64)(u32)((u8)t__2e373);
+	t__2e365 = (u64)(u32)(((u32)t__2e375 == (u32)t__2e376));
+	t__2e350 = (u64)(u32)t__2e365;
+	goto L__2e352;
+	L__2e352:;
+	if ((u32)t__2e350) goto L_passed_2e349; else goto L_failed_2e348;
+	L_failed_2e348:;
+	t_abortsite_2e162 = ((u64)7UL);
+	goto L_abort_2e163;
+	L_passed_2e349:;
+	goto L__2e125;
+	L__2e377:;
+	L__2e125:;
+	L_after_2e120:;
+	t__2e378 = (u64)(u32)(*(i32 *)t_binding_2e121);
+	t__2e378 = (u64)(u32)((u32)t__2e378 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e121 = (u32)t__2e378;
+	goto L_loop_2e116;
+	L__2e119:;
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)0UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)8UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)1UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)16UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)2UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)24UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)3UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)32UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)6UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)40UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)7UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)48UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)8UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)56UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)9UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)64UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)10UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)72UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)640UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)80UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)641UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)88UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)642UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)96UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)999UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)104UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)1000UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)112UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)1001UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)120UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)65535UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)128UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)65536UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)136UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)2147483646UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)144UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)2147483647UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)152UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)2147483648UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)160UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)4294967294UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)168UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)4294967295UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)176UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)4294967296UL);
+	t_item_2e381 = (u64)((u64)t_binding_2e379 + (u64)((u64)184UL));
+	*(u64 *)t_item_2e381 = (u64)((u64)9223372036854775807UL);
+	t_ptr_2e387 = t_binding_2e379;
+	t_end_2e389 = (u64)((u64)((u64)24UL) * (u64)((u64)8UL));
+	t_end_2e389 = (u64)((u64)t_ptr_2e387 + (u64)t_end_2e389);
+	L_loop_2e382:;
+	t_valid_2e390 = (u64)(u32)(((u64)t_ptr_2e387 < (u64)t_end_2e389));
+	if ((u32)t_valid_2e390) goto L_valid_2e384; else goto L__2e385;
+	L_valid_2e384:;
+	t__2e391 = (u64)(*(u64 *)t_ptr_2e387);
+	*(u64 *)t_cur__object_2e388 = (u64)t__2e391;
+	L_body_2e383:;
+	t__2e400 = (u64)(-(u64)((u64)2UL));
+	*(u64 *)t_binding_2e399 = (u64)t__2e400;
+	L_loop_2e394:;
+	t__2e402 = (u64)(*(u64 *)t_binding_2e399);
+	t__2e401 = (u64)(u32)(((i64)t__2e402 <= (i64)((u64)2UL)));
+	if ((u32)t__2e401) goto L_body_2e395; else goto L__2e397;
+	L_body_2e395:;
+	t__2e407 = (u64)(*(u64 *)t_cur__object_2e388);
+	t__2e408 = (u64)(*(u64 *)t_binding_2e399);
+	t__2e406 = (u64)((u64)t__2e407 + (u64)t__2e408);
+	*(u64 *)t_binding_2e405 = (u64)t__2e406;
+	t__2e409 = (u64)(*(u64 *)t_binding_2e405);
+	t__2e410 = (u64)(u32)t__2e409;
+	((void (*)(u32))((u64)((char *)&F_check32)))((u32)t__2e410);
+	t__2e411 = (u64)(*(u64 *)t_binding_2e405);
+	t__2e412 = (u64)(-(u64)t__2e411);
+	t__2e413 = (u64)(u32)t__2e412;
+	((void (*)(u32))((u64)((char *)&F_check32)))((u32)t__2e413);
+	t__2e414 = (u64)(*(u64 *)t_binding_2e405);
+	t__2e415 = (u64)(u32)t__2e414;
+	((void (*)(u32))((u64)((char *)&F_checku32)))((u32)t__2e415);
+	t__2e416 = (u64)(*(u64 *)t_binding_2e405);
+	t__2e417 = (u64)(-(u64)t__2e416);
+	t__2e418 = (u64)(u32)t__2e417;
+	((void (*)(u32))((u64)((char *)&F_checku32)))((u32)t__2e418);
+	t__2e419 = (u64)(*(u64 *)t_binding_2e405);
+	t__2e420 = (u64)(*(u64 *)t_binding_2e405);
+	t__2e421 = t__2e420;
+	((void (*)(u64, u64))((u64)((char *)&F_check64)))((u64)t__2e419, (u64)t__2e421);
+	t__2e422 = (u64)(*(u64 *)t_binding_2e405);
+	t__2e423 = (u64)(-(u64)t__2e422);
+	t__2e424 = (u64)(*(u64 *)t_binding_2e405);
+	t__2e425 = (u64)(-(u64)t__2e424);
+	t__2e426 = t__2e425;
+	((void (*)(u64, u64))((u64)((char *)&F_check64)))((u64)t__2e423, (u64)t__2e426);
+	goto L__2e403;
+	L__2e427:;
+	L__2e403:;
+	L_after_2e398:;
+	t__2e428 = (u64)(*(u64 *)t_binding_2e399);
+	t__2e428 = (u64)((u64)t__2e428 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e399 = (u64)t__2e428;
+	goto L_loop_2e394;
+	L__2e397:;
+	goto L__2e392;
+	L__2e429:;
+	L__2e392:;
+	L_after_2e386:;
+	t_ptr_2e387 = (u64)((u64)t_ptr_2e387 + (u64)((u64)8UL));
+	goto L_loop_2e382;
+	L__2e385:;
+	t__2e436 = (u64)(-(u64)((u64)2147483648UL));
+	*(u64 *)t_binding_2e435 = (u64)t__2e436;
+	L_loop_2e430:;
+	t__2e438 = (u64)(*(u64 *)t_binding_2e435);
+	t__2e437 = (u64)(u32)(((i64)t__2e438 <= (i64)((u64)2147483647UL)));
+	if ((u32)t__2e437) goto L_body_2e431; else goto L__2e433;
+	L_body_2e431:;
+	t__2e441 = (u64)(*(u64 *)t_binding_2e435);
+	t__2e442 = (u64)(u32)t__2e441;
+	((void (*)(u32))((u64)((char *)&F_check32)))((u32)t__2e442);
+	t__2e443 = (u64)(*(u64 *)t_binding_2e435);
+	t__2e444 = (u64)(u32)t__2e443;
+	((void (*)(u32))((u64)((char *)&F_checku32)))((u32)t__2e444);
+	t__2e446 = (u64)(*(u64 *)t_binding_2e435);
+	t__2e445 = (u64)((u64)t__2e446 * (u64)((u64)2147483659UL));
+	t__2e448 = (u64)(*(u64 *)t_binding_2e435);
+	t__2e447 = (u64)((u64)t__2e448 * (u64)((u64)2147483659UL));
+	t__2e449 = t__2e447;
+	((void (*)(u64, u64))((u64)((char *)&F_check64)))((u64)t__2e445, (u64)t__2e449);
+	goto L__2e439;
+	L__2e450:;
+	L__2e439:;
+	L_after_2e434:;
+	t__2e451 = (u64)(*(u64 *)t_binding_2e435);
+	t__2e451 = (u64)((u64)t__2e451 + (u64)((u64)65521UL));
+	*(u64 *)t_binding_2e435 = (u64)t__2e451;
+	goto L_loop_2e430;
+	L__2e433:;
+	goto L__2e114;
+	L__2e452:;
+	L__2e114:;
+	return;
+	L_abort_2e163:;
+	t__2e164 = (u64)((u64)t_abortsite_2e162 * (u64)((u64)16UL));
+	t__2e164 = (u64)((u64)((u64)((char *)&D_abortsites_2e161)) + (u64)t__2e164);
+	t__2e165 = (u64)(*(u64 *)t__2e164);
+	t__2e166 = (u64)((u64)t__2e164 + (u64)((u64)8UL));
+	t__2e167 = (u64)(*(u32 *)t__2e166);
+	t__2e166 = (u64)((u64)t__2e164 + (u64)((u64)12UL));
+	t__2e168 = (u64)(*(u32 *)t__2e166);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e165, (u64)t__2e167, (u64)t__2e168, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_check64(u64 p_x, u64 p_u) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e461;
+	u64 t__2e464;
+	u64 t__2e465;
+	u64 t__2e466;
+	u64 t__2e467;
+	u64 t__2e468;
+	u64 t__2e469;
+	u64 t__2e470;
+	u64 t__2e471;
+	u64 t__2e472;
+	u64 t__2e473;
+	u64 t__2e474;
+	u64 t__2e475;
+	u64 t__2e476;
+	u64 t__2e477;
+	u64 t__2e481;
+	u64 t__2e482;
+	u64 t__2e483;
+	u64 t__2e484;
+	u64 t__2e485;
+	u64 t__2e488;
+	u64 t__2e491;
+	u64 t__2e492;
+	u64 t__2e493;
+	u64 t__2e494;
+	u64 t__2e495;
+	u64 t__2e496;
+	u64 t__2e497;
+	u64 t__2e498;
+	u64 t__2e499;
+	u64 t__2e500;
+	u64 t__2e503;
+	u64 t__2e506;
+	u64 t__2e507;
+	u64 t__2e508;
+	u64 t__2e509;
+	u64 t__2e510;
+	u64 t__2e511;
+	u64 t__2e512;
+	u64 t__2e513;
+	u64 t__2e514;
+	u64 t__2e515;
+	u64 t__2e516;
+	u64 t__2e517;
+	u64 t__2e518;
+	u64 t__2e519;
+	u64 t__2e522;
+	u64 t__2e525;
+	u64 t__2e526;
+	u64 t__2e527;
+	u64 t__2e528;
+	u64 t__2e529;
+	u64 t__2e530;
+	u64 t__2e531;
+	u64 t__2e532;
+	u64 t__2e533;
+	u64 t__2e534;
+	u64 t__2e535;
+	u64 t__2e536;
+	u64 t__2e537;
+	u64 t__2e538;
+	u64 t__2e539;
+	u64 t__2e540;
+	u64 t__2e541;
+	u64 t__2e542;
+	u64 t__2e545;
+	u64 t__2e546;
+	u64 t__2e547;
+	u64 t__2e548;
+	u64 t__2e549;
+	u64 t__2e550;
+	u64 t__2e551;
+	u64 t__2e554;
+	u64 t__2e555;
+	u64 t__2e556;
+	u64 t__2e557;
+	u64 t__2e558;
+	u64 t__2e559;
+	u64 t__2e560;
+	u64 t__2e563;
+	u64 t__2e566;
+	u64 t__2e567;
+	u64 t__2e568;
+	u64 t__2e569;
+	u64 t__2e570;
+	u64 t__2e571;
+	u64 t__2e572;
+	u64 t__2e573;
+	u64 t__2e574;
+	u64 t__2e575;
+	u64 t__2e578;
+	u64 t__2e581;
+	u64 t__2e582;
+	u64 t__2e583;
+	u64 t__2e584;
+	u64 t__2e585;
+	u64 t__2e586;
+	u64 t__2e587;
+	u64 t__2e588;
+	u64 t__2e589;
+	u64 t__2e590;
+	u64 t__2e593;
+	u64 t__2e596;
+	u64 t__2e597;
+	u64 t__2e598;
+	u64 t__2e599;
+	u64 t__2e600;
+	u64 t__2e601;
+	u64 t__2e602;
+	u64 t__2e603;
+	u64 t__2e604;
+	u64 t__2e605;
+	u64 t__2e608;
+	u64 t__2e609;
+	u64 t__2e610;
+	u64 t__2e611;
+	u64 t__2e612;
+	u64 t__2e615;
+	u64 t__2e616;
+	u64 t__2e617;
+	u64 t__2e618;
+	u64 t__2e619;
+	u64 t__2e622;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e627;
+	u64 t__2e628;
+	u64 t__2e629;
+	u64 t__2e630;
+	u64 t__2e631;
+	u64 t__2e632;
+	u64 t__2e633;
+	u64 t__2e634;
+	u64 t_abortsite_2e479;
+	u64 t_param_2e454;
+	u64 t_param_2e455;
+	u64 t_u;
+	u64 t_x;
+	t_x = (u64)p_x;
+	t_u = (u64)p_u;
+	L_start_2e453:;
+	t_param_2e454 = (u64)A0;
+	t_param_2e455 = (u64)A1;
+	*(u64 *)t_param_2e454 = (u64)t_x;
+	*(u64 *)t_param_2e455 = (u64)t_u;
+	L_body_2e456:;
+	t__2e466 = (u64)(*(u64 *)t_param_2e454);
+	t__2e467 = (u64)((i64)t__2e466 >> (((u64)63UL) & 63));
+	t__2e467 = (u64)((u64)t__2e467 >> (((u64)63UL) & 63));
+	t__2e468 = (u64)((u64)t__2e466 + (u64)t__2e467);
+	t__2e465 = (u64)((i64)t__2e468 >> (((u64)1UL) & 63));
+	t__2e470 = (u64)(*(u64 *)t_param_2e454);
+	t__2e469 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_div64)))((u64)t__2e470, (u64)((u64)2UL)));
+	t__2e464 = (u64)(u32)(((u64)t__2e465 == (u64)t__2e469));
+	t__2e461 = (u64)(u32)t__2e464;
+	if ((u32)t__2e461) goto L__2e462; else goto L__2e463;
+	L__2e462:;
+	t__2e473 = (u64)(*(u64 *)t_param_2e454);
+	t__2e474 = (u64)((i64)t__2e473 >> (((u64)63UL) & 63));
+	t__2e474 = (u64)((u64)t__2e474 >> (((u64)63UL) & 63));
+	t__2e475 = (u64)((u64)t__2e473 + (u64)t__2e474);
+	t__2e475 = (u64)((u64)t__2e475 & (u64)((u64)18446744073709551614UL));
+	t__2e472 = (u64)((u64)t__2e473 - (u64)t__2e475);
+	t__2e477 = (u64)(*(u64 *)t_param_2e454);
+	t__2e476 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_rem64)))((u64)t__2e477, (u64)((u64)2UL)));
+	t__2e471 = (u64)(u32)(((u64)t__2e472 == (u64)t__2e476));
+	t__2e461 = (u64)(u32)t__2e471;
+	goto L__2e463;
+	L__2e463:;
+	if ((u32)t__2e461) goto L_passed_2e460; else goto L_failed_2e459;
+	L_failed_2e459:;
+	t_abortsite_2e479 = ((u64)0UL);
+	goto L_abort_2e480;
+	L_passed_2e460:;
+	t__2e493 = (u64)(*(u64 *)t_param_2e454);
+	t__2e492 = (u64)((i64)t__2e493 / (i64)((u64)7UL));
+	t__2e495 = (u64)(*(u64 *)t_param_2e454);
+	t__2e494 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_div64)))((u64)t__2e495, (u64)((u64)7UL)));
+	t__2e491 = (u64)(u32)(((u64)t__2e492 == (u64)t__2e494));
+	t__2e488 = (u64)(u32)t__2e491;
+	if ((u32)t__2e488) goto L__2e489; else goto L__2e490;
+	L__2e489:;
+	t__2e498 = (u64)(*(u64 *)t_param_2e454);
+	t__2e497 = (u64)((i64)t__2e498 % (i64)((u64)7UL));
+	t__2e500 = (u64)(*(u64 *)t_param_2e454);
+	t__2e499 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_rem64)))((u64)t__2e500, (u64)((u64)7UL)));
+	t__2e496 = (u64)(u32)(((u64)t__2e497 == (u64)t__2e499));
+	t__2e488 = (u64)(u32)t__2e496;
+	goto L__2e490;
+	L__2e490:;
+	if ((u32)t__2e488) goto L_passed_2e487; else goto L_failed_2e486;
+	L_failed_2e486:;
+	t_abortsite_2e479 = ((u64)1UL);
+	goto L_abort_2e480;
+	L_passed_2e487:;
+	t__2e508 = (u64)(*(u64 *)t_param_2e454);
+	t__2e509 = (u64)((i64)t__2e508 >> (((u64)63UL) & 63));
+	t__2e509 = (u64)((u64)t__2e509 >> (((u64)54UL) & 63));
+	t__2e510 = (u64)((u64)t__2e508 + (u64)t__2e509);
+	t__2e507 = (u64)((i64)t__2e510 >> (((u64)10UL) & 63));
+	t__2e512 = (u64)(*(u64 *)t_param_2e454);
+	t__2e511 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_div64)))((u64)t__2e512, (u64)((u64)1024UL)));
+	t__2e506 = (u64)(u32)(((u64)t__2e507 == (u64)t__2e511));
+	t__2e503 = (u64)(u32)t__2e506;
+	if ((u32)t__2e503) goto L__2e504; else goto L__2e505;
+	L__2e504:;
+	t__2e515 = (u64)(*(u64 *)t_param_2e454);
+	t__2e516 = (u64)((i64)t__2e515 >> (((u64)63UL) & 63));
+	t__2e516 = (u64)((u64)t__2e516 >> (((u64)54UL) & 63));
+	t__2e517 = (u64)((u64)t__2e515 + (u64)t__2e516);
+	t__2e517 = (u64)((u64)t__2e517 & (u64)((u64)18446744073709550592UL));
+	t__2e514 = (u64)((u64)t__2e515 - (u64)t__2e517);
+	t__2e519 = (u64)(*(u64 *)t_param_2e454);
+	t__2e518 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_rem64)))((u64)t__2e519, (u64)((u64)1024UL)));
+	t__2e513 = (u64)(u32)(((u64)t__2e514 == (u64)t__2e518));
+	t__2e503 = (u64)(u32)t__2e513;
+	goto L__2e505;
+	L__2e505:;
+	if ((u32)t__2e503) goto L_passed_2e502; else goto L_failed_2e501;
+	L_failed_2e501:;
+	t_abortsite_2e479 = ((u64)2UL);
+	goto L_abort_2e480;
+	L_passed_2e502:;
+	t__2e527 = (u64)(*(u64 *)t_param_2e454);
+	t__2e528 = (u64)(-(u64)((u64)1024UL));
+	t__2e529 = (u64)((i64)t__2e527 >> (((u64)63UL) & 63));
+	t__2e529 = (u64)((u64)t__2e529 >> (((u64)54UL) & 63));
+	t__2e530 = (u64)((u64)t__2e527 + (u64)t__2e529);
+	t__2e526 = (u64)((i64)t__2e530 >> (((u64)10UL) & 63));
+	t__2e526 = (u64)(-(u64)t__2e526);
+	t__2e532 = (u64)(*(u64 *)t_param_2e454);
+	t__2e533 = (u64)(-(u64)((u64)1024UL));
+	t__2e531 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_div64)))((u64)t__2e532, (u64)t__2e533));
+	t__2e525 = (u64)(u32)(((u64)t__2e526 == (u64)t__2e531));
+	t__2e522 = (u64)(u32)t__2e525;
+	if ((u32)t__2e522) goto L__2e523; else goto L__2e524;
+	L__2e523:;
+	t__2e536 = (u64)(*(u64 *)t_param_2e454);
+	t__2e537 = (u64)(-(u64)((u64)1024UL));
+	t__2e538 = (u64)((i64)t__2e536 >> (((u64)63UL) & 63));
+	t__2e538 = (u64)((u64)t__2e538 >> (((u64)54UL) & 63));
+	t__2e539 = (u64)((u64)t__2e536 + (u64)t__2e538);
+	t__2e539 = (u64)((u64)t__2e539 & (u64)((u64)18446744073709550592UL));
+	t__2e535 = (u64)((u64)t__2e536 - (u64)t__2e539);
+	t__2e541 = (u64)(*(u64 *)t_param_2e454);
+	t__2e542 = (u64)(-(u64)((u64)1024UL));
+	t__2e540 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_rem64)))((u64)t__2e541, (u64)t__2e542));
+	t__2e534 = (u64)(u32)(((u64)t__2e535 == (u64)t__2e540));
+	t__2e522 = (u64)(u32)t__2e534;
+	goto L__2e524;
+	L__2e524:;
+	if ((u32)t__2e522) goto L_passed_2e521; else goto L_failed_2e520;
+	L_failed_2e520:;
+	t_abortsite_2e479 = ((u64)3UL);
+	goto L_abort_2e480;
+	L_passed_2e521:;
+	t__2e547 = (u64)(*(u64 *)t_param_2e454);
+	t__2e548 = (u64)((i64)t__2e547 >> (((u64)63UL) & 63));
+	t__2e548 = (u64)((u64)t__2e548 >> (((u64)2UL) & 63));
+	t__2e549 = (u64)((u64)t__2e547 + (u64)t__2e548);
+	t__2e546 = (u64)((i64)t__2e549 >> (((u64)62UL) & 63));
+	t__2e551 = (u64)(*(u64 *)t_param_2e454);
+	t__2e550 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_div64)))((u64)t__2e551, (u64)((u64)4611686018427387904UL)));
+	t__2e545 = (u64)(u32)(((u64)t__2e546 == (u64)t__2e550));
+	if ((u32)t__2e545) goto L_passed_2e544; else goto L_failed_2e543;
+	L_failed_2e543:;
+	t_abortsite_2e479 = ((u64)4UL);
+	goto L_abort_2e480;
+	L_passed_2e544:;
+	t__2e556 = (u64)(*(u64 *)t_param_2e454);
+	t__2e557 = (u64)((i64)t__2e556 >> (((u64)63UL) & 63));
+	t__2e557 = (u64)((u64)t__2e557 >> (((u64)2UL) & 63));
+	t__2e558 = (u64)((u64)t__2e556 + (u64)t__2e557);
+	t__2e558 = (u64)((u64)t__2e558 & (u64)((u64)13835058055282163712UL));
+	t__2e555 = (u64)((u64)t__2e556 - (u64)t__2e558);
+	t__2e560 = (u64)(*(u64 *)t_param_2e454);
+	t__2e559 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_rem64)))((u64)t__2e560, (u64)((u64)4611686018427387904UL)));
+	t__2e554 = (u64)(u32)(((u64)t__2e555 == (u64)t__2e559));
+	if ((u32)t__2e554) goto L_passed_2e553; else goto L_failed_2e552;
+	L_failed_2e552:;
+	t_abortsite_2e479 = ((u64)5UL);
+	goto L_abort_2e480;
+	L_passed_2e553:;
+	t__2e568 = (u64)(*(u64 *)t_param_2e455);
+	t__2e567 = (u64)((u64)t__2e568 >> (((u64)1UL) & 63));
+	t__2e570 = (u64)(*(u64 *)t_param_2e455);
+	t__2e569 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_udiv64)))((u64)t__2e570, (u64)((u64)2UL)));
+	t__2e566 = (u64)(u32)(((u64)t__2e567 == (u64)t__2e569));
+	t__2e563 = (u64)(u32)t__2e566;
+	if ((u32)t__2e563) goto L__2e564; else goto L__2e565;
+	L__2e564:;
+	t__2e573 = (u64)(*(u64 *)t_param_2e455);
+	t__2e572 = (u64)((u64)t__2e573 & (u64)((u64)1UL));
+	t__2e575 = (u64)(*(u64 *)t_param_2e455);
+	t__2e574 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_urem64)))((u64)t__2e575, (u64)((u64)2UL)));
+	t__2e571 = (u64)(u32)(((u64)t__2e572 == (u64)t__2e574));
+	t__2e563 = (u64)(u32)t__2e571;
+	goto L__2e565;
+	L__2e565:;
+	if ((u32)t__2e563) goto L_passed_2e562; else goto L_failed_2e561;
+	L_failed_2e561:;
+	t_abortsite_2e479 = ((u64)6UL);
+	goto L_abort_2e480;
+	L_passed_2e562:;
+	t__2e583 = (u64)(*(u64 *)t_param_2e455);
+	t__2e582 = (u64)((u64)t__2e583 / (u64)((u64)7UL));
+	t__2e585 = (u64)(*(u64 *)t_param_2e455);
+	t__2e584 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_udiv64)))((u64)t__2e585, (u64)((u64)7UL)));
+	t__2e581 = (u64)(u32)(((u64)t__2e582 == (u64)t__2e584));
+	t__2e578 = (u64)(u32)t__2e581;
+	if ((u32)t__2e578) goto L__2e579; else goto L__2e580;
+	L__2e579:;
+	t__2e588 = (u64)(*(u64 *)t_param_2e455);
+	t__2e587 = (u64)((u64)t__2e588 % (u64)((u64)7UL));
+	t__2e590 = (u64)(*(u64 *)t_param_2e455);
+	t__2e589 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_urem64)))((u64)t__2e590, (u64)((u64)7UL)));
+	t__2e586 = (u64)(u32)(((u64)t__2e587 == (u64)t__2e589));
+	t__2e578 = (u64)(u32)t__2e586;
+	goto L__2e580;
+	L__2e580:;
+	if ((u32)t__2e578) goto L_passed_2e577; else goto L_failed_2e576;
+	L_failed_2e576:;
+	t_abortsite_2e479 = ((u64)7UL);
+	goto L_abort_2e480;
+	L_passed_2e577:;
+	t__2e598 = (u64)(*(u64 *)t_param_2e455);
+	t__2e597 = (u64)((u64)t__2e598 >> (((u64)12UL) & 63));
+	t__2e600 = (u64)(*(u64 *)t_param_2e455);
+	t__2e599 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_udiv64)))((u64)t__2e600, (u64)((u64)4096UL)));
+	t__2e596 = (u64)(u32)(((u64)t__2e597 == (u64)t__2e599));
+	t__2e593 = (u64)(u32)t__2e596;
+	if ((u32)t__2e593) goto L__2e594; else goto L__2e595;
+	L__2e594:;
+	t__2e603 = (u64)(*(u64 *)t_param_2e455);
+	t__2e602 = (u64)((u64)t__2e603 & (u64)((u64)4095UL));
+	t__2e605 = (u64)(*(u64 *)t_param_2e455);
+	t__2e604 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_urem64)))((u64)t__2e605, (u64)((u64)4096UL)));
+	t__2e601 = (u64)(u32)(((u64)t__2e602 == (u64)t__2e604));
+	t__2e593 = (u64)(u32)t__2e601;
+	goto L__2e595;
+	L__2e595:;
+	if ((u32)t__2e593) goto L_passed_2e592; else goto L_failed_2e591;
+	L_failed_2e591:;
+	t_abortsite_2e479 = ((u64)8UL);
+	goto L_abort_2e480;
+	L_passed_2e592:;
+	t__2e610 = (u64)(*(u64 *)t_param_2e455);
+	t__2e609 = (u64)((u64)t__2e610 >> (((u64)63UL) & 63));
+	t__2e612 = (u64)(*(u64 *)t_param_2e455);
+	t__2e611 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_udiv64)))((u64)t__2e612, (u64)((u64)9223372036854775808UL)));
+	t__2e608 = (u64)(u32)(((u64)t__2e609 == (u64)t__2e611));
+	if ((u32)t__2e608) goto L_passed_2e607; else goto L_failed_2e606;
+	L_failed_2e606:;
+	t_abortsite_2e479 = ((u64)9UL);
+	goto L_abort_2e480;
+	L_passed_2e607:;
+	t__2e617 = (u64)(*(u64 *)t_param_2e455);
+	t__2e616 = (u64)((u64)t__2e617 & (u64)((u64)9223372036854775807UL));
+	t__2e619 = (u64)(*(u64 *)t_param_2e455);
+	t__2e618 = (u64)(((u64 (*)(u64, u64))((u64)((char *)&F_urem64)))((u64)t__2e619, (u64)((u64)9223372036854775808UL)));
+	t__2e615 = (u64)(u32)(((u64)t__2e616 == (u64)t__2e618));
+	if ((u32)t__2e615) goto L_passed_2e614; else goto L_failed_2e613;
+	L_failed_2e613:;
+	t_abortsite_2e479 = ((u64)10UL);
+	goto L_abort_2e480;
+	L_passed_2e614:;
+	t__2e627 = (u64)(*(u64 *)t_param_2e454);
+	t__2e626 = (u64)((u64)t__2e627 << (((u64)10UL) & 63));
+	t__2e629 = (u64)(*(u64 *)t_param_2e454);
+	t__2e628 = (u64)((u64)t__2e629 << (((u64)10UL) & 63));
+	t__2e625 = (u64)(u32)(((u64)t__2e626 == (u64)t__2e628));
+	t__2e622 = (u64)(u32)t__2e625;
+	if ((u32)t__2e622) goto L__2e623; else goto L__2e624;
+	L__2e623:;
+	t__2e632 = (u64)(*(u64 *)t_param_2e455);
+	t__2e631 = (u64)((u64)t__2e632 << (((u64)1UL) & 63));
+	t__2e634 = (u64)(*(u64 *)t_param_2e455);
+	t__2e633 = (u64)((u64)t__2e634 << (((u64)1UL) & 63));
+	t__2e630 = (u64)(u32)(((u64)t__2e631 == (u64)t__2e633));
+	t__2e622 = (u64)(u32)t__2e630;
+	goto L__2e624;
+	L__2e624:;
+	if ((u32)t__2e622) goto L_passed_2e621; else goto L_failed_2e620;
+	L_failed_2e620:;
+	t_abortsite_2e479 = ((u64)11UL);
+	goto L_abort_2e480;
+	L_passed_2e621:;
+	goto L__2e457;
+	L__2e635:;
+	L__2e457:;
+	return;
+	L_abort_2e480:;
+	t__2e481 = (u64)((u64)t_abortsite_2e479 * (u64)((u64)16UL));
+	t__2e481 = (u64)((u64)((u64)((char *)&D_abortsites_2e478)) + (u64)t__2e481);
+	t__2e482 = (u64)(*(u64 *)t__2e481);
+	t__2e483 = (u64)((u64)t__2e481 + (u64)((u64)8UL));
+	t__2e484 = (u64)(*(u32 *)t__2e483);
+	t__2e483 = (u64)((u64)t__2e481 + (u64)((u64)12UL));
+	t__2e485 = (u64)(*(u32 *)t__2e483);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e482, (u64)t__2e484, (u64)t__2e485, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u64 F_urem64(u64 p_x, u64 p_y) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e640;
+	u64 t__2e641;
+	u64 t__2e642;
+	u64 t_param_2e637;
+	u64 t_param_2e638;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e636:;
+	t_param_2e637 = (u64)A0;
+	t_param_2e638 = (u64)A1;
+	*(u64 *)t_param_2e637 = (u64)t_x;
+	*(u64 *)t_param_2e638 = (u64)t_y;
+	L_body_2e639:;
+	t__2e641 = (u64)(*(u64 *)t_param_2e637);
+	t__2e642 = (u64)(*(u64 *)t_param_2e638);
+	t__2e640 = (u64)((u64)t__2e641 % (u64)t__2e642);
+	return (u64)t__2e640;
+}
+static u64 F_udiv64(u64 p_x, u64 p_y) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e647;
+	u64 t__2e648;
+	u64 t__2e649;
+	u64 t_param_2e644;
+	u64 t_param_2e645;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e643:;
+	t_param_2e644 = (u64)A0;
+	t_param_2e645 = (u64)A1;
+	*(u64 *)t_param_2e644 = (u64)t_x;
+	*(u64 *)t_param_2e645 = (u64)t_y;
+	L_body_2e646:;
+	t__2e648 = (u64)(*(u64 *)t_param_2e644);
+	t__2e649 = (u64)(*(u64 *)t_param_2e645);
+	t__2e647 = (u64)((u64)t__2e648 / (u64)t__2e649);
+	return (u64)t__2e647;
+}
+static u64 F_rem64(u64 p_x, u64 p_y) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e654;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t_param_2e651;
+	u64 t_param_2e652;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e650:;
+	t_param_2e651 = (u64)A0;
+	t_param_2e652 = (u64)A1;
+	*(u64 *)t_param_2e651 = (u64)t_x;
+	*(u64 *)t_param_2e652 = (u64)t_y;
+	L_body_2e653:;
+	t__2e655 = (u64)(*(u64 *)t_param_2e651);
+	t__2e656 = (u64)(*(u64 *)t_param_2e652);
+	t__2e654 = (u64)((i64)t__2e655 % (i64)t__2e656);
+	return (u64)t__2e654;
+}
+static u64 F_div64(u64 p_x, u64 p_y) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e661;
+	u64 t__2e662;
+	u64 t__2e663;
+	u64 t_param_2e658;
+	u64 t_param_2e659;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e657:;
+	t_param_2e658 = (u64)A0;
+	t_param_2e659 = (u64)A1;
+	*(u64 *)t_param_2e658 = (u64)t_x;
+	*(u64 *)t_param_2e659 = (u64)t_y;
+	L_body_2e660:;
+	t__2e662 = (u64)(*(u64 *)t_param_2e658);
+	t__2e663 = (u64)(*(u64 *)t_param_2e659);
+	t__2e661 = (u64)((i64)t__2e662 / (i64)t__2e663);
+	return (u64)t__2e661;
+}
+static void F_checku32(u32 p_x) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e671;
+	u64 t__2e674;
+	u64 t__2e675;
+	u64 t__2e676;
+	u64 t__2e677;
+	u64 t__2e678;
+	u64 t__2e679;
+	u64 t__2e680;
+	u64 t__2e681;
+	u64 t__2e682;
+	u64 t__2e683;
+	u64 t__2e687;
+	u64 t__2e688;
+	u64 t__2e689;
+	u64 t__2e690;
+	u64 t__2e691;
+	u64 t__2e694;
+	u64 t__2e697;
+	u64 t__2e698;
+	u64 t__2e699;
+	u64 t__2e700;
+	u64 t__2e701;
+	u64 t__2e702;
+	u64 t__2e703;
+	u64 t__2e704;
+	u64 t__2e705;
+	u64 t__2e706;
+	u64 t__2e707;
+	u64 t__2e708;
+	u64 t__2e709;
+	u64 t__2e710;
+	u64 t__2e711;
+	u64 t__2e712;
+	u64 t__2e715;
+	u64 t__2e718;
+	u64 t__2e719;
+	u64 t__2e720;
+	u64 t__2e721;
+	u64 t__2e722;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e725;
+	u64 t__2e726;
+	u64 t__2e727;
+	u64 t__2e728;
+	u64 t__2e729;
+	u64 t__2e730;
+	u64 t__2e731;
+	u64 t__2e732;
+	u64 t__2e733;
+	u64 t__2e736;
+	u64 t__2e739;
+	u64 t__2e740;
+	u64 t__2e741;
+	u64 t__2e742;
+	u64 t__2e743;
+	u64 t__2e744;
+	u64 t__2e745;
+	u64 t__2e746;
+	u64 t__2e747;
+	u64 t__2e748;
+	u64 t__2e749;
+	u64 t__2e750;
+	u64 t__2e751;
+	u64 t__2e752;
+	u64 t__2e753;
+	u64 t__2e754;
+	u64 t__2e757;
+	u64 t__2e760;
+	u64 t__2e761;
+	u64 t__2e762;
+	u64 t__2e763;
+	u64 t__2e764;
+	u64 t__2e765;
+	u64 t__2e766;
+	u64 t__2e767;
+	u64 t__2e768;
+	u64 t__2e769;
+	u64 t__2e772;
+	u64 t__2e775;
+	u64 t__2e776;
+	u64 t__2e777;
+	u64 t__2e778;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e781;
+	u64 t__2e782;
+	u64 t__2e783;
+	u64 t__2e784;
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e787;
+	u64 t__2e788;
+	u64 t__2e789;
+	u64 t__2e790;
+	u64 t__2e793;
+	u64 t__2e796;
+	u64 t__2e797;
+	u64 t__2e798;
+	u64 t__2e799;
+	u64 t__2e800;
+	u64 t__2e801;
+	u64 t__2e802;
+	u64 t__2e803;
+	u64 t__2e804;
+	u64 t__2e805;
+	u64 t__2e806;
+	u64 t__2e807;
+	u64 t__2e808;
+	u64 t__2e809;
+	u64 t__2e810;
+	u64 t__2e811;
+	u64 t__2e814;
+	u64 t__2e815;
+	u64 t__2e816;
+	u64 t__2e817;
+	u64 t__2e818;
+	u64 t__2e819;
+	u64 t__2e820;
+	u64 t__2e821;
+	u64 t__2e824;
+	u64 t__2e825;
+	u64 t__2e826;
+	u64 t__2e827;
+	u64 t__2e828;
+	u64 t__2e829;
+	u64 t__2e830;
+	u64 t__2e831;
+	u64 t__2e834;
+	u64 t__2e835;
+	u64 t__2e836;
+	u64 t__2e837;
+	u64 t__2e838;
+	u64 t__2e839;
+	u64 t__2e840;
+	u64 t__2e841;
+	u64 t__2e844;
+	u64 t__2e845;
+	u64 t__2e846;
+	u64 t__2e847;
+	u64 t__2e848;
+	u64 t__2e849;
+	u64 t__2e850;
+	u64 t__2e851;
+	u64 t__2e854;
+	u64 t__2e855;
+	u64 t__2e856;
+	u64 t__2e857;
+	u64 t__2e858;
+	u64 t__2e860;
+	u64 t__2e861;
+	u64 t__2e862;
+	u64 t__2e863;
+	u64 t__2e864;
+	u64 t__2e867;
+	u64 t__2e868;
+	u64 t__2e869;
+	u64 t__2e870;
+	u64 t_abortsite_2e685;
+	u64 t_binding_2e859;
+	u64 t_param_2e665;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e664:;
+	t_param_2e665 = (u64)A0;
+	t_binding_2e859 = (u64)A1;
+	*(u32 *)t_param_2e665 = (u32)t_x;
+	L_body_2e666:;
+	t__2e676 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e675 = (u64)(u32)((u32)t__2e676 >> (((u64)1UL) & 31));
+	t__2e678 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e677 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv32)))((u32)t__2e678, (u32)((u64)2UL)));
+	t__2e674 = (u64)(u32)(((u32)t__2e675 == (u32)t__2e677));
+	t__2e671 = (u64)(u32)t__2e674;
+	if ((u32)t__2e671) goto L__2e672; else goto L__2e673;
+	L__2e672:;
+	t__2e681 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e680 = (u64)(u32)((u32)t__2e681 & (u32)((u64)1UL));
+	t__2e683 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e682 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem32)))((u32)t__2e683, (u32)((u64)2UL)));
+	t__2e679 = (u64)(u32)(((u32)t__2e680 == (u32)t__2e682));
+	t__2e671 = (u64)(u32)t__2e679;
+	goto L__2e673;
+	L__2e673:;
+	if ((u32)t__2e671) goto L_passed_2e670; else goto L_failed_2e669;
+	L_failed_2e669:;
+	t_abortsite_2e685 = ((u64)0UL);
+	goto L_abort_2e686;
+	L_passed_2e670:;
+	t__2e699 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e700 = (u64)((u32)t__2e699);
+	t__2e701 = (u64)((u64)t__2e700 * (u64)((u64)2863311531UL));
+	t__2e702 = (u64)((u64)t__2e701 >> (((u64)33UL) & 63));
+	t__2e698 = (u64)(u32)t__2e702;
+	t__2e704 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e703 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv32)))((u32)t__2e704, (u32)((u64)3UL)));
+	t__2e697 = (u64)(u32)(((u32)t__2e698 == (u32)t__2e703));
+	t__2e694 = (u64)(u32)t__2e697;
+	if ((u32)t__2e694) goto L__2e695; else goto L__2e696;
+	L__2e695:;
+	t__2e707 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e708 = (u64)((u32)t__2e707);
+	t__2e709 = (u64)((u64)t__2e708 * (u64)((u64)2863311531UL));
+	t__2e710 = (u64)((u64)t__2e709 >> (((u64)33UL) & 63));
+	t__2e710 = (u64)((u64)t__2e710 * (u64)((u64)3UL));
+	t__2e710 = (u64)((u64)t__2e708 - (u64)t__2e710);
+	t__2e706 = (u64)(u32)t__2e710;
+	t__2e712 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e711 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem32)))((u32)t__2e712, (u32)((u64)3UL)));
+	t__2e705 = (u64)(u32)(((u32)t__2e706 == (u32)t__2e711));
+	t__2e694 = (u64)(u32)t__2e705;
+	goto L__2e696;
+	L__2e696:;
+	if ((u32)t__2e694) goto L_passed_2e693; else goto L_failed_2e692;
+	L_failed_2e692:;
+	t_abortsite_2e685 = ((u64)1UL);
+	goto L_abort_2e686;
+	L_passed_2e693:;
+	t__2e720 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e721 = (u64)((u32)t__2e720);
+	t__2e722 = (u64)((u64)t__2e721 * (u64)((u64)613566757UL));
+	t__2e722 = (u64)((u64)t__2e722 >> (((u64)32UL) & 63));
+	t__2e722 = (u64)((u64)t__2e721 + (u64)t__2e722);
+	t__2e723 = (u64)((u64)t__2e722 >> (((u64)3UL) & 63));
+	t__2e719 = (u64)(u32)t__2e723;
+	t__2e725 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e724 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv32)))((u32)t__2e725, (u32)((u64)7UL)));
+	t__2e718 = (u64)(u32)(((u32)t__2e719 == (u32)t__2e724));
+	t__2e715 = (u64)(u32)t__2e718;
+	if ((u32)t__2e715) goto L__2e716; else goto L__2e717;
+	L__2e716:;
+	t__2e728 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e729 = (u64)((u32)t__2e728);
+	t__2e730 = (u64)((u64)t__2e729 * (u64)((u64)613566757UL));
+	t__2e730 = (u64)((u64)t__2e730 >> (((u64)32UL) & 63));
+	t__2e730 = (u64)((u64)t__2e729 + (u64)t__2e730);
+	t__2e731 = (u64)((u64)t__2e730 >> (((u64)3UL) & 63));
+	t__2e731 = (u64)((u64)t__2e731 * (u64)((u64)7UL));
+	t__2e731 = (u64)((u64)t__2e729 - (u64)t__2e731);
+	t__2e727 = (u64)(u32)t__2e731;
+	t__2e733 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e732 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem32)))((u32)t__2e733, (u32)((u64)7UL)));
+	t__2e726 = (u64)(u32)(((u32)t__2e727 == (u32)t__2e732));
+	t__2e715 = (u64)(u32)t__2e726;
+	goto L__2e717;
+	L__2e717:;
+	if ((u32)t__2e715) goto L_passed_2e714; else goto L_failed_2e713;
+	L_failed_2e713:;
+	t_abortsite_2e685 = ((u64)2UL);
+	goto L_abort_2e686;
+	L_passed_2e714:;
+	t__2e741 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e742 = (u64)((u32)t__2e741);
+	t__2e743 = (u64)((u64)t__2e742 * (u64)((u64)3435973837UL));
+	t__2e744 = (u64)((u64)t__2e743 >> (((u64)35UL) & 63));
+	t__2e740 = (u64)(u32)t__2e744;
+	t__2e746 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e745 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv32)))((u32)t__2e746, (u32)((u64)10UL)));
+	t__2e739 = (u64)(u32)(((u32)t__2e740 == (u32)t__2e745));
+	t__2e736 = (u64)(u32)t__2e739;
+	if ((u32)t__2e736) goto L__2e737; else goto L__2e738;
+	L__2e737:;
+	t__2e749 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e750 = (u64)((u32)t__2e749);
+	t__2e751 = (u64)((u64)t__2e750 * (u64)((u64)3435973837UL));
+	t__2e752 = (u64)((u64)t__2e751 >> (((u64)35UL) & 63));
+	t__2e752 = (u64)((u64)t__2e752 * (u64)((u64)10UL));
+	t__2e752 = (u64)((u64)t__2e750 - (u64)t__2e752);
+	t__2e748 = (u64)(u32)t__2e752;
+	t__2e754 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e753 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem32)))((u32)t__2e754, (u32)((u64)10UL)));
+	t__2e747 = (u64)(u32)(((u32)t__2e748 == (u32)t__2e753));
+	t__2e736 = (u64)(u32)t__2e747;
+	goto L__2e738;
+	L__2e738:;
+	if ((u32)t__2e736) goto L_passed_2e735; else goto L_failed_2e734;
+	L_failed_2e734:;
+	t_abortsite_2e685 = ((u64)3UL);
+	goto L_abort_2e686;
+	L_passed_2e735:;
+	t__2e762 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e761 = (u64)(u32)((u32)t__2e762 >> (((u64)4UL) & 31));
+	t__2e764 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e763 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv32)))((u32)t__2e764, (u32)((u64)16UL)));
+	t__2e760 = (u64)(u32)(((u32)t__2e761 == (u32)t__2e763));
+	t__2e757 = (u64)(u32)t__2e760;
+	if ((u32)t__2e757) goto L__2e758; else goto L__2e759;
+	L__2e758:;
+	t__2e767 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e766 = (u64)(u32)((u32)t__2e767 & (u32)((u64)15UL));
+	t__2e769 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e768 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem32)))((u32)t__2e769, (u32)((u64)16UL)));
+	t__2e765 = (u64)(u32)(((u32)t__2e766 == (u32)t__2e768));
+	t__2e757 = (u64)(u32)t__2e765;
+	goto L__2e759;
+	L__2e759:;
+	if ((u32)t__2e757) goto L_passed_2e756; else goto L_failed_2e755;
+	L_failed_2e755:;
+	t_abortsite_2e685 = ((u64)4UL);
+	goto L_abort_2e686;
+	L_passed_2e756:;
+	t__2e777 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e778 = (u64)((u32)t__2e777);
+	t__2e779 = (u64)((u64)t__2e778 * (u64)((u64)6700417UL));
+	t__2e780 = (u64)((u64)t__2e779 >> (((u64)32UL) & 63));
+	t__2e776 = (u64)(u32)t__2e780;
+	t__2e782 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e781 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv32)))((u32)t__2e782, (u32)((u64)641UL)));
+	t__2e775 = (u64)(u32)(((u32)t__2e776 == (u32)t__2e781));
+	t__2e772 = (u64)(u32)t__2e775;
+	if ((u32)t__2e772) goto L__2e773; else goto L__2e774;
+	L__2e773:;
+	t__2e785 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e786 = (u64)((u32)t__2e785);
+	t__2e787 = (u64)((u64)t__2e786 * (u64)((u64)6700417UL));
+	t__2e788 = (u64)((u64)t__2e787 >> (((u64)32UL) & 63));
+	t__2e788 = (u64)((u64)t__2e788 * (u64)((u64)641UL));
+	t__2e788 = (u64)((u64)t__2e786 - (u64)t__2e788);
+	t__2e784 = (u64)(u32)t__2e788;
+	t__2e790 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e789 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem32)))((u32)t__2e790, (u32)((u64)641UL)));
+	t__2e783 = (u64)(u32)(((u32)t__2e784 == (u32)t__2e789));
+	t__2e772 = (u64)(u32)t__2e783;
+	goto L__2e774;
+	L__2e774:;
+	if ((u32)t__2e772) goto L_passed_2e771; else goto L_failed_2e770;
+	L_failed_2e770:;
+	t_abortsite_2e685 = ((u64)5UL);
+	goto L_abort_2e686;
+	L_passed_2e771:;
+	t__2e798 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e799 = (u64)((u32)t__2e798);
+	t__2e800 = (u64)((u64)t__2e799 * (u64)((u64)274877907UL));
+	t__2e801 = (u64)((u64)t__2e800 >> (((u64)38UL) & 63));
+	t__2e797 = (u64)(u32)t__2e801;
+	t__2e803 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e802 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv32)))((u32)t__2e803, (u32)((u64)1000UL)));
+	t__2e796 = (u64)(u32)(((u32)t__2e797 == (u32)t__2e802));
+	t__2e793 = (u64)(u32)t__2e796;
+	if ((u32)t__2e793) goto L__2e794; else goto L__2e795;
+	L__2e794:;
+	t__2e806 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e807 = (u64)((u32)t__2e806);
+	t__2e808 = (u64)((u64)t__2e807 * (u64)((u64)274877907UL));
+	t__2e809 = (u64)((u64)t__2e808 >> (((u64)38UL) & 63));
+	t__2e809 = (u64)((u64)t__2e809 * (u64)((u64)1000UL));
+	t__2e809 = (u64)((u64)t__2e807 - (u64)t__2e809);
+	t__2e805 = (u64)(u32)t__2e809;
+	t__2e811 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e810 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem32)))((u32)t__2e811, (u32)((u64)1000UL)));
+	t__2e804 = (u64)(u32)(((u32)t__2e805 == (u32)t__2e810));
+	t__2e793 = (u64)(u32)t__2e804;
+	goto L__2e795;
+	L__2e795:;
+	if ((u32)t__2e793) goto L_passed_2e792; else goto L_failed_2e791;
+	L_failed_2e791:;
+	t_abortsite_2e685 = ((u64)6UL);
+	goto L_abort_2e686;
+	L_passed_2e792:;
+	t__2e816 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e817 = (u64)((u32)t__2e816);
+	t__2e818 = (u64)((u64)t__2e817 * (u64)((u64)3UL));
+	t__2e818 = (u64)((u64)t__2e818 >> (((u64)32UL) & 63));
+	t__2e818 = (u64)((u64)t__2e817 + (u64)t__2e818);
+	t__2e819 = (u64)((u64)t__2e818 >> (((u64)31UL) & 63));
+	t__2e815 = (u64)(u32)t__2e819;
+	t__2e821 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e820 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv32)))((u32)t__2e821, (u32)((u64)2147483647UL)));
+	t__2e814 = (u64)(u32)(((u32)t__2e815 == (u32)t__2e820));
+	if ((u32)t__2e814) goto L_passed_2e813; else goto L_failed_2e812;
+	L_failed_2e812:;
+	t_abortsite_2e685 = ((u64)7UL);
+	goto L_abort_2e686;
+	L_passed_2e813:;
+	t__2e826 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e827 = (u64)((u32)t__2e826);
+	t__2e828 = (u64)((u64)t__2e827 * (u64)((u64)4294967295UL));
+	t__2e829 = (u64)((u64)t__2e828 >> (((u64)63UL) & 63));
+	t__2e829 = (u64)((u64)t__2e829 * (u64)((u64)2147483649UL));
+	t__2e829 = (u64)((u64)t__2e827 - (u64)t__2e829);
+	t__2e825 = (u64)(u32)t__2e829;
+	t__2e831 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e830 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem32)))((u32)t__2e831, (u32)((u64)2147483649UL)));
+	t__2e824 = (u64)(u32)(((u32)t__2e825 == (u32)t__2e830));
+	if ((u32)t__2e824) goto L_passed_2e823; else goto L_failed_2e822;
+	L_failed_2e822:;
+	t_abortsite_2e685 = ((u64)8UL);
+	goto L_abort_2e686;
+	L_passed_2e823:;
+	t__2e836 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e837 = (u64)((u32)t__2e836);
+	t__2e838 = (u64)((u64)t__2e837 * (u64)((u64)2147483649UL));
+	t__2e839 = (u64)((u64)t__2e838 >> (((u64)63UL) & 63));
+	t__2e835 = (u64)(u32)t__2e839;
+	t__2e841 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e840 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_udiv32)))((u32)t__2e841, (u32)((u64)4294967295UL)));
+	t__2e834 = (u64)(u32)(((u32)t__2e835 == (u32)t__2e840));
+	if ((u32)t__2e834) goto L_passed_2e833; else goto L_failed_2e832;
+	L_failed_2e832:;
+	t_abortsite_2e685 = ((u64)9UL);
+	goto L_abort_2e686;
+	L_passed_2e833:;
+	t__2e846 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e847 = (u64)((u32)t__2e846);
+	t__2e848 = (u64)((u64)t__2e847 * (u64)((u64)2147483649UL));
+	t__2e849 = (u64)((u64)t__2e848 >> (((u64)63UL) & 63));
+	t__2e849 = (u64)((u64)t__2e849 * (u64)((u64)4294967295UL));
+	t__2e849 = (u64)((u64)t__2e847 - (u64)t__2e849);
+	t__2e845 = (u64)(u32)t__2e849;
+	t__2e851 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e850 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem32)))((u32)t__2e851, (u32)((u64)4294967295UL)));
+	t__2e844 = (u64)(u32)(((u32)t__2e845 == (u32)t__2e850));
+	if ((u32)t__2e844) goto L_passed_2e843; else goto L_failed_2e842;
+	L_failed_2e842:;
+	t_abortsite_2e685 = ((u64)10UL);
+	goto L_abort_2e686;
+	L_passed_2e843:;
+	t__2e856 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e855 = (u64)(u32)((u32)t__2e856 << (((u64)4UL) & 31));
+	t__2e858 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e857 = (u64)(u32)((u32)t__2e858 << (((u64)4UL) & 31));
+	t__2e854 = (u64)(u32)(((u32)t__2e855 == (u32)t__2e857));
+	if ((u32)t__2e854) goto L_passed_2e853; else goto L_failed_2e852;
+	L_failed_2e852:;
+	t_abortsite_2e685 = ((u64)11UL);
+	goto L_abort_2e686;
+	L_passed_2e853:;
+	t__2e860 = (u64)(u32)(*(u32 *)t_param_2e665);
+	*(u32 *)t_binding_2e859 = (u32)t__2e860;
+	t__2e861 = (u64)(u32)(*(u32 *)t_binding_2e859);
+	t__2e862 = (u64)((u32)t__2e861);
+	t__2e863 = (u64)((u64)t__2e862 * (u64)((u64)613566757UL));
+	t__2e863 = (u64)((u64)t__2e863 >> (((u64)32UL) & 63));
+	t__2e863 = (u64)((u64)t__2e862 + (u64)t__2e863);
+	t__2e864 = (u64)((u64)t__2e863 >> (((u64)3UL) & 63));
+	t__2e864 = (u64)((u64)t__2e864 * (u64)((u64)7UL));
+	t__2e864 = (u64)((u64)t__2e862 - (u64)t__2e864);
+	t__2e861 = (u64)(u32)t__2e864;
+	*(u32 *)t_binding_2e859 = (u32)t__2e861;
+	t__2e868 = (u64)(u32)(*(u32 *)t_binding_2e859);
+	t__2e870 = (u64)(u32)(*(u32 *)t_param_2e665);
+	t__2e869 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_urem32)))((u32)t__2e870, (u32)((u64)7UL)));
+	t__2e867 = (u64)(u32)(((u32)t__2e868 == (u32)t__2e869));
+	if ((u32)t__2e867) goto L_passed_2e866; else goto L_failed_2e865;
+	L_failed_2e865:;
+	t_abortsite_2e685 = ((u64)12UL);
+	goto L_abort_2e686;
+	L_passed_2e866:;
+	goto L__2e667;
+	L__2e871:;
+	L__2e667:;
+	return;
+	L_abort_2e686:;
+	t__2e687 = (u64)((u64)t_abortsite_2e685 * (u64)((u64)16UL));
+	t__2e687 = (u64)((u64)((u64)((char *)&D_abortsites_2e684)) + (u64)t__2e687);
+	t__2e688 = (u64)(*(u64 *)t__2e687);
+	t__2e689 = (u64)((u64)t__2e687 + (u64)((u64)8UL));
+	t__2e690 = (u64)(*(u32 *)t__2e689);
+	t__2e689 = (u64)((u64)t__2e687 + (u64)((u64)12UL));
+	t__2e691 = (u64)(*(u32 *)t__2e689);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e688, (u64)t__2e690, (u64)t__2e691, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_urem32(u32 p_x, u32 p_y) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e876;
+	u64 t__2e877;
+	u64 t__2e878;
+	u64 t_param_2e873;
+	u64 t_param_2e874;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e872:;
+	t_param_2e873 = (u64)A0;
+	t_param_2e874 = (u64)A1;
+	*(u32 *)t_param_2e873 = (u32)t_x;
+	*(u32 *)t_param_2e874 = (u32)t_y;
+	L_body_2e875:;
+	t__2e877 = (u64)(u32)(*(u32 *)t_param_2e873);
+	t__2e878 = (u64)(u32)(*(u32 *)t_param_2e874);
+	t__2e876 = (u64)(u32)((u32)t__2e877 % (u32)t__2e878);
+	return (u32)t__2e876;
+}
+static u32 F_udiv32(u32 p_x, u32 p_y) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e883;
+	u64 t__2e884;
+	u64 t__2e885;
+	u64 t_param_2e880;
+	u64 t_param_2e881;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e879:;
+	t_param_2e880 = (u64)A0;
+	t_param_2e881 = (u64)A1;
+	*(u32 *)t_param_2e880 = (u32)t_x;
+	*(u32 *)t_param_2e881 = (u32)t_y;
+	L_body_2e882:;
+	t__2e884 = (u64)(u32)(*(u32 *)t_param_2e880);
+	t__2e885 = (u64)(u32)(*(u32 *)t_param_2e881);
+	t__2e883 = (u64)(u32)((u32)t__2e884 / (u32)t__2e885);
+	return (u32)t__2e883;
+}
+static void F_check32(u32 p_x) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e1000;
+	u64 t__2e1001;
+	u64 t__2e1002;
+	u64 t__2e1003;
+	u64 t__2e1004;
+	u64 t__2e1005;
+	u64 t__2e1008;
+	u64 t__2e1011;
+	u64 t__2e1012;
+	u64 t__2e1013;
+	u64 t__2e1014;
+	u64 t__2e1015;
+	u64 t__2e1016;
+	u64 t__2e1017;
+	u64 t__2e1018;
+	u64 t__2e1019;
+	u64 t__2e1020;
+	u64 t__2e1021;
+	u64 t__2e1022;
+	u64 t__2e1023;
+	u64 t__2e1024;
+	u64 t__2e1025;
+	u64 t__2e1026;
+	u64 t__2e1027;
+	u64 t__2e1028;
+	u64 t__2e1031;
+	u64 t__2e1032;
+	u64 t__2e1033;
+	u64 t__2e1034;
+	u64 t__2e1035;
+	u64 t__2e1036;
+	u64 t__2e1037;
+	u64 t__2e1040;
+	u64 t__2e1041;
+	u64 t__2e1042;
+	u64 t__2e1043;
+	u64 t__2e1044;
+	u64 t__2e1045;
+	u64 t__2e1046;
+	u64 t__2e1049;
+	u64 t__2e1050;
+	u64 t__2e1051;
+	u64 t__2e1052;
+	u64 t__2e1053;
+	u64 t__2e1054;
+	u64 t__2e1055;
+	u64 t__2e1056;
+	u64 t__2e1057;
+	u64 t__2e1060;
+	u64 t__2e1061;
+	u64 t__2e1062;
+	u64 t__2e1063;
+	u64 t__2e1064;
+	u64 t__2e1065;
+	u64 t__2e1066;
+	u64 t__2e1067;
+	u64 t__2e1068;
+	u64 t__2e1071;
+	u64 t__2e1074;
+	u64 t__2e1075;
+	u64 t__2e1076;
+	u64 t__2e1077;
+	u64 t__2e1078;
+	u64 t__2e1079;
+	u64 t__2e1080;
+	u64 t__2e1081;
+	u64 t__2e1082;
+	u64 t__2e1083;
+	u64 t__2e1084;
+	u64 t__2e1085;
+	u64 t__2e1086;
+	u64 t__2e1087;
+	u64 t__2e1088;
+	u64 t__2e1089;
+	u64 t__2e1090;
+	u64 t__2e1091;
+	u64 t__2e1094;
+	u64 t__2e1097;
+	u64 t__2e1098;
+	u64 t__2e1099;
+	u64 t__2e1100;
+	u64 t__2e1101;
+	u64 t__2e1102;
+	u64 t__2e1103;
+	u64 t__2e1104;
+	u64 t__2e1105;
+	u64 t__2e1106;
+	u64 t__2e1107;
+	u64 t__2e1108;
+	u64 t__2e1109;
+	u64 t__2e1110;
+	u64 t__2e1111;
+	u64 t__2e1112;
+	u64 t__2e1113;
+	u64 t__2e1114;
+	u64 t__2e1115;
+	u64 t__2e1116;
+	u64 t__2e1117;
+	u64 t__2e1118;
+	u64 t__2e1121;
+	u64 t__2e1124;
+	u64 t__2e1125;
+	u64 t__2e1126;
+	u64 t__2e1127;
+	u64 t__2e1128;
+	u64 t__2e1129;
+	u64 t__2e1130;
+	u64 t__2e1131;
+	u64 t__2e1132;
+	u64 t__2e1133;
+	u64 t__2e1134;
+	u64 t__2e1135;
+	u64 t__2e1136;
+	u64 t__2e1137;
+	u64 t__2e1138;
+	u64 t__2e1139;
+	u64 t__2e1140;
+	u64 t__2e1141;
+	u64 t__2e1144;
+	u64 t__2e1147;
+	u64 t__2e1148;
+	u64 t__2e1149;
+	u64 t__2e1150;
+	u64 t__2e1151;
+	u64 t__2e1152;
+	u64 t__2e1153;
+	u64 t__2e1154;
+	u64 t__2e1155;
+	u64 t__2e1156;
+	u64 t__2e1157;
+	u64 t__2e1158;
+	u64 t__2e1159;
+	u64 t__2e1160;
+	u64 t__2e1161;
+	u64 t__2e1162;
+	u64 t__2e1163;
+	u64 t__2e1164;
+	u64 t__2e1165;
+	u64 t__2e1166;
+	u64 t__2e1167;
+	u64 t__2e1168;
+	u64 t__2e1171;
+	u64 t__2e1172;
+	u64 t__2e1173;
+	u64 t__2e1174;
+	u64 t__2e1175;
+	u64 t__2e1176;
+	u64 t__2e1177;
+	u64 t__2e1178;
+	u64 t__2e1179;
+	u64 t__2e1180;
+	u64 t__2e1181;
+	u64 t__2e1184;
+	u64 t__2e1185;
+	u64 t__2e1186;
+	u64 t__2e1187;
+	u64 t__2e1188;
+	u64 t__2e1189;
+	u64 t__2e1190;
+	u64 t__2e1193;
+	u64 t__2e1196;
+	u64 t__2e1197;
+	u64 t__2e1198;
+	u64 t__2e1199;
+	u64 t__2e1200;
+	u64 t__2e1201;
+	u64 t__2e1202;
+	u64 t__2e1203;
+	u64 t__2e1204;
+	u64 t__2e1205;
+	u64 t__2e1206;
+	u64 t__2e1207;
+	u64 t__2e1209;
+	u64 t__2e1210;
+	u64 t__2e1211;
+	u64 t__2e1212;
+	u64 t__2e1213;
+	u64 t__2e1214;
+	u64 t__2e1217;
+	u64 t__2e1218;
+	u64 t__2e1219;
+	u64 t__2e1220;
+	u64 t__2e1221;
+	u64 t__2e1222;
+	u64 t__2e1223;
+	u64 t__2e1224;
+	u64 t__2e1225;
+	u64 t__2e1228;
+	u64 t__2e1229;
+	u64 t__2e1230;
+	u64 t__2e1231;
+	u64 t__2e1232;
+	u64 t__2e893;
+	u64 t__2e896;
+	u64 t__2e897;
+	u64 t__2e898;
+	u64 t__2e899;
+	u64 t__2e900;
+	u64 t__2e901;
+	u64 t__2e902;
+	u64 t__2e903;
+	u64 t__2e904;
+	u64 t__2e905;
+	u64 t__2e906;
+	u64 t__2e907;
+	u64 t__2e908;
+	u64 t__2e909;
+	u64 t__2e913;
+	u64 t__2e914;
+	u64 t__2e915;
+	u64 t__2e916;
+	u64 t__2e917;
+	u64 t__2e920;
+	u64 t__2e923;
+	u64 t__2e924;
+	u64 t__2e925;
+	u64 t__2e926;
+	u64 t__2e927;
+	u64 t__2e928;
+	u64 t__2e929;
+	u64 t__2e930;
+	u64 t__2e931;
+	u64 t__2e932;
+	u64 t__2e933;
+	u64 t__2e934;
+	u64 t__2e935;
+	u64 t__2e936;
+	u64 t__2e937;
+	u64 t__2e938;
+	u64 t__2e939;
+	u64 t__2e940;
+	u64 t__2e943;
+	u64 t__2e946;
+	u64 t__2e947;
+	u64 t__2e948;
+	u64 t__2e949;
+	u64 t__2e950;
+	u64 t__2e951;
+	u64 t__2e952;
+	u64 t__2e953;
+	u64 t__2e954;
+	u64 t__2e955;
+	u64 t__2e956;
+	u64 t__2e957;
+	u64 t__2e958;
+	u64 t__2e959;
+	u64 t__2e960;
+	u64 t__2e961;
+	u64 t__2e962;
+	u64 t__2e963;
+	u64 t__2e966;
+	u64 t__2e969;
+	u64 t__2e970;
+	u64 t__2e971;
+	u64 t__2e972;
+	u64 t__2e973;
+	u64 t__2e974;
+	u64 t__2e975;
+	u64 t__2e976;
+	u64 t__2e977;
+	u64 t__2e978;
+	u64 t__2e979;
+	u64 t__2e980;
+	u64 t__2e981;
+	u64 t__2e982;
+	u64 t__2e985;
+	u64 t__2e988;
+	u64 t__2e989;
+	u64 t__2e990;
+	u64 t__2e991;
+	u64 t__2e992;
+	u64 t__2e993;
+	u64 t__2e994;
+	u64 t__2e995;
+	u64 t__2e996;
+	u64 t__2e997;
+	u64 t__2e998;
+	u64 t__2e999;
+	u64 t_abortsite_2e911;
+	u64 t_binding_2e1208;
+	u64 t_param_2e887;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e886:;
+	t_param_2e887 = (u64)A0;
+	t_binding_2e1208 = (u64)A1;
+	*(u32 *)t_param_2e887 = (u32)t_x;
+	L_body_2e888:;
+	t__2e898 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e899 = (u64)(u32)((i32)t__2e898 >> (((u64)31UL) & 31));
+	t__2e899 = (u64)(u32)((u32)t__2e899 >> (((u64)31UL) & 31));
+	t__2e900 = (u64)(u32)((u32)t__2e898 + (u32)t__2e899);
+	t__2e897 = (u64)(u32)((i32)t__2e900 >> (((u64)1UL) & 31));
+	t__2e902 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e901 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e902, (u32)((u64)2UL)));
+	t__2e896 = (u64)(u32)(((u32)t__2e897 == (u32)t__2e901));
+	t__2e893 = (u64)(u32)t__2e896;
+	if ((u32)t__2e893) goto L__2e894; else goto L__2e895;
+	L__2e894:;
+	t__2e905 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e906 = (u64)(u32)((i32)t__2e905 >> (((u64)31UL) & 31));
+	t__2e906 = (u64)(u32)((u32)t__2e906 >> (((u64)31UL) & 31));
+	t__2e907 = (u64)(u32)((u32)t__2e905 + (u32)t__2e906);
+	t__2e907 = (u64)(u32)((u32)t__2e907 & (u32)((u64)4294967294UL));
+	t__2e904 = (u64)(u32)((u32)t__2e905 - (u32)t__2e907);
+	t__2e909 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e908 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e909, (u32)((u64)2UL)));
+	t__2e903 = (u64)(u32)(((u32)t__2e904 == (u32)t__2e908));
+	t__2e893 = (u64)(u32)t__2e903;
+	goto L__2e895;
+	L__2e895:;
+	if ((u32)t__2e893) goto L_passed_2e892; else goto L_failed_2e891;
+	L_failed_2e891:;
+	t_abortsite_2e911 = ((u64)0UL);
+	goto L_abort_2e912;
+	L_passed_2e892:;
+	t__2e925 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e926 = (u64)((i64)(i32)t__2e925);
+	t__2e927 = (u64)((u64)t__2e926 * (u64)((u64)2863311531UL));
+	t__2e928 = (u64)((i64)t__2e927 >> (((u64)33UL) & 63));
+	t__2e929 = (u64)((u64)t__2e926 >> (((u64)63UL) & 63));
+	t__2e928 = (u64)((u64)t__2e928 + (u64)t__2e929);
+	t__2e924 = (u64)(u32)t__2e928;
+	t__2e931 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e930 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e931, (u32)((u64)3UL)));
+	t__2e923 = (u64)(u32)(((u32)t__2e924 == (u32)t__2e930));
+	t__2e920 = (u64)(u32)t__2e923;
+	if ((u32)t__2e920) goto L__2e921; else goto L__2e922;
+	L__2e921:;
+	t__2e934 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e935 = (u64)((i64)(i32)t__2e934);
+	t__2e936 = (u64)((u64)t__2e935 * (u64)((u64)2863311531UL));
+	t__2e937 = (u64)((i64)t__2e936 >> (((u64)33UL) & 63));
+	t__2e938 = (u64)((u64)t__2e935 >> (((u64)63UL) & 63));
+	t__2e937 = (u64)((u64)t__2e937 + (u64)t__2e938);
+	t__2e937 = (u64)((u64)t__2e937 * (u64)((u64)3UL));
+	t__2e937 = (u64)((u64)t__2e935 - (u64)t__2e937);
+	t__2e933 = (u64)(u32)t__2e937;
+	t__2e940 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e939 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e940, (u32)((u64)3UL)));
+	t__2e932 = (u64)(u32)(((u32)t__2e933 == (u32)t__2e939));
+	t__2e920 = (u64)(u32)t__2e932;
+	goto L__2e922;
+	L__2e922:;
+	if ((u32)t__2e920) goto L_passed_2e919; else goto L_failed_2e918;
+	L_failed_2e918:;
+	t_abortsite_2e911 = ((u64)1UL);
+	goto L_abort_2e912;
+	L_passed_2e919:;
+	t__2e948 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e949 = (u64)((i64)(i32)t__2e948);
+	t__2e950 = (u64)((u64)t__2e949 * (u64)((u64)2454267027UL));
+	t__2e951 = (u64)((i64)t__2e950 >> (((u64)34UL) & 63));
+	t__2e952 = (u64)((u64)t__2e949 >> (((u64)63UL) & 63));
+	t__2e951 = (u64)((u64)t__2e951 + (u64)t__2e952);
+	t__2e947 = (u64)(u32)t__2e951;
+	t__2e954 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e953 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e954, (u32)((u64)7UL)));
+	t__2e946 = (u64)(u32)(((u32)t__2e947 == (u32)t__2e953));
+	t__2e943 = (u64)(u32)t__2e946;
+	if ((u32)t__2e943) goto L__2e944; else goto L__2e945;
+	L__2e944:;
+	t__2e957 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e958 = (u64)((i64)(i32)t__2e957);
+	t__2e959 = (u64)((u64)t__2e958 * (u64)((u64)2454267027UL));
+	t__2e960 = (u64)((i64)t__2e959 >> (((u64)34UL) & 63));
+	t__2e961 = (u64)((u64)t__2e958 >> (((u64)63UL) & 63));
+	t__2e960 = (u64)((u64)t__2e960 + (u64)t__2e961);
+	t__2e960 = (u64)((u64)t__2e960 * (u64)((u64)7UL));
+	t__2e960 = (u64)((u64)t__2e958 - (u64)t__2e960);
+	t__2e956 = (u64)(u32)t__2e960;
+	t__2e963 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e962 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e963, (u32)((u64)7UL)));
+	t__2e955 = (u64)(u32)(((u32)t__2e956 == (u32)t__2e962));
+	t__2e943 = (u64)(u32)t__2e955;
+	goto L__2e945;
+	L__2e945:;
+	if ((u32)t__2e943) goto L_passed_2e942; else goto L_failed_2e941;
+	L_failed_2e941:;
+	t_abortsite_2e911 = ((u64)2UL);
+	goto L_abort_2e912;
+	L_passed_2e942:;
+	t__2e971 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e972 = (u64)(u32)((i32)t__2e971 >> (((u64)31UL) & 31));
+	t__2e972 = (u64)(u32)((u32)t__2e972 >> (((u64)29UL) & 31));
+	t__2e973 = (u64)(u32)((u32)t__2e971 + (u32)t__2e972);
+	t__2e970 = (u64)(u32)((i32)t__2e973 >> (((u64)3UL) & 31));
+	t__2e975 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e974 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e975, (u32)((u64)8UL)));
+	t__2e969 = (u64)(u32)(((u32)t__2e970 == (u32)t__2e974));
+	t__2e966 = (u64)(u32)t__2e969;
+	if ((u32)t__2e966) goto L__2e967; else goto L__2e968;
+	L__2e967:;
+	t__2e978 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e979 = (u64)(u32)((i32)t__2e978 >> (((u64)31UL) & 31));
+	t__2e979 = (u64)(u32)((u32)t__2e979 >> (((u64)29UL) & 31));
+	t__2e980 = (u64)(u32)((u32)t__2e978 + (u32)t__2e979);
+	t__2e980 = (u64)(u32)((u32)t__2e980 & (u32)((u64)4294967288UL));
+	t__2e977 = (u64)(u32)((u32)t__2e978 - (u32)t__2e980);
+	t__2e982 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e981 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e982, (u32)((u64)8UL)));
+	t__2e976 = (u64)(u32)(((u32)t__2e977 == (u32)t__2e981));
+	t__2e966 = (u64)(u32)t__2e976;
+	goto L__2e968;
+	L__2e968:;
+	if ((u32)t__2e966) goto L_passed_2e965; else goto L_failed_2e964;
+	L_failed_2e964:;
+	t_abortsite_2e911 = ((u64)3UL);
+	goto L_abort_2e912;
+	L_passed_2e965:;
+	t__2e990 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e991 = (u64)((i64)(i32)t__2e990);
+	t__2e992 = (u64)((u64)t__2e991 * (u64)((u64)1717986919UL));
+	t__2e993 = (u64)((i64)t__2e992 >> (((u64)34UL) & 63));
+	t__2e994 = (u64)((u64)t__2e991 >> (((u64)63UL) & 63));
+	t__2e993 = (u64)((u64)t__2e993 + (u64)t__2e994);
+	t__2e989 = (u64)(u32)t__2e993;
+	t__2e996 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e995 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e996, (u32)((u64)10UL)));
+	t__2e988 = (u64)(u32)(((u32)t__2e989 == (u32)t__2e995));
+	t__2e985 = (u64)(u32)t__2e988;
+	if ((u32)t__2e985) goto L__2e986; else goto L__2e987;
+	L__2e986:;
+	t__2e999 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1000 = (u64)((i64)(i32)t__2e999);
+	t__2e1001 = (u64)((u64)t__2e1000 * (u64)((u64)1717986919UL));
+	t__2e1002 = (u64)((i64)t__2e1001 >> (((u64)34UL) & 63));
+	t__2e1003 = (u64)((u64)t__2e1000 >> (((u64)63UL) & 63));
+	t__2e1002 = (u64)((u64)t__2e1002 + (u64)t__2e1003);
+	t__2e1002 = (u64)((u64)t__2e1002 * (u64)((u64)10UL));
+	t__2e1002 = (u64)((u64)t__2e1000 - (u64)t__2e1002);
+	t__2e998 = (u64)(u32)t__2e1002;
+	t__2e1005 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1004 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e1005, (u32)((u64)10UL)));
+	t__2e997 = (u64)(u32)(((u32)t__2e998 == (u32)t__2e1004));
+	t__2e985 = (u64)(u32)t__2e997;
+	goto L__2e987;
+	L__2e987:;
+	if ((u32)t__2e985) goto L_passed_2e984; else goto L_failed_2e983;
+	L_failed_2e983:;
+	t_abortsite_2e911 = ((u64)4UL);
+	goto L_abort_2e912;
+	L_passed_2e984:;
+	t__2e1013 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1014 = (u64)((i64)(i32)t__2e1013);
+	t__2e1015 = (u64)((u64)t__2e1014 * (u64)((u64)6700417UL));
+	t__2e1016 = (u64)((i64)t__2e1015 >> (((u64)32UL) & 63));
+	t__2e1017 = (u64)((u64)t__2e1014 >> (((u64)63UL) & 63));
+	t__2e1016 = (u64)((u64)t__2e1016 + (u64)t__2e1017);
+	t__2e1012 = (u64)(u32)t__2e1016;
+	t__2e1019 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1018 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e1019, (u32)((u64)641UL)));
+	t__2e1011 = (u64)(u32)(((u32)t__2e1012 == (u32)t__2e1018));
+	t__2e1008 = (u64)(u32)t__2e1011;
+	if ((u32)t__2e1008) goto L__2e1009; else goto L__2e1010;
+	L__2e1009:;
+	t__2e1022 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1023 = (u64)((i64)(i32)t__2e1022);
+	t__2e1024 = (u64)((u64)t__2e1023 * (u64)((u64)6700417UL));
+	t__2e1025 = (u64)((i64)t__2e1024 >> (((u64)32UL) & 63));
+	t__2e1026 = (u64)((u64)t__2e1023 >> (((u64)63UL) & 63));
+	t__2e1025 = (u64)((u64)t__2e1025 + (u64)t__2e1026);
+	t__2e1025 = (u64)((u64)t__2e1025 * (u64)((u64)641UL));
+	t__2e1025 = (u64)((u64)t__2e1023 - (u64)t__2e1025);
+	t__2e1021 = (u64)(u32)t__2e1025;
+	t__2e1028 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1027 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e1028, (u32)((u64)641UL)));
+	t__2e1020 = (u64)(u32)(((u32)t__2e1021 == (u32)t__2e1027));
+	t__2e1008 = (u64)(u32)t__2e1020;
+	goto L__2e1010;
+	L__2e1010:;
+	if ((u32)t__2e1008) goto L_passed_2e1007; else goto L_failed_2e1006;
+	L_failed_2e1006:;
+	t_abortsite_2e911 = ((u64)5UL);
+	goto L_abort_2e912;
+	L_passed_2e1007:;
+	t__2e1033 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1034 = (u64)(u32)((i32)t__2e1033 >> (((u64)31UL) & 31));
+	t__2e1034 = (u64)(u32)((u32)t__2e1034 >> (((u64)2UL) & 31));
+	t__2e1035 = (u64)(u32)((u32)t__2e1033 + (u32)t__2e1034);
+	t__2e1032 = (u64)(u32)((i32)t__2e1035 >> (((u64)30UL) & 31));
+	t__2e1037 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1036 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e1037, (u32)((u64)1073741824UL)));
+	t__2e1031 = (u64)(u32)(((u32)t__2e1032 == (u32)t__2e1036));
+	if ((u32)t__2e1031) goto L_passed_2e1030; else goto L_failed_2e1029;
+	L_failed_2e1029:;
+	t_abortsite_2e911 = ((u64)6UL);
+	goto L_abort_2e912;
+	L_passed_2e1030:;
+	t__2e1042 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1043 = (u64)(u32)((i32)t__2e1042 >> (((u64)31UL) & 31));
+	t__2e1043 = (u64)(u32)((u32)t__2e1043 >> (((u64)2UL) & 31));
+	t__2e1044 = (u64)(u32)((u32)t__2e1042 + (u32)t__2e1043);
+	t__2e1044 = (u64)(u32)((u32)t__2e1044 & (u32)((u64)3221225472UL));
+	t__2e1041 = (u64)(u32)((u32)t__2e1042 - (u32)t__2e1044);
+	t__2e1046 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1045 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e1046, (u32)((u64)1073741824UL)));
+	t__2e1040 = (u64)(u32)(((u32)t__2e1041 == (u32)t__2e1045));
+	if ((u32)t__2e1040) goto L_passed_2e1039; else goto L_failed_2e1038;
+	L_failed_2e1038:;
+	t_abortsite_2e911 = ((u64)7UL);
+	goto L_abort_2e912;
+	L_passed_2e1039:;
+	t__2e1051 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1052 = (u64)((i64)(i32)t__2e1051);
+	t__2e1053 = (u64)((u64)t__2e1052 * (u64)((u64)1073741825UL));
+	t__2e1054 = (u64)((i64)t__2e1053 >> (((u64)61UL) & 63));
+	t__2e1055 = (u64)((u64)t__2e1052 >> (((u64)63UL) & 63));
+	t__2e1054 = (u64)((u64)t__2e1054 + (u64)t__2e1055);
+	t__2e1050 = (u64)(u32)t__2e1054;
+	t__2e1057 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1056 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e1057, (u32)((u64)2147483647UL)));
+	t__2e1049 = (u64)(u32)(((u32)t__2e1050 == (u32)t__2e1056));
+	if ((u32)t__2e1049) goto L_passed_2e1048; else goto L_failed_2e1047;
+	L_failed_2e1047:;
+	t_abortsite_2e911 = ((u64)8UL);
+	goto L_abort_2e912;
+	L_passed_2e1048:;
+	t__2e1062 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1063 = (u64)((i64)(i32)t__2e1062);
+	t__2e1064 = (u64)((u64)t__2e1063 * (u64)((u64)1073741825UL));
+	t__2e1065 = (u64)((i64)t__2e1064 >> (((u64)61UL) & 63));
+	t__2e1066 = (u64)((u64)t__2e1063 >> (((u64)63UL) & 63));
+	t__2e1065 = (u64)((u64)t__2e1065 + (u64)t__2e1066);
+	t__2e1065 = (u64)((u64)t__2e1065 * (u64)((u64)2147483647UL));
+	t__2e1065 = (u64)((u64)t__2e1063 - (u64)t__2e1065);
+	t__2e1061 = (u64)(u32)t__2e1065;
+	t__2e1068 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1067 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e1068, (u32)((u64)2147483647UL)));
+	t__2e1060 = (u64)(u32)(((u32)t__2e1061 == (u32)t__2e1067));
+	if ((u32)t__2e1060) goto L_passed_2e1059; else goto L_failed_2e1058;
+	L_failed_2e1058:;
+	t_abortsite_2e911 = ((u64)9UL);
+	goto L_abort_2e912;
+	L_passed_2e1059:;
+	t__2e1076 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1077 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e1078 = (u64)(u32)((i32)t__2e1076 >> (((u64)31UL) & 31));
+	t__2e1078 = (u64)(u32)((u32)t__2e1078 >> (((u64)31UL) & 31));
+	t__2e1079 = (u64)(u32)((u32)t__2e1076 + (u32)t__2e1078);
+	t__2e1075 = (u64)(u32)((i32)t__2e1079 >> (((u64)1UL) & 31));
+	t__2e1075 = (u64)(u32)(-(u32)t__2e1075);
+	t__2e1081 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1082 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e1080 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e1081, (u32)t__2e1082));
+	t__2e1074 = (u64)(u32)(((u32)t__2e1075 == (u32)t__2e1080));
+	t__2e1071 = (u64)(u32)t__2e1074;
+	if ((u32)t__2e1071) goto L__2e1072; else goto L__2e1073;
+	L__2e1072:;
+	t__2e1085 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1086 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e1087 = (u64)(u32)((i32)t__2e1085 >> (((u64)31UL) & 31));
+	t__2e1087 = (u64)(u32)((u32)t__2e1087 >> (((u64)31UL) & 31));
+	t__2e1088 = (u64)(u32)((u32)t__2e1085 + (u32)t__2e1087);
+	t__2e1088 = (u64)(u32)((u32)t__2e1088 & (u32)((u64)4294967294UL));
+	t__2e1084 = (u64)(u32)((u32)t__2e1085 - (u32)t__2e1088);
+	t__2e1090 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1091 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e1089 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e1090, (u32)t__2e1091));
+	t__2e1083 = (u64)(u32)(((u32)t__2e1084 == (u32)t__2e1089));
+	t__2e1071 = (u64)(u32)t__2e1083;
+	goto L__2e1073;
+	L__2e1073:;
+	if ((u32)t__2e1071) goto L_passed_2e1070; else goto L_failed_2e1069;
+	L_failed_2e1069:;
+	t_abortsite_2e911 = ((u64)10UL);
+	goto L_abort_2e912;
+	L_passed_2e1070:;
+	t__2e1099 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1100 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e1101 = (u64)((i64)(i32)t__2e1099);
+	t__2e1102 = (u64)((u64)t__2e1101 * (u64)((u64)2863311531UL));
+	t__2e1103 = (u64)((i64)t__2e1102 >> (((u64)33UL) & 63));
+	t__2e1104 = (u64)((u64)t__2e1101 >> (((u64)63UL) & 63));
+	t__2e1103 = (u64)((u64)t__2e1103 + (u64)t__2e1104);
+	t__2e1103 = (u64)(-(u64)t__2e1103);
+	t__2e1098 = (u64)(u32)t__2e1103;
+	t__2e1106 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1107 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e1105 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e1106, (u32)t__2e1107));
+	t__2e1097 = (u64)(u32)(((u32)t__2e1098 == (u32)t__2e1105));
+	t__2e1094 = (u64)(u32)t__2e1097;
+	if ((u32)t__2e1094) goto L__2e1095; else goto L__2e1096;
+	L__2e1095:;
+	t__2e1110 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1111 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e1112 = (u64)((i64)(i32)t__2e1110);
+	t__2e1113 = (u64)((u64)t__2e1112 * (u64)((u64)2863311531UL));
+	t__2e1114 = (u64)((i64)t__2e1113 >> (((u64)33UL) & 63));
+	t__2e1115 = (u64)((u64)t__2e1112 >> (((u64)63UL) & 63));
+	t__2e1114 = (u64)((u64)t__2e1114 + (u64)t__2e1115);
+	t__2e1114 = (u64)((u64)t__2e1114 * (u64)((u64)3UL));
+	t__2e1114 = (u64)((u64)t__2e1112 - (u64)t__2e1114);
+	t__2e1109 = (u64)(u32)t__2e1114;
+	t__2e1117 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1118 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e1116 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e1117, (u32)t__2e1118));
+	t__2e1108 = (u64)(u32)(((u32)t__2e1109 == (u32)t__2e1116));
+	t__2e1094 = (u64)(u32)t__2e1108;
+	goto L__2e1096;
+	L__2e1096:;
+	if ((u32)t__2e1094) goto L_passed_2e1093; else goto L_failed_2e1092;
+	L_failed_2e1092:;
+	t_abortsite_2e911 = ((u64)11UL);
+	goto L_abort_2e912;
+	L_passed_2e1093:;
+	t__2e1126 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1127 = (u64)(u32)(-(u32)((u64)8UL));
+	t__2e1128 = (u64)(u32)((i32)t__2e1126 >> (((u64)31UL) & 31));
+	t__2e1128 = (u64)(u32)((u32)t__2e1128 >> (((u64)29UL) & 31));
+	t__2e1129 = (u64)(u32)((u32)t__2e1126 + (u32)t__2e1128);
+	t__2e1125 = (u64)(u32)((i32)t__2e1129 >> (((u64)3UL) & 31));
+	t__2e1125 = (u64)(u32)(-(u32)t__2e1125);
+	t__2e1131 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1132 = (u64)(u32)(-(u32)((u64)8UL));
+	t__2e1130 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e1131, (u32)t__2e1132));
+	t__2e1124 = (u64)(u32)(((u32)t__2e1125 == (u32)t__2e1130));
+	t__2e1121 = (u64)(u32)t__2e1124;
+	if ((u32)t__2e1121) goto L__2e1122; else goto L__2e1123;
+	L__2e1122:;
+	t__2e1135 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1136 = (u64)(u32)(-(u32)((u64)8UL));
+	t__2e1137 = (u64)(u32)((i32)t__2e1135 >> (((u64)31UL) & 31));
+	t__2e1137 = (u64)(u32)((u32)t__2e1137 >> (((u64)29UL) & 31));
+	t__2e1138 = (u64)(u32)((u32)t__2e1135 + (u32)t__2e1137);
+	t__2e1138 = (u64)(u32)((u32)t__2e1138 & (u32)((u64)4294967288UL));
+	t__2e1134 = (u64)(u32)((u32)t__2e1135 - (u32)t__2e1138);
+	t__2e1140 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1141 = (u64)(u32)(-(u32)((u64)8UL));
+	t__2e1139 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e1140, (u32)t__2e1141));
+	t__2e1133 = (u64)(u32)(((u32)t__2e1134 == (u32)t__2e1139));
+	t__2e1121 = (u64)(u32)t__2e1133;
+	goto L__2e1123;
+	L__2e1123:;
+	if ((u32)t__2e1121) goto L_passed_2e1120; else goto L_failed_2e1119;
+	L_failed_2e1119:;
+	t_abortsite_2e911 = ((u64)12UL);
+	goto L_abort_2e912;
+	L_passed_2e1120:;
+	t__2e1149 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1150 = (u64)(u32)(-(u32)((u64)10UL));
+	t__2e1151 = (u64)((i64)(i32)t__2e1149);
+	t__2e1152 = (u64)((u64)t__2e1151 * (u64)((u64)1717986919UL));
+	t__2e1153 = (u64)((i64)t__2e1152 >> (((u64)34UL) & 63));
+	t__2e1154 = (u64)((u64)t__2e1151 >> (((u64)63UL) & 63));
+	t__2e1153 = (u64)((u64)t__2e1153 + (u64)t__2e1154);
+	t__2e1153 = (u64)(-(u64)t__2e1153);
+	t__2e1148 = (u64)(u32)t__2e1153;
+	t__2e1156 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1157 = (u64)(u32)(-(u32)((u64)10UL));
+	t__2e1155 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e1156, (u32)t__2e1157));
+	t__2e1147 = (u64)(u32)(((u32)t__2e1148 == (u32)t__2e1155));
+	t__2e1144 = (u64)(u32)t__2e1147;
+	if ((u32)t__2e1144) goto L__2e1145; else goto L__2e1146;
+	L__2e1145:;
+	t__2e1160 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1161 = (u64)(u32)(-(u32)((u64)10UL));
+	t__2e1162 = (u64)((i64)(i32)t__2e1160);
+	t__2e1163 = (u64)((u64)t__2e1162 * (u64)((u64)1717986919UL));
+	t__2e1164 = (u64)((i64)t__2e1163 >> (((u64)34UL) & 63));
+	t__2e1165 = (u64)((u64)t__2e1162 >> (((u64)63UL) & 63));
+	t__2e1164 = (u64)((u64)t__2e1164 + (u64)t__2e1165);
+	t__2e1164 = (u64)((u64)t__2e1164 * (u64)((u64)10UL));
+	t__2e1164 = (u64)((u64)t__2e1162 - (u64)t__2e1164);
+	t__2e1159 = (u64)(u32)t__2e1164;
+	t__2e1167 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1168 = (u64)(u32)(-(u32)((u64)10UL));
+	t__2e1166 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e1167, (u32)t__2e1168));
+	t__2e1158 = (u64)(u32)(((u32)t__2e1159 == (u32)t__2e1166));
+	t__2e1144 = (u64)(u32)t__2e1158;
+	goto L__2e1146;
+	L__2e1146:;
+	if ((u32)t__2e1144) goto L_passed_2e1143; else goto L_failed_2e1142;
+	L_failed_2e1142:;
+	t_abortsite_2e911 = ((u64)13UL);
+	goto L_abort_2e912;
+	L_passed_2e1143:;
+	t__2e1173 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1174 = (u64)(u32)(-(u32)((u64)2147483647UL));
+	t__2e1175 = (u64)((i64)(i32)t__2e1173);
+	t__2e1176 = (u64)((u64)t__2e1175 * (u64)((u64)1073741825UL));
+	t__2e1177 = (u64)((i64)t__2e1176 >> (((u64)61UL) & 63));
+	t__2e1178 = (u64)((u64)t__2e1175 >> (((u64)63UL) & 63));
+	t__2e1177 = (u64)((u64)t__2e1177 + (u64)t__2e1178);
+	t__2e1177 = (u64)(-(u64)t__2e1177);
+	t__2e1172 = (u64)(u32)t__2e1177;
+	t__2e1180 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1181 = (u64)(u32)(-(u32)((u64)2147483647UL));
+	t__2e1179 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e1180, (u32)t__2e1181));
+	t__2e1171 = (u64)(u32)(((u32)t__2e1172 == (u32)t__2e1179));
+	if ((u32)t__2e1171) goto L_passed_2e1170; else goto L_failed_2e1169;
+	L_failed_2e1169:;
+	t_abortsite_2e911 = ((u64)14UL);
+	goto L_abort_2e912;
+	L_passed_2e1170:;
+	t__2e1186 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1187 = (u64)(u32)(-(u32)((u64)2147483648UL));
+	t__2e1185 = (u64)(u32)((i32)t__2e1186 / (i32)t__2e1187);
+	t__2e1189 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1190 = (u64)(u32)(-(u32)((u64)2147483648UL));
+	t__2e1188 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e1189, (u32)t__2e1190));
+	t__2e1184 = (u64)(u32)(((u32)t__2e1185 == (u32)t__2e1188));
+	if ((u32)t__2e1184) goto L_passed_2e1183; else goto L_failed_2e1182;
+	L_failed_2e1182:;
+	t_abortsite_2e911 = ((u64)15UL);
+	goto L_abort_2e912;
+	L_passed_2e1183:;
+	t__2e1198 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1197 = (u64)(u32)((u32)t__2e1198 << (((u64)3UL) & 31));
+	t__2e1200 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1199 = (u64)(u32)((u32)t__2e1200 << (((u64)3UL) & 31));
+	t__2e1196 = (u64)(u32)(((u32)t__2e1197 == (u32)t__2e1199));
+	t__2e1193 = (u64)(u32)t__2e1196;
+	if ((u32)t__2e1193) goto L__2e1194; else goto L__2e1195;
+	L__2e1194:;
+	t__2e1203 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1204 = (u64)(u32)(-(u32)((u64)4UL));
+	t__2e1202 = (u64)(u32)((u32)t__2e1203 << (((u64)2UL) & 31));
+	t__2e1202 = (u64)(u32)(-(u32)t__2e1202);
+	t__2e1206 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1205 = (u64)(u32)((u32)t__2e1206 << (((u64)2UL) & 31));
+	t__2e1207 = (u64)(u32)(-(u32)t__2e1205);
+	t__2e1201 = (u64)(u32)(((u32)t__2e1202 == (u32)t__2e1207));
+	t__2e1193 = (u64)(u32)t__2e1201;
+	goto L__2e1195;
+	L__2e1195:;
+	if ((u32)t__2e1193) goto L_passed_2e1192; else goto L_failed_2e1191;
+	L_failed_2e1191:;
+	t_abortsite_2e911 = ((u64)16UL);
+	goto L_abort_2e912;
+	L_passed_2e1192:;
+	t__2e1209 = (u64)(u32)(*(i32 *)t_param_2e887);
+	*(u32 *)t_binding_2e1208 = (u32)t__2e1209;
+	t__2e1210 = (u64)(u32)(*(i32 *)t_binding_2e1208);
+	t__2e1211 = (u64)((i64)(i32)t__2e1210);
+	t__2e1212 = (u64)((u64)t__2e1211 * (u64)((u64)2454267027UL));
+	t__2e1213 = (u64)((i64)t__2e1212 >> (((u64)34UL) & 63));
+	t__2e1214 = (u64)((u64)t__2e1211 >> (((u64)63UL) & 63));
+	t__2e1213 = (u64)((u64)t__2e1213 + (u64)t__2e1214);
+	t__2e1210 = (u64)(u32)t__2e1213;
+	*(u32 *)t_binding_2e1208 = (u32)t__2e1210;
+	t__2e1218 = (u64)(u32)(*(i32 *)t_binding_2e1208);
+	t__2e1220 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1219 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_div32)))((u32)t__2e1220, (u32)((u64)7UL)));
+	t__2e1217 = (u64)(u32)(((u32)t__2e1218 == (u32)t__2e1219));
+	if ((u32)t__2e1217) goto L_passed_2e1216; else goto L_failed_2e1215;
+	L_failed_2e1215:;
+	t_abortsite_2e911 = ((u64)17UL);
+	goto L_abort_2e912;
+	L_passed_2e1216:;
+	t__2e1221 = (u64)(u32)(*(i32 *)t_param_2e887);
+	*(u32 *)t_binding_2e1208 = (u32)t__2e1221;
+	t__2e1222 = (u64)(u32)(*(i32 *)t_binding_2e1208);
+	t__2e1223 = (u64)(u32)(-(u32)((u64)16UL));
+	t__2e1224 = (u64)(u32)((i32)t__2e1222 >> (((u64)31UL) & 31));
+	t__2e1224 = (u64)(u32)((u32)t__2e1224 >> (((u64)28UL) & 31));
+	t__2e1225 = (u64)(u32)((u32)t__2e1222 + (u32)t__2e1224);
+	t__2e1225 = (u64)(u32)((u32)t__2e1225 & (u32)((u64)4294967280UL));
+	t__2e1222 = (u64)(u32)((u32)t__2e1222 - (u32)t__2e1225);
+	*(u32 *)t_binding_2e1208 = (u32)t__2e1222;
+	t__2e1229 = (u64)(u32)(*(i32 *)t_binding_2e1208);
+	t__2e1231 = (u64)(u32)(*(i32 *)t_param_2e887);
+	t__2e1232 = (u64)(u32)(-(u32)((u64)16UL));
+	t__2e1230 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_rem32)))((u32)t__2e1231, (u32)t__2e1232));
+	t__2e1228 = (u64)(u32)(((u32)t__2e1229 == (u32)t__2e1230));
+	if ((u32)t__2e1228) goto L_passed_2e1227; else goto L_failed_2e1226;
+	L_failed_2e1226:;
+	t_abortsite_2e911 = ((u64)18UL);
+	goto L_abort_2e912;
+	L_passed_2e1227:;
+	goto L__2e889;
+	L__2e1233:;
+	L__2e889:;
+	return;
+	L_abort_2e912:;
+	t__2e913 = (u64)((u64)t_abortsite_2e911 * (u64)((u64)16UL));
+	t__2e913 = (u64)((u64)((u64)((char *)&D_abortsites_2e910)) + (u64)t__2e913);
+	t__2e914 = (u64)(*(u64 *)t__2e913);
+	t__2e915 = (u64)((u64)t__2e913 + (u64)((u64)8UL));
+	t__2e916 = (u64)(*(u32 *)t__2e915);
+	t__2e915 = (u64)((u64)t__2e913 + (u64)((u64)12UL));
+	t__2e917 = (u64)(*(u32 *)t__2e915);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e914, (u64)t__2e916, (u64)t__2e917, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_rem32(u32 p_x, u32 p_y) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e1238;
+	u64 t__2e1239;
+	u64 t__2e1240;
+	u64 t_param_2e1235;
+	u64 t_param_2e1236;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e1234:;
+	t_param_2e1235 = (u64)A0;
+	t_param_2e1236 = (u64)A1;
+	*(u32 *)t_param_2e1235 = (u32)t_x;
+	*(u32 *)t_param_2e1236 = (u32)t_y;
+	L_body_2e1237:;
+	t__2e1239 = (u64)(u32)(*(i32 *)t_param_2e1235);
+	t__2e1240 = (u64)(u32)(*(i32 *)t_param_2e1236);
+	t__2e1238 = (u64)(u32)((i32)t__2e1239 % (i32)t__2e1240);
+	return (u32)t__2e1238;
+}
+static u32 F_div32(u32 p_x, u32 p_y) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e1245;
+	u64 t__2e1246;
+	u64 t__2e1247;
+	u64 t_param_2e1242;
+	u64 t_param_2e1243;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e1241:;
+	t_param_2e1242 = (u64)A0;
+	t_param_2e1243 = (u64)A1;
+	*(u32 *)t_param_2e1242 = (u32)t_x;
+	*(u32 *)t_param_2e1243 = (u32)t_y;
+	L_body_2e1244:;
+	t__2e1246 = (u64)(u32)(*(i32 *)t_param_2e1242);
+	t__2e1247 = (u64)(u32)(*(i32 *)t_param_2e1243);
+	t__2e1245 = (u64)(u32)((i32)t__2e1246 / (i32)t__2e1247);
+	return (u32)t__2e1245;
+}
+static u32 F_urem8(u32 p_x, u32 p_y) {
+	char A0[1] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	u64 t__2e1252;
+	u64 t__2e1253;
+	u64 t__2e1254;
+	u64 t__2e1255;
+	u64 t__2e1256;
+	u64 t_param_2e1249;
+	u64 t_param_2e1250;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e1248:;
+	t_param_2e1249 = (u64)A0;
+	t_param_2e1250 = (u64)A1;
+	*(u8 *)t_param_2e1249 = (u8)t_x;
+	*(u8 *)t_param_2e1250 = (u8)t_y;
+	L_body_2e1251:;
+	t__2e1253 = (u64)(u32)(*(u8 *)t_param_2e1249);
+	t__2e1254 = (u64)(u32)(*(u8 *)t_param_2e1250);
+	t__2e1255 = (u64)(u32)((u8)t__2e1253);
+	t__2e1256 = (u64)(u32)((u8)t__2e1254);
+	t__2e1252 = (u64)(u32)((u32)t__2e1255 % (u32)t__2e1256);
+	return (u32)t__2e1252;
+}
+static u32 F_udiv8(u32 p_x, u32 p_y) {
+	char A0[1] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	u64 t__2e1261;
+	u64 t__2e1262;
+	u64 t__2e1263;
+	u64 t__2e1264;
+	u64 t__2e1265;
+	u64 t_param_2e1258;
+	u64 t_param_2e1259;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e1257:;
+	t_param_2e1258 = (u64)A0;
+	t_param_2e1259 = (u64)A1;
+	*(u8 *)t_param_2e1258 = (u8)t_x;
+	*(u8 *)t_param_2e1259 = (u8)t_y;
+	L_body_2e1260:;
+	t__2e1262 = (u64)(u32)(*(u8 *)t_param_2e1258);
+	t__2e1263 = (u64)(u32)(*(u8 *)t_param_2e1259);
+	t__2e1264 = (u64)(u32)((u8)t__2e1262);
+	t__2e1265 = (u64)(u32)((u8)t__2e1263);
+	t__2e1261 = (u64)(u32)((u32)t__2e1264 / (u32)t__2e1265);
+	return (u32)t__2e1261;
+}
+static u32 F_rem8(u32 p_x, u32 p_y) {
+	char A0[1] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	u64 t__2e1270;
+	u64 t__2e1271;
+	u64 t__2e1272;
+	u64 t__2e1273;
+	u64 t__2e1274;
+	u64 t_param_2e1267;
+	u64 t_param_2e1268;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e1266:;
+	t_param_2e1267 = (u64)A0;
+	t_param_2e1268 = (u64)A1;
+	*(u8 *)t_param_2e1267 = (u8)t_x;
+	*(u8 *)t_param_2e1268 = (u8)t_y;
+	L_body_2e1269:;
+	t__2e1271 = (u64)(u32)(*(i8 *)t_param_2e1267);
+	t__2e1272 = (u64)(u32)(*(i8 *)t_param_2e1268);
+	t__2e1273 = (u64)(u32)((i64)(i8)t__2e1271);
+	t__2e1274 = (u64)(u32)((i64)(i8)t__2e1272);
+	t__2e1270 = (u64)(u32)((i32)t__2e1273 % (i32)t__2e1274);
+	return (u32)t__2e1270;
+}
+static u32 F_div8(u32 p_x, u32 p_y) {
+	char A0[1] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	u64 t__2e1279;
+	u64 t__2e1280;
+	u64 t__2e1281;
+	u64 t__2e1282;
+	u64 t__2e1283;
+	u64 t_param_2e1276;
+	u64 t_param_2e1277;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e1275:;
+	t_param_2e1276 = (u64)A0;
+	t_param_2e1277 = (u64)A1;
+	*(u8 *)t_param_2e1276 = (u8)t_x;
+	*(u8 *)t_param_2e1277 = (u8)t_y;
+	L_body_2e1278:;
+	t__2e1280 = (u64)(u32)(*(i8 *)t_param_2e1276);
+	t__2e1281 = (u64)(u32)(*(i8 *)t_param_2e1277);
+	t__2e1282 = (u64)(u32)((i64)(i8)t__2e1280);
+	t__2e1283 = (u64)(u32)((i64)(i8)t__2e1281);
+	t__2e1279 = (u64)(u32)((i32)t__2e1282 / (i32)t__2e1283);
+	return (u32)t__2e1279;
+}
+static void F_eval(void) {
+	u64 t__2e1290;
+	u64 t__2e1294;
+	u64 t__2e1295;
+	u64 t__2e1296;
+	u64 t__2e1297;
+	u64 t__2e1298;
+	u64 t__2e1301;
+	u64 t__2e1302;
+	u64 t__2e1303;
+	u64 t__2e1304;
+	u64 t__2e1307;
+	u64 t__2e1308;
+	u64 t__2e1309;
+	u64 t__2e1312;
+	u64 t__2e1313;
+	u64 t__2e1314;
+	u64 t__2e1315;
+	u64 t__2e1316;
+	u64 t__2e1319;
+	u64 t__2e1320;
+	u64 t__2e1321;
+	u64 t__2e1322;
+	u64 t__2e1323;
+	u64 t__2e1326;
+	u64 t__2e1327;
+	u64 t__2e1328;
+	u64 t__2e1329;
+	u64 t__2e1332;
+	u64 t__2e1333;
+	u64 t__2e1334;
+	u64 t__2e1335;
+	u64 t__2e1338;
+	u64 t__2e1339;
+	u64 t__2e1342;
+	u64 t_abortsite_2e1292;
+	L_start_2e1284:;
+	L_body_2e1285:;
+	t__2e1290 = (u64)(u32)((BD(((u64)4631107791820423168UL)) == BD(((u64)4631107791820423168UL))));
+	if ((u32)t__2e1290) goto L_passed_2e1289; else goto L_failed_2e1288;
+	L_failed_2e1288:;
+	t_abortsite_2e1292 = ((u64)0UL);
+	goto L_abort_2e1293;
+	L_passed_2e1289:;
+	t__2e1302 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e1303 = (u64)(u32)((i64)(i8)((u64)4294967294UL));
+	t__2e1304 = (u64)(u32)((i64)(i8)t__2e1302);
+	t__2e1301 = (u64)(u32)(((u32)t__2e1303 == (u32)t__2e1304));
+	if ((u32)t__2e1301) goto L_passed_2e1300; else goto L_failed_2e1299;
+	L_failed_2e1299:;
+	t_abortsite_2e1292 = ((u64)1UL);
+	goto L_abort_2e1293;
+	L_passed_2e1300:;
+	t__2e1308 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1309 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1307 = (u64)(u32)(((u32)t__2e1308 == (u32)t__2e1309));
+	if ((u32)t__2e1307) goto L_passed_2e1306; else goto L_failed_2e1305;
+	L_failed_2e1305:;
+	t_abortsite_2e1292 = ((u64)2UL);
+	goto L_abort_2e1293;
+	L_passed_2e1306:;
+	t__2e1313 = (u64)(u32)(*(i8 *)((u64)((char *)&D_a)));
+	t__2e1314 = (u64)(u32)(-(u32)((u64)125UL));
+	t__2e1315 = (u64)(u32)((i64)(i8)t__2e1313);
+	t__2e1316 = (u64)(u32)((i64)(i8)t__2e1314);
+	t__2e1312 = (u64)(u32)(((u32)t__2e1315 == (u32)t__2e1316));
+	if ((u32)t__2e1312) goto L_passed_2e1311; else goto L_failed_2e1310;
+	L_failed_2e1310:;
+	t_abortsite_2e1292 = ((u64)3UL);
+	goto L_abort_2e1293;
+	L_passed_2e1311:;
+	t__2e1320 = (u64)(u32)(*(i8 *)((u64)((char *)&D_b)));
+	t__2e1321 = (u64)(u32)(-(u32)((u64)125UL));
+	t__2e1322 = (u64)(u32)((i64)(i8)t__2e1320);
+	t__2e1323 = (u64)(u32)((i64)(i8)t__2e1321);
+	t__2e1319 = (u64)(u32)(((u32)t__2e1322 == (u32)t__2e1323));
+	if ((u32)t__2e1319) goto L_passed_2e1318; else goto L_failed_2e1317;
+	L_failed_2e1317:;
+	t_abortsite_2e1292 = ((u64)4UL);
+	goto L_abort_2e1293;
+	L_passed_2e1318:;
+	t__2e1327 = (u64)(u32)(-(u32)((u64)125UL));
+	t__2e1328 = (u64)(u32)((i64)(i8)((u64)4294967171UL));
+	t__2e1329 = (u64)(u32)((i64)(i8)t__2e1327);
+	t__2e1326 = (u64)(u32)(((u32)t__2e1328 == (u32)t__2e1329));
+	if ((u32)t__2e1326) goto L_passed_2e1325; else goto L_failed_2e1324;
+	L_failed_2e1324:;
+	t_abortsite_2e1292 = ((u64)5UL);
+	goto L_abort_2e1293;
+	L_passed_2e1325:;
+	t__2e1333 = (u64)(u32)(-(u32)((u64)125UL));
+	t__2e1334 = (u64)(u32)((i64)(i8)((u64)4294967171UL));
+	t__2e1335 = (u64)(u32)((i64)(i8)t__2e1333);
+	t__2e1332 = (u64)(u32)(((u32)t__2e1334 == (u32)t__2e1335));
+	if ((u32)t__2e1332) goto L_passed_2e1331; else goto L_failed_2e1330;
+	L_failed_2e1330:;
+	t_abortsite_2e1292 = ((u64)6UL);
+	goto L_abort_2e1293;
+	L_passed_2e1331:;
+	t__2e1339 = (u64)(u32)(-(u32)((u64)2147483645UL));
+	t__2e1338 = (u64)(u32)(((u32)((u64)2147483651UL) == (u32)t__2e1339));
+	if ((u32)t__2e1338) goto L_passed_2e1337; else goto L_failed_2e1336;
+	L_failed_2e1336:;
+	t_abortsite_2e1292 = ((u64)7UL);
+	goto L_abort_2e1293;
+	L_passed_2e1337:;
+	t__2e1342 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	if ((u32)t__2e1342) goto L_passed_2e1341; else goto L_failed_2e1340;
+	L_failed_2e1340:;
+	t_abortsite_2e1292 = ((u64)8UL);
+	goto L_abort_2e1293;
+	L_passed_2e1341:;
+	goto L__2e1286;
+	L__2e1343:;
+	L__2e1286:;
+	return;
+	L_abort_2e1293:;
+	t__2e1294 = (u64)((u64)t_abortsite_2e1292 * (u64)((u64)16UL));
+	t__2e1294 = (u64)((u64)((u64)((char *)&D_abortsites_2e1291)) + (u64)t__2e1294);
+	t__2e1295 = (u64)(*(u64 *)t__2e1294);
+	t__2e1296 = (u64)((u64)t__2e1294 + (u64)((u64)8UL));
+	t__2e1297 = (u64)(*(u32 *)t__2e1296);
+	t__2e1296 = (u64)((u64)t__2e1294 + (u64)((u64)12UL));
+	t__2e1298 = (u64)(*(u32 *)t__2e1296);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1295, (u64)t__2e1297, (u64)t__2e1298, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_comparison(void) {
+	u64 t__2e1350;
+	u64 t__2e1354;
+	u64 t__2e1355;
+	u64 t__2e1356;
+	u64 t__2e1357;
+	u64 t__2e1358;
+	u64 t__2e1361;
+	u64 t__2e1364;
+	u64 t__2e1365;
+	u64 t__2e1366;
+	u64 t__2e1369;
+	u64 t__2e1370;
+	u64 t__2e1371;
+	u64 t__2e1374;
+	u64 t__2e1377;
+	u64 t__2e1380;
+	u64 t__2e1381;
+	u64 t__2e1384;
+	u64 t__2e1385;
+	u64 t_abortsite_2e1352;
+	L_start_2e1344:;
+	L_body_2e1345:;
+	t__2e1350 = (u64)(u32)(((i32)((u64)3UL) > (i32)((u64)2UL)));
+	if ((u32)t__2e1350) goto L_passed_2e1349; else goto L_failed_2e1348;
+	L_failed_2e1348:;
+	t_abortsite_2e1352 = ((u64)0UL);
+	goto L_abort_2e1353;
+	L_passed_2e1349:;
+	t__2e1361 = (u64)(u32)(((i32)((u64)2UL) < (i32)((u64)3UL)));
+	if ((u32)t__2e1361) goto L_passed_2e1360; else goto L_failed_2e1359;
+	L_failed_2e1359:;
+	t_abortsite_2e1352 = ((u64)1UL);
+	goto L_abort_2e1353;
+	L_passed_2e1360:;
+	t__2e1365 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e1366 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e1364 = (u64)(u32)(((i32)t__2e1365 < (i32)t__2e1366));
+	if ((u32)t__2e1364) goto L_passed_2e1363; else goto L_failed_2e1362;
+	L_failed_2e1362:;
+	t_abortsite_2e1352 = ((u64)2UL);
+	goto L_abort_2e1353;
+	L_passed_2e1363:;
+	t__2e1370 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e1371 = (u64)(u32)(-(u32)((u64)3UL));
+	t__2e1369 = (u64)(u32)(((i32)t__2e1370 > (i32)t__2e1371));
+	if ((u32)t__2e1369) goto L_passed_2e1368; else goto L_failed_2e1367;
+	L_failed_2e1367:;
+	t_abortsite_2e1352 = ((u64)3UL);
+	goto L_abort_2e1353;
+	L_passed_2e1368:;
+	t__2e1374 = (u64)(u32)(((i32)((u64)3UL) >= (i32)((u64)3UL)));
+	if ((u32)t__2e1374) goto L_passed_2e1373; else goto L_failed_2e1372;
+	L_failed_2e1372:;
+	t_abortsite_2e1352 = ((u64)4UL);
+	goto L_abort_2e1353;
+	L_passed_2e1373:;
+	t__2e1377 = (u64)(u32)(((i32)((u64)3UL) <= (i32)((u64)3UL)));
+	if ((u32)t__2e1377) goto L_passed_2e1376; else goto L_failed_2e1375;
+	L_failed_2e1375:;
+	t_abortsite_2e1352 = ((u64)5UL);
+	goto L_abort_2e1353;
+	L_passed_2e1376:;
+	t__2e1381 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e1380 = (u64)(u32)(((i32)((u64)0UL) > (i32)t__2e1381));
+	if ((u32)t__2e1380) goto L_passed_2e1379; else goto L_failed_2e1378;
+	L_failed_2e1378:;
+	t_abortsite_2e1352 = ((u64)6UL);
+	goto L_abort_2e1353;
+	L_passed_2e1379:;
+	t__2e1385 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e1384 = (u64)(u32)(((u32)((u64)0UL) < (u32)t__2e1385));
+	if ((u32)t__2e1384) goto L_passed_2e1383; else goto L_failed_2e1382;
+	L_failed_2e1382:;
+	t_abortsite_2e1352 = ((u64)7UL);
+	goto L_abort_2e1353;
+	L_passed_2e1383:;
+	goto L__2e1346;
+	L__2e1386:;
+	L__2e1346:;
+	return;
+	L_abort_2e1353:;
+	t__2e1354 = (u64)((u64)t_abortsite_2e1352 * (u64)((u64)16UL));
+	t__2e1354 = (u64)((u64)((u64)((char *)&D_abortsites_2e1351)) + (u64)t__2e1354);
+	t__2e1355 = (u64)(*(u64 *)t__2e1354);
+	t__2e1356 = (u64)((u64)t__2e1354 + (u64)((u64)8UL));
+	t__2e1357 = (u64)(*(u32 *)t__2e1356);
+	t__2e1356 = (u64)((u64)t__2e1354 + (u64)((u64)12UL));
+	t__2e1358 = (u64)(*(u32 *)t__2e1356);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1355, (u64)t__2e1357, (u64)t__2e1358, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_arithmetic(void) {
+	u64 t__2e1393;
+	u64 t__2e1394;
+	u64 t__2e1398;
+	u64 t__2e1399;
+	u64 t__2e1400;
+	u64 t__2e1401;
+	u64 t__2e1402;
+	u64 t__2e1405;
+	u64 t__2e1406;
+	u64 t__2e1409;
+	u64 t__2e1410;
+	u64 t__2e1411;
+	u64 t__2e1414;
+	u64 t__2e1415;
+	u64 t__2e1418;
+	u64 t__2e1419;
+	u64 t__2e1420;
+	u64 t__2e1421;
+	u64 t__2e1422;
+	u64 t__2e1425;
+	u64 t__2e1426;
+	u64 t__2e1427;
+	u64 t__2e1428;
+	u64 t__2e1429;
+	u64 t__2e1432;
+	u64 t__2e1433;
+	u64 t__2e1434;
+	u64 t__2e1435;
+	u64 t__2e1436;
+	u64 t__2e1439;
+	u64 t__2e1440;
+	u64 t__2e1441;
+	u64 t__2e1442;
+	u64 t__2e1443;
+	u64 t__2e1446;
+	u64 t__2e1447;
+	u64 t__2e1448;
+	u64 t__2e1449;
+	u64 t__2e1450;
+	u64 t__2e1453;
+	u64 t__2e1454;
+	u64 t__2e1455;
+	u64 t__2e1456;
+	u64 t__2e1457;
+	u64 t__2e1460;
+	u64 t__2e1461;
+	u64 t__2e1462;
+	u64 t__2e1465;
+	u64 t__2e1466;
+	u64 t__2e1467;
+	u64 t__2e1470;
+	u64 t__2e1471;
+	u64 t__2e1474;
+	u64 t__2e1475;
+	u64 t__2e1478;
+	u64 t__2e1479;
+	u64 t__2e1480;
+	u64 t__2e1481;
+	u64 t__2e1484;
+	u64 t__2e1485;
+	u64 t__2e1486;
+	u64 t__2e1487;
+	u64 t__2e1490;
+	u64 t__2e1491;
+	u64 t__2e1492;
+	u64 t__2e1493;
+	u64 t__2e1496;
+	u64 t__2e1497;
+	u64 t__2e1498;
+	u64 t__2e1499;
+	u64 t__2e1500;
+	u64 t__2e1501;
+	u64 t__2e1502;
+	u64 t__2e1503;
+	u64 t__2e1506;
+	u64 t__2e1507;
+	u64 t__2e1508;
+	u64 t__2e1509;
+	u64 t__2e1510;
+	u64 t__2e1511;
+	u64 t__2e1512;
+	u64 t__2e1513;
+	u64 t__2e1516;
+	u64 t__2e1517;
+	u64 t__2e1518;
+	u64 t__2e1519;
+	u64 t__2e1520;
+	u64 t__2e1521;
+	u64 t__2e1522;
+	u64 t__2e1523;
+	u64 t__2e1526;
+	u64 t__2e1527;
+	u64 t__2e1528;
+	u64 t__2e1529;
+	u64 t__2e1530;
+	u64 t__2e1531;
+	u64 t__2e1532;
+	u64 t__2e1535;
+	u64 t__2e1536;
+	u64 t__2e1537;
+	u64 t__2e1538;
+	u64 t__2e1539;
+	u64 t__2e1540;
+	u64 t__2e1541;
+	u64 t__2e1544;
+	u64 t__2e1545;
+	u64 t__2e1546;
+	u64 t__2e1547;
+	u64 t__2e1548;
+	u64 t__2e1549;
+	u64 t__2e1550;
+	u64 t__2e1551;
+	u64 t__2e1554;
+	u64 t__2e1555;
+	u64 t__2e1556;
+	u64 t__2e1557;
+	u64 t__2e1558;
+	u64 t__2e1559;
+	u64 t__2e1560;
+	u64 t__2e1561;
+	u64 t__2e1564;
+	u64 t__2e1565;
+	u64 t__2e1566;
+	u64 t__2e1567;
+	u64 t__2e1568;
+	u64 t__2e1569;
+	u64 t__2e1570;
+	u64 t__2e1571;
+	u64 t__2e1574;
+	u64 t__2e1575;
+	u64 t__2e1576;
+	u64 t__2e1577;
+	u64 t__2e1578;
+	u64 t__2e1579;
+	u64 t__2e1580;
+	u64 t__2e1581;
+	u64 t__2e1584;
+	u64 t__2e1585;
+	u64 t__2e1586;
+	u64 t__2e1587;
+	u64 t__2e1588;
+	u64 t__2e1589;
+	u64 t__2e1590;
+	u64 t__2e1591;
+	u64 t__2e1594;
+	u64 t__2e1595;
+	u64 t__2e1596;
+	u64 t__2e1597;
+	u64 t__2e1598;
+	u64 t__2e1599;
+	u64 t__2e1600;
+	u64 t__2e1603;
+	u64 t__2e1604;
+	u64 t__2e1605;
+	u64 t__2e1606;
+	u64 t__2e1607;
+	u64 t__2e1608;
+	u64 t__2e1609;
+	u64 t__2e1610;
+	u64 t__2e1611;
+	u64 t__2e1614;
+	u64 t__2e1615;
+	u64 t__2e1616;
+	u64 t__2e1617;
+	u64 t__2e1618;
+	u64 t__2e1619;
+	u64 t__2e1620;
+	u64 t__2e1621;
+	u64 t__2e1624;
+	u64 t__2e1625;
+	u64 t__2e1626;
+	u64 t__2e1627;
+	u64 t__2e1628;
+	u64 t__2e1629;
+	u64 t__2e1630;
+	u64 t__2e1633;
+	u64 t__2e1634;
+	u64 t__2e1635;
+	u64 t__2e1636;
+	u64 t__2e1637;
+	u64 t__2e1638;
+	u64 t__2e1639;
+	u64 t__2e1640;
+	u64 t__2e1641;
+	u64 t__2e1644;
+	u64 t__2e1645;
+	u64 t__2e1646;
+	u64 t__2e1647;
+	u64 t__2e1648;
+	u64 t__2e1649;
+	u64 t__2e1650;
+	u64 t__2e1653;
+	u64 t__2e1654;
+	u64 t__2e1655;
+	u64 t__2e1656;
+	u64 t__2e1657;
+	u64 t__2e1658;
+	u64 t__2e1659;
+	u64 t__2e1662;
+	u64 t__2e1663;
+	u64 t__2e1664;
+	u64 t__2e1665;
+	u64 t__2e1666;
+	u64 t__2e1667;
+	u64 t__2e1668;
+	u64 t__2e1669;
+	u64 t_abortsite_2e1396;
+	L_start_2e1387:;
+	L_body_2e1388:;
+	t__2e1394 = (u64)(u32)((u32)((u64)1337UL) + (u32)((u64)1234UL));
+	t__2e1393 = (u64)(u32)(((u32)t__2e1394 == (u32)((u64)2571UL)));
+	if ((u32)t__2e1393) goto L_passed_2e1392; else goto L_failed_2e1391;
+	L_failed_2e1391:;
+	t_abortsite_2e1396 = ((u64)0UL);
+	goto L_abort_2e1397;
+	L_passed_2e1392:;
+	t__2e1406 = (u64)(u32)((u32)((u64)1337UL) - (u32)((u64)1234UL));
+	t__2e1405 = (u64)(u32)(((u32)t__2e1406 == (u32)((u64)103UL)));
+	if ((u32)t__2e1405) goto L_passed_2e1404; else goto L_failed_2e1403;
+	L_failed_2e1403:;
+	t_abortsite_2e1396 = ((u64)1UL);
+	goto L_abort_2e1397;
+	L_passed_2e1404:;
+	t__2e1410 = (u64)(u32)((u32)((u64)1234UL) - (u32)((u64)1337UL));
+	t__2e1411 = (u64)(u32)(-(u32)((u64)103UL));
+	t__2e1409 = (u64)(u32)(((u32)t__2e1410 == (u32)t__2e1411));
+	if ((u32)t__2e1409) goto L_passed_2e1408; else goto L_failed_2e1407;
+	L_failed_2e1407:;
+	t_abortsite_2e1396 = ((u64)2UL);
+	goto L_abort_2e1397;
+	L_passed_2e1408:;
+	t__2e1415 = (u64)(u32)((u32)((u64)1337UL) * (u32)((u64)1234UL));
+	t__2e1414 = (u64)(u32)(((u32)t__2e1415 == (u32)((u64)1649858UL)));
+	if ((u32)t__2e1414) goto L_passed_2e1413; else goto L_failed_2e1412;
+	L_failed_2e1412:;
+	t_abortsite_2e1396 = ((u64)3UL);
+	goto L_abort_2e1397;
+	L_passed_2e1413:;
+	t__2e1420 = (u64)((u32)((u64)1337UL));
+	t__2e1421 = (u64)((u64)t__2e1420 * (u64)((u64)3564057141UL));
+	t__2e1422 = (u64)((u64)t__2e1421 >> (((u64)42UL) & 63));
+	t__2e1419 = (u64)(u32)t__2e1422;
+	t__2e1418 = (u64)(u32)(((u32)t__2e1419 == (u32)((u64)1UL)));
+	if ((u32)t__2e1418) goto L_passed_2e1417; else goto L_failed_2e1416;
+	L_failed_2e1416:;
+	t_abortsite_2e1396 = ((u64)4UL);
+	goto L_abort_2e1397;
+	L_passed_2e1417:;
+	t__2e1427 = (u64)((u32)((u64)1234UL));
+	t__2e1428 = (u64)((u64)t__2e1427 * (u64)((u64)2284010283UL));
+	t__2e1428 = (u64)((u64)t__2e1428 >> (((u64)32UL) & 63));
+	t__2e1428 = (u64)((u64)t__2e1427 + (u64)t__2e1428);
+	t__2e1429 = (u64)((u64)t__2e1428 >> (((u64)11UL) & 63));
+	t__2e1426 = (u64)(u32)t__2e1429;
+	t__2e1425 = (u64)(u32)(((u32)t__2e1426 == (u32)((u64)0UL)));
+	if ((u32)t__2e1425) goto L_passed_2e1424; else goto L_failed_2e1423;
+	L_failed_2e1423:;
+	t_abortsite_2e1396 = ((u64)5UL);
+	goto L_abort_2e1397;
+	L_passed_2e1424:;
+	t__2e1434 = (u64)((u32)((u64)625UL));
+	t__2e1435 = (u64)((u64)t__2e1434 * (u64)((u64)3435973837UL));
+	t__2e1436 = (u64)((u64)t__2e1435 >> (((u64)34UL) & 63));
+	t__2e1433 = (u64)(u32)t__2e1436;
+	t__2e1432 = (u64)(u32)(((u32)t__2e1433 == (u32)((u64)125UL)));
+	if ((u32)t__2e1432) goto L_passed_2e1431; else goto L_failed_2e1430;
+	L_failed_2e1430:;
+	t_abortsite_2e1396 = ((u64)6UL);
+	goto L_abort_2e1397;
+	L_passed_2e1431:;
+	t__2e1441 = (u64)((u32)((u64)1337UL));
+	t__2e1442 = (u64)((u64)t__2e1441 * (u64)((u64)3564057141UL));
+	t__2e1443 = (u64)((u64)t__2e1442 >> (((u64)42UL) & 63));
+	t__2e1443 = (u64)((u64)t__2e1443 * (u64)((u64)1234UL));
+	t__2e1443 = (u64)((u64)t__2e1441 - (u64)t__2e1443);
+	t__2e1440 = (u64)(u32)t__2e1443;
+	t__2e1439 = (u64)(u32)(((u32)t__2e1440 == (u32)((u64)103UL)));
+	if ((u32)t__2e1439) goto L_passed_2e1438; else goto L_failed_2e1437;
+	L_failed_2e1437:;
+	t_abortsite_2e1396 = ((u64)7UL);
+	goto L_abort_2e1397;
+	L_passed_2e1438:;
+	t__2e1448 = (u64)((u32)((u64)1234UL));
+	t__2e1449 = (u64)((u64)t__2e1448 * (u64)((u64)2284010283UL));
+	t__2e1449 = (u64)((u64)t__2e1449 >> (((u64)32UL) & 63));
+	t__2e1449 = (u64)((u64)t__2e1448 + (u64)t__2e1449);
+	t__2e1450 = (u64)((u64)t__2e1449 >> (((u64)11UL) & 63));
+	t__2e1450 = (u64)((u64)t__2e1450 * (u64)((u64)1337UL));
+	t__2e1450 = (u64)((u64)t__2e1448 - (u64)t__2e1450);
+	t__2e1447 = (u64)(u32)t__2e1450;
+	t__2e1446 = (u64)(u32)(((u32)t__2e1447 == (u32)((u64)1234UL)));
+	if ((u32)t__2e1446) goto L_passed_2e1445; else goto L_failed_2e1444;
+	L_failed_2e1444:;
+	t_abortsite_2e1396 = ((u64)8UL);
+	goto L_abort_2e1397;
+	L_passed_2e1445:;
+	t__2e1455 = (u64)((u32)((u64)625UL));
+	t__2e1456 = (u64)((u64)t__2e1455 * (u64)((u64)3435973837UL));
+	t__2e1457 = (u64)((u64)t__2e1456 >> (((u64)34UL) & 63));
+	t__2e1457 = (u64)((u64)t__2e1457 * (u64)((u64)5UL));
+	t__2e1457 = (u64)((u64)t__2e1455 - (u64)t__2e1457);
+	t__2e1454 = (u64)(u32)t__2e1457;
+	t__2e1453 = (u64)(u32)(((u32)t__2e1454 == (u32)((u64)0UL)));
+	if ((u32)t__2e1453) goto L_passed_2e1452; else goto L_failed_2e1451;
+	L_failed_2e1451:;
+	t_abortsite_2e1396 = ((u64)9UL);
+	goto L_abort_2e1397;
+	L_passed_2e1452:;
+	t__2e1461 = (u64)(u32)((u32)((u64)2147483647UL) + (u32)((u64)1UL));
+	t__2e1462 = (u64)(u32)(-(u32)((u64)2147483648UL));
+	t__2e1460 = (u64)(u32)(((u32)t__2e1461 == (u32)t__2e1462));
+	if ((u32)t__2e1460) goto L_passed_2e1459; else goto L_failed_2e1458;
+	L_failed_2e1458:;
+	t_abortsite_2e1396 = ((u64)10UL);
+	goto L_abort_2e1397;
+	L_passed_2e1459:;
+	t__2e1467 = (u64)(u32)(-(u32)((u64)2147483648UL));
+	t__2e1466 = (u64)(u32)((u32)t__2e1467 - (u32)((u64)1UL));
+	t__2e1465 = (u64)(u32)(((u32)t__2e1466 == (u32)((u64)2147483647UL)));
+	if ((u32)t__2e1465) goto L_passed_2e1464; else goto L_failed_2e1463;
+	L_failed_2e1463:;
+	t_abortsite_2e1396 = ((u64)11UL);
+	goto L_abort_2e1397;
+	L_passed_2e1464:;
+	t__2e1471 = (u64)(u32)((u32)((u64)4294967295UL) + (u32)((u64)1UL));
+	t__2e1470 = (u64)(u32)(((u32)t__2e1471 == (u32)((u64)0UL)));
+	if ((u32)t__2e1470) goto L_passed_2e1469; else goto L_failed_2e1468;
+	L_failed_2e1468:;
+	t_abortsite_2e1396 = ((u64)12UL);
+	goto L_abort_2e1397;
+	L_passed_2e1469:;
+	t__2e1475 = (u64)(u32)((u32)((u64)0UL) - (u32)((u64)1UL));
+	t__2e1474 = (u64)(u32)(((u32)t__2e1475 == (u32)((u64)4294967295UL)));
+	if ((u32)t__2e1474) goto L_passed_2e1473; else goto L_failed_2e1472;
+	L_failed_2e1472:;
+	t_abortsite_2e1396 = ((u64)13UL);
+	goto L_abort_2e1397;
+	L_passed_2e1473:;
+	t__2e1480 = (u64)(u32)(-(u32)((u64)1337UL));
+	t__2e1479 = (u64)(u32)((u32)t__2e1480 * (u32)((u64)1234UL));
+	t__2e1481 = (u64)(u32)(-(u32)((u64)1649858UL));
+	t__2e1478 = (u64)(u32)(((u32)t__2e1479 == (u32)t__2e1481));
+	if ((u32)t__2e1478) goto L_passed_2e1477; else goto L_failed_2e1476;
+	L_failed_2e1476:;
+	t_abortsite_2e1396 = ((u64)14UL);
+	goto L_abort_2e1397;
+	L_passed_2e1477:;
+	t__2e1486 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1485 = (u64)(u32)((u32)((u64)1337UL) * (u32)t__2e1486);
+	t__2e1487 = (u64)(u32)(-(u32)((u64)1649858UL));
+	t__2e1484 = (u64)(u32)(((u32)t__2e1485 == (u32)t__2e1487));
+	if ((u32)t__2e1484) goto L_passed_2e1483; else goto L_failed_2e1482;
+	L_failed_2e1482:;
+	t_abortsite_2e1396 = ((u64)15UL);
+	goto L_abort_2e1397;
+	L_passed_2e1483:;
+	t__2e1492 = (u64)(u32)(-(u32)((u64)1337UL));
+	t__2e1493 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1491 = (u64)(u32)((u32)t__2e1492 * (u32)t__2e1493);
+	t__2e1490 = (u64)(u32)(((u32)t__2e1491 == (u32)((u64)1649858UL)));
+	if ((u32)t__2e1490) goto L_passed_2e1489; else goto L_failed_2e1488;
+	L_failed_2e1488:;
+	t_abortsite_2e1396 = ((u64)16UL);
+	goto L_abort_2e1397;
+	L_passed_2e1489:;
+	t__2e1498 = (u64)(u32)(-(u32)((u64)1337UL));
+	t__2e1499 = (u64)((i64)(i32)t__2e1498);
+	t__2e1500 = (u64)((u64)t__2e1499 * (u64)((u64)3564057141UL));
+	t__2e1501 = (u64)((i64)t__2e1500 >> (((u64)42UL) & 63));
+	t__2e1502 = (u64)((u64)t__2e1499 >> (((u64)63UL) & 63));
+	t__2e1501 = (u64)((u64)t__2e1501 + (u64)t__2e1502);
+	t__2e1497 = (u64)(u32)t__2e1501;
+	t__2e1503 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e1496 = (u64)(u32)(((u32)t__2e1497 == (u32)t__2e1503));
+	if ((u32)t__2e1496) goto L_passed_2e1495; else goto L_failed_2e1494;
+	L_failed_2e1494:;
+	t_abortsite_2e1396 = ((u64)17UL);
+	goto L_abort_2e1397;
+	L_passed_2e1495:;
+	t__2e1508 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1509 = (u64)((i64)(i32)((u64)1337UL));
+	t__2e1510 = (u64)((u64)t__2e1509 * (u64)((u64)3564057141UL));
+	t__2e1511 = (u64)((i64)t__2e1510 >> (((u64)42UL) & 63));
+	t__2e1512 = (u64)((u64)t__2e1509 >> (((u64)63UL) & 63));
+	t__2e1511 = (u64)((u64)t__2e1511 + (u64)t__2e1512);
+	t__2e1511 = (u64)(-(u64)t__2e1511);
+	t__2e1507 = (u64)(u32)t__2e1511;
+	t__2e1513 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e1506 = (u64)(u32)(((u32)t__2e1507 == (u32)t__2e1513));
+	if ((u32)t__2e1506) goto L_passed_2e1505; else goto L_failed_2e1504;
+	L_failed_2e1504:;
+	t_abortsite_2e1396 = ((u64)18UL);
+	goto L_abort_2e1397;
+	L_passed_2e1505:;
+	t__2e1518 = (u64)(u32)(-(u32)((u64)1337UL));
+	t__2e1519 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1520 = (u64)((i64)(i32)t__2e1518);
+	t__2e1521 = (u64)((u64)t__2e1520 * (u64)((u64)3564057141UL));
+	t__2e1522 = (u64)((i64)t__2e1521 >> (((u64)42UL) & 63));
+	t__2e1523 = (u64)((u64)t__2e1520 >> (((u64)63UL) & 63));
+	t__2e1522 = (u64)((u64)t__2e1522 + (u64)t__2e1523);
+	t__2e1522 = (u64)(-(u64)t__2e1522);
+	t__2e1517 = (u64)(u32)t__2e1522;
+	t__2e1516 = (u64)(u32)(((u32)t__2e1517 == (u32)((u64)1UL)));
+	if ((u32)t__2e1516) goto L_passed_2e1515; else goto L_failed_2e1514;
+	L_failed_2e1514:;
+	t_abortsite_2e1396 = ((u64)19UL);
+	goto L_abort_2e1397;
+	L_passed_2e1515:;
+	t__2e1528 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1529 = (u64)((i64)(i32)t__2e1528);
+	t__2e1530 = (u64)((u64)t__2e1529 * (u64)((u64)1644744395UL));
+	t__2e1531 = (u64)((i64)t__2e1530 >> (((u64)41UL) & 63));
+	t__2e1532 = (u64)((u64)t__2e1529 >> (((u64)63UL) & 63));
+	t__2e1531 = (u64)((u64)t__2e1531 + (u64)t__2e1532);
+	t__2e1527 = (u64)(u32)t__2e1531;
+	t__2e1526 = (u64)(u32)(((u32)t__2e1527 == (u32)((u64)0UL)));
+	if ((u32)t__2e1526) goto L_passed_2e1525; else goto L_failed_2e1524;
+	L_failed_2e1524:;
+	t_abortsite_2e1396 = ((u64)20UL);
+	goto L_abort_2e1397;
+	L_passed_2e1525:;
+	t__2e1537 = (u64)(u32)(-(u32)((u64)1337UL));
+	t__2e1538 = (u64)((i64)(i32)((u64)1234UL));
+	t__2e1539 = (u64)((u64)t__2e1538 * (u64)((u64)1644744395UL));
+	t__2e1540 = (u64)((i64)t__2e1539 >> (((u64)41UL) & 63));
+	t__2e1541 = (u64)((u64)t__2e1538 >> (((u64)63UL) & 63));
+	t__2e1540 = (u64)((u64)t__2e1540 + (u64)t__2e1541);
+	t__2e1540 = (u64)(-(u64)t__2e1540);
+	t__2e1536 = (u64)(u32)t__2e1540;
+	t__2e1535 = (u64)(u32)(((u32)t__2e1536 == (u32)((u64)0UL)));
+	if ((u32)t__2e1535) goto L_passed_2e1534; else goto L_failed_2e1533;
+	L_failed_2e1533:;
+	t_abortsite_2e1396 = ((u64)21UL);
+	goto L_abort_2e1397;
+	L_passed_2e1534:;
+	t__2e1546 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1547 = (u64)(u32)(-(u32)((u64)1337UL));
+	t__2e1548 = (u64)((i64)(i32)t__2e1546);
+	t__2e1549 = (u64)((u64)t__2e1548 * (u64)((u64)1644744395UL));
+	t__2e1550 = (u64)((i64)t__2e1549 >> (((u64)41UL) & 63));
+	t__2e1551 = (u64)((u64)t__2e1548 >> (((u64)63UL) & 63));
+	t__2e1550 = (u64)((u64)t__2e1550 + (u64)t__2e1551);
+	t__2e1550 = (u64)(-(u64)t__2e1550);
+	t__2e1545 = (u64)(u32)t__2e1550;
+	t__2e1544 = (u64)(u32)(((u32)t__2e1545 == (u32)((u64)0UL)));
+	if ((u32)t__2e1544) goto L_passed_2e1543; else goto L_failed_2e1542;
+	L_failed_2e1542:;
+	t_abortsite_2e1396 = ((u64)22UL);
+	goto L_abort_2e1397;
+	L_passed_2e1543:;
+	t__2e1556 = (u64)(u32)(-(u32)((u64)625UL));
+	t__2e1557 = (u64)((i64)(i32)t__2e1556);
+	t__2e1558 = (u64)((u64)t__2e1557 * (u64)((u64)1717986919UL));
+	t__2e1559 = (u64)((i64)t__2e1558 >> (((u64)33UL) & 63));
+	t__2e1560 = (u64)((u64)t__2e1557 >> (((u64)63UL) & 63));
+	t__2e1559 = (u64)((u64)t__2e1559 + (u64)t__2e1560);
+	t__2e1555 = (u64)(u32)t__2e1559;
+	t__2e1561 = (u64)(u32)(-(u32)((u64)125UL));
+	t__2e1554 = (u64)(u32)(((u32)t__2e1555 == (u32)t__2e1561));
+	if ((u32)t__2e1554) goto L_passed_2e1553; else goto L_failed_2e1552;
+	L_failed_2e1552:;
+	t_abortsite_2e1396 = ((u64)23UL);
+	goto L_abort_2e1397;
+	L_passed_2e1553:;
+	t__2e1566 = (u64)(u32)(-(u32)((u64)5UL));
+	t__2e1567 = (u64)((i64)(i32)((u64)625UL));
+	t__2e1568 = (u64)((u64)t__2e1567 * (u64)((u64)1717986919UL));
+	t__2e1569 = (u64)((i64)t__2e1568 >> (((u64)33UL) & 63));
+	t__2e1570 = (u64)((u64)t__2e1567 >> (((u64)63UL) & 63));
+	t__2e1569 = (u64)((u64)t__2e1569 + (u64)t__2e1570);
+	t__2e1569 = (u64)(-(u64)t__2e1569);
+	t__2e1565 = (u64)(u32)t__2e1569;
+	t__2e1571 = (u64)(u32)(-(u32)((u64)125UL));
+	t__2e1564 = (u64)(u32)(((u32)t__2e1565 == (u32)t__2e1571));
+	if ((u32)t__2e1564) goto L_passed_2e1563; else goto L_failed_2e1562;
+	L_failed_2e1562:;
+	t_abortsite_2e1396 = ((u64)24UL);
+	goto L_abort_2e1397;
+	L_passed_2e1563:;
+	t__2e1576 = (u64)(u32)(-(u32)((u64)625UL));
+	t__2e1577 = (u64)(u32)(-(u32)((u64)5UL));
+	t__2e1578 = (u64)((i64)(i32)t__2e1576);
+	t__2e1579 = (u64)((u64)t__2e1578 * (u64)((u64)1717986919UL));
+	t__2e1580 = (u64)((i64)t__2e1579 >> (((u64)33UL) & 63));
+	t__2e1581 = (u64)((u64)t__2e1578 >> (((u64)63UL) & 63));
+	t__2e1580 = (u64)((u64)t__2e1580 + (u64)t__2e1581);
+	t__2e1580 = (u64)(-(u64)t__2e1580);
+	t__2e1575 = (u64)(u32)t__2e1580;
+	t__2e1574 = (u64)(u32)(((u32)t__2e1575 == (u32)((u64)125UL)));
+	if ((u32)t__2e1574) goto L_passed_2e1573; else goto L_failed_2e1572;
+	L_failed_2e1572:;
+	t_abortsite_2e1396 = ((u64)25UL);
+	goto L_abort_2e1397;
+	L_passed_2e1573:;
+	t__2e1586 = (u64)(u32)(-(u32)((u64)1337UL));
+	t__2e1587 = (u64)((i64)(i32)t__2e1586);
+	t__2e1588 = (u64)((u64)t__2e1587 * (u64)((u64)3564057141UL));
+	t__2e1589 = (u64)((i64)t__2e1588 >> (((u64)42UL) & 63));
+	t__2e1590 = (u64)((u64)t__2e1587 >> (((u64)63UL) & 63));
+	t__2e1589 = (u64)((u64)t__2e1589 + (u64)t__2e1590);
+	t__2e1589 = (u64)((u64)t__2e1589 * (u64)((u64)1234UL));
+	t__2e1589 = (u64)((u64)t__2e1587 - (u64)t__2e1589);
+	t__2e1585 = (u64)(u32)t__2e1589;
+	t__2e1591 = (u64)(u32)(-(u32)((u64)103UL));
+	t__2e1584 = (u64)(u32)(((u32)t__2e1585 == (u32)t__2e1591));
+	if ((u32)t__2e1584) goto L_passed_2e1583; else goto L_failed_2e1582;
+	L_failed_2e1582:;
+	t_abortsite_2e1396 = ((u64)26UL);
+	goto L_abort_2e1397;
+	L_passed_2e1583:;
+	t__2e1596 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1597 = (u64)((i64)(i32)((u64)1337UL));
+	t__2e1598 = (u64)((u64)t__2e1597 * (u64)((u64)3564057141UL));
+	t__2e1599 = (u64)((i64)t__2e1598 >> (((u64)42UL) & 63));
+	t__2e1600 = (u64)((u64)t__2e1597 >> (((u64)63UL) & 63));
+	t__2e1599 = (u64)((u64)t__2e1599 + (u64)t__2e1600);
+	t__2e1599 = (u64)((u64)t__2e1599 * (u64)((u64)1234UL));
+	t__2e1599 = (u64)((u64)t__2e1597 - (u64)t__2e1599);
+	t__2e1595 = (u64)(u32)t__2e1599;
+	t__2e1594 = (u64)(u32)(((u32)t__2e1595 == (u32)((u64)103UL)));
+	if ((u32)t__2e1594) goto L_passed_2e1593; else goto L_failed_2e1592;
+	L_failed_2e1592:;
+	t_abortsite_2e1396 = ((u64)27UL);
+	goto L_abort_2e1397;
+	L_passed_2e1593:;
+	t__2e1605 = (u64)(u32)(-(u32)((u64)1337UL));
+	t__2e1606 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1607 = (u64)((i64)(i32)t__2e1605);
+	t__2e1608 = (u64)((u64)t__2e1607 * (u64)((u64)3564057141UL));
+	t__2e1609 = (u64)((i64)t__2e1608 >> (((u64)42UL) & 63));
+	t__2e1610 = (u64)((u64)t__2e1607 >> (((u64)63UL) & 63));
+	t__2e1609 = (u64)((u64)t__2e1609 + (u64)t__2e1610);
+	t__2e1609 = (u64)((u64)t__2e1609 * (u64)((u64)1234UL));
+	t__2e1609 = (u64)((u64)t__2e1607 - (u64)t__2e1609);
+	t__2e1604 = (u64)(u32)t__2e1609;
+	t__2e1611 = (u64)(u32)(-(u32)((u64)103UL));
+	t__2e1603 = (u64)(u32)(((u32)t__2e1604 == (u32)t__2e1611));
+	if ((u32)t__2e1603) goto L_passed_2e1602; else goto L_failed_2e1601;
+	L_failed_2e1601:;
+	t_abortsite_2e1396 = ((u64)28UL);
+	goto L_abort_2e1397;
+	L_passed_2e1602:;
+	t__2e1616 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1617 = (u64)((i64)(i32)t__2e1616);
+	t__2e1618 = (u64)((u64)t__2e1617 * (u64)((u64)1644744395UL));
+	t__2e1619 = (u64)((i64)t__2e1618 >> (((u64)41UL) & 63));
+	t__2e1620 = (u64)((u64)t__2e1617 >> (((u64)63UL) & 63));
+	t__2e1619 = (u64)((u64)t__2e1619 + (u64)t__2e1620);
+	t__2e1619 = (u64)((u64)t__2e1619 * (u64)((u64)1337UL));
+	t__2e1619 = (u64)((u64)t__2e1617 - (u64)t__2e1619);
+	t__2e1615 = (u64)(u32)t__2e1619;
+	t__2e1621 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1614 = (u64)(u32)(((u32)t__2e1615 == (u32)t__2e1621));
+	if ((u32)t__2e1614) goto L_passed_2e1613; else goto L_failed_2e1612;
+	L_failed_2e1612:;
+	t_abortsite_2e1396 = ((u64)29UL);
+	goto L_abort_2e1397;
+	L_passed_2e1613:;
+	t__2e1626 = (u64)(u32)(-(u32)((u64)1337UL));
+	t__2e1627 = (u64)((i64)(i32)((u64)1234UL));
+	t__2e1628 = (u64)((u64)t__2e1627 * (u64)((u64)1644744395UL));
+	t__2e1629 = (u64)((i64)t__2e1628 >> (((u64)41UL) & 63));
+	t__2e1630 = (u64)((u64)t__2e1627 >> (((u64)63UL) & 63));
+	t__2e1629 = (u64)((u64)t__2e1629 + (u64)t__2e1630);
+	t__2e1629 = (u64)((u64)t__2e1629 * (u64)((u64)1337UL));
+	t__2e1629 = (u64)((u64)t__2e1627 - (u64)t__2e1629);
+	t__2e1625 = (u64)(u32)t__2e1629;
+	t__2e1624 = (u64)(u32)(((u32)t__2e1625 == (u32)((u64)1234UL)));
+	if ((u32)t__2e1624) goto L_passed_2e1623; else goto L_failed_2e1622;
+	L_failed_2e1622:;
+	t_abortsite_2e1396 = ((u64)30UL);
+	goto L_abort_2e1397;
+	L_passed_2e1623:;
+	t__2e1635 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1636 = (u64)(u32)(-(u32)((u64)1337UL));
+	t__2e1637 = (u64)((i64)(i32)t__2e1635);
+	t__2e1638 = (u64)((u64)t__2e1637 * (u64)((u64)1644744395UL));
+	t__2e1639 = (u64)((i64)t__2e1638 >> (((u64)41UL) & 63));
+	t__2e1640 = (u64)((u64)t__2e1637 >> (((u64)63UL) & 63));
+	t__2e1639 = (u64)((u64)t__2e1639 + (u64)t__2e1640);
+	t__2e1639 = (u64)((u64)t__2e1639 * (u64)((u64)1337UL));
+	t__2e1639 = (u64)((u64)t__2e1637 - (u64)t__2e1639);
+	t__2e1634 = (u64)(u32)t__2e1639;
+	t__2e1641 = (u64)(u32)(-(u32)((u64)1234UL));
+	t__2e1633 = (u64)(u32)(((u32)t__2e1634 == (u32)t__2e1641));
+	if ((u32)t__2e1633) goto L_passed_2e1632; else goto L_failed_2e1631;
+	L_failed_2e1631:;
+	t_abortsite_2e1396 = ((u64)31UL);
+	goto L_abort_2e1397;
+	L_passed_2e1632:;
+	t__2e1646 = (u64)(u32)(-(u32)((u64)625UL));
+	t__2e1647 = (u64)((i64)(i32)t__2e1646);
+	t__2e1648 = (u64)((u64)t__2e1647 * (u64)((u64)1717986919UL));
+	t__2e1649 = (u64)((i64)t__2e1648 >> (((u64)33UL) & 63));
+	t__2e1650 = (u64)((u64)t__2e1647 >> (((u64)63UL) & 63));
+	t__2e1649 = (u64)((u64)t__2e1649 + (u64)t__2e1650);
+	t__2e1649 = (u64)((u64)t__2e1649 * (u64)((u64)5UL));
+	t__2e1649 = (u64)((u64)t__2e1647 - (u64)t__2e1649);
+	t__2e1645 = (u64)(u32)t__2e1649;
+	t__2e1644 = (u64)(u32)(((u32)t__2e1645 == (u32)((u64)0UL)));
+	if ((u32)t__2e1644) goto L_passed_2e1643; else goto L_failed_2e1642;
+	L_failed_2e1642:;
+	t_abortsite_2e1396 = ((u64)32UL);
+	goto L_abort_2e1397;
+	L_passed_2e1643:;
+	t__2e1655 = (u64)(u32)(-(u32)((u64)5UL));
+	t__2e1656 = (u64)((i64)(i32)((u64)625UL));
+	t__2e1657 = (u64)((u64)t__2e1656 * (u64)((u64)1717986919UL));
+	t__2e1658 = (u64)((i64)t__2e1657 >> (((u64)33UL) & 63));
+	t__2e1659 = (u64)((u64)t__2e1656 >> (((u64)63UL) & 63));
+	t__2e1658 = (u64)((u64)t__2e1658 + (u64)t__2e1659);
+	t__2e1658 = (u64)((u64)t__2e1658 * (u64)((u64)5UL));
+	t__2e1658 = (u64)((u64)t__2e1656 - (u64)t__2e1658);
+	t__2e1654 = (u64)(u32)t__2e1658;
+	t__2e1653 = (u64)(u32)(((u32)t__2e1654 == (u32)((u64)0UL)));
+	if ((u32)t__2e1653) goto L_passed_2e1652; else goto L_failed_2e1651;
+	L_failed_2e1651:;
+	t_abortsite_2e1396 = ((u64)33UL);
+	goto L_abort_2e1397;
+	L_passed_2e1652:;
+	t__2e1664 = (u64)(u32)(-(u32)((u64)625UL));
+	t__2e1665 = (u64)(u32)(-(u32)((u64)5UL));
+	t__2e1666 = (u64)((i64)(i32)t__2e1664);
+	t__2e1667 = (u64)((u64)t__2e1666 * (u64)((u64)1717986919UL));
+	t__2e1668 = (u64)((i64)t__2e1667 >> (((u64)33UL) & 63));
+	t__2e1669 = (u64)((u64)t__2e1666 >> (((u64)63UL) & 63));
+	t__2e1668 = (u64)((u64)t__2e1668 + (u64)t__2e1669);
+	t__2e1668 = (u64)((u64)t__2e1668 * (u64)((u64)5UL));
+	t__2e1668 = (u64)((u64)t__2e1666 - (u64)t__2e1668);
+	t__2e1663 = (u64)(u32)t__2e1668;
+	t__2e1662 = (u64)(u32)(((u32)t__2e1663 == (u32)((u64)0UL)));
+	if ((u32)t__2e1662) goto L_passed_2e1661; else goto L_failed_2e1660;
+	L_failed_2e1660:;
+	t_abortsite_2e1396 = ((u64)34UL);
+	goto L_abort_2e1397;
+	L_passed_2e1661:;
+	goto L__2e1389;
+	L__2e1670:;
+	L__2e1389:;
+	return;
+	L_abort_2e1397:;
+	t__2e1398 = (u64)((u64)t_abortsite_2e1396 * (u64)((u64)16UL));
+	t__2e1398 = (u64)((u64)((u64)((char *)&D_abortsites_2e1395)) + (u64)t__2e1398);
+	t__2e1399 = (u64)(*(u64 *)t__2e1398);
+	t__2e1400 = (u64)((u64)t__2e1398 + (u64)((u64)8UL));
+	t__2e1401 = (u64)(*(u32 *)t__2e1400);
+	t__2e1400 = (u64)((u64)t__2e1398 + (u64)((u64)12UL));
+	t__2e1402 = (u64)(*(u32 *)t__2e1400);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1399, (u64)t__2e1401, (u64)t__2e1402, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_sar__shr(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e1677;
+	u64 t__2e1678;
+	u64 t__2e1679;
+	u64 t__2e1680;
+	u64 t__2e1684;
+	u64 t__2e1685;
+	u64 t__2e1686;
+	u64 t__2e1687;
+	u64 t__2e1688;
+	u64 t__2e1690;
+	u64 t__2e1693;
+	u64 t__2e1694;
+	u64 t__2e1695;
+	u64 t__2e1696;
+	u64 t__2e1699;
+	u64 t__2e1700;
+	u64 t__2e1701;
+	u64 t__2e1703;
+	u64 t__2e1706;
+	u64 t__2e1707;
+	u64 t__2e1708;
+	u64 t__2e1711;
+	u64 t__2e1712;
+	u64 t__2e1715;
+	u64 t__2e1716;
+	u64 t__2e1717;
+	u64 t__2e1718;
+	u64 t__2e1720;
+	u64 t__2e1722;
+	u64 t__2e1723;
+	u64 t__2e1724;
+	u64 t__2e1725;
+	u64 t__2e1728;
+	u64 t__2e1729;
+	u64 t__2e1730;
+	u64 t_abortsite_2e1682;
+	u64 t_binding_2e1689;
+	u64 t_binding_2e1702;
+	u64 t_binding_2e1719;
+	u64 t_binding_2e1721;
+	L_start_2e1671:;
+	t_binding_2e1689 = (u64)A0;
+	t_binding_2e1702 = (u64)A1;
+	t_binding_2e1719 = (u64)A2;
+	t_binding_2e1721 = (u64)A3;
+	L_body_2e1672:;
+	t__2e1679 = (u64)(-(u64)((u64)12697259629065987UL));
+	t__2e1678 = (u64)((i64)t__2e1679 >> (((u64)26UL) & 63));
+	t__2e1680 = (u64)(-(u64)((u64)189203913UL));
+	t__2e1677 = (u64)(u32)(((u64)t__2e1678 == (u64)t__2e1680));
+	if ((u32)t__2e1677) goto L_passed_2e1676; else goto L_failed_2e1675;
+	L_failed_2e1675:;
+	t_abortsite_2e1682 = ((u64)0UL);
+	goto L_abort_2e1683;
+	L_passed_2e1676:;
+	*(u64 *)t_binding_2e1689 = (u64)((u64)1UL);
+	t__2e1690 = (u64)(*(u64 *)t_binding_2e1689);
+	t__2e1690 = (u64)((u64)t__2e1690 << (((u64)63UL) & 63));
+	*(u64 *)t_binding_2e1689 = (u64)t__2e1690;
+	t__2e1694 = (u64)(*(u64 *)t_binding_2e1689);
+	t__2e1695 = (u64)(-(u64)((u64)9223372036854775808UL));
+	t__2e1693 = (u64)(u32)(((u64)t__2e1694 == (u64)t__2e1695));
+	if ((u32)t__2e1693) goto L_passed_2e1692; else goto L_failed_2e1691;
+	L_failed_2e1691:;
+	t_abortsite_2e1682 = ((u64)1UL);
+	goto L_abort_2e1683;
+	L_passed_2e1692:;
+	t__2e1696 = (u64)(*(u64 *)t_binding_2e1689);
+	t__2e1696 = (u64)((i64)t__2e1696 >> (((u64)63UL) & 63));
+	*(u64 *)t_binding_2e1689 = (u64)t__2e1696;
+	t__2e1700 = (u64)(*(u64 *)t_binding_2e1689);
+	t__2e1701 = (u64)(-(u64)((u64)1UL));
+	t__2e1699 = (u64)(u32)(((u64)t__2e1700 == (u64)t__2e1701));
+	if ((u32)t__2e1699) goto L_passed_2e1698; else goto L_failed_2e1697;
+	L_failed_2e1697:;
+	t_abortsite_2e1682 = ((u64)2UL);
+	goto L_abort_2e1683;
+	L_passed_2e1698:;
+	*(u64 *)t_binding_2e1702 = (u64)((u64)1UL);
+	t__2e1703 = (u64)(*(u64 *)t_binding_2e1702);
+	t__2e1703 = (u64)((u64)t__2e1703 << (((u64)63UL) & 63));
+	*(u64 *)t_binding_2e1702 = (u64)t__2e1703;
+	t__2e1707 = (u64)(*(u64 *)t_binding_2e1702);
+	t__2e1706 = (u64)(u32)(((u64)t__2e1707 == (u64)((u64)9223372036854775808UL)));
+	if ((u32)t__2e1706) goto L_passed_2e1705; else goto L_failed_2e1704;
+	L_failed_2e1704:;
+	t_abortsite_2e1682 = ((u64)3UL);
+	goto L_abort_2e1683;
+	L_passed_2e1705:;
+	t__2e1708 = (u64)(*(u64 *)t_binding_2e1702);
+	t__2e1708 = (u64)((u64)t__2e1708 >> (((u64)63UL) & 63));
+	*(u64 *)t_binding_2e1702 = (u64)t__2e1708;
+	t__2e1712 = (u64)(*(u64 *)t_binding_2e1702);
+	t__2e1711 = (u64)(u32)(((u64)t__2e1712 == (u64)((u64)1UL)));
+	if ((u32)t__2e1711) goto L_passed_2e1710; else goto L_failed_2e1709;
+	L_failed_2e1709:;
+	t_abortsite_2e1682 = ((u64)4UL);
+	goto L_abort_2e1683;
+	L_passed_2e1710:;
+	t__2e1717 = (u64)(u32)(-(u32)((u64)4UL));
+	t__2e1716 = (u64)(u32)((i32)t__2e1717 >> (((u64)1UL) & 31));
+	t__2e1718 = (u64)(u32)(-(u32)((u64)2UL));
+	t__2e1715 = (u64)(u32)(((u32)t__2e1716 == (u32)t__2e1718));
+	if ((u32)t__2e1715) goto L_passed_2e1714; else goto L_failed_2e1713;
+	L_failed_2e1713:;
+	t_abortsite_2e1682 = ((u64)5UL);
+	goto L_abort_2e1683;
+	L_passed_2e1714:;
+	t__2e1720 = (u64)(-(u64)((u64)12697259629065987UL));
+	*(u64 *)t_binding_2e1719 = (u64)t__2e1720;
+	t__2e1724 = (u64)(*(u64 *)t_binding_2e1719);
+	t__2e1725 = (u64)((u64)((u64)1UL) << (((u64)25UL) & 63));
+	t__2e1723 = (u64)((u64)t__2e1724 + (u64)t__2e1725);
+	t__2e1722 = (u64)((i64)t__2e1723 >> (((u64)26UL) & 63));
+	*(u64 *)t_binding_2e1721 = (u64)t__2e1722;
+	t__2e1729 = (u64)(*(u64 *)t_binding_2e1721);
+	t__2e1730 = (u64)(-(u64)((u64)189203912UL));
+	t__2e1728 = (u64)(u32)(((u64)t__2e1729 == (u64)t__2e1730));
+	if ((u32)t__2e1728) goto L_passed_2e1727; else goto L_failed_2e1726;
+	L_failed_2e1726:;
+	t_abortsite_2e1682 = ((u64)6UL);
+	goto L_abort_2e1683;
+	L_passed_2e1727:;
+	goto L__2e1673;
+	L__2e1731:;
+	L__2e1673:;
+	return;
+	L_abort_2e1683:;
+	t__2e1684 = (u64)((u64)t_abortsite_2e1682 * (u64)((u64)16UL));
+	t__2e1684 = (u64)((u64)((u64)((char *)&D_abortsites_2e1681)) + (u64)t__2e1684);
+	t__2e1685 = (u64)(*(u64 *)t__2e1684);
+	t__2e1686 = (u64)((u64)t__2e1684 + (u64)((u64)8UL));
+	t__2e1687 = (u64)(*(u32 *)t__2e1686);
+	t__2e1686 = (u64)((u64)t__2e1684 + (u64)((u64)12UL));
+	t__2e1688 = (u64)(*(u32 *)t__2e1686);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1685, (u64)t__2e1687, (u64)t__2e1688, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_andorxor(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[1] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[1] __attribute__((aligned(16)));
+	char A5[1] __attribute__((aligned(16)));
+	u64 t__2e1738;
+	u64 t__2e1739;
+	u64 t__2e1742;
+	u64 t__2e1743;
+	u64 t__2e1747;
+	u64 t__2e1748;
+	u64 t__2e1749;
+	u64 t__2e1750;
+	u64 t__2e1751;
+	u64 t__2e1754;
+	u64 t__2e1755;
+	u64 t__2e1758;
+	u64 t__2e1759;
+	u64 t__2e1762;
+	u64 t__2e1763;
+	u64 t__2e1766;
+	u64 t__2e1767;
+	u64 t__2e1770;
+	u64 t__2e1771;
+	u64 t__2e1774;
+	u64 t__2e1775;
+	u64 t__2e1778;
+	u64 t__2e1779;
+	u64 t__2e1782;
+	u64 t__2e1783;
+	u64 t__2e1784;
+	u64 t__2e1788;
+	u64 t__2e1789;
+	u64 t__2e1792;
+	u64 t__2e1793;
+	u64 t__2e1794;
+	u64 t__2e1797;
+	u64 t__2e1798;
+	u64 t__2e1803;
+	u64 t__2e1806;
+	u64 t__2e1807;
+	u64 t__2e1808;
+	u64 t__2e1811;
+	u64 t__2e1812;
+	u64 t__2e1815;
+	u64 t__2e1816;
+	u64 t__2e1819;
+	u64 t__2e1820;
+	u64 t__2e1823;
+	u64 t__2e1824;
+	u64 t__2e1827;
+	u64 t__2e1830;
+	u64 t__2e1833;
+	u64 t__2e1836;
+	u64 t__2e1837;
+	u64 t__2e1840;
+	u64 t__2e1841;
+	u64 t__2e1844;
+	u64 t__2e1845;
+	u64 t__2e1848;
+	u64 t__2e1849;
+	u64 t__2e1852;
+	u64 t__2e1853;
+	u64 t__2e1856;
+	u64 t__2e1857;
+	u64 t__2e1860;
+	u64 t__2e1861;
+	u64 t__2e1864;
+	u64 t__2e1865;
+	u64 t__2e1868;
+	u64 t__2e1869;
+	u64 t__2e1872;
+	u64 t__2e1873;
+	u64 t__2e1874;
+	u64 t__2e1877;
+	u64 t__2e1878;
+	u64 t__2e1881;
+	u64 t__2e1882;
+	u64 t__2e1883;
+	u64 t__2e1886;
+	u64 t__2e1887;
+	u64 t__2e1892;
+	u64 t__2e1895;
+	u64 t__2e1896;
+	u64 t__2e1899;
+	u64 t__2e1900;
+	u64 t__2e1903;
+	u64 t__2e1906;
+	u64 t__2e1909;
+	u64 t__2e1910;
+	u64 t__2e1911;
+	u64 t__2e1914;
+	u64 t__2e1915;
+	u64 t__2e1918;
+	u64 t__2e1921;
+	u64 t__2e1922;
+	u64 t__2e1923;
+	u64 t__2e1926;
+	u64 t__2e1927;
+	u64 t__2e1928;
+	u64 t__2e1929;
+	u64 t__2e1930;
+	u64 t__2e1931;
+	u64 t__2e1934;
+	u64 t__2e1935;
+	u64 t__2e1936;
+	u64 t__2e1937;
+	u64 t__2e1938;
+	u64 t__2e1939;
+	u64 t__2e1942;
+	u64 t__2e1943;
+	u64 t__2e1944;
+	u64 t__2e1945;
+	u64 t__2e1946;
+	u64 t__2e1947;
+	u64 t__2e1950;
+	u64 t__2e1951;
+	u64 t__2e1952;
+	u64 t__2e1953;
+	u64 t__2e1954;
+	u64 t__2e1955;
+	u64 t__2e1957;
+	u64 t__2e1958;
+	u64 t__2e1959;
+	u64 t__2e1962;
+	u64 t__2e1963;
+	u64 t__2e1964;
+	u64 t__2e1965;
+	u64 t__2e1966;
+	u64 t__2e1967;
+	u64 t__2e1970;
+	u64 t__2e1971;
+	u64 t__2e1972;
+	u64 t__2e1973;
+	u64 t__2e1974;
+	u64 t__2e1975;
+	u64 t__2e1978;
+	u64 t__2e1979;
+	u64 t__2e1980;
+	u64 t__2e1981;
+	u64 t__2e1984;
+	u64 t_abortsite_2e1745;
+	u64 t_binding_2e1785;
+	u64 t_binding_2e1799;
+	u64 t_binding_2e1800;
+	u64 t_binding_2e1888;
+	u64 t_binding_2e1889;
+	u64 t_binding_2e1956;
+	L_start_2e1732:;
+	t_binding_2e1785 = (u64)A0;
+	t_binding_2e1799 = (u64)A1;
+	t_binding_2e1800 = (u64)A2;
+	t_binding_2e1888 = (u64)A3;
+	t_binding_2e1889 = (u64)A4;
+	t_binding_2e1956 = (u64)A5;
+	L_body_2e1733:;
+	t__2e1739 = (u64)(u32)((u64)0UL);
+	if ((u32)t__2e1739) goto L__2e1741; else goto L__2e1740;
+	L__2e1740:;
+	t__2e1739 = (u64)(u32)((u64)0UL);
+	goto L__2e1741;
+	L__2e1741:;
+	t__2e1742 = (u64)(u32)((u8)t__2e1739);
+	t__2e1743 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1738 = (u64)(u32)(((u32)t__2e1742 == (u32)t__2e1743));
+	if ((u32)t__2e1738) goto L_passed_2e1737; else goto L_failed_2e1736;
+	L_failed_2e1736:;
+	t_abortsite_2e1745 = ((u64)0UL);
+	goto L_abort_2e1746;
+	L_passed_2e1737:;
+	t__2e1755 = (u64)(u32)((u64)0UL);
+	if ((u32)t__2e1755) goto L__2e1757; else goto L__2e1756;
+	L__2e1756:;
+	t__2e1755 = (u64)(u32)((u64)1UL);
+	goto L__2e1757;
+	L__2e1757:;
+	t__2e1758 = (u64)(u32)((u8)t__2e1755);
+	t__2e1759 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1754 = (u64)(u32)(((u32)t__2e1758 == (u32)t__2e1759));
+	if ((u32)t__2e1754) goto L_passed_2e1753; else goto L_failed_2e1752;
+	L_failed_2e1752:;
+	t_abortsite_2e1745 = ((u64)1UL);
+	goto L_abort_2e1746;
+	L_passed_2e1753:;
+	t__2e1763 = (u64)(u32)((u64)1UL);
+	if ((u32)t__2e1763) goto L__2e1765; else goto L__2e1764;
+	L__2e1764:;
+	t__2e1763 = (u64)(u32)((u64)0UL);
+	goto L__2e1765;
+	L__2e1765:;
+	t__2e1766 = (u64)(u32)((u8)t__2e1763);
+	t__2e1767 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1762 = (u64)(u32)(((u32)t__2e1766 == (u32)t__2e1767));
+	if ((u32)t__2e1762) goto L_passed_2e1761; else goto L_failed_2e1760;
+	L_failed_2e1760:;
+	t_abortsite_2e1745 = ((u64)2UL);
+	goto L_abort_2e1746;
+	L_passed_2e1761:;
+	t__2e1771 = (u64)(u32)((u64)1UL);
+	if ((u32)t__2e1771) goto L__2e1773; else goto L__2e1772;
+	L__2e1772:;
+	t__2e1771 = (u64)(u32)((u64)1UL);
+	goto L__2e1773;
+	L__2e1773:;
+	t__2e1774 = (u64)(u32)((u8)t__2e1771);
+	t__2e1775 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1770 = (u64)(u32)(((u32)t__2e1774 == (u32)t__2e1775));
+	if ((u32)t__2e1770) goto L_passed_2e1769; else goto L_failed_2e1768;
+	L_failed_2e1768:;
+	t_abortsite_2e1745 = ((u64)3UL);
+	goto L_abort_2e1746;
+	L_passed_2e1769:;
+	t__2e1779 = (u64)(u32)((u64)1UL);
+	if ((u32)t__2e1779) goto L__2e1781; else goto L__2e1780;
+	L__2e1780:;
+	t__2e1782 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_error)))());
+	t__2e1779 = (u64)(u32)t__2e1782;
+	goto L__2e1781;
+	L__2e1781:;
+	t__2e1783 = (u64)(u32)((u8)t__2e1779);
+	t__2e1784 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1778 = (u64)(u32)(((u32)t__2e1783 == (u32)t__2e1784));
+	if ((u32)t__2e1778) goto L_passed_2e1777; else goto L_failed_2e1776;
+	L_failed_2e1776:;
+	t_abortsite_2e1745 = ((u64)4UL);
+	goto L_abort_2e1746;
+	L_passed_2e1777:;
+	*(u32 *)t_binding_2e1785 = (u32)((u64)0UL);
+	t__2e1789 = (u64)(u32)((u64)0UL);
+	if ((u32)t__2e1789) goto L__2e1791; else goto L__2e1790;
+	L__2e1790:;
+	t__2e1792 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_set)))((u64)t_binding_2e1785));
+	t__2e1789 = (u64)(u32)t__2e1792;
+	goto L__2e1791;
+	L__2e1791:;
+	t__2e1793 = (u64)(u32)((u8)t__2e1789);
+	t__2e1794 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1788 = (u64)(u32)(((u32)t__2e1793 == (u32)t__2e1794));
+	if ((u32)t__2e1788) goto L_passed_2e1787; else goto L_failed_2e1786;
+	L_failed_2e1786:;
+	t_abortsite_2e1745 = ((u64)5UL);
+	goto L_abort_2e1746;
+	L_passed_2e1787:;
+	t__2e1798 = (u64)(u32)(*(i32 *)t_binding_2e1785);
+	t__2e1797 = (u64)(u32)(((u32)t__2e1798 == (u32)((u64)42UL)));
+	if ((u32)t__2e1797) goto L_passed_2e1796; else goto L_failed_2e1795;
+	L_failed_2e1795:;
+	t_abortsite_2e1745 = ((u64)6UL);
+	goto L_abort_2e1746;
+	L_passed_2e1796:;
+	*(u32 *)t_binding_2e1799 = (u32)((u64)0UL);
+	*(u8 *)t_binding_2e1800 = (u8)((u64)0UL);
+	t__2e1803 = (u64)(u32)(*(u8 *)t_binding_2e1800);
+	if ((u32)t__2e1803) goto L__2e1802; else goto L__2e1801;
+	L__2e1801:;
+	*(u8 *)t_binding_2e1800 = (u8)((u64)0UL);
+	goto L__2e1802;
+	L__2e1802:;
+	t__2e1806 = (u64)(u32)(*(u8 *)t_binding_2e1800);
+	t__2e1808 = (u64)(u32)((u8)t__2e1806);
+	t__2e1807 = (u64)(u32)(((u32)t__2e1808 == (u32)((u64)0UL)));
+	if ((u32)t__2e1807) goto L_passed_2e1805; else goto L_failed_2e1804;
+	L_failed_2e1804:;
+	t_abortsite_2e1745 = ((u64)7UL);
+	goto L_abort_2e1746;
+	L_passed_2e1805:;
+	t__2e1811 = (u64)(u32)(*(u8 *)t_binding_2e1800);
+	if ((u32)t__2e1811) goto L__2e1810; else goto L__2e1809;
+	L__2e1809:;
+	t__2e1812 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_set)))((u64)t_binding_2e1799));
+	*(u8 *)t_binding_2e1800 = (u8)t__2e1812;
+	goto L__2e1810;
+	L__2e1810:;
+	t__2e1816 = (u64)(u32)(*(i32 *)t_binding_2e1799);
+	t__2e1815 = (u64)(u32)(((u32)t__2e1816 == (u32)((u64)42UL)));
+	if ((u32)t__2e1815) goto L_passed_2e1814; else goto L_failed_2e1813;
+	L_failed_2e1813:;
+	t_abortsite_2e1745 = ((u64)8UL);
+	goto L_abort_2e1746;
+	L_passed_2e1814:;
+	t__2e1819 = (u64)(u32)(*(u8 *)t_binding_2e1800);
+	if ((u32)t__2e1819) goto L_passed_2e1818; else goto L_failed_2e1817;
+	L_failed_2e1817:;
+	t_abortsite_2e1745 = ((u64)9UL);
+	goto L_abort_2e1746;
+	L_passed_2e1818:;
+	t__2e1823 = (u64)(u32)(*(u8 *)t_binding_2e1800);
+	t__2e1820 = (u64)(u32)t__2e1823;
+	if ((u32)t__2e1820) goto L__2e1822; else goto L__2e1821;
+	L__2e1821:;
+	t__2e1824 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_error)))());
+	t__2e1820 = (u64)(u32)t__2e1824;
+	goto L__2e1822;
+	L__2e1822:;
+	t__2e1827 = (u64)(u32)(*(u8 *)t_binding_2e1800);
+	if ((u32)t__2e1827) goto L_passed_2e1826; else goto L_failed_2e1825;
+	L_failed_2e1825:;
+	t_abortsite_2e1745 = ((u64)10UL);
+	goto L_abort_2e1746;
+	L_passed_2e1826:;
+	t__2e1830 = (u64)(u32)(*(u8 *)t_binding_2e1800);
+	if ((u32)t__2e1830) goto L__2e1829; else goto L__2e1828;
+	L__2e1828:;
+	*(u8 *)t_binding_2e1800 = (u8)((u64)0UL);
+	goto L__2e1829;
+	L__2e1829:;
+	t__2e1833 = (u64)(u32)(*(u8 *)t_binding_2e1800);
+	if ((u32)t__2e1833) goto L_passed_2e1832; else goto L_failed_2e1831;
+	L_failed_2e1831:;
+	t_abortsite_2e1745 = ((u64)11UL);
+	goto L_abort_2e1746;
+	L_passed_2e1832:;
+	t__2e1837 = (u64)(u32)((u64)0UL);
+	if ((u32)t__2e1837) goto L__2e1838; else goto L__2e1839;
+	L__2e1838:;
+	t__2e1837 = (u64)(u32)((u64)0UL);
+	goto L__2e1839;
+	L__2e1839:;
+	t__2e1840 = (u64)(u32)((u8)t__2e1837);
+	t__2e1841 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1836 = (u64)(u32)(((u32)t__2e1840 == (u32)t__2e1841));
+	if ((u32)t__2e1836) goto L_passed_2e1835; else goto L_failed_2e1834;
+	L_failed_2e1834:;
+	t_abortsite_2e1745 = ((u64)12UL);
+	goto L_abort_2e1746;
+	L_passed_2e1835:;
+	t__2e1845 = (u64)(u32)((u64)0UL);
+	if ((u32)t__2e1845) goto L__2e1846; else goto L__2e1847;
+	L__2e1846:;
+	t__2e1845 = (u64)(u32)((u64)1UL);
+	goto L__2e1847;
+	L__2e1847:;
+	t__2e1848 = (u64)(u32)((u8)t__2e1845);
+	t__2e1849 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1844 = (u64)(u32)(((u32)t__2e1848 == (u32)t__2e1849));
+	if ((u32)t__2e1844) goto L_passed_2e1843; else goto L_failed_2e1842;
+	L_failed_2e1842:;
+	t_abortsite_2e1745 = ((u64)13UL);
+	goto L_abort_2e1746;
+	L_passed_2e1843:;
+	t__2e1853 = (u64)(u32)((u64)1UL);
+	if ((u32)t__2e1853) goto L__2e1854; else goto L__2e1855;
+	L__2e1854:;
+	t__2e1853 = (u64)(u32)((u64)0UL);
+	goto L__2e1855;
+	L__2e1855:;
+	t__2e1856 = (u64)(u32)((u8)t__2e1853);
+	t__2e1857 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1852 = (u64)(u32)(((u32)t__2e1856 == (u32)t__2e1857));
+	if ((u32)t__2e1852) goto L_passed_2e1851; else goto L_failed_2e1850;
+	L_failed_2e1850:;
+	t_abortsite_2e1745 = ((u64)14UL);
+	goto L_abort_2e1746;
+	L_passed_2e1851:;
+	t__2e1861 = (u64)(u32)((u64)1UL);
+	if ((u32)t__2e1861) goto L__2e1862; else goto L__2e1863;
+	L__2e1862:;
+	t__2e1861 = (u64)(u32)((u64)1UL);
+	goto L__2e1863;
+	L__2e1863:;
+	t__2e1864 = (u64)(u32)((u8)t__2e1861);
+	t__2e1865 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1860 = (u64)(u32)(((u32)t__2e1864 == (u32)t__2e1865));
+	if ((u32)t__2e1860) goto L_passed_2e1859; else goto L_failed_2e1858;
+	L_failed_2e1858:;
+	t_abortsite_2e1745 = ((u64)15UL);
+	goto L_abort_2e1746;
+	L_passed_2e1859:;
+	t__2e1869 = (u64)(u32)((u64)0UL);
+	if ((u32)t__2e1869) goto L__2e1870; else goto L__2e1871;
+	L__2e1870:;
+	t__2e1872 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_error)))());
+	t__2e1869 = (u64)(u32)t__2e1872;
+	goto L__2e1871;
+	L__2e1871:;
+	t__2e1873 = (u64)(u32)((u8)t__2e1869);
+	t__2e1874 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1868 = (u64)(u32)(((u32)t__2e1873 == (u32)t__2e1874));
+	if ((u32)t__2e1868) goto L_passed_2e1867; else goto L_failed_2e1866;
+	L_failed_2e1866:;
+	t_abortsite_2e1745 = ((u64)16UL);
+	goto L_abort_2e1746;
+	L_passed_2e1867:;
+	*(u32 *)t_binding_2e1799 = (u32)((u64)0UL);
+	t__2e1878 = (u64)(u32)((u64)1UL);
+	if ((u32)t__2e1878) goto L__2e1879; else goto L__2e1880;
+	L__2e1879:;
+	t__2e1881 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_set)))((u64)t_binding_2e1799));
+	t__2e1878 = (u64)(u32)t__2e1881;
+	goto L__2e1880;
+	L__2e1880:;
+	t__2e1882 = (u64)(u32)((u8)t__2e1878);
+	t__2e1883 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1877 = (u64)(u32)(((u32)t__2e1882 == (u32)t__2e1883));
+	if ((u32)t__2e1877) goto L_passed_2e1876; else goto L_failed_2e1875;
+	L_failed_2e1875:;
+	t_abortsite_2e1745 = ((u64)17UL);
+	goto L_abort_2e1746;
+	L_passed_2e1876:;
+	t__2e1887 = (u64)(u32)(*(i32 *)t_binding_2e1799);
+	t__2e1886 = (u64)(u32)(((u32)t__2e1887 == (u32)((u64)42UL)));
+	if ((u32)t__2e1886) goto L_passed_2e1885; else goto L_failed_2e1884;
+	L_failed_2e1884:;
+	t_abortsite_2e1745 = ((u64)18UL);
+	goto L_abort_2e1746;
+	L_passed_2e1885:;
+	*(u32 *)t_binding_2e1888 = (u32)((u64)0UL);
+	*(u8 *)t_binding_2e1889 = (u8)((u64)1UL);
+	t__2e1892 = (u64)(u32)(*(u8 *)t_binding_2e1889);
+	if ((u32)t__2e1892) goto L__2e1890; else goto L__2e1891;
+	L__2e1890:;
+	*(u8 *)t_binding_2e1889 = (u8)((u64)1UL);
+	goto L__2e1891;
+	L__2e1891:;
+	t__2e1895 = (u64)(u32)(*(u8 *)t_binding_2e1889);
+	if ((u32)t__2e1895) goto L__2e1893; else goto L__2e1894;
+	L__2e1893:;
+	t__2e1896 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_set)))((u64)t_binding_2e1888));
+	*(u8 *)t_binding_2e1889 = (u8)t__2e1896;
+	goto L__2e1894;
+	L__2e1894:;
+	t__2e1900 = (u64)(u32)(*(i32 *)t_binding_2e1888);
+	t__2e1899 = (u64)(u32)(((u32)t__2e1900 == (u32)((u64)42UL)));
+	if ((u32)t__2e1899) goto L_passed_2e1898; else goto L_failed_2e1897;
+	L_failed_2e1897:;
+	t_abortsite_2e1745 = ((u64)19UL);
+	goto L_abort_2e1746;
+	L_passed_2e1898:;
+	t__2e1903 = (u64)(u32)(*(u8 *)t_binding_2e1889);
+	if ((u32)t__2e1903) goto L_passed_2e1902; else goto L_failed_2e1901;
+	L_failed_2e1901:;
+	t_abortsite_2e1745 = ((u64)20UL);
+	goto L_abort_2e1746;
+	L_passed_2e1902:;
+	t__2e1906 = (u64)(u32)(*(u8 *)t_binding_2e1889);
+	if ((u32)t__2e1906) goto L__2e1904; else goto L__2e1905;
+	L__2e1904:;
+	*(u8 *)t_binding_2e1889 = (u8)((u64)0UL);
+	goto L__2e1905;
+	L__2e1905:;
+	t__2e1909 = (u64)(u32)(*(u8 *)t_binding_2e1889);
+	t__2e1911 = (u64)(u32)((u8)t__2e1909);
+	t__2e1910 = (u64)(u32)(((u32)t__2e1911 == (u32)((u64)0UL)));
+	if ((u32)t__2e1910) goto L_passed_2e1908; else goto L_failed_2e1907;
+	L_failed_2e1907:;
+	t_abortsite_2e1745 = ((u64)21UL);
+	goto L_abort_2e1746;
+	L_passed_2e1908:;
+	t__2e1914 = (u64)(u32)(*(u8 *)t_binding_2e1889);
+	if ((u32)t__2e1914) goto L__2e1912; else goto L__2e1913;
+	L__2e1912:;
+	t__2e1915 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_error)))());
+	*(u8 *)t_binding_2e1889 = (u8)t__2e1915;
+	goto L__2e1913;
+	L__2e1913:;
+	t__2e1918 = (u64)(u32)(*(u8 *)t_binding_2e1889);
+	if ((u32)t__2e1918) goto L__2e1916; else goto L__2e1917;
+	L__2e1916:;
+	*(u8 *)t_binding_2e1889 = (u8)((u64)1UL);
+	goto L__2e1917;
+	L__2e1917:;
+	t__2e1921 = (u64)(u32)(*(u8 *)t_binding_2e1889);
+	t__2e1923 = (u64)(u32)((u8)t__2e1921);
+	t__2e1922 = (u64)(u32)(((u32)t__2e1923 == (u32)((u64)0UL)));
+	if ((u32)t__2e1922) goto L_passed_2e1920; else goto L_failed_2e1919;
+	L_failed_2e1919:;
+	t_abortsite_2e1745 = ((u64)22UL);
+	goto L_abort_2e1746;
+	L_passed_2e1920:;
+	t__2e1928 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1929 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1927 = (u64)(u32)(((u32)t__2e1928 != (u32)t__2e1929));
+	t__2e1930 = (u64)(u32)((u8)t__2e1927);
+	t__2e1931 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1926 = (u64)(u32)(((u32)t__2e1930 == (u32)t__2e1931));
+	if ((u32)t__2e1926) goto L_passed_2e1925; else goto L_failed_2e1924;
+	L_failed_2e1924:;
+	t_abortsite_2e1745 = ((u64)23UL);
+	goto L_abort_2e1746;
+	L_passed_2e1925:;
+	t__2e1936 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1937 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1935 = (u64)(u32)(((u32)t__2e1936 != (u32)t__2e1937));
+	t__2e1938 = (u64)(u32)((u8)t__2e1935);
+	t__2e1939 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1934 = (u64)(u32)(((u32)t__2e1938 == (u32)t__2e1939));
+	if ((u32)t__2e1934) goto L_passed_2e1933; else goto L_failed_2e1932;
+	L_failed_2e1932:;
+	t_abortsite_2e1745 = ((u64)24UL);
+	goto L_abort_2e1746;
+	L_passed_2e1933:;
+	t__2e1944 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1945 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1943 = (u64)(u32)(((u32)t__2e1944 != (u32)t__2e1945));
+	t__2e1946 = (u64)(u32)((u8)t__2e1943);
+	t__2e1947 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1942 = (u64)(u32)(((u32)t__2e1946 == (u32)t__2e1947));
+	if ((u32)t__2e1942) goto L_passed_2e1941; else goto L_failed_2e1940;
+	L_failed_2e1940:;
+	t_abortsite_2e1745 = ((u64)25UL);
+	goto L_abort_2e1746;
+	L_passed_2e1941:;
+	t__2e1952 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1953 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1951 = (u64)(u32)(((u32)t__2e1952 != (u32)t__2e1953));
+	t__2e1954 = (u64)(u32)((u8)t__2e1951);
+	t__2e1955 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1950 = (u64)(u32)(((u32)t__2e1954 == (u32)t__2e1955));
+	if ((u32)t__2e1950) goto L_passed_2e1949; else goto L_failed_2e1948;
+	L_failed_2e1948:;
+	t_abortsite_2e1745 = ((u64)26UL);
+	goto L_abort_2e1746;
+	L_passed_2e1949:;
+	*(u8 *)t_binding_2e1956 = (u8)((u64)1UL);
+	t__2e1957 = (u64)(u32)(*(u8 *)t_binding_2e1956);
+	t__2e1958 = (u64)(u32)((u8)t__2e1957);
+	t__2e1959 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1957 = (u64)(u32)(((u32)t__2e1958 != (u32)t__2e1959));
+	*(u8 *)t_binding_2e1956 = (u8)t__2e1957;
+	t__2e1962 = (u64)(u32)(*(u8 *)t_binding_2e1956);
+	t__2e1964 = (u64)(u32)((u8)t__2e1962);
+	t__2e1963 = (u64)(u32)(((u32)t__2e1964 == (u32)((u64)0UL)));
+	if ((u32)t__2e1963) goto L_passed_2e1961; else goto L_failed_2e1960;
+	L_failed_2e1960:;
+	t_abortsite_2e1745 = ((u64)27UL);
+	goto L_abort_2e1746;
+	L_passed_2e1961:;
+	t__2e1965 = (u64)(u32)(*(u8 *)t_binding_2e1956);
+	t__2e1966 = (u64)(u32)((u8)t__2e1965);
+	t__2e1967 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1965 = (u64)(u32)(((u32)t__2e1966 != (u32)t__2e1967));
+	*(u8 *)t_binding_2e1956 = (u8)t__2e1965;
+	t__2e1970 = (u64)(u32)(*(u8 *)t_binding_2e1956);
+	t__2e1972 = (u64)(u32)((u8)t__2e1970);
+	t__2e1971 = (u64)(u32)(((u32)t__2e1972 == (u32)((u64)0UL)));
+	if ((u32)t__2e1971) goto L_passed_2e1969; else goto L_failed_2e1968;
+	L_failed_2e1968:;
+	t_abortsite_2e1745 = ((u64)28UL);
+	goto L_abort_2e1746;
+	L_passed_2e1969:;
+	t__2e1973 = (u64)(u32)(*(u8 *)t_binding_2e1956);
+	t__2e1974 = (u64)(u32)((u8)t__2e1973);
+	t__2e1975 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1973 = (u64)(u32)(((u32)t__2e1974 != (u32)t__2e1975));
+	*(u8 *)t_binding_2e1956 = (u8)t__2e1973;
+	t__2e1978 = (u64)(u32)(*(u8 *)t_binding_2e1956);
+	if ((u32)t__2e1978) goto L_passed_2e1977; else goto L_failed_2e1976;
+	L_failed_2e1976:;
+	t_abortsite_2e1745 = ((u64)29UL);
+	goto L_abort_2e1746;
+	L_passed_2e1977:;
+	t__2e1979 = (u64)(u32)(*(u8 *)t_binding_2e1956);
+	t__2e1980 = (u64)(u32)((u8)t__2e1979);
+	t__2e1981 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1979 = (u64)(u32)(((u32)t__2e1980 != (u32)t__2e1981));
+	*(u8 *)t_binding_2e1956 = (u8)t__2e1979;
+	t__2e1984 = (u64)(u32)(*(u8 *)t_binding_2e1956);
+	if ((u32)t__2e1984) goto L_passed_2e1983; else goto L_failed_2e1982;
+	L_failed_2e1982:;
+	t_abortsite_2e1745 = ((u64)30UL);
+	goto L_abort_2e1746;
+	L_passed_2e1983:;
+	goto L__2e1734;
+	L__2e1985:;
+	L__2e1734:;
+	return;
+	L_abort_2e1746:;
+	t__2e1747 = (u64)((u64)t_abortsite_2e1745 * (u64)((u64)16UL));
+	t__2e1747 = (u64)((u64)((u64)((char *)&D_abortsites_2e1744)) + (u64)t__2e1747);
+	t__2e1748 = (u64)(*(u64 *)t__2e1747);
+	t__2e1749 = (u64)((u64)t__2e1747 + (u64)((u64)8UL));
+	t__2e1750 = (u64)(*(u32 *)t__2e1749);
+	t__2e1749 = (u64)((u64)t__2e1747 + (u64)((u64)12UL));
+	t__2e1751 = (u64)(*(u32 *)t__2e1749);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1748, (u64)t__2e1750, (u64)t__2e1751, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_set(u64 p_x) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e1991;
+	u64 t_param_2e1987;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e1986:;
+	t_param_2e1987 = (u64)A0;
+	*(u64 *)t_param_2e1987 = (u64)t_x;
+	L_body_2e1988:;
+	t__2e1991 = (u64)(*(u64 *)t_param_2e1987);
+	*(u32 *)t__2e1991 = (u32)((u64)42UL);
+	return (u32)((u64)1UL);
+	L__2e1992:;
+	L__2e1989:;
+	L__2e1993:;
+	return 0;
+}
+static u32 F_error(void) {
+	u64 t__2e2001;
+	u64 t__2e2002;
+	u64 t__2e2003;
+	u64 t__2e2004;
+	u64 t__2e2005;
+	u64 t_abortsite_2e1999;
+	L_start_2e1994:;
+	L_body_2e1995:;
+	t_abortsite_2e1999 = ((u64)0UL);
+	goto L_abort_2e2000;
+	L__2e2006:;
+	L__2e1996:;
+	L__2e2007:;
+	return 0;
+	L_abort_2e2000:;
+	t__2e2001 = (u64)((u64)t_abortsite_2e1999 * (u64)((u64)16UL));
+	t__2e2001 = (u64)((u64)((u64)((char *)&D_abortsites_2e1998)) + (u64)t__2e2001);
+	t__2e2002 = (u64)(*(u64 *)t__2e2001);
+	t__2e2003 = (u64)((u64)t__2e2001 + (u64)((u64)8UL));
+	t__2e2004 = (u64)(*(u32 *)t__2e2003);
+	t__2e2003 = (u64)((u64)t__2e2001 + (u64)((u64)12UL));
+	t__2e2005 = (u64)(*(u32 *)t__2e2003);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2002, (u64)t__2e2004, (u64)t__2e2005, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,2531 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2estrcmp[] __asm__("rt.strcmp");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e17 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_callbacks { char *f0; };
+struct __attribute__((packed)) S_chain__mid { char *f0; };
+struct __attribute__((packed)) S_chain__end { u32 f0; };
+struct __attribute__((packed)) S_chain { char *f0; };
+struct __attribute__((packed)) S_strdata_2e72 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e73 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e88 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e89 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e96 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e97 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e104 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e105 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e112 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e113 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e120 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e121 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e128 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e129 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e74 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; };
+struct __attribute__((packed)) S_keywords { char *f0; u64 f1; u64 f2; u32 f3; u8 f4[4]; char *f5; u64 f6; u64 f7; u32 f8; u8 f9[4]; char *f10; u64 f11; u64 f12; u32 f13; u8 f14[4]; char *f15; u64 f16; u64 f17; u32 f18; u8 f19[4]; char *f20; u64 f21; u64 f22; u32 f23; u8 f24[4]; char *f25; u64 f26; u64 f27; u32 f28; u8 f29[4]; char *f30; u64 f31; u64 f32; u32 f33; u8 f34[4]; };
+struct __attribute__((packed)) S_abortsites_2e153 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; };
+struct __attribute__((packed)) S_tagged8__u64 { u32 f0; u8 f1[4]; u64 f2; };
+struct __attribute__((packed)) S_tagged8 { u32 f0; u32 f1; u8 f2[8]; };
+struct __attribute__((packed)) S_tagged4 { u32 f0; u32 f1; };
+struct __attribute__((packed)) S_subtype { u32 f0; u32 f1; };
+struct __attribute__((packed)) S_arr__of__tagged__of__tuple { u32 f0; u32 f1; u32 f2; u32 f3; u32 f4; u32 f5; u32 f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_strdata_2e356 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e357 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e366 { u8 f0[33]; };
+struct __attribute__((packed)) S_strliteral_2e367 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e399 { u8 f0[32]; };
+struct __attribute__((packed)) S_strliteral_2e400 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e312 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; };
+struct __attribute__((packed)) S_tup { u8 f0; u8 f1[7]; char *f2; u64 f3; u64 f4; };
+struct __attribute__((packed)) S_ptr__tup { char *f0; };
+struct __attribute__((packed)) S___struct { u32 f0; u8 f1[4]; u64 f2; };
+struct __attribute__((packed)) S_ptr__struct { char *f0; };
+struct __attribute__((packed)) S_arr { u32 f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_ptr__arr { char *f0; };
+struct __attribute__((packed)) S_val { u32 f0; };
+struct __attribute__((packed)) S_ptr { char *f0; };
+struct __attribute__((packed)) S_abortsites_2e424 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_static_2e13 { u32 f0; };
+struct __attribute__((packed)) S_strdata_2e457 { u8 f0[35]; };
+struct __attribute__((packed)) S_strliteral_2e458 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e491 { u8 f0[37]; };
+struct __attribute__((packed)) S_strliteral_2e492 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e511 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e512 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e531 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e532 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e551 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e552 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e571 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e572 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e591 { u8 f0[13]; u8 f1; u8 f2[6]; u8 f3; u8 f4[1]; };
+struct __attribute__((packed)) S_strliteral_2e592 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e611 { u8 f0[17]; u8 f1; u8 f2[6]; u8 f3; u8 f4[2]; };
+struct __attribute__((packed)) S_strliteral_2e612 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e631 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e632 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e651 { u8 f0[13]; u8 f1; u8 f2[6]; u8 f3; u8 f4[1]; };
+struct __attribute__((packed)) S_strliteral_2e652 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e671 { u8 f0[17]; u8 f1; u8 f2[6]; u8 f3; u8 f4[2]; };
+struct __attribute__((packed)) S_strliteral_2e672 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e691 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e692 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e711 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e712 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e472 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; };
+struct __attribute__((packed)) S_abortsites_2e735 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; };
+struct __attribute__((packed)) S_double { u64 f0; };
+struct __attribute__((packed)) S_float { u32 f0; };
+struct __attribute__((packed)) S_big__value { u64 f0; };
+struct __attribute__((packed)) S_em2__autofill { u32 f0; u32 f1; u8 f2; u8 f3[3]; };
+struct __attribute__((packed)) S_em2 { u32 f0; u32 f1; u8 f2; u8 f3[3]; };
+struct __attribute__((packed)) S_em__autofill { u32 f0; u8 f1; u8 f2[3]; u32 f3; };
+struct __attribute__((packed)) S_em { u32 f0; u8 f1; u8 f2[3]; u32 f3; };
+struct __attribute__((packed)) S_a3 { u32 f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_au { u32 f0; u32 f1; };
+struct __attribute__((packed)) S_su__autofill { u32 f0; u32 f1; };
+struct __attribute__((packed)) S_su { u32 f0; u32 f1; };
+struct __attribute__((packed)) S_strdata_2e971 { u8 f0[6]; };
+struct __attribute__((packed)) S_st { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_sldata_2e972 { u32 f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_sl { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_ar { u32 f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e986 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_nhval { u32 f0; };
+struct __attribute__((packed)) S_nohintconst { u64 f0; };
+struct __attribute__((packed)) S_nohint { u64 f0; };
+struct __attribute__((packed)) S_y { u32 f0; };
+struct __attribute__((packed)) S_x { u32 f0; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e17 D_abortsites_2e17 __asm__("abortsites.17") __attribute__((used, section(".data.rel.ro.abortsites.17"), aligned(8)));
+static struct S_callbacks D_callbacks __asm__("callbacks") __attribute__((used, section(".data.callbacks"), aligned(8)));
+static struct S_chain__mid D_chain__mid __asm__("chain_mid") __attribute__((used, section(".data.chain_mid"), aligned(8)));
+static struct S_chain__end D_chain__end __asm__("chain_end") __attribute__((used, section(".data.chain_end"), aligned(8)));
+static struct S_chain D_chain __asm__("chain") __attribute__((used, section(".data.chain"), aligned(8)));
+static const struct S_strdata_2e72 D_strdata_2e72 __asm__("strdata.72") __attribute__((used, section(".rodata.strdata.72"), aligned(8)));
+static struct S_strliteral_2e73 D_strliteral_2e73 __asm__("strliteral.73") __attribute__((used, section(".data.rel.ro.strliteral.73"), aligned(8)));
+static const struct S_strdata_2e88 D_strdata_2e88 __asm__("strdata.88") __attribute__((used, section(".rodata.strdata.88"), aligned(8)));
+static struct S_strliteral_2e89 D_strliteral_2e89 __asm__("strliteral.89") __attribute__((used, section(".data.rel.ro.strliteral.89"), aligned(8)));
+static const struct S_strdata_2e96 D_strdata_2e96 __asm__("strdata.96") __attribute__((used, section(".rodata.strdata.96"), aligned(8)));
+static struct S_strliteral_2e97 D_strliteral_2e97 __asm__("strliteral.97") __attribute__((used, section(".data.rel.ro.strliteral.97"), aligned(8)));
+static const struct S_strdata_2e104 D_strdata_2e104 __asm__("strdata.104") __attribute__((used, section(".rodata.strdata.104"), aligned(8)));
+static struct S_strliteral_2e105 D_strliteral_2e105 __asm__("strliteral.105") __attribute__((used, section(".data.rel.ro.strliteral.105"), aligned(8)));
+static const struct S_strdata_2e112 D_strdata_2e112 __asm__("strdata.112") __attribute__((used, section(".rodata.strdata.112"), aligned(8)));
+static struct S_strliteral_2e113 D_strliteral_2e113 __asm__("strliteral.113") __attribute__((used, section(".data.rel.ro.strliteral.113"), aligned(8)));
+static const struct S_strdata_2e120 D_strdata_2e120 __asm__("strdata.120") __attribute__((used, section(".rodata.strdata.120"), aligned(8)));
+static struct S_strliteral_2e121 D_strliteral_2e121 __asm__("strliteral.121") __attribute__((used, section(".data.rel.ro.strliteral.121"), aligned(8)));
+static const struct S_strdata_2e128 D_strdata_2e128 __asm__("strdata.128") __attribute__((used, section(".rodata.strdata.128"), aligned(8)));
+static struct S_strliteral_2e129 D_strliteral_2e129 __asm__("strliteral.129") __attribute__((used, section(".data.rel.ro.strliteral.129"), aligned(8)));
+static struct S_abortsites_2e74 D_abortsites_2e74 __asm__("abortsites.74") __attribute__((used, section(".data.rel.ro.abortsites.74"), aligned(8)));
+static struct S_keywords D_keywords __asm__("keywords") __attribute__((used, section(".data.keywords"), aligned(8)));
+static struct S_abortsites_2e153 D_abortsites_2e153 __asm__("abortsites.153") __attribute__((used, section(".data.rel.ro.abortsites.153"), aligned(8)));
+static struct S_tagged8__u64 D_tagged8__u64 __asm__("tagged8_u64") __attribute__((used, section(".data.tagged8_u64"), aligned(8)));
+static struct S_tagged8 D_tagged8 __asm__("tagged8") __attribute__((used, section(".data.tagged8"), aligned(8)));
+static struct S_tagged4 D_tagged4 __asm__("tagged4") __attribute__((used, section(".data.tagged4"), aligned(8)));
+static struct S_subtype D_subtype __asm__("subtype") __attribute__((used, section(".data.subtype"), aligned(8)));
+static struct S_arr__of__tagged__of__tuple D_arr__of__tagged__of__tuple __asm__("arr_of_tagged_of_tuple") __attribute__((used, section(".data.arr_of_tagged_of_tuple"), aligned(8)));
+static const struct S_strdata_2e356 D_strdata_2e356 __asm__("strdata.356") __attribute__((used, section(".rodata.strdata.356"), aligned(8)));
+static struct S_strliteral_2e357 D_strliteral_2e357 __asm__("strliteral.357") __attribute__((used, section(".data.rel.ro.strliteral.357"), aligned(8)));
+static const struct S_strdata_2e366 D_strdata_2e366 __asm__("strdata.366") __attribute__((used, section(".rodata.strdata.366"), aligned(8)));
+static struct S_strliteral_2e367 D_strliteral_2e367 __asm__("strliteral.367") __attribute__((used, section(".data.rel.ro.strliteral.367"), aligned(8)));
+static const struct S_strdata_2e399 D_strdata_2e399 __asm__("strdata.399") __attribute__((used, section(".rodata.strdata.399"), aligned(8)));
+static struct S_strliteral_2e400 D_strliteral_2e400 __asm__("strliteral.400") __attribute__((used, section(".data.rel.ro.strliteral.400"), aligned(8)));
+static struct S_abortsites_2e312 D_abortsites_2e312 __asm__("abortsites.312") __attribute__((used, section(".data.rel.ro.abortsites.312"), aligned(8)));
+static struct S_tup D_tup __asm__("tup") __attribute__((used, section(".data.tup"), aligned(8)));
+static struct S_ptr__tup D_ptr__tup __asm__("ptr_tup") __attribute__((used, section(".data.ptr_tup"), aligned(8)));
+static struct S___struct D___struct __asm__("_struct") __attribute__((used, section(".data._struct"), aligned(8)));
+static struct S_ptr__struct D_ptr__struct __asm__("ptr_struct") __attribute__((used, section(".data.ptr_struct"), aligned(8)));
+static struct S_arr D_arr __asm__("arr") __attribute__((used, section(".data.arr"), aligned(8)));
+static struct S_ptr__arr D_ptr__arr __asm__("ptr_arr") __attribute__((used, section(".data.ptr_arr"), aligned(8)));
+static struct S_val D_val __asm__("val") __attribute__((used, section(".data.val"), aligned(8)));
+static struct S_ptr D_ptr __asm__("ptr") __attribute__((used, section(".data.ptr"), aligned(8)));
+static struct S_abortsites_2e424 D_abortsites_2e424 __asm__("abortsites.424") __attribute__((used, section(".data.rel.ro.abortsites.424"), aligned(8)));
+static struct S_static_2e13 D_static_2e13 __asm__("static.13") __attribute__((used, section(".bss.static.13"), aligned(8)));
+static const struct S_strdata_2e457 D_strdata_2e457 __asm__("strdata.457") __attribute__((used, section(".rodata.strdata.457"), aligned(8)));
+static struct S_strliteral_2e458 D_strliteral_2e458 __asm__("strliteral.458") __attribute__((used, section(".data.rel.ro.strliteral.458"), aligned(8)));
+static const struct S_strdata_2e491 D_strdata_2e491 __asm__("strdata.491") __attribute__((used, section(".rodata.strdata.491"), aligned(8)));
+static struct S_strliteral_2e492 D_strliteral_2e492 __asm__("strliteral.492") __attribute__((used, section(".data.rel.ro.strliteral.492"), aligned(8)));
+static const struct S_strdata_2e511 D_strdata_2e511 __asm__("strdata.511") __attribute__((used, section(".rodata.strdata.511"), aligned(8)));
+static struct S_strliteral_2e512 D_strliteral_2e512 __asm__("strliteral.512") __attribute__((used, section(".data.rel.ro.strliteral.512"), aligned(8)));
+static const struct S_strdata_2e531 D_strdata_2e531 __asm__("strdata.531") __attribute__((used, section(".rodata.strdata.531"), aligned(8)));
+static struct S_strliteral_2e532 D_strliteral_2e532 __asm__("strliteral.532") __attribute__((used, section(".data.rel.ro.strliteral.532"), aligned(8)));
+static const struct S_strdata_2e551 D_strdata_2e551 __asm__("strdata.551") __attribute__((used, section(".rodata.strdata.551"), aligned(8)));
+static struct S_strliteral_2e552 D_strliteral_2e552 __asm__("strliteral.552") __attribute__((used, section(".data.rel.ro.strliteral.552"), aligned(8)));
+static const struct S_strdata_2e571 D_strdata_2e571 __asm__("strdata.571") __attribute__((used, section(".rodata.strdata.571"), aligned(8)));
+static struct S_strliteral_2e572 D_strliteral_2e572 __asm__("strliteral.572") __attribute__((used, section(".data.rel.ro.strliteral.572"), aligned(8)));
+static const struct S_strdata_2e591 D_strdata_2e591 __asm__("strdata.591") __attribute__((used, section(".rodata.strdata.591"), aligned(8)));
+static struct S_strliteral_2e592 D_strliteral_2e592 __asm__("strliteral.592") __attribute__((used, section(".data.rel.ro.strliteral.592"), aligned(8)));
+static const struct S_strdata_2e611 D_strdata_2e611 __asm__("strdata.611") __attribute__((used, section(".rodata.strdata.611"), aligned(8)));
+static struct S_strliteral_2e612 D_strliteral_2e612 __asm__("strliteral.612") __attribute__((used, section(".data.rel.ro.strliteral.612"), aligned(8)));
+static const struct S_strdata_2e631 D_strdata_2e631 __asm__("strdata.631") __attribute__((used, section(".rodata.strdata.631"), aligned(8)));
+static struct S_strliteral_2e632 D_strliteral_2e632 __asm__("strliteral.632") __attribute__((used, section(".data.rel.ro.strliteral.632"), aligned(8)));
+static const struct S_strdata_2e651 D_strdata_2e651 __asm__("strdata.651") __attribute__((used, section(".rodata.strdata.651"), aligned(8)));
+static struct S_strliteral_2e652 D_strliteral_2e652 __asm__("strliteral.652") __attribute__((used, section(".data.rel.ro.strliteral.652"), aligned(8)));
+static const struct S_strdata_2e671 D_strdata_2e671 __asm__("strdata.671") __attribute__((used, section(".rodata.strdata.671"), aligned(8)));
+static struct S_strliteral_2e672 D_strliteral_2e672 __asm__("strliteral.672") __attribute__((used, section(".data.rel.ro.strliteral.672"), aligned(8)));
+static const struct S_strdata_2e691 D_strdata_2e691 __asm__("strdata.691") __attribute__((used, section(".rodata.strdata.691"), aligned(8)));
+static struct S_strliteral_2e692 D_strliteral_2e692 __asm__("strliteral.692") __attribute__((used, section(".data.rel.ro.strliteral.692"), aligned(8)));
+static const struct S_strdata_2e711 D_strdata_2e711 __asm__("strdata.711") __attribute__((used, section(".rodata.strdata.711"), aligned(8)));
+static struct S_strliteral_2e712 D_strliteral_2e712 __asm__("strliteral.712") __attribute__((used, section(".data.rel.ro.strliteral.712"), aligned(8)));
+static struct S_abortsites_2e472 D_abortsites_2e472 __asm__("abortsites.472") __attribute__((used, section(".data.rel.ro.abortsites.472"), aligned(8)));
+static struct S_abortsites_2e735 D_abortsites_2e735 __asm__("abortsites.735") __attribute__((used, section(".data.rel.ro.abortsites.735"), aligned(8)));
+static struct S_double D_double __asm__("double") __attribute__((used, section(".data.double"), aligned(8)));
+static struct S_float D_float __asm__("float") __attribute__((used, section(".data.float"), aligned(8)));
+static struct S_big__value D_big__value __asm__("big_value") __attribute__((used, section(".data.big_value"), aligned(8)));
+static struct S_em2__autofill D_em2__autofill __asm__("em2_autofill") __attribute__((used, section(".bss.em2_autofill"), aligned(8)));
+static struct S_em2 D_em2 __asm__("em2") __attribute__((used, section(".data.em2"), aligned(8)));
+static struct S_em__autofill D_em__autofill __asm__("em_autofill") __attribute__((used, section(".bss.em_autofill"), aligned(8)));
+static struct S_em D_em __asm__("em") __attribute__((used, section(".data.em"), aligned(8)));
+static struct S_a3 D_a3 __asm__("a3") __attribute__((used, section(".bss.a3"), aligned(8)));
+static struct S_au D_au __asm__("au") __attribute__((used, section(".bss.au"), aligned(8)));
+static struct S_su__autofill D_su__autofill __asm__("su_autofill") __attribute__((used, section(".data.su_autofill"), aligned(8)));
+static struct S_su D_su __asm__("su") __attribute__((used, section(".data.su"), aligned(8)));
+static const struct S_strdata_2e971 D_strdata_2e971 __asm__("strdata.971") __attribute__((used, section(".rodata.strdata.971"), aligned(8)));
+static struct S_st D_st __asm__("st") __attribute__((used, section(".data.st"), aligned(8)));
+static struct S_sldata_2e972 D_sldata_2e972 __asm__("sldata.972") __attribute__((used, section(".data.sldata.972"), aligned(8)));
+static struct S_sl D_sl __asm__("sl") __attribute__((used, section(".data.sl"), aligned(8)));
+static struct S_ar D_ar __asm__("ar") __attribute__((used, section(".data.ar"), aligned(8)));
+static struct S_abortsites_2e986 D_abortsites_2e986 __asm__("abortsites.986") __attribute__((used, section(".data.rel.ro.abortsites.986"), aligned(8)));
+static struct S_nhval D_nhval __asm__("nhval") __attribute__((used, section(".data.nhval"), aligned(8)));
+static struct S_nohintconst D_nohintconst __asm__("nohintconst") __attribute__((used, section(".data.nohintconst"), aligned(8)));
+static struct S_nohint D_nohint __asm__("nohint") __attribute__((used, section(".data.nohint"), aligned(8)));
+static struct S_y D_y __asm__("y") __attribute__((used, section(".data.y"), aligned(8)));
+static struct S_x D_x __asm__("x") __attribute__((used, section(".data.x"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_reachable(void) __asm__("reachable") __attribute__((used, section(".text.reachable")));
+static u32 F_callback(void) __asm__("callback") __attribute__((used, section(".text.callback")));
+static void F_tuplearray(void) __asm__("tuplearray") __attribute__((used, section(".text.tuplearray")));
+static void F_tagged(void) __asm__("tagged") __attribute__((used, section(".text.tagged")));
+static void F_pointers(void) __asm__("pointers") __attribute__((used, section(".text.pointers")));
+static void F_static__binding(void) __asm__("static_binding") __attribute__((used, section(".text.static_binding")));
+static u32 F_counter(void) __asm__("counter") __attribute__((used, section(".text.counter")));
+static void F_invalid(void) __asm__("invalid") __attribute__((used, section(".text.invalid")));
+static void F_storage(void) __asm__("storage") __attribute__((used, section(".text.storage")));
+static void F_write(void) __asm__("write") __attribute__((used, section(".text.write")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\061\061\055\147\154\157\142\141\154\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 19U, 19U };
+static struct S_abortsites_2e17 D_abortsites_2e17 = { (char *)((char *)&D_strliteral_2e1) + 0, 220U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 221U, 15U };
+static struct S_callbacks D_callbacks = { (char *)((char *)&F_callback) + 0 };
+static struct S_chain__mid D_chain__mid = { (char *)((char *)&D_chain__end) + 0 };
+static struct S_chain__end D_chain__end = { 3U };
+static struct S_chain D_chain = { (char *)((char *)&D_chain__mid) + 0 };
+static const struct S_strdata_2e72 D_strdata_2e72 = { "\146\156" };
+static struct S_strliteral_2e73 D_strliteral_2e73 = { (char *)((char *)&D_strdata_2e72) + 0, 2U, 2U };
+static const struct S_strdata_2e88 D_strdata_2e88 = { "\146\157\162" };
+static struct S_strliteral_2e89 D_strliteral_2e89 = { (char *)((char *)&D_strdata_2e88) + 0, 3U, 3U };
+static const struct S_strdata_2e96 D_strdata_2e96 = { "\151\146" };
+static struct S_strliteral_2e97 D_strliteral_2e97 = { (char *)((char *)&D_strdata_2e96) + 0, 2U, 2U };
+static const struct S_strdata_2e104 D_strdata_2e104 = { "\151\156" };
+static struct S_strliteral_2e105 D_strliteral_2e105 = { (char *)((char *)&D_strdata_2e104) + 0, 2U, 2U };
+static const struct S_strdata_2e112 D_strdata_2e112 = { "\156\157\164" };
+static struct S_strliteral_2e113 D_strliteral_2e113 = { (char *)((char *)&D_strdata_2e112) + 0, 3U, 3U };
+static const struct S_strdata_2e120 D_strdata_2e120 = { "\163\167\151\164\143\150" };
+static struct S_strliteral_2e121 D_strliteral_2e121 = { (char *)((char *)&D_strdata_2e120) + 0, 6U, 6U };
+static const struct S_strdata_2e128 D_strdata_2e128 = { "\167\150\151\154\145" };
+static struct S_strliteral_2e129 D_strliteral_2e129 = { (char *)((char *)&D_strdata_2e128) + 0, 5U, 5U };
+static struct S_abortsites_2e74 D_abortsites_2e74 = { (char *)((char *)&D_strliteral_2e1) + 0, 247U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 248U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 249U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 250U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 251U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 252U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 253U, 15U };
+static struct S_keywords D_keywords = { (char *)((char *)&D_strdata_2e72) + 0, 2U, 2U, 0U, {0}, (char *)((char *)&D_strdata_2e88) + 0, 3U, 3U, 1U, {0}, (char *)((char *)&D_strdata_2e96) + 0, 2U, 2U, 2U, {0}, (char *)((char *)&D_strdata_2e104) + 0, 2U, 2U, 3U, {0}, (char *)((char *)&D_strdata_2e112) + 0, 3U, 3U, 4U, {0}, (char *)((char *)&D_strdata_2e120) + 0, 6U, 6U, 5U, {0}, (char *)((char *)&D_strdata_2e128) + 0, 5U, 5U, 6U, {0} };
+static struct S_abortsites_2e153 D_abortsites_2e153 = { (char *)((char *)&D_strliteral_2e1) + 0, 164U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 164U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 165U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 165U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 166U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 166U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 167U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 167U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 168U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 168U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 169U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 169U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 170U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 181U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 191U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 192U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 202U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 203U, 15U };
+static struct S_tagged8__u64 D_tagged8__u64 = { 1268499444U, {0}, 10U };
+static struct S_tagged8 D_tagged8 = { 1906196061U, 10U, {0} };
+static struct S_tagged4 D_tagged4 = { 1906196061U, 10U };
+static struct S_subtype D_subtype = { 2543892678U, 10U };
+static struct S_arr__of__tagged__of__tuple D_arr__of__tagged__of__tuple = { 1134168127U, 1U, 2U, 1134168127U, 3U, 4U, 1134168127U, 5U, 6U };
+static const struct S_strdata_2e356 D_strdata_2e356 = { "\141\163\144\146" };
+static struct S_strliteral_2e357 D_strliteral_2e357 = { (char *)((char *)&D_strdata_2e356) + 0, 4U, 4U };
+static const struct S_strdata_2e366 D_strdata_2e366 = { "\154\145\164\040\141\040\075\040\133\061\054\040\062\054\040\063\135\073\040\154\145\164\040\142\040\075\040\046\141\133\063\135\073" };
+static struct S_strliteral_2e367 D_strliteral_2e367 = { (char *)((char *)&D_strdata_2e366) + 0, 33U, 33U };
+static const struct S_strdata_2e399 D_strdata_2e399 = { "\154\145\164\040\141\040\075\040\050\061\054\040\062\054\040\063\051\073\040\154\145\164\040\142\040\075\040\046\141\056\063\073" };
+static struct S_strliteral_2e400 D_strliteral_2e400 = { (char *)((char *)&D_strdata_2e399) + 0, 32U, 32U };
+static struct S_abortsites_2e312 D_abortsites_2e312 = { (char *)((char *)&D_strliteral_2e1) + 0, 142U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 144U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 145U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 147U, 69U, (char *)((char *)&D_strliteral_2e1) + 0, 147U, 69U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 68U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 68U };
+static struct S_tup D_tup = { 2U, {0}, (char *)((char *)&D_strdata_2e356) + 0, 4U, 4U };
+static struct S_ptr__tup D_ptr__tup = { (char *)((char *)&D_tup) + 8 };
+static struct S___struct D___struct = { 1U, {0}, 2U };
+static struct S_ptr__struct D_ptr__struct = { (char *)((char *)&D___struct) + 8 };
+static struct S_arr D_arr = { 1U, 2U, 3U };
+static struct S_ptr__arr D_ptr__arr = { (char *)((char *)&D_arr) + 4 };
+static struct S_val D_val = { 42U };
+static struct S_ptr D_ptr = { (char *)((char *)&D_val) + 0 };
+static struct S_abortsites_2e424 D_abortsites_2e424 = { (char *)((char *)&D_strliteral_2e1) + 0, 127U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 128U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 129U, 15U };
+static struct S_static_2e13 D_static_2e13 = { 0U };
+static const struct S_strdata_2e457 D_strdata_2e457 = { "\146\156\040\164\145\163\164\050\051\040\151\156\164\073\040\154\145\164\040\170\072\040\151\156\164\040\075\040\164\145\163\164\050\051\073" };
+static struct S_strliteral_2e458 D_strliteral_2e458 = { (char *)((char *)&D_strdata_2e457) + 0, 35U, 35U };
+static const struct S_strdata_2e491 D_strdata_2e491 = { "\143\157\156\163\164\040\141\072\040\165\070\040\075\040\062\073\040\143\157\156\163\164\040\142\072\040\165\070\040\075\040\141\040\053\040\065\073" };
+static struct S_strliteral_2e492 D_strliteral_2e492 = { (char *)((char *)&D_strdata_2e491) + 0, 37U, 37U };
+static const struct S_strdata_2e511 D_strdata_2e511 = { "\144\145\146\040\141\073" };
+static struct S_strliteral_2e512 D_strliteral_2e512 = { (char *)((char *)&D_strdata_2e511) + 0, 6U, 6U };
+static const struct S_strdata_2e531 D_strdata_2e531 = { "\144\145\146\040\141\072\040\151\156\164\073" };
+static struct S_strliteral_2e532 D_strliteral_2e532 = { (char *)((char *)&D_strdata_2e531) + 0, 11U, 11U };
+static const struct S_strdata_2e551 D_strdata_2e551 = { "\154\145\164\040\141\073" };
+static struct S_strliteral_2e552 D_strliteral_2e552 = { (char *)((char *)&D_strdata_2e551) + 0, 6U, 6U };
+static const struct S_strdata_2e571 D_strdata_2e571 = { "\144\145\146\040\141\072\040\133\137\135\163\164\162\040\075\040\060\073" };
+static struct S_strliteral_2e572 D_strliteral_2e572 = { (char *)((char *)&D_strdata_2e571) + 0, 18U, 18U };
+static const struct S_strdata_2e591 D_strdata_2e591 = { "\144\145\146\040\141\072\040\151\156\164\040\075\040", 34U, "\163\164\162\151\156\147", 34U, "\073" };
+static struct S_strliteral_2e592 D_strliteral_2e592 = { (char *)((char *)&D_strdata_2e591) + 0, 22U, 22U };
+static const struct S_strdata_2e611 D_strdata_2e611 = { "\144\145\146\040\141\072\040\133\137\135\151\156\164\040\075\040\133", 34U, "\163\164\162\151\156\147", 34U, "\135\073" };
+static struct S_strliteral_2e612 D_strliteral_2e612 = { (char *)((char *)&D_strdata_2e611) + 0, 27U, 27U };
+static const struct S_strdata_2e631 D_strdata_2e631 = { "\154\145\164\040\141\072\040\133\137\135\163\164\162\040\075\040\060\073" };
+static struct S_strliteral_2e632 D_strliteral_2e632 = { (char *)((char *)&D_strdata_2e631) + 0, 18U, 18U };
+static const struct S_strdata_2e651 D_strdata_2e651 = { "\154\145\164\040\141\072\040\151\156\164\040\075\040", 34U, "\163\164\162\151\156\147", 34U, "\073" };
+static struct S_strliteral_2e652 D_strliteral_2e652 = { (char *)((char *)&D_strdata_2e651) + 0, 22U, 22U };
+static const struct S_strdata_2e671 D_strdata_2e671 = { "\154\145\164\040\141\072\040\133\137\135\151\156\164\040\075\040\133", 34U, "\163\164\162\151\156\147", 34U, "\135\073" };
+static struct S_strliteral_2e672 D_strliteral_2e672 = { (char *)((char *)&D_strdata_2e671) + 0, 27U, 27U };
+static const struct S_strdata_2e691 D_strdata_2e691 = { "\154\145\164\040\141\040\075\040\133\135\073" };
+static struct S_strliteral_2e692 D_strliteral_2e692 = { (char *)((char *)&D_strdata_2e691) + 0, 11U, 11U };
+static const struct S_strdata_2e711 D_strdata_2e711 = { "\144\145\146\040\141\040\075\040\133\135\073" };
+static struct S_strliteral_2e712 D_strliteral_2e712 = { (char *)((char *)&D_strdata_2e711) + 0, 11U, 11U };
+static struct S_abortsites_2e472 D_abortsites_2e472 = { (char *)((char *)&D_strliteral_2e1) + 0, 101U, 71U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 71U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 73U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 73U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 42U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 42U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 47U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 47U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 42U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 42U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 109U, 60U, (char *)((char *)&D_strliteral_2e1) + 0, 109U, 60U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 65U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 65U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 113U, 60U, (char *)((char *)&D_strliteral_2e1) + 0, 113U, 60U, (char *)((char *)&D_strliteral_2e1) + 0, 114U, 65U, (char *)((char *)&D_strliteral_2e1) + 0, 114U, 65U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 47U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 47U, (char *)((char *)&D_strliteral_2e1) + 0, 117U, 47U, (char *)((char *)&D_strliteral_2e1) + 0, 117U, 47U };
+static struct S_abortsites_2e735 D_abortsites_2e735 = { (char *)((char *)&D_strliteral_2e1) + 0, 82U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 83U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 84U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 85U, 18U, (char *)((char *)&D_strliteral_2e1) + 0, 85U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 85U, 46U, (char *)((char *)&D_strliteral_2e1) + 0, 85U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 86U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 87U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 88U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 90U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 91U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 92U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 93U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 95U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 96U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 97U, 15U };
+static struct S_double D_double = { 4653144502051863213UL };
+static struct S_float D_float = { 1150964267U };
+static struct S_big__value D_big__value = { 1311768467139281697UL };
+static struct S_em2__autofill D_em2__autofill = { 0U, 0U, 0U, {0} };
+static struct S_em2 D_em2 = { 18U, 3U, 4U, {0} };
+static struct S_em__autofill D_em__autofill = { 0U, 0U, {0}, 0U };
+static struct S_em D_em = { 3U, 4U, {0}, 18U };
+static struct S_a3 D_a3 = { 0U, 0U, 0U };
+static struct S_au D_au = { 0U, 0U };
+static struct S_su__autofill D_su__autofill = { 20U, 10U };
+static struct S_su D_su = { 20U, 10U };
+static const struct S_strdata_2e971 D_strdata_2e971 = { "\110\145\154\154\157\041" };
+static struct S_st D_st = { (char *)((char *)&D_strdata_2e971) + 0, 6U, 6U };
+static struct S_sldata_2e972 D_sldata_2e972 = { 1U, 2U, 3U };
+static struct S_sl D_sl = { (char *)((char *)&D_sldata_2e972) + 0, 3U, 3U };
+static struct S_ar D_ar = { 1U, 2U, 3U };
+static struct S_abortsites_2e986 D_abortsites_2e986 = { (char *)((char *)&D_strliteral_2e1) + 0, 32U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 34U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 37U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 38U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 15U };
+static struct S_nhval D_nhval = { 1U };
+static struct S_nohintconst D_nohintconst = { 123U };
+static struct S_nohint D_nohint = { 12U };
+static struct S_y D_y = { 69U };
+static struct S_x D_x = { 42U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_write)))();
+	((void (*)(void))((u64)((char *)&F_storage)))();
+	((void (*)(void))((u64)((char *)&F_invalid)))();
+	((void (*)(void))((u64)((char *)&F_static__binding)))();
+	((void (*)(void))((u64)((char *)&F_pointers)))();
+	((void (*)(void))((u64)((char *)&F_tagged)))();
+	((void (*)(void))((u64)((char *)&F_tuplearray)))();
+	((void (*)(void))((u64)((char *)&F_reachable)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_reachable(void) {
+	u64 t__2e13;
+	u64 t__2e14;
+	u64 t__2e15;
+	u64 t__2e16;
+	u64 t__2e20;
+	u64 t__2e21;
+	u64 t__2e22;
+	u64 t__2e23;
+	u64 t__2e24;
+	u64 t__2e27;
+	u64 t__2e28;
+	u64 t__2e30;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t_abortsite_2e18;
+	L_start_2e7:;
+	L_body_2e8:;
+	t__2e14 = (u64)(*(u64 *)((u64)((char *)&D_chain)));
+	t__2e15 = (u64)(*(u64 *)t__2e14);
+	t__2e16 = (u64)(u32)(*(i32 *)t__2e15);
+	t__2e13 = (u64)(u32)(((u32)t__2e16 == (u32)((u64)3UL)));
+	if ((u32)t__2e13) goto L_passed_2e12; else goto L_failed_2e11;
+	L_failed_2e11:;
+	t_abortsite_2e18 = ((u64)0UL);
+	goto L_abort_2e19;
+	L_passed_2e12:;
+	t__2e30 = (u64)((i64)(i32)((u64)0UL));
+	t__2e28 = (u64)((u64)t__2e30 * (u64)((u64)8UL));
+	t__2e28 = (u64)((u64)((u64)((char *)&D_callbacks)) + (u64)t__2e28);
+	t__2e31 = (u64)(*(u64 *)t__2e28);
+	t__2e32 = (u64)(u32)(((u32 (*)(void))t__2e31)());
+	t__2e27 = (u64)(u32)(((u32)t__2e32 == (u32)((u64)135UL)));
+	if ((u32)t__2e27) goto L_passed_2e26; else goto L_failed_2e25;
+	L_failed_2e25:;
+	t_abortsite_2e18 = ((u64)1UL);
+	goto L_abort_2e19;
+	L_passed_2e26:;
+	goto L__2e9;
+	L__2e33:;
+	L__2e9:;
+	return;
+	L_abort_2e19:;
+	t__2e20 = (u64)((u64)t_abortsite_2e18 * (u64)((u64)16UL));
+	t__2e20 = (u64)((u64)((u64)((char *)&D_abortsites_2e17)) + (u64)t__2e20);
+	t__2e21 = (u64)(*(u64 *)t__2e20);
+	t__2e22 = (u64)((u64)t__2e20 + (u64)((u64)8UL));
+	t__2e23 = (u64)(*(u32 *)t__2e22);
+	t__2e22 = (u64)((u64)t__2e20 + (u64)((u64)12UL));
+	t__2e24 = (u64)(*(u32 *)t__2e22);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e21, (u64)t__2e23, (u64)t__2e24, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_callback(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e45;
+	u64 t__2e46;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e55;
+	u64 t__2e56;
+	u64 t_binding_2e38;
+	u64 t_binding_2e44;
+	L_start_2e34:;
+	t_binding_2e38 = (u64)A0;
+	t_binding_2e44 = (u64)A1;
+	L_body_2e35:;
+	*(u32 *)t_binding_2e38 = (u32)((u64)0UL);
+	*(u32 *)t_binding_2e44 = (u32)((u64)0UL);
+	L_loop_2e39:;
+	t__2e46 = (u64)(u32)(*(i32 *)t_binding_2e44);
+	t__2e45 = (u64)(u32)(((i32)t__2e46 < (i32)((u64)10UL)));
+	if ((u32)t__2e45) goto L_body_2e40; else goto L__2e42;
+	L_body_2e40:;
+	t__2e49 = (u64)(u32)(*(i32 *)t_binding_2e38);
+	t__2e51 = (u64)(u32)(*(i32 *)t_binding_2e44);
+	t__2e52 = (u64)(*(u64 *)((u64)((char *)&D_chain__mid)));
+	t__2e53 = (u64)(u32)(*(i32 *)t__2e52);
+	t__2e50 = (u64)(u32)((u32)t__2e51 * (u32)t__2e53);
+	t__2e49 = (u64)(u32)((u32)t__2e49 + (u32)t__2e50);
+	*(u32 *)t_binding_2e38 = (u32)t__2e49;
+	goto L__2e47;
+	L__2e54:;
+	L__2e47:;
+	L_after_2e43:;
+	t__2e55 = (u64)(u32)(*(i32 *)t_binding_2e44);
+	t__2e55 = (u64)(u32)((u32)t__2e55 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e44 = (u32)t__2e55;
+	goto L_loop_2e39;
+	L__2e42:;
+	t__2e56 = (u64)(u32)(*(i32 *)t_binding_2e38);
+	return (u32)t__2e56;
+	L__2e57:;
+	L__2e36:;
+	L__2e58:;
+	return 0;
+}
+static void F_tuplearray(void) {
+	char B0[24] __attribute__((aligned(16)));
+	char B1[24] __attribute__((aligned(16)));
+	char B2[24] __attribute__((aligned(16)));
+	char B3[24] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e101;
+	u64 t__2e102;
+	u64 t__2e108;
+	u64 t__2e109;
+	u64 t__2e110;
+	u64 t__2e116;
+	u64 t__2e117;
+	u64 t__2e118;
+	u64 t__2e124;
+	u64 t__2e125;
+	u64 t__2e126;
+	u64 t__2e65;
+	u64 t__2e66;
+	u64 t__2e70;
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e80;
+	u64 t__2e81;
+	u64 t__2e84;
+	u64 t__2e85;
+	u64 t__2e86;
+	u64 t__2e92;
+	u64 t__2e93;
+	u64 t__2e94;
+	u64 t_abortsite_2e75;
+	u64 t_value_2e103;
+	u64 t_value_2e111;
+	u64 t_value_2e119;
+	u64 t_value_2e127;
+	u64 t_value_2e71;
+	u64 t_value_2e87;
+	u64 t_value_2e95;
+	L_start_2e59:;
+	L_body_2e60:;
+	t__2e70 = (u64)((i64)(i32)((u64)0UL));
+	t__2e66 = (u64)((u64)t__2e70 * (u64)((u64)32UL));
+	t__2e66 = (u64)((u64)((u64)((char *)&D_keywords)) + (u64)t__2e66);
+	t_value_2e71 = (u64)((u64)t__2e66 + (u64)((u64)0UL));
+	BLIT((u64)B0, t_value_2e71, 24);
+	BLIT((u64)B1, ((u64)((char *)&D_strliteral_2e73)), 24);
+	t__2e65 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B0, (u64)B1));
+	if ((u32)t__2e65) goto L_passed_2e64; else goto L_failed_2e63;
+	L_failed_2e63:;
+	t_abortsite_2e75 = ((u64)0UL);
+	goto L_abort_2e76;
+	L_passed_2e64:;
+	t__2e86 = (u64)((i64)(i32)((u64)1UL));
+	t__2e85 = (u64)((u64)t__2e86 * (u64)((u64)32UL));
+	t__2e85 = (u64)((u64)((u64)((char *)&D_keywords)) + (u64)t__2e85);
+	t_value_2e87 = (u64)((u64)t__2e85 + (u64)((u64)0UL));
+	BLIT((u64)B2, t_value_2e87, 24);
+	BLIT((u64)B3, ((u64)((char *)&D_strliteral_2e89)), 24);
+	t__2e84 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B2, (u64)B3));
+	if ((u32)t__2e84) goto L_passed_2e83; else goto L_failed_2e82;
+	L_failed_2e82:;
+	t_abortsite_2e75 = ((u64)1UL);
+	goto L_abort_2e76;
+	L_passed_2e83:;
+	t__2e94 = (u64)((i64)(i32)((u64)2UL));
+	t__2e93 = (u64)((u64)t__2e94 * (u64)((u64)32UL));
+	t__2e93 = (u64)((u64)((u64)((char *)&D_keywords)) + (u64)t__2e93);
+	t_value_2e95 = (u64)((u64)t__2e93 + (u64)((u64)0UL));
+	BLIT((u64)B4, t_value_2e95, 24);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e97)), 24);
+	t__2e92 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B4, (u64)B5));
+	if ((u32)t__2e92) goto L_passed_2e91; else goto L_failed_2e90;
+	L_failed_2e90:;
+	t_abortsite_2e75 = ((u64)2UL);
+	goto L_abort_2e76;
+	L_passed_2e91:;
+	t__2e102 = (u64)((i64)(i32)((u64)3UL));
+	t__2e101 = (u64)((u64)t__2e102 * (u64)((u64)32UL));
+	t__2e101 = (u64)((u64)((u64)((char *)&D_keywords)) + (u64)t__2e101);
+	t_value_2e103 = (u64)((u64)t__2e101 + (u64)((u64)0UL));
+	BLIT((u64)B6, t_value_2e103, 24);
+	BLIT((u64)B7, ((u64)((char *)&D_strliteral_2e105)), 24);
+	t__2e100 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B6, (u64)B7));
+	if ((u32)t__2e100) goto L_passed_2e99; else goto L_failed_2e98;
+	L_failed_2e98:;
+	t_abortsite_2e75 = ((u64)3UL);
+	goto L_abort_2e76;
+	L_passed_2e99:;
+	t__2e110 = (u64)((i64)(i32)((u64)4UL));
+	t__2e109 = (u64)((u64)t__2e110 * (u64)((u64)32UL));
+	t__2e109 = (u64)((u64)((u64)((char *)&D_keywords)) + (u64)t__2e109);
+	t_value_2e111 = (u64)((u64)t__2e109 + (u64)((u64)0UL));
+	BLIT((u64)B8, t_value_2e111, 24);
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e113)), 24);
+	t__2e108 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B8, (u64)B9));
+	if ((u32)t__2e108) goto L_passed_2e107; else goto L_failed_2e106;
+	L_failed_2e106:;
+	t_abortsite_2e75 = ((u64)4UL);
+	goto L_abort_2e76;
+	L_passed_2e107:;
+	t__2e118 = (u64)((i64)(i32)((u64)5UL));
+	t__2e117 = (u64)((u64)t__2e118 * (u64)((u64)32UL));
+	t__2e117 = (u64)((u64)((u64)((char *)&D_keywords)) + (u64)t__2e117);
+	t_value_2e119 = (u64)((u64)t__2e117 + (u64)((u64)0UL));
+	BLIT((u64)B10, t_value_2e119, 24);
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e121)), 24);
+	t__2e116 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B10, (u64)B11));
+	if ((u32)t__2e116) goto L_passed_2e115; else goto L_failed_2e114;
+	L_failed_2e114:;
+	t_abortsite_2e75 = ((u64)5UL);
+	goto L_abort_2e76;
+	L_passed_2e115:;
+	t__2e126 = (u64)((i64)(i32)((u64)6UL));
+	t__2e125 = (u64)((u64)t__2e126 * (u64)((u64)32UL));
+	t__2e125 = (u64)((u64)((u64)((char *)&D_keywords)) + (u64)t__2e125);
+	t_value_2e127 = (u64)((u64)t__2e125 + (u64)((u64)0UL));
+	BLIT((u64)B12, t_value_2e127, 24);
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e129)), 24);
+	t__2e124 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B12, (u64)B13));
+	if ((u32)t__2e124) goto L_passed_2e123; else goto L_failed_2e122;
+	L_failed_2e122:;
+	t_abortsite_2e75 = ((u64)6UL);
+	goto L_abort_2e76;
+	L_passed_2e123:;
+	goto L__2e61;
+	L__2e130:;
+	L__2e61:;
+	return;
+	L_abort_2e76:;
+	t__2e77 = (u64)((u64)t_abortsite_2e75 * (u64)((u64)16UL));
+	t__2e77 = (u64)((u64)((u64)((char *)&D_abortsites_2e74)) + (u64)t__2e77);
+	t__2e78 = (u64)(*(u64 *)t__2e77);
+	t__2e79 = (u64)((u64)t__2e77 + (u64)((u64)8UL));
+	t__2e80 = (u64)(*(u32 *)t__2e79);
+	t__2e79 = (u64)((u64)t__2e77 + (u64)((u64)12UL));
+	t__2e81 = (u64)(*(u32 *)t__2e79);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e78, (u64)t__2e80, (u64)t__2e81, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_tagged(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e144;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e150;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e159;
+	u64 t__2e160;
+	u64 t__2e162;
+	u64 t__2e164;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e167;
+	u64 t__2e168;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t__2e173;
+	u64 t__2e174;
+	u64 t__2e175;
+	u64 t__2e179;
+	u64 t__2e183;
+	u64 t__2e186;
+	u64 t__2e187;
+	u64 t__2e188;
+	u64 t__2e189;
+	u64 t__2e190;
+	u64 t__2e194;
+	u64 t__2e198;
+	u64 t__2e201;
+	u64 t__2e202;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e205;
+	u64 t__2e209;
+	u64 t__2e213;
+	u64 t__2e216;
+	u64 t__2e217;
+	u64 t__2e218;
+	u64 t__2e219;
+	u64 t__2e220;
+	u64 t__2e224;
+	u64 t__2e228;
+	u64 t__2e231;
+	u64 t__2e232;
+	u64 t__2e233;
+	u64 t__2e234;
+	u64 t__2e235;
+	u64 t__2e239;
+	u64 t__2e243;
+	u64 t__2e246;
+	u64 t__2e252;
+	u64 t__2e258;
+	u64 t__2e259;
+	u64 t__2e262;
+	u64 t__2e265;
+	u64 t__2e266;
+	u64 t__2e268;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e276;
+	u64 t__2e279;
+	u64 t__2e280;
+	u64 t__2e282;
+	u64 t__2e286;
+	u64 t__2e287;
+	u64 t__2e289;
+	u64 t__2e292;
+	u64 t__2e293;
+	u64 t__2e295;
+	u64 t_abortsite_2e154;
+	u64 t_binding_2e255;
+	u64 t_binding_2e269;
+	u64 t_binding_2e283;
+	u64 t_field_2e261;
+	u64 t_field_2e267;
+	u64 t_field_2e275;
+	u64 t_field_2e281;
+	u64 t_field_2e288;
+	u64 t_field_2e294;
+	u64 t_subval_2e149;
+	u64 t_subval_2e178;
+	u64 t_subval_2e193;
+	u64 t_subval_2e208;
+	u64 t_subval_2e223;
+	u64 t_subval_2e238;
+	u64 t_subval_2e251;
+	u64 t_value_2e161;
+	u64 t_value_2e182;
+	u64 t_value_2e197;
+	u64 t_value_2e212;
+	u64 t_value_2e227;
+	u64 t_value_2e242;
+	L_start_2e131:;
+	t_binding_2e255 = (u64)A0;
+	t_binding_2e269 = (u64)A1;
+	t_binding_2e283 = (u64)A2;
+	L_body_2e132:;
+	t__2e144 = (u64)((i64)(i32)((u64)0UL));
+	t__2e138 = (u64)((u64)t__2e144 * (u64)((u64)12UL));
+	t__2e138 = (u64)((u64)((u64)((char *)&D_arr__of__tagged__of__tuple)) + (u64)t__2e138);
+	t__2e145 = t__2e138;
+	t__2e146 = (u64)(u32)(*(u32 *)t__2e138);
+	t_subval_2e149 = t__2e138;
+	t__2e150 = (u64)(u32)(((u32)t__2e146 == (u32)((u64)1134168127UL)));
+	if ((u32)t__2e150) goto L_subtype_2e152; else goto L_failed_2e148;
+	L_subtype_2e152:;
+	goto L_passed_2e147;
+	L_failed_2e148:;
+	t_abortsite_2e154 = ((u64)0UL);
+	goto L_abort_2e155;
+	L_passed_2e147:;
+	t__2e145 = (u64)((u64)t__2e145 + (u64)((u64)4UL));
+	t_value_2e161 = (u64)((u64)t__2e145 + (u64)((u64)0UL));
+	t__2e162 = (u64)(u32)(*(i32 *)t_value_2e161);
+	t__2e137 = (u64)(u32)(((u32)t__2e162 == (u32)((u64)1UL)));
+	if ((u32)t__2e137) goto L_passed_2e136; else goto L_failed_2e135;
+	L_failed_2e135:;
+	t_abortsite_2e154 = ((u64)1UL);
+	goto L_abort_2e163;
+	L_passed_2e136:;
+	t__2e173 = (u64)((i64)(i32)((u64)0UL));
+	t__2e172 = (u64)((u64)t__2e173 * (u64)((u64)12UL));
+	t__2e172 = (u64)((u64)((u64)((char *)&D_arr__of__tagged__of__tuple)) + (u64)t__2e172);
+	t__2e174 = t__2e172;
+	t__2e175 = (u64)(u32)(*(u32 *)t__2e172);
+	t_subval_2e178 = t__2e172;
+	t__2e179 = (u64)(u32)(((u32)t__2e175 == (u32)((u64)1134168127UL)));
+	if ((u32)t__2e179) goto L_subtype_2e181; else goto L_failed_2e177;
+	L_subtype_2e181:;
+	goto L_passed_2e176;
+	L_failed_2e177:;
+	t_abortsite_2e154 = ((u64)2UL);
+	goto L_abort_2e155;
+	L_passed_2e176:;
+	t__2e174 = (u64)((u64)t__2e174 + (u64)((u64)4UL));
+	t_value_2e182 = (u64)((u64)t__2e174 + (u64)((u64)4UL));
+	t__2e183 = (u64)(u32)(*(i32 *)t_value_2e182);
+	t__2e171 = (u64)(u32)(((u32)t__2e183 == (u32)((u64)2UL)));
+	if ((u32)t__2e171) goto L_passed_2e170; else goto L_failed_2e169;
+	L_failed_2e169:;
+	t_abortsite_2e154 = ((u64)3UL);
+	goto L_abort_2e163;
+	L_passed_2e170:;
+	t__2e188 = (u64)((i64)(i32)((u64)1UL));
+	t__2e187 = (u64)((u64)t__2e188 * (u64)((u64)12UL));
+	t__2e187 = (u64)((u64)((u64)((char *)&D_arr__of__tagged__of__tuple)) + (u64)t__2e187);
+	t__2e189 = t__2e187;
+	t__2e190 = (u64)(u32)(*(u32 *)t__2e187);
+	t_subval_2e193 = t__2e187;
+	t__2e194 = (u64)(u32)(((u32)t__2e190 == (u32)((u64)1134168127UL)));
+	if ((u32)t__2e194) goto L_subtype_2e196; else goto L_failed_2e192;
+	L_subtype_2e196:;
+	goto L_passed_2e191;
+	L_failed_2e192:;
+	t_abortsite_2e154 = ((u64)4UL);
+	goto L_abort_2e155;
+	L_passed_2e191:;
+	t__2e189 = (u64)((u64)t__2e189 + (u64)((u64)4UL));
+	t_value_2e197 = (u64)((u64)t__2e189 + (u64)((u64)0UL));
+	t__2e198 = (u64)(u32)(*(i32 *)t_value_2e197);
+	t__2e186 = (u64)(u32)(((u32)t__2e198 == (u32)((u64)3UL)));
+	if ((u32)t__2e186) goto L_passed_2e185; else goto L_failed_2e184;
+	L_failed_2e184:;
+	t_abortsite_2e154 = ((u64)5UL);
+	goto L_abort_2e163;
+	L_passed_2e185:;
+	t__2e203 = (u64)((i64)(i32)((u64)1UL));
+	t__2e202 = (u64)((u64)t__2e203 * (u64)((u64)12UL));
+	t__2e202 = (u64)((u64)((u64)((char *)&D_arr__of__tagged__of__tuple)) + (u64)t__2e202);
+	t__2e204 = t__2e202;
+	t__2e205 = (u64)(u32)(*(u32 *)t__2e202);
+	t_subval_2e208 = t__2e202;
+	t__2e209 = (u64)(u32)(((u32)t__2e205 == (u32)((u64)1134168127UL)));
+	if ((u32)t__2e209) goto L_subtype_2e211; else goto L_failed_2e207;
+	L_subtype_2e211:;
+	goto L_passed_2e206;
+	L_failed_2e207:;
+	t_abortsite_2e154 = ((u64)6UL);
+	goto L_abort_2e155;
+	L_passed_2e206:;
+	t__2e204 = (u64)((u64)t__2e204 + (u64)((u64)4UL));
+	t_value_2e212 = (u64)((u64)t__2e204 + (u64)((u64)4UL));
+	t__2e213 = (u64)(u32)(*(i32 *)t_value_2e212);
+	t__2e201 = (u64)(u32)(((u32)t__2e213 == (u32)((u64)4UL)));
+	if ((u32)t__2e201) goto L_passed_2e200; else goto L_failed_2e199;
+	L_failed_2e199:;
+	t_abortsite_2e154 = ((u64)7UL);
+	goto L_abort_2e163;
+	L_passed_2e200:;
+	t__2e218 = (u64)((i64)(i32)((u64)2UL));
+	t__2e217 = (u64)((u64)t__2e218 * (u64)((u64)12UL));
+	t__2e217 = (u64)((u64)((u64)((char *)&D_arr__of__tagged__of__tuple)) + (u64)t__2e217);
+	t__2e219 = t__2e217;
+	t__2e220 = (u64)(u32)(*(u32 *)t__2e217);
+	t_subval_2e223 = t__2e217;
+	t__2e224 = (u64)(u32)(((u32)t__2e220 == (u32)((u64)1134168127UL)));
+	if ((u32)t__2e224) goto L_subtype_2e226; else goto L_failed_2e222;
+	L_subtype_2e226:;
+	goto L_passed_2e221;
+	L_failed_2e222:;
+	t_abortsite_2e154 = ((u64)8UL);
+	goto L_abort_2e155;
+	L_passed_2e221:;
+	t__2e219 = (u64)((u64)t__2e219 + (u64)((u64)4UL));
+	t_value_2e227 = (u64)((u64)t__2e219 + (u64)((u64)0UL));
+	t__2e228 = (u64)(u32)(*(i32 *)t_value_2e227);
+	t__2e216 = (u64)(u32)(((u32)t__2e228 == (u32)((u64)5UL)));
+	if ((u32)t__2e216) goto L_passed_2e215; else goto L_failed_2e214;
+	L_failed_2e214:;
+	t_abortsite_2e154 = ((u64)9UL);
+	goto L_abort_2e163;
+	L_passed_2e215:;
+	t__2e233 = (u64)((i64)(i32)((u64)2UL));
+	t__2e232 = (u64)((u64)t__2e233 * (u64)((u64)12UL));
+	t__2e232 = (u64)((u64)((u64)((char *)&D_arr__of__tagged__of__tuple)) + (u64)t__2e232);
+	t__2e234 = t__2e232;
+	t__2e235 = (u64)(u32)(*(u32 *)t__2e232);
+	t_subval_2e238 = t__2e232;
+	t__2e239 = (u64)(u32)(((u32)t__2e235 == (u32)((u64)1134168127UL)));
+	if ((u32)t__2e239) goto L_subtype_2e241; else goto L_failed_2e237;
+	L_subtype_2e241:;
+	goto L_passed_2e236;
+	L_failed_2e237:;
+	t_abortsite_2e154 = ((u64)10UL);
+	goto L_abort_2e155;
+	L_passed_2e236:;
+	t__2e234 = (u64)((u64)t__2e234 + (u64)((u64)4UL));
+	t_value_2e242 = (u64)((u64)t__2e234 + (u64)((u64)4UL));
+	t__2e243 = (u64)(u32)(*(i32 *)t_value_2e242);
+	t__2e231 = (u64)(u32)(((u32)t__2e243 == (u32)((u64)6UL)));
+	if ((u32)t__2e231) goto L_passed_2e230; else goto L_failed_2e229;
+	L_failed_2e229:;
+	t_abortsite_2e154 = ((u64)11UL);
+	goto L_abort_2e163;
+	L_passed_2e230:;
+	t__2e246 = (u64)(u32)(*(u32 *)((u64)((char *)&D_subtype)));
+	t_subval_2e251 = ((u64)((char *)&D_subtype));
+	t__2e252 = (u64)(u32)(((u32)t__2e246 == (u32)((u64)2543892678UL)));
+	if ((u32)t__2e252) goto L_subtype_2e254; else goto L_passed_2e250;
+	L_subtype_2e254:;
+	goto L_passed_2e250;
+	L_passed_2e250:;
+	if ((u32)t__2e252) goto L_passed_2e245; else goto L_failed_2e244;
+	L_failed_2e244:;
+	t_abortsite_2e154 = ((u64)12UL);
+	goto L_abort_2e163;
+	L_passed_2e245:;
+	*(u64 *)t_binding_2e255 = (u64)((u64)((char *)&D_tagged4));
+	t__2e259 = (u64)(*(u64 *)t_binding_2e255);
+	t_field_2e261 = (u64)((u64)t__2e259 + (u64)((u64)0UL));
+	t__2e262 = (u64)(u32)(*(u32 *)t_field_2e261);
+	t__2e258 = (u64)(u32)(((u32)t__2e262 == (u32)((u64)1906196061UL)));
+	if ((u32)t__2e258) goto L_passed_2e257; else goto L_failed_2e256;
+	L_failed_2e256:;
+	t_abortsite_2e154 = ((u64)13UL);
+	goto L_abort_2e163;
+	L_passed_2e257:;
+	t__2e266 = (u64)(*(u64 *)t_binding_2e255);
+	t_field_2e267 = (u64)((u64)t__2e266 + (u64)((u64)4UL));
+	t__2e268 = (u64)(u32)(*(u32 *)t_field_2e267);
+	t__2e265 = (u64)(u32)(((u32)t__2e268 == (u32)((u64)10UL)));
+	if ((u32)t__2e265) goto L_passed_2e264; else goto L_failed_2e263;
+	L_failed_2e263:;
+	t_abortsite_2e154 = ((u64)14UL);
+	goto L_abort_2e163;
+	L_passed_2e264:;
+	*(u64 *)t_binding_2e269 = (u64)((u64)((char *)&D_tagged8));
+	t__2e273 = (u64)(*(u64 *)t_binding_2e269);
+	t_field_2e275 = (u64)((u64)t__2e273 + (u64)((u64)0UL));
+	t__2e276 = (u64)(u32)(*(u32 *)t_field_2e275);
+	t__2e272 = (u64)(u32)(((u32)t__2e276 == (u32)((u64)1906196061UL)));
+	if ((u32)t__2e272) goto L_passed_2e271; else goto L_failed_2e270;
+	L_failed_2e270:;
+	t_abortsite_2e154 = ((u64)15UL);
+	goto L_abort_2e163;
+	L_passed_2e271:;
+	t__2e280 = (u64)(*(u64 *)t_binding_2e269);
+	t_field_2e281 = (u64)((u64)t__2e280 + (u64)((u64)4UL));
+	t__2e282 = (u64)(u32)(*(u32 *)t_field_2e281);
+	t__2e279 = (u64)(u32)(((u32)t__2e282 == (u32)((u64)10UL)));
+	if ((u32)t__2e279) goto L_passed_2e278; else goto L_failed_2e277;
+	L_failed_2e277:;
+	t_abortsite_2e154 = ((u64)16UL);
+	goto L_abort_2e163;
+	L_passed_2e278:;
+	*(u64 *)t_binding_2e283 = (u64)((u64)((char *)&D_tagged8__u64));
+	t__2e287 = (u64)(*(u64 *)t_binding_2e283);
+	t_field_2e288 = (u64)((u64)t__2e287 + (u64)((u64)0UL));
+	t__2e289 = (u64)(u32)(*(u32 *)t_field_2e288);
+	t__2e286 = (u64)(u32)(((u32)t__2e289 == (u32)((u64)1268499444UL)));
+	if ((u32)t__2e286) goto L_passed_2e285; else goto L_failed_2e284;
+	L_failed_2e284:;
+	t_abortsite_2e154 = ((u64)17UL);
+	goto L_abort_2e163;
+	L_passed_2e285:;
+	t__2e293 = (u64)(*(u64 *)t_binding_2e283);
+	t_field_2e294 = (u64)((u64)t__2e293 + (u64)((u64)8UL));
+	t__2e295 = (u64)(*(u64 *)t_field_2e294);
+	t__2e292 = (u64)(u32)(((u64)t__2e295 == (u64)((u64)10UL)));
+	if ((u32)t__2e292) goto L_passed_2e291; else goto L_failed_2e290;
+	L_failed_2e290:;
+	t_abortsite_2e154 = ((u64)18UL);
+	goto L_abort_2e163;
+	L_passed_2e291:;
+	goto L__2e133;
+	L__2e296:;
+	L__2e133:;
+	return;
+	L_abort_2e155:;
+	t__2e156 = (u64)((u64)t_abortsite_2e154 * (u64)((u64)16UL));
+	t__2e156 = (u64)((u64)((u64)((char *)&D_abortsites_2e153)) + (u64)t__2e156);
+	t__2e157 = (u64)(*(u64 *)t__2e156);
+	t__2e158 = (u64)((u64)t__2e156 + (u64)((u64)8UL));
+	t__2e159 = (u64)(*(u32 *)t__2e158);
+	t__2e158 = (u64)((u64)t__2e156 + (u64)((u64)12UL));
+	t__2e160 = (u64)(*(u32 *)t__2e158);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e157, (u64)t__2e159, (u64)t__2e160, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e163:;
+	t__2e164 = (u64)((u64)t_abortsite_2e154 * (u64)((u64)16UL));
+	t__2e164 = (u64)((u64)((u64)((char *)&D_abortsites_2e153)) + (u64)t__2e164);
+	t__2e165 = (u64)(*(u64 *)t__2e164);
+	t__2e166 = (u64)((u64)t__2e164 + (u64)((u64)8UL));
+	t__2e167 = (u64)(*(u32 *)t__2e166);
+	t__2e166 = (u64)((u64)t__2e164 + (u64)((u64)12UL));
+	t__2e168 = (u64)(*(u32 *)t__2e166);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e165, (u64)t__2e167, (u64)t__2e168, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_pointers(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[8] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char R9[4] __attribute__((aligned(16)));
+	char B10[8] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char R13[4] __attribute__((aligned(16)));
+	u64 t__2e303;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t__2e311;
+	u64 t__2e315;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e318;
+	u64 t__2e319;
+	u64 t__2e322;
+	u64 t__2e325;
+	u64 t__2e326;
+	u64 t__2e327;
+	u64 t__2e329;
+	u64 t__2e330;
+	u64 t__2e331;
+	u64 t__2e332;
+	u64 t__2e335;
+	u64 t__2e338;
+	u64 t__2e339;
+	u64 t__2e342;
+	u64 t__2e343;
+	u64 t__2e344;
+	u64 t__2e347;
+	u64 t__2e350;
+	u64 t__2e351;
+	u64 t__2e354;
+	u64 t__2e355;
+	u64 t__2e359;
+	u64 t__2e365;
+	u64 t__2e370;
+	u64 t__2e379;
+	u64 t__2e381;
+	u64 t__2e383;
+	u64 t__2e384;
+	u64 t__2e385;
+	u64 t__2e386;
+	u64 t__2e387;
+	u64 t__2e390;
+	u64 t__2e391;
+	u64 t__2e392;
+	u64 t__2e393;
+	u64 t__2e394;
+	u64 t__2e396;
+	u64 t__2e398;
+	u64 t__2e402;
+	u64 t__2e411;
+	u64 t__2e413;
+	u64 t_abortsite_2e313;
+	u64 t_field_2e341;
+	u64 t_object_2e361;
+	u64 t_object_2e368;
+	u64 t_object_2e397;
+	u64 t_object_2e401;
+	u64 t_tag_2e371;
+	u64 t_tag_2e403;
+	u64 t_value_2e353;
+	L_start_2e297:;
+	t_object_2e361 = (u64)A0;
+	t_object_2e368 = (u64)A1;
+	t_object_2e397 = (u64)A2;
+	t_object_2e401 = (u64)A3;
+	L_body_2e298:;
+	t__2e307 = (u64)(*(u64 *)((u64)((char *)&D_ptr)));
+	t__2e306 = (u64)(u32)(((u64)t__2e307 == (u64)((u64)((char *)&D_val))));
+	t__2e303 = (u64)(u32)t__2e306;
+	if ((u32)t__2e303) goto L__2e304; else goto L__2e305;
+	L__2e304:;
+	t__2e309 = (u64)(*(u64 *)((u64)((char *)&D_ptr)));
+	t__2e310 = (u64)(u32)(*(u32 *)t__2e309);
+	t__2e311 = (u64)(u32)(*(u32 *)((u64)((char *)&D_val)));
+	t__2e308 = (u64)(u32)(((u32)t__2e310 == (u32)t__2e311));
+	t__2e303 = (u64)(u32)t__2e308;
+	goto L__2e305;
+	L__2e305:;
+	if ((u32)t__2e303) goto L_passed_2e302; else goto L_failed_2e301;
+	L_failed_2e301:;
+	t_abortsite_2e313 = ((u64)0UL);
+	goto L_abort_2e314;
+	L_passed_2e302:;
+	t__2e326 = (u64)(*(u64 *)((u64)((char *)&D_ptr__arr)));
+	t__2e329 = (u64)((i64)(i32)((u64)1UL));
+	t__2e327 = (u64)((u64)t__2e329 * (u64)((u64)4UL));
+	t__2e327 = (u64)((u64)((u64)((char *)&D_arr)) + (u64)t__2e327);
+	t__2e325 = (u64)(u32)(((u64)t__2e326 == (u64)t__2e327));
+	t__2e322 = (u64)(u32)t__2e325;
+	if ((u32)t__2e322) goto L__2e323; else goto L__2e324;
+	L__2e323:;
+	t__2e331 = (u64)(*(u64 *)((u64)((char *)&D_ptr__arr)));
+	t__2e332 = (u64)(u32)(*(i32 *)t__2e331);
+	t__2e330 = (u64)(u32)(((u32)t__2e332 == (u32)((u64)2UL)));
+	t__2e322 = (u64)(u32)t__2e330;
+	goto L__2e324;
+	L__2e324:;
+	if ((u32)t__2e322) goto L_passed_2e321; else goto L_failed_2e320;
+	L_failed_2e320:;
+	t_abortsite_2e313 = ((u64)1UL);
+	goto L_abort_2e314;
+	L_passed_2e321:;
+	t__2e339 = (u64)(*(u64 *)((u64)((char *)&D_ptr__struct)));
+	t_field_2e341 = (u64)((u64)((u64)((char *)&D___struct)) + (u64)((u64)8UL));
+	t__2e338 = (u64)(u32)(((u64)t__2e339 == (u64)t_field_2e341));
+	t__2e335 = (u64)(u32)t__2e338;
+	if ((u32)t__2e335) goto L__2e336; else goto L__2e337;
+	L__2e336:;
+	t__2e343 = (u64)(*(u64 *)((u64)((char *)&D_ptr__struct)));
+	t__2e344 = (u64)(*(u64 *)t__2e343);
+	t__2e342 = (u64)(u32)(((u64)t__2e344 == (u64)((u64)2UL)));
+	t__2e335 = (u64)(u32)t__2e342;
+	goto L__2e337;
+	L__2e337:;
+	if ((u32)t__2e335) goto L_passed_2e334; else goto L_failed_2e333;
+	L_failed_2e333:;
+	t_abortsite_2e313 = ((u64)2UL);
+	goto L_abort_2e314;
+	L_passed_2e334:;
+	t__2e351 = (u64)(*(u64 *)((u64)((char *)&D_ptr__tup)));
+	t_value_2e353 = (u64)((u64)((u64)((char *)&D_tup)) + (u64)((u64)8UL));
+	t__2e350 = (u64)(u32)(((u64)t__2e351 == (u64)t_value_2e353));
+	t__2e347 = (u64)(u32)t__2e350;
+	if ((u32)t__2e347) goto L__2e348; else goto L__2e349;
+	L__2e348:;
+	t__2e355 = (u64)(*(u64 *)((u64)((char *)&D_ptr__tup)));
+	BLIT((u64)B4, t__2e355, 24);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e357)), 24);
+	t__2e354 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B4, (u64)B5));
+	t__2e347 = (u64)(u32)t__2e354;
+	goto L__2e349;
+	L__2e349:;
+	if ((u32)t__2e347) goto L_passed_2e346; else goto L_failed_2e345;
+	L_failed_2e345:;
+	t_abortsite_2e313 = ((u64)3UL);
+	goto L_abort_2e314;
+	L_passed_2e346:;
+	*(u32 *)t_object_2e361 = (u32)((u64)3532310079UL);
+	t__2e365 = (u64)((u64)t_object_2e361 + (u64)((u64)4UL));
+	*(u32 *)t__2e365 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e368 = (u64)((u64)0UL);
+	t__2e370 = (u64)((u64)t_object_2e368 + (u64)((u64)8UL));
+	*(u64 *)t__2e370 = (u64)((u64)0UL);
+	t__2e370 = (u64)((u64)t__2e370 + (u64)((u64)8UL));
+	*(u64 *)t__2e370 = (u64)((u64)0UL);
+	BLIT((u64)B6, t_object_2e361, 8);
+	BLIT((u64)B7, ((u64)((char *)&D_strliteral_2e367)), 24);
+	BLIT((u64)B8, t_object_2e368, 24);
+	t__2e359 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R9, (u64)B6, (u64)B7, (u64)B8);
+	t_tag_2e371 = (u64)(*(u32 *)t__2e359);
+	t__2e379 = (u64)(u32)(((u32)t_tag_2e371 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e379) goto L_member_2e376; else goto L__2e378;
+	L__2e378:;
+	t__2e381 = (u64)(u32)(((u32)t_tag_2e371 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e381) goto L_member_2e377; else goto L__2e380;
+	L__2e380:;
+	goto L_matches_2e375;
+	L_member_2e376:;
+	goto L_matches_2e375;
+	L_member_2e377:;
+	goto L_matches_2e374;
+	L_matches_2e374:;
+	goto L__2e372;
+	L_matches_2e375:;
+	t_abortsite_2e313 = ((u64)4UL);
+	goto L_abort_2e382;
+	L__2e388:;
+	L__2e373:;
+	t_abortsite_2e313 = ((u64)5UL);
+	goto L_abort_2e389;
+	L__2e372:;
+	*(u32 *)t_object_2e397 = (u32)((u64)3532310079UL);
+	t__2e398 = (u64)((u64)t_object_2e397 + (u64)((u64)4UL));
+	*(u32 *)t__2e398 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e401 = (u64)((u64)0UL);
+	t__2e402 = (u64)((u64)t_object_2e401 + (u64)((u64)8UL));
+	*(u64 *)t__2e402 = (u64)((u64)0UL);
+	t__2e402 = (u64)((u64)t__2e402 + (u64)((u64)8UL));
+	*(u64 *)t__2e402 = (u64)((u64)0UL);
+	BLIT((u64)B10, t_object_2e397, 8);
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e400)), 24);
+	BLIT((u64)B12, t_object_2e401, 24);
+	t__2e396 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R13, (u64)B10, (u64)B11, (u64)B12);
+	t_tag_2e403 = (u64)(*(u32 *)t__2e396);
+	t__2e411 = (u64)(u32)(((u32)t_tag_2e403 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e411) goto L_member_2e408; else goto L__2e410;
+	L__2e410:;
+	t__2e413 = (u64)(u32)(((u32)t_tag_2e403 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e413) goto L_member_2e409; else goto L__2e412;
+	L__2e412:;
+	goto L_matches_2e407;
+	L_member_2e408:;
+	goto L_matches_2e407;
+	L_member_2e409:;
+	goto L_matches_2e406;
+	L_matches_2e406:;
+	goto L__2e404;
+	L_matches_2e407:;
+	t_abortsite_2e313 = ((u64)6UL);
+	goto L_abort_2e382;
+	L__2e414:;
+	L__2e405:;
+	t_abortsite_2e313 = ((u64)7UL);
+	goto L_abort_2e389;
+	L__2e404:;
+	goto L__2e299;
+	L__2e415:;
+	L__2e299:;
+	return;
+	L_abort_2e314:;
+	t__2e315 = (u64)((u64)t_abortsite_2e313 * (u64)((u64)16UL));
+	t__2e315 = (u64)((u64)((u64)((char *)&D_abortsites_2e312)) + (u64)t__2e315);
+	t__2e316 = (u64)(*(u64 *)t__2e315);
+	t__2e317 = (u64)((u64)t__2e315 + (u64)((u64)8UL));
+	t__2e318 = (u64)(*(u32 *)t__2e317);
+	t__2e317 = (u64)((u64)t__2e315 + (u64)((u64)12UL));
+	t__2e319 = (u64)(*(u32 *)t__2e317);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e316, (u64)t__2e318, (u64)t__2e319, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e382:;
+	t__2e383 = (u64)((u64)t_abortsite_2e313 * (u64)((u64)16UL));
+	t__2e383 = (u64)((u64)((u64)((char *)&D_abortsites_2e312)) + (u64)t__2e383);
+	t__2e384 = (u64)(*(u64 *)t__2e383);
+	t__2e385 = (u64)((u64)t__2e383 + (u64)((u64)8UL));
+	t__2e386 = (u64)(*(u32 *)t__2e385);
+	t__2e385 = (u64)((u64)t__2e383 + (u64)((u64)12UL));
+	t__2e387 = (u64)(*(u32 *)t__2e385);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e384, (u64)t__2e386, (u64)t__2e387, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e389:;
+	t__2e390 = (u64)((u64)t_abortsite_2e313 * (u64)((u64)16UL));
+	t__2e390 = (u64)((u64)((u64)((char *)&D_abortsites_2e312)) + (u64)t__2e390);
+	t__2e391 = (u64)(*(u64 *)t__2e390);
+	t__2e392 = (u64)((u64)t__2e390 + (u64)((u64)8UL));
+	t__2e393 = (u64)(*(u32 *)t__2e392);
+	t__2e392 = (u64)((u64)t__2e390 + (u64)((u64)12UL));
+	t__2e394 = (u64)(*(u32 *)t__2e392);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e391, (u64)t__2e393, (u64)t__2e394, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_static__binding(void) {
+	u64 t__2e422;
+	u64 t__2e423;
+	u64 t__2e427;
+	u64 t__2e428;
+	u64 t__2e429;
+	u64 t__2e430;
+	u64 t__2e431;
+	u64 t__2e434;
+	u64 t__2e435;
+	u64 t__2e438;
+	u64 t__2e439;
+	u64 t_abortsite_2e425;
+	L_start_2e416:;
+	L_body_2e417:;
+	t__2e423 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_counter)))());
+	t__2e422 = (u64)(u32)(((u32)t__2e423 == (u32)((u64)1UL)));
+	if ((u32)t__2e422) goto L_passed_2e421; else goto L_failed_2e420;
+	L_failed_2e420:;
+	t_abortsite_2e425 = ((u64)0UL);
+	goto L_abort_2e426;
+	L_passed_2e421:;
+	t__2e435 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_counter)))());
+	t__2e434 = (u64)(u32)(((u32)t__2e435 == (u32)((u64)2UL)));
+	if ((u32)t__2e434) goto L_passed_2e433; else goto L_failed_2e432;
+	L_failed_2e432:;
+	t_abortsite_2e425 = ((u64)1UL);
+	goto L_abort_2e426;
+	L_passed_2e433:;
+	t__2e439 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_counter)))());
+	t__2e438 = (u64)(u32)(((u32)t__2e439 == (u32)((u64)3UL)));
+	if ((u32)t__2e438) goto L_passed_2e437; else goto L_failed_2e436;
+	L_failed_2e436:;
+	t_abortsite_2e425 = ((u64)2UL);
+	goto L_abort_2e426;
+	L_passed_2e437:;
+	goto L__2e418;
+	L__2e440:;
+	L__2e418:;
+	return;
+	L_abort_2e426:;
+	t__2e427 = (u64)((u64)t_abortsite_2e425 * (u64)((u64)16UL));
+	t__2e427 = (u64)((u64)((u64)((char *)&D_abortsites_2e424)) + (u64)t__2e427);
+	t__2e428 = (u64)(*(u64 *)t__2e427);
+	t__2e429 = (u64)((u64)t__2e427 + (u64)((u64)8UL));
+	t__2e430 = (u64)(*(u32 *)t__2e429);
+	t__2e429 = (u64)((u64)t__2e427 + (u64)((u64)12UL));
+	t__2e431 = (u64)(*(u32 *)t__2e429);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e428, (u64)t__2e430, (u64)t__2e431, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_counter(void) {
+	u64 t__2e445;
+	u64 t__2e446;
+	L_start_2e441:;
+	L_body_2e442:;
+	t__2e445 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e13)));
+	t__2e445 = (u64)(u32)((u32)t__2e445 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_static_2e13)) = (u32)t__2e445;
+	t__2e446 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e13)));
+	return (u32)t__2e446;
+	L__2e447:;
+	L__2e443:;
+	L__2e448:;
+	return 0;
+}
+static void F_invalid(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char A20[8] __attribute__((aligned(16)));
+	char A21[24] __attribute__((aligned(16)));
+	char A22[8] __attribute__((aligned(16)));
+	char A23[24] __attribute__((aligned(16)));
+	char A24[8] __attribute__((aligned(16)));
+	char A25[24] __attribute__((aligned(16)));
+	char B26[8] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char R29[4] __attribute__((aligned(16)));
+	char B30[8] __attribute__((aligned(16)));
+	char B31[24] __attribute__((aligned(16)));
+	char B32[24] __attribute__((aligned(16)));
+	char R33[4] __attribute__((aligned(16)));
+	char B34[8] __attribute__((aligned(16)));
+	char B35[24] __attribute__((aligned(16)));
+	char B36[24] __attribute__((aligned(16)));
+	char R37[4] __attribute__((aligned(16)));
+	char B38[8] __attribute__((aligned(16)));
+	char B39[24] __attribute__((aligned(16)));
+	char B40[24] __attribute__((aligned(16)));
+	char R41[4] __attribute__((aligned(16)));
+	char B42[8] __attribute__((aligned(16)));
+	char B43[24] __attribute__((aligned(16)));
+	char B44[24] __attribute__((aligned(16)));
+	char R45[4] __attribute__((aligned(16)));
+	char B46[8] __attribute__((aligned(16)));
+	char B47[24] __attribute__((aligned(16)));
+	char B48[24] __attribute__((aligned(16)));
+	char R49[4] __attribute__((aligned(16)));
+	char B50[8] __attribute__((aligned(16)));
+	char B51[24] __attribute__((aligned(16)));
+	char B52[24] __attribute__((aligned(16)));
+	char R53[4] __attribute__((aligned(16)));
+	char B54[8] __attribute__((aligned(16)));
+	char B55[24] __attribute__((aligned(16)));
+	char B56[24] __attribute__((aligned(16)));
+	char R57[4] __attribute__((aligned(16)));
+	char B58[8] __attribute__((aligned(16)));
+	char B59[24] __attribute__((aligned(16)));
+	char B60[24] __attribute__((aligned(16)));
+	char R61[4] __attribute__((aligned(16)));
+	char B62[8] __attribute__((aligned(16)));
+	char B63[24] __attribute__((aligned(16)));
+	char B64[24] __attribute__((aligned(16)));
+	char R65[4] __attribute__((aligned(16)));
+	char B66[8] __attribute__((aligned(16)));
+	char B67[24] __attribute__((aligned(16)));
+	char B68[24] __attribute__((aligned(16)));
+	char R69[4] __attribute__((aligned(16)));
+	char B70[8] __attribute__((aligned(16)));
+	char B71[24] __attribute__((aligned(16)));
+	char B72[24] __attribute__((aligned(16)));
+	char R73[4] __attribute__((aligned(16)));
+	char B74[8] __attribute__((aligned(16)));
+	char B75[24] __attribute__((aligned(16)));
+	char B76[24] __attribute__((aligned(16)));
+	char R77[4] __attribute__((aligned(16)));
+	u64 t__2e454;
+	u64 t__2e456;
+	u64 t__2e460;
+	u64 t__2e469;
+	u64 t__2e471;
+	u64 t__2e475;
+	u64 t__2e476;
+	u64 t__2e477;
+	u64 t__2e478;
+	u64 t__2e479;
+	u64 t__2e482;
+	u64 t__2e483;
+	u64 t__2e484;
+	u64 t__2e485;
+	u64 t__2e486;
+	u64 t__2e488;
+	u64 t__2e490;
+	u64 t__2e494;
+	u64 t__2e503;
+	u64 t__2e505;
+	u64 t__2e508;
+	u64 t__2e510;
+	u64 t__2e514;
+	u64 t__2e523;
+	u64 t__2e525;
+	u64 t__2e528;
+	u64 t__2e530;
+	u64 t__2e534;
+	u64 t__2e543;
+	u64 t__2e545;
+	u64 t__2e548;
+	u64 t__2e550;
+	u64 t__2e554;
+	u64 t__2e563;
+	u64 t__2e565;
+	u64 t__2e568;
+	u64 t__2e570;
+	u64 t__2e574;
+	u64 t__2e583;
+	u64 t__2e585;
+	u64 t__2e588;
+	u64 t__2e590;
+	u64 t__2e594;
+	u64 t__2e603;
+	u64 t__2e605;
+	u64 t__2e608;
+	u64 t__2e610;
+	u64 t__2e614;
+	u64 t__2e623;
+	u64 t__2e625;
+	u64 t__2e628;
+	u64 t__2e630;
+	u64 t__2e634;
+	u64 t__2e643;
+	u64 t__2e645;
+	u64 t__2e648;
+	u64 t__2e650;
+	u64 t__2e654;
+	u64 t__2e663;
+	u64 t__2e665;
+	u64 t__2e668;
+	u64 t__2e670;
+	u64 t__2e674;
+	u64 t__2e683;
+	u64 t__2e685;
+	u64 t__2e688;
+	u64 t__2e690;
+	u64 t__2e694;
+	u64 t__2e703;
+	u64 t__2e705;
+	u64 t__2e708;
+	u64 t__2e710;
+	u64 t__2e714;
+	u64 t__2e723;
+	u64 t__2e725;
+	u64 t_abortsite_2e473;
+	u64 t_object_2e455;
+	u64 t_object_2e459;
+	u64 t_object_2e489;
+	u64 t_object_2e493;
+	u64 t_object_2e509;
+	u64 t_object_2e513;
+	u64 t_object_2e529;
+	u64 t_object_2e533;
+	u64 t_object_2e549;
+	u64 t_object_2e553;
+	u64 t_object_2e569;
+	u64 t_object_2e573;
+	u64 t_object_2e589;
+	u64 t_object_2e593;
+	u64 t_object_2e609;
+	u64 t_object_2e613;
+	u64 t_object_2e629;
+	u64 t_object_2e633;
+	u64 t_object_2e649;
+	u64 t_object_2e653;
+	u64 t_object_2e669;
+	u64 t_object_2e673;
+	u64 t_object_2e689;
+	u64 t_object_2e693;
+	u64 t_object_2e709;
+	u64 t_object_2e713;
+	u64 t_tag_2e461;
+	u64 t_tag_2e495;
+	u64 t_tag_2e515;
+	u64 t_tag_2e535;
+	u64 t_tag_2e555;
+	u64 t_tag_2e575;
+	u64 t_tag_2e595;
+	u64 t_tag_2e615;
+	u64 t_tag_2e635;
+	u64 t_tag_2e655;
+	u64 t_tag_2e675;
+	u64 t_tag_2e695;
+	u64 t_tag_2e715;
+	L_start_2e449:;
+	t_object_2e455 = (u64)A0;
+	t_object_2e459 = (u64)A1;
+	t_object_2e489 = (u64)A2;
+	t_object_2e493 = (u64)A3;
+	t_object_2e509 = (u64)A4;
+	t_object_2e513 = (u64)A5;
+	t_object_2e529 = (u64)A6;
+	t_object_2e533 = (u64)A7;
+	t_object_2e549 = (u64)A8;
+	t_object_2e553 = (u64)A9;
+	t_object_2e569 = (u64)A10;
+	t_object_2e573 = (u64)A11;
+	t_object_2e589 = (u64)A12;
+	t_object_2e593 = (u64)A13;
+	t_object_2e609 = (u64)A14;
+	t_object_2e613 = (u64)A15;
+	t_object_2e629 = (u64)A16;
+	t_object_2e633 = (u64)A17;
+	t_object_2e649 = (u64)A18;
+	t_object_2e653 = (u64)A19;
+	t_object_2e669 = (u64)A20;
+	t_object_2e673 = (u64)A21;
+	t_object_2e689 = (u64)A22;
+	t_object_2e693 = (u64)A23;
+	t_object_2e709 = (u64)A24;
+	t_object_2e713 = (u64)A25;
+	L_body_2e450:;
+	*(u32 *)t_object_2e455 = (u32)((u64)3532310079UL);
+	t__2e456 = (u64)((u64)t_object_2e455 + (u64)((u64)4UL));
+	*(u32 *)t__2e456 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e459 = (u64)((u64)0UL);
+	t__2e460 = (u64)((u64)t_object_2e459 + (u64)((u64)8UL));
+	*(u64 *)t__2e460 = (u64)((u64)0UL);
+	t__2e460 = (u64)((u64)t__2e460 + (u64)((u64)8UL));
+	*(u64 *)t__2e460 = (u64)((u64)0UL);
+	BLIT((u64)B26, t_object_2e455, 8);
+	BLIT((u64)B27, ((u64)((char *)&D_strliteral_2e458)), 24);
+	BLIT((u64)B28, t_object_2e459, 24);
+	t__2e454 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R29, (u64)B26, (u64)B27, (u64)B28);
+	t_tag_2e461 = (u64)(*(u32 *)t__2e454);
+	t__2e469 = (u64)(u32)(((u32)t_tag_2e461 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e469) goto L_member_2e466; else goto L__2e468;
+	L__2e468:;
+	t__2e471 = (u64)(u32)(((u32)t_tag_2e461 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e471) goto L_member_2e467; else goto L__2e470;
+	L__2e470:;
+	goto L_matches_2e465;
+	L_member_2e466:;
+	goto L_matches_2e465;
+	L_member_2e467:;
+	goto L_matches_2e464;
+	L_matches_2e464:;
+	goto L__2e462;
+	L_matches_2e465:;
+	t_abortsite_2e473 = ((u64)0UL);
+	goto L_abort_2e474;
+	L__2e480:;
+	L__2e463:;
+	t_abortsite_2e473 = ((u64)1UL);
+	goto L_abort_2e481;
+	L__2e462:;
+	*(u32 *)t_object_2e489 = (u32)((u64)3532310079UL);
+	t__2e490 = (u64)((u64)t_object_2e489 + (u64)((u64)4UL));
+	*(u32 *)t__2e490 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e493 = (u64)((u64)0UL);
+	t__2e494 = (u64)((u64)t_object_2e493 + (u64)((u64)8UL));
+	*(u64 *)t__2e494 = (u64)((u64)0UL);
+	t__2e494 = (u64)((u64)t__2e494 + (u64)((u64)8UL));
+	*(u64 *)t__2e494 = (u64)((u64)0UL);
+	BLIT((u64)B30, t_object_2e489, 8);
+	BLIT((u64)B31, ((u64)((char *)&D_strliteral_2e492)), 24);
+	BLIT((u64)B32, t_object_2e493, 24);
+	t__2e488 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R33, (u64)B30, (u64)B31, (u64)B32);
+	t_tag_2e495 = (u64)(*(u32 *)t__2e488);
+	t__2e503 = (u64)(u32)(((u32)t_tag_2e495 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e503) goto L_member_2e500; else goto L__2e502;
+	L__2e502:;
+	t__2e505 = (u64)(u32)(((u32)t_tag_2e495 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e505) goto L_member_2e501; else goto L__2e504;
+	L__2e504:;
+	goto L_matches_2e499;
+	L_member_2e500:;
+	goto L_matches_2e499;
+	L_member_2e501:;
+	goto L_matches_2e498;
+	L_matches_2e498:;
+	goto L__2e496;
+	L_matches_2e499:;
+	t_abortsite_2e473 = ((u64)2UL);
+	goto L_abort_2e474;
+	L__2e506:;
+	L__2e497:;
+	t_abortsite_2e473 = ((u64)3UL);
+	goto L_abort_2e481;
+	L__2e496:;
+	*(u32 *)t_object_2e509 = (u32)((u64)3532310079UL);
+	t__2e510 = (u64)((u64)t_object_2e509 + (u64)((u64)4UL));
+	*(u32 *)t__2e510 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e513 = (u64)((u64)0UL);
+	t__2e514 = (u64)((u64)t_object_2e513 + (u64)((u64)8UL));
+	*(u64 *)t__2e514 = (u64)((u64)0UL);
+	t__2e514 = (u64)((u64)t__2e514 + (u64)((u64)8UL));
+	*(u64 *)t__2e514 = (u64)((u64)0UL);
+	BLIT((u64)B34, t_object_2e509, 8);
+	BLIT((u64)B35, ((u64)((char *)&D_strliteral_2e512)), 24);
+	BLIT((u64)B36, t_object_2e513, 24);
+	t__2e508 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R37, (u64)B34, (u64)B35, (u64)B36);
+	t_tag_2e515 = (u64)(*(u32 *)t__2e508);
+	t__2e523 = (u64)(u32)(((u32)t_tag_2e515 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e523) goto L_member_2e520; else goto L__2e522;
+	L__2e522:;
+	t__2e525 = (u64)(u32)(((u32)t_tag_2e515 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e525) goto L_member_2e521; else goto L__2e524;
+	L__2e524:;
+	goto L_matches_2e519;
+	L_member_2e520:;
+	goto L_matches_2e519;
+	L_member_2e521:;
+	goto L_matches_2e518;
+	L_matches_2e518:;
+	goto L__2e516;
+	L_matches_2e519:;
+	t_abortsite_2e473 = ((u64)4UL);
+	goto L_abort_2e474;
+	L__2e526:;
+	L__2e517:;
+	t_abortsite_2e473 = ((u64)5UL);
+	goto L_abort_2e481;
+	L__2e516:;
+	*(u32 *)t_object_2e529 = (u32)((u64)3532310079UL);
+	t__2e530 = (u64)((u64)t_object_2e529 + (u64)((u64)4UL));
+	*(u32 *)t__2e530 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e533 = (u64)((u64)0UL);
+	t__2e534 = (u64)((u64)t_object_2e533 + (u64)((u64)8UL));
+	*(u64 *)t__2e534 = (u64)((u64)0UL);
+	t__2e534 = (u64)((u64)t__2e534 + (u64)((u64)8UL));
+	*(u64 *)t__2e534 = (u64)((u64)0UL);
+	BLIT((u64)B38, t_object_2e529, 8);
+	BLIT((u64)B39, ((u64)((char *)&D_strliteral_2e532)), 24);
+	BLIT((u64)B40, t_object_2e533, 24);
+	t__2e528 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R41, (u64)B38, (u64)B39, (u64)B40);
+	t_tag_2e535 = (u64)(*(u32 *)t__2e528);
+	t__2e543 = (u64)(u32)(((u32)t_tag_2e535 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e543) goto L_member_2e540; else goto L__2e542;
+	L__2e542:;
+	t__2e545 = (u64)(u32)(((u32)t_tag_2e535 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e545) goto L_member_2e541; else goto L__2e544;
+	L__2e544:;
+	goto L_matches_2e539;
+	L_member_2e540:;
+	goto L_matches_2e539;
+	L_member_2e541:;
+	goto L_matches_2e538;
+	L_matches_2e538:;
+	goto L__2e536;
+	L_matches_2e539:;
+	t_abortsite_2e473 = ((u64)6UL);
+	goto L_abort_2e474;
+	L__2e546:;
+	L__2e537:;
+	t_abortsite_2e473 = ((u64)7UL);
+	goto L_abort_2e481;
+	L__2e536:;
+	*(u32 *)t_object_2e549 = (u32)((u64)3532310079UL);
+	t__2e550 = (u64)((u64)t_object_2e549 + (u64)((u64)4UL));
+	*(u32 *)t__2e550 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e553 = (u64)((u64)0UL);
+	t__2e554 = (u64)((u64)t_object_2e553 + (u64)((u64)8UL));
+	*(u64 *)t__2e554 = (u64)((u64)0UL);
+	t__2e554 = (u64)((u64)t__2e554 + (u64)((u64)8UL));
+	*(u64 *)t__2e554 = (u64)((u64)0UL);
+	BLIT((u64)B42, t_object_2e549, 8);
+	BLIT((u64)B43, ((u64)((char *)&D_strliteral_2e552)), 24);
+	BLIT((u64)B44, t_object_2e553, 24);
+	t__2e548 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R45, (u64)B42, (u64)B43, (u64)B44);
+	t_tag_2e555 = (u64)(*(u32 *)t__2e548);
+	t__2e563 = (u64)(u32)(((u32)t_tag_2e555 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e563) goto L_member_2e560; else goto L__2e562;
+	L__2e562:;
+	t__2e565 = (u64)(u32)(((u32)t_tag_2e555 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e565) goto L_member_2e561; else goto L__2e564;
+	L__2e564:;
+	goto L_matches_2e559;
+	L_member_2e560:;
+	goto L_matches_2e559;
+	L_member_2e561:;
+	goto L_matches_2e558;
+	L_matches_2e558:;
+	goto L__2e556;
+	L_matches_2e559:;
+	t_abortsite_2e473 = ((u64)8UL);
+	goto L_abort_2e474;
+	L__2e566:;
+	L__2e557:;
+	t_abortsite_2e473 = ((u64)9UL);
+	goto L_abort_2e481;
+	L__2e556:;
+	*(u32 *)t_object_2e569 = (u32)((u64)3532310079UL);
+	t__2e570 = (u64)((u64)t_object_2e569 + (u64)((u64)4UL));
+	*(u32 *)t__2e570 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e573 = (u64)((u64)0UL);
+	t__2e574 = (u64)((u64)t_object_2e573 + (u64)((u64)8UL));
+	*(u64 *)t__2e574 = (u64)((u64)0UL);
+	t__2e574 = (u64)((u64)t__2e574 + (u64)((u64)8UL));
+	*(u64 *)t__2e574 = (u64)((u64)0UL);
+	BLIT((u64)B46, t_object_2e569, 8);
+	BLIT((u64)B47, ((u64)((char *)&D_strliteral_2e572)), 24);
+	BLIT((u64)B48, t_object_2e573, 24);
+	t__2e568 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R49, (u64)B46, (u64)B47, (u64)B48);
+	t_tag_2e575 = (u64)(*(u32 *)t__2e568);
+	t__2e583 = (u64)(u32)(((u32)t_tag_2e575 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e583) goto L_member_2e580; else goto L__2e582;
+	L__2e582:;
+	t__2e585 = (u64)(u32)(((u32)t_tag_2e575 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e585) goto L_member_2e581; else goto L__2e584;
+	L__2e584:;
+	goto L_matches_2e579;
+	L_member_2e580:;
+	goto L_matches_2e579;
+	L_member_2e581:;
+	goto L_matches_2e578;
+	L_matches_2e578:;
+	goto L__2e576;
+	L_matches_2e579:;
+	t_abortsite_2e473 = ((u64)10UL);
+	goto L_abort_2e474;
+	L__2e586:;
+	L__2e577:;
+	t_abortsite_2e473 = ((u64)11UL);
+	goto L_abort_2e481;
+	L__2e576:;
+	*(u32 *)t_object_2e589 = (u32)((u64)3532310079UL);
+	t__2e590 = (u64)((u64)t_object_2e589 + (u64)((u64)4UL));
+	*(u32 *)t__2e590 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e593 = (u64)((u64)0UL);
+	t__2e594 = (u64)((u64)t_object_2e593 + (u64)((u64)8UL));
+	*(u64 *)t__2e594 = (u64)((u64)0UL);
+	t__2e594 = (u64)((u64)t__2e594 + (u64)((u64)8UL));
+	*(u64 *)t__2e594 = (u64)((u64)0UL);
+	BLIT((u64)B50, t_object_2e589, 8);
+	BLIT((u64)B51, ((u64)((char *)&D_strliteral_2e592)), 24);
+	BLIT((u64)B52, t_object_2e593, 24);
+	t__2e588 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R53, (u64)B50, (u64)B51, (u64)B52);
+	t_tag_2e595 = (u64)(*(u32 *)t__2e588);
+	t__2e603 = (u64)(u32)(((u32)t_tag_2e595 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e603) goto L_member_2e600; else goto L__2e602;
+	L__2e602:;
+	t__2e605 = (u64)(u32)(((u32)t_tag_2e595 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e605) goto L_member_2e601; else goto L__2e604;
+	L__2e604:;
+	goto L_matches_2e599;
+	L_member_2e600:;
+	goto L_matches_2e599;
+	L_member_2e601:;
+	goto L_matches_2e598;
+	L_matches_2e598:;
+	goto L__2e596;
+	L_matches_2e599:;
+	t_abortsite_2e473 = ((u64)12UL);
+	goto L_abort_2e474;
+	L__2e606:;
+	L__2e597:;
+	t_abortsite_2e473 = ((u64)13UL);
+	goto L_abort_2e481;
+	L__2e596:;
+	*(u32 *)t_object_2e609 = (u32)((u64)3532310079UL);
+	t__2e610 = (u64)((u64)t_object_2e609 + (u64)((u64)4UL));
+	*(u32 *)t__2e610 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e613 = (u64)((u64)0UL);
+	t__2e614 = (u64)((u64)t_object_2e613 + (u64)((u64)8UL));
+	*(u64 *)t__2e614 = (u64)((u64)0UL);
+	t__2e614 = (u64)((u64)t__2e614 + (u64)((u64)8UL));
+	*(u64 *)t__2e614 = (u64)((u64)0UL);
+	BLIT((u64)B54, t_object_2e609, 8);
+	BLIT((u64)B55, ((u64)((char *)&D_strliteral_2e612)), 24);
+	BLIT((u64)B56, t_object_2e613, 24);
+	t__2e608 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R57, (u64)B54, (u64)B55, (u64)B56);
+	t_tag_2e615 = (u64)(*(u32 *)t__2e608);
+	t__2e623 = (u64)(u32)(((u32)t_tag_2e615 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e623) goto L_member_2e620; else goto L__2e622;
+	L__2e622:;
+	t__2e625 = (u64)(u32)(((u32)t_tag_2e615 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e625) goto L_member_2e621; else goto L__2e624;
+	L__2e624:;
+	goto L_matches_2e619;
+	L_member_2e620:;
+	goto L_matches_2e619;
+	L_member_2e621:;
+	goto L_matches_2e618;
+	L_matches_2e618:;
+	goto L__2e616;
+	L_matches_2e619:;
+	t_abortsite_2e473 = ((u64)14UL);
+	goto L_abort_2e474;
+	L__2e626:;
+	L__2e617:;
+	t_abortsite_2e473 = ((u64)15UL);
+	goto L_abort_2e481;
+	L__2e616:;
+	*(u32 *)t_object_2e629 = (u32)((u64)3532310079UL);
+	t__2e630 = (u64)((u64)t_object_2e629 + (u64)((u64)4UL));
+	*(u32 *)t__2e630 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e633 = (u64)((u64)0UL);
+	t__2e634 = (u64)((u64)t_object_2e633 + (u64)((u64)8UL));
+	*(u64 *)t__2e634 = (u64)((u64)0UL);
+	t__2e634 = (u64)((u64)t__2e634 + (u64)((u64)8UL));
+	*(u64 *)t__2e634 = (u64)((u64)0UL);
+	BLIT((u64)B58, t_object_2e629, 8);
+	BLIT((u64)B59, ((u64)((char *)&D_strliteral_2e632)), 24);
+	BLIT((u64)B60, t_object_2e633, 24);
+	t__2e628 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R61, (u64)B58, (u64)B59, (u64)B60);
+	t_tag_2e635 = (u64)(*(u32 *)t__2e628);
+	t__2e643 = (u64)(u32)(((u32)t_tag_2e635 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e643) goto L_member_2e640; else goto L__2e642;
+	L__2e642:;
+	t__2e645 = (u64)(u32)(((u32)t_tag_2e635 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e645) goto L_member_2e641; else goto L__2e644;
+	L__2e644:;
+	goto L_matches_2e639;
+	L_member_2e640:;
+	goto L_matches_2e639;
+	L_member_2e641:;
+	goto L_matches_2e638;
+	L_matches_2e638:;
+	goto L__2e636;
+	L_matches_2e639:;
+	t_abortsite_2e473 = ((u64)16UL);
+	goto L_abort_2e474;
+	L__2e646:;
+	L__2e637:;
+	t_abortsite_2e473 = ((u64)17UL);
+	goto L_abort_2e481;
+	L__2e636:;
+	*(u32 *)t_object_2e649 = (u32)((u64)3532310079UL);
+	t__2e650 = (u64)((u64)t_object_2e649 + (u64)((u64)4UL));
+	*(u32 *)t__2e650 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e653 = (u64)((u64)0UL);
+	t__2e654 = (u64)((u64)t_object_2e653 + (u64)((u64)8UL));
+	*(u64 *)t__2e654 = (u64)((u64)0UL);
+	t__2e654 = (u64)((u64)t__2e654 + (u64)((u64)8UL));
+	*(u64 *)t__2e654 = (u64)((u64)0UL);
+	BLIT((u64)B62, t_object_2e649, 8);
+	BLIT((u64)B63, ((u64)((char *)&D_strliteral_2e652)), 24);
+	BLIT((u64)B64, t_object_2e653, 24);
+	t__2e648 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R65, (u64)B62, (u64)B63, (u64)B64);
+	t_tag_2e655 = (u64)(*(u32 *)t__2e648);
+	t__2e663 = (u64)(u32)(((u32)t_tag_2e655 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e663) goto L_member_2e660; else goto L__2e662;
+	L__2e662:;
+	t__2e665 = (u64)(u32)(((u32)t_tag_2e655 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e665) goto L_member_2e661; else goto L__2e664;
+	L__2e664:;
+	goto L_matches_2e659;
+	L_member_2e660:;
+	goto L_matches_2e659;
+	L_member_2e661:;
+	goto L_matches_2e658;
+	L_matches_2e658:;
+	goto L__2e656;
+	L_matches_2e659:;
+	t_abortsite_2e473 = ((u64)18UL);
+	goto L_abort_2e474;
+	L__2e666:;
+	L__2e657:;
+	t_abortsite_2e473 = ((u64)19UL);
+	goto L_abort_2e481;
+	L__2e656:;
+	*(u32 *)t_object_2e669 = (u32)((u64)3532310079UL);
+	t__2e670 = (u64)((u64)t_object_2e669 + (u64)((u64)4UL));
+	*(u32 *)t__2e670 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e673 = (u64)((u64)0UL);
+	t__2e674 = (u64)((u64)t_object_2e673 + (u64)((u64)8UL));
+	*(u64 *)t__2e674 = (u64)((u64)0UL);
+	t__2e674 = (u64)((u64)t__2e674 + (u64)((u64)8UL));
+	*(u64 *)t__2e674 = (u64)((u64)0UL);
+	BLIT((u64)B66, t_object_2e669, 8);
+	BLIT((u64)B67, ((u64)((char *)&D_strliteral_2e672)), 24);
+	BLIT((u64)B68, t_object_2e673, 24);
+	t__2e668 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R69, (u64)B66, (u64)B67, (u64)B68);
+	t_tag_2e675 = (u64)(*(u32 *)t__2e668);
+	t__2e683 = (u64)(u32)(((u32)t_tag_2e675 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e683) goto L_member_2e680; else goto L__2e682;
+	L__2e682:;
+	t__2e685 = (u64)(u32)(((u32)t_tag_2e675 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e685) goto L_member_2e681; else goto L__2e684;
+	L__2e684:;
+	goto L_matches_2e679;
+	L_member_2e680:;
+	goto L_matches_2e679;
+	L_member_2e681:;
+	goto L_matches_2e678;
+	L_matches_2e678:;
+	goto L__2e676;
+	L_matches_2e679:;
+	t_abortsite_2e473 = ((u64)20UL);
+	goto L_abort_2e474;
+	L__2e686:;
+	L__2e677:;
+	t_abortsite_2e473 = ((u64)21UL);
+	goto L_abort_2e481;
+	L__2e676:;
+	*(u32 *)t_object_2e689 = (u32)((u64)3532310079UL);
+	t__2e690 = (u64)((u64)t_object_2e689 + (u64)((u64)4UL));
+	*(u32 *)t__2e690 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e693 = (u64)((u64)0UL);
+	t__2e694 = (u64)((u64)t_object_2e693 + (u64)((u64)8UL));
+	*(u64 *)t__2e694 = (u64)((u64)0UL);
+	t__2e694 = (u64)((u64)t__2e694 + (u64)((u64)8UL));
+	*(u64 *)t__2e694 = (u64)((u64)0UL);
+	BLIT((u64)B70, t_object_2e689, 8);
+	BLIT((u64)B71, ((u64)((char *)&D_strliteral_2e692)), 24);
+	BLIT((u64)B72, t_object_2e693, 24);
+	t__2e688 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R73, (u64)B70, (u64)B71, (u64)B72);
+	t_tag_2e695 = (u64)(*(u32 *)t__2e688);
+	t__2e703 = (u64)(u32)(((u32)t_tag_2e695 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e703) goto L_member_2e700; else goto L__2e702;
+	L__2e702:;
+	t__2e705 = (u64)(u32)(((u32)t_tag_2e695 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e705) goto L_member_2e701; else goto L__2e704;
+	L__2e704:;
+	goto L_matches_2e699;
+	L_member_2e700:;
+	goto L_matches_2e699;
+	L_member_2e701:;
+	goto L_matches_2e698;
+	L_matches_2e698:;
+	goto L__2e696;
+	L_matches_2e699:;
+	t_abortsite_2e473 = ((u64)22UL);
+	goto L_abort_2e474;
+	L__2e706:;
+	L__2e697:;
+	t_abortsite_2e473 = ((u64)23UL);
+	goto L_abort_2e481;
+	L__2e696:;
+	*(u32 *)t_object_2e709 = (u32)((u64)3532310079UL);
+	t__2e710 = (u64)((u64)t_object_2e709 + (u64)((u64)4UL));
+	*(u32 *)t__2e710 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e713 = (u64)((u64)0UL);
+	t__2e714 = (u64)((u64)t_object_2e713 + (u64)((u64)8UL));
+	*(u64 *)t__2e714 = (u64)((u64)0UL);
+	t__2e714 = (u64)((u64)t__2e714 + (u64)((u64)8UL));
+	*(u64 *)t__2e714 = (u64)((u64)0UL);
+	BLIT((u64)B74, t_object_2e709, 8);
+	BLIT((u64)B75, ((u64)((char *)&D_strliteral_2e712)), 24);
+	BLIT((u64)B76, t_object_2e713, 24);
+	t__2e708 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R77, (u64)B74, (u64)B75, (u64)B76);
+	t_tag_2e715 = (u64)(*(u32 *)t__2e708);
+	t__2e723 = (u64)(u32)(((u32)t_tag_2e715 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e723) goto L_member_2e720; else goto L__2e722;
+	L__2e722:;
+	t__2e725 = (u64)(u32)(((u32)t_tag_2e715 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e725) goto L_member_2e721; else goto L__2e724;
+	L__2e724:;
+	goto L_matches_2e719;
+	L_member_2e720:;
+	goto L_matches_2e719;
+	L_member_2e721:;
+	goto L_matches_2e718;
+	L_matches_2e718:;
+	goto L__2e716;
+	L_matches_2e719:;
+	t_abortsite_2e473 = ((u64)24UL);
+	goto L_abort_2e474;
+	L__2e726:;
+	L__2e717:;
+	t_abortsite_2e473 = ((u64)25UL);
+	goto L_abort_2e481;
+	L__2e716:;
+	goto L__2e451;
+	L__2e727:;
+	L__2e451:;
+	return;
+	L_abort_2e474:;
+	t__2e475 = (u64)((u64)t_abortsite_2e473 * (u64)((u64)16UL));
+	t__2e475 = (u64)((u64)((u64)((char *)&D_abortsites_2e472)) + (u64)t__2e475);
+	t__2e476 = (u64)(*(u64 *)t__2e475);
+	t__2e477 = (u64)((u64)t__2e475 + (u64)((u64)8UL));
+	t__2e478 = (u64)(*(u32 *)t__2e477);
+	t__2e477 = (u64)((u64)t__2e475 + (u64)((u64)12UL));
+	t__2e479 = (u64)(*(u32 *)t__2e477);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e476, (u64)t__2e478, (u64)t__2e479, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e481:;
+	t__2e482 = (u64)((u64)t_abortsite_2e473 * (u64)((u64)16UL));
+	t__2e482 = (u64)((u64)((u64)((char *)&D_abortsites_2e472)) + (u64)t__2e482);
+	t__2e483 = (u64)(*(u64 *)t__2e482);
+	t__2e484 = (u64)((u64)t__2e482 + (u64)((u64)8UL));
+	t__2e485 = (u64)(*(u32 *)t__2e484);
+	t__2e484 = (u64)((u64)t__2e482 + (u64)((u64)12UL));
+	t__2e486 = (u64)(*(u32 *)t__2e484);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e483, (u64)t__2e485, (u64)t__2e486, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_storage(void) {
+	u64 t__2e734;
+	u64 t__2e738;
+	u64 t__2e739;
+	u64 t__2e740;
+	u64 t__2e741;
+	u64 t__2e742;
+	u64 t__2e745;
+	u64 t__2e748;
+	u64 t__2e751;
+	u64 t__2e752;
+	u64 t__2e754;
+	u64 t__2e755;
+	u64 t__2e756;
+	u64 t__2e757;
+	u64 t__2e758;
+	u64 t__2e759;
+	u64 t__2e760;
+	u64 t__2e761;
+	u64 t__2e762;
+	u64 t__2e763;
+	u64 t__2e766;
+	u64 t__2e768;
+	u64 t__2e769;
+	u64 t__2e770;
+	u64 t__2e773;
+	u64 t__2e776;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e781;
+	u64 t__2e782;
+	u64 t__2e783;
+	u64 t__2e784;
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e790;
+	u64 t__2e791;
+	u64 t__2e792;
+	u64 t__2e793;
+	u64 t__2e794;
+	u64 t__2e795;
+	u64 t__2e796;
+	u64 t__2e797;
+	u64 t__2e798;
+	u64 t__2e799;
+	u64 t__2e800;
+	u64 t__2e801;
+	u64 t__2e802;
+	u64 t__2e803;
+	u64 t__2e806;
+	u64 t__2e807;
+	u64 t__2e808;
+	u64 t__2e809;
+	u64 t__2e810;
+	u64 t__2e811;
+	u64 t__2e812;
+	u64 t__2e813;
+	u64 t__2e814;
+	u64 t__2e817;
+	u64 t__2e820;
+	u64 t__2e821;
+	u64 t__2e822;
+	u64 t__2e823;
+	u64 t__2e826;
+	u64 t__2e829;
+	u64 t__2e832;
+	u64 t__2e833;
+	u64 t__2e835;
+	u64 t__2e838;
+	u64 t__2e841;
+	u64 t__2e843;
+	u64 t__2e844;
+	u64 t__2e846;
+	u64 t__2e849;
+	u64 t__2e852;
+	u64 t__2e854;
+	u64 t__2e855;
+	u64 t__2e857;
+	u64 t__2e860;
+	u64 t__2e863;
+	u64 t__2e866;
+	u64 t__2e870;
+	u64 t__2e871;
+	u64 t__2e874;
+	u64 t__2e875;
+	u64 t__2e877;
+	u64 t__2e880;
+	u64 t__2e883;
+	u64 t__2e886;
+	u64 t__2e890;
+	u64 t__2e891;
+	u64 t__2e893;
+	u64 t__2e894;
+	u64 t__2e895;
+	u64 t__2e896;
+	u64 t__2e898;
+	u64 t__2e901;
+	u64 t__2e904;
+	u64 t__2e907;
+	u64 t__2e909;
+	u64 t__2e910;
+	u64 t__2e912;
+	u64 t__2e913;
+	u64 t__2e914;
+	u64 t__2e915;
+	u64 t__2e917;
+	u64 t__2e920;
+	u64 t__2e923;
+	u64 t__2e926;
+	u64 t__2e930;
+	u64 t__2e931;
+	u64 t__2e933;
+	u64 t__2e934;
+	u64 t__2e935;
+	u64 t__2e936;
+	u64 t__2e938;
+	u64 t__2e941;
+	u64 t__2e944;
+	u64 t__2e947;
+	u64 t__2e949;
+	u64 t__2e950;
+	u64 t__2e952;
+	u64 t__2e953;
+	u64 t__2e954;
+	u64 t__2e955;
+	u64 t__2e957;
+	u64 t__2e960;
+	u64 t__2e961;
+	u64 t__2e964;
+	u64 t__2e965;
+	u64 t__2e968;
+	u64 t__2e969;
+	u64 t_abortsite_2e736;
+	u64 t_field_2e831;
+	u64 t_field_2e834;
+	u64 t_field_2e842;
+	u64 t_field_2e845;
+	u64 t_field_2e853;
+	u64 t_field_2e856;
+	u64 t_field_2e868;
+	u64 t_field_2e869;
+	u64 t_field_2e872;
+	u64 t_field_2e873;
+	u64 t_field_2e876;
+	u64 t_field_2e889;
+	u64 t_field_2e892;
+	u64 t_field_2e897;
+	u64 t_field_2e908;
+	u64 t_field_2e911;
+	u64 t_field_2e916;
+	u64 t_field_2e929;
+	u64 t_field_2e932;
+	u64 t_field_2e937;
+	u64 t_field_2e948;
+	u64 t_field_2e951;
+	u64 t_field_2e956;
+	L_start_2e728:;
+	L_body_2e729:;
+	t__2e734 = (u64)(u32)(((u64)((u64)3UL) == (u64)((u64)3UL)));
+	if ((u32)t__2e734) goto L_passed_2e733; else goto L_failed_2e732;
+	L_failed_2e732:;
+	t_abortsite_2e736 = ((u64)0UL);
+	goto L_abort_2e737;
+	L_passed_2e733:;
+	t__2e754 = (u64)((i64)(i32)((u64)0UL));
+	t__2e752 = (u64)((u64)t__2e754 * (u64)((u64)4UL));
+	t__2e752 = (u64)((u64)((u64)((char *)&D_ar)) + (u64)t__2e752);
+	t__2e755 = (u64)(u32)(*(i32 *)t__2e752);
+	t__2e751 = (u64)(u32)(((u32)t__2e755 == (u32)((u64)1UL)));
+	t__2e748 = (u64)(u32)t__2e751;
+	if ((u32)t__2e748) goto L__2e749; else goto L__2e750;
+	L__2e749:;
+	t__2e758 = (u64)((i64)(i32)((u64)1UL));
+	t__2e757 = (u64)((u64)t__2e758 * (u64)((u64)4UL));
+	t__2e757 = (u64)((u64)((u64)((char *)&D_ar)) + (u64)t__2e757);
+	t__2e759 = (u64)(u32)(*(i32 *)t__2e757);
+	t__2e756 = (u64)(u32)(((u32)t__2e759 == (u32)((u64)2UL)));
+	t__2e748 = (u64)(u32)t__2e756;
+	goto L__2e750;
+	L__2e750:;
+	t__2e745 = (u64)(u32)t__2e748;
+	if ((u32)t__2e745) goto L__2e746; else goto L__2e747;
+	L__2e746:;
+	t__2e762 = (u64)((i64)(i32)((u64)2UL));
+	t__2e761 = (u64)((u64)t__2e762 * (u64)((u64)4UL));
+	t__2e761 = (u64)((u64)((u64)((char *)&D_ar)) + (u64)t__2e761);
+	t__2e763 = (u64)(u32)(*(i32 *)t__2e761);
+	t__2e760 = (u64)(u32)(((u32)t__2e763 == (u32)((u64)3UL)));
+	t__2e745 = (u64)(u32)t__2e760;
+	goto L__2e747;
+	L__2e747:;
+	if ((u32)t__2e745) goto L_passed_2e744; else goto L_failed_2e743;
+	L_failed_2e743:;
+	t_abortsite_2e736 = ((u64)1UL);
+	goto L_abort_2e737;
+	L_passed_2e744:;
+	t__2e768 = (u64)((u64)((u64)((char *)&D_sl)) + (u64)((u64)8UL));
+	t__2e769 = (u64)((u64)((u64)((char *)&D_sl)) + (u64)((u64)16UL));
+	t__2e770 = (u64)(*(u64 *)t__2e768);
+	t__2e766 = (u64)(u32)(((u64)t__2e770 == (u64)((u64)3UL)));
+	if ((u32)t__2e766) goto L_passed_2e765; else goto L_failed_2e764;
+	L_failed_2e764:;
+	t_abortsite_2e736 = ((u64)2UL);
+	goto L_abort_2e737;
+	L_passed_2e765:;
+	t__2e781 = (u64)((u64)((u64)((char *)&D_sl)) + (u64)((u64)8UL));
+	t__2e782 = (u64)((u64)((u64)((char *)&D_sl)) + (u64)((u64)16UL));
+	t__2e783 = (u64)(*(u64 *)((u64)((char *)&D_sl)));
+	t__2e784 = (u64)(*(u64 *)t__2e781);
+	t__2e785 = (u64)((i64)(i32)((u64)0UL));
+	t__2e780 = (u64)((u64)t__2e785 * (u64)((u64)4UL));
+	t__2e780 = (u64)((u64)t__2e783 + (u64)t__2e780);
+	t__2e786 = (u64)(u32)(((u64)t__2e785 < (u64)t__2e784));
+	if ((u32)t__2e786) goto L__2e788; else goto L__2e787;
+	L__2e787:;
+	t_abortsite_2e736 = ((u64)3UL);
+	goto L_abort_2e789;
+	L__2e788:;
+	t__2e795 = (u64)(u32)(*(i32 *)t__2e780);
+	t__2e779 = (u64)(u32)(((u32)t__2e795 == (u32)((u64)1UL)));
+	t__2e776 = (u64)(u32)t__2e779;
+	if ((u32)t__2e776) goto L__2e777; else goto L__2e778;
+	L__2e777:;
+	t__2e798 = (u64)((u64)((u64)((char *)&D_sl)) + (u64)((u64)8UL));
+	t__2e799 = (u64)((u64)((u64)((char *)&D_sl)) + (u64)((u64)16UL));
+	t__2e800 = (u64)(*(u64 *)((u64)((char *)&D_sl)));
+	t__2e801 = (u64)(*(u64 *)t__2e798);
+	t__2e802 = (u64)((i64)(i32)((u64)1UL));
+	t__2e797 = (u64)((u64)t__2e802 * (u64)((u64)4UL));
+	t__2e797 = (u64)((u64)t__2e800 + (u64)t__2e797);
+	t__2e803 = (u64)(u32)(((u64)t__2e802 < (u64)t__2e801));
+	if ((u32)t__2e803) goto L__2e805; else goto L__2e804;
+	L__2e804:;
+	t_abortsite_2e736 = ((u64)4UL);
+	goto L_abort_2e789;
+	L__2e805:;
+	t__2e806 = (u64)(u32)(*(i32 *)t__2e797);
+	t__2e796 = (u64)(u32)(((u32)t__2e806 == (u32)((u64)2UL)));
+	t__2e776 = (u64)(u32)t__2e796;
+	goto L__2e778;
+	L__2e778:;
+	t__2e773 = (u64)(u32)t__2e776;
+	if ((u32)t__2e773) goto L__2e774; else goto L__2e775;
+	L__2e774:;
+	t__2e809 = (u64)((u64)((u64)((char *)&D_sl)) + (u64)((u64)8UL));
+	t__2e810 = (u64)((u64)((u64)((char *)&D_sl)) + (u64)((u64)16UL));
+	t__2e811 = (u64)(*(u64 *)((u64)((char *)&D_sl)));
+	t__2e812 = (u64)(*(u64 *)t__2e809);
+	t__2e813 = (u64)((i64)(i32)((u64)2UL));
+	t__2e808 = (u64)((u64)t__2e813 * (u64)((u64)4UL));
+	t__2e808 = (u64)((u64)t__2e811 + (u64)t__2e808);
+	t__2e814 = (u64)(u32)(((u64)t__2e813 < (u64)t__2e812));
+	if ((u32)t__2e814) goto L__2e816; else goto L__2e815;
+	L__2e815:;
+	t_abortsite_2e736 = ((u64)5UL);
+	goto L_abort_2e789;
+	L__2e816:;
+	t__2e817 = (u64)(u32)(*(i32 *)t__2e808);
+	t__2e807 = (u64)(u32)(((u32)t__2e817 == (u32)((u64)3UL)));
+	t__2e773 = (u64)(u32)t__2e807;
+	goto L__2e775;
+	L__2e775:;
+	if ((u32)t__2e773) goto L_passed_2e772; else goto L_failed_2e771;
+	L_failed_2e771:;
+	t_abortsite_2e736 = ((u64)6UL);
+	goto L_abort_2e737;
+	L_passed_2e772:;
+	t__2e821 = (u64)((u64)((u64)((char *)&D_st)) + (u64)((u64)8UL));
+	t__2e822 = (u64)((u64)((u64)((char *)&D_st)) + (u64)((u64)16UL));
+	t__2e823 = (u64)(*(u64 *)t__2e821);
+	t__2e820 = (u64)(u32)(((u64)t__2e823 == (u64)((u64)6UL)));
+	if ((u32)t__2e820) goto L_passed_2e819; else goto L_failed_2e818;
+	L_failed_2e818:;
+	t_abortsite_2e736 = ((u64)7UL);
+	goto L_abort_2e737;
+	L_passed_2e819:;
+	t_field_2e831 = (u64)((u64)((u64)((char *)&D_su)) + (u64)((u64)0UL));
+	t__2e832 = (u64)(u32)(*(i32 *)t_field_2e831);
+	t__2e829 = (u64)(u32)(((u32)t__2e832 == (u32)((u64)20UL)));
+	t__2e826 = (u64)(u32)t__2e829;
+	if ((u32)t__2e826) goto L__2e827; else goto L__2e828;
+	L__2e827:;
+	t_field_2e834 = (u64)((u64)((u64)((char *)&D_su)) + (u64)((u64)4UL));
+	t__2e835 = (u64)(u32)(*(i32 *)t_field_2e834);
+	t__2e833 = (u64)(u32)(((u32)t__2e835 == (u32)((u64)10UL)));
+	t__2e826 = (u64)(u32)t__2e833;
+	goto L__2e828;
+	L__2e828:;
+	if ((u32)t__2e826) goto L_passed_2e825; else goto L_failed_2e824;
+	L_failed_2e824:;
+	t_abortsite_2e736 = ((u64)8UL);
+	goto L_abort_2e737;
+	L_passed_2e825:;
+	t_field_2e842 = (u64)((u64)((u64)((char *)&D_su__autofill)) + (u64)((u64)0UL));
+	t__2e843 = (u64)(u32)(*(i32 *)t_field_2e842);
+	t__2e841 = (u64)(u32)(((u32)t__2e843 == (u32)((u64)20UL)));
+	t__2e838 = (u64)(u32)t__2e841;
+	if ((u32)t__2e838) goto L__2e839; else goto L__2e840;
+	L__2e839:;
+	t_field_2e845 = (u64)((u64)((u64)((char *)&D_su__autofill)) + (u64)((u64)4UL));
+	t__2e846 = (u64)(u32)(*(i32 *)t_field_2e845);
+	t__2e844 = (u64)(u32)(((u32)t__2e846 == (u32)((u64)10UL)));
+	t__2e838 = (u64)(u32)t__2e844;
+	goto L__2e840;
+	L__2e840:;
+	if ((u32)t__2e838) goto L_passed_2e837; else goto L_failed_2e836;
+	L_failed_2e836:;
+	t_abortsite_2e736 = ((u64)9UL);
+	goto L_abort_2e737;
+	L_passed_2e837:;
+	t_field_2e853 = (u64)((u64)((u64)((char *)&D_au)) + (u64)((u64)0UL));
+	t__2e854 = (u64)(u32)(*(i32 *)t_field_2e853);
+	t__2e852 = (u64)(u32)(((u32)t__2e854 == (u32)((u64)0UL)));
+	t__2e849 = (u64)(u32)t__2e852;
+	if ((u32)t__2e849) goto L__2e850; else goto L__2e851;
+	L__2e850:;
+	t_field_2e856 = (u64)((u64)((u64)((char *)&D_au)) + (u64)((u64)4UL));
+	t__2e857 = (u64)(u32)(*(i32 *)t_field_2e856);
+	t__2e855 = (u64)(u32)(((u32)t__2e857 == (u32)((u64)0UL)));
+	t__2e849 = (u64)(u32)t__2e855;
+	goto L__2e851;
+	L__2e851:;
+	if ((u32)t__2e849) goto L_passed_2e848; else goto L_failed_2e847;
+	L_failed_2e847:;
+	t_abortsite_2e736 = ((u64)10UL);
+	goto L_abort_2e737;
+	L_passed_2e848:;
+	t_field_2e868 = (u64)((u64)((u64)((char *)&D_a3)) + (u64)((u64)0UL));
+	t_field_2e869 = (u64)((u64)t_field_2e868 + (u64)((u64)0UL));
+	t__2e870 = (u64)(u32)(*(i32 *)t_field_2e869);
+	t__2e866 = (u64)(u32)(((u32)t__2e870 == (u32)((u64)0UL)));
+	t__2e863 = (u64)(u32)t__2e866;
+	if ((u32)t__2e863) goto L__2e864; else goto L__2e865;
+	L__2e864:;
+	t_field_2e872 = (u64)((u64)((u64)((char *)&D_a3)) + (u64)((u64)0UL));
+	t_field_2e873 = (u64)((u64)t_field_2e872 + (u64)((u64)4UL));
+	t__2e874 = (u64)(u32)(*(i32 *)t_field_2e873);
+	t__2e871 = (u64)(u32)(((u32)t__2e874 == (u32)((u64)0UL)));
+	t__2e863 = (u64)(u32)t__2e871;
+	goto L__2e865;
+	L__2e865:;
+	t__2e860 = (u64)(u32)t__2e863;
+	if ((u32)t__2e860) goto L__2e861; else goto L__2e862;
+	L__2e861:;
+	t_field_2e876 = (u64)((u64)((u64)((char *)&D_a3)) + (u64)((u64)8UL));
+	t__2e877 = (u64)(u32)(*(i32 *)t_field_2e876);
+	t__2e875 = (u64)(u32)(((u32)t__2e877 == (u32)((u64)0UL)));
+	t__2e860 = (u64)(u32)t__2e875;
+	goto L__2e862;
+	L__2e862:;
+	if ((u32)t__2e860) goto L_passed_2e859; else goto L_failed_2e858;
+	L_failed_2e858:;
+	t_abortsite_2e736 = ((u64)11UL);
+	goto L_abort_2e737;
+	L_passed_2e859:;
+	t_field_2e889 = (u64)((u64)((u64)((char *)&D_em)) + (u64)((u64)0UL));
+	t__2e890 = (u64)(u32)(*(u32 *)t_field_2e889);
+	t__2e886 = (u64)(u32)(((u32)t__2e890 == (u32)((u64)3UL)));
+	t__2e883 = (u64)(u32)t__2e886;
+	if ((u32)t__2e883) goto L__2e884; else goto L__2e885;
+	L__2e884:;
+	t_field_2e892 = (u64)((u64)((u64)((char *)&D_em)) + (u64)((u64)4UL));
+	t__2e893 = (u64)(u32)(*(u8 *)t_field_2e892);
+	t__2e894 = (u64)(u32)((u8)t__2e893);
+	t__2e895 = (u64)(u32)((u8)((u64)4UL));
+	t__2e891 = (u64)(u32)(((u32)t__2e894 == (u32)t__2e895));
+	t__2e883 = (u64)(u32)t__2e891;
+	goto L__2e885;
+	L__2e885:;
+	t__2e880 = (u64)(u32)t__2e883;
+	if ((u32)t__2e880) goto L__2e881; else goto L__2e882;
+	L__2e881:;
+	t_field_2e897 = (u64)((u64)((u64)((char *)&D_em)) + (u64)((u64)8UL));
+	t__2e898 = (u64)(u32)(*(i32 *)t_field_2e897);
+	t__2e896 = (u64)(u32)(((u32)t__2e898 == (u32)((u64)18UL)));
+	t__2e880 = (u64)(u32)t__2e896;
+	goto L__2e882;
+	L__2e882:;
+	if ((u32)t__2e880) goto L_passed_2e879; else goto L_failed_2e878;
+	L_failed_2e878:;
+	t_abortsite_2e736 = ((u64)12UL);
+	goto L_abort_2e737;
+	L_passed_2e879:;
+	t_field_2e908 = (u64)((u64)((u64)((char *)&D_em__autofill)) + (u64)((u64)0UL));
+	t__2e909 = (u64)(u32)(*(u32 *)t_field_2e908);
+	t__2e907 = (u64)(u32)(((u32)t__2e909 == (u32)((u64)0UL)));
+	t__2e904 = (u64)(u32)t__2e907;
+	if ((u32)t__2e904) goto L__2e905; else goto L__2e906;
+	L__2e905:;
+	t_field_2e911 = (u64)((u64)((u64)((char *)&D_em__autofill)) + (u64)((u64)4UL));
+	t__2e912 = (u64)(u32)(*(u8 *)t_field_2e911);
+	t__2e913 = (u64)(u32)((u8)t__2e912);
+	t__2e914 = (u64)(u32)((u8)((u64)0UL));
+	t__2e910 = (u64)(u32)(((u32)t__2e913 == (u32)t__2e914));
+	t__2e904 = (u64)(u32)t__2e910;
+	goto L__2e906;
+	L__2e906:;
+	t__2e901 = (u64)(u32)t__2e904;
+	if ((u32)t__2e901) goto L__2e902; else goto L__2e903;
+	L__2e902:;
+	t_field_2e916 = (u64)((u64)((u64)((char *)&D_em__autofill)) + (u64)((u64)8UL));
+	t__2e917 = (u64)(u32)(*(i32 *)t_field_2e916);
+	t__2e915 = (u64)(u32)(((u32)t__2e917 == (u32)((u64)0UL)));
+	t__2e901 = (u64)(u32)t__2e915;
+	goto L__2e903;
+	L__2e903:;
+	if ((u32)t__2e901) goto L_passed_2e900; else goto L_failed_2e899;
+	L_failed_2e899:;
+	t_abortsite_2e736 = ((u64)13UL);
+	goto L_abort_2e737;
+	L_passed_2e900:;
+	t_field_2e929 = (u64)((u64)((u64)((char *)&D_em2)) + (u64)((u64)4UL));
+	t__2e930 = (u64)(u32)(*(u32 *)t_field_2e929);
+	t__2e926 = (u64)(u32)(((u32)t__2e930 == (u32)((u64)3UL)));
+	t__2e923 = (u64)(u32)t__2e926;
+	if ((u32)t__2e923) goto L__2e924; else goto L__2e925;
+	L__2e924:;
+	t_field_2e932 = (u64)((u64)((u64)((char *)&D_em2)) + (u64)((u64)8UL));
+	t__2e933 = (u64)(u32)(*(u8 *)t_field_2e932);
+	t__2e934 = (u64)(u32)((u8)t__2e933);
+	t__2e935 = (u64)(u32)((u8)((u64)4UL));
+	t__2e931 = (u64)(u32)(((u32)t__2e934 == (u32)t__2e935));
+	t__2e923 = (u64)(u32)t__2e931;
+	goto L__2e925;
+	L__2e925:;
+	t__2e920 = (u64)(u32)t__2e923;
+	if ((u32)t__2e920) goto L__2e921; else goto L__2e922;
+	L__2e921:;
+	t_field_2e937 = (u64)((u64)((u64)((char *)&D_em2)) + (u64)((u64)0UL));
+	t__2e938 = (u64)(u32)(*(i32 *)t_field_2e937);
+	t__2e936 = (u64)(u32)(((u32)t__2e938 == (u32)((u64)18UL)));
+	t__2e920 = (u64)(u32)t__2e936;
+	goto L__2e922;
+	L__2e922:;
+	if ((u32)t__2e920) goto L_passed_2e919; else goto L_failed_2e918;
+	L_failed_2e918:;
+	t_abortsite_2e736 = ((u64)14UL);
+	goto L_abort_2e737;
+	L_passed_2e919:;
+	t_field_2e948 = (u64)((u64)((u64)((char *)&D_em2__autofill)) + (u64)((u64)4UL));
+	t__2e949 = (u64)(u32)(*(u32 *)t_field_2e948);
+	t__2e947 = (u64)(u32)(((u32)t__2e949 == (u32)((u64)0UL)));
+	t__2e944 = (u64)(u32)t__2e947;
+	if ((u32)t__2e944) goto L__2e945; else goto L__2e946;
+	L__2e945:;
+	t_field_2e951 = (u64)((u64)((u64)((char *)&D_em2__autofill)) + (u64)((u64)8UL));
+	t__2e952 = (u64)(u32)(*(u8 *)t_field_2e951);
+	t__2e953 = (u64)(u32)((u8)t__2e952);
+	t__2e954 = (u64)(u32)((u8)((u64)0UL));
+	t__2e950 = (u64)(u32)(((u32)t__2e953 == (u32)t__2e954));
+	t__2e944 = (u64)(u32)t__2e950;
+	goto L__2e946;
+	L__2e946:;
+	t__2e941 = (u64)(u32)t__2e944;
+	if ((u32)t__2e941) goto L__2e942; else goto L__2e943;
+	L__2e942:;
+	t_field_2e956 = (u64)((u64)((u64)((char *)&D_em2__autofill)) + (u64)((u64)0UL));
+	t__2e957 = (u64)(u32)(*(i32 *)t_field_2e956);
+	t__2e955 = (u64)(u32)(((u32)t__2e957 == (u32)((u64)0UL)));
+	t__2e941 = (u64)(u32)t__2e955;
+	goto L__2e943;
+	L__2e943:;
+	if ((u32)t__2e941) goto L_passed_2e940; else goto L_failed_2e939;
+	L_failed_2e939:;
+	t_abortsite_2e736 = ((u64)15UL);
+	goto L_abort_2e737;
+	L_passed_2e940:;
+	t__2e961 = (u64)(*(u64 *)((u64)((char *)&D_big__value)));
+	t__2e960 = (u64)(u32)(((u64)t__2e961 == (u64)((u64)1311768467139281697UL)));
+	if ((u32)t__2e960) goto L_passed_2e959; else goto L_failed_2e958;
+	L_failed_2e958:;
+	t_abortsite_2e736 = ((u64)16UL);
+	goto L_abort_2e737;
+	L_passed_2e959:;
+	t__2e965 = (u64)(*(u32 *)((u64)((char *)&D_float)));
+	t__2e964 = (u64)(u32)((BF(t__2e965) == BF(((u64)1150964267UL))));
+	if ((u32)t__2e964) goto L_passed_2e963; else goto L_failed_2e962;
+	L_failed_2e962:;
+	t_abortsite_2e736 = ((u64)17UL);
+	goto L_abort_2e737;
+	L_passed_2e963:;
+	t__2e969 = (u64)(*(u64 *)((u64)((char *)&D_double)));
+	t__2e968 = (u64)(u32)((BD(t__2e969) == BD(((u64)4653144502051863213UL))));
+	if ((u32)t__2e968) goto L_passed_2e967; else goto L_failed_2e966;
+	L_failed_2e966:;
+	t_abortsite_2e736 = ((u64)18UL);
+	goto L_abort_2e737;
+	L_passed_2e967:;
+	goto L__2e730;
+	L__2e970:;
+	L__2e730:;
+	return;
+	L_abort_2e737:;
+	t__2e738 = (u64)((u64)t_abortsite_2e736 * (u64)((u64)16UL));
+	t__2e738 = (u64)((u64)((u64)((char *)&D_abortsites_2e735)) + (u64)t__2e738);
+	t__2e739 = (u64)(*(u64 *)t__2e738);
+	t__2e740 = (u64)((u64)t__2e738 + (u64)((u64)8UL));
+	t__2e741 = (u64)(*(u32 *)t__2e740);
+	t__2e740 = (u64)((u64)t__2e738 + (u64)((u64)12UL));
+	t__2e742 = (u64)(*(u32 *)t__2e740);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e739, (u64)t__2e741, (u64)t__2e742, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e789:;
+	t__2e790 = (u64)((u64)t_abortsite_2e736 * (u64)((u64)16UL));
+	t__2e790 = (u64)((u64)((u64)((char *)&D_abortsites_2e735)) + (u64)t__2e790);
+	t__2e791 = (u64)(*(u64 *)t__2e790);
+	t__2e792 = (u64)((u64)t__2e790 + (u64)((u64)8UL));
+	t__2e793 = (u64)(*(u32 *)t__2e792);
+	t__2e792 = (u64)((u64)t__2e790 + (u64)((u64)12UL));
+	t__2e794 = (u64)(*(u32 *)t__2e792);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e791, (u64)t__2e793, (u64)t__2e794, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_write(void) {
+	u64 t__2e1000;
+	u64 t__2e1001;
+	u64 t__2e1004;
+	u64 t__2e1005;
+	u64 t__2e1008;
+	u64 t__2e1011;
+	u64 t__2e1014;
+	u64 t__2e979;
+	u64 t__2e982;
+	u64 t__2e983;
+	u64 t__2e984;
+	u64 t__2e985;
+	u64 t__2e989;
+	u64 t__2e990;
+	u64 t__2e991;
+	u64 t__2e992;
+	u64 t__2e993;
+	u64 t__2e996;
+	u64 t__2e997;
+	u64 t_abortsite_2e987;
+	u64 t_field_2e1013;
+	L_start_2e973:;
+	L_body_2e974:;
+	t__2e983 = (u64)(u32)(*(i32 *)((u64)((char *)&D_x)));
+	t__2e982 = (u64)(u32)(((u32)t__2e983 == (u32)((u64)42UL)));
+	t__2e979 = (u64)(u32)t__2e982;
+	if ((u32)t__2e979) goto L__2e980; else goto L__2e981;
+	L__2e980:;
+	t__2e985 = (u64)(u32)(*(i32 *)((u64)((char *)&D_y)));
+	t__2e984 = (u64)(u32)(((u32)t__2e985 == (u32)((u64)69UL)));
+	t__2e979 = (u64)(u32)t__2e984;
+	goto L__2e981;
+	L__2e981:;
+	if ((u32)t__2e979) goto L_passed_2e978; else goto L_failed_2e977;
+	L_failed_2e977:;
+	t_abortsite_2e987 = ((u64)0UL);
+	goto L_abort_2e988;
+	L_passed_2e978:;
+	*(u32 *)((u64)((char *)&D_x)) = (u32)((u64)1337UL);
+	t__2e997 = (u64)(u32)(*(i32 *)((u64)((char *)&D_x)));
+	t__2e996 = (u64)(u32)(((u32)t__2e997 == (u32)((u64)1337UL)));
+	if ((u32)t__2e996) goto L_passed_2e995; else goto L_failed_2e994;
+	L_failed_2e994:;
+	t_abortsite_2e987 = ((u64)1UL);
+	goto L_abort_2e988;
+	L_passed_2e995:;
+	t__2e1001 = (u64)(*(u64 *)((u64)((char *)&D_nohint)));
+	t__2e1000 = (u64)(u32)(((u64)t__2e1001 == (u64)((u64)12UL)));
+	if ((u32)t__2e1000) goto L_passed_2e999; else goto L_failed_2e998;
+	L_failed_2e998:;
+	t_abortsite_2e987 = ((u64)2UL);
+	goto L_abort_2e988;
+	L_passed_2e999:;
+	t__2e1005 = (u64)(*(u64 *)((u64)((char *)&D_nohintconst)));
+	t__2e1004 = (u64)(u32)(((u64)t__2e1005 == (u64)((u64)123UL)));
+	if ((u32)t__2e1004) goto L_passed_2e1003; else goto L_failed_2e1002;
+	L_failed_2e1002:;
+	t_abortsite_2e987 = ((u64)3UL);
+	goto L_abort_2e988;
+	L_passed_2e1003:;
+	t__2e1008 = (u64)(u32)(((u64)((u64)1234UL) == (u64)((u64)1234UL)));
+	if ((u32)t__2e1008) goto L_passed_2e1007; else goto L_failed_2e1006;
+	L_failed_2e1006:;
+	t_abortsite_2e987 = ((u64)4UL);
+	goto L_abort_2e988;
+	L_passed_2e1007:;
+	t_field_2e1013 = (u64)((u64)((u64)((char *)&D_nhval)) + (u64)((u64)0UL));
+	t__2e1014 = (u64)(u32)(*(i32 *)t_field_2e1013);
+	t__2e1011 = (u64)(u32)(((u32)t__2e1014 == (u32)((u64)1UL)));
+	if ((u32)t__2e1011) goto L_passed_2e1010; else goto L_failed_2e1009;
+	L_failed_2e1009:;
+	t_abortsite_2e987 = ((u64)5UL);
+	goto L_abort_2e988;
+	L_passed_2e1010:;
+	goto L__2e975;
+	L__2e1015:;
+	L__2e975:;
+	return;
+	L_abort_2e988:;
+	t__2e989 = (u64)((u64)t_abortsite_2e987 * (u64)((u64)16UL));
+	t__2e989 = (u64)((u64)((u64)((char *)&D_abortsites_2e986)) + (u64)t__2e989);
+	t__2e990 = (u64)(*(u64 *)t__2e989);
+	t__2e991 = (u64)((u64)t__2e989 + (u64)((u64)8UL));
+	t__2e992 = (u64)(*(u32 *)t__2e991);
+	t__2e991 = (u64)((u64)t__2e989 + (u64)((u64)12UL));
+	t__2e993 = (u64)(*(u32 *)t__2e991);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e990, (u64)t__2e992, (u64)t__2e993, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,4997 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2eensure[] __asm__("rt.ensure");
+extern char X_rt_2efree[] __asm__("rt.free");
+extern char X_rt_2emalloc[] __asm__("rt.malloc");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+extern char X_rt_2ememmove[] __asm__("rt.memmove");
+extern char X_rt_2estrcmp[] __asm__("rt.strcmp");
+extern char X_rt_2eunensure[] __asm__("rt.unensure");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e16 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; };
+struct __attribute__((packed)) S_abortsites_2e384 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; };
+struct __attribute__((packed)) S_strdata_2e586 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e587 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e589 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e590 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e592 { u8 f0[1]; };
+struct __attribute__((packed)) S_strliteral_2e593 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1328 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4[37]; u8 f5; u8 f6; u8 f7; u8 f8[28]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[2]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; u8 f20[2]; };
+struct __attribute__((packed)) S_strliteral_2e1329 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1363 { u8 f0[66]; };
+struct __attribute__((packed)) S_strliteral_2e1364 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1383 { u8 f0[125]; };
+struct __attribute__((packed)) S_strliteral_2e1384 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1403 { u8 f0[87]; };
+struct __attribute__((packed)) S_strliteral_2e1404 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1423 { u8 f0[87]; };
+struct __attribute__((packed)) S_strliteral_2e1424 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1443 { u8 f0[90]; };
+struct __attribute__((packed)) S_strliteral_2e1444 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1463 { u8 f0[82]; };
+struct __attribute__((packed)) S_strliteral_2e1464 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1483 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e1484 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e619 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; char *f81; u32 f82; u32 f83; char *f84; u32 f85; u32 f86; char *f87; u32 f88; u32 f89; char *f90; u32 f91; u32 f92; char *f93; u32 f94; u32 f95; char *f96; u32 f97; u32 f98; char *f99; u32 f100; u32 f101; char *f102; u32 f103; u32 f104; char *f105; u32 f106; u32 f107; char *f108; u32 f109; u32 f110; char *f111; u32 f112; u32 f113; char *f114; u32 f115; u32 f116; char *f117; u32 f118; u32 f119; char *f120; u32 f121; u32 f122; char *f123; u32 f124; u32 f125; char *f126; u32 f127; u32 f128; char *f129; u32 f130; u32 f131; char *f132; u32 f133; u32 f134; char *f135; u32 f136; u32 f137; char *f138; u32 f139; u32 f140; char *f141; u32 f142; u32 f143; char *f144; u32 f145; u32 f146; char *f147; u32 f148; u32 f149; char *f150; u32 f151; u32 f152; char *f153; u32 f154; u32 f155; char *f156; u32 f157; u32 f158; char *f159; u32 f160; u32 f161; char *f162; u32 f163; u32 f164; char *f165; u32 f166; u32 f167; char *f168; u32 f169; u32 f170; char *f171; u32 f172; u32 f173; char *f174; u32 f175; u32 f176; char *f177; u32 f178; u32 f179; char *f180; u32 f181; u32 f182; char *f183; u32 f184; u32 f185; char *f186; u32 f187; u32 f188; char *f189; u32 f190; u32 f191; char *f192; u32 f193; u32 f194; char *f195; u32 f196; u32 f197; char *f198; u32 f199; u32 f200; char *f201; u32 f202; u32 f203; char *f204; u32 f205; u32 f206; };
+struct __attribute__((packed)) S_static_2e12 { u32 f0; };
+struct __attribute__((packed)) S_static_2e10 { u32 f0; };
+struct __attribute__((packed)) S_static_2e11 { u32 f0; };
+struct __attribute__((packed)) S_abortsites_2e1584 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_static_2e9 { u32 f0; };
+struct __attribute__((packed)) S_static_2e8 { u32 f0; };
+struct __attribute__((packed)) S_abortsites_2e1682 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_strdata_2e1812 { u8 f0[54]; };
+struct __attribute__((packed)) S_strliteral_2e1813 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1844 { u8 f0[49]; };
+struct __attribute__((packed)) S_strliteral_2e1845 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1864 { u8 f0[33]; };
+struct __attribute__((packed)) S_strliteral_2e1865 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1884 { u8 f0[38]; };
+struct __attribute__((packed)) S_strliteral_2e1885 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1904 { u8 f0[54]; };
+struct __attribute__((packed)) S_strliteral_2e1905 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1924 { u8 f0[59]; };
+struct __attribute__((packed)) S_strliteral_2e1925 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1944 { u8 f0[54]; };
+struct __attribute__((packed)) S_strliteral_2e1945 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1775 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; };
+struct __attribute__((packed)) S_abortsites_2e2002 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e2061 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e2100 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e2130 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e2159 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e2214 { u8 f0[59]; };
+struct __attribute__((packed)) S_strliteral_2e2215 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e2194 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e16 D_abortsites_2e16 __asm__("abortsites.16") __attribute__((used, section(".data.rel.ro.abortsites.16"), aligned(8)));
+static struct S_abortsites_2e384 D_abortsites_2e384 __asm__("abortsites.384") __attribute__((used, section(".data.rel.ro.abortsites.384"), aligned(8)));
+static const struct S_strdata_2e586 D_strdata_2e586 __asm__("strdata.586") __attribute__((used, section(".rodata.strdata.586"), aligned(8)));
+static struct S_strliteral_2e587 D_strliteral_2e587 __asm__("strliteral.587") __attribute__((used, section(".data.rel.ro.strliteral.587"), aligned(8)));
+static const struct S_strdata_2e589 D_strdata_2e589 __asm__("strdata.589") __attribute__((used, section(".rodata.strdata.589"), aligned(8)));
+static struct S_strliteral_2e590 D_strliteral_2e590 __asm__("strliteral.590") __attribute__((used, section(".data.rel.ro.strliteral.590"), aligned(8)));
+static const struct S_strdata_2e592 D_strdata_2e592 __asm__("strdata.592") __attribute__((used, section(".rodata.strdata.592"), aligned(8)));
+static struct S_strliteral_2e593 D_strliteral_2e593 __asm__("strliteral.593") __attribute__((used, section(".data.rel.ro.strliteral.593"), aligned(8)));
+static const struct S_strdata_2e1328 D_strdata_2e1328 __asm__("strdata.1328") __attribute__((used, section(".rodata.strdata.1328"), aligned(8)));
+static struct S_strliteral_2e1329 D_strliteral_2e1329 __asm__("strliteral.1329") __attribute__((used, section(".data.rel.ro.strliteral.1329"), aligned(8)));
+static const struct S_strdata_2e1363 D_strdata_2e1363 __asm__("strdata.1363") __attribute__((used, section(".rodata.strdata.1363"), aligned(8)));
+static struct S_strliteral_2e1364 D_strliteral_2e1364 __asm__("strliteral.1364") __attribute__((used, section(".data.rel.ro.strliteral.1364"), aligned(8)));
+static const struct S_strdata_2e1383 D_strdata_2e1383 __asm__("strdata.1383") __attribute__((used, section(".rodata.strdata.1383"), aligned(8)));
+static struct S_strliteral_2e1384 D_strliteral_2e1384 __asm__("strliteral.1384") __attribute__((used, section(".data.rel.ro.strliteral.1384"), aligned(8)));
+static const struct S_strdata_2e1403 D_strdata_2e1403 __asm__("strdata.1403") __attribute__((used, section(".rodata.strdata.1403"), aligned(8)));
+static struct S_strliteral_2e1404 D_strliteral_2e1404 __asm__("strliteral.1404") __attribute__((used, section(".data.rel.ro.strliteral.1404"), aligned(8)));
+static const struct S_strdata_2e1423 D_strdata_2e1423 __asm__("strdata.1423") __attribute__((used, section(".rodata.strdata.1423"), aligned(8)));
+static struct S_strliteral_2e1424 D_strliteral_2e1424 __asm__("strliteral.1424") __attribute__((used, section(".data.rel.ro.strliteral.1424"), aligned(8)));
+static const struct S_strdata_2e1443 D_strdata_2e1443 __asm__("strdata.1443") __attribute__((used, section(".rodata.strdata.1443"), aligned(8)));
+static struct S_strliteral_2e1444 D_strliteral_2e1444 __asm__("strliteral.1444") __attribute__((used, section(".data.rel.ro.strliteral.1444"), aligned(8)));
+static const struct S_strdata_2e1463 D_strdata_2e1463 __asm__("strdata.1463") __attribute__((used, section(".rodata.strdata.1463"), aligned(8)));
+static struct S_strliteral_2e1464 D_strliteral_2e1464 __asm__("strliteral.1464") __attribute__((used, section(".data.rel.ro.strliteral.1464"), aligned(8)));
+static const struct S_strdata_2e1483 D_strdata_2e1483 __asm__("strdata.1483") __attribute__((used, section(".rodata.strdata.1483"), aligned(8)));
+static struct S_strliteral_2e1484 D_strliteral_2e1484 __asm__("strliteral.1484") __attribute__((used, section(".data.rel.ro.strliteral.1484"), aligned(8)));
+static struct S_abortsites_2e619 D_abortsites_2e619 __asm__("abortsites.619") __attribute__((used, section(".data.rel.ro.abortsites.619"), aligned(8)));
+static struct S_static_2e12 D_static_2e12 __asm__("static.12") __attribute__((used, section(".bss.static.12"), aligned(8)));
+static struct S_static_2e10 D_static_2e10 __asm__("static.10") __attribute__((used, section(".bss.static.10"), aligned(8)));
+static struct S_static_2e11 D_static_2e11 __asm__("static.11") __attribute__((used, section(".bss.static.11"), aligned(8)));
+static struct S_abortsites_2e1584 D_abortsites_2e1584 __asm__("abortsites.1584") __attribute__((used, section(".data.rel.ro.abortsites.1584"), aligned(8)));
+static struct S_static_2e9 D_static_2e9 __asm__("static.9") __attribute__((used, section(".bss.static.9"), aligned(8)));
+static struct S_static_2e8 D_static_2e8 __asm__("static.8") __attribute__((used, section(".bss.static.8"), aligned(8)));
+static struct S_abortsites_2e1682 D_abortsites_2e1682 __asm__("abortsites.1682") __attribute__((used, section(".data.rel.ro.abortsites.1682"), aligned(8)));
+static const struct S_strdata_2e1812 D_strdata_2e1812 __asm__("strdata.1812") __attribute__((used, section(".rodata.strdata.1812"), aligned(8)));
+static struct S_strliteral_2e1813 D_strliteral_2e1813 __asm__("strliteral.1813") __attribute__((used, section(".data.rel.ro.strliteral.1813"), aligned(8)));
+static const struct S_strdata_2e1844 D_strdata_2e1844 __asm__("strdata.1844") __attribute__((used, section(".rodata.strdata.1844"), aligned(8)));
+static struct S_strliteral_2e1845 D_strliteral_2e1845 __asm__("strliteral.1845") __attribute__((used, section(".data.rel.ro.strliteral.1845"), aligned(8)));
+static const struct S_strdata_2e1864 D_strdata_2e1864 __asm__("strdata.1864") __attribute__((used, section(".rodata.strdata.1864"), aligned(8)));
+static struct S_strliteral_2e1865 D_strliteral_2e1865 __asm__("strliteral.1865") __attribute__((used, section(".data.rel.ro.strliteral.1865"), aligned(8)));
+static const struct S_strdata_2e1884 D_strdata_2e1884 __asm__("strdata.1884") __attribute__((used, section(".rodata.strdata.1884"), aligned(8)));
+static struct S_strliteral_2e1885 D_strliteral_2e1885 __asm__("strliteral.1885") __attribute__((used, section(".data.rel.ro.strliteral.1885"), aligned(8)));
+static const struct S_strdata_2e1904 D_strdata_2e1904 __asm__("strdata.1904") __attribute__((used, section(".rodata.strdata.1904"), aligned(8)));
+static struct S_strliteral_2e1905 D_strliteral_2e1905 __asm__("strliteral.1905") __attribute__((used, section(".data.rel.ro.strliteral.1905"), aligned(8)));
+static const struct S_strdata_2e1924 D_strdata_2e1924 __asm__("strdata.1924") __attribute__((used, section(".rodata.strdata.1924"), aligned(8)));
+static struct S_strliteral_2e1925 D_strliteral_2e1925 __asm__("strliteral.1925") __attribute__((used, section(".data.rel.ro.strliteral.1925"), aligned(8)));
+static const struct S_strdata_2e1944 D_strdata_2e1944 __asm__("strdata.1944") __attribute__((used, section(".rodata.strdata.1944"), aligned(8)));
+static struct S_strliteral_2e1945 D_strliteral_2e1945 __asm__("strliteral.1945") __attribute__((used, section(".data.rel.ro.strliteral.1945"), aligned(8)));
+static struct S_abortsites_2e1775 D_abortsites_2e1775 __asm__("abortsites.1775") __attribute__((used, section(".data.rel.ro.abortsites.1775"), aligned(8)));
+static struct S_abortsites_2e2002 D_abortsites_2e2002 __asm__("abortsites.2002") __attribute__((used, section(".data.rel.ro.abortsites.2002"), aligned(8)));
+static struct S_abortsites_2e2061 D_abortsites_2e2061 __asm__("abortsites.2061") __attribute__((used, section(".data.rel.ro.abortsites.2061"), aligned(8)));
+static struct S_abortsites_2e2100 D_abortsites_2e2100 __asm__("abortsites.2100") __attribute__((used, section(".data.rel.ro.abortsites.2100"), aligned(8)));
+static struct S_abortsites_2e2130 D_abortsites_2e2130 __asm__("abortsites.2130") __attribute__((used, section(".data.rel.ro.abortsites.2130"), aligned(8)));
+static struct S_abortsites_2e2159 D_abortsites_2e2159 __asm__("abortsites.2159") __attribute__((used, section(".data.rel.ro.abortsites.2159"), aligned(8)));
+static const struct S_strdata_2e2214 D_strdata_2e2214 __asm__("strdata.2214") __attribute__((used, section(".rodata.strdata.2214"), aligned(8)));
+static struct S_strliteral_2e2215 D_strliteral_2e2215 __asm__("strliteral.2215") __attribute__((used, section(".data.rel.ro.strliteral.2215"), aligned(8)));
+static struct S_abortsites_2e2194 D_abortsites_2e2194 __asm__("abortsites.2194") __attribute__((used, section(".data.rel.ro.abortsites.2194"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_indexing(void) __asm__("indexing") __attribute__((used, section(".text.indexing")));
+static void F_for__each__aggregate(void) __asm__("for_each_aggregate") __attribute__((used, section(".text.for_each_aggregate")));
+static void F_for__each(void) __asm__("for_each") __attribute__((used, section(".text.for_each")));
+static u64 F_foreach__large(u64 __rp) __asm__("foreach_large") __attribute__((used, section(".text.foreach_large")));
+static u64 F_foreach__next__void(u64 __rp) __asm__("foreach_next_void") __attribute__((used, section(".text.foreach_next_void")));
+static u64 F_foreach__tuple(u64 __rp) __asm__("foreach_tuple") __attribute__((used, section(".text.foreach_tuple")));
+static u64 F_foreach__next__alias(u64 __rp) __asm__("foreach_next_alias") __attribute__((used, section(".text.foreach_next_alias")));
+static u64 F_foreach__next(u64 __rp) __asm__("foreach_next") __attribute__((used, section(".text.foreach_next")));
+static void F_result(void) __asm__("result") __attribute__((used, section(".text.result")));
+static void F_alias(void) __asm__("alias") __attribute__((used, section(".text.alias")));
+static void F_label(void) __asm__("label") __attribute__((used, section(".text.label")));
+static void F___continue(void) __asm__("_continue") __attribute__((used, section(".text._continue")));
+static void F___break(void) __asm__("_break") __attribute__((used, section(".text._break")));
+static void F_binding(void) __asm__("binding") __attribute__((used, section(".text.binding")));
+static void F_afterthought(void) __asm__("afterthought") __attribute__((used, section(".text.afterthought")));
+static void F_conditional(void) __asm__("conditional") __attribute__((used, section(".text.conditional")));
+static void F_scope(void) __asm__("scope") __attribute__((used, section(".text.scope")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\061\062\055\154\157\157\160\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 17U, 17U };
+static struct S_abortsites_2e16 D_abortsites_2e16 = { (char *)((char *)&D_strliteral_2e1) + 0, 440U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 446U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 453U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 454U, 41U, (char *)((char *)&D_strliteral_2e1) + 0, 457U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 461U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 462U, 25U, (char *)((char *)&D_strliteral_2e1) + 0, 466U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 466U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 466U, 58U, (char *)((char *)&D_strliteral_2e1) + 0, 466U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 472U, 18U, (char *)((char *)&D_strliteral_2e1) + 0, 472U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 474U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 474U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 474U, 43U, (char *)((char *)&D_strliteral_2e1) + 0, 474U, 15U };
+static struct S_abortsites_2e384 D_abortsites_2e384 = { (char *)((char *)&D_strliteral_2e1) + 0, 408U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 413U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 415U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 420U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 421U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 424U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 428U, 37U, (char *)((char *)&D_strliteral_2e1) + 0, 428U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 436U, 15U };
+static const struct S_strdata_2e586 D_strdata_2e586 = { "\110\145\154\154\157" };
+static struct S_strliteral_2e587 D_strliteral_2e587 = { (char *)((char *)&D_strdata_2e586) + 0, 5U, 5U };
+static const struct S_strdata_2e589 D_strdata_2e589 = { "\127\157\162\154\144" };
+static struct S_strliteral_2e590 D_strliteral_2e590 = { (char *)((char *)&D_strdata_2e589) + 0, 5U, 5U };
+static const struct S_strdata_2e592 D_strdata_2e592 = { "\041" };
+static struct S_strliteral_2e593 D_strliteral_2e593 = { (char *)((char *)&D_strdata_2e592) + 0, 1U, 1U };
+static const struct S_strdata_2e1328 D_strdata_2e1328 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, "\154\145\164\040\160\141\151\162\163\040\075\040\133\050\061\054\040\062\051\054\040\050\063\054\040\064\051\054\040\050\065\054\040\066\051\135\073", 10U, 9U, 9U, "\146\157\162\040\050\154\145\164\040\050\170\054\040\171\051\040\046\056\056\040\160\141\151\162\163\051\040\173", 10U, 9U, 9U, 9U, "\170\073", 10U, 9U, 9U, "\175\073", 10U, 9U, "\175\073" };
+static struct S_strliteral_2e1329 D_strliteral_2e1329 = { (char *)((char *)&D_strdata_2e1328) + 0, 104U, 104U };
+static const struct S_strdata_2e1363 D_strdata_2e1363 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\146\157\162\040\050\163\164\141\164\151\143\040\154\145\164\040\151\040\075\040\060\073\040\151\040\074\040\064\073\040\151\040\053\075\040\061\051\040\173\040\151\073\040\175\040\175\073" };
+static struct S_strliteral_2e1364 D_strliteral_2e1364 = { (char *)((char *)&D_strdata_2e1363) + 0, 66U, 66U };
+static const struct S_strdata_2e1383 D_strdata_2e1383 = { "\164\171\160\145\040\144\157\156\145\137\141\154\151\141\163\040\075\040\144\157\156\145\073\040\146\156\040\156\145\170\164\050\051\040\050\151\156\164\040\174\040\144\157\156\145\137\141\154\151\141\163\040\174\040\163\164\162\040\174\040\144\157\156\145\051\040\075\040\144\157\156\145\073\040\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\146\157\162\040\050\154\145\164\040\170\040\075\076\040\156\145\170\164\050\051\051\040\173\040\170\073\040\175\073\040\175\073" };
+static struct S_strliteral_2e1384 D_strliteral_2e1384 = { (char *)((char *)&D_strdata_2e1383) + 0, 125U, 125U };
+static const struct S_strdata_2e1403 D_strdata_2e1403 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\154\151\143\145\072\040\133\135\151\156\164\040\075\040\133\135\073\040\146\157\162\040\050\154\145\164\040\170\040\056\056\040\163\154\151\143\145\051\040\173\040\144\145\154\145\164\145\050\163\154\151\143\145\133\060\135\051\073\040\175\073\175\073" };
+static struct S_strliteral_2e1404 D_strliteral_2e1404 = { (char *)((char *)&D_strdata_2e1403) + 0, 87U, 87U };
+static const struct S_strdata_2e1423 D_strdata_2e1423 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\154\151\143\145\072\040\133\135\151\156\164\040\075\040\133\135\073\040\146\157\162\040\050\154\145\164\040\170\040\056\056\040\163\154\151\143\145\051\040\173\040\141\160\160\145\156\144\050\163\154\151\143\145\054\040\061\051\073\040\175\073\175\073" };
+static struct S_strliteral_2e1424 D_strliteral_2e1424 = { (char *)((char *)&D_strdata_2e1423) + 0, 87U, 87U };
+static const struct S_strdata_2e1443 D_strdata_2e1443 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\154\151\143\145\072\040\133\135\151\156\164\040\075\040\133\135\073\040\146\157\162\040\050\154\145\164\040\170\040\056\056\040\163\154\151\143\145\051\040\173\040\151\156\163\145\162\164\050\163\154\151\143\145\133\060\135\054\040\061\051\073\040\175\073\175\073" };
+static struct S_strliteral_2e1444 D_strliteral_2e1444 = { (char *)((char *)&D_strdata_2e1443) + 0, 90U, 90U };
+static const struct S_strdata_2e1463 D_strdata_2e1463 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\163\154\151\143\145\072\040\133\135\151\156\164\040\075\040\133\135\073\040\146\157\162\040\050\154\145\164\040\170\040\056\056\040\163\154\151\143\145\051\040\173\040\146\162\145\145\050\163\154\151\143\145\051\073\040\175\073\175\073" };
+static struct S_strliteral_2e1464 D_strliteral_2e1464 = { (char *)((char *)&D_strdata_2e1463) + 0, 82U, 82U };
+static const struct S_strdata_2e1483 D_strdata_2e1483 = { "\164\171\160\145\040\144\040\075\040\041\144\157\156\145\073" };
+static struct S_strliteral_2e1484 D_strliteral_2e1484 = { (char *)((char *)&D_strdata_2e1483) + 0, 15U, 15U };
+static struct S_abortsites_2e619 D_abortsites_2e619 = { (char *)((char *)&D_strliteral_2e1) + 0, 199U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 205U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 209U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 212U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 216U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 219U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 223U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 226U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 230U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 233U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 237U, 39U, (char *)((char *)&D_strliteral_2e1) + 0, 237U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 238U, 38U, (char *)((char *)&D_strliteral_2e1) + 0, 238U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 241U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 245U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 248U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 252U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 255U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 259U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 262U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 266U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 269U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 273U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 276U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 280U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 283U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 287U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 290U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 294U, 39U, (char *)((char *)&D_strliteral_2e1) + 0, 294U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 295U, 38U, (char *)((char *)&D_strliteral_2e1) + 0, 295U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 298U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 302U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 305U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 314U, 31U, (char *)((char *)&D_strliteral_2e1) + 0, 318U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 324U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 327U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 331U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 334U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 340U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 343U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 347U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 350U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 356U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 359U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 363U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 366U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 370U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 373U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 379U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 387U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 387U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 389U, 102U, (char *)((char *)&D_strliteral_2e1) + 0, 389U, 102U, (char *)((char *)&D_strliteral_2e1) + 0, 390U, 161U, (char *)((char *)&D_strliteral_2e1) + 0, 390U, 161U, (char *)((char *)&D_strliteral_2e1) + 0, 391U, 123U, (char *)((char *)&D_strliteral_2e1) + 0, 391U, 123U, (char *)((char *)&D_strliteral_2e1) + 0, 392U, 123U, (char *)((char *)&D_strliteral_2e1) + 0, 392U, 123U, (char *)((char *)&D_strliteral_2e1) + 0, 393U, 126U, (char *)((char *)&D_strliteral_2e1) + 0, 393U, 126U, (char *)((char *)&D_strliteral_2e1) + 0, 394U, 118U, (char *)((char *)&D_strliteral_2e1) + 0, 394U, 118U, (char *)((char *)&D_strliteral_2e1) + 0, 395U, 51U, (char *)((char *)&D_strliteral_2e1) + 0, 395U, 51U };
+static struct S_static_2e12 D_static_2e12 = { 0U };
+static struct S_static_2e10 D_static_2e10 = { 0U };
+static struct S_static_2e11 D_static_2e11 = { 0U };
+static struct S_abortsites_2e1584 D_abortsites_2e1584 = { (char *)((char *)&D_strliteral_2e1) + 0, 166U, 29U };
+static struct S_static_2e9 D_static_2e9 = { 0U };
+static struct S_static_2e8 D_static_2e8 = { 0U };
+static struct S_abortsites_2e1682 D_abortsites_2e1682 = { (char *)((char *)&D_strliteral_2e1) + 0, 122U, 29U, (char *)((char *)&D_strliteral_2e1) + 0, 126U, 15U };
+static const struct S_strdata_2e1812 D_strdata_2e1812 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\146\157\162\040\072\146\157\157\040\050\164\162\165\145\051\040\173\040\142\162\145\141\153\040\072\142\141\162\073\040\175\073\040\175\073" };
+static struct S_strliteral_2e1813 D_strliteral_2e1813 = { (char *)((char *)&D_strdata_2e1812) + 0, 54U, 54U };
+static const struct S_strdata_2e1844 D_strdata_2e1844 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\146\157\162\040\050\164\162\165\145\051\040\173\040\142\162\145\141\153\040\072\142\141\162\073\040\175\073\040\175\073" };
+static struct S_strliteral_2e1845 D_strliteral_2e1845 = { (char *)((char *)&D_strdata_2e1844) + 0, 49U, 49U };
+static const struct S_strdata_2e1864 D_strdata_2e1864 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\142\162\145\141\153\040\072\142\141\162\073\040\175\073" };
+static struct S_strliteral_2e1865 D_strliteral_2e1865 = { (char *)((char *)&D_strdata_2e1864) + 0, 33U, 33U };
+static const struct S_strdata_2e1884 D_strdata_2e1884 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\072\146\157\157\040\173\040\142\162\145\141\153\040\072\146\157\157\073\040\175\073" };
+static struct S_strliteral_2e1885 D_strliteral_2e1885 = { (char *)((char *)&D_strdata_2e1884) + 0, 38U, 38U };
+static const struct S_strdata_2e1904 D_strdata_2e1904 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\146\157\162\040\072\146\157\157\040\050\164\162\165\145\051\040\173\040\171\151\145\154\144\040\072\146\157\157\073\040\175\073\040\175\073" };
+static struct S_strliteral_2e1905 D_strliteral_2e1905 = { (char *)((char *)&D_strdata_2e1904) + 0, 54U, 54U };
+static const struct S_strdata_2e1924 D_strdata_2e1924 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\072\146\157\157\040\173\040\146\157\162\040\072\146\157\157\040\050\164\162\165\145\051\040\173\040\171\151\145\154\144\040\072\146\157\157\073\040\175\073\040\175\073" };
+static struct S_strliteral_2e1925 D_strliteral_2e1925 = { (char *)((char *)&D_strdata_2e1924) + 0, 59U, 59U };
+static const struct S_strdata_2e1944 D_strdata_2e1944 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\146\157\162\040\072\146\157\157\040\050\164\162\165\145\051\040\072\146\157\157\040\173\040\142\162\145\141\153\040\072\146\157\157\073\040\175\073" };
+static struct S_strliteral_2e1945 D_strliteral_2e1945 = { (char *)((char *)&D_strdata_2e1944) + 0, 54U, 54U };
+static struct S_abortsites_2e1775 D_abortsites_2e1775 = { (char *)((char *)&D_strliteral_2e1) + 0, 90U, 47U, (char *)((char *)&D_strliteral_2e1) + 0, 93U, 31U, (char *)((char *)&D_strliteral_2e1) + 0, 99U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 90U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 90U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 85U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 85U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 69U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 69U, (char *)((char *)&D_strliteral_2e1) + 0, 103U, 74U, (char *)((char *)&D_strliteral_2e1) + 0, 103U, 74U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 90U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 90U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 95U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 95U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 90U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 90U };
+static struct S_abortsites_2e2002 D_abortsites_2e2002 = { (char *)((char *)&D_strliteral_2e1) + 0, 72U, 31U, (char *)((char *)&D_strliteral_2e1) + 0, 77U, 15U };
+static struct S_abortsites_2e2061 D_abortsites_2e2061 = { (char *)((char *)&D_strliteral_2e1) + 0, 58U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 61U, 15U };
+static struct S_abortsites_2e2100 D_abortsites_2e2100 = { (char *)((char *)&D_strliteral_2e1) + 0, 45U, 15U };
+static struct S_abortsites_2e2130 D_abortsites_2e2130 = { (char *)((char *)&D_strliteral_2e1) + 0, 36U, 15U };
+static struct S_abortsites_2e2159 D_abortsites_2e2159 = { (char *)((char *)&D_strliteral_2e1) + 0, 28U, 15U };
+static const struct S_strdata_2e2214 D_strdata_2e2214 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\146\157\162\040\050\164\162\165\145\051\040\173\040\154\145\164\040\170\040\075\040\061\060\073\040\142\162\145\141\153\073\040\175\073\040\170\073\040\175\073" };
+static struct S_strliteral_2e2215 D_strliteral_2e2215 = { (char *)((char *)&D_strdata_2e2214) + 0, 59U, 59U };
+static struct S_abortsites_2e2194 D_abortsites_2e2194 = { (char *)((char *)&D_strliteral_2e1) + 0, 13U, 31U, (char *)((char *)&D_strliteral_2e1) + 0, 14U, 31U, (char *)((char *)&D_strliteral_2e1) + 0, 18U, 95U, (char *)((char *)&D_strliteral_2e1) + 0, 18U, 95U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_scope)))();
+	((void (*)(void))((u64)((char *)&F_conditional)))();
+	((void (*)(void))((u64)((char *)&F_afterthought)))();
+	((void (*)(void))((u64)((char *)&F_binding)))();
+	((void (*)(void))((u64)((char *)&F___break)))();
+	((void (*)(void))((u64)((char *)&F___continue)))();
+	((void (*)(void))((u64)((char *)&F_label)))();
+	((void (*)(void))((u64)((char *)&F_alias)))();
+	((void (*)(void))((u64)((char *)&F_result)))();
+	((void (*)(void))((u64)((char *)&F_for__each)))();
+	((void (*)(void))((u64)((char *)&F_for__each__aggregate)))();
+	((void (*)(void))((u64)((char *)&F_indexing)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_indexing(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[1] __attribute__((aligned(16)));
+	char A5[1] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	u64 t__2e106;
+	u64 t__2e109;
+	u64 t__2e110;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e113;
+	u64 t__2e114;
+	u64 t__2e118;
+	u64 t__2e119;
+	u64 t__2e12;
+	u64 t__2e120;
+	u64 t__2e121;
+	u64 t__2e122;
+	u64 t__2e124;
+	u64 t__2e125;
+	u64 t__2e126;
+	u64 t__2e129;
+	u64 t__2e13;
+	u64 t__2e130;
+	u64 t__2e132;
+	u64 t__2e135;
+	u64 t__2e138;
+	u64 t__2e141;
+	u64 t__2e142;
+	u64 t__2e143;
+	u64 t__2e144;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e147;
+	u64 t__2e148;
+	u64 t__2e149;
+	u64 t__2e150;
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e154;
+	u64 t__2e155;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e167;
+	u64 t__2e168;
+	u64 t__2e169;
+	u64 t__2e176;
+	u64 t__2e177;
+	u64 t__2e178;
+	u64 t__2e179;
+	u64 t__2e180;
+	u64 t__2e181;
+	u64 t__2e182;
+	u64 t__2e183;
+	u64 t__2e184;
+	u64 t__2e187;
+	u64 t__2e188;
+	u64 t__2e189;
+	u64 t__2e19;
+	u64 t__2e190;
+	u64 t__2e193;
+	u64 t__2e194;
+	u64 t__2e195;
+	u64 t__2e196;
+	u64 t__2e197;
+	u64 t__2e198;
+	u64 t__2e199;
+	u64 t__2e20;
+	u64 t__2e202;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e205;
+	u64 t__2e206;
+	u64 t__2e209;
+	u64 t__2e21;
+	u64 t__2e212;
+	u64 t__2e215;
+	u64 t__2e218;
+	u64 t__2e22;
+	u64 t__2e221;
+	u64 t__2e222;
+	u64 t__2e223;
+	u64 t__2e224;
+	u64 t__2e225;
+	u64 t__2e226;
+	u64 t__2e227;
+	u64 t__2e228;
+	u64 t__2e229;
+	u64 t__2e23;
+	u64 t__2e230;
+	u64 t__2e231;
+	u64 t__2e232;
+	u64 t__2e235;
+	u64 t__2e236;
+	u64 t__2e237;
+	u64 t__2e238;
+	u64 t__2e239;
+	u64 t__2e240;
+	u64 t__2e241;
+	u64 t__2e242;
+	u64 t__2e243;
+	u64 t__2e246;
+	u64 t__2e247;
+	u64 t__2e248;
+	u64 t__2e249;
+	u64 t__2e250;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e253;
+	u64 t__2e254;
+	u64 t__2e257;
+	u64 t__2e26;
+	u64 t__2e265;
+	u64 t__2e266;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e269;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e275;
+	u64 t__2e276;
+	u64 t__2e277;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t__2e280;
+	u64 t__2e283;
+	u64 t__2e284;
+	u64 t__2e285;
+	u64 t__2e286;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e289;
+	u64 t__2e290;
+	u64 t__2e293;
+	u64 t__2e295;
+	u64 t__2e298;
+	u64 t__2e301;
+	u64 t__2e304;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t__2e311;
+	u64 t__2e314;
+	u64 t__2e315;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e318;
+	u64 t__2e319;
+	u64 t__2e320;
+	u64 t__2e321;
+	u64 t__2e322;
+	u64 t__2e325;
+	u64 t__2e326;
+	u64 t__2e327;
+	u64 t__2e328;
+	u64 t__2e329;
+	u64 t__2e330;
+	u64 t__2e331;
+	u64 t__2e332;
+	u64 t__2e333;
+	u64 t__2e336;
+	u64 t__2e34;
+	u64 t__2e340;
+	u64 t__2e342;
+	u64 t__2e344;
+	u64 t__2e35;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e39;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e44;
+	u64 t__2e45;
+	u64 t__2e46;
+	u64 t__2e47;
+	u64 t__2e48;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e54;
+	u64 t__2e55;
+	u64 t__2e57;
+	u64 t__2e60;
+	u64 t__2e61;
+	u64 t__2e63;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e66;
+	u64 t__2e67;
+	u64 t__2e81;
+	u64 t__2e82;
+	u64 t__2e83;
+	u64 t__2e84;
+	u64 t__2e87;
+	u64 t__2e88;
+	u64 t__2e89;
+	u64 t__2e90;
+	u64 t__2e91;
+	u64 t__2e93;
+	u64 t__2e96;
+	u64 t__2e97;
+	u64 t__2e98;
+	u64 t__2e99;
+	u64 t_abortsite_2e17;
+	u64 t_binding_2e105;
+	u64 t_binding_2e11;
+	u64 t_binding_2e164;
+	u64 t_binding_2e258;
+	u64 t_binding_2e259;
+	u64 t_binding_2e27;
+	u64 t_binding_2e33;
+	u64 t_binding_2e71;
+	u64 t_binding_2e74;
+	u64 t_binding_2e80;
+	u64 t_cleanup_2e68;
+	u64 t_item_2e25;
+	u64 t_item_2e73;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	t_binding_2e27 = (u64)A1;
+	t_binding_2e33 = (u64)A2;
+	t_binding_2e71 = (u64)A3;
+	t_binding_2e74 = (u64)A4;
+	t_binding_2e80 = (u64)A5;
+	t_binding_2e105 = (u64)A6;
+	t_binding_2e164 = (u64)A7;
+	t_binding_2e258 = (u64)A8;
+	t_binding_2e259 = (u64)A9;
+	L_body_2e8:;
+	t__2e12 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)20UL)));
+	t__2e13 = (u64)(u32)(((u64)t__2e12 != (u64)((u64)0UL)));
+	if ((u32)t__2e13) goto L__2e15; else goto L__2e14;
+	L__2e14:;
+	t_abortsite_2e17 = ((u64)0UL);
+	goto L_abort_2e18;
+	L__2e15:;
+	t_item_2e25 = (u64)((u64)t__2e12 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e25 = (u32)((u64)1UL);
+	t_item_2e25 = (u64)((u64)t__2e12 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e25 = (u32)((u64)2UL);
+	t_item_2e25 = (u64)((u64)t__2e12 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e25 = (u32)((u64)3UL);
+	t_item_2e25 = (u64)((u64)t__2e12 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e25 = (u32)((u64)4UL);
+	t_item_2e25 = (u64)((u64)t__2e12 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e25 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e11 = (u64)t__2e12;
+	t__2e26 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	*(u64 *)t__2e26 = (u64)((u64)5UL);
+	t__2e26 = (u64)((u64)t__2e26 + (u64)((u64)8UL));
+	*(u64 *)t__2e26 = (u64)((u64)5UL);
+	*(u32 *)t_binding_2e27 = (u32)((u64)0UL);
+	*(u64 *)t_binding_2e33 = (u64)((u64)0UL);
+	L_loop_2e28:;
+	t__2e35 = (u64)(*(u64 *)t_binding_2e33);
+	t__2e37 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e38 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e39 = (u64)(*(u64 *)t__2e37);
+	t__2e34 = (u64)(u32)(((u64)t__2e35 < (u64)t__2e39));
+	if ((u32)t__2e34) goto L_body_2e29; else goto L__2e31;
+	L_body_2e29:;
+	t__2e42 = (u64)(u32)(*(i32 *)t_binding_2e27);
+	t__2e45 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e46 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e47 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e48 = (u64)(*(u64 *)t_binding_2e33);
+	t__2e44 = (u64)((u64)t__2e48 * (u64)((u64)4UL));
+	t__2e44 = (u64)((u64)t__2e47 + (u64)t__2e44);
+	t__2e49 = (u64)(u32)(*(i32 *)t__2e44);
+	t__2e51 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e52 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e53 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e54 = (u64)(*(u64 *)t_binding_2e33);
+	t__2e50 = (u64)((u64)t__2e54 * (u64)((u64)4UL));
+	t__2e50 = (u64)((u64)t__2e53 + (u64)t__2e50);
+	t__2e55 = (u64)(u32)(*(i32 *)t__2e50);
+	t__2e43 = (u64)(u32)((u32)t__2e49 * (u32)t__2e55);
+	t__2e42 = (u64)(u32)((u32)t__2e42 + (u32)t__2e43);
+	*(u32 *)t_binding_2e27 = (u32)t__2e42;
+	goto L__2e40;
+	L__2e56:;
+	L__2e40:;
+	L_after_2e32:;
+	t__2e57 = (u64)(*(u64 *)t_binding_2e33);
+	t__2e57 = (u64)((u64)t__2e57 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e33 = (u64)t__2e57;
+	goto L_loop_2e28;
+	L__2e31:;
+	t__2e61 = (u64)(u32)(*(i32 *)t_binding_2e27);
+	t__2e60 = (u64)(u32)(((u32)t__2e61 == (u32)((u64)55UL)));
+	if ((u32)t__2e60) goto L_passed_2e59; else goto L_failed_2e58;
+	L_failed_2e58:;
+	t_abortsite_2e17 = ((u64)1UL);
+	goto L_abort_2e62;
+	L_passed_2e59:;
+	t_item_2e73 = (u64)((u64)t_binding_2e71 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e73 = (u8)((u64)1UL);
+	t_item_2e73 = (u64)((u64)t_binding_2e71 + (u64)((u64)1UL));
+	*(u8 *)t_item_2e73 = (u8)((u64)2UL);
+	t_item_2e73 = (u64)((u64)t_binding_2e71 + (u64)((u64)2UL));
+	*(u8 *)t_item_2e73 = (u8)((u64)3UL);
+	t_item_2e73 = (u64)((u64)t_binding_2e71 + (u64)((u64)3UL));
+	*(u8 *)t_item_2e73 = (u8)((u64)4UL);
+	*(u8 *)t_binding_2e74 = (u8)((u64)0UL);
+	*(u8 *)t_binding_2e80 = (u8)((u64)0UL);
+	L_loop_2e75:;
+	t__2e82 = (u64)(u32)(*(u8 *)t_binding_2e80);
+	t__2e83 = (u64)(u32)((u8)t__2e82);
+	t__2e84 = (u64)(u32)((u8)((u64)4UL));
+	t__2e81 = (u64)(u32)(((u32)t__2e83 < (u32)t__2e84));
+	if ((u32)t__2e81) goto L_body_2e76; else goto L__2e78;
+	L_body_2e76:;
+	t__2e87 = (u64)(u32)(*(u8 *)t_binding_2e74);
+	t__2e89 = (u64)(u32)(*(u8 *)t_binding_2e80);
+	t__2e90 = (u64)((u8)t__2e89);
+	t__2e88 = (u64)((u64)t__2e90 * (u64)((u64)1UL));
+	t__2e88 = (u64)((u64)t_binding_2e71 + (u64)t__2e88);
+	t__2e91 = (u64)(u32)(*(u8 *)t__2e88);
+	t__2e87 = (u64)(u32)((u32)t__2e87 + (u32)t__2e91);
+	*(u8 *)t_binding_2e74 = (u8)t__2e87;
+	goto L__2e85;
+	L__2e92:;
+	L__2e85:;
+	L_after_2e79:;
+	t__2e93 = (u64)(u32)(*(u8 *)t_binding_2e80);
+	t__2e93 = (u64)(u32)((u32)t__2e93 + (u32)((u64)1UL));
+	*(u8 *)t_binding_2e80 = (u8)t__2e93;
+	goto L_loop_2e75;
+	L__2e78:;
+	t__2e97 = (u64)(u32)(*(u8 *)t_binding_2e74);
+	t__2e98 = (u64)(u32)((u8)t__2e97);
+	t__2e99 = (u64)(u32)((u8)((u64)10UL));
+	t__2e96 = (u64)(u32)(((u32)t__2e98 == (u32)t__2e99));
+	if ((u32)t__2e96) goto L_passed_2e95; else goto L_failed_2e94;
+	L_failed_2e94:;
+	t_abortsite_2e17 = ((u64)2UL);
+	goto L_abort_2e62;
+	L_passed_2e95:;
+	*(u64 *)t_binding_2e105 = (u64)((u64)0UL);
+	L_loop_2e100:;
+	t__2e110 = (u64)(*(u64 *)t_binding_2e105);
+	t__2e109 = (u64)(u32)(((u64)((u64)4UL) > (u64)t__2e110));
+	t__2e106 = (u64)(u32)t__2e109;
+	if ((u32)t__2e106) goto L__2e107; else goto L__2e108;
+	L__2e107:;
+	t__2e113 = (u64)(*(u64 *)t_binding_2e105);
+	t__2e112 = (u64)((u64)t__2e113 * (u64)((u64)1UL));
+	t__2e112 = (u64)((u64)t_binding_2e71 + (u64)t__2e112);
+	t__2e114 = (u64)(u32)(((u64)t__2e113 < (u64)((u64)4UL)));
+	if ((u32)t__2e114) goto L__2e116; else goto L__2e115;
+	L__2e115:;
+	t_abortsite_2e17 = ((u64)3UL);
+	goto L_abort_2e117;
+	L__2e116:;
+	t__2e124 = (u64)(u32)(*(u8 *)t__2e112);
+	t__2e125 = (u64)(u32)((u8)t__2e124);
+	t__2e126 = (u64)(u32)((u8)((u64)3UL));
+	t__2e111 = (u64)(u32)(((u32)t__2e125 != (u32)t__2e126));
+	t__2e106 = (u64)(u32)t__2e111;
+	goto L__2e108;
+	L__2e108:;
+	if ((u32)t__2e106) goto L_body_2e101; else goto L__2e103;
+	L_body_2e101:;
+	t__2e130 = (u64)(*(u64 *)t_binding_2e105);
+	t__2e129 = (u64)((u64)t__2e130 * (u64)((u64)1UL));
+	t__2e129 = (u64)((u64)t_binding_2e71 + (u64)t__2e129);
+	*(u8 *)t__2e129 = (u8)((u64)0UL);
+	goto L__2e127;
+	L__2e131:;
+	L__2e127:;
+	L_after_2e104:;
+	t__2e132 = (u64)(*(u64 *)t_binding_2e105);
+	t__2e132 = (u64)((u64)t__2e132 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e105 = (u64)t__2e132;
+	goto L_loop_2e100;
+	L__2e103:;
+	t__2e143 = (u64)((i64)(i32)((u64)0UL));
+	t__2e142 = (u64)((u64)t__2e143 * (u64)((u64)1UL));
+	t__2e142 = (u64)((u64)t_binding_2e71 + (u64)t__2e142);
+	t__2e144 = (u64)(u32)(*(u8 *)t__2e142);
+	t__2e145 = (u64)(u32)((u8)t__2e144);
+	t__2e146 = (u64)(u32)((u8)((u64)0UL));
+	t__2e141 = (u64)(u32)(((u32)t__2e145 == (u32)t__2e146));
+	t__2e138 = (u64)(u32)t__2e141;
+	if ((u32)t__2e138) goto L__2e139; else goto L__2e140;
+	L__2e139:;
+	t__2e149 = (u64)((i64)(i32)((u64)1UL));
+	t__2e148 = (u64)((u64)t__2e149 * (u64)((u64)1UL));
+	t__2e148 = (u64)((u64)t_binding_2e71 + (u64)t__2e148);
+	t__2e150 = (u64)(u32)(*(u8 *)t__2e148);
+	t__2e151 = (u64)(u32)((u8)t__2e150);
+	t__2e152 = (u64)(u32)((u8)((u64)0UL));
+	t__2e147 = (u64)(u32)(((u32)t__2e151 == (u32)t__2e152));
+	t__2e138 = (u64)(u32)t__2e147;
+	goto L__2e140;
+	L__2e140:;
+	t__2e135 = (u64)(u32)t__2e138;
+	if ((u32)t__2e135) goto L__2e136; else goto L__2e137;
+	L__2e136:;
+	t__2e155 = (u64)((i64)(i32)((u64)2UL));
+	t__2e154 = (u64)((u64)t__2e155 * (u64)((u64)1UL));
+	t__2e154 = (u64)((u64)t_binding_2e71 + (u64)t__2e154);
+	t__2e156 = (u64)(u32)(*(u8 *)t__2e154);
+	t__2e157 = (u64)(u32)((u8)t__2e156);
+	t__2e158 = (u64)(u32)((u8)((u64)3UL));
+	t__2e153 = (u64)(u32)(((u32)t__2e157 == (u32)t__2e158));
+	t__2e135 = (u64)(u32)t__2e153;
+	goto L__2e137;
+	L__2e137:;
+	if ((u32)t__2e135) goto L_passed_2e134; else goto L_failed_2e133;
+	L_failed_2e133:;
+	t_abortsite_2e17 = ((u64)4UL);
+	goto L_abort_2e62;
+	L_passed_2e134:;
+	*(u64 *)t_binding_2e164 = (u64)((u64)0UL);
+	L_loop_2e159:;
+	t__2e166 = (u64)(*(u64 *)t_binding_2e164);
+	t__2e167 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e168 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e169 = (u64)(*(u64 *)t__2e167);
+	t__2e165 = (u64)(u32)(((u64)t__2e166 < (u64)t__2e169));
+	if ((u32)t__2e165) goto L_body_2e160; else goto L__2e162;
+	L_body_2e160:;
+	t__2e179 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e180 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e181 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e182 = (u64)(*(u64 *)t__2e179);
+	t__2e183 = (u64)(*(u64 *)t_binding_2e164);
+	t__2e178 = (u64)((u64)t__2e183 * (u64)((u64)4UL));
+	t__2e178 = (u64)((u64)t__2e181 + (u64)t__2e178);
+	t__2e184 = (u64)(u32)(((u64)t__2e183 < (u64)t__2e182));
+	if ((u32)t__2e184) goto L__2e186; else goto L__2e185;
+	L__2e185:;
+	t_abortsite_2e17 = ((u64)5UL);
+	goto L_abort_2e117;
+	L__2e186:;
+	t__2e187 = (u64)(u32)(*(i32 *)t__2e178);
+	t__2e188 = (u64)(u32)((i32)t__2e187 >> (((u64)31UL) & 31));
+	t__2e188 = (u64)(u32)((u32)t__2e188 >> (((u64)31UL) & 31));
+	t__2e189 = (u64)(u32)((u32)t__2e187 + (u32)t__2e188);
+	t__2e189 = (u64)(u32)((u32)t__2e189 & (u32)((u64)4294967294UL));
+	t__2e177 = (u64)(u32)((u32)t__2e187 - (u32)t__2e189);
+	t__2e176 = (u64)(u32)(((u32)t__2e177 == (u32)((u64)0UL)));
+	t__2e190 = (u64)(u32)((u8)t__2e176);
+	if ((u32)t__2e190) goto L_true_2e173; else goto L_false_2e174;
+	L_true_2e173:;
+	t__2e193 = (u64)(*(u64 *)t_binding_2e164);
+	t__2e194 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e195 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e196 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e197 = (u64)(*(u64 *)t__2e194);
+	t__2e198 = (u64)(*(u64 *)t__2e195);
+	t__2e199 = (u64)(u32)(((u64)t__2e193 < (u64)t__2e197));
+	if ((u32)t__2e199) goto L__2e201; else goto L__2e200;
+	L__2e200:;
+	t_abortsite_2e17 = ((u64)6UL);
+	goto L_abort_2e117;
+	L__2e201:;
+	t__2e202 = (u64)((u64)t__2e193 + (u64)((u64)1UL));
+	t__2e203 = (u64)((u64)t__2e193 * (u64)((u64)4UL));
+	t__2e203 = (u64)((u64)t__2e203 + (u64)t__2e196);
+	t__2e204 = (u64)((u64)t__2e202 * (u64)((u64)4UL));
+	t__2e204 = (u64)((u64)t__2e204 + (u64)t__2e196);
+	t__2e197 = (u64)((u64)t__2e197 - (u64)t__2e202);
+	t__2e205 = (u64)((u64)t__2e197 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e203, (u64)t__2e204, (u64)t__2e205);
+	t__2e197 = (u64)((u64)t__2e197 + (u64)t__2e193);
+	*(u64 *)t__2e194 = (u64)t__2e197;
+	((void (*)(u64, u64))((u64)X_rt_2eunensure))((u64)t_binding_2e11, (u64)((u64)4UL));
+	t__2e206 = (u64)(*(u64 *)t_binding_2e164);
+	t__2e206 = (u64)((u64)t__2e206 - (u64)((u64)1UL));
+	*(u64 *)t_binding_2e164 = (u64)t__2e206;
+	goto L__2e191;
+	L__2e207:;
+	L__2e191:;
+	goto L__2e175;
+	L_false_2e174:;
+	L__2e175:;
+	goto L__2e170;
+	L__2e208:;
+	L__2e170:;
+	L_after_2e163:;
+	t__2e209 = (u64)(*(u64 *)t_binding_2e164);
+	t__2e209 = (u64)((u64)t__2e209 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e164 = (u64)t__2e209;
+	goto L_loop_2e159;
+	L__2e162:;
+	t__2e222 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e223 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e224 = (u64)(*(u64 *)t__2e222);
+	t__2e221 = (u64)(u32)(((u64)t__2e224 == (u64)((u64)3UL)));
+	t__2e218 = (u64)(u32)t__2e221;
+	if ((u32)t__2e218) goto L__2e219; else goto L__2e220;
+	L__2e219:;
+	t__2e227 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e228 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e229 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e230 = (u64)(*(u64 *)t__2e227);
+	t__2e231 = (u64)((i64)(i32)((u64)0UL));
+	t__2e226 = (u64)((u64)t__2e231 * (u64)((u64)4UL));
+	t__2e226 = (u64)((u64)t__2e229 + (u64)t__2e226);
+	t__2e232 = (u64)(u32)(((u64)t__2e231 < (u64)t__2e230));
+	if ((u32)t__2e232) goto L__2e234; else goto L__2e233;
+	L__2e233:;
+	t_abortsite_2e17 = ((u64)7UL);
+	goto L_abort_2e117;
+	L__2e234:;
+	t__2e235 = (u64)(u32)(*(i32 *)t__2e226);
+	t__2e225 = (u64)(u32)(((u32)t__2e235 == (u32)((u64)1UL)));
+	t__2e218 = (u64)(u32)t__2e225;
+	goto L__2e220;
+	L__2e220:;
+	t__2e215 = (u64)(u32)t__2e218;
+	if ((u32)t__2e215) goto L__2e216; else goto L__2e217;
+	L__2e216:;
+	t__2e238 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e239 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e240 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e241 = (u64)(*(u64 *)t__2e238);
+	t__2e242 = (u64)((i64)(i32)((u64)1UL));
+	t__2e237 = (u64)((u64)t__2e242 * (u64)((u64)4UL));
+	t__2e237 = (u64)((u64)t__2e240 + (u64)t__2e237);
+	t__2e243 = (u64)(u32)(((u64)t__2e242 < (u64)t__2e241));
+	if ((u32)t__2e243) goto L__2e245; else goto L__2e244;
+	L__2e244:;
+	t_abortsite_2e17 = ((u64)8UL);
+	goto L_abort_2e117;
+	L__2e245:;
+	t__2e246 = (u64)(u32)(*(i32 *)t__2e237);
+	t__2e236 = (u64)(u32)(((u32)t__2e246 == (u32)((u64)3UL)));
+	t__2e215 = (u64)(u32)t__2e236;
+	goto L__2e217;
+	L__2e217:;
+	t__2e212 = (u64)(u32)t__2e215;
+	if ((u32)t__2e212) goto L__2e213; else goto L__2e214;
+	L__2e213:;
+	t__2e249 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e250 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e251 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e252 = (u64)(*(u64 *)t__2e249);
+	t__2e253 = (u64)((i64)(i32)((u64)2UL));
+	t__2e248 = (u64)((u64)t__2e253 * (u64)((u64)4UL));
+	t__2e248 = (u64)((u64)t__2e251 + (u64)t__2e248);
+	t__2e254 = (u64)(u32)(((u64)t__2e253 < (u64)t__2e252));
+	if ((u32)t__2e254) goto L__2e256; else goto L__2e255;
+	L__2e255:;
+	t_abortsite_2e17 = ((u64)9UL);
+	goto L_abort_2e117;
+	L__2e256:;
+	t__2e257 = (u64)(u32)(*(i32 *)t__2e248);
+	t__2e247 = (u64)(u32)(((u32)t__2e257 == (u32)((u64)5UL)));
+	t__2e212 = (u64)(u32)t__2e247;
+	goto L__2e214;
+	L__2e214:;
+	if ((u32)t__2e212) goto L_passed_2e211; else goto L_failed_2e210;
+	L_failed_2e210:;
+	t_abortsite_2e17 = ((u64)10UL);
+	goto L_abort_2e62;
+	L_passed_2e211:;
+	*(u64 *)t_binding_2e258 = (u64)((u64)0UL);
+	*(u64 *)t_binding_2e259 = (u64)t_binding_2e258;
+	L_loop_2e260:;
+	t__2e266 = (u64)(*(u64 *)t_binding_2e258);
+	t__2e267 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e268 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e269 = (u64)(*(u64 *)t__2e267);
+	t__2e265 = (u64)(u32)(((u64)t__2e266 < (u64)t__2e269));
+	if ((u32)t__2e265) goto L_body_2e261; else goto L__2e263;
+	L_body_2e261:;
+	t__2e272 = (u64)(*(u64 *)t_binding_2e259);
+	t__2e273 = (u64)(*(u64 *)t_binding_2e258);
+	*(u64 *)t__2e272 = (u64)t__2e273;
+	t__2e275 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e276 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e277 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e278 = (u64)(*(u64 *)t__2e275);
+	t__2e279 = (u64)(*(u64 *)t_binding_2e258);
+	t__2e274 = (u64)((u64)t__2e279 * (u64)((u64)4UL));
+	t__2e274 = (u64)((u64)t__2e277 + (u64)t__2e274);
+	t__2e280 = (u64)(u32)(((u64)t__2e279 < (u64)t__2e278));
+	if ((u32)t__2e280) goto L__2e282; else goto L__2e281;
+	L__2e281:;
+	t_abortsite_2e17 = ((u64)11UL);
+	goto L_abort_2e117;
+	L__2e282:;
+	t__2e283 = (u64)(u32)(*(i32 *)t__2e274);
+	t__2e285 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e286 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e287 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e288 = (u64)(*(u64 *)t__2e285);
+	t__2e289 = (u64)(*(u64 *)t_binding_2e258);
+	t__2e284 = (u64)((u64)t__2e289 * (u64)((u64)4UL));
+	t__2e284 = (u64)((u64)t__2e287 + (u64)t__2e284);
+	t__2e290 = (u64)(u32)(((u64)t__2e289 < (u64)t__2e288));
+	if ((u32)t__2e290) goto L__2e292; else goto L__2e291;
+	L__2e291:;
+	t_abortsite_2e17 = ((u64)12UL);
+	goto L_abort_2e117;
+	L__2e292:;
+	t__2e293 = (u64)(u32)(*(i32 *)t__2e284);
+	t__2e283 = (u64)(u32)((u32)t__2e283 + (u32)t__2e293);
+	*(u32 *)t__2e274 = (u32)t__2e283;
+	goto L__2e270;
+	L__2e294:;
+	L__2e270:;
+	L_after_2e264:;
+	t__2e295 = (u64)(*(u64 *)t_binding_2e258);
+	t__2e295 = (u64)((u64)t__2e295 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e258 = (u64)t__2e295;
+	goto L_loop_2e260;
+	L__2e263:;
+	t__2e306 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e307 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e308 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e309 = (u64)(*(u64 *)t__2e306);
+	t__2e310 = (u64)((i64)(i32)((u64)0UL));
+	t__2e305 = (u64)((u64)t__2e310 * (u64)((u64)4UL));
+	t__2e305 = (u64)((u64)t__2e308 + (u64)t__2e305);
+	t__2e311 = (u64)(u32)(((u64)t__2e310 < (u64)t__2e309));
+	if ((u32)t__2e311) goto L__2e313; else goto L__2e312;
+	L__2e312:;
+	t_abortsite_2e17 = ((u64)13UL);
+	goto L_abort_2e117;
+	L__2e313:;
+	t__2e314 = (u64)(u32)(*(i32 *)t__2e305);
+	t__2e304 = (u64)(u32)(((u32)t__2e314 == (u32)((u64)2UL)));
+	t__2e301 = (u64)(u32)t__2e304;
+	if ((u32)t__2e301) goto L__2e302; else goto L__2e303;
+	L__2e302:;
+	t__2e317 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e318 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e319 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e320 = (u64)(*(u64 *)t__2e317);
+	t__2e321 = (u64)((i64)(i32)((u64)1UL));
+	t__2e316 = (u64)((u64)t__2e321 * (u64)((u64)4UL));
+	t__2e316 = (u64)((u64)t__2e319 + (u64)t__2e316);
+	t__2e322 = (u64)(u32)(((u64)t__2e321 < (u64)t__2e320));
+	if ((u32)t__2e322) goto L__2e324; else goto L__2e323;
+	L__2e323:;
+	t_abortsite_2e17 = ((u64)14UL);
+	goto L_abort_2e117;
+	L__2e324:;
+	t__2e325 = (u64)(u32)(*(i32 *)t__2e316);
+	t__2e315 = (u64)(u32)(((u32)t__2e325 == (u32)((u64)6UL)));
+	t__2e301 = (u64)(u32)t__2e315;
+	goto L__2e303;
+	L__2e303:;
+	t__2e298 = (u64)(u32)t__2e301;
+	if ((u32)t__2e298) goto L__2e299; else goto L__2e300;
+	L__2e299:;
+	t__2e328 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e329 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e330 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e331 = (u64)(*(u64 *)t__2e328);
+	t__2e332 = (u64)((i64)(i32)((u64)2UL));
+	t__2e327 = (u64)((u64)t__2e332 * (u64)((u64)4UL));
+	t__2e327 = (u64)((u64)t__2e330 + (u64)t__2e327);
+	t__2e333 = (u64)(u32)(((u64)t__2e332 < (u64)t__2e331));
+	if ((u32)t__2e333) goto L__2e335; else goto L__2e334;
+	L__2e334:;
+	t_abortsite_2e17 = ((u64)15UL);
+	goto L_abort_2e117;
+	L__2e335:;
+	t__2e336 = (u64)(u32)(*(i32 *)t__2e327);
+	t__2e326 = (u64)(u32)(((u32)t__2e336 == (u32)((u64)10UL)));
+	t__2e298 = (u64)(u32)t__2e326;
+	goto L__2e300;
+	L__2e300:;
+	if ((u32)t__2e298) goto L_passed_2e297; else goto L_failed_2e296;
+	L_failed_2e296:;
+	t_abortsite_2e17 = ((u64)16UL);
+	goto L_abort_2e62;
+	L_passed_2e297:;
+	t_cleanup_2e68 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e69;
+	L_resume_2e337:;
+	goto L__2e9;
+	L__2e338:;
+	goto L__2e339;
+	L_defer_2e69:;
+	t__2e340 = (u64)(*(u64 *)t_binding_2e11);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e340);
+	t__2e342 = (u64)(u32)(((u32)t_cleanup_2e68 == (u32)((u64)2UL)));
+	if ((u32)t__2e342) goto L_resume_2e337; else goto L__2e341;
+	L__2e341:;
+	t__2e344 = (u64)(u32)(((u32)t_cleanup_2e68 == (u32)((u64)1UL)));
+	if ((u32)t__2e344) goto L_resume_2e123; else goto L__2e343;
+	L__2e343:;
+	goto L_resume_2e70;
+	L__2e339:;
+	L__2e9:;
+	return;
+	L_abort_2e18:;
+	t__2e19 = (u64)((u64)t_abortsite_2e17 * (u64)((u64)16UL));
+	t__2e19 = (u64)((u64)((u64)((char *)&D_abortsites_2e16)) + (u64)t__2e19);
+	t__2e20 = (u64)(*(u64 *)t__2e19);
+	t__2e21 = (u64)((u64)t__2e19 + (u64)((u64)8UL));
+	t__2e22 = (u64)(*(u32 *)t__2e21);
+	t__2e21 = (u64)((u64)t__2e19 + (u64)((u64)12UL));
+	t__2e23 = (u64)(*(u32 *)t__2e21);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e20, (u64)t__2e22, (u64)t__2e23, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e62:;
+	t__2e63 = (u64)((u64)t_abortsite_2e17 * (u64)((u64)16UL));
+	t__2e63 = (u64)((u64)((u64)((char *)&D_abortsites_2e16)) + (u64)t__2e63);
+	t__2e64 = (u64)(*(u64 *)t__2e63);
+	t__2e65 = (u64)((u64)t__2e63 + (u64)((u64)8UL));
+	t__2e66 = (u64)(*(u32 *)t__2e65);
+	t__2e65 = (u64)((u64)t__2e63 + (u64)((u64)12UL));
+	t__2e67 = (u64)(*(u32 *)t__2e65);
+	t_cleanup_2e68 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e69;
+	L_resume_2e70:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e64, (u64)t__2e66, (u64)t__2e67, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e117:;
+	t__2e118 = (u64)((u64)t_abortsite_2e17 * (u64)((u64)16UL));
+	t__2e118 = (u64)((u64)((u64)((char *)&D_abortsites_2e16)) + (u64)t__2e118);
+	t__2e119 = (u64)(*(u64 *)t__2e118);
+	t__2e120 = (u64)((u64)t__2e118 + (u64)((u64)8UL));
+	t__2e121 = (u64)(*(u32 *)t__2e120);
+	t__2e120 = (u64)((u64)t__2e118 + (u64)((u64)12UL));
+	t__2e122 = (u64)(*(u32 *)t__2e120);
+	t_cleanup_2e68 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e69;
+	L_resume_2e123:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e119, (u64)t__2e121, (u64)t__2e122, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_for__each__aggregate(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[4] __attribute__((aligned(16)));
+	char A9[16] __attribute__((aligned(16)));
+	u64 t__2e356;
+	u64 t__2e365;
+	u64 t__2e366;
+	u64 t__2e367;
+	u64 t__2e368;
+	u64 t__2e373;
+	u64 t__2e374;
+	u64 t__2e376;
+	u64 t__2e378;
+	u64 t__2e382;
+	u64 t__2e383;
+	u64 t__2e387;
+	u64 t__2e388;
+	u64 t__2e389;
+	u64 t__2e390;
+	u64 t__2e391;
+	u64 t__2e398;
+	u64 t__2e399;
+	u64 t__2e400;
+	u64 t__2e401;
+	u64 t__2e410;
+	u64 t__2e412;
+	u64 t__2e416;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e421;
+	u64 t__2e423;
+	u64 t__2e424;
+	u64 t__2e425;
+	u64 t__2e426;
+	u64 t__2e428;
+	u64 t__2e436;
+	u64 t__2e437;
+	u64 t__2e438;
+	u64 t__2e439;
+	u64 t__2e445;
+	u64 t__2e446;
+	u64 t__2e447;
+	u64 t__2e448;
+	u64 t__2e449;
+	u64 t__2e450;
+	u64 t__2e451;
+	u64 t__2e455;
+	u64 t__2e456;
+	u64 t__2e457;
+	u64 t__2e458;
+	u64 t__2e459;
+	u64 t__2e463;
+	u64 t__2e465;
+	u64 t__2e466;
+	u64 t__2e467;
+	u64 t__2e468;
+	u64 t__2e469;
+	u64 t__2e470;
+	u64 t__2e474;
+	u64 t__2e477;
+	u64 t__2e478;
+	u64 t__2e479;
+	u64 t__2e481;
+	u64 t__2e482;
+	u64 t__2e483;
+	u64 t__2e484;
+	u64 t__2e486;
+	u64 t__2e501;
+	u64 t__2e502;
+	u64 t__2e503;
+	u64 t__2e504;
+	u64 t__2e507;
+	u64 t__2e528;
+	u64 t__2e529;
+	u64 t__2e530;
+	u64 t__2e531;
+	u64 t__2e535;
+	u64 t__2e536;
+	u64 t_abortsite_2e385;
+	u64 t_binding_2e349;
+	u64 t_binding_2e355;
+	u64 t_binding_2e357;
+	u64 t_binding_2e429;
+	u64 t_binding_2e487;
+	u64 t_binding_2e509;
+	u64 t_cur__object_2e402;
+	u64 t_cur__object_2e440;
+	u64 t_cur__object_2e494;
+	u64 t_end_2e369;
+	u64 t_end_2e403;
+	u64 t_end_2e441;
+	u64 t_end_2e495;
+	u64 t_end_2e522;
+	u64 t_field_2e353;
+	u64 t_field_2e354;
+	u64 t_field_2e375;
+	u64 t_field_2e377;
+	u64 t_field_2e407;
+	u64 t_field_2e411;
+	u64 t_field_2e422;
+	u64 t_field_2e427;
+	u64 t_field_2e460;
+	u64 t_field_2e464;
+	u64 t_field_2e480;
+	u64 t_field_2e485;
+	u64 t_item_2e352;
+	u64 t_item_2e518;
+	u64 t_object_2e515;
+	u64 t_ptr_2e493;
+	u64 t_ptr_2e521;
+	u64 t_unpack_2e524;
+	u64 t_unpack_2e525;
+	u64 t_valid_2e370;
+	u64 t_valid_2e404;
+	u64 t_valid_2e442;
+	u64 t_valid_2e496;
+	u64 t_valid_2e523;
+	u64 t_value_2e519;
+	u64 t_value_2e520;
+	L_start_2e345:;
+	t_binding_2e349 = (u64)A0;
+	t_binding_2e355 = (u64)A1;
+	t_binding_2e357 = (u64)A2;
+	t_cur__object_2e402 = (u64)A3;
+	t_binding_2e429 = (u64)A4;
+	t_cur__object_2e440 = (u64)A5;
+	t_binding_2e487 = (u64)A6;
+	t_cur__object_2e494 = (u64)A7;
+	t_binding_2e509 = (u64)A8;
+	t_object_2e515 = (u64)A9;
+	L_body_2e346:;
+	t_item_2e352 = (u64)((u64)t_binding_2e349 + (u64)((u64)0UL));
+	t_field_2e353 = (u64)((u64)t_item_2e352 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e353 = (u32)((u64)1UL);
+	t_field_2e353 = (u64)((u64)t_item_2e352 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e353 = (u32)((u64)2UL);
+	t_item_2e352 = (u64)((u64)t_binding_2e349 + (u64)((u64)8UL));
+	t_field_2e354 = (u64)((u64)t_item_2e352 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e354 = (u32)((u64)3UL);
+	t_field_2e354 = (u64)((u64)t_item_2e352 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e354 = (u32)((u64)4UL);
+	*(u64 *)t_binding_2e355 = (u64)t_binding_2e349;
+	t__2e356 = (u64)((u64)t_binding_2e355 + (u64)((u64)8UL));
+	*(u64 *)t__2e356 = (u64)((u64)2UL);
+	t__2e356 = (u64)((u64)t__2e356 + (u64)((u64)8UL));
+	*(u64 *)t__2e356 = (u64)((u64)2UL);
+	*(u32 *)t_binding_2e357 = (u32)((u64)0UL);
+	t__2e365 = (u64)((u64)t_binding_2e355 + (u64)((u64)8UL));
+	t__2e366 = (u64)((u64)t_binding_2e355 + (u64)((u64)16UL));
+	t__2e367 = (u64)(*(u64 *)t_binding_2e355);
+	t__2e368 = (u64)(*(u64 *)t__2e365);
+	t_end_2e369 = (u64)((u64)t__2e368 * (u64)((u64)8UL));
+	t_end_2e369 = (u64)((u64)t__2e367 + (u64)t_end_2e369);
+	L_loop_2e358:;
+	t_valid_2e370 = (u64)(u32)(((u64)t__2e367 < (u64)t_end_2e369));
+	if ((u32)t_valid_2e370) goto L_valid_2e360; else goto L__2e361;
+	L_valid_2e360:;
+	L_body_2e359:;
+	t__2e373 = (u64)(u32)(*(i32 *)t_binding_2e357);
+	t_field_2e375 = (u64)((u64)t__2e367 + (u64)((u64)0UL));
+	t__2e376 = (u64)(u32)(*(i32 *)t_field_2e375);
+	t_field_2e377 = (u64)((u64)t__2e367 + (u64)((u64)4UL));
+	t__2e378 = (u64)(u32)(*(i32 *)t_field_2e377);
+	t__2e374 = (u64)(u32)((u32)t__2e376 * (u32)t__2e378);
+	t__2e373 = (u64)(u32)((u32)t__2e373 + (u32)t__2e374);
+	*(u32 *)t_binding_2e357 = (u32)t__2e373;
+	goto L__2e371;
+	L__2e379:;
+	L__2e371:;
+	L_after_2e362:;
+	t__2e367 = (u64)((u64)t__2e367 + (u64)((u64)8UL));
+	goto L_loop_2e358;
+	L__2e361:;
+	t__2e383 = (u64)(u32)(*(i32 *)t_binding_2e357);
+	t__2e382 = (u64)(u32)(((u32)t__2e383 == (u32)((u64)14UL)));
+	if ((u32)t__2e382) goto L_passed_2e381; else goto L_failed_2e380;
+	L_failed_2e380:;
+	t_abortsite_2e385 = ((u64)0UL);
+	goto L_abort_2e386;
+	L_passed_2e381:;
+	t__2e398 = (u64)((u64)t_binding_2e355 + (u64)((u64)8UL));
+	t__2e399 = (u64)((u64)t_binding_2e355 + (u64)((u64)16UL));
+	t__2e400 = (u64)(*(u64 *)t_binding_2e355);
+	t__2e401 = (u64)(*(u64 *)t__2e398);
+	t_end_2e403 = (u64)((u64)t__2e401 * (u64)((u64)8UL));
+	t_end_2e403 = (u64)((u64)t__2e400 + (u64)t_end_2e403);
+	L_loop_2e392:;
+	t_valid_2e404 = (u64)(u32)(((u64)t__2e400 < (u64)t_end_2e403));
+	if ((u32)t_valid_2e404) goto L_valid_2e394; else goto L__2e395;
+	L_valid_2e394:;
+	BLIT(t_cur__object_2e402, t__2e400, ((u64)8UL));
+	L_body_2e393:;
+	t_field_2e407 = (u64)((u64)t_cur__object_2e402 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e407 = (u32)((u64)0UL);
+	t_field_2e411 = (u64)((u64)t_cur__object_2e402 + (u64)((u64)0UL));
+	t__2e412 = (u64)(u32)(*(i32 *)t_field_2e411);
+	t__2e410 = (u64)(u32)(((u32)t__2e412 == (u32)((u64)0UL)));
+	if ((u32)t__2e410) goto L_passed_2e409; else goto L_failed_2e408;
+	L_failed_2e408:;
+	t_abortsite_2e385 = ((u64)1UL);
+	goto L_abort_2e386;
+	L_passed_2e409:;
+	goto L__2e405;
+	L__2e413:;
+	L__2e405:;
+	L_after_2e396:;
+	t__2e400 = (u64)((u64)t__2e400 + (u64)((u64)8UL));
+	goto L_loop_2e392;
+	L__2e395:;
+	t__2e421 = (u64)((i64)(i32)((u64)0UL));
+	t__2e420 = (u64)((u64)t__2e421 * (u64)((u64)8UL));
+	t__2e420 = (u64)((u64)t_binding_2e349 + (u64)t__2e420);
+	t_field_2e422 = (u64)((u64)t__2e420 + (u64)((u64)0UL));
+	t__2e423 = (u64)(u32)(*(i32 *)t_field_2e422);
+	t__2e419 = (u64)(u32)(((u32)t__2e423 == (u32)((u64)1UL)));
+	t__2e416 = (u64)(u32)t__2e419;
+	if ((u32)t__2e416) goto L__2e417; else goto L__2e418;
+	L__2e417:;
+	t__2e426 = (u64)((i64)(i32)((u64)1UL));
+	t__2e425 = (u64)((u64)t__2e426 * (u64)((u64)8UL));
+	t__2e425 = (u64)((u64)t_binding_2e349 + (u64)t__2e425);
+	t_field_2e427 = (u64)((u64)t__2e425 + (u64)((u64)0UL));
+	t__2e428 = (u64)(u32)(*(i32 *)t_field_2e427);
+	t__2e424 = (u64)(u32)(((u32)t__2e428 == (u32)((u64)3UL)));
+	t__2e416 = (u64)(u32)t__2e424;
+	goto L__2e418;
+	L__2e418:;
+	if ((u32)t__2e416) goto L_passed_2e415; else goto L_failed_2e414;
+	L_failed_2e414:;
+	t_abortsite_2e385 = ((u64)2UL);
+	goto L_abort_2e386;
+	L_passed_2e415:;
+	*(u64 *)t_binding_2e429 = (u64)((u64)0UL);
+	t__2e436 = (u64)((u64)t_binding_2e355 + (u64)((u64)8UL));
+	t__2e437 = (u64)((u64)t_binding_2e355 + (u64)((u64)16UL));
+	t__2e438 = (u64)(*(u64 *)t_binding_2e355);
+	t__2e439 = (u64)(*(u64 *)t__2e436);
+	t_end_2e441 = (u64)((u64)t__2e439 * (u64)((u64)8UL));
+	t_end_2e441 = (u64)((u64)t__2e438 + (u64)t_end_2e441);
+	L_loop_2e430:;
+	t_valid_2e442 = (u64)(u32)(((u64)t__2e438 < (u64)t_end_2e441));
+	if ((u32)t_valid_2e442) goto L_valid_2e432; else goto L__2e433;
+	L_valid_2e432:;
+	BLIT(t_cur__object_2e440, t__2e438, ((u64)8UL));
+	L_body_2e431:;
+	t__2e446 = (u64)((u64)t_binding_2e355 + (u64)((u64)8UL));
+	t__2e447 = (u64)((u64)t_binding_2e355 + (u64)((u64)16UL));
+	t__2e448 = (u64)(*(u64 *)t_binding_2e355);
+	t__2e449 = (u64)(*(u64 *)t__2e446);
+	t__2e450 = (u64)(*(u64 *)t_binding_2e429);
+	t__2e445 = (u64)((u64)t__2e450 * (u64)((u64)8UL));
+	t__2e445 = (u64)((u64)t__2e448 + (u64)t__2e445);
+	t__2e451 = (u64)(u32)(((u64)t__2e450 < (u64)t__2e449));
+	if ((u32)t__2e451) goto L__2e453; else goto L__2e452;
+	L__2e452:;
+	t_abortsite_2e385 = ((u64)3UL);
+	goto L_abort_2e454;
+	L__2e453:;
+	t_field_2e460 = (u64)((u64)t__2e445 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e460 = (u32)((u64)0UL);
+	t_field_2e464 = (u64)((u64)t_cur__object_2e440 + (u64)((u64)4UL));
+	t__2e465 = (u64)(u32)(*(i32 *)t_field_2e464);
+	t__2e468 = (u64)(*(u64 *)t_binding_2e429);
+	t__2e469 = (u64)(u32)t__2e468;
+	t__2e467 = (u64)(u32)((u32)t__2e469 + (u32)((u64)1UL));
+	t__2e466 = (u64)(u32)((u32)t__2e467 << (((u64)1UL) & 31));
+	t__2e463 = (u64)(u32)(((u32)t__2e465 == (u32)t__2e466));
+	if ((u32)t__2e463) goto L_passed_2e462; else goto L_failed_2e461;
+	L_failed_2e461:;
+	t_abortsite_2e385 = ((u64)4UL);
+	goto L_abort_2e386;
+	L_passed_2e462:;
+	t__2e470 = (u64)(*(u64 *)t_binding_2e429);
+	t__2e470 = (u64)((u64)t__2e470 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e429 = (u64)t__2e470;
+	goto L__2e443;
+	L__2e471:;
+	L__2e443:;
+	L_after_2e434:;
+	t__2e438 = (u64)((u64)t__2e438 + (u64)((u64)8UL));
+	goto L_loop_2e430;
+	L__2e433:;
+	t__2e479 = (u64)((i64)(i32)((u64)0UL));
+	t__2e478 = (u64)((u64)t__2e479 * (u64)((u64)8UL));
+	t__2e478 = (u64)((u64)t_binding_2e349 + (u64)t__2e478);
+	t_field_2e480 = (u64)((u64)t__2e478 + (u64)((u64)4UL));
+	t__2e481 = (u64)(u32)(*(i32 *)t_field_2e480);
+	t__2e477 = (u64)(u32)(((u32)t__2e481 == (u32)((u64)0UL)));
+	t__2e474 = (u64)(u32)t__2e477;
+	if ((u32)t__2e474) goto L__2e475; else goto L__2e476;
+	L__2e475:;
+	t__2e484 = (u64)((i64)(i32)((u64)1UL));
+	t__2e483 = (u64)((u64)t__2e484 * (u64)((u64)8UL));
+	t__2e483 = (u64)((u64)t_binding_2e349 + (u64)t__2e483);
+	t_field_2e485 = (u64)((u64)t__2e483 + (u64)((u64)4UL));
+	t__2e486 = (u64)(u32)(*(i32 *)t_field_2e485);
+	t__2e482 = (u64)(u32)(((u32)t__2e486 == (u32)((u64)0UL)));
+	t__2e474 = (u64)(u32)t__2e482;
+	goto L__2e476;
+	L__2e476:;
+	if ((u32)t__2e474) goto L_passed_2e473; else goto L_failed_2e472;
+	L_failed_2e472:;
+	t_abortsite_2e385 = ((u64)5UL);
+	goto L_abort_2e386;
+	L_passed_2e473:;
+	*(u64 *)t_binding_2e487 = (u64)((u64)0UL);
+	t_ptr_2e493 = t_binding_2e349;
+	t_end_2e495 = (u64)((u64)((u64)2UL) * (u64)((u64)8UL));
+	t_end_2e495 = (u64)((u64)t_ptr_2e493 + (u64)t_end_2e495);
+	L_loop_2e488:;
+	t_valid_2e496 = (u64)(u32)(((u64)t_ptr_2e493 < (u64)t_end_2e495));
+	if ((u32)t_valid_2e496) goto L_valid_2e490; else goto L__2e491;
+	L_valid_2e490:;
+	BLIT(t_cur__object_2e494, t_ptr_2e493, ((u64)8UL));
+	L_body_2e489:;
+	t__2e503 = (u64)(*(u64 *)t_binding_2e487);
+	t__2e502 = (u64)((u64)t__2e503 * (u64)((u64)8UL));
+	t__2e502 = (u64)((u64)t_binding_2e349 + (u64)t__2e502);
+	t__2e504 = (u64)(u32)(((u64)t__2e503 < (u64)((u64)2UL)));
+	if ((u32)t__2e504) goto L__2e506; else goto L__2e505;
+	L__2e505:;
+	t_abortsite_2e385 = ((u64)6UL);
+	goto L_abort_2e454;
+	L__2e506:;
+	t__2e501 = (u64)(u32)(((u64)t_cur__object_2e494 != (u64)t__2e502));
+	if ((u32)t__2e501) goto L_passed_2e500; else goto L_failed_2e499;
+	L_failed_2e499:;
+	t_abortsite_2e385 = ((u64)7UL);
+	goto L_abort_2e386;
+	L_passed_2e500:;
+	t__2e507 = (u64)(*(u64 *)t_binding_2e487);
+	t__2e507 = (u64)((u64)t__2e507 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e487 = (u64)t__2e507;
+	goto L__2e497;
+	L__2e508:;
+	L__2e497:;
+	L_after_2e492:;
+	t_ptr_2e493 = (u64)((u64)t_ptr_2e493 + (u64)((u64)8UL));
+	goto L_loop_2e488;
+	L__2e491:;
+	*(u32 *)t_binding_2e509 = (u32)((u64)0UL);
+	t_item_2e518 = (u64)((u64)t_object_2e515 + (u64)((u64)0UL));
+	t_value_2e519 = (u64)((u64)t_item_2e518 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e519 = (u32)((u64)1UL);
+	t_value_2e519 = (u64)((u64)t_item_2e518 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e519 = (u32)((u64)2UL);
+	t_item_2e518 = (u64)((u64)t_object_2e515 + (u64)((u64)8UL));
+	t_value_2e520 = (u64)((u64)t_item_2e518 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e520 = (u32)((u64)3UL);
+	t_value_2e520 = (u64)((u64)t_item_2e518 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e520 = (u32)((u64)4UL);
+	t_ptr_2e521 = t_object_2e515;
+	t_end_2e522 = (u64)((u64)((u64)2UL) * (u64)((u64)8UL));
+	t_end_2e522 = (u64)((u64)t_ptr_2e521 + (u64)t_end_2e522);
+	L_loop_2e510:;
+	t_valid_2e523 = (u64)(u32)(((u64)t_ptr_2e521 < (u64)t_end_2e522));
+	if ((u32)t_valid_2e523) goto L_valid_2e512; else goto L__2e513;
+	L_valid_2e512:;
+	t_unpack_2e524 = (u64)((u64)t_ptr_2e521 + (u64)((u64)0UL));
+	t_unpack_2e525 = (u64)((u64)t_ptr_2e521 + (u64)((u64)4UL));
+	L_body_2e511:;
+	t__2e528 = (u64)(u32)(*(i32 *)t_binding_2e509);
+	t__2e530 = (u64)(u32)(*(i32 *)t_unpack_2e524);
+	t__2e531 = (u64)(u32)(*(i32 *)t_unpack_2e525);
+	t__2e529 = (u64)(u32)((u32)t__2e530 * (u32)t__2e531);
+	t__2e528 = (u64)(u32)((u32)t__2e528 + (u32)t__2e529);
+	*(u32 *)t_binding_2e509 = (u32)t__2e528;
+	goto L__2e526;
+	L__2e532:;
+	L__2e526:;
+	L_after_2e514:;
+	t_ptr_2e521 = (u64)((u64)t_ptr_2e521 + (u64)((u64)8UL));
+	goto L_loop_2e510;
+	L__2e513:;
+	t__2e536 = (u64)(u32)(*(i32 *)t_binding_2e509);
+	t__2e535 = (u64)(u32)(((u32)t__2e536 == (u32)((u64)14UL)));
+	if ((u32)t__2e535) goto L_passed_2e534; else goto L_failed_2e533;
+	L_failed_2e533:;
+	t_abortsite_2e385 = ((u64)8UL);
+	goto L_abort_2e386;
+	L_passed_2e534:;
+	goto L__2e347;
+	L__2e537:;
+	L__2e347:;
+	return;
+	L_abort_2e386:;
+	t__2e387 = (u64)((u64)t_abortsite_2e385 * (u64)((u64)16UL));
+	t__2e387 = (u64)((u64)((u64)((char *)&D_abortsites_2e384)) + (u64)t__2e387);
+	t__2e388 = (u64)(*(u64 *)t__2e387);
+	t__2e389 = (u64)((u64)t__2e387 + (u64)((u64)8UL));
+	t__2e390 = (u64)(*(u32 *)t__2e389);
+	t__2e389 = (u64)((u64)t__2e387 + (u64)((u64)12UL));
+	t__2e391 = (u64)(*(u32 *)t__2e389);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e388, (u64)t__2e390, (u64)t__2e391, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e454:;
+	t__2e455 = (u64)((u64)t_abortsite_2e385 * (u64)((u64)16UL));
+	t__2e455 = (u64)((u64)((u64)((char *)&D_abortsites_2e384)) + (u64)t__2e455);
+	t__2e456 = (u64)(*(u64 *)t__2e455);
+	t__2e457 = (u64)((u64)t__2e455 + (u64)((u64)8UL));
+	t__2e458 = (u64)(*(u32 *)t__2e457);
+	t__2e457 = (u64)((u64)t__2e455 + (u64)((u64)12UL));
+	t__2e459 = (u64)(*(u32 *)t__2e457);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e456, (u64)t__2e458, (u64)t__2e459, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_for__each(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[96] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[4] __attribute__((aligned(16)));
+	char A6[4] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[4] __attribute__((aligned(16)));
+	char A10[4] __attribute__((aligned(16)));
+	char A11[4] __attribute__((aligned(16)));
+	char A12[4] __attribute__((aligned(16)));
+	char A13[4] __attribute__((aligned(16)));
+	char A14[4] __attribute__((aligned(16)));
+	char A15[4] __attribute__((aligned(16)));
+	char A16[12] __attribute__((aligned(16)));
+	char A17[4] __attribute__((aligned(16)));
+	char A18[4] __attribute__((aligned(16)));
+	char A19[4] __attribute__((aligned(16)));
+	char A20[12] __attribute__((aligned(16)));
+	char A21[8] __attribute__((aligned(16)));
+	char A22[4] __attribute__((aligned(16)));
+	char A23[8] __attribute__((aligned(16)));
+	char A24[4] __attribute__((aligned(16)));
+	char A25[8] __attribute__((aligned(16)));
+	char A26[4] __attribute__((aligned(16)));
+	char A27[8] __attribute__((aligned(16)));
+	char A28[4] __attribute__((aligned(16)));
+	char A29[8] __attribute__((aligned(16)));
+	char A30[4] __attribute__((aligned(16)));
+	char A31[4] __attribute__((aligned(16)));
+	char A32[4] __attribute__((aligned(16)));
+	char A33[4] __attribute__((aligned(16)));
+	char A34[12] __attribute__((aligned(16)));
+	char A35[4] __attribute__((aligned(16)));
+	char A36[4] __attribute__((aligned(16)));
+	char A37[24] __attribute__((aligned(16)));
+	char A38[12] __attribute__((aligned(16)));
+	char A39[4] __attribute__((aligned(16)));
+	char A40[4] __attribute__((aligned(16)));
+	char A41[4] __attribute__((aligned(16)));
+	char A42[8] __attribute__((aligned(16)));
+	char A43[16] __attribute__((aligned(16)));
+	char A44[4] __attribute__((aligned(16)));
+	char A45[4] __attribute__((aligned(16)));
+	char A46[4] __attribute__((aligned(16)));
+	char A47[8] __attribute__((aligned(16)));
+	char A48[8] __attribute__((aligned(16)));
+	char A49[4] __attribute__((aligned(16)));
+	char A50[8] __attribute__((aligned(16)));
+	char A51[4] __attribute__((aligned(16)));
+	char A52[8] __attribute__((aligned(16)));
+	char A53[4] __attribute__((aligned(16)));
+	char A54[8] __attribute__((aligned(16)));
+	char A55[8] __attribute__((aligned(16)));
+	char A56[8] __attribute__((aligned(16)));
+	char A57[4] __attribute__((aligned(16)));
+	char A58[8] __attribute__((aligned(16)));
+	char A59[8] __attribute__((aligned(16)));
+	char A60[24] __attribute__((aligned(16)));
+	char A61[8] __attribute__((aligned(16)));
+	char A62[24] __attribute__((aligned(16)));
+	char A63[8] __attribute__((aligned(16)));
+	char A64[24] __attribute__((aligned(16)));
+	char A65[8] __attribute__((aligned(16)));
+	char A66[24] __attribute__((aligned(16)));
+	char A67[8] __attribute__((aligned(16)));
+	char A68[24] __attribute__((aligned(16)));
+	char A69[8] __attribute__((aligned(16)));
+	char A70[24] __attribute__((aligned(16)));
+	char A71[8] __attribute__((aligned(16)));
+	char A72[24] __attribute__((aligned(16)));
+	char A73[8] __attribute__((aligned(16)));
+	char A74[24] __attribute__((aligned(16)));
+	char B75[24] __attribute__((aligned(16)));
+	char B76[24] __attribute__((aligned(16)));
+	char R77[8] __attribute__((aligned(16)));
+	char R78[8] __attribute__((aligned(16)));
+	char R79[40] __attribute__((aligned(16)));
+	char B80[24] __attribute__((aligned(16)));
+	char B81[24] __attribute__((aligned(16)));
+	char R82[4] __attribute__((aligned(16)));
+	char R83[4100] __attribute__((aligned(16)));
+	char B84[8] __attribute__((aligned(16)));
+	char B85[24] __attribute__((aligned(16)));
+	char B86[24] __attribute__((aligned(16)));
+	char R87[4] __attribute__((aligned(16)));
+	char B88[8] __attribute__((aligned(16)));
+	char B89[24] __attribute__((aligned(16)));
+	char B90[24] __attribute__((aligned(16)));
+	char R91[4] __attribute__((aligned(16)));
+	char B92[8] __attribute__((aligned(16)));
+	char B93[24] __attribute__((aligned(16)));
+	char B94[24] __attribute__((aligned(16)));
+	char R95[4] __attribute__((aligned(16)));
+	char B96[8] __attribute__((aligned(16)));
+	char B97[24] __attribute__((aligned(16)));
+	char B98[24] __attribute__((aligned(16)));
+	char R99[4] __attribute__((aligned(16)));
+	char B100[8] __attribute__((aligned(16)));
+	char B101[24] __attribute__((aligned(16)));
+	char B102[24] __attribute__((aligned(16)));
+	char R103[4] __attribute__((aligned(16)));
+	char B104[8] __attribute__((aligned(16)));
+	char B105[24] __attribute__((aligned(16)));
+	char B106[24] __attribute__((aligned(16)));
+	char R107[4] __attribute__((aligned(16)));
+	char B108[8] __attribute__((aligned(16)));
+	char B109[24] __attribute__((aligned(16)));
+	char B110[24] __attribute__((aligned(16)));
+	char R111[4] __attribute__((aligned(16)));
+	char B112[8] __attribute__((aligned(16)));
+	char B113[24] __attribute__((aligned(16)));
+	char B114[24] __attribute__((aligned(16)));
+	char R115[4] __attribute__((aligned(16)));
+	u64 t__2e1002;
+	u64 t__2e1010;
+	u64 t__2e1011;
+	u64 t__2e1012;
+	u64 t__2e1013;
+	u64 t__2e1014;
+	u64 t__2e1020;
+	u64 t__2e1021;
+	u64 t__2e1022;
+	u64 t__2e1023;
+	u64 t__2e1024;
+	u64 t__2e1025;
+	u64 t__2e1029;
+	u64 t__2e1030;
+	u64 t__2e1034;
+	u64 t__2e1035;
+	u64 t__2e1057;
+	u64 t__2e1058;
+	u64 t__2e1059;
+	u64 t__2e1060;
+	u64 t__2e1064;
+	u64 t__2e1065;
+	u64 t__2e1071;
+	u64 t__2e1074;
+	u64 t__2e1085;
+	u64 t__2e1091;
+	u64 t__2e1104;
+	u64 t__2e1109;
+	u64 t__2e1110;
+	u64 t__2e1112;
+	u64 t__2e1116;
+	u64 t__2e1117;
+	u64 t__2e1122;
+	u64 t__2e1131;
+	u64 t__2e1132;
+	u64 t__2e1133;
+	u64 t__2e1134;
+	u64 t__2e1138;
+	u64 t__2e1143;
+	u64 t__2e1144;
+	u64 t__2e1145;
+	u64 t__2e1149;
+	u64 t__2e1150;
+	u64 t__2e1158;
+	u64 t__2e1159;
+	u64 t__2e1160;
+	u64 t__2e1161;
+	u64 t__2e1169;
+	u64 t__2e1170;
+	u64 t__2e1171;
+	u64 t__2e1172;
+	u64 t__2e1176;
+	u64 t__2e1177;
+	u64 t__2e1191;
+	u64 t__2e1196;
+	u64 t__2e1197;
+	u64 t__2e1198;
+	u64 t__2e1202;
+	u64 t__2e1203;
+	u64 t__2e1218;
+	u64 t__2e1219;
+	u64 t__2e1220;
+	u64 t__2e1221;
+	u64 t__2e1225;
+	u64 t__2e1226;
+	u64 t__2e1234;
+	u64 t__2e1243;
+	u64 t__2e1244;
+	u64 t__2e1245;
+	u64 t__2e1246;
+	u64 t__2e1250;
+	u64 t__2e1251;
+	u64 t__2e1266;
+	u64 t__2e1267;
+	u64 t__2e1268;
+	u64 t__2e1269;
+	u64 t__2e1273;
+	u64 t__2e1274;
+	u64 t__2e1281;
+	u64 t__2e1282;
+	u64 t__2e1283;
+	u64 t__2e1284;
+	u64 t__2e1293;
+	u64 t__2e1294;
+	u64 t__2e1295;
+	u64 t__2e1296;
+	u64 t__2e1300;
+	u64 t__2e1301;
+	u64 t__2e1310;
+	u64 t__2e1314;
+	u64 t__2e1318;
+	u64 t__2e1319;
+	u64 t__2e1321;
+	u64 t__2e1327;
+	u64 t__2e1332;
+	u64 t__2e1341;
+	u64 t__2e1343;
+	u64 t__2e1345;
+	u64 t__2e1346;
+	u64 t__2e1347;
+	u64 t__2e1348;
+	u64 t__2e1349;
+	u64 t__2e1353;
+	u64 t__2e1354;
+	u64 t__2e1355;
+	u64 t__2e1356;
+	u64 t__2e1357;
+	u64 t__2e1360;
+	u64 t__2e1362;
+	u64 t__2e1366;
+	u64 t__2e1375;
+	u64 t__2e1377;
+	u64 t__2e1380;
+	u64 t__2e1382;
+	u64 t__2e1386;
+	u64 t__2e1395;
+	u64 t__2e1397;
+	u64 t__2e1400;
+	u64 t__2e1402;
+	u64 t__2e1406;
+	u64 t__2e1415;
+	u64 t__2e1417;
+	u64 t__2e1420;
+	u64 t__2e1422;
+	u64 t__2e1426;
+	u64 t__2e1435;
+	u64 t__2e1437;
+	u64 t__2e1440;
+	u64 t__2e1442;
+	u64 t__2e1446;
+	u64 t__2e1455;
+	u64 t__2e1457;
+	u64 t__2e1460;
+	u64 t__2e1462;
+	u64 t__2e1466;
+	u64 t__2e1475;
+	u64 t__2e1477;
+	u64 t__2e1480;
+	u64 t__2e1482;
+	u64 t__2e1486;
+	u64 t__2e1495;
+	u64 t__2e1497;
+	u64 t__2e1502;
+	u64 t__2e1504;
+	u64 t__2e1506;
+	u64 t__2e1508;
+	u64 t__2e1510;
+	u64 t__2e546;
+	u64 t__2e547;
+	u64 t__2e548;
+	u64 t__2e549;
+	u64 t__2e550;
+	u64 t__2e551;
+	u64 t__2e552;
+	u64 t__2e555;
+	u64 t__2e556;
+	u64 t__2e557;
+	u64 t__2e558;
+	u64 t__2e559;
+	u64 t__2e560;
+	u64 t__2e561;
+	u64 t__2e562;
+	u64 t__2e563;
+	u64 t__2e566;
+	u64 t__2e567;
+	u64 t__2e568;
+	u64 t__2e569;
+	u64 t__2e570;
+	u64 t__2e571;
+	u64 t__2e572;
+	u64 t__2e573;
+	u64 t__2e574;
+	u64 t__2e577;
+	u64 t__2e578;
+	u64 t__2e579;
+	u64 t__2e601;
+	u64 t__2e603;
+	u64 t__2e604;
+	u64 t__2e605;
+	u64 t__2e606;
+	u64 t__2e610;
+	u64 t__2e613;
+	u64 t__2e617;
+	u64 t__2e618;
+	u64 t__2e622;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e637;
+	u64 t__2e639;
+	u64 t__2e640;
+	u64 t__2e641;
+	u64 t__2e642;
+	u64 t__2e648;
+	u64 t__2e652;
+	u64 t__2e653;
+	u64 t__2e664;
+	u64 t__2e669;
+	u64 t__2e670;
+	u64 t__2e671;
+	u64 t__2e672;
+	u64 t__2e676;
+	u64 t__2e677;
+	u64 t__2e685;
+	u64 t__2e686;
+	u64 t__2e687;
+	u64 t__2e688;
+	u64 t__2e692;
+	u64 t__2e697;
+	u64 t__2e698;
+	u64 t__2e699;
+	u64 t__2e700;
+	u64 t__2e704;
+	u64 t__2e705;
+	u64 t__2e713;
+	u64 t__2e714;
+	u64 t__2e715;
+	u64 t__2e716;
+	u64 t__2e720;
+	u64 t__2e725;
+	u64 t__2e726;
+	u64 t__2e727;
+	u64 t__2e728;
+	u64 t__2e732;
+	u64 t__2e733;
+	u64 t__2e747;
+	u64 t__2e752;
+	u64 t__2e753;
+	u64 t__2e754;
+	u64 t__2e755;
+	u64 t__2e759;
+	u64 t__2e760;
+	u64 t__2e776;
+	u64 t__2e777;
+	u64 t__2e778;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e784;
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e787;
+	u64 t__2e788;
+	u64 t__2e793;
+	u64 t__2e794;
+	u64 t__2e795;
+	u64 t__2e796;
+	u64 t__2e797;
+	u64 t__2e798;
+	u64 t__2e802;
+	u64 t__2e803;
+	u64 t__2e807;
+	u64 t__2e808;
+	u64 t__2e825;
+	u64 t__2e826;
+	u64 t__2e827;
+	u64 t__2e828;
+	u64 t__2e829;
+	u64 t__2e833;
+	u64 t__2e834;
+	u64 t__2e849;
+	u64 t__2e850;
+	u64 t__2e851;
+	u64 t__2e852;
+	u64 t__2e853;
+	u64 t__2e857;
+	u64 t__2e858;
+	u64 t__2e866;
+	u64 t__2e867;
+	u64 t__2e868;
+	u64 t__2e869;
+	u64 t__2e877;
+	u64 t__2e878;
+	u64 t__2e879;
+	u64 t__2e880;
+	u64 t__2e881;
+	u64 t__2e885;
+	u64 t__2e886;
+	u64 t__2e901;
+	u64 t__2e902;
+	u64 t__2e903;
+	u64 t__2e904;
+	u64 t__2e905;
+	u64 t__2e909;
+	u64 t__2e910;
+	u64 t__2e918;
+	u64 t__2e919;
+	u64 t__2e920;
+	u64 t__2e921;
+	u64 t__2e929;
+	u64 t__2e930;
+	u64 t__2e931;
+	u64 t__2e932;
+	u64 t__2e933;
+	u64 t__2e937;
+	u64 t__2e938;
+	u64 t__2e945;
+	u64 t__2e950;
+	u64 t__2e956;
+	u64 t__2e957;
+	u64 t__2e958;
+	u64 t__2e959;
+	u64 t__2e963;
+	u64 t__2e964;
+	u64 t__2e971;
+	u64 t__2e976;
+	u64 t__2e982;
+	u64 t__2e983;
+	u64 t__2e984;
+	u64 t__2e985;
+	u64 t__2e989;
+	u64 t__2e990;
+	u64 t__2e997;
+	u64 t_abortsite_2e620;
+	u64 t_binding_2e1036;
+	u64 t_binding_2e1079;
+	u64 t_binding_2e1118;
+	u64 t_binding_2e1123;
+	u64 t_binding_2e1151;
+	u64 t_binding_2e1178;
+	u64 t_binding_2e1181;
+	u64 t_binding_2e1204;
+	u64 t_binding_2e1227;
+	u64 t_binding_2e1228;
+	u64 t_binding_2e1252;
+	u64 t_binding_2e1275;
+	u64 t_binding_2e1302;
+	u64 t_binding_2e542;
+	u64 t_binding_2e545;
+	u64 t_binding_2e580;
+	u64 t_binding_2e594;
+	u64 t_binding_2e630;
+	u64 t_binding_2e654;
+	u64 t_binding_2e678;
+	u64 t_binding_2e706;
+	u64 t_binding_2e734;
+	u64 t_binding_2e761;
+	u64 t_binding_2e809;
+	u64 t_binding_2e835;
+	u64 t_binding_2e859;
+	u64 t_binding_2e887;
+	u64 t_binding_2e911;
+	u64 t_binding_2e939;
+	u64 t_binding_2e965;
+	u64 t_binding_2e991;
+	u64 t_cleanup_2e627;
+	u64 t_cur__object_2e1101;
+	u64 t_cur__object_2e1135;
+	u64 t_cur__object_2e1162;
+	u64 t_cur__object_2e1188;
+	u64 t_cur__object_2e1211;
+	u64 t_cur__object_2e1236;
+	u64 t_cur__object_2e1259;
+	u64 t_cur__object_2e1286;
+	u64 t_cur__object_2e607;
+	u64 t_cur__object_2e643;
+	u64 t_cur__object_2e661;
+	u64 t_cur__object_2e689;
+	u64 t_cur__object_2e717;
+	u64 t_cur__object_2e744;
+	u64 t_cur__object_2e818;
+	u64 t_cur__object_2e842;
+	u64 t_cur__object_2e870;
+	u64 t_cur__object_2e894;
+	u64 t_cur__object_2e922;
+	u64 t_cur__val_2e1003;
+	u64 t_cur__val_2e1075;
+	u64 t_cur__val_2e1092;
+	u64 t_cur__val_2e1311;
+	u64 t_cur__val_2e951;
+	u64 t_cur__val_2e977;
+	u64 t_end_2e1050;
+	u64 t_end_2e1102;
+	u64 t_end_2e1136;
+	u64 t_end_2e1163;
+	u64 t_end_2e1189;
+	u64 t_end_2e1212;
+	u64 t_end_2e1237;
+	u64 t_end_2e1260;
+	u64 t_end_2e1287;
+	u64 t_end_2e608;
+	u64 t_end_2e644;
+	u64 t_end_2e662;
+	u64 t_end_2e690;
+	u64 t_end_2e718;
+	u64 t_end_2e745;
+	u64 t_end_2e768;
+	u64 t_end_2e819;
+	u64 t_end_2e843;
+	u64 t_end_2e871;
+	u64 t_end_2e895;
+	u64 t_end_2e923;
+	u64 t_item_2e1045;
+	u64 t_item_2e1121;
+	u64 t_item_2e1180;
+	u64 t_item_2e544;
+	u64 t_item_2e584;
+	u64 t_item_2e742;
+	u64 t_item_2e816;
+	u64 t_object_2e1042;
+	u64 t_object_2e1119;
+	u64 t_object_2e1308;
+	u64 t_object_2e1323;
+	u64 t_object_2e1330;
+	u64 t_object_2e1361;
+	u64 t_object_2e1365;
+	u64 t_object_2e1381;
+	u64 t_object_2e1385;
+	u64 t_object_2e1401;
+	u64 t_object_2e1405;
+	u64 t_object_2e1421;
+	u64 t_object_2e1425;
+	u64 t_object_2e1441;
+	u64 t_object_2e1445;
+	u64 t_object_2e1461;
+	u64 t_object_2e1465;
+	u64 t_object_2e1481;
+	u64 t_object_2e1485;
+	u64 t_object_2e600;
+	u64 t_object_2e636;
+	u64 t_object_2e740;
+	u64 t_object_2e815;
+	u64 t_ptr_2e1049;
+	u64 t_ptr_2e1100;
+	u64 t_ptr_2e1187;
+	u64 t_ptr_2e1210;
+	u64 t_ptr_2e1235;
+	u64 t_ptr_2e1258;
+	u64 t_ptr_2e1285;
+	u64 t_ptr_2e660;
+	u64 t_ptr_2e743;
+	u64 t_ptr_2e767;
+	u64 t_ptr_2e817;
+	u64 t_ptr_2e841;
+	u64 t_ptr_2e893;
+	u64 t_tag_2e1001;
+	u64 t_tag_2e1073;
+	u64 t_tag_2e1090;
+	u64 t_tag_2e1309;
+	u64 t_tag_2e1333;
+	u64 t_tag_2e1367;
+	u64 t_tag_2e1387;
+	u64 t_tag_2e1407;
+	u64 t_tag_2e1427;
+	u64 t_tag_2e1447;
+	u64 t_tag_2e1467;
+	u64 t_tag_2e1487;
+	u64 t_tag_2e949;
+	u64 t_tag_2e975;
+	u64 t_unpack_2e1004;
+	u64 t_unpack_2e1005;
+	u64 t_unpack_2e1052;
+	u64 t_unpack_2e770;
+	u64 t_unpack_2e771;
+	u64 t_valid_2e1051;
+	u64 t_valid_2e1103;
+	u64 t_valid_2e1137;
+	u64 t_valid_2e1164;
+	u64 t_valid_2e1190;
+	u64 t_valid_2e1213;
+	u64 t_valid_2e1238;
+	u64 t_valid_2e1261;
+	u64 t_valid_2e1288;
+	u64 t_valid_2e609;
+	u64 t_valid_2e645;
+	u64 t_valid_2e663;
+	u64 t_valid_2e691;
+	u64 t_valid_2e719;
+	u64 t_valid_2e746;
+	u64 t_valid_2e769;
+	u64 t_valid_2e820;
+	u64 t_valid_2e844;
+	u64 t_valid_2e872;
+	u64 t_valid_2e896;
+	u64 t_valid_2e924;
+	u64 t_value_2e1017;
+	u64 t_value_2e1028;
+	u64 t_value_2e1046;
+	u64 t_value_2e1047;
+	u64 t_value_2e1048;
+	u64 t_value_2e585;
+	u64 t_value_2e588;
+	u64 t_value_2e591;
+	u64 t_value_2e790;
+	u64 t_value_2e801;
+	L_start_2e538:;
+	t_binding_2e542 = (u64)A0;
+	t_binding_2e545 = (u64)A1;
+	t_binding_2e580 = (u64)A2;
+	t_binding_2e594 = (u64)A3;
+	t_object_2e600 = (u64)A4;
+	t_cur__object_2e607 = (u64)A5;
+	t_binding_2e630 = (u64)A6;
+	t_object_2e636 = (u64)A7;
+	t_cur__object_2e643 = (u64)A8;
+	t_binding_2e654 = (u64)A9;
+	t_cur__object_2e661 = (u64)A10;
+	t_binding_2e678 = (u64)A11;
+	t_cur__object_2e689 = (u64)A12;
+	t_binding_2e706 = (u64)A13;
+	t_cur__object_2e717 = (u64)A14;
+	t_binding_2e734 = (u64)A15;
+	t_object_2e740 = (u64)A16;
+	t_cur__object_2e744 = (u64)A17;
+	t_binding_2e761 = (u64)A18;
+	t_binding_2e809 = (u64)A19;
+	t_object_2e815 = (u64)A20;
+	t_cur__object_2e818 = (u64)A21;
+	t_binding_2e835 = (u64)A22;
+	t_cur__object_2e842 = (u64)A23;
+	t_binding_2e859 = (u64)A24;
+	t_cur__object_2e870 = (u64)A25;
+	t_binding_2e887 = (u64)A26;
+	t_cur__object_2e894 = (u64)A27;
+	t_binding_2e911 = (u64)A28;
+	t_cur__object_2e922 = (u64)A29;
+	t_binding_2e939 = (u64)A30;
+	t_binding_2e965 = (u64)A31;
+	t_binding_2e991 = (u64)A32;
+	t_binding_2e1036 = (u64)A33;
+	t_object_2e1042 = (u64)A34;
+	t_binding_2e1079 = (u64)A35;
+	t_cur__object_2e1101 = (u64)A36;
+	t_binding_2e1118 = (u64)A37;
+	t_object_2e1119 = (u64)A38;
+	t_binding_2e1123 = (u64)A39;
+	t_cur__object_2e1135 = (u64)A40;
+	t_binding_2e1151 = (u64)A41;
+	t_cur__object_2e1162 = (u64)A42;
+	t_binding_2e1178 = (u64)A43;
+	t_binding_2e1181 = (u64)A44;
+	t_cur__object_2e1188 = (u64)A45;
+	t_binding_2e1204 = (u64)A46;
+	t_cur__object_2e1211 = (u64)A47;
+	t_binding_2e1227 = (u64)A48;
+	t_binding_2e1228 = (u64)A49;
+	t_cur__object_2e1236 = (u64)A50;
+	t_binding_2e1252 = (u64)A51;
+	t_cur__object_2e1259 = (u64)A52;
+	t_binding_2e1275 = (u64)A53;
+	t__2e1281 = (u64)A54;
+	t__2e1282 = (u64)A55;
+	t_cur__object_2e1286 = (u64)A56;
+	t_binding_2e1302 = (u64)A57;
+	t_object_2e1308 = (u64)A58;
+	t_object_2e1323 = (u64)A59;
+	t_object_2e1330 = (u64)A60;
+	t_object_2e1361 = (u64)A61;
+	t_object_2e1365 = (u64)A62;
+	t_object_2e1381 = (u64)A63;
+	t_object_2e1385 = (u64)A64;
+	t_object_2e1401 = (u64)A65;
+	t_object_2e1405 = (u64)A66;
+	t_object_2e1421 = (u64)A67;
+	t_object_2e1425 = (u64)A68;
+	t_object_2e1441 = (u64)A69;
+	t_object_2e1445 = (u64)A70;
+	t_object_2e1461 = (u64)A71;
+	t_object_2e1465 = (u64)A72;
+	t_object_2e1481 = (u64)A73;
+	t_object_2e1485 = (u64)A74;
+	L_body_2e539:;
+	t_item_2e544 = (u64)((u64)t_binding_2e542 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e544 = (u32)((u64)1UL);
+	t_item_2e544 = (u64)((u64)t_binding_2e542 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e544 = (u32)((u64)2UL);
+	t_item_2e544 = (u64)((u64)t_binding_2e542 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e544 = (u32)((u64)3UL);
+	*(u64 *)t_binding_2e545 = (u64)((u64)0UL);
+	t__2e546 = (u64)((u64)t_binding_2e545 + (u64)((u64)8UL));
+	*(u64 *)t__2e546 = (u64)((u64)0UL);
+	t__2e546 = (u64)((u64)t__2e546 + (u64)((u64)8UL));
+	*(u64 *)t__2e546 = (u64)((u64)0UL);
+	t__2e547 = (u64)((u64)t_binding_2e545 + (u64)((u64)8UL));
+	t__2e548 = (u64)((u64)t_binding_2e545 + (u64)((u64)16UL));
+	t__2e549 = (u64)(*(u64 *)t__2e547);
+	t__2e550 = (u64)((u64)t__2e549 + (u64)((u64)1UL));
+	*(u64 *)t__2e547 = (u64)t__2e550;
+	t__2e552 = (u64)(*(u64 *)t__2e548);
+	t__2e555 = (u64)(u32)(((u64)t__2e550 <= (u64)t__2e552));
+	if ((u32)t__2e555) goto L__2e553; else goto L__2e554;
+	L__2e554:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e545, (u64)((u64)4UL));
+	goto L__2e553;
+	L__2e553:;
+	t__2e556 = (u64)(*(u64 *)t_binding_2e545);
+	t__2e551 = (u64)((u64)t__2e549 * (u64)((u64)4UL));
+	t__2e551 = (u64)((u64)t__2e556 + (u64)t__2e551);
+	t__2e557 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e551 = (u32)((u64)1UL);
+	t__2e558 = (u64)((u64)t_binding_2e545 + (u64)((u64)8UL));
+	t__2e559 = (u64)((u64)t_binding_2e545 + (u64)((u64)16UL));
+	t__2e560 = (u64)(*(u64 *)t__2e558);
+	t__2e561 = (u64)((u64)t__2e560 + (u64)((u64)1UL));
+	*(u64 *)t__2e558 = (u64)t__2e561;
+	t__2e563 = (u64)(*(u64 *)t__2e559);
+	t__2e566 = (u64)(u32)(((u64)t__2e561 <= (u64)t__2e563));
+	if ((u32)t__2e566) goto L__2e564; else goto L__2e565;
+	L__2e565:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e545, (u64)((u64)4UL));
+	goto L__2e564;
+	L__2e564:;
+	t__2e567 = (u64)(*(u64 *)t_binding_2e545);
+	t__2e562 = (u64)((u64)t__2e560 * (u64)((u64)4UL));
+	t__2e562 = (u64)((u64)t__2e567 + (u64)t__2e562);
+	t__2e568 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e562 = (u32)((u64)2UL);
+	t__2e569 = (u64)((u64)t_binding_2e545 + (u64)((u64)8UL));
+	t__2e570 = (u64)((u64)t_binding_2e545 + (u64)((u64)16UL));
+	t__2e571 = (u64)(*(u64 *)t__2e569);
+	t__2e572 = (u64)((u64)t__2e571 + (u64)((u64)1UL));
+	*(u64 *)t__2e569 = (u64)t__2e572;
+	t__2e574 = (u64)(*(u64 *)t__2e570);
+	t__2e577 = (u64)(u32)(((u64)t__2e572 <= (u64)t__2e574));
+	if ((u32)t__2e577) goto L__2e575; else goto L__2e576;
+	L__2e576:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e545, (u64)((u64)4UL));
+	goto L__2e575;
+	L__2e575:;
+	t__2e578 = (u64)(*(u64 *)t_binding_2e545);
+	t__2e573 = (u64)((u64)t__2e571 * (u64)((u64)4UL));
+	t__2e573 = (u64)((u64)t__2e578 + (u64)t__2e573);
+	t__2e579 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e573 = (u32)((u64)3UL);
+	t_item_2e584 = (u64)((u64)t_binding_2e580 + (u64)((u64)0UL));
+	t_value_2e585 = (u64)((u64)t_item_2e584 + (u64)((u64)0UL));
+	BLIT(t_value_2e585, ((u64)((char *)&D_strliteral_2e587)), ((u64)24UL));
+	t_value_2e585 = (u64)((u64)t_item_2e584 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e585 = (u32)((u64)1UL);
+	t_item_2e584 = (u64)((u64)t_binding_2e580 + (u64)((u64)32UL));
+	t_value_2e588 = (u64)((u64)t_item_2e584 + (u64)((u64)0UL));
+	BLIT(t_value_2e588, ((u64)((char *)&D_strliteral_2e590)), ((u64)24UL));
+	t_value_2e588 = (u64)((u64)t_item_2e584 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e588 = (u32)((u64)2UL);
+	t_item_2e584 = (u64)((u64)t_binding_2e580 + (u64)((u64)64UL));
+	t_value_2e591 = (u64)((u64)t_item_2e584 + (u64)((u64)0UL));
+	BLIT(t_value_2e591, ((u64)((char *)&D_strliteral_2e593)), ((u64)24UL));
+	t_value_2e591 = (u64)((u64)t_item_2e584 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e591 = (u32)((u64)3UL);
+	*(u32 *)t_binding_2e594 = (u32)((u64)1UL);
+	*(u64 *)t_object_2e600 = (u64)((u64)0UL);
+	t__2e601 = (u64)((u64)t_object_2e600 + (u64)((u64)8UL));
+	*(u64 *)t__2e601 = (u64)((u64)0UL);
+	t__2e601 = (u64)((u64)t__2e601 + (u64)((u64)8UL));
+	*(u64 *)t__2e601 = (u64)((u64)0UL);
+	t__2e603 = (u64)((u64)t_object_2e600 + (u64)((u64)8UL));
+	t__2e604 = (u64)((u64)t_object_2e600 + (u64)((u64)16UL));
+	t__2e605 = (u64)(*(u64 *)t_object_2e600);
+	t__2e606 = (u64)(*(u64 *)t__2e603);
+	t_end_2e608 = (u64)((u64)t__2e606 * (u64)((u64)4UL));
+	t_end_2e608 = (u64)((u64)t__2e605 + (u64)t_end_2e608);
+	L_loop_2e595:;
+	t_valid_2e609 = (u64)(u32)(((u64)t__2e605 < (u64)t_end_2e608));
+	if ((u32)t_valid_2e609) goto L_valid_2e597; else goto L__2e598;
+	L_valid_2e597:;
+	t__2e610 = (u64)(u32)(*(i32 *)t__2e605);
+	*(u32 *)t_cur__object_2e607 = (u32)t__2e610;
+	L_body_2e596:;
+	t__2e613 = (u64)(u32)(*(i32 *)t_binding_2e594);
+	t__2e613 = (u64)(u32)((u32)t__2e613 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e594 = (u32)t__2e613;
+	goto L__2e611;
+	L__2e614:;
+	L__2e611:;
+	L_after_2e599:;
+	t__2e605 = (u64)((u64)t__2e605 + (u64)((u64)4UL));
+	goto L_loop_2e595;
+	L__2e598:;
+	t__2e618 = (u64)(u32)(*(i32 *)t_binding_2e594);
+	t__2e617 = (u64)(u32)(((u32)t__2e618 == (u32)((u64)1UL)));
+	if ((u32)t__2e617) goto L_passed_2e616; else goto L_failed_2e615;
+	L_failed_2e615:;
+	t_abortsite_2e620 = ((u64)0UL);
+	goto L_abort_2e621;
+	L_passed_2e616:;
+	*(u32 *)t_binding_2e630 = (u32)((u64)1UL);
+	*(u64 *)t_object_2e636 = (u64)((u64)0UL);
+	t__2e637 = (u64)((u64)t_object_2e636 + (u64)((u64)8UL));
+	*(u64 *)t__2e637 = (u64)((u64)0UL);
+	t__2e637 = (u64)((u64)t__2e637 + (u64)((u64)8UL));
+	*(u64 *)t__2e637 = (u64)((u64)0UL);
+	t__2e639 = (u64)((u64)t_object_2e636 + (u64)((u64)8UL));
+	t__2e640 = (u64)((u64)t_object_2e636 + (u64)((u64)16UL));
+	t__2e641 = (u64)(*(u64 *)t_object_2e636);
+	t__2e642 = (u64)(*(u64 *)t__2e639);
+	t_end_2e644 = (u64)((u64)t__2e642 * (u64)((u64)4UL));
+	t_end_2e644 = (u64)((u64)t__2e641 + (u64)t_end_2e644);
+	L_loop_2e631:;
+	t_valid_2e645 = (u64)(u32)(((u64)t__2e641 < (u64)t_end_2e644));
+	if ((u32)t_valid_2e645) goto L_valid_2e633; else goto L__2e634;
+	L_valid_2e633:;
+	*(u64 *)t_cur__object_2e643 = (u64)t__2e641;
+	L_body_2e632:;
+	t__2e648 = (u64)(u32)(*(i32 *)t_binding_2e630);
+	t__2e648 = (u64)(u32)((u32)t__2e648 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e630 = (u32)t__2e648;
+	goto L__2e646;
+	L__2e649:;
+	L__2e646:;
+	L_after_2e635:;
+	t__2e641 = (u64)((u64)t__2e641 + (u64)((u64)4UL));
+	goto L_loop_2e631;
+	L__2e634:;
+	t__2e653 = (u64)(u32)(*(i32 *)t_binding_2e630);
+	t__2e652 = (u64)(u32)(((u32)t__2e653 == (u32)((u64)1UL)));
+	if ((u32)t__2e652) goto L_passed_2e651; else goto L_failed_2e650;
+	L_failed_2e650:;
+	t_abortsite_2e620 = ((u64)1UL);
+	goto L_abort_2e621;
+	L_passed_2e651:;
+	*(u32 *)t_binding_2e654 = (u32)((u64)1UL);
+	t_ptr_2e660 = t_binding_2e542;
+	t_end_2e662 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t_end_2e662 = (u64)((u64)t_ptr_2e660 + (u64)t_end_2e662);
+	L_loop_2e655:;
+	t_valid_2e663 = (u64)(u32)(((u64)t_ptr_2e660 < (u64)t_end_2e662));
+	if ((u32)t_valid_2e663) goto L_valid_2e657; else goto L__2e658;
+	L_valid_2e657:;
+	t__2e664 = (u64)(u32)(*(i32 *)t_ptr_2e660);
+	*(u32 *)t_cur__object_2e661 = (u32)t__2e664;
+	L_body_2e656:;
+	t__2e670 = (u64)(u32)(*(i32 *)t_cur__object_2e661);
+	t__2e671 = (u64)(u32)(*(i32 *)t_binding_2e654);
+	t__2e669 = (u64)(u32)(((u32)t__2e670 == (u32)t__2e671));
+	if ((u32)t__2e669) goto L_passed_2e668; else goto L_failed_2e667;
+	L_failed_2e667:;
+	t_abortsite_2e620 = ((u64)2UL);
+	goto L_abort_2e621;
+	L_passed_2e668:;
+	t__2e672 = (u64)(u32)(*(i32 *)t_binding_2e654);
+	t__2e672 = (u64)(u32)((u32)t__2e672 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e654 = (u32)t__2e672;
+	goto L__2e665;
+	L__2e673:;
+	L__2e665:;
+	L_after_2e659:;
+	t_ptr_2e660 = (u64)((u64)t_ptr_2e660 + (u64)((u64)4UL));
+	goto L_loop_2e655;
+	L__2e658:;
+	t__2e677 = (u64)(u32)(*(i32 *)t_binding_2e654);
+	t__2e676 = (u64)(u32)(((u32)t__2e677 == (u32)((u64)4UL)));
+	if ((u32)t__2e676) goto L_passed_2e675; else goto L_failed_2e674;
+	L_failed_2e674:;
+	t_abortsite_2e620 = ((u64)3UL);
+	goto L_abort_2e621;
+	L_passed_2e675:;
+	*(u32 *)t_binding_2e678 = (u32)((u64)1UL);
+	t__2e685 = (u64)((u64)t_binding_2e545 + (u64)((u64)8UL));
+	t__2e686 = (u64)((u64)t_binding_2e545 + (u64)((u64)16UL));
+	t__2e687 = (u64)(*(u64 *)t_binding_2e545);
+	t__2e688 = (u64)(*(u64 *)t__2e685);
+	t_end_2e690 = (u64)((u64)t__2e688 * (u64)((u64)4UL));
+	t_end_2e690 = (u64)((u64)t__2e687 + (u64)t_end_2e690);
+	L_loop_2e679:;
+	t_valid_2e691 = (u64)(u32)(((u64)t__2e687 < (u64)t_end_2e690));
+	if ((u32)t_valid_2e691) goto L_valid_2e681; else goto L__2e682;
+	L_valid_2e681:;
+	t__2e692 = (u64)(u32)(*(i32 *)t__2e687);
+	*(u32 *)t_cur__object_2e689 = (u32)t__2e692;
+	L_body_2e680:;
+	t__2e698 = (u64)(u32)(*(i32 *)t_cur__object_2e689);
+	t__2e699 = (u64)(u32)(*(i32 *)t_binding_2e678);
+	t__2e697 = (u64)(u32)(((u32)t__2e698 == (u32)t__2e699));
+	if ((u32)t__2e697) goto L_passed_2e696; else goto L_failed_2e695;
+	L_failed_2e695:;
+	t_abortsite_2e620 = ((u64)4UL);
+	goto L_abort_2e621;
+	L_passed_2e696:;
+	t__2e700 = (u64)(u32)(*(i32 *)t_binding_2e678);
+	t__2e700 = (u64)(u32)((u32)t__2e700 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e678 = (u32)t__2e700;
+	goto L__2e693;
+	L__2e701:;
+	L__2e693:;
+	L_after_2e683:;
+	t__2e687 = (u64)((u64)t__2e687 + (u64)((u64)4UL));
+	goto L_loop_2e679;
+	L__2e682:;
+	t__2e705 = (u64)(u32)(*(i32 *)t_binding_2e678);
+	t__2e704 = (u64)(u32)(((u32)t__2e705 == (u32)((u64)4UL)));
+	if ((u32)t__2e704) goto L_passed_2e703; else goto L_failed_2e702;
+	L_failed_2e702:;
+	t_abortsite_2e620 = ((u64)5UL);
+	goto L_abort_2e621;
+	L_passed_2e703:;
+	*(u32 *)t_binding_2e706 = (u32)((u64)1UL);
+	t__2e713 = (u64)((u64)t_binding_2e545 + (u64)((u64)8UL));
+	t__2e714 = (u64)((u64)t_binding_2e545 + (u64)((u64)16UL));
+	t__2e715 = (u64)(*(u64 *)t_binding_2e545);
+	t__2e716 = (u64)(*(u64 *)t__2e713);
+	t_end_2e718 = (u64)((u64)t__2e716 * (u64)((u64)4UL));
+	t_end_2e718 = (u64)((u64)t__2e715 + (u64)t_end_2e718);
+	L_loop_2e707:;
+	t_valid_2e719 = (u64)(u32)(((u64)t__2e715 < (u64)t_end_2e718));
+	if ((u32)t_valid_2e719) goto L_valid_2e709; else goto L__2e710;
+	L_valid_2e709:;
+	t__2e720 = (u64)(u32)(*(i32 *)t__2e715);
+	*(u32 *)t_cur__object_2e717 = (u32)t__2e720;
+	L_body_2e708:;
+	t__2e726 = (u64)(u32)(*(i32 *)t_cur__object_2e717);
+	t__2e727 = (u64)(u32)(*(i32 *)t_binding_2e706);
+	t__2e725 = (u64)(u32)(((u32)t__2e726 == (u32)t__2e727));
+	if ((u32)t__2e725) goto L_passed_2e724; else goto L_failed_2e723;
+	L_failed_2e723:;
+	t_abortsite_2e620 = ((u64)6UL);
+	goto L_abort_2e621;
+	L_passed_2e724:;
+	t__2e728 = (u64)(u32)(*(i32 *)t_binding_2e706);
+	t__2e728 = (u64)(u32)((u32)t__2e728 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e706 = (u32)t__2e728;
+	goto L__2e721;
+	L__2e729:;
+	L__2e721:;
+	L_after_2e711:;
+	t__2e715 = (u64)((u64)t__2e715 + (u64)((u64)4UL));
+	goto L_loop_2e707;
+	L__2e710:;
+	t__2e733 = (u64)(u32)(*(i32 *)t_binding_2e706);
+	t__2e732 = (u64)(u32)(((u32)t__2e733 == (u32)((u64)4UL)));
+	if ((u32)t__2e732) goto L_passed_2e731; else goto L_failed_2e730;
+	L_failed_2e730:;
+	t_abortsite_2e620 = ((u64)7UL);
+	goto L_abort_2e621;
+	L_passed_2e731:;
+	*(u32 *)t_binding_2e734 = (u32)((u64)1UL);
+	t_item_2e742 = (u64)((u64)t_object_2e740 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e742 = (u32)((u64)1UL);
+	t_item_2e742 = (u64)((u64)t_object_2e740 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e742 = (u32)((u64)2UL);
+	t_item_2e742 = (u64)((u64)t_object_2e740 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e742 = (u32)((u64)3UL);
+	t_ptr_2e743 = t_object_2e740;
+	t_end_2e745 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t_end_2e745 = (u64)((u64)t_ptr_2e743 + (u64)t_end_2e745);
+	L_loop_2e735:;
+	t_valid_2e746 = (u64)(u32)(((u64)t_ptr_2e743 < (u64)t_end_2e745));
+	if ((u32)t_valid_2e746) goto L_valid_2e737; else goto L__2e738;
+	L_valid_2e737:;
+	t__2e747 = (u64)(u32)(*(u32 *)t_ptr_2e743);
+	*(u32 *)t_cur__object_2e744 = (u32)t__2e747;
+	L_body_2e736:;
+	t__2e753 = (u64)(u32)(*(u32 *)t_cur__object_2e744);
+	t__2e754 = (u64)(u32)(*(u32 *)t_binding_2e734);
+	t__2e752 = (u64)(u32)(((u32)t__2e753 == (u32)t__2e754));
+	if ((u32)t__2e752) goto L_passed_2e751; else goto L_failed_2e750;
+	L_failed_2e750:;
+	t_abortsite_2e620 = ((u64)8UL);
+	goto L_abort_2e621;
+	L_passed_2e751:;
+	t__2e755 = (u64)(u32)(*(u32 *)t_binding_2e734);
+	t__2e755 = (u64)(u32)((u32)t__2e755 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e734 = (u32)t__2e755;
+	goto L__2e748;
+	L__2e756:;
+	L__2e748:;
+	L_after_2e739:;
+	t_ptr_2e743 = (u64)((u64)t_ptr_2e743 + (u64)((u64)4UL));
+	goto L_loop_2e735;
+	L__2e738:;
+	t__2e760 = (u64)(u32)(*(u32 *)t_binding_2e734);
+	t__2e759 = (u64)(u32)(((u32)t__2e760 == (u32)((u64)4UL)));
+	if ((u32)t__2e759) goto L_passed_2e758; else goto L_failed_2e757;
+	L_failed_2e757:;
+	t_abortsite_2e620 = ((u64)9UL);
+	goto L_abort_2e621;
+	L_passed_2e758:;
+	*(u32 *)t_binding_2e761 = (u32)((u64)0UL);
+	t_ptr_2e767 = t_binding_2e580;
+	t_end_2e768 = (u64)((u64)((u64)3UL) * (u64)((u64)32UL));
+	t_end_2e768 = (u64)((u64)t_ptr_2e767 + (u64)t_end_2e768);
+	L_loop_2e762:;
+	t_valid_2e769 = (u64)(u32)(((u64)t_ptr_2e767 < (u64)t_end_2e768));
+	if ((u32)t_valid_2e769) goto L_valid_2e764; else goto L__2e765;
+	L_valid_2e764:;
+	t_unpack_2e770 = (u64)((u64)t_ptr_2e767 + (u64)((u64)0UL));
+	t_unpack_2e771 = (u64)((u64)t_ptr_2e767 + (u64)((u64)24UL));
+	L_body_2e763:;
+	t__2e778 = (u64)(u32)(*(i32 *)t_binding_2e761);
+	t__2e779 = (u64)((i64)(i32)t__2e778);
+	t__2e777 = (u64)((u64)t__2e779 * (u64)((u64)32UL));
+	t__2e777 = (u64)((u64)t_binding_2e580 + (u64)t__2e777);
+	t__2e780 = (u64)(u32)(((u64)t__2e779 < (u64)((u64)3UL)));
+	if ((u32)t__2e780) goto L__2e782; else goto L__2e781;
+	L__2e781:;
+	t_abortsite_2e620 = ((u64)10UL);
+	goto L_abort_2e783;
+	L__2e782:;
+	t_value_2e790 = (u64)((u64)t__2e777 + (u64)((u64)0UL));
+	BLIT((u64)B75, t_unpack_2e770, 24);
+	BLIT((u64)B76, t_value_2e790, 24);
+	t__2e776 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B75, (u64)B76));
+	if ((u32)t__2e776) goto L_passed_2e775; else goto L_failed_2e774;
+	L_failed_2e774:;
+	t_abortsite_2e620 = ((u64)11UL);
+	goto L_abort_2e621;
+	L_passed_2e775:;
+	t__2e794 = (u64)(u32)(*(i32 *)t_unpack_2e771);
+	t__2e796 = (u64)(u32)(*(i32 *)t_binding_2e761);
+	t__2e797 = (u64)((i64)(i32)t__2e796);
+	t__2e795 = (u64)((u64)t__2e797 * (u64)((u64)32UL));
+	t__2e795 = (u64)((u64)t_binding_2e580 + (u64)t__2e795);
+	t__2e798 = (u64)(u32)(((u64)t__2e797 < (u64)((u64)3UL)));
+	if ((u32)t__2e798) goto L__2e800; else goto L__2e799;
+	L__2e799:;
+	t_abortsite_2e620 = ((u64)12UL);
+	goto L_abort_2e783;
+	L__2e800:;
+	t_value_2e801 = (u64)((u64)t__2e795 + (u64)((u64)24UL));
+	t__2e802 = (u64)(u32)(*(i32 *)t_value_2e801);
+	t__2e793 = (u64)(u32)(((u32)t__2e794 == (u32)t__2e802));
+	if ((u32)t__2e793) goto L_passed_2e792; else goto L_failed_2e791;
+	L_failed_2e791:;
+	t_abortsite_2e620 = ((u64)13UL);
+	goto L_abort_2e621;
+	L_passed_2e792:;
+	t__2e803 = (u64)(u32)(*(i32 *)t_binding_2e761);
+	t__2e803 = (u64)(u32)((u32)t__2e803 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e761 = (u32)t__2e803;
+	goto L__2e772;
+	L__2e804:;
+	L__2e772:;
+	L_after_2e766:;
+	t_ptr_2e767 = (u64)((u64)t_ptr_2e767 + (u64)((u64)32UL));
+	goto L_loop_2e762;
+	L__2e765:;
+	t__2e808 = (u64)(u32)(*(i32 *)t_binding_2e761);
+	t__2e807 = (u64)(u32)(((u32)t__2e808 == (u32)((u64)3UL)));
+	if ((u32)t__2e807) goto L_passed_2e806; else goto L_failed_2e805;
+	L_failed_2e805:;
+	t_abortsite_2e620 = ((u64)14UL);
+	goto L_abort_2e621;
+	L_passed_2e806:;
+	*(u32 *)t_binding_2e809 = (u32)((u64)1UL);
+	t_item_2e816 = (u64)((u64)t_object_2e815 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e816 = (u32)((u64)1UL);
+	t_item_2e816 = (u64)((u64)t_object_2e815 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e816 = (u32)((u64)2UL);
+	t_item_2e816 = (u64)((u64)t_object_2e815 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e816 = (u32)((u64)3UL);
+	t_ptr_2e817 = t_object_2e815;
+	t_end_2e819 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t_end_2e819 = (u64)((u64)t_ptr_2e817 + (u64)t_end_2e819);
+	L_loop_2e810:;
+	t_valid_2e820 = (u64)(u32)(((u64)t_ptr_2e817 < (u64)t_end_2e819));
+	if ((u32)t_valid_2e820) goto L_valid_2e812; else goto L__2e813;
+	L_valid_2e812:;
+	*(u64 *)t_cur__object_2e818 = (u64)t_ptr_2e817;
+	L_body_2e811:;
+	t__2e826 = (u64)(*(u64 *)t_cur__object_2e818);
+	t__2e827 = (u64)(u32)(*(u32 *)t__2e826);
+	t__2e828 = (u64)(u32)(*(u32 *)t_binding_2e809);
+	t__2e825 = (u64)(u32)(((u32)t__2e827 == (u32)t__2e828));
+	if ((u32)t__2e825) goto L_passed_2e824; else goto L_failed_2e823;
+	L_failed_2e823:;
+	t_abortsite_2e620 = ((u64)15UL);
+	goto L_abort_2e621;
+	L_passed_2e824:;
+	t__2e829 = (u64)(u32)(*(u32 *)t_binding_2e809);
+	t__2e829 = (u64)(u32)((u32)t__2e829 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e809 = (u32)t__2e829;
+	goto L__2e821;
+	L__2e830:;
+	L__2e821:;
+	L_after_2e814:;
+	t_ptr_2e817 = (u64)((u64)t_ptr_2e817 + (u64)((u64)4UL));
+	goto L_loop_2e810;
+	L__2e813:;
+	t__2e834 = (u64)(u32)(*(u32 *)t_binding_2e809);
+	t__2e833 = (u64)(u32)(((u32)t__2e834 == (u32)((u64)4UL)));
+	if ((u32)t__2e833) goto L_passed_2e832; else goto L_failed_2e831;
+	L_failed_2e831:;
+	t_abortsite_2e620 = ((u64)16UL);
+	goto L_abort_2e621;
+	L_passed_2e832:;
+	*(u32 *)t_binding_2e835 = (u32)((u64)1UL);
+	t_ptr_2e841 = t_binding_2e542;
+	t_end_2e843 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t_end_2e843 = (u64)((u64)t_ptr_2e841 + (u64)t_end_2e843);
+	L_loop_2e836:;
+	t_valid_2e844 = (u64)(u32)(((u64)t_ptr_2e841 < (u64)t_end_2e843));
+	if ((u32)t_valid_2e844) goto L_valid_2e838; else goto L__2e839;
+	L_valid_2e838:;
+	*(u64 *)t_cur__object_2e842 = (u64)t_ptr_2e841;
+	L_body_2e837:;
+	t__2e850 = (u64)(*(u64 *)t_cur__object_2e842);
+	t__2e851 = (u64)(u32)(*(i32 *)t__2e850);
+	t__2e852 = (u64)(u32)(*(i32 *)t_binding_2e835);
+	t__2e849 = (u64)(u32)(((u32)t__2e851 == (u32)t__2e852));
+	if ((u32)t__2e849) goto L_passed_2e848; else goto L_failed_2e847;
+	L_failed_2e847:;
+	t_abortsite_2e620 = ((u64)17UL);
+	goto L_abort_2e621;
+	L_passed_2e848:;
+	t__2e853 = (u64)(u32)(*(i32 *)t_binding_2e835);
+	t__2e853 = (u64)(u32)((u32)t__2e853 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e835 = (u32)t__2e853;
+	goto L__2e845;
+	L__2e854:;
+	L__2e845:;
+	L_after_2e840:;
+	t_ptr_2e841 = (u64)((u64)t_ptr_2e841 + (u64)((u64)4UL));
+	goto L_loop_2e836;
+	L__2e839:;
+	t__2e858 = (u64)(u32)(*(i32 *)t_binding_2e835);
+	t__2e857 = (u64)(u32)(((u32)t__2e858 == (u32)((u64)4UL)));
+	if ((u32)t__2e857) goto L_passed_2e856; else goto L_failed_2e855;
+	L_failed_2e855:;
+	t_abortsite_2e620 = ((u64)18UL);
+	goto L_abort_2e621;
+	L_passed_2e856:;
+	*(u32 *)t_binding_2e859 = (u32)((u64)1UL);
+	t__2e866 = (u64)((u64)t_binding_2e545 + (u64)((u64)8UL));
+	t__2e867 = (u64)((u64)t_binding_2e545 + (u64)((u64)16UL));
+	t__2e868 = (u64)(*(u64 *)t_binding_2e545);
+	t__2e869 = (u64)(*(u64 *)t__2e866);
+	t_end_2e871 = (u64)((u64)t__2e869 * (u64)((u64)4UL));
+	t_end_2e871 = (u64)((u64)t__2e868 + (u64)t_end_2e871);
+	L_loop_2e860:;
+	t_valid_2e872 = (u64)(u32)(((u64)t__2e868 < (u64)t_end_2e871));
+	if ((u32)t_valid_2e872) goto L_valid_2e862; else goto L__2e863;
+	L_valid_2e862:;
+	*(u64 *)t_cur__object_2e870 = (u64)t__2e868;
+	L_body_2e861:;
+	t__2e878 = (u64)(*(u64 *)t_cur__object_2e870);
+	t__2e879 = (u64)(u32)(*(i32 *)t__2e878);
+	t__2e880 = (u64)(u32)(*(i32 *)t_binding_2e859);
+	t__2e877 = (u64)(u32)(((u32)t__2e879 == (u32)t__2e880));
+	if ((u32)t__2e877) goto L_passed_2e876; else goto L_failed_2e875;
+	L_failed_2e875:;
+	t_abortsite_2e620 = ((u64)19UL);
+	goto L_abort_2e621;
+	L_passed_2e876:;
+	t__2e881 = (u64)(u32)(*(i32 *)t_binding_2e859);
+	t__2e881 = (u64)(u32)((u32)t__2e881 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e859 = (u32)t__2e881;
+	goto L__2e873;
+	L__2e882:;
+	L__2e873:;
+	L_after_2e864:;
+	t__2e868 = (u64)((u64)t__2e868 + (u64)((u64)4UL));
+	goto L_loop_2e860;
+	L__2e863:;
+	t__2e886 = (u64)(u32)(*(i32 *)t_binding_2e859);
+	t__2e885 = (u64)(u32)(((u32)t__2e886 == (u32)((u64)4UL)));
+	if ((u32)t__2e885) goto L_passed_2e884; else goto L_failed_2e883;
+	L_failed_2e883:;
+	t_abortsite_2e620 = ((u64)20UL);
+	goto L_abort_2e621;
+	L_passed_2e884:;
+	*(u32 *)t_binding_2e887 = (u32)((u64)1UL);
+	t_ptr_2e893 = t_binding_2e542;
+	t_end_2e895 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t_end_2e895 = (u64)((u64)t_ptr_2e893 + (u64)t_end_2e895);
+	L_loop_2e888:;
+	t_valid_2e896 = (u64)(u32)(((u64)t_ptr_2e893 < (u64)t_end_2e895));
+	if ((u32)t_valid_2e896) goto L_valid_2e890; else goto L__2e891;
+	L_valid_2e890:;
+	*(u64 *)t_cur__object_2e894 = (u64)t_ptr_2e893;
+	L_body_2e889:;
+	t__2e902 = (u64)(*(u64 *)t_cur__object_2e894);
+	t__2e903 = (u64)(u32)(*(i32 *)t__2e902);
+	t__2e904 = (u64)(u32)(*(i32 *)t_binding_2e887);
+	t__2e901 = (u64)(u32)(((u32)t__2e903 == (u32)t__2e904));
+	if ((u32)t__2e901) goto L_passed_2e900; else goto L_failed_2e899;
+	L_failed_2e899:;
+	t_abortsite_2e620 = ((u64)21UL);
+	goto L_abort_2e621;
+	L_passed_2e900:;
+	t__2e905 = (u64)(u32)(*(i32 *)t_binding_2e887);
+	t__2e905 = (u64)(u32)((u32)t__2e905 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e887 = (u32)t__2e905;
+	goto L__2e897;
+	L__2e906:;
+	L__2e897:;
+	L_after_2e892:;
+	t_ptr_2e893 = (u64)((u64)t_ptr_2e893 + (u64)((u64)4UL));
+	goto L_loop_2e888;
+	L__2e891:;
+	t__2e910 = (u64)(u32)(*(i32 *)t_binding_2e887);
+	t__2e909 = (u64)(u32)(((u32)t__2e910 == (u32)((u64)4UL)));
+	if ((u32)t__2e909) goto L_passed_2e908; else goto L_failed_2e907;
+	L_failed_2e907:;
+	t_abortsite_2e620 = ((u64)22UL);
+	goto L_abort_2e621;
+	L_passed_2e908:;
+	*(u32 *)t_binding_2e911 = (u32)((u64)1UL);
+	t__2e918 = (u64)((u64)t_binding_2e545 + (u64)((u64)8UL));
+	t__2e919 = (u64)((u64)t_binding_2e545 + (u64)((u64)16UL));
+	t__2e920 = (u64)(*(u64 *)t_binding_2e545);
+	t__2e921 = (u64)(*(u64 *)t__2e918);
+	t_end_2e923 = (u64)((u64)t__2e921 * (u64)((u64)4UL));
+	t_end_2e923 = (u64)((u64)t__2e920 + (u64)t_end_2e923);
+	L_loop_2e912:;
+	t_valid_2e924 = (u64)(u32)(((u64)t__2e920 < (u64)t_end_2e923));
+	if ((u32)t_valid_2e924) goto L_valid_2e914; else goto L__2e915;
+	L_valid_2e914:;
+	*(u64 *)t_cur__object_2e922 = (u64)t__2e920;
+	L_body_2e913:;
+	t__2e930 = (u64)(*(u64 *)t_cur__object_2e922);
+	t__2e931 = (u64)(u32)(*(i32 *)t__2e930);
+	t__2e932 = (u64)(u32)(*(i32 *)t_binding_2e911);
+	t__2e929 = (u64)(u32)(((u32)t__2e931 == (u32)t__2e932));
+	if ((u32)t__2e929) goto L_passed_2e928; else goto L_failed_2e927;
+	L_failed_2e927:;
+	t_abortsite_2e620 = ((u64)23UL);
+	goto L_abort_2e621;
+	L_passed_2e928:;
+	t__2e933 = (u64)(u32)(*(i32 *)t_binding_2e911);
+	t__2e933 = (u64)(u32)((u32)t__2e933 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e911 = (u32)t__2e933;
+	goto L__2e925;
+	L__2e934:;
+	L__2e925:;
+	L_after_2e916:;
+	t__2e920 = (u64)((u64)t__2e920 + (u64)((u64)4UL));
+	goto L_loop_2e912;
+	L__2e915:;
+	t__2e938 = (u64)(u32)(*(i32 *)t_binding_2e911);
+	t__2e937 = (u64)(u32)(((u32)t__2e938 == (u32)((u64)4UL)));
+	if ((u32)t__2e937) goto L_passed_2e936; else goto L_failed_2e935;
+	L_failed_2e935:;
+	t_abortsite_2e620 = ((u64)24UL);
+	goto L_abort_2e621;
+	L_passed_2e936:;
+	*(u32 *)t_binding_2e939 = (u32)((u64)1UL);
+	L_loop_2e940:;
+	t__2e945 = ((u64 (*)(u64))((u64)((char *)&F_foreach__next)))((u64)R77);
+	t_tag_2e949 = (u64)(u32)(*(u32 *)t__2e945);
+	t__2e950 = (u64)(u32)(((u32)t_tag_2e949 == (u32)((u64)3950255460UL)));
+	if ((u32)t__2e950) goto L__2e943; else goto L_valid_2e942;
+	L_valid_2e942:;
+	t_cur__val_2e951 = (u64)((u64)t__2e945 + (u64)((u64)4UL));
+	L_body_2e941:;
+	t__2e957 = (u64)(u32)(*(i32 *)t_cur__val_2e951);
+	t__2e958 = (u64)(u32)(*(i32 *)t_binding_2e939);
+	t__2e956 = (u64)(u32)(((u32)t__2e957 == (u32)t__2e958));
+	if ((u32)t__2e956) goto L_passed_2e955; else goto L_failed_2e954;
+	L_failed_2e954:;
+	t_abortsite_2e620 = ((u64)25UL);
+	goto L_abort_2e621;
+	L_passed_2e955:;
+	t__2e959 = (u64)(u32)(*(i32 *)t_binding_2e939);
+	t__2e959 = (u64)(u32)((u32)t__2e959 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e939 = (u32)t__2e959;
+	goto L__2e952;
+	L__2e960:;
+	L__2e952:;
+	L_after_2e944:;
+	goto L_loop_2e940;
+	L__2e943:;
+	t__2e964 = (u64)(u32)(*(i32 *)t_binding_2e939);
+	t__2e963 = (u64)(u32)(((u32)t__2e964 == (u32)((u64)5UL)));
+	if ((u32)t__2e963) goto L_passed_2e962; else goto L_failed_2e961;
+	L_failed_2e961:;
+	t_abortsite_2e620 = ((u64)26UL);
+	goto L_abort_2e621;
+	L_passed_2e962:;
+	*(u32 *)t_binding_2e965 = (u32)((u64)1UL);
+	L_loop_2e966:;
+	t__2e971 = ((u64 (*)(u64))((u64)((char *)&F_foreach__next__alias)))((u64)R78);
+	t_tag_2e975 = (u64)(u32)(*(u32 *)t__2e971);
+	t__2e976 = (u64)(u32)(((u32)t_tag_2e975 == (u32)((u64)3950255460UL)));
+	if ((u32)t__2e976) goto L__2e969; else goto L_valid_2e968;
+	L_valid_2e968:;
+	t_cur__val_2e977 = (u64)((u64)t__2e971 + (u64)((u64)4UL));
+	L_body_2e967:;
+	t__2e983 = (u64)(u32)(*(i32 *)t_cur__val_2e977);
+	t__2e984 = (u64)(u32)(*(i32 *)t_binding_2e965);
+	t__2e982 = (u64)(u32)(((u32)t__2e983 == (u32)t__2e984));
+	if ((u32)t__2e982) goto L_passed_2e981; else goto L_failed_2e980;
+	L_failed_2e980:;
+	t_abortsite_2e620 = ((u64)27UL);
+	goto L_abort_2e621;
+	L_passed_2e981:;
+	t__2e985 = (u64)(u32)(*(i32 *)t_binding_2e965);
+	t__2e985 = (u64)(u32)((u32)t__2e985 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e965 = (u32)t__2e985;
+	goto L__2e978;
+	L__2e986:;
+	L__2e978:;
+	L_after_2e970:;
+	goto L_loop_2e966;
+	L__2e969:;
+	t__2e990 = (u64)(u32)(*(i32 *)t_binding_2e965);
+	t__2e989 = (u64)(u32)(((u32)t__2e990 == (u32)((u64)5UL)));
+	if ((u32)t__2e989) goto L_passed_2e988; else goto L_failed_2e987;
+	L_failed_2e987:;
+	t_abortsite_2e620 = ((u64)28UL);
+	goto L_abort_2e621;
+	L_passed_2e988:;
+	*(u32 *)t_binding_2e991 = (u32)((u64)0UL);
+	L_loop_2e992:;
+	t__2e997 = ((u64 (*)(u64))((u64)((char *)&F_foreach__tuple)))((u64)R79);
+	t_tag_2e1001 = (u64)(u32)(*(u32 *)t__2e997);
+	t__2e1002 = (u64)(u32)(((u32)t_tag_2e1001 == (u32)((u64)3950255460UL)));
+	if ((u32)t__2e1002) goto L__2e995; else goto L_valid_2e994;
+	L_valid_2e994:;
+	t_cur__val_2e1003 = (u64)((u64)t__2e997 + (u64)((u64)8UL));
+	t_unpack_2e1004 = (u64)((u64)t_cur__val_2e1003 + (u64)((u64)0UL));
+	t_unpack_2e1005 = (u64)((u64)t_cur__val_2e1003 + (u64)((u64)24UL));
+	L_body_2e993:;
+	t__2e1012 = (u64)(u32)(*(i32 *)t_binding_2e991);
+	t__2e1013 = (u64)((i64)(i32)t__2e1012);
+	t__2e1011 = (u64)((u64)t__2e1013 * (u64)((u64)32UL));
+	t__2e1011 = (u64)((u64)t_binding_2e580 + (u64)t__2e1011);
+	t__2e1014 = (u64)(u32)(((u64)t__2e1013 < (u64)((u64)3UL)));
+	if ((u32)t__2e1014) goto L__2e1016; else goto L__2e1015;
+	L__2e1015:;
+	t_abortsite_2e620 = ((u64)29UL);
+	goto L_abort_2e783;
+	L__2e1016:;
+	t_value_2e1017 = (u64)((u64)t__2e1011 + (u64)((u64)0UL));
+	BLIT((u64)B80, t_unpack_2e1004, 24);
+	BLIT((u64)B81, t_value_2e1017, 24);
+	t__2e1010 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B80, (u64)B81));
+	if ((u32)t__2e1010) goto L_passed_2e1009; else goto L_failed_2e1008;
+	L_failed_2e1008:;
+	t_abortsite_2e620 = ((u64)30UL);
+	goto L_abort_2e621;
+	L_passed_2e1009:;
+	t__2e1021 = (u64)(u32)(*(i32 *)t_unpack_2e1005);
+	t__2e1023 = (u64)(u32)(*(i32 *)t_binding_2e991);
+	t__2e1024 = (u64)((i64)(i32)t__2e1023);
+	t__2e1022 = (u64)((u64)t__2e1024 * (u64)((u64)32UL));
+	t__2e1022 = (u64)((u64)t_binding_2e580 + (u64)t__2e1022);
+	t__2e1025 = (u64)(u32)(((u64)t__2e1024 < (u64)((u64)3UL)));
+	if ((u32)t__2e1025) goto L__2e1027; else goto L__2e1026;
+	L__2e1026:;
+	t_abortsite_2e620 = ((u64)31UL);
+	goto L_abort_2e783;
+	L__2e1027:;
+	t_value_2e1028 = (u64)((u64)t__2e1022 + (u64)((u64)24UL));
+	t__2e1029 = (u64)(u32)(*(i32 *)t_value_2e1028);
+	t__2e1020 = (u64)(u32)(((u32)t__2e1021 == (u32)t__2e1029));
+	if ((u32)t__2e1020) goto L_passed_2e1019; else goto L_failed_2e1018;
+	L_failed_2e1018:;
+	t_abortsite_2e620 = ((u64)32UL);
+	goto L_abort_2e621;
+	L_passed_2e1019:;
+	t__2e1030 = (u64)(u32)(*(i32 *)t_binding_2e991);
+	t__2e1030 = (u64)(u32)((u32)t__2e1030 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e991 = (u32)t__2e1030;
+	goto L__2e1006;
+	L__2e1031:;
+	L__2e1006:;
+	L_after_2e996:;
+	goto L_loop_2e992;
+	L__2e995:;
+	t__2e1035 = (u64)(u32)(*(i32 *)t_binding_2e991);
+	t__2e1034 = (u64)(u32)(((u32)t__2e1035 == (u32)((u64)3UL)));
+	if ((u32)t__2e1034) goto L_passed_2e1033; else goto L_failed_2e1032;
+	L_failed_2e1032:;
+	t_abortsite_2e620 = ((u64)33UL);
+	goto L_abort_2e621;
+	L_passed_2e1033:;
+	*(u32 *)t_binding_2e1036 = (u32)((u64)1UL);
+	t_item_2e1045 = (u64)((u64)t_object_2e1042 + (u64)((u64)0UL));
+	t_value_2e1046 = (u64)((u64)t_item_2e1045 + (u64)((u64)0UL));
+	t_value_2e1046 = (u64)((u64)t_item_2e1045 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e1046 = (u32)((u64)1UL);
+	t_item_2e1045 = (u64)((u64)t_object_2e1042 + (u64)((u64)4UL));
+	t_value_2e1047 = (u64)((u64)t_item_2e1045 + (u64)((u64)0UL));
+	t_value_2e1047 = (u64)((u64)t_item_2e1045 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e1047 = (u32)((u64)2UL);
+	t_item_2e1045 = (u64)((u64)t_object_2e1042 + (u64)((u64)8UL));
+	t_value_2e1048 = (u64)((u64)t_item_2e1045 + (u64)((u64)0UL));
+	t_value_2e1048 = (u64)((u64)t_item_2e1045 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e1048 = (u32)((u64)3UL);
+	t_ptr_2e1049 = t_object_2e1042;
+	t_end_2e1050 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t_end_2e1050 = (u64)((u64)t_ptr_2e1049 + (u64)t_end_2e1050);
+	L_loop_2e1037:;
+	t_valid_2e1051 = (u64)(u32)(((u64)t_ptr_2e1049 < (u64)t_end_2e1050));
+	if ((u32)t_valid_2e1051) goto L_valid_2e1039; else goto L__2e1040;
+	L_valid_2e1039:;
+	t_unpack_2e1052 = (u64)((u64)t_ptr_2e1049 + (u64)((u64)0UL));
+	L_body_2e1038:;
+	t__2e1058 = (u64)(u32)(*(i32 *)t_binding_2e1036);
+	t__2e1059 = (u64)(u32)(*(i32 *)t_unpack_2e1052);
+	t__2e1057 = (u64)(u32)(((u32)t__2e1058 == (u32)t__2e1059));
+	if ((u32)t__2e1057) goto L_passed_2e1056; else goto L_failed_2e1055;
+	L_failed_2e1055:;
+	t_abortsite_2e620 = ((u64)34UL);
+	goto L_abort_2e621;
+	L_passed_2e1056:;
+	t__2e1060 = (u64)(u32)(*(i32 *)t_binding_2e1036);
+	t__2e1060 = (u64)(u32)((u32)t__2e1060 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1036 = (u32)t__2e1060;
+	goto L__2e1053;
+	L__2e1061:;
+	L__2e1053:;
+	L_after_2e1041:;
+	t_ptr_2e1049 = (u64)((u64)t_ptr_2e1049 + (u64)((u64)4UL));
+	goto L_loop_2e1037;
+	L__2e1040:;
+	t__2e1065 = (u64)(u32)(*(i32 *)t_binding_2e1036);
+	t__2e1064 = (u64)(u32)(((u32)t__2e1065 == (u32)((u64)4UL)));
+	if ((u32)t__2e1064) goto L_passed_2e1063; else goto L_failed_2e1062;
+	L_failed_2e1062:;
+	t_abortsite_2e620 = ((u64)35UL);
+	goto L_abort_2e621;
+	L_passed_2e1063:;
+	L_loop_2e1066:;
+	t__2e1071 = ((u64 (*)(u64))((u64)((char *)&F_foreach__next__void)))((u64)R82);
+	t_tag_2e1073 = (u64)(u32)(*(u32 *)t__2e1071);
+	t__2e1074 = (u64)(u32)(((u32)t_tag_2e1073 == (u32)((u64)3950255460UL)));
+	if ((u32)t__2e1074) goto L__2e1069; else goto L_valid_2e1068;
+	L_valid_2e1068:;
+	t_cur__val_2e1075 = (u64)((u64)t__2e1071 + (u64)((u64)4UL));
+	L_body_2e1067:;
+	goto L__2e1076;
+	L__2e1078:;
+	L__2e1076:;
+	L_after_2e1070:;
+	goto L_loop_2e1066;
+	L__2e1069:;
+	*(u32 *)t_binding_2e1079 = (u32)((u64)1UL);
+	L_loop_2e1080:;
+	t__2e1085 = ((u64 (*)(u64))((u64)((char *)&F_foreach__large)))((u64)R83);
+	t_tag_2e1090 = (u64)(u32)(*(u32 *)t__2e1085);
+	t__2e1091 = (u64)(u32)(((u32)t_tag_2e1090 == (u32)((u64)3950255460UL)));
+	if ((u32)t__2e1091) goto L__2e1083; else goto L_valid_2e1082;
+	L_valid_2e1082:;
+	t_cur__val_2e1092 = (u64)((u64)t__2e1085 + (u64)((u64)4UL));
+	L_body_2e1081:;
+	t_ptr_2e1100 = t_cur__val_2e1092;
+	t_end_2e1102 = (u64)((u64)((u64)1024UL) * (u64)((u64)4UL));
+	t_end_2e1102 = (u64)((u64)t_ptr_2e1100 + (u64)t_end_2e1102);
+	L_loop_2e1095:;
+	t_valid_2e1103 = (u64)(u32)(((u64)t_ptr_2e1100 < (u64)t_end_2e1102));
+	if ((u32)t_valid_2e1103) goto L_valid_2e1097; else goto L__2e1098;
+	L_valid_2e1097:;
+	t__2e1104 = (u64)(u32)(*(i32 *)t_ptr_2e1100);
+	*(u32 *)t_cur__object_2e1101 = (u32)t__2e1104;
+	L_body_2e1096:;
+	t__2e1110 = (u64)(u32)(*(i32 *)t_cur__object_2e1101);
+	t__2e1109 = (u64)(u32)(((u32)t__2e1110 == (u32)((u64)12UL)));
+	if ((u32)t__2e1109) goto L_passed_2e1108; else goto L_failed_2e1107;
+	L_failed_2e1107:;
+	t_abortsite_2e620 = ((u64)36UL);
+	goto L_abort_2e621;
+	L_passed_2e1108:;
+	goto L__2e1105;
+	L__2e1111:;
+	L__2e1105:;
+	L_after_2e1099:;
+	t_ptr_2e1100 = (u64)((u64)t_ptr_2e1100 + (u64)((u64)4UL));
+	goto L_loop_2e1095;
+	L__2e1098:;
+	t__2e1112 = (u64)(u32)(*(i32 *)t_binding_2e1079);
+	t__2e1112 = (u64)(u32)((u32)t__2e1112 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1079 = (u32)t__2e1112;
+	goto L__2e1093;
+	L__2e1113:;
+	L__2e1093:;
+	L_after_2e1084:;
+	goto L_loop_2e1080;
+	L__2e1083:;
+	t__2e1117 = (u64)(u32)(*(i32 *)t_binding_2e1079);
+	t__2e1116 = (u64)(u32)(((u32)t__2e1117 == (u32)((u64)5UL)));
+	if ((u32)t__2e1116) goto L_passed_2e1115; else goto L_failed_2e1114;
+	L_failed_2e1114:;
+	t_abortsite_2e620 = ((u64)37UL);
+	goto L_abort_2e621;
+	L_passed_2e1115:;
+	t_item_2e1121 = (u64)((u64)t_object_2e1119 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1121 = (u32)((u64)1UL);
+	t_item_2e1121 = (u64)((u64)t_object_2e1119 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1121 = (u32)((u64)1UL);
+	t_item_2e1121 = (u64)((u64)t_object_2e1119 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1121 = (u32)((u64)1UL);
+	*(u64 *)t_binding_2e1118 = (u64)t_object_2e1119;
+	t__2e1122 = (u64)((u64)t_binding_2e1118 + (u64)((u64)8UL));
+	*(u64 *)t__2e1122 = (u64)((u64)3UL);
+	t__2e1122 = (u64)((u64)t__2e1122 + (u64)((u64)8UL));
+	*(u64 *)t__2e1122 = (u64)((u64)3UL);
+	*(u32 *)t_binding_2e1123 = (u32)((u64)1UL);
+	t__2e1131 = (u64)((u64)t_binding_2e1118 + (u64)((u64)8UL));
+	t__2e1132 = (u64)((u64)t_binding_2e1118 + (u64)((u64)16UL));
+	t__2e1133 = (u64)(*(u64 *)t_binding_2e1118);
+	t__2e1134 = (u64)(*(u64 *)t__2e1131);
+	t_end_2e1136 = (u64)((u64)t__2e1134 * (u64)((u64)4UL));
+	t_end_2e1136 = (u64)((u64)t__2e1133 + (u64)t_end_2e1136);
+	L_loop_2e1124:;
+	t_valid_2e1137 = (u64)(u32)(((u64)t__2e1133 < (u64)t_end_2e1136));
+	if ((u32)t_valid_2e1137) goto L_valid_2e1126; else goto L__2e1127;
+	L_valid_2e1126:;
+	t__2e1138 = (u64)(u32)(*(i32 *)t__2e1133);
+	*(u32 *)t_cur__object_2e1135 = (u32)t__2e1138;
+	L_body_2e1125:;
+	t__2e1144 = (u64)(u32)(*(i32 *)t_cur__object_2e1135);
+	t__2e1143 = (u64)(u32)(((u32)t__2e1144 == (u32)((u64)1UL)));
+	if ((u32)t__2e1143) goto L_passed_2e1142; else goto L_failed_2e1141;
+	L_failed_2e1141:;
+	t_abortsite_2e620 = ((u64)38UL);
+	goto L_abort_2e621;
+	L_passed_2e1142:;
+	t__2e1145 = (u64)(u32)(*(i32 *)t_binding_2e1123);
+	t__2e1145 = (u64)(u32)((u32)t__2e1145 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1123 = (u32)t__2e1145;
+	goto L__2e1139;
+	L__2e1146:;
+	L__2e1139:;
+	L_after_2e1128:;
+	t__2e1133 = (u64)((u64)t__2e1133 + (u64)((u64)4UL));
+	goto L_loop_2e1124;
+	L__2e1127:;
+	t__2e1150 = (u64)(u32)(*(i32 *)t_binding_2e1123);
+	t__2e1149 = (u64)(u32)(((u32)t__2e1150 == (u32)((u64)4UL)));
+	if ((u32)t__2e1149) goto L_passed_2e1148; else goto L_failed_2e1147;
+	L_failed_2e1147:;
+	t_abortsite_2e620 = ((u64)39UL);
+	goto L_abort_2e621;
+	L_passed_2e1148:;
+	*(u32 *)t_binding_2e1151 = (u32)((u64)1UL);
+	t__2e1158 = (u64)((u64)t_binding_2e1118 + (u64)((u64)8UL));
+	t__2e1159 = (u64)((u64)t_binding_2e1118 + (u64)((u64)16UL));
+	t__2e1160 = (u64)(*(u64 *)t_binding_2e1118);
+	t__2e1161 = (u64)(*(u64 *)t__2e1158);
+	t_end_2e1163 = (u64)((u64)t__2e1161 * (u64)((u64)4UL));
+	t_end_2e1163 = (u64)((u64)t__2e1160 + (u64)t_end_2e1163);
+	L_loop_2e1152:;
+	t_valid_2e1164 = (u64)(u32)(((u64)t__2e1160 < (u64)t_end_2e1163));
+	if ((u32)t_valid_2e1164) goto L_valid_2e1154; else goto L__2e1155;
+	L_valid_2e1154:;
+	*(u64 *)t_cur__object_2e1162 = (u64)t__2e1160;
+	L_body_2e1153:;
+	t__2e1170 = (u64)(*(u64 *)t_cur__object_2e1162);
+	t__2e1171 = (u64)(u32)(*(i32 *)t__2e1170);
+	t__2e1169 = (u64)(u32)(((u32)t__2e1171 == (u32)((u64)1UL)));
+	if ((u32)t__2e1169) goto L_passed_2e1168; else goto L_failed_2e1167;
+	L_failed_2e1167:;
+	t_abortsite_2e620 = ((u64)40UL);
+	goto L_abort_2e621;
+	L_passed_2e1168:;
+	t__2e1172 = (u64)(u32)(*(i32 *)t_binding_2e1151);
+	t__2e1172 = (u64)(u32)((u32)t__2e1172 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1151 = (u32)t__2e1172;
+	goto L__2e1165;
+	L__2e1173:;
+	L__2e1165:;
+	L_after_2e1156:;
+	t__2e1160 = (u64)((u64)t__2e1160 + (u64)((u64)4UL));
+	goto L_loop_2e1152;
+	L__2e1155:;
+	t__2e1177 = (u64)(u32)(*(i32 *)t_binding_2e1151);
+	t__2e1176 = (u64)(u32)(((u32)t__2e1177 == (u32)((u64)4UL)));
+	if ((u32)t__2e1176) goto L_passed_2e1175; else goto L_failed_2e1174;
+	L_failed_2e1174:;
+	t_abortsite_2e620 = ((u64)41UL);
+	goto L_abort_2e621;
+	L_passed_2e1175:;
+	t_item_2e1180 = (u64)((u64)t_binding_2e1178 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1180 = (u32)((u64)2UL);
+	t_item_2e1180 = (u64)((u64)t_binding_2e1178 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1180 = (u32)((u64)2UL);
+	t_item_2e1180 = (u64)((u64)t_binding_2e1178 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1180 = (u32)((u64)2UL);
+	t_item_2e1180 = (u64)((u64)t_binding_2e1178 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e1180 = (u32)((u64)2UL);
+	*(u32 *)t_binding_2e1181 = (u32)((u64)1UL);
+	t_ptr_2e1187 = t_binding_2e1178;
+	t_end_2e1189 = (u64)((u64)((u64)4UL) * (u64)((u64)4UL));
+	t_end_2e1189 = (u64)((u64)t_ptr_2e1187 + (u64)t_end_2e1189);
+	L_loop_2e1182:;
+	t_valid_2e1190 = (u64)(u32)(((u64)t_ptr_2e1187 < (u64)t_end_2e1189));
+	if ((u32)t_valid_2e1190) goto L_valid_2e1184; else goto L__2e1185;
+	L_valid_2e1184:;
+	t__2e1191 = (u64)(u32)(*(i32 *)t_ptr_2e1187);
+	*(u32 *)t_cur__object_2e1188 = (u32)t__2e1191;
+	L_body_2e1183:;
+	t__2e1197 = (u64)(u32)(*(i32 *)t_cur__object_2e1188);
+	t__2e1196 = (u64)(u32)(((u32)t__2e1197 == (u32)((u64)2UL)));
+	if ((u32)t__2e1196) goto L_passed_2e1195; else goto L_failed_2e1194;
+	L_failed_2e1194:;
+	t_abortsite_2e620 = ((u64)42UL);
+	goto L_abort_2e621;
+	L_passed_2e1195:;
+	t__2e1198 = (u64)(u32)(*(i32 *)t_binding_2e1181);
+	t__2e1198 = (u64)(u32)((u32)t__2e1198 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1181 = (u32)t__2e1198;
+	goto L__2e1192;
+	L__2e1199:;
+	L__2e1192:;
+	L_after_2e1186:;
+	t_ptr_2e1187 = (u64)((u64)t_ptr_2e1187 + (u64)((u64)4UL));
+	goto L_loop_2e1182;
+	L__2e1185:;
+	t__2e1203 = (u64)(u32)(*(i32 *)t_binding_2e1181);
+	t__2e1202 = (u64)(u32)(((u32)t__2e1203 == (u32)((u64)5UL)));
+	if ((u32)t__2e1202) goto L_passed_2e1201; else goto L_failed_2e1200;
+	L_failed_2e1200:;
+	t_abortsite_2e620 = ((u64)43UL);
+	goto L_abort_2e621;
+	L_passed_2e1201:;
+	*(u32 *)t_binding_2e1204 = (u32)((u64)1UL);
+	t_ptr_2e1210 = t_binding_2e1178;
+	t_end_2e1212 = (u64)((u64)((u64)4UL) * (u64)((u64)4UL));
+	t_end_2e1212 = (u64)((u64)t_ptr_2e1210 + (u64)t_end_2e1212);
+	L_loop_2e1205:;
+	t_valid_2e1213 = (u64)(u32)(((u64)t_ptr_2e1210 < (u64)t_end_2e1212));
+	if ((u32)t_valid_2e1213) goto L_valid_2e1207; else goto L__2e1208;
+	L_valid_2e1207:;
+	*(u64 *)t_cur__object_2e1211 = (u64)t_ptr_2e1210;
+	L_body_2e1206:;
+	t__2e1219 = (u64)(*(u64 *)t_cur__object_2e1211);
+	t__2e1220 = (u64)(u32)(*(i32 *)t__2e1219);
+	t__2e1218 = (u64)(u32)(((u32)t__2e1220 == (u32)((u64)2UL)));
+	if ((u32)t__2e1218) goto L_passed_2e1217; else goto L_failed_2e1216;
+	L_failed_2e1216:;
+	t_abortsite_2e620 = ((u64)44UL);
+	goto L_abort_2e621;
+	L_passed_2e1217:;
+	t__2e1221 = (u64)(u32)(*(i32 *)t_binding_2e1204);
+	t__2e1221 = (u64)(u32)((u32)t__2e1221 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1204 = (u32)t__2e1221;
+	goto L__2e1214;
+	L__2e1222:;
+	L__2e1214:;
+	L_after_2e1209:;
+	t_ptr_2e1210 = (u64)((u64)t_ptr_2e1210 + (u64)((u64)4UL));
+	goto L_loop_2e1205;
+	L__2e1208:;
+	t__2e1226 = (u64)(u32)(*(i32 *)t_binding_2e1204);
+	t__2e1225 = (u64)(u32)(((u32)t__2e1226 == (u32)((u64)5UL)));
+	if ((u32)t__2e1225) goto L_passed_2e1224; else goto L_failed_2e1223;
+	L_failed_2e1223:;
+	t_abortsite_2e620 = ((u64)45UL);
+	goto L_abort_2e621;
+	L_passed_2e1224:;
+	*(u64 *)t_binding_2e1227 = (u64)t_binding_2e1178;
+	*(u32 *)t_binding_2e1228 = (u32)((u64)1UL);
+	t__2e1234 = (u64)(*(u64 *)t_binding_2e1227);
+	t_ptr_2e1235 = t__2e1234;
+	t_end_2e1237 = (u64)((u64)((u64)4UL) * (u64)((u64)4UL));
+	t_end_2e1237 = (u64)((u64)t_ptr_2e1235 + (u64)t_end_2e1237);
+	L_loop_2e1229:;
+	t_valid_2e1238 = (u64)(u32)(((u64)t_ptr_2e1235 < (u64)t_end_2e1237));
+	if ((u32)t_valid_2e1238) goto L_valid_2e1231; else goto L__2e1232;
+	L_valid_2e1231:;
+	*(u64 *)t_cur__object_2e1236 = (u64)t_ptr_2e1235;
+	L_body_2e1230:;
+	t__2e1244 = (u64)(*(u64 *)t_cur__object_2e1236);
+	t__2e1245 = (u64)(u32)(*(i32 *)t__2e1244);
+	t__2e1243 = (u64)(u32)(((u32)t__2e1245 == (u32)((u64)2UL)));
+	if ((u32)t__2e1243) goto L_passed_2e1242; else goto L_failed_2e1241;
+	L_failed_2e1241:;
+	t_abortsite_2e620 = ((u64)46UL);
+	goto L_abort_2e621;
+	L_passed_2e1242:;
+	t__2e1246 = (u64)(u32)(*(i32 *)t_binding_2e1228);
+	t__2e1246 = (u64)(u32)((u32)t__2e1246 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1228 = (u32)t__2e1246;
+	goto L__2e1239;
+	L__2e1247:;
+	L__2e1239:;
+	L_after_2e1233:;
+	t_ptr_2e1235 = (u64)((u64)t_ptr_2e1235 + (u64)((u64)4UL));
+	goto L_loop_2e1229;
+	L__2e1232:;
+	t__2e1251 = (u64)(u32)(*(i32 *)t_binding_2e1228);
+	t__2e1250 = (u64)(u32)(((u32)t__2e1251 == (u32)((u64)5UL)));
+	if ((u32)t__2e1250) goto L_passed_2e1249; else goto L_failed_2e1248;
+	L_failed_2e1248:;
+	t_abortsite_2e620 = ((u64)47UL);
+	goto L_abort_2e621;
+	L_passed_2e1249:;
+	*(u32 *)t_binding_2e1252 = (u32)((u64)1UL);
+	t_ptr_2e1258 = t_binding_2e1178;
+	t_end_2e1260 = (u64)((u64)((u64)4UL) * (u64)((u64)4UL));
+	t_end_2e1260 = (u64)((u64)t_ptr_2e1258 + (u64)t_end_2e1260);
+	L_loop_2e1253:;
+	t_valid_2e1261 = (u64)(u32)(((u64)t_ptr_2e1258 < (u64)t_end_2e1260));
+	if ((u32)t_valid_2e1261) goto L_valid_2e1255; else goto L__2e1256;
+	L_valid_2e1255:;
+	*(u64 *)t_cur__object_2e1259 = (u64)t_ptr_2e1258;
+	L_body_2e1254:;
+	t__2e1267 = (u64)(*(u64 *)t_cur__object_2e1259);
+	t__2e1268 = (u64)(u32)(*(i32 *)t__2e1267);
+	t__2e1266 = (u64)(u32)(((u32)t__2e1268 == (u32)((u64)2UL)));
+	if ((u32)t__2e1266) goto L_passed_2e1265; else goto L_failed_2e1264;
+	L_failed_2e1264:;
+	t_abortsite_2e620 = ((u64)48UL);
+	goto L_abort_2e621;
+	L_passed_2e1265:;
+	t__2e1269 = (u64)(u32)(*(i32 *)t_binding_2e1252);
+	t__2e1269 = (u64)(u32)((u32)t__2e1269 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1252 = (u32)t__2e1269;
+	goto L__2e1262;
+	L__2e1270:;
+	L__2e1262:;
+	L_after_2e1257:;
+	t_ptr_2e1258 = (u64)((u64)t_ptr_2e1258 + (u64)((u64)4UL));
+	goto L_loop_2e1253;
+	L__2e1256:;
+	t__2e1274 = (u64)(u32)(*(i32 *)t_binding_2e1252);
+	t__2e1273 = (u64)(u32)(((u32)t__2e1274 == (u32)((u64)5UL)));
+	if ((u32)t__2e1273) goto L_passed_2e1272; else goto L_failed_2e1271;
+	L_failed_2e1271:;
+	t_abortsite_2e620 = ((u64)49UL);
+	goto L_abort_2e621;
+	L_passed_2e1272:;
+	*(u32 *)t_binding_2e1275 = (u32)((u64)1UL);
+	*(u64 *)t__2e1282 = (u64)t_binding_2e1178;
+	*(u64 *)t__2e1281 = (u64)t__2e1282;
+	t__2e1283 = (u64)(*(u64 *)t__2e1281);
+	t__2e1284 = (u64)(*(u64 *)t__2e1283);
+	t_ptr_2e1285 = t__2e1284;
+	t_end_2e1287 = (u64)((u64)((u64)4UL) * (u64)((u64)4UL));
+	t_end_2e1287 = (u64)((u64)t_ptr_2e1285 + (u64)t_end_2e1287);
+	L_loop_2e1276:;
+	t_valid_2e1288 = (u64)(u32)(((u64)t_ptr_2e1285 < (u64)t_end_2e1287));
+	if ((u32)t_valid_2e1288) goto L_valid_2e1278; else goto L__2e1279;
+	L_valid_2e1278:;
+	*(u64 *)t_cur__object_2e1286 = (u64)t_ptr_2e1285;
+	L_body_2e1277:;
+	t__2e1294 = (u64)(*(u64 *)t_cur__object_2e1286);
+	t__2e1295 = (u64)(u32)(*(i32 *)t__2e1294);
+	t__2e1293 = (u64)(u32)(((u32)t__2e1295 == (u32)((u64)2UL)));
+	if ((u32)t__2e1293) goto L_passed_2e1292; else goto L_failed_2e1291;
+	L_failed_2e1291:;
+	t_abortsite_2e620 = ((u64)50UL);
+	goto L_abort_2e621;
+	L_passed_2e1292:;
+	t__2e1296 = (u64)(u32)(*(i32 *)t_binding_2e1275);
+	t__2e1296 = (u64)(u32)((u32)t__2e1296 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1275 = (u32)t__2e1296;
+	goto L__2e1289;
+	L__2e1297:;
+	L__2e1289:;
+	L_after_2e1280:;
+	t_ptr_2e1285 = (u64)((u64)t_ptr_2e1285 + (u64)((u64)4UL));
+	goto L_loop_2e1276;
+	L__2e1279:;
+	t__2e1301 = (u64)(u32)(*(i32 *)t_binding_2e1275);
+	t__2e1300 = (u64)(u32)(((u32)t__2e1301 == (u32)((u64)5UL)));
+	if ((u32)t__2e1300) goto L_passed_2e1299; else goto L_failed_2e1298;
+	L_failed_2e1298:;
+	t_abortsite_2e620 = ((u64)51UL);
+	goto L_abort_2e621;
+	L_passed_2e1299:;
+	*(u32 *)t_binding_2e1302 = (u32)((u64)1UL);
+	L_loop_2e1303:;
+	*(u32 *)t_object_2e1308 = (u32)((u64)3950255460UL);
+	t_tag_2e1309 = (u64)(u32)(*(u32 *)t_object_2e1308);
+	t__2e1310 = (u64)(u32)(((u32)t_tag_2e1309 == (u32)((u64)3950255460UL)));
+	if ((u32)t__2e1310) goto L__2e1306; else goto L_valid_2e1305;
+	L_valid_2e1305:;
+	t_cur__val_2e1311 = (u64)((u64)t_object_2e1308 + (u64)((u64)4UL));
+	L_body_2e1304:;
+	t__2e1314 = (u64)(u32)(*(i32 *)t_binding_2e1302);
+	t__2e1314 = (u64)(u32)((u32)t__2e1314 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1302 = (u32)t__2e1314;
+	goto L__2e1312;
+	L__2e1315:;
+	L__2e1312:;
+	L_after_2e1307:;
+	goto L_loop_2e1303;
+	L__2e1306:;
+	t__2e1319 = (u64)(u32)(*(i32 *)t_binding_2e1302);
+	t__2e1318 = (u64)(u32)(((u32)t__2e1319 == (u32)((u64)1UL)));
+	if ((u32)t__2e1318) goto L_passed_2e1317; else goto L_failed_2e1316;
+	L_failed_2e1316:;
+	t_abortsite_2e620 = ((u64)52UL);
+	goto L_abort_2e621;
+	L_passed_2e1317:;
+	*(u32 *)t_object_2e1323 = (u32)((u64)3532310079UL);
+	t__2e1327 = (u64)((u64)t_object_2e1323 + (u64)((u64)4UL));
+	*(u32 *)t__2e1327 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1330 = (u64)((u64)0UL);
+	t__2e1332 = (u64)((u64)t_object_2e1330 + (u64)((u64)8UL));
+	*(u64 *)t__2e1332 = (u64)((u64)0UL);
+	t__2e1332 = (u64)((u64)t__2e1332 + (u64)((u64)8UL));
+	*(u64 *)t__2e1332 = (u64)((u64)0UL);
+	BLIT((u64)B84, t_object_2e1323, 8);
+	BLIT((u64)B85, ((u64)((char *)&D_strliteral_2e1329)), 24);
+	BLIT((u64)B86, t_object_2e1330, 24);
+	t__2e1321 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R87, (u64)B84, (u64)B85, (u64)B86);
+	t_tag_2e1333 = (u64)(*(u32 *)t__2e1321);
+	t__2e1341 = (u64)(u32)(((u32)t_tag_2e1333 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1341) goto L_member_2e1338; else goto L__2e1340;
+	L__2e1340:;
+	t__2e1343 = (u64)(u32)(((u32)t_tag_2e1333 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1343) goto L_member_2e1339; else goto L__2e1342;
+	L__2e1342:;
+	goto L_matches_2e1337;
+	L_member_2e1338:;
+	goto L_matches_2e1337;
+	L_member_2e1339:;
+	goto L_matches_2e1336;
+	L_matches_2e1336:;
+	goto L__2e1334;
+	L_matches_2e1337:;
+	t_abortsite_2e620 = ((u64)53UL);
+	goto L_abort_2e1344;
+	L__2e1351:;
+	L__2e1335:;
+	t_abortsite_2e620 = ((u64)54UL);
+	goto L_abort_2e1352;
+	L__2e1334:;
+	*(u32 *)t_object_2e1361 = (u32)((u64)3532310079UL);
+	t__2e1362 = (u64)((u64)t_object_2e1361 + (u64)((u64)4UL));
+	*(u32 *)t__2e1362 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e1365 = (u64)((u64)0UL);
+	t__2e1366 = (u64)((u64)t_object_2e1365 + (u64)((u64)8UL));
+	*(u64 *)t__2e1366 = (u64)((u64)0UL);
+	t__2e1366 = (u64)((u64)t__2e1366 + (u64)((u64)8UL));
+	*(u64 *)t__2e1366 = (u64)((u64)0UL);
+	BLIT((u64)B88, t_object_2e1361, 8);
+	BLIT((u64)B89, ((u64)((char *)&D_strliteral_2e1364)), 24);
+	BLIT((u64)B90, t_object_2e1365, 24);
+	t__2e1360 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R91, (u64)B88, (u64)B89, (u64)B90);
+	t_tag_2e1367 = (u64)(*(u32 *)t__2e1360);
+	t__2e1375 = (u64)(u32)(((u32)t_tag_2e1367 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1375) goto L_member_2e1372; else goto L__2e1374;
+	L__2e1374:;
+	t__2e1377 = (u64)(u32)(((u32)t_tag_2e1367 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1377) goto L_member_2e1373; else goto L__2e1376;
+	L__2e1376:;
+	goto L_matches_2e1371;
+	L_member_2e1372:;
+	goto L_matches_2e1371;
+	L_member_2e1373:;
+	goto L_matches_2e1370;
+	L_matches_2e1370:;
+	goto L__2e1368;
+	L_matches_2e1371:;
+	t_abortsite_2e620 = ((u64)55UL);
+	goto L_abort_2e1344;
+	L__2e1378:;
+	L__2e1369:;
+	t_abortsite_2e620 = ((u64)56UL);
+	goto L_abort_2e1352;
+	L__2e1368:;
+	*(u32 *)t_object_2e1381 = (u32)((u64)3532310079UL);
+	t__2e1382 = (u64)((u64)t_object_2e1381 + (u64)((u64)4UL));
+	*(u32 *)t__2e1382 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1385 = (u64)((u64)0UL);
+	t__2e1386 = (u64)((u64)t_object_2e1385 + (u64)((u64)8UL));
+	*(u64 *)t__2e1386 = (u64)((u64)0UL);
+	t__2e1386 = (u64)((u64)t__2e1386 + (u64)((u64)8UL));
+	*(u64 *)t__2e1386 = (u64)((u64)0UL);
+	BLIT((u64)B92, t_object_2e1381, 8);
+	BLIT((u64)B93, ((u64)((char *)&D_strliteral_2e1384)), 24);
+	BLIT((u64)B94, t_object_2e1385, 24);
+	t__2e1380 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R95, (u64)B92, (u64)B93, (u64)B94);
+	t_tag_2e1387 = (u64)(*(u32 *)t__2e1380);
+	t__2e1395 = (u64)(u32)(((u32)t_tag_2e1387 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1395) goto L_member_2e1392; else goto L__2e1394;
+	L__2e1394:;
+	t__2e1397 = (u64)(u32)(((u32)t_tag_2e1387 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1397) goto L_member_2e1393; else goto L__2e1396;
+	L__2e1396:;
+	goto L_matches_2e1391;
+	L_member_2e1392:;
+	goto L_matches_2e1391;
+	L_member_2e1393:;
+	goto L_matches_2e1390;
+	L_matches_2e1390:;
+	goto L__2e1388;
+	L_matches_2e1391:;
+	t_abortsite_2e620 = ((u64)57UL);
+	goto L_abort_2e1344;
+	L__2e1398:;
+	L__2e1389:;
+	t_abortsite_2e620 = ((u64)58UL);
+	goto L_abort_2e1352;
+	L__2e1388:;
+	*(u32 *)t_object_2e1401 = (u32)((u64)3532310079UL);
+	t__2e1402 = (u64)((u64)t_object_2e1401 + (u64)((u64)4UL));
+	*(u32 *)t__2e1402 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1405 = (u64)((u64)0UL);
+	t__2e1406 = (u64)((u64)t_object_2e1405 + (u64)((u64)8UL));
+	*(u64 *)t__2e1406 = (u64)((u64)0UL);
+	t__2e1406 = (u64)((u64)t__2e1406 + (u64)((u64)8UL));
+	*(u64 *)t__2e1406 = (u64)((u64)0UL);
+	BLIT((u64)B96, t_object_2e1401, 8);
+	BLIT((u64)B97, ((u64)((char *)&D_strliteral_2e1404)), 24);
+	BLIT((u64)B98, t_object_2e1405, 24);
+	t__2e1400 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R99, (u64)B96, (u64)B97, (u64)B98);
+	t_tag_2e1407 = (u64)(*(u32 *)t__2e1400);
+	t__2e1415 = (u64)(u32)(((u32)t_tag_2e1407 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1415) goto L_member_2e1412; else goto L__2e1414;
+	L__2e1414:;
+	t__2e1417 = (u64)(u32)(((u32)t_tag_2e1407 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1417) goto L_member_2e1413; else goto L__2e1416;
+	L__2e1416:;
+	goto L_matches_2e1411;
+	L_member_2e1412:;
+	goto L_matches_2e1411;
+	L_member_2e1413:;
+	goto L_matches_2e1410;
+	L_matches_2e1410:;
+	goto L__2e1408;
+	L_matches_2e1411:;
+	t_abortsite_2e620 = ((u64)59UL);
+	goto L_abort_2e1344;
+	L__2e1418:;
+	L__2e1409:;
+	t_abortsite_2e620 = ((u64)60UL);
+	goto L_abort_2e1352;
+	L__2e1408:;
+	*(u32 *)t_object_2e1421 = (u32)((u64)3532310079UL);
+	t__2e1422 = (u64)((u64)t_object_2e1421 + (u64)((u64)4UL));
+	*(u32 *)t__2e1422 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1425 = (u64)((u64)0UL);
+	t__2e1426 = (u64)((u64)t_object_2e1425 + (u64)((u64)8UL));
+	*(u64 *)t__2e1426 = (u64)((u64)0UL);
+	t__2e1426 = (u64)((u64)t__2e1426 + (u64)((u64)8UL));
+	*(u64 *)t__2e1426 = (u64)((u64)0UL);
+	BLIT((u64)B100, t_object_2e1421, 8);
+	BLIT((u64)B101, ((u64)((char *)&D_strliteral_2e1424)), 24);
+	BLIT((u64)B102, t_object_2e1425, 24);
+	t__2e1420 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R103, (u64)B100, (u64)B101, (u64)B102);
+	t_tag_2e1427 = (u64)(*(u32 *)t__2e1420);
+	t__2e1435 = (u64)(u32)(((u32)t_tag_2e1427 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1435) goto L_member_2e1432; else goto L__2e1434;
+	L__2e1434:;
+	t__2e1437 = (u64)(u32)(((u32)t_tag_2e1427 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1437) goto L_member_2e1433; else goto L__2e1436;
+	L__2e1436:;
+	goto L_matches_2e1431;
+	L_member_2e1432:;
+	goto L_matches_2e1431;
+	L_member_2e1433:;
+	goto L_matches_2e1430;
+	L_matches_2e1430:;
+	goto L__2e1428;
+	L_matches_2e1431:;
+	t_abortsite_2e620 = ((u64)61UL);
+	goto L_abort_2e1344;
+	L__2e1438:;
+	L__2e1429:;
+	t_abortsite_2e620 = ((u64)62UL);
+	goto L_abort_2e1352;
+	L__2e1428:;
+	*(u32 *)t_object_2e1441 = (u32)((u64)3532310079UL);
+	t__2e1442 = (u64)((u64)t_object_2e1441 + (u64)((u64)4UL));
+	*(u32 *)t__2e1442 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1445 = (u64)((u64)0UL);
+	t__2e1446 = (u64)((u64)t_object_2e1445 + (u64)((u64)8UL));
+	*(u64 *)t__2e1446 = (u64)((u64)0UL);
+	t__2e1446 = (u64)((u64)t__2e1446 + (u64)((u64)8UL));
+	*(u64 *)t__2e1446 = (u64)((u64)0UL);
+	BLIT((u64)B104, t_object_2e1441, 8);
+	BLIT((u64)B105, ((u64)((char *)&D_strliteral_2e1444)), 24);
+	BLIT((u64)B106, t_object_2e1445, 24);
+	t__2e1440 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R107, (u64)B104, (u64)B105, (u64)B106);
+	t_tag_2e1447 = (u64)(*(u32 *)t__2e1440);
+	t__2e1455 = (u64)(u32)(((u32)t_tag_2e1447 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1455) goto L_member_2e1452; else goto L__2e1454;
+	L__2e1454:;
+	t__2e1457 = (u64)(u32)(((u32)t_tag_2e1447 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1457) goto L_member_2e1453; else goto L__2e1456;
+	L__2e1456:;
+	goto L_matches_2e1451;
+	L_member_2e1452:;
+	goto L_matches_2e1451;
+	L_member_2e1453:;
+	goto L_matches_2e1450;
+	L_matches_2e1450:;
+	goto L__2e1448;
+	L_matches_2e1451:;
+	t_abortsite_2e620 = ((u64)63UL);
+	goto L_abort_2e1344;
+	L__2e1458:;
+	L__2e1449:;
+	t_abortsite_2e620 = ((u64)64UL);
+	goto L_abort_2e1352;
+	L__2e1448:;
+	*(u32 *)t_object_2e1461 = (u32)((u64)3532310079UL);
+	t__2e1462 = (u64)((u64)t_object_2e1461 + (u64)((u64)4UL));
+	*(u32 *)t__2e1462 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1465 = (u64)((u64)0UL);
+	t__2e1466 = (u64)((u64)t_object_2e1465 + (u64)((u64)8UL));
+	*(u64 *)t__2e1466 = (u64)((u64)0UL);
+	t__2e1466 = (u64)((u64)t__2e1466 + (u64)((u64)8UL));
+	*(u64 *)t__2e1466 = (u64)((u64)0UL);
+	BLIT((u64)B108, t_object_2e1461, 8);
+	BLIT((u64)B109, ((u64)((char *)&D_strliteral_2e1464)), 24);
+	BLIT((u64)B110, t_object_2e1465, 24);
+	t__2e1460 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R111, (u64)B108, (u64)B109, (u64)B110);
+	t_tag_2e1467 = (u64)(*(u32 *)t__2e1460);
+	t__2e1475 = (u64)(u32)(((u32)t_tag_2e1467 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1475) goto L_member_2e1472; else goto L__2e1474;
+	L__2e1474:;
+	t__2e1477 = (u64)(u32)(((u32)t_tag_2e1467 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1477) goto L_member_2e1473; else goto L__2e1476;
+	L__2e1476:;
+	goto L_matches_2e1471;
+	L_member_2e1472:;
+	goto L_matches_2e1471;
+	L_member_2e1473:;
+	goto L_matches_2e1470;
+	L_matches_2e1470:;
+	goto L__2e1468;
+	L_matches_2e1471:;
+	t_abortsite_2e620 = ((u64)65UL);
+	goto L_abort_2e1344;
+	L__2e1478:;
+	L__2e1469:;
+	t_abortsite_2e620 = ((u64)66UL);
+	goto L_abort_2e1352;
+	L__2e1468:;
+	*(u32 *)t_object_2e1481 = (u32)((u64)3532310079UL);
+	t__2e1482 = (u64)((u64)t_object_2e1481 + (u64)((u64)4UL));
+	*(u32 *)t__2e1482 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1485 = (u64)((u64)0UL);
+	t__2e1486 = (u64)((u64)t_object_2e1485 + (u64)((u64)8UL));
+	*(u64 *)t__2e1486 = (u64)((u64)0UL);
+	t__2e1486 = (u64)((u64)t__2e1486 + (u64)((u64)8UL));
+	*(u64 *)t__2e1486 = (u64)((u64)0UL);
+	BLIT((u64)B112, t_object_2e1481, 8);
+	BLIT((u64)B113, ((u64)((char *)&D_strliteral_2e1484)), 24);
+	BLIT((u64)B114, t_object_2e1485, 24);
+	t__2e1480 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R115, (u64)B112, (u64)B113, (u64)B114);
+	t_tag_2e1487 = (u64)(*(u32 *)t__2e1480);
+	t__2e1495 = (u64)(u32)(((u32)t_tag_2e1487 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1495) goto L_member_2e1492; else goto L__2e1494;
+	L__2e1494:;
+	t__2e1497 = (u64)(u32)(((u32)t_tag_2e1487 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1497) goto L_member_2e1493; else goto L__2e1496;
+	L__2e1496:;
+	goto L_matches_2e1491;
+	L_member_2e1492:;
+	goto L_matches_2e1491;
+	L_member_2e1493:;
+	goto L_matches_2e1490;
+	L_matches_2e1490:;
+	goto L__2e1488;
+	L_matches_2e1491:;
+	t_abortsite_2e620 = ((u64)67UL);
+	goto L_abort_2e1344;
+	L__2e1498:;
+	L__2e1489:;
+	t_abortsite_2e620 = ((u64)68UL);
+	goto L_abort_2e1352;
+	L__2e1488:;
+	t_cleanup_2e627 = (u64)(u32)((u64)4UL);
+	goto L_defer_2e628;
+	L_resume_2e1499:;
+	goto L__2e540;
+	L__2e1500:;
+	goto L__2e1501;
+	L_defer_2e628:;
+	t__2e1502 = (u64)(*(u64 *)t_binding_2e545);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e1502);
+	t__2e1504 = (u64)(u32)(((u32)t_cleanup_2e627 == (u32)((u64)4UL)));
+	if ((u32)t__2e1504) goto L_resume_2e1499; else goto L__2e1503;
+	L__2e1503:;
+	t__2e1506 = (u64)(u32)(((u32)t_cleanup_2e627 == (u32)((u64)3UL)));
+	if ((u32)t__2e1506) goto L_resume_2e1358; else goto L__2e1505;
+	L__2e1505:;
+	t__2e1508 = (u64)(u32)(((u32)t_cleanup_2e627 == (u32)((u64)2UL)));
+	if ((u32)t__2e1508) goto L_resume_2e1350; else goto L__2e1507;
+	L__2e1507:;
+	t__2e1510 = (u64)(u32)(((u32)t_cleanup_2e627 == (u32)((u64)1UL)));
+	if ((u32)t__2e1510) goto L_resume_2e789; else goto L__2e1509;
+	L__2e1509:;
+	goto L_resume_2e629;
+	L__2e1501:;
+	L__2e540:;
+	return;
+	L_abort_2e621:;
+	t__2e622 = (u64)((u64)t_abortsite_2e620 * (u64)((u64)16UL));
+	t__2e622 = (u64)((u64)((u64)((char *)&D_abortsites_2e619)) + (u64)t__2e622);
+	t__2e623 = (u64)(*(u64 *)t__2e622);
+	t__2e624 = (u64)((u64)t__2e622 + (u64)((u64)8UL));
+	t__2e625 = (u64)(*(u32 *)t__2e624);
+	t__2e624 = (u64)((u64)t__2e622 + (u64)((u64)12UL));
+	t__2e626 = (u64)(*(u32 *)t__2e624);
+	t_cleanup_2e627 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e628;
+	L_resume_2e629:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e623, (u64)t__2e625, (u64)t__2e626, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e783:;
+	t__2e784 = (u64)((u64)t_abortsite_2e620 * (u64)((u64)16UL));
+	t__2e784 = (u64)((u64)((u64)((char *)&D_abortsites_2e619)) + (u64)t__2e784);
+	t__2e785 = (u64)(*(u64 *)t__2e784);
+	t__2e786 = (u64)((u64)t__2e784 + (u64)((u64)8UL));
+	t__2e787 = (u64)(*(u32 *)t__2e786);
+	t__2e786 = (u64)((u64)t__2e784 + (u64)((u64)12UL));
+	t__2e788 = (u64)(*(u32 *)t__2e786);
+	t_cleanup_2e627 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e628;
+	L_resume_2e789:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e785, (u64)t__2e787, (u64)t__2e788, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e1344:;
+	t__2e1345 = (u64)((u64)t_abortsite_2e620 * (u64)((u64)16UL));
+	t__2e1345 = (u64)((u64)((u64)((char *)&D_abortsites_2e619)) + (u64)t__2e1345);
+	t__2e1346 = (u64)(*(u64 *)t__2e1345);
+	t__2e1347 = (u64)((u64)t__2e1345 + (u64)((u64)8UL));
+	t__2e1348 = (u64)(*(u32 *)t__2e1347);
+	t__2e1347 = (u64)((u64)t__2e1345 + (u64)((u64)12UL));
+	t__2e1349 = (u64)(*(u32 *)t__2e1347);
+	t_cleanup_2e627 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e628;
+	L_resume_2e1350:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1346, (u64)t__2e1348, (u64)t__2e1349, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e1352:;
+	t__2e1353 = (u64)((u64)t_abortsite_2e620 * (u64)((u64)16UL));
+	t__2e1353 = (u64)((u64)((u64)((char *)&D_abortsites_2e619)) + (u64)t__2e1353);
+	t__2e1354 = (u64)(*(u64 *)t__2e1353);
+	t__2e1355 = (u64)((u64)t__2e1353 + (u64)((u64)8UL));
+	t__2e1356 = (u64)(*(u32 *)t__2e1355);
+	t__2e1355 = (u64)((u64)t__2e1353 + (u64)((u64)12UL));
+	t__2e1357 = (u64)(*(u32 *)t__2e1355);
+	t_cleanup_2e627 = (u64)(u32)((u64)3UL);
+	goto L_defer_2e628;
+	L_resume_2e1358:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1354, (u64)t__2e1356, (u64)t__2e1357, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u64 F_foreach__large(u64 __rp) {
+	char A0[4100] __attribute__((aligned(16)));
+	char A1[4100] __attribute__((aligned(16)));
+	u64 t__2e1519;
+	u64 t__2e1520;
+	u64 t__2e1521;
+	u64 t__2e1524;
+	u64 t__2e1526;
+	u64 t__2e1528;
+	u64 t__2e1529;
+	u64 t_item_2e1527;
+	u64 t_item_2e1530;
+	u64 t_object_2e1525;
+	u64 t_object_2e1533;
+	L_start_2e1511:;
+	t_object_2e1525 = (u64)A0;
+	t_object_2e1533 = (u64)A1;
+	L_body_2e1512:;
+	t__2e1520 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e12)));
+	t__2e1519 = (u64)(u32)(((i32)t__2e1520 < (i32)((u64)4UL)));
+	t__2e1521 = (u64)(u32)((u8)t__2e1519);
+	if ((u32)t__2e1521) goto L_true_2e1516; else goto L_false_2e1517;
+	L_true_2e1516:;
+	t__2e1524 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e12)));
+	t__2e1524 = (u64)(u32)((u32)t__2e1524 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_static_2e12)) = (u32)t__2e1524;
+	*(u32 *)t_object_2e1525 = (u32)((u64)3020200671UL);
+	t__2e1526 = (u64)((u64)t_object_2e1525 + (u64)((u64)4UL));
+	t_item_2e1527 = (u64)((u64)t__2e1526 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1527 = (u32)((u64)12UL);
+	t__2e1528 = (u64)((u64)t__2e1526 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e1528, (u64)t_item_2e1527, (u64)((u64)4092UL));
+	t_item_2e1530 = (u64)((u64)t__2e1526 + (u64)((u64)0UL));
+	t__2e1529 = (u64)((u64)t__2e1526 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e1529, (u64)t_item_2e1530, (u64)((u64)4092UL));
+	BLIT(__rp, t_object_2e1525, 4100); return __rp;
+	L__2e1531:;
+	L__2e1522:;
+	L__2e1532:;
+	L_false_2e1517:;
+	L__2e1518:;
+	*(u32 *)t_object_2e1533 = (u32)((u64)3950255460UL);
+	BLIT(__rp, t_object_2e1533, 4100); return __rp;
+	L__2e1534:;
+	L__2e1513:;
+	L__2e1535:;
+	return 0;
+}
+static u64 F_foreach__next__void(u64 __rp) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e1544;
+	u64 t__2e1545;
+	u64 t__2e1546;
+	u64 t__2e1549;
+	u64 t_object_2e1550;
+	u64 t_object_2e1553;
+	L_start_2e1536:;
+	t_object_2e1550 = (u64)A0;
+	t_object_2e1553 = (u64)A1;
+	L_body_2e1537:;
+	t__2e1545 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e10)));
+	t__2e1544 = (u64)(u32)(((i32)t__2e1545 < (i32)((u64)4UL)));
+	t__2e1546 = (u64)(u32)((u8)t__2e1544);
+	if ((u32)t__2e1546) goto L_true_2e1541; else goto L_false_2e1542;
+	L_true_2e1541:;
+	t__2e1549 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e10)));
+	t__2e1549 = (u64)(u32)((u32)t__2e1549 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_static_2e10)) = (u32)t__2e1549;
+	*(u32 *)t_object_2e1550 = (u32)((u64)3012680272UL);
+	BLIT(__rp, t_object_2e1550, 4); return __rp;
+	L__2e1551:;
+	L__2e1547:;
+	L__2e1552:;
+	L_false_2e1542:;
+	L__2e1543:;
+	*(u32 *)t_object_2e1553 = (u32)((u64)3950255460UL);
+	BLIT(__rp, t_object_2e1553, 4); return __rp;
+	L__2e1554:;
+	L__2e1538:;
+	L__2e1555:;
+	return 0;
+}
+static u64 F_foreach__tuple(u64 __rp) {
+	char A0[96] __attribute__((aligned(16)));
+	char A1[40] __attribute__((aligned(16)));
+	char A2[40] __attribute__((aligned(16)));
+	u64 t__2e1569;
+	u64 t__2e1570;
+	u64 t__2e1571;
+	u64 t__2e1574;
+	u64 t__2e1576;
+	u64 t__2e1577;
+	u64 t__2e1578;
+	u64 t__2e1579;
+	u64 t__2e1580;
+	u64 t__2e1581;
+	u64 t__2e1587;
+	u64 t__2e1588;
+	u64 t__2e1589;
+	u64 t__2e1590;
+	u64 t__2e1591;
+	u64 t_abortsite_2e1585;
+	u64 t_binding_2e1560;
+	u64 t_item_2e1561;
+	u64 t_object_2e1575;
+	u64 t_object_2e1594;
+	u64 t_value_2e1562;
+	u64 t_value_2e1563;
+	u64 t_value_2e1564;
+	L_start_2e1556:;
+	t_binding_2e1560 = (u64)A0;
+	t_object_2e1575 = (u64)A1;
+	t_object_2e1594 = (u64)A2;
+	L_body_2e1557:;
+	t_item_2e1561 = (u64)((u64)t_binding_2e1560 + (u64)((u64)0UL));
+	t_value_2e1562 = (u64)((u64)t_item_2e1561 + (u64)((u64)0UL));
+	BLIT(t_value_2e1562, ((u64)((char *)&D_strliteral_2e587)), ((u64)24UL));
+	t_value_2e1562 = (u64)((u64)t_item_2e1561 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e1562 = (u32)((u64)1UL);
+	t_item_2e1561 = (u64)((u64)t_binding_2e1560 + (u64)((u64)32UL));
+	t_value_2e1563 = (u64)((u64)t_item_2e1561 + (u64)((u64)0UL));
+	BLIT(t_value_2e1563, ((u64)((char *)&D_strliteral_2e590)), ((u64)24UL));
+	t_value_2e1563 = (u64)((u64)t_item_2e1561 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e1563 = (u32)((u64)2UL);
+	t_item_2e1561 = (u64)((u64)t_binding_2e1560 + (u64)((u64)64UL));
+	t_value_2e1564 = (u64)((u64)t_item_2e1561 + (u64)((u64)0UL));
+	BLIT(t_value_2e1564, ((u64)((char *)&D_strliteral_2e593)), ((u64)24UL));
+	t_value_2e1564 = (u64)((u64)t_item_2e1561 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e1564 = (u32)((u64)3UL);
+	t__2e1570 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e11)));
+	t__2e1569 = (u64)(u32)(((i32)t__2e1570 < (i32)((u64)3UL)));
+	t__2e1571 = (u64)(u32)((u8)t__2e1569);
+	if ((u32)t__2e1571) goto L_true_2e1566; else goto L_false_2e1567;
+	L_true_2e1566:;
+	t__2e1574 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e11)));
+	t__2e1574 = (u64)(u32)((u32)t__2e1574 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_static_2e11)) = (u32)t__2e1574;
+	*(u32 *)t_object_2e1575 = (u32)((u64)3024295049UL);
+	t__2e1576 = (u64)((u64)t_object_2e1575 + (u64)((u64)8UL));
+	t__2e1579 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e11)));
+	t__2e1578 = (u64)(u32)((u32)t__2e1579 - (u32)((u64)1UL));
+	t__2e1580 = (u64)((i64)(i32)t__2e1578);
+	t__2e1577 = (u64)((u64)t__2e1580 * (u64)((u64)32UL));
+	t__2e1577 = (u64)((u64)t_binding_2e1560 + (u64)t__2e1577);
+	t__2e1581 = (u64)(u32)(((u64)t__2e1580 < (u64)((u64)3UL)));
+	if ((u32)t__2e1581) goto L__2e1583; else goto L__2e1582;
+	L__2e1582:;
+	t_abortsite_2e1585 = ((u64)0UL);
+	goto L_abort_2e1586;
+	L__2e1583:;
+	BLIT(t__2e1576, t__2e1577, ((u64)32UL));
+	BLIT(__rp, t_object_2e1575, 40); return __rp;
+	L__2e1592:;
+	L__2e1572:;
+	L__2e1593:;
+	L_false_2e1567:;
+	L__2e1568:;
+	*(u32 *)t_object_2e1594 = (u32)((u64)3950255460UL);
+	BLIT(__rp, t_object_2e1594, 40); return __rp;
+	L__2e1595:;
+	L__2e1558:;
+	L__2e1596:;
+	return 0;
+	L_abort_2e1586:;
+	t__2e1587 = (u64)((u64)t_abortsite_2e1585 * (u64)((u64)16UL));
+	t__2e1587 = (u64)((u64)((u64)((char *)&D_abortsites_2e1584)) + (u64)t__2e1587);
+	t__2e1588 = (u64)(*(u64 *)t__2e1587);
+	t__2e1589 = (u64)((u64)t__2e1587 + (u64)((u64)8UL));
+	t__2e1590 = (u64)(*(u32 *)t__2e1589);
+	t__2e1589 = (u64)((u64)t__2e1587 + (u64)((u64)12UL));
+	t__2e1591 = (u64)(*(u32 *)t__2e1589);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1588, (u64)t__2e1590, (u64)t__2e1591, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static u64 F_foreach__next__alias(u64 __rp) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e1605;
+	u64 t__2e1606;
+	u64 t__2e1607;
+	u64 t__2e1610;
+	u64 t__2e1612;
+	u64 t__2e1613;
+	u64 t_object_2e1611;
+	u64 t_object_2e1616;
+	L_start_2e1597:;
+	t_object_2e1611 = (u64)A0;
+	t_object_2e1616 = (u64)A1;
+	L_body_2e1598:;
+	t__2e1606 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e9)));
+	t__2e1605 = (u64)(u32)(((i32)t__2e1606 < (i32)((u64)4UL)));
+	t__2e1607 = (u64)(u32)((u8)t__2e1605);
+	if ((u32)t__2e1607) goto L_true_2e1602; else goto L_false_2e1603;
+	L_true_2e1602:;
+	t__2e1610 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e9)));
+	t__2e1610 = (u64)(u32)((u32)t__2e1610 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_static_2e9)) = (u32)t__2e1610;
+	*(u32 *)t_object_2e1611 = (u32)((u64)3260889625UL);
+	t__2e1612 = (u64)((u64)t_object_2e1611 + (u64)((u64)4UL));
+	t__2e1613 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e9)));
+	*(u32 *)t__2e1612 = (u32)t__2e1613;
+	BLIT(__rp, t_object_2e1611, 8); return __rp;
+	L__2e1614:;
+	L__2e1608:;
+	L__2e1615:;
+	L_false_2e1603:;
+	L__2e1604:;
+	*(u32 *)t_object_2e1616 = (u32)((u64)3950255460UL);
+	BLIT(__rp, t_object_2e1616, 8); return __rp;
+	L__2e1617:;
+	L__2e1599:;
+	L__2e1618:;
+	return 0;
+}
+static u64 F_foreach__next(u64 __rp) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e1627;
+	u64 t__2e1628;
+	u64 t__2e1629;
+	u64 t__2e1632;
+	u64 t__2e1634;
+	u64 t__2e1635;
+	u64 t_object_2e1633;
+	u64 t_object_2e1638;
+	L_start_2e1619:;
+	t_object_2e1633 = (u64)A0;
+	t_object_2e1638 = (u64)A1;
+	L_body_2e1620:;
+	t__2e1628 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e8)));
+	t__2e1627 = (u64)(u32)(((i32)t__2e1628 < (i32)((u64)4UL)));
+	t__2e1629 = (u64)(u32)((u8)t__2e1627);
+	if ((u32)t__2e1629) goto L_true_2e1624; else goto L_false_2e1625;
+	L_true_2e1624:;
+	t__2e1632 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e8)));
+	t__2e1632 = (u64)(u32)((u32)t__2e1632 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_static_2e8)) = (u32)t__2e1632;
+	*(u32 *)t_object_2e1633 = (u32)((u64)1099590421UL);
+	t__2e1634 = (u64)((u64)t_object_2e1633 + (u64)((u64)4UL));
+	t__2e1635 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e8)));
+	*(u32 *)t__2e1634 = (u32)t__2e1635;
+	BLIT(__rp, t_object_2e1633, 8); return __rp;
+	L__2e1636:;
+	L__2e1630:;
+	L__2e1637:;
+	L_false_2e1625:;
+	L__2e1626:;
+	*(u32 *)t_object_2e1638 = (u32)((u64)3950255460UL);
+	BLIT(__rp, t_object_2e1638, 8); return __rp;
+	L__2e1639:;
+	L__2e1621:;
+	L__2e1640:;
+	return 0;
+}
+static void F_result(void) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e1672;
+	u64 t__2e1685;
+	u64 t__2e1686;
+	u64 t__2e1687;
+	u64 t__2e1688;
+	u64 t__2e1689;
+	u64 t__2e1692;
+	u64 t__2e1693;
+	u64 t__2e1695;
+	u64 t__2e1696;
+	u64 t__2e1697;
+	u64 t__2e1698;
+	u64 t__2e1699;
+	u64 t_abortsite_2e1683;
+	u64 t_binding_2e1666;
+	L_start_2e1641:;
+	t_binding_2e1666 = (u64)A0;
+	L_body_2e1642:;
+	L_loop_2e1645:;
+	if ((u32)((u64)1UL)) goto L_body_2e1646; else goto L__2e1648;
+	L_body_2e1646:;
+	goto L__2e1648;
+	L__2e1650:;
+	L_after_2e1649:;
+	goto L_loop_2e1645;
+	L__2e1648:;
+	L_loop_2e1651:;
+	if ((u32)((u64)1UL)) goto L_body_2e1652; else goto L__2e1654;
+	L_body_2e1652:;
+	L_loop_2e1658:;
+	if ((u32)((u64)1UL)) goto L_body_2e1659; else goto L__2e1661;
+	L_body_2e1659:;
+	goto L__2e1654;
+	L__2e1663:;
+	L_after_2e1662:;
+	goto L_loop_2e1658;
+	L__2e1661:;
+	L__2e1664:;
+	L__2e1656:;
+	L__2e1665:;
+	L_after_2e1655:;
+	goto L_loop_2e1651;
+	L__2e1654:;
+	t__2e1672 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e1672) goto L_matches_2e1669; else goto L__2e1671;
+	L__2e1671:;
+	goto L_matches_2e1670;
+	L_matches_2e1669:;
+	*(u32 *)t_binding_2e1666 = (u32)((u64)0UL);
+	goto L__2e1673;
+	L__2e1674:;
+	L__2e1673:;
+	goto L__2e1667;
+	L_matches_2e1670:;
+	L_loop_2e1676:;
+	if ((u32)((u64)1UL)) goto L_body_2e1677; else goto L__2e1679;
+	L_body_2e1677:;
+	L_after_2e1680:;
+	goto L_loop_2e1676;
+	L__2e1679:;
+	L__2e1681:;
+	L__2e1675:;
+	L__2e1668:;
+	t_abortsite_2e1683 = ((u64)0UL);
+	goto L_abort_2e1684;
+	L__2e1667:;
+	t__2e1693 = (u64)(u32)(*(i32 *)t_binding_2e1666);
+	t__2e1692 = (u64)(u32)(((u32)t__2e1693 == (u32)((u64)0UL)));
+	if ((u32)t__2e1692) goto L_passed_2e1691; else goto L_failed_2e1690;
+	L_failed_2e1690:;
+	t_abortsite_2e1683 = ((u64)1UL);
+	goto L_abort_2e1694;
+	L_passed_2e1691:;
+	goto L__2e1643;
+	L__2e1700:;
+	L__2e1643:;
+	return;
+	L_abort_2e1684:;
+	t__2e1685 = (u64)((u64)t_abortsite_2e1683 * (u64)((u64)16UL));
+	t__2e1685 = (u64)((u64)((u64)((char *)&D_abortsites_2e1682)) + (u64)t__2e1685);
+	t__2e1686 = (u64)(*(u64 *)t__2e1685);
+	t__2e1687 = (u64)((u64)t__2e1685 + (u64)((u64)8UL));
+	t__2e1688 = (u64)(*(u32 *)t__2e1687);
+	t__2e1687 = (u64)((u64)t__2e1685 + (u64)((u64)12UL));
+	t__2e1689 = (u64)(*(u32 *)t__2e1687);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1686, (u64)t__2e1688, (u64)t__2e1689, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e1694:;
+	t__2e1695 = (u64)((u64)t_abortsite_2e1683 * (u64)((u64)16UL));
+	t__2e1695 = (u64)((u64)((u64)((char *)&D_abortsites_2e1682)) + (u64)t__2e1695);
+	t__2e1696 = (u64)(*(u64 *)t__2e1695);
+	t__2e1697 = (u64)((u64)t__2e1695 + (u64)((u64)8UL));
+	t__2e1698 = (u64)(*(u32 *)t__2e1697);
+	t__2e1697 = (u64)((u64)t__2e1695 + (u64)((u64)12UL));
+	t__2e1699 = (u64)(*(u32 *)t__2e1697);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1696, (u64)t__2e1698, (u64)t__2e1699, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_alias(void) {
+	L_start_2e1701:;
+	L_body_2e1702:;
+	L_loop_2e1705:;
+	if ((u32)((u64)1UL)) goto L_body_2e1706; else goto L__2e1708;
+	L_body_2e1706:;
+	return;
+	L__2e1712:;
+	L__2e1710:;
+	L__2e1713:;
+	L_after_2e1709:;
+	goto L_loop_2e1705;
+	L__2e1708:;
+	L__2e1714:;
+	L__2e1703:;
+	L__2e1715:;
+	return;
+}
+static void F_label(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	char A12[24] __attribute__((aligned(16)));
+	char A13[8] __attribute__((aligned(16)));
+	char A14[24] __attribute__((aligned(16)));
+	char A15[8] __attribute__((aligned(16)));
+	char A16[24] __attribute__((aligned(16)));
+	char B17[8] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char R20[4] __attribute__((aligned(16)));
+	char B21[8] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char R24[4] __attribute__((aligned(16)));
+	char B25[8] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char R28[4] __attribute__((aligned(16)));
+	char B29[8] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char B31[24] __attribute__((aligned(16)));
+	char R32[4] __attribute__((aligned(16)));
+	char B33[8] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char B35[24] __attribute__((aligned(16)));
+	char R36[4] __attribute__((aligned(16)));
+	char B37[8] __attribute__((aligned(16)));
+	char B38[24] __attribute__((aligned(16)));
+	char B39[24] __attribute__((aligned(16)));
+	char R40[4] __attribute__((aligned(16)));
+	char B41[8] __attribute__((aligned(16)));
+	char B42[24] __attribute__((aligned(16)));
+	char B43[24] __attribute__((aligned(16)));
+	char R44[4] __attribute__((aligned(16)));
+	u64 t__2e1726;
+	u64 t__2e1727;
+	u64 t__2e1736;
+	u64 t__2e1737;
+	u64 t__2e1740;
+	u64 t__2e1745;
+	u64 t__2e1746;
+	u64 t__2e1747;
+	u64 t__2e1756;
+	u64 t__2e1757;
+	u64 t__2e1764;
+	u64 t__2e1765;
+	u64 t__2e1766;
+	u64 t__2e1773;
+	u64 t__2e1774;
+	u64 t__2e1778;
+	u64 t__2e1779;
+	u64 t__2e1780;
+	u64 t__2e1781;
+	u64 t__2e1782;
+	u64 t__2e1784;
+	u64 t__2e1788;
+	u64 t__2e1789;
+	u64 t__2e1794;
+	u64 t__2e1795;
+	u64 t__2e1796;
+	u64 t__2e1802;
+	u64 t__2e1806;
+	u64 t__2e1807;
+	u64 t__2e1809;
+	u64 t__2e1811;
+	u64 t__2e1815;
+	u64 t__2e1824;
+	u64 t__2e1826;
+	u64 t__2e1828;
+	u64 t__2e1829;
+	u64 t__2e1830;
+	u64 t__2e1831;
+	u64 t__2e1832;
+	u64 t__2e1835;
+	u64 t__2e1836;
+	u64 t__2e1837;
+	u64 t__2e1838;
+	u64 t__2e1839;
+	u64 t__2e1841;
+	u64 t__2e1843;
+	u64 t__2e1847;
+	u64 t__2e1856;
+	u64 t__2e1858;
+	u64 t__2e1861;
+	u64 t__2e1863;
+	u64 t__2e1867;
+	u64 t__2e1876;
+	u64 t__2e1878;
+	u64 t__2e1881;
+	u64 t__2e1883;
+	u64 t__2e1887;
+	u64 t__2e1896;
+	u64 t__2e1898;
+	u64 t__2e1901;
+	u64 t__2e1903;
+	u64 t__2e1907;
+	u64 t__2e1916;
+	u64 t__2e1918;
+	u64 t__2e1921;
+	u64 t__2e1923;
+	u64 t__2e1927;
+	u64 t__2e1936;
+	u64 t__2e1938;
+	u64 t__2e1941;
+	u64 t__2e1943;
+	u64 t__2e1947;
+	u64 t__2e1956;
+	u64 t__2e1958;
+	u64 t_abortsite_2e1776;
+	u64 t_binding_2e1720;
+	u64 t_binding_2e1735;
+	u64 t_binding_2e1755;
+	u64 t_object_2e1810;
+	u64 t_object_2e1814;
+	u64 t_object_2e1842;
+	u64 t_object_2e1846;
+	u64 t_object_2e1862;
+	u64 t_object_2e1866;
+	u64 t_object_2e1882;
+	u64 t_object_2e1886;
+	u64 t_object_2e1902;
+	u64 t_object_2e1906;
+	u64 t_object_2e1922;
+	u64 t_object_2e1926;
+	u64 t_object_2e1942;
+	u64 t_object_2e1946;
+	u64 t_tag_2e1816;
+	u64 t_tag_2e1848;
+	u64 t_tag_2e1868;
+	u64 t_tag_2e1888;
+	u64 t_tag_2e1908;
+	u64 t_tag_2e1928;
+	u64 t_tag_2e1948;
+	L_start_2e1716:;
+	t_binding_2e1720 = (u64)A0;
+	t_binding_2e1735 = (u64)A1;
+	t_binding_2e1755 = (u64)A2;
+	t_object_2e1810 = (u64)A3;
+	t_object_2e1814 = (u64)A4;
+	t_object_2e1842 = (u64)A5;
+	t_object_2e1846 = (u64)A6;
+	t_object_2e1862 = (u64)A7;
+	t_object_2e1866 = (u64)A8;
+	t_object_2e1882 = (u64)A9;
+	t_object_2e1886 = (u64)A10;
+	t_object_2e1902 = (u64)A11;
+	t_object_2e1906 = (u64)A12;
+	t_object_2e1922 = (u64)A13;
+	t_object_2e1926 = (u64)A14;
+	t_object_2e1942 = (u64)A15;
+	t_object_2e1946 = (u64)A16;
+	L_body_2e1717:;
+	*(u32 *)t_binding_2e1720 = (u32)((u64)0UL);
+	L_loop_2e1721:;
+	t__2e1727 = (u64)(u32)(*(i32 *)t_binding_2e1720);
+	t__2e1726 = (u64)(u32)(((i32)t__2e1727 < (i32)((u64)10UL)));
+	if ((u32)t__2e1726) goto L_body_2e1722; else goto L__2e1724;
+	L_body_2e1722:;
+	*(u32 *)t_binding_2e1735 = (u32)((u64)0UL);
+	L_loop_2e1730:;
+	t__2e1737 = (u64)(u32)(*(i32 *)t_binding_2e1735);
+	t__2e1736 = (u64)(u32)(((i32)t__2e1737 < (i32)((u64)7UL)));
+	if ((u32)t__2e1736) goto L_body_2e1731; else goto L__2e1733;
+	L_body_2e1731:;
+	t__2e1740 = (u64)(u32)(*(i32 *)t_binding_2e1720);
+	t__2e1740 = (u64)(u32)((u32)t__2e1740 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1720 = (u32)t__2e1740;
+	t__2e1746 = (u64)(u32)(*(i32 *)t_binding_2e1735);
+	t__2e1745 = (u64)(u32)(((u32)t__2e1746 == (u32)((u64)6UL)));
+	t__2e1747 = (u64)(u32)((u8)t__2e1745);
+	if ((u32)t__2e1747) goto L_true_2e1742; else goto L_false_2e1743;
+	L_true_2e1742:;
+	*(u32 *)t_binding_2e1755 = (u32)((u64)0UL);
+	L_loop_2e1750:;
+	t__2e1757 = (u64)(u32)(*(i32 *)t_binding_2e1755);
+	t__2e1756 = (u64)(u32)(((i32)t__2e1757 < (i32)((u64)5UL)));
+	if ((u32)t__2e1756) goto L_body_2e1751; else goto L__2e1753;
+	L_body_2e1751:;
+	t__2e1765 = (u64)(u32)(*(i32 *)t_binding_2e1755);
+	t__2e1764 = (u64)(u32)(((u32)t__2e1765 == (u32)((u64)2UL)));
+	t__2e1766 = (u64)(u32)((u8)t__2e1764);
+	if ((u32)t__2e1766) goto L_true_2e1761; else goto L_false_2e1762;
+	L_true_2e1761:;
+	goto L_after_2e1734;
+	L__2e1769:;
+	L__2e1767:;
+	L__2e1770:;
+	L_false_2e1762:;
+	L__2e1763:;
+	t__2e1774 = (u64)(u32)(*(i32 *)t_binding_2e1755);
+	t__2e1773 = (u64)(u32)(((i32)t__2e1774 < (i32)((u64)2UL)));
+	if ((u32)t__2e1773) goto L_passed_2e1772; else goto L_failed_2e1771;
+	L_failed_2e1771:;
+	t_abortsite_2e1776 = ((u64)0UL);
+	goto L_abort_2e1777;
+	L_passed_2e1772:;
+	goto L__2e1758;
+	L__2e1783:;
+	L__2e1758:;
+	L_after_2e1754:;
+	t__2e1784 = (u64)(u32)(*(i32 *)t_binding_2e1755);
+	t__2e1784 = (u64)(u32)((u32)t__2e1784 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1755 = (u32)t__2e1784;
+	goto L_loop_2e1750;
+	L__2e1753:;
+	goto L__2e1748;
+	L__2e1785:;
+	L__2e1748:;
+	goto L__2e1744;
+	L_false_2e1743:;
+	L__2e1744:;
+	t__2e1789 = (u64)(u32)(*(i32 *)t_binding_2e1735);
+	t__2e1788 = (u64)(u32)(((u32)t__2e1789 != (u32)((u64)6UL)));
+	if ((u32)t__2e1788) goto L_passed_2e1787; else goto L_failed_2e1786;
+	L_failed_2e1786:;
+	t_abortsite_2e1776 = ((u64)1UL);
+	goto L_abort_2e1777;
+	L_passed_2e1787:;
+	t__2e1795 = (u64)(u32)(*(i32 *)t_binding_2e1720);
+	t__2e1794 = (u64)(u32)(((i32)t__2e1795 > (i32)((u64)7UL)));
+	t__2e1796 = (u64)(u32)((u8)t__2e1794);
+	if ((u32)t__2e1796) goto L_true_2e1791; else goto L_false_2e1792;
+	L_true_2e1791:;
+	goto L__2e1724;
+	L__2e1799:;
+	L__2e1797:;
+	L__2e1800:;
+	L_false_2e1792:;
+	L__2e1793:;
+	goto L__2e1738;
+	L__2e1801:;
+	L__2e1738:;
+	L_after_2e1734:;
+	t__2e1802 = (u64)(u32)(*(i32 *)t_binding_2e1735);
+	t__2e1802 = (u64)(u32)((u32)t__2e1802 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1735 = (u32)t__2e1802;
+	goto L_loop_2e1730;
+	L__2e1733:;
+	goto L__2e1728;
+	L__2e1803:;
+	L__2e1728:;
+	L_after_2e1725:;
+	goto L_loop_2e1721;
+	L__2e1724:;
+	t__2e1807 = (u64)(u32)(*(i32 *)t_binding_2e1720);
+	t__2e1806 = (u64)(u32)(((u32)t__2e1807 == (u32)((u64)8UL)));
+	if ((u32)t__2e1806) goto L_passed_2e1805; else goto L_failed_2e1804;
+	L_failed_2e1804:;
+	t_abortsite_2e1776 = ((u64)2UL);
+	goto L_abort_2e1777;
+	L_passed_2e1805:;
+	*(u32 *)t_object_2e1810 = (u32)((u64)3532310079UL);
+	t__2e1811 = (u64)((u64)t_object_2e1810 + (u64)((u64)4UL));
+	*(u32 *)t__2e1811 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1814 = (u64)((u64)0UL);
+	t__2e1815 = (u64)((u64)t_object_2e1814 + (u64)((u64)8UL));
+	*(u64 *)t__2e1815 = (u64)((u64)0UL);
+	t__2e1815 = (u64)((u64)t__2e1815 + (u64)((u64)8UL));
+	*(u64 *)t__2e1815 = (u64)((u64)0UL);
+	BLIT((u64)B17, t_object_2e1810, 8);
+	BLIT((u64)B18, ((u64)((char *)&D_strliteral_2e1813)), 24);
+	BLIT((u64)B19, t_object_2e1814, 24);
+	t__2e1809 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R20, (u64)B17, (u64)B18, (u64)B19);
+	t_tag_2e1816 = (u64)(*(u32 *)t__2e1809);
+	t__2e1824 = (u64)(u32)(((u32)t_tag_2e1816 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1824) goto L_member_2e1821; else goto L__2e1823;
+	L__2e1823:;
+	t__2e1826 = (u64)(u32)(((u32)t_tag_2e1816 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1826) goto L_member_2e1822; else goto L__2e1825;
+	L__2e1825:;
+	goto L_matches_2e1820;
+	L_member_2e1821:;
+	goto L_matches_2e1820;
+	L_member_2e1822:;
+	goto L_matches_2e1819;
+	L_matches_2e1819:;
+	goto L__2e1817;
+	L_matches_2e1820:;
+	t_abortsite_2e1776 = ((u64)3UL);
+	goto L_abort_2e1827;
+	L__2e1833:;
+	L__2e1818:;
+	t_abortsite_2e1776 = ((u64)4UL);
+	goto L_abort_2e1834;
+	L__2e1817:;
+	*(u32 *)t_object_2e1842 = (u32)((u64)3532310079UL);
+	t__2e1843 = (u64)((u64)t_object_2e1842 + (u64)((u64)4UL));
+	*(u32 *)t__2e1843 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1846 = (u64)((u64)0UL);
+	t__2e1847 = (u64)((u64)t_object_2e1846 + (u64)((u64)8UL));
+	*(u64 *)t__2e1847 = (u64)((u64)0UL);
+	t__2e1847 = (u64)((u64)t__2e1847 + (u64)((u64)8UL));
+	*(u64 *)t__2e1847 = (u64)((u64)0UL);
+	BLIT((u64)B21, t_object_2e1842, 8);
+	BLIT((u64)B22, ((u64)((char *)&D_strliteral_2e1845)), 24);
+	BLIT((u64)B23, t_object_2e1846, 24);
+	t__2e1841 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R24, (u64)B21, (u64)B22, (u64)B23);
+	t_tag_2e1848 = (u64)(*(u32 *)t__2e1841);
+	t__2e1856 = (u64)(u32)(((u32)t_tag_2e1848 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1856) goto L_member_2e1853; else goto L__2e1855;
+	L__2e1855:;
+	t__2e1858 = (u64)(u32)(((u32)t_tag_2e1848 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1858) goto L_member_2e1854; else goto L__2e1857;
+	L__2e1857:;
+	goto L_matches_2e1852;
+	L_member_2e1853:;
+	goto L_matches_2e1852;
+	L_member_2e1854:;
+	goto L_matches_2e1851;
+	L_matches_2e1851:;
+	goto L__2e1849;
+	L_matches_2e1852:;
+	t_abortsite_2e1776 = ((u64)5UL);
+	goto L_abort_2e1827;
+	L__2e1859:;
+	L__2e1850:;
+	t_abortsite_2e1776 = ((u64)6UL);
+	goto L_abort_2e1834;
+	L__2e1849:;
+	*(u32 *)t_object_2e1862 = (u32)((u64)3532310079UL);
+	t__2e1863 = (u64)((u64)t_object_2e1862 + (u64)((u64)4UL));
+	*(u32 *)t__2e1863 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1866 = (u64)((u64)0UL);
+	t__2e1867 = (u64)((u64)t_object_2e1866 + (u64)((u64)8UL));
+	*(u64 *)t__2e1867 = (u64)((u64)0UL);
+	t__2e1867 = (u64)((u64)t__2e1867 + (u64)((u64)8UL));
+	*(u64 *)t__2e1867 = (u64)((u64)0UL);
+	BLIT((u64)B25, t_object_2e1862, 8);
+	BLIT((u64)B26, ((u64)((char *)&D_strliteral_2e1865)), 24);
+	BLIT((u64)B27, t_object_2e1866, 24);
+	t__2e1861 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R28, (u64)B25, (u64)B26, (u64)B27);
+	t_tag_2e1868 = (u64)(*(u32 *)t__2e1861);
+	t__2e1876 = (u64)(u32)(((u32)t_tag_2e1868 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1876) goto L_member_2e1873; else goto L__2e1875;
+	L__2e1875:;
+	t__2e1878 = (u64)(u32)(((u32)t_tag_2e1868 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1878) goto L_member_2e1874; else goto L__2e1877;
+	L__2e1877:;
+	goto L_matches_2e1872;
+	L_member_2e1873:;
+	goto L_matches_2e1872;
+	L_member_2e1874:;
+	goto L_matches_2e1871;
+	L_matches_2e1871:;
+	goto L__2e1869;
+	L_matches_2e1872:;
+	t_abortsite_2e1776 = ((u64)7UL);
+	goto L_abort_2e1827;
+	L__2e1879:;
+	L__2e1870:;
+	t_abortsite_2e1776 = ((u64)8UL);
+	goto L_abort_2e1834;
+	L__2e1869:;
+	*(u32 *)t_object_2e1882 = (u32)((u64)3532310079UL);
+	t__2e1883 = (u64)((u64)t_object_2e1882 + (u64)((u64)4UL));
+	*(u32 *)t__2e1883 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1886 = (u64)((u64)0UL);
+	t__2e1887 = (u64)((u64)t_object_2e1886 + (u64)((u64)8UL));
+	*(u64 *)t__2e1887 = (u64)((u64)0UL);
+	t__2e1887 = (u64)((u64)t__2e1887 + (u64)((u64)8UL));
+	*(u64 *)t__2e1887 = (u64)((u64)0UL);
+	BLIT((u64)B29, t_object_2e1882, 8);
+	BLIT((u64)B30, ((u64)((char *)&D_strliteral_2e1885)), 24);
+	BLIT((u64)B31, t_object_2e1886, 24);
+	t__2e1881 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R32, (u64)B29, (u64)B30, (u64)B31);
+	t_tag_2e1888 = (u64)(*(u32 *)t__2e1881);
+	t__2e1896 = (u64)(u32)(((u32)t_tag_2e1888 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1896) goto L_member_2e1893; else goto L__2e1895;
+	L__2e1895:;
+	t__2e1898 = (u64)(u32)(((u32)t_tag_2e1888 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1898) goto L_member_2e1894; else goto L__2e1897;
+	L__2e1897:;
+	goto L_matches_2e1892;
+	L_member_2e1893:;
+	goto L_matches_2e1892;
+	L_member_2e1894:;
+	goto L_matches_2e1891;
+	L_matches_2e1891:;
+	goto L__2e1889;
+	L_matches_2e1892:;
+	t_abortsite_2e1776 = ((u64)9UL);
+	goto L_abort_2e1827;
+	L__2e1899:;
+	L__2e1890:;
+	t_abortsite_2e1776 = ((u64)10UL);
+	goto L_abort_2e1834;
+	L__2e1889:;
+	*(u32 *)t_object_2e1902 = (u32)((u64)3532310079UL);
+	t__2e1903 = (u64)((u64)t_object_2e1902 + (u64)((u64)4UL));
+	*(u32 *)t__2e1903 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1906 = (u64)((u64)0UL);
+	t__2e1907 = (u64)((u64)t_object_2e1906 + (u64)((u64)8UL));
+	*(u64 *)t__2e1907 = (u64)((u64)0UL);
+	t__2e1907 = (u64)((u64)t__2e1907 + (u64)((u64)8UL));
+	*(u64 *)t__2e1907 = (u64)((u64)0UL);
+	BLIT((u64)B33, t_object_2e1902, 8);
+	BLIT((u64)B34, ((u64)((char *)&D_strliteral_2e1905)), 24);
+	BLIT((u64)B35, t_object_2e1906, 24);
+	t__2e1901 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R36, (u64)B33, (u64)B34, (u64)B35);
+	t_tag_2e1908 = (u64)(*(u32 *)t__2e1901);
+	t__2e1916 = (u64)(u32)(((u32)t_tag_2e1908 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1916) goto L_member_2e1913; else goto L__2e1915;
+	L__2e1915:;
+	t__2e1918 = (u64)(u32)(((u32)t_tag_2e1908 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1918) goto L_member_2e1914; else goto L__2e1917;
+	L__2e1917:;
+	goto L_matches_2e1912;
+	L_member_2e1913:;
+	goto L_matches_2e1912;
+	L_member_2e1914:;
+	goto L_matches_2e1911;
+	L_matches_2e1911:;
+	goto L__2e1909;
+	L_matches_2e1912:;
+	t_abortsite_2e1776 = ((u64)11UL);
+	goto L_abort_2e1827;
+	L__2e1919:;
+	L__2e1910:;
+	t_abortsite_2e1776 = ((u64)12UL);
+	goto L_abort_2e1834;
+	L__2e1909:;
+	*(u32 *)t_object_2e1922 = (u32)((u64)3532310079UL);
+	t__2e1923 = (u64)((u64)t_object_2e1922 + (u64)((u64)4UL));
+	*(u32 *)t__2e1923 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1926 = (u64)((u64)0UL);
+	t__2e1927 = (u64)((u64)t_object_2e1926 + (u64)((u64)8UL));
+	*(u64 *)t__2e1927 = (u64)((u64)0UL);
+	t__2e1927 = (u64)((u64)t__2e1927 + (u64)((u64)8UL));
+	*(u64 *)t__2e1927 = (u64)((u64)0UL);
+	BLIT((u64)B37, t_object_2e1922, 8);
+	BLIT((u64)B38, ((u64)((char *)&D_strliteral_2e1925)), 24);
+	BLIT((u64)B39, t_object_2e1926, 24);
+	t__2e1921 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R40, (u64)B37, (u64)B38, (u64)B39);
+	t_tag_2e1928 = (u64)(*(u32 *)t__2e1921);
+	t__2e1936 = (u64)(u32)(((u32)t_tag_2e1928 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1936) goto L_member_2e1933; else goto L__2e1935;
+	L__2e1935:;
+	t__2e1938 = (u64)(u32)(((u32)t_tag_2e1928 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1938) goto L_member_2e1934; else goto L__2e1937;
+	L__2e1937:;
+	goto L_matches_2e1932;
+	L_member_2e1933:;
+	goto L_matches_2e1932;
+	L_member_2e1934:;
+	goto L_matches_2e1931;
+	L_matches_2e1931:;
+	goto L__2e1929;
+	L_matches_2e1932:;
+	t_abortsite_2e1776 = ((u64)13UL);
+	goto L_abort_2e1827;
+	L__2e1939:;
+	L__2e1930:;
+	t_abortsite_2e1776 = ((u64)14UL);
+	goto L_abort_2e1834;
+	L__2e1929:;
+	*(u32 *)t_object_2e1942 = (u32)((u64)3532310079UL);
+	t__2e1943 = (u64)((u64)t_object_2e1942 + (u64)((u64)4UL));
+	*(u32 *)t__2e1943 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1946 = (u64)((u64)0UL);
+	t__2e1947 = (u64)((u64)t_object_2e1946 + (u64)((u64)8UL));
+	*(u64 *)t__2e1947 = (u64)((u64)0UL);
+	t__2e1947 = (u64)((u64)t__2e1947 + (u64)((u64)8UL));
+	*(u64 *)t__2e1947 = (u64)((u64)0UL);
+	BLIT((u64)B41, t_object_2e1942, 8);
+	BLIT((u64)B42, ((u64)((char *)&D_strliteral_2e1945)), 24);
+	BLIT((u64)B43, t_object_2e1946, 24);
+	t__2e1941 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R44, (u64)B41, (u64)B42, (u64)B43);
+	t_tag_2e1948 = (u64)(*(u32 *)t__2e1941);
+	t__2e1956 = (u64)(u32)(((u32)t_tag_2e1948 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1956) goto L_member_2e1953; else goto L__2e1955;
+	L__2e1955:;
+	t__2e1958 = (u64)(u32)(((u32)t_tag_2e1948 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1958) goto L_member_2e1954; else goto L__2e1957;
+	L__2e1957:;
+	goto L_matches_2e1952;
+	L_member_2e1953:;
+	goto L_matches_2e1952;
+	L_member_2e1954:;
+	goto L_matches_2e1951;
+	L_matches_2e1951:;
+	goto L__2e1949;
+	L_matches_2e1952:;
+	t_abortsite_2e1776 = ((u64)15UL);
+	goto L_abort_2e1827;
+	L__2e1959:;
+	L__2e1950:;
+	t_abortsite_2e1776 = ((u64)16UL);
+	goto L_abort_2e1834;
+	L__2e1949:;
+	goto L__2e1718;
+	L__2e1960:;
+	L__2e1718:;
+	return;
+	L_abort_2e1777:;
+	t__2e1778 = (u64)((u64)t_abortsite_2e1776 * (u64)((u64)16UL));
+	t__2e1778 = (u64)((u64)((u64)((char *)&D_abortsites_2e1775)) + (u64)t__2e1778);
+	t__2e1779 = (u64)(*(u64 *)t__2e1778);
+	t__2e1780 = (u64)((u64)t__2e1778 + (u64)((u64)8UL));
+	t__2e1781 = (u64)(*(u32 *)t__2e1780);
+	t__2e1780 = (u64)((u64)t__2e1778 + (u64)((u64)12UL));
+	t__2e1782 = (u64)(*(u32 *)t__2e1780);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1779, (u64)t__2e1781, (u64)t__2e1782, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1827:;
+	t__2e1828 = (u64)((u64)t_abortsite_2e1776 * (u64)((u64)16UL));
+	t__2e1828 = (u64)((u64)((u64)((char *)&D_abortsites_2e1775)) + (u64)t__2e1828);
+	t__2e1829 = (u64)(*(u64 *)t__2e1828);
+	t__2e1830 = (u64)((u64)t__2e1828 + (u64)((u64)8UL));
+	t__2e1831 = (u64)(*(u32 *)t__2e1830);
+	t__2e1830 = (u64)((u64)t__2e1828 + (u64)((u64)12UL));
+	t__2e1832 = (u64)(*(u32 *)t__2e1830);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1829, (u64)t__2e1831, (u64)t__2e1832, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e1834:;
+	t__2e1835 = (u64)((u64)t_abortsite_2e1776 * (u64)((u64)16UL));
+	t__2e1835 = (u64)((u64)((u64)((char *)&D_abortsites_2e1775)) + (u64)t__2e1835);
+	t__2e1836 = (u64)(*(u64 *)t__2e1835);
+	t__2e1837 = (u64)((u64)t__2e1835 + (u64)((u64)8UL));
+	t__2e1838 = (u64)(*(u32 *)t__2e1837);
+	t__2e1837 = (u64)((u64)t__2e1835 + (u64)((u64)12UL));
+	t__2e1839 = (u64)(*(u32 *)t__2e1837);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1836, (u64)t__2e1838, (u64)t__2e1839, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F___continue(void) {
+	char A0[1] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	u64 t__2e1972;
+	u64 t__2e1973;
+	u64 t__2e1974;
+	u64 t__2e1983;
+	u64 t__2e1984;
+	u64 t__2e1991;
+	u64 t__2e1992;
+	u64 t__2e1993;
+	u64 t__2e2000;
+	u64 t__2e2001;
+	u64 t__2e2005;
+	u64 t__2e2006;
+	u64 t__2e2007;
+	u64 t__2e2008;
+	u64 t__2e2009;
+	u64 t__2e2011;
+	u64 t__2e2012;
+	u64 t__2e2016;
+	u64 t__2e2017;
+	u64 t_abortsite_2e2003;
+	u64 t_binding_2e1965;
+	u64 t_binding_2e1966;
+	u64 t_binding_2e1982;
+	L_start_2e1961:;
+	t_binding_2e1965 = (u64)A0;
+	t_binding_2e1966 = (u64)A1;
+	t_binding_2e1982 = (u64)A2;
+	L_body_2e1962:;
+	*(u8 *)t_binding_2e1965 = (u8)((u64)0UL);
+	*(u32 *)t_binding_2e1966 = (u32)((u64)0UL);
+	L_loop_2e1967:;
+	t__2e1972 = (u64)(u32)(*(u8 *)t_binding_2e1965);
+	t__2e1974 = (u64)(u32)((u8)t__2e1972);
+	t__2e1973 = (u64)(u32)(((u32)t__2e1974 == (u32)((u64)0UL)));
+	if ((u32)t__2e1973) goto L_body_2e1968; else goto L__2e1970;
+	L_body_2e1968:;
+	*(u32 *)t_binding_2e1982 = (u32)((u64)0UL);
+	L_loop_2e1977:;
+	t__2e1984 = (u64)(u32)(*(i32 *)t_binding_2e1982);
+	t__2e1983 = (u64)(u32)(((i32)t__2e1984 < (i32)((u64)10UL)));
+	if ((u32)t__2e1983) goto L_body_2e1978; else goto L__2e1980;
+	L_body_2e1978:;
+	t__2e1992 = (u64)(u32)(*(i32 *)t_binding_2e1982);
+	t__2e1991 = (u64)(u32)(((u32)t__2e1992 == (u32)((u64)5UL)));
+	t__2e1993 = (u64)(u32)((u8)t__2e1991);
+	if ((u32)t__2e1993) goto L_true_2e1988; else goto L_false_2e1989;
+	L_true_2e1988:;
+	goto L_after_2e1981;
+	L__2e1996:;
+	L__2e1994:;
+	L__2e1997:;
+	L_false_2e1989:;
+	L__2e1990:;
+	t__2e2001 = (u64)(u32)(*(i32 *)t_binding_2e1982);
+	t__2e2000 = (u64)(u32)(((u32)t__2e2001 != (u32)((u64)5UL)));
+	if ((u32)t__2e2000) goto L_passed_2e1999; else goto L_failed_2e1998;
+	L_failed_2e1998:;
+	t_abortsite_2e2003 = ((u64)0UL);
+	goto L_abort_2e2004;
+	L_passed_2e1999:;
+	goto L__2e1985;
+	L__2e2010:;
+	L__2e1985:;
+	L_after_2e1981:;
+	t__2e2011 = (u64)(u32)(*(i32 *)t_binding_2e1982);
+	t__2e2011 = (u64)(u32)((u32)t__2e2011 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1982 = (u32)t__2e2011;
+	goto L_loop_2e1977;
+	L__2e1980:;
+	*(u8 *)t_binding_2e1965 = (u8)((u64)1UL);
+	t__2e2012 = (u64)(u32)(*(i32 *)t_binding_2e1966);
+	t__2e2012 = (u64)(u32)((u32)t__2e2012 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1966 = (u32)t__2e2012;
+	goto L__2e1975;
+	L__2e2013:;
+	L__2e1975:;
+	L_after_2e1971:;
+	goto L_loop_2e1967;
+	L__2e1970:;
+	t__2e2017 = (u64)(u32)(*(i32 *)t_binding_2e1966);
+	t__2e2016 = (u64)(u32)(((u32)t__2e2017 == (u32)((u64)1UL)));
+	if ((u32)t__2e2016) goto L_passed_2e2015; else goto L_failed_2e2014;
+	L_failed_2e2014:;
+	t_abortsite_2e2003 = ((u64)1UL);
+	goto L_abort_2e2004;
+	L_passed_2e2015:;
+	goto L__2e1963;
+	L__2e2018:;
+	L__2e1963:;
+	return;
+	L_abort_2e2004:;
+	t__2e2005 = (u64)((u64)t_abortsite_2e2003 * (u64)((u64)16UL));
+	t__2e2005 = (u64)((u64)((u64)((char *)&D_abortsites_2e2002)) + (u64)t__2e2005);
+	t__2e2006 = (u64)(*(u64 *)t__2e2005);
+	t__2e2007 = (u64)((u64)t__2e2005 + (u64)((u64)8UL));
+	t__2e2008 = (u64)(*(u32 *)t__2e2007);
+	t__2e2007 = (u64)((u64)t__2e2005 + (u64)((u64)12UL));
+	t__2e2009 = (u64)(*(u32 *)t__2e2007);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2006, (u64)t__2e2008, (u64)t__2e2009, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F___break(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	u64 t__2e2030;
+	u64 t__2e2031;
+	u64 t__2e2040;
+	u64 t__2e2041;
+	u64 t__2e2044;
+	u64 t__2e2049;
+	u64 t__2e2050;
+	u64 t__2e2051;
+	u64 t__2e2059;
+	u64 t__2e2060;
+	u64 t__2e2064;
+	u64 t__2e2065;
+	u64 t__2e2066;
+	u64 t__2e2067;
+	u64 t__2e2068;
+	u64 t__2e2069;
+	u64 t__2e2071;
+	u64 t__2e2074;
+	u64 t__2e2075;
+	u64 t_abortsite_2e2062;
+	u64 t_binding_2e2023;
+	u64 t_binding_2e2029;
+	u64 t_binding_2e2034;
+	L_start_2e2019:;
+	t_binding_2e2023 = (u64)A0;
+	t_binding_2e2029 = (u64)A1;
+	t_binding_2e2034 = (u64)A2;
+	L_body_2e2020:;
+	*(u32 *)t_binding_2e2023 = (u32)((u64)0UL);
+	*(u32 *)t_binding_2e2029 = (u32)((u64)0UL);
+	L_loop_2e2024:;
+	t__2e2031 = (u64)(u32)(*(i32 *)t_binding_2e2029);
+	t__2e2030 = (u64)(u32)(((i32)t__2e2031 < (i32)((u64)1UL)));
+	if ((u32)t__2e2030) goto L_body_2e2025; else goto L__2e2027;
+	L_body_2e2025:;
+	*(u32 *)t_binding_2e2034 = (u32)((u64)0UL);
+	L_loop_2e2035:;
+	t__2e2041 = (u64)(u32)(*(i32 *)t_binding_2e2034);
+	t__2e2040 = (u64)(u32)(((i32)t__2e2041 < (i32)((u64)10UL)));
+	if ((u32)t__2e2040) goto L_body_2e2036; else goto L__2e2038;
+	L_body_2e2036:;
+	t__2e2044 = (u64)(u32)(*(i32 *)t_binding_2e2034);
+	t__2e2044 = (u64)(u32)((u32)t__2e2044 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e2034 = (u32)t__2e2044;
+	t__2e2050 = (u64)(u32)(*(i32 *)t_binding_2e2034);
+	t__2e2049 = (u64)(u32)(((u32)t__2e2050 == (u32)((u64)5UL)));
+	t__2e2051 = (u64)(u32)((u8)t__2e2049);
+	if ((u32)t__2e2051) goto L_true_2e2046; else goto L_false_2e2047;
+	L_true_2e2046:;
+	goto L__2e2038;
+	L__2e2054:;
+	L__2e2052:;
+	L__2e2055:;
+	L_false_2e2047:;
+	L__2e2048:;
+	goto L__2e2042;
+	L__2e2056:;
+	L__2e2042:;
+	L_after_2e2039:;
+	goto L_loop_2e2035;
+	L__2e2038:;
+	t__2e2060 = (u64)(u32)(*(i32 *)t_binding_2e2034);
+	t__2e2059 = (u64)(u32)(((u32)t__2e2060 == (u32)((u64)5UL)));
+	if ((u32)t__2e2059) goto L_passed_2e2058; else goto L_failed_2e2057;
+	L_failed_2e2057:;
+	t_abortsite_2e2062 = ((u64)0UL);
+	goto L_abort_2e2063;
+	L_passed_2e2058:;
+	t__2e2069 = (u64)(u32)(*(i32 *)t_binding_2e2023);
+	t__2e2069 = (u64)(u32)((u32)t__2e2069 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e2023 = (u32)t__2e2069;
+	goto L__2e2032;
+	L__2e2070:;
+	L__2e2032:;
+	L_after_2e2028:;
+	t__2e2071 = (u64)(u32)(*(i32 *)t_binding_2e2029);
+	t__2e2071 = (u64)(u32)((u32)t__2e2071 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e2029 = (u32)t__2e2071;
+	goto L_loop_2e2024;
+	L__2e2027:;
+	t__2e2075 = (u64)(u32)(*(i32 *)t_binding_2e2023);
+	t__2e2074 = (u64)(u32)(((u32)t__2e2075 == (u32)((u64)1UL)));
+	if ((u32)t__2e2074) goto L_passed_2e2073; else goto L_failed_2e2072;
+	L_failed_2e2072:;
+	t_abortsite_2e2062 = ((u64)1UL);
+	goto L_abort_2e2063;
+	L_passed_2e2073:;
+	goto L__2e2021;
+	L__2e2076:;
+	L__2e2021:;
+	return;
+	L_abort_2e2063:;
+	t__2e2064 = (u64)((u64)t_abortsite_2e2062 * (u64)((u64)16UL));
+	t__2e2064 = (u64)((u64)((u64)((char *)&D_abortsites_2e2061)) + (u64)t__2e2064);
+	t__2e2065 = (u64)(*(u64 *)t__2e2064);
+	t__2e2066 = (u64)((u64)t__2e2064 + (u64)((u64)8UL));
+	t__2e2067 = (u64)(*(u32 *)t__2e2066);
+	t__2e2066 = (u64)((u64)t__2e2064 + (u64)((u64)12UL));
+	t__2e2068 = (u64)(*(u32 *)t__2e2066);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2065, (u64)t__2e2067, (u64)t__2e2068, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_binding(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e2088;
+	u64 t__2e2089;
+	u64 t__2e2092;
+	u64 t__2e2093;
+	u64 t__2e2095;
+	u64 t__2e2098;
+	u64 t__2e2099;
+	u64 t__2e2103;
+	u64 t__2e2104;
+	u64 t__2e2105;
+	u64 t__2e2106;
+	u64 t__2e2107;
+	u64 t_abortsite_2e2101;
+	u64 t_binding_2e2081;
+	u64 t_binding_2e2087;
+	L_start_2e2077:;
+	t_binding_2e2081 = (u64)A0;
+	t_binding_2e2087 = (u64)A1;
+	L_body_2e2078:;
+	*(u32 *)t_binding_2e2081 = (u32)((u64)0UL);
+	*(u32 *)t_binding_2e2087 = (u32)((u64)0UL);
+	L_loop_2e2082:;
+	t__2e2089 = (u64)(u32)(*(i32 *)t_binding_2e2087);
+	t__2e2088 = (u64)(u32)(((i32)t__2e2089 < (i32)((u64)10UL)));
+	if ((u32)t__2e2088) goto L_body_2e2083; else goto L__2e2085;
+	L_body_2e2083:;
+	t__2e2092 = (u64)(u32)(*(i32 *)t_binding_2e2087);
+	t__2e2092 = (u64)(u32)((u32)t__2e2092 << (((u64)1UL) & 31));
+	*(u32 *)t_binding_2e2087 = (u32)t__2e2092;
+	t__2e2093 = (u64)(u32)(*(i32 *)t_binding_2e2081);
+	t__2e2093 = (u64)(u32)((u32)t__2e2093 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e2081 = (u32)t__2e2093;
+	goto L__2e2090;
+	L__2e2094:;
+	L__2e2090:;
+	L_after_2e2086:;
+	t__2e2095 = (u64)(u32)(*(i32 *)t_binding_2e2087);
+	t__2e2095 = (u64)(u32)((u32)t__2e2095 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e2087 = (u32)t__2e2095;
+	goto L_loop_2e2082;
+	L__2e2085:;
+	t__2e2099 = (u64)(u32)(*(i32 *)t_binding_2e2081);
+	t__2e2098 = (u64)(u32)(((u32)t__2e2099 == (u32)((u64)4UL)));
+	if ((u32)t__2e2098) goto L_passed_2e2097; else goto L_failed_2e2096;
+	L_failed_2e2096:;
+	t_abortsite_2e2101 = ((u64)0UL);
+	goto L_abort_2e2102;
+	L_passed_2e2097:;
+	goto L__2e2079;
+	L__2e2108:;
+	L__2e2079:;
+	return;
+	L_abort_2e2102:;
+	t__2e2103 = (u64)((u64)t_abortsite_2e2101 * (u64)((u64)16UL));
+	t__2e2103 = (u64)((u64)((u64)((char *)&D_abortsites_2e2100)) + (u64)t__2e2103);
+	t__2e2104 = (u64)(*(u64 *)t__2e2103);
+	t__2e2105 = (u64)((u64)t__2e2103 + (u64)((u64)8UL));
+	t__2e2106 = (u64)(*(u32 *)t__2e2105);
+	t__2e2105 = (u64)((u64)t__2e2103 + (u64)((u64)12UL));
+	t__2e2107 = (u64)(*(u32 *)t__2e2105);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2104, (u64)t__2e2106, (u64)t__2e2107, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_afterthought(void) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e2119;
+	u64 t__2e2120;
+	u64 t__2e2123;
+	u64 t__2e2125;
+	u64 t__2e2128;
+	u64 t__2e2129;
+	u64 t__2e2133;
+	u64 t__2e2134;
+	u64 t__2e2135;
+	u64 t__2e2136;
+	u64 t__2e2137;
+	u64 t_abortsite_2e2131;
+	u64 t_binding_2e2113;
+	L_start_2e2109:;
+	t_binding_2e2113 = (u64)A0;
+	L_body_2e2110:;
+	*(u32 *)t_binding_2e2113 = (u32)((u64)1UL);
+	L_loop_2e2114:;
+	t__2e2120 = (u64)(u32)(*(i32 *)t_binding_2e2113);
+	t__2e2119 = (u64)(u32)(((i32)t__2e2120 < (i32)((u64)5UL)));
+	if ((u32)t__2e2119) goto L_body_2e2115; else goto L__2e2117;
+	L_body_2e2115:;
+	t__2e2123 = (u64)(u32)(*(i32 *)t_binding_2e2113);
+	t__2e2123 = (u64)(u32)((u32)t__2e2123 << (((u64)1UL) & 31));
+	*(u32 *)t_binding_2e2113 = (u32)t__2e2123;
+	goto L__2e2121;
+	L__2e2124:;
+	L__2e2121:;
+	L_after_2e2118:;
+	t__2e2125 = (u64)(u32)(*(i32 *)t_binding_2e2113);
+	t__2e2125 = (u64)(u32)((u32)t__2e2125 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e2113 = (u32)t__2e2125;
+	goto L_loop_2e2114;
+	L__2e2117:;
+	t__2e2129 = (u64)(u32)(*(i32 *)t_binding_2e2113);
+	t__2e2128 = (u64)(u32)(((u32)t__2e2129 == (u32)((u64)7UL)));
+	if ((u32)t__2e2128) goto L_passed_2e2127; else goto L_failed_2e2126;
+	L_failed_2e2126:;
+	t_abortsite_2e2131 = ((u64)0UL);
+	goto L_abort_2e2132;
+	L_passed_2e2127:;
+	goto L__2e2111;
+	L__2e2138:;
+	L__2e2111:;
+	return;
+	L_abort_2e2132:;
+	t__2e2133 = (u64)((u64)t_abortsite_2e2131 * (u64)((u64)16UL));
+	t__2e2133 = (u64)((u64)((u64)((char *)&D_abortsites_2e2130)) + (u64)t__2e2133);
+	t__2e2134 = (u64)(*(u64 *)t__2e2133);
+	t__2e2135 = (u64)((u64)t__2e2133 + (u64)((u64)8UL));
+	t__2e2136 = (u64)(*(u32 *)t__2e2135);
+	t__2e2135 = (u64)((u64)t__2e2133 + (u64)((u64)12UL));
+	t__2e2137 = (u64)(*(u32 *)t__2e2135);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2134, (u64)t__2e2136, (u64)t__2e2137, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_conditional(void) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e2149;
+	u64 t__2e2150;
+	u64 t__2e2153;
+	u64 t__2e2157;
+	u64 t__2e2158;
+	u64 t__2e2162;
+	u64 t__2e2163;
+	u64 t__2e2164;
+	u64 t__2e2165;
+	u64 t__2e2166;
+	u64 t_abortsite_2e2160;
+	u64 t_binding_2e2143;
+	L_start_2e2139:;
+	t_binding_2e2143 = (u64)A0;
+	L_body_2e2140:;
+	*(u32 *)t_binding_2e2143 = (u32)((u64)1UL);
+	L_loop_2e2144:;
+	t__2e2150 = (u64)(u32)(*(i32 *)t_binding_2e2143);
+	t__2e2149 = (u64)(u32)(((i32)t__2e2150 < (i32)((u64)10UL)));
+	if ((u32)t__2e2149) goto L_body_2e2145; else goto L__2e2147;
+	L_body_2e2145:;
+	t__2e2153 = (u64)(u32)(*(i32 *)t_binding_2e2143);
+	t__2e2153 = (u64)(u32)((u32)t__2e2153 << (((u64)1UL) & 31));
+	*(u32 *)t_binding_2e2143 = (u32)t__2e2153;
+	goto L__2e2151;
+	L__2e2154:;
+	L__2e2151:;
+	L_after_2e2148:;
+	goto L_loop_2e2144;
+	L__2e2147:;
+	t__2e2158 = (u64)(u32)(*(i32 *)t_binding_2e2143);
+	t__2e2157 = (u64)(u32)(((u32)t__2e2158 == (u32)((u64)16UL)));
+	if ((u32)t__2e2157) goto L_passed_2e2156; else goto L_failed_2e2155;
+	L_failed_2e2155:;
+	t_abortsite_2e2160 = ((u64)0UL);
+	goto L_abort_2e2161;
+	L_passed_2e2156:;
+	goto L__2e2141;
+	L__2e2167:;
+	L__2e2141:;
+	return;
+	L_abort_2e2161:;
+	t__2e2162 = (u64)((u64)t_abortsite_2e2160 * (u64)((u64)16UL));
+	t__2e2162 = (u64)((u64)((u64)((char *)&D_abortsites_2e2159)) + (u64)t__2e2162);
+	t__2e2163 = (u64)(*(u64 *)t__2e2162);
+	t__2e2164 = (u64)((u64)t__2e2162 + (u64)((u64)8UL));
+	t__2e2165 = (u64)(*(u32 *)t__2e2164);
+	t__2e2164 = (u64)((u64)t__2e2162 + (u64)((u64)12UL));
+	t__2e2166 = (u64)(*(u32 *)t__2e2164);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2163, (u64)t__2e2165, (u64)t__2e2166, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_scope(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[4] __attribute__((aligned(16)));
+	char B5[8] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char R8[4] __attribute__((aligned(16)));
+	u64 t__2e2179;
+	u64 t__2e2180;
+	u64 t__2e2192;
+	u64 t__2e2193;
+	u64 t__2e2197;
+	u64 t__2e2198;
+	u64 t__2e2199;
+	u64 t__2e2200;
+	u64 t__2e2201;
+	u64 t__2e2204;
+	u64 t__2e2205;
+	u64 t__2e2209;
+	u64 t__2e2211;
+	u64 t__2e2213;
+	u64 t__2e2217;
+	u64 t__2e2226;
+	u64 t__2e2228;
+	u64 t__2e2230;
+	u64 t__2e2231;
+	u64 t__2e2232;
+	u64 t__2e2233;
+	u64 t__2e2234;
+	u64 t__2e2237;
+	u64 t__2e2238;
+	u64 t__2e2239;
+	u64 t__2e2240;
+	u64 t__2e2241;
+	u64 t__2e2252;
+	u64 t_abortsite_2e2195;
+	u64 t_binding_2e2172;
+	u64 t_binding_2e2178;
+	u64 t_binding_2e2247;
+	u64 t_object_2e2212;
+	u64 t_object_2e2216;
+	u64 t_tag_2e2218;
+	L_start_2e2168:;
+	t_binding_2e2172 = (u64)A0;
+	t_binding_2e2178 = (u64)A1;
+	t_object_2e2212 = (u64)A2;
+	t_object_2e2216 = (u64)A3;
+	t_binding_2e2247 = (u64)A4;
+	L_body_2e2169:;
+	*(u32 *)t_binding_2e2172 = (u32)((u64)0UL);
+	*(u32 *)t_binding_2e2178 = (u32)((u64)1UL);
+	L_loop_2e2173:;
+	t__2e2180 = (u64)(u32)(*(i32 *)t_binding_2e2178);
+	t__2e2179 = (u64)(u32)(((u32)t__2e2180 == (u32)((u64)1UL)));
+	if ((u32)t__2e2179) goto L_body_2e2174; else goto L__2e2176;
+	L_body_2e2174:;
+	L_loop_2e2183:;
+	if ((u32)((u64)1UL)) goto L_body_2e2184; else goto L__2e2186;
+	L_body_2e2184:;
+	t__2e2193 = (u64)(u32)(*(i32 *)t_binding_2e2172);
+	t__2e2192 = (u64)(u32)(((u32)t__2e2193 == (u32)((u64)0UL)));
+	if ((u32)t__2e2192) goto L_passed_2e2191; else goto L_failed_2e2190;
+	L_failed_2e2190:;
+	t_abortsite_2e2195 = ((u64)0UL);
+	goto L_abort_2e2196;
+	L_passed_2e2191:;
+	t__2e2205 = (u64)(u32)(*(i32 *)t_binding_2e2178);
+	t__2e2204 = (u64)(u32)(((u32)t__2e2205 == (u32)((u64)1UL)));
+	if ((u32)t__2e2204) goto L_passed_2e2203; else goto L_failed_2e2202;
+	L_failed_2e2202:;
+	t_abortsite_2e2195 = ((u64)1UL);
+	goto L_abort_2e2196;
+	L_passed_2e2203:;
+	goto L__2e2186;
+	L__2e2206:;
+	L__2e2188:;
+	L__2e2207:;
+	L_after_2e2187:;
+	goto L_loop_2e2183;
+	L__2e2186:;
+	goto L__2e2181;
+	L__2e2208:;
+	L__2e2181:;
+	L_after_2e2177:;
+	t__2e2209 = (u64)(u32)(*(i32 *)t_binding_2e2178);
+	t__2e2209 = (u64)(u32)((u32)t__2e2209 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e2178 = (u32)t__2e2209;
+	goto L_loop_2e2173;
+	L__2e2176:;
+	*(u32 *)t_object_2e2212 = (u32)((u64)3532310079UL);
+	t__2e2213 = (u64)((u64)t_object_2e2212 + (u64)((u64)4UL));
+	*(u32 *)t__2e2213 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e2216 = (u64)((u64)0UL);
+	t__2e2217 = (u64)((u64)t_object_2e2216 + (u64)((u64)8UL));
+	*(u64 *)t__2e2217 = (u64)((u64)0UL);
+	t__2e2217 = (u64)((u64)t__2e2217 + (u64)((u64)8UL));
+	*(u64 *)t__2e2217 = (u64)((u64)0UL);
+	BLIT((u64)B5, t_object_2e2212, 8);
+	BLIT((u64)B6, ((u64)((char *)&D_strliteral_2e2215)), 24);
+	BLIT((u64)B7, t_object_2e2216, 24);
+	t__2e2211 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R8, (u64)B5, (u64)B6, (u64)B7);
+	t_tag_2e2218 = (u64)(*(u32 *)t__2e2211);
+	t__2e2226 = (u64)(u32)(((u32)t_tag_2e2218 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e2226) goto L_member_2e2223; else goto L__2e2225;
+	L__2e2225:;
+	t__2e2228 = (u64)(u32)(((u32)t_tag_2e2218 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e2228) goto L_member_2e2224; else goto L__2e2227;
+	L__2e2227:;
+	goto L_matches_2e2222;
+	L_member_2e2223:;
+	goto L_matches_2e2222;
+	L_member_2e2224:;
+	goto L_matches_2e2221;
+	L_matches_2e2221:;
+	goto L__2e2219;
+	L_matches_2e2222:;
+	t_abortsite_2e2195 = ((u64)2UL);
+	goto L_abort_2e2229;
+	L__2e2235:;
+	L__2e2220:;
+	t_abortsite_2e2195 = ((u64)3UL);
+	goto L_abort_2e2236;
+	L__2e2219:;
+	*(u32 *)t_binding_2e2247 = (u32)((u64)0UL);
+	L_loop_2e2242:;
+	if ((u32)((u64)1UL)) goto L_body_2e2243; else goto L__2e2245;
+	L_body_2e2243:;
+	L_after_2e2246:;
+	t__2e2252 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e2252) goto L_true_2e2249; else goto L_false_2e2250;
+	L_true_2e2249:;
+	goto L__2e2245;
+	L__2e2255:;
+	L__2e2253:;
+	L__2e2256:;
+	L_false_2e2250:;
+	L__2e2251:;
+	goto L_loop_2e2242;
+	L__2e2245:;
+	goto L__2e2170;
+	L__2e2257:;
+	L__2e2170:;
+	return;
+	L_abort_2e2196:;
+	t__2e2197 = (u64)((u64)t_abortsite_2e2195 * (u64)((u64)16UL));
+	t__2e2197 = (u64)((u64)((u64)((char *)&D_abortsites_2e2194)) + (u64)t__2e2197);
+	t__2e2198 = (u64)(*(u64 *)t__2e2197);
+	t__2e2199 = (u64)((u64)t__2e2197 + (u64)((u64)8UL));
+	t__2e2200 = (u64)(*(u32 *)t__2e2199);
+	t__2e2199 = (u64)((u64)t__2e2197 + (u64)((u64)12UL));
+	t__2e2201 = (u64)(*(u32 *)t__2e2199);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2198, (u64)t__2e2200, (u64)t__2e2201, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e2229:;
+	t__2e2230 = (u64)((u64)t_abortsite_2e2195 * (u64)((u64)16UL));
+	t__2e2230 = (u64)((u64)((u64)((char *)&D_abortsites_2e2194)) + (u64)t__2e2230);
+	t__2e2231 = (u64)(*(u64 *)t__2e2230);
+	t__2e2232 = (u64)((u64)t__2e2230 + (u64)((u64)8UL));
+	t__2e2233 = (u64)(*(u32 *)t__2e2232);
+	t__2e2232 = (u64)((u64)t__2e2230 + (u64)((u64)12UL));
+	t__2e2234 = (u64)(*(u32 *)t__2e2232);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2231, (u64)t__2e2233, (u64)t__2e2234, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e2236:;
+	t__2e2237 = (u64)((u64)t_abortsite_2e2195 * (u64)((u64)16UL));
+	t__2e2237 = (u64)((u64)((u64)((char *)&D_abortsites_2e2194)) + (u64)t__2e2237);
+	t__2e2238 = (u64)(*(u64 *)t__2e2237);
+	t__2e2239 = (u64)((u64)t__2e2237 + (u64)((u64)8UL));
+	t__2e2240 = (u64)(*(u32 *)t__2e2239);
+	t__2e2239 = (u64)((u64)t__2e2237 + (u64)((u64)12UL));
+	t__2e2241 = (u64)(*(u32 *)t__2e2239);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2238, (u64)t__2e2240, (u64)t__2e2241, (u64)((u64)4UL));
+	__builtin_trap();
+}
@@ -0,0 +1,3001 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e25 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e60 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_abortsites_2e126 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e158 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e201 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; };
+struct __attribute__((packed)) S_strdata_2e293 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[25]; u8 f6; u8 f7; u8 f8; u8 f9; u8 f10[26]; u8 f11; u8 f12; u8 f13; u8 f14[2]; };
+struct __attribute__((packed)) S_strliteral_2e294 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e329 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[25]; u8 f6; u8 f7; u8 f8; u8 f9; u8 f10[18]; u8 f11; u8 f12; u8 f13; u8 f14[2]; };
+struct __attribute__((packed)) S_strliteral_2e330 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e349 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[25]; u8 f6; u8 f7; u8 f8; u8 f9; u8 f10[31]; u8 f11; u8 f12; u8 f13; u8 f14[2]; };
+struct __attribute__((packed)) S_strliteral_2e350 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e369 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[25]; u8 f6; u8 f7; u8 f8; u8 f9; u8 f10[24]; u8 f11; u8 f12; u8 f13; u8 f14[2]; };
+struct __attribute__((packed)) S_strliteral_2e370 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e389 { u8 f0[29]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[5]; u8 f6; u8 f7; u8 f8; u8 f9[2]; };
+struct __attribute__((packed)) S_strliteral_2e390 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e409 { u8 f0[27]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[5]; u8 f6; u8 f7; u8 f8; u8 f9[2]; };
+struct __attribute__((packed)) S_strliteral_2e410 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e429 { u8 f0[36]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[5]; u8 f6; u8 f7; u8 f8; u8 f9[2]; };
+struct __attribute__((packed)) S_strliteral_2e430 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e449 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[42]; u8 f6; u8 f7; u8 f8; u8 f9[2]; };
+struct __attribute__((packed)) S_strliteral_2e450 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e469 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[24]; u8 f6; u8 f7; u8 f8; u8 f9; u8 f10[21]; u8 f11; u8 f12; u8 f13; u8 f14[2]; };
+struct __attribute__((packed)) S_strliteral_2e470 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e310 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; };
+struct __attribute__((packed)) S_abortsites_2e505 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e548 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; };
+struct __attribute__((packed)) S_abortsites_2e674 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; };
+struct __attribute__((packed)) S_abortsites_2e851 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; };
+struct __attribute__((packed)) S_abortsites_2e943 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_strdata_2e1013 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[24]; u8 f6; u8 f7; u8 f8; u8 f9[2]; };
+struct __attribute__((packed)) S_strliteral_2e1014 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1047 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4; u8 f5[31]; u8 f6; u8 f7; u8 f8; u8 f9; u8 f10[22]; u8 f11; u8 f12; u8 f13; u8 f14[2]; };
+struct __attribute__((packed)) S_strliteral_2e1048 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1028 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; };
+struct __attribute__((packed)) S_abortsites_2e1154 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e1203 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; };
+struct __attribute__((packed)) S_abortsites_2e1305 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e25 D_abortsites_2e25 __asm__("abortsites.25") __attribute__((used, section(".data.rel.ro.abortsites.25"), aligned(8)));
+static struct S_abortsites_2e60 D_abortsites_2e60 __asm__("abortsites.60") __attribute__((used, section(".data.rel.ro.abortsites.60"), aligned(8)));
+static struct S_abortsites_2e126 D_abortsites_2e126 __asm__("abortsites.126") __attribute__((used, section(".data.rel.ro.abortsites.126"), aligned(8)));
+static struct S_abortsites_2e158 D_abortsites_2e158 __asm__("abortsites.158") __attribute__((used, section(".data.rel.ro.abortsites.158"), aligned(8)));
+static struct S_abortsites_2e201 D_abortsites_2e201 __asm__("abortsites.201") __attribute__((used, section(".data.rel.ro.abortsites.201"), aligned(8)));
+static const struct S_strdata_2e293 D_strdata_2e293 __asm__("strdata.293") __attribute__((used, section(".rodata.strdata.293"), aligned(8)));
+static struct S_strliteral_2e294 D_strliteral_2e294 __asm__("strliteral.294") __attribute__((used, section(".data.rel.ro.strliteral.294"), aligned(8)));
+static const struct S_strdata_2e329 D_strdata_2e329 __asm__("strdata.329") __attribute__((used, section(".rodata.strdata.329"), aligned(8)));
+static struct S_strliteral_2e330 D_strliteral_2e330 __asm__("strliteral.330") __attribute__((used, section(".data.rel.ro.strliteral.330"), aligned(8)));
+static const struct S_strdata_2e349 D_strdata_2e349 __asm__("strdata.349") __attribute__((used, section(".rodata.strdata.349"), aligned(8)));
+static struct S_strliteral_2e350 D_strliteral_2e350 __asm__("strliteral.350") __attribute__((used, section(".data.rel.ro.strliteral.350"), aligned(8)));
+static const struct S_strdata_2e369 D_strdata_2e369 __asm__("strdata.369") __attribute__((used, section(".rodata.strdata.369"), aligned(8)));
+static struct S_strliteral_2e370 D_strliteral_2e370 __asm__("strliteral.370") __attribute__((used, section(".data.rel.ro.strliteral.370"), aligned(8)));
+static const struct S_strdata_2e389 D_strdata_2e389 __asm__("strdata.389") __attribute__((used, section(".rodata.strdata.389"), aligned(8)));
+static struct S_strliteral_2e390 D_strliteral_2e390 __asm__("strliteral.390") __attribute__((used, section(".data.rel.ro.strliteral.390"), aligned(8)));
+static const struct S_strdata_2e409 D_strdata_2e409 __asm__("strdata.409") __attribute__((used, section(".rodata.strdata.409"), aligned(8)));
+static struct S_strliteral_2e410 D_strliteral_2e410 __asm__("strliteral.410") __attribute__((used, section(".data.rel.ro.strliteral.410"), aligned(8)));
+static const struct S_strdata_2e429 D_strdata_2e429 __asm__("strdata.429") __attribute__((used, section(".rodata.strdata.429"), aligned(8)));
+static struct S_strliteral_2e430 D_strliteral_2e430 __asm__("strliteral.430") __attribute__((used, section(".data.rel.ro.strliteral.430"), aligned(8)));
+static const struct S_strdata_2e449 D_strdata_2e449 __asm__("strdata.449") __attribute__((used, section(".rodata.strdata.449"), aligned(8)));
+static struct S_strliteral_2e450 D_strliteral_2e450 __asm__("strliteral.450") __attribute__((used, section(".data.rel.ro.strliteral.450"), aligned(8)));
+static const struct S_strdata_2e469 D_strdata_2e469 __asm__("strdata.469") __attribute__((used, section(".rodata.strdata.469"), aligned(8)));
+static struct S_strliteral_2e470 D_strliteral_2e470 __asm__("strliteral.470") __attribute__((used, section(".data.rel.ro.strliteral.470"), aligned(8)));
+static struct S_abortsites_2e310 D_abortsites_2e310 __asm__("abortsites.310") __attribute__((used, section(".data.rel.ro.abortsites.310"), aligned(8)));
+static struct S_abortsites_2e505 D_abortsites_2e505 __asm__("abortsites.505") __attribute__((used, section(".data.rel.ro.abortsites.505"), aligned(8)));
+static struct S_abortsites_2e548 D_abortsites_2e548 __asm__("abortsites.548") __attribute__((used, section(".data.rel.ro.abortsites.548"), aligned(8)));
+static struct S_abortsites_2e674 D_abortsites_2e674 __asm__("abortsites.674") __attribute__((used, section(".data.rel.ro.abortsites.674"), aligned(8)));
+static struct S_abortsites_2e851 D_abortsites_2e851 __asm__("abortsites.851") __attribute__((used, section(".data.rel.ro.abortsites.851"), aligned(8)));
+static struct S_abortsites_2e943 D_abortsites_2e943 __asm__("abortsites.943") __attribute__((used, section(".data.rel.ro.abortsites.943"), aligned(8)));
+static const struct S_strdata_2e1013 D_strdata_2e1013 __asm__("strdata.1013") __attribute__((used, section(".rodata.strdata.1013"), aligned(8)));
+static struct S_strliteral_2e1014 D_strliteral_2e1014 __asm__("strliteral.1014") __attribute__((used, section(".data.rel.ro.strliteral.1014"), aligned(8)));
+static const struct S_strdata_2e1047 D_strdata_2e1047 __asm__("strdata.1047") __attribute__((used, section(".rodata.strdata.1047"), aligned(8)));
+static struct S_strliteral_2e1048 D_strliteral_2e1048 __asm__("strliteral.1048") __attribute__((used, section(".data.rel.ro.strliteral.1048"), aligned(8)));
+static struct S_abortsites_2e1028 D_abortsites_2e1028 __asm__("abortsites.1028") __attribute__((used, section(".data.rel.ro.abortsites.1028"), aligned(8)));
+static struct S_abortsites_2e1154 D_abortsites_2e1154 __asm__("abortsites.1154") __attribute__((used, section(".data.rel.ro.abortsites.1154"), aligned(8)));
+static struct S_abortsites_2e1203 D_abortsites_2e1203 __asm__("abortsites.1203") __attribute__((used, section(".data.rel.ro.abortsites.1203"), aligned(8)));
+static struct S_abortsites_2e1305 D_abortsites_2e1305 __asm__("abortsites.1305") __attribute__((used, section(".data.rel.ro.abortsites.1305"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+u64 F_abi4(u64 __rp, u64 p_t4) __asm__("abi4") __attribute__((used, section(".text.abi4")));
+static void F_abi(void) __asm__("abi") __attribute__((used, section(".text.abi")));
+static u64 F_abi8__v8(u64 __rp, u64 p_t8) __asm__("abi8_v8") __attribute__((used, section(".text.abi8_v8")));
+static u64 F_abi8__v4(u64 __rp, u64 p_t8) __asm__("abi8_v4") __attribute__((used, section(".text.abi8_v4")));
+static void F_translation(void) __asm__("translation") __attribute__((used, section(".text.translation")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_assertions(void) __asm__("assertions") __attribute__((used, section(".text.assertions")));
+static void F_castout(void) __asm__("castout") __attribute__((used, section(".text.castout")));
+static void F_subsetcast(void) __asm__("subsetcast") __attribute__((used, section(".text.subsetcast")));
+static void F_membercast(void) __asm__("membercast") __attribute__((used, section(".text.membercast")));
+static void F_casts(void) __asm__("casts") __attribute__((used, section(".text.casts")));
+static void F_reduction(void) __asm__("reduction") __attribute__((used, section(".text.reduction")));
+static void F_operators(void) __asm__("operators") __attribute__((used, section(".text.operators")));
+static void F_storage(void) __asm__("storage") __attribute__((used, section(".text.storage")));
+static void F_measurements(void) __asm__("measurements") __attribute__((used, section(".text.measurements")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\061\063\055\164\141\147\147\145\144\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 18U, 18U };
+static struct S_abortsites_2e25 D_abortsites_2e25 = { (char *)((char *)&D_strliteral_2e1) + 0, 315U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 315U, 15U };
+static struct S_abortsites_2e60 D_abortsites_2e60 = { (char *)((char *)&D_strliteral_2e1) + 0, 330U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 330U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 331U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 331U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 332U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 332U, 15U };
+static struct S_abortsites_2e126 D_abortsites_2e126 = { (char *)((char *)&D_strliteral_2e1) + 0, 325U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 325U, 15U };
+static struct S_abortsites_2e158 D_abortsites_2e158 = { (char *)((char *)&D_strliteral_2e1) + 0, 320U, 21U, (char *)((char *)&D_strliteral_2e1) + 0, 320U, 15U };
+static struct S_abortsites_2e201 D_abortsites_2e201 = { (char *)((char *)&D_strliteral_2e1) + 0, 300U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 300U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 301U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 302U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 303U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 303U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 304U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 305U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 306U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 306U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 307U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 308U, 15U };
+static const struct S_strdata_2e293 D_strdata_2e293 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\050\165\070\040\174\040\165\061\066\051\040\075\040\064\062\165\070\073", 10U, 9U, 9U, 9U, "\154\145\164\040\142\040\075\040\141\040\141\163\040\050\163\164\162\040\174\040\166\157\151\144\051\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e294 D_strliteral_2e294 = { (char *)((char *)&D_strdata_2e293) + 0, 82U, 82U };
+static const struct S_strdata_2e329 D_strdata_2e329 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\050\165\070\040\174\040\165\061\066\051\040\075\040\064\062\165\070\073", 10U, 9U, 9U, 9U, "\154\145\164\040\142\040\075\040\141\040\141\163\040\052\163\164\162\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e330 D_strliteral_2e330 = { (char *)((char *)&D_strdata_2e329) + 0, 74U, 74U };
+static const struct S_strdata_2e349 D_strdata_2e349 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\050\165\070\040\174\040\165\061\066\051\040\075\040\064\062\165\070\073", 10U, 9U, 9U, 9U, "\154\145\164\040\142\040\075\040\141\040\141\163\040\050\165\070\040\174\040\165\061\066\040\174\040\166\157\151\144\051\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e350 D_strliteral_2e350 = { (char *)((char *)&D_strdata_2e349) + 0, 87U, 87U };
+static const struct S_strdata_2e369 D_strdata_2e369 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\050\165\070\040\174\040\165\061\066\051\040\075\040\064\062\165\070\073", 10U, 9U, 9U, 9U, "\154\145\164\040\142\040\075\040\141\040\141\163\040\050\165\070\040\174\040\165\061\066\051\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e370 D_strliteral_2e370 = { (char *)((char *)&D_strdata_2e369) + 0, 80U, 80U };
+static const struct S_strdata_2e389 D_strdata_2e389 = { "\146\156\040\164\145\163\164\050\051\040\050\166\157\151\144\040\174\040\133\052\135\151\156\164\051\040\075\040\173", 10U, 9U, 9U, 9U, "\166\157\151\144\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e390 D_strliteral_2e390 = { (char *)((char *)&D_strdata_2e389) + 0, 43U, 43U };
+static const struct S_strdata_2e409 D_strdata_2e409 = { "\146\156\040\164\145\163\164\050\051\040\050\166\157\151\144\040\174\040\166\157\151\144\051\040\075\040\173", 10U, 9U, 9U, 9U, "\166\157\151\144\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e410 D_strliteral_2e410 = { (char *)((char *)&D_strdata_2e409) + 0, 41U, 41U };
+static const struct S_strdata_2e429 D_strdata_2e429 = { "\146\156\040\164\145\163\164\050\051\040\050\050\166\157\151\144\040\174\040\166\157\151\144\051\040\174\040\166\157\151\144\051\040\075\040\173", 10U, 9U, 9U, 9U, "\166\157\151\144\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e430 D_strliteral_2e430 = { (char *)((char *)&D_strdata_2e429) + 0, 50U, 50U };
+static const struct S_strdata_2e449 D_strdata_2e449 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\040\075\040\063\072\040\050\151\156\164\040\174\040\166\157\151\144\051\040\053\040\065\072\040\050\151\156\164\040\174\040\166\157\151\144\051\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e450 D_strliteral_2e450 = { (char *)((char *)&D_strdata_2e449) + 0, 69U, 69U };
+static const struct S_strdata_2e469 D_strdata_2e469 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\040\075\040\063\072\040\050\151\156\164\040\174\040\166\157\151\144\051\073", 10U, 9U, 9U, 9U, "\170\040\053\075\040\065\072\040\050\151\156\164\040\174\040\166\157\151\144\051\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e470 D_strliteral_2e470 = { (char *)((char *)&D_strdata_2e469) + 0, 76U, 76U };
+static struct S_abortsites_2e310 D_abortsites_2e310 = { (char *)((char *)&D_strliteral_2e1) + 0, 231U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 231U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 239U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 239U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 247U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 247U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 255U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 255U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 262U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 262U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 269U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 269U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 274U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 274U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 280U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 280U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 286U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 286U, 11U };
+static struct S_abortsites_2e505 D_abortsites_2e505 = { (char *)((char *)&D_strliteral_2e1) + 0, 220U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 221U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 221U, 15U };
+static struct S_abortsites_2e548 D_abortsites_2e548 = { (char *)((char *)&D_strliteral_2e1) + 0, 201U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 202U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 202U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 203U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 207U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 207U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 208U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 209U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 213U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 213U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 215U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 215U, 15U };
+static struct S_abortsites_2e674 D_abortsites_2e674 = { (char *)((char *)&D_strliteral_2e1) + 0, 165U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 166U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 169U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 169U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 170U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 170U, 37U, (char *)((char *)&D_strliteral_2e1) + 0, 170U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 171U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 182U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 186U, 34U, (char *)((char *)&D_strliteral_2e1) + 0, 186U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 187U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 187U, 36U, (char *)((char *)&D_strliteral_2e1) + 0, 187U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 188U, 15U };
+static struct S_abortsites_2e851 D_abortsites_2e851 = { (char *)((char *)&D_strliteral_2e1) + 0, 125U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 127U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 128U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 139U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 140U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 142U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 151U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 152U, 15U };
+static struct S_abortsites_2e943 D_abortsites_2e943 = { (char *)((char *)&D_strliteral_2e1) + 0, 102U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 15U };
+static const struct S_strdata_2e1013 D_strdata_2e1013 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\050\165\070\040\174\040\165\070\051\040\075\040\064\062\165\070\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e1014 D_strliteral_2e1014 = { (char *)((char *)&D_strdata_2e1013) + 0, 51U, 51U };
+static const struct S_strdata_2e1047 D_strdata_2e1047 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\050\151\070\040\174\040\151\061\066\040\174\040\151\063\062\051\040\075\040\064\062\151\070\073", 10U, 9U, 9U, 9U, "\154\145\164\040\142\072\040\050\151\070\040\174\040\151\061\066\051\040\075\040\141\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e1048 D_strliteral_2e1048 = { (char *)((char *)&D_strdata_2e1047) + 0, 84U, 84U };
+static struct S_abortsites_2e1028 D_abortsites_2e1028 = { (char *)((char *)&D_strliteral_2e1) + 0, 84U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 84U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 91U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 91U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 92U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 93U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 95U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 97U, 15U };
+static struct S_abortsites_2e1154 D_abortsites_2e1154 = { (char *)((char *)&D_strliteral_2e1) + 0, 61U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 63U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 65U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 67U, 15U };
+static struct S_abortsites_2e1203 D_abortsites_2e1203 = { (char *)((char *)&D_strliteral_2e1) + 0, 38U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 40U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 41U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 43U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 44U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 48U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 55U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 56U, 15U };
+static struct S_abortsites_2e1305 D_abortsites_2e1305 = { (char *)((char *)&D_strliteral_2e1) + 0, 17U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 18U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 20U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 23U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 24U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_measurements)))();
+	((void (*)(void))((u64)((char *)&F_storage)))();
+	((void (*)(void))((u64)((char *)&F_operators)))();
+	((void (*)(void))((u64)((char *)&F_reduction)))();
+	((void (*)(void))((u64)((char *)&F_casts)))();
+	((void (*)(void))((u64)((char *)&F_membercast)))();
+	((void (*)(void))((u64)((char *)&F_subsetcast)))();
+	((void (*)(void))((u64)((char *)&F_castout)))();
+	((void (*)(void))((u64)((char *)&F_assertions)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	((void (*)(void))((u64)((char *)&F_translation)))();
+	((void (*)(void))((u64)((char *)&F_abi)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+u64 F_abi4(u64 __rp, u64 p_t4) {
+	u64 t__2e16;
+	u64 t__2e17;
+	u64 t__2e18;
+	u64 t__2e22;
+	u64 t__2e28;
+	u64 t__2e29;
+	u64 t__2e30;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t__2e33;
+	u64 t__2e35;
+	u64 t__2e36;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e39;
+	u64 t_abortsite_2e26;
+	u64 t_subval_2e21;
+	u64 t_t4;
+	t_t4 = p_t4;
+	L_start_2e7:;
+	L_body_2e11:;
+	t__2e17 = t_t4;
+	t__2e18 = (u64)(u32)(*(u32 *)t_t4);
+	t_subval_2e21 = t_t4;
+	t__2e22 = (u64)(u32)(((u32)t__2e18 == (u32)((u64)1399468992UL)));
+	if ((u32)t__2e22) goto L_subtype_2e24; else goto L_failed_2e20;
+	L_subtype_2e24:;
+	goto L_passed_2e19;
+	L_failed_2e20:;
+	t_abortsite_2e26 = ((u64)0UL);
+	goto L_abort_2e27;
+	L_passed_2e19:;
+	t__2e17 = (u64)((u64)t__2e17 + (u64)((u64)4UL));
+	t__2e33 = (u64)(u32)(*(i32 *)t__2e17);
+	t__2e16 = (u64)(u32)(((u32)t__2e33 == (u32)((u64)1337UL)));
+	if ((u32)t__2e16) goto L_passed_2e15; else goto L_failed_2e14;
+	L_failed_2e14:;
+	t_abortsite_2e26 = ((u64)1UL);
+	goto L_abort_2e34;
+	L_passed_2e15:;
+	BLIT(__rp, t_t4, 8); return __rp;
+	L__2e40:;
+	L__2e12:;
+	L__2e41:;
+	return 0;
+	L_abort_2e27:;
+	t__2e28 = (u64)((u64)t_abortsite_2e26 * (u64)((u64)16UL));
+	t__2e28 = (u64)((u64)((u64)((char *)&D_abortsites_2e25)) + (u64)t__2e28);
+	t__2e29 = (u64)(*(u64 *)t__2e28);
+	t__2e30 = (u64)((u64)t__2e28 + (u64)((u64)8UL));
+	t__2e31 = (u64)(*(u32 *)t__2e30);
+	t__2e30 = (u64)((u64)t__2e28 + (u64)((u64)12UL));
+	t__2e32 = (u64)(*(u32 *)t__2e30);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e29, (u64)t__2e31, (u64)t__2e32, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e34:;
+	t__2e35 = (u64)((u64)t_abortsite_2e26 * (u64)((u64)16UL));
+	t__2e35 = (u64)((u64)((u64)((char *)&D_abortsites_2e25)) + (u64)t__2e35);
+	t__2e36 = (u64)(*(u64 *)t__2e35);
+	t__2e37 = (u64)((u64)t__2e35 + (u64)((u64)8UL));
+	t__2e38 = (u64)(*(u32 *)t__2e37);
+	t__2e37 = (u64)((u64)t__2e35 + (u64)((u64)12UL));
+	t__2e39 = (u64)(*(u32 *)t__2e37);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e36, (u64)t__2e38, (u64)t__2e39, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_abi(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[16] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	char B3[8] __attribute__((aligned(16)));
+	char R4[8] __attribute__((aligned(16)));
+	char B5[16] __attribute__((aligned(16)));
+	char R6[16] __attribute__((aligned(16)));
+	char B7[16] __attribute__((aligned(16)));
+	char R8[16] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e101;
+	u64 t__2e102;
+	u64 t__2e106;
+	u64 t__2e109;
+	u64 t__2e48;
+	u64 t__2e49;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e57;
+	u64 t__2e63;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e66;
+	u64 t__2e67;
+	u64 t__2e68;
+	u64 t__2e70;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t__2e73;
+	u64 t__2e74;
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e85;
+	u64 t__2e86;
+	u64 t__2e87;
+	u64 t__2e91;
+	u64 t__2e94;
+	u64 t__2e97;
+	u64 t__2e98;
+	u64 t_abortsite_2e61;
+	u64 t_object_2e50;
+	u64 t_object_2e84;
+	u64 t_object_2e99;
+	u64 t_subval_2e105;
+	u64 t_subval_2e56;
+	u64 t_subval_2e90;
+	L_start_2e42:;
+	t_object_2e50 = (u64)A0;
+	t_object_2e84 = (u64)A1;
+	t_object_2e99 = (u64)A2;
+	L_body_2e43:;
+	*(u32 *)t_object_2e50 = (u32)((u64)1399468992UL);
+	t__2e51 = (u64)((u64)t_object_2e50 + (u64)((u64)4UL));
+	*(u32 *)t__2e51 = (u32)((u64)1337UL);
+	BLIT((u64)B3, t_object_2e50, 8);
+	t__2e49 = ((u64 (*)(u64, u64))((u64)((char *)&F_abi4)))((u64)R4, (u64)B3);
+	t__2e52 = t__2e49;
+	t__2e53 = (u64)(u32)(*(u32 *)t__2e49);
+	t_subval_2e56 = t__2e49;
+	t__2e57 = (u64)(u32)(((u32)t__2e53 == (u32)((u64)1399468992UL)));
+	if ((u32)t__2e57) goto L_subtype_2e59; else goto L_failed_2e55;
+	L_subtype_2e59:;
+	goto L_passed_2e54;
+	L_failed_2e55:;
+	t_abortsite_2e61 = ((u64)0UL);
+	goto L_abort_2e62;
+	L_passed_2e54:;
+	t__2e52 = (u64)((u64)t__2e52 + (u64)((u64)4UL));
+	t__2e68 = (u64)(u32)(*(i32 *)t__2e52);
+	t__2e48 = (u64)(u32)(((u32)t__2e68 == (u32)((u64)1337UL)));
+	if ((u32)t__2e48) goto L_passed_2e47; else goto L_failed_2e46;
+	L_failed_2e46:;
+	t_abortsite_2e61 = ((u64)1UL);
+	goto L_abort_2e69;
+	L_passed_2e47:;
+	*(u32 *)t_object_2e84 = (u32)((u64)1399468992UL);
+	t__2e85 = (u64)((u64)t_object_2e84 + (u64)((u64)4UL));
+	*(u32 *)t__2e85 = (u32)((u64)1337UL);
+	BLIT((u64)B5, t_object_2e84, 16);
+	t__2e78 = ((u64 (*)(u64, u64))((u64)((char *)&F_abi8__v4)))((u64)R6, (u64)B5);
+	t__2e86 = t__2e78;
+	t__2e87 = (u64)(u32)(*(u32 *)t__2e78);
+	t_subval_2e90 = t__2e78;
+	t__2e91 = (u64)(u32)(((u32)t__2e87 == (u32)((u64)1399468992UL)));
+	if ((u32)t__2e91) goto L_subtype_2e93; else goto L_failed_2e89;
+	L_subtype_2e93:;
+	goto L_passed_2e88;
+	L_failed_2e89:;
+	t_abortsite_2e61 = ((u64)2UL);
+	goto L_abort_2e62;
+	L_passed_2e88:;
+	t__2e86 = (u64)((u64)t__2e86 + (u64)((u64)4UL));
+	t__2e94 = (u64)(u32)(*(i32 *)t__2e86);
+	t__2e77 = (u64)(u32)(((u32)t__2e94 == (u32)((u64)1337UL)));
+	if ((u32)t__2e77) goto L_passed_2e76; else goto L_failed_2e75;
+	L_failed_2e75:;
+	t_abortsite_2e61 = ((u64)3UL);
+	goto L_abort_2e69;
+	L_passed_2e76:;
+	*(u32 *)t_object_2e99 = (u32)((u64)1268499444UL);
+	t__2e100 = (u64)((u64)t_object_2e99 + (u64)((u64)8UL));
+	*(u64 *)t__2e100 = (u64)((u64)1337UL);
+	BLIT((u64)B7, t_object_2e99, 16);
+	t__2e98 = ((u64 (*)(u64, u64))((u64)((char *)&F_abi8__v8)))((u64)R8, (u64)B7);
+	t__2e101 = t__2e98;
+	t__2e102 = (u64)(u32)(*(u32 *)t__2e98);
+	t_subval_2e105 = t__2e98;
+	t__2e106 = (u64)(u32)(((u32)t__2e102 == (u32)((u64)1268499444UL)));
+	if ((u32)t__2e106) goto L_subtype_2e108; else goto L_failed_2e104;
+	L_subtype_2e108:;
+	goto L_passed_2e103;
+	L_failed_2e104:;
+	t_abortsite_2e61 = ((u64)4UL);
+	goto L_abort_2e62;
+	L_passed_2e103:;
+	t__2e101 = (u64)((u64)t__2e101 + (u64)((u64)8UL));
+	t__2e109 = (u64)(*(u64 *)t__2e101);
+	t__2e97 = (u64)(u32)(((u64)t__2e109 == (u64)((u64)1337UL)));
+	if ((u32)t__2e97) goto L_passed_2e96; else goto L_failed_2e95;
+	L_failed_2e95:;
+	t_abortsite_2e61 = ((u64)5UL);
+	goto L_abort_2e69;
+	L_passed_2e96:;
+	goto L__2e44;
+	L__2e110:;
+	L__2e44:;
+	return;
+	L_abort_2e62:;
+	t__2e63 = (u64)((u64)t_abortsite_2e61 * (u64)((u64)16UL));
+	t__2e63 = (u64)((u64)((u64)((char *)&D_abortsites_2e60)) + (u64)t__2e63);
+	t__2e64 = (u64)(*(u64 *)t__2e63);
+	t__2e65 = (u64)((u64)t__2e63 + (u64)((u64)8UL));
+	t__2e66 = (u64)(*(u32 *)t__2e65);
+	t__2e65 = (u64)((u64)t__2e63 + (u64)((u64)12UL));
+	t__2e67 = (u64)(*(u32 *)t__2e65);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e64, (u64)t__2e66, (u64)t__2e67, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e69:;
+	t__2e70 = (u64)((u64)t_abortsite_2e61 * (u64)((u64)16UL));
+	t__2e70 = (u64)((u64)((u64)((char *)&D_abortsites_2e60)) + (u64)t__2e70);
+	t__2e71 = (u64)(*(u64 *)t__2e70);
+	t__2e72 = (u64)((u64)t__2e70 + (u64)((u64)8UL));
+	t__2e73 = (u64)(*(u32 *)t__2e72);
+	t__2e72 = (u64)((u64)t__2e70 + (u64)((u64)12UL));
+	t__2e74 = (u64)(*(u32 *)t__2e72);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e71, (u64)t__2e73, (u64)t__2e74, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u64 F_abi8__v8(u64 __rp, u64 p_t8) {
+	u64 t__2e117;
+	u64 t__2e118;
+	u64 t__2e119;
+	u64 t__2e123;
+	u64 t__2e129;
+	u64 t__2e130;
+	u64 t__2e131;
+	u64 t__2e132;
+	u64 t__2e133;
+	u64 t__2e134;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e139;
+	u64 t__2e140;
+	u64 t_abortsite_2e127;
+	u64 t_subval_2e122;
+	u64 t_t8;
+	t_t8 = p_t8;
+	L_start_2e111:;
+	L_body_2e112:;
+	t__2e118 = t_t8;
+	t__2e119 = (u64)(u32)(*(u32 *)t_t8);
+	t_subval_2e122 = t_t8;
+	t__2e123 = (u64)(u32)(((u32)t__2e119 == (u32)((u64)1268499444UL)));
+	if ((u32)t__2e123) goto L_subtype_2e125; else goto L_failed_2e121;
+	L_subtype_2e125:;
+	goto L_passed_2e120;
+	L_failed_2e121:;
+	t_abortsite_2e127 = ((u64)0UL);
+	goto L_abort_2e128;
+	L_passed_2e120:;
+	t__2e118 = (u64)((u64)t__2e118 + (u64)((u64)8UL));
+	t__2e134 = (u64)(*(u64 *)t__2e118);
+	t__2e117 = (u64)(u32)(((u64)t__2e134 == (u64)((u64)1337UL)));
+	if ((u32)t__2e117) goto L_passed_2e116; else goto L_failed_2e115;
+	L_failed_2e115:;
+	t_abortsite_2e127 = ((u64)1UL);
+	goto L_abort_2e135;
+	L_passed_2e116:;
+	BLIT(__rp, t_t8, 16); return __rp;
+	L__2e141:;
+	L__2e113:;
+	L__2e142:;
+	return 0;
+	L_abort_2e128:;
+	t__2e129 = (u64)((u64)t_abortsite_2e127 * (u64)((u64)16UL));
+	t__2e129 = (u64)((u64)((u64)((char *)&D_abortsites_2e126)) + (u64)t__2e129);
+	t__2e130 = (u64)(*(u64 *)t__2e129);
+	t__2e131 = (u64)((u64)t__2e129 + (u64)((u64)8UL));
+	t__2e132 = (u64)(*(u32 *)t__2e131);
+	t__2e131 = (u64)((u64)t__2e129 + (u64)((u64)12UL));
+	t__2e133 = (u64)(*(u32 *)t__2e131);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e130, (u64)t__2e132, (u64)t__2e133, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e135:;
+	t__2e136 = (u64)((u64)t_abortsite_2e127 * (u64)((u64)16UL));
+	t__2e136 = (u64)((u64)((u64)((char *)&D_abortsites_2e126)) + (u64)t__2e136);
+	t__2e137 = (u64)(*(u64 *)t__2e136);
+	t__2e138 = (u64)((u64)t__2e136 + (u64)((u64)8UL));
+	t__2e139 = (u64)(*(u32 *)t__2e138);
+	t__2e138 = (u64)((u64)t__2e136 + (u64)((u64)12UL));
+	t__2e140 = (u64)(*(u32 *)t__2e138);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e137, (u64)t__2e139, (u64)t__2e140, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u64 F_abi8__v4(u64 __rp, u64 p_t8) {
+	u64 t__2e149;
+	u64 t__2e150;
+	u64 t__2e151;
+	u64 t__2e155;
+	u64 t__2e161;
+	u64 t__2e162;
+	u64 t__2e163;
+	u64 t__2e164;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e168;
+	u64 t__2e169;
+	u64 t__2e170;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t_abortsite_2e159;
+	u64 t_subval_2e154;
+	u64 t_t8;
+	t_t8 = p_t8;
+	L_start_2e143:;
+	L_body_2e144:;
+	t__2e150 = t_t8;
+	t__2e151 = (u64)(u32)(*(u32 *)t_t8);
+	t_subval_2e154 = t_t8;
+	t__2e155 = (u64)(u32)(((u32)t__2e151 == (u32)((u64)1399468992UL)));
+	if ((u32)t__2e155) goto L_subtype_2e157; else goto L_failed_2e153;
+	L_subtype_2e157:;
+	goto L_passed_2e152;
+	L_failed_2e153:;
+	t_abortsite_2e159 = ((u64)0UL);
+	goto L_abort_2e160;
+	L_passed_2e152:;
+	t__2e150 = (u64)((u64)t__2e150 + (u64)((u64)4UL));
+	t__2e166 = (u64)(u32)(*(i32 *)t__2e150);
+	t__2e149 = (u64)(u32)(((u32)t__2e166 == (u32)((u64)1337UL)));
+	if ((u32)t__2e149) goto L_passed_2e148; else goto L_failed_2e147;
+	L_failed_2e147:;
+	t_abortsite_2e159 = ((u64)1UL);
+	goto L_abort_2e167;
+	L_passed_2e148:;
+	BLIT(__rp, t_t8, 16); return __rp;
+	L__2e173:;
+	L__2e145:;
+	L__2e174:;
+	return 0;
+	L_abort_2e160:;
+	t__2e161 = (u64)((u64)t_abortsite_2e159 * (u64)((u64)16UL));
+	t__2e161 = (u64)((u64)((u64)((char *)&D_abortsites_2e158)) + (u64)t__2e161);
+	t__2e162 = (u64)(*(u64 *)t__2e161);
+	t__2e163 = (u64)((u64)t__2e161 + (u64)((u64)8UL));
+	t__2e164 = (u64)(*(u32 *)t__2e163);
+	t__2e163 = (u64)((u64)t__2e161 + (u64)((u64)12UL));
+	t__2e165 = (u64)(*(u32 *)t__2e163);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e162, (u64)t__2e164, (u64)t__2e165, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e167:;
+	t__2e168 = (u64)((u64)t_abortsite_2e159 * (u64)((u64)16UL));
+	t__2e168 = (u64)((u64)((u64)((char *)&D_abortsites_2e158)) + (u64)t__2e168);
+	t__2e169 = (u64)(*(u64 *)t__2e168);
+	t__2e170 = (u64)((u64)t__2e168 + (u64)((u64)8UL));
+	t__2e171 = (u64)(*(u32 *)t__2e170);
+	t__2e170 = (u64)((u64)t__2e168 + (u64)((u64)12UL));
+	t__2e172 = (u64)(*(u32 *)t__2e170);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e169, (u64)t__2e171, (u64)t__2e172, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_translation(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[16] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	u64 t__2e181;
+	u64 t__2e192;
+	u64 t__2e193;
+	u64 t__2e194;
+	u64 t__2e198;
+	u64 t__2e204;
+	u64 t__2e205;
+	u64 t__2e206;
+	u64 t__2e207;
+	u64 t__2e208;
+	u64 t__2e209;
+	u64 t__2e210;
+	u64 t__2e211;
+	u64 t__2e213;
+	u64 t__2e214;
+	u64 t__2e215;
+	u64 t__2e216;
+	u64 t__2e217;
+	u64 t__2e220;
+	u64 t__2e221;
+	u64 t__2e222;
+	u64 t__2e225;
+	u64 t__2e226;
+	u64 t__2e227;
+	u64 t__2e230;
+	u64 t__2e232;
+	u64 t__2e233;
+	u64 t__2e234;
+	u64 t__2e238;
+	u64 t__2e241;
+	u64 t__2e242;
+	u64 t__2e243;
+	u64 t__2e246;
+	u64 t__2e247;
+	u64 t__2e248;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e253;
+	u64 t__2e256;
+	u64 t__2e258;
+	u64 t__2e259;
+	u64 t__2e260;
+	u64 t__2e264;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e269;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e277;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t_abortsite_2e202;
+	u64 t_object_2e182;
+	u64 t_object_2e231;
+	u64 t_object_2e257;
+	u64 t_subval_2e197;
+	u64 t_subval_2e237;
+	u64 t_subval_2e263;
+	L_start_2e175:;
+	t_object_2e182 = (u64)A0;
+	t_object_2e231 = (u64)A1;
+	t_object_2e257 = (u64)A2;
+	L_body_2e176:;
+	*(u32 *)t_object_2e182 = (u32)((u64)3181589295UL);
+	t__2e192 = (u64)((u64)t_object_2e182 + (u64)((u64)4UL));
+	*(u8 *)t__2e192 = (u8)((u64)8UL);
+	t__2e193 = t_object_2e182;
+	t__2e194 = (u64)(u32)(*(u32 *)t_object_2e182);
+	t_subval_2e197 = t_object_2e182;
+	t__2e198 = (u64)(u32)(((u32)t__2e194 == (u32)((u64)3181589295UL)));
+	if ((u32)t__2e198) goto L_subtype_2e200; else goto L_failed_2e196;
+	L_subtype_2e200:;
+	goto L_passed_2e195;
+	L_failed_2e196:;
+	t_abortsite_2e202 = ((u64)0UL);
+	goto L_abort_2e203;
+	L_passed_2e195:;
+	t__2e193 = (u64)((u64)t__2e193 + (u64)((u64)4UL));
+	t__2e209 = (u64)(u32)(*(u8 *)t__2e193);
+	t__2e210 = (u64)(u32)((u8)t__2e209);
+	t__2e211 = (u64)(u32)((u8)((u64)8UL));
+	t__2e181 = (u64)(u32)(((u32)t__2e210 == (u32)t__2e211));
+	if ((u32)t__2e181) goto L_passed_2e180; else goto L_failed_2e179;
+	L_failed_2e179:;
+	t_abortsite_2e202 = ((u64)1UL);
+	goto L_abort_2e212;
+	L_passed_2e180:;
+	t__2e221 = (u64)(u32)((u8)((u64)8UL));
+	t__2e222 = (u64)(u32)((u8)((u64)8UL));
+	t__2e220 = (u64)(u32)(((u32)t__2e221 == (u32)t__2e222));
+	if ((u32)t__2e220) goto L_passed_2e219; else goto L_failed_2e218;
+	L_failed_2e218:;
+	t_abortsite_2e202 = ((u64)2UL);
+	goto L_abort_2e212;
+	L_passed_2e219:;
+	t__2e226 = (u64)(u32)((u8)((u64)1UL));
+	t__2e227 = (u64)(u32)((u8)((u64)1UL));
+	t__2e225 = (u64)(u32)(((u32)t__2e226 == (u32)t__2e227));
+	if ((u32)t__2e225) goto L_passed_2e224; else goto L_failed_2e223;
+	L_failed_2e223:;
+	t_abortsite_2e202 = ((u64)3UL);
+	goto L_abort_2e212;
+	L_passed_2e224:;
+	*(u32 *)t_object_2e231 = (u32)((u64)3181589295UL);
+	t__2e232 = (u64)((u64)t_object_2e231 + (u64)((u64)4UL));
+	*(u8 *)t__2e232 = (u8)((u64)8UL);
+	t__2e233 = t_object_2e231;
+	t__2e234 = (u64)(u32)(*(u32 *)t_object_2e231);
+	t_subval_2e237 = t_object_2e231;
+	t__2e238 = (u64)(u32)(((u32)t__2e234 == (u32)((u64)3181589295UL)));
+	if ((u32)t__2e238) goto L_subtype_2e240; else goto L_failed_2e236;
+	L_subtype_2e240:;
+	goto L_passed_2e235;
+	L_failed_2e236:;
+	t_abortsite_2e202 = ((u64)4UL);
+	goto L_abort_2e203;
+	L_passed_2e235:;
+	t__2e233 = (u64)((u64)t__2e233 + (u64)((u64)4UL));
+	t__2e241 = (u64)(u32)(*(u8 *)t__2e233);
+	t__2e242 = (u64)(u32)((u8)t__2e241);
+	t__2e243 = (u64)(u32)((u8)((u64)8UL));
+	t__2e230 = (u64)(u32)(((u32)t__2e242 == (u32)t__2e243));
+	if ((u32)t__2e230) goto L_passed_2e229; else goto L_failed_2e228;
+	L_failed_2e228:;
+	t_abortsite_2e202 = ((u64)5UL);
+	goto L_abort_2e212;
+	L_passed_2e229:;
+	t__2e247 = (u64)(u32)((u8)((u64)8UL));
+	t__2e248 = (u64)(u32)((u8)((u64)8UL));
+	t__2e246 = (u64)(u32)(((u32)t__2e247 == (u32)t__2e248));
+	if ((u32)t__2e246) goto L_passed_2e245; else goto L_failed_2e244;
+	L_failed_2e244:;
+	t_abortsite_2e202 = ((u64)6UL);
+	goto L_abort_2e212;
+	L_passed_2e245:;
+	t__2e252 = (u64)(u32)((u8)((u64)1UL));
+	t__2e253 = (u64)(u32)((u8)((u64)1UL));
+	t__2e251 = (u64)(u32)(((u32)t__2e252 == (u32)t__2e253));
+	if ((u32)t__2e251) goto L_passed_2e250; else goto L_failed_2e249;
+	L_failed_2e249:;
+	t_abortsite_2e202 = ((u64)7UL);
+	goto L_abort_2e212;
+	L_passed_2e250:;
+	*(u32 *)t_object_2e257 = (u32)((u64)3481467866UL);
+	t__2e258 = (u64)((u64)t_object_2e257 + (u64)((u64)4UL));
+	*(u16 *)t__2e258 = (u16)((u64)8UL);
+	t__2e259 = t_object_2e257;
+	t__2e260 = (u64)(u32)(*(u32 *)t_object_2e257);
+	t_subval_2e263 = t_object_2e257;
+	t__2e264 = (u64)(u32)(((u32)t__2e260 == (u32)((u64)3481467866UL)));
+	if ((u32)t__2e264) goto L_subtype_2e266; else goto L_failed_2e262;
+	L_subtype_2e266:;
+	goto L_passed_2e261;
+	L_failed_2e262:;
+	t_abortsite_2e202 = ((u64)8UL);
+	goto L_abort_2e203;
+	L_passed_2e261:;
+	t__2e259 = (u64)((u64)t__2e259 + (u64)((u64)4UL));
+	t__2e267 = (u64)(u32)(*(u16 *)t__2e259);
+	t__2e268 = (u64)(u32)((u16)t__2e267);
+	t__2e269 = (u64)(u32)((u16)((u64)8UL));
+	t__2e256 = (u64)(u32)(((u32)t__2e268 == (u32)t__2e269));
+	if ((u32)t__2e256) goto L_passed_2e255; else goto L_failed_2e254;
+	L_failed_2e254:;
+	t_abortsite_2e202 = ((u64)9UL);
+	goto L_abort_2e212;
+	L_passed_2e255:;
+	t__2e273 = (u64)(u32)((u16)((u64)8UL));
+	t__2e274 = (u64)(u32)((u16)((u64)8UL));
+	t__2e272 = (u64)(u32)(((u32)t__2e273 == (u32)t__2e274));
+	if ((u32)t__2e272) goto L_passed_2e271; else goto L_failed_2e270;
+	L_failed_2e270:;
+	t_abortsite_2e202 = ((u64)10UL);
+	goto L_abort_2e212;
+	L_passed_2e271:;
+	t__2e278 = (u64)(u32)((u8)((u64)1UL));
+	t__2e279 = (u64)(u32)((u8)((u64)1UL));
+	t__2e277 = (u64)(u32)(((u32)t__2e278 == (u32)t__2e279));
+	if ((u32)t__2e277) goto L_passed_2e276; else goto L_failed_2e275;
+	L_failed_2e275:;
+	t_abortsite_2e202 = ((u64)11UL);
+	goto L_abort_2e212;
+	L_passed_2e276:;
+	goto L__2e177;
+	L__2e280:;
+	L__2e177:;
+	return;
+	L_abort_2e203:;
+	t__2e204 = (u64)((u64)t_abortsite_2e202 * (u64)((u64)16UL));
+	t__2e204 = (u64)((u64)((u64)((char *)&D_abortsites_2e201)) + (u64)t__2e204);
+	t__2e205 = (u64)(*(u64 *)t__2e204);
+	t__2e206 = (u64)((u64)t__2e204 + (u64)((u64)8UL));
+	t__2e207 = (u64)(*(u32 *)t__2e206);
+	t__2e206 = (u64)((u64)t__2e204 + (u64)((u64)12UL));
+	t__2e208 = (u64)(*(u32 *)t__2e206);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e205, (u64)t__2e207, (u64)t__2e208, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e212:;
+	t__2e213 = (u64)((u64)t_abortsite_2e202 * (u64)((u64)16UL));
+	t__2e213 = (u64)((u64)((u64)((char *)&D_abortsites_2e201)) + (u64)t__2e213);
+	t__2e214 = (u64)(*(u64 *)t__2e213);
+	t__2e215 = (u64)((u64)t__2e213 + (u64)((u64)8UL));
+	t__2e216 = (u64)(*(u32 *)t__2e215);
+	t__2e215 = (u64)((u64)t__2e213 + (u64)((u64)12UL));
+	t__2e217 = (u64)(*(u32 *)t__2e215);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e214, (u64)t__2e216, (u64)t__2e217, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_reject(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char B18[8] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	char R21[4] __attribute__((aligned(16)));
+	char B22[8] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char R25[4] __attribute__((aligned(16)));
+	char B26[8] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char R29[4] __attribute__((aligned(16)));
+	char B30[8] __attribute__((aligned(16)));
+	char B31[24] __attribute__((aligned(16)));
+	char B32[24] __attribute__((aligned(16)));
+	char R33[4] __attribute__((aligned(16)));
+	char B34[8] __attribute__((aligned(16)));
+	char B35[24] __attribute__((aligned(16)));
+	char B36[24] __attribute__((aligned(16)));
+	char R37[4] __attribute__((aligned(16)));
+	char B38[8] __attribute__((aligned(16)));
+	char B39[24] __attribute__((aligned(16)));
+	char B40[24] __attribute__((aligned(16)));
+	char R41[4] __attribute__((aligned(16)));
+	char B42[8] __attribute__((aligned(16)));
+	char B43[24] __attribute__((aligned(16)));
+	char B44[24] __attribute__((aligned(16)));
+	char R45[4] __attribute__((aligned(16)));
+	char B46[8] __attribute__((aligned(16)));
+	char B47[24] __attribute__((aligned(16)));
+	char B48[24] __attribute__((aligned(16)));
+	char R49[4] __attribute__((aligned(16)));
+	char B50[8] __attribute__((aligned(16)));
+	char B51[24] __attribute__((aligned(16)));
+	char B52[24] __attribute__((aligned(16)));
+	char R53[4] __attribute__((aligned(16)));
+	u64 t__2e286;
+	u64 t__2e292;
+	u64 t__2e298;
+	u64 t__2e307;
+	u64 t__2e309;
+	u64 t__2e313;
+	u64 t__2e314;
+	u64 t__2e315;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e320;
+	u64 t__2e321;
+	u64 t__2e322;
+	u64 t__2e323;
+	u64 t__2e324;
+	u64 t__2e326;
+	u64 t__2e328;
+	u64 t__2e332;
+	u64 t__2e341;
+	u64 t__2e343;
+	u64 t__2e346;
+	u64 t__2e348;
+	u64 t__2e352;
+	u64 t__2e361;
+	u64 t__2e363;
+	u64 t__2e366;
+	u64 t__2e368;
+	u64 t__2e372;
+	u64 t__2e381;
+	u64 t__2e383;
+	u64 t__2e386;
+	u64 t__2e388;
+	u64 t__2e392;
+	u64 t__2e401;
+	u64 t__2e403;
+	u64 t__2e406;
+	u64 t__2e408;
+	u64 t__2e412;
+	u64 t__2e421;
+	u64 t__2e423;
+	u64 t__2e426;
+	u64 t__2e428;
+	u64 t__2e432;
+	u64 t__2e441;
+	u64 t__2e443;
+	u64 t__2e446;
+	u64 t__2e448;
+	u64 t__2e452;
+	u64 t__2e461;
+	u64 t__2e463;
+	u64 t__2e466;
+	u64 t__2e468;
+	u64 t__2e472;
+	u64 t__2e481;
+	u64 t__2e483;
+	u64 t_abortsite_2e311;
+	u64 t_object_2e288;
+	u64 t_object_2e296;
+	u64 t_object_2e327;
+	u64 t_object_2e331;
+	u64 t_object_2e347;
+	u64 t_object_2e351;
+	u64 t_object_2e367;
+	u64 t_object_2e371;
+	u64 t_object_2e387;
+	u64 t_object_2e391;
+	u64 t_object_2e407;
+	u64 t_object_2e411;
+	u64 t_object_2e427;
+	u64 t_object_2e431;
+	u64 t_object_2e447;
+	u64 t_object_2e451;
+	u64 t_object_2e467;
+	u64 t_object_2e471;
+	u64 t_tag_2e299;
+	u64 t_tag_2e333;
+	u64 t_tag_2e353;
+	u64 t_tag_2e373;
+	u64 t_tag_2e393;
+	u64 t_tag_2e413;
+	u64 t_tag_2e433;
+	u64 t_tag_2e453;
+	u64 t_tag_2e473;
+	L_start_2e281:;
+	t_object_2e288 = (u64)A0;
+	t_object_2e296 = (u64)A1;
+	t_object_2e327 = (u64)A2;
+	t_object_2e331 = (u64)A3;
+	t_object_2e347 = (u64)A4;
+	t_object_2e351 = (u64)A5;
+	t_object_2e367 = (u64)A6;
+	t_object_2e371 = (u64)A7;
+	t_object_2e387 = (u64)A8;
+	t_object_2e391 = (u64)A9;
+	t_object_2e407 = (u64)A10;
+	t_object_2e411 = (u64)A11;
+	t_object_2e427 = (u64)A12;
+	t_object_2e431 = (u64)A13;
+	t_object_2e447 = (u64)A14;
+	t_object_2e451 = (u64)A15;
+	t_object_2e467 = (u64)A16;
+	t_object_2e471 = (u64)A17;
+	L_body_2e282:;
+	*(u32 *)t_object_2e288 = (u32)((u64)3532310079UL);
+	t__2e292 = (u64)((u64)t_object_2e288 + (u64)((u64)4UL));
+	*(u32 *)t__2e292 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e296 = (u64)((u64)0UL);
+	t__2e298 = (u64)((u64)t_object_2e296 + (u64)((u64)8UL));
+	*(u64 *)t__2e298 = (u64)((u64)0UL);
+	t__2e298 = (u64)((u64)t__2e298 + (u64)((u64)8UL));
+	*(u64 *)t__2e298 = (u64)((u64)0UL);
+	BLIT((u64)B18, t_object_2e288, 8);
+	BLIT((u64)B19, ((u64)((char *)&D_strliteral_2e294)), 24);
+	BLIT((u64)B20, t_object_2e296, 24);
+	t__2e286 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R21, (u64)B18, (u64)B19, (u64)B20);
+	t_tag_2e299 = (u64)(*(u32 *)t__2e286);
+	t__2e307 = (u64)(u32)(((u32)t_tag_2e299 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e307) goto L_member_2e304; else goto L__2e306;
+	L__2e306:;
+	t__2e309 = (u64)(u32)(((u32)t_tag_2e299 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e309) goto L_member_2e305; else goto L__2e308;
+	L__2e308:;
+	goto L_matches_2e303;
+	L_member_2e304:;
+	goto L_matches_2e303;
+	L_member_2e305:;
+	goto L_matches_2e302;
+	L_matches_2e302:;
+	goto L__2e300;
+	L_matches_2e303:;
+	t_abortsite_2e311 = ((u64)0UL);
+	goto L_abort_2e312;
+	L__2e318:;
+	L__2e301:;
+	t_abortsite_2e311 = ((u64)1UL);
+	goto L_abort_2e319;
+	L__2e300:;
+	*(u32 *)t_object_2e327 = (u32)((u64)3532310079UL);
+	t__2e328 = (u64)((u64)t_object_2e327 + (u64)((u64)4UL));
+	*(u32 *)t__2e328 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e331 = (u64)((u64)0UL);
+	t__2e332 = (u64)((u64)t_object_2e331 + (u64)((u64)8UL));
+	*(u64 *)t__2e332 = (u64)((u64)0UL);
+	t__2e332 = (u64)((u64)t__2e332 + (u64)((u64)8UL));
+	*(u64 *)t__2e332 = (u64)((u64)0UL);
+	BLIT((u64)B22, t_object_2e327, 8);
+	BLIT((u64)B23, ((u64)((char *)&D_strliteral_2e330)), 24);
+	BLIT((u64)B24, t_object_2e331, 24);
+	t__2e326 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R25, (u64)B22, (u64)B23, (u64)B24);
+	t_tag_2e333 = (u64)(*(u32 *)t__2e326);
+	t__2e341 = (u64)(u32)(((u32)t_tag_2e333 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e341) goto L_member_2e338; else goto L__2e340;
+	L__2e340:;
+	t__2e343 = (u64)(u32)(((u32)t_tag_2e333 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e343) goto L_member_2e339; else goto L__2e342;
+	L__2e342:;
+	goto L_matches_2e337;
+	L_member_2e338:;
+	goto L_matches_2e337;
+	L_member_2e339:;
+	goto L_matches_2e336;
+	L_matches_2e336:;
+	goto L__2e334;
+	L_matches_2e337:;
+	t_abortsite_2e311 = ((u64)2UL);
+	goto L_abort_2e312;
+	L__2e344:;
+	L__2e335:;
+	t_abortsite_2e311 = ((u64)3UL);
+	goto L_abort_2e319;
+	L__2e334:;
+	*(u32 *)t_object_2e347 = (u32)((u64)3532310079UL);
+	t__2e348 = (u64)((u64)t_object_2e347 + (u64)((u64)4UL));
+	*(u32 *)t__2e348 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e351 = (u64)((u64)0UL);
+	t__2e352 = (u64)((u64)t_object_2e351 + (u64)((u64)8UL));
+	*(u64 *)t__2e352 = (u64)((u64)0UL);
+	t__2e352 = (u64)((u64)t__2e352 + (u64)((u64)8UL));
+	*(u64 *)t__2e352 = (u64)((u64)0UL);
+	BLIT((u64)B26, t_object_2e347, 8);
+	BLIT((u64)B27, ((u64)((char *)&D_strliteral_2e350)), 24);
+	BLIT((u64)B28, t_object_2e351, 24);
+	t__2e346 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R29, (u64)B26, (u64)B27, (u64)B28);
+	t_tag_2e353 = (u64)(*(u32 *)t__2e346);
+	t__2e361 = (u64)(u32)(((u32)t_tag_2e353 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e361) goto L_member_2e358; else goto L__2e360;
+	L__2e360:;
+	t__2e363 = (u64)(u32)(((u32)t_tag_2e353 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e363) goto L_member_2e359; else goto L__2e362;
+	L__2e362:;
+	goto L_matches_2e357;
+	L_member_2e358:;
+	goto L_matches_2e357;
+	L_member_2e359:;
+	goto L_matches_2e356;
+	L_matches_2e356:;
+	goto L__2e354;
+	L_matches_2e357:;
+	t_abortsite_2e311 = ((u64)4UL);
+	goto L_abort_2e312;
+	L__2e364:;
+	L__2e355:;
+	t_abortsite_2e311 = ((u64)5UL);
+	goto L_abort_2e319;
+	L__2e354:;
+	*(u32 *)t_object_2e367 = (u32)((u64)3532310079UL);
+	t__2e368 = (u64)((u64)t_object_2e367 + (u64)((u64)4UL));
+	*(u32 *)t__2e368 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e371 = (u64)((u64)0UL);
+	t__2e372 = (u64)((u64)t_object_2e371 + (u64)((u64)8UL));
+	*(u64 *)t__2e372 = (u64)((u64)0UL);
+	t__2e372 = (u64)((u64)t__2e372 + (u64)((u64)8UL));
+	*(u64 *)t__2e372 = (u64)((u64)0UL);
+	BLIT((u64)B30, t_object_2e367, 8);
+	BLIT((u64)B31, ((u64)((char *)&D_strliteral_2e370)), 24);
+	BLIT((u64)B32, t_object_2e371, 24);
+	t__2e366 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R33, (u64)B30, (u64)B31, (u64)B32);
+	t_tag_2e373 = (u64)(*(u32 *)t__2e366);
+	t__2e381 = (u64)(u32)(((u32)t_tag_2e373 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e381) goto L_member_2e378; else goto L__2e380;
+	L__2e380:;
+	t__2e383 = (u64)(u32)(((u32)t_tag_2e373 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e383) goto L_member_2e379; else goto L__2e382;
+	L__2e382:;
+	goto L_matches_2e377;
+	L_member_2e378:;
+	goto L_matches_2e377;
+	L_member_2e379:;
+	goto L_matches_2e376;
+	L_matches_2e376:;
+	goto L__2e374;
+	L_matches_2e377:;
+	t_abortsite_2e311 = ((u64)6UL);
+	goto L_abort_2e312;
+	L__2e384:;
+	L__2e375:;
+	t_abortsite_2e311 = ((u64)7UL);
+	goto L_abort_2e319;
+	L__2e374:;
+	*(u32 *)t_object_2e387 = (u32)((u64)3532310079UL);
+	t__2e388 = (u64)((u64)t_object_2e387 + (u64)((u64)4UL));
+	*(u32 *)t__2e388 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e391 = (u64)((u64)0UL);
+	t__2e392 = (u64)((u64)t_object_2e391 + (u64)((u64)8UL));
+	*(u64 *)t__2e392 = (u64)((u64)0UL);
+	t__2e392 = (u64)((u64)t__2e392 + (u64)((u64)8UL));
+	*(u64 *)t__2e392 = (u64)((u64)0UL);
+	BLIT((u64)B34, t_object_2e387, 8);
+	BLIT((u64)B35, ((u64)((char *)&D_strliteral_2e390)), 24);
+	BLIT((u64)B36, t_object_2e391, 24);
+	t__2e386 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R37, (u64)B34, (u64)B35, (u64)B36);
+	t_tag_2e393 = (u64)(*(u32 *)t__2e386);
+	t__2e401 = (u64)(u32)(((u32)t_tag_2e393 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e401) goto L_member_2e398; else goto L__2e400;
+	L__2e400:;
+	t__2e403 = (u64)(u32)(((u32)t_tag_2e393 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e403) goto L_member_2e399; else goto L__2e402;
+	L__2e402:;
+	goto L_matches_2e397;
+	L_member_2e398:;
+	goto L_matches_2e397;
+	L_member_2e399:;
+	goto L_matches_2e396;
+	L_matches_2e396:;
+	goto L__2e394;
+	L_matches_2e397:;
+	t_abortsite_2e311 = ((u64)8UL);
+	goto L_abort_2e312;
+	L__2e404:;
+	L__2e395:;
+	t_abortsite_2e311 = ((u64)9UL);
+	goto L_abort_2e319;
+	L__2e394:;
+	*(u32 *)t_object_2e407 = (u32)((u64)3532310079UL);
+	t__2e408 = (u64)((u64)t_object_2e407 + (u64)((u64)4UL));
+	*(u32 *)t__2e408 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e411 = (u64)((u64)0UL);
+	t__2e412 = (u64)((u64)t_object_2e411 + (u64)((u64)8UL));
+	*(u64 *)t__2e412 = (u64)((u64)0UL);
+	t__2e412 = (u64)((u64)t__2e412 + (u64)((u64)8UL));
+	*(u64 *)t__2e412 = (u64)((u64)0UL);
+	BLIT((u64)B38, t_object_2e407, 8);
+	BLIT((u64)B39, ((u64)((char *)&D_strliteral_2e410)), 24);
+	BLIT((u64)B40, t_object_2e411, 24);
+	t__2e406 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R41, (u64)B38, (u64)B39, (u64)B40);
+	t_tag_2e413 = (u64)(*(u32 *)t__2e406);
+	t__2e421 = (u64)(u32)(((u32)t_tag_2e413 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e421) goto L_member_2e418; else goto L__2e420;
+	L__2e420:;
+	t__2e423 = (u64)(u32)(((u32)t_tag_2e413 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e423) goto L_member_2e419; else goto L__2e422;
+	L__2e422:;
+	goto L_matches_2e417;
+	L_member_2e418:;
+	goto L_matches_2e417;
+	L_member_2e419:;
+	goto L_matches_2e416;
+	L_matches_2e416:;
+	goto L__2e414;
+	L_matches_2e417:;
+	t_abortsite_2e311 = ((u64)10UL);
+	goto L_abort_2e312;
+	L__2e424:;
+	L__2e415:;
+	t_abortsite_2e311 = ((u64)11UL);
+	goto L_abort_2e319;
+	L__2e414:;
+	*(u32 *)t_object_2e427 = (u32)((u64)3532310079UL);
+	t__2e428 = (u64)((u64)t_object_2e427 + (u64)((u64)4UL));
+	*(u32 *)t__2e428 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e431 = (u64)((u64)0UL);
+	t__2e432 = (u64)((u64)t_object_2e431 + (u64)((u64)8UL));
+	*(u64 *)t__2e432 = (u64)((u64)0UL);
+	t__2e432 = (u64)((u64)t__2e432 + (u64)((u64)8UL));
+	*(u64 *)t__2e432 = (u64)((u64)0UL);
+	BLIT((u64)B42, t_object_2e427, 8);
+	BLIT((u64)B43, ((u64)((char *)&D_strliteral_2e430)), 24);
+	BLIT((u64)B44, t_object_2e431, 24);
+	t__2e426 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R45, (u64)B42, (u64)B43, (u64)B44);
+	t_tag_2e433 = (u64)(*(u32 *)t__2e426);
+	t__2e441 = (u64)(u32)(((u32)t_tag_2e433 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e441) goto L_member_2e438; else goto L__2e440;
+	L__2e440:;
+	t__2e443 = (u64)(u32)(((u32)t_tag_2e433 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e443) goto L_member_2e439; else goto L__2e442;
+	L__2e442:;
+	goto L_matches_2e437;
+	L_member_2e438:;
+	goto L_matches_2e437;
+	L_member_2e439:;
+	goto L_matches_2e436;
+	L_matches_2e436:;
+	goto L__2e434;
+	L_matches_2e437:;
+	t_abortsite_2e311 = ((u64)12UL);
+	goto L_abort_2e312;
+	L__2e444:;
+	L__2e435:;
+	t_abortsite_2e311 = ((u64)13UL);
+	goto L_abort_2e319;
+	L__2e434:;
+	*(u32 *)t_object_2e447 = (u32)((u64)3532310079UL);
+	t__2e448 = (u64)((u64)t_object_2e447 + (u64)((u64)4UL));
+	*(u32 *)t__2e448 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e451 = (u64)((u64)0UL);
+	t__2e452 = (u64)((u64)t_object_2e451 + (u64)((u64)8UL));
+	*(u64 *)t__2e452 = (u64)((u64)0UL);
+	t__2e452 = (u64)((u64)t__2e452 + (u64)((u64)8UL));
+	*(u64 *)t__2e452 = (u64)((u64)0UL);
+	BLIT((u64)B46, t_object_2e447, 8);
+	BLIT((u64)B47, ((u64)((char *)&D_strliteral_2e450)), 24);
+	BLIT((u64)B48, t_object_2e451, 24);
+	t__2e446 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R49, (u64)B46, (u64)B47, (u64)B48);
+	t_tag_2e453 = (u64)(*(u32 *)t__2e446);
+	t__2e461 = (u64)(u32)(((u32)t_tag_2e453 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e461) goto L_member_2e458; else goto L__2e460;
+	L__2e460:;
+	t__2e463 = (u64)(u32)(((u32)t_tag_2e453 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e463) goto L_member_2e459; else goto L__2e462;
+	L__2e462:;
+	goto L_matches_2e457;
+	L_member_2e458:;
+	goto L_matches_2e457;
+	L_member_2e459:;
+	goto L_matches_2e456;
+	L_matches_2e456:;
+	goto L__2e454;
+	L_matches_2e457:;
+	t_abortsite_2e311 = ((u64)14UL);
+	goto L_abort_2e312;
+	L__2e464:;
+	L__2e455:;
+	t_abortsite_2e311 = ((u64)15UL);
+	goto L_abort_2e319;
+	L__2e454:;
+	*(u32 *)t_object_2e467 = (u32)((u64)3532310079UL);
+	t__2e468 = (u64)((u64)t_object_2e467 + (u64)((u64)4UL));
+	*(u32 *)t__2e468 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e471 = (u64)((u64)0UL);
+	t__2e472 = (u64)((u64)t_object_2e471 + (u64)((u64)8UL));
+	*(u64 *)t__2e472 = (u64)((u64)0UL);
+	t__2e472 = (u64)((u64)t__2e472 + (u64)((u64)8UL));
+	*(u64 *)t__2e472 = (u64)((u64)0UL);
+	BLIT((u64)B50, t_object_2e467, 8);
+	BLIT((u64)B51, ((u64)((char *)&D_strliteral_2e470)), 24);
+	BLIT((u64)B52, t_object_2e471, 24);
+	t__2e466 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R53, (u64)B50, (u64)B51, (u64)B52);
+	t_tag_2e473 = (u64)(*(u32 *)t__2e466);
+	t__2e481 = (u64)(u32)(((u32)t_tag_2e473 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e481) goto L_member_2e478; else goto L__2e480;
+	L__2e480:;
+	t__2e483 = (u64)(u32)(((u32)t_tag_2e473 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e483) goto L_member_2e479; else goto L__2e482;
+	L__2e482:;
+	goto L_matches_2e477;
+	L_member_2e478:;
+	goto L_matches_2e477;
+	L_member_2e479:;
+	goto L_matches_2e476;
+	L_matches_2e476:;
+	goto L__2e474;
+	L_matches_2e477:;
+	t_abortsite_2e311 = ((u64)16UL);
+	goto L_abort_2e312;
+	L__2e484:;
+	L__2e475:;
+	t_abortsite_2e311 = ((u64)17UL);
+	goto L_abort_2e319;
+	L__2e474:;
+	goto L__2e283;
+	L__2e485:;
+	L__2e283:;
+	return;
+	L_abort_2e312:;
+	t__2e313 = (u64)((u64)t_abortsite_2e311 * (u64)((u64)16UL));
+	t__2e313 = (u64)((u64)((u64)((char *)&D_abortsites_2e310)) + (u64)t__2e313);
+	t__2e314 = (u64)(*(u64 *)t__2e313);
+	t__2e315 = (u64)((u64)t__2e313 + (u64)((u64)8UL));
+	t__2e316 = (u64)(*(u32 *)t__2e315);
+	t__2e315 = (u64)((u64)t__2e313 + (u64)((u64)12UL));
+	t__2e317 = (u64)(*(u32 *)t__2e315);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e314, (u64)t__2e316, (u64)t__2e317, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e319:;
+	t__2e320 = (u64)((u64)t_abortsite_2e311 * (u64)((u64)16UL));
+	t__2e320 = (u64)((u64)((u64)((char *)&D_abortsites_2e310)) + (u64)t__2e320);
+	t__2e321 = (u64)(*(u64 *)t__2e320);
+	t__2e322 = (u64)((u64)t__2e320 + (u64)((u64)8UL));
+	t__2e323 = (u64)(*(u32 *)t__2e322);
+	t__2e322 = (u64)((u64)t__2e320 + (u64)((u64)12UL));
+	t__2e324 = (u64)(*(u32 *)t__2e322);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e321, (u64)t__2e323, (u64)t__2e324, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_assertions(void) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e496;
+	u64 t__2e499;
+	u64 t__2e502;
+	u64 t__2e508;
+	u64 t__2e509;
+	u64 t__2e510;
+	u64 t__2e511;
+	u64 t__2e512;
+	u64 t__2e515;
+	u64 t__2e516;
+	u64 t__2e517;
+	u64 t__2e521;
+	u64 t__2e525;
+	u64 t__2e526;
+	u64 t__2e527;
+	u64 t__2e528;
+	u64 t__2e529;
+	u64 t__2e530;
+	u64 t__2e531;
+	u64 t__2e532;
+	u64 t_abortsite_2e506;
+	u64 t_binding_2e490;
+	u64 t_subval_2e501;
+	u64 t_subval_2e520;
+	L_start_2e486:;
+	t_binding_2e490 = (u64)A0;
+	L_body_2e487:;
+	*(u32 *)t_binding_2e490 = (u32)((u64)3481467866UL);
+	t__2e496 = (u64)((u64)t_binding_2e490 + (u64)((u64)4UL));
+	*(u16 *)t__2e496 = (u16)((u64)42UL);
+	t__2e499 = (u64)(u32)(*(u32 *)t_binding_2e490);
+	t_subval_2e501 = t_binding_2e490;
+	t__2e502 = (u64)(u32)(((u32)t__2e499 == (u32)((u64)3481467866UL)));
+	if ((u32)t__2e502) goto L_subtype_2e504; else goto L_passed_2e500;
+	L_subtype_2e504:;
+	goto L_passed_2e500;
+	L_passed_2e500:;
+	if ((u32)t__2e502) goto L_passed_2e498; else goto L_failed_2e497;
+	L_failed_2e497:;
+	t_abortsite_2e506 = ((u64)0UL);
+	goto L_abort_2e507;
+	L_passed_2e498:;
+	t__2e516 = t_binding_2e490;
+	t__2e517 = (u64)(u32)(*(u32 *)t_binding_2e490);
+	t_subval_2e520 = t_binding_2e490;
+	t__2e521 = (u64)(u32)(((u32)t__2e517 == (u32)((u64)3481467866UL)));
+	if ((u32)t__2e521) goto L_subtype_2e523; else goto L_failed_2e519;
+	L_subtype_2e523:;
+	goto L_passed_2e518;
+	L_failed_2e519:;
+	t_abortsite_2e506 = ((u64)1UL);
+	goto L_abort_2e524;
+	L_passed_2e518:;
+	t__2e516 = (u64)((u64)t__2e516 + (u64)((u64)4UL));
+	t__2e530 = (u64)(u32)(*(u16 *)t__2e516);
+	t__2e531 = (u64)(u32)((u16)t__2e530);
+	t__2e532 = (u64)(u32)((u16)((u64)42UL));
+	t__2e515 = (u64)(u32)(((u32)t__2e531 == (u32)t__2e532));
+	if ((u32)t__2e515) goto L_passed_2e514; else goto L_failed_2e513;
+	L_failed_2e513:;
+	t_abortsite_2e506 = ((u64)2UL);
+	goto L_abort_2e507;
+	L_passed_2e514:;
+	goto L__2e488;
+	L__2e533:;
+	L__2e488:;
+	return;
+	L_abort_2e507:;
+	t__2e508 = (u64)((u64)t_abortsite_2e506 * (u64)((u64)16UL));
+	t__2e508 = (u64)((u64)((u64)((char *)&D_abortsites_2e505)) + (u64)t__2e508);
+	t__2e509 = (u64)(*(u64 *)t__2e508);
+	t__2e510 = (u64)((u64)t__2e508 + (u64)((u64)8UL));
+	t__2e511 = (u64)(*(u32 *)t__2e510);
+	t__2e510 = (u64)((u64)t__2e508 + (u64)((u64)12UL));
+	t__2e512 = (u64)(*(u32 *)t__2e510);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e509, (u64)t__2e511, (u64)t__2e512, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e524:;
+	t__2e525 = (u64)((u64)t_abortsite_2e506 * (u64)((u64)16UL));
+	t__2e525 = (u64)((u64)((u64)((char *)&D_abortsites_2e505)) + (u64)t__2e525);
+	t__2e526 = (u64)(*(u64 *)t__2e525);
+	t__2e527 = (u64)((u64)t__2e525 + (u64)((u64)8UL));
+	t__2e528 = (u64)(*(u32 *)t__2e527);
+	t__2e527 = (u64)((u64)t__2e525 + (u64)((u64)12UL));
+	t__2e529 = (u64)(*(u32 *)t__2e527);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e526, (u64)t__2e528, (u64)t__2e529, (u64)((u64)1UL));
+	__builtin_trap();
+}
+static void F_castout(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[16] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	u64 t__2e542;
+	u64 t__2e545;
+	u64 t__2e546;
+	u64 t__2e547;
+	u64 t__2e551;
+	u64 t__2e552;
+	u64 t__2e553;
+	u64 t__2e554;
+	u64 t__2e555;
+	u64 t__2e558;
+	u64 t__2e559;
+	u64 t__2e560;
+	u64 t__2e564;
+	u64 t__2e568;
+	u64 t__2e569;
+	u64 t__2e570;
+	u64 t__2e571;
+	u64 t__2e572;
+	u64 t__2e573;
+	u64 t__2e576;
+	u64 t__2e579;
+	u64 t__2e588;
+	u64 t__2e589;
+	u64 t__2e592;
+	u64 t__2e593;
+	u64 t__2e594;
+	u64 t__2e598;
+	u64 t__2e599;
+	u64 t__2e602;
+	u64 t__2e605;
+	u64 t__2e606;
+	u64 t__2e607;
+	u64 t__2e608;
+	u64 t__2e611;
+	u64 t__2e614;
+	u64 t__2e615;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e627;
+	u64 t__2e628;
+	u64 t__2e629;
+	u64 t__2e633;
+	u64 t__2e636;
+	u64 t__2e641;
+	u64 t__2e642;
+	u64 t__2e645;
+	u64 t__2e646;
+	u64 t__2e647;
+	u64 t__2e651;
+	u64 t__2e654;
+	u64 t_abortsite_2e549;
+	u64 t_binding_2e538;
+	u64 t_binding_2e582;
+	u64 t_binding_2e618;
+	u64 t_binding_2e619;
+	u64 t_binding_2e637;
+	u64 t_subval_2e563;
+	u64 t_subval_2e578;
+	u64 t_subval_2e597;
+	u64 t_subval_2e613;
+	u64 t_subval_2e632;
+	u64 t_subval_2e650;
+	L_start_2e534:;
+	t_binding_2e538 = (u64)A0;
+	t_binding_2e582 = (u64)A1;
+	t_binding_2e618 = (u64)A2;
+	t_binding_2e619 = (u64)A3;
+	t_binding_2e637 = (u64)A4;
+	L_body_2e535:;
+	*(u32 *)t_binding_2e538 = (u32)((u64)1099590421UL);
+	t__2e542 = (u64)((u64)t_binding_2e538 + (u64)((u64)4UL));
+	*(u32 *)t__2e542 = (u32)((u64)1337UL);
+	t__2e546 = t_binding_2e538;
+	t__2e546 = (u64)((u64)t__2e546 + (u64)((u64)4UL));
+	t__2e547 = (u64)(u32)(*(i32 *)t__2e546);
+	t__2e545 = (u64)(u32)(((u32)t__2e547 == (u32)((u64)1337UL)));
+	if ((u32)t__2e545) goto L_passed_2e544; else goto L_failed_2e543;
+	L_failed_2e543:;
+	t_abortsite_2e549 = ((u64)0UL);
+	goto L_abort_2e550;
+	L_passed_2e544:;
+	t__2e559 = t_binding_2e538;
+	t__2e560 = (u64)(u32)(*(u32 *)t_binding_2e538);
+	t_subval_2e563 = t_binding_2e538;
+	t__2e564 = (u64)(u32)(((u32)t__2e560 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e564) goto L_subtype_2e566; else goto L_failed_2e562;
+	L_subtype_2e566:;
+	goto L_passed_2e561;
+	L_failed_2e562:;
+	t_abortsite_2e549 = ((u64)1UL);
+	goto L_abort_2e567;
+	L_passed_2e561:;
+	t__2e559 = (u64)((u64)t__2e559 + (u64)((u64)4UL));
+	t__2e573 = (u64)(u32)(*(i32 *)t__2e559);
+	t__2e558 = (u64)(u32)(((u32)t__2e573 == (u32)((u64)1337UL)));
+	if ((u32)t__2e558) goto L_passed_2e557; else goto L_failed_2e556;
+	L_failed_2e556:;
+	t_abortsite_2e549 = ((u64)2UL);
+	goto L_abort_2e550;
+	L_passed_2e557:;
+	t__2e576 = (u64)(u32)(*(u32 *)t_binding_2e538);
+	t_subval_2e578 = t_binding_2e538;
+	t__2e579 = (u64)(u32)(((u32)t__2e576 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e579) goto L_subtype_2e581; else goto L_passed_2e577;
+	L_subtype_2e581:;
+	goto L_passed_2e577;
+	L_passed_2e577:;
+	if ((u32)t__2e579) goto L_passed_2e575; else goto L_failed_2e574;
+	L_failed_2e574:;
+	t_abortsite_2e549 = ((u64)3UL);
+	goto L_abort_2e550;
+	L_passed_2e575:;
+	*(u32 *)t_binding_2e582 = (u32)((u64)1804912991UL);
+	t__2e588 = (u64)((u64)t_binding_2e582 + (u64)((u64)4UL));
+	*(u32 *)t__2e588 = (u32)((u64)1099590421UL);
+	t__2e589 = (u64)((u64)t__2e588 + (u64)((u64)4UL));
+	*(u32 *)t__2e589 = (u32)((u64)42UL);
+	t__2e593 = t_binding_2e582;
+	t__2e594 = (u64)(u32)(*(u32 *)t_binding_2e582);
+	t_subval_2e597 = t_binding_2e582;
+	t__2e598 = (u64)(u32)(((u32)t__2e594 == (u32)((u64)1804912991UL)));
+	if ((u32)t__2e598) goto L_subtype_2e600; else goto L_failed_2e596;
+	L_subtype_2e600:;
+	t_subval_2e597 = (u64)((u64)t_subval_2e597 + (u64)((u64)4UL));
+	t__2e599 = (u64)(u32)(*(u32 *)t_subval_2e597);
+	t__2e598 = (u64)(u32)(((u32)t__2e599 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e598) goto L_subtype_2e601; else goto L_failed_2e596;
+	L_subtype_2e601:;
+	goto L_passed_2e595;
+	L_failed_2e596:;
+	t_abortsite_2e549 = ((u64)4UL);
+	goto L_abort_2e567;
+	L_passed_2e595:;
+	t__2e593 = (u64)((u64)t__2e593 + (u64)((u64)8UL));
+	t__2e602 = (u64)(u32)(*(i32 *)t__2e593);
+	t__2e592 = (u64)(u32)(((u32)t__2e602 == (u32)((u64)42UL)));
+	if ((u32)t__2e592) goto L_passed_2e591; else goto L_failed_2e590;
+	L_failed_2e590:;
+	t_abortsite_2e549 = ((u64)5UL);
+	goto L_abort_2e550;
+	L_passed_2e591:;
+	t__2e606 = t_binding_2e582;
+	t__2e606 = (u64)((u64)t__2e606 + (u64)((u64)4UL));
+	t__2e607 = t__2e606;
+	t__2e607 = (u64)((u64)t__2e607 + (u64)((u64)4UL));
+	t__2e608 = (u64)(u32)(*(i32 *)t__2e607);
+	t__2e605 = (u64)(u32)(((u32)t__2e608 == (u32)((u64)42UL)));
+	if ((u32)t__2e605) goto L_passed_2e604; else goto L_failed_2e603;
+	L_failed_2e603:;
+	t_abortsite_2e549 = ((u64)6UL);
+	goto L_abort_2e550;
+	L_passed_2e604:;
+	t__2e611 = (u64)(u32)(*(u32 *)t_binding_2e582);
+	t_subval_2e613 = t_binding_2e582;
+	t__2e614 = (u64)(u32)(((u32)t__2e611 == (u32)((u64)1804912991UL)));
+	if ((u32)t__2e614) goto L_subtype_2e616; else goto L_passed_2e612;
+	L_subtype_2e616:;
+	t_subval_2e613 = (u64)((u64)t_subval_2e613 + (u64)((u64)4UL));
+	t__2e615 = (u64)(u32)(*(u32 *)t_subval_2e613);
+	t__2e614 = (u64)(u32)(((u32)t__2e615 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e614) goto L_subtype_2e617; else goto L_passed_2e612;
+	L_subtype_2e617:;
+	goto L_passed_2e612;
+	L_passed_2e612:;
+	if ((u32)t__2e614) goto L_passed_2e610; else goto L_failed_2e609;
+	L_failed_2e609:;
+	t_abortsite_2e549 = ((u64)7UL);
+	goto L_abort_2e550;
+	L_passed_2e610:;
+	*(u32 *)t_binding_2e618 = (u32)((u64)42UL);
+	*(u32 *)t_binding_2e619 = (u32)((u64)1537034487UL);
+	t__2e623 = (u64)((u64)t_binding_2e619 + (u64)((u64)4UL));
+	t__2e624 = (u64)(u32)(*(i32 *)t_binding_2e618);
+	*(u32 *)t__2e623 = (u32)t__2e624;
+	t__2e628 = t_binding_2e619;
+	t__2e629 = (u64)(u32)(*(u32 *)t_binding_2e619);
+	t_subval_2e632 = t_binding_2e619;
+	t__2e633 = (u64)(u32)(((u32)t__2e629 == (u32)((u64)1537034487UL)));
+	if ((u32)t__2e633) goto L_subtype_2e635; else goto L_failed_2e631;
+	L_subtype_2e635:;
+	goto L_passed_2e630;
+	L_failed_2e631:;
+	t_abortsite_2e549 = ((u64)8UL);
+	goto L_abort_2e567;
+	L_passed_2e630:;
+	t__2e628 = (u64)((u64)t__2e628 + (u64)((u64)4UL));
+	t__2e636 = (u64)(u32)(*(i32 *)t__2e628);
+	t__2e627 = (u64)(u32)(((u32)t__2e636 == (u32)((u64)42UL)));
+	if ((u32)t__2e627) goto L_passed_2e626; else goto L_failed_2e625;
+	L_failed_2e625:;
+	t_abortsite_2e549 = ((u64)9UL);
+	goto L_abort_2e550;
+	L_passed_2e626:;
+	*(u32 *)t_binding_2e637 = (u32)((u64)2005822081UL);
+	t__2e641 = (u64)((u64)t_binding_2e637 + (u64)((u64)4UL));
+	t__2e642 = (u64)(u32)(*(i32 *)t_binding_2e618);
+	*(u32 *)t__2e641 = (u32)t__2e642;
+	t__2e646 = t_binding_2e637;
+	t__2e647 = (u64)(u32)(*(u32 *)t_binding_2e637);
+	t_subval_2e650 = t_binding_2e637;
+	t__2e651 = (u64)(u32)(((u32)t__2e647 == (u32)((u64)2005822081UL)));
+	if ((u32)t__2e651) goto L_subtype_2e653; else goto L_failed_2e649;
+	L_subtype_2e653:;
+	goto L_passed_2e648;
+	L_failed_2e649:;
+	t_abortsite_2e549 = ((u64)10UL);
+	goto L_abort_2e567;
+	L_passed_2e648:;
+	t__2e646 = (u64)((u64)t__2e646 + (u64)((u64)4UL));
+	t__2e654 = (u64)(u32)(*(i32 *)t__2e646);
+	t__2e645 = (u64)(u32)(((u32)t__2e654 == (u32)((u64)42UL)));
+	if ((u32)t__2e645) goto L_passed_2e644; else goto L_failed_2e643;
+	L_failed_2e643:;
+	t_abortsite_2e549 = ((u64)11UL);
+	goto L_abort_2e550;
+	L_passed_2e644:;
+	goto L__2e536;
+	L__2e655:;
+	L__2e536:;
+	return;
+	L_abort_2e550:;
+	t__2e551 = (u64)((u64)t_abortsite_2e549 * (u64)((u64)16UL));
+	t__2e551 = (u64)((u64)((u64)((char *)&D_abortsites_2e548)) + (u64)t__2e551);
+	t__2e552 = (u64)(*(u64 *)t__2e551);
+	t__2e553 = (u64)((u64)t__2e551 + (u64)((u64)8UL));
+	t__2e554 = (u64)(*(u32 *)t__2e553);
+	t__2e553 = (u64)((u64)t__2e551 + (u64)((u64)12UL));
+	t__2e555 = (u64)(*(u32 *)t__2e553);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e552, (u64)t__2e554, (u64)t__2e555, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e567:;
+	t__2e568 = (u64)((u64)t_abortsite_2e549 * (u64)((u64)16UL));
+	t__2e568 = (u64)((u64)((u64)((char *)&D_abortsites_2e548)) + (u64)t__2e568);
+	t__2e569 = (u64)(*(u64 *)t__2e568);
+	t__2e570 = (u64)((u64)t__2e568 + (u64)((u64)8UL));
+	t__2e571 = (u64)(*(u32 *)t__2e570);
+	t__2e570 = (u64)((u64)t__2e568 + (u64)((u64)12UL));
+	t__2e572 = (u64)(*(u32 *)t__2e570);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e569, (u64)t__2e571, (u64)t__2e572, (u64)((u64)1UL));
+	__builtin_trap();
+}
+static void F_subsetcast(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[16] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[16] __attribute__((aligned(16)));
+	char A4[16] __attribute__((aligned(16)));
+	char A5[16] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[16] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[16] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	u64 t__2e664;
+	u64 t__2e669;
+	u64 t__2e670;
+	u64 t__2e673;
+	u64 t__2e677;
+	u64 t__2e678;
+	u64 t__2e679;
+	u64 t__2e680;
+	u64 t__2e681;
+	u64 t__2e684;
+	u64 t__2e685;
+	u64 t__2e687;
+	u64 t__2e694;
+	u64 t__2e697;
+	u64 t__2e699;
+	u64 t__2e700;
+	u64 t__2e704;
+	u64 t__2e708;
+	u64 t__2e709;
+	u64 t__2e710;
+	u64 t__2e711;
+	u64 t__2e712;
+	u64 t__2e713;
+	u64 t__2e716;
+	u64 t__2e718;
+	u64 t__2e721;
+	u64 t__2e724;
+	u64 t__2e725;
+	u64 t__2e729;
+	u64 t__2e732;
+	u64 t__2e735;
+	u64 t__2e738;
+	u64 t__2e741;
+	u64 t__2e743;
+	u64 t__2e746;
+	u64 t__2e749;
+	u64 t__2e752;
+	u64 t__2e755;
+	u64 t__2e758;
+	u64 t__2e759;
+	u64 t__2e761;
+	u64 t__2e766;
+	u64 t__2e767;
+	u64 t__2e769;
+	u64 t__2e772;
+	u64 t__2e773;
+	u64 t__2e775;
+	u64 t__2e777;
+	u64 t__2e780;
+	u64 t__2e782;
+	u64 t__2e783;
+	u64 t__2e787;
+	u64 t__2e790;
+	u64 t__2e793;
+	u64 t__2e795;
+	u64 t__2e798;
+	u64 t__2e801;
+	u64 t__2e802;
+	u64 t__2e806;
+	u64 t__2e809;
+	u64 t__2e812;
+	u64 t__2e815;
+	u64 t__2e818;
+	u64 t__2e820;
+	u64 t__2e823;
+	u64 t__2e826;
+	u64 t__2e829;
+	u64 t__2e832;
+	u64 t__2e835;
+	u64 t__2e836;
+	u64 t_abortsite_2e675;
+	u64 t_binding_2e660;
+	u64 t_binding_2e665;
+	u64 t_binding_2e666;
+	u64 t_binding_2e688;
+	u64 t_binding_2e760;
+	u64 t_binding_2e762;
+	u64 t_binding_2e763;
+	u64 t_binding_2e776;
+	u64 t_field_2e672;
+	u64 t_field_2e686;
+	u64 t_field_2e768;
+	u64 t_field_2e774;
+	u64 t_object_2e698;
+	u64 t_object_2e717;
+	u64 t_object_2e781;
+	u64 t_object_2e794;
+	u64 t_subval_2e703;
+	u64 t_subval_2e728;
+	u64 t_subval_2e748;
+	u64 t_subval_2e754;
+	u64 t_subval_2e786;
+	u64 t_subval_2e805;
+	u64 t_subval_2e825;
+	u64 t_subval_2e831;
+	L_start_2e656:;
+	t_binding_2e660 = (u64)A0;
+	t_binding_2e665 = (u64)A1;
+	t_binding_2e666 = (u64)A2;
+	t_binding_2e688 = (u64)A3;
+	t_object_2e698 = (u64)A4;
+	t_object_2e717 = (u64)A5;
+	t_binding_2e760 = (u64)A6;
+	t_binding_2e762 = (u64)A7;
+	t_binding_2e763 = (u64)A8;
+	t_binding_2e776 = (u64)A9;
+	t_object_2e781 = (u64)A10;
+	t_object_2e794 = (u64)A11;
+	L_body_2e657:;
+	*(u32 *)t_binding_2e660 = (u32)((u64)2206074632UL);
+	t__2e664 = (u64)((u64)t_binding_2e660 + (u64)((u64)8UL));
+	*(u64 *)t__2e664 = (u64)((u64)1337UL);
+	BLIT(t_binding_2e665, t_binding_2e660, ((u64)16UL));
+	*(u64 *)t_binding_2e666 = (u64)t_binding_2e665;
+	t__2e670 = (u64)(*(u64 *)t_binding_2e666);
+	t_field_2e672 = (u64)((u64)t__2e670 + (u64)((u64)0UL));
+	t__2e673 = (u64)(u32)(*(u32 *)t_field_2e672);
+	t__2e669 = (u64)(u32)(((u32)t__2e673 == (u32)((u64)2206074632UL)));
+	if ((u32)t__2e669) goto L_passed_2e668; else goto L_failed_2e667;
+	L_failed_2e667:;
+	t_abortsite_2e675 = ((u64)0UL);
+	goto L_abort_2e676;
+	L_passed_2e668:;
+	t__2e685 = (u64)(*(u64 *)t_binding_2e666);
+	t_field_2e686 = (u64)((u64)t__2e685 + (u64)((u64)8UL));
+	t__2e687 = (u64)(*(u64 *)t_field_2e686);
+	t__2e684 = (u64)(u32)(((u64)t__2e687 == (u64)((u64)1337UL)));
+	if ((u32)t__2e684) goto L_passed_2e683; else goto L_failed_2e682;
+	L_failed_2e682:;
+	t_abortsite_2e675 = ((u64)1UL);
+	goto L_abort_2e676;
+	L_passed_2e683:;
+	*(u32 *)t_binding_2e688 = (u32)((u64)2206074632UL);
+	t__2e694 = (u64)((u64)t_binding_2e688 + (u64)((u64)8UL));
+	*(u64 *)t__2e694 = (u64)((u64)2UL);
+	BLIT(t_object_2e698, t_binding_2e688, ((u64)16UL));
+	t__2e699 = t_object_2e698;
+	t__2e700 = (u64)(u32)(*(u32 *)t_object_2e698);
+	t_subval_2e703 = t_object_2e698;
+	t__2e704 = (u64)(u32)(((u32)t__2e700 == (u32)((u64)2206074632UL)));
+	if ((u32)t__2e704) goto L_subtype_2e706; else goto L_failed_2e702;
+	L_subtype_2e706:;
+	goto L_passed_2e701;
+	L_failed_2e702:;
+	t_abortsite_2e675 = ((u64)2UL);
+	goto L_abort_2e707;
+	L_passed_2e701:;
+	t__2e699 = (u64)((u64)t__2e699 + (u64)((u64)8UL));
+	t__2e713 = (u64)(*(u64 *)t__2e699);
+	t__2e697 = (u64)(u32)(((u64)t__2e713 == (u64)((u64)2UL)));
+	if ((u32)t__2e697) goto L_passed_2e696; else goto L_failed_2e695;
+	L_failed_2e695:;
+	t_abortsite_2e675 = ((u64)3UL);
+	goto L_abort_2e676;
+	L_passed_2e696:;
+	BLIT(t_object_2e717, t_binding_2e688, ((u64)16UL));
+	t__2e718 = (u64)(u32)(*(u32 *)t_object_2e717);
+	t__2e721 = (u64)(u32)(((u32)t__2e718 == (u32)((u64)2206074632UL)));
+	if ((u32)t__2e721) goto L_passed_2e719; else goto L__2e722;
+	L__2e722:;
+	t__2e721 = (u64)(u32)(((u32)t__2e718 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e721) goto L_passed_2e719; else goto L__2e723;
+	L__2e723:;
+	goto L_failed_2e720;
+	L_failed_2e720:;
+	t_abortsite_2e675 = ((u64)4UL);
+	goto L_abort_2e707;
+	L_passed_2e719:;
+	t__2e724 = t_object_2e717;
+	t__2e725 = (u64)(u32)(*(u32 *)t_object_2e717);
+	t_subval_2e728 = t_object_2e717;
+	t__2e729 = (u64)(u32)(((u32)t__2e725 == (u32)((u64)2206074632UL)));
+	if ((u32)t__2e729) goto L_subtype_2e731; else goto L_failed_2e727;
+	L_subtype_2e731:;
+	goto L_passed_2e726;
+	L_failed_2e727:;
+	t_abortsite_2e675 = ((u64)5UL);
+	goto L_abort_2e707;
+	L_passed_2e726:;
+	t__2e724 = (u64)((u64)t__2e724 + (u64)((u64)8UL));
+	t__2e732 = (u64)(*(u64 *)t__2e724);
+	t__2e716 = (u64)(u32)(((u64)t__2e732 == (u64)((u64)2UL)));
+	if ((u32)t__2e716) goto L_passed_2e715; else goto L_failed_2e714;
+	L_failed_2e714:;
+	t_abortsite_2e675 = ((u64)6UL);
+	goto L_abort_2e676;
+	L_passed_2e715:;
+	t__2e741 = (u64)(u32)(*(u32 *)t_binding_2e688);
+	t__2e743 = (u64)(u32)(((u32)t__2e741 == (u32)((u64)2206074632UL)));
+	if ((u32)t__2e743) goto L_passed_2e742; else goto L__2e744;
+	L__2e744:;
+	t__2e743 = (u64)(u32)(((u32)t__2e741 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e743) goto L_passed_2e742; else goto L__2e745;
+	L__2e745:;
+	goto L_passed_2e742;
+	L_passed_2e742:;
+	t__2e738 = (u64)(u32)t__2e743;
+	if ((u32)t__2e738) goto L__2e739; else goto L__2e740;
+	L__2e739:;
+	t__2e746 = (u64)(u32)(*(u32 *)t_binding_2e688);
+	t_subval_2e748 = t_binding_2e688;
+	t__2e749 = (u64)(u32)(((u32)t__2e746 == (u32)((u64)2206074632UL)));
+	if ((u32)t__2e749) goto L_subtype_2e751; else goto L_passed_2e747;
+	L_subtype_2e751:;
+	goto L_passed_2e747;
+	L_passed_2e747:;
+	t__2e738 = (u64)(u32)t__2e749;
+	goto L__2e740;
+	L__2e740:;
+	t__2e735 = (u64)(u32)t__2e738;
+	if ((u32)t__2e735) goto L__2e736; else goto L__2e737;
+	L__2e736:;
+	t__2e752 = (u64)(u32)(*(u32 *)t_binding_2e688);
+	t_subval_2e754 = t_binding_2e688;
+	t__2e755 = (u64)(u32)(((u32)t__2e752 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e755) goto L_subtype_2e757; else goto L_passed_2e753;
+	L_subtype_2e757:;
+	goto L_passed_2e753;
+	L_passed_2e753:;
+	t__2e759 = (u64)(u32)((u8)t__2e755);
+	t__2e758 = (u64)(u32)(((u32)t__2e759 == (u32)((u64)0UL)));
+	t__2e735 = (u64)(u32)t__2e758;
+	goto L__2e737;
+	L__2e737:;
+	if ((u32)t__2e735) goto L_passed_2e734; else goto L_failed_2e733;
+	L_failed_2e733:;
+	t_abortsite_2e675 = ((u64)7UL);
+	goto L_abort_2e676;
+	L_passed_2e734:;
+	*(u32 *)t_binding_2e760 = (u32)((u64)1099590421UL);
+	t__2e761 = (u64)((u64)t_binding_2e760 + (u64)((u64)4UL));
+	*(u32 *)t__2e761 = (u32)((u64)1337UL);
+	BLIT(t_binding_2e762, t_binding_2e760, ((u64)8UL));
+	*(u64 *)t_binding_2e763 = (u64)t_binding_2e762;
+	t__2e767 = (u64)(*(u64 *)t_binding_2e763);
+	t_field_2e768 = (u64)((u64)t__2e767 + (u64)((u64)0UL));
+	t__2e769 = (u64)(u32)(*(u32 *)t_field_2e768);
+	t__2e766 = (u64)(u32)(((u32)t__2e769 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e766) goto L_passed_2e765; else goto L_failed_2e764;
+	L_failed_2e764:;
+	t_abortsite_2e675 = ((u64)8UL);
+	goto L_abort_2e676;
+	L_passed_2e765:;
+	t__2e773 = (u64)(*(u64 *)t_binding_2e763);
+	t_field_2e774 = (u64)((u64)t__2e773 + (u64)((u64)4UL));
+	t__2e775 = (u64)(u32)(*(i32 *)t_field_2e774);
+	t__2e772 = (u64)(u32)(((u32)t__2e775 == (u32)((u64)1337UL)));
+	if ((u32)t__2e772) goto L_passed_2e771; else goto L_failed_2e770;
+	L_failed_2e770:;
+	t_abortsite_2e675 = ((u64)9UL);
+	goto L_abort_2e676;
+	L_passed_2e771:;
+	*(u32 *)t_binding_2e776 = (u32)((u64)1099590421UL);
+	t__2e777 = (u64)((u64)t_binding_2e776 + (u64)((u64)4UL));
+	*(u32 *)t__2e777 = (u32)((u64)2UL);
+	BLIT(t_object_2e781, t_binding_2e776, ((u64)16UL));
+	t__2e782 = t_object_2e781;
+	t__2e783 = (u64)(u32)(*(u32 *)t_object_2e781);
+	t_subval_2e786 = t_object_2e781;
+	t__2e787 = (u64)(u32)(((u32)t__2e783 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e787) goto L_subtype_2e789; else goto L_failed_2e785;
+	L_subtype_2e789:;
+	goto L_passed_2e784;
+	L_failed_2e785:;
+	t_abortsite_2e675 = ((u64)10UL);
+	goto L_abort_2e707;
+	L_passed_2e784:;
+	t__2e782 = (u64)((u64)t__2e782 + (u64)((u64)4UL));
+	t__2e790 = (u64)(u32)(*(i32 *)t__2e782);
+	t__2e780 = (u64)(u32)(((u32)t__2e790 == (u32)((u64)2UL)));
+	if ((u32)t__2e780) goto L_passed_2e779; else goto L_failed_2e778;
+	L_failed_2e778:;
+	t_abortsite_2e675 = ((u64)11UL);
+	goto L_abort_2e676;
+	L_passed_2e779:;
+	BLIT(t_object_2e794, t_binding_2e776, ((u64)16UL));
+	t__2e795 = (u64)(u32)(*(u32 *)t_object_2e794);
+	t__2e798 = (u64)(u32)(((u32)t__2e795 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e798) goto L_passed_2e796; else goto L__2e799;
+	L__2e799:;
+	t__2e798 = (u64)(u32)(((u32)t__2e795 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e798) goto L_passed_2e796; else goto L__2e800;
+	L__2e800:;
+	goto L_failed_2e797;
+	L_failed_2e797:;
+	t_abortsite_2e675 = ((u64)12UL);
+	goto L_abort_2e707;
+	L_passed_2e796:;
+	t__2e801 = t_object_2e794;
+	t__2e802 = (u64)(u32)(*(u32 *)t_object_2e794);
+	t_subval_2e805 = t_object_2e794;
+	t__2e806 = (u64)(u32)(((u32)t__2e802 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e806) goto L_subtype_2e808; else goto L_failed_2e804;
+	L_subtype_2e808:;
+	goto L_passed_2e803;
+	L_failed_2e804:;
+	t_abortsite_2e675 = ((u64)13UL);
+	goto L_abort_2e707;
+	L_passed_2e803:;
+	t__2e801 = (u64)((u64)t__2e801 + (u64)((u64)4UL));
+	t__2e809 = (u64)(u32)(*(i32 *)t__2e801);
+	t__2e793 = (u64)(u32)(((u32)t__2e809 == (u32)((u64)2UL)));
+	if ((u32)t__2e793) goto L_passed_2e792; else goto L_failed_2e791;
+	L_failed_2e791:;
+	t_abortsite_2e675 = ((u64)14UL);
+	goto L_abort_2e676;
+	L_passed_2e792:;
+	t__2e818 = (u64)(u32)(*(u32 *)t_binding_2e776);
+	t__2e820 = (u64)(u32)(((u32)t__2e818 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e820) goto L_passed_2e819; else goto L__2e821;
+	L__2e821:;
+	t__2e820 = (u64)(u32)(((u32)t__2e818 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e820) goto L_passed_2e819; else goto L__2e822;
+	L__2e822:;
+	goto L_passed_2e819;
+	L_passed_2e819:;
+	t__2e815 = (u64)(u32)t__2e820;
+	if ((u32)t__2e815) goto L__2e816; else goto L__2e817;
+	L__2e816:;
+	t__2e823 = (u64)(u32)(*(u32 *)t_binding_2e776);
+	t_subval_2e825 = t_binding_2e776;
+	t__2e826 = (u64)(u32)(((u32)t__2e823 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e826) goto L_subtype_2e828; else goto L_passed_2e824;
+	L_subtype_2e828:;
+	goto L_passed_2e824;
+	L_passed_2e824:;
+	t__2e815 = (u64)(u32)t__2e826;
+	goto L__2e817;
+	L__2e817:;
+	t__2e812 = (u64)(u32)t__2e815;
+	if ((u32)t__2e812) goto L__2e813; else goto L__2e814;
+	L__2e813:;
+	t__2e829 = (u64)(u32)(*(u32 *)t_binding_2e776);
+	t_subval_2e831 = t_binding_2e776;
+	t__2e832 = (u64)(u32)(((u32)t__2e829 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e832) goto L_subtype_2e834; else goto L_passed_2e830;
+	L_subtype_2e834:;
+	goto L_passed_2e830;
+	L_passed_2e830:;
+	t__2e836 = (u64)(u32)((u8)t__2e832);
+	t__2e835 = (u64)(u32)(((u32)t__2e836 == (u32)((u64)0UL)));
+	t__2e812 = (u64)(u32)t__2e835;
+	goto L__2e814;
+	L__2e814:;
+	if ((u32)t__2e812) goto L_passed_2e811; else goto L_failed_2e810;
+	L_failed_2e810:;
+	t_abortsite_2e675 = ((u64)15UL);
+	goto L_abort_2e676;
+	L_passed_2e811:;
+	goto L__2e658;
+	L__2e837:;
+	L__2e658:;
+	return;
+	L_abort_2e676:;
+	t__2e677 = (u64)((u64)t_abortsite_2e675 * (u64)((u64)16UL));
+	t__2e677 = (u64)((u64)((u64)((char *)&D_abortsites_2e674)) + (u64)t__2e677);
+	t__2e678 = (u64)(*(u64 *)t__2e677);
+	t__2e679 = (u64)((u64)t__2e677 + (u64)((u64)8UL));
+	t__2e680 = (u64)(*(u32 *)t__2e679);
+	t__2e679 = (u64)((u64)t__2e677 + (u64)((u64)12UL));
+	t__2e681 = (u64)(*(u32 *)t__2e679);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e678, (u64)t__2e680, (u64)t__2e681, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e707:;
+	t__2e708 = (u64)((u64)t_abortsite_2e675 * (u64)((u64)16UL));
+	t__2e708 = (u64)((u64)((u64)((char *)&D_abortsites_2e674)) + (u64)t__2e708);
+	t__2e709 = (u64)(*(u64 *)t__2e708);
+	t__2e710 = (u64)((u64)t__2e708 + (u64)((u64)8UL));
+	t__2e711 = (u64)(*(u32 *)t__2e710);
+	t__2e710 = (u64)((u64)t__2e708 + (u64)((u64)12UL));
+	t__2e712 = (u64)(*(u32 *)t__2e710);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e709, (u64)t__2e711, (u64)t__2e712, (u64)((u64)1UL));
+	__builtin_trap();
+}
+static void F_membercast(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[16] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	u64 t__2e846;
+	u64 t__2e847;
+	u64 t__2e850;
+	u64 t__2e854;
+	u64 t__2e855;
+	u64 t__2e856;
+	u64 t__2e857;
+	u64 t__2e858;
+	u64 t__2e860;
+	u64 t__2e863;
+	u64 t__2e864;
+	u64 t__2e866;
+	u64 t__2e869;
+	u64 t__2e870;
+	u64 t__2e872;
+	u64 t__2e877;
+	u64 t__2e881;
+	u64 t__2e882;
+	u64 t__2e886;
+	u64 t__2e889;
+	u64 t__2e890;
+	u64 t__2e893;
+	u64 t__2e895;
+	u64 t__2e898;
+	u64 t__2e899;
+	u64 t__2e901;
+	u64 t__2e904;
+	u64 t__2e905;
+	u64 t__2e908;
+	u64 t__2e910;
+	u64 t__2e914;
+	u64 t__2e915;
+	u64 t__2e918;
+	u64 t__2e921;
+	u64 t__2e922;
+	u64 t__2e924;
+	u64 t_abortsite_2e852;
+	u64 t_binding_2e842;
+	u64 t_binding_2e843;
+	u64 t_binding_2e873;
+	u64 t_binding_2e878;
+	u64 t_binding_2e909;
+	u64 t_binding_2e911;
+	u64 t_field_2e849;
+	u64 t_field_2e865;
+	u64 t_field_2e871;
+	u64 t_field_2e885;
+	u64 t_field_2e891;
+	u64 t_field_2e892;
+	u64 t_field_2e900;
+	u64 t_field_2e906;
+	u64 t_field_2e907;
+	u64 t_field_2e917;
+	u64 t_field_2e923;
+	u64 t_object_2e859;
+	u64 t_object_2e894;
+	L_start_2e838:;
+	t_binding_2e842 = (u64)A0;
+	t_binding_2e843 = (u64)A1;
+	t_object_2e859 = (u64)A2;
+	t_binding_2e873 = (u64)A3;
+	t_binding_2e878 = (u64)A4;
+	t_object_2e894 = (u64)A5;
+	t_binding_2e909 = (u64)A6;
+	t_binding_2e911 = (u64)A7;
+	L_body_2e839:;
+	*(u32 *)t_binding_2e842 = (u32)((u64)3012680272UL);
+	*(u64 *)t_binding_2e843 = (u64)t_binding_2e842;
+	t__2e847 = (u64)(*(u64 *)t_binding_2e843);
+	t_field_2e849 = (u64)((u64)t__2e847 + (u64)((u64)0UL));
+	t__2e850 = (u64)(u32)(*(u32 *)t_field_2e849);
+	t__2e846 = (u64)(u32)(((u32)t__2e850 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e846) goto L_passed_2e845; else goto L_failed_2e844;
+	L_failed_2e844:;
+	t_abortsite_2e852 = ((u64)0UL);
+	goto L_abort_2e853;
+	L_passed_2e845:;
+	*(u32 *)t_object_2e859 = (u32)((u64)1099590421UL);
+	t__2e860 = (u64)((u64)t_object_2e859 + (u64)((u64)4UL));
+	*(u32 *)t__2e860 = (u32)((u64)1337UL);
+	BLIT(t_binding_2e842, t_object_2e859, ((u64)8UL));
+	t__2e864 = (u64)(*(u64 *)t_binding_2e843);
+	t_field_2e865 = (u64)((u64)t__2e864 + (u64)((u64)0UL));
+	t__2e866 = (u64)(u32)(*(u32 *)t_field_2e865);
+	t__2e863 = (u64)(u32)(((u32)t__2e866 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e863) goto L_passed_2e862; else goto L_failed_2e861;
+	L_failed_2e861:;
+	t_abortsite_2e852 = ((u64)1UL);
+	goto L_abort_2e853;
+	L_passed_2e862:;
+	t__2e870 = (u64)(*(u64 *)t_binding_2e843);
+	t_field_2e871 = (u64)((u64)t__2e870 + (u64)((u64)4UL));
+	t__2e872 = (u64)(u32)(*(i32 *)t_field_2e871);
+	t__2e869 = (u64)(u32)(((u32)t__2e872 == (u32)((u64)1337UL)));
+	if ((u32)t__2e869) goto L_passed_2e868; else goto L_failed_2e867;
+	L_failed_2e867:;
+	t_abortsite_2e852 = ((u64)2UL);
+	goto L_abort_2e853;
+	L_passed_2e868:;
+	*(u32 *)t_binding_2e873 = (u32)((u64)1099590421UL);
+	t__2e877 = (u64)((u64)t_binding_2e873 + (u64)((u64)4UL));
+	*(u32 *)t__2e877 = (u32)((u64)1337UL);
+	*(u64 *)t_binding_2e878 = (u64)t_binding_2e873;
+	t__2e882 = (u64)(*(u64 *)t_binding_2e878);
+	t_field_2e885 = (u64)((u64)t__2e882 + (u64)((u64)0UL));
+	t__2e886 = (u64)(u32)(*(u32 *)t_field_2e885);
+	t__2e881 = (u64)(u32)(((u32)t__2e886 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e881) goto L_passed_2e880; else goto L_failed_2e879;
+	L_failed_2e879:;
+	t_abortsite_2e852 = ((u64)3UL);
+	goto L_abort_2e853;
+	L_passed_2e880:;
+	t__2e890 = (u64)(*(u64 *)t_binding_2e878);
+	t_field_2e891 = (u64)((u64)t__2e890 + (u64)((u64)4UL));
+	t_field_2e892 = (u64)((u64)t_field_2e891 + (u64)((u64)0UL));
+	t__2e893 = (u64)(u32)(*(i32 *)t_field_2e892);
+	t__2e889 = (u64)(u32)(((u32)t__2e893 == (u32)((u64)1337UL)));
+	if ((u32)t__2e889) goto L_passed_2e888; else goto L_failed_2e887;
+	L_failed_2e887:;
+	t_abortsite_2e852 = ((u64)4UL);
+	goto L_abort_2e853;
+	L_passed_2e888:;
+	*(u32 *)t_object_2e894 = (u32)((u64)1568378015UL);
+	t__2e895 = (u64)((u64)t_object_2e894 + (u64)((u64)4UL));
+	*(u32 *)t__2e895 = (u32)((u64)1096149893UL);
+	BLIT(t_binding_2e873, t_object_2e894, ((u64)8UL));
+	t__2e899 = (u64)(*(u64 *)t_binding_2e878);
+	t_field_2e900 = (u64)((u64)t__2e899 + (u64)((u64)0UL));
+	t__2e901 = (u64)(u32)(*(u32 *)t_field_2e900);
+	t__2e898 = (u64)(u32)(((u32)t__2e901 == (u32)((u64)1568378015UL)));
+	if ((u32)t__2e898) goto L_passed_2e897; else goto L_failed_2e896;
+	L_failed_2e896:;
+	t_abortsite_2e852 = ((u64)5UL);
+	goto L_abort_2e853;
+	L_passed_2e897:;
+	t__2e905 = (u64)(*(u64 *)t_binding_2e878);
+	t_field_2e906 = (u64)((u64)t__2e905 + (u64)((u64)4UL));
+	t_field_2e907 = (u64)((u64)t_field_2e906 + (u64)((u64)0UL));
+	t__2e908 = (u64)(*(u32 *)t_field_2e907);
+	t__2e904 = (u64)(u32)((BF(t__2e908) == BF(((u64)1096149893UL))));
+	if ((u32)t__2e904) goto L_passed_2e903; else goto L_failed_2e902;
+	L_failed_2e902:;
+	t_abortsite_2e852 = ((u64)6UL);
+	goto L_abort_2e853;
+	L_passed_2e903:;
+	*(u32 *)t_binding_2e909 = (u32)((u64)2206074632UL);
+	t__2e910 = (u64)((u64)t_binding_2e909 + (u64)((u64)8UL));
+	*(u64 *)t__2e910 = (u64)((u64)1337UL);
+	*(u64 *)t_binding_2e911 = (u64)t_binding_2e909;
+	t__2e915 = (u64)(*(u64 *)t_binding_2e911);
+	t_field_2e917 = (u64)((u64)t__2e915 + (u64)((u64)0UL));
+	t__2e918 = (u64)(u32)(*(u32 *)t_field_2e917);
+	t__2e914 = (u64)(u32)(((u32)t__2e918 == (u32)((u64)2206074632UL)));
+	if ((u32)t__2e914) goto L_passed_2e913; else goto L_failed_2e912;
+	L_failed_2e912:;
+	t_abortsite_2e852 = ((u64)7UL);
+	goto L_abort_2e853;
+	L_passed_2e913:;
+	t__2e922 = (u64)(*(u64 *)t_binding_2e911);
+	t_field_2e923 = (u64)((u64)t__2e922 + (u64)((u64)8UL));
+	t__2e924 = (u64)(*(u64 *)t_field_2e923);
+	t__2e921 = (u64)(u32)(((u64)t__2e924 == (u64)((u64)1337UL)));
+	if ((u32)t__2e921) goto L_passed_2e920; else goto L_failed_2e919;
+	L_failed_2e919:;
+	t_abortsite_2e852 = ((u64)8UL);
+	goto L_abort_2e853;
+	L_passed_2e920:;
+	goto L__2e840;
+	L__2e925:;
+	L__2e840:;
+	return;
+	L_abort_2e853:;
+	t__2e854 = (u64)((u64)t_abortsite_2e852 * (u64)((u64)16UL));
+	t__2e854 = (u64)((u64)((u64)((char *)&D_abortsites_2e851)) + (u64)t__2e854);
+	t__2e855 = (u64)(*(u64 *)t__2e854);
+	t__2e856 = (u64)((u64)t__2e854 + (u64)((u64)8UL));
+	t__2e857 = (u64)(*(u32 *)t__2e856);
+	t__2e856 = (u64)((u64)t__2e854 + (u64)((u64)12UL));
+	t__2e858 = (u64)(*(u32 *)t__2e856);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e855, (u64)t__2e857, (u64)t__2e858, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_casts(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	char A2[2] __attribute__((aligned(16)));
+	char A3[1] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	u64 t__2e931;
+	u64 t__2e934;
+	u64 t__2e935;
+	u64 t__2e936;
+	u64 t__2e940;
+	u64 t__2e946;
+	u64 t__2e947;
+	u64 t__2e948;
+	u64 t__2e949;
+	u64 t__2e950;
+	u64 t__2e951;
+	u64 t__2e952;
+	u64 t__2e953;
+	u64 t__2e955;
+	u64 t__2e956;
+	u64 t__2e957;
+	u64 t__2e958;
+	u64 t__2e959;
+	u64 t__2e961;
+	u64 t__2e962;
+	u64 t__2e965;
+	u64 t__2e966;
+	u64 t__2e967;
+	u64 t__2e968;
+	u64 t__2e971;
+	u64 t__2e972;
+	u64 t__2e974;
+	u64 t__2e975;
+	u64 t__2e976;
+	u64 t__2e977;
+	u64 t__2e979;
+	u64 t__2e980;
+	u64 t__2e981;
+	u64 t__2e984;
+	u64 t__2e985;
+	u64 t__2e986;
+	u64 t__2e990;
+	u64 t__2e991;
+	u64 t__2e992;
+	u64 t__2e993;
+	u64 t_abortsite_2e944;
+	u64 t_binding_2e930;
+	u64 t_binding_2e960;
+	u64 t_binding_2e969;
+	u64 t_binding_2e970;
+	u64 t_object_2e978;
+	u64 t_subval_2e939;
+	L_start_2e926:;
+	t_binding_2e930 = (u64)A0;
+	t_binding_2e960 = (u64)A1;
+	t_binding_2e969 = (u64)A2;
+	t_binding_2e970 = (u64)A3;
+	t_object_2e978 = (u64)A4;
+	L_body_2e927:;
+	*(u32 *)t_binding_2e930 = (u32)((u64)3481467866UL);
+	t__2e931 = (u64)((u64)t_binding_2e930 + (u64)((u64)4UL));
+	*(u16 *)t__2e931 = (u16)((u64)42UL);
+	t__2e935 = t_binding_2e930;
+	t__2e936 = (u64)(u32)(*(u32 *)t_binding_2e930);
+	t_subval_2e939 = t_binding_2e930;
+	t__2e940 = (u64)(u32)(((u32)t__2e936 == (u32)((u64)3481467866UL)));
+	if ((u32)t__2e940) goto L_subtype_2e942; else goto L_failed_2e938;
+	L_subtype_2e942:;
+	goto L_passed_2e937;
+	L_failed_2e938:;
+	t_abortsite_2e944 = ((u64)0UL);
+	goto L_abort_2e945;
+	L_passed_2e937:;
+	t__2e935 = (u64)((u64)t__2e935 + (u64)((u64)4UL));
+	t__2e951 = (u64)(u32)(*(u16 *)t__2e935);
+	t__2e952 = (u64)(u32)((u16)t__2e951);
+	t__2e953 = (u64)(u32)((u16)((u64)42UL));
+	t__2e934 = (u64)(u32)(((u32)t__2e952 == (u32)t__2e953));
+	if ((u32)t__2e934) goto L_passed_2e933; else goto L_failed_2e932;
+	L_failed_2e932:;
+	t_abortsite_2e944 = ((u64)1UL);
+	goto L_abort_2e954;
+	L_passed_2e933:;
+	t__2e961 = t_binding_2e930;
+	t__2e961 = (u64)((u64)t__2e961 + (u64)((u64)4UL));
+	t__2e962 = (u64)(u32)(*(u8 *)t__2e961);
+	*(u8 *)t_binding_2e960 = (u8)t__2e962;
+	t__2e966 = (u64)(u32)(*(u8 *)t_binding_2e960);
+	t__2e967 = (u64)(u32)((u8)t__2e966);
+	t__2e968 = (u64)(u32)((u8)((u64)42UL));
+	t__2e965 = (u64)(u32)(((u32)t__2e967 == (u32)t__2e968));
+	if ((u32)t__2e965) goto L_passed_2e964; else goto L_failed_2e963;
+	L_failed_2e963:;
+	t_abortsite_2e944 = ((u64)2UL);
+	goto L_abort_2e954;
+	L_passed_2e964:;
+	*(u16 *)t_binding_2e969 = (u16)((u64)48879UL);
+	t__2e974 = (u64)((i64)(i32)((u64)0UL));
+	t__2e972 = (u64)((u64)t__2e974 * (u64)((u64)1UL));
+	t__2e972 = (u64)((u64)t_binding_2e969 + (u64)t__2e972);
+	t__2e975 = (u64)(u32)(*(u8 *)t__2e972);
+	t__2e976 = (u64)(u32)((u8)t__2e975);
+	t__2e977 = (u64)(u32)((u8)((u64)239UL));
+	t__2e971 = (u64)(u32)(((u32)t__2e976 == (u32)t__2e977));
+	*(u8 *)t_binding_2e970 = (u8)t__2e971;
+	*(u32 *)t_object_2e978 = (u32)((u64)3481467866UL);
+	t__2e979 = (u64)((u64)t_object_2e978 + (u64)((u64)4UL));
+	*(u16 *)t__2e979 = (u16)((u64)51966UL);
+	BLIT(t_binding_2e930, t_object_2e978, ((u64)8UL));
+	t__2e980 = t_binding_2e930;
+	t__2e980 = (u64)((u64)t__2e980 + (u64)((u64)4UL));
+	t__2e981 = (u64)(u32)(*(u8 *)t__2e980);
+	*(u8 *)t_binding_2e960 = (u8)t__2e981;
+	t__2e985 = (u64)(u32)(*(u8 *)t_binding_2e960);
+	t__2e990 = (u64)(u32)(*(u8 *)t_binding_2e970);
+	t__2e991 = (u64)(u32)((u8)t__2e990);
+	if ((u32)t__2e991) goto L_true_2e987; else goto L_false_2e988;
+	L_true_2e987:;
+	t__2e986 = (u64)(u32)((u64)254UL);
+	goto L__2e989;
+	L_false_2e988:;
+	t__2e986 = (u64)(u32)((u64)202UL);
+	L__2e989:;
+	t__2e992 = (u64)(u32)((u8)t__2e985);
+	t__2e993 = (u64)(u32)((u8)t__2e986);
+	t__2e984 = (u64)(u32)(((u32)t__2e992 == (u32)t__2e993));
+	if ((u32)t__2e984) goto L_passed_2e983; else goto L_failed_2e982;
+	L_failed_2e982:;
+	t_abortsite_2e944 = ((u64)3UL);
+	goto L_abort_2e954;
+	L_passed_2e983:;
+	goto L__2e928;
+	L__2e994:;
+	L__2e928:;
+	return;
+	L_abort_2e945:;
+	t__2e946 = (u64)((u64)t_abortsite_2e944 * (u64)((u64)16UL));
+	t__2e946 = (u64)((u64)((u64)((char *)&D_abortsites_2e943)) + (u64)t__2e946);
+	t__2e947 = (u64)(*(u64 *)t__2e946);
+	t__2e948 = (u64)((u64)t__2e946 + (u64)((u64)8UL));
+	t__2e949 = (u64)(*(u32 *)t__2e948);
+	t__2e948 = (u64)((u64)t__2e946 + (u64)((u64)12UL));
+	t__2e950 = (u64)(*(u32 *)t__2e948);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e947, (u64)t__2e949, (u64)t__2e950, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e954:;
+	t__2e955 = (u64)((u64)t_abortsite_2e944 * (u64)((u64)16UL));
+	t__2e955 = (u64)((u64)((u64)((char *)&D_abortsites_2e943)) + (u64)t__2e955);
+	t__2e956 = (u64)(*(u64 *)t__2e955);
+	t__2e957 = (u64)((u64)t__2e955 + (u64)((u64)8UL));
+	t__2e958 = (u64)(*(u32 *)t__2e957);
+	t__2e957 = (u64)((u64)t__2e955 + (u64)((u64)12UL));
+	t__2e959 = (u64)(*(u32 *)t__2e957);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e956, (u64)t__2e958, (u64)t__2e959, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_reduction(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[16] __attribute__((aligned(16)));
+	char B9[8] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char R12[4] __attribute__((aligned(16)));
+	char B13[8] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char R16[4] __attribute__((aligned(16)));
+	u64 t__2e1005;
+	u64 t__2e1010;
+	u64 t__2e1012;
+	u64 t__2e1016;
+	u64 t__2e1025;
+	u64 t__2e1027;
+	u64 t__2e1031;
+	u64 t__2e1032;
+	u64 t__2e1033;
+	u64 t__2e1034;
+	u64 t__2e1035;
+	u64 t__2e1038;
+	u64 t__2e1039;
+	u64 t__2e1040;
+	u64 t__2e1041;
+	u64 t__2e1042;
+	u64 t__2e1044;
+	u64 t__2e1046;
+	u64 t__2e1050;
+	u64 t__2e1059;
+	u64 t__2e1061;
+	u64 t__2e1065;
+	u64 t__2e1068;
+	u64 t__2e1071;
+	u64 t__2e1074;
+	u64 t__2e1077;
+	u64 t__2e1080;
+	u64 t__2e1083;
+	u64 t__2e1086;
+	u64 t__2e1096;
+	u64 t__2e1099;
+	u64 t__2e1102;
+	u64 t__2e1106;
+	u64 t__2e1107;
+	u64 t__2e1108;
+	u64 t__2e1109;
+	u64 t__2e1110;
+	u64 t__2e1113;
+	u64 t__2e1116;
+	u64 t__2e1119;
+	u64 t__2e1121;
+	u64 t__2e1124;
+	u64 t__2e1127;
+	u64 t_abortsite_2e1029;
+	u64 t_binding_2e1006;
+	u64 t_binding_2e1007;
+	u64 t_binding_2e1008;
+	u64 t_binding_2e1120;
+	u64 t_binding_2e999;
+	u64 t_object_2e1011;
+	u64 t_object_2e1015;
+	u64 t_object_2e1045;
+	u64 t_object_2e1049;
+	u64 t_subval_2e1076;
+	u64 t_subval_2e1082;
+	u64 t_subval_2e1095;
+	u64 t_subval_2e1101;
+	u64 t_subval_2e1126;
+	u64 t_tag_2e1017;
+	u64 t_tag_2e1051;
+	L_start_2e995:;
+	t_binding_2e999 = (u64)A0;
+	t_binding_2e1006 = (u64)A1;
+	t_binding_2e1007 = (u64)A2;
+	t_binding_2e1008 = (u64)A3;
+	t_object_2e1011 = (u64)A4;
+	t_object_2e1015 = (u64)A5;
+	t_object_2e1045 = (u64)A6;
+	t_object_2e1049 = (u64)A7;
+	t_binding_2e1120 = (u64)A8;
+	L_body_2e996:;
+	*(u32 *)t_binding_2e999 = (u32)((u64)2674862226UL);
+	t__2e1005 = (u64)((u64)t_binding_2e999 + (u64)((u64)4UL));
+	*(u8 *)t__2e1005 = (u8)((u64)42UL);
+	BLIT(t_binding_2e1006, t_binding_2e999, ((u64)8UL));
+	BLIT(t_binding_2e1007, t_binding_2e999, ((u64)8UL));
+	BLIT(t_binding_2e1008, t_binding_2e999, ((u64)8UL));
+	*(u32 *)t_object_2e1011 = (u32)((u64)3532310079UL);
+	t__2e1012 = (u64)((u64)t_object_2e1011 + (u64)((u64)4UL));
+	*(u32 *)t__2e1012 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1015 = (u64)((u64)0UL);
+	t__2e1016 = (u64)((u64)t_object_2e1015 + (u64)((u64)8UL));
+	*(u64 *)t__2e1016 = (u64)((u64)0UL);
+	t__2e1016 = (u64)((u64)t__2e1016 + (u64)((u64)8UL));
+	*(u64 *)t__2e1016 = (u64)((u64)0UL);
+	BLIT((u64)B9, t_object_2e1011, 8);
+	BLIT((u64)B10, ((u64)((char *)&D_strliteral_2e1014)), 24);
+	BLIT((u64)B11, t_object_2e1015, 24);
+	t__2e1010 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R12, (u64)B9, (u64)B10, (u64)B11);
+	t_tag_2e1017 = (u64)(*(u32 *)t__2e1010);
+	t__2e1025 = (u64)(u32)(((u32)t_tag_2e1017 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1025) goto L_member_2e1022; else goto L__2e1024;
+	L__2e1024:;
+	t__2e1027 = (u64)(u32)(((u32)t_tag_2e1017 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1027) goto L_member_2e1023; else goto L__2e1026;
+	L__2e1026:;
+	goto L_matches_2e1021;
+	L_member_2e1022:;
+	goto L_matches_2e1021;
+	L_member_2e1023:;
+	goto L_matches_2e1020;
+	L_matches_2e1020:;
+	goto L__2e1018;
+	L_matches_2e1021:;
+	t_abortsite_2e1029 = ((u64)0UL);
+	goto L_abort_2e1030;
+	L__2e1036:;
+	L__2e1019:;
+	t_abortsite_2e1029 = ((u64)1UL);
+	goto L_abort_2e1037;
+	L__2e1018:;
+	*(u32 *)t_object_2e1045 = (u32)((u64)3532310079UL);
+	t__2e1046 = (u64)((u64)t_object_2e1045 + (u64)((u64)4UL));
+	*(u32 *)t__2e1046 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1049 = (u64)((u64)0UL);
+	t__2e1050 = (u64)((u64)t_object_2e1049 + (u64)((u64)8UL));
+	*(u64 *)t__2e1050 = (u64)((u64)0UL);
+	t__2e1050 = (u64)((u64)t__2e1050 + (u64)((u64)8UL));
+	*(u64 *)t__2e1050 = (u64)((u64)0UL);
+	BLIT((u64)B13, t_object_2e1045, 8);
+	BLIT((u64)B14, ((u64)((char *)&D_strliteral_2e1048)), 24);
+	BLIT((u64)B15, t_object_2e1049, 24);
+	t__2e1044 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R16, (u64)B13, (u64)B14, (u64)B15);
+	t_tag_2e1051 = (u64)(*(u32 *)t__2e1044);
+	t__2e1059 = (u64)(u32)(((u32)t_tag_2e1051 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1059) goto L_member_2e1056; else goto L__2e1058;
+	L__2e1058:;
+	t__2e1061 = (u64)(u32)(((u32)t_tag_2e1051 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1061) goto L_member_2e1057; else goto L__2e1060;
+	L__2e1060:;
+	goto L_matches_2e1055;
+	L_member_2e1056:;
+	goto L_matches_2e1055;
+	L_member_2e1057:;
+	goto L_matches_2e1054;
+	L_matches_2e1054:;
+	goto L__2e1052;
+	L_matches_2e1055:;
+	t_abortsite_2e1029 = ((u64)2UL);
+	goto L_abort_2e1030;
+	L__2e1062:;
+	L__2e1053:;
+	t_abortsite_2e1029 = ((u64)3UL);
+	goto L_abort_2e1037;
+	L__2e1052:;
+	t__2e1074 = (u64)(u32)(*(u32 *)t_binding_2e999);
+	t_subval_2e1076 = t_binding_2e999;
+	t__2e1077 = (u64)(u32)(((u32)t__2e1074 == (u32)((u64)2674862226UL)));
+	if ((u32)t__2e1077) goto L_subtype_2e1079; else goto L_passed_2e1075;
+	L_subtype_2e1079:;
+	goto L_passed_2e1075;
+	L_passed_2e1075:;
+	t__2e1071 = (u64)(u32)t__2e1077;
+	if ((u32)t__2e1071) goto L__2e1072; else goto L__2e1073;
+	L__2e1072:;
+	t__2e1080 = (u64)(u32)(*(u32 *)t_binding_2e1006);
+	t_subval_2e1082 = t_binding_2e1006;
+	t__2e1083 = (u64)(u32)(((u32)t__2e1080 == (u32)((u64)2674862226UL)));
+	if ((u32)t__2e1083) goto L_subtype_2e1085; else goto L_passed_2e1081;
+	L_subtype_2e1085:;
+	goto L_passed_2e1081;
+	L_passed_2e1081:;
+	t__2e1071 = (u64)(u32)t__2e1083;
+	goto L__2e1073;
+	L__2e1073:;
+	t__2e1068 = (u64)(u32)t__2e1071;
+	if ((u32)t__2e1068) goto L__2e1069; else goto L__2e1070;
+	L__2e1069:;
+	t__2e1086 = (u64)(u32)(*(u32 *)t_binding_2e1007);
+	t_subval_2e1095 = t_binding_2e1007;
+	t__2e1096 = (u64)(u32)(((u32)t__2e1086 == (u32)((u64)2674862226UL)));
+	if ((u32)t__2e1096) goto L_subtype_2e1098; else goto L_passed_2e1094;
+	L_subtype_2e1098:;
+	goto L_passed_2e1094;
+	L_passed_2e1094:;
+	t__2e1068 = (u64)(u32)t__2e1096;
+	goto L__2e1070;
+	L__2e1070:;
+	t__2e1065 = (u64)(u32)t__2e1068;
+	if ((u32)t__2e1065) goto L__2e1066; else goto L__2e1067;
+	L__2e1066:;
+	t__2e1099 = (u64)(u32)(*(u32 *)t_binding_2e1008);
+	t_subval_2e1101 = t_binding_2e1008;
+	t__2e1102 = (u64)(u32)(((u32)t__2e1099 == (u32)((u64)2674862226UL)));
+	if ((u32)t__2e1102) goto L_subtype_2e1104; else goto L_passed_2e1100;
+	L_subtype_2e1104:;
+	goto L_passed_2e1100;
+	L_passed_2e1100:;
+	t__2e1065 = (u64)(u32)t__2e1102;
+	goto L__2e1067;
+	L__2e1067:;
+	if ((u32)t__2e1065) goto L_passed_2e1064; else goto L_failed_2e1063;
+	L_failed_2e1063:;
+	t_abortsite_2e1029 = ((u64)4UL);
+	goto L_abort_2e1105;
+	L_passed_2e1064:;
+	t__2e1113 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e1113) goto L_passed_2e1112; else goto L_failed_2e1111;
+	L_failed_2e1111:;
+	t_abortsite_2e1029 = ((u64)5UL);
+	goto L_abort_2e1105;
+	L_passed_2e1112:;
+	t__2e1116 = (u64)(u32)(((u64)((u64)16UL) == (u64)((u64)16UL)));
+	if ((u32)t__2e1116) goto L_passed_2e1115; else goto L_failed_2e1114;
+	L_failed_2e1114:;
+	t_abortsite_2e1029 = ((u64)6UL);
+	goto L_abort_2e1105;
+	L_passed_2e1115:;
+	t__2e1119 = (u64)(u32)(((u64)((u64)16UL) != (u64)((u64)24UL)));
+	if ((u32)t__2e1119) goto L_passed_2e1118; else goto L_failed_2e1117;
+	L_failed_2e1117:;
+	t_abortsite_2e1029 = ((u64)7UL);
+	goto L_abort_2e1105;
+	L_passed_2e1118:;
+	*(u32 *)t_binding_2e1120 = (u32)((u64)1099590421UL);
+	t__2e1121 = (u64)((u64)t_binding_2e1120 + (u64)((u64)4UL));
+	*(u32 *)t__2e1121 = (u32)((u64)10UL);
+	t__2e1124 = (u64)(u32)(*(u32 *)t_binding_2e1120);
+	t_subval_2e1126 = t_binding_2e1120;
+	t__2e1127 = (u64)(u32)(((u32)t__2e1124 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1127) goto L_subtype_2e1129; else goto L_passed_2e1125;
+	L_subtype_2e1129:;
+	goto L_passed_2e1125;
+	L_passed_2e1125:;
+	if ((u32)t__2e1127) goto L_passed_2e1123; else goto L_failed_2e1122;
+	L_failed_2e1122:;
+	t_abortsite_2e1029 = ((u64)8UL);
+	goto L_abort_2e1105;
+	L_passed_2e1123:;
+	goto L__2e997;
+	L__2e1130:;
+	L__2e997:;
+	return;
+	L_abort_2e1030:;
+	t__2e1031 = (u64)((u64)t_abortsite_2e1029 * (u64)((u64)16UL));
+	t__2e1031 = (u64)((u64)((u64)((char *)&D_abortsites_2e1028)) + (u64)t__2e1031);
+	t__2e1032 = (u64)(*(u64 *)t__2e1031);
+	t__2e1033 = (u64)((u64)t__2e1031 + (u64)((u64)8UL));
+	t__2e1034 = (u64)(*(u32 *)t__2e1033);
+	t__2e1033 = (u64)((u64)t__2e1031 + (u64)((u64)12UL));
+	t__2e1035 = (u64)(*(u32 *)t__2e1033);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1032, (u64)t__2e1034, (u64)t__2e1035, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e1037:;
+	t__2e1038 = (u64)((u64)t_abortsite_2e1029 * (u64)((u64)16UL));
+	t__2e1038 = (u64)((u64)((u64)((char *)&D_abortsites_2e1028)) + (u64)t__2e1038);
+	t__2e1039 = (u64)(*(u64 *)t__2e1038);
+	t__2e1040 = (u64)((u64)t__2e1038 + (u64)((u64)8UL));
+	t__2e1041 = (u64)(*(u32 *)t__2e1040);
+	t__2e1040 = (u64)((u64)t__2e1038 + (u64)((u64)12UL));
+	t__2e1042 = (u64)(*(u32 *)t__2e1040);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1039, (u64)t__2e1041, (u64)t__2e1042, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e1105:;
+	t__2e1106 = (u64)((u64)t_abortsite_2e1029 * (u64)((u64)16UL));
+	t__2e1106 = (u64)((u64)((u64)((char *)&D_abortsites_2e1028)) + (u64)t__2e1106);
+	t__2e1107 = (u64)(*(u64 *)t__2e1106);
+	t__2e1108 = (u64)((u64)t__2e1106 + (u64)((u64)8UL));
+	t__2e1109 = (u64)(*(u32 *)t__2e1108);
+	t__2e1108 = (u64)((u64)t__2e1106 + (u64)((u64)12UL));
+	t__2e1110 = (u64)(*(u32 *)t__2e1108);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1107, (u64)t__2e1109, (u64)t__2e1110, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_operators(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[16] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	char A3[16] __attribute__((aligned(16)));
+	u64 t__2e1145;
+	u64 t__2e1148;
+	u64 t__2e1151;
+	u64 t__2e1157;
+	u64 t__2e1158;
+	u64 t__2e1159;
+	u64 t__2e1160;
+	u64 t__2e1161;
+	u64 t__2e1163;
+	u64 t__2e1166;
+	u64 t__2e1169;
+	u64 t__2e1173;
+	u64 t__2e1176;
+	u64 t__2e1179;
+	u64 t__2e1183;
+	u64 t__2e1186;
+	u64 t__2e1189;
+	u64 t_abortsite_2e1155;
+	u64 t_binding_2e1135;
+	u64 t_object_2e1162;
+	u64 t_object_2e1172;
+	u64 t_object_2e1182;
+	u64 t_subval_2e1150;
+	u64 t_subval_2e1168;
+	u64 t_subval_2e1178;
+	u64 t_subval_2e1188;
+	L_start_2e1131:;
+	t_binding_2e1135 = (u64)A0;
+	t_object_2e1162 = (u64)A1;
+	t_object_2e1172 = (u64)A2;
+	t_object_2e1182 = (u64)A3;
+	L_body_2e1132:;
+	*(u32 *)t_binding_2e1135 = (u32)((u64)3181589295UL);
+	t__2e1145 = (u64)((u64)t_binding_2e1135 + (u64)((u64)4UL));
+	*(u8 *)t__2e1145 = (u8)((u64)42UL);
+	t__2e1148 = (u64)(u32)(*(u32 *)t_binding_2e1135);
+	t_subval_2e1150 = t_binding_2e1135;
+	t__2e1151 = (u64)(u32)(((u32)t__2e1148 == (u32)((u64)3181589295UL)));
+	if ((u32)t__2e1151) goto L_subtype_2e1153; else goto L_passed_2e1149;
+	L_subtype_2e1153:;
+	goto L_passed_2e1149;
+	L_passed_2e1149:;
+	if ((u32)t__2e1151) goto L_passed_2e1147; else goto L_failed_2e1146;
+	L_failed_2e1146:;
+	t_abortsite_2e1155 = ((u64)0UL);
+	goto L_abort_2e1156;
+	L_passed_2e1147:;
+	*(u32 *)t_object_2e1162 = (u32)((u64)3481467866UL);
+	t__2e1163 = (u64)((u64)t_object_2e1162 + (u64)((u64)4UL));
+	*(u16 *)t__2e1163 = (u16)((u64)1337UL);
+	BLIT(t_binding_2e1135, t_object_2e1162, ((u64)16UL));
+	t__2e1166 = (u64)(u32)(*(u32 *)t_binding_2e1135);
+	t_subval_2e1168 = t_binding_2e1135;
+	t__2e1169 = (u64)(u32)(((u32)t__2e1166 == (u32)((u64)3481467866UL)));
+	if ((u32)t__2e1169) goto L_subtype_2e1171; else goto L_passed_2e1167;
+	L_subtype_2e1171:;
+	goto L_passed_2e1167;
+	L_passed_2e1167:;
+	if ((u32)t__2e1169) goto L_passed_2e1165; else goto L_failed_2e1164;
+	L_failed_2e1164:;
+	t_abortsite_2e1155 = ((u64)1UL);
+	goto L_abort_2e1156;
+	L_passed_2e1165:;
+	*(u32 *)t_object_2e1172 = (u32)((u64)1906196061UL);
+	t__2e1173 = (u64)((u64)t_object_2e1172 + (u64)((u64)4UL));
+	*(u32 *)t__2e1173 = (u32)((u64)3405691582UL);
+	BLIT(t_binding_2e1135, t_object_2e1172, ((u64)16UL));
+	t__2e1176 = (u64)(u32)(*(u32 *)t_binding_2e1135);
+	t_subval_2e1178 = t_binding_2e1135;
+	t__2e1179 = (u64)(u32)(((u32)t__2e1176 == (u32)((u64)1906196061UL)));
+	if ((u32)t__2e1179) goto L_subtype_2e1181; else goto L_passed_2e1177;
+	L_subtype_2e1181:;
+	goto L_passed_2e1177;
+	L_passed_2e1177:;
+	if ((u32)t__2e1179) goto L_passed_2e1175; else goto L_failed_2e1174;
+	L_failed_2e1174:;
+	t_abortsite_2e1155 = ((u64)2UL);
+	goto L_abort_2e1156;
+	L_passed_2e1175:;
+	*(u32 *)t_object_2e1182 = (u32)((u64)1268499444UL);
+	t__2e1183 = (u64)((u64)t_object_2e1182 + (u64)((u64)8UL));
+	*(u64 *)t__2e1183 = (u64)((u64)14627333968688430831UL);
+	BLIT(t_binding_2e1135, t_object_2e1182, ((u64)16UL));
+	t__2e1186 = (u64)(u32)(*(u32 *)t_binding_2e1135);
+	t_subval_2e1188 = t_binding_2e1135;
+	t__2e1189 = (u64)(u32)(((u32)t__2e1186 == (u32)((u64)1268499444UL)));
+	if ((u32)t__2e1189) goto L_subtype_2e1191; else goto L_passed_2e1187;
+	L_subtype_2e1191:;
+	goto L_passed_2e1187;
+	L_passed_2e1187:;
+	if ((u32)t__2e1189) goto L_passed_2e1185; else goto L_failed_2e1184;
+	L_failed_2e1184:;
+	t_abortsite_2e1155 = ((u64)3UL);
+	goto L_abort_2e1156;
+	L_passed_2e1185:;
+	goto L__2e1133;
+	L__2e1192:;
+	L__2e1133:;
+	return;
+	L_abort_2e1156:;
+	t__2e1157 = (u64)((u64)t_abortsite_2e1155 * (u64)((u64)16UL));
+	t__2e1157 = (u64)((u64)((u64)((char *)&D_abortsites_2e1154)) + (u64)t__2e1157);
+	t__2e1158 = (u64)(*(u64 *)t__2e1157);
+	t__2e1159 = (u64)((u64)t__2e1157 + (u64)((u64)8UL));
+	t__2e1160 = (u64)(*(u32 *)t__2e1159);
+	t__2e1159 = (u64)((u64)t__2e1157 + (u64)((u64)12UL));
+	t__2e1161 = (u64)(*(u32 *)t__2e1159);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1158, (u64)t__2e1160, (u64)t__2e1161, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_storage(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	char A3[16] __attribute__((aligned(16)));
+	char A4[16] __attribute__((aligned(16)));
+	u64 t__2e1198;
+	u64 t__2e1202;
+	u64 t__2e1206;
+	u64 t__2e1207;
+	u64 t__2e1208;
+	u64 t__2e1209;
+	u64 t__2e1210;
+	u64 t__2e1213;
+	u64 t__2e1216;
+	u64 t__2e1219;
+	u64 t__2e1222;
+	u64 t__2e1223;
+	u64 t__2e1226;
+	u64 t__2e1229;
+	u64 t__2e1230;
+	u64 t__2e1232;
+	u64 t__2e1233;
+	u64 t__2e1234;
+	u64 t__2e1236;
+	u64 t__2e1239;
+	u64 t__2e1240;
+	u64 t__2e1242;
+	u64 t__2e1245;
+	u64 t__2e1246;
+	u64 t__2e1248;
+	u64 t__2e1249;
+	u64 t__2e1250;
+	u64 t__2e1252;
+	u64 t__2e1255;
+	u64 t__2e1256;
+	u64 t__2e1258;
+	u64 t__2e1261;
+	u64 t__2e1262;
+	u64 t__2e1264;
+	u64 t__2e1266;
+	u64 t__2e1269;
+	u64 t__2e1270;
+	u64 t__2e1272;
+	u64 t__2e1275;
+	u64 t__2e1276;
+	u64 t__2e1278;
+	u64 t_abortsite_2e1204;
+	u64 t_binding_2e1197;
+	u64 t_binding_2e1199;
+	u64 t_field_2e1225;
+	u64 t_field_2e1231;
+	u64 t_field_2e1241;
+	u64 t_field_2e1247;
+	u64 t_field_2e1257;
+	u64 t_field_2e1263;
+	u64 t_field_2e1271;
+	u64 t_field_2e1277;
+	u64 t_object_2e1235;
+	u64 t_object_2e1251;
+	u64 t_object_2e1265;
+	L_start_2e1193:;
+	t_binding_2e1197 = (u64)A0;
+	t_binding_2e1199 = (u64)A1;
+	t_object_2e1235 = (u64)A2;
+	t_object_2e1251 = (u64)A3;
+	t_object_2e1265 = (u64)A4;
+	L_body_2e1194:;
+	*(u32 *)t_binding_2e1197 = (u32)((u64)3181589295UL);
+	t__2e1198 = (u64)((u64)t_binding_2e1197 + (u64)((u64)4UL));
+	*(u8 *)t__2e1198 = (u8)((u64)42UL);
+	*(u64 *)t_binding_2e1199 = (u64)t_binding_2e1197;
+	t__2e1202 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e1202) goto L_passed_2e1201; else goto L_failed_2e1200;
+	L_failed_2e1200:;
+	t_abortsite_2e1204 = ((u64)0UL);
+	goto L_abort_2e1205;
+	L_passed_2e1201:;
+	t__2e1213 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e1213) goto L_passed_2e1212; else goto L_failed_2e1211;
+	L_failed_2e1211:;
+	t_abortsite_2e1204 = ((u64)1UL);
+	goto L_abort_2e1205;
+	L_passed_2e1212:;
+	t__2e1216 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e1216) goto L_passed_2e1215; else goto L_failed_2e1214;
+	L_failed_2e1214:;
+	t_abortsite_2e1204 = ((u64)2UL);
+	goto L_abort_2e1205;
+	L_passed_2e1215:;
+	t__2e1219 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e1219) goto L_passed_2e1218; else goto L_failed_2e1217;
+	L_failed_2e1217:;
+	t_abortsite_2e1204 = ((u64)3UL);
+	goto L_abort_2e1205;
+	L_passed_2e1218:;
+	t__2e1223 = (u64)(*(u64 *)t_binding_2e1199);
+	t_field_2e1225 = (u64)((u64)t__2e1223 + (u64)((u64)0UL));
+	t__2e1226 = (u64)(u32)(*(u32 *)t_field_2e1225);
+	t__2e1222 = (u64)(u32)(((u32)t__2e1226 == (u32)((u64)3181589295UL)));
+	if ((u32)t__2e1222) goto L_passed_2e1221; else goto L_failed_2e1220;
+	L_failed_2e1220:;
+	t_abortsite_2e1204 = ((u64)4UL);
+	goto L_abort_2e1205;
+	L_passed_2e1221:;
+	t__2e1230 = (u64)(*(u64 *)t_binding_2e1199);
+	t_field_2e1231 = (u64)((u64)t__2e1230 + (u64)((u64)4UL));
+	t__2e1232 = (u64)(u32)(*(u8 *)t_field_2e1231);
+	t__2e1233 = (u64)(u32)((u8)t__2e1232);
+	t__2e1234 = (u64)(u32)((u8)((u64)42UL));
+	t__2e1229 = (u64)(u32)(((u32)t__2e1233 == (u32)t__2e1234));
+	if ((u32)t__2e1229) goto L_passed_2e1228; else goto L_failed_2e1227;
+	L_failed_2e1227:;
+	t_abortsite_2e1204 = ((u64)5UL);
+	goto L_abort_2e1205;
+	L_passed_2e1228:;
+	*(u32 *)t_object_2e1235 = (u32)((u64)3481467866UL);
+	t__2e1236 = (u64)((u64)t_object_2e1235 + (u64)((u64)4UL));
+	*(u16 *)t__2e1236 = (u16)((u64)1337UL);
+	BLIT(t_binding_2e1197, t_object_2e1235, ((u64)16UL));
+	t__2e1240 = (u64)(*(u64 *)t_binding_2e1199);
+	t_field_2e1241 = (u64)((u64)t__2e1240 + (u64)((u64)0UL));
+	t__2e1242 = (u64)(u32)(*(u32 *)t_field_2e1241);
+	t__2e1239 = (u64)(u32)(((u32)t__2e1242 == (u32)((u64)3481467866UL)));
+	if ((u32)t__2e1239) goto L_passed_2e1238; else goto L_failed_2e1237;
+	L_failed_2e1237:;
+	t_abortsite_2e1204 = ((u64)6UL);
+	goto L_abort_2e1205;
+	L_passed_2e1238:;
+	t__2e1246 = (u64)(*(u64 *)t_binding_2e1199);
+	t_field_2e1247 = (u64)((u64)t__2e1246 + (u64)((u64)4UL));
+	t__2e1248 = (u64)(u32)(*(u16 *)t_field_2e1247);
+	t__2e1249 = (u64)(u32)((u16)t__2e1248);
+	t__2e1250 = (u64)(u32)((u16)((u64)1337UL));
+	t__2e1245 = (u64)(u32)(((u32)t__2e1249 == (u32)t__2e1250));
+	if ((u32)t__2e1245) goto L_passed_2e1244; else goto L_failed_2e1243;
+	L_failed_2e1243:;
+	t_abortsite_2e1204 = ((u64)7UL);
+	goto L_abort_2e1205;
+	L_passed_2e1244:;
+	*(u32 *)t_object_2e1251 = (u32)((u64)1906196061UL);
+	t__2e1252 = (u64)((u64)t_object_2e1251 + (u64)((u64)4UL));
+	*(u32 *)t__2e1252 = (u32)((u64)3405691582UL);
+	BLIT(t_binding_2e1197, t_object_2e1251, ((u64)16UL));
+	t__2e1256 = (u64)(*(u64 *)t_binding_2e1199);
+	t_field_2e1257 = (u64)((u64)t__2e1256 + (u64)((u64)0UL));
+	t__2e1258 = (u64)(u32)(*(u32 *)t_field_2e1257);
+	t__2e1255 = (u64)(u32)(((u32)t__2e1258 == (u32)((u64)1906196061UL)));
+	if ((u32)t__2e1255) goto L_passed_2e1254; else goto L_failed_2e1253;
+	L_failed_2e1253:;
+	t_abortsite_2e1204 = ((u64)8UL);
+	goto L_abort_2e1205;
+	L_passed_2e1254:;
+	t__2e1262 = (u64)(*(u64 *)t_binding_2e1199);
+	t_field_2e1263 = (u64)((u64)t__2e1262 + (u64)((u64)4UL));
+	t__2e1264 = (u64)(u32)(*(u32 *)t_field_2e1263);
+	t__2e1261 = (u64)(u32)(((u32)t__2e1264 == (u32)((u64)3405691582UL)));
+	if ((u32)t__2e1261) goto L_passed_2e1260; else goto L_failed_2e1259;
+	L_failed_2e1259:;
+	t_abortsite_2e1204 = ((u64)9UL);
+	goto L_abort_2e1205;
+	L_passed_2e1260:;
+	*(u32 *)t_object_2e1265 = (u32)((u64)1268499444UL);
+	t__2e1266 = (u64)((u64)t_object_2e1265 + (u64)((u64)8UL));
+	*(u64 *)t__2e1266 = (u64)((u64)14627333968688430831UL);
+	BLIT(t_binding_2e1197, t_object_2e1265, ((u64)16UL));
+	t__2e1270 = (u64)(*(u64 *)t_binding_2e1199);
+	t_field_2e1271 = (u64)((u64)t__2e1270 + (u64)((u64)0UL));
+	t__2e1272 = (u64)(u32)(*(u32 *)t_field_2e1271);
+	t__2e1269 = (u64)(u32)(((u32)t__2e1272 == (u32)((u64)1268499444UL)));
+	if ((u32)t__2e1269) goto L_passed_2e1268; else goto L_failed_2e1267;
+	L_failed_2e1267:;
+	t_abortsite_2e1204 = ((u64)10UL);
+	goto L_abort_2e1205;
+	L_passed_2e1268:;
+	t__2e1276 = (u64)(*(u64 *)t_binding_2e1199);
+	t_field_2e1277 = (u64)((u64)t__2e1276 + (u64)((u64)8UL));
+	t__2e1278 = (u64)(*(u64 *)t_field_2e1277);
+	t__2e1275 = (u64)(u32)(((u64)t__2e1278 == (u64)((u64)14627333968688430831UL)));
+	if ((u32)t__2e1275) goto L_passed_2e1274; else goto L_failed_2e1273;
+	L_failed_2e1273:;
+	t_abortsite_2e1204 = ((u64)11UL);
+	goto L_abort_2e1205;
+	L_passed_2e1274:;
+	goto L__2e1195;
+	L__2e1279:;
+	L__2e1195:;
+	return;
+	L_abort_2e1205:;
+	t__2e1206 = (u64)((u64)t_abortsite_2e1204 * (u64)((u64)16UL));
+	t__2e1206 = (u64)((u64)((u64)((char *)&D_abortsites_2e1203)) + (u64)t__2e1206);
+	t__2e1207 = (u64)(*(u64 *)t__2e1206);
+	t__2e1208 = (u64)((u64)t__2e1206 + (u64)((u64)8UL));
+	t__2e1209 = (u64)(*(u32 *)t__2e1208);
+	t__2e1208 = (u64)((u64)t__2e1206 + (u64)((u64)12UL));
+	t__2e1210 = (u64)(*(u32 *)t__2e1208);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1207, (u64)t__2e1209, (u64)t__2e1210, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_measurements(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e1294;
+	u64 t__2e1299;
+	u64 t__2e1300;
+	u64 t__2e1303;
+	u64 t__2e1304;
+	u64 t__2e1308;
+	u64 t__2e1309;
+	u64 t__2e1310;
+	u64 t__2e1311;
+	u64 t__2e1312;
+	u64 t__2e1315;
+	u64 t__2e1316;
+	u64 t__2e1317;
+	u64 t__2e1320;
+	u64 t__2e1321;
+	u64 t__2e1322;
+	u64 t__2e1323;
+	u64 t__2e1326;
+	u64 t__2e1327;
+	u64 t__2e1328;
+	u64 t__2e1329;
+	u64 t__2e1336;
+	u64 t__2e1339;
+	u64 t__2e1342;
+	u64 t_abortsite_2e1306;
+	u64 t_binding_2e1284;
+	u64 t_binding_2e1295;
+	u64 t_binding_2e1330;
+	L_start_2e1280:;
+	t_binding_2e1284 = (u64)A0;
+	t_binding_2e1295 = (u64)A1;
+	t_binding_2e1330 = (u64)A2;
+	L_body_2e1281:;
+	*(u32 *)t_binding_2e1284 = (u32)((u64)3481467866UL);
+	t__2e1294 = (u64)((u64)t_binding_2e1284 + (u64)((u64)4UL));
+	*(u16 *)t__2e1294 = (u16)((u64)1337UL);
+	t__2e1299 = (u64)(u32)(((u64)((u64)8UL) < (u64)((u64)4UL)));
+	t__2e1300 = (u64)(u32)((u8)t__2e1299);
+	if ((u32)t__2e1300) goto L_true_2e1296; else goto L_false_2e1297;
+	L_true_2e1296:;
+	*(u64 *)t_binding_2e1295 = (u64)((u64)4UL);
+	goto L__2e1298;
+	L_false_2e1297:;
+	*(u64 *)t_binding_2e1295 = (u64)((u64)8UL);
+	L__2e1298:;
+	t__2e1304 = (u64)(*(u64 *)t_binding_2e1295);
+	t__2e1303 = (u64)(u32)(((u64)((u64)8UL) == (u64)t__2e1304));
+	if ((u32)t__2e1303) goto L_passed_2e1302; else goto L_failed_2e1301;
+	L_failed_2e1301:;
+	t_abortsite_2e1306 = ((u64)0UL);
+	goto L_abort_2e1307;
+	L_passed_2e1302:;
+	t__2e1317 = (u64)(*(u64 *)t_binding_2e1295);
+	t__2e1316 = (u64)((u64)t__2e1317 << (((u64)1UL) & 63));
+	t__2e1315 = (u64)(u32)(((u64)((u64)16UL) == (u64)t__2e1316));
+	if ((u32)t__2e1315) goto L_passed_2e1314; else goto L_failed_2e1313;
+	L_failed_2e1313:;
+	t_abortsite_2e1306 = ((u64)1UL);
+	goto L_abort_2e1307;
+	L_passed_2e1314:;
+	t__2e1322 = t_binding_2e1284;
+	t__2e1323 = t__2e1322;
+	t__2e1321 = (u64)((u64)t__2e1323 & (u64)((u64)3UL));
+	t__2e1320 = (u64)(u32)(((u64)t__2e1321 == (u64)((u64)0UL)));
+	if ((u32)t__2e1320) goto L_passed_2e1319; else goto L_failed_2e1318;
+	L_failed_2e1318:;
+	t_abortsite_2e1306 = ((u64)2UL);
+	goto L_abort_2e1307;
+	L_passed_2e1319:;
+	t__2e1328 = t_binding_2e1284;
+	t__2e1329 = t__2e1328;
+	t__2e1327 = (u64)((u64)t__2e1329 & (u64)((u64)7UL));
+	t__2e1326 = (u64)(u32)(((u64)t__2e1327 == (u64)((u64)0UL)));
+	if ((u32)t__2e1326) goto L_passed_2e1325; else goto L_failed_2e1324;
+	L_failed_2e1324:;
+	t_abortsite_2e1306 = ((u64)3UL);
+	goto L_abort_2e1307;
+	L_passed_2e1325:;
+	*(u32 *)t_binding_2e1330 = (u32)((u64)3481467866UL);
+	t__2e1336 = (u64)((u64)t_binding_2e1330 + (u64)((u64)4UL));
+	*(u16 *)t__2e1336 = (u16)((u64)1337UL);
+	t__2e1339 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e1339) goto L_passed_2e1338; else goto L_failed_2e1337;
+	L_failed_2e1337:;
+	t_abortsite_2e1306 = ((u64)4UL);
+	goto L_abort_2e1307;
+	L_passed_2e1338:;
+	t__2e1342 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e1342) goto L_passed_2e1341; else goto L_failed_2e1340;
+	L_failed_2e1340:;
+	t_abortsite_2e1306 = ((u64)5UL);
+	goto L_abort_2e1307;
+	L_passed_2e1341:;
+	goto L__2e1282;
+	L__2e1343:;
+	L__2e1282:;
+	return;
+	L_abort_2e1307:;
+	t__2e1308 = (u64)((u64)t_abortsite_2e1306 * (u64)((u64)16UL));
+	t__2e1308 = (u64)((u64)((u64)((char *)&D_abortsites_2e1305)) + (u64)t__2e1308);
+	t__2e1309 = (u64)(*(u64 *)t__2e1308);
+	t__2e1310 = (u64)((u64)t__2e1308 + (u64)((u64)8UL));
+	t__2e1311 = (u64)(*(u32 *)t__2e1310);
+	t__2e1310 = (u64)((u64)t__2e1308 + (u64)((u64)12UL));
+	t__2e1312 = (u64)(*(u32 *)t__2e1310);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1309, (u64)t__2e1311, (u64)t__2e1312, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,4482 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+extern char X_rt_2ememmove[] __asm__("rt.memmove");
+extern char X_rt_2estrcmp[] __asm__("rt.strcmp");
+extern char X_rt_2etoutf8[] __asm__("rt.toutf8");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strliteral_2e321 { u64 f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e323 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e324 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e326 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e327 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e329 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e330 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e332 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e333 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e335 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e336 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e338 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e339 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e341 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e342 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e344 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e345 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e347 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e348 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e350 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e351 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e353 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e354 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e356 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e357 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e359 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e360 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e362 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e363 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e365 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e366 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e368 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e369 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e371 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e372 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e374 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e375 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e377 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e378 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e380 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e381 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e383 { u8 f0[1]; u8 f1; u8 f2; };
+struct __attribute__((packed)) S_strliteral_2e384 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e386 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e387 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e389 { u8 f0; };
+struct __attribute__((packed)) S_strliteral_2e390 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e58 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; };
+struct __attribute__((packed)) S_abortsites_2e559 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e633 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e669 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e731 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e796 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e868 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e964 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e1057 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e1089 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_strdata_2e1126 { u8 f0; u8 f1; u8 f2; u8 f3[29]; u8 f4; u8 f5; u8 f6; u8 f7[15]; u8 f8; u8 f9; u8 f10; u8 f11[15]; u8 f12; u8 f13; u8 f14; u8 f15[21]; u8 f16; u8 f17; u8 f18; u8 f19[13]; u8 f20; u8 f21; u8 f22; u8 f23[2]; u8 f24; u8 f25; };
+struct __attribute__((packed)) S_strliteral_2e1127 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1161 { u8 f0; u8 f1; u8 f2; u8 f3[29]; u8 f4; u8 f5; u8 f6; u8 f7[15]; u8 f8; u8 f9; u8 f10; u8 f11[13]; u8 f12; u8 f13; u8 f14; u8 f15[13]; u8 f16; u8 f17; u8 f18; u8 f19[2]; u8 f20; u8 f21; };
+struct __attribute__((packed)) S_strliteral_2e1162 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1181 { u8 f0; u8 f1; u8 f2; u8 f3[10]; u8 f4; u8 f5; u8 f6; u8 f7[30]; u8 f8; u8 f9; u8 f10; u8 f11[16]; u8 f12; u8 f13; u8 f14; u8 f15[16]; u8 f16; u8 f17; u8 f18; u8 f19[13]; u8 f20; u8 f21; u8 f22; u8 f23[2]; u8 f24; u8 f25; };
+struct __attribute__((packed)) S_strliteral_2e1182 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1201 { u8 f0; u8 f1; u8 f2; u8 f3[26]; u8 f4; u8 f5; u8 f6; u8 f7[30]; u8 f8; u8 f9; u8 f10; u8 f11[31]; u8 f12; u8 f13; u8 f14; u8 f15[18]; u8 f16; u8 f17; u8 f18; u8 f19[13]; u8 f20; u8 f21; u8 f22; u8 f23[2]; u8 f24; u8 f25; };
+struct __attribute__((packed)) S_strliteral_2e1202 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1221 { u8 f0; u8 f1; u8 f2; u8 f3[30]; u8 f4; u8 f5; u8 f6; u8 f7[32]; u8 f8; u8 f9; u8 f10; u8 f11[18]; u8 f12; u8 f13; u8 f14; u8 f15[18]; u8 f16; u8 f17; u8 f18; u8 f19[18]; u8 f20; u8 f21; u8 f22; u8 f23[2]; u8 f24; u8 f25; };
+struct __attribute__((packed)) S_strliteral_2e1222 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1142 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; };
+struct __attribute__((packed)) S_strdata_2e1371 { u8 f0[31]; };
+struct __attribute__((packed)) S_strliteral_2e1372 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1451 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e1452 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1535 { u8 f0[8]; };
+struct __attribute__((packed)) S_strliteral_2e1536 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1558 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1559 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1599 { u8 f0; u8 f1; u8 f2; u8 f3[29]; u8 f4; u8 f5; u8 f6; u8 f7[15]; u8 f8; u8 f9; u8 f10; u8 f11[2]; u8 f12; u8 f13; };
+struct __attribute__((packed)) S_strliteral_2e1600 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1619 { u8 f0; u8 f1; u8 f2; u8 f3[26]; u8 f4; u8 f5; u8 f6; u8 f7[32]; u8 f8; u8 f9; u8 f10; u8 f11[18]; u8 f12; u8 f13; u8 f14; u8 f15[18]; u8 f16; u8 f17; u8 f18; u8 f19[2]; u8 f20; u8 f21; };
+struct __attribute__((packed)) S_strliteral_2e1620 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1261 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; };
+struct __attribute__((packed)) S_abortsites_2e1648 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e1679 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_strdata_2e1814 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e1815 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1830 { u8 f0[9]; };
+struct __attribute__((packed)) S_strliteral_2e1831 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1945 { u8 f0; u8 f1; u8 f2; u8 f3[31]; u8 f4; u8 f5; u8 f6; u8 f7[17]; u8 f8; u8 f9; u8 f10; u8 f11[17]; u8 f12; u8 f13; u8 f14; u8 f15[13]; u8 f16; u8 f17; u8 f18; u8 f19[2]; u8 f20; u8 f21; };
+struct __attribute__((packed)) S_strliteral_2e1946 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1971 { u8 f0; u8 f1; u8 f2; u8 f3[35]; u8 f4; u8 f5; u8 f6; u8 f7[15]; u8 f8; u8 f9; u8 f10; u8 f11[13]; u8 f12; u8 f13; u8 f14; u8 f15[2]; u8 f16; u8 f17; };
+struct __attribute__((packed)) S_strliteral_2e1972 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1991 { u8 f0; u8 f1; u8 f2; u8 f3[30]; u8 f4; u8 f5; u8 f6; u8 f7[16]; u8 f8; u8 f9; u8 f10; u8 f11[13]; u8 f12; u8 f13; u8 f14; u8 f15[2]; u8 f16; u8 f17; };
+struct __attribute__((packed)) S_strliteral_2e1992 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e2011 { u8 f0; u8 f1; u8 f2; u8 f3[32]; u8 f4; u8 f5; u8 f6; u8 f7[18]; u8 f8; u8 f9; u8 f10; u8 f11[13]; u8 f12; u8 f13; u8 f14; u8 f15[2]; u8 f16; u8 f17; };
+struct __attribute__((packed)) S_strliteral_2e2012 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1786 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; };
+struct __attribute__((packed)) S_x { u32 f0; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strliteral_2e321 D_strliteral_2e321 __asm__("strliteral.321") __attribute__((used, section(".rodata.strliteral.321"), aligned(8)));
+static const struct S_strdata_2e323 D_strdata_2e323 __asm__("strdata.323") __attribute__((used, section(".rodata.strdata.323"), aligned(8)));
+static struct S_strliteral_2e324 D_strliteral_2e324 __asm__("strliteral.324") __attribute__((used, section(".data.rel.ro.strliteral.324"), aligned(8)));
+static const struct S_strdata_2e326 D_strdata_2e326 __asm__("strdata.326") __attribute__((used, section(".rodata.strdata.326"), aligned(8)));
+static struct S_strliteral_2e327 D_strliteral_2e327 __asm__("strliteral.327") __attribute__((used, section(".data.rel.ro.strliteral.327"), aligned(8)));
+static const struct S_strdata_2e329 D_strdata_2e329 __asm__("strdata.329") __attribute__((used, section(".rodata.strdata.329"), aligned(8)));
+static struct S_strliteral_2e330 D_strliteral_2e330 __asm__("strliteral.330") __attribute__((used, section(".data.rel.ro.strliteral.330"), aligned(8)));
+static const struct S_strdata_2e332 D_strdata_2e332 __asm__("strdata.332") __attribute__((used, section(".rodata.strdata.332"), aligned(8)));
+static struct S_strliteral_2e333 D_strliteral_2e333 __asm__("strliteral.333") __attribute__((used, section(".data.rel.ro.strliteral.333"), aligned(8)));
+static const struct S_strdata_2e335 D_strdata_2e335 __asm__("strdata.335") __attribute__((used, section(".rodata.strdata.335"), aligned(8)));
+static struct S_strliteral_2e336 D_strliteral_2e336 __asm__("strliteral.336") __attribute__((used, section(".data.rel.ro.strliteral.336"), aligned(8)));
+static const struct S_strdata_2e338 D_strdata_2e338 __asm__("strdata.338") __attribute__((used, section(".rodata.strdata.338"), aligned(8)));
+static struct S_strliteral_2e339 D_strliteral_2e339 __asm__("strliteral.339") __attribute__((used, section(".data.rel.ro.strliteral.339"), aligned(8)));
+static const struct S_strdata_2e341 D_strdata_2e341 __asm__("strdata.341") __attribute__((used, section(".rodata.strdata.341"), aligned(8)));
+static struct S_strliteral_2e342 D_strliteral_2e342 __asm__("strliteral.342") __attribute__((used, section(".data.rel.ro.strliteral.342"), aligned(8)));
+static const struct S_strdata_2e344 D_strdata_2e344 __asm__("strdata.344") __attribute__((used, section(".rodata.strdata.344"), aligned(8)));
+static struct S_strliteral_2e345 D_strliteral_2e345 __asm__("strliteral.345") __attribute__((used, section(".data.rel.ro.strliteral.345"), aligned(8)));
+static const struct S_strdata_2e347 D_strdata_2e347 __asm__("strdata.347") __attribute__((used, section(".rodata.strdata.347"), aligned(8)));
+static struct S_strliteral_2e348 D_strliteral_2e348 __asm__("strliteral.348") __attribute__((used, section(".data.rel.ro.strliteral.348"), aligned(8)));
+static const struct S_strdata_2e350 D_strdata_2e350 __asm__("strdata.350") __attribute__((used, section(".rodata.strdata.350"), aligned(8)));
+static struct S_strliteral_2e351 D_strliteral_2e351 __asm__("strliteral.351") __attribute__((used, section(".data.rel.ro.strliteral.351"), aligned(8)));
+static const struct S_strdata_2e353 D_strdata_2e353 __asm__("strdata.353") __attribute__((used, section(".rodata.strdata.353"), aligned(8)));
+static struct S_strliteral_2e354 D_strliteral_2e354 __asm__("strliteral.354") __attribute__((used, section(".data.rel.ro.strliteral.354"), aligned(8)));
+static const struct S_strdata_2e356 D_strdata_2e356 __asm__("strdata.356") __attribute__((used, section(".rodata.strdata.356"), aligned(8)));
+static struct S_strliteral_2e357 D_strliteral_2e357 __asm__("strliteral.357") __attribute__((used, section(".data.rel.ro.strliteral.357"), aligned(8)));
+static const struct S_strdata_2e359 D_strdata_2e359 __asm__("strdata.359") __attribute__((used, section(".rodata.strdata.359"), aligned(8)));
+static struct S_strliteral_2e360 D_strliteral_2e360 __asm__("strliteral.360") __attribute__((used, section(".data.rel.ro.strliteral.360"), aligned(8)));
+static const struct S_strdata_2e362 D_strdata_2e362 __asm__("strdata.362") __attribute__((used, section(".rodata.strdata.362"), aligned(8)));
+static struct S_strliteral_2e363 D_strliteral_2e363 __asm__("strliteral.363") __attribute__((used, section(".data.rel.ro.strliteral.363"), aligned(8)));
+static const struct S_strdata_2e365 D_strdata_2e365 __asm__("strdata.365") __attribute__((used, section(".rodata.strdata.365"), aligned(8)));
+static struct S_strliteral_2e366 D_strliteral_2e366 __asm__("strliteral.366") __attribute__((used, section(".data.rel.ro.strliteral.366"), aligned(8)));
+static const struct S_strdata_2e368 D_strdata_2e368 __asm__("strdata.368") __attribute__((used, section(".rodata.strdata.368"), aligned(8)));
+static struct S_strliteral_2e369 D_strliteral_2e369 __asm__("strliteral.369") __attribute__((used, section(".data.rel.ro.strliteral.369"), aligned(8)));
+static const struct S_strdata_2e371 D_strdata_2e371 __asm__("strdata.371") __attribute__((used, section(".rodata.strdata.371"), aligned(8)));
+static struct S_strliteral_2e372 D_strliteral_2e372 __asm__("strliteral.372") __attribute__((used, section(".data.rel.ro.strliteral.372"), aligned(8)));
+static const struct S_strdata_2e374 D_strdata_2e374 __asm__("strdata.374") __attribute__((used, section(".rodata.strdata.374"), aligned(8)));
+static struct S_strliteral_2e375 D_strliteral_2e375 __asm__("strliteral.375") __attribute__((used, section(".data.rel.ro.strliteral.375"), aligned(8)));
+static const struct S_strdata_2e377 D_strdata_2e377 __asm__("strdata.377") __attribute__((used, section(".rodata.strdata.377"), aligned(8)));
+static struct S_strliteral_2e378 D_strliteral_2e378 __asm__("strliteral.378") __attribute__((used, section(".data.rel.ro.strliteral.378"), aligned(8)));
+static const struct S_strdata_2e380 D_strdata_2e380 __asm__("strdata.380") __attribute__((used, section(".rodata.strdata.380"), aligned(8)));
+static struct S_strliteral_2e381 D_strliteral_2e381 __asm__("strliteral.381") __attribute__((used, section(".data.rel.ro.strliteral.381"), aligned(8)));
+static const struct S_strdata_2e383 D_strdata_2e383 __asm__("strdata.383") __attribute__((used, section(".rodata.strdata.383"), aligned(8)));
+static struct S_strliteral_2e384 D_strliteral_2e384 __asm__("strliteral.384") __attribute__((used, section(".data.rel.ro.strliteral.384"), aligned(8)));
+static const struct S_strdata_2e386 D_strdata_2e386 __asm__("strdata.386") __attribute__((used, section(".rodata.strdata.386"), aligned(8)));
+static struct S_strliteral_2e387 D_strliteral_2e387 __asm__("strliteral.387") __attribute__((used, section(".data.rel.ro.strliteral.387"), aligned(8)));
+static const struct S_strdata_2e389 D_strdata_2e389 __asm__("strdata.389") __attribute__((used, section(".rodata.strdata.389"), aligned(8)));
+static struct S_strliteral_2e390 D_strliteral_2e390 __asm__("strliteral.390") __attribute__((used, section(".data.rel.ro.strliteral.390"), aligned(8)));
+static struct S_abortsites_2e58 D_abortsites_2e58 __asm__("abortsites.58") __attribute__((used, section(".data.rel.ro.abortsites.58"), aligned(8)));
+static struct S_abortsites_2e559 D_abortsites_2e559 __asm__("abortsites.559") __attribute__((used, section(".data.rel.ro.abortsites.559"), aligned(8)));
+static struct S_abortsites_2e633 D_abortsites_2e633 __asm__("abortsites.633") __attribute__((used, section(".data.rel.ro.abortsites.633"), aligned(8)));
+static struct S_abortsites_2e669 D_abortsites_2e669 __asm__("abortsites.669") __attribute__((used, section(".data.rel.ro.abortsites.669"), aligned(8)));
+static struct S_abortsites_2e731 D_abortsites_2e731 __asm__("abortsites.731") __attribute__((used, section(".data.rel.ro.abortsites.731"), aligned(8)));
+static struct S_abortsites_2e796 D_abortsites_2e796 __asm__("abortsites.796") __attribute__((used, section(".data.rel.ro.abortsites.796"), aligned(8)));
+static struct S_abortsites_2e868 D_abortsites_2e868 __asm__("abortsites.868") __attribute__((used, section(".data.rel.ro.abortsites.868"), aligned(8)));
+static struct S_abortsites_2e964 D_abortsites_2e964 __asm__("abortsites.964") __attribute__((used, section(".data.rel.ro.abortsites.964"), aligned(8)));
+static struct S_abortsites_2e1057 D_abortsites_2e1057 __asm__("abortsites.1057") __attribute__((used, section(".data.rel.ro.abortsites.1057"), aligned(8)));
+static struct S_abortsites_2e1089 D_abortsites_2e1089 __asm__("abortsites.1089") __attribute__((used, section(".data.rel.ro.abortsites.1089"), aligned(8)));
+static const struct S_strdata_2e1126 D_strdata_2e1126 __asm__("strdata.1126") __attribute__((used, section(".rodata.strdata.1126"), aligned(8)));
+static struct S_strliteral_2e1127 D_strliteral_2e1127 __asm__("strliteral.1127") __attribute__((used, section(".data.rel.ro.strliteral.1127"), aligned(8)));
+static const struct S_strdata_2e1161 D_strdata_2e1161 __asm__("strdata.1161") __attribute__((used, section(".rodata.strdata.1161"), aligned(8)));
+static struct S_strliteral_2e1162 D_strliteral_2e1162 __asm__("strliteral.1162") __attribute__((used, section(".data.rel.ro.strliteral.1162"), aligned(8)));
+static const struct S_strdata_2e1181 D_strdata_2e1181 __asm__("strdata.1181") __attribute__((used, section(".rodata.strdata.1181"), aligned(8)));
+static struct S_strliteral_2e1182 D_strliteral_2e1182 __asm__("strliteral.1182") __attribute__((used, section(".data.rel.ro.strliteral.1182"), aligned(8)));
+static const struct S_strdata_2e1201 D_strdata_2e1201 __asm__("strdata.1201") __attribute__((used, section(".rodata.strdata.1201"), aligned(8)));
+static struct S_strliteral_2e1202 D_strliteral_2e1202 __asm__("strliteral.1202") __attribute__((used, section(".data.rel.ro.strliteral.1202"), aligned(8)));
+static const struct S_strdata_2e1221 D_strdata_2e1221 __asm__("strdata.1221") __attribute__((used, section(".rodata.strdata.1221"), aligned(8)));
+static struct S_strliteral_2e1222 D_strliteral_2e1222 __asm__("strliteral.1222") __attribute__((used, section(".data.rel.ro.strliteral.1222"), aligned(8)));
+static struct S_abortsites_2e1142 D_abortsites_2e1142 __asm__("abortsites.1142") __attribute__((used, section(".data.rel.ro.abortsites.1142"), aligned(8)));
+static const struct S_strdata_2e1371 D_strdata_2e1371 __asm__("strdata.1371") __attribute__((used, section(".rodata.strdata.1371"), aligned(8)));
+static struct S_strliteral_2e1372 D_strliteral_2e1372 __asm__("strliteral.1372") __attribute__((used, section(".data.rel.ro.strliteral.1372"), aligned(8)));
+static const struct S_strdata_2e1451 D_strdata_2e1451 __asm__("strdata.1451") __attribute__((used, section(".rodata.strdata.1451"), aligned(8)));
+static struct S_strliteral_2e1452 D_strliteral_2e1452 __asm__("strliteral.1452") __attribute__((used, section(".data.rel.ro.strliteral.1452"), aligned(8)));
+static const struct S_strdata_2e1535 D_strdata_2e1535 __asm__("strdata.1535") __attribute__((used, section(".rodata.strdata.1535"), aligned(8)));
+static struct S_strliteral_2e1536 D_strliteral_2e1536 __asm__("strliteral.1536") __attribute__((used, section(".data.rel.ro.strliteral.1536"), aligned(8)));
+static const struct S_strdata_2e1558 D_strdata_2e1558 __asm__("strdata.1558") __attribute__((used, section(".rodata.strdata.1558"), aligned(8)));
+static struct S_strliteral_2e1559 D_strliteral_2e1559 __asm__("strliteral.1559") __attribute__((used, section(".data.rel.ro.strliteral.1559"), aligned(8)));
+static const struct S_strdata_2e1599 D_strdata_2e1599 __asm__("strdata.1599") __attribute__((used, section(".rodata.strdata.1599"), aligned(8)));
+static struct S_strliteral_2e1600 D_strliteral_2e1600 __asm__("strliteral.1600") __attribute__((used, section(".data.rel.ro.strliteral.1600"), aligned(8)));
+static const struct S_strdata_2e1619 D_strdata_2e1619 __asm__("strdata.1619") __attribute__((used, section(".rodata.strdata.1619"), aligned(8)));
+static struct S_strliteral_2e1620 D_strliteral_2e1620 __asm__("strliteral.1620") __attribute__((used, section(".data.rel.ro.strliteral.1620"), aligned(8)));
+static struct S_abortsites_2e1261 D_abortsites_2e1261 __asm__("abortsites.1261") __attribute__((used, section(".data.rel.ro.abortsites.1261"), aligned(8)));
+static struct S_abortsites_2e1648 D_abortsites_2e1648 __asm__("abortsites.1648") __attribute__((used, section(".data.rel.ro.abortsites.1648"), aligned(8)));
+static struct S_abortsites_2e1679 D_abortsites_2e1679 __asm__("abortsites.1679") __attribute__((used, section(".data.rel.ro.abortsites.1679"), aligned(8)));
+static const struct S_strdata_2e1814 D_strdata_2e1814 __asm__("strdata.1814") __attribute__((used, section(".rodata.strdata.1814"), aligned(8)));
+static struct S_strliteral_2e1815 D_strliteral_2e1815 __asm__("strliteral.1815") __attribute__((used, section(".data.rel.ro.strliteral.1815"), aligned(8)));
+static const struct S_strdata_2e1830 D_strdata_2e1830 __asm__("strdata.1830") __attribute__((used, section(".rodata.strdata.1830"), aligned(8)));
+static struct S_strliteral_2e1831 D_strliteral_2e1831 __asm__("strliteral.1831") __attribute__((used, section(".data.rel.ro.strliteral.1831"), aligned(8)));
+static const struct S_strdata_2e1945 D_strdata_2e1945 __asm__("strdata.1945") __attribute__((used, section(".rodata.strdata.1945"), aligned(8)));
+static struct S_strliteral_2e1946 D_strliteral_2e1946 __asm__("strliteral.1946") __attribute__((used, section(".data.rel.ro.strliteral.1946"), aligned(8)));
+static const struct S_strdata_2e1971 D_strdata_2e1971 __asm__("strdata.1971") __attribute__((used, section(".rodata.strdata.1971"), aligned(8)));
+static struct S_strliteral_2e1972 D_strliteral_2e1972 __asm__("strliteral.1972") __attribute__((used, section(".data.rel.ro.strliteral.1972"), aligned(8)));
+static const struct S_strdata_2e1991 D_strdata_2e1991 __asm__("strdata.1991") __attribute__((used, section(".rodata.strdata.1991"), aligned(8)));
+static struct S_strliteral_2e1992 D_strliteral_2e1992 __asm__("strliteral.1992") __attribute__((used, section(".data.rel.ro.strliteral.1992"), aligned(8)));
+static const struct S_strdata_2e2011 D_strdata_2e2011 __asm__("strdata.2011") __attribute__((used, section(".rodata.strdata.2011"), aligned(8)));
+static struct S_strliteral_2e2012 D_strliteral_2e2012 __asm__("strliteral.2012") __attribute__((used, section(".data.rel.ro.strliteral.2012"), aligned(8)));
+static struct S_abortsites_2e1786 D_abortsites_2e1786 __asm__("abortsites.1786") __attribute__((used, section(".data.rel.ro.abortsites.1786"), aligned(8)));
+static struct S_x D_x __asm__("x") __attribute__((used, section(".data.x"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_lowering(void) __asm__("lowering") __attribute__((used, section(".text.lowering")));
+static u32 F_command(u64 p_s) __asm__("command") __attribute__((used, section(".text.command")));
+static u32 F_kind(u32 p_r) __asm__("kind") __attribute__((used, section(".text.kind")));
+static u32 F_warm(u32 p_c) __asm__("warm") __attribute__((used, section(".text.warm")));
+static u32 F_wide__signed(u64 p_x) __asm__("wide_signed") __attribute__((used, section(".text.wide_signed")));
+static u32 F_wide(u64 p_x) __asm__("wide") __attribute__((used, section(".text.wide")));
+static u32 F_unsigned(u32 p_x) __asm__("unsigned") __attribute__((used, section(".text.unsigned")));
+static u32 F_dense(u32 p_x) __asm__("dense") __attribute__((used, section(".text.dense")));
+static u32 F_sparse(u32 p_x) __asm__("sparse") __attribute__((used, section(".text.sparse")));
+static void F_label(void) __asm__("label") __attribute__((used, section(".text.label")));
+static void F_duplicates(void) __asm__("duplicates") __attribute__((used, section(".text.duplicates")));
+static void F_exhaustivity(void) __asm__("exhaustivity") __attribute__((used, section(".text.exhaustivity")));
+static void F_binding(void) __asm__("binding") __attribute__((used, section(".text.binding")));
+static void F_tagged__result(void) __asm__("tagged_result") __attribute__((used, section(".text.tagged_result")));
+static void F_basics(void) __asm__("basics") __attribute__((used, section(".text.basics")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\061\064\055\163\167\151\164\143\150\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 18U, 18U };
+static const struct S_strliteral_2e321 D_strliteral_2e321 = { 0U, 0U, 0U };
+static const struct S_strdata_2e323 D_strdata_2e323 = { "\107\105\124" };
+static struct S_strliteral_2e324 D_strliteral_2e324 = { (char *)((char *)&D_strdata_2e323) + 0, 3U, 3U };
+static const struct S_strdata_2e326 D_strdata_2e326 = { "\107\117\124" };
+static struct S_strliteral_2e327 D_strliteral_2e327 = { (char *)((char *)&D_strdata_2e326) + 0, 3U, 3U };
+static const struct S_strdata_2e329 D_strdata_2e329 = { "\107\105" };
+static struct S_strliteral_2e330 D_strliteral_2e330 = { (char *)((char *)&D_strdata_2e329) + 0, 2U, 2U };
+static const struct S_strdata_2e332 D_strdata_2e332 = { "\107\105\124\123" };
+static struct S_strliteral_2e333 D_strliteral_2e333 = { (char *)((char *)&D_strdata_2e332) + 0, 4U, 4U };
+static const struct S_strdata_2e335 D_strdata_2e335 = { "\120\125\124" };
+static struct S_strliteral_2e336 D_strliteral_2e336 = { (char *)((char *)&D_strdata_2e335) + 0, 3U, 3U };
+static const struct S_strdata_2e338 D_strdata_2e338 = { "\120\117\123\124" };
+static struct S_strliteral_2e339 D_strliteral_2e339 = { (char *)((char *)&D_strdata_2e338) + 0, 4U, 4U };
+static const struct S_strdata_2e341 D_strdata_2e341 = { "\120\101\123\124" };
+static struct S_strliteral_2e342 D_strliteral_2e342 = { (char *)((char *)&D_strdata_2e341) + 0, 4U, 4U };
+static const struct S_strdata_2e344 D_strdata_2e344 = { "\110\105\101\104" };
+static struct S_strliteral_2e345 D_strliteral_2e345 = { (char *)((char *)&D_strdata_2e344) + 0, 4U, 4U };
+static const struct S_strdata_2e347 D_strdata_2e347 = { "\104\105\114\105\124\105" };
+static struct S_strliteral_2e348 D_strliteral_2e348 = { (char *)((char *)&D_strdata_2e347) + 0, 6U, 6U };
+static const struct S_strdata_2e350 D_strdata_2e350 = { "\104\105\114\105\124\106" };
+static struct S_strliteral_2e351 D_strliteral_2e351 = { (char *)((char *)&D_strdata_2e350) + 0, 6U, 6U };
+static const struct S_strdata_2e353 D_strdata_2e353 = { "\117\120\124\111\117\116\123" };
+static struct S_strliteral_2e354 D_strliteral_2e354 = { (char *)((char *)&D_strdata_2e353) + 0, 7U, 7U };
+static const struct S_strdata_2e356 D_strdata_2e356 = { "\120\101\124\103\110" };
+static struct S_strliteral_2e357 D_strliteral_2e357 = { (char *)((char *)&D_strdata_2e356) + 0, 5U, 5U };
+static const struct S_strdata_2e359 D_strdata_2e359 = { "\124\122\101\103\105" };
+static struct S_strliteral_2e360 D_strliteral_2e360 = { (char *)((char *)&D_strdata_2e359) + 0, 5U, 5U };
+static const struct S_strdata_2e362 D_strdata_2e362 = { "\124\122\101\103\113" };
+static struct S_strliteral_2e363 D_strliteral_2e363 = { (char *)((char *)&D_strdata_2e362) + 0, 5U, 5U };
+static const struct S_strdata_2e365 D_strdata_2e365 = { "\114\111\123\124" };
+static struct S_strliteral_2e366 D_strliteral_2e366 = { (char *)((char *)&D_strdata_2e365) + 0, 4U, 4U };
+static const struct S_strdata_2e368 D_strdata_2e368 = { "\114\123\125\102" };
+static struct S_strliteral_2e369 D_strliteral_2e369 = { (char *)((char *)&D_strdata_2e368) + 0, 4U, 4U };
+static const struct S_strdata_2e371 D_strdata_2e371 = { "\114\101\123\124" };
+static struct S_strliteral_2e372 D_strliteral_2e372 = { (char *)((char *)&D_strdata_2e371) + 0, 4U, 4U };
+static const struct S_strdata_2e374 D_strdata_2e374 = { "\114\117\107\111\116" };
+static struct S_strliteral_2e375 D_strliteral_2e375 = { (char *)((char *)&D_strdata_2e374) + 0, 5U, 5U };
+static const struct S_strdata_2e377 D_strdata_2e377 = { "\114\117\107\117\125\124" };
+static struct S_strliteral_2e378 D_strliteral_2e378 = { (char *)((char *)&D_strdata_2e377) + 0, 6U, 6U };
+static const struct S_strdata_2e380 D_strdata_2e380 = { "\114\117\107\117\116" };
+static struct S_strliteral_2e381 D_strliteral_2e381 = { (char *)((char *)&D_strdata_2e380) + 0, 5U, 5U };
+static const struct S_strdata_2e383 D_strdata_2e383 = { "\150", 18446744073709551555U, 18446744073709551529U };
+static struct S_strliteral_2e384 D_strliteral_2e384 = { (char *)((char *)&D_strdata_2e383) + 0, 3U, 3U };
+static const struct S_strdata_2e386 D_strdata_2e386 = { "\150\145" };
+static struct S_strliteral_2e387 D_strliteral_2e387 = { (char *)((char *)&D_strdata_2e386) + 0, 2U, 2U };
+static const struct S_strdata_2e389 D_strdata_2e389 = { 0U };
+static struct S_strliteral_2e390 D_strliteral_2e390 = { (char *)((char *)&D_strdata_2e389) + 0, 1U, 1U };
+static struct S_abortsites_2e58 D_abortsites_2e58 = { (char *)((char *)&D_strliteral_2e1) + 0, 427U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 434U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 436U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 437U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 438U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 439U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 440U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 441U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 449U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 459U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 468U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 471U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 472U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 480U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 492U, 23U };
+static struct S_abortsites_2e559 D_abortsites_2e559 = { (char *)((char *)&D_strliteral_2e1) + 0, 393U, 15U };
+static struct S_abortsites_2e633 D_abortsites_2e633 = { (char *)((char *)&D_strliteral_2e1) + 0, 374U, 15U };
+static struct S_abortsites_2e669 D_abortsites_2e669 = { (char *)((char *)&D_strliteral_2e1) + 0, 365U, 15U };
+static struct S_abortsites_2e731 D_abortsites_2e731 = { (char *)((char *)&D_strliteral_2e1) + 0, 338U, 15U };
+static struct S_abortsites_2e796 D_abortsites_2e796 = { (char *)((char *)&D_strliteral_2e1) + 0, 321U, 15U };
+static struct S_abortsites_2e868 D_abortsites_2e868 = { (char *)((char *)&D_strliteral_2e1) + 0, 302U, 15U };
+static struct S_abortsites_2e964 D_abortsites_2e964 = { (char *)((char *)&D_strliteral_2e1) + 0, 281U, 15U };
+static struct S_abortsites_2e1057 D_abortsites_2e1057 = { (char *)((char *)&D_strliteral_2e1) + 0, 256U, 15U };
+static struct S_abortsites_2e1089 D_abortsites_2e1089 = { (char *)((char *)&D_strliteral_2e1) + 0, 247U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 249U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 244U, 15U };
+static const struct S_strdata_2e1126 D_strdata_2e1126 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\060\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\060\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\061\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\062\054\040\060\054\040\063\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1127 D_strliteral_2e1127 = { (char *)((char *)&D_strdata_2e1126) + 0, 115U, 115U };
+static const struct S_strdata_2e1161 D_strdata_2e1161 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\060\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\060\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1162 D_strliteral_2e1162 = { (char *)((char *)&D_strdata_2e1161) + 0, 89U, 89U };
+static const struct S_strdata_2e1181 D_strdata_2e1181 = { 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\060\073", 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\046\170\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\046\170\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\046\170\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1182 D_strliteral_2e1182 = { (char *)((char *)&D_strdata_2e1181) + 0, 107U, 107U };
+static const struct S_strdata_2e1201 D_strdata_2e1201 = { 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\050\133\061\054\040\062\054\040\063\054\040\064\135\054\040\065\051\073", 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\046\060\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\046\050\170\056\060\072\040\133\052\135\151\156\164\051\133\064\135\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\046\170\056\061\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1202 D_strliteral_2e1202 = { (char *)((char *)&D_strdata_2e1201) + 0, 140U, 140U };
+static const struct S_strdata_2e1221 D_strdata_2e1221 = { 10U, 9U, 9U, "\164\171\160\145\040\170\040\075\040\145\156\165\155\040\173\040\101\054\040\102\054\040\103\040\075\040\102\040\175\073", 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\170\072\072\101\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\170\072\072\101\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\170\072\072\102\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\170\072\072\103\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1222 D_strliteral_2e1222 = { (char *)((char *)&D_strdata_2e1221) + 0, 138U, 138U };
+static struct S_abortsites_2e1142 D_abortsites_2e1142 = { (char *)((char *)&D_strliteral_2e1) + 0, 194U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 194U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 202U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 202U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 211U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 211U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 220U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 220U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 240U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 240U, 12U };
+static const struct S_strdata_2e1371 D_strdata_2e1371 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\060\165\070\051\040\173" };
+static struct S_strliteral_2e1372 D_strliteral_2e1372 = { (char *)((char *)&D_strdata_2e1371) + 0, 31U, 31U };
+static const struct S_strdata_2e1451 D_strdata_2e1451 = { "\143\141\163\145\040" };
+static struct S_strliteral_2e1452 D_strliteral_2e1452 = { (char *)((char *)&D_strdata_2e1451) + 0, 5U, 5U };
+static const struct S_strdata_2e1535 D_strdata_2e1535 = { "\075\076\040\166\157\151\144\073" };
+static struct S_strliteral_2e1536 D_strliteral_2e1536 = { (char *)((char *)&D_strdata_2e1535) + 0, 8U, 8U };
+static const struct S_strdata_2e1558 D_strdata_2e1558 = { "\175\073" };
+static struct S_strliteral_2e1559 D_strliteral_2e1559 = { (char *)((char *)&D_strdata_2e1558) + 0, 2U, 2U };
+static const struct S_strdata_2e1599 D_strdata_2e1599 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\060\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\060\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1600 D_strliteral_2e1600 = { (char *)((char *)&D_strdata_2e1599) + 0, 57U, 57U };
+static const struct S_strdata_2e1619 D_strdata_2e1619 = { 10U, 9U, 9U, "\164\171\160\145\040\170\040\075\040\145\156\165\155\040\173\040\101\054\040\102\054\040\103\040\175\073", 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\170\072\072\101\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\170\072\072\101\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\170\072\072\102\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1620 D_strliteral_2e1620 = { (char *)((char *)&D_strdata_2e1619) + 0, 113U, 113U };
+static struct S_abortsites_2e1261 D_abortsites_2e1261 = { (char *)((char *)&D_strliteral_2e1) + 0, 126U, 28U, (char *)((char *)&D_strliteral_2e1) + 0, 124U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 131U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 129U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 133U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 139U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 138U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 142U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 149U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 156U, 40U, (char *)((char *)&D_strliteral_2e1) + 0, 158U, 48U, (char *)((char *)&D_strliteral_2e1) + 0, 161U, 48U, (char *)((char *)&D_strliteral_2e1) + 0, 163U, 40U, (char *)((char *)&D_strliteral_2e1) + 0, 164U, 40U, (char *)((char *)&D_strliteral_2e1) + 0, 168U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 169U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 169U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 175U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 175U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 12U };
+static struct S_abortsites_2e1648 D_abortsites_2e1648 = { (char *)((char *)&D_strliteral_2e1) + 0, 114U, 15U };
+static struct S_abortsites_2e1679 D_abortsites_2e1679 = { (char *)((char *)&D_strliteral_2e1) + 0, 95U, 37U, (char *)((char *)&D_strliteral_2e1) + 0, 101U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 19U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 15U };
+static const struct S_strdata_2e1814 D_strdata_2e1814 = { "\150\141\162\145" };
+static struct S_strliteral_2e1815 D_strliteral_2e1815 = { (char *)((char *)&D_strdata_2e1814) + 0, 4U, 4U };
+static const struct S_strdata_2e1830 D_strdata_2e1830 = { "\165\150\150\150\040\152\141\166\141" };
+static struct S_strliteral_2e1831 D_strliteral_2e1831 = { (char *)((char *)&D_strdata_2e1830) + 0, 9U, 9U };
+static const struct S_strdata_2e1945 D_strdata_2e1945 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\060\056\060\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\060\056\060\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\061\056\060\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1946 D_strliteral_2e1946 = { (char *)((char *)&D_strdata_2e1945) + 0, 97U, 97U };
+static const struct S_strdata_2e1971 D_strdata_2e1971 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\170\072\040\151\156\164\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\060\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\170\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1972 D_strliteral_2e1972 = { (char *)((char *)&D_strdata_2e1971) + 0, 79U, 79U };
+static const struct S_strdata_2e1991 D_strdata_2e1991 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\046\060\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\046\060\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1992 D_strliteral_2e1992 = { (char *)((char *)&D_strdata_2e1991) + 0, 75U, 75U };
+static const struct S_strdata_2e2011 D_strdata_2e2011 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\060\151\063\062\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\060\151\066\064\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\143\141\163\145\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e2012 D_strliteral_2e2012 = { (char *)((char *)&D_strdata_2e2011) + 0, 79U, 79U };
+static struct S_abortsites_2e1786 D_abortsites_2e1786 = { (char *)((char *)&D_strliteral_2e1) + 0, 12U, 36U, (char *)((char *)&D_strliteral_2e1) + 0, 22U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 25U, 28U, (char *)((char *)&D_strliteral_2e1) + 0, 33U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 38U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 42U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 40U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 48U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 49U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 50U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 28U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 46U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 69U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 69U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 83U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 83U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 90U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 90U, 12U };
+static struct S_x D_x = { 1337U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_basics)))();
+	((void (*)(void))((u64)((char *)&F_tagged__result)))();
+	((void (*)(void))((u64)((char *)&F_binding)))();
+	((void (*)(void))((u64)((char *)&F_exhaustivity)))();
+	((void (*)(void))((u64)((char *)&F_duplicates)))();
+	((void (*)(void))((u64)((char *)&F_label)))();
+	((void (*)(void))((u64)((char *)&F_lowering)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_lowering(void) {
+	char A0[120] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[72] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[112] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[208] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[144] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[120] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	char A12[768] __attribute__((aligned(16)));
+	char A13[8] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	u64 t__2e101;
+	u64 t__2e102;
+	u64 t__2e103;
+	u64 t__2e106;
+	u64 t__2e107;
+	u64 t__2e108;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e115;
+	u64 t__2e116;
+	u64 t__2e119;
+	u64 t__2e120;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e154;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e16;
+	u64 t__2e160;
+	u64 t__2e162;
+	u64 t__2e170;
+	u64 t__2e172;
+	u64 t__2e173;
+	u64 t__2e175;
+	u64 t__2e177;
+	u64 t__2e178;
+	u64 t__2e18;
+	u64 t__2e180;
+	u64 t__2e181;
+	u64 t__2e194;
+	u64 t__2e195;
+	u64 t__2e20;
+	u64 t__2e200;
+	u64 t__2e201;
+	u64 t__2e202;
+	u64 t__2e203;
+	u64 t__2e205;
+	u64 t__2e206;
+	u64 t__2e207;
+	u64 t__2e209;
+	u64 t__2e211;
+	u64 t__2e217;
+	u64 t__2e218;
+	u64 t__2e22;
+	u64 t__2e220;
+	u64 t__2e222;
+	u64 t__2e224;
+	u64 t__2e236;
+	u64 t__2e237;
+	u64 t__2e24;
+	u64 t__2e242;
+	u64 t__2e243;
+	u64 t__2e244;
+	u64 t__2e245;
+	u64 t__2e247;
+	u64 t__2e248;
+	u64 t__2e249;
+	u64 t__2e251;
+	u64 t__2e253;
+	u64 t__2e256;
+	u64 t__2e259;
+	u64 t__2e260;
+	u64 t__2e263;
+	u64 t__2e266;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e269;
+	u64 t__2e270;
+	u64 t__2e271;
+	u64 t__2e297;
+	u64 t__2e298;
+	u64 t__2e303;
+	u64 t__2e304;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t__2e312;
+	u64 t__2e314;
+	u64 t__2e35;
+	u64 t__2e397;
+	u64 t__2e398;
+	u64 t__2e403;
+	u64 t__2e404;
+	u64 t__2e405;
+	u64 t__2e406;
+	u64 t__2e408;
+	u64 t__2e409;
+	u64 t__2e411;
+	u64 t__2e413;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e48;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e51;
+	u64 t__2e53;
+	u64 t__2e54;
+	u64 t__2e55;
+	u64 t__2e57;
+	u64 t__2e61;
+	u64 t__2e62;
+	u64 t__2e63;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e67;
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e83;
+	u64 t__2e84;
+	u64 t__2e85;
+	u64 t__2e86;
+	u64 t__2e87;
+	u64 t__2e88;
+	u64 t__2e89;
+	u64 t__2e90;
+	u64 t__2e91;
+	u64 t__2e93;
+	u64 t__2e96;
+	u64 t__2e97;
+	u64 t__2e98;
+	u64 t_abortsite_2e59;
+	u64 t_binding_2e11;
+	u64 t_binding_2e121;
+	u64 t_binding_2e144;
+	u64 t_binding_2e163;
+	u64 t_binding_2e193;
+	u64 t_binding_2e212;
+	u64 t_binding_2e235;
+	u64 t_binding_2e272;
+	u64 t_binding_2e296;
+	u64 t_binding_2e315;
+	u64 t_binding_2e396;
+	u64 t_binding_2e41;
+	u64 t_binding_2e68;
+	u64 t_binding_2e76;
+	u64 t_item_2e124;
+	u64 t_item_2e14;
+	u64 t_item_2e166;
+	u64 t_item_2e215;
+	u64 t_item_2e275;
+	u64 t_item_2e319;
+	u64 t_item_2e70;
+	u64 t_value_2e125;
+	u64 t_value_2e126;
+	u64 t_value_2e127;
+	u64 t_value_2e128;
+	u64 t_value_2e129;
+	u64 t_value_2e130;
+	u64 t_value_2e131;
+	u64 t_value_2e132;
+	u64 t_value_2e133;
+	u64 t_value_2e134;
+	u64 t_value_2e135;
+	u64 t_value_2e136;
+	u64 t_value_2e137;
+	u64 t_value_2e138;
+	u64 t_value_2e15;
+	u64 t_value_2e155;
+	u64 t_value_2e159;
+	u64 t_value_2e167;
+	u64 t_value_2e168;
+	u64 t_value_2e169;
+	u64 t_value_2e17;
+	u64 t_value_2e171;
+	u64 t_value_2e174;
+	u64 t_value_2e176;
+	u64 t_value_2e179;
+	u64 t_value_2e182;
+	u64 t_value_2e183;
+	u64 t_value_2e184;
+	u64 t_value_2e185;
+	u64 t_value_2e186;
+	u64 t_value_2e187;
+	u64 t_value_2e19;
+	u64 t_value_2e204;
+	u64 t_value_2e208;
+	u64 t_value_2e21;
+	u64 t_value_2e216;
+	u64 t_value_2e219;
+	u64 t_value_2e221;
+	u64 t_value_2e223;
+	u64 t_value_2e225;
+	u64 t_value_2e226;
+	u64 t_value_2e227;
+	u64 t_value_2e228;
+	u64 t_value_2e229;
+	u64 t_value_2e23;
+	u64 t_value_2e246;
+	u64 t_value_2e25;
+	u64 t_value_2e250;
+	u64 t_value_2e26;
+	u64 t_value_2e27;
+	u64 t_value_2e276;
+	u64 t_value_2e277;
+	u64 t_value_2e278;
+	u64 t_value_2e279;
+	u64 t_value_2e28;
+	u64 t_value_2e280;
+	u64 t_value_2e281;
+	u64 t_value_2e282;
+	u64 t_value_2e283;
+	u64 t_value_2e284;
+	u64 t_value_2e285;
+	u64 t_value_2e286;
+	u64 t_value_2e287;
+	u64 t_value_2e288;
+	u64 t_value_2e289;
+	u64 t_value_2e29;
+	u64 t_value_2e290;
+	u64 t_value_2e30;
+	u64 t_value_2e307;
+	u64 t_value_2e31;
+	u64 t_value_2e311;
+	u64 t_value_2e32;
+	u64 t_value_2e320;
+	u64 t_value_2e322;
+	u64 t_value_2e325;
+	u64 t_value_2e328;
+	u64 t_value_2e33;
+	u64 t_value_2e331;
+	u64 t_value_2e334;
+	u64 t_value_2e337;
+	u64 t_value_2e34;
+	u64 t_value_2e340;
+	u64 t_value_2e343;
+	u64 t_value_2e346;
+	u64 t_value_2e349;
+	u64 t_value_2e352;
+	u64 t_value_2e355;
+	u64 t_value_2e358;
+	u64 t_value_2e361;
+	u64 t_value_2e364;
+	u64 t_value_2e367;
+	u64 t_value_2e370;
+	u64 t_value_2e373;
+	u64 t_value_2e376;
+	u64 t_value_2e379;
+	u64 t_value_2e382;
+	u64 t_value_2e385;
+	u64 t_value_2e388;
+	u64 t_value_2e407;
+	u64 t_value_2e410;
+	u64 t_value_2e52;
+	u64 t_value_2e56;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	t_binding_2e41 = (u64)A1;
+	t_binding_2e68 = (u64)A2;
+	t_binding_2e76 = (u64)A3;
+	t_binding_2e121 = (u64)A4;
+	t_binding_2e144 = (u64)A5;
+	t_binding_2e163 = (u64)A6;
+	t_binding_2e193 = (u64)A7;
+	t_binding_2e212 = (u64)A8;
+	t_binding_2e235 = (u64)A9;
+	t_binding_2e272 = (u64)A10;
+	t_binding_2e296 = (u64)A11;
+	t_binding_2e315 = (u64)A12;
+	t_binding_2e396 = (u64)A13;
+	L_body_2e8:;
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)0UL));
+	t_value_2e15 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	t__2e16 = (u64)(u32)(-(u32)((u64)1001UL));
+	*(u32 *)t_value_2e15 = (u32)t__2e16;
+	t_value_2e15 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e15 = (u32)((u64)0UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t_value_2e17 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	t__2e18 = (u64)(u32)(-(u32)((u64)1000UL));
+	*(u32 *)t_value_2e17 = (u32)t__2e18;
+	t_value_2e17 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e17 = (u32)((u64)1UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t_value_2e19 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	t__2e20 = (u64)(u32)(-(u32)((u64)999UL));
+	*(u32 *)t_value_2e19 = (u32)t__2e20;
+	t_value_2e19 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e19 = (u32)((u64)0UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)24UL));
+	t_value_2e21 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	t__2e22 = (u64)(u32)(-(u32)((u64)7UL));
+	*(u32 *)t_value_2e21 = (u32)t__2e22;
+	t_value_2e21 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e21 = (u32)((u64)2UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)32UL));
+	t_value_2e23 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	t__2e24 = (u64)(u32)(-(u32)((u64)6UL));
+	*(u32 *)t_value_2e23 = (u32)t__2e24;
+	t_value_2e23 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e23 = (u32)((u64)0UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)40UL));
+	t_value_2e25 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e25 = (u32)((u64)0UL);
+	t_value_2e25 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e25 = (u32)((u64)3UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)48UL));
+	t_value_2e26 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e26 = (u32)((u64)3UL);
+	t_value_2e26 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e26 = (u32)((u64)4UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)56UL));
+	t_value_2e27 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e27 = (u32)((u64)17UL);
+	t_value_2e27 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e27 = (u32)((u64)5UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)64UL));
+	t_value_2e28 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e28 = (u32)((u64)18UL);
+	t_value_2e28 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e28 = (u32)((u64)0UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)72UL));
+	t_value_2e29 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e29 = (u32)((u64)100UL);
+	t_value_2e29 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e29 = (u32)((u64)6UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)80UL));
+	t_value_2e30 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e30 = (u32)((u64)1000UL);
+	t_value_2e30 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e30 = (u32)((u64)7UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)88UL));
+	t_value_2e31 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e31 = (u32)((u64)65536UL);
+	t_value_2e31 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e31 = (u32)((u64)8UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)96UL));
+	t_value_2e32 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e32 = (u32)((u64)65535UL);
+	t_value_2e32 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e32 = (u32)((u64)0UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)104UL));
+	t_value_2e33 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e33 = (u32)((u64)2147483647UL);
+	t_value_2e33 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e33 = (u32)((u64)9UL);
+	t_item_2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)112UL));
+	t_value_2e34 = (u64)((u64)t_item_2e14 + (u64)((u64)0UL));
+	t__2e35 = (u64)(u32)(-(u32)((u64)2147483648UL));
+	*(u32 *)t_value_2e34 = (u32)t__2e35;
+	t_value_2e34 = (u64)((u64)t_item_2e14 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e34 = (u32)((u64)0UL);
+	*(u64 *)t_binding_2e41 = (u64)((u64)0UL);
+	L_loop_2e36:;
+	t__2e43 = (u64)(*(u64 *)t_binding_2e41);
+	t__2e42 = (u64)(u32)(((u64)t__2e43 < (u64)((u64)15UL)));
+	if ((u32)t__2e42) goto L_body_2e37; else goto L__2e39;
+	L_body_2e37:;
+	t__2e51 = (u64)(*(u64 *)t_binding_2e41);
+	t__2e50 = (u64)((u64)t__2e51 * (u64)((u64)8UL));
+	t__2e50 = (u64)((u64)t_binding_2e11 + (u64)t__2e50);
+	t_value_2e52 = (u64)((u64)t__2e50 + (u64)((u64)0UL));
+	t__2e53 = (u64)(u32)(*(i32 *)t_value_2e52);
+	t__2e49 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_sparse)))((u32)t__2e53));
+	t__2e55 = (u64)(*(u64 *)t_binding_2e41);
+	t__2e54 = (u64)((u64)t__2e55 * (u64)((u64)8UL));
+	t__2e54 = (u64)((u64)t_binding_2e11 + (u64)t__2e54);
+	t_value_2e56 = (u64)((u64)t__2e54 + (u64)((u64)4UL));
+	t__2e57 = (u64)(u32)(*(i32 *)t_value_2e56);
+	t__2e48 = (u64)(u32)(((u32)t__2e49 == (u32)t__2e57));
+	if ((u32)t__2e48) goto L_passed_2e47; else goto L_failed_2e46;
+	L_failed_2e46:;
+	t_abortsite_2e59 = ((u64)0UL);
+	goto L_abort_2e60;
+	L_passed_2e47:;
+	goto L__2e44;
+	L__2e66:;
+	L__2e44:;
+	L_after_2e40:;
+	t__2e67 = (u64)(*(u64 *)t_binding_2e41);
+	t__2e67 = (u64)((u64)t__2e67 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e41 = (u64)t__2e67;
+	goto L_loop_2e36;
+	L__2e39:;
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)2UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)2UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)2UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)3UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)4UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)20UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)3UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)24UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)4UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)28UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)3UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)32UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)4UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)36UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)3UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)40UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)5UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)44UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)5UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)48UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)5UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)52UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)5UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)56UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)5UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)60UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)6UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)64UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)0UL);
+	t_item_2e70 = (u64)((u64)t_binding_2e68 + (u64)((u64)68UL));
+	*(u32 *)t_item_2e70 = (u32)((u64)0UL);
+	*(u64 *)t_binding_2e76 = (u64)((u64)0UL);
+	L_loop_2e71:;
+	t__2e78 = (u64)(*(u64 *)t_binding_2e76);
+	t__2e77 = (u64)(u32)(((u64)t__2e78 < (u64)((u64)18UL)));
+	if ((u32)t__2e77) goto L_body_2e72; else goto L__2e74;
+	L_body_2e72:;
+	t__2e86 = (u64)(*(u64 *)t_binding_2e76);
+	t__2e87 = (u64)(u32)t__2e86;
+	t__2e88 = (u64)(u32)((i64)(i8)t__2e87);
+	t__2e85 = (u64)(u32)((u32)t__2e88 - (u32)((u64)3UL));
+	t__2e84 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_dense)))((u32)t__2e85));
+	t__2e90 = (u64)(*(u64 *)t_binding_2e76);
+	t__2e89 = (u64)((u64)t__2e90 * (u64)((u64)4UL));
+	t__2e89 = (u64)((u64)t_binding_2e68 + (u64)t__2e89);
+	t__2e91 = (u64)(u32)(*(i32 *)t__2e89);
+	t__2e83 = (u64)(u32)(((u32)t__2e84 == (u32)t__2e91));
+	if ((u32)t__2e83) goto L_passed_2e82; else goto L_failed_2e81;
+	L_failed_2e81:;
+	t_abortsite_2e59 = ((u64)1UL);
+	goto L_abort_2e60;
+	L_passed_2e82:;
+	goto L__2e79;
+	L__2e92:;
+	L__2e79:;
+	L_after_2e75:;
+	t__2e93 = (u64)(*(u64 *)t_binding_2e76);
+	t__2e93 = (u64)((u64)t__2e93 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e76 = (u64)t__2e93;
+	goto L_loop_2e71;
+	L__2e74:;
+	t__2e98 = (u64)(u32)(-(u32)((u64)128UL));
+	t__2e97 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_dense)))((u32)t__2e98));
+	t__2e96 = (u64)(u32)(((u32)t__2e97 == (u32)((u64)1UL)));
+	if ((u32)t__2e96) goto L_passed_2e95; else goto L_failed_2e94;
+	L_failed_2e94:;
+	t_abortsite_2e59 = ((u64)2UL);
+	goto L_abort_2e60;
+	L_passed_2e95:;
+	t__2e103 = (u64)(u32)(-(u32)((u64)127UL));
+	t__2e102 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_dense)))((u32)t__2e103));
+	t__2e101 = (u64)(u32)(((u32)t__2e102 == (u32)((u64)0UL)));
+	if ((u32)t__2e101) goto L_passed_2e100; else goto L_failed_2e99;
+	L_failed_2e99:;
+	t_abortsite_2e59 = ((u64)3UL);
+	goto L_abort_2e60;
+	L_passed_2e100:;
+	t__2e108 = (u64)(u32)(-(u32)((u64)4UL));
+	t__2e107 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_dense)))((u32)t__2e108));
+	t__2e106 = (u64)(u32)(((u32)t__2e107 == (u32)((u64)0UL)));
+	if ((u32)t__2e106) goto L_passed_2e105; else goto L_failed_2e104;
+	L_failed_2e104:;
+	t_abortsite_2e59 = ((u64)4UL);
+	goto L_abort_2e60;
+	L_passed_2e105:;
+	t__2e112 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_dense)))((u32)((u64)125UL)));
+	t__2e111 = (u64)(u32)(((u32)t__2e112 == (u32)((u64)0UL)));
+	if ((u32)t__2e111) goto L_passed_2e110; else goto L_failed_2e109;
+	L_failed_2e109:;
+	t_abortsite_2e59 = ((u64)5UL);
+	goto L_abort_2e60;
+	L_passed_2e110:;
+	t__2e116 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_dense)))((u32)((u64)126UL)));
+	t__2e115 = (u64)(u32)(((u32)t__2e116 == (u32)((u64)7UL)));
+	if ((u32)t__2e115) goto L_passed_2e114; else goto L_failed_2e113;
+	L_failed_2e113:;
+	t_abortsite_2e59 = ((u64)6UL);
+	goto L_abort_2e60;
+	L_passed_2e114:;
+	t__2e120 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_dense)))((u32)((u64)127UL)));
+	t__2e119 = (u64)(u32)(((u32)t__2e120 == (u32)((u64)7UL)));
+	if ((u32)t__2e119) goto L_passed_2e118; else goto L_failed_2e117;
+	L_failed_2e117:;
+	t_abortsite_2e59 = ((u64)7UL);
+	goto L_abort_2e60;
+	L_passed_2e118:;
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)0UL));
+	t_value_2e125 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e125 = (u8)((u64)0UL);
+	t_value_2e125 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e125 = (u32)((u64)1UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)8UL));
+	t_value_2e126 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e126 = (u8)((u64)1UL);
+	t_value_2e126 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e126 = (u32)((u64)2UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)16UL));
+	t_value_2e127 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e127 = (u8)((u64)3UL);
+	t_value_2e127 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e127 = (u32)((u64)2UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)24UL));
+	t_value_2e128 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e128 = (u8)((u64)4UL);
+	t_value_2e128 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e128 = (u32)((u64)0UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)32UL));
+	t_value_2e129 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e129 = (u8)((u64)126UL);
+	t_value_2e129 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e129 = (u32)((u64)0UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)40UL));
+	t_value_2e130 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e130 = (u8)((u64)127UL);
+	t_value_2e130 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e130 = (u32)((u64)3UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)48UL));
+	t_value_2e131 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e131 = (u8)((u64)128UL);
+	t_value_2e131 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e131 = (u32)((u64)4UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)56UL));
+	t_value_2e132 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e132 = (u8)((u64)129UL);
+	t_value_2e132 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e132 = (u32)((u64)0UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)64UL));
+	t_value_2e133 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e133 = (u8)((u64)199UL);
+	t_value_2e133 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e133 = (u32)((u64)0UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)72UL));
+	t_value_2e134 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e134 = (u8)((u64)200UL);
+	t_value_2e134 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e134 = (u32)((u64)5UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)80UL));
+	t_value_2e135 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e135 = (u8)((u64)202UL);
+	t_value_2e135 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e135 = (u32)((u64)5UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)88UL));
+	t_value_2e136 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e136 = (u8)((u64)203UL);
+	t_value_2e136 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e136 = (u32)((u64)0UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)96UL));
+	t_value_2e137 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e137 = (u8)((u64)254UL);
+	t_value_2e137 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e137 = (u32)((u64)0UL);
+	t_item_2e124 = (u64)((u64)t_binding_2e121 + (u64)((u64)104UL));
+	t_value_2e138 = (u64)((u64)t_item_2e124 + (u64)((u64)0UL));
+	*(u8 *)t_value_2e138 = (u8)((u64)255UL);
+	t_value_2e138 = (u64)((u64)t_item_2e124 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e138 = (u32)((u64)6UL);
+	*(u64 *)t_binding_2e144 = (u64)((u64)0UL);
+	L_loop_2e139:;
+	t__2e146 = (u64)(*(u64 *)t_binding_2e144);
+	t__2e145 = (u64)(u32)(((u64)t__2e146 < (u64)((u64)14UL)));
+	if ((u32)t__2e145) goto L_body_2e140; else goto L__2e142;
+	L_body_2e140:;
+	t__2e154 = (u64)(*(u64 *)t_binding_2e144);
+	t__2e153 = (u64)((u64)t__2e154 * (u64)((u64)8UL));
+	t__2e153 = (u64)((u64)t_binding_2e121 + (u64)t__2e153);
+	t_value_2e155 = (u64)((u64)t__2e153 + (u64)((u64)0UL));
+	t__2e156 = (u64)(u32)(*(u8 *)t_value_2e155);
+	t__2e152 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_unsigned)))((u32)t__2e156));
+	t__2e158 = (u64)(*(u64 *)t_binding_2e144);
+	t__2e157 = (u64)((u64)t__2e158 * (u64)((u64)8UL));
+	t__2e157 = (u64)((u64)t_binding_2e121 + (u64)t__2e157);
+	t_value_2e159 = (u64)((u64)t__2e157 + (u64)((u64)4UL));
+	t__2e160 = (u64)(u32)(*(i32 *)t_value_2e159);
+	t__2e151 = (u64)(u32)(((u32)t__2e152 == (u32)t__2e160));
+	if ((u32)t__2e151) goto L_passed_2e150; else goto L_failed_2e149;
+	L_failed_2e149:;
+	t_abortsite_2e59 = ((u64)8UL);
+	goto L_abort_2e60;
+	L_passed_2e150:;
+	goto L__2e147;
+	L__2e161:;
+	L__2e147:;
+	L_after_2e143:;
+	t__2e162 = (u64)(*(u64 *)t_binding_2e144);
+	t__2e162 = (u64)((u64)t__2e162 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e144 = (u64)t__2e162;
+	goto L_loop_2e139;
+	L__2e142:;
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)0UL));
+	t_value_2e167 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e167 = (u64)((u64)0UL);
+	t_value_2e167 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e167 = (u32)((u64)1UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)16UL));
+	t_value_2e168 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e168 = (u64)((u64)1UL);
+	t_value_2e168 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e168 = (u32)((u64)0UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)32UL));
+	t_value_2e169 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	t__2e170 = (u64)((u64)((u64)1UL) << (((u64)32UL) & 63));
+	*(u64 *)t_value_2e169 = (u64)t__2e170;
+	t_value_2e169 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e169 = (u32)((u64)2UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)48UL));
+	t_value_2e171 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	t__2e173 = (u64)((u64)((u64)1UL) << (((u64)32UL) & 63));
+	t__2e172 = (u64)((u64)t__2e173 + (u64)((u64)1UL));
+	*(u64 *)t_value_2e171 = (u64)t__2e172;
+	t_value_2e171 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e171 = (u32)((u64)0UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)64UL));
+	t_value_2e174 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	t__2e175 = (u64)((u64)((u64)1UL) << (((u64)63UL) & 63));
+	*(u64 *)t_value_2e174 = (u64)t__2e175;
+	t_value_2e174 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e174 = (u32)((u64)3UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)80UL));
+	t_value_2e176 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	t__2e178 = (u64)((u64)((u64)1UL) << (((u64)63UL) & 63));
+	t__2e177 = (u64)((u64)t__2e178 + (u64)((u64)1UL));
+	*(u64 *)t_value_2e176 = (u64)t__2e177;
+	t_value_2e176 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e176 = (u32)((u64)3UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)96UL));
+	t_value_2e179 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	t__2e181 = (u64)((u64)((u64)1UL) << (((u64)63UL) & 63));
+	t__2e180 = (u64)((u64)t__2e181 - (u64)((u64)1UL));
+	*(u64 *)t_value_2e179 = (u64)t__2e180;
+	t_value_2e179 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e179 = (u32)((u64)0UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)112UL));
+	t_value_2e182 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e182 = (u64)((u64)18446744073709551614UL);
+	t_value_2e182 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e182 = (u32)((u64)4UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)128UL));
+	t_value_2e183 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e183 = (u64)((u64)18446744073709551615UL);
+	t_value_2e183 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e183 = (u32)((u64)4UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)144UL));
+	t_value_2e184 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e184 = (u64)((u64)18446744073709551613UL);
+	t_value_2e184 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e184 = (u32)((u64)0UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)160UL));
+	t_value_2e185 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e185 = (u64)((u64)5UL);
+	t_value_2e185 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e185 = (u32)((u64)5UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)176UL));
+	t_value_2e186 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e186 = (u64)((u64)6UL);
+	t_value_2e186 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e186 = (u32)((u64)5UL);
+	t_item_2e166 = (u64)((u64)t_binding_2e163 + (u64)((u64)192UL));
+	t_value_2e187 = (u64)((u64)t_item_2e166 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e187 = (u64)((u64)7UL);
+	t_value_2e187 = (u64)((u64)t_item_2e166 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e187 = (u32)((u64)0UL);
+	*(u64 *)t_binding_2e193 = (u64)((u64)0UL);
+	L_loop_2e188:;
+	t__2e195 = (u64)(*(u64 *)t_binding_2e193);
+	t__2e194 = (u64)(u32)(((u64)t__2e195 < (u64)((u64)13UL)));
+	if ((u32)t__2e194) goto L_body_2e189; else goto L__2e191;
+	L_body_2e189:;
+	t__2e203 = (u64)(*(u64 *)t_binding_2e193);
+	t__2e202 = (u64)((u64)t__2e203 * (u64)((u64)16UL));
+	t__2e202 = (u64)((u64)t_binding_2e163 + (u64)t__2e202);
+	t_value_2e204 = (u64)((u64)t__2e202 + (u64)((u64)0UL));
+	t__2e205 = (u64)(*(u64 *)t_value_2e204);
+	t__2e201 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_wide)))((u64)t__2e205));
+	t__2e207 = (u64)(*(u64 *)t_binding_2e193);
+	t__2e206 = (u64)((u64)t__2e207 * (u64)((u64)16UL));
+	t__2e206 = (u64)((u64)t_binding_2e163 + (u64)t__2e206);
+	t_value_2e208 = (u64)((u64)t__2e206 + (u64)((u64)8UL));
+	t__2e209 = (u64)(u32)(*(i32 *)t_value_2e208);
+	t__2e200 = (u64)(u32)(((u32)t__2e201 == (u32)t__2e209));
+	if ((u32)t__2e200) goto L_passed_2e199; else goto L_failed_2e198;
+	L_failed_2e198:;
+	t_abortsite_2e59 = ((u64)9UL);
+	goto L_abort_2e60;
+	L_passed_2e199:;
+	goto L__2e196;
+	L__2e210:;
+	L__2e196:;
+	L_after_2e192:;
+	t__2e211 = (u64)(*(u64 *)t_binding_2e193);
+	t__2e211 = (u64)((u64)t__2e211 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e193 = (u64)t__2e211;
+	goto L_loop_2e188;
+	L__2e191:;
+	t_item_2e215 = (u64)((u64)t_binding_2e212 + (u64)((u64)0UL));
+	t_value_2e216 = (u64)((u64)t_item_2e215 + (u64)((u64)0UL));
+	t__2e218 = (u64)(-(u64)((u64)9223372036854775807UL));
+	t__2e217 = (u64)((u64)t__2e218 - (u64)((u64)1UL));
+	*(u64 *)t_value_2e216 = (u64)t__2e217;
+	t_value_2e216 = (u64)((u64)t_item_2e215 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e216 = (u32)((u64)1UL);
+	t_item_2e215 = (u64)((u64)t_binding_2e212 + (u64)((u64)16UL));
+	t_value_2e219 = (u64)((u64)t_item_2e215 + (u64)((u64)0UL));
+	t__2e220 = (u64)(-(u64)((u64)9223372036854775807UL));
+	*(u64 *)t_value_2e219 = (u64)t__2e220;
+	t_value_2e219 = (u64)((u64)t_item_2e215 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e219 = (u32)((u64)0UL);
+	t_item_2e215 = (u64)((u64)t_binding_2e212 + (u64)((u64)32UL));
+	t_value_2e221 = (u64)((u64)t_item_2e215 + (u64)((u64)0UL));
+	t__2e222 = (u64)(-(u64)((u64)2UL));
+	*(u64 *)t_value_2e221 = (u64)t__2e222;
+	t_value_2e221 = (u64)((u64)t_item_2e215 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e221 = (u32)((u64)0UL);
+	t_item_2e215 = (u64)((u64)t_binding_2e212 + (u64)((u64)48UL));
+	t_value_2e223 = (u64)((u64)t_item_2e215 + (u64)((u64)0UL));
+	t__2e224 = (u64)(-(u64)((u64)1UL));
+	*(u64 *)t_value_2e223 = (u64)t__2e224;
+	t_value_2e223 = (u64)((u64)t_item_2e215 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e223 = (u32)((u64)2UL);
+	t_item_2e215 = (u64)((u64)t_binding_2e212 + (u64)((u64)64UL));
+	t_value_2e225 = (u64)((u64)t_item_2e215 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e225 = (u64)((u64)0UL);
+	t_value_2e225 = (u64)((u64)t_item_2e215 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e225 = (u32)((u64)3UL);
+	t_item_2e215 = (u64)((u64)t_binding_2e212 + (u64)((u64)80UL));
+	t_value_2e226 = (u64)((u64)t_item_2e215 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e226 = (u64)((u64)1UL);
+	t_value_2e226 = (u64)((u64)t_item_2e215 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e226 = (u32)((u64)4UL);
+	t_item_2e215 = (u64)((u64)t_binding_2e212 + (u64)((u64)96UL));
+	t_value_2e227 = (u64)((u64)t_item_2e215 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e227 = (u64)((u64)2UL);
+	t_value_2e227 = (u64)((u64)t_item_2e215 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e227 = (u32)((u64)0UL);
+	t_item_2e215 = (u64)((u64)t_binding_2e212 + (u64)((u64)112UL));
+	t_value_2e228 = (u64)((u64)t_item_2e215 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e228 = (u64)((u64)9223372036854775806UL);
+	t_value_2e228 = (u64)((u64)t_item_2e215 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e228 = (u32)((u64)0UL);
+	t_item_2e215 = (u64)((u64)t_binding_2e212 + (u64)((u64)128UL));
+	t_value_2e229 = (u64)((u64)t_item_2e215 + (u64)((u64)0UL));
+	*(u64 *)t_value_2e229 = (u64)((u64)9223372036854775807UL);
+	t_value_2e229 = (u64)((u64)t_item_2e215 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e229 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e235 = (u64)((u64)0UL);
+	L_loop_2e230:;
+	t__2e237 = (u64)(*(u64 *)t_binding_2e235);
+	t__2e236 = (u64)(u32)(((u64)t__2e237 < (u64)((u64)9UL)));
+	if ((u32)t__2e236) goto L_body_2e231; else goto L__2e233;
+	L_body_2e231:;
+	t__2e245 = (u64)(*(u64 *)t_binding_2e235);
+	t__2e244 = (u64)((u64)t__2e245 * (u64)((u64)16UL));
+	t__2e244 = (u64)((u64)t_binding_2e212 + (u64)t__2e244);
+	t_value_2e246 = (u64)((u64)t__2e244 + (u64)((u64)0UL));
+	t__2e247 = (u64)(*(u64 *)t_value_2e246);
+	t__2e243 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_wide__signed)))((u64)t__2e247));
+	t__2e249 = (u64)(*(u64 *)t_binding_2e235);
+	t__2e248 = (u64)((u64)t__2e249 * (u64)((u64)16UL));
+	t__2e248 = (u64)((u64)t_binding_2e212 + (u64)t__2e248);
+	t_value_2e250 = (u64)((u64)t__2e248 + (u64)((u64)8UL));
+	t__2e251 = (u64)(u32)(*(i32 *)t_value_2e250);
+	t__2e242 = (u64)(u32)(((u32)t__2e243 == (u32)t__2e251));
+	if ((u32)t__2e242) goto L_passed_2e241; else goto L_failed_2e240;
+	L_failed_2e240:;
+	t_abortsite_2e59 = ((u64)10UL);
+	goto L_abort_2e60;
+	L_passed_2e241:;
+	goto L__2e238;
+	L__2e252:;
+	L__2e238:;
+	L_after_2e234:;
+	t__2e253 = (u64)(*(u64 *)t_binding_2e235);
+	t__2e253 = (u64)((u64)t__2e253 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e235 = (u64)t__2e253;
+	goto L_loop_2e230;
+	L__2e233:;
+	t__2e259 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_warm)))((u32)((u64)0UL)));
+	t__2e256 = (u64)(u32)t__2e259;
+	if ((u32)t__2e256) goto L__2e257; else goto L__2e258;
+	L__2e257:;
+	t__2e260 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_warm)))((u32)((u64)2UL)));
+	t__2e256 = (u64)(u32)t__2e260;
+	goto L__2e258;
+	L__2e258:;
+	if ((u32)t__2e256) goto L_passed_2e255; else goto L_failed_2e254;
+	L_failed_2e254:;
+	t_abortsite_2e59 = ((u64)11UL);
+	goto L_abort_2e60;
+	L_passed_2e255:;
+	t__2e266 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_warm)))((u32)((u64)3UL)));
+	t__2e268 = (u64)(u32)((u8)t__2e266);
+	t__2e267 = (u64)(u32)(((u32)t__2e268 == (u32)((u64)0UL)));
+	t__2e263 = (u64)(u32)t__2e267;
+	if ((u32)t__2e263) goto L__2e264; else goto L__2e265;
+	L__2e264:;
+	t__2e269 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_warm)))((u32)((u64)6UL)));
+	t__2e271 = (u64)(u32)((u8)t__2e269);
+	t__2e270 = (u64)(u32)(((u32)t__2e271 == (u32)((u64)0UL)));
+	t__2e263 = (u64)(u32)t__2e270;
+	goto L__2e265;
+	L__2e265:;
+	if ((u32)t__2e263) goto L_passed_2e262; else goto L_failed_2e261;
+	L_failed_2e261:;
+	t_abortsite_2e59 = ((u64)12UL);
+	goto L_abort_2e60;
+	L_passed_2e262:;
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)0UL));
+	t_value_2e276 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e276 = (u32)((u64)97UL);
+	t_value_2e276 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e276 = (u32)((u64)1UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)8UL));
+	t_value_2e277 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e277 = (u32)((u64)102UL);
+	t_value_2e277 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e277 = (u32)((u64)1UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)16UL));
+	t_value_2e278 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e278 = (u32)((u64)103UL);
+	t_value_2e278 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e278 = (u32)((u64)0UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)24UL));
+	t_value_2e279 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e279 = (u32)((u64)48UL);
+	t_value_2e279 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e279 = (u32)((u64)2UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)32UL));
+	t_value_2e280 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e280 = (u32)((u64)57UL);
+	t_value_2e280 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e280 = (u32)((u64)2UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)40UL));
+	t_value_2e281 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e281 = (u32)((u64)58UL);
+	t_value_2e281 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e281 = (u32)((u64)0UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)48UL));
+	t_value_2e282 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e282 = (u32)((u64)32UL);
+	t_value_2e282 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e282 = (u32)((u64)3UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)56UL));
+	t_value_2e283 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e283 = (u32)((u64)9UL);
+	t_value_2e283 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e283 = (u32)((u64)3UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)64UL));
+	t_value_2e284 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e284 = (u32)((u64)10UL);
+	t_value_2e284 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e284 = (u32)((u64)3UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)72UL));
+	t_value_2e285 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e285 = (u32)((u64)13UL);
+	t_value_2e285 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e285 = (u32)((u64)0UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)80UL));
+	t_value_2e286 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e286 = (u32)((u64)120UL);
+	t_value_2e286 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e286 = (u32)((u64)4UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)88UL));
+	t_value_2e287 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e287 = (u32)((u64)233UL);
+	t_value_2e287 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e287 = (u32)((u64)5UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)96UL));
+	t_value_2e288 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e288 = (u32)((u64)232UL);
+	t_value_2e288 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e288 = (u32)((u64)0UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)104UL));
+	t_value_2e289 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e289 = (u32)((u64)128512UL);
+	t_value_2e289 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e289 = (u32)((u64)6UL);
+	t_item_2e275 = (u64)((u64)t_binding_2e272 + (u64)((u64)112UL));
+	t_value_2e290 = (u64)((u64)t_item_2e275 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e290 = (u32)((u64)0UL);
+	t_value_2e290 = (u64)((u64)t_item_2e275 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e290 = (u32)((u64)0UL);
+	*(u64 *)t_binding_2e296 = (u64)((u64)0UL);
+	L_loop_2e291:;
+	t__2e298 = (u64)(*(u64 *)t_binding_2e296);
+	t__2e297 = (u64)(u32)(((u64)t__2e298 < (u64)((u64)15UL)));
+	if ((u32)t__2e297) goto L_body_2e292; else goto L__2e294;
+	L_body_2e292:;
+	t__2e306 = (u64)(*(u64 *)t_binding_2e296);
+	t__2e305 = (u64)((u64)t__2e306 * (u64)((u64)8UL));
+	t__2e305 = (u64)((u64)t_binding_2e272 + (u64)t__2e305);
+	t_value_2e307 = (u64)((u64)t__2e305 + (u64)((u64)0UL));
+	t__2e308 = (u64)(u32)(*(u32 *)t_value_2e307);
+	t__2e304 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_kind)))((u32)t__2e308));
+	t__2e310 = (u64)(*(u64 *)t_binding_2e296);
+	t__2e309 = (u64)((u64)t__2e310 * (u64)((u64)8UL));
+	t__2e309 = (u64)((u64)t_binding_2e272 + (u64)t__2e309);
+	t_value_2e311 = (u64)((u64)t__2e309 + (u64)((u64)4UL));
+	t__2e312 = (u64)(u32)(*(i32 *)t_value_2e311);
+	t__2e303 = (u64)(u32)(((u32)t__2e304 == (u32)t__2e312));
+	if ((u32)t__2e303) goto L_passed_2e302; else goto L_failed_2e301;
+	L_failed_2e301:;
+	t_abortsite_2e59 = ((u64)13UL);
+	goto L_abort_2e60;
+	L_passed_2e302:;
+	goto L__2e299;
+	L__2e313:;
+	L__2e299:;
+	L_after_2e295:;
+	t__2e314 = (u64)(*(u64 *)t_binding_2e296);
+	t__2e314 = (u64)((u64)t__2e314 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e296 = (u64)t__2e314;
+	goto L_loop_2e291;
+	L__2e294:;
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)0UL));
+	t_value_2e320 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e320, ((u64)((char *)&D_strliteral_2e321)), ((u64)24UL));
+	t_value_2e320 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e320 = (u32)((u64)1UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)32UL));
+	t_value_2e322 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e322, ((u64)((char *)&D_strliteral_2e324)), ((u64)24UL));
+	t_value_2e322 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e322 = (u32)((u64)2UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)64UL));
+	t_value_2e325 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e325, ((u64)((char *)&D_strliteral_2e327)), ((u64)24UL));
+	t_value_2e325 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e325 = (u32)((u64)0UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)96UL));
+	t_value_2e328 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e328, ((u64)((char *)&D_strliteral_2e330)), ((u64)24UL));
+	t_value_2e328 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e328 = (u32)((u64)0UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)128UL));
+	t_value_2e331 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e331, ((u64)((char *)&D_strliteral_2e333)), ((u64)24UL));
+	t_value_2e331 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e331 = (u32)((u64)0UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)160UL));
+	t_value_2e334 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e334, ((u64)((char *)&D_strliteral_2e336)), ((u64)24UL));
+	t_value_2e334 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e334 = (u32)((u64)3UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)192UL));
+	t_value_2e337 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e337, ((u64)((char *)&D_strliteral_2e339)), ((u64)24UL));
+	t_value_2e337 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e337 = (u32)((u64)3UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)224UL));
+	t_value_2e340 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e340, ((u64)((char *)&D_strliteral_2e342)), ((u64)24UL));
+	t_value_2e340 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e340 = (u32)((u64)0UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)256UL));
+	t_value_2e343 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e343, ((u64)((char *)&D_strliteral_2e345)), ((u64)24UL));
+	t_value_2e343 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e343 = (u32)((u64)4UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)288UL));
+	t_value_2e346 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e346, ((u64)((char *)&D_strliteral_2e348)), ((u64)24UL));
+	t_value_2e346 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e346 = (u32)((u64)5UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)320UL));
+	t_value_2e349 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e349, ((u64)((char *)&D_strliteral_2e351)), ((u64)24UL));
+	t_value_2e349 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e349 = (u32)((u64)0UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)352UL));
+	t_value_2e352 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e352, ((u64)((char *)&D_strliteral_2e354)), ((u64)24UL));
+	t_value_2e352 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e352 = (u32)((u64)6UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)384UL));
+	t_value_2e355 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e355, ((u64)((char *)&D_strliteral_2e357)), ((u64)24UL));
+	t_value_2e355 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e355 = (u32)((u64)7UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)416UL));
+	t_value_2e358 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e358, ((u64)((char *)&D_strliteral_2e360)), ((u64)24UL));
+	t_value_2e358 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e358 = (u32)((u64)7UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)448UL));
+	t_value_2e361 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e361, ((u64)((char *)&D_strliteral_2e363)), ((u64)24UL));
+	t_value_2e361 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e361 = (u32)((u64)0UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)480UL));
+	t_value_2e364 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e364, ((u64)((char *)&D_strliteral_2e366)), ((u64)24UL));
+	t_value_2e364 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e364 = (u32)((u64)8UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)512UL));
+	t_value_2e367 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e367, ((u64)((char *)&D_strliteral_2e369)), ((u64)24UL));
+	t_value_2e367 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e367 = (u32)((u64)8UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)544UL));
+	t_value_2e370 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e370, ((u64)((char *)&D_strliteral_2e372)), ((u64)24UL));
+	t_value_2e370 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e370 = (u32)((u64)0UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)576UL));
+	t_value_2e373 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e373, ((u64)((char *)&D_strliteral_2e375)), ((u64)24UL));
+	t_value_2e373 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e373 = (u32)((u64)9UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)608UL));
+	t_value_2e376 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e376, ((u64)((char *)&D_strliteral_2e378)), ((u64)24UL));
+	t_value_2e376 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e376 = (u32)((u64)9UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)640UL));
+	t_value_2e379 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e379, ((u64)((char *)&D_strliteral_2e381)), ((u64)24UL));
+	t_value_2e379 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e379 = (u32)((u64)0UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)672UL));
+	t_value_2e382 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e382, ((u64)((char *)&D_strliteral_2e384)), ((u64)24UL));
+	t_value_2e382 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e382 = (u32)((u64)10UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)704UL));
+	t_value_2e385 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e385, ((u64)((char *)&D_strliteral_2e387)), ((u64)24UL));
+	t_value_2e385 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e385 = (u32)((u64)0UL);
+	t_item_2e319 = (u64)((u64)t_binding_2e315 + (u64)((u64)736UL));
+	t_value_2e388 = (u64)((u64)t_item_2e319 + (u64)((u64)0UL));
+	BLIT(t_value_2e388, ((u64)((char *)&D_strliteral_2e390)), ((u64)24UL));
+	t_value_2e388 = (u64)((u64)t_item_2e319 + (u64)((u64)24UL));
+	*(u32 *)t_value_2e388 = (u32)((u64)0UL);
+	*(u64 *)t_binding_2e396 = (u64)((u64)0UL);
+	L_loop_2e391:;
+	t__2e398 = (u64)(*(u64 *)t_binding_2e396);
+	t__2e397 = (u64)(u32)(((u64)t__2e398 < (u64)((u64)24UL)));
+	if ((u32)t__2e397) goto L_body_2e392; else goto L__2e394;
+	L_body_2e392:;
+	t__2e406 = (u64)(*(u64 *)t_binding_2e396);
+	t__2e405 = (u64)((u64)t__2e406 * (u64)((u64)32UL));
+	t__2e405 = (u64)((u64)t_binding_2e315 + (u64)t__2e405);
+	t_value_2e407 = (u64)((u64)t__2e405 + (u64)((u64)0UL));
+	BLIT((u64)B14, t_value_2e407, 24);
+	t__2e404 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_command)))((u64)B14));
+	t__2e409 = (u64)(*(u64 *)t_binding_2e396);
+	t__2e408 = (u64)((u64)t__2e409 * (u64)((u64)32UL));
+	t__2e408 = (u64)((u64)t_binding_2e315 + (u64)t__2e408);
+	t_value_2e410 = (u64)((u64)t__2e408 + (u64)((u64)24UL));
+	t__2e411 = (u64)(u32)(*(i32 *)t_value_2e410);
+	t__2e403 = (u64)(u32)(((u32)t__2e404 == (u32)t__2e411));
+	if ((u32)t__2e403) goto L_passed_2e402; else goto L_failed_2e401;
+	L_failed_2e401:;
+	t_abortsite_2e59 = ((u64)14UL);
+	goto L_abort_2e60;
+	L_passed_2e402:;
+	goto L__2e399;
+	L__2e412:;
+	L__2e399:;
+	L_after_2e395:;
+	t__2e413 = (u64)(*(u64 *)t_binding_2e396);
+	t__2e413 = (u64)((u64)t__2e413 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e396 = (u64)t__2e413;
+	goto L_loop_2e391;
+	L__2e394:;
+	goto L__2e9;
+	L__2e414:;
+	L__2e9:;
+	return;
+	L_abort_2e60:;
+	t__2e61 = (u64)((u64)t_abortsite_2e59 * (u64)((u64)16UL));
+	t__2e61 = (u64)((u64)((u64)((char *)&D_abortsites_2e58)) + (u64)t__2e61);
+	t__2e62 = (u64)(*(u64 *)t__2e61);
+	t__2e63 = (u64)((u64)t__2e61 + (u64)((u64)8UL));
+	t__2e64 = (u64)(*(u32 *)t__2e63);
+	t__2e63 = (u64)((u64)t__2e61 + (u64)((u64)12UL));
+	t__2e65 = (u64)(*(u32 *)t__2e63);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e62, (u64)t__2e64, (u64)t__2e65, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_command(u64 p_s) {
+	char B0[24] __attribute__((aligned(16)));
+	char B1[24] __attribute__((aligned(16)));
+	char B2[24] __attribute__((aligned(16)));
+	char B3[24] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char B16[24] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	u64 t__2e433;
+	u64 t__2e434;
+	u64 t__2e435;
+	u64 t__2e436;
+	u64 t__2e445;
+	u64 t__2e447;
+	u64 t__2e449;
+	u64 t__2e451;
+	u64 t__2e453;
+	u64 t__2e455;
+	u64 t__2e457;
+	u64 t__2e461;
+	u64 t__2e462;
+	u64 t__2e464;
+	u64 t__2e466;
+	u64 t__2e468;
+	u64 t__2e469;
+	u64 t__2e470;
+	u64 t__2e471;
+	u64 t__2e476;
+	u64 t__2e477;
+	u64 t__2e479;
+	u64 t__2e481;
+	u64 t__2e483;
+	u64 t__2e485;
+	u64 t__2e486;
+	u64 t__2e487;
+	u64 t__2e488;
+	u64 t__2e489;
+	u64 t__2e493;
+	u64 t__2e494;
+	u64 t__2e496;
+	u64 t__2e498;
+	u64 t__2e500;
+	u64 t__2e501;
+	u64 t__2e502;
+	u64 t__2e503;
+	u64 t__2e506;
+	u64 t__2e507;
+	u64 t__2e509;
+	u64 t__2e511;
+	u64 t__2e512;
+	u64 t__2e513;
+	u64 t__2e514;
+	u64 t__2e562;
+	u64 t__2e563;
+	u64 t__2e564;
+	u64 t__2e565;
+	u64 t__2e566;
+	u64 t_abortsite_2e560;
+	u64 t_s;
+	t_s = p_s;
+	L_start_2e415:;
+	L_body_2e416:;
+	t__2e433 = (u64)((u64)t_s + (u64)((u64)8UL));
+	t__2e434 = (u64)((u64)t_s + (u64)((u64)16UL));
+	t__2e435 = (u64)(*(u64 *)t_s);
+	t__2e436 = (u64)(*(u64 *)t__2e433);
+	t__2e445 = (u64)(u32)(((u64)t__2e436 < (u64)((u64)5UL)));
+	if ((u32)t__2e445) goto L_switch_2elt_2e443; else goto L_switch_2ege_2e444;
+	L_switch_2elt_2e443:;
+	t__2e447 = (u64)(u32)(((u64)t__2e436 == (u64)((u64)0UL)));
+	if ((u32)t__2e447) goto L_string_2e437; else goto L__2e446;
+	L__2e446:;
+	t__2e449 = (u64)(u32)(((u64)t__2e436 == (u64)((u64)3UL)));
+	if ((u32)t__2e449) goto L_string_2e438; else goto L__2e448;
+	L__2e448:;
+	t__2e451 = (u64)(u32)(((u64)t__2e436 == (u64)((u64)4UL)));
+	if ((u32)t__2e451) goto L_string_2e439; else goto L__2e450;
+	L__2e450:;
+	goto L_matches_2e432;
+	L_switch_2ege_2e444:;
+	t__2e453 = (u64)(u32)(((u64)t__2e436 == (u64)((u64)5UL)));
+	if ((u32)t__2e453) goto L_string_2e440; else goto L__2e452;
+	L__2e452:;
+	t__2e455 = (u64)(u32)(((u64)t__2e436 == (u64)((u64)6UL)));
+	if ((u32)t__2e455) goto L_string_2e441; else goto L__2e454;
+	L__2e454:;
+	t__2e457 = (u64)(u32)(((u64)t__2e436 == (u64)((u64)7UL)));
+	if ((u32)t__2e457) goto L_string_2e442; else goto L__2e456;
+	L__2e456:;
+	goto L_matches_2e432;
+	L_string_2e437:;
+	goto L_matches_2e422;
+	L_string_2e438:;
+	t__2e461 = (u64)((u64)t__2e435 + (u64)((u64)0UL));
+	t__2e462 = (u64)(u32)(*(u8 *)t__2e461);
+	t__2e464 = (u64)(u32)(((u32)t__2e462 == (u32)((u64)71UL)));
+	if ((u32)t__2e464) goto L_string_2e458; else goto L__2e463;
+	L__2e463:;
+	t__2e466 = (u64)(u32)(((u32)t__2e462 == (u32)((u64)80UL)));
+	if ((u32)t__2e466) goto L_string_2e459; else goto L__2e465;
+	L__2e465:;
+	t__2e468 = (u64)(u32)(((u32)t__2e462 == (u32)((u64)104UL)));
+	if ((u32)t__2e468) goto L_string_2e460; else goto L__2e467;
+	L__2e467:;
+	goto L_matches_2e432;
+	L_string_2e458:;
+	BLIT((u64)B0, t_s, 24);
+	BLIT((u64)B1, ((u64)((char *)&D_strliteral_2e324)), 24);
+	t__2e469 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B0, (u64)B1));
+	if ((u32)t__2e469) goto L_matches_2e423; else goto L_matches_2e432;
+	L_string_2e459:;
+	BLIT((u64)B2, t_s, 24);
+	BLIT((u64)B3, ((u64)((char *)&D_strliteral_2e336)), 24);
+	t__2e470 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B2, (u64)B3));
+	if ((u32)t__2e470) goto L_matches_2e424; else goto L_matches_2e432;
+	L_string_2e460:;
+	BLIT((u64)B4, t_s, 24);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e384)), 24);
+	t__2e471 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B4, (u64)B5));
+	if ((u32)t__2e471) goto L_matches_2e431; else goto L_matches_2e432;
+	L_string_2e439:;
+	t__2e476 = (u64)((u64)t__2e435 + (u64)((u64)1UL));
+	t__2e477 = (u64)(u32)(*(u8 *)t__2e476);
+	t__2e479 = (u64)(u32)(((u32)t__2e477 == (u32)((u64)69UL)));
+	if ((u32)t__2e479) goto L_string_2e472; else goto L__2e478;
+	L__2e478:;
+	t__2e481 = (u64)(u32)(((u32)t__2e477 == (u32)((u64)73UL)));
+	if ((u32)t__2e481) goto L_string_2e473; else goto L__2e480;
+	L__2e480:;
+	t__2e483 = (u64)(u32)(((u32)t__2e477 == (u32)((u64)79UL)));
+	if ((u32)t__2e483) goto L_string_2e474; else goto L__2e482;
+	L__2e482:;
+	t__2e485 = (u64)(u32)(((u32)t__2e477 == (u32)((u64)83UL)));
+	if ((u32)t__2e485) goto L_string_2e475; else goto L__2e484;
+	L__2e484:;
+	goto L_matches_2e432;
+	L_string_2e472:;
+	BLIT((u64)B6, t_s, 24);
+	BLIT((u64)B7, ((u64)((char *)&D_strliteral_2e345)), 24);
+	t__2e486 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B6, (u64)B7));
+	if ((u32)t__2e486) goto L_matches_2e425; else goto L_matches_2e432;
+	L_string_2e473:;
+	BLIT((u64)B8, t_s, 24);
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e366)), 24);
+	t__2e487 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B8, (u64)B9));
+	if ((u32)t__2e487) goto L_matches_2e429; else goto L_matches_2e432;
+	L_string_2e474:;
+	BLIT((u64)B10, t_s, 24);
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e339)), 24);
+	t__2e488 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B10, (u64)B11));
+	if ((u32)t__2e488) goto L_matches_2e424; else goto L_matches_2e432;
+	L_string_2e475:;
+	BLIT((u64)B12, t_s, 24);
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e369)), 24);
+	t__2e489 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B12, (u64)B13));
+	if ((u32)t__2e489) goto L_matches_2e429; else goto L_matches_2e432;
+	L_string_2e440:;
+	t__2e493 = (u64)((u64)t__2e435 + (u64)((u64)0UL));
+	t__2e494 = (u64)(u32)(*(u8 *)t__2e493);
+	t__2e496 = (u64)(u32)(((u32)t__2e494 == (u32)((u64)76UL)));
+	if ((u32)t__2e496) goto L_string_2e490; else goto L__2e495;
+	L__2e495:;
+	t__2e498 = (u64)(u32)(((u32)t__2e494 == (u32)((u64)80UL)));
+	if ((u32)t__2e498) goto L_string_2e491; else goto L__2e497;
+	L__2e497:;
+	t__2e500 = (u64)(u32)(((u32)t__2e494 == (u32)((u64)84UL)));
+	if ((u32)t__2e500) goto L_string_2e492; else goto L__2e499;
+	L__2e499:;
+	goto L_matches_2e432;
+	L_string_2e490:;
+	BLIT((u64)B14, t_s, 24);
+	BLIT((u64)B15, ((u64)((char *)&D_strliteral_2e375)), 24);
+	t__2e501 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B14, (u64)B15));
+	if ((u32)t__2e501) goto L_matches_2e430; else goto L_matches_2e432;
+	L_string_2e491:;
+	BLIT((u64)B16, t_s, 24);
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e357)), 24);
+	t__2e502 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B16, (u64)B17));
+	if ((u32)t__2e502) goto L_matches_2e428; else goto L_matches_2e432;
+	L_string_2e492:;
+	BLIT((u64)B18, t_s, 24);
+	BLIT((u64)B19, ((u64)((char *)&D_strliteral_2e360)), 24);
+	t__2e503 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B18, (u64)B19));
+	if ((u32)t__2e503) goto L_matches_2e428; else goto L_matches_2e432;
+	L_string_2e441:;
+	t__2e506 = (u64)((u64)t__2e435 + (u64)((u64)0UL));
+	t__2e507 = (u64)(u32)(*(u8 *)t__2e506);
+	t__2e509 = (u64)(u32)(((u32)t__2e507 == (u32)((u64)68UL)));
+	if ((u32)t__2e509) goto L_string_2e504; else goto L__2e508;
+	L__2e508:;
+	t__2e511 = (u64)(u32)(((u32)t__2e507 == (u32)((u64)76UL)));
+	if ((u32)t__2e511) goto L_string_2e505; else goto L__2e510;
+	L__2e510:;
+	goto L_matches_2e432;
+	L_string_2e504:;
+	BLIT((u64)B20, t_s, 24);
+	BLIT((u64)B21, ((u64)((char *)&D_strliteral_2e348)), 24);
+	t__2e512 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B20, (u64)B21));
+	if ((u32)t__2e512) goto L_matches_2e426; else goto L_matches_2e432;
+	L_string_2e505:;
+	BLIT((u64)B22, t_s, 24);
+	BLIT((u64)B23, ((u64)((char *)&D_strliteral_2e378)), 24);
+	t__2e513 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B22, (u64)B23));
+	if ((u32)t__2e513) goto L_matches_2e430; else goto L_matches_2e432;
+	L_string_2e442:;
+	BLIT((u64)B24, t_s, 24);
+	BLIT((u64)B25, ((u64)((char *)&D_strliteral_2e354)), 24);
+	t__2e514 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B24, (u64)B25));
+	if ((u32)t__2e514) goto L_matches_2e427; else goto L_matches_2e432;
+	L_matches_2e422:;
+	return (u32)((u64)1UL);
+	L__2e517:;
+	L__2e515:;
+	L__2e518:;
+	L_matches_2e423:;
+	return (u32)((u64)2UL);
+	L__2e521:;
+	L__2e519:;
+	L__2e522:;
+	L_matches_2e424:;
+	return (u32)((u64)3UL);
+	L__2e525:;
+	L__2e523:;
+	L__2e526:;
+	L_matches_2e425:;
+	return (u32)((u64)4UL);
+	L__2e529:;
+	L__2e527:;
+	L__2e530:;
+	L_matches_2e426:;
+	return (u32)((u64)5UL);
+	L__2e533:;
+	L__2e531:;
+	L__2e534:;
+	L_matches_2e427:;
+	return (u32)((u64)6UL);
+	L__2e537:;
+	L__2e535:;
+	L__2e538:;
+	L_matches_2e428:;
+	return (u32)((u64)7UL);
+	L__2e541:;
+	L__2e539:;
+	L__2e542:;
+	L_matches_2e429:;
+	return (u32)((u64)8UL);
+	L__2e545:;
+	L__2e543:;
+	L__2e546:;
+	L_matches_2e430:;
+	return (u32)((u64)9UL);
+	L__2e549:;
+	L__2e547:;
+	L__2e550:;
+	L_matches_2e431:;
+	return (u32)((u64)10UL);
+	L__2e553:;
+	L__2e551:;
+	L__2e554:;
+	L_matches_2e432:;
+	return (u32)((u64)0UL);
+	L__2e557:;
+	L__2e555:;
+	L__2e558:;
+	L__2e421:;
+	t_abortsite_2e560 = ((u64)0UL);
+	goto L_abort_2e561;
+	L__2e420:;
+	L__2e567:;
+	L__2e417:;
+	L__2e568:;
+	return 0;
+	L_abort_2e561:;
+	t__2e562 = (u64)((u64)t_abortsite_2e560 * (u64)((u64)16UL));
+	t__2e562 = (u64)((u64)((u64)((char *)&D_abortsites_2e559)) + (u64)t__2e562);
+	t__2e563 = (u64)(*(u64 *)t__2e562);
+	t__2e564 = (u64)((u64)t__2e562 + (u64)((u64)8UL));
+	t__2e565 = (u64)(*(u32 *)t__2e564);
+	t__2e564 = (u64)((u64)t__2e562 + (u64)((u64)12UL));
+	t__2e566 = (u64)(*(u32 *)t__2e564);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e563, (u64)t__2e565, (u64)t__2e566, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u32 F_kind(u32 p_r) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e577;
+	u64 t__2e587;
+	u64 t__2e589;
+	u64 t__2e590;
+	u64 t__2e592;
+	u64 t__2e594;
+	u64 t__2e595;
+	u64 t__2e597;
+	u64 t__2e598;
+	u64 t__2e600;
+	u64 t__2e602;
+	u64 t__2e604;
+	u64 t__2e636;
+	u64 t__2e637;
+	u64 t__2e638;
+	u64 t__2e639;
+	u64 t__2e640;
+	u64 t_abortsite_2e634;
+	u64 t_param_2e570;
+	u64 t_r;
+	t_r = (u64)p_r;
+	L_start_2e569:;
+	t_param_2e570 = (u64)A0;
+	*(u32 *)t_param_2e570 = (u32)t_r;
+	L_body_2e571:;
+	t__2e577 = (u64)(u32)(*(u32 *)t_param_2e570);
+	t__2e587 = (u64)(u32)(((u32)t__2e577 < (u32)((u64)97UL)));
+	if ((u32)t__2e587) goto L_switch_2elt_2e585; else goto L_switch_2ege_2e586;
+	L_switch_2elt_2e585:;
+	t__2e590 = (u64)(u32)((u32)t__2e577 - (u32)((u64)9UL));
+	t__2e589 = (u64)(u32)(((u32)t__2e590 <= (u32)((u64)1UL)));
+	if ((u32)t__2e589) goto L_matches_2e580; else goto L__2e588;
+	L__2e588:;
+	t__2e592 = (u64)(u32)(((u32)t__2e577 == (u32)((u64)32UL)));
+	if ((u32)t__2e592) goto L_matches_2e580; else goto L__2e591;
+	L__2e591:;
+	t__2e595 = (u64)(u32)((u32)t__2e577 - (u32)((u64)48UL));
+	t__2e594 = (u64)(u32)(((u32)t__2e595 <= (u32)((u64)9UL)));
+	if ((u32)t__2e594) goto L_matches_2e579; else goto L__2e593;
+	L__2e593:;
+	goto L_matches_2e584;
+	L_switch_2ege_2e586:;
+	t__2e598 = (u64)(u32)((u32)t__2e577 - (u32)((u64)97UL));
+	t__2e597 = (u64)(u32)(((u32)t__2e598 <= (u32)((u64)5UL)));
+	if ((u32)t__2e597) goto L_matches_2e578; else goto L__2e596;
+	L__2e596:;
+	t__2e600 = (u64)(u32)(((u32)t__2e577 == (u32)((u64)120UL)));
+	if ((u32)t__2e600) goto L_matches_2e581; else goto L__2e599;
+	L__2e599:;
+	t__2e602 = (u64)(u32)(((u32)t__2e577 == (u32)((u64)233UL)));
+	if ((u32)t__2e602) goto L_matches_2e582; else goto L__2e601;
+	L__2e601:;
+	t__2e604 = (u64)(u32)(((u32)t__2e577 == (u32)((u64)128512UL)));
+	if ((u32)t__2e604) goto L_matches_2e583; else goto L__2e603;
+	L__2e603:;
+	goto L_matches_2e584;
+	L_matches_2e578:;
+	return (u32)((u64)1UL);
+	L__2e607:;
+	L__2e605:;
+	L__2e608:;
+	L_matches_2e579:;
+	return (u32)((u64)2UL);
+	L__2e611:;
+	L__2e609:;
+	L__2e612:;
+	L_matches_2e580:;
+	return (u32)((u64)3UL);
+	L__2e615:;
+	L__2e613:;
+	L__2e616:;
+	L_matches_2e581:;
+	return (u32)((u64)4UL);
+	L__2e619:;
+	L__2e617:;
+	L__2e620:;
+	L_matches_2e582:;
+	return (u32)((u64)5UL);
+	L__2e623:;
+	L__2e621:;
+	L__2e624:;
+	L_matches_2e583:;
+	return (u32)((u64)6UL);
+	L__2e627:;
+	L__2e625:;
+	L__2e628:;
+	L_matches_2e584:;
+	return (u32)((u64)0UL);
+	L__2e631:;
+	L__2e629:;
+	L__2e632:;
+	L__2e576:;
+	t_abortsite_2e634 = ((u64)0UL);
+	goto L_abort_2e635;
+	L__2e575:;
+	L__2e641:;
+	L__2e572:;
+	L__2e642:;
+	return 0;
+	L_abort_2e635:;
+	t__2e636 = (u64)((u64)t_abortsite_2e634 * (u64)((u64)16UL));
+	t__2e636 = (u64)((u64)((u64)((char *)&D_abortsites_2e633)) + (u64)t__2e636);
+	t__2e637 = (u64)(*(u64 *)t__2e636);
+	t__2e638 = (u64)((u64)t__2e636 + (u64)((u64)8UL));
+	t__2e639 = (u64)(*(u32 *)t__2e638);
+	t__2e638 = (u64)((u64)t__2e636 + (u64)((u64)12UL));
+	t__2e640 = (u64)(*(u32 *)t__2e638);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e637, (u64)t__2e639, (u64)t__2e640, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u32 F_warm(u32 p_c) {
+	char A0[1] __attribute__((aligned(16)));
+	u64 t__2e651;
+	u64 t__2e654;
+	u64 t__2e656;
+	u64 t__2e657;
+	u64 t__2e659;
+	u64 t__2e660;
+	u64 t__2e672;
+	u64 t__2e673;
+	u64 t__2e674;
+	u64 t__2e675;
+	u64 t__2e676;
+	u64 t_abortsite_2e670;
+	u64 t_c;
+	u64 t_param_2e644;
+	t_c = (u64)p_c;
+	L_start_2e643:;
+	t_param_2e644 = (u64)A0;
+	*(u8 *)t_param_2e644 = (u8)t_c;
+	L_body_2e645:;
+	t__2e651 = (u64)(u32)(*(u8 *)t_param_2e644);
+	t__2e654 = (u64)(u32)((u8)t__2e651);
+	t__2e657 = (u64)(u32)((u32)t__2e654 - (u32)((u64)0UL));
+	t__2e656 = (u64)(u32)(((u32)t__2e657 <= (u32)((u64)2UL)));
+	if ((u32)t__2e656) goto L_matches_2e652; else goto L__2e655;
+	L__2e655:;
+	t__2e660 = (u64)(u32)((u32)t__2e654 - (u32)((u64)3UL));
+	t__2e659 = (u64)(u32)(((u32)t__2e660 <= (u32)((u64)3UL)));
+	if ((u32)t__2e659) goto L_matches_2e653; else goto L__2e658;
+	L__2e658:;
+	goto L__2e650;
+	L_matches_2e652:;
+	return (u32)((u64)1UL);
+	L__2e663:;
+	L__2e661:;
+	L__2e664:;
+	L_matches_2e653:;
+	return (u32)((u64)0UL);
+	L__2e667:;
+	L__2e665:;
+	L__2e668:;
+	L__2e650:;
+	t_abortsite_2e670 = ((u64)0UL);
+	goto L_abort_2e671;
+	L__2e649:;
+	L__2e677:;
+	L__2e646:;
+	L__2e678:;
+	return 0;
+	L_abort_2e671:;
+	t__2e672 = (u64)((u64)t_abortsite_2e670 * (u64)((u64)16UL));
+	t__2e672 = (u64)((u64)((u64)((char *)&D_abortsites_2e669)) + (u64)t__2e672);
+	t__2e673 = (u64)(*(u64 *)t__2e672);
+	t__2e674 = (u64)((u64)t__2e672 + (u64)((u64)8UL));
+	t__2e675 = (u64)(*(u32 *)t__2e674);
+	t__2e674 = (u64)((u64)t__2e672 + (u64)((u64)12UL));
+	t__2e676 = (u64)(*(u32 *)t__2e674);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e673, (u64)t__2e675, (u64)t__2e676, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u32 F_wide__signed(u64 p_x) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e687;
+	u64 t__2e696;
+	u64 t__2e698;
+	u64 t__2e700;
+	u64 t__2e702;
+	u64 t__2e704;
+	u64 t__2e706;
+	u64 t__2e734;
+	u64 t__2e735;
+	u64 t__2e736;
+	u64 t__2e737;
+	u64 t__2e738;
+	u64 t_abortsite_2e732;
+	u64 t_param_2e680;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e679:;
+	t_param_2e680 = (u64)A0;
+	*(u64 *)t_param_2e680 = (u64)t_x;
+	L_body_2e681:;
+	t__2e687 = (u64)(*(u64 *)t_param_2e680);
+	t__2e696 = (u64)(u32)(((i64)t__2e687 < (i64)((u64)0UL)));
+	if ((u32)t__2e696) goto L_switch_2elt_2e694; else goto L_switch_2ege_2e695;
+	L_switch_2elt_2e694:;
+	t__2e698 = (u64)(u32)(((u64)t__2e687 == (u64)((u64)9223372036854775808UL)));
+	if ((u32)t__2e698) goto L_matches_2e688; else goto L__2e697;
+	L__2e697:;
+	t__2e700 = (u64)(u32)(((u64)t__2e687 == (u64)((u64)18446744073709551615UL)));
+	if ((u32)t__2e700) goto L_matches_2e689; else goto L__2e699;
+	L__2e699:;
+	goto L_matches_2e693;
+	L_switch_2ege_2e695:;
+	t__2e702 = (u64)(u32)(((u64)t__2e687 == (u64)((u64)0UL)));
+	if ((u32)t__2e702) goto L_matches_2e690; else goto L__2e701;
+	L__2e701:;
+	t__2e704 = (u64)(u32)(((u64)t__2e687 == (u64)((u64)1UL)));
+	if ((u32)t__2e704) goto L_matches_2e691; else goto L__2e703;
+	L__2e703:;
+	t__2e706 = (u64)(u32)(((u64)t__2e687 == (u64)((u64)9223372036854775807UL)));
+	if ((u32)t__2e706) goto L_matches_2e692; else goto L__2e705;
+	L__2e705:;
+	goto L_matches_2e693;
+	L_matches_2e688:;
+	return (u32)((u64)1UL);
+	L__2e709:;
+	L__2e707:;
+	L__2e710:;
+	L_matches_2e689:;
+	return (u32)((u64)2UL);
+	L__2e713:;
+	L__2e711:;
+	L__2e714:;
+	L_matches_2e690:;
+	return (u32)((u64)3UL);
+	L__2e717:;
+	L__2e715:;
+	L__2e718:;
+	L_matches_2e691:;
+	return (u32)((u64)4UL);
+	L__2e721:;
+	L__2e719:;
+	L__2e722:;
+	L_matches_2e692:;
+	return (u32)((u64)5UL);
+	L__2e725:;
+	L__2e723:;
+	L__2e726:;
+	L_matches_2e693:;
+	return (u32)((u64)0UL);
+	L__2e729:;
+	L__2e727:;
+	L__2e730:;
+	L__2e686:;
+	t_abortsite_2e732 = ((u64)0UL);
+	goto L_abort_2e733;
+	L__2e685:;
+	L__2e739:;
+	L__2e682:;
+	L__2e740:;
+	return 0;
+	L_abort_2e733:;
+	t__2e734 = (u64)((u64)t_abortsite_2e732 * (u64)((u64)16UL));
+	t__2e734 = (u64)((u64)((u64)((char *)&D_abortsites_2e731)) + (u64)t__2e734);
+	t__2e735 = (u64)(*(u64 *)t__2e734);
+	t__2e736 = (u64)((u64)t__2e734 + (u64)((u64)8UL));
+	t__2e737 = (u64)(*(u32 *)t__2e736);
+	t__2e736 = (u64)((u64)t__2e734 + (u64)((u64)12UL));
+	t__2e738 = (u64)(*(u32 *)t__2e736);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e735, (u64)t__2e737, (u64)t__2e738, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u32 F_wide(u64 p_x) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e749;
+	u64 t__2e758;
+	u64 t__2e760;
+	u64 t__2e762;
+	u64 t__2e763;
+	u64 t__2e765;
+	u64 t__2e767;
+	u64 t__2e768;
+	u64 t__2e770;
+	u64 t__2e771;
+	u64 t__2e799;
+	u64 t__2e800;
+	u64 t__2e801;
+	u64 t__2e802;
+	u64 t__2e803;
+	u64 t_abortsite_2e797;
+	u64 t_param_2e742;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e741:;
+	t_param_2e742 = (u64)A0;
+	*(u64 *)t_param_2e742 = (u64)t_x;
+	L_body_2e743:;
+	t__2e749 = (u64)(*(u64 *)t_param_2e742);
+	t__2e758 = (u64)(u32)(((u64)t__2e749 < (u64)((u64)4294967296UL)));
+	if ((u32)t__2e758) goto L_switch_2elt_2e756; else goto L_switch_2ege_2e757;
+	L_switch_2elt_2e756:;
+	t__2e760 = (u64)(u32)(((u64)t__2e749 == (u64)((u64)0UL)));
+	if ((u32)t__2e760) goto L_matches_2e750; else goto L__2e759;
+	L__2e759:;
+	t__2e763 = (u64)((u64)t__2e749 - (u64)((u64)5UL));
+	t__2e762 = (u64)(u32)(((u64)t__2e763 <= (u64)((u64)1UL)));
+	if ((u32)t__2e762) goto L_matches_2e754; else goto L__2e761;
+	L__2e761:;
+	goto L_matches_2e755;
+	L_switch_2ege_2e757:;
+	t__2e765 = (u64)(u32)(((u64)t__2e749 == (u64)((u64)4294967296UL)));
+	if ((u32)t__2e765) goto L_matches_2e751; else goto L__2e764;
+	L__2e764:;
+	t__2e768 = (u64)((u64)t__2e749 - (u64)((u64)9223372036854775808UL));
+	t__2e767 = (u64)(u32)(((u64)t__2e768 <= (u64)((u64)1UL)));
+	if ((u32)t__2e767) goto L_matches_2e752; else goto L__2e766;
+	L__2e766:;
+	t__2e771 = (u64)((u64)t__2e749 - (u64)((u64)18446744073709551614UL));
+	t__2e770 = (u64)(u32)(((u64)t__2e771 <= (u64)((u64)1UL)));
+	if ((u32)t__2e770) goto L_matches_2e753; else goto L__2e769;
+	L__2e769:;
+	goto L_matches_2e755;
+	L_matches_2e750:;
+	return (u32)((u64)1UL);
+	L__2e774:;
+	L__2e772:;
+	L__2e775:;
+	L_matches_2e751:;
+	return (u32)((u64)2UL);
+	L__2e778:;
+	L__2e776:;
+	L__2e779:;
+	L_matches_2e752:;
+	return (u32)((u64)3UL);
+	L__2e782:;
+	L__2e780:;
+	L__2e783:;
+	L_matches_2e753:;
+	return (u32)((u64)4UL);
+	L__2e786:;
+	L__2e784:;
+	L__2e787:;
+	L_matches_2e754:;
+	return (u32)((u64)5UL);
+	L__2e790:;
+	L__2e788:;
+	L__2e791:;
+	L_matches_2e755:;
+	return (u32)((u64)0UL);
+	L__2e794:;
+	L__2e792:;
+	L__2e795:;
+	L__2e748:;
+	t_abortsite_2e797 = ((u64)0UL);
+	goto L_abort_2e798;
+	L__2e747:;
+	L__2e804:;
+	L__2e744:;
+	L__2e805:;
+	return 0;
+	L_abort_2e798:;
+	t__2e799 = (u64)((u64)t_abortsite_2e797 * (u64)((u64)16UL));
+	t__2e799 = (u64)((u64)((u64)((char *)&D_abortsites_2e796)) + (u64)t__2e799);
+	t__2e800 = (u64)(*(u64 *)t__2e799);
+	t__2e801 = (u64)((u64)t__2e799 + (u64)((u64)8UL));
+	t__2e802 = (u64)(*(u32 *)t__2e801);
+	t__2e801 = (u64)((u64)t__2e799 + (u64)((u64)12UL));
+	t__2e803 = (u64)(*(u32 *)t__2e801);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e800, (u64)t__2e802, (u64)t__2e803, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u32 F_unsigned(u32 p_x) {
+	char A0[1] __attribute__((aligned(16)));
+	u64 t__2e814;
+	u64 t__2e822;
+	u64 t__2e825;
+	u64 t__2e827;
+	u64 t__2e829;
+	u64 t__2e830;
+	u64 t__2e832;
+	u64 t__2e834;
+	u64 t__2e836;
+	u64 t__2e837;
+	u64 t__2e839;
+	u64 t__2e871;
+	u64 t__2e872;
+	u64 t__2e873;
+	u64 t__2e874;
+	u64 t__2e875;
+	u64 t_abortsite_2e869;
+	u64 t_param_2e807;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e806:;
+	t_param_2e807 = (u64)A0;
+	*(u8 *)t_param_2e807 = (u8)t_x;
+	L_body_2e808:;
+	t__2e814 = (u64)(u32)(*(u8 *)t_param_2e807);
+	t__2e822 = (u64)(u32)((u8)t__2e814);
+	t__2e825 = (u64)(u32)(((u32)t__2e822 < (u32)((u64)128UL)));
+	if ((u32)t__2e825) goto L_switch_2elt_2e823; else goto L_switch_2ege_2e824;
+	L_switch_2elt_2e823:;
+	t__2e827 = (u64)(u32)(((u32)t__2e822 == (u32)((u64)0UL)));
+	if ((u32)t__2e827) goto L_matches_2e815; else goto L__2e826;
+	L__2e826:;
+	t__2e830 = (u64)(u32)((u32)t__2e822 - (u32)((u64)1UL));
+	t__2e829 = (u64)(u32)(((u32)t__2e830 <= (u32)((u64)2UL)));
+	if ((u32)t__2e829) goto L_matches_2e816; else goto L__2e828;
+	L__2e828:;
+	t__2e832 = (u64)(u32)(((u32)t__2e822 == (u32)((u64)127UL)));
+	if ((u32)t__2e832) goto L_matches_2e817; else goto L__2e831;
+	L__2e831:;
+	goto L_matches_2e821;
+	L_switch_2ege_2e824:;
+	t__2e834 = (u64)(u32)(((u32)t__2e822 == (u32)((u64)128UL)));
+	if ((u32)t__2e834) goto L_matches_2e818; else goto L__2e833;
+	L__2e833:;
+	t__2e837 = (u64)(u32)((u32)t__2e822 - (u32)((u64)200UL));
+	t__2e836 = (u64)(u32)(((u32)t__2e837 <= (u32)((u64)2UL)));
+	if ((u32)t__2e836) goto L_matches_2e819; else goto L__2e835;
+	L__2e835:;
+	t__2e839 = (u64)(u32)(((u32)t__2e822 == (u32)((u64)255UL)));
+	if ((u32)t__2e839) goto L_matches_2e820; else goto L__2e838;
+	L__2e838:;
+	goto L_matches_2e821;
+	L_matches_2e815:;
+	return (u32)((u64)1UL);
+	L__2e842:;
+	L__2e840:;
+	L__2e843:;
+	L_matches_2e816:;
+	return (u32)((u64)2UL);
+	L__2e846:;
+	L__2e844:;
+	L__2e847:;
+	L_matches_2e817:;
+	return (u32)((u64)3UL);
+	L__2e850:;
+	L__2e848:;
+	L__2e851:;
+	L_matches_2e818:;
+	return (u32)((u64)4UL);
+	L__2e854:;
+	L__2e852:;
+	L__2e855:;
+	L_matches_2e819:;
+	return (u32)((u64)5UL);
+	L__2e858:;
+	L__2e856:;
+	L__2e859:;
+	L_matches_2e820:;
+	return (u32)((u64)6UL);
+	L__2e862:;
+	L__2e860:;
+	L__2e863:;
+	L_matches_2e821:;
+	return (u32)((u64)0UL);
+	L__2e866:;
+	L__2e864:;
+	L__2e867:;
+	L__2e813:;
+	t_abortsite_2e869 = ((u64)0UL);
+	goto L_abort_2e870;
+	L__2e812:;
+	L__2e876:;
+	L__2e809:;
+	L__2e877:;
+	return 0;
+	L_abort_2e870:;
+	t__2e871 = (u64)((u64)t_abortsite_2e869 * (u64)((u64)16UL));
+	t__2e871 = (u64)((u64)((u64)((char *)&D_abortsites_2e868)) + (u64)t__2e871);
+	t__2e872 = (u64)(*(u64 *)t__2e871);
+	t__2e873 = (u64)((u64)t__2e871 + (u64)((u64)8UL));
+	t__2e874 = (u64)(*(u32 *)t__2e873);
+	t__2e873 = (u64)((u64)t__2e871 + (u64)((u64)12UL));
+	t__2e875 = (u64)(*(u32 *)t__2e873);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e872, (u64)t__2e874, (u64)t__2e875, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u32 F_dense(u32 p_x) {
+	char A0[1] __attribute__((aligned(16)));
+	u64 t__2e886;
+	u64 t__2e895;
+	u64 t__2e898;
+	u64 t__2e901;
+	u64 t__2e903;
+	u64 t__2e905;
+	u64 t__2e906;
+	u64 t__2e908;
+	u64 t__2e910;
+	u64 t__2e912;
+	u64 t__2e914;
+	u64 t__2e917;
+	u64 t__2e919;
+	u64 t__2e921;
+	u64 t__2e923;
+	u64 t__2e925;
+	u64 t__2e926;
+	u64 t__2e928;
+	u64 t__2e930;
+	u64 t__2e931;
+	u64 t__2e967;
+	u64 t__2e968;
+	u64 t__2e969;
+	u64 t__2e970;
+	u64 t__2e971;
+	u64 t_abortsite_2e965;
+	u64 t_param_2e879;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e878:;
+	t_param_2e879 = (u64)A0;
+	*(u8 *)t_param_2e879 = (u8)t_x;
+	L_body_2e880:;
+	t__2e886 = (u64)(u32)(*(i8 *)t_param_2e879);
+	t__2e895 = (u64)(u32)((i64)(i8)t__2e886);
+	t__2e898 = (u64)(u32)(((i32)t__2e895 < (i32)((u64)4UL)));
+	if ((u32)t__2e898) goto L_switch_2elt_2e896; else goto L_switch_2ege_2e897;
+	L_switch_2elt_2e896:;
+	t__2e901 = (u64)(u32)(((i32)t__2e895 < (i32)((u64)1UL)));
+	if ((u32)t__2e901) goto L_switch_2elt_2e899; else goto L_switch_2ege_2e900;
+	L_switch_2elt_2e899:;
+	t__2e903 = (u64)(u32)(((u32)t__2e895 == (u32)((u64)4294967168UL)));
+	if ((u32)t__2e903) goto L_matches_2e887; else goto L__2e902;
+	L__2e902:;
+	t__2e906 = (u64)(u32)((u32)t__2e895 - (u32)((u64)4294967293UL));
+	t__2e905 = (u64)(u32)(((u32)t__2e906 <= (u32)((u64)2UL)));
+	if ((u32)t__2e905) goto L_matches_2e888; else goto L__2e904;
+	L__2e904:;
+	t__2e908 = (u64)(u32)(((u32)t__2e895 == (u32)((u64)0UL)));
+	if ((u32)t__2e908) goto L_matches_2e889; else goto L__2e907;
+	L__2e907:;
+	goto L_matches_2e894;
+	L_switch_2ege_2e900:;
+	t__2e910 = (u64)(u32)(((u32)t__2e895 == (u32)((u64)1UL)));
+	if ((u32)t__2e910) goto L_matches_2e890; else goto L__2e909;
+	L__2e909:;
+	t__2e912 = (u64)(u32)(((u32)t__2e895 == (u32)((u64)2UL)));
+	if ((u32)t__2e912) goto L_matches_2e889; else goto L__2e911;
+	L__2e911:;
+	t__2e914 = (u64)(u32)(((u32)t__2e895 == (u32)((u64)3UL)));
+	if ((u32)t__2e914) goto L_matches_2e890; else goto L__2e913;
+	L__2e913:;
+	goto L_matches_2e894;
+	L_switch_2ege_2e897:;
+	t__2e917 = (u64)(u32)(((i32)t__2e895 < (i32)((u64)7UL)));
+	if ((u32)t__2e917) goto L_switch_2elt_2e915; else goto L_switch_2ege_2e916;
+	L_switch_2elt_2e915:;
+	t__2e919 = (u64)(u32)(((u32)t__2e895 == (u32)((u64)4UL)));
+	if ((u32)t__2e919) goto L_matches_2e889; else goto L__2e918;
+	L__2e918:;
+	t__2e921 = (u64)(u32)(((u32)t__2e895 == (u32)((u64)5UL)));
+	if ((u32)t__2e921) goto L_matches_2e890; else goto L__2e920;
+	L__2e920:;
+	t__2e923 = (u64)(u32)(((u32)t__2e895 == (u32)((u64)6UL)));
+	if ((u32)t__2e923) goto L_matches_2e889; else goto L__2e922;
+	L__2e922:;
+	goto L_matches_2e894;
+	L_switch_2ege_2e916:;
+	t__2e926 = (u64)(u32)((u32)t__2e895 - (u32)((u64)7UL));
+	t__2e925 = (u64)(u32)(((u32)t__2e926 <= (u32)((u64)4UL)));
+	if ((u32)t__2e925) goto L_matches_2e891; else goto L__2e924;
+	L__2e924:;
+	t__2e928 = (u64)(u32)(((u32)t__2e895 == (u32)((u64)12UL)));
+	if ((u32)t__2e928) goto L_matches_2e892; else goto L__2e927;
+	L__2e927:;
+	t__2e931 = (u64)(u32)((u32)t__2e895 - (u32)((u64)126UL));
+	t__2e930 = (u64)(u32)(((u32)t__2e931 <= (u32)((u64)1UL)));
+	if ((u32)t__2e930) goto L_matches_2e893; else goto L__2e929;
+	L__2e929:;
+	goto L_matches_2e894;
+	L_matches_2e887:;
+	return (u32)((u64)1UL);
+	L__2e934:;
+	L__2e932:;
+	L__2e935:;
+	L_matches_2e888:;
+	return (u32)((u64)2UL);
+	L__2e938:;
+	L__2e936:;
+	L__2e939:;
+	L_matches_2e889:;
+	return (u32)((u64)3UL);
+	L__2e942:;
+	L__2e940:;
+	L__2e943:;
+	L_matches_2e890:;
+	return (u32)((u64)4UL);
+	L__2e946:;
+	L__2e944:;
+	L__2e947:;
+	L_matches_2e891:;
+	return (u32)((u64)5UL);
+	L__2e950:;
+	L__2e948:;
+	L__2e951:;
+	L_matches_2e892:;
+	return (u32)((u64)6UL);
+	L__2e954:;
+	L__2e952:;
+	L__2e955:;
+	L_matches_2e893:;
+	return (u32)((u64)7UL);
+	L__2e958:;
+	L__2e956:;
+	L__2e959:;
+	L_matches_2e894:;
+	return (u32)((u64)0UL);
+	L__2e962:;
+	L__2e960:;
+	L__2e963:;
+	L__2e885:;
+	t_abortsite_2e965 = ((u64)0UL);
+	goto L_abort_2e966;
+	L__2e884:;
+	L__2e972:;
+	L__2e881:;
+	L__2e973:;
+	return 0;
+	L_abort_2e966:;
+	t__2e967 = (u64)((u64)t_abortsite_2e965 * (u64)((u64)16UL));
+	t__2e967 = (u64)((u64)((u64)((char *)&D_abortsites_2e964)) + (u64)t__2e967);
+	t__2e968 = (u64)(*(u64 *)t__2e967);
+	t__2e969 = (u64)((u64)t__2e967 + (u64)((u64)8UL));
+	t__2e970 = (u64)(*(u32 *)t__2e969);
+	t__2e969 = (u64)((u64)t__2e967 + (u64)((u64)12UL));
+	t__2e971 = (u64)(*(u32 *)t__2e969);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e968, (u64)t__2e970, (u64)t__2e971, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u32 F_sparse(u32 p_x) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e1001;
+	u64 t__2e1003;
+	u64 t__2e1006;
+	u64 t__2e1008;
+	u64 t__2e1010;
+	u64 t__2e1012;
+	u64 t__2e1014;
+	u64 t__2e1016;
+	u64 t__2e1060;
+	u64 t__2e1061;
+	u64 t__2e1062;
+	u64 t__2e1063;
+	u64 t__2e1064;
+	u64 t__2e982;
+	u64 t__2e995;
+	u64 t__2e997;
+	u64 t__2e999;
+	u64 t_abortsite_2e1058;
+	u64 t_param_2e975;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e974:;
+	t_param_2e975 = (u64)A0;
+	*(u32 *)t_param_2e975 = (u32)t_x;
+	L_body_2e976:;
+	t__2e982 = (u64)(u32)(*(i32 *)t_param_2e975);
+	t__2e995 = (u64)(u32)(((i32)t__2e982 < (i32)((u64)17UL)));
+	if ((u32)t__2e995) goto L_switch_2elt_2e993; else goto L_switch_2ege_2e994;
+	L_switch_2elt_2e993:;
+	t__2e997 = (u64)(u32)(((u32)t__2e982 == (u32)((u64)4294966296UL)));
+	if ((u32)t__2e997) goto L_matches_2e983; else goto L__2e996;
+	L__2e996:;
+	t__2e999 = (u64)(u32)(((u32)t__2e982 == (u32)((u64)4294967289UL)));
+	if ((u32)t__2e999) goto L_matches_2e984; else goto L__2e998;
+	L__2e998:;
+	t__2e1001 = (u64)(u32)(((u32)t__2e982 == (u32)((u64)0UL)));
+	if ((u32)t__2e1001) goto L_matches_2e985; else goto L__2e1000;
+	L__2e1000:;
+	t__2e1003 = (u64)(u32)(((u32)t__2e982 == (u32)((u64)3UL)));
+	if ((u32)t__2e1003) goto L_matches_2e986; else goto L__2e1002;
+	L__2e1002:;
+	goto L_matches_2e992;
+	L_switch_2ege_2e994:;
+	t__2e1006 = (u64)(u32)(((i32)t__2e982 < (i32)((u64)1000UL)));
+	if ((u32)t__2e1006) goto L_switch_2elt_2e1004; else goto L_switch_2ege_2e1005;
+	L_switch_2elt_2e1004:;
+	t__2e1008 = (u64)(u32)(((u32)t__2e982 == (u32)((u64)17UL)));
+	if ((u32)t__2e1008) goto L_matches_2e987; else goto L__2e1007;
+	L__2e1007:;
+	t__2e1010 = (u64)(u32)(((u32)t__2e982 == (u32)((u64)100UL)));
+	if ((u32)t__2e1010) goto L_matches_2e988; else goto L__2e1009;
+	L__2e1009:;
+	goto L_matches_2e992;
+	L_switch_2ege_2e1005:;
+	t__2e1012 = (u64)(u32)(((u32)t__2e982 == (u32)((u64)1000UL)));
+	if ((u32)t__2e1012) goto L_matches_2e989; else goto L__2e1011;
+	L__2e1011:;
+	t__2e1014 = (u64)(u32)(((u32)t__2e982 == (u32)((u64)65536UL)));
+	if ((u32)t__2e1014) goto L_matches_2e990; else goto L__2e1013;
+	L__2e1013:;
+	t__2e1016 = (u64)(u32)(((u32)t__2e982 == (u32)((u64)2147483647UL)));
+	if ((u32)t__2e1016) goto L_matches_2e991; else goto L__2e1015;
+	L__2e1015:;
+	goto L_matches_2e992;
+	L_matches_2e983:;
+	return (u32)((u64)1UL);
+	L__2e1019:;
+	L__2e1017:;
+	L__2e1020:;
+	L_matches_2e984:;
+	return (u32)((u64)2UL);
+	L__2e1023:;
+	L__2e1021:;
+	L__2e1024:;
+	L_matches_2e985:;
+	return (u32)((u64)3UL);
+	L__2e1027:;
+	L__2e1025:;
+	L__2e1028:;
+	L_matches_2e986:;
+	return (u32)((u64)4UL);
+	L__2e1031:;
+	L__2e1029:;
+	L__2e1032:;
+	L_matches_2e987:;
+	return (u32)((u64)5UL);
+	L__2e1035:;
+	L__2e1033:;
+	L__2e1036:;
+	L_matches_2e988:;
+	return (u32)((u64)6UL);
+	L__2e1039:;
+	L__2e1037:;
+	L__2e1040:;
+	L_matches_2e989:;
+	return (u32)((u64)7UL);
+	L__2e1043:;
+	L__2e1041:;
+	L__2e1044:;
+	L_matches_2e990:;
+	return (u32)((u64)8UL);
+	L__2e1047:;
+	L__2e1045:;
+	L__2e1048:;
+	L_matches_2e991:;
+	return (u32)((u64)9UL);
+	L__2e1051:;
+	L__2e1049:;
+	L__2e1052:;
+	L_matches_2e992:;
+	return (u32)((u64)0UL);
+	L__2e1055:;
+	L__2e1053:;
+	L__2e1056:;
+	L__2e981:;
+	t_abortsite_2e1058 = ((u64)0UL);
+	goto L_abort_2e1059;
+	L__2e980:;
+	L__2e1065:;
+	L__2e977:;
+	L__2e1066:;
+	return 0;
+	L_abort_2e1059:;
+	t__2e1060 = (u64)((u64)t_abortsite_2e1058 * (u64)((u64)16UL));
+	t__2e1060 = (u64)((u64)((u64)((char *)&D_abortsites_2e1057)) + (u64)t__2e1060);
+	t__2e1061 = (u64)(*(u64 *)t__2e1060);
+	t__2e1062 = (u64)((u64)t__2e1060 + (u64)((u64)8UL));
+	t__2e1063 = (u64)(*(u32 *)t__2e1062);
+	t__2e1062 = (u64)((u64)t__2e1060 + (u64)((u64)12UL));
+	t__2e1064 = (u64)(*(u32 *)t__2e1062);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1061, (u64)t__2e1063, (u64)t__2e1064, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_label(void) {
+	u64 t__2e1077;
+	u64 t__2e1084;
+	u64 t__2e1092;
+	u64 t__2e1093;
+	u64 t__2e1094;
+	u64 t__2e1095;
+	u64 t__2e1096;
+	u64 t__2e1104;
+	u64 t__2e1108;
+	u64 t__2e1109;
+	u64 t__2e1110;
+	u64 t__2e1111;
+	u64 t__2e1112;
+	u64 t_abortsite_2e1090;
+	L_start_2e1067:;
+	L_body_2e1068:;
+	t__2e1077 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e1077) goto L_matches_2e1074; else goto L__2e1076;
+	L__2e1076:;
+	goto L_matches_2e1075;
+	L_matches_2e1074:;
+	t__2e1084 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e1084) goto L_true_2e1081; else goto L_false_2e1082;
+	L_true_2e1081:;
+	goto L__2e1078;
+	L__2e1087:;
+	L__2e1085:;
+	L__2e1088:;
+	L_false_2e1082:;
+	L__2e1083:;
+	t_abortsite_2e1090 = ((u64)0UL);
+	goto L_abort_2e1091;
+	L__2e1097:;
+	L__2e1078:;
+	goto L__2e1072;
+	L_matches_2e1075:;
+	t__2e1104 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e1104) goto L_true_2e1101; else goto L_false_2e1102;
+	L_true_2e1101:;
+	t_abortsite_2e1090 = ((u64)1UL);
+	goto L_abort_2e1091;
+	L__2e1105:;
+	L_false_2e1102:;
+	L__2e1103:;
+	goto L__2e1098;
+	L__2e1106:;
+	L__2e1098:;
+	goto L__2e1072;
+	L__2e1073:;
+	t_abortsite_2e1090 = ((u64)2UL);
+	goto L_abort_2e1107;
+	L__2e1072:;
+	goto L__2e1069;
+	L__2e1113:;
+	L__2e1069:;
+	return;
+	L_abort_2e1091:;
+	t__2e1092 = (u64)((u64)t_abortsite_2e1090 * (u64)((u64)16UL));
+	t__2e1092 = (u64)((u64)((u64)((char *)&D_abortsites_2e1089)) + (u64)t__2e1092);
+	t__2e1093 = (u64)(*(u64 *)t__2e1092);
+	t__2e1094 = (u64)((u64)t__2e1092 + (u64)((u64)8UL));
+	t__2e1095 = (u64)(*(u32 *)t__2e1094);
+	t__2e1094 = (u64)((u64)t__2e1092 + (u64)((u64)12UL));
+	t__2e1096 = (u64)(*(u32 *)t__2e1094);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1093, (u64)t__2e1095, (u64)t__2e1096, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1107:;
+	t__2e1108 = (u64)((u64)t_abortsite_2e1090 * (u64)((u64)16UL));
+	t__2e1108 = (u64)((u64)((u64)((char *)&D_abortsites_2e1089)) + (u64)t__2e1108);
+	t__2e1109 = (u64)(*(u64 *)t__2e1108);
+	t__2e1110 = (u64)((u64)t__2e1108 + (u64)((u64)8UL));
+	t__2e1111 = (u64)(*(u32 *)t__2e1110);
+	t__2e1110 = (u64)((u64)t__2e1108 + (u64)((u64)12UL));
+	t__2e1112 = (u64)(*(u32 *)t__2e1110);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1109, (u64)t__2e1111, (u64)t__2e1112, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_duplicates(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char B10[8] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char R13[4] __attribute__((aligned(16)));
+	char B14[8] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char B16[24] __attribute__((aligned(16)));
+	char R17[4] __attribute__((aligned(16)));
+	char B18[8] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	char R21[4] __attribute__((aligned(16)));
+	char B22[8] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char R25[4] __attribute__((aligned(16)));
+	char B26[8] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char R29[4] __attribute__((aligned(16)));
+	u64 t__2e1119;
+	u64 t__2e1125;
+	u64 t__2e1130;
+	u64 t__2e1139;
+	u64 t__2e1141;
+	u64 t__2e1145;
+	u64 t__2e1146;
+	u64 t__2e1147;
+	u64 t__2e1148;
+	u64 t__2e1149;
+	u64 t__2e1152;
+	u64 t__2e1153;
+	u64 t__2e1154;
+	u64 t__2e1155;
+	u64 t__2e1156;
+	u64 t__2e1158;
+	u64 t__2e1160;
+	u64 t__2e1164;
+	u64 t__2e1173;
+	u64 t__2e1175;
+	u64 t__2e1178;
+	u64 t__2e1180;
+	u64 t__2e1184;
+	u64 t__2e1193;
+	u64 t__2e1195;
+	u64 t__2e1198;
+	u64 t__2e1200;
+	u64 t__2e1204;
+	u64 t__2e1213;
+	u64 t__2e1215;
+	u64 t__2e1218;
+	u64 t__2e1220;
+	u64 t__2e1224;
+	u64 t__2e1233;
+	u64 t__2e1235;
+	u64 t_abortsite_2e1143;
+	u64 t_object_2e1121;
+	u64 t_object_2e1128;
+	u64 t_object_2e1159;
+	u64 t_object_2e1163;
+	u64 t_object_2e1179;
+	u64 t_object_2e1183;
+	u64 t_object_2e1199;
+	u64 t_object_2e1203;
+	u64 t_object_2e1219;
+	u64 t_object_2e1223;
+	u64 t_tag_2e1131;
+	u64 t_tag_2e1165;
+	u64 t_tag_2e1185;
+	u64 t_tag_2e1205;
+	u64 t_tag_2e1225;
+	L_start_2e1114:;
+	t_object_2e1121 = (u64)A0;
+	t_object_2e1128 = (u64)A1;
+	t_object_2e1159 = (u64)A2;
+	t_object_2e1163 = (u64)A3;
+	t_object_2e1179 = (u64)A4;
+	t_object_2e1183 = (u64)A5;
+	t_object_2e1199 = (u64)A6;
+	t_object_2e1203 = (u64)A7;
+	t_object_2e1219 = (u64)A8;
+	t_object_2e1223 = (u64)A9;
+	L_body_2e1115:;
+	*(u32 *)t_object_2e1121 = (u32)((u64)3532310079UL);
+	t__2e1125 = (u64)((u64)t_object_2e1121 + (u64)((u64)4UL));
+	*(u32 *)t__2e1125 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1128 = (u64)((u64)0UL);
+	t__2e1130 = (u64)((u64)t_object_2e1128 + (u64)((u64)8UL));
+	*(u64 *)t__2e1130 = (u64)((u64)0UL);
+	t__2e1130 = (u64)((u64)t__2e1130 + (u64)((u64)8UL));
+	*(u64 *)t__2e1130 = (u64)((u64)0UL);
+	BLIT((u64)B10, t_object_2e1121, 8);
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e1127)), 24);
+	BLIT((u64)B12, t_object_2e1128, 24);
+	t__2e1119 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R13, (u64)B10, (u64)B11, (u64)B12);
+	t_tag_2e1131 = (u64)(*(u32 *)t__2e1119);
+	t__2e1139 = (u64)(u32)(((u32)t_tag_2e1131 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1139) goto L_member_2e1136; else goto L__2e1138;
+	L__2e1138:;
+	t__2e1141 = (u64)(u32)(((u32)t_tag_2e1131 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1141) goto L_member_2e1137; else goto L__2e1140;
+	L__2e1140:;
+	goto L_matches_2e1135;
+	L_member_2e1136:;
+	goto L_matches_2e1135;
+	L_member_2e1137:;
+	goto L_matches_2e1134;
+	L_matches_2e1134:;
+	goto L__2e1132;
+	L_matches_2e1135:;
+	t_abortsite_2e1143 = ((u64)0UL);
+	goto L_abort_2e1144;
+	L__2e1150:;
+	L__2e1133:;
+	t_abortsite_2e1143 = ((u64)1UL);
+	goto L_abort_2e1151;
+	L__2e1132:;
+	*(u32 *)t_object_2e1159 = (u32)((u64)3532310079UL);
+	t__2e1160 = (u64)((u64)t_object_2e1159 + (u64)((u64)4UL));
+	*(u32 *)t__2e1160 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1163 = (u64)((u64)0UL);
+	t__2e1164 = (u64)((u64)t_object_2e1163 + (u64)((u64)8UL));
+	*(u64 *)t__2e1164 = (u64)((u64)0UL);
+	t__2e1164 = (u64)((u64)t__2e1164 + (u64)((u64)8UL));
+	*(u64 *)t__2e1164 = (u64)((u64)0UL);
+	BLIT((u64)B14, t_object_2e1159, 8);
+	BLIT((u64)B15, ((u64)((char *)&D_strliteral_2e1162)), 24);
+	BLIT((u64)B16, t_object_2e1163, 24);
+	t__2e1158 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R17, (u64)B14, (u64)B15, (u64)B16);
+	t_tag_2e1165 = (u64)(*(u32 *)t__2e1158);
+	t__2e1173 = (u64)(u32)(((u32)t_tag_2e1165 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1173) goto L_member_2e1170; else goto L__2e1172;
+	L__2e1172:;
+	t__2e1175 = (u64)(u32)(((u32)t_tag_2e1165 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1175) goto L_member_2e1171; else goto L__2e1174;
+	L__2e1174:;
+	goto L_matches_2e1169;
+	L_member_2e1170:;
+	goto L_matches_2e1169;
+	L_member_2e1171:;
+	goto L_matches_2e1168;
+	L_matches_2e1168:;
+	goto L__2e1166;
+	L_matches_2e1169:;
+	t_abortsite_2e1143 = ((u64)2UL);
+	goto L_abort_2e1144;
+	L__2e1176:;
+	L__2e1167:;
+	t_abortsite_2e1143 = ((u64)3UL);
+	goto L_abort_2e1151;
+	L__2e1166:;
+	*(u32 *)t_object_2e1179 = (u32)((u64)3532310079UL);
+	t__2e1180 = (u64)((u64)t_object_2e1179 + (u64)((u64)4UL));
+	*(u32 *)t__2e1180 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1183 = (u64)((u64)0UL);
+	t__2e1184 = (u64)((u64)t_object_2e1183 + (u64)((u64)8UL));
+	*(u64 *)t__2e1184 = (u64)((u64)0UL);
+	t__2e1184 = (u64)((u64)t__2e1184 + (u64)((u64)8UL));
+	*(u64 *)t__2e1184 = (u64)((u64)0UL);
+	BLIT((u64)B18, t_object_2e1179, 8);
+	BLIT((u64)B19, ((u64)((char *)&D_strliteral_2e1182)), 24);
+	BLIT((u64)B20, t_object_2e1183, 24);
+	t__2e1178 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R21, (u64)B18, (u64)B19, (u64)B20);
+	t_tag_2e1185 = (u64)(*(u32 *)t__2e1178);
+	t__2e1193 = (u64)(u32)(((u32)t_tag_2e1185 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1193) goto L_member_2e1190; else goto L__2e1192;
+	L__2e1192:;
+	t__2e1195 = (u64)(u32)(((u32)t_tag_2e1185 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1195) goto L_member_2e1191; else goto L__2e1194;
+	L__2e1194:;
+	goto L_matches_2e1189;
+	L_member_2e1190:;
+	goto L_matches_2e1189;
+	L_member_2e1191:;
+	goto L_matches_2e1188;
+	L_matches_2e1188:;
+	goto L__2e1186;
+	L_matches_2e1189:;
+	t_abortsite_2e1143 = ((u64)4UL);
+	goto L_abort_2e1144;
+	L__2e1196:;
+	L__2e1187:;
+	t_abortsite_2e1143 = ((u64)5UL);
+	goto L_abort_2e1151;
+	L__2e1186:;
+	*(u32 *)t_object_2e1199 = (u32)((u64)3532310079UL);
+	t__2e1200 = (u64)((u64)t_object_2e1199 + (u64)((u64)4UL));
+	*(u32 *)t__2e1200 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1203 = (u64)((u64)0UL);
+	t__2e1204 = (u64)((u64)t_object_2e1203 + (u64)((u64)8UL));
+	*(u64 *)t__2e1204 = (u64)((u64)0UL);
+	t__2e1204 = (u64)((u64)t__2e1204 + (u64)((u64)8UL));
+	*(u64 *)t__2e1204 = (u64)((u64)0UL);
+	BLIT((u64)B22, t_object_2e1199, 8);
+	BLIT((u64)B23, ((u64)((char *)&D_strliteral_2e1202)), 24);
+	BLIT((u64)B24, t_object_2e1203, 24);
+	t__2e1198 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R25, (u64)B22, (u64)B23, (u64)B24);
+	t_tag_2e1205 = (u64)(*(u32 *)t__2e1198);
+	t__2e1213 = (u64)(u32)(((u32)t_tag_2e1205 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1213) goto L_member_2e1210; else goto L__2e1212;
+	L__2e1212:;
+	t__2e1215 = (u64)(u32)(((u32)t_tag_2e1205 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1215) goto L_member_2e1211; else goto L__2e1214;
+	L__2e1214:;
+	goto L_matches_2e1209;
+	L_member_2e1210:;
+	goto L_matches_2e1209;
+	L_member_2e1211:;
+	goto L_matches_2e1208;
+	L_matches_2e1208:;
+	goto L__2e1206;
+	L_matches_2e1209:;
+	t_abortsite_2e1143 = ((u64)6UL);
+	goto L_abort_2e1144;
+	L__2e1216:;
+	L__2e1207:;
+	t_abortsite_2e1143 = ((u64)7UL);
+	goto L_abort_2e1151;
+	L__2e1206:;
+	*(u32 *)t_object_2e1219 = (u32)((u64)3532310079UL);
+	t__2e1220 = (u64)((u64)t_object_2e1219 + (u64)((u64)4UL));
+	*(u32 *)t__2e1220 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1223 = (u64)((u64)0UL);
+	t__2e1224 = (u64)((u64)t_object_2e1223 + (u64)((u64)8UL));
+	*(u64 *)t__2e1224 = (u64)((u64)0UL);
+	t__2e1224 = (u64)((u64)t__2e1224 + (u64)((u64)8UL));
+	*(u64 *)t__2e1224 = (u64)((u64)0UL);
+	BLIT((u64)B26, t_object_2e1219, 8);
+	BLIT((u64)B27, ((u64)((char *)&D_strliteral_2e1222)), 24);
+	BLIT((u64)B28, t_object_2e1223, 24);
+	t__2e1218 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R29, (u64)B26, (u64)B27, (u64)B28);
+	t_tag_2e1225 = (u64)(*(u32 *)t__2e1218);
+	t__2e1233 = (u64)(u32)(((u32)t_tag_2e1225 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1233) goto L_member_2e1230; else goto L__2e1232;
+	L__2e1232:;
+	t__2e1235 = (u64)(u32)(((u32)t_tag_2e1225 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1235) goto L_member_2e1231; else goto L__2e1234;
+	L__2e1234:;
+	goto L_matches_2e1229;
+	L_member_2e1230:;
+	goto L_matches_2e1229;
+	L_member_2e1231:;
+	goto L_matches_2e1228;
+	L_matches_2e1228:;
+	goto L__2e1226;
+	L_matches_2e1229:;
+	t_abortsite_2e1143 = ((u64)8UL);
+	goto L_abort_2e1144;
+	L__2e1236:;
+	L__2e1227:;
+	t_abortsite_2e1143 = ((u64)9UL);
+	goto L_abort_2e1151;
+	L__2e1226:;
+	goto L__2e1116;
+	L__2e1237:;
+	L__2e1116:;
+	return;
+	L_abort_2e1144:;
+	t__2e1145 = (u64)((u64)t_abortsite_2e1143 * (u64)((u64)16UL));
+	t__2e1145 = (u64)((u64)((u64)((char *)&D_abortsites_2e1142)) + (u64)t__2e1145);
+	t__2e1146 = (u64)(*(u64 *)t__2e1145);
+	t__2e1147 = (u64)((u64)t__2e1145 + (u64)((u64)8UL));
+	t__2e1148 = (u64)(*(u32 *)t__2e1147);
+	t__2e1147 = (u64)((u64)t__2e1145 + (u64)((u64)12UL));
+	t__2e1149 = (u64)(*(u32 *)t__2e1147);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1146, (u64)t__2e1148, (u64)t__2e1149, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e1151:;
+	t__2e1152 = (u64)((u64)t_abortsite_2e1143 * (u64)((u64)16UL));
+	t__2e1152 = (u64)((u64)((u64)((char *)&D_abortsites_2e1142)) + (u64)t__2e1152);
+	t__2e1153 = (u64)(*(u64 *)t__2e1152);
+	t__2e1154 = (u64)((u64)t__2e1152 + (u64)((u64)8UL));
+	t__2e1155 = (u64)(*(u32 *)t__2e1154);
+	t__2e1154 = (u64)((u64)t__2e1152 + (u64)((u64)12UL));
+	t__2e1156 = (u64)(*(u32 *)t__2e1154);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1153, (u64)t__2e1155, (u64)t__2e1156, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_exhaustivity(void) {
+	char A0[4096] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[1] __attribute__((aligned(16)));
+	char A3[1] __attribute__((aligned(16)));
+	char A4[1] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char R12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char R14[24] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char R16[24] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char R18[24] __attribute__((aligned(16)));
+	char B19[8] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char R22[4] __attribute__((aligned(16)));
+	char B23[8] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	char R26[4] __attribute__((aligned(16)));
+	char B27[8] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char R30[4] __attribute__((aligned(16)));
+	u64 t__2e1247;
+	u64 t__2e1248;
+	u64 t__2e1249;
+	u64 t__2e1256;
+	u64 t__2e1257;
+	u64 t__2e1258;
+	u64 t__2e1264;
+	u64 t__2e1265;
+	u64 t__2e1266;
+	u64 t__2e1267;
+	u64 t__2e1268;
+	u64 t__2e1273;
+	u64 t__2e1274;
+	u64 t__2e1275;
+	u64 t__2e1276;
+	u64 t__2e1277;
+	u64 t__2e1284;
+	u64 t__2e1286;
+	u64 t__2e1287;
+	u64 t__2e1301;
+	u64 t__2e1302;
+	u64 t__2e1316;
+	u64 t__2e1318;
+	u64 t__2e1332;
+	u64 t__2e1334;
+	u64 t__2e1345;
+	u64 t__2e1346;
+	u64 t__2e1349;
+	u64 t__2e1350;
+	u64 t__2e1351;
+	u64 t__2e1352;
+	u64 t__2e1355;
+	u64 t__2e1359;
+	u64 t__2e1360;
+	u64 t__2e1361;
+	u64 t__2e1362;
+	u64 t__2e1363;
+	u64 t__2e1366;
+	u64 t__2e1367;
+	u64 t__2e1368;
+	u64 t__2e1369;
+	u64 t__2e1370;
+	u64 t__2e1373;
+	u64 t__2e1374;
+	u64 t__2e1375;
+	u64 t__2e1376;
+	u64 t__2e1377;
+	u64 t__2e1380;
+	u64 t__2e1381;
+	u64 t__2e1382;
+	u64 t__2e1383;
+	u64 t__2e1390;
+	u64 t__2e1391;
+	u64 t__2e1392;
+	u64 t__2e1393;
+	u64 t__2e1402;
+	u64 t__2e1403;
+	u64 t__2e1404;
+	u64 t__2e1405;
+	u64 t__2e1414;
+	u64 t__2e1415;
+	u64 t__2e1416;
+	u64 t__2e1417;
+	u64 t__2e1424;
+	u64 t__2e1427;
+	u64 t__2e1430;
+	u64 t__2e1431;
+	u64 t__2e1432;
+	u64 t__2e1433;
+	u64 t__2e1434;
+	u64 t__2e1435;
+	u64 t__2e1436;
+	u64 t__2e1437;
+	u64 t__2e1438;
+	u64 t__2e1439;
+	u64 t__2e1440;
+	u64 t__2e1441;
+	u64 t__2e1442;
+	u64 t__2e1447;
+	u64 t__2e1448;
+	u64 t__2e1449;
+	u64 t__2e1450;
+	u64 t__2e1453;
+	u64 t__2e1454;
+	u64 t__2e1455;
+	u64 t__2e1456;
+	u64 t__2e1457;
+	u64 t__2e1460;
+	u64 t__2e1461;
+	u64 t__2e1462;
+	u64 t__2e1463;
+	u64 t__2e1468;
+	u64 t__2e1469;
+	u64 t__2e1470;
+	u64 t__2e1471;
+	u64 t__2e1472;
+	u64 t__2e1475;
+	u64 t__2e1476;
+	u64 t__2e1477;
+	u64 t__2e1478;
+	u64 t__2e1479;
+	u64 t__2e1480;
+	u64 t__2e1481;
+	u64 t__2e1484;
+	u64 t__2e1485;
+	u64 t__2e1486;
+	u64 t__2e1492;
+	u64 t__2e1495;
+	u64 t__2e1496;
+	u64 t__2e1497;
+	u64 t__2e1498;
+	u64 t__2e1499;
+	u64 t__2e1500;
+	u64 t__2e1501;
+	u64 t__2e1502;
+	u64 t__2e1503;
+	u64 t__2e1506;
+	u64 t__2e1507;
+	u64 t__2e1508;
+	u64 t__2e1509;
+	u64 t__2e1510;
+	u64 t__2e1511;
+	u64 t__2e1512;
+	u64 t__2e1515;
+	u64 t__2e1516;
+	u64 t__2e1517;
+	u64 t__2e1519;
+	u64 t__2e1520;
+	u64 t__2e1521;
+	u64 t__2e1522;
+	u64 t__2e1523;
+	u64 t__2e1524;
+	u64 t__2e1525;
+	u64 t__2e1528;
+	u64 t__2e1529;
+	u64 t__2e1530;
+	u64 t__2e1531;
+	u64 t__2e1532;
+	u64 t__2e1533;
+	u64 t__2e1534;
+	u64 t__2e1537;
+	u64 t__2e1538;
+	u64 t__2e1539;
+	u64 t__2e1540;
+	u64 t__2e1541;
+	u64 t__2e1544;
+	u64 t__2e1545;
+	u64 t__2e1546;
+	u64 t__2e1547;
+	u64 t__2e1549;
+	u64 t__2e1551;
+	u64 t__2e1553;
+	u64 t__2e1554;
+	u64 t__2e1555;
+	u64 t__2e1556;
+	u64 t__2e1557;
+	u64 t__2e1560;
+	u64 t__2e1561;
+	u64 t__2e1562;
+	u64 t__2e1563;
+	u64 t__2e1564;
+	u64 t__2e1567;
+	u64 t__2e1568;
+	u64 t__2e1569;
+	u64 t__2e1570;
+	u64 t__2e1572;
+	u64 t__2e1574;
+	u64 t__2e1576;
+	u64 t__2e1585;
+	u64 t__2e1587;
+	u64 t__2e1589;
+	u64 t__2e1590;
+	u64 t__2e1591;
+	u64 t__2e1592;
+	u64 t__2e1593;
+	u64 t__2e1596;
+	u64 t__2e1598;
+	u64 t__2e1602;
+	u64 t__2e1611;
+	u64 t__2e1613;
+	u64 t__2e1616;
+	u64 t__2e1618;
+	u64 t__2e1622;
+	u64 t__2e1631;
+	u64 t__2e1633;
+	u64 t_abortsite_2e1262;
+	u64 t_binding_2e1342;
+	u64 t_binding_2e1348;
+	u64 t_binding_2e1389;
+	u64 t_binding_2e1401;
+	u64 t_binding_2e1413;
+	u64 t_data_2e1364;
+	u64 t_item_2e1344;
+	u64 t_item_2e1347;
+	u64 t_object_2e1573;
+	u64 t_object_2e1575;
+	u64 t_object_2e1597;
+	u64 t_object_2e1601;
+	u64 t_object_2e1617;
+	u64 t_object_2e1621;
+	u64 t_tag_2e1577;
+	u64 t_tag_2e1603;
+	u64 t_tag_2e1623;
+	L_start_2e1238:;
+	t_binding_2e1342 = (u64)A0;
+	t_binding_2e1348 = (u64)A1;
+	t_binding_2e1389 = (u64)A2;
+	t_binding_2e1401 = (u64)A3;
+	t_binding_2e1413 = (u64)A4;
+	t_object_2e1573 = (u64)A5;
+	t_object_2e1575 = (u64)A6;
+	t_object_2e1597 = (u64)A7;
+	t_object_2e1601 = (u64)A8;
+	t_object_2e1617 = (u64)A9;
+	t_object_2e1621 = (u64)A10;
+	L_body_2e1239:;
+	t__2e1248 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1249 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1247 = (u64)(u32)(((u32)t__2e1248 == (u32)t__2e1249));
+	if ((u32)t__2e1247) goto L_matches_2e1244; else goto L__2e1246;
+	L__2e1246:;
+	goto L_next_2e1245;
+	L_matches_2e1244:;
+	goto L__2e1250;
+	L__2e1252:;
+	L__2e1250:;
+	goto L__2e1243;
+	L_next_2e1245:;
+	t__2e1257 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1258 = (u64)(u32)((u8)((u64)0UL));
+	t__2e1256 = (u64)(u32)(((u32)t__2e1257 == (u32)t__2e1258));
+	if ((u32)t__2e1256) goto L_matches_2e1253; else goto L__2e1255;
+	L__2e1255:;
+	goto L_next_2e1254;
+	L_matches_2e1253:;
+	t_abortsite_2e1262 = ((u64)0UL);
+	goto L_abort_2e1263;
+	L__2e1269:;
+	L__2e1259:;
+	L__2e1270:;
+	L_next_2e1254:;
+	L__2e1271:;
+	t_abortsite_2e1262 = ((u64)1UL);
+	goto L_abort_2e1272;
+	L__2e1243:;
+	t__2e1284 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e1284) goto L_matches_2e1281; else goto L__2e1283;
+	L__2e1283:;
+	t__2e1287 = (u64)(u32)((u32)((u64)0UL) - (u32)((u64)1UL));
+	t__2e1286 = (u64)(u32)(((u32)t__2e1287 <= (u32)((u64)1UL)));
+	if ((u32)t__2e1286) goto L_matches_2e1282; else goto L__2e1285;
+	L__2e1285:;
+	goto L__2e1280;
+	L_matches_2e1281:;
+	goto L__2e1288;
+	L__2e1290:;
+	L__2e1288:;
+	goto L__2e1279;
+	L_matches_2e1282:;
+	t_abortsite_2e1262 = ((u64)2UL);
+	goto L_abort_2e1263;
+	L__2e1293:;
+	L__2e1291:;
+	L__2e1294:;
+	L__2e1280:;
+	t_abortsite_2e1262 = ((u64)3UL);
+	goto L_abort_2e1272;
+	L__2e1279:;
+	t__2e1302 = (u64)(u32)((u32)((u64)0UL) - (u32)((u64)1UL));
+	t__2e1301 = (u64)(u32)(((u32)t__2e1302 <= (u32)((u64)1UL)));
+	if ((u32)t__2e1301) goto L_matches_2e1298; else goto L__2e1300;
+	L__2e1300:;
+	goto L_matches_2e1299;
+	L_matches_2e1298:;
+	t_abortsite_2e1262 = ((u64)4UL);
+	goto L_abort_2e1263;
+	L__2e1305:;
+	L__2e1303:;
+	L__2e1306:;
+	L_matches_2e1299:;
+	goto L__2e1307;
+	L__2e1309:;
+	L__2e1307:;
+	goto L__2e1296;
+	L__2e1297:;
+	t_abortsite_2e1262 = ((u64)5UL);
+	goto L_abort_2e1272;
+	L__2e1296:;
+	t__2e1316 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e1316) goto L_matches_2e1313; else goto L__2e1315;
+	L__2e1315:;
+	t__2e1318 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	if ((u32)t__2e1318) goto L_matches_2e1314; else goto L__2e1317;
+	L__2e1317:;
+	goto L__2e1312;
+	L_matches_2e1313:;
+	t_abortsite_2e1262 = ((u64)6UL);
+	goto L_abort_2e1263;
+	L__2e1321:;
+	L__2e1319:;
+	L__2e1322:;
+	L_matches_2e1314:;
+	goto L__2e1323;
+	L__2e1325:;
+	L__2e1323:;
+	goto L__2e1311;
+	L__2e1312:;
+	t_abortsite_2e1262 = ((u64)7UL);
+	goto L_abort_2e1272;
+	L__2e1311:;
+	t__2e1332 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e1332) goto L_matches_2e1329; else goto L__2e1331;
+	L__2e1331:;
+	t__2e1334 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	if ((u32)t__2e1334) goto L_matches_2e1330; else goto L__2e1333;
+	L__2e1333:;
+	goto L__2e1328;
+	L_matches_2e1329:;
+	t_abortsite_2e1262 = ((u64)8UL);
+	goto L_abort_2e1263;
+	L__2e1337:;
+	L__2e1335:;
+	L__2e1338:;
+	L_matches_2e1330:;
+	goto L__2e1339;
+	L__2e1341:;
+	L__2e1339:;
+	goto L__2e1327;
+	L__2e1328:;
+	t_abortsite_2e1262 = ((u64)9UL);
+	goto L_abort_2e1272;
+	L__2e1327:;
+	t_item_2e1344 = (u64)((u64)t_binding_2e1342 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e1344 = (u8)((u64)0UL);
+	t__2e1345 = (u64)((u64)t_binding_2e1342 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e1345, (u64)t_item_2e1344, (u64)((u64)4095UL));
+	t_item_2e1347 = (u64)((u64)t_binding_2e1342 + (u64)((u64)0UL));
+	t__2e1346 = (u64)((u64)t_binding_2e1342 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e1346, (u64)t_item_2e1347, (u64)((u64)4095UL));
+	t__2e1349 = t_binding_2e1342;
+	t__2e1350 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1351 = (u64)((u64)t__2e1350 - (u64)((u64)0UL));
+	t__2e1355 = (u64)(u32)(((u64)t__2e1350 <= (u64)((u64)4096UL)));
+	t__2e1351 = t__2e1350;
+	t__2e1352 = ((u64)4096UL);
+	if ((u32)t__2e1355) goto L__2e1357; else goto L__2e1356;
+	L__2e1356:;
+	t_abortsite_2e1262 = ((u64)10UL);
+	goto L_abort_2e1358;
+	L__2e1357:;
+	t_data_2e1364 = (u64)((u64)((u64)0UL) * (u64)((u64)1UL));
+	t_data_2e1364 = (u64)((u64)t__2e1349 + (u64)t_data_2e1364);
+	*(u64 *)t_binding_2e1348 = (u64)t_data_2e1364;
+	t__2e1366 = (u64)((u64)t_binding_2e1348 + (u64)((u64)8UL));
+	*(u64 *)t__2e1366 = (u64)t__2e1351;
+	t__2e1366 = (u64)((u64)t_binding_2e1348 + (u64)((u64)16UL));
+	*(u64 *)t__2e1366 = (u64)t__2e1352;
+	t__2e1367 = (u64)((u64)t_binding_2e1348 + (u64)((u64)8UL));
+	t__2e1368 = (u64)((u64)t_binding_2e1348 + (u64)((u64)16UL));
+	t__2e1369 = (u64)(*(u64 *)t__2e1367);
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e1372)), 24);
+	t__2e1370 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R12, (u64)B11);
+	t__2e1374 = (u64)((u64)t__2e1370 + (u64)((u64)8UL));
+	t__2e1373 = (u64)(*(u64 *)t__2e1374);
+	t__2e1375 = (u64)((u64)t__2e1369 + (u64)t__2e1373);
+	*(u64 *)t__2e1367 = (u64)t__2e1375;
+	t__2e1377 = (u64)(*(u64 *)t__2e1368);
+	t__2e1380 = (u64)(u32)(((u64)t__2e1375 <= (u64)t__2e1377));
+	if ((u32)t__2e1380) goto L__2e1378; else goto L__2e1379;
+	L__2e1379:;
+	t_abortsite_2e1262 = ((u64)11UL);
+	goto L_abort_2e1358;
+	L__2e1378:;
+	t__2e1381 = (u64)(*(u64 *)t_binding_2e1348);
+	t__2e1376 = (u64)((u64)t__2e1369 * (u64)((u64)1UL));
+	t__2e1376 = (u64)((u64)t__2e1381 + (u64)t__2e1376);
+	t__2e1382 = (u64)((u64)t__2e1373 * (u64)((u64)1UL));
+	t__2e1383 = (u64)(*(u64 *)t__2e1370);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1376, (u64)t__2e1383, (u64)t__2e1382);
+	*(u8 *)t_binding_2e1389 = (u8)((u64)48UL);
+	L_loop_2e1384:;
+	t__2e1391 = (u64)(u32)(*(u8 *)t_binding_2e1389);
+	t__2e1392 = (u64)(u32)((u8)t__2e1391);
+	t__2e1393 = (u64)(u32)((u8)((u64)50UL));
+	t__2e1390 = (u64)(u32)(((u32)t__2e1392 <= (u32)t__2e1393));
+	if ((u32)t__2e1390) goto L_body_2e1385; else goto L__2e1387;
+	L_body_2e1385:;
+	*(u8 *)t_binding_2e1401 = (u8)((u64)48UL);
+	L_loop_2e1396:;
+	t__2e1403 = (u64)(u32)(*(u8 *)t_binding_2e1401);
+	t__2e1404 = (u64)(u32)((u8)t__2e1403);
+	t__2e1405 = (u64)(u32)((u8)((u64)57UL));
+	t__2e1402 = (u64)(u32)(((u32)t__2e1404 <= (u32)t__2e1405));
+	if ((u32)t__2e1402) goto L_body_2e1397; else goto L__2e1399;
+	L_body_2e1397:;
+	*(u8 *)t_binding_2e1413 = (u8)((u64)48UL);
+	L_loop_2e1408:;
+	t__2e1415 = (u64)(u32)(*(u8 *)t_binding_2e1413);
+	t__2e1416 = (u64)(u32)((u8)t__2e1415);
+	t__2e1417 = (u64)(u32)((u8)((u64)57UL));
+	t__2e1414 = (u64)(u32)(((u32)t__2e1416 <= (u32)t__2e1417));
+	if ((u32)t__2e1414) goto L_body_2e1409; else goto L__2e1411;
+	L_body_2e1409:;
+	t__2e1431 = (u64)(u32)(*(u8 *)t_binding_2e1389);
+	t__2e1432 = (u64)(u32)((u8)t__2e1431);
+	t__2e1433 = (u64)(u32)((u8)((u64)50UL));
+	t__2e1430 = (u64)(u32)(((u32)t__2e1432 == (u32)t__2e1433));
+	t__2e1427 = (u64)(u32)t__2e1430;
+	if ((u32)t__2e1427) goto L__2e1428; else goto L__2e1429;
+	L__2e1428:;
+	t__2e1435 = (u64)(u32)(*(u8 *)t_binding_2e1401);
+	t__2e1436 = (u64)(u32)((u8)t__2e1435);
+	t__2e1437 = (u64)(u32)((u8)((u64)53UL));
+	t__2e1434 = (u64)(u32)(((u32)t__2e1436 == (u32)t__2e1437));
+	t__2e1427 = (u64)(u32)t__2e1434;
+	goto L__2e1429;
+	L__2e1429:;
+	t__2e1424 = (u64)(u32)t__2e1427;
+	if ((u32)t__2e1424) goto L__2e1425; else goto L__2e1426;
+	L__2e1425:;
+	t__2e1439 = (u64)(u32)(*(u8 *)t_binding_2e1413);
+	t__2e1440 = (u64)(u32)((u8)t__2e1439);
+	t__2e1441 = (u64)(u32)((u8)((u64)54UL));
+	t__2e1438 = (u64)(u32)(((u32)t__2e1440 == (u32)t__2e1441));
+	t__2e1424 = (u64)(u32)t__2e1438;
+	goto L__2e1426;
+	L__2e1426:;
+	t__2e1442 = (u64)(u32)((u8)t__2e1424);
+	if ((u32)t__2e1442) goto L_true_2e1421; else goto L_false_2e1422;
+	L_true_2e1421:;
+	goto L__2e1387;
+	L__2e1445:;
+	L__2e1443:;
+	L__2e1446:;
+	L_false_2e1422:;
+	L__2e1423:;
+	t__2e1447 = (u64)((u64)t_binding_2e1348 + (u64)((u64)8UL));
+	t__2e1448 = (u64)((u64)t_binding_2e1348 + (u64)((u64)16UL));
+	t__2e1449 = (u64)(*(u64 *)t__2e1447);
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e1452)), 24);
+	t__2e1450 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R14, (u64)B13);
+	t__2e1454 = (u64)((u64)t__2e1450 + (u64)((u64)8UL));
+	t__2e1453 = (u64)(*(u64 *)t__2e1454);
+	t__2e1455 = (u64)((u64)t__2e1449 + (u64)t__2e1453);
+	*(u64 *)t__2e1447 = (u64)t__2e1455;
+	t__2e1457 = (u64)(*(u64 *)t__2e1448);
+	t__2e1460 = (u64)(u32)(((u64)t__2e1455 <= (u64)t__2e1457));
+	if ((u32)t__2e1460) goto L__2e1458; else goto L__2e1459;
+	L__2e1459:;
+	t_abortsite_2e1262 = ((u64)12UL);
+	goto L_abort_2e1358;
+	L__2e1458:;
+	t__2e1461 = (u64)(*(u64 *)t_binding_2e1348);
+	t__2e1456 = (u64)((u64)t__2e1449 * (u64)((u64)1UL));
+	t__2e1456 = (u64)((u64)t__2e1461 + (u64)t__2e1456);
+	t__2e1462 = (u64)((u64)t__2e1453 * (u64)((u64)1UL));
+	t__2e1463 = (u64)(*(u64 *)t__2e1450);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1456, (u64)t__2e1463, (u64)t__2e1462);
+	t__2e1469 = (u64)(u32)(*(u8 *)t_binding_2e1389);
+	t__2e1470 = (u64)(u32)((u8)t__2e1469);
+	t__2e1471 = (u64)(u32)((u8)((u64)48UL));
+	t__2e1468 = (u64)(u32)(((u32)t__2e1470 != (u32)t__2e1471));
+	t__2e1472 = (u64)(u32)((u8)t__2e1468);
+	if ((u32)t__2e1472) goto L_true_2e1465; else goto L_false_2e1466;
+	L_true_2e1465:;
+	t__2e1475 = (u64)((u64)t_binding_2e1348 + (u64)((u64)8UL));
+	t__2e1476 = (u64)((u64)t_binding_2e1348 + (u64)((u64)16UL));
+	t__2e1477 = (u64)(*(u64 *)t__2e1475);
+	t__2e1478 = (u64)(u32)(*(u8 *)t_binding_2e1389);
+	t__2e1479 = (u64)((u64)t__2e1477 + (u64)((u64)1UL));
+	*(u64 *)t__2e1475 = (u64)t__2e1479;
+	t__2e1481 = (u64)(*(u64 *)t__2e1476);
+	t__2e1484 = (u64)(u32)(((u64)t__2e1479 <= (u64)t__2e1481));
+	if ((u32)t__2e1484) goto L__2e1482; else goto L__2e1483;
+	L__2e1483:;
+	t_abortsite_2e1262 = ((u64)13UL);
+	goto L_abort_2e1358;
+	L__2e1482:;
+	t__2e1485 = (u64)(*(u64 *)t_binding_2e1348);
+	t__2e1480 = (u64)((u64)t__2e1477 * (u64)((u64)1UL));
+	t__2e1480 = (u64)((u64)t__2e1485 + (u64)t__2e1480);
+	t__2e1486 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	*(u8 *)t__2e1480 = (u8)t__2e1478;
+	goto L__2e1473;
+	L__2e1487:;
+	L__2e1473:;
+	goto L__2e1467;
+	L_false_2e1466:;
+	L__2e1467:;
+	t__2e1496 = (u64)(u32)(*(u8 *)t_binding_2e1389);
+	t__2e1497 = (u64)(u32)((u8)t__2e1496);
+	t__2e1498 = (u64)(u32)((u8)((u64)48UL));
+	t__2e1495 = (u64)(u32)(((u32)t__2e1497 != (u32)t__2e1498));
+	t__2e1492 = (u64)(u32)t__2e1495;
+	if ((u32)t__2e1492) goto L__2e1494; else goto L__2e1493;
+	L__2e1493:;
+	t__2e1500 = (u64)(u32)(*(u8 *)t_binding_2e1401);
+	t__2e1501 = (u64)(u32)((u8)t__2e1500);
+	t__2e1502 = (u64)(u32)((u8)((u64)48UL));
+	t__2e1499 = (u64)(u32)(((u32)t__2e1501 != (u32)t__2e1502));
+	t__2e1492 = (u64)(u32)t__2e1499;
+	goto L__2e1494;
+	L__2e1494:;
+	t__2e1503 = (u64)(u32)((u8)t__2e1492);
+	if ((u32)t__2e1503) goto L_true_2e1489; else goto L_false_2e1490;
+	L_true_2e1489:;
+	t__2e1506 = (u64)((u64)t_binding_2e1348 + (u64)((u64)8UL));
+	t__2e1507 = (u64)((u64)t_binding_2e1348 + (u64)((u64)16UL));
+	t__2e1508 = (u64)(*(u64 *)t__2e1506);
+	t__2e1509 = (u64)(u32)(*(u8 *)t_binding_2e1401);
+	t__2e1510 = (u64)((u64)t__2e1508 + (u64)((u64)1UL));
+	*(u64 *)t__2e1506 = (u64)t__2e1510;
+	t__2e1512 = (u64)(*(u64 *)t__2e1507);
+	t__2e1515 = (u64)(u32)(((u64)t__2e1510 <= (u64)t__2e1512));
+	if ((u32)t__2e1515) goto L__2e1513; else goto L__2e1514;
+	L__2e1514:;
+	t_abortsite_2e1262 = ((u64)14UL);
+	goto L_abort_2e1358;
+	L__2e1513:;
+	t__2e1516 = (u64)(*(u64 *)t_binding_2e1348);
+	t__2e1511 = (u64)((u64)t__2e1508 * (u64)((u64)1UL));
+	t__2e1511 = (u64)((u64)t__2e1516 + (u64)t__2e1511);
+	t__2e1517 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	*(u8 *)t__2e1511 = (u8)t__2e1509;
+	goto L__2e1504;
+	L__2e1518:;
+	L__2e1504:;
+	goto L__2e1491;
+	L_false_2e1490:;
+	L__2e1491:;
+	t__2e1519 = (u64)((u64)t_binding_2e1348 + (u64)((u64)8UL));
+	t__2e1520 = (u64)((u64)t_binding_2e1348 + (u64)((u64)16UL));
+	t__2e1521 = (u64)(*(u64 *)t__2e1519);
+	t__2e1522 = (u64)(u32)(*(u8 *)t_binding_2e1413);
+	t__2e1523 = (u64)((u64)t__2e1521 + (u64)((u64)1UL));
+	*(u64 *)t__2e1519 = (u64)t__2e1523;
+	t__2e1525 = (u64)(*(u64 *)t__2e1520);
+	t__2e1528 = (u64)(u32)(((u64)t__2e1523 <= (u64)t__2e1525));
+	if ((u32)t__2e1528) goto L__2e1526; else goto L__2e1527;
+	L__2e1527:;
+	t_abortsite_2e1262 = ((u64)15UL);
+	goto L_abort_2e1358;
+	L__2e1526:;
+	t__2e1529 = (u64)(*(u64 *)t_binding_2e1348);
+	t__2e1524 = (u64)((u64)t__2e1521 * (u64)((u64)1UL));
+	t__2e1524 = (u64)((u64)t__2e1529 + (u64)t__2e1524);
+	t__2e1530 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	*(u8 *)t__2e1524 = (u8)t__2e1522;
+	t__2e1531 = (u64)((u64)t_binding_2e1348 + (u64)((u64)8UL));
+	t__2e1532 = (u64)((u64)t_binding_2e1348 + (u64)((u64)16UL));
+	t__2e1533 = (u64)(*(u64 *)t__2e1531);
+	BLIT((u64)B15, ((u64)((char *)&D_strliteral_2e1536)), 24);
+	t__2e1534 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R16, (u64)B15);
+	t__2e1538 = (u64)((u64)t__2e1534 + (u64)((u64)8UL));
+	t__2e1537 = (u64)(*(u64 *)t__2e1538);
+	t__2e1539 = (u64)((u64)t__2e1533 + (u64)t__2e1537);
+	*(u64 *)t__2e1531 = (u64)t__2e1539;
+	t__2e1541 = (u64)(*(u64 *)t__2e1532);
+	t__2e1544 = (u64)(u32)(((u64)t__2e1539 <= (u64)t__2e1541));
+	if ((u32)t__2e1544) goto L__2e1542; else goto L__2e1543;
+	L__2e1543:;
+	t_abortsite_2e1262 = ((u64)16UL);
+	goto L_abort_2e1358;
+	L__2e1542:;
+	t__2e1545 = (u64)(*(u64 *)t_binding_2e1348);
+	t__2e1540 = (u64)((u64)t__2e1533 * (u64)((u64)1UL));
+	t__2e1540 = (u64)((u64)t__2e1545 + (u64)t__2e1540);
+	t__2e1546 = (u64)((u64)t__2e1537 * (u64)((u64)1UL));
+	t__2e1547 = (u64)(*(u64 *)t__2e1534);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1540, (u64)t__2e1547, (u64)t__2e1546);
+	goto L__2e1418;
+	L__2e1548:;
+	L__2e1418:;
+	L_after_2e1412:;
+	t__2e1549 = (u64)(u32)(*(u8 *)t_binding_2e1413);
+	t__2e1549 = (u64)(u32)((u32)t__2e1549 + (u32)((u64)1UL));
+	*(u8 *)t_binding_2e1413 = (u8)t__2e1549;
+	goto L_loop_2e1408;
+	L__2e1411:;
+	goto L__2e1406;
+	L__2e1550:;
+	L__2e1406:;
+	L_after_2e1400:;
+	t__2e1551 = (u64)(u32)(*(u8 *)t_binding_2e1401);
+	t__2e1551 = (u64)(u32)((u32)t__2e1551 + (u32)((u64)1UL));
+	*(u8 *)t_binding_2e1401 = (u8)t__2e1551;
+	goto L_loop_2e1396;
+	L__2e1399:;
+	goto L__2e1394;
+	L__2e1552:;
+	L__2e1394:;
+	L_after_2e1388:;
+	t__2e1553 = (u64)(u32)(*(u8 *)t_binding_2e1389);
+	t__2e1553 = (u64)(u32)((u32)t__2e1553 + (u32)((u64)1UL));
+	*(u8 *)t_binding_2e1389 = (u8)t__2e1553;
+	goto L_loop_2e1384;
+	L__2e1387:;
+	t__2e1554 = (u64)((u64)t_binding_2e1348 + (u64)((u64)8UL));
+	t__2e1555 = (u64)((u64)t_binding_2e1348 + (u64)((u64)16UL));
+	t__2e1556 = (u64)(*(u64 *)t__2e1554);
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e1559)), 24);
+	t__2e1557 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R18, (u64)B17);
+	t__2e1561 = (u64)((u64)t__2e1557 + (u64)((u64)8UL));
+	t__2e1560 = (u64)(*(u64 *)t__2e1561);
+	t__2e1562 = (u64)((u64)t__2e1556 + (u64)t__2e1560);
+	*(u64 *)t__2e1554 = (u64)t__2e1562;
+	t__2e1564 = (u64)(*(u64 *)t__2e1555);
+	t__2e1567 = (u64)(u32)(((u64)t__2e1562 <= (u64)t__2e1564));
+	if ((u32)t__2e1567) goto L__2e1565; else goto L__2e1566;
+	L__2e1566:;
+	t_abortsite_2e1262 = ((u64)17UL);
+	goto L_abort_2e1358;
+	L__2e1565:;
+	t__2e1568 = (u64)(*(u64 *)t_binding_2e1348);
+	t__2e1563 = (u64)((u64)t__2e1556 * (u64)((u64)1UL));
+	t__2e1563 = (u64)((u64)t__2e1568 + (u64)t__2e1563);
+	t__2e1569 = (u64)((u64)t__2e1560 * (u64)((u64)1UL));
+	t__2e1570 = (u64)(*(u64 *)t__2e1557);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e1563, (u64)t__2e1570, (u64)t__2e1569);
+	*(u32 *)t_object_2e1573 = (u32)((u64)3532310079UL);
+	t__2e1574 = (u64)((u64)t_object_2e1573 + (u64)((u64)4UL));
+	*(u32 *)t__2e1574 = (u32)((u64)0UL);
+	*(u64 *)t_object_2e1575 = (u64)((u64)0UL);
+	t__2e1576 = (u64)((u64)t_object_2e1575 + (u64)((u64)8UL));
+	*(u64 *)t__2e1576 = (u64)((u64)0UL);
+	t__2e1576 = (u64)((u64)t__2e1576 + (u64)((u64)8UL));
+	*(u64 *)t__2e1576 = (u64)((u64)0UL);
+	BLIT((u64)B19, t_object_2e1573, 8);
+	BLIT((u64)B20, t_binding_2e1348, 24);
+	BLIT((u64)B21, t_object_2e1575, 24);
+	t__2e1572 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R22, (u64)B19, (u64)B20, (u64)B21);
+	t_tag_2e1577 = (u64)(*(u32 *)t__2e1572);
+	t__2e1585 = (u64)(u32)(((u32)t_tag_2e1577 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1585) goto L_member_2e1582; else goto L__2e1584;
+	L__2e1584:;
+	t__2e1587 = (u64)(u32)(((u32)t_tag_2e1577 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1587) goto L_member_2e1583; else goto L__2e1586;
+	L__2e1586:;
+	goto L_matches_2e1581;
+	L_member_2e1582:;
+	goto L_matches_2e1581;
+	L_member_2e1583:;
+	goto L_matches_2e1580;
+	L_matches_2e1580:;
+	goto L__2e1578;
+	L_matches_2e1581:;
+	t_abortsite_2e1262 = ((u64)18UL);
+	goto L_abort_2e1588;
+	L__2e1594:;
+	L__2e1579:;
+	t_abortsite_2e1262 = ((u64)19UL);
+	goto L_abort_2e1272;
+	L__2e1578:;
+	*(u32 *)t_object_2e1597 = (u32)((u64)3532310079UL);
+	t__2e1598 = (u64)((u64)t_object_2e1597 + (u64)((u64)4UL));
+	*(u32 *)t__2e1598 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1601 = (u64)((u64)0UL);
+	t__2e1602 = (u64)((u64)t_object_2e1601 + (u64)((u64)8UL));
+	*(u64 *)t__2e1602 = (u64)((u64)0UL);
+	t__2e1602 = (u64)((u64)t__2e1602 + (u64)((u64)8UL));
+	*(u64 *)t__2e1602 = (u64)((u64)0UL);
+	BLIT((u64)B23, t_object_2e1597, 8);
+	BLIT((u64)B24, ((u64)((char *)&D_strliteral_2e1600)), 24);
+	BLIT((u64)B25, t_object_2e1601, 24);
+	t__2e1596 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R26, (u64)B23, (u64)B24, (u64)B25);
+	t_tag_2e1603 = (u64)(*(u32 *)t__2e1596);
+	t__2e1611 = (u64)(u32)(((u32)t_tag_2e1603 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1611) goto L_member_2e1608; else goto L__2e1610;
+	L__2e1610:;
+	t__2e1613 = (u64)(u32)(((u32)t_tag_2e1603 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1613) goto L_member_2e1609; else goto L__2e1612;
+	L__2e1612:;
+	goto L_matches_2e1607;
+	L_member_2e1608:;
+	goto L_matches_2e1607;
+	L_member_2e1609:;
+	goto L_matches_2e1606;
+	L_matches_2e1606:;
+	goto L__2e1604;
+	L_matches_2e1607:;
+	t_abortsite_2e1262 = ((u64)20UL);
+	goto L_abort_2e1588;
+	L__2e1614:;
+	L__2e1605:;
+	t_abortsite_2e1262 = ((u64)21UL);
+	goto L_abort_2e1272;
+	L__2e1604:;
+	*(u32 *)t_object_2e1617 = (u32)((u64)3532310079UL);
+	t__2e1618 = (u64)((u64)t_object_2e1617 + (u64)((u64)4UL));
+	*(u32 *)t__2e1618 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1621 = (u64)((u64)0UL);
+	t__2e1622 = (u64)((u64)t_object_2e1621 + (u64)((u64)8UL));
+	*(u64 *)t__2e1622 = (u64)((u64)0UL);
+	t__2e1622 = (u64)((u64)t__2e1622 + (u64)((u64)8UL));
+	*(u64 *)t__2e1622 = (u64)((u64)0UL);
+	BLIT((u64)B27, t_object_2e1617, 8);
+	BLIT((u64)B28, ((u64)((char *)&D_strliteral_2e1620)), 24);
+	BLIT((u64)B29, t_object_2e1621, 24);
+	t__2e1616 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R30, (u64)B27, (u64)B28, (u64)B29);
+	t_tag_2e1623 = (u64)(*(u32 *)t__2e1616);
+	t__2e1631 = (u64)(u32)(((u32)t_tag_2e1623 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1631) goto L_member_2e1628; else goto L__2e1630;
+	L__2e1630:;
+	t__2e1633 = (u64)(u32)(((u32)t_tag_2e1623 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1633) goto L_member_2e1629; else goto L__2e1632;
+	L__2e1632:;
+	goto L_matches_2e1627;
+	L_member_2e1628:;
+	goto L_matches_2e1627;
+	L_member_2e1629:;
+	goto L_matches_2e1626;
+	L_matches_2e1626:;
+	goto L__2e1624;
+	L_matches_2e1627:;
+	t_abortsite_2e1262 = ((u64)22UL);
+	goto L_abort_2e1588;
+	L__2e1634:;
+	L__2e1625:;
+	t_abortsite_2e1262 = ((u64)23UL);
+	goto L_abort_2e1272;
+	L__2e1624:;
+	goto L__2e1240;
+	L__2e1635:;
+	L__2e1240:;
+	return;
+	L_abort_2e1263:;
+	t__2e1264 = (u64)((u64)t_abortsite_2e1262 * (u64)((u64)16UL));
+	t__2e1264 = (u64)((u64)((u64)((char *)&D_abortsites_2e1261)) + (u64)t__2e1264);
+	t__2e1265 = (u64)(*(u64 *)t__2e1264);
+	t__2e1266 = (u64)((u64)t__2e1264 + (u64)((u64)8UL));
+	t__2e1267 = (u64)(*(u32 *)t__2e1266);
+	t__2e1266 = (u64)((u64)t__2e1264 + (u64)((u64)12UL));
+	t__2e1268 = (u64)(*(u32 *)t__2e1266);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1265, (u64)t__2e1267, (u64)t__2e1268, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1272:;
+	t__2e1273 = (u64)((u64)t_abortsite_2e1262 * (u64)((u64)16UL));
+	t__2e1273 = (u64)((u64)((u64)((char *)&D_abortsites_2e1261)) + (u64)t__2e1273);
+	t__2e1274 = (u64)(*(u64 *)t__2e1273);
+	t__2e1275 = (u64)((u64)t__2e1273 + (u64)((u64)8UL));
+	t__2e1276 = (u64)(*(u32 *)t__2e1275);
+	t__2e1275 = (u64)((u64)t__2e1273 + (u64)((u64)12UL));
+	t__2e1277 = (u64)(*(u32 *)t__2e1275);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1274, (u64)t__2e1276, (u64)t__2e1277, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e1358:;
+	t__2e1359 = (u64)((u64)t_abortsite_2e1262 * (u64)((u64)16UL));
+	t__2e1359 = (u64)((u64)((u64)((char *)&D_abortsites_2e1261)) + (u64)t__2e1359);
+	t__2e1360 = (u64)(*(u64 *)t__2e1359);
+	t__2e1361 = (u64)((u64)t__2e1359 + (u64)((u64)8UL));
+	t__2e1362 = (u64)(*(u32 *)t__2e1361);
+	t__2e1361 = (u64)((u64)t__2e1359 + (u64)((u64)12UL));
+	t__2e1363 = (u64)(*(u32 *)t__2e1361);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1360, (u64)t__2e1362, (u64)t__2e1363, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e1588:;
+	t__2e1589 = (u64)((u64)t_abortsite_2e1262 * (u64)((u64)16UL));
+	t__2e1589 = (u64)((u64)((u64)((char *)&D_abortsites_2e1261)) + (u64)t__2e1589);
+	t__2e1590 = (u64)(*(u64 *)t__2e1589);
+	t__2e1591 = (u64)((u64)t__2e1589 + (u64)((u64)8UL));
+	t__2e1592 = (u64)(*(u32 *)t__2e1591);
+	t__2e1591 = (u64)((u64)t__2e1589 + (u64)((u64)12UL));
+	t__2e1593 = (u64)(*(u32 *)t__2e1591);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1590, (u64)t__2e1592, (u64)t__2e1593, (u64)((u64)7UL));
+	__builtin_trap();
+}
+static void F_binding(void) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e1651;
+	u64 t__2e1652;
+	u64 t__2e1653;
+	u64 t__2e1654;
+	u64 t__2e1655;
+	u64 t_abortsite_2e1649;
+	u64 t_binding_2e1646;
+	L_start_2e1636:;
+	t_binding_2e1646 = (u64)A0;
+	L_body_2e1637:;
+	goto L_matches_2e1643;
+	L_matches_2e1643:;
+	*(u32 *)t_binding_2e1646 = (u32)((u64)42UL);
+	goto L__2e1644;
+	L__2e1647:;
+	L__2e1644:;
+	goto L__2e1641;
+	L__2e1642:;
+	t_abortsite_2e1649 = ((u64)0UL);
+	goto L_abort_2e1650;
+	L__2e1641:;
+	goto L__2e1638;
+	L__2e1656:;
+	L__2e1638:;
+	return;
+	L_abort_2e1650:;
+	t__2e1651 = (u64)((u64)t_abortsite_2e1649 * (u64)((u64)16UL));
+	t__2e1651 = (u64)((u64)((u64)((char *)&D_abortsites_2e1648)) + (u64)t__2e1651);
+	t__2e1652 = (u64)(*(u64 *)t__2e1651);
+	t__2e1653 = (u64)((u64)t__2e1651 + (u64)((u64)8UL));
+	t__2e1654 = (u64)(*(u32 *)t__2e1653);
+	t__2e1653 = (u64)((u64)t__2e1651 + (u64)((u64)12UL));
+	t__2e1655 = (u64)(*(u32 *)t__2e1653);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1652, (u64)t__2e1654, (u64)t__2e1655, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_tagged__result(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e1665;
+	u64 t__2e1669;
+	u64 t__2e1673;
+	u64 t__2e1676;
+	u64 t__2e1682;
+	u64 t__2e1683;
+	u64 t__2e1684;
+	u64 t__2e1685;
+	u64 t__2e1686;
+	u64 t__2e1689;
+	u64 t__2e1692;
+	u64 t__2e1696;
+	u64 t__2e1697;
+	u64 t__2e1698;
+	u64 t__2e1699;
+	u64 t__2e1700;
+	u64 t__2e1701;
+	u64 t__2e1704;
+	u64 t__2e1708;
+	u64 t__2e1710;
+	u64 t__2e1714;
+	u64 t__2e1719;
+	u64 t__2e1722;
+	u64 t_abortsite_2e1680;
+	u64 t_binding_2e1661;
+	u64 t_binding_2e1662;
+	u64 t_object_2e1709;
+	u64 t_object_2e1713;
+	u64 t_subval_2e1691;
+	u64 t_subval_2e1721;
+	L_start_2e1657:;
+	t_binding_2e1661 = (u64)A0;
+	t_binding_2e1662 = (u64)A1;
+	t_object_2e1709 = (u64)A2;
+	t_object_2e1713 = (u64)A3;
+	L_body_2e1658:;
+	*(u32 *)t_binding_2e1661 = (u32)((u64)42UL);
+	t__2e1665 = (u64)(u32)(*(i32 *)t_binding_2e1661);
+	t__2e1669 = (u64)(u32)(((u32)t__2e1665 == (u32)((u64)42UL)));
+	if ((u32)t__2e1669) goto L_matches_2e1666; else goto L__2e1668;
+	L__2e1668:;
+	goto L_matches_2e1667;
+	L_matches_2e1666:;
+	*(u32 *)t_binding_2e1662 = (u32)((u64)1099590421UL);
+	t__2e1673 = (u64)((u64)t_binding_2e1662 + (u64)((u64)4UL));
+	*(u32 *)t__2e1673 = (u32)((u64)1337UL);
+	goto L__2e1674;
+	L__2e1675:;
+	L__2e1674:;
+	goto L__2e1663;
+	L_matches_2e1667:;
+	*(u32 *)t_binding_2e1662 = (u32)((u64)2543892678UL);
+	t__2e1676 = (u64)((u64)t_binding_2e1662 + (u64)((u64)4UL));
+	*(u32 *)t__2e1676 = (u32)((u64)1337UL);
+	goto L__2e1677;
+	L__2e1678:;
+	L__2e1677:;
+	goto L__2e1663;
+	L__2e1664:;
+	t_abortsite_2e1680 = ((u64)0UL);
+	goto L_abort_2e1681;
+	L__2e1663:;
+	t__2e1689 = (u64)(u32)(*(u32 *)t_binding_2e1662);
+	t_subval_2e1691 = t_binding_2e1662;
+	t__2e1692 = (u64)(u32)(((u32)t__2e1689 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1692) goto L_subtype_2e1694; else goto L_passed_2e1690;
+	L_subtype_2e1694:;
+	goto L_passed_2e1690;
+	L_passed_2e1690:;
+	if ((u32)t__2e1692) goto L_passed_2e1688; else goto L_failed_2e1687;
+	L_failed_2e1687:;
+	t_abortsite_2e1680 = ((u64)1UL);
+	goto L_abort_2e1695;
+	L_passed_2e1688:;
+	*(u32 *)t_binding_2e1661 = (u32)((u64)24UL);
+	t__2e1704 = (u64)(u32)(*(i32 *)t_binding_2e1661);
+	t__2e1708 = (u64)(u32)(((u32)t__2e1704 == (u32)((u64)42UL)));
+	if ((u32)t__2e1708) goto L_matches_2e1705; else goto L__2e1707;
+	L__2e1707:;
+	goto L_matches_2e1706;
+	L_matches_2e1705:;
+	*(u32 *)t_object_2e1709 = (u32)((u64)1099590421UL);
+	t__2e1710 = (u64)((u64)t_object_2e1709 + (u64)((u64)4UL));
+	*(u32 *)t__2e1710 = (u32)((u64)1337UL);
+	goto L__2e1711;
+	L__2e1712:;
+	L__2e1711:;
+	t__2e1701 = t_object_2e1709;
+	goto L__2e1702;
+	L_matches_2e1706:;
+	*(u32 *)t_object_2e1713 = (u32)((u64)2543892678UL);
+	t__2e1714 = (u64)((u64)t_object_2e1713 + (u64)((u64)4UL));
+	*(u32 *)t__2e1714 = (u32)((u64)1337UL);
+	goto L__2e1715;
+	L__2e1716:;
+	L__2e1715:;
+	t__2e1701 = t_object_2e1713;
+	goto L__2e1702;
+	L__2e1703:;
+	t_abortsite_2e1680 = ((u64)2UL);
+	goto L_abort_2e1681;
+	L__2e1702:;
+	BLIT(t_binding_2e1662, t__2e1701, ((u64)8UL));
+	t__2e1719 = (u64)(u32)(*(u32 *)t_binding_2e1662);
+	t_subval_2e1721 = t_binding_2e1662;
+	t__2e1722 = (u64)(u32)(((u32)t__2e1719 == (u32)((u64)2543892678UL)));
+	if ((u32)t__2e1722) goto L_subtype_2e1724; else goto L_passed_2e1720;
+	L_subtype_2e1724:;
+	goto L_passed_2e1720;
+	L_passed_2e1720:;
+	if ((u32)t__2e1722) goto L_passed_2e1718; else goto L_failed_2e1717;
+	L_failed_2e1717:;
+	t_abortsite_2e1680 = ((u64)3UL);
+	goto L_abort_2e1695;
+	L_passed_2e1718:;
+	goto L__2e1659;
+	L__2e1725:;
+	L__2e1659:;
+	return;
+	L_abort_2e1681:;
+	t__2e1682 = (u64)((u64)t_abortsite_2e1680 * (u64)((u64)16UL));
+	t__2e1682 = (u64)((u64)((u64)((char *)&D_abortsites_2e1679)) + (u64)t__2e1682);
+	t__2e1683 = (u64)(*(u64 *)t__2e1682);
+	t__2e1684 = (u64)((u64)t__2e1682 + (u64)((u64)8UL));
+	t__2e1685 = (u64)(*(u32 *)t__2e1684);
+	t__2e1684 = (u64)((u64)t__2e1682 + (u64)((u64)12UL));
+	t__2e1686 = (u64)(*(u32 *)t__2e1684);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1683, (u64)t__2e1685, (u64)t__2e1686, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e1695:;
+	t__2e1696 = (u64)((u64)t_abortsite_2e1680 * (u64)((u64)16UL));
+	t__2e1696 = (u64)((u64)((u64)((char *)&D_abortsites_2e1679)) + (u64)t__2e1696);
+	t__2e1697 = (u64)(*(u64 *)t__2e1696);
+	t__2e1698 = (u64)((u64)t__2e1696 + (u64)((u64)8UL));
+	t__2e1699 = (u64)(*(u32 *)t__2e1698);
+	t__2e1698 = (u64)((u64)t__2e1696 + (u64)((u64)12UL));
+	t__2e1700 = (u64)(*(u32 *)t__2e1698);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1697, (u64)t__2e1699, (u64)t__2e1700, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_basics(void) {
+	char A0[48] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[1] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[4] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	char A12[24] __attribute__((aligned(16)));
+	char A13[8] __attribute__((aligned(16)));
+	char A14[24] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char B16[24] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char B19[8] __attribute__((aligned(16)));
+	char B20[24] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char R22[4] __attribute__((aligned(16)));
+	char B23[8] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	char R26[4] __attribute__((aligned(16)));
+	char B27[8] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char R30[4] __attribute__((aligned(16)));
+	char B31[8] __attribute__((aligned(16)));
+	char B32[24] __attribute__((aligned(16)));
+	char B33[24] __attribute__((aligned(16)));
+	char R34[4] __attribute__((aligned(16)));
+	u64 t__2e1746;
+	u64 t__2e1747;
+	u64 t__2e1751;
+	u64 t__2e1752;
+	u64 t__2e1753;
+	u64 t__2e1754;
+	u64 t__2e1755;
+	u64 t__2e1759;
+	u64 t__2e1765;
+	u64 t__2e1767;
+	u64 t__2e1769;
+	u64 t__2e1770;
+	u64 t__2e1772;
+	u64 t__2e1773;
+	u64 t__2e1776;
+	u64 t__2e1777;
+	u64 t__2e1780;
+	u64 t__2e1783;
+	u64 t__2e1784;
+	u64 t__2e1789;
+	u64 t__2e1790;
+	u64 t__2e1791;
+	u64 t__2e1792;
+	u64 t__2e1793;
+	u64 t__2e1796;
+	u64 t__2e1797;
+	u64 t__2e1798;
+	u64 t__2e1799;
+	u64 t__2e1800;
+	u64 t__2e1801;
+	u64 t__2e1802;
+	u64 t__2e1804;
+	u64 t__2e1805;
+	u64 t__2e1806;
+	u64 t__2e1807;
+	u64 t__2e1808;
+	u64 t__2e1810;
+	u64 t__2e1819;
+	u64 t__2e1820;
+	u64 t__2e1821;
+	u64 t__2e1822;
+	u64 t__2e1826;
+	u64 t__2e1828;
+	u64 t__2e1829;
+	u64 t__2e1832;
+	u64 t__2e1841;
+	u64 t__2e1845;
+	u64 t__2e1849;
+	u64 t__2e1860;
+	u64 t__2e1864;
+	u64 t__2e1884;
+	u64 t__2e1886;
+	u64 t__2e1888;
+	u64 t__2e1890;
+	u64 t__2e1892;
+	u64 t__2e1894;
+	u64 t__2e1922;
+	u64 t__2e1927;
+	u64 t__2e1929;
+	u64 t__2e1942;
+	u64 t__2e1944;
+	u64 t__2e1948;
+	u64 t__2e1957;
+	u64 t__2e1959;
+	u64 t__2e1961;
+	u64 t__2e1962;
+	u64 t__2e1963;
+	u64 t__2e1964;
+	u64 t__2e1965;
+	u64 t__2e1968;
+	u64 t__2e1970;
+	u64 t__2e1974;
+	u64 t__2e1983;
+	u64 t__2e1985;
+	u64 t__2e1988;
+	u64 t__2e1990;
+	u64 t__2e1994;
+	u64 t__2e2003;
+	u64 t__2e2005;
+	u64 t__2e2008;
+	u64 t__2e2010;
+	u64 t__2e2014;
+	u64 t__2e2023;
+	u64 t__2e2025;
+	u64 t_abortsite_2e1787;
+	u64 t_binding_2e1730;
+	u64 t_binding_2e1745;
+	u64 t_binding_2e1750;
+	u64 t_binding_2e1756;
+	u64 t_binding_2e1811;
+	u64 t_binding_2e1842;
+	u64 t_binding_2e1918;
+	u64 t_item_2e1733;
+	u64 t_item_2e1734;
+	u64 t_item_2e1735;
+	u64 t_item_2e1736;
+	u64 t_item_2e1737;
+	u64 t_item_2e1738;
+	u64 t_item_2e1739;
+	u64 t_object_2e1943;
+	u64 t_object_2e1947;
+	u64 t_object_2e1969;
+	u64 t_object_2e1973;
+	u64 t_object_2e1989;
+	u64 t_object_2e1993;
+	u64 t_object_2e2009;
+	u64 t_object_2e2013;
+	u64 t_tag_2e1949;
+	u64 t_tag_2e1975;
+	u64 t_tag_2e1995;
+	u64 t_tag_2e2015;
+	L_start_2e1726:;
+	t_binding_2e1730 = (u64)A0;
+	t_binding_2e1745 = (u64)A1;
+	t_binding_2e1750 = (u64)A2;
+	t_binding_2e1756 = (u64)A3;
+	t_binding_2e1811 = (u64)A4;
+	t_binding_2e1842 = (u64)A5;
+	t_binding_2e1918 = (u64)A6;
+	t_object_2e1943 = (u64)A7;
+	t_object_2e1947 = (u64)A8;
+	t_object_2e1969 = (u64)A9;
+	t_object_2e1973 = (u64)A10;
+	t_object_2e1989 = (u64)A11;
+	t_object_2e1993 = (u64)A12;
+	t_object_2e2009 = (u64)A13;
+	t_object_2e2013 = (u64)A14;
+	L_body_2e1727:;
+	t_item_2e1733 = (u64)((u64)t_binding_2e1730 + (u64)((u64)0UL));
+	t_item_2e1734 = (u64)((u64)t_item_2e1733 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1734 = (u32)((u64)0UL);
+	t_item_2e1734 = (u64)((u64)t_item_2e1733 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1734 = (u32)((u64)1UL);
+	t_item_2e1733 = (u64)((u64)t_binding_2e1730 + (u64)((u64)8UL));
+	t_item_2e1735 = (u64)((u64)t_item_2e1733 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1735 = (u32)((u64)1UL);
+	t_item_2e1735 = (u64)((u64)t_item_2e1733 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1735 = (u32)((u64)3UL);
+	t_item_2e1733 = (u64)((u64)t_binding_2e1730 + (u64)((u64)16UL));
+	t_item_2e1736 = (u64)((u64)t_item_2e1733 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1736 = (u32)((u64)10UL);
+	t_item_2e1736 = (u64)((u64)t_item_2e1733 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1736 = (u32)((u64)20UL);
+	t_item_2e1733 = (u64)((u64)t_binding_2e1730 + (u64)((u64)24UL));
+	t_item_2e1737 = (u64)((u64)t_item_2e1733 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1737 = (u32)((u64)11UL);
+	t_item_2e1737 = (u64)((u64)t_item_2e1733 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1737 = (u32)((u64)21UL);
+	t_item_2e1733 = (u64)((u64)t_binding_2e1730 + (u64)((u64)32UL));
+	t_item_2e1738 = (u64)((u64)t_item_2e1733 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1738 = (u32)((u64)12UL);
+	t_item_2e1738 = (u64)((u64)t_item_2e1733 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1738 = (u32)((u64)22UL);
+	t_item_2e1733 = (u64)((u64)t_binding_2e1730 + (u64)((u64)40UL));
+	t_item_2e1739 = (u64)((u64)t_item_2e1733 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1739 = (u32)((u64)13UL);
+	t_item_2e1739 = (u64)((u64)t_item_2e1733 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1739 = (u32)((u64)13UL);
+	*(u64 *)t_binding_2e1745 = (u64)((u64)0UL);
+	L_loop_2e1740:;
+	t__2e1747 = (u64)(*(u64 *)t_binding_2e1745);
+	t__2e1746 = (u64)(u32)(((u64)t__2e1747 < (u64)((u64)6UL)));
+	if ((u32)t__2e1746) goto L_body_2e1741; else goto L__2e1743;
+	L_body_2e1741:;
+	t__2e1752 = (u64)(*(u64 *)t_binding_2e1745);
+	t__2e1751 = (u64)((u64)t__2e1752 * (u64)((u64)8UL));
+	t__2e1751 = (u64)((u64)t_binding_2e1730 + (u64)t__2e1751);
+	t__2e1754 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1753 = (u64)((u64)t__2e1754 * (u64)((u64)4UL));
+	t__2e1753 = (u64)((u64)t__2e1751 + (u64)t__2e1753);
+	t__2e1755 = (u64)(u32)(*(i32 *)t__2e1753);
+	*(u32 *)t_binding_2e1750 = (u32)t__2e1755;
+	t__2e1759 = (u64)(u32)(*(i32 *)t_binding_2e1750);
+	t__2e1765 = (u64)(u32)(((u32)t__2e1759 == (u32)((u64)0UL)));
+	if ((u32)t__2e1765) goto L_matches_2e1760; else goto L__2e1764;
+	L__2e1764:;
+	t__2e1767 = (u64)(u32)(((u32)t__2e1759 == (u32)((u64)1UL)));
+	if ((u32)t__2e1767) goto L_matches_2e1761; else goto L__2e1766;
+	L__2e1766:;
+	t__2e1770 = (u64)(u32)((u32)t__2e1759 - (u32)((u64)10UL));
+	t__2e1769 = (u64)(u32)(((u32)t__2e1770 <= (u32)((u64)2UL)));
+	if ((u32)t__2e1769) goto L_matches_2e1763; else goto L__2e1768;
+	L__2e1768:;
+	goto L_matches_2e1762;
+	L_matches_2e1760:;
+	t__2e1773 = (u64)(u32)(*(i32 *)t_binding_2e1750);
+	t__2e1772 = (u64)(u32)((u32)t__2e1773 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1756 = (u32)t__2e1772;
+	goto L__2e1771;
+	L__2e1774:;
+	L__2e1771:;
+	goto L__2e1757;
+	L_matches_2e1761:;
+	t__2e1777 = (u64)(u32)(*(i32 *)t_binding_2e1750);
+	t__2e1776 = (u64)(u32)((u32)t__2e1777 + (u32)((u64)2UL));
+	*(u32 *)t_binding_2e1756 = (u32)t__2e1776;
+	goto L__2e1775;
+	L__2e1778:;
+	L__2e1775:;
+	goto L__2e1757;
+	L_matches_2e1762:;
+	t__2e1780 = (u64)(u32)(*(i32 *)t_binding_2e1750);
+	*(u32 *)t_binding_2e1756 = (u32)t__2e1780;
+	goto L__2e1779;
+	L__2e1781:;
+	L__2e1779:;
+	goto L__2e1757;
+	L_matches_2e1763:;
+	t__2e1784 = (u64)(u32)(*(i32 *)t_binding_2e1750);
+	t__2e1783 = (u64)(u32)((u32)t__2e1784 + (u32)((u64)10UL));
+	*(u32 *)t_binding_2e1756 = (u32)t__2e1783;
+	goto L__2e1782;
+	L__2e1785:;
+	L__2e1782:;
+	goto L__2e1757;
+	L__2e1758:;
+	t_abortsite_2e1787 = ((u64)0UL);
+	goto L_abort_2e1788;
+	L__2e1757:;
+	t__2e1797 = (u64)(u32)(*(i32 *)t_binding_2e1756);
+	t__2e1799 = (u64)(*(u64 *)t_binding_2e1745);
+	t__2e1798 = (u64)((u64)t__2e1799 * (u64)((u64)8UL));
+	t__2e1798 = (u64)((u64)t_binding_2e1730 + (u64)t__2e1798);
+	t__2e1801 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1800 = (u64)((u64)t__2e1801 * (u64)((u64)4UL));
+	t__2e1800 = (u64)((u64)t__2e1798 + (u64)t__2e1800);
+	t__2e1802 = (u64)(u32)(*(i32 *)t__2e1800);
+	t__2e1796 = (u64)(u32)(((u32)t__2e1797 == (u32)t__2e1802));
+	if ((u32)t__2e1796) goto L_passed_2e1795; else goto L_failed_2e1794;
+	L_failed_2e1794:;
+	t_abortsite_2e1787 = ((u64)1UL);
+	goto L_abort_2e1803;
+	L_passed_2e1795:;
+	goto L__2e1748;
+	L__2e1809:;
+	L__2e1748:;
+	L_after_2e1744:;
+	t__2e1810 = (u64)(*(u64 *)t_binding_2e1745);
+	t__2e1810 = (u64)((u64)t__2e1810 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1745 = (u64)t__2e1810;
+	goto L_loop_2e1740;
+	L__2e1743:;
+	t__2e1819 = (u64)((u64)((u64)((char *)&D_strliteral_2e1815)) + (u64)((u64)8UL));
+	t__2e1820 = (u64)((u64)((u64)((char *)&D_strliteral_2e1815)) + (u64)((u64)16UL));
+	t__2e1821 = (u64)(*(u64 *)((u64)((char *)&D_strliteral_2e1815)));
+	t__2e1822 = (u64)(*(u64 *)t__2e1819);
+	t__2e1826 = (u64)(u32)(((u64)t__2e1822 == (u64)((u64)4UL)));
+	if ((u32)t__2e1826) goto L_string_2e1823; else goto L__2e1825;
+	L__2e1825:;
+	t__2e1828 = (u64)(u32)(((u64)t__2e1822 == (u64)((u64)9UL)));
+	if ((u32)t__2e1828) goto L_string_2e1824; else goto L__2e1827;
+	L__2e1827:;
+	goto L_matches_2e1818;
+	L_string_2e1823:;
+	BLIT((u64)B15, ((u64)((char *)&D_strliteral_2e1815)), 24);
+	BLIT((u64)B16, ((u64)((char *)&D_strliteral_2e1815)), 24);
+	t__2e1829 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B15, (u64)B16));
+	if ((u32)t__2e1829) goto L_matches_2e1817; else goto L_matches_2e1818;
+	L_string_2e1824:;
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e1815)), 24);
+	BLIT((u64)B18, ((u64)((char *)&D_strliteral_2e1831)), 24);
+	t__2e1832 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B17, (u64)B18));
+	if ((u32)t__2e1832) goto L_matches_2e1816; else goto L_matches_2e1818;
+	L_matches_2e1816:;
+	t_abortsite_2e1787 = ((u64)2UL);
+	goto L_abort_2e1803;
+	L__2e1834:;
+	L__2e1833:;
+	L_matches_2e1817:;
+	*(u8 *)t_binding_2e1811 = (u8)((u64)1UL);
+	goto L__2e1835;
+	L__2e1836:;
+	L__2e1835:;
+	goto L__2e1812;
+	L_matches_2e1818:;
+	t_abortsite_2e1787 = ((u64)3UL);
+	goto L_abort_2e1803;
+	L__2e1838:;
+	L__2e1837:;
+	L__2e1813:;
+	t_abortsite_2e1787 = ((u64)4UL);
+	goto L_abort_2e1788;
+	L__2e1812:;
+	t__2e1841 = (u64)(u32)(*(u8 *)t_binding_2e1811);
+	if ((u32)t__2e1841) goto L_passed_2e1840; else goto L_failed_2e1839;
+	L_failed_2e1839:;
+	t_abortsite_2e1787 = ((u64)5UL);
+	goto L_abort_2e1803;
+	L_passed_2e1840:;
+	*(u64 *)t_binding_2e1842 = (u64)((u64)((char *)&D_x));
+	t__2e1845 = (u64)(*(u64 *)t_binding_2e1842);
+	t__2e1849 = (u64)(u32)(((u64)t__2e1845 == (u64)((u64)((char *)&D_x))));
+	if ((u32)t__2e1849) goto L_matches_2e1846; else goto L__2e1848;
+	L__2e1848:;
+	goto L_next_2e1847;
+	L_matches_2e1846:;
+	goto L__2e1850;
+	L__2e1852:;
+	L__2e1850:;
+	goto L__2e1844;
+	L_next_2e1847:;
+	t_abortsite_2e1787 = ((u64)6UL);
+	goto L_abort_2e1803;
+	L__2e1855:;
+	L__2e1853:;
+	L__2e1856:;
+	L__2e1857:;
+	t_abortsite_2e1787 = ((u64)7UL);
+	goto L_abort_2e1788;
+	L__2e1844:;
+	t__2e1860 = (u64)(*(u64 *)t_binding_2e1842);
+	t__2e1864 = (u64)(u32)(((u64)t__2e1860 == (u64)((u64)((char *)&D_x))));
+	if ((u32)t__2e1864) goto L_matches_2e1861; else goto L__2e1863;
+	L__2e1863:;
+	goto L_next_2e1862;
+	L_matches_2e1861:;
+	goto L__2e1865;
+	L__2e1867:;
+	L__2e1865:;
+	goto L__2e1859;
+	L_next_2e1862:;
+	t_abortsite_2e1787 = ((u64)8UL);
+	goto L_abort_2e1803;
+	L__2e1870:;
+	L__2e1868:;
+	L__2e1871:;
+	L__2e1872:;
+	t_abortsite_2e1787 = ((u64)9UL);
+	goto L_abort_2e1788;
+	L__2e1859:;
+	t__2e1884 = (u64)(u32)(((i32)((u64)0UL) < (i32)((u64)2UL)));
+	if ((u32)t__2e1884) goto L_switch_2elt_2e1882; else goto L_switch_2ege_2e1883;
+	L_switch_2elt_2e1882:;
+	t__2e1886 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e1886) goto L_matches_2e1876; else goto L__2e1885;
+	L__2e1885:;
+	t__2e1888 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)1UL)));
+	if ((u32)t__2e1888) goto L_matches_2e1877; else goto L__2e1887;
+	L__2e1887:;
+	goto L_matches_2e1881;
+	L_switch_2ege_2e1883:;
+	t__2e1890 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)2UL)));
+	if ((u32)t__2e1890) goto L_matches_2e1878; else goto L__2e1889;
+	L__2e1889:;
+	t__2e1892 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)3UL)));
+	if ((u32)t__2e1892) goto L_matches_2e1879; else goto L__2e1891;
+	L__2e1891:;
+	t__2e1894 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)4UL)));
+	if ((u32)t__2e1894) goto L_matches_2e1880; else goto L__2e1893;
+	L__2e1893:;
+	goto L_matches_2e1881;
+	L_matches_2e1876:;
+	goto L__2e1895;
+	L__2e1897:;
+	L__2e1895:;
+	goto L__2e1874;
+	L_matches_2e1877:;
+	t_abortsite_2e1787 = ((u64)10UL);
+	goto L_abort_2e1803;
+	L__2e1900:;
+	L__2e1898:;
+	L__2e1901:;
+	L_matches_2e1878:;
+	t_abortsite_2e1787 = ((u64)11UL);
+	goto L_abort_2e1803;
+	L__2e1904:;
+	L__2e1902:;
+	L__2e1905:;
+	L_matches_2e1879:;
+	t_abortsite_2e1787 = ((u64)12UL);
+	goto L_abort_2e1803;
+	L__2e1908:;
+	L__2e1906:;
+	L__2e1909:;
+	L_matches_2e1880:;
+	t_abortsite_2e1787 = ((u64)13UL);
+	goto L_abort_2e1803;
+	L__2e1912:;
+	L__2e1910:;
+	L__2e1913:;
+	L_matches_2e1881:;
+	t_abortsite_2e1787 = ((u64)14UL);
+	goto L_abort_2e1803;
+	L__2e1916:;
+	L__2e1914:;
+	L__2e1917:;
+	L__2e1875:;
+	t_abortsite_2e1787 = ((u64)15UL);
+	goto L_abort_2e1788;
+	L__2e1874:;
+	*(u32 *)t_binding_2e1918 = (u32)((u64)0UL);
+	t__2e1922 = (u64)(u32)(*(i32 *)t_binding_2e1918);
+	t__2e1927 = (u64)(u32)(((u32)t__2e1922 == (u32)((u64)0UL)));
+	if ((u32)t__2e1927) goto L_matches_2e1923; else goto L__2e1926;
+	L__2e1926:;
+	t__2e1929 = (u64)(u32)(((u32)t__2e1922 == (u32)((u64)1UL)));
+	if ((u32)t__2e1929) goto L_matches_2e1924; else goto L__2e1928;
+	L__2e1928:;
+	goto L_matches_2e1925;
+	L_matches_2e1923:;
+	goto L__2e1930;
+	L__2e1932:;
+	L__2e1930:;
+	goto L__2e1920;
+	L_matches_2e1924:;
+	t_abortsite_2e1787 = ((u64)16UL);
+	goto L_abort_2e1803;
+	L__2e1935:;
+	L__2e1933:;
+	L__2e1936:;
+	L_matches_2e1925:;
+	t_abortsite_2e1787 = ((u64)17UL);
+	goto L_abort_2e1803;
+	L__2e1939:;
+	L__2e1937:;
+	L__2e1940:;
+	L__2e1921:;
+	t_abortsite_2e1787 = ((u64)18UL);
+	goto L_abort_2e1788;
+	L__2e1920:;
+	*(u32 *)t_object_2e1943 = (u32)((u64)3532310079UL);
+	t__2e1944 = (u64)((u64)t_object_2e1943 + (u64)((u64)4UL));
+	*(u32 *)t__2e1944 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1947 = (u64)((u64)0UL);
+	t__2e1948 = (u64)((u64)t_object_2e1947 + (u64)((u64)8UL));
+	*(u64 *)t__2e1948 = (u64)((u64)0UL);
+	t__2e1948 = (u64)((u64)t__2e1948 + (u64)((u64)8UL));
+	*(u64 *)t__2e1948 = (u64)((u64)0UL);
+	BLIT((u64)B19, t_object_2e1943, 8);
+	BLIT((u64)B20, ((u64)((char *)&D_strliteral_2e1946)), 24);
+	BLIT((u64)B21, t_object_2e1947, 24);
+	t__2e1942 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R22, (u64)B19, (u64)B20, (u64)B21);
+	t_tag_2e1949 = (u64)(*(u32 *)t__2e1942);
+	t__2e1957 = (u64)(u32)(((u32)t_tag_2e1949 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1957) goto L_member_2e1954; else goto L__2e1956;
+	L__2e1956:;
+	t__2e1959 = (u64)(u32)(((u32)t_tag_2e1949 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1959) goto L_member_2e1955; else goto L__2e1958;
+	L__2e1958:;
+	goto L_matches_2e1953;
+	L_member_2e1954:;
+	goto L_matches_2e1953;
+	L_member_2e1955:;
+	goto L_matches_2e1952;
+	L_matches_2e1952:;
+	goto L__2e1950;
+	L_matches_2e1953:;
+	t_abortsite_2e1787 = ((u64)19UL);
+	goto L_abort_2e1960;
+	L__2e1966:;
+	L__2e1951:;
+	t_abortsite_2e1787 = ((u64)20UL);
+	goto L_abort_2e1788;
+	L__2e1950:;
+	*(u32 *)t_object_2e1969 = (u32)((u64)3532310079UL);
+	t__2e1970 = (u64)((u64)t_object_2e1969 + (u64)((u64)4UL));
+	*(u32 *)t__2e1970 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1973 = (u64)((u64)0UL);
+	t__2e1974 = (u64)((u64)t_object_2e1973 + (u64)((u64)8UL));
+	*(u64 *)t__2e1974 = (u64)((u64)0UL);
+	t__2e1974 = (u64)((u64)t__2e1974 + (u64)((u64)8UL));
+	*(u64 *)t__2e1974 = (u64)((u64)0UL);
+	BLIT((u64)B23, t_object_2e1969, 8);
+	BLIT((u64)B24, ((u64)((char *)&D_strliteral_2e1972)), 24);
+	BLIT((u64)B25, t_object_2e1973, 24);
+	t__2e1968 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R26, (u64)B23, (u64)B24, (u64)B25);
+	t_tag_2e1975 = (u64)(*(u32 *)t__2e1968);
+	t__2e1983 = (u64)(u32)(((u32)t_tag_2e1975 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1983) goto L_member_2e1980; else goto L__2e1982;
+	L__2e1982:;
+	t__2e1985 = (u64)(u32)(((u32)t_tag_2e1975 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1985) goto L_member_2e1981; else goto L__2e1984;
+	L__2e1984:;
+	goto L_matches_2e1979;
+	L_member_2e1980:;
+	goto L_matches_2e1979;
+	L_member_2e1981:;
+	goto L_matches_2e1978;
+	L_matches_2e1978:;
+	goto L__2e1976;
+	L_matches_2e1979:;
+	t_abortsite_2e1787 = ((u64)21UL);
+	goto L_abort_2e1960;
+	L__2e1986:;
+	L__2e1977:;
+	t_abortsite_2e1787 = ((u64)22UL);
+	goto L_abort_2e1788;
+	L__2e1976:;
+	*(u32 *)t_object_2e1989 = (u32)((u64)3532310079UL);
+	t__2e1990 = (u64)((u64)t_object_2e1989 + (u64)((u64)4UL));
+	*(u32 *)t__2e1990 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e1993 = (u64)((u64)0UL);
+	t__2e1994 = (u64)((u64)t_object_2e1993 + (u64)((u64)8UL));
+	*(u64 *)t__2e1994 = (u64)((u64)0UL);
+	t__2e1994 = (u64)((u64)t__2e1994 + (u64)((u64)8UL));
+	*(u64 *)t__2e1994 = (u64)((u64)0UL);
+	BLIT((u64)B27, t_object_2e1989, 8);
+	BLIT((u64)B28, ((u64)((char *)&D_strliteral_2e1992)), 24);
+	BLIT((u64)B29, t_object_2e1993, 24);
+	t__2e1988 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R30, (u64)B27, (u64)B28, (u64)B29);
+	t_tag_2e1995 = (u64)(*(u32 *)t__2e1988);
+	t__2e2003 = (u64)(u32)(((u32)t_tag_2e1995 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e2003) goto L_member_2e2000; else goto L__2e2002;
+	L__2e2002:;
+	t__2e2005 = (u64)(u32)(((u32)t_tag_2e1995 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e2005) goto L_member_2e2001; else goto L__2e2004;
+	L__2e2004:;
+	goto L_matches_2e1999;
+	L_member_2e2000:;
+	goto L_matches_2e1999;
+	L_member_2e2001:;
+	goto L_matches_2e1998;
+	L_matches_2e1998:;
+	goto L__2e1996;
+	L_matches_2e1999:;
+	t_abortsite_2e1787 = ((u64)23UL);
+	goto L_abort_2e1960;
+	L__2e2006:;
+	L__2e1997:;
+	t_abortsite_2e1787 = ((u64)24UL);
+	goto L_abort_2e1788;
+	L__2e1996:;
+	*(u32 *)t_object_2e2009 = (u32)((u64)3532310079UL);
+	t__2e2010 = (u64)((u64)t_object_2e2009 + (u64)((u64)4UL));
+	*(u32 *)t__2e2010 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e2013 = (u64)((u64)0UL);
+	t__2e2014 = (u64)((u64)t_object_2e2013 + (u64)((u64)8UL));
+	*(u64 *)t__2e2014 = (u64)((u64)0UL);
+	t__2e2014 = (u64)((u64)t__2e2014 + (u64)((u64)8UL));
+	*(u64 *)t__2e2014 = (u64)((u64)0UL);
+	BLIT((u64)B31, t_object_2e2009, 8);
+	BLIT((u64)B32, ((u64)((char *)&D_strliteral_2e2012)), 24);
+	BLIT((u64)B33, t_object_2e2013, 24);
+	t__2e2008 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R34, (u64)B31, (u64)B32, (u64)B33);
+	t_tag_2e2015 = (u64)(*(u32 *)t__2e2008);
+	t__2e2023 = (u64)(u32)(((u32)t_tag_2e2015 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e2023) goto L_member_2e2020; else goto L__2e2022;
+	L__2e2022:;
+	t__2e2025 = (u64)(u32)(((u32)t_tag_2e2015 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e2025) goto L_member_2e2021; else goto L__2e2024;
+	L__2e2024:;
+	goto L_matches_2e2019;
+	L_member_2e2020:;
+	goto L_matches_2e2019;
+	L_member_2e2021:;
+	goto L_matches_2e2018;
+	L_matches_2e2018:;
+	goto L__2e2016;
+	L_matches_2e2019:;
+	t_abortsite_2e1787 = ((u64)25UL);
+	goto L_abort_2e1960;
+	L__2e2026:;
+	L__2e2017:;
+	t_abortsite_2e1787 = ((u64)26UL);
+	goto L_abort_2e1788;
+	L__2e2016:;
+	goto L__2e1728;
+	L__2e2027:;
+	L__2e1728:;
+	return;
+	L_abort_2e1788:;
+	t__2e1789 = (u64)((u64)t_abortsite_2e1787 * (u64)((u64)16UL));
+	t__2e1789 = (u64)((u64)((u64)((char *)&D_abortsites_2e1786)) + (u64)t__2e1789);
+	t__2e1790 = (u64)(*(u64 *)t__2e1789);
+	t__2e1791 = (u64)((u64)t__2e1789 + (u64)((u64)8UL));
+	t__2e1792 = (u64)(*(u32 *)t__2e1791);
+	t__2e1791 = (u64)((u64)t__2e1789 + (u64)((u64)12UL));
+	t__2e1793 = (u64)(*(u32 *)t__2e1791);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1790, (u64)t__2e1792, (u64)t__2e1793, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e1803:;
+	t__2e1804 = (u64)((u64)t_abortsite_2e1787 * (u64)((u64)16UL));
+	t__2e1804 = (u64)((u64)((u64)((char *)&D_abortsites_2e1786)) + (u64)t__2e1804);
+	t__2e1805 = (u64)(*(u64 *)t__2e1804);
+	t__2e1806 = (u64)((u64)t__2e1804 + (u64)((u64)8UL));
+	t__2e1807 = (u64)(*(u32 *)t__2e1806);
+	t__2e1806 = (u64)((u64)t__2e1804 + (u64)((u64)12UL));
+	t__2e1808 = (u64)(*(u32 *)t__2e1806);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1805, (u64)t__2e1807, (u64)t__2e1808, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1960:;
+	t__2e1961 = (u64)((u64)t_abortsite_2e1787 * (u64)((u64)16UL));
+	t__2e1961 = (u64)((u64)((u64)((char *)&D_abortsites_2e1786)) + (u64)t__2e1961);
+	t__2e1962 = (u64)(*(u64 *)t__2e1961);
+	t__2e1963 = (u64)((u64)t__2e1961 + (u64)((u64)8UL));
+	t__2e1964 = (u64)(*(u32 *)t__2e1963);
+	t__2e1963 = (u64)((u64)t__2e1961 + (u64)((u64)12UL));
+	t__2e1965 = (u64)(*(u32 *)t__2e1963);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1962, (u64)t__2e1964, (u64)t__2e1965, (u64)((u64)7UL));
+	__builtin_trap();
+}
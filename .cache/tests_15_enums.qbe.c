@@ -0,0 +1,1173 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e14 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; };
+struct __attribute__((packed)) S_abortsites_2e48 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; };
+struct __attribute__((packed)) S_abortsites_2e126 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_strdata_2e162 { u8 f0[32]; };
+struct __attribute__((packed)) S_strliteral_2e163 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e198 { u8 f0[39]; };
+struct __attribute__((packed)) S_strliteral_2e199 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e218 { u8 f0[31]; };
+struct __attribute__((packed)) S_strliteral_2e219 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e238 { u8 f0[50]; };
+struct __attribute__((packed)) S_strliteral_2e239 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e258 { u8 f0; u8 f1; u8 f2; u8 f3[21]; u8 f4; u8 f5; u8 f6; u8 f7[27]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e259 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e278 { u8 f0; u8 f1; u8 f2; u8 f3[21]; u8 f4; u8 f5; u8 f6; u8 f7[40]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e279 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e298 { u8 f0[30]; };
+struct __attribute__((packed)) S_strliteral_2e299 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e318 { u8 f0[27]; };
+struct __attribute__((packed)) S_strliteral_2e319 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e179 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; };
+struct __attribute__((packed)) S_abortsites_2e342 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; };
+struct __attribute__((packed)) S_abortsites_2e438 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; };
+struct __attribute__((packed)) S_abortsites_2e466 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e14 D_abortsites_2e14 __asm__("abortsites.14") __attribute__((used, section(".data.rel.ro.abortsites.14"), aligned(8)));
+static struct S_abortsites_2e48 D_abortsites_2e48 __asm__("abortsites.48") __attribute__((used, section(".data.rel.ro.abortsites.48"), aligned(8)));
+static struct S_abortsites_2e126 D_abortsites_2e126 __asm__("abortsites.126") __attribute__((used, section(".data.rel.ro.abortsites.126"), aligned(8)));
+static const struct S_strdata_2e162 D_strdata_2e162 __asm__("strdata.162") __attribute__((used, section(".rodata.strdata.162"), aligned(8)));
+static struct S_strliteral_2e163 D_strliteral_2e163 __asm__("strliteral.163") __attribute__((used, section(".data.rel.ro.strliteral.163"), aligned(8)));
+static const struct S_strdata_2e198 D_strdata_2e198 __asm__("strdata.198") __attribute__((used, section(".rodata.strdata.198"), aligned(8)));
+static struct S_strliteral_2e199 D_strliteral_2e199 __asm__("strliteral.199") __attribute__((used, section(".data.rel.ro.strliteral.199"), aligned(8)));
+static const struct S_strdata_2e218 D_strdata_2e218 __asm__("strdata.218") __attribute__((used, section(".rodata.strdata.218"), aligned(8)));
+static struct S_strliteral_2e219 D_strliteral_2e219 __asm__("strliteral.219") __attribute__((used, section(".data.rel.ro.strliteral.219"), aligned(8)));
+static const struct S_strdata_2e238 D_strdata_2e238 __asm__("strdata.238") __attribute__((used, section(".rodata.strdata.238"), aligned(8)));
+static struct S_strliteral_2e239 D_strliteral_2e239 __asm__("strliteral.239") __attribute__((used, section(".data.rel.ro.strliteral.239"), aligned(8)));
+static const struct S_strdata_2e258 D_strdata_2e258 __asm__("strdata.258") __attribute__((used, section(".rodata.strdata.258"), aligned(8)));
+static struct S_strliteral_2e259 D_strliteral_2e259 __asm__("strliteral.259") __attribute__((used, section(".data.rel.ro.strliteral.259"), aligned(8)));
+static const struct S_strdata_2e278 D_strdata_2e278 __asm__("strdata.278") __attribute__((used, section(".rodata.strdata.278"), aligned(8)));
+static struct S_strliteral_2e279 D_strliteral_2e279 __asm__("strliteral.279") __attribute__((used, section(".data.rel.ro.strliteral.279"), aligned(8)));
+static const struct S_strdata_2e298 D_strdata_2e298 __asm__("strdata.298") __attribute__((used, section(".rodata.strdata.298"), aligned(8)));
+static struct S_strliteral_2e299 D_strliteral_2e299 __asm__("strliteral.299") __attribute__((used, section(".data.rel.ro.strliteral.299"), aligned(8)));
+static const struct S_strdata_2e318 D_strdata_2e318 __asm__("strdata.318") __attribute__((used, section(".rodata.strdata.318"), aligned(8)));
+static struct S_strliteral_2e319 D_strliteral_2e319 __asm__("strliteral.319") __attribute__((used, section(".data.rel.ro.strliteral.319"), aligned(8)));
+static struct S_abortsites_2e179 D_abortsites_2e179 __asm__("abortsites.179") __attribute__((used, section(".data.rel.ro.abortsites.179"), aligned(8)));
+static struct S_abortsites_2e342 D_abortsites_2e342 __asm__("abortsites.342") __attribute__((used, section(".data.rel.ro.abortsites.342"), aligned(8)));
+static struct S_abortsites_2e438 D_abortsites_2e438 __asm__("abortsites.438") __attribute__((used, section(".data.rel.ro.abortsites.438"), aligned(8)));
+static struct S_abortsites_2e466 D_abortsites_2e466 __asm__("abortsites.466") __attribute__((used, section(".data.rel.ro.abortsites.466"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_resolution__order(void) __asm__("resolution_order") __attribute__((used, section(".text.resolution_order")));
+static void F_aliases(void) __asm__("aliases") __attribute__((used, section(".text.aliases")));
+static void F_interdependent(void) __asm__("interdependent") __attribute__((used, section(".text.interdependent")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_storage(void) __asm__("storage") __attribute__((used, section(".text.storage")));
+static void F_explicit(void) __asm__("explicit") __attribute__((used, section(".text.explicit")));
+static void F_implicit(void) __asm__("implicit") __attribute__((used, section(".text.implicit")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\061\065\055\145\156\165\155\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 17U, 17U };
+static struct S_abortsites_2e14 D_abortsites_2e14 = { (char *)((char *)&D_strliteral_2e1) + 0, 165U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 166U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 167U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 168U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 169U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 170U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 171U, 15U };
+static struct S_abortsites_2e48 D_abortsites_2e48 = { (char *)((char *)&D_strliteral_2e1) + 0, 121U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 123U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 124U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 125U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 127U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 128U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 129U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 130U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 131U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 135U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 136U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 138U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 139U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 140U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 144U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 145U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 146U, 15U };
+static struct S_abortsites_2e126 D_abortsites_2e126 = { (char *)((char *)&D_strliteral_2e1) + 0, 105U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 107U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 109U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 15U };
+static const struct S_strdata_2e162 D_strdata_2e162 = { "\145\170\160\157\162\164\040\154\145\164\040\141\072\040\145\156\165\155\040\173\040\101\054\040\102\040\175\040\075\040\060\073" };
+static struct S_strliteral_2e163 D_strliteral_2e163 = { (char *)((char *)&D_strdata_2e162) + 0, 32U, 32U };
+static const struct S_strdata_2e198 D_strdata_2e198 = { "\145\170\160\157\162\164\040\154\145\164\040\141\072\040\151\156\164\040\075\040\060\072\040\145\156\165\155\173\101\054\040\102\175\072\040\151\156\164\073" };
+static struct S_strliteral_2e199 D_strliteral_2e199 = { (char *)((char *)&D_strdata_2e198) + 0, 39U, 39U };
+static const struct S_strdata_2e218 D_strdata_2e218 = { "\164\171\160\145\040\141\040\075\040\145\156\165\155\040\173\040\101\040\075\040\102\054\040\102\040\075\040\101\040\175\073" };
+static struct S_strliteral_2e219 D_strliteral_2e219 = { (char *)((char *)&D_strdata_2e218) + 0, 31U, 31U };
+static const struct S_strdata_2e238 D_strdata_2e238 = { "\164\171\160\145\040\141\040\075\040\145\156\165\155\040\173\040\101\040\075\040\142\072\072\102\040\175\054\040\142\040\075\040\145\156\165\155\040\173\040\102\040\075\040\141\072\072\101\040\175\073" };
+static struct S_strliteral_2e239 D_strliteral_2e239 = { (char *)((char *)&D_strdata_2e238) + 0, 50U, 50U };
+static const struct S_strdata_2e258 D_strdata_2e258 = { 10U, 9U, 9U, "\144\145\146\040\141\072\040\151\156\164\040\075\040\145\072\072\126\101\114\061\073", 10U, 9U, 9U, "\164\171\160\145\040\145\040\075\040\145\156\165\155\040\173\040\126\101\114\061\040\075\040\141\040\175\073", 10U, 9U };
+static struct S_strliteral_2e259 D_strliteral_2e259 = { (char *)((char *)&D_strdata_2e258) + 0, 56U, 56U };
+static const struct S_strdata_2e278 D_strdata_2e278 = { 10U, 9U, 9U, "\144\145\146\040\141\072\040\151\156\164\040\075\040\145\072\072\126\101\114\061\073", 10U, 9U, 9U, "\164\171\160\145\040\145\040\075\040\145\156\165\155\040\173\040\126\101\114\061\040\075\040\126\101\114\062\054\040\126\101\114\062\040\075\040\141\040\175\073", 10U, 9U };
+static struct S_strliteral_2e279 D_strliteral_2e279 = { (char *)((char *)&D_strdata_2e278) + 0, 69U, 69U };
+static const struct S_strdata_2e298 D_strdata_2e298 = { "\164\171\160\145\040\141\040\075\040\145\156\165\155\040\146\066\064\040\173\040\101\040\075\040\060\056\060\040\175\073" };
+static struct S_strliteral_2e299 D_strliteral_2e299 = { (char *)((char *)&D_strdata_2e298) + 0, 30U, 30U };
+static const struct S_strdata_2e318 D_strdata_2e318 = { "\164\171\160\145\040\141\040\075\040\145\156\165\155\040\173\040\101\040\075\040\166\157\151\144\040\175\073" };
+static struct S_strliteral_2e319 D_strliteral_2e319 = { (char *)((char *)&D_strdata_2e318) + 0, 27U, 27U };
+static struct S_abortsites_2e179 D_abortsites_2e179 = { (char *)((char *)&D_strliteral_2e1) + 0, 70U, 68U, (char *)((char *)&D_strliteral_2e1) + 0, 70U, 68U, (char *)((char *)&D_strliteral_2e1) + 0, 71U, 75U, (char *)((char *)&D_strliteral_2e1) + 0, 71U, 75U, (char *)((char *)&D_strliteral_2e1) + 0, 74U, 67U, (char *)((char *)&D_strliteral_2e1) + 0, 74U, 67U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 86U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 86U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 83U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 83U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 86U, 66U, (char *)((char *)&D_strliteral_2e1) + 0, 86U, 66U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 63U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 63U };
+static struct S_abortsites_2e342 D_abortsites_2e342 = { (char *)((char *)&D_strliteral_2e1) + 0, 52U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 53U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 54U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 55U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 56U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 61U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 62U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 63U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 64U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 65U, 15U };
+static struct S_abortsites_2e438 D_abortsites_2e438 = { (char *)((char *)&D_strliteral_2e1) + 0, 25U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 26U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 29U, 15U };
+static struct S_abortsites_2e466 D_abortsites_2e466 = { (char *)((char *)&D_strliteral_2e1) + 0, 11U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 12U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_implicit)))();
+	((void (*)(void))((u64)((char *)&F_explicit)))();
+	((void (*)(void))((u64)((char *)&F_storage)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	((void (*)(void))((u64)((char *)&F_interdependent)))();
+	((void (*)(void))((u64)((char *)&F_aliases)))();
+	((void (*)(void))((u64)((char *)&F_resolution__order)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_resolution__order(void) {
+	u64 t__2e13;
+	u64 t__2e17;
+	u64 t__2e18;
+	u64 t__2e19;
+	u64 t__2e20;
+	u64 t__2e21;
+	u64 t__2e24;
+	u64 t__2e27;
+	u64 t__2e30;
+	u64 t__2e33;
+	u64 t__2e36;
+	u64 t__2e39;
+	u64 t_abortsite_2e15;
+	L_start_2e7:;
+	L_body_2e8:;
+	t__2e13 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e13) goto L_passed_2e12; else goto L_failed_2e11;
+	L_failed_2e11:;
+	t_abortsite_2e15 = ((u64)0UL);
+	goto L_abort_2e16;
+	L_passed_2e12:;
+	t__2e24 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	if ((u32)t__2e24) goto L_passed_2e23; else goto L_failed_2e22;
+	L_failed_2e22:;
+	t_abortsite_2e15 = ((u64)1UL);
+	goto L_abort_2e16;
+	L_passed_2e23:;
+	t__2e27 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	if ((u32)t__2e27) goto L_passed_2e26; else goto L_failed_2e25;
+	L_failed_2e25:;
+	t_abortsite_2e15 = ((u64)2UL);
+	goto L_abort_2e16;
+	L_passed_2e26:;
+	t__2e30 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e30) goto L_passed_2e29; else goto L_failed_2e28;
+	L_failed_2e28:;
+	t_abortsite_2e15 = ((u64)3UL);
+	goto L_abort_2e16;
+	L_passed_2e29:;
+	t__2e33 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	if ((u32)t__2e33) goto L_passed_2e32; else goto L_failed_2e31;
+	L_failed_2e31:;
+	t_abortsite_2e15 = ((u64)4UL);
+	goto L_abort_2e16;
+	L_passed_2e32:;
+	t__2e36 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e36) goto L_passed_2e35; else goto L_failed_2e34;
+	L_failed_2e34:;
+	t_abortsite_2e15 = ((u64)5UL);
+	goto L_abort_2e16;
+	L_passed_2e35:;
+	t__2e39 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e39) goto L_passed_2e38; else goto L_failed_2e37;
+	L_failed_2e37:;
+	t_abortsite_2e15 = ((u64)6UL);
+	goto L_abort_2e16;
+	L_passed_2e38:;
+	goto L__2e9;
+	L__2e40:;
+	L__2e9:;
+	return;
+	L_abort_2e16:;
+	t__2e17 = (u64)((u64)t_abortsite_2e15 * (u64)((u64)16UL));
+	t__2e17 = (u64)((u64)((u64)((char *)&D_abortsites_2e14)) + (u64)t__2e17);
+	t__2e18 = (u64)(*(u64 *)t__2e17);
+	t__2e19 = (u64)((u64)t__2e17 + (u64)((u64)8UL));
+	t__2e20 = (u64)(*(u32 *)t__2e19);
+	t__2e19 = (u64)((u64)t__2e17 + (u64)((u64)12UL));
+	t__2e21 = (u64)(*(u32 *)t__2e19);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e18, (u64)t__2e20, (u64)t__2e21, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_aliases(void) {
+	u64 t__2e102;
+	u64 t__2e105;
+	u64 t__2e108;
+	u64 t__2e111;
+	u64 t__2e114;
+	u64 t__2e117;
+	u64 t__2e47;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e54;
+	u64 t__2e55;
+	u64 t__2e58;
+	u64 t__2e61;
+	u64 t__2e64;
+	u64 t__2e67;
+	u64 t__2e70;
+	u64 t__2e73;
+	u64 t__2e74;
+	u64 t__2e75;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e80;
+	u64 t__2e83;
+	u64 t__2e84;
+	u64 t__2e85;
+	u64 t__2e88;
+	u64 t__2e89;
+	u64 t__2e90;
+	u64 t__2e93;
+	u64 t__2e96;
+	u64 t__2e99;
+	u64 t_abortsite_2e49;
+	L_start_2e41:;
+	L_body_2e42:;
+	t__2e47 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e47) goto L_passed_2e46; else goto L_failed_2e45;
+	L_failed_2e45:;
+	t_abortsite_2e49 = ((u64)0UL);
+	goto L_abort_2e50;
+	L_passed_2e46:;
+	t__2e58 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e58) goto L_passed_2e57; else goto L_failed_2e56;
+	L_failed_2e56:;
+	t_abortsite_2e49 = ((u64)1UL);
+	goto L_abort_2e50;
+	L_passed_2e57:;
+	t__2e61 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	if ((u32)t__2e61) goto L_passed_2e60; else goto L_failed_2e59;
+	L_failed_2e59:;
+	t_abortsite_2e49 = ((u64)2UL);
+	goto L_abort_2e50;
+	L_passed_2e60:;
+	t__2e64 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	if ((u32)t__2e64) goto L_passed_2e63; else goto L_failed_2e62;
+	L_failed_2e62:;
+	t_abortsite_2e49 = ((u64)3UL);
+	goto L_abort_2e50;
+	L_passed_2e63:;
+	t__2e67 = (u64)(u32)(((u32)((u64)3UL) == (u32)((u64)3UL)));
+	if ((u32)t__2e67) goto L_passed_2e66; else goto L_failed_2e65;
+	L_failed_2e65:;
+	t_abortsite_2e49 = ((u64)4UL);
+	goto L_abort_2e50;
+	L_passed_2e66:;
+	t__2e70 = (u64)(u32)(((u64)((u64)1UL) == (u64)((u64)1UL)));
+	if ((u32)t__2e70) goto L_passed_2e69; else goto L_failed_2e68;
+	L_failed_2e68:;
+	t_abortsite_2e49 = ((u64)5UL);
+	goto L_abort_2e50;
+	L_passed_2e69:;
+	t__2e74 = (u64)(u32)((u8)((u64)0UL));
+	t__2e75 = (u64)(u32)((u8)((u64)0UL));
+	t__2e73 = (u64)(u32)(((u32)t__2e74 == (u32)t__2e75));
+	if ((u32)t__2e73) goto L_passed_2e72; else goto L_failed_2e71;
+	L_failed_2e71:;
+	t_abortsite_2e49 = ((u64)6UL);
+	goto L_abort_2e50;
+	L_passed_2e72:;
+	t__2e79 = (u64)(u32)((u8)((u64)1UL));
+	t__2e80 = (u64)(u32)((u8)((u64)1UL));
+	t__2e78 = (u64)(u32)(((u32)t__2e79 == (u32)t__2e80));
+	if ((u32)t__2e78) goto L_passed_2e77; else goto L_failed_2e76;
+	L_failed_2e76:;
+	t_abortsite_2e49 = ((u64)7UL);
+	goto L_abort_2e50;
+	L_passed_2e77:;
+	t__2e84 = (u64)(u32)((u8)((u64)2UL));
+	t__2e85 = (u64)(u32)((u8)((u64)2UL));
+	t__2e83 = (u64)(u32)(((u32)t__2e84 == (u32)t__2e85));
+	if ((u32)t__2e83) goto L_passed_2e82; else goto L_failed_2e81;
+	L_failed_2e81:;
+	t_abortsite_2e49 = ((u64)8UL);
+	goto L_abort_2e50;
+	L_passed_2e82:;
+	t__2e89 = (u64)(u32)((u8)((u64)3UL));
+	t__2e90 = (u64)(u32)((u8)((u64)3UL));
+	t__2e88 = (u64)(u32)(((u32)t__2e89 == (u32)t__2e90));
+	if ((u32)t__2e88) goto L_passed_2e87; else goto L_failed_2e86;
+	L_failed_2e86:;
+	t_abortsite_2e49 = ((u64)9UL);
+	goto L_abort_2e50;
+	L_passed_2e87:;
+	t__2e93 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	if ((u32)t__2e93) goto L_passed_2e92; else goto L_failed_2e91;
+	L_failed_2e91:;
+	t_abortsite_2e49 = ((u64)10UL);
+	goto L_abort_2e50;
+	L_passed_2e92:;
+	t__2e96 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	if ((u32)t__2e96) goto L_passed_2e95; else goto L_failed_2e94;
+	L_failed_2e94:;
+	t_abortsite_2e49 = ((u64)11UL);
+	goto L_abort_2e50;
+	L_passed_2e95:;
+	t__2e99 = (u64)(u32)(((u32)((u64)3UL) == (u32)((u64)3UL)));
+	if ((u32)t__2e99) goto L_passed_2e98; else goto L_failed_2e97;
+	L_failed_2e97:;
+	t_abortsite_2e49 = ((u64)12UL);
+	goto L_abort_2e50;
+	L_passed_2e98:;
+	t__2e102 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	if ((u32)t__2e102) goto L_passed_2e101; else goto L_failed_2e100;
+	L_failed_2e100:;
+	t_abortsite_2e49 = ((u64)13UL);
+	goto L_abort_2e50;
+	L_passed_2e101:;
+	t__2e105 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	if ((u32)t__2e105) goto L_passed_2e104; else goto L_failed_2e103;
+	L_failed_2e103:;
+	t_abortsite_2e49 = ((u64)14UL);
+	goto L_abort_2e50;
+	L_passed_2e104:;
+	t__2e108 = (u64)(u32)(((u32)((u64)3UL) == (u32)((u64)3UL)));
+	if ((u32)t__2e108) goto L_passed_2e107; else goto L_failed_2e106;
+	L_failed_2e106:;
+	t_abortsite_2e49 = ((u64)15UL);
+	goto L_abort_2e50;
+	L_passed_2e107:;
+	t__2e111 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	if ((u32)t__2e111) goto L_passed_2e110; else goto L_failed_2e109;
+	L_failed_2e109:;
+	t_abortsite_2e49 = ((u64)16UL);
+	goto L_abort_2e50;
+	L_passed_2e110:;
+	t__2e114 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	if ((u32)t__2e114) goto L_passed_2e113; else goto L_failed_2e112;
+	L_failed_2e112:;
+	t_abortsite_2e49 = ((u64)17UL);
+	goto L_abort_2e50;
+	L_passed_2e113:;
+	t__2e117 = (u64)(u32)(((u32)((u64)3UL) == (u32)((u64)3UL)));
+	if ((u32)t__2e117) goto L_passed_2e116; else goto L_failed_2e115;
+	L_failed_2e115:;
+	t_abortsite_2e49 = ((u64)18UL);
+	goto L_abort_2e50;
+	L_passed_2e116:;
+	goto L__2e43;
+	L__2e118:;
+	L__2e43:;
+	return;
+	L_abort_2e50:;
+	t__2e51 = (u64)((u64)t_abortsite_2e49 * (u64)((u64)16UL));
+	t__2e51 = (u64)((u64)((u64)((char *)&D_abortsites_2e48)) + (u64)t__2e51);
+	t__2e52 = (u64)(*(u64 *)t__2e51);
+	t__2e53 = (u64)((u64)t__2e51 + (u64)((u64)8UL));
+	t__2e54 = (u64)(*(u32 *)t__2e53);
+	t__2e53 = (u64)((u64)t__2e51 + (u64)((u64)12UL));
+	t__2e55 = (u64)(*(u32 *)t__2e53);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e52, (u64)t__2e54, (u64)t__2e55, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_interdependent(void) {
+	u64 t__2e125;
+	u64 t__2e129;
+	u64 t__2e130;
+	u64 t__2e131;
+	u64 t__2e132;
+	u64 t__2e133;
+	u64 t__2e136;
+	u64 t__2e139;
+	u64 t__2e142;
+	u64 t__2e145;
+	u64 t__2e148;
+	u64 t_abortsite_2e127;
+	L_start_2e119:;
+	L_body_2e120:;
+	t__2e125 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e125) goto L_passed_2e124; else goto L_failed_2e123;
+	L_failed_2e123:;
+	t_abortsite_2e127 = ((u64)0UL);
+	goto L_abort_2e128;
+	L_passed_2e124:;
+	t__2e136 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	if ((u32)t__2e136) goto L_passed_2e135; else goto L_failed_2e134;
+	L_failed_2e134:;
+	t_abortsite_2e127 = ((u64)1UL);
+	goto L_abort_2e128;
+	L_passed_2e135:;
+	t__2e139 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	if ((u32)t__2e139) goto L_passed_2e138; else goto L_failed_2e137;
+	L_failed_2e137:;
+	t_abortsite_2e127 = ((u64)2UL);
+	goto L_abort_2e128;
+	L_passed_2e138:;
+	t__2e142 = (u64)(u32)(((u32)((u64)3UL) == (u32)((u64)3UL)));
+	if ((u32)t__2e142) goto L_passed_2e141; else goto L_failed_2e140;
+	L_failed_2e140:;
+	t_abortsite_2e127 = ((u64)3UL);
+	goto L_abort_2e128;
+	L_passed_2e141:;
+	t__2e145 = (u64)(u32)(((u32)((u64)4UL) == (u32)((u64)4UL)));
+	if ((u32)t__2e145) goto L_passed_2e144; else goto L_failed_2e143;
+	L_failed_2e143:;
+	t_abortsite_2e127 = ((u64)4UL);
+	goto L_abort_2e128;
+	L_passed_2e144:;
+	t__2e148 = (u64)(u32)(((u32)((u64)5UL) == (u32)((u64)5UL)));
+	if ((u32)t__2e148) goto L_passed_2e147; else goto L_failed_2e146;
+	L_failed_2e146:;
+	t_abortsite_2e127 = ((u64)5UL);
+	goto L_abort_2e128;
+	L_passed_2e147:;
+	goto L__2e121;
+	L__2e149:;
+	L__2e121:;
+	return;
+	L_abort_2e128:;
+	t__2e129 = (u64)((u64)t_abortsite_2e127 * (u64)((u64)16UL));
+	t__2e129 = (u64)((u64)((u64)((char *)&D_abortsites_2e126)) + (u64)t__2e129);
+	t__2e130 = (u64)(*(u64 *)t__2e129);
+	t__2e131 = (u64)((u64)t__2e129 + (u64)((u64)8UL));
+	t__2e132 = (u64)(*(u32 *)t__2e131);
+	t__2e131 = (u64)((u64)t__2e129 + (u64)((u64)12UL));
+	t__2e133 = (u64)(*(u32 *)t__2e131);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e130, (u64)t__2e132, (u64)t__2e133, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_reject(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char B16[8] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char R19[4] __attribute__((aligned(16)));
+	char B20[8] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char R23[4] __attribute__((aligned(16)));
+	char B24[8] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char R27[4] __attribute__((aligned(16)));
+	char B28[8] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char R31[4] __attribute__((aligned(16)));
+	char B32[8] __attribute__((aligned(16)));
+	char B33[24] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char R35[4] __attribute__((aligned(16)));
+	char B36[8] __attribute__((aligned(16)));
+	char B37[24] __attribute__((aligned(16)));
+	char B38[24] __attribute__((aligned(16)));
+	char R39[4] __attribute__((aligned(16)));
+	char B40[8] __attribute__((aligned(16)));
+	char B41[24] __attribute__((aligned(16)));
+	char B42[24] __attribute__((aligned(16)));
+	char R43[4] __attribute__((aligned(16)));
+	char B44[8] __attribute__((aligned(16)));
+	char B45[24] __attribute__((aligned(16)));
+	char B46[24] __attribute__((aligned(16)));
+	char R47[4] __attribute__((aligned(16)));
+	u64 t__2e155;
+	u64 t__2e161;
+	u64 t__2e167;
+	u64 t__2e176;
+	u64 t__2e178;
+	u64 t__2e182;
+	u64 t__2e183;
+	u64 t__2e184;
+	u64 t__2e185;
+	u64 t__2e186;
+	u64 t__2e189;
+	u64 t__2e190;
+	u64 t__2e191;
+	u64 t__2e192;
+	u64 t__2e193;
+	u64 t__2e195;
+	u64 t__2e197;
+	u64 t__2e201;
+	u64 t__2e210;
+	u64 t__2e212;
+	u64 t__2e215;
+	u64 t__2e217;
+	u64 t__2e221;
+	u64 t__2e230;
+	u64 t__2e232;
+	u64 t__2e235;
+	u64 t__2e237;
+	u64 t__2e241;
+	u64 t__2e250;
+	u64 t__2e252;
+	u64 t__2e255;
+	u64 t__2e257;
+	u64 t__2e261;
+	u64 t__2e270;
+	u64 t__2e272;
+	u64 t__2e275;
+	u64 t__2e277;
+	u64 t__2e281;
+	u64 t__2e290;
+	u64 t__2e292;
+	u64 t__2e295;
+	u64 t__2e297;
+	u64 t__2e301;
+	u64 t__2e310;
+	u64 t__2e312;
+	u64 t__2e315;
+	u64 t__2e317;
+	u64 t__2e321;
+	u64 t__2e330;
+	u64 t__2e332;
+	u64 t_abortsite_2e180;
+	u64 t_object_2e157;
+	u64 t_object_2e165;
+	u64 t_object_2e196;
+	u64 t_object_2e200;
+	u64 t_object_2e216;
+	u64 t_object_2e220;
+	u64 t_object_2e236;
+	u64 t_object_2e240;
+	u64 t_object_2e256;
+	u64 t_object_2e260;
+	u64 t_object_2e276;
+	u64 t_object_2e280;
+	u64 t_object_2e296;
+	u64 t_object_2e300;
+	u64 t_object_2e316;
+	u64 t_object_2e320;
+	u64 t_tag_2e168;
+	u64 t_tag_2e202;
+	u64 t_tag_2e222;
+	u64 t_tag_2e242;
+	u64 t_tag_2e262;
+	u64 t_tag_2e282;
+	u64 t_tag_2e302;
+	u64 t_tag_2e322;
+	L_start_2e150:;
+	t_object_2e157 = (u64)A0;
+	t_object_2e165 = (u64)A1;
+	t_object_2e196 = (u64)A2;
+	t_object_2e200 = (u64)A3;
+	t_object_2e216 = (u64)A4;
+	t_object_2e220 = (u64)A5;
+	t_object_2e236 = (u64)A6;
+	t_object_2e240 = (u64)A7;
+	t_object_2e256 = (u64)A8;
+	t_object_2e260 = (u64)A9;
+	t_object_2e276 = (u64)A10;
+	t_object_2e280 = (u64)A11;
+	t_object_2e296 = (u64)A12;
+	t_object_2e300 = (u64)A13;
+	t_object_2e316 = (u64)A14;
+	t_object_2e320 = (u64)A15;
+	L_body_2e151:;
+	*(u32 *)t_object_2e157 = (u32)((u64)3532310079UL);
+	t__2e161 = (u64)((u64)t_object_2e157 + (u64)((u64)4UL));
+	*(u32 *)t__2e161 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e165 = (u64)((u64)0UL);
+	t__2e167 = (u64)((u64)t_object_2e165 + (u64)((u64)8UL));
+	*(u64 *)t__2e167 = (u64)((u64)0UL);
+	t__2e167 = (u64)((u64)t__2e167 + (u64)((u64)8UL));
+	*(u64 *)t__2e167 = (u64)((u64)0UL);
+	BLIT((u64)B16, t_object_2e157, 8);
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e163)), 24);
+	BLIT((u64)B18, t_object_2e165, 24);
+	t__2e155 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R19, (u64)B16, (u64)B17, (u64)B18);
+	t_tag_2e168 = (u64)(*(u32 *)t__2e155);
+	t__2e176 = (u64)(u32)(((u32)t_tag_2e168 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e176) goto L_member_2e173; else goto L__2e175;
+	L__2e175:;
+	t__2e178 = (u64)(u32)(((u32)t_tag_2e168 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e178) goto L_member_2e174; else goto L__2e177;
+	L__2e177:;
+	goto L_matches_2e172;
+	L_member_2e173:;
+	goto L_matches_2e172;
+	L_member_2e174:;
+	goto L_matches_2e171;
+	L_matches_2e171:;
+	goto L__2e169;
+	L_matches_2e172:;
+	t_abortsite_2e180 = ((u64)0UL);
+	goto L_abort_2e181;
+	L__2e187:;
+	L__2e170:;
+	t_abortsite_2e180 = ((u64)1UL);
+	goto L_abort_2e188;
+	L__2e169:;
+	*(u32 *)t_object_2e196 = (u32)((u64)3532310079UL);
+	t__2e197 = (u64)((u64)t_object_2e196 + (u64)((u64)4UL));
+	*(u32 *)t__2e197 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e200 = (u64)((u64)0UL);
+	t__2e201 = (u64)((u64)t_object_2e200 + (u64)((u64)8UL));
+	*(u64 *)t__2e201 = (u64)((u64)0UL);
+	t__2e201 = (u64)((u64)t__2e201 + (u64)((u64)8UL));
+	*(u64 *)t__2e201 = (u64)((u64)0UL);
+	BLIT((u64)B20, t_object_2e196, 8);
+	BLIT((u64)B21, ((u64)((char *)&D_strliteral_2e199)), 24);
+	BLIT((u64)B22, t_object_2e200, 24);
+	t__2e195 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R23, (u64)B20, (u64)B21, (u64)B22);
+	t_tag_2e202 = (u64)(*(u32 *)t__2e195);
+	t__2e210 = (u64)(u32)(((u32)t_tag_2e202 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e210) goto L_member_2e207; else goto L__2e209;
+	L__2e209:;
+	t__2e212 = (u64)(u32)(((u32)t_tag_2e202 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e212) goto L_member_2e208; else goto L__2e211;
+	L__2e211:;
+	goto L_matches_2e206;
+	L_member_2e207:;
+	goto L_matches_2e206;
+	L_member_2e208:;
+	goto L_matches_2e205;
+	L_matches_2e205:;
+	goto L__2e203;
+	L_matches_2e206:;
+	t_abortsite_2e180 = ((u64)2UL);
+	goto L_abort_2e181;
+	L__2e213:;
+	L__2e204:;
+	t_abortsite_2e180 = ((u64)3UL);
+	goto L_abort_2e188;
+	L__2e203:;
+	*(u32 *)t_object_2e216 = (u32)((u64)3532310079UL);
+	t__2e217 = (u64)((u64)t_object_2e216 + (u64)((u64)4UL));
+	*(u32 *)t__2e217 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e220 = (u64)((u64)0UL);
+	t__2e221 = (u64)((u64)t_object_2e220 + (u64)((u64)8UL));
+	*(u64 *)t__2e221 = (u64)((u64)0UL);
+	t__2e221 = (u64)((u64)t__2e221 + (u64)((u64)8UL));
+	*(u64 *)t__2e221 = (u64)((u64)0UL);
+	BLIT((u64)B24, t_object_2e216, 8);
+	BLIT((u64)B25, ((u64)((char *)&D_strliteral_2e219)), 24);
+	BLIT((u64)B26, t_object_2e220, 24);
+	t__2e215 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R27, (u64)B24, (u64)B25, (u64)B26);
+	t_tag_2e222 = (u64)(*(u32 *)t__2e215);
+	t__2e230 = (u64)(u32)(((u32)t_tag_2e222 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e230) goto L_member_2e227; else goto L__2e229;
+	L__2e229:;
+	t__2e232 = (u64)(u32)(((u32)t_tag_2e222 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e232) goto L_member_2e228; else goto L__2e231;
+	L__2e231:;
+	goto L_matches_2e226;
+	L_member_2e227:;
+	goto L_matches_2e226;
+	L_member_2e228:;
+	goto L_matches_2e225;
+	L_matches_2e225:;
+	goto L__2e223;
+	L_matches_2e226:;
+	t_abortsite_2e180 = ((u64)4UL);
+	goto L_abort_2e181;
+	L__2e233:;
+	L__2e224:;
+	t_abortsite_2e180 = ((u64)5UL);
+	goto L_abort_2e188;
+	L__2e223:;
+	*(u32 *)t_object_2e236 = (u32)((u64)3532310079UL);
+	t__2e237 = (u64)((u64)t_object_2e236 + (u64)((u64)4UL));
+	*(u32 *)t__2e237 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e240 = (u64)((u64)0UL);
+	t__2e241 = (u64)((u64)t_object_2e240 + (u64)((u64)8UL));
+	*(u64 *)t__2e241 = (u64)((u64)0UL);
+	t__2e241 = (u64)((u64)t__2e241 + (u64)((u64)8UL));
+	*(u64 *)t__2e241 = (u64)((u64)0UL);
+	BLIT((u64)B28, t_object_2e236, 8);
+	BLIT((u64)B29, ((u64)((char *)&D_strliteral_2e239)), 24);
+	BLIT((u64)B30, t_object_2e240, 24);
+	t__2e235 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R31, (u64)B28, (u64)B29, (u64)B30);
+	t_tag_2e242 = (u64)(*(u32 *)t__2e235);
+	t__2e250 = (u64)(u32)(((u32)t_tag_2e242 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e250) goto L_member_2e247; else goto L__2e249;
+	L__2e249:;
+	t__2e252 = (u64)(u32)(((u32)t_tag_2e242 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e252) goto L_member_2e248; else goto L__2e251;
+	L__2e251:;
+	goto L_matches_2e246;
+	L_member_2e247:;
+	goto L_matches_2e246;
+	L_member_2e248:;
+	goto L_matches_2e245;
+	L_matches_2e245:;
+	goto L__2e243;
+	L_matches_2e246:;
+	t_abortsite_2e180 = ((u64)6UL);
+	goto L_abort_2e181;
+	L__2e253:;
+	L__2e244:;
+	t_abortsite_2e180 = ((u64)7UL);
+	goto L_abort_2e188;
+	L__2e243:;
+	*(u32 *)t_object_2e256 = (u32)((u64)3532310079UL);
+	t__2e257 = (u64)((u64)t_object_2e256 + (u64)((u64)4UL));
+	*(u32 *)t__2e257 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e260 = (u64)((u64)0UL);
+	t__2e261 = (u64)((u64)t_object_2e260 + (u64)((u64)8UL));
+	*(u64 *)t__2e261 = (u64)((u64)0UL);
+	t__2e261 = (u64)((u64)t__2e261 + (u64)((u64)8UL));
+	*(u64 *)t__2e261 = (u64)((u64)0UL);
+	BLIT((u64)B32, t_object_2e256, 8);
+	BLIT((u64)B33, ((u64)((char *)&D_strliteral_2e259)), 24);
+	BLIT((u64)B34, t_object_2e260, 24);
+	t__2e255 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R35, (u64)B32, (u64)B33, (u64)B34);
+	t_tag_2e262 = (u64)(*(u32 *)t__2e255);
+	t__2e270 = (u64)(u32)(((u32)t_tag_2e262 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e270) goto L_member_2e267; else goto L__2e269;
+	L__2e269:;
+	t__2e272 = (u64)(u32)(((u32)t_tag_2e262 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e272) goto L_member_2e268; else goto L__2e271;
+	L__2e271:;
+	goto L_matches_2e266;
+	L_member_2e267:;
+	goto L_matches_2e266;
+	L_member_2e268:;
+	goto L_matches_2e265;
+	L_matches_2e265:;
+	goto L__2e263;
+	L_matches_2e266:;
+	t_abortsite_2e180 = ((u64)8UL);
+	goto L_abort_2e181;
+	L__2e273:;
+	L__2e264:;
+	t_abortsite_2e180 = ((u64)9UL);
+	goto L_abort_2e188;
+	L__2e263:;
+	*(u32 *)t_object_2e276 = (u32)((u64)3532310079UL);
+	t__2e277 = (u64)((u64)t_object_2e276 + (u64)((u64)4UL));
+	*(u32 *)t__2e277 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e280 = (u64)((u64)0UL);
+	t__2e281 = (u64)((u64)t_object_2e280 + (u64)((u64)8UL));
+	*(u64 *)t__2e281 = (u64)((u64)0UL);
+	t__2e281 = (u64)((u64)t__2e281 + (u64)((u64)8UL));
+	*(u64 *)t__2e281 = (u64)((u64)0UL);
+	BLIT((u64)B36, t_object_2e276, 8);
+	BLIT((u64)B37, ((u64)((char *)&D_strliteral_2e279)), 24);
+	BLIT((u64)B38, t_object_2e280, 24);
+	t__2e275 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R39, (u64)B36, (u64)B37, (u64)B38);
+	t_tag_2e282 = (u64)(*(u32 *)t__2e275);
+	t__2e290 = (u64)(u32)(((u32)t_tag_2e282 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e290) goto L_member_2e287; else goto L__2e289;
+	L__2e289:;
+	t__2e292 = (u64)(u32)(((u32)t_tag_2e282 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e292) goto L_member_2e288; else goto L__2e291;
+	L__2e291:;
+	goto L_matches_2e286;
+	L_member_2e287:;
+	goto L_matches_2e286;
+	L_member_2e288:;
+	goto L_matches_2e285;
+	L_matches_2e285:;
+	goto L__2e283;
+	L_matches_2e286:;
+	t_abortsite_2e180 = ((u64)10UL);
+	goto L_abort_2e181;
+	L__2e293:;
+	L__2e284:;
+	t_abortsite_2e180 = ((u64)11UL);
+	goto L_abort_2e188;
+	L__2e283:;
+	*(u32 *)t_object_2e296 = (u32)((u64)3532310079UL);
+	t__2e297 = (u64)((u64)t_object_2e296 + (u64)((u64)4UL));
+	*(u32 *)t__2e297 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e300 = (u64)((u64)0UL);
+	t__2e301 = (u64)((u64)t_object_2e300 + (u64)((u64)8UL));
+	*(u64 *)t__2e301 = (u64)((u64)0UL);
+	t__2e301 = (u64)((u64)t__2e301 + (u64)((u64)8UL));
+	*(u64 *)t__2e301 = (u64)((u64)0UL);
+	BLIT((u64)B40, t_object_2e296, 8);
+	BLIT((u64)B41, ((u64)((char *)&D_strliteral_2e299)), 24);
+	BLIT((u64)B42, t_object_2e300, 24);
+	t__2e295 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R43, (u64)B40, (u64)B41, (u64)B42);
+	t_tag_2e302 = (u64)(*(u32 *)t__2e295);
+	t__2e310 = (u64)(u32)(((u32)t_tag_2e302 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e310) goto L_member_2e307; else goto L__2e309;
+	L__2e309:;
+	t__2e312 = (u64)(u32)(((u32)t_tag_2e302 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e312) goto L_member_2e308; else goto L__2e311;
+	L__2e311:;
+	goto L_matches_2e306;
+	L_member_2e307:;
+	goto L_matches_2e306;
+	L_member_2e308:;
+	goto L_matches_2e305;
+	L_matches_2e305:;
+	goto L__2e303;
+	L_matches_2e306:;
+	t_abortsite_2e180 = ((u64)12UL);
+	goto L_abort_2e181;
+	L__2e313:;
+	L__2e304:;
+	t_abortsite_2e180 = ((u64)13UL);
+	goto L_abort_2e188;
+	L__2e303:;
+	*(u32 *)t_object_2e316 = (u32)((u64)3532310079UL);
+	t__2e317 = (u64)((u64)t_object_2e316 + (u64)((u64)4UL));
+	*(u32 *)t__2e317 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e320 = (u64)((u64)0UL);
+	t__2e321 = (u64)((u64)t_object_2e320 + (u64)((u64)8UL));
+	*(u64 *)t__2e321 = (u64)((u64)0UL);
+	t__2e321 = (u64)((u64)t__2e321 + (u64)((u64)8UL));
+	*(u64 *)t__2e321 = (u64)((u64)0UL);
+	BLIT((u64)B44, t_object_2e316, 8);
+	BLIT((u64)B45, ((u64)((char *)&D_strliteral_2e319)), 24);
+	BLIT((u64)B46, t_object_2e320, 24);
+	t__2e315 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R47, (u64)B44, (u64)B45, (u64)B46);
+	t_tag_2e322 = (u64)(*(u32 *)t__2e315);
+	t__2e330 = (u64)(u32)(((u32)t_tag_2e322 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e330) goto L_member_2e327; else goto L__2e329;
+	L__2e329:;
+	t__2e332 = (u64)(u32)(((u32)t_tag_2e322 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e332) goto L_member_2e328; else goto L__2e331;
+	L__2e331:;
+	goto L_matches_2e326;
+	L_member_2e327:;
+	goto L_matches_2e326;
+	L_member_2e328:;
+	goto L_matches_2e325;
+	L_matches_2e325:;
+	goto L__2e323;
+	L_matches_2e326:;
+	t_abortsite_2e180 = ((u64)14UL);
+	goto L_abort_2e181;
+	L__2e333:;
+	L__2e324:;
+	t_abortsite_2e180 = ((u64)15UL);
+	goto L_abort_2e188;
+	L__2e323:;
+	goto L__2e152;
+	L__2e334:;
+	L__2e152:;
+	return;
+	L_abort_2e181:;
+	t__2e182 = (u64)((u64)t_abortsite_2e180 * (u64)((u64)16UL));
+	t__2e182 = (u64)((u64)((u64)((char *)&D_abortsites_2e179)) + (u64)t__2e182);
+	t__2e183 = (u64)(*(u64 *)t__2e182);
+	t__2e184 = (u64)((u64)t__2e182 + (u64)((u64)8UL));
+	t__2e185 = (u64)(*(u32 *)t__2e184);
+	t__2e184 = (u64)((u64)t__2e182 + (u64)((u64)12UL));
+	t__2e186 = (u64)(*(u32 *)t__2e184);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e183, (u64)t__2e185, (u64)t__2e186, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e188:;
+	t__2e189 = (u64)((u64)t_abortsite_2e180 * (u64)((u64)16UL));
+	t__2e189 = (u64)((u64)((u64)((char *)&D_abortsites_2e179)) + (u64)t__2e189);
+	t__2e190 = (u64)(*(u64 *)t__2e189);
+	t__2e191 = (u64)((u64)t__2e189 + (u64)((u64)8UL));
+	t__2e192 = (u64)(*(u32 *)t__2e191);
+	t__2e191 = (u64)((u64)t__2e189 + (u64)((u64)12UL));
+	t__2e193 = (u64)(*(u32 *)t__2e191);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e190, (u64)t__2e192, (u64)t__2e193, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_storage(void) {
+	char A0[2] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	u64 t__2e341;
+	u64 t__2e345;
+	u64 t__2e346;
+	u64 t__2e347;
+	u64 t__2e348;
+	u64 t__2e349;
+	u64 t__2e352;
+	u64 t__2e355;
+	u64 t__2e358;
+	u64 t__2e361;
+	u64 t__2e364;
+	u64 t__2e367;
+	u64 t__2e368;
+	u64 t__2e370;
+	u64 t__2e371;
+	u64 t__2e372;
+	u64 t__2e373;
+	u64 t__2e376;
+	u64 t__2e377;
+	u64 t__2e378;
+	u64 t__2e382;
+	u64 t__2e383;
+	u64 t__2e384;
+	u64 t__2e385;
+	u64 t__2e388;
+	u64 t__2e389;
+	u64 t__2e390;
+	u64 t__2e394;
+	u64 t__2e395;
+	u64 t__2e396;
+	u64 t__2e397;
+	u64 t__2e400;
+	u64 t__2e401;
+	u64 t__2e402;
+	u64 t__2e406;
+	u64 t__2e407;
+	u64 t__2e408;
+	u64 t__2e409;
+	u64 t__2e412;
+	u64 t__2e413;
+	u64 t__2e414;
+	u64 t__2e418;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e421;
+	u64 t__2e424;
+	u64 t__2e427;
+	u64 t__2e428;
+	u64 t_abortsite_2e343;
+	u64 t_binding_2e365;
+	u64 t_binding_2e366;
+	L_start_2e335:;
+	t_binding_2e365 = (u64)A0;
+	t_binding_2e366 = (u64)A1;
+	L_body_2e336:;
+	t__2e341 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e341) goto L_passed_2e340; else goto L_failed_2e339;
+	L_failed_2e339:;
+	t_abortsite_2e343 = ((u64)0UL);
+	goto L_abort_2e344;
+	L_passed_2e340:;
+	t__2e352 = (u64)(u32)(((u64)((u64)2UL) == (u64)((u64)2UL)));
+	if ((u32)t__2e352) goto L_passed_2e351; else goto L_failed_2e350;
+	L_failed_2e350:;
+	t_abortsite_2e343 = ((u64)1UL);
+	goto L_abort_2e344;
+	L_passed_2e351:;
+	t__2e355 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e355) goto L_passed_2e354; else goto L_failed_2e353;
+	L_failed_2e353:;
+	t_abortsite_2e343 = ((u64)2UL);
+	goto L_abort_2e344;
+	L_passed_2e354:;
+	t__2e358 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e358) goto L_passed_2e357; else goto L_failed_2e356;
+	L_failed_2e356:;
+	t_abortsite_2e343 = ((u64)3UL);
+	goto L_abort_2e344;
+	L_passed_2e357:;
+	t__2e361 = (u64)(u32)(((u64)((u64)2UL) == (u64)((u64)2UL)));
+	if ((u32)t__2e361) goto L_passed_2e360; else goto L_failed_2e359;
+	L_failed_2e359:;
+	t_abortsite_2e343 = ((u64)4UL);
+	goto L_abort_2e344;
+	L_passed_2e360:;
+	t__2e364 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e364) goto L_passed_2e363; else goto L_failed_2e362;
+	L_failed_2e362:;
+	t_abortsite_2e343 = ((u64)5UL);
+	goto L_abort_2e344;
+	L_passed_2e363:;
+	*(u16 *)t_binding_2e365 = (u16)((u64)48879UL);
+	t__2e370 = (u64)((i64)(i32)((u64)0UL));
+	t__2e368 = (u64)((u64)t__2e370 * (u64)((u64)1UL));
+	t__2e368 = (u64)((u64)t_binding_2e365 + (u64)t__2e368);
+	t__2e371 = (u64)(u32)(*(u8 *)t__2e368);
+	t__2e372 = (u64)(u32)((u8)t__2e371);
+	t__2e373 = (u64)(u32)((u8)((u64)239UL));
+	t__2e367 = (u64)(u32)(((u32)t__2e372 == (u32)t__2e373));
+	*(u8 *)t_binding_2e366 = (u8)t__2e367;
+	t__2e377 = (u64)(u32)((u64)51966UL);
+	t__2e382 = (u64)(u32)(*(u8 *)t_binding_2e366);
+	t__2e383 = (u64)(u32)((u8)t__2e382);
+	if ((u32)t__2e383) goto L_true_2e379; else goto L_false_2e380;
+	L_true_2e379:;
+	t__2e378 = (u64)(u32)((u64)254UL);
+	goto L__2e381;
+	L_false_2e380:;
+	t__2e378 = (u64)(u32)((u64)202UL);
+	L__2e381:;
+	t__2e384 = (u64)(u32)((u8)t__2e377);
+	t__2e385 = (u64)(u32)((u8)t__2e378);
+	t__2e376 = (u64)(u32)(((u32)t__2e384 == (u32)t__2e385));
+	if ((u32)t__2e376) goto L_passed_2e375; else goto L_failed_2e374;
+	L_failed_2e374:;
+	t_abortsite_2e343 = ((u64)6UL);
+	goto L_abort_2e344;
+	L_passed_2e375:;
+	t__2e389 = (u64)(u32)((u64)47806UL);
+	t__2e394 = (u64)(u32)(*(u8 *)t_binding_2e366);
+	t__2e395 = (u64)(u32)((u8)t__2e394);
+	if ((u32)t__2e395) goto L_true_2e391; else goto L_false_2e392;
+	L_true_2e391:;
+	t__2e390 = (u64)(u32)((u64)190UL);
+	goto L__2e393;
+	L_false_2e392:;
+	t__2e390 = (u64)(u32)((u64)186UL);
+	L__2e393:;
+	t__2e396 = (u64)(u32)((u8)t__2e389);
+	t__2e397 = (u64)(u32)((u8)t__2e390);
+	t__2e388 = (u64)(u32)(((u32)t__2e396 == (u32)t__2e397));
+	if ((u32)t__2e388) goto L_passed_2e387; else goto L_failed_2e386;
+	L_failed_2e386:;
+	t_abortsite_2e343 = ((u64)7UL);
+	goto L_abort_2e344;
+	L_passed_2e387:;
+	t__2e401 = (u64)(u32)((u64)57005UL);
+	t__2e406 = (u64)(u32)(*(u8 *)t_binding_2e366);
+	t__2e407 = (u64)(u32)((u8)t__2e406);
+	if ((u32)t__2e407) goto L_true_2e403; else goto L_false_2e404;
+	L_true_2e403:;
+	t__2e402 = (u64)(u32)((u64)173UL);
+	goto L__2e405;
+	L_false_2e404:;
+	t__2e402 = (u64)(u32)((u64)222UL);
+	L__2e405:;
+	t__2e408 = (u64)(u32)((u8)t__2e401);
+	t__2e409 = (u64)(u32)((u8)t__2e402);
+	t__2e400 = (u64)(u32)(((u32)t__2e408 == (u32)t__2e409));
+	if ((u32)t__2e400) goto L_passed_2e399; else goto L_failed_2e398;
+	L_failed_2e398:;
+	t_abortsite_2e343 = ((u64)8UL);
+	goto L_abort_2e344;
+	L_passed_2e399:;
+	t__2e413 = (u64)(u32)((u64)48879UL);
+	t__2e418 = (u64)(u32)(*(u8 *)t_binding_2e366);
+	t__2e419 = (u64)(u32)((u8)t__2e418);
+	if ((u32)t__2e419) goto L_true_2e415; else goto L_false_2e416;
+	L_true_2e415:;
+	t__2e414 = (u64)(u32)((u64)239UL);
+	goto L__2e417;
+	L_false_2e416:;
+	t__2e414 = (u64)(u32)((u64)190UL);
+	L__2e417:;
+	t__2e420 = (u64)(u32)((u8)t__2e413);
+	t__2e421 = (u64)(u32)((u8)t__2e414);
+	t__2e412 = (u64)(u32)(((u32)t__2e420 == (u32)t__2e421));
+	if ((u32)t__2e412) goto L_passed_2e411; else goto L_failed_2e410;
+	L_failed_2e410:;
+	t_abortsite_2e343 = ((u64)9UL);
+	goto L_abort_2e344;
+	L_passed_2e411:;
+	t__2e427 = (u64)(u32)(((u32)((u64)48UL) == (u32)((u64)48UL)));
+	t__2e424 = (u64)(u32)t__2e427;
+	if ((u32)t__2e424) goto L__2e425; else goto L__2e426;
+	L__2e425:;
+	t__2e428 = (u64)(u32)(((u32)((u64)49UL) == (u32)((u64)49UL)));
+	t__2e424 = (u64)(u32)t__2e428;
+	goto L__2e426;
+	L__2e426:;
+	if ((u32)t__2e424) goto L_passed_2e423; else goto L_failed_2e422;
+	L_failed_2e422:;
+	t_abortsite_2e343 = ((u64)10UL);
+	goto L_abort_2e344;
+	L_passed_2e423:;
+	goto L__2e337;
+	L__2e429:;
+	L__2e337:;
+	return;
+	L_abort_2e344:;
+	t__2e345 = (u64)((u64)t_abortsite_2e343 * (u64)((u64)16UL));
+	t__2e345 = (u64)((u64)((u64)((char *)&D_abortsites_2e342)) + (u64)t__2e345);
+	t__2e346 = (u64)(*(u64 *)t__2e345);
+	t__2e347 = (u64)((u64)t__2e345 + (u64)((u64)8UL));
+	t__2e348 = (u64)(*(u32 *)t__2e347);
+	t__2e347 = (u64)((u64)t__2e345 + (u64)((u64)12UL));
+	t__2e349 = (u64)(*(u32 *)t__2e347);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e346, (u64)t__2e348, (u64)t__2e349, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_explicit(void) {
+	u64 t__2e436;
+	u64 t__2e437;
+	u64 t__2e441;
+	u64 t__2e442;
+	u64 t__2e443;
+	u64 t__2e444;
+	u64 t__2e445;
+	u64 t__2e448;
+	u64 t__2e451;
+	u64 t__2e454;
+	u64 t__2e457;
+	u64 t_abortsite_2e439;
+	L_start_2e430:;
+	L_body_2e431:;
+	t__2e437 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e436 = (u64)(u32)(((u32)((u64)4294967295UL) == (u32)t__2e437));
+	if ((u32)t__2e436) goto L_passed_2e435; else goto L_failed_2e434;
+	L_failed_2e434:;
+	t_abortsite_2e439 = ((u64)0UL);
+	goto L_abort_2e440;
+	L_passed_2e435:;
+	t__2e448 = (u64)(u32)(((u32)((u64)16UL) == (u32)((u64)16UL)));
+	if ((u32)t__2e448) goto L_passed_2e447; else goto L_failed_2e446;
+	L_failed_2e446:;
+	t_abortsite_2e439 = ((u64)1UL);
+	goto L_abort_2e440;
+	L_passed_2e447:;
+	t__2e451 = (u64)(u32)(((u32)((u64)17UL) == (u32)((u64)17UL)));
+	if ((u32)t__2e451) goto L_passed_2e450; else goto L_failed_2e449;
+	L_failed_2e449:;
+	t_abortsite_2e439 = ((u64)2UL);
+	goto L_abort_2e440;
+	L_passed_2e450:;
+	t__2e454 = (u64)(u32)(((u32)((u64)18UL) == (u32)((u64)18UL)));
+	if ((u32)t__2e454) goto L_passed_2e453; else goto L_failed_2e452;
+	L_failed_2e452:;
+	t_abortsite_2e439 = ((u64)3UL);
+	goto L_abort_2e440;
+	L_passed_2e453:;
+	t__2e457 = (u64)(u32)(((u32)((u64)50UL) == (u32)((u64)50UL)));
+	if ((u32)t__2e457) goto L_passed_2e456; else goto L_failed_2e455;
+	L_failed_2e455:;
+	t_abortsite_2e439 = ((u64)4UL);
+	goto L_abort_2e440;
+	L_passed_2e456:;
+	goto L__2e432;
+	L__2e458:;
+	L__2e432:;
+	return;
+	L_abort_2e440:;
+	t__2e441 = (u64)((u64)t_abortsite_2e439 * (u64)((u64)16UL));
+	t__2e441 = (u64)((u64)((u64)((char *)&D_abortsites_2e438)) + (u64)t__2e441);
+	t__2e442 = (u64)(*(u64 *)t__2e441);
+	t__2e443 = (u64)((u64)t__2e441 + (u64)((u64)8UL));
+	t__2e444 = (u64)(*(u32 *)t__2e443);
+	t__2e443 = (u64)((u64)t__2e441 + (u64)((u64)12UL));
+	t__2e445 = (u64)(*(u32 *)t__2e443);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e442, (u64)t__2e444, (u64)t__2e445, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_implicit(void) {
+	u64 t__2e465;
+	u64 t__2e469;
+	u64 t__2e470;
+	u64 t__2e471;
+	u64 t__2e472;
+	u64 t__2e473;
+	u64 t__2e476;
+	u64 t__2e479;
+	u64 t_abortsite_2e467;
+	L_start_2e459:;
+	L_body_2e460:;
+	t__2e465 = (u64)(u32)(((u32)((u64)0UL) == (u32)((u64)0UL)));
+	if ((u32)t__2e465) goto L_passed_2e464; else goto L_failed_2e463;
+	L_failed_2e463:;
+	t_abortsite_2e467 = ((u64)0UL);
+	goto L_abort_2e468;
+	L_passed_2e464:;
+	t__2e476 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	if ((u32)t__2e476) goto L_passed_2e475; else goto L_failed_2e474;
+	L_failed_2e474:;
+	t_abortsite_2e467 = ((u64)1UL);
+	goto L_abort_2e468;
+	L_passed_2e475:;
+	t__2e479 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	if ((u32)t__2e479) goto L_passed_2e478; else goto L_failed_2e477;
+	L_failed_2e477:;
+	t_abortsite_2e467 = ((u64)2UL);
+	goto L_abort_2e468;
+	L_passed_2e478:;
+	goto L__2e461;
+	L__2e480:;
+	L__2e461:;
+	return;
+	L_abort_2e468:;
+	t__2e469 = (u64)((u64)t_abortsite_2e467 * (u64)((u64)16UL));
+	t__2e469 = (u64)((u64)((u64)((char *)&D_abortsites_2e466)) + (u64)t__2e469);
+	t__2e470 = (u64)(*(u64 *)t__2e469);
+	t__2e471 = (u64)((u64)t__2e469 + (u64)((u64)8UL));
+	t__2e472 = (u64)(*(u32 *)t__2e471);
+	t__2e471 = (u64)((u64)t__2e469 + (u64)((u64)12UL));
+	t__2e473 = (u64)(*(u32 *)t__2e471);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e470, (u64)t__2e472, (u64)t__2e473, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,4504 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort[] __asm__("rt.abort");
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2eclose[] __asm__("rt.close");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2eensure[] __asm__("rt.ensure");
+extern char X_rt_2eexit[] __asm__("rt.exit");
+extern char X_rt_2efork[] __asm__("rt.fork");
+extern char X_rt_2efree[] __asm__("rt.free");
+extern char X_rt_2ewait4[] __asm__("rt.wait4");
+extern char X_rt_2ewexitstatus[] __asm__("rt.wexitstatus");
+extern char X_rt_2ewifexited[] __asm__("rt.wifexited");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e10 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e25 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S__2efini_2efinifunc_2e0 { char *f0; };
+struct __attribute__((packed)) S_strdata_2e51 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e52 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e61 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e112 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e211 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e258 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e355 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; };
+struct __attribute__((packed)) S_ran { u32 f0; };
+struct __attribute__((packed)) S_abortsites_2e594 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e780 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e919 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; char *f81; u32 f82; u32 f83; char *f84; u32 f85; u32 f86; char *f87; u32 f88; u32 f89; char *f90; u32 f91; u32 f92; char *f93; u32 f94; u32 f95; char *f96; u32 f97; u32 f98; char *f99; u32 f100; u32 f101; char *f102; u32 f103; u32 f104; char *f105; u32 f106; u32 f107; char *f108; u32 f109; u32 f110; char *f111; u32 f112; u32 f113; char *f114; u32 f115; u32 f116; char *f117; u32 f118; u32 f119; char *f120; u32 f121; u32 f122; char *f123; u32 f124; u32 f125; char *f126; u32 f127; u32 f128; char *f129; u32 f130; u32 f131; char *f132; u32 f133; u32 f134; char *f135; u32 f136; u32 f137; char *f138; u32 f139; u32 f140; char *f141; u32 f142; u32 f143; char *f144; u32 f145; u32 f146; char *f147; u32 f148; u32 f149; char *f150; u32 f151; u32 f152; char *f153; u32 f154; u32 f155; char *f156; u32 f157; u32 f158; char *f159; u32 f160; u32 f161; char *f162; u32 f163; u32 f164; char *f165; u32 f166; u32 f167; char *f168; u32 f169; u32 f170; char *f171; u32 f172; u32 f173; char *f174; u32 f175; u32 f176; char *f177; u32 f178; u32 f179; char *f180; u32 f181; u32 f182; char *f183; u32 f184; u32 f185; char *f186; u32 f187; u32 f188; char *f189; u32 f190; u32 f191; char *f192; u32 f193; u32 f194; char *f195; u32 f196; u32 f197; char *f198; u32 f199; u32 f200; char *f201; u32 f202; u32 f203; char *f204; u32 f205; u32 f206; char *f207; u32 f208; u32 f209; char *f210; u32 f211; u32 f212; char *f213; u32 f214; u32 f215; char *f216; u32 f217; u32 f218; char *f219; u32 f220; u32 f221; char *f222; u32 f223; u32 f224; char *f225; u32 f226; u32 f227; char *f228; u32 f229; u32 f230; char *f231; u32 f232; u32 f233; char *f234; u32 f235; u32 f236; char *f237; u32 f238; u32 f239; char *f240; u32 f241; u32 f242; char *f243; u32 f244; u32 f245; char *f246; u32 f247; u32 f248; char *f249; u32 f250; u32 f251; char *f252; u32 f253; u32 f254; char *f255; u32 f256; u32 f257; char *f258; u32 f259; u32 f260; char *f261; u32 f262; u32 f263; char *f264; u32 f265; u32 f266; char *f267; u32 f268; u32 f269; char *f270; u32 f271; u32 f272; char *f273; u32 f274; u32 f275; char *f276; u32 f277; u32 f278; char *f279; u32 f280; u32 f281; char *f282; u32 f283; u32 f284; char *f285; u32 f286; u32 f287; char *f288; u32 f289; u32 f290; char *f291; u32 f292; u32 f293; char *f294; u32 f295; u32 f296; char *f297; u32 f298; u32 f299; };
+struct __attribute__((packed)) S_abortsites_2e1739 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_strdata_2e1781 { u8 f0[32]; };
+struct __attribute__((packed)) S_strliteral_2e1782 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1783 { u8 f0[47]; };
+struct __attribute__((packed)) S_strliteral_2e1784 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1785 { u8 f0[60]; };
+struct __attribute__((packed)) S_strliteral_2e1786 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1787 { u8 f0[43]; };
+struct __attribute__((packed)) S_strliteral_2e1788 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1792 { u8 f0[41]; };
+struct __attribute__((packed)) S_strliteral_2e1793 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1794 { u8 f0[60]; };
+struct __attribute__((packed)) S_strliteral_2e1795 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1796 { u8 f0[52]; };
+struct __attribute__((packed)) S_strliteral_2e1797 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1798 { u8 f0[55]; };
+struct __attribute__((packed)) S_strliteral_2e1799 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1800 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e1801 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1802 { u8 f0[71]; };
+struct __attribute__((packed)) S_strliteral_2e1803 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1838 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e1923 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e2012 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e2052 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_x { u32 f0; };
+struct __attribute__((packed)) S_abortsites_2e2087 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e10 D_abortsites_2e10 __asm__("abortsites.10") __attribute__((used, section(".data.rel.ro.abortsites.10"), aligned(8)));
+static struct S_abortsites_2e25 D_abortsites_2e25 __asm__("abortsites.25") __attribute__((used, section(".data.rel.ro.abortsites.25"), aligned(8)));
+static struct S__2efini_2efinifunc_2e0 D__2efini_2efinifunc_2e0 __asm__(".fini.finifunc.0") __attribute__((used, section(".fini_array"), aligned(8)));
+static const struct S_strdata_2e51 D_strdata_2e51 __asm__("strdata.51") __attribute__((used, section(".rodata.strdata.51"), aligned(8)));
+static struct S_strliteral_2e52 D_strliteral_2e52 __asm__("strliteral.52") __attribute__((used, section(".data.rel.ro.strliteral.52"), aligned(8)));
+static struct S_abortsites_2e61 D_abortsites_2e61 __asm__("abortsites.61") __attribute__((used, section(".data.rel.ro.abortsites.61"), aligned(8)));
+static struct S_abortsites_2e112 D_abortsites_2e112 __asm__("abortsites.112") __attribute__((used, section(".data.rel.ro.abortsites.112"), aligned(8)));
+static struct S_abortsites_2e211 D_abortsites_2e211 __asm__("abortsites.211") __attribute__((used, section(".data.rel.ro.abortsites.211"), aligned(8)));
+static struct S_abortsites_2e258 D_abortsites_2e258 __asm__("abortsites.258") __attribute__((used, section(".data.rel.ro.abortsites.258"), aligned(8)));
+static struct S_abortsites_2e355 D_abortsites_2e355 __asm__("abortsites.355") __attribute__((used, section(".data.rel.ro.abortsites.355"), aligned(8)));
+static struct S_ran D_ran __asm__("ran") __attribute__((used, section(".bss.ran"), aligned(8)));
+static struct S_abortsites_2e594 D_abortsites_2e594 __asm__("abortsites.594") __attribute__((used, section(".data.rel.ro.abortsites.594"), aligned(8)));
+static struct S_abortsites_2e780 D_abortsites_2e780 __asm__("abortsites.780") __attribute__((used, section(".data.rel.ro.abortsites.780"), aligned(8)));
+static struct S_abortsites_2e919 D_abortsites_2e919 __asm__("abortsites.919") __attribute__((used, section(".data.rel.ro.abortsites.919"), aligned(8)));
+static struct S_abortsites_2e1739 D_abortsites_2e1739 __asm__("abortsites.1739") __attribute__((used, section(".data.rel.ro.abortsites.1739"), aligned(8)));
+static const struct S_strdata_2e1781 D_strdata_2e1781 __asm__("strdata.1781") __attribute__((used, section(".rodata.strdata.1781"), aligned(8)));
+static struct S_strliteral_2e1782 D_strliteral_2e1782 __asm__("strliteral.1782") __attribute__((used, section(".data.rel.ro.strliteral.1782"), aligned(8)));
+static const struct S_strdata_2e1783 D_strdata_2e1783 __asm__("strdata.1783") __attribute__((used, section(".rodata.strdata.1783"), aligned(8)));
+static struct S_strliteral_2e1784 D_strliteral_2e1784 __asm__("strliteral.1784") __attribute__((used, section(".data.rel.ro.strliteral.1784"), aligned(8)));
+static const struct S_strdata_2e1785 D_strdata_2e1785 __asm__("strdata.1785") __attribute__((used, section(".rodata.strdata.1785"), aligned(8)));
+static struct S_strliteral_2e1786 D_strliteral_2e1786 __asm__("strliteral.1786") __attribute__((used, section(".data.rel.ro.strliteral.1786"), aligned(8)));
+static const struct S_strdata_2e1787 D_strdata_2e1787 __asm__("strdata.1787") __attribute__((used, section(".rodata.strdata.1787"), aligned(8)));
+static struct S_strliteral_2e1788 D_strliteral_2e1788 __asm__("strliteral.1788") __attribute__((used, section(".data.rel.ro.strliteral.1788"), aligned(8)));
+static const struct S_strdata_2e1792 D_strdata_2e1792 __asm__("strdata.1792") __attribute__((used, section(".rodata.strdata.1792"), aligned(8)));
+static struct S_strliteral_2e1793 D_strliteral_2e1793 __asm__("strliteral.1793") __attribute__((used, section(".data.rel.ro.strliteral.1793"), aligned(8)));
+static const struct S_strdata_2e1794 D_strdata_2e1794 __asm__("strdata.1794") __attribute__((used, section(".rodata.strdata.1794"), aligned(8)));
+static struct S_strliteral_2e1795 D_strliteral_2e1795 __asm__("strliteral.1795") __attribute__((used, section(".data.rel.ro.strliteral.1795"), aligned(8)));
+static const struct S_strdata_2e1796 D_strdata_2e1796 __asm__("strdata.1796") __attribute__((used, section(".rodata.strdata.1796"), aligned(8)));
+static struct S_strliteral_2e1797 D_strliteral_2e1797 __asm__("strliteral.1797") __attribute__((used, section(".data.rel.ro.strliteral.1797"), aligned(8)));
+static const struct S_strdata_2e1798 D_strdata_2e1798 __asm__("strdata.1798") __attribute__((used, section(".rodata.strdata.1798"), aligned(8)));
+static struct S_strliteral_2e1799 D_strliteral_2e1799 __asm__("strliteral.1799") __attribute__((used, section(".data.rel.ro.strliteral.1799"), aligned(8)));
+static const struct S_strdata_2e1800 D_strdata_2e1800 __asm__("strdata.1800") __attribute__((used, section(".rodata.strdata.1800"), aligned(8)));
+static struct S_strliteral_2e1801 D_strliteral_2e1801 __asm__("strliteral.1801") __attribute__((used, section(".data.rel.ro.strliteral.1801"), aligned(8)));
+static const struct S_strdata_2e1802 D_strdata_2e1802 __asm__("strdata.1802") __attribute__((used, section(".rodata.strdata.1802"), aligned(8)));
+static struct S_strliteral_2e1803 D_strliteral_2e1803 __asm__("strliteral.1803") __attribute__((used, section(".data.rel.ro.strliteral.1803"), aligned(8)));
+static struct S_abortsites_2e1838 D_abortsites_2e1838 __asm__("abortsites.1838") __attribute__((used, section(".data.rel.ro.abortsites.1838"), aligned(8)));
+static struct S_abortsites_2e1923 D_abortsites_2e1923 __asm__("abortsites.1923") __attribute__((used, section(".data.rel.ro.abortsites.1923"), aligned(8)));
+static struct S_abortsites_2e2012 D_abortsites_2e2012 __asm__("abortsites.2012") __attribute__((used, section(".data.rel.ro.abortsites.2012"), aligned(8)));
+static struct S_abortsites_2e2052 D_abortsites_2e2052 __asm__("abortsites.2052") __attribute__((used, section(".data.rel.ro.abortsites.2052"), aligned(8)));
+static struct S_x D_x __asm__("x") __attribute__((used, section(".data.x"), aligned(8)));
+static struct S_abortsites_2e2087 D_abortsites_2e2087 __asm__("abortsites.2087") __attribute__((used, section(".data.rel.ro.abortsites.2087"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_finifunc_2e0(void) __asm__("finifunc.0") __attribute__((used, section(".text.finifunc.0")));
+static void F___never(void) __asm__("_never") __attribute__((used, section(".text._never")));
+static void F_exit(u32 p_x) __asm__("exit") __attribute__((used, section(".text.exit")));
+static void F_abort__defers(void) __asm__("abort_defers") __attribute__((used, section(".text.abort_defers")));
+static void F_oob(u32 p_path) __asm__("oob") __attribute__((used, section(".text.oob")));
+static void F_deferred__exits(void) __asm__("deferred_exits") __attribute__((used, section(".text.deferred_exits")));
+static u32 F_deferred__call(u32 p_n) __asm__("deferred_call") __attribute__((used, section(".text.deferred_call")));
+static void F_release(u32 p_n) __asm__("release") __attribute__((used, section(".text.release")));
+static u32 F_deferred__exit(u32 p_n) __asm__("deferred_exit") __attribute__((used, section(".text.deferred_exit")));
+static void F_shared(void) __asm__("shared") __attribute__((used, section(".text.shared")));
+static u32 F_exits(u32 p_path, u64 p_trace) __asm__("exits") __attribute__((used, section(".text.exits")));
+static void F_spam(void) __asm__("spam") __attribute__((used, section(".text.spam")));
+static u64 F_spamfunc(u64 __rp) __asm__("spamfunc") __attribute__((used, section(".text.spamfunc")));
+static void F_nested(void) __asm__("nested") __attribute__((used, section(".text.nested")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_control(void) __asm__("control") __attribute__((used, section(".text.control")));
+static void F_loops(void) __asm__("loops") __attribute__((used, section(".text.loops")));
+static void F_scope(void) __asm__("scope") __attribute__((used, section(".text.scope")));
+static void F_basics(void) __asm__("basics") __attribute__((used, section(".text.basics")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\061\066\055\144\145\146\145\162\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 17U, 17U };
+static struct S_abortsites_2e10 D_abortsites_2e10 = { (char *)((char *)&D_strliteral_2e1) + 0, 355U, 15U };
+static struct S_abortsites_2e25 D_abortsites_2e25 = { (char *)((char *)&D_strliteral_2e1) + 0, 120U, 30U };
+static struct S__2efini_2efinifunc_2e0 D__2efini_2efinifunc_2e0 = { (char *)((char *)&F_finifunc_2e0) + 0 };
+static const struct S_strdata_2e51 D_strdata_2e51 = { "\144\145\146\145\162\040\162\141\156\040\164\157\157\040\145\141\162\154\171" };
+static struct S_strliteral_2e52 D_strliteral_2e52 = { (char *)((char *)&D_strdata_2e51) + 0, 19U, 19U };
+static struct S_abortsites_2e61 D_abortsites_2e61 = { (char *)((char *)&D_strliteral_2e1) + 0, 108U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 28U };
+static struct S_abortsites_2e112 D_abortsites_2e112 = { (char *)((char *)&D_strliteral_2e1) + 0, 113U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 115U, 39U, (char *)((char *)&D_strliteral_2e1) + 0, 115U, 39U, (char *)((char *)&D_strliteral_2e1) + 0, 117U, 14U };
+static struct S_abortsites_2e211 D_abortsites_2e211 = { (char *)((char *)&D_strliteral_2e1) + 0, 345U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 348U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 349U, 23U };
+static struct S_abortsites_2e258 D_abortsites_2e258 = { (char *)((char *)&D_strliteral_2e1) + 0, 321U, 18U, (char *)((char *)&D_strliteral_2e1) + 0, 325U, 18U, (char *)((char *)&D_strliteral_2e1) + 0, 330U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 334U, 10U };
+static struct S_abortsites_2e355 D_abortsites_2e355 = { (char *)((char *)&D_strliteral_2e1) + 0, 301U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 302U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 303U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 304U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 306U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 307U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 308U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 309U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 310U, 15U };
+static struct S_ran D_ran = { 0U };
+static struct S_abortsites_2e594 D_abortsites_2e594 = { (char *)((char *)&D_strliteral_2e1) + 0, 251U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 252U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 254U, 37U, (char *)((char *)&D_strliteral_2e1) + 0, 254U, 31U };
+static struct S_abortsites_2e780 D_abortsites_2e780 = { (char *)((char *)&D_strliteral_2e1) + 0, 229U, 38U };
+static struct S_abortsites_2e919 D_abortsites_2e919 = { (char *)((char *)&D_strliteral_2e1) + 0, 196U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 196U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 195U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 195U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 194U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 194U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 193U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 193U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 192U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 192U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 191U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 191U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 190U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 190U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 189U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 189U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 188U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 188U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 187U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 187U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 186U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 186U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 185U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 185U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 184U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 184U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 182U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 182U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 181U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 181U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 179U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 179U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 178U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 178U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 177U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 177U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 176U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 176U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 175U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 175U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 174U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 174U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 173U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 173U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 172U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 172U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 171U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 171U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 170U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 170U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 169U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 169U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 168U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 168U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 167U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 167U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 166U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 166U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 165U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 165U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 164U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 164U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 163U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 163U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 162U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 162U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 161U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 161U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 160U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 160U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 159U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 159U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 158U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 158U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 157U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 157U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 156U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 156U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 155U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 155U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 154U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 154U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 153U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 153U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 152U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 152U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 151U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 151U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 150U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 150U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 149U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 149U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 147U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 147U, 26U };
+static struct S_abortsites_2e1739 D_abortsites_2e1739 = { (char *)((char *)&D_strliteral_2e1) + 0, 126U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 128U, 31U };
+static const struct S_strdata_2e1781 D_strdata_2e1781 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\144\145\146\145\162\040\060\073" };
+static struct S_strliteral_2e1782 D_strliteral_2e1782 = { (char *)((char *)&D_strdata_2e1781) + 0, 32U, 32U };
+static const struct S_strdata_2e1783 D_strdata_2e1783 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\151\146\040\050\164\162\165\145\051\040\144\145\146\145\162\040\060\073\040\175\073" };
+static struct S_strliteral_2e1784 D_strliteral_2e1784 = { (char *)((char *)&D_strdata_2e1783) + 0, 47U, 47U };
+static const struct S_strdata_2e1785 D_strdata_2e1785 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\146\157\162\040\050\144\145\146\145\162\040\060\073\040\164\162\165\145\073\040\164\162\165\145\051\040\166\157\151\144\073\040\175\073" };
+static struct S_strliteral_2e1786 D_strliteral_2e1786 = { (char *)((char *)&D_strdata_2e1785) + 0, 60U, 60U };
+static const struct S_strdata_2e1787 D_strdata_2e1787 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\144\145\146\145\162\040\144\145\146\145\162\040\060\073\040\175\073" };
+static struct S_strliteral_2e1788 D_strliteral_2e1788 = { (char *)((char *)&D_strdata_2e1787) + 0, 43U, 43U };
+static const struct S_strdata_2e1792 D_strdata_2e1792 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\144\145\146\145\162\040\171\151\145\154\144\073\040\175\073" };
+static struct S_strliteral_2e1793 D_strliteral_2e1793 = { (char *)((char *)&D_strdata_2e1792) + 0, 41U, 41U };
+static const struct S_strdata_2e1794 D_strdata_2e1794 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\072\157\165\164\145\162\040\173\040\144\145\146\145\162\040\173\040\171\151\145\154\144\040\072\157\165\164\145\162\073\040\175\073\040\175\073" };
+static struct S_strliteral_2e1795 D_strliteral_2e1795 = { (char *)((char *)&D_strdata_2e1794) + 0, 60U, 60U };
+static const struct S_strdata_2e1796 D_strdata_2e1796 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\146\157\162\040\050\164\162\165\145\051\040\173\040\144\145\146\145\162\040\142\162\145\141\153\073\040\175\073" };
+static struct S_strliteral_2e1797 D_strliteral_2e1797 = { (char *)((char *)&D_strdata_2e1796) + 0, 52U, 52U };
+static const struct S_strdata_2e1798 D_strdata_2e1798 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\146\157\162\040\050\164\162\165\145\051\040\173\040\144\145\146\145\162\040\143\157\156\164\151\156\165\145\073\040\175\073" };
+static struct S_strliteral_2e1799 D_strliteral_2e1799 = { (char *)((char *)&D_strdata_2e1798) + 0, 55U, 55U };
+static const struct S_strdata_2e1800 D_strdata_2e1800 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\144\145\146\145\162\040\162\145\164\165\162\156\073\040\175\073" };
+static struct S_strliteral_2e1801 D_strliteral_2e1801 = { (char *)((char *)&D_strdata_2e1800) + 0, 42U, 42U };
+static const struct S_strdata_2e1802 D_strdata_2e1802 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\146\157\162\040\072\157\165\164\145\162\040\050\164\162\165\145\051\040\173\040\144\145\146\145\162\040\173\040\142\162\145\141\153\040\072\157\165\164\145\162\073\040\175\073\040\175\073" };
+static struct S_strliteral_2e1803 D_strliteral_2e1803 = { (char *)((char *)&D_strdata_2e1802) + 0, 71U, 71U };
+static struct S_abortsites_2e1838 D_abortsites_2e1838 = { (char *)((char *)&D_strliteral_2e1) + 0, 79U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 82U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 82U, 50U };
+static struct S_abortsites_2e1923 D_abortsites_2e1923 = { (char *)((char *)&D_strliteral_2e1) + 0, 42U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 49U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 15U };
+static struct S_abortsites_2e2012 D_abortsites_2e2012 = { (char *)((char *)&D_strliteral_2e1) + 0, 29U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 15U };
+static struct S_abortsites_2e2052 D_abortsites_2e2052 = { (char *)((char *)&D_strliteral_2e1) + 0, 20U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 22U, 15U };
+static struct S_x D_x = { 10U };
+static struct S_abortsites_2e2087 D_abortsites_2e2087 = { (char *)((char *)&D_strliteral_2e1) + 0, 7U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 15U };
+void F_main(void) {
+	u64 t__2e13;
+	u64 t__2e14;
+	u64 t__2e15;
+	u64 t__2e16;
+	u64 t__2e17;
+	u64 t__2e8;
+	u64 t__2e9;
+	u64 t_abortsite_2e11;
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_basics)))();
+	t__2e9 = (u64)(u32)(*(i32 *)((u64)((char *)&D_x)));
+	t__2e8 = (u64)(u32)(((u32)t__2e9 == (u32)((u64)20UL)));
+	if ((u32)t__2e8) goto L_passed_2e7; else goto L_failed_2e6;
+	L_failed_2e6:;
+	t_abortsite_2e11 = ((u64)0UL);
+	goto L_abort_2e12;
+	L_passed_2e7:;
+	((void (*)(void))((u64)((char *)&F_scope)))();
+	((void (*)(void))((u64)((char *)&F_loops)))();
+	((void (*)(void))((u64)((char *)&F_control)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	((void (*)(void))((u64)((char *)&F_nested)))();
+	((void (*)(void))((u64)((char *)&F_spam)))();
+	((void (*)(void))((u64)((char *)&F_shared)))();
+	((void (*)(void))((u64)((char *)&F_deferred__exits)))();
+	((void (*)(void))((u64)((char *)&F_abort__defers)))();
+	((void (*)(void))((u64)((char *)&F___never)))();
+	goto L__2e4;
+	L__2e18:;
+	L__2e4:;
+	return;
+	L_abort_2e12:;
+	t__2e13 = (u64)((u64)t_abortsite_2e11 * (u64)((u64)16UL));
+	t__2e13 = (u64)((u64)((u64)((char *)&D_abortsites_2e10)) + (u64)t__2e13);
+	t__2e14 = (u64)(*(u64 *)t__2e13);
+	t__2e15 = (u64)((u64)t__2e13 + (u64)((u64)8UL));
+	t__2e16 = (u64)(*(u32 *)t__2e15);
+	t__2e15 = (u64)((u64)t__2e13 + (u64)((u64)12UL));
+	t__2e17 = (u64)(*(u32 *)t__2e15);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e14, (u64)t__2e16, (u64)t__2e17, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_finifunc_2e0(void) {
+	u64 t__2e23;
+	u64 t__2e24;
+	u64 t__2e28;
+	u64 t__2e29;
+	u64 t__2e30;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t_abortsite_2e26;
+	L_start_2e19:;
+	L_body_2e20:;
+	t__2e24 = (u64)(u32)(*(i32 *)((u64)((char *)&D_x)));
+	t__2e23 = (u64)(u32)(((u32)t__2e24 == (u32)((u64)2UL)));
+	if ((u32)t__2e23) goto L_passed_2e22; else goto L_failed_2e21;
+	L_failed_2e21:;
+	t_abortsite_2e26 = ((u64)0UL);
+	goto L_abort_2e27;
+	L_passed_2e22:;
+	return;
+	L_abort_2e27:;
+	t__2e28 = (u64)((u64)t_abortsite_2e26 * (u64)((u64)16UL));
+	t__2e28 = (u64)((u64)((u64)((char *)&D_abortsites_2e25)) + (u64)t__2e28);
+	t__2e29 = (u64)(*(u64 *)t__2e28);
+	t__2e30 = (u64)((u64)t__2e28 + (u64)((u64)8UL));
+	t__2e31 = (u64)(*(u32 *)t__2e30);
+	t__2e30 = (u64)((u64)t__2e28 + (u64)((u64)12UL));
+	t__2e32 = (u64)(*(u32 *)t__2e30);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e29, (u64)t__2e31, (u64)t__2e32, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F___never(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char B2[24] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e40;
+	u64 t__2e44;
+	u64 t__2e45;
+	u64 t__2e46;
+	u64 t__2e58;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e66;
+	u64 t__2e67;
+	u64 t__2e68;
+	u64 t__2e73;
+	u64 t__2e77;
+	u64 t__2e88;
+	u64 t__2e96;
+	u64 t__2e97;
+	u64 t__2e98;
+	u64 t__2e99;
+	u64 t_abortsite_2e62;
+	u64 t_binding_2e39;
+	u64 t_binding_2e87;
+	u64 t_cleanup_2e47;
+	u64 t_cleanup_2e80;
+	u64 t_cleanup_2e89;
+	L_start_2e33:;
+	t_binding_2e39 = (u64)A0;
+	t_binding_2e87 = (u64)A1;
+	L_body_2e34:;
+	*(u32 *)t_binding_2e39 = (u32)((u64)0UL);
+	t__2e45 = (u64)(u32)(*(i32 *)t_binding_2e39);
+	t__2e44 = (u64)(u32)(((u32)t__2e45 == (u32)((u64)0UL)));
+	t__2e46 = (u64)(u32)((u8)t__2e44);
+	if ((u32)t__2e46) goto L_true_2e41; else goto L_false_2e42;
+	L_true_2e41:;
+	t_cleanup_2e47 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e48;
+	L_resume_2e49:;
+	goto L__2e37;
+	L__2e50:;
+	L_false_2e42:;
+	t__2e40 = ((u64)((char *)&D_strliteral_2e52));
+	L__2e43:;
+	t_cleanup_2e47 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e48;
+	L_resume_2e54:;
+	BLIT((u64)B2, t__2e40, 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)90UL), (u64)((u64)22UL), (u64)B2);
+	__builtin_trap();
+	L__2e55:;
+	goto L__2e56;
+	L_defer_2e48:;
+	*(u32 *)t_binding_2e39 = (u32)((u64)1UL);
+	t__2e58 = (u64)(u32)(((u32)t_cleanup_2e47 == (u32)((u64)1UL)));
+	if ((u32)t__2e58) goto L_resume_2e54; else goto L__2e57;
+	L__2e57:;
+	goto L_resume_2e49;
+	L__2e56:;
+	L__2e37:;
+	*(u32 *)((u64)((char *)&D_x)) = (u32)((u64)0UL);
+	t_abortsite_2e62 = ((u64)0UL);
+	goto L_abort_2e63;
+	L__2e71:;
+	goto L__2e72;
+	L_defer_2e69:;
+	t__2e73 = (u64)(u32)(*(i32 *)((u64)((char *)&D_x)));
+	t__2e73 = (u64)(u32)((u32)t__2e73 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_x)) = (u32)t__2e73;
+	goto L_defer_2e74;
+	L__2e72:;
+	L__2e59:;
+	L__2e75:;
+	goto L__2e76;
+	L_defer_2e74:;
+	t__2e77 = (u64)(u32)(*(i32 *)((u64)((char *)&D_x)));
+	t__2e77 = (u64)(u32)((u32)t__2e77 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_x)) = (u32)t__2e77;
+	t_cleanup_2e80 = (u64)(u32)((u64)3UL);
+	goto L_defer_2e81;
+	L_resume_2e82:;
+	goto L__2e78;
+	L__2e83:;
+	goto L__2e84;
+	L_defer_2e81:;
+	*(u32 *)t_binding_2e87 = (u32)((u64)0UL);
+	t__2e88 = (u64)(u32)(*(i32 *)t_binding_2e87);
+	t_cleanup_2e89 = (u64)(u32)((u64)4UL);
+	goto L_defer_2e90;
+	L_resume_2e91:;
+	((void (*)(u32))((u64)((char *)&F_exit)))((u32)t__2e88);
+	__builtin_trap();
+	L__2e92:;
+	goto L__2e93;
+	L_defer_2e90:;
+	*(u32 *)t_binding_2e87 = (u32)((u64)1UL);
+	goto L_resume_2e91;
+	L__2e93:;
+	L__2e85:;
+	L__2e94:;
+	t_abortsite_2e62 = ((u64)1UL);
+	goto L_abort_2e95;
+	L__2e101:;
+	goto L_resume_2e82;
+	L__2e84:;
+	L__2e78:;
+	goto L_resume_2e70;
+	L__2e76:;
+	L__2e35:;
+	L__2e102:;
+	return;
+	L_abort_2e63:;
+	t__2e64 = (u64)((u64)t_abortsite_2e62 * (u64)((u64)16UL));
+	t__2e64 = (u64)((u64)((u64)((char *)&D_abortsites_2e61)) + (u64)t__2e64);
+	t__2e65 = (u64)(*(u64 *)t__2e64);
+	t__2e66 = (u64)((u64)t__2e64 + (u64)((u64)8UL));
+	t__2e67 = (u64)(*(u32 *)t__2e66);
+	t__2e66 = (u64)((u64)t__2e64 + (u64)((u64)12UL));
+	t__2e68 = (u64)(*(u32 *)t__2e66);
+	t_cleanup_2e47 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e69;
+	L_resume_2e70:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e65, (u64)t__2e67, (u64)t__2e68, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e95:;
+	t__2e96 = (u64)((u64)t_abortsite_2e62 * (u64)((u64)16UL));
+	t__2e96 = (u64)((u64)((u64)((char *)&D_abortsites_2e61)) + (u64)t__2e96);
+	t__2e97 = (u64)(*(u64 *)t__2e96);
+	t__2e98 = (u64)((u64)t__2e96 + (u64)((u64)8UL));
+	t__2e99 = (u64)(*(u32 *)t__2e98);
+	t__2e98 = (u64)((u64)t__2e96 + (u64)((u64)12UL));
+	t__2e100 = (u64)(*(u32 *)t__2e98);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e97, (u64)t__2e99, (u64)t__2e100, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_exit(u32 p_x) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e110;
+	u64 t__2e111;
+	u64 t__2e115;
+	u64 t__2e116;
+	u64 t__2e117;
+	u64 t__2e118;
+	u64 t__2e119;
+	u64 t__2e131;
+	u64 t__2e133;
+	u64 t__2e135;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e139;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e147;
+	u64 t__2e148;
+	u64 t__2e149;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e154;
+	u64 t__2e155;
+	u64 t__2e156;
+	u64 t__2e160;
+	u64 t__2e163;
+	u64 t__2e165;
+	u64 t_abortsite_2e113;
+	u64 t_cleanup_2e140;
+	u64 t_object_2e121;
+	u64 t_param_2e104;
+	u64 t_tag_2e123;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e103:;
+	t_param_2e104 = (u64)A0;
+	t_object_2e121 = (u64)A1;
+	*(u32 *)t_param_2e104 = (u32)t_x;
+	L_body_2e105:;
+	t__2e111 = (u64)(u32)(*(i32 *)t_param_2e104);
+	t__2e110 = (u64)(u32)(((u32)t__2e111 == (u32)((u64)0UL)));
+	if ((u32)t__2e110) goto L_passed_2e109; else goto L_failed_2e108;
+	L_failed_2e108:;
+	t_abortsite_2e113 = ((u64)0UL);
+	goto L_abort_2e114;
+	L_passed_2e109:;
+	*(u32 *)t_object_2e121 = (u32)((u64)3046235510UL);
+	t_tag_2e123 = (u64)(*(u32 *)t_object_2e121);
+	t__2e131 = (u64)(u32)(((u32)t_tag_2e123 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e131) goto L_member_2e128; else goto L__2e130;
+	L__2e130:;
+	t__2e133 = (u64)(u32)(((u32)t_tag_2e123 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e133) goto L_member_2e129; else goto L__2e132;
+	L__2e132:;
+	goto L_matches_2e127;
+	L_member_2e128:;
+	goto L_matches_2e126;
+	L_member_2e129:;
+	goto L_matches_2e127;
+	L_matches_2e126:;
+	goto L__2e124;
+	L_matches_2e127:;
+	t_abortsite_2e113 = ((u64)1UL);
+	goto L_abort_2e134;
+	L__2e143:;
+	L__2e125:;
+	t_abortsite_2e113 = ((u64)2UL);
+	goto L_abort_2e144;
+	L__2e124:;
+	*(u32 *)t_param_2e104 = (u32)((u64)1UL);
+	t_abortsite_2e113 = ((u64)3UL);
+	goto L_abort_2e151;
+	L__2e158:;
+	goto L__2e159;
+	L_defer_2e141:;
+	t__2e160 = (u64)(u32)(*(i32 *)t_param_2e104);
+	((void (*)(u32))((u64)X_rt_2eexit))((u32)t__2e160);
+	__builtin_trap();
+	L__2e161:;
+	t__2e163 = (u64)(u32)(((u32)t_cleanup_2e140 == (u32)((u64)2UL)));
+	if ((u32)t__2e163) goto L_resume_2e157; else goto L__2e162;
+	L__2e162:;
+	t__2e165 = (u64)(u32)(((u32)t_cleanup_2e140 == (u32)((u64)1UL)));
+	if ((u32)t__2e165) goto L_resume_2e150; else goto L__2e164;
+	L__2e164:;
+	goto L_resume_2e142;
+	L__2e159:;
+	L__2e106:;
+	L__2e166:;
+	__builtin_trap();
+	L_abort_2e114:;
+	t__2e115 = (u64)((u64)t_abortsite_2e113 * (u64)((u64)16UL));
+	t__2e115 = (u64)((u64)((u64)((char *)&D_abortsites_2e112)) + (u64)t__2e115);
+	t__2e116 = (u64)(*(u64 *)t__2e115);
+	t__2e117 = (u64)((u64)t__2e115 + (u64)((u64)8UL));
+	t__2e118 = (u64)(*(u32 *)t__2e117);
+	t__2e117 = (u64)((u64)t__2e115 + (u64)((u64)12UL));
+	t__2e119 = (u64)(*(u32 *)t__2e117);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e116, (u64)t__2e118, (u64)t__2e119, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e134:;
+	t__2e135 = (u64)((u64)t_abortsite_2e113 * (u64)((u64)16UL));
+	t__2e135 = (u64)((u64)((u64)((char *)&D_abortsites_2e112)) + (u64)t__2e135);
+	t__2e136 = (u64)(*(u64 *)t__2e135);
+	t__2e137 = (u64)((u64)t__2e135 + (u64)((u64)8UL));
+	t__2e138 = (u64)(*(u32 *)t__2e137);
+	t__2e137 = (u64)((u64)t__2e135 + (u64)((u64)12UL));
+	t__2e139 = (u64)(*(u32 *)t__2e137);
+	t_cleanup_2e140 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e141;
+	L_resume_2e142:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e136, (u64)t__2e138, (u64)t__2e139, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e144:;
+	t__2e145 = (u64)((u64)t_abortsite_2e113 * (u64)((u64)16UL));
+	t__2e145 = (u64)((u64)((u64)((char *)&D_abortsites_2e112)) + (u64)t__2e145);
+	t__2e146 = (u64)(*(u64 *)t__2e145);
+	t__2e147 = (u64)((u64)t__2e145 + (u64)((u64)8UL));
+	t__2e148 = (u64)(*(u32 *)t__2e147);
+	t__2e147 = (u64)((u64)t__2e145 + (u64)((u64)12UL));
+	t__2e149 = (u64)(*(u32 *)t__2e147);
+	t_cleanup_2e140 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e141;
+	L_resume_2e150:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e146, (u64)t__2e148, (u64)t__2e149, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e151:;
+	t__2e152 = (u64)((u64)t_abortsite_2e113 * (u64)((u64)16UL));
+	t__2e152 = (u64)((u64)((u64)((char *)&D_abortsites_2e112)) + (u64)t__2e152);
+	t__2e153 = (u64)(*(u64 *)t__2e152);
+	t__2e154 = (u64)((u64)t__2e152 + (u64)((u64)8UL));
+	t__2e155 = (u64)(*(u32 *)t__2e154);
+	t__2e154 = (u64)((u64)t__2e152 + (u64)((u64)12UL));
+	t__2e156 = (u64)(*(u32 *)t__2e154);
+	t_cleanup_2e140 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e141;
+	L_resume_2e157:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e153, (u64)t__2e155, (u64)t__2e156, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_abort__defers(void) {
+	char A0[32] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	u64 t__2e193;
+	u64 t__2e198;
+	u64 t__2e199;
+	u64 t__2e200;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e208;
+	u64 t__2e209;
+	u64 t__2e210;
+	u64 t__2e214;
+	u64 t__2e215;
+	u64 t__2e216;
+	u64 t__2e217;
+	u64 t__2e218;
+	u64 t__2e220;
+	u64 t__2e221;
+	u64 t__2e224;
+	u64 t__2e225;
+	u64 t__2e228;
+	u64 t__2e229;
+	u64 t__2e230;
+	u64 t__2e231;
+	u64 t_abortsite_2e212;
+	u64 t_binding_2e171;
+	u64 t_binding_2e192;
+	u64 t_binding_2e219;
+	u64 t_cur__object_2e185;
+	u64 t_end_2e186;
+	u64 t_item_2e174;
+	u64 t_ptr_2e184;
+	u64 t_unpack_2e188;
+	u64 t_unpack_2e189;
+	u64 t_valid_2e187;
+	u64 t_value_2e175;
+	u64 t_value_2e176;
+	u64 t_value_2e177;
+	u64 t_value_2e178;
+	L_start_2e167:;
+	t_binding_2e171 = (u64)A0;
+	t_cur__object_2e185 = (u64)A1;
+	t_binding_2e192 = (u64)A2;
+	t_binding_2e219 = (u64)A3;
+	L_body_2e168:;
+	t_item_2e174 = (u64)((u64)t_binding_2e171 + (u64)((u64)0UL));
+	t_value_2e175 = (u64)((u64)t_item_2e174 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e175 = (u32)((u64)0UL);
+	t_value_2e175 = (u64)((u64)t_item_2e174 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e175 = (u32)((u64)1UL);
+	t_item_2e174 = (u64)((u64)t_binding_2e171 + (u64)((u64)8UL));
+	t_value_2e176 = (u64)((u64)t_item_2e174 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e176 = (u32)((u64)1UL);
+	t_value_2e176 = (u64)((u64)t_item_2e174 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e176 = (u32)((u64)3UL);
+	t_item_2e174 = (u64)((u64)t_binding_2e171 + (u64)((u64)16UL));
+	t_value_2e177 = (u64)((u64)t_item_2e174 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e177 = (u32)((u64)2UL);
+	t_value_2e177 = (u64)((u64)t_item_2e174 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e177 = (u32)((u64)7UL);
+	t_item_2e174 = (u64)((u64)t_binding_2e171 + (u64)((u64)24UL));
+	t_value_2e178 = (u64)((u64)t_item_2e174 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e178 = (u32)((u64)3UL);
+	t_value_2e178 = (u64)((u64)t_item_2e174 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e178 = (u32)((u64)15UL);
+	t_ptr_2e184 = t_binding_2e171;
+	t_end_2e186 = (u64)((u64)((u64)4UL) * (u64)((u64)8UL));
+	t_end_2e186 = (u64)((u64)t_ptr_2e184 + (u64)t_end_2e186);
+	L_loop_2e179:;
+	t_valid_2e187 = (u64)(u32)(((u64)t_ptr_2e184 < (u64)t_end_2e186));
+	if ((u32)t_valid_2e187) goto L_valid_2e181; else goto L__2e182;
+	L_valid_2e181:;
+	BLIT(t_cur__object_2e185, t_ptr_2e184, ((u64)8UL));
+	t_unpack_2e188 = (u64)((u64)t_cur__object_2e185 + (u64)((u64)0UL));
+	t_unpack_2e189 = (u64)((u64)t_cur__object_2e185 + (u64)((u64)4UL));
+	L_body_2e180:;
+	t__2e193 = (u64)(u32)(((u32 (*)(void))((u64)X_rt_2efork))());
+	*(u32 *)t_binding_2e192 = (u32)t__2e193;
+	t__2e199 = (u64)(u32)(*(i32 *)t_binding_2e192);
+	t__2e198 = (u64)(u32)(((u32)t__2e199 == (u32)((u64)0UL)));
+	t__2e200 = (u64)(u32)((u8)t__2e198);
+	if ((u32)t__2e200) goto L_true_2e195; else goto L_false_2e196;
+	L_true_2e195:;
+	t__2e203 = (u64)(u32)(((u32 (*)(u32))((u64)X_rt_2eclose))((u32)((u64)2UL)));
+	t__2e204 = (u64)(u32)(*(i32 *)t_unpack_2e188);
+	((void (*)(u32))((u64)((char *)&F_oob)))((u32)t__2e204);
+	goto L__2e201;
+	L__2e205:;
+	L__2e201:;
+	goto L__2e197;
+	L_false_2e196:;
+	L__2e197:;
+	t__2e209 = (u64)(u32)(*(i32 *)t_binding_2e192);
+	t__2e210 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e208 = (u64)(u32)(((u32)t__2e209 != (u32)t__2e210));
+	if ((u32)t__2e208) goto L_passed_2e207; else goto L_failed_2e206;
+	L_failed_2e206:;
+	t_abortsite_2e212 = ((u64)0UL);
+	goto L_abort_2e213;
+	L_passed_2e207:;
+	*(u32 *)t_binding_2e219 = (u32)((u64)0UL);
+	t__2e220 = (u64)(u32)(*(i32 *)t_binding_2e192);
+	t__2e221 = ((u64)0UL);
+	((void (*)(u32, u64, u32, u64))((u64)X_rt_2ewait4))((u32)t__2e220, (u64)t_binding_2e219, (u32)((u64)0UL), (u64)t__2e221);
+	t__2e225 = (u64)(u32)(*(i32 *)t_binding_2e219);
+	t__2e224 = (u64)(u32)(((u32 (*)(u32))((u64)X_rt_2ewifexited))((u32)t__2e225));
+	if ((u32)t__2e224) goto L_passed_2e223; else goto L_failed_2e222;
+	L_failed_2e222:;
+	t_abortsite_2e212 = ((u64)1UL);
+	goto L_abort_2e213;
+	L_passed_2e223:;
+	t__2e230 = (u64)(u32)(*(i32 *)t_binding_2e219);
+	t__2e229 = (u64)(u32)(((u32 (*)(u32))((u64)X_rt_2ewexitstatus))((u32)t__2e230));
+	t__2e231 = (u64)(u32)(*(i32 *)t_unpack_2e189);
+	t__2e228 = (u64)(u32)(((u32)t__2e229 == (u32)t__2e231));
+	if ((u32)t__2e228) goto L_passed_2e227; else goto L_failed_2e226;
+	L_failed_2e226:;
+	t_abortsite_2e212 = ((u64)2UL);
+	goto L_abort_2e213;
+	L_passed_2e227:;
+	goto L__2e190;
+	L__2e232:;
+	L__2e190:;
+	L_after_2e183:;
+	t_ptr_2e184 = (u64)((u64)t_ptr_2e184 + (u64)((u64)8UL));
+	goto L_loop_2e179;
+	L__2e182:;
+	goto L__2e169;
+	L__2e233:;
+	L__2e169:;
+	return;
+	L_abort_2e213:;
+	t__2e214 = (u64)((u64)t_abortsite_2e212 * (u64)((u64)16UL));
+	t__2e214 = (u64)((u64)((u64)((char *)&D_abortsites_2e211)) + (u64)t__2e214);
+	t__2e215 = (u64)(*(u64 *)t__2e214);
+	t__2e216 = (u64)((u64)t__2e214 + (u64)((u64)8UL));
+	t__2e217 = (u64)(*(u32 *)t__2e216);
+	t__2e216 = (u64)((u64)t__2e214 + (u64)((u64)12UL));
+	t__2e218 = (u64)(*(u32 *)t__2e216);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e215, (u64)t__2e217, (u64)t__2e218, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_oob(u32 p_path) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[12] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	u64 t__2e248;
+	u64 t__2e249;
+	u64 t__2e250;
+	u64 t__2e253;
+	u64 t__2e254;
+	u64 t__2e255;
+	u64 t__2e261;
+	u64 t__2e262;
+	u64 t__2e263;
+	u64 t__2e264;
+	u64 t__2e265;
+	u64 t__2e269;
+	u64 t__2e275;
+	u64 t__2e276;
+	u64 t__2e277;
+	u64 t__2e280;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e286;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e289;
+	u64 t__2e290;
+	u64 t__2e293;
+	u64 t__2e301;
+	u64 t__2e302;
+	u64 t__2e303;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e312;
+	u64 t__2e313;
+	u64 t__2e314;
+	u64 t__2e315;
+	u64 t__2e316;
+	u64 t__2e319;
+	u64 t__2e324;
+	u64 t__2e326;
+	u64 t__2e327;
+	u64 t__2e328;
+	u64 t__2e329;
+	u64 t__2e330;
+	u64 t__2e333;
+	u64 t__2e337;
+	u64 t__2e338;
+	u64 t__2e339;
+	u64 t__2e342;
+	u64 t__2e344;
+	u64 t__2e346;
+	u64 t_abortsite_2e259;
+	u64 t_binding_2e239;
+	u64 t_binding_2e242;
+	u64 t_binding_2e243;
+	u64 t_cleanup_2e266;
+	u64 t_item_2e241;
+	u64 t_param_2e235;
+	u64 t_path;
+	t_path = (u64)p_path;
+	L_start_2e234:;
+	t_param_2e235 = (u64)A0;
+	t_binding_2e239 = (u64)A1;
+	t_binding_2e242 = (u64)A2;
+	t_binding_2e243 = (u64)A3;
+	*(u32 *)t_param_2e235 = (u32)t_path;
+	L_body_2e236:;
+	t_item_2e241 = (u64)((u64)t_binding_2e239 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e241 = (u32)((u64)1UL);
+	t_item_2e241 = (u64)((u64)t_binding_2e239 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e241 = (u32)((u64)2UL);
+	t_item_2e241 = (u64)((u64)t_binding_2e239 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e241 = (u32)((u64)3UL);
+	*(u64 *)t_binding_2e242 = (u64)((u64)5UL);
+	*(u32 *)t_binding_2e243 = (u32)((u64)0UL);
+	t__2e249 = (u64)(u32)(*(i32 *)t_param_2e235);
+	t__2e248 = (u64)(u32)(((u32)t__2e249 == (u32)((u64)0UL)));
+	t__2e250 = (u64)(u32)((u8)t__2e248);
+	if ((u32)t__2e250) goto L_true_2e245; else goto L_false_2e246;
+	L_true_2e245:;
+	t__2e254 = (u64)(*(u64 *)t_binding_2e242);
+	t__2e253 = (u64)((u64)t__2e254 * (u64)((u64)4UL));
+	t__2e253 = (u64)((u64)t_binding_2e239 + (u64)t__2e253);
+	t__2e255 = (u64)(u32)(((u64)t__2e254 < (u64)((u64)3UL)));
+	if ((u32)t__2e255) goto L__2e257; else goto L__2e256;
+	L__2e256:;
+	t_abortsite_2e259 = ((u64)0UL);
+	goto L_abort_2e260;
+	L__2e257:;
+	t__2e269 = (u64)(u32)(*(i32 *)t__2e253);
+	goto L__2e251;
+	L__2e270:;
+	L__2e251:;
+	goto L__2e247;
+	L_false_2e246:;
+	L__2e247:;
+	t__2e276 = (u64)(u32)(*(i32 *)t_param_2e235);
+	t__2e275 = (u64)(u32)(((u32)t__2e276 == (u32)((u64)1UL)));
+	t__2e277 = (u64)(u32)((u8)t__2e275);
+	if ((u32)t__2e277) goto L_true_2e272; else goto L_false_2e273;
+	L_true_2e272:;
+	t__2e281 = (u64)(*(u64 *)t_binding_2e242);
+	t__2e280 = (u64)((u64)t__2e281 * (u64)((u64)4UL));
+	t__2e280 = (u64)((u64)t_binding_2e239 + (u64)t__2e280);
+	t__2e282 = (u64)(u32)(((u64)t__2e281 < (u64)((u64)3UL)));
+	if ((u32)t__2e282) goto L__2e284; else goto L__2e283;
+	L__2e283:;
+	t_abortsite_2e259 = ((u64)1UL);
+	goto L_abort_2e285;
+	L__2e284:;
+	t__2e293 = (u64)(u32)(*(i32 *)t__2e280);
+	goto L__2e278;
+	L__2e294:;
+	L__2e278:;
+	goto L__2e274;
+	L_false_2e273:;
+	L__2e274:;
+	t__2e302 = (u64)(u32)(*(i32 *)t_param_2e235);
+	t__2e301 = (u64)(u32)(((u32)t__2e302 == (u32)((u64)2UL)));
+	t__2e303 = (u64)(u32)((u8)t__2e301);
+	if ((u32)t__2e303) goto L_true_2e298; else goto L_false_2e299;
+	L_true_2e298:;
+	t__2e307 = (u64)(*(u64 *)t_binding_2e242);
+	t__2e306 = (u64)((u64)t__2e307 * (u64)((u64)4UL));
+	t__2e306 = (u64)((u64)t_binding_2e239 + (u64)t__2e306);
+	t__2e308 = (u64)(u32)(((u64)t__2e307 < (u64)((u64)3UL)));
+	if ((u32)t__2e308) goto L__2e310; else goto L__2e309;
+	L__2e309:;
+	t_abortsite_2e259 = ((u64)2UL);
+	goto L_abort_2e311;
+	L__2e310:;
+	t__2e319 = (u64)(u32)(*(i32 *)t__2e306);
+	goto L__2e304;
+	L__2e320:;
+	L__2e304:;
+	goto L__2e300;
+	L_false_2e299:;
+	L__2e300:;
+	t_cleanup_2e266 = (u64)(u32)((u64)3UL);
+	goto L_defer_2e317;
+	L_resume_2e321:;
+	goto L__2e295;
+	L__2e322:;
+	goto L__2e323;
+	L_defer_2e317:;
+	t__2e324 = (u64)(u32)(*(i32 *)t_binding_2e243);
+	t__2e324 = (u64)(u32)((u32)t__2e324 + (u32)((u64)4UL));
+	*(u32 *)t_binding_2e243 = (u32)t__2e324;
+	t__2e326 = (u64)(u32)(((u32)t_cleanup_2e266 == (u32)((u64)3UL)));
+	if ((u32)t__2e326) goto L_resume_2e321; else goto L__2e325;
+	L__2e325:;
+	goto L_defer_2e291;
+	L__2e323:;
+	L__2e295:;
+	t__2e327 = (u64)(u32)(*(i32 *)t_binding_2e243);
+	t__2e327 = (u64)(u32)((u32)t__2e327 + (u32)((u64)8UL));
+	*(u32 *)t_binding_2e243 = (u32)t__2e327;
+	t__2e329 = (u64)(*(u64 *)t_binding_2e242);
+	t__2e328 = (u64)((u64)t__2e329 * (u64)((u64)4UL));
+	t__2e328 = (u64)((u64)t_binding_2e239 + (u64)t__2e328);
+	t__2e330 = (u64)(u32)(((u64)t__2e329 < (u64)((u64)3UL)));
+	if ((u32)t__2e330) goto L__2e332; else goto L__2e331;
+	L__2e331:;
+	t_abortsite_2e259 = ((u64)3UL);
+	goto L_abort_2e285;
+	L__2e332:;
+	t__2e333 = (u64)(u32)(*(i32 *)t__2e328);
+	t_cleanup_2e266 = (u64)(u32)((u64)4UL);
+	goto L_defer_2e291;
+	L_resume_2e334:;
+	goto L__2e237;
+	L__2e335:;
+	goto L__2e336;
+	L_defer_2e291:;
+	t__2e337 = (u64)(u32)(*(i32 *)t_binding_2e243);
+	t__2e337 = (u64)(u32)((u32)t__2e337 + (u32)((u64)2UL));
+	*(u32 *)t_binding_2e243 = (u32)t__2e337;
+	L_defer_2e267:;
+	t__2e338 = (u64)(u32)(*(i32 *)t_binding_2e243);
+	t__2e338 = (u64)(u32)((u32)t__2e338 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e243 = (u32)t__2e338;
+	t__2e339 = (u64)(u32)(*(i32 *)t_binding_2e243);
+	((void (*)(u32))((u64)X_rt_2eexit))((u32)t__2e339);
+	__builtin_trap();
+	L__2e340:;
+	t__2e342 = (u64)(u32)(((u32)t_cleanup_2e266 == (u32)((u64)4UL)));
+	if ((u32)t__2e342) goto L_resume_2e334; else goto L__2e341;
+	L__2e341:;
+	t__2e344 = (u64)(u32)(((u32)t_cleanup_2e266 == (u32)((u64)2UL)));
+	if ((u32)t__2e344) goto L_resume_2e318; else goto L__2e343;
+	L__2e343:;
+	t__2e346 = (u64)(u32)(((u32)t_cleanup_2e266 == (u32)((u64)1UL)));
+	if ((u32)t__2e346) goto L_resume_2e292; else goto L__2e345;
+	L__2e345:;
+	goto L_resume_2e268;
+	L__2e336:;
+	L__2e237:;
+	return;
+	L_abort_2e260:;
+	t__2e261 = (u64)((u64)t_abortsite_2e259 * (u64)((u64)16UL));
+	t__2e261 = (u64)((u64)((u64)((char *)&D_abortsites_2e258)) + (u64)t__2e261);
+	t__2e262 = (u64)(*(u64 *)t__2e261);
+	t__2e263 = (u64)((u64)t__2e261 + (u64)((u64)8UL));
+	t__2e264 = (u64)(*(u32 *)t__2e263);
+	t__2e263 = (u64)((u64)t__2e261 + (u64)((u64)12UL));
+	t__2e265 = (u64)(*(u32 *)t__2e263);
+	t_cleanup_2e266 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e267;
+	L_resume_2e268:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e262, (u64)t__2e264, (u64)t__2e265, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e285:;
+	t__2e286 = (u64)((u64)t_abortsite_2e259 * (u64)((u64)16UL));
+	t__2e286 = (u64)((u64)((u64)((char *)&D_abortsites_2e258)) + (u64)t__2e286);
+	t__2e287 = (u64)(*(u64 *)t__2e286);
+	t__2e288 = (u64)((u64)t__2e286 + (u64)((u64)8UL));
+	t__2e289 = (u64)(*(u32 *)t__2e288);
+	t__2e288 = (u64)((u64)t__2e286 + (u64)((u64)12UL));
+	t__2e290 = (u64)(*(u32 *)t__2e288);
+	t_cleanup_2e266 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e291;
+	L_resume_2e292:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e287, (u64)t__2e289, (u64)t__2e290, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e311:;
+	t__2e312 = (u64)((u64)t_abortsite_2e259 * (u64)((u64)16UL));
+	t__2e312 = (u64)((u64)((u64)((char *)&D_abortsites_2e258)) + (u64)t__2e312);
+	t__2e313 = (u64)(*(u64 *)t__2e312);
+	t__2e314 = (u64)((u64)t__2e312 + (u64)((u64)8UL));
+	t__2e315 = (u64)(*(u32 *)t__2e314);
+	t__2e314 = (u64)((u64)t__2e312 + (u64)((u64)12UL));
+	t__2e316 = (u64)(*(u32 *)t__2e314);
+	t_cleanup_2e266 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e317;
+	L_resume_2e318:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e313, (u64)t__2e315, (u64)t__2e316, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_deferred__exits(void) {
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e358;
+	u64 t__2e359;
+	u64 t__2e360;
+	u64 t__2e361;
+	u64 t__2e362;
+	u64 t__2e365;
+	u64 t__2e366;
+	u64 t__2e369;
+	u64 t__2e370;
+	u64 t__2e373;
+	u64 t__2e374;
+	u64 t__2e377;
+	u64 t__2e378;
+	u64 t__2e381;
+	u64 t__2e382;
+	u64 t__2e385;
+	u64 t__2e386;
+	u64 t__2e389;
+	u64 t__2e390;
+	u64 t__2e393;
+	u64 t__2e394;
+	u64 t_abortsite_2e356;
+	L_start_2e347:;
+	L_body_2e348:;
+	t__2e354 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_deferred__exit)))((u32)((u64)0UL)));
+	t__2e353 = (u64)(u32)(((u32)t__2e354 == (u32)((u64)10UL)));
+	if ((u32)t__2e353) goto L_passed_2e352; else goto L_failed_2e351;
+	L_failed_2e351:;
+	t_abortsite_2e356 = ((u64)0UL);
+	goto L_abort_2e357;
+	L_passed_2e352:;
+	t__2e366 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_deferred__exit)))((u32)((u64)1UL)));
+	t__2e365 = (u64)(u32)(((u32)t__2e366 == (u32)((u64)20UL)));
+	if ((u32)t__2e365) goto L_passed_2e364; else goto L_failed_2e363;
+	L_failed_2e363:;
+	t_abortsite_2e356 = ((u64)1UL);
+	goto L_abort_2e357;
+	L_passed_2e364:;
+	t__2e370 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_deferred__exit)))((u32)((u64)2UL)));
+	t__2e369 = (u64)(u32)(((u32)t__2e370 == (u32)((u64)30UL)));
+	if ((u32)t__2e369) goto L_passed_2e368; else goto L_failed_2e367;
+	L_failed_2e367:;
+	t_abortsite_2e356 = ((u64)2UL);
+	goto L_abort_2e357;
+	L_passed_2e368:;
+	t__2e374 = (u64)(u32)(*(i32 *)((u64)((char *)&D_ran)));
+	t__2e373 = (u64)(u32)(((u32)t__2e374 == (u32)((u64)6UL)));
+	if ((u32)t__2e373) goto L_passed_2e372; else goto L_failed_2e371;
+	L_failed_2e371:;
+	t_abortsite_2e356 = ((u64)3UL);
+	goto L_abort_2e357;
+	L_passed_2e372:;
+	t__2e378 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_deferred__call)))((u32)((u64)0UL)));
+	t__2e377 = (u64)(u32)(((u32)t__2e378 == (u32)((u64)10UL)));
+	if ((u32)t__2e377) goto L_passed_2e376; else goto L_failed_2e375;
+	L_failed_2e375:;
+	t_abortsite_2e356 = ((u64)4UL);
+	goto L_abort_2e357;
+	L_passed_2e376:;
+	t__2e382 = (u64)(u32)(*(i32 *)((u64)((char *)&D_ran)));
+	t__2e381 = (u64)(u32)(((u32)t__2e382 == (u32)((u64)17UL)));
+	if ((u32)t__2e381) goto L_passed_2e380; else goto L_failed_2e379;
+	L_failed_2e379:;
+	t_abortsite_2e356 = ((u64)5UL);
+	goto L_abort_2e357;
+	L_passed_2e380:;
+	t__2e386 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_deferred__call)))((u32)((u64)1UL)));
+	t__2e385 = (u64)(u32)(((u32)t__2e386 == (u32)((u64)20UL)));
+	if ((u32)t__2e385) goto L_passed_2e384; else goto L_failed_2e383;
+	L_failed_2e383:;
+	t_abortsite_2e356 = ((u64)6UL);
+	goto L_abort_2e357;
+	L_passed_2e384:;
+	t__2e390 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_deferred__call)))((u32)((u64)2UL)));
+	t__2e389 = (u64)(u32)(((u32)t__2e390 == (u32)((u64)30UL)));
+	if ((u32)t__2e389) goto L_passed_2e388; else goto L_failed_2e387;
+	L_failed_2e387:;
+	t_abortsite_2e356 = ((u64)7UL);
+	goto L_abort_2e357;
+	L_passed_2e388:;
+	t__2e394 = (u64)(u32)(*(i32 *)((u64)((char *)&D_ran)));
+	t__2e393 = (u64)(u32)(((u32)t__2e394 == (u32)((u64)19UL)));
+	if ((u32)t__2e393) goto L_passed_2e392; else goto L_failed_2e391;
+	L_failed_2e391:;
+	t_abortsite_2e356 = ((u64)8UL);
+	goto L_abort_2e357;
+	L_passed_2e392:;
+	goto L__2e349;
+	L__2e395:;
+	L__2e349:;
+	return;
+	L_abort_2e357:;
+	t__2e358 = (u64)((u64)t_abortsite_2e356 * (u64)((u64)16UL));
+	t__2e358 = (u64)((u64)((u64)((char *)&D_abortsites_2e355)) + (u64)t__2e358);
+	t__2e359 = (u64)(*(u64 *)t__2e358);
+	t__2e360 = (u64)((u64)t__2e358 + (u64)((u64)8UL));
+	t__2e361 = (u64)(*(u32 *)t__2e360);
+	t__2e360 = (u64)((u64)t__2e358 + (u64)((u64)12UL));
+	t__2e362 = (u64)(*(u32 *)t__2e360);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e359, (u64)t__2e361, (u64)t__2e362, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_deferred__call(u32 p_n) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e405;
+	u64 t__2e406;
+	u64 t__2e407;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e421;
+	u64 t__2e430;
+	u64 t__2e432;
+	u64 t__2e434;
+	u64 t_cleanup_2e410;
+	u64 t_n;
+	u64 t_param_2e397;
+	t_n = (u64)p_n;
+	L_start_2e396:;
+	t_param_2e397 = (u64)A0;
+	*(u32 *)t_param_2e397 = (u32)t_n;
+	L_body_2e398:;
+	t__2e406 = (u64)(u32)(*(i32 *)t_param_2e397);
+	t__2e405 = (u64)(u32)(((u32)t__2e406 == (u32)((u64)0UL)));
+	t__2e407 = (u64)(u32)((u8)t__2e405);
+	if ((u32)t__2e407) goto L_true_2e402; else goto L_false_2e403;
+	L_true_2e402:;
+	t_cleanup_2e410 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e411;
+	L_resume_2e412:;
+	return (u32)((u64)10UL);
+	L__2e413:;
+	L__2e408:;
+	L__2e414:;
+	L_false_2e403:;
+	L__2e404:;
+	t__2e420 = (u64)(u32)(*(i32 *)t_param_2e397);
+	t__2e419 = (u64)(u32)(((u32)t__2e420 == (u32)((u64)1UL)));
+	t__2e421 = (u64)(u32)((u8)t__2e419);
+	if ((u32)t__2e421) goto L_true_2e416; else goto L_false_2e417;
+	L_true_2e416:;
+	t_cleanup_2e410 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e411;
+	L_resume_2e424:;
+	return (u32)((u64)20UL);
+	L__2e425:;
+	L__2e422:;
+	L__2e426:;
+	L_false_2e417:;
+	L__2e418:;
+	t_cleanup_2e410 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e411;
+	L_resume_2e427:;
+	return (u32)((u64)30UL);
+	L__2e428:;
+	goto L__2e429;
+	L_defer_2e411:;
+	t__2e430 = (u64)(u32)(*(i32 *)t_param_2e397);
+	((void (*)(u32))((u64)((char *)&F_release)))((u32)t__2e430);
+	t__2e432 = (u64)(u32)(((u32)t_cleanup_2e410 == (u32)((u64)2UL)));
+	if ((u32)t__2e432) goto L_resume_2e427; else goto L__2e431;
+	L__2e431:;
+	t__2e434 = (u64)(u32)(((u32)t_cleanup_2e410 == (u32)((u64)1UL)));
+	if ((u32)t__2e434) goto L_resume_2e424; else goto L__2e433;
+	L__2e433:;
+	goto L_resume_2e412;
+	L__2e429:;
+	L__2e399:;
+	L__2e435:;
+	return 0;
+}
+static void F_release(u32 p_n) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e445;
+	u64 t__2e446;
+	u64 t__2e447;
+	u64 t__2e455;
+	u64 t__2e459;
+	u64 t__2e461;
+	u64 t_cleanup_2e450;
+	u64 t_n;
+	u64 t_param_2e437;
+	t_n = (u64)p_n;
+	L_start_2e436:;
+	t_param_2e437 = (u64)A0;
+	*(u32 *)t_param_2e437 = (u32)t_n;
+	L_body_2e438:;
+	t__2e446 = (u64)(u32)(*(i32 *)t_param_2e437);
+	t__2e445 = (u64)(u32)(((i32)t__2e446 > (i32)((u64)0UL)));
+	t__2e447 = (u64)(u32)((u8)t__2e445);
+	if ((u32)t__2e447) goto L_true_2e442; else goto L_false_2e443;
+	L_true_2e442:;
+	t_cleanup_2e450 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e451;
+	L_resume_2e452:;
+	return;
+	L__2e453:;
+	L__2e448:;
+	L__2e454:;
+	L_false_2e443:;
+	L__2e444:;
+	t__2e455 = (u64)(u32)(*(i32 *)((u64)((char *)&D_ran)));
+	t__2e455 = (u64)(u32)((u32)t__2e455 + (u32)((u64)10UL));
+	*(u32 *)((u64)((char *)&D_ran)) = (u32)t__2e455;
+	t_cleanup_2e450 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e451;
+	L_resume_2e456:;
+	goto L__2e439;
+	L__2e457:;
+	goto L__2e458;
+	L_defer_2e451:;
+	t__2e459 = (u64)(u32)(*(i32 *)((u64)((char *)&D_ran)));
+	t__2e459 = (u64)(u32)((u32)t__2e459 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_ran)) = (u32)t__2e459;
+	t__2e461 = (u64)(u32)(((u32)t_cleanup_2e450 == (u32)((u64)1UL)));
+	if ((u32)t__2e461) goto L_resume_2e456; else goto L__2e460;
+	L__2e460:;
+	goto L_resume_2e452;
+	L__2e458:;
+	L__2e439:;
+	return;
+}
+static u32 F_deferred__exit(u32 p_n) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e471;
+	u64 t__2e472;
+	u64 t__2e473;
+	u64 t__2e485;
+	u64 t__2e486;
+	u64 t__2e487;
+	u64 t__2e504;
+	u64 t__2e505;
+	u64 t__2e512;
+	u64 t__2e513;
+	u64 t__2e514;
+	u64 t__2e525;
+	u64 t__2e527;
+	u64 t__2e528;
+	u64 t__2e531;
+	u64 t__2e533;
+	u64 t_binding_2e503;
+	u64 t_cleanup_2e476;
+	u64 t_cleanup_2e517;
+	u64 t_n;
+	u64 t_param_2e463;
+	t_n = (u64)p_n;
+	L_start_2e462:;
+	t_param_2e463 = (u64)A0;
+	t_binding_2e503 = (u64)A1;
+	*(u32 *)t_param_2e463 = (u32)t_n;
+	L_body_2e464:;
+	t__2e472 = (u64)(u32)(*(i32 *)t_param_2e463);
+	t__2e471 = (u64)(u32)(((u32)t__2e472 == (u32)((u64)0UL)));
+	t__2e473 = (u64)(u32)((u8)t__2e471);
+	if ((u32)t__2e473) goto L_true_2e468; else goto L_false_2e469;
+	L_true_2e468:;
+	t_cleanup_2e476 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e477;
+	L_resume_2e478:;
+	return (u32)((u64)10UL);
+	L__2e479:;
+	L__2e474:;
+	L__2e480:;
+	L_false_2e469:;
+	L__2e470:;
+	t__2e486 = (u64)(u32)(*(i32 *)t_param_2e463);
+	t__2e485 = (u64)(u32)(((u32)t__2e486 == (u32)((u64)1UL)));
+	t__2e487 = (u64)(u32)((u8)t__2e485);
+	if ((u32)t__2e487) goto L_true_2e482; else goto L_false_2e483;
+	L_true_2e482:;
+	t_cleanup_2e476 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e477;
+	L_resume_2e490:;
+	return (u32)((u64)20UL);
+	L__2e491:;
+	L__2e488:;
+	L__2e492:;
+	L_false_2e483:;
+	L__2e484:;
+	t_cleanup_2e476 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e477;
+	L_resume_2e493:;
+	return (u32)((u64)30UL);
+	L__2e494:;
+	goto L__2e495;
+	L_defer_2e477:;
+	*(u32 *)t_binding_2e503 = (u32)((u64)0UL);
+	L_loop_2e498:;
+	t__2e505 = (u64)(u32)(*(i32 *)t_binding_2e503);
+	t__2e504 = (u64)(u32)(((i32)t__2e505 < (i32)((u64)3UL)));
+	if ((u32)t__2e504) goto L_body_2e499; else goto L__2e501;
+	L_body_2e499:;
+	t__2e513 = (u64)(u32)(*(i32 *)t_binding_2e503);
+	t__2e512 = (u64)(u32)(((u32)t__2e513 == (u32)((u64)1UL)));
+	t__2e514 = (u64)(u32)((u8)t__2e512);
+	if ((u32)t__2e514) goto L_true_2e509; else goto L_false_2e510;
+	L_true_2e509:;
+	t_cleanup_2e517 = (u64)(u32)((u64)3UL);
+	goto L_defer_2e518;
+	L_resume_2e519:;
+	goto L__2e501;
+	L__2e520:;
+	L__2e515:;
+	L__2e521:;
+	L_false_2e510:;
+	L__2e511:;
+	t_cleanup_2e517 = (u64)(u32)((u64)4UL);
+	goto L_defer_2e518;
+	L_resume_2e522:;
+	goto L__2e506;
+	L__2e523:;
+	goto L__2e524;
+	L_defer_2e518:;
+	t__2e525 = (u64)(u32)(*(i32 *)((u64)((char *)&D_ran)));
+	t__2e525 = (u64)(u32)((u32)t__2e525 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_ran)) = (u32)t__2e525;
+	t__2e527 = (u64)(u32)(((u32)t_cleanup_2e517 == (u32)((u64)4UL)));
+	if ((u32)t__2e527) goto L_resume_2e522; else goto L__2e526;
+	L__2e526:;
+	goto L_resume_2e519;
+	L__2e524:;
+	L__2e506:;
+	L_after_2e502:;
+	t__2e528 = (u64)(u32)(*(i32 *)t_binding_2e503);
+	t__2e528 = (u64)(u32)((u32)t__2e528 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e503 = (u32)t__2e528;
+	goto L_loop_2e498;
+	L__2e501:;
+	goto L__2e496;
+	L__2e529:;
+	L__2e496:;
+	t__2e531 = (u64)(u32)(((u32)t_cleanup_2e476 == (u32)((u64)2UL)));
+	if ((u32)t__2e531) goto L_resume_2e493; else goto L__2e530;
+	L__2e530:;
+	t__2e533 = (u64)(u32)(((u32)t_cleanup_2e476 == (u32)((u64)1UL)));
+	if ((u32)t__2e533) goto L_resume_2e490; else goto L__2e532;
+	L__2e532:;
+	goto L_resume_2e478;
+	L__2e495:;
+	L__2e465:;
+	L__2e534:;
+	return 0;
+}
+static void F_shared(void) {
+	char A0[192] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	char A3[16] __attribute__((aligned(16)));
+	char A4[32] __attribute__((aligned(16)));
+	char A5[16] __attribute__((aligned(16)));
+	char A6[20] __attribute__((aligned(16)));
+	char A7[32] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	u64 t__2e548;
+	u64 t__2e553;
+	u64 t__2e557;
+	u64 t__2e562;
+	u64 t__2e566;
+	u64 t__2e571;
+	u64 t__2e587;
+	u64 t__2e590;
+	u64 t__2e591;
+	u64 t__2e592;
+	u64 t__2e593;
+	u64 t__2e597;
+	u64 t__2e598;
+	u64 t__2e599;
+	u64 t__2e600;
+	u64 t__2e601;
+	u64 t__2e607;
+	u64 t__2e608;
+	u64 t__2e609;
+	u64 t__2e610;
+	u64 t__2e611;
+	u64 t__2e612;
+	u64 t__2e613;
+	u64 t__2e620;
+	u64 t__2e621;
+	u64 t__2e622;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e629;
+	u64 t__2e630;
+	u64 t__2e631;
+	u64 t__2e632;
+	u64 t__2e633;
+	u64 t__2e634;
+	u64 t__2e635;
+	u64 t__2e636;
+	u64 t__2e640;
+	u64 t__2e641;
+	u64 t__2e642;
+	u64 t__2e643;
+	u64 t__2e644;
+	u64 t__2e646;
+	u64 t__2e647;
+	u64 t__2e648;
+	u64 t__2e649;
+	u64 t__2e650;
+	u64 t__2e651;
+	u64 t__2e652;
+	u64 t__2e654;
+	u64 t__2e658;
+	u64 t__2e660;
+	u64 t__2e662;
+	u64 t_abortsite_2e595;
+	u64 t_binding_2e539;
+	u64 t_binding_2e586;
+	u64 t_binding_2e619;
+	u64 t_cleanup_2e602;
+	u64 t_cur__object_2e578;
+	u64 t_end_2e579;
+	u64 t_item_2e543;
+	u64 t_item_2e547;
+	u64 t_item_2e552;
+	u64 t_item_2e556;
+	u64 t_item_2e561;
+	u64 t_item_2e565;
+	u64 t_item_2e570;
+	u64 t_object_2e545;
+	u64 t_object_2e550;
+	u64 t_object_2e555;
+	u64 t_object_2e559;
+	u64 t_object_2e564;
+	u64 t_object_2e568;
+	u64 t_ptr_2e577;
+	u64 t_unpack_2e581;
+	u64 t_unpack_2e582;
+	u64 t_unpack_2e583;
+	u64 t_valid_2e580;
+	u64 t_value_2e544;
+	u64 t_value_2e549;
+	u64 t_value_2e554;
+	u64 t_value_2e558;
+	u64 t_value_2e563;
+	u64 t_value_2e567;
+	L_start_2e535:;
+	t_binding_2e539 = (u64)A0;
+	t_object_2e545 = (u64)A1;
+	t_object_2e550 = (u64)A2;
+	t_object_2e555 = (u64)A3;
+	t_object_2e559 = (u64)A4;
+	t_object_2e564 = (u64)A5;
+	t_object_2e568 = (u64)A6;
+	t_cur__object_2e578 = (u64)A7;
+	t_binding_2e586 = (u64)A8;
+	t_binding_2e619 = (u64)A9;
+	L_body_2e536:;
+	t_item_2e543 = (u64)((u64)t_binding_2e539 + (u64)((u64)0UL));
+	t_value_2e544 = (u64)((u64)t_item_2e543 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e544 = (u32)((u64)0UL);
+	t_value_2e544 = (u64)((u64)t_item_2e543 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e544 = (u32)((u64)0UL);
+	t_value_2e544 = (u64)((u64)t_item_2e543 + (u64)((u64)8UL));
+	t_item_2e547 = (u64)((u64)t_object_2e545 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e547 = (u32)((u64)1UL);
+	*(u64 *)t_value_2e544 = (u64)t_object_2e545;
+	t__2e548 = (u64)((u64)t_value_2e544 + (u64)((u64)8UL));
+	*(u64 *)t__2e548 = (u64)((u64)1UL);
+	t__2e548 = (u64)((u64)t__2e548 + (u64)((u64)8UL));
+	*(u64 *)t__2e548 = (u64)((u64)1UL);
+	t_item_2e543 = (u64)((u64)t_binding_2e539 + (u64)((u64)32UL));
+	t_value_2e549 = (u64)((u64)t_item_2e543 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e549 = (u32)((u64)1UL);
+	t_value_2e549 = (u64)((u64)t_item_2e543 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e549 = (u32)((u64)1UL);
+	t_value_2e549 = (u64)((u64)t_item_2e543 + (u64)((u64)8UL));
+	t_item_2e552 = (u64)((u64)t_object_2e550 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e552 = (u32)((u64)4UL);
+	t_item_2e552 = (u64)((u64)t_object_2e550 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e552 = (u32)((u64)3UL);
+	t_item_2e552 = (u64)((u64)t_object_2e550 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e552 = (u32)((u64)2UL);
+	t_item_2e552 = (u64)((u64)t_object_2e550 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e552 = (u32)((u64)1UL);
+	*(u64 *)t_value_2e549 = (u64)t_object_2e550;
+	t__2e553 = (u64)((u64)t_value_2e549 + (u64)((u64)8UL));
+	*(u64 *)t__2e553 = (u64)((u64)4UL);
+	t__2e553 = (u64)((u64)t__2e553 + (u64)((u64)8UL));
+	*(u64 *)t__2e553 = (u64)((u64)4UL);
+	t_item_2e543 = (u64)((u64)t_binding_2e539 + (u64)((u64)64UL));
+	t_value_2e554 = (u64)((u64)t_item_2e543 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e554 = (u32)((u64)2UL);
+	t_value_2e554 = (u64)((u64)t_item_2e543 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e554 = (u32)((u64)3UL);
+	t_value_2e554 = (u64)((u64)t_item_2e543 + (u64)((u64)8UL));
+	t_item_2e556 = (u64)((u64)t_object_2e555 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e556 = (u32)((u64)4UL);
+	t_item_2e556 = (u64)((u64)t_object_2e555 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e556 = (u32)((u64)3UL);
+	t_item_2e556 = (u64)((u64)t_object_2e555 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e556 = (u32)((u64)2UL);
+	t_item_2e556 = (u64)((u64)t_object_2e555 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e556 = (u32)((u64)1UL);
+	*(u64 *)t_value_2e554 = (u64)t_object_2e555;
+	t__2e557 = (u64)((u64)t_value_2e554 + (u64)((u64)8UL));
+	*(u64 *)t__2e557 = (u64)((u64)4UL);
+	t__2e557 = (u64)((u64)t__2e557 + (u64)((u64)8UL));
+	*(u64 *)t__2e557 = (u64)((u64)4UL);
+	t_item_2e543 = (u64)((u64)t_binding_2e539 + (u64)((u64)96UL));
+	t_value_2e558 = (u64)((u64)t_item_2e543 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e558 = (u32)((u64)3UL);
+	t_value_2e558 = (u64)((u64)t_item_2e543 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e558 = (u32)((u64)3UL);
+	t_value_2e558 = (u64)((u64)t_item_2e543 + (u64)((u64)8UL));
+	t_item_2e561 = (u64)((u64)t_object_2e559 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e561 = (u32)((u64)4UL);
+	t_item_2e561 = (u64)((u64)t_object_2e559 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e561 = (u32)((u64)3UL);
+	t_item_2e561 = (u64)((u64)t_object_2e559 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e561 = (u32)((u64)4UL);
+	t_item_2e561 = (u64)((u64)t_object_2e559 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e561 = (u32)((u64)3UL);
+	t_item_2e561 = (u64)((u64)t_object_2e559 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e561 = (u32)((u64)4UL);
+	t_item_2e561 = (u64)((u64)t_object_2e559 + (u64)((u64)20UL));
+	*(u32 *)t_item_2e561 = (u32)((u64)3UL);
+	t_item_2e561 = (u64)((u64)t_object_2e559 + (u64)((u64)24UL));
+	*(u32 *)t_item_2e561 = (u32)((u64)2UL);
+	t_item_2e561 = (u64)((u64)t_object_2e559 + (u64)((u64)28UL));
+	*(u32 *)t_item_2e561 = (u32)((u64)1UL);
+	*(u64 *)t_value_2e558 = (u64)t_object_2e559;
+	t__2e562 = (u64)((u64)t_value_2e558 + (u64)((u64)8UL));
+	*(u64 *)t__2e562 = (u64)((u64)8UL);
+	t__2e562 = (u64)((u64)t__2e562 + (u64)((u64)8UL));
+	*(u64 *)t__2e562 = (u64)((u64)8UL);
+	t_item_2e543 = (u64)((u64)t_binding_2e539 + (u64)((u64)128UL));
+	t_value_2e563 = (u64)((u64)t_item_2e543 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e563 = (u32)((u64)4UL);
+	t_value_2e563 = (u64)((u64)t_item_2e543 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e563 = (u32)((u64)4UL);
+	t_value_2e563 = (u64)((u64)t_item_2e543 + (u64)((u64)8UL));
+	t_item_2e565 = (u64)((u64)t_object_2e564 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e565 = (u32)((u64)4UL);
+	t_item_2e565 = (u64)((u64)t_object_2e564 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e565 = (u32)((u64)3UL);
+	t_item_2e565 = (u64)((u64)t_object_2e564 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e565 = (u32)((u64)2UL);
+	t_item_2e565 = (u64)((u64)t_object_2e564 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e565 = (u32)((u64)1UL);
+	*(u64 *)t_value_2e563 = (u64)t_object_2e564;
+	t__2e566 = (u64)((u64)t_value_2e563 + (u64)((u64)8UL));
+	*(u64 *)t__2e566 = (u64)((u64)4UL);
+	t__2e566 = (u64)((u64)t__2e566 + (u64)((u64)8UL));
+	*(u64 *)t__2e566 = (u64)((u64)4UL);
+	t_item_2e543 = (u64)((u64)t_binding_2e539 + (u64)((u64)160UL));
+	t_value_2e567 = (u64)((u64)t_item_2e543 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e567 = (u32)((u64)5UL);
+	t_value_2e567 = (u64)((u64)t_item_2e543 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e567 = (u32)((u64)5UL);
+	t_value_2e567 = (u64)((u64)t_item_2e543 + (u64)((u64)8UL));
+	t_item_2e570 = (u64)((u64)t_object_2e568 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e570 = (u32)((u64)5UL);
+	t_item_2e570 = (u64)((u64)t_object_2e568 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e570 = (u32)((u64)4UL);
+	t_item_2e570 = (u64)((u64)t_object_2e568 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e570 = (u32)((u64)3UL);
+	t_item_2e570 = (u64)((u64)t_object_2e568 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e570 = (u32)((u64)2UL);
+	t_item_2e570 = (u64)((u64)t_object_2e568 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e570 = (u32)((u64)1UL);
+	*(u64 *)t_value_2e567 = (u64)t_object_2e568;
+	t__2e571 = (u64)((u64)t_value_2e567 + (u64)((u64)8UL));
+	*(u64 *)t__2e571 = (u64)((u64)5UL);
+	t__2e571 = (u64)((u64)t__2e571 + (u64)((u64)8UL));
+	*(u64 *)t__2e571 = (u64)((u64)5UL);
+	t_ptr_2e577 = t_binding_2e539;
+	t_end_2e579 = (u64)((u64)((u64)6UL) * (u64)((u64)32UL));
+	t_end_2e579 = (u64)((u64)t_ptr_2e577 + (u64)t_end_2e579);
+	L_loop_2e572:;
+	t_valid_2e580 = (u64)(u32)(((u64)t_ptr_2e577 < (u64)t_end_2e579));
+	if ((u32)t_valid_2e580) goto L_valid_2e574; else goto L__2e575;
+	L_valid_2e574:;
+	BLIT(t_cur__object_2e578, t_ptr_2e577, ((u64)32UL));
+	t_unpack_2e581 = (u64)((u64)t_cur__object_2e578 + (u64)((u64)0UL));
+	t_unpack_2e582 = (u64)((u64)t_cur__object_2e578 + (u64)((u64)4UL));
+	t_unpack_2e583 = (u64)((u64)t_cur__object_2e578 + (u64)((u64)8UL));
+	L_body_2e573:;
+	*(u64 *)t_binding_2e586 = (u64)((u64)0UL);
+	t__2e587 = (u64)((u64)t_binding_2e586 + (u64)((u64)8UL));
+	*(u64 *)t__2e587 = (u64)((u64)0UL);
+	t__2e587 = (u64)((u64)t__2e587 + (u64)((u64)8UL));
+	*(u64 *)t__2e587 = (u64)((u64)0UL);
+	t__2e592 = (u64)(u32)(*(i32 *)t_unpack_2e581);
+	t__2e591 = (u64)(u32)(((u32 (*)(u32, u64))((u64)((char *)&F_exits)))((u32)t__2e592, (u64)t_binding_2e586));
+	t__2e593 = (u64)(u32)(*(i32 *)t_unpack_2e582);
+	t__2e590 = (u64)(u32)(((u32)t__2e591 == (u32)t__2e593));
+	if ((u32)t__2e590) goto L_passed_2e589; else goto L_failed_2e588;
+	L_failed_2e588:;
+	t_abortsite_2e595 = ((u64)0UL);
+	goto L_abort_2e596;
+	L_passed_2e589:;
+	t__2e608 = (u64)((u64)t_binding_2e586 + (u64)((u64)8UL));
+	t__2e609 = (u64)((u64)t_binding_2e586 + (u64)((u64)16UL));
+	t__2e610 = (u64)(*(u64 *)t__2e608);
+	t__2e611 = (u64)((u64)t_unpack_2e583 + (u64)((u64)8UL));
+	t__2e612 = (u64)((u64)t_unpack_2e583 + (u64)((u64)16UL));
+	t__2e613 = (u64)(*(u64 *)t__2e611);
+	t__2e607 = (u64)(u32)(((u64)t__2e610 == (u64)t__2e613));
+	if ((u32)t__2e607) goto L_passed_2e606; else goto L_failed_2e605;
+	L_failed_2e605:;
+	t_abortsite_2e595 = ((u64)1UL);
+	goto L_abort_2e596;
+	L_passed_2e606:;
+	*(u64 *)t_binding_2e619 = (u64)((u64)0UL);
+	L_loop_2e614:;
+	t__2e621 = (u64)(*(u64 *)t_binding_2e619);
+	t__2e622 = (u64)((u64)t_unpack_2e583 + (u64)((u64)8UL));
+	t__2e623 = (u64)((u64)t_unpack_2e583 + (u64)((u64)16UL));
+	t__2e624 = (u64)(*(u64 *)t__2e622);
+	t__2e620 = (u64)(u32)(((u64)t__2e621 < (u64)t__2e624));
+	if ((u32)t__2e620) goto L_body_2e615; else goto L__2e617;
+	L_body_2e615:;
+	t__2e631 = (u64)((u64)t_binding_2e586 + (u64)((u64)8UL));
+	t__2e632 = (u64)((u64)t_binding_2e586 + (u64)((u64)16UL));
+	t__2e633 = (u64)(*(u64 *)t_binding_2e586);
+	t__2e634 = (u64)(*(u64 *)t__2e631);
+	t__2e635 = (u64)(*(u64 *)t_binding_2e619);
+	t__2e630 = (u64)((u64)t__2e635 * (u64)((u64)4UL));
+	t__2e630 = (u64)((u64)t__2e633 + (u64)t__2e630);
+	t__2e636 = (u64)(u32)(((u64)t__2e635 < (u64)t__2e634));
+	if ((u32)t__2e636) goto L__2e638; else goto L__2e637;
+	L__2e637:;
+	t_abortsite_2e595 = ((u64)2UL);
+	goto L_abort_2e639;
+	L__2e638:;
+	t__2e646 = (u64)(u32)(*(i32 *)t__2e630);
+	t__2e648 = (u64)((u64)t_unpack_2e583 + (u64)((u64)8UL));
+	t__2e649 = (u64)((u64)t_unpack_2e583 + (u64)((u64)16UL));
+	t__2e650 = (u64)(*(u64 *)t_unpack_2e583);
+	t__2e651 = (u64)(*(u64 *)t_binding_2e619);
+	t__2e647 = (u64)((u64)t__2e651 * (u64)((u64)4UL));
+	t__2e647 = (u64)((u64)t__2e650 + (u64)t__2e647);
+	t__2e652 = (u64)(u32)(*(i32 *)t__2e647);
+	t__2e629 = (u64)(u32)(((u32)t__2e646 == (u32)t__2e652));
+	if ((u32)t__2e629) goto L_passed_2e628; else goto L_failed_2e627;
+	L_failed_2e627:;
+	t_abortsite_2e595 = ((u64)3UL);
+	goto L_abort_2e596;
+	L_passed_2e628:;
+	goto L__2e625;
+	L__2e653:;
+	L__2e625:;
+	L_after_2e618:;
+	t__2e654 = (u64)(*(u64 *)t_binding_2e619);
+	t__2e654 = (u64)((u64)t__2e654 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e619 = (u64)t__2e654;
+	goto L_loop_2e614;
+	L__2e617:;
+	t_cleanup_2e602 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e603;
+	L_resume_2e655:;
+	goto L__2e584;
+	L__2e656:;
+	goto L__2e657;
+	L_defer_2e603:;
+	t__2e658 = (u64)(*(u64 *)t_binding_2e586);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e658);
+	t__2e660 = (u64)(u32)(((u32)t_cleanup_2e602 == (u32)((u64)2UL)));
+	if ((u32)t__2e660) goto L_resume_2e655; else goto L__2e659;
+	L__2e659:;
+	t__2e662 = (u64)(u32)(((u32)t_cleanup_2e602 == (u32)((u64)1UL)));
+	if ((u32)t__2e662) goto L_resume_2e645; else goto L__2e661;
+	L__2e661:;
+	goto L_resume_2e604;
+	L__2e657:;
+	L__2e584:;
+	L_after_2e576:;
+	t_ptr_2e577 = (u64)((u64)t_ptr_2e577 + (u64)((u64)32UL));
+	goto L_loop_2e572;
+	L__2e575:;
+	goto L__2e537;
+	L__2e663:;
+	L__2e537:;
+	return;
+	L_abort_2e596:;
+	t__2e597 = (u64)((u64)t_abortsite_2e595 * (u64)((u64)16UL));
+	t__2e597 = (u64)((u64)((u64)((char *)&D_abortsites_2e594)) + (u64)t__2e597);
+	t__2e598 = (u64)(*(u64 *)t__2e597);
+	t__2e599 = (u64)((u64)t__2e597 + (u64)((u64)8UL));
+	t__2e600 = (u64)(*(u32 *)t__2e599);
+	t__2e599 = (u64)((u64)t__2e597 + (u64)((u64)12UL));
+	t__2e601 = (u64)(*(u32 *)t__2e599);
+	t_cleanup_2e602 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e603;
+	L_resume_2e604:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e598, (u64)t__2e600, (u64)t__2e601, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e639:;
+	t__2e640 = (u64)((u64)t_abortsite_2e595 * (u64)((u64)16UL));
+	t__2e640 = (u64)((u64)((u64)((char *)&D_abortsites_2e594)) + (u64)t__2e640);
+	t__2e641 = (u64)(*(u64 *)t__2e640);
+	t__2e642 = (u64)((u64)t__2e640 + (u64)((u64)8UL));
+	t__2e643 = (u64)(*(u32 *)t__2e642);
+	t__2e642 = (u64)((u64)t__2e640 + (u64)((u64)12UL));
+	t__2e644 = (u64)(*(u32 *)t__2e642);
+	t_cleanup_2e602 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e603;
+	L_resume_2e645:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e641, (u64)t__2e643, (u64)t__2e644, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static u32 F_exits(u32 p_path, u64 p_trace) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	u64 t__2e674;
+	u64 t__2e675;
+	u64 t__2e676;
+	u64 t__2e690;
+	u64 t__2e691;
+	u64 t__2e700;
+	u64 t__2e701;
+	u64 t__2e708;
+	u64 t__2e709;
+	u64 t__2e710;
+	u64 t__2e721;
+	u64 t__2e722;
+	u64 t__2e723;
+	u64 t__2e733;
+	u64 t__2e736;
+	u64 t__2e737;
+	u64 t__2e738;
+	u64 t__2e739;
+	u64 t__2e740;
+	u64 t__2e750;
+	u64 t__2e751;
+	u64 t__2e752;
+	u64 t__2e762;
+	u64 t__2e763;
+	u64 t__2e764;
+	u64 t__2e775;
+	u64 t__2e776;
+	u64 t__2e777;
+	u64 t__2e783;
+	u64 t__2e784;
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e787;
+	u64 t__2e794;
+	u64 t__2e795;
+	u64 t__2e796;
+	u64 t__2e797;
+	u64 t__2e798;
+	u64 t__2e799;
+	u64 t__2e800;
+	u64 t__2e803;
+	u64 t__2e804;
+	u64 t__2e805;
+	u64 t__2e806;
+	u64 t__2e807;
+	u64 t__2e808;
+	u64 t__2e809;
+	u64 t__2e810;
+	u64 t__2e811;
+	u64 t__2e812;
+	u64 t__2e815;
+	u64 t__2e816;
+	u64 t__2e817;
+	u64 t__2e819;
+	u64 t__2e821;
+	u64 t__2e823;
+	u64 t__2e828;
+	u64 t__2e829;
+	u64 t__2e830;
+	u64 t__2e839;
+	u64 t__2e840;
+	u64 t__2e841;
+	u64 t__2e842;
+	u64 t__2e843;
+	u64 t__2e844;
+	u64 t__2e845;
+	u64 t__2e848;
+	u64 t__2e849;
+	u64 t__2e850;
+	u64 t__2e852;
+	u64 t__2e854;
+	u64 t__2e856;
+	u64 t__2e858;
+	u64 t__2e862;
+	u64 t__2e863;
+	u64 t__2e864;
+	u64 t__2e865;
+	u64 t__2e866;
+	u64 t__2e867;
+	u64 t__2e868;
+	u64 t__2e871;
+	u64 t__2e872;
+	u64 t__2e873;
+	u64 t__2e874;
+	u64 t__2e875;
+	u64 t__2e876;
+	u64 t__2e877;
+	u64 t__2e878;
+	u64 t__2e879;
+	u64 t__2e880;
+	u64 t__2e883;
+	u64 t__2e884;
+	u64 t__2e885;
+	u64 t__2e887;
+	u64 t__2e889;
+	u64 t__2e891;
+	u64 t__2e893;
+	u64 t__2e895;
+	u64 t_abortsite_2e781;
+	u64 t_binding_2e689;
+	u64 t_binding_2e699;
+	u64 t_cleanup_2e679;
+	u64 t_param_2e665;
+	u64 t_param_2e666;
+	u64 t_path;
+	u64 t_trace;
+	t_path = (u64)p_path;
+	t_trace = (u64)p_trace;
+	L_start_2e664:;
+	t_param_2e665 = (u64)A0;
+	t_param_2e666 = (u64)A1;
+	t_binding_2e689 = (u64)A2;
+	t_binding_2e699 = (u64)A3;
+	*(u32 *)t_param_2e665 = (u32)t_path;
+	*(u64 *)t_param_2e666 = (u64)t_trace;
+	L_body_2e667:;
+	t__2e675 = (u64)(u32)(*(i32 *)t_param_2e665);
+	t__2e674 = (u64)(u32)(((u32)t__2e675 == (u32)((u64)0UL)));
+	t__2e676 = (u64)(u32)((u8)t__2e674);
+	if ((u32)t__2e676) goto L_true_2e671; else goto L_false_2e672;
+	L_true_2e671:;
+	t_cleanup_2e679 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e680;
+	L_resume_2e681:;
+	return (u32)((u64)0UL);
+	L__2e682:;
+	L__2e677:;
+	L__2e683:;
+	L_false_2e672:;
+	L__2e673:;
+	*(u32 *)t_binding_2e689 = (u32)((u64)0UL);
+	L_loop_2e684:;
+	t__2e691 = (u64)(u32)(*(i32 *)t_binding_2e689);
+	t__2e690 = (u64)(u32)(((i32)t__2e691 < (i32)((u64)3UL)));
+	if ((u32)t__2e690) goto L_body_2e685; else goto L__2e687;
+	L_body_2e685:;
+	*(u32 *)t_binding_2e699 = (u32)((u64)0UL);
+	L_loop_2e694:;
+	t__2e701 = (u64)(u32)(*(i32 *)t_binding_2e699);
+	t__2e700 = (u64)(u32)(((i32)t__2e701 < (i32)((u64)3UL)));
+	if ((u32)t__2e700) goto L_body_2e695; else goto L__2e697;
+	L_body_2e695:;
+	t__2e709 = (u64)(u32)(*(i32 *)t_param_2e665);
+	t__2e708 = (u64)(u32)(((u32)t__2e709 == (u32)((u64)1UL)));
+	t__2e710 = (u64)(u32)((u8)t__2e708);
+	if ((u32)t__2e710) goto L_true_2e705; else goto L_false_2e706;
+	L_true_2e705:;
+	t_cleanup_2e679 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e713;
+	L_resume_2e714:;
+	return (u32)((u64)1UL);
+	L__2e715:;
+	L__2e711:;
+	L__2e716:;
+	L_false_2e706:;
+	L__2e707:;
+	t__2e722 = (u64)(u32)(*(i32 *)t_param_2e665);
+	t__2e721 = (u64)(u32)(((u32)t__2e722 == (u32)((u64)2UL)));
+	t__2e723 = (u64)(u32)((u8)t__2e721);
+	if ((u32)t__2e723) goto L_true_2e718; else goto L_false_2e719;
+	L_true_2e718:;
+	t_cleanup_2e679 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e713;
+	L_resume_2e726:;
+	goto L__2e687;
+	L__2e727:;
+	L__2e724:;
+	L__2e728:;
+	L_false_2e719:;
+	L__2e720:;
+	t__2e737 = (u64)(u32)(*(i32 *)t_param_2e665);
+	t__2e736 = (u64)(u32)(((u32)t__2e737 == (u32)((u64)3UL)));
+	t__2e733 = (u64)(u32)t__2e736;
+	if ((u32)t__2e733) goto L__2e734; else goto L__2e735;
+	L__2e734:;
+	t__2e739 = (u64)(u32)(*(i32 *)t_binding_2e699);
+	t__2e738 = (u64)(u32)(((u32)t__2e739 == (u32)((u64)0UL)));
+	t__2e733 = (u64)(u32)t__2e738;
+	goto L__2e735;
+	L__2e735:;
+	t__2e740 = (u64)(u32)((u8)t__2e733);
+	if ((u32)t__2e740) goto L_true_2e730; else goto L_false_2e731;
+	L_true_2e730:;
+	t_cleanup_2e679 = (u64)(u32)((u64)3UL);
+	goto L_defer_2e713;
+	L_resume_2e743:;
+	goto L_after_2e688;
+	L__2e744:;
+	L__2e741:;
+	L__2e745:;
+	L_false_2e731:;
+	L__2e732:;
+	t__2e751 = (u64)(u32)(*(i32 *)t_param_2e665);
+	t__2e750 = (u64)(u32)(((u32)t__2e751 == (u32)((u64)4UL)));
+	t__2e752 = (u64)(u32)((u8)t__2e750);
+	if ((u32)t__2e752) goto L_true_2e747; else goto L_false_2e748;
+	L_true_2e747:;
+	t_cleanup_2e679 = (u64)(u32)((u64)4UL);
+	goto L_defer_2e713;
+	L_resume_2e755:;
+	goto L__2e697;
+	L__2e756:;
+	L__2e753:;
+	L__2e757:;
+	L_false_2e748:;
+	L__2e749:;
+	t__2e763 = (u64)(u32)(*(i32 *)t_param_2e665);
+	t__2e762 = (u64)(u32)(((u32)t__2e763 == (u32)((u64)5UL)));
+	t__2e764 = (u64)(u32)((u8)t__2e762);
+	if ((u32)t__2e764) goto L_true_2e759; else goto L_false_2e760;
+	L_true_2e759:;
+	t_cleanup_2e679 = (u64)(u32)((u64)5UL);
+	goto L_defer_2e767;
+	L_resume_2e768:;
+	return (u32)((u64)5UL);
+	L__2e769:;
+	L__2e765:;
+	L__2e770:;
+	L_false_2e760:;
+	L__2e761:;
+	t__2e776 = (u64)(u32)(*(i32 *)t_param_2e665);
+	t__2e775 = (u64)(u32)(((u32)t__2e776 == (u32)((u64)3UL)));
+	t__2e777 = (u64)(u32)((u8)t__2e775);
+	if ((u32)t__2e777) goto L_true_2e772; else goto L_false_2e773;
+	L_true_2e772:;
+	t_abortsite_2e781 = ((u64)0UL);
+	goto L_abort_2e782;
+	L__2e789:;
+	L__2e778:;
+	L__2e790:;
+	L_false_2e773:;
+	L__2e774:;
+	t_cleanup_2e679 = (u64)(u32)((u64)7UL);
+	goto L_defer_2e767;
+	L_resume_2e791:;
+	goto L__2e702;
+	L__2e792:;
+	goto L__2e793;
+	L_defer_2e767:;
+	t__2e794 = (u64)(*(u64 *)t_param_2e666);
+	t__2e795 = (u64)((u64)t__2e794 + (u64)((u64)8UL));
+	t__2e796 = (u64)((u64)t__2e794 + (u64)((u64)16UL));
+	t__2e797 = (u64)(*(u64 *)t__2e795);
+	t__2e798 = (u64)((u64)t__2e797 + (u64)((u64)1UL));
+	*(u64 *)t__2e795 = (u64)t__2e798;
+	t__2e800 = (u64)(*(u64 *)t__2e796);
+	t__2e803 = (u64)(u32)(((u64)t__2e798 <= (u64)t__2e800));
+	if ((u32)t__2e803) goto L__2e801; else goto L__2e802;
+	L__2e802:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t__2e794, (u64)((u64)4UL));
+	goto L__2e801;
+	L__2e801:;
+	t__2e804 = (u64)(*(u64 *)t__2e794);
+	t__2e799 = (u64)((u64)t__2e797 * (u64)((u64)4UL));
+	t__2e799 = (u64)((u64)t__2e804 + (u64)t__2e799);
+	t__2e805 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e799 = (u32)((u64)5UL);
+	L_defer_2e713:;
+	t__2e806 = (u64)(*(u64 *)t_param_2e666);
+	t__2e807 = (u64)((u64)t__2e806 + (u64)((u64)8UL));
+	t__2e808 = (u64)((u64)t__2e806 + (u64)((u64)16UL));
+	t__2e809 = (u64)(*(u64 *)t__2e807);
+	t__2e810 = (u64)((u64)t__2e809 + (u64)((u64)1UL));
+	*(u64 *)t__2e807 = (u64)t__2e810;
+	t__2e812 = (u64)(*(u64 *)t__2e808);
+	t__2e815 = (u64)(u32)(((u64)t__2e810 <= (u64)t__2e812));
+	if ((u32)t__2e815) goto L__2e813; else goto L__2e814;
+	L__2e814:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t__2e806, (u64)((u64)4UL));
+	goto L__2e813;
+	L__2e813:;
+	t__2e816 = (u64)(*(u64 *)t__2e806);
+	t__2e811 = (u64)((u64)t__2e809 * (u64)((u64)4UL));
+	t__2e811 = (u64)((u64)t__2e816 + (u64)t__2e811);
+	t__2e817 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e811 = (u32)((u64)4UL);
+	t__2e819 = (u64)(u32)(((u32)t_cleanup_2e679 == (u32)((u64)7UL)));
+	if ((u32)t__2e819) goto L_resume_2e791; else goto L__2e818;
+	L__2e818:;
+	t__2e821 = (u64)(u32)(((u32)t_cleanup_2e679 == (u32)((u64)4UL)));
+	if ((u32)t__2e821) goto L_resume_2e755; else goto L__2e820;
+	L__2e820:;
+	goto L_defer_2e822;
+	L__2e793:;
+	L__2e702:;
+	L_after_2e698:;
+	t__2e823 = (u64)(u32)(*(i32 *)t_binding_2e699);
+	t__2e823 = (u64)(u32)((u32)t__2e823 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e699 = (u32)t__2e823;
+	goto L_loop_2e694;
+	L__2e697:;
+	t__2e829 = (u64)(u32)(*(i32 *)t_param_2e665);
+	t__2e828 = (u64)(u32)(((u32)t__2e829 == (u32)((u64)4UL)));
+	t__2e830 = (u64)(u32)((u8)t__2e828);
+	if ((u32)t__2e830) goto L_true_2e825; else goto L_false_2e826;
+	L_true_2e825:;
+	t_cleanup_2e679 = (u64)(u32)((u64)8UL);
+	goto L_defer_2e822;
+	L_resume_2e833:;
+	return (u32)((u64)4UL);
+	L__2e834:;
+	L__2e831:;
+	L__2e835:;
+	L_false_2e826:;
+	L__2e827:;
+	t_cleanup_2e679 = (u64)(u32)((u64)9UL);
+	goto L_defer_2e822;
+	L_resume_2e836:;
+	goto L__2e692;
+	L__2e837:;
+	goto L__2e838;
+	L_defer_2e822:;
+	t__2e839 = (u64)(*(u64 *)t_param_2e666);
+	t__2e840 = (u64)((u64)t__2e839 + (u64)((u64)8UL));
+	t__2e841 = (u64)((u64)t__2e839 + (u64)((u64)16UL));
+	t__2e842 = (u64)(*(u64 *)t__2e840);
+	t__2e843 = (u64)((u64)t__2e842 + (u64)((u64)1UL));
+	*(u64 *)t__2e840 = (u64)t__2e843;
+	t__2e845 = (u64)(*(u64 *)t__2e841);
+	t__2e848 = (u64)(u32)(((u64)t__2e843 <= (u64)t__2e845));
+	if ((u32)t__2e848) goto L__2e846; else goto L__2e847;
+	L__2e847:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t__2e839, (u64)((u64)4UL));
+	goto L__2e846;
+	L__2e846:;
+	t__2e849 = (u64)(*(u64 *)t__2e839);
+	t__2e844 = (u64)((u64)t__2e842 * (u64)((u64)4UL));
+	t__2e844 = (u64)((u64)t__2e849 + (u64)t__2e844);
+	t__2e850 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e844 = (u32)((u64)3UL);
+	t__2e852 = (u64)(u32)(((u32)t_cleanup_2e679 == (u32)((u64)9UL)));
+	if ((u32)t__2e852) goto L_resume_2e836; else goto L__2e851;
+	L__2e851:;
+	t__2e854 = (u64)(u32)(((u32)t_cleanup_2e679 == (u32)((u64)3UL)));
+	if ((u32)t__2e854) goto L_resume_2e743; else goto L__2e853;
+	L__2e853:;
+	t__2e856 = (u64)(u32)(((u32)t_cleanup_2e679 == (u32)((u64)2UL)));
+	if ((u32)t__2e856) goto L_resume_2e726; else goto L__2e855;
+	L__2e855:;
+	goto L_defer_2e857;
+	L__2e838:;
+	L__2e692:;
+	L_after_2e688:;
+	t__2e858 = (u64)(u32)(*(i32 *)t_binding_2e689);
+	t__2e858 = (u64)(u32)((u32)t__2e858 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e689 = (u32)t__2e858;
+	goto L_loop_2e684;
+	L__2e687:;
+	t_cleanup_2e679 = (u64)(u32)((u64)10UL);
+	goto L_defer_2e857;
+	L_resume_2e859:;
+	return (u32)((u64)3UL);
+	L__2e860:;
+	goto L__2e861;
+	L_defer_2e857:;
+	t__2e862 = (u64)(*(u64 *)t_param_2e666);
+	t__2e863 = (u64)((u64)t__2e862 + (u64)((u64)8UL));
+	t__2e864 = (u64)((u64)t__2e862 + (u64)((u64)16UL));
+	t__2e865 = (u64)(*(u64 *)t__2e863);
+	t__2e866 = (u64)((u64)t__2e865 + (u64)((u64)1UL));
+	*(u64 *)t__2e863 = (u64)t__2e866;
+	t__2e868 = (u64)(*(u64 *)t__2e864);
+	t__2e871 = (u64)(u32)(((u64)t__2e866 <= (u64)t__2e868));
+	if ((u32)t__2e871) goto L__2e869; else goto L__2e870;
+	L__2e870:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t__2e862, (u64)((u64)4UL));
+	goto L__2e869;
+	L__2e869:;
+	t__2e872 = (u64)(*(u64 *)t__2e862);
+	t__2e867 = (u64)((u64)t__2e865 * (u64)((u64)4UL));
+	t__2e867 = (u64)((u64)t__2e872 + (u64)t__2e867);
+	t__2e873 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e867 = (u32)((u64)2UL);
+	L_defer_2e680:;
+	t__2e874 = (u64)(*(u64 *)t_param_2e666);
+	t__2e875 = (u64)((u64)t__2e874 + (u64)((u64)8UL));
+	t__2e876 = (u64)((u64)t__2e874 + (u64)((u64)16UL));
+	t__2e877 = (u64)(*(u64 *)t__2e875);
+	t__2e878 = (u64)((u64)t__2e877 + (u64)((u64)1UL));
+	*(u64 *)t__2e875 = (u64)t__2e878;
+	t__2e880 = (u64)(*(u64 *)t__2e876);
+	t__2e883 = (u64)(u32)(((u64)t__2e878 <= (u64)t__2e880));
+	if ((u32)t__2e883) goto L__2e881; else goto L__2e882;
+	L__2e882:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t__2e874, (u64)((u64)4UL));
+	goto L__2e881;
+	L__2e881:;
+	t__2e884 = (u64)(*(u64 *)t__2e874);
+	t__2e879 = (u64)((u64)t__2e877 * (u64)((u64)4UL));
+	t__2e879 = (u64)((u64)t__2e884 + (u64)t__2e879);
+	t__2e885 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e879 = (u32)((u64)1UL);
+	t__2e887 = (u64)(u32)(((u32)t_cleanup_2e679 == (u32)((u64)10UL)));
+	if ((u32)t__2e887) goto L_resume_2e859; else goto L__2e886;
+	L__2e886:;
+	t__2e889 = (u64)(u32)(((u32)t_cleanup_2e679 == (u32)((u64)8UL)));
+	if ((u32)t__2e889) goto L_resume_2e833; else goto L__2e888;
+	L__2e888:;
+	t__2e891 = (u64)(u32)(((u32)t_cleanup_2e679 == (u32)((u64)6UL)));
+	if ((u32)t__2e891) goto L_resume_2e788; else goto L__2e890;
+	L__2e890:;
+	t__2e893 = (u64)(u32)(((u32)t_cleanup_2e679 == (u32)((u64)5UL)));
+	if ((u32)t__2e893) goto L_resume_2e768; else goto L__2e892;
+	L__2e892:;
+	t__2e895 = (u64)(u32)(((u32)t_cleanup_2e679 == (u32)((u64)1UL)));
+	if ((u32)t__2e895) goto L_resume_2e714; else goto L__2e894;
+	L__2e894:;
+	goto L_resume_2e681;
+	L__2e861:;
+	L__2e668:;
+	L__2e896:;
+	return 0;
+	L_abort_2e782:;
+	t__2e783 = (u64)((u64)t_abortsite_2e781 * (u64)((u64)16UL));
+	t__2e783 = (u64)((u64)((u64)((char *)&D_abortsites_2e780)) + (u64)t__2e783);
+	t__2e784 = (u64)(*(u64 *)t__2e783);
+	t__2e785 = (u64)((u64)t__2e783 + (u64)((u64)8UL));
+	t__2e786 = (u64)(*(u32 *)t__2e785);
+	t__2e785 = (u64)((u64)t__2e783 + (u64)((u64)12UL));
+	t__2e787 = (u64)(*(u32 *)t__2e785);
+	t_cleanup_2e679 = (u64)(u32)((u64)6UL);
+	goto L_defer_2e767;
+	L_resume_2e788:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e784, (u64)t__2e786, (u64)t__2e787, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_spam(void) {
+	char R0[4] __attribute__((aligned(16)));
+	char R1[4] __attribute__((aligned(16)));
+	char R2[4] __attribute__((aligned(16)));
+	char R3[4] __attribute__((aligned(16)));
+	char R4[4] __attribute__((aligned(16)));
+	char R5[4] __attribute__((aligned(16)));
+	char R6[4] __attribute__((aligned(16)));
+	char R7[4] __attribute__((aligned(16)));
+	char R8[4] __attribute__((aligned(16)));
+	char R9[4] __attribute__((aligned(16)));
+	char R10[4] __attribute__((aligned(16)));
+	char R11[4] __attribute__((aligned(16)));
+	char R12[4] __attribute__((aligned(16)));
+	char R13[4] __attribute__((aligned(16)));
+	char R14[4] __attribute__((aligned(16)));
+	char R15[4] __attribute__((aligned(16)));
+	char R16[4] __attribute__((aligned(16)));
+	char R17[4] __attribute__((aligned(16)));
+	char R18[4] __attribute__((aligned(16)));
+	char R19[4] __attribute__((aligned(16)));
+	char R20[4] __attribute__((aligned(16)));
+	char R21[4] __attribute__((aligned(16)));
+	char R22[4] __attribute__((aligned(16)));
+	char R23[4] __attribute__((aligned(16)));
+	char R24[4] __attribute__((aligned(16)));
+	char R25[4] __attribute__((aligned(16)));
+	char R26[4] __attribute__((aligned(16)));
+	char R27[4] __attribute__((aligned(16)));
+	char R28[4] __attribute__((aligned(16)));
+	char R29[4] __attribute__((aligned(16)));
+	char R30[4] __attribute__((aligned(16)));
+	char R31[4] __attribute__((aligned(16)));
+	char R32[4] __attribute__((aligned(16)));
+	char R33[4] __attribute__((aligned(16)));
+	char R34[4] __attribute__((aligned(16)));
+	char R35[4] __attribute__((aligned(16)));
+	char R36[4] __attribute__((aligned(16)));
+	char R37[4] __attribute__((aligned(16)));
+	char R38[4] __attribute__((aligned(16)));
+	char R39[4] __attribute__((aligned(16)));
+	char R40[4] __attribute__((aligned(16)));
+	char R41[4] __attribute__((aligned(16)));
+	char R42[4] __attribute__((aligned(16)));
+	char R43[4] __attribute__((aligned(16)));
+	char R44[4] __attribute__((aligned(16)));
+	char R45[4] __attribute__((aligned(16)));
+	char R46[4] __attribute__((aligned(16)));
+	char R47[4] __attribute__((aligned(16)));
+	char R48[4] __attribute__((aligned(16)));
+	char R49[4] __attribute__((aligned(16)));
+	u64 t__2e1000;
+	u64 t__2e1002;
+	u64 t__2e1005;
+	u64 t__2e1014;
+	u64 t__2e1016;
+	u64 t__2e1019;
+	u64 t__2e1028;
+	u64 t__2e1030;
+	u64 t__2e1033;
+	u64 t__2e1042;
+	u64 t__2e1044;
+	u64 t__2e1047;
+	u64 t__2e1056;
+	u64 t__2e1058;
+	u64 t__2e1061;
+	u64 t__2e1070;
+	u64 t__2e1072;
+	u64 t__2e1075;
+	u64 t__2e1084;
+	u64 t__2e1086;
+	u64 t__2e1089;
+	u64 t__2e1098;
+	u64 t__2e1100;
+	u64 t__2e1103;
+	u64 t__2e1112;
+	u64 t__2e1114;
+	u64 t__2e1117;
+	u64 t__2e1126;
+	u64 t__2e1128;
+	u64 t__2e1131;
+	u64 t__2e1140;
+	u64 t__2e1142;
+	u64 t__2e1145;
+	u64 t__2e1154;
+	u64 t__2e1156;
+	u64 t__2e1159;
+	u64 t__2e1168;
+	u64 t__2e1170;
+	u64 t__2e1173;
+	u64 t__2e1182;
+	u64 t__2e1184;
+	u64 t__2e1187;
+	u64 t__2e1196;
+	u64 t__2e1198;
+	u64 t__2e1201;
+	u64 t__2e1210;
+	u64 t__2e1212;
+	u64 t__2e1215;
+	u64 t__2e1224;
+	u64 t__2e1226;
+	u64 t__2e1229;
+	u64 t__2e1238;
+	u64 t__2e1240;
+	u64 t__2e1243;
+	u64 t__2e1252;
+	u64 t__2e1254;
+	u64 t__2e1257;
+	u64 t__2e1266;
+	u64 t__2e1268;
+	u64 t__2e1271;
+	u64 t__2e1280;
+	u64 t__2e1282;
+	u64 t__2e1285;
+	u64 t__2e1294;
+	u64 t__2e1296;
+	u64 t__2e1299;
+	u64 t__2e1308;
+	u64 t__2e1310;
+	u64 t__2e1313;
+	u64 t__2e1322;
+	u64 t__2e1324;
+	u64 t__2e1327;
+	u64 t__2e1336;
+	u64 t__2e1338;
+	u64 t__2e1341;
+	u64 t__2e1350;
+	u64 t__2e1352;
+	u64 t__2e1355;
+	u64 t__2e1364;
+	u64 t__2e1366;
+	u64 t__2e1369;
+	u64 t__2e1378;
+	u64 t__2e1380;
+	u64 t__2e1383;
+	u64 t__2e1392;
+	u64 t__2e1394;
+	u64 t__2e1397;
+	u64 t__2e1406;
+	u64 t__2e1408;
+	u64 t__2e1411;
+	u64 t__2e1420;
+	u64 t__2e1422;
+	u64 t__2e1425;
+	u64 t__2e1434;
+	u64 t__2e1436;
+	u64 t__2e1439;
+	u64 t__2e1448;
+	u64 t__2e1450;
+	u64 t__2e1453;
+	u64 t__2e1462;
+	u64 t__2e1464;
+	u64 t__2e1467;
+	u64 t__2e1476;
+	u64 t__2e1478;
+	u64 t__2e1481;
+	u64 t__2e1490;
+	u64 t__2e1492;
+	u64 t__2e1495;
+	u64 t__2e1504;
+	u64 t__2e1506;
+	u64 t__2e1509;
+	u64 t__2e1518;
+	u64 t__2e1520;
+	u64 t__2e1523;
+	u64 t__2e1532;
+	u64 t__2e1534;
+	u64 t__2e1537;
+	u64 t__2e1546;
+	u64 t__2e1548;
+	u64 t__2e1551;
+	u64 t__2e1560;
+	u64 t__2e1562;
+	u64 t__2e1565;
+	u64 t__2e1574;
+	u64 t__2e1576;
+	u64 t__2e1579;
+	u64 t__2e1588;
+	u64 t__2e1590;
+	u64 t__2e1593;
+	u64 t__2e1602;
+	u64 t__2e1604;
+	u64 t__2e1607;
+	u64 t__2e1616;
+	u64 t__2e1618;
+	u64 t__2e907;
+	u64 t__2e916;
+	u64 t__2e918;
+	u64 t__2e922;
+	u64 t__2e923;
+	u64 t__2e924;
+	u64 t__2e925;
+	u64 t__2e926;
+	u64 t__2e929;
+	u64 t__2e930;
+	u64 t__2e931;
+	u64 t__2e932;
+	u64 t__2e933;
+	u64 t__2e935;
+	u64 t__2e944;
+	u64 t__2e946;
+	u64 t__2e949;
+	u64 t__2e958;
+	u64 t__2e960;
+	u64 t__2e963;
+	u64 t__2e972;
+	u64 t__2e974;
+	u64 t__2e977;
+	u64 t__2e986;
+	u64 t__2e988;
+	u64 t__2e991;
+	u64 t_abortsite_2e920;
+	u64 t_cleanup_2e901;
+	u64 t_tag_2e1006;
+	u64 t_tag_2e1020;
+	u64 t_tag_2e1034;
+	u64 t_tag_2e1048;
+	u64 t_tag_2e1062;
+	u64 t_tag_2e1076;
+	u64 t_tag_2e1090;
+	u64 t_tag_2e1104;
+	u64 t_tag_2e1118;
+	u64 t_tag_2e1132;
+	u64 t_tag_2e1146;
+	u64 t_tag_2e1160;
+	u64 t_tag_2e1174;
+	u64 t_tag_2e1188;
+	u64 t_tag_2e1202;
+	u64 t_tag_2e1216;
+	u64 t_tag_2e1230;
+	u64 t_tag_2e1244;
+	u64 t_tag_2e1258;
+	u64 t_tag_2e1272;
+	u64 t_tag_2e1286;
+	u64 t_tag_2e1300;
+	u64 t_tag_2e1314;
+	u64 t_tag_2e1328;
+	u64 t_tag_2e1342;
+	u64 t_tag_2e1356;
+	u64 t_tag_2e1370;
+	u64 t_tag_2e1384;
+	u64 t_tag_2e1398;
+	u64 t_tag_2e1412;
+	u64 t_tag_2e1426;
+	u64 t_tag_2e1440;
+	u64 t_tag_2e1454;
+	u64 t_tag_2e1468;
+	u64 t_tag_2e1482;
+	u64 t_tag_2e1496;
+	u64 t_tag_2e1510;
+	u64 t_tag_2e1524;
+	u64 t_tag_2e1538;
+	u64 t_tag_2e1552;
+	u64 t_tag_2e1566;
+	u64 t_tag_2e1580;
+	u64 t_tag_2e1594;
+	u64 t_tag_2e1608;
+	u64 t_tag_2e908;
+	u64 t_tag_2e936;
+	u64 t_tag_2e950;
+	u64 t_tag_2e964;
+	u64 t_tag_2e978;
+	u64 t_tag_2e992;
+	L_start_2e897:;
+	L_body_2e898:;
+	t_cleanup_2e901 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e902;
+	L_resume_2e903:;
+	goto L__2e899;
+	L__2e904:;
+	goto L__2e905;
+	L_defer_2e902:;
+	t__2e907 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R0);
+	t_tag_2e908 = (u64)(*(u32 *)t__2e907);
+	t__2e916 = (u64)(u32)(((u32)t_tag_2e908 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e916) goto L_member_2e913; else goto L__2e915;
+	L__2e915:;
+	t__2e918 = (u64)(u32)(((u32)t_tag_2e908 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e918) goto L_member_2e914; else goto L__2e917;
+	L__2e917:;
+	goto L_matches_2e912;
+	L_member_2e913:;
+	goto L_matches_2e911;
+	L_member_2e914:;
+	goto L_matches_2e912;
+	L_matches_2e911:;
+	goto L__2e909;
+	L_matches_2e912:;
+	t_abortsite_2e920 = ((u64)0UL);
+	goto L_abort_2e921;
+	L__2e927:;
+	L__2e910:;
+	t_abortsite_2e920 = ((u64)1UL);
+	goto L_abort_2e928;
+	L__2e909:;
+	t__2e935 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R1);
+	t_tag_2e936 = (u64)(*(u32 *)t__2e935);
+	t__2e944 = (u64)(u32)(((u32)t_tag_2e936 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e944) goto L_member_2e941; else goto L__2e943;
+	L__2e943:;
+	t__2e946 = (u64)(u32)(((u32)t_tag_2e936 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e946) goto L_member_2e942; else goto L__2e945;
+	L__2e945:;
+	goto L_matches_2e940;
+	L_member_2e941:;
+	goto L_matches_2e939;
+	L_member_2e942:;
+	goto L_matches_2e940;
+	L_matches_2e939:;
+	goto L__2e937;
+	L_matches_2e940:;
+	t_abortsite_2e920 = ((u64)2UL);
+	goto L_abort_2e921;
+	L__2e947:;
+	L__2e938:;
+	t_abortsite_2e920 = ((u64)3UL);
+	goto L_abort_2e928;
+	L__2e937:;
+	t__2e949 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R2);
+	t_tag_2e950 = (u64)(*(u32 *)t__2e949);
+	t__2e958 = (u64)(u32)(((u32)t_tag_2e950 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e958) goto L_member_2e955; else goto L__2e957;
+	L__2e957:;
+	t__2e960 = (u64)(u32)(((u32)t_tag_2e950 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e960) goto L_member_2e956; else goto L__2e959;
+	L__2e959:;
+	goto L_matches_2e954;
+	L_member_2e955:;
+	goto L_matches_2e953;
+	L_member_2e956:;
+	goto L_matches_2e954;
+	L_matches_2e953:;
+	goto L__2e951;
+	L_matches_2e954:;
+	t_abortsite_2e920 = ((u64)4UL);
+	goto L_abort_2e921;
+	L__2e961:;
+	L__2e952:;
+	t_abortsite_2e920 = ((u64)5UL);
+	goto L_abort_2e928;
+	L__2e951:;
+	t__2e963 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R3);
+	t_tag_2e964 = (u64)(*(u32 *)t__2e963);
+	t__2e972 = (u64)(u32)(((u32)t_tag_2e964 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e972) goto L_member_2e969; else goto L__2e971;
+	L__2e971:;
+	t__2e974 = (u64)(u32)(((u32)t_tag_2e964 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e974) goto L_member_2e970; else goto L__2e973;
+	L__2e973:;
+	goto L_matches_2e968;
+	L_member_2e969:;
+	goto L_matches_2e967;
+	L_member_2e970:;
+	goto L_matches_2e968;
+	L_matches_2e967:;
+	goto L__2e965;
+	L_matches_2e968:;
+	t_abortsite_2e920 = ((u64)6UL);
+	goto L_abort_2e921;
+	L__2e975:;
+	L__2e966:;
+	t_abortsite_2e920 = ((u64)7UL);
+	goto L_abort_2e928;
+	L__2e965:;
+	t__2e977 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R4);
+	t_tag_2e978 = (u64)(*(u32 *)t__2e977);
+	t__2e986 = (u64)(u32)(((u32)t_tag_2e978 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e986) goto L_member_2e983; else goto L__2e985;
+	L__2e985:;
+	t__2e988 = (u64)(u32)(((u32)t_tag_2e978 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e988) goto L_member_2e984; else goto L__2e987;
+	L__2e987:;
+	goto L_matches_2e982;
+	L_member_2e983:;
+	goto L_matches_2e981;
+	L_member_2e984:;
+	goto L_matches_2e982;
+	L_matches_2e981:;
+	goto L__2e979;
+	L_matches_2e982:;
+	t_abortsite_2e920 = ((u64)8UL);
+	goto L_abort_2e921;
+	L__2e989:;
+	L__2e980:;
+	t_abortsite_2e920 = ((u64)9UL);
+	goto L_abort_2e928;
+	L__2e979:;
+	t__2e991 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R5);
+	t_tag_2e992 = (u64)(*(u32 *)t__2e991);
+	t__2e1000 = (u64)(u32)(((u32)t_tag_2e992 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1000) goto L_member_2e997; else goto L__2e999;
+	L__2e999:;
+	t__2e1002 = (u64)(u32)(((u32)t_tag_2e992 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1002) goto L_member_2e998; else goto L__2e1001;
+	L__2e1001:;
+	goto L_matches_2e996;
+	L_member_2e997:;
+	goto L_matches_2e995;
+	L_member_2e998:;
+	goto L_matches_2e996;
+	L_matches_2e995:;
+	goto L__2e993;
+	L_matches_2e996:;
+	t_abortsite_2e920 = ((u64)10UL);
+	goto L_abort_2e921;
+	L__2e1003:;
+	L__2e994:;
+	t_abortsite_2e920 = ((u64)11UL);
+	goto L_abort_2e928;
+	L__2e993:;
+	t__2e1005 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R6);
+	t_tag_2e1006 = (u64)(*(u32 *)t__2e1005);
+	t__2e1014 = (u64)(u32)(((u32)t_tag_2e1006 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1014) goto L_member_2e1011; else goto L__2e1013;
+	L__2e1013:;
+	t__2e1016 = (u64)(u32)(((u32)t_tag_2e1006 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1016) goto L_member_2e1012; else goto L__2e1015;
+	L__2e1015:;
+	goto L_matches_2e1010;
+	L_member_2e1011:;
+	goto L_matches_2e1009;
+	L_member_2e1012:;
+	goto L_matches_2e1010;
+	L_matches_2e1009:;
+	goto L__2e1007;
+	L_matches_2e1010:;
+	t_abortsite_2e920 = ((u64)12UL);
+	goto L_abort_2e921;
+	L__2e1017:;
+	L__2e1008:;
+	t_abortsite_2e920 = ((u64)13UL);
+	goto L_abort_2e928;
+	L__2e1007:;
+	t__2e1019 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R7);
+	t_tag_2e1020 = (u64)(*(u32 *)t__2e1019);
+	t__2e1028 = (u64)(u32)(((u32)t_tag_2e1020 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1028) goto L_member_2e1025; else goto L__2e1027;
+	L__2e1027:;
+	t__2e1030 = (u64)(u32)(((u32)t_tag_2e1020 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1030) goto L_member_2e1026; else goto L__2e1029;
+	L__2e1029:;
+	goto L_matches_2e1024;
+	L_member_2e1025:;
+	goto L_matches_2e1023;
+	L_member_2e1026:;
+	goto L_matches_2e1024;
+	L_matches_2e1023:;
+	goto L__2e1021;
+	L_matches_2e1024:;
+	t_abortsite_2e920 = ((u64)14UL);
+	goto L_abort_2e921;
+	L__2e1031:;
+	L__2e1022:;
+	t_abortsite_2e920 = ((u64)15UL);
+	goto L_abort_2e928;
+	L__2e1021:;
+	t__2e1033 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R8);
+	t_tag_2e1034 = (u64)(*(u32 *)t__2e1033);
+	t__2e1042 = (u64)(u32)(((u32)t_tag_2e1034 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1042) goto L_member_2e1039; else goto L__2e1041;
+	L__2e1041:;
+	t__2e1044 = (u64)(u32)(((u32)t_tag_2e1034 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1044) goto L_member_2e1040; else goto L__2e1043;
+	L__2e1043:;
+	goto L_matches_2e1038;
+	L_member_2e1039:;
+	goto L_matches_2e1037;
+	L_member_2e1040:;
+	goto L_matches_2e1038;
+	L_matches_2e1037:;
+	goto L__2e1035;
+	L_matches_2e1038:;
+	t_abortsite_2e920 = ((u64)16UL);
+	goto L_abort_2e921;
+	L__2e1045:;
+	L__2e1036:;
+	t_abortsite_2e920 = ((u64)17UL);
+	goto L_abort_2e928;
+	L__2e1035:;
+	t__2e1047 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R9);
+	t_tag_2e1048 = (u64)(*(u32 *)t__2e1047);
+	t__2e1056 = (u64)(u32)(((u32)t_tag_2e1048 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1056) goto L_member_2e1053; else goto L__2e1055;
+	L__2e1055:;
+	t__2e1058 = (u64)(u32)(((u32)t_tag_2e1048 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1058) goto L_member_2e1054; else goto L__2e1057;
+	L__2e1057:;
+	goto L_matches_2e1052;
+	L_member_2e1053:;
+	goto L_matches_2e1051;
+	L_member_2e1054:;
+	goto L_matches_2e1052;
+	L_matches_2e1051:;
+	goto L__2e1049;
+	L_matches_2e1052:;
+	t_abortsite_2e920 = ((u64)18UL);
+	goto L_abort_2e921;
+	L__2e1059:;
+	L__2e1050:;
+	t_abortsite_2e920 = ((u64)19UL);
+	goto L_abort_2e928;
+	L__2e1049:;
+	t__2e1061 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R10);
+	t_tag_2e1062 = (u64)(*(u32 *)t__2e1061);
+	t__2e1070 = (u64)(u32)(((u32)t_tag_2e1062 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1070) goto L_member_2e1067; else goto L__2e1069;
+	L__2e1069:;
+	t__2e1072 = (u64)(u32)(((u32)t_tag_2e1062 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1072) goto L_member_2e1068; else goto L__2e1071;
+	L__2e1071:;
+	goto L_matches_2e1066;
+	L_member_2e1067:;
+	goto L_matches_2e1065;
+	L_member_2e1068:;
+	goto L_matches_2e1066;
+	L_matches_2e1065:;
+	goto L__2e1063;
+	L_matches_2e1066:;
+	t_abortsite_2e920 = ((u64)20UL);
+	goto L_abort_2e921;
+	L__2e1073:;
+	L__2e1064:;
+	t_abortsite_2e920 = ((u64)21UL);
+	goto L_abort_2e928;
+	L__2e1063:;
+	t__2e1075 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R11);
+	t_tag_2e1076 = (u64)(*(u32 *)t__2e1075);
+	t__2e1084 = (u64)(u32)(((u32)t_tag_2e1076 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1084) goto L_member_2e1081; else goto L__2e1083;
+	L__2e1083:;
+	t__2e1086 = (u64)(u32)(((u32)t_tag_2e1076 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1086) goto L_member_2e1082; else goto L__2e1085;
+	L__2e1085:;
+	goto L_matches_2e1080;
+	L_member_2e1081:;
+	goto L_matches_2e1079;
+	L_member_2e1082:;
+	goto L_matches_2e1080;
+	L_matches_2e1079:;
+	goto L__2e1077;
+	L_matches_2e1080:;
+	t_abortsite_2e920 = ((u64)22UL);
+	goto L_abort_2e921;
+	L__2e1087:;
+	L__2e1078:;
+	t_abortsite_2e920 = ((u64)23UL);
+	goto L_abort_2e928;
+	L__2e1077:;
+	t__2e1089 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R12);
+	t_tag_2e1090 = (u64)(*(u32 *)t__2e1089);
+	t__2e1098 = (u64)(u32)(((u32)t_tag_2e1090 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1098) goto L_member_2e1095; else goto L__2e1097;
+	L__2e1097:;
+	t__2e1100 = (u64)(u32)(((u32)t_tag_2e1090 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1100) goto L_member_2e1096; else goto L__2e1099;
+	L__2e1099:;
+	goto L_matches_2e1094;
+	L_member_2e1095:;
+	goto L_matches_2e1093;
+	L_member_2e1096:;
+	goto L_matches_2e1094;
+	L_matches_2e1093:;
+	goto L__2e1091;
+	L_matches_2e1094:;
+	t_abortsite_2e920 = ((u64)24UL);
+	goto L_abort_2e921;
+	L__2e1101:;
+	L__2e1092:;
+	t_abortsite_2e920 = ((u64)25UL);
+	goto L_abort_2e928;
+	L__2e1091:;
+	t__2e1103 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R13);
+	t_tag_2e1104 = (u64)(*(u32 *)t__2e1103);
+	t__2e1112 = (u64)(u32)(((u32)t_tag_2e1104 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1112) goto L_member_2e1109; else goto L__2e1111;
+	L__2e1111:;
+	t__2e1114 = (u64)(u32)(((u32)t_tag_2e1104 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1114) goto L_member_2e1110; else goto L__2e1113;
+	L__2e1113:;
+	goto L_matches_2e1108;
+	L_member_2e1109:;
+	goto L_matches_2e1107;
+	L_member_2e1110:;
+	goto L_matches_2e1108;
+	L_matches_2e1107:;
+	goto L__2e1105;
+	L_matches_2e1108:;
+	t_abortsite_2e920 = ((u64)26UL);
+	goto L_abort_2e921;
+	L__2e1115:;
+	L__2e1106:;
+	t_abortsite_2e920 = ((u64)27UL);
+	goto L_abort_2e928;
+	L__2e1105:;
+	t__2e1117 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R14);
+	t_tag_2e1118 = (u64)(*(u32 *)t__2e1117);
+	t__2e1126 = (u64)(u32)(((u32)t_tag_2e1118 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1126) goto L_member_2e1123; else goto L__2e1125;
+	L__2e1125:;
+	t__2e1128 = (u64)(u32)(((u32)t_tag_2e1118 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1128) goto L_member_2e1124; else goto L__2e1127;
+	L__2e1127:;
+	goto L_matches_2e1122;
+	L_member_2e1123:;
+	goto L_matches_2e1121;
+	L_member_2e1124:;
+	goto L_matches_2e1122;
+	L_matches_2e1121:;
+	goto L__2e1119;
+	L_matches_2e1122:;
+	t_abortsite_2e920 = ((u64)28UL);
+	goto L_abort_2e921;
+	L__2e1129:;
+	L__2e1120:;
+	t_abortsite_2e920 = ((u64)29UL);
+	goto L_abort_2e928;
+	L__2e1119:;
+	t__2e1131 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R15);
+	t_tag_2e1132 = (u64)(*(u32 *)t__2e1131);
+	t__2e1140 = (u64)(u32)(((u32)t_tag_2e1132 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1140) goto L_member_2e1137; else goto L__2e1139;
+	L__2e1139:;
+	t__2e1142 = (u64)(u32)(((u32)t_tag_2e1132 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1142) goto L_member_2e1138; else goto L__2e1141;
+	L__2e1141:;
+	goto L_matches_2e1136;
+	L_member_2e1137:;
+	goto L_matches_2e1135;
+	L_member_2e1138:;
+	goto L_matches_2e1136;
+	L_matches_2e1135:;
+	goto L__2e1133;
+	L_matches_2e1136:;
+	t_abortsite_2e920 = ((u64)30UL);
+	goto L_abort_2e921;
+	L__2e1143:;
+	L__2e1134:;
+	t_abortsite_2e920 = ((u64)31UL);
+	goto L_abort_2e928;
+	L__2e1133:;
+	t__2e1145 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R16);
+	t_tag_2e1146 = (u64)(*(u32 *)t__2e1145);
+	t__2e1154 = (u64)(u32)(((u32)t_tag_2e1146 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1154) goto L_member_2e1151; else goto L__2e1153;
+	L__2e1153:;
+	t__2e1156 = (u64)(u32)(((u32)t_tag_2e1146 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1156) goto L_member_2e1152; else goto L__2e1155;
+	L__2e1155:;
+	goto L_matches_2e1150;
+	L_member_2e1151:;
+	goto L_matches_2e1149;
+	L_member_2e1152:;
+	goto L_matches_2e1150;
+	L_matches_2e1149:;
+	goto L__2e1147;
+	L_matches_2e1150:;
+	t_abortsite_2e920 = ((u64)32UL);
+	goto L_abort_2e921;
+	L__2e1157:;
+	L__2e1148:;
+	t_abortsite_2e920 = ((u64)33UL);
+	goto L_abort_2e928;
+	L__2e1147:;
+	t__2e1159 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R17);
+	t_tag_2e1160 = (u64)(*(u32 *)t__2e1159);
+	t__2e1168 = (u64)(u32)(((u32)t_tag_2e1160 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1168) goto L_member_2e1165; else goto L__2e1167;
+	L__2e1167:;
+	t__2e1170 = (u64)(u32)(((u32)t_tag_2e1160 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1170) goto L_member_2e1166; else goto L__2e1169;
+	L__2e1169:;
+	goto L_matches_2e1164;
+	L_member_2e1165:;
+	goto L_matches_2e1163;
+	L_member_2e1166:;
+	goto L_matches_2e1164;
+	L_matches_2e1163:;
+	goto L__2e1161;
+	L_matches_2e1164:;
+	t_abortsite_2e920 = ((u64)34UL);
+	goto L_abort_2e921;
+	L__2e1171:;
+	L__2e1162:;
+	t_abortsite_2e920 = ((u64)35UL);
+	goto L_abort_2e928;
+	L__2e1161:;
+	t__2e1173 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R18);
+	t_tag_2e1174 = (u64)(*(u32 *)t__2e1173);
+	t__2e1182 = (u64)(u32)(((u32)t_tag_2e1174 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1182) goto L_member_2e1179; else goto L__2e1181;
+	L__2e1181:;
+	t__2e1184 = (u64)(u32)(((u32)t_tag_2e1174 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1184) goto L_member_2e1180; else goto L__2e1183;
+	L__2e1183:;
+	goto L_matches_2e1178;
+	L_member_2e1179:;
+	goto L_matches_2e1177;
+	L_member_2e1180:;
+	goto L_matches_2e1178;
+	L_matches_2e1177:;
+	goto L__2e1175;
+	L_matches_2e1178:;
+	t_abortsite_2e920 = ((u64)36UL);
+	goto L_abort_2e921;
+	L__2e1185:;
+	L__2e1176:;
+	t_abortsite_2e920 = ((u64)37UL);
+	goto L_abort_2e928;
+	L__2e1175:;
+	t__2e1187 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R19);
+	t_tag_2e1188 = (u64)(*(u32 *)t__2e1187);
+	t__2e1196 = (u64)(u32)(((u32)t_tag_2e1188 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1196) goto L_member_2e1193; else goto L__2e1195;
+	L__2e1195:;
+	t__2e1198 = (u64)(u32)(((u32)t_tag_2e1188 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1198) goto L_member_2e1194; else goto L__2e1197;
+	L__2e1197:;
+	goto L_matches_2e1192;
+	L_member_2e1193:;
+	goto L_matches_2e1191;
+	L_member_2e1194:;
+	goto L_matches_2e1192;
+	L_matches_2e1191:;
+	goto L__2e1189;
+	L_matches_2e1192:;
+	t_abortsite_2e920 = ((u64)38UL);
+	goto L_abort_2e921;
+	L__2e1199:;
+	L__2e1190:;
+	t_abortsite_2e920 = ((u64)39UL);
+	goto L_abort_2e928;
+	L__2e1189:;
+	t__2e1201 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R20);
+	t_tag_2e1202 = (u64)(*(u32 *)t__2e1201);
+	t__2e1210 = (u64)(u32)(((u32)t_tag_2e1202 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1210) goto L_member_2e1207; else goto L__2e1209;
+	L__2e1209:;
+	t__2e1212 = (u64)(u32)(((u32)t_tag_2e1202 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1212) goto L_member_2e1208; else goto L__2e1211;
+	L__2e1211:;
+	goto L_matches_2e1206;
+	L_member_2e1207:;
+	goto L_matches_2e1205;
+	L_member_2e1208:;
+	goto L_matches_2e1206;
+	L_matches_2e1205:;
+	goto L__2e1203;
+	L_matches_2e1206:;
+	t_abortsite_2e920 = ((u64)40UL);
+	goto L_abort_2e921;
+	L__2e1213:;
+	L__2e1204:;
+	t_abortsite_2e920 = ((u64)41UL);
+	goto L_abort_2e928;
+	L__2e1203:;
+	t__2e1215 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R21);
+	t_tag_2e1216 = (u64)(*(u32 *)t__2e1215);
+	t__2e1224 = (u64)(u32)(((u32)t_tag_2e1216 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1224) goto L_member_2e1221; else goto L__2e1223;
+	L__2e1223:;
+	t__2e1226 = (u64)(u32)(((u32)t_tag_2e1216 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1226) goto L_member_2e1222; else goto L__2e1225;
+	L__2e1225:;
+	goto L_matches_2e1220;
+	L_member_2e1221:;
+	goto L_matches_2e1219;
+	L_member_2e1222:;
+	goto L_matches_2e1220;
+	L_matches_2e1219:;
+	goto L__2e1217;
+	L_matches_2e1220:;
+	t_abortsite_2e920 = ((u64)42UL);
+	goto L_abort_2e921;
+	L__2e1227:;
+	L__2e1218:;
+	t_abortsite_2e920 = ((u64)43UL);
+	goto L_abort_2e928;
+	L__2e1217:;
+	t__2e1229 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R22);
+	t_tag_2e1230 = (u64)(*(u32 *)t__2e1229);
+	t__2e1238 = (u64)(u32)(((u32)t_tag_2e1230 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1238) goto L_member_2e1235; else goto L__2e1237;
+	L__2e1237:;
+	t__2e1240 = (u64)(u32)(((u32)t_tag_2e1230 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1240) goto L_member_2e1236; else goto L__2e1239;
+	L__2e1239:;
+	goto L_matches_2e1234;
+	L_member_2e1235:;
+	goto L_matches_2e1233;
+	L_member_2e1236:;
+	goto L_matches_2e1234;
+	L_matches_2e1233:;
+	goto L__2e1231;
+	L_matches_2e1234:;
+	t_abortsite_2e920 = ((u64)44UL);
+	goto L_abort_2e921;
+	L__2e1241:;
+	L__2e1232:;
+	t_abortsite_2e920 = ((u64)45UL);
+	goto L_abort_2e928;
+	L__2e1231:;
+	t__2e1243 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R23);
+	t_tag_2e1244 = (u64)(*(u32 *)t__2e1243);
+	t__2e1252 = (u64)(u32)(((u32)t_tag_2e1244 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1252) goto L_member_2e1249; else goto L__2e1251;
+	L__2e1251:;
+	t__2e1254 = (u64)(u32)(((u32)t_tag_2e1244 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1254) goto L_member_2e1250; else goto L__2e1253;
+	L__2e1253:;
+	goto L_matches_2e1248;
+	L_member_2e1249:;
+	goto L_matches_2e1247;
+	L_member_2e1250:;
+	goto L_matches_2e1248;
+	L_matches_2e1247:;
+	goto L__2e1245;
+	L_matches_2e1248:;
+	t_abortsite_2e920 = ((u64)46UL);
+	goto L_abort_2e921;
+	L__2e1255:;
+	L__2e1246:;
+	t_abortsite_2e920 = ((u64)47UL);
+	goto L_abort_2e928;
+	L__2e1245:;
+	t__2e1257 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R24);
+	t_tag_2e1258 = (u64)(*(u32 *)t__2e1257);
+	t__2e1266 = (u64)(u32)(((u32)t_tag_2e1258 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1266) goto L_member_2e1263; else goto L__2e1265;
+	L__2e1265:;
+	t__2e1268 = (u64)(u32)(((u32)t_tag_2e1258 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1268) goto L_member_2e1264; else goto L__2e1267;
+	L__2e1267:;
+	goto L_matches_2e1262;
+	L_member_2e1263:;
+	goto L_matches_2e1261;
+	L_member_2e1264:;
+	goto L_matches_2e1262;
+	L_matches_2e1261:;
+	goto L__2e1259;
+	L_matches_2e1262:;
+	t_abortsite_2e920 = ((u64)48UL);
+	goto L_abort_2e921;
+	L__2e1269:;
+	L__2e1260:;
+	t_abortsite_2e920 = ((u64)49UL);
+	goto L_abort_2e928;
+	L__2e1259:;
+	t__2e1271 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R25);
+	t_tag_2e1272 = (u64)(*(u32 *)t__2e1271);
+	t__2e1280 = (u64)(u32)(((u32)t_tag_2e1272 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1280) goto L_member_2e1277; else goto L__2e1279;
+	L__2e1279:;
+	t__2e1282 = (u64)(u32)(((u32)t_tag_2e1272 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1282) goto L_member_2e1278; else goto L__2e1281;
+	L__2e1281:;
+	goto L_matches_2e1276;
+	L_member_2e1277:;
+	goto L_matches_2e1275;
+	L_member_2e1278:;
+	goto L_matches_2e1276;
+	L_matches_2e1275:;
+	goto L__2e1273;
+	L_matches_2e1276:;
+	t_abortsite_2e920 = ((u64)50UL);
+	goto L_abort_2e921;
+	L__2e1283:;
+	L__2e1274:;
+	t_abortsite_2e920 = ((u64)51UL);
+	goto L_abort_2e928;
+	L__2e1273:;
+	t__2e1285 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R26);
+	t_tag_2e1286 = (u64)(*(u32 *)t__2e1285);
+	t__2e1294 = (u64)(u32)(((u32)t_tag_2e1286 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1294) goto L_member_2e1291; else goto L__2e1293;
+	L__2e1293:;
+	t__2e1296 = (u64)(u32)(((u32)t_tag_2e1286 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1296) goto L_member_2e1292; else goto L__2e1295;
+	L__2e1295:;
+	goto L_matches_2e1290;
+	L_member_2e1291:;
+	goto L_matches_2e1289;
+	L_member_2e1292:;
+	goto L_matches_2e1290;
+	L_matches_2e1289:;
+	goto L__2e1287;
+	L_matches_2e1290:;
+	t_abortsite_2e920 = ((u64)52UL);
+	goto L_abort_2e921;
+	L__2e1297:;
+	L__2e1288:;
+	t_abortsite_2e920 = ((u64)53UL);
+	goto L_abort_2e928;
+	L__2e1287:;
+	t__2e1299 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R27);
+	t_tag_2e1300 = (u64)(*(u32 *)t__2e1299);
+	t__2e1308 = (u64)(u32)(((u32)t_tag_2e1300 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1308) goto L_member_2e1305; else goto L__2e1307;
+	L__2e1307:;
+	t__2e1310 = (u64)(u32)(((u32)t_tag_2e1300 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1310) goto L_member_2e1306; else goto L__2e1309;
+	L__2e1309:;
+	goto L_matches_2e1304;
+	L_member_2e1305:;
+	goto L_matches_2e1303;
+	L_member_2e1306:;
+	goto L_matches_2e1304;
+	L_matches_2e1303:;
+	goto L__2e1301;
+	L_matches_2e1304:;
+	t_abortsite_2e920 = ((u64)54UL);
+	goto L_abort_2e921;
+	L__2e1311:;
+	L__2e1302:;
+	t_abortsite_2e920 = ((u64)55UL);
+	goto L_abort_2e928;
+	L__2e1301:;
+	t__2e1313 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R28);
+	t_tag_2e1314 = (u64)(*(u32 *)t__2e1313);
+	t__2e1322 = (u64)(u32)(((u32)t_tag_2e1314 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1322) goto L_member_2e1319; else goto L__2e1321;
+	L__2e1321:;
+	t__2e1324 = (u64)(u32)(((u32)t_tag_2e1314 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1324) goto L_member_2e1320; else goto L__2e1323;
+	L__2e1323:;
+	goto L_matches_2e1318;
+	L_member_2e1319:;
+	goto L_matches_2e1317;
+	L_member_2e1320:;
+	goto L_matches_2e1318;
+	L_matches_2e1317:;
+	goto L__2e1315;
+	L_matches_2e1318:;
+	t_abortsite_2e920 = ((u64)56UL);
+	goto L_abort_2e921;
+	L__2e1325:;
+	L__2e1316:;
+	t_abortsite_2e920 = ((u64)57UL);
+	goto L_abort_2e928;
+	L__2e1315:;
+	t__2e1327 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R29);
+	t_tag_2e1328 = (u64)(*(u32 *)t__2e1327);
+	t__2e1336 = (u64)(u32)(((u32)t_tag_2e1328 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1336) goto L_member_2e1333; else goto L__2e1335;
+	L__2e1335:;
+	t__2e1338 = (u64)(u32)(((u32)t_tag_2e1328 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1338) goto L_member_2e1334; else goto L__2e1337;
+	L__2e1337:;
+	goto L_matches_2e1332;
+	L_member_2e1333:;
+	goto L_matches_2e1331;
+	L_member_2e1334:;
+	goto L_matches_2e1332;
+	L_matches_2e1331:;
+	goto L__2e1329;
+	L_matches_2e1332:;
+	t_abortsite_2e920 = ((u64)58UL);
+	goto L_abort_2e921;
+	L__2e1339:;
+	L__2e1330:;
+	t_abortsite_2e920 = ((u64)59UL);
+	goto L_abort_2e928;
+	L__2e1329:;
+	t__2e1341 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R30);
+	t_tag_2e1342 = (u64)(*(u32 *)t__2e1341);
+	t__2e1350 = (u64)(u32)(((u32)t_tag_2e1342 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1350) goto L_member_2e1347; else goto L__2e1349;
+	L__2e1349:;
+	t__2e1352 = (u64)(u32)(((u32)t_tag_2e1342 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1352) goto L_member_2e1348; else goto L__2e1351;
+	L__2e1351:;
+	goto L_matches_2e1346;
+	L_member_2e1347:;
+	goto L_matches_2e1345;
+	L_member_2e1348:;
+	goto L_matches_2e1346;
+	L_matches_2e1345:;
+	goto L__2e1343;
+	L_matches_2e1346:;
+	t_abortsite_2e920 = ((u64)60UL);
+	goto L_abort_2e921;
+	L__2e1353:;
+	L__2e1344:;
+	t_abortsite_2e920 = ((u64)61UL);
+	goto L_abort_2e928;
+	L__2e1343:;
+	t__2e1355 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R31);
+	t_tag_2e1356 = (u64)(*(u32 *)t__2e1355);
+	t__2e1364 = (u64)(u32)(((u32)t_tag_2e1356 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1364) goto L_member_2e1361; else goto L__2e1363;
+	L__2e1363:;
+	t__2e1366 = (u64)(u32)(((u32)t_tag_2e1356 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1366) goto L_member_2e1362; else goto L__2e1365;
+	L__2e1365:;
+	goto L_matches_2e1360;
+	L_member_2e1361:;
+	goto L_matches_2e1359;
+	L_member_2e1362:;
+	goto L_matches_2e1360;
+	L_matches_2e1359:;
+	goto L__2e1357;
+	L_matches_2e1360:;
+	t_abortsite_2e920 = ((u64)62UL);
+	goto L_abort_2e921;
+	L__2e1367:;
+	L__2e1358:;
+	t_abortsite_2e920 = ((u64)63UL);
+	goto L_abort_2e928;
+	L__2e1357:;
+	t__2e1369 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R32);
+	t_tag_2e1370 = (u64)(*(u32 *)t__2e1369);
+	t__2e1378 = (u64)(u32)(((u32)t_tag_2e1370 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1378) goto L_member_2e1375; else goto L__2e1377;
+	L__2e1377:;
+	t__2e1380 = (u64)(u32)(((u32)t_tag_2e1370 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1380) goto L_member_2e1376; else goto L__2e1379;
+	L__2e1379:;
+	goto L_matches_2e1374;
+	L_member_2e1375:;
+	goto L_matches_2e1373;
+	L_member_2e1376:;
+	goto L_matches_2e1374;
+	L_matches_2e1373:;
+	goto L__2e1371;
+	L_matches_2e1374:;
+	t_abortsite_2e920 = ((u64)64UL);
+	goto L_abort_2e921;
+	L__2e1381:;
+	L__2e1372:;
+	t_abortsite_2e920 = ((u64)65UL);
+	goto L_abort_2e928;
+	L__2e1371:;
+	t__2e1383 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R33);
+	t_tag_2e1384 = (u64)(*(u32 *)t__2e1383);
+	t__2e1392 = (u64)(u32)(((u32)t_tag_2e1384 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1392) goto L_member_2e1389; else goto L__2e1391;
+	L__2e1391:;
+	t__2e1394 = (u64)(u32)(((u32)t_tag_2e1384 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1394) goto L_member_2e1390; else goto L__2e1393;
+	L__2e1393:;
+	goto L_matches_2e1388;
+	L_member_2e1389:;
+	goto L_matches_2e1387;
+	L_member_2e1390:;
+	goto L_matches_2e1388;
+	L_matches_2e1387:;
+	goto L__2e1385;
+	L_matches_2e1388:;
+	t_abortsite_2e920 = ((u64)66UL);
+	goto L_abort_2e921;
+	L__2e1395:;
+	L__2e1386:;
+	t_abortsite_2e920 = ((u64)67UL);
+	goto L_abort_2e928;
+	L__2e1385:;
+	t__2e1397 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R34);
+	t_tag_2e1398 = (u64)(*(u32 *)t__2e1397);
+	t__2e1406 = (u64)(u32)(((u32)t_tag_2e1398 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1406) goto L_member_2e1403; else goto L__2e1405;
+	L__2e1405:;
+	t__2e1408 = (u64)(u32)(((u32)t_tag_2e1398 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1408) goto L_member_2e1404; else goto L__2e1407;
+	L__2e1407:;
+	goto L_matches_2e1402;
+	L_member_2e1403:;
+	goto L_matches_2e1401;
+	L_member_2e1404:;
+	goto L_matches_2e1402;
+	L_matches_2e1401:;
+	goto L__2e1399;
+	L_matches_2e1402:;
+	t_abortsite_2e920 = ((u64)68UL);
+	goto L_abort_2e921;
+	L__2e1409:;
+	L__2e1400:;
+	t_abortsite_2e920 = ((u64)69UL);
+	goto L_abort_2e928;
+	L__2e1399:;
+	t__2e1411 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R35);
+	t_tag_2e1412 = (u64)(*(u32 *)t__2e1411);
+	t__2e1420 = (u64)(u32)(((u32)t_tag_2e1412 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1420) goto L_member_2e1417; else goto L__2e1419;
+	L__2e1419:;
+	t__2e1422 = (u64)(u32)(((u32)t_tag_2e1412 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1422) goto L_member_2e1418; else goto L__2e1421;
+	L__2e1421:;
+	goto L_matches_2e1416;
+	L_member_2e1417:;
+	goto L_matches_2e1415;
+	L_member_2e1418:;
+	goto L_matches_2e1416;
+	L_matches_2e1415:;
+	goto L__2e1413;
+	L_matches_2e1416:;
+	t_abortsite_2e920 = ((u64)70UL);
+	goto L_abort_2e921;
+	L__2e1423:;
+	L__2e1414:;
+	t_abortsite_2e920 = ((u64)71UL);
+	goto L_abort_2e928;
+	L__2e1413:;
+	t__2e1425 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R36);
+	t_tag_2e1426 = (u64)(*(u32 *)t__2e1425);
+	t__2e1434 = (u64)(u32)(((u32)t_tag_2e1426 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1434) goto L_member_2e1431; else goto L__2e1433;
+	L__2e1433:;
+	t__2e1436 = (u64)(u32)(((u32)t_tag_2e1426 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1436) goto L_member_2e1432; else goto L__2e1435;
+	L__2e1435:;
+	goto L_matches_2e1430;
+	L_member_2e1431:;
+	goto L_matches_2e1429;
+	L_member_2e1432:;
+	goto L_matches_2e1430;
+	L_matches_2e1429:;
+	goto L__2e1427;
+	L_matches_2e1430:;
+	t_abortsite_2e920 = ((u64)72UL);
+	goto L_abort_2e921;
+	L__2e1437:;
+	L__2e1428:;
+	t_abortsite_2e920 = ((u64)73UL);
+	goto L_abort_2e928;
+	L__2e1427:;
+	t__2e1439 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R37);
+	t_tag_2e1440 = (u64)(*(u32 *)t__2e1439);
+	t__2e1448 = (u64)(u32)(((u32)t_tag_2e1440 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1448) goto L_member_2e1445; else goto L__2e1447;
+	L__2e1447:;
+	t__2e1450 = (u64)(u32)(((u32)t_tag_2e1440 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1450) goto L_member_2e1446; else goto L__2e1449;
+	L__2e1449:;
+	goto L_matches_2e1444;
+	L_member_2e1445:;
+	goto L_matches_2e1443;
+	L_member_2e1446:;
+	goto L_matches_2e1444;
+	L_matches_2e1443:;
+	goto L__2e1441;
+	L_matches_2e1444:;
+	t_abortsite_2e920 = ((u64)74UL);
+	goto L_abort_2e921;
+	L__2e1451:;
+	L__2e1442:;
+	t_abortsite_2e920 = ((u64)75UL);
+	goto L_abort_2e928;
+	L__2e1441:;
+	t__2e1453 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R38);
+	t_tag_2e1454 = (u64)(*(u32 *)t__2e1453);
+	t__2e1462 = (u64)(u32)(((u32)t_tag_2e1454 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1462) goto L_member_2e1459; else goto L__2e1461;
+	L__2e1461:;
+	t__2e1464 = (u64)(u32)(((u32)t_tag_2e1454 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1464) goto L_member_2e1460; else goto L__2e1463;
+	L__2e1463:;
+	goto L_matches_2e1458;
+	L_member_2e1459:;
+	goto L_matches_2e1457;
+	L_member_2e1460:;
+	goto L_matches_2e1458;
+	L_matches_2e1457:;
+	goto L__2e1455;
+	L_matches_2e1458:;
+	t_abortsite_2e920 = ((u64)76UL);
+	goto L_abort_2e921;
+	L__2e1465:;
+	L__2e1456:;
+	t_abortsite_2e920 = ((u64)77UL);
+	goto L_abort_2e928;
+	L__2e1455:;
+	t__2e1467 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R39);
+	t_tag_2e1468 = (u64)(*(u32 *)t__2e1467);
+	t__2e1476 = (u64)(u32)(((u32)t_tag_2e1468 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1476) goto L_member_2e1473; else goto L__2e1475;
+	L__2e1475:;
+	t__2e1478 = (u64)(u32)(((u32)t_tag_2e1468 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1478) goto L_member_2e1474; else goto L__2e1477;
+	L__2e1477:;
+	goto L_matches_2e1472;
+	L_member_2e1473:;
+	goto L_matches_2e1471;
+	L_member_2e1474:;
+	goto L_matches_2e1472;
+	L_matches_2e1471:;
+	goto L__2e1469;
+	L_matches_2e1472:;
+	t_abortsite_2e920 = ((u64)78UL);
+	goto L_abort_2e921;
+	L__2e1479:;
+	L__2e1470:;
+	t_abortsite_2e920 = ((u64)79UL);
+	goto L_abort_2e928;
+	L__2e1469:;
+	t__2e1481 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R40);
+	t_tag_2e1482 = (u64)(*(u32 *)t__2e1481);
+	t__2e1490 = (u64)(u32)(((u32)t_tag_2e1482 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1490) goto L_member_2e1487; else goto L__2e1489;
+	L__2e1489:;
+	t__2e1492 = (u64)(u32)(((u32)t_tag_2e1482 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1492) goto L_member_2e1488; else goto L__2e1491;
+	L__2e1491:;
+	goto L_matches_2e1486;
+	L_member_2e1487:;
+	goto L_matches_2e1485;
+	L_member_2e1488:;
+	goto L_matches_2e1486;
+	L_matches_2e1485:;
+	goto L__2e1483;
+	L_matches_2e1486:;
+	t_abortsite_2e920 = ((u64)80UL);
+	goto L_abort_2e921;
+	L__2e1493:;
+	L__2e1484:;
+	t_abortsite_2e920 = ((u64)81UL);
+	goto L_abort_2e928;
+	L__2e1483:;
+	t__2e1495 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R41);
+	t_tag_2e1496 = (u64)(*(u32 *)t__2e1495);
+	t__2e1504 = (u64)(u32)(((u32)t_tag_2e1496 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1504) goto L_member_2e1501; else goto L__2e1503;
+	L__2e1503:;
+	t__2e1506 = (u64)(u32)(((u32)t_tag_2e1496 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1506) goto L_member_2e1502; else goto L__2e1505;
+	L__2e1505:;
+	goto L_matches_2e1500;
+	L_member_2e1501:;
+	goto L_matches_2e1499;
+	L_member_2e1502:;
+	goto L_matches_2e1500;
+	L_matches_2e1499:;
+	goto L__2e1497;
+	L_matches_2e1500:;
+	t_abortsite_2e920 = ((u64)82UL);
+	goto L_abort_2e921;
+	L__2e1507:;
+	L__2e1498:;
+	t_abortsite_2e920 = ((u64)83UL);
+	goto L_abort_2e928;
+	L__2e1497:;
+	t__2e1509 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R42);
+	t_tag_2e1510 = (u64)(*(u32 *)t__2e1509);
+	t__2e1518 = (u64)(u32)(((u32)t_tag_2e1510 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1518) goto L_member_2e1515; else goto L__2e1517;
+	L__2e1517:;
+	t__2e1520 = (u64)(u32)(((u32)t_tag_2e1510 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1520) goto L_member_2e1516; else goto L__2e1519;
+	L__2e1519:;
+	goto L_matches_2e1514;
+	L_member_2e1515:;
+	goto L_matches_2e1513;
+	L_member_2e1516:;
+	goto L_matches_2e1514;
+	L_matches_2e1513:;
+	goto L__2e1511;
+	L_matches_2e1514:;
+	t_abortsite_2e920 = ((u64)84UL);
+	goto L_abort_2e921;
+	L__2e1521:;
+	L__2e1512:;
+	t_abortsite_2e920 = ((u64)85UL);
+	goto L_abort_2e928;
+	L__2e1511:;
+	t__2e1523 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R43);
+	t_tag_2e1524 = (u64)(*(u32 *)t__2e1523);
+	t__2e1532 = (u64)(u32)(((u32)t_tag_2e1524 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1532) goto L_member_2e1529; else goto L__2e1531;
+	L__2e1531:;
+	t__2e1534 = (u64)(u32)(((u32)t_tag_2e1524 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1534) goto L_member_2e1530; else goto L__2e1533;
+	L__2e1533:;
+	goto L_matches_2e1528;
+	L_member_2e1529:;
+	goto L_matches_2e1527;
+	L_member_2e1530:;
+	goto L_matches_2e1528;
+	L_matches_2e1527:;
+	goto L__2e1525;
+	L_matches_2e1528:;
+	t_abortsite_2e920 = ((u64)86UL);
+	goto L_abort_2e921;
+	L__2e1535:;
+	L__2e1526:;
+	t_abortsite_2e920 = ((u64)87UL);
+	goto L_abort_2e928;
+	L__2e1525:;
+	t__2e1537 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R44);
+	t_tag_2e1538 = (u64)(*(u32 *)t__2e1537);
+	t__2e1546 = (u64)(u32)(((u32)t_tag_2e1538 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1546) goto L_member_2e1543; else goto L__2e1545;
+	L__2e1545:;
+	t__2e1548 = (u64)(u32)(((u32)t_tag_2e1538 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1548) goto L_member_2e1544; else goto L__2e1547;
+	L__2e1547:;
+	goto L_matches_2e1542;
+	L_member_2e1543:;
+	goto L_matches_2e1541;
+	L_member_2e1544:;
+	goto L_matches_2e1542;
+	L_matches_2e1541:;
+	goto L__2e1539;
+	L_matches_2e1542:;
+	t_abortsite_2e920 = ((u64)88UL);
+	goto L_abort_2e921;
+	L__2e1549:;
+	L__2e1540:;
+	t_abortsite_2e920 = ((u64)89UL);
+	goto L_abort_2e928;
+	L__2e1539:;
+	t__2e1551 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R45);
+	t_tag_2e1552 = (u64)(*(u32 *)t__2e1551);
+	t__2e1560 = (u64)(u32)(((u32)t_tag_2e1552 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1560) goto L_member_2e1557; else goto L__2e1559;
+	L__2e1559:;
+	t__2e1562 = (u64)(u32)(((u32)t_tag_2e1552 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1562) goto L_member_2e1558; else goto L__2e1561;
+	L__2e1561:;
+	goto L_matches_2e1556;
+	L_member_2e1557:;
+	goto L_matches_2e1555;
+	L_member_2e1558:;
+	goto L_matches_2e1556;
+	L_matches_2e1555:;
+	goto L__2e1553;
+	L_matches_2e1556:;
+	t_abortsite_2e920 = ((u64)90UL);
+	goto L_abort_2e921;
+	L__2e1563:;
+	L__2e1554:;
+	t_abortsite_2e920 = ((u64)91UL);
+	goto L_abort_2e928;
+	L__2e1553:;
+	t__2e1565 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R46);
+	t_tag_2e1566 = (u64)(*(u32 *)t__2e1565);
+	t__2e1574 = (u64)(u32)(((u32)t_tag_2e1566 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1574) goto L_member_2e1571; else goto L__2e1573;
+	L__2e1573:;
+	t__2e1576 = (u64)(u32)(((u32)t_tag_2e1566 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1576) goto L_member_2e1572; else goto L__2e1575;
+	L__2e1575:;
+	goto L_matches_2e1570;
+	L_member_2e1571:;
+	goto L_matches_2e1569;
+	L_member_2e1572:;
+	goto L_matches_2e1570;
+	L_matches_2e1569:;
+	goto L__2e1567;
+	L_matches_2e1570:;
+	t_abortsite_2e920 = ((u64)92UL);
+	goto L_abort_2e921;
+	L__2e1577:;
+	L__2e1568:;
+	t_abortsite_2e920 = ((u64)93UL);
+	goto L_abort_2e928;
+	L__2e1567:;
+	t__2e1579 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R47);
+	t_tag_2e1580 = (u64)(*(u32 *)t__2e1579);
+	t__2e1588 = (u64)(u32)(((u32)t_tag_2e1580 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1588) goto L_member_2e1585; else goto L__2e1587;
+	L__2e1587:;
+	t__2e1590 = (u64)(u32)(((u32)t_tag_2e1580 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1590) goto L_member_2e1586; else goto L__2e1589;
+	L__2e1589:;
+	goto L_matches_2e1584;
+	L_member_2e1585:;
+	goto L_matches_2e1583;
+	L_member_2e1586:;
+	goto L_matches_2e1584;
+	L_matches_2e1583:;
+	goto L__2e1581;
+	L_matches_2e1584:;
+	t_abortsite_2e920 = ((u64)94UL);
+	goto L_abort_2e921;
+	L__2e1591:;
+	L__2e1582:;
+	t_abortsite_2e920 = ((u64)95UL);
+	goto L_abort_2e928;
+	L__2e1581:;
+	t__2e1593 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R48);
+	t_tag_2e1594 = (u64)(*(u32 *)t__2e1593);
+	t__2e1602 = (u64)(u32)(((u32)t_tag_2e1594 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1602) goto L_member_2e1599; else goto L__2e1601;
+	L__2e1601:;
+	t__2e1604 = (u64)(u32)(((u32)t_tag_2e1594 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1604) goto L_member_2e1600; else goto L__2e1603;
+	L__2e1603:;
+	goto L_matches_2e1598;
+	L_member_2e1599:;
+	goto L_matches_2e1597;
+	L_member_2e1600:;
+	goto L_matches_2e1598;
+	L_matches_2e1597:;
+	goto L__2e1595;
+	L_matches_2e1598:;
+	t_abortsite_2e920 = ((u64)96UL);
+	goto L_abort_2e921;
+	L__2e1605:;
+	L__2e1596:;
+	t_abortsite_2e920 = ((u64)97UL);
+	goto L_abort_2e928;
+	L__2e1595:;
+	t__2e1607 = ((u64 (*)(u64))((u64)((char *)&F_spamfunc)))((u64)R49);
+	t_tag_2e1608 = (u64)(*(u32 *)t__2e1607);
+	t__2e1616 = (u64)(u32)(((u32)t_tag_2e1608 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1616) goto L_member_2e1613; else goto L__2e1615;
+	L__2e1615:;
+	t__2e1618 = (u64)(u32)(((u32)t_tag_2e1608 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e1618) goto L_member_2e1614; else goto L__2e1617;
+	L__2e1617:;
+	goto L_matches_2e1612;
+	L_member_2e1613:;
+	goto L_matches_2e1611;
+	L_member_2e1614:;
+	goto L_matches_2e1612;
+	L_matches_2e1611:;
+	goto L__2e1609;
+	L_matches_2e1612:;
+	t_abortsite_2e920 = ((u64)98UL);
+	goto L_abort_2e921;
+	L__2e1619:;
+	L__2e1610:;
+	t_abortsite_2e920 = ((u64)99UL);
+	goto L_abort_2e928;
+	L__2e1609:;
+	goto L_resume_2e903;
+	L__2e905:;
+	L__2e899:;
+	return;
+	L_abort_2e921:;
+	t__2e922 = (u64)((u64)t_abortsite_2e920 * (u64)((u64)16UL));
+	t__2e922 = (u64)((u64)((u64)((char *)&D_abortsites_2e919)) + (u64)t__2e922);
+	t__2e923 = (u64)(*(u64 *)t__2e922);
+	t__2e924 = (u64)((u64)t__2e922 + (u64)((u64)8UL));
+	t__2e925 = (u64)(*(u32 *)t__2e924);
+	t__2e924 = (u64)((u64)t__2e922 + (u64)((u64)12UL));
+	t__2e926 = (u64)(*(u32 *)t__2e924);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e923, (u64)t__2e925, (u64)t__2e926, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e928:;
+	t__2e929 = (u64)((u64)t_abortsite_2e920 * (u64)((u64)16UL));
+	t__2e929 = (u64)((u64)((u64)((char *)&D_abortsites_2e919)) + (u64)t__2e929);
+	t__2e930 = (u64)(*(u64 *)t__2e929);
+	t__2e931 = (u64)((u64)t__2e929 + (u64)((u64)8UL));
+	t__2e932 = (u64)(*(u32 *)t__2e931);
+	t__2e931 = (u64)((u64)t__2e929 + (u64)((u64)12UL));
+	t__2e933 = (u64)(*(u32 *)t__2e931);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e930, (u64)t__2e932, (u64)t__2e933, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u64 F_spamfunc(u64 __rp) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t_object_2e1622;
+	L_start_2e1620:;
+	t_object_2e1622 = (u64)A0;
+	L_body_2e1621:;
+	*(u32 *)t_object_2e1622 = (u32)((u64)3012680272UL);
+	BLIT(__rp, t_object_2e1622, 4); return __rp;
+}
+static void F_nested(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e1628;
+	u64 t__2e1630;
+	u64 t__2e1631;
+	u64 t__2e1632;
+	u64 t__2e1633;
+	u64 t__2e1634;
+	u64 t__2e1635;
+	u64 t__2e1638;
+	u64 t__2e1639;
+	u64 t__2e1640;
+	u64 t__2e1646;
+	u64 t__2e1647;
+	u64 t__2e1648;
+	u64 t__2e1649;
+	u64 t__2e1650;
+	u64 t__2e1651;
+	u64 t__2e1654;
+	u64 t__2e1655;
+	u64 t__2e1656;
+	u64 t__2e1659;
+	u64 t__2e1660;
+	u64 t__2e1661;
+	u64 t__2e1662;
+	u64 t__2e1663;
+	u64 t__2e1664;
+	u64 t__2e1667;
+	u64 t__2e1668;
+	u64 t__2e1669;
+	u64 t__2e1679;
+	u64 t__2e1682;
+	u64 t__2e1683;
+	u64 t__2e1684;
+	u64 t__2e1685;
+	u64 t__2e1686;
+	u64 t__2e1687;
+	u64 t__2e1690;
+	u64 t__2e1691;
+	u64 t__2e1692;
+	u64 t__2e1693;
+	u64 t__2e1694;
+	u64 t__2e1695;
+	u64 t__2e1696;
+	u64 t__2e1697;
+	u64 t__2e1698;
+	u64 t__2e1701;
+	u64 t__2e1702;
+	u64 t__2e1703;
+	u64 t__2e1709;
+	u64 t__2e1710;
+	u64 t__2e1711;
+	u64 t__2e1712;
+	u64 t__2e1713;
+	u64 t__2e1714;
+	u64 t__2e1717;
+	u64 t__2e1718;
+	u64 t__2e1719;
+	u64 t__2e1720;
+	u64 t__2e1721;
+	u64 t__2e1722;
+	u64 t__2e1723;
+	u64 t__2e1724;
+	u64 t__2e1725;
+	u64 t__2e1728;
+	u64 t__2e1729;
+	u64 t__2e1730;
+	u64 t__2e1735;
+	u64 t__2e1736;
+	u64 t__2e1737;
+	u64 t__2e1738;
+	u64 t__2e1742;
+	u64 t__2e1743;
+	u64 t__2e1744;
+	u64 t__2e1745;
+	u64 t__2e1746;
+	u64 t__2e1753;
+	u64 t__2e1754;
+	u64 t__2e1755;
+	u64 t__2e1756;
+	u64 t__2e1757;
+	u64 t__2e1762;
+	u64 t__2e1763;
+	u64 t__2e1764;
+	u64 t__2e1765;
+	u64 t__2e1766;
+	u64 t__2e1767;
+	u64 t__2e1768;
+	u64 t__2e1769;
+	u64 t__2e1771;
+	u64 t__2e1773;
+	u64 t_abortsite_2e1740;
+	u64 t_binding_2e1627;
+	u64 t_binding_2e1752;
+	u64 t_cleanup_2e1641;
+	u64 t_cleanup_2e1670;
+	u64 t_cleanup_2e1704;
+	L_start_2e1623:;
+	t_binding_2e1627 = (u64)A0;
+	t_binding_2e1752 = (u64)A1;
+	L_body_2e1624:;
+	*(u64 *)t_binding_2e1627 = (u64)((u64)0UL);
+	t__2e1628 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	*(u64 *)t__2e1628 = (u64)((u64)0UL);
+	t__2e1628 = (u64)((u64)t__2e1628 + (u64)((u64)8UL));
+	*(u64 *)t__2e1628 = (u64)((u64)0UL);
+	t__2e1630 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	t__2e1631 = (u64)((u64)t_binding_2e1627 + (u64)((u64)16UL));
+	t__2e1632 = (u64)(*(u64 *)t__2e1630);
+	t__2e1633 = (u64)((u64)t__2e1632 + (u64)((u64)1UL));
+	*(u64 *)t__2e1630 = (u64)t__2e1633;
+	t__2e1635 = (u64)(*(u64 *)t__2e1631);
+	t__2e1638 = (u64)(u32)(((u64)t__2e1633 <= (u64)t__2e1635));
+	if ((u32)t__2e1638) goto L__2e1636; else goto L__2e1637;
+	L__2e1637:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e1627, (u64)((u64)8UL));
+	goto L__2e1636;
+	L__2e1636:;
+	t__2e1639 = (u64)(*(u64 *)t_binding_2e1627);
+	t__2e1634 = (u64)((u64)t__2e1632 * (u64)((u64)8UL));
+	t__2e1634 = (u64)((u64)t__2e1639 + (u64)t__2e1634);
+	t__2e1640 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1634 = (u64)((u64)0UL);
+	t_cleanup_2e1641 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e1642;
+	L_resume_2e1643:;
+	goto L__2e1625;
+	L__2e1644:;
+	goto L__2e1645;
+	L_defer_2e1642:;
+	t__2e1646 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	t__2e1647 = (u64)((u64)t_binding_2e1627 + (u64)((u64)16UL));
+	t__2e1648 = (u64)(*(u64 *)t__2e1646);
+	t__2e1649 = (u64)((u64)t__2e1648 + (u64)((u64)1UL));
+	*(u64 *)t__2e1646 = (u64)t__2e1649;
+	t__2e1651 = (u64)(*(u64 *)t__2e1647);
+	t__2e1654 = (u64)(u32)(((u64)t__2e1649 <= (u64)t__2e1651));
+	if ((u32)t__2e1654) goto L__2e1652; else goto L__2e1653;
+	L__2e1653:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e1627, (u64)((u64)8UL));
+	goto L__2e1652;
+	L__2e1652:;
+	t__2e1655 = (u64)(*(u64 *)t_binding_2e1627);
+	t__2e1650 = (u64)((u64)t__2e1648 * (u64)((u64)8UL));
+	t__2e1650 = (u64)((u64)t__2e1655 + (u64)t__2e1650);
+	t__2e1656 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1650 = (u64)((u64)1UL);
+	t__2e1659 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	t__2e1660 = (u64)((u64)t_binding_2e1627 + (u64)((u64)16UL));
+	t__2e1661 = (u64)(*(u64 *)t__2e1659);
+	t__2e1662 = (u64)((u64)t__2e1661 + (u64)((u64)1UL));
+	*(u64 *)t__2e1659 = (u64)t__2e1662;
+	t__2e1664 = (u64)(*(u64 *)t__2e1660);
+	t__2e1667 = (u64)(u32)(((u64)t__2e1662 <= (u64)t__2e1664));
+	if ((u32)t__2e1667) goto L__2e1665; else goto L__2e1666;
+	L__2e1666:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e1627, (u64)((u64)8UL));
+	goto L__2e1665;
+	L__2e1665:;
+	t__2e1668 = (u64)(*(u64 *)t_binding_2e1627);
+	t__2e1663 = (u64)((u64)t__2e1661 * (u64)((u64)8UL));
+	t__2e1663 = (u64)((u64)t__2e1668 + (u64)t__2e1663);
+	t__2e1669 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1663 = (u64)((u64)2UL);
+	t_cleanup_2e1670 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e1671;
+	L_resume_2e1672:;
+	goto L__2e1657;
+	L__2e1673:;
+	goto L__2e1674;
+	L_defer_2e1671:;
+	t__2e1679 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e1679) goto L_true_2e1676; else goto L_false_2e1677;
+	L_true_2e1676:;
+	t__2e1682 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	t__2e1683 = (u64)((u64)t_binding_2e1627 + (u64)((u64)16UL));
+	t__2e1684 = (u64)(*(u64 *)t__2e1682);
+	t__2e1685 = (u64)((u64)t__2e1684 + (u64)((u64)1UL));
+	*(u64 *)t__2e1682 = (u64)t__2e1685;
+	t__2e1687 = (u64)(*(u64 *)t__2e1683);
+	t__2e1690 = (u64)(u32)(((u64)t__2e1685 <= (u64)t__2e1687));
+	if ((u32)t__2e1690) goto L__2e1688; else goto L__2e1689;
+	L__2e1689:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e1627, (u64)((u64)8UL));
+	goto L__2e1688;
+	L__2e1688:;
+	t__2e1691 = (u64)(*(u64 *)t_binding_2e1627);
+	t__2e1686 = (u64)((u64)t__2e1684 * (u64)((u64)8UL));
+	t__2e1686 = (u64)((u64)t__2e1691 + (u64)t__2e1686);
+	t__2e1692 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1686 = (u64)((u64)3UL);
+	t__2e1693 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	t__2e1694 = (u64)((u64)t_binding_2e1627 + (u64)((u64)16UL));
+	t__2e1695 = (u64)(*(u64 *)t__2e1693);
+	t__2e1696 = (u64)((u64)t__2e1695 + (u64)((u64)1UL));
+	*(u64 *)t__2e1693 = (u64)t__2e1696;
+	t__2e1698 = (u64)(*(u64 *)t__2e1694);
+	t__2e1701 = (u64)(u32)(((u64)t__2e1696 <= (u64)t__2e1698));
+	if ((u32)t__2e1701) goto L__2e1699; else goto L__2e1700;
+	L__2e1700:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e1627, (u64)((u64)8UL));
+	goto L__2e1699;
+	L__2e1699:;
+	t__2e1702 = (u64)(*(u64 *)t_binding_2e1627);
+	t__2e1697 = (u64)((u64)t__2e1695 * (u64)((u64)8UL));
+	t__2e1697 = (u64)((u64)t__2e1702 + (u64)t__2e1697);
+	t__2e1703 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1697 = (u64)((u64)4UL);
+	t_cleanup_2e1704 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e1705;
+	L_resume_2e1706:;
+	goto L__2e1680;
+	L__2e1707:;
+	goto L__2e1708;
+	L_defer_2e1705:;
+	t__2e1709 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	t__2e1710 = (u64)((u64)t_binding_2e1627 + (u64)((u64)16UL));
+	t__2e1711 = (u64)(*(u64 *)t__2e1709);
+	t__2e1712 = (u64)((u64)t__2e1711 + (u64)((u64)1UL));
+	*(u64 *)t__2e1709 = (u64)t__2e1712;
+	t__2e1714 = (u64)(*(u64 *)t__2e1710);
+	t__2e1717 = (u64)(u32)(((u64)t__2e1712 <= (u64)t__2e1714));
+	if ((u32)t__2e1717) goto L__2e1715; else goto L__2e1716;
+	L__2e1716:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e1627, (u64)((u64)8UL));
+	goto L__2e1715;
+	L__2e1715:;
+	t__2e1718 = (u64)(*(u64 *)t_binding_2e1627);
+	t__2e1713 = (u64)((u64)t__2e1711 * (u64)((u64)8UL));
+	t__2e1713 = (u64)((u64)t__2e1718 + (u64)t__2e1713);
+	t__2e1719 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1713 = (u64)((u64)5UL);
+	goto L_resume_2e1706;
+	L__2e1708:;
+	L__2e1680:;
+	goto L__2e1678;
+	L_false_2e1677:;
+	L__2e1678:;
+	t__2e1720 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	t__2e1721 = (u64)((u64)t_binding_2e1627 + (u64)((u64)16UL));
+	t__2e1722 = (u64)(*(u64 *)t__2e1720);
+	t__2e1723 = (u64)((u64)t__2e1722 + (u64)((u64)1UL));
+	*(u64 *)t__2e1720 = (u64)t__2e1723;
+	t__2e1725 = (u64)(*(u64 *)t__2e1721);
+	t__2e1728 = (u64)(u32)(((u64)t__2e1723 <= (u64)t__2e1725));
+	if ((u32)t__2e1728) goto L__2e1726; else goto L__2e1727;
+	L__2e1727:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e1627, (u64)((u64)8UL));
+	goto L__2e1726;
+	L__2e1726:;
+	t__2e1729 = (u64)(*(u64 *)t_binding_2e1627);
+	t__2e1724 = (u64)((u64)t__2e1722 * (u64)((u64)8UL));
+	t__2e1724 = (u64)((u64)t__2e1729 + (u64)t__2e1724);
+	t__2e1730 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	*(u64 *)t__2e1724 = (u64)((u64)6UL);
+	goto L_resume_2e1672;
+	L__2e1674:;
+	L__2e1657:;
+	t__2e1736 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	t__2e1737 = (u64)((u64)t_binding_2e1627 + (u64)((u64)16UL));
+	t__2e1738 = (u64)(*(u64 *)t__2e1736);
+	t__2e1735 = (u64)(u32)(((u64)t__2e1738 == (u64)((u64)7UL)));
+	if ((u32)t__2e1735) goto L_passed_2e1734; else goto L_failed_2e1733;
+	L_failed_2e1733:;
+	t_abortsite_2e1740 = ((u64)0UL);
+	goto L_abort_2e1741;
+	L_passed_2e1734:;
+	*(u64 *)t_binding_2e1752 = (u64)((u64)0UL);
+	L_loop_2e1747:;
+	t__2e1754 = (u64)(*(u64 *)t_binding_2e1752);
+	t__2e1755 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	t__2e1756 = (u64)((u64)t_binding_2e1627 + (u64)((u64)16UL));
+	t__2e1757 = (u64)(*(u64 *)t__2e1755);
+	t__2e1753 = (u64)(u32)(((u64)t__2e1754 < (u64)t__2e1757));
+	if ((u32)t__2e1753) goto L_body_2e1748; else goto L__2e1750;
+	L_body_2e1748:;
+	t__2e1764 = (u64)((u64)t_binding_2e1627 + (u64)((u64)8UL));
+	t__2e1765 = (u64)((u64)t_binding_2e1627 + (u64)((u64)16UL));
+	t__2e1766 = (u64)(*(u64 *)t_binding_2e1627);
+	t__2e1767 = (u64)(*(u64 *)t_binding_2e1752);
+	t__2e1763 = (u64)((u64)t__2e1767 * (u64)((u64)8UL));
+	t__2e1763 = (u64)((u64)t__2e1766 + (u64)t__2e1763);
+	t__2e1768 = (u64)(*(u64 *)t__2e1763);
+	t__2e1769 = (u64)(*(u64 *)t_binding_2e1752);
+	t__2e1762 = (u64)(u32)(((u64)t__2e1768 == (u64)t__2e1769));
+	if ((u32)t__2e1762) goto L_passed_2e1761; else goto L_failed_2e1760;
+	L_failed_2e1760:;
+	t_abortsite_2e1740 = ((u64)1UL);
+	goto L_abort_2e1741;
+	L_passed_2e1761:;
+	goto L__2e1758;
+	L__2e1770:;
+	L__2e1758:;
+	L_after_2e1751:;
+	t__2e1771 = (u64)(*(u64 *)t_binding_2e1752);
+	t__2e1771 = (u64)((u64)t__2e1771 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1752 = (u64)t__2e1771;
+	goto L_loop_2e1747;
+	L__2e1750:;
+	goto L__2e1731;
+	L__2e1772:;
+	L__2e1731:;
+	t__2e1773 = (u64)(*(u64 *)t_binding_2e1627);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e1773);
+	goto L_resume_2e1643;
+	L__2e1645:;
+	L__2e1625:;
+	return;
+	L_abort_2e1741:;
+	t__2e1742 = (u64)((u64)t_abortsite_2e1740 * (u64)((u64)16UL));
+	t__2e1742 = (u64)((u64)((u64)((char *)&D_abortsites_2e1739)) + (u64)t__2e1742);
+	t__2e1743 = (u64)(*(u64 *)t__2e1742);
+	t__2e1744 = (u64)((u64)t__2e1742 + (u64)((u64)8UL));
+	t__2e1745 = (u64)(*(u32 *)t__2e1744);
+	t__2e1744 = (u64)((u64)t__2e1742 + (u64)((u64)12UL));
+	t__2e1746 = (u64)(*(u32 *)t__2e1744);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1743, (u64)t__2e1745, (u64)t__2e1746, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_reject(void) {
+	char A0[96] __attribute__((aligned(16)));
+	char A1[144] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char B8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[4] __attribute__((aligned(16)));
+	char B12[8] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char R15[4] __attribute__((aligned(16)));
+	u64 t__2e1810;
+	u64 t__2e1811;
+	u64 t__2e1815;
+	u64 t__2e1821;
+	u64 t__2e1822;
+	u64 t__2e1823;
+	u64 t__2e1826;
+	u64 t__2e1835;
+	u64 t__2e1837;
+	u64 t__2e1841;
+	u64 t__2e1842;
+	u64 t__2e1843;
+	u64 t__2e1844;
+	u64 t__2e1845;
+	u64 t__2e1848;
+	u64 t__2e1849;
+	u64 t__2e1850;
+	u64 t__2e1851;
+	u64 t__2e1852;
+	u64 t__2e1854;
+	u64 t__2e1861;
+	u64 t__2e1862;
+	u64 t__2e1866;
+	u64 t__2e1868;
+	u64 t__2e1869;
+	u64 t__2e1870;
+	u64 t__2e1872;
+	u64 t__2e1881;
+	u64 t__2e1883;
+	u64 t__2e1886;
+	u64 t_abortsite_2e1839;
+	u64 t_binding_2e1778;
+	u64 t_binding_2e1789;
+	u64 t_binding_2e1809;
+	u64 t_binding_2e1860;
+	u64 t_item_2e1780;
+	u64 t_item_2e1791;
+	u64 t_object_2e1817;
+	u64 t_object_2e1824;
+	u64 t_object_2e1867;
+	u64 t_object_2e1871;
+	u64 t_tag_2e1827;
+	u64 t_tag_2e1873;
+	L_start_2e1774:;
+	t_binding_2e1778 = (u64)A0;
+	t_binding_2e1789 = (u64)A1;
+	t_binding_2e1809 = (u64)A2;
+	t_object_2e1817 = (u64)A3;
+	t_object_2e1824 = (u64)A4;
+	t_binding_2e1860 = (u64)A5;
+	t_object_2e1867 = (u64)A6;
+	t_object_2e1871 = (u64)A7;
+	L_body_2e1775:;
+	t_item_2e1780 = (u64)((u64)t_binding_2e1778 + (u64)((u64)0UL));
+	BLIT(t_item_2e1780, ((u64)((char *)&D_strliteral_2e1782)), ((u64)24UL));
+	t_item_2e1780 = (u64)((u64)t_binding_2e1778 + (u64)((u64)24UL));
+	BLIT(t_item_2e1780, ((u64)((char *)&D_strliteral_2e1784)), ((u64)24UL));
+	t_item_2e1780 = (u64)((u64)t_binding_2e1778 + (u64)((u64)48UL));
+	BLIT(t_item_2e1780, ((u64)((char *)&D_strliteral_2e1786)), ((u64)24UL));
+	t_item_2e1780 = (u64)((u64)t_binding_2e1778 + (u64)((u64)72UL));
+	BLIT(t_item_2e1780, ((u64)((char *)&D_strliteral_2e1788)), ((u64)24UL));
+	t_item_2e1791 = (u64)((u64)t_binding_2e1789 + (u64)((u64)0UL));
+	BLIT(t_item_2e1791, ((u64)((char *)&D_strliteral_2e1793)), ((u64)24UL));
+	t_item_2e1791 = (u64)((u64)t_binding_2e1789 + (u64)((u64)24UL));
+	BLIT(t_item_2e1791, ((u64)((char *)&D_strliteral_2e1795)), ((u64)24UL));
+	t_item_2e1791 = (u64)((u64)t_binding_2e1789 + (u64)((u64)48UL));
+	BLIT(t_item_2e1791, ((u64)((char *)&D_strliteral_2e1797)), ((u64)24UL));
+	t_item_2e1791 = (u64)((u64)t_binding_2e1789 + (u64)((u64)72UL));
+	BLIT(t_item_2e1791, ((u64)((char *)&D_strliteral_2e1799)), ((u64)24UL));
+	t_item_2e1791 = (u64)((u64)t_binding_2e1789 + (u64)((u64)96UL));
+	BLIT(t_item_2e1791, ((u64)((char *)&D_strliteral_2e1801)), ((u64)24UL));
+	t_item_2e1791 = (u64)((u64)t_binding_2e1789 + (u64)((u64)120UL));
+	BLIT(t_item_2e1791, ((u64)((char *)&D_strliteral_2e1803)), ((u64)24UL));
+	*(u64 *)t_binding_2e1809 = (u64)((u64)0UL);
+	L_loop_2e1804:;
+	t__2e1811 = (u64)(*(u64 *)t_binding_2e1809);
+	t__2e1810 = (u64)(u32)(((u64)t__2e1811 < (u64)((u64)4UL)));
+	if ((u32)t__2e1810) goto L_body_2e1805; else goto L__2e1807;
+	L_body_2e1805:;
+	*(u32 *)t_object_2e1817 = (u32)((u64)3532310079UL);
+	t__2e1821 = (u64)((u64)t_object_2e1817 + (u64)((u64)4UL));
+	*(u32 *)t__2e1821 = (u32)((u64)3UL);
+	t__2e1823 = (u64)(*(u64 *)t_binding_2e1809);
+	t__2e1822 = (u64)((u64)t__2e1823 * (u64)((u64)24UL));
+	t__2e1822 = (u64)((u64)t_binding_2e1778 + (u64)t__2e1822);
+	*(u64 *)t_object_2e1824 = (u64)((u64)0UL);
+	t__2e1826 = (u64)((u64)t_object_2e1824 + (u64)((u64)8UL));
+	*(u64 *)t__2e1826 = (u64)((u64)0UL);
+	t__2e1826 = (u64)((u64)t__2e1826 + (u64)((u64)8UL));
+	*(u64 *)t__2e1826 = (u64)((u64)0UL);
+	BLIT((u64)B8, t_object_2e1817, 8);
+	BLIT((u64)B9, t__2e1822, 24);
+	BLIT((u64)B10, t_object_2e1824, 24);
+	t__2e1815 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R11, (u64)B8, (u64)B9, (u64)B10);
+	t_tag_2e1827 = (u64)(*(u32 *)t__2e1815);
+	t__2e1835 = (u64)(u32)(((u32)t_tag_2e1827 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1835) goto L_member_2e1832; else goto L__2e1834;
+	L__2e1834:;
+	t__2e1837 = (u64)(u32)(((u32)t_tag_2e1827 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1837) goto L_member_2e1833; else goto L__2e1836;
+	L__2e1836:;
+	goto L_matches_2e1831;
+	L_member_2e1832:;
+	goto L_matches_2e1831;
+	L_member_2e1833:;
+	goto L_matches_2e1830;
+	L_matches_2e1830:;
+	goto L__2e1828;
+	L_matches_2e1831:;
+	t_abortsite_2e1839 = ((u64)0UL);
+	goto L_abort_2e1840;
+	L__2e1846:;
+	L__2e1829:;
+	t_abortsite_2e1839 = ((u64)1UL);
+	goto L_abort_2e1847;
+	L__2e1828:;
+	goto L__2e1812;
+	L__2e1853:;
+	L__2e1812:;
+	L_after_2e1808:;
+	t__2e1854 = (u64)(*(u64 *)t_binding_2e1809);
+	t__2e1854 = (u64)((u64)t__2e1854 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1809 = (u64)t__2e1854;
+	goto L_loop_2e1804;
+	L__2e1807:;
+	*(u64 *)t_binding_2e1860 = (u64)((u64)0UL);
+	L_loop_2e1855:;
+	t__2e1862 = (u64)(*(u64 *)t_binding_2e1860);
+	t__2e1861 = (u64)(u32)(((u64)t__2e1862 < (u64)((u64)6UL)));
+	if ((u32)t__2e1861) goto L_body_2e1856; else goto L__2e1858;
+	L_body_2e1856:;
+	*(u32 *)t_object_2e1867 = (u32)((u64)3532310079UL);
+	t__2e1868 = (u64)((u64)t_object_2e1867 + (u64)((u64)4UL));
+	*(u32 *)t__2e1868 = (u32)((u64)4UL);
+	t__2e1870 = (u64)(*(u64 *)t_binding_2e1860);
+	t__2e1869 = (u64)((u64)t__2e1870 * (u64)((u64)24UL));
+	t__2e1869 = (u64)((u64)t_binding_2e1789 + (u64)t__2e1869);
+	*(u64 *)t_object_2e1871 = (u64)((u64)0UL);
+	t__2e1872 = (u64)((u64)t_object_2e1871 + (u64)((u64)8UL));
+	*(u64 *)t__2e1872 = (u64)((u64)0UL);
+	t__2e1872 = (u64)((u64)t__2e1872 + (u64)((u64)8UL));
+	*(u64 *)t__2e1872 = (u64)((u64)0UL);
+	BLIT((u64)B12, t_object_2e1867, 8);
+	BLIT((u64)B13, t__2e1869, 24);
+	BLIT((u64)B14, t_object_2e1871, 24);
+	t__2e1866 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R15, (u64)B12, (u64)B13, (u64)B14);
+	t_tag_2e1873 = (u64)(*(u32 *)t__2e1866);
+	t__2e1881 = (u64)(u32)(((u32)t_tag_2e1873 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1881) goto L_member_2e1878; else goto L__2e1880;
+	L__2e1880:;
+	t__2e1883 = (u64)(u32)(((u32)t_tag_2e1873 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1883) goto L_member_2e1879; else goto L__2e1882;
+	L__2e1882:;
+	goto L_matches_2e1877;
+	L_member_2e1878:;
+	goto L_matches_2e1877;
+	L_member_2e1879:;
+	goto L_matches_2e1876;
+	L_matches_2e1876:;
+	goto L__2e1874;
+	L_matches_2e1877:;
+	t_abortsite_2e1839 = ((u64)2UL);
+	goto L_abort_2e1840;
+	L__2e1884:;
+	L__2e1875:;
+	t_abortsite_2e1839 = ((u64)3UL);
+	goto L_abort_2e1847;
+	L__2e1874:;
+	goto L__2e1863;
+	L__2e1885:;
+	L__2e1863:;
+	L_after_2e1859:;
+	t__2e1886 = (u64)(*(u64 *)t_binding_2e1860);
+	t__2e1886 = (u64)((u64)t__2e1886 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1860 = (u64)t__2e1886;
+	goto L_loop_2e1855;
+	L__2e1858:;
+	goto L__2e1776;
+	L__2e1887:;
+	L__2e1776:;
+	return;
+	L_abort_2e1840:;
+	t__2e1841 = (u64)((u64)t_abortsite_2e1839 * (u64)((u64)16UL));
+	t__2e1841 = (u64)((u64)((u64)((char *)&D_abortsites_2e1838)) + (u64)t__2e1841);
+	t__2e1842 = (u64)(*(u64 *)t__2e1841);
+	t__2e1843 = (u64)((u64)t__2e1841 + (u64)((u64)8UL));
+	t__2e1844 = (u64)(*(u32 *)t__2e1843);
+	t__2e1843 = (u64)((u64)t__2e1841 + (u64)((u64)12UL));
+	t__2e1845 = (u64)(*(u32 *)t__2e1843);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1842, (u64)t__2e1844, (u64)t__2e1845, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e1847:;
+	t__2e1848 = (u64)((u64)t_abortsite_2e1839 * (u64)((u64)16UL));
+	t__2e1848 = (u64)((u64)((u64)((char *)&D_abortsites_2e1838)) + (u64)t__2e1848);
+	t__2e1849 = (u64)(*(u64 *)t__2e1848);
+	t__2e1850 = (u64)((u64)t__2e1848 + (u64)((u64)8UL));
+	t__2e1851 = (u64)(*(u32 *)t__2e1850);
+	t__2e1850 = (u64)((u64)t__2e1848 + (u64)((u64)12UL));
+	t__2e1852 = (u64)(*(u32 *)t__2e1850);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1849, (u64)t__2e1851, (u64)t__2e1852, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_control(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	u64 t__2e1899;
+	u64 t__2e1900;
+	u64 t__2e1907;
+	u64 t__2e1917;
+	u64 t__2e1918;
+	u64 t__2e1921;
+	u64 t__2e1922;
+	u64 t__2e1926;
+	u64 t__2e1927;
+	u64 t__2e1928;
+	u64 t__2e1929;
+	u64 t__2e1930;
+	u64 t__2e1937;
+	u64 t__2e1938;
+	u64 t__2e1945;
+	u64 t__2e1953;
+	u64 t__2e1954;
+	u64 t__2e1955;
+	u64 t__2e1956;
+	u64 t__2e1957;
+	u64 t__2e1961;
+	u64 t__2e1963;
+	u64 t__2e1965;
+	u64 t__2e1968;
+	u64 t__2e1969;
+	u64 t_abortsite_2e1924;
+	u64 t_binding_2e1892;
+	u64 t_binding_2e1898;
+	u64 t_binding_2e1936;
+	u64 t_cleanup_2e1912;
+	L_start_2e1888:;
+	t_binding_2e1892 = (u64)A0;
+	t_binding_2e1898 = (u64)A1;
+	t_binding_2e1936 = (u64)A2;
+	L_body_2e1889:;
+	*(u32 *)t_binding_2e1892 = (u32)((u64)0UL);
+	*(u32 *)t_binding_2e1898 = (u32)((u64)0UL);
+	L_loop_2e1893:;
+	t__2e1900 = (u64)(u32)(*(i32 *)t_binding_2e1898);
+	t__2e1899 = (u64)(u32)(((i32)t__2e1900 < (i32)((u64)5UL)));
+	if ((u32)t__2e1899) goto L_body_2e1894; else goto L__2e1896;
+	L_body_2e1894:;
+	t__2e1907 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e1907) goto L_true_2e1904; else goto L_false_2e1905;
+	L_true_2e1904:;
+	goto L_after_2e1897;
+	L__2e1910:;
+	L__2e1908:;
+	L__2e1911:;
+	L_false_2e1905:;
+	L__2e1906:;
+	t_cleanup_2e1912 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e1913;
+	L_resume_2e1914:;
+	goto L__2e1901;
+	L__2e1915:;
+	goto L__2e1916;
+	L_defer_2e1913:;
+	t__2e1917 = (u64)(u32)(*(i32 *)t_binding_2e1892);
+	t__2e1917 = (u64)(u32)((u32)t__2e1917 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1892 = (u32)t__2e1917;
+	goto L_resume_2e1914;
+	L__2e1916:;
+	L__2e1901:;
+	L_after_2e1897:;
+	t__2e1918 = (u64)(u32)(*(i32 *)t_binding_2e1898);
+	t__2e1918 = (u64)(u32)((u32)t__2e1918 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1898 = (u32)t__2e1918;
+	goto L_loop_2e1893;
+	L__2e1896:;
+	t__2e1922 = (u64)(u32)(*(i32 *)t_binding_2e1892);
+	t__2e1921 = (u64)(u32)(((u32)t__2e1922 == (u32)((u64)0UL)));
+	if ((u32)t__2e1921) goto L_passed_2e1920; else goto L_failed_2e1919;
+	L_failed_2e1919:;
+	t_abortsite_2e1924 = ((u64)0UL);
+	goto L_abort_2e1925;
+	L_passed_2e1920:;
+	*(u32 *)t_binding_2e1936 = (u32)((u64)0UL);
+	L_loop_2e1931:;
+	t__2e1938 = (u64)(u32)(*(i32 *)t_binding_2e1936);
+	t__2e1937 = (u64)(u32)(((i32)t__2e1938 < (i32)((u64)5UL)));
+	if ((u32)t__2e1937) goto L_body_2e1932; else goto L__2e1934;
+	L_body_2e1932:;
+	t__2e1945 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e1945) goto L_true_2e1942; else goto L_false_2e1943;
+	L_true_2e1942:;
+	t_cleanup_2e1912 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e1948;
+	L_resume_2e1949:;
+	goto L__2e1934;
+	L__2e1950:;
+	L__2e1946:;
+	L__2e1951:;
+	L_false_2e1943:;
+	L__2e1944:;
+	t_abortsite_2e1924 = ((u64)1UL);
+	goto L_abort_2e1952;
+	L__2e1959:;
+	goto L__2e1960;
+	L_defer_2e1948:;
+	t__2e1961 = (u64)(u32)(*(i32 *)t_binding_2e1892);
+	t__2e1961 = (u64)(u32)((u32)t__2e1961 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1892 = (u32)t__2e1961;
+	t__2e1963 = (u64)(u32)(((u32)t_cleanup_2e1912 == (u32)((u64)2UL)));
+	if ((u32)t__2e1963) goto L_resume_2e1958; else goto L__2e1962;
+	L__2e1962:;
+	goto L_resume_2e1949;
+	L__2e1960:;
+	L__2e1939:;
+	L__2e1964:;
+	L_after_2e1935:;
+	t__2e1965 = (u64)(u32)(*(i32 *)t_binding_2e1936);
+	t__2e1965 = (u64)(u32)((u32)t__2e1965 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1936 = (u32)t__2e1965;
+	goto L_loop_2e1931;
+	L__2e1934:;
+	t__2e1969 = (u64)(u32)(*(i32 *)t_binding_2e1892);
+	t__2e1968 = (u64)(u32)(((u32)t__2e1969 == (u32)((u64)1UL)));
+	if ((u32)t__2e1968) goto L_passed_2e1967; else goto L_failed_2e1966;
+	L_failed_2e1966:;
+	t_abortsite_2e1924 = ((u64)2UL);
+	goto L_abort_2e1925;
+	L_passed_2e1967:;
+	t_cleanup_2e1912 = (u64)(u32)((u64)3UL);
+	goto L_defer_2e1970;
+	L_resume_2e1971:;
+	goto L__2e1890;
+	L__2e1972:;
+	goto L__2e1973;
+	L_defer_2e1970:;
+	L_loop_2e1976:;
+	if ((u32)((u64)1UL)) goto L_body_2e1977; else goto L__2e1979;
+	L_body_2e1977:;
+	goto L__2e1979;
+	L__2e1981:;
+	L_after_2e1980:;
+	goto L_loop_2e1976;
+	L__2e1979:;
+	L_loop_2e1982:;
+	if ((u32)((u64)0UL)) goto L_body_2e1983; else goto L__2e1985;
+	L_body_2e1983:;
+	goto L_after_2e1986;
+	L__2e1987:;
+	L_after_2e1986:;
+	goto L_loop_2e1982;
+	L__2e1985:;
+	goto L__2e1974;
+	L__2e1988:;
+	L__2e1974:;
+	goto L__2e1989;
+	L__2e1991:;
+	L__2e1989:;
+	goto L_resume_2e1971;
+	L__2e1973:;
+	L__2e1890:;
+	return;
+	L_abort_2e1925:;
+	t__2e1926 = (u64)((u64)t_abortsite_2e1924 * (u64)((u64)16UL));
+	t__2e1926 = (u64)((u64)((u64)((char *)&D_abortsites_2e1923)) + (u64)t__2e1926);
+	t__2e1927 = (u64)(*(u64 *)t__2e1926);
+	t__2e1928 = (u64)((u64)t__2e1926 + (u64)((u64)8UL));
+	t__2e1929 = (u64)(*(u32 *)t__2e1928);
+	t__2e1928 = (u64)((u64)t__2e1926 + (u64)((u64)12UL));
+	t__2e1930 = (u64)(*(u32 *)t__2e1928);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1927, (u64)t__2e1929, (u64)t__2e1930, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1952:;
+	t__2e1953 = (u64)((u64)t_abortsite_2e1924 * (u64)((u64)16UL));
+	t__2e1953 = (u64)((u64)((u64)((char *)&D_abortsites_2e1923)) + (u64)t__2e1953);
+	t__2e1954 = (u64)(*(u64 *)t__2e1953);
+	t__2e1955 = (u64)((u64)t__2e1953 + (u64)((u64)8UL));
+	t__2e1956 = (u64)(*(u32 *)t__2e1955);
+	t__2e1955 = (u64)((u64)t__2e1953 + (u64)((u64)12UL));
+	t__2e1957 = (u64)(*(u32 *)t__2e1955);
+	t_cleanup_2e1912 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e1948;
+	L_resume_2e1958:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1954, (u64)t__2e1956, (u64)t__2e1957, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_loops(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e2003;
+	u64 t__2e2004;
+	u64 t__2e2009;
+	u64 t__2e2010;
+	u64 t__2e2011;
+	u64 t__2e2015;
+	u64 t__2e2016;
+	u64 t__2e2017;
+	u64 t__2e2018;
+	u64 t__2e2019;
+	u64 t__2e2026;
+	u64 t__2e2028;
+	u64 t__2e2029;
+	u64 t__2e2032;
+	u64 t__2e2033;
+	u64 t__2e2035;
+	u64 t__2e2036;
+	u64 t__2e2037;
+	u64 t__2e2038;
+	u64 t__2e2039;
+	u64 t_abortsite_2e2013;
+	u64 t_binding_2e1996;
+	u64 t_binding_2e2002;
+	u64 t_cleanup_2e2020;
+	L_start_2e1992:;
+	t_binding_2e1996 = (u64)A0;
+	t_binding_2e2002 = (u64)A1;
+	L_body_2e1993:;
+	*(u32 *)t_binding_2e1996 = (u32)((u64)0UL);
+	*(u32 *)t_binding_2e2002 = (u32)((u64)0UL);
+	L_loop_2e1997:;
+	t__2e2004 = (u64)(u32)(*(i32 *)t_binding_2e2002);
+	t__2e2003 = (u64)(u32)(((i32)t__2e2004 < (i32)((u64)5UL)));
+	if ((u32)t__2e2003) goto L_body_2e1998; else goto L__2e2000;
+	L_body_2e1998:;
+	t__2e2010 = (u64)(u32)(*(i32 *)t_binding_2e1996);
+	t__2e2011 = (u64)(u32)(*(i32 *)t_binding_2e2002);
+	t__2e2009 = (u64)(u32)(((u32)t__2e2010 == (u32)t__2e2011));
+	if ((u32)t__2e2009) goto L_passed_2e2008; else goto L_failed_2e2007;
+	L_failed_2e2007:;
+	t_abortsite_2e2013 = ((u64)0UL);
+	goto L_abort_2e2014;
+	L_passed_2e2008:;
+	t_cleanup_2e2020 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e2021;
+	L_resume_2e2023:;
+	goto L__2e2005;
+	L__2e2024:;
+	goto L__2e2025;
+	L_defer_2e2021:;
+	t__2e2026 = (u64)(u32)(*(i32 *)t_binding_2e1996);
+	t__2e2026 = (u64)(u32)((u32)t__2e2026 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e1996 = (u32)t__2e2026;
+	t__2e2028 = (u64)(u32)(((u32)t_cleanup_2e2020 == (u32)((u64)1UL)));
+	if ((u32)t__2e2028) goto L_resume_2e2023; else goto L__2e2027;
+	L__2e2027:;
+	goto L_resume_2e2022;
+	L__2e2025:;
+	L__2e2005:;
+	L_after_2e2001:;
+	t__2e2029 = (u64)(u32)(*(i32 *)t_binding_2e2002);
+	t__2e2029 = (u64)(u32)((u32)t__2e2029 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e2002 = (u32)t__2e2029;
+	goto L_loop_2e1997;
+	L__2e2000:;
+	t__2e2033 = (u64)(u32)(*(i32 *)t_binding_2e1996);
+	t__2e2032 = (u64)(u32)(((u32)t__2e2033 == (u32)((u64)5UL)));
+	if ((u32)t__2e2032) goto L_passed_2e2031; else goto L_failed_2e2030;
+	L_failed_2e2030:;
+	t_abortsite_2e2013 = ((u64)1UL);
+	goto L_abort_2e2034;
+	L_passed_2e2031:;
+	goto L__2e1994;
+	L__2e2040:;
+	L__2e1994:;
+	return;
+	L_abort_2e2014:;
+	t__2e2015 = (u64)((u64)t_abortsite_2e2013 * (u64)((u64)16UL));
+	t__2e2015 = (u64)((u64)((u64)((char *)&D_abortsites_2e2012)) + (u64)t__2e2015);
+	t__2e2016 = (u64)(*(u64 *)t__2e2015);
+	t__2e2017 = (u64)((u64)t__2e2015 + (u64)((u64)8UL));
+	t__2e2018 = (u64)(*(u32 *)t__2e2017);
+	t__2e2017 = (u64)((u64)t__2e2015 + (u64)((u64)12UL));
+	t__2e2019 = (u64)(*(u32 *)t__2e2017);
+	t_cleanup_2e2020 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e2021;
+	L_resume_2e2022:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2016, (u64)t__2e2018, (u64)t__2e2019, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e2034:;
+	t__2e2035 = (u64)((u64)t_abortsite_2e2013 * (u64)((u64)16UL));
+	t__2e2035 = (u64)((u64)((u64)((char *)&D_abortsites_2e2012)) + (u64)t__2e2035);
+	t__2e2036 = (u64)(*(u64 *)t__2e2035);
+	t__2e2037 = (u64)((u64)t__2e2035 + (u64)((u64)8UL));
+	t__2e2038 = (u64)(*(u32 *)t__2e2037);
+	t__2e2037 = (u64)((u64)t__2e2035 + (u64)((u64)12UL));
+	t__2e2039 = (u64)(*(u32 *)t__2e2037);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2036, (u64)t__2e2038, (u64)t__2e2039, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_scope(void) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e2050;
+	u64 t__2e2051;
+	u64 t__2e2055;
+	u64 t__2e2056;
+	u64 t__2e2057;
+	u64 t__2e2058;
+	u64 t__2e2059;
+	u64 t__2e2067;
+	u64 t__2e2070;
+	u64 t__2e2071;
+	u64 t__2e2073;
+	u64 t__2e2074;
+	u64 t__2e2075;
+	u64 t__2e2076;
+	u64 t__2e2077;
+	u64 t_abortsite_2e2053;
+	u64 t_binding_2e2045;
+	u64 t_cleanup_2e2060;
+	L_start_2e2041:;
+	t_binding_2e2045 = (u64)A0;
+	L_body_2e2042:;
+	*(u32 *)t_binding_2e2045 = (u32)((u64)10UL);
+	t__2e2051 = (u64)(u32)(*(i32 *)t_binding_2e2045);
+	t__2e2050 = (u64)(u32)(((u32)t__2e2051 == (u32)((u64)10UL)));
+	if ((u32)t__2e2050) goto L_passed_2e2049; else goto L_failed_2e2048;
+	L_failed_2e2048:;
+	t_abortsite_2e2053 = ((u64)0UL);
+	goto L_abort_2e2054;
+	L_passed_2e2049:;
+	t_cleanup_2e2060 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e2061;
+	L_resume_2e2063:;
+	goto L__2e2046;
+	L__2e2064:;
+	goto L__2e2065;
+	L_defer_2e2061:;
+	*(u32 *)t_binding_2e2045 = (u32)((u64)20UL);
+	t__2e2067 = (u64)(u32)(((u32)t_cleanup_2e2060 == (u32)((u64)1UL)));
+	if ((u32)t__2e2067) goto L_resume_2e2063; else goto L__2e2066;
+	L__2e2066:;
+	goto L_resume_2e2062;
+	L__2e2065:;
+	L__2e2046:;
+	t__2e2071 = (u64)(u32)(*(i32 *)t_binding_2e2045);
+	t__2e2070 = (u64)(u32)(((u32)t__2e2071 == (u32)((u64)20UL)));
+	if ((u32)t__2e2070) goto L_passed_2e2069; else goto L_failed_2e2068;
+	L_failed_2e2068:;
+	t_abortsite_2e2053 = ((u64)1UL);
+	goto L_abort_2e2072;
+	L_passed_2e2069:;
+	goto L__2e2043;
+	L__2e2078:;
+	L__2e2043:;
+	return;
+	L_abort_2e2054:;
+	t__2e2055 = (u64)((u64)t_abortsite_2e2053 * (u64)((u64)16UL));
+	t__2e2055 = (u64)((u64)((u64)((char *)&D_abortsites_2e2052)) + (u64)t__2e2055);
+	t__2e2056 = (u64)(*(u64 *)t__2e2055);
+	t__2e2057 = (u64)((u64)t__2e2055 + (u64)((u64)8UL));
+	t__2e2058 = (u64)(*(u32 *)t__2e2057);
+	t__2e2057 = (u64)((u64)t__2e2055 + (u64)((u64)12UL));
+	t__2e2059 = (u64)(*(u32 *)t__2e2057);
+	t_cleanup_2e2060 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e2061;
+	L_resume_2e2062:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2056, (u64)t__2e2058, (u64)t__2e2059, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e2072:;
+	t__2e2073 = (u64)((u64)t_abortsite_2e2053 * (u64)((u64)16UL));
+	t__2e2073 = (u64)((u64)((u64)((char *)&D_abortsites_2e2052)) + (u64)t__2e2073);
+	t__2e2074 = (u64)(*(u64 *)t__2e2073);
+	t__2e2075 = (u64)((u64)t__2e2073 + (u64)((u64)8UL));
+	t__2e2076 = (u64)(*(u32 *)t__2e2075);
+	t__2e2075 = (u64)((u64)t__2e2073 + (u64)((u64)12UL));
+	t__2e2077 = (u64)(*(u32 *)t__2e2075);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2074, (u64)t__2e2076, (u64)t__2e2077, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_basics(void) {
+	u64 t__2e2085;
+	u64 t__2e2086;
+	u64 t__2e2090;
+	u64 t__2e2091;
+	u64 t__2e2092;
+	u64 t__2e2093;
+	u64 t__2e2094;
+	u64 t__2e2097;
+	u64 t__2e2098;
+	u64 t__2e2100;
+	u64 t__2e2101;
+	u64 t__2e2102;
+	u64 t__2e2103;
+	u64 t__2e2104;
+	u64 t__2e2112;
+	u64 t__2e2123;
+	u64 t__2e2125;
+	u64 t_abortsite_2e2088;
+	u64 t_cleanup_2e2105;
+	L_start_2e2079:;
+	L_body_2e2080:;
+	t__2e2086 = (u64)(u32)(*(i32 *)((u64)((char *)&D_x)));
+	t__2e2085 = (u64)(u32)(((u32)t__2e2086 == (u32)((u64)10UL)));
+	if ((u32)t__2e2085) goto L_passed_2e2084; else goto L_failed_2e2083;
+	L_failed_2e2083:;
+	t_abortsite_2e2088 = ((u64)0UL);
+	goto L_abort_2e2089;
+	L_passed_2e2084:;
+	t__2e2098 = (u64)(u32)(*(i32 *)((u64)((char *)&D_x)));
+	t__2e2097 = (u64)(u32)(((u32)t__2e2098 == (u32)((u64)10UL)));
+	if ((u32)t__2e2097) goto L_passed_2e2096; else goto L_failed_2e2095;
+	L_failed_2e2095:;
+	t_abortsite_2e2088 = ((u64)1UL);
+	goto L_abort_2e2099;
+	L_passed_2e2096:;
+	t__2e2112 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e2112) goto L_true_2e2109; else goto L_false_2e2110;
+	L_true_2e2109:;
+	t_cleanup_2e2105 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e2106;
+	L_resume_2e2115:;
+	return;
+	L__2e2116:;
+	L__2e2113:;
+	L__2e2117:;
+	L_false_2e2110:;
+	L__2e2111:;
+	t_cleanup_2e2105 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e2118;
+	L_resume_2e2119:;
+	goto L__2e2081;
+	L__2e2120:;
+	goto L__2e2121;
+	L_defer_2e2118:;
+	*(u32 *)((u64)((char *)&D_x)) = (u32)((u64)30UL);
+	L_defer_2e2106:;
+	*(u32 *)((u64)((char *)&D_x)) = (u32)((u64)20UL);
+	t__2e2123 = (u64)(u32)(((u32)t_cleanup_2e2105 == (u32)((u64)2UL)));
+	if ((u32)t__2e2123) goto L_resume_2e2119; else goto L__2e2122;
+	L__2e2122:;
+	t__2e2125 = (u64)(u32)(((u32)t_cleanup_2e2105 == (u32)((u64)1UL)));
+	if ((u32)t__2e2125) goto L_resume_2e2115; else goto L__2e2124;
+	L__2e2124:;
+	goto L_resume_2e2107;
+	L__2e2121:;
+	L__2e2081:;
+	return;
+	L_abort_2e2089:;
+	t__2e2090 = (u64)((u64)t_abortsite_2e2088 * (u64)((u64)16UL));
+	t__2e2090 = (u64)((u64)((u64)((char *)&D_abortsites_2e2087)) + (u64)t__2e2090);
+	t__2e2091 = (u64)(*(u64 *)t__2e2090);
+	t__2e2092 = (u64)((u64)t__2e2090 + (u64)((u64)8UL));
+	t__2e2093 = (u64)(*(u32 *)t__2e2092);
+	t__2e2092 = (u64)((u64)t__2e2090 + (u64)((u64)12UL));
+	t__2e2094 = (u64)(*(u32 *)t__2e2092);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2091, (u64)t__2e2093, (u64)t__2e2094, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e2099:;
+	t__2e2100 = (u64)((u64)t_abortsite_2e2088 * (u64)((u64)16UL));
+	t__2e2100 = (u64)((u64)((u64)((char *)&D_abortsites_2e2087)) + (u64)t__2e2100);
+	t__2e2101 = (u64)(*(u64 *)t__2e2100);
+	t__2e2102 = (u64)((u64)t__2e2100 + (u64)((u64)8UL));
+	t__2e2103 = (u64)(*(u32 *)t__2e2102);
+	t__2e2102 = (u64)((u64)t__2e2100 + (u64)((u64)12UL));
+	t__2e2104 = (u64)(*(u32 *)t__2e2102);
+	t_cleanup_2e2105 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e2106;
+	L_resume_2e2107:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e2101, (u64)t__2e2103, (u64)t__2e2104, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,2869 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2efree[] __asm__("rt.free");
+extern char X_rt_2emalloc[] __asm__("rt.malloc");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e44 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; };
+struct __attribute__((packed)) S_abortsites_2e239 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e268 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e300 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_kept__items { u64 f0; };
+struct __attribute__((packed)) S_kept { u64 f0; };
+struct __attribute__((packed)) S_abortsites_2e318 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e366 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e414 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; };
+struct __attribute__((packed)) S_abortsites_2e605 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; };
+struct __attribute__((packed)) S_abortsites_2e956 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e1013 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e1057 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e1101 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_abortsites_2e1182 { char *f0; u32 f1; u32 f2; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e44 D_abortsites_2e44 __asm__("abortsites.44") __attribute__((used, section(".data.rel.ro.abortsites.44"), aligned(8)));
+static struct S_abortsites_2e239 D_abortsites_2e239 __asm__("abortsites.239") __attribute__((used, section(".data.rel.ro.abortsites.239"), aligned(8)));
+static struct S_abortsites_2e268 D_abortsites_2e268 __asm__("abortsites.268") __attribute__((used, section(".data.rel.ro.abortsites.268"), aligned(8)));
+static struct S_abortsites_2e300 D_abortsites_2e300 __asm__("abortsites.300") __attribute__((used, section(".data.rel.ro.abortsites.300"), aligned(8)));
+static struct S_kept__items D_kept__items __asm__("kept_items") __attribute__((used, section(".bss.kept_items"), aligned(8)));
+static struct S_kept D_kept __asm__("kept") __attribute__((used, section(".bss.kept"), aligned(8)));
+static struct S_abortsites_2e318 D_abortsites_2e318 __asm__("abortsites.318") __attribute__((used, section(".data.rel.ro.abortsites.318"), aligned(8)));
+static struct S_abortsites_2e366 D_abortsites_2e366 __asm__("abortsites.366") __attribute__((used, section(".data.rel.ro.abortsites.366"), aligned(8)));
+static struct S_abortsites_2e414 D_abortsites_2e414 __asm__("abortsites.414") __attribute__((used, section(".data.rel.ro.abortsites.414"), aligned(8)));
+static struct S_abortsites_2e605 D_abortsites_2e605 __asm__("abortsites.605") __attribute__((used, section(".data.rel.ro.abortsites.605"), aligned(8)));
+static struct S_abortsites_2e956 D_abortsites_2e956 __asm__("abortsites.956") __attribute__((used, section(".data.rel.ro.abortsites.956"), aligned(8)));
+static struct S_abortsites_2e1013 D_abortsites_2e1013 __asm__("abortsites.1013") __attribute__((used, section(".data.rel.ro.abortsites.1013"), aligned(8)));
+static struct S_abortsites_2e1057 D_abortsites_2e1057 __asm__("abortsites.1057") __attribute__((used, section(".data.rel.ro.abortsites.1057"), aligned(8)));
+static struct S_abortsites_2e1101 D_abortsites_2e1101 __asm__("abortsites.1101") __attribute__((used, section(".data.rel.ro.abortsites.1101"), aligned(8)));
+static struct S_abortsites_2e1182 D_abortsites_2e1182 __asm__("abortsites.1182") __attribute__((used, section(".data.rel.ro.abortsites.1182"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_local(void) __asm__("local") __attribute__((used, section(".text.local")));
+static u64 F_sliced__field(u64 __rp) __asm__("sliced_field") __attribute__((used, section(".text.sliced_field")));
+static u64 F_keep(u64 __rp, u64 p_s) __asm__("keep") __attribute__((used, section(".text.keep")));
+static u64 F_sliced(u64 __rp) __asm__("sliced") __attribute__((used, section(".text.sliced")));
+static void F_local__clobber(void) __asm__("local_clobber") __attribute__((used, section(".text.local_clobber")));
+static u64 F_escaping(void) __asm__("escaping") __attribute__((used, section(".text.escaping")));
+static void F___null(void) __asm__("_null") __attribute__((used, section(".text._null")));
+static void F_string(void) __asm__("string") __attribute__((used, section(".text.string")));
+static void F_slice__copy(void) __asm__("slice_copy") __attribute__((used, section(".text.slice_copy")));
+static void F_slice(void) __asm__("slice") __attribute__((used, section(".text.slice")));
+static void F_array(void) __asm__("array") __attribute__((used, section(".text.array")));
+static void F_double__alloc(void) __asm__("double_alloc") __attribute__((used, section(".text.double_alloc")));
+static void F_double__pointer(void) __asm__("double_pointer") __attribute__((used, section(".text.double_pointer")));
+static void F_allocation(void) __asm__("allocation") __attribute__((used, section(".text.allocation")));
+static void F_assignment(void) __asm__("assignment") __attribute__((used, section(".text.assignment")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\061\067\055\141\154\154\157\143\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 17U, 17U };
+static struct S_abortsites_2e44 D_abortsites_2e44 = { (char *)((char *)&D_strliteral_2e1) + 0, 208U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 209U, 41U, (char *)((char *)&D_strliteral_2e1) + 0, 211U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 215U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 216U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 217U, 34U, (char *)((char *)&D_strliteral_2e1) + 0, 219U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 226U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 226U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 226U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 227U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 227U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 227U, 15U };
+static struct S_abortsites_2e239 D_abortsites_2e239 = { (char *)((char *)&D_strliteral_2e1) + 0, 196U, 17U };
+static struct S_abortsites_2e268 D_abortsites_2e268 = { (char *)((char *)&D_strliteral_2e1) + 0, 188U, 26U };
+static struct S_abortsites_2e300 D_abortsites_2e300 = { (char *)((char *)&D_strliteral_2e1) + 0, 234U, 15U };
+static struct S_kept__items D_kept__items = { 0U };
+static struct S_kept D_kept = { 0U };
+static struct S_abortsites_2e318 D_abortsites_2e318 = { (char *)((char *)&D_strliteral_2e1) + 0, 175U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 176U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 178U, 17U };
+static struct S_abortsites_2e366 D_abortsites_2e366 = { (char *)((char *)&D_strliteral_2e1) + 0, 151U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 156U, 15U };
+static struct S_abortsites_2e414 D_abortsites_2e414 = { (char *)((char *)&D_strliteral_2e1) + 0, 129U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 131U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 132U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 139U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 141U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 145U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 145U, 23U };
+static struct S_abortsites_2e605 D_abortsites_2e605 = { (char *)((char *)&D_strliteral_2e1) + 0, 88U, 25U, (char *)((char *)&D_strliteral_2e1) + 0, 88U, 25U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 91U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 95U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 96U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 98U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 113U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 113U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 114U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 114U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 121U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 121U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 123U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 123U, 45U, (char *)((char *)&D_strliteral_2e1) + 0, 123U, 15U };
+static struct S_abortsites_2e956 D_abortsites_2e956 = { (char *)((char *)&D_strliteral_2e1) + 0, 77U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 80U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 82U, 23U };
+static struct S_abortsites_2e1013 D_abortsites_2e1013 = { (char *)((char *)&D_strliteral_2e1) + 0, 57U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 58U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 15U };
+static struct S_abortsites_2e1057 D_abortsites_2e1057 = { (char *)((char *)&D_strliteral_2e1) + 0, 46U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 49U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 15U };
+static struct S_abortsites_2e1101 D_abortsites_2e1101 = { (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 18U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 22U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 26U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 30U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 34U, 15U };
+static struct S_abortsites_2e1182 D_abortsites_2e1182 = { (char *)((char *)&D_strliteral_2e1) + 0, 41U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_assignment)))();
+	((void (*)(void))((u64)((char *)&F_allocation)))();
+	((void (*)(void))((u64)((char *)&F_double__pointer)))();
+	((void (*)(void))((u64)((char *)&F_double__alloc)))();
+	((void (*)(void))((u64)((char *)&F_array)))();
+	((void (*)(void))((u64)((char *)&F_slice)))();
+	((void (*)(void))((u64)((char *)&F_slice__copy)))();
+	((void (*)(void))((u64)((char *)&F_string)))();
+	((void (*)(void))((u64)((char *)&F___null)))();
+	((void (*)(void))((u64)((char *)&F_local)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_local(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[20] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char R8[24] __attribute__((aligned(16)));
+	char R9[24] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e101;
+	u64 t__2e102;
+	u64 t__2e104;
+	u64 t__2e105;
+	u64 t__2e106;
+	u64 t__2e108;
+	u64 t__2e109;
+	u64 t__2e110;
+	u64 t__2e112;
+	u64 t__2e115;
+	u64 t__2e117;
+	u64 t__2e118;
+	u64 t__2e119;
+	u64 t__2e120;
+	u64 t__2e121;
+	u64 t__2e123;
+	u64 t__2e126;
+	u64 t__2e129;
+	u64 t__2e132;
+	u64 t__2e135;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e139;
+	u64 t__2e140;
+	u64 t__2e141;
+	u64 t__2e142;
+	u64 t__2e143;
+	u64 t__2e144;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e147;
+	u64 t__2e148;
+	u64 t__2e149;
+	u64 t__2e150;
+	u64 t__2e152;
+	u64 t__2e155;
+	u64 t__2e158;
+	u64 t__2e161;
+	u64 t__2e162;
+	u64 t__2e163;
+	u64 t__2e164;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e167;
+	u64 t__2e168;
+	u64 t__2e169;
+	u64 t__2e170;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t__2e176;
+	u64 t__2e177;
+	u64 t__2e178;
+	u64 t__2e179;
+	u64 t__2e18;
+	u64 t__2e180;
+	u64 t__2e181;
+	u64 t__2e182;
+	u64 t__2e183;
+	u64 t__2e184;
+	u64 t__2e185;
+	u64 t__2e186;
+	u64 t__2e187;
+	u64 t__2e188;
+	u64 t__2e189;
+	u64 t__2e19;
+	u64 t__2e192;
+	u64 t__2e195;
+	u64 t__2e198;
+	u64 t__2e201;
+	u64 t__2e202;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e205;
+	u64 t__2e206;
+	u64 t__2e207;
+	u64 t__2e208;
+	u64 t__2e209;
+	u64 t__2e210;
+	u64 t__2e211;
+	u64 t__2e212;
+	u64 t__2e215;
+	u64 t__2e216;
+	u64 t__2e217;
+	u64 t__2e218;
+	u64 t__2e219;
+	u64 t__2e220;
+	u64 t__2e221;
+	u64 t__2e222;
+	u64 t__2e223;
+	u64 t__2e226;
+	u64 t__2e227;
+	u64 t__2e228;
+	u64 t__2e23;
+	u64 t__2e27;
+	u64 t__2e29;
+	u64 t__2e30;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t__2e33;
+	u64 t__2e34;
+	u64 t__2e35;
+	u64 t__2e36;
+	u64 t__2e38;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e47;
+	u64 t__2e48;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e51;
+	u64 t__2e55;
+	u64 t__2e56;
+	u64 t__2e57;
+	u64 t__2e58;
+	u64 t__2e60;
+	u64 t__2e61;
+	u64 t__2e63;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e66;
+	u64 t__2e69;
+	u64 t__2e74;
+	u64 t__2e75;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e81;
+	u64 t__2e82;
+	u64 t__2e83;
+	u64 t__2e84;
+	u64 t__2e85;
+	u64 t__2e87;
+	u64 t__2e89;
+	u64 t__2e92;
+	u64 t__2e95;
+	u64 t__2e98;
+	u64 t__2e99;
+	u64 t_abortsite_2e45;
+	u64 t_binding_2e11;
+	u64 t_binding_2e111;
+	u64 t_binding_2e122;
+	u64 t_binding_2e17;
+	u64 t_binding_2e22;
+	u64 t_binding_2e86;
+	u64 t_binding_2e88;
+	u64 t_cleanup_2e52;
+	u64 t_field_2e103;
+	u64 t_field_2e107;
+	u64 t_field_2e26;
+	u64 t_field_2e37;
+	u64 t_field_2e59;
+	u64 t_field_2e62;
+	u64 t_item_2e28;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	t_binding_2e17 = (u64)A1;
+	t_binding_2e22 = (u64)A2;
+	t__2e23 = (u64)A3;
+	t_binding_2e86 = (u64)A4;
+	t_binding_2e88 = (u64)A5;
+	t_binding_2e111 = (u64)A6;
+	t_binding_2e122 = (u64)A7;
+	L_body_2e8:;
+	*(u32 *)t_binding_2e11 = (u32)((u64)0UL);
+	*(u32 *)t_binding_2e17 = (u32)((u64)0UL);
+	L_loop_2e12:;
+	t__2e19 = (u64)(u32)(*(i32 *)t_binding_2e17);
+	t__2e18 = (u64)(u32)(((i32)t__2e19 < (i32)((u64)4UL)));
+	if ((u32)t__2e18) goto L_body_2e13; else goto L__2e15;
+	L_body_2e13:;
+	t_field_2e26 = (u64)((u64)t__2e23 + (u64)((u64)0UL));
+	t__2e27 = (u64)(u32)(*(i32 *)t_binding_2e17);
+	*(u32 *)t_field_2e26 = (u32)t__2e27;
+	t_field_2e26 = (u64)((u64)t__2e23 + (u64)((u64)4UL));
+	t_item_2e28 = (u64)((u64)t_field_2e26 + (u64)((u64)0UL));
+	t__2e29 = (u64)(u32)(*(i32 *)t_binding_2e17);
+	*(u32 *)t_item_2e28 = (u32)t__2e29;
+	t_item_2e28 = (u64)((u64)t_field_2e26 + (u64)((u64)4UL));
+	t__2e31 = (u64)(u32)(*(i32 *)t_binding_2e17);
+	t__2e30 = (u64)(u32)((u32)t__2e31 + (u32)((u64)1UL));
+	*(u32 *)t_item_2e28 = (u32)t__2e30;
+	t_item_2e28 = (u64)((u64)t_field_2e26 + (u64)((u64)8UL));
+	t__2e33 = (u64)(u32)(*(i32 *)t_binding_2e17);
+	t__2e32 = (u64)(u32)((u32)t__2e33 + (u32)((u64)2UL));
+	*(u32 *)t_item_2e28 = (u32)t__2e32;
+	t_item_2e28 = (u64)((u64)t_field_2e26 + (u64)((u64)12UL));
+	t__2e35 = (u64)(u32)(*(i32 *)t_binding_2e17);
+	t__2e34 = (u64)(u32)((u32)t__2e35 + (u32)((u64)3UL));
+	*(u32 *)t_item_2e28 = (u32)t__2e34;
+	*(u64 *)t_binding_2e22 = (u64)t__2e23;
+	t__2e36 = (u64)(*(u64 *)t_binding_2e22);
+	t_field_2e37 = (u64)((u64)t__2e36 + (u64)((u64)4UL));
+	t__2e39 = (u64)(u32)(*(i32 *)t_binding_2e17);
+	t__2e40 = (u64)((i64)(i32)t__2e39);
+	t__2e38 = (u64)((u64)t__2e40 * (u64)((u64)4UL));
+	t__2e38 = (u64)((u64)t_field_2e37 + (u64)t__2e38);
+	t__2e41 = (u64)(u32)(((u64)t__2e40 < (u64)((u64)4UL)));
+	if ((u32)t__2e41) goto L__2e43; else goto L__2e42;
+	L__2e42:;
+	t_abortsite_2e45 = ((u64)0UL);
+	goto L_abort_2e46;
+	L__2e43:;
+	t__2e55 = (u64)(u32)(*(i32 *)t__2e38);
+	t__2e55 = (u64)(u32)((u32)t__2e55 + (u32)((u64)10UL));
+	*(u32 *)t__2e38 = (u32)t__2e55;
+	t__2e56 = (u64)(u32)(*(i32 *)t_binding_2e11);
+	t__2e58 = (u64)(*(u64 *)t_binding_2e22);
+	t_field_2e59 = (u64)((u64)t__2e58 + (u64)((u64)0UL));
+	t__2e60 = (u64)(u32)(*(i32 *)t_field_2e59);
+	t__2e61 = (u64)(*(u64 *)t_binding_2e22);
+	t_field_2e62 = (u64)((u64)t__2e61 + (u64)((u64)4UL));
+	t__2e64 = (u64)(u32)(*(i32 *)t_binding_2e17);
+	t__2e65 = (u64)((i64)(i32)t__2e64);
+	t__2e63 = (u64)((u64)t__2e65 * (u64)((u64)4UL));
+	t__2e63 = (u64)((u64)t_field_2e62 + (u64)t__2e63);
+	t__2e66 = (u64)(u32)(((u64)t__2e65 < (u64)((u64)4UL)));
+	if ((u32)t__2e66) goto L__2e68; else goto L__2e67;
+	L__2e67:;
+	t_abortsite_2e45 = ((u64)1UL);
+	goto L_abort_2e46;
+	L__2e68:;
+	t__2e69 = (u64)(u32)(*(i32 *)t__2e63);
+	t__2e57 = (u64)(u32)((u32)t__2e60 + (u32)t__2e69);
+	t__2e56 = (u64)(u32)((u32)t__2e56 + (u32)t__2e57);
+	*(u32 *)t_binding_2e11 = (u32)t__2e56;
+	t_cleanup_2e52 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e53;
+	L_resume_2e70:;
+	goto L__2e20;
+	L__2e71:;
+	goto L__2e72;
+	L_defer_2e53:;
+	t__2e74 = (u64)(u32)(((u32)t_cleanup_2e52 == (u32)((u64)1UL)));
+	if ((u32)t__2e74) goto L_resume_2e70; else goto L__2e73;
+	L__2e73:;
+	goto L_resume_2e54;
+	L__2e72:;
+	L__2e20:;
+	L_after_2e16:;
+	t__2e75 = (u64)(u32)(*(i32 *)t_binding_2e17);
+	t__2e75 = (u64)(u32)((u32)t__2e75 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e17 = (u32)t__2e75;
+	goto L_loop_2e12;
+	L__2e15:;
+	t__2e79 = (u64)(u32)(*(i32 *)t_binding_2e11);
+	t__2e78 = (u64)(u32)(((u32)t__2e79 == (u32)((u64)58UL)));
+	if ((u32)t__2e78) goto L_passed_2e77; else goto L_failed_2e76;
+	L_failed_2e76:;
+	t_abortsite_2e45 = ((u64)2UL);
+	goto L_abort_2e80;
+	L_passed_2e77:;
+	t__2e87 = (u64)(((u64 (*)(void))((u64)((char *)&F_escaping)))());
+	*(u64 *)t_binding_2e86 = (u64)t__2e87;
+	t__2e89 = (u64)(((u64 (*)(void))((u64)((char *)&F_escaping)))());
+	*(u64 *)t_binding_2e88 = (u64)t__2e89;
+	t__2e99 = (u64)(*(u64 *)t_binding_2e86);
+	t__2e100 = (u64)(*(u64 *)t_binding_2e88);
+	t__2e98 = (u64)(u32)(((u64)t__2e99 != (u64)t__2e100));
+	t__2e95 = (u64)(u32)t__2e98;
+	if ((u32)t__2e95) goto L__2e96; else goto L__2e97;
+	L__2e96:;
+	t__2e102 = (u64)(*(u64 *)t_binding_2e86);
+	t_field_2e103 = (u64)((u64)t__2e102 + (u64)((u64)0UL));
+	t__2e104 = (u64)(u32)(*(i32 *)t_field_2e103);
+	t__2e101 = (u64)(u32)(((u32)t__2e104 == (u32)((u64)1UL)));
+	t__2e95 = (u64)(u32)t__2e101;
+	goto L__2e97;
+	L__2e97:;
+	t__2e92 = (u64)(u32)t__2e95;
+	if ((u32)t__2e92) goto L__2e93; else goto L__2e94;
+	L__2e93:;
+	t__2e106 = (u64)(*(u64 *)t_binding_2e86);
+	t_field_2e107 = (u64)((u64)t__2e106 + (u64)((u64)4UL));
+	t__2e109 = (u64)((i64)(i32)((u64)3UL));
+	t__2e108 = (u64)((u64)t__2e109 * (u64)((u64)4UL));
+	t__2e108 = (u64)((u64)t_field_2e107 + (u64)t__2e108);
+	t__2e110 = (u64)(u32)(*(i32 *)t__2e108);
+	t__2e105 = (u64)(u32)(((u32)t__2e110 == (u32)((u64)4UL)));
+	t__2e92 = (u64)(u32)t__2e105;
+	goto L__2e94;
+	L__2e94:;
+	if ((u32)t__2e92) goto L_passed_2e91; else goto L_failed_2e90;
+	L_failed_2e90:;
+	t_abortsite_2e45 = ((u64)3UL);
+	goto L_abort_2e80;
+	L_passed_2e91:;
+	t__2e112 = (u64)(*(u64 *)((u64)((char *)&D_kept)));
+	t__2e115 = (u64)(u32)(((u64)t__2e112 != (u64)((u64)0UL)));
+	if ((u32)t__2e115) goto L_passed_2e114; else goto L_failed_2e113;
+	L_failed_2e113:;
+	t_abortsite_2e45 = ((u64)4UL);
+	goto L_abort_2e116;
+	L_passed_2e114:;
+	*(u64 *)t_binding_2e111 = (u64)t__2e112;
+	t__2e123 = (u64)(*(u64 *)((u64)((char *)&D_kept__items)));
+	t__2e126 = (u64)(u32)(((u64)t__2e123 != (u64)((u64)0UL)));
+	if ((u32)t__2e126) goto L_passed_2e125; else goto L_failed_2e124;
+	L_failed_2e124:;
+	t_abortsite_2e45 = ((u64)5UL);
+	goto L_abort_2e116;
+	L_passed_2e125:;
+	*(u64 *)t_binding_2e122 = (u64)t__2e123;
+	((void (*)(void))((u64)((char *)&F_local__clobber)))();
+	t__2e136 = (u64)(*(u64 *)t_binding_2e111);
+	t__2e137 = (u64)(u32)(*(i32 *)t__2e136);
+	t__2e135 = (u64)(u32)(((u32)t__2e137 == (u32)((u64)2UL)));
+	t__2e132 = (u64)(u32)t__2e135;
+	if ((u32)t__2e132) goto L__2e133; else goto L__2e134;
+	L__2e133:;
+	t__2e139 = (u64)(*(u64 *)t_binding_2e122);
+	t__2e141 = (u64)((i64)(i32)((u64)0UL));
+	t__2e140 = (u64)((u64)t__2e141 * (u64)((u64)4UL));
+	t__2e140 = (u64)((u64)t__2e139 + (u64)t__2e140);
+	t__2e142 = (u64)(u32)(*(i32 *)t__2e140);
+	t__2e138 = (u64)(u32)(((u32)t__2e142 == (u32)((u64)5UL)));
+	t__2e132 = (u64)(u32)t__2e138;
+	goto L__2e134;
+	L__2e134:;
+	t__2e129 = (u64)(u32)t__2e132;
+	if ((u32)t__2e129) goto L__2e130; else goto L__2e131;
+	L__2e130:;
+	t__2e144 = (u64)(*(u64 *)t_binding_2e122);
+	t__2e146 = (u64)((i64)(i32)((u64)3UL));
+	t__2e145 = (u64)((u64)t__2e146 * (u64)((u64)4UL));
+	t__2e145 = (u64)((u64)t__2e144 + (u64)t__2e145);
+	t__2e147 = (u64)(u32)(*(i32 *)t__2e145);
+	t__2e143 = (u64)(u32)(((u32)t__2e147 == (u32)((u64)8UL)));
+	t__2e129 = (u64)(u32)t__2e143;
+	goto L__2e131;
+	L__2e131:;
+	if ((u32)t__2e129) goto L_passed_2e128; else goto L_failed_2e127;
+	L_failed_2e127:;
+	t_abortsite_2e45 = ((u64)6UL);
+	goto L_abort_2e80;
+	L_passed_2e128:;
+	t__2e148 = (u64)(*(u64 *)t_binding_2e86);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e148);
+	t__2e149 = (u64)(*(u64 *)t_binding_2e88);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e149);
+	t__2e150 = ((u64 (*)(u64))((u64)((char *)&F_sliced)))((u64)R8);
+	t__2e152 = ((u64 (*)(u64))((u64)((char *)&F_sliced__field)))((u64)R9);
+	((void (*)(void))((u64)((char *)&F_local__clobber)))();
+	t__2e162 = (u64)((u64)t__2e150 + (u64)((u64)8UL));
+	t__2e163 = (u64)((u64)t__2e150 + (u64)((u64)16UL));
+	t__2e164 = (u64)(*(u64 *)t__2e162);
+	t__2e161 = (u64)(u32)(((u64)t__2e164 == (u64)((u64)4UL)));
+	t__2e158 = (u64)(u32)t__2e161;
+	if ((u32)t__2e158) goto L__2e159; else goto L__2e160;
+	L__2e159:;
+	t__2e167 = (u64)((u64)t__2e150 + (u64)((u64)8UL));
+	t__2e168 = (u64)((u64)t__2e150 + (u64)((u64)16UL));
+	t__2e169 = (u64)(*(u64 *)t__2e150);
+	t__2e170 = (u64)(*(u64 *)t__2e167);
+	t__2e171 = (u64)((i64)(i32)((u64)0UL));
+	t__2e166 = (u64)((u64)t__2e171 * (u64)((u64)4UL));
+	t__2e166 = (u64)((u64)t__2e169 + (u64)t__2e166);
+	t__2e172 = (u64)(u32)(((u64)t__2e171 < (u64)t__2e170));
+	if ((u32)t__2e172) goto L__2e174; else goto L__2e173;
+	L__2e173:;
+	t_abortsite_2e45 = ((u64)7UL);
+	goto L_abort_2e175;
+	L__2e174:;
+	t__2e181 = (u64)(u32)(*(i32 *)t__2e166);
+	t__2e165 = (u64)(u32)(((u32)t__2e181 == (u32)((u64)1UL)));
+	t__2e158 = (u64)(u32)t__2e165;
+	goto L__2e160;
+	L__2e160:;
+	t__2e155 = (u64)(u32)t__2e158;
+	if ((u32)t__2e155) goto L__2e156; else goto L__2e157;
+	L__2e156:;
+	t__2e184 = (u64)((u64)t__2e150 + (u64)((u64)8UL));
+	t__2e185 = (u64)((u64)t__2e150 + (u64)((u64)16UL));
+	t__2e186 = (u64)(*(u64 *)t__2e150);
+	t__2e187 = (u64)(*(u64 *)t__2e184);
+	t__2e188 = (u64)((i64)(i32)((u64)3UL));
+	t__2e183 = (u64)((u64)t__2e188 * (u64)((u64)4UL));
+	t__2e183 = (u64)((u64)t__2e186 + (u64)t__2e183);
+	t__2e189 = (u64)(u32)(((u64)t__2e188 < (u64)t__2e187));
+	if ((u32)t__2e189) goto L__2e191; else goto L__2e190;
+	L__2e190:;
+	t_abortsite_2e45 = ((u64)8UL);
+	goto L_abort_2e175;
+	L__2e191:;
+	t__2e192 = (u64)(u32)(*(i32 *)t__2e183);
+	t__2e182 = (u64)(u32)(((u32)t__2e192 == (u32)((u64)4UL)));
+	t__2e155 = (u64)(u32)t__2e182;
+	goto L__2e157;
+	L__2e157:;
+	if ((u32)t__2e155) goto L_passed_2e154; else goto L_failed_2e153;
+	L_failed_2e153:;
+	t_abortsite_2e45 = ((u64)9UL);
+	goto L_abort_2e80;
+	L_passed_2e154:;
+	t__2e202 = (u64)((u64)t__2e152 + (u64)((u64)8UL));
+	t__2e203 = (u64)((u64)t__2e152 + (u64)((u64)16UL));
+	t__2e204 = (u64)(*(u64 *)t__2e202);
+	t__2e201 = (u64)(u32)(((u64)t__2e204 == (u64)((u64)4UL)));
+	t__2e198 = (u64)(u32)t__2e201;
+	if ((u32)t__2e198) goto L__2e199; else goto L__2e200;
+	L__2e199:;
+	t__2e207 = (u64)((u64)t__2e152 + (u64)((u64)8UL));
+	t__2e208 = (u64)((u64)t__2e152 + (u64)((u64)16UL));
+	t__2e209 = (u64)(*(u64 *)t__2e152);
+	t__2e210 = (u64)(*(u64 *)t__2e207);
+	t__2e211 = (u64)((i64)(i32)((u64)0UL));
+	t__2e206 = (u64)((u64)t__2e211 * (u64)((u64)4UL));
+	t__2e206 = (u64)((u64)t__2e209 + (u64)t__2e206);
+	t__2e212 = (u64)(u32)(((u64)t__2e211 < (u64)t__2e210));
+	if ((u32)t__2e212) goto L__2e214; else goto L__2e213;
+	L__2e213:;
+	t_abortsite_2e45 = ((u64)10UL);
+	goto L_abort_2e175;
+	L__2e214:;
+	t__2e215 = (u64)(u32)(*(i32 *)t__2e206);
+	t__2e205 = (u64)(u32)(((u32)t__2e215 == (u32)((u64)5UL)));
+	t__2e198 = (u64)(u32)t__2e205;
+	goto L__2e200;
+	L__2e200:;
+	t__2e195 = (u64)(u32)t__2e198;
+	if ((u32)t__2e195) goto L__2e196; else goto L__2e197;
+	L__2e196:;
+	t__2e218 = (u64)((u64)t__2e152 + (u64)((u64)8UL));
+	t__2e219 = (u64)((u64)t__2e152 + (u64)((u64)16UL));
+	t__2e220 = (u64)(*(u64 *)t__2e152);
+	t__2e221 = (u64)(*(u64 *)t__2e218);
+	t__2e222 = (u64)((i64)(i32)((u64)3UL));
+	t__2e217 = (u64)((u64)t__2e222 * (u64)((u64)4UL));
+	t__2e217 = (u64)((u64)t__2e220 + (u64)t__2e217);
+	t__2e223 = (u64)(u32)(((u64)t__2e222 < (u64)t__2e221));
+	if ((u32)t__2e223) goto L__2e225; else goto L__2e224;
+	L__2e224:;
+	t_abortsite_2e45 = ((u64)11UL);
+	goto L_abort_2e175;
+	L__2e225:;
+	t__2e226 = (u64)(u32)(*(i32 *)t__2e217);
+	t__2e216 = (u64)(u32)(((u32)t__2e226 == (u32)((u64)8UL)));
+	t__2e195 = (u64)(u32)t__2e216;
+	goto L__2e197;
+	L__2e197:;
+	if ((u32)t__2e195) goto L_passed_2e194; else goto L_failed_2e193;
+	L_failed_2e193:;
+	t_abortsite_2e45 = ((u64)12UL);
+	goto L_abort_2e80;
+	L_passed_2e194:;
+	t__2e227 = (u64)(*(u64 *)t__2e150);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e227);
+	t__2e228 = (u64)(*(u64 *)t__2e152);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e228);
+	goto L__2e9;
+	L__2e229:;
+	L__2e9:;
+	return;
+	L_abort_2e46:;
+	t__2e47 = (u64)((u64)t_abortsite_2e45 * (u64)((u64)16UL));
+	t__2e47 = (u64)((u64)((u64)((char *)&D_abortsites_2e44)) + (u64)t__2e47);
+	t__2e48 = (u64)(*(u64 *)t__2e47);
+	t__2e49 = (u64)((u64)t__2e47 + (u64)((u64)8UL));
+	t__2e50 = (u64)(*(u32 *)t__2e49);
+	t__2e49 = (u64)((u64)t__2e47 + (u64)((u64)12UL));
+	t__2e51 = (u64)(*(u32 *)t__2e49);
+	t_cleanup_2e52 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e53;
+	L_resume_2e54:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e48, (u64)t__2e50, (u64)t__2e51, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e80:;
+	t__2e81 = (u64)((u64)t_abortsite_2e45 * (u64)((u64)16UL));
+	t__2e81 = (u64)((u64)((u64)((char *)&D_abortsites_2e44)) + (u64)t__2e81);
+	t__2e82 = (u64)(*(u64 *)t__2e81);
+	t__2e83 = (u64)((u64)t__2e81 + (u64)((u64)8UL));
+	t__2e84 = (u64)(*(u32 *)t__2e83);
+	t__2e83 = (u64)((u64)t__2e81 + (u64)((u64)12UL));
+	t__2e85 = (u64)(*(u32 *)t__2e83);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e82, (u64)t__2e84, (u64)t__2e85, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e116:;
+	t__2e117 = (u64)((u64)t_abortsite_2e45 * (u64)((u64)16UL));
+	t__2e117 = (u64)((u64)((u64)((char *)&D_abortsites_2e44)) + (u64)t__2e117);
+	t__2e118 = (u64)(*(u64 *)t__2e117);
+	t__2e119 = (u64)((u64)t__2e117 + (u64)((u64)8UL));
+	t__2e120 = (u64)(*(u32 *)t__2e119);
+	t__2e119 = (u64)((u64)t__2e117 + (u64)((u64)12UL));
+	t__2e121 = (u64)(*(u32 *)t__2e119);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e118, (u64)t__2e120, (u64)t__2e121, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e175:;
+	t__2e176 = (u64)((u64)t_abortsite_2e45 * (u64)((u64)16UL));
+	t__2e176 = (u64)((u64)((u64)((char *)&D_abortsites_2e44)) + (u64)t__2e176);
+	t__2e177 = (u64)(*(u64 *)t__2e176);
+	t__2e178 = (u64)((u64)t__2e176 + (u64)((u64)8UL));
+	t__2e179 = (u64)(*(u32 *)t__2e178);
+	t__2e178 = (u64)((u64)t__2e176 + (u64)((u64)12UL));
+	t__2e180 = (u64)(*(u32 *)t__2e178);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e177, (u64)t__2e179, (u64)t__2e180, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static u64 F_sliced__field(u64 __rp) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char B2[24] __attribute__((aligned(16)));
+	char R3[24] __attribute__((aligned(16)));
+	u64 t__2e235;
+	u64 t__2e236;
+	u64 t__2e242;
+	u64 t__2e243;
+	u64 t__2e244;
+	u64 t__2e245;
+	u64 t__2e246;
+	u64 t__2e250;
+	u64 t__2e252;
+	u64 t__2e254;
+	u64 t_abortsite_2e240;
+	u64 t_binding_2e234;
+	u64 t_field_2e248;
+	u64 t_field_2e253;
+	u64 t_item_2e249;
+	u64 t_object_2e251;
+	L_start_2e230:;
+	t_binding_2e234 = (u64)A0;
+	t_object_2e251 = (u64)A1;
+	L_body_2e231:;
+	t__2e235 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)16UL)));
+	t__2e236 = (u64)(u32)(((u64)t__2e235 != (u64)((u64)0UL)));
+	if ((u32)t__2e236) goto L__2e238; else goto L__2e237;
+	L__2e237:;
+	t_abortsite_2e240 = ((u64)0UL);
+	goto L_abort_2e241;
+	L__2e238:;
+	t_field_2e248 = (u64)((u64)t__2e235 + (u64)((u64)0UL));
+	t_item_2e249 = (u64)((u64)t_field_2e248 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e249 = (u32)((u64)5UL);
+	t_item_2e249 = (u64)((u64)t_field_2e248 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e249 = (u32)((u64)6UL);
+	t_item_2e249 = (u64)((u64)t_field_2e248 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e249 = (u32)((u64)7UL);
+	t_item_2e249 = (u64)((u64)t_field_2e248 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e249 = (u32)((u64)8UL);
+	*(u64 *)t_binding_2e234 = (u64)t__2e235;
+	t__2e252 = (u64)(*(u64 *)t_binding_2e234);
+	t_field_2e253 = (u64)((u64)t__2e252 + (u64)((u64)0UL));
+	*(u64 *)t_object_2e251 = (u64)t_field_2e253;
+	t__2e254 = (u64)((u64)t_object_2e251 + (u64)((u64)8UL));
+	*(u64 *)t__2e254 = (u64)((u64)4UL);
+	t__2e254 = (u64)((u64)t__2e254 + (u64)((u64)8UL));
+	*(u64 *)t__2e254 = (u64)((u64)4UL);
+	BLIT((u64)B2, t_object_2e251, 24);
+	t__2e250 = ((u64 (*)(u64, u64))((u64)((char *)&F_keep)))((u64)R3, (u64)B2);
+	BLIT(__rp, t__2e250, 24); return __rp;
+	L__2e255:;
+	L__2e232:;
+	L__2e256:;
+	return 0;
+	L_abort_2e241:;
+	t__2e242 = (u64)((u64)t_abortsite_2e240 * (u64)((u64)16UL));
+	t__2e242 = (u64)((u64)((u64)((char *)&D_abortsites_2e239)) + (u64)t__2e242);
+	t__2e243 = (u64)(*(u64 *)t__2e242);
+	t__2e244 = (u64)((u64)t__2e242 + (u64)((u64)8UL));
+	t__2e245 = (u64)(*(u32 *)t__2e244);
+	t__2e244 = (u64)((u64)t__2e242 + (u64)((u64)12UL));
+	t__2e246 = (u64)(*(u32 *)t__2e244);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e243, (u64)t__2e245, (u64)t__2e246, (u64)((u64)2UL));
+	__builtin_trap();
+}
+static u64 F_keep(u64 __rp, u64 p_s) {
+	u64 t_s;
+	t_s = p_s;
+	L_start_2e257:;
+	L_body_2e258:;
+	BLIT(__rp, t_s, 24); return __rp;
+}
+static u64 F_sliced(u64 __rp) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	u64 t__2e264;
+	u64 t__2e265;
+	u64 t__2e271;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e275;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t_abortsite_2e269;
+	u64 t_binding_2e263;
+	u64 t_binding_2e277;
+	u64 t_item_2e276;
+	L_start_2e259:;
+	t_binding_2e263 = (u64)A0;
+	t_binding_2e277 = (u64)A1;
+	L_body_2e260:;
+	t__2e264 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)16UL)));
+	t__2e265 = (u64)(u32)(((u64)t__2e264 != (u64)((u64)0UL)));
+	if ((u32)t__2e265) goto L__2e267; else goto L__2e266;
+	L__2e266:;
+	t_abortsite_2e269 = ((u64)0UL);
+	goto L_abort_2e270;
+	L__2e267:;
+	t_item_2e276 = (u64)((u64)t__2e264 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e276 = (u32)((u64)1UL);
+	t_item_2e276 = (u64)((u64)t__2e264 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e276 = (u32)((u64)2UL);
+	t_item_2e276 = (u64)((u64)t__2e264 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e276 = (u32)((u64)3UL);
+	t_item_2e276 = (u64)((u64)t__2e264 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e276 = (u32)((u64)4UL);
+	*(u64 *)t_binding_2e263 = (u64)t__2e264;
+	t__2e278 = (u64)(*(u64 *)t_binding_2e263);
+	*(u64 *)t_binding_2e277 = (u64)t__2e278;
+	t__2e279 = (u64)((u64)t_binding_2e277 + (u64)((u64)8UL));
+	*(u64 *)t__2e279 = (u64)((u64)4UL);
+	t__2e279 = (u64)((u64)t__2e279 + (u64)((u64)8UL));
+	*(u64 *)t__2e279 = (u64)((u64)4UL);
+	BLIT(__rp, t_binding_2e277, 24); return __rp;
+	L__2e280:;
+	L__2e261:;
+	L__2e281:;
+	return 0;
+	L_abort_2e270:;
+	t__2e271 = (u64)((u64)t_abortsite_2e269 * (u64)((u64)16UL));
+	t__2e271 = (u64)((u64)((u64)((char *)&D_abortsites_2e268)) + (u64)t__2e271);
+	t__2e272 = (u64)(*(u64 *)t__2e271);
+	t__2e273 = (u64)((u64)t__2e271 + (u64)((u64)8UL));
+	t__2e274 = (u64)(*(u32 *)t__2e273);
+	t__2e273 = (u64)((u64)t__2e271 + (u64)((u64)12UL));
+	t__2e275 = (u64)(*(u32 *)t__2e273);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e272, (u64)t__2e274, (u64)t__2e275, (u64)((u64)2UL));
+	__builtin_trap();
+}
+static void F_local__clobber(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[256] __attribute__((aligned(16)));
+	u64 t__2e287;
+	u64 t__2e290;
+	u64 t__2e291;
+	u64 t__2e295;
+	u64 t__2e296;
+	u64 t__2e297;
+	u64 t__2e298;
+	u64 t__2e299;
+	u64 t__2e303;
+	u64 t__2e304;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t_abortsite_2e301;
+	u64 t_binding_2e286;
+	u64 t_item_2e289;
+	u64 t_item_2e292;
+	L_start_2e282:;
+	t_binding_2e286 = (u64)A0;
+	t__2e287 = (u64)A1;
+	L_body_2e283:;
+	t_item_2e289 = (u64)((u64)t__2e287 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e289 = (u32)((u64)255UL);
+	t__2e290 = (u64)((u64)t__2e287 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e290, (u64)t_item_2e289, (u64)((u64)252UL));
+	t_item_2e292 = (u64)((u64)t__2e287 + (u64)((u64)0UL));
+	t__2e291 = (u64)((u64)t__2e287 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e291, (u64)t_item_2e292, (u64)((u64)252UL));
+	*(u64 *)t_binding_2e286 = (u64)t__2e287;
+	t__2e296 = (u64)(*(u64 *)t_binding_2e286);
+	t__2e298 = (u64)((i64)(i32)((u64)63UL));
+	t__2e297 = (u64)((u64)t__2e298 * (u64)((u64)4UL));
+	t__2e297 = (u64)((u64)t__2e296 + (u64)t__2e297);
+	t__2e299 = (u64)(u32)(*(i32 *)t__2e297);
+	t__2e295 = (u64)(u32)(((u32)t__2e299 == (u32)((u64)255UL)));
+	if ((u32)t__2e295) goto L_passed_2e294; else goto L_failed_2e293;
+	L_failed_2e293:;
+	t_abortsite_2e301 = ((u64)0UL);
+	goto L_abort_2e302;
+	L_passed_2e294:;
+	goto L__2e284;
+	L__2e308:;
+	L__2e284:;
+	return;
+	L_abort_2e302:;
+	t__2e303 = (u64)((u64)t_abortsite_2e301 * (u64)((u64)16UL));
+	t__2e303 = (u64)((u64)((u64)((char *)&D_abortsites_2e300)) + (u64)t__2e303);
+	t__2e304 = (u64)(*(u64 *)t__2e303);
+	t__2e305 = (u64)((u64)t__2e303 + (u64)((u64)8UL));
+	t__2e306 = (u64)(*(u32 *)t__2e305);
+	t__2e305 = (u64)((u64)t__2e303 + (u64)((u64)12UL));
+	t__2e307 = (u64)(*(u32 *)t__2e305);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e304, (u64)t__2e306, (u64)t__2e307, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u64 F_escaping(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e314;
+	u64 t__2e315;
+	u64 t__2e321;
+	u64 t__2e322;
+	u64 t__2e323;
+	u64 t__2e324;
+	u64 t__2e325;
+	u64 t__2e329;
+	u64 t__2e330;
+	u64 t__2e333;
+	u64 t__2e335;
+	u64 t__2e336;
+	u64 t__2e341;
+	u64 t__2e343;
+	u64 t_abortsite_2e319;
+	u64 t_binding_2e313;
+	u64 t_binding_2e328;
+	u64 t_binding_2e334;
+	u64 t_field_2e326;
+	u64 t_field_2e339;
+	u64 t_field_2e342;
+	u64 t_item_2e327;
+	u64 t_item_2e340;
+	L_start_2e309:;
+	t_binding_2e313 = (u64)A0;
+	t_binding_2e328 = (u64)A1;
+	t_binding_2e334 = (u64)A2;
+	L_body_2e310:;
+	t__2e314 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)20UL)));
+	t__2e315 = (u64)(u32)(((u64)t__2e314 != (u64)((u64)0UL)));
+	if ((u32)t__2e315) goto L__2e317; else goto L__2e316;
+	L__2e316:;
+	t_abortsite_2e319 = ((u64)0UL);
+	goto L_abort_2e320;
+	L__2e317:;
+	t_field_2e326 = (u64)((u64)t__2e314 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e326 = (u32)((u64)1UL);
+	t_field_2e326 = (u64)((u64)t__2e314 + (u64)((u64)4UL));
+	t_item_2e327 = (u64)((u64)t_field_2e326 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e327 = (u32)((u64)1UL);
+	t_item_2e327 = (u64)((u64)t_field_2e326 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e327 = (u32)((u64)2UL);
+	t_item_2e327 = (u64)((u64)t_field_2e326 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e327 = (u32)((u64)3UL);
+	t_item_2e327 = (u64)((u64)t_field_2e326 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e327 = (u32)((u64)4UL);
+	*(u64 *)t_binding_2e313 = (u64)t__2e314;
+	t__2e329 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)4UL)));
+	t__2e330 = (u64)(u32)(((u64)t__2e329 != (u64)((u64)0UL)));
+	if ((u32)t__2e330) goto L__2e332; else goto L__2e331;
+	L__2e331:;
+	t_abortsite_2e319 = ((u64)1UL);
+	goto L_abort_2e320;
+	L__2e332:;
+	*(u32 *)t__2e329 = (u32)((u64)2UL);
+	*(u64 *)t_binding_2e328 = (u64)t__2e329;
+	t__2e333 = (u64)(*(u64 *)t_binding_2e328);
+	*(u64 *)((u64)((char *)&D_kept)) = (u64)t__2e333;
+	t__2e335 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)20UL)));
+	t__2e336 = (u64)(u32)(((u64)t__2e335 != (u64)((u64)0UL)));
+	if ((u32)t__2e336) goto L__2e338; else goto L__2e337;
+	L__2e337:;
+	t_abortsite_2e319 = ((u64)2UL);
+	goto L_abort_2e320;
+	L__2e338:;
+	t_field_2e339 = (u64)((u64)t__2e335 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e339 = (u32)((u64)3UL);
+	t_field_2e339 = (u64)((u64)t__2e335 + (u64)((u64)4UL));
+	t_item_2e340 = (u64)((u64)t_field_2e339 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e340 = (u32)((u64)5UL);
+	t_item_2e340 = (u64)((u64)t_field_2e339 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e340 = (u32)((u64)6UL);
+	t_item_2e340 = (u64)((u64)t_field_2e339 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e340 = (u32)((u64)7UL);
+	t_item_2e340 = (u64)((u64)t_field_2e339 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e340 = (u32)((u64)8UL);
+	*(u64 *)t_binding_2e334 = (u64)t__2e335;
+	t__2e341 = (u64)(*(u64 *)t_binding_2e334);
+	t_field_2e342 = (u64)((u64)t__2e341 + (u64)((u64)4UL));
+	*(u64 *)((u64)((char *)&D_kept__items)) = (u64)t_field_2e342;
+	t__2e343 = (u64)(*(u64 *)t_binding_2e313);
+	return (u64)t__2e343;
+	L__2e344:;
+	L__2e311:;
+	L__2e345:;
+	return 0;
+	L_abort_2e320:;
+	t__2e321 = (u64)((u64)t_abortsite_2e319 * (u64)((u64)16UL));
+	t__2e321 = (u64)((u64)((u64)((char *)&D_abortsites_2e318)) + (u64)t__2e321);
+	t__2e322 = (u64)(*(u64 *)t__2e321);
+	t__2e323 = (u64)((u64)t__2e321 + (u64)((u64)8UL));
+	t__2e324 = (u64)(*(u32 *)t__2e323);
+	t__2e323 = (u64)((u64)t__2e321 + (u64)((u64)12UL));
+	t__2e325 = (u64)(*(u32 *)t__2e323);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e322, (u64)t__2e324, (u64)t__2e325, (u64)((u64)2UL));
+	__builtin_trap();
+}
+static void F___null(void) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e351;
+	u64 t__2e352;
+	u64 t_binding_2e350;
+	L_start_2e346:;
+	t_binding_2e350 = (u64)A0;
+	L_body_2e347:;
+	t__2e351 = ((u64)0UL);
+	*(u64 *)t_binding_2e350 = (u64)t__2e351;
+	t__2e352 = (u64)(*(u64 *)t_binding_2e350);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e352);
+	goto L__2e348;
+	L__2e353:;
+	L__2e348:;
+	return;
+}
+static void F_string(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	u64 t__2e362;
+	u64 t__2e363;
+	u64 t__2e369;
+	u64 t__2e370;
+	u64 t__2e371;
+	u64 t__2e372;
+	u64 t__2e373;
+	u64 t__2e381;
+	u64 t__2e382;
+	u64 t__2e383;
+	u64 t__2e384;
+	u64 t__2e386;
+	u64 t__2e387;
+	u64 t__2e388;
+	u64 t__2e389;
+	u64 t__2e390;
+	u64 t__2e391;
+	u64 t_abortsite_2e367;
+	u64 t_binding_2e358;
+	u64 t_binding_2e377;
+	u64 t_field_2e361;
+	u64 t_item_2e375;
+	u64 t_object_2e359;
+	L_start_2e354:;
+	t_binding_2e358 = (u64)A0;
+	t_object_2e359 = (u64)A1;
+	t_binding_2e377 = (u64)A2;
+	L_body_2e355:;
+	t_field_2e361 = (u64)((u64)t_object_2e359 + (u64)((u64)0UL));
+	t__2e362 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)12UL)));
+	t__2e363 = (u64)(u32)(((u64)t__2e362 != (u64)((u64)0UL)));
+	if ((u32)t__2e363) goto L__2e365; else goto L__2e364;
+	L__2e364:;
+	t_abortsite_2e367 = ((u64)0UL);
+	goto L_abort_2e368;
+	L__2e365:;
+	t_item_2e375 = (u64)((u64)t__2e362 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e375 = (u32)((u64)1UL);
+	t_item_2e375 = (u64)((u64)t__2e362 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e375 = (u32)((u64)2UL);
+	t_item_2e375 = (u64)((u64)t__2e362 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e375 = (u32)((u64)3UL);
+	*(u64 *)t_field_2e361 = (u64)t__2e362;
+	t_field_2e361 = (u64)((u64)t_object_2e359 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e361 = (u64)((u64)3UL);
+	t_field_2e361 = (u64)((u64)t_object_2e359 + (u64)((u64)16UL));
+	*(u64 *)t_field_2e361 = (u64)((u64)3UL);
+	BLIT(t_binding_2e358, t_object_2e359, ((u64)24UL));
+	BLIT(t_binding_2e377, t_binding_2e358, ((u64)24UL));
+	t__2e382 = (u64)((u64)t_binding_2e377 + (u64)((u64)8UL));
+	t__2e383 = (u64)((u64)t_binding_2e377 + (u64)((u64)16UL));
+	t__2e384 = (u64)(*(u64 *)t__2e382);
+	t__2e381 = (u64)(u32)(((u64)t__2e384 == (u64)((u64)3UL)));
+	if ((u32)t__2e381) goto L_passed_2e380; else goto L_failed_2e379;
+	L_failed_2e379:;
+	t_abortsite_2e367 = ((u64)1UL);
+	goto L_abort_2e385;
+	L_passed_2e380:;
+	t__2e391 = (u64)(*(u64 *)t_binding_2e377);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e391);
+	goto L__2e356;
+	L__2e392:;
+	L__2e356:;
+	return;
+	L_abort_2e368:;
+	t__2e369 = (u64)((u64)t_abortsite_2e367 * (u64)((u64)16UL));
+	t__2e369 = (u64)((u64)((u64)((char *)&D_abortsites_2e366)) + (u64)t__2e369);
+	t__2e370 = (u64)(*(u64 *)t__2e369);
+	t__2e371 = (u64)((u64)t__2e369 + (u64)((u64)8UL));
+	t__2e372 = (u64)(*(u32 *)t__2e371);
+	t__2e371 = (u64)((u64)t__2e369 + (u64)((u64)12UL));
+	t__2e373 = (u64)(*(u32 *)t__2e371);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e370, (u64)t__2e372, (u64)t__2e373, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e385:;
+	t__2e386 = (u64)((u64)t_abortsite_2e367 * (u64)((u64)16UL));
+	t__2e386 = (u64)((u64)((u64)((char *)&D_abortsites_2e366)) + (u64)t__2e386);
+	t__2e387 = (u64)(*(u64 *)t__2e386);
+	t__2e388 = (u64)((u64)t__2e386 + (u64)((u64)8UL));
+	t__2e389 = (u64)(*(u32 *)t__2e388);
+	t__2e388 = (u64)((u64)t__2e386 + (u64)((u64)12UL));
+	t__2e390 = (u64)(*(u32 *)t__2e388);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e387, (u64)t__2e389, (u64)t__2e390, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_slice__copy(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[12] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char A7[12] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	u64 t__2e400;
+	u64 t__2e402;
+	u64 t__2e403;
+	u64 t__2e404;
+	u64 t__2e405;
+	u64 t__2e406;
+	u64 t__2e411;
+	u64 t__2e412;
+	u64 t__2e413;
+	u64 t__2e417;
+	u64 t__2e418;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e421;
+	u64 t__2e424;
+	u64 t__2e425;
+	u64 t__2e426;
+	u64 t__2e428;
+	u64 t__2e429;
+	u64 t__2e430;
+	u64 t__2e431;
+	u64 t__2e432;
+	u64 t__2e438;
+	u64 t__2e439;
+	u64 t__2e440;
+	u64 t__2e441;
+	u64 t__2e442;
+	u64 t__2e443;
+	u64 t__2e444;
+	u64 t__2e451;
+	u64 t__2e452;
+	u64 t__2e453;
+	u64 t__2e454;
+	u64 t__2e455;
+	u64 t__2e460;
+	u64 t__2e461;
+	u64 t__2e462;
+	u64 t__2e463;
+	u64 t__2e464;
+	u64 t__2e465;
+	u64 t__2e466;
+	u64 t__2e467;
+	u64 t__2e468;
+	u64 t__2e469;
+	u64 t__2e470;
+	u64 t__2e471;
+	u64 t__2e472;
+	u64 t__2e473;
+	u64 t__2e477;
+	u64 t__2e478;
+	u64 t__2e479;
+	u64 t__2e480;
+	u64 t__2e481;
+	u64 t__2e483;
+	u64 t__2e485;
+	u64 t__2e487;
+	u64 t__2e490;
+	u64 t__2e491;
+	u64 t__2e492;
+	u64 t__2e493;
+	u64 t__2e495;
+	u64 t__2e496;
+	u64 t__2e497;
+	u64 t__2e498;
+	u64 t__2e499;
+	u64 t__2e505;
+	u64 t__2e506;
+	u64 t__2e511;
+	u64 t__2e512;
+	u64 t__2e513;
+	u64 t__2e515;
+	u64 t__2e516;
+	u64 t__2e517;
+	u64 t__2e518;
+	u64 t__2e519;
+	u64 t__2e523;
+	u64 t__2e524;
+	u64 t__2e525;
+	u64 t__2e526;
+	u64 t__2e527;
+	u64 t__2e528;
+	u64 t__2e529;
+	u64 t__2e531;
+	u64 t__2e532;
+	u64 t__2e533;
+	u64 t__2e534;
+	u64 t__2e535;
+	u64 t__2e544;
+	u64 t__2e545;
+	u64 t__2e546;
+	u64 t__2e547;
+	u64 t__2e548;
+	u64 t__2e553;
+	u64 t__2e554;
+	u64 t__2e555;
+	u64 t__2e556;
+	u64 t__2e557;
+	u64 t__2e558;
+	u64 t__2e559;
+	u64 t__2e560;
+	u64 t__2e561;
+	u64 t__2e562;
+	u64 t__2e563;
+	u64 t__2e564;
+	u64 t__2e565;
+	u64 t__2e566;
+	u64 t__2e570;
+	u64 t__2e571;
+	u64 t__2e572;
+	u64 t__2e573;
+	u64 t__2e574;
+	u64 t__2e576;
+	u64 t__2e578;
+	u64 t__2e582;
+	u64 t__2e583;
+	u64 t__2e585;
+	u64 t__2e587;
+	u64 t__2e589;
+	u64 t__2e591;
+	u64 t__2e593;
+	u64 t__2e595;
+	u64 t_abortsite_2e415;
+	u64 t_binding_2e397;
+	u64 t_binding_2e401;
+	u64 t_binding_2e450;
+	u64 t_binding_2e486;
+	u64 t_binding_2e502;
+	u64 t_binding_2e543;
+	u64 t_cleanup_2e433;
+	u64 t_item_2e399;
+	u64 t_item_2e504;
+	u64 t_object_2e398;
+	u64 t_object_2e503;
+	L_start_2e393:;
+	t_binding_2e397 = (u64)A0;
+	t_object_2e398 = (u64)A1;
+	t_binding_2e401 = (u64)A2;
+	t_binding_2e450 = (u64)A3;
+	t_binding_2e486 = (u64)A4;
+	t__2e487 = (u64)A5;
+	t_binding_2e502 = (u64)A6;
+	t_object_2e503 = (u64)A7;
+	t_binding_2e543 = (u64)A8;
+	L_body_2e394:;
+	t_item_2e399 = (u64)((u64)t_object_2e398 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e399 = (u32)((u64)1UL);
+	t_item_2e399 = (u64)((u64)t_object_2e398 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e399 = (u32)((u64)2UL);
+	t_item_2e399 = (u64)((u64)t_object_2e398 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e399 = (u32)((u64)3UL);
+	*(u64 *)t_binding_2e397 = (u64)t_object_2e398;
+	t__2e400 = (u64)((u64)t_binding_2e397 + (u64)((u64)8UL));
+	*(u64 *)t__2e400 = (u64)((u64)3UL);
+	t__2e400 = (u64)((u64)t__2e400 + (u64)((u64)8UL));
+	*(u64 *)t__2e400 = (u64)((u64)3UL);
+	t__2e402 = t_binding_2e401;
+	t__2e403 = (u64)((u64)t_binding_2e397 + (u64)((u64)8UL));
+	t__2e404 = (u64)((u64)t_binding_2e397 + (u64)((u64)16UL));
+	t__2e405 = (u64)(*(u64 *)t_binding_2e397);
+	t__2e406 = (u64)(*(u64 *)t__2e403);
+	t__2e412 = ((u64)0UL);
+	t__2e411 = (u64)(u32)(((u64)t__2e406 != (u64)((u64)0UL)));
+	if ((u32)t__2e411) goto L__2e407; else goto L__2e409;
+	L__2e407:;
+	t__2e413 = (u64)((u64)((u64)4UL) * (u64)t__2e406);
+	t__2e412 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)t__2e413));
+	t__2e411 = (u64)(u32)(((u64)t__2e412 != (u64)((u64)0UL)));
+	if ((u32)t__2e411) goto L__2e410; else goto L__2e408;
+	L__2e408:;
+	t_abortsite_2e415 = ((u64)0UL);
+	goto L_abort_2e416;
+	L__2e410:;
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e412, (u64)t__2e405, (u64)t__2e413);
+	L__2e409:;
+	*(u64 *)t__2e402 = (u64)t__2e412;
+	t__2e402 = (u64)((u64)t__2e402 + (u64)((u64)8UL));
+	*(u64 *)t__2e402 = (u64)t__2e406;
+	t__2e402 = (u64)((u64)t__2e402 + (u64)((u64)8UL));
+	*(u64 *)t__2e402 = (u64)t__2e406;
+	t__2e425 = (u64)(*(u64 *)t_binding_2e401);
+	t__2e426 = (u64)(*(u64 *)t_binding_2e397);
+	t__2e424 = (u64)(u32)(((u64)t__2e425 != (u64)t__2e426));
+	if ((u32)t__2e424) goto L_passed_2e423; else goto L_failed_2e422;
+	L_failed_2e422:;
+	t_abortsite_2e415 = ((u64)1UL);
+	goto L_abort_2e427;
+	L_passed_2e423:;
+	t__2e439 = (u64)((u64)t_binding_2e401 + (u64)((u64)8UL));
+	t__2e440 = (u64)((u64)t_binding_2e401 + (u64)((u64)16UL));
+	t__2e441 = (u64)(*(u64 *)t__2e439);
+	t__2e442 = (u64)((u64)t_binding_2e397 + (u64)((u64)8UL));
+	t__2e443 = (u64)((u64)t_binding_2e397 + (u64)((u64)16UL));
+	t__2e444 = (u64)(*(u64 *)t__2e442);
+	t__2e438 = (u64)(u32)(((u64)t__2e441 == (u64)t__2e444));
+	if ((u32)t__2e438) goto L_passed_2e437; else goto L_failed_2e436;
+	L_failed_2e436:;
+	t_abortsite_2e415 = ((u64)2UL);
+	goto L_abort_2e427;
+	L_passed_2e437:;
+	*(u64 *)t_binding_2e450 = (u64)((u64)0UL);
+	L_loop_2e445:;
+	t__2e452 = (u64)(*(u64 *)t_binding_2e450);
+	t__2e453 = (u64)((u64)t_binding_2e401 + (u64)((u64)8UL));
+	t__2e454 = (u64)((u64)t_binding_2e401 + (u64)((u64)16UL));
+	t__2e455 = (u64)(*(u64 *)t__2e453);
+	t__2e451 = (u64)(u32)(((u64)t__2e452 < (u64)t__2e455));
+	if ((u32)t__2e451) goto L_body_2e446; else goto L__2e448;
+	L_body_2e446:;
+	t__2e462 = (u64)((u64)t_binding_2e401 + (u64)((u64)8UL));
+	t__2e463 = (u64)((u64)t_binding_2e401 + (u64)((u64)16UL));
+	t__2e464 = (u64)(*(u64 *)t_binding_2e401);
+	t__2e465 = (u64)(*(u64 *)t_binding_2e450);
+	t__2e461 = (u64)((u64)t__2e465 * (u64)((u64)4UL));
+	t__2e461 = (u64)((u64)t__2e464 + (u64)t__2e461);
+	t__2e466 = (u64)(u32)(*(i32 *)t__2e461);
+	t__2e468 = (u64)((u64)t_binding_2e397 + (u64)((u64)8UL));
+	t__2e469 = (u64)((u64)t_binding_2e397 + (u64)((u64)16UL));
+	t__2e470 = (u64)(*(u64 *)t_binding_2e397);
+	t__2e471 = (u64)(*(u64 *)t__2e468);
+	t__2e472 = (u64)(*(u64 *)t_binding_2e450);
+	t__2e467 = (u64)((u64)t__2e472 * (u64)((u64)4UL));
+	t__2e467 = (u64)((u64)t__2e470 + (u64)t__2e467);
+	t__2e473 = (u64)(u32)(((u64)t__2e472 < (u64)t__2e471));
+	if ((u32)t__2e473) goto L__2e475; else goto L__2e474;
+	L__2e474:;
+	t_abortsite_2e415 = ((u64)3UL);
+	goto L_abort_2e476;
+	L__2e475:;
+	t__2e483 = (u64)(u32)(*(i32 *)t__2e467);
+	t__2e460 = (u64)(u32)(((u32)t__2e466 == (u32)t__2e483));
+	if ((u32)t__2e460) goto L_passed_2e459; else goto L_failed_2e458;
+	L_failed_2e458:;
+	t_abortsite_2e415 = ((u64)4UL);
+	goto L_abort_2e427;
+	L_passed_2e459:;
+	goto L__2e456;
+	L__2e484:;
+	L__2e456:;
+	L_after_2e449:;
+	t__2e485 = (u64)(*(u64 *)t_binding_2e450);
+	t__2e485 = (u64)((u64)t__2e485 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e450 = (u64)t__2e485;
+	goto L_loop_2e445;
+	L__2e448:;
+	BLIT(t__2e487, t_binding_2e397, ((u64)24UL));
+	*(u64 *)t_binding_2e486 = (u64)t__2e487;
+	t__2e491 = (u64)(*(u64 *)t_binding_2e486);
+	t__2e492 = (u64)(*(u64 *)t__2e491);
+	t__2e493 = (u64)(*(u64 *)t_binding_2e397);
+	t__2e490 = (u64)(u32)(((u64)t__2e492 == (u64)t__2e493));
+	if ((u32)t__2e490) goto L_passed_2e489; else goto L_failed_2e488;
+	L_failed_2e488:;
+	t_abortsite_2e415 = ((u64)5UL);
+	goto L_abort_2e494;
+	L_passed_2e489:;
+	t_item_2e504 = (u64)((u64)t_object_2e503 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e504 = (u32)((u64)1UL);
+	t_item_2e504 = (u64)((u64)t_object_2e503 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e504 = (u32)((u64)2UL);
+	t_item_2e504 = (u64)((u64)t_object_2e503 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e504 = (u32)((u64)3UL);
+	t__2e505 = t_binding_2e502;
+	t__2e506 = t_object_2e503;
+	t__2e512 = ((u64)0UL);
+	t__2e511 = (u64)(u32)(((u64)((u64)3UL) != (u64)((u64)0UL)));
+	if ((u32)t__2e511) goto L__2e507; else goto L__2e509;
+	L__2e507:;
+	t__2e513 = (u64)((u64)((u64)4UL) * (u64)((u64)3UL));
+	t__2e512 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)t__2e513));
+	t__2e511 = (u64)(u32)(((u64)t__2e512 != (u64)((u64)0UL)));
+	if ((u32)t__2e511) goto L__2e510; else goto L__2e508;
+	L__2e508:;
+	t_abortsite_2e415 = ((u64)6UL);
+	goto L_abort_2e514;
+	L__2e510:;
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e512, (u64)t__2e506, (u64)t__2e513);
+	L__2e509:;
+	*(u64 *)t__2e505 = (u64)t__2e512;
+	t__2e505 = (u64)((u64)t__2e505 + (u64)((u64)8UL));
+	*(u64 *)t__2e505 = (u64)((u64)3UL);
+	t__2e505 = (u64)((u64)t__2e505 + (u64)((u64)8UL));
+	*(u64 *)t__2e505 = (u64)((u64)3UL);
+	t__2e524 = (u64)((u64)t_binding_2e397 + (u64)((u64)8UL));
+	t__2e525 = (u64)((u64)t_binding_2e397 + (u64)((u64)16UL));
+	t__2e526 = (u64)(*(u64 *)t__2e524);
+	t__2e527 = (u64)((u64)t_binding_2e502 + (u64)((u64)8UL));
+	t__2e528 = (u64)((u64)t_binding_2e502 + (u64)((u64)16UL));
+	t__2e529 = (u64)(*(u64 *)t__2e527);
+	t__2e523 = (u64)(u32)(((u64)t__2e526 == (u64)t__2e529));
+	if ((u32)t__2e523) goto L_passed_2e522; else goto L_failed_2e521;
+	L_failed_2e521:;
+	t_abortsite_2e415 = ((u64)7UL);
+	goto L_abort_2e530;
+	L_passed_2e522:;
+	*(u64 *)t_binding_2e543 = (u64)((u64)0UL);
+	L_loop_2e538:;
+	t__2e545 = (u64)(*(u64 *)t_binding_2e543);
+	t__2e546 = (u64)((u64)t_binding_2e397 + (u64)((u64)8UL));
+	t__2e547 = (u64)((u64)t_binding_2e397 + (u64)((u64)16UL));
+	t__2e548 = (u64)(*(u64 *)t__2e546);
+	t__2e544 = (u64)(u32)(((u64)t__2e545 < (u64)t__2e548));
+	if ((u32)t__2e544) goto L_body_2e539; else goto L__2e541;
+	L_body_2e539:;
+	t__2e555 = (u64)((u64)t_binding_2e397 + (u64)((u64)8UL));
+	t__2e556 = (u64)((u64)t_binding_2e397 + (u64)((u64)16UL));
+	t__2e557 = (u64)(*(u64 *)t_binding_2e397);
+	t__2e558 = (u64)(*(u64 *)t_binding_2e543);
+	t__2e554 = (u64)((u64)t__2e558 * (u64)((u64)4UL));
+	t__2e554 = (u64)((u64)t__2e557 + (u64)t__2e554);
+	t__2e559 = (u64)(u32)(*(i32 *)t__2e554);
+	t__2e561 = (u64)((u64)t_binding_2e502 + (u64)((u64)8UL));
+	t__2e562 = (u64)((u64)t_binding_2e502 + (u64)((u64)16UL));
+	t__2e563 = (u64)(*(u64 *)t_binding_2e502);
+	t__2e564 = (u64)(*(u64 *)t__2e561);
+	t__2e565 = (u64)(*(u64 *)t_binding_2e543);
+	t__2e560 = (u64)((u64)t__2e565 * (u64)((u64)4UL));
+	t__2e560 = (u64)((u64)t__2e563 + (u64)t__2e560);
+	t__2e566 = (u64)(u32)(((u64)t__2e565 < (u64)t__2e564));
+	if ((u32)t__2e566) goto L__2e568; else goto L__2e567;
+	L__2e567:;
+	t_abortsite_2e415 = ((u64)8UL);
+	goto L_abort_2e569;
+	L__2e568:;
+	t__2e576 = (u64)(u32)(*(i32 *)t__2e560);
+	t__2e553 = (u64)(u32)(((u32)t__2e559 == (u32)t__2e576));
+	if ((u32)t__2e553) goto L_passed_2e552; else goto L_failed_2e551;
+	L_failed_2e551:;
+	t_abortsite_2e415 = ((u64)9UL);
+	goto L_abort_2e530;
+	L_passed_2e552:;
+	goto L__2e549;
+	L__2e577:;
+	L__2e549:;
+	L_after_2e542:;
+	t__2e578 = (u64)(*(u64 *)t_binding_2e543);
+	t__2e578 = (u64)((u64)t__2e578 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e543 = (u64)t__2e578;
+	goto L_loop_2e538;
+	L__2e541:;
+	t_cleanup_2e433 = (u64)(u32)((u64)6UL);
+	goto L_defer_2e536;
+	L_resume_2e579:;
+	goto L__2e395;
+	L__2e580:;
+	goto L__2e581;
+	L_defer_2e536:;
+	t__2e582 = (u64)(*(u64 *)t_binding_2e502);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e582);
+	L_defer_2e500:;
+	L_defer_2e434:;
+	t__2e583 = (u64)(*(u64 *)t_binding_2e401);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e583);
+	t__2e585 = (u64)(u32)(((u32)t_cleanup_2e433 == (u32)((u64)6UL)));
+	if ((u32)t__2e585) goto L_resume_2e579; else goto L__2e584;
+	L__2e584:;
+	t__2e587 = (u64)(u32)(((u32)t_cleanup_2e433 == (u32)((u64)5UL)));
+	if ((u32)t__2e587) goto L_resume_2e575; else goto L__2e586;
+	L__2e586:;
+	t__2e589 = (u64)(u32)(((u32)t_cleanup_2e433 == (u32)((u64)4UL)));
+	if ((u32)t__2e589) goto L_resume_2e537; else goto L__2e588;
+	L__2e588:;
+	t__2e591 = (u64)(u32)(((u32)t_cleanup_2e433 == (u32)((u64)3UL)));
+	if ((u32)t__2e591) goto L_resume_2e520; else goto L__2e590;
+	L__2e590:;
+	t__2e593 = (u64)(u32)(((u32)t_cleanup_2e433 == (u32)((u64)2UL)));
+	if ((u32)t__2e593) goto L_resume_2e501; else goto L__2e592;
+	L__2e592:;
+	t__2e595 = (u64)(u32)(((u32)t_cleanup_2e433 == (u32)((u64)1UL)));
+	if ((u32)t__2e595) goto L_resume_2e482; else goto L__2e594;
+	L__2e594:;
+	goto L_resume_2e435;
+	L__2e581:;
+	L__2e395:;
+	return;
+	L_abort_2e416:;
+	t__2e417 = (u64)((u64)t_abortsite_2e415 * (u64)((u64)16UL));
+	t__2e417 = (u64)((u64)((u64)((char *)&D_abortsites_2e414)) + (u64)t__2e417);
+	t__2e418 = (u64)(*(u64 *)t__2e417);
+	t__2e419 = (u64)((u64)t__2e417 + (u64)((u64)8UL));
+	t__2e420 = (u64)(*(u32 *)t__2e419);
+	t__2e419 = (u64)((u64)t__2e417 + (u64)((u64)12UL));
+	t__2e421 = (u64)(*(u32 *)t__2e419);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e418, (u64)t__2e420, (u64)t__2e421, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e427:;
+	t__2e428 = (u64)((u64)t_abortsite_2e415 * (u64)((u64)16UL));
+	t__2e428 = (u64)((u64)((u64)((char *)&D_abortsites_2e414)) + (u64)t__2e428);
+	t__2e429 = (u64)(*(u64 *)t__2e428);
+	t__2e430 = (u64)((u64)t__2e428 + (u64)((u64)8UL));
+	t__2e431 = (u64)(*(u32 *)t__2e430);
+	t__2e430 = (u64)((u64)t__2e428 + (u64)((u64)12UL));
+	t__2e432 = (u64)(*(u32 *)t__2e430);
+	t_cleanup_2e433 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e434;
+	L_resume_2e435:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e429, (u64)t__2e431, (u64)t__2e432, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e476:;
+	t__2e477 = (u64)((u64)t_abortsite_2e415 * (u64)((u64)16UL));
+	t__2e477 = (u64)((u64)((u64)((char *)&D_abortsites_2e414)) + (u64)t__2e477);
+	t__2e478 = (u64)(*(u64 *)t__2e477);
+	t__2e479 = (u64)((u64)t__2e477 + (u64)((u64)8UL));
+	t__2e480 = (u64)(*(u32 *)t__2e479);
+	t__2e479 = (u64)((u64)t__2e477 + (u64)((u64)12UL));
+	t__2e481 = (u64)(*(u32 *)t__2e479);
+	t_cleanup_2e433 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e434;
+	L_resume_2e482:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e478, (u64)t__2e480, (u64)t__2e481, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e494:;
+	t__2e495 = (u64)((u64)t_abortsite_2e415 * (u64)((u64)16UL));
+	t__2e495 = (u64)((u64)((u64)((char *)&D_abortsites_2e414)) + (u64)t__2e495);
+	t__2e496 = (u64)(*(u64 *)t__2e495);
+	t__2e497 = (u64)((u64)t__2e495 + (u64)((u64)8UL));
+	t__2e498 = (u64)(*(u32 *)t__2e497);
+	t__2e497 = (u64)((u64)t__2e495 + (u64)((u64)12UL));
+	t__2e499 = (u64)(*(u32 *)t__2e497);
+	t_cleanup_2e433 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e500;
+	L_resume_2e501:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e496, (u64)t__2e498, (u64)t__2e499, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e514:;
+	t__2e515 = (u64)((u64)t_abortsite_2e415 * (u64)((u64)16UL));
+	t__2e515 = (u64)((u64)((u64)((char *)&D_abortsites_2e414)) + (u64)t__2e515);
+	t__2e516 = (u64)(*(u64 *)t__2e515);
+	t__2e517 = (u64)((u64)t__2e515 + (u64)((u64)8UL));
+	t__2e518 = (u64)(*(u32 *)t__2e517);
+	t__2e517 = (u64)((u64)t__2e515 + (u64)((u64)12UL));
+	t__2e519 = (u64)(*(u32 *)t__2e517);
+	t_cleanup_2e433 = (u64)(u32)((u64)3UL);
+	goto L_defer_2e500;
+	L_resume_2e520:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e516, (u64)t__2e518, (u64)t__2e519, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e530:;
+	t__2e531 = (u64)((u64)t_abortsite_2e415 * (u64)((u64)16UL));
+	t__2e531 = (u64)((u64)((u64)((char *)&D_abortsites_2e414)) + (u64)t__2e531);
+	t__2e532 = (u64)(*(u64 *)t__2e531);
+	t__2e533 = (u64)((u64)t__2e531 + (u64)((u64)8UL));
+	t__2e534 = (u64)(*(u32 *)t__2e533);
+	t__2e533 = (u64)((u64)t__2e531 + (u64)((u64)12UL));
+	t__2e535 = (u64)(*(u32 *)t__2e533);
+	t_cleanup_2e433 = (u64)(u32)((u64)4UL);
+	goto L_defer_2e536;
+	L_resume_2e537:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e532, (u64)t__2e534, (u64)t__2e535, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e569:;
+	t__2e570 = (u64)((u64)t_abortsite_2e415 * (u64)((u64)16UL));
+	t__2e570 = (u64)((u64)((u64)((char *)&D_abortsites_2e414)) + (u64)t__2e570);
+	t__2e571 = (u64)(*(u64 *)t__2e570);
+	t__2e572 = (u64)((u64)t__2e570 + (u64)((u64)8UL));
+	t__2e573 = (u64)(*(u32 *)t__2e572);
+	t__2e572 = (u64)((u64)t__2e570 + (u64)((u64)12UL));
+	t__2e574 = (u64)(*(u32 *)t__2e572);
+	t_cleanup_2e433 = (u64)(u32)((u64)5UL);
+	goto L_defer_2e536;
+	L_resume_2e575:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e571, (u64)t__2e573, (u64)t__2e574, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_slice(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[4] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	u64 t__2e602;
+	u64 t__2e608;
+	u64 t__2e609;
+	u64 t__2e610;
+	u64 t__2e611;
+	u64 t__2e612;
+	u64 t__2e613;
+	u64 t__2e616;
+	u64 t__2e619;
+	u64 t__2e620;
+	u64 t__2e621;
+	u64 t__2e622;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e628;
+	u64 t__2e629;
+	u64 t__2e630;
+	u64 t__2e631;
+	u64 t__2e633;
+	u64 t__2e634;
+	u64 t__2e635;
+	u64 t__2e636;
+	u64 t__2e637;
+	u64 t__2e644;
+	u64 t__2e645;
+	u64 t__2e646;
+	u64 t__2e647;
+	u64 t__2e648;
+	u64 t__2e653;
+	u64 t__2e654;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t__2e657;
+	u64 t__2e658;
+	u64 t__2e659;
+	u64 t__2e660;
+	u64 t__2e661;
+	u64 t__2e662;
+	u64 t__2e664;
+	u64 t__2e665;
+	u64 t__2e667;
+	u64 t__2e668;
+	u64 t__2e672;
+	u64 t__2e675;
+	u64 t__2e676;
+	u64 t__2e677;
+	u64 t__2e678;
+	u64 t__2e685;
+	u64 t__2e686;
+	u64 t__2e687;
+	u64 t__2e688;
+	u64 t__2e689;
+	u64 t__2e694;
+	u64 t__2e695;
+	u64 t__2e696;
+	u64 t__2e697;
+	u64 t__2e698;
+	u64 t__2e699;
+	u64 t__2e700;
+	u64 t__2e701;
+	u64 t__2e702;
+	u64 t__2e703;
+	u64 t__2e705;
+	u64 t__2e706;
+	u64 t__2e708;
+	u64 t__2e712;
+	u64 t__2e715;
+	u64 t__2e718;
+	u64 t__2e719;
+	u64 t__2e722;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e725;
+	u64 t__2e727;
+	u64 t__2e728;
+	u64 t__2e729;
+	u64 t__2e731;
+	u64 t__2e733;
+	u64 t__2e736;
+	u64 t__2e739;
+	u64 t__2e741;
+	u64 t__2e744;
+	u64 t__2e745;
+	u64 t__2e746;
+	u64 t__2e749;
+	u64 t__2e750;
+	u64 t__2e751;
+	u64 t__2e752;
+	u64 t__2e753;
+	u64 t__2e754;
+	u64 t__2e755;
+	u64 t__2e756;
+	u64 t__2e760;
+	u64 t__2e761;
+	u64 t__2e762;
+	u64 t__2e763;
+	u64 t__2e764;
+	u64 t__2e768;
+	u64 t__2e770;
+	u64 t__2e771;
+	u64 t__2e772;
+	u64 t__2e773;
+	u64 t__2e774;
+	u64 t__2e778;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e781;
+	u64 t__2e782;
+	u64 t__2e783;
+	u64 t__2e784;
+	u64 t__2e785;
+	u64 t__2e788;
+	u64 t__2e791;
+	u64 t__2e792;
+	u64 t__2e793;
+	u64 t__2e794;
+	u64 t__2e795;
+	u64 t__2e796;
+	u64 t__2e797;
+	u64 t__2e798;
+	u64 t__2e801;
+	u64 t__2e808;
+	u64 t__2e809;
+	u64 t__2e810;
+	u64 t__2e811;
+	u64 t__2e812;
+	u64 t__2e817;
+	u64 t__2e818;
+	u64 t__2e819;
+	u64 t__2e820;
+	u64 t__2e821;
+	u64 t__2e822;
+	u64 t__2e823;
+	u64 t__2e825;
+	u64 t__2e828;
+	u64 t__2e829;
+	u64 t__2e830;
+	u64 t__2e834;
+	u64 t__2e835;
+	u64 t__2e836;
+	u64 t__2e837;
+	u64 t__2e838;
+	u64 t__2e840;
+	u64 t__2e843;
+	u64 t__2e846;
+	u64 t__2e847;
+	u64 t__2e848;
+	u64 t__2e849;
+	u64 t__2e850;
+	u64 t__2e852;
+	u64 t__2e855;
+	u64 t__2e856;
+	u64 t__2e857;
+	u64 t__2e860;
+	u64 t__2e863;
+	u64 t__2e866;
+	u64 t__2e868;
+	u64 t__2e869;
+	u64 t__2e870;
+	u64 t__2e871;
+	u64 t__2e872;
+	u64 t__2e873;
+	u64 t__2e874;
+	u64 t__2e875;
+	u64 t__2e876;
+	u64 t__2e877;
+	u64 t__2e878;
+	u64 t__2e882;
+	u64 t__2e883;
+	u64 t__2e884;
+	u64 t__2e885;
+	u64 t__2e886;
+	u64 t__2e889;
+	u64 t__2e890;
+	u64 t__2e891;
+	u64 t__2e892;
+	u64 t__2e893;
+	u64 t__2e894;
+	u64 t__2e895;
+	u64 t__2e896;
+	u64 t__2e897;
+	u64 t__2e900;
+	u64 t__2e902;
+	u64 t__2e903;
+	u64 t__2e904;
+	u64 t__2e905;
+	u64 t__2e906;
+	u64 t__2e911;
+	u64 t__2e912;
+	u64 t__2e914;
+	u64 t__2e916;
+	u64 t__2e918;
+	u64 t__2e920;
+	u64 t__2e922;
+	u64 t__2e924;
+	u64 t_abortsite_2e606;
+	u64 t_binding_2e600;
+	u64 t_binding_2e643;
+	u64 t_binding_2e666;
+	u64 t_binding_2e684;
+	u64 t_binding_2e707;
+	u64 t_binding_2e709;
+	u64 t_binding_2e732;
+	u64 t_binding_2e807;
+	u64 t_binding_2e826;
+	u64 t_binding_2e827;
+	u64 t_cleanup_2e765;
+	u64 t_field_2e721;
+	u64 t_field_2e726;
+	u64 t_field_2e730;
+	u64 t_item_2e625;
+	u64 t_item_2e671;
+	u64 t_item_2e743;
+	u64 t_item_2e854;
+	u64 t_object_2e601;
+	L_start_2e596:;
+	t_binding_2e600 = (u64)A0;
+	t_object_2e601 = (u64)A1;
+	t_binding_2e643 = (u64)A2;
+	t_binding_2e666 = (u64)A3;
+	t_binding_2e684 = (u64)A4;
+	t_binding_2e707 = (u64)A5;
+	t_binding_2e709 = (u64)A6;
+	t_binding_2e732 = (u64)A7;
+	t_binding_2e807 = (u64)A8;
+	t_binding_2e826 = (u64)A9;
+	t_binding_2e827 = (u64)A10;
+	L_body_2e597:;
+	t__2e602 = (u64)(u32)(((u64)((u64)3UL) <= (u64)((u64)10UL)));
+	if ((u32)t__2e602) goto L__2e603; else goto L__2e604;
+	L__2e604:;
+	t_abortsite_2e606 = ((u64)0UL);
+	goto L_abort_2e607;
+	L__2e603:;
+	t__2e613 = (u64)((u64)((u64)10UL) * (u64)((u64)4UL));
+	t__2e616 = ((u64)0UL);
+	t__2e602 = (u64)(u32)(((u64)t__2e613 != (u64)((u64)0UL)));
+	if ((u32)t__2e602) goto L__2e615; else goto L__2e614;
+	L__2e615:;
+	t__2e616 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)t__2e613));
+	t__2e602 = (u64)(u32)(((u64)t__2e616 != (u64)((u64)0UL)));
+	if ((u32)t__2e602) goto L__2e614; else goto L__2e617;
+	L__2e617:;
+	t_abortsite_2e606 = ((u64)1UL);
+	goto L_abort_2e618;
+	L__2e614:;
+	*(u64 *)t_object_2e601 = (u64)t__2e616;
+	t__2e624 = (u64)((u64)t_object_2e601 + (u64)((u64)8UL));
+	*(u64 *)t__2e624 = (u64)((u64)3UL);
+	t__2e624 = (u64)((u64)t_object_2e601 + (u64)((u64)16UL));
+	*(u64 *)t__2e624 = (u64)((u64)10UL);
+	t_item_2e625 = (u64)((u64)t__2e616 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e625 = (u32)((u64)1UL);
+	t_item_2e625 = (u64)((u64)t__2e616 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e625 = (u32)((u64)2UL);
+	t_item_2e625 = (u64)((u64)t__2e616 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e625 = (u32)((u64)3UL);
+	BLIT(t_binding_2e600, t_object_2e601, ((u64)24UL));
+	t__2e629 = (u64)((u64)t_binding_2e600 + (u64)((u64)8UL));
+	t__2e630 = (u64)((u64)t_binding_2e600 + (u64)((u64)16UL));
+	t__2e631 = (u64)(*(u64 *)t__2e629);
+	t__2e628 = (u64)(u32)(((u64)t__2e631 == (u64)((u64)3UL)));
+	if ((u32)t__2e628) goto L_passed_2e627; else goto L_failed_2e626;
+	L_failed_2e626:;
+	t_abortsite_2e606 = ((u64)2UL);
+	goto L_abort_2e632;
+	L_passed_2e627:;
+	*(u64 *)t_binding_2e643 = (u64)((u64)0UL);
+	L_loop_2e638:;
+	t__2e645 = (u64)(*(u64 *)t_binding_2e643);
+	t__2e646 = (u64)((u64)t_binding_2e600 + (u64)((u64)8UL));
+	t__2e647 = (u64)((u64)t_binding_2e600 + (u64)((u64)16UL));
+	t__2e648 = (u64)(*(u64 *)t__2e646);
+	t__2e644 = (u64)(u32)(((u64)t__2e645 < (u64)t__2e648));
+	if ((u32)t__2e644) goto L_body_2e639; else goto L__2e641;
+	L_body_2e639:;
+	t__2e655 = (u64)((u64)t_binding_2e600 + (u64)((u64)8UL));
+	t__2e656 = (u64)((u64)t_binding_2e600 + (u64)((u64)16UL));
+	t__2e657 = (u64)(*(u64 *)t_binding_2e600);
+	t__2e658 = (u64)(*(u64 *)t_binding_2e643);
+	t__2e654 = (u64)((u64)t__2e658 * (u64)((u64)4UL));
+	t__2e654 = (u64)((u64)t__2e657 + (u64)t__2e654);
+	t__2e659 = (u64)(u32)(*(i32 *)t__2e654);
+	t__2e661 = (u64)(*(u64 *)t_binding_2e643);
+	t__2e660 = (u64)((u64)t__2e661 + (u64)((u64)1UL));
+	t__2e662 = (u64)(u32)t__2e660;
+	t__2e653 = (u64)(u32)(((u32)t__2e659 == (u32)t__2e662));
+	if ((u32)t__2e653) goto L_passed_2e652; else goto L_failed_2e651;
+	L_failed_2e651:;
+	t_abortsite_2e606 = ((u64)3UL);
+	goto L_abort_2e632;
+	L_passed_2e652:;
+	goto L__2e649;
+	L__2e663:;
+	L__2e649:;
+	L_after_2e642:;
+	t__2e664 = (u64)(*(u64 *)t_binding_2e643);
+	t__2e664 = (u64)((u64)t__2e664 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e643 = (u64)t__2e664;
+	goto L_loop_2e638;
+	L__2e641:;
+	t__2e665 = (u64)(*(u64 *)t_binding_2e600);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e665);
+	t__2e667 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)12UL)));
+	t__2e668 = (u64)(u32)(((u64)t__2e667 != (u64)((u64)0UL)));
+	if ((u32)t__2e668) goto L__2e670; else goto L__2e669;
+	L__2e669:;
+	t_abortsite_2e606 = ((u64)4UL);
+	goto L_abort_2e618;
+	L__2e670:;
+	t_item_2e671 = (u64)((u64)t__2e667 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e671 = (u32)((u64)1UL);
+	t_item_2e671 = (u64)((u64)t__2e667 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e671 = (u32)((u64)2UL);
+	t_item_2e671 = (u64)((u64)t__2e667 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e671 = (u32)((u64)3UL);
+	*(u64 *)t_binding_2e666 = (u64)t__2e667;
+	t__2e672 = (u64)((u64)t_binding_2e666 + (u64)((u64)8UL));
+	*(u64 *)t__2e672 = (u64)((u64)3UL);
+	t__2e672 = (u64)((u64)t__2e672 + (u64)((u64)8UL));
+	*(u64 *)t__2e672 = (u64)((u64)3UL);
+	t__2e676 = (u64)((u64)t_binding_2e600 + (u64)((u64)8UL));
+	t__2e677 = (u64)((u64)t_binding_2e600 + (u64)((u64)16UL));
+	t__2e678 = (u64)(*(u64 *)t__2e676);
+	t__2e675 = (u64)(u32)(((u64)t__2e678 == (u64)((u64)3UL)));
+	if ((u32)t__2e675) goto L_passed_2e674; else goto L_failed_2e673;
+	L_failed_2e673:;
+	t_abortsite_2e606 = ((u64)5UL);
+	goto L_abort_2e632;
+	L_passed_2e674:;
+	*(u64 *)t_binding_2e684 = (u64)((u64)0UL);
+	L_loop_2e679:;
+	t__2e686 = (u64)(*(u64 *)t_binding_2e684);
+	t__2e687 = (u64)((u64)t_binding_2e666 + (u64)((u64)8UL));
+	t__2e688 = (u64)((u64)t_binding_2e666 + (u64)((u64)16UL));
+	t__2e689 = (u64)(*(u64 *)t__2e687);
+	t__2e685 = (u64)(u32)(((u64)t__2e686 < (u64)t__2e689));
+	if ((u32)t__2e685) goto L_body_2e680; else goto L__2e682;
+	L_body_2e680:;
+	t__2e696 = (u64)((u64)t_binding_2e666 + (u64)((u64)8UL));
+	t__2e697 = (u64)((u64)t_binding_2e666 + (u64)((u64)16UL));
+	t__2e698 = (u64)(*(u64 *)t_binding_2e666);
+	t__2e699 = (u64)(*(u64 *)t_binding_2e684);
+	t__2e695 = (u64)((u64)t__2e699 * (u64)((u64)4UL));
+	t__2e695 = (u64)((u64)t__2e698 + (u64)t__2e695);
+	t__2e700 = (u64)(u32)(*(i32 *)t__2e695);
+	t__2e702 = (u64)(*(u64 *)t_binding_2e684);
+	t__2e701 = (u64)((u64)t__2e702 + (u64)((u64)1UL));
+	t__2e703 = (u64)(u32)t__2e701;
+	t__2e694 = (u64)(u32)(((u32)t__2e700 == (u32)t__2e703));
+	if ((u32)t__2e694) goto L_passed_2e693; else goto L_failed_2e692;
+	L_failed_2e692:;
+	t_abortsite_2e606 = ((u64)6UL);
+	goto L_abort_2e632;
+	L_passed_2e693:;
+	goto L__2e690;
+	L__2e704:;
+	L__2e690:;
+	L_after_2e683:;
+	t__2e705 = (u64)(*(u64 *)t_binding_2e684);
+	t__2e705 = (u64)((u64)t__2e705 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e684 = (u64)t__2e705;
+	goto L_loop_2e679;
+	L__2e682:;
+	t__2e706 = (u64)(*(u64 *)t_binding_2e666);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e706);
+	*(u64 *)t_binding_2e707 = (u64)((u64)0UL);
+	t__2e708 = (u64)((u64)t_binding_2e707 + (u64)((u64)8UL));
+	*(u64 *)t__2e708 = (u64)((u64)0UL);
+	t__2e708 = (u64)((u64)t__2e708 + (u64)((u64)8UL));
+	*(u64 *)t__2e708 = (u64)((u64)0UL);
+	*(u64 *)t_binding_2e709 = (u64)t_binding_2e707;
+	t__2e719 = (u64)(*(u64 *)t_binding_2e709);
+	t_field_2e721 = (u64)((u64)t__2e719 + (u64)((u64)0UL));
+	t__2e722 = (u64)(*(u64 *)t_field_2e721);
+	t__2e723 = ((u64)0UL);
+	t__2e718 = (u64)(u32)(((u64)t__2e722 == (u64)t__2e723));
+	t__2e715 = (u64)(u32)t__2e718;
+	if ((u32)t__2e715) goto L__2e716; else goto L__2e717;
+	L__2e716:;
+	t__2e725 = (u64)(*(u64 *)t_binding_2e709);
+	t_field_2e726 = (u64)((u64)t__2e725 + (u64)((u64)8UL));
+	t__2e727 = (u64)(*(u64 *)t_field_2e726);
+	t__2e724 = (u64)(u32)(((u64)t__2e727 == (u64)((u64)0UL)));
+	t__2e715 = (u64)(u32)t__2e724;
+	goto L__2e717;
+	L__2e717:;
+	t__2e712 = (u64)(u32)t__2e715;
+	if ((u32)t__2e712) goto L__2e713; else goto L__2e714;
+	L__2e713:;
+	t__2e729 = (u64)(*(u64 *)t_binding_2e709);
+	t_field_2e730 = (u64)((u64)t__2e729 + (u64)((u64)16UL));
+	t__2e731 = (u64)(*(u64 *)t_field_2e730);
+	t__2e728 = (u64)(u32)(((u64)t__2e731 == (u64)((u64)0UL)));
+	t__2e712 = (u64)(u32)t__2e728;
+	goto L__2e714;
+	L__2e714:;
+	if ((u32)t__2e712) goto L_passed_2e711; else goto L_failed_2e710;
+	L_failed_2e710:;
+	t_abortsite_2e606 = ((u64)7UL);
+	goto L_abort_2e632;
+	L_passed_2e711:;
+	t__2e733 = (u64)(u32)(((u64)((u64)3UL) <= (u64)((u64)42UL)));
+	if ((u32)t__2e733) goto L__2e734; else goto L__2e735;
+	L__2e735:;
+	t_abortsite_2e606 = ((u64)8UL);
+	goto L_abort_2e607;
+	L__2e734:;
+	t__2e736 = (u64)((u64)((u64)42UL) * (u64)((u64)4UL));
+	t__2e739 = ((u64)0UL);
+	t__2e733 = (u64)(u32)(((u64)t__2e736 != (u64)((u64)0UL)));
+	if ((u32)t__2e733) goto L__2e738; else goto L__2e737;
+	L__2e738:;
+	t__2e739 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)t__2e736));
+	t__2e733 = (u64)(u32)(((u64)t__2e739 != (u64)((u64)0UL)));
+	if ((u32)t__2e733) goto L__2e737; else goto L__2e740;
+	L__2e740:;
+	t_abortsite_2e606 = ((u64)9UL);
+	goto L_abort_2e618;
+	L__2e737:;
+	*(u64 *)t_binding_2e732 = (u64)t__2e739;
+	t__2e741 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	*(u64 *)t__2e741 = (u64)((u64)42UL);
+	t__2e741 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	*(u64 *)t__2e741 = (u64)((u64)42UL);
+	t_item_2e743 = (u64)((u64)t__2e739 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e743 = (u32)((u64)1UL);
+	t_item_2e743 = (u64)((u64)t__2e739 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e743 = (u32)((u64)2UL);
+	t_item_2e743 = (u64)((u64)t__2e739 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e743 = (u32)((u64)3UL);
+	t__2e745 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t__2e745 = (u64)((u64)t__2e745 + (u64)t__2e739);
+	t__2e744 = (u64)((u64)t__2e745 - (u64)((u64)4UL));
+	t__2e746 = (u64)((u64)((u64)42UL) - (u64)((u64)3UL));
+	t__2e746 = (u64)((u64)t__2e746 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e745, (u64)t__2e744, (u64)t__2e746);
+	t__2e751 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	t__2e752 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	t__2e753 = (u64)(*(u64 *)t_binding_2e732);
+	t__2e754 = (u64)(*(u64 *)t__2e751);
+	t__2e755 = (u64)((i64)(i32)((u64)0UL));
+	t__2e750 = (u64)((u64)t__2e755 * (u64)((u64)4UL));
+	t__2e750 = (u64)((u64)t__2e753 + (u64)t__2e750);
+	t__2e756 = (u64)(u32)(((u64)t__2e755 < (u64)t__2e754));
+	if ((u32)t__2e756) goto L__2e758; else goto L__2e757;
+	L__2e757:;
+	t_abortsite_2e606 = ((u64)10UL);
+	goto L_abort_2e759;
+	L__2e758:;
+	t__2e768 = (u64)(u32)(*(i32 *)t__2e750);
+	t__2e749 = (u64)(u32)(((u32)t__2e768 == (u32)((u64)1UL)));
+	if ((u32)t__2e749) goto L_passed_2e748; else goto L_failed_2e747;
+	L_failed_2e747:;
+	t_abortsite_2e606 = ((u64)11UL);
+	goto L_abort_2e769;
+	L_passed_2e748:;
+	t__2e780 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	t__2e781 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	t__2e782 = (u64)(*(u64 *)t_binding_2e732);
+	t__2e783 = (u64)(*(u64 *)t__2e780);
+	t__2e784 = (u64)((i64)(i32)((u64)1UL));
+	t__2e779 = (u64)((u64)t__2e784 * (u64)((u64)4UL));
+	t__2e779 = (u64)((u64)t__2e782 + (u64)t__2e779);
+	t__2e785 = (u64)(u32)(((u64)t__2e784 < (u64)t__2e783));
+	if ((u32)t__2e785) goto L__2e787; else goto L__2e786;
+	L__2e786:;
+	t_abortsite_2e606 = ((u64)12UL);
+	goto L_abort_2e759;
+	L__2e787:;
+	t__2e788 = (u64)(u32)(*(i32 *)t__2e779);
+	t__2e778 = (u64)(u32)(((u32)t__2e788 == (u32)((u64)2UL)));
+	if ((u32)t__2e778) goto L_passed_2e777; else goto L_failed_2e776;
+	L_failed_2e776:;
+	t_abortsite_2e606 = ((u64)13UL);
+	goto L_abort_2e769;
+	L_passed_2e777:;
+	t__2e793 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	t__2e794 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	t__2e795 = (u64)(*(u64 *)t_binding_2e732);
+	t__2e796 = (u64)(*(u64 *)t__2e793);
+	t__2e797 = (u64)((i64)(i32)((u64)2UL));
+	t__2e792 = (u64)((u64)t__2e797 * (u64)((u64)4UL));
+	t__2e792 = (u64)((u64)t__2e795 + (u64)t__2e792);
+	t__2e798 = (u64)(u32)(((u64)t__2e797 < (u64)t__2e796));
+	if ((u32)t__2e798) goto L__2e800; else goto L__2e799;
+	L__2e799:;
+	t_abortsite_2e606 = ((u64)14UL);
+	goto L_abort_2e759;
+	L__2e800:;
+	t__2e801 = (u64)(u32)(*(i32 *)t__2e792);
+	t__2e791 = (u64)(u32)(((u32)t__2e801 == (u32)((u64)3UL)));
+	if ((u32)t__2e791) goto L_passed_2e790; else goto L_failed_2e789;
+	L_failed_2e789:;
+	t_abortsite_2e606 = ((u64)15UL);
+	goto L_abort_2e769;
+	L_passed_2e790:;
+	*(u64 *)t_binding_2e807 = (u64)((u64)2UL);
+	L_loop_2e802:;
+	t__2e809 = (u64)(*(u64 *)t_binding_2e807);
+	t__2e810 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	t__2e811 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	t__2e812 = (u64)(*(u64 *)t__2e810);
+	t__2e808 = (u64)(u32)(((u64)t__2e809 < (u64)t__2e812));
+	if ((u32)t__2e808) goto L_body_2e803; else goto L__2e805;
+	L_body_2e803:;
+	t__2e819 = (u64)((u64)t_binding_2e732 + (u64)((u64)8UL));
+	t__2e820 = (u64)((u64)t_binding_2e732 + (u64)((u64)16UL));
+	t__2e821 = (u64)(*(u64 *)t_binding_2e732);
+	t__2e822 = (u64)(*(u64 *)t_binding_2e807);
+	t__2e818 = (u64)((u64)t__2e822 * (u64)((u64)4UL));
+	t__2e818 = (u64)((u64)t__2e821 + (u64)t__2e818);
+	t__2e823 = (u64)(u32)(*(i32 *)t__2e818);
+	t__2e817 = (u64)(u32)(((u32)t__2e823 == (u32)((u64)3UL)));
+	if ((u32)t__2e817) goto L_passed_2e816; else goto L_failed_2e815;
+	L_failed_2e815:;
+	t_abortsite_2e606 = ((u64)16UL);
+	goto L_abort_2e769;
+	L_passed_2e816:;
+	goto L__2e813;
+	L__2e824:;
+	L__2e813:;
+	L_after_2e806:;
+	t__2e825 = (u64)(*(u64 *)t_binding_2e807);
+	t__2e825 = (u64)((u64)t__2e825 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e807 = (u64)t__2e825;
+	goto L_loop_2e802;
+	L__2e805:;
+	*(u32 *)t_binding_2e826 = (u32)((u64)4UL);
+	t__2e828 = (u64)(u32)(*(u32 *)t_binding_2e826);
+	t__2e829 = (u64)((u32)t__2e828);
+	t__2e830 = (u64)(u32)(((u64)((u64)1UL) <= (u64)t__2e829));
+	if ((u32)t__2e830) goto L__2e831; else goto L__2e832;
+	L__2e832:;
+	t_abortsite_2e606 = ((u64)17UL);
+	goto L_abort_2e833;
+	L__2e831:;
+	t__2e840 = (u64)((u64)t__2e829 * (u64)((u64)8UL));
+	t__2e843 = ((u64)0UL);
+	t__2e830 = (u64)(u32)(((u64)t__2e840 != (u64)((u64)0UL)));
+	if ((u32)t__2e830) goto L__2e842; else goto L__2e841;
+	L__2e842:;
+	t__2e843 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)t__2e840));
+	t__2e830 = (u64)(u32)(((u64)t__2e843 != (u64)((u64)0UL)));
+	if ((u32)t__2e830) goto L__2e841; else goto L__2e844;
+	L__2e844:;
+	t_abortsite_2e606 = ((u64)18UL);
+	goto L_abort_2e845;
+	L__2e841:;
+	*(u64 *)t_binding_2e827 = (u64)t__2e843;
+	t__2e852 = (u64)((u64)t_binding_2e827 + (u64)((u64)8UL));
+	*(u64 *)t__2e852 = (u64)t__2e829;
+	t__2e852 = (u64)((u64)t_binding_2e827 + (u64)((u64)16UL));
+	*(u64 *)t__2e852 = (u64)t__2e829;
+	t_item_2e854 = (u64)((u64)t__2e843 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e854 = (u64)((u64)1UL);
+	t__2e856 = (u64)((u64)((u64)1UL) * (u64)((u64)8UL));
+	t__2e856 = (u64)((u64)t__2e856 + (u64)t__2e843);
+	t__2e855 = (u64)((u64)t__2e856 - (u64)((u64)8UL));
+	t__2e857 = (u64)((u64)t__2e829 - (u64)((u64)1UL));
+	t__2e857 = (u64)((u64)t__2e857 * (u64)((u64)8UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e856, (u64)t__2e855, (u64)t__2e857);
+	t__2e868 = (u64)((u64)t_binding_2e827 + (u64)((u64)8UL));
+	t__2e869 = (u64)((u64)t_binding_2e827 + (u64)((u64)16UL));
+	t__2e870 = (u64)(*(u64 *)t__2e868);
+	t__2e866 = (u64)(u32)(((u64)t__2e870 == (u64)((u64)4UL)));
+	t__2e863 = (u64)(u32)t__2e866;
+	if ((u32)t__2e863) goto L__2e864; else goto L__2e865;
+	L__2e864:;
+	t__2e873 = (u64)((u64)t_binding_2e827 + (u64)((u64)8UL));
+	t__2e874 = (u64)((u64)t_binding_2e827 + (u64)((u64)16UL));
+	t__2e875 = (u64)(*(u64 *)t_binding_2e827);
+	t__2e876 = (u64)(*(u64 *)t__2e873);
+	t__2e877 = (u64)((i64)(i32)((u64)0UL));
+	t__2e872 = (u64)((u64)t__2e877 * (u64)((u64)8UL));
+	t__2e872 = (u64)((u64)t__2e875 + (u64)t__2e872);
+	t__2e878 = (u64)(u32)(((u64)t__2e877 < (u64)t__2e876));
+	if ((u32)t__2e878) goto L__2e880; else goto L__2e879;
+	L__2e879:;
+	t_abortsite_2e606 = ((u64)19UL);
+	goto L_abort_2e881;
+	L__2e880:;
+	t__2e889 = (u64)(*(u64 *)t__2e872);
+	t__2e871 = (u64)(u32)(((u64)t__2e889 == (u64)((u64)1UL)));
+	t__2e863 = (u64)(u32)t__2e871;
+	goto L__2e865;
+	L__2e865:;
+	t__2e860 = (u64)(u32)t__2e863;
+	if ((u32)t__2e860) goto L__2e861; else goto L__2e862;
+	L__2e861:;
+	t__2e892 = (u64)((u64)t_binding_2e827 + (u64)((u64)8UL));
+	t__2e893 = (u64)((u64)t_binding_2e827 + (u64)((u64)16UL));
+	t__2e894 = (u64)(*(u64 *)t_binding_2e827);
+	t__2e895 = (u64)(*(u64 *)t__2e892);
+	t__2e896 = (u64)((i64)(i32)((u64)3UL));
+	t__2e891 = (u64)((u64)t__2e896 * (u64)((u64)8UL));
+	t__2e891 = (u64)((u64)t__2e894 + (u64)t__2e891);
+	t__2e897 = (u64)(u32)(((u64)t__2e896 < (u64)t__2e895));
+	if ((u32)t__2e897) goto L__2e899; else goto L__2e898;
+	L__2e898:;
+	t_abortsite_2e606 = ((u64)20UL);
+	goto L_abort_2e881;
+	L__2e899:;
+	t__2e900 = (u64)(*(u64 *)t__2e891);
+	t__2e890 = (u64)(u32)(((u64)t__2e900 == (u64)((u64)1UL)));
+	t__2e860 = (u64)(u32)t__2e890;
+	goto L__2e862;
+	L__2e862:;
+	if ((u32)t__2e860) goto L_passed_2e859; else goto L_failed_2e858;
+	L_failed_2e858:;
+	t_abortsite_2e606 = ((u64)21UL);
+	goto L_abort_2e901;
+	L_passed_2e859:;
+	t_cleanup_2e765 = (u64)(u32)((u64)6UL);
+	goto L_defer_2e887;
+	L_resume_2e908:;
+	goto L__2e598;
+	L__2e909:;
+	goto L__2e910;
+	L_defer_2e887:;
+	t__2e911 = (u64)(*(u64 *)t_binding_2e827);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e911);
+	L_defer_2e766:;
+	t__2e912 = (u64)(*(u64 *)t_binding_2e732);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e912);
+	t__2e914 = (u64)(u32)(((u32)t_cleanup_2e765 == (u32)((u64)6UL)));
+	if ((u32)t__2e914) goto L_resume_2e908; else goto L__2e913;
+	L__2e913:;
+	t__2e916 = (u64)(u32)(((u32)t_cleanup_2e765 == (u32)((u64)5UL)));
+	if ((u32)t__2e916) goto L_resume_2e907; else goto L__2e915;
+	L__2e915:;
+	t__2e918 = (u64)(u32)(((u32)t_cleanup_2e765 == (u32)((u64)4UL)));
+	if ((u32)t__2e918) goto L_resume_2e888; else goto L__2e917;
+	L__2e917:;
+	t__2e920 = (u64)(u32)(((u32)t_cleanup_2e765 == (u32)((u64)3UL)));
+	if ((u32)t__2e920) goto L_resume_2e851; else goto L__2e919;
+	L__2e919:;
+	t__2e922 = (u64)(u32)(((u32)t_cleanup_2e765 == (u32)((u64)2UL)));
+	if ((u32)t__2e922) goto L_resume_2e839; else goto L__2e921;
+	L__2e921:;
+	t__2e924 = (u64)(u32)(((u32)t_cleanup_2e765 == (u32)((u64)1UL)));
+	if ((u32)t__2e924) goto L_resume_2e775; else goto L__2e923;
+	L__2e923:;
+	goto L_resume_2e767;
+	L__2e910:;
+	L__2e598:;
+	return;
+	L_abort_2e607:;
+	t__2e608 = (u64)((u64)t_abortsite_2e606 * (u64)((u64)16UL));
+	t__2e608 = (u64)((u64)((u64)((char *)&D_abortsites_2e605)) + (u64)t__2e608);
+	t__2e609 = (u64)(*(u64 *)t__2e608);
+	t__2e610 = (u64)((u64)t__2e608 + (u64)((u64)8UL));
+	t__2e611 = (u64)(*(u32 *)t__2e610);
+	t__2e610 = (u64)((u64)t__2e608 + (u64)((u64)12UL));
+	t__2e612 = (u64)(*(u32 *)t__2e610);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e609, (u64)t__2e611, (u64)t__2e612, (u64)((u64)5UL));
+	__builtin_trap();
+	L_abort_2e618:;
+	t__2e619 = (u64)((u64)t_abortsite_2e606 * (u64)((u64)16UL));
+	t__2e619 = (u64)((u64)((u64)((char *)&D_abortsites_2e605)) + (u64)t__2e619);
+	t__2e620 = (u64)(*(u64 *)t__2e619);
+	t__2e621 = (u64)((u64)t__2e619 + (u64)((u64)8UL));
+	t__2e622 = (u64)(*(u32 *)t__2e621);
+	t__2e621 = (u64)((u64)t__2e619 + (u64)((u64)12UL));
+	t__2e623 = (u64)(*(u32 *)t__2e621);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e620, (u64)t__2e622, (u64)t__2e623, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e632:;
+	t__2e633 = (u64)((u64)t_abortsite_2e606 * (u64)((u64)16UL));
+	t__2e633 = (u64)((u64)((u64)((char *)&D_abortsites_2e605)) + (u64)t__2e633);
+	t__2e634 = (u64)(*(u64 *)t__2e633);
+	t__2e635 = (u64)((u64)t__2e633 + (u64)((u64)8UL));
+	t__2e636 = (u64)(*(u32 *)t__2e635);
+	t__2e635 = (u64)((u64)t__2e633 + (u64)((u64)12UL));
+	t__2e637 = (u64)(*(u32 *)t__2e635);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e634, (u64)t__2e636, (u64)t__2e637, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e759:;
+	t__2e760 = (u64)((u64)t_abortsite_2e606 * (u64)((u64)16UL));
+	t__2e760 = (u64)((u64)((u64)((char *)&D_abortsites_2e605)) + (u64)t__2e760);
+	t__2e761 = (u64)(*(u64 *)t__2e760);
+	t__2e762 = (u64)((u64)t__2e760 + (u64)((u64)8UL));
+	t__2e763 = (u64)(*(u32 *)t__2e762);
+	t__2e762 = (u64)((u64)t__2e760 + (u64)((u64)12UL));
+	t__2e764 = (u64)(*(u32 *)t__2e762);
+	t_cleanup_2e765 = (u64)(u32)((u64)0UL);
+	goto L_defer_2e766;
+	L_resume_2e767:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e761, (u64)t__2e763, (u64)t__2e764, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e769:;
+	t__2e770 = (u64)((u64)t_abortsite_2e606 * (u64)((u64)16UL));
+	t__2e770 = (u64)((u64)((u64)((char *)&D_abortsites_2e605)) + (u64)t__2e770);
+	t__2e771 = (u64)(*(u64 *)t__2e770);
+	t__2e772 = (u64)((u64)t__2e770 + (u64)((u64)8UL));
+	t__2e773 = (u64)(*(u32 *)t__2e772);
+	t__2e772 = (u64)((u64)t__2e770 + (u64)((u64)12UL));
+	t__2e774 = (u64)(*(u32 *)t__2e772);
+	t_cleanup_2e765 = (u64)(u32)((u64)1UL);
+	goto L_defer_2e766;
+	L_resume_2e775:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e771, (u64)t__2e773, (u64)t__2e774, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e833:;
+	t__2e834 = (u64)((u64)t_abortsite_2e606 * (u64)((u64)16UL));
+	t__2e834 = (u64)((u64)((u64)((char *)&D_abortsites_2e605)) + (u64)t__2e834);
+	t__2e835 = (u64)(*(u64 *)t__2e834);
+	t__2e836 = (u64)((u64)t__2e834 + (u64)((u64)8UL));
+	t__2e837 = (u64)(*(u32 *)t__2e836);
+	t__2e836 = (u64)((u64)t__2e834 + (u64)((u64)12UL));
+	t__2e838 = (u64)(*(u32 *)t__2e836);
+	t_cleanup_2e765 = (u64)(u32)((u64)2UL);
+	goto L_defer_2e766;
+	L_resume_2e839:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e835, (u64)t__2e837, (u64)t__2e838, (u64)((u64)5UL));
+	__builtin_trap();
+	L_abort_2e845:;
+	t__2e846 = (u64)((u64)t_abortsite_2e606 * (u64)((u64)16UL));
+	t__2e846 = (u64)((u64)((u64)((char *)&D_abortsites_2e605)) + (u64)t__2e846);
+	t__2e847 = (u64)(*(u64 *)t__2e846);
+	t__2e848 = (u64)((u64)t__2e846 + (u64)((u64)8UL));
+	t__2e849 = (u64)(*(u32 *)t__2e848);
+	t__2e848 = (u64)((u64)t__2e846 + (u64)((u64)12UL));
+	t__2e850 = (u64)(*(u32 *)t__2e848);
+	t_cleanup_2e765 = (u64)(u32)((u64)3UL);
+	goto L_defer_2e766;
+	L_resume_2e851:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e847, (u64)t__2e849, (u64)t__2e850, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e881:;
+	t__2e882 = (u64)((u64)t_abortsite_2e606 * (u64)((u64)16UL));
+	t__2e882 = (u64)((u64)((u64)((char *)&D_abortsites_2e605)) + (u64)t__2e882);
+	t__2e883 = (u64)(*(u64 *)t__2e882);
+	t__2e884 = (u64)((u64)t__2e882 + (u64)((u64)8UL));
+	t__2e885 = (u64)(*(u32 *)t__2e884);
+	t__2e884 = (u64)((u64)t__2e882 + (u64)((u64)12UL));
+	t__2e886 = (u64)(*(u32 *)t__2e884);
+	t_cleanup_2e765 = (u64)(u32)((u64)4UL);
+	goto L_defer_2e887;
+	L_resume_2e888:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e883, (u64)t__2e885, (u64)t__2e886, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e901:;
+	t__2e902 = (u64)((u64)t_abortsite_2e606 * (u64)((u64)16UL));
+	t__2e902 = (u64)((u64)((u64)((char *)&D_abortsites_2e605)) + (u64)t__2e902);
+	t__2e903 = (u64)(*(u64 *)t__2e902);
+	t__2e904 = (u64)((u64)t__2e902 + (u64)((u64)8UL));
+	t__2e905 = (u64)(*(u32 *)t__2e904);
+	t__2e904 = (u64)((u64)t__2e902 + (u64)((u64)12UL));
+	t__2e906 = (u64)(*(u32 *)t__2e904);
+	t_cleanup_2e765 = (u64)(u32)((u64)5UL);
+	goto L_defer_2e887;
+	L_resume_2e907:;
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e903, (u64)t__2e905, (u64)t__2e906, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_array(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[12] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[12] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[12] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[12] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	u64 t__2e1001;
+	u64 t__2e1002;
+	u64 t__2e930;
+	u64 t__2e932;
+	u64 t__2e934;
+	u64 t__2e936;
+	u64 t__2e938;
+	u64 t__2e940;
+	u64 t__2e941;
+	u64 t__2e943;
+	u64 t__2e945;
+	u64 t__2e947;
+	u64 t__2e948;
+	u64 t__2e950;
+	u64 t__2e952;
+	u64 t__2e953;
+	u64 t__2e959;
+	u64 t__2e960;
+	u64 t__2e961;
+	u64 t__2e962;
+	u64 t__2e963;
+	u64 t__2e966;
+	u64 t__2e969;
+	u64 t__2e971;
+	u64 t__2e972;
+	u64 t__2e973;
+	u64 t__2e974;
+	u64 t__2e975;
+	u64 t__2e978;
+	u64 t__2e979;
+	u64 t__2e980;
+	u64 t__2e981;
+	u64 t__2e982;
+	u64 t__2e989;
+	u64 t__2e990;
+	u64 t__2e995;
+	u64 t__2e996;
+	u64 t__2e997;
+	u64 t__2e998;
+	u64 t__2e999;
+	u64 t_abortsite_2e957;
+	u64 t_binding_2e929;
+	u64 t_binding_2e933;
+	u64 t_binding_2e937;
+	u64 t_binding_2e944;
+	u64 t_binding_2e951;
+	u64 t_binding_2e988;
+	u64 t_item_2e931;
+	u64 t_item_2e935;
+	u64 t_item_2e939;
+	u64 t_item_2e942;
+	u64 t_item_2e946;
+	u64 t_item_2e949;
+	u64 t_item_2e965;
+	L_start_2e925:;
+	t_binding_2e929 = (u64)A0;
+	t__2e930 = (u64)A1;
+	t_binding_2e933 = (u64)A2;
+	t__2e934 = (u64)A3;
+	t_binding_2e937 = (u64)A4;
+	t__2e938 = (u64)A5;
+	t_binding_2e944 = (u64)A6;
+	t__2e945 = (u64)A7;
+	t_binding_2e951 = (u64)A8;
+	t_binding_2e988 = (u64)A9;
+	L_body_2e926:;
+	t_item_2e931 = (u64)((u64)t__2e930 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e931 = (u32)((u64)0UL);
+	t__2e932 = (u64)((u64)t__2e930 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e932, (u64)t_item_2e931, (u64)((u64)8UL));
+	*(u64 *)t_binding_2e929 = (u64)t__2e930;
+	t_item_2e935 = (u64)((u64)t__2e934 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e935 = (u32)((u64)0UL);
+	t__2e936 = (u64)((u64)t__2e934 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e936, (u64)t_item_2e935, (u64)((u64)8UL));
+	*(u64 *)t_binding_2e933 = (u64)t__2e934;
+	t_item_2e939 = (u64)((u64)t__2e938 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e939 = (u32)((u64)0UL);
+	t__2e940 = (u64)((u64)t__2e938 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e940, (u64)t_item_2e939, (u64)((u64)8UL));
+	t_item_2e942 = (u64)((u64)t__2e938 + (u64)((u64)0UL));
+	t__2e943 = (u64)(u32)(*(i32 *)t_item_2e942);
+	t__2e941 = (u64)((u64)t__2e938 + (u64)((u64)4UL));
+	*(u32 *)t__2e941 = (u32)t__2e943;
+	t__2e941 = (u64)((u64)t__2e938 + (u64)((u64)8UL));
+	*(u32 *)t__2e941 = (u32)t__2e943;
+	*(u64 *)t_binding_2e937 = (u64)t__2e938;
+	t_item_2e946 = (u64)((u64)t__2e945 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e946 = (u32)((u64)0UL);
+	t__2e947 = (u64)((u64)t__2e945 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e947, (u64)t_item_2e946, (u64)((u64)8UL));
+	t_item_2e949 = (u64)((u64)t__2e945 + (u64)((u64)0UL));
+	t__2e950 = (u64)(u32)(*(i32 *)t_item_2e949);
+	t__2e948 = (u64)((u64)t__2e945 + (u64)((u64)4UL));
+	*(u32 *)t__2e948 = (u32)t__2e950;
+	t__2e948 = (u64)((u64)t__2e945 + (u64)((u64)8UL));
+	*(u32 *)t__2e948 = (u32)t__2e950;
+	*(u64 *)t_binding_2e944 = (u64)t__2e945;
+	t__2e952 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)96UL)));
+	t__2e953 = (u64)(u32)(((u64)t__2e952 != (u64)((u64)0UL)));
+	if ((u32)t__2e953) goto L__2e955; else goto L__2e954;
+	L__2e954:;
+	t_abortsite_2e957 = ((u64)0UL);
+	goto L_abort_2e958;
+	L__2e955:;
+	t_item_2e965 = (u64)((u64)t__2e952 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e965 = (u32)((u64)1UL);
+	t_item_2e965 = (u64)((u64)t__2e952 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e965 = (u32)((u64)2UL);
+	t__2e966 = (u64)((u64)t__2e952 + (u64)((u64)8UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e966, (u64)t_item_2e965, (u64)((u64)88UL));
+	*(u64 *)t_binding_2e951 = (u64)t__2e952;
+	t__2e969 = (u64)(u32)(((u64)((u64)24UL) == (u64)((u64)24UL)));
+	if ((u32)t__2e969) goto L_passed_2e968; else goto L_failed_2e967;
+	L_failed_2e967:;
+	t_abortsite_2e957 = ((u64)1UL);
+	goto L_abort_2e970;
+	L_passed_2e968:;
+	t__2e979 = (u64)(*(u64 *)t_binding_2e951);
+	t__2e981 = (u64)((i64)(i32)((u64)0UL));
+	t__2e980 = (u64)((u64)t__2e981 * (u64)((u64)4UL));
+	t__2e980 = (u64)((u64)t__2e979 + (u64)t__2e980);
+	t__2e982 = (u64)(u32)(*(i32 *)t__2e980);
+	t__2e978 = (u64)(u32)(((u32)t__2e982 == (u32)((u64)1UL)));
+	if ((u32)t__2e978) goto L_passed_2e977; else goto L_failed_2e976;
+	L_failed_2e976:;
+	t_abortsite_2e957 = ((u64)2UL);
+	goto L_abort_2e970;
+	L_passed_2e977:;
+	*(u64 *)t_binding_2e988 = (u64)((u64)1UL);
+	L_loop_2e983:;
+	t__2e990 = (u64)(*(u64 *)t_binding_2e988);
+	t__2e989 = (u64)(u32)(((u64)t__2e990 < (u64)((u64)24UL)));
+	if ((u32)t__2e989) goto L_body_2e984; else goto L__2e986;
+	L_body_2e984:;
+	t__2e996 = (u64)(*(u64 *)t_binding_2e951);
+	t__2e998 = (u64)(*(u64 *)t_binding_2e988);
+	t__2e997 = (u64)((u64)t__2e998 * (u64)((u64)4UL));
+	t__2e997 = (u64)((u64)t__2e996 + (u64)t__2e997);
+	t__2e999 = (u64)(u32)(*(i32 *)t__2e997);
+	t__2e995 = (u64)(u32)(((u32)t__2e999 == (u32)((u64)2UL)));
+	if ((u32)t__2e995) goto L_passed_2e994; else goto L_failed_2e993;
+	L_failed_2e993:;
+	t_abortsite_2e957 = ((u64)3UL);
+	goto L_abort_2e970;
+	L_passed_2e994:;
+	goto L__2e991;
+	L__2e1000:;
+	L__2e991:;
+	L_after_2e987:;
+	t__2e1001 = (u64)(*(u64 *)t_binding_2e988);
+	t__2e1001 = (u64)((u64)t__2e1001 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e988 = (u64)t__2e1001;
+	goto L_loop_2e983;
+	L__2e986:;
+	t__2e1002 = (u64)(*(u64 *)t_binding_2e951);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e1002);
+	goto L__2e927;
+	L__2e1003:;
+	L__2e927:;
+	return;
+	L_abort_2e958:;
+	t__2e959 = (u64)((u64)t_abortsite_2e957 * (u64)((u64)16UL));
+	t__2e959 = (u64)((u64)((u64)((char *)&D_abortsites_2e956)) + (u64)t__2e959);
+	t__2e960 = (u64)(*(u64 *)t__2e959);
+	t__2e961 = (u64)((u64)t__2e959 + (u64)((u64)8UL));
+	t__2e962 = (u64)(*(u32 *)t__2e961);
+	t__2e961 = (u64)((u64)t__2e959 + (u64)((u64)12UL));
+	t__2e963 = (u64)(*(u32 *)t__2e961);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e960, (u64)t__2e962, (u64)t__2e963, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e970:;
+	t__2e971 = (u64)((u64)t_abortsite_2e957 * (u64)((u64)16UL));
+	t__2e971 = (u64)((u64)((u64)((char *)&D_abortsites_2e956)) + (u64)t__2e971);
+	t__2e972 = (u64)(*(u64 *)t__2e971);
+	t__2e973 = (u64)((u64)t__2e971 + (u64)((u64)8UL));
+	t__2e974 = (u64)(*(u32 *)t__2e973);
+	t__2e973 = (u64)((u64)t__2e971 + (u64)((u64)12UL));
+	t__2e975 = (u64)(*(u32 *)t__2e973);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e972, (u64)t__2e974, (u64)t__2e975, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_double__alloc(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e1009;
+	u64 t__2e1010;
+	u64 t__2e1016;
+	u64 t__2e1017;
+	u64 t__2e1018;
+	u64 t__2e1019;
+	u64 t__2e1020;
+	u64 t__2e1022;
+	u64 t__2e1023;
+	u64 t__2e1028;
+	u64 t__2e1031;
+	u64 t__2e1032;
+	u64 t__2e1033;
+	u64 t__2e1034;
+	u64 t__2e1035;
+	u64 t__2e1036;
+	u64 t__2e1037;
+	u64 t__2e1038;
+	u64 t__2e1040;
+	u64 t__2e1041;
+	u64 t__2e1042;
+	u64 t__2e1043;
+	u64 t__2e1044;
+	u64 t__2e1045;
+	u64 t__2e1046;
+	u64 t_abortsite_2e1014;
+	u64 t_binding_2e1008;
+	u64 t_binding_2e1021;
+	L_start_2e1004:;
+	t_binding_2e1008 = (u64)A0;
+	t_binding_2e1021 = (u64)A1;
+	L_body_2e1005:;
+	t__2e1009 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)4UL)));
+	t__2e1010 = (u64)(u32)(((u64)t__2e1009 != (u64)((u64)0UL)));
+	if ((u32)t__2e1010) goto L__2e1012; else goto L__2e1011;
+	L__2e1011:;
+	t_abortsite_2e1014 = ((u64)0UL);
+	goto L_abort_2e1015;
+	L__2e1012:;
+	*(u32 *)t__2e1009 = (u32)((u64)1234UL);
+	*(u64 *)t_binding_2e1008 = (u64)t__2e1009;
+	t__2e1022 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)4UL)));
+	t__2e1023 = (u64)(u32)(((u64)t__2e1022 != (u64)((u64)0UL)));
+	if ((u32)t__2e1023) goto L__2e1025; else goto L__2e1024;
+	L__2e1024:;
+	t_abortsite_2e1014 = ((u64)1UL);
+	goto L_abort_2e1015;
+	L__2e1025:;
+	*(u32 *)t__2e1022 = (u32)((u64)4321UL);
+	*(u64 *)t_binding_2e1021 = (u64)t__2e1022;
+	t__2e1032 = (u64)(*(u64 *)t_binding_2e1008);
+	t__2e1033 = (u64)(*(u64 *)t_binding_2e1021);
+	t__2e1031 = (u64)(u32)(((u64)t__2e1032 != (u64)t__2e1033));
+	t__2e1028 = (u64)(u32)t__2e1031;
+	if ((u32)t__2e1028) goto L__2e1029; else goto L__2e1030;
+	L__2e1029:;
+	t__2e1035 = (u64)(*(u64 *)t_binding_2e1008);
+	t__2e1036 = (u64)(u32)(*(i32 *)t__2e1035);
+	t__2e1037 = (u64)(*(u64 *)t_binding_2e1021);
+	t__2e1038 = (u64)(u32)(*(i32 *)t__2e1037);
+	t__2e1034 = (u64)(u32)(((u32)t__2e1036 != (u32)t__2e1038));
+	t__2e1028 = (u64)(u32)t__2e1034;
+	goto L__2e1030;
+	L__2e1030:;
+	if ((u32)t__2e1028) goto L_passed_2e1027; else goto L_failed_2e1026;
+	L_failed_2e1026:;
+	t_abortsite_2e1014 = ((u64)2UL);
+	goto L_abort_2e1039;
+	L_passed_2e1027:;
+	t__2e1045 = (u64)(*(u64 *)t_binding_2e1008);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e1045);
+	t__2e1046 = (u64)(*(u64 *)t_binding_2e1021);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e1046);
+	goto L__2e1006;
+	L__2e1047:;
+	L__2e1006:;
+	return;
+	L_abort_2e1015:;
+	t__2e1016 = (u64)((u64)t_abortsite_2e1014 * (u64)((u64)16UL));
+	t__2e1016 = (u64)((u64)((u64)((char *)&D_abortsites_2e1013)) + (u64)t__2e1016);
+	t__2e1017 = (u64)(*(u64 *)t__2e1016);
+	t__2e1018 = (u64)((u64)t__2e1016 + (u64)((u64)8UL));
+	t__2e1019 = (u64)(*(u32 *)t__2e1018);
+	t__2e1018 = (u64)((u64)t__2e1016 + (u64)((u64)12UL));
+	t__2e1020 = (u64)(*(u32 *)t__2e1018);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1017, (u64)t__2e1019, (u64)t__2e1020, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e1039:;
+	t__2e1040 = (u64)((u64)t_abortsite_2e1014 * (u64)((u64)16UL));
+	t__2e1040 = (u64)((u64)((u64)((char *)&D_abortsites_2e1013)) + (u64)t__2e1040);
+	t__2e1041 = (u64)(*(u64 *)t__2e1040);
+	t__2e1042 = (u64)((u64)t__2e1040 + (u64)((u64)8UL));
+	t__2e1043 = (u64)(*(u32 *)t__2e1042);
+	t__2e1042 = (u64)((u64)t__2e1040 + (u64)((u64)12UL));
+	t__2e1044 = (u64)(*(u32 *)t__2e1042);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1041, (u64)t__2e1043, (u64)t__2e1044, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_double__pointer(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e1053;
+	u64 t__2e1054;
+	u64 t__2e1060;
+	u64 t__2e1061;
+	u64 t__2e1062;
+	u64 t__2e1063;
+	u64 t__2e1064;
+	u64 t__2e1066;
+	u64 t__2e1067;
+	u64 t__2e1068;
+	u64 t__2e1071;
+	u64 t__2e1072;
+	u64 t__2e1073;
+	u64 t__2e1074;
+	u64 t__2e1076;
+	u64 t__2e1077;
+	u64 t__2e1078;
+	u64 t__2e1079;
+	u64 t__2e1080;
+	u64 t__2e1081;
+	u64 t__2e1082;
+	u64 t__2e1085;
+	u64 t__2e1086;
+	u64 t__2e1087;
+	u64 t__2e1088;
+	u64 t_abortsite_2e1058;
+	u64 t_binding_2e1052;
+	u64 t_binding_2e1065;
+	L_start_2e1048:;
+	t_binding_2e1052 = (u64)A0;
+	t_binding_2e1065 = (u64)A1;
+	t__2e1066 = (u64)A2;
+	L_body_2e1049:;
+	t__2e1053 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)4UL)));
+	t__2e1054 = (u64)(u32)(((u64)t__2e1053 != (u64)((u64)0UL)));
+	if ((u32)t__2e1054) goto L__2e1056; else goto L__2e1055;
+	L__2e1055:;
+	t_abortsite_2e1058 = ((u64)0UL);
+	goto L_abort_2e1059;
+	L__2e1056:;
+	*(u32 *)t__2e1053 = (u32)((u64)1234UL);
+	*(u64 *)t_binding_2e1052 = (u64)t__2e1053;
+	t__2e1067 = (u64)(*(u64 *)t_binding_2e1052);
+	*(u64 *)t__2e1066 = (u64)t__2e1067;
+	*(u64 *)t_binding_2e1065 = (u64)t__2e1066;
+	t__2e1068 = (u64)(*(u64 *)t_binding_2e1052);
+	*(u32 *)t__2e1068 = (u32)((u64)4321UL);
+	t__2e1072 = (u64)(*(u64 *)t_binding_2e1065);
+	t__2e1073 = (u64)(*(u64 *)t__2e1072);
+	t__2e1074 = (u64)(u32)(*(i32 *)t__2e1073);
+	t__2e1071 = (u64)(u32)(((u32)t__2e1074 == (u32)((u64)4321UL)));
+	if ((u32)t__2e1071) goto L_passed_2e1070; else goto L_failed_2e1069;
+	L_failed_2e1069:;
+	t_abortsite_2e1058 = ((u64)1UL);
+	goto L_abort_2e1075;
+	L_passed_2e1070:;
+	t__2e1081 = (u64)(*(u64 *)t_binding_2e1065);
+	t__2e1082 = (u64)(*(u64 *)t__2e1081);
+	*(u32 *)t__2e1082 = (u32)((u64)1337UL);
+	t__2e1086 = (u64)(*(u64 *)t_binding_2e1052);
+	t__2e1087 = (u64)(u32)(*(i32 *)t__2e1086);
+	t__2e1085 = (u64)(u32)(((u32)t__2e1087 == (u32)((u64)1337UL)));
+	if ((u32)t__2e1085) goto L_passed_2e1084; else goto L_failed_2e1083;
+	L_failed_2e1083:;
+	t_abortsite_2e1058 = ((u64)2UL);
+	goto L_abort_2e1075;
+	L_passed_2e1084:;
+	t__2e1088 = (u64)(*(u64 *)t_binding_2e1052);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e1088);
+	goto L__2e1050;
+	L__2e1089:;
+	L__2e1050:;
+	return;
+	L_abort_2e1059:;
+	t__2e1060 = (u64)((u64)t_abortsite_2e1058 * (u64)((u64)16UL));
+	t__2e1060 = (u64)((u64)((u64)((char *)&D_abortsites_2e1057)) + (u64)t__2e1060);
+	t__2e1061 = (u64)(*(u64 *)t__2e1060);
+	t__2e1062 = (u64)((u64)t__2e1060 + (u64)((u64)8UL));
+	t__2e1063 = (u64)(*(u32 *)t__2e1062);
+	t__2e1062 = (u64)((u64)t__2e1060 + (u64)((u64)12UL));
+	t__2e1064 = (u64)(*(u32 *)t__2e1062);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1061, (u64)t__2e1063, (u64)t__2e1064, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e1075:;
+	t__2e1076 = (u64)((u64)t_abortsite_2e1058 * (u64)((u64)16UL));
+	t__2e1076 = (u64)((u64)((u64)((char *)&D_abortsites_2e1057)) + (u64)t__2e1076);
+	t__2e1077 = (u64)(*(u64 *)t__2e1076);
+	t__2e1078 = (u64)((u64)t__2e1076 + (u64)((u64)8UL));
+	t__2e1079 = (u64)(*(u32 *)t__2e1078);
+	t__2e1078 = (u64)((u64)t__2e1076 + (u64)((u64)12UL));
+	t__2e1080 = (u64)(*(u32 *)t__2e1078);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1077, (u64)t__2e1079, (u64)t__2e1080, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_allocation(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[4] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[4] __attribute__((aligned(16)));
+	u64 t__2e1095;
+	u64 t__2e1098;
+	u64 t__2e1099;
+	u64 t__2e1100;
+	u64 t__2e1104;
+	u64 t__2e1105;
+	u64 t__2e1106;
+	u64 t__2e1107;
+	u64 t__2e1108;
+	u64 t__2e1110;
+	u64 t__2e1115;
+	u64 t__2e1116;
+	u64 t__2e1117;
+	u64 t__2e1118;
+	u64 t__2e1123;
+	u64 t__2e1124;
+	u64 t__2e1125;
+	u64 t__2e1127;
+	u64 t__2e1129;
+	u64 t__2e1130;
+	u64 t__2e1134;
+	u64 t__2e1135;
+	u64 t__2e1136;
+	u64 t__2e1137;
+	u64 t__2e1138;
+	u64 t__2e1143;
+	u64 t__2e1146;
+	u64 t__2e1147;
+	u64 t__2e1149;
+	u64 t__2e1150;
+	u64 t__2e1151;
+	u64 t__2e1153;
+	u64 t__2e1154;
+	u64 t__2e1156;
+	u64 t__2e1159;
+	u64 t__2e1160;
+	u64 t__2e1161;
+	u64 t__2e1163;
+	u64 t__2e1166;
+	u64 t__2e1167;
+	u64 t__2e1168;
+	u64 t_abortsite_2e1102;
+	u64 t_binding_2e1094;
+	u64 t_binding_2e1109;
+	u64 t_binding_2e1128;
+	u64 t_binding_2e1155;
+	u64 t_binding_2e1162;
+	u64 t_field_2e1140;
+	u64 t_field_2e1148;
+	u64 t_field_2e1152;
+	L_start_2e1090:;
+	t_binding_2e1094 = (u64)A0;
+	t__2e1095 = (u64)A1;
+	t_binding_2e1109 = (u64)A2;
+	t_binding_2e1128 = (u64)A3;
+	t_binding_2e1155 = (u64)A4;
+	t__2e1156 = (u64)A5;
+	t_binding_2e1162 = (u64)A6;
+	t__2e1163 = (u64)A7;
+	L_body_2e1091:;
+	*(u32 *)t__2e1095 = (u32)((u64)1234UL);
+	*(u64 *)t_binding_2e1094 = (u64)t__2e1095;
+	t__2e1099 = (u64)(*(u64 *)t_binding_2e1094);
+	t__2e1100 = (u64)(u32)(*(i32 *)t__2e1099);
+	t__2e1098 = (u64)(u32)(((u32)t__2e1100 == (u32)((u64)1234UL)));
+	if ((u32)t__2e1098) goto L_passed_2e1097; else goto L_failed_2e1096;
+	L_failed_2e1096:;
+	t_abortsite_2e1102 = ((u64)0UL);
+	goto L_abort_2e1103;
+	L_passed_2e1097:;
+	t__2e1110 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)4UL)));
+	*(u32 *)t__2e1110 = (u32)((u64)1234UL);
+	*(u64 *)t_binding_2e1109 = (u64)t__2e1110;
+	t__2e1116 = (u64)(*(u64 *)t_binding_2e1109);
+	t__2e1117 = ((u64)0UL);
+	t__2e1115 = (u64)(u32)(((u64)t__2e1116 != (u64)t__2e1117));
+	t__2e1118 = (u64)(u32)((u8)t__2e1115);
+	if ((u32)t__2e1118) goto L_true_2e1112; else goto L_false_2e1113;
+	L_true_2e1112:;
+	t__2e1124 = (u64)(*(u64 *)t_binding_2e1109);
+	t__2e1125 = (u64)(u32)(*(i32 *)t__2e1124);
+	t__2e1123 = (u64)(u32)(((u32)t__2e1125 == (u32)((u64)1234UL)));
+	if ((u32)t__2e1123) goto L_passed_2e1122; else goto L_failed_2e1121;
+	L_failed_2e1121:;
+	t_abortsite_2e1102 = ((u64)1UL);
+	goto L_abort_2e1103;
+	L_passed_2e1122:;
+	goto L__2e1119;
+	L__2e1126:;
+	L__2e1119:;
+	goto L__2e1114;
+	L_false_2e1113:;
+	L__2e1114:;
+	t__2e1127 = (u64)(*(u64 *)t_binding_2e1109);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e1127);
+	t__2e1129 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)8UL)));
+	t__2e1130 = (u64)(u32)(((u64)t__2e1129 != (u64)((u64)0UL)));
+	if ((u32)t__2e1130) goto L__2e1132; else goto L__2e1131;
+	L__2e1131:;
+	t_abortsite_2e1102 = ((u64)2UL);
+	goto L_abort_2e1133;
+	L__2e1132:;
+	t_field_2e1140 = (u64)((u64)t__2e1129 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e1140 = (u32)((u64)42UL);
+	t_field_2e1140 = (u64)((u64)t__2e1129 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e1140 = (u32)((u64)69UL);
+	*(u64 *)t_binding_2e1128 = (u64)t__2e1129;
+	t__2e1147 = (u64)(*(u64 *)t_binding_2e1128);
+	t_field_2e1148 = (u64)((u64)t__2e1147 + (u64)((u64)0UL));
+	t__2e1149 = (u64)(u32)(*(i32 *)t_field_2e1148);
+	t__2e1146 = (u64)(u32)(((u32)t__2e1149 == (u32)((u64)42UL)));
+	t__2e1143 = (u64)(u32)t__2e1146;
+	if ((u32)t__2e1143) goto L__2e1144; else goto L__2e1145;
+	L__2e1144:;
+	t__2e1151 = (u64)(*(u64 *)t_binding_2e1128);
+	t_field_2e1152 = (u64)((u64)t__2e1151 + (u64)((u64)4UL));
+	t__2e1153 = (u64)(u32)(*(i32 *)t_field_2e1152);
+	t__2e1150 = (u64)(u32)(((u32)t__2e1153 == (u32)((u64)69UL)));
+	t__2e1143 = (u64)(u32)t__2e1150;
+	goto L__2e1145;
+	L__2e1145:;
+	if ((u32)t__2e1143) goto L_passed_2e1142; else goto L_failed_2e1141;
+	L_failed_2e1141:;
+	t_abortsite_2e1102 = ((u64)3UL);
+	goto L_abort_2e1103;
+	L_passed_2e1142:;
+	t__2e1154 = (u64)(*(u64 *)t_binding_2e1128);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e1154);
+	*(u32 *)t__2e1156 = (u32)((u64)1234UL);
+	*(u64 *)t_binding_2e1155 = (u64)t__2e1156;
+	t__2e1160 = (u64)(*(u64 *)t_binding_2e1155);
+	t__2e1161 = (u64)(u32)(*(i32 *)t__2e1160);
+	t__2e1159 = (u64)(u32)(((u32)t__2e1161 == (u32)((u64)1234UL)));
+	if ((u32)t__2e1159) goto L_passed_2e1158; else goto L_failed_2e1157;
+	L_failed_2e1157:;
+	t_abortsite_2e1102 = ((u64)4UL);
+	goto L_abort_2e1103;
+	L_passed_2e1158:;
+	*(u32 *)t__2e1163 = (u32)((u64)1234UL);
+	*(u64 *)t_binding_2e1162 = (u64)t__2e1163;
+	t__2e1167 = (u64)(*(u64 *)t_binding_2e1162);
+	t__2e1168 = (u64)(u32)(*(u32 *)t__2e1167);
+	t__2e1166 = (u64)(u32)(((u32)t__2e1168 == (u32)((u64)1234UL)));
+	if ((u32)t__2e1166) goto L_passed_2e1165; else goto L_failed_2e1164;
+	L_failed_2e1164:;
+	t_abortsite_2e1102 = ((u64)5UL);
+	goto L_abort_2e1103;
+	L_passed_2e1165:;
+	goto L__2e1092;
+	L__2e1169:;
+	L__2e1092:;
+	return;
+	L_abort_2e1103:;
+	t__2e1104 = (u64)((u64)t_abortsite_2e1102 * (u64)((u64)16UL));
+	t__2e1104 = (u64)((u64)((u64)((char *)&D_abortsites_2e1101)) + (u64)t__2e1104);
+	t__2e1105 = (u64)(*(u64 *)t__2e1104);
+	t__2e1106 = (u64)((u64)t__2e1104 + (u64)((u64)8UL));
+	t__2e1107 = (u64)(*(u32 *)t__2e1106);
+	t__2e1106 = (u64)((u64)t__2e1104 + (u64)((u64)12UL));
+	t__2e1108 = (u64)(*(u32 *)t__2e1106);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1105, (u64)t__2e1107, (u64)t__2e1108, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1133:;
+	t__2e1134 = (u64)((u64)t_abortsite_2e1102 * (u64)((u64)16UL));
+	t__2e1134 = (u64)((u64)((u64)((char *)&D_abortsites_2e1101)) + (u64)t__2e1134);
+	t__2e1135 = (u64)(*(u64 *)t__2e1134);
+	t__2e1136 = (u64)((u64)t__2e1134 + (u64)((u64)8UL));
+	t__2e1137 = (u64)(*(u32 *)t__2e1136);
+	t__2e1136 = (u64)((u64)t__2e1134 + (u64)((u64)12UL));
+	t__2e1138 = (u64)(*(u32 *)t__2e1136);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1135, (u64)t__2e1137, (u64)t__2e1138, (u64)((u64)2UL));
+	__builtin_trap();
+}
+static void F_assignment(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e1175;
+	u64 t__2e1176;
+	u64 t__2e1179;
+	u64 t__2e1180;
+	u64 t__2e1181;
+	u64 t__2e1185;
+	u64 t__2e1186;
+	u64 t__2e1187;
+	u64 t__2e1188;
+	u64 t__2e1189;
+	u64 t_abortsite_2e1183;
+	u64 t_binding_2e1174;
+	L_start_2e1170:;
+	t_binding_2e1174 = (u64)A0;
+	t__2e1175 = (u64)A1;
+	L_body_2e1171:;
+	*(u32 *)t__2e1175 = (u32)((u64)1234UL);
+	*(u64 *)t_binding_2e1174 = (u64)t__2e1175;
+	t__2e1176 = (u64)(*(u64 *)t_binding_2e1174);
+	*(u32 *)t__2e1176 = (u32)((u64)4321UL);
+	t__2e1180 = (u64)(*(u64 *)t_binding_2e1174);
+	t__2e1181 = (u64)(u32)(*(i32 *)t__2e1180);
+	t__2e1179 = (u64)(u32)(((u32)t__2e1181 == (u32)((u64)4321UL)));
+	if ((u32)t__2e1179) goto L_passed_2e1178; else goto L_failed_2e1177;
+	L_failed_2e1177:;
+	t_abortsite_2e1183 = ((u64)0UL);
+	goto L_abort_2e1184;
+	L_passed_2e1178:;
+	goto L__2e1172;
+	L__2e1190:;
+	L__2e1172:;
+	return;
+	L_abort_2e1184:;
+	t__2e1185 = (u64)((u64)t_abortsite_2e1183 * (u64)((u64)16UL));
+	t__2e1185 = (u64)((u64)((u64)((char *)&D_abortsites_2e1182)) + (u64)t__2e1185);
+	t__2e1186 = (u64)(*(u64 *)t__2e1185);
+	t__2e1187 = (u64)((u64)t__2e1185 + (u64)((u64)8UL));
+	t__2e1188 = (u64)(*(u32 *)t__2e1187);
+	t__2e1187 = (u64)((u64)t__2e1185 + (u64)((u64)12UL));
+	t__2e1189 = (u64)(*(u32 *)t__2e1187);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1186, (u64)t__2e1188, (u64)t__2e1189, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,3208 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e74 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e75 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strliteral_2e139 { u64 f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e34 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; };
+struct __attribute__((packed)) S_abortsites_2e261 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e431 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e516 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e561 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e611 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_abortsites_2e763 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_abortsites_2e846 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; };
+struct __attribute__((packed)) S_abortsites_2e1121 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e1172 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_abortsites_2e1294 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e1348 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_abortsites_2e1421 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_strdata_2e1495 { u8 f0[2]; };
+struct __attribute__((packed)) S_strliteral_2e1496 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e1472 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e1551 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e74 D_strdata_2e74 __asm__("strdata.74") __attribute__((used, section(".rodata.strdata.74"), aligned(8)));
+static struct S_strliteral_2e75 D_strliteral_2e75 __asm__("strliteral.75") __attribute__((used, section(".data.rel.ro.strliteral.75"), aligned(8)));
+static const struct S_strliteral_2e139 D_strliteral_2e139 __asm__("strliteral.139") __attribute__((used, section(".rodata.strliteral.139"), aligned(8)));
+static struct S_abortsites_2e34 D_abortsites_2e34 __asm__("abortsites.34") __attribute__((used, section(".data.rel.ro.abortsites.34"), aligned(8)));
+static struct S_abortsites_2e261 D_abortsites_2e261 __asm__("abortsites.261") __attribute__((used, section(".data.rel.ro.abortsites.261"), aligned(8)));
+static struct S_abortsites_2e431 D_abortsites_2e431 __asm__("abortsites.431") __attribute__((used, section(".data.rel.ro.abortsites.431"), aligned(8)));
+static struct S_abortsites_2e516 D_abortsites_2e516 __asm__("abortsites.516") __attribute__((used, section(".data.rel.ro.abortsites.516"), aligned(8)));
+static struct S_abortsites_2e561 D_abortsites_2e561 __asm__("abortsites.561") __attribute__((used, section(".data.rel.ro.abortsites.561"), aligned(8)));
+static struct S_abortsites_2e611 D_abortsites_2e611 __asm__("abortsites.611") __attribute__((used, section(".data.rel.ro.abortsites.611"), aligned(8)));
+static struct S_abortsites_2e763 D_abortsites_2e763 __asm__("abortsites.763") __attribute__((used, section(".data.rel.ro.abortsites.763"), aligned(8)));
+static struct S_abortsites_2e846 D_abortsites_2e846 __asm__("abortsites.846") __attribute__((used, section(".data.rel.ro.abortsites.846"), aligned(8)));
+static struct S_abortsites_2e1121 D_abortsites_2e1121 __asm__("abortsites.1121") __attribute__((used, section(".data.rel.ro.abortsites.1121"), aligned(8)));
+static struct S_abortsites_2e1172 D_abortsites_2e1172 __asm__("abortsites.1172") __attribute__((used, section(".data.rel.ro.abortsites.1172"), aligned(8)));
+static struct S_abortsites_2e1294 D_abortsites_2e1294 __asm__("abortsites.1294") __attribute__((used, section(".data.rel.ro.abortsites.1294"), aligned(8)));
+static struct S_abortsites_2e1348 D_abortsites_2e1348 __asm__("abortsites.1348") __attribute__((used, section(".data.rel.ro.abortsites.1348"), aligned(8)));
+static struct S_abortsites_2e1421 D_abortsites_2e1421 __asm__("abortsites.1421") __attribute__((used, section(".data.rel.ro.abortsites.1421"), aligned(8)));
+static const struct S_strdata_2e1495 D_strdata_2e1495 __asm__("strdata.1495") __attribute__((used, section(".rodata.strdata.1495"), aligned(8)));
+static struct S_strliteral_2e1496 D_strliteral_2e1496 __asm__("strliteral.1496") __attribute__((used, section(".data.rel.ro.strliteral.1496"), aligned(8)));
+static struct S_abortsites_2e1472 D_abortsites_2e1472 __asm__("abortsites.1472") __attribute__((used, section(".data.rel.ro.abortsites.1472"), aligned(8)));
+static struct S_abortsites_2e1551 D_abortsites_2e1551 __asm__("abortsites.1551") __attribute__((used, section(".data.rel.ro.abortsites.1551"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_dispatch(void) __asm__("dispatch") __attribute__((used, section(".text.dispatch")));
+static u32 F_classify__small(u64 p_x) __asm__("classify_small") __attribute__((used, section(".text.classify_small")));
+static u32 F_classify(u64 p_x) __asm__("classify") __attribute__((used, section(".text.classify")));
+static void F_label(void) __asm__("label") __attribute__((used, section(".text.label")));
+static void F_binding(void) __asm__("binding") __attribute__((used, section(".text.binding")));
+static void F_alignment__conversion(void) __asm__("alignment_conversion") __attribute__((used, section(".text.alignment_conversion")));
+static void F_numeric(void) __asm__("numeric") __attribute__((used, section(".text.numeric")));
+static void F_transitivity(void) __asm__("transitivity") __attribute__((used, section(".text.transitivity")));
+static void F_implicit__cast(void) __asm__("implicit_cast") __attribute__((used, section(".text.implicit_cast")));
+static void F_tagged__result(void) __asm__("tagged_result") __attribute__((used, section(".text.tagged_result")));
+static void F_alias(void) __asm__("alias") __attribute__((used, section(".text.alias")));
+static void F_pointer(void) __asm__("pointer") __attribute__((used, section(".text.pointer")));
+static void F___default(void) __asm__("_default") __attribute__((used, section(".text._default")));
+static void F___never(void) __asm__("_never") __attribute__((used, section(".text._never")));
+static void F_tagged(void) __asm__("tagged") __attribute__((used, section(".text.tagged")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\061\070\055\155\141\164\143\150\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 17U, 17U };
+static const struct S_strdata_2e74 D_strdata_2e74 = { "\150\145\154\154\157" };
+static struct S_strliteral_2e75 D_strliteral_2e75 = { (char *)((char *)&D_strdata_2e74) + 0, 5U, 5U };
+static const struct S_strliteral_2e139 D_strliteral_2e139 = { 0U, 0U, 0U };
+static struct S_abortsites_2e34 D_abortsites_2e34 = { (char *)((char *)&D_strliteral_2e1) + 0, 312U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 313U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 314U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 315U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 316U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 317U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 318U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 319U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 320U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 321U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 322U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 323U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 324U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 326U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 327U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 328U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 329U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 330U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 331U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 332U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 333U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 334U, 15U };
+static struct S_abortsites_2e261 D_abortsites_2e261 = { (char *)((char *)&D_strliteral_2e1) + 0, 295U, 29U, (char *)((char *)&D_strliteral_2e1) + 0, 295U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 291U, 14U };
+static struct S_abortsites_2e431 D_abortsites_2e431 = { (char *)((char *)&D_strliteral_2e1) + 0, 275U, 40U, (char *)((char *)&D_strliteral_2e1) + 0, 275U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 267U, 14U };
+static struct S_abortsites_2e516 D_abortsites_2e516 = { (char *)((char *)&D_strliteral_2e1) + 0, 258U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 260U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 255U, 14U };
+static struct S_abortsites_2e561 D_abortsites_2e561 = { (char *)((char *)&D_strliteral_2e1) + 0, 248U, 14U };
+static struct S_abortsites_2e611 D_abortsites_2e611 = { (char *)((char *)&D_strliteral_2e1) + 0, 237U, 28U, (char *)((char *)&D_strliteral_2e1) + 0, 237U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 239U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 235U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 243U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 243U, 15U };
+static struct S_abortsites_2e763 D_abortsites_2e763 = { (char *)((char *)&D_strliteral_2e1) + 0, 223U, 31U, (char *)((char *)&D_strliteral_2e1) + 0, 225U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 220U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 228U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 218U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 230U, 15U };
+static struct S_abortsites_2e846 D_abortsites_2e846 = { (char *)((char *)&D_strliteral_2e1) + 0, 141U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 145U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 139U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 151U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 155U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 149U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 157U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 163U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 165U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 161U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 169U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 175U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 177U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 172U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 179U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 187U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 189U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 191U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 197U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 201U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 195U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 203U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 210U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 206U, 14U };
+static struct S_abortsites_2e1121 D_abortsites_2e1121 = { (char *)((char *)&D_strliteral_2e1) + 0, 128U, 38U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 15U };
+static struct S_abortsites_2e1172 D_abortsites_2e1172 = { (char *)((char *)&D_strliteral_2e1) + 0, 99U, 36U, (char *)((char *)&D_strliteral_2e1) + 0, 105U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 18U, (char *)((char *)&D_strliteral_2e1) + 0, 114U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 120U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 119U, 14U };
+static struct S_abortsites_2e1294 D_abortsites_2e1294 = { (char *)((char *)&D_strliteral_2e1) + 0, 87U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 93U, 37U, (char *)((char *)&D_strliteral_2e1) + 0, 93U, 23U };
+static struct S_abortsites_2e1348 D_abortsites_2e1348 = { (char *)((char *)&D_strliteral_2e1) + 0, 69U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 65U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 71U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 74U, 18U, (char *)((char *)&D_strliteral_2e1) + 0, 80U, 15U };
+static struct S_abortsites_2e1421 D_abortsites_2e1421 = { (char *)((char *)&D_strliteral_2e1) + 0, 53U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 15U };
+static const struct S_strdata_2e1495 D_strdata_2e1495 = { "\150\151" };
+static struct S_strliteral_2e1496 D_strliteral_2e1496 = { (char *)((char *)&D_strdata_2e1495) + 0, 2U, 2U };
+static struct S_abortsites_2e1472 D_abortsites_2e1472 = { (char *)((char *)&D_strliteral_2e1) + 0, 42U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 38U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 46U, 23U };
+static struct S_abortsites_2e1551 D_abortsites_2e1551 = { (char *)((char *)&D_strliteral_2e1) + 0, 23U, 36U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 23U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_tagged)))();
+	((void (*)(void))((u64)((char *)&F___never)))();
+	((void (*)(void))((u64)((char *)&F___default)))();
+	((void (*)(void))((u64)((char *)&F_pointer)))();
+	((void (*)(void))((u64)((char *)&F_alias)))();
+	((void (*)(void))((u64)((char *)&F_tagged__result)))();
+	((void (*)(void))((u64)((char *)&F_implicit__cast)))();
+	((void (*)(void))((u64)((char *)&F_transitivity)))();
+	((void (*)(void))((u64)((char *)&F_numeric)))();
+	((void (*)(void))((u64)((char *)&F_alignment__conversion)))();
+	((void (*)(void))((u64)((char *)&F_binding)))();
+	((void (*)(void))((u64)((char *)&F_label)))();
+	((void (*)(void))((u64)((char *)&F_dispatch)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_dispatch(void) {
+	char A0[32] __attribute__((aligned(16)));
+	char A1[32] __attribute__((aligned(16)));
+	char A2[32] __attribute__((aligned(16)));
+	char A3[32] __attribute__((aligned(16)));
+	char A4[32] __attribute__((aligned(16)));
+	char A5[32] __attribute__((aligned(16)));
+	char A6[32] __attribute__((aligned(16)));
+	char A7[32] __attribute__((aligned(16)));
+	char A8[32] __attribute__((aligned(16)));
+	char A9[32] __attribute__((aligned(16)));
+	char A10[32] __attribute__((aligned(16)));
+	char A11[32] __attribute__((aligned(16)));
+	char A12[32] __attribute__((aligned(16)));
+	char A13[32] __attribute__((aligned(16)));
+	char A14[32] __attribute__((aligned(16)));
+	char A15[32] __attribute__((aligned(16)));
+	char A16[32] __attribute__((aligned(16)));
+	char A17[32] __attribute__((aligned(16)));
+	char A18[32] __attribute__((aligned(16)));
+	char A19[32] __attribute__((aligned(16)));
+	char A20[32] __attribute__((aligned(16)));
+	char A21[32] __attribute__((aligned(16)));
+	char B22[32] __attribute__((aligned(16)));
+	char B23[32] __attribute__((aligned(16)));
+	char B24[32] __attribute__((aligned(16)));
+	char B25[32] __attribute__((aligned(16)));
+	char B26[32] __attribute__((aligned(16)));
+	char B27[32] __attribute__((aligned(16)));
+	char B28[32] __attribute__((aligned(16)));
+	char B29[32] __attribute__((aligned(16)));
+	char B30[32] __attribute__((aligned(16)));
+	char B31[32] __attribute__((aligned(16)));
+	char B32[32] __attribute__((aligned(16)));
+	char B33[32] __attribute__((aligned(16)));
+	char B34[32] __attribute__((aligned(16)));
+	char B35[32] __attribute__((aligned(16)));
+	char B36[32] __attribute__((aligned(16)));
+	char B37[32] __attribute__((aligned(16)));
+	char B38[32] __attribute__((aligned(16)));
+	char B39[32] __attribute__((aligned(16)));
+	char B40[32] __attribute__((aligned(16)));
+	char B41[32] __attribute__((aligned(16)));
+	char B42[32] __attribute__((aligned(16)));
+	char B43[32] __attribute__((aligned(16)));
+	u64 t__2e101;
+	u64 t__2e102;
+	u64 t__2e104;
+	u64 t__2e107;
+	u64 t__2e108;
+	u64 t__2e110;
+	u64 t__2e113;
+	u64 t__2e114;
+	u64 t__2e116;
+	u64 t__2e119;
+	u64 t__2e120;
+	u64 t__2e122;
+	u64 t__2e123;
+	u64 t__2e127;
+	u64 t__2e128;
+	u64 t__2e13;
+	u64 t__2e130;
+	u64 t__2e131;
+	u64 t__2e135;
+	u64 t__2e136;
+	u64 t__2e138;
+	u64 t__2e14;
+	u64 t__2e142;
+	u64 t__2e143;
+	u64 t__2e145;
+	u64 t__2e148;
+	u64 t__2e149;
+	u64 t__2e151;
+	u64 t__2e154;
+	u64 t__2e155;
+	u64 t__2e159;
+	u64 t__2e160;
+	u64 t__2e162;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e168;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t__2e174;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e44;
+	u64 t__2e45;
+	u64 t__2e47;
+	u64 t__2e48;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e55;
+	u64 t__2e58;
+	u64 t__2e59;
+	u64 t__2e61;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e67;
+	u64 t__2e70;
+	u64 t__2e71;
+	u64 t__2e73;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e81;
+	u64 t__2e84;
+	u64 t__2e85;
+	u64 t__2e87;
+	u64 t__2e90;
+	u64 t__2e91;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e98;
+	u64 t_abortsite_2e35;
+	u64 t_field_2e124;
+	u64 t_field_2e132;
+	u64 t_field_2e33;
+	u64 t_field_2e49;
+	u64 t_object_2e103;
+	u64 t_object_2e109;
+	u64 t_object_2e115;
+	u64 t_object_2e121;
+	u64 t_object_2e129;
+	u64 t_object_2e137;
+	u64 t_object_2e144;
+	u64 t_object_2e15;
+	u64 t_object_2e150;
+	u64 t_object_2e156;
+	u64 t_object_2e161;
+	u64 t_object_2e167;
+	u64 t_object_2e173;
+	u64 t_object_2e46;
+	u64 t_object_2e54;
+	u64 t_object_2e60;
+	u64 t_object_2e66;
+	u64 t_object_2e72;
+	u64 t_object_2e80;
+	u64 t_object_2e86;
+	u64 t_object_2e92;
+	u64 t_object_2e97;
+	L_start_2e7:;
+	t_object_2e15 = (u64)A0;
+	t_object_2e46 = (u64)A1;
+	t_object_2e54 = (u64)A2;
+	t_object_2e60 = (u64)A3;
+	t_object_2e66 = (u64)A4;
+	t_object_2e72 = (u64)A5;
+	t_object_2e80 = (u64)A6;
+	t_object_2e86 = (u64)A7;
+	t_object_2e92 = (u64)A8;
+	t_object_2e97 = (u64)A9;
+	t_object_2e103 = (u64)A10;
+	t_object_2e109 = (u64)A11;
+	t_object_2e115 = (u64)A12;
+	t_object_2e121 = (u64)A13;
+	t_object_2e129 = (u64)A14;
+	t_object_2e137 = (u64)A15;
+	t_object_2e144 = (u64)A16;
+	t_object_2e150 = (u64)A17;
+	t_object_2e156 = (u64)A18;
+	t_object_2e161 = (u64)A19;
+	t_object_2e167 = (u64)A20;
+	t_object_2e173 = (u64)A21;
+	L_body_2e8:;
+	*(u32 *)t_object_2e15 = (u32)((u64)572602206UL);
+	t__2e31 = (u64)((u64)t_object_2e15 + (u64)((u64)4UL));
+	*(u32 *)t__2e31 = (u32)((u64)2626004657UL);
+	t__2e32 = (u64)((u64)t__2e31 + (u64)((u64)4UL));
+	t_field_2e33 = (u64)((u64)t__2e32 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e33 = (u32)((u64)1UL);
+	BLIT((u64)B22, t_object_2e15, 32);
+	t__2e14 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B22));
+	t__2e13 = (u64)(u32)(((u32)t__2e14 == (u32)((u64)1UL)));
+	if ((u32)t__2e13) goto L_passed_2e12; else goto L_failed_2e11;
+	L_failed_2e11:;
+	t_abortsite_2e35 = ((u64)0UL);
+	goto L_abort_2e36;
+	L_passed_2e12:;
+	*(u32 *)t_object_2e46 = (u32)((u64)572602206UL);
+	t__2e47 = (u64)((u64)t_object_2e46 + (u64)((u64)4UL));
+	*(u32 *)t__2e47 = (u32)((u64)3263701274UL);
+	t__2e48 = (u64)((u64)t__2e47 + (u64)((u64)4UL));
+	t_field_2e49 = (u64)((u64)t__2e48 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e49 = (u32)((u64)0UL);
+	BLIT((u64)B23, t_object_2e46, 32);
+	t__2e45 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B23));
+	t__2e44 = (u64)(u32)(((u32)t__2e45 == (u32)((u64)2UL)));
+	if ((u32)t__2e44) goto L_passed_2e43; else goto L_failed_2e42;
+	L_failed_2e42:;
+	t_abortsite_2e35 = ((u64)1UL);
+	goto L_abort_2e36;
+	L_passed_2e43:;
+	*(u32 *)t_object_2e54 = (u32)((u64)2037165609UL);
+	t__2e55 = (u64)((u64)t_object_2e54 + (u64)((u64)4UL));
+	*(u16 *)t__2e55 = (u16)((u64)3UL);
+	BLIT((u64)B24, t_object_2e54, 32);
+	t__2e53 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B24));
+	t__2e52 = (u64)(u32)(((u32)t__2e53 == (u32)((u64)3UL)));
+	if ((u32)t__2e52) goto L_passed_2e51; else goto L_failed_2e50;
+	L_failed_2e50:;
+	t_abortsite_2e35 = ((u64)2UL);
+	goto L_abort_2e36;
+	L_passed_2e51:;
+	*(u32 *)t_object_2e60 = (u32)((u64)3481467866UL);
+	t__2e61 = (u64)((u64)t_object_2e60 + (u64)((u64)4UL));
+	*(u16 *)t__2e61 = (u16)((u64)4UL);
+	BLIT((u64)B25, t_object_2e60, 32);
+	t__2e59 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B25));
+	t__2e58 = (u64)(u32)(((u32)t__2e59 == (u32)((u64)4UL)));
+	if ((u32)t__2e58) goto L_passed_2e57; else goto L_failed_2e56;
+	L_failed_2e56:;
+	t_abortsite_2e35 = ((u64)3UL);
+	goto L_abort_2e36;
+	L_passed_2e57:;
+	*(u32 *)t_object_2e66 = (u32)((u64)1906196061UL);
+	t__2e67 = (u64)((u64)t_object_2e66 + (u64)((u64)4UL));
+	*(u32 *)t__2e67 = (u32)((u64)4UL);
+	BLIT((u64)B26, t_object_2e66, 32);
+	t__2e65 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B26));
+	t__2e64 = (u64)(u32)(((u32)t__2e65 == (u32)((u64)4UL)));
+	if ((u32)t__2e64) goto L_passed_2e63; else goto L_failed_2e62;
+	L_failed_2e62:;
+	t_abortsite_2e35 = ((u64)4UL);
+	goto L_abort_2e36;
+	L_passed_2e63:;
+	*(u32 *)t_object_2e72 = (u32)((u64)4119164483UL);
+	t__2e73 = (u64)((u64)t_object_2e72 + (u64)((u64)8UL));
+	BLIT(t__2e73, ((u64)((char *)&D_strliteral_2e75)), ((u64)24UL));
+	BLIT((u64)B27, t_object_2e72, 32);
+	t__2e71 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B27));
+	t__2e70 = (u64)(u32)(((u32)t__2e71 == (u32)((u64)5UL)));
+	if ((u32)t__2e70) goto L_passed_2e69; else goto L_failed_2e68;
+	L_failed_2e68:;
+	t_abortsite_2e35 = ((u64)5UL);
+	goto L_abort_2e36;
+	L_passed_2e69:;
+	*(u32 *)t_object_2e80 = (u32)((u64)2843771249UL);
+	t__2e81 = (u64)((u64)t_object_2e80 + (u64)((u64)4UL));
+	*(u32 *)t__2e81 = (u32)((u64)120UL);
+	BLIT((u64)B28, t_object_2e80, 32);
+	t__2e79 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B28));
+	t__2e78 = (u64)(u32)(((u32)t__2e79 == (u32)((u64)6UL)));
+	if ((u32)t__2e78) goto L_passed_2e77; else goto L_failed_2e76;
+	L_failed_2e76:;
+	t_abortsite_2e35 = ((u64)6UL);
+	goto L_abort_2e36;
+	L_passed_2e77:;
+	*(u32 *)t_object_2e86 = (u32)((u64)292984781UL);
+	t__2e87 = (u64)((u64)t_object_2e86 + (u64)((u64)4UL));
+	*(u8 *)t__2e87 = (u8)((u64)1UL);
+	BLIT((u64)B29, t_object_2e86, 32);
+	t__2e85 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B29));
+	t__2e84 = (u64)(u32)(((u32)t__2e85 == (u32)((u64)7UL)));
+	if ((u32)t__2e84) goto L_passed_2e83; else goto L_failed_2e82;
+	L_failed_2e82:;
+	t_abortsite_2e35 = ((u64)7UL);
+	goto L_abort_2e36;
+	L_passed_2e83:;
+	*(u32 *)t_object_2e92 = (u32)((u64)3012680272UL);
+	BLIT((u64)B30, t_object_2e92, 32);
+	t__2e91 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B30));
+	t__2e90 = (u64)(u32)(((u32)t__2e91 == (u32)((u64)8UL)));
+	if ((u32)t__2e90) goto L_passed_2e89; else goto L_failed_2e88;
+	L_failed_2e88:;
+	t_abortsite_2e35 = ((u64)8UL);
+	goto L_abort_2e36;
+	L_passed_2e89:;
+	*(u32 *)t_object_2e97 = (u32)((u64)1399468992UL);
+	t__2e98 = (u64)((u64)t_object_2e97 + (u64)((u64)4UL));
+	*(u32 *)t__2e98 = (u32)((u64)9UL);
+	BLIT((u64)B31, t_object_2e97, 32);
+	t__2e96 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B31));
+	t__2e95 = (u64)(u32)(((u32)t__2e96 == (u32)((u64)0UL)));
+	if ((u32)t__2e95) goto L_passed_2e94; else goto L_failed_2e93;
+	L_failed_2e93:;
+	t_abortsite_2e35 = ((u64)9UL);
+	goto L_abort_2e36;
+	L_passed_2e94:;
+	*(u32 *)t_object_2e103 = (u32)((u64)3312558843UL);
+	t__2e104 = (u64)((u64)t_object_2e103 + (u64)((u64)8UL));
+	*(u64 *)t__2e104 = (u64)((u64)9UL);
+	BLIT((u64)B32, t_object_2e103, 32);
+	t__2e102 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B32));
+	t__2e101 = (u64)(u32)(((u32)t__2e102 == (u32)((u64)0UL)));
+	if ((u32)t__2e101) goto L_passed_2e100; else goto L_failed_2e99;
+	L_failed_2e99:;
+	t_abortsite_2e35 = ((u64)10UL);
+	goto L_abort_2e36;
+	L_passed_2e100:;
+	*(u32 *)t_object_2e109 = (u32)((u64)1268499444UL);
+	t__2e110 = (u64)((u64)t_object_2e109 + (u64)((u64)8UL));
+	*(u64 *)t__2e110 = (u64)((u64)9UL);
+	BLIT((u64)B33, t_object_2e109, 32);
+	t__2e108 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B33));
+	t__2e107 = (u64)(u32)(((u32)t__2e108 == (u32)((u64)0UL)));
+	if ((u32)t__2e107) goto L_passed_2e106; else goto L_failed_2e105;
+	L_failed_2e105:;
+	t_abortsite_2e35 = ((u64)11UL);
+	goto L_abort_2e36;
+	L_passed_2e106:;
+	*(u32 *)t_object_2e115 = (u32)((u64)930681398UL);
+	t__2e116 = (u64)((u64)t_object_2e115 + (u64)((u64)8UL));
+	*(u64 *)t__2e116 = (u64)((u64)4621256167635550208UL);
+	BLIT((u64)B34, t_object_2e115, 32);
+	t__2e114 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify)))((u64)B34));
+	t__2e113 = (u64)(u32)(((u32)t__2e114 == (u32)((u64)0UL)));
+	if ((u32)t__2e113) goto L_passed_2e112; else goto L_failed_2e111;
+	L_failed_2e111:;
+	t_abortsite_2e35 = ((u64)12UL);
+	goto L_abort_2e36;
+	L_passed_2e112:;
+	*(u32 *)t_object_2e121 = (u32)((u64)572602206UL);
+	t__2e122 = (u64)((u64)t_object_2e121 + (u64)((u64)4UL));
+	*(u32 *)t__2e122 = (u32)((u64)2626004657UL);
+	t__2e123 = (u64)((u64)t__2e122 + (u64)((u64)4UL));
+	t_field_2e124 = (u64)((u64)t__2e123 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e124 = (u32)((u64)0UL);
+	BLIT((u64)B35, t_object_2e121, 32);
+	t__2e120 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify__small)))((u64)B35));
+	t__2e119 = (u64)(u32)(((u32)t__2e120 == (u32)((u64)1UL)));
+	if ((u32)t__2e119) goto L_passed_2e118; else goto L_failed_2e117;
+	L_failed_2e117:;
+	t_abortsite_2e35 = ((u64)13UL);
+	goto L_abort_2e36;
+	L_passed_2e118:;
+	*(u32 *)t_object_2e129 = (u32)((u64)572602206UL);
+	t__2e130 = (u64)((u64)t_object_2e129 + (u64)((u64)4UL));
+	*(u32 *)t__2e130 = (u32)((u64)3263701274UL);
+	t__2e131 = (u64)((u64)t__2e130 + (u64)((u64)4UL));
+	t_field_2e132 = (u64)((u64)t__2e131 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e132 = (u32)((u64)42UL);
+	BLIT((u64)B36, t_object_2e129, 32);
+	t__2e128 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify__small)))((u64)B36));
+	t__2e127 = (u64)(u32)(((u32)t__2e128 == (u32)((u64)2UL)));
+	if ((u32)t__2e127) goto L_passed_2e126; else goto L_failed_2e125;
+	L_failed_2e125:;
+	t_abortsite_2e35 = ((u64)14UL);
+	goto L_abort_2e36;
+	L_passed_2e126:;
+	*(u32 *)t_object_2e137 = (u32)((u64)4119164483UL);
+	t__2e138 = (u64)((u64)t_object_2e137 + (u64)((u64)8UL));
+	BLIT(t__2e138, ((u64)((char *)&D_strliteral_2e139)), ((u64)24UL));
+	BLIT((u64)B37, t_object_2e137, 32);
+	t__2e136 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify__small)))((u64)B37));
+	t__2e135 = (u64)(u32)(((u32)t__2e136 == (u32)((u64)3UL)));
+	if ((u32)t__2e135) goto L_passed_2e134; else goto L_failed_2e133;
+	L_failed_2e133:;
+	t_abortsite_2e35 = ((u64)15UL);
+	goto L_abort_2e36;
+	L_passed_2e134:;
+	*(u32 *)t_object_2e144 = (u32)((u64)2843771249UL);
+	t__2e145 = (u64)((u64)t_object_2e144 + (u64)((u64)4UL));
+	*(u32 *)t__2e145 = (u32)((u64)120UL);
+	BLIT((u64)B38, t_object_2e144, 32);
+	t__2e143 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify__small)))((u64)B38));
+	t__2e142 = (u64)(u32)(((u32)t__2e143 == (u32)((u64)4UL)));
+	if ((u32)t__2e142) goto L_passed_2e141; else goto L_failed_2e140;
+	L_failed_2e140:;
+	t_abortsite_2e35 = ((u64)16UL);
+	goto L_abort_2e36;
+	L_passed_2e141:;
+	*(u32 *)t_object_2e150 = (u32)((u64)292984781UL);
+	t__2e151 = (u64)((u64)t_object_2e150 + (u64)((u64)4UL));
+	*(u8 *)t__2e151 = (u8)((u64)0UL);
+	BLIT((u64)B39, t_object_2e150, 32);
+	t__2e149 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify__small)))((u64)B39));
+	t__2e148 = (u64)(u32)(((u32)t__2e149 == (u32)((u64)5UL)));
+	if ((u32)t__2e148) goto L_passed_2e147; else goto L_failed_2e146;
+	L_failed_2e146:;
+	t_abortsite_2e35 = ((u64)17UL);
+	goto L_abort_2e36;
+	L_passed_2e147:;
+	*(u32 *)t_object_2e156 = (u32)((u64)3012680272UL);
+	BLIT((u64)B40, t_object_2e156, 32);
+	t__2e155 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify__small)))((u64)B40));
+	t__2e154 = (u64)(u32)(((u32)t__2e155 == (u32)((u64)6UL)));
+	if ((u32)t__2e154) goto L_passed_2e153; else goto L_failed_2e152;
+	L_failed_2e152:;
+	t_abortsite_2e35 = ((u64)18UL);
+	goto L_abort_2e36;
+	L_passed_2e153:;
+	*(u32 *)t_object_2e161 = (u32)((u64)2037165609UL);
+	t__2e162 = (u64)((u64)t_object_2e161 + (u64)((u64)4UL));
+	*(u16 *)t__2e162 = (u16)((u64)1UL);
+	BLIT((u64)B41, t_object_2e161, 32);
+	t__2e160 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify__small)))((u64)B41));
+	t__2e159 = (u64)(u32)(((u32)t__2e160 == (u32)((u64)7UL)));
+	if ((u32)t__2e159) goto L_passed_2e158; else goto L_failed_2e157;
+	L_failed_2e157:;
+	t_abortsite_2e35 = ((u64)19UL);
+	goto L_abort_2e36;
+	L_passed_2e158:;
+	*(u32 *)t_object_2e167 = (u32)((u64)1268499444UL);
+	t__2e168 = (u64)((u64)t_object_2e167 + (u64)((u64)8UL));
+	*(u64 *)t__2e168 = (u64)((u64)1UL);
+	BLIT((u64)B42, t_object_2e167, 32);
+	t__2e166 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify__small)))((u64)B42));
+	t__2e165 = (u64)(u32)(((u32)t__2e166 == (u32)((u64)7UL)));
+	if ((u32)t__2e165) goto L_passed_2e164; else goto L_failed_2e163;
+	L_failed_2e163:;
+	t_abortsite_2e35 = ((u64)20UL);
+	goto L_abort_2e36;
+	L_passed_2e164:;
+	*(u32 *)t_object_2e173 = (u32)((u64)930681398UL);
+	t__2e174 = (u64)((u64)t_object_2e173 + (u64)((u64)8UL));
+	*(u64 *)t__2e174 = (u64)((u64)4607182418800017408UL);
+	BLIT((u64)B43, t_object_2e173, 32);
+	t__2e172 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_classify__small)))((u64)B43));
+	t__2e171 = (u64)(u32)(((u32)t__2e172 == (u32)((u64)7UL)));
+	if ((u32)t__2e171) goto L_passed_2e170; else goto L_failed_2e169;
+	L_failed_2e169:;
+	t_abortsite_2e35 = ((u64)21UL);
+	goto L_abort_2e36;
+	L_passed_2e170:;
+	goto L__2e9;
+	L__2e175:;
+	L__2e9:;
+	return;
+	L_abort_2e36:;
+	t__2e37 = (u64)((u64)t_abortsite_2e35 * (u64)((u64)16UL));
+	t__2e37 = (u64)((u64)((u64)((char *)&D_abortsites_2e34)) + (u64)t__2e37);
+	t__2e38 = (u64)(*(u64 *)t__2e37);
+	t__2e39 = (u64)((u64)t__2e37 + (u64)((u64)8UL));
+	t__2e40 = (u64)(*(u32 *)t__2e39);
+	t__2e39 = (u64)((u64)t__2e37 + (u64)((u64)12UL));
+	t__2e41 = (u64)(*(u32 *)t__2e39);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e38, (u64)t__2e40, (u64)t__2e41, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_classify__small(u64 p_x) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e205;
+	u64 t__2e208;
+	u64 t__2e210;
+	u64 t__2e212;
+	u64 t__2e214;
+	u64 t__2e216;
+	u64 t__2e218;
+	u64 t__2e220;
+	u64 t__2e223;
+	u64 t__2e225;
+	u64 t__2e227;
+	u64 t__2e229;
+	u64 t__2e231;
+	u64 t__2e233;
+	u64 t__2e235;
+	u64 t__2e238;
+	u64 t__2e239;
+	u64 t__2e247;
+	u64 t__2e252;
+	u64 t__2e253;
+	u64 t__2e254;
+	u64 t__2e258;
+	u64 t__2e264;
+	u64 t__2e265;
+	u64 t__2e266;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e270;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e275;
+	u64 t__2e276;
+	u64 t__2e300;
+	u64 t__2e301;
+	u64 t__2e302;
+	u64 t__2e303;
+	u64 t__2e304;
+	u64 t_abortsite_2e262;
+	u64 t_binding_2e246;
+	u64 t_field_2e269;
+	u64 t_subval_2e237;
+	u64 t_subval_2e257;
+	u64 t_tag_2e181;
+	u64 t_x;
+	t_x = p_x;
+	L_start_2e176:;
+	t_binding_2e246 = (u64)A0;
+	L_body_2e177:;
+	t_tag_2e181 = (u64)(*(u32 *)t_x);
+	t__2e205 = (u64)(u32)(((u32)t_tag_2e181 < (u32)((u64)2037165609UL)));
+	if ((u32)t__2e205) goto L_switch_2elt_2e203; else goto L_switch_2ege_2e204;
+	L_switch_2elt_2e203:;
+	t__2e208 = (u64)(u32)(((u32)t_tag_2e181 < (u32)((u64)1268499444UL)));
+	if ((u32)t__2e208) goto L_switch_2elt_2e206; else goto L_switch_2ege_2e207;
+	L_switch_2elt_2e206:;
+	t__2e210 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)292984781UL)));
+	if ((u32)t__2e210) goto L_member_2e191; else goto L__2e209;
+	L__2e209:;
+	t__2e212 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)572602206UL)));
+	if ((u32)t__2e212) goto L_member_2e192; else goto L__2e211;
+	L__2e211:;
+	t__2e214 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)930681398UL)));
+	if ((u32)t__2e214) goto L_member_2e193; else goto L__2e213;
+	L__2e213:;
+	goto L__2e183;
+	L_switch_2ege_2e207:;
+	t__2e216 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)1268499444UL)));
+	if ((u32)t__2e216) goto L_member_2e194; else goto L__2e215;
+	L__2e215:;
+	t__2e218 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)1399468992UL)));
+	if ((u32)t__2e218) goto L_member_2e195; else goto L__2e217;
+	L__2e217:;
+	t__2e220 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)1906196061UL)));
+	if ((u32)t__2e220) goto L_member_2e196; else goto L__2e219;
+	L__2e219:;
+	goto L__2e183;
+	L_switch_2ege_2e204:;
+	t__2e223 = (u64)(u32)(((u32)t_tag_2e181 < (u32)((u64)3312558843UL)));
+	if ((u32)t__2e223) goto L_switch_2elt_2e221; else goto L_switch_2ege_2e222;
+	L_switch_2elt_2e221:;
+	t__2e225 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)2037165609UL)));
+	if ((u32)t__2e225) goto L_member_2e197; else goto L__2e224;
+	L__2e224:;
+	t__2e227 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)2843771249UL)));
+	if ((u32)t__2e227) goto L_member_2e198; else goto L__2e226;
+	L__2e226:;
+	t__2e229 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e229) goto L_member_2e199; else goto L__2e228;
+	L__2e228:;
+	goto L__2e183;
+	L_switch_2ege_2e222:;
+	t__2e231 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)3312558843UL)));
+	if ((u32)t__2e231) goto L_member_2e200; else goto L__2e230;
+	L__2e230:;
+	t__2e233 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)3481467866UL)));
+	if ((u32)t__2e233) goto L_member_2e201; else goto L__2e232;
+	L__2e232:;
+	t__2e235 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)4119164483UL)));
+	if ((u32)t__2e235) goto L_member_2e202; else goto L__2e234;
+	L__2e234:;
+	goto L__2e183;
+	L_member_2e191:;
+	goto L_matches_2e188;
+	L_member_2e192:;
+	t_subval_2e237 = t_x;
+	t__2e238 = (u64)(u32)(((u32)t_tag_2e181 == (u32)((u64)572602206UL)));
+	if ((u32)t__2e238) goto L_subtype_2e240; else goto L_next_2e236;
+	L_subtype_2e240:;
+	t_subval_2e237 = (u64)((u64)t_subval_2e237 + (u64)((u64)4UL));
+	t__2e239 = (u64)(u32)(*(u32 *)t_subval_2e237);
+	t__2e238 = (u64)(u32)(((u32)t__2e239 == (u32)((u64)2626004657UL)));
+	if ((u32)t__2e238) goto L_subtype_2e241; else goto L_next_2e236;
+	L_subtype_2e241:;
+	goto L_matches_2e184;
+	L_next_2e236:;
+	goto L_matches_2e185;
+	L_member_2e193:;
+	goto L_matches_2e190;
+	L_member_2e194:;
+	goto L_matches_2e190;
+	L_member_2e195:;
+	goto L_matches_2e190;
+	L_member_2e196:;
+	goto L_matches_2e190;
+	L_member_2e197:;
+	goto L_matches_2e190;
+	L_member_2e198:;
+	goto L_matches_2e187;
+	L_member_2e199:;
+	goto L_matches_2e189;
+	L_member_2e200:;
+	goto L_matches_2e190;
+	L_member_2e201:;
+	goto L_matches_2e190;
+	L_member_2e202:;
+	goto L_matches_2e186;
+	L_matches_2e184:;
+	return (u32)((u64)1UL);
+	L__2e244:;
+	L__2e242:;
+	L__2e245:;
+	L_matches_2e185:;
+	t__2e247 = (u64)((u64)t_x + (u64)((u64)4UL));
+	BLIT(t_binding_2e246, t__2e247, ((u64)8UL));
+	t__2e253 = t_binding_2e246;
+	t__2e254 = (u64)(u32)(*(u32 *)t_binding_2e246);
+	t_subval_2e257 = t_binding_2e246;
+	t__2e258 = (u64)(u32)(((u32)t__2e254 == (u32)((u64)3263701274UL)));
+	if ((u32)t__2e258) goto L_subtype_2e260; else goto L_failed_2e256;
+	L_subtype_2e260:;
+	goto L_passed_2e255;
+	L_failed_2e256:;
+	t_abortsite_2e262 = ((u64)0UL);
+	goto L_abort_2e263;
+	L_passed_2e255:;
+	t__2e253 = (u64)((u64)t__2e253 + (u64)((u64)4UL));
+	t_field_2e269 = (u64)((u64)t__2e253 + (u64)((u64)0UL));
+	t__2e270 = (u64)(u32)(*(i32 *)t_field_2e269);
+	t__2e252 = (u64)(u32)(((u32)t__2e270 == (u32)((u64)42UL)));
+	if ((u32)t__2e252) goto L_passed_2e251; else goto L_failed_2e250;
+	L_failed_2e250:;
+	t_abortsite_2e262 = ((u64)1UL);
+	goto L_abort_2e271;
+	L_passed_2e251:;
+	return (u32)((u64)2UL);
+	L__2e277:;
+	L__2e248:;
+	L__2e278:;
+	L_matches_2e186:;
+	return (u32)((u64)3UL);
+	L__2e281:;
+	L__2e279:;
+	L__2e282:;
+	L_matches_2e187:;
+	return (u32)((u64)4UL);
+	L__2e285:;
+	L__2e283:;
+	L__2e286:;
+	L_matches_2e188:;
+	return (u32)((u64)5UL);
+	L__2e289:;
+	L__2e287:;
+	L__2e290:;
+	L_matches_2e189:;
+	return (u32)((u64)6UL);
+	L__2e293:;
+	L__2e291:;
+	L__2e294:;
+	L_matches_2e190:;
+	return (u32)((u64)7UL);
+	L__2e297:;
+	L__2e295:;
+	L__2e298:;
+	L__2e183:;
+	t_abortsite_2e262 = ((u64)2UL);
+	goto L_abort_2e299;
+	L__2e182:;
+	L__2e305:;
+	L__2e178:;
+	L__2e306:;
+	return 0;
+	L_abort_2e263:;
+	t__2e264 = (u64)((u64)t_abortsite_2e262 * (u64)((u64)16UL));
+	t__2e264 = (u64)((u64)((u64)((char *)&D_abortsites_2e261)) + (u64)t__2e264);
+	t__2e265 = (u64)(*(u64 *)t__2e264);
+	t__2e266 = (u64)((u64)t__2e264 + (u64)((u64)8UL));
+	t__2e267 = (u64)(*(u32 *)t__2e266);
+	t__2e266 = (u64)((u64)t__2e264 + (u64)((u64)12UL));
+	t__2e268 = (u64)(*(u32 *)t__2e266);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e265, (u64)t__2e267, (u64)t__2e268, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e271:;
+	t__2e272 = (u64)((u64)t_abortsite_2e262 * (u64)((u64)16UL));
+	t__2e272 = (u64)((u64)((u64)((char *)&D_abortsites_2e261)) + (u64)t__2e272);
+	t__2e273 = (u64)(*(u64 *)t__2e272);
+	t__2e274 = (u64)((u64)t__2e272 + (u64)((u64)8UL));
+	t__2e275 = (u64)(*(u32 *)t__2e274);
+	t__2e274 = (u64)((u64)t__2e272 + (u64)((u64)12UL));
+	t__2e276 = (u64)(*(u32 *)t__2e274);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e273, (u64)t__2e275, (u64)t__2e276, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e299:;
+	t__2e300 = (u64)((u64)t_abortsite_2e262 * (u64)((u64)16UL));
+	t__2e300 = (u64)((u64)((u64)((char *)&D_abortsites_2e261)) + (u64)t__2e300);
+	t__2e301 = (u64)(*(u64 *)t__2e300);
+	t__2e302 = (u64)((u64)t__2e300 + (u64)((u64)8UL));
+	t__2e303 = (u64)(*(u32 *)t__2e302);
+	t__2e302 = (u64)((u64)t__2e300 + (u64)((u64)12UL));
+	t__2e304 = (u64)(*(u32 *)t__2e302);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e301, (u64)t__2e303, (u64)t__2e304, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u32 F_classify(u64 p_x) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[2] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	u64 t__2e338;
+	u64 t__2e341;
+	u64 t__2e343;
+	u64 t__2e345;
+	u64 t__2e347;
+	u64 t__2e349;
+	u64 t__2e351;
+	u64 t__2e353;
+	u64 t__2e356;
+	u64 t__2e358;
+	u64 t__2e360;
+	u64 t__2e362;
+	u64 t__2e364;
+	u64 t__2e366;
+	u64 t__2e368;
+	u64 t__2e371;
+	u64 t__2e372;
+	u64 t__2e377;
+	u64 t__2e378;
+	u64 t__2e382;
+	u64 t__2e386;
+	u64 t__2e394;
+	u64 t__2e395;
+	u64 t__2e398;
+	u64 t__2e399;
+	u64 t__2e403;
+	u64 t__2e413;
+	u64 t__2e416;
+	u64 t__2e419;
+	u64 t__2e422;
+	u64 t__2e423;
+	u64 t__2e424;
+	u64 t__2e428;
+	u64 t__2e434;
+	u64 t__2e435;
+	u64 t__2e436;
+	u64 t__2e437;
+	u64 t__2e438;
+	u64 t__2e439;
+	u64 t__2e440;
+	u64 t__2e441;
+	u64 t__2e443;
+	u64 t__2e444;
+	u64 t__2e445;
+	u64 t__2e446;
+	u64 t__2e447;
+	u64 t__2e451;
+	u64 t__2e454;
+	u64 t__2e455;
+	u64 t__2e456;
+	u64 t__2e457;
+	u64 t__2e477;
+	u64 t__2e478;
+	u64 t__2e479;
+	u64 t__2e480;
+	u64 t__2e481;
+	u64 t_abortsite_2e432;
+	u64 t_binding_2e381;
+	u64 t_binding_2e393;
+	u64 t_binding_2e402;
+	u64 t_binding_2e450;
+	u64 t_field_2e385;
+	u64 t_subval_2e370;
+	u64 t_subval_2e376;
+	u64 t_subval_2e418;
+	u64 t_subval_2e427;
+	u64 t_tag_2e312;
+	u64 t_x;
+	t_x = p_x;
+	L_start_2e307:;
+	t_binding_2e381 = (u64)A0;
+	t_binding_2e393 = (u64)A1;
+	t_binding_2e402 = (u64)A2;
+	t_binding_2e450 = (u64)A3;
+	L_body_2e308:;
+	t_tag_2e312 = (u64)(*(u32 *)t_x);
+	t__2e338 = (u64)(u32)(((u32)t_tag_2e312 < (u32)((u64)2037165609UL)));
+	if ((u32)t__2e338) goto L_switch_2elt_2e336; else goto L_switch_2ege_2e337;
+	L_switch_2elt_2e336:;
+	t__2e341 = (u64)(u32)(((u32)t_tag_2e312 < (u32)((u64)1268499444UL)));
+	if ((u32)t__2e341) goto L_switch_2elt_2e339; else goto L_switch_2ege_2e340;
+	L_switch_2elt_2e339:;
+	t__2e343 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)292984781UL)));
+	if ((u32)t__2e343) goto L_member_2e324; else goto L__2e342;
+	L__2e342:;
+	t__2e345 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)572602206UL)));
+	if ((u32)t__2e345) goto L_member_2e325; else goto L__2e344;
+	L__2e344:;
+	t__2e347 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)930681398UL)));
+	if ((u32)t__2e347) goto L_member_2e326; else goto L__2e346;
+	L__2e346:;
+	goto L_matches_2e323;
+	L_switch_2ege_2e340:;
+	t__2e349 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)1268499444UL)));
+	if ((u32)t__2e349) goto L_member_2e327; else goto L__2e348;
+	L__2e348:;
+	t__2e351 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)1399468992UL)));
+	if ((u32)t__2e351) goto L_member_2e328; else goto L__2e350;
+	L__2e350:;
+	t__2e353 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)1906196061UL)));
+	if ((u32)t__2e353) goto L_member_2e329; else goto L__2e352;
+	L__2e352:;
+	goto L_matches_2e323;
+	L_switch_2ege_2e337:;
+	t__2e356 = (u64)(u32)(((u32)t_tag_2e312 < (u32)((u64)3312558843UL)));
+	if ((u32)t__2e356) goto L_switch_2elt_2e354; else goto L_switch_2ege_2e355;
+	L_switch_2elt_2e354:;
+	t__2e358 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)2037165609UL)));
+	if ((u32)t__2e358) goto L_member_2e330; else goto L__2e357;
+	L__2e357:;
+	t__2e360 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)2843771249UL)));
+	if ((u32)t__2e360) goto L_member_2e331; else goto L__2e359;
+	L__2e359:;
+	t__2e362 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e362) goto L_member_2e332; else goto L__2e361;
+	L__2e361:;
+	goto L_matches_2e323;
+	L_switch_2ege_2e355:;
+	t__2e364 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)3312558843UL)));
+	if ((u32)t__2e364) goto L_member_2e333; else goto L__2e363;
+	L__2e363:;
+	t__2e366 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)3481467866UL)));
+	if ((u32)t__2e366) goto L_member_2e334; else goto L__2e365;
+	L__2e365:;
+	t__2e368 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)4119164483UL)));
+	if ((u32)t__2e368) goto L_member_2e335; else goto L__2e367;
+	L__2e367:;
+	goto L_matches_2e323;
+	L_member_2e324:;
+	goto L_matches_2e321;
+	L_member_2e325:;
+	t_subval_2e370 = t_x;
+	t__2e371 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)572602206UL)));
+	if ((u32)t__2e371) goto L_subtype_2e373; else goto L_next_2e369;
+	L_subtype_2e373:;
+	t_subval_2e370 = (u64)((u64)t_subval_2e370 + (u64)((u64)4UL));
+	t__2e372 = (u64)(u32)(*(u32 *)t_subval_2e370);
+	t__2e371 = (u64)(u32)(((u32)t__2e372 == (u32)((u64)2626004657UL)));
+	if ((u32)t__2e371) goto L_subtype_2e374; else goto L_next_2e369;
+	L_subtype_2e374:;
+	goto L_matches_2e315;
+	L_next_2e369:;
+	t_subval_2e376 = t_x;
+	t__2e377 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)572602206UL)));
+	if ((u32)t__2e377) goto L_subtype_2e379; else goto L_next_2e375;
+	L_subtype_2e379:;
+	t_subval_2e376 = (u64)((u64)t_subval_2e376 + (u64)((u64)4UL));
+	t__2e378 = (u64)(u32)(*(u32 *)t_subval_2e376);
+	t__2e377 = (u64)(u32)(((u32)t__2e378 == (u32)((u64)3263701274UL)));
+	if ((u32)t__2e377) goto L_subtype_2e380; else goto L_next_2e375;
+	L_subtype_2e380:;
+	goto L_matches_2e316;
+	L_next_2e375:;
+	goto L_matches_2e323;
+	L_member_2e326:;
+	goto L_matches_2e323;
+	L_member_2e327:;
+	goto L_matches_2e323;
+	L_member_2e328:;
+	goto L_matches_2e323;
+	L_member_2e329:;
+	goto L_matches_2e318;
+	L_member_2e330:;
+	goto L_matches_2e317;
+	L_member_2e331:;
+	goto L_matches_2e320;
+	L_member_2e332:;
+	goto L_matches_2e322;
+	L_member_2e333:;
+	goto L_matches_2e323;
+	L_member_2e334:;
+	goto L_matches_2e318;
+	L_member_2e335:;
+	goto L_matches_2e319;
+	L_matches_2e315:;
+	t__2e382 = (u64)((u64)t_x + (u64)((u64)8UL));
+	BLIT(t_binding_2e381, t__2e382, ((u64)4UL));
+	t_field_2e385 = (u64)((u64)t_binding_2e381 + (u64)((u64)0UL));
+	t__2e386 = (u64)(u32)(*(i32 *)t_field_2e385);
+	return (u32)t__2e386;
+	L__2e387:;
+	L__2e383:;
+	L__2e388:;
+	L_matches_2e316:;
+	return (u32)((u64)2UL);
+	L__2e391:;
+	L__2e389:;
+	L__2e392:;
+	L_matches_2e317:;
+	t__2e394 = (u64)((u64)t_x + (u64)((u64)4UL));
+	t__2e395 = (u64)(u32)(*(i16 *)t__2e394);
+	*(u16 *)t_binding_2e393 = (u16)t__2e395;
+	t__2e398 = (u64)(u32)(*(i16 *)t_binding_2e393);
+	t__2e399 = (u64)(u32)((i64)(i16)t__2e398);
+	return (u32)t__2e399;
+	L__2e400:;
+	L__2e396:;
+	L__2e401:;
+	L_matches_2e318:;
+	t__2e403 = t_x;
+	BLIT(t_binding_2e402, t__2e403, ((u64)8UL));
+	t__2e416 = (u64)(u32)(*(u32 *)t_binding_2e402);
+	t_subval_2e418 = t_binding_2e402;
+	t__2e419 = (u64)(u32)(((u32)t__2e416 == (u32)((u64)1906196061UL)));
+	if ((u32)t__2e419) goto L_subtype_2e421; else goto L_passed_2e417;
+	L_subtype_2e421:;
+	goto L_passed_2e417;
+	L_passed_2e417:;
+	t__2e413 = (u64)(u32)t__2e419;
+	if ((u32)t__2e413) goto L__2e415; else goto L__2e414;
+	L__2e414:;
+	t__2e423 = t_binding_2e402;
+	t__2e424 = (u64)(u32)(*(u32 *)t_binding_2e402);
+	t_subval_2e427 = t_binding_2e402;
+	t__2e428 = (u64)(u32)(((u32)t__2e424 == (u32)((u64)3481467866UL)));
+	if ((u32)t__2e428) goto L_subtype_2e430; else goto L_failed_2e426;
+	L_subtype_2e430:;
+	goto L_passed_2e425;
+	L_failed_2e426:;
+	t_abortsite_2e432 = ((u64)0UL);
+	goto L_abort_2e433;
+	L_passed_2e425:;
+	t__2e423 = (u64)((u64)t__2e423 + (u64)((u64)4UL));
+	t__2e439 = (u64)(u32)(*(u16 *)t__2e423);
+	t__2e440 = (u64)(u32)((u16)t__2e439);
+	t__2e441 = (u64)(u32)((u16)((u64)4UL));
+	t__2e422 = (u64)(u32)(((u32)t__2e440 == (u32)t__2e441));
+	t__2e413 = (u64)(u32)t__2e422;
+	goto L__2e415;
+	L__2e415:;
+	if ((u32)t__2e413) goto L_passed_2e412; else goto L_failed_2e411;
+	L_failed_2e411:;
+	t_abortsite_2e432 = ((u64)1UL);
+	goto L_abort_2e442;
+	L_passed_2e412:;
+	return (u32)((u64)4UL);
+	L__2e448:;
+	L__2e409:;
+	L__2e449:;
+	L_matches_2e319:;
+	t__2e451 = (u64)((u64)t_x + (u64)((u64)8UL));
+	BLIT(t_binding_2e450, t__2e451, ((u64)24UL));
+	t__2e454 = (u64)((u64)t_binding_2e450 + (u64)((u64)8UL));
+	t__2e455 = (u64)((u64)t_binding_2e450 + (u64)((u64)16UL));
+	t__2e456 = (u64)(*(u64 *)t__2e454);
+	t__2e457 = (u64)(u32)t__2e456;
+	return (u32)t__2e457;
+	L__2e458:;
+	L__2e452:;
+	L__2e459:;
+	L_matches_2e320:;
+	return (u32)((u64)6UL);
+	L__2e462:;
+	L__2e460:;
+	L__2e463:;
+	L_matches_2e321:;
+	return (u32)((u64)7UL);
+	L__2e466:;
+	L__2e464:;
+	L__2e467:;
+	L_matches_2e322:;
+	return (u32)((u64)8UL);
+	L__2e470:;
+	L__2e468:;
+	L__2e471:;
+	L_matches_2e323:;
+	return (u32)((u64)0UL);
+	L__2e474:;
+	L__2e472:;
+	L__2e475:;
+	L__2e314:;
+	t_abortsite_2e432 = ((u64)2UL);
+	goto L_abort_2e476;
+	L__2e313:;
+	L__2e482:;
+	L__2e309:;
+	L__2e483:;
+	return 0;
+	L_abort_2e433:;
+	t__2e434 = (u64)((u64)t_abortsite_2e432 * (u64)((u64)16UL));
+	t__2e434 = (u64)((u64)((u64)((char *)&D_abortsites_2e431)) + (u64)t__2e434);
+	t__2e435 = (u64)(*(u64 *)t__2e434);
+	t__2e436 = (u64)((u64)t__2e434 + (u64)((u64)8UL));
+	t__2e437 = (u64)(*(u32 *)t__2e436);
+	t__2e436 = (u64)((u64)t__2e434 + (u64)((u64)12UL));
+	t__2e438 = (u64)(*(u32 *)t__2e436);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e435, (u64)t__2e437, (u64)t__2e438, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e442:;
+	t__2e443 = (u64)((u64)t_abortsite_2e432 * (u64)((u64)16UL));
+	t__2e443 = (u64)((u64)((u64)((char *)&D_abortsites_2e431)) + (u64)t__2e443);
+	t__2e444 = (u64)(*(u64 *)t__2e443);
+	t__2e445 = (u64)((u64)t__2e443 + (u64)((u64)8UL));
+	t__2e446 = (u64)(*(u32 *)t__2e445);
+	t__2e445 = (u64)((u64)t__2e443 + (u64)((u64)12UL));
+	t__2e447 = (u64)(*(u32 *)t__2e445);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e444, (u64)t__2e446, (u64)t__2e447, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e476:;
+	t__2e477 = (u64)((u64)t_abortsite_2e432 * (u64)((u64)16UL));
+	t__2e477 = (u64)((u64)((u64)((char *)&D_abortsites_2e431)) + (u64)t__2e477);
+	t__2e478 = (u64)(*(u64 *)t__2e477);
+	t__2e479 = (u64)((u64)t__2e477 + (u64)((u64)8UL));
+	t__2e480 = (u64)(*(u32 *)t__2e479);
+	t__2e479 = (u64)((u64)t__2e477 + (u64)((u64)12UL));
+	t__2e481 = (u64)(*(u32 *)t__2e479);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e478, (u64)t__2e480, (u64)t__2e481, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_label(void) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e493;
+	u64 t__2e502;
+	u64 t__2e504;
+	u64 t__2e511;
+	u64 t__2e519;
+	u64 t__2e520;
+	u64 t__2e521;
+	u64 t__2e522;
+	u64 t__2e523;
+	u64 t__2e531;
+	u64 t__2e535;
+	u64 t__2e536;
+	u64 t__2e537;
+	u64 t__2e538;
+	u64 t__2e539;
+	u64 t_abortsite_2e517;
+	u64 t_object_2e489;
+	u64 t_tag_2e494;
+	L_start_2e484:;
+	t_object_2e489 = (u64)A0;
+	L_body_2e485:;
+	*(u32 *)t_object_2e489 = (u32)((u64)1099590421UL);
+	t__2e493 = (u64)((u64)t_object_2e489 + (u64)((u64)4UL));
+	*(u32 *)t__2e493 = (u32)((u64)0UL);
+	t_tag_2e494 = (u64)(*(u32 *)t_object_2e489);
+	t__2e502 = (u64)(u32)(((u32)t_tag_2e494 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e502) goto L_member_2e499; else goto L__2e501;
+	L__2e501:;
+	t__2e504 = (u64)(u32)(((u32)t_tag_2e494 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e504) goto L_member_2e500; else goto L__2e503;
+	L__2e503:;
+	goto L_matches_2e498;
+	L_member_2e499:;
+	goto L_matches_2e497;
+	L_member_2e500:;
+	goto L_matches_2e498;
+	L_matches_2e497:;
+	t__2e511 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e511) goto L_true_2e508; else goto L_false_2e509;
+	L_true_2e508:;
+	goto L__2e505;
+	L__2e514:;
+	L__2e512:;
+	L__2e515:;
+	L_false_2e509:;
+	L__2e510:;
+	t_abortsite_2e517 = ((u64)0UL);
+	goto L_abort_2e518;
+	L__2e524:;
+	L__2e505:;
+	goto L__2e495;
+	L_matches_2e498:;
+	t__2e531 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e531) goto L_true_2e528; else goto L_false_2e529;
+	L_true_2e528:;
+	t_abortsite_2e517 = ((u64)1UL);
+	goto L_abort_2e518;
+	L__2e532:;
+	L_false_2e529:;
+	L__2e530:;
+	goto L__2e525;
+	L__2e533:;
+	L__2e525:;
+	goto L__2e495;
+	L__2e496:;
+	t_abortsite_2e517 = ((u64)2UL);
+	goto L_abort_2e534;
+	L__2e495:;
+	goto L__2e486;
+	L__2e540:;
+	L__2e486:;
+	return;
+	L_abort_2e518:;
+	t__2e519 = (u64)((u64)t_abortsite_2e517 * (u64)((u64)16UL));
+	t__2e519 = (u64)((u64)((u64)((char *)&D_abortsites_2e516)) + (u64)t__2e519);
+	t__2e520 = (u64)(*(u64 *)t__2e519);
+	t__2e521 = (u64)((u64)t__2e519 + (u64)((u64)8UL));
+	t__2e522 = (u64)(*(u32 *)t__2e521);
+	t__2e521 = (u64)((u64)t__2e519 + (u64)((u64)12UL));
+	t__2e523 = (u64)(*(u32 *)t__2e521);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e520, (u64)t__2e522, (u64)t__2e523, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e534:;
+	t__2e535 = (u64)((u64)t_abortsite_2e517 * (u64)((u64)16UL));
+	t__2e535 = (u64)((u64)((u64)((char *)&D_abortsites_2e516)) + (u64)t__2e535);
+	t__2e536 = (u64)(*(u64 *)t__2e535);
+	t__2e537 = (u64)((u64)t__2e535 + (u64)((u64)8UL));
+	t__2e538 = (u64)(*(u32 *)t__2e537);
+	t__2e537 = (u64)((u64)t__2e535 + (u64)((u64)12UL));
+	t__2e539 = (u64)(*(u32 *)t__2e537);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e536, (u64)t__2e538, (u64)t__2e539, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_binding(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e554;
+	u64 t__2e556;
+	u64 t__2e564;
+	u64 t__2e565;
+	u64 t__2e566;
+	u64 t__2e567;
+	u64 t__2e568;
+	u64 t_abortsite_2e562;
+	u64 t_binding_2e545;
+	u64 t_binding_2e559;
+	u64 t_tag_2e547;
+	L_start_2e541:;
+	t_binding_2e545 = (u64)A0;
+	t_binding_2e559 = (u64)A1;
+	L_body_2e542:;
+	*(u32 *)t_binding_2e545 = (u32)((u64)3012680272UL);
+	t_tag_2e547 = (u64)(*(u32 *)t_binding_2e545);
+	t__2e554 = (u64)(u32)(((u32)t_tag_2e547 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e554) goto L_member_2e551; else goto L__2e553;
+	L__2e553:;
+	t__2e556 = (u64)(u32)(((u32)t_tag_2e547 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e556) goto L_member_2e552; else goto L__2e555;
+	L__2e555:;
+	goto L_matches_2e550;
+	L_member_2e551:;
+	goto L_matches_2e550;
+	L_member_2e552:;
+	goto L_matches_2e550;
+	L_matches_2e550:;
+	*(u32 *)t_binding_2e559 = (u32)((u64)42UL);
+	goto L__2e557;
+	L__2e560:;
+	L__2e557:;
+	goto L__2e548;
+	L__2e549:;
+	t_abortsite_2e562 = ((u64)0UL);
+	goto L_abort_2e563;
+	L__2e548:;
+	goto L__2e543;
+	L__2e569:;
+	L__2e543:;
+	return;
+	L_abort_2e563:;
+	t__2e564 = (u64)((u64)t_abortsite_2e562 * (u64)((u64)16UL));
+	t__2e564 = (u64)((u64)((u64)((char *)&D_abortsites_2e561)) + (u64)t__2e564);
+	t__2e565 = (u64)(*(u64 *)t__2e564);
+	t__2e566 = (u64)((u64)t__2e564 + (u64)((u64)8UL));
+	t__2e567 = (u64)(*(u32 *)t__2e566);
+	t__2e566 = (u64)((u64)t__2e564 + (u64)((u64)12UL));
+	t__2e568 = (u64)(*(u32 *)t__2e566);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e565, (u64)t__2e567, (u64)t__2e568, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_alignment__conversion(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[16] __attribute__((aligned(16)));
+	u64 t__2e580;
+	u64 t__2e591;
+	u64 t__2e593;
+	u64 t__2e595;
+	u64 t__2e597;
+	u64 t__2e602;
+	u64 t__2e603;
+	u64 t__2e604;
+	u64 t__2e608;
+	u64 t__2e614;
+	u64 t__2e615;
+	u64 t__2e616;
+	u64 t__2e617;
+	u64 t__2e618;
+	u64 t__2e619;
+	u64 t__2e621;
+	u64 t__2e622;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e625;
+	u64 t__2e632;
+	u64 t__2e633;
+	u64 t__2e634;
+	u64 t__2e635;
+	u64 t__2e636;
+	u64 t__2e638;
+	u64 t__2e642;
+	u64 t__2e643;
+	u64 t__2e644;
+	u64 t__2e648;
+	u64 t__2e651;
+	u64 t_abortsite_2e612;
+	u64 t_binding_2e574;
+	u64 t_binding_2e596;
+	u64 t_binding_2e637;
+	u64 t_object_2e639;
+	u64 t_subval_2e607;
+	u64 t_subval_2e647;
+	u64 t_tag_2e582;
+	L_start_2e570:;
+	t_binding_2e574 = (u64)A0;
+	t_binding_2e596 = (u64)A1;
+	t_binding_2e637 = (u64)A2;
+	t_object_2e639 = (u64)A3;
+	L_body_2e571:;
+	*(u32 *)t_binding_2e574 = (u32)((u64)1099590421UL);
+	t__2e580 = (u64)((u64)t_binding_2e574 + (u64)((u64)4UL));
+	*(u32 *)t__2e580 = (u32)((u64)1234UL);
+	t_tag_2e582 = (u64)(*(u32 *)t_binding_2e574);
+	t__2e591 = (u64)(u32)(((u32)t_tag_2e582 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e591) goto L_member_2e587; else goto L__2e590;
+	L__2e590:;
+	t__2e593 = (u64)(u32)(((u32)t_tag_2e582 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e593) goto L_member_2e588; else goto L__2e592;
+	L__2e592:;
+	t__2e595 = (u64)(u32)(((u32)t_tag_2e582 == (u32)((u64)3312558843UL)));
+	if ((u32)t__2e595) goto L_member_2e589; else goto L__2e594;
+	L__2e594:;
+	goto L_matches_2e586;
+	L_member_2e587:;
+	goto L_matches_2e585;
+	L_member_2e588:;
+	goto L_matches_2e585;
+	L_member_2e589:;
+	goto L_matches_2e586;
+	L_matches_2e585:;
+	t__2e597 = t_binding_2e574;
+	BLIT(t_binding_2e596, t__2e597, ((u64)8UL));
+	t__2e603 = t_binding_2e596;
+	t__2e604 = (u64)(u32)(*(u32 *)t_binding_2e596);
+	t_subval_2e607 = t_binding_2e596;
+	t__2e608 = (u64)(u32)(((u32)t__2e604 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e608) goto L_subtype_2e610; else goto L_failed_2e606;
+	L_subtype_2e610:;
+	goto L_passed_2e605;
+	L_failed_2e606:;
+	t_abortsite_2e612 = ((u64)0UL);
+	goto L_abort_2e613;
+	L_passed_2e605:;
+	t__2e603 = (u64)((u64)t__2e603 + (u64)((u64)4UL));
+	t__2e619 = (u64)(u32)(*(i32 *)t__2e603);
+	t__2e602 = (u64)(u32)(((u32)t__2e619 == (u32)((u64)1234UL)));
+	if ((u32)t__2e602) goto L_passed_2e601; else goto L_failed_2e600;
+	L_failed_2e600:;
+	t_abortsite_2e612 = ((u64)1UL);
+	goto L_abort_2e620;
+	L_passed_2e601:;
+	goto L__2e598;
+	L__2e626:;
+	L__2e598:;
+	goto L__2e583;
+	L_matches_2e586:;
+	t_abortsite_2e612 = ((u64)2UL);
+	goto L_abort_2e620;
+	L__2e629:;
+	L__2e627:;
+	L__2e630:;
+	L__2e584:;
+	t_abortsite_2e612 = ((u64)3UL);
+	goto L_abort_2e631;
+	L__2e583:;
+	*(u32 *)t_binding_2e637 = (u32)((u64)1099590421UL);
+	t__2e638 = (u64)((u64)t_binding_2e637 + (u64)((u64)4UL));
+	*(u32 *)t__2e638 = (u32)((u64)4321UL);
+	BLIT(t_object_2e639, t_binding_2e637, ((u64)8UL));
+	BLIT(t_binding_2e574, t_object_2e639, ((u64)16UL));
+	t__2e643 = t_binding_2e574;
+	t__2e644 = (u64)(u32)(*(u32 *)t_binding_2e574);
+	t_subval_2e647 = t_binding_2e574;
+	t__2e648 = (u64)(u32)(((u32)t__2e644 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e648) goto L_subtype_2e650; else goto L_failed_2e646;
+	L_subtype_2e650:;
+	goto L_passed_2e645;
+	L_failed_2e646:;
+	t_abortsite_2e612 = ((u64)4UL);
+	goto L_abort_2e613;
+	L_passed_2e645:;
+	t__2e643 = (u64)((u64)t__2e643 + (u64)((u64)4UL));
+	t__2e651 = (u64)(u32)(*(i32 *)t__2e643);
+	t__2e642 = (u64)(u32)(((u32)t__2e651 == (u32)((u64)4321UL)));
+	if ((u32)t__2e642) goto L_passed_2e641; else goto L_failed_2e640;
+	L_failed_2e640:;
+	t_abortsite_2e612 = ((u64)5UL);
+	goto L_abort_2e620;
+	L_passed_2e641:;
+	goto L__2e572;
+	L__2e652:;
+	L__2e572:;
+	return;
+	L_abort_2e613:;
+	t__2e614 = (u64)((u64)t_abortsite_2e612 * (u64)((u64)16UL));
+	t__2e614 = (u64)((u64)((u64)((char *)&D_abortsites_2e611)) + (u64)t__2e614);
+	t__2e615 = (u64)(*(u64 *)t__2e614);
+	t__2e616 = (u64)((u64)t__2e614 + (u64)((u64)8UL));
+	t__2e617 = (u64)(*(u32 *)t__2e616);
+	t__2e616 = (u64)((u64)t__2e614 + (u64)((u64)12UL));
+	t__2e618 = (u64)(*(u32 *)t__2e616);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e615, (u64)t__2e617, (u64)t__2e618, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e620:;
+	t__2e621 = (u64)((u64)t_abortsite_2e612 * (u64)((u64)16UL));
+	t__2e621 = (u64)((u64)((u64)((char *)&D_abortsites_2e611)) + (u64)t__2e621);
+	t__2e622 = (u64)(*(u64 *)t__2e621);
+	t__2e623 = (u64)((u64)t__2e621 + (u64)((u64)8UL));
+	t__2e624 = (u64)(*(u32 *)t__2e623);
+	t__2e623 = (u64)((u64)t__2e621 + (u64)((u64)12UL));
+	t__2e625 = (u64)(*(u32 *)t__2e623);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e622, (u64)t__2e624, (u64)t__2e625, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e631:;
+	t__2e632 = (u64)((u64)t_abortsite_2e612 * (u64)((u64)16UL));
+	t__2e632 = (u64)((u64)((u64)((char *)&D_abortsites_2e611)) + (u64)t__2e632);
+	t__2e633 = (u64)(*(u64 *)t__2e632);
+	t__2e634 = (u64)((u64)t__2e632 + (u64)((u64)8UL));
+	t__2e635 = (u64)(*(u32 *)t__2e634);
+	t__2e634 = (u64)((u64)t__2e632 + (u64)((u64)12UL));
+	t__2e636 = (u64)(*(u32 *)t__2e634);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e633, (u64)t__2e635, (u64)t__2e636, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_numeric(void) {
+	char A0[1] __attribute__((aligned(16)));
+	char A1[16] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[16] __attribute__((aligned(16)));
+	u64 t__2e668;
+	u64 t__2e688;
+	u64 t__2e691;
+	u64 t__2e693;
+	u64 t__2e695;
+	u64 t__2e697;
+	u64 t__2e699;
+	u64 t__2e701;
+	u64 t__2e704;
+	u64 t__2e706;
+	u64 t__2e708;
+	u64 t__2e710;
+	u64 t__2e712;
+	u64 t__2e714;
+	u64 t__2e716;
+	u64 t__2e718;
+	u64 t__2e743;
+	u64 t__2e745;
+	u64 t__2e747;
+	u64 t__2e749;
+	u64 t__2e751;
+	u64 t__2e753;
+	u64 t__2e755;
+	u64 t__2e756;
+	u64 t__2e761;
+	u64 t__2e762;
+	u64 t__2e766;
+	u64 t__2e767;
+	u64 t__2e768;
+	u64 t__2e769;
+	u64 t__2e770;
+	u64 t__2e777;
+	u64 t__2e778;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e781;
+	u64 t__2e784;
+	u64 t__2e800;
+	u64 t_abortsite_2e764;
+	u64 t_binding_2e657;
+	u64 t_binding_2e658;
+	u64 t_binding_2e717;
+	u64 t_binding_2e754;
+	u64 t_binding_2e783;
+	u64 t_tag_2e670;
+	u64 t_tag_2e731;
+	L_start_2e653:;
+	t_binding_2e657 = (u64)A0;
+	t_binding_2e658 = (u64)A1;
+	t_binding_2e717 = (u64)A2;
+	t_binding_2e754 = (u64)A3;
+	t_binding_2e783 = (u64)A4;
+	L_body_2e654:;
+	*(u8 *)t_binding_2e657 = (u8)((u64)1UL);
+	*(u32 *)t_binding_2e658 = (u32)((u64)1099590421UL);
+	t__2e668 = (u64)((u64)t_binding_2e658 + (u64)((u64)4UL));
+	*(u32 *)t__2e668 = (u32)((u64)1337UL);
+	t_tag_2e670 = (u64)(*(u32 *)t_binding_2e658);
+	t__2e688 = (u64)(u32)(((u32)t_tag_2e670 < (u32)((u64)2206074632UL)));
+	if ((u32)t__2e688) goto L_switch_2elt_2e686; else goto L_switch_2ege_2e687;
+	L_switch_2elt_2e686:;
+	t__2e691 = (u64)(u32)(((u32)t_tag_2e670 < (u32)((u64)1399468992UL)));
+	if ((u32)t__2e691) goto L_switch_2elt_2e689; else goto L_switch_2ege_2e690;
+	L_switch_2elt_2e689:;
+	t__2e693 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e693) goto L_member_2e675; else goto L__2e692;
+	L__2e692:;
+	t__2e695 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)1268499444UL)));
+	if ((u32)t__2e695) goto L_member_2e676; else goto L__2e694;
+	L__2e694:;
+	goto L__2e672;
+	L_switch_2ege_2e690:;
+	t__2e697 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)1399468992UL)));
+	if ((u32)t__2e697) goto L_member_2e677; else goto L__2e696;
+	L__2e696:;
+	t__2e699 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)1906196061UL)));
+	if ((u32)t__2e699) goto L_member_2e678; else goto L__2e698;
+	L__2e698:;
+	t__2e701 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)2037165609UL)));
+	if ((u32)t__2e701) goto L_member_2e679; else goto L__2e700;
+	L__2e700:;
+	goto L__2e672;
+	L_switch_2ege_2e687:;
+	t__2e704 = (u64)(u32)(((u32)t_tag_2e670 < (u32)((u64)3181589295UL)));
+	if ((u32)t__2e704) goto L_switch_2elt_2e702; else goto L_switch_2ege_2e703;
+	L_switch_2elt_2e702:;
+	t__2e706 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)2206074632UL)));
+	if ((u32)t__2e706) goto L_member_2e680; else goto L__2e705;
+	L__2e705:;
+	t__2e708 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)2543892678UL)));
+	if ((u32)t__2e708) goto L_member_2e681; else goto L__2e707;
+	L__2e707:;
+	t__2e710 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)2674862226UL)));
+	if ((u32)t__2e710) goto L_member_2e682; else goto L__2e709;
+	L__2e709:;
+	goto L__2e672;
+	L_switch_2ege_2e703:;
+	t__2e712 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)3181589295UL)));
+	if ((u32)t__2e712) goto L_member_2e683; else goto L__2e711;
+	L__2e711:;
+	t__2e714 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)3312558843UL)));
+	if ((u32)t__2e714) goto L_member_2e684; else goto L__2e713;
+	L__2e713:;
+	t__2e716 = (u64)(u32)(((u32)t_tag_2e670 == (u32)((u64)3481467866UL)));
+	if ((u32)t__2e716) goto L_member_2e685; else goto L__2e715;
+	L__2e715:;
+	goto L__2e672;
+	L_member_2e675:;
+	goto L_matches_2e673;
+	L_member_2e676:;
+	goto L_matches_2e674;
+	L_member_2e677:;
+	goto L_matches_2e673;
+	L_member_2e678:;
+	goto L_matches_2e674;
+	L_member_2e679:;
+	goto L_matches_2e673;
+	L_member_2e680:;
+	goto L_matches_2e674;
+	L_member_2e681:;
+	goto L_matches_2e674;
+	L_member_2e682:;
+	goto L_matches_2e673;
+	L_member_2e683:;
+	goto L_matches_2e674;
+	L_member_2e684:;
+	goto L_matches_2e673;
+	L_member_2e685:;
+	goto L_matches_2e674;
+	L_matches_2e673:;
+	t__2e718 = t_binding_2e658;
+	BLIT(t_binding_2e717, t__2e718, ((u64)16UL));
+	t_tag_2e731 = (u64)(*(u32 *)t_binding_2e717);
+	t__2e743 = (u64)(u32)(((u32)t_tag_2e731 < (u32)((u64)2037165609UL)));
+	if ((u32)t__2e743) goto L_switch_2elt_2e741; else goto L_switch_2ege_2e742;
+	L_switch_2elt_2e741:;
+	t__2e745 = (u64)(u32)(((u32)t_tag_2e731 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e745) goto L_member_2e736; else goto L__2e744;
+	L__2e744:;
+	t__2e747 = (u64)(u32)(((u32)t_tag_2e731 == (u32)((u64)1399468992UL)));
+	if ((u32)t__2e747) goto L_member_2e737; else goto L__2e746;
+	L__2e746:;
+	goto L_matches_2e735;
+	L_switch_2ege_2e742:;
+	t__2e749 = (u64)(u32)(((u32)t_tag_2e731 == (u32)((u64)2037165609UL)));
+	if ((u32)t__2e749) goto L_member_2e738; else goto L__2e748;
+	L__2e748:;
+	t__2e751 = (u64)(u32)(((u32)t_tag_2e731 == (u32)((u64)2674862226UL)));
+	if ((u32)t__2e751) goto L_member_2e739; else goto L__2e750;
+	L__2e750:;
+	t__2e753 = (u64)(u32)(((u32)t_tag_2e731 == (u32)((u64)3312558843UL)));
+	if ((u32)t__2e753) goto L_member_2e740; else goto L__2e752;
+	L__2e752:;
+	goto L_matches_2e735;
+	L_member_2e736:;
+	goto L_matches_2e734;
+	L_member_2e737:;
+	goto L_matches_2e735;
+	L_member_2e738:;
+	goto L_matches_2e735;
+	L_member_2e739:;
+	goto L_matches_2e735;
+	L_member_2e740:;
+	goto L_matches_2e735;
+	L_matches_2e734:;
+	t__2e755 = (u64)((u64)t_binding_2e717 + (u64)((u64)4UL));
+	t__2e756 = (u64)(u32)(*(i32 *)t__2e755);
+	*(u32 *)t_binding_2e754 = (u32)t__2e756;
+	*(u8 *)t_binding_2e657 = (u8)((u64)1UL);
+	t__2e762 = (u64)(u32)(*(i32 *)t_binding_2e754);
+	t__2e761 = (u64)(u32)(((u32)t__2e762 == (u32)((u64)1337UL)));
+	if ((u32)t__2e761) goto L_passed_2e760; else goto L_failed_2e759;
+	L_failed_2e759:;
+	t_abortsite_2e764 = ((u64)0UL);
+	goto L_abort_2e765;
+	L_passed_2e760:;
+	goto L__2e757;
+	L__2e771:;
+	L__2e757:;
+	goto L__2e732;
+	L_matches_2e735:;
+	t_abortsite_2e764 = ((u64)1UL);
+	goto L_abort_2e765;
+	L__2e774:;
+	L__2e772:;
+	L__2e775:;
+	L__2e733:;
+	t_abortsite_2e764 = ((u64)2UL);
+	goto L_abort_2e776;
+	L__2e732:;
+	goto L__2e728;
+	L__2e782:;
+	L__2e728:;
+	goto L__2e671;
+	L_matches_2e674:;
+	t__2e784 = t_binding_2e658;
+	BLIT(t_binding_2e783, t__2e784, ((u64)16UL));
+	t_abortsite_2e764 = ((u64)3UL);
+	goto L_abort_2e765;
+	L__2e796:;
+	L__2e794:;
+	L__2e797:;
+	L__2e672:;
+	t_abortsite_2e764 = ((u64)4UL);
+	goto L_abort_2e776;
+	L__2e671:;
+	t__2e800 = (u64)(u32)(*(u8 *)t_binding_2e657);
+	if ((u32)t__2e800) goto L_passed_2e799; else goto L_failed_2e798;
+	L_failed_2e798:;
+	t_abortsite_2e764 = ((u64)5UL);
+	goto L_abort_2e765;
+	L_passed_2e799:;
+	goto L__2e655;
+	L__2e801:;
+	L__2e655:;
+	return;
+	L_abort_2e765:;
+	t__2e766 = (u64)((u64)t_abortsite_2e764 * (u64)((u64)16UL));
+	t__2e766 = (u64)((u64)((u64)((char *)&D_abortsites_2e763)) + (u64)t__2e766);
+	t__2e767 = (u64)(*(u64 *)t__2e766);
+	t__2e768 = (u64)((u64)t__2e766 + (u64)((u64)8UL));
+	t__2e769 = (u64)(*(u32 *)t__2e768);
+	t__2e768 = (u64)((u64)t__2e766 + (u64)((u64)12UL));
+	t__2e770 = (u64)(*(u32 *)t__2e768);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e767, (u64)t__2e769, (u64)t__2e770, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e776:;
+	t__2e777 = (u64)((u64)t_abortsite_2e764 * (u64)((u64)16UL));
+	t__2e777 = (u64)((u64)((u64)((char *)&D_abortsites_2e763)) + (u64)t__2e777);
+	t__2e778 = (u64)(*(u64 *)t__2e777);
+	t__2e779 = (u64)((u64)t__2e777 + (u64)((u64)8UL));
+	t__2e780 = (u64)(*(u32 *)t__2e779);
+	t__2e779 = (u64)((u64)t__2e777 + (u64)((u64)12UL));
+	t__2e781 = (u64)(*(u32 *)t__2e779);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e778, (u64)t__2e780, (u64)t__2e781, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_transitivity(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[1] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[4] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	u64 t__2e1004;
+	u64 t__2e1005;
+	u64 t__2e1021;
+	u64 t__2e1023;
+	u64 t__2e1034;
+	u64 t__2e1036;
+	u64 t__2e1039;
+	u64 t__2e1040;
+	u64 t__2e1045;
+	u64 t__2e1046;
+	u64 t__2e1062;
+	u64 t__2e1067;
+	u64 t__2e1077;
+	u64 t__2e1079;
+	u64 t__2e1082;
+	u64 t__2e811;
+	u64 t__2e822;
+	u64 t__2e824;
+	u64 t__2e827;
+	u64 t__2e828;
+	u64 t__2e833;
+	u64 t__2e834;
+	u64 t__2e838;
+	u64 t__2e839;
+	u64 t__2e844;
+	u64 t__2e845;
+	u64 t__2e849;
+	u64 t__2e850;
+	u64 t__2e851;
+	u64 t__2e852;
+	u64 t__2e853;
+	u64 t__2e864;
+	u64 t__2e865;
+	u64 t__2e866;
+	u64 t__2e867;
+	u64 t__2e868;
+	u64 t__2e870;
+	u64 t__2e882;
+	u64 t__2e884;
+	u64 t__2e887;
+	u64 t__2e888;
+	u64 t__2e893;
+	u64 t__2e894;
+	u64 t__2e910;
+	u64 t__2e912;
+	u64 t__2e923;
+	u64 t__2e925;
+	u64 t__2e928;
+	u64 t__2e929;
+	u64 t__2e945;
+	u64 t__2e955;
+	u64 t__2e957;
+	u64 t__2e959;
+	u64 t__2e964;
+	u64 t__2e967;
+	u64 t__2e977;
+	u64 t__2e982;
+	u64 t__2e993;
+	u64 t__2e995;
+	u64 t__2e998;
+	u64 t__2e999;
+	u64 t_abortsite_2e847;
+	u64 t_binding_2e1063;
+	u64 t_binding_2e806;
+	u64 t_binding_2e837;
+	u64 t_binding_2e871;
+	u64 t_binding_2e958;
+	u64 t_binding_2e978;
+	u64 t_object_2e1022;
+	u64 t_object_2e869;
+	u64 t_object_2e911;
+	u64 t_subval_2e1003;
+	u64 t_subval_2e1038;
+	u64 t_subval_2e1044;
+	u64 t_subval_2e1081;
+	u64 t_subval_2e826;
+	u64 t_subval_2e832;
+	u64 t_subval_2e886;
+	u64 t_subval_2e892;
+	u64 t_subval_2e927;
+	u64 t_subval_2e966;
+	u64 t_subval_2e997;
+	u64 t_tag_2e1025;
+	u64 t_tag_2e1069;
+	u64 t_tag_2e813;
+	u64 t_tag_2e873;
+	u64 t_tag_2e914;
+	u64 t_tag_2e947;
+	u64 t_tag_2e984;
+	L_start_2e802:;
+	t_binding_2e806 = (u64)A0;
+	t_binding_2e837 = (u64)A1;
+	t_object_2e869 = (u64)A2;
+	t_binding_2e871 = (u64)A3;
+	t_object_2e911 = (u64)A4;
+	t_binding_2e958 = (u64)A5;
+	t_binding_2e978 = (u64)A6;
+	t_object_2e1022 = (u64)A7;
+	t_binding_2e1063 = (u64)A8;
+	L_body_2e803:;
+	*(u32 *)t_binding_2e806 = (u32)((u64)1099590421UL);
+	t__2e811 = (u64)((u64)t_binding_2e806 + (u64)((u64)4UL));
+	*(u32 *)t__2e811 = (u32)((u64)10UL);
+	t_tag_2e813 = (u64)(*(u32 *)t_binding_2e806);
+	t__2e822 = (u64)(u32)(((u32)t_tag_2e813 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e822) goto L_member_2e819; else goto L__2e821;
+	L__2e821:;
+	t__2e824 = (u64)(u32)(((u32)t_tag_2e813 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e824) goto L_member_2e820; else goto L__2e823;
+	L__2e823:;
+	goto L__2e815;
+	L_member_2e819:;
+	goto L_matches_2e816;
+	L_member_2e820:;
+	t_subval_2e826 = t_binding_2e806;
+	t__2e827 = (u64)(u32)(((u32)t_tag_2e813 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e827) goto L_subtype_2e829; else goto L_next_2e825;
+	L_subtype_2e829:;
+	t_subval_2e826 = (u64)((u64)t_subval_2e826 + (u64)((u64)4UL));
+	t__2e828 = (u64)(u32)(*(u32 *)t_subval_2e826);
+	t__2e827 = (u64)(u32)(((u32)t__2e828 == (u32)((u64)1804912991UL)));
+	if ((u32)t__2e827) goto L_subtype_2e830; else goto L_next_2e825;
+	L_subtype_2e830:;
+	goto L_matches_2e817;
+	L_next_2e825:;
+	t_subval_2e832 = t_binding_2e806;
+	t__2e833 = (u64)(u32)(((u32)t_tag_2e813 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e833) goto L_subtype_2e835; else goto L_next_2e831;
+	L_subtype_2e835:;
+	t_subval_2e832 = (u64)((u64)t_subval_2e832 + (u64)((u64)4UL));
+	t__2e834 = (u64)(u32)(*(u32 *)t_subval_2e832);
+	t__2e833 = (u64)(u32)(((u32)t__2e834 == (u32)((u64)896429772UL)));
+	if ((u32)t__2e833) goto L_subtype_2e836; else goto L_next_2e831;
+	L_subtype_2e836:;
+	goto L_matches_2e818;
+	L_next_2e831:;
+	goto L__2e815;
+	L_matches_2e816:;
+	t__2e838 = (u64)((u64)t_binding_2e806 + (u64)((u64)4UL));
+	t__2e839 = (u64)(u32)(*(i32 *)t__2e838);
+	*(u32 *)t_binding_2e837 = (u32)t__2e839;
+	t__2e845 = (u64)(u32)(*(i32 *)t_binding_2e837);
+	t__2e844 = (u64)(u32)(((u32)t__2e845 == (u32)((u64)10UL)));
+	if ((u32)t__2e844) goto L_passed_2e843; else goto L_failed_2e842;
+	L_failed_2e842:;
+	t_abortsite_2e847 = ((u64)0UL);
+	goto L_abort_2e848;
+	L_passed_2e843:;
+	goto L__2e840;
+	L__2e854:;
+	L__2e840:;
+	goto L__2e814;
+	L_matches_2e817:;
+	t_abortsite_2e847 = ((u64)1UL);
+	goto L_abort_2e848;
+	L__2e857:;
+	L__2e855:;
+	L__2e858:;
+	L_matches_2e818:;
+	t_abortsite_2e847 = ((u64)2UL);
+	goto L_abort_2e848;
+	L__2e861:;
+	L__2e859:;
+	L__2e862:;
+	L__2e815:;
+	t_abortsite_2e847 = ((u64)3UL);
+	goto L_abort_2e863;
+	L__2e814:;
+	*(u32 *)t_object_2e869 = (u32)((u64)3065563438UL);
+	t__2e870 = (u64)((u64)t_object_2e869 + (u64)((u64)4UL));
+	*(u32 *)t__2e870 = (u32)((u64)1804912991UL);
+	BLIT(t_binding_2e806, t_object_2e869, ((u64)8UL));
+	*(u8 *)t_binding_2e871 = (u8)((u64)0UL);
+	t_tag_2e873 = (u64)(*(u32 *)t_binding_2e806);
+	t__2e882 = (u64)(u32)(((u32)t_tag_2e873 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e882) goto L_member_2e879; else goto L__2e881;
+	L__2e881:;
+	t__2e884 = (u64)(u32)(((u32)t_tag_2e873 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e884) goto L_member_2e880; else goto L__2e883;
+	L__2e883:;
+	goto L__2e875;
+	L_member_2e879:;
+	goto L_matches_2e876;
+	L_member_2e880:;
+	t_subval_2e886 = t_binding_2e806;
+	t__2e887 = (u64)(u32)(((u32)t_tag_2e873 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e887) goto L_subtype_2e889; else goto L_next_2e885;
+	L_subtype_2e889:;
+	t_subval_2e886 = (u64)((u64)t_subval_2e886 + (u64)((u64)4UL));
+	t__2e888 = (u64)(u32)(*(u32 *)t_subval_2e886);
+	t__2e887 = (u64)(u32)(((u32)t__2e888 == (u32)((u64)1804912991UL)));
+	if ((u32)t__2e887) goto L_subtype_2e890; else goto L_next_2e885;
+	L_subtype_2e890:;
+	goto L_matches_2e877;
+	L_next_2e885:;
+	t_subval_2e892 = t_binding_2e806;
+	t__2e893 = (u64)(u32)(((u32)t_tag_2e873 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e893) goto L_subtype_2e895; else goto L_next_2e891;
+	L_subtype_2e895:;
+	t_subval_2e892 = (u64)((u64)t_subval_2e892 + (u64)((u64)4UL));
+	t__2e894 = (u64)(u32)(*(u32 *)t_subval_2e892);
+	t__2e893 = (u64)(u32)(((u32)t__2e894 == (u32)((u64)896429772UL)));
+	if ((u32)t__2e893) goto L_subtype_2e896; else goto L_next_2e891;
+	L_subtype_2e896:;
+	goto L_matches_2e878;
+	L_next_2e891:;
+	goto L__2e875;
+	L_matches_2e876:;
+	t_abortsite_2e847 = ((u64)4UL);
+	goto L_abort_2e848;
+	L__2e899:;
+	L__2e897:;
+	L__2e900:;
+	L_matches_2e877:;
+	*(u8 *)t_binding_2e871 = (u8)((u64)1UL);
+	goto L__2e901;
+	L__2e903:;
+	L__2e901:;
+	goto L__2e874;
+	L_matches_2e878:;
+	t_abortsite_2e847 = ((u64)5UL);
+	goto L_abort_2e848;
+	L__2e906:;
+	L__2e904:;
+	L__2e907:;
+	L__2e875:;
+	t_abortsite_2e847 = ((u64)6UL);
+	goto L_abort_2e863;
+	L__2e874:;
+	t__2e910 = (u64)(u32)(*(u8 *)t_binding_2e871);
+	if ((u32)t__2e910) goto L_passed_2e909; else goto L_failed_2e908;
+	L_failed_2e908:;
+	t_abortsite_2e847 = ((u64)7UL);
+	goto L_abort_2e848;
+	L_passed_2e909:;
+	*(u32 *)t_object_2e911 = (u32)((u64)3065563438UL);
+	t__2e912 = (u64)((u64)t_object_2e911 + (u64)((u64)4UL));
+	*(u32 *)t__2e912 = (u32)((u64)896429772UL);
+	BLIT(t_binding_2e806, t_object_2e911, ((u64)8UL));
+	*(u8 *)t_binding_2e871 = (u8)((u64)0UL);
+	t_tag_2e914 = (u64)(*(u32 *)t_binding_2e806);
+	t__2e923 = (u64)(u32)(((u32)t_tag_2e914 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e923) goto L_member_2e920; else goto L__2e922;
+	L__2e922:;
+	t__2e925 = (u64)(u32)(((u32)t_tag_2e914 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e925) goto L_member_2e921; else goto L__2e924;
+	L__2e924:;
+	goto L__2e916;
+	L_member_2e920:;
+	goto L_matches_2e917;
+	L_member_2e921:;
+	t_subval_2e927 = t_binding_2e806;
+	t__2e928 = (u64)(u32)(((u32)t_tag_2e914 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e928) goto L_subtype_2e930; else goto L_next_2e926;
+	L_subtype_2e930:;
+	t_subval_2e927 = (u64)((u64)t_subval_2e927 + (u64)((u64)4UL));
+	t__2e929 = (u64)(u32)(*(u32 *)t_subval_2e927);
+	t__2e928 = (u64)(u32)(((u32)t__2e929 == (u32)((u64)1804912991UL)));
+	if ((u32)t__2e928) goto L_subtype_2e931; else goto L_next_2e926;
+	L_subtype_2e931:;
+	goto L_matches_2e918;
+	L_next_2e926:;
+	goto L_matches_2e919;
+	L_matches_2e917:;
+	t_abortsite_2e847 = ((u64)8UL);
+	goto L_abort_2e848;
+	L__2e934:;
+	L__2e932:;
+	L__2e935:;
+	L_matches_2e918:;
+	t_abortsite_2e847 = ((u64)9UL);
+	goto L_abort_2e848;
+	L__2e938:;
+	L__2e936:;
+	L__2e939:;
+	L_matches_2e919:;
+	*(u8 *)t_binding_2e871 = (u8)((u64)1UL);
+	goto L__2e940;
+	L__2e942:;
+	L__2e940:;
+	goto L__2e915;
+	L__2e916:;
+	t_abortsite_2e847 = ((u64)10UL);
+	goto L_abort_2e863;
+	L__2e915:;
+	t__2e945 = (u64)(u32)(*(u8 *)t_binding_2e871);
+	if ((u32)t__2e945) goto L_passed_2e944; else goto L_failed_2e943;
+	L_failed_2e943:;
+	t_abortsite_2e847 = ((u64)11UL);
+	goto L_abort_2e848;
+	L_passed_2e944:;
+	*(u8 *)t_binding_2e871 = (u8)((u64)0UL);
+	t_tag_2e947 = (u64)(*(u32 *)t_binding_2e806);
+	t__2e955 = (u64)(u32)(((u32)t_tag_2e947 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e955) goto L_member_2e952; else goto L__2e954;
+	L__2e954:;
+	t__2e957 = (u64)(u32)(((u32)t_tag_2e947 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e957) goto L_member_2e953; else goto L__2e956;
+	L__2e956:;
+	goto L__2e949;
+	L_member_2e952:;
+	goto L_matches_2e951;
+	L_member_2e953:;
+	goto L_matches_2e950;
+	L_matches_2e950:;
+	t__2e959 = (u64)((u64)t_binding_2e806 + (u64)((u64)4UL));
+	BLIT(t_binding_2e958, t__2e959, ((u64)4UL));
+	*(u8 *)t_binding_2e871 = (u8)((u64)1UL);
+	t__2e964 = (u64)(u32)(*(u32 *)t_binding_2e958);
+	t_subval_2e966 = t_binding_2e958;
+	t__2e967 = (u64)(u32)(((u32)t__2e964 == (u32)((u64)896429772UL)));
+	if ((u32)t__2e967) goto L_subtype_2e969; else goto L_passed_2e965;
+	L_subtype_2e969:;
+	goto L_passed_2e965;
+	L_passed_2e965:;
+	if ((u32)t__2e967) goto L_passed_2e963; else goto L_failed_2e962;
+	L_failed_2e962:;
+	t_abortsite_2e847 = ((u64)12UL);
+	goto L_abort_2e848;
+	L_passed_2e963:;
+	goto L__2e960;
+	L__2e970:;
+	L__2e960:;
+	goto L__2e948;
+	L_matches_2e951:;
+	t_abortsite_2e847 = ((u64)13UL);
+	goto L_abort_2e848;
+	L__2e973:;
+	L__2e971:;
+	L__2e974:;
+	L__2e949:;
+	t_abortsite_2e847 = ((u64)14UL);
+	goto L_abort_2e863;
+	L__2e948:;
+	t__2e977 = (u64)(u32)(*(u8 *)t_binding_2e871);
+	if ((u32)t__2e977) goto L_passed_2e976; else goto L_failed_2e975;
+	L_failed_2e975:;
+	t_abortsite_2e847 = ((u64)15UL);
+	goto L_abort_2e848;
+	L_passed_2e976:;
+	*(u32 *)t_binding_2e978 = (u32)((u64)89824132UL);
+	t__2e982 = (u64)((u64)t_binding_2e978 + (u64)((u64)4UL));
+	*(u32 *)t__2e982 = (u32)((u64)10UL);
+	*(u8 *)t_binding_2e871 = (u8)((u64)0UL);
+	t_tag_2e984 = (u64)(*(u32 *)t_binding_2e978);
+	t__2e993 = (u64)(u32)(((u32)t_tag_2e984 == (u32)((u64)89824132UL)));
+	if ((u32)t__2e993) goto L_member_2e990; else goto L__2e992;
+	L__2e992:;
+	t__2e995 = (u64)(u32)(((u32)t_tag_2e984 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e995) goto L_member_2e991; else goto L__2e994;
+	L__2e994:;
+	goto L__2e986;
+	L_member_2e990:;
+	goto L_matches_2e987;
+	L_member_2e991:;
+	t_subval_2e997 = t_binding_2e978;
+	t__2e998 = (u64)(u32)(((u32)t_tag_2e984 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e998) goto L_subtype_2e1000; else goto L_next_2e996;
+	L_subtype_2e1000:;
+	t_subval_2e997 = (u64)((u64)t_subval_2e997 + (u64)((u64)4UL));
+	t__2e999 = (u64)(u32)(*(u32 *)t_subval_2e997);
+	t__2e998 = (u64)(u32)(((u32)t__2e999 == (u32)((u64)1804912991UL)));
+	if ((u32)t__2e998) goto L_subtype_2e1001; else goto L_next_2e996;
+	L_subtype_2e1001:;
+	goto L_matches_2e988;
+	L_next_2e996:;
+	t_subval_2e1003 = t_binding_2e978;
+	t__2e1004 = (u64)(u32)(((u32)t_tag_2e984 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e1004) goto L_subtype_2e1006; else goto L_next_2e1002;
+	L_subtype_2e1006:;
+	t_subval_2e1003 = (u64)((u64)t_subval_2e1003 + (u64)((u64)4UL));
+	t__2e1005 = (u64)(u32)(*(u32 *)t_subval_2e1003);
+	t__2e1004 = (u64)(u32)(((u32)t__2e1005 == (u32)((u64)896429772UL)));
+	if ((u32)t__2e1004) goto L_subtype_2e1007; else goto L_next_2e1002;
+	L_subtype_2e1007:;
+	goto L_matches_2e989;
+	L_next_2e1002:;
+	goto L__2e986;
+	L_matches_2e987:;
+	*(u8 *)t_binding_2e871 = (u8)((u64)1UL);
+	goto L__2e1008;
+	L__2e1010:;
+	L__2e1008:;
+	goto L__2e985;
+	L_matches_2e988:;
+	t_abortsite_2e847 = ((u64)16UL);
+	goto L_abort_2e848;
+	L__2e1013:;
+	L__2e1011:;
+	L__2e1014:;
+	L_matches_2e989:;
+	t_abortsite_2e847 = ((u64)17UL);
+	goto L_abort_2e848;
+	L__2e1017:;
+	L__2e1015:;
+	L__2e1018:;
+	L__2e986:;
+	t_abortsite_2e847 = ((u64)18UL);
+	goto L_abort_2e863;
+	L__2e985:;
+	t__2e1021 = (u64)(u32)(*(u8 *)t_binding_2e871);
+	if ((u32)t__2e1021) goto L_passed_2e1020; else goto L_failed_2e1019;
+	L_failed_2e1019:;
+	t_abortsite_2e847 = ((u64)19UL);
+	goto L_abort_2e848;
+	L_passed_2e1020:;
+	*(u32 *)t_object_2e1022 = (u32)((u64)3065563438UL);
+	t__2e1023 = (u64)((u64)t_object_2e1022 + (u64)((u64)4UL));
+	*(u32 *)t__2e1023 = (u32)((u64)1804912991UL);
+	BLIT(t_binding_2e978, t_object_2e1022, ((u64)8UL));
+	*(u8 *)t_binding_2e871 = (u8)((u64)0UL);
+	t_tag_2e1025 = (u64)(*(u32 *)t_binding_2e978);
+	t__2e1034 = (u64)(u32)(((u32)t_tag_2e1025 == (u32)((u64)89824132UL)));
+	if ((u32)t__2e1034) goto L_member_2e1031; else goto L__2e1033;
+	L__2e1033:;
+	t__2e1036 = (u64)(u32)(((u32)t_tag_2e1025 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e1036) goto L_member_2e1032; else goto L__2e1035;
+	L__2e1035:;
+	goto L__2e1027;
+	L_member_2e1031:;
+	goto L_matches_2e1028;
+	L_member_2e1032:;
+	t_subval_2e1038 = t_binding_2e978;
+	t__2e1039 = (u64)(u32)(((u32)t_tag_2e1025 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e1039) goto L_subtype_2e1041; else goto L_next_2e1037;
+	L_subtype_2e1041:;
+	t_subval_2e1038 = (u64)((u64)t_subval_2e1038 + (u64)((u64)4UL));
+	t__2e1040 = (u64)(u32)(*(u32 *)t_subval_2e1038);
+	t__2e1039 = (u64)(u32)(((u32)t__2e1040 == (u32)((u64)1804912991UL)));
+	if ((u32)t__2e1039) goto L_subtype_2e1042; else goto L_next_2e1037;
+	L_subtype_2e1042:;
+	goto L_matches_2e1029;
+	L_next_2e1037:;
+	t_subval_2e1044 = t_binding_2e978;
+	t__2e1045 = (u64)(u32)(((u32)t_tag_2e1025 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e1045) goto L_subtype_2e1047; else goto L_next_2e1043;
+	L_subtype_2e1047:;
+	t_subval_2e1044 = (u64)((u64)t_subval_2e1044 + (u64)((u64)4UL));
+	t__2e1046 = (u64)(u32)(*(u32 *)t_subval_2e1044);
+	t__2e1045 = (u64)(u32)(((u32)t__2e1046 == (u32)((u64)896429772UL)));
+	if ((u32)t__2e1045) goto L_subtype_2e1048; else goto L_next_2e1043;
+	L_subtype_2e1048:;
+	goto L_matches_2e1030;
+	L_next_2e1043:;
+	goto L__2e1027;
+	L_matches_2e1028:;
+	t_abortsite_2e847 = ((u64)20UL);
+	goto L_abort_2e848;
+	L__2e1051:;
+	L__2e1049:;
+	L__2e1052:;
+	L_matches_2e1029:;
+	*(u8 *)t_binding_2e871 = (u8)((u64)1UL);
+	goto L__2e1053;
+	L__2e1055:;
+	L__2e1053:;
+	goto L__2e1026;
+	L_matches_2e1030:;
+	t_abortsite_2e847 = ((u64)21UL);
+	goto L_abort_2e848;
+	L__2e1058:;
+	L__2e1056:;
+	L__2e1059:;
+	L__2e1027:;
+	t_abortsite_2e847 = ((u64)22UL);
+	goto L_abort_2e863;
+	L__2e1026:;
+	t__2e1062 = (u64)(u32)(*(u8 *)t_binding_2e871);
+	if ((u32)t__2e1062) goto L_passed_2e1061; else goto L_failed_2e1060;
+	L_failed_2e1060:;
+	t_abortsite_2e847 = ((u64)23UL);
+	goto L_abort_2e848;
+	L_passed_2e1061:;
+	*(u32 *)t_binding_2e1063 = (u32)((u64)1236141228UL);
+	t__2e1067 = (u64)((u64)t_binding_2e1063 + (u64)((u64)4UL));
+	*(u32 *)t__2e1067 = (u32)((u64)10UL);
+	t_tag_2e1069 = (u64)(*(u32 *)t_binding_2e1063);
+	t__2e1077 = (u64)(u32)(((u32)t_tag_2e1069 == (u32)((u64)1236141228UL)));
+	if ((u32)t__2e1077) goto L_member_2e1074; else goto L__2e1076;
+	L__2e1076:;
+	t__2e1079 = (u64)(u32)(((u32)t_tag_2e1069 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1079) goto L_member_2e1075; else goto L__2e1078;
+	L__2e1078:;
+	goto L__2e1071;
+	L_member_2e1074:;
+	t_subval_2e1081 = t_binding_2e1063;
+	t__2e1082 = (u64)(u32)(((u32)t_tag_2e1069 == (u32)((u64)1236141228UL)));
+	if ((u32)t__2e1082) goto L_subtype_2e1084; else goto L_next_2e1080;
+	L_subtype_2e1084:;
+	goto L_matches_2e1072;
+	L_next_2e1080:;
+	goto L__2e1071;
+	L_member_2e1075:;
+	goto L_matches_2e1073;
+	L_matches_2e1072:;
+	goto L__2e1086;
+	L__2e1088:;
+	L__2e1086:;
+	goto L__2e1070;
+	L_matches_2e1073:;
+	t_abortsite_2e847 = ((u64)24UL);
+	goto L_abort_2e848;
+	L__2e1091:;
+	L__2e1089:;
+	L__2e1092:;
+	L__2e1071:;
+	t_abortsite_2e847 = ((u64)25UL);
+	goto L_abort_2e863;
+	L__2e1070:;
+	goto L__2e804;
+	L__2e1093:;
+	L__2e804:;
+	return;
+	L_abort_2e848:;
+	t__2e849 = (u64)((u64)t_abortsite_2e847 * (u64)((u64)16UL));
+	t__2e849 = (u64)((u64)((u64)((char *)&D_abortsites_2e846)) + (u64)t__2e849);
+	t__2e850 = (u64)(*(u64 *)t__2e849);
+	t__2e851 = (u64)((u64)t__2e849 + (u64)((u64)8UL));
+	t__2e852 = (u64)(*(u32 *)t__2e851);
+	t__2e851 = (u64)((u64)t__2e849 + (u64)((u64)12UL));
+	t__2e853 = (u64)(*(u32 *)t__2e851);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e850, (u64)t__2e852, (u64)t__2e853, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e863:;
+	t__2e864 = (u64)((u64)t_abortsite_2e847 * (u64)((u64)16UL));
+	t__2e864 = (u64)((u64)((u64)((char *)&D_abortsites_2e846)) + (u64)t__2e864);
+	t__2e865 = (u64)(*(u64 *)t__2e864);
+	t__2e866 = (u64)((u64)t__2e864 + (u64)((u64)8UL));
+	t__2e867 = (u64)(*(u32 *)t__2e866);
+	t__2e866 = (u64)((u64)t__2e864 + (u64)((u64)12UL));
+	t__2e868 = (u64)(*(u32 *)t__2e866);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e865, (u64)t__2e867, (u64)t__2e868, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_implicit__cast(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e1100;
+	u64 t__2e1103;
+	u64 t__2e1104;
+	u64 t__2e1107;
+	u64 t__2e1111;
+	u64 t__2e1115;
+	u64 t__2e1117;
+	u64 t__2e1118;
+	u64 t__2e1124;
+	u64 t__2e1125;
+	u64 t__2e1126;
+	u64 t__2e1127;
+	u64 t__2e1128;
+	u64 t__2e1131;
+	u64 t__2e1134;
+	u64 t__2e1138;
+	u64 t__2e1139;
+	u64 t__2e1140;
+	u64 t__2e1141;
+	u64 t__2e1142;
+	u64 t_abortsite_2e1122;
+	u64 t_binding_2e1098;
+	u64 t_binding_2e1099;
+	u64 t_binding_2e1101;
+	u64 t_binding_2e1114;
+	u64 t_subval_2e1133;
+	L_start_2e1094:;
+	t_binding_2e1098 = (u64)A0;
+	t_binding_2e1099 = (u64)A1;
+	t_binding_2e1101 = (u64)A2;
+	t_binding_2e1114 = (u64)A3;
+	L_body_2e1095:;
+	*(u32 *)t_binding_2e1098 = (u32)((u64)1804912991UL);
+	t__2e1100 = ((u64)0UL);
+	*(u64 *)t_binding_2e1099 = (u64)t__2e1100;
+	t__2e1103 = (u64)(*(u64 *)t_binding_2e1099);
+	t__2e1104 = (u64)(u32)(((u64)t__2e1103 == (u64)((u64)0UL)));
+	if ((u32)t__2e1104) goto L_matches_2e1105; else goto L_next_2e1106;
+	L_matches_2e1105:;
+	*(u32 *)t_binding_2e1101 = (u32)((u64)3065563438UL);
+	t__2e1107 = (u64)((u64)t_binding_2e1101 + (u64)((u64)4UL));
+	*(u32 *)t__2e1107 = (u32)((u64)1804912991UL);
+	goto L__2e1108;
+	L__2e1110:;
+	L__2e1108:;
+	goto L__2e1102;
+	L_next_2e1106:;
+	t__2e1111 = (u64)(u32)(((u64)t__2e1103 != (u64)((u64)0UL)));
+	if ((u32)t__2e1111) goto L_matches_2e1112; else goto L_next_2e1113;
+	L_matches_2e1112:;
+	*(u64 *)t_binding_2e1114 = (u64)t__2e1103;
+	*(u32 *)t_binding_2e1101 = (u32)((u64)1099590421UL);
+	t__2e1115 = (u64)((u64)t_binding_2e1101 + (u64)((u64)4UL));
+	t__2e1117 = (u64)(*(u64 *)t_binding_2e1114);
+	t__2e1118 = (u64)(u32)(*(i32 *)t__2e1117);
+	*(u32 *)t__2e1115 = (u32)t__2e1118;
+	goto L__2e1116;
+	L__2e1119:;
+	L__2e1116:;
+	goto L__2e1102;
+	L_next_2e1113:;
+	L__2e1120:;
+	t_abortsite_2e1122 = ((u64)0UL);
+	goto L_abort_2e1123;
+	L__2e1102:;
+	t__2e1131 = (u64)(u32)(*(u32 *)t_binding_2e1101);
+	t_subval_2e1133 = t_binding_2e1101;
+	t__2e1134 = (u64)(u32)(((u32)t__2e1131 == (u32)((u64)3065563438UL)));
+	if ((u32)t__2e1134) goto L_subtype_2e1136; else goto L_passed_2e1132;
+	L_subtype_2e1136:;
+	goto L_passed_2e1132;
+	L_passed_2e1132:;
+	if ((u32)t__2e1134) goto L_passed_2e1130; else goto L_failed_2e1129;
+	L_failed_2e1129:;
+	t_abortsite_2e1122 = ((u64)1UL);
+	goto L_abort_2e1137;
+	L_passed_2e1130:;
+	goto L__2e1096;
+	L__2e1143:;
+	L__2e1096:;
+	return;
+	L_abort_2e1123:;
+	t__2e1124 = (u64)((u64)t_abortsite_2e1122 * (u64)((u64)16UL));
+	t__2e1124 = (u64)((u64)((u64)((char *)&D_abortsites_2e1121)) + (u64)t__2e1124);
+	t__2e1125 = (u64)(*(u64 *)t__2e1124);
+	t__2e1126 = (u64)((u64)t__2e1124 + (u64)((u64)8UL));
+	t__2e1127 = (u64)(*(u32 *)t__2e1126);
+	t__2e1126 = (u64)((u64)t__2e1124 + (u64)((u64)12UL));
+	t__2e1128 = (u64)(*(u32 *)t__2e1126);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1125, (u64)t__2e1127, (u64)t__2e1128, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e1137:;
+	t__2e1138 = (u64)((u64)t_abortsite_2e1122 * (u64)((u64)16UL));
+	t__2e1138 = (u64)((u64)((u64)((char *)&D_abortsites_2e1121)) + (u64)t__2e1138);
+	t__2e1139 = (u64)(*(u64 *)t__2e1138);
+	t__2e1140 = (u64)((u64)t__2e1138 + (u64)((u64)8UL));
+	t__2e1141 = (u64)(*(u32 *)t__2e1140);
+	t__2e1140 = (u64)((u64)t__2e1138 + (u64)((u64)12UL));
+	t__2e1142 = (u64)(*(u32 *)t__2e1140);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1139, (u64)t__2e1141, (u64)t__2e1142, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_tagged__result(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[4] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	u64 t__2e1149;
+	u64 t__2e1159;
+	u64 t__2e1161;
+	u64 t__2e1163;
+	u64 t__2e1164;
+	u64 t__2e1165;
+	u64 t__2e1167;
+	u64 t__2e1175;
+	u64 t__2e1176;
+	u64 t__2e1177;
+	u64 t__2e1178;
+	u64 t__2e1179;
+	u64 t__2e1182;
+	u64 t__2e1185;
+	u64 t__2e1189;
+	u64 t__2e1190;
+	u64 t__2e1191;
+	u64 t__2e1192;
+	u64 t__2e1193;
+	u64 t__2e1195;
+	u64 t__2e1204;
+	u64 t__2e1206;
+	u64 t__2e1208;
+	u64 t__2e1209;
+	u64 t__2e1211;
+	u64 t__2e1213;
+	u64 t__2e1221;
+	u64 t__2e1224;
+	u64 t__2e1236;
+	u64 t__2e1238;
+	u64 t_abortsite_2e1173;
+	u64 t_binding_2e1148;
+	u64 t_binding_2e1150;
+	u64 t_binding_2e1162;
+	u64 t_binding_2e1207;
+	u64 t_object_2e1194;
+	u64 t_object_2e1210;
+	u64 t_object_2e1215;
+	u64 t_subval_2e1184;
+	u64 t_subval_2e1223;
+	u64 t_tag_2e1151;
+	u64 t_tag_2e1196;
+	u64 t_tag_2e1228;
+	L_start_2e1144:;
+	t_binding_2e1148 = (u64)A0;
+	t_binding_2e1150 = (u64)A1;
+	t_binding_2e1162 = (u64)A2;
+	t_object_2e1194 = (u64)A3;
+	t_binding_2e1207 = (u64)A4;
+	t_object_2e1210 = (u64)A5;
+	t_object_2e1215 = (u64)A6;
+	L_body_2e1145:;
+	*(u32 *)t_binding_2e1148 = (u32)((u64)1099590421UL);
+	t__2e1149 = (u64)((u64)t_binding_2e1148 + (u64)((u64)4UL));
+	*(u32 *)t__2e1149 = (u32)((u64)42UL);
+	t_tag_2e1151 = (u64)(*(u32 *)t_binding_2e1148);
+	t__2e1159 = (u64)(u32)(((u32)t_tag_2e1151 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1159) goto L_member_2e1156; else goto L__2e1158;
+	L__2e1158:;
+	t__2e1161 = (u64)(u32)(((u32)t_tag_2e1151 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1161) goto L_member_2e1157; else goto L__2e1160;
+	L__2e1160:;
+	goto L__2e1153;
+	L_member_2e1156:;
+	goto L_matches_2e1154;
+	L_member_2e1157:;
+	goto L_matches_2e1155;
+	L_matches_2e1154:;
+	t__2e1163 = (u64)((u64)t_binding_2e1148 + (u64)((u64)4UL));
+	t__2e1164 = (u64)(u32)(*(i32 *)t__2e1163);
+	*(u32 *)t_binding_2e1162 = (u32)t__2e1164;
+	*(u32 *)t_binding_2e1150 = (u32)((u64)1099590421UL);
+	t__2e1165 = (u64)((u64)t_binding_2e1150 + (u64)((u64)4UL));
+	t__2e1167 = (u64)(u32)(*(i32 *)t_binding_2e1162);
+	*(u32 *)t__2e1165 = (u32)t__2e1167;
+	goto L__2e1166;
+	L__2e1168:;
+	L__2e1166:;
+	goto L__2e1152;
+	L_matches_2e1155:;
+	*(u32 *)t_binding_2e1150 = (u32)((u64)3012680272UL);
+	goto L__2e1169;
+	L__2e1171:;
+	L__2e1169:;
+	goto L__2e1152;
+	L__2e1153:;
+	t_abortsite_2e1173 = ((u64)0UL);
+	goto L_abort_2e1174;
+	L__2e1152:;
+	t__2e1182 = (u64)(u32)(*(u32 *)t_binding_2e1150);
+	t_subval_2e1184 = t_binding_2e1150;
+	t__2e1185 = (u64)(u32)(((u32)t__2e1182 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1185) goto L_subtype_2e1187; else goto L_passed_2e1183;
+	L_subtype_2e1187:;
+	goto L_passed_2e1183;
+	L_passed_2e1183:;
+	if ((u32)t__2e1185) goto L_passed_2e1181; else goto L_failed_2e1180;
+	L_failed_2e1180:;
+	t_abortsite_2e1173 = ((u64)1UL);
+	goto L_abort_2e1188;
+	L_passed_2e1181:;
+	*(u32 *)t_object_2e1194 = (u32)((u64)3012680272UL);
+	BLIT(t_binding_2e1148, t_object_2e1194, ((u64)8UL));
+	t_tag_2e1196 = (u64)(*(u32 *)t_binding_2e1148);
+	t__2e1204 = (u64)(u32)(((u32)t_tag_2e1196 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1204) goto L_member_2e1201; else goto L__2e1203;
+	L__2e1203:;
+	t__2e1206 = (u64)(u32)(((u32)t_tag_2e1196 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1206) goto L_member_2e1202; else goto L__2e1205;
+	L__2e1205:;
+	goto L__2e1198;
+	L_member_2e1201:;
+	goto L_matches_2e1199;
+	L_member_2e1202:;
+	goto L_matches_2e1200;
+	L_matches_2e1199:;
+	t__2e1208 = (u64)((u64)t_binding_2e1148 + (u64)((u64)4UL));
+	t__2e1209 = (u64)(u32)(*(i32 *)t__2e1208);
+	*(u32 *)t_binding_2e1207 = (u32)t__2e1209;
+	*(u32 *)t_object_2e1210 = (u32)((u64)1099590421UL);
+	t__2e1211 = (u64)((u64)t_object_2e1210 + (u64)((u64)4UL));
+	t__2e1213 = (u64)(u32)(*(i32 *)t_binding_2e1207);
+	*(u32 *)t__2e1211 = (u32)t__2e1213;
+	goto L__2e1212;
+	L__2e1214:;
+	L__2e1212:;
+	t__2e1195 = t_object_2e1210;
+	goto L__2e1197;
+	L_matches_2e1200:;
+	*(u32 *)t_object_2e1215 = (u32)((u64)3012680272UL);
+	goto L__2e1216;
+	L__2e1218:;
+	L__2e1216:;
+	t__2e1195 = t_object_2e1215;
+	goto L__2e1197;
+	L__2e1198:;
+	t_abortsite_2e1173 = ((u64)2UL);
+	goto L_abort_2e1174;
+	L__2e1197:;
+	BLIT(t_binding_2e1150, t__2e1195, ((u64)8UL));
+	t__2e1221 = (u64)(u32)(*(u32 *)t_binding_2e1150);
+	t_subval_2e1223 = t_binding_2e1150;
+	t__2e1224 = (u64)(u32)(((u32)t__2e1221 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1224) goto L_subtype_2e1226; else goto L_passed_2e1222;
+	L_subtype_2e1226:;
+	goto L_passed_2e1222;
+	L_passed_2e1222:;
+	if ((u32)t__2e1224) goto L_passed_2e1220; else goto L_failed_2e1219;
+	L_failed_2e1219:;
+	t_abortsite_2e1173 = ((u64)3UL);
+	goto L_abort_2e1188;
+	L_passed_2e1220:;
+	t_tag_2e1228 = (u64)(*(u32 *)t_binding_2e1148);
+	t__2e1236 = (u64)(u32)(((u32)t_tag_2e1228 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1236) goto L_member_2e1233; else goto L__2e1235;
+	L__2e1235:;
+	t__2e1238 = (u64)(u32)(((u32)t_tag_2e1228 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1238) goto L_member_2e1234; else goto L__2e1237;
+	L__2e1237:;
+	goto L_matches_2e1232;
+	L_member_2e1233:;
+	goto L_matches_2e1231;
+	L_member_2e1234:;
+	goto L_matches_2e1232;
+	L_matches_2e1231:;
+	t_abortsite_2e1173 = ((u64)4UL);
+	goto L_abort_2e1188;
+	L__2e1241:;
+	L__2e1239:;
+	L__2e1242:;
+	L_matches_2e1232:;
+	goto L__2e1243;
+	L__2e1245:;
+	L__2e1243:;
+	goto L__2e1229;
+	L__2e1230:;
+	t_abortsite_2e1173 = ((u64)5UL);
+	goto L_abort_2e1174;
+	L__2e1229:;
+	goto L__2e1146;
+	L__2e1246:;
+	L__2e1146:;
+	return;
+	L_abort_2e1174:;
+	t__2e1175 = (u64)((u64)t_abortsite_2e1173 * (u64)((u64)16UL));
+	t__2e1175 = (u64)((u64)((u64)((char *)&D_abortsites_2e1172)) + (u64)t__2e1175);
+	t__2e1176 = (u64)(*(u64 *)t__2e1175);
+	t__2e1177 = (u64)((u64)t__2e1175 + (u64)((u64)8UL));
+	t__2e1178 = (u64)(*(u32 *)t__2e1177);
+	t__2e1177 = (u64)((u64)t__2e1175 + (u64)((u64)12UL));
+	t__2e1179 = (u64)(*(u32 *)t__2e1177);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1176, (u64)t__2e1178, (u64)t__2e1179, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e1188:;
+	t__2e1189 = (u64)((u64)t_abortsite_2e1173 * (u64)((u64)16UL));
+	t__2e1189 = (u64)((u64)((u64)((char *)&D_abortsites_2e1172)) + (u64)t__2e1189);
+	t__2e1190 = (u64)(*(u64 *)t__2e1189);
+	t__2e1191 = (u64)((u64)t__2e1189 + (u64)((u64)8UL));
+	t__2e1192 = (u64)(*(u32 *)t__2e1191);
+	t__2e1191 = (u64)((u64)t__2e1189 + (u64)((u64)12UL));
+	t__2e1193 = (u64)(*(u32 *)t__2e1191);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1190, (u64)t__2e1192, (u64)t__2e1193, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_alias(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[4] __attribute__((aligned(16)));
+	u64 t__2e1255;
+	u64 t__2e1265;
+	u64 t__2e1266;
+	u64 t__2e1268;
+	u64 t__2e1269;
+	u64 t__2e1270;
+	u64 t__2e1274;
+	u64 t__2e1275;
+	u64 t__2e1276;
+	u64 t__2e1277;
+	u64 t__2e1278;
+	u64 t__2e1287;
+	u64 t__2e1289;
+	u64 t__2e1297;
+	u64 t__2e1298;
+	u64 t__2e1299;
+	u64 t__2e1300;
+	u64 t__2e1301;
+	u64 t__2e1304;
+	u64 t__2e1305;
+	u64 t__2e1306;
+	u64 t__2e1307;
+	u64 t__2e1308;
+	u64 t__2e1312;
+	u64 t__2e1313;
+	u64 t__2e1314;
+	u64 t__2e1315;
+	u64 t__2e1316;
+	u64 t__2e1317;
+	u64 t__2e1319;
+	u64 t__2e1320;
+	u64 t__2e1321;
+	u64 t__2e1322;
+	u64 t__2e1323;
+	u64 t__2e1325;
+	u64 t_abortsite_2e1295;
+	u64 t_binding_2e1251;
+	u64 t_binding_2e1256;
+	u64 t_binding_2e1264;
+	u64 t_binding_2e1273;
+	u64 t_item_2e1254;
+	u64 t_item_2e1258;
+	u64 t_object_2e1252;
+	u64 t_tag_2e1279;
+	L_start_2e1247:;
+	t_binding_2e1251 = (u64)A0;
+	t_object_2e1252 = (u64)A1;
+	t_binding_2e1256 = (u64)A2;
+	t_binding_2e1264 = (u64)A3;
+	t_binding_2e1273 = (u64)A4;
+	L_body_2e1248:;
+	t_item_2e1254 = (u64)((u64)t_object_2e1252 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1254 = (u32)((u64)1804912991UL);
+	t_item_2e1254 = (u64)((u64)t_object_2e1252 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1254 = (u32)((u64)896429772UL);
+	*(u64 *)t_binding_2e1251 = (u64)t_object_2e1252;
+	t__2e1255 = (u64)((u64)t_binding_2e1251 + (u64)((u64)8UL));
+	*(u64 *)t__2e1255 = (u64)((u64)2UL);
+	t__2e1255 = (u64)((u64)t__2e1255 + (u64)((u64)8UL));
+	*(u64 *)t__2e1255 = (u64)((u64)2UL);
+	t_item_2e1258 = (u64)((u64)t_binding_2e1256 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1258 = (u32)((u64)42UL);
+	t_item_2e1258 = (u64)((u64)t_binding_2e1256 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1258 = (u32)((u64)24UL);
+	*(u64 *)t_binding_2e1264 = (u64)((u64)0UL);
+	L_loop_2e1259:;
+	t__2e1266 = (u64)(*(u64 *)t_binding_2e1264);
+	t__2e1268 = (u64)((u64)t_binding_2e1251 + (u64)((u64)8UL));
+	t__2e1269 = (u64)((u64)t_binding_2e1251 + (u64)((u64)16UL));
+	t__2e1270 = (u64)(*(u64 *)t__2e1268);
+	t__2e1265 = (u64)(u32)(((u64)t__2e1266 < (u64)t__2e1270));
+	if ((u32)t__2e1265) goto L_body_2e1260; else goto L__2e1262;
+	L_body_2e1260:;
+	t__2e1275 = (u64)((u64)t_binding_2e1251 + (u64)((u64)8UL));
+	t__2e1276 = (u64)((u64)t_binding_2e1251 + (u64)((u64)16UL));
+	t__2e1277 = (u64)(*(u64 *)t_binding_2e1251);
+	t__2e1278 = (u64)(*(u64 *)t_binding_2e1264);
+	t__2e1274 = (u64)((u64)t__2e1278 * (u64)((u64)4UL));
+	t__2e1274 = (u64)((u64)t__2e1277 + (u64)t__2e1274);
+	t_tag_2e1279 = (u64)(*(u32 *)t__2e1274);
+	t__2e1287 = (u64)(u32)(((u32)t_tag_2e1279 == (u32)((u64)896429772UL)));
+	if ((u32)t__2e1287) goto L_member_2e1284; else goto L__2e1286;
+	L__2e1286:;
+	t__2e1289 = (u64)(u32)(((u32)t_tag_2e1279 == (u32)((u64)1804912991UL)));
+	if ((u32)t__2e1289) goto L_member_2e1285; else goto L__2e1288;
+	L__2e1288:;
+	goto L__2e1281;
+	L_member_2e1284:;
+	goto L_matches_2e1283;
+	L_member_2e1285:;
+	goto L_matches_2e1282;
+	L_matches_2e1282:;
+	*(u32 *)t_binding_2e1273 = (u32)((u64)42UL);
+	goto L__2e1290;
+	L__2e1291:;
+	L__2e1290:;
+	goto L__2e1280;
+	L_matches_2e1283:;
+	*(u32 *)t_binding_2e1273 = (u32)((u64)24UL);
+	goto L__2e1292;
+	L__2e1293:;
+	L__2e1292:;
+	goto L__2e1280;
+	L__2e1281:;
+	t_abortsite_2e1295 = ((u64)0UL);
+	goto L_abort_2e1296;
+	L__2e1280:;
+	t__2e1305 = (u64)(u32)(*(i32 *)t_binding_2e1273);
+	t__2e1307 = (u64)(*(u64 *)t_binding_2e1264);
+	t__2e1306 = (u64)((u64)t__2e1307 * (u64)((u64)4UL));
+	t__2e1306 = (u64)((u64)t_binding_2e1256 + (u64)t__2e1306);
+	t__2e1308 = (u64)(u32)(((u64)t__2e1307 < (u64)((u64)2UL)));
+	if ((u32)t__2e1308) goto L__2e1310; else goto L__2e1309;
+	L__2e1309:;
+	t_abortsite_2e1295 = ((u64)1UL);
+	goto L_abort_2e1311;
+	L__2e1310:;
+	t__2e1317 = (u64)(u32)(*(i32 *)t__2e1306);
+	t__2e1304 = (u64)(u32)(((u32)t__2e1305 == (u32)t__2e1317));
+	if ((u32)t__2e1304) goto L_passed_2e1303; else goto L_failed_2e1302;
+	L_failed_2e1302:;
+	t_abortsite_2e1295 = ((u64)2UL);
+	goto L_abort_2e1318;
+	L_passed_2e1303:;
+	goto L__2e1271;
+	L__2e1324:;
+	L__2e1271:;
+	L_after_2e1263:;
+	t__2e1325 = (u64)(*(u64 *)t_binding_2e1264);
+	t__2e1325 = (u64)((u64)t__2e1325 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1264 = (u64)t__2e1325;
+	goto L_loop_2e1259;
+	L__2e1262:;
+	goto L__2e1249;
+	L__2e1326:;
+	L__2e1249:;
+	return;
+	L_abort_2e1296:;
+	t__2e1297 = (u64)((u64)t_abortsite_2e1295 * (u64)((u64)16UL));
+	t__2e1297 = (u64)((u64)((u64)((char *)&D_abortsites_2e1294)) + (u64)t__2e1297);
+	t__2e1298 = (u64)(*(u64 *)t__2e1297);
+	t__2e1299 = (u64)((u64)t__2e1297 + (u64)((u64)8UL));
+	t__2e1300 = (u64)(*(u32 *)t__2e1299);
+	t__2e1299 = (u64)((u64)t__2e1297 + (u64)((u64)12UL));
+	t__2e1301 = (u64)(*(u32 *)t__2e1299);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1298, (u64)t__2e1300, (u64)t__2e1301, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e1311:;
+	t__2e1312 = (u64)((u64)t_abortsite_2e1295 * (u64)((u64)16UL));
+	t__2e1312 = (u64)((u64)((u64)((char *)&D_abortsites_2e1294)) + (u64)t__2e1312);
+	t__2e1313 = (u64)(*(u64 *)t__2e1312);
+	t__2e1314 = (u64)((u64)t__2e1312 + (u64)((u64)8UL));
+	t__2e1315 = (u64)(*(u32 *)t__2e1314);
+	t__2e1314 = (u64)((u64)t__2e1312 + (u64)((u64)12UL));
+	t__2e1316 = (u64)(*(u32 *)t__2e1314);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1313, (u64)t__2e1315, (u64)t__2e1316, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e1318:;
+	t__2e1319 = (u64)((u64)t_abortsite_2e1295 * (u64)((u64)16UL));
+	t__2e1319 = (u64)((u64)((u64)((char *)&D_abortsites_2e1294)) + (u64)t__2e1319);
+	t__2e1320 = (u64)(*(u64 *)t__2e1319);
+	t__2e1321 = (u64)((u64)t__2e1319 + (u64)((u64)8UL));
+	t__2e1322 = (u64)(*(u32 *)t__2e1321);
+	t__2e1321 = (u64)((u64)t__2e1319 + (u64)((u64)12UL));
+	t__2e1323 = (u64)(*(u32 *)t__2e1321);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1320, (u64)t__2e1322, (u64)t__2e1323, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_pointer(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e1335;
+	u64 t__2e1336;
+	u64 t__2e1341;
+	u64 t__2e1342;
+	u64 t__2e1344;
+	u64 t__2e1351;
+	u64 t__2e1352;
+	u64 t__2e1353;
+	u64 t__2e1354;
+	u64 t__2e1355;
+	u64 t__2e1359;
+	u64 t__2e1360;
+	u64 t__2e1361;
+	u64 t__2e1362;
+	u64 t__2e1363;
+	u64 t__2e1366;
+	u64 t__2e1367;
+	u64 t__2e1368;
+	u64 t__2e1369;
+	u64 t__2e1371;
+	u64 t__2e1372;
+	u64 t__2e1379;
+	u64 t__2e1383;
+	u64 t__2e1388;
+	u64 t__2e1389;
+	u64 t_abortsite_2e1349;
+	u64 t_binding_2e1331;
+	u64 t_binding_2e1332;
+	u64 t_binding_2e1333;
+	u64 t_binding_2e1339;
+	L_start_2e1327:;
+	t_binding_2e1331 = (u64)A0;
+	t_binding_2e1332 = (u64)A1;
+	t_binding_2e1333 = (u64)A2;
+	t_binding_2e1339 = (u64)A3;
+	L_body_2e1328:;
+	*(u32 *)t_binding_2e1331 = (u32)((u64)42UL);
+	*(u64 *)t_binding_2e1332 = (u64)t_binding_2e1331;
+	t__2e1335 = (u64)(*(u64 *)t_binding_2e1332);
+	t__2e1336 = (u64)(u32)(((u64)t__2e1335 != (u64)((u64)0UL)));
+	if ((u32)t__2e1336) goto L_matches_2e1337; else goto L_next_2e1338;
+	L_matches_2e1337:;
+	*(u64 *)t_binding_2e1339 = (u64)t__2e1335;
+	t__2e1341 = (u64)(*(u64 *)t_binding_2e1339);
+	t__2e1342 = (u64)(u32)(*(i32 *)t__2e1341);
+	*(u32 *)t_binding_2e1333 = (u32)t__2e1342;
+	goto L__2e1340;
+	L__2e1343:;
+	L__2e1340:;
+	goto L__2e1334;
+	L_next_2e1338:;
+	t__2e1344 = (u64)(u32)(((u64)t__2e1335 == (u64)((u64)0UL)));
+	if ((u32)t__2e1344) goto L_matches_2e1345; else goto L_next_2e1346;
+	L_matches_2e1345:;
+	t_abortsite_2e1349 = ((u64)0UL);
+	goto L_abort_2e1350;
+	L__2e1356:;
+	L__2e1347:;
+	L_next_2e1346:;
+	L__2e1357:;
+	t_abortsite_2e1349 = ((u64)1UL);
+	goto L_abort_2e1358;
+	L__2e1334:;
+	t__2e1367 = (u64)(u32)(*(i32 *)t_binding_2e1333);
+	t__2e1366 = (u64)(u32)(((u32)t__2e1367 == (u32)((u64)42UL)));
+	if ((u32)t__2e1366) goto L_passed_2e1365; else goto L_failed_2e1364;
+	L_failed_2e1364:;
+	t_abortsite_2e1349 = ((u64)2UL);
+	goto L_abort_2e1350;
+	L_passed_2e1365:;
+	t__2e1368 = ((u64)0UL);
+	*(u64 *)t_binding_2e1332 = (u64)t__2e1368;
+	t__2e1371 = (u64)(*(u64 *)t_binding_2e1332);
+	t__2e1372 = (u64)(u32)(((u64)t__2e1371 != (u64)((u64)0UL)));
+	if ((u32)t__2e1372) goto L_matches_2e1373; else goto L_next_2e1374;
+	L_matches_2e1373:;
+	t_abortsite_2e1349 = ((u64)3UL);
+	goto L_abort_2e1350;
+	L__2e1377:;
+	L__2e1375:;
+	L__2e1378:;
+	L_next_2e1374:;
+	t__2e1379 = (u64)(u32)(((u64)t__2e1371 == (u64)((u64)0UL)));
+	if ((u32)t__2e1379) goto L_matches_2e1380; else goto L_next_2e1381;
+	L_matches_2e1380:;
+	t__2e1383 = (u64)(u32)((u64)1337UL);
+	goto L__2e1382;
+	L__2e1384:;
+	L__2e1382:;
+	t__2e1369 = (u64)(u32)t__2e1383;
+	goto L__2e1370;
+	L_next_2e1381:;
+	L__2e1385:;
+	t_abortsite_2e1349 = ((u64)4UL);
+	goto L_abort_2e1358;
+	L__2e1370:;
+	*(u32 *)t_binding_2e1333 = (u32)t__2e1369;
+	t__2e1389 = (u64)(u32)(*(i32 *)t_binding_2e1333);
+	t__2e1388 = (u64)(u32)(((u32)t__2e1389 == (u32)((u64)1337UL)));
+	if ((u32)t__2e1388) goto L_passed_2e1387; else goto L_failed_2e1386;
+	L_failed_2e1386:;
+	t_abortsite_2e1349 = ((u64)5UL);
+	goto L_abort_2e1350;
+	L_passed_2e1387:;
+	goto L__2e1329;
+	L__2e1390:;
+	L__2e1329:;
+	return;
+	L_abort_2e1350:;
+	t__2e1351 = (u64)((u64)t_abortsite_2e1349 * (u64)((u64)16UL));
+	t__2e1351 = (u64)((u64)((u64)((char *)&D_abortsites_2e1348)) + (u64)t__2e1351);
+	t__2e1352 = (u64)(*(u64 *)t__2e1351);
+	t__2e1353 = (u64)((u64)t__2e1351 + (u64)((u64)8UL));
+	t__2e1354 = (u64)(*(u32 *)t__2e1353);
+	t__2e1353 = (u64)((u64)t__2e1351 + (u64)((u64)12UL));
+	t__2e1355 = (u64)(*(u32 *)t__2e1353);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1352, (u64)t__2e1354, (u64)t__2e1355, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1358:;
+	t__2e1359 = (u64)((u64)t_abortsite_2e1349 * (u64)((u64)16UL));
+	t__2e1359 = (u64)((u64)((u64)((char *)&D_abortsites_2e1348)) + (u64)t__2e1359);
+	t__2e1360 = (u64)(*(u64 *)t__2e1359);
+	t__2e1361 = (u64)((u64)t__2e1359 + (u64)((u64)8UL));
+	t__2e1362 = (u64)(*(u32 *)t__2e1361);
+	t__2e1361 = (u64)((u64)t__2e1359 + (u64)((u64)12UL));
+	t__2e1363 = (u64)(*(u32 *)t__2e1361);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1360, (u64)t__2e1362, (u64)t__2e1363, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F___default(void) {
+	char A0[32] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e1401;
+	u64 t__2e1412;
+	u64 t__2e1414;
+	u64 t__2e1416;
+	u64 t__2e1424;
+	u64 t__2e1425;
+	u64 t__2e1426;
+	u64 t__2e1427;
+	u64 t__2e1428;
+	u64 t__2e1431;
+	u64 t__2e1432;
+	u64 t__2e1434;
+	u64 t__2e1435;
+	u64 t__2e1436;
+	u64 t__2e1437;
+	u64 t__2e1438;
+	u64 t_abortsite_2e1422;
+	u64 t_binding_2e1395;
+	u64 t_binding_2e1402;
+	u64 t_tag_2e1403;
+	L_start_2e1391:;
+	t_binding_2e1395 = (u64)A0;
+	t_binding_2e1402 = (u64)A1;
+	L_body_2e1392:;
+	*(u32 *)t_binding_2e1395 = (u32)((u64)2543892678UL);
+	t__2e1401 = (u64)((u64)t_binding_2e1395 + (u64)((u64)4UL));
+	*(u32 *)t__2e1401 = (u32)((u64)1337UL);
+	t_tag_2e1403 = (u64)(*(u32 *)t_binding_2e1395);
+	t__2e1412 = (u64)(u32)(((u32)t_tag_2e1403 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1412) goto L_member_2e1408; else goto L__2e1411;
+	L__2e1411:;
+	t__2e1414 = (u64)(u32)(((u32)t_tag_2e1403 == (u32)((u64)2543892678UL)));
+	if ((u32)t__2e1414) goto L_member_2e1409; else goto L__2e1413;
+	L__2e1413:;
+	t__2e1416 = (u64)(u32)(((u32)t_tag_2e1403 == (u32)((u64)4119164483UL)));
+	if ((u32)t__2e1416) goto L_member_2e1410; else goto L__2e1415;
+	L__2e1415:;
+	goto L_matches_2e1407;
+	L_member_2e1408:;
+	goto L_matches_2e1406;
+	L_member_2e1409:;
+	goto L_matches_2e1407;
+	L_member_2e1410:;
+	goto L_matches_2e1407;
+	L_matches_2e1406:;
+	*(u32 *)t_binding_2e1402 = (u32)((u64)42UL);
+	goto L__2e1417;
+	L__2e1418:;
+	L__2e1417:;
+	goto L__2e1404;
+	L_matches_2e1407:;
+	*(u32 *)t_binding_2e1402 = (u32)((u64)24UL);
+	goto L__2e1419;
+	L__2e1420:;
+	L__2e1419:;
+	goto L__2e1404;
+	L__2e1405:;
+	t_abortsite_2e1422 = ((u64)0UL);
+	goto L_abort_2e1423;
+	L__2e1404:;
+	t__2e1432 = (u64)(u32)(*(i32 *)t_binding_2e1402);
+	t__2e1431 = (u64)(u32)(((u32)t__2e1432 == (u32)((u64)24UL)));
+	if ((u32)t__2e1431) goto L_passed_2e1430; else goto L_failed_2e1429;
+	L_failed_2e1429:;
+	t_abortsite_2e1422 = ((u64)1UL);
+	goto L_abort_2e1433;
+	L_passed_2e1430:;
+	goto L__2e1393;
+	L__2e1439:;
+	L__2e1393:;
+	return;
+	L_abort_2e1423:;
+	t__2e1424 = (u64)((u64)t_abortsite_2e1422 * (u64)((u64)16UL));
+	t__2e1424 = (u64)((u64)((u64)((char *)&D_abortsites_2e1421)) + (u64)t__2e1424);
+	t__2e1425 = (u64)(*(u64 *)t__2e1424);
+	t__2e1426 = (u64)((u64)t__2e1424 + (u64)((u64)8UL));
+	t__2e1427 = (u64)(*(u32 *)t__2e1426);
+	t__2e1426 = (u64)((u64)t__2e1424 + (u64)((u64)12UL));
+	t__2e1428 = (u64)(*(u32 *)t__2e1426);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1425, (u64)t__2e1427, (u64)t__2e1428, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e1433:;
+	t__2e1434 = (u64)((u64)t_abortsite_2e1422 * (u64)((u64)16UL));
+	t__2e1434 = (u64)((u64)((u64)((char *)&D_abortsites_2e1421)) + (u64)t__2e1434);
+	t__2e1435 = (u64)(*(u64 *)t__2e1434);
+	t__2e1436 = (u64)((u64)t__2e1434 + (u64)((u64)8UL));
+	t__2e1437 = (u64)(*(u32 *)t__2e1436);
+	t__2e1436 = (u64)((u64)t__2e1434 + (u64)((u64)12UL));
+	t__2e1438 = (u64)(*(u32 *)t__2e1436);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1435, (u64)t__2e1437, (u64)t__2e1438, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F___never(void) {
+	char A0[32] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[32] __attribute__((aligned(16)));
+	u64 t__2e1445;
+	u64 t__2e1464;
+	u64 t__2e1466;
+	u64 t__2e1468;
+	u64 t__2e1475;
+	u64 t__2e1476;
+	u64 t__2e1477;
+	u64 t__2e1478;
+	u64 t__2e1479;
+	u64 t__2e1484;
+	u64 t__2e1485;
+	u64 t__2e1486;
+	u64 t__2e1487;
+	u64 t__2e1488;
+	u64 t__2e1491;
+	u64 t__2e1492;
+	u64 t__2e1494;
+	u64 t_abortsite_2e1473;
+	u64 t_binding_2e1444;
+	u64 t_binding_2e1453;
+	u64 t_object_2e1493;
+	u64 t_tag_2e1454;
+	L_start_2e1440:;
+	t_binding_2e1444 = (u64)A0;
+	t_binding_2e1453 = (u64)A1;
+	t_object_2e1493 = (u64)A2;
+	L_body_2e1441:;
+	*(u32 *)t_binding_2e1444 = (u32)((u64)1099590421UL);
+	t__2e1445 = (u64)((u64)t_binding_2e1444 + (u64)((u64)4UL));
+	*(u32 *)t__2e1445 = (u32)((u64)1337UL);
+	L_loop_2e1446:;
+	if ((u32)((u64)1UL)) goto L_body_2e1447; else goto L__2e1449;
+	L_body_2e1447:;
+	t_tag_2e1454 = (u64)(*(u32 *)t_binding_2e1444);
+	t__2e1464 = (u64)(u32)(((u32)t_tag_2e1454 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1464) goto L_member_2e1460; else goto L__2e1463;
+	L__2e1463:;
+	t__2e1466 = (u64)(u32)(((u32)t_tag_2e1454 == (u32)((u64)2543892678UL)));
+	if ((u32)t__2e1466) goto L_member_2e1461; else goto L__2e1465;
+	L__2e1465:;
+	t__2e1468 = (u64)(u32)(((u32)t_tag_2e1454 == (u32)((u64)4119164483UL)));
+	if ((u32)t__2e1468) goto L_member_2e1462; else goto L__2e1467;
+	L__2e1467:;
+	goto L__2e1456;
+	L_member_2e1460:;
+	goto L_matches_2e1457;
+	L_member_2e1461:;
+	goto L_matches_2e1458;
+	L_member_2e1462:;
+	goto L_matches_2e1459;
+	L_matches_2e1457:;
+	*(u32 *)t_binding_2e1453 = (u32)((u64)42UL);
+	goto L__2e1469;
+	L__2e1470:;
+	L__2e1469:;
+	goto L__2e1455;
+	L_matches_2e1458:;
+	t_abortsite_2e1473 = ((u64)0UL);
+	goto L_abort_2e1474;
+	L__2e1480:;
+	L__2e1471:;
+	L_matches_2e1459:;
+	goto L__2e1449;
+	L__2e1482:;
+	L__2e1481:;
+	L__2e1456:;
+	t_abortsite_2e1473 = ((u64)1UL);
+	goto L_abort_2e1483;
+	L__2e1455:;
+	t__2e1492 = (u64)(u32)(*(i32 *)t_binding_2e1453);
+	t__2e1491 = (u64)(u32)(((u32)t__2e1492 == (u32)((u64)42UL)));
+	if ((u32)t__2e1491) goto L_passed_2e1490; else goto L_failed_2e1489;
+	L_failed_2e1489:;
+	t_abortsite_2e1473 = ((u64)2UL);
+	goto L_abort_2e1474;
+	L_passed_2e1490:;
+	*(u32 *)t_object_2e1493 = (u32)((u64)4119164483UL);
+	t__2e1494 = (u64)((u64)t_object_2e1493 + (u64)((u64)8UL));
+	BLIT(t__2e1494, ((u64)((char *)&D_strliteral_2e1496)), ((u64)24UL));
+	BLIT(t_binding_2e1444, t_object_2e1493, ((u64)32UL));
+	goto L__2e1451;
+	L__2e1497:;
+	L__2e1451:;
+	L_after_2e1450:;
+	goto L_loop_2e1446;
+	L__2e1449:;
+	goto L__2e1442;
+	L__2e1498:;
+	L__2e1442:;
+	return;
+	L_abort_2e1474:;
+	t__2e1475 = (u64)((u64)t_abortsite_2e1473 * (u64)((u64)16UL));
+	t__2e1475 = (u64)((u64)((u64)((char *)&D_abortsites_2e1472)) + (u64)t__2e1475);
+	t__2e1476 = (u64)(*(u64 *)t__2e1475);
+	t__2e1477 = (u64)((u64)t__2e1475 + (u64)((u64)8UL));
+	t__2e1478 = (u64)(*(u32 *)t__2e1477);
+	t__2e1477 = (u64)((u64)t__2e1475 + (u64)((u64)12UL));
+	t__2e1479 = (u64)(*(u32 *)t__2e1477);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1476, (u64)t__2e1478, (u64)t__2e1479, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1483:;
+	t__2e1484 = (u64)((u64)t_abortsite_2e1473 * (u64)((u64)16UL));
+	t__2e1484 = (u64)((u64)((u64)((char *)&D_abortsites_2e1472)) + (u64)t__2e1484);
+	t__2e1485 = (u64)(*(u64 *)t__2e1484);
+	t__2e1486 = (u64)((u64)t__2e1484 + (u64)((u64)8UL));
+	t__2e1487 = (u64)(*(u32 *)t__2e1486);
+	t__2e1486 = (u64)((u64)t__2e1484 + (u64)((u64)12UL));
+	t__2e1488 = (u64)(*(u32 *)t__2e1486);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1485, (u64)t__2e1487, (u64)t__2e1488, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_tagged(void) {
+	char A0[96] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	u64 t__2e1506;
+	u64 t__2e1507;
+	u64 t__2e1508;
+	u64 t__2e1518;
+	u64 t__2e1519;
+	u64 t__2e1523;
+	u64 t__2e1524;
+	u64 t__2e1535;
+	u64 t__2e1537;
+	u64 t__2e1539;
+	u64 t__2e1545;
+	u64 t__2e1547;
+	u64 t__2e1548;
+	u64 t__2e1549;
+	u64 t__2e1554;
+	u64 t__2e1555;
+	u64 t__2e1556;
+	u64 t__2e1557;
+	u64 t__2e1558;
+	u64 t__2e1561;
+	u64 t__2e1562;
+	u64 t__2e1563;
+	u64 t__2e1564;
+	u64 t__2e1565;
+	u64 t__2e1567;
+	u64 t__2e1568;
+	u64 t__2e1569;
+	u64 t__2e1570;
+	u64 t__2e1571;
+	u64 t__2e1573;
+	u64 t_abortsite_2e1552;
+	u64 t_binding_2e1503;
+	u64 t_binding_2e1509;
+	u64 t_binding_2e1517;
+	u64 t_binding_2e1522;
+	u64 t_binding_2e1544;
+	u64 t_item_2e1505;
+	u64 t_item_2e1511;
+	u64 t_tag_2e1525;
+	L_start_2e1499:;
+	t_binding_2e1503 = (u64)A0;
+	t_binding_2e1509 = (u64)A1;
+	t_binding_2e1517 = (u64)A2;
+	t_binding_2e1522 = (u64)A3;
+	t_binding_2e1544 = (u64)A4;
+	L_body_2e1500:;
+	t_item_2e1505 = (u64)((u64)t_binding_2e1503 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1505 = (u32)((u64)1099590421UL);
+	t__2e1506 = (u64)((u64)t_item_2e1505 + (u64)((u64)4UL));
+	*(u32 *)t__2e1506 = (u32)((u64)10UL);
+	t_item_2e1505 = (u64)((u64)t_binding_2e1503 + (u64)((u64)32UL));
+	*(u32 *)t_item_2e1505 = (u32)((u64)2543892678UL);
+	t__2e1507 = (u64)((u64)t_item_2e1505 + (u64)((u64)4UL));
+	*(u32 *)t__2e1507 = (u32)((u64)10UL);
+	t_item_2e1505 = (u64)((u64)t_binding_2e1503 + (u64)((u64)64UL));
+	*(u32 *)t_item_2e1505 = (u32)((u64)4119164483UL);
+	t__2e1508 = (u64)((u64)t_item_2e1505 + (u64)((u64)8UL));
+	BLIT(t__2e1508, ((u64)((char *)&D_strliteral_2e75)), ((u64)24UL));
+	t_item_2e1511 = (u64)((u64)t_binding_2e1509 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e1511 = (u64)((u64)1UL);
+	t_item_2e1511 = (u64)((u64)t_binding_2e1509 + (u64)((u64)8UL));
+	*(u64 *)t_item_2e1511 = (u64)((u64)2UL);
+	t_item_2e1511 = (u64)((u64)t_binding_2e1509 + (u64)((u64)16UL));
+	*(u64 *)t_item_2e1511 = (u64)((u64)5UL);
+	*(u64 *)t_binding_2e1517 = (u64)((u64)0UL);
+	L_loop_2e1512:;
+	t__2e1519 = (u64)(*(u64 *)t_binding_2e1517);
+	t__2e1518 = (u64)(u32)(((u64)t__2e1519 < (u64)((u64)3UL)));
+	if ((u32)t__2e1518) goto L_body_2e1513; else goto L__2e1515;
+	L_body_2e1513:;
+	t__2e1524 = (u64)(*(u64 *)t_binding_2e1517);
+	t__2e1523 = (u64)((u64)t__2e1524 * (u64)((u64)32UL));
+	t__2e1523 = (u64)((u64)t_binding_2e1503 + (u64)t__2e1523);
+	t_tag_2e1525 = (u64)(*(u32 *)t__2e1523);
+	t__2e1535 = (u64)(u32)(((u32)t_tag_2e1525 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1535) goto L_member_2e1531; else goto L__2e1534;
+	L__2e1534:;
+	t__2e1537 = (u64)(u32)(((u32)t_tag_2e1525 == (u32)((u64)2543892678UL)));
+	if ((u32)t__2e1537) goto L_member_2e1532; else goto L__2e1536;
+	L__2e1536:;
+	t__2e1539 = (u64)(u32)(((u32)t_tag_2e1525 == (u32)((u64)4119164483UL)));
+	if ((u32)t__2e1539) goto L_member_2e1533; else goto L__2e1538;
+	L__2e1538:;
+	goto L__2e1527;
+	L_member_2e1531:;
+	goto L_matches_2e1528;
+	L_member_2e1532:;
+	goto L_matches_2e1529;
+	L_member_2e1533:;
+	goto L_matches_2e1530;
+	L_matches_2e1528:;
+	*(u64 *)t_binding_2e1522 = (u64)((u64)1UL);
+	goto L__2e1540;
+	L__2e1541:;
+	L__2e1540:;
+	goto L__2e1526;
+	L_matches_2e1529:;
+	*(u64 *)t_binding_2e1522 = (u64)((u64)2UL);
+	goto L__2e1542;
+	L__2e1543:;
+	L__2e1542:;
+	goto L__2e1526;
+	L_matches_2e1530:;
+	t__2e1545 = (u64)((u64)t__2e1523 + (u64)((u64)8UL));
+	BLIT(t_binding_2e1544, t__2e1545, ((u64)24UL));
+	t__2e1547 = (u64)((u64)t_binding_2e1544 + (u64)((u64)8UL));
+	t__2e1548 = (u64)((u64)t_binding_2e1544 + (u64)((u64)16UL));
+	t__2e1549 = (u64)(*(u64 *)t__2e1547);
+	*(u64 *)t_binding_2e1522 = (u64)t__2e1549;
+	goto L__2e1546;
+	L__2e1550:;
+	L__2e1546:;
+	goto L__2e1526;
+	L__2e1527:;
+	t_abortsite_2e1552 = ((u64)0UL);
+	goto L_abort_2e1553;
+	L__2e1526:;
+	t__2e1562 = (u64)(*(u64 *)t_binding_2e1522);
+	t__2e1564 = (u64)(*(u64 *)t_binding_2e1517);
+	t__2e1563 = (u64)((u64)t__2e1564 * (u64)((u64)8UL));
+	t__2e1563 = (u64)((u64)t_binding_2e1509 + (u64)t__2e1563);
+	t__2e1565 = (u64)(*(u64 *)t__2e1563);
+	t__2e1561 = (u64)(u32)(((u64)t__2e1562 == (u64)t__2e1565));
+	if ((u32)t__2e1561) goto L_passed_2e1560; else goto L_failed_2e1559;
+	L_failed_2e1559:;
+	t_abortsite_2e1552 = ((u64)1UL);
+	goto L_abort_2e1566;
+	L_passed_2e1560:;
+	goto L__2e1520;
+	L__2e1572:;
+	L__2e1520:;
+	L_after_2e1516:;
+	t__2e1573 = (u64)(*(u64 *)t_binding_2e1517);
+	t__2e1573 = (u64)((u64)t__2e1573 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e1517 = (u64)t__2e1573;
+	goto L_loop_2e1512;
+	L__2e1515:;
+	goto L__2e1501;
+	L__2e1574:;
+	L__2e1501:;
+	return;
+	L_abort_2e1553:;
+	t__2e1554 = (u64)((u64)t_abortsite_2e1552 * (u64)((u64)16UL));
+	t__2e1554 = (u64)((u64)((u64)((char *)&D_abortsites_2e1551)) + (u64)t__2e1554);
+	t__2e1555 = (u64)(*(u64 *)t__2e1554);
+	t__2e1556 = (u64)((u64)t__2e1554 + (u64)((u64)8UL));
+	t__2e1557 = (u64)(*(u32 *)t__2e1556);
+	t__2e1556 = (u64)((u64)t__2e1554 + (u64)((u64)12UL));
+	t__2e1558 = (u64)(*(u32 *)t__2e1556);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1555, (u64)t__2e1557, (u64)t__2e1558, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e1566:;
+	t__2e1567 = (u64)((u64)t_abortsite_2e1552 * (u64)((u64)16UL));
+	t__2e1567 = (u64)((u64)((u64)((char *)&D_abortsites_2e1551)) + (u64)t__2e1567);
+	t__2e1568 = (u64)(*(u64 *)t__2e1567);
+	t__2e1569 = (u64)((u64)t__2e1567 + (u64)((u64)8UL));
+	t__2e1570 = (u64)(*(u32 *)t__2e1569);
+	t__2e1569 = (u64)((u64)t__2e1567 + (u64)((u64)12UL));
+	t__2e1571 = (u64)(*(u32 *)t__2e1569);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1568, (u64)t__2e1570, (u64)t__2e1571, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,2658 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2eensure[] __asm__("rt.ensure");
+extern char X_rt_2efree[] __asm__("rt.free");
+extern char X_rt_2emalloc[] __asm__("rt.malloc");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+extern char X_rt_2ememmove[] __asm__("rt.memmove");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e37 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_strdata_2e129 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[16]; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18[13]; u8 f19; u8 f20; u8 f21; u8 f22[2]; u8 f23; u8 f24; };
+struct __attribute__((packed)) S_strliteral_2e130 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e165 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[13]; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18[16]; u8 f19; u8 f20; u8 f21; u8 f22[2]; u8 f23; u8 f24; };
+struct __attribute__((packed)) S_strliteral_2e166 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e185 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[20]; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18[16]; u8 f19; u8 f20; u8 f21; u8 f22[2]; u8 f23; u8 f24; };
+struct __attribute__((packed)) S_strliteral_2e186 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e205 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[23]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e206 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e225 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[24]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e226 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e245 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[19]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e246 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e265 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[27]; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18[14]; u8 f19; u8 f20; u8 f21; u8 f22[2]; u8 f23; u8 f24; };
+struct __attribute__((packed)) S_strliteral_2e266 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e285 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[17]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[24]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e286 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e305 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[17]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[25]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e306 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e325 { u8 f0; u8 f1; u8 f2; u8 f3[14]; u8 f4; u8 f5; u8 f6; u8 f7[18]; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12[27]; u8 f13; u8 f14; u8 f15; u8 f16; u8 f17[13]; u8 f18; u8 f19; u8 f20; u8 f21[2]; u8 f22; u8 f23; };
+struct __attribute__((packed)) S_strliteral_2e326 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e146 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; };
+struct __attribute__((packed)) S_abortsites_2e397 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e448 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; };
+struct __attribute__((packed)) S_abortsites_2e628 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e683 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; };
+struct __attribute__((packed)) S_abortsites_2e858 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_abortsites_2e1012 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e37 D_abortsites_2e37 __asm__("abortsites.37") __attribute__((used, section(".data.rel.ro.abortsites.37"), aligned(8)));
+static const struct S_strdata_2e129 D_strdata_2e129 __asm__("strdata.129") __attribute__((used, section(".rodata.strdata.129"), aligned(8)));
+static struct S_strliteral_2e130 D_strliteral_2e130 __asm__("strliteral.130") __attribute__((used, section(".data.rel.ro.strliteral.130"), aligned(8)));
+static const struct S_strdata_2e165 D_strdata_2e165 __asm__("strdata.165") __attribute__((used, section(".rodata.strdata.165"), aligned(8)));
+static struct S_strliteral_2e166 D_strliteral_2e166 __asm__("strliteral.166") __attribute__((used, section(".data.rel.ro.strliteral.166"), aligned(8)));
+static const struct S_strdata_2e185 D_strdata_2e185 __asm__("strdata.185") __attribute__((used, section(".rodata.strdata.185"), aligned(8)));
+static struct S_strliteral_2e186 D_strliteral_2e186 __asm__("strliteral.186") __attribute__((used, section(".data.rel.ro.strliteral.186"), aligned(8)));
+static const struct S_strdata_2e205 D_strdata_2e205 __asm__("strdata.205") __attribute__((used, section(".rodata.strdata.205"), aligned(8)));
+static struct S_strliteral_2e206 D_strliteral_2e206 __asm__("strliteral.206") __attribute__((used, section(".data.rel.ro.strliteral.206"), aligned(8)));
+static const struct S_strdata_2e225 D_strdata_2e225 __asm__("strdata.225") __attribute__((used, section(".rodata.strdata.225"), aligned(8)));
+static struct S_strliteral_2e226 D_strliteral_2e226 __asm__("strliteral.226") __attribute__((used, section(".data.rel.ro.strliteral.226"), aligned(8)));
+static const struct S_strdata_2e245 D_strdata_2e245 __asm__("strdata.245") __attribute__((used, section(".rodata.strdata.245"), aligned(8)));
+static struct S_strliteral_2e246 D_strliteral_2e246 __asm__("strliteral.246") __attribute__((used, section(".data.rel.ro.strliteral.246"), aligned(8)));
+static const struct S_strdata_2e265 D_strdata_2e265 __asm__("strdata.265") __attribute__((used, section(".rodata.strdata.265"), aligned(8)));
+static struct S_strliteral_2e266 D_strliteral_2e266 __asm__("strliteral.266") __attribute__((used, section(".data.rel.ro.strliteral.266"), aligned(8)));
+static const struct S_strdata_2e285 D_strdata_2e285 __asm__("strdata.285") __attribute__((used, section(".rodata.strdata.285"), aligned(8)));
+static struct S_strliteral_2e286 D_strliteral_2e286 __asm__("strliteral.286") __attribute__((used, section(".data.rel.ro.strliteral.286"), aligned(8)));
+static const struct S_strdata_2e305 D_strdata_2e305 __asm__("strdata.305") __attribute__((used, section(".rodata.strdata.305"), aligned(8)));
+static struct S_strliteral_2e306 D_strliteral_2e306 __asm__("strliteral.306") __attribute__((used, section(".data.rel.ro.strliteral.306"), aligned(8)));
+static const struct S_strdata_2e325 D_strdata_2e325 __asm__("strdata.325") __attribute__((used, section(".rodata.strdata.325"), aligned(8)));
+static struct S_strliteral_2e326 D_strliteral_2e326 __asm__("strliteral.326") __attribute__((used, section(".data.rel.ro.strliteral.326"), aligned(8)));
+static struct S_abortsites_2e146 D_abortsites_2e146 __asm__("abortsites.146") __attribute__((used, section(".data.rel.ro.abortsites.146"), aligned(8)));
+static struct S_abortsites_2e397 D_abortsites_2e397 __asm__("abortsites.397") __attribute__((used, section(".data.rel.ro.abortsites.397"), aligned(8)));
+static struct S_abortsites_2e448 D_abortsites_2e448 __asm__("abortsites.448") __attribute__((used, section(".data.rel.ro.abortsites.448"), aligned(8)));
+static struct S_abortsites_2e628 D_abortsites_2e628 __asm__("abortsites.628") __attribute__((used, section(".data.rel.ro.abortsites.628"), aligned(8)));
+static struct S_abortsites_2e683 D_abortsites_2e683 __asm__("abortsites.683") __attribute__((used, section(".data.rel.ro.abortsites.683"), aligned(8)));
+static struct S_abortsites_2e858 D_abortsites_2e858 __asm__("abortsites.858") __attribute__((used, section(".data.rel.ro.abortsites.858"), aligned(8)));
+static struct S_abortsites_2e1012 D_abortsites_2e1012 __asm__("abortsites.1012") __attribute__((used, section(".data.rel.ro.abortsites.1012"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F___never(void) __asm__("_never") __attribute__((used, section(".text._never")));
+static void F_reallocated(void) __asm__("reallocated") __attribute__((used, section(".text.reallocated")));
+static u32 F_shrink(u64 p_x) __asm__("shrink") __attribute__((used, section(".text.shrink")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_typehints(void) __asm__("typehints") __attribute__((used, section(".text.typehints")));
+static void F_capacity(void) __asm__("capacity") __attribute__((used, section(".text.capacity")));
+static void F_withlength(void) __asm__("withlength") __attribute__((used, section(".text.withlength")));
+static void F___static(void) __asm__("_static") __attribute__((used, section(".text._static")));
+static void F_multi(void) __asm__("multi") __attribute__((used, section(".text.multi")));
+static void F_basics(void) __asm__("basics") __attribute__((used, section(".text.basics")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\061\071\055\141\160\160\145\156\144\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 18U, 18U };
+static struct S_abortsites_2e37 D_abortsites_2e37 = { (char *)((char *)&D_strliteral_2e1) + 0, 172U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 172U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 174U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 174U, 15U };
+static const struct S_strdata_2e129 D_strdata_2e129 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\154\145\164\040\171\072\040\151\156\164\040\075\040\064\062\073", 10U, 9U, 9U, 9U, "\141\160\160\145\156\144\050\170\054\040\171\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e130 D_strliteral_2e130 = { (char *)((char *)&D_strdata_2e129) + 0, 89U, 89U };
+static const struct S_strdata_2e165 D_strdata_2e165 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\154\145\164\040\171\040\075\040\064\062\165\070\073", 10U, 9U, 9U, 9U, "\141\160\160\145\156\144\050\170\054\040\171\056\056\056\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e166 D_strliteral_2e166 = { (char *)((char *)&D_strdata_2e165) + 0, 89U, 89U };
+static const struct S_strdata_2e185 D_strdata_2e185 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\154\145\164\040\171\072\040\133\135\151\156\164\040\075\040\133\064\062\135\073", 10U, 9U, 9U, 9U, "\141\160\160\145\156\144\050\170\054\040\171\056\056\056\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e186 D_strliteral_2e186 = { (char *)((char *)&D_strdata_2e185) + 0, 96U, 96U };
+static const struct S_strdata_2e205 D_strdata_2e205 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\141\160\160\145\156\144\050\170\054\040\133\064\062\151\056\056\056\135\054\040\065\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e206 D_strliteral_2e206 = { (char *)((char *)&D_strdata_2e205) + 0, 79U, 79U };
+static const struct S_strdata_2e225 D_strdata_2e225 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\141\160\160\145\156\144\050\170\054\040\133\060\165\070\056\056\056\135\054\040\062\151\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e226 D_strliteral_2e226 = { (char *)((char *)&D_strdata_2e225) + 0, 80U, 80U };
+static const struct S_strdata_2e245 D_strdata_2e245 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\141\160\160\145\156\144\050\170\054\040\133\064\062\135\054\040\063\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e246 D_strliteral_2e246 = { (char *)((char *)&D_strdata_2e245) + 0, 75U, 75U };
+static const struct S_strdata_2e265 D_strdata_2e265 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\156\165\154\154\141\142\154\145\040\052\133\135\165\070\040\075\040\046\170\073", 10U, 9U, 9U, 9U, "\141\160\160\145\156\144\050\170\054\040\064\062\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e266 D_strliteral_2e266 = { (char *)((char *)&D_strdata_2e265) + 0, 101U, 101U };
+static const struct S_strdata_2e285 D_strdata_2e285 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\135\073", 10U, 9U, 9U, 9U, "\141\160\160\145\156\144\050\170\054\040\133\060\056\056\056\135\056\056\056\054\040\063\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e286 D_strliteral_2e286 = { (char *)((char *)&D_strdata_2e285) + 0, 77U, 77U };
+static const struct S_strdata_2e305 D_strdata_2e305 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\135\073", 10U, 9U, 9U, 9U, "\141\160\160\145\156\144\050\170\054\040\133\061\135\072\040\133\052\135\165\070\056\056\056\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e306 D_strliteral_2e306 = { (char *)((char *)&D_strdata_2e305) + 0, 78U, 78U };
+static const struct S_strdata_2e325 D_strdata_2e325 = { 10U, 9U, 9U, "\154\145\164\040\171\072\040\157\160\141\161\165\145\073", 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\040\075\040\133\135\072\040\133\135\165\070\072\040\133\135\157\160\141\161\165\145\073", 10U, 9U, 9U, 9U, "\141\160\160\145\156\144\050\170\054\040\171\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e326 D_strliteral_2e326 = { (char *)((char *)&D_strdata_2e325) + 0, 93U, 93U };
+static struct S_abortsites_2e146 D_abortsites_2e146 = { (char *)((char *)&D_strliteral_2e1) + 0, 103U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 103U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 117U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 117U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 123U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 123U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 129U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 129U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 135U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 135U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 142U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 142U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 154U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 154U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 161U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 161U, 12U };
+static struct S_abortsites_2e397 D_abortsites_2e397 = { (char *)((char *)&D_strliteral_2e1) + 0, 89U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 91U, 25U, (char *)((char *)&D_strliteral_2e1) + 0, 91U, 23U };
+static struct S_abortsites_2e448 D_abortsites_2e448 = { (char *)((char *)&D_strliteral_2e1) + 0, 68U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 68U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 70U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 73U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 18U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 77U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 23U };
+static struct S_abortsites_2e628 D_abortsites_2e628 = { (char *)((char *)&D_strliteral_2e1) + 0, 59U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 61U, 23U };
+static struct S_abortsites_2e683 D_abortsites_2e683 = { (char *)((char *)&D_strliteral_2e1) + 0, 36U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 37U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 38U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 40U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 42U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 43U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 46U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 50U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 15U };
+static struct S_abortsites_2e858 D_abortsites_2e858 = { (char *)((char *)&D_strliteral_2e1) + 0, 16U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 20U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 23U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 30U, 15U };
+static struct S_abortsites_2e1012 D_abortsites_2e1012 = { (char *)((char *)&D_strliteral_2e1) + 0, 8U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 43U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_basics)))();
+	((void (*)(void))((u64)((char *)&F_multi)))();
+	((void (*)(void))((u64)((char *)&F___static)))();
+	((void (*)(void))((u64)((char *)&F_withlength)))();
+	((void (*)(void))((u64)((char *)&F_capacity)))();
+	((void (*)(void))((u64)((char *)&F_typehints)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	((void (*)(void))((u64)((char *)&F_reallocated)))();
+	((void (*)(void))((u64)((char *)&F___never)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F___never(void) {
+	char A0[24] __attribute__((aligned(16)));
+	u64 t__2e12;
+	u64 t__2e16;
+	u64 t__2e17;
+	u64 t__2e18;
+	u64 t__2e23;
+	u64 t__2e24;
+	u64 t__2e25;
+	u64 t_binding_2e11;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	L_body_2e8:;
+	*(u64 *)t_binding_2e11 = (u64)((u64)0UL);
+	t__2e12 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	*(u64 *)t__2e12 = (u64)((u64)0UL);
+	t__2e12 = (u64)((u64)t__2e12 + (u64)((u64)8UL));
+	*(u64 *)t__2e12 = (u64)((u64)0UL);
+	t__2e16 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e17 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e18 = (u64)(*(u64 *)t__2e16);
+	goto L__2e13;
+	L__2e19:;
+	goto L__2e13;
+	L__2e20:;
+	L__2e13:;
+	t__2e23 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e24 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e25 = (u64)(*(u64 *)t__2e23);
+	goto L__2e21;
+	L__2e26:;
+	goto L__2e21;
+	L__2e27:;
+	L__2e21:;
+	goto L__2e9;
+	L__2e28:;
+	L__2e9:;
+	return;
+}
+static void F_reallocated(void) {
+	char A0[24] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e101;
+	u64 t__2e102;
+	u64 t__2e103;
+	u64 t__2e34;
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e44;
+	u64 t__2e45;
+	u64 t__2e48;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e54;
+	u64 t__2e55;
+	u64 t__2e56;
+	u64 t__2e59;
+	u64 t__2e60;
+	u64 t__2e61;
+	u64 t__2e62;
+	u64 t__2e63;
+	u64 t__2e64;
+	u64 t__2e65;
+	u64 t__2e68;
+	u64 t__2e69;
+	u64 t__2e70;
+	u64 t__2e73;
+	u64 t__2e76;
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e80;
+	u64 t__2e81;
+	u64 t__2e82;
+	u64 t__2e83;
+	u64 t__2e84;
+	u64 t__2e85;
+	u64 t__2e86;
+	u64 t__2e87;
+	u64 t__2e91;
+	u64 t__2e92;
+	u64 t__2e93;
+	u64 t__2e94;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e98;
+	u64 t__2e99;
+	u64 t_abortsite_2e38;
+	u64 t_binding_2e33;
+	u64 t_item_2e58;
+	L_start_2e29:;
+	t_binding_2e33 = (u64)A0;
+	L_body_2e30:;
+	t__2e34 = (u64)(u32)(((u64)((u64)3UL) <= (u64)((u64)8UL)));
+	if ((u32)t__2e34) goto L__2e35; else goto L__2e36;
+	L__2e36:;
+	t_abortsite_2e38 = ((u64)0UL);
+	goto L_abort_2e39;
+	L__2e35:;
+	t__2e45 = (u64)((u64)((u64)8UL) * (u64)((u64)4UL));
+	t__2e48 = ((u64)0UL);
+	t__2e34 = (u64)(u32)(((u64)t__2e45 != (u64)((u64)0UL)));
+	if ((u32)t__2e34) goto L__2e47; else goto L__2e46;
+	L__2e47:;
+	t__2e48 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)t__2e45));
+	t__2e34 = (u64)(u32)(((u64)t__2e48 != (u64)((u64)0UL)));
+	if ((u32)t__2e34) goto L__2e46; else goto L__2e49;
+	L__2e49:;
+	t_abortsite_2e38 = ((u64)1UL);
+	goto L_abort_2e50;
+	L__2e46:;
+	*(u64 *)t_binding_2e33 = (u64)t__2e48;
+	t__2e56 = (u64)((u64)t_binding_2e33 + (u64)((u64)8UL));
+	*(u64 *)t__2e56 = (u64)((u64)3UL);
+	t__2e56 = (u64)((u64)t_binding_2e33 + (u64)((u64)16UL));
+	*(u64 *)t__2e56 = (u64)((u64)8UL);
+	t_item_2e58 = (u64)((u64)t__2e48 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e58 = (u32)((u64)1UL);
+	t_item_2e58 = (u64)((u64)t__2e48 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e58 = (u32)((u64)2UL);
+	t_item_2e58 = (u64)((u64)t__2e48 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e58 = (u32)((u64)3UL);
+	t__2e59 = (u64)((u64)t_binding_2e33 + (u64)((u64)8UL));
+	t__2e60 = (u64)((u64)t_binding_2e33 + (u64)((u64)16UL));
+	t__2e61 = (u64)(*(u64 *)t__2e59);
+	t__2e62 = (u64)(u32)(((u32 (*)(u64))((u64)((char *)&F_shrink)))((u64)t_binding_2e33));
+	t__2e63 = (u64)((u64)t__2e61 + (u64)((u64)1UL));
+	*(u64 *)t__2e59 = (u64)t__2e63;
+	t__2e65 = (u64)(*(u64 *)t__2e60);
+	t__2e68 = (u64)(u32)(((u64)t__2e63 <= (u64)t__2e65));
+	if ((u32)t__2e68) goto L__2e66; else goto L__2e67;
+	L__2e67:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e33, (u64)((u64)4UL));
+	goto L__2e66;
+	L__2e66:;
+	t__2e69 = (u64)(*(u64 *)t_binding_2e33);
+	t__2e64 = (u64)((u64)t__2e61 * (u64)((u64)4UL));
+	t__2e64 = (u64)((u64)t__2e69 + (u64)t__2e64);
+	t__2e70 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e64 = (u32)t__2e62;
+	t__2e77 = (u64)((u64)t_binding_2e33 + (u64)((u64)8UL));
+	t__2e78 = (u64)((u64)t_binding_2e33 + (u64)((u64)16UL));
+	t__2e79 = (u64)(*(u64 *)t__2e77);
+	t__2e76 = (u64)(u32)(((u64)t__2e79 == (u64)((u64)4UL)));
+	t__2e73 = (u64)(u32)t__2e76;
+	if ((u32)t__2e73) goto L__2e74; else goto L__2e75;
+	L__2e74:;
+	t__2e82 = (u64)((u64)t_binding_2e33 + (u64)((u64)8UL));
+	t__2e83 = (u64)((u64)t_binding_2e33 + (u64)((u64)16UL));
+	t__2e84 = (u64)(*(u64 *)t_binding_2e33);
+	t__2e85 = (u64)(*(u64 *)t__2e82);
+	t__2e86 = (u64)((i64)(i32)((u64)3UL));
+	t__2e81 = (u64)((u64)t__2e86 * (u64)((u64)4UL));
+	t__2e81 = (u64)((u64)t__2e84 + (u64)t__2e81);
+	t__2e87 = (u64)(u32)(((u64)t__2e86 < (u64)t__2e85));
+	if ((u32)t__2e87) goto L__2e89; else goto L__2e88;
+	L__2e88:;
+	t_abortsite_2e38 = ((u64)2UL);
+	goto L_abort_2e90;
+	L__2e89:;
+	t__2e96 = (u64)(u32)(*(i32 *)t__2e81);
+	t__2e80 = (u64)(u32)(((u32)t__2e96 == (u32)((u64)42UL)));
+	t__2e73 = (u64)(u32)t__2e80;
+	goto L__2e75;
+	L__2e75:;
+	if ((u32)t__2e73) goto L_passed_2e72; else goto L_failed_2e71;
+	L_failed_2e71:;
+	t_abortsite_2e38 = ((u64)3UL);
+	goto L_abort_2e97;
+	L_passed_2e72:;
+	t__2e103 = (u64)(*(u64 *)t_binding_2e33);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e103);
+	goto L__2e31;
+	L__2e104:;
+	L__2e31:;
+	return;
+	L_abort_2e39:;
+	t__2e40 = (u64)((u64)t_abortsite_2e38 * (u64)((u64)16UL));
+	t__2e40 = (u64)((u64)((u64)((char *)&D_abortsites_2e37)) + (u64)t__2e40);
+	t__2e41 = (u64)(*(u64 *)t__2e40);
+	t__2e42 = (u64)((u64)t__2e40 + (u64)((u64)8UL));
+	t__2e43 = (u64)(*(u32 *)t__2e42);
+	t__2e42 = (u64)((u64)t__2e40 + (u64)((u64)12UL));
+	t__2e44 = (u64)(*(u32 *)t__2e42);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e41, (u64)t__2e43, (u64)t__2e44, (u64)((u64)5UL));
+	__builtin_trap();
+	L_abort_2e50:;
+	t__2e51 = (u64)((u64)t_abortsite_2e38 * (u64)((u64)16UL));
+	t__2e51 = (u64)((u64)((u64)((char *)&D_abortsites_2e37)) + (u64)t__2e51);
+	t__2e52 = (u64)(*(u64 *)t__2e51);
+	t__2e53 = (u64)((u64)t__2e51 + (u64)((u64)8UL));
+	t__2e54 = (u64)(*(u32 *)t__2e53);
+	t__2e53 = (u64)((u64)t__2e51 + (u64)((u64)12UL));
+	t__2e55 = (u64)(*(u32 *)t__2e53);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e52, (u64)t__2e54, (u64)t__2e55, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e90:;
+	t__2e91 = (u64)((u64)t_abortsite_2e38 * (u64)((u64)16UL));
+	t__2e91 = (u64)((u64)((u64)((char *)&D_abortsites_2e37)) + (u64)t__2e91);
+	t__2e92 = (u64)(*(u64 *)t__2e91);
+	t__2e93 = (u64)((u64)t__2e91 + (u64)((u64)8UL));
+	t__2e94 = (u64)(*(u32 *)t__2e93);
+	t__2e93 = (u64)((u64)t__2e91 + (u64)((u64)12UL));
+	t__2e95 = (u64)(*(u32 *)t__2e93);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e92, (u64)t__2e94, (u64)t__2e95, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e97:;
+	t__2e98 = (u64)((u64)t_abortsite_2e38 * (u64)((u64)16UL));
+	t__2e98 = (u64)((u64)((u64)((char *)&D_abortsites_2e37)) + (u64)t__2e98);
+	t__2e99 = (u64)(*(u64 *)t__2e98);
+	t__2e100 = (u64)((u64)t__2e98 + (u64)((u64)8UL));
+	t__2e101 = (u64)(*(u32 *)t__2e100);
+	t__2e100 = (u64)((u64)t__2e98 + (u64)((u64)12UL));
+	t__2e102 = (u64)(*(u32 *)t__2e100);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e99, (u64)t__2e101, (u64)t__2e102, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_shrink(u64 p_x) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	u64 t__2e110;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e114;
+	u64 t_object_2e113;
+	u64 t_param_2e106;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e105:;
+	t_param_2e106 = (u64)A0;
+	t_object_2e113 = (u64)A1;
+	*(u64 *)t_param_2e106 = (u64)t_x;
+	L_body_2e107:;
+	t__2e110 = (u64)(*(u64 *)t_param_2e106);
+	t__2e111 = (u64)(*(u64 *)t__2e110);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e111);
+	t__2e112 = (u64)(*(u64 *)t_param_2e106);
+	*(u64 *)t_object_2e113 = (u64)((u64)0UL);
+	t__2e114 = (u64)((u64)t_object_2e113 + (u64)((u64)8UL));
+	*(u64 *)t__2e114 = (u64)((u64)0UL);
+	t__2e114 = (u64)((u64)t__2e114 + (u64)((u64)8UL));
+	*(u64 *)t__2e114 = (u64)((u64)0UL);
+	BLIT(t__2e112, t_object_2e113, ((u64)24UL));
+	return (u32)((u64)42UL);
+	L__2e115:;
+	L__2e108:;
+	L__2e116:;
+	return 0;
+}
+static void F_reject(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char B20[8] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char R23[4] __attribute__((aligned(16)));
+	char B24[8] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char R27[4] __attribute__((aligned(16)));
+	char B28[8] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char R31[4] __attribute__((aligned(16)));
+	char B32[8] __attribute__((aligned(16)));
+	char B33[24] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char R35[4] __attribute__((aligned(16)));
+	char B36[8] __attribute__((aligned(16)));
+	char B37[24] __attribute__((aligned(16)));
+	char B38[24] __attribute__((aligned(16)));
+	char R39[4] __attribute__((aligned(16)));
+	char B40[8] __attribute__((aligned(16)));
+	char B41[24] __attribute__((aligned(16)));
+	char B42[24] __attribute__((aligned(16)));
+	char R43[4] __attribute__((aligned(16)));
+	char B44[8] __attribute__((aligned(16)));
+	char B45[24] __attribute__((aligned(16)));
+	char B46[24] __attribute__((aligned(16)));
+	char R47[4] __attribute__((aligned(16)));
+	char B48[8] __attribute__((aligned(16)));
+	char B49[24] __attribute__((aligned(16)));
+	char B50[24] __attribute__((aligned(16)));
+	char R51[4] __attribute__((aligned(16)));
+	char B52[8] __attribute__((aligned(16)));
+	char B53[24] __attribute__((aligned(16)));
+	char B54[24] __attribute__((aligned(16)));
+	char R55[4] __attribute__((aligned(16)));
+	char B56[8] __attribute__((aligned(16)));
+	char B57[24] __attribute__((aligned(16)));
+	char B58[24] __attribute__((aligned(16)));
+	char R59[4] __attribute__((aligned(16)));
+	u64 t__2e122;
+	u64 t__2e128;
+	u64 t__2e134;
+	u64 t__2e143;
+	u64 t__2e145;
+	u64 t__2e149;
+	u64 t__2e150;
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e159;
+	u64 t__2e160;
+	u64 t__2e162;
+	u64 t__2e164;
+	u64 t__2e168;
+	u64 t__2e177;
+	u64 t__2e179;
+	u64 t__2e182;
+	u64 t__2e184;
+	u64 t__2e188;
+	u64 t__2e197;
+	u64 t__2e199;
+	u64 t__2e202;
+	u64 t__2e204;
+	u64 t__2e208;
+	u64 t__2e217;
+	u64 t__2e219;
+	u64 t__2e222;
+	u64 t__2e224;
+	u64 t__2e228;
+	u64 t__2e237;
+	u64 t__2e239;
+	u64 t__2e242;
+	u64 t__2e244;
+	u64 t__2e248;
+	u64 t__2e257;
+	u64 t__2e259;
+	u64 t__2e262;
+	u64 t__2e264;
+	u64 t__2e268;
+	u64 t__2e277;
+	u64 t__2e279;
+	u64 t__2e282;
+	u64 t__2e284;
+	u64 t__2e288;
+	u64 t__2e297;
+	u64 t__2e299;
+	u64 t__2e302;
+	u64 t__2e304;
+	u64 t__2e308;
+	u64 t__2e317;
+	u64 t__2e319;
+	u64 t__2e322;
+	u64 t__2e324;
+	u64 t__2e328;
+	u64 t__2e337;
+	u64 t__2e339;
+	u64 t_abortsite_2e147;
+	u64 t_object_2e124;
+	u64 t_object_2e132;
+	u64 t_object_2e163;
+	u64 t_object_2e167;
+	u64 t_object_2e183;
+	u64 t_object_2e187;
+	u64 t_object_2e203;
+	u64 t_object_2e207;
+	u64 t_object_2e223;
+	u64 t_object_2e227;
+	u64 t_object_2e243;
+	u64 t_object_2e247;
+	u64 t_object_2e263;
+	u64 t_object_2e267;
+	u64 t_object_2e283;
+	u64 t_object_2e287;
+	u64 t_object_2e303;
+	u64 t_object_2e307;
+	u64 t_object_2e323;
+	u64 t_object_2e327;
+	u64 t_tag_2e135;
+	u64 t_tag_2e169;
+	u64 t_tag_2e189;
+	u64 t_tag_2e209;
+	u64 t_tag_2e229;
+	u64 t_tag_2e249;
+	u64 t_tag_2e269;
+	u64 t_tag_2e289;
+	u64 t_tag_2e309;
+	u64 t_tag_2e329;
+	L_start_2e117:;
+	t_object_2e124 = (u64)A0;
+	t_object_2e132 = (u64)A1;
+	t_object_2e163 = (u64)A2;
+	t_object_2e167 = (u64)A3;
+	t_object_2e183 = (u64)A4;
+	t_object_2e187 = (u64)A5;
+	t_object_2e203 = (u64)A6;
+	t_object_2e207 = (u64)A7;
+	t_object_2e223 = (u64)A8;
+	t_object_2e227 = (u64)A9;
+	t_object_2e243 = (u64)A10;
+	t_object_2e247 = (u64)A11;
+	t_object_2e263 = (u64)A12;
+	t_object_2e267 = (u64)A13;
+	t_object_2e283 = (u64)A14;
+	t_object_2e287 = (u64)A15;
+	t_object_2e303 = (u64)A16;
+	t_object_2e307 = (u64)A17;
+	t_object_2e323 = (u64)A18;
+	t_object_2e327 = (u64)A19;
+	L_body_2e118:;
+	*(u32 *)t_object_2e124 = (u32)((u64)3532310079UL);
+	t__2e128 = (u64)((u64)t_object_2e124 + (u64)((u64)4UL));
+	*(u32 *)t__2e128 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e132 = (u64)((u64)0UL);
+	t__2e134 = (u64)((u64)t_object_2e132 + (u64)((u64)8UL));
+	*(u64 *)t__2e134 = (u64)((u64)0UL);
+	t__2e134 = (u64)((u64)t__2e134 + (u64)((u64)8UL));
+	*(u64 *)t__2e134 = (u64)((u64)0UL);
+	BLIT((u64)B20, t_object_2e124, 8);
+	BLIT((u64)B21, ((u64)((char *)&D_strliteral_2e130)), 24);
+	BLIT((u64)B22, t_object_2e132, 24);
+	t__2e122 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R23, (u64)B20, (u64)B21, (u64)B22);
+	t_tag_2e135 = (u64)(*(u32 *)t__2e122);
+	t__2e143 = (u64)(u32)(((u32)t_tag_2e135 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e143) goto L_member_2e140; else goto L__2e142;
+	L__2e142:;
+	t__2e145 = (u64)(u32)(((u32)t_tag_2e135 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e145) goto L_member_2e141; else goto L__2e144;
+	L__2e144:;
+	goto L_matches_2e139;
+	L_member_2e140:;
+	goto L_matches_2e139;
+	L_member_2e141:;
+	goto L_matches_2e138;
+	L_matches_2e138:;
+	goto L__2e136;
+	L_matches_2e139:;
+	t_abortsite_2e147 = ((u64)0UL);
+	goto L_abort_2e148;
+	L__2e154:;
+	L__2e137:;
+	t_abortsite_2e147 = ((u64)1UL);
+	goto L_abort_2e155;
+	L__2e136:;
+	*(u32 *)t_object_2e163 = (u32)((u64)3532310079UL);
+	t__2e164 = (u64)((u64)t_object_2e163 + (u64)((u64)4UL));
+	*(u32 *)t__2e164 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e167 = (u64)((u64)0UL);
+	t__2e168 = (u64)((u64)t_object_2e167 + (u64)((u64)8UL));
+	*(u64 *)t__2e168 = (u64)((u64)0UL);
+	t__2e168 = (u64)((u64)t__2e168 + (u64)((u64)8UL));
+	*(u64 *)t__2e168 = (u64)((u64)0UL);
+	BLIT((u64)B24, t_object_2e163, 8);
+	BLIT((u64)B25, ((u64)((char *)&D_strliteral_2e166)), 24);
+	BLIT((u64)B26, t_object_2e167, 24);
+	t__2e162 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R27, (u64)B24, (u64)B25, (u64)B26);
+	t_tag_2e169 = (u64)(*(u32 *)t__2e162);
+	t__2e177 = (u64)(u32)(((u32)t_tag_2e169 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e177) goto L_member_2e174; else goto L__2e176;
+	L__2e176:;
+	t__2e179 = (u64)(u32)(((u32)t_tag_2e169 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e179) goto L_member_2e175; else goto L__2e178;
+	L__2e178:;
+	goto L_matches_2e173;
+	L_member_2e174:;
+	goto L_matches_2e173;
+	L_member_2e175:;
+	goto L_matches_2e172;
+	L_matches_2e172:;
+	goto L__2e170;
+	L_matches_2e173:;
+	t_abortsite_2e147 = ((u64)2UL);
+	goto L_abort_2e148;
+	L__2e180:;
+	L__2e171:;
+	t_abortsite_2e147 = ((u64)3UL);
+	goto L_abort_2e155;
+	L__2e170:;
+	*(u32 *)t_object_2e183 = (u32)((u64)3532310079UL);
+	t__2e184 = (u64)((u64)t_object_2e183 + (u64)((u64)4UL));
+	*(u32 *)t__2e184 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e187 = (u64)((u64)0UL);
+	t__2e188 = (u64)((u64)t_object_2e187 + (u64)((u64)8UL));
+	*(u64 *)t__2e188 = (u64)((u64)0UL);
+	t__2e188 = (u64)((u64)t__2e188 + (u64)((u64)8UL));
+	*(u64 *)t__2e188 = (u64)((u64)0UL);
+	BLIT((u64)B28, t_object_2e183, 8);
+	BLIT((u64)B29, ((u64)((char *)&D_strliteral_2e186)), 24);
+	BLIT((u64)B30, t_object_2e187, 24);
+	t__2e182 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R31, (u64)B28, (u64)B29, (u64)B30);
+	t_tag_2e189 = (u64)(*(u32 *)t__2e182);
+	t__2e197 = (u64)(u32)(((u32)t_tag_2e189 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e197) goto L_member_2e194; else goto L__2e196;
+	L__2e196:;
+	t__2e199 = (u64)(u32)(((u32)t_tag_2e189 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e199) goto L_member_2e195; else goto L__2e198;
+	L__2e198:;
+	goto L_matches_2e193;
+	L_member_2e194:;
+	goto L_matches_2e193;
+	L_member_2e195:;
+	goto L_matches_2e192;
+	L_matches_2e192:;
+	goto L__2e190;
+	L_matches_2e193:;
+	t_abortsite_2e147 = ((u64)4UL);
+	goto L_abort_2e148;
+	L__2e200:;
+	L__2e191:;
+	t_abortsite_2e147 = ((u64)5UL);
+	goto L_abort_2e155;
+	L__2e190:;
+	*(u32 *)t_object_2e203 = (u32)((u64)3532310079UL);
+	t__2e204 = (u64)((u64)t_object_2e203 + (u64)((u64)4UL));
+	*(u32 *)t__2e204 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e207 = (u64)((u64)0UL);
+	t__2e208 = (u64)((u64)t_object_2e207 + (u64)((u64)8UL));
+	*(u64 *)t__2e208 = (u64)((u64)0UL);
+	t__2e208 = (u64)((u64)t__2e208 + (u64)((u64)8UL));
+	*(u64 *)t__2e208 = (u64)((u64)0UL);
+	BLIT((u64)B32, t_object_2e203, 8);
+	BLIT((u64)B33, ((u64)((char *)&D_strliteral_2e206)), 24);
+	BLIT((u64)B34, t_object_2e207, 24);
+	t__2e202 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R35, (u64)B32, (u64)B33, (u64)B34);
+	t_tag_2e209 = (u64)(*(u32 *)t__2e202);
+	t__2e217 = (u64)(u32)(((u32)t_tag_2e209 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e217) goto L_member_2e214; else goto L__2e216;
+	L__2e216:;
+	t__2e219 = (u64)(u32)(((u32)t_tag_2e209 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e219) goto L_member_2e215; else goto L__2e218;
+	L__2e218:;
+	goto L_matches_2e213;
+	L_member_2e214:;
+	goto L_matches_2e213;
+	L_member_2e215:;
+	goto L_matches_2e212;
+	L_matches_2e212:;
+	goto L__2e210;
+	L_matches_2e213:;
+	t_abortsite_2e147 = ((u64)6UL);
+	goto L_abort_2e148;
+	L__2e220:;
+	L__2e211:;
+	t_abortsite_2e147 = ((u64)7UL);
+	goto L_abort_2e155;
+	L__2e210:;
+	*(u32 *)t_object_2e223 = (u32)((u64)3532310079UL);
+	t__2e224 = (u64)((u64)t_object_2e223 + (u64)((u64)4UL));
+	*(u32 *)t__2e224 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e227 = (u64)((u64)0UL);
+	t__2e228 = (u64)((u64)t_object_2e227 + (u64)((u64)8UL));
+	*(u64 *)t__2e228 = (u64)((u64)0UL);
+	t__2e228 = (u64)((u64)t__2e228 + (u64)((u64)8UL));
+	*(u64 *)t__2e228 = (u64)((u64)0UL);
+	BLIT((u64)B36, t_object_2e223, 8);
+	BLIT((u64)B37, ((u64)((char *)&D_strliteral_2e226)), 24);
+	BLIT((u64)B38, t_object_2e227, 24);
+	t__2e222 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R39, (u64)B36, (u64)B37, (u64)B38);
+	t_tag_2e229 = (u64)(*(u32 *)t__2e222);
+	t__2e237 = (u64)(u32)(((u32)t_tag_2e229 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e237) goto L_member_2e234; else goto L__2e236;
+	L__2e236:;
+	t__2e239 = (u64)(u32)(((u32)t_tag_2e229 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e239) goto L_member_2e235; else goto L__2e238;
+	L__2e238:;
+	goto L_matches_2e233;
+	L_member_2e234:;
+	goto L_matches_2e233;
+	L_member_2e235:;
+	goto L_matches_2e232;
+	L_matches_2e232:;
+	goto L__2e230;
+	L_matches_2e233:;
+	t_abortsite_2e147 = ((u64)8UL);
+	goto L_abort_2e148;
+	L__2e240:;
+	L__2e231:;
+	t_abortsite_2e147 = ((u64)9UL);
+	goto L_abort_2e155;
+	L__2e230:;
+	*(u32 *)t_object_2e243 = (u32)((u64)3532310079UL);
+	t__2e244 = (u64)((u64)t_object_2e243 + (u64)((u64)4UL));
+	*(u32 *)t__2e244 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e247 = (u64)((u64)0UL);
+	t__2e248 = (u64)((u64)t_object_2e247 + (u64)((u64)8UL));
+	*(u64 *)t__2e248 = (u64)((u64)0UL);
+	t__2e248 = (u64)((u64)t__2e248 + (u64)((u64)8UL));
+	*(u64 *)t__2e248 = (u64)((u64)0UL);
+	BLIT((u64)B40, t_object_2e243, 8);
+	BLIT((u64)B41, ((u64)((char *)&D_strliteral_2e246)), 24);
+	BLIT((u64)B42, t_object_2e247, 24);
+	t__2e242 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R43, (u64)B40, (u64)B41, (u64)B42);
+	t_tag_2e249 = (u64)(*(u32 *)t__2e242);
+	t__2e257 = (u64)(u32)(((u32)t_tag_2e249 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e257) goto L_member_2e254; else goto L__2e256;
+	L__2e256:;
+	t__2e259 = (u64)(u32)(((u32)t_tag_2e249 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e259) goto L_member_2e255; else goto L__2e258;
+	L__2e258:;
+	goto L_matches_2e253;
+	L_member_2e254:;
+	goto L_matches_2e253;
+	L_member_2e255:;
+	goto L_matches_2e252;
+	L_matches_2e252:;
+	goto L__2e250;
+	L_matches_2e253:;
+	t_abortsite_2e147 = ((u64)10UL);
+	goto L_abort_2e148;
+	L__2e260:;
+	L__2e251:;
+	t_abortsite_2e147 = ((u64)11UL);
+	goto L_abort_2e155;
+	L__2e250:;
+	*(u32 *)t_object_2e263 = (u32)((u64)3532310079UL);
+	t__2e264 = (u64)((u64)t_object_2e263 + (u64)((u64)4UL));
+	*(u32 *)t__2e264 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e267 = (u64)((u64)0UL);
+	t__2e268 = (u64)((u64)t_object_2e267 + (u64)((u64)8UL));
+	*(u64 *)t__2e268 = (u64)((u64)0UL);
+	t__2e268 = (u64)((u64)t__2e268 + (u64)((u64)8UL));
+	*(u64 *)t__2e268 = (u64)((u64)0UL);
+	BLIT((u64)B44, t_object_2e263, 8);
+	BLIT((u64)B45, ((u64)((char *)&D_strliteral_2e266)), 24);
+	BLIT((u64)B46, t_object_2e267, 24);
+	t__2e262 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R47, (u64)B44, (u64)B45, (u64)B46);
+	t_tag_2e269 = (u64)(*(u32 *)t__2e262);
+	t__2e277 = (u64)(u32)(((u32)t_tag_2e269 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e277) goto L_member_2e274; else goto L__2e276;
+	L__2e276:;
+	t__2e279 = (u64)(u32)(((u32)t_tag_2e269 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e279) goto L_member_2e275; else goto L__2e278;
+	L__2e278:;
+	goto L_matches_2e273;
+	L_member_2e274:;
+	goto L_matches_2e273;
+	L_member_2e275:;
+	goto L_matches_2e272;
+	L_matches_2e272:;
+	goto L__2e270;
+	L_matches_2e273:;
+	t_abortsite_2e147 = ((u64)12UL);
+	goto L_abort_2e148;
+	L__2e280:;
+	L__2e271:;
+	t_abortsite_2e147 = ((u64)13UL);
+	goto L_abort_2e155;
+	L__2e270:;
+	*(u32 *)t_object_2e283 = (u32)((u64)3532310079UL);
+	t__2e284 = (u64)((u64)t_object_2e283 + (u64)((u64)4UL));
+	*(u32 *)t__2e284 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e287 = (u64)((u64)0UL);
+	t__2e288 = (u64)((u64)t_object_2e287 + (u64)((u64)8UL));
+	*(u64 *)t__2e288 = (u64)((u64)0UL);
+	t__2e288 = (u64)((u64)t__2e288 + (u64)((u64)8UL));
+	*(u64 *)t__2e288 = (u64)((u64)0UL);
+	BLIT((u64)B48, t_object_2e283, 8);
+	BLIT((u64)B49, ((u64)((char *)&D_strliteral_2e286)), 24);
+	BLIT((u64)B50, t_object_2e287, 24);
+	t__2e282 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R51, (u64)B48, (u64)B49, (u64)B50);
+	t_tag_2e289 = (u64)(*(u32 *)t__2e282);
+	t__2e297 = (u64)(u32)(((u32)t_tag_2e289 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e297) goto L_member_2e294; else goto L__2e296;
+	L__2e296:;
+	t__2e299 = (u64)(u32)(((u32)t_tag_2e289 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e299) goto L_member_2e295; else goto L__2e298;
+	L__2e298:;
+	goto L_matches_2e293;
+	L_member_2e294:;
+	goto L_matches_2e293;
+	L_member_2e295:;
+	goto L_matches_2e292;
+	L_matches_2e292:;
+	goto L__2e290;
+	L_matches_2e293:;
+	t_abortsite_2e147 = ((u64)14UL);
+	goto L_abort_2e148;
+	L__2e300:;
+	L__2e291:;
+	t_abortsite_2e147 = ((u64)15UL);
+	goto L_abort_2e155;
+	L__2e290:;
+	*(u32 *)t_object_2e303 = (u32)((u64)3532310079UL);
+	t__2e304 = (u64)((u64)t_object_2e303 + (u64)((u64)4UL));
+	*(u32 *)t__2e304 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e307 = (u64)((u64)0UL);
+	t__2e308 = (u64)((u64)t_object_2e307 + (u64)((u64)8UL));
+	*(u64 *)t__2e308 = (u64)((u64)0UL);
+	t__2e308 = (u64)((u64)t__2e308 + (u64)((u64)8UL));
+	*(u64 *)t__2e308 = (u64)((u64)0UL);
+	BLIT((u64)B52, t_object_2e303, 8);
+	BLIT((u64)B53, ((u64)((char *)&D_strliteral_2e306)), 24);
+	BLIT((u64)B54, t_object_2e307, 24);
+	t__2e302 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R55, (u64)B52, (u64)B53, (u64)B54);
+	t_tag_2e309 = (u64)(*(u32 *)t__2e302);
+	t__2e317 = (u64)(u32)(((u32)t_tag_2e309 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e317) goto L_member_2e314; else goto L__2e316;
+	L__2e316:;
+	t__2e319 = (u64)(u32)(((u32)t_tag_2e309 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e319) goto L_member_2e315; else goto L__2e318;
+	L__2e318:;
+	goto L_matches_2e313;
+	L_member_2e314:;
+	goto L_matches_2e313;
+	L_member_2e315:;
+	goto L_matches_2e312;
+	L_matches_2e312:;
+	goto L__2e310;
+	L_matches_2e313:;
+	t_abortsite_2e147 = ((u64)16UL);
+	goto L_abort_2e148;
+	L__2e320:;
+	L__2e311:;
+	t_abortsite_2e147 = ((u64)17UL);
+	goto L_abort_2e155;
+	L__2e310:;
+	*(u32 *)t_object_2e323 = (u32)((u64)3532310079UL);
+	t__2e324 = (u64)((u64)t_object_2e323 + (u64)((u64)4UL));
+	*(u32 *)t__2e324 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e327 = (u64)((u64)0UL);
+	t__2e328 = (u64)((u64)t_object_2e327 + (u64)((u64)8UL));
+	*(u64 *)t__2e328 = (u64)((u64)0UL);
+	t__2e328 = (u64)((u64)t__2e328 + (u64)((u64)8UL));
+	*(u64 *)t__2e328 = (u64)((u64)0UL);
+	BLIT((u64)B56, t_object_2e323, 8);
+	BLIT((u64)B57, ((u64)((char *)&D_strliteral_2e326)), 24);
+	BLIT((u64)B58, t_object_2e327, 24);
+	t__2e322 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R59, (u64)B56, (u64)B57, (u64)B58);
+	t_tag_2e329 = (u64)(*(u32 *)t__2e322);
+	t__2e337 = (u64)(u32)(((u32)t_tag_2e329 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e337) goto L_member_2e334; else goto L__2e336;
+	L__2e336:;
+	t__2e339 = (u64)(u32)(((u32)t_tag_2e329 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e339) goto L_member_2e335; else goto L__2e338;
+	L__2e338:;
+	goto L_matches_2e333;
+	L_member_2e334:;
+	goto L_matches_2e333;
+	L_member_2e335:;
+	goto L_matches_2e332;
+	L_matches_2e332:;
+	goto L__2e330;
+	L_matches_2e333:;
+	t_abortsite_2e147 = ((u64)18UL);
+	goto L_abort_2e148;
+	L__2e340:;
+	L__2e331:;
+	t_abortsite_2e147 = ((u64)19UL);
+	goto L_abort_2e155;
+	L__2e330:;
+	goto L__2e119;
+	L__2e341:;
+	L__2e119:;
+	return;
+	L_abort_2e148:;
+	t__2e149 = (u64)((u64)t_abortsite_2e147 * (u64)((u64)16UL));
+	t__2e149 = (u64)((u64)((u64)((char *)&D_abortsites_2e146)) + (u64)t__2e149);
+	t__2e150 = (u64)(*(u64 *)t__2e149);
+	t__2e151 = (u64)((u64)t__2e149 + (u64)((u64)8UL));
+	t__2e152 = (u64)(*(u32 *)t__2e151);
+	t__2e151 = (u64)((u64)t__2e149 + (u64)((u64)12UL));
+	t__2e153 = (u64)(*(u32 *)t__2e151);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e150, (u64)t__2e152, (u64)t__2e153, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e155:;
+	t__2e156 = (u64)((u64)t_abortsite_2e147 * (u64)((u64)16UL));
+	t__2e156 = (u64)((u64)((u64)((char *)&D_abortsites_2e146)) + (u64)t__2e156);
+	t__2e157 = (u64)(*(u64 *)t__2e156);
+	t__2e158 = (u64)((u64)t__2e156 + (u64)((u64)8UL));
+	t__2e159 = (u64)(*(u32 *)t__2e158);
+	t__2e158 = (u64)((u64)t__2e156 + (u64)((u64)12UL));
+	t__2e160 = (u64)(*(u32 *)t__2e158);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e157, (u64)t__2e159, (u64)t__2e160, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_typehints(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[1] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e347;
+	u64 t__2e349;
+	u64 t__2e350;
+	u64 t__2e351;
+	u64 t__2e352;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e357;
+	u64 t__2e358;
+	u64 t__2e359;
+	u64 t__2e360;
+	u64 t__2e361;
+	u64 t__2e362;
+	u64 t__2e363;
+	u64 t__2e364;
+	u64 t__2e365;
+	u64 t__2e368;
+	u64 t__2e369;
+	u64 t__2e370;
+	u64 t__2e373;
+	u64 t__2e374;
+	u64 t__2e375;
+	u64 t__2e379;
+	u64 t__2e380;
+	u64 t__2e381;
+	u64 t__2e384;
+	u64 t__2e385;
+	u64 t__2e386;
+	u64 t__2e390;
+	u64 t__2e393;
+	u64 t__2e394;
+	u64 t__2e395;
+	u64 t__2e396;
+	u64 t__2e400;
+	u64 t__2e401;
+	u64 t__2e402;
+	u64 t__2e403;
+	u64 t__2e404;
+	u64 t__2e411;
+	u64 t__2e412;
+	u64 t__2e417;
+	u64 t__2e418;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e421;
+	u64 t__2e422;
+	u64 t__2e423;
+	u64 t__2e424;
+	u64 t__2e428;
+	u64 t__2e429;
+	u64 t__2e430;
+	u64 t__2e431;
+	u64 t__2e432;
+	u64 t__2e433;
+	u64 t__2e434;
+	u64 t__2e435;
+	u64 t__2e437;
+	u64 t__2e438;
+	u64 t_abortsite_2e398;
+	u64 t_binding_2e346;
+	u64 t_binding_2e410;
+	u64 t_item_2e372;
+	u64 t_item_2e378;
+	u64 t_item_2e387;
+	u64 t_last_2e389;
+	u64 t_next_2e388;
+	u64 t_object_2e376;
+	L_start_2e342:;
+	t_binding_2e346 = (u64)A0;
+	t_object_2e376 = (u64)A1;
+	t_binding_2e410 = (u64)A2;
+	L_body_2e343:;
+	*(u64 *)t_binding_2e346 = (u64)((u64)0UL);
+	t__2e347 = (u64)((u64)t_binding_2e346 + (u64)((u64)8UL));
+	*(u64 *)t__2e347 = (u64)((u64)0UL);
+	t__2e347 = (u64)((u64)t__2e347 + (u64)((u64)8UL));
+	*(u64 *)t__2e347 = (u64)((u64)0UL);
+	t__2e349 = (u64)((u64)t_binding_2e346 + (u64)((u64)8UL));
+	t__2e350 = (u64)((u64)t_binding_2e346 + (u64)((u64)16UL));
+	t__2e351 = (u64)(*(u64 *)t__2e349);
+	t__2e352 = (u64)((u64)t__2e351 + (u64)((u64)1UL));
+	*(u64 *)t__2e349 = (u64)t__2e352;
+	t__2e354 = (u64)(*(u64 *)t__2e350);
+	t__2e357 = (u64)(u32)(((u64)t__2e352 <= (u64)t__2e354));
+	if ((u32)t__2e357) goto L__2e355; else goto L__2e356;
+	L__2e356:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e346, (u64)((u64)1UL));
+	goto L__2e355;
+	L__2e355:;
+	t__2e358 = (u64)(*(u64 *)t_binding_2e346);
+	t__2e353 = (u64)((u64)t__2e351 * (u64)((u64)1UL));
+	t__2e353 = (u64)((u64)t__2e358 + (u64)t__2e353);
+	t__2e359 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	*(u8 *)t__2e353 = (u8)((u64)42UL);
+	t__2e360 = (u64)((u64)t_binding_2e346 + (u64)((u64)8UL));
+	t__2e361 = (u64)((u64)t_binding_2e346 + (u64)((u64)16UL));
+	t__2e362 = (u64)(*(u64 *)t__2e360);
+	t__2e363 = (u64)((u64)t__2e362 + (u64)((u64)1UL));
+	*(u64 *)t__2e360 = (u64)t__2e363;
+	t__2e365 = (u64)(*(u64 *)t__2e361);
+	t__2e368 = (u64)(u32)(((u64)t__2e363 <= (u64)t__2e365));
+	if ((u32)t__2e368) goto L__2e366; else goto L__2e367;
+	L__2e367:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e346, (u64)((u64)1UL));
+	goto L__2e366;
+	L__2e366:;
+	t__2e369 = (u64)(*(u64 *)t_binding_2e346);
+	t__2e364 = (u64)((u64)t__2e362 * (u64)((u64)1UL));
+	t__2e364 = (u64)((u64)t__2e369 + (u64)t__2e364);
+	t__2e370 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	t_item_2e372 = (u64)((u64)t__2e364 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e372 = (u8)((u64)42UL);
+	t__2e373 = (u64)((u64)t_binding_2e346 + (u64)((u64)8UL));
+	t__2e374 = (u64)((u64)t_binding_2e346 + (u64)((u64)16UL));
+	t__2e375 = (u64)(*(u64 *)t__2e373);
+	t_item_2e378 = (u64)((u64)t_object_2e376 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e378 = (u8)((u64)42UL);
+	t__2e379 = (u64)((u64)t__2e375 + (u64)((u64)3UL));
+	*(u64 *)t__2e373 = (u64)t__2e379;
+	t__2e381 = (u64)(*(u64 *)t__2e374);
+	t__2e384 = (u64)(u32)(((u64)t__2e379 <= (u64)t__2e381));
+	if ((u32)t__2e384) goto L__2e382; else goto L__2e383;
+	L__2e383:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e346, (u64)((u64)1UL));
+	goto L__2e382;
+	L__2e382:;
+	t__2e385 = (u64)(*(u64 *)t_binding_2e346);
+	t__2e380 = (u64)((u64)t__2e375 * (u64)((u64)1UL));
+	t__2e380 = (u64)((u64)t__2e385 + (u64)t__2e380);
+	t__2e386 = (u64)((u64)((u64)3UL) * (u64)((u64)1UL));
+	t_item_2e387 = (u64)((u64)t__2e380 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e387 = (u8)((u64)42UL);
+	t_next_2e388 = (u64)((u64)t__2e380 + (u64)((u64)1UL));
+	t_last_2e389 = (u64)((u64)t__2e380 + (u64)((u64)0UL));
+	t__2e390 = (u64)((u64)((u64)3UL) - (u64)((u64)1UL));
+	t__2e390 = (u64)((u64)t__2e390 * (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t_next_2e388, (u64)t_last_2e389, (u64)t__2e390);
+	t__2e394 = (u64)((u64)t_binding_2e346 + (u64)((u64)8UL));
+	t__2e395 = (u64)((u64)t_binding_2e346 + (u64)((u64)16UL));
+	t__2e396 = (u64)(*(u64 *)t__2e394);
+	t__2e393 = (u64)(u32)(((u64)t__2e396 == (u64)((u64)5UL)));
+	if ((u32)t__2e393) goto L_passed_2e392; else goto L_failed_2e391;
+	L_failed_2e391:;
+	t_abortsite_2e398 = ((u64)0UL);
+	goto L_abort_2e399;
+	L_passed_2e392:;
+	*(u64 *)t_binding_2e410 = (u64)((u64)0UL);
+	L_loop_2e405:;
+	t__2e412 = (u64)(*(u64 *)t_binding_2e410);
+	t__2e411 = (u64)(u32)(((u64)t__2e412 < (u64)((u64)5UL)));
+	if ((u32)t__2e411) goto L_body_2e406; else goto L__2e408;
+	L_body_2e406:;
+	t__2e419 = (u64)((u64)t_binding_2e346 + (u64)((u64)8UL));
+	t__2e420 = (u64)((u64)t_binding_2e346 + (u64)((u64)16UL));
+	t__2e421 = (u64)(*(u64 *)t_binding_2e346);
+	t__2e422 = (u64)(*(u64 *)t__2e419);
+	t__2e423 = (u64)(*(u64 *)t_binding_2e410);
+	t__2e418 = (u64)((u64)t__2e423 * (u64)((u64)1UL));
+	t__2e418 = (u64)((u64)t__2e421 + (u64)t__2e418);
+	t__2e424 = (u64)(u32)(((u64)t__2e423 < (u64)t__2e422));
+	if ((u32)t__2e424) goto L__2e426; else goto L__2e425;
+	L__2e425:;
+	t_abortsite_2e398 = ((u64)1UL);
+	goto L_abort_2e427;
+	L__2e426:;
+	t__2e433 = (u64)(u32)(*(u8 *)t__2e418);
+	t__2e434 = (u64)(u32)((u8)t__2e433);
+	t__2e435 = (u64)(u32)((u8)((u64)42UL));
+	t__2e417 = (u64)(u32)(((u32)t__2e434 == (u32)t__2e435));
+	if ((u32)t__2e417) goto L_passed_2e416; else goto L_failed_2e415;
+	L_failed_2e415:;
+	t_abortsite_2e398 = ((u64)2UL);
+	goto L_abort_2e399;
+	L_passed_2e416:;
+	goto L__2e413;
+	L__2e436:;
+	L__2e413:;
+	L_after_2e409:;
+	t__2e437 = (u64)(*(u64 *)t_binding_2e410);
+	t__2e437 = (u64)((u64)t__2e437 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e410 = (u64)t__2e437;
+	goto L_loop_2e405;
+	L__2e408:;
+	t__2e438 = (u64)(*(u64 *)t_binding_2e346);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e438);
+	goto L__2e344;
+	L__2e439:;
+	L__2e344:;
+	return;
+	L_abort_2e399:;
+	t__2e400 = (u64)((u64)t_abortsite_2e398 * (u64)((u64)16UL));
+	t__2e400 = (u64)((u64)((u64)((char *)&D_abortsites_2e397)) + (u64)t__2e400);
+	t__2e401 = (u64)(*(u64 *)t__2e400);
+	t__2e402 = (u64)((u64)t__2e400 + (u64)((u64)8UL));
+	t__2e403 = (u64)(*(u32 *)t__2e402);
+	t__2e402 = (u64)((u64)t__2e400 + (u64)((u64)12UL));
+	t__2e404 = (u64)(*(u32 *)t__2e402);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e401, (u64)t__2e403, (u64)t__2e404, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e427:;
+	t__2e428 = (u64)((u64)t_abortsite_2e398 * (u64)((u64)16UL));
+	t__2e428 = (u64)((u64)((u64)((char *)&D_abortsites_2e397)) + (u64)t__2e428);
+	t__2e429 = (u64)(*(u64 *)t__2e428);
+	t__2e430 = (u64)((u64)t__2e428 + (u64)((u64)8UL));
+	t__2e431 = (u64)(*(u32 *)t__2e430);
+	t__2e430 = (u64)((u64)t__2e428 + (u64)((u64)12UL));
+	t__2e432 = (u64)(*(u32 *)t__2e430);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e429, (u64)t__2e431, (u64)t__2e432, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_capacity(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e445;
+	u64 t__2e451;
+	u64 t__2e452;
+	u64 t__2e453;
+	u64 t__2e454;
+	u64 t__2e455;
+	u64 t__2e456;
+	u64 t__2e459;
+	u64 t__2e462;
+	u64 t__2e463;
+	u64 t__2e464;
+	u64 t__2e465;
+	u64 t__2e466;
+	u64 t__2e467;
+	u64 t__2e470;
+	u64 t__2e471;
+	u64 t__2e472;
+	u64 t__2e473;
+	u64 t__2e474;
+	u64 t__2e475;
+	u64 t__2e478;
+	u64 t__2e479;
+	u64 t__2e480;
+	u64 t__2e482;
+	u64 t__2e483;
+	u64 t__2e484;
+	u64 t__2e485;
+	u64 t__2e486;
+	u64 t__2e487;
+	u64 t__2e488;
+	u64 t__2e492;
+	u64 t__2e493;
+	u64 t__2e494;
+	u64 t__2e495;
+	u64 t__2e496;
+	u64 t__2e497;
+	u64 t__2e498;
+	u64 t__2e499;
+	u64 t__2e500;
+	u64 t__2e501;
+	u64 t__2e502;
+	u64 t__2e505;
+	u64 t__2e506;
+	u64 t__2e507;
+	u64 t__2e510;
+	u64 t__2e511;
+	u64 t__2e512;
+	u64 t__2e516;
+	u64 t__2e517;
+	u64 t__2e518;
+	u64 t__2e521;
+	u64 t__2e522;
+	u64 t__2e523;
+	u64 t__2e527;
+	u64 t__2e530;
+	u64 t__2e531;
+	u64 t__2e532;
+	u64 t__2e533;
+	u64 t__2e535;
+	u64 t__2e536;
+	u64 t__2e537;
+	u64 t__2e538;
+	u64 t__2e539;
+	u64 t__2e542;
+	u64 t__2e543;
+	u64 t__2e544;
+	u64 t__2e545;
+	u64 t__2e546;
+	u64 t__2e547;
+	u64 t__2e548;
+	u64 t__2e549;
+	u64 t__2e552;
+	u64 t__2e553;
+	u64 t__2e554;
+	u64 t__2e555;
+	u64 t__2e556;
+	u64 t__2e557;
+	u64 t__2e558;
+	u64 t__2e561;
+	u64 t__2e562;
+	u64 t__2e563;
+	u64 t__2e566;
+	u64 t__2e567;
+	u64 t__2e568;
+	u64 t__2e569;
+	u64 t__2e576;
+	u64 t__2e577;
+	u64 t__2e578;
+	u64 t__2e579;
+	u64 t__2e580;
+	u64 t__2e585;
+	u64 t__2e586;
+	u64 t__2e587;
+	u64 t__2e588;
+	u64 t__2e589;
+	u64 t__2e590;
+	u64 t__2e591;
+	u64 t__2e592;
+	u64 t__2e593;
+	u64 t__2e594;
+	u64 t__2e596;
+	u64 t__2e597;
+	u64 t_abortsite_2e449;
+	u64 t_binding_2e444;
+	u64 t_binding_2e481;
+	u64 t_binding_2e575;
+	u64 t_item_2e509;
+	u64 t_item_2e515;
+	u64 t_item_2e524;
+	u64 t_last_2e526;
+	u64 t_next_2e525;
+	u64 t_object_2e513;
+	L_start_2e440:;
+	t_binding_2e444 = (u64)A0;
+	t_binding_2e481 = (u64)A1;
+	t_object_2e513 = (u64)A2;
+	t_binding_2e575 = (u64)A3;
+	L_body_2e441:;
+	t__2e445 = (u64)(u32)(((u64)((u64)0UL) <= (u64)((u64)4UL)));
+	if ((u32)t__2e445) goto L__2e446; else goto L__2e447;
+	L__2e447:;
+	t_abortsite_2e449 = ((u64)0UL);
+	goto L_abort_2e450;
+	L__2e446:;
+	t__2e456 = (u64)((u64)((u64)4UL) * (u64)((u64)4UL));
+	t__2e459 = ((u64)0UL);
+	t__2e445 = (u64)(u32)(((u64)t__2e456 != (u64)((u64)0UL)));
+	if ((u32)t__2e445) goto L__2e458; else goto L__2e457;
+	L__2e458:;
+	t__2e459 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)t__2e456));
+	t__2e445 = (u64)(u32)(((u64)t__2e459 != (u64)((u64)0UL)));
+	if ((u32)t__2e445) goto L__2e457; else goto L__2e460;
+	L__2e460:;
+	t_abortsite_2e449 = ((u64)1UL);
+	goto L_abort_2e461;
+	L__2e457:;
+	*(u64 *)t_binding_2e444 = (u64)t__2e459;
+	t__2e467 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	*(u64 *)t__2e467 = (u64)((u64)0UL);
+	t__2e467 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	*(u64 *)t__2e467 = (u64)((u64)4UL);
+	t__2e470 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	t__2e471 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	t__2e472 = (u64)(*(u64 *)t__2e470);
+	t__2e473 = (u64)((u64)t__2e472 + (u64)((u64)1UL));
+	*(u64 *)t__2e470 = (u64)t__2e473;
+	t__2e475 = (u64)(*(u64 *)t__2e471);
+	t__2e478 = (u64)(u32)(((u64)t__2e473 <= (u64)t__2e475));
+	if ((u32)t__2e478) goto L__2e476; else goto L__2e477;
+	L__2e477:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e444, (u64)((u64)4UL));
+	goto L__2e476;
+	L__2e476:;
+	t__2e479 = (u64)(*(u64 *)t_binding_2e444);
+	t__2e474 = (u64)((u64)t__2e472 * (u64)((u64)4UL));
+	t__2e474 = (u64)((u64)t__2e479 + (u64)t__2e474);
+	t__2e480 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e474 = (u32)((u64)1UL);
+	t__2e483 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	t__2e484 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	t__2e485 = (u64)(*(u64 *)t_binding_2e444);
+	t__2e486 = (u64)(*(u64 *)t__2e483);
+	t__2e487 = (u64)((i64)(i32)((u64)0UL));
+	t__2e482 = (u64)((u64)t__2e487 * (u64)((u64)4UL));
+	t__2e482 = (u64)((u64)t__2e485 + (u64)t__2e482);
+	t__2e488 = (u64)(u32)(((u64)t__2e487 < (u64)t__2e486));
+	if ((u32)t__2e488) goto L__2e490; else goto L__2e489;
+	L__2e489:;
+	t_abortsite_2e449 = ((u64)2UL);
+	goto L_abort_2e491;
+	L__2e490:;
+	*(u64 *)t_binding_2e481 = (u64)t__2e482;
+	t__2e497 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	t__2e498 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	t__2e499 = (u64)(*(u64 *)t__2e497);
+	t__2e500 = (u64)((u64)t__2e499 + (u64)((u64)2UL));
+	*(u64 *)t__2e497 = (u64)t__2e500;
+	t__2e502 = (u64)(*(u64 *)t__2e498);
+	t__2e505 = (u64)(u32)(((u64)t__2e500 <= (u64)t__2e502));
+	if ((u32)t__2e505) goto L__2e503; else goto L__2e504;
+	L__2e504:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e444, (u64)((u64)4UL));
+	goto L__2e503;
+	L__2e503:;
+	t__2e506 = (u64)(*(u64 *)t_binding_2e444);
+	t__2e501 = (u64)((u64)t__2e499 * (u64)((u64)4UL));
+	t__2e501 = (u64)((u64)t__2e506 + (u64)t__2e501);
+	t__2e507 = (u64)((u64)((u64)2UL) * (u64)((u64)4UL));
+	t_item_2e509 = (u64)((u64)t__2e501 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e509 = (u32)((u64)2UL);
+	t_item_2e509 = (u64)((u64)t__2e501 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e509 = (u32)((u64)3UL);
+	t__2e510 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	t__2e511 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	t__2e512 = (u64)(*(u64 *)t__2e510);
+	t_item_2e515 = (u64)((u64)t_object_2e513 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e515 = (u32)((u64)4UL);
+	t__2e516 = (u64)((u64)t__2e512 + (u64)((u64)1UL));
+	*(u64 *)t__2e510 = (u64)t__2e516;
+	t__2e518 = (u64)(*(u64 *)t__2e511);
+	t__2e521 = (u64)(u32)(((u64)t__2e516 <= (u64)t__2e518));
+	if ((u32)t__2e521) goto L__2e519; else goto L__2e520;
+	L__2e520:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e444, (u64)((u64)4UL));
+	goto L__2e519;
+	L__2e519:;
+	t__2e522 = (u64)(*(u64 *)t_binding_2e444);
+	t__2e517 = (u64)((u64)t__2e512 * (u64)((u64)4UL));
+	t__2e517 = (u64)((u64)t__2e522 + (u64)t__2e517);
+	t__2e523 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	t_item_2e524 = (u64)((u64)t__2e517 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e524 = (u32)((u64)4UL);
+	t_next_2e525 = (u64)((u64)t__2e517 + (u64)((u64)4UL));
+	t_last_2e526 = (u64)((u64)t__2e517 + (u64)((u64)0UL));
+	t__2e527 = (u64)((u64)((u64)1UL) - (u64)((u64)1UL));
+	t__2e527 = (u64)((u64)t__2e527 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t_next_2e525, (u64)t_last_2e526, (u64)t__2e527);
+	t__2e531 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	t__2e532 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	t__2e533 = (u64)(*(u64 *)t__2e531);
+	t__2e530 = (u64)(u32)(((u64)t__2e533 == (u64)((u64)4UL)));
+	if ((u32)t__2e530) goto L_passed_2e529; else goto L_failed_2e528;
+	L_failed_2e528:;
+	t_abortsite_2e449 = ((u64)3UL);
+	goto L_abort_2e534;
+	L_passed_2e529:;
+	t__2e544 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	t__2e545 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	t__2e546 = (u64)(*(u64 *)t_binding_2e444);
+	t__2e547 = (u64)(*(u64 *)t__2e544);
+	t__2e548 = (u64)((i64)(i32)((u64)0UL));
+	t__2e543 = (u64)((u64)t__2e548 * (u64)((u64)4UL));
+	t__2e543 = (u64)((u64)t__2e546 + (u64)t__2e543);
+	t__2e549 = (u64)(u32)(((u64)t__2e548 < (u64)t__2e547));
+	if ((u32)t__2e549) goto L__2e551; else goto L__2e550;
+	L__2e550:;
+	t_abortsite_2e449 = ((u64)4UL);
+	goto L_abort_2e491;
+	L__2e551:;
+	t__2e552 = (u64)(*(u64 *)t_binding_2e481);
+	t__2e542 = (u64)(u32)(((u64)t__2e543 == (u64)t__2e552));
+	if ((u32)t__2e542) goto L_passed_2e541; else goto L_failed_2e540;
+	L_failed_2e540:;
+	t_abortsite_2e449 = ((u64)5UL);
+	goto L_abort_2e534;
+	L_passed_2e541:;
+	t__2e553 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	t__2e554 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	t__2e555 = (u64)(*(u64 *)t__2e553);
+	t__2e556 = (u64)((u64)t__2e555 + (u64)((u64)1UL));
+	*(u64 *)t__2e553 = (u64)t__2e556;
+	t__2e558 = (u64)(*(u64 *)t__2e554);
+	t__2e561 = (u64)(u32)(((u64)t__2e556 <= (u64)t__2e558));
+	if ((u32)t__2e561) goto L__2e559; else goto L__2e560;
+	L__2e560:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e444, (u64)((u64)4UL));
+	goto L__2e559;
+	L__2e559:;
+	t__2e562 = (u64)(*(u64 *)t_binding_2e444);
+	t__2e557 = (u64)((u64)t__2e555 * (u64)((u64)4UL));
+	t__2e557 = (u64)((u64)t__2e562 + (u64)t__2e557);
+	t__2e563 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e557 = (u32)((u64)5UL);
+	t__2e567 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	t__2e568 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	t__2e569 = (u64)(*(u64 *)t__2e567);
+	t__2e566 = (u64)(u32)(((u64)t__2e569 == (u64)((u64)5UL)));
+	if ((u32)t__2e566) goto L_passed_2e565; else goto L_failed_2e564;
+	L_failed_2e564:;
+	t_abortsite_2e449 = ((u64)6UL);
+	goto L_abort_2e534;
+	L_passed_2e565:;
+	*(u64 *)t_binding_2e575 = (u64)((u64)0UL);
+	L_loop_2e570:;
+	t__2e577 = (u64)(*(u64 *)t_binding_2e575);
+	t__2e578 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	t__2e579 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	t__2e580 = (u64)(*(u64 *)t__2e578);
+	t__2e576 = (u64)(u32)(((u64)t__2e577 < (u64)t__2e580));
+	if ((u32)t__2e576) goto L_body_2e571; else goto L__2e573;
+	L_body_2e571:;
+	t__2e587 = (u64)((u64)t_binding_2e444 + (u64)((u64)8UL));
+	t__2e588 = (u64)((u64)t_binding_2e444 + (u64)((u64)16UL));
+	t__2e589 = (u64)(*(u64 *)t_binding_2e444);
+	t__2e590 = (u64)(*(u64 *)t_binding_2e575);
+	t__2e586 = (u64)((u64)t__2e590 * (u64)((u64)4UL));
+	t__2e586 = (u64)((u64)t__2e589 + (u64)t__2e586);
+	t__2e591 = (u64)(u32)(*(i32 *)t__2e586);
+	t__2e593 = (u64)(*(u64 *)t_binding_2e575);
+	t__2e594 = (u64)(u32)t__2e593;
+	t__2e592 = (u64)(u32)((u32)t__2e594 + (u32)((u64)1UL));
+	t__2e585 = (u64)(u32)(((u32)t__2e591 == (u32)t__2e592));
+	if ((u32)t__2e585) goto L_passed_2e584; else goto L_failed_2e583;
+	L_failed_2e583:;
+	t_abortsite_2e449 = ((u64)7UL);
+	goto L_abort_2e534;
+	L_passed_2e584:;
+	goto L__2e581;
+	L__2e595:;
+	L__2e581:;
+	L_after_2e574:;
+	t__2e596 = (u64)(*(u64 *)t_binding_2e575);
+	t__2e596 = (u64)((u64)t__2e596 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e575 = (u64)t__2e596;
+	goto L_loop_2e570;
+	L__2e573:;
+	t__2e597 = (u64)(*(u64 *)t_binding_2e444);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e597);
+	goto L__2e442;
+	L__2e598:;
+	L__2e442:;
+	return;
+	L_abort_2e450:;
+	t__2e451 = (u64)((u64)t_abortsite_2e449 * (u64)((u64)16UL));
+	t__2e451 = (u64)((u64)((u64)((char *)&D_abortsites_2e448)) + (u64)t__2e451);
+	t__2e452 = (u64)(*(u64 *)t__2e451);
+	t__2e453 = (u64)((u64)t__2e451 + (u64)((u64)8UL));
+	t__2e454 = (u64)(*(u32 *)t__2e453);
+	t__2e453 = (u64)((u64)t__2e451 + (u64)((u64)12UL));
+	t__2e455 = (u64)(*(u32 *)t__2e453);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e452, (u64)t__2e454, (u64)t__2e455, (u64)((u64)5UL));
+	__builtin_trap();
+	L_abort_2e461:;
+	t__2e462 = (u64)((u64)t_abortsite_2e449 * (u64)((u64)16UL));
+	t__2e462 = (u64)((u64)((u64)((char *)&D_abortsites_2e448)) + (u64)t__2e462);
+	t__2e463 = (u64)(*(u64 *)t__2e462);
+	t__2e464 = (u64)((u64)t__2e462 + (u64)((u64)8UL));
+	t__2e465 = (u64)(*(u32 *)t__2e464);
+	t__2e464 = (u64)((u64)t__2e462 + (u64)((u64)12UL));
+	t__2e466 = (u64)(*(u32 *)t__2e464);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e463, (u64)t__2e465, (u64)t__2e466, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e491:;
+	t__2e492 = (u64)((u64)t_abortsite_2e449 * (u64)((u64)16UL));
+	t__2e492 = (u64)((u64)((u64)((char *)&D_abortsites_2e448)) + (u64)t__2e492);
+	t__2e493 = (u64)(*(u64 *)t__2e492);
+	t__2e494 = (u64)((u64)t__2e492 + (u64)((u64)8UL));
+	t__2e495 = (u64)(*(u32 *)t__2e494);
+	t__2e494 = (u64)((u64)t__2e492 + (u64)((u64)12UL));
+	t__2e496 = (u64)(*(u32 *)t__2e494);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e493, (u64)t__2e495, (u64)t__2e496, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e534:;
+	t__2e535 = (u64)((u64)t_abortsite_2e449 * (u64)((u64)16UL));
+	t__2e535 = (u64)((u64)((u64)((char *)&D_abortsites_2e448)) + (u64)t__2e535);
+	t__2e536 = (u64)(*(u64 *)t__2e535);
+	t__2e537 = (u64)((u64)t__2e535 + (u64)((u64)8UL));
+	t__2e538 = (u64)(*(u32 *)t__2e537);
+	t__2e537 = (u64)((u64)t__2e535 + (u64)((u64)12UL));
+	t__2e539 = (u64)(*(u32 *)t__2e537);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e536, (u64)t__2e538, (u64)t__2e539, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_withlength(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e604;
+	u64 t__2e605;
+	u64 t__2e606;
+	u64 t__2e607;
+	u64 t__2e610;
+	u64 t__2e611;
+	u64 t__2e612;
+	u64 t__2e615;
+	u64 t__2e616;
+	u64 t__2e617;
+	u64 t__2e621;
+	u64 t__2e624;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e627;
+	u64 t__2e631;
+	u64 t__2e632;
+	u64 t__2e633;
+	u64 t__2e634;
+	u64 t__2e635;
+	u64 t__2e642;
+	u64 t__2e643;
+	u64 t__2e644;
+	u64 t__2e645;
+	u64 t__2e646;
+	u64 t__2e651;
+	u64 t__2e652;
+	u64 t__2e653;
+	u64 t__2e654;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t__2e657;
+	u64 t__2e659;
+	u64 t__2e660;
+	u64 t_abortsite_2e629;
+	u64 t_binding_2e603;
+	u64 t_binding_2e641;
+	u64 t_item_2e609;
+	u64 t_item_2e618;
+	u64 t_last_2e620;
+	u64 t_next_2e619;
+	u64 t_object_2e608;
+	L_start_2e599:;
+	t_binding_2e603 = (u64)A0;
+	t_object_2e608 = (u64)A1;
+	t_binding_2e641 = (u64)A2;
+	L_body_2e600:;
+	*(u64 *)t_binding_2e603 = (u64)((u64)0UL);
+	t__2e604 = (u64)((u64)t_binding_2e603 + (u64)((u64)8UL));
+	*(u64 *)t__2e604 = (u64)((u64)0UL);
+	t__2e604 = (u64)((u64)t__2e604 + (u64)((u64)8UL));
+	*(u64 *)t__2e604 = (u64)((u64)0UL);
+	t__2e605 = (u64)((u64)t_binding_2e603 + (u64)((u64)8UL));
+	t__2e606 = (u64)((u64)t_binding_2e603 + (u64)((u64)16UL));
+	t__2e607 = (u64)(*(u64 *)t__2e605);
+	t_item_2e609 = (u64)((u64)t_object_2e608 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e609 = (u32)((u64)42UL);
+	t__2e610 = (u64)((u64)t__2e607 + (u64)((u64)10UL));
+	*(u64 *)t__2e605 = (u64)t__2e610;
+	t__2e612 = (u64)(*(u64 *)t__2e606);
+	t__2e615 = (u64)(u32)(((u64)t__2e610 <= (u64)t__2e612));
+	if ((u32)t__2e615) goto L__2e613; else goto L__2e614;
+	L__2e614:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e603, (u64)((u64)4UL));
+	goto L__2e613;
+	L__2e613:;
+	t__2e616 = (u64)(*(u64 *)t_binding_2e603);
+	t__2e611 = (u64)((u64)t__2e607 * (u64)((u64)4UL));
+	t__2e611 = (u64)((u64)t__2e616 + (u64)t__2e611);
+	t__2e617 = (u64)((u64)((u64)10UL) * (u64)((u64)4UL));
+	t_item_2e618 = (u64)((u64)t__2e611 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e618 = (u32)((u64)42UL);
+	t_next_2e619 = (u64)((u64)t__2e611 + (u64)((u64)4UL));
+	t_last_2e620 = (u64)((u64)t__2e611 + (u64)((u64)0UL));
+	t__2e621 = (u64)((u64)((u64)10UL) - (u64)((u64)1UL));
+	t__2e621 = (u64)((u64)t__2e621 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t_next_2e619, (u64)t_last_2e620, (u64)t__2e621);
+	t__2e625 = (u64)((u64)t_binding_2e603 + (u64)((u64)8UL));
+	t__2e626 = (u64)((u64)t_binding_2e603 + (u64)((u64)16UL));
+	t__2e627 = (u64)(*(u64 *)t__2e625);
+	t__2e624 = (u64)(u32)(((u64)t__2e627 == (u64)((u64)10UL)));
+	if ((u32)t__2e624) goto L_passed_2e623; else goto L_failed_2e622;
+	L_failed_2e622:;
+	t_abortsite_2e629 = ((u64)0UL);
+	goto L_abort_2e630;
+	L_passed_2e623:;
+	*(u64 *)t_binding_2e641 = (u64)((u64)0UL);
+	L_loop_2e636:;
+	t__2e643 = (u64)(*(u64 *)t_binding_2e641);
+	t__2e644 = (u64)((u64)t_binding_2e603 + (u64)((u64)8UL));
+	t__2e645 = (u64)((u64)t_binding_2e603 + (u64)((u64)16UL));
+	t__2e646 = (u64)(*(u64 *)t__2e644);
+	t__2e642 = (u64)(u32)(((u64)t__2e643 < (u64)t__2e646));
+	if ((u32)t__2e642) goto L_body_2e637; else goto L__2e639;
+	L_body_2e637:;
+	t__2e653 = (u64)((u64)t_binding_2e603 + (u64)((u64)8UL));
+	t__2e654 = (u64)((u64)t_binding_2e603 + (u64)((u64)16UL));
+	t__2e655 = (u64)(*(u64 *)t_binding_2e603);
+	t__2e656 = (u64)(*(u64 *)t_binding_2e641);
+	t__2e652 = (u64)((u64)t__2e656 * (u64)((u64)4UL));
+	t__2e652 = (u64)((u64)t__2e655 + (u64)t__2e652);
+	t__2e657 = (u64)(u32)(*(i32 *)t__2e652);
+	t__2e651 = (u64)(u32)(((u32)t__2e657 == (u32)((u64)42UL)));
+	if ((u32)t__2e651) goto L_passed_2e650; else goto L_failed_2e649;
+	L_failed_2e649:;
+	t_abortsite_2e629 = ((u64)1UL);
+	goto L_abort_2e630;
+	L_passed_2e650:;
+	goto L__2e647;
+	L__2e658:;
+	L__2e647:;
+	L_after_2e640:;
+	t__2e659 = (u64)(*(u64 *)t_binding_2e641);
+	t__2e659 = (u64)((u64)t__2e659 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e641 = (u64)t__2e659;
+	goto L_loop_2e636;
+	L__2e639:;
+	t__2e660 = (u64)(*(u64 *)t_binding_2e603);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e660);
+	goto L__2e601;
+	L__2e661:;
+	L__2e601:;
+	return;
+	L_abort_2e630:;
+	t__2e631 = (u64)((u64)t_abortsite_2e629 * (u64)((u64)16UL));
+	t__2e631 = (u64)((u64)((u64)((char *)&D_abortsites_2e628)) + (u64)t__2e631);
+	t__2e632 = (u64)(*(u64 *)t__2e631);
+	t__2e633 = (u64)((u64)t__2e631 + (u64)((u64)8UL));
+	t__2e634 = (u64)(*(u32 *)t__2e633);
+	t__2e633 = (u64)((u64)t__2e631 + (u64)((u64)12UL));
+	t__2e635 = (u64)(*(u32 *)t__2e633);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e632, (u64)t__2e634, (u64)t__2e635, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F___static(void) {
+	char A0[128] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[12] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[12] __attribute__((aligned(16)));
+	u64 t__2e669;
+	u64 t__2e670;
+	u64 t__2e672;
+	u64 t__2e674;
+	u64 t__2e675;
+	u64 t__2e676;
+	u64 t__2e677;
+	u64 t__2e680;
+	u64 t__2e686;
+	u64 t__2e687;
+	u64 t__2e688;
+	u64 t__2e689;
+	u64 t__2e690;
+	u64 t__2e692;
+	u64 t__2e693;
+	u64 t__2e694;
+	u64 t__2e695;
+	u64 t__2e696;
+	u64 t__2e697;
+	u64 t__2e698;
+	u64 t__2e701;
+	u64 t__2e702;
+	u64 t__2e703;
+	u64 t__2e704;
+	u64 t__2e705;
+	u64 t__2e706;
+	u64 t__2e707;
+	u64 t__2e708;
+	u64 t__2e709;
+	u64 t__2e712;
+	u64 t__2e713;
+	u64 t__2e714;
+	u64 t__2e715;
+	u64 t__2e716;
+	u64 t__2e717;
+	u64 t__2e718;
+	u64 t__2e719;
+	u64 t__2e720;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e725;
+	u64 t__2e728;
+	u64 t__2e729;
+	u64 t__2e730;
+	u64 t__2e731;
+	u64 t__2e733;
+	u64 t__2e734;
+	u64 t__2e735;
+	u64 t__2e736;
+	u64 t__2e737;
+	u64 t__2e738;
+	u64 t__2e739;
+	u64 t__2e740;
+	u64 t__2e741;
+	u64 t__2e742;
+	u64 t__2e743;
+	u64 t__2e746;
+	u64 t__2e747;
+	u64 t__2e748;
+	u64 t__2e752;
+	u64 t__2e753;
+	u64 t__2e754;
+	u64 t__2e755;
+	u64 t__2e762;
+	u64 t__2e763;
+	u64 t__2e764;
+	u64 t__2e765;
+	u64 t__2e766;
+	u64 t__2e771;
+	u64 t__2e772;
+	u64 t__2e773;
+	u64 t__2e774;
+	u64 t__2e775;
+	u64 t__2e776;
+	u64 t__2e777;
+	u64 t__2e778;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e783;
+	u64 t__2e784;
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e789;
+	u64 t__2e790;
+	u64 t__2e791;
+	u64 t__2e792;
+	u64 t__2e794;
+	u64 t__2e798;
+	u64 t__2e799;
+	u64 t__2e800;
+	u64 t__2e801;
+	u64 t__2e804;
+	u64 t__2e808;
+	u64 t__2e809;
+	u64 t__2e810;
+	u64 t__2e811;
+	u64 t__2e813;
+	u64 t__2e815;
+	u64 t__2e816;
+	u64 t__2e817;
+	u64 t__2e818;
+	u64 t__2e819;
+	u64 t__2e820;
+	u64 t__2e823;
+	u64 t__2e824;
+	u64 t__2e825;
+	u64 t__2e826;
+	u64 t__2e829;
+	u64 t__2e830;
+	u64 t__2e831;
+	u64 t__2e832;
+	u64 t_abortsite_2e684;
+	u64 t_binding_2e666;
+	u64 t_binding_2e673;
+	u64 t_binding_2e761;
+	u64 t_binding_2e795;
+	u64 t_data_2e691;
+	u64 t_data_2e807;
+	u64 t_item_2e668;
+	u64 t_item_2e671;
+	u64 t_item_2e749;
+	u64 t_item_2e797;
+	u64 t_item_2e814;
+	u64 t_object_2e796;
+	u64 t_object_2e812;
+	L_start_2e662:;
+	t_binding_2e666 = (u64)A0;
+	t_binding_2e673 = (u64)A1;
+	t_binding_2e761 = (u64)A2;
+	t_binding_2e795 = (u64)A3;
+	t_object_2e796 = (u64)A4;
+	t_object_2e812 = (u64)A5;
+	t__2e813 = (u64)A6;
+	L_body_2e663:;
+	t_item_2e668 = (u64)((u64)t_binding_2e666 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e668 = (u32)((u64)0UL);
+	t__2e669 = (u64)((u64)t_binding_2e666 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e669, (u64)t_item_2e668, (u64)((u64)124UL));
+	t_item_2e671 = (u64)((u64)t_binding_2e666 + (u64)((u64)0UL));
+	t__2e672 = (u64)(u32)(*(i32 *)t_item_2e671);
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)4UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)8UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)12UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)16UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)20UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)24UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)28UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)32UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)36UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)40UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)44UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)48UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)52UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)56UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)60UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)64UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)68UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)72UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)76UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)80UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)84UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)88UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)92UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)96UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)100UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)104UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)108UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)112UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)116UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)120UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e670 = (u64)((u64)t_binding_2e666 + (u64)((u64)124UL));
+	*(u32 *)t__2e670 = (u32)t__2e672;
+	t__2e674 = t_binding_2e666;
+	t__2e675 = (u64)((i64)(i32)((u64)0UL));
+	t__2e676 = (u64)((u64)t__2e675 - (u64)((u64)0UL));
+	t__2e680 = (u64)(u32)(((u64)t__2e675 <= (u64)((u64)32UL)));
+	t__2e676 = t__2e675;
+	t__2e677 = ((u64)32UL);
+	if ((u32)t__2e680) goto L__2e682; else goto L__2e681;
+	L__2e681:;
+	t_abortsite_2e684 = ((u64)0UL);
+	goto L_abort_2e685;
+	L__2e682:;
+	t_data_2e691 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e691 = (u64)((u64)t__2e674 + (u64)t_data_2e691);
+	*(u64 *)t_binding_2e673 = (u64)t_data_2e691;
+	t__2e692 = (u64)((u64)t_binding_2e673 + (u64)((u64)8UL));
+	*(u64 *)t__2e692 = (u64)t__2e676;
+	t__2e692 = (u64)((u64)t_binding_2e673 + (u64)((u64)16UL));
+	*(u64 *)t__2e692 = (u64)t__2e677;
+	t__2e693 = (u64)((u64)t_binding_2e673 + (u64)((u64)8UL));
+	t__2e694 = (u64)((u64)t_binding_2e673 + (u64)((u64)16UL));
+	t__2e695 = (u64)(*(u64 *)t__2e693);
+	t__2e696 = (u64)((u64)t__2e695 + (u64)((u64)1UL));
+	*(u64 *)t__2e693 = (u64)t__2e696;
+	t__2e698 = (u64)(*(u64 *)t__2e694);
+	t__2e701 = (u64)(u32)(((u64)t__2e696 <= (u64)t__2e698));
+	if ((u32)t__2e701) goto L__2e699; else goto L__2e700;
+	L__2e700:;
+	t_abortsite_2e684 = ((u64)1UL);
+	goto L_abort_2e685;
+	L__2e699:;
+	t__2e702 = (u64)(*(u64 *)t_binding_2e673);
+	t__2e697 = (u64)((u64)t__2e695 * (u64)((u64)4UL));
+	t__2e697 = (u64)((u64)t__2e702 + (u64)t__2e697);
+	t__2e703 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e697 = (u32)((u64)1UL);
+	t__2e704 = (u64)((u64)t_binding_2e673 + (u64)((u64)8UL));
+	t__2e705 = (u64)((u64)t_binding_2e673 + (u64)((u64)16UL));
+	t__2e706 = (u64)(*(u64 *)t__2e704);
+	t__2e707 = (u64)((u64)t__2e706 + (u64)((u64)1UL));
+	*(u64 *)t__2e704 = (u64)t__2e707;
+	t__2e709 = (u64)(*(u64 *)t__2e705);
+	t__2e712 = (u64)(u32)(((u64)t__2e707 <= (u64)t__2e709));
+	if ((u32)t__2e712) goto L__2e710; else goto L__2e711;
+	L__2e711:;
+	t_abortsite_2e684 = ((u64)2UL);
+	goto L_abort_2e685;
+	L__2e710:;
+	t__2e713 = (u64)(*(u64 *)t_binding_2e673);
+	t__2e708 = (u64)((u64)t__2e706 * (u64)((u64)4UL));
+	t__2e708 = (u64)((u64)t__2e713 + (u64)t__2e708);
+	t__2e714 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e708 = (u32)((u64)2UL);
+	t__2e715 = (u64)((u64)t_binding_2e673 + (u64)((u64)8UL));
+	t__2e716 = (u64)((u64)t_binding_2e673 + (u64)((u64)16UL));
+	t__2e717 = (u64)(*(u64 *)t__2e715);
+	t__2e718 = (u64)((u64)t__2e717 + (u64)((u64)1UL));
+	*(u64 *)t__2e715 = (u64)t__2e718;
+	t__2e720 = (u64)(*(u64 *)t__2e716);
+	t__2e723 = (u64)(u32)(((u64)t__2e718 <= (u64)t__2e720));
+	if ((u32)t__2e723) goto L__2e721; else goto L__2e722;
+	L__2e722:;
+	t_abortsite_2e684 = ((u64)3UL);
+	goto L_abort_2e685;
+	L__2e721:;
+	t__2e724 = (u64)(*(u64 *)t_binding_2e673);
+	t__2e719 = (u64)((u64)t__2e717 * (u64)((u64)4UL));
+	t__2e719 = (u64)((u64)t__2e724 + (u64)t__2e719);
+	t__2e725 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e719 = (u32)((u64)3UL);
+	t__2e729 = (u64)((u64)t_binding_2e673 + (u64)((u64)8UL));
+	t__2e730 = (u64)((u64)t_binding_2e673 + (u64)((u64)16UL));
+	t__2e731 = (u64)(*(u64 *)t__2e729);
+	t__2e728 = (u64)(u32)(((u64)t__2e731 == (u64)((u64)3UL)));
+	if ((u32)t__2e728) goto L_passed_2e727; else goto L_failed_2e726;
+	L_failed_2e726:;
+	t_abortsite_2e684 = ((u64)4UL);
+	goto L_abort_2e732;
+	L_passed_2e727:;
+	t__2e738 = (u64)((u64)t_binding_2e673 + (u64)((u64)8UL));
+	t__2e739 = (u64)((u64)t_binding_2e673 + (u64)((u64)16UL));
+	t__2e740 = (u64)(*(u64 *)t__2e738);
+	t__2e741 = (u64)((u64)t__2e740 + (u64)((u64)3UL));
+	*(u64 *)t__2e738 = (u64)t__2e741;
+	t__2e743 = (u64)(*(u64 *)t__2e739);
+	t__2e746 = (u64)(u32)(((u64)t__2e741 <= (u64)t__2e743));
+	if ((u32)t__2e746) goto L__2e744; else goto L__2e745;
+	L__2e745:;
+	t_abortsite_2e684 = ((u64)5UL);
+	goto L_abort_2e685;
+	L__2e744:;
+	t__2e747 = (u64)(*(u64 *)t_binding_2e673);
+	t__2e742 = (u64)((u64)t__2e740 * (u64)((u64)4UL));
+	t__2e742 = (u64)((u64)t__2e747 + (u64)t__2e742);
+	t__2e748 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t_item_2e749 = (u64)((u64)t__2e742 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e749 = (u32)((u64)4UL);
+	t_item_2e749 = (u64)((u64)t__2e742 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e749 = (u32)((u64)5UL);
+	t_item_2e749 = (u64)((u64)t__2e742 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e749 = (u32)((u64)6UL);
+	t__2e753 = (u64)((u64)t_binding_2e673 + (u64)((u64)8UL));
+	t__2e754 = (u64)((u64)t_binding_2e673 + (u64)((u64)16UL));
+	t__2e755 = (u64)(*(u64 *)t__2e753);
+	t__2e752 = (u64)(u32)(((u64)t__2e755 == (u64)((u64)6UL)));
+	if ((u32)t__2e752) goto L_passed_2e751; else goto L_failed_2e750;
+	L_failed_2e750:;
+	t_abortsite_2e684 = ((u64)6UL);
+	goto L_abort_2e732;
+	L_passed_2e751:;
+	*(u64 *)t_binding_2e761 = (u64)((u64)0UL);
+	L_loop_2e756:;
+	t__2e763 = (u64)(*(u64 *)t_binding_2e761);
+	t__2e764 = (u64)((u64)t_binding_2e673 + (u64)((u64)8UL));
+	t__2e765 = (u64)((u64)t_binding_2e673 + (u64)((u64)16UL));
+	t__2e766 = (u64)(*(u64 *)t__2e764);
+	t__2e762 = (u64)(u32)(((u64)t__2e763 < (u64)t__2e766));
+	if ((u32)t__2e762) goto L_body_2e757; else goto L__2e759;
+	L_body_2e757:;
+	t__2e773 = (u64)((u64)t_binding_2e673 + (u64)((u64)8UL));
+	t__2e774 = (u64)((u64)t_binding_2e673 + (u64)((u64)16UL));
+	t__2e775 = (u64)(*(u64 *)t_binding_2e673);
+	t__2e776 = (u64)(*(u64 *)t_binding_2e761);
+	t__2e772 = (u64)((u64)t__2e776 * (u64)((u64)4UL));
+	t__2e772 = (u64)((u64)t__2e775 + (u64)t__2e772);
+	t__2e777 = (u64)(u32)(*(i32 *)t__2e772);
+	t__2e779 = (u64)(*(u64 *)t_binding_2e761);
+	t__2e780 = (u64)(u32)t__2e779;
+	t__2e778 = (u64)(u32)((u32)t__2e780 + (u32)((u64)1UL));
+	t__2e771 = (u64)(u32)(((u32)t__2e777 == (u32)t__2e778));
+	if ((u32)t__2e771) goto L_passed_2e770; else goto L_failed_2e769;
+	L_failed_2e769:;
+	t_abortsite_2e684 = ((u64)7UL);
+	goto L_abort_2e732;
+	L_passed_2e770:;
+	t__2e785 = (u64)(*(u64 *)t_binding_2e761);
+	t__2e784 = (u64)((u64)t__2e785 * (u64)((u64)4UL));
+	t__2e784 = (u64)((u64)t_binding_2e666 + (u64)t__2e784);
+	t__2e786 = (u64)(u32)(((u64)t__2e785 < (u64)((u64)32UL)));
+	if ((u32)t__2e786) goto L__2e788; else goto L__2e787;
+	L__2e787:;
+	t_abortsite_2e684 = ((u64)8UL);
+	goto L_abort_2e685;
+	L__2e788:;
+	t__2e789 = (u64)(u32)(*(i32 *)t__2e784);
+	t__2e791 = (u64)(*(u64 *)t_binding_2e761);
+	t__2e792 = (u64)(u32)t__2e791;
+	t__2e790 = (u64)(u32)((u32)t__2e792 + (u32)((u64)1UL));
+	t__2e783 = (u64)(u32)(((u32)t__2e789 == (u32)t__2e790));
+	if ((u32)t__2e783) goto L_passed_2e782; else goto L_failed_2e781;
+	L_failed_2e781:;
+	t_abortsite_2e684 = ((u64)9UL);
+	goto L_abort_2e732;
+	L_passed_2e782:;
+	goto L__2e767;
+	L__2e793:;
+	L__2e767:;
+	L_after_2e760:;
+	t__2e794 = (u64)(*(u64 *)t_binding_2e761);
+	t__2e794 = (u64)((u64)t__2e794 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e761 = (u64)t__2e794;
+	goto L_loop_2e756;
+	L__2e759:;
+	t_item_2e797 = (u64)((u64)t_object_2e796 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e797 = (u32)((u64)1UL);
+	t_item_2e797 = (u64)((u64)t_object_2e796 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e797 = (u32)((u64)2UL);
+	t_item_2e797 = (u64)((u64)t_object_2e796 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e797 = (u32)((u64)3UL);
+	t__2e798 = t_object_2e796;
+	t__2e799 = (u64)((i64)(i32)((u64)0UL));
+	t__2e800 = (u64)((u64)t__2e799 - (u64)((u64)0UL));
+	t__2e804 = (u64)(u32)(((u64)t__2e799 <= (u64)((u64)3UL)));
+	t__2e800 = t__2e799;
+	t__2e801 = ((u64)3UL);
+	if ((u32)t__2e804) goto L__2e806; else goto L__2e805;
+	L__2e805:;
+	t_abortsite_2e684 = ((u64)10UL);
+	goto L_abort_2e685;
+	L__2e806:;
+	t_data_2e807 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e807 = (u64)((u64)t__2e798 + (u64)t_data_2e807);
+	*(u64 *)t_binding_2e795 = (u64)t_data_2e807;
+	t__2e808 = (u64)((u64)t_binding_2e795 + (u64)((u64)8UL));
+	*(u64 *)t__2e808 = (u64)t__2e800;
+	t__2e808 = (u64)((u64)t_binding_2e795 + (u64)((u64)16UL));
+	*(u64 *)t__2e808 = (u64)t__2e801;
+	t__2e809 = (u64)((u64)t_binding_2e795 + (u64)((u64)8UL));
+	t__2e810 = (u64)((u64)t_binding_2e795 + (u64)((u64)16UL));
+	t__2e811 = (u64)(*(u64 *)t__2e809);
+	t_item_2e814 = (u64)((u64)t__2e813 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e814 = (u32)((u64)1UL);
+	t_item_2e814 = (u64)((u64)t__2e813 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e814 = (u32)((u64)2UL);
+	t_item_2e814 = (u64)((u64)t__2e813 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e814 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e812 = (u64)t__2e813;
+	t__2e815 = (u64)((u64)t_object_2e812 + (u64)((u64)8UL));
+	*(u64 *)t__2e815 = (u64)((u64)3UL);
+	t__2e815 = (u64)((u64)t__2e815 + (u64)((u64)8UL));
+	*(u64 *)t__2e815 = (u64)((u64)3UL);
+	t__2e817 = (u64)((u64)t_object_2e812 + (u64)((u64)8UL));
+	t__2e816 = (u64)(*(u64 *)t__2e817);
+	t__2e818 = (u64)((u64)t__2e811 + (u64)t__2e816);
+	*(u64 *)t__2e809 = (u64)t__2e818;
+	t__2e820 = (u64)(*(u64 *)t__2e810);
+	t__2e823 = (u64)(u32)(((u64)t__2e818 <= (u64)t__2e820));
+	if ((u32)t__2e823) goto L__2e821; else goto L__2e822;
+	L__2e822:;
+	t_abortsite_2e684 = ((u64)11UL);
+	goto L_abort_2e685;
+	L__2e821:;
+	t__2e824 = (u64)(*(u64 *)t_binding_2e795);
+	t__2e819 = (u64)((u64)t__2e811 * (u64)((u64)4UL));
+	t__2e819 = (u64)((u64)t__2e824 + (u64)t__2e819);
+	t__2e825 = (u64)((u64)t__2e816 * (u64)((u64)4UL));
+	t__2e826 = (u64)(*(u64 *)t_object_2e812);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e819, (u64)t__2e826, (u64)t__2e825);
+	t__2e830 = (u64)((u64)t_binding_2e795 + (u64)((u64)8UL));
+	t__2e831 = (u64)((u64)t_binding_2e795 + (u64)((u64)16UL));
+	t__2e832 = (u64)(*(u64 *)t__2e830);
+	t__2e829 = (u64)(u32)(((u64)t__2e832 == (u64)((u64)3UL)));
+	if ((u32)t__2e829) goto L_passed_2e828; else goto L_failed_2e827;
+	L_failed_2e827:;
+	t_abortsite_2e684 = ((u64)12UL);
+	goto L_abort_2e732;
+	L_passed_2e828:;
+	goto L__2e664;
+	L__2e833:;
+	L__2e664:;
+	return;
+	L_abort_2e685:;
+	t__2e686 = (u64)((u64)t_abortsite_2e684 * (u64)((u64)16UL));
+	t__2e686 = (u64)((u64)((u64)((char *)&D_abortsites_2e683)) + (u64)t__2e686);
+	t__2e687 = (u64)(*(u64 *)t__2e686);
+	t__2e688 = (u64)((u64)t__2e686 + (u64)((u64)8UL));
+	t__2e689 = (u64)(*(u32 *)t__2e688);
+	t__2e688 = (u64)((u64)t__2e686 + (u64)((u64)12UL));
+	t__2e690 = (u64)(*(u32 *)t__2e688);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e687, (u64)t__2e689, (u64)t__2e690, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e732:;
+	t__2e733 = (u64)((u64)t_abortsite_2e684 * (u64)((u64)16UL));
+	t__2e733 = (u64)((u64)((u64)((char *)&D_abortsites_2e683)) + (u64)t__2e733);
+	t__2e734 = (u64)(*(u64 *)t__2e733);
+	t__2e735 = (u64)((u64)t__2e733 + (u64)((u64)8UL));
+	t__2e736 = (u64)(*(u32 *)t__2e735);
+	t__2e735 = (u64)((u64)t__2e733 + (u64)((u64)12UL));
+	t__2e737 = (u64)(*(u32 *)t__2e735);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e734, (u64)t__2e736, (u64)t__2e737, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_multi(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[12] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[12] __attribute__((aligned(16)));
+	u64 t__2e839;
+	u64 t__2e840;
+	u64 t__2e841;
+	u64 t__2e842;
+	u64 t__2e843;
+	u64 t__2e844;
+	u64 t__2e845;
+	u64 t__2e848;
+	u64 t__2e849;
+	u64 t__2e850;
+	u64 t__2e854;
+	u64 t__2e855;
+	u64 t__2e856;
+	u64 t__2e857;
+	u64 t__2e861;
+	u64 t__2e862;
+	u64 t__2e863;
+	u64 t__2e864;
+	u64 t__2e865;
+	u64 t__2e869;
+	u64 t__2e870;
+	u64 t__2e871;
+	u64 t__2e872;
+	u64 t__2e873;
+	u64 t__2e874;
+	u64 t__2e875;
+	u64 t__2e876;
+	u64 t__2e877;
+	u64 t__2e880;
+	u64 t__2e881;
+	u64 t__2e882;
+	u64 t__2e883;
+	u64 t__2e886;
+	u64 t__2e887;
+	u64 t__2e888;
+	u64 t__2e889;
+	u64 t__2e896;
+	u64 t__2e897;
+	u64 t__2e898;
+	u64 t__2e899;
+	u64 t__2e900;
+	u64 t__2e905;
+	u64 t__2e906;
+	u64 t__2e907;
+	u64 t__2e908;
+	u64 t__2e909;
+	u64 t__2e910;
+	u64 t__2e911;
+	u64 t__2e912;
+	u64 t__2e913;
+	u64 t__2e914;
+	u64 t__2e916;
+	u64 t__2e917;
+	u64 t__2e919;
+	u64 t__2e923;
+	u64 t__2e924;
+	u64 t__2e925;
+	u64 t__2e926;
+	u64 t__2e927;
+	u64 t__2e928;
+	u64 t__2e931;
+	u64 t__2e934;
+	u64 t__2e935;
+	u64 t__2e936;
+	u64 t__2e937;
+	u64 t__2e938;
+	u64 t__2e939;
+	u64 t__2e941;
+	u64 t__2e942;
+	u64 t__2e943;
+	u64 t__2e945;
+	u64 t__2e947;
+	u64 t__2e948;
+	u64 t__2e949;
+	u64 t__2e950;
+	u64 t__2e951;
+	u64 t__2e952;
+	u64 t__2e955;
+	u64 t__2e956;
+	u64 t__2e957;
+	u64 t__2e958;
+	u64 t__2e961;
+	u64 t__2e962;
+	u64 t__2e963;
+	u64 t__2e964;
+	u64 t__2e965;
+	u64 t_abortsite_2e859;
+	u64 t_binding_2e838;
+	u64 t_binding_2e866;
+	u64 t_binding_2e895;
+	u64 t_binding_2e918;
+	u64 t_item_2e851;
+	u64 t_item_2e868;
+	u64 t_item_2e946;
+	u64 t_object_2e867;
+	u64 t_object_2e944;
+	L_start_2e834:;
+	t_binding_2e838 = (u64)A0;
+	t_binding_2e866 = (u64)A1;
+	t_object_2e867 = (u64)A2;
+	t_binding_2e895 = (u64)A3;
+	t_binding_2e918 = (u64)A4;
+	t_object_2e944 = (u64)A5;
+	t__2e945 = (u64)A6;
+	L_body_2e835:;
+	*(u64 *)t_binding_2e838 = (u64)((u64)0UL);
+	t__2e839 = (u64)((u64)t_binding_2e838 + (u64)((u64)8UL));
+	*(u64 *)t__2e839 = (u64)((u64)0UL);
+	t__2e839 = (u64)((u64)t__2e839 + (u64)((u64)8UL));
+	*(u64 *)t__2e839 = (u64)((u64)0UL);
+	t__2e840 = (u64)((u64)t_binding_2e838 + (u64)((u64)8UL));
+	t__2e841 = (u64)((u64)t_binding_2e838 + (u64)((u64)16UL));
+	t__2e842 = (u64)(*(u64 *)t__2e840);
+	t__2e843 = (u64)((u64)t__2e842 + (u64)((u64)3UL));
+	*(u64 *)t__2e840 = (u64)t__2e843;
+	t__2e845 = (u64)(*(u64 *)t__2e841);
+	t__2e848 = (u64)(u32)(((u64)t__2e843 <= (u64)t__2e845));
+	if ((u32)t__2e848) goto L__2e846; else goto L__2e847;
+	L__2e847:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e838, (u64)((u64)4UL));
+	goto L__2e846;
+	L__2e846:;
+	t__2e849 = (u64)(*(u64 *)t_binding_2e838);
+	t__2e844 = (u64)((u64)t__2e842 * (u64)((u64)4UL));
+	t__2e844 = (u64)((u64)t__2e849 + (u64)t__2e844);
+	t__2e850 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t_item_2e851 = (u64)((u64)t__2e844 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e851 = (u32)((u64)1UL);
+	t_item_2e851 = (u64)((u64)t__2e844 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e851 = (u32)((u64)2UL);
+	t_item_2e851 = (u64)((u64)t__2e844 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e851 = (u32)((u64)3UL);
+	t__2e855 = (u64)((u64)t_binding_2e838 + (u64)((u64)8UL));
+	t__2e856 = (u64)((u64)t_binding_2e838 + (u64)((u64)16UL));
+	t__2e857 = (u64)(*(u64 *)t__2e855);
+	t__2e854 = (u64)(u32)(((u64)t__2e857 == (u64)((u64)3UL)));
+	if ((u32)t__2e854) goto L_passed_2e853; else goto L_failed_2e852;
+	L_failed_2e852:;
+	t_abortsite_2e859 = ((u64)0UL);
+	goto L_abort_2e860;
+	L_passed_2e853:;
+	t_item_2e868 = (u64)((u64)t_object_2e867 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e868 = (u32)((u64)4UL);
+	t_item_2e868 = (u64)((u64)t_object_2e867 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e868 = (u32)((u64)5UL);
+	t_item_2e868 = (u64)((u64)t_object_2e867 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e868 = (u32)((u64)6UL);
+	*(u64 *)t_binding_2e866 = (u64)t_object_2e867;
+	t__2e869 = (u64)((u64)t_binding_2e866 + (u64)((u64)8UL));
+	*(u64 *)t__2e869 = (u64)((u64)3UL);
+	t__2e869 = (u64)((u64)t__2e869 + (u64)((u64)8UL));
+	*(u64 *)t__2e869 = (u64)((u64)3UL);
+	t__2e870 = (u64)((u64)t_binding_2e838 + (u64)((u64)8UL));
+	t__2e871 = (u64)((u64)t_binding_2e838 + (u64)((u64)16UL));
+	t__2e872 = (u64)(*(u64 *)t__2e870);
+	t__2e874 = (u64)((u64)t_binding_2e866 + (u64)((u64)8UL));
+	t__2e873 = (u64)(*(u64 *)t__2e874);
+	t__2e875 = (u64)((u64)t__2e872 + (u64)t__2e873);
+	*(u64 *)t__2e870 = (u64)t__2e875;
+	t__2e877 = (u64)(*(u64 *)t__2e871);
+	t__2e880 = (u64)(u32)(((u64)t__2e875 <= (u64)t__2e877));
+	if ((u32)t__2e880) goto L__2e878; else goto L__2e879;
+	L__2e879:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e838, (u64)((u64)4UL));
+	goto L__2e878;
+	L__2e878:;
+	t__2e881 = (u64)(*(u64 *)t_binding_2e838);
+	t__2e876 = (u64)((u64)t__2e872 * (u64)((u64)4UL));
+	t__2e876 = (u64)((u64)t__2e881 + (u64)t__2e876);
+	t__2e882 = (u64)((u64)t__2e873 * (u64)((u64)4UL));
+	t__2e883 = (u64)(*(u64 *)t_binding_2e866);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e876, (u64)t__2e883, (u64)t__2e882);
+	t__2e887 = (u64)((u64)t_binding_2e838 + (u64)((u64)8UL));
+	t__2e888 = (u64)((u64)t_binding_2e838 + (u64)((u64)16UL));
+	t__2e889 = (u64)(*(u64 *)t__2e887);
+	t__2e886 = (u64)(u32)(((u64)t__2e889 == (u64)((u64)6UL)));
+	if ((u32)t__2e886) goto L_passed_2e885; else goto L_failed_2e884;
+	L_failed_2e884:;
+	t_abortsite_2e859 = ((u64)1UL);
+	goto L_abort_2e860;
+	L_passed_2e885:;
+	*(u64 *)t_binding_2e895 = (u64)((u64)0UL);
+	L_loop_2e890:;
+	t__2e897 = (u64)(*(u64 *)t_binding_2e895);
+	t__2e898 = (u64)((u64)t_binding_2e838 + (u64)((u64)8UL));
+	t__2e899 = (u64)((u64)t_binding_2e838 + (u64)((u64)16UL));
+	t__2e900 = (u64)(*(u64 *)t__2e898);
+	t__2e896 = (u64)(u32)(((u64)t__2e897 < (u64)t__2e900));
+	if ((u32)t__2e896) goto L_body_2e891; else goto L__2e893;
+	L_body_2e891:;
+	t__2e907 = (u64)((u64)t_binding_2e838 + (u64)((u64)8UL));
+	t__2e908 = (u64)((u64)t_binding_2e838 + (u64)((u64)16UL));
+	t__2e909 = (u64)(*(u64 *)t_binding_2e838);
+	t__2e910 = (u64)(*(u64 *)t_binding_2e895);
+	t__2e906 = (u64)((u64)t__2e910 * (u64)((u64)4UL));
+	t__2e906 = (u64)((u64)t__2e909 + (u64)t__2e906);
+	t__2e911 = (u64)(u32)(*(i32 *)t__2e906);
+	t__2e913 = (u64)(*(u64 *)t_binding_2e895);
+	t__2e914 = (u64)(u32)t__2e913;
+	t__2e912 = (u64)(u32)((u32)t__2e914 + (u32)((u64)1UL));
+	t__2e905 = (u64)(u32)(((u32)t__2e911 == (u32)t__2e912));
+	if ((u32)t__2e905) goto L_passed_2e904; else goto L_failed_2e903;
+	L_failed_2e903:;
+	t_abortsite_2e859 = ((u64)2UL);
+	goto L_abort_2e860;
+	L_passed_2e904:;
+	goto L__2e901;
+	L__2e915:;
+	L__2e901:;
+	L_after_2e894:;
+	t__2e916 = (u64)(*(u64 *)t_binding_2e895);
+	t__2e916 = (u64)((u64)t__2e916 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e895 = (u64)t__2e916;
+	goto L_loop_2e890;
+	L__2e893:;
+	t__2e917 = (u64)(*(u64 *)t_binding_2e838);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e917);
+	t__2e919 = (u64)(u32)(((u64)((u64)0UL) <= (u64)((u64)3UL)));
+	if ((u32)t__2e919) goto L__2e920; else goto L__2e921;
+	L__2e921:;
+	t_abortsite_2e859 = ((u64)3UL);
+	goto L_abort_2e922;
+	L__2e920:;
+	t__2e928 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t__2e931 = ((u64)0UL);
+	t__2e919 = (u64)(u32)(((u64)t__2e928 != (u64)((u64)0UL)));
+	if ((u32)t__2e919) goto L__2e930; else goto L__2e929;
+	L__2e930:;
+	t__2e931 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)t__2e928));
+	t__2e919 = (u64)(u32)(((u64)t__2e931 != (u64)((u64)0UL)));
+	if ((u32)t__2e919) goto L__2e929; else goto L__2e932;
+	L__2e932:;
+	t_abortsite_2e859 = ((u64)4UL);
+	goto L_abort_2e933;
+	L__2e929:;
+	*(u64 *)t_binding_2e918 = (u64)t__2e931;
+	t__2e939 = (u64)((u64)t_binding_2e918 + (u64)((u64)8UL));
+	*(u64 *)t__2e939 = (u64)((u64)0UL);
+	t__2e939 = (u64)((u64)t_binding_2e918 + (u64)((u64)16UL));
+	*(u64 *)t__2e939 = (u64)((u64)3UL);
+	t__2e941 = (u64)((u64)t_binding_2e918 + (u64)((u64)8UL));
+	t__2e942 = (u64)((u64)t_binding_2e918 + (u64)((u64)16UL));
+	t__2e943 = (u64)(*(u64 *)t__2e941);
+	t_item_2e946 = (u64)((u64)t__2e945 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e946 = (u32)((u64)1UL);
+	t_item_2e946 = (u64)((u64)t__2e945 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e946 = (u32)((u64)2UL);
+	t_item_2e946 = (u64)((u64)t__2e945 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e946 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e944 = (u64)t__2e945;
+	t__2e947 = (u64)((u64)t_object_2e944 + (u64)((u64)8UL));
+	*(u64 *)t__2e947 = (u64)((u64)3UL);
+	t__2e947 = (u64)((u64)t__2e947 + (u64)((u64)8UL));
+	*(u64 *)t__2e947 = (u64)((u64)3UL);
+	t__2e949 = (u64)((u64)t_object_2e944 + (u64)((u64)8UL));
+	t__2e948 = (u64)(*(u64 *)t__2e949);
+	t__2e950 = (u64)((u64)t__2e943 + (u64)t__2e948);
+	*(u64 *)t__2e941 = (u64)t__2e950;
+	t__2e952 = (u64)(*(u64 *)t__2e942);
+	t__2e955 = (u64)(u32)(((u64)t__2e950 <= (u64)t__2e952));
+	if ((u32)t__2e955) goto L__2e953; else goto L__2e954;
+	L__2e954:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e918, (u64)((u64)4UL));
+	goto L__2e953;
+	L__2e953:;
+	t__2e956 = (u64)(*(u64 *)t_binding_2e918);
+	t__2e951 = (u64)((u64)t__2e943 * (u64)((u64)4UL));
+	t__2e951 = (u64)((u64)t__2e956 + (u64)t__2e951);
+	t__2e957 = (u64)((u64)t__2e948 * (u64)((u64)4UL));
+	t__2e958 = (u64)(*(u64 *)t_object_2e944);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e951, (u64)t__2e958, (u64)t__2e957);
+	t__2e962 = (u64)((u64)t_binding_2e918 + (u64)((u64)8UL));
+	t__2e963 = (u64)((u64)t_binding_2e918 + (u64)((u64)16UL));
+	t__2e964 = (u64)(*(u64 *)t__2e962);
+	t__2e961 = (u64)(u32)(((u64)t__2e964 == (u64)((u64)3UL)));
+	if ((u32)t__2e961) goto L_passed_2e960; else goto L_failed_2e959;
+	L_failed_2e959:;
+	t_abortsite_2e859 = ((u64)5UL);
+	goto L_abort_2e860;
+	L_passed_2e960:;
+	t__2e965 = (u64)(*(u64 *)t_binding_2e918);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e965);
+	goto L__2e836;
+	L__2e966:;
+	L__2e836:;
+	return;
+	L_abort_2e860:;
+	t__2e861 = (u64)((u64)t_abortsite_2e859 * (u64)((u64)16UL));
+	t__2e861 = (u64)((u64)((u64)((char *)&D_abortsites_2e858)) + (u64)t__2e861);
+	t__2e862 = (u64)(*(u64 *)t__2e861);
+	t__2e863 = (u64)((u64)t__2e861 + (u64)((u64)8UL));
+	t__2e864 = (u64)(*(u32 *)t__2e863);
+	t__2e863 = (u64)((u64)t__2e861 + (u64)((u64)12UL));
+	t__2e865 = (u64)(*(u32 *)t__2e863);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e862, (u64)t__2e864, (u64)t__2e865, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e922:;
+	t__2e923 = (u64)((u64)t_abortsite_2e859 * (u64)((u64)16UL));
+	t__2e923 = (u64)((u64)((u64)((char *)&D_abortsites_2e858)) + (u64)t__2e923);
+	t__2e924 = (u64)(*(u64 *)t__2e923);
+	t__2e925 = (u64)((u64)t__2e923 + (u64)((u64)8UL));
+	t__2e926 = (u64)(*(u32 *)t__2e925);
+	t__2e925 = (u64)((u64)t__2e923 + (u64)((u64)12UL));
+	t__2e927 = (u64)(*(u32 *)t__2e925);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e924, (u64)t__2e926, (u64)t__2e927, (u64)((u64)5UL));
+	__builtin_trap();
+	L_abort_2e933:;
+	t__2e934 = (u64)((u64)t_abortsite_2e859 * (u64)((u64)16UL));
+	t__2e934 = (u64)((u64)((u64)((char *)&D_abortsites_2e858)) + (u64)t__2e934);
+	t__2e935 = (u64)(*(u64 *)t__2e934);
+	t__2e936 = (u64)((u64)t__2e934 + (u64)((u64)8UL));
+	t__2e937 = (u64)(*(u32 *)t__2e936);
+	t__2e936 = (u64)((u64)t__2e934 + (u64)((u64)12UL));
+	t__2e938 = (u64)(*(u32 *)t__2e936);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e935, (u64)t__2e937, (u64)t__2e938, (u64)((u64)2UL));
+	__builtin_trap();
+}
+static void F_basics(void) {
+	char A0[24] __attribute__((aligned(16)));
+	u64 t__2e1000;
+	u64 t__2e1003;
+	u64 t__2e1004;
+	u64 t__2e1005;
+	u64 t__2e1008;
+	u64 t__2e1009;
+	u64 t__2e1010;
+	u64 t__2e1011;
+	u64 t__2e1015;
+	u64 t__2e1016;
+	u64 t__2e1017;
+	u64 t__2e1018;
+	u64 t__2e1019;
+	u64 t__2e1022;
+	u64 t__2e1025;
+	u64 t__2e1028;
+	u64 t__2e1029;
+	u64 t__2e1030;
+	u64 t__2e1031;
+	u64 t__2e1032;
+	u64 t__2e1033;
+	u64 t__2e1034;
+	u64 t__2e1035;
+	u64 t__2e1039;
+	u64 t__2e1040;
+	u64 t__2e1041;
+	u64 t__2e1042;
+	u64 t__2e1043;
+	u64 t__2e1044;
+	u64 t__2e1045;
+	u64 t__2e1046;
+	u64 t__2e1047;
+	u64 t__2e1048;
+	u64 t__2e1049;
+	u64 t__2e1050;
+	u64 t__2e1051;
+	u64 t__2e1052;
+	u64 t__2e1055;
+	u64 t__2e1056;
+	u64 t__2e1057;
+	u64 t__2e1058;
+	u64 t__2e1059;
+	u64 t__2e1060;
+	u64 t__2e1061;
+	u64 t__2e1062;
+	u64 t__2e1063;
+	u64 t__2e1066;
+	u64 t__2e1067;
+	u64 t__2e972;
+	u64 t__2e973;
+	u64 t__2e974;
+	u64 t__2e975;
+	u64 t__2e976;
+	u64 t__2e977;
+	u64 t__2e978;
+	u64 t__2e981;
+	u64 t__2e982;
+	u64 t__2e983;
+	u64 t__2e984;
+	u64 t__2e985;
+	u64 t__2e986;
+	u64 t__2e987;
+	u64 t__2e988;
+	u64 t__2e989;
+	u64 t__2e992;
+	u64 t__2e993;
+	u64 t__2e994;
+	u64 t__2e995;
+	u64 t__2e996;
+	u64 t__2e997;
+	u64 t__2e998;
+	u64 t__2e999;
+	u64 t_abortsite_2e1013;
+	u64 t_binding_2e971;
+	L_start_2e967:;
+	t_binding_2e971 = (u64)A0;
+	L_body_2e968:;
+	*(u64 *)t_binding_2e971 = (u64)((u64)0UL);
+	t__2e972 = (u64)((u64)t_binding_2e971 + (u64)((u64)8UL));
+	*(u64 *)t__2e972 = (u64)((u64)0UL);
+	t__2e972 = (u64)((u64)t__2e972 + (u64)((u64)8UL));
+	*(u64 *)t__2e972 = (u64)((u64)0UL);
+	t__2e973 = (u64)((u64)t_binding_2e971 + (u64)((u64)8UL));
+	t__2e974 = (u64)((u64)t_binding_2e971 + (u64)((u64)16UL));
+	t__2e975 = (u64)(*(u64 *)t__2e973);
+	t__2e976 = (u64)((u64)t__2e975 + (u64)((u64)1UL));
+	*(u64 *)t__2e973 = (u64)t__2e976;
+	t__2e978 = (u64)(*(u64 *)t__2e974);
+	t__2e981 = (u64)(u32)(((u64)t__2e976 <= (u64)t__2e978));
+	if ((u32)t__2e981) goto L__2e979; else goto L__2e980;
+	L__2e980:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e971, (u64)((u64)4UL));
+	goto L__2e979;
+	L__2e979:;
+	t__2e982 = (u64)(*(u64 *)t_binding_2e971);
+	t__2e977 = (u64)((u64)t__2e975 * (u64)((u64)4UL));
+	t__2e977 = (u64)((u64)t__2e982 + (u64)t__2e977);
+	t__2e983 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e977 = (u32)((u64)1UL);
+	t__2e984 = (u64)((u64)t_binding_2e971 + (u64)((u64)8UL));
+	t__2e985 = (u64)((u64)t_binding_2e971 + (u64)((u64)16UL));
+	t__2e986 = (u64)(*(u64 *)t__2e984);
+	t__2e987 = (u64)((u64)t__2e986 + (u64)((u64)1UL));
+	*(u64 *)t__2e984 = (u64)t__2e987;
+	t__2e989 = (u64)(*(u64 *)t__2e985);
+	t__2e992 = (u64)(u32)(((u64)t__2e987 <= (u64)t__2e989));
+	if ((u32)t__2e992) goto L__2e990; else goto L__2e991;
+	L__2e991:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e971, (u64)((u64)4UL));
+	goto L__2e990;
+	L__2e990:;
+	t__2e993 = (u64)(*(u64 *)t_binding_2e971);
+	t__2e988 = (u64)((u64)t__2e986 * (u64)((u64)4UL));
+	t__2e988 = (u64)((u64)t__2e993 + (u64)t__2e988);
+	t__2e994 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e988 = (u32)((u64)2UL);
+	t__2e995 = (u64)((u64)t_binding_2e971 + (u64)((u64)8UL));
+	t__2e996 = (u64)((u64)t_binding_2e971 + (u64)((u64)16UL));
+	t__2e997 = (u64)(*(u64 *)t__2e995);
+	t__2e998 = (u64)((u64)t__2e997 + (u64)((u64)1UL));
+	*(u64 *)t__2e995 = (u64)t__2e998;
+	t__2e1000 = (u64)(*(u64 *)t__2e996);
+	t__2e1003 = (u64)(u32)(((u64)t__2e998 <= (u64)t__2e1000));
+	if ((u32)t__2e1003) goto L__2e1001; else goto L__2e1002;
+	L__2e1002:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e971, (u64)((u64)4UL));
+	goto L__2e1001;
+	L__2e1001:;
+	t__2e1004 = (u64)(*(u64 *)t_binding_2e971);
+	t__2e999 = (u64)((u64)t__2e997 * (u64)((u64)4UL));
+	t__2e999 = (u64)((u64)t__2e1004 + (u64)t__2e999);
+	t__2e1005 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	*(u32 *)t__2e999 = (u32)((u64)3UL);
+	t__2e1009 = (u64)((u64)t_binding_2e971 + (u64)((u64)8UL));
+	t__2e1010 = (u64)((u64)t_binding_2e971 + (u64)((u64)16UL));
+	t__2e1011 = (u64)(*(u64 *)t__2e1009);
+	t__2e1008 = (u64)(u32)(((u64)t__2e1011 == (u64)((u64)3UL)));
+	if ((u32)t__2e1008) goto L_passed_2e1007; else goto L_failed_2e1006;
+	L_failed_2e1006:;
+	t_abortsite_2e1013 = ((u64)0UL);
+	goto L_abort_2e1014;
+	L_passed_2e1007:;
+	t__2e1030 = (u64)((u64)t_binding_2e971 + (u64)((u64)8UL));
+	t__2e1031 = (u64)((u64)t_binding_2e971 + (u64)((u64)16UL));
+	t__2e1032 = (u64)(*(u64 *)t_binding_2e971);
+	t__2e1033 = (u64)(*(u64 *)t__2e1030);
+	t__2e1034 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1029 = (u64)((u64)t__2e1034 * (u64)((u64)4UL));
+	t__2e1029 = (u64)((u64)t__2e1032 + (u64)t__2e1029);
+	t__2e1035 = (u64)(u32)(((u64)t__2e1034 < (u64)t__2e1033));
+	if ((u32)t__2e1035) goto L__2e1037; else goto L__2e1036;
+	L__2e1036:;
+	t_abortsite_2e1013 = ((u64)1UL);
+	goto L_abort_2e1038;
+	L__2e1037:;
+	t__2e1044 = (u64)(u32)(*(i32 *)t__2e1029);
+	t__2e1028 = (u64)(u32)(((u32)t__2e1044 == (u32)((u64)1UL)));
+	t__2e1025 = (u64)(u32)t__2e1028;
+	if ((u32)t__2e1025) goto L__2e1026; else goto L__2e1027;
+	L__2e1026:;
+	t__2e1047 = (u64)((u64)t_binding_2e971 + (u64)((u64)8UL));
+	t__2e1048 = (u64)((u64)t_binding_2e971 + (u64)((u64)16UL));
+	t__2e1049 = (u64)(*(u64 *)t_binding_2e971);
+	t__2e1050 = (u64)(*(u64 *)t__2e1047);
+	t__2e1051 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1046 = (u64)((u64)t__2e1051 * (u64)((u64)4UL));
+	t__2e1046 = (u64)((u64)t__2e1049 + (u64)t__2e1046);
+	t__2e1052 = (u64)(u32)(((u64)t__2e1051 < (u64)t__2e1050));
+	if ((u32)t__2e1052) goto L__2e1054; else goto L__2e1053;
+	L__2e1053:;
+	t_abortsite_2e1013 = ((u64)2UL);
+	goto L_abort_2e1038;
+	L__2e1054:;
+	t__2e1055 = (u64)(u32)(*(i32 *)t__2e1046);
+	t__2e1045 = (u64)(u32)(((u32)t__2e1055 == (u32)((u64)2UL)));
+	t__2e1025 = (u64)(u32)t__2e1045;
+	goto L__2e1027;
+	L__2e1027:;
+	t__2e1022 = (u64)(u32)t__2e1025;
+	if ((u32)t__2e1022) goto L__2e1023; else goto L__2e1024;
+	L__2e1023:;
+	t__2e1058 = (u64)((u64)t_binding_2e971 + (u64)((u64)8UL));
+	t__2e1059 = (u64)((u64)t_binding_2e971 + (u64)((u64)16UL));
+	t__2e1060 = (u64)(*(u64 *)t_binding_2e971);
+	t__2e1061 = (u64)(*(u64 *)t__2e1058);
+	t__2e1062 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1057 = (u64)((u64)t__2e1062 * (u64)((u64)4UL));
+	t__2e1057 = (u64)((u64)t__2e1060 + (u64)t__2e1057);
+	t__2e1063 = (u64)(u32)(((u64)t__2e1062 < (u64)t__2e1061));
+	if ((u32)t__2e1063) goto L__2e1065; else goto L__2e1064;
+	L__2e1064:;
+	t_abortsite_2e1013 = ((u64)3UL);
+	goto L_abort_2e1038;
+	L__2e1065:;
+	t__2e1066 = (u64)(u32)(*(i32 *)t__2e1057);
+	t__2e1056 = (u64)(u32)(((u32)t__2e1066 == (u32)((u64)3UL)));
+	t__2e1022 = (u64)(u32)t__2e1056;
+	goto L__2e1024;
+	L__2e1024:;
+	if ((u32)t__2e1022) goto L_passed_2e1021; else goto L_failed_2e1020;
+	L_failed_2e1020:;
+	t_abortsite_2e1013 = ((u64)4UL);
+	goto L_abort_2e1014;
+	L_passed_2e1021:;
+	t__2e1067 = (u64)(*(u64 *)t_binding_2e971);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e1067);
+	goto L__2e969;
+	L__2e1068:;
+	L__2e969:;
+	return;
+	L_abort_2e1014:;
+	t__2e1015 = (u64)((u64)t_abortsite_2e1013 * (u64)((u64)16UL));
+	t__2e1015 = (u64)((u64)((u64)((char *)&D_abortsites_2e1012)) + (u64)t__2e1015);
+	t__2e1016 = (u64)(*(u64 *)t__2e1015);
+	t__2e1017 = (u64)((u64)t__2e1015 + (u64)((u64)8UL));
+	t__2e1018 = (u64)(*(u32 *)t__2e1017);
+	t__2e1017 = (u64)((u64)t__2e1015 + (u64)((u64)12UL));
+	t__2e1019 = (u64)(*(u32 *)t__2e1017);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1016, (u64)t__2e1018, (u64)t__2e1019, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1038:;
+	t__2e1039 = (u64)((u64)t_abortsite_2e1013 * (u64)((u64)16UL));
+	t__2e1039 = (u64)((u64)((u64)((char *)&D_abortsites_2e1012)) + (u64)t__2e1039);
+	t__2e1040 = (u64)(*(u64 *)t__2e1039);
+	t__2e1041 = (u64)((u64)t__2e1039 + (u64)((u64)8UL));
+	t__2e1042 = (u64)(*(u32 *)t__2e1041);
+	t__2e1041 = (u64)((u64)t__2e1039 + (u64)((u64)12UL));
+	t__2e1043 = (u64)(*(u32 *)t__2e1041);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1040, (u64)t__2e1042, (u64)t__2e1043, (u64)((u64)0UL));
+	__builtin_trap();
+}
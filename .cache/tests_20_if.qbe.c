@@ -0,0 +1,846 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort[] __asm__("rt.abort");
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2eexit[] __asm__("rt.exit");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e23 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e48 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e49 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e80 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e137 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e165 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e204 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e225 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e246 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e267 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e293 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e320 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e341 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e362 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e383 { char *f0; u32 f1; u32 f2; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e23 D_abortsites_2e23 __asm__("abortsites.23") __attribute__((used, section(".data.rel.ro.abortsites.23"), aligned(8)));
+static const struct S_strdata_2e48 D_strdata_2e48 __asm__("strdata.48") __attribute__((used, section(".rodata.strdata.48"), aligned(8)));
+static struct S_strliteral_2e49 D_strliteral_2e49 __asm__("strliteral.49") __attribute__((used, section(".data.rel.ro.strliteral.49"), aligned(8)));
+static struct S_abortsites_2e80 D_abortsites_2e80 __asm__("abortsites.80") __attribute__((used, section(".data.rel.ro.abortsites.80"), aligned(8)));
+static struct S_abortsites_2e137 D_abortsites_2e137 __asm__("abortsites.137") __attribute__((used, section(".data.rel.ro.abortsites.137"), aligned(8)));
+static struct S_abortsites_2e165 D_abortsites_2e165 __asm__("abortsites.165") __attribute__((used, section(".data.rel.ro.abortsites.165"), aligned(8)));
+static struct S_abortsites_2e204 D_abortsites_2e204 __asm__("abortsites.204") __attribute__((used, section(".data.rel.ro.abortsites.204"), aligned(8)));
+static struct S_abortsites_2e225 D_abortsites_2e225 __asm__("abortsites.225") __attribute__((used, section(".data.rel.ro.abortsites.225"), aligned(8)));
+static struct S_abortsites_2e246 D_abortsites_2e246 __asm__("abortsites.246") __attribute__((used, section(".data.rel.ro.abortsites.246"), aligned(8)));
+static struct S_abortsites_2e267 D_abortsites_2e267 __asm__("abortsites.267") __attribute__((used, section(".data.rel.ro.abortsites.267"), aligned(8)));
+static struct S_abortsites_2e293 D_abortsites_2e293 __asm__("abortsites.293") __attribute__((used, section(".data.rel.ro.abortsites.293"), aligned(8)));
+static struct S_abortsites_2e320 D_abortsites_2e320 __asm__("abortsites.320") __attribute__((used, section(".data.rel.ro.abortsites.320"), aligned(8)));
+static struct S_abortsites_2e341 D_abortsites_2e341 __asm__("abortsites.341") __attribute__((used, section(".data.rel.ro.abortsites.341"), aligned(8)));
+static struct S_abortsites_2e362 D_abortsites_2e362 __asm__("abortsites.362") __attribute__((used, section(".data.rel.ro.abortsites.362"), aligned(8)));
+static struct S_abortsites_2e383 D_abortsites_2e383 __asm__("abortsites.383") __attribute__((used, section(".data.rel.ro.abortsites.383"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F___never(void) __asm__("_never") __attribute__((used, section(".text._never")));
+static void F_alias(void) __asm__("alias") __attribute__((used, section(".text.alias")));
+static void F_tagged(void) __asm__("tagged") __attribute__((used, section(".text.tagged")));
+static void F_or(void) __asm__("or") __attribute__((used, section(".text.or")));
+static void F_and(void) __asm__("and") __attribute__((used, section(".text.and")));
+static u32 F_and2(u32 p_left) __asm__("and2") __attribute__((used, section(".text.and2")));
+static void F_lte(void) __asm__("lte") __attribute__((used, section(".text.lte")));
+static void F_lt(void) __asm__("lt") __attribute__((used, section(".text.lt")));
+static void F_gte(void) __asm__("gte") __attribute__((used, section(".text.gte")));
+static void F_gt(void) __asm__("gt") __attribute__((used, section(".text.gt")));
+static void F_justif(void) __asm__("justif") __attribute__((used, section(".text.justif")));
+static void F_elseif(void) __asm__("elseif") __attribute__((used, section(".text.elseif")));
+static void F_else__(void) __asm__("else_") __attribute__((used, section(".text.else_")));
+static void F_inequality(void) __asm__("inequality") __attribute__((used, section(".text.inequality")));
+static void F_equality(void) __asm__("equality") __attribute__((used, section(".text.equality")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\062\060\055\151\146\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 14U, 14U };
+static struct S_abortsites_2e23 D_abortsites_2e23 = { (char *)((char *)&D_strliteral_2e1) + 0, 76U, 22U };
+static const struct S_strdata_2e48 D_strdata_2e48 = { "\165\156\162\145\141\143\150\141\142\154\145" };
+static struct S_strliteral_2e49 D_strliteral_2e49 = { (char *)((char *)&D_strdata_2e48) + 0, 11U, 11U };
+static struct S_abortsites_2e80 D_abortsites_2e80 = { (char *)((char *)&D_strliteral_2e1) + 0, 59U, 43U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 44U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 15U };
+static struct S_abortsites_2e137 D_abortsites_2e137 = { (char *)((char *)&D_strliteral_2e1) + 0, 55U, 15U };
+static struct S_abortsites_2e165 D_abortsites_2e165 = { (char *)((char *)&D_strliteral_2e1) + 0, 51U, 15U };
+static struct S_abortsites_2e204 D_abortsites_2e204 = { (char *)((char *)&D_strliteral_2e1) + 0, 43U, 15U };
+static struct S_abortsites_2e225 D_abortsites_2e225 = { (char *)((char *)&D_strliteral_2e1) + 0, 39U, 15U };
+static struct S_abortsites_2e246 D_abortsites_2e246 = { (char *)((char *)&D_strliteral_2e1) + 0, 35U, 15U };
+static struct S_abortsites_2e267 D_abortsites_2e267 = { (char *)((char *)&D_strliteral_2e1) + 0, 31U, 15U };
+static struct S_abortsites_2e293 D_abortsites_2e293 = { (char *)((char *)&D_strliteral_2e1) + 0, 27U, 15U };
+static struct S_abortsites_2e320 D_abortsites_2e320 = { (char *)((char *)&D_strliteral_2e1) + 0, 16U, 15U };
+static struct S_abortsites_2e341 D_abortsites_2e341 = { (char *)((char *)&D_strliteral_2e1) + 0, 12U, 15U };
+static struct S_abortsites_2e362 D_abortsites_2e362 = { (char *)((char *)&D_strliteral_2e1) + 0, 8U, 15U };
+static struct S_abortsites_2e383 D_abortsites_2e383 = { (char *)((char *)&D_strliteral_2e1) + 0, 4U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_equality)))();
+	((void (*)(void))((u64)((char *)&F_inequality)))();
+	((void (*)(void))((u64)((char *)&F_else__)))();
+	((void (*)(void))((u64)((char *)&F_elseif)))();
+	((void (*)(void))((u64)((char *)&F_justif)))();
+	((void (*)(void))((u64)((char *)&F_gt)))();
+	((void (*)(void))((u64)((char *)&F_gte)))();
+	((void (*)(void))((u64)((char *)&F_lt)))();
+	((void (*)(void))((u64)((char *)&F_lte)))();
+	((void (*)(void))((u64)((char *)&F_and)))();
+	((void (*)(void))((u64)((char *)&F_or)))();
+	((void (*)(void))((u64)((char *)&F_tagged)))();
+	((void (*)(void))((u64)((char *)&F_alias)))();
+	((void (*)(void))((u64)((char *)&F___never)))();
+	__builtin_trap();
+	L__2e6:;
+	L__2e4:;
+	L__2e7:;
+	return;
+}
+static void F___never(void) {
+	u64 t__2e16;
+	u64 t__2e26;
+	u64 t__2e27;
+	u64 t__2e28;
+	u64 t__2e29;
+	u64 t__2e30;
+	u64 t_abortsite_2e24;
+	L_start_2e8:;
+	L_body_2e9:;
+	t__2e16 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e16) goto L_true_2e13; else goto L_false_2e14;
+	L_true_2e13:;
+	((void (*)(u32))((u64)X_rt_2eexit))((u32)((u64)0UL));
+	__builtin_trap();
+	L__2e19:;
+	L__2e17:;
+	L__2e20:;
+	L_false_2e14:;
+	t_abortsite_2e24 = ((u64)0UL);
+	goto L_abort_2e25;
+	L__2e31:;
+	L__2e21:;
+	L__2e32:;
+	L__2e15:;
+	L__2e33:;
+	L__2e10:;
+	L__2e34:;
+	__builtin_trap();
+	L_abort_2e25:;
+	t__2e26 = (u64)((u64)t_abortsite_2e24 * (u64)((u64)16UL));
+	t__2e26 = (u64)((u64)((u64)((char *)&D_abortsites_2e23)) + (u64)t__2e26);
+	t__2e27 = (u64)(*(u64 *)t__2e26);
+	t__2e28 = (u64)((u64)t__2e26 + (u64)((u64)8UL));
+	t__2e29 = (u64)(*(u32 *)t__2e28);
+	t__2e28 = (u64)((u64)t__2e26 + (u64)((u64)12UL));
+	t__2e30 = (u64)(*(u32 *)t__2e28);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e27, (u64)t__2e29, (u64)t__2e30, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_alias(void) {
+	char B0[24] __attribute__((aligned(16)));
+	u64 t__2e43;
+	L_start_2e35:;
+	L_body_2e36:;
+	t__2e43 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e43) goto L_true_2e40; else goto L_false_2e41;
+	L_true_2e40:;
+	return;
+	L__2e46:;
+	L__2e44:;
+	L__2e47:;
+	L_false_2e41:;
+	L__2e42:;
+	BLIT((u64)B0, ((u64)((char *)&D_strliteral_2e49)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)69UL), (u64)((u64)14UL), (u64)B0);
+	__builtin_trap();
+	L__2e51:;
+	L__2e37:;
+	L__2e52:;
+	return;
+}
+static void F_tagged(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e104;
+	u64 t__2e106;
+	u64 t__2e108;
+	u64 t__2e109;
+	u64 t__2e110;
+	u64 t__2e114;
+	u64 t__2e117;
+	u64 t__2e118;
+	u64 t__2e119;
+	u64 t__2e59;
+	u64 t__2e60;
+	u64 t__2e64;
+	u64 t__2e69;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t__2e73;
+	u64 t__2e77;
+	u64 t__2e83;
+	u64 t__2e84;
+	u64 t__2e85;
+	u64 t__2e86;
+	u64 t__2e87;
+	u64 t__2e88;
+	u64 t__2e89;
+	u64 t__2e90;
+	u64 t__2e92;
+	u64 t__2e93;
+	u64 t__2e94;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e99;
+	u64 t_abortsite_2e81;
+	u64 t_object_2e105;
+	u64 t_object_2e107;
+	u64 t_object_2e65;
+	u64 t_object_2e70;
+	u64 t_subval_2e113;
+	u64 t_subval_2e76;
+	L_start_2e53:;
+	t_object_2e65 = (u64)A0;
+	t_object_2e70 = (u64)A1;
+	t_object_2e105 = (u64)A2;
+	t_object_2e107 = (u64)A3;
+	L_body_2e54:;
+	t__2e64 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e64) goto L_true_2e61; else goto L_false_2e62;
+	L_true_2e61:;
+	*(u32 *)t_object_2e65 = (u32)((u64)3181589295UL);
+	t__2e69 = (u64)((u64)t_object_2e65 + (u64)((u64)4UL));
+	*(u8 *)t__2e69 = (u8)((u64)1UL);
+	t__2e60 = t_object_2e65;
+	goto L__2e63;
+	L_false_2e62:;
+	*(u32 *)t_object_2e70 = (u32)((u64)2674862226UL);
+	t__2e71 = (u64)((u64)t_object_2e70 + (u64)((u64)4UL));
+	*(u8 *)t__2e71 = (u8)((u64)0UL);
+	t__2e60 = t_object_2e70;
+	L__2e63:;
+	t__2e72 = t__2e60;
+	t__2e73 = (u64)(u32)(*(u32 *)t__2e60);
+	t_subval_2e76 = t__2e60;
+	t__2e77 = (u64)(u32)(((u32)t__2e73 == (u32)((u64)3181589295UL)));
+	if ((u32)t__2e77) goto L_subtype_2e79; else goto L_failed_2e75;
+	L_subtype_2e79:;
+	goto L_passed_2e74;
+	L_failed_2e75:;
+	t_abortsite_2e81 = ((u64)0UL);
+	goto L_abort_2e82;
+	L_passed_2e74:;
+	t__2e72 = (u64)((u64)t__2e72 + (u64)((u64)4UL));
+	t__2e88 = (u64)(u32)(*(u8 *)t__2e72);
+	t__2e89 = (u64)(u32)((u8)t__2e88);
+	t__2e90 = (u64)(u32)((u8)((u64)1UL));
+	t__2e59 = (u64)(u32)(((u32)t__2e89 == (u32)t__2e90));
+	if ((u32)t__2e59) goto L_passed_2e58; else goto L_failed_2e57;
+	L_failed_2e57:;
+	t_abortsite_2e81 = ((u64)1UL);
+	goto L_abort_2e91;
+	L_passed_2e58:;
+	t__2e104 = (u64)(u32)((u8)((u64)0UL));
+	if ((u32)t__2e104) goto L_true_2e101; else goto L_false_2e102;
+	L_true_2e101:;
+	*(u32 *)t_object_2e105 = (u32)((u64)3181589295UL);
+	t__2e106 = (u64)((u64)t_object_2e105 + (u64)((u64)4UL));
+	*(u8 *)t__2e106 = (u8)((u64)1UL);
+	t__2e100 = t_object_2e105;
+	goto L__2e103;
+	L_false_2e102:;
+	*(u32 *)t_object_2e107 = (u32)((u64)2674862226UL);
+	t__2e108 = (u64)((u64)t_object_2e107 + (u64)((u64)4UL));
+	*(u8 *)t__2e108 = (u8)((u64)0UL);
+	t__2e100 = t_object_2e107;
+	L__2e103:;
+	t__2e109 = t__2e100;
+	t__2e110 = (u64)(u32)(*(u32 *)t__2e100);
+	t_subval_2e113 = t__2e100;
+	t__2e114 = (u64)(u32)(((u32)t__2e110 == (u32)((u64)2674862226UL)));
+	if ((u32)t__2e114) goto L_subtype_2e116; else goto L_failed_2e112;
+	L_subtype_2e116:;
+	goto L_passed_2e111;
+	L_failed_2e112:;
+	t_abortsite_2e81 = ((u64)2UL);
+	goto L_abort_2e82;
+	L_passed_2e111:;
+	t__2e109 = (u64)((u64)t__2e109 + (u64)((u64)4UL));
+	t__2e117 = (u64)(u32)(*(i8 *)t__2e109);
+	t__2e118 = (u64)(u32)((i64)(i8)t__2e117);
+	t__2e119 = (u64)(u32)((i64)(i8)((u64)0UL));
+	t__2e99 = (u64)(u32)(((u32)t__2e118 == (u32)t__2e119));
+	if ((u32)t__2e99) goto L_passed_2e98; else goto L_failed_2e97;
+	L_failed_2e97:;
+	t_abortsite_2e81 = ((u64)3UL);
+	goto L_abort_2e91;
+	L_passed_2e98:;
+	goto L__2e55;
+	L__2e120:;
+	L__2e55:;
+	return;
+	L_abort_2e82:;
+	t__2e83 = (u64)((u64)t_abortsite_2e81 * (u64)((u64)16UL));
+	t__2e83 = (u64)((u64)((u64)((char *)&D_abortsites_2e80)) + (u64)t__2e83);
+	t__2e84 = (u64)(*(u64 *)t__2e83);
+	t__2e85 = (u64)((u64)t__2e83 + (u64)((u64)8UL));
+	t__2e86 = (u64)(*(u32 *)t__2e85);
+	t__2e85 = (u64)((u64)t__2e83 + (u64)((u64)12UL));
+	t__2e87 = (u64)(*(u32 *)t__2e85);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e84, (u64)t__2e86, (u64)t__2e87, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e91:;
+	t__2e92 = (u64)((u64)t_abortsite_2e81 * (u64)((u64)16UL));
+	t__2e92 = (u64)((u64)((u64)((char *)&D_abortsites_2e80)) + (u64)t__2e92);
+	t__2e93 = (u64)(*(u64 *)t__2e92);
+	t__2e94 = (u64)((u64)t__2e92 + (u64)((u64)8UL));
+	t__2e95 = (u64)(*(u32 *)t__2e94);
+	t__2e94 = (u64)((u64)t__2e92 + (u64)((u64)12UL));
+	t__2e96 = (u64)(*(u32 *)t__2e94);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e93, (u64)t__2e95, (u64)t__2e96, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_or(void) {
+	u64 t__2e127;
+	u64 t__2e131;
+	u64 t__2e134;
+	u64 t__2e135;
+	u64 t__2e136;
+	u64 t__2e140;
+	u64 t__2e141;
+	u64 t__2e142;
+	u64 t__2e143;
+	u64 t__2e144;
+	u64 t_abortsite_2e138;
+	L_start_2e121:;
+	L_body_2e122:;
+	t__2e131 = (u64)(u32)((u64)1UL);
+	if ((u32)t__2e131) goto L__2e133; else goto L__2e132;
+	L__2e132:;
+	t__2e135 = (u64)(u32)((i32)((u64)1UL) / (i32)((u64)0UL));
+	t__2e134 = (u64)(u32)(((u32)t__2e135 == (u32)((u64)0UL)));
+	t__2e131 = (u64)(u32)t__2e134;
+	goto L__2e133;
+	L__2e133:;
+	t__2e136 = (u64)(u32)((u8)t__2e131);
+	if ((u32)t__2e136) goto L_true_2e128; else goto L_false_2e129;
+	L_true_2e128:;
+	t__2e127 = (u64)(u32)((u64)1UL);
+	goto L__2e130;
+	L_false_2e129:;
+	t__2e127 = (u64)(u32)((u64)0UL);
+	L__2e130:;
+	if ((u32)t__2e127) goto L_passed_2e126; else goto L_failed_2e125;
+	L_failed_2e125:;
+	t_abortsite_2e138 = ((u64)0UL);
+	goto L_abort_2e139;
+	L_passed_2e126:;
+	goto L__2e123;
+	L__2e145:;
+	L__2e123:;
+	return;
+	L_abort_2e139:;
+	t__2e140 = (u64)((u64)t_abortsite_2e138 * (u64)((u64)16UL));
+	t__2e140 = (u64)((u64)((u64)((char *)&D_abortsites_2e137)) + (u64)t__2e140);
+	t__2e141 = (u64)(*(u64 *)t__2e140);
+	t__2e142 = (u64)((u64)t__2e140 + (u64)((u64)8UL));
+	t__2e143 = (u64)(*(u32 *)t__2e142);
+	t__2e142 = (u64)((u64)t__2e140 + (u64)((u64)12UL));
+	t__2e144 = (u64)(*(u32 *)t__2e142);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e141, (u64)t__2e143, (u64)t__2e144, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_and(void) {
+	u64 t__2e152;
+	u64 t__2e156;
+	u64 t__2e159;
+	u64 t__2e160;
+	u64 t__2e163;
+	u64 t__2e164;
+	u64 t__2e168;
+	u64 t__2e169;
+	u64 t__2e170;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t_abortsite_2e166;
+	L_start_2e146:;
+	L_body_2e147:;
+	t__2e156 = (u64)(u32)((u64)1UL);
+	if ((u32)t__2e156) goto L__2e157; else goto L__2e158;
+	L__2e157:;
+	t__2e163 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	t__2e160 = (u64)(u32)t__2e163;
+	if ((u32)t__2e160) goto L__2e161; else goto L__2e162;
+	L__2e161:;
+	t__2e160 = (u64)(u32)((u64)0UL);
+	goto L__2e162;
+	L__2e162:;
+	t__2e159 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_and2)))((u32)t__2e160));
+	t__2e156 = (u64)(u32)t__2e159;
+	goto L__2e158;
+	L__2e158:;
+	t__2e164 = (u64)(u32)((u8)t__2e156);
+	if ((u32)t__2e164) goto L_true_2e153; else goto L_false_2e154;
+	L_true_2e153:;
+	t__2e152 = (u64)(u32)((u64)1UL);
+	goto L__2e155;
+	L_false_2e154:;
+	t__2e152 = (u64)(u32)((u64)0UL);
+	L__2e155:;
+	if ((u32)t__2e152) goto L_passed_2e151; else goto L_failed_2e150;
+	L_failed_2e150:;
+	t_abortsite_2e166 = ((u64)0UL);
+	goto L_abort_2e167;
+	L_passed_2e151:;
+	goto L__2e148;
+	L__2e173:;
+	L__2e148:;
+	return;
+	L_abort_2e167:;
+	t__2e168 = (u64)((u64)t_abortsite_2e166 * (u64)((u64)16UL));
+	t__2e168 = (u64)((u64)((u64)((char *)&D_abortsites_2e165)) + (u64)t__2e168);
+	t__2e169 = (u64)(*(u64 *)t__2e168);
+	t__2e170 = (u64)((u64)t__2e168 + (u64)((u64)8UL));
+	t__2e171 = (u64)(*(u32 *)t__2e170);
+	t__2e170 = (u64)((u64)t__2e168 + (u64)((u64)12UL));
+	t__2e172 = (u64)(*(u32 *)t__2e170);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e169, (u64)t__2e171, (u64)t__2e172, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_and2(u32 p_left) {
+	char A0[1] __attribute__((aligned(16)));
+	u64 t__2e179;
+	u64 t__2e183;
+	u64 t__2e186;
+	u64 t__2e187;
+	u64 t__2e188;
+	u64 t__2e189;
+	u64 t_left;
+	u64 t_param_2e175;
+	t_left = (u64)p_left;
+	L_start_2e174:;
+	t_param_2e175 = (u64)A0;
+	*(u8 *)t_param_2e175 = (u8)t_left;
+	L_body_2e176:;
+	t__2e186 = (u64)(u32)(*(u8 *)t_param_2e175);
+	t__2e183 = (u64)(u32)t__2e186;
+	if ((u32)t__2e183) goto L__2e184; else goto L__2e185;
+	L__2e184:;
+	t__2e188 = (u64)(u32)((i32)((u64)1UL) / (i32)((u64)0UL));
+	t__2e187 = (u64)(u32)(((u32)t__2e188 == (u32)((u64)0UL)));
+	t__2e183 = (u64)(u32)t__2e187;
+	goto L__2e185;
+	L__2e185:;
+	t__2e189 = (u64)(u32)((u8)t__2e183);
+	if ((u32)t__2e189) goto L_true_2e180; else goto L_false_2e181;
+	L_true_2e180:;
+	t__2e179 = (u64)(u32)((u64)0UL);
+	goto L__2e182;
+	L_false_2e181:;
+	t__2e179 = (u64)(u32)((u64)1UL);
+	L__2e182:;
+	return (u32)t__2e179;
+	L__2e190:;
+	L__2e177:;
+	L__2e191:;
+	return 0;
+}
+static void F_lte(void) {
+	u64 t__2e198;
+	u64 t__2e202;
+	u64 t__2e203;
+	u64 t__2e207;
+	u64 t__2e208;
+	u64 t__2e209;
+	u64 t__2e210;
+	u64 t__2e211;
+	u64 t_abortsite_2e205;
+	L_start_2e192:;
+	L_body_2e193:;
+	t__2e202 = (u64)(u32)(((i32)((u64)2UL) <= (i32)((u64)2UL)));
+	t__2e203 = (u64)(u32)((u8)t__2e202);
+	if ((u32)t__2e203) goto L_true_2e199; else goto L_false_2e200;
+	L_true_2e199:;
+	t__2e198 = (u64)(u32)((u64)1UL);
+	goto L__2e201;
+	L_false_2e200:;
+	t__2e198 = (u64)(u32)((u64)0UL);
+	L__2e201:;
+	if ((u32)t__2e198) goto L_passed_2e197; else goto L_failed_2e196;
+	L_failed_2e196:;
+	t_abortsite_2e205 = ((u64)0UL);
+	goto L_abort_2e206;
+	L_passed_2e197:;
+	goto L__2e194;
+	L__2e212:;
+	L__2e194:;
+	return;
+	L_abort_2e206:;
+	t__2e207 = (u64)((u64)t_abortsite_2e205 * (u64)((u64)16UL));
+	t__2e207 = (u64)((u64)((u64)((char *)&D_abortsites_2e204)) + (u64)t__2e207);
+	t__2e208 = (u64)(*(u64 *)t__2e207);
+	t__2e209 = (u64)((u64)t__2e207 + (u64)((u64)8UL));
+	t__2e210 = (u64)(*(u32 *)t__2e209);
+	t__2e209 = (u64)((u64)t__2e207 + (u64)((u64)12UL));
+	t__2e211 = (u64)(*(u32 *)t__2e209);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e208, (u64)t__2e210, (u64)t__2e211, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_lt(void) {
+	u64 t__2e219;
+	u64 t__2e223;
+	u64 t__2e224;
+	u64 t__2e228;
+	u64 t__2e229;
+	u64 t__2e230;
+	u64 t__2e231;
+	u64 t__2e232;
+	u64 t_abortsite_2e226;
+	L_start_2e213:;
+	L_body_2e214:;
+	t__2e223 = (u64)(u32)(((i32)((u64)1UL) < (i32)((u64)2UL)));
+	t__2e224 = (u64)(u32)((u8)t__2e223);
+	if ((u32)t__2e224) goto L_true_2e220; else goto L_false_2e221;
+	L_true_2e220:;
+	t__2e219 = (u64)(u32)((u64)1UL);
+	goto L__2e222;
+	L_false_2e221:;
+	t__2e219 = (u64)(u32)((u64)0UL);
+	L__2e222:;
+	if ((u32)t__2e219) goto L_passed_2e218; else goto L_failed_2e217;
+	L_failed_2e217:;
+	t_abortsite_2e226 = ((u64)0UL);
+	goto L_abort_2e227;
+	L_passed_2e218:;
+	goto L__2e215;
+	L__2e233:;
+	L__2e215:;
+	return;
+	L_abort_2e227:;
+	t__2e228 = (u64)((u64)t_abortsite_2e226 * (u64)((u64)16UL));
+	t__2e228 = (u64)((u64)((u64)((char *)&D_abortsites_2e225)) + (u64)t__2e228);
+	t__2e229 = (u64)(*(u64 *)t__2e228);
+	t__2e230 = (u64)((u64)t__2e228 + (u64)((u64)8UL));
+	t__2e231 = (u64)(*(u32 *)t__2e230);
+	t__2e230 = (u64)((u64)t__2e228 + (u64)((u64)12UL));
+	t__2e232 = (u64)(*(u32 *)t__2e230);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e229, (u64)t__2e231, (u64)t__2e232, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_gte(void) {
+	u64 t__2e240;
+	u64 t__2e244;
+	u64 t__2e245;
+	u64 t__2e249;
+	u64 t__2e250;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e253;
+	u64 t_abortsite_2e247;
+	L_start_2e234:;
+	L_body_2e235:;
+	t__2e244 = (u64)(u32)(((i32)((u64)2UL) >= (i32)((u64)2UL)));
+	t__2e245 = (u64)(u32)((u8)t__2e244);
+	if ((u32)t__2e245) goto L_true_2e241; else goto L_false_2e242;
+	L_true_2e241:;
+	t__2e240 = (u64)(u32)((u64)1UL);
+	goto L__2e243;
+	L_false_2e242:;
+	t__2e240 = (u64)(u32)((u64)0UL);
+	L__2e243:;
+	if ((u32)t__2e240) goto L_passed_2e239; else goto L_failed_2e238;
+	L_failed_2e238:;
+	t_abortsite_2e247 = ((u64)0UL);
+	goto L_abort_2e248;
+	L_passed_2e239:;
+	goto L__2e236;
+	L__2e254:;
+	L__2e236:;
+	return;
+	L_abort_2e248:;
+	t__2e249 = (u64)((u64)t_abortsite_2e247 * (u64)((u64)16UL));
+	t__2e249 = (u64)((u64)((u64)((char *)&D_abortsites_2e246)) + (u64)t__2e249);
+	t__2e250 = (u64)(*(u64 *)t__2e249);
+	t__2e251 = (u64)((u64)t__2e249 + (u64)((u64)8UL));
+	t__2e252 = (u64)(*(u32 *)t__2e251);
+	t__2e251 = (u64)((u64)t__2e249 + (u64)((u64)12UL));
+	t__2e253 = (u64)(*(u32 *)t__2e251);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e250, (u64)t__2e252, (u64)t__2e253, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_gt(void) {
+	u64 t__2e261;
+	u64 t__2e265;
+	u64 t__2e266;
+	u64 t__2e270;
+	u64 t__2e271;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t_abortsite_2e268;
+	L_start_2e255:;
+	L_body_2e256:;
+	t__2e265 = (u64)(u32)(((i32)((u64)1UL) > (i32)((u64)2UL)));
+	t__2e266 = (u64)(u32)((u8)t__2e265);
+	if ((u32)t__2e266) goto L_true_2e262; else goto L_false_2e263;
+	L_true_2e262:;
+	t__2e261 = (u64)(u32)((u64)0UL);
+	goto L__2e264;
+	L_false_2e263:;
+	t__2e261 = (u64)(u32)((u64)1UL);
+	L__2e264:;
+	if ((u32)t__2e261) goto L_passed_2e260; else goto L_failed_2e259;
+	L_failed_2e259:;
+	t_abortsite_2e268 = ((u64)0UL);
+	goto L_abort_2e269;
+	L_passed_2e260:;
+	goto L__2e257;
+	L__2e275:;
+	L__2e257:;
+	return;
+	L_abort_2e269:;
+	t__2e270 = (u64)((u64)t_abortsite_2e268 * (u64)((u64)16UL));
+	t__2e270 = (u64)((u64)((u64)((char *)&D_abortsites_2e267)) + (u64)t__2e270);
+	t__2e271 = (u64)(*(u64 *)t__2e270);
+	t__2e272 = (u64)((u64)t__2e270 + (u64)((u64)8UL));
+	t__2e273 = (u64)(*(u32 *)t__2e272);
+	t__2e272 = (u64)((u64)t__2e270 + (u64)((u64)12UL));
+	t__2e274 = (u64)(*(u32 *)t__2e272);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e271, (u64)t__2e273, (u64)t__2e274, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_justif(void) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e285;
+	u64 t__2e291;
+	u64 t__2e292;
+	u64 t__2e296;
+	u64 t__2e297;
+	u64 t__2e298;
+	u64 t__2e299;
+	u64 t__2e300;
+	u64 t_abortsite_2e294;
+	u64 t_binding_2e280;
+	L_start_2e276:;
+	t_binding_2e280 = (u64)A0;
+	L_body_2e277:;
+	*(u32 *)t_binding_2e280 = (u32)((u64)1UL);
+	t__2e285 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e285) goto L_true_2e282; else goto L_false_2e283;
+	L_true_2e282:;
+	*(u32 *)t_binding_2e280 = (u32)((u64)0UL);
+	goto L__2e286;
+	L__2e288:;
+	L__2e286:;
+	goto L__2e284;
+	L_false_2e283:;
+	L__2e284:;
+	t__2e292 = (u64)(u32)(*(i32 *)t_binding_2e280);
+	t__2e291 = (u64)(u32)(((u32)t__2e292 == (u32)((u64)0UL)));
+	if ((u32)t__2e291) goto L_passed_2e290; else goto L_failed_2e289;
+	L_failed_2e289:;
+	t_abortsite_2e294 = ((u64)0UL);
+	goto L_abort_2e295;
+	L_passed_2e290:;
+	goto L__2e278;
+	L__2e301:;
+	L__2e278:;
+	return;
+	L_abort_2e295:;
+	t__2e296 = (u64)((u64)t_abortsite_2e294 * (u64)((u64)16UL));
+	t__2e296 = (u64)((u64)((u64)((char *)&D_abortsites_2e293)) + (u64)t__2e296);
+	t__2e297 = (u64)(*(u64 *)t__2e296);
+	t__2e298 = (u64)((u64)t__2e296 + (u64)((u64)8UL));
+	t__2e299 = (u64)(*(u32 *)t__2e298);
+	t__2e298 = (u64)((u64)t__2e296 + (u64)((u64)12UL));
+	t__2e300 = (u64)(*(u32 *)t__2e298);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e297, (u64)t__2e299, (u64)t__2e300, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_elseif(void) {
+	u64 t__2e308;
+	u64 t__2e312;
+	u64 t__2e313;
+	u64 t__2e314;
+	u64 t__2e318;
+	u64 t__2e319;
+	u64 t__2e323;
+	u64 t__2e324;
+	u64 t__2e325;
+	u64 t__2e326;
+	u64 t__2e327;
+	u64 t_abortsite_2e321;
+	L_start_2e302:;
+	L_body_2e303:;
+	t__2e312 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)1UL)));
+	t__2e313 = (u64)(u32)((u8)t__2e312);
+	if ((u32)t__2e313) goto L_true_2e309; else goto L_false_2e310;
+	L_true_2e309:;
+	t__2e308 = (u64)(u32)((u64)0UL);
+	goto L__2e311;
+	L_false_2e310:;
+	t__2e318 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	t__2e319 = (u64)(u32)((u8)t__2e318);
+	if ((u32)t__2e319) goto L_true_2e315; else goto L_false_2e316;
+	L_true_2e315:;
+	t__2e314 = (u64)(u32)((u64)1UL);
+	goto L__2e317;
+	L_false_2e316:;
+	t__2e314 = (u64)(u32)((u64)0UL);
+	L__2e317:;
+	t__2e308 = (u64)(u32)t__2e314;
+	L__2e311:;
+	if ((u32)t__2e308) goto L_passed_2e307; else goto L_failed_2e306;
+	L_failed_2e306:;
+	t_abortsite_2e321 = ((u64)0UL);
+	goto L_abort_2e322;
+	L_passed_2e307:;
+	goto L__2e304;
+	L__2e328:;
+	L__2e304:;
+	return;
+	L_abort_2e322:;
+	t__2e323 = (u64)((u64)t_abortsite_2e321 * (u64)((u64)16UL));
+	t__2e323 = (u64)((u64)((u64)((char *)&D_abortsites_2e320)) + (u64)t__2e323);
+	t__2e324 = (u64)(*(u64 *)t__2e323);
+	t__2e325 = (u64)((u64)t__2e323 + (u64)((u64)8UL));
+	t__2e326 = (u64)(*(u32 *)t__2e325);
+	t__2e325 = (u64)((u64)t__2e323 + (u64)((u64)12UL));
+	t__2e327 = (u64)(*(u32 *)t__2e325);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e324, (u64)t__2e326, (u64)t__2e327, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_else__(void) {
+	u64 t__2e335;
+	u64 t__2e339;
+	u64 t__2e340;
+	u64 t__2e344;
+	u64 t__2e345;
+	u64 t__2e346;
+	u64 t__2e347;
+	u64 t__2e348;
+	u64 t_abortsite_2e342;
+	L_start_2e329:;
+	L_body_2e330:;
+	t__2e339 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)1UL)));
+	t__2e340 = (u64)(u32)((u8)t__2e339);
+	if ((u32)t__2e340) goto L_true_2e336; else goto L_false_2e337;
+	L_true_2e336:;
+	t__2e335 = (u64)(u32)((u64)0UL);
+	goto L__2e338;
+	L_false_2e337:;
+	t__2e335 = (u64)(u32)((u64)1UL);
+	L__2e338:;
+	if ((u32)t__2e335) goto L_passed_2e334; else goto L_failed_2e333;
+	L_failed_2e333:;
+	t_abortsite_2e342 = ((u64)0UL);
+	goto L_abort_2e343;
+	L_passed_2e334:;
+	goto L__2e331;
+	L__2e349:;
+	L__2e331:;
+	return;
+	L_abort_2e343:;
+	t__2e344 = (u64)((u64)t_abortsite_2e342 * (u64)((u64)16UL));
+	t__2e344 = (u64)((u64)((u64)((char *)&D_abortsites_2e341)) + (u64)t__2e344);
+	t__2e345 = (u64)(*(u64 *)t__2e344);
+	t__2e346 = (u64)((u64)t__2e344 + (u64)((u64)8UL));
+	t__2e347 = (u64)(*(u32 *)t__2e346);
+	t__2e346 = (u64)((u64)t__2e344 + (u64)((u64)12UL));
+	t__2e348 = (u64)(*(u32 *)t__2e346);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e345, (u64)t__2e347, (u64)t__2e348, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_inequality(void) {
+	u64 t__2e356;
+	u64 t__2e360;
+	u64 t__2e361;
+	u64 t__2e365;
+	u64 t__2e366;
+	u64 t__2e367;
+	u64 t__2e368;
+	u64 t__2e369;
+	u64 t_abortsite_2e363;
+	L_start_2e350:;
+	L_body_2e351:;
+	t__2e360 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)1UL)));
+	t__2e361 = (u64)(u32)((u8)t__2e360);
+	if ((u32)t__2e361) goto L_true_2e357; else goto L_false_2e358;
+	L_true_2e357:;
+	t__2e356 = (u64)(u32)((u64)0UL);
+	goto L__2e359;
+	L_false_2e358:;
+	t__2e356 = (u64)(u32)((u64)1UL);
+	L__2e359:;
+	if ((u32)t__2e356) goto L_passed_2e355; else goto L_failed_2e354;
+	L_failed_2e354:;
+	t_abortsite_2e363 = ((u64)0UL);
+	goto L_abort_2e364;
+	L_passed_2e355:;
+	goto L__2e352;
+	L__2e370:;
+	L__2e352:;
+	return;
+	L_abort_2e364:;
+	t__2e365 = (u64)((u64)t_abortsite_2e363 * (u64)((u64)16UL));
+	t__2e365 = (u64)((u64)((u64)((char *)&D_abortsites_2e362)) + (u64)t__2e365);
+	t__2e366 = (u64)(*(u64 *)t__2e365);
+	t__2e367 = (u64)((u64)t__2e365 + (u64)((u64)8UL));
+	t__2e368 = (u64)(*(u32 *)t__2e367);
+	t__2e367 = (u64)((u64)t__2e365 + (u64)((u64)12UL));
+	t__2e369 = (u64)(*(u32 *)t__2e367);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e366, (u64)t__2e368, (u64)t__2e369, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_equality(void) {
+	u64 t__2e377;
+	u64 t__2e381;
+	u64 t__2e382;
+	u64 t__2e386;
+	u64 t__2e387;
+	u64 t__2e388;
+	u64 t__2e389;
+	u64 t__2e390;
+	u64 t_abortsite_2e384;
+	L_start_2e371:;
+	L_body_2e372:;
+	t__2e381 = (u64)(u32)(((u32)((u64)2UL) == (u32)((u64)2UL)));
+	t__2e382 = (u64)(u32)((u8)t__2e381);
+	if ((u32)t__2e382) goto L_true_2e378; else goto L_false_2e379;
+	L_true_2e378:;
+	t__2e377 = (u64)(u32)((u64)1UL);
+	goto L__2e380;
+	L_false_2e379:;
+	t__2e377 = (u64)(u32)((u64)0UL);
+	L__2e380:;
+	if ((u32)t__2e377) goto L_passed_2e376; else goto L_failed_2e375;
+	L_failed_2e375:;
+	t_abortsite_2e384 = ((u64)0UL);
+	goto L_abort_2e385;
+	L_passed_2e376:;
+	goto L__2e373;
+	L__2e391:;
+	L__2e373:;
+	return;
+	L_abort_2e385:;
+	t__2e386 = (u64)((u64)t_abortsite_2e384 * (u64)((u64)16UL));
+	t__2e386 = (u64)((u64)((u64)((char *)&D_abortsites_2e383)) + (u64)t__2e386);
+	t__2e387 = (u64)(*(u64 *)t__2e386);
+	t__2e388 = (u64)((u64)t__2e386 + (u64)((u64)8UL));
+	t__2e389 = (u64)(*(u32 *)t__2e388);
+	t__2e388 = (u64)((u64)t__2e386 + (u64)((u64)12UL));
+	t__2e390 = (u64)(*(u32 *)t__2e388);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e387, (u64)t__2e389, (u64)t__2e390, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,1769 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2estrcmp[] __asm__("rt.strcmp");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e35 { u8 f0[39]; };
+struct __attribute__((packed)) S_strliteral_2e36 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e37 { u8 f0[45]; };
+struct __attribute__((packed)) S_strliteral_2e38 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e39 { u8 f0[30]; };
+struct __attribute__((packed)) S_strliteral_2e40 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e41 { u8 f0[31]; };
+struct __attribute__((packed)) S_strliteral_2e42 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e43 { u8 f0[48]; };
+struct __attribute__((packed)) S_strliteral_2e44 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e45 { u8 f0[54]; };
+struct __attribute__((packed)) S_strliteral_2e46 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e47 { u8 f0[43]; };
+struct __attribute__((packed)) S_strliteral_2e48 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e49 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e50 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e54 { u8 f0[39]; };
+struct __attribute__((packed)) S_strliteral_2e55 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e56 { u8 f0[34]; };
+struct __attribute__((packed)) S_strliteral_2e57 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e58 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e59 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e60 { u8 f0[74]; };
+struct __attribute__((packed)) S_strliteral_2e61 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e62 { u8 f0[74]; };
+struct __attribute__((packed)) S_strliteral_2e63 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e64 { u8 f0[48]; };
+struct __attribute__((packed)) S_strliteral_2e65 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e66 { u8 f0[69]; };
+struct __attribute__((packed)) S_strliteral_2e67 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e68 { u8 f0[47]; };
+struct __attribute__((packed)) S_strliteral_2e69 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e70 { u8 f0[72]; };
+struct __attribute__((packed)) S_strliteral_2e71 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e72 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e73 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e74 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e75 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e76 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e77 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e78 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e79 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e80 { u8 f0[37]; };
+struct __attribute__((packed)) S_strliteral_2e81 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e82 { u8 f0[39]; };
+struct __attribute__((packed)) S_strliteral_2e83 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e84 { u8 f0[37]; };
+struct __attribute__((packed)) S_strliteral_2e85 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e86 { u8 f0[56]; };
+struct __attribute__((packed)) S_strliteral_2e87 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e88 { u8 f0[34]; };
+struct __attribute__((packed)) S_strliteral_2e89 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e90 { u8 f0[39]; };
+struct __attribute__((packed)) S_strliteral_2e91 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e92 { u8 f0[39]; };
+struct __attribute__((packed)) S_strliteral_2e93 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e94 { u8 f0[37]; };
+struct __attribute__((packed)) S_strliteral_2e95 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e96 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e97 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e98 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e99 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e100 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e101 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e102 { u8 f0[39]; };
+struct __attribute__((packed)) S_strliteral_2e103 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e104 { u8 f0[43]; };
+struct __attribute__((packed)) S_strliteral_2e105 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e106 { u8 f0[47]; };
+struct __attribute__((packed)) S_strliteral_2e107 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e142 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e223 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_strdata_2e283 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e284 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e248 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; };
+struct __attribute__((packed)) S_unpacking__global { u32 f0; };
+struct __attribute__((packed)) S_static_2e3 { u32 f0; };
+struct __attribute__((packed)) S_static_2e1 { u32 f0; };
+struct __attribute__((packed)) S_static_2e2 { u32 f0; };
+struct __attribute__((packed)) S_static_2e0 { u32 f0; u32 f1; };
+struct __attribute__((packed)) S_abortsites_2e494 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e530 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_abortsites_2e567 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_abortsites_2e612 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e35 D_strdata_2e35 __asm__("strdata.35") __attribute__((used, section(".rodata.strdata.35"), aligned(8)));
+static struct S_strliteral_2e36 D_strliteral_2e36 __asm__("strliteral.36") __attribute__((used, section(".data.rel.ro.strliteral.36"), aligned(8)));
+static const struct S_strdata_2e37 D_strdata_2e37 __asm__("strdata.37") __attribute__((used, section(".rodata.strdata.37"), aligned(8)));
+static struct S_strliteral_2e38 D_strliteral_2e38 __asm__("strliteral.38") __attribute__((used, section(".data.rel.ro.strliteral.38"), aligned(8)));
+static const struct S_strdata_2e39 D_strdata_2e39 __asm__("strdata.39") __attribute__((used, section(".rodata.strdata.39"), aligned(8)));
+static struct S_strliteral_2e40 D_strliteral_2e40 __asm__("strliteral.40") __attribute__((used, section(".data.rel.ro.strliteral.40"), aligned(8)));
+static const struct S_strdata_2e41 D_strdata_2e41 __asm__("strdata.41") __attribute__((used, section(".rodata.strdata.41"), aligned(8)));
+static struct S_strliteral_2e42 D_strliteral_2e42 __asm__("strliteral.42") __attribute__((used, section(".data.rel.ro.strliteral.42"), aligned(8)));
+static const struct S_strdata_2e43 D_strdata_2e43 __asm__("strdata.43") __attribute__((used, section(".rodata.strdata.43"), aligned(8)));
+static struct S_strliteral_2e44 D_strliteral_2e44 __asm__("strliteral.44") __attribute__((used, section(".data.rel.ro.strliteral.44"), aligned(8)));
+static const struct S_strdata_2e45 D_strdata_2e45 __asm__("strdata.45") __attribute__((used, section(".rodata.strdata.45"), aligned(8)));
+static struct S_strliteral_2e46 D_strliteral_2e46 __asm__("strliteral.46") __attribute__((used, section(".data.rel.ro.strliteral.46"), aligned(8)));
+static const struct S_strdata_2e47 D_strdata_2e47 __asm__("strdata.47") __attribute__((used, section(".rodata.strdata.47"), aligned(8)));
+static struct S_strliteral_2e48 D_strliteral_2e48 __asm__("strliteral.48") __attribute__((used, section(".data.rel.ro.strliteral.48"), aligned(8)));
+static const struct S_strdata_2e49 D_strdata_2e49 __asm__("strdata.49") __attribute__((used, section(".rodata.strdata.49"), aligned(8)));
+static struct S_strliteral_2e50 D_strliteral_2e50 __asm__("strliteral.50") __attribute__((used, section(".data.rel.ro.strliteral.50"), aligned(8)));
+static const struct S_strdata_2e54 D_strdata_2e54 __asm__("strdata.54") __attribute__((used, section(".rodata.strdata.54"), aligned(8)));
+static struct S_strliteral_2e55 D_strliteral_2e55 __asm__("strliteral.55") __attribute__((used, section(".data.rel.ro.strliteral.55"), aligned(8)));
+static const struct S_strdata_2e56 D_strdata_2e56 __asm__("strdata.56") __attribute__((used, section(".rodata.strdata.56"), aligned(8)));
+static struct S_strliteral_2e57 D_strliteral_2e57 __asm__("strliteral.57") __attribute__((used, section(".data.rel.ro.strliteral.57"), aligned(8)));
+static const struct S_strdata_2e58 D_strdata_2e58 __asm__("strdata.58") __attribute__((used, section(".rodata.strdata.58"), aligned(8)));
+static struct S_strliteral_2e59 D_strliteral_2e59 __asm__("strliteral.59") __attribute__((used, section(".data.rel.ro.strliteral.59"), aligned(8)));
+static const struct S_strdata_2e60 D_strdata_2e60 __asm__("strdata.60") __attribute__((used, section(".rodata.strdata.60"), aligned(8)));
+static struct S_strliteral_2e61 D_strliteral_2e61 __asm__("strliteral.61") __attribute__((used, section(".data.rel.ro.strliteral.61"), aligned(8)));
+static const struct S_strdata_2e62 D_strdata_2e62 __asm__("strdata.62") __attribute__((used, section(".rodata.strdata.62"), aligned(8)));
+static struct S_strliteral_2e63 D_strliteral_2e63 __asm__("strliteral.63") __attribute__((used, section(".data.rel.ro.strliteral.63"), aligned(8)));
+static const struct S_strdata_2e64 D_strdata_2e64 __asm__("strdata.64") __attribute__((used, section(".rodata.strdata.64"), aligned(8)));
+static struct S_strliteral_2e65 D_strliteral_2e65 __asm__("strliteral.65") __attribute__((used, section(".data.rel.ro.strliteral.65"), aligned(8)));
+static const struct S_strdata_2e66 D_strdata_2e66 __asm__("strdata.66") __attribute__((used, section(".rodata.strdata.66"), aligned(8)));
+static struct S_strliteral_2e67 D_strliteral_2e67 __asm__("strliteral.67") __attribute__((used, section(".data.rel.ro.strliteral.67"), aligned(8)));
+static const struct S_strdata_2e68 D_strdata_2e68 __asm__("strdata.68") __attribute__((used, section(".rodata.strdata.68"), aligned(8)));
+static struct S_strliteral_2e69 D_strliteral_2e69 __asm__("strliteral.69") __attribute__((used, section(".data.rel.ro.strliteral.69"), aligned(8)));
+static const struct S_strdata_2e70 D_strdata_2e70 __asm__("strdata.70") __attribute__((used, section(".rodata.strdata.70"), aligned(8)));
+static struct S_strliteral_2e71 D_strliteral_2e71 __asm__("strliteral.71") __attribute__((used, section(".data.rel.ro.strliteral.71"), aligned(8)));
+static const struct S_strdata_2e72 D_strdata_2e72 __asm__("strdata.72") __attribute__((used, section(".rodata.strdata.72"), aligned(8)));
+static struct S_strliteral_2e73 D_strliteral_2e73 __asm__("strliteral.73") __attribute__((used, section(".data.rel.ro.strliteral.73"), aligned(8)));
+static const struct S_strdata_2e74 D_strdata_2e74 __asm__("strdata.74") __attribute__((used, section(".rodata.strdata.74"), aligned(8)));
+static struct S_strliteral_2e75 D_strliteral_2e75 __asm__("strliteral.75") __attribute__((used, section(".data.rel.ro.strliteral.75"), aligned(8)));
+static const struct S_strdata_2e76 D_strdata_2e76 __asm__("strdata.76") __attribute__((used, section(".rodata.strdata.76"), aligned(8)));
+static struct S_strliteral_2e77 D_strliteral_2e77 __asm__("strliteral.77") __attribute__((used, section(".data.rel.ro.strliteral.77"), aligned(8)));
+static const struct S_strdata_2e78 D_strdata_2e78 __asm__("strdata.78") __attribute__((used, section(".rodata.strdata.78"), aligned(8)));
+static struct S_strliteral_2e79 D_strliteral_2e79 __asm__("strliteral.79") __attribute__((used, section(".data.rel.ro.strliteral.79"), aligned(8)));
+static const struct S_strdata_2e80 D_strdata_2e80 __asm__("strdata.80") __attribute__((used, section(".rodata.strdata.80"), aligned(8)));
+static struct S_strliteral_2e81 D_strliteral_2e81 __asm__("strliteral.81") __attribute__((used, section(".data.rel.ro.strliteral.81"), aligned(8)));
+static const struct S_strdata_2e82 D_strdata_2e82 __asm__("strdata.82") __attribute__((used, section(".rodata.strdata.82"), aligned(8)));
+static struct S_strliteral_2e83 D_strliteral_2e83 __asm__("strliteral.83") __attribute__((used, section(".data.rel.ro.strliteral.83"), aligned(8)));
+static const struct S_strdata_2e84 D_strdata_2e84 __asm__("strdata.84") __attribute__((used, section(".rodata.strdata.84"), aligned(8)));
+static struct S_strliteral_2e85 D_strliteral_2e85 __asm__("strliteral.85") __attribute__((used, section(".data.rel.ro.strliteral.85"), aligned(8)));
+static const struct S_strdata_2e86 D_strdata_2e86 __asm__("strdata.86") __attribute__((used, section(".rodata.strdata.86"), aligned(8)));
+static struct S_strliteral_2e87 D_strliteral_2e87 __asm__("strliteral.87") __attribute__((used, section(".data.rel.ro.strliteral.87"), aligned(8)));
+static const struct S_strdata_2e88 D_strdata_2e88 __asm__("strdata.88") __attribute__((used, section(".rodata.strdata.88"), aligned(8)));
+static struct S_strliteral_2e89 D_strliteral_2e89 __asm__("strliteral.89") __attribute__((used, section(".data.rel.ro.strliteral.89"), aligned(8)));
+static const struct S_strdata_2e90 D_strdata_2e90 __asm__("strdata.90") __attribute__((used, section(".rodata.strdata.90"), aligned(8)));
+static struct S_strliteral_2e91 D_strliteral_2e91 __asm__("strliteral.91") __attribute__((used, section(".data.rel.ro.strliteral.91"), aligned(8)));
+static const struct S_strdata_2e92 D_strdata_2e92 __asm__("strdata.92") __attribute__((used, section(".rodata.strdata.92"), aligned(8)));
+static struct S_strliteral_2e93 D_strliteral_2e93 __asm__("strliteral.93") __attribute__((used, section(".data.rel.ro.strliteral.93"), aligned(8)));
+static const struct S_strdata_2e94 D_strdata_2e94 __asm__("strdata.94") __attribute__((used, section(".rodata.strdata.94"), aligned(8)));
+static struct S_strliteral_2e95 D_strliteral_2e95 __asm__("strliteral.95") __attribute__((used, section(".data.rel.ro.strliteral.95"), aligned(8)));
+static const struct S_strdata_2e96 D_strdata_2e96 __asm__("strdata.96") __attribute__((used, section(".rodata.strdata.96"), aligned(8)));
+static struct S_strliteral_2e97 D_strliteral_2e97 __asm__("strliteral.97") __attribute__((used, section(".data.rel.ro.strliteral.97"), aligned(8)));
+static const struct S_strdata_2e98 D_strdata_2e98 __asm__("strdata.98") __attribute__((used, section(".rodata.strdata.98"), aligned(8)));
+static struct S_strliteral_2e99 D_strliteral_2e99 __asm__("strliteral.99") __attribute__((used, section(".data.rel.ro.strliteral.99"), aligned(8)));
+static const struct S_strdata_2e100 D_strdata_2e100 __asm__("strdata.100") __attribute__((used, section(".rodata.strdata.100"), aligned(8)));
+static struct S_strliteral_2e101 D_strliteral_2e101 __asm__("strliteral.101") __attribute__((used, section(".data.rel.ro.strliteral.101"), aligned(8)));
+static const struct S_strdata_2e102 D_strdata_2e102 __asm__("strdata.102") __attribute__((used, section(".rodata.strdata.102"), aligned(8)));
+static struct S_strliteral_2e103 D_strliteral_2e103 __asm__("strliteral.103") __attribute__((used, section(".data.rel.ro.strliteral.103"), aligned(8)));
+static const struct S_strdata_2e104 D_strdata_2e104 __asm__("strdata.104") __attribute__((used, section(".rodata.strdata.104"), aligned(8)));
+static struct S_strliteral_2e105 D_strliteral_2e105 __asm__("strliteral.105") __attribute__((used, section(".data.rel.ro.strliteral.105"), aligned(8)));
+static const struct S_strdata_2e106 D_strdata_2e106 __asm__("strdata.106") __attribute__((used, section(".rodata.strdata.106"), aligned(8)));
+static struct S_strliteral_2e107 D_strliteral_2e107 __asm__("strliteral.107") __attribute__((used, section(".data.rel.ro.strliteral.107"), aligned(8)));
+static struct S_abortsites_2e142 D_abortsites_2e142 __asm__("abortsites.142") __attribute__((used, section(".data.rel.ro.abortsites.142"), aligned(8)));
+static struct S_abortsites_2e223 D_abortsites_2e223 __asm__("abortsites.223") __attribute__((used, section(".data.rel.ro.abortsites.223"), aligned(8)));
+static const struct S_strdata_2e283 D_strdata_2e283 __asm__("strdata.283") __attribute__((used, section(".rodata.strdata.283"), aligned(8)));
+static struct S_strliteral_2e284 D_strliteral_2e284 __asm__("strliteral.284") __attribute__((used, section(".data.rel.ro.strliteral.284"), aligned(8)));
+static struct S_abortsites_2e248 D_abortsites_2e248 __asm__("abortsites.248") __attribute__((used, section(".data.rel.ro.abortsites.248"), aligned(8)));
+static struct S_unpacking__global D_unpacking__global __asm__("unpacking_global") __attribute__((used, section(".bss.unpacking_global"), aligned(8)));
+static struct S_static_2e3 D_static_2e3 __asm__("static.3") __attribute__((used, section(".bss.static.3"), aligned(8)));
+static struct S_static_2e1 D_static_2e1 __asm__("static.1") __attribute__((used, section(".bss.static.1"), aligned(8)));
+static struct S_static_2e2 D_static_2e2 __asm__("static.2") __attribute__((used, section(".bss.static.2"), aligned(8)));
+static struct S_static_2e0 D_static_2e0 __asm__("static.0") __attribute__((used, section(".data.static.0"), aligned(8)));
+static struct S_abortsites_2e494 D_abortsites_2e494 __asm__("abortsites.494") __attribute__((used, section(".data.rel.ro.abortsites.494"), aligned(8)));
+static struct S_abortsites_2e530 D_abortsites_2e530 __asm__("abortsites.530") __attribute__((used, section(".data.rel.ro.abortsites.530"), aligned(8)));
+static struct S_abortsites_2e567 D_abortsites_2e567 __asm__("abortsites.567") __attribute__((used, section(".data.rel.ro.abortsites.567"), aligned(8)));
+static struct S_abortsites_2e612 D_abortsites_2e612 __asm__("abortsites.612") __attribute__((used, section(".data.rel.ro.abortsites.612"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F___never(void) __asm__("_never") __attribute__((used, section(".text._never")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_regression(void) __asm__("regression") __attribute__((used, section(".text.regression")));
+static void F_unpacking(void) __asm__("unpacking") __attribute__((used, section(".text.unpacking")));
+static u32 F_unpacking__addone(void) __asm__("unpacking_addone") __attribute__((used, section(".text.unpacking_addone")));
+static u64 F_unpacking__eval(u64 __rp) __asm__("unpacking_eval") __attribute__((used, section(".text.unpacking_eval")));
+static u64 F_unpacking__demo(u64 __rp) __asm__("unpacking_demo") __attribute__((used, section(".text.unpacking_demo")));
+static u32 F_unpacking__static(void) __asm__("unpacking_static") __attribute__((used, section(".text.unpacking_static")));
+static void F_eval__expr__access(void) __asm__("eval_expr_access") __attribute__((used, section(".text.eval_expr_access")));
+static void F_eval__expr__tuple(void) __asm__("eval_expr_tuple") __attribute__((used, section(".text.eval_expr_tuple")));
+static void F_funcs(void) __asm__("funcs") __attribute__((used, section(".text.funcs")));
+static u64 F_func(u64 __rp, u64 p_in) __asm__("func") __attribute__((used, section(".text.func")));
+static void F_assignment(void) __asm__("assignment") __attribute__((used, section(".text.assignment")));
+static void F_indexing(void) __asm__("indexing") __attribute__((used, section(".text.indexing")));
+static void F_storage(void) __asm__("storage") __attribute__((used, section(".text.storage")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\062\061\055\164\165\160\154\145\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 18U, 18U };
+static const struct S_strdata_2e35 D_strdata_2e35 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\144\145\146\040\050\170\054\040\171\051\040\075\040\050\061\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e36 D_strliteral_2e36 = { (char *)((char *)&D_strdata_2e35) + 0, 39U, 39U };
+static const struct S_strdata_2e37 D_strdata_2e37 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\072\040\050\050\051\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\175\073" };
+static struct S_strliteral_2e38 D_strliteral_2e38 = { (char *)((char *)&D_strdata_2e37) + 0, 45U, 45U };
+static const struct S_strdata_2e39 D_strdata_2e39 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\050\051\073\040\175\073" };
+static struct S_strliteral_2e40 D_strliteral_2e40 = { (char *)((char *)&D_strdata_2e39) + 0, 30U, 30U };
+static const struct S_strdata_2e41 D_strdata_2e41 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\051\040\075\040\050\051\073\040\175\073" };
+static struct S_strliteral_2e42 D_strliteral_2e42 = { (char *)((char *)&D_strdata_2e41) + 0, 31U, 31U };
+static const struct S_strdata_2e43 D_strdata_2e43 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\072\040\050\050\151\156\164\051\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\175\073" };
+static struct S_strliteral_2e44 D_strliteral_2e44 = { (char *)((char *)&D_strdata_2e43) + 0, 48U, 48U };
+static const struct S_strdata_2e45 D_strdata_2e45 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\072\040\050\050\156\165\154\154\054\040\151\156\164\051\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\175\073" };
+static struct S_strliteral_2e46 D_strliteral_2e46 = { (char *)((char *)&D_strdata_2e45) + 0, 54U, 54U };
+static const struct S_strdata_2e47 D_strdata_2e47 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\050\060\054\040\061\054\040\062\051\073\040\141\056\055\061\073\040\175\073" };
+static struct S_strliteral_2e48 D_strliteral_2e48 = { (char *)((char *)&D_strdata_2e47) + 0, 43U, 43U };
+static const struct S_strdata_2e49 D_strdata_2e49 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\050\060\054\040\061\054\040\062\051\056\055\061\073\040\175\073" };
+static struct S_strliteral_2e50 D_strliteral_2e50 = { (char *)((char *)&D_strdata_2e49) + 0, 40U, 40U };
+static const struct S_strdata_2e54 D_strdata_2e54 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\137\054\040\137\051\040\075\040\050\061\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e55 D_strliteral_2e55 = { (char *)((char *)&D_strdata_2e54) + 0, 39U, 39U };
+static const struct S_strdata_2e56 D_strdata_2e56 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\170\054\040\171\051\040\075\040\065\073\040\175\073" };
+static struct S_strliteral_2e57 D_strliteral_2e57 = { (char *)((char *)&D_strdata_2e56) + 0, 34U, 34U };
+static const struct S_strdata_2e58 D_strdata_2e58 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\141\054\040\142\051\072\040\151\156\164\040\075\040\050\062\054\040\063\051\073\040\175\073" };
+static struct S_strliteral_2e59 D_strliteral_2e59 = { (char *)((char *)&D_strdata_2e58) + 0, 44U, 44U };
+static const struct S_strdata_2e60 D_strdata_2e60 = { "\146\156\040\147\145\164\166\141\154\050\051\040\151\156\164\040\075\040\065\073\040\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\163\164\141\164\151\143\040\154\145\164\040\050\141\054\040\142\051\040\075\040\050\062\054\040\147\145\164\166\141\154\050\051\051\073\040\175\073" };
+static struct S_strliteral_2e61 D_strliteral_2e61 = { (char *)((char *)&D_strdata_2e60) + 0, 74U, 74U };
+static const struct S_strdata_2e62 D_strdata_2e62 = { "\146\156\040\147\145\164\166\141\154\050\051\040\151\156\164\040\075\040\065\073\040\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\163\164\141\164\151\143\040\154\145\164\040\050\141\054\040\137\051\040\075\040\050\062\054\040\147\145\164\166\141\154\050\051\051\073\040\175\073" };
+static struct S_strliteral_2e63 D_strliteral_2e63 = { (char *)((char *)&D_strdata_2e62) + 0, 74U, 74U };
+static const struct S_strdata_2e64 D_strdata_2e64 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\072\040\050\165\070\054\040\165\070\054\040\165\070\051\040\075\040\050\062\054\040\063\051\073\040\175\073" };
+static struct S_strliteral_2e65 D_strliteral_2e65 = { (char *)((char *)&D_strdata_2e64) + 0, 48U, 48U };
+static const struct S_strdata_2e66 D_strdata_2e66 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\072\040\050\165\070\054\040\165\070\051\040\075\040\050\062\054\040\063\051\073\040\154\145\164\040\142\072\040\050\165\070\054\040\165\070\054\040\165\070\051\040\075\040\141\073\040\175\073" };
+static struct S_strliteral_2e67 D_strliteral_2e67 = { (char *)((char *)&D_strdata_2e66) + 0, 69U, 69U };
+static const struct S_strdata_2e68 D_strdata_2e68 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\072\040\050\165\070\054\040\165\070\051\040\075\040\050\062\054\040\063\054\040\064\051\073\040\175\073" };
+static struct S_strliteral_2e69 D_strliteral_2e69 = { (char *)((char *)&D_strdata_2e68) + 0, 47U, 47U };
+static const struct S_strdata_2e70 D_strdata_2e70 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\072\040\050\165\070\054\040\165\070\054\040\165\070\051\040\075\040\050\062\054\040\063\054\040\064\051\073\040\154\145\164\040\142\072\040\050\165\070\054\040\165\070\051\040\075\040\141\073\040\175\073" };
+static struct S_strliteral_2e71 D_strliteral_2e71 = { (char *)((char *)&D_strdata_2e70) + 0, 72U, 72U };
+static const struct S_strdata_2e72 D_strdata_2e72 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\170\054\040\171\051\040\075\040\050\061\054\040\062\054\040\063\051\073\040\175\073" };
+static struct S_strliteral_2e73 D_strliteral_2e73 = { (char *)((char *)&D_strdata_2e72) + 0, 42U, 42U };
+static const struct S_strdata_2e74 D_strdata_2e74 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\170\054\040\171\054\040\172\051\040\075\040\050\061\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e75 D_strliteral_2e75 = { (char *)((char *)&D_strdata_2e74) + 0, 42U, 42U };
+static const struct S_strdata_2e76 D_strdata_2e76 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\170\054\040\171\054\040\137\051\040\075\040\050\061\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e77 D_strliteral_2e77 = { (char *)((char *)&D_strdata_2e76) + 0, 42U, 42U };
+static const struct S_strdata_2e78 D_strdata_2e78 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\170\054\040\137\054\040\137\051\040\075\040\050\061\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e79 D_strliteral_2e79 = { (char *)((char *)&D_strdata_2e78) + 0, 42U, 42U };
+static const struct S_strdata_2e80 D_strdata_2e80 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\050\064\165\051\073\040\141\056\060\073\040\175\073" };
+static struct S_strliteral_2e81 D_strliteral_2e81 = { (char *)((char *)&D_strdata_2e80) + 0, 37U, 37U };
+static const struct S_strdata_2e82 D_strdata_2e82 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\141\051\040\075\040\050\064\165\051\073\040\141\056\060\073\040\175\073" };
+static struct S_strliteral_2e83 D_strliteral_2e83 = { (char *)((char *)&D_strdata_2e82) + 0, 39U, 39U };
+static const struct S_strdata_2e84 D_strdata_2e84 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\141\051\040\075\040\064\165\073\040\141\056\060\073\040\175\073" };
+static struct S_strliteral_2e85 D_strliteral_2e85 = { (char *)((char *)&D_strdata_2e84) + 0, 37U, 37U };
+static const struct S_strdata_2e86 D_strdata_2e86 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\072\040\050\050\133\052\135\151\156\164\054\040\151\156\164\051\040\174\040\166\157\151\144\051\040\075\040\166\157\151\144\073\040\175\073" };
+static struct S_strliteral_2e87 D_strliteral_2e87 = { (char *)((char *)&D_strdata_2e86) + 0, 56U, 56U };
+static const struct S_strdata_2e88 D_strdata_2e88 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\050\164\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e89 D_strliteral_2e89 = { (char *)((char *)&D_strdata_2e88) + 0, 34U, 34U };
+static const struct S_strdata_2e90 D_strdata_2e90 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\141\054\040\142\051\040\075\040\050\164\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e91 D_strliteral_2e91 = { (char *)((char *)&D_strdata_2e90) + 0, 39U, 39U };
+static const struct S_strdata_2e92 D_strdata_2e92 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\137\054\040\142\051\040\075\040\050\164\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e93 D_strliteral_2e93 = { (char *)((char *)&D_strdata_2e92) + 0, 39U, 39U };
+static const struct S_strdata_2e94 D_strdata_2e94 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\050\156\165\154\154\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e95 D_strliteral_2e95 = { (char *)((char *)&D_strdata_2e94) + 0, 37U, 37U };
+static const struct S_strdata_2e96 D_strdata_2e96 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\141\054\040\142\051\040\075\040\050\156\165\154\154\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e97 D_strliteral_2e97 = { (char *)((char *)&D_strdata_2e96) + 0, 42U, 42U };
+static const struct S_strdata_2e98 D_strdata_2e98 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\050\137\054\040\142\051\040\075\040\050\156\165\154\154\054\040\062\051\073\040\175\073" };
+static struct S_strliteral_2e99 D_strliteral_2e99 = { (char *)((char *)&D_strdata_2e98) + 0, 42U, 42U };
+static const struct S_strdata_2e100 D_strdata_2e100 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\050\060\054\040\061\054\040\062\051\073\040\141\056\063\073\040\175\073" };
+static struct S_strliteral_2e101 D_strliteral_2e101 = { (char *)((char *)&D_strdata_2e100) + 0, 42U, 42U };
+static const struct S_strdata_2e102 D_strdata_2e102 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\050\060\054\040\061\054\040\062\051\056\063\073\040\175\073" };
+static struct S_strliteral_2e103 D_strliteral_2e103 = { (char *)((char *)&D_strdata_2e102) + 0, 39U, 39U };
+static const struct S_strdata_2e104 D_strdata_2e104 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\050\060\054\040\061\051\040\053\040\050\062\054\040\063\051\073\040\175\073" };
+static struct S_strliteral_2e105 D_strliteral_2e105 = { (char *)((char *)&D_strdata_2e104) + 0, 43U, 43U };
+static const struct S_strdata_2e106 D_strdata_2e106 = { "\146\156\040\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\050\060\054\040\061\051\073\040\141\040\053\075\040\050\062\054\040\063\051\073\040\175\073" };
+static struct S_strliteral_2e107 D_strliteral_2e107 = { (char *)((char *)&D_strdata_2e106) + 0, 47U, 47U };
+static struct S_abortsites_2e142 D_abortsites_2e142 = { (char *)((char *)&D_strliteral_2e1) + 0, 222U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 222U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 225U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 225U, 50U };
+static struct S_abortsites_2e223 D_abortsites_2e223 = { (char *)((char *)&D_strliteral_2e1) + 0, 161U, 15U };
+static const struct S_strdata_2e283 D_strdata_2e283 = { "\150\145\154\154\157" };
+static struct S_strliteral_2e284 D_strliteral_2e284 = { (char *)((char *)&D_strdata_2e283) + 0, 5U, 5U };
+static struct S_abortsites_2e248 D_abortsites_2e248 = { (char *)((char *)&D_strliteral_2e1) + 0, 101U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 103U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 107U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 111U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 117U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 118U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 121U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 125U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 126U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 129U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 130U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 134U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 135U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 140U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 144U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 147U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 148U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 152U, 15U };
+static struct S_unpacking__global D_unpacking__global = { 0U };
+static struct S_static_2e3 D_static_2e3 = { 0U };
+static struct S_static_2e1 D_static_2e1 = { 0U };
+static struct S_static_2e2 D_static_2e2 = { 0U };
+static struct S_static_2e0 D_static_2e0 = { 42U, 8U };
+static struct S_abortsites_2e494 D_abortsites_2e494 = { (char *)((char *)&D_strliteral_2e1) + 0, 70U, 15U };
+static struct S_abortsites_2e530 D_abortsites_2e530 = { (char *)((char *)&D_strliteral_2e1) + 0, 46U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 49U, 15U };
+static struct S_abortsites_2e567 D_abortsites_2e567 = { (char *)((char *)&D_strliteral_2e1) + 0, 36U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 37U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 38U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 40U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 41U, 15U };
+static struct S_abortsites_2e612 D_abortsites_2e612 = { (char *)((char *)&D_strliteral_2e1) + 0, 8U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 10U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 11U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 15U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 16U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 17U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 18U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 20U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 23U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 24U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 25U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 26U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_storage)))();
+	((void (*)(void))((u64)((char *)&F_indexing)))();
+	((void (*)(void))((u64)((char *)&F_assignment)))();
+	((void (*)(void))((u64)((char *)&F_funcs)))();
+	((void (*)(void))((u64)((char *)&F_eval__expr__tuple)))();
+	((void (*)(void))((u64)((char *)&F_eval__expr__access)))();
+	((void (*)(void))((u64)((char *)&F_unpacking)))();
+	((void (*)(void))((u64)((char *)&F_regression)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	((void (*)(void))((u64)((char *)&F___never)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F___never(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t_binding_2e13;
+	u64 t_binding_2e23;
+	u64 t_binding_2e24;
+	u64 t_tupleunpack_2e20;
+	u64 t_value_2e15;
+	u64 t_value_2e21;
+	L_start_2e7:;
+	t_binding_2e13 = (u64)A0;
+	t_tupleunpack_2e20 = (u64)A1;
+	t_binding_2e23 = (u64)((u64)t_tupleunpack_2e20 + (u64)((u64)0UL));
+	t_binding_2e24 = (u64)((u64)t_tupleunpack_2e20 + (u64)((u64)4UL));
+	L_body_2e8:;
+	t_value_2e15 = (u64)((u64)t_binding_2e13 + (u64)((u64)0UL));
+	goto L__2e11;
+	L__2e16:;
+	t_value_2e15 = (u64)((u64)t_binding_2e13 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e15 = (u32)((u64)1UL);
+	goto L__2e11;
+	L__2e17:;
+	L__2e11:;
+	t_value_2e21 = (u64)((u64)t_tupleunpack_2e20 + (u64)((u64)0UL));
+	goto L__2e18;
+	L__2e22:;
+	t_value_2e21 = (u64)((u64)t_tupleunpack_2e20 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e21 = (u32)((u64)1UL);
+	goto L__2e18;
+	L__2e25:;
+	L__2e18:;
+	goto L__2e9;
+	L__2e26:;
+	L__2e9:;
+	return;
+}
+static void F_reject(void) {
+	char A0[192] __attribute__((aligned(16)));
+	char A1[648] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char B8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[4] __attribute__((aligned(16)));
+	char B12[8] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char R15[4] __attribute__((aligned(16)));
+	u64 t__2e114;
+	u64 t__2e115;
+	u64 t__2e119;
+	u64 t__2e125;
+	u64 t__2e126;
+	u64 t__2e127;
+	u64 t__2e130;
+	u64 t__2e139;
+	u64 t__2e141;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e147;
+	u64 t__2e148;
+	u64 t__2e149;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e154;
+	u64 t__2e155;
+	u64 t__2e156;
+	u64 t__2e158;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e170;
+	u64 t__2e172;
+	u64 t__2e173;
+	u64 t__2e174;
+	u64 t__2e176;
+	u64 t__2e185;
+	u64 t__2e187;
+	u64 t__2e190;
+	u64 t_abortsite_2e143;
+	u64 t_binding_2e113;
+	u64 t_binding_2e164;
+	u64 t_binding_2e31;
+	u64 t_binding_2e51;
+	u64 t_item_2e34;
+	u64 t_item_2e53;
+	u64 t_object_2e121;
+	u64 t_object_2e128;
+	u64 t_object_2e171;
+	u64 t_object_2e175;
+	u64 t_tag_2e131;
+	u64 t_tag_2e177;
+	L_start_2e27:;
+	t_binding_2e31 = (u64)A0;
+	t_binding_2e51 = (u64)A1;
+	t_binding_2e113 = (u64)A2;
+	t_object_2e121 = (u64)A3;
+	t_object_2e128 = (u64)A4;
+	t_binding_2e164 = (u64)A5;
+	t_object_2e171 = (u64)A6;
+	t_object_2e175 = (u64)A7;
+	L_body_2e28:;
+	t_item_2e34 = (u64)((u64)t_binding_2e31 + (u64)((u64)0UL));
+	BLIT(t_item_2e34, ((u64)((char *)&D_strliteral_2e36)), ((u64)24UL));
+	t_item_2e34 = (u64)((u64)t_binding_2e31 + (u64)((u64)24UL));
+	BLIT(t_item_2e34, ((u64)((char *)&D_strliteral_2e38)), ((u64)24UL));
+	t_item_2e34 = (u64)((u64)t_binding_2e31 + (u64)((u64)48UL));
+	BLIT(t_item_2e34, ((u64)((char *)&D_strliteral_2e40)), ((u64)24UL));
+	t_item_2e34 = (u64)((u64)t_binding_2e31 + (u64)((u64)72UL));
+	BLIT(t_item_2e34, ((u64)((char *)&D_strliteral_2e42)), ((u64)24UL));
+	t_item_2e34 = (u64)((u64)t_binding_2e31 + (u64)((u64)96UL));
+	BLIT(t_item_2e34, ((u64)((char *)&D_strliteral_2e44)), ((u64)24UL));
+	t_item_2e34 = (u64)((u64)t_binding_2e31 + (u64)((u64)120UL));
+	BLIT(t_item_2e34, ((u64)((char *)&D_strliteral_2e46)), ((u64)24UL));
+	t_item_2e34 = (u64)((u64)t_binding_2e31 + (u64)((u64)144UL));
+	BLIT(t_item_2e34, ((u64)((char *)&D_strliteral_2e48)), ((u64)24UL));
+	t_item_2e34 = (u64)((u64)t_binding_2e31 + (u64)((u64)168UL));
+	BLIT(t_item_2e34, ((u64)((char *)&D_strliteral_2e50)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)0UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e55)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)24UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e57)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)48UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e59)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)72UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e61)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)96UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e63)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)120UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e65)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)144UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e67)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)168UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e69)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)192UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e71)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)216UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e73)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)240UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e75)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)264UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e77)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)288UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e79)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)312UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e81)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)336UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e83)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)360UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e85)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)384UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e87)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)408UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e89)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)432UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e91)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)456UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e93)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)480UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e95)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)504UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e97)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)528UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e99)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)552UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e101)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)576UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e103)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)600UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e105)), ((u64)24UL));
+	t_item_2e53 = (u64)((u64)t_binding_2e51 + (u64)((u64)624UL));
+	BLIT(t_item_2e53, ((u64)((char *)&D_strliteral_2e107)), ((u64)24UL));
+	*(u64 *)t_binding_2e113 = (u64)((u64)0UL);
+	L_loop_2e108:;
+	t__2e115 = (u64)(*(u64 *)t_binding_2e113);
+	t__2e114 = (u64)(u32)(((u64)t__2e115 < (u64)((u64)8UL)));
+	if ((u32)t__2e114) goto L_body_2e109; else goto L__2e111;
+	L_body_2e109:;
+	*(u32 *)t_object_2e121 = (u32)((u64)3532310079UL);
+	t__2e125 = (u64)((u64)t_object_2e121 + (u64)((u64)4UL));
+	*(u32 *)t__2e125 = (u32)((u64)3UL);
+	t__2e127 = (u64)(*(u64 *)t_binding_2e113);
+	t__2e126 = (u64)((u64)t__2e127 * (u64)((u64)24UL));
+	t__2e126 = (u64)((u64)t_binding_2e31 + (u64)t__2e126);
+	*(u64 *)t_object_2e128 = (u64)((u64)0UL);
+	t__2e130 = (u64)((u64)t_object_2e128 + (u64)((u64)8UL));
+	*(u64 *)t__2e130 = (u64)((u64)0UL);
+	t__2e130 = (u64)((u64)t__2e130 + (u64)((u64)8UL));
+	*(u64 *)t__2e130 = (u64)((u64)0UL);
+	BLIT((u64)B8, t_object_2e121, 8);
+	BLIT((u64)B9, t__2e126, 24);
+	BLIT((u64)B10, t_object_2e128, 24);
+	t__2e119 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R11, (u64)B8, (u64)B9, (u64)B10);
+	t_tag_2e131 = (u64)(*(u32 *)t__2e119);
+	t__2e139 = (u64)(u32)(((u32)t_tag_2e131 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e139) goto L_member_2e136; else goto L__2e138;
+	L__2e138:;
+	t__2e141 = (u64)(u32)(((u32)t_tag_2e131 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e141) goto L_member_2e137; else goto L__2e140;
+	L__2e140:;
+	goto L_matches_2e135;
+	L_member_2e136:;
+	goto L_matches_2e135;
+	L_member_2e137:;
+	goto L_matches_2e134;
+	L_matches_2e134:;
+	goto L__2e132;
+	L_matches_2e135:;
+	t_abortsite_2e143 = ((u64)0UL);
+	goto L_abort_2e144;
+	L__2e150:;
+	L__2e133:;
+	t_abortsite_2e143 = ((u64)1UL);
+	goto L_abort_2e151;
+	L__2e132:;
+	goto L__2e116;
+	L__2e157:;
+	L__2e116:;
+	L_after_2e112:;
+	t__2e158 = (u64)(*(u64 *)t_binding_2e113);
+	t__2e158 = (u64)((u64)t__2e158 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e113 = (u64)t__2e158;
+	goto L_loop_2e108;
+	L__2e111:;
+	*(u64 *)t_binding_2e164 = (u64)((u64)0UL);
+	L_loop_2e159:;
+	t__2e166 = (u64)(*(u64 *)t_binding_2e164);
+	t__2e165 = (u64)(u32)(((u64)t__2e166 < (u64)((u64)27UL)));
+	if ((u32)t__2e165) goto L_body_2e160; else goto L__2e162;
+	L_body_2e160:;
+	*(u32 *)t_object_2e171 = (u32)((u64)3532310079UL);
+	t__2e172 = (u64)((u64)t_object_2e171 + (u64)((u64)4UL));
+	*(u32 *)t__2e172 = (u32)((u64)4UL);
+	t__2e174 = (u64)(*(u64 *)t_binding_2e164);
+	t__2e173 = (u64)((u64)t__2e174 * (u64)((u64)24UL));
+	t__2e173 = (u64)((u64)t_binding_2e51 + (u64)t__2e173);
+	*(u64 *)t_object_2e175 = (u64)((u64)0UL);
+	t__2e176 = (u64)((u64)t_object_2e175 + (u64)((u64)8UL));
+	*(u64 *)t__2e176 = (u64)((u64)0UL);
+	t__2e176 = (u64)((u64)t__2e176 + (u64)((u64)8UL));
+	*(u64 *)t__2e176 = (u64)((u64)0UL);
+	BLIT((u64)B12, t_object_2e171, 8);
+	BLIT((u64)B13, t__2e173, 24);
+	BLIT((u64)B14, t_object_2e175, 24);
+	t__2e170 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R15, (u64)B12, (u64)B13, (u64)B14);
+	t_tag_2e177 = (u64)(*(u32 *)t__2e170);
+	t__2e185 = (u64)(u32)(((u32)t_tag_2e177 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e185) goto L_member_2e182; else goto L__2e184;
+	L__2e184:;
+	t__2e187 = (u64)(u32)(((u32)t_tag_2e177 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e187) goto L_member_2e183; else goto L__2e186;
+	L__2e186:;
+	goto L_matches_2e181;
+	L_member_2e182:;
+	goto L_matches_2e181;
+	L_member_2e183:;
+	goto L_matches_2e180;
+	L_matches_2e180:;
+	goto L__2e178;
+	L_matches_2e181:;
+	t_abortsite_2e143 = ((u64)2UL);
+	goto L_abort_2e144;
+	L__2e188:;
+	L__2e179:;
+	t_abortsite_2e143 = ((u64)3UL);
+	goto L_abort_2e151;
+	L__2e178:;
+	goto L__2e167;
+	L__2e189:;
+	L__2e167:;
+	L_after_2e163:;
+	t__2e190 = (u64)(*(u64 *)t_binding_2e164);
+	t__2e190 = (u64)((u64)t__2e190 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e164 = (u64)t__2e190;
+	goto L_loop_2e159;
+	L__2e162:;
+	goto L__2e29;
+	L__2e191:;
+	L__2e29:;
+	return;
+	L_abort_2e144:;
+	t__2e145 = (u64)((u64)t_abortsite_2e143 * (u64)((u64)16UL));
+	t__2e145 = (u64)((u64)((u64)((char *)&D_abortsites_2e142)) + (u64)t__2e145);
+	t__2e146 = (u64)(*(u64 *)t__2e145);
+	t__2e147 = (u64)((u64)t__2e145 + (u64)((u64)8UL));
+	t__2e148 = (u64)(*(u32 *)t__2e147);
+	t__2e147 = (u64)((u64)t__2e145 + (u64)((u64)12UL));
+	t__2e149 = (u64)(*(u32 *)t__2e147);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e146, (u64)t__2e148, (u64)t__2e149, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e151:;
+	t__2e152 = (u64)((u64)t_abortsite_2e143 * (u64)((u64)16UL));
+	t__2e152 = (u64)((u64)((u64)((char *)&D_abortsites_2e142)) + (u64)t__2e152);
+	t__2e153 = (u64)(*(u64 *)t__2e152);
+	t__2e154 = (u64)((u64)t__2e152 + (u64)((u64)8UL));
+	t__2e155 = (u64)(*(u32 *)t__2e154);
+	t__2e154 = (u64)((u64)t__2e152 + (u64)((u64)12UL));
+	t__2e156 = (u64)(*(u32 *)t__2e154);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e153, (u64)t__2e155, (u64)t__2e156, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_regression(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e204;
+	u64 t__2e211;
+	u64 t__2e214;
+	u64 t__2e217;
+	u64 t__2e219;
+	u64 t__2e220;
+	u64 t__2e222;
+	u64 t__2e226;
+	u64 t__2e227;
+	u64 t__2e228;
+	u64 t__2e229;
+	u64 t__2e230;
+	u64 t_abortsite_2e224;
+	u64 t_binding_2e196;
+	u64 t_binding_2e206;
+	u64 t_object_2e208;
+	u64 t_value_2e205;
+	u64 t_value_2e207;
+	u64 t_value_2e209;
+	u64 t_value_2e210;
+	u64 t_value_2e218;
+	u64 t_value_2e221;
+	L_start_2e192:;
+	t_binding_2e196 = (u64)A0;
+	t_binding_2e206 = (u64)A1;
+	t_object_2e208 = (u64)A2;
+	L_body_2e193:;
+	*(u32 *)t_binding_2e196 = (u32)((u64)413955876UL);
+	t__2e204 = (u64)((u64)t_binding_2e196 + (u64)((u64)4UL));
+	t_value_2e205 = (u64)((u64)t__2e204 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e205 = (u32)((u64)3012680272UL);
+	t_value_2e205 = (u64)((u64)t__2e204 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e205 = (u32)((u64)0UL);
+	t_value_2e207 = (u64)((u64)t_binding_2e206 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e207 = (u32)((u64)1UL);
+	t_value_2e207 = (u64)((u64)t_binding_2e206 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e207 = (u32)((u64)0UL);
+	t_value_2e209 = (u64)((u64)t_object_2e208 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e209 = (u32)((u64)2UL);
+	t_value_2e209 = (u64)((u64)t_object_2e208 + (u64)((u64)4UL));
+	t_value_2e210 = (u64)((u64)t_binding_2e206 + (u64)((u64)0UL));
+	t__2e211 = (u64)(u32)(*(i32 *)t_value_2e210);
+	*(u32 *)t_value_2e209 = (u32)t__2e211;
+	BLIT(t_binding_2e206, t_object_2e208, ((u64)8UL));
+	t_value_2e218 = (u64)((u64)t_binding_2e206 + (u64)((u64)0UL));
+	t__2e219 = (u64)(u32)(*(i32 *)t_value_2e218);
+	t__2e217 = (u64)(u32)(((u32)t__2e219 == (u32)((u64)2UL)));
+	t__2e214 = (u64)(u32)t__2e217;
+	if ((u32)t__2e214) goto L__2e215; else goto L__2e216;
+	L__2e215:;
+	t_value_2e221 = (u64)((u64)t_binding_2e206 + (u64)((u64)4UL));
+	t__2e222 = (u64)(u32)(*(i32 *)t_value_2e221);
+	t__2e220 = (u64)(u32)(((u32)t__2e222 == (u32)((u64)1UL)));
+	t__2e214 = (u64)(u32)t__2e220;
+	goto L__2e216;
+	L__2e216:;
+	if ((u32)t__2e214) goto L_passed_2e213; else goto L_failed_2e212;
+	L_failed_2e212:;
+	t_abortsite_2e224 = ((u64)0UL);
+	goto L_abort_2e225;
+	L_passed_2e213:;
+	goto L__2e194;
+	L__2e231:;
+	L__2e194:;
+	return;
+	L_abort_2e225:;
+	t__2e226 = (u64)((u64)t_abortsite_2e224 * (u64)((u64)16UL));
+	t__2e226 = (u64)((u64)((u64)((char *)&D_abortsites_2e223)) + (u64)t__2e226);
+	t__2e227 = (u64)(*(u64 *)t__2e226);
+	t__2e228 = (u64)((u64)t__2e226 + (u64)((u64)8UL));
+	t__2e229 = (u64)(*(u32 *)t__2e228);
+	t__2e228 = (u64)((u64)t__2e226 + (u64)((u64)12UL));
+	t__2e230 = (u64)(*(u32 *)t__2e228);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e227, (u64)t__2e229, (u64)t__2e230, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_unpacking(void) {
+	char A0[12] __attribute__((aligned(16)));
+	char A1[12] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	char A3[40] __attribute__((aligned(16)));
+	char A4[16] __attribute__((aligned(16)));
+	char A5[12] __attribute__((aligned(16)));
+	char A6[12] __attribute__((aligned(16)));
+	char A7[12] __attribute__((aligned(16)));
+	char A8[12] __attribute__((aligned(16)));
+	char A9[12] __attribute__((aligned(16)));
+	char A10[12] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[4] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[8] __attribute__((aligned(16)));
+	char A16[16] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char R19[8] __attribute__((aligned(16)));
+	char R20[8] __attribute__((aligned(16)));
+	u64 t__2e246;
+	u64 t__2e247;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e253;
+	u64 t__2e254;
+	u64 t__2e255;
+	u64 t__2e258;
+	u64 t__2e259;
+	u64 t__2e262;
+	u64 t__2e263;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e277;
+	u64 t__2e278;
+	u64 t__2e282;
+	u64 t__2e290;
+	u64 t__2e291;
+	u64 t__2e294;
+	u64 t__2e297;
+	u64 t__2e298;
+	u64 t__2e302;
+	u64 t__2e303;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e310;
+	u64 t__2e311;
+	u64 t__2e314;
+	u64 t__2e315;
+	u64 t__2e323;
+	u64 t__2e324;
+	u64 t__2e327;
+	u64 t__2e328;
+	u64 t__2e336;
+	u64 t__2e337;
+	u64 t__2e340;
+	u64 t__2e341;
+	u64 t__2e349;
+	u64 t__2e350;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e362;
+	u64 t__2e363;
+	u64 t__2e366;
+	u64 t__2e367;
+	u64 t__2e368;
+	u64 t__2e369;
+	u64 t__2e371;
+	u64 t__2e374;
+	u64 t__2e375;
+	u64 t__2e377;
+	u64 t__2e383;
+	u64 t__2e384;
+	u64 t__2e387;
+	u64 t__2e388;
+	u64 t__2e390;
+	u64 t__2e395;
+	u64 t__2e396;
+	u64 t__2e399;
+	u64 t__2e400;
+	u64 t__2e404;
+	u64 t__2e405;
+	u64 t__2e406;
+	u64 t__2e407;
+	u64 t__2e413;
+	u64 t__2e416;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e421;
+	u64 t__2e422;
+	u64 t__2e423;
+	u64 t__2e424;
+	u64 t_abortsite_2e249;
+	u64 t_binding_2e241;
+	u64 t_binding_2e242;
+	u64 t_binding_2e243;
+	u64 t_binding_2e269;
+	u64 t_binding_2e270;
+	u64 t_binding_2e285;
+	u64 t_binding_2e286;
+	u64 t_binding_2e287;
+	u64 t_binding_2e304;
+	u64 t_binding_2e305;
+	u64 t_binding_2e319;
+	u64 t_binding_2e320;
+	u64 t_binding_2e332;
+	u64 t_binding_2e333;
+	u64 t_binding_2e345;
+	u64 t_binding_2e346;
+	u64 t_binding_2e355;
+	u64 t_binding_2e358;
+	u64 t_binding_2e359;
+	u64 t_binding_2e370;
+	u64 t_binding_2e379;
+	u64 t_binding_2e380;
+	u64 t_binding_2e391;
+	u64 t_binding_2e392;
+	u64 t_binding_2e408;
+	u64 t_binding_2e409;
+	u64 t_binding_2e410;
+	u64 t_object_2e237;
+	u64 t_object_2e317;
+	u64 t_object_2e330;
+	u64 t_object_2e343;
+	u64 t_tupleunpack_2e236;
+	u64 t_tupleunpack_2e264;
+	u64 t_tupleunpack_2e279;
+	u64 t_tupleunpack_2e299;
+	u64 t_tupleunpack_2e316;
+	u64 t_tupleunpack_2e329;
+	u64 t_tupleunpack_2e342;
+	u64 t_tupleunpack_2e357;
+	u64 t_tupleunpack_2e376;
+	u64 t_tupleunpack_2e389;
+	u64 t_tupleunpack_2e401;
+	u64 t_value_2e239;
+	u64 t_value_2e266;
+	u64 t_value_2e281;
+	u64 t_value_2e301;
+	u64 t_value_2e318;
+	u64 t_value_2e331;
+	u64 t_value_2e344;
+	u64 t_value_2e356;
+	u64 t_value_2e403;
+	L_start_2e232:;
+	t_tupleunpack_2e236 = (u64)A0;
+	t_object_2e237 = (u64)A1;
+	t_binding_2e241 = (u64)((u64)t_tupleunpack_2e236 + (u64)((u64)0UL));
+	t_binding_2e242 = (u64)((u64)t_tupleunpack_2e236 + (u64)((u64)4UL));
+	t_binding_2e243 = (u64)((u64)t_tupleunpack_2e236 + (u64)((u64)8UL));
+	t_tupleunpack_2e264 = (u64)A2;
+	t_binding_2e269 = (u64)((u64)t_tupleunpack_2e264 + (u64)((u64)0UL));
+	t_binding_2e270 = (u64)((u64)t_tupleunpack_2e264 + (u64)((u64)8UL));
+	t_tupleunpack_2e279 = (u64)A3;
+	t_binding_2e285 = (u64)((u64)t_tupleunpack_2e279 + (u64)((u64)0UL));
+	t_binding_2e286 = (u64)((u64)t_tupleunpack_2e279 + (u64)((u64)8UL));
+	t_binding_2e287 = (u64)((u64)t_tupleunpack_2e279 + (u64)((u64)32UL));
+	t_tupleunpack_2e299 = (u64)A4;
+	t_binding_2e304 = (u64)((u64)t_tupleunpack_2e299 + (u64)((u64)0UL));
+	t_binding_2e305 = (u64)((u64)t_tupleunpack_2e299 + (u64)((u64)8UL));
+	t_tupleunpack_2e316 = (u64)A5;
+	t_object_2e317 = (u64)A6;
+	t_binding_2e319 = (u64)((u64)t_tupleunpack_2e316 + (u64)((u64)4UL));
+	t_binding_2e320 = (u64)((u64)t_tupleunpack_2e316 + (u64)((u64)8UL));
+	t_tupleunpack_2e329 = (u64)A7;
+	t_object_2e330 = (u64)A8;
+	t_binding_2e332 = (u64)((u64)t_tupleunpack_2e329 + (u64)((u64)0UL));
+	t_binding_2e333 = (u64)((u64)t_tupleunpack_2e329 + (u64)((u64)8UL));
+	t_tupleunpack_2e342 = (u64)A9;
+	t_object_2e343 = (u64)A10;
+	t_binding_2e345 = (u64)((u64)t_tupleunpack_2e342 + (u64)((u64)0UL));
+	t_binding_2e346 = (u64)((u64)t_tupleunpack_2e342 + (u64)((u64)4UL));
+	t_binding_2e355 = (u64)A11;
+	t_tupleunpack_2e357 = (u64)A12;
+	t_binding_2e358 = (u64)((u64)t_tupleunpack_2e357 + (u64)((u64)0UL));
+	t_binding_2e359 = (u64)((u64)t_tupleunpack_2e357 + (u64)((u64)4UL));
+	t_binding_2e370 = (u64)A13;
+	t_tupleunpack_2e376 = (u64)A14;
+	t_binding_2e379 = (u64)((u64)t_tupleunpack_2e376 + (u64)((u64)0UL));
+	t_binding_2e380 = (u64)((u64)t_tupleunpack_2e376 + (u64)((u64)4UL));
+	t_tupleunpack_2e389 = (u64)A15;
+	t_binding_2e391 = (u64)((u64)t_tupleunpack_2e389 + (u64)((u64)0UL));
+	t_binding_2e392 = (u64)((u64)t_tupleunpack_2e389 + (u64)((u64)4UL));
+	t_tupleunpack_2e401 = (u64)A16;
+	t_binding_2e408 = (u64)((u64)t_tupleunpack_2e401 + (u64)((u64)0UL));
+	t_binding_2e409 = (u64)((u64)t_tupleunpack_2e401 + (u64)((u64)4UL));
+	t_binding_2e410 = (u64)((u64)t_tupleunpack_2e401 + (u64)((u64)12UL));
+	L_body_2e233:;
+	t_value_2e239 = (u64)((u64)t_object_2e237 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e239 = (u32)((u64)42UL);
+	t_value_2e239 = (u64)((u64)t_object_2e237 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e239 = (u32)((u64)8UL);
+	t_value_2e239 = (u64)((u64)t_object_2e237 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e239 = (u32)((u64)12UL);
+	BLIT(t_tupleunpack_2e236, t_object_2e237, ((u64)12UL));
+	t__2e247 = (u64)(u32)(*(i32 *)t_binding_2e241);
+	t__2e246 = (u64)(u32)(((u32)t__2e247 == (u32)((u64)42UL)));
+	if ((u32)t__2e246) goto L_passed_2e245; else goto L_failed_2e244;
+	L_failed_2e244:;
+	t_abortsite_2e249 = ((u64)0UL);
+	goto L_abort_2e250;
+	L_passed_2e245:;
+	t__2e259 = (u64)(u32)(*(i32 *)t_binding_2e242);
+	t__2e258 = (u64)(u32)(((u32)t__2e259 == (u32)((u64)8UL)));
+	if ((u32)t__2e258) goto L_passed_2e257; else goto L_failed_2e256;
+	L_failed_2e256:;
+	t_abortsite_2e249 = ((u64)1UL);
+	goto L_abort_2e250;
+	L_passed_2e257:;
+	t__2e263 = (u64)(u32)(*(i32 *)t_binding_2e243);
+	t__2e262 = (u64)(u32)(((u32)t__2e263 == (u32)((u64)12UL)));
+	if ((u32)t__2e262) goto L_passed_2e261; else goto L_failed_2e260;
+	L_failed_2e260:;
+	t_abortsite_2e249 = ((u64)2UL);
+	goto L_abort_2e250;
+	L_passed_2e261:;
+	t_value_2e266 = (u64)((u64)t_tupleunpack_2e264 + (u64)((u64)0UL));
+	t__2e267 = (u64)((i64)(i32)((u64)2UL));
+	*(u64 *)t_value_2e266 = (u64)t__2e267;
+	t_value_2e266 = (u64)((u64)t_tupleunpack_2e264 + (u64)((u64)8UL));
+	t__2e268 = ((u64)4UL);
+	*(u64 *)t_value_2e266 = (u64)t__2e268;
+	t__2e274 = (u64)(*(u64 *)t_binding_2e269);
+	t__2e273 = (u64)(u32)(((u64)t__2e274 == (u64)((u64)2UL)));
+	if ((u32)t__2e273) goto L_passed_2e272; else goto L_failed_2e271;
+	L_failed_2e271:;
+	t_abortsite_2e249 = ((u64)3UL);
+	goto L_abort_2e250;
+	L_passed_2e272:;
+	t__2e278 = (u64)(*(u64 *)t_binding_2e270);
+	t__2e277 = (u64)(u32)(((u64)t__2e278 == (u64)((u64)4UL)));
+	if ((u32)t__2e277) goto L_passed_2e276; else goto L_failed_2e275;
+	L_failed_2e275:;
+	t_abortsite_2e249 = ((u64)4UL);
+	goto L_abort_2e250;
+	L_passed_2e276:;
+	t_value_2e281 = (u64)((u64)t_tupleunpack_2e279 + (u64)((u64)0UL));
+	t__2e282 = (u64)((i64)(i32)((u64)2UL));
+	*(u64 *)t_value_2e281 = (u64)t__2e282;
+	t_value_2e281 = (u64)((u64)t_tupleunpack_2e279 + (u64)((u64)8UL));
+	BLIT(t_value_2e281, ((u64)((char *)&D_strliteral_2e284)), ((u64)24UL));
+	t_value_2e281 = (u64)((u64)t_tupleunpack_2e279 + (u64)((u64)32UL));
+	*(u64 *)t_value_2e281 = (u64)((u64)4607182418800017408UL);
+	t__2e291 = (u64)(*(u64 *)t_binding_2e285);
+	t__2e290 = (u64)(u32)(((u64)t__2e291 == (u64)((u64)2UL)));
+	if ((u32)t__2e290) goto L_passed_2e289; else goto L_failed_2e288;
+	L_failed_2e288:;
+	t_abortsite_2e249 = ((u64)5UL);
+	goto L_abort_2e250;
+	L_passed_2e289:;
+	BLIT((u64)B17, t_binding_2e286, 24);
+	BLIT((u64)B18, ((u64)((char *)&D_strliteral_2e284)), 24);
+	t__2e294 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B17, (u64)B18));
+	if ((u32)t__2e294) goto L_passed_2e293; else goto L_failed_2e292;
+	L_failed_2e292:;
+	t_abortsite_2e249 = ((u64)6UL);
+	goto L_abort_2e250;
+	L_passed_2e293:;
+	t__2e298 = (u64)(*(u64 *)t_binding_2e287);
+	t__2e297 = (u64)(u32)((BD(t__2e298) == BD(((u64)4607182418800017408UL))));
+	if ((u32)t__2e297) goto L_passed_2e296; else goto L_failed_2e295;
+	L_failed_2e295:;
+	t_abortsite_2e249 = ((u64)7UL);
+	goto L_abort_2e250;
+	L_passed_2e296:;
+	t_value_2e301 = (u64)((u64)t_tupleunpack_2e299 + (u64)((u64)0UL));
+	t__2e302 = (u64)((i64)(i32)((u64)1UL));
+	*(u64 *)t_value_2e301 = (u64)t__2e302;
+	t_value_2e301 = (u64)((u64)t_tupleunpack_2e299 + (u64)((u64)8UL));
+	t__2e303 = ((u64)3UL);
+	*(u64 *)t_value_2e301 = (u64)t__2e303;
+	t__2e306 = (u64)(*(u64 *)t_binding_2e304);
+	t__2e306 = (u64)((u64)t__2e306 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e304 = (u64)t__2e306;
+	t__2e307 = (u64)(*(u64 *)t_binding_2e305);
+	t__2e307 = (u64)((u64)t__2e307 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e305 = (u64)t__2e307;
+	t__2e311 = (u64)(*(u64 *)t_binding_2e304);
+	t__2e310 = (u64)(u32)(((u64)t__2e311 == (u64)((u64)2UL)));
+	if ((u32)t__2e310) goto L_passed_2e309; else goto L_failed_2e308;
+	L_failed_2e308:;
+	t_abortsite_2e249 = ((u64)8UL);
+	goto L_abort_2e250;
+	L_passed_2e309:;
+	t__2e315 = (u64)(*(u64 *)t_binding_2e305);
+	t__2e314 = (u64)(u32)(((u64)t__2e315 == (u64)((u64)4UL)));
+	if ((u32)t__2e314) goto L_passed_2e313; else goto L_failed_2e312;
+	L_failed_2e312:;
+	t_abortsite_2e249 = ((u64)9UL);
+	goto L_abort_2e250;
+	L_passed_2e313:;
+	t_value_2e318 = (u64)((u64)t_object_2e317 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e318 = (u32)((u64)1UL);
+	t_value_2e318 = (u64)((u64)t_object_2e317 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e318 = (u32)((u64)2UL);
+	t_value_2e318 = (u64)((u64)t_object_2e317 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e318 = (u32)((u64)3UL);
+	BLIT(t_tupleunpack_2e316, t_object_2e317, ((u64)12UL));
+	t__2e324 = (u64)(u32)(*(i32 *)t_binding_2e319);
+	t__2e323 = (u64)(u32)(((u32)t__2e324 == (u32)((u64)2UL)));
+	if ((u32)t__2e323) goto L_passed_2e322; else goto L_failed_2e321;
+	L_failed_2e321:;
+	t_abortsite_2e249 = ((u64)10UL);
+	goto L_abort_2e250;
+	L_passed_2e322:;
+	t__2e328 = (u64)(u32)(*(i32 *)t_binding_2e320);
+	t__2e327 = (u64)(u32)(((u32)t__2e328 == (u32)((u64)3UL)));
+	if ((u32)t__2e327) goto L_passed_2e326; else goto L_failed_2e325;
+	L_failed_2e325:;
+	t_abortsite_2e249 = ((u64)11UL);
+	goto L_abort_2e250;
+	L_passed_2e326:;
+	t_value_2e331 = (u64)((u64)t_object_2e330 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e331 = (u32)((u64)1UL);
+	t_value_2e331 = (u64)((u64)t_object_2e330 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e331 = (u32)((u64)2UL);
+	t_value_2e331 = (u64)((u64)t_object_2e330 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e331 = (u32)((u64)3UL);
+	BLIT(t_tupleunpack_2e329, t_object_2e330, ((u64)12UL));
+	t__2e337 = (u64)(u32)(*(i32 *)t_binding_2e332);
+	t__2e336 = (u64)(u32)(((u32)t__2e337 == (u32)((u64)1UL)));
+	if ((u32)t__2e336) goto L_passed_2e335; else goto L_failed_2e334;
+	L_failed_2e334:;
+	t_abortsite_2e249 = ((u64)12UL);
+	goto L_abort_2e250;
+	L_passed_2e335:;
+	t__2e341 = (u64)(u32)(*(i32 *)t_binding_2e333);
+	t__2e340 = (u64)(u32)(((u32)t__2e341 == (u32)((u64)3UL)));
+	if ((u32)t__2e340) goto L_passed_2e339; else goto L_failed_2e338;
+	L_failed_2e338:;
+	t_abortsite_2e249 = ((u64)13UL);
+	goto L_abort_2e250;
+	L_passed_2e339:;
+	t_value_2e344 = (u64)((u64)t_object_2e343 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e344 = (u32)((u64)1UL);
+	t_value_2e344 = (u64)((u64)t_object_2e343 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e344 = (u32)((u64)2UL);
+	t_value_2e344 = (u64)((u64)t_object_2e343 + (u64)((u64)8UL));
+	*(u32 *)t_value_2e344 = (u32)((u64)3UL);
+	BLIT(t_tupleunpack_2e342, t_object_2e343, ((u64)12UL));
+	t__2e350 = (u64)(u32)(*(i32 *)t_binding_2e345);
+	t__2e349 = (u64)(u32)(((u32)t__2e350 == (u32)((u64)1UL)));
+	if ((u32)t__2e349) goto L_passed_2e348; else goto L_failed_2e347;
+	L_failed_2e347:;
+	t_abortsite_2e249 = ((u64)14UL);
+	goto L_abort_2e250;
+	L_passed_2e348:;
+	t__2e354 = (u64)(u32)(*(i32 *)t_binding_2e346);
+	t__2e353 = (u64)(u32)(((u32)t__2e354 == (u32)((u64)2UL)));
+	if ((u32)t__2e353) goto L_passed_2e352; else goto L_failed_2e351;
+	L_failed_2e351:;
+	t_abortsite_2e249 = ((u64)15UL);
+	goto L_abort_2e250;
+	L_passed_2e352:;
+	t_value_2e356 = (u64)((u64)t_binding_2e355 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e356 = (u32)((u64)1UL);
+	t_value_2e356 = (u64)((u64)t_binding_2e355 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e356 = (u32)((u64)2UL);
+	BLIT(t_tupleunpack_2e357, t_binding_2e355, ((u64)8UL));
+	t__2e363 = (u64)(u32)(*(i32 *)t_binding_2e358);
+	t__2e362 = (u64)(u32)(((u32)t__2e363 == (u32)((u64)1UL)));
+	if ((u32)t__2e362) goto L_passed_2e361; else goto L_failed_2e360;
+	L_failed_2e360:;
+	t_abortsite_2e249 = ((u64)16UL);
+	goto L_abort_2e250;
+	L_passed_2e361:;
+	t__2e367 = (u64)(u32)(*(i32 *)t_binding_2e359);
+	t__2e366 = (u64)(u32)(((u32)t__2e367 == (u32)((u64)2UL)));
+	if ((u32)t__2e366) goto L_passed_2e365; else goto L_failed_2e364;
+	L_failed_2e364:;
+	t_abortsite_2e249 = ((u64)17UL);
+	goto L_abort_2e250;
+	L_passed_2e365:;
+	t__2e368 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_unpacking__static)))());
+	t__2e369 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_unpacking__static)))());
+	t__2e371 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_unpacking__static)))());
+	*(u32 *)t_binding_2e370 = (u32)t__2e371;
+	t__2e375 = (u64)(u32)(*(i32 *)t_binding_2e370);
+	t__2e374 = (u64)(u32)(((u32)t__2e375 == (u32)((u64)3UL)));
+	if ((u32)t__2e374) goto L_passed_2e373; else goto L_failed_2e372;
+	L_failed_2e372:;
+	t_abortsite_2e249 = ((u64)18UL);
+	goto L_abort_2e250;
+	L_passed_2e373:;
+	t__2e377 = ((u64 (*)(u64))((u64)((char *)&F_unpacking__demo)))((u64)R19);
+	BLIT(t_tupleunpack_2e376, t__2e377, ((u64)8UL));
+	t__2e384 = (u64)(u32)(*(i32 *)t_binding_2e379);
+	t__2e383 = (u64)(u32)(((u32)t__2e384 == (u32)((u64)10UL)));
+	if ((u32)t__2e383) goto L_passed_2e382; else goto L_failed_2e381;
+	L_failed_2e381:;
+	t_abortsite_2e249 = ((u64)19UL);
+	goto L_abort_2e250;
+	L_passed_2e382:;
+	t__2e388 = (u64)(u32)(*(i32 *)t_binding_2e380);
+	t__2e387 = (u64)(u32)(((u32)t__2e388 == (u32)((u64)20UL)));
+	if ((u32)t__2e387) goto L_passed_2e386; else goto L_failed_2e385;
+	L_failed_2e385:;
+	t_abortsite_2e249 = ((u64)20UL);
+	goto L_abort_2e250;
+	L_passed_2e386:;
+	t__2e390 = ((u64 (*)(u64))((u64)((char *)&F_unpacking__eval)))((u64)R20);
+	BLIT(t_tupleunpack_2e389, t__2e390, ((u64)8UL));
+	t__2e396 = (u64)(u32)(*(i32 *)t_binding_2e391);
+	t__2e395 = (u64)(u32)(((u32)t__2e396 == (u32)((u64)10UL)));
+	if ((u32)t__2e395) goto L_passed_2e394; else goto L_failed_2e393;
+	L_failed_2e393:;
+	t_abortsite_2e249 = ((u64)21UL);
+	goto L_abort_2e250;
+	L_passed_2e394:;
+	t__2e400 = (u64)(u32)(*(i32 *)t_binding_2e392);
+	t__2e399 = (u64)(u32)(((u32)t__2e400 == (u32)((u64)20UL)));
+	if ((u32)t__2e399) goto L_passed_2e398; else goto L_failed_2e397;
+	L_failed_2e397:;
+	t_abortsite_2e249 = ((u64)22UL);
+	goto L_abort_2e250;
+	L_passed_2e398:;
+	t_value_2e403 = (u64)((u64)t_tupleunpack_2e401 + (u64)((u64)0UL));
+	t__2e404 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_unpacking__addone)))());
+	*(u32 *)t_value_2e403 = (u32)t__2e404;
+	t_value_2e403 = (u64)((u64)t_tupleunpack_2e401 + (u64)((u64)4UL));
+	t__2e405 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_unpacking__addone)))());
+	*(u32 *)t_value_2e403 = (u32)t__2e405;
+	t_value_2e403 = (u64)((u64)t_tupleunpack_2e401 + (u64)((u64)8UL));
+	t__2e406 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_unpacking__addone)))());
+	*(u32 *)t_value_2e403 = (u32)t__2e406;
+	t_value_2e403 = (u64)((u64)t_tupleunpack_2e401 + (u64)((u64)12UL));
+	t__2e407 = (u64)(u32)(((u32 (*)(void))((u64)((char *)&F_unpacking__addone)))());
+	*(u32 *)t_value_2e403 = (u32)t__2e407;
+	t__2e420 = (u64)(u32)(*(i32 *)t_binding_2e408);
+	t__2e419 = (u64)(u32)(((u32)t__2e420 == (u32)((u64)1UL)));
+	t__2e416 = (u64)(u32)t__2e419;
+	if ((u32)t__2e416) goto L__2e417; else goto L__2e418;
+	L__2e417:;
+	t__2e422 = (u64)(u32)(*(i32 *)t_binding_2e409);
+	t__2e421 = (u64)(u32)(((u32)t__2e422 == (u32)((u64)2UL)));
+	t__2e416 = (u64)(u32)t__2e421;
+	goto L__2e418;
+	L__2e418:;
+	t__2e413 = (u64)(u32)t__2e416;
+	if ((u32)t__2e413) goto L__2e414; else goto L__2e415;
+	L__2e414:;
+	t__2e424 = (u64)(u32)(*(i32 *)t_binding_2e410);
+	t__2e423 = (u64)(u32)(((u32)t__2e424 == (u32)((u64)4UL)));
+	t__2e413 = (u64)(u32)t__2e423;
+	goto L__2e415;
+	L__2e415:;
+	if ((u32)t__2e413) goto L_passed_2e412; else goto L_failed_2e411;
+	L_failed_2e411:;
+	t_abortsite_2e249 = ((u64)23UL);
+	goto L_abort_2e250;
+	L_passed_2e412:;
+	goto L__2e234;
+	L__2e425:;
+	L__2e234:;
+	return;
+	L_abort_2e250:;
+	t__2e251 = (u64)((u64)t_abortsite_2e249 * (u64)((u64)16UL));
+	t__2e251 = (u64)((u64)((u64)((char *)&D_abortsites_2e248)) + (u64)t__2e251);
+	t__2e252 = (u64)(*(u64 *)t__2e251);
+	t__2e253 = (u64)((u64)t__2e251 + (u64)((u64)8UL));
+	t__2e254 = (u64)(*(u32 *)t__2e253);
+	t__2e253 = (u64)((u64)t__2e251 + (u64)((u64)12UL));
+	t__2e255 = (u64)(*(u32 *)t__2e253);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e252, (u64)t__2e254, (u64)t__2e255, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u32 F_unpacking__addone(void) {
+	u64 t__2e430;
+	u64 t__2e431;
+	L_start_2e426:;
+	L_body_2e427:;
+	t__2e430 = (u64)(u32)(*(i32 *)((u64)((char *)&D_unpacking__global)));
+	t__2e430 = (u64)(u32)((u32)t__2e430 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_unpacking__global)) = (u32)t__2e430;
+	t__2e431 = (u64)(u32)(*(i32 *)((u64)((char *)&D_unpacking__global)));
+	return (u32)t__2e431;
+	L__2e432:;
+	L__2e428:;
+	L__2e433:;
+	return 0;
+}
+static u64 F_unpacking__eval(u64 __rp) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e441;
+	u64 t__2e442;
+	u64 t__2e443;
+	u64 t__2e444;
+	u64 t__2e445;
+	u64 t_binding_2e438;
+	u64 t_object_2e439;
+	u64 t_value_2e440;
+	L_start_2e434:;
+	t_binding_2e438 = (u64)A0;
+	t_object_2e439 = (u64)A1;
+	L_body_2e435:;
+	t_value_2e440 = (u64)((u64)t_object_2e439 + (u64)((u64)0UL));
+	t__2e442 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e3)));
+	t__2e441 = (u64)(u32)((u32)((u64)10UL) + (u32)t__2e442);
+	*(u32 *)t_value_2e440 = (u32)t__2e441;
+	t_value_2e440 = (u64)((u64)t_object_2e439 + (u64)((u64)4UL));
+	t__2e444 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e3)));
+	t__2e443 = (u64)(u32)((u32)((u64)20UL) + (u32)t__2e444);
+	*(u32 *)t_value_2e440 = (u32)t__2e443;
+	BLIT(t_binding_2e438, t_object_2e439, ((u64)8UL));
+	t__2e445 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e3)));
+	t__2e445 = (u64)(u32)((u32)t__2e445 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_static_2e3)) = (u32)t__2e445;
+	BLIT(__rp, t_binding_2e438, 8); return __rp;
+	L__2e446:;
+	L__2e436:;
+	L__2e447:;
+	return 0;
+}
+static u64 F_unpacking__demo(u64 __rp) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t_object_2e452;
+	u64 t_value_2e453;
+	L_start_2e448:;
+	t_object_2e452 = (u64)A0;
+	L_body_2e449:;
+	t_value_2e453 = (u64)((u64)t_object_2e452 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e453 = (u32)((u64)10UL);
+	t_value_2e453 = (u64)((u64)t_object_2e452 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e453 = (u32)((u64)20UL);
+	BLIT(__rp, t_object_2e452, 8); return __rp;
+	L__2e454:;
+	L__2e450:;
+	L__2e455:;
+	return 0;
+}
+static u32 F_unpacking__static(void) {
+	u64 t__2e460;
+	u64 t__2e461;
+	u64 t__2e462;
+	L_start_2e456:;
+	L_body_2e457:;
+	t__2e460 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e1)));
+	t__2e460 = (u64)(u32)((u32)t__2e460 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_static_2e1)) = (u32)t__2e460;
+	t__2e461 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e2)));
+	t__2e461 = (u64)(u32)((u32)t__2e461 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_static_2e2)) = (u32)t__2e461;
+	t__2e462 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e1)));
+	return (u32)t__2e462;
+	L__2e463:;
+	L__2e458:;
+	L__2e464:;
+	return 0;
+}
+static void F_eval__expr__access(void) {
+	L_start_2e465:;
+	L_body_2e466:;
+	goto L__2e467;
+	L__2e469:;
+	L__2e467:;
+	return;
+}
+static void F_eval__expr__tuple(void) {
+	L_start_2e470:;
+	L_body_2e471:;
+	goto L__2e472;
+	L__2e474:;
+	L__2e472:;
+	return;
+}
+static void F_funcs(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char B1[16] __attribute__((aligned(16)));
+	char R2[16] __attribute__((aligned(16)));
+	u64 t__2e479;
+	u64 t__2e485;
+	u64 t__2e488;
+	u64 t__2e490;
+	u64 t__2e491;
+	u64 t__2e493;
+	u64 t__2e497;
+	u64 t__2e498;
+	u64 t__2e499;
+	u64 t__2e500;
+	u64 t__2e501;
+	u64 t_abortsite_2e495;
+	u64 t_object_2e481;
+	u64 t_value_2e482;
+	u64 t_value_2e489;
+	u64 t_value_2e492;
+	L_start_2e475:;
+	t_object_2e481 = (u64)A0;
+	L_body_2e476:;
+	t_value_2e482 = (u64)((u64)t_object_2e481 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e482 = (u32)((u64)41UL);
+	t_value_2e482 = (u64)((u64)t_object_2e481 + (u64)((u64)8UL));
+	*(u64 *)t_value_2e482 = (u64)((u64)1336UL);
+	BLIT((u64)B1, t_object_2e481, 16);
+	t__2e479 = ((u64 (*)(u64, u64))((u64)((char *)&F_func)))((u64)R2, (u64)B1);
+	t_value_2e489 = (u64)((u64)t__2e479 + (u64)((u64)0UL));
+	t__2e490 = (u64)(u32)(*(i32 *)t_value_2e489);
+	t__2e488 = (u64)(u32)(((u32)t__2e490 == (u32)((u64)42UL)));
+	t__2e485 = (u64)(u32)t__2e488;
+	if ((u32)t__2e485) goto L__2e486; else goto L__2e487;
+	L__2e486:;
+	t_value_2e492 = (u64)((u64)t__2e479 + (u64)((u64)8UL));
+	t__2e493 = (u64)(*(u64 *)t_value_2e492);
+	t__2e491 = (u64)(u32)(((u64)t__2e493 == (u64)((u64)1337UL)));
+	t__2e485 = (u64)(u32)t__2e491;
+	goto L__2e487;
+	L__2e487:;
+	if ((u32)t__2e485) goto L_passed_2e484; else goto L_failed_2e483;
+	L_failed_2e483:;
+	t_abortsite_2e495 = ((u64)0UL);
+	goto L_abort_2e496;
+	L_passed_2e484:;
+	goto L__2e477;
+	L__2e502:;
+	L__2e477:;
+	return;
+	L_abort_2e496:;
+	t__2e497 = (u64)((u64)t_abortsite_2e495 * (u64)((u64)16UL));
+	t__2e497 = (u64)((u64)((u64)((char *)&D_abortsites_2e494)) + (u64)t__2e497);
+	t__2e498 = (u64)(*(u64 *)t__2e497);
+	t__2e499 = (u64)((u64)t__2e497 + (u64)((u64)8UL));
+	t__2e500 = (u64)(*(u32 *)t__2e499);
+	t__2e499 = (u64)((u64)t__2e497 + (u64)((u64)12UL));
+	t__2e501 = (u64)(*(u32 *)t__2e499);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e498, (u64)t__2e500, (u64)t__2e501, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u64 F_func(u64 __rp, u64 p_in) {
+	char A0[16] __attribute__((aligned(16)));
+	u64 t__2e507;
+	u64 t__2e509;
+	u64 t__2e510;
+	u64 t__2e512;
+	u64 t_in;
+	u64 t_object_2e505;
+	u64 t_value_2e506;
+	u64 t_value_2e508;
+	u64 t_value_2e511;
+	t_in = p_in;
+	L_start_2e503:;
+	t_object_2e505 = (u64)A0;
+	L_body_2e504:;
+	t_value_2e506 = (u64)((u64)t_object_2e505 + (u64)((u64)0UL));
+	t_value_2e508 = (u64)((u64)t_in + (u64)((u64)0UL));
+	t__2e509 = (u64)(u32)(*(i32 *)t_value_2e508);
+	t__2e507 = (u64)(u32)((u32)t__2e509 + (u32)((u64)1UL));
+	*(u32 *)t_value_2e506 = (u32)t__2e507;
+	t_value_2e506 = (u64)((u64)t_object_2e505 + (u64)((u64)8UL));
+	t_value_2e511 = (u64)((u64)t_in + (u64)((u64)8UL));
+	t__2e512 = (u64)(*(u64 *)t_value_2e511);
+	t__2e510 = (u64)((u64)t__2e512 + (u64)((u64)1UL));
+	*(u64 *)t_value_2e506 = (u64)t__2e510;
+	BLIT(__rp, t_object_2e505, 16); return __rp;
+}
+static void F_assignment(void) {
+	char A0[16] __attribute__((aligned(16)));
+	u64 t__2e521;
+	u64 t__2e524;
+	u64 t__2e526;
+	u64 t__2e527;
+	u64 t__2e529;
+	u64 t__2e533;
+	u64 t__2e534;
+	u64 t__2e535;
+	u64 t__2e536;
+	u64 t__2e537;
+	u64 t__2e542;
+	u64 t__2e545;
+	u64 t__2e547;
+	u64 t__2e548;
+	u64 t__2e550;
+	u64 t_abortsite_2e531;
+	u64 t_binding_2e517;
+	u64 t_value_2e518;
+	u64 t_value_2e525;
+	u64 t_value_2e528;
+	u64 t_value_2e538;
+	u64 t_value_2e539;
+	u64 t_value_2e546;
+	u64 t_value_2e549;
+	L_start_2e513:;
+	t_binding_2e517 = (u64)A0;
+	L_body_2e514:;
+	t_value_2e518 = (u64)((u64)t_binding_2e517 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e518 = (u32)((u64)42UL);
+	t_value_2e518 = (u64)((u64)t_binding_2e517 + (u64)((u64)8UL));
+	*(u64 *)t_value_2e518 = (u64)((u64)1337UL);
+	t_value_2e525 = (u64)((u64)t_binding_2e517 + (u64)((u64)0UL));
+	t__2e526 = (u64)(u32)(*(i32 *)t_value_2e525);
+	t__2e524 = (u64)(u32)(((u32)t__2e526 == (u32)((u64)42UL)));
+	t__2e521 = (u64)(u32)t__2e524;
+	if ((u32)t__2e521) goto L__2e522; else goto L__2e523;
+	L__2e522:;
+	t_value_2e528 = (u64)((u64)t_binding_2e517 + (u64)((u64)8UL));
+	t__2e529 = (u64)(*(u64 *)t_value_2e528);
+	t__2e527 = (u64)(u32)(((u64)t__2e529 == (u64)((u64)1337UL)));
+	t__2e521 = (u64)(u32)t__2e527;
+	goto L__2e523;
+	L__2e523:;
+	if ((u32)t__2e521) goto L_passed_2e520; else goto L_failed_2e519;
+	L_failed_2e519:;
+	t_abortsite_2e531 = ((u64)0UL);
+	goto L_abort_2e532;
+	L_passed_2e520:;
+	t_value_2e538 = (u64)((u64)t_binding_2e517 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e538 = (u32)((u64)1337UL);
+	t_value_2e539 = (u64)((u64)t_binding_2e517 + (u64)((u64)8UL));
+	*(u64 *)t_value_2e539 = (u64)((u64)42UL);
+	t_value_2e546 = (u64)((u64)t_binding_2e517 + (u64)((u64)0UL));
+	t__2e547 = (u64)(u32)(*(i32 *)t_value_2e546);
+	t__2e545 = (u64)(u32)(((u32)t__2e547 == (u32)((u64)1337UL)));
+	t__2e542 = (u64)(u32)t__2e545;
+	if ((u32)t__2e542) goto L__2e543; else goto L__2e544;
+	L__2e543:;
+	t_value_2e549 = (u64)((u64)t_binding_2e517 + (u64)((u64)8UL));
+	t__2e550 = (u64)(*(u64 *)t_value_2e549);
+	t__2e548 = (u64)(u32)(((u64)t__2e550 == (u64)((u64)42UL)));
+	t__2e542 = (u64)(u32)t__2e548;
+	goto L__2e544;
+	L__2e544:;
+	if ((u32)t__2e542) goto L_passed_2e541; else goto L_failed_2e540;
+	L_failed_2e540:;
+	t_abortsite_2e531 = ((u64)1UL);
+	goto L_abort_2e532;
+	L_passed_2e541:;
+	goto L__2e515;
+	L__2e551:;
+	L__2e515:;
+	return;
+	L_abort_2e532:;
+	t__2e533 = (u64)((u64)t_abortsite_2e531 * (u64)((u64)16UL));
+	t__2e533 = (u64)((u64)((u64)((char *)&D_abortsites_2e530)) + (u64)t__2e533);
+	t__2e534 = (u64)(*(u64 *)t__2e533);
+	t__2e535 = (u64)((u64)t__2e533 + (u64)((u64)8UL));
+	t__2e536 = (u64)(*(u32 *)t__2e535);
+	t__2e535 = (u64)((u64)t__2e533 + (u64)((u64)12UL));
+	t__2e537 = (u64)(*(u32 *)t__2e535);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e534, (u64)t__2e536, (u64)t__2e537, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_indexing(void) {
+	char A0[16] __attribute__((aligned(16)));
+	u64 t__2e563;
+	u64 t__2e566;
+	u64 t__2e570;
+	u64 t__2e571;
+	u64 t__2e572;
+	u64 t__2e573;
+	u64 t__2e574;
+	u64 t__2e577;
+	u64 t__2e580;
+	u64 t__2e583;
+	u64 t__2e585;
+	u64 t__2e588;
+	u64 t__2e590;
+	u64 t__2e593;
+	u64 t__2e595;
+	u64 t__2e598;
+	u64 t__2e600;
+	u64 t_abortsite_2e568;
+	u64 t_binding_2e556;
+	u64 t_value_2e559;
+	u64 t_value_2e560;
+	u64 t_value_2e564;
+	u64 t_value_2e565;
+	u64 t_value_2e578;
+	u64 t_value_2e579;
+	u64 t_value_2e584;
+	u64 t_value_2e589;
+	u64 t_value_2e594;
+	u64 t_value_2e599;
+	L_start_2e552:;
+	t_binding_2e556 = (u64)A0;
+	L_body_2e553:;
+	t_value_2e559 = (u64)((u64)t_binding_2e556 + (u64)((u64)0UL));
+	t_value_2e560 = (u64)((u64)t_value_2e559 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e560 = (u32)((u64)42UL);
+	t_value_2e560 = (u64)((u64)t_value_2e559 + (u64)((u64)4UL));
+	*(u32 *)t_value_2e560 = (u32)((u64)69UL);
+	t_value_2e559 = (u64)((u64)t_binding_2e556 + (u64)((u64)8UL));
+	*(u64 *)t_value_2e559 = (u64)((u64)1337UL);
+	t_value_2e564 = (u64)((u64)t_binding_2e556 + (u64)((u64)0UL));
+	t_value_2e565 = (u64)((u64)t_value_2e564 + (u64)((u64)0UL));
+	t__2e566 = (u64)(u32)(*(i32 *)t_value_2e565);
+	t__2e563 = (u64)(u32)(((u32)t__2e566 == (u32)((u64)42UL)));
+	if ((u32)t__2e563) goto L_passed_2e562; else goto L_failed_2e561;
+	L_failed_2e561:;
+	t_abortsite_2e568 = ((u64)0UL);
+	goto L_abort_2e569;
+	L_passed_2e562:;
+	t_value_2e578 = (u64)((u64)t_binding_2e556 + (u64)((u64)0UL));
+	t_value_2e579 = (u64)((u64)t_value_2e578 + (u64)((u64)4UL));
+	t__2e580 = (u64)(u32)(*(u32 *)t_value_2e579);
+	t__2e577 = (u64)(u32)(((u32)t__2e580 == (u32)((u64)69UL)));
+	if ((u32)t__2e577) goto L_passed_2e576; else goto L_failed_2e575;
+	L_failed_2e575:;
+	t_abortsite_2e568 = ((u64)1UL);
+	goto L_abort_2e569;
+	L_passed_2e576:;
+	t_value_2e584 = (u64)((u64)t_binding_2e556 + (u64)((u64)8UL));
+	t__2e585 = (u64)(*(u64 *)t_value_2e584);
+	t__2e583 = (u64)(u32)(((u64)t__2e585 == (u64)((u64)1337UL)));
+	if ((u32)t__2e583) goto L_passed_2e582; else goto L_failed_2e581;
+	L_failed_2e581:;
+	t_abortsite_2e568 = ((u64)2UL);
+	goto L_abort_2e569;
+	L_passed_2e582:;
+	t_value_2e589 = (u64)((u64)t_binding_2e556 + (u64)((u64)8UL));
+	t__2e590 = (u64)(*(u64 *)t_value_2e589);
+	t__2e588 = (u64)(u32)(((u64)t__2e590 == (u64)((u64)1337UL)));
+	if ((u32)t__2e588) goto L_passed_2e587; else goto L_failed_2e586;
+	L_failed_2e586:;
+	t_abortsite_2e568 = ((u64)3UL);
+	goto L_abort_2e569;
+	L_passed_2e587:;
+	t_value_2e594 = (u64)((u64)t_binding_2e556 + (u64)((u64)8UL));
+	t__2e595 = (u64)(*(u64 *)t_value_2e594);
+	t__2e593 = (u64)(u32)(((u64)t__2e595 == (u64)((u64)1337UL)));
+	if ((u32)t__2e593) goto L_passed_2e592; else goto L_failed_2e591;
+	L_failed_2e591:;
+	t_abortsite_2e568 = ((u64)4UL);
+	goto L_abort_2e569;
+	L_passed_2e592:;
+	t_value_2e599 = (u64)((u64)t_binding_2e556 + (u64)((u64)8UL));
+	t__2e600 = (u64)(*(u64 *)t_value_2e599);
+	t__2e598 = (u64)(u32)(((u64)t__2e600 == (u64)((u64)1337UL)));
+	if ((u32)t__2e598) goto L_passed_2e597; else goto L_failed_2e596;
+	L_failed_2e596:;
+	t_abortsite_2e568 = ((u64)5UL);
+	goto L_abort_2e569;
+	L_passed_2e597:;
+	goto L__2e554;
+	L__2e601:;
+	L__2e554:;
+	return;
+	L_abort_2e569:;
+	t__2e570 = (u64)((u64)t_abortsite_2e568 * (u64)((u64)16UL));
+	t__2e570 = (u64)((u64)((u64)((char *)&D_abortsites_2e567)) + (u64)t__2e570);
+	t__2e571 = (u64)(*(u64 *)t__2e570);
+	t__2e572 = (u64)((u64)t__2e570 + (u64)((u64)8UL));
+	t__2e573 = (u64)(*(u32 *)t__2e572);
+	t__2e572 = (u64)((u64)t__2e570 + (u64)((u64)12UL));
+	t__2e574 = (u64)(*(u32 *)t__2e572);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e571, (u64)t__2e573, (u64)t__2e574, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_storage(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e610;
+	u64 t__2e611;
+	u64 t__2e615;
+	u64 t__2e616;
+	u64 t__2e617;
+	u64 t__2e618;
+	u64 t__2e619;
+	u64 t__2e622;
+	u64 t__2e623;
+	u64 t__2e626;
+	u64 t__2e629;
+	u64 t__2e633;
+	u64 t__2e636;
+	u64 t__2e637;
+	u64 t__2e640;
+	u64 t__2e641;
+	u64 t__2e642;
+	u64 t__2e644;
+	u64 t__2e647;
+	u64 t__2e648;
+	u64 t__2e651;
+	u64 t__2e652;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t__2e659;
+	u64 t__2e660;
+	u64 t__2e663;
+	u64 t__2e664;
+	u64 t__2e667;
+	u64 t__2e668;
+	u64 t__2e674;
+	u64 t__2e677;
+	u64 t__2e680;
+	u64 t__2e683;
+	u64 t__2e687;
+	u64 t__2e690;
+	u64 t__2e691;
+	u64 t__2e693;
+	u64 t__2e694;
+	u64 t__2e695;
+	u64 t__2e697;
+	u64 t__2e700;
+	u64 t_abortsite_2e613;
+	u64 t_binding_2e606;
+	u64 t_binding_2e630;
+	u64 t_binding_2e669;
+	u64 t_binding_2e684;
+	u64 t_field_2e639;
+	u64 t_field_2e643;
+	u64 t_field_2e692;
+	u64 t_field_2e696;
+	u64 t_value_2e607;
+	u64 t_value_2e671;
+	L_start_2e602:;
+	t_binding_2e606 = (u64)A0;
+	t_binding_2e630 = (u64)A1;
+	t_binding_2e669 = (u64)A2;
+	t_binding_2e684 = (u64)A3;
+	L_body_2e603:;
+	t_value_2e607 = (u64)((u64)t_binding_2e606 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e607 = (u32)((u64)42UL);
+	t_value_2e607 = (u64)((u64)t_binding_2e606 + (u64)((u64)8UL));
+	*(u64 *)t_value_2e607 = (u64)((u64)1337UL);
+	t__2e611 = (u64)((u64)((u64)8UL) << (((u64)1UL) & 63));
+	t__2e610 = (u64)(u32)(((u64)((u64)16UL) == (u64)t__2e611));
+	if ((u32)t__2e610) goto L_passed_2e609; else goto L_failed_2e608;
+	L_failed_2e608:;
+	t_abortsite_2e613 = ((u64)0UL);
+	goto L_abort_2e614;
+	L_passed_2e609:;
+	t__2e623 = (u64)((u64)((u64)3UL) << (((u64)3UL) & 63));
+	t__2e622 = (u64)(u32)(((u64)((u64)24UL) == (u64)t__2e623));
+	if ((u32)t__2e622) goto L_passed_2e621; else goto L_failed_2e620;
+	L_failed_2e620:;
+	t_abortsite_2e613 = ((u64)1UL);
+	goto L_abort_2e614;
+	L_passed_2e621:;
+	t__2e626 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e626) goto L_passed_2e625; else goto L_failed_2e624;
+	L_failed_2e624:;
+	t_abortsite_2e613 = ((u64)2UL);
+	goto L_abort_2e614;
+	L_passed_2e625:;
+	t__2e629 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e629) goto L_passed_2e628; else goto L_failed_2e627;
+	L_failed_2e627:;
+	t_abortsite_2e613 = ((u64)3UL);
+	goto L_abort_2e614;
+	L_passed_2e628:;
+	*(u64 *)t_binding_2e630 = (u64)t_binding_2e606;
+	t__2e637 = (u64)(*(u64 *)t_binding_2e630);
+	t_field_2e639 = (u64)((u64)t__2e637 + (u64)((u64)0UL));
+	t__2e640 = (u64)(u32)(*(i32 *)t_field_2e639);
+	t__2e636 = (u64)(u32)(((u32)t__2e640 == (u32)((u64)42UL)));
+	t__2e633 = (u64)(u32)t__2e636;
+	if ((u32)t__2e633) goto L__2e634; else goto L__2e635;
+	L__2e634:;
+	t__2e642 = (u64)(*(u64 *)t_binding_2e630);
+	t_field_2e643 = (u64)((u64)t__2e642 + (u64)((u64)8UL));
+	t__2e644 = (u64)(*(u64 *)t_field_2e643);
+	t__2e641 = (u64)(u32)(((u64)t__2e644 == (u64)((u64)1337UL)));
+	t__2e633 = (u64)(u32)t__2e641;
+	goto L__2e635;
+	L__2e635:;
+	if ((u32)t__2e633) goto L_passed_2e632; else goto L_failed_2e631;
+	L_failed_2e631:;
+	t_abortsite_2e613 = ((u64)4UL);
+	goto L_abort_2e614;
+	L_passed_2e632:;
+	t__2e648 = (u64)((u64)((u64)2UL) << (((u64)3UL) & 63));
+	t__2e647 = (u64)(u32)(((u64)((u64)16UL) == (u64)t__2e648));
+	if ((u32)t__2e647) goto L_passed_2e646; else goto L_failed_2e645;
+	L_failed_2e645:;
+	t_abortsite_2e613 = ((u64)5UL);
+	goto L_abort_2e614;
+	L_passed_2e646:;
+	t__2e652 = (u64)((u64)((u64)2UL) << (((u64)3UL) & 63));
+	t__2e651 = (u64)(u32)(((u64)((u64)16UL) == (u64)t__2e652));
+	if ((u32)t__2e651) goto L_passed_2e650; else goto L_failed_2e649;
+	L_failed_2e649:;
+	t_abortsite_2e613 = ((u64)6UL);
+	goto L_abort_2e614;
+	L_passed_2e650:;
+	t__2e656 = (u64)((u64)((u64)2UL) << (((u64)3UL) & 63));
+	t__2e655 = (u64)(u32)(((u64)((u64)16UL) == (u64)t__2e656));
+	if ((u32)t__2e655) goto L_passed_2e654; else goto L_failed_2e653;
+	L_failed_2e653:;
+	t_abortsite_2e613 = ((u64)7UL);
+	goto L_abort_2e614;
+	L_passed_2e654:;
+	t__2e660 = (u64)((u64)((u64)2UL) << (((u64)3UL) & 63));
+	t__2e659 = (u64)(u32)(((u64)((u64)16UL) == (u64)t__2e660));
+	if ((u32)t__2e659) goto L_passed_2e658; else goto L_failed_2e657;
+	L_failed_2e657:;
+	t_abortsite_2e613 = ((u64)8UL);
+	goto L_abort_2e614;
+	L_passed_2e658:;
+	t__2e664 = (u64)((u64)((u64)3UL) << (((u64)3UL) & 63));
+	t__2e663 = (u64)(u32)(((u64)((u64)24UL) == (u64)t__2e664));
+	if ((u32)t__2e663) goto L_passed_2e662; else goto L_failed_2e661;
+	L_failed_2e661:;
+	t_abortsite_2e613 = ((u64)9UL);
+	goto L_abort_2e614;
+	L_passed_2e662:;
+	t__2e668 = (u64)((u64)((u64)3UL) << (((u64)3UL) & 63));
+	t__2e667 = (u64)(u32)(((u64)((u64)24UL) == (u64)t__2e668));
+	if ((u32)t__2e667) goto L_passed_2e666; else goto L_failed_2e665;
+	L_failed_2e665:;
+	t_abortsite_2e613 = ((u64)10UL);
+	goto L_abort_2e614;
+	L_passed_2e666:;
+	t_value_2e671 = (u64)((u64)t_binding_2e669 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e671 = (u32)((u64)42UL);
+	t_value_2e671 = (u64)((u64)t_binding_2e669 + (u64)((u64)0UL));
+	t_value_2e671 = (u64)((u64)t_binding_2e669 + (u64)((u64)8UL));
+	*(u64 *)t_value_2e671 = (u64)((u64)1337UL);
+	t__2e674 = (u64)(u32)(((u64)((u64)16UL) == (u64)((u64)16UL)));
+	if ((u32)t__2e674) goto L_passed_2e673; else goto L_failed_2e672;
+	L_failed_2e672:;
+	t_abortsite_2e613 = ((u64)11UL);
+	goto L_abort_2e614;
+	L_passed_2e673:;
+	t__2e677 = (u64)(u32)(((u64)((u64)16UL) == (u64)((u64)16UL)));
+	if ((u32)t__2e677) goto L_passed_2e676; else goto L_failed_2e675;
+	L_failed_2e675:;
+	t_abortsite_2e613 = ((u64)12UL);
+	goto L_abort_2e614;
+	L_passed_2e676:;
+	t__2e680 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e680) goto L_passed_2e679; else goto L_failed_2e678;
+	L_failed_2e678:;
+	t_abortsite_2e613 = ((u64)13UL);
+	goto L_abort_2e614;
+	L_passed_2e679:;
+	t__2e683 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e683) goto L_passed_2e682; else goto L_failed_2e681;
+	L_failed_2e681:;
+	t_abortsite_2e613 = ((u64)14UL);
+	goto L_abort_2e614;
+	L_passed_2e682:;
+	*(u64 *)t_binding_2e684 = (u64)t_binding_2e669;
+	t__2e691 = (u64)(*(u64 *)t_binding_2e684);
+	t_field_2e692 = (u64)((u64)t__2e691 + (u64)((u64)0UL));
+	t__2e693 = (u64)(u32)(*(i32 *)t_field_2e692);
+	t__2e690 = (u64)(u32)(((u32)t__2e693 == (u32)((u64)42UL)));
+	t__2e687 = (u64)(u32)t__2e690;
+	if ((u32)t__2e687) goto L__2e688; else goto L__2e689;
+	L__2e688:;
+	t__2e695 = (u64)(*(u64 *)t_binding_2e684);
+	t_field_2e696 = (u64)((u64)t__2e695 + (u64)((u64)8UL));
+	t__2e697 = (u64)(*(u64 *)t_field_2e696);
+	t__2e694 = (u64)(u32)(((u64)t__2e697 == (u64)((u64)1337UL)));
+	t__2e687 = (u64)(u32)t__2e694;
+	goto L__2e689;
+	L__2e689:;
+	if ((u32)t__2e687) goto L_passed_2e686; else goto L_failed_2e685;
+	L_failed_2e685:;
+	t_abortsite_2e613 = ((u64)15UL);
+	goto L_abort_2e614;
+	L_passed_2e686:;
+	t__2e700 = (u64)(u32)(((u64)((u64)0UL) == (u64)((u64)0UL)));
+	if ((u32)t__2e700) goto L_passed_2e699; else goto L_failed_2e698;
+	L_failed_2e698:;
+	t_abortsite_2e613 = ((u64)16UL);
+	goto L_abort_2e614;
+	L_passed_2e699:;
+	goto L__2e604;
+	L__2e701:;
+	L__2e604:;
+	return;
+	L_abort_2e614:;
+	t__2e615 = (u64)((u64)t_abortsite_2e613 * (u64)((u64)16UL));
+	t__2e615 = (u64)((u64)((u64)((char *)&D_abortsites_2e612)) + (u64)t__2e615);
+	t__2e616 = (u64)(*(u64 *)t__2e615);
+	t__2e617 = (u64)((u64)t__2e615 + (u64)((u64)8UL));
+	t__2e618 = (u64)(*(u32 *)t__2e617);
+	t__2e617 = (u64)((u64)t__2e615 + (u64)((u64)12UL));
+	t__2e619 = (u64)(*(u32 *)t__2e617);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e616, (u64)t__2e618, (u64)t__2e619, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,912 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2eensure[] __asm__("rt.ensure");
+extern char X_rt_2efree[] __asm__("rt.free");
+extern char X_rt_2emalloc[] __asm__("rt.malloc");
+extern char X_rt_2ememmove[] __asm__("rt.memmove");
+extern char X_rt_2eunensure[] __asm__("rt.unensure");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e16 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; };
+struct __attribute__((packed)) S_abortsites_2e211 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e16 D_abortsites_2e16 __asm__("abortsites.16") __attribute__((used, section(".data.rel.ro.abortsites.16"), aligned(8)));
+static struct S_abortsites_2e211 D_abortsites_2e211 __asm__("abortsites.211") __attribute__((used, section(".data.rel.ro.abortsites.211"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_slice(void) __asm__("slice") __attribute__((used, section(".text.slice")));
+static void F_index(void) __asm__("index") __attribute__((used, section(".text.index")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\062\062\055\144\145\154\145\164\145\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 18U, 18U };
+static struct S_abortsites_2e16 D_abortsites_2e16 = { (char *)((char *)&D_strliteral_2e1) + 0, 22U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 26U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 30U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 33U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 34U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 37U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 38U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 15U };
+static struct S_abortsites_2e211 D_abortsites_2e211 = { (char *)((char *)&D_strliteral_2e1) + 0, 6U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 9U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 10U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 11U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 11U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 11U, 43U, (char *)((char *)&D_strliteral_2e1) + 0, 11U, 56U, (char *)((char *)&D_strliteral_2e1) + 0, 11U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 14U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 15U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 16U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 17U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 17U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 17U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_index)))();
+	((void (*)(void))((u64)((char *)&F_slice)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_slice(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e101;
+	u64 t__2e104;
+	u64 t__2e107;
+	u64 t__2e108;
+	u64 t__2e109;
+	u64 t__2e110;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e113;
+	u64 t__2e114;
+	u64 t__2e115;
+	u64 t__2e116;
+	u64 t__2e117;
+	u64 t__2e12;
+	u64 t__2e121;
+	u64 t__2e122;
+	u64 t__2e123;
+	u64 t__2e126;
+	u64 t__2e127;
+	u64 t__2e128;
+	u64 t__2e129;
+	u64 t__2e13;
+	u64 t__2e132;
+	u64 t__2e133;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e139;
+	u64 t__2e140;
+	u64 t__2e141;
+	u64 t__2e142;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e147;
+	u64 t__2e150;
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e154;
+	u64 t__2e155;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e159;
+	u64 t__2e160;
+	u64 t__2e161;
+	u64 t__2e164;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e169;
+	u64 t__2e170;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t__2e175;
+	u64 t__2e178;
+	u64 t__2e179;
+	u64 t__2e180;
+	u64 t__2e181;
+	u64 t__2e182;
+	u64 t__2e183;
+	u64 t__2e184;
+	u64 t__2e185;
+	u64 t__2e188;
+	u64 t__2e189;
+	u64 t__2e19;
+	u64 t__2e190;
+	u64 t__2e191;
+	u64 t__2e192;
+	u64 t__2e193;
+	u64 t__2e194;
+	u64 t__2e195;
+	u64 t__2e196;
+	u64 t__2e199;
+	u64 t__2e20;
+	u64 t__2e200;
+	u64 t__2e21;
+	u64 t__2e22;
+	u64 t__2e23;
+	u64 t__2e26;
+	u64 t__2e29;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t__2e33;
+	u64 t__2e34;
+	u64 t__2e35;
+	u64 t__2e36;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e41;
+	u64 t__2e45;
+	u64 t__2e46;
+	u64 t__2e47;
+	u64 t__2e48;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e55;
+	u64 t__2e56;
+	u64 t__2e57;
+	u64 t__2e58;
+	u64 t__2e60;
+	u64 t__2e61;
+	u64 t__2e62;
+	u64 t__2e63;
+	u64 t__2e64;
+	u64 t__2e67;
+	u64 t__2e70;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t__2e73;
+	u64 t__2e74;
+	u64 t__2e75;
+	u64 t__2e76;
+	u64 t__2e77;
+	u64 t__2e80;
+	u64 t__2e81;
+	u64 t__2e82;
+	u64 t__2e83;
+	u64 t__2e84;
+	u64 t__2e85;
+	u64 t__2e86;
+	u64 t__2e87;
+	u64 t__2e88;
+	u64 t__2e91;
+	u64 t__2e92;
+	u64 t__2e93;
+	u64 t__2e94;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e97;
+	u64 t__2e98;
+	u64 t__2e99;
+	u64 t_abortsite_2e17;
+	u64 t_binding_2e11;
+	u64 t_binding_2e27;
+	u64 t_binding_2e28;
+	u64 t_field_2e135;
+	u64 t_item_2e149;
+	u64 t_item_2e25;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	t_binding_2e27 = (u64)A1;
+	t_binding_2e28 = (u64)A2;
+	L_body_2e8:;
+	t__2e12 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)20UL)));
+	t__2e13 = (u64)(u32)(((u64)t__2e12 != (u64)((u64)0UL)));
+	if ((u32)t__2e13) goto L__2e15; else goto L__2e14;
+	L__2e14:;
+	t_abortsite_2e17 = ((u64)0UL);
+	goto L_abort_2e18;
+	L__2e15:;
+	t_item_2e25 = (u64)((u64)t__2e12 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e25 = (u32)((u64)1UL);
+	t_item_2e25 = (u64)((u64)t__2e12 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e25 = (u32)((u64)2UL);
+	t_item_2e25 = (u64)((u64)t__2e12 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e25 = (u32)((u64)3UL);
+	t_item_2e25 = (u64)((u64)t__2e12 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e25 = (u32)((u64)4UL);
+	t_item_2e25 = (u64)((u64)t__2e12 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e25 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e11 = (u64)t__2e12;
+	t__2e26 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	*(u64 *)t__2e26 = (u64)((u64)5UL);
+	t__2e26 = (u64)((u64)t__2e26 + (u64)((u64)8UL));
+	*(u64 *)t__2e26 = (u64)((u64)5UL);
+	*(u64 *)t_binding_2e27 = (u64)t_binding_2e11;
+	t__2e29 = (u64)(*(u64 *)t_binding_2e27);
+	*(u64 *)t_binding_2e28 = (u64)t__2e29;
+	t__2e31 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e32 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e33 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e34 = (u64)(*(u64 *)t__2e31);
+	t__2e35 = (u64)(*(u64 *)t__2e32);
+	t__2e36 = (u64)((i64)(i32)((u64)3UL));
+	t__2e37 = (u64)((u64)t__2e36 - (u64)((u64)0UL));
+	t__2e41 = (u64)(u32)(((u64)t__2e36 <= (u64)t__2e34));
+	t__2e37 = t__2e36;
+	t__2e38 = t__2e35;
+	if ((u32)t__2e41) goto L__2e43; else goto L__2e42;
+	L__2e42:;
+	t_abortsite_2e17 = ((u64)1UL);
+	goto L_abort_2e44;
+	L__2e43:;
+	t__2e50 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t__2e50 = (u64)((u64)t__2e50 + (u64)t__2e33);
+	t__2e51 = (u64)((u64)t__2e36 * (u64)((u64)4UL));
+	t__2e51 = (u64)((u64)t__2e51 + (u64)t__2e33);
+	t__2e34 = (u64)((u64)t__2e34 - (u64)t__2e36);
+	t__2e52 = (u64)((u64)t__2e34 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e50, (u64)t__2e51, (u64)t__2e52);
+	t__2e34 = (u64)((u64)t__2e34 + (u64)((u64)0UL));
+	*(u64 *)t__2e31 = (u64)t__2e34;
+	((void (*)(u64, u64))((u64)X_rt_2eunensure))((u64)t_binding_2e11, (u64)((u64)4UL));
+	t__2e56 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e57 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e58 = (u64)(*(u64 *)t__2e56);
+	t__2e55 = (u64)(u32)(((u64)t__2e58 == (u64)((u64)2UL)));
+	if ((u32)t__2e55) goto L_passed_2e54; else goto L_failed_2e53;
+	L_failed_2e53:;
+	t_abortsite_2e17 = ((u64)2UL);
+	goto L_abort_2e59;
+	L_passed_2e54:;
+	t__2e72 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e73 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e74 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e75 = (u64)(*(u64 *)t__2e72);
+	t__2e76 = (u64)((i64)(i32)((u64)0UL));
+	t__2e71 = (u64)((u64)t__2e76 * (u64)((u64)4UL));
+	t__2e71 = (u64)((u64)t__2e74 + (u64)t__2e71);
+	t__2e77 = (u64)(u32)(((u64)t__2e76 < (u64)t__2e75));
+	if ((u32)t__2e77) goto L__2e79; else goto L__2e78;
+	L__2e78:;
+	t_abortsite_2e17 = ((u64)3UL);
+	goto L_abort_2e44;
+	L__2e79:;
+	t__2e80 = (u64)(u32)(*(i32 *)t__2e71);
+	t__2e70 = (u64)(u32)(((u32)t__2e80 == (u32)((u64)4UL)));
+	t__2e67 = (u64)(u32)t__2e70;
+	if ((u32)t__2e67) goto L__2e68; else goto L__2e69;
+	L__2e68:;
+	t__2e83 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e84 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e85 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e86 = (u64)(*(u64 *)t__2e83);
+	t__2e87 = (u64)((i64)(i32)((u64)1UL));
+	t__2e82 = (u64)((u64)t__2e87 * (u64)((u64)4UL));
+	t__2e82 = (u64)((u64)t__2e85 + (u64)t__2e82);
+	t__2e88 = (u64)(u32)(((u64)t__2e87 < (u64)t__2e86));
+	if ((u32)t__2e88) goto L__2e90; else goto L__2e89;
+	L__2e89:;
+	t_abortsite_2e17 = ((u64)4UL);
+	goto L_abort_2e44;
+	L__2e90:;
+	t__2e91 = (u64)(u32)(*(i32 *)t__2e82);
+	t__2e81 = (u64)(u32)(((u32)t__2e91 == (u32)((u64)5UL)));
+	t__2e67 = (u64)(u32)t__2e81;
+	goto L__2e69;
+	L__2e69:;
+	if ((u32)t__2e67) goto L_passed_2e66; else goto L_failed_2e65;
+	L_failed_2e65:;
+	t_abortsite_2e17 = ((u64)5UL);
+	goto L_abort_2e59;
+	L_passed_2e66:;
+	t__2e92 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e93 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e94 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e95 = (u64)(*(u64 *)t__2e92);
+	t__2e96 = (u64)(*(u64 *)t__2e93);
+	t__2e97 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e98 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e99 = (u64)(*(u64 *)t__2e97);
+	t__2e100 = (u64)((u64)t__2e95 - (u64)t__2e99);
+	t__2e104 = (u64)(u32)(((u64)t__2e99 <= (u64)t__2e95));
+	t__2e100 = (u64)((u64)t__2e95 - (u64)t__2e99);
+	t__2e101 = (u64)((u64)t__2e96 - (u64)t__2e99);
+	if ((u32)t__2e104) goto L__2e106; else goto L__2e105;
+	L__2e105:;
+	t_abortsite_2e17 = ((u64)6UL);
+	goto L_abort_2e44;
+	L__2e106:;
+	t__2e107 = (u64)((u64)t__2e99 * (u64)((u64)4UL));
+	t__2e107 = (u64)((u64)t__2e107 + (u64)t__2e94);
+	t__2e108 = (u64)((u64)t__2e95 * (u64)((u64)4UL));
+	t__2e108 = (u64)((u64)t__2e108 + (u64)t__2e94);
+	t__2e95 = (u64)((u64)t__2e95 - (u64)t__2e95);
+	t__2e109 = (u64)((u64)t__2e95 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e107, (u64)t__2e108, (u64)t__2e109);
+	t__2e95 = (u64)((u64)t__2e95 + (u64)t__2e99);
+	*(u64 *)t__2e92 = (u64)t__2e95;
+	((void (*)(u64, u64))((u64)X_rt_2eunensure))((u64)t_binding_2e11, (u64)((u64)4UL));
+	t__2e110 = (u64)(*(u64 *)t_binding_2e27);
+	t__2e111 = (u64)((u64)t__2e110 + (u64)((u64)8UL));
+	t__2e112 = (u64)((u64)t__2e110 + (u64)((u64)16UL));
+	t__2e113 = (u64)(*(u64 *)t__2e110);
+	t__2e114 = (u64)(*(u64 *)t__2e111);
+	t__2e115 = (u64)(*(u64 *)t__2e112);
+	t__2e116 = (u64)((u64)t__2e114 - (u64)((u64)0UL));
+	t__2e116 = t__2e114;
+	t__2e117 = t__2e115;
+	t__2e121 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t__2e121 = (u64)((u64)t__2e121 + (u64)t__2e113);
+	t__2e122 = (u64)((u64)t__2e114 * (u64)((u64)4UL));
+	t__2e122 = (u64)((u64)t__2e122 + (u64)t__2e113);
+	t__2e114 = (u64)((u64)t__2e114 - (u64)t__2e114);
+	t__2e123 = (u64)((u64)t__2e114 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e121, (u64)t__2e122, (u64)t__2e123);
+	t__2e114 = (u64)((u64)t__2e114 + (u64)((u64)0UL));
+	*(u64 *)t__2e111 = (u64)t__2e114;
+	t__2e127 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e128 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e129 = (u64)(*(u64 *)t__2e127);
+	t__2e126 = (u64)(u32)(((u64)t__2e129 == (u64)((u64)0UL)));
+	if ((u32)t__2e126) goto L_passed_2e125; else goto L_failed_2e124;
+	L_failed_2e124:;
+	t_abortsite_2e17 = ((u64)7UL);
+	goto L_abort_2e59;
+	L_passed_2e125:;
+	t__2e133 = (u64)(*(u64 *)t_binding_2e28);
+	t_field_2e135 = (u64)((u64)t__2e133 + (u64)((u64)16UL));
+	t__2e136 = (u64)(*(u64 *)t_field_2e135);
+	t__2e132 = (u64)(u32)(((u64)t__2e136 < (u64)((u64)5UL)));
+	if ((u32)t__2e132) goto L_passed_2e131; else goto L_failed_2e130;
+	L_failed_2e130:;
+	t_abortsite_2e17 = ((u64)8UL);
+	goto L_abort_2e59;
+	L_passed_2e131:;
+	t__2e137 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e138 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e139 = (u64)(*(u64 *)t__2e137);
+	t__2e140 = (u64)((u64)t__2e139 + (u64)((u64)4UL));
+	*(u64 *)t__2e137 = (u64)t__2e140;
+	t__2e142 = (u64)(*(u64 *)t__2e138);
+	t__2e145 = (u64)(u32)(((u64)t__2e140 <= (u64)t__2e142));
+	if ((u32)t__2e145) goto L__2e143; else goto L__2e144;
+	L__2e144:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e11, (u64)((u64)4UL));
+	goto L__2e143;
+	L__2e143:;
+	t__2e146 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e141 = (u64)((u64)t__2e139 * (u64)((u64)4UL));
+	t__2e141 = (u64)((u64)t__2e146 + (u64)t__2e141);
+	t__2e147 = (u64)((u64)((u64)4UL) * (u64)((u64)4UL));
+	t_item_2e149 = (u64)((u64)t__2e141 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e149 = (u32)((u64)6UL);
+	t_item_2e149 = (u64)((u64)t__2e141 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e149 = (u32)((u64)7UL);
+	t_item_2e149 = (u64)((u64)t__2e141 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e149 = (u32)((u64)8UL);
+	t_item_2e149 = (u64)((u64)t__2e141 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e149 = (u32)((u64)9UL);
+	t__2e150 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e151 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e152 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e153 = (u64)(*(u64 *)t__2e150);
+	t__2e154 = (u64)(*(u64 *)t__2e151);
+	t__2e155 = (u64)((i64)(i32)((u64)1UL));
+	t__2e156 = (u64)((i64)(i32)((u64)3UL));
+	t__2e157 = (u64)((u64)t__2e156 - (u64)t__2e155);
+	t__2e160 = (u64)(u32)(((u64)t__2e155 <= (u64)t__2e156));
+	t__2e159 = (u64)(u32)(((u64)t__2e156 <= (u64)t__2e153));
+	t__2e161 = (u64)(u32)((u32)t__2e160 & (u32)t__2e159);
+	t__2e157 = (u64)((u64)t__2e156 - (u64)t__2e155);
+	t__2e158 = (u64)((u64)t__2e154 - (u64)t__2e155);
+	if ((u32)t__2e161) goto L__2e163; else goto L__2e162;
+	L__2e162:;
+	t_abortsite_2e17 = ((u64)9UL);
+	goto L_abort_2e44;
+	L__2e163:;
+	t__2e164 = (u64)((u64)t__2e155 * (u64)((u64)4UL));
+	t__2e164 = (u64)((u64)t__2e164 + (u64)t__2e152);
+	t__2e165 = (u64)((u64)t__2e156 * (u64)((u64)4UL));
+	t__2e165 = (u64)((u64)t__2e165 + (u64)t__2e152);
+	t__2e153 = (u64)((u64)t__2e153 - (u64)t__2e156);
+	t__2e166 = (u64)((u64)t__2e153 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e164, (u64)t__2e165, (u64)t__2e166);
+	t__2e153 = (u64)((u64)t__2e153 + (u64)t__2e155);
+	*(u64 *)t__2e150 = (u64)t__2e153;
+	((void (*)(u64, u64))((u64)X_rt_2eunensure))((u64)t_binding_2e11, (u64)((u64)4UL));
+	t__2e170 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e171 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e172 = (u64)(*(u64 *)t__2e170);
+	t__2e169 = (u64)(u32)(((u64)t__2e172 == (u64)((u64)2UL)));
+	if ((u32)t__2e169) goto L_passed_2e168; else goto L_failed_2e167;
+	L_failed_2e167:;
+	t_abortsite_2e17 = ((u64)10UL);
+	goto L_abort_2e59;
+	L_passed_2e168:;
+	t__2e180 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e181 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e182 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e183 = (u64)(*(u64 *)t__2e180);
+	t__2e184 = (u64)((i64)(i32)((u64)0UL));
+	t__2e179 = (u64)((u64)t__2e184 * (u64)((u64)4UL));
+	t__2e179 = (u64)((u64)t__2e182 + (u64)t__2e179);
+	t__2e185 = (u64)(u32)(((u64)t__2e184 < (u64)t__2e183));
+	if ((u32)t__2e185) goto L__2e187; else goto L__2e186;
+	L__2e186:;
+	t_abortsite_2e17 = ((u64)11UL);
+	goto L_abort_2e44;
+	L__2e187:;
+	t__2e188 = (u64)(u32)(*(i32 *)t__2e179);
+	t__2e178 = (u64)(u32)(((u32)t__2e188 == (u32)((u64)6UL)));
+	t__2e175 = (u64)(u32)t__2e178;
+	if ((u32)t__2e175) goto L__2e176; else goto L__2e177;
+	L__2e176:;
+	t__2e191 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e192 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e193 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e194 = (u64)(*(u64 *)t__2e191);
+	t__2e195 = (u64)((i64)(i32)((u64)1UL));
+	t__2e190 = (u64)((u64)t__2e195 * (u64)((u64)4UL));
+	t__2e190 = (u64)((u64)t__2e193 + (u64)t__2e190);
+	t__2e196 = (u64)(u32)(((u64)t__2e195 < (u64)t__2e194));
+	if ((u32)t__2e196) goto L__2e198; else goto L__2e197;
+	L__2e197:;
+	t_abortsite_2e17 = ((u64)12UL);
+	goto L_abort_2e44;
+	L__2e198:;
+	t__2e199 = (u64)(u32)(*(i32 *)t__2e190);
+	t__2e189 = (u64)(u32)(((u32)t__2e199 == (u32)((u64)9UL)));
+	t__2e175 = (u64)(u32)t__2e189;
+	goto L__2e177;
+	L__2e177:;
+	if ((u32)t__2e175) goto L_passed_2e174; else goto L_failed_2e173;
+	L_failed_2e173:;
+	t_abortsite_2e17 = ((u64)13UL);
+	goto L_abort_2e59;
+	L_passed_2e174:;
+	t__2e200 = (u64)(*(u64 *)t_binding_2e11);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e200);
+	goto L__2e9;
+	L__2e201:;
+	L__2e9:;
+	return;
+	L_abort_2e18:;
+	t__2e19 = (u64)((u64)t_abortsite_2e17 * (u64)((u64)16UL));
+	t__2e19 = (u64)((u64)((u64)((char *)&D_abortsites_2e16)) + (u64)t__2e19);
+	t__2e20 = (u64)(*(u64 *)t__2e19);
+	t__2e21 = (u64)((u64)t__2e19 + (u64)((u64)8UL));
+	t__2e22 = (u64)(*(u32 *)t__2e21);
+	t__2e21 = (u64)((u64)t__2e19 + (u64)((u64)12UL));
+	t__2e23 = (u64)(*(u32 *)t__2e21);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e20, (u64)t__2e22, (u64)t__2e23, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e44:;
+	t__2e45 = (u64)((u64)t_abortsite_2e17 * (u64)((u64)16UL));
+	t__2e45 = (u64)((u64)((u64)((char *)&D_abortsites_2e16)) + (u64)t__2e45);
+	t__2e46 = (u64)(*(u64 *)t__2e45);
+	t__2e47 = (u64)((u64)t__2e45 + (u64)((u64)8UL));
+	t__2e48 = (u64)(*(u32 *)t__2e47);
+	t__2e47 = (u64)((u64)t__2e45 + (u64)((u64)12UL));
+	t__2e49 = (u64)(*(u32 *)t__2e47);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e46, (u64)t__2e48, (u64)t__2e49, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e59:;
+	t__2e60 = (u64)((u64)t_abortsite_2e17 * (u64)((u64)16UL));
+	t__2e60 = (u64)((u64)((u64)((char *)&D_abortsites_2e16)) + (u64)t__2e60);
+	t__2e61 = (u64)(*(u64 *)t__2e60);
+	t__2e62 = (u64)((u64)t__2e60 + (u64)((u64)8UL));
+	t__2e63 = (u64)(*(u32 *)t__2e62);
+	t__2e62 = (u64)((u64)t__2e60 + (u64)((u64)12UL));
+	t__2e64 = (u64)(*(u32 *)t__2e62);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e61, (u64)t__2e63, (u64)t__2e64, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_index(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e207;
+	u64 t__2e208;
+	u64 t__2e214;
+	u64 t__2e215;
+	u64 t__2e216;
+	u64 t__2e217;
+	u64 t__2e218;
+	u64 t__2e220;
+	u64 t__2e222;
+	u64 t__2e223;
+	u64 t__2e224;
+	u64 t__2e225;
+	u64 t__2e226;
+	u64 t__2e227;
+	u64 t__2e228;
+	u64 t__2e232;
+	u64 t__2e233;
+	u64 t__2e234;
+	u64 t__2e235;
+	u64 t__2e236;
+	u64 t__2e237;
+	u64 t__2e238;
+	u64 t__2e239;
+	u64 t__2e240;
+	u64 t__2e243;
+	u64 t__2e244;
+	u64 t__2e245;
+	u64 t__2e246;
+	u64 t__2e248;
+	u64 t__2e249;
+	u64 t__2e250;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e255;
+	u64 t__2e258;
+	u64 t__2e261;
+	u64 t__2e264;
+	u64 t__2e265;
+	u64 t__2e266;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e269;
+	u64 t__2e270;
+	u64 t__2e271;
+	u64 t__2e274;
+	u64 t__2e275;
+	u64 t__2e276;
+	u64 t__2e277;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t__2e280;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e285;
+	u64 t__2e286;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e289;
+	u64 t__2e290;
+	u64 t__2e291;
+	u64 t__2e292;
+	u64 t__2e293;
+	u64 t__2e296;
+	u64 t__2e297;
+	u64 t__2e298;
+	u64 t__2e299;
+	u64 t__2e300;
+	u64 t__2e301;
+	u64 t__2e302;
+	u64 t__2e303;
+	u64 t__2e304;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t__2e311;
+	u64 t__2e312;
+	u64 t__2e313;
+	u64 t__2e314;
+	u64 t__2e315;
+	u64 t__2e318;
+	u64 t__2e319;
+	u64 t__2e320;
+	u64 t__2e321;
+	u64 t__2e324;
+	u64 t__2e325;
+	u64 t__2e326;
+	u64 t__2e327;
+	u64 t__2e328;
+	u64 t__2e329;
+	u64 t__2e330;
+	u64 t__2e331;
+	u64 t__2e332;
+	u64 t__2e333;
+	u64 t__2e334;
+	u64 t__2e335;
+	u64 t__2e338;
+	u64 t__2e339;
+	u64 t__2e340;
+	u64 t__2e341;
+	u64 t__2e344;
+	u64 t__2e345;
+	u64 t__2e346;
+	u64 t__2e347;
+	u64 t__2e350;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e355;
+	u64 t__2e356;
+	u64 t__2e357;
+	u64 t__2e358;
+	u64 t__2e359;
+	u64 t__2e360;
+	u64 t__2e363;
+	u64 t__2e364;
+	u64 t__2e365;
+	u64 t__2e366;
+	u64 t__2e367;
+	u64 t__2e368;
+	u64 t__2e369;
+	u64 t__2e370;
+	u64 t__2e371;
+	u64 t__2e374;
+	u64 t__2e375;
+	u64 t_abortsite_2e212;
+	u64 t_binding_2e206;
+	u64 t_binding_2e221;
+	u64 t_item_2e219;
+	L_start_2e202:;
+	t_binding_2e206 = (u64)A0;
+	t_binding_2e221 = (u64)A1;
+	L_body_2e203:;
+	t__2e207 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)20UL)));
+	t__2e208 = (u64)(u32)(((u64)t__2e207 != (u64)((u64)0UL)));
+	if ((u32)t__2e208) goto L__2e210; else goto L__2e209;
+	L__2e209:;
+	t_abortsite_2e212 = ((u64)0UL);
+	goto L_abort_2e213;
+	L__2e210:;
+	t_item_2e219 = (u64)((u64)t__2e207 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e219 = (u32)((u64)1UL);
+	t_item_2e219 = (u64)((u64)t__2e207 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e219 = (u32)((u64)2UL);
+	t_item_2e219 = (u64)((u64)t__2e207 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e219 = (u32)((u64)3UL);
+	t_item_2e219 = (u64)((u64)t__2e207 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e219 = (u32)((u64)4UL);
+	t_item_2e219 = (u64)((u64)t__2e207 + (u64)((u64)16UL));
+	*(u32 *)t_item_2e219 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e206 = (u64)t__2e207;
+	t__2e220 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	*(u64 *)t__2e220 = (u64)((u64)5UL);
+	t__2e220 = (u64)((u64)t__2e220 + (u64)((u64)8UL));
+	*(u64 *)t__2e220 = (u64)((u64)5UL);
+	*(u64 *)t_binding_2e221 = (u64)t_binding_2e206;
+	t__2e222 = (u64)((i64)(i32)((u64)1UL));
+	t__2e223 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	t__2e224 = (u64)((u64)t_binding_2e206 + (u64)((u64)16UL));
+	t__2e225 = (u64)(*(u64 *)t_binding_2e206);
+	t__2e226 = (u64)(*(u64 *)t__2e223);
+	t__2e227 = (u64)(*(u64 *)t__2e224);
+	t__2e228 = (u64)(u32)(((u64)t__2e222 < (u64)t__2e226));
+	if ((u32)t__2e228) goto L__2e230; else goto L__2e229;
+	L__2e229:;
+	t_abortsite_2e212 = ((u64)1UL);
+	goto L_abort_2e231;
+	L__2e230:;
+	t__2e237 = (u64)((u64)t__2e222 + (u64)((u64)1UL));
+	t__2e238 = (u64)((u64)t__2e222 * (u64)((u64)4UL));
+	t__2e238 = (u64)((u64)t__2e238 + (u64)t__2e225);
+	t__2e239 = (u64)((u64)t__2e237 * (u64)((u64)4UL));
+	t__2e239 = (u64)((u64)t__2e239 + (u64)t__2e225);
+	t__2e226 = (u64)((u64)t__2e226 - (u64)t__2e237);
+	t__2e240 = (u64)((u64)t__2e226 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e238, (u64)t__2e239, (u64)t__2e240);
+	t__2e226 = (u64)((u64)t__2e226 + (u64)t__2e222);
+	*(u64 *)t__2e223 = (u64)t__2e226;
+	((void (*)(u64, u64))((u64)X_rt_2eunensure))((u64)t_binding_2e206, (u64)((u64)4UL));
+	t__2e244 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	t__2e245 = (u64)((u64)t_binding_2e206 + (u64)((u64)16UL));
+	t__2e246 = (u64)(*(u64 *)t__2e244);
+	t__2e243 = (u64)(u32)(((u64)t__2e246 == (u64)((u64)4UL)));
+	if ((u32)t__2e243) goto L_passed_2e242; else goto L_failed_2e241;
+	L_failed_2e241:;
+	t_abortsite_2e212 = ((u64)2UL);
+	goto L_abort_2e247;
+	L_passed_2e242:;
+	t__2e266 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	t__2e267 = (u64)((u64)t_binding_2e206 + (u64)((u64)16UL));
+	t__2e268 = (u64)(*(u64 *)t_binding_2e206);
+	t__2e269 = (u64)(*(u64 *)t__2e266);
+	t__2e270 = (u64)((i64)(i32)((u64)0UL));
+	t__2e265 = (u64)((u64)t__2e270 * (u64)((u64)4UL));
+	t__2e265 = (u64)((u64)t__2e268 + (u64)t__2e265);
+	t__2e271 = (u64)(u32)(((u64)t__2e270 < (u64)t__2e269));
+	if ((u32)t__2e271) goto L__2e273; else goto L__2e272;
+	L__2e272:;
+	t_abortsite_2e212 = ((u64)3UL);
+	goto L_abort_2e231;
+	L__2e273:;
+	t__2e274 = (u64)(u32)(*(i32 *)t__2e265);
+	t__2e264 = (u64)(u32)(((u32)t__2e274 == (u32)((u64)1UL)));
+	t__2e261 = (u64)(u32)t__2e264;
+	if ((u32)t__2e261) goto L__2e262; else goto L__2e263;
+	L__2e262:;
+	t__2e277 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	t__2e278 = (u64)((u64)t_binding_2e206 + (u64)((u64)16UL));
+	t__2e279 = (u64)(*(u64 *)t_binding_2e206);
+	t__2e280 = (u64)(*(u64 *)t__2e277);
+	t__2e281 = (u64)((i64)(i32)((u64)1UL));
+	t__2e276 = (u64)((u64)t__2e281 * (u64)((u64)4UL));
+	t__2e276 = (u64)((u64)t__2e279 + (u64)t__2e276);
+	t__2e282 = (u64)(u32)(((u64)t__2e281 < (u64)t__2e280));
+	if ((u32)t__2e282) goto L__2e284; else goto L__2e283;
+	L__2e283:;
+	t_abortsite_2e212 = ((u64)4UL);
+	goto L_abort_2e231;
+	L__2e284:;
+	t__2e285 = (u64)(u32)(*(i32 *)t__2e276);
+	t__2e275 = (u64)(u32)(((u32)t__2e285 == (u32)((u64)3UL)));
+	t__2e261 = (u64)(u32)t__2e275;
+	goto L__2e263;
+	L__2e263:;
+	t__2e258 = (u64)(u32)t__2e261;
+	if ((u32)t__2e258) goto L__2e259; else goto L__2e260;
+	L__2e259:;
+	t__2e288 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	t__2e289 = (u64)((u64)t_binding_2e206 + (u64)((u64)16UL));
+	t__2e290 = (u64)(*(u64 *)t_binding_2e206);
+	t__2e291 = (u64)(*(u64 *)t__2e288);
+	t__2e292 = (u64)((i64)(i32)((u64)2UL));
+	t__2e287 = (u64)((u64)t__2e292 * (u64)((u64)4UL));
+	t__2e287 = (u64)((u64)t__2e290 + (u64)t__2e287);
+	t__2e293 = (u64)(u32)(((u64)t__2e292 < (u64)t__2e291));
+	if ((u32)t__2e293) goto L__2e295; else goto L__2e294;
+	L__2e294:;
+	t_abortsite_2e212 = ((u64)5UL);
+	goto L_abort_2e231;
+	L__2e295:;
+	t__2e296 = (u64)(u32)(*(i32 *)t__2e287);
+	t__2e286 = (u64)(u32)(((u32)t__2e296 == (u32)((u64)4UL)));
+	t__2e258 = (u64)(u32)t__2e286;
+	goto L__2e260;
+	L__2e260:;
+	t__2e255 = (u64)(u32)t__2e258;
+	if ((u32)t__2e255) goto L__2e256; else goto L__2e257;
+	L__2e256:;
+	t__2e299 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	t__2e300 = (u64)((u64)t_binding_2e206 + (u64)((u64)16UL));
+	t__2e301 = (u64)(*(u64 *)t_binding_2e206);
+	t__2e302 = (u64)(*(u64 *)t__2e299);
+	t__2e303 = (u64)((i64)(i32)((u64)3UL));
+	t__2e298 = (u64)((u64)t__2e303 * (u64)((u64)4UL));
+	t__2e298 = (u64)((u64)t__2e301 + (u64)t__2e298);
+	t__2e304 = (u64)(u32)(((u64)t__2e303 < (u64)t__2e302));
+	if ((u32)t__2e304) goto L__2e306; else goto L__2e305;
+	L__2e305:;
+	t_abortsite_2e212 = ((u64)6UL);
+	goto L_abort_2e231;
+	L__2e306:;
+	t__2e307 = (u64)(u32)(*(i32 *)t__2e298);
+	t__2e297 = (u64)(u32)(((u32)t__2e307 == (u32)((u64)5UL)));
+	t__2e255 = (u64)(u32)t__2e297;
+	goto L__2e257;
+	L__2e257:;
+	if ((u32)t__2e255) goto L_passed_2e254; else goto L_failed_2e253;
+	L_failed_2e253:;
+	t_abortsite_2e212 = ((u64)7UL);
+	goto L_abort_2e247;
+	L_passed_2e254:;
+	t__2e308 = (u64)(*(u64 *)t_binding_2e221);
+	t__2e309 = (u64)((i64)(i32)((u64)3UL));
+	t__2e310 = (u64)((u64)t__2e308 + (u64)((u64)8UL));
+	t__2e311 = (u64)((u64)t__2e308 + (u64)((u64)16UL));
+	t__2e312 = (u64)(*(u64 *)t__2e308);
+	t__2e313 = (u64)(*(u64 *)t__2e310);
+	t__2e314 = (u64)(*(u64 *)t__2e311);
+	t__2e315 = (u64)(u32)(((u64)t__2e309 < (u64)t__2e313));
+	if ((u32)t__2e315) goto L__2e317; else goto L__2e316;
+	L__2e316:;
+	t_abortsite_2e212 = ((u64)8UL);
+	goto L_abort_2e231;
+	L__2e317:;
+	t__2e318 = (u64)((u64)t__2e309 + (u64)((u64)1UL));
+	t__2e319 = (u64)((u64)t__2e309 * (u64)((u64)4UL));
+	t__2e319 = (u64)((u64)t__2e319 + (u64)t__2e312);
+	t__2e320 = (u64)((u64)t__2e318 * (u64)((u64)4UL));
+	t__2e320 = (u64)((u64)t__2e320 + (u64)t__2e312);
+	t__2e313 = (u64)((u64)t__2e313 - (u64)t__2e318);
+	t__2e321 = (u64)((u64)t__2e313 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e319, (u64)t__2e320, (u64)t__2e321);
+	t__2e313 = (u64)((u64)t__2e313 + (u64)t__2e309);
+	*(u64 *)t__2e310 = (u64)t__2e313;
+	t__2e325 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	t__2e326 = (u64)((u64)t_binding_2e206 + (u64)((u64)16UL));
+	t__2e327 = (u64)(*(u64 *)t__2e325);
+	t__2e324 = (u64)(u32)(((u64)t__2e327 == (u64)((u64)3UL)));
+	if ((u32)t__2e324) goto L_passed_2e323; else goto L_failed_2e322;
+	L_failed_2e322:;
+	t_abortsite_2e212 = ((u64)9UL);
+	goto L_abort_2e247;
+	L_passed_2e323:;
+	t__2e328 = (u64)(*(u64 *)t_binding_2e221);
+	t__2e329 = (u64)((i64)(i32)((u64)0UL));
+	t__2e330 = (u64)((u64)t__2e328 + (u64)((u64)8UL));
+	t__2e331 = (u64)((u64)t__2e328 + (u64)((u64)16UL));
+	t__2e332 = (u64)(*(u64 *)t__2e328);
+	t__2e333 = (u64)(*(u64 *)t__2e330);
+	t__2e334 = (u64)(*(u64 *)t__2e331);
+	t__2e335 = (u64)(u32)(((u64)t__2e329 < (u64)t__2e333));
+	if ((u32)t__2e335) goto L__2e337; else goto L__2e336;
+	L__2e336:;
+	t_abortsite_2e212 = ((u64)10UL);
+	goto L_abort_2e231;
+	L__2e337:;
+	t__2e338 = (u64)((u64)t__2e329 + (u64)((u64)1UL));
+	t__2e339 = (u64)((u64)t__2e329 * (u64)((u64)4UL));
+	t__2e339 = (u64)((u64)t__2e339 + (u64)t__2e332);
+	t__2e340 = (u64)((u64)t__2e338 * (u64)((u64)4UL));
+	t__2e340 = (u64)((u64)t__2e340 + (u64)t__2e332);
+	t__2e333 = (u64)((u64)t__2e333 - (u64)t__2e338);
+	t__2e341 = (u64)((u64)t__2e333 * (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e339, (u64)t__2e340, (u64)t__2e341);
+	t__2e333 = (u64)((u64)t__2e333 + (u64)t__2e329);
+	*(u64 *)t__2e330 = (u64)t__2e333;
+	((void (*)(u64, u64))((u64)X_rt_2eunensure))((u64)t__2e328, (u64)((u64)4UL));
+	t__2e345 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	t__2e346 = (u64)((u64)t_binding_2e206 + (u64)((u64)16UL));
+	t__2e347 = (u64)(*(u64 *)t__2e345);
+	t__2e344 = (u64)(u32)(((u64)t__2e347 == (u64)((u64)2UL)));
+	if ((u32)t__2e344) goto L_passed_2e343; else goto L_failed_2e342;
+	L_failed_2e342:;
+	t_abortsite_2e212 = ((u64)11UL);
+	goto L_abort_2e247;
+	L_passed_2e343:;
+	t__2e355 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	t__2e356 = (u64)((u64)t_binding_2e206 + (u64)((u64)16UL));
+	t__2e357 = (u64)(*(u64 *)t_binding_2e206);
+	t__2e358 = (u64)(*(u64 *)t__2e355);
+	t__2e359 = (u64)((i64)(i32)((u64)0UL));
+	t__2e354 = (u64)((u64)t__2e359 * (u64)((u64)4UL));
+	t__2e354 = (u64)((u64)t__2e357 + (u64)t__2e354);
+	t__2e360 = (u64)(u32)(((u64)t__2e359 < (u64)t__2e358));
+	if ((u32)t__2e360) goto L__2e362; else goto L__2e361;
+	L__2e361:;
+	t_abortsite_2e212 = ((u64)12UL);
+	goto L_abort_2e231;
+	L__2e362:;
+	t__2e363 = (u64)(u32)(*(i32 *)t__2e354);
+	t__2e353 = (u64)(u32)(((u32)t__2e363 == (u32)((u64)3UL)));
+	t__2e350 = (u64)(u32)t__2e353;
+	if ((u32)t__2e350) goto L__2e351; else goto L__2e352;
+	L__2e351:;
+	t__2e366 = (u64)((u64)t_binding_2e206 + (u64)((u64)8UL));
+	t__2e367 = (u64)((u64)t_binding_2e206 + (u64)((u64)16UL));
+	t__2e368 = (u64)(*(u64 *)t_binding_2e206);
+	t__2e369 = (u64)(*(u64 *)t__2e366);
+	t__2e370 = (u64)((i64)(i32)((u64)1UL));
+	t__2e365 = (u64)((u64)t__2e370 * (u64)((u64)4UL));
+	t__2e365 = (u64)((u64)t__2e368 + (u64)t__2e365);
+	t__2e371 = (u64)(u32)(((u64)t__2e370 < (u64)t__2e369));
+	if ((u32)t__2e371) goto L__2e373; else goto L__2e372;
+	L__2e372:;
+	t_abortsite_2e212 = ((u64)13UL);
+	goto L_abort_2e231;
+	L__2e373:;
+	t__2e374 = (u64)(u32)(*(i32 *)t__2e365);
+	t__2e364 = (u64)(u32)(((u32)t__2e374 == (u32)((u64)4UL)));
+	t__2e350 = (u64)(u32)t__2e364;
+	goto L__2e352;
+	L__2e352:;
+	if ((u32)t__2e350) goto L_passed_2e349; else goto L_failed_2e348;
+	L_failed_2e348:;
+	t_abortsite_2e212 = ((u64)14UL);
+	goto L_abort_2e247;
+	L_passed_2e349:;
+	t__2e375 = (u64)(*(u64 *)t_binding_2e206);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e375);
+	goto L__2e204;
+	L__2e376:;
+	L__2e204:;
+	return;
+	L_abort_2e213:;
+	t__2e214 = (u64)((u64)t_abortsite_2e212 * (u64)((u64)16UL));
+	t__2e214 = (u64)((u64)((u64)((char *)&D_abortsites_2e211)) + (u64)t__2e214);
+	t__2e215 = (u64)(*(u64 *)t__2e214);
+	t__2e216 = (u64)((u64)t__2e214 + (u64)((u64)8UL));
+	t__2e217 = (u64)(*(u32 *)t__2e216);
+	t__2e216 = (u64)((u64)t__2e214 + (u64)((u64)12UL));
+	t__2e218 = (u64)(*(u32 *)t__2e216);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e215, (u64)t__2e217, (u64)t__2e218, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e231:;
+	t__2e232 = (u64)((u64)t_abortsite_2e212 * (u64)((u64)16UL));
+	t__2e232 = (u64)((u64)((u64)((char *)&D_abortsites_2e211)) + (u64)t__2e232);
+	t__2e233 = (u64)(*(u64 *)t__2e232);
+	t__2e234 = (u64)((u64)t__2e232 + (u64)((u64)8UL));
+	t__2e235 = (u64)(*(u32 *)t__2e234);
+	t__2e234 = (u64)((u64)t__2e232 + (u64)((u64)12UL));
+	t__2e236 = (u64)(*(u32 *)t__2e234);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e233, (u64)t__2e235, (u64)t__2e236, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e247:;
+	t__2e248 = (u64)((u64)t_abortsite_2e212 * (u64)((u64)16UL));
+	t__2e248 = (u64)((u64)((u64)((char *)&D_abortsites_2e211)) + (u64)t__2e248);
+	t__2e249 = (u64)(*(u64 *)t__2e248);
+	t__2e250 = (u64)((u64)t__2e248 + (u64)((u64)8UL));
+	t__2e251 = (u64)(*(u32 *)t__2e250);
+	t__2e250 = (u64)((u64)t__2e248 + (u64)((u64)12UL));
+	t__2e252 = (u64)(*(u32 *)t__2e250);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e249, (u64)t__2e251, (u64)t__2e252, (u64)((u64)6UL));
+	__builtin_trap();
+}
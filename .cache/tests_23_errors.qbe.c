@@ -0,0 +1,758 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e14 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; };
+struct __attribute__((packed)) S_strdata_2e89 { u8 f0; u8 f1; u8 f2; u8 f3[17]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[27]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[11]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; u8 f20; u8 f21; u8 f22[21]; u8 f23; u8 f24; u8 f25; u8 f26; u8 f27[10]; u8 f28; u8 f29; u8 f30; u8 f31[2]; u8 f32; u8 f33; u8 f34; u8 f35; u8 f36[29]; u8 f37; u8 f38; };
+struct __attribute__((packed)) S_strliteral_2e90 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e125 { u8 f0; u8 f1; u8 f2; u8 f3[24]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[7]; u8 f9; u8 f10[12]; u8 f11; u8 f12[1]; u8 f13; u8 f14; u8 f15; u8 f16[2]; u8 f17; u8 f18; u8 f19; u8 f20; u8 f21[24]; u8 f22; u8 f23; u8 f24; u8 f25; u8 f26[10]; u8 f27; u8 f28; u8 f29; u8 f30[2]; u8 f31; u8 f32; u8 f33; u8 f34; u8 f35[29]; u8 f36; u8 f37; };
+struct __attribute__((packed)) S_strliteral_2e126 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e106 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_strdata_2e150 { u8 f0; u8 f1; u8 f2; u8 f3[19]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[24]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[6]; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18[10]; u8 f19; u8 f20; u8 f21; u8 f22[2]; u8 f23; u8 f24; };
+struct __attribute__((packed)) S_strliteral_2e151 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e165 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e238 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e288 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e313 { char *f0; u32 f1; u32 f2; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e14 D_abortsites_2e14 __asm__("abortsites.14") __attribute__((used, section(".data.rel.ro.abortsites.14"), aligned(8)));
+static const struct S_strdata_2e89 D_strdata_2e89 __asm__("strdata.89") __attribute__((used, section(".rodata.strdata.89"), aligned(8)));
+static struct S_strliteral_2e90 D_strliteral_2e90 __asm__("strliteral.90") __attribute__((used, section(".data.rel.ro.strliteral.90"), aligned(8)));
+static const struct S_strdata_2e125 D_strdata_2e125 __asm__("strdata.125") __attribute__((used, section(".rodata.strdata.125"), aligned(8)));
+static struct S_strliteral_2e126 D_strliteral_2e126 __asm__("strliteral.126") __attribute__((used, section(".data.rel.ro.strliteral.126"), aligned(8)));
+static struct S_abortsites_2e106 D_abortsites_2e106 __asm__("abortsites.106") __attribute__((used, section(".data.rel.ro.abortsites.106"), aligned(8)));
+static const struct S_strdata_2e150 D_strdata_2e150 __asm__("strdata.150") __attribute__((used, section(".rodata.strdata.150"), aligned(8)));
+static struct S_strliteral_2e151 D_strliteral_2e151 __asm__("strliteral.151") __attribute__((used, section(".data.rel.ro.strliteral.151"), aligned(8)));
+static struct S_abortsites_2e165 D_abortsites_2e165 __asm__("abortsites.165") __attribute__((used, section(".data.rel.ro.abortsites.165"), aligned(8)));
+static struct S_abortsites_2e238 D_abortsites_2e238 __asm__("abortsites.238") __attribute__((used, section(".data.rel.ro.abortsites.238"), aligned(8)));
+static struct S_abortsites_2e288 D_abortsites_2e288 __asm__("abortsites.288") __attribute__((used, section(".data.rel.ro.abortsites.288"), aligned(8)));
+static struct S_abortsites_2e313 D_abortsites_2e313 __asm__("abortsites.313") __attribute__((used, section(".data.rel.ro.abortsites.313"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_measurements(void) __asm__("measurements") __attribute__((used, section(".text.measurements")));
+static void F_void__assignability(void) __asm__("void_assignability") __attribute__((used, section(".text.void_assignability")));
+static void F_cannotignore(void) __asm__("cannotignore") __attribute__((used, section(".text.cannotignore")));
+static u64 F_err__if__false(u64 __rp, u32 p_in) __asm__("err_if_false") __attribute__((used, section(".text.err_if_false")));
+static void F_propagate(void) __asm__("propagate") __attribute__((used, section(".text.propagate")));
+static u64 F_indirect(u64 __rp, u32 p_in) __asm__("indirect") __attribute__((used, section(".text.indirect")));
+static void F_assignability(void) __asm__("assignability") __attribute__((used, section(".text.assignability")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\062\063\055\145\162\162\157\162\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 18U, 18U };
+static struct S_abortsites_2e14 D_abortsites_2e14 = { (char *)((char *)&D_strliteral_2e1) + 0, 72U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 73U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 74U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 77U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 78U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 80U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 82U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 83U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 84U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 85U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 86U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 87U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 88U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 90U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 91U, 15U };
+static const struct S_strdata_2e89 D_strdata_2e89 = { 10U, 9U, 9U, "\164\171\160\145\040\145\162\162\040\075\040\041\166\157\151\144\073", 10U, 10U, 9U, 9U, "\146\156\040\162\145\164\145\162\162\050\051\040\050\151\156\164\040\174\040\145\162\162\051\040\075\040\173", 10U, 9U, 9U, 9U, "\162\145\164\165\162\156\040\145\162\162\073", 10U, 9U, 9U, "\175\073", 10U, 10U, 9U, 9U, "\146\156\040\160\162\157\160\145\162\162\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\162\145\164\145\162\162\050\051\077\073", 10U, 9U, 9U, "\175\073", 10U, 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073", 10U, 9U };
+static struct S_strliteral_2e90 D_strliteral_2e90 = { (char *)((char *)&D_strdata_2e89) + 0, 150U, 150U };
+static const struct S_strdata_2e125 D_strdata_2e125 = { 10U, 9U, 9U, "\146\156\040\144\151\163\141\154\154\157\167\137\061\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\162\145\164\165\162\156\040", 34U, "\111\040\141\155\040\151\154\154\145\147\141\154", 34U, "\073", 10U, 9U, 9U, "\175\073", 10U, 10U, 9U, 9U, "\146\156\040\144\151\163\141\154\154\157\167\137\062\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\162\145\164\165\162\156\040\061\062\073", 10U, 9U, 9U, "\175\073", 10U, 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073", 10U, 9U };
+static struct S_strliteral_2e126 D_strliteral_2e126 = { (char *)((char *)&D_strdata_2e125) + 0, 140U, 140U };
+static struct S_abortsites_2e106 D_abortsites_2e106 = { (char *)((char *)&D_strliteral_2e1) + 0, 56U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 56U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 68U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 68U, 12U };
+static const struct S_strdata_2e150 D_strdata_2e150 = { 10U, 9U, 9U, "\164\171\160\145\040\145\162\162\157\162\040\075\040\041\166\157\151\144\073", 10U, 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\151\156\164\040\075\040\173", 10U, 9U, 9U, 9U, "\145\162\162\157\162\073", 10U, 9U, 9U, 9U, "\162\145\164\165\162\156\040\064\062\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e151 D_strliteral_2e151 = { (char *)((char *)&D_strdata_2e150) + 0, 81U, 81U };
+static struct S_abortsites_2e165 D_abortsites_2e165 = { (char *)((char *)&D_strliteral_2e1) + 0, 39U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 40U, 28U, (char *)((char *)&D_strliteral_2e1) + 0, 40U, 28U };
+static struct S_abortsites_2e238 D_abortsites_2e238 = { (char *)((char *)&D_strliteral_2e1) + 0, 27U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 15U };
+static struct S_abortsites_2e288 D_abortsites_2e288 = { (char *)((char *)&D_strliteral_2e1) + 0, 22U, 33U };
+static struct S_abortsites_2e313 D_abortsites_2e313 = { (char *)((char *)&D_strliteral_2e1) + 0, 9U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_assignability)))();
+	((void (*)(void))((u64)((char *)&F_propagate)))();
+	((void (*)(void))((u64)((char *)&F_cannotignore)))();
+	((void (*)(void))((u64)((char *)&F_void__assignability)))();
+	((void (*)(void))((u64)((char *)&F_measurements)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_measurements(void) {
+	u64 t__2e13;
+	u64 t__2e17;
+	u64 t__2e18;
+	u64 t__2e19;
+	u64 t__2e20;
+	u64 t__2e21;
+	u64 t__2e24;
+	u64 t__2e27;
+	u64 t__2e30;
+	u64 t__2e33;
+	u64 t__2e36;
+	u64 t__2e39;
+	u64 t__2e42;
+	u64 t__2e45;
+	u64 t__2e48;
+	u64 t__2e51;
+	u64 t__2e54;
+	u64 t__2e57;
+	u64 t__2e60;
+	u64 t__2e63;
+	u64 t__2e66;
+	u64 t__2e69;
+	u64 t__2e72;
+	u64 t__2e75;
+	u64 t_abortsite_2e15;
+	L_start_2e7:;
+	L_body_2e8:;
+	t__2e13 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e13) goto L_passed_2e12; else goto L_failed_2e11;
+	L_failed_2e11:;
+	t_abortsite_2e15 = ((u64)0UL);
+	goto L_abort_2e16;
+	L_passed_2e12:;
+	t__2e24 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e24) goto L_passed_2e23; else goto L_failed_2e22;
+	L_failed_2e22:;
+	t_abortsite_2e15 = ((u64)1UL);
+	goto L_abort_2e16;
+	L_passed_2e23:;
+	t__2e27 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e27) goto L_passed_2e26; else goto L_failed_2e25;
+	L_failed_2e25:;
+	t_abortsite_2e15 = ((u64)2UL);
+	goto L_abort_2e16;
+	L_passed_2e26:;
+	t__2e30 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e30) goto L_passed_2e29; else goto L_failed_2e28;
+	L_failed_2e28:;
+	t_abortsite_2e15 = ((u64)3UL);
+	goto L_abort_2e16;
+	L_passed_2e29:;
+	t__2e33 = (u64)(u32)(((u64)((u64)32UL) == (u64)((u64)32UL)));
+	if ((u32)t__2e33) goto L_passed_2e32; else goto L_failed_2e31;
+	L_failed_2e31:;
+	t_abortsite_2e15 = ((u64)4UL);
+	goto L_abort_2e16;
+	L_passed_2e32:;
+	t__2e36 = (u64)(u32)(((u64)((u64)24UL) == (u64)((u64)24UL)));
+	if ((u32)t__2e36) goto L_passed_2e35; else goto L_failed_2e34;
+	L_failed_2e34:;
+	t_abortsite_2e15 = ((u64)5UL);
+	goto L_abort_2e16;
+	L_passed_2e35:;
+	t__2e39 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e39) goto L_passed_2e38; else goto L_failed_2e37;
+	L_failed_2e37:;
+	t_abortsite_2e15 = ((u64)6UL);
+	goto L_abort_2e16;
+	L_passed_2e38:;
+	t__2e42 = (u64)(u32)(((u64)((u64)24UL) == (u64)((u64)24UL)));
+	if ((u32)t__2e42) goto L_passed_2e41; else goto L_failed_2e40;
+	L_failed_2e40:;
+	t_abortsite_2e15 = ((u64)7UL);
+	goto L_abort_2e16;
+	L_passed_2e41:;
+	t__2e45 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e45) goto L_passed_2e44; else goto L_failed_2e43;
+	L_failed_2e43:;
+	t_abortsite_2e15 = ((u64)8UL);
+	goto L_abort_2e16;
+	L_passed_2e44:;
+	t__2e48 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e48) goto L_passed_2e47; else goto L_failed_2e46;
+	L_failed_2e46:;
+	t_abortsite_2e15 = ((u64)9UL);
+	goto L_abort_2e16;
+	L_passed_2e47:;
+	t__2e51 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e51) goto L_passed_2e50; else goto L_failed_2e49;
+	L_failed_2e49:;
+	t_abortsite_2e15 = ((u64)10UL);
+	goto L_abort_2e16;
+	L_passed_2e50:;
+	t__2e54 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e54) goto L_passed_2e53; else goto L_failed_2e52;
+	L_failed_2e52:;
+	t_abortsite_2e15 = ((u64)11UL);
+	goto L_abort_2e16;
+	L_passed_2e53:;
+	t__2e57 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e57) goto L_passed_2e56; else goto L_failed_2e55;
+	L_failed_2e55:;
+	t_abortsite_2e15 = ((u64)12UL);
+	goto L_abort_2e16;
+	L_passed_2e56:;
+	t__2e60 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e60) goto L_passed_2e59; else goto L_failed_2e58;
+	L_failed_2e58:;
+	t_abortsite_2e15 = ((u64)13UL);
+	goto L_abort_2e16;
+	L_passed_2e59:;
+	t__2e63 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e63) goto L_passed_2e62; else goto L_failed_2e61;
+	L_failed_2e61:;
+	t_abortsite_2e15 = ((u64)14UL);
+	goto L_abort_2e16;
+	L_passed_2e62:;
+	t__2e66 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e66) goto L_passed_2e65; else goto L_failed_2e64;
+	L_failed_2e64:;
+	t_abortsite_2e15 = ((u64)15UL);
+	goto L_abort_2e16;
+	L_passed_2e65:;
+	t__2e69 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e69) goto L_passed_2e68; else goto L_failed_2e67;
+	L_failed_2e67:;
+	t_abortsite_2e15 = ((u64)16UL);
+	goto L_abort_2e16;
+	L_passed_2e68:;
+	t__2e72 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e72) goto L_passed_2e71; else goto L_failed_2e70;
+	L_failed_2e70:;
+	t_abortsite_2e15 = ((u64)17UL);
+	goto L_abort_2e16;
+	L_passed_2e71:;
+	t__2e75 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	if ((u32)t__2e75) goto L_passed_2e74; else goto L_failed_2e73;
+	L_failed_2e73:;
+	t_abortsite_2e15 = ((u64)18UL);
+	goto L_abort_2e16;
+	L_passed_2e74:;
+	goto L__2e9;
+	L__2e76:;
+	L__2e9:;
+	return;
+	L_abort_2e16:;
+	t__2e17 = (u64)((u64)t_abortsite_2e15 * (u64)((u64)16UL));
+	t__2e17 = (u64)((u64)((u64)((char *)&D_abortsites_2e14)) + (u64)t__2e17);
+	t__2e18 = (u64)(*(u64 *)t__2e17);
+	t__2e19 = (u64)((u64)t__2e17 + (u64)((u64)8UL));
+	t__2e20 = (u64)(*(u32 *)t__2e19);
+	t__2e19 = (u64)((u64)t__2e17 + (u64)((u64)12UL));
+	t__2e21 = (u64)(*(u32 *)t__2e19);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e18, (u64)t__2e20, (u64)t__2e21, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_void__assignability(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char B4[8] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char R7[4] __attribute__((aligned(16)));
+	char B8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[4] __attribute__((aligned(16)));
+	u64 t__2e103;
+	u64 t__2e105;
+	u64 t__2e109;
+	u64 t__2e110;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e113;
+	u64 t__2e116;
+	u64 t__2e117;
+	u64 t__2e118;
+	u64 t__2e119;
+	u64 t__2e120;
+	u64 t__2e122;
+	u64 t__2e124;
+	u64 t__2e128;
+	u64 t__2e137;
+	u64 t__2e139;
+	u64 t__2e82;
+	u64 t__2e88;
+	u64 t__2e94;
+	u64 t_abortsite_2e107;
+	u64 t_object_2e123;
+	u64 t_object_2e127;
+	u64 t_object_2e84;
+	u64 t_object_2e92;
+	u64 t_tag_2e129;
+	u64 t_tag_2e95;
+	L_start_2e77:;
+	t_object_2e84 = (u64)A0;
+	t_object_2e92 = (u64)A1;
+	t_object_2e123 = (u64)A2;
+	t_object_2e127 = (u64)A3;
+	L_body_2e78:;
+	*(u32 *)t_object_2e84 = (u32)((u64)3532310079UL);
+	t__2e88 = (u64)((u64)t_object_2e84 + (u64)((u64)4UL));
+	*(u32 *)t__2e88 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e92 = (u64)((u64)0UL);
+	t__2e94 = (u64)((u64)t_object_2e92 + (u64)((u64)8UL));
+	*(u64 *)t__2e94 = (u64)((u64)0UL);
+	t__2e94 = (u64)((u64)t__2e94 + (u64)((u64)8UL));
+	*(u64 *)t__2e94 = (u64)((u64)0UL);
+	BLIT((u64)B4, t_object_2e84, 8);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e90)), 24);
+	BLIT((u64)B6, t_object_2e92, 24);
+	t__2e82 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R7, (u64)B4, (u64)B5, (u64)B6);
+	t_tag_2e95 = (u64)(*(u32 *)t__2e82);
+	t__2e103 = (u64)(u32)(((u32)t_tag_2e95 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e103) goto L_member_2e100; else goto L__2e102;
+	L__2e102:;
+	t__2e105 = (u64)(u32)(((u32)t_tag_2e95 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e105) goto L_member_2e101; else goto L__2e104;
+	L__2e104:;
+	goto L_matches_2e99;
+	L_member_2e100:;
+	goto L_matches_2e99;
+	L_member_2e101:;
+	goto L_matches_2e98;
+	L_matches_2e98:;
+	goto L__2e96;
+	L_matches_2e99:;
+	t_abortsite_2e107 = ((u64)0UL);
+	goto L_abort_2e108;
+	L__2e114:;
+	L__2e97:;
+	t_abortsite_2e107 = ((u64)1UL);
+	goto L_abort_2e115;
+	L__2e96:;
+	*(u32 *)t_object_2e123 = (u32)((u64)3532310079UL);
+	t__2e124 = (u64)((u64)t_object_2e123 + (u64)((u64)4UL));
+	*(u32 *)t__2e124 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e127 = (u64)((u64)0UL);
+	t__2e128 = (u64)((u64)t_object_2e127 + (u64)((u64)8UL));
+	*(u64 *)t__2e128 = (u64)((u64)0UL);
+	t__2e128 = (u64)((u64)t__2e128 + (u64)((u64)8UL));
+	*(u64 *)t__2e128 = (u64)((u64)0UL);
+	BLIT((u64)B8, t_object_2e123, 8);
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e126)), 24);
+	BLIT((u64)B10, t_object_2e127, 24);
+	t__2e122 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R11, (u64)B8, (u64)B9, (u64)B10);
+	t_tag_2e129 = (u64)(*(u32 *)t__2e122);
+	t__2e137 = (u64)(u32)(((u32)t_tag_2e129 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e137) goto L_member_2e134; else goto L__2e136;
+	L__2e136:;
+	t__2e139 = (u64)(u32)(((u32)t_tag_2e129 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e139) goto L_member_2e135; else goto L__2e138;
+	L__2e138:;
+	goto L_matches_2e133;
+	L_member_2e134:;
+	goto L_matches_2e133;
+	L_member_2e135:;
+	goto L_matches_2e132;
+	L_matches_2e132:;
+	goto L__2e130;
+	L_matches_2e133:;
+	t_abortsite_2e107 = ((u64)2UL);
+	goto L_abort_2e108;
+	L__2e140:;
+	L__2e131:;
+	t_abortsite_2e107 = ((u64)3UL);
+	goto L_abort_2e115;
+	L__2e130:;
+	goto L__2e79;
+	L__2e141:;
+	L__2e79:;
+	return;
+	L_abort_2e108:;
+	t__2e109 = (u64)((u64)t_abortsite_2e107 * (u64)((u64)16UL));
+	t__2e109 = (u64)((u64)((u64)((char *)&D_abortsites_2e106)) + (u64)t__2e109);
+	t__2e110 = (u64)(*(u64 *)t__2e109);
+	t__2e111 = (u64)((u64)t__2e109 + (u64)((u64)8UL));
+	t__2e112 = (u64)(*(u32 *)t__2e111);
+	t__2e111 = (u64)((u64)t__2e109 + (u64)((u64)12UL));
+	t__2e113 = (u64)(*(u32 *)t__2e111);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e110, (u64)t__2e112, (u64)t__2e113, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e115:;
+	t__2e116 = (u64)((u64)t_abortsite_2e107 * (u64)((u64)16UL));
+	t__2e116 = (u64)((u64)((u64)((char *)&D_abortsites_2e106)) + (u64)t__2e116);
+	t__2e117 = (u64)(*(u64 *)t__2e116);
+	t__2e118 = (u64)((u64)t__2e116 + (u64)((u64)8UL));
+	t__2e119 = (u64)(*(u32 *)t__2e118);
+	t__2e118 = (u64)((u64)t__2e116 + (u64)((u64)12UL));
+	t__2e120 = (u64)(*(u32 *)t__2e118);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e117, (u64)t__2e119, (u64)t__2e120, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_cannotignore(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char B3[8] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char R6[4] __attribute__((aligned(16)));
+	char R7[8] __attribute__((aligned(16)));
+	u64 t__2e147;
+	u64 t__2e149;
+	u64 t__2e153;
+	u64 t__2e162;
+	u64 t__2e164;
+	u64 t__2e168;
+	u64 t__2e169;
+	u64 t__2e170;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t__2e175;
+	u64 t__2e176;
+	u64 t__2e177;
+	u64 t__2e178;
+	u64 t__2e179;
+	u64 t__2e180;
+	u64 t__2e181;
+	u64 t__2e193;
+	u64 t__2e195;
+	u64 t__2e197;
+	u64 t__2e198;
+	u64 t__2e199;
+	u64 t_abortsite_2e166;
+	u64 t_binding_2e196;
+	u64 t_object_2e148;
+	u64 t_object_2e152;
+	u64 t_tag_2e154;
+	u64 t_tag_2e185;
+	L_start_2e142:;
+	t_object_2e148 = (u64)A0;
+	t_object_2e152 = (u64)A1;
+	t_binding_2e196 = (u64)A2;
+	L_body_2e143:;
+	*(u32 *)t_object_2e148 = (u32)((u64)3532310079UL);
+	t__2e149 = (u64)((u64)t_object_2e148 + (u64)((u64)4UL));
+	*(u32 *)t__2e149 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e152 = (u64)((u64)0UL);
+	t__2e153 = (u64)((u64)t_object_2e152 + (u64)((u64)8UL));
+	*(u64 *)t__2e153 = (u64)((u64)0UL);
+	t__2e153 = (u64)((u64)t__2e153 + (u64)((u64)8UL));
+	*(u64 *)t__2e153 = (u64)((u64)0UL);
+	BLIT((u64)B3, t_object_2e148, 8);
+	BLIT((u64)B4, ((u64)((char *)&D_strliteral_2e151)), 24);
+	BLIT((u64)B5, t_object_2e152, 24);
+	t__2e147 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R6, (u64)B3, (u64)B4, (u64)B5);
+	t_tag_2e154 = (u64)(*(u32 *)t__2e147);
+	t__2e162 = (u64)(u32)(((u32)t_tag_2e154 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e162) goto L_member_2e159; else goto L__2e161;
+	L__2e161:;
+	t__2e164 = (u64)(u32)(((u32)t_tag_2e154 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e164) goto L_member_2e160; else goto L__2e163;
+	L__2e163:;
+	goto L_matches_2e158;
+	L_member_2e159:;
+	goto L_matches_2e158;
+	L_member_2e160:;
+	goto L_matches_2e157;
+	L_matches_2e157:;
+	goto L__2e155;
+	L_matches_2e158:;
+	t_abortsite_2e166 = ((u64)0UL);
+	goto L_abort_2e167;
+	L__2e173:;
+	L__2e156:;
+	t_abortsite_2e166 = ((u64)1UL);
+	goto L_abort_2e174;
+	L__2e155:;
+	t__2e181 = ((u64 (*)(u64, u32))((u64)((char *)&F_err__if__false)))((u64)R7, (u32)((u64)1UL));
+	t_tag_2e185 = (u64)(*(u32 *)t__2e181);
+	t__2e193 = (u64)(u32)(((u32)t_tag_2e185 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e193) goto L_member_2e190; else goto L__2e192;
+	L__2e192:;
+	t__2e195 = (u64)(u32)(((u32)t_tag_2e185 == (u32)((u64)2115233551UL)));
+	if ((u32)t__2e195) goto L_member_2e191; else goto L__2e194;
+	L__2e194:;
+	goto L_matches_2e189;
+	L_member_2e190:;
+	goto L_matches_2e188;
+	L_member_2e191:;
+	goto L_matches_2e189;
+	L_matches_2e188:;
+	t__2e197 = (u64)((u64)t__2e181 + (u64)((u64)4UL));
+	t__2e198 = (u64)(u32)(*(i32 *)t__2e197);
+	*(u32 *)t_binding_2e196 = (u32)t__2e198;
+	t__2e199 = (u64)(u32)(*(i32 *)t_binding_2e196);
+	t__2e180 = (u64)(u32)t__2e199;
+	goto L__2e186;
+	L_matches_2e189:;
+	t_abortsite_2e166 = ((u64)2UL);
+	goto L_abort_2e167;
+	L__2e200:;
+	L__2e187:;
+	t_abortsite_2e166 = ((u64)3UL);
+	goto L_abort_2e174;
+	L__2e186:;
+	goto L__2e144;
+	L__2e201:;
+	L__2e144:;
+	return;
+	L_abort_2e167:;
+	t__2e168 = (u64)((u64)t_abortsite_2e166 * (u64)((u64)16UL));
+	t__2e168 = (u64)((u64)((u64)((char *)&D_abortsites_2e165)) + (u64)t__2e168);
+	t__2e169 = (u64)(*(u64 *)t__2e168);
+	t__2e170 = (u64)((u64)t__2e168 + (u64)((u64)8UL));
+	t__2e171 = (u64)(*(u32 *)t__2e170);
+	t__2e170 = (u64)((u64)t__2e168 + (u64)((u64)12UL));
+	t__2e172 = (u64)(*(u32 *)t__2e170);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e169, (u64)t__2e171, (u64)t__2e172, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e174:;
+	t__2e175 = (u64)((u64)t_abortsite_2e166 * (u64)((u64)16UL));
+	t__2e175 = (u64)((u64)((u64)((char *)&D_abortsites_2e165)) + (u64)t__2e175);
+	t__2e176 = (u64)(*(u64 *)t__2e175);
+	t__2e177 = (u64)((u64)t__2e175 + (u64)((u64)8UL));
+	t__2e178 = (u64)(*(u32 *)t__2e177);
+	t__2e177 = (u64)((u64)t__2e175 + (u64)((u64)12UL));
+	t__2e179 = (u64)(*(u32 *)t__2e177);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e176, (u64)t__2e178, (u64)t__2e179, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u64 F_err__if__false(u64 __rp, u32 p_in) {
+	char A0[1] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e211;
+	u64 t__2e212;
+	u64 t__2e216;
+	u64 t_in;
+	u64 t_object_2e215;
+	u64 t_object_2e219;
+	u64 t_param_2e203;
+	t_in = (u64)p_in;
+	L_start_2e202:;
+	t_param_2e203 = (u64)A0;
+	t_object_2e215 = (u64)A1;
+	t_object_2e219 = (u64)A2;
+	*(u8 *)t_param_2e203 = (u8)t_in;
+	L_body_2e204:;
+	t__2e211 = (u64)(u32)(*(u8 *)t_param_2e203);
+	t__2e212 = (u64)(u32)((u8)t__2e211);
+	if ((u32)t__2e212) goto L_true_2e208; else goto L_false_2e209;
+	L_true_2e208:;
+	*(u32 *)t_object_2e215 = (u32)((u64)1099590421UL);
+	t__2e216 = (u64)((u64)t_object_2e215 + (u64)((u64)4UL));
+	*(u32 *)t__2e216 = (u32)((u64)1337UL);
+	BLIT(__rp, t_object_2e215, 8); return __rp;
+	L__2e217:;
+	L__2e213:;
+	L__2e218:;
+	L_false_2e209:;
+	L__2e210:;
+	*(u32 *)t_object_2e219 = (u32)((u64)2115233551UL);
+	BLIT(__rp, t_object_2e219, 8); return __rp;
+	L__2e220:;
+	L__2e205:;
+	L__2e221:;
+	return 0;
+}
+static void F_propagate(void) {
+	char R0[8] __attribute__((aligned(16)));
+	char R1[8] __attribute__((aligned(16)));
+	u64 t__2e228;
+	u64 t__2e229;
+	u64 t__2e230;
+	u64 t__2e231;
+	u64 t__2e235;
+	u64 t__2e241;
+	u64 t__2e242;
+	u64 t__2e243;
+	u64 t__2e244;
+	u64 t__2e245;
+	u64 t__2e246;
+	u64 t__2e248;
+	u64 t__2e249;
+	u64 t__2e250;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e255;
+	u64 t__2e256;
+	u64 t__2e259;
+	u64 t_abortsite_2e239;
+	u64 t_subval_2e234;
+	u64 t_subval_2e258;
+	L_start_2e222:;
+	L_body_2e223:;
+	t__2e229 = ((u64 (*)(u64, u32))((u64)((char *)&F_indirect)))((u64)R0, (u32)((u64)1UL));
+	t__2e230 = t__2e229;
+	t__2e231 = (u64)(u32)(*(u32 *)t__2e229);
+	t_subval_2e234 = t__2e229;
+	t__2e235 = (u64)(u32)(((u32)t__2e231 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e235) goto L_subtype_2e237; else goto L_failed_2e233;
+	L_subtype_2e237:;
+	goto L_passed_2e232;
+	L_failed_2e233:;
+	t_abortsite_2e239 = ((u64)0UL);
+	goto L_abort_2e240;
+	L_passed_2e232:;
+	t__2e230 = (u64)((u64)t__2e230 + (u64)((u64)4UL));
+	t__2e246 = (u64)(u32)(*(i32 *)t__2e230);
+	t__2e228 = (u64)(u32)(((u32)t__2e246 == (u32)((u64)1337UL)));
+	if ((u32)t__2e228) goto L_passed_2e227; else goto L_failed_2e226;
+	L_failed_2e226:;
+	t_abortsite_2e239 = ((u64)1UL);
+	goto L_abort_2e247;
+	L_passed_2e227:;
+	t__2e255 = ((u64 (*)(u64, u32))((u64)((char *)&F_indirect)))((u64)R1, (u32)((u64)0UL));
+	t__2e256 = (u64)(u32)(*(u32 *)t__2e255);
+	t_subval_2e258 = t__2e255;
+	t__2e259 = (u64)(u32)(((u32)t__2e256 == (u32)((u64)2115233551UL)));
+	if ((u32)t__2e259) goto L_subtype_2e261; else goto L_passed_2e257;
+	L_subtype_2e261:;
+	goto L_passed_2e257;
+	L_passed_2e257:;
+	if ((u32)t__2e259) goto L_passed_2e254; else goto L_failed_2e253;
+	L_failed_2e253:;
+	t_abortsite_2e239 = ((u64)2UL);
+	goto L_abort_2e247;
+	L_passed_2e254:;
+	goto L__2e224;
+	L__2e262:;
+	L__2e224:;
+	return;
+	L_abort_2e240:;
+	t__2e241 = (u64)((u64)t_abortsite_2e239 * (u64)((u64)16UL));
+	t__2e241 = (u64)((u64)((u64)((char *)&D_abortsites_2e238)) + (u64)t__2e241);
+	t__2e242 = (u64)(*(u64 *)t__2e241);
+	t__2e243 = (u64)((u64)t__2e241 + (u64)((u64)8UL));
+	t__2e244 = (u64)(*(u32 *)t__2e243);
+	t__2e243 = (u64)((u64)t__2e241 + (u64)((u64)12UL));
+	t__2e245 = (u64)(*(u32 *)t__2e243);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e242, (u64)t__2e244, (u64)t__2e245, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e247:;
+	t__2e248 = (u64)((u64)t_abortsite_2e239 * (u64)((u64)16UL));
+	t__2e248 = (u64)((u64)((u64)((char *)&D_abortsites_2e238)) + (u64)t__2e248);
+	t__2e249 = (u64)(*(u64 *)t__2e248);
+	t__2e250 = (u64)((u64)t__2e248 + (u64)((u64)8UL));
+	t__2e251 = (u64)(*(u32 *)t__2e250);
+	t__2e250 = (u64)((u64)t__2e248 + (u64)((u64)12UL));
+	t__2e252 = (u64)(*(u32 *)t__2e250);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e249, (u64)t__2e251, (u64)t__2e252, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static u64 F_indirect(u64 __rp, u32 p_in) {
+	char A0[1] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char R5[8] __attribute__((aligned(16)));
+	u64 t__2e269;
+	u64 t__2e270;
+	u64 t__2e279;
+	u64 t__2e281;
+	u64 t__2e283;
+	u64 t__2e284;
+	u64 t__2e285;
+	u64 t__2e291;
+	u64 t__2e292;
+	u64 t__2e293;
+	u64 t__2e294;
+	u64 t__2e295;
+	u64 t__2e297;
+	u64 t__2e298;
+	u64 t_abortsite_2e289;
+	u64 t_binding_2e268;
+	u64 t_binding_2e282;
+	u64 t_in;
+	u64 t_object_2e286;
+	u64 t_object_2e296;
+	u64 t_param_2e264;
+	u64 t_tag_2e271;
+	t_in = (u64)p_in;
+	L_start_2e263:;
+	t_param_2e264 = (u64)A0;
+	t_binding_2e268 = (u64)A1;
+	t_binding_2e282 = (u64)A2;
+	t_object_2e286 = (u64)A3;
+	t_object_2e296 = (u64)A4;
+	*(u8 *)t_param_2e264 = (u8)t_in;
+	L_body_2e265:;
+	t__2e270 = (u64)(u32)(*(u8 *)t_param_2e264);
+	t__2e269 = ((u64 (*)(u64, u32))((u64)((char *)&F_err__if__false)))((u64)R5, (u32)t__2e270);
+	t_tag_2e271 = (u64)(*(u32 *)t__2e269);
+	t__2e279 = (u64)(u32)(((u32)t_tag_2e271 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e279) goto L_member_2e276; else goto L__2e278;
+	L__2e278:;
+	t__2e281 = (u64)(u32)(((u32)t_tag_2e271 == (u32)((u64)2115233551UL)));
+	if ((u32)t__2e281) goto L_member_2e277; else goto L__2e280;
+	L__2e280:;
+	goto L__2e273;
+	L_member_2e276:;
+	goto L_matches_2e274;
+	L_member_2e277:;
+	goto L_matches_2e275;
+	L_matches_2e274:;
+	t__2e283 = (u64)((u64)t__2e269 + (u64)((u64)4UL));
+	t__2e284 = (u64)(u32)(*(i32 *)t__2e283);
+	*(u32 *)t_binding_2e282 = (u32)t__2e284;
+	t__2e285 = (u64)(u32)(*(i32 *)t_binding_2e282);
+	*(u32 *)t_binding_2e268 = (u32)t__2e285;
+	goto L__2e272;
+	L_matches_2e275:;
+	*(u32 *)t_object_2e286 = (u32)((u64)2115233551UL);
+	BLIT(__rp, t_object_2e286, 8); return __rp;
+	L__2e287:;
+	L__2e273:;
+	t_abortsite_2e289 = ((u64)0UL);
+	goto L_abort_2e290;
+	L__2e272:;
+	*(u32 *)t_object_2e296 = (u32)((u64)1099590421UL);
+	t__2e297 = (u64)((u64)t_object_2e296 + (u64)((u64)4UL));
+	t__2e298 = (u64)(u32)(*(i32 *)t_binding_2e268);
+	*(u32 *)t__2e297 = (u32)t__2e298;
+	BLIT(__rp, t_object_2e296, 8); return __rp;
+	L__2e299:;
+	L__2e266:;
+	L__2e300:;
+	return 0;
+	L_abort_2e290:;
+	t__2e291 = (u64)((u64)t_abortsite_2e289 * (u64)((u64)16UL));
+	t__2e291 = (u64)((u64)((u64)((char *)&D_abortsites_2e288)) + (u64)t__2e291);
+	t__2e292 = (u64)(*(u64 *)t__2e291);
+	t__2e293 = (u64)((u64)t__2e291 + (u64)((u64)8UL));
+	t__2e294 = (u64)(*(u32 *)t__2e293);
+	t__2e293 = (u64)((u64)t__2e291 + (u64)((u64)12UL));
+	t__2e295 = (u64)(*(u32 *)t__2e293);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e292, (u64)t__2e294, (u64)t__2e295, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_assignability(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e307;
+	u64 t__2e310;
+	u64 t__2e311;
+	u64 t__2e312;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e318;
+	u64 t__2e319;
+	u64 t__2e320;
+	u64 t_abortsite_2e314;
+	u64 t_binding_2e305;
+	u64 t_binding_2e306;
+	L_start_2e301:;
+	t_binding_2e305 = (u64)A0;
+	t_binding_2e306 = (u64)A1;
+	L_body_2e302:;
+	*(u32 *)t_binding_2e305 = (u32)((u64)10UL);
+	t__2e307 = (u64)(u32)(*(i32 *)t_binding_2e305);
+	*(u32 *)t_binding_2e306 = (u32)t__2e307;
+	t__2e311 = (u64)(u32)(*(i32 *)t_binding_2e305);
+	t__2e312 = (u64)(u32)(*(i32 *)t_binding_2e306);
+	t__2e310 = (u64)(u32)(((u32)t__2e311 == (u32)t__2e312));
+	if ((u32)t__2e310) goto L_passed_2e309; else goto L_failed_2e308;
+	L_failed_2e308:;
+	t_abortsite_2e314 = ((u64)0UL);
+	goto L_abort_2e315;
+	L_passed_2e309:;
+	goto L__2e303;
+	L__2e321:;
+	L__2e303:;
+	return;
+	L_abort_2e315:;
+	t__2e316 = (u64)((u64)t_abortsite_2e314 * (u64)((u64)16UL));
+	t__2e316 = (u64)((u64)((u64)((char *)&D_abortsites_2e313)) + (u64)t__2e316);
+	t__2e317 = (u64)(*(u64 *)t__2e316);
+	t__2e318 = (u64)((u64)t__2e316 + (u64)((u64)8UL));
+	t__2e319 = (u64)(*(u32 *)t__2e318);
+	t__2e318 = (u64)((u64)t__2e316 + (u64)((u64)12UL));
+	t__2e320 = (u64)(*(u32 *)t__2e318);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e317, (u64)t__2e319, (u64)t__2e320, (u64)((u64)6UL));
+	__builtin_trap();
+}
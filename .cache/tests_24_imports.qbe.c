@@ -0,0 +1,690 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e19 { u8 f0; u8 f1; u8 f2; u8 f3[10]; u8 f4; u8 f5; u8 f6; u8 f7[42]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e20 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e55 { u8 f0; u8 f1; u8 f2; u8 f3[19]; u8 f4; u8 f5; u8 f6; u8 f7[38]; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12[18]; u8 f13; u8 f14; u8 f15; u8 f16[2]; u8 f17; u8 f18; };
+struct __attribute__((packed)) S_strliteral_2e56 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e75 { u8 f0; u8 f1; u8 f2; u8 f3[19]; u8 f4; u8 f5; u8 f6; u8 f7[38]; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12[10]; u8 f13; u8 f14; u8 f15; u8 f16[2]; u8 f17; u8 f18; };
+struct __attribute__((packed)) S_strliteral_2e76 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e95 { u8 f0; u8 f1; u8 f2; u8 f3[12]; u8 f4; u8 f5; u8 f6; u8 f7[22]; u8 f8; u8 f9; u8 f10; u8 f11[29]; u8 f12; u8 f13; };
+struct __attribute__((packed)) S_strliteral_2e96 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e115 { u8 f0; u8 f1; u8 f2; u8 f3[13]; u8 f4; u8 f5; u8 f6; u8 f7[29]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e116 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e135 { u8 f0; u8 f1; u8 f2; u8 f3[17]; u8 f4; u8 f5; u8 f6; u8 f7[29]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e136 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e155 { u8 f0; u8 f1; u8 f2; u8 f3[19]; u8 f4; u8 f5; u8 f6; u8 f7[29]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e156 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e175 { u8 f0; u8 f1; u8 f2; u8 f3[21]; u8 f4; u8 f5; u8 f6; u8 f7[29]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e176 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e195 { u8 f0; u8 f1; u8 f2; u8 f3[14]; u8 f4; u8 f5; u8 f6; u8 f7[29]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e196 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e215 { u8 f0; u8 f1; u8 f2; u8 f3[21]; u8 f4; u8 f5; u8 f6; u8 f7[29]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e216 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e235 { u8 f0; u8 f1; u8 f2; u8 f3[12]; u8 f4; u8 f5; u8 f6; u8 f7[52]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e236 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e36 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e19 D_strdata_2e19 __asm__("strdata.19") __attribute__((used, section(".rodata.strdata.19"), aligned(8)));
+static struct S_strliteral_2e20 D_strliteral_2e20 __asm__("strliteral.20") __attribute__((used, section(".data.rel.ro.strliteral.20"), aligned(8)));
+static const struct S_strdata_2e55 D_strdata_2e55 __asm__("strdata.55") __attribute__((used, section(".rodata.strdata.55"), aligned(8)));
+static struct S_strliteral_2e56 D_strliteral_2e56 __asm__("strliteral.56") __attribute__((used, section(".data.rel.ro.strliteral.56"), aligned(8)));
+static const struct S_strdata_2e75 D_strdata_2e75 __asm__("strdata.75") __attribute__((used, section(".rodata.strdata.75"), aligned(8)));
+static struct S_strliteral_2e76 D_strliteral_2e76 __asm__("strliteral.76") __attribute__((used, section(".data.rel.ro.strliteral.76"), aligned(8)));
+static const struct S_strdata_2e95 D_strdata_2e95 __asm__("strdata.95") __attribute__((used, section(".rodata.strdata.95"), aligned(8)));
+static struct S_strliteral_2e96 D_strliteral_2e96 __asm__("strliteral.96") __attribute__((used, section(".data.rel.ro.strliteral.96"), aligned(8)));
+static const struct S_strdata_2e115 D_strdata_2e115 __asm__("strdata.115") __attribute__((used, section(".rodata.strdata.115"), aligned(8)));
+static struct S_strliteral_2e116 D_strliteral_2e116 __asm__("strliteral.116") __attribute__((used, section(".data.rel.ro.strliteral.116"), aligned(8)));
+static const struct S_strdata_2e135 D_strdata_2e135 __asm__("strdata.135") __attribute__((used, section(".rodata.strdata.135"), aligned(8)));
+static struct S_strliteral_2e136 D_strliteral_2e136 __asm__("strliteral.136") __attribute__((used, section(".data.rel.ro.strliteral.136"), aligned(8)));
+static const struct S_strdata_2e155 D_strdata_2e155 __asm__("strdata.155") __attribute__((used, section(".rodata.strdata.155"), aligned(8)));
+static struct S_strliteral_2e156 D_strliteral_2e156 __asm__("strliteral.156") __attribute__((used, section(".data.rel.ro.strliteral.156"), aligned(8)));
+static const struct S_strdata_2e175 D_strdata_2e175 __asm__("strdata.175") __attribute__((used, section(".rodata.strdata.175"), aligned(8)));
+static struct S_strliteral_2e176 D_strliteral_2e176 __asm__("strliteral.176") __attribute__((used, section(".data.rel.ro.strliteral.176"), aligned(8)));
+static const struct S_strdata_2e195 D_strdata_2e195 __asm__("strdata.195") __attribute__((used, section(".rodata.strdata.195"), aligned(8)));
+static struct S_strliteral_2e196 D_strliteral_2e196 __asm__("strliteral.196") __attribute__((used, section(".data.rel.ro.strliteral.196"), aligned(8)));
+static const struct S_strdata_2e215 D_strdata_2e215 __asm__("strdata.215") __attribute__((used, section(".rodata.strdata.215"), aligned(8)));
+static struct S_strliteral_2e216 D_strliteral_2e216 __asm__("strliteral.216") __attribute__((used, section(".data.rel.ro.strliteral.216"), aligned(8)));
+static const struct S_strdata_2e235 D_strdata_2e235 __asm__("strdata.235") __attribute__((used, section(".rodata.strdata.235"), aligned(8)));
+static struct S_strliteral_2e236 D_strliteral_2e236 __asm__("strliteral.236") __attribute__((used, section(".data.rel.ro.strliteral.236"), aligned(8)));
+static struct S_abortsites_2e36 D_abortsites_2e36 __asm__("abortsites.36") __attribute__((used, section(".data.rel.ro.abortsites.36"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\062\064\055\151\155\160\157\162\164\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 19U, 19U };
+static const struct S_strdata_2e19 D_strdata_2e19 = { 10U, 9U, 9U, "\165\163\145\040\167\162\157\156\147\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\164\145\163\164\155\157\144\072\072\166\141\154\073\040\175\073", 10U, 9U };
+static struct S_strliteral_2e20 D_strliteral_2e20 = { (char *)((char *)&D_strdata_2e19) + 0, 60U, 60U };
+static const struct S_strdata_2e55 D_strdata_2e55 = { 10U, 9U, 9U, "\165\163\145\040\164\145\163\164\155\157\144\072\072\173\166\141\154\175\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\163\164\141\164\151\143\040\141\163\163\145\162\164\050", 10U, 9U, 9U, 9U, "\164\145\163\164\155\157\144\072\072\166\141\154\040\075\075\040\064\062", 10U, 9U, 9U, "\051\073", 10U, 9U };
+static struct S_strliteral_2e56 D_strliteral_2e56 = { (char *)((char *)&D_strdata_2e55) + 0, 92U, 92U };
+static const struct S_strdata_2e75 D_strdata_2e75 = { 10U, 9U, 9U, "\165\163\145\040\164\145\163\164\155\157\144\072\072\173\166\141\154\175\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\163\164\141\164\151\143\040\141\163\163\145\162\164\050", 10U, 9U, 9U, 9U, "\166\141\154\062\040\075\075\040\071\060", 10U, 9U, 9U, "\051\073", 10U, 9U };
+static struct S_strliteral_2e76 D_strliteral_2e76 = { (char *)((char *)&D_strdata_2e75) + 0, 84U, 84U };
+static const struct S_strdata_2e95 D_strdata_2e95 = { 10U, 9U, 9U, "\165\163\145\040\164\145\163\164\155\157\144\073", 10U, 9U, 9U, "\165\163\145\040\164\145\163\164\040\075\040\164\145\163\164\155\157\144\072\072\052\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073", 10U, 9U };
+static struct S_strliteral_2e96 D_strliteral_2e96 = { (char *)((char *)&D_strdata_2e95) + 0, 74U, 74U };
+static const struct S_strdata_2e115 D_strdata_2e115 = { 10U, 9U, 9U, "\165\163\145\040\164\145\163\164\155\157\144\052\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073", 10U, 9U };
+static struct S_strliteral_2e116 D_strliteral_2e116 = { (char *)((char *)&D_strdata_2e115) + 0, 50U, 50U };
+static const struct S_strdata_2e135 D_strdata_2e135 = { 10U, 9U, 9U, "\165\163\145\040\164\145\163\164\155\157\144\173\166\141\154\175\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073", 10U, 9U };
+static struct S_strliteral_2e136 D_strliteral_2e136 = { (char *)((char *)&D_strdata_2e135) + 0, 54U, 54U };
+static const struct S_strdata_2e155 D_strdata_2e155 = { 10U, 9U, 9U, "\165\163\145\040\141\072\072\142\040\075\040\164\145\163\164\155\157\144\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073", 10U, 9U };
+static struct S_strliteral_2e156 D_strliteral_2e156 = { (char *)((char *)&D_strdata_2e155) + 0, 56U, 56U };
+static const struct S_strdata_2e175 D_strdata_2e175 = { 10U, 9U, 9U, "\165\163\145\040\164\145\163\164\072\072\040\075\040\164\145\163\164\155\157\144\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073", 10U, 9U };
+static struct S_strliteral_2e176 D_strliteral_2e176 = { (char *)((char *)&D_strdata_2e175) + 0, 58U, 58U };
+static const struct S_strdata_2e195 D_strdata_2e195 = { 10U, 9U, 9U, "\165\163\145\040\164\145\163\164\155\157\144\072\072\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073", 10U, 9U };
+static struct S_strliteral_2e196 D_strliteral_2e196 = { (char *)((char *)&D_strdata_2e195) + 0, 51U, 51U };
+static const struct S_strdata_2e215 D_strdata_2e215 = { 10U, 9U, 9U, "\165\163\145\040\164\145\163\164\040\075\040\164\145\163\164\155\157\144\072\072\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073", 10U, 9U };
+static struct S_strliteral_2e216 D_strliteral_2e216 = { (char *)((char *)&D_strdata_2e215) + 0, 58U, 58U };
+static const struct S_strdata_2e235 D_strdata_2e235 = { 10U, 9U, 9U, "\165\163\145\040\164\145\163\164\155\157\144\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\164\145\163\164\155\157\144\072\072\164\145\163\164\155\157\144\072\072\166\141\154\063\073\040\175\073", 10U, 9U };
+static struct S_strliteral_2e236 D_strliteral_2e236 = { (char *)((char *)&D_strdata_2e235) + 0, 72U, 72U };
+static struct S_abortsites_2e36 D_abortsites_2e36 = { (char *)((char *)&D_strliteral_2e1) + 0, 19U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 25U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 25U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 40U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 40U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 44U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 44U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 48U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 48U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 56U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 56U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 64U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 64U, 12U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_reject(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char A20[8] __attribute__((aligned(16)));
+	char A21[24] __attribute__((aligned(16)));
+	char B22[8] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char R25[4] __attribute__((aligned(16)));
+	char B26[8] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char R29[4] __attribute__((aligned(16)));
+	char B30[8] __attribute__((aligned(16)));
+	char B31[24] __attribute__((aligned(16)));
+	char B32[24] __attribute__((aligned(16)));
+	char R33[4] __attribute__((aligned(16)));
+	char B34[8] __attribute__((aligned(16)));
+	char B35[24] __attribute__((aligned(16)));
+	char B36[24] __attribute__((aligned(16)));
+	char R37[4] __attribute__((aligned(16)));
+	char B38[8] __attribute__((aligned(16)));
+	char B39[24] __attribute__((aligned(16)));
+	char B40[24] __attribute__((aligned(16)));
+	char R41[4] __attribute__((aligned(16)));
+	char B42[8] __attribute__((aligned(16)));
+	char B43[24] __attribute__((aligned(16)));
+	char B44[24] __attribute__((aligned(16)));
+	char R45[4] __attribute__((aligned(16)));
+	char B46[8] __attribute__((aligned(16)));
+	char B47[24] __attribute__((aligned(16)));
+	char B48[24] __attribute__((aligned(16)));
+	char R49[4] __attribute__((aligned(16)));
+	char B50[8] __attribute__((aligned(16)));
+	char B51[24] __attribute__((aligned(16)));
+	char B52[24] __attribute__((aligned(16)));
+	char R53[4] __attribute__((aligned(16)));
+	char B54[8] __attribute__((aligned(16)));
+	char B55[24] __attribute__((aligned(16)));
+	char B56[24] __attribute__((aligned(16)));
+	char R57[4] __attribute__((aligned(16)));
+	char B58[8] __attribute__((aligned(16)));
+	char B59[24] __attribute__((aligned(16)));
+	char B60[24] __attribute__((aligned(16)));
+	char R61[4] __attribute__((aligned(16)));
+	char B62[8] __attribute__((aligned(16)));
+	char B63[24] __attribute__((aligned(16)));
+	char B64[24] __attribute__((aligned(16)));
+	char R65[4] __attribute__((aligned(16)));
+	u64 t__2e107;
+	u64 t__2e109;
+	u64 t__2e112;
+	u64 t__2e114;
+	u64 t__2e118;
+	u64 t__2e12;
+	u64 t__2e127;
+	u64 t__2e129;
+	u64 t__2e132;
+	u64 t__2e134;
+	u64 t__2e138;
+	u64 t__2e147;
+	u64 t__2e149;
+	u64 t__2e152;
+	u64 t__2e154;
+	u64 t__2e158;
+	u64 t__2e167;
+	u64 t__2e169;
+	u64 t__2e172;
+	u64 t__2e174;
+	u64 t__2e178;
+	u64 t__2e18;
+	u64 t__2e187;
+	u64 t__2e189;
+	u64 t__2e192;
+	u64 t__2e194;
+	u64 t__2e198;
+	u64 t__2e207;
+	u64 t__2e209;
+	u64 t__2e212;
+	u64 t__2e214;
+	u64 t__2e218;
+	u64 t__2e227;
+	u64 t__2e229;
+	u64 t__2e232;
+	u64 t__2e234;
+	u64 t__2e238;
+	u64 t__2e24;
+	u64 t__2e247;
+	u64 t__2e249;
+	u64 t__2e33;
+	u64 t__2e35;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e46;
+	u64 t__2e47;
+	u64 t__2e48;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e52;
+	u64 t__2e54;
+	u64 t__2e58;
+	u64 t__2e67;
+	u64 t__2e69;
+	u64 t__2e72;
+	u64 t__2e74;
+	u64 t__2e78;
+	u64 t__2e87;
+	u64 t__2e89;
+	u64 t__2e92;
+	u64 t__2e94;
+	u64 t__2e98;
+	u64 t_abortsite_2e37;
+	u64 t_object_2e113;
+	u64 t_object_2e117;
+	u64 t_object_2e133;
+	u64 t_object_2e137;
+	u64 t_object_2e14;
+	u64 t_object_2e153;
+	u64 t_object_2e157;
+	u64 t_object_2e173;
+	u64 t_object_2e177;
+	u64 t_object_2e193;
+	u64 t_object_2e197;
+	u64 t_object_2e213;
+	u64 t_object_2e217;
+	u64 t_object_2e22;
+	u64 t_object_2e233;
+	u64 t_object_2e237;
+	u64 t_object_2e53;
+	u64 t_object_2e57;
+	u64 t_object_2e73;
+	u64 t_object_2e77;
+	u64 t_object_2e93;
+	u64 t_object_2e97;
+	u64 t_tag_2e119;
+	u64 t_tag_2e139;
+	u64 t_tag_2e159;
+	u64 t_tag_2e179;
+	u64 t_tag_2e199;
+	u64 t_tag_2e219;
+	u64 t_tag_2e239;
+	u64 t_tag_2e25;
+	u64 t_tag_2e59;
+	u64 t_tag_2e79;
+	u64 t_tag_2e99;
+	L_start_2e7:;
+	t_object_2e14 = (u64)A0;
+	t_object_2e22 = (u64)A1;
+	t_object_2e53 = (u64)A2;
+	t_object_2e57 = (u64)A3;
+	t_object_2e73 = (u64)A4;
+	t_object_2e77 = (u64)A5;
+	t_object_2e93 = (u64)A6;
+	t_object_2e97 = (u64)A7;
+	t_object_2e113 = (u64)A8;
+	t_object_2e117 = (u64)A9;
+	t_object_2e133 = (u64)A10;
+	t_object_2e137 = (u64)A11;
+	t_object_2e153 = (u64)A12;
+	t_object_2e157 = (u64)A13;
+	t_object_2e173 = (u64)A14;
+	t_object_2e177 = (u64)A15;
+	t_object_2e193 = (u64)A16;
+	t_object_2e197 = (u64)A17;
+	t_object_2e213 = (u64)A18;
+	t_object_2e217 = (u64)A19;
+	t_object_2e233 = (u64)A20;
+	t_object_2e237 = (u64)A21;
+	L_body_2e8:;
+	*(u32 *)t_object_2e14 = (u32)((u64)3532310079UL);
+	t__2e18 = (u64)((u64)t_object_2e14 + (u64)((u64)4UL));
+	*(u32 *)t__2e18 = (u32)((u64)1UL);
+	*(u64 *)t_object_2e22 = (u64)((u64)0UL);
+	t__2e24 = (u64)((u64)t_object_2e22 + (u64)((u64)8UL));
+	*(u64 *)t__2e24 = (u64)((u64)0UL);
+	t__2e24 = (u64)((u64)t__2e24 + (u64)((u64)8UL));
+	*(u64 *)t__2e24 = (u64)((u64)0UL);
+	BLIT((u64)B22, t_object_2e14, 8);
+	BLIT((u64)B23, ((u64)((char *)&D_strliteral_2e20)), 24);
+	BLIT((u64)B24, t_object_2e22, 24);
+	t__2e12 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R25, (u64)B22, (u64)B23, (u64)B24);
+	t_tag_2e25 = (u64)(*(u32 *)t__2e12);
+	t__2e33 = (u64)(u32)(((u32)t_tag_2e25 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e33) goto L_member_2e30; else goto L__2e32;
+	L__2e32:;
+	t__2e35 = (u64)(u32)(((u32)t_tag_2e25 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e35) goto L_member_2e31; else goto L__2e34;
+	L__2e34:;
+	goto L_matches_2e29;
+	L_member_2e30:;
+	goto L_matches_2e29;
+	L_member_2e31:;
+	goto L_matches_2e28;
+	L_matches_2e28:;
+	goto L__2e26;
+	L_matches_2e29:;
+	t_abortsite_2e37 = ((u64)0UL);
+	goto L_abort_2e38;
+	L__2e44:;
+	L__2e27:;
+	t_abortsite_2e37 = ((u64)1UL);
+	goto L_abort_2e45;
+	L__2e26:;
+	*(u32 *)t_object_2e53 = (u32)((u64)3532310079UL);
+	t__2e54 = (u64)((u64)t_object_2e53 + (u64)((u64)4UL));
+	*(u32 *)t__2e54 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e57 = (u64)((u64)0UL);
+	t__2e58 = (u64)((u64)t_object_2e57 + (u64)((u64)8UL));
+	*(u64 *)t__2e58 = (u64)((u64)0UL);
+	t__2e58 = (u64)((u64)t__2e58 + (u64)((u64)8UL));
+	*(u64 *)t__2e58 = (u64)((u64)0UL);
+	BLIT((u64)B26, t_object_2e53, 8);
+	BLIT((u64)B27, ((u64)((char *)&D_strliteral_2e56)), 24);
+	BLIT((u64)B28, t_object_2e57, 24);
+	t__2e52 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R29, (u64)B26, (u64)B27, (u64)B28);
+	t_tag_2e59 = (u64)(*(u32 *)t__2e52);
+	t__2e67 = (u64)(u32)(((u32)t_tag_2e59 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e67) goto L_member_2e64; else goto L__2e66;
+	L__2e66:;
+	t__2e69 = (u64)(u32)(((u32)t_tag_2e59 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e69) goto L_member_2e65; else goto L__2e68;
+	L__2e68:;
+	goto L_matches_2e63;
+	L_member_2e64:;
+	goto L_matches_2e63;
+	L_member_2e65:;
+	goto L_matches_2e62;
+	L_matches_2e62:;
+	goto L__2e60;
+	L_matches_2e63:;
+	t_abortsite_2e37 = ((u64)2UL);
+	goto L_abort_2e38;
+	L__2e70:;
+	L__2e61:;
+	t_abortsite_2e37 = ((u64)3UL);
+	goto L_abort_2e45;
+	L__2e60:;
+	*(u32 *)t_object_2e73 = (u32)((u64)3532310079UL);
+	t__2e74 = (u64)((u64)t_object_2e73 + (u64)((u64)4UL));
+	*(u32 *)t__2e74 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e77 = (u64)((u64)0UL);
+	t__2e78 = (u64)((u64)t_object_2e77 + (u64)((u64)8UL));
+	*(u64 *)t__2e78 = (u64)((u64)0UL);
+	t__2e78 = (u64)((u64)t__2e78 + (u64)((u64)8UL));
+	*(u64 *)t__2e78 = (u64)((u64)0UL);
+	BLIT((u64)B30, t_object_2e73, 8);
+	BLIT((u64)B31, ((u64)((char *)&D_strliteral_2e76)), 24);
+	BLIT((u64)B32, t_object_2e77, 24);
+	t__2e72 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R33, (u64)B30, (u64)B31, (u64)B32);
+	t_tag_2e79 = (u64)(*(u32 *)t__2e72);
+	t__2e87 = (u64)(u32)(((u32)t_tag_2e79 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e87) goto L_member_2e84; else goto L__2e86;
+	L__2e86:;
+	t__2e89 = (u64)(u32)(((u32)t_tag_2e79 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e89) goto L_member_2e85; else goto L__2e88;
+	L__2e88:;
+	goto L_matches_2e83;
+	L_member_2e84:;
+	goto L_matches_2e83;
+	L_member_2e85:;
+	goto L_matches_2e82;
+	L_matches_2e82:;
+	goto L__2e80;
+	L_matches_2e83:;
+	t_abortsite_2e37 = ((u64)4UL);
+	goto L_abort_2e38;
+	L__2e90:;
+	L__2e81:;
+	t_abortsite_2e37 = ((u64)5UL);
+	goto L_abort_2e45;
+	L__2e80:;
+	*(u32 *)t_object_2e93 = (u32)((u64)3532310079UL);
+	t__2e94 = (u64)((u64)t_object_2e93 + (u64)((u64)4UL));
+	*(u32 *)t__2e94 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e97 = (u64)((u64)0UL);
+	t__2e98 = (u64)((u64)t_object_2e97 + (u64)((u64)8UL));
+	*(u64 *)t__2e98 = (u64)((u64)0UL);
+	t__2e98 = (u64)((u64)t__2e98 + (u64)((u64)8UL));
+	*(u64 *)t__2e98 = (u64)((u64)0UL);
+	BLIT((u64)B34, t_object_2e93, 8);
+	BLIT((u64)B35, ((u64)((char *)&D_strliteral_2e96)), 24);
+	BLIT((u64)B36, t_object_2e97, 24);
+	t__2e92 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R37, (u64)B34, (u64)B35, (u64)B36);
+	t_tag_2e99 = (u64)(*(u32 *)t__2e92);
+	t__2e107 = (u64)(u32)(((u32)t_tag_2e99 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e107) goto L_member_2e104; else goto L__2e106;
+	L__2e106:;
+	t__2e109 = (u64)(u32)(((u32)t_tag_2e99 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e109) goto L_member_2e105; else goto L__2e108;
+	L__2e108:;
+	goto L_matches_2e103;
+	L_member_2e104:;
+	goto L_matches_2e103;
+	L_member_2e105:;
+	goto L_matches_2e102;
+	L_matches_2e102:;
+	goto L__2e100;
+	L_matches_2e103:;
+	t_abortsite_2e37 = ((u64)6UL);
+	goto L_abort_2e38;
+	L__2e110:;
+	L__2e101:;
+	t_abortsite_2e37 = ((u64)7UL);
+	goto L_abort_2e45;
+	L__2e100:;
+	*(u32 *)t_object_2e113 = (u32)((u64)3532310079UL);
+	t__2e114 = (u64)((u64)t_object_2e113 + (u64)((u64)4UL));
+	*(u32 *)t__2e114 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e117 = (u64)((u64)0UL);
+	t__2e118 = (u64)((u64)t_object_2e117 + (u64)((u64)8UL));
+	*(u64 *)t__2e118 = (u64)((u64)0UL);
+	t__2e118 = (u64)((u64)t__2e118 + (u64)((u64)8UL));
+	*(u64 *)t__2e118 = (u64)((u64)0UL);
+	BLIT((u64)B38, t_object_2e113, 8);
+	BLIT((u64)B39, ((u64)((char *)&D_strliteral_2e116)), 24);
+	BLIT((u64)B40, t_object_2e117, 24);
+	t__2e112 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R41, (u64)B38, (u64)B39, (u64)B40);
+	t_tag_2e119 = (u64)(*(u32 *)t__2e112);
+	t__2e127 = (u64)(u32)(((u32)t_tag_2e119 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e127) goto L_member_2e124; else goto L__2e126;
+	L__2e126:;
+	t__2e129 = (u64)(u32)(((u32)t_tag_2e119 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e129) goto L_member_2e125; else goto L__2e128;
+	L__2e128:;
+	goto L_matches_2e123;
+	L_member_2e124:;
+	goto L_matches_2e123;
+	L_member_2e125:;
+	goto L_matches_2e122;
+	L_matches_2e122:;
+	goto L__2e120;
+	L_matches_2e123:;
+	t_abortsite_2e37 = ((u64)8UL);
+	goto L_abort_2e38;
+	L__2e130:;
+	L__2e121:;
+	t_abortsite_2e37 = ((u64)9UL);
+	goto L_abort_2e45;
+	L__2e120:;
+	*(u32 *)t_object_2e133 = (u32)((u64)3532310079UL);
+	t__2e134 = (u64)((u64)t_object_2e133 + (u64)((u64)4UL));
+	*(u32 *)t__2e134 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e137 = (u64)((u64)0UL);
+	t__2e138 = (u64)((u64)t_object_2e137 + (u64)((u64)8UL));
+	*(u64 *)t__2e138 = (u64)((u64)0UL);
+	t__2e138 = (u64)((u64)t__2e138 + (u64)((u64)8UL));
+	*(u64 *)t__2e138 = (u64)((u64)0UL);
+	BLIT((u64)B42, t_object_2e133, 8);
+	BLIT((u64)B43, ((u64)((char *)&D_strliteral_2e136)), 24);
+	BLIT((u64)B44, t_object_2e137, 24);
+	t__2e132 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R45, (u64)B42, (u64)B43, (u64)B44);
+	t_tag_2e139 = (u64)(*(u32 *)t__2e132);
+	t__2e147 = (u64)(u32)(((u32)t_tag_2e139 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e147) goto L_member_2e144; else goto L__2e146;
+	L__2e146:;
+	t__2e149 = (u64)(u32)(((u32)t_tag_2e139 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e149) goto L_member_2e145; else goto L__2e148;
+	L__2e148:;
+	goto L_matches_2e143;
+	L_member_2e144:;
+	goto L_matches_2e143;
+	L_member_2e145:;
+	goto L_matches_2e142;
+	L_matches_2e142:;
+	goto L__2e140;
+	L_matches_2e143:;
+	t_abortsite_2e37 = ((u64)10UL);
+	goto L_abort_2e38;
+	L__2e150:;
+	L__2e141:;
+	t_abortsite_2e37 = ((u64)11UL);
+	goto L_abort_2e45;
+	L__2e140:;
+	*(u32 *)t_object_2e153 = (u32)((u64)3532310079UL);
+	t__2e154 = (u64)((u64)t_object_2e153 + (u64)((u64)4UL));
+	*(u32 *)t__2e154 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e157 = (u64)((u64)0UL);
+	t__2e158 = (u64)((u64)t_object_2e157 + (u64)((u64)8UL));
+	*(u64 *)t__2e158 = (u64)((u64)0UL);
+	t__2e158 = (u64)((u64)t__2e158 + (u64)((u64)8UL));
+	*(u64 *)t__2e158 = (u64)((u64)0UL);
+	BLIT((u64)B46, t_object_2e153, 8);
+	BLIT((u64)B47, ((u64)((char *)&D_strliteral_2e156)), 24);
+	BLIT((u64)B48, t_object_2e157, 24);
+	t__2e152 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R49, (u64)B46, (u64)B47, (u64)B48);
+	t_tag_2e159 = (u64)(*(u32 *)t__2e152);
+	t__2e167 = (u64)(u32)(((u32)t_tag_2e159 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e167) goto L_member_2e164; else goto L__2e166;
+	L__2e166:;
+	t__2e169 = (u64)(u32)(((u32)t_tag_2e159 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e169) goto L_member_2e165; else goto L__2e168;
+	L__2e168:;
+	goto L_matches_2e163;
+	L_member_2e164:;
+	goto L_matches_2e163;
+	L_member_2e165:;
+	goto L_matches_2e162;
+	L_matches_2e162:;
+	goto L__2e160;
+	L_matches_2e163:;
+	t_abortsite_2e37 = ((u64)12UL);
+	goto L_abort_2e38;
+	L__2e170:;
+	L__2e161:;
+	t_abortsite_2e37 = ((u64)13UL);
+	goto L_abort_2e45;
+	L__2e160:;
+	*(u32 *)t_object_2e173 = (u32)((u64)3532310079UL);
+	t__2e174 = (u64)((u64)t_object_2e173 + (u64)((u64)4UL));
+	*(u32 *)t__2e174 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e177 = (u64)((u64)0UL);
+	t__2e178 = (u64)((u64)t_object_2e177 + (u64)((u64)8UL));
+	*(u64 *)t__2e178 = (u64)((u64)0UL);
+	t__2e178 = (u64)((u64)t__2e178 + (u64)((u64)8UL));
+	*(u64 *)t__2e178 = (u64)((u64)0UL);
+	BLIT((u64)B50, t_object_2e173, 8);
+	BLIT((u64)B51, ((u64)((char *)&D_strliteral_2e176)), 24);
+	BLIT((u64)B52, t_object_2e177, 24);
+	t__2e172 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R53, (u64)B50, (u64)B51, (u64)B52);
+	t_tag_2e179 = (u64)(*(u32 *)t__2e172);
+	t__2e187 = (u64)(u32)(((u32)t_tag_2e179 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e187) goto L_member_2e184; else goto L__2e186;
+	L__2e186:;
+	t__2e189 = (u64)(u32)(((u32)t_tag_2e179 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e189) goto L_member_2e185; else goto L__2e188;
+	L__2e188:;
+	goto L_matches_2e183;
+	L_member_2e184:;
+	goto L_matches_2e183;
+	L_member_2e185:;
+	goto L_matches_2e182;
+	L_matches_2e182:;
+	goto L__2e180;
+	L_matches_2e183:;
+	t_abortsite_2e37 = ((u64)14UL);
+	goto L_abort_2e38;
+	L__2e190:;
+	L__2e181:;
+	t_abortsite_2e37 = ((u64)15UL);
+	goto L_abort_2e45;
+	L__2e180:;
+	*(u32 *)t_object_2e193 = (u32)((u64)3532310079UL);
+	t__2e194 = (u64)((u64)t_object_2e193 + (u64)((u64)4UL));
+	*(u32 *)t__2e194 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e197 = (u64)((u64)0UL);
+	t__2e198 = (u64)((u64)t_object_2e197 + (u64)((u64)8UL));
+	*(u64 *)t__2e198 = (u64)((u64)0UL);
+	t__2e198 = (u64)((u64)t__2e198 + (u64)((u64)8UL));
+	*(u64 *)t__2e198 = (u64)((u64)0UL);
+	BLIT((u64)B54, t_object_2e193, 8);
+	BLIT((u64)B55, ((u64)((char *)&D_strliteral_2e196)), 24);
+	BLIT((u64)B56, t_object_2e197, 24);
+	t__2e192 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R57, (u64)B54, (u64)B55, (u64)B56);
+	t_tag_2e199 = (u64)(*(u32 *)t__2e192);
+	t__2e207 = (u64)(u32)(((u32)t_tag_2e199 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e207) goto L_member_2e204; else goto L__2e206;
+	L__2e206:;
+	t__2e209 = (u64)(u32)(((u32)t_tag_2e199 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e209) goto L_member_2e205; else goto L__2e208;
+	L__2e208:;
+	goto L_matches_2e203;
+	L_member_2e204:;
+	goto L_matches_2e203;
+	L_member_2e205:;
+	goto L_matches_2e202;
+	L_matches_2e202:;
+	goto L__2e200;
+	L_matches_2e203:;
+	t_abortsite_2e37 = ((u64)16UL);
+	goto L_abort_2e38;
+	L__2e210:;
+	L__2e201:;
+	t_abortsite_2e37 = ((u64)17UL);
+	goto L_abort_2e45;
+	L__2e200:;
+	*(u32 *)t_object_2e213 = (u32)((u64)3532310079UL);
+	t__2e214 = (u64)((u64)t_object_2e213 + (u64)((u64)4UL));
+	*(u32 *)t__2e214 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e217 = (u64)((u64)0UL);
+	t__2e218 = (u64)((u64)t_object_2e217 + (u64)((u64)8UL));
+	*(u64 *)t__2e218 = (u64)((u64)0UL);
+	t__2e218 = (u64)((u64)t__2e218 + (u64)((u64)8UL));
+	*(u64 *)t__2e218 = (u64)((u64)0UL);
+	BLIT((u64)B58, t_object_2e213, 8);
+	BLIT((u64)B59, ((u64)((char *)&D_strliteral_2e216)), 24);
+	BLIT((u64)B60, t_object_2e217, 24);
+	t__2e212 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R61, (u64)B58, (u64)B59, (u64)B60);
+	t_tag_2e219 = (u64)(*(u32 *)t__2e212);
+	t__2e227 = (u64)(u32)(((u32)t_tag_2e219 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e227) goto L_member_2e224; else goto L__2e226;
+	L__2e226:;
+	t__2e229 = (u64)(u32)(((u32)t_tag_2e219 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e229) goto L_member_2e225; else goto L__2e228;
+	L__2e228:;
+	goto L_matches_2e223;
+	L_member_2e224:;
+	goto L_matches_2e223;
+	L_member_2e225:;
+	goto L_matches_2e222;
+	L_matches_2e222:;
+	goto L__2e220;
+	L_matches_2e223:;
+	t_abortsite_2e37 = ((u64)18UL);
+	goto L_abort_2e38;
+	L__2e230:;
+	L__2e221:;
+	t_abortsite_2e37 = ((u64)19UL);
+	goto L_abort_2e45;
+	L__2e220:;
+	*(u32 *)t_object_2e233 = (u32)((u64)3532310079UL);
+	t__2e234 = (u64)((u64)t_object_2e233 + (u64)((u64)4UL));
+	*(u32 *)t__2e234 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e237 = (u64)((u64)0UL);
+	t__2e238 = (u64)((u64)t_object_2e237 + (u64)((u64)8UL));
+	*(u64 *)t__2e238 = (u64)((u64)0UL);
+	t__2e238 = (u64)((u64)t__2e238 + (u64)((u64)8UL));
+	*(u64 *)t__2e238 = (u64)((u64)0UL);
+	BLIT((u64)B62, t_object_2e233, 8);
+	BLIT((u64)B63, ((u64)((char *)&D_strliteral_2e236)), 24);
+	BLIT((u64)B64, t_object_2e237, 24);
+	t__2e232 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R65, (u64)B62, (u64)B63, (u64)B64);
+	t_tag_2e239 = (u64)(*(u32 *)t__2e232);
+	t__2e247 = (u64)(u32)(((u32)t_tag_2e239 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e247) goto L_member_2e244; else goto L__2e246;
+	L__2e246:;
+	t__2e249 = (u64)(u32)(((u32)t_tag_2e239 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e249) goto L_member_2e245; else goto L__2e248;
+	L__2e248:;
+	goto L_matches_2e243;
+	L_member_2e244:;
+	goto L_matches_2e243;
+	L_member_2e245:;
+	goto L_matches_2e242;
+	L_matches_2e242:;
+	goto L__2e240;
+	L_matches_2e243:;
+	t_abortsite_2e37 = ((u64)20UL);
+	goto L_abort_2e38;
+	L__2e250:;
+	L__2e241:;
+	t_abortsite_2e37 = ((u64)21UL);
+	goto L_abort_2e45;
+	L__2e240:;
+	goto L__2e9;
+	L__2e251:;
+	L__2e9:;
+	return;
+	L_abort_2e38:;
+	t__2e39 = (u64)((u64)t_abortsite_2e37 * (u64)((u64)16UL));
+	t__2e39 = (u64)((u64)((u64)((char *)&D_abortsites_2e36)) + (u64)t__2e39);
+	t__2e40 = (u64)(*(u64 *)t__2e39);
+	t__2e41 = (u64)((u64)t__2e39 + (u64)((u64)8UL));
+	t__2e42 = (u64)(*(u32 *)t__2e41);
+	t__2e41 = (u64)((u64)t__2e39 + (u64)((u64)12UL));
+	t__2e43 = (u64)(*(u32 *)t__2e41);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e40, (u64)t__2e42, (u64)t__2e43, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e45:;
+	t__2e46 = (u64)((u64)t_abortsite_2e37 * (u64)((u64)16UL));
+	t__2e46 = (u64)((u64)((u64)((char *)&D_abortsites_2e36)) + (u64)t__2e46);
+	t__2e47 = (u64)(*(u64 *)t__2e46);
+	t__2e48 = (u64)((u64)t__2e46 + (u64)((u64)8UL));
+	t__2e49 = (u64)(*(u32 *)t__2e48);
+	t__2e48 = (u64)((u64)t__2e46 + (u64)((u64)12UL));
+	t__2e50 = (u64)(*(u32 *)t__2e48);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e47, (u64)t__2e49, (u64)t__2e50, (u64)((u64)4UL));
+	__builtin_trap();
+}
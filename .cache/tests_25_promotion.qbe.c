@@ -0,0 +1,124 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[21]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e14 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e14 D_abortsites_2e14 __asm__("abortsites.14") __attribute__((used, section(".data.rel.ro.abortsites.14"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\062\065\055\160\162\157\155\157\164\151\157\156\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 21U, 21U };
+static struct S_abortsites_2e14 D_abortsites_2e14 = { (char *)((char *)&D_strliteral_2e1) + 0, 2U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 3U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 4U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 5U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 6U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 7U, 15U };
+void F_main(void) {
+	u64 t__2e10;
+	u64 t__2e11;
+	u64 t__2e12;
+	u64 t__2e13;
+	u64 t__2e17;
+	u64 t__2e18;
+	u64 t__2e19;
+	u64 t__2e20;
+	u64 t__2e21;
+	u64 t__2e24;
+	u64 t__2e25;
+	u64 t__2e26;
+	u64 t__2e27;
+	u64 t__2e28;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t__2e33;
+	u64 t__2e36;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e46;
+	u64 t__2e47;
+	u64 t__2e48;
+	u64 t__2e8;
+	u64 t__2e9;
+	u64 t_abortsite_2e15;
+	L_start_2e2:;
+	L_body_2e3:;
+	t__2e10 = (u64)(u32)((u8)((u64)255UL));
+	t__2e11 = (u64)(u32)((u16)((u64)8UL));
+	t__2e9 = (u64)(u32)((u32)t__2e10 << (t__2e11 & 31));
+	t__2e12 = (u64)(u32)((u16)t__2e9);
+	t__2e13 = (u64)(u32)((u16)((u64)65280UL));
+	t__2e8 = (u64)(u32)(((u32)t__2e12 == (u32)t__2e13));
+	if ((u32)t__2e8) goto L_passed_2e7; else goto L_failed_2e6;
+	L_failed_2e6:;
+	t_abortsite_2e15 = ((u64)0UL);
+	goto L_abort_2e16;
+	L_passed_2e7:;
+	t__2e26 = (u64)(u32)((u8)((u64)8UL));
+	t__2e25 = (u64)(u32)((u32)((u64)255UL) << (t__2e26 & 31));
+	t__2e27 = (u64)(u32)((u8)t__2e25);
+	t__2e28 = (u64)(u32)((u8)((u64)0UL));
+	t__2e24 = (u64)(u32)(((u32)t__2e27 == (u32)t__2e28));
+	if ((u32)t__2e24) goto L_passed_2e23; else goto L_failed_2e22;
+	L_failed_2e22:;
+	t_abortsite_2e15 = ((u64)1UL);
+	goto L_abort_2e16;
+	L_passed_2e23:;
+	t__2e33 = (u64)(u32)((u8)((u64)255UL));
+	t__2e32 = (u64)(u32)((u32)t__2e33 << (((u64)24UL) & 31));
+	t__2e31 = (u64)(u32)(((u32)t__2e32 == (u32)((u64)4278190080UL)));
+	if ((u32)t__2e31) goto L_passed_2e30; else goto L_failed_2e29;
+	L_failed_2e29:;
+	t_abortsite_2e15 = ((u64)2UL);
+	goto L_abort_2e16;
+	L_passed_2e30:;
+	t__2e38 = (u64)(u32)((u8)((u64)255UL));
+	t__2e37 = (u64)(u32)((u32)t__2e38 << (((u64)32UL) & 31));
+	t__2e36 = (u64)(u32)(((u32)t__2e37 == (u32)((u64)255UL)));
+	if ((u32)t__2e36) goto L_passed_2e35; else goto L_failed_2e34;
+	L_failed_2e34:;
+	t_abortsite_2e15 = ((u64)3UL);
+	goto L_abort_2e16;
+	L_passed_2e35:;
+	t__2e43 = (u64)((u8)((u64)255UL));
+	t__2e42 = (u64)((u64)t__2e43 << (((u64)32UL) & 63));
+	t__2e41 = (u64)(u32)(((u64)t__2e42 == (u64)((u64)1095216660480UL)));
+	if ((u32)t__2e41) goto L_passed_2e40; else goto L_failed_2e39;
+	L_failed_2e39:;
+	t_abortsite_2e15 = ((u64)4UL);
+	goto L_abort_2e16;
+	L_passed_2e40:;
+	t__2e48 = (u64)((u8)((u64)255UL));
+	t__2e47 = (u64)((u64)t__2e48 << (((u64)64UL) & 63));
+	t__2e46 = (u64)(u32)(((u64)t__2e47 == (u64)((u64)255UL)));
+	if ((u32)t__2e46) goto L_passed_2e45; else goto L_failed_2e44;
+	L_failed_2e44:;
+	t_abortsite_2e15 = ((u64)5UL);
+	goto L_abort_2e16;
+	L_passed_2e45:;
+	goto L__2e4;
+	L__2e49:;
+	L__2e4:;
+	return;
+	L_abort_2e16:;
+	t__2e17 = (u64)((u64)t_abortsite_2e15 * (u64)((u64)16UL));
+	t__2e17 = (u64)((u64)((u64)((char *)&D_abortsites_2e14)) + (u64)t__2e17);
+	t__2e18 = (u64)(*(u64 *)t__2e17);
+	t__2e19 = (u64)((u64)t__2e17 + (u64)((u64)8UL));
+	t__2e20 = (u64)(*(u32 *)t__2e19);
+	t__2e19 = (u64)((u64)t__2e17 + (u64)((u64)12UL));
+	t__2e21 = (u64)(*(u32 *)t__2e19);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e18, (u64)t__2e20, (u64)t__2e21, (u64)((u64)6UL));
+	__builtin_trap();
+}
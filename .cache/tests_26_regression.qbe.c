@@ -0,0 +1,2543 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+extern char X_rt_2ememmove[] __asm__("rt.memmove");
+extern char X_rt_2etoutf8[] __asm__("rt.toutf8");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e200 { u8 f0; u8 f1; u8 f2; u8 f3[26]; u8 f4; u8 f5; u8 f6; u8 f7[16]; u8 f8; u8 f9; u8 f10; u8 f11[2]; };
+struct __attribute__((packed)) S_strliteral_2e201 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e228 { u8 f0[6]; };
+struct __attribute__((packed)) S_strliteral_2e229 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e248 { u8 f0; u8 f1; u8 f2; u8 f3[17]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[7]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[7]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; u8 f20; u8 f21[23]; };
+struct __attribute__((packed)) S_strliteral_2e249 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e268 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e269 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e288 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e289 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e308 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e309 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e328 { u8 f0; u8 f1; u8 f2; u8 f3[13]; u8 f4; u8 f5; u8 f6; u8 f7[22]; u8 f8; u8 f9; u8 f10; u8 f11[20]; };
+struct __attribute__((packed)) S_strliteral_2e329 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e348 { u8 f0; u8 f1; u8 f2; u8 f3[10]; u8 f4; u8 f5; u8 f6; u8 f7[20]; };
+struct __attribute__((packed)) S_strliteral_2e349 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e368 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e369 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e388 { u8 f0[33]; };
+struct __attribute__((packed)) S_strliteral_2e389 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e408 { u8 f0[36]; };
+struct __attribute__((packed)) S_strliteral_2e409 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e428 { u8 f0[35]; };
+struct __attribute__((packed)) S_strliteral_2e429 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e448 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e449 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e468 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e469 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e488 { u8 f0[29]; };
+struct __attribute__((packed)) S_strliteral_2e489 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e508 { u8 f0[60]; };
+struct __attribute__((packed)) S_strliteral_2e509 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e545 { u8 f0[31]; };
+struct __attribute__((packed)) S_strliteral_2e546 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e565 { u8 f0[24]; };
+struct __attribute__((packed)) S_strliteral_2e566 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e585 { u8 f0[32]; };
+struct __attribute__((packed)) S_strliteral_2e586 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e630 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e631 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e658 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e659 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e681 { u8 f0[5]; };
+struct __attribute__((packed)) S_strliteral_2e682 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e779 { u8 f0[40]; };
+struct __attribute__((packed)) S_strliteral_2e780 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e799 { u8 f0[39]; };
+struct __attribute__((packed)) S_strliteral_2e800 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e878 { u8 f0[31]; };
+struct __attribute__((packed)) S_strliteral_2e879 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e18 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; char *f78; u32 f79; u32 f80; char *f81; u32 f82; u32 f83; char *f84; u32 f85; u32 f86; char *f87; u32 f88; u32 f89; char *f90; u32 f91; u32 f92; char *f93; u32 f94; u32 f95; char *f96; u32 f97; u32 f98; char *f99; u32 f100; u32 f101; char *f102; u32 f103; u32 f104; char *f105; u32 f106; u32 f107; char *f108; u32 f109; u32 f110; char *f111; u32 f112; u32 f113; char *f114; u32 f115; u32 f116; char *f117; u32 f118; u32 f119; char *f120; u32 f121; u32 f122; char *f123; u32 f124; u32 f125; char *f126; u32 f127; u32 f128; char *f129; u32 f130; u32 f131; char *f132; u32 f133; u32 f134; char *f135; u32 f136; u32 f137; char *f138; u32 f139; u32 f140; char *f141; u32 f142; u32 f143; char *f144; u32 f145; u32 f146; char *f147; u32 f148; u32 f149; char *f150; u32 f151; u32 f152; char *f153; u32 f154; u32 f155; char *f156; u32 f157; u32 f158; char *f159; u32 f160; u32 f161; char *f162; u32 f163; u32 f164; char *f165; u32 f166; u32 f167; char *f168; u32 f169; u32 f170; char *f171; u32 f172; u32 f173; char *f174; u32 f175; u32 f176; char *f177; u32 f178; u32 f179; char *f180; u32 f181; u32 f182; char *f183; u32 f184; u32 f185; char *f186; u32 f187; u32 f188; char *f189; u32 f190; u32 f191; char *f192; u32 f193; u32 f194; char *f195; u32 f196; u32 f197; char *f198; u32 f199; u32 f200; char *f201; u32 f202; u32 f203; char *f204; u32 f205; u32 f206; char *f207; u32 f208; u32 f209; char *f210; u32 f211; u32 f212; char *f213; u32 f214; u32 f215; char *f216; u32 f217; u32 f218; char *f219; u32 f220; u32 f221; char *f222; u32 f223; u32 f224; };
+struct __attribute__((packed)) S_packedsz { u64 f0; };
+struct __attribute__((packed)) S_abortsites_2e907 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e200 D_strdata_2e200 __asm__("strdata.200") __attribute__((used, section(".rodata.strdata.200"), aligned(8)));
+static struct S_strliteral_2e201 D_strliteral_2e201 __asm__("strliteral.201") __attribute__((used, section(".data.rel.ro.strliteral.201"), aligned(8)));
+static const struct S_strdata_2e228 D_strdata_2e228 __asm__("strdata.228") __attribute__((used, section(".rodata.strdata.228"), aligned(8)));
+static struct S_strliteral_2e229 D_strliteral_2e229 __asm__("strliteral.229") __attribute__((used, section(".data.rel.ro.strliteral.229"), aligned(8)));
+static const struct S_strdata_2e248 D_strdata_2e248 __asm__("strdata.248") __attribute__((used, section(".rodata.strdata.248"), aligned(8)));
+static struct S_strliteral_2e249 D_strliteral_2e249 __asm__("strliteral.249") __attribute__((used, section(".data.rel.ro.strliteral.249"), aligned(8)));
+static const struct S_strdata_2e268 D_strdata_2e268 __asm__("strdata.268") __attribute__((used, section(".rodata.strdata.268"), aligned(8)));
+static struct S_strliteral_2e269 D_strliteral_2e269 __asm__("strliteral.269") __attribute__((used, section(".data.rel.ro.strliteral.269"), aligned(8)));
+static const struct S_strdata_2e288 D_strdata_2e288 __asm__("strdata.288") __attribute__((used, section(".rodata.strdata.288"), aligned(8)));
+static struct S_strliteral_2e289 D_strliteral_2e289 __asm__("strliteral.289") __attribute__((used, section(".data.rel.ro.strliteral.289"), aligned(8)));
+static const struct S_strdata_2e308 D_strdata_2e308 __asm__("strdata.308") __attribute__((used, section(".rodata.strdata.308"), aligned(8)));
+static struct S_strliteral_2e309 D_strliteral_2e309 __asm__("strliteral.309") __attribute__((used, section(".data.rel.ro.strliteral.309"), aligned(8)));
+static const struct S_strdata_2e328 D_strdata_2e328 __asm__("strdata.328") __attribute__((used, section(".rodata.strdata.328"), aligned(8)));
+static struct S_strliteral_2e329 D_strliteral_2e329 __asm__("strliteral.329") __attribute__((used, section(".data.rel.ro.strliteral.329"), aligned(8)));
+static const struct S_strdata_2e348 D_strdata_2e348 __asm__("strdata.348") __attribute__((used, section(".rodata.strdata.348"), aligned(8)));
+static struct S_strliteral_2e349 D_strliteral_2e349 __asm__("strliteral.349") __attribute__((used, section(".data.rel.ro.strliteral.349"), aligned(8)));
+static const struct S_strdata_2e368 D_strdata_2e368 __asm__("strdata.368") __attribute__((used, section(".rodata.strdata.368"), aligned(8)));
+static struct S_strliteral_2e369 D_strliteral_2e369 __asm__("strliteral.369") __attribute__((used, section(".data.rel.ro.strliteral.369"), aligned(8)));
+static const struct S_strdata_2e388 D_strdata_2e388 __asm__("strdata.388") __attribute__((used, section(".rodata.strdata.388"), aligned(8)));
+static struct S_strliteral_2e389 D_strliteral_2e389 __asm__("strliteral.389") __attribute__((used, section(".data.rel.ro.strliteral.389"), aligned(8)));
+static const struct S_strdata_2e408 D_strdata_2e408 __asm__("strdata.408") __attribute__((used, section(".rodata.strdata.408"), aligned(8)));
+static struct S_strliteral_2e409 D_strliteral_2e409 __asm__("strliteral.409") __attribute__((used, section(".data.rel.ro.strliteral.409"), aligned(8)));
+static const struct S_strdata_2e428 D_strdata_2e428 __asm__("strdata.428") __attribute__((used, section(".rodata.strdata.428"), aligned(8)));
+static struct S_strliteral_2e429 D_strliteral_2e429 __asm__("strliteral.429") __attribute__((used, section(".data.rel.ro.strliteral.429"), aligned(8)));
+static const struct S_strdata_2e448 D_strdata_2e448 __asm__("strdata.448") __attribute__((used, section(".rodata.strdata.448"), aligned(8)));
+static struct S_strliteral_2e449 D_strliteral_2e449 __asm__("strliteral.449") __attribute__((used, section(".data.rel.ro.strliteral.449"), aligned(8)));
+static const struct S_strdata_2e468 D_strdata_2e468 __asm__("strdata.468") __attribute__((used, section(".rodata.strdata.468"), aligned(8)));
+static struct S_strliteral_2e469 D_strliteral_2e469 __asm__("strliteral.469") __attribute__((used, section(".data.rel.ro.strliteral.469"), aligned(8)));
+static const struct S_strdata_2e488 D_strdata_2e488 __asm__("strdata.488") __attribute__((used, section(".rodata.strdata.488"), aligned(8)));
+static struct S_strliteral_2e489 D_strliteral_2e489 __asm__("strliteral.489") __attribute__((used, section(".data.rel.ro.strliteral.489"), aligned(8)));
+static const struct S_strdata_2e508 D_strdata_2e508 __asm__("strdata.508") __attribute__((used, section(".rodata.strdata.508"), aligned(8)));
+static struct S_strliteral_2e509 D_strliteral_2e509 __asm__("strliteral.509") __attribute__((used, section(".data.rel.ro.strliteral.509"), aligned(8)));
+static const struct S_strdata_2e545 D_strdata_2e545 __asm__("strdata.545") __attribute__((used, section(".rodata.strdata.545"), aligned(8)));
+static struct S_strliteral_2e546 D_strliteral_2e546 __asm__("strliteral.546") __attribute__((used, section(".data.rel.ro.strliteral.546"), aligned(8)));
+static const struct S_strdata_2e565 D_strdata_2e565 __asm__("strdata.565") __attribute__((used, section(".rodata.strdata.565"), aligned(8)));
+static struct S_strliteral_2e566 D_strliteral_2e566 __asm__("strliteral.566") __attribute__((used, section(".data.rel.ro.strliteral.566"), aligned(8)));
+static const struct S_strdata_2e585 D_strdata_2e585 __asm__("strdata.585") __attribute__((used, section(".rodata.strdata.585"), aligned(8)));
+static struct S_strliteral_2e586 D_strliteral_2e586 __asm__("strliteral.586") __attribute__((used, section(".data.rel.ro.strliteral.586"), aligned(8)));
+static const struct S_strdata_2e630 D_strdata_2e630 __asm__("strdata.630") __attribute__((used, section(".rodata.strdata.630"), aligned(8)));
+static struct S_strliteral_2e631 D_strliteral_2e631 __asm__("strliteral.631") __attribute__((used, section(".data.rel.ro.strliteral.631"), aligned(8)));
+static const struct S_strdata_2e658 D_strdata_2e658 __asm__("strdata.658") __attribute__((used, section(".rodata.strdata.658"), aligned(8)));
+static struct S_strliteral_2e659 D_strliteral_2e659 __asm__("strliteral.659") __attribute__((used, section(".data.rel.ro.strliteral.659"), aligned(8)));
+static const struct S_strdata_2e681 D_strdata_2e681 __asm__("strdata.681") __attribute__((used, section(".rodata.strdata.681"), aligned(8)));
+static struct S_strliteral_2e682 D_strliteral_2e682 __asm__("strliteral.682") __attribute__((used, section(".data.rel.ro.strliteral.682"), aligned(8)));
+static const struct S_strdata_2e779 D_strdata_2e779 __asm__("strdata.779") __attribute__((used, section(".rodata.strdata.779"), aligned(8)));
+static struct S_strliteral_2e780 D_strliteral_2e780 __asm__("strliteral.780") __attribute__((used, section(".data.rel.ro.strliteral.780"), aligned(8)));
+static const struct S_strdata_2e799 D_strdata_2e799 __asm__("strdata.799") __attribute__((used, section(".rodata.strdata.799"), aligned(8)));
+static struct S_strliteral_2e800 D_strliteral_2e800 __asm__("strliteral.800") __attribute__((used, section(".data.rel.ro.strliteral.800"), aligned(8)));
+static const struct S_strdata_2e878 D_strdata_2e878 __asm__("strdata.878") __attribute__((used, section(".rodata.strdata.878"), aligned(8)));
+static struct S_strliteral_2e879 D_strliteral_2e879 __asm__("strliteral.879") __attribute__((used, section(".data.rel.ro.strliteral.879"), aligned(8)));
+static struct S_abortsites_2e18 D_abortsites_2e18 __asm__("abortsites.18") __attribute__((used, section(".data.rel.ro.abortsites.18"), aligned(8)));
+static struct S_packedsz D_packedsz __asm__("packedsz") __attribute__((used, section(".data.packedsz"), aligned(8)));
+static struct S_abortsites_2e907 D_abortsites_2e907 __asm__("abortsites.907") __attribute__((used, section(".data.rel.ro.abortsites.907"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_control__never(void) __asm__("control_never") __attribute__((used, section(".text.control_never")));
+static u64 F_control__never2(u64 __rp) __asm__("control_never2") __attribute__((used, section(".text.control_never2")));
+static u64 F_control__never1(u64 __rp) __asm__("control_never1") __attribute__((used, section(".text.control_never1")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\062\066\055\162\145\147\162\145\163\163\151\157\156\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 22U, 22U };
+static const struct S_strdata_2e200 D_strdata_2e200 = { 10U, 9U, 9U, "\146\156\040\141\050\051\040\166\157\151\144\040\075\040\163\167\151\164\143\150\040\050\142\051\040\173", 10U, 9U, 9U, "\143\141\163\145\040\046\143\040\075\076\040\166\157\151\144\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e201 D_strliteral_2e201 = { (char *)((char *)&D_strdata_2e200) + 0, 53U, 53U };
+static const struct S_strdata_2e228 D_strdata_2e228 = { "\154\145\164\040\141\073" };
+static struct S_strliteral_2e229 D_strliteral_2e229 = { (char *)((char *)&D_strdata_2e228) + 0, 6U, 6U };
+static const struct S_strdata_2e248 D_strdata_2e248 = { 10U, 9U, 9U, "\164\171\160\145\040\141\040\075\040\163\164\162\165\143\164\040\173", 10U, 9U, 9U, 9U, "\142\072\040\151\156\164\054", 10U, 9U, 9U, 9U, "\143\072\040\151\156\164\054", 10U, 9U, 9U, "\175\073", 10U, 9U, 9U, "\144\145\146\040\101\072\040\141\040\075\040\141\040\173\040\142\040\075\040\060\040\175\073" };
+static struct S_strliteral_2e249 D_strliteral_2e249 = { (char *)((char *)&D_strdata_2e248) + 0, 73U, 73U };
+static const struct S_strdata_2e268 D_strdata_2e268 = { "\154\145\164\040\141\040\075\040\046\060\073" };
+static struct S_strliteral_2e269 D_strliteral_2e269 = { (char *)((char *)&D_strdata_2e268) + 0, 11U, 11U };
+static const struct S_strdata_2e288 D_strdata_2e288 = { "\144\145\146\040\101\072\040\141\040\075\040\061\040\045\040\061\073" };
+static struct S_strliteral_2e289 D_strliteral_2e289 = { (char *)((char *)&D_strdata_2e288) + 0, 17U, 17U };
+static const struct S_strdata_2e308 D_strdata_2e308 = { "\144\145\146\040\101\072\040\142\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e309 D_strliteral_2e309 = { (char *)((char *)&D_strdata_2e308) + 0, 16U, 16U };
+static const struct S_strdata_2e328 D_strdata_2e328 = { 10U, 9U, 9U, "\164\171\160\145\040\141\040\075\040\163\164\162\073", 10U, 9U, 9U, "\164\171\160\145\040\142\040\075\040\163\164\162\165\143\164\040\173\040\141\040\175\073", 10U, 9U, 9U, "\144\145\146\040\101\040\075\040\142\040\173\040\143\040\075\040\060\040\175\073" };
+static struct S_strliteral_2e329 D_strliteral_2e329 = { (char *)((char *)&D_strdata_2e328) + 0, 64U, 64U };
+static const struct S_strdata_2e348 D_strdata_2e348 = { 10U, 9U, 9U, "\144\145\146\040\101\040\075\040\060\073", 10U, 9U, 9U, "\146\156\040\141\050\051\040\166\157\151\144\040\075\040\101\040\075\040\060\073" };
+static struct S_strliteral_2e349 D_strliteral_2e349 = { (char *)((char *)&D_strdata_2e348) + 0, 36U, 36U };
+static const struct S_strdata_2e368 D_strdata_2e368 = { "\144\145\146\040\101\040\075\040\170\040\046\046\040\164\162\165\145\073" };
+static struct S_strliteral_2e369 D_strliteral_2e369 = { (char *)((char *)&D_strdata_2e368) + 0, 18U, 18U };
+static const struct S_strdata_2e388 D_strdata_2e388 = { "\164\171\160\145\040\141\040\075\040\163\164\162\165\143\164\040\173\040\142\072\040\146\156\050\051\040\166\157\151\144\040\175\073" };
+static struct S_strliteral_2e389 D_strliteral_2e389 = { (char *)((char *)&D_strdata_2e388) + 0, 33U, 33U };
+static const struct S_strdata_2e408 D_strdata_2e408 = { "\146\156\040\141\050\051\040\133\135\151\156\164\040\075\040\141\154\154\157\143\050\133\135\072\040\133\052\135\151\156\164\054\040\060\051\073" };
+static struct S_strliteral_2e409 D_strliteral_2e409 = { (char *)((char *)&D_strdata_2e408) + 0, 36U, 36U };
+static const struct S_strdata_2e428 D_strdata_2e428 = { "\146\156\040\141\050\051\040\133\061\135\151\156\164\040\075\040\133\061\135\072\040\133\135\151\156\164\072\040\133\061\135\151\156\164\073" };
+static struct S_strliteral_2e429 D_strliteral_2e429 = { (char *)((char *)&D_strdata_2e428) + 0, 35U, 35U };
+static const struct S_strdata_2e448 D_strdata_2e448 = { "\146\156\040\141\050\051\040\166\157\151\144\040\075\040\046\052\046\141\073" };
+static struct S_strliteral_2e449 D_strliteral_2e449 = { (char *)((char *)&D_strdata_2e448) + 0, 19U, 19U };
+static const struct S_strdata_2e468 D_strdata_2e468 = { "\154\145\164\040\141\040\075\040\133\052\046\060\135\073" };
+static struct S_strliteral_2e469 D_strliteral_2e469 = { (char *)((char *)&D_strdata_2e468) + 0, 14U, 14U };
+static const struct S_strdata_2e488 D_strdata_2e488 = { "\146\156\040\141\050\051\040\052\157\160\141\161\165\145\040\075\040\141\154\154\157\143\050\166\157\151\144\051\073" };
+static struct S_strliteral_2e489 D_strliteral_2e489 = { (char *)((char *)&D_strdata_2e488) + 0, 29U, 29U };
+static const struct S_strdata_2e508 D_strdata_2e508 = { "\146\156\040\141\050\051\040\166\157\151\144\040\075\040\173\040\163\164\141\164\151\143\040\154\145\164\040\142\040\075\040\170\040\046\040\163\164\162\165\143\164\040\173\040\141\072\040\151\156\164\040\075\040\060\040\175\073\040\175\073" };
+static struct S_strliteral_2e509 D_strliteral_2e509 = { (char *)((char *)&D_strdata_2e508) + 0, 60U, 60U };
+static const struct S_strdata_2e545 D_strdata_2e545 = { "\164\171\160\145\040\141\040\075\040\052\056\056\056\142\073\040\164\171\160\145\040\142\040\075\040\052\056\056\056\141\073" };
+static struct S_strliteral_2e546 D_strliteral_2e546 = { (char *)((char *)&D_strdata_2e545) + 0, 31U, 31U };
+static const struct S_strdata_2e565 D_strdata_2e565 = { "\144\145\146\040\101\040\075\040\154\145\156\050\133\061\135\072\040\133\135\163\164\162\051\073" };
+static struct S_strliteral_2e566 D_strliteral_2e566 = { (char *)((char *)&D_strdata_2e565) + 0, 24U, 24U };
+static const struct S_strdata_2e585 D_strdata_2e585 = { "\146\156\040\141\050\051\040\166\157\151\144\040\075\040\173\040\141\142\157\162\164\050\051\072\040\151\156\164\073\040\175\073" };
+static struct S_strliteral_2e586 D_strliteral_2e586 = { (char *)((char *)&D_strdata_2e585) + 0, 32U, 32U };
+static const struct S_strdata_2e630 D_strdata_2e630 = { "\154\145\164\040\141" };
+static struct S_strliteral_2e631 D_strliteral_2e631 = { (char *)((char *)&D_strdata_2e630) + 0, 5U, 5U };
+static const struct S_strdata_2e658 D_strdata_2e658 = { "\072\072\141" };
+static struct S_strliteral_2e659 D_strliteral_2e659 = { (char *)((char *)&D_strdata_2e658) + 0, 3U, 3U };
+static const struct S_strdata_2e681 D_strdata_2e681 = { "\040\075\040\060\073" };
+static struct S_strliteral_2e682 D_strliteral_2e682 = { (char *)((char *)&D_strdata_2e681) + 0, 5U, 5U };
+static const struct S_strdata_2e779 D_strdata_2e779 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\040\075\040\060\073\040\170\040\173\040\056\056\056\040\175\073\040\175\073" };
+static struct S_strliteral_2e780 D_strliteral_2e780 = { (char *)((char *)&D_strdata_2e779) + 0, 40U, 40U };
+static const struct S_strdata_2e799 D_strdata_2e799 = { "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\163\151\172\145\050\142\051\040\075\075\040\060\051\073\040\154\145\164\040\142\040\075\040\060\073" };
+static struct S_strliteral_2e800 D_strliteral_2e800 = { (char *)((char *)&D_strdata_2e799) + 0, 39U, 39U };
+static const struct S_strdata_2e878 D_strdata_2e878 = { "\146\156\040\141\050\051\040\166\157\151\144\040\075\040\173\040\157\146\146\163\145\164\050\141\056\142\051\073\040\175\073" };
+static struct S_strliteral_2e879 D_strliteral_2e879 = { (char *)((char *)&D_strdata_2e878) + 0, 31U, 31U };
+static struct S_abortsites_2e18 D_abortsites_2e18 = { (char *)((char *)&D_strliteral_2e1) + 0, 107U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 113U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 118U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 120U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 127U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 125U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 131U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 137U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 135U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 145U, 28U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 155U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 155U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 157U, 42U, (char *)((char *)&D_strliteral_2e1) + 0, 157U, 42U, (char *)((char *)&D_strliteral_2e1) + 0, 164U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 164U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 165U, 47U, (char *)((char *)&D_strliteral_2e1) + 0, 165U, 47U, (char *)((char *)&D_strliteral_2e1) + 0, 166U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 166U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 167U, 52U, (char *)((char *)&D_strliteral_2e1) + 0, 167U, 52U, (char *)((char *)&D_strliteral_2e1) + 0, 173U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 173U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 177U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 177U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 178U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 178U, 54U, (char *)((char *)&D_strliteral_2e1) + 0, 179U, 69U, (char *)((char *)&D_strliteral_2e1) + 0, 179U, 69U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 72U, (char *)((char *)&D_strliteral_2e1) + 0, 180U, 72U, (char *)((char *)&D_strliteral_2e1) + 0, 181U, 71U, (char *)((char *)&D_strliteral_2e1) + 0, 181U, 71U, (char *)((char *)&D_strliteral_2e1) + 0, 182U, 55U, (char *)((char *)&D_strliteral_2e1) + 0, 182U, 55U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 183U, 50U, (char *)((char *)&D_strliteral_2e1) + 0, 184U, 65U, (char *)((char *)&D_strliteral_2e1) + 0, 184U, 65U, (char *)((char *)&D_strliteral_2e1) + 0, 185U, 96U, (char *)((char *)&D_strliteral_2e1) + 0, 185U, 96U, (char *)((char *)&D_strliteral_2e1) + 0, 187U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 188U, 67U, (char *)((char *)&D_strliteral_2e1) + 0, 188U, 67U, (char *)((char *)&D_strliteral_2e1) + 0, 189U, 60U, (char *)((char *)&D_strliteral_2e1) + 0, 189U, 60U, (char *)((char *)&D_strliteral_2e1) + 0, 192U, 68U, (char *)((char *)&D_strliteral_2e1) + 0, 192U, 68U, (char *)((char *)&D_strliteral_2e1) + 0, 196U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 197U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 200U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 203U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 204U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 204U, 49U, (char *)((char *)&D_strliteral_2e1) + 0, 205U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 205U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 206U, 47U, (char *)((char *)&D_strliteral_2e1) + 0, 206U, 47U, (char *)((char *)&D_strliteral_2e1) + 0, 207U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 208U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 218U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 221U, 76U, (char *)((char *)&D_strliteral_2e1) + 0, 221U, 76U, (char *)((char *)&D_strliteral_2e1) + 0, 223U, 75U, (char *)((char *)&D_strliteral_2e1) + 0, 223U, 75U, (char *)((char *)&D_strliteral_2e1) + 0, 225U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 227U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 228U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 230U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 232U, 67U, (char *)((char *)&D_strliteral_2e1) + 0, 232U, 67U };
+static struct S_packedsz D_packedsz = { 9U };
+static struct S_abortsites_2e907 D_abortsites_2e907 = { (char *)((char *)&D_strliteral_2e1) + 0, 44U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 48U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 53U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 61U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 66U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 69U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 74U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 71U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 78U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 81U, 28U, (char *)((char *)&D_strliteral_2e1) + 0, 84U, 28U, (char *)((char *)&D_strliteral_2e1) + 0, 85U, 28U };
+void F_main(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[4] __attribute__((aligned(16)));
+	char A6[4] __attribute__((aligned(16)));
+	char A7[16] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[4] __attribute__((aligned(16)));
+	char A11[16] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[8] __attribute__((aligned(16)));
+	char A14[4] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[24] __attribute__((aligned(16)));
+	char A17[8] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char A20[8] __attribute__((aligned(16)));
+	char A21[24] __attribute__((aligned(16)));
+	char A22[8] __attribute__((aligned(16)));
+	char A23[24] __attribute__((aligned(16)));
+	char A24[8] __attribute__((aligned(16)));
+	char A25[24] __attribute__((aligned(16)));
+	char A26[8] __attribute__((aligned(16)));
+	char A27[24] __attribute__((aligned(16)));
+	char A28[8] __attribute__((aligned(16)));
+	char A29[24] __attribute__((aligned(16)));
+	char A30[8] __attribute__((aligned(16)));
+	char A31[24] __attribute__((aligned(16)));
+	char A32[8] __attribute__((aligned(16)));
+	char A33[24] __attribute__((aligned(16)));
+	char A34[8] __attribute__((aligned(16)));
+	char A35[24] __attribute__((aligned(16)));
+	char A36[8] __attribute__((aligned(16)));
+	char A37[24] __attribute__((aligned(16)));
+	char A38[8] __attribute__((aligned(16)));
+	char A39[24] __attribute__((aligned(16)));
+	char A40[8] __attribute__((aligned(16)));
+	char A41[24] __attribute__((aligned(16)));
+	char A42[8] __attribute__((aligned(16)));
+	char A43[24] __attribute__((aligned(16)));
+	char A44[8] __attribute__((aligned(16)));
+	char A45[24] __attribute__((aligned(16)));
+	char A46[8] __attribute__((aligned(16)));
+	char A47[24] __attribute__((aligned(16)));
+	char A48[8] __attribute__((aligned(16)));
+	char A49[24] __attribute__((aligned(16)));
+	char A50[24] __attribute__((aligned(16)));
+	char A51[8] __attribute__((aligned(16)));
+	char A52[24] __attribute__((aligned(16)));
+	char A53[8] __attribute__((aligned(16)));
+	char A54[24] __attribute__((aligned(16)));
+	char A55[8] __attribute__((aligned(16)));
+	char A56[24] __attribute__((aligned(16)));
+	char A57[1024] __attribute__((aligned(16)));
+	char A58[24] __attribute__((aligned(16)));
+	char A59[8] __attribute__((aligned(16)));
+	char A60[8] __attribute__((aligned(16)));
+	char A61[8] __attribute__((aligned(16)));
+	char A62[24] __attribute__((aligned(16)));
+	char A63[8] __attribute__((aligned(16)));
+	char A64[24] __attribute__((aligned(16)));
+	char A65[4] __attribute__((aligned(16)));
+	char A66[24] __attribute__((aligned(16)));
+	char A67[8] __attribute__((aligned(16)));
+	char A68[24] __attribute__((aligned(16)));
+	char A69[8] __attribute__((aligned(16)));
+	char A70[24] __attribute__((aligned(16)));
+	char A71[8] __attribute__((aligned(16)));
+	char A72[4] __attribute__((aligned(16)));
+	char A73[8] __attribute__((aligned(16)));
+	char A74[8] __attribute__((aligned(16)));
+	char A75[4] __attribute__((aligned(16)));
+	char A76[8] __attribute__((aligned(16)));
+	char A77[4] __attribute__((aligned(16)));
+	char A78[8] __attribute__((aligned(16)));
+	char A79[24] __attribute__((aligned(16)));
+	char B80[8] __attribute__((aligned(16)));
+	char B81[24] __attribute__((aligned(16)));
+	char B82[24] __attribute__((aligned(16)));
+	char R83[4] __attribute__((aligned(16)));
+	char B84[8] __attribute__((aligned(16)));
+	char B85[24] __attribute__((aligned(16)));
+	char B86[24] __attribute__((aligned(16)));
+	char R87[4] __attribute__((aligned(16)));
+	char B88[8] __attribute__((aligned(16)));
+	char B89[24] __attribute__((aligned(16)));
+	char B90[24] __attribute__((aligned(16)));
+	char R91[4] __attribute__((aligned(16)));
+	char B92[8] __attribute__((aligned(16)));
+	char B93[24] __attribute__((aligned(16)));
+	char B94[24] __attribute__((aligned(16)));
+	char R95[4] __attribute__((aligned(16)));
+	char B96[8] __attribute__((aligned(16)));
+	char B97[24] __attribute__((aligned(16)));
+	char B98[24] __attribute__((aligned(16)));
+	char R99[4] __attribute__((aligned(16)));
+	char B100[8] __attribute__((aligned(16)));
+	char B101[24] __attribute__((aligned(16)));
+	char B102[24] __attribute__((aligned(16)));
+	char R103[4] __attribute__((aligned(16)));
+	char B104[8] __attribute__((aligned(16)));
+	char B105[24] __attribute__((aligned(16)));
+	char B106[24] __attribute__((aligned(16)));
+	char R107[4] __attribute__((aligned(16)));
+	char B108[8] __attribute__((aligned(16)));
+	char B109[24] __attribute__((aligned(16)));
+	char B110[24] __attribute__((aligned(16)));
+	char R111[4] __attribute__((aligned(16)));
+	char B112[8] __attribute__((aligned(16)));
+	char B113[24] __attribute__((aligned(16)));
+	char B114[24] __attribute__((aligned(16)));
+	char R115[4] __attribute__((aligned(16)));
+	char B116[8] __attribute__((aligned(16)));
+	char B117[24] __attribute__((aligned(16)));
+	char B118[24] __attribute__((aligned(16)));
+	char R119[4] __attribute__((aligned(16)));
+	char B120[8] __attribute__((aligned(16)));
+	char B121[24] __attribute__((aligned(16)));
+	char B122[24] __attribute__((aligned(16)));
+	char R123[4] __attribute__((aligned(16)));
+	char B124[8] __attribute__((aligned(16)));
+	char B125[24] __attribute__((aligned(16)));
+	char B126[24] __attribute__((aligned(16)));
+	char R127[4] __attribute__((aligned(16)));
+	char B128[8] __attribute__((aligned(16)));
+	char B129[24] __attribute__((aligned(16)));
+	char B130[24] __attribute__((aligned(16)));
+	char R131[4] __attribute__((aligned(16)));
+	char B132[8] __attribute__((aligned(16)));
+	char B133[24] __attribute__((aligned(16)));
+	char B134[24] __attribute__((aligned(16)));
+	char R135[4] __attribute__((aligned(16)));
+	char B136[8] __attribute__((aligned(16)));
+	char B137[24] __attribute__((aligned(16)));
+	char B138[24] __attribute__((aligned(16)));
+	char R139[4] __attribute__((aligned(16)));
+	char B140[8] __attribute__((aligned(16)));
+	char B141[24] __attribute__((aligned(16)));
+	char B142[24] __attribute__((aligned(16)));
+	char R143[4] __attribute__((aligned(16)));
+	char B144[8] __attribute__((aligned(16)));
+	char B145[24] __attribute__((aligned(16)));
+	char B146[24] __attribute__((aligned(16)));
+	char R147[4] __attribute__((aligned(16)));
+	char B148[8] __attribute__((aligned(16)));
+	char B149[24] __attribute__((aligned(16)));
+	char B150[24] __attribute__((aligned(16)));
+	char R151[4] __attribute__((aligned(16)));
+	char B152[8] __attribute__((aligned(16)));
+	char B153[24] __attribute__((aligned(16)));
+	char B154[24] __attribute__((aligned(16)));
+	char R155[4] __attribute__((aligned(16)));
+	char B156[24] __attribute__((aligned(16)));
+	char R157[24] __attribute__((aligned(16)));
+	char B158[24] __attribute__((aligned(16)));
+	char R159[24] __attribute__((aligned(16)));
+	char B160[24] __attribute__((aligned(16)));
+	char R161[24] __attribute__((aligned(16)));
+	char B162[8] __attribute__((aligned(16)));
+	char B163[24] __attribute__((aligned(16)));
+	char B164[24] __attribute__((aligned(16)));
+	char R165[4] __attribute__((aligned(16)));
+	char B166[24] __attribute__((aligned(16)));
+	char R167[24] __attribute__((aligned(16)));
+	char B168[8] __attribute__((aligned(16)));
+	char B169[24] __attribute__((aligned(16)));
+	char B170[24] __attribute__((aligned(16)));
+	char R171[4] __attribute__((aligned(16)));
+	char B172[8] __attribute__((aligned(16)));
+	char B173[24] __attribute__((aligned(16)));
+	char B174[24] __attribute__((aligned(16)));
+	char R175[4] __attribute__((aligned(16)));
+	char B176[8] __attribute__((aligned(16)));
+	char B177[24] __attribute__((aligned(16)));
+	char B178[24] __attribute__((aligned(16)));
+	char R179[4] __attribute__((aligned(16)));
+	char B180[8] __attribute__((aligned(16)));
+	char B181[24] __attribute__((aligned(16)));
+	char B182[24] __attribute__((aligned(16)));
+	char R183[4] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e104;
+	u64 t__2e105;
+	u64 t__2e107;
+	u64 t__2e108;
+	u64 t__2e109;
+	u64 t__2e113;
+	u64 t__2e114;
+	u64 t__2e115;
+	u64 t__2e123;
+	u64 t__2e133;
+	u64 t__2e135;
+	u64 t__2e139;
+	u64 t__2e14;
+	u64 t__2e140;
+	u64 t__2e142;
+	u64 t__2e144;
+	u64 t__2e156;
+	u64 t__2e158;
+	u64 t__2e17;
+	u64 t__2e170;
+	u64 t__2e172;
+	u64 t__2e173;
+	u64 t__2e174;
+	u64 t__2e175;
+	u64 t__2e176;
+	u64 t__2e177;
+	u64 t__2e178;
+	u64 t__2e182;
+	u64 t__2e183;
+	u64 t__2e186;
+	u64 t__2e190;
+	u64 t__2e191;
+	u64 t__2e193;
+	u64 t__2e199;
+	u64 t__2e205;
+	u64 t__2e21;
+	u64 t__2e214;
+	u64 t__2e216;
+	u64 t__2e218;
+	u64 t__2e219;
+	u64 t__2e22;
+	u64 t__2e220;
+	u64 t__2e221;
+	u64 t__2e222;
+	u64 t__2e225;
+	u64 t__2e227;
+	u64 t__2e23;
+	u64 t__2e231;
+	u64 t__2e24;
+	u64 t__2e240;
+	u64 t__2e242;
+	u64 t__2e245;
+	u64 t__2e247;
+	u64 t__2e25;
+	u64 t__2e251;
+	u64 t__2e260;
+	u64 t__2e262;
+	u64 t__2e265;
+	u64 t__2e267;
+	u64 t__2e271;
+	u64 t__2e280;
+	u64 t__2e282;
+	u64 t__2e285;
+	u64 t__2e287;
+	u64 t__2e291;
+	u64 t__2e300;
+	u64 t__2e302;
+	u64 t__2e305;
+	u64 t__2e307;
+	u64 t__2e31;
+	u64 t__2e311;
+	u64 t__2e320;
+	u64 t__2e322;
+	u64 t__2e325;
+	u64 t__2e327;
+	u64 t__2e331;
+	u64 t__2e34;
+	u64 t__2e340;
+	u64 t__2e342;
+	u64 t__2e345;
+	u64 t__2e347;
+	u64 t__2e351;
+	u64 t__2e360;
+	u64 t__2e362;
+	u64 t__2e365;
+	u64 t__2e367;
+	u64 t__2e371;
+	u64 t__2e38;
+	u64 t__2e380;
+	u64 t__2e382;
+	u64 t__2e385;
+	u64 t__2e387;
+	u64 t__2e391;
+	u64 t__2e400;
+	u64 t__2e402;
+	u64 t__2e405;
+	u64 t__2e407;
+	u64 t__2e411;
+	u64 t__2e420;
+	u64 t__2e422;
+	u64 t__2e425;
+	u64 t__2e427;
+	u64 t__2e43;
+	u64 t__2e431;
+	u64 t__2e440;
+	u64 t__2e442;
+	u64 t__2e445;
+	u64 t__2e447;
+	u64 t__2e451;
+	u64 t__2e460;
+	u64 t__2e462;
+	u64 t__2e465;
+	u64 t__2e467;
+	u64 t__2e471;
+	u64 t__2e48;
+	u64 t__2e480;
+	u64 t__2e482;
+	u64 t__2e485;
+	u64 t__2e487;
+	u64 t__2e491;
+	u64 t__2e500;
+	u64 t__2e502;
+	u64 t__2e505;
+	u64 t__2e507;
+	u64 t__2e511;
+	u64 t__2e520;
+	u64 t__2e522;
+	u64 t__2e531;
+	u64 t__2e534;
+	u64 t__2e535;
+	u64 t__2e536;
+	u64 t__2e537;
+	u64 t__2e538;
+	u64 t__2e539;
+	u64 t__2e540;
+	u64 t__2e542;
+	u64 t__2e544;
+	u64 t__2e548;
+	u64 t__2e557;
+	u64 t__2e559;
+	u64 t__2e562;
+	u64 t__2e564;
+	u64 t__2e568;
+	u64 t__2e577;
+	u64 t__2e579;
+	u64 t__2e58;
+	u64 t__2e582;
+	u64 t__2e584;
+	u64 t__2e588;
+	u64 t__2e597;
+	u64 t__2e599;
+	u64 t__2e60;
+	u64 t__2e604;
+	u64 t__2e605;
+	u64 t__2e608;
+	u64 t__2e609;
+	u64 t__2e610;
+	u64 t__2e611;
+	u64 t__2e614;
+	u64 t__2e618;
+	u64 t__2e619;
+	u64 t__2e62;
+	u64 t__2e620;
+	u64 t__2e621;
+	u64 t__2e622;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e627;
+	u64 t__2e628;
+	u64 t__2e629;
+	u64 t__2e63;
+	u64 t__2e632;
+	u64 t__2e633;
+	u64 t__2e634;
+	u64 t__2e635;
+	u64 t__2e636;
+	u64 t__2e639;
+	u64 t__2e640;
+	u64 t__2e641;
+	u64 t__2e642;
+	u64 t__2e649;
+	u64 t__2e650;
+	u64 t__2e651;
+	u64 t__2e654;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t__2e657;
+	u64 t__2e660;
+	u64 t__2e661;
+	u64 t__2e662;
+	u64 t__2e663;
+	u64 t__2e664;
+	u64 t__2e667;
+	u64 t__2e668;
+	u64 t__2e669;
+	u64 t__2e670;
+	u64 t__2e672;
+	u64 t__2e674;
+	u64 t__2e675;
+	u64 t__2e676;
+	u64 t__2e677;
+	u64 t__2e678;
+	u64 t__2e679;
+	u64 t__2e68;
+	u64 t__2e680;
+	u64 t__2e683;
+	u64 t__2e684;
+	u64 t__2e685;
+	u64 t__2e686;
+	u64 t__2e687;
+	u64 t__2e69;
+	u64 t__2e690;
+	u64 t__2e691;
+	u64 t__2e692;
+	u64 t__2e693;
+	u64 t__2e695;
+	u64 t__2e697;
+	u64 t__2e699;
+	u64 t__2e708;
+	u64 t__2e710;
+	u64 t__2e712;
+	u64 t__2e713;
+	u64 t__2e714;
+	u64 t__2e715;
+	u64 t__2e716;
+	u64 t__2e719;
+	u64 t__2e720;
+	u64 t__2e721;
+	u64 t__2e722;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e727;
+	u64 t__2e728;
+	u64 t__2e729;
+	u64 t__2e730;
+	u64 t__2e731;
+	u64 t__2e732;
+	u64 t__2e734;
+	u64 t__2e736;
+	u64 t__2e738;
+	u64 t__2e747;
+	u64 t__2e749;
+	u64 t__2e753;
+	u64 t__2e754;
+	u64 t__2e757;
+	u64 t__2e759;
+	u64 t__2e76;
+	u64 t__2e760;
+	u64 t__2e77;
+	u64 t__2e770;
+	u64 t__2e773;
+	u64 t__2e776;
+	u64 t__2e778;
+	u64 t__2e78;
+	u64 t__2e782;
+	u64 t__2e79;
+	u64 t__2e791;
+	u64 t__2e793;
+	u64 t__2e796;
+	u64 t__2e798;
+	u64 t__2e80;
+	u64 t__2e802;
+	u64 t__2e811;
+	u64 t__2e813;
+	u64 t__2e817;
+	u64 t__2e821;
+	u64 t__2e823;
+	u64 t__2e824;
+	u64 t__2e827;
+	u64 t__2e834;
+	u64 t__2e835;
+	u64 t__2e838;
+	u64 t__2e841;
+	u64 t__2e846;
+	u64 t__2e850;
+	u64 t__2e852;
+	u64 t__2e853;
+	u64 t__2e856;
+	u64 t__2e859;
+	u64 t__2e86;
+	u64 t__2e863;
+	u64 t__2e865;
+	u64 t__2e868;
+	u64 t__2e87;
+	u64 t__2e871;
+	u64 t__2e875;
+	u64 t__2e877;
+	u64 t__2e88;
+	u64 t__2e881;
+	u64 t__2e890;
+	u64 t__2e892;
+	u64 t__2e98;
+	u64 t_abortsite_2e19;
+	u64 t_binding_2e103;
+	u64 t_binding_2e11;
+	u64 t_binding_2e116;
+	u64 t_binding_2e117;
+	u64 t_binding_2e124;
+	u64 t_binding_2e138;
+	u64 t_binding_2e166;
+	u64 t_binding_2e26;
+	u64 t_binding_2e44;
+	u64 t_binding_2e524;
+	u64 t_binding_2e6;
+	u64 t_binding_2e601;
+	u64 t_binding_2e607;
+	u64 t_binding_2e61;
+	u64 t_binding_2e648;
+	u64 t_binding_2e673;
+	u64 t_binding_2e758;
+	u64 t_binding_2e763;
+	u64 t_binding_2e81;
+	u64 t_binding_2e82;
+	u64 t_binding_2e830;
+	u64 t_binding_2e89;
+	u64 t_data_2e623;
+	u64 t_field_2e10;
+	u64 t_field_2e15;
+	u64 t_field_2e16;
+	u64 t_field_2e27;
+	u64 t_field_2e28;
+	u64 t_field_2e32;
+	u64 t_field_2e33;
+	u64 t_field_2e35;
+	u64 t_field_2e40;
+	u64 t_field_2e41;
+	u64 t_field_2e42;
+	u64 t_field_2e9;
+	u64 t_item_2e169;
+	u64 t_item_2e189;
+	u64 t_item_2e603;
+	u64 t_item_2e606;
+	u64 t_object_2e146;
+	u64 t_object_2e167;
+	u64 t_object_2e187;
+	u64 t_object_2e195;
+	u64 t_object_2e203;
+	u64 t_object_2e226;
+	u64 t_object_2e230;
+	u64 t_object_2e246;
+	u64 t_object_2e250;
+	u64 t_object_2e266;
+	u64 t_object_2e270;
+	u64 t_object_2e286;
+	u64 t_object_2e290;
+	u64 t_object_2e306;
+	u64 t_object_2e310;
+	u64 t_object_2e326;
+	u64 t_object_2e330;
+	u64 t_object_2e346;
+	u64 t_object_2e350;
+	u64 t_object_2e366;
+	u64 t_object_2e370;
+	u64 t_object_2e386;
+	u64 t_object_2e39;
+	u64 t_object_2e390;
+	u64 t_object_2e406;
+	u64 t_object_2e410;
+	u64 t_object_2e426;
+	u64 t_object_2e430;
+	u64 t_object_2e446;
+	u64 t_object_2e450;
+	u64 t_object_2e466;
+	u64 t_object_2e470;
+	u64 t_object_2e486;
+	u64 t_object_2e490;
+	u64 t_object_2e506;
+	u64 t_object_2e510;
+	u64 t_object_2e543;
+	u64 t_object_2e547;
+	u64 t_object_2e563;
+	u64 t_object_2e567;
+	u64 t_object_2e583;
+	u64 t_object_2e587;
+	u64 t_object_2e696;
+	u64 t_object_2e698;
+	u64 t_object_2e735;
+	u64 t_object_2e737;
+	u64 t_object_2e777;
+	u64 t_object_2e781;
+	u64 t_object_2e797;
+	u64 t_object_2e801;
+	u64 t_object_2e822;
+	u64 t_object_2e851;
+	u64 t_object_2e864;
+	u64 t_object_2e876;
+	u64 t_object_2e880;
+	u64 t_subval_2e826;
+	u64 t_subval_2e840;
+	u64 t_subval_2e855;
+	u64 t_subval_2e870;
+	u64 t_tag_2e125;
+	u64 t_tag_2e148;
+	u64 t_tag_2e206;
+	u64 t_tag_2e232;
+	u64 t_tag_2e252;
+	u64 t_tag_2e272;
+	u64 t_tag_2e292;
+	u64 t_tag_2e312;
+	u64 t_tag_2e332;
+	u64 t_tag_2e352;
+	u64 t_tag_2e372;
+	u64 t_tag_2e392;
+	u64 t_tag_2e412;
+	u64 t_tag_2e432;
+	u64 t_tag_2e452;
+	u64 t_tag_2e472;
+	u64 t_tag_2e492;
+	u64 t_tag_2e50;
+	u64 t_tag_2e512;
+	u64 t_tag_2e549;
+	u64 t_tag_2e569;
+	u64 t_tag_2e589;
+	u64 t_tag_2e700;
+	u64 t_tag_2e739;
+	u64 t_tag_2e783;
+	u64 t_tag_2e803;
+	u64 t_tag_2e882;
+	u64 t_tag_2e90;
+	L_start_2e2:;
+	t_binding_2e6 = (u64)A0;
+	t_binding_2e11 = (u64)A1;
+	t_binding_2e26 = (u64)A2;
+	t_object_2e39 = (u64)A3;
+	t_binding_2e44 = (u64)A4;
+	t_binding_2e61 = (u64)A5;
+	t_binding_2e81 = (u64)A6;
+	t_binding_2e82 = (u64)A7;
+	t_binding_2e89 = (u64)A8;
+	t_binding_2e103 = (u64)A9;
+	t_binding_2e116 = (u64)A10;
+	t_binding_2e117 = (u64)A11;
+	t_binding_2e124 = (u64)A12;
+	t_binding_2e138 = (u64)A13;
+	t_object_2e146 = (u64)A14;
+	t_binding_2e166 = (u64)A15;
+	t_object_2e167 = (u64)A16;
+	t_object_2e187 = (u64)A17;
+	t_object_2e195 = (u64)A18;
+	t_object_2e203 = (u64)A19;
+	t_object_2e226 = (u64)A20;
+	t_object_2e230 = (u64)A21;
+	t_object_2e246 = (u64)A22;
+	t_object_2e250 = (u64)A23;
+	t_object_2e266 = (u64)A24;
+	t_object_2e270 = (u64)A25;
+	t_object_2e286 = (u64)A26;
+	t_object_2e290 = (u64)A27;
+	t_object_2e306 = (u64)A28;
+	t_object_2e310 = (u64)A29;
+	t_object_2e326 = (u64)A30;
+	t_object_2e330 = (u64)A31;
+	t_object_2e346 = (u64)A32;
+	t_object_2e350 = (u64)A33;
+	t_object_2e366 = (u64)A34;
+	t_object_2e370 = (u64)A35;
+	t_object_2e386 = (u64)A36;
+	t_object_2e390 = (u64)A37;
+	t_object_2e406 = (u64)A38;
+	t_object_2e410 = (u64)A39;
+	t_object_2e426 = (u64)A40;
+	t_object_2e430 = (u64)A41;
+	t_object_2e446 = (u64)A42;
+	t_object_2e450 = (u64)A43;
+	t_object_2e466 = (u64)A44;
+	t_object_2e470 = (u64)A45;
+	t_object_2e486 = (u64)A46;
+	t_object_2e490 = (u64)A47;
+	t_object_2e506 = (u64)A48;
+	t_object_2e510 = (u64)A49;
+	t_binding_2e524 = (u64)A50;
+	t_object_2e543 = (u64)A51;
+	t_object_2e547 = (u64)A52;
+	t_object_2e563 = (u64)A53;
+	t_object_2e567 = (u64)A54;
+	t_object_2e583 = (u64)A55;
+	t_object_2e587 = (u64)A56;
+	t_binding_2e601 = (u64)A57;
+	t_binding_2e607 = (u64)A58;
+	t_binding_2e648 = (u64)A59;
+	t_binding_2e673 = (u64)A60;
+	t_object_2e696 = (u64)A61;
+	t_object_2e698 = (u64)A62;
+	t_object_2e735 = (u64)A63;
+	t_object_2e737 = (u64)A64;
+	t_binding_2e758 = (u64)A65;
+	t_binding_2e763 = (u64)A66;
+	t_object_2e777 = (u64)A67;
+	t_object_2e781 = (u64)A68;
+	t_object_2e797 = (u64)A69;
+	t_object_2e801 = (u64)A70;
+	t_object_2e822 = (u64)A71;
+	t__2e817 = (u64)A72;
+	t_binding_2e830 = (u64)A73;
+	t_object_2e851 = (u64)A74;
+	t__2e846 = (u64)A75;
+	t_object_2e864 = (u64)A76;
+	t__2e859 = (u64)A77;
+	t_object_2e876 = (u64)A78;
+	t_object_2e880 = (u64)A79;
+	L_body_2e3:;
+	t_field_2e9 = (u64)((u64)t_binding_2e6 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e9 = (u64)((u64)0UL);
+	t_field_2e9 = (u64)((u64)t_binding_2e6 + (u64)((u64)8UL));
+	t_field_2e10 = (u64)((u64)t_field_2e9 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e10 = (u64)((u64)1UL);
+	t_field_2e10 = (u64)((u64)t_field_2e9 + (u64)((u64)8UL));
+	*(u8 *)t_field_2e10 = (u8)((u64)0UL);
+	BLIT(t_binding_2e11, t_binding_2e6, ((u64)24UL));
+	t_field_2e15 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t_field_2e16 = (u64)((u64)t_field_2e15 + (u64)((u64)0UL));
+	t__2e17 = (u64)(*(u64 *)t_field_2e16);
+	t__2e14 = (u64)(u32)(((u64)t__2e17 == (u64)((u64)1UL)));
+	if ((u32)t__2e14) goto L_passed_2e13; else goto L_failed_2e12;
+	L_failed_2e12:;
+	t_abortsite_2e19 = ((u64)0UL);
+	goto L_abort_2e20;
+	L_passed_2e13:;
+	t_field_2e27 = (u64)((u64)t_binding_2e26 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e27 = (u64)((u64)0UL);
+	t_field_2e27 = (u64)((u64)t_binding_2e26 + (u64)((u64)8UL));
+	t_field_2e28 = (u64)((u64)t_field_2e27 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e28 = (u64)((u64)1UL);
+	t_field_2e28 = (u64)((u64)t_field_2e27 + (u64)((u64)8UL));
+	*(u8 *)t_field_2e28 = (u8)((u64)0UL);
+	t_field_2e32 = (u64)((u64)t_binding_2e26 + (u64)((u64)8UL));
+	t_field_2e33 = (u64)((u64)t_field_2e32 + (u64)((u64)0UL));
+	t__2e34 = (u64)(*(u64 *)t_field_2e33);
+	t__2e31 = (u64)(u32)(((u64)t__2e34 == (u64)((u64)1UL)));
+	if ((u32)t__2e31) goto L_passed_2e30; else goto L_failed_2e29;
+	L_failed_2e29:;
+	t_abortsite_2e19 = ((u64)1UL);
+	goto L_abort_2e20;
+	L_passed_2e30:;
+	t_field_2e35 = (u64)((u64)t_binding_2e26 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e35 = (u64)((u64)42UL);
+	t_field_2e40 = (u64)((u64)t_object_2e39 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e40 = (u64)((u64)0UL);
+	t_field_2e40 = (u64)((u64)t_object_2e39 + (u64)((u64)8UL));
+	t_field_2e41 = (u64)((u64)t_field_2e40 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e41 = (u64)((u64)1UL);
+	t_field_2e41 = (u64)((u64)t_field_2e40 + (u64)((u64)8UL));
+	*(u8 *)t_field_2e41 = (u8)((u64)0UL);
+	t_field_2e42 = (u64)((u64)t_object_2e39 + (u64)((u64)0UL));
+	t__2e43 = (u64)(*(u64 *)t_field_2e42);
+	t__2e38 = (u64)(u32)(((u64)t__2e43 == (u64)((u64)0UL)));
+	if ((u32)t__2e38) goto L_passed_2e37; else goto L_failed_2e36;
+	L_failed_2e36:;
+	t_abortsite_2e19 = ((u64)2UL);
+	goto L_abort_2e20;
+	L_passed_2e37:;
+	*(u32 *)t_binding_2e44 = (u32)((u64)1099590421UL);
+	t__2e48 = (u64)((u64)t_binding_2e44 + (u64)((u64)4UL));
+	*(u32 *)t__2e48 = (u32)((u64)10UL);
+	t_tag_2e50 = (u64)(*(u32 *)t_binding_2e44);
+	t__2e58 = (u64)(u32)(((u32)t_tag_2e50 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e58) goto L_member_2e55; else goto L__2e57;
+	L__2e57:;
+	t__2e60 = (u64)(u32)(((u32)t_tag_2e50 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e60) goto L_member_2e56; else goto L__2e59;
+	L__2e59:;
+	goto L__2e52;
+	L_member_2e55:;
+	goto L_matches_2e53;
+	L_member_2e56:;
+	goto L_matches_2e54;
+	L_matches_2e53:;
+	t__2e62 = (u64)((u64)t_binding_2e44 + (u64)((u64)4UL));
+	t__2e63 = (u64)(u32)(*(i32 *)t__2e62);
+	*(u32 *)t_binding_2e61 = (u32)t__2e63;
+	t__2e69 = (u64)(u32)(*(i32 *)t_binding_2e61);
+	t__2e68 = (u64)(u32)(((u32)t__2e69 == (u32)((u64)10UL)));
+	if ((u32)t__2e68) goto L_passed_2e67; else goto L_failed_2e66;
+	L_failed_2e66:;
+	t_abortsite_2e19 = ((u64)3UL);
+	goto L_abort_2e20;
+	L_passed_2e67:;
+	goto L__2e64;
+	L__2e70:;
+	L__2e64:;
+	goto L__2e51;
+	L_matches_2e54:;
+	t_abortsite_2e19 = ((u64)4UL);
+	goto L_abort_2e20;
+	L__2e73:;
+	L__2e71:;
+	L__2e74:;
+	L__2e52:;
+	t_abortsite_2e19 = ((u64)5UL);
+	goto L_abort_2e75;
+	L__2e51:;
+	*(u32 *)t_binding_2e81 = (u32)((u64)0UL);
+	*(u32 *)t_binding_2e82 = (u32)((u64)1268499444UL);
+	t__2e86 = (u64)((u64)t_binding_2e82 + (u64)((u64)8UL));
+	t__2e87 = t_binding_2e81;
+	t__2e88 = t__2e87;
+	*(u64 *)t__2e86 = (u64)t__2e88;
+	t_tag_2e90 = (u64)(*(u32 *)t_binding_2e82);
+	t__2e98 = (u64)(u32)(((u32)t_tag_2e90 == (u32)((u64)1268499444UL)));
+	if ((u32)t__2e98) goto L_member_2e95; else goto L__2e97;
+	L__2e97:;
+	t__2e100 = (u64)(u32)(((u32)t_tag_2e90 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e100) goto L_member_2e96; else goto L__2e99;
+	L__2e99:;
+	goto L__2e92;
+	L_member_2e95:;
+	goto L_matches_2e94;
+	L_member_2e96:;
+	goto L_matches_2e93;
+	L_matches_2e93:;
+	t_abortsite_2e19 = ((u64)6UL);
+	goto L_abort_2e20;
+	L__2e102:;
+	L__2e101:;
+	L_matches_2e94:;
+	t__2e104 = (u64)((u64)t_binding_2e82 + (u64)((u64)8UL));
+	t__2e105 = (u64)(*(u64 *)t__2e104);
+	*(u64 *)t_binding_2e103 = (u64)t__2e105;
+	t__2e107 = (u64)(*(u64 *)t_binding_2e103);
+	t__2e108 = t__2e107;
+	t__2e109 = t__2e108;
+	*(u64 *)t_binding_2e89 = (u64)t__2e109;
+	goto L__2e106;
+	L__2e110:;
+	L__2e106:;
+	goto L__2e91;
+	L__2e92:;
+	t_abortsite_2e19 = ((u64)7UL);
+	goto L_abort_2e75;
+	L__2e91:;
+	t__2e114 = (u64)(*(u64 *)t_binding_2e89);
+	t__2e115 = (u64)(u32)(*(i32 *)t__2e114);
+	t__2e113 = (u64)(u32)(((u32)t__2e115 == (u32)((u64)0UL)));
+	if ((u32)t__2e113) goto L_passed_2e112; else goto L_failed_2e111;
+	L_failed_2e111:;
+	t_abortsite_2e19 = ((u64)8UL);
+	goto L_abort_2e20;
+	L_passed_2e112:;
+	*(u32 *)t_binding_2e116 = (u32)((u64)0UL);
+	*(u32 *)t_binding_2e117 = (u32)((u64)379429472UL);
+	t__2e123 = (u64)((u64)t_binding_2e117 + (u64)((u64)8UL));
+	*(u64 *)t__2e123 = (u64)t_binding_2e116;
+	t_tag_2e125 = (u64)(*(u32 *)t_binding_2e117);
+	t__2e133 = (u64)(u32)(((u32)t_tag_2e125 == (u32)((u64)379429472UL)));
+	if ((u32)t__2e133) goto L_member_2e130; else goto L__2e132;
+	L__2e132:;
+	t__2e135 = (u64)(u32)(((u32)t_tag_2e125 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e135) goto L_member_2e131; else goto L__2e134;
+	L__2e134:;
+	goto L__2e127;
+	L_member_2e130:;
+	goto L_matches_2e129;
+	L_member_2e131:;
+	goto L_matches_2e128;
+	L_matches_2e128:;
+	t_abortsite_2e19 = ((u64)9UL);
+	goto L_abort_2e20;
+	L__2e137:;
+	L__2e136:;
+	L_matches_2e129:;
+	t__2e139 = (u64)((u64)t_binding_2e117 + (u64)((u64)8UL));
+	t__2e140 = (u64)(*(u64 *)t__2e139);
+	*(u64 *)t_binding_2e138 = (u64)t__2e140;
+	t__2e142 = (u64)(*(u64 *)t_binding_2e138);
+	*(u64 *)t_binding_2e124 = (u64)t__2e142;
+	goto L__2e141;
+	L__2e143:;
+	L__2e141:;
+	goto L__2e126;
+	L__2e127:;
+	t_abortsite_2e19 = ((u64)10UL);
+	goto L_abort_2e75;
+	L__2e126:;
+	t__2e144 = (u64)(*(u64 *)t_binding_2e124);
+	*(u32 *)t__2e144 = (u32)((u64)0UL);
+	*(u32 *)t_object_2e146 = (u32)((u64)3012680272UL);
+	t_tag_2e148 = (u64)(*(u32 *)t_object_2e146);
+	t__2e156 = (u64)(u32)(((u32)t_tag_2e148 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e156) goto L_member_2e153; else goto L__2e155;
+	L__2e155:;
+	t__2e158 = (u64)(u32)(((u32)t_tag_2e148 == (u32)((u64)3046235510UL)));
+	if ((u32)t__2e158) goto L_member_2e154; else goto L__2e157;
+	L__2e157:;
+	goto L__2e150;
+	L_member_2e153:;
+	goto L_matches_2e151;
+	L_member_2e154:;
+	goto L_matches_2e152;
+	L_matches_2e151:;
+	goto L__2e159;
+	L__2e161:;
+	L__2e159:;
+	goto L__2e149;
+	L_matches_2e152:;
+	t_abortsite_2e19 = ((u64)11UL);
+	goto L_abort_2e20;
+	L__2e164:;
+	L__2e162:;
+	L__2e165:;
+	L__2e150:;
+	t_abortsite_2e19 = ((u64)12UL);
+	goto L_abort_2e75;
+	L__2e149:;
+	t_item_2e169 = (u64)((u64)t_object_2e167 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e169 = (u64)((u64)4607182418800017408UL);
+	t_item_2e169 = (u64)((u64)t_object_2e167 + (u64)((u64)8UL));
+	*(u64 *)t_item_2e169 = (u64)((u64)4611686018427387904UL);
+	t_item_2e169 = (u64)((u64)t_object_2e167 + (u64)((u64)16UL));
+	*(u64 *)t_item_2e169 = (u64)((u64)4613937818241073152UL);
+	*(u64 *)t_binding_2e166 = (u64)t_object_2e167;
+	t__2e170 = (u64)((u64)t_binding_2e166 + (u64)((u64)8UL));
+	*(u64 *)t__2e170 = (u64)((u64)3UL);
+	t__2e170 = (u64)((u64)t__2e170 + (u64)((u64)8UL));
+	*(u64 *)t__2e170 = (u64)((u64)3UL);
+	t__2e172 = (u64)((u64)t_binding_2e166 + (u64)((u64)8UL));
+	t__2e173 = (u64)((u64)t_binding_2e166 + (u64)((u64)16UL));
+	t__2e174 = (u64)(*(u64 *)t_binding_2e166);
+	t__2e175 = (u64)(*(u64 *)t__2e172);
+	t__2e176 = (u64)(*(u64 *)t__2e173);
+	t__2e177 = (u64)((u64)t__2e175 - (u64)((u64)0UL));
+	t__2e177 = t__2e175;
+	t__2e178 = t__2e176;
+	t__2e182 = (u64)((u64)((u64)0UL) * (u64)((u64)8UL));
+	t__2e183 = (u64)((u64)t__2e174 + (u64)t__2e182);
+	t__2e186 = (u64)(u32)(((u64)t__2e177 != (u64)((u64)0UL)));
+	if ((u32)t__2e186) goto L__2e185; else goto L__2e184;
+	L__2e185:;
+	t_item_2e189 = (u64)((u64)t_object_2e187 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e189 = (u64)((u64)0UL);
+	t__2e190 = (u64)(*(u64 *)t_object_2e187);
+	*(u64 *)t__2e183 = (u64)t__2e190;
+	t__2e191 = (u64)((u64)t__2e183 + (u64)((u64)8UL));
+	t__2e177 = (u64)((u64)t__2e177 - (u64)((u64)1UL));
+	t__2e177 = (u64)((u64)t__2e177 * (u64)((u64)8UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e191, (u64)t__2e183, (u64)t__2e177);
+	L__2e184:;
+	*(u32 *)t_object_2e195 = (u32)((u64)3532310079UL);
+	t__2e199 = (u64)((u64)t_object_2e195 + (u64)((u64)4UL));
+	*(u32 *)t__2e199 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e203 = (u64)((u64)0UL);
+	t__2e205 = (u64)((u64)t_object_2e203 + (u64)((u64)8UL));
+	*(u64 *)t__2e205 = (u64)((u64)0UL);
+	t__2e205 = (u64)((u64)t__2e205 + (u64)((u64)8UL));
+	*(u64 *)t__2e205 = (u64)((u64)0UL);
+	BLIT((u64)B80, t_object_2e195, 8);
+	BLIT((u64)B81, ((u64)((char *)&D_strliteral_2e201)), 24);
+	BLIT((u64)B82, t_object_2e203, 24);
+	t__2e193 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R83, (u64)B80, (u64)B81, (u64)B82);
+	t_tag_2e206 = (u64)(*(u32 *)t__2e193);
+	t__2e214 = (u64)(u32)(((u32)t_tag_2e206 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e214) goto L_member_2e211; else goto L__2e213;
+	L__2e213:;
+	t__2e216 = (u64)(u32)(((u32)t_tag_2e206 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e216) goto L_member_2e212; else goto L__2e215;
+	L__2e215:;
+	goto L_matches_2e210;
+	L_member_2e211:;
+	goto L_matches_2e210;
+	L_member_2e212:;
+	goto L_matches_2e209;
+	L_matches_2e209:;
+	goto L__2e207;
+	L_matches_2e210:;
+	t_abortsite_2e19 = ((u64)13UL);
+	goto L_abort_2e217;
+	L__2e223:;
+	L__2e208:;
+	t_abortsite_2e19 = ((u64)14UL);
+	goto L_abort_2e75;
+	L__2e207:;
+	*(u32 *)t_object_2e226 = (u32)((u64)3532310079UL);
+	t__2e227 = (u64)((u64)t_object_2e226 + (u64)((u64)4UL));
+	*(u32 *)t__2e227 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e230 = (u64)((u64)0UL);
+	t__2e231 = (u64)((u64)t_object_2e230 + (u64)((u64)8UL));
+	*(u64 *)t__2e231 = (u64)((u64)0UL);
+	t__2e231 = (u64)((u64)t__2e231 + (u64)((u64)8UL));
+	*(u64 *)t__2e231 = (u64)((u64)0UL);
+	BLIT((u64)B84, t_object_2e226, 8);
+	BLIT((u64)B85, ((u64)((char *)&D_strliteral_2e229)), 24);
+	BLIT((u64)B86, t_object_2e230, 24);
+	t__2e225 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R87, (u64)B84, (u64)B85, (u64)B86);
+	t_tag_2e232 = (u64)(*(u32 *)t__2e225);
+	t__2e240 = (u64)(u32)(((u32)t_tag_2e232 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e240) goto L_member_2e237; else goto L__2e239;
+	L__2e239:;
+	t__2e242 = (u64)(u32)(((u32)t_tag_2e232 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e242) goto L_member_2e238; else goto L__2e241;
+	L__2e241:;
+	goto L_matches_2e236;
+	L_member_2e237:;
+	goto L_matches_2e236;
+	L_member_2e238:;
+	goto L_matches_2e235;
+	L_matches_2e235:;
+	goto L__2e233;
+	L_matches_2e236:;
+	t_abortsite_2e19 = ((u64)15UL);
+	goto L_abort_2e217;
+	L__2e243:;
+	L__2e234:;
+	t_abortsite_2e19 = ((u64)16UL);
+	goto L_abort_2e75;
+	L__2e233:;
+	*(u32 *)t_object_2e246 = (u32)((u64)3532310079UL);
+	t__2e247 = (u64)((u64)t_object_2e246 + (u64)((u64)4UL));
+	*(u32 *)t__2e247 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e250 = (u64)((u64)0UL);
+	t__2e251 = (u64)((u64)t_object_2e250 + (u64)((u64)8UL));
+	*(u64 *)t__2e251 = (u64)((u64)0UL);
+	t__2e251 = (u64)((u64)t__2e251 + (u64)((u64)8UL));
+	*(u64 *)t__2e251 = (u64)((u64)0UL);
+	BLIT((u64)B88, t_object_2e246, 8);
+	BLIT((u64)B89, ((u64)((char *)&D_strliteral_2e249)), 24);
+	BLIT((u64)B90, t_object_2e250, 24);
+	t__2e245 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R91, (u64)B88, (u64)B89, (u64)B90);
+	t_tag_2e252 = (u64)(*(u32 *)t__2e245);
+	t__2e260 = (u64)(u32)(((u32)t_tag_2e252 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e260) goto L_member_2e257; else goto L__2e259;
+	L__2e259:;
+	t__2e262 = (u64)(u32)(((u32)t_tag_2e252 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e262) goto L_member_2e258; else goto L__2e261;
+	L__2e261:;
+	goto L_matches_2e256;
+	L_member_2e257:;
+	goto L_matches_2e256;
+	L_member_2e258:;
+	goto L_matches_2e255;
+	L_matches_2e255:;
+	goto L__2e253;
+	L_matches_2e256:;
+	t_abortsite_2e19 = ((u64)17UL);
+	goto L_abort_2e217;
+	L__2e263:;
+	L__2e254:;
+	t_abortsite_2e19 = ((u64)18UL);
+	goto L_abort_2e75;
+	L__2e253:;
+	*(u32 *)t_object_2e266 = (u32)((u64)3532310079UL);
+	t__2e267 = (u64)((u64)t_object_2e266 + (u64)((u64)4UL));
+	*(u32 *)t__2e267 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e270 = (u64)((u64)0UL);
+	t__2e271 = (u64)((u64)t_object_2e270 + (u64)((u64)8UL));
+	*(u64 *)t__2e271 = (u64)((u64)0UL);
+	t__2e271 = (u64)((u64)t__2e271 + (u64)((u64)8UL));
+	*(u64 *)t__2e271 = (u64)((u64)0UL);
+	BLIT((u64)B92, t_object_2e266, 8);
+	BLIT((u64)B93, ((u64)((char *)&D_strliteral_2e269)), 24);
+	BLIT((u64)B94, t_object_2e270, 24);
+	t__2e265 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R95, (u64)B92, (u64)B93, (u64)B94);
+	t_tag_2e272 = (u64)(*(u32 *)t__2e265);
+	t__2e280 = (u64)(u32)(((u32)t_tag_2e272 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e280) goto L_member_2e277; else goto L__2e279;
+	L__2e279:;
+	t__2e282 = (u64)(u32)(((u32)t_tag_2e272 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e282) goto L_member_2e278; else goto L__2e281;
+	L__2e281:;
+	goto L_matches_2e276;
+	L_member_2e277:;
+	goto L_matches_2e276;
+	L_member_2e278:;
+	goto L_matches_2e275;
+	L_matches_2e275:;
+	goto L__2e273;
+	L_matches_2e276:;
+	t_abortsite_2e19 = ((u64)19UL);
+	goto L_abort_2e217;
+	L__2e283:;
+	L__2e274:;
+	t_abortsite_2e19 = ((u64)20UL);
+	goto L_abort_2e75;
+	L__2e273:;
+	*(u32 *)t_object_2e286 = (u32)((u64)3532310079UL);
+	t__2e287 = (u64)((u64)t_object_2e286 + (u64)((u64)4UL));
+	*(u32 *)t__2e287 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e290 = (u64)((u64)0UL);
+	t__2e291 = (u64)((u64)t_object_2e290 + (u64)((u64)8UL));
+	*(u64 *)t__2e291 = (u64)((u64)0UL);
+	t__2e291 = (u64)((u64)t__2e291 + (u64)((u64)8UL));
+	*(u64 *)t__2e291 = (u64)((u64)0UL);
+	BLIT((u64)B96, t_object_2e286, 8);
+	BLIT((u64)B97, ((u64)((char *)&D_strliteral_2e289)), 24);
+	BLIT((u64)B98, t_object_2e290, 24);
+	t__2e285 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R99, (u64)B96, (u64)B97, (u64)B98);
+	t_tag_2e292 = (u64)(*(u32 *)t__2e285);
+	t__2e300 = (u64)(u32)(((u32)t_tag_2e292 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e300) goto L_member_2e297; else goto L__2e299;
+	L__2e299:;
+	t__2e302 = (u64)(u32)(((u32)t_tag_2e292 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e302) goto L_member_2e298; else goto L__2e301;
+	L__2e301:;
+	goto L_matches_2e296;
+	L_member_2e297:;
+	goto L_matches_2e296;
+	L_member_2e298:;
+	goto L_matches_2e295;
+	L_matches_2e295:;
+	goto L__2e293;
+	L_matches_2e296:;
+	t_abortsite_2e19 = ((u64)21UL);
+	goto L_abort_2e217;
+	L__2e303:;
+	L__2e294:;
+	t_abortsite_2e19 = ((u64)22UL);
+	goto L_abort_2e75;
+	L__2e293:;
+	*(u32 *)t_object_2e306 = (u32)((u64)3532310079UL);
+	t__2e307 = (u64)((u64)t_object_2e306 + (u64)((u64)4UL));
+	*(u32 *)t__2e307 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e310 = (u64)((u64)0UL);
+	t__2e311 = (u64)((u64)t_object_2e310 + (u64)((u64)8UL));
+	*(u64 *)t__2e311 = (u64)((u64)0UL);
+	t__2e311 = (u64)((u64)t__2e311 + (u64)((u64)8UL));
+	*(u64 *)t__2e311 = (u64)((u64)0UL);
+	BLIT((u64)B100, t_object_2e306, 8);
+	BLIT((u64)B101, ((u64)((char *)&D_strliteral_2e309)), 24);
+	BLIT((u64)B102, t_object_2e310, 24);
+	t__2e305 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R103, (u64)B100, (u64)B101, (u64)B102);
+	t_tag_2e312 = (u64)(*(u32 *)t__2e305);
+	t__2e320 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e320) goto L_member_2e317; else goto L__2e319;
+	L__2e319:;
+	t__2e322 = (u64)(u32)(((u32)t_tag_2e312 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e322) goto L_member_2e318; else goto L__2e321;
+	L__2e321:;
+	goto L_matches_2e316;
+	L_member_2e317:;
+	goto L_matches_2e316;
+	L_member_2e318:;
+	goto L_matches_2e315;
+	L_matches_2e315:;
+	goto L__2e313;
+	L_matches_2e316:;
+	t_abortsite_2e19 = ((u64)23UL);
+	goto L_abort_2e217;
+	L__2e323:;
+	L__2e314:;
+	t_abortsite_2e19 = ((u64)24UL);
+	goto L_abort_2e75;
+	L__2e313:;
+	*(u32 *)t_object_2e326 = (u32)((u64)3532310079UL);
+	t__2e327 = (u64)((u64)t_object_2e326 + (u64)((u64)4UL));
+	*(u32 *)t__2e327 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e330 = (u64)((u64)0UL);
+	t__2e331 = (u64)((u64)t_object_2e330 + (u64)((u64)8UL));
+	*(u64 *)t__2e331 = (u64)((u64)0UL);
+	t__2e331 = (u64)((u64)t__2e331 + (u64)((u64)8UL));
+	*(u64 *)t__2e331 = (u64)((u64)0UL);
+	BLIT((u64)B104, t_object_2e326, 8);
+	BLIT((u64)B105, ((u64)((char *)&D_strliteral_2e329)), 24);
+	BLIT((u64)B106, t_object_2e330, 24);
+	t__2e325 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R107, (u64)B104, (u64)B105, (u64)B106);
+	t_tag_2e332 = (u64)(*(u32 *)t__2e325);
+	t__2e340 = (u64)(u32)(((u32)t_tag_2e332 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e340) goto L_member_2e337; else goto L__2e339;
+	L__2e339:;
+	t__2e342 = (u64)(u32)(((u32)t_tag_2e332 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e342) goto L_member_2e338; else goto L__2e341;
+	L__2e341:;
+	goto L_matches_2e336;
+	L_member_2e337:;
+	goto L_matches_2e336;
+	L_member_2e338:;
+	goto L_matches_2e335;
+	L_matches_2e335:;
+	goto L__2e333;
+	L_matches_2e336:;
+	t_abortsite_2e19 = ((u64)25UL);
+	goto L_abort_2e217;
+	L__2e343:;
+	L__2e334:;
+	t_abortsite_2e19 = ((u64)26UL);
+	goto L_abort_2e75;
+	L__2e333:;
+	*(u32 *)t_object_2e346 = (u32)((u64)3532310079UL);
+	t__2e347 = (u64)((u64)t_object_2e346 + (u64)((u64)4UL));
+	*(u32 *)t__2e347 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e350 = (u64)((u64)0UL);
+	t__2e351 = (u64)((u64)t_object_2e350 + (u64)((u64)8UL));
+	*(u64 *)t__2e351 = (u64)((u64)0UL);
+	t__2e351 = (u64)((u64)t__2e351 + (u64)((u64)8UL));
+	*(u64 *)t__2e351 = (u64)((u64)0UL);
+	BLIT((u64)B108, t_object_2e346, 8);
+	BLIT((u64)B109, ((u64)((char *)&D_strliteral_2e349)), 24);
+	BLIT((u64)B110, t_object_2e350, 24);
+	t__2e345 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R111, (u64)B108, (u64)B109, (u64)B110);
+	t_tag_2e352 = (u64)(*(u32 *)t__2e345);
+	t__2e360 = (u64)(u32)(((u32)t_tag_2e352 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e360) goto L_member_2e357; else goto L__2e359;
+	L__2e359:;
+	t__2e362 = (u64)(u32)(((u32)t_tag_2e352 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e362) goto L_member_2e358; else goto L__2e361;
+	L__2e361:;
+	goto L_matches_2e356;
+	L_member_2e357:;
+	goto L_matches_2e356;
+	L_member_2e358:;
+	goto L_matches_2e355;
+	L_matches_2e355:;
+	goto L__2e353;
+	L_matches_2e356:;
+	t_abortsite_2e19 = ((u64)27UL);
+	goto L_abort_2e217;
+	L__2e363:;
+	L__2e354:;
+	t_abortsite_2e19 = ((u64)28UL);
+	goto L_abort_2e75;
+	L__2e353:;
+	*(u32 *)t_object_2e366 = (u32)((u64)3532310079UL);
+	t__2e367 = (u64)((u64)t_object_2e366 + (u64)((u64)4UL));
+	*(u32 *)t__2e367 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e370 = (u64)((u64)0UL);
+	t__2e371 = (u64)((u64)t_object_2e370 + (u64)((u64)8UL));
+	*(u64 *)t__2e371 = (u64)((u64)0UL);
+	t__2e371 = (u64)((u64)t__2e371 + (u64)((u64)8UL));
+	*(u64 *)t__2e371 = (u64)((u64)0UL);
+	BLIT((u64)B112, t_object_2e366, 8);
+	BLIT((u64)B113, ((u64)((char *)&D_strliteral_2e369)), 24);
+	BLIT((u64)B114, t_object_2e370, 24);
+	t__2e365 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R115, (u64)B112, (u64)B113, (u64)B114);
+	t_tag_2e372 = (u64)(*(u32 *)t__2e365);
+	t__2e380 = (u64)(u32)(((u32)t_tag_2e372 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e380) goto L_member_2e377; else goto L__2e379;
+	L__2e379:;
+	t__2e382 = (u64)(u32)(((u32)t_tag_2e372 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e382) goto L_member_2e378; else goto L__2e381;
+	L__2e381:;
+	goto L_matches_2e376;
+	L_member_2e377:;
+	goto L_matches_2e376;
+	L_member_2e378:;
+	goto L_matches_2e375;
+	L_matches_2e375:;
+	goto L__2e373;
+	L_matches_2e376:;
+	t_abortsite_2e19 = ((u64)29UL);
+	goto L_abort_2e217;
+	L__2e383:;
+	L__2e374:;
+	t_abortsite_2e19 = ((u64)30UL);
+	goto L_abort_2e75;
+	L__2e373:;
+	*(u32 *)t_object_2e386 = (u32)((u64)3532310079UL);
+	t__2e387 = (u64)((u64)t_object_2e386 + (u64)((u64)4UL));
+	*(u32 *)t__2e387 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e390 = (u64)((u64)0UL);
+	t__2e391 = (u64)((u64)t_object_2e390 + (u64)((u64)8UL));
+	*(u64 *)t__2e391 = (u64)((u64)0UL);
+	t__2e391 = (u64)((u64)t__2e391 + (u64)((u64)8UL));
+	*(u64 *)t__2e391 = (u64)((u64)0UL);
+	BLIT((u64)B116, t_object_2e386, 8);
+	BLIT((u64)B117, ((u64)((char *)&D_strliteral_2e389)), 24);
+	BLIT((u64)B118, t_object_2e390, 24);
+	t__2e385 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R119, (u64)B116, (u64)B117, (u64)B118);
+	t_tag_2e392 = (u64)(*(u32 *)t__2e385);
+	t__2e400 = (u64)(u32)(((u32)t_tag_2e392 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e400) goto L_member_2e397; else goto L__2e399;
+	L__2e399:;
+	t__2e402 = (u64)(u32)(((u32)t_tag_2e392 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e402) goto L_member_2e398; else goto L__2e401;
+	L__2e401:;
+	goto L_matches_2e396;
+	L_member_2e397:;
+	goto L_matches_2e396;
+	L_member_2e398:;
+	goto L_matches_2e395;
+	L_matches_2e395:;
+	goto L__2e393;
+	L_matches_2e396:;
+	t_abortsite_2e19 = ((u64)31UL);
+	goto L_abort_2e217;
+	L__2e403:;
+	L__2e394:;
+	t_abortsite_2e19 = ((u64)32UL);
+	goto L_abort_2e75;
+	L__2e393:;
+	*(u32 *)t_object_2e406 = (u32)((u64)3532310079UL);
+	t__2e407 = (u64)((u64)t_object_2e406 + (u64)((u64)4UL));
+	*(u32 *)t__2e407 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e410 = (u64)((u64)0UL);
+	t__2e411 = (u64)((u64)t_object_2e410 + (u64)((u64)8UL));
+	*(u64 *)t__2e411 = (u64)((u64)0UL);
+	t__2e411 = (u64)((u64)t__2e411 + (u64)((u64)8UL));
+	*(u64 *)t__2e411 = (u64)((u64)0UL);
+	BLIT((u64)B120, t_object_2e406, 8);
+	BLIT((u64)B121, ((u64)((char *)&D_strliteral_2e409)), 24);
+	BLIT((u64)B122, t_object_2e410, 24);
+	t__2e405 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R123, (u64)B120, (u64)B121, (u64)B122);
+	t_tag_2e412 = (u64)(*(u32 *)t__2e405);
+	t__2e420 = (u64)(u32)(((u32)t_tag_2e412 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e420) goto L_member_2e417; else goto L__2e419;
+	L__2e419:;
+	t__2e422 = (u64)(u32)(((u32)t_tag_2e412 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e422) goto L_member_2e418; else goto L__2e421;
+	L__2e421:;
+	goto L_matches_2e416;
+	L_member_2e417:;
+	goto L_matches_2e416;
+	L_member_2e418:;
+	goto L_matches_2e415;
+	L_matches_2e415:;
+	goto L__2e413;
+	L_matches_2e416:;
+	t_abortsite_2e19 = ((u64)33UL);
+	goto L_abort_2e217;
+	L__2e423:;
+	L__2e414:;
+	t_abortsite_2e19 = ((u64)34UL);
+	goto L_abort_2e75;
+	L__2e413:;
+	*(u32 *)t_object_2e426 = (u32)((u64)3532310079UL);
+	t__2e427 = (u64)((u64)t_object_2e426 + (u64)((u64)4UL));
+	*(u32 *)t__2e427 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e430 = (u64)((u64)0UL);
+	t__2e431 = (u64)((u64)t_object_2e430 + (u64)((u64)8UL));
+	*(u64 *)t__2e431 = (u64)((u64)0UL);
+	t__2e431 = (u64)((u64)t__2e431 + (u64)((u64)8UL));
+	*(u64 *)t__2e431 = (u64)((u64)0UL);
+	BLIT((u64)B124, t_object_2e426, 8);
+	BLIT((u64)B125, ((u64)((char *)&D_strliteral_2e429)), 24);
+	BLIT((u64)B126, t_object_2e430, 24);
+	t__2e425 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R127, (u64)B124, (u64)B125, (u64)B126);
+	t_tag_2e432 = (u64)(*(u32 *)t__2e425);
+	t__2e440 = (u64)(u32)(((u32)t_tag_2e432 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e440) goto L_member_2e437; else goto L__2e439;
+	L__2e439:;
+	t__2e442 = (u64)(u32)(((u32)t_tag_2e432 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e442) goto L_member_2e438; else goto L__2e441;
+	L__2e441:;
+	goto L_matches_2e436;
+	L_member_2e437:;
+	goto L_matches_2e436;
+	L_member_2e438:;
+	goto L_matches_2e435;
+	L_matches_2e435:;
+	goto L__2e433;
+	L_matches_2e436:;
+	t_abortsite_2e19 = ((u64)35UL);
+	goto L_abort_2e217;
+	L__2e443:;
+	L__2e434:;
+	t_abortsite_2e19 = ((u64)36UL);
+	goto L_abort_2e75;
+	L__2e433:;
+	*(u32 *)t_object_2e446 = (u32)((u64)3532310079UL);
+	t__2e447 = (u64)((u64)t_object_2e446 + (u64)((u64)4UL));
+	*(u32 *)t__2e447 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e450 = (u64)((u64)0UL);
+	t__2e451 = (u64)((u64)t_object_2e450 + (u64)((u64)8UL));
+	*(u64 *)t__2e451 = (u64)((u64)0UL);
+	t__2e451 = (u64)((u64)t__2e451 + (u64)((u64)8UL));
+	*(u64 *)t__2e451 = (u64)((u64)0UL);
+	BLIT((u64)B128, t_object_2e446, 8);
+	BLIT((u64)B129, ((u64)((char *)&D_strliteral_2e449)), 24);
+	BLIT((u64)B130, t_object_2e450, 24);
+	t__2e445 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R131, (u64)B128, (u64)B129, (u64)B130);
+	t_tag_2e452 = (u64)(*(u32 *)t__2e445);
+	t__2e460 = (u64)(u32)(((u32)t_tag_2e452 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e460) goto L_member_2e457; else goto L__2e459;
+	L__2e459:;
+	t__2e462 = (u64)(u32)(((u32)t_tag_2e452 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e462) goto L_member_2e458; else goto L__2e461;
+	L__2e461:;
+	goto L_matches_2e456;
+	L_member_2e457:;
+	goto L_matches_2e456;
+	L_member_2e458:;
+	goto L_matches_2e455;
+	L_matches_2e455:;
+	goto L__2e453;
+	L_matches_2e456:;
+	t_abortsite_2e19 = ((u64)37UL);
+	goto L_abort_2e217;
+	L__2e463:;
+	L__2e454:;
+	t_abortsite_2e19 = ((u64)38UL);
+	goto L_abort_2e75;
+	L__2e453:;
+	*(u32 *)t_object_2e466 = (u32)((u64)3532310079UL);
+	t__2e467 = (u64)((u64)t_object_2e466 + (u64)((u64)4UL));
+	*(u32 *)t__2e467 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e470 = (u64)((u64)0UL);
+	t__2e471 = (u64)((u64)t_object_2e470 + (u64)((u64)8UL));
+	*(u64 *)t__2e471 = (u64)((u64)0UL);
+	t__2e471 = (u64)((u64)t__2e471 + (u64)((u64)8UL));
+	*(u64 *)t__2e471 = (u64)((u64)0UL);
+	BLIT((u64)B132, t_object_2e466, 8);
+	BLIT((u64)B133, ((u64)((char *)&D_strliteral_2e469)), 24);
+	BLIT((u64)B134, t_object_2e470, 24);
+	t__2e465 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R135, (u64)B132, (u64)B133, (u64)B134);
+	t_tag_2e472 = (u64)(*(u32 *)t__2e465);
+	t__2e480 = (u64)(u32)(((u32)t_tag_2e472 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e480) goto L_member_2e477; else goto L__2e479;
+	L__2e479:;
+	t__2e482 = (u64)(u32)(((u32)t_tag_2e472 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e482) goto L_member_2e478; else goto L__2e481;
+	L__2e481:;
+	goto L_matches_2e476;
+	L_member_2e477:;
+	goto L_matches_2e476;
+	L_member_2e478:;
+	goto L_matches_2e475;
+	L_matches_2e475:;
+	goto L__2e473;
+	L_matches_2e476:;
+	t_abortsite_2e19 = ((u64)39UL);
+	goto L_abort_2e217;
+	L__2e483:;
+	L__2e474:;
+	t_abortsite_2e19 = ((u64)40UL);
+	goto L_abort_2e75;
+	L__2e473:;
+	*(u32 *)t_object_2e486 = (u32)((u64)3532310079UL);
+	t__2e487 = (u64)((u64)t_object_2e486 + (u64)((u64)4UL));
+	*(u32 *)t__2e487 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e490 = (u64)((u64)0UL);
+	t__2e491 = (u64)((u64)t_object_2e490 + (u64)((u64)8UL));
+	*(u64 *)t__2e491 = (u64)((u64)0UL);
+	t__2e491 = (u64)((u64)t__2e491 + (u64)((u64)8UL));
+	*(u64 *)t__2e491 = (u64)((u64)0UL);
+	BLIT((u64)B136, t_object_2e486, 8);
+	BLIT((u64)B137, ((u64)((char *)&D_strliteral_2e489)), 24);
+	BLIT((u64)B138, t_object_2e490, 24);
+	t__2e485 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R139, (u64)B136, (u64)B137, (u64)B138);
+	t_tag_2e492 = (u64)(*(u32 *)t__2e485);
+	t__2e500 = (u64)(u32)(((u32)t_tag_2e492 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e500) goto L_member_2e497; else goto L__2e499;
+	L__2e499:;
+	t__2e502 = (u64)(u32)(((u32)t_tag_2e492 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e502) goto L_member_2e498; else goto L__2e501;
+	L__2e501:;
+	goto L_matches_2e496;
+	L_member_2e497:;
+	goto L_matches_2e496;
+	L_member_2e498:;
+	goto L_matches_2e495;
+	L_matches_2e495:;
+	goto L__2e493;
+	L_matches_2e496:;
+	t_abortsite_2e19 = ((u64)41UL);
+	goto L_abort_2e217;
+	L__2e503:;
+	L__2e494:;
+	t_abortsite_2e19 = ((u64)42UL);
+	goto L_abort_2e75;
+	L__2e493:;
+	*(u32 *)t_object_2e506 = (u32)((u64)3532310079UL);
+	t__2e507 = (u64)((u64)t_object_2e506 + (u64)((u64)4UL));
+	*(u32 *)t__2e507 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e510 = (u64)((u64)0UL);
+	t__2e511 = (u64)((u64)t_object_2e510 + (u64)((u64)8UL));
+	*(u64 *)t__2e511 = (u64)((u64)0UL);
+	t__2e511 = (u64)((u64)t__2e511 + (u64)((u64)8UL));
+	*(u64 *)t__2e511 = (u64)((u64)0UL);
+	BLIT((u64)B140, t_object_2e506, 8);
+	BLIT((u64)B141, ((u64)((char *)&D_strliteral_2e509)), 24);
+	BLIT((u64)B142, t_object_2e510, 24);
+	t__2e505 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R143, (u64)B140, (u64)B141, (u64)B142);
+	t_tag_2e512 = (u64)(*(u32 *)t__2e505);
+	t__2e520 = (u64)(u32)(((u32)t_tag_2e512 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e520) goto L_member_2e517; else goto L__2e519;
+	L__2e519:;
+	t__2e522 = (u64)(u32)(((u32)t_tag_2e512 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e522) goto L_member_2e518; else goto L__2e521;
+	L__2e521:;
+	goto L_matches_2e516;
+	L_member_2e517:;
+	goto L_matches_2e516;
+	L_member_2e518:;
+	goto L_matches_2e515;
+	L_matches_2e515:;
+	goto L__2e513;
+	L_matches_2e516:;
+	t_abortsite_2e19 = ((u64)43UL);
+	goto L_abort_2e217;
+	L__2e523:;
+	L__2e514:;
+	t_abortsite_2e19 = ((u64)44UL);
+	goto L_abort_2e75;
+	L__2e513:;
+	*(u32 *)t_binding_2e524 = (u32)((u64)2206074632UL);
+	t__2e531 = (u64)((u64)t_binding_2e524 + (u64)((u64)8UL));
+	*(u64 *)t__2e531 = (u64)((u64)0UL);
+	t__2e536 = (u64)(u32)((u32)((u64)255UL) + (u32)((u64)1UL));
+	t__2e537 = (u64)(u32)((u8)t__2e536);
+	t__2e538 = (u64)(u32)((u8)((u64)1UL));
+	t__2e535 = (u64)(u32)((u32)t__2e537 >> (t__2e538 & 31));
+	t__2e539 = (u64)(u32)((u8)t__2e535);
+	t__2e540 = (u64)(u32)((u8)((u64)0UL));
+	t__2e534 = (u64)(u32)(((u32)t__2e539 == (u32)t__2e540));
+	if ((u32)t__2e534) goto L_passed_2e533; else goto L_failed_2e532;
+	L_failed_2e532:;
+	t_abortsite_2e19 = ((u64)45UL);
+	goto L_abort_2e20;
+	L_passed_2e533:;
+	*(u32 *)t_object_2e543 = (u32)((u64)3532310079UL);
+	t__2e544 = (u64)((u64)t_object_2e543 + (u64)((u64)4UL));
+	*(u32 *)t__2e544 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e547 = (u64)((u64)0UL);
+	t__2e548 = (u64)((u64)t_object_2e547 + (u64)((u64)8UL));
+	*(u64 *)t__2e548 = (u64)((u64)0UL);
+	t__2e548 = (u64)((u64)t__2e548 + (u64)((u64)8UL));
+	*(u64 *)t__2e548 = (u64)((u64)0UL);
+	BLIT((u64)B144, t_object_2e543, 8);
+	BLIT((u64)B145, ((u64)((char *)&D_strliteral_2e546)), 24);
+	BLIT((u64)B146, t_object_2e547, 24);
+	t__2e542 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R147, (u64)B144, (u64)B145, (u64)B146);
+	t_tag_2e549 = (u64)(*(u32 *)t__2e542);
+	t__2e557 = (u64)(u32)(((u32)t_tag_2e549 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e557) goto L_member_2e554; else goto L__2e556;
+	L__2e556:;
+	t__2e559 = (u64)(u32)(((u32)t_tag_2e549 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e559) goto L_member_2e555; else goto L__2e558;
+	L__2e558:;
+	goto L_matches_2e553;
+	L_member_2e554:;
+	goto L_matches_2e553;
+	L_member_2e555:;
+	goto L_matches_2e552;
+	L_matches_2e552:;
+	goto L__2e550;
+	L_matches_2e553:;
+	t_abortsite_2e19 = ((u64)46UL);
+	goto L_abort_2e217;
+	L__2e560:;
+	L__2e551:;
+	t_abortsite_2e19 = ((u64)47UL);
+	goto L_abort_2e75;
+	L__2e550:;
+	*(u32 *)t_object_2e563 = (u32)((u64)3532310079UL);
+	t__2e564 = (u64)((u64)t_object_2e563 + (u64)((u64)4UL));
+	*(u32 *)t__2e564 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e567 = (u64)((u64)0UL);
+	t__2e568 = (u64)((u64)t_object_2e567 + (u64)((u64)8UL));
+	*(u64 *)t__2e568 = (u64)((u64)0UL);
+	t__2e568 = (u64)((u64)t__2e568 + (u64)((u64)8UL));
+	*(u64 *)t__2e568 = (u64)((u64)0UL);
+	BLIT((u64)B148, t_object_2e563, 8);
+	BLIT((u64)B149, ((u64)((char *)&D_strliteral_2e566)), 24);
+	BLIT((u64)B150, t_object_2e567, 24);
+	t__2e562 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R151, (u64)B148, (u64)B149, (u64)B150);
+	t_tag_2e569 = (u64)(*(u32 *)t__2e562);
+	t__2e577 = (u64)(u32)(((u32)t_tag_2e569 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e577) goto L_member_2e574; else goto L__2e576;
+	L__2e576:;
+	t__2e579 = (u64)(u32)(((u32)t_tag_2e569 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e579) goto L_member_2e575; else goto L__2e578;
+	L__2e578:;
+	goto L_matches_2e573;
+	L_member_2e574:;
+	goto L_matches_2e573;
+	L_member_2e575:;
+	goto L_matches_2e572;
+	L_matches_2e572:;
+	goto L__2e570;
+	L_matches_2e573:;
+	t_abortsite_2e19 = ((u64)48UL);
+	goto L_abort_2e217;
+	L__2e580:;
+	L__2e571:;
+	t_abortsite_2e19 = ((u64)49UL);
+	goto L_abort_2e75;
+	L__2e570:;
+	((void (*)(void))((u64)((char *)&F_control__never)))();
+	*(u32 *)t_object_2e583 = (u32)((u64)3532310079UL);
+	t__2e584 = (u64)((u64)t_object_2e583 + (u64)((u64)4UL));
+	*(u32 *)t__2e584 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e587 = (u64)((u64)0UL);
+	t__2e588 = (u64)((u64)t_object_2e587 + (u64)((u64)8UL));
+	*(u64 *)t__2e588 = (u64)((u64)0UL);
+	t__2e588 = (u64)((u64)t__2e588 + (u64)((u64)8UL));
+	*(u64 *)t__2e588 = (u64)((u64)0UL);
+	BLIT((u64)B152, t_object_2e583, 8);
+	BLIT((u64)B153, ((u64)((char *)&D_strliteral_2e586)), 24);
+	BLIT((u64)B154, t_object_2e587, 24);
+	t__2e582 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R155, (u64)B152, (u64)B153, (u64)B154);
+	t_tag_2e589 = (u64)(*(u32 *)t__2e582);
+	t__2e597 = (u64)(u32)(((u32)t_tag_2e589 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e597) goto L_member_2e594; else goto L__2e596;
+	L__2e596:;
+	t__2e599 = (u64)(u32)(((u32)t_tag_2e589 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e599) goto L_member_2e595; else goto L__2e598;
+	L__2e598:;
+	goto L_matches_2e593;
+	L_member_2e594:;
+	goto L_matches_2e593;
+	L_member_2e595:;
+	goto L_matches_2e592;
+	L_matches_2e592:;
+	goto L__2e590;
+	L_matches_2e593:;
+	t_abortsite_2e19 = ((u64)50UL);
+	goto L_abort_2e217;
+	L__2e600:;
+	L__2e591:;
+	t_abortsite_2e19 = ((u64)51UL);
+	goto L_abort_2e75;
+	L__2e590:;
+	t_item_2e603 = (u64)((u64)t_binding_2e601 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e603 = (u8)((u64)0UL);
+	t__2e604 = (u64)((u64)t_binding_2e601 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e604, (u64)t_item_2e603, (u64)((u64)1023UL));
+	t_item_2e606 = (u64)((u64)t_binding_2e601 + (u64)((u64)0UL));
+	t__2e605 = (u64)((u64)t_binding_2e601 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e605, (u64)t_item_2e606, (u64)((u64)1023UL));
+	t__2e608 = t_binding_2e601;
+	t__2e609 = (u64)((i64)(i32)((u64)0UL));
+	t__2e610 = (u64)((u64)t__2e609 - (u64)((u64)0UL));
+	t__2e614 = (u64)(u32)(((u64)t__2e609 <= (u64)((u64)1024UL)));
+	t__2e610 = t__2e609;
+	t__2e611 = ((u64)1024UL);
+	if ((u32)t__2e614) goto L__2e616; else goto L__2e615;
+	L__2e615:;
+	t_abortsite_2e19 = ((u64)52UL);
+	goto L_abort_2e617;
+	L__2e616:;
+	t_data_2e623 = (u64)((u64)((u64)0UL) * (u64)((u64)1UL));
+	t_data_2e623 = (u64)((u64)t__2e608 + (u64)t_data_2e623);
+	*(u64 *)t_binding_2e607 = (u64)t_data_2e623;
+	t__2e625 = (u64)((u64)t_binding_2e607 + (u64)((u64)8UL));
+	*(u64 *)t__2e625 = (u64)t__2e610;
+	t__2e625 = (u64)((u64)t_binding_2e607 + (u64)((u64)16UL));
+	*(u64 *)t__2e625 = (u64)t__2e611;
+	t__2e626 = (u64)((u64)t_binding_2e607 + (u64)((u64)8UL));
+	t__2e627 = (u64)((u64)t_binding_2e607 + (u64)((u64)16UL));
+	t__2e628 = (u64)(*(u64 *)t__2e626);
+	BLIT((u64)B156, ((u64)((char *)&D_strliteral_2e631)), 24);
+	t__2e629 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R157, (u64)B156);
+	t__2e633 = (u64)((u64)t__2e629 + (u64)((u64)8UL));
+	t__2e632 = (u64)(*(u64 *)t__2e633);
+	t__2e634 = (u64)((u64)t__2e628 + (u64)t__2e632);
+	*(u64 *)t__2e626 = (u64)t__2e634;
+	t__2e636 = (u64)(*(u64 *)t__2e627);
+	t__2e639 = (u64)(u32)(((u64)t__2e634 <= (u64)t__2e636));
+	if ((u32)t__2e639) goto L__2e637; else goto L__2e638;
+	L__2e638:;
+	t_abortsite_2e19 = ((u64)53UL);
+	goto L_abort_2e617;
+	L__2e637:;
+	t__2e640 = (u64)(*(u64 *)t_binding_2e607);
+	t__2e635 = (u64)((u64)t__2e628 * (u64)((u64)1UL));
+	t__2e635 = (u64)((u64)t__2e640 + (u64)t__2e635);
+	t__2e641 = (u64)((u64)t__2e632 * (u64)((u64)1UL));
+	t__2e642 = (u64)(*(u64 *)t__2e629);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e635, (u64)t__2e642, (u64)t__2e641);
+	*(u64 *)t_binding_2e648 = (u64)((u64)0UL);
+	L_loop_2e643:;
+	t__2e650 = (u64)(*(u64 *)t_binding_2e648);
+	t__2e651 = (u64)((u64)((u64)255UL) >> (((u64)1UL) & 63));
+	t__2e649 = (u64)(u32)(((u64)t__2e650 < (u64)t__2e651));
+	if ((u32)t__2e649) goto L_body_2e644; else goto L__2e646;
+	L_body_2e644:;
+	t__2e654 = (u64)((u64)t_binding_2e607 + (u64)((u64)8UL));
+	t__2e655 = (u64)((u64)t_binding_2e607 + (u64)((u64)16UL));
+	t__2e656 = (u64)(*(u64 *)t__2e654);
+	BLIT((u64)B158, ((u64)((char *)&D_strliteral_2e659)), 24);
+	t__2e657 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R159, (u64)B158);
+	t__2e661 = (u64)((u64)t__2e657 + (u64)((u64)8UL));
+	t__2e660 = (u64)(*(u64 *)t__2e661);
+	t__2e662 = (u64)((u64)t__2e656 + (u64)t__2e660);
+	*(u64 *)t__2e654 = (u64)t__2e662;
+	t__2e664 = (u64)(*(u64 *)t__2e655);
+	t__2e667 = (u64)(u32)(((u64)t__2e662 <= (u64)t__2e664));
+	if ((u32)t__2e667) goto L__2e665; else goto L__2e666;
+	L__2e666:;
+	t_abortsite_2e19 = ((u64)54UL);
+	goto L_abort_2e617;
+	L__2e665:;
+	t__2e668 = (u64)(*(u64 *)t_binding_2e607);
+	t__2e663 = (u64)((u64)t__2e656 * (u64)((u64)1UL));
+	t__2e663 = (u64)((u64)t__2e668 + (u64)t__2e663);
+	t__2e669 = (u64)((u64)t__2e660 * (u64)((u64)1UL));
+	t__2e670 = (u64)(*(u64 *)t__2e657);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e663, (u64)t__2e670, (u64)t__2e669);
+	goto L__2e652;
+	L__2e671:;
+	L__2e652:;
+	L_after_2e647:;
+	t__2e672 = (u64)(*(u64 *)t_binding_2e648);
+	t__2e672 = (u64)((u64)t__2e672 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e648 = (u64)t__2e672;
+	goto L_loop_2e643;
+	L__2e646:;
+	t__2e674 = (u64)((u64)t_binding_2e607 + (u64)((u64)8UL));
+	t__2e675 = (u64)((u64)t_binding_2e607 + (u64)((u64)16UL));
+	t__2e676 = (u64)(*(u64 *)t__2e674);
+	*(u64 *)t_binding_2e673 = (u64)t__2e676;
+	t__2e677 = (u64)((u64)t_binding_2e607 + (u64)((u64)8UL));
+	t__2e678 = (u64)((u64)t_binding_2e607 + (u64)((u64)16UL));
+	t__2e679 = (u64)(*(u64 *)t__2e677);
+	BLIT((u64)B160, ((u64)((char *)&D_strliteral_2e682)), 24);
+	t__2e680 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R161, (u64)B160);
+	t__2e684 = (u64)((u64)t__2e680 + (u64)((u64)8UL));
+	t__2e683 = (u64)(*(u64 *)t__2e684);
+	t__2e685 = (u64)((u64)t__2e679 + (u64)t__2e683);
+	*(u64 *)t__2e677 = (u64)t__2e685;
+	t__2e687 = (u64)(*(u64 *)t__2e678);
+	t__2e690 = (u64)(u32)(((u64)t__2e685 <= (u64)t__2e687));
+	if ((u32)t__2e690) goto L__2e688; else goto L__2e689;
+	L__2e689:;
+	t_abortsite_2e19 = ((u64)55UL);
+	goto L_abort_2e617;
+	L__2e688:;
+	t__2e691 = (u64)(*(u64 *)t_binding_2e607);
+	t__2e686 = (u64)((u64)t__2e679 * (u64)((u64)1UL));
+	t__2e686 = (u64)((u64)t__2e691 + (u64)t__2e686);
+	t__2e692 = (u64)((u64)t__2e683 * (u64)((u64)1UL));
+	t__2e693 = (u64)(*(u64 *)t__2e680);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e686, (u64)t__2e693, (u64)t__2e692);
+	*(u32 *)t_object_2e696 = (u32)((u64)3532310079UL);
+	t__2e697 = (u64)((u64)t_object_2e696 + (u64)((u64)4UL));
+	*(u32 *)t__2e697 = (u32)((u64)0UL);
+	*(u64 *)t_object_2e698 = (u64)((u64)0UL);
+	t__2e699 = (u64)((u64)t_object_2e698 + (u64)((u64)8UL));
+	*(u64 *)t__2e699 = (u64)((u64)0UL);
+	t__2e699 = (u64)((u64)t__2e699 + (u64)((u64)8UL));
+	*(u64 *)t__2e699 = (u64)((u64)0UL);
+	BLIT((u64)B162, t_object_2e696, 8);
+	BLIT((u64)B163, t_binding_2e607, 24);
+	BLIT((u64)B164, t_object_2e698, 24);
+	t__2e695 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R165, (u64)B162, (u64)B163, (u64)B164);
+	t_tag_2e700 = (u64)(*(u32 *)t__2e695);
+	t__2e708 = (u64)(u32)(((u32)t_tag_2e700 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e708) goto L_member_2e705; else goto L__2e707;
+	L__2e707:;
+	t__2e710 = (u64)(u32)(((u32)t_tag_2e700 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e710) goto L_member_2e706; else goto L__2e709;
+	L__2e709:;
+	goto L_matches_2e704;
+	L_member_2e705:;
+	goto L_matches_2e704;
+	L_member_2e706:;
+	goto L_matches_2e703;
+	L_matches_2e703:;
+	goto L__2e701;
+	L_matches_2e704:;
+	t_abortsite_2e19 = ((u64)56UL);
+	goto L_abort_2e217;
+	L__2e711:;
+	L__2e702:;
+	t_abortsite_2e19 = ((u64)57UL);
+	goto L_abort_2e75;
+	L__2e701:;
+	t__2e712 = (u64)((u64)t_binding_2e607 + (u64)((u64)8UL));
+	t__2e713 = (u64)((u64)t_binding_2e607 + (u64)((u64)16UL));
+	t__2e714 = (u64)(*(u64 *)t__2e712);
+	t__2e715 = (u64)(*(u64 *)t_binding_2e673);
+	t__2e716 = (u64)(u32)(((u64)t__2e715 <= (u64)t__2e714));
+	if ((u32)t__2e716) goto L__2e718; else goto L__2e717;
+	L__2e717:;
+	t_abortsite_2e19 = ((u64)58UL);
+	goto L_abort_2e617;
+	L__2e718:;
+	BLIT((u64)B166, ((u64)((char *)&D_strliteral_2e659)), 24);
+	t__2e719 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R167, (u64)B166);
+	t__2e721 = (u64)((u64)t__2e719 + (u64)((u64)8UL));
+	t__2e720 = (u64)(*(u64 *)t__2e721);
+	t__2e722 = (u64)((u64)t__2e714 + (u64)t__2e720);
+	*(u64 *)t__2e712 = (u64)t__2e722;
+	t__2e724 = (u64)(*(u64 *)t__2e713);
+	t__2e727 = (u64)(u32)(((u64)t__2e722 <= (u64)t__2e724));
+	if ((u32)t__2e727) goto L__2e725; else goto L__2e726;
+	L__2e726:;
+	t_abortsite_2e19 = ((u64)59UL);
+	goto L_abort_2e617;
+	L__2e725:;
+	t__2e728 = (u64)(*(u64 *)t_binding_2e607);
+	t__2e723 = (u64)((u64)t__2e715 * (u64)((u64)1UL));
+	t__2e723 = (u64)((u64)t__2e728 + (u64)t__2e723);
+	t__2e729 = (u64)((u64)t__2e720 * (u64)((u64)1UL));
+	t__2e731 = (u64)((u64)t__2e714 - (u64)t__2e715);
+	t__2e731 = (u64)((u64)t__2e731 * (u64)((u64)1UL));
+	t__2e730 = (u64)((u64)t__2e723 + (u64)t__2e729);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e730, (u64)t__2e723, (u64)t__2e731);
+	t__2e732 = (u64)(*(u64 *)t__2e719);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e723, (u64)t__2e732, (u64)t__2e729);
+	*(u32 *)t_object_2e735 = (u32)((u64)3532310079UL);
+	t__2e736 = (u64)((u64)t_object_2e735 + (u64)((u64)4UL));
+	*(u32 *)t__2e736 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e737 = (u64)((u64)0UL);
+	t__2e738 = (u64)((u64)t_object_2e737 + (u64)((u64)8UL));
+	*(u64 *)t__2e738 = (u64)((u64)0UL);
+	t__2e738 = (u64)((u64)t__2e738 + (u64)((u64)8UL));
+	*(u64 *)t__2e738 = (u64)((u64)0UL);
+	BLIT((u64)B168, t_object_2e735, 8);
+	BLIT((u64)B169, t_binding_2e607, 24);
+	BLIT((u64)B170, t_object_2e737, 24);
+	t__2e734 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R171, (u64)B168, (u64)B169, (u64)B170);
+	t_tag_2e739 = (u64)(*(u32 *)t__2e734);
+	t__2e747 = (u64)(u32)(((u32)t_tag_2e739 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e747) goto L_member_2e744; else goto L__2e746;
+	L__2e746:;
+	t__2e749 = (u64)(u32)(((u32)t_tag_2e739 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e749) goto L_member_2e745; else goto L__2e748;
+	L__2e748:;
+	goto L_matches_2e743;
+	L_member_2e744:;
+	goto L_matches_2e743;
+	L_member_2e745:;
+	goto L_matches_2e742;
+	L_matches_2e742:;
+	goto L__2e740;
+	L_matches_2e743:;
+	t_abortsite_2e19 = ((u64)60UL);
+	goto L_abort_2e217;
+	L__2e750:;
+	L__2e741:;
+	t_abortsite_2e19 = ((u64)61UL);
+	goto L_abort_2e75;
+	L__2e740:;
+	t__2e754 = (u64)(*(u64 *)((u64)((char *)&D_packedsz)));
+	t__2e753 = (u64)(u32)(((u64)((u64)9UL) == (u64)t__2e754));
+	if ((u32)t__2e753) goto L_passed_2e752; else goto L_failed_2e751;
+	L_failed_2e751:;
+	t_abortsite_2e19 = ((u64)62UL);
+	goto L_abort_2e20;
+	L_passed_2e752:;
+	t__2e757 = (u64)(u32)(((u64)((u64)9UL) == (u64)((u64)9UL)));
+	if ((u32)t__2e757) goto L_passed_2e756; else goto L_failed_2e755;
+	L_failed_2e755:;
+	t_abortsite_2e19 = ((u64)63UL);
+	goto L_abort_2e20;
+	L_passed_2e756:;
+	*(u32 *)t_binding_2e758 = (u32)((u64)97UL);
+	t__2e759 = (u64)(u32)(*(u32 *)t_binding_2e758);
+	t__2e760 = (u64)((u32)t__2e759);
+	t__2e770 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e770) goto L_true_2e767; else goto L_false_2e768;
+	L_true_2e767:;
+	goto L__2e761;
+	L__2e771:;
+	L_false_2e768:;
+	L__2e769:;
+	goto L__2e764;
+	L__2e772:;
+	L__2e764:;
+	*(u64 *)t_binding_2e763 = (u64)((u64)0UL);
+	t__2e773 = (u64)((u64)t_binding_2e763 + (u64)((u64)8UL));
+	*(u64 *)t__2e773 = (u64)((u64)0UL);
+	t__2e773 = (u64)((u64)t__2e773 + (u64)((u64)8UL));
+	*(u64 *)t__2e773 = (u64)((u64)0UL);
+	t_abortsite_2e19 = ((u64)64UL);
+	goto L_abort_2e20;
+	L__2e774:;
+	L__2e761:;
+	*(u32 *)t_object_2e777 = (u32)((u64)3532310079UL);
+	t__2e778 = (u64)((u64)t_object_2e777 + (u64)((u64)4UL));
+	*(u32 *)t__2e778 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e781 = (u64)((u64)0UL);
+	t__2e782 = (u64)((u64)t_object_2e781 + (u64)((u64)8UL));
+	*(u64 *)t__2e782 = (u64)((u64)0UL);
+	t__2e782 = (u64)((u64)t__2e782 + (u64)((u64)8UL));
+	*(u64 *)t__2e782 = (u64)((u64)0UL);
+	BLIT((u64)B172, t_object_2e777, 8);
+	BLIT((u64)B173, ((u64)((char *)&D_strliteral_2e780)), 24);
+	BLIT((u64)B174, t_object_2e781, 24);
+	t__2e776 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R175, (u64)B172, (u64)B173, (u64)B174);
+	t_tag_2e783 = (u64)(*(u32 *)t__2e776);
+	t__2e791 = (u64)(u32)(((u32)t_tag_2e783 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e791) goto L_member_2e788; else goto L__2e790;
+	L__2e790:;
+	t__2e793 = (u64)(u32)(((u32)t_tag_2e783 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e793) goto L_member_2e789; else goto L__2e792;
+	L__2e792:;
+	goto L_matches_2e787;
+	L_member_2e788:;
+	goto L_matches_2e787;
+	L_member_2e789:;
+	goto L_matches_2e786;
+	L_matches_2e786:;
+	goto L__2e784;
+	L_matches_2e787:;
+	t_abortsite_2e19 = ((u64)65UL);
+	goto L_abort_2e217;
+	L__2e794:;
+	L__2e785:;
+	t_abortsite_2e19 = ((u64)66UL);
+	goto L_abort_2e75;
+	L__2e784:;
+	*(u32 *)t_object_2e797 = (u32)((u64)3532310079UL);
+	t__2e798 = (u64)((u64)t_object_2e797 + (u64)((u64)4UL));
+	*(u32 *)t__2e798 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e801 = (u64)((u64)0UL);
+	t__2e802 = (u64)((u64)t_object_2e801 + (u64)((u64)8UL));
+	*(u64 *)t__2e802 = (u64)((u64)0UL);
+	t__2e802 = (u64)((u64)t__2e802 + (u64)((u64)8UL));
+	*(u64 *)t__2e802 = (u64)((u64)0UL);
+	BLIT((u64)B176, t_object_2e797, 8);
+	BLIT((u64)B177, ((u64)((char *)&D_strliteral_2e800)), 24);
+	BLIT((u64)B178, t_object_2e801, 24);
+	t__2e796 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R179, (u64)B176, (u64)B177, (u64)B178);
+	t_tag_2e803 = (u64)(*(u32 *)t__2e796);
+	t__2e811 = (u64)(u32)(((u32)t_tag_2e803 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e811) goto L_member_2e808; else goto L__2e810;
+	L__2e810:;
+	t__2e813 = (u64)(u32)(((u32)t_tag_2e803 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e813) goto L_member_2e809; else goto L__2e812;
+	L__2e812:;
+	goto L_matches_2e807;
+	L_member_2e808:;
+	goto L_matches_2e807;
+	L_member_2e809:;
+	goto L_matches_2e806;
+	L_matches_2e806:;
+	goto L__2e804;
+	L_matches_2e807:;
+	t_abortsite_2e19 = ((u64)67UL);
+	goto L_abort_2e217;
+	L__2e814:;
+	L__2e805:;
+	t_abortsite_2e19 = ((u64)68UL);
+	goto L_abort_2e75;
+	L__2e804:;
+	t__2e821 = (u64)(u32)((u8)((u64)0UL));
+	if ((u32)t__2e821) goto L_true_2e818; else goto L_false_2e819;
+	L_true_2e818:;
+	*(u32 *)t_object_2e822 = (u32)((u64)1099590421UL);
+	t__2e823 = (u64)((u64)t_object_2e822 + (u64)((u64)4UL));
+	*(u32 *)t__2e823 = (u32)((u64)0UL);
+	t__2e817 = t_object_2e822;
+	goto L__2e820;
+	L_false_2e819:;
+	*(u32 *)t__2e817 = (u32)((u64)3012680272UL);
+	L__2e820:;
+	t__2e824 = (u64)(u32)(*(u32 *)t__2e817);
+	t_subval_2e826 = t__2e817;
+	t__2e827 = (u64)(u32)(((u32)t__2e824 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e827) goto L_subtype_2e829; else goto L_passed_2e825;
+	L_subtype_2e829:;
+	goto L_passed_2e825;
+	L_passed_2e825:;
+	if ((u32)t__2e827) goto L_passed_2e816; else goto L_failed_2e815;
+	L_failed_2e815:;
+	t_abortsite_2e19 = ((u64)69UL);
+	goto L_abort_2e20;
+	L_passed_2e816:;
+	t__2e834 = (u64)(u32)((u8)((u64)0UL));
+	if ((u32)t__2e834) goto L_true_2e831; else goto L_false_2e832;
+	L_true_2e831:;
+	*(u32 *)t_binding_2e830 = (u32)((u64)1099590421UL);
+	t__2e835 = (u64)((u64)t_binding_2e830 + (u64)((u64)4UL));
+	*(u32 *)t__2e835 = (u32)((u64)0UL);
+	goto L__2e833;
+	L_false_2e832:;
+	*(u32 *)t_binding_2e830 = (u32)((u64)3012680272UL);
+	L__2e833:;
+	t__2e838 = (u64)(u32)(*(u32 *)t_binding_2e830);
+	t_subval_2e840 = t_binding_2e830;
+	t__2e841 = (u64)(u32)(((u32)t__2e838 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e841) goto L_subtype_2e843; else goto L_passed_2e839;
+	L_subtype_2e843:;
+	goto L_passed_2e839;
+	L_passed_2e839:;
+	if ((u32)t__2e841) goto L_passed_2e837; else goto L_failed_2e836;
+	L_failed_2e836:;
+	t_abortsite_2e19 = ((u64)70UL);
+	goto L_abort_2e20;
+	L_passed_2e837:;
+	t__2e850 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e850) goto L_true_2e847; else goto L_false_2e848;
+	L_true_2e847:;
+	*(u32 *)t_object_2e851 = (u32)((u64)1099590421UL);
+	t__2e852 = (u64)((u64)t_object_2e851 + (u64)((u64)4UL));
+	*(u32 *)t__2e852 = (u32)((u64)0UL);
+	t__2e846 = t_object_2e851;
+	goto L__2e849;
+	L_false_2e848:;
+	*(u32 *)t__2e846 = (u32)((u64)3012680272UL);
+	L__2e849:;
+	t__2e853 = (u64)(u32)(*(u32 *)t__2e846);
+	t_subval_2e855 = t__2e846;
+	t__2e856 = (u64)(u32)(((u32)t__2e853 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e856) goto L_subtype_2e858; else goto L_passed_2e854;
+	L_subtype_2e858:;
+	goto L_passed_2e854;
+	L_passed_2e854:;
+	if ((u32)t__2e856) goto L_passed_2e845; else goto L_failed_2e844;
+	L_failed_2e844:;
+	t_abortsite_2e19 = ((u64)71UL);
+	goto L_abort_2e20;
+	L_passed_2e845:;
+	t__2e863 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e863) goto L_true_2e860; else goto L_false_2e861;
+	L_true_2e860:;
+	*(u32 *)t_object_2e864 = (u32)((u64)1099590421UL);
+	t__2e865 = (u64)((u64)t_object_2e864 + (u64)((u64)4UL));
+	*(u32 *)t__2e865 = (u32)((u64)0UL);
+	t__2e859 = t_object_2e864;
+	goto L__2e862;
+	L_false_2e861:;
+	*(u32 *)t__2e859 = (u32)((u64)3012680272UL);
+	L__2e862:;
+	BLIT(t_binding_2e830, t__2e859, ((u64)8UL));
+	t__2e868 = (u64)(u32)(*(u32 *)t_binding_2e830);
+	t_subval_2e870 = t_binding_2e830;
+	t__2e871 = (u64)(u32)(((u32)t__2e868 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e871) goto L_subtype_2e873; else goto L_passed_2e869;
+	L_subtype_2e873:;
+	goto L_passed_2e869;
+	L_passed_2e869:;
+	if ((u32)t__2e871) goto L_passed_2e867; else goto L_failed_2e866;
+	L_failed_2e866:;
+	t_abortsite_2e19 = ((u64)72UL);
+	goto L_abort_2e20;
+	L_passed_2e867:;
+	*(u32 *)t_object_2e876 = (u32)((u64)3532310079UL);
+	t__2e877 = (u64)((u64)t_object_2e876 + (u64)((u64)4UL));
+	*(u32 *)t__2e877 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e880 = (u64)((u64)0UL);
+	t__2e881 = (u64)((u64)t_object_2e880 + (u64)((u64)8UL));
+	*(u64 *)t__2e881 = (u64)((u64)0UL);
+	t__2e881 = (u64)((u64)t__2e881 + (u64)((u64)8UL));
+	*(u64 *)t__2e881 = (u64)((u64)0UL);
+	BLIT((u64)B180, t_object_2e876, 8);
+	BLIT((u64)B181, ((u64)((char *)&D_strliteral_2e879)), 24);
+	BLIT((u64)B182, t_object_2e880, 24);
+	t__2e875 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R183, (u64)B180, (u64)B181, (u64)B182);
+	t_tag_2e882 = (u64)(*(u32 *)t__2e875);
+	t__2e890 = (u64)(u32)(((u32)t_tag_2e882 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e890) goto L_member_2e887; else goto L__2e889;
+	L__2e889:;
+	t__2e892 = (u64)(u32)(((u32)t_tag_2e882 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e892) goto L_member_2e888; else goto L__2e891;
+	L__2e891:;
+	goto L_matches_2e886;
+	L_member_2e887:;
+	goto L_matches_2e886;
+	L_member_2e888:;
+	goto L_matches_2e885;
+	L_matches_2e885:;
+	goto L__2e883;
+	L_matches_2e886:;
+	t_abortsite_2e19 = ((u64)73UL);
+	goto L_abort_2e217;
+	L__2e893:;
+	L__2e884:;
+	t_abortsite_2e19 = ((u64)74UL);
+	goto L_abort_2e75;
+	L__2e883:;
+	goto L__2e4;
+	L__2e894:;
+	L__2e4:;
+	return;
+	L_abort_2e20:;
+	t__2e21 = (u64)((u64)t_abortsite_2e19 * (u64)((u64)16UL));
+	t__2e21 = (u64)((u64)((u64)((char *)&D_abortsites_2e18)) + (u64)t__2e21);
+	t__2e22 = (u64)(*(u64 *)t__2e21);
+	t__2e23 = (u64)((u64)t__2e21 + (u64)((u64)8UL));
+	t__2e24 = (u64)(*(u32 *)t__2e23);
+	t__2e23 = (u64)((u64)t__2e21 + (u64)((u64)12UL));
+	t__2e25 = (u64)(*(u32 *)t__2e23);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e22, (u64)t__2e24, (u64)t__2e25, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e75:;
+	t__2e76 = (u64)((u64)t_abortsite_2e19 * (u64)((u64)16UL));
+	t__2e76 = (u64)((u64)((u64)((char *)&D_abortsites_2e18)) + (u64)t__2e76);
+	t__2e77 = (u64)(*(u64 *)t__2e76);
+	t__2e78 = (u64)((u64)t__2e76 + (u64)((u64)8UL));
+	t__2e79 = (u64)(*(u32 *)t__2e78);
+	t__2e78 = (u64)((u64)t__2e76 + (u64)((u64)12UL));
+	t__2e80 = (u64)(*(u32 *)t__2e78);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e77, (u64)t__2e79, (u64)t__2e80, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e217:;
+	t__2e218 = (u64)((u64)t_abortsite_2e19 * (u64)((u64)16UL));
+	t__2e218 = (u64)((u64)((u64)((char *)&D_abortsites_2e18)) + (u64)t__2e218);
+	t__2e219 = (u64)(*(u64 *)t__2e218);
+	t__2e220 = (u64)((u64)t__2e218 + (u64)((u64)8UL));
+	t__2e221 = (u64)(*(u32 *)t__2e220);
+	t__2e220 = (u64)((u64)t__2e218 + (u64)((u64)12UL));
+	t__2e222 = (u64)(*(u32 *)t__2e220);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e219, (u64)t__2e221, (u64)t__2e222, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e617:;
+	t__2e618 = (u64)((u64)t_abortsite_2e19 * (u64)((u64)16UL));
+	t__2e618 = (u64)((u64)((u64)((char *)&D_abortsites_2e18)) + (u64)t__2e618);
+	t__2e619 = (u64)(*(u64 *)t__2e618);
+	t__2e620 = (u64)((u64)t__2e618 + (u64)((u64)8UL));
+	t__2e621 = (u64)(*(u32 *)t__2e620);
+	t__2e620 = (u64)((u64)t__2e618 + (u64)((u64)12UL));
+	t__2e622 = (u64)(*(u32 *)t__2e620);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e619, (u64)t__2e621, (u64)t__2e622, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_control__never(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[1] __attribute__((aligned(16)));
+	char A4[4] __attribute__((aligned(16)));
+	char A5[1] __attribute__((aligned(16)));
+	char R6[8] __attribute__((aligned(16)));
+	char R7[8] __attribute__((aligned(16)));
+	u64 t__2e1000;
+	u64 t__2e1004;
+	u64 t__2e1005;
+	u64 t__2e1006;
+	u64 t__2e1007;
+	u64 t__2e1008;
+	u64 t__2e1009;
+	u64 t__2e1010;
+	u64 t__2e1011;
+	u64 t__2e1012;
+	u64 t__2e1016;
+	u64 t__2e1019;
+	u64 t__2e905;
+	u64 t__2e906;
+	u64 t__2e910;
+	u64 t__2e911;
+	u64 t__2e912;
+	u64 t__2e913;
+	u64 t__2e914;
+	u64 t__2e916;
+	u64 t__2e921;
+	u64 t__2e922;
+	u64 t__2e924;
+	u64 t__2e930;
+	u64 t__2e931;
+	u64 t__2e939;
+	u64 t__2e944;
+	u64 t__2e945;
+	u64 t__2e955;
+	u64 t__2e959;
+	u64 t__2e960;
+	u64 t__2e967;
+	u64 t__2e968;
+	u64 t__2e976;
+	u64 t__2e978;
+	u64 t__2e985;
+	u64 t__2e994;
+	u64 t__2e995;
+	u64 t__2e996;
+	u64 t_abortsite_2e908;
+	u64 t_binding_2e899;
+	u64 t_binding_2e925;
+	u64 t_binding_2e953;
+	u64 t_binding_2e977;
+	u64 t_binding_2e988;
+	u64 t_binding_2e991;
+	u64 t_subval_2e1015;
+	u64 t_subval_2e999;
+	L_start_2e895:;
+	t_binding_2e899 = (u64)A0;
+	t_binding_2e925 = (u64)A1;
+	t_binding_2e953 = (u64)A2;
+	t_binding_2e977 = (u64)A3;
+	t_binding_2e988 = (u64)A4;
+	t_binding_2e991 = (u64)A5;
+	L_body_2e896:;
+	*(u32 *)t_binding_2e899 = (u32)((u64)0UL);
+	goto L__2e900;
+	L__2e901:;
+	L__2e902:;
+	L__2e900:;
+	t__2e906 = (u64)(u32)(*(i32 *)t_binding_2e899);
+	t__2e905 = (u64)(u32)(((u32)t__2e906 == (u32)((u64)0UL)));
+	if ((u32)t__2e905) goto L_passed_2e904; else goto L_failed_2e903;
+	L_failed_2e903:;
+	t_abortsite_2e908 = ((u64)0UL);
+	goto L_abort_2e909;
+	L_passed_2e904:;
+	t__2e916 = (u64)(u32)((u64)1UL);
+	goto L__2e915;
+	L__2e917:;
+	L__2e918:;
+	L__2e915:;
+	*(u32 *)t_binding_2e899 = (u32)t__2e916;
+	t__2e922 = (u64)(u32)(*(i32 *)t_binding_2e899);
+	t__2e921 = (u64)(u32)(((u32)t__2e922 == (u32)((u64)1UL)));
+	if ((u32)t__2e921) goto L_passed_2e920; else goto L_failed_2e919;
+	L_failed_2e919:;
+	t_abortsite_2e908 = ((u64)1UL);
+	goto L_abort_2e909;
+	L_passed_2e920:;
+	t__2e924 = (u64)(u32)((u64)2UL);
+	goto L__2e923;
+	L__2e926:;
+	t_abortsite_2e908 = ((u64)2UL);
+	goto L_abort_2e909;
+	L__2e927:;
+	L__2e923:;
+	*(u32 *)t_binding_2e899 = (u32)t__2e924;
+	t__2e931 = (u64)(u32)(*(i32 *)t_binding_2e899);
+	t__2e930 = (u64)(u32)(((u32)t__2e931 == (u32)((u64)2UL)));
+	if ((u32)t__2e930) goto L_passed_2e929; else goto L_failed_2e928;
+	L_failed_2e928:;
+	t_abortsite_2e908 = ((u64)3UL);
+	goto L_abort_2e909;
+	L_passed_2e929:;
+	L_loop_2e934:;
+	if ((u32)((u64)1UL)) goto L_body_2e935; else goto L__2e937;
+	L_body_2e935:;
+	t__2e939 = (u64)(u32)(*(i32 *)t_binding_2e899);
+	t__2e939 = (u64)(u32)((u32)t__2e939 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e899 = (u32)t__2e939;
+	L_after_2e938:;
+	goto L__2e932;
+	L__2e940:;
+	goto L_loop_2e934;
+	L__2e937:;
+	L__2e941:;
+	L__2e932:;
+	t__2e945 = (u64)(u32)(*(i32 *)t_binding_2e899);
+	t__2e944 = (u64)(u32)(((u32)t__2e945 == (u32)((u64)3UL)));
+	if ((u32)t__2e944) goto L_passed_2e943; else goto L_failed_2e942;
+	L_failed_2e942:;
+	t_abortsite_2e908 = ((u64)4UL);
+	goto L_abort_2e909;
+	L_passed_2e943:;
+	goto L__2e946;
+	L__2e954:;
+	L_loop_2e948:;
+	if ((u32)((u64)1UL)) goto L_body_2e949; else goto L__2e951;
+	L_body_2e949:;
+	t__2e955 = (u64)(u32)(*(i32 *)t_binding_2e899);
+	t__2e955 = (u64)(u32)((u32)t__2e955 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e899 = (u32)t__2e955;
+	L_after_2e952:;
+	goto L_loop_2e948;
+	L__2e951:;
+	L__2e956:;
+	L__2e946:;
+	t__2e960 = (u64)(u32)(*(i32 *)t_binding_2e899);
+	t__2e959 = (u64)(u32)(((u32)t__2e960 == (u32)((u64)3UL)));
+	if ((u32)t__2e959) goto L_passed_2e958; else goto L_failed_2e957;
+	L_failed_2e957:;
+	t_abortsite_2e908 = ((u64)5UL);
+	goto L_abort_2e909;
+	L_passed_2e958:;
+	goto L__2e961;
+	L__2e963:;
+	*(u32 *)t_binding_2e899 = (u32)((u64)4UL);
+	goto L__2e961;
+	L__2e964:;
+	L__2e961:;
+	t__2e968 = (u64)(u32)(*(i32 *)t_binding_2e899);
+	t__2e967 = (u64)(u32)(((u32)t__2e968 == (u32)((u64)3UL)));
+	if ((u32)t__2e967) goto L_passed_2e966; else goto L_failed_2e965;
+	L_failed_2e965:;
+	t_abortsite_2e908 = ((u64)6UL);
+	goto L_abort_2e909;
+	L_passed_2e966:;
+	goto L__2e969;
+	L__2e971:;
+	t_abortsite_2e908 = ((u64)7UL);
+	goto L_abort_2e909;
+	L__2e972:;
+	L__2e969:;
+	*(u8 *)t_binding_2e977 = (u8)((u64)1UL);
+	t__2e978 = (u64)(u32)(*(u8 *)t_binding_2e977);
+	t__2e976 = (u64)(u32)t__2e978;
+	goto L__2e975;
+	L__2e979:;
+	t_abortsite_2e908 = ((u64)8UL);
+	goto L_abort_2e909;
+	L__2e980:;
+	L__2e975:;
+	if ((u32)t__2e976) goto L_passed_2e974; else goto L_failed_2e973;
+	L_failed_2e973:;
+	t_abortsite_2e908 = ((u64)9UL);
+	goto L_abort_2e909;
+	L_passed_2e974:;
+	t__2e985 = (u64)(u32)((u8)((u64)0UL));
+	if ((u32)t__2e985) goto L_true_2e982; else goto L_false_2e983;
+	L_true_2e982:;
+	t_abortsite_2e908 = ((u64)10UL);
+	goto L_abort_2e909;
+	L__2e989:;
+	t_abortsite_2e908 = ((u64)11UL);
+	goto L_abort_2e909;
+	L__2e990:;
+	*(u8 *)t_binding_2e991 = (u8)((u64)1UL);
+	t_abortsite_2e908 = ((u64)12UL);
+	goto L_abort_2e909;
+	L__2e992:;
+	goto L__2e986;
+	L__2e993:;
+	L__2e986:;
+	goto L__2e984;
+	L_false_2e983:;
+	L__2e984:;
+	t__2e994 = ((u64 (*)(u64))((u64)((char *)&F_control__never1)))((u64)R6);
+	t__2e995 = t__2e994;
+	t__2e996 = (u64)(u32)(*(u32 *)t__2e994);
+	t_subval_2e999 = t__2e994;
+	t__2e1000 = (u64)(u32)(((u32)t__2e996 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1000) goto L_subtype_2e1002; else goto L_failed_2e998;
+	L_subtype_2e1002:;
+	goto L_passed_2e997;
+	L_failed_2e998:;
+	t_abortsite_2e908 = ((u64)13UL);
+	goto L_abort_2e1003;
+	L_passed_2e997:;
+	t__2e995 = (u64)((u64)t__2e995 + (u64)((u64)4UL));
+	t__2e1009 = (u64)(u32)(*(i32 *)t__2e995);
+	t__2e1010 = ((u64 (*)(u64))((u64)((char *)&F_control__never2)))((u64)R7);
+	t__2e1011 = t__2e1010;
+	t__2e1012 = (u64)(u32)(*(u32 *)t__2e1010);
+	t_subval_2e1015 = t__2e1010;
+	t__2e1016 = (u64)(u32)(((u32)t__2e1012 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e1016) goto L_subtype_2e1018; else goto L_failed_2e1014;
+	L_subtype_2e1018:;
+	goto L_passed_2e1013;
+	L_failed_2e1014:;
+	t_abortsite_2e908 = ((u64)14UL);
+	goto L_abort_2e1003;
+	L_passed_2e1013:;
+	t__2e1011 = (u64)((u64)t__2e1011 + (u64)((u64)4UL));
+	t__2e1019 = (u64)(u32)(*(i32 *)t__2e1011);
+	goto L__2e897;
+	L__2e1020:;
+	L__2e897:;
+	return;
+	L_abort_2e909:;
+	t__2e910 = (u64)((u64)t_abortsite_2e908 * (u64)((u64)16UL));
+	t__2e910 = (u64)((u64)((u64)((char *)&D_abortsites_2e907)) + (u64)t__2e910);
+	t__2e911 = (u64)(*(u64 *)t__2e910);
+	t__2e912 = (u64)((u64)t__2e910 + (u64)((u64)8UL));
+	t__2e913 = (u64)(*(u32 *)t__2e912);
+	t__2e912 = (u64)((u64)t__2e910 + (u64)((u64)12UL));
+	t__2e914 = (u64)(*(u32 *)t__2e912);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e911, (u64)t__2e913, (u64)t__2e914, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e1003:;
+	t__2e1004 = (u64)((u64)t_abortsite_2e908 * (u64)((u64)16UL));
+	t__2e1004 = (u64)((u64)((u64)((char *)&D_abortsites_2e907)) + (u64)t__2e1004);
+	t__2e1005 = (u64)(*(u64 *)t__2e1004);
+	t__2e1006 = (u64)((u64)t__2e1004 + (u64)((u64)8UL));
+	t__2e1007 = (u64)(*(u32 *)t__2e1006);
+	t__2e1006 = (u64)((u64)t__2e1004 + (u64)((u64)12UL));
+	t__2e1008 = (u64)(*(u32 *)t__2e1006);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1005, (u64)t__2e1007, (u64)t__2e1008, (u64)((u64)1UL));
+	__builtin_trap();
+}
+static u64 F_control__never2(u64 __rp) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e1028;
+	u64 t_object_2e1027;
+	L_start_2e1021:;
+	t_object_2e1027 = (u64)A0;
+	L_body_2e1022:;
+	*(u32 *)t_object_2e1027 = (u32)((u64)1099590421UL);
+	t__2e1028 = (u64)((u64)t_object_2e1027 + (u64)((u64)4UL));
+	*(u32 *)t__2e1028 = (u32)((u64)0UL);
+	BLIT(__rp, t_object_2e1027, 8); return __rp;
+	L__2e1029:;
+	L__2e1030:;
+	L__2e1025:;
+	L__2e1031:;
+	L__2e1023:;
+	L__2e1032:;
+	return 0;
+}
+static u64 F_control__never1(u64 __rp) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e1038;
+	u64 t_object_2e1037;
+	L_start_2e1033:;
+	t_object_2e1037 = (u64)A0;
+	L_body_2e1034:;
+	*(u32 *)t_object_2e1037 = (u32)((u64)1099590421UL);
+	t__2e1038 = (u64)((u64)t_object_2e1037 + (u64)((u64)4UL));
+	*(u32 *)t__2e1038 = (u32)((u64)0UL);
+	BLIT(__rp, t_object_2e1037, 8); return __rp;
+	L__2e1039:;
+	L__2e1040:;
+	L__2e1035:;
+	L__2e1041:;
+	return 0;
+}
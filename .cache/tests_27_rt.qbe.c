@@ -0,0 +1,2393 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort[] __asm__("rt.abort");
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+extern char X_rt_2ememmove[] __asm__("rt.memmove");
+extern char X_rt_2ememset[] __asm__("rt.memset");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e94 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; };
+struct __attribute__((packed)) S_abortsites_2e241 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; };
+struct __attribute__((packed)) S_strdata_2e390 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[5]; u8 f9; u8 f10; u8 f11; u8 f12[2]; };
+struct __attribute__((packed)) S_strliteral_2e391 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e426 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[23]; u8 f9; u8 f10; u8 f11; u8 f12[2]; };
+struct __attribute__((packed)) S_strliteral_2e427 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e407 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_strdata_2e448 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e449 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e492 { u8 f0[29]; };
+struct __attribute__((packed)) S_strliteral_2e493 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e494 { u8 f0[35]; };
+struct __attribute__((packed)) S_strliteral_2e495 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e496 { u8 f0[36]; };
+struct __attribute__((packed)) S_strliteral_2e497 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e498 { u8 f0[42]; };
+struct __attribute__((packed)) S_strliteral_2e499 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e500 { u8 f0[50]; };
+struct __attribute__((packed)) S_strliteral_2e501 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e502 { u8 f0[24]; u8 f1; u8 f2[3]; u8 f3; u8 f4[28]; };
+struct __attribute__((packed)) S_strliteral_2e503 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e504 { u8 f0[21]; };
+struct __attribute__((packed)) S_strliteral_2e505 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e554 { u8 f0[27]; };
+struct __attribute__((packed)) S_strliteral_2e555 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e481 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; };
+struct __attribute__((packed)) S_global { u32 f0; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e94 D_abortsites_2e94 __asm__("abortsites.94") __attribute__((used, section(".data.rel.ro.abortsites.94"), aligned(8)));
+static struct S_abortsites_2e241 D_abortsites_2e241 __asm__("abortsites.241") __attribute__((used, section(".data.rel.ro.abortsites.241"), aligned(8)));
+static const struct S_strdata_2e390 D_strdata_2e390 __asm__("strdata.390") __attribute__((used, section(".rodata.strdata.390"), aligned(8)));
+static struct S_strliteral_2e391 D_strliteral_2e391 __asm__("strliteral.391") __attribute__((used, section(".data.rel.ro.strliteral.391"), aligned(8)));
+static const struct S_strdata_2e426 D_strdata_2e426 __asm__("strdata.426") __attribute__((used, section(".rodata.strdata.426"), aligned(8)));
+static struct S_strliteral_2e427 D_strliteral_2e427 __asm__("strliteral.427") __attribute__((used, section(".data.rel.ro.strliteral.427"), aligned(8)));
+static struct S_abortsites_2e407 D_abortsites_2e407 __asm__("abortsites.407") __attribute__((used, section(".data.rel.ro.abortsites.407"), aligned(8)));
+static const struct S_strdata_2e448 D_strdata_2e448 __asm__("strdata.448") __attribute__((used, section(".rodata.strdata.448"), aligned(8)));
+static struct S_strliteral_2e449 D_strliteral_2e449 __asm__("strliteral.449") __attribute__((used, section(".data.rel.ro.strliteral.449"), aligned(8)));
+static const struct S_strdata_2e492 D_strdata_2e492 __asm__("strdata.492") __attribute__((used, section(".rodata.strdata.492"), aligned(8)));
+static struct S_strliteral_2e493 D_strliteral_2e493 __asm__("strliteral.493") __attribute__((used, section(".data.rel.ro.strliteral.493"), aligned(8)));
+static const struct S_strdata_2e494 D_strdata_2e494 __asm__("strdata.494") __attribute__((used, section(".rodata.strdata.494"), aligned(8)));
+static struct S_strliteral_2e495 D_strliteral_2e495 __asm__("strliteral.495") __attribute__((used, section(".data.rel.ro.strliteral.495"), aligned(8)));
+static const struct S_strdata_2e496 D_strdata_2e496 __asm__("strdata.496") __attribute__((used, section(".rodata.strdata.496"), aligned(8)));
+static struct S_strliteral_2e497 D_strliteral_2e497 __asm__("strliteral.497") __attribute__((used, section(".data.rel.ro.strliteral.497"), aligned(8)));
+static const struct S_strdata_2e498 D_strdata_2e498 __asm__("strdata.498") __attribute__((used, section(".rodata.strdata.498"), aligned(8)));
+static struct S_strliteral_2e499 D_strliteral_2e499 __asm__("strliteral.499") __attribute__((used, section(".data.rel.ro.strliteral.499"), aligned(8)));
+static const struct S_strdata_2e500 D_strdata_2e500 __asm__("strdata.500") __attribute__((used, section(".rodata.strdata.500"), aligned(8)));
+static struct S_strliteral_2e501 D_strliteral_2e501 __asm__("strliteral.501") __attribute__((used, section(".data.rel.ro.strliteral.501"), aligned(8)));
+static const struct S_strdata_2e502 D_strdata_2e502 __asm__("strdata.502") __attribute__((used, section(".rodata.strdata.502"), aligned(8)));
+static struct S_strliteral_2e503 D_strliteral_2e503 __asm__("strliteral.503") __attribute__((used, section(".data.rel.ro.strliteral.503"), aligned(8)));
+static const struct S_strdata_2e504 D_strdata_2e504 __asm__("strdata.504") __attribute__((used, section(".rodata.strdata.504"), aligned(8)));
+static struct S_strliteral_2e505 D_strliteral_2e505 __asm__("strliteral.505") __attribute__((used, section(".data.rel.ro.strliteral.505"), aligned(8)));
+static const struct S_strdata_2e554 D_strdata_2e554 __asm__("strdata.554") __attribute__((used, section(".rodata.strdata.554"), aligned(8)));
+static struct S_strliteral_2e555 D_strliteral_2e555 __asm__("strliteral.555") __attribute__((used, section(".data.rel.ro.strliteral.555"), aligned(8)));
+static struct S_abortsites_2e481 D_abortsites_2e481 __asm__("abortsites.481") __attribute__((used, section(".data.rel.ro.abortsites.481"), aligned(8)));
+static struct S_global D_global __asm__("global") __attribute__((used, section(".bss.global"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_memory(void) __asm__("memory") __attribute__((used, section(".text.memory")));
+static void F_move(u64 p_n, u64 p_off) __asm__("move") __attribute__((used, section(".text.move")));
+static void F_pattern(u64 p_buf) __asm__("pattern") __attribute__((used, section(".text.pattern")));
+static void F_copy(u64 p_n, u64 p_so, u64 p_do) __asm__("copy") __attribute__((used, section(".text.copy")));
+static void F_compile(void) __asm__("compile") __attribute__((used, section(".text.compile")));
+static void F_assert__(void) __asm__("assert_") __attribute__((used, section(".text.assert_")));
+static u64 F_foofn(u64 __rp) __asm__("foofn") __attribute__((used, section(".text.foofn")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\062\067\055\162\164\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 14U, 14U };
+static struct S_abortsites_2e94 D_abortsites_2e94 = { (char *)((char *)&D_strliteral_2e1) + 0, 114U, 25U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 44U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 120U, 34U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 38U, (char *)((char *)&D_strliteral_2e1) + 0, 122U, 23U };
+static struct S_abortsites_2e241 D_abortsites_2e241 = { (char *)((char *)&D_strliteral_2e1) + 0, 90U, 25U, (char *)((char *)&D_strliteral_2e1) + 0, 90U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 93U, 31U, (char *)((char *)&D_strliteral_2e1) + 0, 95U, 46U, (char *)((char *)&D_strliteral_2e1) + 0, 95U, 31U, (char *)((char *)&D_strliteral_2e1) + 0, 99U, 25U, (char *)((char *)&D_strliteral_2e1) + 0, 102U, 31U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 31U };
+static const struct S_strdata_2e390 D_strdata_2e390 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\166\157\151\144\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e391 D_strliteral_2e391 = { (char *)((char *)&D_strdata_2e390) + 0, 35U, 35U };
+static const struct S_strdata_2e426 D_strdata_2e426 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\141\072\040\151\156\164\040\075\040\133\061\054\040\062\054\040\063\135\073", 10U, 9U, 9U, "\175\073" };
+static struct S_strliteral_2e427 D_strliteral_2e427 = { (char *)((char *)&D_strdata_2e426) + 0, 53U, 53U };
+static struct S_abortsites_2e407 D_abortsites_2e407 = { (char *)((char *)&D_strliteral_2e1) + 0, 10U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 10U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 15U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 15U, 11U };
+static const struct S_strdata_2e448 D_strdata_2e448 = { "\146\157\157" };
+static struct S_strliteral_2e449 D_strliteral_2e449 = { (char *)((char *)&D_strdata_2e448) + 0, 3U, 3U };
+static const struct S_strdata_2e492 D_strdata_2e492 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\141\163\163\145\162\164\050\065\051\073\040\175\073" };
+static struct S_strliteral_2e493 D_strliteral_2e493 = { (char *)((char *)&D_strdata_2e492) + 0, 29U, 29U };
+static const struct S_strdata_2e494 D_strdata_2e494 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\141\163\163\145\162\164\050\164\162\165\145\054\040\065\051\073\040\175\073" };
+static struct S_strliteral_2e495 D_strliteral_2e495 = { (char *)((char *)&D_strdata_2e494) + 0, 35U, 35U };
+static const struct S_strdata_2e496 D_strdata_2e496 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\163\164\141\164\151\143\040\141\163\163\145\162\164\050\065\051\073\040\175\073" };
+static struct S_strliteral_2e497 D_strliteral_2e497 = { (char *)((char *)&D_strdata_2e496) + 0, 36U, 36U };
+static const struct S_strdata_2e498 D_strdata_2e498 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\163\164\141\164\151\143\040\141\163\163\145\162\164\050\164\162\165\145\054\040\065\051\073\040\175\073" };
+static struct S_strliteral_2e499 D_strliteral_2e499 = { (char *)((char *)&D_strdata_2e498) + 0, 42U, 42U };
+static const struct S_strdata_2e500 D_strdata_2e500 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040\164\162\165\145\073\040\163\164\141\164\151\143\040\141\163\163\145\162\164\050\141\051\073\040\175\073" };
+static struct S_strliteral_2e501 D_strliteral_2e501 = { (char *)((char *)&D_strdata_2e500) + 0, 50U, 50U };
+static const struct S_strdata_2e502 D_strdata_2e502 = { "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\141\040\075\040", 34U, "\146\157\157", 34U, "\073\040\163\164\141\164\151\143\040\141\163\163\145\162\164\050\164\162\165\145\054\040\141\051\073\040\175\073" };
+static struct S_strliteral_2e503 D_strliteral_2e503 = { (char *)((char *)&D_strdata_2e502) + 0, 57U, 57U };
+static const struct S_strdata_2e504 D_strdata_2e504 = { "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\146\141\154\163\145\051\073" };
+static struct S_strliteral_2e505 D_strliteral_2e505 = { (char *)((char *)&D_strdata_2e504) + 0, 21U, 21U };
+static const struct S_strdata_2e554 D_strdata_2e554 = { "\145\170\160\157\162\164\040\163\164\141\164\151\143\040\141\163\163\145\162\164\050\164\162\165\145\051\073" };
+static struct S_strliteral_2e555 D_strliteral_2e555 = { (char *)((char *)&D_strdata_2e554) + 0, 27U, 27U };
+static struct S_abortsites_2e481 D_abortsites_2e481 = { (char *)((char *)&D_strliteral_2e1) + 0, 55U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 73U, 61U, (char *)((char *)&D_strliteral_2e1) + 0, 73U, 61U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 71U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 71U };
+static struct S_global D_global = { 0U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_assert__)))();
+	((void (*)(void))((u64)((char *)&F_compile)))();
+	((void (*)(void))((u64)((char *)&F_memory)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_memory(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	u64 t__2e17;
+	u64 t__2e18;
+	u64 t__2e27;
+	u64 t__2e28;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e45;
+	u64 t__2e47;
+	u64 t__2e54;
+	u64 t__2e55;
+	u64 t__2e58;
+	u64 t__2e59;
+	u64 t__2e61;
+	u64 t__2e63;
+	u64 t_binding_2e16;
+	u64 t_binding_2e26;
+	u64 t_binding_2e36;
+	u64 t_binding_2e53;
+	L_start_2e7:;
+	t_binding_2e16 = (u64)A0;
+	t_binding_2e26 = (u64)A1;
+	t_binding_2e36 = (u64)A2;
+	t_binding_2e53 = (u64)A3;
+	L_body_2e8:;
+	*(u64 *)t_binding_2e16 = (u64)((u64)0UL);
+	L_loop_2e11:;
+	t__2e18 = (u64)(*(u64 *)t_binding_2e16);
+	t__2e17 = (u64)(u32)(((u64)t__2e18 < (u64)((u64)72UL)));
+	if ((u32)t__2e17) goto L_body_2e12; else goto L__2e14;
+	L_body_2e12:;
+	*(u64 *)t_binding_2e26 = (u64)((u64)0UL);
+	L_loop_2e21:;
+	t__2e28 = (u64)(*(u64 *)t_binding_2e26);
+	t__2e27 = (u64)(u32)(((u64)t__2e28 < (u64)((u64)8UL)));
+	if ((u32)t__2e27) goto L_body_2e22; else goto L__2e24;
+	L_body_2e22:;
+	*(u64 *)t_binding_2e36 = (u64)((u64)0UL);
+	L_loop_2e31:;
+	t__2e38 = (u64)(*(u64 *)t_binding_2e36);
+	t__2e37 = (u64)(u32)(((u64)t__2e38 < (u64)((u64)8UL)));
+	if ((u32)t__2e37) goto L_body_2e32; else goto L__2e34;
+	L_body_2e32:;
+	t__2e41 = (u64)(*(u64 *)t_binding_2e16);
+	t__2e42 = (u64)(*(u64 *)t_binding_2e26);
+	t__2e43 = (u64)(*(u64 *)t_binding_2e36);
+	((void (*)(u64, u64, u64))((u64)((char *)&F_copy)))((u64)t__2e41, (u64)t__2e42, (u64)t__2e43);
+	goto L__2e39;
+	L__2e44:;
+	L__2e39:;
+	L_after_2e35:;
+	t__2e45 = (u64)(*(u64 *)t_binding_2e36);
+	t__2e45 = (u64)((u64)t__2e45 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e36 = (u64)t__2e45;
+	goto L_loop_2e31;
+	L__2e34:;
+	goto L__2e29;
+	L__2e46:;
+	L__2e29:;
+	L_after_2e25:;
+	t__2e47 = (u64)(*(u64 *)t_binding_2e26);
+	t__2e47 = (u64)((u64)t__2e47 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e26 = (u64)t__2e47;
+	goto L_loop_2e21;
+	L__2e24:;
+	*(u64 *)t_binding_2e53 = (u64)((u64)1UL);
+	L_loop_2e48:;
+	t__2e55 = (u64)(*(u64 *)t_binding_2e53);
+	t__2e54 = (u64)(u32)(((u64)t__2e55 < (u64)((u64)20UL)));
+	if ((u32)t__2e54) goto L_body_2e49; else goto L__2e51;
+	L_body_2e49:;
+	t__2e58 = (u64)(*(u64 *)t_binding_2e16);
+	t__2e59 = (u64)(*(u64 *)t_binding_2e53);
+	((void (*)(u64, u64))((u64)((char *)&F_move)))((u64)t__2e58, (u64)t__2e59);
+	goto L__2e56;
+	L__2e60:;
+	L__2e56:;
+	L_after_2e52:;
+	t__2e61 = (u64)(*(u64 *)t_binding_2e53);
+	t__2e61 = (u64)((u64)t__2e61 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e53 = (u64)t__2e61;
+	goto L_loop_2e48;
+	L__2e51:;
+	goto L__2e19;
+	L__2e62:;
+	L__2e19:;
+	L_after_2e15:;
+	t__2e63 = (u64)(*(u64 *)t_binding_2e16);
+	t__2e63 = (u64)((u64)t__2e63 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e16 = (u64)t__2e63;
+	goto L_loop_2e11;
+	L__2e14:;
+	goto L__2e9;
+	L__2e64:;
+	L__2e9:;
+	return;
+}
+static void F_move(u64 p_n, u64 p_off) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[128] __attribute__((aligned(16)));
+	char A3[128] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e101;
+	u64 t__2e102;
+	u64 t__2e103;
+	u64 t__2e104;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e113;
+	u64 t__2e118;
+	u64 t__2e119;
+	u64 t__2e120;
+	u64 t__2e121;
+	u64 t__2e122;
+	u64 t__2e123;
+	u64 t__2e126;
+	u64 t__2e127;
+	u64 t__2e128;
+	u64 t__2e129;
+	u64 t__2e132;
+	u64 t__2e133;
+	u64 t__2e134;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e139;
+	u64 t__2e140;
+	u64 t__2e142;
+	u64 t__2e144;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e147;
+	u64 t__2e148;
+	u64 t__2e149;
+	u64 t__2e152;
+	u64 t__2e159;
+	u64 t__2e160;
+	u64 t__2e161;
+	u64 t__2e166;
+	u64 t__2e167;
+	u64 t__2e168;
+	u64 t__2e169;
+	u64 t__2e172;
+	u64 t__2e173;
+	u64 t__2e174;
+	u64 t__2e175;
+	u64 t__2e176;
+	u64 t__2e177;
+	u64 t__2e180;
+	u64 t__2e181;
+	u64 t__2e182;
+	u64 t__2e184;
+	u64 t__2e74;
+	u64 t__2e75;
+	u64 t__2e77;
+	u64 t__2e80;
+	u64 t__2e81;
+	u64 t__2e83;
+	u64 t__2e86;
+	u64 t__2e88;
+	u64 t__2e89;
+	u64 t__2e90;
+	u64 t__2e91;
+	u64 t__2e97;
+	u64 t__2e98;
+	u64 t__2e99;
+	u64 t_abortsite_2e95;
+	u64 t_binding_2e110;
+	u64 t_binding_2e158;
+	u64 t_binding_2e71;
+	u64 t_binding_2e78;
+	u64 t_item_2e73;
+	u64 t_item_2e76;
+	u64 t_item_2e79;
+	u64 t_item_2e82;
+	u64 t_n;
+	u64 t_object_2e143;
+	u64 t_object_2e84;
+	u64 t_object_2e87;
+	u64 t_off;
+	u64 t_param_2e66;
+	u64 t_param_2e67;
+	t_n = (u64)p_n;
+	t_off = (u64)p_off;
+	L_start_2e65:;
+	t_param_2e66 = (u64)A0;
+	t_param_2e67 = (u64)A1;
+	t_binding_2e71 = (u64)A2;
+	t_binding_2e78 = (u64)A3;
+	t_object_2e84 = (u64)A4;
+	t_object_2e87 = (u64)A5;
+	t_binding_2e110 = (u64)A6;
+	t_object_2e143 = (u64)A7;
+	t_binding_2e158 = (u64)A8;
+	*(u64 *)t_param_2e66 = (u64)t_n;
+	*(u64 *)t_param_2e67 = (u64)t_off;
+	L_body_2e68:;
+	t_item_2e73 = (u64)((u64)t_binding_2e71 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e73 = (u8)((u64)0UL);
+	t__2e74 = (u64)((u64)t_binding_2e71 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e74, (u64)t_item_2e73, (u64)((u64)127UL));
+	t_item_2e76 = (u64)((u64)t_binding_2e71 + (u64)((u64)0UL));
+	t__2e77 = (u64)(u32)(*(u8 *)t_item_2e76);
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)1UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)2UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)3UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)4UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)5UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)6UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)7UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)8UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)9UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)10UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)11UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)12UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)13UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)14UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)15UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)16UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)17UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)18UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)19UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)20UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)21UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)22UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)23UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)24UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)25UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)26UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)27UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)28UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)29UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)30UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)31UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)32UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)33UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)34UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)35UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)36UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)37UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)38UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)39UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)40UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)41UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)42UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)43UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)44UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)45UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)46UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)47UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)48UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)49UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)50UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)51UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)52UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)53UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)54UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)55UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)56UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)57UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)58UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)59UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)60UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)61UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)62UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)63UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)64UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)65UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)66UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)67UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)68UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)69UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)70UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)71UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)72UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)73UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)74UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)75UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)76UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)77UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)78UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)79UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)80UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)81UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)82UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)83UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)84UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)85UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)86UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)87UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)88UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)89UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)90UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)91UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)92UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)93UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)94UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)95UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)96UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)97UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)98UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)99UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)100UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)101UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)102UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)103UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)104UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)105UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)106UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)107UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)108UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)109UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)110UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)111UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)112UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)113UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)114UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)115UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)116UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)117UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)118UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)119UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)120UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)121UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)122UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)123UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)124UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)125UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)126UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t__2e75 = (u64)((u64)t_binding_2e71 + (u64)((u64)127UL));
+	*(u8 *)t__2e75 = (u8)t__2e77;
+	t_item_2e79 = (u64)((u64)t_binding_2e78 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e79 = (u8)((u64)0UL);
+	t__2e80 = (u64)((u64)t_binding_2e78 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e80, (u64)t_item_2e79, (u64)((u64)127UL));
+	t_item_2e82 = (u64)((u64)t_binding_2e78 + (u64)((u64)0UL));
+	t__2e83 = (u64)(u32)(*(u8 *)t_item_2e82);
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)1UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)2UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)3UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)4UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)5UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)6UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)7UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)8UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)9UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)10UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)11UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)12UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)13UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)14UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)15UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)16UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)17UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)18UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)19UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)20UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)21UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)22UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)23UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)24UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)25UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)26UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)27UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)28UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)29UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)30UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)31UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)32UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)33UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)34UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)35UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)36UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)37UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)38UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)39UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)40UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)41UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)42UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)43UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)44UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)45UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)46UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)47UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)48UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)49UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)50UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)51UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)52UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)53UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)54UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)55UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)56UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)57UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)58UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)59UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)60UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)61UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)62UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)63UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)64UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)65UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)66UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)67UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)68UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)69UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)70UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)71UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)72UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)73UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)74UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)75UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)76UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)77UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)78UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)79UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)80UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)81UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)82UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)83UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)84UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)85UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)86UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)87UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)88UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)89UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)90UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)91UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)92UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)93UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)94UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)95UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)96UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)97UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)98UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)99UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)100UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)101UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)102UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)103UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)104UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)105UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)106UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)107UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)108UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)109UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)110UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)111UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)112UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)113UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)114UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)115UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)116UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)117UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)118UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)119UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)120UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)121UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)122UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)123UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)124UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)125UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)126UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	t__2e81 = (u64)((u64)t_binding_2e78 + (u64)((u64)127UL));
+	*(u8 *)t__2e81 = (u8)t__2e83;
+	*(u64 *)t_object_2e84 = (u64)t_binding_2e78;
+	t__2e86 = (u64)((u64)t_object_2e84 + (u64)((u64)8UL));
+	*(u64 *)t__2e86 = (u64)((u64)128UL);
+	t__2e86 = (u64)((u64)t__2e86 + (u64)((u64)8UL));
+	*(u64 *)t__2e86 = (u64)((u64)128UL);
+	BLIT((u64)B9, t_object_2e84, 24);
+	((void (*)(u64))((u64)((char *)&F_pattern)))((u64)B9);
+	*(u64 *)t_object_2e87 = (u64)t_binding_2e71;
+	t__2e88 = (u64)((u64)t_object_2e87 + (u64)((u64)8UL));
+	*(u64 *)t__2e88 = (u64)((u64)128UL);
+	t__2e88 = (u64)((u64)t__2e88 + (u64)((u64)8UL));
+	*(u64 *)t__2e88 = (u64)((u64)128UL);
+	BLIT((u64)B10, t_object_2e87, 24);
+	((void (*)(u64))((u64)((char *)&F_pattern)))((u64)B10);
+	t__2e90 = (u64)(*(u64 *)t_param_2e67);
+	t__2e89 = (u64)((u64)t__2e90 * (u64)((u64)1UL));
+	t__2e89 = (u64)((u64)t_binding_2e71 + (u64)t__2e89);
+	t__2e91 = (u64)(u32)(((u64)t__2e90 < (u64)((u64)128UL)));
+	if ((u32)t__2e91) goto L__2e93; else goto L__2e92;
+	L__2e92:;
+	t_abortsite_2e95 = ((u64)0UL);
+	goto L_abort_2e96;
+	L__2e93:;
+	t__2e103 = (u64)((i64)(i32)((u64)0UL));
+	t__2e102 = (u64)((u64)t__2e103 * (u64)((u64)1UL));
+	t__2e102 = (u64)((u64)t_binding_2e71 + (u64)t__2e102);
+	t__2e104 = (u64)(*(u64 *)t_param_2e66);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e89, (u64)t__2e102, (u64)t__2e104);
+	*(u64 *)t_binding_2e110 = (u64)((u64)0UL);
+	L_loop_2e105:;
+	t__2e112 = (u64)(*(u64 *)t_binding_2e110);
+	t__2e113 = (u64)(*(u64 *)t_param_2e66);
+	t__2e111 = (u64)(u32)(((u64)t__2e112 < (u64)t__2e113));
+	if ((u32)t__2e111) goto L_body_2e106; else goto L__2e108;
+	L_body_2e106:;
+	t__2e121 = (u64)(*(u64 *)t_param_2e67);
+	t__2e122 = (u64)(*(u64 *)t_binding_2e110);
+	t__2e120 = (u64)((u64)t__2e121 + (u64)t__2e122);
+	t__2e119 = (u64)((u64)t__2e120 * (u64)((u64)1UL));
+	t__2e119 = (u64)((u64)t_binding_2e71 + (u64)t__2e119);
+	t__2e123 = (u64)(u32)(((u64)t__2e120 < (u64)((u64)128UL)));
+	if ((u32)t__2e123) goto L__2e125; else goto L__2e124;
+	L__2e124:;
+	t_abortsite_2e95 = ((u64)1UL);
+	goto L_abort_2e96;
+	L__2e125:;
+	t__2e126 = (u64)(u32)(*(u8 *)t__2e119);
+	t__2e128 = (u64)(*(u64 *)t_binding_2e110);
+	t__2e127 = (u64)((u64)t__2e128 * (u64)((u64)1UL));
+	t__2e127 = (u64)((u64)t_binding_2e78 + (u64)t__2e127);
+	t__2e129 = (u64)(u32)(((u64)t__2e128 < (u64)((u64)128UL)));
+	if ((u32)t__2e129) goto L__2e131; else goto L__2e130;
+	L__2e130:;
+	t_abortsite_2e95 = ((u64)2UL);
+	goto L_abort_2e96;
+	L__2e131:;
+	t__2e132 = (u64)(u32)(*(u8 *)t__2e127);
+	t__2e133 = (u64)(u32)((u8)t__2e126);
+	t__2e134 = (u64)(u32)((u8)t__2e132);
+	t__2e118 = (u64)(u32)(((u32)t__2e133 == (u32)t__2e134));
+	if ((u32)t__2e118) goto L_passed_2e117; else goto L_failed_2e116;
+	L_failed_2e116:;
+	t_abortsite_2e95 = ((u64)3UL);
+	goto L_abort_2e135;
+	L_passed_2e117:;
+	goto L__2e114;
+	L__2e141:;
+	L__2e114:;
+	L_after_2e109:;
+	t__2e142 = (u64)(*(u64 *)t_binding_2e110);
+	t__2e142 = (u64)((u64)t__2e142 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e110 = (u64)t__2e142;
+	goto L_loop_2e105;
+	L__2e108:;
+	*(u64 *)t_object_2e143 = (u64)t_binding_2e71;
+	t__2e144 = (u64)((u64)t_object_2e143 + (u64)((u64)8UL));
+	*(u64 *)t__2e144 = (u64)((u64)128UL);
+	t__2e144 = (u64)((u64)t__2e144 + (u64)((u64)8UL));
+	*(u64 *)t__2e144 = (u64)((u64)128UL);
+	BLIT((u64)B11, t_object_2e143, 24);
+	((void (*)(u64))((u64)((char *)&F_pattern)))((u64)B11);
+	t__2e146 = (u64)((i64)(i32)((u64)0UL));
+	t__2e145 = (u64)((u64)t__2e146 * (u64)((u64)1UL));
+	t__2e145 = (u64)((u64)t_binding_2e71 + (u64)t__2e145);
+	t__2e148 = (u64)(*(u64 *)t_param_2e67);
+	t__2e147 = (u64)((u64)t__2e148 * (u64)((u64)1UL));
+	t__2e147 = (u64)((u64)t_binding_2e71 + (u64)t__2e147);
+	t__2e149 = (u64)(u32)(((u64)t__2e148 < (u64)((u64)128UL)));
+	if ((u32)t__2e149) goto L__2e151; else goto L__2e150;
+	L__2e150:;
+	t_abortsite_2e95 = ((u64)4UL);
+	goto L_abort_2e96;
+	L__2e151:;
+	t__2e152 = (u64)(*(u64 *)t_param_2e66);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e145, (u64)t__2e147, (u64)t__2e152);
+	*(u64 *)t_binding_2e158 = (u64)((u64)0UL);
+	L_loop_2e153:;
+	t__2e160 = (u64)(*(u64 *)t_binding_2e158);
+	t__2e161 = (u64)(*(u64 *)t_param_2e66);
+	t__2e159 = (u64)(u32)(((u64)t__2e160 < (u64)t__2e161));
+	if ((u32)t__2e159) goto L_body_2e154; else goto L__2e156;
+	L_body_2e154:;
+	t__2e168 = (u64)(*(u64 *)t_binding_2e158);
+	t__2e167 = (u64)((u64)t__2e168 * (u64)((u64)1UL));
+	t__2e167 = (u64)((u64)t_binding_2e71 + (u64)t__2e167);
+	t__2e169 = (u64)(u32)(((u64)t__2e168 < (u64)((u64)128UL)));
+	if ((u32)t__2e169) goto L__2e171; else goto L__2e170;
+	L__2e170:;
+	t_abortsite_2e95 = ((u64)5UL);
+	goto L_abort_2e96;
+	L__2e171:;
+	t__2e172 = (u64)(u32)(*(u8 *)t__2e167);
+	t__2e175 = (u64)(*(u64 *)t_param_2e67);
+	t__2e176 = (u64)(*(u64 *)t_binding_2e158);
+	t__2e174 = (u64)((u64)t__2e175 + (u64)t__2e176);
+	t__2e173 = (u64)((u64)t__2e174 * (u64)((u64)1UL));
+	t__2e173 = (u64)((u64)t_binding_2e78 + (u64)t__2e173);
+	t__2e177 = (u64)(u32)(((u64)t__2e174 < (u64)((u64)128UL)));
+	if ((u32)t__2e177) goto L__2e179; else goto L__2e178;
+	L__2e178:;
+	t_abortsite_2e95 = ((u64)6UL);
+	goto L_abort_2e96;
+	L__2e179:;
+	t__2e180 = (u64)(u32)(*(u8 *)t__2e173);
+	t__2e181 = (u64)(u32)((u8)t__2e172);
+	t__2e182 = (u64)(u32)((u8)t__2e180);
+	t__2e166 = (u64)(u32)(((u32)t__2e181 == (u32)t__2e182));
+	if ((u32)t__2e166) goto L_passed_2e165; else goto L_failed_2e164;
+	L_failed_2e164:;
+	t_abortsite_2e95 = ((u64)7UL);
+	goto L_abort_2e135;
+	L_passed_2e165:;
+	goto L__2e162;
+	L__2e183:;
+	L__2e162:;
+	L_after_2e157:;
+	t__2e184 = (u64)(*(u64 *)t_binding_2e158);
+	t__2e184 = (u64)((u64)t__2e184 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e158 = (u64)t__2e184;
+	goto L_loop_2e153;
+	L__2e156:;
+	goto L__2e69;
+	L__2e185:;
+	L__2e69:;
+	return;
+	L_abort_2e96:;
+	t__2e97 = (u64)((u64)t_abortsite_2e95 * (u64)((u64)16UL));
+	t__2e97 = (u64)((u64)((u64)((char *)&D_abortsites_2e94)) + (u64)t__2e97);
+	t__2e98 = (u64)(*(u64 *)t__2e97);
+	t__2e99 = (u64)((u64)t__2e97 + (u64)((u64)8UL));
+	t__2e100 = (u64)(*(u32 *)t__2e99);
+	t__2e99 = (u64)((u64)t__2e97 + (u64)((u64)12UL));
+	t__2e101 = (u64)(*(u32 *)t__2e99);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e98, (u64)t__2e100, (u64)t__2e101, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e135:;
+	t__2e136 = (u64)((u64)t_abortsite_2e95 * (u64)((u64)16UL));
+	t__2e136 = (u64)((u64)((u64)((char *)&D_abortsites_2e94)) + (u64)t__2e136);
+	t__2e137 = (u64)(*(u64 *)t__2e136);
+	t__2e138 = (u64)((u64)t__2e136 + (u64)((u64)8UL));
+	t__2e139 = (u64)(*(u32 *)t__2e138);
+	t__2e138 = (u64)((u64)t__2e136 + (u64)((u64)12UL));
+	t__2e140 = (u64)(*(u32 *)t__2e138);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e137, (u64)t__2e139, (u64)t__2e140, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_pattern(u64 p_buf) {
+	char A0[8] __attribute__((aligned(16)));
+	u64 t__2e196;
+	u64 t__2e197;
+	u64 t__2e198;
+	u64 t__2e199;
+	u64 t__2e200;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e205;
+	u64 t__2e206;
+	u64 t__2e207;
+	u64 t__2e208;
+	u64 t__2e209;
+	u64 t__2e210;
+	u64 t__2e211;
+	u64 t__2e213;
+	u64 t_binding_2e195;
+	u64 t_buf;
+	t_buf = p_buf;
+	L_start_2e186:;
+	t_binding_2e195 = (u64)A0;
+	L_body_2e187:;
+	*(u64 *)t_binding_2e195 = (u64)((u64)0UL);
+	L_loop_2e190:;
+	t__2e197 = (u64)(*(u64 *)t_binding_2e195);
+	t__2e198 = (u64)((u64)t_buf + (u64)((u64)8UL));
+	t__2e199 = (u64)((u64)t_buf + (u64)((u64)16UL));
+	t__2e200 = (u64)(*(u64 *)t__2e198);
+	t__2e196 = (u64)(u32)(((u64)t__2e197 < (u64)t__2e200));
+	if ((u32)t__2e196) goto L_body_2e191; else goto L__2e193;
+	L_body_2e191:;
+	t__2e204 = (u64)((u64)t_buf + (u64)((u64)8UL));
+	t__2e205 = (u64)((u64)t_buf + (u64)((u64)16UL));
+	t__2e206 = (u64)(*(u64 *)t_buf);
+	t__2e207 = (u64)(*(u64 *)t_binding_2e195);
+	t__2e203 = (u64)((u64)t__2e207 * (u64)((u64)1UL));
+	t__2e203 = (u64)((u64)t__2e206 + (u64)t__2e203);
+	t__2e210 = (u64)(*(u64 *)t_binding_2e195);
+	t__2e209 = (u64)((u64)t__2e210 * (u64)((u64)7UL));
+	t__2e208 = (u64)((u64)t__2e209 + (u64)((u64)1UL));
+	t__2e211 = (u64)(u32)t__2e208;
+	*(u8 *)t__2e203 = (u8)t__2e211;
+	goto L__2e201;
+	L__2e212:;
+	L__2e201:;
+	L_after_2e194:;
+	t__2e213 = (u64)(*(u64 *)t_binding_2e195);
+	t__2e213 = (u64)((u64)t__2e213 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e195 = (u64)t__2e213;
+	goto L_loop_2e190;
+	L__2e193:;
+	goto L__2e188;
+	L__2e214:;
+	L__2e188:;
+	return;
+}
+static void F_copy(u64 p_n, u64 p_so, u64 p_do) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[128] __attribute__((aligned(16)));
+	char A4[128] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	u64 t__2e224;
+	u64 t__2e225;
+	u64 t__2e227;
+	u64 t__2e230;
+	u64 t__2e231;
+	u64 t__2e233;
+	u64 t__2e235;
+	u64 t__2e236;
+	u64 t__2e237;
+	u64 t__2e238;
+	u64 t__2e244;
+	u64 t__2e245;
+	u64 t__2e246;
+	u64 t__2e247;
+	u64 t__2e248;
+	u64 t__2e249;
+	u64 t__2e250;
+	u64 t__2e251;
+	u64 t__2e254;
+	u64 t__2e261;
+	u64 t__2e262;
+	u64 t__2e269;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e275;
+	u64 t__2e276;
+	u64 t__2e277;
+	u64 t__2e278;
+	u64 t__2e279;
+	u64 t__2e280;
+	u64 t__2e285;
+	u64 t__2e286;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e289;
+	u64 t__2e290;
+	u64 t__2e292;
+	u64 t__2e293;
+	u64 t__2e294;
+	u64 t__2e295;
+	u64 t__2e296;
+	u64 t__2e302;
+	u64 t__2e303;
+	u64 t__2e304;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t__2e311;
+	u64 t__2e312;
+	u64 t__2e315;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e320;
+	u64 t__2e321;
+	u64 t__2e322;
+	u64 t__2e323;
+	u64 t__2e326;
+	u64 t__2e333;
+	u64 t__2e334;
+	u64 t__2e341;
+	u64 t__2e344;
+	u64 t__2e345;
+	u64 t__2e346;
+	u64 t__2e347;
+	u64 t__2e348;
+	u64 t__2e349;
+	u64 t__2e350;
+	u64 t__2e351;
+	u64 t__2e352;
+	u64 t__2e357;
+	u64 t__2e358;
+	u64 t__2e359;
+	u64 t__2e360;
+	u64 t__2e361;
+	u64 t__2e362;
+	u64 t__2e368;
+	u64 t__2e369;
+	u64 t__2e370;
+	u64 t__2e371;
+	u64 t__2e372;
+	u64 t__2e373;
+	u64 t__2e376;
+	u64 t_abortsite_2e242;
+	u64 t_binding_2e222;
+	u64 t_binding_2e228;
+	u64 t_binding_2e260;
+	u64 t_binding_2e332;
+	u64 t_do;
+	u64 t_item_2e223;
+	u64 t_item_2e226;
+	u64 t_item_2e229;
+	u64 t_item_2e232;
+	u64 t_n;
+	u64 t_object_2e234;
+	u64 t_param_2e216;
+	u64 t_param_2e217;
+	u64 t_param_2e218;
+	u64 t_so;
+	t_n = (u64)p_n;
+	t_so = (u64)p_so;
+	t_do = (u64)p_do;
+	L_start_2e215:;
+	t_param_2e216 = (u64)A0;
+	t_param_2e217 = (u64)A1;
+	t_param_2e218 = (u64)A2;
+	t_binding_2e222 = (u64)A3;
+	t_binding_2e228 = (u64)A4;
+	t_object_2e234 = (u64)A5;
+	t_binding_2e260 = (u64)A6;
+	t_binding_2e332 = (u64)A7;
+	*(u64 *)t_param_2e216 = (u64)t_n;
+	*(u64 *)t_param_2e217 = (u64)t_so;
+	*(u64 *)t_param_2e218 = (u64)t_do;
+	L_body_2e219:;
+	t_item_2e223 = (u64)((u64)t_binding_2e222 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e223 = (u8)((u64)0UL);
+	t__2e224 = (u64)((u64)t_binding_2e222 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e224, (u64)t_item_2e223, (u64)((u64)127UL));
+	t_item_2e226 = (u64)((u64)t_binding_2e222 + (u64)((u64)0UL));
+	t__2e227 = (u64)(u32)(*(u8 *)t_item_2e226);
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)1UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)2UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)3UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)4UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)5UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)6UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)7UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)8UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)9UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)10UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)11UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)12UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)13UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)14UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)15UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)16UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)17UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)18UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)19UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)20UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)21UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)22UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)23UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)24UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)25UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)26UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)27UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)28UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)29UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)30UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)31UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)32UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)33UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)34UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)35UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)36UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)37UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)38UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)39UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)40UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)41UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)42UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)43UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)44UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)45UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)46UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)47UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)48UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)49UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)50UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)51UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)52UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)53UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)54UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)55UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)56UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)57UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)58UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)59UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)60UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)61UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)62UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)63UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)64UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)65UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)66UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)67UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)68UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)69UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)70UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)71UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)72UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)73UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)74UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)75UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)76UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)77UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)78UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)79UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)80UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)81UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)82UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)83UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)84UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)85UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)86UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)87UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)88UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)89UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)90UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)91UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)92UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)93UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)94UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)95UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)96UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)97UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)98UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)99UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)100UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)101UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)102UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)103UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)104UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)105UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)106UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)107UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)108UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)109UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)110UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)111UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)112UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)113UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)114UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)115UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)116UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)117UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)118UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)119UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)120UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)121UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)122UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)123UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)124UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)125UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)126UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t__2e225 = (u64)((u64)t_binding_2e222 + (u64)((u64)127UL));
+	*(u8 *)t__2e225 = (u8)t__2e227;
+	t_item_2e229 = (u64)((u64)t_binding_2e228 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e229 = (u8)((u64)0UL);
+	t__2e230 = (u64)((u64)t_binding_2e228 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e230, (u64)t_item_2e229, (u64)((u64)127UL));
+	t_item_2e232 = (u64)((u64)t_binding_2e228 + (u64)((u64)0UL));
+	t__2e233 = (u64)(u32)(*(u8 *)t_item_2e232);
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)1UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)2UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)3UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)4UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)5UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)6UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)7UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)8UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)9UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)10UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)11UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)12UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)13UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)14UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)15UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)16UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)17UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)18UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)19UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)20UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)21UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)22UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)23UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)24UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)25UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)26UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)27UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)28UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)29UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)30UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)31UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)32UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)33UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)34UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)35UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)36UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)37UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)38UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)39UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)40UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)41UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)42UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)43UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)44UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)45UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)46UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)47UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)48UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)49UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)50UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)51UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)52UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)53UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)54UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)55UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)56UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)57UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)58UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)59UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)60UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)61UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)62UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)63UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)64UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)65UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)66UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)67UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)68UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)69UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)70UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)71UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)72UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)73UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)74UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)75UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)76UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)77UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)78UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)79UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)80UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)81UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)82UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)83UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)84UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)85UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)86UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)87UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)88UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)89UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)90UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)91UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)92UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)93UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)94UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)95UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)96UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)97UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)98UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)99UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)100UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)101UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)102UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)103UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)104UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)105UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)106UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)107UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)108UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)109UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)110UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)111UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)112UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)113UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)114UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)115UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)116UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)117UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)118UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)119UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)120UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)121UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)122UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)123UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)124UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)125UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)126UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	t__2e231 = (u64)((u64)t_binding_2e228 + (u64)((u64)127UL));
+	*(u8 *)t__2e231 = (u8)t__2e233;
+	*(u64 *)t_object_2e234 = (u64)t_binding_2e222;
+	t__2e235 = (u64)((u64)t_object_2e234 + (u64)((u64)8UL));
+	*(u64 *)t__2e235 = (u64)((u64)128UL);
+	t__2e235 = (u64)((u64)t__2e235 + (u64)((u64)8UL));
+	*(u64 *)t__2e235 = (u64)((u64)128UL);
+	BLIT((u64)B8, t_object_2e234, 24);
+	((void (*)(u64))((u64)((char *)&F_pattern)))((u64)B8);
+	((void (*)(u64, u32, u64))((u64)X_rt_2ememset))((u64)t_binding_2e228, (u32)((u64)170UL), (u64)((u64)128UL));
+	t__2e237 = (u64)(*(u64 *)t_param_2e218);
+	t__2e236 = (u64)((u64)t__2e237 * (u64)((u64)1UL));
+	t__2e236 = (u64)((u64)t_binding_2e228 + (u64)t__2e236);
+	t__2e238 = (u64)(u32)(((u64)t__2e237 < (u64)((u64)128UL)));
+	if ((u32)t__2e238) goto L__2e240; else goto L__2e239;
+	L__2e239:;
+	t_abortsite_2e242 = ((u64)0UL);
+	goto L_abort_2e243;
+	L__2e240:;
+	t__2e250 = (u64)(*(u64 *)t_param_2e217);
+	t__2e249 = (u64)((u64)t__2e250 * (u64)((u64)1UL));
+	t__2e249 = (u64)((u64)t_binding_2e222 + (u64)t__2e249);
+	t__2e251 = (u64)(u32)(((u64)t__2e250 < (u64)((u64)128UL)));
+	if ((u32)t__2e251) goto L__2e253; else goto L__2e252;
+	L__2e252:;
+	t_abortsite_2e242 = ((u64)1UL);
+	goto L_abort_2e243;
+	L__2e253:;
+	t__2e254 = (u64)(*(u64 *)t_param_2e216);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e236, (u64)t__2e249, (u64)t__2e254);
+	*(u64 *)t_binding_2e260 = (u64)((u64)0UL);
+	L_loop_2e255:;
+	t__2e262 = (u64)(*(u64 *)t_binding_2e260);
+	t__2e261 = (u64)(u32)(((u64)t__2e262 < (u64)((u64)128UL)));
+	if ((u32)t__2e261) goto L_body_2e256; else goto L__2e258;
+	L_body_2e256:;
+	t__2e273 = (u64)(*(u64 *)t_binding_2e260);
+	t__2e274 = (u64)(*(u64 *)t_param_2e218);
+	t__2e272 = (u64)(u32)(((u64)t__2e273 < (u64)t__2e274));
+	t__2e269 = (u64)(u32)t__2e272;
+	if ((u32)t__2e269) goto L__2e271; else goto L__2e270;
+	L__2e270:;
+	t__2e276 = (u64)(*(u64 *)t_binding_2e260);
+	t__2e278 = (u64)(*(u64 *)t_param_2e218);
+	t__2e279 = (u64)(*(u64 *)t_param_2e216);
+	t__2e277 = (u64)((u64)t__2e278 + (u64)t__2e279);
+	t__2e275 = (u64)(u32)(((u64)t__2e276 >= (u64)t__2e277));
+	t__2e269 = (u64)(u32)t__2e275;
+	goto L__2e271;
+	L__2e271:;
+	t__2e280 = (u64)(u32)((u8)t__2e269);
+	if ((u32)t__2e280) goto L_true_2e266; else goto L_false_2e267;
+	L_true_2e266:;
+	t__2e287 = (u64)(*(u64 *)t_binding_2e260);
+	t__2e286 = (u64)((u64)t__2e287 * (u64)((u64)1UL));
+	t__2e286 = (u64)((u64)t_binding_2e228 + (u64)t__2e286);
+	t__2e288 = (u64)(u32)(*(u8 *)t__2e286);
+	t__2e289 = (u64)(u32)((u8)t__2e288);
+	t__2e290 = (u64)(u32)((u8)((u64)170UL));
+	t__2e285 = (u64)(u32)(((u32)t__2e289 == (u32)t__2e290));
+	if ((u32)t__2e285) goto L_passed_2e284; else goto L_failed_2e283;
+	L_failed_2e283:;
+	t_abortsite_2e242 = ((u64)2UL);
+	goto L_abort_2e291;
+	L_passed_2e284:;
+	goto L__2e281;
+	L__2e297:;
+	L__2e281:;
+	goto L__2e268;
+	L_false_2e267:;
+	t__2e304 = (u64)(*(u64 *)t_binding_2e260);
+	t__2e303 = (u64)((u64)t__2e304 * (u64)((u64)1UL));
+	t__2e303 = (u64)((u64)t_binding_2e228 + (u64)t__2e303);
+	t__2e305 = (u64)(u32)(*(u8 *)t__2e303);
+	t__2e309 = (u64)(*(u64 *)t_param_2e217);
+	t__2e310 = (u64)(*(u64 *)t_binding_2e260);
+	t__2e308 = (u64)((u64)t__2e309 + (u64)t__2e310);
+	t__2e311 = (u64)(*(u64 *)t_param_2e218);
+	t__2e307 = (u64)((u64)t__2e308 - (u64)t__2e311);
+	t__2e306 = (u64)((u64)t__2e307 * (u64)((u64)1UL));
+	t__2e306 = (u64)((u64)t_binding_2e222 + (u64)t__2e306);
+	t__2e312 = (u64)(u32)(((u64)t__2e307 < (u64)((u64)128UL)));
+	if ((u32)t__2e312) goto L__2e314; else goto L__2e313;
+	L__2e313:;
+	t_abortsite_2e242 = ((u64)3UL);
+	goto L_abort_2e243;
+	L__2e314:;
+	t__2e315 = (u64)(u32)(*(u8 *)t__2e306);
+	t__2e316 = (u64)(u32)((u8)t__2e305);
+	t__2e317 = (u64)(u32)((u8)t__2e315);
+	t__2e302 = (u64)(u32)(((u32)t__2e316 == (u32)t__2e317));
+	if ((u32)t__2e302) goto L_passed_2e301; else goto L_failed_2e300;
+	L_failed_2e300:;
+	t_abortsite_2e242 = ((u64)4UL);
+	goto L_abort_2e291;
+	L_passed_2e301:;
+	goto L__2e298;
+	L__2e318:;
+	L__2e298:;
+	L__2e268:;
+	goto L__2e263;
+	L__2e319:;
+	L__2e263:;
+	L_after_2e259:;
+	t__2e320 = (u64)(*(u64 *)t_binding_2e260);
+	t__2e320 = (u64)((u64)t__2e320 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e260 = (u64)t__2e320;
+	goto L_loop_2e255;
+	L__2e258:;
+	t__2e322 = (u64)(*(u64 *)t_param_2e218);
+	t__2e321 = (u64)((u64)t__2e322 * (u64)((u64)1UL));
+	t__2e321 = (u64)((u64)t_binding_2e228 + (u64)t__2e321);
+	t__2e323 = (u64)(u32)(((u64)t__2e322 < (u64)((u64)128UL)));
+	if ((u32)t__2e323) goto L__2e325; else goto L__2e324;
+	L__2e324:;
+	t_abortsite_2e242 = ((u64)5UL);
+	goto L_abort_2e243;
+	L__2e325:;
+	t__2e326 = (u64)(*(u64 *)t_param_2e216);
+	((void (*)(u64, u32, u64))((u64)X_rt_2ememset))((u64)t__2e321, (u32)((u64)85UL), (u64)t__2e326);
+	*(u64 *)t_binding_2e332 = (u64)((u64)0UL);
+	L_loop_2e327:;
+	t__2e334 = (u64)(*(u64 *)t_binding_2e332);
+	t__2e333 = (u64)(u32)(((u64)t__2e334 < (u64)((u64)128UL)));
+	if ((u32)t__2e333) goto L_body_2e328; else goto L__2e330;
+	L_body_2e328:;
+	t__2e345 = (u64)(*(u64 *)t_binding_2e332);
+	t__2e346 = (u64)(*(u64 *)t_param_2e218);
+	t__2e344 = (u64)(u32)(((u64)t__2e345 < (u64)t__2e346));
+	t__2e341 = (u64)(u32)t__2e344;
+	if ((u32)t__2e341) goto L__2e343; else goto L__2e342;
+	L__2e342:;
+	t__2e348 = (u64)(*(u64 *)t_binding_2e332);
+	t__2e350 = (u64)(*(u64 *)t_param_2e218);
+	t__2e351 = (u64)(*(u64 *)t_param_2e216);
+	t__2e349 = (u64)((u64)t__2e350 + (u64)t__2e351);
+	t__2e347 = (u64)(u32)(((u64)t__2e348 >= (u64)t__2e349));
+	t__2e341 = (u64)(u32)t__2e347;
+	goto L__2e343;
+	L__2e343:;
+	t__2e352 = (u64)(u32)((u8)t__2e341);
+	if ((u32)t__2e352) goto L_true_2e338; else goto L_false_2e339;
+	L_true_2e338:;
+	t__2e359 = (u64)(*(u64 *)t_binding_2e332);
+	t__2e358 = (u64)((u64)t__2e359 * (u64)((u64)1UL));
+	t__2e358 = (u64)((u64)t_binding_2e228 + (u64)t__2e358);
+	t__2e360 = (u64)(u32)(*(u8 *)t__2e358);
+	t__2e361 = (u64)(u32)((u8)t__2e360);
+	t__2e362 = (u64)(u32)((u8)((u64)170UL));
+	t__2e357 = (u64)(u32)(((u32)t__2e361 == (u32)t__2e362));
+	if ((u32)t__2e357) goto L_passed_2e356; else goto L_failed_2e355;
+	L_failed_2e355:;
+	t_abortsite_2e242 = ((u64)6UL);
+	goto L_abort_2e291;
+	L_passed_2e356:;
+	goto L__2e353;
+	L__2e363:;
+	L__2e353:;
+	goto L__2e340;
+	L_false_2e339:;
+	t__2e370 = (u64)(*(u64 *)t_binding_2e332);
+	t__2e369 = (u64)((u64)t__2e370 * (u64)((u64)1UL));
+	t__2e369 = (u64)((u64)t_binding_2e228 + (u64)t__2e369);
+	t__2e371 = (u64)(u32)(*(u8 *)t__2e369);
+	t__2e372 = (u64)(u32)((u8)t__2e371);
+	t__2e373 = (u64)(u32)((u8)((u64)85UL));
+	t__2e368 = (u64)(u32)(((u32)t__2e372 == (u32)t__2e373));
+	if ((u32)t__2e368) goto L_passed_2e367; else goto L_failed_2e366;
+	L_failed_2e366:;
+	t_abortsite_2e242 = ((u64)7UL);
+	goto L_abort_2e291;
+	L_passed_2e367:;
+	goto L__2e364;
+	L__2e374:;
+	L__2e364:;
+	L__2e340:;
+	goto L__2e335;
+	L__2e375:;
+	L__2e335:;
+	L_after_2e331:;
+	t__2e376 = (u64)(*(u64 *)t_binding_2e332);
+	t__2e376 = (u64)((u64)t__2e376 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e332 = (u64)t__2e376;
+	goto L_loop_2e327;
+	L__2e330:;
+	goto L__2e220;
+	L__2e377:;
+	L__2e220:;
+	return;
+	L_abort_2e243:;
+	t__2e244 = (u64)((u64)t_abortsite_2e242 * (u64)((u64)16UL));
+	t__2e244 = (u64)((u64)((u64)((char *)&D_abortsites_2e241)) + (u64)t__2e244);
+	t__2e245 = (u64)(*(u64 *)t__2e244);
+	t__2e246 = (u64)((u64)t__2e244 + (u64)((u64)8UL));
+	t__2e247 = (u64)(*(u32 *)t__2e246);
+	t__2e246 = (u64)((u64)t__2e244 + (u64)((u64)12UL));
+	t__2e248 = (u64)(*(u32 *)t__2e246);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e245, (u64)t__2e247, (u64)t__2e248, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e291:;
+	t__2e292 = (u64)((u64)t_abortsite_2e242 * (u64)((u64)16UL));
+	t__2e292 = (u64)((u64)((u64)((char *)&D_abortsites_2e241)) + (u64)t__2e292);
+	t__2e293 = (u64)(*(u64 *)t__2e292);
+	t__2e294 = (u64)((u64)t__2e292 + (u64)((u64)8UL));
+	t__2e295 = (u64)(*(u32 *)t__2e294);
+	t__2e294 = (u64)((u64)t__2e292 + (u64)((u64)12UL));
+	t__2e296 = (u64)(*(u32 *)t__2e294);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e293, (u64)t__2e295, (u64)t__2e296, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_compile(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char B4[8] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char R7[4] __attribute__((aligned(16)));
+	char B8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[4] __attribute__((aligned(16)));
+	u64 t__2e383;
+	u64 t__2e389;
+	u64 t__2e395;
+	u64 t__2e404;
+	u64 t__2e406;
+	u64 t__2e410;
+	u64 t__2e411;
+	u64 t__2e412;
+	u64 t__2e413;
+	u64 t__2e414;
+	u64 t__2e417;
+	u64 t__2e418;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e421;
+	u64 t__2e423;
+	u64 t__2e425;
+	u64 t__2e429;
+	u64 t__2e438;
+	u64 t__2e440;
+	u64 t_abortsite_2e408;
+	u64 t_object_2e385;
+	u64 t_object_2e393;
+	u64 t_object_2e424;
+	u64 t_object_2e428;
+	u64 t_tag_2e396;
+	u64 t_tag_2e430;
+	L_start_2e378:;
+	t_object_2e385 = (u64)A0;
+	t_object_2e393 = (u64)A1;
+	t_object_2e424 = (u64)A2;
+	t_object_2e428 = (u64)A3;
+	L_body_2e379:;
+	*(u32 *)t_object_2e385 = (u32)((u64)3532310079UL);
+	t__2e389 = (u64)((u64)t_object_2e385 + (u64)((u64)4UL));
+	*(u32 *)t__2e389 = (u32)((u64)0UL);
+	*(u64 *)t_object_2e393 = (u64)((u64)0UL);
+	t__2e395 = (u64)((u64)t_object_2e393 + (u64)((u64)8UL));
+	*(u64 *)t__2e395 = (u64)((u64)0UL);
+	t__2e395 = (u64)((u64)t__2e395 + (u64)((u64)8UL));
+	*(u64 *)t__2e395 = (u64)((u64)0UL);
+	BLIT((u64)B4, t_object_2e385, 8);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e391)), 24);
+	BLIT((u64)B6, t_object_2e393, 24);
+	t__2e383 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R7, (u64)B4, (u64)B5, (u64)B6);
+	t_tag_2e396 = (u64)(*(u32 *)t__2e383);
+	t__2e404 = (u64)(u32)(((u32)t_tag_2e396 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e404) goto L_member_2e401; else goto L__2e403;
+	L__2e403:;
+	t__2e406 = (u64)(u32)(((u32)t_tag_2e396 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e406) goto L_member_2e402; else goto L__2e405;
+	L__2e405:;
+	goto L_matches_2e400;
+	L_member_2e401:;
+	goto L_matches_2e400;
+	L_member_2e402:;
+	goto L_matches_2e399;
+	L_matches_2e399:;
+	goto L__2e397;
+	L_matches_2e400:;
+	t_abortsite_2e408 = ((u64)0UL);
+	goto L_abort_2e409;
+	L__2e415:;
+	L__2e398:;
+	t_abortsite_2e408 = ((u64)1UL);
+	goto L_abort_2e416;
+	L__2e397:;
+	*(u32 *)t_object_2e424 = (u32)((u64)3532310079UL);
+	t__2e425 = (u64)((u64)t_object_2e424 + (u64)((u64)4UL));
+	*(u32 *)t__2e425 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e428 = (u64)((u64)0UL);
+	t__2e429 = (u64)((u64)t_object_2e428 + (u64)((u64)8UL));
+	*(u64 *)t__2e429 = (u64)((u64)0UL);
+	t__2e429 = (u64)((u64)t__2e429 + (u64)((u64)8UL));
+	*(u64 *)t__2e429 = (u64)((u64)0UL);
+	BLIT((u64)B8, t_object_2e424, 8);
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e427)), 24);
+	BLIT((u64)B10, t_object_2e428, 24);
+	t__2e423 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R11, (u64)B8, (u64)B9, (u64)B10);
+	t_tag_2e430 = (u64)(*(u32 *)t__2e423);
+	t__2e438 = (u64)(u32)(((u32)t_tag_2e430 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e438) goto L_member_2e435; else goto L__2e437;
+	L__2e437:;
+	t__2e440 = (u64)(u32)(((u32)t_tag_2e430 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e440) goto L_member_2e436; else goto L__2e439;
+	L__2e439:;
+	goto L_matches_2e434;
+	L_member_2e435:;
+	goto L_matches_2e434;
+	L_member_2e436:;
+	goto L_matches_2e433;
+	L_matches_2e433:;
+	goto L__2e431;
+	L_matches_2e434:;
+	t_abortsite_2e408 = ((u64)2UL);
+	goto L_abort_2e409;
+	L__2e441:;
+	L__2e432:;
+	t_abortsite_2e408 = ((u64)3UL);
+	goto L_abort_2e416;
+	L__2e431:;
+	goto L__2e380;
+	L__2e442:;
+	L__2e380:;
+	return;
+	L_abort_2e409:;
+	t__2e410 = (u64)((u64)t_abortsite_2e408 * (u64)((u64)16UL));
+	t__2e410 = (u64)((u64)((u64)((char *)&D_abortsites_2e407)) + (u64)t__2e410);
+	t__2e411 = (u64)(*(u64 *)t__2e410);
+	t__2e412 = (u64)((u64)t__2e410 + (u64)((u64)8UL));
+	t__2e413 = (u64)(*(u32 *)t__2e412);
+	t__2e412 = (u64)((u64)t__2e410 + (u64)((u64)12UL));
+	t__2e414 = (u64)(*(u32 *)t__2e412);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e411, (u64)t__2e413, (u64)t__2e414, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e416:;
+	t__2e417 = (u64)((u64)t_abortsite_2e408 * (u64)((u64)16UL));
+	t__2e417 = (u64)((u64)((u64)((char *)&D_abortsites_2e407)) + (u64)t__2e417);
+	t__2e418 = (u64)(*(u64 *)t__2e417);
+	t__2e419 = (u64)((u64)t__2e417 + (u64)((u64)8UL));
+	t__2e420 = (u64)(*(u32 *)t__2e419);
+	t__2e419 = (u64)((u64)t__2e417 + (u64)((u64)12UL));
+	t__2e421 = (u64)(*(u32 *)t__2e419);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e418, (u64)t__2e420, (u64)t__2e421, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_assert__(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[168] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char B8[24] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char B12[24] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char B15[24] __attribute__((aligned(16)));
+	char R16[24] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char R18[24] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char R20[24] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[8] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char B24[24] __attribute__((aligned(16)));
+	char R25[4] __attribute__((aligned(16)));
+	char B26[8] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char B28[24] __attribute__((aligned(16)));
+	char R29[4] __attribute__((aligned(16)));
+	u64 t__2e470;
+	u64 t__2e473;
+	u64 t__2e476;
+	u64 t__2e479;
+	u64 t__2e480;
+	u64 t__2e484;
+	u64 t__2e485;
+	u64 t__2e486;
+	u64 t__2e487;
+	u64 t__2e488;
+	u64 t__2e512;
+	u64 t__2e513;
+	u64 t__2e517;
+	u64 t__2e519;
+	u64 t__2e520;
+	u64 t__2e521;
+	u64 t__2e523;
+	u64 t__2e532;
+	u64 t__2e534;
+	u64 t__2e536;
+	u64 t__2e537;
+	u64 t__2e538;
+	u64 t__2e539;
+	u64 t__2e540;
+	u64 t__2e543;
+	u64 t__2e544;
+	u64 t__2e545;
+	u64 t__2e546;
+	u64 t__2e547;
+	u64 t__2e549;
+	u64 t__2e551;
+	u64 t__2e553;
+	u64 t__2e557;
+	u64 t__2e566;
+	u64 t__2e568;
+	u64 t_abortsite_2e482;
+	u64 t_binding_2e447;
+	u64 t_binding_2e489;
+	u64 t_binding_2e511;
+	u64 t_item_2e491;
+	u64 t_object_2e518;
+	u64 t_object_2e522;
+	u64 t_object_2e552;
+	u64 t_object_2e556;
+	u64 t_tag_2e524;
+	u64 t_tag_2e558;
+	L_start_2e443:;
+	t_binding_2e447 = (u64)A0;
+	t_binding_2e489 = (u64)A1;
+	t_binding_2e511 = (u64)A2;
+	t_object_2e518 = (u64)A3;
+	t_object_2e522 = (u64)A4;
+	t_object_2e552 = (u64)A5;
+	t_object_2e556 = (u64)A6;
+	L_body_2e444:;
+	BLIT(t_binding_2e447, ((u64)((char *)&D_strliteral_2e449)), ((u64)24UL));
+	if ((u32)((u64)1UL)) goto L_passed_2e451; else goto L_failed_2e450;
+	L_failed_2e450:;
+	BLIT((u64)B7, ((u64)((char *)&D_strliteral_2e449)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)42UL), (u64)((u64)15UL), (u64)B7);
+	__builtin_trap();
+	L_passed_2e451:;
+	if ((u32)((u64)1UL)) goto L_passed_2e453; else goto L_failed_2e452;
+	L_failed_2e452:;
+	BLIT((u64)B8, ((u64)((char *)&D_strliteral_2e449)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)43UL), (u64)((u64)15UL), (u64)B8);
+	__builtin_trap();
+	L_passed_2e453:;
+	if ((u32)((u64)1UL)) goto L_passed_2e455; else goto L_failed_2e454;
+	L_failed_2e454:;
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e449)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)44UL), (u64)((u64)15UL), (u64)B9);
+	__builtin_trap();
+	L_passed_2e455:;
+	if ((u32)((u64)1UL)) goto L_passed_2e457; else goto L_failed_2e456;
+	L_failed_2e456:;
+	BLIT((u64)B10, ((u64)((char *)&D_strliteral_2e449)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)45UL), (u64)((u64)15UL), (u64)B10);
+	__builtin_trap();
+	L_passed_2e457:;
+	if ((u32)((u64)1UL)) goto L_passed_2e459; else goto L_failed_2e458;
+	L_failed_2e458:;
+	BLIT((u64)B11, ((u64)((char *)&D_strliteral_2e449)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)46UL), (u64)((u64)15UL), (u64)B11);
+	__builtin_trap();
+	L_passed_2e459:;
+	if ((u32)((u64)1UL)) goto L_passed_2e461; else goto L_failed_2e460;
+	L_failed_2e460:;
+	BLIT((u64)B12, ((u64)((char *)&D_strliteral_2e449)), 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)47UL), (u64)((u64)15UL), (u64)B12);
+	__builtin_trap();
+	L_passed_2e461:;
+	if ((u32)((u64)1UL)) goto L_passed_2e463; else goto L_failed_2e462;
+	L_failed_2e462:;
+	BLIT((u64)B13, t_binding_2e447, 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)48UL), (u64)((u64)15UL), (u64)B13);
+	__builtin_trap();
+	L_passed_2e463:;
+	if ((u32)((u64)1UL)) goto L_passed_2e465; else goto L_failed_2e464;
+	L_failed_2e464:;
+	BLIT((u64)B14, t_binding_2e447, 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)49UL), (u64)((u64)15UL), (u64)B14);
+	__builtin_trap();
+	L_passed_2e465:;
+	if ((u32)((u64)1UL)) goto L_passed_2e467; else goto L_failed_2e466;
+	L_failed_2e466:;
+	BLIT((u64)B15, t_binding_2e447, 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)50UL), (u64)((u64)15UL), (u64)B15);
+	__builtin_trap();
+	L_passed_2e467:;
+	if ((u32)((u64)1UL)) goto L_passed_2e469; else goto L_failed_2e468;
+	L_failed_2e468:;
+	t__2e470 = ((u64 (*)(u64))((u64)((char *)&F_foofn)))((u64)R16);
+	BLIT((u64)B17, t__2e470, 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)51UL), (u64)((u64)15UL), (u64)B17);
+	__builtin_trap();
+	L_passed_2e469:;
+	if ((u32)((u64)1UL)) goto L_passed_2e472; else goto L_failed_2e471;
+	L_failed_2e471:;
+	t__2e473 = ((u64 (*)(u64))((u64)((char *)&F_foofn)))((u64)R18);
+	BLIT((u64)B19, t__2e473, 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)52UL), (u64)((u64)15UL), (u64)B19);
+	__builtin_trap();
+	L_passed_2e472:;
+	if ((u32)((u64)1UL)) goto L_passed_2e475; else goto L_failed_2e474;
+	L_failed_2e474:;
+	t__2e476 = ((u64 (*)(u64))((u64)((char *)&F_foofn)))((u64)R20);
+	BLIT((u64)B21, t__2e476, 24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort))((u64)((u64)((char *)&D_strliteral_2e1)), (u64)((u64)53UL), (u64)((u64)15UL), (u64)B21);
+	__builtin_trap();
+	L_passed_2e475:;
+	t__2e480 = (u64)(u32)(*(i32 *)((u64)((char *)&D_global)));
+	t__2e479 = (u64)(u32)(((u32)t__2e480 == (u32)((u64)0UL)));
+	if ((u32)t__2e479) goto L_passed_2e478; else goto L_failed_2e477;
+	L_failed_2e477:;
+	t_abortsite_2e482 = ((u64)0UL);
+	goto L_abort_2e483;
+	L_passed_2e478:;
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)0UL));
+	BLIT(t_item_2e491, ((u64)((char *)&D_strliteral_2e493)), ((u64)24UL));
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)24UL));
+	BLIT(t_item_2e491, ((u64)((char *)&D_strliteral_2e495)), ((u64)24UL));
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)48UL));
+	BLIT(t_item_2e491, ((u64)((char *)&D_strliteral_2e497)), ((u64)24UL));
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)72UL));
+	BLIT(t_item_2e491, ((u64)((char *)&D_strliteral_2e499)), ((u64)24UL));
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)96UL));
+	BLIT(t_item_2e491, ((u64)((char *)&D_strliteral_2e501)), ((u64)24UL));
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)120UL));
+	BLIT(t_item_2e491, ((u64)((char *)&D_strliteral_2e503)), ((u64)24UL));
+	t_item_2e491 = (u64)((u64)t_binding_2e489 + (u64)((u64)144UL));
+	BLIT(t_item_2e491, ((u64)((char *)&D_strliteral_2e505)), ((u64)24UL));
+	*(u64 *)t_binding_2e511 = (u64)((u64)0UL);
+	L_loop_2e506:;
+	t__2e513 = (u64)(*(u64 *)t_binding_2e511);
+	t__2e512 = (u64)(u32)(((u64)t__2e513 < (u64)((u64)7UL)));
+	if ((u32)t__2e512) goto L_body_2e507; else goto L__2e509;
+	L_body_2e507:;
+	*(u32 *)t_object_2e518 = (u32)((u64)3532310079UL);
+	t__2e519 = (u64)((u64)t_object_2e518 + (u64)((u64)4UL));
+	*(u32 *)t__2e519 = (u32)((u64)4UL);
+	t__2e521 = (u64)(*(u64 *)t_binding_2e511);
+	t__2e520 = (u64)((u64)t__2e521 * (u64)((u64)24UL));
+	t__2e520 = (u64)((u64)t_binding_2e489 + (u64)t__2e520);
+	*(u64 *)t_object_2e522 = (u64)((u64)0UL);
+	t__2e523 = (u64)((u64)t_object_2e522 + (u64)((u64)8UL));
+	*(u64 *)t__2e523 = (u64)((u64)0UL);
+	t__2e523 = (u64)((u64)t__2e523 + (u64)((u64)8UL));
+	*(u64 *)t__2e523 = (u64)((u64)0UL);
+	BLIT((u64)B22, t_object_2e518, 8);
+	BLIT((u64)B23, t__2e520, 24);
+	BLIT((u64)B24, t_object_2e522, 24);
+	t__2e517 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R25, (u64)B22, (u64)B23, (u64)B24);
+	t_tag_2e524 = (u64)(*(u32 *)t__2e517);
+	t__2e532 = (u64)(u32)(((u32)t_tag_2e524 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e532) goto L_member_2e529; else goto L__2e531;
+	L__2e531:;
+	t__2e534 = (u64)(u32)(((u32)t_tag_2e524 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e534) goto L_member_2e530; else goto L__2e533;
+	L__2e533:;
+	goto L_matches_2e528;
+	L_member_2e529:;
+	goto L_matches_2e528;
+	L_member_2e530:;
+	goto L_matches_2e527;
+	L_matches_2e527:;
+	goto L__2e525;
+	L_matches_2e528:;
+	t_abortsite_2e482 = ((u64)1UL);
+	goto L_abort_2e535;
+	L__2e541:;
+	L__2e526:;
+	t_abortsite_2e482 = ((u64)2UL);
+	goto L_abort_2e542;
+	L__2e525:;
+	goto L__2e514;
+	L__2e548:;
+	L__2e514:;
+	L_after_2e510:;
+	t__2e549 = (u64)(*(u64 *)t_binding_2e511);
+	t__2e549 = (u64)((u64)t__2e549 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e511 = (u64)t__2e549;
+	goto L_loop_2e506;
+	L__2e509:;
+	*(u32 *)t_object_2e552 = (u32)((u64)3532310079UL);
+	t__2e553 = (u64)((u64)t_object_2e552 + (u64)((u64)4UL));
+	*(u32 *)t__2e553 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e556 = (u64)((u64)0UL);
+	t__2e557 = (u64)((u64)t_object_2e556 + (u64)((u64)8UL));
+	*(u64 *)t__2e557 = (u64)((u64)0UL);
+	t__2e557 = (u64)((u64)t__2e557 + (u64)((u64)8UL));
+	*(u64 *)t__2e557 = (u64)((u64)0UL);
+	BLIT((u64)B26, t_object_2e552, 8);
+	BLIT((u64)B27, ((u64)((char *)&D_strliteral_2e555)), 24);
+	BLIT((u64)B28, t_object_2e556, 24);
+	t__2e551 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R29, (u64)B26, (u64)B27, (u64)B28);
+	t_tag_2e558 = (u64)(*(u32 *)t__2e551);
+	t__2e566 = (u64)(u32)(((u32)t_tag_2e558 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e566) goto L_member_2e563; else goto L__2e565;
+	L__2e565:;
+	t__2e568 = (u64)(u32)(((u32)t_tag_2e558 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e568) goto L_member_2e564; else goto L__2e567;
+	L__2e567:;
+	goto L_matches_2e562;
+	L_member_2e563:;
+	goto L_matches_2e562;
+	L_member_2e564:;
+	goto L_matches_2e561;
+	L_matches_2e561:;
+	goto L__2e559;
+	L_matches_2e562:;
+	t_abortsite_2e482 = ((u64)3UL);
+	goto L_abort_2e535;
+	L__2e569:;
+	L__2e560:;
+	t_abortsite_2e482 = ((u64)4UL);
+	goto L_abort_2e542;
+	L__2e559:;
+	goto L__2e445;
+	L__2e570:;
+	L__2e445:;
+	return;
+	L_abort_2e483:;
+	t__2e484 = (u64)((u64)t_abortsite_2e482 * (u64)((u64)16UL));
+	t__2e484 = (u64)((u64)((u64)((char *)&D_abortsites_2e481)) + (u64)t__2e484);
+	t__2e485 = (u64)(*(u64 *)t__2e484);
+	t__2e486 = (u64)((u64)t__2e484 + (u64)((u64)8UL));
+	t__2e487 = (u64)(*(u32 *)t__2e486);
+	t__2e486 = (u64)((u64)t__2e484 + (u64)((u64)12UL));
+	t__2e488 = (u64)(*(u32 *)t__2e486);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e485, (u64)t__2e487, (u64)t__2e488, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e535:;
+	t__2e536 = (u64)((u64)t_abortsite_2e482 * (u64)((u64)16UL));
+	t__2e536 = (u64)((u64)((u64)((char *)&D_abortsites_2e481)) + (u64)t__2e536);
+	t__2e537 = (u64)(*(u64 *)t__2e536);
+	t__2e538 = (u64)((u64)t__2e536 + (u64)((u64)8UL));
+	t__2e539 = (u64)(*(u32 *)t__2e538);
+	t__2e538 = (u64)((u64)t__2e536 + (u64)((u64)12UL));
+	t__2e540 = (u64)(*(u32 *)t__2e538);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e537, (u64)t__2e539, (u64)t__2e540, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e542:;
+	t__2e543 = (u64)((u64)t_abortsite_2e482 * (u64)((u64)16UL));
+	t__2e543 = (u64)((u64)((u64)((char *)&D_abortsites_2e481)) + (u64)t__2e543);
+	t__2e544 = (u64)(*(u64 *)t__2e543);
+	t__2e545 = (u64)((u64)t__2e543 + (u64)((u64)8UL));
+	t__2e546 = (u64)(*(u32 *)t__2e545);
+	t__2e545 = (u64)((u64)t__2e543 + (u64)((u64)12UL));
+	t__2e547 = (u64)(*(u32 *)t__2e545);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e544, (u64)t__2e546, (u64)t__2e547, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static u64 F_foofn(u64 __rp) {
+	u64 t__2e575;
+	L_start_2e571:;
+	L_body_2e572:;
+	t__2e575 = (u64)(u32)(*(i32 *)((u64)((char *)&D_global)));
+	t__2e575 = (u64)(u32)((u32)t__2e575 + (u32)((u64)1UL));
+	*(u32 *)((u64)((char *)&D_global)) = (u32)t__2e575;
+	BLIT(__rp, ((u64)((char *)&D_strliteral_2e449)), 24); return __rp;
+	L__2e576:;
+	L__2e573:;
+	L__2e577:;
+	return 0;
+}
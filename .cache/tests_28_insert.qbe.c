@@ -0,0 +1,2556 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2eensure[] __asm__("rt.ensure");
+extern char X_rt_2efree[] __asm__("rt.free");
+extern char X_rt_2emalloc[] __asm__("rt.malloc");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+extern char X_rt_2ememmove[] __asm__("rt.memmove");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e21 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_strdata_2e50 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[16]; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18[16]; u8 f19; u8 f20; u8 f21; u8 f22[2]; u8 f23; u8 f24; };
+struct __attribute__((packed)) S_strliteral_2e51 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e86 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[13]; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18[19]; u8 f19; u8 f20; u8 f21; u8 f22[2]; u8 f23; u8 f24; };
+struct __attribute__((packed)) S_strliteral_2e87 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e106 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[20]; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18[19]; u8 f19; u8 f20; u8 f21; u8 f22[2]; u8 f23; u8 f24; };
+struct __attribute__((packed)) S_strliteral_2e107 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e126 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[26]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e127 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e146 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[27]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e147 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e166 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[22]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e167 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e186 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[27]; u8 f14; u8 f15; u8 f16; u8 f17; u8 f18[17]; u8 f19; u8 f20; u8 f21; u8 f22[2]; u8 f23; u8 f24; };
+struct __attribute__((packed)) S_strliteral_2e187 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e206 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[27]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e207 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e226 { u8 f0; u8 f1; u8 f2; u8 f3[18]; u8 f4; u8 f5; u8 f6; u8 f7; u8 f8[20]; u8 f9; u8 f10; u8 f11; u8 f12; u8 f13[28]; u8 f14; u8 f15; u8 f16; u8 f17[2]; u8 f18; u8 f19; };
+struct __attribute__((packed)) S_strliteral_2e227 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e246 { u8 f0; u8 f1; u8 f2; u8 f3[14]; u8 f4; u8 f5; u8 f6; u8 f7[18]; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12[27]; u8 f13; u8 f14; u8 f15; u8 f16; u8 f17[16]; u8 f18; u8 f19; u8 f20; u8 f21[2]; u8 f22; u8 f23; };
+struct __attribute__((packed)) S_strliteral_2e247 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e67 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; };
+struct __attribute__((packed)) S_abortsites_2e277 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; };
+struct __attribute__((packed)) S_abortsites_2e367 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_abortsites_2e470 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; };
+struct __attribute__((packed)) S_abortsites_2e684 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; };
+struct __attribute__((packed)) S_abortsites_2e883 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e21 D_abortsites_2e21 __asm__("abortsites.21") __attribute__((used, section(".data.rel.ro.abortsites.21"), aligned(8)));
+static const struct S_strdata_2e50 D_strdata_2e50 __asm__("strdata.50") __attribute__((used, section(".rodata.strdata.50"), aligned(8)));
+static struct S_strliteral_2e51 D_strliteral_2e51 __asm__("strliteral.51") __attribute__((used, section(".data.rel.ro.strliteral.51"), aligned(8)));
+static const struct S_strdata_2e86 D_strdata_2e86 __asm__("strdata.86") __attribute__((used, section(".rodata.strdata.86"), aligned(8)));
+static struct S_strliteral_2e87 D_strliteral_2e87 __asm__("strliteral.87") __attribute__((used, section(".data.rel.ro.strliteral.87"), aligned(8)));
+static const struct S_strdata_2e106 D_strdata_2e106 __asm__("strdata.106") __attribute__((used, section(".rodata.strdata.106"), aligned(8)));
+static struct S_strliteral_2e107 D_strliteral_2e107 __asm__("strliteral.107") __attribute__((used, section(".data.rel.ro.strliteral.107"), aligned(8)));
+static const struct S_strdata_2e126 D_strdata_2e126 __asm__("strdata.126") __attribute__((used, section(".rodata.strdata.126"), aligned(8)));
+static struct S_strliteral_2e127 D_strliteral_2e127 __asm__("strliteral.127") __attribute__((used, section(".data.rel.ro.strliteral.127"), aligned(8)));
+static const struct S_strdata_2e146 D_strdata_2e146 __asm__("strdata.146") __attribute__((used, section(".rodata.strdata.146"), aligned(8)));
+static struct S_strliteral_2e147 D_strliteral_2e147 __asm__("strliteral.147") __attribute__((used, section(".data.rel.ro.strliteral.147"), aligned(8)));
+static const struct S_strdata_2e166 D_strdata_2e166 __asm__("strdata.166") __attribute__((used, section(".rodata.strdata.166"), aligned(8)));
+static struct S_strliteral_2e167 D_strliteral_2e167 __asm__("strliteral.167") __attribute__((used, section(".data.rel.ro.strliteral.167"), aligned(8)));
+static const struct S_strdata_2e186 D_strdata_2e186 __asm__("strdata.186") __attribute__((used, section(".rodata.strdata.186"), aligned(8)));
+static struct S_strliteral_2e187 D_strliteral_2e187 __asm__("strliteral.187") __attribute__((used, section(".data.rel.ro.strliteral.187"), aligned(8)));
+static const struct S_strdata_2e206 D_strdata_2e206 __asm__("strdata.206") __attribute__((used, section(".rodata.strdata.206"), aligned(8)));
+static struct S_strliteral_2e207 D_strliteral_2e207 __asm__("strliteral.207") __attribute__((used, section(".data.rel.ro.strliteral.207"), aligned(8)));
+static const struct S_strdata_2e226 D_strdata_2e226 __asm__("strdata.226") __attribute__((used, section(".rodata.strdata.226"), aligned(8)));
+static struct S_strliteral_2e227 D_strliteral_2e227 __asm__("strliteral.227") __attribute__((used, section(".data.rel.ro.strliteral.227"), aligned(8)));
+static const struct S_strdata_2e246 D_strdata_2e246 __asm__("strdata.246") __attribute__((used, section(".rodata.strdata.246"), aligned(8)));
+static struct S_strliteral_2e247 D_strliteral_2e247 __asm__("strliteral.247") __attribute__((used, section(".data.rel.ro.strliteral.247"), aligned(8)));
+static struct S_abortsites_2e67 D_abortsites_2e67 __asm__("abortsites.67") __attribute__((used, section(".data.rel.ro.abortsites.67"), aligned(8)));
+static struct S_abortsites_2e277 D_abortsites_2e277 __asm__("abortsites.277") __attribute__((used, section(".data.rel.ro.abortsites.277"), aligned(8)));
+static struct S_abortsites_2e367 D_abortsites_2e367 __asm__("abortsites.367") __attribute__((used, section(".data.rel.ro.abortsites.367"), aligned(8)));
+static struct S_abortsites_2e470 D_abortsites_2e470 __asm__("abortsites.470") __attribute__((used, section(".data.rel.ro.abortsites.470"), aligned(8)));
+static struct S_abortsites_2e684 D_abortsites_2e684 __asm__("abortsites.684") __attribute__((used, section(".data.rel.ro.abortsites.684"), aligned(8)));
+static struct S_abortsites_2e883 D_abortsites_2e883 __asm__("abortsites.883") __attribute__((used, section(".data.rel.ro.abortsites.883"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F___never(void) __asm__("_never") __attribute__((used, section(".text._never")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_typehints(void) __asm__("typehints") __attribute__((used, section(".text.typehints")));
+static void F_withlength(void) __asm__("withlength") __attribute__((used, section(".text.withlength")));
+static void F___static(void) __asm__("_static") __attribute__((used, section(".text._static")));
+static void F_multi(void) __asm__("multi") __attribute__((used, section(".text.multi")));
+static void F_basics(void) __asm__("basics") __attribute__((used, section(".text.basics")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\062\070\055\151\156\163\145\162\164\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 18U, 18U };
+static struct S_abortsites_2e21 D_abortsites_2e21 = { (char *)((char *)&D_strliteral_2e1) + 0, 155U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 156U, 14U };
+static const struct S_strdata_2e50 D_strdata_2e50 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\154\145\164\040\171\072\040\151\156\164\040\075\040\064\062\073", 10U, 9U, 9U, 9U, "\151\156\163\145\162\164\050\170\133\061\135\054\040\171\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e51 D_strliteral_2e51 = { (char *)((char *)&D_strdata_2e50) + 0, 92U, 92U };
+static const struct S_strdata_2e86 D_strdata_2e86 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\154\145\164\040\171\040\075\040\064\062\165\070\073", 10U, 9U, 9U, 9U, "\151\156\163\145\162\164\050\170\133\061\135\054\040\171\056\056\056\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e87 D_strliteral_2e87 = { (char *)((char *)&D_strdata_2e86) + 0, 92U, 92U };
+static const struct S_strdata_2e106 D_strdata_2e106 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\154\145\164\040\171\072\040\133\135\151\156\164\040\075\040\133\064\062\135\073", 10U, 9U, 9U, 9U, "\151\156\163\145\162\164\050\170\133\061\135\054\040\171\056\056\056\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e107 D_strliteral_2e107 = { (char *)((char *)&D_strdata_2e106) + 0, 99U, 99U };
+static const struct S_strdata_2e126 D_strdata_2e126 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\151\156\163\145\162\164\050\170\133\061\135\054\040\133\064\062\151\056\056\056\135\054\040\063\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e127 D_strliteral_2e127 = { (char *)((char *)&D_strdata_2e126) + 0, 82U, 82U };
+static const struct S_strdata_2e146 D_strdata_2e146 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\151\156\163\145\162\164\050\170\133\061\135\054\040\133\060\165\070\056\056\056\135\054\040\062\151\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e147 D_strliteral_2e147 = { (char *)((char *)&D_strdata_2e146) + 0, 83U, 83U };
+static const struct S_strdata_2e166 D_strdata_2e166 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\151\156\163\145\162\164\050\170\133\061\135\054\040\133\064\062\135\054\040\063\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e167 D_strliteral_2e167 = { (char *)((char *)&D_strdata_2e166) + 0, 78U, 78U };
+static const struct S_strdata_2e186 D_strdata_2e186 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\156\165\154\154\141\142\154\145\040\052\133\135\165\070\040\075\040\046\170\073", 10U, 9U, 9U, 9U, "\151\156\163\145\162\164\050\170\133\061\135\054\040\064\062\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e187 D_strliteral_2e187 = { (char *)((char *)&D_strdata_2e186) + 0, 104U, 104U };
+static const struct S_strdata_2e206 D_strdata_2e206 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\151\156\163\145\162\164\050\170\133\061\135\054\040\133\060\056\056\056\135\056\056\056\054\040\063\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e207 D_strliteral_2e207 = { (char *)((char *)&D_strdata_2e206) + 0, 83U, 83U };
+static const struct S_strdata_2e226 D_strdata_2e226 = { 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\072\040\133\135\165\070\040\075\040\133\060\165\070\135\073", 10U, 9U, 9U, 9U, "\151\156\163\145\162\164\050\170\133\061\135\054\040\133\061\135\072\040\133\052\135\165\070\056\056\056\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e227 D_strliteral_2e227 = { (char *)((char *)&D_strdata_2e226) + 0, 84U, 84U };
+static const struct S_strdata_2e246 D_strdata_2e246 = { 10U, 9U, 9U, "\154\145\164\040\171\072\040\157\160\141\161\165\145\073", 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\154\145\164\040\170\040\075\040\133\135\072\040\133\135\165\070\072\040\133\135\157\160\141\161\165\145\073", 10U, 9U, 9U, 9U, "\151\156\163\145\162\164\050\170\133\060\135\054\040\171\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e247 D_strliteral_2e247 = { (char *)((char *)&D_strdata_2e246) + 0, 96U, 96U };
+static struct S_abortsites_2e67 D_abortsites_2e67 = { (char *)((char *)&D_strliteral_2e1) + 0, 92U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 92U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 99U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 99U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 118U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 118U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 124U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 124U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 131U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 131U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 137U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 137U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 143U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 150U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 150U, 12U };
+static struct S_abortsites_2e277 D_abortsites_2e277 = { (char *)((char *)&D_strliteral_2e1) + 0, 77U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 78U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 79U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 80U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 80U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 81U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 81U, 15U };
+static struct S_abortsites_2e367 D_abortsites_2e367 = { (char *)((char *)&D_strliteral_2e1) + 0, 64U, 25U, (char *)((char *)&D_strliteral_2e1) + 0, 65U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 67U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 69U, 23U };
+static struct S_abortsites_2e470 D_abortsites_2e470 = { (char *)((char *)&D_strliteral_2e1) + 0, 43U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 44U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 44U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 45U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 45U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 46U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 48U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 49U, 27U, (char *)((char *)&D_strliteral_2e1) + 0, 49U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 53U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 53U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 55U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 58U, 26U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 16U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 15U };
+static struct S_abortsites_2e684 D_abortsites_2e684 = { (char *)((char *)&D_strliteral_2e1) + 0, 18U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 20U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 22U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 26U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 29U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 35U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 35U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 37U, 15U };
+static struct S_abortsites_2e883 D_abortsites_2e883 = { (char *)((char *)&D_strliteral_2e1) + 0, 4U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 6U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 7U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 8U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 10U, 25U, (char *)((char *)&D_strliteral_2e1) + 0, 10U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 12U, 9U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_basics)))();
+	((void (*)(void))((u64)((char *)&F_multi)))();
+	((void (*)(void))((u64)((char *)&F___static)))();
+	((void (*)(void))((u64)((char *)&F_withlength)))();
+	((void (*)(void))((u64)((char *)&F_typehints)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	((void (*)(void))((u64)((char *)&F___never)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F___never(void) {
+	char A0[24] __attribute__((aligned(16)));
+	u64 t__2e12;
+	u64 t__2e14;
+	u64 t__2e15;
+	u64 t__2e16;
+	u64 t__2e17;
+	u64 t__2e18;
+	u64 t__2e24;
+	u64 t__2e25;
+	u64 t__2e26;
+	u64 t__2e27;
+	u64 t__2e28;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t__2e33;
+	u64 t__2e34;
+	u64 t__2e35;
+	u64 t_abortsite_2e22;
+	u64 t_binding_2e11;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	L_body_2e8:;
+	*(u64 *)t_binding_2e11 = (u64)((u64)0UL);
+	t__2e12 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	*(u64 *)t__2e12 = (u64)((u64)0UL);
+	t__2e12 = (u64)((u64)t__2e12 + (u64)((u64)8UL));
+	*(u64 *)t__2e12 = (u64)((u64)0UL);
+	t__2e14 = (u64)((u64)t_binding_2e11 + (u64)((u64)8UL));
+	t__2e15 = (u64)((u64)t_binding_2e11 + (u64)((u64)16UL));
+	t__2e16 = (u64)(*(u64 *)t__2e14);
+	t__2e17 = (u64)((i64)(i32)((u64)0UL));
+	t__2e18 = (u64)(u32)(((u64)t__2e17 <= (u64)t__2e16));
+	if ((u32)t__2e18) goto L__2e20; else goto L__2e19;
+	L__2e19:;
+	t_abortsite_2e22 = ((u64)0UL);
+	goto L_abort_2e23;
+	L__2e20:;
+	return;
+	L__2e29:;
+	t_abortsite_2e22 = ((u64)1UL);
+	goto L_abort_2e30;
+	L__2e36:;
+	L__2e9:;
+	L__2e37:;
+	return;
+	L_abort_2e23:;
+	t__2e24 = (u64)((u64)t_abortsite_2e22 * (u64)((u64)16UL));
+	t__2e24 = (u64)((u64)((u64)((char *)&D_abortsites_2e21)) + (u64)t__2e24);
+	t__2e25 = (u64)(*(u64 *)t__2e24);
+	t__2e26 = (u64)((u64)t__2e24 + (u64)((u64)8UL));
+	t__2e27 = (u64)(*(u32 *)t__2e26);
+	t__2e26 = (u64)((u64)t__2e24 + (u64)((u64)12UL));
+	t__2e28 = (u64)(*(u32 *)t__2e26);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e25, (u64)t__2e27, (u64)t__2e28, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e30:;
+	t__2e31 = (u64)((u64)t_abortsite_2e22 * (u64)((u64)16UL));
+	t__2e31 = (u64)((u64)((u64)((char *)&D_abortsites_2e21)) + (u64)t__2e31);
+	t__2e32 = (u64)(*(u64 *)t__2e31);
+	t__2e33 = (u64)((u64)t__2e31 + (u64)((u64)8UL));
+	t__2e34 = (u64)(*(u32 *)t__2e33);
+	t__2e33 = (u64)((u64)t__2e31 + (u64)((u64)12UL));
+	t__2e35 = (u64)(*(u32 *)t__2e33);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e32, (u64)t__2e34, (u64)t__2e35, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_reject(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char B20[8] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char R23[4] __attribute__((aligned(16)));
+	char B24[8] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char R27[4] __attribute__((aligned(16)));
+	char B28[8] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char R31[4] __attribute__((aligned(16)));
+	char B32[8] __attribute__((aligned(16)));
+	char B33[24] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char R35[4] __attribute__((aligned(16)));
+	char B36[8] __attribute__((aligned(16)));
+	char B37[24] __attribute__((aligned(16)));
+	char B38[24] __attribute__((aligned(16)));
+	char R39[4] __attribute__((aligned(16)));
+	char B40[8] __attribute__((aligned(16)));
+	char B41[24] __attribute__((aligned(16)));
+	char B42[24] __attribute__((aligned(16)));
+	char R43[4] __attribute__((aligned(16)));
+	char B44[8] __attribute__((aligned(16)));
+	char B45[24] __attribute__((aligned(16)));
+	char B46[24] __attribute__((aligned(16)));
+	char R47[4] __attribute__((aligned(16)));
+	char B48[8] __attribute__((aligned(16)));
+	char B49[24] __attribute__((aligned(16)));
+	char B50[24] __attribute__((aligned(16)));
+	char R51[4] __attribute__((aligned(16)));
+	char B52[8] __attribute__((aligned(16)));
+	char B53[24] __attribute__((aligned(16)));
+	char B54[24] __attribute__((aligned(16)));
+	char R55[4] __attribute__((aligned(16)));
+	char B56[8] __attribute__((aligned(16)));
+	char B57[24] __attribute__((aligned(16)));
+	char B58[24] __attribute__((aligned(16)));
+	char R59[4] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e103;
+	u64 t__2e105;
+	u64 t__2e109;
+	u64 t__2e118;
+	u64 t__2e120;
+	u64 t__2e123;
+	u64 t__2e125;
+	u64 t__2e129;
+	u64 t__2e138;
+	u64 t__2e140;
+	u64 t__2e143;
+	u64 t__2e145;
+	u64 t__2e149;
+	u64 t__2e158;
+	u64 t__2e160;
+	u64 t__2e163;
+	u64 t__2e165;
+	u64 t__2e169;
+	u64 t__2e178;
+	u64 t__2e180;
+	u64 t__2e183;
+	u64 t__2e185;
+	u64 t__2e189;
+	u64 t__2e198;
+	u64 t__2e200;
+	u64 t__2e203;
+	u64 t__2e205;
+	u64 t__2e209;
+	u64 t__2e218;
+	u64 t__2e220;
+	u64 t__2e223;
+	u64 t__2e225;
+	u64 t__2e229;
+	u64 t__2e238;
+	u64 t__2e240;
+	u64 t__2e243;
+	u64 t__2e245;
+	u64 t__2e249;
+	u64 t__2e258;
+	u64 t__2e260;
+	u64 t__2e43;
+	u64 t__2e49;
+	u64 t__2e55;
+	u64 t__2e64;
+	u64 t__2e66;
+	u64 t__2e70;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t__2e73;
+	u64 t__2e74;
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e80;
+	u64 t__2e81;
+	u64 t__2e83;
+	u64 t__2e85;
+	u64 t__2e89;
+	u64 t__2e98;
+	u64 t_abortsite_2e68;
+	u64 t_object_2e104;
+	u64 t_object_2e108;
+	u64 t_object_2e124;
+	u64 t_object_2e128;
+	u64 t_object_2e144;
+	u64 t_object_2e148;
+	u64 t_object_2e164;
+	u64 t_object_2e168;
+	u64 t_object_2e184;
+	u64 t_object_2e188;
+	u64 t_object_2e204;
+	u64 t_object_2e208;
+	u64 t_object_2e224;
+	u64 t_object_2e228;
+	u64 t_object_2e244;
+	u64 t_object_2e248;
+	u64 t_object_2e45;
+	u64 t_object_2e53;
+	u64 t_object_2e84;
+	u64 t_object_2e88;
+	u64 t_tag_2e110;
+	u64 t_tag_2e130;
+	u64 t_tag_2e150;
+	u64 t_tag_2e170;
+	u64 t_tag_2e190;
+	u64 t_tag_2e210;
+	u64 t_tag_2e230;
+	u64 t_tag_2e250;
+	u64 t_tag_2e56;
+	u64 t_tag_2e90;
+	L_start_2e38:;
+	t_object_2e45 = (u64)A0;
+	t_object_2e53 = (u64)A1;
+	t_object_2e84 = (u64)A2;
+	t_object_2e88 = (u64)A3;
+	t_object_2e104 = (u64)A4;
+	t_object_2e108 = (u64)A5;
+	t_object_2e124 = (u64)A6;
+	t_object_2e128 = (u64)A7;
+	t_object_2e144 = (u64)A8;
+	t_object_2e148 = (u64)A9;
+	t_object_2e164 = (u64)A10;
+	t_object_2e168 = (u64)A11;
+	t_object_2e184 = (u64)A12;
+	t_object_2e188 = (u64)A13;
+	t_object_2e204 = (u64)A14;
+	t_object_2e208 = (u64)A15;
+	t_object_2e224 = (u64)A16;
+	t_object_2e228 = (u64)A17;
+	t_object_2e244 = (u64)A18;
+	t_object_2e248 = (u64)A19;
+	L_body_2e39:;
+	*(u32 *)t_object_2e45 = (u32)((u64)3532310079UL);
+	t__2e49 = (u64)((u64)t_object_2e45 + (u64)((u64)4UL));
+	*(u32 *)t__2e49 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e53 = (u64)((u64)0UL);
+	t__2e55 = (u64)((u64)t_object_2e53 + (u64)((u64)8UL));
+	*(u64 *)t__2e55 = (u64)((u64)0UL);
+	t__2e55 = (u64)((u64)t__2e55 + (u64)((u64)8UL));
+	*(u64 *)t__2e55 = (u64)((u64)0UL);
+	BLIT((u64)B20, t_object_2e45, 8);
+	BLIT((u64)B21, ((u64)((char *)&D_strliteral_2e51)), 24);
+	BLIT((u64)B22, t_object_2e53, 24);
+	t__2e43 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R23, (u64)B20, (u64)B21, (u64)B22);
+	t_tag_2e56 = (u64)(*(u32 *)t__2e43);
+	t__2e64 = (u64)(u32)(((u32)t_tag_2e56 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e64) goto L_member_2e61; else goto L__2e63;
+	L__2e63:;
+	t__2e66 = (u64)(u32)(((u32)t_tag_2e56 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e66) goto L_member_2e62; else goto L__2e65;
+	L__2e65:;
+	goto L_matches_2e60;
+	L_member_2e61:;
+	goto L_matches_2e60;
+	L_member_2e62:;
+	goto L_matches_2e59;
+	L_matches_2e59:;
+	goto L__2e57;
+	L_matches_2e60:;
+	t_abortsite_2e68 = ((u64)0UL);
+	goto L_abort_2e69;
+	L__2e75:;
+	L__2e58:;
+	t_abortsite_2e68 = ((u64)1UL);
+	goto L_abort_2e76;
+	L__2e57:;
+	*(u32 *)t_object_2e84 = (u32)((u64)3532310079UL);
+	t__2e85 = (u64)((u64)t_object_2e84 + (u64)((u64)4UL));
+	*(u32 *)t__2e85 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e88 = (u64)((u64)0UL);
+	t__2e89 = (u64)((u64)t_object_2e88 + (u64)((u64)8UL));
+	*(u64 *)t__2e89 = (u64)((u64)0UL);
+	t__2e89 = (u64)((u64)t__2e89 + (u64)((u64)8UL));
+	*(u64 *)t__2e89 = (u64)((u64)0UL);
+	BLIT((u64)B24, t_object_2e84, 8);
+	BLIT((u64)B25, ((u64)((char *)&D_strliteral_2e87)), 24);
+	BLIT((u64)B26, t_object_2e88, 24);
+	t__2e83 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R27, (u64)B24, (u64)B25, (u64)B26);
+	t_tag_2e90 = (u64)(*(u32 *)t__2e83);
+	t__2e98 = (u64)(u32)(((u32)t_tag_2e90 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e98) goto L_member_2e95; else goto L__2e97;
+	L__2e97:;
+	t__2e100 = (u64)(u32)(((u32)t_tag_2e90 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e100) goto L_member_2e96; else goto L__2e99;
+	L__2e99:;
+	goto L_matches_2e94;
+	L_member_2e95:;
+	goto L_matches_2e94;
+	L_member_2e96:;
+	goto L_matches_2e93;
+	L_matches_2e93:;
+	goto L__2e91;
+	L_matches_2e94:;
+	t_abortsite_2e68 = ((u64)2UL);
+	goto L_abort_2e69;
+	L__2e101:;
+	L__2e92:;
+	t_abortsite_2e68 = ((u64)3UL);
+	goto L_abort_2e76;
+	L__2e91:;
+	*(u32 *)t_object_2e104 = (u32)((u64)3532310079UL);
+	t__2e105 = (u64)((u64)t_object_2e104 + (u64)((u64)4UL));
+	*(u32 *)t__2e105 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e108 = (u64)((u64)0UL);
+	t__2e109 = (u64)((u64)t_object_2e108 + (u64)((u64)8UL));
+	*(u64 *)t__2e109 = (u64)((u64)0UL);
+	t__2e109 = (u64)((u64)t__2e109 + (u64)((u64)8UL));
+	*(u64 *)t__2e109 = (u64)((u64)0UL);
+	BLIT((u64)B28, t_object_2e104, 8);
+	BLIT((u64)B29, ((u64)((char *)&D_strliteral_2e107)), 24);
+	BLIT((u64)B30, t_object_2e108, 24);
+	t__2e103 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R31, (u64)B28, (u64)B29, (u64)B30);
+	t_tag_2e110 = (u64)(*(u32 *)t__2e103);
+	t__2e118 = (u64)(u32)(((u32)t_tag_2e110 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e118) goto L_member_2e115; else goto L__2e117;
+	L__2e117:;
+	t__2e120 = (u64)(u32)(((u32)t_tag_2e110 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e120) goto L_member_2e116; else goto L__2e119;
+	L__2e119:;
+	goto L_matches_2e114;
+	L_member_2e115:;
+	goto L_matches_2e114;
+	L_member_2e116:;
+	goto L_matches_2e113;
+	L_matches_2e113:;
+	goto L__2e111;
+	L_matches_2e114:;
+	t_abortsite_2e68 = ((u64)4UL);
+	goto L_abort_2e69;
+	L__2e121:;
+	L__2e112:;
+	t_abortsite_2e68 = ((u64)5UL);
+	goto L_abort_2e76;
+	L__2e111:;
+	*(u32 *)t_object_2e124 = (u32)((u64)3532310079UL);
+	t__2e125 = (u64)((u64)t_object_2e124 + (u64)((u64)4UL));
+	*(u32 *)t__2e125 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e128 = (u64)((u64)0UL);
+	t__2e129 = (u64)((u64)t_object_2e128 + (u64)((u64)8UL));
+	*(u64 *)t__2e129 = (u64)((u64)0UL);
+	t__2e129 = (u64)((u64)t__2e129 + (u64)((u64)8UL));
+	*(u64 *)t__2e129 = (u64)((u64)0UL);
+	BLIT((u64)B32, t_object_2e124, 8);
+	BLIT((u64)B33, ((u64)((char *)&D_strliteral_2e127)), 24);
+	BLIT((u64)B34, t_object_2e128, 24);
+	t__2e123 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R35, (u64)B32, (u64)B33, (u64)B34);
+	t_tag_2e130 = (u64)(*(u32 *)t__2e123);
+	t__2e138 = (u64)(u32)(((u32)t_tag_2e130 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e138) goto L_member_2e135; else goto L__2e137;
+	L__2e137:;
+	t__2e140 = (u64)(u32)(((u32)t_tag_2e130 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e140) goto L_member_2e136; else goto L__2e139;
+	L__2e139:;
+	goto L_matches_2e134;
+	L_member_2e135:;
+	goto L_matches_2e134;
+	L_member_2e136:;
+	goto L_matches_2e133;
+	L_matches_2e133:;
+	goto L__2e131;
+	L_matches_2e134:;
+	t_abortsite_2e68 = ((u64)6UL);
+	goto L_abort_2e69;
+	L__2e141:;
+	L__2e132:;
+	t_abortsite_2e68 = ((u64)7UL);
+	goto L_abort_2e76;
+	L__2e131:;
+	*(u32 *)t_object_2e144 = (u32)((u64)3532310079UL);
+	t__2e145 = (u64)((u64)t_object_2e144 + (u64)((u64)4UL));
+	*(u32 *)t__2e145 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e148 = (u64)((u64)0UL);
+	t__2e149 = (u64)((u64)t_object_2e148 + (u64)((u64)8UL));
+	*(u64 *)t__2e149 = (u64)((u64)0UL);
+	t__2e149 = (u64)((u64)t__2e149 + (u64)((u64)8UL));
+	*(u64 *)t__2e149 = (u64)((u64)0UL);
+	BLIT((u64)B36, t_object_2e144, 8);
+	BLIT((u64)B37, ((u64)((char *)&D_strliteral_2e147)), 24);
+	BLIT((u64)B38, t_object_2e148, 24);
+	t__2e143 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R39, (u64)B36, (u64)B37, (u64)B38);
+	t_tag_2e150 = (u64)(*(u32 *)t__2e143);
+	t__2e158 = (u64)(u32)(((u32)t_tag_2e150 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e158) goto L_member_2e155; else goto L__2e157;
+	L__2e157:;
+	t__2e160 = (u64)(u32)(((u32)t_tag_2e150 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e160) goto L_member_2e156; else goto L__2e159;
+	L__2e159:;
+	goto L_matches_2e154;
+	L_member_2e155:;
+	goto L_matches_2e154;
+	L_member_2e156:;
+	goto L_matches_2e153;
+	L_matches_2e153:;
+	goto L__2e151;
+	L_matches_2e154:;
+	t_abortsite_2e68 = ((u64)8UL);
+	goto L_abort_2e69;
+	L__2e161:;
+	L__2e152:;
+	t_abortsite_2e68 = ((u64)9UL);
+	goto L_abort_2e76;
+	L__2e151:;
+	*(u32 *)t_object_2e164 = (u32)((u64)3532310079UL);
+	t__2e165 = (u64)((u64)t_object_2e164 + (u64)((u64)4UL));
+	*(u32 *)t__2e165 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e168 = (u64)((u64)0UL);
+	t__2e169 = (u64)((u64)t_object_2e168 + (u64)((u64)8UL));
+	*(u64 *)t__2e169 = (u64)((u64)0UL);
+	t__2e169 = (u64)((u64)t__2e169 + (u64)((u64)8UL));
+	*(u64 *)t__2e169 = (u64)((u64)0UL);
+	BLIT((u64)B40, t_object_2e164, 8);
+	BLIT((u64)B41, ((u64)((char *)&D_strliteral_2e167)), 24);
+	BLIT((u64)B42, t_object_2e168, 24);
+	t__2e163 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R43, (u64)B40, (u64)B41, (u64)B42);
+	t_tag_2e170 = (u64)(*(u32 *)t__2e163);
+	t__2e178 = (u64)(u32)(((u32)t_tag_2e170 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e178) goto L_member_2e175; else goto L__2e177;
+	L__2e177:;
+	t__2e180 = (u64)(u32)(((u32)t_tag_2e170 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e180) goto L_member_2e176; else goto L__2e179;
+	L__2e179:;
+	goto L_matches_2e174;
+	L_member_2e175:;
+	goto L_matches_2e174;
+	L_member_2e176:;
+	goto L_matches_2e173;
+	L_matches_2e173:;
+	goto L__2e171;
+	L_matches_2e174:;
+	t_abortsite_2e68 = ((u64)10UL);
+	goto L_abort_2e69;
+	L__2e181:;
+	L__2e172:;
+	t_abortsite_2e68 = ((u64)11UL);
+	goto L_abort_2e76;
+	L__2e171:;
+	*(u32 *)t_object_2e184 = (u32)((u64)3532310079UL);
+	t__2e185 = (u64)((u64)t_object_2e184 + (u64)((u64)4UL));
+	*(u32 *)t__2e185 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e188 = (u64)((u64)0UL);
+	t__2e189 = (u64)((u64)t_object_2e188 + (u64)((u64)8UL));
+	*(u64 *)t__2e189 = (u64)((u64)0UL);
+	t__2e189 = (u64)((u64)t__2e189 + (u64)((u64)8UL));
+	*(u64 *)t__2e189 = (u64)((u64)0UL);
+	BLIT((u64)B44, t_object_2e184, 8);
+	BLIT((u64)B45, ((u64)((char *)&D_strliteral_2e187)), 24);
+	BLIT((u64)B46, t_object_2e188, 24);
+	t__2e183 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R47, (u64)B44, (u64)B45, (u64)B46);
+	t_tag_2e190 = (u64)(*(u32 *)t__2e183);
+	t__2e198 = (u64)(u32)(((u32)t_tag_2e190 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e198) goto L_member_2e195; else goto L__2e197;
+	L__2e197:;
+	t__2e200 = (u64)(u32)(((u32)t_tag_2e190 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e200) goto L_member_2e196; else goto L__2e199;
+	L__2e199:;
+	goto L_matches_2e194;
+	L_member_2e195:;
+	goto L_matches_2e194;
+	L_member_2e196:;
+	goto L_matches_2e193;
+	L_matches_2e193:;
+	goto L__2e191;
+	L_matches_2e194:;
+	t_abortsite_2e68 = ((u64)12UL);
+	goto L_abort_2e69;
+	L__2e201:;
+	L__2e192:;
+	t_abortsite_2e68 = ((u64)13UL);
+	goto L_abort_2e76;
+	L__2e191:;
+	*(u32 *)t_object_2e204 = (u32)((u64)3532310079UL);
+	t__2e205 = (u64)((u64)t_object_2e204 + (u64)((u64)4UL));
+	*(u32 *)t__2e205 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e208 = (u64)((u64)0UL);
+	t__2e209 = (u64)((u64)t_object_2e208 + (u64)((u64)8UL));
+	*(u64 *)t__2e209 = (u64)((u64)0UL);
+	t__2e209 = (u64)((u64)t__2e209 + (u64)((u64)8UL));
+	*(u64 *)t__2e209 = (u64)((u64)0UL);
+	BLIT((u64)B48, t_object_2e204, 8);
+	BLIT((u64)B49, ((u64)((char *)&D_strliteral_2e207)), 24);
+	BLIT((u64)B50, t_object_2e208, 24);
+	t__2e203 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R51, (u64)B48, (u64)B49, (u64)B50);
+	t_tag_2e210 = (u64)(*(u32 *)t__2e203);
+	t__2e218 = (u64)(u32)(((u32)t_tag_2e210 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e218) goto L_member_2e215; else goto L__2e217;
+	L__2e217:;
+	t__2e220 = (u64)(u32)(((u32)t_tag_2e210 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e220) goto L_member_2e216; else goto L__2e219;
+	L__2e219:;
+	goto L_matches_2e214;
+	L_member_2e215:;
+	goto L_matches_2e214;
+	L_member_2e216:;
+	goto L_matches_2e213;
+	L_matches_2e213:;
+	goto L__2e211;
+	L_matches_2e214:;
+	t_abortsite_2e68 = ((u64)14UL);
+	goto L_abort_2e69;
+	L__2e221:;
+	L__2e212:;
+	t_abortsite_2e68 = ((u64)15UL);
+	goto L_abort_2e76;
+	L__2e211:;
+	*(u32 *)t_object_2e224 = (u32)((u64)3532310079UL);
+	t__2e225 = (u64)((u64)t_object_2e224 + (u64)((u64)4UL));
+	*(u32 *)t__2e225 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e228 = (u64)((u64)0UL);
+	t__2e229 = (u64)((u64)t_object_2e228 + (u64)((u64)8UL));
+	*(u64 *)t__2e229 = (u64)((u64)0UL);
+	t__2e229 = (u64)((u64)t__2e229 + (u64)((u64)8UL));
+	*(u64 *)t__2e229 = (u64)((u64)0UL);
+	BLIT((u64)B52, t_object_2e224, 8);
+	BLIT((u64)B53, ((u64)((char *)&D_strliteral_2e227)), 24);
+	BLIT((u64)B54, t_object_2e228, 24);
+	t__2e223 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R55, (u64)B52, (u64)B53, (u64)B54);
+	t_tag_2e230 = (u64)(*(u32 *)t__2e223);
+	t__2e238 = (u64)(u32)(((u32)t_tag_2e230 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e238) goto L_member_2e235; else goto L__2e237;
+	L__2e237:;
+	t__2e240 = (u64)(u32)(((u32)t_tag_2e230 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e240) goto L_member_2e236; else goto L__2e239;
+	L__2e239:;
+	goto L_matches_2e234;
+	L_member_2e235:;
+	goto L_matches_2e234;
+	L_member_2e236:;
+	goto L_matches_2e233;
+	L_matches_2e233:;
+	goto L__2e231;
+	L_matches_2e234:;
+	t_abortsite_2e68 = ((u64)16UL);
+	goto L_abort_2e69;
+	L__2e241:;
+	L__2e232:;
+	t_abortsite_2e68 = ((u64)17UL);
+	goto L_abort_2e76;
+	L__2e231:;
+	*(u32 *)t_object_2e244 = (u32)((u64)3532310079UL);
+	t__2e245 = (u64)((u64)t_object_2e244 + (u64)((u64)4UL));
+	*(u32 *)t__2e245 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e248 = (u64)((u64)0UL);
+	t__2e249 = (u64)((u64)t_object_2e248 + (u64)((u64)8UL));
+	*(u64 *)t__2e249 = (u64)((u64)0UL);
+	t__2e249 = (u64)((u64)t__2e249 + (u64)((u64)8UL));
+	*(u64 *)t__2e249 = (u64)((u64)0UL);
+	BLIT((u64)B56, t_object_2e244, 8);
+	BLIT((u64)B57, ((u64)((char *)&D_strliteral_2e247)), 24);
+	BLIT((u64)B58, t_object_2e248, 24);
+	t__2e243 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R59, (u64)B56, (u64)B57, (u64)B58);
+	t_tag_2e250 = (u64)(*(u32 *)t__2e243);
+	t__2e258 = (u64)(u32)(((u32)t_tag_2e250 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e258) goto L_member_2e255; else goto L__2e257;
+	L__2e257:;
+	t__2e260 = (u64)(u32)(((u32)t_tag_2e250 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e260) goto L_member_2e256; else goto L__2e259;
+	L__2e259:;
+	goto L_matches_2e254;
+	L_member_2e255:;
+	goto L_matches_2e254;
+	L_member_2e256:;
+	goto L_matches_2e253;
+	L_matches_2e253:;
+	goto L__2e251;
+	L_matches_2e254:;
+	t_abortsite_2e68 = ((u64)18UL);
+	goto L_abort_2e69;
+	L__2e261:;
+	L__2e252:;
+	t_abortsite_2e68 = ((u64)19UL);
+	goto L_abort_2e76;
+	L__2e251:;
+	goto L__2e40;
+	L__2e262:;
+	L__2e40:;
+	return;
+	L_abort_2e69:;
+	t__2e70 = (u64)((u64)t_abortsite_2e68 * (u64)((u64)16UL));
+	t__2e70 = (u64)((u64)((u64)((char *)&D_abortsites_2e67)) + (u64)t__2e70);
+	t__2e71 = (u64)(*(u64 *)t__2e70);
+	t__2e72 = (u64)((u64)t__2e70 + (u64)((u64)8UL));
+	t__2e73 = (u64)(*(u32 *)t__2e72);
+	t__2e72 = (u64)((u64)t__2e70 + (u64)((u64)12UL));
+	t__2e74 = (u64)(*(u32 *)t__2e72);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e71, (u64)t__2e73, (u64)t__2e74, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e76:;
+	t__2e77 = (u64)((u64)t_abortsite_2e68 * (u64)((u64)16UL));
+	t__2e77 = (u64)((u64)((u64)((char *)&D_abortsites_2e67)) + (u64)t__2e77);
+	t__2e78 = (u64)(*(u64 *)t__2e77);
+	t__2e79 = (u64)((u64)t__2e77 + (u64)((u64)8UL));
+	t__2e80 = (u64)(*(u32 *)t__2e79);
+	t__2e79 = (u64)((u64)t__2e77 + (u64)((u64)12UL));
+	t__2e81 = (u64)(*(u32 *)t__2e79);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e78, (u64)t__2e80, (u64)t__2e81, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_typehints(void) {
+	char A0[24] __attribute__((aligned(16)));
+	u64 t__2e268;
+	u64 t__2e270;
+	u64 t__2e271;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e280;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e283;
+	u64 t__2e284;
+	u64 t__2e285;
+	u64 t__2e286;
+	u64 t__2e287;
+	u64 t__2e290;
+	u64 t__2e291;
+	u64 t__2e292;
+	u64 t__2e293;
+	u64 t__2e294;
+	u64 t__2e295;
+	u64 t__2e296;
+	u64 t__2e297;
+	u64 t__2e298;
+	u64 t__2e299;
+	u64 t__2e302;
+	u64 t__2e303;
+	u64 t__2e304;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t__2e311;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e318;
+	u64 t__2e319;
+	u64 t__2e321;
+	u64 t__2e322;
+	u64 t__2e323;
+	u64 t__2e324;
+	u64 t__2e325;
+	u64 t__2e328;
+	u64 t__2e329;
+	u64 t__2e330;
+	u64 t__2e331;
+	u64 t__2e332;
+	u64 t__2e333;
+	u64 t__2e334;
+	u64 t__2e335;
+	u64 t__2e338;
+	u64 t__2e339;
+	u64 t__2e340;
+	u64 t__2e343;
+	u64 t__2e344;
+	u64 t__2e345;
+	u64 t__2e346;
+	u64 t__2e347;
+	u64 t__2e348;
+	u64 t__2e349;
+	u64 t__2e350;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e355;
+	u64 t__2e356;
+	u64 t_abortsite_2e278;
+	u64 t_binding_2e267;
+	u64 t_item_2e313;
+	L_start_2e263:;
+	t_binding_2e267 = (u64)A0;
+	L_body_2e264:;
+	*(u64 *)t_binding_2e267 = (u64)((u64)0UL);
+	t__2e268 = (u64)((u64)t_binding_2e267 + (u64)((u64)8UL));
+	*(u64 *)t__2e268 = (u64)((u64)0UL);
+	t__2e268 = (u64)((u64)t__2e268 + (u64)((u64)8UL));
+	*(u64 *)t__2e268 = (u64)((u64)0UL);
+	t__2e270 = (u64)((u64)t_binding_2e267 + (u64)((u64)8UL));
+	t__2e271 = (u64)((u64)t_binding_2e267 + (u64)((u64)16UL));
+	t__2e272 = (u64)(*(u64 *)t__2e270);
+	t__2e273 = (u64)((i64)(i32)((u64)0UL));
+	t__2e274 = (u64)(u32)(((u64)t__2e273 <= (u64)t__2e272));
+	if ((u32)t__2e274) goto L__2e276; else goto L__2e275;
+	L__2e275:;
+	t_abortsite_2e278 = ((u64)0UL);
+	goto L_abort_2e279;
+	L__2e276:;
+	t__2e285 = (u64)((u64)t__2e272 + (u64)((u64)1UL));
+	*(u64 *)t__2e270 = (u64)t__2e285;
+	t__2e287 = (u64)(*(u64 *)t__2e271);
+	t__2e290 = (u64)(u32)(((u64)t__2e285 <= (u64)t__2e287));
+	if ((u32)t__2e290) goto L__2e288; else goto L__2e289;
+	L__2e289:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e267, (u64)((u64)1UL));
+	goto L__2e288;
+	L__2e288:;
+	t__2e291 = (u64)(*(u64 *)t_binding_2e267);
+	t__2e286 = (u64)((u64)t__2e273 * (u64)((u64)1UL));
+	t__2e286 = (u64)((u64)t__2e291 + (u64)t__2e286);
+	t__2e292 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	t__2e294 = (u64)((u64)t__2e272 - (u64)t__2e273);
+	t__2e294 = (u64)((u64)t__2e294 * (u64)((u64)1UL));
+	t__2e293 = (u64)((u64)t__2e286 + (u64)t__2e292);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e293, (u64)t__2e286, (u64)t__2e294);
+	*(u8 *)t__2e286 = (u8)((u64)42UL);
+	t__2e295 = (u64)((u64)t_binding_2e267 + (u64)((u64)8UL));
+	t__2e296 = (u64)((u64)t_binding_2e267 + (u64)((u64)16UL));
+	t__2e297 = (u64)(*(u64 *)t__2e295);
+	t__2e298 = (u64)((i64)(i32)((u64)1UL));
+	t__2e299 = (u64)(u32)(((u64)t__2e298 <= (u64)t__2e297));
+	if ((u32)t__2e299) goto L__2e301; else goto L__2e300;
+	L__2e300:;
+	t_abortsite_2e278 = ((u64)1UL);
+	goto L_abort_2e279;
+	L__2e301:;
+	t__2e302 = (u64)((u64)t__2e297 + (u64)((u64)1UL));
+	*(u64 *)t__2e295 = (u64)t__2e302;
+	t__2e304 = (u64)(*(u64 *)t__2e296);
+	t__2e307 = (u64)(u32)(((u64)t__2e302 <= (u64)t__2e304));
+	if ((u32)t__2e307) goto L__2e305; else goto L__2e306;
+	L__2e306:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e267, (u64)((u64)1UL));
+	goto L__2e305;
+	L__2e305:;
+	t__2e308 = (u64)(*(u64 *)t_binding_2e267);
+	t__2e303 = (u64)((u64)t__2e298 * (u64)((u64)1UL));
+	t__2e303 = (u64)((u64)t__2e308 + (u64)t__2e303);
+	t__2e309 = (u64)((u64)((u64)1UL) * (u64)((u64)1UL));
+	t__2e311 = (u64)((u64)t__2e297 - (u64)t__2e298);
+	t__2e311 = (u64)((u64)t__2e311 * (u64)((u64)1UL));
+	t__2e310 = (u64)((u64)t__2e303 + (u64)t__2e309);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e310, (u64)t__2e303, (u64)t__2e311);
+	t_item_2e313 = (u64)((u64)t__2e303 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e313 = (u8)((u64)42UL);
+	t__2e317 = (u64)((u64)t_binding_2e267 + (u64)((u64)8UL));
+	t__2e318 = (u64)((u64)t_binding_2e267 + (u64)((u64)16UL));
+	t__2e319 = (u64)(*(u64 *)t__2e317);
+	t__2e316 = (u64)(u32)(((u64)t__2e319 == (u64)((u64)2UL)));
+	if ((u32)t__2e316) goto L_passed_2e315; else goto L_failed_2e314;
+	L_failed_2e314:;
+	t_abortsite_2e278 = ((u64)2UL);
+	goto L_abort_2e320;
+	L_passed_2e315:;
+	t__2e330 = (u64)((u64)t_binding_2e267 + (u64)((u64)8UL));
+	t__2e331 = (u64)((u64)t_binding_2e267 + (u64)((u64)16UL));
+	t__2e332 = (u64)(*(u64 *)t_binding_2e267);
+	t__2e333 = (u64)(*(u64 *)t__2e330);
+	t__2e334 = (u64)((i64)(i32)((u64)0UL));
+	t__2e329 = (u64)((u64)t__2e334 * (u64)((u64)1UL));
+	t__2e329 = (u64)((u64)t__2e332 + (u64)t__2e329);
+	t__2e335 = (u64)(u32)(((u64)t__2e334 < (u64)t__2e333));
+	if ((u32)t__2e335) goto L__2e337; else goto L__2e336;
+	L__2e336:;
+	t_abortsite_2e278 = ((u64)3UL);
+	goto L_abort_2e279;
+	L__2e337:;
+	t__2e338 = (u64)(u32)(*(u8 *)t__2e329);
+	t__2e339 = (u64)(u32)((u8)t__2e338);
+	t__2e340 = (u64)(u32)((u8)((u64)42UL));
+	t__2e328 = (u64)(u32)(((u32)t__2e339 == (u32)t__2e340));
+	if ((u32)t__2e328) goto L_passed_2e327; else goto L_failed_2e326;
+	L_failed_2e326:;
+	t_abortsite_2e278 = ((u64)4UL);
+	goto L_abort_2e320;
+	L_passed_2e327:;
+	t__2e345 = (u64)((u64)t_binding_2e267 + (u64)((u64)8UL));
+	t__2e346 = (u64)((u64)t_binding_2e267 + (u64)((u64)16UL));
+	t__2e347 = (u64)(*(u64 *)t_binding_2e267);
+	t__2e348 = (u64)(*(u64 *)t__2e345);
+	t__2e349 = (u64)((i64)(i32)((u64)1UL));
+	t__2e344 = (u64)((u64)t__2e349 * (u64)((u64)1UL));
+	t__2e344 = (u64)((u64)t__2e347 + (u64)t__2e344);
+	t__2e350 = (u64)(u32)(((u64)t__2e349 < (u64)t__2e348));
+	if ((u32)t__2e350) goto L__2e352; else goto L__2e351;
+	L__2e351:;
+	t_abortsite_2e278 = ((u64)5UL);
+	goto L_abort_2e279;
+	L__2e352:;
+	t__2e353 = (u64)(u32)(*(u8 *)t__2e344);
+	t__2e354 = (u64)(u32)((u8)t__2e353);
+	t__2e355 = (u64)(u32)((u8)((u64)42UL));
+	t__2e343 = (u64)(u32)(((u32)t__2e354 == (u32)t__2e355));
+	if ((u32)t__2e343) goto L_passed_2e342; else goto L_failed_2e341;
+	L_failed_2e341:;
+	t_abortsite_2e278 = ((u64)6UL);
+	goto L_abort_2e320;
+	L_passed_2e342:;
+	t__2e356 = (u64)(*(u64 *)t_binding_2e267);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e356);
+	goto L__2e265;
+	L__2e357:;
+	L__2e265:;
+	return;
+	L_abort_2e279:;
+	t__2e280 = (u64)((u64)t_abortsite_2e278 * (u64)((u64)16UL));
+	t__2e280 = (u64)((u64)((u64)((char *)&D_abortsites_2e277)) + (u64)t__2e280);
+	t__2e281 = (u64)(*(u64 *)t__2e280);
+	t__2e282 = (u64)((u64)t__2e280 + (u64)((u64)8UL));
+	t__2e283 = (u64)(*(u32 *)t__2e282);
+	t__2e282 = (u64)((u64)t__2e280 + (u64)((u64)12UL));
+	t__2e284 = (u64)(*(u32 *)t__2e282);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e281, (u64)t__2e283, (u64)t__2e284, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e320:;
+	t__2e321 = (u64)((u64)t_abortsite_2e278 * (u64)((u64)16UL));
+	t__2e321 = (u64)((u64)((u64)((char *)&D_abortsites_2e277)) + (u64)t__2e321);
+	t__2e322 = (u64)(*(u64 *)t__2e321);
+	t__2e323 = (u64)((u64)t__2e321 + (u64)((u64)8UL));
+	t__2e324 = (u64)(*(u32 *)t__2e323);
+	t__2e323 = (u64)((u64)t__2e321 + (u64)((u64)12UL));
+	t__2e325 = (u64)(*(u32 *)t__2e323);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e322, (u64)t__2e324, (u64)t__2e325, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_withlength(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e363;
+	u64 t__2e364;
+	u64 t__2e370;
+	u64 t__2e371;
+	u64 t__2e372;
+	u64 t__2e373;
+	u64 t__2e374;
+	u64 t__2e377;
+	u64 t__2e379;
+	u64 t__2e380;
+	u64 t__2e381;
+	u64 t__2e382;
+	u64 t__2e383;
+	u64 t__2e387;
+	u64 t__2e388;
+	u64 t__2e389;
+	u64 t__2e390;
+	u64 t__2e391;
+	u64 t__2e395;
+	u64 t__2e396;
+	u64 t__2e397;
+	u64 t__2e400;
+	u64 t__2e401;
+	u64 t__2e402;
+	u64 t__2e403;
+	u64 t__2e404;
+	u64 t__2e408;
+	u64 t__2e411;
+	u64 t__2e412;
+	u64 t__2e413;
+	u64 t__2e414;
+	u64 t__2e416;
+	u64 t__2e417;
+	u64 t__2e418;
+	u64 t__2e419;
+	u64 t__2e420;
+	u64 t__2e427;
+	u64 t__2e428;
+	u64 t__2e429;
+	u64 t__2e430;
+	u64 t__2e431;
+	u64 t__2e436;
+	u64 t__2e437;
+	u64 t__2e438;
+	u64 t__2e439;
+	u64 t__2e440;
+	u64 t__2e441;
+	u64 t__2e442;
+	u64 t__2e443;
+	u64 t__2e444;
+	u64 t__2e446;
+	u64 t__2e447;
+	u64 t_abortsite_2e368;
+	u64 t_binding_2e362;
+	u64 t_binding_2e426;
+	u64 t_item_2e376;
+	u64 t_item_2e394;
+	u64 t_item_2e405;
+	u64 t_last_2e407;
+	u64 t_next_2e406;
+	u64 t_object_2e392;
+	L_start_2e358:;
+	t_binding_2e362 = (u64)A0;
+	t_object_2e392 = (u64)A1;
+	t_binding_2e426 = (u64)A2;
+	L_body_2e359:;
+	t__2e363 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)32UL)));
+	t__2e364 = (u64)(u32)(((u64)t__2e363 != (u64)((u64)0UL)));
+	if ((u32)t__2e364) goto L__2e366; else goto L__2e365;
+	L__2e365:;
+	t_abortsite_2e368 = ((u64)0UL);
+	goto L_abort_2e369;
+	L__2e366:;
+	t_item_2e376 = (u64)((u64)t__2e363 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e376 = (u64)((u64)0UL);
+	t_item_2e376 = (u64)((u64)t__2e363 + (u64)((u64)8UL));
+	*(u64 *)t_item_2e376 = (u64)((u64)0UL);
+	t_item_2e376 = (u64)((u64)t__2e363 + (u64)((u64)16UL));
+	*(u64 *)t_item_2e376 = (u64)((u64)2UL);
+	t_item_2e376 = (u64)((u64)t__2e363 + (u64)((u64)24UL));
+	*(u64 *)t_item_2e376 = (u64)((u64)2UL);
+	*(u64 *)t_binding_2e362 = (u64)t__2e363;
+	t__2e377 = (u64)((u64)t_binding_2e362 + (u64)((u64)8UL));
+	*(u64 *)t__2e377 = (u64)((u64)4UL);
+	t__2e377 = (u64)((u64)t__2e377 + (u64)((u64)8UL));
+	*(u64 *)t__2e377 = (u64)((u64)4UL);
+	t__2e379 = (u64)((u64)t_binding_2e362 + (u64)((u64)8UL));
+	t__2e380 = (u64)((u64)t_binding_2e362 + (u64)((u64)16UL));
+	t__2e381 = (u64)(*(u64 *)t__2e379);
+	t__2e382 = (u64)((i64)(i32)((u64)2UL));
+	t__2e383 = (u64)(u32)(((u64)t__2e382 <= (u64)t__2e381));
+	if ((u32)t__2e383) goto L__2e385; else goto L__2e384;
+	L__2e384:;
+	t_abortsite_2e368 = ((u64)1UL);
+	goto L_abort_2e386;
+	L__2e385:;
+	t_item_2e394 = (u64)((u64)t_object_2e392 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e394 = (u64)((u64)1UL);
+	t__2e395 = (u64)((u64)t__2e381 + (u64)((u64)2UL));
+	*(u64 *)t__2e379 = (u64)t__2e395;
+	t__2e397 = (u64)(*(u64 *)t__2e380);
+	t__2e400 = (u64)(u32)(((u64)t__2e395 <= (u64)t__2e397));
+	if ((u32)t__2e400) goto L__2e398; else goto L__2e399;
+	L__2e399:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e362, (u64)((u64)8UL));
+	goto L__2e398;
+	L__2e398:;
+	t__2e401 = (u64)(*(u64 *)t_binding_2e362);
+	t__2e396 = (u64)((u64)t__2e382 * (u64)((u64)8UL));
+	t__2e396 = (u64)((u64)t__2e401 + (u64)t__2e396);
+	t__2e402 = (u64)((u64)((u64)2UL) * (u64)((u64)8UL));
+	t__2e404 = (u64)((u64)t__2e381 - (u64)t__2e382);
+	t__2e404 = (u64)((u64)t__2e404 * (u64)((u64)8UL));
+	t__2e403 = (u64)((u64)t__2e396 + (u64)t__2e402);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e403, (u64)t__2e396, (u64)t__2e404);
+	t_item_2e405 = (u64)((u64)t__2e396 + (u64)((u64)0UL));
+	*(u64 *)t_item_2e405 = (u64)((u64)1UL);
+	t_next_2e406 = (u64)((u64)t__2e396 + (u64)((u64)8UL));
+	t_last_2e407 = (u64)((u64)t__2e396 + (u64)((u64)0UL));
+	t__2e408 = (u64)((u64)((u64)2UL) - (u64)((u64)1UL));
+	t__2e408 = (u64)((u64)t__2e408 * (u64)((u64)8UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t_next_2e406, (u64)t_last_2e407, (u64)t__2e408);
+	t__2e412 = (u64)((u64)t_binding_2e362 + (u64)((u64)8UL));
+	t__2e413 = (u64)((u64)t_binding_2e362 + (u64)((u64)16UL));
+	t__2e414 = (u64)(*(u64 *)t__2e412);
+	t__2e411 = (u64)(u32)(((u64)t__2e414 == (u64)((u64)6UL)));
+	if ((u32)t__2e411) goto L_passed_2e410; else goto L_failed_2e409;
+	L_failed_2e409:;
+	t_abortsite_2e368 = ((u64)2UL);
+	goto L_abort_2e415;
+	L_passed_2e410:;
+	*(u64 *)t_binding_2e426 = (u64)((u64)0UL);
+	L_loop_2e421:;
+	t__2e428 = (u64)(*(u64 *)t_binding_2e426);
+	t__2e429 = (u64)((u64)t_binding_2e362 + (u64)((u64)8UL));
+	t__2e430 = (u64)((u64)t_binding_2e362 + (u64)((u64)16UL));
+	t__2e431 = (u64)(*(u64 *)t__2e429);
+	t__2e427 = (u64)(u32)(((u64)t__2e428 < (u64)t__2e431));
+	if ((u32)t__2e427) goto L_body_2e422; else goto L__2e424;
+	L_body_2e422:;
+	t__2e438 = (u64)((u64)t_binding_2e362 + (u64)((u64)8UL));
+	t__2e439 = (u64)((u64)t_binding_2e362 + (u64)((u64)16UL));
+	t__2e440 = (u64)(*(u64 *)t_binding_2e362);
+	t__2e441 = (u64)(*(u64 *)t_binding_2e426);
+	t__2e437 = (u64)((u64)t__2e441 * (u64)((u64)8UL));
+	t__2e437 = (u64)((u64)t__2e440 + (u64)t__2e437);
+	t__2e442 = (u64)(*(u64 *)t__2e437);
+	t__2e444 = (u64)(*(u64 *)t_binding_2e426);
+	t__2e443 = (u64)((u64)t__2e444 >> (((u64)1UL) & 63));
+	t__2e436 = (u64)(u32)(((u64)t__2e442 == (u64)t__2e443));
+	if ((u32)t__2e436) goto L_passed_2e435; else goto L_failed_2e434;
+	L_failed_2e434:;
+	t_abortsite_2e368 = ((u64)3UL);
+	goto L_abort_2e415;
+	L_passed_2e435:;
+	goto L__2e432;
+	L__2e445:;
+	L__2e432:;
+	L_after_2e425:;
+	t__2e446 = (u64)(*(u64 *)t_binding_2e426);
+	t__2e446 = (u64)((u64)t__2e446 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e426 = (u64)t__2e446;
+	goto L_loop_2e421;
+	L__2e424:;
+	t__2e447 = (u64)(*(u64 *)t_binding_2e362);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e447);
+	goto L__2e360;
+	L__2e448:;
+	L__2e360:;
+	return;
+	L_abort_2e369:;
+	t__2e370 = (u64)((u64)t_abortsite_2e368 * (u64)((u64)16UL));
+	t__2e370 = (u64)((u64)((u64)((char *)&D_abortsites_2e367)) + (u64)t__2e370);
+	t__2e371 = (u64)(*(u64 *)t__2e370);
+	t__2e372 = (u64)((u64)t__2e370 + (u64)((u64)8UL));
+	t__2e373 = (u64)(*(u32 *)t__2e372);
+	t__2e372 = (u64)((u64)t__2e370 + (u64)((u64)12UL));
+	t__2e374 = (u64)(*(u32 *)t__2e372);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e371, (u64)t__2e373, (u64)t__2e374, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e386:;
+	t__2e387 = (u64)((u64)t_abortsite_2e368 * (u64)((u64)16UL));
+	t__2e387 = (u64)((u64)((u64)((char *)&D_abortsites_2e367)) + (u64)t__2e387);
+	t__2e388 = (u64)(*(u64 *)t__2e387);
+	t__2e389 = (u64)((u64)t__2e387 + (u64)((u64)8UL));
+	t__2e390 = (u64)(*(u32 *)t__2e389);
+	t__2e389 = (u64)((u64)t__2e387 + (u64)((u64)12UL));
+	t__2e391 = (u64)(*(u32 *)t__2e389);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e388, (u64)t__2e390, (u64)t__2e391, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e415:;
+	t__2e416 = (u64)((u64)t_abortsite_2e368 * (u64)((u64)16UL));
+	t__2e416 = (u64)((u64)((u64)((char *)&D_abortsites_2e367)) + (u64)t__2e416);
+	t__2e417 = (u64)(*(u64 *)t__2e416);
+	t__2e418 = (u64)((u64)t__2e416 + (u64)((u64)8UL));
+	t__2e419 = (u64)(*(u32 *)t__2e418);
+	t__2e418 = (u64)((u64)t__2e416 + (u64)((u64)12UL));
+	t__2e420 = (u64)(*(u32 *)t__2e418);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e417, (u64)t__2e419, (u64)t__2e420, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F___static(void) {
+	char A0[128] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[16] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char A7[12] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char A9[12] __attribute__((aligned(16)));
+	u64 t__2e456;
+	u64 t__2e457;
+	u64 t__2e459;
+	u64 t__2e461;
+	u64 t__2e462;
+	u64 t__2e463;
+	u64 t__2e464;
+	u64 t__2e467;
+	u64 t__2e473;
+	u64 t__2e474;
+	u64 t__2e475;
+	u64 t__2e476;
+	u64 t__2e477;
+	u64 t__2e479;
+	u64 t__2e480;
+	u64 t__2e481;
+	u64 t__2e482;
+	u64 t__2e483;
+	u64 t__2e484;
+	u64 t__2e487;
+	u64 t__2e488;
+	u64 t__2e489;
+	u64 t__2e492;
+	u64 t__2e493;
+	u64 t__2e494;
+	u64 t__2e495;
+	u64 t__2e496;
+	u64 t__2e497;
+	u64 t__2e498;
+	u64 t__2e499;
+	u64 t__2e500;
+	u64 t__2e501;
+	u64 t__2e504;
+	u64 t__2e505;
+	u64 t__2e506;
+	u64 t__2e509;
+	u64 t__2e510;
+	u64 t__2e511;
+	u64 t__2e512;
+	u64 t__2e513;
+	u64 t__2e516;
+	u64 t__2e517;
+	u64 t__2e518;
+	u64 t__2e519;
+	u64 t__2e521;
+	u64 t__2e522;
+	u64 t__2e523;
+	u64 t__2e524;
+	u64 t__2e525;
+	u64 t__2e532;
+	u64 t__2e533;
+	u64 t__2e534;
+	u64 t__2e535;
+	u64 t__2e536;
+	u64 t__2e541;
+	u64 t__2e542;
+	u64 t__2e543;
+	u64 t__2e544;
+	u64 t__2e545;
+	u64 t__2e546;
+	u64 t__2e547;
+	u64 t__2e548;
+	u64 t__2e549;
+	u64 t__2e550;
+	u64 t__2e553;
+	u64 t__2e554;
+	u64 t__2e555;
+	u64 t__2e556;
+	u64 t__2e559;
+	u64 t__2e560;
+	u64 t__2e561;
+	u64 t__2e562;
+	u64 t__2e564;
+	u64 t__2e569;
+	u64 t__2e570;
+	u64 t__2e571;
+	u64 t__2e572;
+	u64 t__2e573;
+	u64 t__2e574;
+	u64 t__2e577;
+	u64 t__2e578;
+	u64 t__2e579;
+	u64 t__2e582;
+	u64 t__2e583;
+	u64 t__2e584;
+	u64 t__2e585;
+	u64 t__2e586;
+	u64 t__2e588;
+	u64 t__2e589;
+	u64 t__2e590;
+	u64 t__2e591;
+	u64 t__2e592;
+	u64 t__2e595;
+	u64 t__2e596;
+	u64 t__2e597;
+	u64 t__2e598;
+	u64 t__2e599;
+	u64 t__2e602;
+	u64 t__2e603;
+	u64 t__2e604;
+	u64 t__2e605;
+	u64 t__2e606;
+	u64 t__2e607;
+	u64 t__2e614;
+	u64 t__2e615;
+	u64 t__2e616;
+	u64 t__2e617;
+	u64 t__2e618;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e628;
+	u64 t__2e633;
+	u64 t__2e634;
+	u64 t__2e635;
+	u64 t__2e636;
+	u64 t__2e639;
+	u64 t__2e643;
+	u64 t__2e644;
+	u64 t__2e645;
+	u64 t__2e646;
+	u64 t__2e647;
+	u64 t__2e648;
+	u64 t__2e652;
+	u64 t__2e654;
+	u64 t__2e655;
+	u64 t__2e656;
+	u64 t__2e657;
+	u64 t__2e658;
+	u64 t__2e659;
+	u64 t__2e662;
+	u64 t__2e663;
+	u64 t__2e664;
+	u64 t__2e665;
+	u64 t__2e666;
+	u64 t__2e667;
+	u64 t__2e670;
+	u64 t__2e671;
+	u64 t__2e672;
+	u64 t__2e673;
+	u64 t_abortsite_2e471;
+	u64 t_binding_2e453;
+	u64 t_binding_2e460;
+	u64 t_binding_2e531;
+	u64 t_binding_2e565;
+	u64 t_binding_2e613;
+	u64 t_binding_2e629;
+	u64 t_data_2e478;
+	u64 t_data_2e642;
+	u64 t_item_2e455;
+	u64 t_item_2e458;
+	u64 t_item_2e568;
+	u64 t_item_2e587;
+	u64 t_item_2e632;
+	u64 t_item_2e653;
+	u64 t_object_2e566;
+	u64 t_object_2e630;
+	u64 t_object_2e651;
+	L_start_2e449:;
+	t_binding_2e453 = (u64)A0;
+	t_binding_2e460 = (u64)A1;
+	t_binding_2e531 = (u64)A2;
+	t_binding_2e565 = (u64)A3;
+	t_object_2e566 = (u64)A4;
+	t_binding_2e613 = (u64)A5;
+	t_binding_2e629 = (u64)A6;
+	t_object_2e630 = (u64)A7;
+	t_object_2e651 = (u64)A8;
+	t__2e652 = (u64)A9;
+	L_body_2e450:;
+	t_item_2e455 = (u64)((u64)t_binding_2e453 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e455 = (u32)((u64)1UL);
+	t_item_2e455 = (u64)((u64)t_binding_2e453 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e455 = (u32)((u64)2UL);
+	t_item_2e455 = (u64)((u64)t_binding_2e453 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e455 = (u32)((u64)5UL);
+	t_item_2e455 = (u64)((u64)t_binding_2e453 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e455 = (u32)((u64)42UL);
+	t__2e456 = (u64)((u64)t_binding_2e453 + (u64)((u64)16UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e456, (u64)t_item_2e455, (u64)((u64)112UL));
+	t_item_2e458 = (u64)((u64)t_binding_2e453 + (u64)((u64)12UL));
+	t__2e459 = (u64)(u32)(*(i32 *)t_item_2e458);
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)16UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)20UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)24UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)28UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)32UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)36UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)40UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)44UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)48UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)52UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)56UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)60UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)64UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)68UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)72UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)76UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)80UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)84UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)88UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)92UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)96UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)100UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)104UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)108UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)112UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)116UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)120UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e457 = (u64)((u64)t_binding_2e453 + (u64)((u64)124UL));
+	*(u32 *)t__2e457 = (u32)t__2e459;
+	t__2e461 = t_binding_2e453;
+	t__2e462 = (u64)((i64)(i32)((u64)3UL));
+	t__2e463 = (u64)((u64)t__2e462 - (u64)((u64)0UL));
+	t__2e467 = (u64)(u32)(((u64)t__2e462 <= (u64)((u64)32UL)));
+	t__2e463 = t__2e462;
+	t__2e464 = ((u64)32UL);
+	if ((u32)t__2e467) goto L__2e469; else goto L__2e468;
+	L__2e468:;
+	t_abortsite_2e471 = ((u64)0UL);
+	goto L_abort_2e472;
+	L__2e469:;
+	t_data_2e478 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e478 = (u64)((u64)t__2e461 + (u64)t_data_2e478);
+	*(u64 *)t_binding_2e460 = (u64)t_data_2e478;
+	t__2e479 = (u64)((u64)t_binding_2e460 + (u64)((u64)8UL));
+	*(u64 *)t__2e479 = (u64)t__2e463;
+	t__2e479 = (u64)((u64)t_binding_2e460 + (u64)((u64)16UL));
+	*(u64 *)t__2e479 = (u64)t__2e464;
+	t__2e480 = (u64)((u64)t_binding_2e460 + (u64)((u64)8UL));
+	t__2e481 = (u64)((u64)t_binding_2e460 + (u64)((u64)16UL));
+	t__2e482 = (u64)(*(u64 *)t__2e480);
+	t__2e483 = (u64)((i64)(i32)((u64)2UL));
+	t__2e484 = (u64)(u32)(((u64)t__2e483 <= (u64)t__2e482));
+	if ((u32)t__2e484) goto L__2e486; else goto L__2e485;
+	L__2e485:;
+	t_abortsite_2e471 = ((u64)1UL);
+	goto L_abort_2e472;
+	L__2e486:;
+	t__2e487 = (u64)((u64)t__2e482 + (u64)((u64)1UL));
+	*(u64 *)t__2e480 = (u64)t__2e487;
+	t__2e489 = (u64)(*(u64 *)t__2e481);
+	t__2e492 = (u64)(u32)(((u64)t__2e487 <= (u64)t__2e489));
+	if ((u32)t__2e492) goto L__2e490; else goto L__2e491;
+	L__2e491:;
+	t_abortsite_2e471 = ((u64)2UL);
+	goto L_abort_2e472;
+	L__2e490:;
+	t__2e493 = (u64)(*(u64 *)t_binding_2e460);
+	t__2e488 = (u64)((u64)t__2e483 * (u64)((u64)4UL));
+	t__2e488 = (u64)((u64)t__2e493 + (u64)t__2e488);
+	t__2e494 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	t__2e496 = (u64)((u64)t__2e482 - (u64)t__2e483);
+	t__2e496 = (u64)((u64)t__2e496 * (u64)((u64)4UL));
+	t__2e495 = (u64)((u64)t__2e488 + (u64)t__2e494);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e495, (u64)t__2e488, (u64)t__2e496);
+	*(u32 *)t__2e488 = (u32)((u64)4UL);
+	t__2e497 = (u64)((u64)t_binding_2e460 + (u64)((u64)8UL));
+	t__2e498 = (u64)((u64)t_binding_2e460 + (u64)((u64)16UL));
+	t__2e499 = (u64)(*(u64 *)t__2e497);
+	t__2e500 = (u64)((i64)(i32)((u64)2UL));
+	t__2e501 = (u64)(u32)(((u64)t__2e500 <= (u64)t__2e499));
+	if ((u32)t__2e501) goto L__2e503; else goto L__2e502;
+	L__2e502:;
+	t_abortsite_2e471 = ((u64)3UL);
+	goto L_abort_2e472;
+	L__2e503:;
+	t__2e504 = (u64)((u64)t__2e499 + (u64)((u64)1UL));
+	*(u64 *)t__2e497 = (u64)t__2e504;
+	t__2e506 = (u64)(*(u64 *)t__2e498);
+	t__2e509 = (u64)(u32)(((u64)t__2e504 <= (u64)t__2e506));
+	if ((u32)t__2e509) goto L__2e507; else goto L__2e508;
+	L__2e508:;
+	t_abortsite_2e471 = ((u64)4UL);
+	goto L_abort_2e472;
+	L__2e507:;
+	t__2e510 = (u64)(*(u64 *)t_binding_2e460);
+	t__2e505 = (u64)((u64)t__2e500 * (u64)((u64)4UL));
+	t__2e505 = (u64)((u64)t__2e510 + (u64)t__2e505);
+	t__2e511 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	t__2e513 = (u64)((u64)t__2e499 - (u64)t__2e500);
+	t__2e513 = (u64)((u64)t__2e513 * (u64)((u64)4UL));
+	t__2e512 = (u64)((u64)t__2e505 + (u64)t__2e511);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e512, (u64)t__2e505, (u64)t__2e513);
+	*(u32 *)t__2e505 = (u32)((u64)3UL);
+	t__2e517 = (u64)((u64)t_binding_2e460 + (u64)((u64)8UL));
+	t__2e518 = (u64)((u64)t_binding_2e460 + (u64)((u64)16UL));
+	t__2e519 = (u64)(*(u64 *)t__2e517);
+	t__2e516 = (u64)(u32)(((u64)t__2e519 == (u64)((u64)5UL)));
+	if ((u32)t__2e516) goto L_passed_2e515; else goto L_failed_2e514;
+	L_failed_2e514:;
+	t_abortsite_2e471 = ((u64)5UL);
+	goto L_abort_2e520;
+	L_passed_2e515:;
+	*(u64 *)t_binding_2e531 = (u64)((u64)0UL);
+	L_loop_2e526:;
+	t__2e533 = (u64)(*(u64 *)t_binding_2e531);
+	t__2e534 = (u64)((u64)t_binding_2e460 + (u64)((u64)8UL));
+	t__2e535 = (u64)((u64)t_binding_2e460 + (u64)((u64)16UL));
+	t__2e536 = (u64)(*(u64 *)t__2e534);
+	t__2e532 = (u64)(u32)(((u64)t__2e533 < (u64)t__2e536));
+	if ((u32)t__2e532) goto L_body_2e527; else goto L__2e529;
+	L_body_2e527:;
+	t__2e543 = (u64)((u64)t_binding_2e460 + (u64)((u64)8UL));
+	t__2e544 = (u64)((u64)t_binding_2e460 + (u64)((u64)16UL));
+	t__2e545 = (u64)(*(u64 *)t_binding_2e460);
+	t__2e546 = (u64)(*(u64 *)t_binding_2e531);
+	t__2e542 = (u64)((u64)t__2e546 * (u64)((u64)4UL));
+	t__2e542 = (u64)((u64)t__2e545 + (u64)t__2e542);
+	t__2e547 = (u64)(u32)(*(i32 *)t__2e542);
+	t__2e549 = (u64)(*(u64 *)t_binding_2e531);
+	t__2e550 = (u64)(u32)t__2e549;
+	t__2e548 = (u64)(u32)((u32)t__2e550 + (u32)((u64)1UL));
+	t__2e541 = (u64)(u32)(((u32)t__2e547 == (u32)t__2e548));
+	if ((u32)t__2e541) goto L_passed_2e540; else goto L_failed_2e539;
+	L_failed_2e539:;
+	t_abortsite_2e471 = ((u64)6UL);
+	goto L_abort_2e520;
+	L_passed_2e540:;
+	t__2e555 = (u64)(*(u64 *)t_binding_2e531);
+	t__2e554 = (u64)((u64)t__2e555 * (u64)((u64)4UL));
+	t__2e554 = (u64)((u64)t_binding_2e453 + (u64)t__2e554);
+	t__2e556 = (u64)(u32)(((u64)t__2e555 < (u64)((u64)32UL)));
+	if ((u32)t__2e556) goto L__2e558; else goto L__2e557;
+	L__2e557:;
+	t_abortsite_2e471 = ((u64)7UL);
+	goto L_abort_2e472;
+	L__2e558:;
+	t__2e559 = (u64)(u32)(*(i32 *)t__2e554);
+	t__2e561 = (u64)(*(u64 *)t_binding_2e531);
+	t__2e562 = (u64)(u32)t__2e561;
+	t__2e560 = (u64)(u32)((u32)t__2e562 + (u32)((u64)1UL));
+	t__2e553 = (u64)(u32)(((u32)t__2e559 == (u32)t__2e560));
+	if ((u32)t__2e553) goto L_passed_2e552; else goto L_failed_2e551;
+	L_failed_2e551:;
+	t_abortsite_2e471 = ((u64)8UL);
+	goto L_abort_2e520;
+	L_passed_2e552:;
+	goto L__2e537;
+	L__2e563:;
+	L__2e537:;
+	L_after_2e530:;
+	t__2e564 = (u64)(*(u64 *)t_binding_2e531);
+	t__2e564 = (u64)((u64)t__2e564 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e531 = (u64)t__2e564;
+	goto L_loop_2e526;
+	L__2e529:;
+	t_item_2e568 = (u64)((u64)t_object_2e566 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e568 = (u32)((u64)1UL);
+	t_item_2e568 = (u64)((u64)t_object_2e566 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e568 = (u32)((u64)2UL);
+	t_item_2e568 = (u64)((u64)t_object_2e566 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e568 = (u32)((u64)3UL);
+	t_item_2e568 = (u64)((u64)t_object_2e566 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e568 = (u32)((u64)4UL);
+	*(u64 *)t_binding_2e565 = (u64)t_object_2e566;
+	t__2e569 = (u64)((u64)t_binding_2e565 + (u64)((u64)8UL));
+	*(u64 *)t__2e569 = (u64)((u64)4UL);
+	t__2e569 = (u64)((u64)t__2e569 + (u64)((u64)8UL));
+	*(u64 *)t__2e569 = (u64)((u64)4UL);
+	t__2e570 = (u64)((u64)t_binding_2e460 + (u64)((u64)8UL));
+	t__2e571 = (u64)((u64)t_binding_2e460 + (u64)((u64)16UL));
+	t__2e572 = (u64)(*(u64 *)t__2e570);
+	t__2e573 = (u64)((i64)(i32)((u64)2UL));
+	t__2e574 = (u64)(u32)(((u64)t__2e573 <= (u64)t__2e572));
+	if ((u32)t__2e574) goto L__2e576; else goto L__2e575;
+	L__2e575:;
+	t_abortsite_2e471 = ((u64)9UL);
+	goto L_abort_2e472;
+	L__2e576:;
+	t__2e577 = (u64)((u64)t__2e572 + (u64)((u64)4UL));
+	*(u64 *)t__2e570 = (u64)t__2e577;
+	t__2e579 = (u64)(*(u64 *)t__2e571);
+	t__2e582 = (u64)(u32)(((u64)t__2e577 <= (u64)t__2e579));
+	if ((u32)t__2e582) goto L__2e580; else goto L__2e581;
+	L__2e581:;
+	t_abortsite_2e471 = ((u64)10UL);
+	goto L_abort_2e472;
+	L__2e580:;
+	t__2e583 = (u64)(*(u64 *)t_binding_2e460);
+	t__2e578 = (u64)((u64)t__2e573 * (u64)((u64)4UL));
+	t__2e578 = (u64)((u64)t__2e583 + (u64)t__2e578);
+	t__2e584 = (u64)((u64)((u64)4UL) * (u64)((u64)4UL));
+	t__2e586 = (u64)((u64)t__2e572 - (u64)t__2e573);
+	t__2e586 = (u64)((u64)t__2e586 * (u64)((u64)4UL));
+	t__2e585 = (u64)((u64)t__2e578 + (u64)t__2e584);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e585, (u64)t__2e578, (u64)t__2e586);
+	t_item_2e587 = (u64)((u64)t__2e578 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e587 = (u32)((u64)1UL);
+	t_item_2e587 = (u64)((u64)t__2e578 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e587 = (u32)((u64)2UL);
+	t_item_2e587 = (u64)((u64)t__2e578 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e587 = (u32)((u64)3UL);
+	t_item_2e587 = (u64)((u64)t__2e578 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e587 = (u32)((u64)4UL);
+	t__2e588 = (u64)((u64)t_binding_2e460 + (u64)((u64)8UL));
+	t__2e589 = (u64)((u64)t_binding_2e460 + (u64)((u64)16UL));
+	t__2e590 = (u64)(*(u64 *)t__2e588);
+	t__2e591 = (u64)((i64)(i32)((u64)2UL));
+	t__2e592 = (u64)(u32)(((u64)t__2e591 <= (u64)t__2e590));
+	if ((u32)t__2e592) goto L__2e594; else goto L__2e593;
+	L__2e593:;
+	t_abortsite_2e471 = ((u64)11UL);
+	goto L_abort_2e472;
+	L__2e594:;
+	t__2e596 = (u64)((u64)t_binding_2e565 + (u64)((u64)8UL));
+	t__2e595 = (u64)(*(u64 *)t__2e596);
+	t__2e597 = (u64)((u64)t__2e590 + (u64)t__2e595);
+	*(u64 *)t__2e588 = (u64)t__2e597;
+	t__2e599 = (u64)(*(u64 *)t__2e589);
+	t__2e602 = (u64)(u32)(((u64)t__2e597 <= (u64)t__2e599));
+	if ((u32)t__2e602) goto L__2e600; else goto L__2e601;
+	L__2e601:;
+	t_abortsite_2e471 = ((u64)12UL);
+	goto L_abort_2e472;
+	L__2e600:;
+	t__2e603 = (u64)(*(u64 *)t_binding_2e460);
+	t__2e598 = (u64)((u64)t__2e591 * (u64)((u64)4UL));
+	t__2e598 = (u64)((u64)t__2e603 + (u64)t__2e598);
+	t__2e604 = (u64)((u64)t__2e595 * (u64)((u64)4UL));
+	t__2e606 = (u64)((u64)t__2e590 - (u64)t__2e591);
+	t__2e606 = (u64)((u64)t__2e606 * (u64)((u64)4UL));
+	t__2e605 = (u64)((u64)t__2e598 + (u64)t__2e604);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e605, (u64)t__2e598, (u64)t__2e606);
+	t__2e607 = (u64)(*(u64 *)t_binding_2e565);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e598, (u64)t__2e607, (u64)t__2e604);
+	t__2e614 = (u64)((u64)t_binding_2e460 + (u64)((u64)8UL));
+	t__2e615 = (u64)((u64)t_binding_2e460 + (u64)((u64)16UL));
+	t__2e616 = (u64)(*(u64 *)t__2e614);
+	*(u64 *)t_binding_2e613 = (u64)t__2e616;
+	L_loop_2e608:;
+	t__2e618 = (u64)(*(u64 *)t_binding_2e613);
+	t__2e617 = (u64)(u32)(((u64)t__2e618 < (u64)((u64)32UL)));
+	if ((u32)t__2e617) goto L_body_2e609; else goto L__2e611;
+	L_body_2e609:;
+	t__2e625 = (u64)(*(u64 *)t_binding_2e613);
+	t__2e624 = (u64)((u64)t__2e625 * (u64)((u64)4UL));
+	t__2e624 = (u64)((u64)t_binding_2e453 + (u64)t__2e624);
+	t__2e626 = (u64)(u32)(*(i32 *)t__2e624);
+	t__2e623 = (u64)(u32)(((u32)t__2e626 == (u32)((u64)42UL)));
+	if ((u32)t__2e623) goto L_passed_2e622; else goto L_failed_2e621;
+	L_failed_2e621:;
+	t_abortsite_2e471 = ((u64)13UL);
+	goto L_abort_2e520;
+	L_passed_2e622:;
+	goto L__2e619;
+	L__2e627:;
+	L__2e619:;
+	L_after_2e612:;
+	t__2e628 = (u64)(*(u64 *)t_binding_2e613);
+	t__2e628 = (u64)((u64)t__2e628 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e613 = (u64)t__2e628;
+	goto L_loop_2e608;
+	L__2e611:;
+	t_item_2e632 = (u64)((u64)t_object_2e630 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e632 = (u32)((u64)1UL);
+	t_item_2e632 = (u64)((u64)t_object_2e630 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e632 = (u32)((u64)2UL);
+	t_item_2e632 = (u64)((u64)t_object_2e630 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e632 = (u32)((u64)3UL);
+	t__2e633 = t_object_2e630;
+	t__2e634 = (u64)((i64)(i32)((u64)0UL));
+	t__2e635 = (u64)((u64)t__2e634 - (u64)((u64)0UL));
+	t__2e639 = (u64)(u32)(((u64)t__2e634 <= (u64)((u64)3UL)));
+	t__2e635 = t__2e634;
+	t__2e636 = ((u64)3UL);
+	if ((u32)t__2e639) goto L__2e641; else goto L__2e640;
+	L__2e640:;
+	t_abortsite_2e471 = ((u64)14UL);
+	goto L_abort_2e472;
+	L__2e641:;
+	t_data_2e642 = (u64)((u64)((u64)0UL) * (u64)((u64)4UL));
+	t_data_2e642 = (u64)((u64)t__2e633 + (u64)t_data_2e642);
+	*(u64 *)t_binding_2e629 = (u64)t_data_2e642;
+	t__2e643 = (u64)((u64)t_binding_2e629 + (u64)((u64)8UL));
+	*(u64 *)t__2e643 = (u64)t__2e635;
+	t__2e643 = (u64)((u64)t_binding_2e629 + (u64)((u64)16UL));
+	*(u64 *)t__2e643 = (u64)t__2e636;
+	t__2e644 = (u64)((u64)t_binding_2e629 + (u64)((u64)8UL));
+	t__2e645 = (u64)((u64)t_binding_2e629 + (u64)((u64)16UL));
+	t__2e646 = (u64)(*(u64 *)t__2e644);
+	t__2e647 = (u64)((i64)(i32)((u64)0UL));
+	t__2e648 = (u64)(u32)(((u64)t__2e647 <= (u64)t__2e646));
+	if ((u32)t__2e648) goto L__2e650; else goto L__2e649;
+	L__2e649:;
+	t_abortsite_2e471 = ((u64)15UL);
+	goto L_abort_2e472;
+	L__2e650:;
+	t_item_2e653 = (u64)((u64)t__2e652 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e653 = (u32)((u64)1UL);
+	t_item_2e653 = (u64)((u64)t__2e652 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e653 = (u32)((u64)2UL);
+	t_item_2e653 = (u64)((u64)t__2e652 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e653 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e651 = (u64)t__2e652;
+	t__2e654 = (u64)((u64)t_object_2e651 + (u64)((u64)8UL));
+	*(u64 *)t__2e654 = (u64)((u64)3UL);
+	t__2e654 = (u64)((u64)t__2e654 + (u64)((u64)8UL));
+	*(u64 *)t__2e654 = (u64)((u64)3UL);
+	t__2e656 = (u64)((u64)t_object_2e651 + (u64)((u64)8UL));
+	t__2e655 = (u64)(*(u64 *)t__2e656);
+	t__2e657 = (u64)((u64)t__2e646 + (u64)t__2e655);
+	*(u64 *)t__2e644 = (u64)t__2e657;
+	t__2e659 = (u64)(*(u64 *)t__2e645);
+	t__2e662 = (u64)(u32)(((u64)t__2e657 <= (u64)t__2e659));
+	if ((u32)t__2e662) goto L__2e660; else goto L__2e661;
+	L__2e661:;
+	t_abortsite_2e471 = ((u64)16UL);
+	goto L_abort_2e472;
+	L__2e660:;
+	t__2e663 = (u64)(*(u64 *)t_binding_2e629);
+	t__2e658 = (u64)((u64)t__2e647 * (u64)((u64)4UL));
+	t__2e658 = (u64)((u64)t__2e663 + (u64)t__2e658);
+	t__2e664 = (u64)((u64)t__2e655 * (u64)((u64)4UL));
+	t__2e666 = (u64)((u64)t__2e646 - (u64)t__2e647);
+	t__2e666 = (u64)((u64)t__2e666 * (u64)((u64)4UL));
+	t__2e665 = (u64)((u64)t__2e658 + (u64)t__2e664);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e665, (u64)t__2e658, (u64)t__2e666);
+	t__2e667 = (u64)(*(u64 *)t_object_2e651);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e658, (u64)t__2e667, (u64)t__2e664);
+	t__2e671 = (u64)((u64)t_binding_2e629 + (u64)((u64)8UL));
+	t__2e672 = (u64)((u64)t_binding_2e629 + (u64)((u64)16UL));
+	t__2e673 = (u64)(*(u64 *)t__2e671);
+	t__2e670 = (u64)(u32)(((u64)t__2e673 == (u64)((u64)3UL)));
+	if ((u32)t__2e670) goto L_passed_2e669; else goto L_failed_2e668;
+	L_failed_2e668:;
+	t_abortsite_2e471 = ((u64)17UL);
+	goto L_abort_2e520;
+	L_passed_2e669:;
+	goto L__2e451;
+	L__2e674:;
+	L__2e451:;
+	return;
+	L_abort_2e472:;
+	t__2e473 = (u64)((u64)t_abortsite_2e471 * (u64)((u64)16UL));
+	t__2e473 = (u64)((u64)((u64)((char *)&D_abortsites_2e470)) + (u64)t__2e473);
+	t__2e474 = (u64)(*(u64 *)t__2e473);
+	t__2e475 = (u64)((u64)t__2e473 + (u64)((u64)8UL));
+	t__2e476 = (u64)(*(u32 *)t__2e475);
+	t__2e475 = (u64)((u64)t__2e473 + (u64)((u64)12UL));
+	t__2e477 = (u64)(*(u32 *)t__2e475);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e474, (u64)t__2e476, (u64)t__2e477, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e520:;
+	t__2e521 = (u64)((u64)t_abortsite_2e471 * (u64)((u64)16UL));
+	t__2e521 = (u64)((u64)((u64)((char *)&D_abortsites_2e470)) + (u64)t__2e521);
+	t__2e522 = (u64)(*(u64 *)t__2e521);
+	t__2e523 = (u64)((u64)t__2e521 + (u64)((u64)8UL));
+	t__2e524 = (u64)(*(u32 *)t__2e523);
+	t__2e523 = (u64)((u64)t__2e521 + (u64)((u64)12UL));
+	t__2e525 = (u64)(*(u32 *)t__2e523);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e522, (u64)t__2e524, (u64)t__2e525, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_multi(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[24] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[12] __attribute__((aligned(16)));
+	u64 t__2e680;
+	u64 t__2e681;
+	u64 t__2e687;
+	u64 t__2e688;
+	u64 t__2e689;
+	u64 t__2e690;
+	u64 t__2e691;
+	u64 t__2e693;
+	u64 t__2e694;
+	u64 t__2e695;
+	u64 t__2e696;
+	u64 t__2e697;
+	u64 t__2e698;
+	u64 t__2e702;
+	u64 t__2e703;
+	u64 t__2e704;
+	u64 t__2e705;
+	u64 t__2e706;
+	u64 t__2e707;
+	u64 t__2e708;
+	u64 t__2e709;
+	u64 t__2e712;
+	u64 t__2e713;
+	u64 t__2e714;
+	u64 t__2e715;
+	u64 t__2e716;
+	u64 t__2e721;
+	u64 t__2e722;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e726;
+	u64 t__2e727;
+	u64 t__2e728;
+	u64 t__2e729;
+	u64 t__2e730;
+	u64 t__2e737;
+	u64 t__2e738;
+	u64 t__2e739;
+	u64 t__2e740;
+	u64 t__2e741;
+	u64 t__2e746;
+	u64 t__2e747;
+	u64 t__2e748;
+	u64 t__2e749;
+	u64 t__2e750;
+	u64 t__2e751;
+	u64 t__2e752;
+	u64 t__2e753;
+	u64 t__2e754;
+	u64 t__2e755;
+	u64 t__2e757;
+	u64 t__2e758;
+	u64 t__2e760;
+	u64 t__2e761;
+	u64 t__2e765;
+	u64 t__2e769;
+	u64 t__2e770;
+	u64 t__2e771;
+	u64 t__2e772;
+	u64 t__2e773;
+	u64 t__2e774;
+	u64 t__2e777;
+	u64 t__2e778;
+	u64 t__2e779;
+	u64 t__2e780;
+	u64 t__2e781;
+	u64 t__2e784;
+	u64 t__2e785;
+	u64 t__2e786;
+	u64 t__2e787;
+	u64 t__2e788;
+	u64 t__2e789;
+	u64 t__2e792;
+	u64 t__2e793;
+	u64 t__2e794;
+	u64 t__2e795;
+	u64 t__2e802;
+	u64 t__2e803;
+	u64 t__2e804;
+	u64 t__2e805;
+	u64 t__2e806;
+	u64 t__2e811;
+	u64 t__2e812;
+	u64 t__2e813;
+	u64 t__2e814;
+	u64 t__2e815;
+	u64 t__2e816;
+	u64 t__2e817;
+	u64 t__2e818;
+	u64 t__2e819;
+	u64 t__2e820;
+	u64 t__2e822;
+	u64 t__2e823;
+	u64 t__2e825;
+	u64 t__2e829;
+	u64 t__2e830;
+	u64 t__2e831;
+	u64 t__2e832;
+	u64 t__2e833;
+	u64 t__2e834;
+	u64 t__2e837;
+	u64 t__2e839;
+	u64 t__2e842;
+	u64 t__2e843;
+	u64 t__2e844;
+	u64 t__2e845;
+	u64 t__2e846;
+	u64 t__2e850;
+	u64 t__2e852;
+	u64 t__2e853;
+	u64 t__2e854;
+	u64 t__2e855;
+	u64 t__2e856;
+	u64 t__2e857;
+	u64 t__2e860;
+	u64 t__2e861;
+	u64 t__2e862;
+	u64 t__2e863;
+	u64 t__2e864;
+	u64 t__2e865;
+	u64 t__2e868;
+	u64 t__2e869;
+	u64 t__2e870;
+	u64 t__2e871;
+	u64 t__2e872;
+	u64 t_abortsite_2e685;
+	u64 t_binding_2e679;
+	u64 t_binding_2e736;
+	u64 t_binding_2e759;
+	u64 t_binding_2e766;
+	u64 t_binding_2e801;
+	u64 t_binding_2e824;
+	u64 t_item_2e692;
+	u64 t_item_2e718;
+	u64 t_item_2e764;
+	u64 t_item_2e768;
+	u64 t_item_2e851;
+	u64 t_object_2e767;
+	u64 t_object_2e849;
+	L_start_2e675:;
+	t_binding_2e679 = (u64)A0;
+	t_binding_2e736 = (u64)A1;
+	t_binding_2e759 = (u64)A2;
+	t_binding_2e766 = (u64)A3;
+	t_object_2e767 = (u64)A4;
+	t_binding_2e801 = (u64)A5;
+	t_binding_2e824 = (u64)A6;
+	t_object_2e849 = (u64)A7;
+	t__2e850 = (u64)A8;
+	L_body_2e676:;
+	t__2e680 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)12UL)));
+	t__2e681 = (u64)(u32)(((u64)t__2e680 != (u64)((u64)0UL)));
+	if ((u32)t__2e681) goto L__2e683; else goto L__2e682;
+	L__2e682:;
+	t_abortsite_2e685 = ((u64)0UL);
+	goto L_abort_2e686;
+	L__2e683:;
+	t_item_2e692 = (u64)((u64)t__2e680 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e692 = (u32)((u64)1UL);
+	t_item_2e692 = (u64)((u64)t__2e680 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e692 = (u32)((u64)2UL);
+	t_item_2e692 = (u64)((u64)t__2e680 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e692 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e679 = (u64)t__2e680;
+	t__2e693 = (u64)((u64)t_binding_2e679 + (u64)((u64)8UL));
+	*(u64 *)t__2e693 = (u64)((u64)3UL);
+	t__2e693 = (u64)((u64)t__2e693 + (u64)((u64)8UL));
+	*(u64 *)t__2e693 = (u64)((u64)3UL);
+	t__2e694 = (u64)((u64)t_binding_2e679 + (u64)((u64)8UL));
+	t__2e695 = (u64)((u64)t_binding_2e679 + (u64)((u64)16UL));
+	t__2e696 = (u64)(*(u64 *)t__2e694);
+	t__2e697 = (u64)((i64)(i32)((u64)2UL));
+	t__2e698 = (u64)(u32)(((u64)t__2e697 <= (u64)t__2e696));
+	if ((u32)t__2e698) goto L__2e700; else goto L__2e699;
+	L__2e699:;
+	t_abortsite_2e685 = ((u64)1UL);
+	goto L_abort_2e701;
+	L__2e700:;
+	t__2e707 = (u64)((u64)t__2e696 + (u64)((u64)2UL));
+	*(u64 *)t__2e694 = (u64)t__2e707;
+	t__2e709 = (u64)(*(u64 *)t__2e695);
+	t__2e712 = (u64)(u32)(((u64)t__2e707 <= (u64)t__2e709));
+	if ((u32)t__2e712) goto L__2e710; else goto L__2e711;
+	L__2e711:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e679, (u64)((u64)4UL));
+	goto L__2e710;
+	L__2e710:;
+	t__2e713 = (u64)(*(u64 *)t_binding_2e679);
+	t__2e708 = (u64)((u64)t__2e697 * (u64)((u64)4UL));
+	t__2e708 = (u64)((u64)t__2e713 + (u64)t__2e708);
+	t__2e714 = (u64)((u64)((u64)2UL) * (u64)((u64)4UL));
+	t__2e716 = (u64)((u64)t__2e696 - (u64)t__2e697);
+	t__2e716 = (u64)((u64)t__2e716 * (u64)((u64)4UL));
+	t__2e715 = (u64)((u64)t__2e708 + (u64)t__2e714);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e715, (u64)t__2e708, (u64)t__2e716);
+	t_item_2e718 = (u64)((u64)t__2e708 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e718 = (u32)((u64)3UL);
+	t_item_2e718 = (u64)((u64)t__2e708 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e718 = (u32)((u64)4UL);
+	t__2e722 = (u64)((u64)t_binding_2e679 + (u64)((u64)8UL));
+	t__2e723 = (u64)((u64)t_binding_2e679 + (u64)((u64)16UL));
+	t__2e724 = (u64)(*(u64 *)t__2e722);
+	t__2e721 = (u64)(u32)(((u64)t__2e724 == (u64)((u64)5UL)));
+	if ((u32)t__2e721) goto L_passed_2e720; else goto L_failed_2e719;
+	L_failed_2e719:;
+	t_abortsite_2e685 = ((u64)2UL);
+	goto L_abort_2e725;
+	L_passed_2e720:;
+	*(u64 *)t_binding_2e736 = (u64)((u64)0UL);
+	L_loop_2e731:;
+	t__2e738 = (u64)(*(u64 *)t_binding_2e736);
+	t__2e739 = (u64)((u64)t_binding_2e679 + (u64)((u64)8UL));
+	t__2e740 = (u64)((u64)t_binding_2e679 + (u64)((u64)16UL));
+	t__2e741 = (u64)(*(u64 *)t__2e739);
+	t__2e737 = (u64)(u32)(((u64)t__2e738 < (u64)t__2e741));
+	if ((u32)t__2e737) goto L_body_2e732; else goto L__2e734;
+	L_body_2e732:;
+	t__2e748 = (u64)((u64)t_binding_2e679 + (u64)((u64)8UL));
+	t__2e749 = (u64)((u64)t_binding_2e679 + (u64)((u64)16UL));
+	t__2e750 = (u64)(*(u64 *)t_binding_2e679);
+	t__2e751 = (u64)(*(u64 *)t_binding_2e736);
+	t__2e747 = (u64)((u64)t__2e751 * (u64)((u64)4UL));
+	t__2e747 = (u64)((u64)t__2e750 + (u64)t__2e747);
+	t__2e752 = (u64)(u32)(*(i32 *)t__2e747);
+	t__2e754 = (u64)(*(u64 *)t_binding_2e736);
+	t__2e755 = (u64)(u32)t__2e754;
+	t__2e753 = (u64)(u32)((u32)t__2e755 + (u32)((u64)1UL));
+	t__2e746 = (u64)(u32)(((u32)t__2e752 == (u32)t__2e753));
+	if ((u32)t__2e746) goto L_passed_2e745; else goto L_failed_2e744;
+	L_failed_2e744:;
+	t_abortsite_2e685 = ((u64)3UL);
+	goto L_abort_2e725;
+	L_passed_2e745:;
+	goto L__2e742;
+	L__2e756:;
+	L__2e742:;
+	L_after_2e735:;
+	t__2e757 = (u64)(*(u64 *)t_binding_2e736);
+	t__2e757 = (u64)((u64)t__2e757 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e736 = (u64)t__2e757;
+	goto L_loop_2e731;
+	L__2e734:;
+	t__2e758 = (u64)(*(u64 *)t_binding_2e679);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e758);
+	t__2e760 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)12UL)));
+	t__2e761 = (u64)(u32)(((u64)t__2e760 != (u64)((u64)0UL)));
+	if ((u32)t__2e761) goto L__2e763; else goto L__2e762;
+	L__2e762:;
+	t_abortsite_2e685 = ((u64)4UL);
+	goto L_abort_2e686;
+	L__2e763:;
+	t_item_2e764 = (u64)((u64)t__2e760 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e764 = (u32)((u64)1UL);
+	t_item_2e764 = (u64)((u64)t__2e760 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e764 = (u32)((u64)2UL);
+	t_item_2e764 = (u64)((u64)t__2e760 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e764 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e759 = (u64)t__2e760;
+	t__2e765 = (u64)((u64)t_binding_2e759 + (u64)((u64)8UL));
+	*(u64 *)t__2e765 = (u64)((u64)3UL);
+	t__2e765 = (u64)((u64)t__2e765 + (u64)((u64)8UL));
+	*(u64 *)t__2e765 = (u64)((u64)3UL);
+	t_item_2e768 = (u64)((u64)t_object_2e767 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e768 = (u32)((u64)3UL);
+	t_item_2e768 = (u64)((u64)t_object_2e767 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e768 = (u32)((u64)4UL);
+	*(u64 *)t_binding_2e766 = (u64)t_object_2e767;
+	t__2e769 = (u64)((u64)t_binding_2e766 + (u64)((u64)8UL));
+	*(u64 *)t__2e769 = (u64)((u64)2UL);
+	t__2e769 = (u64)((u64)t__2e769 + (u64)((u64)8UL));
+	*(u64 *)t__2e769 = (u64)((u64)2UL);
+	t__2e770 = (u64)((u64)t_binding_2e759 + (u64)((u64)8UL));
+	t__2e771 = (u64)((u64)t_binding_2e759 + (u64)((u64)16UL));
+	t__2e772 = (u64)(*(u64 *)t__2e770);
+	t__2e773 = (u64)((i64)(i32)((u64)2UL));
+	t__2e774 = (u64)(u32)(((u64)t__2e773 <= (u64)t__2e772));
+	if ((u32)t__2e774) goto L__2e776; else goto L__2e775;
+	L__2e775:;
+	t_abortsite_2e685 = ((u64)5UL);
+	goto L_abort_2e701;
+	L__2e776:;
+	t__2e778 = (u64)((u64)t_binding_2e766 + (u64)((u64)8UL));
+	t__2e777 = (u64)(*(u64 *)t__2e778);
+	t__2e779 = (u64)((u64)t__2e772 + (u64)t__2e777);
+	*(u64 *)t__2e770 = (u64)t__2e779;
+	t__2e781 = (u64)(*(u64 *)t__2e771);
+	t__2e784 = (u64)(u32)(((u64)t__2e779 <= (u64)t__2e781));
+	if ((u32)t__2e784) goto L__2e782; else goto L__2e783;
+	L__2e783:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e759, (u64)((u64)4UL));
+	goto L__2e782;
+	L__2e782:;
+	t__2e785 = (u64)(*(u64 *)t_binding_2e759);
+	t__2e780 = (u64)((u64)t__2e773 * (u64)((u64)4UL));
+	t__2e780 = (u64)((u64)t__2e785 + (u64)t__2e780);
+	t__2e786 = (u64)((u64)t__2e777 * (u64)((u64)4UL));
+	t__2e788 = (u64)((u64)t__2e772 - (u64)t__2e773);
+	t__2e788 = (u64)((u64)t__2e788 * (u64)((u64)4UL));
+	t__2e787 = (u64)((u64)t__2e780 + (u64)t__2e786);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e787, (u64)t__2e780, (u64)t__2e788);
+	t__2e789 = (u64)(*(u64 *)t_binding_2e766);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e780, (u64)t__2e789, (u64)t__2e786);
+	t__2e793 = (u64)((u64)t_binding_2e759 + (u64)((u64)8UL));
+	t__2e794 = (u64)((u64)t_binding_2e759 + (u64)((u64)16UL));
+	t__2e795 = (u64)(*(u64 *)t__2e793);
+	t__2e792 = (u64)(u32)(((u64)t__2e795 == (u64)((u64)5UL)));
+	if ((u32)t__2e792) goto L_passed_2e791; else goto L_failed_2e790;
+	L_failed_2e790:;
+	t_abortsite_2e685 = ((u64)6UL);
+	goto L_abort_2e725;
+	L_passed_2e791:;
+	*(u64 *)t_binding_2e801 = (u64)((u64)0UL);
+	L_loop_2e796:;
+	t__2e803 = (u64)(*(u64 *)t_binding_2e801);
+	t__2e804 = (u64)((u64)t_binding_2e759 + (u64)((u64)8UL));
+	t__2e805 = (u64)((u64)t_binding_2e759 + (u64)((u64)16UL));
+	t__2e806 = (u64)(*(u64 *)t__2e804);
+	t__2e802 = (u64)(u32)(((u64)t__2e803 < (u64)t__2e806));
+	if ((u32)t__2e802) goto L_body_2e797; else goto L__2e799;
+	L_body_2e797:;
+	t__2e813 = (u64)((u64)t_binding_2e759 + (u64)((u64)8UL));
+	t__2e814 = (u64)((u64)t_binding_2e759 + (u64)((u64)16UL));
+	t__2e815 = (u64)(*(u64 *)t_binding_2e759);
+	t__2e816 = (u64)(*(u64 *)t_binding_2e801);
+	t__2e812 = (u64)((u64)t__2e816 * (u64)((u64)4UL));
+	t__2e812 = (u64)((u64)t__2e815 + (u64)t__2e812);
+	t__2e817 = (u64)(u32)(*(i32 *)t__2e812);
+	t__2e819 = (u64)(*(u64 *)t_binding_2e801);
+	t__2e820 = (u64)(u32)t__2e819;
+	t__2e818 = (u64)(u32)((u32)t__2e820 + (u32)((u64)1UL));
+	t__2e811 = (u64)(u32)(((u32)t__2e817 == (u32)t__2e818));
+	if ((u32)t__2e811) goto L_passed_2e810; else goto L_failed_2e809;
+	L_failed_2e809:;
+	t_abortsite_2e685 = ((u64)7UL);
+	goto L_abort_2e725;
+	L_passed_2e810:;
+	goto L__2e807;
+	L__2e821:;
+	L__2e807:;
+	L_after_2e800:;
+	t__2e822 = (u64)(*(u64 *)t_binding_2e801);
+	t__2e822 = (u64)((u64)t__2e822 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e801 = (u64)t__2e822;
+	goto L_loop_2e796;
+	L__2e799:;
+	t__2e823 = (u64)(*(u64 *)t_binding_2e759);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e823);
+	t__2e825 = (u64)(u32)(((u64)((u64)0UL) <= (u64)((u64)3UL)));
+	if ((u32)t__2e825) goto L__2e826; else goto L__2e827;
+	L__2e827:;
+	t_abortsite_2e685 = ((u64)8UL);
+	goto L_abort_2e828;
+	L__2e826:;
+	t__2e834 = (u64)((u64)((u64)3UL) * (u64)((u64)4UL));
+	t__2e837 = ((u64)0UL);
+	t__2e825 = (u64)(u32)(((u64)t__2e834 != (u64)((u64)0UL)));
+	if ((u32)t__2e825) goto L__2e836; else goto L__2e835;
+	L__2e836:;
+	t__2e837 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)t__2e834));
+	t__2e825 = (u64)(u32)(((u64)t__2e837 != (u64)((u64)0UL)));
+	if ((u32)t__2e825) goto L__2e835; else goto L__2e838;
+	L__2e838:;
+	t_abortsite_2e685 = ((u64)9UL);
+	goto L_abort_2e686;
+	L__2e835:;
+	*(u64 *)t_binding_2e824 = (u64)t__2e837;
+	t__2e839 = (u64)((u64)t_binding_2e824 + (u64)((u64)8UL));
+	*(u64 *)t__2e839 = (u64)((u64)0UL);
+	t__2e839 = (u64)((u64)t_binding_2e824 + (u64)((u64)16UL));
+	*(u64 *)t__2e839 = (u64)((u64)3UL);
+	t__2e842 = (u64)((u64)t_binding_2e824 + (u64)((u64)8UL));
+	t__2e843 = (u64)((u64)t_binding_2e824 + (u64)((u64)16UL));
+	t__2e844 = (u64)(*(u64 *)t__2e842);
+	t__2e845 = (u64)((i64)(i32)((u64)0UL));
+	t__2e846 = (u64)(u32)(((u64)t__2e845 <= (u64)t__2e844));
+	if ((u32)t__2e846) goto L__2e848; else goto L__2e847;
+	L__2e847:;
+	t_abortsite_2e685 = ((u64)10UL);
+	goto L_abort_2e701;
+	L__2e848:;
+	t_item_2e851 = (u64)((u64)t__2e850 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e851 = (u32)((u64)1UL);
+	t_item_2e851 = (u64)((u64)t__2e850 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e851 = (u32)((u64)2UL);
+	t_item_2e851 = (u64)((u64)t__2e850 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e851 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e849 = (u64)t__2e850;
+	t__2e852 = (u64)((u64)t_object_2e849 + (u64)((u64)8UL));
+	*(u64 *)t__2e852 = (u64)((u64)3UL);
+	t__2e852 = (u64)((u64)t__2e852 + (u64)((u64)8UL));
+	*(u64 *)t__2e852 = (u64)((u64)3UL);
+	t__2e854 = (u64)((u64)t_object_2e849 + (u64)((u64)8UL));
+	t__2e853 = (u64)(*(u64 *)t__2e854);
+	t__2e855 = (u64)((u64)t__2e844 + (u64)t__2e853);
+	*(u64 *)t__2e842 = (u64)t__2e855;
+	t__2e857 = (u64)(*(u64 *)t__2e843);
+	t__2e860 = (u64)(u32)(((u64)t__2e855 <= (u64)t__2e857));
+	if ((u32)t__2e860) goto L__2e858; else goto L__2e859;
+	L__2e859:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e824, (u64)((u64)4UL));
+	goto L__2e858;
+	L__2e858:;
+	t__2e861 = (u64)(*(u64 *)t_binding_2e824);
+	t__2e856 = (u64)((u64)t__2e845 * (u64)((u64)4UL));
+	t__2e856 = (u64)((u64)t__2e861 + (u64)t__2e856);
+	t__2e862 = (u64)((u64)t__2e853 * (u64)((u64)4UL));
+	t__2e864 = (u64)((u64)t__2e844 - (u64)t__2e845);
+	t__2e864 = (u64)((u64)t__2e864 * (u64)((u64)4UL));
+	t__2e863 = (u64)((u64)t__2e856 + (u64)t__2e862);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e863, (u64)t__2e856, (u64)t__2e864);
+	t__2e865 = (u64)(*(u64 *)t_object_2e849);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e856, (u64)t__2e865, (u64)t__2e862);
+	t__2e869 = (u64)((u64)t_binding_2e824 + (u64)((u64)8UL));
+	t__2e870 = (u64)((u64)t_binding_2e824 + (u64)((u64)16UL));
+	t__2e871 = (u64)(*(u64 *)t__2e869);
+	t__2e868 = (u64)(u32)(((u64)t__2e871 == (u64)((u64)3UL)));
+	if ((u32)t__2e868) goto L_passed_2e867; else goto L_failed_2e866;
+	L_failed_2e866:;
+	t_abortsite_2e685 = ((u64)11UL);
+	goto L_abort_2e725;
+	L_passed_2e867:;
+	t__2e872 = (u64)(*(u64 *)t_binding_2e824);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e872);
+	goto L__2e677;
+	L__2e873:;
+	L__2e677:;
+	return;
+	L_abort_2e686:;
+	t__2e687 = (u64)((u64)t_abortsite_2e685 * (u64)((u64)16UL));
+	t__2e687 = (u64)((u64)((u64)((char *)&D_abortsites_2e684)) + (u64)t__2e687);
+	t__2e688 = (u64)(*(u64 *)t__2e687);
+	t__2e689 = (u64)((u64)t__2e687 + (u64)((u64)8UL));
+	t__2e690 = (u64)(*(u32 *)t__2e689);
+	t__2e689 = (u64)((u64)t__2e687 + (u64)((u64)12UL));
+	t__2e691 = (u64)(*(u32 *)t__2e689);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e688, (u64)t__2e690, (u64)t__2e691, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e701:;
+	t__2e702 = (u64)((u64)t_abortsite_2e685 * (u64)((u64)16UL));
+	t__2e702 = (u64)((u64)((u64)((char *)&D_abortsites_2e684)) + (u64)t__2e702);
+	t__2e703 = (u64)(*(u64 *)t__2e702);
+	t__2e704 = (u64)((u64)t__2e702 + (u64)((u64)8UL));
+	t__2e705 = (u64)(*(u32 *)t__2e704);
+	t__2e704 = (u64)((u64)t__2e702 + (u64)((u64)12UL));
+	t__2e706 = (u64)(*(u32 *)t__2e704);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e703, (u64)t__2e705, (u64)t__2e706, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e725:;
+	t__2e726 = (u64)((u64)t_abortsite_2e685 * (u64)((u64)16UL));
+	t__2e726 = (u64)((u64)((u64)((char *)&D_abortsites_2e684)) + (u64)t__2e726);
+	t__2e727 = (u64)(*(u64 *)t__2e726);
+	t__2e728 = (u64)((u64)t__2e726 + (u64)((u64)8UL));
+	t__2e729 = (u64)(*(u32 *)t__2e728);
+	t__2e728 = (u64)((u64)t__2e726 + (u64)((u64)12UL));
+	t__2e730 = (u64)(*(u32 *)t__2e728);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e727, (u64)t__2e729, (u64)t__2e730, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e828:;
+	t__2e829 = (u64)((u64)t_abortsite_2e685 * (u64)((u64)16UL));
+	t__2e829 = (u64)((u64)((u64)((char *)&D_abortsites_2e684)) + (u64)t__2e829);
+	t__2e830 = (u64)(*(u64 *)t__2e829);
+	t__2e831 = (u64)((u64)t__2e829 + (u64)((u64)8UL));
+	t__2e832 = (u64)(*(u32 *)t__2e831);
+	t__2e831 = (u64)((u64)t__2e829 + (u64)((u64)12UL));
+	t__2e833 = (u64)(*(u32 *)t__2e831);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e830, (u64)t__2e832, (u64)t__2e833, (u64)((u64)5UL));
+	__builtin_trap();
+}
+static void F_basics(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	u64 t__2e1000;
+	u64 t__2e1001;
+	u64 t__2e1002;
+	u64 t__2e1003;
+	u64 t__2e1004;
+	u64 t__2e1005;
+	u64 t__2e1006;
+	u64 t__2e1007;
+	u64 t__2e1008;
+	u64 t__2e1009;
+	u64 t__2e1010;
+	u64 t__2e1011;
+	u64 t__2e1014;
+	u64 t__2e1015;
+	u64 t__2e879;
+	u64 t__2e880;
+	u64 t__2e886;
+	u64 t__2e887;
+	u64 t__2e888;
+	u64 t__2e889;
+	u64 t__2e890;
+	u64 t__2e892;
+	u64 t__2e894;
+	u64 t__2e895;
+	u64 t__2e896;
+	u64 t__2e897;
+	u64 t__2e898;
+	u64 t__2e902;
+	u64 t__2e903;
+	u64 t__2e904;
+	u64 t__2e905;
+	u64 t__2e906;
+	u64 t__2e907;
+	u64 t__2e908;
+	u64 t__2e909;
+	u64 t__2e912;
+	u64 t__2e913;
+	u64 t__2e914;
+	u64 t__2e915;
+	u64 t__2e916;
+	u64 t__2e917;
+	u64 t__2e918;
+	u64 t__2e919;
+	u64 t__2e920;
+	u64 t__2e921;
+	u64 t__2e924;
+	u64 t__2e925;
+	u64 t__2e926;
+	u64 t__2e929;
+	u64 t__2e930;
+	u64 t__2e931;
+	u64 t__2e932;
+	u64 t__2e933;
+	u64 t__2e936;
+	u64 t__2e937;
+	u64 t__2e938;
+	u64 t__2e939;
+	u64 t__2e941;
+	u64 t__2e942;
+	u64 t__2e943;
+	u64 t__2e944;
+	u64 t__2e945;
+	u64 t__2e952;
+	u64 t__2e953;
+	u64 t__2e954;
+	u64 t__2e955;
+	u64 t__2e956;
+	u64 t__2e961;
+	u64 t__2e962;
+	u64 t__2e963;
+	u64 t__2e964;
+	u64 t__2e965;
+	u64 t__2e966;
+	u64 t__2e967;
+	u64 t__2e968;
+	u64 t__2e971;
+	u64 t__2e972;
+	u64 t__2e973;
+	u64 t__2e974;
+	u64 t__2e976;
+	u64 t__2e977;
+	u64 t__2e978;
+	u64 t__2e979;
+	u64 t__2e980;
+	u64 t__2e981;
+	u64 t__2e982;
+	u64 t__2e985;
+	u64 t__2e986;
+	u64 t__2e987;
+	u64 t__2e990;
+	u64 t__2e991;
+	u64 t__2e992;
+	u64 t__2e993;
+	u64 t__2e994;
+	u64 t__2e997;
+	u64 t_abortsite_2e884;
+	u64 t_binding_2e878;
+	u64 t_binding_2e893;
+	u64 t_binding_2e951;
+	u64 t_item_2e891;
+	L_start_2e874:;
+	t_binding_2e878 = (u64)A0;
+	t_binding_2e893 = (u64)A1;
+	t_binding_2e951 = (u64)A2;
+	L_body_2e875:;
+	t__2e879 = (u64)(((u64 (*)(u64))((u64)X_rt_2emalloc))((u64)((u64)12UL)));
+	t__2e880 = (u64)(u32)(((u64)t__2e879 != (u64)((u64)0UL)));
+	if ((u32)t__2e880) goto L__2e882; else goto L__2e881;
+	L__2e881:;
+	t_abortsite_2e884 = ((u64)0UL);
+	goto L_abort_2e885;
+	L__2e882:;
+	t_item_2e891 = (u64)((u64)t__2e879 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e891 = (u32)((u64)1UL);
+	t_item_2e891 = (u64)((u64)t__2e879 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e891 = (u32)((u64)2UL);
+	t_item_2e891 = (u64)((u64)t__2e879 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e891 = (u32)((u64)5UL);
+	*(u64 *)t_binding_2e878 = (u64)t__2e879;
+	t__2e892 = (u64)((u64)t_binding_2e878 + (u64)((u64)8UL));
+	*(u64 *)t__2e892 = (u64)((u64)3UL);
+	t__2e892 = (u64)((u64)t__2e892 + (u64)((u64)8UL));
+	*(u64 *)t__2e892 = (u64)((u64)3UL);
+	*(u64 *)t_binding_2e893 = (u64)t_binding_2e878;
+	t__2e894 = (u64)((u64)t_binding_2e878 + (u64)((u64)8UL));
+	t__2e895 = (u64)((u64)t_binding_2e878 + (u64)((u64)16UL));
+	t__2e896 = (u64)(*(u64 *)t__2e894);
+	t__2e897 = (u64)((i64)(i32)((u64)2UL));
+	t__2e898 = (u64)(u32)(((u64)t__2e897 <= (u64)t__2e896));
+	if ((u32)t__2e898) goto L__2e900; else goto L__2e899;
+	L__2e899:;
+	t_abortsite_2e884 = ((u64)1UL);
+	goto L_abort_2e901;
+	L__2e900:;
+	t__2e907 = (u64)((u64)t__2e896 + (u64)((u64)1UL));
+	*(u64 *)t__2e894 = (u64)t__2e907;
+	t__2e909 = (u64)(*(u64 *)t__2e895);
+	t__2e912 = (u64)(u32)(((u64)t__2e907 <= (u64)t__2e909));
+	if ((u32)t__2e912) goto L__2e910; else goto L__2e911;
+	L__2e911:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e878, (u64)((u64)4UL));
+	goto L__2e910;
+	L__2e910:;
+	t__2e913 = (u64)(*(u64 *)t_binding_2e878);
+	t__2e908 = (u64)((u64)t__2e897 * (u64)((u64)4UL));
+	t__2e908 = (u64)((u64)t__2e913 + (u64)t__2e908);
+	t__2e914 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	t__2e916 = (u64)((u64)t__2e896 - (u64)t__2e897);
+	t__2e916 = (u64)((u64)t__2e916 * (u64)((u64)4UL));
+	t__2e915 = (u64)((u64)t__2e908 + (u64)t__2e914);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e915, (u64)t__2e908, (u64)t__2e916);
+	*(u32 *)t__2e908 = (u32)((u64)4UL);
+	t__2e917 = (u64)((u64)t_binding_2e878 + (u64)((u64)8UL));
+	t__2e918 = (u64)((u64)t_binding_2e878 + (u64)((u64)16UL));
+	t__2e919 = (u64)(*(u64 *)t__2e917);
+	t__2e920 = (u64)((i64)(i32)((u64)2UL));
+	t__2e921 = (u64)(u32)(((u64)t__2e920 <= (u64)t__2e919));
+	if ((u32)t__2e921) goto L__2e923; else goto L__2e922;
+	L__2e922:;
+	t_abortsite_2e884 = ((u64)2UL);
+	goto L_abort_2e901;
+	L__2e923:;
+	t__2e924 = (u64)((u64)t__2e919 + (u64)((u64)1UL));
+	*(u64 *)t__2e917 = (u64)t__2e924;
+	t__2e926 = (u64)(*(u64 *)t__2e918);
+	t__2e929 = (u64)(u32)(((u64)t__2e924 <= (u64)t__2e926));
+	if ((u32)t__2e929) goto L__2e927; else goto L__2e928;
+	L__2e928:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t_binding_2e878, (u64)((u64)4UL));
+	goto L__2e927;
+	L__2e927:;
+	t__2e930 = (u64)(*(u64 *)t_binding_2e878);
+	t__2e925 = (u64)((u64)t__2e920 * (u64)((u64)4UL));
+	t__2e925 = (u64)((u64)t__2e930 + (u64)t__2e925);
+	t__2e931 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	t__2e933 = (u64)((u64)t__2e919 - (u64)t__2e920);
+	t__2e933 = (u64)((u64)t__2e933 * (u64)((u64)4UL));
+	t__2e932 = (u64)((u64)t__2e925 + (u64)t__2e931);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e932, (u64)t__2e925, (u64)t__2e933);
+	*(u32 *)t__2e925 = (u32)((u64)3UL);
+	t__2e937 = (u64)((u64)t_binding_2e878 + (u64)((u64)8UL));
+	t__2e938 = (u64)((u64)t_binding_2e878 + (u64)((u64)16UL));
+	t__2e939 = (u64)(*(u64 *)t__2e937);
+	t__2e936 = (u64)(u32)(((u64)t__2e939 == (u64)((u64)5UL)));
+	if ((u32)t__2e936) goto L_passed_2e935; else goto L_failed_2e934;
+	L_failed_2e934:;
+	t_abortsite_2e884 = ((u64)3UL);
+	goto L_abort_2e940;
+	L_passed_2e935:;
+	*(u64 *)t_binding_2e951 = (u64)((u64)0UL);
+	L_loop_2e946:;
+	t__2e953 = (u64)(*(u64 *)t_binding_2e951);
+	t__2e954 = (u64)((u64)t_binding_2e878 + (u64)((u64)8UL));
+	t__2e955 = (u64)((u64)t_binding_2e878 + (u64)((u64)16UL));
+	t__2e956 = (u64)(*(u64 *)t__2e954);
+	t__2e952 = (u64)(u32)(((u64)t__2e953 < (u64)t__2e956));
+	if ((u32)t__2e952) goto L_body_2e947; else goto L__2e949;
+	L_body_2e947:;
+	t__2e963 = (u64)((u64)t_binding_2e878 + (u64)((u64)8UL));
+	t__2e964 = (u64)((u64)t_binding_2e878 + (u64)((u64)16UL));
+	t__2e965 = (u64)(*(u64 *)t_binding_2e878);
+	t__2e966 = (u64)(*(u64 *)t__2e963);
+	t__2e967 = (u64)(*(u64 *)t_binding_2e951);
+	t__2e962 = (u64)((u64)t__2e967 * (u64)((u64)4UL));
+	t__2e962 = (u64)((u64)t__2e965 + (u64)t__2e962);
+	t__2e968 = (u64)(u32)(((u64)t__2e967 < (u64)t__2e966));
+	if ((u32)t__2e968) goto L__2e970; else goto L__2e969;
+	L__2e969:;
+	t_abortsite_2e884 = ((u64)4UL);
+	goto L_abort_2e901;
+	L__2e970:;
+	t__2e971 = (u64)(u32)(*(i32 *)t__2e962);
+	t__2e973 = (u64)(*(u64 *)t_binding_2e951);
+	t__2e974 = (u64)(u32)t__2e973;
+	t__2e972 = (u64)(u32)((u32)t__2e974 + (u32)((u64)1UL));
+	t__2e961 = (u64)(u32)(((u32)t__2e971 == (u32)t__2e972));
+	if ((u32)t__2e961) goto L_passed_2e960; else goto L_failed_2e959;
+	L_failed_2e959:;
+	t_abortsite_2e884 = ((u64)5UL);
+	goto L_abort_2e940;
+	L_passed_2e960:;
+	goto L__2e957;
+	L__2e975:;
+	L__2e957:;
+	L_after_2e950:;
+	t__2e976 = (u64)(*(u64 *)t_binding_2e951);
+	t__2e976 = (u64)((u64)t__2e976 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e951 = (u64)t__2e976;
+	goto L_loop_2e946;
+	L__2e949:;
+	t__2e977 = (u64)(*(u64 *)t_binding_2e893);
+	t__2e978 = (u64)((u64)t__2e977 + (u64)((u64)8UL));
+	t__2e979 = (u64)((u64)t__2e977 + (u64)((u64)16UL));
+	t__2e980 = (u64)(*(u64 *)t__2e978);
+	t__2e981 = (u64)((i64)(i32)((u64)0UL));
+	t__2e982 = (u64)(u32)(((u64)t__2e981 <= (u64)t__2e980));
+	if ((u32)t__2e982) goto L__2e984; else goto L__2e983;
+	L__2e983:;
+	t_abortsite_2e884 = ((u64)6UL);
+	goto L_abort_2e901;
+	L__2e984:;
+	t__2e985 = (u64)((u64)t__2e980 + (u64)((u64)1UL));
+	*(u64 *)t__2e978 = (u64)t__2e985;
+	t__2e987 = (u64)(*(u64 *)t__2e979);
+	t__2e990 = (u64)(u32)(((u64)t__2e985 <= (u64)t__2e987));
+	if ((u32)t__2e990) goto L__2e988; else goto L__2e989;
+	L__2e989:;
+	((void (*)(u64, u64))((u64)X_rt_2eensure))((u64)t__2e977, (u64)((u64)4UL));
+	goto L__2e988;
+	L__2e988:;
+	t__2e991 = (u64)(*(u64 *)t__2e977);
+	t__2e986 = (u64)((u64)t__2e981 * (u64)((u64)4UL));
+	t__2e986 = (u64)((u64)t__2e991 + (u64)t__2e986);
+	t__2e992 = (u64)((u64)((u64)1UL) * (u64)((u64)4UL));
+	t__2e994 = (u64)((u64)t__2e980 - (u64)t__2e981);
+	t__2e994 = (u64)((u64)t__2e994 * (u64)((u64)4UL));
+	t__2e993 = (u64)((u64)t__2e986 + (u64)t__2e992);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e993, (u64)t__2e986, (u64)t__2e994);
+	*(u32 *)t__2e986 = (u32)((u64)42UL);
+	t__2e1001 = (u64)((u64)t_binding_2e878 + (u64)((u64)8UL));
+	t__2e1002 = (u64)((u64)t_binding_2e878 + (u64)((u64)16UL));
+	t__2e1003 = (u64)(*(u64 *)t__2e1001);
+	t__2e1000 = (u64)(u32)(((u64)t__2e1003 == (u64)((u64)6UL)));
+	t__2e997 = (u64)(u32)t__2e1000;
+	if ((u32)t__2e997) goto L__2e998; else goto L__2e999;
+	L__2e998:;
+	t__2e1006 = (u64)((u64)t_binding_2e878 + (u64)((u64)8UL));
+	t__2e1007 = (u64)((u64)t_binding_2e878 + (u64)((u64)16UL));
+	t__2e1008 = (u64)(*(u64 *)t_binding_2e878);
+	t__2e1009 = (u64)(*(u64 *)t__2e1006);
+	t__2e1010 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1005 = (u64)((u64)t__2e1010 * (u64)((u64)4UL));
+	t__2e1005 = (u64)((u64)t__2e1008 + (u64)t__2e1005);
+	t__2e1011 = (u64)(u32)(((u64)t__2e1010 < (u64)t__2e1009));
+	if ((u32)t__2e1011) goto L__2e1013; else goto L__2e1012;
+	L__2e1012:;
+	t_abortsite_2e884 = ((u64)7UL);
+	goto L_abort_2e901;
+	L__2e1013:;
+	t__2e1014 = (u64)(u32)(*(i32 *)t__2e1005);
+	t__2e1004 = (u64)(u32)(((u32)t__2e1014 == (u32)((u64)42UL)));
+	t__2e997 = (u64)(u32)t__2e1004;
+	goto L__2e999;
+	L__2e999:;
+	if ((u32)t__2e997) goto L_passed_2e996; else goto L_failed_2e995;
+	L_failed_2e995:;
+	t_abortsite_2e884 = ((u64)8UL);
+	goto L_abort_2e940;
+	L_passed_2e996:;
+	t__2e1015 = (u64)(*(u64 *)t_binding_2e878);
+	((void (*)(u64))((u64)X_rt_2efree))((u64)t__2e1015);
+	goto L__2e876;
+	L__2e1016:;
+	L__2e876:;
+	return;
+	L_abort_2e885:;
+	t__2e886 = (u64)((u64)t_abortsite_2e884 * (u64)((u64)16UL));
+	t__2e886 = (u64)((u64)((u64)((char *)&D_abortsites_2e883)) + (u64)t__2e886);
+	t__2e887 = (u64)(*(u64 *)t__2e886);
+	t__2e888 = (u64)((u64)t__2e886 + (u64)((u64)8UL));
+	t__2e889 = (u64)(*(u32 *)t__2e888);
+	t__2e888 = (u64)((u64)t__2e886 + (u64)((u64)12UL));
+	t__2e890 = (u64)(*(u32 *)t__2e888);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e887, (u64)t__2e889, (u64)t__2e890, (u64)((u64)2UL));
+	__builtin_trap();
+	L_abort_2e901:;
+	t__2e902 = (u64)((u64)t_abortsite_2e884 * (u64)((u64)16UL));
+	t__2e902 = (u64)((u64)((u64)((char *)&D_abortsites_2e883)) + (u64)t__2e902);
+	t__2e903 = (u64)(*(u64 *)t__2e902);
+	t__2e904 = (u64)((u64)t__2e902 + (u64)((u64)8UL));
+	t__2e905 = (u64)(*(u32 *)t__2e904);
+	t__2e904 = (u64)((u64)t__2e902 + (u64)((u64)12UL));
+	t__2e906 = (u64)(*(u32 *)t__2e904);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e903, (u64)t__2e905, (u64)t__2e906, (u64)((u64)0UL));
+	__builtin_trap();
+	L_abort_2e940:;
+	t__2e941 = (u64)((u64)t_abortsite_2e884 * (u64)((u64)16UL));
+	t__2e941 = (u64)((u64)((u64)((char *)&D_abortsites_2e883)) + (u64)t__2e941);
+	t__2e942 = (u64)(*(u64 *)t__2e941);
+	t__2e943 = (u64)((u64)t__2e941 + (u64)((u64)8UL));
+	t__2e944 = (u64)(*(u32 *)t__2e943);
+	t__2e943 = (u64)((u64)t__2e941 + (u64)((u64)12UL));
+	t__2e945 = (u64)(*(u32 *)t__2e943);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e942, (u64)t__2e944, (u64)t__2e945, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,778 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[20]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e77 { u8 f0; u8 f1; u8 f2; u8 f3[50]; u8 f4; u8 f5; };
+struct __attribute__((packed)) S_strliteral_2e78 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e105 { u8 f0; u8 f1; u8 f2; u8 f3[55]; u8 f4; u8 f5; };
+struct __attribute__((packed)) S_strliteral_2e106 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e19 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; };
+struct __attribute__((packed)) S_abortsites_2e133 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+struct __attribute__((packed)) S_strdata_2e206 { u8 f0; u8 f1; u8 f2; u8 f3[35]; u8 f4; u8 f5; };
+struct __attribute__((packed)) S_strliteral_2e207 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e238 { u8 f0; u8 f1; u8 f2; u8 f3[35]; u8 f4; u8 f5; };
+struct __attribute__((packed)) S_strliteral_2e239 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e258 { u8 f0; u8 f1; u8 f2; u8 f3[16]; u8 f4; u8 f5; u8 f6; u8 f7[34]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e259 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e278 { u8 f0; u8 f1; u8 f2; u8 f3[19]; u8 f4; u8 f5; u8 f6; u8 f7[34]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e279 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e159 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; };
+struct __attribute__((packed)) S_abortsites_2e303 { char *f0; u32 f1; u32 f2; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e77 D_strdata_2e77 __asm__("strdata.77") __attribute__((used, section(".rodata.strdata.77"), aligned(8)));
+static struct S_strliteral_2e78 D_strliteral_2e78 __asm__("strliteral.78") __attribute__((used, section(".data.rel.ro.strliteral.78"), aligned(8)));
+static const struct S_strdata_2e105 D_strdata_2e105 __asm__("strdata.105") __attribute__((used, section(".rodata.strdata.105"), aligned(8)));
+static struct S_strliteral_2e106 D_strliteral_2e106 __asm__("strliteral.106") __attribute__((used, section(".data.rel.ro.strliteral.106"), aligned(8)));
+static struct S_abortsites_2e19 D_abortsites_2e19 __asm__("abortsites.19") __attribute__((used, section(".data.rel.ro.abortsites.19"), aligned(8)));
+static struct S_abortsites_2e133 D_abortsites_2e133 __asm__("abortsites.133") __attribute__((used, section(".data.rel.ro.abortsites.133"), aligned(8)));
+static const struct S_strdata_2e206 D_strdata_2e206 __asm__("strdata.206") __attribute__((used, section(".rodata.strdata.206"), aligned(8)));
+static struct S_strliteral_2e207 D_strliteral_2e207 __asm__("strliteral.207") __attribute__((used, section(".data.rel.ro.strliteral.207"), aligned(8)));
+static const struct S_strdata_2e238 D_strdata_2e238 __asm__("strdata.238") __attribute__((used, section(".rodata.strdata.238"), aligned(8)));
+static struct S_strliteral_2e239 D_strliteral_2e239 __asm__("strliteral.239") __attribute__((used, section(".data.rel.ro.strliteral.239"), aligned(8)));
+static const struct S_strdata_2e258 D_strdata_2e258 __asm__("strdata.258") __attribute__((used, section(".rodata.strdata.258"), aligned(8)));
+static struct S_strliteral_2e259 D_strliteral_2e259 __asm__("strliteral.259") __attribute__((used, section(".data.rel.ro.strliteral.259"), aligned(8)));
+static const struct S_strdata_2e278 D_strdata_2e278 __asm__("strdata.278") __attribute__((used, section(".rodata.strdata.278"), aligned(8)));
+static struct S_strliteral_2e279 D_strliteral_2e279 __asm__("strliteral.279") __attribute__((used, section(".data.rel.ro.strliteral.279"), aligned(8)));
+static struct S_abortsites_2e159 D_abortsites_2e159 __asm__("abortsites.159") __attribute__((used, section(".data.rel.ro.abortsites.159"), aligned(8)));
+static struct S_abortsites_2e303 D_abortsites_2e303 __asm__("abortsites.303") __attribute__((used, section(".data.rel.ro.abortsites.303"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_deref(void) __asm__("deref") __attribute__((used, section(".text.deref")));
+static void F_neg(void) __asm__("neg") __attribute__((used, section(".text.neg")));
+static void F_addr(void) __asm__("addr") __attribute__((used, section(".text.addr")));
+static void F_lnot(void) __asm__("lnot") __attribute__((used, section(".text.lnot")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\062\071\055\165\156\141\162\151\164\150\155\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 20U, 20U };
+static const struct S_strdata_2e77 D_strdata_2e77 = { 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\052\163\164\141\164\151\143\040\141\163\163\145\162\164\050\164\162\165\145\051\073\040\175\073", 10U, 9U };
+static struct S_strliteral_2e78 D_strliteral_2e78 = { (char *)((char *)&D_strdata_2e77) + 0, 55U, 55U };
+static const struct S_strdata_2e105 D_strdata_2e105 = { 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\052\151\146\040\050\164\162\165\145\051\040\046\064\062\040\145\154\163\145\040\046\061\063\063\067\073\040\175\073", 10U, 9U };
+static struct S_strliteral_2e106 D_strliteral_2e106 = { (char *)((char *)&D_strdata_2e105) + 0, 60U, 60U };
+static struct S_abortsites_2e19 D_abortsites_2e19 = { (char *)((char *)&D_strliteral_2e1) + 0, 46U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 23U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 48U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 48U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 52U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 55U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 55U, 12U };
+static struct S_abortsites_2e133 D_abortsites_2e133 = { (char *)((char *)&D_strliteral_2e1) + 0, 40U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 42U, 15U };
+static const struct S_strdata_2e206 D_strdata_2e206 = { 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\046\156\165\154\154\073\040\175\073", 10U, 9U };
+static struct S_strliteral_2e207 D_strliteral_2e207 = { (char *)((char *)&D_strdata_2e206) + 0, 40U, 40U };
+static const struct S_strdata_2e238 D_strdata_2e238 = { 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\046\166\157\151\144\073\040\175\073", 10U, 9U };
+static struct S_strliteral_2e239 D_strliteral_2e239 = { (char *)((char *)&D_strdata_2e238) + 0, 40U, 40U };
+static const struct S_strdata_2e258 D_strdata_2e258 = { 10U, 9U, 9U, "\164\171\160\145\040\146\157\157\040\075\040\166\157\151\144\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\046\146\157\157\073\040\175\073", 10U, 9U };
+static struct S_strliteral_2e259 D_strliteral_2e259 = { (char *)((char *)&D_strdata_2e258) + 0, 58U, 58U };
+static const struct S_strdata_2e278 D_strdata_2e278 = { 10U, 9U, 9U, "\146\156\040\146\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073", 10U, 9U, 9U, "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\046\146\050\051\073\040\175\073", 10U, 9U };
+static struct S_strliteral_2e279 D_strliteral_2e279 = { (char *)((char *)&D_strdata_2e278) + 0, 61U, 61U };
+static struct S_abortsites_2e159 D_abortsites_2e159 = { (char *)((char *)&D_strliteral_2e1) + 0, 12U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 14U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 16U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 18U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 20U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 24U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 24U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 35U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 35U, 12U };
+static struct S_abortsites_2e303 D_abortsites_2e303 = { (char *)((char *)&D_strliteral_2e1) + 0, 6U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_lnot)))();
+	((void (*)(void))((u64)((char *)&F_addr)))();
+	((void (*)(void))((u64)((char *)&F_neg)))();
+	((void (*)(void))((u64)((char *)&F_deref)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_deref(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char B8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[4] __attribute__((aligned(16)));
+	char B12[8] __attribute__((aligned(16)));
+	char B13[24] __attribute__((aligned(16)));
+	char B14[24] __attribute__((aligned(16)));
+	char R15[4] __attribute__((aligned(16)));
+	u64 t__2e102;
+	u64 t__2e104;
+	u64 t__2e108;
+	u64 t__2e117;
+	u64 t__2e119;
+	u64 t__2e13;
+	u64 t__2e15;
+	u64 t__2e16;
+	u64 t__2e18;
+	u64 t__2e22;
+	u64 t__2e23;
+	u64 t__2e24;
+	u64 t__2e25;
+	u64 t__2e26;
+	u64 t__2e29;
+	u64 t__2e30;
+	u64 t__2e35;
+	u64 t__2e36;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e44;
+	u64 t__2e47;
+	u64 t__2e48;
+	u64 t__2e53;
+	u64 t__2e61;
+	u64 t__2e63;
+	u64 t__2e65;
+	u64 t__2e66;
+	u64 t__2e68;
+	u64 t__2e70;
+	u64 t__2e76;
+	u64 t__2e82;
+	u64 t__2e91;
+	u64 t__2e93;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e97;
+	u64 t__2e98;
+	u64 t__2e99;
+	u64 t_abortsite_2e20;
+	u64 t_object_2e103;
+	u64 t_object_2e107;
+	u64 t_object_2e49;
+	u64 t_object_2e72;
+	u64 t_object_2e80;
+	u64 t_tag_2e109;
+	u64 t_tag_2e54;
+	u64 t_tag_2e83;
+	L_start_2e7:;
+	t__2e16 = (u64)A0;
+	t__2e36 = (u64)A1;
+	t_object_2e49 = (u64)A2;
+	t__2e66 = (u64)A3;
+	t_object_2e72 = (u64)A4;
+	t_object_2e80 = (u64)A5;
+	t_object_2e103 = (u64)A6;
+	t_object_2e107 = (u64)A7;
+	L_body_2e8:;
+	*(u32 *)t__2e16 = (u32)((u64)42UL);
+	t__2e15 = t__2e16;
+	goto L__2e14;
+	L__2e17:;
+	L__2e14:;
+	t__2e18 = (u64)(u32)(*(i32 *)t__2e15);
+	t__2e13 = (u64)(u32)(((u32)t__2e18 == (u32)((u64)42UL)));
+	if ((u32)t__2e13) goto L_passed_2e12; else goto L_failed_2e11;
+	L_failed_2e11:;
+	t_abortsite_2e20 = ((u64)0UL);
+	goto L_abort_2e21;
+	L_passed_2e12:;
+	goto L_matches_2e33;
+	L_matches_2e33:;
+	*(u32 *)t__2e36 = (u32)((u64)42UL);
+	t__2e35 = t__2e36;
+	goto L__2e34;
+	L__2e37:;
+	L__2e34:;
+	t__2e30 = t__2e35;
+	goto L__2e31;
+	L__2e32:;
+	t_abortsite_2e20 = ((u64)1UL);
+	goto L_abort_2e38;
+	L__2e31:;
+	t__2e44 = (u64)(u32)(*(i32 *)t__2e30);
+	t__2e29 = (u64)(u32)(((u32)t__2e44 == (u32)((u64)42UL)));
+	if ((u32)t__2e29) goto L_passed_2e28; else goto L_failed_2e27;
+	L_failed_2e27:;
+	t_abortsite_2e20 = ((u64)2UL);
+	goto L_abort_2e21;
+	L_passed_2e28:;
+	*(u32 *)t_object_2e49 = (u32)((u64)1099590421UL);
+	t__2e53 = (u64)((u64)t_object_2e49 + (u64)((u64)4UL));
+	*(u32 *)t__2e53 = (u32)((u64)0UL);
+	t_tag_2e54 = (u64)(*(u32 *)t_object_2e49);
+	t__2e61 = (u64)(u32)(((u32)t_tag_2e54 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e61) goto L_member_2e58; else goto L__2e60;
+	L__2e60:;
+	t__2e63 = (u64)(u32)(((u32)t_tag_2e54 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e63) goto L_member_2e59; else goto L__2e62;
+	L__2e62:;
+	goto L_matches_2e57;
+	L_member_2e58:;
+	goto L_matches_2e57;
+	L_member_2e59:;
+	goto L_matches_2e57;
+	L_matches_2e57:;
+	*(u32 *)t__2e66 = (u32)((u64)42UL);
+	t__2e65 = t__2e66;
+	goto L__2e64;
+	L__2e67:;
+	L__2e64:;
+	t__2e48 = t__2e65;
+	goto L__2e55;
+	L__2e56:;
+	t_abortsite_2e20 = ((u64)3UL);
+	goto L_abort_2e38;
+	L__2e55:;
+	t__2e68 = (u64)(u32)(*(i32 *)t__2e48);
+	t__2e47 = (u64)(u32)(((u32)t__2e68 == (u32)((u64)42UL)));
+	if ((u32)t__2e47) goto L_passed_2e46; else goto L_failed_2e45;
+	L_failed_2e45:;
+	t_abortsite_2e20 = ((u64)4UL);
+	goto L_abort_2e21;
+	L_passed_2e46:;
+	*(u32 *)t_object_2e72 = (u32)((u64)3532310079UL);
+	t__2e76 = (u64)((u64)t_object_2e72 + (u64)((u64)4UL));
+	*(u32 *)t__2e76 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e80 = (u64)((u64)0UL);
+	t__2e82 = (u64)((u64)t_object_2e80 + (u64)((u64)8UL));
+	*(u64 *)t__2e82 = (u64)((u64)0UL);
+	t__2e82 = (u64)((u64)t__2e82 + (u64)((u64)8UL));
+	*(u64 *)t__2e82 = (u64)((u64)0UL);
+	BLIT((u64)B8, t_object_2e72, 8);
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e78)), 24);
+	BLIT((u64)B10, t_object_2e80, 24);
+	t__2e70 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R11, (u64)B8, (u64)B9, (u64)B10);
+	t_tag_2e83 = (u64)(*(u32 *)t__2e70);
+	t__2e91 = (u64)(u32)(((u32)t_tag_2e83 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e91) goto L_member_2e88; else goto L__2e90;
+	L__2e90:;
+	t__2e93 = (u64)(u32)(((u32)t_tag_2e83 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e93) goto L_member_2e89; else goto L__2e92;
+	L__2e92:;
+	goto L_matches_2e87;
+	L_member_2e88:;
+	goto L_matches_2e87;
+	L_member_2e89:;
+	goto L_matches_2e86;
+	L_matches_2e86:;
+	goto L__2e84;
+	L_matches_2e87:;
+	t_abortsite_2e20 = ((u64)5UL);
+	goto L_abort_2e94;
+	L__2e100:;
+	L__2e85:;
+	t_abortsite_2e20 = ((u64)6UL);
+	goto L_abort_2e38;
+	L__2e84:;
+	*(u32 *)t_object_2e103 = (u32)((u64)3532310079UL);
+	t__2e104 = (u64)((u64)t_object_2e103 + (u64)((u64)4UL));
+	*(u32 *)t__2e104 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e107 = (u64)((u64)0UL);
+	t__2e108 = (u64)((u64)t_object_2e107 + (u64)((u64)8UL));
+	*(u64 *)t__2e108 = (u64)((u64)0UL);
+	t__2e108 = (u64)((u64)t__2e108 + (u64)((u64)8UL));
+	*(u64 *)t__2e108 = (u64)((u64)0UL);
+	BLIT((u64)B12, t_object_2e103, 8);
+	BLIT((u64)B13, ((u64)((char *)&D_strliteral_2e106)), 24);
+	BLIT((u64)B14, t_object_2e107, 24);
+	t__2e102 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R15, (u64)B12, (u64)B13, (u64)B14);
+	t_tag_2e109 = (u64)(*(u32 *)t__2e102);
+	t__2e117 = (u64)(u32)(((u32)t_tag_2e109 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e117) goto L_member_2e114; else goto L__2e116;
+	L__2e116:;
+	t__2e119 = (u64)(u32)(((u32)t_tag_2e109 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e119) goto L_member_2e115; else goto L__2e118;
+	L__2e118:;
+	goto L_matches_2e113;
+	L_member_2e114:;
+	goto L_matches_2e113;
+	L_member_2e115:;
+	goto L_matches_2e112;
+	L_matches_2e112:;
+	goto L__2e110;
+	L_matches_2e113:;
+	t_abortsite_2e20 = ((u64)7UL);
+	goto L_abort_2e94;
+	L__2e120:;
+	L__2e111:;
+	t_abortsite_2e20 = ((u64)8UL);
+	goto L_abort_2e38;
+	L__2e110:;
+	goto L__2e9;
+	L__2e121:;
+	L__2e9:;
+	return;
+	L_abort_2e21:;
+	t__2e22 = (u64)((u64)t_abortsite_2e20 * (u64)((u64)16UL));
+	t__2e22 = (u64)((u64)((u64)((char *)&D_abortsites_2e19)) + (u64)t__2e22);
+	t__2e23 = (u64)(*(u64 *)t__2e22);
+	t__2e24 = (u64)((u64)t__2e22 + (u64)((u64)8UL));
+	t__2e25 = (u64)(*(u32 *)t__2e24);
+	t__2e24 = (u64)((u64)t__2e22 + (u64)((u64)12UL));
+	t__2e26 = (u64)(*(u32 *)t__2e24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e23, (u64)t__2e25, (u64)t__2e26, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e38:;
+	t__2e39 = (u64)((u64)t_abortsite_2e20 * (u64)((u64)16UL));
+	t__2e39 = (u64)((u64)((u64)((char *)&D_abortsites_2e19)) + (u64)t__2e39);
+	t__2e40 = (u64)(*(u64 *)t__2e39);
+	t__2e41 = (u64)((u64)t__2e39 + (u64)((u64)8UL));
+	t__2e42 = (u64)(*(u32 *)t__2e41);
+	t__2e41 = (u64)((u64)t__2e39 + (u64)((u64)12UL));
+	t__2e43 = (u64)(*(u32 *)t__2e41);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e40, (u64)t__2e42, (u64)t__2e43, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e94:;
+	t__2e95 = (u64)((u64)t_abortsite_2e20 * (u64)((u64)16UL));
+	t__2e95 = (u64)((u64)((u64)((char *)&D_abortsites_2e19)) + (u64)t__2e95);
+	t__2e96 = (u64)(*(u64 *)t__2e95);
+	t__2e97 = (u64)((u64)t__2e95 + (u64)((u64)8UL));
+	t__2e98 = (u64)(*(u32 *)t__2e97);
+	t__2e97 = (u64)((u64)t__2e95 + (u64)((u64)12UL));
+	t__2e99 = (u64)(*(u32 *)t__2e97);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e96, (u64)t__2e98, (u64)t__2e99, (u64)((u64)7UL));
+	__builtin_trap();
+}
+static void F_neg(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e127;
+	u64 t__2e130;
+	u64 t__2e131;
+	u64 t__2e132;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e139;
+	u64 t__2e140;
+	u64 t__2e142;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t_abortsite_2e134;
+	u64 t_binding_2e126;
+	u64 t_binding_2e141;
+	L_start_2e122:;
+	t_binding_2e126 = (u64)A0;
+	t_binding_2e141 = (u64)A1;
+	L_body_2e123:;
+	t__2e127 = (u64)(u32)(-(u32)((u64)2UL));
+	*(u32 *)t_binding_2e126 = (u32)t__2e127;
+	t__2e131 = (u64)(u32)(*(i32 *)t_binding_2e126);
+	t__2e132 = (u64)(u32)((u32)((u64)0UL) - (u32)((u64)2UL));
+	t__2e130 = (u64)(u32)(((u32)t__2e131 == (u32)t__2e132));
+	if ((u32)t__2e130) goto L_passed_2e129; else goto L_failed_2e128;
+	L_failed_2e128:;
+	t_abortsite_2e134 = ((u64)0UL);
+	goto L_abort_2e135;
+	L_passed_2e129:;
+	t__2e142 = (u64)(u32)((u32)((u64)1UL) - (u32)((u64)1UL));
+	*(u32 *)t_binding_2e141 = (u32)t__2e142;
+	t__2e146 = (u64)(u32)(*(i32 *)t_binding_2e141);
+	t__2e145 = (u64)(u32)(((u32)t__2e146 == (u32)((u64)0UL)));
+	if ((u32)t__2e145) goto L_passed_2e144; else goto L_failed_2e143;
+	L_failed_2e143:;
+	t_abortsite_2e134 = ((u64)1UL);
+	goto L_abort_2e135;
+	L_passed_2e144:;
+	goto L__2e124;
+	L__2e147:;
+	L__2e124:;
+	return;
+	L_abort_2e135:;
+	t__2e136 = (u64)((u64)t_abortsite_2e134 * (u64)((u64)16UL));
+	t__2e136 = (u64)((u64)((u64)((char *)&D_abortsites_2e133)) + (u64)t__2e136);
+	t__2e137 = (u64)(*(u64 *)t__2e136);
+	t__2e138 = (u64)((u64)t__2e136 + (u64)((u64)8UL));
+	t__2e139 = (u64)(*(u32 *)t__2e138);
+	t__2e138 = (u64)((u64)t__2e136 + (u64)((u64)12UL));
+	t__2e140 = (u64)(*(u32 *)t__2e138);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e137, (u64)t__2e139, (u64)t__2e140, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_addr(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[4] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[4] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[4] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char B16[8] __attribute__((aligned(16)));
+	char B17[24] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char R19[4] __attribute__((aligned(16)));
+	char B20[8] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char R23[4] __attribute__((aligned(16)));
+	char B24[8] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char R27[4] __attribute__((aligned(16)));
+	char B28[8] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char R31[4] __attribute__((aligned(16)));
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e162;
+	u64 t__2e163;
+	u64 t__2e164;
+	u64 t__2e165;
+	u64 t__2e166;
+	u64 t__2e168;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t__2e173;
+	u64 t__2e175;
+	u64 t__2e180;
+	u64 t__2e181;
+	u64 t__2e183;
+	u64 t__2e185;
+	u64 t__2e190;
+	u64 t__2e191;
+	u64 t__2e192;
+	u64 t__2e194;
+	u64 t__2e195;
+	u64 t__2e199;
+	u64 t__2e200;
+	u64 t__2e201;
+	u64 t__2e203;
+	u64 t__2e205;
+	u64 t__2e209;
+	u64 t__2e218;
+	u64 t__2e220;
+	u64 t__2e222;
+	u64 t__2e223;
+	u64 t__2e224;
+	u64 t__2e225;
+	u64 t__2e226;
+	u64 t__2e229;
+	u64 t__2e230;
+	u64 t__2e231;
+	u64 t__2e232;
+	u64 t__2e233;
+	u64 t__2e235;
+	u64 t__2e237;
+	u64 t__2e241;
+	u64 t__2e250;
+	u64 t__2e252;
+	u64 t__2e255;
+	u64 t__2e257;
+	u64 t__2e261;
+	u64 t__2e270;
+	u64 t__2e272;
+	u64 t__2e275;
+	u64 t__2e277;
+	u64 t__2e281;
+	u64 t__2e290;
+	u64 t__2e292;
+	u64 t_abortsite_2e160;
+	u64 t_binding_2e152;
+	u64 t_binding_2e153;
+	u64 t_binding_2e167;
+	u64 t_binding_2e174;
+	u64 t_binding_2e184;
+	u64 t_field_2e177;
+	u64 t_field_2e182;
+	u64 t_object_2e204;
+	u64 t_object_2e208;
+	u64 t_object_2e236;
+	u64 t_object_2e240;
+	u64 t_object_2e256;
+	u64 t_object_2e260;
+	u64 t_object_2e276;
+	u64 t_object_2e280;
+	u64 t_tag_2e210;
+	u64 t_tag_2e242;
+	u64 t_tag_2e262;
+	u64 t_tag_2e282;
+	L_start_2e148:;
+	t_binding_2e152 = (u64)A0;
+	t_binding_2e153 = (u64)A1;
+	t_binding_2e167 = (u64)A2;
+	t__2e168 = (u64)A3;
+	t_binding_2e174 = (u64)A4;
+	t__2e175 = (u64)A5;
+	t_binding_2e184 = (u64)A6;
+	t__2e185 = (u64)A7;
+	t_object_2e204 = (u64)A8;
+	t_object_2e208 = (u64)A9;
+	t_object_2e236 = (u64)A10;
+	t_object_2e240 = (u64)A11;
+	t_object_2e256 = (u64)A12;
+	t_object_2e260 = (u64)A13;
+	t_object_2e276 = (u64)A14;
+	t_object_2e280 = (u64)A15;
+	L_body_2e149:;
+	*(u32 *)t_binding_2e152 = (u32)((u64)42UL);
+	*(u64 *)t_binding_2e153 = (u64)t_binding_2e152;
+	t__2e157 = (u64)(*(u64 *)t_binding_2e153);
+	t__2e158 = (u64)(u32)(*(i32 *)t__2e157);
+	t__2e156 = (u64)(u32)(((u32)t__2e158 == (u32)((u64)42UL)));
+	if ((u32)t__2e156) goto L_passed_2e155; else goto L_failed_2e154;
+	L_failed_2e154:;
+	t_abortsite_2e160 = ((u64)0UL);
+	goto L_abort_2e161;
+	L_passed_2e155:;
+	*(u32 *)t__2e168 = (u32)((u64)69UL);
+	*(u64 *)t_binding_2e167 = (u64)t__2e168;
+	t__2e172 = (u64)(*(u64 *)t_binding_2e167);
+	t__2e173 = (u64)(u32)(*(i32 *)t__2e172);
+	t__2e171 = (u64)(u32)(((u32)t__2e173 == (u32)((u64)69UL)));
+	if ((u32)t__2e171) goto L_passed_2e170; else goto L_failed_2e169;
+	L_failed_2e169:;
+	t_abortsite_2e160 = ((u64)1UL);
+	goto L_abort_2e161;
+	L_passed_2e170:;
+	t_field_2e177 = (u64)((u64)t__2e175 + (u64)((u64)0UL));
+	*(u32 *)t_field_2e177 = (u32)((u64)42UL);
+	*(u64 *)t_binding_2e174 = (u64)t__2e175;
+	t__2e181 = (u64)(*(u64 *)t_binding_2e174);
+	t_field_2e182 = (u64)((u64)t__2e181 + (u64)((u64)0UL));
+	t__2e183 = (u64)(u32)(*(i32 *)t_field_2e182);
+	t__2e180 = (u64)(u32)(((u32)t__2e183 == (u32)((u64)42UL)));
+	if ((u32)t__2e180) goto L_passed_2e179; else goto L_failed_2e178;
+	L_failed_2e178:;
+	t_abortsite_2e160 = ((u64)2UL);
+	goto L_abort_2e161;
+	L_passed_2e179:;
+	*(u32 *)t__2e185 = (u32)((u64)42UL);
+	goto L__2e186;
+	L__2e187:;
+	L__2e186:;
+	*(u64 *)t_binding_2e184 = (u64)t__2e185;
+	t__2e191 = (u64)(*(u64 *)t_binding_2e184);
+	t__2e192 = (u64)(u32)(*(i32 *)t__2e191);
+	t__2e190 = (u64)(u32)(((u32)t__2e192 == (u32)((u64)42UL)));
+	if ((u32)t__2e190) goto L_passed_2e189; else goto L_failed_2e188;
+	L_failed_2e188:;
+	t_abortsite_2e160 = ((u64)3UL);
+	goto L_abort_2e161;
+	L_passed_2e189:;
+	t__2e195 = (u64)(*(u64 *)t_binding_2e184);
+	t__2e194 = t__2e195;
+	goto L__2e193;
+	L__2e196:;
+	L__2e193:;
+	*(u32 *)t__2e194 = (u32)((u64)12UL);
+	t__2e200 = (u64)(*(u64 *)t_binding_2e184);
+	t__2e201 = (u64)(u32)(*(i32 *)t__2e200);
+	t__2e199 = (u64)(u32)(((u32)t__2e201 == (u32)((u64)12UL)));
+	if ((u32)t__2e199) goto L_passed_2e198; else goto L_failed_2e197;
+	L_failed_2e197:;
+	t_abortsite_2e160 = ((u64)4UL);
+	goto L_abort_2e161;
+	L_passed_2e198:;
+	*(u32 *)t_object_2e204 = (u32)((u64)3532310079UL);
+	t__2e205 = (u64)((u64)t_object_2e204 + (u64)((u64)4UL));
+	*(u32 *)t__2e205 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e208 = (u64)((u64)0UL);
+	t__2e209 = (u64)((u64)t_object_2e208 + (u64)((u64)8UL));
+	*(u64 *)t__2e209 = (u64)((u64)0UL);
+	t__2e209 = (u64)((u64)t__2e209 + (u64)((u64)8UL));
+	*(u64 *)t__2e209 = (u64)((u64)0UL);
+	BLIT((u64)B16, t_object_2e204, 8);
+	BLIT((u64)B17, ((u64)((char *)&D_strliteral_2e207)), 24);
+	BLIT((u64)B18, t_object_2e208, 24);
+	t__2e203 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R19, (u64)B16, (u64)B17, (u64)B18);
+	t_tag_2e210 = (u64)(*(u32 *)t__2e203);
+	t__2e218 = (u64)(u32)(((u32)t_tag_2e210 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e218) goto L_member_2e215; else goto L__2e217;
+	L__2e217:;
+	t__2e220 = (u64)(u32)(((u32)t_tag_2e210 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e220) goto L_member_2e216; else goto L__2e219;
+	L__2e219:;
+	goto L_matches_2e214;
+	L_member_2e215:;
+	goto L_matches_2e214;
+	L_member_2e216:;
+	goto L_matches_2e213;
+	L_matches_2e213:;
+	goto L__2e211;
+	L_matches_2e214:;
+	t_abortsite_2e160 = ((u64)5UL);
+	goto L_abort_2e221;
+	L__2e227:;
+	L__2e212:;
+	t_abortsite_2e160 = ((u64)6UL);
+	goto L_abort_2e228;
+	L__2e211:;
+	*(u32 *)t_object_2e236 = (u32)((u64)3532310079UL);
+	t__2e237 = (u64)((u64)t_object_2e236 + (u64)((u64)4UL));
+	*(u32 *)t__2e237 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e240 = (u64)((u64)0UL);
+	t__2e241 = (u64)((u64)t_object_2e240 + (u64)((u64)8UL));
+	*(u64 *)t__2e241 = (u64)((u64)0UL);
+	t__2e241 = (u64)((u64)t__2e241 + (u64)((u64)8UL));
+	*(u64 *)t__2e241 = (u64)((u64)0UL);
+	BLIT((u64)B20, t_object_2e236, 8);
+	BLIT((u64)B21, ((u64)((char *)&D_strliteral_2e239)), 24);
+	BLIT((u64)B22, t_object_2e240, 24);
+	t__2e235 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R23, (u64)B20, (u64)B21, (u64)B22);
+	t_tag_2e242 = (u64)(*(u32 *)t__2e235);
+	t__2e250 = (u64)(u32)(((u32)t_tag_2e242 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e250) goto L_member_2e247; else goto L__2e249;
+	L__2e249:;
+	t__2e252 = (u64)(u32)(((u32)t_tag_2e242 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e252) goto L_member_2e248; else goto L__2e251;
+	L__2e251:;
+	goto L_matches_2e246;
+	L_member_2e247:;
+	goto L_matches_2e246;
+	L_member_2e248:;
+	goto L_matches_2e245;
+	L_matches_2e245:;
+	goto L__2e243;
+	L_matches_2e246:;
+	t_abortsite_2e160 = ((u64)7UL);
+	goto L_abort_2e221;
+	L__2e253:;
+	L__2e244:;
+	t_abortsite_2e160 = ((u64)8UL);
+	goto L_abort_2e228;
+	L__2e243:;
+	*(u32 *)t_object_2e256 = (u32)((u64)3532310079UL);
+	t__2e257 = (u64)((u64)t_object_2e256 + (u64)((u64)4UL));
+	*(u32 *)t__2e257 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e260 = (u64)((u64)0UL);
+	t__2e261 = (u64)((u64)t_object_2e260 + (u64)((u64)8UL));
+	*(u64 *)t__2e261 = (u64)((u64)0UL);
+	t__2e261 = (u64)((u64)t__2e261 + (u64)((u64)8UL));
+	*(u64 *)t__2e261 = (u64)((u64)0UL);
+	BLIT((u64)B24, t_object_2e256, 8);
+	BLIT((u64)B25, ((u64)((char *)&D_strliteral_2e259)), 24);
+	BLIT((u64)B26, t_object_2e260, 24);
+	t__2e255 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R27, (u64)B24, (u64)B25, (u64)B26);
+	t_tag_2e262 = (u64)(*(u32 *)t__2e255);
+	t__2e270 = (u64)(u32)(((u32)t_tag_2e262 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e270) goto L_member_2e267; else goto L__2e269;
+	L__2e269:;
+	t__2e272 = (u64)(u32)(((u32)t_tag_2e262 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e272) goto L_member_2e268; else goto L__2e271;
+	L__2e271:;
+	goto L_matches_2e266;
+	L_member_2e267:;
+	goto L_matches_2e266;
+	L_member_2e268:;
+	goto L_matches_2e265;
+	L_matches_2e265:;
+	goto L__2e263;
+	L_matches_2e266:;
+	t_abortsite_2e160 = ((u64)9UL);
+	goto L_abort_2e221;
+	L__2e273:;
+	L__2e264:;
+	t_abortsite_2e160 = ((u64)10UL);
+	goto L_abort_2e228;
+	L__2e263:;
+	*(u32 *)t_object_2e276 = (u32)((u64)3532310079UL);
+	t__2e277 = (u64)((u64)t_object_2e276 + (u64)((u64)4UL));
+	*(u32 *)t__2e277 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e280 = (u64)((u64)0UL);
+	t__2e281 = (u64)((u64)t_object_2e280 + (u64)((u64)8UL));
+	*(u64 *)t__2e281 = (u64)((u64)0UL);
+	t__2e281 = (u64)((u64)t__2e281 + (u64)((u64)8UL));
+	*(u64 *)t__2e281 = (u64)((u64)0UL);
+	BLIT((u64)B28, t_object_2e276, 8);
+	BLIT((u64)B29, ((u64)((char *)&D_strliteral_2e279)), 24);
+	BLIT((u64)B30, t_object_2e280, 24);
+	t__2e275 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R31, (u64)B28, (u64)B29, (u64)B30);
+	t_tag_2e282 = (u64)(*(u32 *)t__2e275);
+	t__2e290 = (u64)(u32)(((u32)t_tag_2e282 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e290) goto L_member_2e287; else goto L__2e289;
+	L__2e289:;
+	t__2e292 = (u64)(u32)(((u32)t_tag_2e282 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e292) goto L_member_2e288; else goto L__2e291;
+	L__2e291:;
+	goto L_matches_2e286;
+	L_member_2e287:;
+	goto L_matches_2e286;
+	L_member_2e288:;
+	goto L_matches_2e285;
+	L_matches_2e285:;
+	goto L__2e283;
+	L_matches_2e286:;
+	t_abortsite_2e160 = ((u64)11UL);
+	goto L_abort_2e221;
+	L__2e293:;
+	L__2e284:;
+	t_abortsite_2e160 = ((u64)12UL);
+	goto L_abort_2e228;
+	L__2e283:;
+	goto L__2e150;
+	L__2e294:;
+	L__2e150:;
+	return;
+	L_abort_2e161:;
+	t__2e162 = (u64)((u64)t_abortsite_2e160 * (u64)((u64)16UL));
+	t__2e162 = (u64)((u64)((u64)((char *)&D_abortsites_2e159)) + (u64)t__2e162);
+	t__2e163 = (u64)(*(u64 *)t__2e162);
+	t__2e164 = (u64)((u64)t__2e162 + (u64)((u64)8UL));
+	t__2e165 = (u64)(*(u32 *)t__2e164);
+	t__2e164 = (u64)((u64)t__2e162 + (u64)((u64)12UL));
+	t__2e166 = (u64)(*(u32 *)t__2e164);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e163, (u64)t__2e165, (u64)t__2e166, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e221:;
+	t__2e222 = (u64)((u64)t_abortsite_2e160 * (u64)((u64)16UL));
+	t__2e222 = (u64)((u64)((u64)((char *)&D_abortsites_2e159)) + (u64)t__2e222);
+	t__2e223 = (u64)(*(u64 *)t__2e222);
+	t__2e224 = (u64)((u64)t__2e222 + (u64)((u64)8UL));
+	t__2e225 = (u64)(*(u32 *)t__2e224);
+	t__2e224 = (u64)((u64)t__2e222 + (u64)((u64)12UL));
+	t__2e226 = (u64)(*(u32 *)t__2e224);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e223, (u64)t__2e225, (u64)t__2e226, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e228:;
+	t__2e229 = (u64)((u64)t_abortsite_2e160 * (u64)((u64)16UL));
+	t__2e229 = (u64)((u64)((u64)((char *)&D_abortsites_2e159)) + (u64)t__2e229);
+	t__2e230 = (u64)(*(u64 *)t__2e229);
+	t__2e231 = (u64)((u64)t__2e229 + (u64)((u64)8UL));
+	t__2e232 = (u64)(*(u32 *)t__2e231);
+	t__2e231 = (u64)((u64)t__2e229 + (u64)((u64)12UL));
+	t__2e233 = (u64)(*(u32 *)t__2e231);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e230, (u64)t__2e232, (u64)t__2e233, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_lnot(void) {
+	u64 t__2e301;
+	u64 t__2e302;
+	u64 t__2e306;
+	u64 t__2e307;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t_abortsite_2e304;
+	L_start_2e295:;
+	L_body_2e296:;
+	t__2e302 = (u64)(u32)((u8)((u64)0UL));
+	t__2e301 = (u64)(u32)(((u32)t__2e302 == (u32)((u64)0UL)));
+	if ((u32)t__2e301) goto L_passed_2e300; else goto L_failed_2e299;
+	L_failed_2e299:;
+	t_abortsite_2e304 = ((u64)0UL);
+	goto L_abort_2e305;
+	L_passed_2e300:;
+	goto L__2e297;
+	L__2e311:;
+	L__2e297:;
+	return;
+	L_abort_2e305:;
+	t__2e306 = (u64)((u64)t_abortsite_2e304 * (u64)((u64)16UL));
+	t__2e306 = (u64)((u64)((u64)((char *)&D_abortsites_2e303)) + (u64)t__2e306);
+	t__2e307 = (u64)(*(u64 *)t__2e306);
+	t__2e308 = (u64)((u64)t__2e306 + (u64)((u64)8UL));
+	t__2e309 = (u64)(*(u32 *)t__2e308);
+	t__2e308 = (u64)((u64)t__2e306 + (u64)((u64)12UL));
+	t__2e310 = (u64)(*(u32 *)t__2e308);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e307, (u64)t__2e309, (u64)t__2e310, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,874 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e17 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; };
+struct __attribute__((packed)) S_abortsites_2e88 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; };
+struct __attribute__((packed)) S_abortsites_2e210 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; };
+struct __attribute__((packed)) S_abortsites_2e261 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e17 D_abortsites_2e17 __asm__("abortsites.17") __attribute__((used, section(".data.rel.ro.abortsites.17"), aligned(8)));
+static struct S_abortsites_2e88 D_abortsites_2e88 __asm__("abortsites.88") __attribute__((used, section(".data.rel.ro.abortsites.88"), aligned(8)));
+static struct S_abortsites_2e210 D_abortsites_2e210 __asm__("abortsites.210") __attribute__((used, section(".data.rel.ro.abortsites.210"), aligned(8)));
+static struct S_abortsites_2e261 D_abortsites_2e261 __asm__("abortsites.261") __attribute__((used, section(".data.rel.ro.abortsites.261"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_calls(void) __asm__("calls") __attribute__((used, section(".text.calls")));
+static u64 F_aggregate(u64 __rp, u64 p_c) __asm__("aggregate") __attribute__((used, section(".text.aggregate")));
+static u32 F_equal(u32 p_x, u32 p_y) __asm__("equal") __attribute__((used, section(".text.equal")));
+static u64 F_foo(void) __asm__("foo") __attribute__((used, section(".text.foo")));
+static void F_deref(void) __asm__("deref") __attribute__((used, section(".text.deref")));
+static u32 F_not(u32 p_x) __asm__("not") __attribute__((used, section(".text.not")));
+static void F_nonaccess(void) __asm__("nonaccess") __attribute__((used, section(".text.nonaccess")));
+static void F_nested(void) __asm__("nested") __attribute__((used, section(".text.nested")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\063\061\055\160\157\163\164\146\151\170\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 19U, 19U };
+static struct S_abortsites_2e17 D_abortsites_2e17 = { (char *)((char *)&D_strliteral_2e1) + 0, 72U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 80U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 85U, 15U };
+static struct S_abortsites_2e88 D_abortsites_2e88 = { (char *)((char *)&D_strliteral_2e1) + 0, 46U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 48U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 53U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 54U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 55U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 64U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 65U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 66U, 15U };
+static struct S_abortsites_2e210 D_abortsites_2e210 = { (char *)((char *)&D_strliteral_2e1) + 0, 35U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 37U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 38U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 15U };
+static struct S_abortsites_2e261 D_abortsites_2e261 = { (char *)((char *)&D_strliteral_2e1) + 0, 17U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 18U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 23U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 24U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 25U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 26U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 29U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 30U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_nested)))();
+	((void (*)(void))((u64)((char *)&F_nonaccess)))();
+	((void (*)(void))((u64)((char *)&F_deref)))();
+	((void (*)(void))((u64)((char *)&F_calls)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_calls(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[12] __attribute__((aligned(16)));
+	char A2[4] __attribute__((aligned(16)));
+	char A3[16] __attribute__((aligned(16)));
+	char B4[16] __attribute__((aligned(16)));
+	char R5[16] __attribute__((aligned(16)));
+	u64 t__2e12;
+	u64 t__2e15;
+	u64 t__2e16;
+	u64 t__2e20;
+	u64 t__2e21;
+	u64 t__2e22;
+	u64 t__2e23;
+	u64 t__2e24;
+	u64 t__2e30;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t__2e33;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e46;
+	u64 t__2e47;
+	u64 t__2e51;
+	u64 t__2e54;
+	u64 t__2e57;
+	u64 t__2e59;
+	u64 t__2e60;
+	u64 t__2e62;
+	u64 t_abortsite_2e18;
+	u64 t_binding_2e11;
+	u64 t_binding_2e25;
+	u64 t_binding_2e43;
+	u64 t_binding_2e48;
+	u64 t_field_2e50;
+	u64 t_field_2e58;
+	u64 t_field_2e61;
+	u64 t_item_2e27;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	t_binding_2e25 = (u64)A1;
+	t_binding_2e43 = (u64)A2;
+	t_binding_2e48 = (u64)A3;
+	L_body_2e8:;
+	t__2e12 = (u64)(((u64 (*)(void))((u64)((char *)&F_foo)))());
+	*(u64 *)t_binding_2e11 = (u64)t__2e12;
+	t__2e16 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e15 = (u64)(u32)(((u64)t__2e16 == (u64)((u64)2UL)));
+	if ((u32)t__2e15) goto L_passed_2e14; else goto L_failed_2e13;
+	L_failed_2e13:;
+	t_abortsite_2e18 = ((u64)0UL);
+	goto L_abort_2e19;
+	L_passed_2e14:;
+	t_item_2e27 = (u64)((u64)t_binding_2e25 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e27 = (u32)((u64)1UL);
+	t_item_2e27 = (u64)((u64)t_binding_2e25 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e27 = (u32)((u64)2UL);
+	t_item_2e27 = (u64)((u64)t_binding_2e25 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e27 = (u32)((u64)3UL);
+	t__2e32 = (u64)(((u64 (*)(void))((u64)((char *)&F_foo)))());
+	t__2e31 = (u64)((u64)t__2e32 * (u64)((u64)4UL));
+	t__2e31 = (u64)((u64)t_binding_2e25 + (u64)t__2e31);
+	t__2e33 = (u64)(u32)(((u64)t__2e32 < (u64)((u64)3UL)));
+	if ((u32)t__2e33) goto L__2e35; else goto L__2e34;
+	L__2e34:;
+	t_abortsite_2e18 = ((u64)1UL);
+	goto L_abort_2e36;
+	L__2e35:;
+	t__2e42 = (u64)(u32)(*(i32 *)t__2e31);
+	t__2e30 = (u64)(u32)(((u32)t__2e42 == (u32)((u64)3UL)));
+	if ((u32)t__2e30) goto L_passed_2e29; else goto L_failed_2e28;
+	L_failed_2e28:;
+	t_abortsite_2e18 = ((u64)2UL);
+	goto L_abort_2e19;
+	L_passed_2e29:;
+	*(u32 *)t_binding_2e43 = (u32)((u64)1234UL);
+	t__2e47 = (u64)(u32)(*(i32 *)t_binding_2e43);
+	t__2e46 = (u64)(u32)(((u32 (*)(u32, u32))((u64)((char *)&F_equal)))((u32)t__2e47, (u32)((u64)1234UL)));
+	if ((u32)t__2e46) goto L_passed_2e45; else goto L_failed_2e44;
+	L_failed_2e44:;
+	t_abortsite_2e18 = ((u64)3UL);
+	goto L_abort_2e19;
+	L_passed_2e45:;
+	t_field_2e50 = (u64)((u64)t_binding_2e48 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e50 = (u64)((u64)1234UL);
+	t_field_2e50 = (u64)((u64)t_binding_2e48 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e50 = (u64)((u64)4321UL);
+	BLIT((u64)B4, t_binding_2e48, 16);
+	t__2e51 = ((u64 (*)(u64, u64))((u64)((char *)&F_aggregate)))((u64)R5, (u64)B4);
+	t_field_2e58 = (u64)((u64)t__2e51 + (u64)((u64)0UL));
+	t__2e59 = (u64)(*(u64 *)t_field_2e58);
+	t__2e57 = (u64)(u32)(((u64)t__2e59 == (u64)((u64)1234UL)));
+	t__2e54 = (u64)(u32)t__2e57;
+	if ((u32)t__2e54) goto L__2e55; else goto L__2e56;
+	L__2e55:;
+	t_field_2e61 = (u64)((u64)t__2e51 + (u64)((u64)8UL));
+	t__2e62 = (u64)(*(u64 *)t_field_2e61);
+	t__2e60 = (u64)(u32)(((u64)t__2e62 == (u64)((u64)4321UL)));
+	t__2e54 = (u64)(u32)t__2e60;
+	goto L__2e56;
+	L__2e56:;
+	if ((u32)t__2e54) goto L_passed_2e53; else goto L_failed_2e52;
+	L_failed_2e52:;
+	t_abortsite_2e18 = ((u64)4UL);
+	goto L_abort_2e19;
+	L_passed_2e53:;
+	goto L__2e9;
+	L__2e63:;
+	L__2e9:;
+	return;
+	L_abort_2e19:;
+	t__2e20 = (u64)((u64)t_abortsite_2e18 * (u64)((u64)16UL));
+	t__2e20 = (u64)((u64)((u64)((char *)&D_abortsites_2e17)) + (u64)t__2e20);
+	t__2e21 = (u64)(*(u64 *)t__2e20);
+	t__2e22 = (u64)((u64)t__2e20 + (u64)((u64)8UL));
+	t__2e23 = (u64)(*(u32 *)t__2e22);
+	t__2e22 = (u64)((u64)t__2e20 + (u64)((u64)12UL));
+	t__2e24 = (u64)(*(u32 *)t__2e22);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e21, (u64)t__2e23, (u64)t__2e24, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e36:;
+	t__2e37 = (u64)((u64)t_abortsite_2e18 * (u64)((u64)16UL));
+	t__2e37 = (u64)((u64)((u64)((char *)&D_abortsites_2e17)) + (u64)t__2e37);
+	t__2e38 = (u64)(*(u64 *)t__2e37);
+	t__2e39 = (u64)((u64)t__2e37 + (u64)((u64)8UL));
+	t__2e40 = (u64)(*(u32 *)t__2e39);
+	t__2e39 = (u64)((u64)t__2e37 + (u64)((u64)12UL));
+	t__2e41 = (u64)(*(u32 *)t__2e39);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e38, (u64)t__2e40, (u64)t__2e41, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static u64 F_aggregate(u64 __rp, u64 p_c) {
+	u64 t_c;
+	t_c = p_c;
+	L_start_2e64:;
+	L_body_2e65:;
+	BLIT(__rp, t_c, 16); return __rp;
+}
+static u32 F_equal(u32 p_x, u32 p_y) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e70;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t_param_2e67;
+	u64 t_param_2e68;
+	u64 t_x;
+	u64 t_y;
+	t_x = (u64)p_x;
+	t_y = (u64)p_y;
+	L_start_2e66:;
+	t_param_2e67 = (u64)A0;
+	t_param_2e68 = (u64)A1;
+	*(u32 *)t_param_2e67 = (u32)t_x;
+	*(u32 *)t_param_2e68 = (u32)t_y;
+	L_body_2e69:;
+	t__2e71 = (u64)(u32)(*(i32 *)t_param_2e67);
+	t__2e72 = (u64)(u32)(*(i32 *)t_param_2e68);
+	t__2e70 = (u64)(u32)(((u32)t__2e71 == (u32)t__2e72));
+	return (u32)t__2e70;
+}
+static u64 F_foo(void) {
+	L_start_2e73:;
+	L_body_2e74:;
+	return (u64)((u64)2UL);
+}
+static void F_deref(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[16] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[16] __attribute__((aligned(16)));
+	char A7[8] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	u64 t__2e101;
+	u64 t__2e104;
+	u64 t__2e105;
+	u64 t__2e106;
+	u64 t__2e108;
+	u64 t__2e116;
+	u64 t__2e117;
+	u64 t__2e118;
+	u64 t__2e119;
+	u64 t__2e122;
+	u64 t__2e123;
+	u64 t__2e124;
+	u64 t__2e125;
+	u64 t__2e126;
+	u64 t__2e129;
+	u64 t__2e130;
+	u64 t__2e131;
+	u64 t__2e132;
+	u64 t__2e133;
+	u64 t__2e134;
+	u64 t__2e140;
+	u64 t__2e141;
+	u64 t__2e143;
+	u64 t__2e144;
+	u64 t__2e148;
+	u64 t__2e149;
+	u64 t__2e150;
+	u64 t__2e151;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e160;
+	u64 t__2e161;
+	u64 t__2e164;
+	u64 t__2e169;
+	u64 t__2e170;
+	u64 t__2e171;
+	u64 t__2e172;
+	u64 t__2e175;
+	u64 t__2e176;
+	u64 t__2e177;
+	u64 t__2e178;
+	u64 t__2e179;
+	u64 t__2e182;
+	u64 t__2e183;
+	u64 t__2e184;
+	u64 t__2e185;
+	u64 t__2e186;
+	u64 t__2e187;
+	u64 t__2e85;
+	u64 t__2e87;
+	u64 t__2e91;
+	u64 t__2e92;
+	u64 t__2e93;
+	u64 t__2e94;
+	u64 t__2e95;
+	u64 t__2e98;
+	u64 t__2e99;
+	u64 t_abortsite_2e89;
+	u64 t_binding_2e109;
+	u64 t_binding_2e112;
+	u64 t_binding_2e113;
+	u64 t_binding_2e135;
+	u64 t_binding_2e137;
+	u64 t_binding_2e165;
+	u64 t_binding_2e166;
+	u64 t_binding_2e79;
+	u64 t_binding_2e81;
+	u64 t_binding_2e82;
+	u64 t_field_2e100;
+	u64 t_field_2e107;
+	u64 t_field_2e136;
+	u64 t_field_2e142;
+	u64 t_field_2e159;
+	u64 t_field_2e80;
+	u64 t_field_2e86;
+	u64 t_item_2e111;
+	L_start_2e75:;
+	t_binding_2e79 = (u64)A0;
+	t_binding_2e81 = (u64)A1;
+	t_binding_2e82 = (u64)A2;
+	t_binding_2e109 = (u64)A3;
+	t_binding_2e112 = (u64)A4;
+	t_binding_2e113 = (u64)A5;
+	t_binding_2e135 = (u64)A6;
+	t_binding_2e137 = (u64)A7;
+	t_binding_2e165 = (u64)A8;
+	t_binding_2e166 = (u64)A9;
+	L_body_2e76:;
+	t_field_2e80 = (u64)((u64)t_binding_2e79 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e80 = (u64)((u64)10UL);
+	t_field_2e80 = (u64)((u64)t_binding_2e79 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e80 = (u64)((u64)20UL);
+	*(u64 *)t_binding_2e81 = (u64)t_binding_2e79;
+	*(u64 *)t_binding_2e82 = (u64)t_binding_2e81;
+	t_field_2e86 = (u64)((u64)t_binding_2e79 + (u64)((u64)0UL));
+	t__2e87 = (u64)(*(u64 *)t_field_2e86);
+	t__2e85 = (u64)(u32)(((u64)t__2e87 == (u64)((u64)10UL)));
+	if ((u32)t__2e85) goto L_passed_2e84; else goto L_failed_2e83;
+	L_failed_2e83:;
+	t_abortsite_2e89 = ((u64)0UL);
+	goto L_abort_2e90;
+	L_passed_2e84:;
+	t__2e99 = (u64)(*(u64 *)t_binding_2e81);
+	t_field_2e100 = (u64)((u64)t__2e99 + (u64)((u64)0UL));
+	t__2e101 = (u64)(*(u64 *)t_field_2e100);
+	t__2e98 = (u64)(u32)(((u64)t__2e101 == (u64)((u64)10UL)));
+	if ((u32)t__2e98) goto L_passed_2e97; else goto L_failed_2e96;
+	L_failed_2e96:;
+	t_abortsite_2e89 = ((u64)1UL);
+	goto L_abort_2e90;
+	L_passed_2e97:;
+	t__2e105 = (u64)(*(u64 *)t_binding_2e82);
+	t__2e106 = (u64)(*(u64 *)t__2e105);
+	t_field_2e107 = (u64)((u64)t__2e106 + (u64)((u64)0UL));
+	t__2e108 = (u64)(*(u64 *)t_field_2e107);
+	t__2e104 = (u64)(u32)(((u64)t__2e108 == (u64)((u64)10UL)));
+	if ((u32)t__2e104) goto L_passed_2e103; else goto L_failed_2e102;
+	L_failed_2e102:;
+	t_abortsite_2e89 = ((u64)2UL);
+	goto L_abort_2e90;
+	L_passed_2e103:;
+	t_item_2e111 = (u64)((u64)t_binding_2e109 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e111 = (u32)((u64)1UL);
+	t_item_2e111 = (u64)((u64)t_binding_2e109 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e111 = (u32)((u64)3UL);
+	t_item_2e111 = (u64)((u64)t_binding_2e109 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e111 = (u32)((u64)3UL);
+	t_item_2e111 = (u64)((u64)t_binding_2e109 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e111 = (u32)((u64)7UL);
+	*(u64 *)t_binding_2e112 = (u64)t_binding_2e109;
+	*(u64 *)t_binding_2e113 = (u64)t_binding_2e112;
+	t__2e118 = (u64)((i64)(i32)((u64)2UL));
+	t__2e117 = (u64)((u64)t__2e118 * (u64)((u64)4UL));
+	t__2e117 = (u64)((u64)t_binding_2e109 + (u64)t__2e117);
+	t__2e119 = (u64)(u32)(*(i32 *)t__2e117);
+	t__2e116 = (u64)(u32)(((u32)t__2e119 == (u32)((u64)3UL)));
+	if ((u32)t__2e116) goto L_passed_2e115; else goto L_failed_2e114;
+	L_failed_2e114:;
+	t_abortsite_2e89 = ((u64)3UL);
+	goto L_abort_2e90;
+	L_passed_2e115:;
+	t__2e123 = (u64)(*(u64 *)t_binding_2e112);
+	t__2e125 = (u64)((i64)(i32)((u64)2UL));
+	t__2e124 = (u64)((u64)t__2e125 * (u64)((u64)4UL));
+	t__2e124 = (u64)((u64)t__2e123 + (u64)t__2e124);
+	t__2e126 = (u64)(u32)(*(i32 *)t__2e124);
+	t__2e122 = (u64)(u32)(((u32)t__2e126 == (u32)((u64)3UL)));
+	if ((u32)t__2e122) goto L_passed_2e121; else goto L_failed_2e120;
+	L_failed_2e120:;
+	t_abortsite_2e89 = ((u64)4UL);
+	goto L_abort_2e90;
+	L_passed_2e121:;
+	t__2e130 = (u64)(*(u64 *)t_binding_2e113);
+	t__2e131 = (u64)(*(u64 *)t__2e130);
+	t__2e133 = (u64)((i64)(i32)((u64)2UL));
+	t__2e132 = (u64)((u64)t__2e133 * (u64)((u64)4UL));
+	t__2e132 = (u64)((u64)t__2e131 + (u64)t__2e132);
+	t__2e134 = (u64)(u32)(*(i32 *)t__2e132);
+	t__2e129 = (u64)(u32)(((u32)t__2e134 == (u32)((u64)3UL)));
+	if ((u32)t__2e129) goto L_passed_2e128; else goto L_failed_2e127;
+	L_failed_2e127:;
+	t_abortsite_2e89 = ((u64)5UL);
+	goto L_abort_2e90;
+	L_passed_2e128:;
+	t_field_2e136 = (u64)((u64)t_binding_2e135 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e136 = (u64)((u64)2UL);
+	t_field_2e136 = (u64)((u64)t_binding_2e135 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e136 = (u64)((u64)2UL);
+	*(u64 *)t_binding_2e137 = (u64)t_binding_2e135;
+	t_field_2e142 = (u64)((u64)t_binding_2e135 + (u64)((u64)0UL));
+	t__2e143 = (u64)(*(u64 *)t_field_2e142);
+	t__2e141 = (u64)((u64)t__2e143 * (u64)((u64)4UL));
+	t__2e141 = (u64)((u64)t_binding_2e109 + (u64)t__2e141);
+	t__2e144 = (u64)(u32)(((u64)t__2e143 < (u64)((u64)4UL)));
+	if ((u32)t__2e144) goto L__2e146; else goto L__2e145;
+	L__2e145:;
+	t_abortsite_2e89 = ((u64)6UL);
+	goto L_abort_2e147;
+	L__2e146:;
+	t__2e153 = (u64)(u32)(*(i32 *)t__2e141);
+	t__2e140 = (u64)(u32)(((u32)t__2e153 == (u32)((u64)3UL)));
+	if ((u32)t__2e140) goto L_passed_2e139; else goto L_failed_2e138;
+	L_failed_2e138:;
+	t_abortsite_2e89 = ((u64)7UL);
+	goto L_abort_2e90;
+	L_passed_2e139:;
+	t__2e158 = (u64)(*(u64 *)t_binding_2e137);
+	t_field_2e159 = (u64)((u64)t__2e158 + (u64)((u64)0UL));
+	t__2e160 = (u64)(*(u64 *)t_field_2e159);
+	t__2e157 = (u64)((u64)t__2e160 * (u64)((u64)4UL));
+	t__2e157 = (u64)((u64)t_binding_2e109 + (u64)t__2e157);
+	t__2e161 = (u64)(u32)(((u64)t__2e160 < (u64)((u64)4UL)));
+	if ((u32)t__2e161) goto L__2e163; else goto L__2e162;
+	L__2e162:;
+	t_abortsite_2e89 = ((u64)8UL);
+	goto L_abort_2e147;
+	L__2e163:;
+	t__2e164 = (u64)(u32)(*(i32 *)t__2e157);
+	t__2e156 = (u64)(u32)(((u32)t__2e164 == (u32)((u64)3UL)));
+	if ((u32)t__2e156) goto L_passed_2e155; else goto L_failed_2e154;
+	L_failed_2e154:;
+	t_abortsite_2e89 = ((u64)9UL);
+	goto L_abort_2e90;
+	L_passed_2e155:;
+	*(u64 *)t_binding_2e165 = (u64)((u64)((char *)&F_not));
+	*(u64 *)t_binding_2e166 = (u64)t_binding_2e165;
+	t__2e170 = (u64)(u32)(((u32 (*)(u32))((u64)((char *)&F_not)))((u32)((u64)1UL)));
+	t__2e171 = (u64)(u32)((u8)t__2e170);
+	t__2e172 = (u64)(u32)((u8)((u64)0UL));
+	t__2e169 = (u64)(u32)(((u32)t__2e171 == (u32)t__2e172));
+	if ((u32)t__2e169) goto L_passed_2e168; else goto L_failed_2e167;
+	L_failed_2e167:;
+	t_abortsite_2e89 = ((u64)10UL);
+	goto L_abort_2e90;
+	L_passed_2e168:;
+	t__2e176 = (u64)(*(u64 *)t_binding_2e165);
+	t__2e177 = (u64)(u32)(((u32 (*)(u32))t__2e176)((u32)((u64)1UL)));
+	t__2e178 = (u64)(u32)((u8)t__2e177);
+	t__2e179 = (u64)(u32)((u8)((u64)0UL));
+	t__2e175 = (u64)(u32)(((u32)t__2e178 == (u32)t__2e179));
+	if ((u32)t__2e175) goto L_passed_2e174; else goto L_failed_2e173;
+	L_failed_2e173:;
+	t_abortsite_2e89 = ((u64)11UL);
+	goto L_abort_2e90;
+	L_passed_2e174:;
+	t__2e183 = (u64)(*(u64 *)t_binding_2e166);
+	t__2e184 = (u64)(*(u64 *)t__2e183);
+	t__2e185 = (u64)(u32)(((u32 (*)(u32))t__2e184)((u32)((u64)1UL)));
+	t__2e186 = (u64)(u32)((u8)t__2e185);
+	t__2e187 = (u64)(u32)((u8)((u64)0UL));
+	t__2e182 = (u64)(u32)(((u32)t__2e186 == (u32)t__2e187));
+	if ((u32)t__2e182) goto L_passed_2e181; else goto L_failed_2e180;
+	L_failed_2e180:;
+	t_abortsite_2e89 = ((u64)12UL);
+	goto L_abort_2e90;
+	L_passed_2e181:;
+	goto L__2e77;
+	L__2e188:;
+	L__2e77:;
+	return;
+	L_abort_2e90:;
+	t__2e91 = (u64)((u64)t_abortsite_2e89 * (u64)((u64)16UL));
+	t__2e91 = (u64)((u64)((u64)((char *)&D_abortsites_2e88)) + (u64)t__2e91);
+	t__2e92 = (u64)(*(u64 *)t__2e91);
+	t__2e93 = (u64)((u64)t__2e91 + (u64)((u64)8UL));
+	t__2e94 = (u64)(*(u32 *)t__2e93);
+	t__2e93 = (u64)((u64)t__2e91 + (u64)((u64)12UL));
+	t__2e95 = (u64)(*(u32 *)t__2e93);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e92, (u64)t__2e94, (u64)t__2e95, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e147:;
+	t__2e148 = (u64)((u64)t_abortsite_2e89 * (u64)((u64)16UL));
+	t__2e148 = (u64)((u64)((u64)((char *)&D_abortsites_2e88)) + (u64)t__2e148);
+	t__2e149 = (u64)(*(u64 *)t__2e148);
+	t__2e150 = (u64)((u64)t__2e148 + (u64)((u64)8UL));
+	t__2e151 = (u64)(*(u32 *)t__2e150);
+	t__2e150 = (u64)((u64)t__2e148 + (u64)((u64)12UL));
+	t__2e152 = (u64)(*(u32 *)t__2e150);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e149, (u64)t__2e151, (u64)t__2e152, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static u32 F_not(u32 p_x) {
+	char A0[1] __attribute__((aligned(16)));
+	u64 t__2e192;
+	u64 t__2e193;
+	u64 t__2e194;
+	u64 t__2e195;
+	u64 t_param_2e190;
+	u64 t_x;
+	t_x = (u64)p_x;
+	L_start_2e189:;
+	t_param_2e190 = (u64)A0;
+	*(u8 *)t_param_2e190 = (u8)t_x;
+	L_body_2e191:;
+	t__2e193 = (u64)(u32)(*(u8 *)t_param_2e190);
+	t__2e194 = (u64)(u32)((u8)t__2e193);
+	t__2e195 = (u64)(u32)((u8)((u64)0UL));
+	t__2e192 = (u64)(u32)(((u32)t__2e194 == (u32)t__2e195));
+	return (u32)t__2e192;
+}
+static void F_nonaccess(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[16] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	char A3[16] __attribute__((aligned(16)));
+	char A4[16] __attribute__((aligned(16)));
+	char B5[16] __attribute__((aligned(16)));
+	char R6[16] __attribute__((aligned(16)));
+	char B7[16] __attribute__((aligned(16)));
+	char R8[16] __attribute__((aligned(16)));
+	u64 t__2e204;
+	u64 t__2e205;
+	u64 t__2e209;
+	u64 t__2e213;
+	u64 t__2e214;
+	u64 t__2e215;
+	u64 t__2e216;
+	u64 t__2e217;
+	u64 t__2e220;
+	u64 t__2e221;
+	u64 t__2e223;
+	u64 t__2e226;
+	u64 t__2e230;
+	u64 t__2e233;
+	u64 t__2e237;
+	u64 t__2e240;
+	u64 t__2e243;
+	u64 t__2e244;
+	u64 t__2e245;
+	u64 t_abortsite_2e211;
+	u64 t_binding_2e200;
+	u64 t_field_2e201;
+	u64 t_field_2e207;
+	u64 t_field_2e208;
+	u64 t_field_2e222;
+	u64 t_field_2e228;
+	u64 t_field_2e229;
+	u64 t_field_2e235;
+	u64 t_field_2e236;
+	u64 t_item_2e242;
+	u64 t_object_2e206;
+	u64 t_object_2e227;
+	u64 t_object_2e234;
+	u64 t_object_2e241;
+	L_start_2e196:;
+	t_binding_2e200 = (u64)A0;
+	t_object_2e206 = (u64)A1;
+	t_object_2e227 = (u64)A2;
+	t_object_2e234 = (u64)A3;
+	t_object_2e241 = (u64)A4;
+	L_body_2e197:;
+	t_field_2e201 = (u64)((u64)t_binding_2e200 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e201 = (u64)((u64)10UL);
+	t_field_2e201 = (u64)((u64)t_binding_2e200 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e201 = (u64)((u64)20UL);
+	t_field_2e207 = (u64)((u64)t_object_2e206 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e207 = (u64)((u64)10UL);
+	t_field_2e207 = (u64)((u64)t_object_2e206 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e207 = (u64)((u64)20UL);
+	BLIT((u64)B5, t_object_2e206, 16);
+	t__2e205 = ((u64 (*)(u64, u64))((u64)((char *)&F_aggregate)))((u64)R6, (u64)B5);
+	t_field_2e208 = (u64)((u64)t__2e205 + (u64)((u64)0UL));
+	t__2e209 = (u64)(*(u64 *)t_field_2e208);
+	t__2e204 = (u64)(u32)(((u64)t__2e209 == (u64)((u64)10UL)));
+	if ((u32)t__2e204) goto L_passed_2e203; else goto L_failed_2e202;
+	L_failed_2e202:;
+	t_abortsite_2e211 = ((u64)0UL);
+	goto L_abort_2e212;
+	L_passed_2e203:;
+	BLIT((u64)B7, t_binding_2e200, 16);
+	t__2e221 = ((u64 (*)(u64, u64))((u64)((char *)&F_aggregate)))((u64)R8, (u64)B7);
+	t_field_2e222 = (u64)((u64)t__2e221 + (u64)((u64)8UL));
+	t__2e223 = (u64)(*(u64 *)t_field_2e222);
+	t__2e220 = (u64)(u32)(((u64)t__2e223 == (u64)((u64)20UL)));
+	if ((u32)t__2e220) goto L_passed_2e219; else goto L_failed_2e218;
+	L_failed_2e218:;
+	t_abortsite_2e211 = ((u64)1UL);
+	goto L_abort_2e212;
+	L_passed_2e219:;
+	t_field_2e228 = (u64)((u64)t_object_2e227 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e228 = (u64)((u64)10UL);
+	t_field_2e228 = (u64)((u64)t_object_2e227 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e228 = (u64)((u64)20UL);
+	t_field_2e229 = (u64)((u64)t_object_2e227 + (u64)((u64)0UL));
+	t__2e230 = (u64)(*(u64 *)t_field_2e229);
+	t__2e226 = (u64)(u32)(((u64)t__2e230 == (u64)((u64)10UL)));
+	if ((u32)t__2e226) goto L_passed_2e225; else goto L_failed_2e224;
+	L_failed_2e224:;
+	t_abortsite_2e211 = ((u64)2UL);
+	goto L_abort_2e212;
+	L_passed_2e225:;
+	t_field_2e235 = (u64)((u64)t_object_2e234 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e235 = (u64)((u64)10UL);
+	t_field_2e235 = (u64)((u64)t_object_2e234 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e235 = (u64)((u64)20UL);
+	t_field_2e236 = (u64)((u64)t_object_2e234 + (u64)((u64)8UL));
+	t__2e237 = (u64)(*(u64 *)t_field_2e236);
+	t__2e233 = (u64)(u32)(((u64)t__2e237 == (u64)((u64)20UL)));
+	if ((u32)t__2e233) goto L_passed_2e232; else goto L_failed_2e231;
+	L_failed_2e231:;
+	t_abortsite_2e211 = ((u64)3UL);
+	goto L_abort_2e212;
+	L_passed_2e232:;
+	t_item_2e242 = (u64)((u64)t_object_2e241 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e242 = (u32)((u64)1UL);
+	t_item_2e242 = (u64)((u64)t_object_2e241 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e242 = (u32)((u64)2UL);
+	t_item_2e242 = (u64)((u64)t_object_2e241 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e242 = (u32)((u64)3UL);
+	t_item_2e242 = (u64)((u64)t_object_2e241 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e242 = (u32)((u64)4UL);
+	t__2e244 = (u64)((i64)(i32)((u64)2UL));
+	t__2e243 = (u64)((u64)t__2e244 * (u64)((u64)4UL));
+	t__2e243 = (u64)((u64)t_object_2e241 + (u64)t__2e243);
+	t__2e245 = (u64)(u32)(*(i32 *)t__2e243);
+	t__2e240 = (u64)(u32)(((u32)t__2e245 == (u32)((u64)3UL)));
+	if ((u32)t__2e240) goto L_passed_2e239; else goto L_failed_2e238;
+	L_failed_2e238:;
+	t_abortsite_2e211 = ((u64)4UL);
+	goto L_abort_2e212;
+	L_passed_2e239:;
+	goto L__2e198;
+	L__2e246:;
+	L__2e198:;
+	return;
+	L_abort_2e212:;
+	t__2e213 = (u64)((u64)t_abortsite_2e211 * (u64)((u64)16UL));
+	t__2e213 = (u64)((u64)((u64)((char *)&D_abortsites_2e210)) + (u64)t__2e213);
+	t__2e214 = (u64)(*(u64 *)t__2e213);
+	t__2e215 = (u64)((u64)t__2e213 + (u64)((u64)8UL));
+	t__2e216 = (u64)(*(u32 *)t__2e215);
+	t__2e215 = (u64)((u64)t__2e213 + (u64)((u64)12UL));
+	t__2e217 = (u64)(*(u32 *)t__2e215);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e214, (u64)t__2e216, (u64)t__2e217, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_nested(void) {
+	char A0[24] __attribute__((aligned(16)));
+	char A1[16] __attribute__((aligned(16)));
+	char A2[64] __attribute__((aligned(16)));
+	u64 t__2e257;
+	u64 t__2e260;
+	u64 t__2e264;
+	u64 t__2e265;
+	u64 t__2e266;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e271;
+	u64 t__2e274;
+	u64 t__2e277;
+	u64 t__2e279;
+	u64 t__2e287;
+	u64 t__2e288;
+	u64 t__2e289;
+	u64 t__2e291;
+	u64 t__2e294;
+	u64 t__2e295;
+	u64 t__2e296;
+	u64 t__2e298;
+	u64 t__2e301;
+	u64 t__2e302;
+	u64 t__2e303;
+	u64 t__2e305;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t__2e312;
+	u64 t__2e315;
+	u64 t__2e316;
+	u64 t__2e317;
+	u64 t__2e319;
+	u64 t__2e322;
+	u64 t__2e323;
+	u64 t__2e324;
+	u64 t__2e326;
+	u64 t__2e329;
+	u64 t__2e330;
+	u64 t__2e331;
+	u64 t__2e333;
+	u64 t__2e336;
+	u64 t__2e337;
+	u64 t__2e338;
+	u64 t__2e340;
+	u64 t_abortsite_2e262;
+	u64 t_binding_2e251;
+	u64 t_binding_2e280;
+	u64 t_binding_2e282;
+	u64 t_field_2e253;
+	u64 t_field_2e254;
+	u64 t_field_2e258;
+	u64 t_field_2e259;
+	u64 t_field_2e272;
+	u64 t_field_2e273;
+	u64 t_field_2e278;
+	u64 t_field_2e281;
+	u64 t_field_2e290;
+	u64 t_field_2e297;
+	u64 t_field_2e304;
+	u64 t_field_2e311;
+	u64 t_field_2e318;
+	u64 t_field_2e325;
+	u64 t_field_2e332;
+	u64 t_field_2e339;
+	u64 t_item_2e284;
+	L_start_2e247:;
+	t_binding_2e251 = (u64)A0;
+	t_binding_2e280 = (u64)A1;
+	t_binding_2e282 = (u64)A2;
+	L_body_2e248:;
+	t_field_2e253 = (u64)((u64)t_binding_2e251 + (u64)((u64)0UL));
+	t_field_2e254 = (u64)((u64)t_field_2e253 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e254 = (u64)((u64)10UL);
+	t_field_2e254 = (u64)((u64)t_field_2e253 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e254 = (u64)((u64)20UL);
+	t_field_2e253 = (u64)((u64)t_binding_2e251 + (u64)((u64)16UL));
+	*(u64 *)t_field_2e253 = (u64)((u64)30UL);
+	t_field_2e258 = (u64)((u64)t_binding_2e251 + (u64)((u64)0UL));
+	t_field_2e259 = (u64)((u64)t_field_2e258 + (u64)((u64)0UL));
+	t__2e260 = (u64)(*(u64 *)t_field_2e259);
+	t__2e257 = (u64)(u32)(((u64)t__2e260 == (u64)((u64)10UL)));
+	if ((u32)t__2e257) goto L_passed_2e256; else goto L_failed_2e255;
+	L_failed_2e255:;
+	t_abortsite_2e262 = ((u64)0UL);
+	goto L_abort_2e263;
+	L_passed_2e256:;
+	t_field_2e272 = (u64)((u64)t_binding_2e251 + (u64)((u64)0UL));
+	t_field_2e273 = (u64)((u64)t_field_2e272 + (u64)((u64)8UL));
+	t__2e274 = (u64)(*(u64 *)t_field_2e273);
+	t__2e271 = (u64)(u32)(((u64)t__2e274 == (u64)((u64)20UL)));
+	if ((u32)t__2e271) goto L_passed_2e270; else goto L_failed_2e269;
+	L_failed_2e269:;
+	t_abortsite_2e262 = ((u64)1UL);
+	goto L_abort_2e263;
+	L_passed_2e270:;
+	t_field_2e278 = (u64)((u64)t_binding_2e251 + (u64)((u64)16UL));
+	t__2e279 = (u64)(*(u64 *)t_field_2e278);
+	t__2e277 = (u64)(u32)(((u64)t__2e279 == (u64)((u64)30UL)));
+	if ((u32)t__2e277) goto L_passed_2e276; else goto L_failed_2e275;
+	L_failed_2e275:;
+	t_abortsite_2e262 = ((u64)2UL);
+	goto L_abort_2e263;
+	L_passed_2e276:;
+	t_field_2e281 = (u64)((u64)t_binding_2e280 + (u64)((u64)0UL));
+	*(u64 *)t_field_2e281 = (u64)((u64)10UL);
+	t_field_2e281 = (u64)((u64)t_binding_2e280 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e281 = (u64)((u64)20UL);
+	t_item_2e284 = (u64)((u64)t_binding_2e282 + (u64)((u64)0UL));
+	BLIT(t_item_2e284, t_binding_2e280, ((u64)16UL));
+	t_item_2e284 = (u64)((u64)t_binding_2e282 + (u64)((u64)16UL));
+	BLIT(t_item_2e284, t_binding_2e280, ((u64)16UL));
+	t_item_2e284 = (u64)((u64)t_binding_2e282 + (u64)((u64)32UL));
+	BLIT(t_item_2e284, t_binding_2e280, ((u64)16UL));
+	t_item_2e284 = (u64)((u64)t_binding_2e282 + (u64)((u64)48UL));
+	BLIT(t_item_2e284, t_binding_2e280, ((u64)16UL));
+	t__2e289 = (u64)((i64)(i32)((u64)0UL));
+	t__2e288 = (u64)((u64)t__2e289 * (u64)((u64)16UL));
+	t__2e288 = (u64)((u64)t_binding_2e282 + (u64)t__2e288);
+	t_field_2e290 = (u64)((u64)t__2e288 + (u64)((u64)0UL));
+	t__2e291 = (u64)(*(u64 *)t_field_2e290);
+	t__2e287 = (u64)(u32)(((u64)t__2e291 == (u64)((u64)10UL)));
+	if ((u32)t__2e287) goto L_passed_2e286; else goto L_failed_2e285;
+	L_failed_2e285:;
+	t_abortsite_2e262 = ((u64)3UL);
+	goto L_abort_2e263;
+	L_passed_2e286:;
+	t__2e296 = (u64)((i64)(i32)((u64)0UL));
+	t__2e295 = (u64)((u64)t__2e296 * (u64)((u64)16UL));
+	t__2e295 = (u64)((u64)t_binding_2e282 + (u64)t__2e295);
+	t_field_2e297 = (u64)((u64)t__2e295 + (u64)((u64)8UL));
+	t__2e298 = (u64)(*(u64 *)t_field_2e297);
+	t__2e294 = (u64)(u32)(((u64)t__2e298 == (u64)((u64)20UL)));
+	if ((u32)t__2e294) goto L_passed_2e293; else goto L_failed_2e292;
+	L_failed_2e292:;
+	t_abortsite_2e262 = ((u64)4UL);
+	goto L_abort_2e263;
+	L_passed_2e293:;
+	t__2e303 = (u64)((i64)(i32)((u64)1UL));
+	t__2e302 = (u64)((u64)t__2e303 * (u64)((u64)16UL));
+	t__2e302 = (u64)((u64)t_binding_2e282 + (u64)t__2e302);
+	t_field_2e304 = (u64)((u64)t__2e302 + (u64)((u64)0UL));
+	t__2e305 = (u64)(*(u64 *)t_field_2e304);
+	t__2e301 = (u64)(u32)(((u64)t__2e305 == (u64)((u64)10UL)));
+	if ((u32)t__2e301) goto L_passed_2e300; else goto L_failed_2e299;
+	L_failed_2e299:;
+	t_abortsite_2e262 = ((u64)5UL);
+	goto L_abort_2e263;
+	L_passed_2e300:;
+	t__2e310 = (u64)((i64)(i32)((u64)1UL));
+	t__2e309 = (u64)((u64)t__2e310 * (u64)((u64)16UL));
+	t__2e309 = (u64)((u64)t_binding_2e282 + (u64)t__2e309);
+	t_field_2e311 = (u64)((u64)t__2e309 + (u64)((u64)8UL));
+	t__2e312 = (u64)(*(u64 *)t_field_2e311);
+	t__2e308 = (u64)(u32)(((u64)t__2e312 == (u64)((u64)20UL)));
+	if ((u32)t__2e308) goto L_passed_2e307; else goto L_failed_2e306;
+	L_failed_2e306:;
+	t_abortsite_2e262 = ((u64)6UL);
+	goto L_abort_2e263;
+	L_passed_2e307:;
+	t__2e317 = (u64)((i64)(i32)((u64)2UL));
+	t__2e316 = (u64)((u64)t__2e317 * (u64)((u64)16UL));
+	t__2e316 = (u64)((u64)t_binding_2e282 + (u64)t__2e316);
+	t_field_2e318 = (u64)((u64)t__2e316 + (u64)((u64)0UL));
+	t__2e319 = (u64)(*(u64 *)t_field_2e318);
+	t__2e315 = (u64)(u32)(((u64)t__2e319 == (u64)((u64)10UL)));
+	if ((u32)t__2e315) goto L_passed_2e314; else goto L_failed_2e313;
+	L_failed_2e313:;
+	t_abortsite_2e262 = ((u64)7UL);
+	goto L_abort_2e263;
+	L_passed_2e314:;
+	t__2e324 = (u64)((i64)(i32)((u64)2UL));
+	t__2e323 = (u64)((u64)t__2e324 * (u64)((u64)16UL));
+	t__2e323 = (u64)((u64)t_binding_2e282 + (u64)t__2e323);
+	t_field_2e325 = (u64)((u64)t__2e323 + (u64)((u64)8UL));
+	t__2e326 = (u64)(*(u64 *)t_field_2e325);
+	t__2e322 = (u64)(u32)(((u64)t__2e326 == (u64)((u64)20UL)));
+	if ((u32)t__2e322) goto L_passed_2e321; else goto L_failed_2e320;
+	L_failed_2e320:;
+	t_abortsite_2e262 = ((u64)8UL);
+	goto L_abort_2e263;
+	L_passed_2e321:;
+	t__2e331 = (u64)((i64)(i32)((u64)3UL));
+	t__2e330 = (u64)((u64)t__2e331 * (u64)((u64)16UL));
+	t__2e330 = (u64)((u64)t_binding_2e282 + (u64)t__2e330);
+	t_field_2e332 = (u64)((u64)t__2e330 + (u64)((u64)0UL));
+	t__2e333 = (u64)(*(u64 *)t_field_2e332);
+	t__2e329 = (u64)(u32)(((u64)t__2e333 == (u64)((u64)10UL)));
+	if ((u32)t__2e329) goto L_passed_2e328; else goto L_failed_2e327;
+	L_failed_2e327:;
+	t_abortsite_2e262 = ((u64)9UL);
+	goto L_abort_2e263;
+	L_passed_2e328:;
+	t__2e338 = (u64)((i64)(i32)((u64)3UL));
+	t__2e337 = (u64)((u64)t__2e338 * (u64)((u64)16UL));
+	t__2e337 = (u64)((u64)t_binding_2e282 + (u64)t__2e337);
+	t_field_2e339 = (u64)((u64)t__2e337 + (u64)((u64)8UL));
+	t__2e340 = (u64)(*(u64 *)t_field_2e339);
+	t__2e336 = (u64)(u32)(((u64)t__2e340 == (u64)((u64)20UL)));
+	if ((u32)t__2e336) goto L_passed_2e335; else goto L_failed_2e334;
+	L_failed_2e334:;
+	t_abortsite_2e262 = ((u64)10UL);
+	goto L_abort_2e263;
+	L_passed_2e335:;
+	goto L__2e249;
+	L__2e341:;
+	L__2e249:;
+	return;
+	L_abort_2e263:;
+	t__2e264 = (u64)((u64)t_abortsite_2e262 * (u64)((u64)16UL));
+	t__2e264 = (u64)((u64)((u64)((char *)&D_abortsites_2e261)) + (u64)t__2e264);
+	t__2e265 = (u64)(*(u64 *)t__2e264);
+	t__2e266 = (u64)((u64)t__2e264 + (u64)((u64)8UL));
+	t__2e267 = (u64)(*(u32 *)t__2e266);
+	t__2e266 = (u64)((u64)t__2e264 + (u64)((u64)12UL));
+	t__2e268 = (u64)(*(u32 *)t__2e266);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e265, (u64)t__2e267, (u64)t__2e268, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,476 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ememset[] __asm__("rt.memset");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e156 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e157 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e13 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e156 D_strdata_2e156 __asm__("strdata.156") __attribute__((used, section(".rodata.strdata.156"), aligned(8)));
+static struct S_strliteral_2e157 D_strliteral_2e157 __asm__("strliteral.157") __attribute__((used, section(".data.rel.ro.strliteral.157"), aligned(8)));
+static struct S_abortsites_2e13 D_abortsites_2e13 __asm__("abortsites.13") __attribute__((used, section(".data.rel.ro.abortsites.13"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\063\062\055\143\157\160\171\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 16U, 16U };
+static const struct S_strdata_2e156 D_strdata_2e156 = { "\150\145\154\154\157\040\167\157\162\154\144" };
+static struct S_strliteral_2e157 D_strliteral_2e157 = { (char *)((char *)&D_strdata_2e156) + 0, 11U, 11U };
+static struct S_abortsites_2e13 D_abortsites_2e13 = { (char *)((char *)&D_strliteral_2e1) + 0, 8U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 17U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 20U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 21U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 22U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 23U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 29U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 30U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 37U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 42U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 43U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 44U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 58U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 59U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 15U };
+void F_main(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[16] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[16] __attribute__((aligned(16)));
+	char A5[16] __attribute__((aligned(16)));
+	char A6[16] __attribute__((aligned(16)));
+	char A7[16] __attribute__((aligned(16)));
+	char A8[16] __attribute__((aligned(16)));
+	char A9[16] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[24] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[8] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e102;
+	u64 t__2e104;
+	u64 t__2e107;
+	u64 t__2e109;
+	u64 t__2e11;
+	u64 t__2e111;
+	u64 t__2e118;
+	u64 t__2e12;
+	u64 t__2e121;
+	u64 t__2e123;
+	u64 t__2e125;
+	u64 t__2e126;
+	u64 t__2e127;
+	u64 t__2e134;
+	u64 t__2e136;
+	u64 t__2e138;
+	u64 t__2e141;
+	u64 t__2e143;
+	u64 t__2e145;
+	u64 t__2e148;
+	u64 t__2e150;
+	u64 t__2e152;
+	u64 t__2e153;
+	u64 t__2e154;
+	u64 t__2e16;
+	u64 t__2e164;
+	u64 t__2e165;
+	u64 t__2e168;
+	u64 t__2e169;
+	u64 t__2e17;
+	u64 t__2e171;
+	u64 t__2e174;
+	u64 t__2e175;
+	u64 t__2e177;
+	u64 t__2e178;
+	u64 t__2e18;
+	u64 t__2e180;
+	u64 t__2e183;
+	u64 t__2e184;
+	u64 t__2e186;
+	u64 t__2e187;
+	u64 t__2e189;
+	u64 t__2e19;
+	u64 t__2e20;
+	u64 t__2e27;
+	u64 t__2e28;
+	u64 t__2e29;
+	u64 t__2e30;
+	u64 t__2e34;
+	u64 t__2e35;
+	u64 t__2e36;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e39;
+	u64 t__2e45;
+	u64 t__2e48;
+	u64 t__2e49;
+	u64 t__2e50;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e54;
+	u64 t__2e57;
+	u64 t__2e58;
+	u64 t__2e59;
+	u64 t__2e60;
+	u64 t__2e61;
+	u64 t__2e62;
+	u64 t__2e63;
+	u64 t__2e66;
+	u64 t__2e67;
+	u64 t__2e68;
+	u64 t__2e69;
+	u64 t__2e70;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t__2e75;
+	u64 t__2e76;
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e8;
+	u64 t__2e80;
+	u64 t__2e81;
+	u64 t__2e88;
+	u64 t__2e91;
+	u64 t__2e93;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e97;
+	u64 t_abortsite_2e14;
+	u64 t_binding_2e112;
+	u64 t_binding_2e115;
+	u64 t_binding_2e128;
+	u64 t_binding_2e131;
+	u64 t_binding_2e155;
+	u64 t_binding_2e159;
+	u64 t_binding_2e160;
+	u64 t_binding_2e161;
+	u64 t_binding_2e21;
+	u64 t_binding_2e24;
+	u64 t_binding_2e40;
+	u64 t_binding_2e42;
+	u64 t_binding_2e6;
+	u64 t_binding_2e7;
+	u64 t_binding_2e82;
+	u64 t_binding_2e85;
+	u64 t_field_2e101;
+	u64 t_field_2e103;
+	u64 t_field_2e108;
+	u64 t_field_2e110;
+	u64 t_field_2e114;
+	u64 t_field_2e122;
+	u64 t_field_2e124;
+	u64 t_field_2e167;
+	u64 t_field_2e170;
+	u64 t_field_2e176;
+	u64 t_field_2e179;
+	u64 t_field_2e185;
+	u64 t_field_2e188;
+	u64 t_field_2e84;
+	u64 t_field_2e92;
+	u64 t_field_2e94;
+	u64 t_item_2e23;
+	u64 t_item_2e41;
+	u64 t_value_2e130;
+	u64 t_value_2e135;
+	u64 t_value_2e137;
+	u64 t_value_2e142;
+	u64 t_value_2e144;
+	u64 t_value_2e149;
+	u64 t_value_2e151;
+	L_start_2e2:;
+	t_binding_2e6 = (u64)A0;
+	t_binding_2e7 = (u64)A1;
+	t_binding_2e21 = (u64)A2;
+	t_binding_2e24 = (u64)A3;
+	t_binding_2e40 = (u64)A4;
+	t_binding_2e42 = (u64)A5;
+	t_binding_2e82 = (u64)A6;
+	t_binding_2e85 = (u64)A7;
+	t_binding_2e112 = (u64)A8;
+	t_binding_2e115 = (u64)A9;
+	t_binding_2e128 = (u64)A10;
+	t_binding_2e131 = (u64)A11;
+	t_binding_2e155 = (u64)A12;
+	t_binding_2e159 = (u64)A13;
+	t_binding_2e160 = (u64)A14;
+	t_binding_2e161 = (u64)A15;
+	L_body_2e3:;
+	*(u32 *)t_binding_2e6 = (u32)((u64)10UL);
+	t__2e8 = (u64)(u32)(*(i32 *)t_binding_2e6);
+	*(u32 *)t_binding_2e7 = (u32)t__2e8;
+	t__2e12 = (u64)(u32)(*(i32 *)t_binding_2e7);
+	t__2e11 = (u64)(u32)(((u32)t__2e12 == (u32)((u64)10UL)));
+	if ((u32)t__2e11) goto L_passed_2e10; else goto L_failed_2e9;
+	L_failed_2e9:;
+	t_abortsite_2e14 = ((u64)0UL);
+	goto L_abort_2e15;
+	L_passed_2e10:;
+	t_item_2e23 = (u64)((u64)t_binding_2e21 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e23 = (u32)((u64)1UL);
+	t_item_2e23 = (u64)((u64)t_binding_2e21 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e23 = (u32)((u64)2UL);
+	t_item_2e23 = (u64)((u64)t_binding_2e21 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e23 = (u32)((u64)3UL);
+	t_item_2e23 = (u64)((u64)t_binding_2e21 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e23 = (u32)((u64)4UL);
+	*(u64 *)t_binding_2e24 = (u64)((u64)2UL);
+	t__2e29 = (u64)(*(u64 *)t_binding_2e24);
+	t__2e28 = (u64)((u64)t__2e29 * (u64)((u64)4UL));
+	t__2e28 = (u64)((u64)t_binding_2e21 + (u64)t__2e28);
+	t__2e30 = (u64)(u32)(((u64)t__2e29 < (u64)((u64)4UL)));
+	if ((u32)t__2e30) goto L__2e32; else goto L__2e31;
+	L__2e31:;
+	t_abortsite_2e14 = ((u64)1UL);
+	goto L_abort_2e33;
+	L__2e32:;
+	t__2e39 = (u64)(u32)(*(i32 *)t__2e28);
+	t__2e27 = (u64)(u32)(((u32)t__2e39 == (u32)((u64)3UL)));
+	if ((u32)t__2e27) goto L_passed_2e26; else goto L_failed_2e25;
+	L_failed_2e25:;
+	t_abortsite_2e14 = ((u64)2UL);
+	goto L_abort_2e15;
+	L_passed_2e26:;
+	t_item_2e41 = (u64)((u64)t_binding_2e40 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e41 = (u32)((u64)1UL);
+	t_item_2e41 = (u64)((u64)t_binding_2e40 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e41 = (u32)((u64)2UL);
+	t_item_2e41 = (u64)((u64)t_binding_2e40 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e41 = (u32)((u64)3UL);
+	t_item_2e41 = (u64)((u64)t_binding_2e40 + (u64)((u64)12UL));
+	*(u32 *)t_item_2e41 = (u32)((u64)4UL);
+	BLIT(t_binding_2e42, t_binding_2e40, ((u64)16UL));
+	t__2e45 = (u64)(u32)(((u64)t_binding_2e40 != (u64)t_binding_2e42));
+	if ((u32)t__2e45) goto L_passed_2e44; else goto L_failed_2e43;
+	L_failed_2e43:;
+	t_abortsite_2e14 = ((u64)3UL);
+	goto L_abort_2e15;
+	L_passed_2e44:;
+	t__2e50 = (u64)((i64)(i32)((u64)0UL));
+	t__2e49 = (u64)((u64)t__2e50 * (u64)((u64)4UL));
+	t__2e49 = (u64)((u64)t_binding_2e40 + (u64)t__2e49);
+	t__2e51 = (u64)(u32)(*(i32 *)t__2e49);
+	t__2e53 = (u64)((i64)(i32)((u64)0UL));
+	t__2e52 = (u64)((u64)t__2e53 * (u64)((u64)4UL));
+	t__2e52 = (u64)((u64)t_binding_2e42 + (u64)t__2e52);
+	t__2e54 = (u64)(u32)(*(i32 *)t__2e52);
+	t__2e48 = (u64)(u32)(((u32)t__2e51 == (u32)t__2e54));
+	if ((u32)t__2e48) goto L_passed_2e47; else goto L_failed_2e46;
+	L_failed_2e46:;
+	t_abortsite_2e14 = ((u64)4UL);
+	goto L_abort_2e15;
+	L_passed_2e47:;
+	t__2e59 = (u64)((i64)(i32)((u64)1UL));
+	t__2e58 = (u64)((u64)t__2e59 * (u64)((u64)4UL));
+	t__2e58 = (u64)((u64)t_binding_2e40 + (u64)t__2e58);
+	t__2e60 = (u64)(u32)(*(i32 *)t__2e58);
+	t__2e62 = (u64)((i64)(i32)((u64)1UL));
+	t__2e61 = (u64)((u64)t__2e62 * (u64)((u64)4UL));
+	t__2e61 = (u64)((u64)t_binding_2e42 + (u64)t__2e61);
+	t__2e63 = (u64)(u32)(*(i32 *)t__2e61);
+	t__2e57 = (u64)(u32)(((u32)t__2e60 == (u32)t__2e63));
+	if ((u32)t__2e57) goto L_passed_2e56; else goto L_failed_2e55;
+	L_failed_2e55:;
+	t_abortsite_2e14 = ((u64)5UL);
+	goto L_abort_2e15;
+	L_passed_2e56:;
+	t__2e68 = (u64)((i64)(i32)((u64)2UL));
+	t__2e67 = (u64)((u64)t__2e68 * (u64)((u64)4UL));
+	t__2e67 = (u64)((u64)t_binding_2e40 + (u64)t__2e67);
+	t__2e69 = (u64)(u32)(*(i32 *)t__2e67);
+	t__2e71 = (u64)((i64)(i32)((u64)2UL));
+	t__2e70 = (u64)((u64)t__2e71 * (u64)((u64)4UL));
+	t__2e70 = (u64)((u64)t_binding_2e42 + (u64)t__2e70);
+	t__2e72 = (u64)(u32)(*(i32 *)t__2e70);
+	t__2e66 = (u64)(u32)(((u32)t__2e69 == (u32)t__2e72));
+	if ((u32)t__2e66) goto L_passed_2e65; else goto L_failed_2e64;
+	L_failed_2e64:;
+	t_abortsite_2e14 = ((u64)6UL);
+	goto L_abort_2e15;
+	L_passed_2e65:;
+	t__2e77 = (u64)((i64)(i32)((u64)3UL));
+	t__2e76 = (u64)((u64)t__2e77 * (u64)((u64)4UL));
+	t__2e76 = (u64)((u64)t_binding_2e40 + (u64)t__2e76);
+	t__2e78 = (u64)(u32)(*(i32 *)t__2e76);
+	t__2e80 = (u64)((i64)(i32)((u64)3UL));
+	t__2e79 = (u64)((u64)t__2e80 * (u64)((u64)4UL));
+	t__2e79 = (u64)((u64)t_binding_2e42 + (u64)t__2e79);
+	t__2e81 = (u64)(u32)(*(i32 *)t__2e79);
+	t__2e75 = (u64)(u32)(((u32)t__2e78 == (u32)t__2e81));
+	if ((u32)t__2e75) goto L_passed_2e74; else goto L_failed_2e73;
+	L_failed_2e73:;
+	t_abortsite_2e14 = ((u64)7UL);
+	goto L_abort_2e15;
+	L_passed_2e74:;
+	t_field_2e84 = (u64)((u64)t_binding_2e82 + (u64)((u64)0UL));
+	*(u8 *)t_field_2e84 = (u8)((u64)10UL);
+	t_field_2e84 = (u64)((u64)t_binding_2e82 + (u64)((u64)4UL));
+	*(u32 *)t_field_2e84 = (u32)((u64)20UL);
+	t_field_2e84 = (u64)((u64)t_binding_2e82 + (u64)((u64)8UL));
+	*(u64 *)t_field_2e84 = (u64)((u64)30UL);
+	BLIT(t_binding_2e85, t_binding_2e82, ((u64)16UL));
+	t__2e88 = (u64)(u32)(((u64)t_binding_2e82 != (u64)t_binding_2e85));
+	if ((u32)t__2e88) goto L_passed_2e87; else goto L_failed_2e86;
+	L_failed_2e86:;
+	t_abortsite_2e14 = ((u64)8UL);
+	goto L_abort_2e15;
+	L_passed_2e87:;
+	t_field_2e92 = (u64)((u64)t_binding_2e82 + (u64)((u64)0UL));
+	t__2e93 = (u64)(u32)(*(i8 *)t_field_2e92);
+	t_field_2e94 = (u64)((u64)t_binding_2e85 + (u64)((u64)0UL));
+	t__2e95 = (u64)(u32)(*(i8 *)t_field_2e94);
+	t__2e96 = (u64)(u32)((i64)(i8)t__2e93);
+	t__2e97 = (u64)(u32)((i64)(i8)t__2e95);
+	t__2e91 = (u64)(u32)(((u32)t__2e96 == (u32)t__2e97));
+	if ((u32)t__2e91) goto L_passed_2e90; else goto L_failed_2e89;
+	L_failed_2e89:;
+	t_abortsite_2e14 = ((u64)9UL);
+	goto L_abort_2e15;
+	L_passed_2e90:;
+	t_field_2e101 = (u64)((u64)t_binding_2e82 + (u64)((u64)4UL));
+	t__2e102 = (u64)(u32)(*(i32 *)t_field_2e101);
+	t_field_2e103 = (u64)((u64)t_binding_2e85 + (u64)((u64)4UL));
+	t__2e104 = (u64)(u32)(*(i32 *)t_field_2e103);
+	t__2e100 = (u64)(u32)(((u32)t__2e102 == (u32)t__2e104));
+	if ((u32)t__2e100) goto L_passed_2e99; else goto L_failed_2e98;
+	L_failed_2e98:;
+	t_abortsite_2e14 = ((u64)10UL);
+	goto L_abort_2e15;
+	L_passed_2e99:;
+	t_field_2e108 = (u64)((u64)t_binding_2e82 + (u64)((u64)8UL));
+	t__2e109 = (u64)(*(u64 *)t_field_2e108);
+	t_field_2e110 = (u64)((u64)t_binding_2e85 + (u64)((u64)8UL));
+	t__2e111 = (u64)(*(u64 *)t_field_2e110);
+	t__2e107 = (u64)(u32)(((u64)t__2e109 == (u64)t__2e111));
+	if ((u32)t__2e107) goto L_passed_2e106; else goto L_failed_2e105;
+	L_failed_2e105:;
+	t_abortsite_2e14 = ((u64)11UL);
+	goto L_abort_2e15;
+	L_passed_2e106:;
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememset))((u64)t_binding_2e112, (u64)((u64)0UL), (u64)((u64)16UL));
+	t_field_2e114 = (u64)((u64)t_binding_2e112 + (u64)((u64)2UL));
+	*(u16 *)t_field_2e114 = (u16)((u64)10UL);
+	BLIT(t_binding_2e115, t_binding_2e112, ((u64)16UL));
+	t__2e118 = (u64)(u32)(((u64)t_binding_2e112 != (u64)t_binding_2e115));
+	if ((u32)t__2e118) goto L_passed_2e117; else goto L_failed_2e116;
+	L_failed_2e116:;
+	t_abortsite_2e14 = ((u64)12UL);
+	goto L_abort_2e15;
+	L_passed_2e117:;
+	t_field_2e122 = (u64)((u64)t_binding_2e112 + (u64)((u64)2UL));
+	t__2e123 = (u64)(u32)(*(i16 *)t_field_2e122);
+	t_field_2e124 = (u64)((u64)t_binding_2e115 + (u64)((u64)2UL));
+	t__2e125 = (u64)(u32)(*(i16 *)t_field_2e124);
+	t__2e126 = (u64)(u32)((i64)(i16)t__2e123);
+	t__2e127 = (u64)(u32)((i64)(i16)t__2e125);
+	t__2e121 = (u64)(u32)(((u32)t__2e126 == (u32)t__2e127));
+	if ((u32)t__2e121) goto L_passed_2e120; else goto L_failed_2e119;
+	L_failed_2e119:;
+	t_abortsite_2e14 = ((u64)13UL);
+	goto L_abort_2e15;
+	L_passed_2e120:;
+	t_value_2e130 = (u64)((u64)t_binding_2e128 + (u64)((u64)0UL));
+	*(u32 *)t_value_2e130 = (u32)((u64)1UL);
+	t_value_2e130 = (u64)((u64)t_binding_2e128 + (u64)((u64)8UL));
+	*(u64 *)t_value_2e130 = (u64)((u64)2UL);
+	t_value_2e130 = (u64)((u64)t_binding_2e128 + (u64)((u64)16UL));
+	*(u8 *)t_value_2e130 = (u8)((u64)3UL);
+	BLIT(t_binding_2e131, t_binding_2e128, ((u64)24UL));
+	t_value_2e135 = (u64)((u64)t_binding_2e128 + (u64)((u64)0UL));
+	t__2e136 = (u64)(u32)(*(i32 *)t_value_2e135);
+	t_value_2e137 = (u64)((u64)t_binding_2e131 + (u64)((u64)0UL));
+	t__2e138 = (u64)(u32)(*(i32 *)t_value_2e137);
+	t__2e134 = (u64)(u32)(((u32)t__2e136 == (u32)t__2e138));
+	if ((u32)t__2e134) goto L_passed_2e133; else goto L_failed_2e132;
+	L_failed_2e132:;
+	t_abortsite_2e14 = ((u64)14UL);
+	goto L_abort_2e15;
+	L_passed_2e133:;
+	t_value_2e142 = (u64)((u64)t_binding_2e128 + (u64)((u64)8UL));
+	t__2e143 = (u64)(*(u64 *)t_value_2e142);
+	t_value_2e144 = (u64)((u64)t_binding_2e131 + (u64)((u64)8UL));
+	t__2e145 = (u64)(*(u64 *)t_value_2e144);
+	t__2e141 = (u64)(u32)(((u64)t__2e143 == (u64)t__2e145));
+	if ((u32)t__2e141) goto L_passed_2e140; else goto L_failed_2e139;
+	L_failed_2e139:;
+	t_abortsite_2e14 = ((u64)15UL);
+	goto L_abort_2e15;
+	L_passed_2e140:;
+	t_value_2e149 = (u64)((u64)t_binding_2e128 + (u64)((u64)16UL));
+	t__2e150 = (u64)(u32)(*(u8 *)t_value_2e149);
+	t_value_2e151 = (u64)((u64)t_binding_2e131 + (u64)((u64)16UL));
+	t__2e152 = (u64)(u32)(*(u8 *)t_value_2e151);
+	t__2e153 = (u64)(u32)((u8)t__2e150);
+	t__2e154 = (u64)(u32)((u8)t__2e152);
+	t__2e148 = (u64)(u32)(((u32)t__2e153 == (u32)t__2e154));
+	if ((u32)t__2e148) goto L_passed_2e147; else goto L_failed_2e146;
+	L_failed_2e146:;
+	t_abortsite_2e14 = ((u64)16UL);
+	goto L_abort_2e15;
+	L_passed_2e147:;
+	BLIT(t_binding_2e155, ((u64)((char *)&D_strliteral_2e157)), ((u64)24UL));
+	BLIT(t_binding_2e159, t_binding_2e155, ((u64)24UL));
+	*(u64 *)t_binding_2e160 = (u64)t_binding_2e155;
+	*(u64 *)t_binding_2e161 = (u64)t_binding_2e159;
+	t__2e165 = (u64)(*(u64 *)t_binding_2e160);
+	t_field_2e167 = (u64)((u64)t__2e165 + (u64)((u64)8UL));
+	t__2e168 = (u64)(*(u64 *)t_field_2e167);
+	t__2e169 = (u64)(*(u64 *)t_binding_2e161);
+	t_field_2e170 = (u64)((u64)t__2e169 + (u64)((u64)8UL));
+	t__2e171 = (u64)(*(u64 *)t_field_2e170);
+	t__2e164 = (u64)(u32)(((u64)t__2e168 == (u64)t__2e171));
+	if ((u32)t__2e164) goto L_passed_2e163; else goto L_failed_2e162;
+	L_failed_2e162:;
+	t_abortsite_2e14 = ((u64)17UL);
+	goto L_abort_2e15;
+	L_passed_2e163:;
+	t__2e175 = (u64)(*(u64 *)t_binding_2e160);
+	t_field_2e176 = (u64)((u64)t__2e175 + (u64)((u64)16UL));
+	t__2e177 = (u64)(*(u64 *)t_field_2e176);
+	t__2e178 = (u64)(*(u64 *)t_binding_2e161);
+	t_field_2e179 = (u64)((u64)t__2e178 + (u64)((u64)16UL));
+	t__2e180 = (u64)(*(u64 *)t_field_2e179);
+	t__2e174 = (u64)(u32)(((u64)t__2e177 == (u64)t__2e180));
+	if ((u32)t__2e174) goto L_passed_2e173; else goto L_failed_2e172;
+	L_failed_2e172:;
+	t_abortsite_2e14 = ((u64)18UL);
+	goto L_abort_2e15;
+	L_passed_2e173:;
+	t__2e184 = (u64)(*(u64 *)t_binding_2e160);
+	t_field_2e185 = (u64)((u64)t__2e184 + (u64)((u64)0UL));
+	t__2e186 = (u64)(*(u64 *)t_field_2e185);
+	t__2e187 = (u64)(*(u64 *)t_binding_2e161);
+	t_field_2e188 = (u64)((u64)t__2e187 + (u64)((u64)0UL));
+	t__2e189 = (u64)(*(u64 *)t_field_2e188);
+	t__2e183 = (u64)(u32)(((u64)t__2e186 == (u64)t__2e189));
+	if ((u32)t__2e183) goto L_passed_2e182; else goto L_failed_2e181;
+	L_failed_2e181:;
+	t_abortsite_2e14 = ((u64)19UL);
+	goto L_abort_2e15;
+	L_passed_2e182:;
+	goto L__2e4;
+	L__2e190:;
+	L__2e4:;
+	return;
+	L_abort_2e15:;
+	t__2e16 = (u64)((u64)t_abortsite_2e14 * (u64)((u64)16UL));
+	t__2e16 = (u64)((u64)((u64)((char *)&D_abortsites_2e13)) + (u64)t__2e16);
+	t__2e17 = (u64)(*(u64 *)t__2e16);
+	t__2e18 = (u64)((u64)t__2e16 + (u64)((u64)8UL));
+	t__2e19 = (u64)(*(u32 *)t__2e18);
+	t__2e18 = (u64)((u64)t__2e16 + (u64)((u64)12UL));
+	t__2e20 = (u64)(*(u32 *)t__2e18);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e17, (u64)t__2e19, (u64)t__2e20, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e33:;
+	t__2e34 = (u64)((u64)t_abortsite_2e14 * (u64)((u64)16UL));
+	t__2e34 = (u64)((u64)((u64)((char *)&D_abortsites_2e13)) + (u64)t__2e34);
+	t__2e35 = (u64)(*(u64 *)t__2e34);
+	t__2e36 = (u64)((u64)t__2e34 + (u64)((u64)8UL));
+	t__2e37 = (u64)(*(u32 *)t__2e36);
+	t__2e36 = (u64)((u64)t__2e34 + (u64)((u64)12UL));
+	t__2e38 = (u64)(*(u32 *)t__2e36);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e35, (u64)t__2e37, (u64)t__2e38, (u64)((u64)0UL));
+	__builtin_trap();
+}
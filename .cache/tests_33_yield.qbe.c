@@ -0,0 +1,413 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e33 { char *f0; u32 f1; u32 f2; };
+struct __attribute__((packed)) S_abortsites_2e64 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_strdata_2e128 { u8 f0[63]; };
+struct __attribute__((packed)) S_strliteral_2e129 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e111 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+struct __attribute__((packed)) S_abortsites_2e177 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e33 D_abortsites_2e33 __asm__("abortsites.33") __attribute__((used, section(".data.rel.ro.abortsites.33"), aligned(8)));
+static struct S_abortsites_2e64 D_abortsites_2e64 __asm__("abortsites.64") __attribute__((used, section(".data.rel.ro.abortsites.64"), aligned(8)));
+static const struct S_strdata_2e128 D_strdata_2e128 __asm__("strdata.128") __attribute__((used, section(".rodata.strdata.128"), aligned(8)));
+static struct S_strliteral_2e129 D_strliteral_2e129 __asm__("strliteral.129") __attribute__((used, section(".data.rel.ro.strliteral.129"), aligned(8)));
+static struct S_abortsites_2e111 D_abortsites_2e111 __asm__("abortsites.111") __attribute__((used, section(".data.rel.ro.abortsites.111"), aligned(8)));
+static struct S_abortsites_2e177 D_abortsites_2e177 __asm__("abortsites.177") __attribute__((used, section(".data.rel.ro.abortsites.177"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_shadowing(void) __asm__("shadowing") __attribute__((used, section(".text.shadowing")));
+static void F_cast__lowering(void) __asm__("cast_lowering") __attribute__((used, section(".text.cast_lowering")));
+static void F___never(void) __asm__("_never") __attribute__((used, section(".text._never")));
+static void F_basics(void) __asm__("basics") __attribute__((used, section(".text.basics")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\063\063\055\171\151\145\154\144\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 17U, 17U };
+static struct S_abortsites_2e33 D_abortsites_2e33 = { (char *)((char *)&D_strliteral_2e1) + 0, 55U, 15U };
+static struct S_abortsites_2e64 D_abortsites_2e64 = { (char *)((char *)&D_strliteral_2e1) + 0, 34U, 20U, (char *)((char *)&D_strliteral_2e1) + 0, 34U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 15U };
+static const struct S_strdata_2e128 D_strdata_2e128 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173\040\154\145\164\040\170\072\040\151\156\164\040\075\040\151\146\040\050\164\162\165\145\051\040\173\040\171\151\145\154\144\073\040\175\040\145\154\163\145\040\061\073\040\175\073" };
+static struct S_strliteral_2e129 D_strliteral_2e129 = { (char *)((char *)&D_strdata_2e128) + 0, 63U, 63U };
+static struct S_abortsites_2e111 D_abortsites_2e111 = { (char *)((char *)&D_strliteral_2e1) + 0, 22U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 11U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 11U };
+static struct S_abortsites_2e177 D_abortsites_2e177 = { (char *)((char *)&D_strliteral_2e1) + 0, 11U, 22U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 14U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_basics)))();
+	((void (*)(void))((u64)((char *)&F___never)))();
+	((void (*)(void))((u64)((char *)&F_cast__lowering)))();
+	((void (*)(void))((u64)((char *)&F_shadowing)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_shadowing(void) {
+	char A0[4] __attribute__((aligned(16)));
+	u64 t__2e25;
+	u64 t__2e27;
+	u64 t__2e31;
+	u64 t__2e32;
+	u64 t__2e36;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e39;
+	u64 t__2e40;
+	u64 t_abortsite_2e34;
+	u64 t_binding_2e11;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	L_body_2e8:;
+	*(u32 *)t_binding_2e11 = (u32)((u64)0UL);
+	L_loop_2e16:;
+	if ((u32)((u64)1UL)) goto L_body_2e17; else goto L__2e19;
+	L_body_2e17:;
+	goto L__2e19;
+	L__2e23:;
+	L__2e21:;
+	L__2e24:;
+	L_after_2e20:;
+	goto L_loop_2e16;
+	L__2e19:;
+	t__2e25 = (u64)(u32)(*(i32 *)t_binding_2e11);
+	t__2e25 = (u64)(u32)((u32)t__2e25 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e11 = (u32)t__2e25;
+	goto L__2e14;
+	L__2e26:;
+	L__2e14:;
+	t__2e27 = (u64)(u32)(*(i32 *)t_binding_2e11);
+	t__2e27 = (u64)(u32)((u32)t__2e27 + (u32)((u64)1UL));
+	*(u32 *)t_binding_2e11 = (u32)t__2e27;
+	goto L__2e12;
+	L__2e28:;
+	L__2e12:;
+	t__2e32 = (u64)(u32)(*(i32 *)t_binding_2e11);
+	t__2e31 = (u64)(u32)(((u32)t__2e32 == (u32)((u64)2UL)));
+	if ((u32)t__2e31) goto L_passed_2e30; else goto L_failed_2e29;
+	L_failed_2e29:;
+	t_abortsite_2e34 = ((u64)0UL);
+	goto L_abort_2e35;
+	L_passed_2e30:;
+	goto L__2e9;
+	L__2e41:;
+	L__2e9:;
+	return;
+	L_abort_2e35:;
+	t__2e36 = (u64)((u64)t_abortsite_2e34 * (u64)((u64)16UL));
+	t__2e36 = (u64)((u64)((u64)((char *)&D_abortsites_2e33)) + (u64)t__2e36);
+	t__2e37 = (u64)(*(u64 *)t__2e36);
+	t__2e38 = (u64)((u64)t__2e36 + (u64)((u64)8UL));
+	t__2e39 = (u64)(*(u32 *)t__2e38);
+	t__2e38 = (u64)((u64)t__2e36 + (u64)((u64)12UL));
+	t__2e40 = (u64)(*(u32 *)t__2e38);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e37, (u64)t__2e39, (u64)t__2e40, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_cast__lowering(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	u64 t__2e50;
+	u64 t__2e55;
+	u64 t__2e56;
+	u64 t__2e57;
+	u64 t__2e61;
+	u64 t__2e67;
+	u64 t__2e68;
+	u64 t__2e69;
+	u64 t__2e70;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t__2e74;
+	u64 t__2e75;
+	u64 t__2e76;
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e86;
+	u64 t__2e91;
+	u64 t__2e94;
+	u64 t_abortsite_2e65;
+	u64 t_binding_2e46;
+	u64 t_binding_2e79;
+	u64 t_subval_2e60;
+	u64 t_subval_2e93;
+	L_start_2e42:;
+	t_binding_2e46 = (u64)A0;
+	t_binding_2e79 = (u64)A1;
+	L_body_2e43:;
+	*(u32 *)t_binding_2e46 = (u32)((u64)1099590421UL);
+	t__2e50 = (u64)((u64)t_binding_2e46 + (u64)((u64)4UL));
+	*(u32 *)t__2e50 = (u32)((u64)10UL);
+	goto L__2e51;
+	L__2e52:;
+	L__2e51:;
+	t__2e56 = t_binding_2e46;
+	t__2e57 = (u64)(u32)(*(u32 *)t_binding_2e46);
+	t_subval_2e60 = t_binding_2e46;
+	t__2e61 = (u64)(u32)(((u32)t__2e57 == (u32)((u64)1099590421UL)));
+	if ((u32)t__2e61) goto L_subtype_2e63; else goto L_failed_2e59;
+	L_subtype_2e63:;
+	goto L_passed_2e58;
+	L_failed_2e59:;
+	t_abortsite_2e65 = ((u64)0UL);
+	goto L_abort_2e66;
+	L_passed_2e58:;
+	t__2e56 = (u64)((u64)t__2e56 + (u64)((u64)4UL));
+	t__2e72 = (u64)(u32)(*(i32 *)t__2e56);
+	t__2e55 = (u64)(u32)(((u32)t__2e72 == (u32)((u64)10UL)));
+	if ((u32)t__2e55) goto L_passed_2e54; else goto L_failed_2e53;
+	L_failed_2e53:;
+	t_abortsite_2e65 = ((u64)1UL);
+	goto L_abort_2e73;
+	L_passed_2e54:;
+	L_loop_2e81:;
+	if ((u32)((u64)0UL)) goto L_body_2e82; else goto L__2e84;
+	L_body_2e82:;
+	*(u32 *)t_binding_2e79 = (u32)((u64)1099590421UL);
+	t__2e86 = (u64)((u64)t_binding_2e79 + (u64)((u64)4UL));
+	*(u32 *)t__2e86 = (u32)((u64)10UL);
+	goto L__2e80;
+	L__2e87:;
+	L_after_2e85:;
+	goto L_loop_2e81;
+	L__2e84:;
+	*(u32 *)t_binding_2e79 = (u32)((u64)3012680272UL);
+	goto L__2e80;
+	L__2e88:;
+	L__2e80:;
+	t__2e91 = (u64)(u32)(*(u32 *)t_binding_2e79);
+	t_subval_2e93 = t_binding_2e79;
+	t__2e94 = (u64)(u32)(((u32)t__2e91 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e94) goto L_subtype_2e96; else goto L_passed_2e92;
+	L_subtype_2e96:;
+	goto L_passed_2e92;
+	L_passed_2e92:;
+	if ((u32)t__2e94) goto L_passed_2e90; else goto L_failed_2e89;
+	L_failed_2e89:;
+	t_abortsite_2e65 = ((u64)2UL);
+	goto L_abort_2e73;
+	L_passed_2e90:;
+	goto L__2e44;
+	L__2e97:;
+	L__2e44:;
+	return;
+	L_abort_2e66:;
+	t__2e67 = (u64)((u64)t_abortsite_2e65 * (u64)((u64)16UL));
+	t__2e67 = (u64)((u64)((u64)((char *)&D_abortsites_2e64)) + (u64)t__2e67);
+	t__2e68 = (u64)(*(u64 *)t__2e67);
+	t__2e69 = (u64)((u64)t__2e67 + (u64)((u64)8UL));
+	t__2e70 = (u64)(*(u32 *)t__2e69);
+	t__2e69 = (u64)((u64)t__2e67 + (u64)((u64)12UL));
+	t__2e71 = (u64)(*(u32 *)t__2e69);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e68, (u64)t__2e70, (u64)t__2e71, (u64)((u64)1UL));
+	__builtin_trap();
+	L_abort_2e73:;
+	t__2e74 = (u64)((u64)t_abortsite_2e65 * (u64)((u64)16UL));
+	t__2e74 = (u64)((u64)((u64)((char *)&D_abortsites_2e64)) + (u64)t__2e74);
+	t__2e75 = (u64)(*(u64 *)t__2e74);
+	t__2e76 = (u64)((u64)t__2e74 + (u64)((u64)8UL));
+	t__2e77 = (u64)(*(u32 *)t__2e76);
+	t__2e76 = (u64)((u64)t__2e74 + (u64)((u64)12UL));
+	t__2e78 = (u64)(*(u32 *)t__2e76);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e75, (u64)t__2e77, (u64)t__2e78, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F___never(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char B3[8] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char R6[4] __attribute__((aligned(16)));
+	u64 t__2e108;
+	u64 t__2e114;
+	u64 t__2e115;
+	u64 t__2e116;
+	u64 t__2e117;
+	u64 t__2e118;
+	u64 t__2e121;
+	u64 t__2e127;
+	u64 t__2e133;
+	u64 t__2e142;
+	u64 t__2e144;
+	u64 t__2e146;
+	u64 t__2e147;
+	u64 t__2e148;
+	u64 t__2e149;
+	u64 t__2e150;
+	u64 t__2e153;
+	u64 t__2e154;
+	u64 t__2e155;
+	u64 t__2e156;
+	u64 t__2e157;
+	u64 t_abortsite_2e112;
+	u64 t_binding_2e104;
+	u64 t_object_2e123;
+	u64 t_object_2e131;
+	u64 t_tag_2e134;
+	L_start_2e98:;
+	t_binding_2e104 = (u64)A0;
+	t_object_2e123 = (u64)A1;
+	t_object_2e131 = (u64)A2;
+	L_body_2e99:;
+	t__2e108 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e108) goto L_true_2e105; else goto L_false_2e106;
+	L_true_2e105:;
+	goto L__2e102;
+	L__2e110:;
+	L__2e109:;
+	L_false_2e106:;
+	*(u32 *)t_binding_2e104 = (u32)((u64)1UL);
+	L__2e107:;
+	t_abortsite_2e112 = ((u64)0UL);
+	goto L_abort_2e113;
+	L__2e119:;
+	L__2e102:;
+	*(u32 *)t_object_2e123 = (u32)((u64)3532310079UL);
+	t__2e127 = (u64)((u64)t_object_2e123 + (u64)((u64)4UL));
+	*(u32 *)t__2e127 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e131 = (u64)((u64)0UL);
+	t__2e133 = (u64)((u64)t_object_2e131 + (u64)((u64)8UL));
+	*(u64 *)t__2e133 = (u64)((u64)0UL);
+	t__2e133 = (u64)((u64)t__2e133 + (u64)((u64)8UL));
+	*(u64 *)t__2e133 = (u64)((u64)0UL);
+	BLIT((u64)B3, t_object_2e123, 8);
+	BLIT((u64)B4, ((u64)((char *)&D_strliteral_2e129)), 24);
+	BLIT((u64)B5, t_object_2e131, 24);
+	t__2e121 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R6, (u64)B3, (u64)B4, (u64)B5);
+	t_tag_2e134 = (u64)(*(u32 *)t__2e121);
+	t__2e142 = (u64)(u32)(((u32)t_tag_2e134 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e142) goto L_member_2e139; else goto L__2e141;
+	L__2e141:;
+	t__2e144 = (u64)(u32)(((u32)t_tag_2e134 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e144) goto L_member_2e140; else goto L__2e143;
+	L__2e143:;
+	goto L_matches_2e138;
+	L_member_2e139:;
+	goto L_matches_2e138;
+	L_member_2e140:;
+	goto L_matches_2e137;
+	L_matches_2e137:;
+	goto L__2e135;
+	L_matches_2e138:;
+	t_abortsite_2e112 = ((u64)1UL);
+	goto L_abort_2e145;
+	L__2e151:;
+	L__2e136:;
+	t_abortsite_2e112 = ((u64)2UL);
+	goto L_abort_2e152;
+	L__2e135:;
+	goto L__2e100;
+	L__2e158:;
+	L__2e100:;
+	return;
+	L_abort_2e113:;
+	t__2e114 = (u64)((u64)t_abortsite_2e112 * (u64)((u64)16UL));
+	t__2e114 = (u64)((u64)((u64)((char *)&D_abortsites_2e111)) + (u64)t__2e114);
+	t__2e115 = (u64)(*(u64 *)t__2e114);
+	t__2e116 = (u64)((u64)t__2e114 + (u64)((u64)8UL));
+	t__2e117 = (u64)(*(u32 *)t__2e116);
+	t__2e116 = (u64)((u64)t__2e114 + (u64)((u64)12UL));
+	t__2e118 = (u64)(*(u32 *)t__2e116);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e115, (u64)t__2e117, (u64)t__2e118, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e145:;
+	t__2e146 = (u64)((u64)t_abortsite_2e112 * (u64)((u64)16UL));
+	t__2e146 = (u64)((u64)((u64)((char *)&D_abortsites_2e111)) + (u64)t__2e146);
+	t__2e147 = (u64)(*(u64 *)t__2e146);
+	t__2e148 = (u64)((u64)t__2e146 + (u64)((u64)8UL));
+	t__2e149 = (u64)(*(u32 *)t__2e148);
+	t__2e148 = (u64)((u64)t__2e146 + (u64)((u64)12UL));
+	t__2e150 = (u64)(*(u32 *)t__2e148);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e147, (u64)t__2e149, (u64)t__2e150, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e152:;
+	t__2e153 = (u64)((u64)t_abortsite_2e112 * (u64)((u64)16UL));
+	t__2e153 = (u64)((u64)((u64)((char *)&D_abortsites_2e111)) + (u64)t__2e153);
+	t__2e154 = (u64)(*(u64 *)t__2e153);
+	t__2e155 = (u64)((u64)t__2e153 + (u64)((u64)8UL));
+	t__2e156 = (u64)(*(u32 *)t__2e155);
+	t__2e155 = (u64)((u64)t__2e153 + (u64)((u64)12UL));
+	t__2e157 = (u64)(*(u32 *)t__2e155);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e154, (u64)t__2e156, (u64)t__2e157, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_basics(void) {
+	char A0[4] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	u64 t__2e172;
+	u64 t__2e180;
+	u64 t__2e181;
+	u64 t__2e182;
+	u64 t__2e183;
+	u64 t__2e184;
+	u64 t__2e188;
+	u64 t__2e189;
+	u64 t__2e192;
+	u64 t__2e193;
+	u64 t_abortsite_2e178;
+	u64 t_binding_2e163;
+	u64 t_binding_2e166;
+	L_start_2e159:;
+	t_binding_2e163 = (u64)A0;
+	t_binding_2e166 = (u64)A1;
+	L_body_2e160:;
+	*(u32 *)t_binding_2e163 = (u32)((u64)10UL);
+	goto L__2e164;
+	L__2e165:;
+	L__2e164:;
+	t__2e172 = (u64)(u32)((u8)((u64)1UL));
+	if ((u32)t__2e172) goto L_true_2e169; else goto L_false_2e170;
+	L_true_2e169:;
+	*(u32 *)t_binding_2e166 = (u32)((u64)20UL);
+	goto L__2e167;
+	L__2e175:;
+	L__2e173:;
+	L__2e176:;
+	L_false_2e170:;
+	L__2e171:;
+	t_abortsite_2e178 = ((u64)0UL);
+	goto L_abort_2e179;
+	L__2e185:;
+	L__2e167:;
+	t__2e189 = (u64)(u32)(*(i32 *)t_binding_2e163);
+	t__2e188 = (u64)(u32)(((u32)t__2e189 == (u32)((u64)10UL)));
+	if ((u32)t__2e188) goto L_passed_2e187; else goto L_failed_2e186;
+	L_failed_2e186:;
+	t_abortsite_2e178 = ((u64)1UL);
+	goto L_abort_2e179;
+	L_passed_2e187:;
+	t__2e193 = (u64)(u32)(*(i32 *)t_binding_2e166);
+	t__2e192 = (u64)(u32)(((u32)t__2e193 == (u32)((u64)20UL)));
+	if ((u32)t__2e192) goto L_passed_2e191; else goto L_failed_2e190;
+	L_failed_2e190:;
+	t_abortsite_2e178 = ((u64)2UL);
+	goto L_abort_2e179;
+	L_passed_2e191:;
+	goto L__2e161;
+	L__2e194:;
+	L__2e161:;
+	return;
+	L_abort_2e179:;
+	t__2e180 = (u64)((u64)t_abortsite_2e178 * (u64)((u64)16UL));
+	t__2e180 = (u64)((u64)((u64)((char *)&D_abortsites_2e177)) + (u64)t__2e180);
+	t__2e181 = (u64)(*(u64 *)t__2e180);
+	t__2e182 = (u64)((u64)t__2e180 + (u64)((u64)8UL));
+	t__2e183 = (u64)(*(u32 *)t__2e182);
+	t__2e182 = (u64)((u64)t__2e180 + (u64)((u64)12UL));
+	t__2e184 = (u64)(*(u32 *)t__2e182);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e181, (u64)t__2e183, (u64)t__2e184, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,3331 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+extern char X_rt_2ememcpy[] __asm__("rt.memcpy");
+extern char X_rt_2ememmove[] __asm__("rt.memmove");
+extern char X_rt_2estrcmp[] __asm__("rt.strcmp");
+extern char X_rt_2etoutf8[] __asm__("rt.toutf8");
+extern char X_s__y[] __asm__("s_y");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[24]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_s__x { u32 f0; };
+struct __attribute__((packed)) S_strdata_2e20 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e21 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e22 { u8 f0[29]; };
+struct __attribute__((packed)) S_strliteral_2e23 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e24 { u8 f0[15]; u8 f1; u8 f2[4]; u8 f3; u8 f4[20]; };
+struct __attribute__((packed)) S_strliteral_2e25 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e26 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e27 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e28 { u8 f0[15]; u8 f1; u8 f2[7]; u8 f3; u8 f4[16]; };
+struct __attribute__((packed)) S_strliteral_2e29 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e30 { u8 f0[19]; u8 f1; u8 f2[7]; u8 f3; u8 f4[15]; };
+struct __attribute__((packed)) S_strliteral_2e31 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e32 { u8 f0[26]; };
+struct __attribute__((packed)) S_strliteral_2e33 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e88 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e89 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e90 { u8 f0[28]; };
+struct __attribute__((packed)) S_strliteral_2e91 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e92 { u8 f0[21]; };
+struct __attribute__((packed)) S_strliteral_2e93 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e94 { u8 f0[23]; };
+struct __attribute__((packed)) S_strliteral_2e95 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e96 { u8 f0[20]; };
+struct __attribute__((packed)) S_strliteral_2e97 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e98 { u8 f0[15]; u8 f1; u8 f2[4]; u8 f3; u8 f4[13]; };
+struct __attribute__((packed)) S_strliteral_2e99 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e100 { u8 f0[21]; };
+struct __attribute__((packed)) S_strliteral_2e101 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e102 { u8 f0[19]; u8 f1; u8 f2[4]; u8 f3; u8 f4[15]; };
+struct __attribute__((packed)) S_strliteral_2e103 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e104 { u8 f0[41]; };
+struct __attribute__((packed)) S_strliteral_2e105 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e146 { u8 f0[2]; u8 f1; };
+struct __attribute__((packed)) S_strliteral_2e147 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e148 { u8 f0; };
+struct __attribute__((packed)) S_strliteral_2e149 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e169 { u8 f0[15]; u8 f1; u8 f2[5]; u8 f3; u8 f4[16]; };
+struct __attribute__((packed)) S_strliteral_2e170 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e174 { u8 f0[5]; u8 f1; };
+struct __attribute__((packed)) S_strliteral_2e175 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e193 { u8 f0[15]; u8 f1; u8 f2[4]; u8 f3; u8 f4[16]; };
+struct __attribute__((packed)) S_strliteral_2e194 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e68 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; };
+struct __attribute__((packed)) S_strdata_2e242 { u8 f0; u8 f1; u8 f2[12]; u8 f3; u8 f4; u8 f5[18]; u8 f6; u8 f7; u8 f8; u8 f9[13]; u8 f10; u8 f11; u8 f12[2]; };
+struct __attribute__((packed)) S_strliteral_2e243 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e276 { u8 f0; u8 f1; u8 f2[12]; u8 f3; u8 f4; u8 f5[18]; u8 f6; u8 f7; u8 f8; u8 f9[4]; u8 f10; u8 f11; u8 f12[2]; };
+struct __attribute__((packed)) S_strliteral_2e277 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e257 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; };
+struct __attribute__((packed)) S_strdata_2e324 { u8 f0[23]; };
+struct __attribute__((packed)) S_strliteral_2e325 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e326 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e327 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e328 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e329 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e330 { u8 f0[27]; };
+struct __attribute__((packed)) S_strliteral_2e331 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e332 { u8 f0[27]; };
+struct __attribute__((packed)) S_strliteral_2e333 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e334 { u8 f0[31]; };
+struct __attribute__((packed)) S_strliteral_2e335 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e336 { u8 f0[39]; };
+struct __attribute__((packed)) S_strliteral_2e337 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e338 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e339 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e340 { u8 f0[28]; };
+struct __attribute__((packed)) S_strliteral_2e341 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e342 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e343 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e344 { u8 f0[21]; };
+struct __attribute__((packed)) S_strliteral_2e345 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e346 { u8 f0[25]; };
+struct __attribute__((packed)) S_strliteral_2e347 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e348 { u8 f0[27]; };
+struct __attribute__((packed)) S_strliteral_2e349 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e350 { u8 f0[28]; };
+struct __attribute__((packed)) S_strliteral_2e351 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e352 { u8 f0[29]; };
+struct __attribute__((packed)) S_strliteral_2e353 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e354 { u8 f0[30]; };
+struct __attribute__((packed)) S_strliteral_2e355 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e356 { u8 f0[34]; };
+struct __attribute__((packed)) S_strliteral_2e357 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e358 { u8 f0[35]; };
+struct __attribute__((packed)) S_strliteral_2e359 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e360 { u8 f0[48]; };
+struct __attribute__((packed)) S_strliteral_2e361 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e362 { u8 f0[47]; };
+struct __attribute__((packed)) S_strliteral_2e363 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e364 { u8 f0[52]; };
+struct __attribute__((packed)) S_strliteral_2e365 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e366 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e367 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e368 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e369 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e370 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e371 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e372 { u8 f0[8]; u8 f1; u8 f2[3]; u8 f3; u8 f4[29]; };
+struct __attribute__((packed)) S_strliteral_2e373 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e374 { u8 f0[8]; u8 f1; u8 f2[3]; u8 f3; u8 f4[29]; };
+struct __attribute__((packed)) S_strliteral_2e375 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e376 { u8 f0[8]; u8 f1; u8 f2[3]; u8 f3; u8 f4[29]; };
+struct __attribute__((packed)) S_strliteral_2e377 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e378 { u8 f0[26]; };
+struct __attribute__((packed)) S_strliteral_2e379 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e380 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e381 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e431 { u8 f0[34]; };
+struct __attribute__((packed)) S_strliteral_2e432 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e433 { u8 f0[49]; };
+struct __attribute__((packed)) S_strliteral_2e434 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e435 { u8 f0[8]; u8 f1; u8 f2; u8 f3[14]; };
+struct __attribute__((packed)) S_strliteral_2e436 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e437 { u8 f0[8]; u8 f1; u8 f2[4]; u8 f3; u8 f4[14]; };
+struct __attribute__((packed)) S_strliteral_2e438 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e439 { u8 f0[8]; u8 f1; u8 f2; u8 f3[13]; };
+struct __attribute__((packed)) S_strliteral_2e440 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e441 { u8 f0[8]; u8 f1; u8 f2[4]; u8 f3; u8 f4[13]; };
+struct __attribute__((packed)) S_strliteral_2e442 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e480 { u8 f0[1]; };
+struct __attribute__((packed)) S_strliteral_2e481 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e482 { u8 f0[9]; };
+struct __attribute__((packed)) S_strliteral_2e483 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e485 { u8 f0[4]; };
+struct __attribute__((packed)) S_strliteral_2e486 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e487 { u8 f0[44]; };
+struct __attribute__((packed)) S_strliteral_2e488 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e490 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e491 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e492 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e493 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e495 { u8 f0[23]; };
+struct __attribute__((packed)) S_strliteral_2e496 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e497 { u8 f0[29]; };
+struct __attribute__((packed)) S_strliteral_2e498 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e500 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e501 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e502 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e503 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e505 { u8 f0[11]; };
+struct __attribute__((packed)) S_strliteral_2e506 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e507 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e508 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e510 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e511 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e512 { u8 f0[27]; };
+struct __attribute__((packed)) S_strliteral_2e513 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e515 { u8 f0[22]; };
+struct __attribute__((packed)) S_strliteral_2e516 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e517 { u8 f0[28]; };
+struct __attribute__((packed)) S_strliteral_2e518 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e520 { u8 f0[24]; };
+struct __attribute__((packed)) S_strliteral_2e521 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e522 { u8 f0[30]; };
+struct __attribute__((packed)) S_strliteral_2e523 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e525 { u8 f0[9]; };
+struct __attribute__((packed)) S_strliteral_2e526 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e528 { u8 f0[8]; };
+struct __attribute__((packed)) S_strliteral_2e529 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e530 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e531 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e537 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e538 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e539 { u8 f0[1]; };
+struct __attribute__((packed)) S_strliteral_2e540 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strliteral_2e541 { u64 f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e543 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e544 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e545 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e546 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e548 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e549 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e550 { u8 f0[3]; };
+struct __attribute__((packed)) S_strliteral_2e551 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e553 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e554 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e556 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e557 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e559 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e560 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e562 { u8 f0[15]; };
+struct __attribute__((packed)) S_strliteral_2e563 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e621 { u8 f0[27]; u8 f1; };
+struct __attribute__((packed)) S_strliteral_2e622 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e760 { u8 f0[7]; };
+struct __attribute__((packed)) S_strliteral_2e761 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e801 { u8 f0[52]; };
+struct __attribute__((packed)) S_strliteral_2e802 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e821 { u8 f0[45]; };
+struct __attribute__((packed)) S_strliteral_2e822 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e411 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; };
+struct __attribute__((packed)) S_static_2e0 { u32 f0; };
+struct __attribute__((packed)) S_strdata_2e898 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4[15]; u8 f5; u8 f6; u8 f7; u8 f8[10]; u8 f9; u8 f10; u8 f11[2]; };
+struct __attribute__((packed)) S_strliteral_2e899 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e930 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4[15]; u8 f5; u8 f6; u8 f7; u8 f8[2]; u8 f9; u8 f10; u8 f11[2]; };
+struct __attribute__((packed)) S_strliteral_2e931 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e950 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4[10]; u8 f5; u8 f6; u8 f7; u8 f8[10]; u8 f9; u8 f10; u8 f11[2]; };
+struct __attribute__((packed)) S_strliteral_2e951 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e970 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4[10]; u8 f5; u8 f6; u8 f7; u8 f8[11]; u8 f9; u8 f10; u8 f11[2]; };
+struct __attribute__((packed)) S_strliteral_2e971 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e990 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4[17]; u8 f5; u8 f6; u8 f7; u8 f8[10]; u8 f9; u8 f10; u8 f11[2]; };
+struct __attribute__((packed)) S_strliteral_2e991 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1010 { u8 f0; u8 f1; u8 f2; u8 f3[11]; u8 f4; u8 f5; u8 f6; u8 f7[18]; u8 f8; u8 f9; u8 f10; u8 f11; u8 f12[25]; u8 f13; u8 f14; u8 f15; u8 f16; u8 f17[11]; u8 f18; u8 f19; u8 f20; u8 f21; u8 f22[23]; u8 f23; u8 f24; u8 f25; u8 f26[2]; u8 f27; u8 f28; };
+struct __attribute__((packed)) S_strliteral_2e1011 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1016 { u8 f0[8]; };
+struct __attribute__((packed)) S_strliteral_2e1017 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e1035 { u8 f0[18]; u8 f1; u8 f2; u8 f3; u8 f4[17]; u8 f5; u8 f6; u8 f7[2]; };
+struct __attribute__((packed)) S_strliteral_2e1036 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e858 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; };
+struct __attribute__((packed)) S_abortsites_2e1089 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+extern struct S_s__x D_s__x __asm__("s_x") __attribute__((used, section(".bss.s_x"), aligned(8)));
+static const struct S_strdata_2e20 D_strdata_2e20 __asm__("strdata.20") __attribute__((used, section(".rodata.strdata.20"), aligned(8)));
+static struct S_strliteral_2e21 D_strliteral_2e21 __asm__("strliteral.21") __attribute__((used, section(".data.rel.ro.strliteral.21"), aligned(8)));
+static const struct S_strdata_2e22 D_strdata_2e22 __asm__("strdata.22") __attribute__((used, section(".rodata.strdata.22"), aligned(8)));
+static struct S_strliteral_2e23 D_strliteral_2e23 __asm__("strliteral.23") __attribute__((used, section(".data.rel.ro.strliteral.23"), aligned(8)));
+static const struct S_strdata_2e24 D_strdata_2e24 __asm__("strdata.24") __attribute__((used, section(".rodata.strdata.24"), aligned(8)));
+static struct S_strliteral_2e25 D_strliteral_2e25 __asm__("strliteral.25") __attribute__((used, section(".data.rel.ro.strliteral.25"), aligned(8)));
+static const struct S_strdata_2e26 D_strdata_2e26 __asm__("strdata.26") __attribute__((used, section(".rodata.strdata.26"), aligned(8)));
+static struct S_strliteral_2e27 D_strliteral_2e27 __asm__("strliteral.27") __attribute__((used, section(".data.rel.ro.strliteral.27"), aligned(8)));
+static const struct S_strdata_2e28 D_strdata_2e28 __asm__("strdata.28") __attribute__((used, section(".rodata.strdata.28"), aligned(8)));
+static struct S_strliteral_2e29 D_strliteral_2e29 __asm__("strliteral.29") __attribute__((used, section(".data.rel.ro.strliteral.29"), aligned(8)));
+static const struct S_strdata_2e30 D_strdata_2e30 __asm__("strdata.30") __attribute__((used, section(".rodata.strdata.30"), aligned(8)));
+static struct S_strliteral_2e31 D_strliteral_2e31 __asm__("strliteral.31") __attribute__((used, section(".data.rel.ro.strliteral.31"), aligned(8)));
+static const struct S_strdata_2e32 D_strdata_2e32 __asm__("strdata.32") __attribute__((used, section(".rodata.strdata.32"), aligned(8)));
+static struct S_strliteral_2e33 D_strliteral_2e33 __asm__("strliteral.33") __attribute__((used, section(".data.rel.ro.strliteral.33"), aligned(8)));
+static const struct S_strdata_2e88 D_strdata_2e88 __asm__("strdata.88") __attribute__((used, section(".rodata.strdata.88"), aligned(8)));
+static struct S_strliteral_2e89 D_strliteral_2e89 __asm__("strliteral.89") __attribute__((used, section(".data.rel.ro.strliteral.89"), aligned(8)));
+static const struct S_strdata_2e90 D_strdata_2e90 __asm__("strdata.90") __attribute__((used, section(".rodata.strdata.90"), aligned(8)));
+static struct S_strliteral_2e91 D_strliteral_2e91 __asm__("strliteral.91") __attribute__((used, section(".data.rel.ro.strliteral.91"), aligned(8)));
+static const struct S_strdata_2e92 D_strdata_2e92 __asm__("strdata.92") __attribute__((used, section(".rodata.strdata.92"), aligned(8)));
+static struct S_strliteral_2e93 D_strliteral_2e93 __asm__("strliteral.93") __attribute__((used, section(".data.rel.ro.strliteral.93"), aligned(8)));
+static const struct S_strdata_2e94 D_strdata_2e94 __asm__("strdata.94") __attribute__((used, section(".rodata.strdata.94"), aligned(8)));
+static struct S_strliteral_2e95 D_strliteral_2e95 __asm__("strliteral.95") __attribute__((used, section(".data.rel.ro.strliteral.95"), aligned(8)));
+static const struct S_strdata_2e96 D_strdata_2e96 __asm__("strdata.96") __attribute__((used, section(".rodata.strdata.96"), aligned(8)));
+static struct S_strliteral_2e97 D_strliteral_2e97 __asm__("strliteral.97") __attribute__((used, section(".data.rel.ro.strliteral.97"), aligned(8)));
+static const struct S_strdata_2e98 D_strdata_2e98 __asm__("strdata.98") __attribute__((used, section(".rodata.strdata.98"), aligned(8)));
+static struct S_strliteral_2e99 D_strliteral_2e99 __asm__("strliteral.99") __attribute__((used, section(".data.rel.ro.strliteral.99"), aligned(8)));
+static const struct S_strdata_2e100 D_strdata_2e100 __asm__("strdata.100") __attribute__((used, section(".rodata.strdata.100"), aligned(8)));
+static struct S_strliteral_2e101 D_strliteral_2e101 __asm__("strliteral.101") __attribute__((used, section(".data.rel.ro.strliteral.101"), aligned(8)));
+static const struct S_strdata_2e102 D_strdata_2e102 __asm__("strdata.102") __attribute__((used, section(".rodata.strdata.102"), aligned(8)));
+static struct S_strliteral_2e103 D_strliteral_2e103 __asm__("strliteral.103") __attribute__((used, section(".data.rel.ro.strliteral.103"), aligned(8)));
+static const struct S_strdata_2e104 D_strdata_2e104 __asm__("strdata.104") __attribute__((used, section(".rodata.strdata.104"), aligned(8)));
+static struct S_strliteral_2e105 D_strliteral_2e105 __asm__("strliteral.105") __attribute__((used, section(".data.rel.ro.strliteral.105"), aligned(8)));
+static const struct S_strdata_2e146 D_strdata_2e146 __asm__("strdata.146") __attribute__((used, section(".rodata.strdata.146"), aligned(8)));
+static struct S_strliteral_2e147 D_strliteral_2e147 __asm__("strliteral.147") __attribute__((used, section(".data.rel.ro.strliteral.147"), aligned(8)));
+static const struct S_strdata_2e148 D_strdata_2e148 __asm__("strdata.148") __attribute__((used, section(".rodata.strdata.148"), aligned(8)));
+static struct S_strliteral_2e149 D_strliteral_2e149 __asm__("strliteral.149") __attribute__((used, section(".data.rel.ro.strliteral.149"), aligned(8)));
+static const struct S_strdata_2e169 D_strdata_2e169 __asm__("strdata.169") __attribute__((used, section(".rodata.strdata.169"), aligned(8)));
+static struct S_strliteral_2e170 D_strliteral_2e170 __asm__("strliteral.170") __attribute__((used, section(".data.rel.ro.strliteral.170"), aligned(8)));
+static const struct S_strdata_2e174 D_strdata_2e174 __asm__("strdata.174") __attribute__((used, section(".rodata.strdata.174"), aligned(8)));
+static struct S_strliteral_2e175 D_strliteral_2e175 __asm__("strliteral.175") __attribute__((used, section(".data.rel.ro.strliteral.175"), aligned(8)));
+static const struct S_strdata_2e193 D_strdata_2e193 __asm__("strdata.193") __attribute__((used, section(".rodata.strdata.193"), aligned(8)));
+static struct S_strliteral_2e194 D_strliteral_2e194 __asm__("strliteral.194") __attribute__((used, section(".data.rel.ro.strliteral.194"), aligned(8)));
+static struct S_abortsites_2e68 D_abortsites_2e68 __asm__("abortsites.68") __attribute__((used, section(".data.rel.ro.abortsites.68"), aligned(8)));
+static const struct S_strdata_2e242 D_strdata_2e242 __asm__("strdata.242") __attribute__((used, section(".rodata.strdata.242"), aligned(8)));
+static struct S_strliteral_2e243 D_strliteral_2e243 __asm__("strliteral.243") __attribute__((used, section(".data.rel.ro.strliteral.243"), aligned(8)));
+static const struct S_strdata_2e276 D_strdata_2e276 __asm__("strdata.276") __attribute__((used, section(".rodata.strdata.276"), aligned(8)));
+static struct S_strliteral_2e277 D_strliteral_2e277 __asm__("strliteral.277") __attribute__((used, section(".data.rel.ro.strliteral.277"), aligned(8)));
+static struct S_abortsites_2e257 D_abortsites_2e257 __asm__("abortsites.257") __attribute__((used, section(".data.rel.ro.abortsites.257"), aligned(8)));
+static const struct S_strdata_2e324 D_strdata_2e324 __asm__("strdata.324") __attribute__((used, section(".rodata.strdata.324"), aligned(8)));
+static struct S_strliteral_2e325 D_strliteral_2e325 __asm__("strliteral.325") __attribute__((used, section(".data.rel.ro.strliteral.325"), aligned(8)));
+static const struct S_strdata_2e326 D_strdata_2e326 __asm__("strdata.326") __attribute__((used, section(".rodata.strdata.326"), aligned(8)));
+static struct S_strliteral_2e327 D_strliteral_2e327 __asm__("strliteral.327") __attribute__((used, section(".data.rel.ro.strliteral.327"), aligned(8)));
+static const struct S_strdata_2e328 D_strdata_2e328 __asm__("strdata.328") __attribute__((used, section(".rodata.strdata.328"), aligned(8)));
+static struct S_strliteral_2e329 D_strliteral_2e329 __asm__("strliteral.329") __attribute__((used, section(".data.rel.ro.strliteral.329"), aligned(8)));
+static const struct S_strdata_2e330 D_strdata_2e330 __asm__("strdata.330") __attribute__((used, section(".rodata.strdata.330"), aligned(8)));
+static struct S_strliteral_2e331 D_strliteral_2e331 __asm__("strliteral.331") __attribute__((used, section(".data.rel.ro.strliteral.331"), aligned(8)));
+static const struct S_strdata_2e332 D_strdata_2e332 __asm__("strdata.332") __attribute__((used, section(".rodata.strdata.332"), aligned(8)));
+static struct S_strliteral_2e333 D_strliteral_2e333 __asm__("strliteral.333") __attribute__((used, section(".data.rel.ro.strliteral.333"), aligned(8)));
+static const struct S_strdata_2e334 D_strdata_2e334 __asm__("strdata.334") __attribute__((used, section(".rodata.strdata.334"), aligned(8)));
+static struct S_strliteral_2e335 D_strliteral_2e335 __asm__("strliteral.335") __attribute__((used, section(".data.rel.ro.strliteral.335"), aligned(8)));
+static const struct S_strdata_2e336 D_strdata_2e336 __asm__("strdata.336") __attribute__((used, section(".rodata.strdata.336"), aligned(8)));
+static struct S_strliteral_2e337 D_strliteral_2e337 __asm__("strliteral.337") __attribute__((used, section(".data.rel.ro.strliteral.337"), aligned(8)));
+static const struct S_strdata_2e338 D_strdata_2e338 __asm__("strdata.338") __attribute__((used, section(".rodata.strdata.338"), aligned(8)));
+static struct S_strliteral_2e339 D_strliteral_2e339 __asm__("strliteral.339") __attribute__((used, section(".data.rel.ro.strliteral.339"), aligned(8)));
+static const struct S_strdata_2e340 D_strdata_2e340 __asm__("strdata.340") __attribute__((used, section(".rodata.strdata.340"), aligned(8)));
+static struct S_strliteral_2e341 D_strliteral_2e341 __asm__("strliteral.341") __attribute__((used, section(".data.rel.ro.strliteral.341"), aligned(8)));
+static const struct S_strdata_2e342 D_strdata_2e342 __asm__("strdata.342") __attribute__((used, section(".rodata.strdata.342"), aligned(8)));
+static struct S_strliteral_2e343 D_strliteral_2e343 __asm__("strliteral.343") __attribute__((used, section(".data.rel.ro.strliteral.343"), aligned(8)));
+static const struct S_strdata_2e344 D_strdata_2e344 __asm__("strdata.344") __attribute__((used, section(".rodata.strdata.344"), aligned(8)));
+static struct S_strliteral_2e345 D_strliteral_2e345 __asm__("strliteral.345") __attribute__((used, section(".data.rel.ro.strliteral.345"), aligned(8)));
+static const struct S_strdata_2e346 D_strdata_2e346 __asm__("strdata.346") __attribute__((used, section(".rodata.strdata.346"), aligned(8)));
+static struct S_strliteral_2e347 D_strliteral_2e347 __asm__("strliteral.347") __attribute__((used, section(".data.rel.ro.strliteral.347"), aligned(8)));
+static const struct S_strdata_2e348 D_strdata_2e348 __asm__("strdata.348") __attribute__((used, section(".rodata.strdata.348"), aligned(8)));
+static struct S_strliteral_2e349 D_strliteral_2e349 __asm__("strliteral.349") __attribute__((used, section(".data.rel.ro.strliteral.349"), aligned(8)));
+static const struct S_strdata_2e350 D_strdata_2e350 __asm__("strdata.350") __attribute__((used, section(".rodata.strdata.350"), aligned(8)));
+static struct S_strliteral_2e351 D_strliteral_2e351 __asm__("strliteral.351") __attribute__((used, section(".data.rel.ro.strliteral.351"), aligned(8)));
+static const struct S_strdata_2e352 D_strdata_2e352 __asm__("strdata.352") __attribute__((used, section(".rodata.strdata.352"), aligned(8)));
+static struct S_strliteral_2e353 D_strliteral_2e353 __asm__("strliteral.353") __attribute__((used, section(".data.rel.ro.strliteral.353"), aligned(8)));
+static const struct S_strdata_2e354 D_strdata_2e354 __asm__("strdata.354") __attribute__((used, section(".rodata.strdata.354"), aligned(8)));
+static struct S_strliteral_2e355 D_strliteral_2e355 __asm__("strliteral.355") __attribute__((used, section(".data.rel.ro.strliteral.355"), aligned(8)));
+static const struct S_strdata_2e356 D_strdata_2e356 __asm__("strdata.356") __attribute__((used, section(".rodata.strdata.356"), aligned(8)));
+static struct S_strliteral_2e357 D_strliteral_2e357 __asm__("strliteral.357") __attribute__((used, section(".data.rel.ro.strliteral.357"), aligned(8)));
+static const struct S_strdata_2e358 D_strdata_2e358 __asm__("strdata.358") __attribute__((used, section(".rodata.strdata.358"), aligned(8)));
+static struct S_strliteral_2e359 D_strliteral_2e359 __asm__("strliteral.359") __attribute__((used, section(".data.rel.ro.strliteral.359"), aligned(8)));
+static const struct S_strdata_2e360 D_strdata_2e360 __asm__("strdata.360") __attribute__((used, section(".rodata.strdata.360"), aligned(8)));
+static struct S_strliteral_2e361 D_strliteral_2e361 __asm__("strliteral.361") __attribute__((used, section(".data.rel.ro.strliteral.361"), aligned(8)));
+static const struct S_strdata_2e362 D_strdata_2e362 __asm__("strdata.362") __attribute__((used, section(".rodata.strdata.362"), aligned(8)));
+static struct S_strliteral_2e363 D_strliteral_2e363 __asm__("strliteral.363") __attribute__((used, section(".data.rel.ro.strliteral.363"), aligned(8)));
+static const struct S_strdata_2e364 D_strdata_2e364 __asm__("strdata.364") __attribute__((used, section(".rodata.strdata.364"), aligned(8)));
+static struct S_strliteral_2e365 D_strliteral_2e365 __asm__("strliteral.365") __attribute__((used, section(".data.rel.ro.strliteral.365"), aligned(8)));
+static const struct S_strdata_2e366 D_strdata_2e366 __asm__("strdata.366") __attribute__((used, section(".rodata.strdata.366"), aligned(8)));
+static struct S_strliteral_2e367 D_strliteral_2e367 __asm__("strliteral.367") __attribute__((used, section(".data.rel.ro.strliteral.367"), aligned(8)));
+static const struct S_strdata_2e368 D_strdata_2e368 __asm__("strdata.368") __attribute__((used, section(".rodata.strdata.368"), aligned(8)));
+static struct S_strliteral_2e369 D_strliteral_2e369 __asm__("strliteral.369") __attribute__((used, section(".data.rel.ro.strliteral.369"), aligned(8)));
+static const struct S_strdata_2e370 D_strdata_2e370 __asm__("strdata.370") __attribute__((used, section(".rodata.strdata.370"), aligned(8)));
+static struct S_strliteral_2e371 D_strliteral_2e371 __asm__("strliteral.371") __attribute__((used, section(".data.rel.ro.strliteral.371"), aligned(8)));
+static const struct S_strdata_2e372 D_strdata_2e372 __asm__("strdata.372") __attribute__((used, section(".rodata.strdata.372"), aligned(8)));
+static struct S_strliteral_2e373 D_strliteral_2e373 __asm__("strliteral.373") __attribute__((used, section(".data.rel.ro.strliteral.373"), aligned(8)));
+static const struct S_strdata_2e374 D_strdata_2e374 __asm__("strdata.374") __attribute__((used, section(".rodata.strdata.374"), aligned(8)));
+static struct S_strliteral_2e375 D_strliteral_2e375 __asm__("strliteral.375") __attribute__((used, section(".data.rel.ro.strliteral.375"), aligned(8)));
+static const struct S_strdata_2e376 D_strdata_2e376 __asm__("strdata.376") __attribute__((used, section(".rodata.strdata.376"), aligned(8)));
+static struct S_strliteral_2e377 D_strliteral_2e377 __asm__("strliteral.377") __attribute__((used, section(".data.rel.ro.strliteral.377"), aligned(8)));
+static const struct S_strdata_2e378 D_strdata_2e378 __asm__("strdata.378") __attribute__((used, section(".rodata.strdata.378"), aligned(8)));
+static struct S_strliteral_2e379 D_strliteral_2e379 __asm__("strliteral.379") __attribute__((used, section(".data.rel.ro.strliteral.379"), aligned(8)));
+static const struct S_strdata_2e380 D_strdata_2e380 __asm__("strdata.380") __attribute__((used, section(".rodata.strdata.380"), aligned(8)));
+static struct S_strliteral_2e381 D_strliteral_2e381 __asm__("strliteral.381") __attribute__((used, section(".data.rel.ro.strliteral.381"), aligned(8)));
+static const struct S_strdata_2e431 D_strdata_2e431 __asm__("strdata.431") __attribute__((used, section(".rodata.strdata.431"), aligned(8)));
+static struct S_strliteral_2e432 D_strliteral_2e432 __asm__("strliteral.432") __attribute__((used, section(".data.rel.ro.strliteral.432"), aligned(8)));
+static const struct S_strdata_2e433 D_strdata_2e433 __asm__("strdata.433") __attribute__((used, section(".rodata.strdata.433"), aligned(8)));
+static struct S_strliteral_2e434 D_strliteral_2e434 __asm__("strliteral.434") __attribute__((used, section(".data.rel.ro.strliteral.434"), aligned(8)));
+static const struct S_strdata_2e435 D_strdata_2e435 __asm__("strdata.435") __attribute__((used, section(".rodata.strdata.435"), aligned(8)));
+static struct S_strliteral_2e436 D_strliteral_2e436 __asm__("strliteral.436") __attribute__((used, section(".data.rel.ro.strliteral.436"), aligned(8)));
+static const struct S_strdata_2e437 D_strdata_2e437 __asm__("strdata.437") __attribute__((used, section(".rodata.strdata.437"), aligned(8)));
+static struct S_strliteral_2e438 D_strliteral_2e438 __asm__("strliteral.438") __attribute__((used, section(".data.rel.ro.strliteral.438"), aligned(8)));
+static const struct S_strdata_2e439 D_strdata_2e439 __asm__("strdata.439") __attribute__((used, section(".rodata.strdata.439"), aligned(8)));
+static struct S_strliteral_2e440 D_strliteral_2e440 __asm__("strliteral.440") __attribute__((used, section(".data.rel.ro.strliteral.440"), aligned(8)));
+static const struct S_strdata_2e441 D_strdata_2e441 __asm__("strdata.441") __attribute__((used, section(".rodata.strdata.441"), aligned(8)));
+static struct S_strliteral_2e442 D_strliteral_2e442 __asm__("strliteral.442") __attribute__((used, section(".data.rel.ro.strliteral.442"), aligned(8)));
+static const struct S_strdata_2e480 D_strdata_2e480 __asm__("strdata.480") __attribute__((used, section(".rodata.strdata.480"), aligned(8)));
+static struct S_strliteral_2e481 D_strliteral_2e481 __asm__("strliteral.481") __attribute__((used, section(".data.rel.ro.strliteral.481"), aligned(8)));
+static const struct S_strdata_2e482 D_strdata_2e482 __asm__("strdata.482") __attribute__((used, section(".rodata.strdata.482"), aligned(8)));
+static struct S_strliteral_2e483 D_strliteral_2e483 __asm__("strliteral.483") __attribute__((used, section(".data.rel.ro.strliteral.483"), aligned(8)));
+static const struct S_strdata_2e485 D_strdata_2e485 __asm__("strdata.485") __attribute__((used, section(".rodata.strdata.485"), aligned(8)));
+static struct S_strliteral_2e486 D_strliteral_2e486 __asm__("strliteral.486") __attribute__((used, section(".data.rel.ro.strliteral.486"), aligned(8)));
+static const struct S_strdata_2e487 D_strdata_2e487 __asm__("strdata.487") __attribute__((used, section(".rodata.strdata.487"), aligned(8)));
+static struct S_strliteral_2e488 D_strliteral_2e488 __asm__("strliteral.488") __attribute__((used, section(".data.rel.ro.strliteral.488"), aligned(8)));
+static const struct S_strdata_2e490 D_strdata_2e490 __asm__("strdata.490") __attribute__((used, section(".rodata.strdata.490"), aligned(8)));
+static struct S_strliteral_2e491 D_strliteral_2e491 __asm__("strliteral.491") __attribute__((used, section(".data.rel.ro.strliteral.491"), aligned(8)));
+static const struct S_strdata_2e492 D_strdata_2e492 __asm__("strdata.492") __attribute__((used, section(".rodata.strdata.492"), aligned(8)));
+static struct S_strliteral_2e493 D_strliteral_2e493 __asm__("strliteral.493") __attribute__((used, section(".data.rel.ro.strliteral.493"), aligned(8)));
+static const struct S_strdata_2e495 D_strdata_2e495 __asm__("strdata.495") __attribute__((used, section(".rodata.strdata.495"), aligned(8)));
+static struct S_strliteral_2e496 D_strliteral_2e496 __asm__("strliteral.496") __attribute__((used, section(".data.rel.ro.strliteral.496"), aligned(8)));
+static const struct S_strdata_2e497 D_strdata_2e497 __asm__("strdata.497") __attribute__((used, section(".rodata.strdata.497"), aligned(8)));
+static struct S_strliteral_2e498 D_strliteral_2e498 __asm__("strliteral.498") __attribute__((used, section(".data.rel.ro.strliteral.498"), aligned(8)));
+static const struct S_strdata_2e500 D_strdata_2e500 __asm__("strdata.500") __attribute__((used, section(".rodata.strdata.500"), aligned(8)));
+static struct S_strliteral_2e501 D_strliteral_2e501 __asm__("strliteral.501") __attribute__((used, section(".data.rel.ro.strliteral.501"), aligned(8)));
+static const struct S_strdata_2e502 D_strdata_2e502 __asm__("strdata.502") __attribute__((used, section(".rodata.strdata.502"), aligned(8)));
+static struct S_strliteral_2e503 D_strliteral_2e503 __asm__("strliteral.503") __attribute__((used, section(".data.rel.ro.strliteral.503"), aligned(8)));
+static const struct S_strdata_2e505 D_strdata_2e505 __asm__("strdata.505") __attribute__((used, section(".rodata.strdata.505"), aligned(8)));
+static struct S_strliteral_2e506 D_strliteral_2e506 __asm__("strliteral.506") __attribute__((used, section(".data.rel.ro.strliteral.506"), aligned(8)));
+static const struct S_strdata_2e507 D_strdata_2e507 __asm__("strdata.507") __attribute__((used, section(".rodata.strdata.507"), aligned(8)));
+static struct S_strliteral_2e508 D_strliteral_2e508 __asm__("strliteral.508") __attribute__((used, section(".data.rel.ro.strliteral.508"), aligned(8)));
+static const struct S_strdata_2e510 D_strdata_2e510 __asm__("strdata.510") __attribute__((used, section(".rodata.strdata.510"), aligned(8)));
+static struct S_strliteral_2e511 D_strliteral_2e511 __asm__("strliteral.511") __attribute__((used, section(".data.rel.ro.strliteral.511"), aligned(8)));
+static const struct S_strdata_2e512 D_strdata_2e512 __asm__("strdata.512") __attribute__((used, section(".rodata.strdata.512"), aligned(8)));
+static struct S_strliteral_2e513 D_strliteral_2e513 __asm__("strliteral.513") __attribute__((used, section(".data.rel.ro.strliteral.513"), aligned(8)));
+static const struct S_strdata_2e515 D_strdata_2e515 __asm__("strdata.515") __attribute__((used, section(".rodata.strdata.515"), aligned(8)));
+static struct S_strliteral_2e516 D_strliteral_2e516 __asm__("strliteral.516") __attribute__((used, section(".data.rel.ro.strliteral.516"), aligned(8)));
+static const struct S_strdata_2e517 D_strdata_2e517 __asm__("strdata.517") __attribute__((used, section(".rodata.strdata.517"), aligned(8)));
+static struct S_strliteral_2e518 D_strliteral_2e518 __asm__("strliteral.518") __attribute__((used, section(".data.rel.ro.strliteral.518"), aligned(8)));
+static const struct S_strdata_2e520 D_strdata_2e520 __asm__("strdata.520") __attribute__((used, section(".rodata.strdata.520"), aligned(8)));
+static struct S_strliteral_2e521 D_strliteral_2e521 __asm__("strliteral.521") __attribute__((used, section(".data.rel.ro.strliteral.521"), aligned(8)));
+static const struct S_strdata_2e522 D_strdata_2e522 __asm__("strdata.522") __attribute__((used, section(".rodata.strdata.522"), aligned(8)));
+static struct S_strliteral_2e523 D_strliteral_2e523 __asm__("strliteral.523") __attribute__((used, section(".data.rel.ro.strliteral.523"), aligned(8)));
+static const struct S_strdata_2e525 D_strdata_2e525 __asm__("strdata.525") __attribute__((used, section(".rodata.strdata.525"), aligned(8)));
+static struct S_strliteral_2e526 D_strliteral_2e526 __asm__("strliteral.526") __attribute__((used, section(".data.rel.ro.strliteral.526"), aligned(8)));
+static const struct S_strdata_2e528 D_strdata_2e528 __asm__("strdata.528") __attribute__((used, section(".rodata.strdata.528"), aligned(8)));
+static struct S_strliteral_2e529 D_strliteral_2e529 __asm__("strliteral.529") __attribute__((used, section(".data.rel.ro.strliteral.529"), aligned(8)));
+static const struct S_strdata_2e530 D_strdata_2e530 __asm__("strdata.530") __attribute__((used, section(".rodata.strdata.530"), aligned(8)));
+static struct S_strliteral_2e531 D_strliteral_2e531 __asm__("strliteral.531") __attribute__((used, section(".data.rel.ro.strliteral.531"), aligned(8)));
+static const struct S_strdata_2e537 D_strdata_2e537 __asm__("strdata.537") __attribute__((used, section(".rodata.strdata.537"), aligned(8)));
+static struct S_strliteral_2e538 D_strliteral_2e538 __asm__("strliteral.538") __attribute__((used, section(".data.rel.ro.strliteral.538"), aligned(8)));
+static const struct S_strdata_2e539 D_strdata_2e539 __asm__("strdata.539") __attribute__((used, section(".rodata.strdata.539"), aligned(8)));
+static struct S_strliteral_2e540 D_strliteral_2e540 __asm__("strliteral.540") __attribute__((used, section(".data.rel.ro.strliteral.540"), aligned(8)));
+static const struct S_strliteral_2e541 D_strliteral_2e541 __asm__("strliteral.541") __attribute__((used, section(".rodata.strliteral.541"), aligned(8)));
+static const struct S_strdata_2e543 D_strdata_2e543 __asm__("strdata.543") __attribute__((used, section(".rodata.strdata.543"), aligned(8)));
+static struct S_strliteral_2e544 D_strliteral_2e544 __asm__("strliteral.544") __attribute__((used, section(".data.rel.ro.strliteral.544"), aligned(8)));
+static const struct S_strdata_2e545 D_strdata_2e545 __asm__("strdata.545") __attribute__((used, section(".rodata.strdata.545"), aligned(8)));
+static struct S_strliteral_2e546 D_strliteral_2e546 __asm__("strliteral.546") __attribute__((used, section(".data.rel.ro.strliteral.546"), aligned(8)));
+static const struct S_strdata_2e548 D_strdata_2e548 __asm__("strdata.548") __attribute__((used, section(".rodata.strdata.548"), aligned(8)));
+static struct S_strliteral_2e549 D_strliteral_2e549 __asm__("strliteral.549") __attribute__((used, section(".data.rel.ro.strliteral.549"), aligned(8)));
+static const struct S_strdata_2e550 D_strdata_2e550 __asm__("strdata.550") __attribute__((used, section(".rodata.strdata.550"), aligned(8)));
+static struct S_strliteral_2e551 D_strliteral_2e551 __asm__("strliteral.551") __attribute__((used, section(".data.rel.ro.strliteral.551"), aligned(8)));
+static const struct S_strdata_2e553 D_strdata_2e553 __asm__("strdata.553") __attribute__((used, section(".rodata.strdata.553"), aligned(8)));
+static struct S_strliteral_2e554 D_strliteral_2e554 __asm__("strliteral.554") __attribute__((used, section(".data.rel.ro.strliteral.554"), aligned(8)));
+static const struct S_strdata_2e556 D_strdata_2e556 __asm__("strdata.556") __attribute__((used, section(".rodata.strdata.556"), aligned(8)));
+static struct S_strliteral_2e557 D_strliteral_2e557 __asm__("strliteral.557") __attribute__((used, section(".data.rel.ro.strliteral.557"), aligned(8)));
+static const struct S_strdata_2e559 D_strdata_2e559 __asm__("strdata.559") __attribute__((used, section(".rodata.strdata.559"), aligned(8)));
+static struct S_strliteral_2e560 D_strliteral_2e560 __asm__("strliteral.560") __attribute__((used, section(".data.rel.ro.strliteral.560"), aligned(8)));
+static const struct S_strdata_2e562 D_strdata_2e562 __asm__("strdata.562") __attribute__((used, section(".rodata.strdata.562"), aligned(8)));
+static struct S_strliteral_2e563 D_strliteral_2e563 __asm__("strliteral.563") __attribute__((used, section(".data.rel.ro.strliteral.563"), aligned(8)));
+static const struct S_strdata_2e621 D_strdata_2e621 __asm__("strdata.621") __attribute__((used, section(".rodata.strdata.621"), aligned(8)));
+static struct S_strliteral_2e622 D_strliteral_2e622 __asm__("strliteral.622") __attribute__((used, section(".data.rel.ro.strliteral.622"), aligned(8)));
+static const struct S_strdata_2e760 D_strdata_2e760 __asm__("strdata.760") __attribute__((used, section(".rodata.strdata.760"), aligned(8)));
+static struct S_strliteral_2e761 D_strliteral_2e761 __asm__("strliteral.761") __attribute__((used, section(".data.rel.ro.strliteral.761"), aligned(8)));
+static const struct S_strdata_2e801 D_strdata_2e801 __asm__("strdata.801") __attribute__((used, section(".rodata.strdata.801"), aligned(8)));
+static struct S_strliteral_2e802 D_strliteral_2e802 __asm__("strliteral.802") __attribute__((used, section(".data.rel.ro.strliteral.802"), aligned(8)));
+static const struct S_strdata_2e821 D_strdata_2e821 __asm__("strdata.821") __attribute__((used, section(".rodata.strdata.821"), aligned(8)));
+static struct S_strliteral_2e822 D_strliteral_2e822 __asm__("strliteral.822") __attribute__((used, section(".data.rel.ro.strliteral.822"), aligned(8)));
+static struct S_abortsites_2e411 D_abortsites_2e411 __asm__("abortsites.411") __attribute__((used, section(".data.rel.ro.abortsites.411"), aligned(8)));
+static struct S_static_2e0 D_static_2e0 __asm__("static.0") __attribute__((used, section(".bss.static.0"), aligned(8)));
+static const struct S_strdata_2e898 D_strdata_2e898 __asm__("strdata.898") __attribute__((used, section(".rodata.strdata.898"), aligned(8)));
+static struct S_strliteral_2e899 D_strliteral_2e899 __asm__("strliteral.899") __attribute__((used, section(".data.rel.ro.strliteral.899"), aligned(8)));
+static const struct S_strdata_2e930 D_strdata_2e930 __asm__("strdata.930") __attribute__((used, section(".rodata.strdata.930"), aligned(8)));
+static struct S_strliteral_2e931 D_strliteral_2e931 __asm__("strliteral.931") __attribute__((used, section(".data.rel.ro.strliteral.931"), aligned(8)));
+static const struct S_strdata_2e950 D_strdata_2e950 __asm__("strdata.950") __attribute__((used, section(".rodata.strdata.950"), aligned(8)));
+static struct S_strliteral_2e951 D_strliteral_2e951 __asm__("strliteral.951") __attribute__((used, section(".data.rel.ro.strliteral.951"), aligned(8)));
+static const struct S_strdata_2e970 D_strdata_2e970 __asm__("strdata.970") __attribute__((used, section(".rodata.strdata.970"), aligned(8)));
+static struct S_strliteral_2e971 D_strliteral_2e971 __asm__("strliteral.971") __attribute__((used, section(".data.rel.ro.strliteral.971"), aligned(8)));
+static const struct S_strdata_2e990 D_strdata_2e990 __asm__("strdata.990") __attribute__((used, section(".rodata.strdata.990"), aligned(8)));
+static struct S_strliteral_2e991 D_strliteral_2e991 __asm__("strliteral.991") __attribute__((used, section(".data.rel.ro.strliteral.991"), aligned(8)));
+static const struct S_strdata_2e1010 D_strdata_2e1010 __asm__("strdata.1010") __attribute__((used, section(".rodata.strdata.1010"), aligned(8)));
+static struct S_strliteral_2e1011 D_strliteral_2e1011 __asm__("strliteral.1011") __attribute__((used, section(".data.rel.ro.strliteral.1011"), aligned(8)));
+static const struct S_strdata_2e1016 D_strdata_2e1016 __asm__("strdata.1016") __attribute__((used, section(".rodata.strdata.1016"), aligned(8)));
+static struct S_strliteral_2e1017 D_strliteral_2e1017 __asm__("strliteral.1017") __attribute__((used, section(".data.rel.ro.strliteral.1017"), aligned(8)));
+static const struct S_strdata_2e1035 D_strdata_2e1035 __asm__("strdata.1035") __attribute__((used, section(".rodata.strdata.1035"), aligned(8)));
+static struct S_strliteral_2e1036 D_strliteral_2e1036 __asm__("strliteral.1036") __attribute__((used, section(".data.rel.ro.strliteral.1036"), aligned(8)));
+static struct S_abortsites_2e858 D_abortsites_2e858 __asm__("abortsites.858") __attribute__((used, section(".data.rel.ro.abortsites.858"), aligned(8)));
+static struct S_abortsites_2e1089 D_abortsites_2e1089 __asm__("abortsites.1089") __attribute__((used, section(".data.rel.ro.abortsites.1089"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_complete__graph(void) __asm__("complete_graph") __attribute__((used, section(".text.complete_graph")));
+static void F_hosted__main(void) __asm__("hosted_main") __attribute__((used, section(".text.hosted_main")));
+static void F_imported(void) __asm__("imported") __attribute__((used, section(".text.imported")));
+static void F_reject(void) __asm__("reject") __attribute__((used, section(".text.reject")));
+static void F_sz(void) __asm__("sz") __attribute__((used, section(".text.sz")));
+static void F_local__constants(void) __asm__("local_constants") __attribute__((used, section(".text.local_constants")));
+static void F_constants(void) __asm__("constants") __attribute__((used, section(".text.constants")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\063\064\055\144\145\143\154\141\162\141\164\151\157\156\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 24U, 24U };
+struct S_s__x D_s__x = { 0U };
+static const struct S_strdata_2e20 D_strdata_2e20 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\073" };
+static struct S_strliteral_2e21 D_strliteral_2e21 = { (char *)((char *)&D_strdata_2e20) + 0, 22U, 22U };
+static const struct S_strdata_2e22 D_strdata_2e22 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e23 D_strliteral_2e23 = { (char *)((char *)&D_strdata_2e22) + 0, 29U, 29U };
+static const struct S_strdata_2e24 D_strdata_2e24 = { "\145\170\160\157\162\164\040\100\163\171\155\142\157\154\050", 34U, "\155\141\151\156", 34U, "\051\040\146\156\040\156\157\164\155\141\151\156\050\051\040\166\157\151\144\073" };
+static struct S_strliteral_2e25 D_strliteral_2e25 = { (char *)((char *)&D_strdata_2e24) + 0, 41U, 41U };
+static const struct S_strdata_2e26 D_strdata_2e26 = { "\146\156\040\155\141\151\156\050\051\040\166\157\151\144\073" };
+static struct S_strliteral_2e27 D_strliteral_2e27 = { (char *)((char *)&D_strdata_2e26) + 0, 15U, 15U };
+static const struct S_strdata_2e28 D_strdata_2e28 = { "\145\170\160\157\162\164\040\100\163\171\155\142\157\154\050", 34U, "\156\157\164\155\141\151\156", 34U, "\051\040\146\156\040\155\141\151\156\050\051\040\151\156\164\073" };
+static struct S_strliteral_2e29 D_strliteral_2e29 = { (char *)((char *)&D_strdata_2e28) + 0, 40U, 40U };
+static const struct S_strdata_2e30 D_strdata_2e30 = { "\145\170\160\157\162\164\040\154\145\164\040\100\163\171\155\142\157\154\050", 34U, "\156\157\164\155\141\151\156", 34U, "\051\040\156\157\164\155\141\151\156\072\040\151\156\164\073" };
+static struct S_strliteral_2e31 D_strliteral_2e31 = { (char *)((char *)&D_strdata_2e30) + 0, 43U, 43U };
+static const struct S_strdata_2e32 D_strdata_2e32 = { "\145\170\160\157\162\164\040\146\156\040\156\157\164\072\072\155\141\151\156\050\051\040\151\156\164\073" };
+static struct S_strliteral_2e33 D_strliteral_2e33 = { (char *)((char *)&D_strdata_2e32) + 0, 26U, 26U };
+static const struct S_strdata_2e88 D_strdata_2e88 = { "\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e89 D_strliteral_2e89 = { (char *)((char *)&D_strdata_2e88) + 0, 22U, 22U };
+static const struct S_strdata_2e90 D_strdata_2e90 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\170\072\040\151\156\164\051\040\166\157\151\144\073" };
+static struct S_strliteral_2e91 D_strliteral_2e91 = { (char *)((char *)&D_strdata_2e90) + 0, 28U, 28U };
+static const struct S_strdata_2e92 D_strdata_2e92 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\151\156\164\073" };
+static struct S_strliteral_2e93 D_strliteral_2e93 = { (char *)((char *)&D_strdata_2e92) + 0, 21U, 21U };
+static const struct S_strdata_2e94 D_strdata_2e94 = { "\145\170\160\157\162\164\040\164\171\160\145\040\155\141\151\156\040\075\040\151\156\164\073" };
+static struct S_strliteral_2e95 D_strliteral_2e95 = { (char *)((char *)&D_strdata_2e94) + 0, 23U, 23U };
+static const struct S_strdata_2e96 D_strdata_2e96 = { "\145\170\160\157\162\164\040\144\145\146\040\155\141\151\156\040\075\040\060\073" };
+static struct S_strliteral_2e97 D_strliteral_2e97 = { (char *)((char *)&D_strdata_2e96) + 0, 20U, 20U };
+static const struct S_strdata_2e98 D_strdata_2e98 = { "\145\170\160\157\162\164\040\100\163\171\155\142\157\154\050", 34U, "\155\141\151\156", 34U, "\051\040\146\156\040\146\050\051\040\151\156\164\073" };
+static struct S_strliteral_2e99 D_strliteral_2e99 = { (char *)((char *)&D_strdata_2e98) + 0, 34U, 34U };
+static const struct S_strdata_2e100 D_strdata_2e100 = { "\145\170\160\157\162\164\040\154\145\164\040\155\141\151\156\072\040\151\156\164\073" };
+static struct S_strliteral_2e101 D_strliteral_2e101 = { (char *)((char *)&D_strdata_2e100) + 0, 21U, 21U };
+static const struct S_strdata_2e102 D_strdata_2e102 = { "\145\170\160\157\162\164\040\154\145\164\040\100\163\171\155\142\157\154\050", 34U, "\155\141\151\156", 34U, "\051\040\156\157\164\155\141\151\156\072\040\151\156\164\073" };
+static struct S_strliteral_2e103 D_strliteral_2e103 = { (char *)((char *)&D_strdata_2e102) + 0, 40U, 40U };
+static const struct S_strdata_2e104 D_strdata_2e104 = { "\145\170\160\157\162\164\040\164\171\160\145\040\166\040\075\040\166\157\151\144\073\040\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\073" };
+static struct S_strliteral_2e105 D_strliteral_2e105 = { (char *)((char *)&D_strdata_2e104) + 0, 41U, 41U };
+static const struct S_strdata_2e146 D_strdata_2e146 = { "\055\155", 0U };
+static struct S_strliteral_2e147 D_strliteral_2e147 = { (char *)((char *)&D_strdata_2e146) + 0, 3U, 3U };
+static const struct S_strdata_2e148 D_strdata_2e148 = { 0U };
+static struct S_strliteral_2e149 D_strliteral_2e149 = { (char *)((char *)&D_strdata_2e148) + 0, 1U, 1U };
+static const struct S_strdata_2e169 D_strdata_2e169 = { "\145\170\160\157\162\164\040\100\163\171\155\142\157\154\050", 34U, "\056\155\141\151\156", 34U, "\051\040\146\156\040\155\141\151\156\050\051\040\151\156\164\073" };
+static struct S_strliteral_2e170 D_strliteral_2e170 = { (char *)((char *)&D_strdata_2e169) + 0, 38U, 38U };
+static const struct S_strdata_2e174 D_strdata_2e174 = { "\056\155\141\151\156", 0U };
+static struct S_strliteral_2e175 D_strliteral_2e175 = { (char *)((char *)&D_strdata_2e174) + 0, 6U, 6U };
+static const struct S_strdata_2e193 D_strdata_2e193 = { "\145\170\160\157\162\164\040\100\163\171\155\142\157\154\050", 34U, "\155\141\151\156", 34U, "\051\040\146\156\040\155\141\151\156\050\051\040\151\156\164\073" };
+static struct S_strliteral_2e194 D_strliteral_2e194 = { (char *)((char *)&D_strdata_2e193) + 0, 37U, 37U };
+static struct S_abortsites_2e68 D_abortsites_2e68 = { (char *)((char *)&D_strliteral_2e1) + 0, 368U, 51U, (char *)((char *)&D_strliteral_2e1) + 0, 368U, 51U, (char *)((char *)&D_strliteral_2e1) + 0, 384U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 384U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 385U, 69U, (char *)((char *)&D_strliteral_2e1) + 0, 385U, 69U, (char *)((char *)&D_strliteral_2e1) + 0, 389U, 36U, (char *)((char *)&D_strliteral_2e1) + 0, 389U, 36U, (char *)((char *)&D_strliteral_2e1) + 0, 391U, 36U, (char *)((char *)&D_strliteral_2e1) + 0, 391U, 36U, (char *)((char *)&D_strliteral_2e1) + 0, 393U, 36U, (char *)((char *)&D_strliteral_2e1) + 0, 393U, 36U };
+static const struct S_strdata_2e242 D_strdata_2e242 = { 10U, 9U, "\165\163\145\040\164\145\163\164\155\157\144\073", 10U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, "\164\145\163\164\155\157\144\072\072\163\137\170\073", 10U, 9U, "\175\073" };
+static struct S_strliteral_2e243 D_strliteral_2e243 = { (char *)((char *)&D_strdata_2e242) + 0, 54U, 54U };
+static const struct S_strdata_2e276 D_strdata_2e276 = { 10U, 9U, "\165\163\145\040\164\145\163\164\155\157\144\073", 10U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, "\163\137\170\073", 10U, 9U, "\175\073" };
+static struct S_strliteral_2e277 D_strliteral_2e277 = { (char *)((char *)&D_strdata_2e276) + 0, 45U, 45U };
+static struct S_abortsites_2e257 D_abortsites_2e257 = { (char *)((char *)&D_strliteral_2e1) + 0, 548U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 548U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 553U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 553U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 556U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 558U, 15U };
+static const struct S_strdata_2e324 D_strdata_2e324 = { "\164\171\160\145\040\141\040\075\040\142\073\040\164\171\160\145\040\142\040\075\040\141\073" };
+static struct S_strliteral_2e325 D_strliteral_2e325 = { (char *)((char *)&D_strdata_2e324) + 0, 23U, 23U };
+static const struct S_strdata_2e326 D_strdata_2e326 = { "\164\171\160\145\040\141\040\075\040\133\062\060\135\141\073" };
+static struct S_strliteral_2e327 D_strliteral_2e327 = { (char *)((char *)&D_strdata_2e326) + 0, 15U, 15U };
+static const struct S_strdata_2e328 D_strdata_2e328 = { "\164\171\160\145\040\141\040\075\040\165\156\153\156\157\167\156\073" };
+static struct S_strliteral_2e329 D_strliteral_2e329 = { (char *)((char *)&D_strdata_2e328) + 0, 17U, 17U };
+static const struct S_strdata_2e330 D_strdata_2e330 = { "\144\145\146\040\170\072\040\151\156\164\040\075\040\066\073\040\164\171\160\145\040\141\040\075\040\170\073" };
+static struct S_strliteral_2e331 D_strliteral_2e331 = { (char *)((char *)&D_strdata_2e330) + 0, 27U, 27U };
+static const struct S_strdata_2e332 D_strdata_2e332 = { "\164\171\160\145\040\141\040\075\040\151\156\164\073\040\164\171\160\145\040\141\040\075\040\163\164\162\073" };
+static struct S_strliteral_2e333 D_strliteral_2e333 = { (char *)((char *)&D_strdata_2e332) + 0, 27U, 27U };
+static const struct S_strdata_2e334 D_strdata_2e334 = { "\144\145\146\040\141\072\040\151\156\164\040\075\040\142\073\040\144\145\146\040\142\072\040\151\156\164\040\075\040\141\073" };
+static struct S_strliteral_2e335 D_strliteral_2e335 = { (char *)((char *)&D_strdata_2e334) + 0, 31U, 31U };
+static const struct S_strdata_2e336 D_strdata_2e336 = { "\144\145\146\040\170\072\040\163\151\172\145\040\075\040\163\151\172\145\050\164\051\073\040\164\171\160\145\040\164\040\075\040\133\170\135\151\156\164\073" };
+static struct S_strliteral_2e337 D_strliteral_2e337 = { (char *)((char *)&D_strdata_2e336) + 0, 39U, 39U };
+static const struct S_strdata_2e338 D_strdata_2e338 = { "\144\145\146\040\141\072\040\151\156\164\040\075\040\061\062\073\040\164\171\160\145\040\164\040\075\040\050\151\156\164\040\174\050\056\056\056\141\040\174\040\141\051\051\073" };
+static struct S_strliteral_2e339 D_strliteral_2e339 = { (char *)((char *)&D_strdata_2e338) + 0, 44U, 44U };
+static const struct S_strdata_2e340 D_strdata_2e340 = { "\164\171\160\145\040\141\040\075\040\050\056\056\056\165\156\153\156\157\167\156\040\174\040\151\156\164\051\073" };
+static struct S_strliteral_2e341 D_strliteral_2e341 = { (char *)((char *)&D_strdata_2e340) + 0, 28U, 28U };
+static const struct S_strdata_2e342 D_strdata_2e342 = { "\144\145\146\040\170\040\075\040\163\151\172\145\050\052\146\157\157\051\073" };
+static struct S_strliteral_2e343 D_strliteral_2e343 = { (char *)((char *)&D_strdata_2e342) + 0, 19U, 19U };
+static const struct S_strdata_2e344 D_strdata_2e344 = { "\144\145\146\040\170\040\075\040\163\151\172\145\050\052\156\145\166\145\162\051\073" };
+static struct S_strliteral_2e345 D_strliteral_2e345 = { (char *)((char *)&D_strdata_2e344) + 0, 21U, 21U };
+static const struct S_strdata_2e346 D_strdata_2e346 = { "\144\145\146\040\170\040\075\040\163\151\172\145\050\052\133\052\135\133\052\135\151\156\164\051\073" };
+static struct S_strliteral_2e347 D_strliteral_2e347 = { (char *)((char *)&D_strdata_2e346) + 0, 25U, 25U };
+static const struct S_strdata_2e348 D_strdata_2e348 = { "\154\145\164\040\141\072\040\151\156\164\040\075\040\064\073\040\164\171\160\145\040\170\040\075\040\141\073" };
+static struct S_strliteral_2e349 D_strliteral_2e349 = { (char *)((char *)&D_strdata_2e348) + 0, 27U, 27U };
+static const struct S_strdata_2e350 D_strdata_2e350 = { "\154\145\164\040\141\072\040\151\156\164\040\075\040\064\073\040\164\171\160\145\040\170\040\075\040\052\141\073" };
+static struct S_strliteral_2e351 D_strliteral_2e351 = { (char *)((char *)&D_strdata_2e350) + 0, 28U, 28U };
+static const struct S_strdata_2e352 D_strdata_2e352 = { "\154\145\164\040\141\072\040\151\156\164\040\075\040\064\073\040\164\171\160\145\040\170\040\075\040\133\135\141\073" };
+static struct S_strliteral_2e353 D_strliteral_2e353 = { (char *)((char *)&D_strdata_2e352) + 0, 29U, 29U };
+static const struct S_strdata_2e354 D_strdata_2e354 = { "\154\145\164\040\141\072\040\151\156\164\040\075\040\064\073\040\164\171\160\145\040\170\040\075\040\133\063\135\141\073" };
+static struct S_strliteral_2e355 D_strliteral_2e355 = { (char *)((char *)&D_strdata_2e354) + 0, 30U, 30U };
+static const struct S_strdata_2e356 D_strdata_2e356 = { "\154\145\164\040\141\072\040\151\156\164\040\075\040\064\073\040\164\171\160\145\040\170\040\075\040\050\163\164\162\054\040\141\051\073" };
+static struct S_strliteral_2e357 D_strliteral_2e357 = { (char *)((char *)&D_strdata_2e356) + 0, 34U, 34U };
+static const struct S_strdata_2e358 D_strdata_2e358 = { "\154\145\164\040\141\072\040\151\156\164\040\075\040\064\073\040\164\171\160\145\040\170\040\075\040\050\163\164\162\040\174\040\141\051\073" };
+static struct S_strliteral_2e359 D_strliteral_2e359 = { (char *)((char *)&D_strdata_2e358) + 0, 35U, 35U };
+static const struct S_strdata_2e360 D_strdata_2e360 = { "\154\145\164\040\141\072\040\151\156\164\040\075\040\064\073\040\164\171\160\145\040\170\040\075\040\163\164\162\165\143\164\040\173\040\171\072\040\163\164\162\054\040\172\072\040\141\175\073" };
+static struct S_strliteral_2e361 D_strliteral_2e361 = { (char *)((char *)&D_strdata_2e360) + 0, 48U, 48U };
+static const struct S_strdata_2e362 D_strdata_2e362 = { "\154\145\164\040\141\072\040\151\156\164\040\075\040\064\073\040\164\171\160\145\040\170\040\075\040\165\156\151\157\156\040\173\040\171\072\040\163\164\162\054\040\172\072\040\141\175\073" };
+static struct S_strliteral_2e363 D_strliteral_2e363 = { (char *)((char *)&D_strdata_2e362) + 0, 47U, 47U };
+static const struct S_strdata_2e364 D_strdata_2e364 = { "\154\145\164\040\141\072\040\151\156\164\040\075\040\064\073\040\146\156\040\170\050\171\072\040\163\164\162\054\040\172\072\040\141\051\040\166\157\151\144\040\075\040\173\040\166\157\151\144\073\040\175\073" };
+static struct S_strliteral_2e365 D_strliteral_2e365 = { (char *)((char *)&D_strdata_2e364) + 0, 52U, 52U };
+static const struct S_strdata_2e366 D_strdata_2e366 = { "\100\151\156\151\164\040\146\156\040\146\050\051\040\166\157\151\144\073" };
+static struct S_strliteral_2e367 D_strliteral_2e367 = { (char *)((char *)&D_strdata_2e366) + 0, 18U, 18U };
+static const struct S_strdata_2e368 D_strdata_2e368 = { "\100\146\151\156\151\040\146\156\040\146\050\051\040\166\157\151\144\073" };
+static struct S_strliteral_2e369 D_strliteral_2e369 = { (char *)((char *)&D_strdata_2e368) + 0, 18U, 18U };
+static const struct S_strdata_2e370 D_strdata_2e370 = { "\100\164\145\163\164\040\146\156\040\146\050\051\040\166\157\151\144\073" };
+static struct S_strliteral_2e371 D_strliteral_2e371 = { (char *)((char *)&D_strdata_2e370) + 0, 18U, 18U };
+static const struct S_strdata_2e372 D_strdata_2e372 = { "\100\163\171\155\142\157\154\050", 34U, "\146\157\157", 34U, "\051\040\100\151\156\151\164\040\146\156\040\146\157\157\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e373 D_strliteral_2e373 = { (char *)((char *)&D_strdata_2e372) + 0, 42U, 42U };
+static const struct S_strdata_2e374 D_strdata_2e374 = { "\100\163\171\155\142\157\154\050", 34U, "\146\157\157", 34U, "\051\040\100\146\151\156\151\040\146\156\040\146\157\157\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e375 D_strliteral_2e375 = { (char *)((char *)&D_strdata_2e374) + 0, 42U, 42U };
+static const struct S_strdata_2e376 D_strdata_2e376 = { "\100\163\171\155\142\157\154\050", 34U, "\146\157\157", 34U, "\051\040\100\164\145\163\164\040\146\156\040\146\157\157\050\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e377 D_strliteral_2e377 = { (char *)((char *)&D_strdata_2e376) + 0, 42U, 42U };
+static const struct S_strdata_2e378 D_strdata_2e378 = { "\154\145\164\040\141\072\040\133\052\135\151\156\164\040\075\040\133\061\054\040\062\054\040\063\135\073" };
+static struct S_strliteral_2e379 D_strliteral_2e379 = { (char *)((char *)&D_strdata_2e378) + 0, 26U, 26U };
+static const struct S_strdata_2e380 D_strdata_2e380 = { "\145\170\160\157\162\164\040\164\171\160\145\040\164\040\075\040\156\145\166\145\162\073" };
+static struct S_strliteral_2e381 D_strliteral_2e381 = { (char *)((char *)&D_strdata_2e380) + 0, 22U, 22U };
+static const struct S_strdata_2e431 D_strdata_2e431 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\154\145\164\040\141\040\075\040\064\073" };
+static struct S_strliteral_2e432 D_strliteral_2e432 = { (char *)((char *)&D_strdata_2e431) + 0, 34U, 34U };
+static const struct S_strdata_2e433 D_strdata_2e433 = { "\145\170\160\157\162\164\040\146\156\040\155\141\151\156\050\051\040\166\157\151\144\040\075\040\173\040\151\146\040\050\164\162\165\145\051\040\154\145\164\040\141\040\075\040\064\073\040\175\073" };
+static struct S_strliteral_2e434 D_strliteral_2e434 = { (char *)((char *)&D_strdata_2e433) + 0, 49U, 49U };
+static const struct S_strdata_2e435 D_strdata_2e435 = { "\100\163\171\155\142\157\154\050", 34U, 34U, "\051\040\146\156\040\146\050\051\040\166\157\151\144\073" };
+static struct S_strliteral_2e436 D_strliteral_2e436 = { (char *)((char *)&D_strdata_2e435) + 0, 24U, 24U };
+static const struct S_strdata_2e437 D_strdata_2e437 = { "\100\163\171\155\142\157\154\050", 34U, "\043\041\100\045", 34U, "\051\040\146\156\040\146\050\051\040\166\157\151\144\073" };
+static struct S_strliteral_2e438 D_strliteral_2e438 = { (char *)((char *)&D_strdata_2e437) + 0, 28U, 28U };
+static const struct S_strdata_2e439 D_strdata_2e439 = { "\100\163\171\155\142\157\154\050", 34U, 34U, "\051\040\154\145\164\040\170\072\040\151\156\164\073" };
+static struct S_strliteral_2e440 D_strliteral_2e440 = { (char *)((char *)&D_strdata_2e439) + 0, 23U, 23U };
+static const struct S_strdata_2e441 D_strdata_2e441 = { "\100\163\171\155\142\157\154\050", 34U, "\043\041\100\045", 34U, "\051\040\154\145\164\040\170\072\040\151\156\164\073" };
+static struct S_strliteral_2e442 D_strliteral_2e442 = { (char *)((char *)&D_strdata_2e441) + 0, 27U, 27U };
+static const struct S_strdata_2e480 D_strdata_2e480 = { "\141" };
+static struct S_strliteral_2e481 D_strliteral_2e481 = { (char *)((char *)&D_strdata_2e480) + 0, 1U, 1U };
+static const struct S_strdata_2e482 D_strdata_2e482 = { "\141\040\173\040\056\056\056\040\175" };
+static struct S_strliteral_2e483 D_strliteral_2e483 = { (char *)((char *)&D_strdata_2e482) + 0, 9U, 9U };
+static const struct S_strdata_2e485 D_strdata_2e485 = { "\133\064\135\141" };
+static struct S_strliteral_2e486 D_strliteral_2e486 = { (char *)((char *)&D_strdata_2e485) + 0, 4U, 4U };
+static const struct S_strdata_2e487 D_strdata_2e487 = { "\133\141\040\173\040\056\056\056\040\175\054\040\141\040\173\040\056\056\056\040\175\054\040\141\040\173\040\056\056\056\040\175\054\040\141\040\173\040\056\056\056\040\175\135" };
+static struct S_strliteral_2e488 D_strliteral_2e488 = { (char *)((char *)&D_strdata_2e487) + 0, 44U, 44U };
+static const struct S_strdata_2e490 D_strdata_2e490 = { "\133\135\141" };
+static struct S_strliteral_2e491 D_strliteral_2e491 = { (char *)((char *)&D_strdata_2e490) + 0, 3U, 3U };
+static const struct S_strdata_2e492 D_strdata_2e492 = { "\133\141\040\173\040\056\056\056\040\175\135\072\040\133\135\141" };
+static struct S_strliteral_2e493 D_strliteral_2e493 = { (char *)((char *)&D_strdata_2e492) + 0, 16U, 16U };
+static const struct S_strdata_2e495 D_strdata_2e495 = { "\156\165\154\154\141\142\154\145\040\052\146\156\050\170\072\040\141\051\040\166\157\151\144" };
+static struct S_strliteral_2e496 D_strliteral_2e496 = { (char *)((char *)&D_strdata_2e495) + 0, 23U, 23U };
+static const struct S_strdata_2e497 D_strdata_2e497 = { "\156\165\154\154\072\040\156\165\154\154\141\142\154\145\040\052\146\156\050\170\072\040\141\051\040\166\157\151\144" };
+static struct S_strliteral_2e498 D_strliteral_2e498 = { (char *)((char *)&D_strdata_2e497) + 0, 29U, 29U };
+static const struct S_strdata_2e500 D_strdata_2e500 = { "\156\165\154\154\141\142\154\145\040\052\146\156\050\051\040\141" };
+static struct S_strliteral_2e501 D_strliteral_2e501 = { (char *)((char *)&D_strdata_2e500) + 0, 16U, 16U };
+static const struct S_strdata_2e502 D_strdata_2e502 = { "\156\165\154\154\072\040\156\165\154\154\141\142\154\145\040\052\146\156\050\051\040\141" };
+static struct S_strliteral_2e503 D_strliteral_2e503 = { (char *)((char *)&D_strdata_2e502) + 0, 22U, 22U };
+static const struct S_strdata_2e505 D_strdata_2e505 = { "\156\165\154\154\141\142\154\145\040\052\141" };
+static struct S_strliteral_2e506 D_strliteral_2e506 = { (char *)((char *)&D_strdata_2e505) + 0, 11U, 11U };
+static const struct S_strdata_2e507 D_strdata_2e507 = { "\156\165\154\154\072\040\156\165\154\154\141\142\154\145\040\052\141" };
+static struct S_strliteral_2e508 D_strliteral_2e508 = { (char *)((char *)&D_strdata_2e507) + 0, 17U, 17U };
+static const struct S_strdata_2e510 D_strdata_2e510 = { "\163\164\162\165\143\164\040\173\040\170\072\040\141\040\175" };
+static struct S_strliteral_2e511 D_strliteral_2e511 = { (char *)((char *)&D_strdata_2e510) + 0, 15U, 15U };
+static const struct S_strdata_2e512 D_strdata_2e512 = { "\163\164\162\165\143\164\040\173\040\170\072\040\141\040\075\040\141\040\173\040\056\056\056\040\175\040\175" };
+static struct S_strliteral_2e513 D_strliteral_2e513 = { (char *)((char *)&D_strdata_2e512) + 0, 27U, 27U };
+static const struct S_strdata_2e515 D_strdata_2e515 = { "\156\165\154\154\141\142\154\145\040\052\163\164\162\165\143\164\040\173\040\141\040\175" };
+static struct S_strliteral_2e516 D_strliteral_2e516 = { (char *)((char *)&D_strdata_2e515) + 0, 22U, 22U };
+static const struct S_strdata_2e517 D_strdata_2e517 = { "\156\165\154\154\072\040\156\165\154\154\141\142\154\145\040\052\163\164\162\165\143\164\040\173\040\141\040\175" };
+static struct S_strliteral_2e518 D_strliteral_2e518 = { (char *)((char *)&D_strdata_2e517) + 0, 28U, 28U };
+static const struct S_strdata_2e520 D_strdata_2e520 = { "\156\165\154\154\141\142\154\145\040\052\165\156\151\157\156\040\173\040\170\072\040\141\040\175" };
+static struct S_strliteral_2e521 D_strliteral_2e521 = { (char *)((char *)&D_strdata_2e520) + 0, 24U, 24U };
+static const struct S_strdata_2e522 D_strdata_2e522 = { "\156\165\154\154\072\040\156\165\154\154\141\142\154\145\040\052\165\156\151\157\156\040\173\040\170\072\040\141\040\175" };
+static struct S_strliteral_2e523 D_strliteral_2e523 = { (char *)((char *)&D_strdata_2e522) + 0, 30U, 30U };
+static const struct S_strdata_2e525 D_strdata_2e525 = { "\050\151\156\164\040\174\040\141\051" };
+static struct S_strliteral_2e526 D_strliteral_2e526 = { (char *)((char *)&D_strdata_2e525) + 0, 9U, 9U };
+static const struct S_strdata_2e528 D_strdata_2e528 = { "\050\151\156\164\054\040\141\051" };
+static struct S_strliteral_2e529 D_strliteral_2e529 = { (char *)((char *)&D_strdata_2e528) + 0, 8U, 8U };
+static const struct S_strdata_2e530 D_strdata_2e530 = { "\050\060\054\040\141\040\173\040\056\056\056\040\175\051" };
+static struct S_strliteral_2e531 D_strliteral_2e531 = { (char *)((char *)&D_strdata_2e530) + 0, 14U, 14U };
+static const struct S_strdata_2e537 D_strdata_2e537 = { "\145\170\160\157\162\164\040\164\171\160\145\040\142\040\075\040" };
+static struct S_strliteral_2e538 D_strliteral_2e538 = { (char *)((char *)&D_strdata_2e537) + 0, 16U, 16U };
+static const struct S_strdata_2e539 D_strdata_2e539 = { "\073" };
+static struct S_strliteral_2e540 D_strliteral_2e540 = { (char *)((char *)&D_strdata_2e539) + 0, 1U, 1U };
+static const struct S_strliteral_2e541 D_strliteral_2e541 = { 0U, 0U, 0U };
+static const struct S_strdata_2e543 D_strdata_2e543 = { "\145\170\160\157\162\164\040\146\156\040\142\050\170\072\040" };
+static struct S_strliteral_2e544 D_strliteral_2e544 = { (char *)((char *)&D_strdata_2e543) + 0, 15U, 15U };
+static const struct S_strdata_2e545 D_strdata_2e545 = { "\051\040\166\157\151\144\040\075\040\166\157\151\144\073" };
+static struct S_strliteral_2e546 D_strliteral_2e546 = { (char *)((char *)&D_strdata_2e545) + 0, 14U, 14U };
+static const struct S_strdata_2e548 D_strdata_2e548 = { "\145\170\160\157\162\164\040\146\156\040\142\050\051\040" };
+static struct S_strliteral_2e549 D_strliteral_2e549 = { (char *)((char *)&D_strdata_2e548) + 0, 14U, 14U };
+static const struct S_strdata_2e550 D_strdata_2e550 = { "\040\075\040" };
+static struct S_strliteral_2e551 D_strliteral_2e551 = { (char *)((char *)&D_strdata_2e550) + 0, 3U, 3U };
+static const struct S_strdata_2e553 D_strdata_2e553 = { "\145\170\160\157\162\164\040\154\145\164\040\142\072\040" };
+static struct S_strliteral_2e554 D_strliteral_2e554 = { (char *)((char *)&D_strdata_2e553) + 0, 14U, 14U };
+static const struct S_strdata_2e556 D_strdata_2e556 = { "\145\170\160\157\162\164\040\154\145\164\040\142\040\075\040" };
+static struct S_strliteral_2e557 D_strliteral_2e557 = { (char *)((char *)&D_strdata_2e556) + 0, 15U, 15U };
+static const struct S_strdata_2e559 D_strdata_2e559 = { "\145\170\160\157\162\164\040\144\145\146\040\142\072\040" };
+static struct S_strliteral_2e560 D_strliteral_2e560 = { (char *)((char *)&D_strdata_2e559) + 0, 14U, 14U };
+static const struct S_strdata_2e562 D_strdata_2e562 = { "\145\170\160\157\162\164\040\144\145\146\040\142\040\075\040" };
+static struct S_strliteral_2e563 D_strliteral_2e563 = { (char *)((char *)&D_strdata_2e562) + 0, 15U, 15U };
+static const struct S_strdata_2e621 D_strdata_2e621 = { "\164\171\160\145\040\141\040\075\040\163\164\162\165\143\164\040\173\040\170\072\040\151\156\164\040\175\073", 10U };
+static struct S_strliteral_2e622 D_strliteral_2e622 = { (char *)((char *)&D_strdata_2e621) + 0, 28U, 28U };
+static const struct S_strdata_2e760 D_strdata_2e760 = { "\145\170\160\157\162\164\040" };
+static struct S_strliteral_2e761 D_strliteral_2e761 = { (char *)((char *)&D_strdata_2e760) + 0, 7U, 7U };
+static const struct S_strdata_2e801 D_strdata_2e801 = { "\145\170\160\157\162\164\040\164\171\160\145\040\145\040\075\040\145\156\165\155\040\173\106\117\117\175\073\040\145\170\160\157\162\164\040\146\156\040\146\050\170\072\040\145\051\040\145\040\075\040\170\073" };
+static struct S_strliteral_2e802 D_strliteral_2e802 = { (char *)((char *)&D_strdata_2e801) + 0, 52U, 52U };
+static const struct S_strdata_2e821 D_strdata_2e821 = { "\164\171\160\145\040\145\040\075\040\145\156\165\155\040\173\106\117\117\175\073\040\145\170\160\157\162\164\040\146\156\040\146\050\170\072\040\145\051\040\145\040\075\040\170\073" };
+static struct S_strliteral_2e822 D_strliteral_2e822 = { (char *)((char *)&D_strdata_2e821) + 0, 45U, 45U };
+static struct S_abortsites_2e411 D_abortsites_2e411 = { (char *)((char *)&D_strliteral_2e1) + 0, 440U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 440U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 456U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 456U, 53U, (char *)((char *)&D_strliteral_2e1) + 0, 487U, 38U, (char *)((char *)&D_strliteral_2e1) + 0, 488U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 489U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 491U, 40U, (char *)((char *)&D_strliteral_2e1) + 0, 492U, 40U, (char *)((char *)&D_strliteral_2e1) + 0, 495U, 40U, (char *)((char *)&D_strliteral_2e1) + 0, 496U, 40U, (char *)((char *)&D_strliteral_2e1) + 0, 498U, 63U, (char *)((char *)&D_strliteral_2e1) + 0, 498U, 63U, (char *)((char *)&D_strliteral_2e1) + 0, 499U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 499U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 500U, 65U, (char *)((char *)&D_strliteral_2e1) + 0, 500U, 65U, (char *)((char *)&D_strliteral_2e1) + 0, 503U, 90U, (char *)((char *)&D_strliteral_2e1) + 0, 503U, 90U, (char *)((char *)&D_strliteral_2e1) + 0, 504U, 81U, (char *)((char *)&D_strliteral_2e1) + 0, 504U, 81U };
+static struct S_static_2e0 D_static_2e0 = { 0U };
+static const struct S_strdata_2e898 D_strdata_2e898 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, "\173\040\144\145\146\040\130\040\075\040\060\073\040\175\073", 10U, 9U, 9U, "\144\145\146\040\103\040\075\040\130\073", 10U, 9U, "\175\073" };
+static struct S_strliteral_2e899 D_strliteral_2e899 = { (char *)((char *)&D_strdata_2e898) + 0, 53U, 53U };
+static const struct S_strdata_2e930 D_strdata_2e930 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, "\173\040\144\145\146\040\130\040\075\040\060\073\040\175\073", 10U, 9U, 9U, "\130\073", 10U, 9U, "\175\073" };
+static struct S_strliteral_2e931 D_strliteral_2e931 = { (char *)((char *)&D_strdata_2e930) + 0, 45U, 45U };
+static const struct S_strdata_2e950 D_strdata_2e950 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\060\073", 10U, 9U, 9U, "\144\145\146\040\130\040\075\040\170\073", 10U, 9U, "\175\073" };
+static struct S_strliteral_2e951 D_strliteral_2e951 = { (char *)((char *)&D_strdata_2e950) + 0, 48U, 48U };
+static const struct S_strdata_2e970 D_strdata_2e970 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\060\073", 10U, 9U, 9U, "\144\145\146\040\130\040\075\040\046\170\073", 10U, 9U, "\175\073" };
+static struct S_strliteral_2e971 D_strliteral_2e971 = { (char *)((char *)&D_strdata_2e970) + 0, 49U, 49U };
+static const struct S_strdata_2e990 D_strdata_2e990 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, "\163\164\141\164\151\143\040\154\145\164\040\170\040\075\040\060\073", 10U, 9U, 9U, "\144\145\146\040\130\040\075\040\170\073", 10U, 9U, "\175\073" };
+static struct S_strliteral_2e991 D_strliteral_2e991 = { (char *)((char *)&D_strdata_2e990) + 0, 55U, 55U };
+static const struct S_strdata_2e1010 D_strdata_2e1010 = { 10U, 9U, 9U, "\144\145\146\040\130\040\075\040\064\062\073", 10U, 9U, 9U, "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, 9U, "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\130\040\075\075\040\061\063\063\067\051\073", 10U, 9U, 9U, 9U, "\144\145\146\040\130\040\075\040\064\062\073", 10U, 9U, 9U, 9U, "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\130\040\075\075\040\064\062\051\073", 10U, 9U, 9U, "\175\073", 10U, 9U };
+static struct S_strliteral_2e1011 D_strliteral_2e1011 = { (char *)((char *)&D_strdata_2e1010) + 0, 113U, 113U };
+static const struct S_strdata_2e1016 D_strdata_2e1016 = { "\055\104\130\075\061\063\063\067" };
+static struct S_strliteral_2e1017 D_strliteral_2e1017 = { (char *)((char *)&D_strdata_2e1016) + 0, 8U, 8U };
+static const struct S_strdata_2e1035 D_strdata_2e1035 = { "\146\156\040\164\145\163\164\050\051\040\166\157\151\144\040\075\040\173", 10U, 9U, 9U, "\163\164\141\164\151\143\040\144\145\146\040\130\040\075\040\060\073", 10U, 9U, "\175\073" };
+static struct S_strliteral_2e1036 D_strliteral_2e1036 = { (char *)((char *)&D_strdata_2e1035) + 0, 42U, 42U };
+static struct S_abortsites_2e858 D_abortsites_2e858 = { (char *)((char *)&D_strliteral_2e1) + 0, 82U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 95U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 108U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 124U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 124U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 127U, 14U, (char *)((char *)&D_strliteral_2e1) + 0, 127U, 14U };
+static struct S_abortsites_2e1089 D_abortsites_2e1089 = { (char *)((char *)&D_strliteral_2e1) + 0, 27U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 28U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 29U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 30U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 32U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 33U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 41U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 44U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 47U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 50U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 53U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 62U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_constants)))();
+	((void (*)(void))((u64)((char *)&F_local__constants)))();
+	((void (*)(void))((u64)((char *)&F_sz)))();
+	((void (*)(void))((u64)((char *)&F_reject)))();
+	((void (*)(void))((u64)((char *)&F_imported)))();
+	((void (*)(void))((u64)((char *)&F_hosted__main)))();
+	((void (*)(void))((u64)((char *)&F_complete__graph)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_complete__graph(void) {
+	L_start_2e7:;
+	L_body_2e8:;
+	goto L__2e9;
+	L__2e11:;
+	L__2e9:;
+	return;
+}
+static void F_hosted__main(void) {
+	char A0[168] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[216] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[48] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	char A12[24] __attribute__((aligned(16)));
+	char A13[48] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[48] __attribute__((aligned(16)));
+	char A17[8] __attribute__((aligned(16)));
+	char A18[24] __attribute__((aligned(16)));
+	char A19[48] __attribute__((aligned(16)));
+	char B20[8] __attribute__((aligned(16)));
+	char B21[24] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char R23[4] __attribute__((aligned(16)));
+	char B24[8] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char R27[4] __attribute__((aligned(16)));
+	char B28[8] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char R31[4] __attribute__((aligned(16)));
+	char B32[8] __attribute__((aligned(16)));
+	char B33[24] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char R35[4] __attribute__((aligned(16)));
+	char B36[8] __attribute__((aligned(16)));
+	char B37[24] __attribute__((aligned(16)));
+	char B38[24] __attribute__((aligned(16)));
+	char R39[4] __attribute__((aligned(16)));
+	char B40[8] __attribute__((aligned(16)));
+	char B41[24] __attribute__((aligned(16)));
+	char B42[24] __attribute__((aligned(16)));
+	char R43[4] __attribute__((aligned(16)));
+	u64 t__2e112;
+	u64 t__2e113;
+	u64 t__2e117;
+	u64 t__2e119;
+	u64 t__2e120;
+	u64 t__2e121;
+	u64 t__2e123;
+	u64 t__2e132;
+	u64 t__2e134;
+	u64 t__2e137;
+	u64 t__2e139;
+	u64 t__2e140;
+	u64 t__2e141;
+	u64 t__2e150;
+	u64 t__2e159;
+	u64 t__2e161;
+	u64 t__2e164;
+	u64 t__2e166;
+	u64 t__2e168;
+	u64 t__2e176;
+	u64 t__2e185;
+	u64 t__2e187;
+	u64 t__2e190;
+	u64 t__2e192;
+	u64 t__2e198;
+	u64 t__2e207;
+	u64 t__2e209;
+	u64 t__2e212;
+	u64 t__2e214;
+	u64 t__2e218;
+	u64 t__2e227;
+	u64 t__2e229;
+	u64 t__2e40;
+	u64 t__2e41;
+	u64 t__2e45;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e56;
+	u64 t__2e65;
+	u64 t__2e67;
+	u64 t__2e71;
+	u64 t__2e72;
+	u64 t__2e73;
+	u64 t__2e74;
+	u64 t__2e75;
+	u64 t__2e78;
+	u64 t__2e79;
+	u64 t__2e80;
+	u64 t__2e81;
+	u64 t__2e82;
+	u64 t__2e84;
+	u64 t_abortsite_2e69;
+	u64 t_binding_2e111;
+	u64 t_binding_2e16;
+	u64 t_binding_2e39;
+	u64 t_binding_2e85;
+	u64 t_item_2e145;
+	u64 t_item_2e173;
+	u64 t_item_2e19;
+	u64 t_item_2e197;
+	u64 t_item_2e217;
+	u64 t_item_2e87;
+	u64 t_object_2e118;
+	u64 t_object_2e122;
+	u64 t_object_2e138;
+	u64 t_object_2e142;
+	u64 t_object_2e143;
+	u64 t_object_2e167;
+	u64 t_object_2e171;
+	u64 t_object_2e172;
+	u64 t_object_2e191;
+	u64 t_object_2e195;
+	u64 t_object_2e196;
+	u64 t_object_2e213;
+	u64 t_object_2e215;
+	u64 t_object_2e216;
+	u64 t_object_2e47;
+	u64 t_object_2e54;
+	u64 t_tag_2e124;
+	u64 t_tag_2e151;
+	u64 t_tag_2e177;
+	u64 t_tag_2e199;
+	u64 t_tag_2e219;
+	u64 t_tag_2e57;
+	L_start_2e12:;
+	t_binding_2e16 = (u64)A0;
+	t_binding_2e39 = (u64)A1;
+	t_object_2e47 = (u64)A2;
+	t_object_2e54 = (u64)A3;
+	t_binding_2e85 = (u64)A4;
+	t_binding_2e111 = (u64)A5;
+	t_object_2e118 = (u64)A6;
+	t_object_2e122 = (u64)A7;
+	t_object_2e138 = (u64)A8;
+	t_object_2e142 = (u64)A9;
+	t_object_2e143 = (u64)A10;
+	t_object_2e167 = (u64)A11;
+	t_object_2e171 = (u64)A12;
+	t_object_2e172 = (u64)A13;
+	t_object_2e191 = (u64)A14;
+	t_object_2e195 = (u64)A15;
+	t_object_2e196 = (u64)A16;
+	t_object_2e213 = (u64)A17;
+	t_object_2e215 = (u64)A18;
+	t_object_2e216 = (u64)A19;
+	L_body_2e13:;
+	t_item_2e19 = (u64)((u64)t_binding_2e16 + (u64)((u64)0UL));
+	BLIT(t_item_2e19, ((u64)((char *)&D_strliteral_2e21)), ((u64)24UL));
+	t_item_2e19 = (u64)((u64)t_binding_2e16 + (u64)((u64)24UL));
+	BLIT(t_item_2e19, ((u64)((char *)&D_strliteral_2e23)), ((u64)24UL));
+	t_item_2e19 = (u64)((u64)t_binding_2e16 + (u64)((u64)48UL));
+	BLIT(t_item_2e19, ((u64)((char *)&D_strliteral_2e25)), ((u64)24UL));
+	t_item_2e19 = (u64)((u64)t_binding_2e16 + (u64)((u64)72UL));
+	BLIT(t_item_2e19, ((u64)((char *)&D_strliteral_2e27)), ((u64)24UL));
+	t_item_2e19 = (u64)((u64)t_binding_2e16 + (u64)((u64)96UL));
+	BLIT(t_item_2e19, ((u64)((char *)&D_strliteral_2e29)), ((u64)24UL));
+	t_item_2e19 = (u64)((u64)t_binding_2e16 + (u64)((u64)120UL));
+	BLIT(t_item_2e19, ((u64)((char *)&D_strliteral_2e31)), ((u64)24UL));
+	t_item_2e19 = (u64)((u64)t_binding_2e16 + (u64)((u64)144UL));
+	BLIT(t_item_2e19, ((u64)((char *)&D_strliteral_2e33)), ((u64)24UL));
+	*(u64 *)t_binding_2e39 = (u64)((u64)0UL);
+	L_loop_2e34:;
+	t__2e41 = (u64)(*(u64 *)t_binding_2e39);
+	t__2e40 = (u64)(u32)(((u64)t__2e41 < (u64)((u64)7UL)));
+	if ((u32)t__2e40) goto L_body_2e35; else goto L__2e37;
+	L_body_2e35:;
+	*(u32 *)t_object_2e47 = (u32)((u64)3532310079UL);
+	t__2e51 = (u64)((u64)t_object_2e47 + (u64)((u64)4UL));
+	*(u32 *)t__2e51 = (u32)((u64)0UL);
+	t__2e53 = (u64)(*(u64 *)t_binding_2e39);
+	t__2e52 = (u64)((u64)t__2e53 * (u64)((u64)24UL));
+	t__2e52 = (u64)((u64)t_binding_2e16 + (u64)t__2e52);
+	*(u64 *)t_object_2e54 = (u64)((u64)0UL);
+	t__2e56 = (u64)((u64)t_object_2e54 + (u64)((u64)8UL));
+	*(u64 *)t__2e56 = (u64)((u64)0UL);
+	t__2e56 = (u64)((u64)t__2e56 + (u64)((u64)8UL));
+	*(u64 *)t__2e56 = (u64)((u64)0UL);
+	BLIT((u64)B20, t_object_2e47, 8);
+	BLIT((u64)B21, t__2e52, 24);
+	BLIT((u64)B22, t_object_2e54, 24);
+	t__2e45 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R23, (u64)B20, (u64)B21, (u64)B22);
+	t_tag_2e57 = (u64)(*(u32 *)t__2e45);
+	t__2e65 = (u64)(u32)(((u32)t_tag_2e57 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e65) goto L_member_2e62; else goto L__2e64;
+	L__2e64:;
+	t__2e67 = (u64)(u32)(((u32)t_tag_2e57 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e67) goto L_member_2e63; else goto L__2e66;
+	L__2e66:;
+	goto L_matches_2e61;
+	L_member_2e62:;
+	goto L_matches_2e61;
+	L_member_2e63:;
+	goto L_matches_2e60;
+	L_matches_2e60:;
+	goto L__2e58;
+	L_matches_2e61:;
+	t_abortsite_2e69 = ((u64)0UL);
+	goto L_abort_2e70;
+	L__2e76:;
+	L__2e59:;
+	t_abortsite_2e69 = ((u64)1UL);
+	goto L_abort_2e77;
+	L__2e58:;
+	goto L__2e42;
+	L__2e83:;
+	L__2e42:;
+	L_after_2e38:;
+	t__2e84 = (u64)(*(u64 *)t_binding_2e39);
+	t__2e84 = (u64)((u64)t__2e84 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e39 = (u64)t__2e84;
+	goto L_loop_2e34;
+	L__2e37:;
+	t_item_2e87 = (u64)((u64)t_binding_2e85 + (u64)((u64)0UL));
+	BLIT(t_item_2e87, ((u64)((char *)&D_strliteral_2e89)), ((u64)24UL));
+	t_item_2e87 = (u64)((u64)t_binding_2e85 + (u64)((u64)24UL));
+	BLIT(t_item_2e87, ((u64)((char *)&D_strliteral_2e91)), ((u64)24UL));
+	t_item_2e87 = (u64)((u64)t_binding_2e85 + (u64)((u64)48UL));
+	BLIT(t_item_2e87, ((u64)((char *)&D_strliteral_2e93)), ((u64)24UL));
+	t_item_2e87 = (u64)((u64)t_binding_2e85 + (u64)((u64)72UL));
+	BLIT(t_item_2e87, ((u64)((char *)&D_strliteral_2e95)), ((u64)24UL));
+	t_item_2e87 = (u64)((u64)t_binding_2e85 + (u64)((u64)96UL));
+	BLIT(t_item_2e87, ((u64)((char *)&D_strliteral_2e97)), ((u64)24UL));
+	t_item_2e87 = (u64)((u64)t_binding_2e85 + (u64)((u64)120UL));
+	BLIT(t_item_2e87, ((u64)((char *)&D_strliteral_2e99)), ((u64)24UL));
+	t_item_2e87 = (u64)((u64)t_binding_2e85 + (u64)((u64)144UL));
+	BLIT(t_item_2e87, ((u64)((char *)&D_strliteral_2e101)), ((u64)24UL));
+	t_item_2e87 = (u64)((u64)t_binding_2e85 + (u64)((u64)168UL));
+	BLIT(t_item_2e87, ((u64)((char *)&D_strliteral_2e103)), ((u64)24UL));
+	t_item_2e87 = (u64)((u64)t_binding_2e85 + (u64)((u64)192UL));
+	BLIT(t_item_2e87, ((u64)((char *)&D_strliteral_2e105)), ((u64)24UL));
+	*(u64 *)t_binding_2e111 = (u64)((u64)0UL);
+	L_loop_2e106:;
+	t__2e113 = (u64)(*(u64 *)t_binding_2e111);
+	t__2e112 = (u64)(u32)(((u64)t__2e113 < (u64)((u64)9UL)));
+	if ((u32)t__2e112) goto L_body_2e107; else goto L__2e109;
+	L_body_2e107:;
+	*(u32 *)t_object_2e118 = (u32)((u64)3532310079UL);
+	t__2e119 = (u64)((u64)t_object_2e118 + (u64)((u64)4UL));
+	*(u32 *)t__2e119 = (u32)((u64)4UL);
+	t__2e121 = (u64)(*(u64 *)t_binding_2e111);
+	t__2e120 = (u64)((u64)t__2e121 * (u64)((u64)24UL));
+	t__2e120 = (u64)((u64)t_binding_2e85 + (u64)t__2e120);
+	*(u64 *)t_object_2e122 = (u64)((u64)0UL);
+	t__2e123 = (u64)((u64)t_object_2e122 + (u64)((u64)8UL));
+	*(u64 *)t__2e123 = (u64)((u64)0UL);
+	t__2e123 = (u64)((u64)t__2e123 + (u64)((u64)8UL));
+	*(u64 *)t__2e123 = (u64)((u64)0UL);
+	BLIT((u64)B24, t_object_2e118, 8);
+	BLIT((u64)B25, t__2e120, 24);
+	BLIT((u64)B26, t_object_2e122, 24);
+	t__2e117 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R27, (u64)B24, (u64)B25, (u64)B26);
+	t_tag_2e124 = (u64)(*(u32 *)t__2e117);
+	t__2e132 = (u64)(u32)(((u32)t_tag_2e124 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e132) goto L_member_2e129; else goto L__2e131;
+	L__2e131:;
+	t__2e134 = (u64)(u32)(((u32)t_tag_2e124 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e134) goto L_member_2e130; else goto L__2e133;
+	L__2e133:;
+	goto L_matches_2e128;
+	L_member_2e129:;
+	goto L_matches_2e128;
+	L_member_2e130:;
+	goto L_matches_2e127;
+	L_matches_2e127:;
+	goto L__2e125;
+	L_matches_2e128:;
+	t_abortsite_2e69 = ((u64)2UL);
+	goto L_abort_2e70;
+	L__2e135:;
+	L__2e126:;
+	t_abortsite_2e69 = ((u64)3UL);
+	goto L_abort_2e77;
+	L__2e125:;
+	*(u32 *)t_object_2e138 = (u32)((u64)3532310079UL);
+	t__2e139 = (u64)((u64)t_object_2e138 + (u64)((u64)4UL));
+	*(u32 *)t__2e139 = (u32)((u64)0UL);
+	t__2e141 = (u64)(*(u64 *)t_binding_2e111);
+	t__2e140 = (u64)((u64)t__2e141 * (u64)((u64)24UL));
+	t__2e140 = (u64)((u64)t_binding_2e85 + (u64)t__2e140);
+	t_item_2e145 = (u64)((u64)t_object_2e143 + (u64)((u64)0UL));
+	BLIT(t_item_2e145, ((u64)((char *)&D_strliteral_2e147)), ((u64)24UL));
+	t_item_2e145 = (u64)((u64)t_object_2e143 + (u64)((u64)24UL));
+	BLIT(t_item_2e145, ((u64)((char *)&D_strliteral_2e149)), ((u64)24UL));
+	*(u64 *)t_object_2e142 = (u64)t_object_2e143;
+	t__2e150 = (u64)((u64)t_object_2e142 + (u64)((u64)8UL));
+	*(u64 *)t__2e150 = (u64)((u64)2UL);
+	t__2e150 = (u64)((u64)t__2e150 + (u64)((u64)8UL));
+	*(u64 *)t__2e150 = (u64)((u64)2UL);
+	BLIT((u64)B28, t_object_2e138, 8);
+	BLIT((u64)B29, t__2e140, 24);
+	BLIT((u64)B30, t_object_2e142, 24);
+	t__2e137 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R31, (u64)B28, (u64)B29, (u64)B30);
+	t_tag_2e151 = (u64)(*(u32 *)t__2e137);
+	t__2e159 = (u64)(u32)(((u32)t_tag_2e151 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e159) goto L_member_2e156; else goto L__2e158;
+	L__2e158:;
+	t__2e161 = (u64)(u32)(((u32)t_tag_2e151 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e161) goto L_member_2e157; else goto L__2e160;
+	L__2e160:;
+	goto L_matches_2e155;
+	L_member_2e156:;
+	goto L_matches_2e155;
+	L_member_2e157:;
+	goto L_matches_2e154;
+	L_matches_2e154:;
+	goto L__2e152;
+	L_matches_2e155:;
+	t_abortsite_2e69 = ((u64)4UL);
+	goto L_abort_2e70;
+	L__2e162:;
+	L__2e153:;
+	t_abortsite_2e69 = ((u64)5UL);
+	goto L_abort_2e77;
+	L__2e152:;
+	goto L__2e114;
+	L__2e163:;
+	L__2e114:;
+	L_after_2e110:;
+	t__2e164 = (u64)(*(u64 *)t_binding_2e111);
+	t__2e164 = (u64)((u64)t__2e164 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e111 = (u64)t__2e164;
+	goto L_loop_2e106;
+	L__2e109:;
+	*(u32 *)t_object_2e167 = (u32)((u64)3532310079UL);
+	t__2e168 = (u64)((u64)t_object_2e167 + (u64)((u64)4UL));
+	*(u32 *)t__2e168 = (u32)((u64)4UL);
+	t_item_2e173 = (u64)((u64)t_object_2e172 + (u64)((u64)0UL));
+	BLIT(t_item_2e173, ((u64)((char *)&D_strliteral_2e147)), ((u64)24UL));
+	t_item_2e173 = (u64)((u64)t_object_2e172 + (u64)((u64)24UL));
+	BLIT(t_item_2e173, ((u64)((char *)&D_strliteral_2e175)), ((u64)24UL));
+	*(u64 *)t_object_2e171 = (u64)t_object_2e172;
+	t__2e176 = (u64)((u64)t_object_2e171 + (u64)((u64)8UL));
+	*(u64 *)t__2e176 = (u64)((u64)2UL);
+	t__2e176 = (u64)((u64)t__2e176 + (u64)((u64)8UL));
+	*(u64 *)t__2e176 = (u64)((u64)2UL);
+	BLIT((u64)B32, t_object_2e167, 8);
+	BLIT((u64)B33, ((u64)((char *)&D_strliteral_2e170)), 24);
+	BLIT((u64)B34, t_object_2e171, 24);
+	t__2e166 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R35, (u64)B32, (u64)B33, (u64)B34);
+	t_tag_2e177 = (u64)(*(u32 *)t__2e166);
+	t__2e185 = (u64)(u32)(((u32)t_tag_2e177 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e185) goto L_member_2e182; else goto L__2e184;
+	L__2e184:;
+	t__2e187 = (u64)(u32)(((u32)t_tag_2e177 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e187) goto L_member_2e183; else goto L__2e186;
+	L__2e186:;
+	goto L_matches_2e181;
+	L_member_2e182:;
+	goto L_matches_2e181;
+	L_member_2e183:;
+	goto L_matches_2e180;
+	L_matches_2e180:;
+	goto L__2e178;
+	L_matches_2e181:;
+	t_abortsite_2e69 = ((u64)6UL);
+	goto L_abort_2e70;
+	L__2e188:;
+	L__2e179:;
+	t_abortsite_2e69 = ((u64)7UL);
+	goto L_abort_2e77;
+	L__2e178:;
+	*(u32 *)t_object_2e191 = (u32)((u64)3532310079UL);
+	t__2e192 = (u64)((u64)t_object_2e191 + (u64)((u64)4UL));
+	*(u32 *)t__2e192 = (u32)((u64)0UL);
+	t_item_2e197 = (u64)((u64)t_object_2e196 + (u64)((u64)0UL));
+	BLIT(t_item_2e197, ((u64)((char *)&D_strliteral_2e147)), ((u64)24UL));
+	t_item_2e197 = (u64)((u64)t_object_2e196 + (u64)((u64)24UL));
+	BLIT(t_item_2e197, ((u64)((char *)&D_strliteral_2e175)), ((u64)24UL));
+	*(u64 *)t_object_2e195 = (u64)t_object_2e196;
+	t__2e198 = (u64)((u64)t_object_2e195 + (u64)((u64)8UL));
+	*(u64 *)t__2e198 = (u64)((u64)2UL);
+	t__2e198 = (u64)((u64)t__2e198 + (u64)((u64)8UL));
+	*(u64 *)t__2e198 = (u64)((u64)2UL);
+	BLIT((u64)B36, t_object_2e191, 8);
+	BLIT((u64)B37, ((u64)((char *)&D_strliteral_2e194)), 24);
+	BLIT((u64)B38, t_object_2e195, 24);
+	t__2e190 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R39, (u64)B36, (u64)B37, (u64)B38);
+	t_tag_2e199 = (u64)(*(u32 *)t__2e190);
+	t__2e207 = (u64)(u32)(((u32)t_tag_2e199 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e207) goto L_member_2e204; else goto L__2e206;
+	L__2e206:;
+	t__2e209 = (u64)(u32)(((u32)t_tag_2e199 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e209) goto L_member_2e205; else goto L__2e208;
+	L__2e208:;
+	goto L_matches_2e203;
+	L_member_2e204:;
+	goto L_matches_2e203;
+	L_member_2e205:;
+	goto L_matches_2e202;
+	L_matches_2e202:;
+	goto L__2e200;
+	L_matches_2e203:;
+	t_abortsite_2e69 = ((u64)8UL);
+	goto L_abort_2e70;
+	L__2e210:;
+	L__2e201:;
+	t_abortsite_2e69 = ((u64)9UL);
+	goto L_abort_2e77;
+	L__2e200:;
+	*(u32 *)t_object_2e213 = (u32)((u64)3532310079UL);
+	t__2e214 = (u64)((u64)t_object_2e213 + (u64)((u64)4UL));
+	*(u32 *)t__2e214 = (u32)((u64)4UL);
+	t_item_2e217 = (u64)((u64)t_object_2e216 + (u64)((u64)0UL));
+	BLIT(t_item_2e217, ((u64)((char *)&D_strliteral_2e147)), ((u64)24UL));
+	t_item_2e217 = (u64)((u64)t_object_2e216 + (u64)((u64)24UL));
+	BLIT(t_item_2e217, ((u64)((char *)&D_strliteral_2e175)), ((u64)24UL));
+	*(u64 *)t_object_2e215 = (u64)t_object_2e216;
+	t__2e218 = (u64)((u64)t_object_2e215 + (u64)((u64)8UL));
+	*(u64 *)t__2e218 = (u64)((u64)2UL);
+	t__2e218 = (u64)((u64)t__2e218 + (u64)((u64)8UL));
+	*(u64 *)t__2e218 = (u64)((u64)2UL);
+	BLIT((u64)B40, t_object_2e213, 8);
+	BLIT((u64)B41, ((u64)((char *)&D_strliteral_2e93)), 24);
+	BLIT((u64)B42, t_object_2e215, 24);
+	t__2e212 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R43, (u64)B40, (u64)B41, (u64)B42);
+	t_tag_2e219 = (u64)(*(u32 *)t__2e212);
+	t__2e227 = (u64)(u32)(((u32)t_tag_2e219 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e227) goto L_member_2e224; else goto L__2e226;
+	L__2e226:;
+	t__2e229 = (u64)(u32)(((u32)t_tag_2e219 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e229) goto L_member_2e225; else goto L__2e228;
+	L__2e228:;
+	goto L_matches_2e223;
+	L_member_2e224:;
+	goto L_matches_2e223;
+	L_member_2e225:;
+	goto L_matches_2e222;
+	L_matches_2e222:;
+	goto L__2e220;
+	L_matches_2e223:;
+	t_abortsite_2e69 = ((u64)10UL);
+	goto L_abort_2e70;
+	L__2e230:;
+	L__2e221:;
+	t_abortsite_2e69 = ((u64)11UL);
+	goto L_abort_2e77;
+	L__2e220:;
+	goto L__2e14;
+	L__2e231:;
+	L__2e14:;
+	return;
+	L_abort_2e70:;
+	t__2e71 = (u64)((u64)t_abortsite_2e69 * (u64)((u64)16UL));
+	t__2e71 = (u64)((u64)((u64)((char *)&D_abortsites_2e68)) + (u64)t__2e71);
+	t__2e72 = (u64)(*(u64 *)t__2e71);
+	t__2e73 = (u64)((u64)t__2e71 + (u64)((u64)8UL));
+	t__2e74 = (u64)(*(u32 *)t__2e73);
+	t__2e73 = (u64)((u64)t__2e71 + (u64)((u64)12UL));
+	t__2e75 = (u64)(*(u32 *)t__2e73);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e72, (u64)t__2e74, (u64)t__2e75, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e77:;
+	t__2e78 = (u64)((u64)t_abortsite_2e69 * (u64)((u64)16UL));
+	t__2e78 = (u64)((u64)((u64)((char *)&D_abortsites_2e68)) + (u64)t__2e78);
+	t__2e79 = (u64)(*(u64 *)t__2e78);
+	t__2e80 = (u64)((u64)t__2e78 + (u64)((u64)8UL));
+	t__2e81 = (u64)(*(u32 *)t__2e80);
+	t__2e80 = (u64)((u64)t__2e78 + (u64)((u64)12UL));
+	t__2e82 = (u64)(*(u32 *)t__2e80);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e79, (u64)t__2e81, (u64)t__2e82, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_imported(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char B4[8] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char R7[4] __attribute__((aligned(16)));
+	char B8[8] __attribute__((aligned(16)));
+	char B9[24] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char R11[4] __attribute__((aligned(16)));
+	u64 t__2e236;
+	u64 t__2e237;
+	u64 t__2e239;
+	u64 t__2e241;
+	u64 t__2e245;
+	u64 t__2e254;
+	u64 t__2e256;
+	u64 t__2e260;
+	u64 t__2e261;
+	u64 t__2e262;
+	u64 t__2e263;
+	u64 t__2e264;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e269;
+	u64 t__2e270;
+	u64 t__2e271;
+	u64 t__2e273;
+	u64 t__2e275;
+	u64 t__2e279;
+	u64 t__2e288;
+	u64 t__2e290;
+	u64 t__2e294;
+	u64 t__2e297;
+	u64 t__2e298;
+	u64 t__2e299;
+	u64 t__2e300;
+	u64 t__2e302;
+	u64 t__2e303;
+	u64 t__2e304;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e309;
+	u64 t__2e312;
+	u64 t__2e313;
+	u64 t__2e314;
+	u64 t__2e315;
+	u64 t_abortsite_2e258;
+	u64 t_object_2e240;
+	u64 t_object_2e244;
+	u64 t_object_2e274;
+	u64 t_object_2e278;
+	u64 t_tag_2e246;
+	u64 t_tag_2e280;
+	L_start_2e232:;
+	t_object_2e240 = (u64)A0;
+	t_object_2e244 = (u64)A1;
+	t_object_2e274 = (u64)A2;
+	t_object_2e278 = (u64)A3;
+	L_body_2e233:;
+	t__2e236 = (u64)(u32)(*(i32 *)((u64)((char *)&D_s__x)));
+	t__2e237 = (u64)(u32)(*(i32 *)((u64)X_s__y));
+	*(u32 *)t_object_2e240 = (u32)((u64)3532310079UL);
+	t__2e241 = (u64)((u64)t_object_2e240 + (u64)((u64)4UL));
+	*(u32 *)t__2e241 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e244 = (u64)((u64)0UL);
+	t__2e245 = (u64)((u64)t_object_2e244 + (u64)((u64)8UL));
+	*(u64 *)t__2e245 = (u64)((u64)0UL);
+	t__2e245 = (u64)((u64)t__2e245 + (u64)((u64)8UL));
+	*(u64 *)t__2e245 = (u64)((u64)0UL);
+	BLIT((u64)B4, t_object_2e240, 8);
+	BLIT((u64)B5, ((u64)((char *)&D_strliteral_2e243)), 24);
+	BLIT((u64)B6, t_object_2e244, 24);
+	t__2e239 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R7, (u64)B4, (u64)B5, (u64)B6);
+	t_tag_2e246 = (u64)(*(u32 *)t__2e239);
+	t__2e254 = (u64)(u32)(((u32)t_tag_2e246 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e254) goto L_member_2e251; else goto L__2e253;
+	L__2e253:;
+	t__2e256 = (u64)(u32)(((u32)t_tag_2e246 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e256) goto L_member_2e252; else goto L__2e255;
+	L__2e255:;
+	goto L_matches_2e250;
+	L_member_2e251:;
+	goto L_matches_2e250;
+	L_member_2e252:;
+	goto L_matches_2e249;
+	L_matches_2e249:;
+	goto L__2e247;
+	L_matches_2e250:;
+	t_abortsite_2e258 = ((u64)0UL);
+	goto L_abort_2e259;
+	L__2e265:;
+	L__2e248:;
+	t_abortsite_2e258 = ((u64)1UL);
+	goto L_abort_2e266;
+	L__2e247:;
+	*(u32 *)t_object_2e274 = (u32)((u64)3532310079UL);
+	t__2e275 = (u64)((u64)t_object_2e274 + (u64)((u64)4UL));
+	*(u32 *)t__2e275 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e278 = (u64)((u64)0UL);
+	t__2e279 = (u64)((u64)t_object_2e278 + (u64)((u64)8UL));
+	*(u64 *)t__2e279 = (u64)((u64)0UL);
+	t__2e279 = (u64)((u64)t__2e279 + (u64)((u64)8UL));
+	*(u64 *)t__2e279 = (u64)((u64)0UL);
+	BLIT((u64)B8, t_object_2e274, 8);
+	BLIT((u64)B9, ((u64)((char *)&D_strliteral_2e277)), 24);
+	BLIT((u64)B10, t_object_2e278, 24);
+	t__2e273 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R11, (u64)B8, (u64)B9, (u64)B10);
+	t_tag_2e280 = (u64)(*(u32 *)t__2e273);
+	t__2e288 = (u64)(u32)(((u32)t_tag_2e280 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e288) goto L_member_2e285; else goto L__2e287;
+	L__2e287:;
+	t__2e290 = (u64)(u32)(((u32)t_tag_2e280 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e290) goto L_member_2e286; else goto L__2e289;
+	L__2e289:;
+	goto L_matches_2e284;
+	L_member_2e285:;
+	goto L_matches_2e284;
+	L_member_2e286:;
+	goto L_matches_2e283;
+	L_matches_2e283:;
+	goto L__2e281;
+	L_matches_2e284:;
+	t_abortsite_2e258 = ((u64)2UL);
+	goto L_abort_2e259;
+	L__2e291:;
+	L__2e282:;
+	t_abortsite_2e258 = ((u64)3UL);
+	goto L_abort_2e266;
+	L__2e281:;
+	t__2e298 = (u64)(u32)(*(i32 *)((u64)X_s__y));
+	t__2e297 = (u64)(u32)(((u32)t__2e298 == (u32)((u64)1UL)));
+	t__2e294 = (u64)(u32)t__2e297;
+	if ((u32)t__2e294) goto L__2e295; else goto L__2e296;
+	L__2e295:;
+	t__2e300 = (u64)(u32)(*(i32 *)((u64)X_s__y));
+	t__2e299 = (u64)(u32)(((u32)t__2e300 == (u32)((u64)1UL)));
+	t__2e294 = (u64)(u32)t__2e299;
+	goto L__2e296;
+	L__2e296:;
+	if ((u32)t__2e294) goto L_passed_2e293; else goto L_failed_2e292;
+	L_failed_2e292:;
+	t_abortsite_2e258 = ((u64)4UL);
+	goto L_abort_2e301;
+	L_passed_2e293:;
+	*(u32 *)((u64)X_s__y) = (u32)((u64)2UL);
+	t__2e313 = (u64)(u32)(*(i32 *)((u64)X_s__y));
+	t__2e312 = (u64)(u32)(((u32)t__2e313 == (u32)((u64)2UL)));
+	t__2e309 = (u64)(u32)t__2e312;
+	if ((u32)t__2e309) goto L__2e310; else goto L__2e311;
+	L__2e310:;
+	t__2e315 = (u64)(u32)(*(i32 *)((u64)X_s__y));
+	t__2e314 = (u64)(u32)(((u32)t__2e315 == (u32)((u64)2UL)));
+	t__2e309 = (u64)(u32)t__2e314;
+	goto L__2e311;
+	L__2e311:;
+	if ((u32)t__2e309) goto L_passed_2e308; else goto L_failed_2e307;
+	L_failed_2e307:;
+	t_abortsite_2e258 = ((u64)5UL);
+	goto L_abort_2e301;
+	L_passed_2e308:;
+	goto L__2e234;
+	L__2e316:;
+	L__2e234:;
+	return;
+	L_abort_2e259:;
+	t__2e260 = (u64)((u64)t_abortsite_2e258 * (u64)((u64)16UL));
+	t__2e260 = (u64)((u64)((u64)((char *)&D_abortsites_2e257)) + (u64)t__2e260);
+	t__2e261 = (u64)(*(u64 *)t__2e260);
+	t__2e262 = (u64)((u64)t__2e260 + (u64)((u64)8UL));
+	t__2e263 = (u64)(*(u32 *)t__2e262);
+	t__2e262 = (u64)((u64)t__2e260 + (u64)((u64)12UL));
+	t__2e264 = (u64)(*(u32 *)t__2e262);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e261, (u64)t__2e263, (u64)t__2e264, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e266:;
+	t__2e267 = (u64)((u64)t_abortsite_2e258 * (u64)((u64)16UL));
+	t__2e267 = (u64)((u64)((u64)((char *)&D_abortsites_2e257)) + (u64)t__2e267);
+	t__2e268 = (u64)(*(u64 *)t__2e267);
+	t__2e269 = (u64)((u64)t__2e267 + (u64)((u64)8UL));
+	t__2e270 = (u64)(*(u32 *)t__2e269);
+	t__2e269 = (u64)((u64)t__2e267 + (u64)((u64)12UL));
+	t__2e271 = (u64)(*(u32 *)t__2e269);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e268, (u64)t__2e270, (u64)t__2e271, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e301:;
+	t__2e302 = (u64)((u64)t_abortsite_2e258 * (u64)((u64)16UL));
+	t__2e302 = (u64)((u64)((u64)((char *)&D_abortsites_2e257)) + (u64)t__2e302);
+	t__2e303 = (u64)(*(u64 *)t__2e302);
+	t__2e304 = (u64)((u64)t__2e302 + (u64)((u64)8UL));
+	t__2e305 = (u64)(*(u32 *)t__2e304);
+	t__2e304 = (u64)((u64)t__2e302 + (u64)((u64)12UL));
+	t__2e306 = (u64)(*(u32 *)t__2e304);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e303, (u64)t__2e305, (u64)t__2e306, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_reject(void) {
+	char A0[696] __attribute__((aligned(16)));
+	char A1[8] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[144] __attribute__((aligned(16)));
+	char A5[8] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[528] __attribute__((aligned(16)));
+	char A9[504] __attribute__((aligned(16)));
+	char A10[256] __attribute__((aligned(16)));
+	char A11[8] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[48] __attribute__((aligned(16)));
+	char A14[72] __attribute__((aligned(16)));
+	char A15[24] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char A20[8] __attribute__((aligned(16)));
+	char A21[24] __attribute__((aligned(16)));
+	char A22[8] __attribute__((aligned(16)));
+	char A23[24] __attribute__((aligned(16)));
+	char B24[8] __attribute__((aligned(16)));
+	char B25[24] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char R27[4] __attribute__((aligned(16)));
+	char B28[8] __attribute__((aligned(16)));
+	char B29[24] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char R31[4] __attribute__((aligned(16)));
+	char B32[24] __attribute__((aligned(16)));
+	char R33[24] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char R35[24] __attribute__((aligned(16)));
+	char B36[24] __attribute__((aligned(16)));
+	char B37[24] __attribute__((aligned(16)));
+	char B38[24] __attribute__((aligned(16)));
+	char R39[24] __attribute__((aligned(16)));
+	char B40[24] __attribute__((aligned(16)));
+	char R41[24] __attribute__((aligned(16)));
+	char B42[24] __attribute__((aligned(16)));
+	char B43[24] __attribute__((aligned(16)));
+	char B44[24] __attribute__((aligned(16)));
+	char R45[24] __attribute__((aligned(16)));
+	char B46[24] __attribute__((aligned(16)));
+	char R47[24] __attribute__((aligned(16)));
+	char B48[8] __attribute__((aligned(16)));
+	char B49[24] __attribute__((aligned(16)));
+	char B50[24] __attribute__((aligned(16)));
+	char R51[4] __attribute__((aligned(16)));
+	char B52[24] __attribute__((aligned(16)));
+	char R53[24] __attribute__((aligned(16)));
+	char B54[8] __attribute__((aligned(16)));
+	char B55[24] __attribute__((aligned(16)));
+	char B56[24] __attribute__((aligned(16)));
+	char R57[4] __attribute__((aligned(16)));
+	char B58[8] __attribute__((aligned(16)));
+	char B59[24] __attribute__((aligned(16)));
+	char B60[24] __attribute__((aligned(16)));
+	char R61[4] __attribute__((aligned(16)));
+	char B62[8] __attribute__((aligned(16)));
+	char B63[24] __attribute__((aligned(16)));
+	char B64[24] __attribute__((aligned(16)));
+	char R65[4] __attribute__((aligned(16)));
+	u64 t__2e388;
+	u64 t__2e389;
+	u64 t__2e393;
+	u64 t__2e395;
+	u64 t__2e396;
+	u64 t__2e397;
+	u64 t__2e399;
+	u64 t__2e408;
+	u64 t__2e410;
+	u64 t__2e414;
+	u64 t__2e415;
+	u64 t__2e416;
+	u64 t__2e417;
+	u64 t__2e418;
+	u64 t__2e421;
+	u64 t__2e422;
+	u64 t__2e423;
+	u64 t__2e424;
+	u64 t__2e425;
+	u64 t__2e427;
+	u64 t__2e449;
+	u64 t__2e450;
+	u64 t__2e454;
+	u64 t__2e456;
+	u64 t__2e457;
+	u64 t__2e458;
+	u64 t__2e460;
+	u64 t__2e469;
+	u64 t__2e471;
+	u64 t__2e474;
+	u64 t__2e567;
+	u64 t__2e568;
+	u64 t__2e576;
+	u64 t__2e577;
+	u64 t__2e586;
+	u64 t__2e587;
+	u64 t__2e591;
+	u64 t__2e592;
+	u64 t__2e595;
+	u64 t__2e596;
+	u64 t__2e599;
+	u64 t__2e600;
+	u64 t__2e601;
+	u64 t__2e602;
+	u64 t__2e605;
+	u64 t__2e609;
+	u64 t__2e610;
+	u64 t__2e611;
+	u64 t__2e612;
+	u64 t__2e613;
+	u64 t__2e616;
+	u64 t__2e617;
+	u64 t__2e618;
+	u64 t__2e619;
+	u64 t__2e620;
+	u64 t__2e623;
+	u64 t__2e624;
+	u64 t__2e625;
+	u64 t__2e626;
+	u64 t__2e627;
+	u64 t__2e630;
+	u64 t__2e631;
+	u64 t__2e632;
+	u64 t__2e633;
+	u64 t__2e634;
+	u64 t__2e635;
+	u64 t__2e636;
+	u64 t__2e637;
+	u64 t__2e639;
+	u64 t__2e640;
+	u64 t__2e641;
+	u64 t__2e642;
+	u64 t__2e643;
+	u64 t__2e646;
+	u64 t__2e647;
+	u64 t__2e648;
+	u64 t__2e649;
+	u64 t__2e654;
+	u64 t__2e656;
+	u64 t__2e659;
+	u64 t__2e660;
+	u64 t__2e661;
+	u64 t__2e662;
+	u64 t__2e664;
+	u64 t__2e665;
+	u64 t__2e666;
+	u64 t__2e667;
+	u64 t__2e668;
+	u64 t__2e671;
+	u64 t__2e672;
+	u64 t__2e673;
+	u64 t__2e674;
+	u64 t__2e675;
+	u64 t__2e676;
+	u64 t__2e677;
+	u64 t__2e678;
+	u64 t__2e680;
+	u64 t__2e681;
+	u64 t__2e682;
+	u64 t__2e683;
+	u64 t__2e684;
+	u64 t__2e687;
+	u64 t__2e688;
+	u64 t__2e689;
+	u64 t__2e690;
+	u64 t__2e696;
+	u64 t__2e698;
+	u64 t__2e701;
+	u64 t__2e702;
+	u64 t__2e703;
+	u64 t__2e704;
+	u64 t__2e706;
+	u64 t__2e707;
+	u64 t__2e708;
+	u64 t__2e709;
+	u64 t__2e710;
+	u64 t__2e713;
+	u64 t__2e714;
+	u64 t__2e715;
+	u64 t__2e716;
+	u64 t__2e717;
+	u64 t__2e718;
+	u64 t__2e719;
+	u64 t__2e720;
+	u64 t__2e722;
+	u64 t__2e723;
+	u64 t__2e724;
+	u64 t__2e725;
+	u64 t__2e726;
+	u64 t__2e729;
+	u64 t__2e730;
+	u64 t__2e731;
+	u64 t__2e732;
+	u64 t__2e735;
+	u64 t__2e737;
+	u64 t__2e739;
+	u64 t__2e748;
+	u64 t__2e750;
+	u64 t__2e752;
+	u64 t__2e753;
+	u64 t__2e754;
+	u64 t__2e755;
+	u64 t__2e756;
+	u64 t__2e759;
+	u64 t__2e762;
+	u64 t__2e763;
+	u64 t__2e764;
+	u64 t__2e765;
+	u64 t__2e766;
+	u64 t__2e769;
+	u64 t__2e770;
+	u64 t__2e771;
+	u64 t__2e772;
+	u64 t__2e773;
+	u64 t__2e774;
+	u64 t__2e776;
+	u64 t__2e778;
+	u64 t__2e780;
+	u64 t__2e789;
+	u64 t__2e791;
+	u64 t__2e794;
+	u64 t__2e796;
+	u64 t__2e798;
+	u64 t__2e800;
+	u64 t__2e804;
+	u64 t__2e813;
+	u64 t__2e815;
+	u64 t__2e818;
+	u64 t__2e820;
+	u64 t__2e824;
+	u64 t__2e833;
+	u64 t__2e835;
+	u64 t_abortsite_2e412;
+	u64 t_binding_2e321;
+	u64 t_binding_2e387;
+	u64 t_binding_2e428;
+	u64 t_binding_2e448;
+	u64 t_binding_2e475;
+	u64 t_binding_2e532;
+	u64 t_binding_2e564;
+	u64 t_binding_2e575;
+	u64 t_binding_2e585;
+	u64 t_binding_2e590;
+	u64 t_binding_2e594;
+	u64 t_binding_2e598;
+	u64 t_data_2e614;
+	u64 t_item_2e323;
+	u64 t_item_2e430;
+	u64 t_item_2e478;
+	u64 t_item_2e535;
+	u64 t_item_2e566;
+	u64 t_item_2e569;
+	u64 t_object_2e394;
+	u64 t_object_2e398;
+	u64 t_object_2e455;
+	u64 t_object_2e459;
+	u64 t_object_2e736;
+	u64 t_object_2e738;
+	u64 t_object_2e777;
+	u64 t_object_2e779;
+	u64 t_object_2e799;
+	u64 t_object_2e803;
+	u64 t_object_2e819;
+	u64 t_object_2e823;
+	u64 t_tag_2e400;
+	u64 t_tag_2e461;
+	u64 t_tag_2e740;
+	u64 t_tag_2e781;
+	u64 t_tag_2e805;
+	u64 t_tag_2e825;
+	u64 t_value_2e479;
+	u64 t_value_2e484;
+	u64 t_value_2e489;
+	u64 t_value_2e494;
+	u64 t_value_2e499;
+	u64 t_value_2e504;
+	u64 t_value_2e509;
+	u64 t_value_2e514;
+	u64 t_value_2e519;
+	u64 t_value_2e524;
+	u64 t_value_2e527;
+	u64 t_value_2e536;
+	u64 t_value_2e542;
+	u64 t_value_2e547;
+	u64 t_value_2e552;
+	u64 t_value_2e555;
+	u64 t_value_2e558;
+	u64 t_value_2e561;
+	u64 t_value_2e638;
+	u64 t_value_2e655;
+	u64 t_value_2e663;
+	u64 t_value_2e679;
+	u64 t_value_2e697;
+	u64 t_value_2e705;
+	u64 t_value_2e721;
+	L_start_2e317:;
+	t_binding_2e321 = (u64)A0;
+	t_binding_2e387 = (u64)A1;
+	t_object_2e394 = (u64)A2;
+	t_object_2e398 = (u64)A3;
+	t_binding_2e428 = (u64)A4;
+	t_binding_2e448 = (u64)A5;
+	t_object_2e455 = (u64)A6;
+	t_object_2e459 = (u64)A7;
+	t_binding_2e475 = (u64)A8;
+	t_binding_2e532 = (u64)A9;
+	t_binding_2e564 = (u64)A10;
+	t_binding_2e575 = (u64)A11;
+	t_binding_2e585 = (u64)A12;
+	t_binding_2e590 = (u64)A13;
+	t_binding_2e594 = (u64)A14;
+	t_binding_2e598 = (u64)A15;
+	t_object_2e736 = (u64)A16;
+	t_object_2e738 = (u64)A17;
+	t_object_2e777 = (u64)A18;
+	t_object_2e779 = (u64)A19;
+	t_object_2e799 = (u64)A20;
+	t_object_2e803 = (u64)A21;
+	t_object_2e819 = (u64)A22;
+	t_object_2e823 = (u64)A23;
+	L_body_2e318:;
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)0UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e325)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)24UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e327)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)48UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e329)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)72UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e331)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)96UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e333)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)120UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e335)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)144UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e337)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)168UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e339)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)192UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e341)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)216UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e343)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)240UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e345)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)264UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e347)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)288UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e349)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)312UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e351)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)336UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e353)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)360UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e355)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)384UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e357)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)408UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e359)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)432UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e361)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)456UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e363)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)480UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e365)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)504UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e367)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)528UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e369)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)552UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e371)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)576UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e373)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)600UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e375)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)624UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e377)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)648UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e379)), ((u64)24UL));
+	t_item_2e323 = (u64)((u64)t_binding_2e321 + (u64)((u64)672UL));
+	BLIT(t_item_2e323, ((u64)((char *)&D_strliteral_2e381)), ((u64)24UL));
+	*(u64 *)t_binding_2e387 = (u64)((u64)0UL);
+	L_loop_2e382:;
+	t__2e389 = (u64)(*(u64 *)t_binding_2e387);
+	t__2e388 = (u64)(u32)(((u64)t__2e389 < (u64)((u64)29UL)));
+	if ((u32)t__2e388) goto L_body_2e383; else goto L__2e385;
+	L_body_2e383:;
+	*(u32 *)t_object_2e394 = (u32)((u64)3532310079UL);
+	t__2e395 = (u64)((u64)t_object_2e394 + (u64)((u64)4UL));
+	*(u32 *)t__2e395 = (u32)((u64)4UL);
+	t__2e397 = (u64)(*(u64 *)t_binding_2e387);
+	t__2e396 = (u64)((u64)t__2e397 * (u64)((u64)24UL));
+	t__2e396 = (u64)((u64)t_binding_2e321 + (u64)t__2e396);
+	*(u64 *)t_object_2e398 = (u64)((u64)0UL);
+	t__2e399 = (u64)((u64)t_object_2e398 + (u64)((u64)8UL));
+	*(u64 *)t__2e399 = (u64)((u64)0UL);
+	t__2e399 = (u64)((u64)t__2e399 + (u64)((u64)8UL));
+	*(u64 *)t__2e399 = (u64)((u64)0UL);
+	BLIT((u64)B24, t_object_2e394, 8);
+	BLIT((u64)B25, t__2e396, 24);
+	BLIT((u64)B26, t_object_2e398, 24);
+	t__2e393 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R27, (u64)B24, (u64)B25, (u64)B26);
+	t_tag_2e400 = (u64)(*(u32 *)t__2e393);
+	t__2e408 = (u64)(u32)(((u32)t_tag_2e400 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e408) goto L_member_2e405; else goto L__2e407;
+	L__2e407:;
+	t__2e410 = (u64)(u32)(((u32)t_tag_2e400 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e410) goto L_member_2e406; else goto L__2e409;
+	L__2e409:;
+	goto L_matches_2e404;
+	L_member_2e405:;
+	goto L_matches_2e404;
+	L_member_2e406:;
+	goto L_matches_2e403;
+	L_matches_2e403:;
+	goto L__2e401;
+	L_matches_2e404:;
+	t_abortsite_2e412 = ((u64)0UL);
+	goto L_abort_2e413;
+	L__2e419:;
+	L__2e402:;
+	t_abortsite_2e412 = ((u64)1UL);
+	goto L_abort_2e420;
+	L__2e401:;
+	goto L__2e390;
+	L__2e426:;
+	L__2e390:;
+	L_after_2e386:;
+	t__2e427 = (u64)(*(u64 *)t_binding_2e387);
+	t__2e427 = (u64)((u64)t__2e427 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e387 = (u64)t__2e427;
+	goto L_loop_2e382;
+	L__2e385:;
+	t_item_2e430 = (u64)((u64)t_binding_2e428 + (u64)((u64)0UL));
+	BLIT(t_item_2e430, ((u64)((char *)&D_strliteral_2e432)), ((u64)24UL));
+	t_item_2e430 = (u64)((u64)t_binding_2e428 + (u64)((u64)24UL));
+	BLIT(t_item_2e430, ((u64)((char *)&D_strliteral_2e434)), ((u64)24UL));
+	t_item_2e430 = (u64)((u64)t_binding_2e428 + (u64)((u64)48UL));
+	BLIT(t_item_2e430, ((u64)((char *)&D_strliteral_2e436)), ((u64)24UL));
+	t_item_2e430 = (u64)((u64)t_binding_2e428 + (u64)((u64)72UL));
+	BLIT(t_item_2e430, ((u64)((char *)&D_strliteral_2e438)), ((u64)24UL));
+	t_item_2e430 = (u64)((u64)t_binding_2e428 + (u64)((u64)96UL));
+	BLIT(t_item_2e430, ((u64)((char *)&D_strliteral_2e440)), ((u64)24UL));
+	t_item_2e430 = (u64)((u64)t_binding_2e428 + (u64)((u64)120UL));
+	BLIT(t_item_2e430, ((u64)((char *)&D_strliteral_2e442)), ((u64)24UL));
+	*(u64 *)t_binding_2e448 = (u64)((u64)0UL);
+	L_loop_2e443:;
+	t__2e450 = (u64)(*(u64 *)t_binding_2e448);
+	t__2e449 = (u64)(u32)(((u64)t__2e450 < (u64)((u64)6UL)));
+	if ((u32)t__2e449) goto L_body_2e444; else goto L__2e446;
+	L_body_2e444:;
+	*(u32 *)t_object_2e455 = (u32)((u64)3532310079UL);
+	t__2e456 = (u64)((u64)t_object_2e455 + (u64)((u64)4UL));
+	*(u32 *)t__2e456 = (u32)((u64)3UL);
+	t__2e458 = (u64)(*(u64 *)t_binding_2e448);
+	t__2e457 = (u64)((u64)t__2e458 * (u64)((u64)24UL));
+	t__2e457 = (u64)((u64)t_binding_2e428 + (u64)t__2e457);
+	*(u64 *)t_object_2e459 = (u64)((u64)0UL);
+	t__2e460 = (u64)((u64)t_object_2e459 + (u64)((u64)8UL));
+	*(u64 *)t__2e460 = (u64)((u64)0UL);
+	t__2e460 = (u64)((u64)t__2e460 + (u64)((u64)8UL));
+	*(u64 *)t__2e460 = (u64)((u64)0UL);
+	BLIT((u64)B28, t_object_2e455, 8);
+	BLIT((u64)B29, t__2e457, 24);
+	BLIT((u64)B30, t_object_2e459, 24);
+	t__2e454 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R31, (u64)B28, (u64)B29, (u64)B30);
+	t_tag_2e461 = (u64)(*(u32 *)t__2e454);
+	t__2e469 = (u64)(u32)(((u32)t_tag_2e461 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e469) goto L_member_2e466; else goto L__2e468;
+	L__2e468:;
+	t__2e471 = (u64)(u32)(((u32)t_tag_2e461 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e471) goto L_member_2e467; else goto L__2e470;
+	L__2e470:;
+	goto L_matches_2e465;
+	L_member_2e466:;
+	goto L_matches_2e465;
+	L_member_2e467:;
+	goto L_matches_2e464;
+	L_matches_2e464:;
+	goto L__2e462;
+	L_matches_2e465:;
+	t_abortsite_2e412 = ((u64)2UL);
+	goto L_abort_2e413;
+	L__2e472:;
+	L__2e463:;
+	t_abortsite_2e412 = ((u64)3UL);
+	goto L_abort_2e420;
+	L__2e462:;
+	goto L__2e451;
+	L__2e473:;
+	L__2e451:;
+	L_after_2e447:;
+	t__2e474 = (u64)(*(u64 *)t_binding_2e448);
+	t__2e474 = (u64)((u64)t__2e474 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e448 = (u64)t__2e474;
+	goto L_loop_2e443;
+	L__2e446:;
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)0UL));
+	t_value_2e479 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e479, ((u64)((char *)&D_strliteral_2e481)), ((u64)24UL));
+	t_value_2e479 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e479, ((u64)((char *)&D_strliteral_2e483)), ((u64)24UL));
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)48UL));
+	t_value_2e484 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e484, ((u64)((char *)&D_strliteral_2e486)), ((u64)24UL));
+	t_value_2e484 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e484, ((u64)((char *)&D_strliteral_2e488)), ((u64)24UL));
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)96UL));
+	t_value_2e489 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e489, ((u64)((char *)&D_strliteral_2e491)), ((u64)24UL));
+	t_value_2e489 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e489, ((u64)((char *)&D_strliteral_2e493)), ((u64)24UL));
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)144UL));
+	t_value_2e494 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e494, ((u64)((char *)&D_strliteral_2e496)), ((u64)24UL));
+	t_value_2e494 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e494, ((u64)((char *)&D_strliteral_2e498)), ((u64)24UL));
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)192UL));
+	t_value_2e499 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e499, ((u64)((char *)&D_strliteral_2e501)), ((u64)24UL));
+	t_value_2e499 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e499, ((u64)((char *)&D_strliteral_2e503)), ((u64)24UL));
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)240UL));
+	t_value_2e504 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e504, ((u64)((char *)&D_strliteral_2e506)), ((u64)24UL));
+	t_value_2e504 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e504, ((u64)((char *)&D_strliteral_2e508)), ((u64)24UL));
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)288UL));
+	t_value_2e509 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e509, ((u64)((char *)&D_strliteral_2e511)), ((u64)24UL));
+	t_value_2e509 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e509, ((u64)((char *)&D_strliteral_2e513)), ((u64)24UL));
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)336UL));
+	t_value_2e514 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e514, ((u64)((char *)&D_strliteral_2e516)), ((u64)24UL));
+	t_value_2e514 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e514, ((u64)((char *)&D_strliteral_2e518)), ((u64)24UL));
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)384UL));
+	t_value_2e519 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e519, ((u64)((char *)&D_strliteral_2e521)), ((u64)24UL));
+	t_value_2e519 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e519, ((u64)((char *)&D_strliteral_2e523)), ((u64)24UL));
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)432UL));
+	t_value_2e524 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e524, ((u64)((char *)&D_strliteral_2e526)), ((u64)24UL));
+	t_value_2e524 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e524, ((u64)((char *)&D_strliteral_2e483)), ((u64)24UL));
+	t_item_2e478 = (u64)((u64)t_binding_2e475 + (u64)((u64)480UL));
+	t_value_2e527 = (u64)((u64)t_item_2e478 + (u64)((u64)0UL));
+	BLIT(t_value_2e527, ((u64)((char *)&D_strliteral_2e529)), ((u64)24UL));
+	t_value_2e527 = (u64)((u64)t_item_2e478 + (u64)((u64)24UL));
+	BLIT(t_value_2e527, ((u64)((char *)&D_strliteral_2e531)), ((u64)24UL));
+	t_item_2e535 = (u64)((u64)t_binding_2e532 + (u64)((u64)0UL));
+	t_value_2e536 = (u64)((u64)t_item_2e535 + (u64)((u64)0UL));
+	BLIT(t_value_2e536, ((u64)((char *)&D_strliteral_2e538)), ((u64)24UL));
+	t_value_2e536 = (u64)((u64)t_item_2e535 + (u64)((u64)24UL));
+	BLIT(t_value_2e536, ((u64)((char *)&D_strliteral_2e540)), ((u64)24UL));
+	t_value_2e536 = (u64)((u64)t_item_2e535 + (u64)((u64)48UL));
+	BLIT(t_value_2e536, ((u64)((char *)&D_strliteral_2e541)), ((u64)24UL));
+	t_item_2e535 = (u64)((u64)t_binding_2e532 + (u64)((u64)72UL));
+	t_value_2e542 = (u64)((u64)t_item_2e535 + (u64)((u64)0UL));
+	BLIT(t_value_2e542, ((u64)((char *)&D_strliteral_2e544)), ((u64)24UL));
+	t_value_2e542 = (u64)((u64)t_item_2e535 + (u64)((u64)24UL));
+	BLIT(t_value_2e542, ((u64)((char *)&D_strliteral_2e546)), ((u64)24UL));
+	t_value_2e542 = (u64)((u64)t_item_2e535 + (u64)((u64)48UL));
+	BLIT(t_value_2e542, ((u64)((char *)&D_strliteral_2e541)), ((u64)24UL));
+	t_item_2e535 = (u64)((u64)t_binding_2e532 + (u64)((u64)144UL));
+	t_value_2e547 = (u64)((u64)t_item_2e535 + (u64)((u64)0UL));
+	BLIT(t_value_2e547, ((u64)((char *)&D_strliteral_2e549)), ((u64)24UL));
+	t_value_2e547 = (u64)((u64)t_item_2e535 + (u64)((u64)24UL));
+	BLIT(t_value_2e547, ((u64)((char *)&D_strliteral_2e551)), ((u64)24UL));
+	t_value_2e547 = (u64)((u64)t_item_2e535 + (u64)((u64)48UL));
+	BLIT(t_value_2e547, ((u64)((char *)&D_strliteral_2e540)), ((u64)24UL));
+	t_item_2e535 = (u64)((u64)t_binding_2e532 + (u64)((u64)216UL));
+	t_value_2e552 = (u64)((u64)t_item_2e535 + (u64)((u64)0UL));
+	BLIT(t_value_2e552, ((u64)((char *)&D_strliteral_2e554)), ((u64)24UL));
+	t_value_2e552 = (u64)((u64)t_item_2e535 + (u64)((u64)24UL));
+	BLIT(t_value_2e552, ((u64)((char *)&D_strliteral_2e540)), ((u64)24UL));
+	t_value_2e552 = (u64)((u64)t_item_2e535 + (u64)((u64)48UL));
+	BLIT(t_value_2e552, ((u64)((char *)&D_strliteral_2e541)), ((u64)24UL));
+	t_item_2e535 = (u64)((u64)t_binding_2e532 + (u64)((u64)288UL));
+	t_value_2e555 = (u64)((u64)t_item_2e535 + (u64)((u64)0UL));
+	BLIT(t_value_2e555, ((u64)((char *)&D_strliteral_2e557)), ((u64)24UL));
+	t_value_2e555 = (u64)((u64)t_item_2e535 + (u64)((u64)24UL));
+	BLIT(t_value_2e555, ((u64)((char *)&D_strliteral_2e541)), ((u64)24UL));
+	t_value_2e555 = (u64)((u64)t_item_2e535 + (u64)((u64)48UL));
+	BLIT(t_value_2e555, ((u64)((char *)&D_strliteral_2e540)), ((u64)24UL));
+	t_item_2e535 = (u64)((u64)t_binding_2e532 + (u64)((u64)360UL));
+	t_value_2e558 = (u64)((u64)t_item_2e535 + (u64)((u64)0UL));
+	BLIT(t_value_2e558, ((u64)((char *)&D_strliteral_2e560)), ((u64)24UL));
+	t_value_2e558 = (u64)((u64)t_item_2e535 + (u64)((u64)24UL));
+	BLIT(t_value_2e558, ((u64)((char *)&D_strliteral_2e551)), ((u64)24UL));
+	t_value_2e558 = (u64)((u64)t_item_2e535 + (u64)((u64)48UL));
+	BLIT(t_value_2e558, ((u64)((char *)&D_strliteral_2e540)), ((u64)24UL));
+	t_item_2e535 = (u64)((u64)t_binding_2e532 + (u64)((u64)432UL));
+	t_value_2e561 = (u64)((u64)t_item_2e535 + (u64)((u64)0UL));
+	BLIT(t_value_2e561, ((u64)((char *)&D_strliteral_2e563)), ((u64)24UL));
+	t_value_2e561 = (u64)((u64)t_item_2e535 + (u64)((u64)24UL));
+	BLIT(t_value_2e561, ((u64)((char *)&D_strliteral_2e541)), ((u64)24UL));
+	t_value_2e561 = (u64)((u64)t_item_2e535 + (u64)((u64)48UL));
+	BLIT(t_value_2e561, ((u64)((char *)&D_strliteral_2e540)), ((u64)24UL));
+	t_item_2e566 = (u64)((u64)t_binding_2e564 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e566 = (u8)((u64)0UL);
+	t__2e567 = (u64)((u64)t_binding_2e564 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e567, (u64)t_item_2e566, (u64)((u64)255UL));
+	t_item_2e569 = (u64)((u64)t_binding_2e564 + (u64)((u64)0UL));
+	t__2e568 = (u64)((u64)t_binding_2e564 + (u64)((u64)1UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e568, (u64)t_item_2e569, (u64)((u64)255UL));
+	*(u64 *)t_binding_2e575 = (u64)((u64)0UL);
+	L_loop_2e570:;
+	t__2e577 = (u64)(*(u64 *)t_binding_2e575);
+	t__2e576 = (u64)(u32)(((u64)t__2e577 < (u64)((u64)11UL)));
+	if ((u32)t__2e576) goto L_body_2e571; else goto L__2e573;
+	L_body_2e571:;
+	*(u64 *)t_binding_2e585 = (u64)((u64)0UL);
+	L_loop_2e580:;
+	t__2e587 = (u64)(*(u64 *)t_binding_2e585);
+	t__2e586 = (u64)(u32)(((u64)t__2e587 < (u64)((u64)7UL)));
+	if ((u32)t__2e586) goto L_body_2e581; else goto L__2e583;
+	L_body_2e581:;
+	t__2e592 = (u64)(*(u64 *)t_binding_2e575);
+	t__2e591 = (u64)((u64)t__2e592 * (u64)((u64)48UL));
+	t__2e591 = (u64)((u64)t_binding_2e475 + (u64)t__2e591);
+	BLIT(t_binding_2e590, t__2e591, ((u64)48UL));
+	t__2e596 = (u64)(*(u64 *)t_binding_2e585);
+	t__2e595 = (u64)((u64)t__2e596 * (u64)((u64)72UL));
+	t__2e595 = (u64)((u64)t_binding_2e532 + (u64)t__2e595);
+	BLIT(t_binding_2e594, t__2e595, ((u64)72UL));
+	t__2e599 = t_binding_2e564;
+	t__2e600 = (u64)((i64)(i32)((u64)0UL));
+	t__2e601 = (u64)((u64)t__2e600 - (u64)((u64)0UL));
+	t__2e605 = (u64)(u32)(((u64)t__2e600 <= (u64)((u64)256UL)));
+	t__2e601 = t__2e600;
+	t__2e602 = ((u64)256UL);
+	if ((u32)t__2e605) goto L__2e607; else goto L__2e606;
+	L__2e606:;
+	t_abortsite_2e412 = ((u64)4UL);
+	goto L_abort_2e608;
+	L__2e607:;
+	t_data_2e614 = (u64)((u64)((u64)0UL) * (u64)((u64)1UL));
+	t_data_2e614 = (u64)((u64)t__2e599 + (u64)t_data_2e614);
+	*(u64 *)t_binding_2e598 = (u64)t_data_2e614;
+	t__2e616 = (u64)((u64)t_binding_2e598 + (u64)((u64)8UL));
+	*(u64 *)t__2e616 = (u64)t__2e601;
+	t__2e616 = (u64)((u64)t_binding_2e598 + (u64)((u64)16UL));
+	*(u64 *)t__2e616 = (u64)t__2e602;
+	t__2e617 = (u64)((u64)t_binding_2e598 + (u64)((u64)8UL));
+	t__2e618 = (u64)((u64)t_binding_2e598 + (u64)((u64)16UL));
+	t__2e619 = (u64)(*(u64 *)t__2e617);
+	BLIT((u64)B32, ((u64)((char *)&D_strliteral_2e622)), 24);
+	t__2e620 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R33, (u64)B32);
+	t__2e624 = (u64)((u64)t__2e620 + (u64)((u64)8UL));
+	t__2e623 = (u64)(*(u64 *)t__2e624);
+	t__2e625 = (u64)((u64)t__2e619 + (u64)t__2e623);
+	*(u64 *)t__2e617 = (u64)t__2e625;
+	t__2e627 = (u64)(*(u64 *)t__2e618);
+	t__2e630 = (u64)(u32)(((u64)t__2e625 <= (u64)t__2e627));
+	if ((u32)t__2e630) goto L__2e628; else goto L__2e629;
+	L__2e629:;
+	t_abortsite_2e412 = ((u64)5UL);
+	goto L_abort_2e608;
+	L__2e628:;
+	t__2e631 = (u64)(*(u64 *)t_binding_2e598);
+	t__2e626 = (u64)((u64)t__2e619 * (u64)((u64)1UL));
+	t__2e626 = (u64)((u64)t__2e631 + (u64)t__2e626);
+	t__2e632 = (u64)((u64)t__2e623 * (u64)((u64)1UL));
+	t__2e633 = (u64)(*(u64 *)t__2e620);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e626, (u64)t__2e633, (u64)t__2e632);
+	t__2e634 = (u64)((u64)t_binding_2e598 + (u64)((u64)8UL));
+	t__2e635 = (u64)((u64)t_binding_2e598 + (u64)((u64)16UL));
+	t__2e636 = (u64)(*(u64 *)t__2e634);
+	t_value_2e638 = (u64)((u64)t_binding_2e594 + (u64)((u64)0UL));
+	BLIT((u64)B34, t_value_2e638, 24);
+	t__2e637 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R35, (u64)B34);
+	t__2e640 = (u64)((u64)t__2e637 + (u64)((u64)8UL));
+	t__2e639 = (u64)(*(u64 *)t__2e640);
+	t__2e641 = (u64)((u64)t__2e636 + (u64)t__2e639);
+	*(u64 *)t__2e634 = (u64)t__2e641;
+	t__2e643 = (u64)(*(u64 *)t__2e635);
+	t__2e646 = (u64)(u32)(((u64)t__2e641 <= (u64)t__2e643));
+	if ((u32)t__2e646) goto L__2e644; else goto L__2e645;
+	L__2e645:;
+	t_abortsite_2e412 = ((u64)6UL);
+	goto L_abort_2e608;
+	L__2e644:;
+	t__2e647 = (u64)(*(u64 *)t_binding_2e598);
+	t__2e642 = (u64)((u64)t__2e636 * (u64)((u64)1UL));
+	t__2e642 = (u64)((u64)t__2e647 + (u64)t__2e642);
+	t__2e648 = (u64)((u64)t__2e639 * (u64)((u64)1UL));
+	t__2e649 = (u64)(*(u64 *)t__2e637);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e642, (u64)t__2e649, (u64)t__2e648);
+	t_value_2e655 = (u64)((u64)t_binding_2e594 + (u64)((u64)24UL));
+	BLIT((u64)B36, t_value_2e655, 24);
+	BLIT((u64)B37, ((u64)((char *)&D_strliteral_2e541)), 24);
+	t__2e654 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B36, (u64)B37));
+	t__2e654 = (u64)(u32)((u32)t__2e654 ^ (u32)((u64)1UL));
+	t__2e656 = (u64)(u32)((u8)t__2e654);
+	if ((u32)t__2e656) goto L_true_2e651; else goto L_false_2e652;
+	L_true_2e651:;
+	t__2e659 = (u64)((u64)t_binding_2e598 + (u64)((u64)8UL));
+	t__2e660 = (u64)((u64)t_binding_2e598 + (u64)((u64)16UL));
+	t__2e661 = (u64)(*(u64 *)t__2e659);
+	t_value_2e663 = (u64)((u64)t_binding_2e590 + (u64)((u64)0UL));
+	BLIT((u64)B38, t_value_2e663, 24);
+	t__2e662 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R39, (u64)B38);
+	t__2e665 = (u64)((u64)t__2e662 + (u64)((u64)8UL));
+	t__2e664 = (u64)(*(u64 *)t__2e665);
+	t__2e666 = (u64)((u64)t__2e661 + (u64)t__2e664);
+	*(u64 *)t__2e659 = (u64)t__2e666;
+	t__2e668 = (u64)(*(u64 *)t__2e660);
+	t__2e671 = (u64)(u32)(((u64)t__2e666 <= (u64)t__2e668));
+	if ((u32)t__2e671) goto L__2e669; else goto L__2e670;
+	L__2e670:;
+	t_abortsite_2e412 = ((u64)7UL);
+	goto L_abort_2e608;
+	L__2e669:;
+	t__2e672 = (u64)(*(u64 *)t_binding_2e598);
+	t__2e667 = (u64)((u64)t__2e661 * (u64)((u64)1UL));
+	t__2e667 = (u64)((u64)t__2e672 + (u64)t__2e667);
+	t__2e673 = (u64)((u64)t__2e664 * (u64)((u64)1UL));
+	t__2e674 = (u64)(*(u64 *)t__2e662);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e667, (u64)t__2e674, (u64)t__2e673);
+	t__2e675 = (u64)((u64)t_binding_2e598 + (u64)((u64)8UL));
+	t__2e676 = (u64)((u64)t_binding_2e598 + (u64)((u64)16UL));
+	t__2e677 = (u64)(*(u64 *)t__2e675);
+	t_value_2e679 = (u64)((u64)t_binding_2e594 + (u64)((u64)24UL));
+	BLIT((u64)B40, t_value_2e679, 24);
+	t__2e678 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R41, (u64)B40);
+	t__2e681 = (u64)((u64)t__2e678 + (u64)((u64)8UL));
+	t__2e680 = (u64)(*(u64 *)t__2e681);
+	t__2e682 = (u64)((u64)t__2e677 + (u64)t__2e680);
+	*(u64 *)t__2e675 = (u64)t__2e682;
+	t__2e684 = (u64)(*(u64 *)t__2e676);
+	t__2e687 = (u64)(u32)(((u64)t__2e682 <= (u64)t__2e684));
+	if ((u32)t__2e687) goto L__2e685; else goto L__2e686;
+	L__2e686:;
+	t_abortsite_2e412 = ((u64)8UL);
+	goto L_abort_2e608;
+	L__2e685:;
+	t__2e688 = (u64)(*(u64 *)t_binding_2e598);
+	t__2e683 = (u64)((u64)t__2e677 * (u64)((u64)1UL));
+	t__2e683 = (u64)((u64)t__2e688 + (u64)t__2e683);
+	t__2e689 = (u64)((u64)t__2e680 * (u64)((u64)1UL));
+	t__2e690 = (u64)(*(u64 *)t__2e678);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e683, (u64)t__2e690, (u64)t__2e689);
+	goto L__2e657;
+	L__2e691:;
+	L__2e657:;
+	goto L__2e653;
+	L_false_2e652:;
+	L__2e653:;
+	t_value_2e697 = (u64)((u64)t_binding_2e594 + (u64)((u64)48UL));
+	BLIT((u64)B42, t_value_2e697, 24);
+	BLIT((u64)B43, ((u64)((char *)&D_strliteral_2e541)), 24);
+	t__2e696 = (u64)(u32)(((u32 (*)(u64, u64))((u64)X_rt_2estrcmp))((u64)B42, (u64)B43));
+	t__2e696 = (u64)(u32)((u32)t__2e696 ^ (u32)((u64)1UL));
+	t__2e698 = (u64)(u32)((u8)t__2e696);
+	if ((u32)t__2e698) goto L_true_2e693; else goto L_false_2e694;
+	L_true_2e693:;
+	t__2e701 = (u64)((u64)t_binding_2e598 + (u64)((u64)8UL));
+	t__2e702 = (u64)((u64)t_binding_2e598 + (u64)((u64)16UL));
+	t__2e703 = (u64)(*(u64 *)t__2e701);
+	t_value_2e705 = (u64)((u64)t_binding_2e590 + (u64)((u64)24UL));
+	BLIT((u64)B44, t_value_2e705, 24);
+	t__2e704 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R45, (u64)B44);
+	t__2e707 = (u64)((u64)t__2e704 + (u64)((u64)8UL));
+	t__2e706 = (u64)(*(u64 *)t__2e707);
+	t__2e708 = (u64)((u64)t__2e703 + (u64)t__2e706);
+	*(u64 *)t__2e701 = (u64)t__2e708;
+	t__2e710 = (u64)(*(u64 *)t__2e702);
+	t__2e713 = (u64)(u32)(((u64)t__2e708 <= (u64)t__2e710));
+	if ((u32)t__2e713) goto L__2e711; else goto L__2e712;
+	L__2e712:;
+	t_abortsite_2e412 = ((u64)9UL);
+	goto L_abort_2e608;
+	L__2e711:;
+	t__2e714 = (u64)(*(u64 *)t_binding_2e598);
+	t__2e709 = (u64)((u64)t__2e703 * (u64)((u64)1UL));
+	t__2e709 = (u64)((u64)t__2e714 + (u64)t__2e709);
+	t__2e715 = (u64)((u64)t__2e706 * (u64)((u64)1UL));
+	t__2e716 = (u64)(*(u64 *)t__2e704);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e709, (u64)t__2e716, (u64)t__2e715);
+	t__2e717 = (u64)((u64)t_binding_2e598 + (u64)((u64)8UL));
+	t__2e718 = (u64)((u64)t_binding_2e598 + (u64)((u64)16UL));
+	t__2e719 = (u64)(*(u64 *)t__2e717);
+	t_value_2e721 = (u64)((u64)t_binding_2e594 + (u64)((u64)48UL));
+	BLIT((u64)B46, t_value_2e721, 24);
+	t__2e720 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R47, (u64)B46);
+	t__2e723 = (u64)((u64)t__2e720 + (u64)((u64)8UL));
+	t__2e722 = (u64)(*(u64 *)t__2e723);
+	t__2e724 = (u64)((u64)t__2e719 + (u64)t__2e722);
+	*(u64 *)t__2e717 = (u64)t__2e724;
+	t__2e726 = (u64)(*(u64 *)t__2e718);
+	t__2e729 = (u64)(u32)(((u64)t__2e724 <= (u64)t__2e726));
+	if ((u32)t__2e729) goto L__2e727; else goto L__2e728;
+	L__2e728:;
+	t_abortsite_2e412 = ((u64)10UL);
+	goto L_abort_2e608;
+	L__2e727:;
+	t__2e730 = (u64)(*(u64 *)t_binding_2e598);
+	t__2e725 = (u64)((u64)t__2e719 * (u64)((u64)1UL));
+	t__2e725 = (u64)((u64)t__2e730 + (u64)t__2e725);
+	t__2e731 = (u64)((u64)t__2e722 * (u64)((u64)1UL));
+	t__2e732 = (u64)(*(u64 *)t__2e720);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e725, (u64)t__2e732, (u64)t__2e731);
+	goto L__2e699;
+	L__2e733:;
+	L__2e699:;
+	goto L__2e695;
+	L_false_2e694:;
+	L__2e695:;
+	*(u32 *)t_object_2e736 = (u32)((u64)3532310079UL);
+	t__2e737 = (u64)((u64)t_object_2e736 + (u64)((u64)4UL));
+	*(u32 *)t__2e737 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e738 = (u64)((u64)0UL);
+	t__2e739 = (u64)((u64)t_object_2e738 + (u64)((u64)8UL));
+	*(u64 *)t__2e739 = (u64)((u64)0UL);
+	t__2e739 = (u64)((u64)t__2e739 + (u64)((u64)8UL));
+	*(u64 *)t__2e739 = (u64)((u64)0UL);
+	BLIT((u64)B48, t_object_2e736, 8);
+	BLIT((u64)B49, t_binding_2e598, 24);
+	BLIT((u64)B50, t_object_2e738, 24);
+	t__2e735 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R51, (u64)B48, (u64)B49, (u64)B50);
+	t_tag_2e740 = (u64)(*(u32 *)t__2e735);
+	t__2e748 = (u64)(u32)(((u32)t_tag_2e740 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e748) goto L_member_2e745; else goto L__2e747;
+	L__2e747:;
+	t__2e750 = (u64)(u32)(((u32)t_tag_2e740 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e750) goto L_member_2e746; else goto L__2e749;
+	L__2e749:;
+	goto L_matches_2e744;
+	L_member_2e745:;
+	goto L_matches_2e744;
+	L_member_2e746:;
+	goto L_matches_2e743;
+	L_matches_2e743:;
+	goto L__2e741;
+	L_matches_2e744:;
+	t_abortsite_2e412 = ((u64)11UL);
+	goto L_abort_2e413;
+	L__2e751:;
+	L__2e742:;
+	t_abortsite_2e412 = ((u64)12UL);
+	goto L_abort_2e420;
+	L__2e741:;
+	t__2e752 = (u64)((u64)t_binding_2e598 + (u64)((u64)8UL));
+	t__2e753 = (u64)((u64)t_binding_2e598 + (u64)((u64)16UL));
+	t__2e754 = (u64)(*(u64 *)t__2e752);
+	t__2e755 = (u64)((i64)(i32)((u64)0UL));
+	t__2e756 = (u64)(u32)(((u64)t__2e755 <= (u64)t__2e754));
+	if ((u32)t__2e756) goto L__2e758; else goto L__2e757;
+	L__2e757:;
+	t_abortsite_2e412 = ((u64)13UL);
+	goto L_abort_2e608;
+	L__2e758:;
+	BLIT((u64)B52, ((u64)((char *)&D_strliteral_2e761)), 24);
+	t__2e759 = ((u64 (*)(u64, u64))((u64)X_rt_2etoutf8))((u64)R53, (u64)B52);
+	t__2e763 = (u64)((u64)t__2e759 + (u64)((u64)8UL));
+	t__2e762 = (u64)(*(u64 *)t__2e763);
+	t__2e764 = (u64)((u64)t__2e754 + (u64)t__2e762);
+	*(u64 *)t__2e752 = (u64)t__2e764;
+	t__2e766 = (u64)(*(u64 *)t__2e753);
+	t__2e769 = (u64)(u32)(((u64)t__2e764 <= (u64)t__2e766));
+	if ((u32)t__2e769) goto L__2e767; else goto L__2e768;
+	L__2e768:;
+	t_abortsite_2e412 = ((u64)14UL);
+	goto L_abort_2e608;
+	L__2e767:;
+	t__2e770 = (u64)(*(u64 *)t_binding_2e598);
+	t__2e765 = (u64)((u64)t__2e755 * (u64)((u64)1UL));
+	t__2e765 = (u64)((u64)t__2e770 + (u64)t__2e765);
+	t__2e771 = (u64)((u64)t__2e762 * (u64)((u64)1UL));
+	t__2e773 = (u64)((u64)t__2e754 - (u64)t__2e755);
+	t__2e773 = (u64)((u64)t__2e773 * (u64)((u64)1UL));
+	t__2e772 = (u64)((u64)t__2e765 + (u64)t__2e771);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e772, (u64)t__2e765, (u64)t__2e773);
+	t__2e774 = (u64)(*(u64 *)t__2e759);
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememmove))((u64)t__2e765, (u64)t__2e774, (u64)t__2e771);
+	*(u32 *)t_object_2e777 = (u32)((u64)3532310079UL);
+	t__2e778 = (u64)((u64)t_object_2e777 + (u64)((u64)4UL));
+	*(u32 *)t__2e778 = (u32)((u64)0UL);
+	*(u64 *)t_object_2e779 = (u64)((u64)0UL);
+	t__2e780 = (u64)((u64)t_object_2e779 + (u64)((u64)8UL));
+	*(u64 *)t__2e780 = (u64)((u64)0UL);
+	t__2e780 = (u64)((u64)t__2e780 + (u64)((u64)8UL));
+	*(u64 *)t__2e780 = (u64)((u64)0UL);
+	BLIT((u64)B54, t_object_2e777, 8);
+	BLIT((u64)B55, t_binding_2e598, 24);
+	BLIT((u64)B56, t_object_2e779, 24);
+	t__2e776 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R57, (u64)B54, (u64)B55, (u64)B56);
+	t_tag_2e781 = (u64)(*(u32 *)t__2e776);
+	t__2e789 = (u64)(u32)(((u32)t_tag_2e781 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e789) goto L_member_2e786; else goto L__2e788;
+	L__2e788:;
+	t__2e791 = (u64)(u32)(((u32)t_tag_2e781 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e791) goto L_member_2e787; else goto L__2e790;
+	L__2e790:;
+	goto L_matches_2e785;
+	L_member_2e786:;
+	goto L_matches_2e785;
+	L_member_2e787:;
+	goto L_matches_2e784;
+	L_matches_2e784:;
+	goto L__2e782;
+	L_matches_2e785:;
+	t_abortsite_2e412 = ((u64)15UL);
+	goto L_abort_2e413;
+	L__2e792:;
+	L__2e783:;
+	t_abortsite_2e412 = ((u64)16UL);
+	goto L_abort_2e420;
+	L__2e782:;
+	goto L__2e588;
+	L__2e793:;
+	L__2e588:;
+	L_after_2e584:;
+	t__2e794 = (u64)(*(u64 *)t_binding_2e585);
+	t__2e794 = (u64)((u64)t__2e794 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e585 = (u64)t__2e794;
+	goto L_loop_2e580;
+	L__2e583:;
+	goto L__2e578;
+	L__2e795:;
+	L__2e578:;
+	L_after_2e574:;
+	t__2e796 = (u64)(*(u64 *)t_binding_2e575);
+	t__2e796 = (u64)((u64)t__2e796 + (u64)((u64)1UL));
+	*(u64 *)t_binding_2e575 = (u64)t__2e796;
+	goto L_loop_2e570;
+	L__2e573:;
+	*(u32 *)t_object_2e799 = (u32)((u64)3532310079UL);
+	t__2e800 = (u64)((u64)t_object_2e799 + (u64)((u64)4UL));
+	*(u32 *)t__2e800 = (u32)((u64)0UL);
+	*(u64 *)t_object_2e803 = (u64)((u64)0UL);
+	t__2e804 = (u64)((u64)t_object_2e803 + (u64)((u64)8UL));
+	*(u64 *)t__2e804 = (u64)((u64)0UL);
+	t__2e804 = (u64)((u64)t__2e804 + (u64)((u64)8UL));
+	*(u64 *)t__2e804 = (u64)((u64)0UL);
+	BLIT((u64)B58, t_object_2e799, 8);
+	BLIT((u64)B59, ((u64)((char *)&D_strliteral_2e802)), 24);
+	BLIT((u64)B60, t_object_2e803, 24);
+	t__2e798 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R61, (u64)B58, (u64)B59, (u64)B60);
+	t_tag_2e805 = (u64)(*(u32 *)t__2e798);
+	t__2e813 = (u64)(u32)(((u32)t_tag_2e805 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e813) goto L_member_2e810; else goto L__2e812;
+	L__2e812:;
+	t__2e815 = (u64)(u32)(((u32)t_tag_2e805 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e815) goto L_member_2e811; else goto L__2e814;
+	L__2e814:;
+	goto L_matches_2e809;
+	L_member_2e810:;
+	goto L_matches_2e809;
+	L_member_2e811:;
+	goto L_matches_2e808;
+	L_matches_2e808:;
+	goto L__2e806;
+	L_matches_2e809:;
+	t_abortsite_2e412 = ((u64)17UL);
+	goto L_abort_2e413;
+	L__2e816:;
+	L__2e807:;
+	t_abortsite_2e412 = ((u64)18UL);
+	goto L_abort_2e420;
+	L__2e806:;
+	*(u32 *)t_object_2e819 = (u32)((u64)3532310079UL);
+	t__2e820 = (u64)((u64)t_object_2e819 + (u64)((u64)4UL));
+	*(u32 *)t__2e820 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e823 = (u64)((u64)0UL);
+	t__2e824 = (u64)((u64)t_object_2e823 + (u64)((u64)8UL));
+	*(u64 *)t__2e824 = (u64)((u64)0UL);
+	t__2e824 = (u64)((u64)t__2e824 + (u64)((u64)8UL));
+	*(u64 *)t__2e824 = (u64)((u64)0UL);
+	BLIT((u64)B62, t_object_2e819, 8);
+	BLIT((u64)B63, ((u64)((char *)&D_strliteral_2e822)), 24);
+	BLIT((u64)B64, t_object_2e823, 24);
+	t__2e818 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R65, (u64)B62, (u64)B63, (u64)B64);
+	t_tag_2e825 = (u64)(*(u32 *)t__2e818);
+	t__2e833 = (u64)(u32)(((u32)t_tag_2e825 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e833) goto L_member_2e830; else goto L__2e832;
+	L__2e832:;
+	t__2e835 = (u64)(u32)(((u32)t_tag_2e825 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e835) goto L_member_2e831; else goto L__2e834;
+	L__2e834:;
+	goto L_matches_2e829;
+	L_member_2e830:;
+	goto L_matches_2e829;
+	L_member_2e831:;
+	goto L_matches_2e828;
+	L_matches_2e828:;
+	goto L__2e826;
+	L_matches_2e829:;
+	t_abortsite_2e412 = ((u64)19UL);
+	goto L_abort_2e413;
+	L__2e836:;
+	L__2e827:;
+	t_abortsite_2e412 = ((u64)20UL);
+	goto L_abort_2e420;
+	L__2e826:;
+	goto L__2e319;
+	L__2e837:;
+	L__2e319:;
+	return;
+	L_abort_2e413:;
+	t__2e414 = (u64)((u64)t_abortsite_2e412 * (u64)((u64)16UL));
+	t__2e414 = (u64)((u64)((u64)((char *)&D_abortsites_2e411)) + (u64)t__2e414);
+	t__2e415 = (u64)(*(u64 *)t__2e414);
+	t__2e416 = (u64)((u64)t__2e414 + (u64)((u64)8UL));
+	t__2e417 = (u64)(*(u32 *)t__2e416);
+	t__2e416 = (u64)((u64)t__2e414 + (u64)((u64)12UL));
+	t__2e418 = (u64)(*(u32 *)t__2e416);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e415, (u64)t__2e417, (u64)t__2e418, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e420:;
+	t__2e421 = (u64)((u64)t_abortsite_2e412 * (u64)((u64)16UL));
+	t__2e421 = (u64)((u64)((u64)((char *)&D_abortsites_2e411)) + (u64)t__2e421);
+	t__2e422 = (u64)(*(u64 *)t__2e421);
+	t__2e423 = (u64)((u64)t__2e421 + (u64)((u64)8UL));
+	t__2e424 = (u64)(*(u32 *)t__2e423);
+	t__2e423 = (u64)((u64)t__2e421 + (u64)((u64)12UL));
+	t__2e425 = (u64)(*(u32 *)t__2e423);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e422, (u64)t__2e424, (u64)t__2e425, (u64)((u64)4UL));
+	__builtin_trap();
+	L_abort_2e608:;
+	t__2e609 = (u64)((u64)t_abortsite_2e412 * (u64)((u64)16UL));
+	t__2e609 = (u64)((u64)((u64)((char *)&D_abortsites_2e411)) + (u64)t__2e609);
+	t__2e610 = (u64)(*(u64 *)t__2e609);
+	t__2e611 = (u64)((u64)t__2e609 + (u64)((u64)8UL));
+	t__2e612 = (u64)(*(u32 *)t__2e611);
+	t__2e611 = (u64)((u64)t__2e609 + (u64)((u64)12UL));
+	t__2e613 = (u64)(*(u32 *)t__2e611);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e610, (u64)t__2e612, (u64)t__2e613, (u64)((u64)0UL));
+	__builtin_trap();
+}
+static void F_sz(void) {
+	L_start_2e838:;
+	L_body_2e839:;
+	goto L__2e840;
+	L__2e842:;
+	L__2e840:;
+	return;
+}
+static void F_local__constants(void) {
+	char A0[16] __attribute__((aligned(16)));
+	char A1[32] __attribute__((aligned(16)));
+	char A2[8] __attribute__((aligned(16)));
+	char A3[24] __attribute__((aligned(16)));
+	char A4[8] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[24] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[24] __attribute__((aligned(16)));
+	char A15[8] __attribute__((aligned(16)));
+	char A16[24] __attribute__((aligned(16)));
+	char B17[8] __attribute__((aligned(16)));
+	char B18[24] __attribute__((aligned(16)));
+	char B19[24] __attribute__((aligned(16)));
+	char R20[4] __attribute__((aligned(16)));
+	char B21[8] __attribute__((aligned(16)));
+	char B22[24] __attribute__((aligned(16)));
+	char B23[24] __attribute__((aligned(16)));
+	char R24[4] __attribute__((aligned(16)));
+	char B25[8] __attribute__((aligned(16)));
+	char B26[24] __attribute__((aligned(16)));
+	char B27[24] __attribute__((aligned(16)));
+	char R28[4] __attribute__((aligned(16)));
+	char B29[8] __attribute__((aligned(16)));
+	char B30[24] __attribute__((aligned(16)));
+	char B31[24] __attribute__((aligned(16)));
+	char R32[4] __attribute__((aligned(16)));
+	char B33[8] __attribute__((aligned(16)));
+	char B34[24] __attribute__((aligned(16)));
+	char B35[24] __attribute__((aligned(16)));
+	char R36[4] __attribute__((aligned(16)));
+	char B37[8] __attribute__((aligned(16)));
+	char B38[24] __attribute__((aligned(16)));
+	char B39[24] __attribute__((aligned(16)));
+	char R40[4] __attribute__((aligned(16)));
+	char B41[8] __attribute__((aligned(16)));
+	char B42[24] __attribute__((aligned(16)));
+	char B43[24] __attribute__((aligned(16)));
+	char R44[4] __attribute__((aligned(16)));
+	u64 t__2e1002;
+	u64 t__2e1004;
+	u64 t__2e1007;
+	u64 t__2e1009;
+	u64 t__2e1018;
+	u64 t__2e1027;
+	u64 t__2e1029;
+	u64 t__2e1032;
+	u64 t__2e1034;
+	u64 t__2e1038;
+	u64 t__2e1047;
+	u64 t__2e1049;
+	u64 t__2e852;
+	u64 t__2e855;
+	u64 t__2e856;
+	u64 t__2e857;
+	u64 t__2e861;
+	u64 t__2e862;
+	u64 t__2e863;
+	u64 t__2e864;
+	u64 t__2e865;
+	u64 t__2e870;
+	u64 t__2e871;
+	u64 t__2e873;
+	u64 t__2e877;
+	u64 t__2e882;
+	u64 t__2e884;
+	u64 t__2e886;
+	u64 t__2e889;
+	u64 t__2e892;
+	u64 t__2e893;
+	u64 t__2e895;
+	u64 t__2e897;
+	u64 t__2e901;
+	u64 t__2e910;
+	u64 t__2e912;
+	u64 t__2e914;
+	u64 t__2e915;
+	u64 t__2e916;
+	u64 t__2e917;
+	u64 t__2e918;
+	u64 t__2e921;
+	u64 t__2e922;
+	u64 t__2e923;
+	u64 t__2e924;
+	u64 t__2e925;
+	u64 t__2e927;
+	u64 t__2e929;
+	u64 t__2e933;
+	u64 t__2e942;
+	u64 t__2e944;
+	u64 t__2e947;
+	u64 t__2e949;
+	u64 t__2e953;
+	u64 t__2e962;
+	u64 t__2e964;
+	u64 t__2e967;
+	u64 t__2e969;
+	u64 t__2e973;
+	u64 t__2e982;
+	u64 t__2e984;
+	u64 t__2e987;
+	u64 t__2e989;
+	u64 t__2e993;
+	u64 t_abortsite_2e859;
+	u64 t_binding_2e866;
+	u64 t_binding_2e878;
+	u64 t_item_2e1015;
+	u64 t_item_2e869;
+	u64 t_item_2e872;
+	u64 t_item_2e881;
+	u64 t_item_2e885;
+	u64 t_object_2e1008;
+	u64 t_object_2e1012;
+	u64 t_object_2e1013;
+	u64 t_object_2e1033;
+	u64 t_object_2e1037;
+	u64 t_object_2e896;
+	u64 t_object_2e900;
+	u64 t_object_2e928;
+	u64 t_object_2e932;
+	u64 t_object_2e948;
+	u64 t_object_2e952;
+	u64 t_object_2e968;
+	u64 t_object_2e972;
+	u64 t_object_2e988;
+	u64 t_object_2e992;
+	u64 t_tag_2e1019;
+	u64 t_tag_2e1039;
+	u64 t_tag_2e902;
+	u64 t_tag_2e934;
+	u64 t_tag_2e954;
+	u64 t_tag_2e974;
+	u64 t_tag_2e994;
+	L_start_2e843:;
+	t_binding_2e866 = (u64)A0;
+	t_binding_2e878 = (u64)A1;
+	t_object_2e896 = (u64)A2;
+	t_object_2e900 = (u64)A3;
+	t_object_2e928 = (u64)A4;
+	t_object_2e932 = (u64)A5;
+	t_object_2e948 = (u64)A6;
+	t_object_2e952 = (u64)A7;
+	t_object_2e968 = (u64)A8;
+	t_object_2e972 = (u64)A9;
+	t_object_2e988 = (u64)A10;
+	t_object_2e992 = (u64)A11;
+	t_object_2e1008 = (u64)A12;
+	t_object_2e1012 = (u64)A13;
+	t_object_2e1013 = (u64)A14;
+	t_object_2e1033 = (u64)A15;
+	t_object_2e1037 = (u64)A16;
+	L_body_2e844:;
+	goto L__2e847;
+	L__2e849:;
+	L__2e847:;
+	t__2e855 = (u64)(u32)(((u64)((u64)((char *)&D_static_2e0)) == (u64)((u64)((char *)&D_static_2e0))));
+	t__2e852 = (u64)(u32)t__2e855;
+	if ((u32)t__2e852) goto L__2e853; else goto L__2e854;
+	L__2e853:;
+	t__2e857 = (u64)(u32)(*(i32 *)((u64)((char *)&D_static_2e0)));
+	t__2e856 = (u64)(u32)(((u32)t__2e857 == (u32)((u64)0UL)));
+	t__2e852 = (u64)(u32)t__2e856;
+	goto L__2e854;
+	L__2e854:;
+	if ((u32)t__2e852) goto L_passed_2e851; else goto L_failed_2e850;
+	L_failed_2e850:;
+	t_abortsite_2e859 = ((u64)0UL);
+	goto L_abort_2e860;
+	L_passed_2e851:;
+	t_item_2e869 = (u64)((u64)t_binding_2e866 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e869 = (u32)((u64)0UL);
+	t__2e870 = (u64)((u64)t_binding_2e866 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e870, (u64)t_item_2e869, (u64)((u64)12UL));
+	t_item_2e872 = (u64)((u64)t_binding_2e866 + (u64)((u64)0UL));
+	t__2e873 = (u64)(u32)(*(i32 *)t_item_2e872);
+	t__2e871 = (u64)((u64)t_binding_2e866 + (u64)((u64)4UL));
+	*(u32 *)t__2e871 = (u32)t__2e873;
+	t__2e871 = (u64)((u64)t_binding_2e866 + (u64)((u64)8UL));
+	*(u32 *)t__2e871 = (u32)t__2e873;
+	t__2e871 = (u64)((u64)t_binding_2e866 + (u64)((u64)12UL));
+	*(u32 *)t__2e871 = (u32)t__2e873;
+	goto L__2e867;
+	L__2e874:;
+	L__2e867:;
+	t__2e877 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e877) goto L_passed_2e876; else goto L_failed_2e875;
+	L_failed_2e875:;
+	t_abortsite_2e859 = ((u64)1UL);
+	goto L_abort_2e860;
+	L_passed_2e876:;
+	t_item_2e881 = (u64)((u64)t_binding_2e878 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e881 = (u32)((u64)0UL);
+	t__2e882 = (u64)((u64)t_binding_2e878 + (u64)((u64)4UL));
+	((void (*)(u64, u64, u64))((u64)X_rt_2ememcpy))((u64)t__2e882, (u64)t_item_2e881, (u64)((u64)28UL));
+	goto L__2e879;
+	L__2e883:;
+	L__2e879:;
+	t_item_2e885 = (u64)((u64)t_binding_2e878 + (u64)((u64)0UL));
+	t__2e886 = (u64)(u32)(*(i32 *)t_item_2e885);
+	t__2e884 = (u64)((u64)t_binding_2e878 + (u64)((u64)4UL));
+	*(u32 *)t__2e884 = (u32)t__2e886;
+	t__2e884 = (u64)((u64)t_binding_2e878 + (u64)((u64)8UL));
+	*(u32 *)t__2e884 = (u32)t__2e886;
+	t__2e884 = (u64)((u64)t_binding_2e878 + (u64)((u64)12UL));
+	*(u32 *)t__2e884 = (u32)t__2e886;
+	t__2e884 = (u64)((u64)t_binding_2e878 + (u64)((u64)16UL));
+	*(u32 *)t__2e884 = (u32)t__2e886;
+	t__2e884 = (u64)((u64)t_binding_2e878 + (u64)((u64)20UL));
+	*(u32 *)t__2e884 = (u32)t__2e886;
+	t__2e884 = (u64)((u64)t_binding_2e878 + (u64)((u64)24UL));
+	*(u32 *)t__2e884 = (u32)t__2e886;
+	t__2e884 = (u64)((u64)t_binding_2e878 + (u64)((u64)28UL));
+	*(u32 *)t__2e884 = (u32)t__2e886;
+	t__2e892 = (u64)(u32)(((u64)((u64)8UL) == (u64)((u64)8UL)));
+	t__2e889 = (u64)(u32)t__2e892;
+	if ((u32)t__2e889) goto L__2e890; else goto L__2e891;
+	L__2e890:;
+	t__2e893 = (u64)(u32)(((u32)((u64)8UL) == (u32)((u64)8UL)));
+	t__2e889 = (u64)(u32)t__2e893;
+	goto L__2e891;
+	L__2e891:;
+	if ((u32)t__2e889) goto L_passed_2e888; else goto L_failed_2e887;
+	L_failed_2e887:;
+	t_abortsite_2e859 = ((u64)2UL);
+	goto L_abort_2e860;
+	L_passed_2e888:;
+	*(u32 *)t_object_2e896 = (u32)((u64)3532310079UL);
+	t__2e897 = (u64)((u64)t_object_2e896 + (u64)((u64)4UL));
+	*(u32 *)t__2e897 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e900 = (u64)((u64)0UL);
+	t__2e901 = (u64)((u64)t_object_2e900 + (u64)((u64)8UL));
+	*(u64 *)t__2e901 = (u64)((u64)0UL);
+	t__2e901 = (u64)((u64)t__2e901 + (u64)((u64)8UL));
+	*(u64 *)t__2e901 = (u64)((u64)0UL);
+	BLIT((u64)B17, t_object_2e896, 8);
+	BLIT((u64)B18, ((u64)((char *)&D_strliteral_2e899)), 24);
+	BLIT((u64)B19, t_object_2e900, 24);
+	t__2e895 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R20, (u64)B17, (u64)B18, (u64)B19);
+	t_tag_2e902 = (u64)(*(u32 *)t__2e895);
+	t__2e910 = (u64)(u32)(((u32)t_tag_2e902 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e910) goto L_member_2e907; else goto L__2e909;
+	L__2e909:;
+	t__2e912 = (u64)(u32)(((u32)t_tag_2e902 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e912) goto L_member_2e908; else goto L__2e911;
+	L__2e911:;
+	goto L_matches_2e906;
+	L_member_2e907:;
+	goto L_matches_2e906;
+	L_member_2e908:;
+	goto L_matches_2e905;
+	L_matches_2e905:;
+	goto L__2e903;
+	L_matches_2e906:;
+	t_abortsite_2e859 = ((u64)3UL);
+	goto L_abort_2e913;
+	L__2e919:;
+	L__2e904:;
+	t_abortsite_2e859 = ((u64)4UL);
+	goto L_abort_2e920;
+	L__2e903:;
+	*(u32 *)t_object_2e928 = (u32)((u64)3532310079UL);
+	t__2e929 = (u64)((u64)t_object_2e928 + (u64)((u64)4UL));
+	*(u32 *)t__2e929 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e932 = (u64)((u64)0UL);
+	t__2e933 = (u64)((u64)t_object_2e932 + (u64)((u64)8UL));
+	*(u64 *)t__2e933 = (u64)((u64)0UL);
+	t__2e933 = (u64)((u64)t__2e933 + (u64)((u64)8UL));
+	*(u64 *)t__2e933 = (u64)((u64)0UL);
+	BLIT((u64)B21, t_object_2e928, 8);
+	BLIT((u64)B22, ((u64)((char *)&D_strliteral_2e931)), 24);
+	BLIT((u64)B23, t_object_2e932, 24);
+	t__2e927 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R24, (u64)B21, (u64)B22, (u64)B23);
+	t_tag_2e934 = (u64)(*(u32 *)t__2e927);
+	t__2e942 = (u64)(u32)(((u32)t_tag_2e934 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e942) goto L_member_2e939; else goto L__2e941;
+	L__2e941:;
+	t__2e944 = (u64)(u32)(((u32)t_tag_2e934 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e944) goto L_member_2e940; else goto L__2e943;
+	L__2e943:;
+	goto L_matches_2e938;
+	L_member_2e939:;
+	goto L_matches_2e938;
+	L_member_2e940:;
+	goto L_matches_2e937;
+	L_matches_2e937:;
+	goto L__2e935;
+	L_matches_2e938:;
+	t_abortsite_2e859 = ((u64)5UL);
+	goto L_abort_2e913;
+	L__2e945:;
+	L__2e936:;
+	t_abortsite_2e859 = ((u64)6UL);
+	goto L_abort_2e920;
+	L__2e935:;
+	*(u32 *)t_object_2e948 = (u32)((u64)3532310079UL);
+	t__2e949 = (u64)((u64)t_object_2e948 + (u64)((u64)4UL));
+	*(u32 *)t__2e949 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e952 = (u64)((u64)0UL);
+	t__2e953 = (u64)((u64)t_object_2e952 + (u64)((u64)8UL));
+	*(u64 *)t__2e953 = (u64)((u64)0UL);
+	t__2e953 = (u64)((u64)t__2e953 + (u64)((u64)8UL));
+	*(u64 *)t__2e953 = (u64)((u64)0UL);
+	BLIT((u64)B25, t_object_2e948, 8);
+	BLIT((u64)B26, ((u64)((char *)&D_strliteral_2e951)), 24);
+	BLIT((u64)B27, t_object_2e952, 24);
+	t__2e947 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R28, (u64)B25, (u64)B26, (u64)B27);
+	t_tag_2e954 = (u64)(*(u32 *)t__2e947);
+	t__2e962 = (u64)(u32)(((u32)t_tag_2e954 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e962) goto L_member_2e959; else goto L__2e961;
+	L__2e961:;
+	t__2e964 = (u64)(u32)(((u32)t_tag_2e954 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e964) goto L_member_2e960; else goto L__2e963;
+	L__2e963:;
+	goto L_matches_2e958;
+	L_member_2e959:;
+	goto L_matches_2e958;
+	L_member_2e960:;
+	goto L_matches_2e957;
+	L_matches_2e957:;
+	goto L__2e955;
+	L_matches_2e958:;
+	t_abortsite_2e859 = ((u64)7UL);
+	goto L_abort_2e913;
+	L__2e965:;
+	L__2e956:;
+	t_abortsite_2e859 = ((u64)8UL);
+	goto L_abort_2e920;
+	L__2e955:;
+	*(u32 *)t_object_2e968 = (u32)((u64)3532310079UL);
+	t__2e969 = (u64)((u64)t_object_2e968 + (u64)((u64)4UL));
+	*(u32 *)t__2e969 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e972 = (u64)((u64)0UL);
+	t__2e973 = (u64)((u64)t_object_2e972 + (u64)((u64)8UL));
+	*(u64 *)t__2e973 = (u64)((u64)0UL);
+	t__2e973 = (u64)((u64)t__2e973 + (u64)((u64)8UL));
+	*(u64 *)t__2e973 = (u64)((u64)0UL);
+	BLIT((u64)B29, t_object_2e968, 8);
+	BLIT((u64)B30, ((u64)((char *)&D_strliteral_2e971)), 24);
+	BLIT((u64)B31, t_object_2e972, 24);
+	t__2e967 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R32, (u64)B29, (u64)B30, (u64)B31);
+	t_tag_2e974 = (u64)(*(u32 *)t__2e967);
+	t__2e982 = (u64)(u32)(((u32)t_tag_2e974 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e982) goto L_member_2e979; else goto L__2e981;
+	L__2e981:;
+	t__2e984 = (u64)(u32)(((u32)t_tag_2e974 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e984) goto L_member_2e980; else goto L__2e983;
+	L__2e983:;
+	goto L_matches_2e978;
+	L_member_2e979:;
+	goto L_matches_2e978;
+	L_member_2e980:;
+	goto L_matches_2e977;
+	L_matches_2e977:;
+	goto L__2e975;
+	L_matches_2e978:;
+	t_abortsite_2e859 = ((u64)9UL);
+	goto L_abort_2e913;
+	L__2e985:;
+	L__2e976:;
+	t_abortsite_2e859 = ((u64)10UL);
+	goto L_abort_2e920;
+	L__2e975:;
+	*(u32 *)t_object_2e988 = (u32)((u64)3532310079UL);
+	t__2e989 = (u64)((u64)t_object_2e988 + (u64)((u64)4UL));
+	*(u32 *)t__2e989 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e992 = (u64)((u64)0UL);
+	t__2e993 = (u64)((u64)t_object_2e992 + (u64)((u64)8UL));
+	*(u64 *)t__2e993 = (u64)((u64)0UL);
+	t__2e993 = (u64)((u64)t__2e993 + (u64)((u64)8UL));
+	*(u64 *)t__2e993 = (u64)((u64)0UL);
+	BLIT((u64)B33, t_object_2e988, 8);
+	BLIT((u64)B34, ((u64)((char *)&D_strliteral_2e991)), 24);
+	BLIT((u64)B35, t_object_2e992, 24);
+	t__2e987 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R36, (u64)B33, (u64)B34, (u64)B35);
+	t_tag_2e994 = (u64)(*(u32 *)t__2e987);
+	t__2e1002 = (u64)(u32)(((u32)t_tag_2e994 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1002) goto L_member_2e999; else goto L__2e1001;
+	L__2e1001:;
+	t__2e1004 = (u64)(u32)(((u32)t_tag_2e994 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1004) goto L_member_2e1000; else goto L__2e1003;
+	L__2e1003:;
+	goto L_matches_2e998;
+	L_member_2e999:;
+	goto L_matches_2e998;
+	L_member_2e1000:;
+	goto L_matches_2e997;
+	L_matches_2e997:;
+	goto L__2e995;
+	L_matches_2e998:;
+	t_abortsite_2e859 = ((u64)11UL);
+	goto L_abort_2e913;
+	L__2e1005:;
+	L__2e996:;
+	t_abortsite_2e859 = ((u64)12UL);
+	goto L_abort_2e920;
+	L__2e995:;
+	*(u32 *)t_object_2e1008 = (u32)((u64)3532310079UL);
+	t__2e1009 = (u64)((u64)t_object_2e1008 + (u64)((u64)4UL));
+	*(u32 *)t__2e1009 = (u32)((u64)0UL);
+	t_item_2e1015 = (u64)((u64)t_object_2e1013 + (u64)((u64)0UL));
+	BLIT(t_item_2e1015, ((u64)((char *)&D_strliteral_2e1017)), ((u64)24UL));
+	*(u64 *)t_object_2e1012 = (u64)t_object_2e1013;
+	t__2e1018 = (u64)((u64)t_object_2e1012 + (u64)((u64)8UL));
+	*(u64 *)t__2e1018 = (u64)((u64)1UL);
+	t__2e1018 = (u64)((u64)t__2e1018 + (u64)((u64)8UL));
+	*(u64 *)t__2e1018 = (u64)((u64)1UL);
+	BLIT((u64)B37, t_object_2e1008, 8);
+	BLIT((u64)B38, ((u64)((char *)&D_strliteral_2e1011)), 24);
+	BLIT((u64)B39, t_object_2e1012, 24);
+	t__2e1007 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R40, (u64)B37, (u64)B38, (u64)B39);
+	t_tag_2e1019 = (u64)(*(u32 *)t__2e1007);
+	t__2e1027 = (u64)(u32)(((u32)t_tag_2e1019 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1027) goto L_member_2e1024; else goto L__2e1026;
+	L__2e1026:;
+	t__2e1029 = (u64)(u32)(((u32)t_tag_2e1019 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1029) goto L_member_2e1025; else goto L__2e1028;
+	L__2e1028:;
+	goto L_matches_2e1023;
+	L_member_2e1024:;
+	goto L_matches_2e1023;
+	L_member_2e1025:;
+	goto L_matches_2e1022;
+	L_matches_2e1022:;
+	goto L__2e1020;
+	L_matches_2e1023:;
+	t_abortsite_2e859 = ((u64)13UL);
+	goto L_abort_2e913;
+	L__2e1030:;
+	L__2e1021:;
+	t_abortsite_2e859 = ((u64)14UL);
+	goto L_abort_2e920;
+	L__2e1020:;
+	*(u32 *)t_object_2e1033 = (u32)((u64)3532310079UL);
+	t__2e1034 = (u64)((u64)t_object_2e1033 + (u64)((u64)4UL));
+	*(u32 *)t__2e1034 = (u32)((u64)3UL);
+	*(u64 *)t_object_2e1037 = (u64)((u64)0UL);
+	t__2e1038 = (u64)((u64)t_object_2e1037 + (u64)((u64)8UL));
+	*(u64 *)t__2e1038 = (u64)((u64)0UL);
+	t__2e1038 = (u64)((u64)t__2e1038 + (u64)((u64)8UL));
+	*(u64 *)t__2e1038 = (u64)((u64)0UL);
+	BLIT((u64)B41, t_object_2e1033, 8);
+	BLIT((u64)B42, ((u64)((char *)&D_strliteral_2e1036)), 24);
+	BLIT((u64)B43, t_object_2e1037, 24);
+	t__2e1032 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R44, (u64)B41, (u64)B42, (u64)B43);
+	t_tag_2e1039 = (u64)(*(u32 *)t__2e1032);
+	t__2e1047 = (u64)(u32)(((u32)t_tag_2e1039 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e1047) goto L_member_2e1044; else goto L__2e1046;
+	L__2e1046:;
+	t__2e1049 = (u64)(u32)(((u32)t_tag_2e1039 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e1049) goto L_member_2e1045; else goto L__2e1048;
+	L__2e1048:;
+	goto L_matches_2e1043;
+	L_member_2e1044:;
+	goto L_matches_2e1043;
+	L_member_2e1045:;
+	goto L_matches_2e1042;
+	L_matches_2e1042:;
+	goto L__2e1040;
+	L_matches_2e1043:;
+	t_abortsite_2e859 = ((u64)15UL);
+	goto L_abort_2e913;
+	L__2e1050:;
+	L__2e1041:;
+	t_abortsite_2e859 = ((u64)16UL);
+	goto L_abort_2e920;
+	L__2e1040:;
+	goto L__2e845;
+	L__2e1051:;
+	L__2e845:;
+	return;
+	L_abort_2e860:;
+	t__2e861 = (u64)((u64)t_abortsite_2e859 * (u64)((u64)16UL));
+	t__2e861 = (u64)((u64)((u64)((char *)&D_abortsites_2e858)) + (u64)t__2e861);
+	t__2e862 = (u64)(*(u64 *)t__2e861);
+	t__2e863 = (u64)((u64)t__2e861 + (u64)((u64)8UL));
+	t__2e864 = (u64)(*(u32 *)t__2e863);
+	t__2e863 = (u64)((u64)t__2e861 + (u64)((u64)12UL));
+	t__2e865 = (u64)(*(u32 *)t__2e863);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e862, (u64)t__2e864, (u64)t__2e865, (u64)((u64)6UL));
+	__builtin_trap();
+	L_abort_2e913:;
+	t__2e914 = (u64)((u64)t_abortsite_2e859 * (u64)((u64)16UL));
+	t__2e914 = (u64)((u64)((u64)((char *)&D_abortsites_2e858)) + (u64)t__2e914);
+	t__2e915 = (u64)(*(u64 *)t__2e914);
+	t__2e916 = (u64)((u64)t__2e914 + (u64)((u64)8UL));
+	t__2e917 = (u64)(*(u32 *)t__2e916);
+	t__2e916 = (u64)((u64)t__2e914 + (u64)((u64)12UL));
+	t__2e918 = (u64)(*(u32 *)t__2e916);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e915, (u64)t__2e917, (u64)t__2e918, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e920:;
+	t__2e921 = (u64)((u64)t_abortsite_2e859 * (u64)((u64)16UL));
+	t__2e921 = (u64)((u64)((u64)((char *)&D_abortsites_2e858)) + (u64)t__2e921);
+	t__2e922 = (u64)(*(u64 *)t__2e921);
+	t__2e923 = (u64)((u64)t__2e921 + (u64)((u64)8UL));
+	t__2e924 = (u64)(*(u32 *)t__2e923);
+	t__2e923 = (u64)((u64)t__2e921 + (u64)((u64)12UL));
+	t__2e925 = (u64)(*(u32 *)t__2e923);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e922, (u64)t__2e924, (u64)t__2e925, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_constants(void) {
+	char A0[3] __attribute__((aligned(16)));
+	char A1[3] __attribute__((aligned(16)));
+	char A2[3] __attribute__((aligned(16)));
+	char A3[12] __attribute__((aligned(16)));
+	char A4[12] __attribute__((aligned(16)));
+	char A5[12] __attribute__((aligned(16)));
+	char A6[12] __attribute__((aligned(16)));
+	char A7[12] __attribute__((aligned(16)));
+	char A8[12] __attribute__((aligned(16)));
+	char A9[4] __attribute__((aligned(16)));
+	char A10[8] __attribute__((aligned(16)));
+	char A11[1] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[8] __attribute__((aligned(16)));
+	char A14[8] __attribute__((aligned(16)));
+	char A15[4] __attribute__((aligned(16)));
+	char A16[4] __attribute__((aligned(16)));
+	char A17[8] __attribute__((aligned(16)));
+	char A18[4] __attribute__((aligned(16)));
+	u64 t__2e1058;
+	u64 t__2e1061;
+	u64 t__2e1064;
+	u64 t__2e1068;
+	u64 t__2e1069;
+	u64 t__2e1070;
+	u64 t__2e1071;
+	u64 t__2e1072;
+	u64 t__2e1073;
+	u64 t__2e1076;
+	u64 t__2e1077;
+	u64 t__2e1078;
+	u64 t__2e1079;
+	u64 t__2e1080;
+	u64 t__2e1081;
+	u64 t__2e1084;
+	u64 t__2e1085;
+	u64 t__2e1086;
+	u64 t__2e1087;
+	u64 t__2e1088;
+	u64 t__2e1092;
+	u64 t__2e1093;
+	u64 t__2e1094;
+	u64 t__2e1095;
+	u64 t__2e1096;
+	u64 t__2e1099;
+	u64 t__2e1102;
+	u64 t__2e1103;
+	u64 t__2e1104;
+	u64 t__2e1105;
+	u64 t__2e1108;
+	u64 t__2e1111;
+	u64 t__2e1112;
+	u64 t__2e1115;
+	u64 t__2e1118;
+	u64 t__2e1121;
+	u64 t__2e1125;
+	u64 t__2e1126;
+	u64 t__2e1127;
+	u64 t__2e1128;
+	u64 t__2e1129;
+	u64 t__2e1132;
+	u64 t__2e1133;
+	u64 t__2e1134;
+	u64 t__2e1135;
+	u64 t__2e1138;
+	u64 t__2e1141;
+	u64 t__2e1144;
+	u64 t__2e1145;
+	u64 t__2e1146;
+	u64 t__2e1147;
+	u64 t__2e1150;
+	u64 t__2e1151;
+	u64 t__2e1152;
+	u64 t__2e1155;
+	u64 t__2e1158;
+	u64 t__2e1161;
+	u64 t__2e1162;
+	u64 t__2e1163;
+	u64 t__2e1164;
+	u64 t__2e1167;
+	u64 t__2e1168;
+	u64 t__2e1169;
+	u64 t__2e1173;
+	u64 t__2e1174;
+	u64 t__2e1179;
+	u64 t__2e1180;
+	u64 t__2e1181;
+	u64 t__2e1182;
+	u64 t__2e1186;
+	u64 t__2e1187;
+	u64 t__2e1191;
+	u64 t__2e1192;
+	u64 t__2e1197;
+	u64 t__2e1198;
+	u64 t__2e1202;
+	u64 t__2e1203;
+	u64 t__2e1208;
+	u64 t__2e1209;
+	u64 t__2e1212;
+	u64 t_abortsite_2e1090;
+	u64 t_binding_2e1170;
+	u64 t_binding_2e1175;
+	u64 t_binding_2e1176;
+	u64 t_binding_2e1183;
+	u64 t_binding_2e1188;
+	u64 t_binding_2e1193;
+	u64 t_binding_2e1194;
+	u64 t_binding_2e1199;
+	u64 t_binding_2e1204;
+	u64 t_binding_2e1205;
+	u64 t_item_2e1067;
+	u64 t_item_2e1075;
+	u64 t_item_2e1083;
+	u64 t_item_2e1124;
+	u64 t_item_2e1131;
+	u64 t_item_2e1143;
+	u64 t_item_2e1149;
+	u64 t_item_2e1160;
+	u64 t_item_2e1166;
+	u64 t_object_2e1065;
+	u64 t_object_2e1074;
+	u64 t_object_2e1082;
+	u64 t_object_2e1122;
+	u64 t_object_2e1130;
+	u64 t_object_2e1142;
+	u64 t_object_2e1148;
+	u64 t_object_2e1159;
+	u64 t_object_2e1165;
+	L_start_2e1052:;
+	t_object_2e1065 = (u64)A0;
+	t_object_2e1074 = (u64)A1;
+	t_object_2e1082 = (u64)A2;
+	t_object_2e1122 = (u64)A3;
+	t_object_2e1130 = (u64)A4;
+	t_object_2e1142 = (u64)A5;
+	t_object_2e1148 = (u64)A6;
+	t_object_2e1159 = (u64)A7;
+	t_object_2e1165 = (u64)A8;
+	t_binding_2e1170 = (u64)A9;
+	t_binding_2e1175 = (u64)A10;
+	t_binding_2e1176 = (u64)A11;
+	t_binding_2e1183 = (u64)A12;
+	t_binding_2e1188 = (u64)A13;
+	t_binding_2e1193 = (u64)A14;
+	t_binding_2e1194 = (u64)A15;
+	t_binding_2e1199 = (u64)A16;
+	t_binding_2e1204 = (u64)A17;
+	t_binding_2e1205 = (u64)A18;
+	L_body_2e1053:;
+	t_item_2e1067 = (u64)((u64)t_object_2e1065 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e1067 = (u8)((u64)1UL);
+	t_item_2e1067 = (u64)((u64)t_object_2e1065 + (u64)((u64)1UL));
+	*(u8 *)t_item_2e1067 = (u8)((u64)2UL);
+	t_item_2e1067 = (u64)((u64)t_object_2e1065 + (u64)((u64)2UL));
+	*(u8 *)t_item_2e1067 = (u8)((u64)3UL);
+	t__2e1069 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1068 = (u64)((u64)t__2e1069 * (u64)((u64)1UL));
+	t__2e1068 = (u64)((u64)t_object_2e1065 + (u64)t__2e1068);
+	t__2e1070 = (u64)(u32)(*(u8 *)t__2e1068);
+	t__2e1071 = (u64)(u32)((u8)t__2e1070);
+	t__2e1072 = (u64)(u32)((u8)((u64)1UL));
+	t__2e1064 = (u64)(u32)(((u32)t__2e1071 == (u32)t__2e1072));
+	t__2e1061 = (u64)(u32)t__2e1064;
+	if ((u32)t__2e1061) goto L__2e1062; else goto L__2e1063;
+	L__2e1062:;
+	t_item_2e1075 = (u64)((u64)t_object_2e1074 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e1075 = (u8)((u64)1UL);
+	t_item_2e1075 = (u64)((u64)t_object_2e1074 + (u64)((u64)1UL));
+	*(u8 *)t_item_2e1075 = (u8)((u64)2UL);
+	t_item_2e1075 = (u64)((u64)t_object_2e1074 + (u64)((u64)2UL));
+	*(u8 *)t_item_2e1075 = (u8)((u64)3UL);
+	t__2e1077 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1076 = (u64)((u64)t__2e1077 * (u64)((u64)1UL));
+	t__2e1076 = (u64)((u64)t_object_2e1074 + (u64)t__2e1076);
+	t__2e1078 = (u64)(u32)(*(u8 *)t__2e1076);
+	t__2e1079 = (u64)(u32)((u8)t__2e1078);
+	t__2e1080 = (u64)(u32)((u8)((u64)2UL));
+	t__2e1073 = (u64)(u32)(((u32)t__2e1079 == (u32)t__2e1080));
+	t__2e1061 = (u64)(u32)t__2e1073;
+	goto L__2e1063;
+	L__2e1063:;
+	t__2e1058 = (u64)(u32)t__2e1061;
+	if ((u32)t__2e1058) goto L__2e1059; else goto L__2e1060;
+	L__2e1059:;
+	t_item_2e1083 = (u64)((u64)t_object_2e1082 + (u64)((u64)0UL));
+	*(u8 *)t_item_2e1083 = (u8)((u64)1UL);
+	t_item_2e1083 = (u64)((u64)t_object_2e1082 + (u64)((u64)1UL));
+	*(u8 *)t_item_2e1083 = (u8)((u64)2UL);
+	t_item_2e1083 = (u64)((u64)t_object_2e1082 + (u64)((u64)2UL));
+	*(u8 *)t_item_2e1083 = (u8)((u64)3UL);
+	t__2e1085 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1084 = (u64)((u64)t__2e1085 * (u64)((u64)1UL));
+	t__2e1084 = (u64)((u64)t_object_2e1082 + (u64)t__2e1084);
+	t__2e1086 = (u64)(u32)(*(u8 *)t__2e1084);
+	t__2e1087 = (u64)(u32)((u8)t__2e1086);
+	t__2e1088 = (u64)(u32)((u8)((u64)3UL));
+	t__2e1081 = (u64)(u32)(((u32)t__2e1087 == (u32)t__2e1088));
+	t__2e1058 = (u64)(u32)t__2e1081;
+	goto L__2e1060;
+	L__2e1060:;
+	if ((u32)t__2e1058) goto L_passed_2e1057; else goto L_failed_2e1056;
+	L_failed_2e1056:;
+	t_abortsite_2e1090 = ((u64)0UL);
+	goto L_abort_2e1091;
+	L_passed_2e1057:;
+	t__2e1103 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e1102 = (u64)(u32)(((u32)((u64)4294967295UL) == (u32)t__2e1103));
+	t__2e1099 = (u64)(u32)t__2e1102;
+	if ((u32)t__2e1099) goto L__2e1100; else goto L__2e1101;
+	L__2e1100:;
+	t__2e1105 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e1104 = (u64)(u32)(((u32)((u64)4294967295UL) == (u32)t__2e1105));
+	t__2e1099 = (u64)(u32)t__2e1104;
+	goto L__2e1101;
+	L__2e1101:;
+	if ((u32)t__2e1099) goto L_passed_2e1098; else goto L_failed_2e1097;
+	L_failed_2e1097:;
+	t_abortsite_2e1090 = ((u64)1UL);
+	goto L_abort_2e1091;
+	L_passed_2e1098:;
+	t__2e1111 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	t__2e1108 = (u64)(u32)t__2e1111;
+	if ((u32)t__2e1108) goto L__2e1109; else goto L__2e1110;
+	L__2e1109:;
+	t__2e1112 = (u64)(u32)(((u32)((u64)1UL) == (u32)((u64)1UL)));
+	t__2e1108 = (u64)(u32)t__2e1112;
+	goto L__2e1110;
+	L__2e1110:;
+	if ((u32)t__2e1108) goto L_passed_2e1107; else goto L_failed_2e1106;
+	L_failed_2e1106:;
+	t_abortsite_2e1090 = ((u64)2UL);
+	goto L_abort_2e1091;
+	L_passed_2e1107:;
+	t__2e1115 = (u64)(u32)(((u64)((u64)3UL) == (u64)((u64)3UL)));
+	if ((u32)t__2e1115) goto L_passed_2e1114; else goto L_failed_2e1113;
+	L_failed_2e1113:;
+	t_abortsite_2e1090 = ((u64)3UL);
+	goto L_abort_2e1091;
+	L_passed_2e1114:;
+	t_item_2e1124 = (u64)((u64)t_object_2e1122 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1124 = (u32)((u64)4294967295UL);
+	t_item_2e1124 = (u64)((u64)t_object_2e1122 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1124 = (u32)((u64)1UL);
+	t_item_2e1124 = (u64)((u64)t_object_2e1122 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1124 = (u32)((u64)0UL);
+	t__2e1126 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1125 = (u64)((u64)t__2e1126 * (u64)((u64)4UL));
+	t__2e1125 = (u64)((u64)t_object_2e1122 + (u64)t__2e1125);
+	t__2e1127 = (u64)(u32)(*(i32 *)t__2e1125);
+	t__2e1128 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e1121 = (u64)(u32)(((u32)t__2e1127 == (u32)t__2e1128));
+	t__2e1118 = (u64)(u32)t__2e1121;
+	if ((u32)t__2e1118) goto L__2e1119; else goto L__2e1120;
+	L__2e1119:;
+	t_item_2e1131 = (u64)((u64)t_object_2e1130 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1131 = (u32)((u64)4294967295UL);
+	t_item_2e1131 = (u64)((u64)t_object_2e1130 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1131 = (u32)((u64)1UL);
+	t_item_2e1131 = (u64)((u64)t_object_2e1130 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1131 = (u32)((u64)0UL);
+	t__2e1133 = (u64)((i64)(i32)((u64)0UL));
+	t__2e1132 = (u64)((u64)t__2e1133 * (u64)((u64)4UL));
+	t__2e1132 = (u64)((u64)t_object_2e1130 + (u64)t__2e1132);
+	t__2e1134 = (u64)(u32)(*(i32 *)t__2e1132);
+	t__2e1135 = (u64)(u32)(-(u32)((u64)1UL));
+	t__2e1129 = (u64)(u32)(((u32)t__2e1134 == (u32)t__2e1135));
+	t__2e1118 = (u64)(u32)t__2e1129;
+	goto L__2e1120;
+	L__2e1120:;
+	if ((u32)t__2e1118) goto L_passed_2e1117; else goto L_failed_2e1116;
+	L_failed_2e1116:;
+	t_abortsite_2e1090 = ((u64)4UL);
+	goto L_abort_2e1091;
+	L_passed_2e1117:;
+	t_item_2e1143 = (u64)((u64)t_object_2e1142 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1143 = (u32)((u64)4294967295UL);
+	t_item_2e1143 = (u64)((u64)t_object_2e1142 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1143 = (u32)((u64)1UL);
+	t_item_2e1143 = (u64)((u64)t_object_2e1142 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1143 = (u32)((u64)0UL);
+	t__2e1145 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1144 = (u64)((u64)t__2e1145 * (u64)((u64)4UL));
+	t__2e1144 = (u64)((u64)t_object_2e1142 + (u64)t__2e1144);
+	t__2e1146 = (u64)(u32)(*(i32 *)t__2e1144);
+	t__2e1141 = (u64)(u32)(((u32)t__2e1146 == (u32)((u64)1UL)));
+	t__2e1138 = (u64)(u32)t__2e1141;
+	if ((u32)t__2e1138) goto L__2e1139; else goto L__2e1140;
+	L__2e1139:;
+	t_item_2e1149 = (u64)((u64)t_object_2e1148 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1149 = (u32)((u64)4294967295UL);
+	t_item_2e1149 = (u64)((u64)t_object_2e1148 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1149 = (u32)((u64)1UL);
+	t_item_2e1149 = (u64)((u64)t_object_2e1148 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1149 = (u32)((u64)0UL);
+	t__2e1151 = (u64)((i64)(i32)((u64)1UL));
+	t__2e1150 = (u64)((u64)t__2e1151 * (u64)((u64)4UL));
+	t__2e1150 = (u64)((u64)t_object_2e1148 + (u64)t__2e1150);
+	t__2e1152 = (u64)(u32)(*(i32 *)t__2e1150);
+	t__2e1147 = (u64)(u32)(((u32)t__2e1152 == (u32)((u64)1UL)));
+	t__2e1138 = (u64)(u32)t__2e1147;
+	goto L__2e1140;
+	L__2e1140:;
+	if ((u32)t__2e1138) goto L_passed_2e1137; else goto L_failed_2e1136;
+	L_failed_2e1136:;
+	t_abortsite_2e1090 = ((u64)5UL);
+	goto L_abort_2e1091;
+	L_passed_2e1137:;
+	t_item_2e1160 = (u64)((u64)t_object_2e1159 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1160 = (u32)((u64)4294967295UL);
+	t_item_2e1160 = (u64)((u64)t_object_2e1159 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1160 = (u32)((u64)1UL);
+	t_item_2e1160 = (u64)((u64)t_object_2e1159 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1160 = (u32)((u64)0UL);
+	t__2e1162 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1161 = (u64)((u64)t__2e1162 * (u64)((u64)4UL));
+	t__2e1161 = (u64)((u64)t_object_2e1159 + (u64)t__2e1161);
+	t__2e1163 = (u64)(u32)(*(i32 *)t__2e1161);
+	t__2e1158 = (u64)(u32)(((u32)t__2e1163 == (u32)((u64)0UL)));
+	t__2e1155 = (u64)(u32)t__2e1158;
+	if ((u32)t__2e1155) goto L__2e1156; else goto L__2e1157;
+	L__2e1156:;
+	t_item_2e1166 = (u64)((u64)t_object_2e1165 + (u64)((u64)0UL));
+	*(u32 *)t_item_2e1166 = (u32)((u64)4294967295UL);
+	t_item_2e1166 = (u64)((u64)t_object_2e1165 + (u64)((u64)4UL));
+	*(u32 *)t_item_2e1166 = (u32)((u64)1UL);
+	t_item_2e1166 = (u64)((u64)t_object_2e1165 + (u64)((u64)8UL));
+	*(u32 *)t_item_2e1166 = (u32)((u64)0UL);
+	t__2e1168 = (u64)((i64)(i32)((u64)2UL));
+	t__2e1167 = (u64)((u64)t__2e1168 * (u64)((u64)4UL));
+	t__2e1167 = (u64)((u64)t_object_2e1165 + (u64)t__2e1167);
+	t__2e1169 = (u64)(u32)(*(i32 *)t__2e1167);
+	t__2e1164 = (u64)(u32)(((u32)t__2e1169 == (u32)((u64)0UL)));
+	t__2e1155 = (u64)(u32)t__2e1164;
+	goto L__2e1157;
+	L__2e1157:;
+	if ((u32)t__2e1155) goto L_passed_2e1154; else goto L_failed_2e1153;
+	L_failed_2e1153:;
+	t_abortsite_2e1090 = ((u64)6UL);
+	goto L_abort_2e1091;
+	L_passed_2e1154:;
+	*(u32 *)t_binding_2e1170 = (u32)((u64)12UL);
+	t__2e1174 = (u64)(u32)(*(i32 *)t_binding_2e1170);
+	t__2e1173 = (u64)(u32)(((u32)t__2e1174 == (u32)((u64)12UL)));
+	if ((u32)t__2e1173) goto L_passed_2e1172; else goto L_failed_2e1171;
+	L_failed_2e1171:;
+	t_abortsite_2e1090 = ((u64)7UL);
+	goto L_abort_2e1091;
+	L_passed_2e1172:;
+	*(u64 *)t_binding_2e1175 = (u64)t_binding_2e1170;
+	*(u8 *)t_binding_2e1176 = (u8)((u64)12UL);
+	t__2e1180 = (u64)(u32)(*(u8 *)t_binding_2e1176);
+	t__2e1181 = (u64)(u32)((u8)t__2e1180);
+	t__2e1182 = (u64)(u32)((u8)((u64)12UL));
+	t__2e1179 = (u64)(u32)(((u32)t__2e1181 == (u32)t__2e1182));
+	if ((u32)t__2e1179) goto L_passed_2e1178; else goto L_failed_2e1177;
+	L_failed_2e1177:;
+	t_abortsite_2e1090 = ((u64)8UL);
+	goto L_abort_2e1091;
+	L_passed_2e1178:;
+	*(u64 *)t_binding_2e1183 = (u64)((u64)12UL);
+	t__2e1187 = (u64)(*(u64 *)t_binding_2e1183);
+	t__2e1186 = (u64)(u32)(((u64)t__2e1187 == (u64)((u64)12UL)));
+	if ((u32)t__2e1186) goto L_passed_2e1185; else goto L_failed_2e1184;
+	L_failed_2e1184:;
+	t_abortsite_2e1090 = ((u64)9UL);
+	goto L_abort_2e1091;
+	L_passed_2e1185:;
+	*(u64 *)t_binding_2e1188 = (u64)((u64)4622945017495814144UL);
+	t__2e1192 = (u64)(*(u64 *)t_binding_2e1188);
+	t__2e1191 = (u64)(u32)((BD(t__2e1192) == BD(((u64)4622945017495814144UL))));
+	if ((u32)t__2e1191) goto L_passed_2e1190; else goto L_failed_2e1189;
+	L_failed_2e1189:;
+	t_abortsite_2e1090 = ((u64)10UL);
+	goto L_abort_2e1091;
+	L_passed_2e1190:;
+	*(u64 *)t_binding_2e1193 = (u64)t_binding_2e1188;
+	*(u32 *)t_binding_2e1194 = (u32)((u64)1094713344UL);
+	t__2e1198 = (u64)(*(u32 *)t_binding_2e1194);
+	t__2e1197 = (u64)(u32)((BF(t__2e1198) == BF(((u64)1094713344UL))));
+	if ((u32)t__2e1197) goto L_passed_2e1196; else goto L_failed_2e1195;
+	L_failed_2e1195:;
+	t_abortsite_2e1090 = ((u64)11UL);
+	goto L_abort_2e1091;
+	L_passed_2e1196:;
+	*(u32 *)t_binding_2e1199 = (u32)((u64)120UL);
+	t__2e1203 = (u64)(u32)(*(u32 *)t_binding_2e1199);
+	t__2e1202 = (u64)(u32)(((u32)t__2e1203 == (u32)((u64)120UL)));
+	if ((u32)t__2e1202) goto L_passed_2e1201; else goto L_failed_2e1200;
+	L_failed_2e1200:;
+	t_abortsite_2e1090 = ((u64)12UL);
+	goto L_abort_2e1091;
+	L_passed_2e1201:;
+	*(u64 *)t_binding_2e1204 = (u64)t_binding_2e1199;
+	*(u32 *)t_binding_2e1205 = (u32)((u64)120UL);
+	t__2e1209 = (u64)(u32)(*(u32 *)t_binding_2e1205);
+	t__2e1208 = (u64)(u32)(((u32)t__2e1209 == (u32)((u64)120UL)));
+	if ((u32)t__2e1208) goto L_passed_2e1207; else goto L_failed_2e1206;
+	L_failed_2e1206:;
+	t_abortsite_2e1090 = ((u64)13UL);
+	goto L_abort_2e1091;
+	L_passed_2e1207:;
+	t__2e1212 = (u64)(u32)(((u64)((u64)0UL) == (u64)((u64)0UL)));
+	if ((u32)t__2e1212) goto L_passed_2e1211; else goto L_failed_2e1210;
+	L_failed_2e1210:;
+	t_abortsite_2e1090 = ((u64)14UL);
+	goto L_abort_2e1091;
+	L_passed_2e1211:;
+	goto L__2e1054;
+	L__2e1213:;
+	L__2e1054:;
+	return;
+	L_abort_2e1091:;
+	t__2e1092 = (u64)((u64)t_abortsite_2e1090 * (u64)((u64)16UL));
+	t__2e1092 = (u64)((u64)((u64)((char *)&D_abortsites_2e1089)) + (u64)t__2e1092);
+	t__2e1093 = (u64)(*(u64 *)t__2e1092);
+	t__2e1094 = (u64)((u64)t__2e1092 + (u64)((u64)8UL));
+	t__2e1095 = (u64)(*(u32 *)t__2e1094);
+	t__2e1094 = (u64)((u64)t__2e1092 + (u64)((u64)12UL));
+	t__2e1096 = (u64)(*(u32 *)t__2e1094);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e1093, (u64)t__2e1095, (u64)t__2e1096, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,982 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e19 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; };
+struct __attribute__((packed)) S_abortsites_2e200 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; };
+struct __attribute__((packed)) S_abortsites_2e388 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static struct S_abortsites_2e19 D_abortsites_2e19 __asm__("abortsites.19") __attribute__((used, section(".data.rel.ro.abortsites.19"), aligned(8)));
+static struct S_abortsites_2e200 D_abortsites_2e200 __asm__("abortsites.200") __attribute__((used, section(".data.rel.ro.abortsites.200"), aligned(8)));
+static struct S_abortsites_2e388 D_abortsites_2e388 __asm__("abortsites.388") __attribute__((used, section(".data.rel.ro.abortsites.388"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_unsigned__casts(void) __asm__("unsigned_casts") __attribute__((used, section(".text.unsigned_casts")));
+static void F_signed__casts(void) __asm__("signed_casts") __attribute__((used, section(".text.signed_casts")));
+static void F_measurements(void) __asm__("measurements") __attribute__((used, section(".text.measurements")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\063\065\055\146\154\157\141\164\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 18U, 18U };
+static struct S_abortsites_2e19 D_abortsites_2e19 = { (char *)((char *)&D_strliteral_2e1) + 0, 70U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 72U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 74U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 76U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 78U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 80U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 84U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 86U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 88U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 90U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 92U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 94U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 98U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 100U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 104U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 106U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 110U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 112U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 116U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 118U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 121U, 15U };
+static struct S_abortsites_2e200 D_abortsites_2e200 = { (char *)((char *)&D_strliteral_2e1) + 0, 9U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 11U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 15U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 17U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 19U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 23U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 25U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 29U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 31U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 33U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 37U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 43U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 45U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 49U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 55U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 60U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 62U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 64U, 15U };
+static struct S_abortsites_2e388 D_abortsites_2e388 = { (char *)((char *)&D_strliteral_2e1) + 0, 2U, 15U, (char *)((char *)&D_strliteral_2e1) + 0, 3U, 15U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_measurements)))();
+	((void (*)(void))((u64)((char *)&F_signed__casts)))();
+	((void (*)(void))((u64)((char *)&F_unsigned__casts)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_unsigned__casts(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[1] __attribute__((aligned(16)));
+	char A3[2] __attribute__((aligned(16)));
+	char A4[2] __attribute__((aligned(16)));
+	char A5[4] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[4] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[1] __attribute__((aligned(16)));
+	char A10[2] __attribute__((aligned(16)));
+	char A11[2] __attribute__((aligned(16)));
+	char A12[4] __attribute__((aligned(16)));
+	char A13[8] __attribute__((aligned(16)));
+	char A14[1] __attribute__((aligned(16)));
+	char A15[4] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[2] __attribute__((aligned(16)));
+	char A18[4] __attribute__((aligned(16)));
+	char A19[8] __attribute__((aligned(16)));
+	char A20[4] __attribute__((aligned(16)));
+	char A21[4] __attribute__((aligned(16)));
+	char A22[8] __attribute__((aligned(16)));
+	char A23[8] __attribute__((aligned(16)));
+	char A24[4] __attribute__((aligned(16)));
+	char A25[8] __attribute__((aligned(16)));
+	char A26[4] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e101;
+	u64 t__2e102;
+	u64 t__2e104;
+	u64 t__2e105;
+	u64 t__2e108;
+	u64 t__2e109;
+	u64 t__2e111;
+	u64 t__2e112;
+	u64 t__2e115;
+	u64 t__2e116;
+	u64 t__2e119;
+	u64 t__2e120;
+	u64 t__2e121;
+	u64 t__2e124;
+	u64 t__2e125;
+	u64 t__2e127;
+	u64 t__2e128;
+	u64 t__2e129;
+	u64 t__2e13;
+	u64 t__2e132;
+	u64 t__2e133;
+	u64 t__2e136;
+	u64 t__2e137;
+	u64 t__2e138;
+	u64 t__2e14;
+	u64 t__2e141;
+	u64 t__2e142;
+	u64 t__2e144;
+	u64 t__2e145;
+	u64 t__2e146;
+	u64 t__2e149;
+	u64 t__2e150;
+	u64 t__2e153;
+	u64 t__2e154;
+	u64 t__2e157;
+	u64 t__2e158;
+	u64 t__2e160;
+	u64 t__2e161;
+	u64 t__2e164;
+	u64 t__2e165;
+	u64 t__2e168;
+	u64 t__2e169;
+	u64 t__2e17;
+	u64 t__2e172;
+	u64 t__2e173;
+	u64 t__2e175;
+	u64 t__2e176;
+	u64 t__2e179;
+	u64 t__2e18;
+	u64 t__2e180;
+	u64 t__2e182;
+	u64 t__2e185;
+	u64 t__2e186;
+	u64 t__2e22;
+	u64 t__2e23;
+	u64 t__2e24;
+	u64 t__2e25;
+	u64 t__2e26;
+	u64 t__2e28;
+	u64 t__2e29;
+	u64 t__2e32;
+	u64 t__2e33;
+	u64 t__2e34;
+	u64 t__2e35;
+	u64 t__2e37;
+	u64 t__2e38;
+	u64 t__2e41;
+	u64 t__2e42;
+	u64 t__2e43;
+	u64 t__2e44;
+	u64 t__2e46;
+	u64 t__2e47;
+	u64 t__2e50;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e55;
+	u64 t__2e56;
+	u64 t__2e59;
+	u64 t__2e60;
+	u64 t__2e62;
+	u64 t__2e63;
+	u64 t__2e66;
+	u64 t__2e67;
+	u64 t__2e70;
+	u64 t__2e71;
+	u64 t__2e74;
+	u64 t__2e75;
+	u64 t__2e77;
+	u64 t__2e78;
+	u64 t__2e81;
+	u64 t__2e82;
+	u64 t__2e83;
+	u64 t__2e84;
+	u64 t__2e86;
+	u64 t__2e87;
+	u64 t__2e90;
+	u64 t__2e91;
+	u64 t__2e92;
+	u64 t__2e93;
+	u64 t__2e95;
+	u64 t__2e96;
+	u64 t__2e99;
+	u64 t_abortsite_2e20;
+	u64 t_binding_2e103;
+	u64 t_binding_2e11;
+	u64 t_binding_2e110;
+	u64 t_binding_2e117;
+	u64 t_binding_2e118;
+	u64 t_binding_2e12;
+	u64 t_binding_2e126;
+	u64 t_binding_2e134;
+	u64 t_binding_2e135;
+	u64 t_binding_2e143;
+	u64 t_binding_2e151;
+	u64 t_binding_2e152;
+	u64 t_binding_2e159;
+	u64 t_binding_2e166;
+	u64 t_binding_2e167;
+	u64 t_binding_2e174;
+	u64 t_binding_2e181;
+	u64 t_binding_2e27;
+	u64 t_binding_2e36;
+	u64 t_binding_2e45;
+	u64 t_binding_2e54;
+	u64 t_binding_2e61;
+	u64 t_binding_2e68;
+	u64 t_binding_2e69;
+	u64 t_binding_2e76;
+	u64 t_binding_2e85;
+	u64 t_binding_2e94;
+	L_start_2e7:;
+	t_binding_2e11 = (u64)A0;
+	t_binding_2e12 = (u64)A1;
+	t_binding_2e27 = (u64)A2;
+	t_binding_2e36 = (u64)A3;
+	t_binding_2e45 = (u64)A4;
+	t_binding_2e54 = (u64)A5;
+	t_binding_2e61 = (u64)A6;
+	t_binding_2e68 = (u64)A7;
+	t_binding_2e69 = (u64)A8;
+	t_binding_2e76 = (u64)A9;
+	t_binding_2e85 = (u64)A10;
+	t_binding_2e94 = (u64)A11;
+	t_binding_2e103 = (u64)A12;
+	t_binding_2e110 = (u64)A13;
+	t_binding_2e117 = (u64)A14;
+	t_binding_2e118 = (u64)A15;
+	t_binding_2e126 = (u64)A16;
+	t_binding_2e134 = (u64)A17;
+	t_binding_2e135 = (u64)A18;
+	t_binding_2e143 = (u64)A19;
+	t_binding_2e151 = (u64)A20;
+	t_binding_2e152 = (u64)A21;
+	t_binding_2e159 = (u64)A22;
+	t_binding_2e166 = (u64)A23;
+	t_binding_2e167 = (u64)A24;
+	t_binding_2e174 = (u64)A25;
+	t_binding_2e181 = (u64)A26;
+	L_body_2e8:;
+	*(u64 *)t_binding_2e11 = (u64)((u64)4626322717216342016UL);
+	t__2e13 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e14 = FB((float)BD(t__2e13));
+	*(u32 *)t_binding_2e12 = (u32)t__2e14;
+	t__2e18 = (u64)(*(u32 *)t_binding_2e12);
+	t__2e17 = (u64)(u32)((BF(t__2e18) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e17) goto L_passed_2e16; else goto L_failed_2e15;
+	L_failed_2e15:;
+	t_abortsite_2e20 = ((u64)0UL);
+	goto L_abort_2e21;
+	L_passed_2e16:;
+	t__2e28 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e29 = (u64)(u32)((u32)BD(t__2e28));
+	*(u8 *)t_binding_2e27 = (u8)t__2e29;
+	t__2e33 = (u64)(u32)(*(u8 *)t_binding_2e27);
+	t__2e34 = (u64)(u32)((u8)t__2e33);
+	t__2e35 = (u64)(u32)((u8)((u64)20UL));
+	t__2e32 = (u64)(u32)(((u32)t__2e34 == (u32)t__2e35));
+	if ((u32)t__2e32) goto L_passed_2e31; else goto L_failed_2e30;
+	L_failed_2e30:;
+	t_abortsite_2e20 = ((u64)1UL);
+	goto L_abort_2e21;
+	L_passed_2e31:;
+	t__2e37 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e38 = (u64)(u32)((u32)BD(t__2e37));
+	*(u16 *)t_binding_2e36 = (u16)t__2e38;
+	t__2e42 = (u64)(u32)(*(u16 *)t_binding_2e36);
+	t__2e43 = (u64)(u32)((u16)t__2e42);
+	t__2e44 = (u64)(u32)((u16)((u64)20UL));
+	t__2e41 = (u64)(u32)(((u32)t__2e43 == (u32)t__2e44));
+	if ((u32)t__2e41) goto L_passed_2e40; else goto L_failed_2e39;
+	L_failed_2e39:;
+	t_abortsite_2e20 = ((u64)2UL);
+	goto L_abort_2e21;
+	L_passed_2e40:;
+	t__2e46 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e47 = (u64)(u32)((u32)BD(t__2e46));
+	*(u16 *)t_binding_2e45 = (u16)t__2e47;
+	t__2e51 = (u64)(u32)(*(u16 *)t_binding_2e45);
+	t__2e52 = (u64)(u32)((u16)t__2e51);
+	t__2e53 = (u64)(u32)((u16)((u64)20UL));
+	t__2e50 = (u64)(u32)(((u32)t__2e52 == (u32)t__2e53));
+	if ((u32)t__2e50) goto L_passed_2e49; else goto L_failed_2e48;
+	L_failed_2e48:;
+	t_abortsite_2e20 = ((u64)3UL);
+	goto L_abort_2e21;
+	L_passed_2e49:;
+	t__2e55 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e56 = (u64)(u32)((u32)BD(t__2e55));
+	*(u32 *)t_binding_2e54 = (u32)t__2e56;
+	t__2e60 = (u64)(u32)(*(u32 *)t_binding_2e54);
+	t__2e59 = (u64)(u32)(((u32)t__2e60 == (u32)((u64)20UL)));
+	if ((u32)t__2e59) goto L_passed_2e58; else goto L_failed_2e57;
+	L_failed_2e57:;
+	t_abortsite_2e20 = ((u64)4UL);
+	goto L_abort_2e21;
+	L_passed_2e58:;
+	t__2e62 = (u64)(*(u64 *)t_binding_2e11);
+	t__2e63 = (u64)((u64)BD(t__2e62));
+	*(u64 *)t_binding_2e61 = (u64)t__2e63;
+	t__2e67 = (u64)(*(u64 *)t_binding_2e61);
+	t__2e66 = (u64)(u32)(((u64)t__2e67 == (u64)((u64)20UL)));
+	if ((u32)t__2e66) goto L_passed_2e65; else goto L_failed_2e64;
+	L_failed_2e64:;
+	t_abortsite_2e20 = ((u64)5UL);
+	goto L_abort_2e21;
+	L_passed_2e65:;
+	*(u32 *)t_binding_2e68 = (u32)((u64)1101004800UL);
+	t__2e70 = (u64)(*(u32 *)t_binding_2e68);
+	t__2e71 = DB((double)BF(t__2e70));
+	*(u64 *)t_binding_2e69 = (u64)t__2e71;
+	t__2e75 = (u64)(*(u64 *)t_binding_2e69);
+	t__2e74 = (u64)(u32)((BD(t__2e75) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e74) goto L_passed_2e73; else goto L_failed_2e72;
+	L_failed_2e72:;
+	t_abortsite_2e20 = ((u64)6UL);
+	goto L_abort_2e21;
+	L_passed_2e73:;
+	t__2e77 = (u64)(*(u32 *)t_binding_2e68);
+	t__2e78 = (u64)(u32)((u32)BF(t__2e77));
+	*(u8 *)t_binding_2e76 = (u8)t__2e78;
+	t__2e82 = (u64)(u32)(*(u8 *)t_binding_2e76);
+	t__2e83 = (u64)(u32)((u8)t__2e82);
+	t__2e84 = (u64)(u32)((u8)((u64)20UL));
+	t__2e81 = (u64)(u32)(((u32)t__2e83 == (u32)t__2e84));
+	if ((u32)t__2e81) goto L_passed_2e80; else goto L_failed_2e79;
+	L_failed_2e79:;
+	t_abortsite_2e20 = ((u64)7UL);
+	goto L_abort_2e21;
+	L_passed_2e80:;
+	t__2e86 = (u64)(*(u32 *)t_binding_2e68);
+	t__2e87 = (u64)(u32)((u32)BF(t__2e86));
+	*(u16 *)t_binding_2e85 = (u16)t__2e87;
+	t__2e91 = (u64)(u32)(*(u16 *)t_binding_2e85);
+	t__2e92 = (u64)(u32)((u16)t__2e91);
+	t__2e93 = (u64)(u32)((u16)((u64)20UL));
+	t__2e90 = (u64)(u32)(((u32)t__2e92 == (u32)t__2e93));
+	if ((u32)t__2e90) goto L_passed_2e89; else goto L_failed_2e88;
+	L_failed_2e88:;
+	t_abortsite_2e20 = ((u64)8UL);
+	goto L_abort_2e21;
+	L_passed_2e89:;
+	t__2e95 = (u64)(*(u32 *)t_binding_2e68);
+	t__2e96 = (u64)(u32)((u32)BF(t__2e95));
+	*(u16 *)t_binding_2e94 = (u16)t__2e96;
+	t__2e100 = (u64)(u32)(*(u16 *)t_binding_2e94);
+	t__2e101 = (u64)(u32)((u16)t__2e100);
+	t__2e102 = (u64)(u32)((u16)((u64)20UL));
+	t__2e99 = (u64)(u32)(((u32)t__2e101 == (u32)t__2e102));
+	if ((u32)t__2e99) goto L_passed_2e98; else goto L_failed_2e97;
+	L_failed_2e97:;
+	t_abortsite_2e20 = ((u64)9UL);
+	goto L_abort_2e21;
+	L_passed_2e98:;
+	t__2e104 = (u64)(*(u32 *)t_binding_2e68);
+	t__2e105 = (u64)(u32)((u32)BF(t__2e104));
+	*(u32 *)t_binding_2e103 = (u32)t__2e105;
+	t__2e109 = (u64)(u32)(*(u32 *)t_binding_2e103);
+	t__2e108 = (u64)(u32)(((u32)t__2e109 == (u32)((u64)20UL)));
+	if ((u32)t__2e108) goto L_passed_2e107; else goto L_failed_2e106;
+	L_failed_2e106:;
+	t_abortsite_2e20 = ((u64)10UL);
+	goto L_abort_2e21;
+	L_passed_2e107:;
+	t__2e111 = (u64)(*(u32 *)t_binding_2e68);
+	t__2e112 = (u64)((u64)BF(t__2e111));
+	*(u64 *)t_binding_2e110 = (u64)t__2e112;
+	t__2e116 = (u64)(*(u64 *)t_binding_2e110);
+	t__2e115 = (u64)(u32)(((u64)t__2e116 == (u64)((u64)20UL)));
+	if ((u32)t__2e115) goto L_passed_2e114; else goto L_failed_2e113;
+	L_failed_2e113:;
+	t_abortsite_2e20 = ((u64)11UL);
+	goto L_abort_2e21;
+	L_passed_2e114:;
+	*(u8 *)t_binding_2e117 = (u8)((u64)20UL);
+	t__2e119 = (u64)(u32)(*(u8 *)t_binding_2e117);
+	t__2e121 = (u64)(u32)((u8)t__2e119);
+	t__2e120 = FB((float)(u32)t__2e121);
+	*(u32 *)t_binding_2e118 = (u32)t__2e120;
+	t__2e125 = (u64)(*(u32 *)t_binding_2e118);
+	t__2e124 = (u64)(u32)((BF(t__2e125) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e124) goto L_passed_2e123; else goto L_failed_2e122;
+	L_failed_2e122:;
+	t_abortsite_2e20 = ((u64)12UL);
+	goto L_abort_2e21;
+	L_passed_2e123:;
+	t__2e127 = (u64)(u32)(*(u8 *)t_binding_2e117);
+	t__2e129 = (u64)(u32)((u8)t__2e127);
+	t__2e128 = DB((double)(u32)t__2e129);
+	*(u64 *)t_binding_2e126 = (u64)t__2e128;
+	t__2e133 = (u64)(*(u64 *)t_binding_2e126);
+	t__2e132 = (u64)(u32)((BD(t__2e133) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e132) goto L_passed_2e131; else goto L_failed_2e130;
+	L_failed_2e130:;
+	t_abortsite_2e20 = ((u64)13UL);
+	goto L_abort_2e21;
+	L_passed_2e131:;
+	*(u16 *)t_binding_2e134 = (u16)((u64)20UL);
+	t__2e136 = (u64)(u32)(*(u16 *)t_binding_2e134);
+	t__2e138 = (u64)(u32)((u16)t__2e136);
+	t__2e137 = FB((float)(u32)t__2e138);
+	*(u32 *)t_binding_2e135 = (u32)t__2e137;
+	t__2e142 = (u64)(*(u32 *)t_binding_2e135);
+	t__2e141 = (u64)(u32)((BF(t__2e142) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e141) goto L_passed_2e140; else goto L_failed_2e139;
+	L_failed_2e139:;
+	t_abortsite_2e20 = ((u64)14UL);
+	goto L_abort_2e21;
+	L_passed_2e140:;
+	t__2e144 = (u64)(u32)(*(u16 *)t_binding_2e134);
+	t__2e146 = (u64)(u32)((u16)t__2e144);
+	t__2e145 = DB((double)(u32)t__2e146);
+	*(u64 *)t_binding_2e143 = (u64)t__2e145;
+	t__2e150 = (u64)(*(u64 *)t_binding_2e143);
+	t__2e149 = (u64)(u32)((BD(t__2e150) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e149) goto L_passed_2e148; else goto L_failed_2e147;
+	L_failed_2e147:;
+	t_abortsite_2e20 = ((u64)15UL);
+	goto L_abort_2e21;
+	L_passed_2e148:;
+	*(u32 *)t_binding_2e151 = (u32)((u64)20UL);
+	t__2e153 = (u64)(u32)(*(u32 *)t_binding_2e151);
+	t__2e154 = FB((float)(u32)t__2e153);
+	*(u32 *)t_binding_2e152 = (u32)t__2e154;
+	t__2e158 = (u64)(*(u32 *)t_binding_2e152);
+	t__2e157 = (u64)(u32)((BF(t__2e158) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e157) goto L_passed_2e156; else goto L_failed_2e155;
+	L_failed_2e155:;
+	t_abortsite_2e20 = ((u64)16UL);
+	goto L_abort_2e21;
+	L_passed_2e156:;
+	t__2e160 = (u64)(u32)(*(u32 *)t_binding_2e151);
+	t__2e161 = DB((double)(u32)t__2e160);
+	*(u64 *)t_binding_2e159 = (u64)t__2e161;
+	t__2e165 = (u64)(*(u64 *)t_binding_2e159);
+	t__2e164 = (u64)(u32)((BD(t__2e165) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e164) goto L_passed_2e163; else goto L_failed_2e162;
+	L_failed_2e162:;
+	t_abortsite_2e20 = ((u64)17UL);
+	goto L_abort_2e21;
+	L_passed_2e163:;
+	*(u64 *)t_binding_2e166 = (u64)((u64)20UL);
+	t__2e168 = (u64)(*(u64 *)t_binding_2e166);
+	t__2e169 = FB((float)(u64)t__2e168);
+	*(u32 *)t_binding_2e167 = (u32)t__2e169;
+	t__2e173 = (u64)(*(u32 *)t_binding_2e167);
+	t__2e172 = (u64)(u32)((BF(t__2e173) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e172) goto L_passed_2e171; else goto L_failed_2e170;
+	L_failed_2e170:;
+	t_abortsite_2e20 = ((u64)18UL);
+	goto L_abort_2e21;
+	L_passed_2e171:;
+	t__2e175 = (u64)(*(u64 *)t_binding_2e166);
+	t__2e176 = DB((double)(u64)t__2e175);
+	*(u64 *)t_binding_2e174 = (u64)t__2e176;
+	t__2e180 = (u64)(*(u64 *)t_binding_2e174);
+	t__2e179 = (u64)(u32)((BD(t__2e180) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e179) goto L_passed_2e178; else goto L_failed_2e177;
+	L_failed_2e177:;
+	t_abortsite_2e20 = ((u64)19UL);
+	goto L_abort_2e21;
+	L_passed_2e178:;
+	t__2e182 = (u64)(u32)((u32)BD(((u64)4623716258932001341UL)));
+	*(u32 *)t_binding_2e181 = (u32)t__2e182;
+	t__2e186 = (u64)(u32)(*(u32 *)t_binding_2e181);
+	t__2e185 = (u64)(u32)(((u32)t__2e186 == (u32)((u64)13UL)));
+	if ((u32)t__2e185) goto L_passed_2e184; else goto L_failed_2e183;
+	L_failed_2e183:;
+	t_abortsite_2e20 = ((u64)20UL);
+	goto L_abort_2e21;
+	L_passed_2e184:;
+	goto L__2e9;
+	L__2e187:;
+	L__2e9:;
+	return;
+	L_abort_2e21:;
+	t__2e22 = (u64)((u64)t_abortsite_2e20 * (u64)((u64)16UL));
+	t__2e22 = (u64)((u64)((u64)((char *)&D_abortsites_2e19)) + (u64)t__2e22);
+	t__2e23 = (u64)(*(u64 *)t__2e22);
+	t__2e24 = (u64)((u64)t__2e22 + (u64)((u64)8UL));
+	t__2e25 = (u64)(*(u32 *)t__2e24);
+	t__2e24 = (u64)((u64)t__2e22 + (u64)((u64)12UL));
+	t__2e26 = (u64)(*(u32 *)t__2e24);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e23, (u64)t__2e25, (u64)t__2e26, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_signed__casts(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[4] __attribute__((aligned(16)));
+	char A2[1] __attribute__((aligned(16)));
+	char A3[2] __attribute__((aligned(16)));
+	char A4[2] __attribute__((aligned(16)));
+	char A5[4] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[4] __attribute__((aligned(16)));
+	char A8[8] __attribute__((aligned(16)));
+	char A9[1] __attribute__((aligned(16)));
+	char A10[2] __attribute__((aligned(16)));
+	char A11[2] __attribute__((aligned(16)));
+	char A12[4] __attribute__((aligned(16)));
+	char A13[8] __attribute__((aligned(16)));
+	char A14[1] __attribute__((aligned(16)));
+	char A15[4] __attribute__((aligned(16)));
+	char A16[8] __attribute__((aligned(16)));
+	char A17[2] __attribute__((aligned(16)));
+	char A18[4] __attribute__((aligned(16)));
+	char A19[8] __attribute__((aligned(16)));
+	char A20[4] __attribute__((aligned(16)));
+	char A21[4] __attribute__((aligned(16)));
+	char A22[8] __attribute__((aligned(16)));
+	char A23[8] __attribute__((aligned(16)));
+	char A24[4] __attribute__((aligned(16)));
+	char A25[8] __attribute__((aligned(16)));
+	char A26[4] __attribute__((aligned(16)));
+	char A27[8] __attribute__((aligned(16)));
+	char A28[4] __attribute__((aligned(16)));
+	u64 t__2e194;
+	u64 t__2e195;
+	u64 t__2e198;
+	u64 t__2e199;
+	u64 t__2e203;
+	u64 t__2e204;
+	u64 t__2e205;
+	u64 t__2e206;
+	u64 t__2e207;
+	u64 t__2e209;
+	u64 t__2e210;
+	u64 t__2e213;
+	u64 t__2e214;
+	u64 t__2e215;
+	u64 t__2e216;
+	u64 t__2e218;
+	u64 t__2e219;
+	u64 t__2e222;
+	u64 t__2e223;
+	u64 t__2e224;
+	u64 t__2e225;
+	u64 t__2e227;
+	u64 t__2e228;
+	u64 t__2e231;
+	u64 t__2e232;
+	u64 t__2e233;
+	u64 t__2e234;
+	u64 t__2e236;
+	u64 t__2e237;
+	u64 t__2e240;
+	u64 t__2e241;
+	u64 t__2e243;
+	u64 t__2e244;
+	u64 t__2e247;
+	u64 t__2e248;
+	u64 t__2e251;
+	u64 t__2e252;
+	u64 t__2e255;
+	u64 t__2e256;
+	u64 t__2e258;
+	u64 t__2e259;
+	u64 t__2e262;
+	u64 t__2e263;
+	u64 t__2e264;
+	u64 t__2e265;
+	u64 t__2e267;
+	u64 t__2e268;
+	u64 t__2e271;
+	u64 t__2e272;
+	u64 t__2e273;
+	u64 t__2e274;
+	u64 t__2e276;
+	u64 t__2e277;
+	u64 t__2e280;
+	u64 t__2e281;
+	u64 t__2e282;
+	u64 t__2e283;
+	u64 t__2e285;
+	u64 t__2e286;
+	u64 t__2e289;
+	u64 t__2e290;
+	u64 t__2e292;
+	u64 t__2e293;
+	u64 t__2e296;
+	u64 t__2e297;
+	u64 t__2e300;
+	u64 t__2e301;
+	u64 t__2e302;
+	u64 t__2e305;
+	u64 t__2e306;
+	u64 t__2e308;
+	u64 t__2e309;
+	u64 t__2e310;
+	u64 t__2e313;
+	u64 t__2e314;
+	u64 t__2e317;
+	u64 t__2e318;
+	u64 t__2e319;
+	u64 t__2e322;
+	u64 t__2e323;
+	u64 t__2e325;
+	u64 t__2e326;
+	u64 t__2e327;
+	u64 t__2e330;
+	u64 t__2e331;
+	u64 t__2e334;
+	u64 t__2e335;
+	u64 t__2e338;
+	u64 t__2e339;
+	u64 t__2e341;
+	u64 t__2e342;
+	u64 t__2e345;
+	u64 t__2e346;
+	u64 t__2e349;
+	u64 t__2e350;
+	u64 t__2e353;
+	u64 t__2e354;
+	u64 t__2e356;
+	u64 t__2e357;
+	u64 t__2e360;
+	u64 t__2e361;
+	u64 t__2e363;
+	u64 t__2e366;
+	u64 t__2e367;
+	u64 t__2e369;
+	u64 t__2e372;
+	u64 t__2e373;
+	u64 t__2e375;
+	u64 t__2e378;
+	u64 t__2e379;
+	u64 t_abortsite_2e201;
+	u64 t_binding_2e192;
+	u64 t_binding_2e193;
+	u64 t_binding_2e208;
+	u64 t_binding_2e217;
+	u64 t_binding_2e226;
+	u64 t_binding_2e235;
+	u64 t_binding_2e242;
+	u64 t_binding_2e249;
+	u64 t_binding_2e250;
+	u64 t_binding_2e257;
+	u64 t_binding_2e266;
+	u64 t_binding_2e275;
+	u64 t_binding_2e284;
+	u64 t_binding_2e291;
+	u64 t_binding_2e298;
+	u64 t_binding_2e299;
+	u64 t_binding_2e307;
+	u64 t_binding_2e315;
+	u64 t_binding_2e316;
+	u64 t_binding_2e324;
+	u64 t_binding_2e332;
+	u64 t_binding_2e333;
+	u64 t_binding_2e340;
+	u64 t_binding_2e347;
+	u64 t_binding_2e348;
+	u64 t_binding_2e355;
+	u64 t_binding_2e362;
+	u64 t_binding_2e368;
+	u64 t_binding_2e374;
+	L_start_2e188:;
+	t_binding_2e192 = (u64)A0;
+	t_binding_2e193 = (u64)A1;
+	t_binding_2e208 = (u64)A2;
+	t_binding_2e217 = (u64)A3;
+	t_binding_2e226 = (u64)A4;
+	t_binding_2e235 = (u64)A5;
+	t_binding_2e242 = (u64)A6;
+	t_binding_2e249 = (u64)A7;
+	t_binding_2e250 = (u64)A8;
+	t_binding_2e257 = (u64)A9;
+	t_binding_2e266 = (u64)A10;
+	t_binding_2e275 = (u64)A11;
+	t_binding_2e284 = (u64)A12;
+	t_binding_2e291 = (u64)A13;
+	t_binding_2e298 = (u64)A14;
+	t_binding_2e299 = (u64)A15;
+	t_binding_2e307 = (u64)A16;
+	t_binding_2e315 = (u64)A17;
+	t_binding_2e316 = (u64)A18;
+	t_binding_2e324 = (u64)A19;
+	t_binding_2e332 = (u64)A20;
+	t_binding_2e333 = (u64)A21;
+	t_binding_2e340 = (u64)A22;
+	t_binding_2e347 = (u64)A23;
+	t_binding_2e348 = (u64)A24;
+	t_binding_2e355 = (u64)A25;
+	t_binding_2e362 = (u64)A26;
+	t_binding_2e368 = (u64)A27;
+	t_binding_2e374 = (u64)A28;
+	L_body_2e189:;
+	*(u64 *)t_binding_2e192 = (u64)((u64)4626322717216342016UL);
+	t__2e194 = (u64)(*(u64 *)t_binding_2e192);
+	t__2e195 = FB((float)BD(t__2e194));
+	*(u32 *)t_binding_2e193 = (u32)t__2e195;
+	t__2e199 = (u64)(*(u32 *)t_binding_2e193);
+	t__2e198 = (u64)(u32)((BF(t__2e199) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e198) goto L_passed_2e197; else goto L_failed_2e196;
+	L_failed_2e196:;
+	t_abortsite_2e201 = ((u64)0UL);
+	goto L_abort_2e202;
+	L_passed_2e197:;
+	t__2e209 = (u64)(*(u64 *)t_binding_2e192);
+	t__2e210 = (u64)(u32)((i32)BD(t__2e209));
+	*(u8 *)t_binding_2e208 = (u8)t__2e210;
+	t__2e214 = (u64)(u32)(*(i8 *)t_binding_2e208);
+	t__2e215 = (u64)(u32)((i64)(i8)t__2e214);
+	t__2e216 = (u64)(u32)((i64)(i8)((u64)20UL));
+	t__2e213 = (u64)(u32)(((u32)t__2e215 == (u32)t__2e216));
+	if ((u32)t__2e213) goto L_passed_2e212; else goto L_failed_2e211;
+	L_failed_2e211:;
+	t_abortsite_2e201 = ((u64)1UL);
+	goto L_abort_2e202;
+	L_passed_2e212:;
+	t__2e218 = (u64)(*(u64 *)t_binding_2e192);
+	t__2e219 = (u64)(u32)((i32)BD(t__2e218));
+	*(u16 *)t_binding_2e217 = (u16)t__2e219;
+	t__2e223 = (u64)(u32)(*(i16 *)t_binding_2e217);
+	t__2e224 = (u64)(u32)((i64)(i16)t__2e223);
+	t__2e225 = (u64)(u32)((i64)(i16)((u64)20UL));
+	t__2e222 = (u64)(u32)(((u32)t__2e224 == (u32)t__2e225));
+	if ((u32)t__2e222) goto L_passed_2e221; else goto L_failed_2e220;
+	L_failed_2e220:;
+	t_abortsite_2e201 = ((u64)2UL);
+	goto L_abort_2e202;
+	L_passed_2e221:;
+	t__2e227 = (u64)(*(u64 *)t_binding_2e192);
+	t__2e228 = (u64)(u32)((i32)BD(t__2e227));
+	*(u16 *)t_binding_2e226 = (u16)t__2e228;
+	t__2e232 = (u64)(u32)(*(i16 *)t_binding_2e226);
+	t__2e233 = (u64)(u32)((i64)(i16)t__2e232);
+	t__2e234 = (u64)(u32)((i64)(i16)((u64)20UL));
+	t__2e231 = (u64)(u32)(((u32)t__2e233 == (u32)t__2e234));
+	if ((u32)t__2e231) goto L_passed_2e230; else goto L_failed_2e229;
+	L_failed_2e229:;
+	t_abortsite_2e201 = ((u64)3UL);
+	goto L_abort_2e202;
+	L_passed_2e230:;
+	t__2e236 = (u64)(*(u64 *)t_binding_2e192);
+	t__2e237 = (u64)(u32)((i32)BD(t__2e236));
+	*(u32 *)t_binding_2e235 = (u32)t__2e237;
+	t__2e241 = (u64)(u32)(*(i32 *)t_binding_2e235);
+	t__2e240 = (u64)(u32)(((u32)t__2e241 == (u32)((u64)20UL)));
+	if ((u32)t__2e240) goto L_passed_2e239; else goto L_failed_2e238;
+	L_failed_2e238:;
+	t_abortsite_2e201 = ((u64)4UL);
+	goto L_abort_2e202;
+	L_passed_2e239:;
+	t__2e243 = (u64)(*(u64 *)t_binding_2e192);
+	t__2e244 = (u64)((i64)BD(t__2e243));
+	*(u64 *)t_binding_2e242 = (u64)t__2e244;
+	t__2e248 = (u64)(*(u64 *)t_binding_2e242);
+	t__2e247 = (u64)(u32)(((u64)t__2e248 == (u64)((u64)20UL)));
+	if ((u32)t__2e247) goto L_passed_2e246; else goto L_failed_2e245;
+	L_failed_2e245:;
+	t_abortsite_2e201 = ((u64)5UL);
+	goto L_abort_2e202;
+	L_passed_2e246:;
+	*(u32 *)t_binding_2e249 = (u32)((u64)1101004800UL);
+	t__2e251 = (u64)(*(u32 *)t_binding_2e249);
+	t__2e252 = DB((double)BF(t__2e251));
+	*(u64 *)t_binding_2e250 = (u64)t__2e252;
+	t__2e256 = (u64)(*(u64 *)t_binding_2e250);
+	t__2e255 = (u64)(u32)((BD(t__2e256) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e255) goto L_passed_2e254; else goto L_failed_2e253;
+	L_failed_2e253:;
+	t_abortsite_2e201 = ((u64)6UL);
+	goto L_abort_2e202;
+	L_passed_2e254:;
+	t__2e258 = (u64)(*(u32 *)t_binding_2e249);
+	t__2e259 = (u64)(u32)((i32)BF(t__2e258));
+	*(u8 *)t_binding_2e257 = (u8)t__2e259;
+	t__2e263 = (u64)(u32)(*(i8 *)t_binding_2e257);
+	t__2e264 = (u64)(u32)((i64)(i8)t__2e263);
+	t__2e265 = (u64)(u32)((i64)(i8)((u64)20UL));
+	t__2e262 = (u64)(u32)(((u32)t__2e264 == (u32)t__2e265));
+	if ((u32)t__2e262) goto L_passed_2e261; else goto L_failed_2e260;
+	L_failed_2e260:;
+	t_abortsite_2e201 = ((u64)7UL);
+	goto L_abort_2e202;
+	L_passed_2e261:;
+	t__2e267 = (u64)(*(u32 *)t_binding_2e249);
+	t__2e268 = (u64)(u32)((i32)BF(t__2e267));
+	*(u16 *)t_binding_2e266 = (u16)t__2e268;
+	t__2e272 = (u64)(u32)(*(i16 *)t_binding_2e266);
+	t__2e273 = (u64)(u32)((i64)(i16)t__2e272);
+	t__2e274 = (u64)(u32)((i64)(i16)((u64)20UL));
+	t__2e271 = (u64)(u32)(((u32)t__2e273 == (u32)t__2e274));
+	if ((u32)t__2e271) goto L_passed_2e270; else goto L_failed_2e269;
+	L_failed_2e269:;
+	t_abortsite_2e201 = ((u64)8UL);
+	goto L_abort_2e202;
+	L_passed_2e270:;
+	t__2e276 = (u64)(*(u32 *)t_binding_2e249);
+	t__2e277 = (u64)(u32)((i32)BF(t__2e276));
+	*(u16 *)t_binding_2e275 = (u16)t__2e277;
+	t__2e281 = (u64)(u32)(*(i16 *)t_binding_2e275);
+	t__2e282 = (u64)(u32)((i64)(i16)t__2e281);
+	t__2e283 = (u64)(u32)((i64)(i16)((u64)20UL));
+	t__2e280 = (u64)(u32)(((u32)t__2e282 == (u32)t__2e283));
+	if ((u32)t__2e280) goto L_passed_2e279; else goto L_failed_2e278;
+	L_failed_2e278:;
+	t_abortsite_2e201 = ((u64)9UL);
+	goto L_abort_2e202;
+	L_passed_2e279:;
+	t__2e285 = (u64)(*(u32 *)t_binding_2e249);
+	t__2e286 = (u64)(u32)((i32)BF(t__2e285));
+	*(u32 *)t_binding_2e284 = (u32)t__2e286;
+	t__2e290 = (u64)(u32)(*(i32 *)t_binding_2e284);
+	t__2e289 = (u64)(u32)(((u32)t__2e290 == (u32)((u64)20UL)));
+	if ((u32)t__2e289) goto L_passed_2e288; else goto L_failed_2e287;
+	L_failed_2e287:;
+	t_abortsite_2e201 = ((u64)10UL);
+	goto L_abort_2e202;
+	L_passed_2e288:;
+	t__2e292 = (u64)(*(u32 *)t_binding_2e249);
+	t__2e293 = (u64)((i64)BF(t__2e292));
+	*(u64 *)t_binding_2e291 = (u64)t__2e293;
+	t__2e297 = (u64)(*(u64 *)t_binding_2e291);
+	t__2e296 = (u64)(u32)(((u64)t__2e297 == (u64)((u64)20UL)));
+	if ((u32)t__2e296) goto L_passed_2e295; else goto L_failed_2e294;
+	L_failed_2e294:;
+	t_abortsite_2e201 = ((u64)11UL);
+	goto L_abort_2e202;
+	L_passed_2e295:;
+	*(u8 *)t_binding_2e298 = (u8)((u64)20UL);
+	t__2e300 = (u64)(u32)(*(i8 *)t_binding_2e298);
+	t__2e302 = (u64)(u32)((i64)(i8)t__2e300);
+	t__2e301 = FB((float)(i32)t__2e302);
+	*(u32 *)t_binding_2e299 = (u32)t__2e301;
+	t__2e306 = (u64)(*(u32 *)t_binding_2e299);
+	t__2e305 = (u64)(u32)((BF(t__2e306) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e305) goto L_passed_2e304; else goto L_failed_2e303;
+	L_failed_2e303:;
+	t_abortsite_2e201 = ((u64)12UL);
+	goto L_abort_2e202;
+	L_passed_2e304:;
+	t__2e308 = (u64)(u32)(*(i8 *)t_binding_2e298);
+	t__2e310 = (u64)(u32)((i64)(i8)t__2e308);
+	t__2e309 = DB((double)(i32)t__2e310);
+	*(u64 *)t_binding_2e307 = (u64)t__2e309;
+	t__2e314 = (u64)(*(u64 *)t_binding_2e307);
+	t__2e313 = (u64)(u32)((BD(t__2e314) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e313) goto L_passed_2e312; else goto L_failed_2e311;
+	L_failed_2e311:;
+	t_abortsite_2e201 = ((u64)13UL);
+	goto L_abort_2e202;
+	L_passed_2e312:;
+	*(u16 *)t_binding_2e315 = (u16)((u64)20UL);
+	t__2e317 = (u64)(u32)(*(i16 *)t_binding_2e315);
+	t__2e319 = (u64)(u32)((i64)(i16)t__2e317);
+	t__2e318 = FB((float)(i32)t__2e319);
+	*(u32 *)t_binding_2e316 = (u32)t__2e318;
+	t__2e323 = (u64)(*(u32 *)t_binding_2e316);
+	t__2e322 = (u64)(u32)((BF(t__2e323) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e322) goto L_passed_2e321; else goto L_failed_2e320;
+	L_failed_2e320:;
+	t_abortsite_2e201 = ((u64)14UL);
+	goto L_abort_2e202;
+	L_passed_2e321:;
+	t__2e325 = (u64)(u32)(*(i16 *)t_binding_2e315);
+	t__2e327 = (u64)(u32)((i64)(i16)t__2e325);
+	t__2e326 = DB((double)(i32)t__2e327);
+	*(u64 *)t_binding_2e324 = (u64)t__2e326;
+	t__2e331 = (u64)(*(u64 *)t_binding_2e324);
+	t__2e330 = (u64)(u32)((BD(t__2e331) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e330) goto L_passed_2e329; else goto L_failed_2e328;
+	L_failed_2e328:;
+	t_abortsite_2e201 = ((u64)15UL);
+	goto L_abort_2e202;
+	L_passed_2e329:;
+	*(u32 *)t_binding_2e332 = (u32)((u64)20UL);
+	t__2e334 = (u64)(u32)(*(i32 *)t_binding_2e332);
+	t__2e335 = FB((float)(i32)t__2e334);
+	*(u32 *)t_binding_2e333 = (u32)t__2e335;
+	t__2e339 = (u64)(*(u32 *)t_binding_2e333);
+	t__2e338 = (u64)(u32)((BF(t__2e339) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e338) goto L_passed_2e337; else goto L_failed_2e336;
+	L_failed_2e336:;
+	t_abortsite_2e201 = ((u64)16UL);
+	goto L_abort_2e202;
+	L_passed_2e337:;
+	t__2e341 = (u64)(u32)(*(i32 *)t_binding_2e332);
+	t__2e342 = DB((double)(i32)t__2e341);
+	*(u64 *)t_binding_2e340 = (u64)t__2e342;
+	t__2e346 = (u64)(*(u64 *)t_binding_2e340);
+	t__2e345 = (u64)(u32)((BD(t__2e346) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e345) goto L_passed_2e344; else goto L_failed_2e343;
+	L_failed_2e343:;
+	t_abortsite_2e201 = ((u64)17UL);
+	goto L_abort_2e202;
+	L_passed_2e344:;
+	*(u64 *)t_binding_2e347 = (u64)((u64)20UL);
+	t__2e349 = (u64)(*(u64 *)t_binding_2e347);
+	t__2e350 = FB((float)(i64)t__2e349);
+	*(u32 *)t_binding_2e348 = (u32)t__2e350;
+	t__2e354 = (u64)(*(u32 *)t_binding_2e348);
+	t__2e353 = (u64)(u32)((BF(t__2e354) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e353) goto L_passed_2e352; else goto L_failed_2e351;
+	L_failed_2e351:;
+	t_abortsite_2e201 = ((u64)18UL);
+	goto L_abort_2e202;
+	L_passed_2e352:;
+	t__2e356 = (u64)(*(u64 *)t_binding_2e347);
+	t__2e357 = DB((double)(i64)t__2e356);
+	*(u64 *)t_binding_2e355 = (u64)t__2e357;
+	t__2e361 = (u64)(*(u64 *)t_binding_2e355);
+	t__2e360 = (u64)(u32)((BD(t__2e361) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e360) goto L_passed_2e359; else goto L_failed_2e358;
+	L_failed_2e358:;
+	t_abortsite_2e201 = ((u64)19UL);
+	goto L_abort_2e202;
+	L_passed_2e359:;
+	t__2e363 = FB((float)(i32)((u64)20UL));
+	*(u32 *)t_binding_2e362 = (u32)t__2e363;
+	t__2e367 = (u64)(*(u32 *)t_binding_2e362);
+	t__2e366 = (u64)(u32)((BF(t__2e367) == BF(((u64)1101004800UL))));
+	if ((u32)t__2e366) goto L_passed_2e365; else goto L_failed_2e364;
+	L_failed_2e364:;
+	t_abortsite_2e201 = ((u64)20UL);
+	goto L_abort_2e202;
+	L_passed_2e365:;
+	t__2e369 = DB((double)(i32)((u64)20UL));
+	*(u64 *)t_binding_2e368 = (u64)t__2e369;
+	t__2e373 = (u64)(*(u64 *)t_binding_2e368);
+	t__2e372 = (u64)(u32)((BD(t__2e373) == BD(((u64)4626322717216342016UL))));
+	if ((u32)t__2e372) goto L_passed_2e371; else goto L_failed_2e370;
+	L_failed_2e370:;
+	t_abortsite_2e201 = ((u64)21UL);
+	goto L_abort_2e202;
+	L_passed_2e371:;
+	t__2e375 = (u64)(u32)((i32)BD(((u64)4623716258932001341UL)));
+	*(u32 *)t_binding_2e374 = (u32)t__2e375;
+	t__2e379 = (u64)(u32)(*(i32 *)t_binding_2e374);
+	t__2e378 = (u64)(u32)(((u32)t__2e379 == (u32)((u64)13UL)));
+	if ((u32)t__2e378) goto L_passed_2e377; else goto L_failed_2e376;
+	L_failed_2e376:;
+	t_abortsite_2e201 = ((u64)22UL);
+	goto L_abort_2e202;
+	L_passed_2e377:;
+	goto L__2e190;
+	L__2e380:;
+	L__2e190:;
+	return;
+	L_abort_2e202:;
+	t__2e203 = (u64)((u64)t_abortsite_2e201 * (u64)((u64)16UL));
+	t__2e203 = (u64)((u64)((u64)((char *)&D_abortsites_2e200)) + (u64)t__2e203);
+	t__2e204 = (u64)(*(u64 *)t__2e203);
+	t__2e205 = (u64)((u64)t__2e203 + (u64)((u64)8UL));
+	t__2e206 = (u64)(*(u32 *)t__2e205);
+	t__2e205 = (u64)((u64)t__2e203 + (u64)((u64)12UL));
+	t__2e207 = (u64)(*(u32 *)t__2e205);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e204, (u64)t__2e206, (u64)t__2e207, (u64)((u64)6UL));
+	__builtin_trap();
+}
+static void F_measurements(void) {
+	u64 t__2e387;
+	u64 t__2e391;
+	u64 t__2e392;
+	u64 t__2e393;
+	u64 t__2e394;
+	u64 t__2e395;
+	u64 t__2e398;
+	u64 t_abortsite_2e389;
+	L_start_2e381:;
+	L_body_2e382:;
+	t__2e387 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e387) goto L_passed_2e386; else goto L_failed_2e385;
+	L_failed_2e385:;
+	t_abortsite_2e389 = ((u64)0UL);
+	goto L_abort_2e390;
+	L_passed_2e386:;
+	t__2e398 = (u64)(u32)(((u64)((u64)4UL) == (u64)((u64)4UL)));
+	if ((u32)t__2e398) goto L_passed_2e397; else goto L_failed_2e396;
+	L_failed_2e396:;
+	t_abortsite_2e389 = ((u64)1UL);
+	goto L_abort_2e390;
+	L_passed_2e397:;
+	goto L__2e383;
+	L__2e399:;
+	L__2e383:;
+	return;
+	L_abort_2e390:;
+	t__2e391 = (u64)((u64)t_abortsite_2e389 * (u64)((u64)16UL));
+	t__2e391 = (u64)((u64)((u64)((char *)&D_abortsites_2e388)) + (u64)t__2e391);
+	t__2e392 = (u64)(*(u64 *)t__2e391);
+	t__2e393 = (u64)((u64)t__2e391 + (u64)((u64)8UL));
+	t__2e394 = (u64)(*(u32 *)t__2e393);
+	t__2e393 = (u64)((u64)t__2e391 + (u64)((u64)12UL));
+	t__2e395 = (u64)(*(u32 *)t__2e393);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e392, (u64)t__2e394, (u64)t__2e395, (u64)((u64)6UL));
+	__builtin_trap();
+}
@@ -0,0 +1,1376 @@
+typedef unsigned long u64; typedef long i64;
+typedef unsigned int u32; typedef int i32;
+typedef unsigned short u16; typedef short i16;
+typedef unsigned char u8; typedef signed char i8;
+typedef __builtin_va_list va_list;
+union fb { float f; u32 u; }; union db { double d; u64 u; };
+static inline float BF(u64 x) { union fb v; v.u = (u32)x; return v.f; }
+static inline double BD(u64 x) { union db v; v.u = x; return v.d; }
+static inline u64 FB(float f) { union fb v; v.f = f; return v.u; }
+static inline u64 DB(double d) { union db v; v.d = d; return v.u; }
+static void BLIT(u64 d, u64 s, u64 n) { volatile u8 *dp = (u8 *)d; const u8 *sp = (const u8 *)s; for (u64 i = 0; i < n; i++) dp[i] = sp[i]; }
+struct gpva { u32 gp, fp; void *ov, *rs; };
+
+extern char X_rt_2eabort__fixed[] __asm__("rt.abort_fixed");
+extern char X_rt_2ecompile[] __asm__("rt.compile");
+struct __attribute__((packed)) S_strdata_2e0 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e1 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e19 { u8 f0; u8 f1; u8 f2; u8 f3[24]; u8 f4; u8 f5; };
+struct __attribute__((packed)) S_strliteral_2e20 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e27 { u8 f0[18]; };
+struct __attribute__((packed)) S_strliteral_2e28 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e63 { u8 f0[19]; };
+struct __attribute__((packed)) S_strliteral_2e64 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e82 { u8 f0; u8 f1; u8 f2; u8 f3[15]; u8 f4; u8 f5; };
+struct __attribute__((packed)) S_strliteral_2e83 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e87 { u8 f0[8]; };
+struct __attribute__((packed)) S_strliteral_2e88 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e106 { u8 f0; u8 f1; u8 f2; u8 f3[19]; u8 f4; u8 f5; u8 f6; u8 f7[31]; u8 f8; u8 f9; u8 f10; u8 f11[19]; u8 f12; u8 f13; u8 f14; u8 f15[16]; u8 f16; u8 f17; };
+struct __attribute__((packed)) S_strliteral_2e107 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e111 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e112 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e130 { u8 f0; u8 f1; u8 f2; u8 f3[23]; u8 f4; u8 f5; u8 f6; u8 f7[31]; u8 f8; u8 f9; u8 f10; u8 f11[19]; u8 f12; u8 f13; u8 f14; u8 f15[16]; u8 f16; u8 f17; };
+struct __attribute__((packed)) S_strliteral_2e131 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e135 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e136 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e154 { u8 f0; u8 f1; u8 f2; u8 f3[22]; u8 f4; u8 f5; u8 f6; u8 f7[33]; u8 f8; u8 f9; u8 f10; u8 f11[19]; u8 f12; u8 f13; u8 f14; u8 f15[17]; u8 f16; u8 f17; };
+struct __attribute__((packed)) S_strliteral_2e155 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e159 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e160 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e178 { u8 f0; u8 f1; u8 f2; u8 f3[21]; u8 f4; u8 f5; u8 f6; u8 f7[31]; u8 f8; u8 f9; u8 f10; u8 f11[19]; u8 f12; u8 f13; u8 f14; u8 f15[17]; u8 f16; u8 f17; };
+struct __attribute__((packed)) S_strliteral_2e179 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e183 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e184 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e202 { u8 f0; u8 f1; u8 f2; u8 f3[19]; u8 f4; u8 f5; };
+struct __attribute__((packed)) S_strliteral_2e203 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e224 { u8 f0; u8 f1; u8 f2; u8 f3[21]; u8 f4; u8 f5; };
+struct __attribute__((packed)) S_strliteral_2e225 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e229 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e230 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e248 { u8 f0; u8 f1; u8 f2; u8 f3[21]; u8 f4; u8 f5; u8 f6; u8 f7[33]; u8 f8; u8 f9; u8 f10; u8 f11[19]; u8 f12; u8 f13; u8 f14; u8 f15[17]; u8 f16; u8 f17; };
+struct __attribute__((packed)) S_strliteral_2e249 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e253 { u8 f0[17]; };
+struct __attribute__((packed)) S_strliteral_2e254 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e272 { u8 f0; u8 f1; u8 f2; u8 f3[22]; u8 f4; u8 f5; u8 f6; u8 f7[33]; u8 f8; u8 f9; u8 f10; u8 f11[19]; u8 f12; u8 f13; u8 f14; u8 f15[17]; u8 f16; u8 f17; };
+struct __attribute__((packed)) S_strliteral_2e273 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e277 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e278 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e296 { u8 f0; u8 f1; u8 f2; u8 f3[21]; u8 f4; u8 f5; u8 f6; u8 f7[23]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e297 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e301 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e302 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e320 { u8 f0; u8 f1; u8 f2; u8 f3[21]; u8 f4; u8 f5; u8 f6; u8 f7[23]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e321 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e325 { u8 f0[16]; };
+struct __attribute__((packed)) S_strliteral_2e326 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e41 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; char *f12; u32 f13; u32 f14; char *f15; u32 f16; u32 f17; char *f18; u32 f19; u32 f20; char *f21; u32 f22; u32 f23; char *f24; u32 f25; u32 f26; char *f27; u32 f28; u32 f29; char *f30; u32 f31; u32 f32; char *f33; u32 f34; u32 f35; char *f36; u32 f37; u32 f38; char *f39; u32 f40; u32 f41; char *f42; u32 f43; u32 f44; char *f45; u32 f46; u32 f47; char *f48; u32 f49; u32 f50; char *f51; u32 f52; u32 f53; char *f54; u32 f55; u32 f56; char *f57; u32 f58; u32 f59; char *f60; u32 f61; u32 f62; char *f63; u32 f64; u32 f65; char *f66; u32 f67; u32 f68; char *f69; u32 f70; u32 f71; char *f72; u32 f73; u32 f74; char *f75; u32 f76; u32 f77; };
+struct __attribute__((packed)) S_strdata_2e349 { u8 f0; u8 f1; u8 f2; u8 f3[19]; u8 f4; u8 f5; u8 f6; u8 f7[31]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e350 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e354 { u8 f0[14]; };
+struct __attribute__((packed)) S_strliteral_2e355 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_strdata_2e387 { u8 f0; u8 f1; u8 f2; u8 f3[19]; u8 f4; u8 f5; u8 f6; u8 f7[31]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e388 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e368 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_strdata_2e412 { u8 f0; u8 f1; u8 f2; u8 f3[28]; u8 f4; u8 f5; };
+struct __attribute__((packed)) S_strliteral_2e413 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e429 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; char *f6; u32 f7; u32 f8; char *f9; u32 f10; u32 f11; };
+struct __attribute__((packed)) S_strdata_2e471 { u8 f0; u8 f1; u8 f2; u8 f3[11]; u8 f4; u8 f5; u8 f6; u8 f7[22]; u8 f8; u8 f9; };
+struct __attribute__((packed)) S_strliteral_2e472 { char *f0; u64 f1; u64 f2; };
+struct __attribute__((packed)) S_abortsites_2e488 { char *f0; u32 f1; u32 f2; char *f3; u32 f4; u32 f5; };
+static const struct S_strdata_2e0 D_strdata_2e0 __asm__("strdata.0") __attribute__((used, section(".rodata.strdata.0"), aligned(8)));
+static struct S_strliteral_2e1 D_strliteral_2e1 __asm__("strliteral.1") __attribute__((used, section(".data.rel.ro.strliteral.1"), aligned(8)));
+static const struct S_strdata_2e19 D_strdata_2e19 __asm__("strdata.19") __attribute__((used, section(".rodata.strdata.19"), aligned(8)));
+static struct S_strliteral_2e20 D_strliteral_2e20 __asm__("strliteral.20") __attribute__((used, section(".data.rel.ro.strliteral.20"), aligned(8)));
+static const struct S_strdata_2e27 D_strdata_2e27 __asm__("strdata.27") __attribute__((used, section(".rodata.strdata.27"), aligned(8)));
+static struct S_strliteral_2e28 D_strliteral_2e28 __asm__("strliteral.28") __attribute__((used, section(".data.rel.ro.strliteral.28"), aligned(8)));
+static const struct S_strdata_2e63 D_strdata_2e63 __asm__("strdata.63") __attribute__((used, section(".rodata.strdata.63"), aligned(8)));
+static struct S_strliteral_2e64 D_strliteral_2e64 __asm__("strliteral.64") __attribute__((used, section(".data.rel.ro.strliteral.64"), aligned(8)));
+static const struct S_strdata_2e82 D_strdata_2e82 __asm__("strdata.82") __attribute__((used, section(".rodata.strdata.82"), aligned(8)));
+static struct S_strliteral_2e83 D_strliteral_2e83 __asm__("strliteral.83") __attribute__((used, section(".data.rel.ro.strliteral.83"), aligned(8)));
+static const struct S_strdata_2e87 D_strdata_2e87 __asm__("strdata.87") __attribute__((used, section(".rodata.strdata.87"), aligned(8)));
+static struct S_strliteral_2e88 D_strliteral_2e88 __asm__("strliteral.88") __attribute__((used, section(".data.rel.ro.strliteral.88"), aligned(8)));
+static const struct S_strdata_2e106 D_strdata_2e106 __asm__("strdata.106") __attribute__((used, section(".rodata.strdata.106"), aligned(8)));
+static struct S_strliteral_2e107 D_strliteral_2e107 __asm__("strliteral.107") __attribute__((used, section(".data.rel.ro.strliteral.107"), aligned(8)));
+static const struct S_strdata_2e111 D_strdata_2e111 __asm__("strdata.111") __attribute__((used, section(".rodata.strdata.111"), aligned(8)));
+static struct S_strliteral_2e112 D_strliteral_2e112 __asm__("strliteral.112") __attribute__((used, section(".data.rel.ro.strliteral.112"), aligned(8)));
+static const struct S_strdata_2e130 D_strdata_2e130 __asm__("strdata.130") __attribute__((used, section(".rodata.strdata.130"), aligned(8)));
+static struct S_strliteral_2e131 D_strliteral_2e131 __asm__("strliteral.131") __attribute__((used, section(".data.rel.ro.strliteral.131"), aligned(8)));
+static const struct S_strdata_2e135 D_strdata_2e135 __asm__("strdata.135") __attribute__((used, section(".rodata.strdata.135"), aligned(8)));
+static struct S_strliteral_2e136 D_strliteral_2e136 __asm__("strliteral.136") __attribute__((used, section(".data.rel.ro.strliteral.136"), aligned(8)));
+static const struct S_strdata_2e154 D_strdata_2e154 __asm__("strdata.154") __attribute__((used, section(".rodata.strdata.154"), aligned(8)));
+static struct S_strliteral_2e155 D_strliteral_2e155 __asm__("strliteral.155") __attribute__((used, section(".data.rel.ro.strliteral.155"), aligned(8)));
+static const struct S_strdata_2e159 D_strdata_2e159 __asm__("strdata.159") __attribute__((used, section(".rodata.strdata.159"), aligned(8)));
+static struct S_strliteral_2e160 D_strliteral_2e160 __asm__("strliteral.160") __attribute__((used, section(".data.rel.ro.strliteral.160"), aligned(8)));
+static const struct S_strdata_2e178 D_strdata_2e178 __asm__("strdata.178") __attribute__((used, section(".rodata.strdata.178"), aligned(8)));
+static struct S_strliteral_2e179 D_strliteral_2e179 __asm__("strliteral.179") __attribute__((used, section(".data.rel.ro.strliteral.179"), aligned(8)));
+static const struct S_strdata_2e183 D_strdata_2e183 __asm__("strdata.183") __attribute__((used, section(".rodata.strdata.183"), aligned(8)));
+static struct S_strliteral_2e184 D_strliteral_2e184 __asm__("strliteral.184") __attribute__((used, section(".data.rel.ro.strliteral.184"), aligned(8)));
+static const struct S_strdata_2e202 D_strdata_2e202 __asm__("strdata.202") __attribute__((used, section(".rodata.strdata.202"), aligned(8)));
+static struct S_strliteral_2e203 D_strliteral_2e203 __asm__("strliteral.203") __attribute__((used, section(".data.rel.ro.strliteral.203"), aligned(8)));
+static const struct S_strdata_2e224 D_strdata_2e224 __asm__("strdata.224") __attribute__((used, section(".rodata.strdata.224"), aligned(8)));
+static struct S_strliteral_2e225 D_strliteral_2e225 __asm__("strliteral.225") __attribute__((used, section(".data.rel.ro.strliteral.225"), aligned(8)));
+static const struct S_strdata_2e229 D_strdata_2e229 __asm__("strdata.229") __attribute__((used, section(".rodata.strdata.229"), aligned(8)));
+static struct S_strliteral_2e230 D_strliteral_2e230 __asm__("strliteral.230") __attribute__((used, section(".data.rel.ro.strliteral.230"), aligned(8)));
+static const struct S_strdata_2e248 D_strdata_2e248 __asm__("strdata.248") __attribute__((used, section(".rodata.strdata.248"), aligned(8)));
+static struct S_strliteral_2e249 D_strliteral_2e249 __asm__("strliteral.249") __attribute__((used, section(".data.rel.ro.strliteral.249"), aligned(8)));
+static const struct S_strdata_2e253 D_strdata_2e253 __asm__("strdata.253") __attribute__((used, section(".rodata.strdata.253"), aligned(8)));
+static struct S_strliteral_2e254 D_strliteral_2e254 __asm__("strliteral.254") __attribute__((used, section(".data.rel.ro.strliteral.254"), aligned(8)));
+static const struct S_strdata_2e272 D_strdata_2e272 __asm__("strdata.272") __attribute__((used, section(".rodata.strdata.272"), aligned(8)));
+static struct S_strliteral_2e273 D_strliteral_2e273 __asm__("strliteral.273") __attribute__((used, section(".data.rel.ro.strliteral.273"), aligned(8)));
+static const struct S_strdata_2e277 D_strdata_2e277 __asm__("strdata.277") __attribute__((used, section(".rodata.strdata.277"), aligned(8)));
+static struct S_strliteral_2e278 D_strliteral_2e278 __asm__("strliteral.278") __attribute__((used, section(".data.rel.ro.strliteral.278"), aligned(8)));
+static const struct S_strdata_2e296 D_strdata_2e296 __asm__("strdata.296") __attribute__((used, section(".rodata.strdata.296"), aligned(8)));
+static struct S_strliteral_2e297 D_strliteral_2e297 __asm__("strliteral.297") __attribute__((used, section(".data.rel.ro.strliteral.297"), aligned(8)));
+static const struct S_strdata_2e301 D_strdata_2e301 __asm__("strdata.301") __attribute__((used, section(".rodata.strdata.301"), aligned(8)));
+static struct S_strliteral_2e302 D_strliteral_2e302 __asm__("strliteral.302") __attribute__((used, section(".data.rel.ro.strliteral.302"), aligned(8)));
+static const struct S_strdata_2e320 D_strdata_2e320 __asm__("strdata.320") __attribute__((used, section(".rodata.strdata.320"), aligned(8)));
+static struct S_strliteral_2e321 D_strliteral_2e321 __asm__("strliteral.321") __attribute__((used, section(".data.rel.ro.strliteral.321"), aligned(8)));
+static const struct S_strdata_2e325 D_strdata_2e325 __asm__("strdata.325") __attribute__((used, section(".rodata.strdata.325"), aligned(8)));
+static struct S_strliteral_2e326 D_strliteral_2e326 __asm__("strliteral.326") __attribute__((used, section(".data.rel.ro.strliteral.326"), aligned(8)));
+static struct S_abortsites_2e41 D_abortsites_2e41 __asm__("abortsites.41") __attribute__((used, section(".data.rel.ro.abortsites.41"), aligned(8)));
+static const struct S_strdata_2e349 D_strdata_2e349 __asm__("strdata.349") __attribute__((used, section(".rodata.strdata.349"), aligned(8)));
+static struct S_strliteral_2e350 D_strliteral_2e350 __asm__("strliteral.350") __attribute__((used, section(".data.rel.ro.strliteral.350"), aligned(8)));
+static const struct S_strdata_2e354 D_strdata_2e354 __asm__("strdata.354") __attribute__((used, section(".rodata.strdata.354"), aligned(8)));
+static struct S_strliteral_2e355 D_strliteral_2e355 __asm__("strliteral.355") __attribute__((used, section(".data.rel.ro.strliteral.355"), aligned(8)));
+static const struct S_strdata_2e387 D_strdata_2e387 __asm__("strdata.387") __attribute__((used, section(".rodata.strdata.387"), aligned(8)));
+static struct S_strliteral_2e388 D_strliteral_2e388 __asm__("strliteral.388") __attribute__((used, section(".data.rel.ro.strliteral.388"), aligned(8)));
+static struct S_abortsites_2e368 D_abortsites_2e368 __asm__("abortsites.368") __attribute__((used, section(".data.rel.ro.abortsites.368"), aligned(8)));
+static const struct S_strdata_2e412 D_strdata_2e412 __asm__("strdata.412") __attribute__((used, section(".rodata.strdata.412"), aligned(8)));
+static struct S_strliteral_2e413 D_strliteral_2e413 __asm__("strliteral.413") __attribute__((used, section(".data.rel.ro.strliteral.413"), aligned(8)));
+static struct S_abortsites_2e429 D_abortsites_2e429 __asm__("abortsites.429") __attribute__((used, section(".data.rel.ro.abortsites.429"), aligned(8)));
+static const struct S_strdata_2e471 D_strdata_2e471 __asm__("strdata.471") __attribute__((used, section(".rodata.strdata.471"), aligned(8)));
+static struct S_strliteral_2e472 D_strliteral_2e472 __asm__("strliteral.472") __attribute__((used, section(".data.rel.ro.strliteral.472"), aligned(8)));
+static struct S_abortsites_2e488 D_abortsites_2e488 __asm__("abortsites.488") __attribute__((used, section(".data.rel.ro.abortsites.488"), aligned(8)));
+void F_main(void) __asm__("main") __attribute__((used, section(".text.main")));
+static void F_compatibility(void) __asm__("compatibility") __attribute__((used, section(".text.compatibility")));
+static void F_optional(void) __asm__("optional") __attribute__((used, section(".text.optional")));
+static void F_mandatory(void) __asm__("mandatory") __attribute__((used, section(".text.mandatory")));
+static void F_import(void) __asm__("import") __attribute__((used, section(".text.import")));
+static const struct S_strdata_2e0 D_strdata_2e0 = { "\164\145\163\164\163\057\063\066\055\144\145\146\151\156\145\163\056\150\141" };
+static struct S_strliteral_2e1 D_strliteral_2e1 = { (char *)((char *)&D_strdata_2e0) + 0, 19U, 19U };
+static const struct S_strdata_2e19 D_strdata_2e19 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\072\040\151\156\164\040\075\040\060\073", 10U, 9U };
+static struct S_strliteral_2e20 D_strliteral_2e20 = { (char *)((char *)&D_strdata_2e19) + 0, 29U, 29U };
+static const struct S_strdata_2e27 D_strdata_2e27 = { "\055\104\124\105\123\124\104\105\106\111\116\105\072\151\156\164\075\061" };
+static struct S_strliteral_2e28 D_strliteral_2e28 = { (char *)((char *)&D_strdata_2e27) + 0, 18U, 18U };
+static const struct S_strdata_2e63 D_strdata_2e63 = { "\055\104\124\105\123\124\104\105\106\111\116\105\072\165\151\156\164\075\061" };
+static struct S_strliteral_2e64 D_strliteral_2e64 = { (char *)((char *)&D_strdata_2e63) + 0, 19U, 19U };
+static const struct S_strdata_2e82 D_strdata_2e82 = { 10U, 9U, 9U, "\143\157\156\163\164\040\124\105\123\124\040\075\040\061\073", 10U, 9U };
+static struct S_strliteral_2e83 D_strliteral_2e83 = { (char *)((char *)&D_strdata_2e82) + 0, 20U, 20U };
+static const struct S_strdata_2e87 D_strdata_2e87 = { "\055\104\124\105\123\124\075\060" };
+static struct S_strliteral_2e88 D_strliteral_2e88 = { (char *)((char *)&D_strdata_2e87) + 0, 8U, 8U };
+static const struct S_strdata_2e106 D_strdata_2e106 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\060\073", 10U, 9U, 9U, "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\124\105\123\124\104\105\106\111\116\105\040\075\075\040\061\051\073", 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\124\105\123\124\104\105\106\111\116\105\073", 10U, 9U, 9U, "\154\145\164\040\171\072\040\052\165\070\040\075\040\046\170\073", 10U, 9U };
+static struct S_strliteral_2e107 D_strliteral_2e107 = { (char *)((char *)&D_strdata_2e106) + 0, 99U, 99U };
+static const struct S_strdata_2e111 D_strdata_2e111 = { "\055\104\124\105\123\124\104\105\106\111\116\105\072\165\070\075\061" };
+static struct S_strliteral_2e112 D_strliteral_2e112 = { (char *)((char *)&D_strdata_2e111) + 0, 17U, 17U };
+static const struct S_strdata_2e130 D_strdata_2e130 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\072\040\165\070\040\075\040\060\073", 10U, 9U, 9U, "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\124\105\123\124\104\105\106\111\116\105\040\075\075\040\061\051\073", 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\124\105\123\124\104\105\106\111\116\105\073", 10U, 9U, 9U, "\154\145\164\040\171\072\040\052\165\070\040\075\040\046\170\073", 10U, 9U };
+static struct S_strliteral_2e131 D_strliteral_2e131 = { (char *)((char *)&D_strdata_2e130) + 0, 103U, 103U };
+static const struct S_strdata_2e135 D_strdata_2e135 = { "\055\104\124\105\123\124\104\105\106\111\116\105\075\061" };
+static struct S_strliteral_2e136 D_strliteral_2e136 = { (char *)((char *)&D_strdata_2e135) + 0, 14U, 14U };
+static const struct S_strdata_2e154 D_strdata_2e154 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\060\165\063\062\073", 10U, 9U, 9U, "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\124\105\123\124\104\105\106\111\116\105\040\075\075\040\047\141\047\051\073", 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\124\105\123\124\104\105\106\111\116\105\073", 10U, 9U, 9U, "\154\145\164\040\171\072\040\052\165\063\062\040\075\040\046\170\073", 10U, 9U };
+static struct S_strliteral_2e155 D_strliteral_2e155 = { (char *)((char *)&D_strdata_2e154) + 0, 105U, 105U };
+static const struct S_strdata_2e159 D_strdata_2e159 = { "\055\104\124\105\123\124\104\105\106\111\116\105\075\047\141\047" };
+static struct S_strliteral_2e160 D_strliteral_2e160 = { (char *)((char *)&D_strdata_2e159) + 0, 16U, 16U };
+static const struct S_strdata_2e178 D_strdata_2e178 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\047\141\047\073", 10U, 9U, 9U, "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\124\105\123\124\104\105\106\111\116\105\040\075\075\040\060\051\073", 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\124\105\123\124\104\105\106\111\116\105\073", 10U, 9U, 9U, "\154\145\164\040\171\072\040\052\165\063\062\040\075\040\046\170\073", 10U, 9U };
+static struct S_strliteral_2e179 D_strliteral_2e179 = { (char *)((char *)&D_strdata_2e178) + 0, 102U, 102U };
+static const struct S_strdata_2e183 D_strdata_2e183 = { "\055\104\124\105\123\124\104\105\106\111\116\105\075\060\165\063\062" };
+static struct S_strliteral_2e184 D_strliteral_2e184 = { (char *)((char *)&D_strdata_2e183) + 0, 17U, 17U };
+static const struct S_strdata_2e202 D_strdata_2e202 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\060\073", 10U, 9U };
+static struct S_strliteral_2e203 D_strliteral_2e203 = { (char *)((char *)&D_strdata_2e202) + 0, 24U, 24U };
+static const struct S_strdata_2e224 D_strdata_2e224 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\060\056\060\073", 10U, 9U };
+static struct S_strliteral_2e225 D_strliteral_2e225 = { (char *)((char *)&D_strdata_2e224) + 0, 26U, 26U };
+static const struct S_strdata_2e229 D_strdata_2e229 = { "\055\104\124\105\123\124\104\105\106\111\116\105\075\060" };
+static struct S_strliteral_2e230 D_strliteral_2e230 = { (char *)((char *)&D_strdata_2e229) + 0, 14U, 14U };
+static const struct S_strdata_2e248 D_strdata_2e248 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\060\056\060\073", 10U, 9U, 9U, "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\124\105\123\124\104\105\106\111\116\105\040\075\075\040\061\056\060\051\073", 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\124\105\123\124\104\105\106\111\116\105\073", 10U, 9U, 9U, "\154\145\164\040\171\072\040\052\146\063\062\040\075\040\046\170\073", 10U, 9U };
+static struct S_strliteral_2e249 D_strliteral_2e249 = { (char *)((char *)&D_strdata_2e248) + 0, 104U, 104U };
+static const struct S_strdata_2e253 D_strdata_2e253 = { "\055\104\124\105\123\124\104\105\106\111\116\105\075\061\146\063\062" };
+static struct S_strliteral_2e254 D_strliteral_2e254 = { (char *)((char *)&D_strdata_2e253) + 0, 17U, 17U };
+static const struct S_strdata_2e272 D_strdata_2e272 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\060\146\063\062\073", 10U, 9U, 9U, "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\124\105\123\124\104\105\106\111\116\105\040\075\075\040\061\056\060\051\073", 10U, 9U, 9U, "\154\145\164\040\170\040\075\040\124\105\123\124\104\105\106\111\116\105\073", 10U, 9U, 9U, "\154\145\164\040\171\072\040\052\146\063\062\040\075\040\046\170\073", 10U, 9U };
+static struct S_strliteral_2e273 D_strliteral_2e273 = { (char *)((char *)&D_strdata_2e272) + 0, 105U, 105U };
+static const struct S_strdata_2e277 D_strdata_2e277 = { "\055\104\124\105\123\124\104\105\106\111\116\105\075\061\056\060" };
+static struct S_strliteral_2e278 D_strliteral_2e278 = { (char *)((char *)&D_strdata_2e277) + 0, 16U, 16U };
+static const struct S_strdata_2e296 D_strdata_2e296 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\062\065\065\073", 10U, 9U, 9U, "\154\145\164\040\170\072\040\165\070\040\075\040\124\105\123\124\104\105\106\111\116\105\073", 10U, 9U };
+static struct S_strliteral_2e297 D_strliteral_2e297 = { (char *)((char *)&D_strdata_2e296) + 0, 52U, 52U };
+static const struct S_strdata_2e301 D_strdata_2e301 = { "\055\104\124\105\123\124\104\105\106\111\116\105\075\062\065\066" };
+static struct S_strliteral_2e302 D_strliteral_2e302 = { (char *)((char *)&D_strdata_2e301) + 0, 16U, 16U };
+static const struct S_strdata_2e320 D_strdata_2e320 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\062\065\066\073", 10U, 9U, 9U, "\154\145\164\040\170\072\040\165\070\040\075\040\124\105\123\124\104\105\106\111\116\105\073", 10U, 9U };
+static struct S_strliteral_2e321 D_strliteral_2e321 = { (char *)((char *)&D_strdata_2e320) + 0, 52U, 52U };
+static const struct S_strdata_2e325 D_strdata_2e325 = { "\055\104\124\105\123\124\104\105\106\111\116\105\075\062\065\065" };
+static struct S_strliteral_2e326 D_strliteral_2e326 = { (char *)((char *)&D_strdata_2e325) + 0, 16U, 16U };
+static struct S_abortsites_2e41 D_abortsites_2e41 = { (char *)((char *)&D_strliteral_2e1) + 0, 33U, 34U, (char *)((char *)&D_strliteral_2e1) + 0, 33U, 34U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 36U, 35U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 39U, 24U, (char *)((char *)&D_strliteral_2e1) + 0, 45U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 45U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 51U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 57U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 63U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 63U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 66U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 66U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 69U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 69U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 75U, 33U, (char *)((char *)&D_strliteral_2e1) + 0, 81U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 81U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 85U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 85U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 32U, (char *)((char *)&D_strliteral_2e1) + 0, 89U, 32U };
+static const struct S_strdata_2e349 D_strdata_2e349 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\061\073", 10U, 9U, 9U, "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\124\105\123\124\104\105\106\111\116\105\040\075\075\040\062\051\073", 10U, 9U };
+static struct S_strliteral_2e350 D_strliteral_2e350 = { (char *)((char *)&D_strdata_2e349) + 0, 58U, 58U };
+static const struct S_strdata_2e354 D_strdata_2e354 = { "\055\104\124\105\123\124\104\105\106\111\116\105\075\062" };
+static struct S_strliteral_2e355 D_strliteral_2e355 = { (char *)((char *)&D_strdata_2e354) + 0, 14U, 14U };
+static const struct S_strdata_2e387 D_strdata_2e387 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\061\073", 10U, 9U, 9U, "\163\164\141\164\151\143\040\141\163\163\145\162\164\050\124\105\123\124\104\105\106\111\116\105\040\075\075\040\061\051\073", 10U, 9U };
+static struct S_strliteral_2e388 D_strliteral_2e388 = { (char *)((char *)&D_strdata_2e387) + 0, 58U, 58U };
+static struct S_abortsites_2e368 D_abortsites_2e368 = { (char *)((char *)&D_strliteral_2e1) + 0, 23U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 23U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 27U, 12U };
+static const struct S_strdata_2e412 D_strdata_2e412 = { 10U, 9U, 9U, "\144\145\146\040\124\105\123\124\104\105\106\111\116\105\040\075\040\124\105\123\124\104\105\106\111\116\105\073", 10U, 9U };
+static struct S_strliteral_2e413 D_strliteral_2e413 = { (char *)((char *)&D_strdata_2e412) + 0, 33U, 33U };
+static struct S_abortsites_2e429 D_abortsites_2e429 = { (char *)((char *)&D_strliteral_2e1) + 0, 13U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 13U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 16U, 12U, (char *)((char *)&D_strliteral_2e1) + 0, 16U, 12U };
+static const struct S_strdata_2e471 D_strdata_2e471 = { 10U, 9U, 9U, "\165\163\145\040\141\040\075\040\162\164\073", 10U, 9U, 9U, "\144\145\146\040\142\040\075\040\141\072\072\124\105\123\124\104\105\106\111\116\105\073", 10U, 9U };
+static struct S_strliteral_2e472 D_strliteral_2e472 = { (char *)((char *)&D_strdata_2e471) + 0, 41U, 41U };
+static struct S_abortsites_2e488 D_abortsites_2e488 = { (char *)((char *)&D_strliteral_2e1) + 0, 7U, 30U, (char *)((char *)&D_strliteral_2e1) + 0, 7U, 30U };
+void F_main(void) {
+	L_start_2e2:;
+	L_body_2e3:;
+	((void (*)(void))((u64)((char *)&F_import)))();
+	((void (*)(void))((u64)((char *)&F_mandatory)))();
+	((void (*)(void))((u64)((char *)&F_optional)))();
+	((void (*)(void))((u64)((char *)&F_compatibility)))();
+	goto L__2e4;
+	L__2e6:;
+	L__2e4:;
+	return;
+}
+static void F_compatibility(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char A5[24] __attribute__((aligned(16)));
+	char A6[8] __attribute__((aligned(16)));
+	char A7[24] __attribute__((aligned(16)));
+	char A8[24] __attribute__((aligned(16)));
+	char A9[8] __attribute__((aligned(16)));
+	char A10[24] __attribute__((aligned(16)));
+	char A11[24] __attribute__((aligned(16)));
+	char A12[8] __attribute__((aligned(16)));
+	char A13[24] __attribute__((aligned(16)));
+	char A14[24] __attribute__((aligned(16)));
+	char A15[8] __attribute__((aligned(16)));
+	char A16[24] __attribute__((aligned(16)));
+	char A17[24] __attribute__((aligned(16)));
+	char A18[8] __attribute__((aligned(16)));
+	char A19[24] __attribute__((aligned(16)));
+	char A20[24] __attribute__((aligned(16)));
+	char A21[8] __attribute__((aligned(16)));
+	char A22[24] __attribute__((aligned(16)));
+	char A23[24] __attribute__((aligned(16)));
+	char A24[8] __attribute__((aligned(16)));
+	char A25[24] __attribute__((aligned(16)));
+	char A26[24] __attribute__((aligned(16)));
+	char A27[8] __attribute__((aligned(16)));
+	char A28[24] __attribute__((aligned(16)));
+	char A29[24] __attribute__((aligned(16)));
+	char A30[8] __attribute__((aligned(16)));
+	char A31[24] __attribute__((aligned(16)));
+	char A32[24] __attribute__((aligned(16)));
+	char A33[8] __attribute__((aligned(16)));
+	char A34[24] __attribute__((aligned(16)));
+	char A35[24] __attribute__((aligned(16)));
+	char A36[8] __attribute__((aligned(16)));
+	char A37[24] __attribute__((aligned(16)));
+	char A38[24] __attribute__((aligned(16)));
+	char B39[8] __attribute__((aligned(16)));
+	char B40[24] __attribute__((aligned(16)));
+	char B41[24] __attribute__((aligned(16)));
+	char R42[4] __attribute__((aligned(16)));
+	char B43[8] __attribute__((aligned(16)));
+	char B44[24] __attribute__((aligned(16)));
+	char B45[24] __attribute__((aligned(16)));
+	char R46[4] __attribute__((aligned(16)));
+	char B47[8] __attribute__((aligned(16)));
+	char B48[24] __attribute__((aligned(16)));
+	char B49[24] __attribute__((aligned(16)));
+	char R50[4] __attribute__((aligned(16)));
+	char B51[8] __attribute__((aligned(16)));
+	char B52[24] __attribute__((aligned(16)));
+	char B53[24] __attribute__((aligned(16)));
+	char R54[4] __attribute__((aligned(16)));
+	char B55[8] __attribute__((aligned(16)));
+	char B56[24] __attribute__((aligned(16)));
+	char B57[24] __attribute__((aligned(16)));
+	char R58[4] __attribute__((aligned(16)));
+	char B59[8] __attribute__((aligned(16)));
+	char B60[24] __attribute__((aligned(16)));
+	char B61[24] __attribute__((aligned(16)));
+	char R62[4] __attribute__((aligned(16)));
+	char B63[8] __attribute__((aligned(16)));
+	char B64[24] __attribute__((aligned(16)));
+	char B65[24] __attribute__((aligned(16)));
+	char R66[4] __attribute__((aligned(16)));
+	char B67[8] __attribute__((aligned(16)));
+	char B68[24] __attribute__((aligned(16)));
+	char B69[24] __attribute__((aligned(16)));
+	char R70[4] __attribute__((aligned(16)));
+	char B71[8] __attribute__((aligned(16)));
+	char B72[24] __attribute__((aligned(16)));
+	char B73[24] __attribute__((aligned(16)));
+	char R74[4] __attribute__((aligned(16)));
+	char B75[8] __attribute__((aligned(16)));
+	char B76[24] __attribute__((aligned(16)));
+	char B77[24] __attribute__((aligned(16)));
+	char R78[4] __attribute__((aligned(16)));
+	char B79[8] __attribute__((aligned(16)));
+	char B80[24] __attribute__((aligned(16)));
+	char B81[24] __attribute__((aligned(16)));
+	char R82[4] __attribute__((aligned(16)));
+	char B83[8] __attribute__((aligned(16)));
+	char B84[24] __attribute__((aligned(16)));
+	char B85[24] __attribute__((aligned(16)));
+	char R86[4] __attribute__((aligned(16)));
+	char B87[8] __attribute__((aligned(16)));
+	char B88[24] __attribute__((aligned(16)));
+	char B89[24] __attribute__((aligned(16)));
+	char R90[4] __attribute__((aligned(16)));
+	u64 t__2e100;
+	u64 t__2e103;
+	u64 t__2e105;
+	u64 t__2e113;
+	u64 t__2e12;
+	u64 t__2e122;
+	u64 t__2e124;
+	u64 t__2e127;
+	u64 t__2e129;
+	u64 t__2e137;
+	u64 t__2e146;
+	u64 t__2e148;
+	u64 t__2e151;
+	u64 t__2e153;
+	u64 t__2e161;
+	u64 t__2e170;
+	u64 t__2e172;
+	u64 t__2e175;
+	u64 t__2e177;
+	u64 t__2e18;
+	u64 t__2e185;
+	u64 t__2e194;
+	u64 t__2e196;
+	u64 t__2e199;
+	u64 t__2e201;
+	u64 t__2e207;
+	u64 t__2e216;
+	u64 t__2e218;
+	u64 t__2e221;
+	u64 t__2e223;
+	u64 t__2e231;
+	u64 t__2e240;
+	u64 t__2e242;
+	u64 t__2e245;
+	u64 t__2e247;
+	u64 t__2e255;
+	u64 t__2e264;
+	u64 t__2e266;
+	u64 t__2e269;
+	u64 t__2e271;
+	u64 t__2e279;
+	u64 t__2e288;
+	u64 t__2e29;
+	u64 t__2e290;
+	u64 t__2e293;
+	u64 t__2e295;
+	u64 t__2e303;
+	u64 t__2e312;
+	u64 t__2e314;
+	u64 t__2e317;
+	u64 t__2e319;
+	u64 t__2e327;
+	u64 t__2e336;
+	u64 t__2e338;
+	u64 t__2e38;
+	u64 t__2e40;
+	u64 t__2e44;
+	u64 t__2e45;
+	u64 t__2e46;
+	u64 t__2e47;
+	u64 t__2e48;
+	u64 t__2e51;
+	u64 t__2e52;
+	u64 t__2e53;
+	u64 t__2e54;
+	u64 t__2e55;
+	u64 t__2e57;
+	u64 t__2e59;
+	u64 t__2e65;
+	u64 t__2e74;
+	u64 t__2e76;
+	u64 t__2e79;
+	u64 t__2e81;
+	u64 t__2e89;
+	u64 t__2e98;
+	u64 t_abortsite_2e42;
+	u64 t_item_2e110;
+	u64 t_item_2e134;
+	u64 t_item_2e158;
+	u64 t_item_2e182;
+	u64 t_item_2e206;
+	u64 t_item_2e228;
+	u64 t_item_2e252;
+	u64 t_item_2e26;
+	u64 t_item_2e276;
+	u64 t_item_2e300;
+	u64 t_item_2e324;
+	u64 t_item_2e62;
+	u64 t_item_2e86;
+	u64 t_object_2e104;
+	u64 t_object_2e108;
+	u64 t_object_2e109;
+	u64 t_object_2e128;
+	u64 t_object_2e132;
+	u64 t_object_2e133;
+	u64 t_object_2e14;
+	u64 t_object_2e152;
+	u64 t_object_2e156;
+	u64 t_object_2e157;
+	u64 t_object_2e176;
+	u64 t_object_2e180;
+	u64 t_object_2e181;
+	u64 t_object_2e200;
+	u64 t_object_2e204;
+	u64 t_object_2e205;
+	u64 t_object_2e22;
+	u64 t_object_2e222;
+	u64 t_object_2e226;
+	u64 t_object_2e227;
+	u64 t_object_2e24;
+	u64 t_object_2e246;
+	u64 t_object_2e250;
+	u64 t_object_2e251;
+	u64 t_object_2e270;
+	u64 t_object_2e274;
+	u64 t_object_2e275;
+	u64 t_object_2e294;
+	u64 t_object_2e298;
+	u64 t_object_2e299;
+	u64 t_object_2e318;
+	u64 t_object_2e322;
+	u64 t_object_2e323;
+	u64 t_object_2e58;
+	u64 t_object_2e60;
+	u64 t_object_2e61;
+	u64 t_object_2e80;
+	u64 t_object_2e84;
+	u64 t_object_2e85;
+	u64 t_tag_2e114;
+	u64 t_tag_2e138;
+	u64 t_tag_2e162;
+	u64 t_tag_2e186;
+	u64 t_tag_2e208;
+	u64 t_tag_2e232;
+	u64 t_tag_2e256;
+	u64 t_tag_2e280;
+	u64 t_tag_2e30;
+	u64 t_tag_2e304;
+	u64 t_tag_2e328;
+	u64 t_tag_2e66;
+	u64 t_tag_2e90;
+	L_start_2e7:;
+	t_object_2e14 = (u64)A0;
+	t_object_2e22 = (u64)A1;
+	t_object_2e24 = (u64)A2;
+	t_object_2e58 = (u64)A3;
+	t_object_2e60 = (u64)A4;
+	t_object_2e61 = (u64)A5;
+	t_object_2e80 = (u64)A6;
+	t_object_2e84 = (u64)A7;
+	t_object_2e85 = (u64)A8;
+	t_object_2e104 = (u64)A9;
+	t_object_2e108 = (u64)A10;
+	t_object_2e109 = (u64)A11;
+	t_object_2e128 = (u64)A12;
+	t_object_2e132 = (u64)A13;
+	t_object_2e133 = (u64)A14;
+	t_object_2e152 = (u64)A15;
+	t_object_2e156 = (u64)A16;
+	t_object_2e157 = (u64)A17;
+	t_object_2e176 = (u64)A18;
+	t_object_2e180 = (u64)A19;
+	t_object_2e181 = (u64)A20;
+	t_object_2e200 = (u64)A21;
+	t_object_2e204 = (u64)A22;
+	t_object_2e205 = (u64)A23;
+	t_object_2e222 = (u64)A24;
+	t_object_2e226 = (u64)A25;
+	t_object_2e227 = (u64)A26;
+	t_object_2e246 = (u64)A27;
+	t_object_2e250 = (u64)A28;
+	t_object_2e251 = (u64)A29;
+	t_object_2e270 = (u64)A30;
+	t_object_2e274 = (u64)A31;
+	t_object_2e275 = (u64)A32;
+	t_object_2e294 = (u64)A33;
+	t_object_2e298 = (u64)A34;
+	t_object_2e299 = (u64)A35;
+	t_object_2e318 = (u64)A36;
+	t_object_2e322 = (u64)A37;
+	t_object_2e323 = (u64)A38;
+	L_body_2e8:;
+	*(u32 *)t_object_2e14 = (u32)((u64)3532310079UL);
+	t__2e18 = (u64)((u64)t_object_2e14 + (u64)((u64)4UL));
+	*(u32 *)t__2e18 = (u32)((u64)0UL);
+	t_item_2e26 = (u64)((u64)t_object_2e24 + (u64)((u64)0UL));
+	BLIT(t_item_2e26, ((u64)((char *)&D_strliteral_2e28)), ((u64)24UL));
+	*(u64 *)t_object_2e22 = (u64)t_object_2e24;
+	t__2e29 = (u64)((u64)t_object_2e22 + (u64)((u64)8UL));
+	*(u64 *)t__2e29 = (u64)((u64)1UL);
+	t__2e29 = (u64)((u64)t__2e29 + (u64)((u64)8UL));
+	*(u64 *)t__2e29 = (u64)((u64)1UL);
+	BLIT((u64)B39, t_object_2e14, 8);
+	BLIT((u64)B40, ((u64)((char *)&D_strliteral_2e20)), 24);
+	BLIT((u64)B41, t_object_2e22, 24);
+	t__2e12 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R42, (u64)B39, (u64)B40, (u64)B41);
+	t_tag_2e30 = (u64)(*(u32 *)t__2e12);
+	t__2e38 = (u64)(u32)(((u32)t_tag_2e30 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e38) goto L_member_2e35; else goto L__2e37;
+	L__2e37:;
+	t__2e40 = (u64)(u32)(((u32)t_tag_2e30 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e40) goto L_member_2e36; else goto L__2e39;
+	L__2e39:;
+	goto L_matches_2e34;
+	L_member_2e35:;
+	goto L_matches_2e34;
+	L_member_2e36:;
+	goto L_matches_2e33;
+	L_matches_2e33:;
+	goto L__2e31;
+	L_matches_2e34:;
+	t_abortsite_2e42 = ((u64)0UL);
+	goto L_abort_2e43;
+	L__2e49:;
+	L__2e32:;
+	t_abortsite_2e42 = ((u64)1UL);
+	goto L_abort_2e50;
+	L__2e31:;
+	*(u32 *)t_object_2e58 = (u32)((u64)3532310079UL);
+	t__2e59 = (u64)((u64)t_object_2e58 + (u64)((u64)4UL));
+	*(u32 *)t__2e59 = (u32)((u64)4UL);
+	t_item_2e62 = (u64)((u64)t_object_2e61 + (u64)((u64)0UL));
+	BLIT(t_item_2e62, ((u64)((char *)&D_strliteral_2e64)), ((u64)24UL));
+	*(u64 *)t_object_2e60 = (u64)t_object_2e61;
+	t__2e65 = (u64)((u64)t_object_2e60 + (u64)((u64)8UL));
+	*(u64 *)t__2e65 = (u64)((u64)1UL);
+	t__2e65 = (u64)((u64)t__2e65 + (u64)((u64)8UL));
+	*(u64 *)t__2e65 = (u64)((u64)1UL);
+	BLIT((u64)B43, t_object_2e58, 8);
+	BLIT((u64)B44, ((u64)((char *)&D_strliteral_2e20)), 24);
+	BLIT((u64)B45, t_object_2e60, 24);
+	t__2e57 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R46, (u64)B43, (u64)B44, (u64)B45);
+	t_tag_2e66 = (u64)(*(u32 *)t__2e57);
+	t__2e74 = (u64)(u32)(((u32)t_tag_2e66 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e74) goto L_member_2e71; else goto L__2e73;
+	L__2e73:;
+	t__2e76 = (u64)(u32)(((u32)t_tag_2e66 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e76) goto L_member_2e72; else goto L__2e75;
+	L__2e75:;
+	goto L_matches_2e70;
+	L_member_2e71:;
+	goto L_matches_2e70;
+	L_member_2e72:;
+	goto L_matches_2e69;
+	L_matches_2e69:;
+	goto L__2e67;
+	L_matches_2e70:;
+	t_abortsite_2e42 = ((u64)2UL);
+	goto L_abort_2e43;
+	L__2e77:;
+	L__2e68:;
+	t_abortsite_2e42 = ((u64)3UL);
+	goto L_abort_2e50;
+	L__2e67:;
+	*(u32 *)t_object_2e80 = (u32)((u64)3532310079UL);
+	t__2e81 = (u64)((u64)t_object_2e80 + (u64)((u64)4UL));
+	*(u32 *)t__2e81 = (u32)((u64)4UL);
+	t_item_2e86 = (u64)((u64)t_object_2e85 + (u64)((u64)0UL));
+	BLIT(t_item_2e86, ((u64)((char *)&D_strliteral_2e88)), ((u64)24UL));
+	*(u64 *)t_object_2e84 = (u64)t_object_2e85;
+	t__2e89 = (u64)((u64)t_object_2e84 + (u64)((u64)8UL));
+	*(u64 *)t__2e89 = (u64)((u64)1UL);
+	t__2e89 = (u64)((u64)t__2e89 + (u64)((u64)8UL));
+	*(u64 *)t__2e89 = (u64)((u64)1UL);
+	BLIT((u64)B47, t_object_2e80, 8);
+	BLIT((u64)B48, ((u64)((char *)&D_strliteral_2e83)), 24);
+	BLIT((u64)B49, t_object_2e84, 24);
+	t__2e79 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R50, (u64)B47, (u64)B48, (u64)B49);
+	t_tag_2e90 = (u64)(*(u32 *)t__2e79);
+	t__2e98 = (u64)(u32)(((u32)t_tag_2e90 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e98) goto L_member_2e95; else goto L__2e97;
+	L__2e97:;
+	t__2e100 = (u64)(u32)(((u32)t_tag_2e90 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e100) goto L_member_2e96; else goto L__2e99;
+	L__2e99:;
+	goto L_matches_2e94;
+	L_member_2e95:;
+	goto L_matches_2e94;
+	L_member_2e96:;
+	goto L_matches_2e93;
+	L_matches_2e93:;
+	goto L__2e91;
+	L_matches_2e94:;
+	t_abortsite_2e42 = ((u64)4UL);
+	goto L_abort_2e43;
+	L__2e101:;
+	L__2e92:;
+	t_abortsite_2e42 = ((u64)5UL);
+	goto L_abort_2e50;
+	L__2e91:;
+	*(u32 *)t_object_2e104 = (u32)((u64)3532310079UL);
+	t__2e105 = (u64)((u64)t_object_2e104 + (u64)((u64)4UL));
+	*(u32 *)t__2e105 = (u32)((u64)0UL);
+	t_item_2e110 = (u64)((u64)t_object_2e109 + (u64)((u64)0UL));
+	BLIT(t_item_2e110, ((u64)((char *)&D_strliteral_2e112)), ((u64)24UL));
+	*(u64 *)t_object_2e108 = (u64)t_object_2e109;
+	t__2e113 = (u64)((u64)t_object_2e108 + (u64)((u64)8UL));
+	*(u64 *)t__2e113 = (u64)((u64)1UL);
+	t__2e113 = (u64)((u64)t__2e113 + (u64)((u64)8UL));
+	*(u64 *)t__2e113 = (u64)((u64)1UL);
+	BLIT((u64)B51, t_object_2e104, 8);
+	BLIT((u64)B52, ((u64)((char *)&D_strliteral_2e107)), 24);
+	BLIT((u64)B53, t_object_2e108, 24);
+	t__2e103 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R54, (u64)B51, (u64)B52, (u64)B53);
+	t_tag_2e114 = (u64)(*(u32 *)t__2e103);
+	t__2e122 = (u64)(u32)(((u32)t_tag_2e114 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e122) goto L_member_2e119; else goto L__2e121;
+	L__2e121:;
+	t__2e124 = (u64)(u32)(((u32)t_tag_2e114 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e124) goto L_member_2e120; else goto L__2e123;
+	L__2e123:;
+	goto L_matches_2e118;
+	L_member_2e119:;
+	goto L_matches_2e118;
+	L_member_2e120:;
+	goto L_matches_2e117;
+	L_matches_2e117:;
+	goto L__2e115;
+	L_matches_2e118:;
+	t_abortsite_2e42 = ((u64)6UL);
+	goto L_abort_2e43;
+	L__2e125:;
+	L__2e116:;
+	t_abortsite_2e42 = ((u64)7UL);
+	goto L_abort_2e50;
+	L__2e115:;
+	*(u32 *)t_object_2e128 = (u32)((u64)3532310079UL);
+	t__2e129 = (u64)((u64)t_object_2e128 + (u64)((u64)4UL));
+	*(u32 *)t__2e129 = (u32)((u64)0UL);
+	t_item_2e134 = (u64)((u64)t_object_2e133 + (u64)((u64)0UL));
+	BLIT(t_item_2e134, ((u64)((char *)&D_strliteral_2e136)), ((u64)24UL));
+	*(u64 *)t_object_2e132 = (u64)t_object_2e133;
+	t__2e137 = (u64)((u64)t_object_2e132 + (u64)((u64)8UL));
+	*(u64 *)t__2e137 = (u64)((u64)1UL);
+	t__2e137 = (u64)((u64)t__2e137 + (u64)((u64)8UL));
+	*(u64 *)t__2e137 = (u64)((u64)1UL);
+	BLIT((u64)B55, t_object_2e128, 8);
+	BLIT((u64)B56, ((u64)((char *)&D_strliteral_2e131)), 24);
+	BLIT((u64)B57, t_object_2e132, 24);
+	t__2e127 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R58, (u64)B55, (u64)B56, (u64)B57);
+	t_tag_2e138 = (u64)(*(u32 *)t__2e127);
+	t__2e146 = (u64)(u32)(((u32)t_tag_2e138 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e146) goto L_member_2e143; else goto L__2e145;
+	L__2e145:;
+	t__2e148 = (u64)(u32)(((u32)t_tag_2e138 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e148) goto L_member_2e144; else goto L__2e147;
+	L__2e147:;
+	goto L_matches_2e142;
+	L_member_2e143:;
+	goto L_matches_2e142;
+	L_member_2e144:;
+	goto L_matches_2e141;
+	L_matches_2e141:;
+	goto L__2e139;
+	L_matches_2e142:;
+	t_abortsite_2e42 = ((u64)8UL);
+	goto L_abort_2e43;
+	L__2e149:;
+	L__2e140:;
+	t_abortsite_2e42 = ((u64)9UL);
+	goto L_abort_2e50;
+	L__2e139:;
+	*(u32 *)t_object_2e152 = (u32)((u64)3532310079UL);
+	t__2e153 = (u64)((u64)t_object_2e152 + (u64)((u64)4UL));
+	*(u32 *)t__2e153 = (u32)((u64)0UL);
+	t_item_2e158 = (u64)((u64)t_object_2e157 + (u64)((u64)0UL));
+	BLIT(t_item_2e158, ((u64)((char *)&D_strliteral_2e160)), ((u64)24UL));
+	*(u64 *)t_object_2e156 = (u64)t_object_2e157;
+	t__2e161 = (u64)((u64)t_object_2e156 + (u64)((u64)8UL));
+	*(u64 *)t__2e161 = (u64)((u64)1UL);
+	t__2e161 = (u64)((u64)t__2e161 + (u64)((u64)8UL));
+	*(u64 *)t__2e161 = (u64)((u64)1UL);
+	BLIT((u64)B59, t_object_2e152, 8);
+	BLIT((u64)B60, ((u64)((char *)&D_strliteral_2e155)), 24);
+	BLIT((u64)B61, t_object_2e156, 24);
+	t__2e151 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R62, (u64)B59, (u64)B60, (u64)B61);
+	t_tag_2e162 = (u64)(*(u32 *)t__2e151);
+	t__2e170 = (u64)(u32)(((u32)t_tag_2e162 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e170) goto L_member_2e167; else goto L__2e169;
+	L__2e169:;
+	t__2e172 = (u64)(u32)(((u32)t_tag_2e162 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e172) goto L_member_2e168; else goto L__2e171;
+	L__2e171:;
+	goto L_matches_2e166;
+	L_member_2e167:;
+	goto L_matches_2e166;
+	L_member_2e168:;
+	goto L_matches_2e165;
+	L_matches_2e165:;
+	goto L__2e163;
+	L_matches_2e166:;
+	t_abortsite_2e42 = ((u64)10UL);
+	goto L_abort_2e43;
+	L__2e173:;
+	L__2e164:;
+	t_abortsite_2e42 = ((u64)11UL);
+	goto L_abort_2e50;
+	L__2e163:;
+	*(u32 *)t_object_2e176 = (u32)((u64)3532310079UL);
+	t__2e177 = (u64)((u64)t_object_2e176 + (u64)((u64)4UL));
+	*(u32 *)t__2e177 = (u32)((u64)0UL);
+	t_item_2e182 = (u64)((u64)t_object_2e181 + (u64)((u64)0UL));
+	BLIT(t_item_2e182, ((u64)((char *)&D_strliteral_2e184)), ((u64)24UL));
+	*(u64 *)t_object_2e180 = (u64)t_object_2e181;
+	t__2e185 = (u64)((u64)t_object_2e180 + (u64)((u64)8UL));
+	*(u64 *)t__2e185 = (u64)((u64)1UL);
+	t__2e185 = (u64)((u64)t__2e185 + (u64)((u64)8UL));
+	*(u64 *)t__2e185 = (u64)((u64)1UL);
+	BLIT((u64)B63, t_object_2e176, 8);
+	BLIT((u64)B64, ((u64)((char *)&D_strliteral_2e179)), 24);
+	BLIT((u64)B65, t_object_2e180, 24);
+	t__2e175 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R66, (u64)B63, (u64)B64, (u64)B65);
+	t_tag_2e186 = (u64)(*(u32 *)t__2e175);
+	t__2e194 = (u64)(u32)(((u32)t_tag_2e186 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e194) goto L_member_2e191; else goto L__2e193;
+	L__2e193:;
+	t__2e196 = (u64)(u32)(((u32)t_tag_2e186 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e196) goto L_member_2e192; else goto L__2e195;
+	L__2e195:;
+	goto L_matches_2e190;
+	L_member_2e191:;
+	goto L_matches_2e190;
+	L_member_2e192:;
+	goto L_matches_2e189;
+	L_matches_2e189:;
+	goto L__2e187;
+	L_matches_2e190:;
+	t_abortsite_2e42 = ((u64)12UL);
+	goto L_abort_2e43;
+	L__2e197:;
+	L__2e188:;
+	t_abortsite_2e42 = ((u64)13UL);
+	goto L_abort_2e50;
+	L__2e187:;
+	*(u32 *)t_object_2e200 = (u32)((u64)3532310079UL);
+	t__2e201 = (u64)((u64)t_object_2e200 + (u64)((u64)4UL));
+	*(u32 *)t__2e201 = (u32)((u64)4UL);
+	t_item_2e206 = (u64)((u64)t_object_2e205 + (u64)((u64)0UL));
+	BLIT(t_item_2e206, ((u64)((char *)&D_strliteral_2e160)), ((u64)24UL));
+	*(u64 *)t_object_2e204 = (u64)t_object_2e205;
+	t__2e207 = (u64)((u64)t_object_2e204 + (u64)((u64)8UL));
+	*(u64 *)t__2e207 = (u64)((u64)1UL);
+	t__2e207 = (u64)((u64)t__2e207 + (u64)((u64)8UL));
+	*(u64 *)t__2e207 = (u64)((u64)1UL);
+	BLIT((u64)B67, t_object_2e200, 8);
+	BLIT((u64)B68, ((u64)((char *)&D_strliteral_2e203)), 24);
+	BLIT((u64)B69, t_object_2e204, 24);
+	t__2e199 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R70, (u64)B67, (u64)B68, (u64)B69);
+	t_tag_2e208 = (u64)(*(u32 *)t__2e199);
+	t__2e216 = (u64)(u32)(((u32)t_tag_2e208 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e216) goto L_member_2e213; else goto L__2e215;
+	L__2e215:;
+	t__2e218 = (u64)(u32)(((u32)t_tag_2e208 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e218) goto L_member_2e214; else goto L__2e217;
+	L__2e217:;
+	goto L_matches_2e212;
+	L_member_2e213:;
+	goto L_matches_2e212;
+	L_member_2e214:;
+	goto L_matches_2e211;
+	L_matches_2e211:;
+	goto L__2e209;
+	L_matches_2e212:;
+	t_abortsite_2e42 = ((u64)14UL);
+	goto L_abort_2e43;
+	L__2e219:;
+	L__2e210:;
+	t_abortsite_2e42 = ((u64)15UL);
+	goto L_abort_2e50;
+	L__2e209:;
+	*(u32 *)t_object_2e222 = (u32)((u64)3532310079UL);
+	t__2e223 = (u64)((u64)t_object_2e222 + (u64)((u64)4UL));
+	*(u32 *)t__2e223 = (u32)((u64)4UL);
+	t_item_2e228 = (u64)((u64)t_object_2e227 + (u64)((u64)0UL));
+	BLIT(t_item_2e228, ((u64)((char *)&D_strliteral_2e230)), ((u64)24UL));
+	*(u64 *)t_object_2e226 = (u64)t_object_2e227;
+	t__2e231 = (u64)((u64)t_object_2e226 + (u64)((u64)8UL));
+	*(u64 *)t__2e231 = (u64)((u64)1UL);
+	t__2e231 = (u64)((u64)t__2e231 + (u64)((u64)8UL));
+	*(u64 *)t__2e231 = (u64)((u64)1UL);
+	BLIT((u64)B71, t_object_2e222, 8);
+	BLIT((u64)B72, ((u64)((char *)&D_strliteral_2e225)), 24);
+	BLIT((u64)B73, t_object_2e226, 24);
+	t__2e221 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R74, (u64)B71, (u64)B72, (u64)B73);
+	t_tag_2e232 = (u64)(*(u32 *)t__2e221);
+	t__2e240 = (u64)(u32)(((u32)t_tag_2e232 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e240) goto L_member_2e237; else goto L__2e239;
+	L__2e239:;
+	t__2e242 = (u64)(u32)(((u32)t_tag_2e232 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e242) goto L_member_2e238; else goto L__2e241;
+	L__2e241:;
+	goto L_matches_2e236;
+	L_member_2e237:;
+	goto L_matches_2e236;
+	L_member_2e238:;
+	goto L_matches_2e235;
+	L_matches_2e235:;
+	goto L__2e233;
+	L_matches_2e236:;
+	t_abortsite_2e42 = ((u64)16UL);
+	goto L_abort_2e43;
+	L__2e243:;
+	L__2e234:;
+	t_abortsite_2e42 = ((u64)17UL);
+	goto L_abort_2e50;
+	L__2e233:;
+	*(u32 *)t_object_2e246 = (u32)((u64)3532310079UL);
+	t__2e247 = (u64)((u64)t_object_2e246 + (u64)((u64)4UL));
+	*(u32 *)t__2e247 = (u32)((u64)0UL);
+	t_item_2e252 = (u64)((u64)t_object_2e251 + (u64)((u64)0UL));
+	BLIT(t_item_2e252, ((u64)((char *)&D_strliteral_2e254)), ((u64)24UL));
+	*(u64 *)t_object_2e250 = (u64)t_object_2e251;
+	t__2e255 = (u64)((u64)t_object_2e250 + (u64)((u64)8UL));
+	*(u64 *)t__2e255 = (u64)((u64)1UL);
+	t__2e255 = (u64)((u64)t__2e255 + (u64)((u64)8UL));
+	*(u64 *)t__2e255 = (u64)((u64)1UL);
+	BLIT((u64)B75, t_object_2e246, 8);
+	BLIT((u64)B76, ((u64)((char *)&D_strliteral_2e249)), 24);
+	BLIT((u64)B77, t_object_2e250, 24);
+	t__2e245 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R78, (u64)B75, (u64)B76, (u64)B77);
+	t_tag_2e256 = (u64)(*(u32 *)t__2e245);
+	t__2e264 = (u64)(u32)(((u32)t_tag_2e256 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e264) goto L_member_2e261; else goto L__2e263;
+	L__2e263:;
+	t__2e266 = (u64)(u32)(((u32)t_tag_2e256 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e266) goto L_member_2e262; else goto L__2e265;
+	L__2e265:;
+	goto L_matches_2e260;
+	L_member_2e261:;
+	goto L_matches_2e260;
+	L_member_2e262:;
+	goto L_matches_2e259;
+	L_matches_2e259:;
+	goto L__2e257;
+	L_matches_2e260:;
+	t_abortsite_2e42 = ((u64)18UL);
+	goto L_abort_2e43;
+	L__2e267:;
+	L__2e258:;
+	t_abortsite_2e42 = ((u64)19UL);
+	goto L_abort_2e50;
+	L__2e257:;
+	*(u32 *)t_object_2e270 = (u32)((u64)3532310079UL);
+	t__2e271 = (u64)((u64)t_object_2e270 + (u64)((u64)4UL));
+	*(u32 *)t__2e271 = (u32)((u64)0UL);
+	t_item_2e276 = (u64)((u64)t_object_2e275 + (u64)((u64)0UL));
+	BLIT(t_item_2e276, ((u64)((char *)&D_strliteral_2e278)), ((u64)24UL));
+	*(u64 *)t_object_2e274 = (u64)t_object_2e275;
+	t__2e279 = (u64)((u64)t_object_2e274 + (u64)((u64)8UL));
+	*(u64 *)t__2e279 = (u64)((u64)1UL);
+	t__2e279 = (u64)((u64)t__2e279 + (u64)((u64)8UL));
+	*(u64 *)t__2e279 = (u64)((u64)1UL);
+	BLIT((u64)B79, t_object_2e270, 8);
+	BLIT((u64)B80, ((u64)((char *)&D_strliteral_2e273)), 24);
+	BLIT((u64)B81, t_object_2e274, 24);
+	t__2e269 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R82, (u64)B79, (u64)B80, (u64)B81);
+	t_tag_2e280 = (u64)(*(u32 *)t__2e269);
+	t__2e288 = (u64)(u32)(((u32)t_tag_2e280 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e288) goto L_member_2e285; else goto L__2e287;
+	L__2e287:;
+	t__2e290 = (u64)(u32)(((u32)t_tag_2e280 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e290) goto L_member_2e286; else goto L__2e289;
+	L__2e289:;
+	goto L_matches_2e284;
+	L_member_2e285:;
+	goto L_matches_2e284;
+	L_member_2e286:;
+	goto L_matches_2e283;
+	L_matches_2e283:;
+	goto L__2e281;
+	L_matches_2e284:;
+	t_abortsite_2e42 = ((u64)20UL);
+	goto L_abort_2e43;
+	L__2e291:;
+	L__2e282:;
+	t_abortsite_2e42 = ((u64)21UL);
+	goto L_abort_2e50;
+	L__2e281:;
+	*(u32 *)t_object_2e294 = (u32)((u64)3532310079UL);
+	t__2e295 = (u64)((u64)t_object_2e294 + (u64)((u64)4UL));
+	*(u32 *)t__2e295 = (u32)((u64)4UL);
+	t_item_2e300 = (u64)((u64)t_object_2e299 + (u64)((u64)0UL));
+	BLIT(t_item_2e300, ((u64)((char *)&D_strliteral_2e302)), ((u64)24UL));
+	*(u64 *)t_object_2e298 = (u64)t_object_2e299;
+	t__2e303 = (u64)((u64)t_object_2e298 + (u64)((u64)8UL));
+	*(u64 *)t__2e303 = (u64)((u64)1UL);
+	t__2e303 = (u64)((u64)t__2e303 + (u64)((u64)8UL));
+	*(u64 *)t__2e303 = (u64)((u64)1UL);
+	BLIT((u64)B83, t_object_2e294, 8);
+	BLIT((u64)B84, ((u64)((char *)&D_strliteral_2e297)), 24);
+	BLIT((u64)B85, t_object_2e298, 24);
+	t__2e293 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R86, (u64)B83, (u64)B84, (u64)B85);
+	t_tag_2e304 = (u64)(*(u32 *)t__2e293);
+	t__2e312 = (u64)(u32)(((u32)t_tag_2e304 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e312) goto L_member_2e309; else goto L__2e311;
+	L__2e311:;
+	t__2e314 = (u64)(u32)(((u32)t_tag_2e304 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e314) goto L_member_2e310; else goto L__2e313;
+	L__2e313:;
+	goto L_matches_2e308;
+	L_member_2e309:;
+	goto L_matches_2e308;
+	L_member_2e310:;
+	goto L_matches_2e307;
+	L_matches_2e307:;
+	goto L__2e305;
+	L_matches_2e308:;
+	t_abortsite_2e42 = ((u64)22UL);
+	goto L_abort_2e43;
+	L__2e315:;
+	L__2e306:;
+	t_abortsite_2e42 = ((u64)23UL);
+	goto L_abort_2e50;
+	L__2e305:;
+	*(u32 *)t_object_2e318 = (u32)((u64)3532310079UL);
+	t__2e319 = (u64)((u64)t_object_2e318 + (u64)((u64)4UL));
+	*(u32 *)t__2e319 = (u32)((u64)4UL);
+	t_item_2e324 = (u64)((u64)t_object_2e323 + (u64)((u64)0UL));
+	BLIT(t_item_2e324, ((u64)((char *)&D_strliteral_2e326)), ((u64)24UL));
+	*(u64 *)t_object_2e322 = (u64)t_object_2e323;
+	t__2e327 = (u64)((u64)t_object_2e322 + (u64)((u64)8UL));
+	*(u64 *)t__2e327 = (u64)((u64)1UL);
+	t__2e327 = (u64)((u64)t__2e327 + (u64)((u64)8UL));
+	*(u64 *)t__2e327 = (u64)((u64)1UL);
+	BLIT((u64)B87, t_object_2e318, 8);
+	BLIT((u64)B88, ((u64)((char *)&D_strliteral_2e321)), 24);
+	BLIT((u64)B89, t_object_2e322, 24);
+	t__2e317 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R90, (u64)B87, (u64)B88, (u64)B89);
+	t_tag_2e328 = (u64)(*(u32 *)t__2e317);
+	t__2e336 = (u64)(u32)(((u32)t_tag_2e328 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e336) goto L_member_2e333; else goto L__2e335;
+	L__2e335:;
+	t__2e338 = (u64)(u32)(((u32)t_tag_2e328 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e338) goto L_member_2e334; else goto L__2e337;
+	L__2e337:;
+	goto L_matches_2e332;
+	L_member_2e333:;
+	goto L_matches_2e332;
+	L_member_2e334:;
+	goto L_matches_2e331;
+	L_matches_2e331:;
+	goto L__2e329;
+	L_matches_2e332:;
+	t_abortsite_2e42 = ((u64)24UL);
+	goto L_abort_2e43;
+	L__2e339:;
+	L__2e330:;
+	t_abortsite_2e42 = ((u64)25UL);
+	goto L_abort_2e50;
+	L__2e329:;
+	goto L__2e9;
+	L__2e340:;
+	L__2e9:;
+	return;
+	L_abort_2e43:;
+	t__2e44 = (u64)((u64)t_abortsite_2e42 * (u64)((u64)16UL));
+	t__2e44 = (u64)((u64)((u64)((char *)&D_abortsites_2e41)) + (u64)t__2e44);
+	t__2e45 = (u64)(*(u64 *)t__2e44);
+	t__2e46 = (u64)((u64)t__2e44 + (u64)((u64)8UL));
+	t__2e47 = (u64)(*(u32 *)t__2e46);
+	t__2e46 = (u64)((u64)t__2e44 + (u64)((u64)12UL));
+	t__2e48 = (u64)(*(u32 *)t__2e46);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e45, (u64)t__2e47, (u64)t__2e48, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e50:;
+	t__2e51 = (u64)((u64)t_abortsite_2e42 * (u64)((u64)16UL));
+	t__2e51 = (u64)((u64)((u64)((char *)&D_abortsites_2e41)) + (u64)t__2e51);
+	t__2e52 = (u64)(*(u64 *)t__2e51);
+	t__2e53 = (u64)((u64)t__2e51 + (u64)((u64)8UL));
+	t__2e54 = (u64)(*(u32 *)t__2e53);
+	t__2e53 = (u64)((u64)t__2e51 + (u64)((u64)12UL));
+	t__2e55 = (u64)(*(u32 *)t__2e53);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e52, (u64)t__2e54, (u64)t__2e55, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_optional(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char B5[8] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char R8[4] __attribute__((aligned(16)));
+	char B9[8] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char R12[4] __attribute__((aligned(16)));
+	u64 t__2e346;
+	u64 t__2e348;
+	u64 t__2e356;
+	u64 t__2e365;
+	u64 t__2e367;
+	u64 t__2e371;
+	u64 t__2e372;
+	u64 t__2e373;
+	u64 t__2e374;
+	u64 t__2e375;
+	u64 t__2e378;
+	u64 t__2e379;
+	u64 t__2e380;
+	u64 t__2e381;
+	u64 t__2e382;
+	u64 t__2e384;
+	u64 t__2e386;
+	u64 t__2e390;
+	u64 t__2e399;
+	u64 t__2e401;
+	u64 t_abortsite_2e369;
+	u64 t_item_2e353;
+	u64 t_object_2e347;
+	u64 t_object_2e351;
+	u64 t_object_2e352;
+	u64 t_object_2e385;
+	u64 t_object_2e389;
+	u64 t_tag_2e357;
+	u64 t_tag_2e391;
+	L_start_2e341:;
+	t_object_2e347 = (u64)A0;
+	t_object_2e351 = (u64)A1;
+	t_object_2e352 = (u64)A2;
+	t_object_2e385 = (u64)A3;
+	t_object_2e389 = (u64)A4;
+	L_body_2e342:;
+	*(u32 *)t_object_2e347 = (u32)((u64)3532310079UL);
+	t__2e348 = (u64)((u64)t_object_2e347 + (u64)((u64)4UL));
+	*(u32 *)t__2e348 = (u32)((u64)0UL);
+	t_item_2e353 = (u64)((u64)t_object_2e352 + (u64)((u64)0UL));
+	BLIT(t_item_2e353, ((u64)((char *)&D_strliteral_2e355)), ((u64)24UL));
+	*(u64 *)t_object_2e351 = (u64)t_object_2e352;
+	t__2e356 = (u64)((u64)t_object_2e351 + (u64)((u64)8UL));
+	*(u64 *)t__2e356 = (u64)((u64)1UL);
+	t__2e356 = (u64)((u64)t__2e356 + (u64)((u64)8UL));
+	*(u64 *)t__2e356 = (u64)((u64)1UL);
+	BLIT((u64)B5, t_object_2e347, 8);
+	BLIT((u64)B6, ((u64)((char *)&D_strliteral_2e350)), 24);
+	BLIT((u64)B7, t_object_2e351, 24);
+	t__2e346 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R8, (u64)B5, (u64)B6, (u64)B7);
+	t_tag_2e357 = (u64)(*(u32 *)t__2e346);
+	t__2e365 = (u64)(u32)(((u32)t_tag_2e357 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e365) goto L_member_2e362; else goto L__2e364;
+	L__2e364:;
+	t__2e367 = (u64)(u32)(((u32)t_tag_2e357 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e367) goto L_member_2e363; else goto L__2e366;
+	L__2e366:;
+	goto L_matches_2e361;
+	L_member_2e362:;
+	goto L_matches_2e361;
+	L_member_2e363:;
+	goto L_matches_2e360;
+	L_matches_2e360:;
+	goto L__2e358;
+	L_matches_2e361:;
+	t_abortsite_2e369 = ((u64)0UL);
+	goto L_abort_2e370;
+	L__2e376:;
+	L__2e359:;
+	t_abortsite_2e369 = ((u64)1UL);
+	goto L_abort_2e377;
+	L__2e358:;
+	*(u32 *)t_object_2e385 = (u32)((u64)3532310079UL);
+	t__2e386 = (u64)((u64)t_object_2e385 + (u64)((u64)4UL));
+	*(u32 *)t__2e386 = (u32)((u64)0UL);
+	*(u64 *)t_object_2e389 = (u64)((u64)0UL);
+	t__2e390 = (u64)((u64)t_object_2e389 + (u64)((u64)8UL));
+	*(u64 *)t__2e390 = (u64)((u64)0UL);
+	t__2e390 = (u64)((u64)t__2e390 + (u64)((u64)8UL));
+	*(u64 *)t__2e390 = (u64)((u64)0UL);
+	BLIT((u64)B9, t_object_2e385, 8);
+	BLIT((u64)B10, ((u64)((char *)&D_strliteral_2e388)), 24);
+	BLIT((u64)B11, t_object_2e389, 24);
+	t__2e384 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R12, (u64)B9, (u64)B10, (u64)B11);
+	t_tag_2e391 = (u64)(*(u32 *)t__2e384);
+	t__2e399 = (u64)(u32)(((u32)t_tag_2e391 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e399) goto L_member_2e396; else goto L__2e398;
+	L__2e398:;
+	t__2e401 = (u64)(u32)(((u32)t_tag_2e391 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e401) goto L_member_2e397; else goto L__2e400;
+	L__2e400:;
+	goto L_matches_2e395;
+	L_member_2e396:;
+	goto L_matches_2e395;
+	L_member_2e397:;
+	goto L_matches_2e394;
+	L_matches_2e394:;
+	goto L__2e392;
+	L_matches_2e395:;
+	t_abortsite_2e369 = ((u64)2UL);
+	goto L_abort_2e370;
+	L__2e402:;
+	L__2e393:;
+	t_abortsite_2e369 = ((u64)3UL);
+	goto L_abort_2e377;
+	L__2e392:;
+	goto L__2e343;
+	L__2e403:;
+	L__2e343:;
+	return;
+	L_abort_2e370:;
+	t__2e371 = (u64)((u64)t_abortsite_2e369 * (u64)((u64)16UL));
+	t__2e371 = (u64)((u64)((u64)((char *)&D_abortsites_2e368)) + (u64)t__2e371);
+	t__2e372 = (u64)(*(u64 *)t__2e371);
+	t__2e373 = (u64)((u64)t__2e371 + (u64)((u64)8UL));
+	t__2e374 = (u64)(*(u32 *)t__2e373);
+	t__2e373 = (u64)((u64)t__2e371 + (u64)((u64)12UL));
+	t__2e375 = (u64)(*(u32 *)t__2e373);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e372, (u64)t__2e374, (u64)t__2e375, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e377:;
+	t__2e378 = (u64)((u64)t_abortsite_2e369 * (u64)((u64)16UL));
+	t__2e378 = (u64)((u64)((u64)((char *)&D_abortsites_2e368)) + (u64)t__2e378);
+	t__2e379 = (u64)(*(u64 *)t__2e378);
+	t__2e380 = (u64)((u64)t__2e378 + (u64)((u64)8UL));
+	t__2e381 = (u64)(*(u32 *)t__2e380);
+	t__2e380 = (u64)((u64)t__2e378 + (u64)((u64)12UL));
+	t__2e382 = (u64)(*(u32 *)t__2e380);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e379, (u64)t__2e381, (u64)t__2e382, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_mandatory(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char A3[8] __attribute__((aligned(16)));
+	char A4[24] __attribute__((aligned(16)));
+	char B5[8] __attribute__((aligned(16)));
+	char B6[24] __attribute__((aligned(16)));
+	char B7[24] __attribute__((aligned(16)));
+	char R8[4] __attribute__((aligned(16)));
+	char B9[8] __attribute__((aligned(16)));
+	char B10[24] __attribute__((aligned(16)));
+	char B11[24] __attribute__((aligned(16)));
+	char R12[4] __attribute__((aligned(16)));
+	u64 t__2e409;
+	u64 t__2e411;
+	u64 t__2e417;
+	u64 t__2e426;
+	u64 t__2e428;
+	u64 t__2e432;
+	u64 t__2e433;
+	u64 t__2e434;
+	u64 t__2e435;
+	u64 t__2e436;
+	u64 t__2e439;
+	u64 t__2e440;
+	u64 t__2e441;
+	u64 t__2e442;
+	u64 t__2e443;
+	u64 t__2e445;
+	u64 t__2e447;
+	u64 t__2e449;
+	u64 t__2e458;
+	u64 t__2e460;
+	u64 t_abortsite_2e430;
+	u64 t_item_2e416;
+	u64 t_object_2e410;
+	u64 t_object_2e414;
+	u64 t_object_2e415;
+	u64 t_object_2e446;
+	u64 t_object_2e448;
+	u64 t_tag_2e418;
+	u64 t_tag_2e450;
+	L_start_2e404:;
+	t_object_2e410 = (u64)A0;
+	t_object_2e414 = (u64)A1;
+	t_object_2e415 = (u64)A2;
+	t_object_2e446 = (u64)A3;
+	t_object_2e448 = (u64)A4;
+	L_body_2e405:;
+	*(u32 *)t_object_2e410 = (u32)((u64)3532310079UL);
+	t__2e411 = (u64)((u64)t_object_2e410 + (u64)((u64)4UL));
+	*(u32 *)t__2e411 = (u32)((u64)0UL);
+	t_item_2e416 = (u64)((u64)t_object_2e415 + (u64)((u64)0UL));
+	BLIT(t_item_2e416, ((u64)((char *)&D_strliteral_2e136)), ((u64)24UL));
+	*(u64 *)t_object_2e414 = (u64)t_object_2e415;
+	t__2e417 = (u64)((u64)t_object_2e414 + (u64)((u64)8UL));
+	*(u64 *)t__2e417 = (u64)((u64)1UL);
+	t__2e417 = (u64)((u64)t__2e417 + (u64)((u64)8UL));
+	*(u64 *)t__2e417 = (u64)((u64)1UL);
+	BLIT((u64)B5, t_object_2e410, 8);
+	BLIT((u64)B6, ((u64)((char *)&D_strliteral_2e413)), 24);
+	BLIT((u64)B7, t_object_2e414, 24);
+	t__2e409 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R8, (u64)B5, (u64)B6, (u64)B7);
+	t_tag_2e418 = (u64)(*(u32 *)t__2e409);
+	t__2e426 = (u64)(u32)(((u32)t_tag_2e418 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e426) goto L_member_2e423; else goto L__2e425;
+	L__2e425:;
+	t__2e428 = (u64)(u32)(((u32)t_tag_2e418 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e428) goto L_member_2e424; else goto L__2e427;
+	L__2e427:;
+	goto L_matches_2e422;
+	L_member_2e423:;
+	goto L_matches_2e422;
+	L_member_2e424:;
+	goto L_matches_2e421;
+	L_matches_2e421:;
+	goto L__2e419;
+	L_matches_2e422:;
+	t_abortsite_2e430 = ((u64)0UL);
+	goto L_abort_2e431;
+	L__2e437:;
+	L__2e420:;
+	t_abortsite_2e430 = ((u64)1UL);
+	goto L_abort_2e438;
+	L__2e419:;
+	*(u32 *)t_object_2e446 = (u32)((u64)3532310079UL);
+	t__2e447 = (u64)((u64)t_object_2e446 + (u64)((u64)4UL));
+	*(u32 *)t__2e447 = (u32)((u64)4UL);
+	*(u64 *)t_object_2e448 = (u64)((u64)0UL);
+	t__2e449 = (u64)((u64)t_object_2e448 + (u64)((u64)8UL));
+	*(u64 *)t__2e449 = (u64)((u64)0UL);
+	t__2e449 = (u64)((u64)t__2e449 + (u64)((u64)8UL));
+	*(u64 *)t__2e449 = (u64)((u64)0UL);
+	BLIT((u64)B9, t_object_2e446, 8);
+	BLIT((u64)B10, ((u64)((char *)&D_strliteral_2e413)), 24);
+	BLIT((u64)B11, t_object_2e448, 24);
+	t__2e445 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R12, (u64)B9, (u64)B10, (u64)B11);
+	t_tag_2e450 = (u64)(*(u32 *)t__2e445);
+	t__2e458 = (u64)(u32)(((u32)t_tag_2e450 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e458) goto L_member_2e455; else goto L__2e457;
+	L__2e457:;
+	t__2e460 = (u64)(u32)(((u32)t_tag_2e450 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e460) goto L_member_2e456; else goto L__2e459;
+	L__2e459:;
+	goto L_matches_2e454;
+	L_member_2e455:;
+	goto L_matches_2e454;
+	L_member_2e456:;
+	goto L_matches_2e453;
+	L_matches_2e453:;
+	goto L__2e451;
+	L_matches_2e454:;
+	t_abortsite_2e430 = ((u64)2UL);
+	goto L_abort_2e431;
+	L__2e461:;
+	L__2e452:;
+	t_abortsite_2e430 = ((u64)3UL);
+	goto L_abort_2e438;
+	L__2e451:;
+	goto L__2e406;
+	L__2e462:;
+	L__2e406:;
+	return;
+	L_abort_2e431:;
+	t__2e432 = (u64)((u64)t_abortsite_2e430 * (u64)((u64)16UL));
+	t__2e432 = (u64)((u64)((u64)((char *)&D_abortsites_2e429)) + (u64)t__2e432);
+	t__2e433 = (u64)(*(u64 *)t__2e432);
+	t__2e434 = (u64)((u64)t__2e432 + (u64)((u64)8UL));
+	t__2e435 = (u64)(*(u32 *)t__2e434);
+	t__2e434 = (u64)((u64)t__2e432 + (u64)((u64)12UL));
+	t__2e436 = (u64)(*(u32 *)t__2e434);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e433, (u64)t__2e435, (u64)t__2e436, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e438:;
+	t__2e439 = (u64)((u64)t_abortsite_2e430 * (u64)((u64)16UL));
+	t__2e439 = (u64)((u64)((u64)((char *)&D_abortsites_2e429)) + (u64)t__2e439);
+	t__2e440 = (u64)(*(u64 *)t__2e439);
+	t__2e441 = (u64)((u64)t__2e439 + (u64)((u64)8UL));
+	t__2e442 = (u64)(*(u32 *)t__2e441);
+	t__2e441 = (u64)((u64)t__2e439 + (u64)((u64)12UL));
+	t__2e443 = (u64)(*(u32 *)t__2e441);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e440, (u64)t__2e442, (u64)t__2e443, (u64)((u64)4UL));
+	__builtin_trap();
+}
+static void F_import(void) {
+	char A0[8] __attribute__((aligned(16)));
+	char A1[24] __attribute__((aligned(16)));
+	char A2[24] __attribute__((aligned(16)));
+	char B3[8] __attribute__((aligned(16)));
+	char B4[24] __attribute__((aligned(16)));
+	char B5[24] __attribute__((aligned(16)));
+	char R6[4] __attribute__((aligned(16)));
+	u64 t__2e468;
+	u64 t__2e470;
+	u64 t__2e476;
+	u64 t__2e485;
+	u64 t__2e487;
+	u64 t__2e491;
+	u64 t__2e492;
+	u64 t__2e493;
+	u64 t__2e494;
+	u64 t__2e495;
+	u64 t__2e498;
+	u64 t__2e499;
+	u64 t__2e500;
+	u64 t__2e501;
+	u64 t__2e502;
+	u64 t_abortsite_2e489;
+	u64 t_item_2e475;
+	u64 t_object_2e469;
+	u64 t_object_2e473;
+	u64 t_object_2e474;
+	u64 t_tag_2e477;
+	L_start_2e463:;
+	t_object_2e469 = (u64)A0;
+	t_object_2e473 = (u64)A1;
+	t_object_2e474 = (u64)A2;
+	L_body_2e464:;
+	*(u32 *)t_object_2e469 = (u32)((u64)3532310079UL);
+	t__2e470 = (u64)((u64)t_object_2e469 + (u64)((u64)4UL));
+	*(u32 *)t__2e470 = (u32)((u64)4UL);
+	t_item_2e475 = (u64)((u64)t_object_2e474 + (u64)((u64)0UL));
+	BLIT(t_item_2e475, ((u64)((char *)&D_strliteral_2e136)), ((u64)24UL));
+	*(u64 *)t_object_2e473 = (u64)t_object_2e474;
+	t__2e476 = (u64)((u64)t_object_2e473 + (u64)((u64)8UL));
+	*(u64 *)t__2e476 = (u64)((u64)1UL);
+	t__2e476 = (u64)((u64)t__2e476 + (u64)((u64)8UL));
+	*(u64 *)t__2e476 = (u64)((u64)1UL);
+	BLIT((u64)B3, t_object_2e469, 8);
+	BLIT((u64)B4, ((u64)((char *)&D_strliteral_2e472)), 24);
+	BLIT((u64)B5, t_object_2e473, 24);
+	t__2e468 = ((u64 (*)(u64, u64, u64, u64))((u64)X_rt_2ecompile))((u64)R6, (u64)B3, (u64)B4, (u64)B5);
+	t_tag_2e477 = (u64)(*(u32 *)t__2e468);
+	t__2e485 = (u64)(u32)(((u32)t_tag_2e477 == (u32)((u64)583903339UL)));
+	if ((u32)t__2e485) goto L_member_2e482; else goto L__2e484;
+	L__2e484:;
+	t__2e487 = (u64)(u32)(((u32)t_tag_2e477 == (u32)((u64)3012680272UL)));
+	if ((u32)t__2e487) goto L_member_2e483; else goto L__2e486;
+	L__2e486:;
+	goto L_matches_2e481;
+	L_member_2e482:;
+	goto L_matches_2e481;
+	L_member_2e483:;
+	goto L_matches_2e480;
+	L_matches_2e480:;
+	goto L__2e478;
+	L_matches_2e481:;
+	t_abortsite_2e489 = ((u64)0UL);
+	goto L_abort_2e490;
+	L__2e496:;
+	L__2e479:;
+	t_abortsite_2e489 = ((u64)1UL);
+	goto L_abort_2e497;
+	L__2e478:;
+	goto L__2e465;
+	L__2e503:;
+	L__2e465:;
+	return;
+	L_abort_2e490:;
+	t__2e491 = (u64)((u64)t_abortsite_2e489 * (u64)((u64)16UL));
+	t__2e491 = (u64)((u64)((u64)((char *)&D_abortsites_2e488)) + (u64)t__2e491);
+	t__2e492 = (u64)(*(u64 *)t__2e491);
+	t__2e493 = (u64)((u64)t__2e491 + (u64)((u64)8UL));
+	t__2e494 = (u64)(*(u32 *)t__2e493);
+	t__2e493 = (u64)((u64)t__2e491 + (u64)((u64)12UL));
+	t__2e495 = (u64)(*(u32 *)t__2e493);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e492, (u64)t__2e494, (u64)t__2e495, (u64)((u64)7UL));
+	__builtin_trap();
+	L_abort_2e497:;
+	t__2e498 = (u64)((u64)t_abortsite_2e489 * (u64)((u64)16UL));
+	t__2e498 = (u64)((u64)((u64)((char *)&D_abortsites_2e488)) + (u64)t__2e498);
+	t__2e499 = (u64)(*(u64 *)t__2e498);
+	t__2e500 = (u64)((u64)t__2e498 + (u64)((u64)8UL));
+	t__2e501 = (u64)(*(u32 *)t__2e500);
+	t__2e500 = (u64)((u64)t__2e498 + (u64)((u64)12UL));
+	t__2e502 = (u64)(*(u32 *)t__2e500);
+	((void (*)(u64, u64, u64, u64))((u64)X_rt_2eabort__fixed))((u64)t__2e499, (u64)t__2e501, (u64)t__2e502, (u64)((u64)4UL));
+	__builtin_trap();
+}
@@ -6,6 +6,7 @@ BINDIR = $(PREFIX)/bin
 PLATFORM = linux
 ARCH = x86_64
 HARECFLAGS =
+RTFLAGS =
 QBEFLAGS =
 ASFLAGS =
 LDLINKFLAGS = --gc-sections -z noexecstack
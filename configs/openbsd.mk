@@ -6,6 +6,7 @@ BINDIR = $(PREFIX)/bin
 PLATFORM = openbsd
 ARCH = x86_64
 HARECFLAGS = -N "" -m .main
+RTFLAGS =
 QBEFLAGS =
 ASFLAGS =
 LDLINKFLAGS = -z nobtcfi
@@ -0,0 +1,13 @@
+#ifndef HARE_ASTCACHE_H
+#define HARE_ASTCACHE_H
+#include <stdio.h>
+
+struct ast_subunit;
+
+// Parses a seekable source file into subunit, like parse(), and closes it.
+// The AST is cached in dir, keyed by the file's contents and the harec
+// version, and loaded from there instead when the file hasn't changed.
+void astcache_parse(const char *dir, FILE *in, int fileid,
+	struct ast_subunit *subunit);
+
+#endif
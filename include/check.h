@@ -12,6 +12,12 @@ struct expression;
 
 #define MODCACHE_BUCKETS 256
 
+// Largest number of expressions in the body of an inlinable function
+#define INLINE_EXPRS_MAX 24
+
+// Largest object which may be allocated on the stack in place of the heap
+#define STACK_ALLOC_MAX 4096
+
 struct modcache {
 	struct identifier ident;
 	struct scope *scope;
@@ -24,6 +30,33 @@ struct errors {
 	struct errors *next;
 };
 
+// Records that an index binding is less than the length of a slice or array
+// binding, or than a constant, for the duration of a loop body. Accesses
+// indexing the object with the binding in the body don't need bounds checks,
+// provided that neither is modified in the body nor has its address taken.
+struct bound_fact {
+	const struct scope_object *index;
+	const struct scope_object *object; // NULL if bounded by length
+	size_t length;
+	bool clobbered;
+	struct expression **accesses;
+	size_t naccesses;
+	struct bound_fact *next;
+};
+
+// Records a binding initialized by an allocation. If every use of the binding
+// dereferences or frees it, and no address within the object is taken, the
+// pointer cannot escape the function, and the object may live on the stack.
+struct alloc_fact {
+	const struct scope_object *object;
+	struct expression *alloc;
+	size_t uses, derefs;
+	bool escaped;
+	struct expression **frees;
+	size_t nfrees;
+	struct alloc_fact *next;
+};
+
 struct context {
 	type_store *store;
 	struct modcache **modcache;
@@ -34,11 +67,19 @@ struct context {
 	struct scope *defines;
 	const char *mainsym;
 	bool is_test;
+	bool interface_only;
 	int id;
 	struct errors *errors;
 	struct errors **next;
 	struct declarations *decls;
 	struct ast_types *unresolved;
+	struct bound_fact *bounds; // Of the loops being checked
+	struct bound_fact *proven; // Of the loops checked in this function
+	struct alloc_fact *allocs; // Of the function being checked
+	size_t writes; // Expressions checked so far which may write to memory
+	bool deferred; // Whether the function being checked has any defers
+	size_t exprs; // Expressions checked so far
+	bool noinline; // Whether the function being checked cannot be inlined
 };
 
 struct constant_decl {
@@ -51,6 +92,8 @@ struct function_decl {
 	struct expression *body;
 	struct scope *scope;
 	unsigned int flags; // enum func_decl_flags
+	// Small leaf function, which gen may generate in place of calls to it
+	bool inlinable;
 };
 
 struct global_decl {
@@ -72,6 +115,7 @@ struct declaration {
 	struct identifier ident;
 	char *symbol;
 	bool exported; // XXX: this bool takes up 8 bytes and i am in pain
+	bool has_symbol; // Whether the symbol was given with @symbol
 	union {
 		struct constant_decl constant;
 		struct function_decl func;
@@ -140,6 +184,7 @@ void wrap_resolver(struct context *ctx,
 
 struct scope *check(type_store *ts,
 	bool is_test,
+	bool interface_only,
 	const char *mainsym,
 	const struct ast_global_decl *defines,
 	const struct ast_unit *aunit,
@@ -148,6 +193,7 @@ struct scope *check(type_store *ts,
 struct scope *check_internal(type_store *ts,
 	struct modcache **cache,
 	bool is_test,
+	bool interface_only,
 	const char *mainsym,
 	const struct ast_global_decl *defines,
 	const struct ast_unit *aunit,
@@ -2,6 +2,8 @@
 #define HAREC_EMIT_H
 
 struct qbe_program;
-void emit(const struct qbe_program *program, FILE *out);
+
+// Writes the program as QBE IL, returning the number of bytes written
+size_t emit(const struct qbe_program *program, FILE *out);
 
 #endif
@@ -89,6 +89,7 @@ struct expression_alloc {
 	enum alloc_kind kind;
 	struct expression *init;
 	struct expression *cap;
+	bool on_stack; // ALLOC_OBJECT: the pointer doesn't escape the function
 };
 
 struct expression_append {
@@ -264,10 +265,13 @@ struct expression_for {
 	struct expression *cond;
 	struct expression *afterthought;
 	struct expression *body;
+	// FOR_EACH_VALUE: the binding may refer to each element in place
+	bool in_place;
 };
 
 struct expression_free {
 	struct expression *expr;
+	bool on_stack; // Frees an object allocated on the stack
 };
 
 struct expression_if {
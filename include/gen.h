@@ -38,14 +38,27 @@ struct gen_slice {
 struct gen_binding {
 	const struct scope_object *object;
 	struct gen_value value;
-	struct gen_binding *next;
+	struct gen_binding *next; // Bound before this one
+	struct gen_binding *bnext; // In the same bucket
 };
 
 struct gen_defer {
 	const struct expression *expr;
+	// Shared cleanup block which runs this defer and those before it, if
+	// any exit jumps to it
+	struct qbe_statement llanding;
+	struct qbe_value landing;
 	struct gen_defer *next;
 };
 
+// An exit which runs its defers in the shared cleanup blocks, and resumes at
+// its own label once they're done
+struct gen_exit {
+	uint32_t id;
+	struct qbe_value resume;
+	struct gen_exit *next;
+};
+
 struct gen_scope {
 	const char *label;
 	const struct scope *scope;
@@ -54,9 +67,79 @@ struct gen_scope {
 	struct qbe_value *after;
 	struct qbe_value *end;
 	struct gen_defer *defers;
+	struct gen_exit *exits; // Which resume after this scope's defers
+	struct gen_defer *onward; // Next defer to run for the other exits
 	struct gen_scope *parent;
 };
 
+#define QTYPE_BUCKETS 1024
+#define STRPOOL_BUCKETS 1024
+#define INLINE_BUCKETS 256
+#define REACH_BUCKETS 1024
+#define BINDING_BUCKETS 1024
+
+// Maps a Hare type to the QBE aggregate type defined for it
+struct qtype_bucket {
+	const struct qbe_type *qtype;
+	struct qtype_bucket *next;
+};
+
+// The data definitions emitted for a string literal's contents, shared by
+// all literals with the same contents
+struct strpool_entry {
+	const char *str;
+	size_t len;
+	char *data; // Name of the contents
+	char *literal; // Name of a str object referring to them
+	struct strpool_entry *next;
+};
+
+// An out-of-line block which runs the pending defers and then aborts, shared
+// by all failure sites of a function with the same reason and defers to run
+struct gen_abort {
+	enum fixed_aborts reason;
+	struct gen_defer **defers;
+	size_t ndefers;
+	struct qbe_value label;
+	struct gen_abort *next;
+};
+
+// Code which is moved out of the hot path, to the end of the current function
+struct gen_cold {
+	struct qbe_statements body;
+	bool active; // Whether code is being generated into body
+	struct gen_abort *aborts;
+	// Path, line and column of each failure site, and the index of the
+	// site a shared abort block was reached from
+	struct qbe_def *sites;
+	struct qbe_data_item *last_site;
+	size_t nsites;
+	struct qbe_value site;
+};
+
+// A function of the unit which is generated in place of calls to it
+struct gen_inline {
+	const struct declaration *decl;
+	struct gen_inline *next;
+};
+
+// A function or global of the unit which is only generated once generated
+// code refers to it, unless it may be referred to from outside the unit
+struct gen_reach {
+	const struct declaration *decl;
+	bool reached;
+	struct gen_reach *next;
+};
+
+#define CHECKED_MAX 8
+
+// An index into an object which was bounds checked at the given position in
+// the function body
+struct gen_checked {
+	const struct scope_object *array, *index;
+	size_t pos;
+};
+
 struct rt {
 	struct qbe_value abort, ensure, fixedabort, free, malloc,
 			 memcpy, memmove, memset, strcmp, unensure;
@@ -73,14 +156,29 @@ struct gen_context {
 	int id;
 
 	struct qbe_func *current;
+	int file; // Which the current function's debug locations refer to
 	const struct type *functype;
-	struct gen_binding *bindings;
+	struct gen_binding *bindings; // Most recent first
+	struct gen_binding *bound[BINDING_BUCKETS];
 	struct gen_scope *scope;
+	struct gen_cold cold;
+	struct qbe_value cleanup; // Selects the exit to resume after defers
+	uint32_t nexits;
+	struct gen_checked checked[CHECKED_MAX];
+	size_t nchecked;
+	struct qtype_bucket *qtypes[QTYPE_BUCKETS];
+	struct strpool_entry *strpool[STRPOOL_BUCKETS];
+	struct gen_inline *inlines[INLINE_BUCKETS];
+	struct gen_reach *reach[REACH_BUCKETS];
+	// Declarations which were reached but not generated yet
+	const struct declaration **pending;
+	size_t npending, pending_sz;
 };
 
 struct unit;
 
-void gen(const struct unit *unit, type_store *store, struct qbe_program *out);
+void gen(const struct unit *unit, type_store *store, struct qbe_program *out,
+	bool inline_calls);
 
 // genutil.c
 void rtfunc_init(struct gen_context *ctx);
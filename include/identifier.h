@@ -31,4 +31,19 @@ char *ident_to_sym(const struct identifier *ident);
 void identifier_dup(struct identifier *new, const struct identifier *ident);
 bool identifier_eq(const struct identifier *a, const struct identifier *b);
 
+#ifdef ALLOC_PROFILE
+// The returned memory is charged to the caller's subsystem; see util.h
+char *identifier_unparse_profiled(const struct identifier *ident,
+	const char *file);
+char *ident_to_sym_profiled(const struct identifier *ident, const char *file);
+void identifier_dup_profiled(struct identifier *new,
+	const struct identifier *ident, const char *file);
+
+#define identifier_unparse(ident) \
+	identifier_unparse_profiled((ident), __FILE__)
+#define ident_to_sym(ident) ident_to_sym_profiled((ident), __FILE__)
+#define identifier_dup(new, ident) \
+	identifier_dup_profiled((new), (ident), __FILE__)
+#endif
+
 #endif
@@ -3,6 +3,11 @@
 #include "identifier.h"
 #include "scope.h"
 
+// Paths of every typedef file read while resolving imports, in the order in
+// which they were opened
+extern const char **module_paths;
+extern size_t nmodule_paths;
+
 struct ast_global_decl;
 struct context;
 struct scope *module_resolve(struct context *ctx,
@@ -239,6 +239,7 @@ struct qbe_data {
 	size_t align;
 	char *section, *secflags;
 	bool threadlocal;
+	bool readonly;
 	struct qbe_data_item items;
 };
 
@@ -262,6 +263,10 @@ struct qbe_def {
 };
 
 struct qbe_program {
+	// Type definitions are kept apart from other definitions, and emitted
+	// before them
+	struct qbe_def *types;
+	struct qbe_def **next_type;
 	struct qbe_def *defs;
 	struct qbe_def **next;
 };
@@ -278,4 +283,7 @@ struct qbe_value constw(uint32_t w);
 struct qbe_value consts(float s);
 struct qbe_value constd(double d);
 
+// qopt.c
+void qbe_optimize(struct qbe_func *func);
+
 #endif
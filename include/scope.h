@@ -16,6 +16,8 @@ enum object_type {
 enum scope_object_flags {
 	SO_THREADLOCAL = 1 << 0,
 	SO_FOR_EACH_SUBJECT = 1 << 1,
+	SO_ADDRESS_TAKEN = 1 << 2,
+	SO_ALLOCATED = 1 << 3,
 };
 
 struct scope_object {
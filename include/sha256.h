@@ -0,0 +1,19 @@
+#ifndef HARE_SHA256_H
+#define HARE_SHA256_H
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA256_SIZE 32
+
+struct sha256 {
+	uint32_t state[8];
+	uint64_t len; // Bytes written so far
+	unsigned char block[64];
+	size_t nblock;
+};
+
+void sha256_init(struct sha256 *ctx);
+void sha256_write(struct sha256 *ctx, const void *data, size_t sz);
+void sha256_finish(struct sha256 *ctx, unsigned char out[SHA256_SIZE]);
+
+#endif
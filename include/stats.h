@@ -0,0 +1,34 @@
+#ifndef HARE_STATS_H
+#define HARE_STATS_H
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Running totals which are cheap enough to maintain unconditionally
+struct stats_counters {
+	uint64_t allocs;
+	uint64_t alloc_bytes;
+	uint64_t types;
+	uint64_t scopes;
+	uint64_t statements;
+	int64_t output_bytes; // -1 if nothing was emitted
+};
+
+extern struct stats_counters stats_counters;
+
+// Set to record per-phase timings with stats_begin and stats_end
+extern bool stats_enabled;
+
+// Starts timing a phase of compilation, optionally about a given subject (a
+// file name or a module). Phases may be nested, in which case the parent's
+// figures include those of its children.
+void stats_begin(const char *phase, const char *subject);
+void stats_end(void);
+
+// Records a declaration which wasn't generated, since nothing refers to it
+void stats_dropped(const char *symbol);
+
+// Writes all recorded phases and counters as a JSON object.
+void stats_report(FILE *out);
+
+#endif
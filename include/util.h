@@ -46,8 +46,27 @@ int xvfprintf(FILE *restrict f, const char *restrict fmt, va_list ap) FORMAT(0);
 #define realloc(a, b) (void *)sizeof(struct { static_assert(0, "Use xrealloc instead"); int _; })
 #define strdup(s) (char *)(sizeof(struct { static_assert(0, "Use xstrdup instead"); int _; })
 
+#ifdef ALLOC_PROFILE
+// Profiling build: every allocation is tagged with the subsystem of the file
+// it was made from, and a summary is printed to stderr at exit.
+void *xcalloc_profiled(size_t n, size_t s, const char *file);
+void *xrealloc_profiled(void *p, size_t s, const char *file);
+char *xstrdup_profiled(const char *s, const char *file);
+void xfree_profiled(void *p);
+
+#define xcalloc(n, s) xcalloc_profiled((n), (s), __FILE__)
+#define xrealloc(p, s) xrealloc_profiled((p), (s), __FILE__)
+#define xstrdup(s) xstrdup_profiled((s), __FILE__)
+#define free(p) xfree_profiled(p)
+#endif
+
 char *gen_name(int *id, const char *fmt);
 
+#ifdef ALLOC_PROFILE
+char *gen_name_profiled(int *id, const char *fmt, const char *file);
+#define gen_name(id, fmt) gen_name_profiled((id), (fmt), __FILE__)
+#endif
+
 void errline(struct location loc);
 
 #endif
@@ -8,3 +8,5 @@ _rt_ha = \
 _rt_s = \
 	rt/+$(PLATFORM)/start+$(ARCH).s \
 	rt/+$(PLATFORM)/syscall+$(ARCH).s
+
+_rtmem_s = rt/+$(PLATFORM)/syscall+$(ARCH).s
@@ -5,3 +5,5 @@ _rt_ha = \
 
 _rt_s = \
 	rt/+openbsd/platformstart.s
+
+_rtmem_s =
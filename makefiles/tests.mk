@@ -4,6 +4,7 @@ test_objects = \
 	src/parse.o \
 	src/type_store.o \
 	src/scope.o \
+	src/stats.o \
 	src/identifier.o \
 	src/util.o \
 	src/types.o \
@@ -38,7 +39,7 @@ rt_ha = \
 $(HARECACHE)/rt.ssa: $(rt_ha) $(BINOUT)/harec
 	@mkdir -p -- $(HARECACHE)
 	@printf 'HAREC\t%s\n' '$@'
-	@$(TDENV) $(BINOUT)/harec $(HARECFLAGS) -o $@ -t $(HARECACHE)/rt.td.tmp -N rt $(rt_ha)
+	@$(TDENV) $(BINOUT)/harec $(HARECFLAGS) $(RTFLAGS) -o $@ -t $(HARECACHE)/rt.td.tmp -N rt $(rt_ha)
 
 rt_s = $(HARECACHE)/rt.s $(_rt_s)
 $(HARECACHE)/rt.o: $(rt_s)
@@ -419,6 +420,33 @@ tests/30-reduction: tests/30-reduction.o $(test_objects)
 	@printf 'CCLD\t%s\n' '$@'
 	@$(CC) $(LDFLAGS) $(LIBS) -o $@ tests/30-reduction.o $(test_objects)
 
+# The runtime without its startup code, for its memory routines and allocator
+rtmem_ha = \
+	rt/abort.ha \
+	rt/cstrings.ha \
+	rt/memcpy.ha \
+	rt/memmove.ha \
+	rt/memset.ha \
+	rt/+$(PLATFORM)/errno.ha \
+	rt/+$(PLATFORM)/syscalls.ha \
+	$(_rt_ha)
+$(HARECACHE)/rtmem.ssa: $(rtmem_ha) $(BINOUT)/harec
+	@mkdir -p -- $(HARECACHE)
+	@printf 'HAREC\t%s\n' '$@'
+	@$(BINOUT)/harec $(HARECFLAGS) $(RTFLAGS) -o $@ -N rt $(rtmem_ha)
+
+rtmem_s = $(HARECACHE)/rtmem.s $(_rtmem_s)
+$(HARECACHE)/rtmem.o: $(rtmem_s)
+	@printf 'AS\t%s\n' '$@'
+	@$(AS) $(ASFLAGS) -o $@ $(rtmem_s)
+
+# The runtime's code isn't position-independent
+$(BINOUT)/microbench: tests/microbench.o $(HARECACHE)/rtmem.o $(test_objects)
+	@printf 'CCLD\t%s\n' '$@'
+	@mkdir -p -- $(BINOUT)
+	@$(CC) $(LDFLAGS) -no-pie $(LIBS) -o $@ tests/microbench.o \
+		$(HARECACHE)/rtmem.o $(test_objects)
+
 
 tests/31-postfix: $(HARECACHE)/rt.o $(HARECACHE)/tests_31_postfix.o
 	@printf 'LD\t%s\t\n' '$@'
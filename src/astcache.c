@@ -0,0 +1,1402 @@
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "ast.h"
+#include "astcache.h"
+#include "expr.h"
+#include "identifier.h"
+#include "lex.h"
+#include "parse.h"
+#include "sha256.h"
+#include "types.h"
+#include "util.h"
+
+// The cache key is a SHA-256 digest of the source contents, VERSION, and
+// AST_CACHE_FORMAT, so entries written by another harec are simply never
+// found. Each entry records the full digest, which is checked on load. Bump
+// the format whenever ast.h or the encoding below changes.
+#define AST_CACHE_FORMAT 2
+#define AST_CACHE_MAGIC "harec ast cache\n"
+
+#define FNV1A64_INIT 14695981039346656037u
+#define FNV1A64_PRIME 1099511628211u
+
+static uint64_t
+fnv1a64(uint64_t hash, const void *data, size_t sz)
+{
+	const unsigned char *p = data;
+	for (size_t i = 0; i < sz; i++) {
+		hash = (hash ^ p[i]) * FNV1A64_PRIME;
+	}
+	return hash;
+}
+
+// Integers are written as unsigned LEB128. Strings and pointers are prefixed
+// with a value which is zero for NULL. Locations only record whether they
+// refer to the file being parsed, since the file index differs between runs.
+
+static void
+write_uint(FILE *out, uint64_t v)
+{
+	do {
+		unsigned char c = v & 0x7f;
+		v >>= 7;
+		if (v) {
+			c |= 0x80;
+		}
+		fputc(c, out);
+	} while (v);
+}
+
+static void
+write_bytes(FILE *out, const char *s, size_t sz)
+{
+	write_uint(out, sz);
+	fwrite(s, 1, sz, out);
+}
+
+static void
+write_str(FILE *out, const char *s)
+{
+	if (!s) {
+		write_uint(out, 0);
+		return;
+	}
+	size_t sz = strlen(s);
+	write_uint(out, sz + 1);
+	fwrite(s, 1, sz, out);
+}
+
+static void
+write_loc(FILE *out, struct location loc)
+{
+	write_uint(out, loc.file != 0);
+	write_uint(out, (unsigned int)loc.lineno);
+	write_uint(out, (unsigned int)loc.colno);
+}
+
+static void
+write_ident(FILE *out, const struct identifier *ident)
+{
+	write_str(out, ident->name);
+	write_uint(out, ident->ns != NULL);
+	if (ident->ns) {
+		write_ident(out, ident->ns);
+	}
+}
+
+static void write_expr(FILE *out, const struct ast_expression *expr);
+
+static void
+write_type(FILE *out, const struct ast_type *type)
+{
+	if (!type) {
+		write_uint(out, 0);
+		return;
+	}
+	write_uint(out, type->storage + 1);
+	write_loc(out, type->loc);
+	write_uint(out, type->flags);
+
+	size_t n = 0;
+	switch (type->storage) {
+	case STORAGE_ALIAS:
+		write_ident(out, &type->alias);
+		write_uint(out, type->unwrap);
+		break;
+	case STORAGE_ARRAY:
+	case STORAGE_SLICE:
+		write_expr(out, type->array.length);
+		write_type(out, type->array.members);
+		write_uint(out, type->array.contextual);
+		break;
+	case STORAGE_ENUM:
+		write_ident(out, &type->alias);
+		write_uint(out, type->_enum.storage);
+		for (const struct ast_enum_field *f = type->_enum.values;
+				f; f = f->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_enum_field *f = type->_enum.values;
+				f; f = f->next) {
+			write_loc(out, f->loc);
+			write_str(out, f->name);
+			write_expr(out, f->value);
+		}
+		break;
+	case STORAGE_FUNCTION:
+		write_type(out, type->func.result);
+		for (const struct ast_function_parameters *p = type->func.params;
+				p; p = p->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_function_parameters *p = type->func.params;
+				p; p = p->next) {
+			write_loc(out, p->loc);
+			write_str(out, p->name);
+			write_type(out, p->type);
+			write_expr(out, p->default_value);
+		}
+		write_uint(out, type->func.variadism);
+		break;
+	case STORAGE_POINTER:
+		write_type(out, type->pointer.referent);
+		write_uint(out, type->pointer.flags);
+		break;
+	case STORAGE_STRUCT:
+	case STORAGE_UNION:
+		for (const struct ast_struct_union_field *f =
+				&type->struct_union.fields; f; f = f->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_struct_union_field *f =
+				&type->struct_union.fields; f; f = f->next) {
+			write_expr(out, f->offset);
+			write_str(out, f->name);
+			write_type(out, f->type);
+		}
+		write_uint(out, type->struct_union.packed);
+		break;
+	case STORAGE_TAGGED:
+		for (const struct ast_tagged_union_type *t = &type->tagged;
+				t; t = t->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_tagged_union_type *t = &type->tagged;
+				t; t = t->next) {
+			write_type(out, t->type);
+		}
+		break;
+	case STORAGE_TUPLE:
+		for (const struct ast_tuple_type *t = &type->tuple;
+				t; t = t->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_tuple_type *t = &type->tuple;
+				t; t = t->next) {
+			write_type(out, t->type);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static void
+write_expr_list(FILE *out, const struct ast_expression_list *list)
+{
+	size_t n = 0;
+	for (const struct ast_expression_list *l = list; l; l = l->next) {
+		n++;
+	}
+	write_uint(out, n);
+	for (const struct ast_expression_list *l = list; l; l = l->next) {
+		write_expr(out, l->expr);
+	}
+}
+
+static void
+write_binding(FILE *out, const struct ast_expression_binding *binding)
+{
+	size_t n = 0;
+	for (const struct ast_expression_binding *b = binding; b; b = b->next) {
+		n++;
+	}
+	write_uint(out, n);
+	for (const struct ast_expression_binding *b = binding; b; b = b->next) {
+		write_str(out, b->name);
+		size_t nunpack = 0;
+		for (const struct ast_binding_unpack *u = b->unpack;
+				u; u = u->next) {
+			nunpack++;
+		}
+		write_uint(out, nunpack);
+		for (const struct ast_binding_unpack *u = b->unpack;
+				u; u = u->next) {
+			write_str(out, u->name);
+		}
+		write_type(out, b->type);
+		write_uint(out, b->flags);
+		write_uint(out, b->is_static);
+		write_expr(out, b->initializer);
+	}
+}
+
+static void
+write_assert(FILE *out, const struct ast_expression_assert *assert)
+{
+	write_expr(out, assert->cond);
+	write_expr(out, assert->message);
+	write_uint(out, assert->is_static);
+}
+
+static void
+write_literal(FILE *out, const struct ast_expression_literal *lit)
+{
+	write_uint(out, lit->storage);
+	size_t n = 0;
+	switch (lit->storage) {
+	case STORAGE_U8:
+	case STORAGE_U16:
+	case STORAGE_U32:
+	case STORAGE_U64:
+	case STORAGE_UINT:
+	case STORAGE_UINTPTR:
+	case STORAGE_SIZE:
+		write_uint(out, lit->uval);
+		break;
+	case STORAGE_I8:
+	case STORAGE_I16:
+	case STORAGE_I32:
+	case STORAGE_I64:
+	case STORAGE_ICONST:
+	case STORAGE_INT:
+		write_uint(out, (uint64_t)lit->ival);
+		break;
+	case STORAGE_F32:
+	case STORAGE_F64:
+	case STORAGE_FCONST:;
+		uint64_t bits;
+		memcpy(&bits, &lit->fval, sizeof(bits));
+		write_uint(out, bits);
+		break;
+	case STORAGE_RCONST:
+		write_uint(out, lit->rune);
+		break;
+	case STORAGE_BOOL:
+		write_uint(out, lit->bval);
+		break;
+	case STORAGE_STRING:
+		write_bytes(out, lit->string.value, lit->string.len);
+		break;
+	case STORAGE_ARRAY:
+		for (const struct ast_array_literal *a = lit->array;
+				a; a = a->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_array_literal *a = lit->array;
+				a; a = a->next) {
+			write_expr(out, a->value);
+			write_uint(out, a->expand);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static void
+write_expr(FILE *out, const struct ast_expression *expr)
+{
+	if (!expr) {
+		write_uint(out, 0);
+		return;
+	}
+	write_uint(out, expr->type + 1);
+	write_loc(out, expr->loc);
+
+	size_t n = 0;
+	switch (expr->type) {
+	case EXPR_ACCESS:
+		write_uint(out, expr->access.type);
+		switch (expr->access.type) {
+		case ACCESS_IDENTIFIER:
+			write_ident(out, &expr->access.ident);
+			break;
+		case ACCESS_INDEX:
+			write_expr(out, expr->access.array);
+			write_expr(out, expr->access.index);
+			break;
+		case ACCESS_FIELD:
+			write_expr(out, expr->access._struct);
+			write_str(out, expr->access.field);
+			break;
+		case ACCESS_TUPLE:
+			write_expr(out, expr->access.tuple);
+			write_expr(out, expr->access.value);
+			break;
+		}
+		break;
+	case EXPR_ALLOC:
+		write_uint(out, expr->alloc.kind);
+		write_expr(out, expr->alloc.init);
+		write_expr(out, expr->alloc.cap);
+		break;
+	case EXPR_APPEND:
+	case EXPR_INSERT:
+		write_expr(out, expr->append.object);
+		write_expr(out, expr->append.value);
+		write_expr(out, expr->append.length);
+		write_uint(out, expr->append.is_static);
+		write_uint(out, expr->append.is_multi);
+		break;
+	case EXPR_ASSERT:
+		write_assert(out, &expr->assert);
+		break;
+	case EXPR_ASSIGN:
+		write_uint(out, expr->assign.op);
+		write_expr(out, expr->assign.object);
+		write_expr(out, expr->assign.value);
+		break;
+	case EXPR_BINARITHM:
+		write_uint(out, expr->binarithm.op);
+		write_expr(out, expr->binarithm.lvalue);
+		write_expr(out, expr->binarithm.rvalue);
+		break;
+	case EXPR_BINDING:
+	case EXPR_DEFINE:
+		write_binding(out, &expr->binding);
+		break;
+	case EXPR_BREAK:
+	case EXPR_CONTINUE:
+	case EXPR_YIELD:
+		write_str(out, expr->control.label);
+		write_expr(out, expr->control.value);
+		break;
+	case EXPR_CALL:
+		write_expr(out, expr->call.lvalue);
+		for (const struct ast_call_argument *a = expr->call.args;
+				a; a = a->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_call_argument *a = expr->call.args;
+				a; a = a->next) {
+			write_uint(out, a->variadic);
+			write_expr(out, a->value);
+		}
+		break;
+	case EXPR_CAST:
+		write_uint(out, expr->cast.kind);
+		write_expr(out, expr->cast.value);
+		write_type(out, expr->cast.type);
+		break;
+	case EXPR_COMPOUND:
+		write_str(out, expr->compound.label);
+		write_loc(out, expr->compound.label_loc);
+		write_expr_list(out, &expr->compound.list);
+		break;
+	case EXPR_DEFER:
+		write_expr(out, expr->defer.deferred);
+		break;
+	case EXPR_DELETE:
+		write_expr(out, expr->delete.expr);
+		write_uint(out, expr->delete.is_static);
+		break;
+	case EXPR_FOR:
+		write_uint(out, expr->_for.kind);
+		write_str(out, expr->_for.label);
+		write_expr(out, expr->_for.bindings);
+		write_expr(out, expr->_for.cond);
+		write_expr(out, expr->_for.afterthought);
+		write_expr(out, expr->_for.body);
+		break;
+	case EXPR_FREE:
+		write_expr(out, expr->free.expr);
+		break;
+	case EXPR_IF:
+		write_expr(out, expr->_if.cond);
+		write_expr(out, expr->_if.true_branch);
+		write_expr(out, expr->_if.false_branch);
+		break;
+	case EXPR_MEASURE:
+		write_uint(out, expr->measure.op);
+		switch (expr->measure.op) {
+		case M_ALIGN:
+		case M_SIZE:
+			write_type(out, expr->measure.type);
+			break;
+		case M_LEN:
+		case M_OFFSET:
+			write_expr(out, expr->measure.value);
+			break;
+		}
+		break;
+	case EXPR_LITERAL:
+		write_literal(out, &expr->literal);
+		break;
+	case EXPR_MATCH:
+		write_str(out, expr->match.label);
+		write_expr(out, expr->match.value);
+		for (const struct ast_match_case *c = expr->match.cases;
+				c; c = c->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_match_case *c = expr->match.cases;
+				c; c = c->next) {
+			write_str(out, c->name);
+			write_type(out, c->type);
+			write_expr_list(out, &c->exprs);
+		}
+		break;
+	case EXPR_PROPAGATE:
+		write_expr(out, expr->propagate.value);
+		write_uint(out, expr->propagate.abort);
+		break;
+	case EXPR_RETURN:
+		write_expr(out, expr->_return.value);
+		break;
+	case EXPR_SLICE:
+		write_expr(out, expr->slice.object);
+		write_expr(out, expr->slice.start);
+		write_expr(out, expr->slice.end);
+		break;
+	case EXPR_STRUCT:
+		write_uint(out, expr->_struct.autofill);
+		write_ident(out, &expr->_struct.type);
+		for (const struct ast_field_value *f = expr->_struct.fields;
+				f; f = f->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_field_value *f = expr->_struct.fields;
+				f; f = f->next) {
+			write_str(out, f->name);
+			write_type(out, f->type);
+			write_expr(out, f->initializer);
+		}
+		break;
+	case EXPR_SWITCH:
+		write_str(out, expr->_switch.label);
+		write_expr(out, expr->_switch.value);
+		for (const struct ast_switch_case *c = expr->_switch.cases;
+				c; c = c->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_switch_case *c = expr->_switch.cases;
+				c; c = c->next) {
+			size_t nopts = 0;
+			for (const struct ast_case_option *o = c->options;
+					o; o = o->next) {
+				nopts++;
+			}
+			write_uint(out, nopts);
+			for (const struct ast_case_option *o = c->options;
+					o; o = o->next) {
+				write_expr(out, o->value);
+			}
+			write_expr_list(out, &c->exprs);
+		}
+		break;
+	case EXPR_TUPLE:
+		for (const struct ast_expression_tuple *t = &expr->tuple;
+				t; t = t->next) {
+			n++;
+		}
+		write_uint(out, n);
+		for (const struct ast_expression_tuple *t = &expr->tuple;
+				t; t = t->next) {
+			write_expr(out, t->expr);
+		}
+		break;
+	case EXPR_UNARITHM:
+		write_uint(out, expr->unarithm.op);
+		write_expr(out, expr->unarithm.operand);
+		break;
+	case EXPR_VAARG:
+	case EXPR_VAEND:
+		write_expr(out, expr->vaarg.ap);
+		break;
+	case EXPR_VASTART:
+		break;
+	}
+}
+
+static void
+write_function_type(FILE *out, const struct ast_function_type *func)
+{
+	const struct ast_type type = {
+		.storage = STORAGE_FUNCTION,
+		.func = *func,
+	};
+	write_type(out, &type);
+}
+
+static void
+write_subunit(FILE *out, const struct ast_subunit *subunit)
+{
+	size_t n = 0;
+	for (const struct ast_imports *i = subunit->imports; i; i = i->next) {
+		n++;
+	}
+	write_uint(out, n);
+	for (const struct ast_imports *i = subunit->imports; i; i = i->next) {
+		write_uint(out, i->mode);
+		write_ident(out, &i->ident);
+		size_t nmembers = 0;
+		switch (i->mode) {
+		case IMPORT_ALIAS:
+			write_str(out, i->alias);
+			break;
+		case IMPORT_MEMBERS:
+			for (const struct ast_import_members *m = i->members;
+					m; m = m->next) {
+				nmembers++;
+			}
+			write_uint(out, nmembers);
+			for (const struct ast_import_members *m = i->members;
+					m; m = m->next) {
+				write_loc(out, m->loc);
+				write_str(out, m->name);
+			}
+			break;
+		case IMPORT_NORMAL:
+		case IMPORT_WILDCARD:
+			break;
+		}
+	}
+
+	n = 0;
+	for (const struct ast_decls *d = subunit->decls; d; d = d->next) {
+		n++;
+	}
+	write_uint(out, n);
+	for (const struct ast_decls *d = subunit->decls; d; d = d->next) {
+		const struct ast_decl *decl = &d->decl;
+		write_loc(out, decl->loc);
+		write_uint(out, decl->decl_type);
+		write_uint(out, decl->exported);
+		size_t ndecls = 0;
+		switch (decl->decl_type) {
+		case ADECL_GLOBAL:
+		case ADECL_CONST:
+			for (const struct ast_global_decl *g = &decl->global;
+					g; g = g->next) {
+				ndecls++;
+			}
+			write_uint(out, ndecls);
+			for (const struct ast_global_decl *g = &decl->global;
+					g; g = g->next) {
+				write_str(out, g->symbol);
+				write_uint(out, g->threadlocal);
+				write_ident(out, &g->ident);
+				write_type(out, g->type);
+				write_expr(out, g->init);
+			}
+			break;
+		case ADECL_TYPE:
+			for (const struct ast_type_decl *t = &decl->type;
+					t; t = t->next) {
+				ndecls++;
+			}
+			write_uint(out, ndecls);
+			for (const struct ast_type_decl *t = &decl->type;
+					t; t = t->next) {
+				write_ident(out, &t->ident);
+				write_type(out, t->type);
+			}
+			break;
+		case ADECL_FUNC:
+			write_str(out, decl->function.symbol);
+			write_ident(out, &decl->function.ident);
+			write_function_type(out, &decl->function.prototype);
+			write_expr(out, decl->function.body);
+			write_uint(out, decl->function.flags);
+			break;
+		case ADECL_ASSERT:
+			write_assert(out, &decl->assert);
+			break;
+		}
+	}
+}
+
+struct reader {
+	const unsigned char *buf;
+	size_t len, pos;
+	int fileid;
+	bool bad;
+};
+
+static uint64_t
+read_uint(struct reader *r)
+{
+	uint64_t v = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		if (r->pos >= r->len) {
+			break;
+		}
+		unsigned char c = r->buf[r->pos++];
+		v |= (uint64_t)(c & 0x7f) << shift;
+		if (!(c & 0x80)) {
+			return v;
+		}
+	}
+	r->bad = true;
+	return 0;
+}
+
+static bool
+read_bool(struct reader *r)
+{
+	return read_uint(r) != 0;
+}
+
+// Reads an element count. Every element takes at least one byte, which bounds
+// the count by what is left of the input.
+static size_t
+read_count(struct reader *r)
+{
+	uint64_t n = read_uint(r);
+	if (n > r->len - r->pos) {
+		r->bad = true;
+		return 0;
+	}
+	return n;
+}
+
+static uint64_t
+read_enum(struct reader *r, uint64_t max)
+{
+	uint64_t v = read_uint(r);
+	if (v > max) {
+		r->bad = true;
+		return 0;
+	}
+	return v;
+}
+
+static char *
+read_raw(struct reader *r, size_t sz)
+{
+	if (sz > r->len - r->pos) {
+		r->bad = true;
+		return NULL;
+	}
+	char *s = xcalloc(sz + 1, 1);
+	memcpy(s, r->buf + r->pos, sz);
+	r->pos += sz;
+	return s;
+}
+
+static char *
+read_str(struct reader *r)
+{
+	uint64_t sz = read_uint(r);
+	if (sz == 0) {
+		return NULL;
+	}
+	return read_raw(r, sz - 1);
+}
+
+static struct location
+read_loc(struct reader *r)
+{
+	struct location loc = {0};
+	loc.file = read_bool(r) ? r->fileid : 0;
+	loc.lineno = (int)read_uint(r);
+	loc.colno = (int)read_uint(r);
+	return loc;
+}
+
+static void
+read_ident(struct reader *r, struct identifier *ident)
+{
+	ident->name = read_str(r);
+	if (read_bool(r) && !r->bad) {
+		ident->ns = xcalloc(1, sizeof(struct identifier));
+		read_ident(r, ident->ns);
+	}
+}
+
+static struct ast_expression *read_expr(struct reader *r);
+
+static struct ast_type *
+read_type(struct reader *r)
+{
+	uint64_t storage = read_enum(r, STORAGE_ERROR + 1);
+	if (storage == 0 || r->bad) {
+		return NULL;
+	}
+	struct ast_type *type = xcalloc(1, sizeof(struct ast_type));
+	type->storage = storage - 1;
+	type->loc = read_loc(r);
+	type->flags = read_uint(r);
+
+	size_t n;
+	switch (type->storage) {
+	case STORAGE_ALIAS:
+		read_ident(r, &type->alias);
+		type->unwrap = read_bool(r);
+		break;
+	case STORAGE_ARRAY:
+	case STORAGE_SLICE:
+		type->array.length = read_expr(r);
+		type->array.members = read_type(r);
+		type->array.contextual = read_bool(r);
+		break;
+	case STORAGE_ENUM:
+		read_ident(r, &type->alias);
+		type->_enum.storage = read_enum(r, STORAGE_ERROR);
+		n = read_count(r);
+		struct ast_enum_field **next_field = &type->_enum.values;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			struct ast_enum_field *f = *next_field =
+				xcalloc(1, sizeof(struct ast_enum_field));
+			f->loc = read_loc(r);
+			f->name = read_str(r);
+			f->value = read_expr(r);
+			next_field = &f->next;
+		}
+		break;
+	case STORAGE_FUNCTION:
+		type->func.result = read_type(r);
+		n = read_count(r);
+		struct ast_function_parameters **next_param = &type->func.params;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			struct ast_function_parameters *p = *next_param =
+				xcalloc(1, sizeof(struct ast_function_parameters));
+			p->loc = read_loc(r);
+			p->name = read_str(r);
+			p->type = read_type(r);
+			p->default_value = read_expr(r);
+			next_param = &p->next;
+		}
+		type->func.variadism = read_enum(r, VARIADISM_HARE);
+		break;
+	case STORAGE_POINTER:
+		type->pointer.referent = read_type(r);
+		type->pointer.flags = read_uint(r);
+		break;
+	case STORAGE_STRUCT:
+	case STORAGE_UNION:
+		n = read_count(r);
+		struct ast_struct_union_field *f = &type->struct_union.fields;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			if (i > 0) {
+				f = f->next = xcalloc(1,
+					sizeof(struct ast_struct_union_field));
+			}
+			f->offset = read_expr(r);
+			f->name = read_str(r);
+			f->type = read_type(r);
+		}
+		type->struct_union.packed = read_bool(r);
+		break;
+	case STORAGE_TAGGED:
+		n = read_count(r);
+		struct ast_tagged_union_type *tu = &type->tagged;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			if (i > 0) {
+				tu = tu->next = xcalloc(1,
+					sizeof(struct ast_tagged_union_type));
+			}
+			tu->type = read_type(r);
+		}
+		break;
+	case STORAGE_TUPLE:
+		n = read_count(r);
+		struct ast_tuple_type *tt = &type->tuple;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			if (i > 0) {
+				tt = tt->next = xcalloc(1,
+					sizeof(struct ast_tuple_type));
+			}
+			tt->type = read_type(r);
+		}
+		break;
+	default:
+		break;
+	}
+	return type;
+}
+
+static void
+read_expr_list(struct reader *r, struct ast_expression_list *list)
+{
+	size_t n = read_count(r);
+	for (size_t i = 0; i < n && !r->bad; i++) {
+		if (i > 0) {
+			list = list->next = xcalloc(1,
+				sizeof(struct ast_expression_list));
+		}
+		list->expr = read_expr(r);
+	}
+}
+
+static void
+read_binding(struct reader *r, struct ast_expression_binding *binding)
+{
+	size_t n = read_count(r);
+	for (size_t i = 0; i < n && !r->bad; i++) {
+		if (i > 0) {
+			binding = binding->next = xcalloc(1,
+				sizeof(struct ast_expression_binding));
+		}
+		binding->name = read_str(r);
+		size_t nunpack = read_count(r);
+		struct ast_binding_unpack **next = &binding->unpack;
+		for (size_t j = 0; j < nunpack && !r->bad; j++) {
+			struct ast_binding_unpack *u = *next =
+				xcalloc(1, sizeof(struct ast_binding_unpack));
+			u->name = read_str(r);
+			next = &u->next;
+		}
+		binding->type = read_type(r);
+		binding->flags = read_uint(r);
+		binding->is_static = read_bool(r);
+		binding->initializer = read_expr(r);
+	}
+}
+
+static void
+read_assert(struct reader *r, struct ast_expression_assert *assert)
+{
+	assert->cond = read_expr(r);
+	assert->message = read_expr(r);
+	assert->is_static = read_bool(r);
+}
+
+static void
+read_literal(struct reader *r, struct ast_expression_literal *lit)
+{
+	lit->storage = read_enum(r, STORAGE_ERROR);
+	size_t n;
+	switch (lit->storage) {
+	case STORAGE_U8:
+	case STORAGE_U16:
+	case STORAGE_U32:
+	case STORAGE_U64:
+	case STORAGE_UINT:
+	case STORAGE_UINTPTR:
+	case STORAGE_SIZE:
+		lit->uval = read_uint(r);
+		break;
+	case STORAGE_I8:
+	case STORAGE_I16:
+	case STORAGE_I32:
+	case STORAGE_I64:
+	case STORAGE_ICONST:
+	case STORAGE_INT:
+		lit->ival = (int64_t)read_uint(r);
+		break;
+	case STORAGE_F32:
+	case STORAGE_F64:
+	case STORAGE_FCONST:;
+		uint64_t bits = read_uint(r);
+		memcpy(&lit->fval, &bits, sizeof(bits));
+		break;
+	case STORAGE_RCONST:
+		lit->rune = (uint32_t)read_uint(r);
+		break;
+	case STORAGE_BOOL:
+		lit->bval = read_bool(r);
+		break;
+	case STORAGE_STRING:
+		lit->string.len = read_uint(r);
+		lit->string.value = read_raw(r, lit->string.len);
+		break;
+	case STORAGE_ARRAY:
+		n = read_count(r);
+		struct ast_array_literal **next = &lit->array;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			struct ast_array_literal *a = *next =
+				xcalloc(1, sizeof(struct ast_array_literal));
+			a->value = read_expr(r);
+			a->expand = read_bool(r);
+			next = &a->next;
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static struct ast_expression *
+read_expr(struct reader *r)
+{
+	uint64_t type = read_enum(r, EXPR_YIELD + 1);
+	if (type == 0 || r->bad) {
+		return NULL;
+	}
+	struct ast_expression *expr = xcalloc(1, sizeof(struct ast_expression));
+	expr->type = type - 1;
+	expr->loc = read_loc(r);
+
+	size_t n;
+	switch (expr->type) {
+	case EXPR_ACCESS:
+		expr->access.type = read_enum(r, ACCESS_TUPLE);
+		switch (expr->access.type) {
+		case ACCESS_IDENTIFIER:
+			read_ident(r, &expr->access.ident);
+			break;
+		case ACCESS_INDEX:
+			expr->access.array = read_expr(r);
+			expr->access.index = read_expr(r);
+			break;
+		case ACCESS_FIELD:
+			expr->access._struct = read_expr(r);
+			expr->access.field = read_str(r);
+			break;
+		case ACCESS_TUPLE:
+			expr->access.tuple = read_expr(r);
+			expr->access.value = read_expr(r);
+			break;
+		}
+		break;
+	case EXPR_ALLOC:
+		expr->alloc.kind = read_enum(r, ALLOC_COPY);
+		expr->alloc.init = read_expr(r);
+		expr->alloc.cap = read_expr(r);
+		break;
+	case EXPR_APPEND:
+	case EXPR_INSERT:
+		expr->append.object = read_expr(r);
+		expr->append.value = read_expr(r);
+		expr->append.length = read_expr(r);
+		expr->append.is_static = read_bool(r);
+		expr->append.is_multi = read_bool(r);
+		break;
+	case EXPR_ASSERT:
+		read_assert(r, &expr->assert);
+		break;
+	case EXPR_ASSIGN:
+		expr->assign.op = read_uint(r);
+		expr->assign.object = read_expr(r);
+		expr->assign.value = read_expr(r);
+		break;
+	case EXPR_BINARITHM:
+		expr->binarithm.op = read_uint(r);
+		expr->binarithm.lvalue = read_expr(r);
+		expr->binarithm.rvalue = read_expr(r);
+		break;
+	case EXPR_BINDING:
+	case EXPR_DEFINE:
+		read_binding(r, &expr->binding);
+		break;
+	case EXPR_BREAK:
+	case EXPR_CONTINUE:
+	case EXPR_YIELD:
+		expr->control.label = read_str(r);
+		expr->control.value = read_expr(r);
+		break;
+	case EXPR_CALL:
+		expr->call.lvalue = read_expr(r);
+		n = read_count(r);
+		struct ast_call_argument **next_arg = &expr->call.args;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			struct ast_call_argument *a = *next_arg =
+				xcalloc(1, sizeof(struct ast_call_argument));
+			a->variadic = read_bool(r);
+			a->value = read_expr(r);
+			next_arg = &a->next;
+		}
+		break;
+	case EXPR_CAST:
+		expr->cast.kind = read_enum(r, C_TEST);
+		expr->cast.value = read_expr(r);
+		expr->cast.type = read_type(r);
+		break;
+	case EXPR_COMPOUND:
+		expr->compound.label = read_str(r);
+		expr->compound.label_loc = read_loc(r);
+		read_expr_list(r, &expr->compound.list);
+		break;
+	case EXPR_DEFER:
+		expr->defer.deferred = read_expr(r);
+		break;
+	case EXPR_DELETE:
+		expr->delete.expr = read_expr(r);
+		expr->delete.is_static = read_bool(r);
+		break;
+	case EXPR_FOR:
+		expr->_for.kind = read_enum(r, FOR_EACH_ITERATOR);
+		expr->_for.label = read_str(r);
+		expr->_for.bindings = read_expr(r);
+		expr->_for.cond = read_expr(r);
+		expr->_for.afterthought = read_expr(r);
+		expr->_for.body = read_expr(r);
+		break;
+	case EXPR_FREE:
+		expr->free.expr = read_expr(r);
+		break;
+	case EXPR_IF:
+		expr->_if.cond = read_expr(r);
+		expr->_if.true_branch = read_expr(r);
+		expr->_if.false_branch = read_expr(r);
+		break;
+	case EXPR_MEASURE:
+		expr->measure.op = read_enum(r, M_OFFSET);
+		switch (expr->measure.op) {
+		case M_ALIGN:
+		case M_SIZE:
+			expr->measure.type = read_type(r);
+			break;
+		case M_LEN:
+		case M_OFFSET:
+			expr->measure.value = read_expr(r);
+			break;
+		}
+		break;
+	case EXPR_LITERAL:
+		read_literal(r, &expr->literal);
+		break;
+	case EXPR_MATCH:
+		expr->match.label = read_str(r);
+		expr->match.value = read_expr(r);
+		n = read_count(r);
+		struct ast_match_case **next_mcase = &expr->match.cases;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			struct ast_match_case *c = *next_mcase =
+				xcalloc(1, sizeof(struct ast_match_case));
+			c->name = read_str(r);
+			c->type = read_type(r);
+			read_expr_list(r, &c->exprs);
+			next_mcase = &c->next;
+		}
+		break;
+	case EXPR_PROPAGATE:
+		expr->propagate.value = read_expr(r);
+		expr->propagate.abort = read_bool(r);
+		break;
+	case EXPR_RETURN:
+		expr->_return.value = read_expr(r);
+		break;
+	case EXPR_SLICE:
+		expr->slice.object = read_expr(r);
+		expr->slice.start = read_expr(r);
+		expr->slice.end = read_expr(r);
+		break;
+	case EXPR_STRUCT:
+		expr->_struct.autofill = read_bool(r);
+		read_ident(r, &expr->_struct.type);
+		n = read_count(r);
+		struct ast_field_value **next_field = &expr->_struct.fields;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			struct ast_field_value *f = *next_field =
+				xcalloc(1, sizeof(struct ast_field_value));
+			f->name = read_str(r);
+			f->type = read_type(r);
+			f->initializer = read_expr(r);
+			next_field = &f->next;
+		}
+		break;
+	case EXPR_SWITCH:
+		expr->_switch.label = read_str(r);
+		expr->_switch.value = read_expr(r);
+		n = read_count(r);
+		struct ast_switch_case **next_scase = &expr->_switch.cases;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			struct ast_switch_case *c = *next_scase =
+				xcalloc(1, sizeof(struct ast_switch_case));
+			size_t nopts = read_count(r);
+			struct ast_case_option **next_opt = &c->options;
+			for (size_t j = 0; j < nopts && !r->bad; j++) {
+				struct ast_case_option *o = *next_opt =
+					xcalloc(1, sizeof(struct ast_case_option));
+				o->value = read_expr(r);
+				next_opt = &o->next;
+			}
+			read_expr_list(r, &c->exprs);
+			next_scase = &c->next;
+		}
+		break;
+	case EXPR_TUPLE:
+		n = read_count(r);
+		struct ast_expression_tuple *t = &expr->tuple;
+		for (size_t i = 0; i < n && !r->bad; i++) {
+			if (i > 0) {
+				t = t->next = xcalloc(1,
+					sizeof(struct ast_expression_tuple));
+			}
+			t->expr = read_expr(r);
+		}
+		break;
+	case EXPR_UNARITHM:
+		expr->unarithm.op = read_uint(r);
+		expr->unarithm.operand = read_expr(r);
+		break;
+	case EXPR_VAARG:
+	case EXPR_VAEND:
+		expr->vaarg.ap = read_expr(r);
+		break;
+	case EXPR_VASTART:
+		break;
+	}
+	return expr;
+}
+
+static void
+read_subunit(struct reader *r, struct ast_subunit *subunit)
+{
+	size_t n = read_count(r);
+	struct ast_imports **next_import = &subunit->imports;
+	for (size_t i = 0; i < n && !r->bad; i++) {
+		struct ast_imports *imp = *next_import =
+			xcalloc(1, sizeof(struct ast_imports));
+		imp->mode = read_enum(r, IMPORT_WILDCARD);
+		read_ident(r, &imp->ident);
+		size_t nmembers;
+		switch (imp->mode) {
+		case IMPORT_ALIAS:
+			imp->alias = read_str(r);
+			break;
+		case IMPORT_MEMBERS:
+			nmembers = read_count(r);
+			struct ast_import_members **next = &imp->members;
+			for (size_t j = 0; j < nmembers && !r->bad; j++) {
+				struct ast_import_members *m = *next =
+					xcalloc(1, sizeof(struct ast_import_members));
+				m->loc = read_loc(r);
+				m->name = read_str(r);
+				next = &m->next;
+			}
+			break;
+		case IMPORT_NORMAL:
+		case IMPORT_WILDCARD:
+			break;
+		}
+		next_import = &imp->next;
+	}
+
+	n = read_count(r);
+	struct ast_decls **next_decl = &subunit->decls;
+	for (size_t i = 0; i < n && !r->bad; i++) {
+		struct ast_decls *d = *next_decl =
+			xcalloc(1, sizeof(struct ast_decls));
+		struct ast_decl *decl = &d->decl;
+		decl->loc = read_loc(r);
+		decl->decl_type = read_enum(r, ADECL_ASSERT);
+		decl->exported = read_bool(r);
+		size_t ndecls;
+		switch (decl->decl_type) {
+		case ADECL_GLOBAL:
+		case ADECL_CONST:
+			ndecls = read_count(r);
+			struct ast_global_decl *g = &decl->global;
+			for (size_t j = 0; j < ndecls && !r->bad; j++) {
+				if (j > 0) {
+					g = g->next = xcalloc(1,
+						sizeof(struct ast_global_decl));
+				}
+				g->symbol = read_str(r);
+				g->threadlocal = read_bool(r);
+				read_ident(r, &g->ident);
+				g->type = read_type(r);
+				g->init = read_expr(r);
+			}
+			break;
+		case ADECL_TYPE:
+			ndecls = read_count(r);
+			struct ast_type_decl *t = &decl->type;
+			for (size_t j = 0; j < ndecls && !r->bad; j++) {
+				if (j > 0) {
+					t = t->next = xcalloc(1,
+						sizeof(struct ast_type_decl));
+				}
+				read_ident(r, &t->ident);
+				t->type = read_type(r);
+			}
+			break;
+		case ADECL_FUNC:
+			decl->function.symbol = read_str(r);
+			read_ident(r, &decl->function.ident);
+			struct ast_type *fntype = read_type(r);
+			if (fntype && fntype->storage == STORAGE_FUNCTION) {
+				decl->function.prototype = fntype->func;
+			} else {
+				r->bad = true;
+			}
+			free(fntype);
+			decl->function.body = read_expr(r);
+			decl->function.flags = read_uint(r);
+			break;
+		case ADECL_ASSERT:
+			read_assert(r, &decl->assert);
+			break;
+		}
+		next_decl = &d->next;
+	}
+}
+
+static char *
+cache_path(const char *dir, const unsigned char key[SHA256_SIZE])
+{
+	size_t sz = strlen(dir) + 2 * SHA256_SIZE + sizeof("/.ast");
+	char *path = xcalloc(sz, 1);
+	int n = snprintf(path, sz, "%s/", dir);
+	for (size_t i = 0; i < SHA256_SIZE; i++) {
+		n += snprintf(path + n, sz - n, "%02x", key[i]);
+	}
+	snprintf(path + n, sz - n, ".ast");
+	return path;
+}
+
+static bool
+read_all(FILE *f, char **buf, size_t *len)
+{
+	size_t sz = 4096, n = 0;
+	char *data = xcalloc(sz, 1);
+	size_t r;
+	while ((r = fread(data + n, 1, sz - n, f)) > 0) {
+		n += r;
+		if (n == sz) {
+			sz *= 2;
+			data = xrealloc(data, sz);
+		}
+	}
+	if (ferror(f)) {
+		free(data);
+		return false;
+	}
+	*buf = data;
+	*len = n;
+	return true;
+}
+
+static bool
+cache_load(const char *path, const unsigned char key[SHA256_SIZE],
+	size_t srclen, int fileid, struct ast_subunit *subunit)
+{
+	FILE *f = fopen(path, "r");
+	if (!f) {
+		return false;
+	}
+	char *buf;
+	size_t len;
+	bool ok = read_all(f, &buf, &len);
+	fclose(f);
+	if (!ok) {
+		return false;
+	}
+
+	struct reader r = {
+		.buf = (unsigned char *)buf,
+		.len = len,
+		.fileid = fileid,
+	};
+	size_t magiclen = strlen(AST_CACHE_MAGIC);
+	if (len < magiclen || memcmp(buf, AST_CACHE_MAGIC, magiclen) != 0) {
+		free(buf);
+		return false;
+	}
+	r.pos = magiclen;
+	char *version = NULL;
+	if (read_uint(&r) != AST_CACHE_FORMAT
+			|| !(version = read_str(&r))
+			|| strcmp(version, VERSION) != 0
+			|| read_uint(&r) != srclen
+			|| len - r.pos < SHA256_SIZE
+			|| memcmp(buf + r.pos, key, SHA256_SIZE) != 0) {
+		free(version);
+		free(buf);
+		return false;
+	}
+	free(version);
+	r.pos += SHA256_SIZE;
+	uint64_t payload = read_uint(&r);
+	uint64_t hash = read_uint(&r);
+	if (r.bad || payload != len - r.pos
+			|| fnv1a64(FNV1A64_INIT, buf + r.pos, payload) != hash) {
+		free(buf);
+		return false;
+	}
+
+	struct ast_subunit loaded = {0};
+	read_subunit(&r, &loaded);
+	free(buf);
+	if (r.bad || r.pos != r.len) {
+		return false;
+	}
+	subunit->imports = loaded.imports;
+	subunit->decls = loaded.decls;
+	return true;
+}
+
+// Failing to store an entry only costs a future cache miss, so errors are
+// ignored here.
+static void
+cache_store(const char *dir, const char *path,
+	const unsigned char key[SHA256_SIZE], size_t srclen,
+	const struct ast_subunit *subunit)
+{
+	char *payload = NULL;
+	size_t payloadsz = 0;
+	FILE *out = open_memstream(&payload, &payloadsz);
+	if (!out) {
+		return;
+	}
+	write_subunit(out, subunit);
+	if (fclose(out) != 0) {
+		free(payload);
+		return;
+	}
+
+	if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+		free(payload);
+		return;
+	}
+	size_t sz = strlen(path) + 32;
+	char *tmp = xcalloc(sz, 1);
+	snprintf(tmp, sz, "%s.%ld.tmp", path, (long)getpid());
+	out = fopen(tmp, "w");
+	if (!out) {
+		free(tmp);
+		free(payload);
+		return;
+	}
+	fputs(AST_CACHE_MAGIC, out);
+	write_uint(out, AST_CACHE_FORMAT);
+	write_str(out, VERSION);
+	write_uint(out, srclen);
+	fwrite(key, 1, SHA256_SIZE, out);
+	write_uint(out, payloadsz);
+	write_uint(out, fnv1a64(FNV1A64_INIT, payload, payloadsz));
+	fwrite(payload, 1, payloadsz, out);
+	bool ok = !ferror(out);
+	if (fclose(out) != 0 || !ok || rename(tmp, path) != 0) {
+		remove(tmp);
+	}
+	free(tmp);
+	free(payload);
+}
+
+void
+astcache_parse(const char *dir, FILE *in, int fileid,
+	struct ast_subunit *subunit)
+{
+	char *src;
+	size_t srclen;
+	if (!read_all(in, &src, &srclen) || fseek(in, 0, SEEK_SET) != 0) {
+		xfprintf(stderr, "Unable to read %s: %s\n",
+			sources[fileid], strerror(errno));
+		exit(EXIT_ABNORMAL);
+	}
+
+	static const uint32_t format = AST_CACHE_FORMAT;
+	struct sha256 sha;
+	sha256_init(&sha);
+	sha256_write(&sha, &format, sizeof(format));
+	sha256_write(&sha, VERSION, sizeof(VERSION));
+	sha256_write(&sha, src, srclen);
+	unsigned char key[SHA256_SIZE];
+	sha256_finish(&sha, key);
+	free(src);
+
+	char *path = cache_path(dir, key);
+	if (cache_load(path, key, srclen, fileid, subunit)) {
+		fclose(in);
+		free(path);
+		return;
+	}
+
+	struct lexer lexer;
+	lex_init(&lexer, in, fileid);
+	parse(&lexer, subunit);
+	lex_finish(&lexer);
+	cache_store(dir, path, key, srclen, subunit);
+	free(path);
+}
@@ -13,6 +13,7 @@
 #include "identifier.h"
 #include "mod.h"
 #include "scope.h"
+#include "stats.h"
 #include "type_store.h"
 #include "typedef.h"
 #include "types.h"
@@ -139,6 +140,9 @@ error_norec(struct context *ctx, struct location loc, const char *fmt, ...)
 	abort();
 }
 
+static void alloc_sliced(struct context *ctx, const struct type *to,
+	const struct expression *expr);
+
 struct expression *
 lower_implicit_cast(struct context *ctx,
 		const struct type *to, struct expression *expr)
@@ -146,6 +150,7 @@ lower_implicit_cast(struct context *ctx,
 	if (to == expr->result || expr->result->storage == STORAGE_NEVER) {
 		return expr;
 	}
+	alloc_sliced(ctx, to, expr);
 
 	if (type_dealias(ctx, to)->storage == STORAGE_TAGGED) {
 		const struct type *interim =
@@ -167,6 +172,272 @@ lower_implicit_cast(struct context *ctx,
 static void resolve_decl(struct context *ctx,
 	struct incomplete_declaration *idecl);
 
+// Returns the binding an index expression reads, if it's a local binding of an
+// unsigned type, possibly widened to size
+static const struct scope_object *
+bound_index(struct context *ctx, const struct expression *expr)
+{
+	if (expr->type == EXPR_CAST && expr->cast.kind == C_CAST
+			&& expr->cast.lowered) {
+		expr = expr->cast.value;
+	}
+	if (expr->type != EXPR_ACCESS || expr->access.type != ACCESS_IDENTIFIER
+			|| expr->access.object->otype != O_BIND) {
+		return NULL;
+	}
+	const struct type *type = expr->access.object->type;
+	if (!type_is_integer(ctx, type) || type_is_signed(ctx, type)) {
+		return NULL;
+	}
+	return expr->access.object;
+}
+
+// Records the bounds which a loop condition establishes for the loop body:
+// those of the form "i < len(x)" or "i < n" for a constant n, on either side
+// of a logical and
+static void
+bounds_push(struct context *ctx, const struct expression *cond)
+{
+	if (cond->type != EXPR_BINARITHM) {
+		return;
+	}
+	const struct expression *lvalue = cond->binarithm.lvalue;
+	const struct expression *rvalue = cond->binarithm.rvalue;
+	switch (cond->binarithm.op) {
+	case BIN_LAND:
+		bounds_push(ctx, lvalue);
+		bounds_push(ctx, rvalue);
+		return;
+	case BIN_LESS:
+		break;
+	case BIN_GREATER:
+		lvalue = cond->binarithm.rvalue;
+		rvalue = cond->binarithm.lvalue;
+		break;
+	default:
+		return;
+	}
+
+	const struct scope_object *index = bound_index(ctx, lvalue);
+	if (!index) {
+		return;
+	}
+	struct bound_fact fact = { .index = index };
+	if (rvalue->type == EXPR_LEN) {
+		const struct expression *value = rvalue->len.value;
+		if (value->type != EXPR_ACCESS
+				|| value->access.type != ACCESS_IDENTIFIER
+				|| value->access.object->otype != O_BIND
+				|| type_dealias(ctx, value->result)->storage
+					!= STORAGE_SLICE) {
+			return;
+		}
+		fact.object = value->access.object;
+	} else if (rvalue->type == EXPR_LITERAL
+			&& type_is_integer(ctx, rvalue->result)
+			&& !type_is_signed(ctx, rvalue->result)) {
+		fact.length = rvalue->literal.uval;
+	} else {
+		return;
+	}
+
+	struct bound_fact *new = xcalloc(1, sizeof(struct bound_fact));
+	*new = fact;
+	new->next = ctx->bounds;
+	ctx->bounds = new;
+}
+
+// Moves the bounds pushed since "until" to the facts to be resolved at the
+// end of the function
+static void
+bounds_pop(struct context *ctx, struct bound_fact *until)
+{
+	while (ctx->bounds != until) {
+		struct bound_fact *fact = ctx->bounds;
+		ctx->bounds = fact->next;
+		fact->next = ctx->proven;
+		ctx->proven = fact;
+	}
+}
+
+// Invalidates the bounds involving an object which is written to
+static void
+bounds_clobber(struct context *ctx, const struct expression *object)
+{
+	if (object->type != EXPR_ACCESS
+			|| object->access.type != ACCESS_IDENTIFIER) {
+		return;
+	}
+	for (struct bound_fact *fact = ctx->bounds; fact; fact = fact->next) {
+		if (fact->index == object->access.object
+				|| fact->object == object->access.object) {
+			fact->clobbered = true;
+		}
+	}
+}
+
+// Notes an indexing expression which one of the active bounds may prove to be
+// in range
+static void
+bounds_access(struct context *ctx, struct expression *expr,
+	const struct type *atype)
+{
+	const struct scope_object *index = bound_index(ctx, expr->access.index);
+	if (!index) {
+		return;
+	}
+	const struct expression *array = expr->access.array;
+	for (struct bound_fact *fact = ctx->bounds; fact; fact = fact->next) {
+		if (fact->index != index) {
+			continue;
+		}
+		if (fact->object) {
+			if (array->type != EXPR_ACCESS
+					|| array->access.type != ACCESS_IDENTIFIER
+					|| array->access.object != fact->object) {
+				continue;
+			}
+		} else if (atype->storage != STORAGE_ARRAY
+				|| atype->array.length == SIZE_UNDEFINED
+				|| atype->array.length < fact->length) {
+			continue;
+		}
+		fact->accesses = xrealloc(fact->accesses,
+			(fact->naccesses + 1) * sizeof(struct expression *));
+		fact->accesses[fact->naccesses++] = expr;
+		return;
+	}
+}
+
+// Elides the bounds checks proven unnecessary by the loops of the function
+// which was just checked
+static void
+bounds_resolve(struct context *ctx)
+{
+	while (ctx->proven) {
+		struct bound_fact *fact = ctx->proven;
+		ctx->proven = fact->next;
+		bool valid = !fact->clobbered
+			&& !(fact->index->flags & SO_ADDRESS_TAKEN)
+			&& !(fact->object
+				&& fact->object->flags & SO_ADDRESS_TAKEN);
+		for (size_t i = 0; valid && i < fact->naccesses; i++) {
+			fact->accesses[i]->access.bounds_checked = true;
+		}
+		free(fact->accesses);
+		free(fact);
+	}
+}
+
+// Returns the allocation which initialized the binding an expression reads,
+// if it is still a candidate for the stack
+static struct alloc_fact *
+alloc_lookup(struct context *ctx, const struct expression *expr)
+{
+	if (expr->type != EXPR_ACCESS
+			|| expr->access.type != ACCESS_IDENTIFIER
+			|| !(expr->access.object->flags & SO_ALLOCATED)) {
+		return NULL;
+	}
+	for (struct alloc_fact *fact = ctx->allocs; fact; fact = fact->next) {
+		if (fact->object == expr->access.object) {
+			return fact;
+		}
+	}
+	return NULL;
+}
+
+static void
+alloc_track(struct context *ctx, struct scope_object *object,
+	struct expression *alloc)
+{
+	if (alloc->type != EXPR_ALLOC || alloc->alloc.kind != ALLOC_OBJECT
+			|| alloc->alloc.init->result->size > STACK_ALLOC_MAX) {
+		return;
+	}
+	struct alloc_fact *fact = xcalloc(1, sizeof(struct alloc_fact));
+	fact->object = object;
+	fact->alloc = alloc;
+	fact->next = ctx->allocs;
+	ctx->allocs = fact;
+	object->flags |= SO_ALLOCATED;
+}
+
+// Records a use of an expression which dereferences it, if it reads a
+// binding initialized by an allocation
+static void
+alloc_deref(struct context *ctx, const struct expression *expr)
+{
+	struct alloc_fact *fact = alloc_lookup(ctx, expr);
+	if (fact) {
+		fact->derefs++;
+	}
+}
+
+// Records that the address of an object, or of a part of it, is taken. If the
+// object was allocated for a binding, the allocation escapes.
+static void
+alloc_escape(struct context *ctx, const struct expression *expr)
+{
+	while (expr->type == EXPR_ACCESS
+			|| (expr->type == EXPR_UNARITHM
+				&& expr->unarithm.op == UN_DEREF)) {
+		if (expr->type == EXPR_UNARITHM) {
+			expr = expr->unarithm.operand;
+			continue;
+		}
+		switch (expr->access.type) {
+		case ACCESS_IDENTIFIER:;
+			struct alloc_fact *fact = alloc_lookup(ctx, expr);
+			if (fact) {
+				fact->escaped = true;
+			}
+			return;
+		case ACCESS_INDEX:
+			expr = expr->access.array;
+			break;
+		case ACCESS_FIELD:
+			expr = expr->access._struct;
+			break;
+		case ACCESS_TUPLE:
+			expr = expr->access.tuple;
+			break;
+		}
+	}
+}
+
+// Records that an expression is converted to the given type. A slice of an
+// array refers to the array in place, so this is an escape if it's a slice.
+static void
+alloc_sliced(struct context *ctx, const struct type *to,
+	const struct expression *expr)
+{
+	if (type_dealias(ctx, to)->storage == STORAGE_SLICE
+			&& type_dealias(ctx, expr->result)->storage
+				== STORAGE_ARRAY) {
+		alloc_escape(ctx, expr);
+	}
+}
+
+// Moves the allocations of the function which was just checked whose pointers
+// don't escape it to the stack
+static void
+alloc_resolve(struct context *ctx)
+{
+	while (ctx->allocs) {
+		struct alloc_fact *fact = ctx->allocs;
+		ctx->allocs = fact->next;
+		if (!fact->escaped && fact->uses == fact->derefs) {
+			fact->alloc->alloc.on_stack = true;
+			for (size_t i = 0; i < fact->nfrees; i++) {
+				fact->frees[i]->free.on_stack = true;
+			}
+		}
+		free(fact->frees);
+		free(fact);
+	}
+}
+
 static void
 check_expr_access(struct context *ctx,
 	const struct ast_expression *aexpr,
@@ -199,6 +470,10 @@ check_expr_access(struct context *ctx,
 		case O_DECL:
 			expr->result = obj->type;
 			expr->access.object = obj;
+			struct alloc_fact *fact = alloc_lookup(ctx, expr);
+			if (fact) {
+				fact->uses++;
+			}
 			break;
 		case O_TYPE:
 			if (type_dealias(ctx, obj->type)->storage != STORAGE_VOID &&
@@ -222,6 +497,7 @@ check_expr_access(struct context *ctx,
 		expr->access.index = xcalloc(1, sizeof(struct expression));
 		check_expression(ctx, aexpr->access.array, expr->access.array, NULL);
 		check_expression(ctx, aexpr->access.index, expr->access.index, &builtin_type_size);
+		alloc_deref(ctx, expr->access.array);
 		const struct type *atype =
 			type_dereference(ctx, expr->access.array->result);
 		if (!atype) {
@@ -275,11 +551,14 @@ check_expr_access(struct context *ctx,
 			}
 			free(evaled);
 		}
-
+		if (!expr->access.bounds_checked) {
+			bounds_access(ctx, expr, atype);
+		}
 		break;
 	case ACCESS_FIELD:
 		expr->access._struct = xcalloc(1, sizeof(struct expression));
 		check_expression(ctx, aexpr->access._struct, expr->access._struct, NULL);
+		alloc_deref(ctx, expr->access._struct);
 		const struct type *stype =
 			type_dereference(ctx, expr->access._struct->result);
 		if (!stype) {
@@ -311,6 +590,7 @@ check_expr_access(struct context *ctx,
 		struct expression *value = xcalloc(1, sizeof(struct expression));
 		check_expression(ctx, aexpr->access.tuple, expr->access.tuple, NULL);
 		check_expression(ctx, aexpr->access.value, value, NULL);
+		alloc_deref(ctx, expr->access.tuple);
 		assert(value->type == EXPR_LITERAL);
 
 		const struct type *ttype =
@@ -566,6 +846,7 @@ check_expr_append_insert(struct context *ctx,
 {
 	assert(aexpr->type == EXPR_APPEND || aexpr->type == EXPR_INSERT);
 	expr->type = aexpr->type;
+	ctx->writes++;
 	expr->result = &builtin_type_void;
 	expr->append.is_static = aexpr->append.is_static;
 	expr->append.is_multi = aexpr->append.is_multi;
@@ -604,6 +885,7 @@ check_expr_append_insert(struct context *ctx,
 		abort(); // Invariant
 	}
 
+	bounds_clobber(ctx, object);
 	if (object->type == EXPR_ACCESS
 			&& object->access.type == ACCESS_IDENTIFIER
 			&& object->access.object->flags &
@@ -864,6 +1146,18 @@ check_expr_assign(struct context *ctx,
 	struct expression *value = xcalloc(1, sizeof(struct expression));
 	check_expression(ctx, aexpr->assign.object, object, NULL);
 	check_expression(ctx, aexpr->assign.value, value, object->result);
+	bounds_clobber(ctx, object);
+
+	// A local scalar is stored apart from any other object
+	const struct type *otype = type_dealias(ctx, object->result);
+	if (object->type != EXPR_ACCESS
+			|| object->access.type != ACCESS_IDENTIFIER
+			|| object->access.object->otype != O_BIND
+			|| !(type_is_numeric(ctx, otype)
+				|| otype->storage == STORAGE_POINTER
+				|| otype->storage == STORAGE_BOOL)) {
+		ctx->writes++;
+	}
 
 	if (object->type == EXPR_LITERAL
 			&& object->result != &builtin_type_error) {
@@ -1207,6 +1501,7 @@ create_unpack_bindings(struct context *ctx,
 			}
 			if (is_static) {
 				struct identifier gen = {0};
+				ctx->noinline = true;
 
 				// Generate a static declaration identifier
 				gen.name = gen_name(&ctx->id, "static.%d");
@@ -1259,6 +1554,7 @@ check_expr_binding(struct context *ctx,
 	const struct ast_expression_binding *abinding = &aexpr->binding;
 	while (abinding) {
 		const struct type *type = NULL;
+		struct scope_object *local = NULL;
 		if (abinding->type) {
 			type = type_store_lookup_atype(ctx, abinding->type);
 			type = type_store_lookup_with_flags(ctx,
@@ -1319,12 +1615,14 @@ check_expr_binding(struct context *ctx,
 			if (abinding->is_static) {
 				// Generate a static declaration identifier
 				struct identifier gen = {0};
+				ctx->noinline = true;
 				gen.name = gen_name(&ctx->id, "static.%d");
 				binding->object = scope_insert(ctx->scope,
 					O_DECL, &gen, &ident, type, NULL);
 			} else {
-				binding->object = scope_insert(ctx->scope,
+				local = scope_insert(ctx->scope,
 					O_BIND, &ident, &ident, type, NULL);
+				binding->object = local;
 			}
 		}
 
@@ -1345,6 +1643,9 @@ check_expr_binding(struct context *ctx,
 			return;
 		}
 		binding->initializer = lower_implicit_cast(ctx, type, initializer);
+		if (local) {
+			alloc_track(ctx, local, binding->initializer);
+		}
 
 		if (abinding->is_static) {
 			struct expression *value =
@@ -1421,6 +1722,8 @@ check_expr_call(struct context *ctx,
 	const struct type *hint)
 {
 	expr->type = EXPR_CALL;
+	ctx->writes++;
+	ctx->noinline = true;
 
 	struct expression *lvalue = xcalloc(1, sizeof(struct expression));
 	check_expression(ctx, aexpr->call.lvalue, lvalue, NULL);
@@ -1604,6 +1907,7 @@ check_expr_cast(struct context *ctx,
 		// The value is first cast to an intermediary type which is a
 		// direct member of the tagged union, before being cast to the
 		// tagged union itself.
+		alloc_sliced(ctx, secondary, value);
 		expr->cast.value = lower_implicit_cast(ctx, intermediary, value);
 		break;
 	}
@@ -1863,6 +2167,7 @@ check_expr_defer(struct context *ctx,
 {
 	expr->type = EXPR_DEFER;
 	expr->result = &builtin_type_void;
+	ctx->deferred = true;
 	expr->defer.deferred = xcalloc(1, sizeof(struct expression));
 	expr->defer.scope = scope_push(&ctx->scope, SCOPE_DEFER);
 	check_expression(ctx, aexpr->defer.deferred, expr->defer.deferred, NULL);
@@ -1880,6 +2185,7 @@ check_expr_delete(struct context *ctx,
 	const struct type *hint)
 {
 	expr->type = EXPR_DELETE;
+	ctx->writes++;
 	expr->delete.is_static = aexpr->delete.is_static;
 	expr->result = &builtin_type_void;
 	struct expression *dexpr = expr->delete.expr =
@@ -1889,6 +2195,7 @@ check_expr_delete(struct context *ctx,
 	switch (dexpr->type) {
 	case EXPR_SLICE:
 		otype = dexpr->slice.object->result;
+		bounds_clobber(ctx, dexpr->slice.object);
 		break;
 	case EXPR_ACCESS:
 		if (dexpr->access.type != ACCESS_INDEX) {
@@ -1905,6 +2212,7 @@ check_expr_delete(struct context *ctx,
 				"cannot delete to subject of for-each loop");
 		}
 		otype = dexpr->access.array->result;
+		bounds_clobber(ctx, dexpr->access.array);
 		break;
 	default:
 		error(ctx, aexpr->delete.expr->loc, expr,
@@ -2062,7 +2370,10 @@ check_expr_for_accumulator(struct context *ctx,
 
 	struct expression *body = xcalloc(1, sizeof(struct expression));
 	expr->_for.body = body;
+	struct bound_fact *bounds = ctx->bounds;
+	bounds_push(ctx, cond);
 	check_expression(ctx, aexpr->_for.body, body, NULL);
+	bounds_pop(ctx, bounds);
 	if (type_has_error(ctx, body->result)) {
 		error(ctx, aexpr->_for.body->loc, body,
 			"Cannot ignore error here");
@@ -2157,6 +2468,7 @@ check_expr_for_each(struct context *ctx,
 				"Cannot unpack tuple by pointer in for-each loop");
 			return;
 		}
+		alloc_escape(ctx, initializer);
 		// fallthrough
 	case FOR_EACH_VALUE:
 		initializer_type = type_dealias(ctx, type_dereference(ctx,
@@ -2245,6 +2557,7 @@ check_expr_for_each(struct context *ctx,
 
 	struct expression *body = xcalloc(1, sizeof(struct expression));
 	expr->_for.body = body;
+	size_t writes = ctx->writes;
 
 	if (expr->_for.kind != FOR_EACH_ITERATOR
 			&& initializer->type == EXPR_ACCESS
@@ -2260,6 +2573,19 @@ check_expr_for_each(struct context *ctx,
 		check_expression(ctx, aexpr->_for.body, body, NULL);
 	}
 
+	// Elements which nothing in the body could modify needn't be copied
+	// out, unless the binding's address is taken
+	if (expr->_for.kind == FOR_EACH_VALUE && ctx->writes == writes) {
+		bool escaped = binding->binding.unpack == NULL
+			&& binding->binding.object->flags & SO_ADDRESS_TAKEN;
+		for (const struct binding_unpack *unpack =
+				binding->binding.unpack; unpack;
+				unpack = unpack->next) {
+			escaped |= unpack->object->flags & SO_ADDRESS_TAKEN;
+		}
+		expr->_for.in_place = !escaped;
+	}
+
 	if (type_has_error(ctx, body->result)) {
 		error(ctx, aexpr->_for.body->loc, body,
 			"Cannot ignore error here");
@@ -2306,8 +2632,16 @@ check_expr_free(struct context *ctx,
 {
 	assert(aexpr->type == EXPR_FREE);
 	expr->type = EXPR_FREE;
+	ctx->writes++;
 	expr->free.expr = xcalloc(1, sizeof(struct expression));
 	check_expression(ctx, aexpr->free.expr, expr->free.expr, NULL);
+	struct alloc_fact *fact = alloc_lookup(ctx, expr->free.expr);
+	if (fact) {
+		fact->frees = xrealloc(fact->frees,
+			(fact->nfrees + 1) * sizeof(struct expression *));
+		fact->frees[fact->nfrees++] = expr;
+		fact->derefs++;
+	}
 
 	if (expr->free.expr->type == EXPR_ACCESS
 			&& expr->free.expr->access.type == ACCESS_IDENTIFIER
@@ -2827,6 +3161,10 @@ check_expr_return(struct context *ctx,
 			"Cannot return inside a defer expression");
 		return;
 	}
+	if (ctx->deferred) {
+		// The deferred expressions run after the value is computed
+		ctx->writes++;
+	}
 	if (ctx->fntype == NULL) {
 		error(ctx, aexpr->loc, expr, "Cannot return outside a function body");
 		return;
@@ -2907,6 +3245,7 @@ check_expr_slice(struct context *ctx,
 
 	expr->slice.object = xcalloc(1, sizeof(struct expression));
 	check_expression(ctx, aexpr->slice.object, expr->slice.object, NULL);
+	alloc_escape(ctx, expr->slice.object);
 	if (expr->slice.object->result->storage == STORAGE_ERROR) {
 		mkerror(aexpr->loc, expr);
 		return;
@@ -3637,6 +3976,19 @@ check_expr_unarithm(struct context *ctx,
 				operand->result = ptrhint;
 			}
 		}
+		// The binding may now be modified through the pointer
+		const struct expression *root = operand;
+		while (root->type == EXPR_ACCESS
+				&& (root->access.type == ACCESS_FIELD
+				|| root->access.type == ACCESS_TUPLE)) {
+			root = root->access.type == ACCESS_FIELD
+				? root->access._struct : root->access.tuple;
+		}
+		if (root->type == EXPR_ACCESS
+				&& root->access.type == ACCESS_IDENTIFIER) {
+			root->access.object->flags |= SO_ADDRESS_TAKEN;
+		}
+		alloc_escape(ctx, operand);
 		expr->result = type_store_lookup_pointer(
 			ctx, aexpr->loc, operand->result, 0);
 		break;
@@ -3659,6 +4011,7 @@ check_expr_unarithm(struct context *ctx,
 			return;
 		}
 		expr->result = type_dealias(ctx, operand->result)->pointer.referent;
+		alloc_deref(ctx, operand);
 		break;
 	}
 }
@@ -3685,6 +4038,7 @@ check_expr_vaarg(struct context *ctx,
 	const struct type *hint)
 {
 	expr->type = EXPR_VAARG;
+	ctx->noinline = true;
 	if (hint == NULL) {
 		error(ctx, aexpr->loc, expr,
 			"Cannot infer type of vaarg without hint");
@@ -3707,6 +4061,7 @@ check_expr_vaend(struct context *ctx,
 	const struct type *hint)
 {
 	expr->type = EXPR_VAEND;
+	ctx->noinline = true;
 	expr->vaarg.ap = xcalloc(1, sizeof(struct expression));
 	check_expression(ctx, aexpr->vaarg.ap, expr->vaarg.ap, &builtin_type_valist);
 	if (type_dealias(ctx, expr->vaarg.ap->result)->storage != STORAGE_VALIST) {
@@ -3724,6 +4079,7 @@ check_expression(struct context *ctx,
 	const struct type *hint)
 {
 	expr->loc = aexpr->loc;
+	ctx->exprs++;
 
 	switch (aexpr->type) {
 	case EXPR_ACCESS:
@@ -3859,7 +4215,9 @@ check_function(struct context *ctx,
 	decl->decl_type = DECL_FUNC;
 	decl->func.type = obj->type;
 	decl->func.flags = afndecl->flags;
+	decl->func.inlinable = false;
 	decl->exported = adecl->exported;
+	decl->has_symbol = afndecl->symbol != NULL;
 	decl->file = adecl->loc.file;
 
 	decl->symbol = ident_to_sym(&obj->ident);
@@ -3874,6 +4232,10 @@ check_function(struct context *ctx,
 		decl->func.body = NULL;
 		goto end; // Prototype
 	}
+	if (ctx->interface_only) {
+		decl->func.body = NULL;
+		goto end;
+	}
 	if (afndecl->symbol != NULL && decl->func.flags != 0) {
 		error(ctx, adecl->loc, NULL,
 			"@symbol cannot be used alongside other function attributes");
@@ -3930,9 +4292,18 @@ check_function(struct context *ctx,
 		}
 	}
 
+	ctx->deferred = false;
+	ctx->noinline = false;
+	size_t exprs = ctx->exprs;
 	struct expression *body = xcalloc(1, sizeof(struct expression));
 	check_expression(ctx, afndecl->body, body, obj->type->func.result);
+	decl->func.inlinable = !ctx->noinline && decl->func.flags == 0
+		&& obj->type->func.variadism == VARIADISM_NONE
+		&& obj->type->func.result->storage != STORAGE_NEVER
+		&& ctx->exprs - exprs <= INLINE_EXPRS_MAX;
 	resolve_unresolved(ctx);
+	bounds_resolve(ctx);
+	alloc_resolve(ctx);
 
 	if (!type_is_assignable(ctx, obj->type->func.result, body->result)) {
 		char *restypename = gen_typename(body->result);
@@ -4409,6 +4780,7 @@ end:
 		.symbol = ident_to_sym(&idecl->obj.ident),
 
 		.exported = idecl->decl.exported,
+		.has_symbol = decl->symbol != NULL,
 		.global = {
 			.type = type,
 			.value = value,
@@ -4987,6 +5359,7 @@ struct scope *
 check_internal(type_store *ts,
 	struct modcache **cache,
 	bool is_test,
+	bool interface_only,
 	const char *mainsym,
 	const struct ast_global_decl *defines,
 	const struct ast_unit *aunit,
@@ -4996,6 +5369,7 @@ check_internal(type_store *ts,
 	struct context ctx = {0};
 	ctx.ns = unit->ns;
 	ctx.is_test = is_test;
+	ctx.interface_only = interface_only;
 	ctx.mainsym = mainsym;
 	ctx.store = ts;
 	ctx.next = &ctx.errors;
@@ -5095,11 +5469,25 @@ check_internal(type_store *ts,
 		error(&ctx, defineloc, NULL, "Define shadows a non-define object");
 	}
 
-	// Perform actual declaration resolution
+	// Perform actual declaration resolution. All declarations are
+	// resolved before any function body is checked, so that the order of
+	// unit->declarations (and thus the typedef file) doesn't depend on
+	// what the bodies happen to reference.
+	if (!scan_only) {
+		stats_begin("check_declarations", NULL);
+	}
 	for (struct scope_object *obj = ctx.unit->objects;
 			obj; obj = obj->lnext) {
 		wrap_resolver(&ctx, obj, resolve_decl);
-		// populate the expression graph
+	}
+	if (!scan_only) {
+		stats_end();
+		stats_begin("check_functions", NULL);
+	}
+
+	// populate the expression graph
+	for (struct scope_object *obj = ctx.unit->objects;
+			obj; obj = obj->lnext) {
 		struct incomplete_declaration *idecl =
 			(struct incomplete_declaration *)obj;
 		if (idecl->type == IDECL_DECL && idecl->decl.decl_type == ADECL_FUNC) {
@@ -5107,6 +5495,9 @@ check_internal(type_store *ts,
 			check_function(&ctx, &idecl->obj, &idecl->decl);
 		}
 	}
+	if (!scan_only) {
+		stats_end();
+	}
 
 	assert(ctx.unresolved == NULL);
 	handle_errors(ctx.errors);
@@ -5124,11 +5515,13 @@ check_internal(type_store *ts,
 struct scope *
 check(type_store *ts,
 	bool is_test,
+	bool interface_only,
 	const char *mainsym,
 	const struct ast_global_decl *defines,
 	const struct ast_unit *aunit,
 	struct unit *unit)
 {
 	struct modcache *modcache[MODCACHE_BUCKETS] = {0};
-	return check_internal(ts, modcache, is_test, mainsym, defines, aunit, unit, false);
+	return check_internal(ts, modcache, is_test, interface_only, mainsym,
+		defines, aunit, unit, false);
 }
@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <ctype.h>
 #include <inttypes.h>
+#include <stdarg.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include "check.h"
@@ -9,6 +10,22 @@
 #include "types.h"
 #include "util.h"
 
+// Bytes written so far, which the file position of the output doesn't tell
+// when it's a pipe or a device
+static size_t emitted;
+
+#if __GNUC__ > 2 || (__GNUC__ == 2 && __GNUC_MINOR__ >= 3)
+__attribute__((__format__(__printf__, 2, 3)))
+#endif
+static void
+emitf(FILE *out, const char *fmt, ...)
+{
+	va_list ap;
+	va_start(ap, fmt);
+	emitted += xvfprintf(out, fmt, ap);
+	va_end(ap);
+}
+
 static void
 emit_qtype(const struct qbe_type *type, bool aggr, FILE *out)
 {
@@ -20,14 +37,14 @@ emit_qtype(const struct qbe_type *type, bool aggr, FILE *out)
 	case Q_LONG:
 	case Q_SINGLE:
 	case Q_DOUBLE:
-		xfprintf(out, "%c", (char)type->stype);
+		emitf(out, "%c", (char)type->stype);
 		break;
 	case Q__AGGREGATE:
 	case Q__UNION:
 		if (aggr) {
-			xfprintf(out, ":%s", type->name);
+			emitf(out, ":%s", type->name);
 		} else {
-			xfprintf(out, "l");
+			emitf(out, "l");
 		}
 		break;
 	case Q__VOID:
@@ -43,43 +60,43 @@ qemit_type(const struct qbe_def *def, FILE *out)
 	const struct type *base = qtype->base;
 	if (base) {
 		char *tn = gen_typename(base);
-		xfprintf(out, "# %s [id: %" PRIu32 "; size: ", tn, base->id);
+		emitf(out, "# %s [id: %" PRIu32 "; size: ", tn, base->id);
 		free(tn);
 		if (base->size != SIZE_UNDEFINED) {
-			xfprintf(out, "%zu]\n", base->size);
+			emitf(out, "%zu]\n", base->size);
 		} else {
-			xfprintf(out, "undefined]\n");
+			emitf(out, "undefined]\n");
 		}
-		xfprintf(out, "type :%s =", def->name);
+		emitf(out, "type :%s =", def->name);
 		if (base->align != ALIGN_UNDEFINED) {
-			xfprintf(out, " align %zu", base->align);
+			emitf(out, " align %zu", base->align);
 		}
 	} else {
-		xfprintf(out, "type :%s =", def->name);
+		emitf(out, "type :%s =", def->name);
 	}
-	xfprintf(out, " {");
+	emitf(out, " {");
 
 	const struct qbe_field *field = &qtype->fields;
 	while (field) {
 		if (qtype->stype == Q__UNION) {
-			xfprintf(out, " {");
+			emitf(out, " {");
 		}
 		if (field->type) {
-			xfprintf(out, " ");
+			emitf(out, " ");
 			emit_qtype(field->type, true, out);
 		}
 		if (field->count) {
-			xfprintf(out, " %zu", field->count);
+			emitf(out, " %zu", field->count);
 		}
 		if (qtype->stype == Q__UNION) {
-			xfprintf(out, " }");
+			emitf(out, " }");
 		} else if (field->next) {
-			xfprintf(out, ",");
+			emitf(out, ",");
 		}
 		field = field->next;
 	}
 
-	xfprintf(out, " }\n\n");
+	emitf(out, " }\n\n");
 }
 
 static void
@@ -90,11 +107,11 @@ emit_const(const struct qbe_value *val, FILE *out)
 	case Q_HALF:
 	case Q_WORD:
 	case Q_SINGLE:
-		xfprintf(out, "%" PRIu32, val->wval);
+		emitf(out, "%" PRIu32, val->wval);
 		break;
 	case Q_LONG:
 	case Q_DOUBLE:
-		xfprintf(out, "%" PRIu64, val->lval);
+		emitf(out, "%" PRIu64, val->lval);
 		break;
 	case Q__VOID:
 	case Q__AGGREGATE:
@@ -112,18 +129,18 @@ emit_value(const struct qbe_value *val, FILE *out)
 		break;
 	case QV_GLOBAL:
 		if (val->threadlocal) {
-			xfprintf(out, "thread ");
+			emitf(out, "thread ");
 		}
-		xfprintf(out, "$%s", val->name);
+		emitf(out, "$%s", val->name);
 		break;
 	case QV_LABEL:
-		xfprintf(out, "@%s", val->name);
+		emitf(out, "@%s", val->name);
 		break;
 	case QV_TEMPORARY:
-		xfprintf(out, "%%%s", val->name);
+		emitf(out, "%%%s", val->name);
 		break;
 	case QV_VARIADIC:
-		xfprintf(out, "...");
+		emitf(out, "...");
 		break;
 	}
 }
@@ -131,27 +148,27 @@ emit_value(const struct qbe_value *val, FILE *out)
 static void
 emit_call(const struct qbe_statement *stmt, FILE *out)
 {
-	xfprintf(out, "%s ", qbe_instr[stmt->instr]);
+	emitf(out, "%s ", qbe_instr[stmt->instr]);
 
 	const struct qbe_arguments *arg = stmt->args;
 	assert(arg);
 	emit_value(&arg->value, out);
-	xfprintf(out, "(");
+	emitf(out, "(");
 	arg = arg->next;
 
 	bool comma = false;
 	while (arg) {
-		xfprintf(out, "%s", comma ? ", " : "");
+		emitf(out, "%s", comma ? ", " : "");
 		if (arg->value.kind != QV_VARIADIC) {
 			emit_qtype(arg->value.type, true, out);
-			xfprintf(out, " ");
+			emitf(out, " ");
 		}
 		emit_value(&arg->value, out);
 		arg = arg->next;
 		comma = true;
 	}
 
-	xfprintf(out, ")\n");
+	emitf(out, ")\n");
 }
 
 static void
@@ -159,38 +176,38 @@ emit_stmt(const struct qbe_statement *stmt, FILE *out)
 {
 	switch (stmt->type) {
 	case Q_COMMENT:
-		xfprintf(out, "\t# %s\n", stmt->comment);
+		emitf(out, "\t# %s\n", stmt->comment);
 		break;
 	case Q_INSTR:
-		xfprintf(out, "\t");
+		emitf(out, "\t");
 		if (stmt->instr == Q_CALL) {
 			if (stmt->out != NULL) {
 				emit_value(stmt->out, out);
-				xfprintf(out, " =");
+				emitf(out, " =");
 				emit_qtype(stmt->out->type, true, out);
-				xfprintf(out, " ");
+				emitf(out, " ");
 			}
 			emit_call(stmt, out);
 			break;
 		}
 		if (stmt->out != NULL) {
 			emit_value(stmt->out, out);
-			xfprintf(out, " =");
+			emitf(out, " =");
 			emit_qtype(stmt->out->type, false, out);
-			xfprintf(out, " ");
+			emitf(out, " ");
 		}
-		xfprintf(out, "%s%s", qbe_instr[stmt->instr],
+		emitf(out, "%s%s", qbe_instr[stmt->instr],
 				stmt->args ? " " : "");
 		const struct qbe_arguments *arg = stmt->args;
 		while (arg) {
-			xfprintf(out, "%s", arg == stmt->args ? "" : ", ");
+			emitf(out, "%s", arg == stmt->args ? "" : ", ");
 			emit_value(&arg->value, out);
 			arg = arg->next;
 		}
-		xfprintf(out, "\n");
+		emitf(out, "\n");
 		break;
 	case Q_LABEL:
-		xfprintf(out, "@%s\n", stmt->label);
+		emitf(out, "@%s\n", stmt->label);
 		break;
 	}
 }
@@ -199,27 +216,27 @@ static void
 emit_func(const struct qbe_def *def, FILE *out)
 {
 	assert(def->kind == Q_FUNC);
-	xfprintf(out, "section \".text.%s\" \"ax\"%s\nfunction",
+	emitf(out, "section \".text.%s\" \"ax\"%s\nfunction",
 			def->name,
 			def->exported ? " export" : "");
 	if (def->func.returns->stype != Q__VOID) {
-		xfprintf(out, " ");
+		emitf(out, " ");
 		emit_qtype(def->func.returns, true, out);
 	}
-	xfprintf(out, " $%s(", def->name);
+	emitf(out, " $%s(", def->name);
 	const struct qbe_func_param *param = def->func.params;
 	while (param) {
 		emit_qtype(param->type, true, out);
-		xfprintf(out, " %%%s", param->name);
+		emitf(out, " %%%s", param->name);
 		if (param->next || def->func.variadic) {
-			xfprintf(out, ", ");
+			emitf(out, ", ");
 		}
 		param = param->next;
 	}
 	if (def->func.variadic) {
-		xfprintf(out, "...");
+		emitf(out, "...");
 	}
-	xfprintf(out, ") {\n");
+	emitf(out, ") {\n");
 
 	for (size_t i = 0; i < def->func.prelude.ln; ++i) {
 		const struct qbe_statement *stmt = &def->func.prelude.stmts[i];
@@ -231,7 +248,7 @@ emit_func(const struct qbe_def *def, FILE *out)
 		emit_stmt(stmt, out);
 	}
 
-	xfprintf(out, "}\n\n");
+	emitf(out, "}\n\n");
 }
 
 static void
@@ -244,19 +261,19 @@ emit_data_string(const char *str, size_t sz, FILE *out)
 				|| str[i] == '\\') {
 			if (q) {
 				q = false;
-				xfprintf(out, "\", ");
+				emitf(out, "\", ");
 			}
-			xfprintf(out, "b %d%s", str[i], i + 1 < sz ? ", " : "");
+			emitf(out, "b %d%s", str[i], i + 1 < sz ? ", " : "");
 		} else {
 			if (!q) {
 				q = true;
-				xfprintf(out, "b \"");
+				emitf(out, "b \"");
 			}
-			xfprintf(out, "%c", str[i]);
+			emitf(out, "%c", str[i]);
 		}
 	}
 	if (q) {
-		xfprintf(out, "\"");
+		emitf(out, "\"");
 	}
 }
 
@@ -302,64 +319,83 @@ is_zeroes(const struct qbe_data_item *data)
 	return true;
 }
 
+// Whether the data refers to other symbols, needing relocations at load time
+static bool
+has_relocations(const struct qbe_data_item *data)
+{
+	for (const struct qbe_data_item *cur = data; cur; cur = cur->next) {
+		if (cur->type == QD_SYMOFFS || (cur->type == QD_VALUE
+				&& (cur->value.kind == QV_GLOBAL
+				|| cur->value.kind == QV_LABEL))) {
+			return true;
+		}
+	}
+	return false;
+}
+
 static void
 emit_data(const struct qbe_def *def, FILE *out)
 {
 	assert(def->kind == Q_DATA);
 	if (def->data.section && def->data.secflags) {
-		xfprintf(out, "section \"%s\" \"%s\"",
+		emitf(out, "section \"%s\" \"%s\"",
 				def->data.section, def->data.secflags);
 	} else if (def->data.section) {
-		xfprintf(out, "section \"%s\"", def->data.section);
+		emitf(out, "section \"%s\"", def->data.section);
 	} else if (def->data.threadlocal) {
 		if (is_zeroes(&def->data.items)) {
-			xfprintf(out, "section \".tbss\" \"awT\"");
+			emitf(out, "section \".tbss\" \"awT\"");
 		} else {
-			xfprintf(out, "section \".tdata\" \"awT\"");
+			emitf(out, "section \".tdata\" \"awT\"");
 		}
+	} else if (def->data.readonly && has_relocations(&def->data.items)) {
+		// Written by the dynamic linker before being made read-only
+		emitf(out, "section \".data.rel.ro.%s\" \"aw\"", def->name);
+	} else if (def->data.readonly) {
+		emitf(out, "section \".rodata.%s\"", def->name);
 	} else if (is_zeroes(&def->data.items)) {
-		xfprintf(out, "section \".bss.%s\"", def->name);
+		emitf(out, "section \".bss.%s\"", def->name);
 	} else {
-		xfprintf(out, "section \".data.%s\"", def->name);
+		emitf(out, "section \".data.%s\"", def->name);
 	}
-	xfprintf(out, "%s\ndata $%s = ", def->exported ? " export" : "",
+	emitf(out, "%s\ndata $%s = ", def->exported ? " export" : "",
 			def->name);
 	if (def->data.align != ALIGN_UNDEFINED) {
-		xfprintf(out, "align %zu ", def->data.align);
+		emitf(out, "align %zu ", def->data.align);
 	}
-	xfprintf(out, "{ ");
+	emitf(out, "{ ");
 
 	const struct qbe_data_item *item = &def->data.items;
 	while (item) {
 		switch (item->type) {
 		case QD_VALUE:
 			emit_qtype(item->value.type, true, out);
-			xfprintf(out, " ");
+			emitf(out, " ");
 			emit_value(&item->value, out);
 			break;
 		case QD_ZEROED:
-			xfprintf(out, "z %zu", item->zeroed);
+			emitf(out, "z %zu", item->zeroed);
 			break;
 		case QD_STRING:
 			emit_data_string(item->str, item->sz, out);
 			break;
 		case QD_SYMOFFS:
 			// XXX: ARCH
-			xfprintf(out, "l $%s + %" PRIi64, item->sym, item->offset);
+			emitf(out, "l $%s + %" PRIi64, item->sym, item->offset);
 			break;
 		}
 
-		xfprintf(out, item->next ? ", " : " ");
+		emitf(out, item->next ? ", " : " ");
 		item = item->next;
 	}
 
-	xfprintf(out, "}\n\n");
+	emitf(out, "}\n\n");
 }
 
 static void
 emit_def(const struct qbe_def *def, FILE *out)
 {
-	xfprintf(out, "dbgfile \"%s\"\n", sources[def->file]);
+	emitf(out, "dbgfile \"%s\"\n", sources[def->file]);
 	switch (def->kind) {
 	case Q_TYPE:
 		qemit_type(def, out);
@@ -373,12 +409,17 @@ emit_def(const struct qbe_def *def, FILE *out)
 	}
 }
 
-void
+size_t
 emit(const struct qbe_program *program, FILE *out)
 {
+	emitted = 0;
+	for (const struct qbe_def *def = program->types; def; def = def->next) {
+		emit_def(def, out);
+	}
 	const struct qbe_def *def = program->defs;
 	while (def) {
 		emit_def(def, out);
 		def = def->next;
 	}
+	return emitted;
 }
@@ -5,6 +5,7 @@
 #include "expr.h"
 #include "gen.h"
 #include "scope.h"
+#include "stats.h"
 #include "type_store.h"
 #include "types.h"
 #include "util.h"
@@ -26,6 +27,7 @@ static struct gen_value gen_expr_with(struct gen_context *ctx,
 	struct gen_value *out);
 static void gen_global_decl(struct gen_context *ctx,
 	const struct declaration *decl);
+static void gen_cleanup(struct gen_context *ctx, struct gen_scope *scope);
 
 static struct gen_scope *
 gen_scope_lookup(struct gen_context *ctx, const struct scope *which)
@@ -49,19 +51,186 @@ push_scope(struct gen_context *ctx, const struct scope *scope)
 	return new;
 }
 
+// Forgets the shared abort blocks which run any of the given defers, before
+// they are freed and their addresses can be reused
+static void
+abort_blocks_invalidate(struct gen_context *ctx, struct gen_defer *defers)
+{
+	struct gen_abort **next = &ctx->cold.aborts;
+	while (*next) {
+		struct gen_abort *blk = *next;
+		bool stale = false;
+		for (size_t i = 0; i < blk->ndefers && !stale; i++) {
+			for (struct gen_defer *defer = defers; defer;
+					defer = defer->next) {
+				if (blk->defers[i] == defer) {
+					stale = true;
+					break;
+				}
+			}
+		}
+		if (!stale) {
+			next = &blk->next;
+			continue;
+		}
+		*next = blk->next;
+		free(blk->defers);
+		free(blk);
+	}
+}
+
 static void
 pop_scope(struct gen_context *ctx)
 {
 	struct gen_scope *scope = ctx->scope;
+	gen_cleanup(ctx, scope);
 	ctx->scope = scope->parent;
+	if (scope->defers) {
+		abort_blocks_invalidate(ctx, scope->defers);
+	}
 	for (struct gen_defer *defer = scope->defers; defer; /* n/a */) {
 		struct gen_defer *next = defer->next;
 		free(defer);
 		defer = next;
 	}
+	for (struct gen_exit *exit = scope->exits; exit; /* n/a */) {
+		struct gen_exit *next = exit->next;
+		free(exit);
+		exit = next;
+	}
 	free(scope);
 }
 
+static struct qbe_value *
+defer_landing(struct gen_context *ctx, struct gen_defer *defer)
+{
+	if (!defer->landing.name) {
+		defer->landing = mklabel(ctx, &defer->llanding, "defer.%d");
+	}
+	return &defer->landing;
+}
+
+// Runs the defers pending between here and the given scope, or the enclosing
+// function, inlined function, or defer expression if NULL. Rather than
+// generating them again for each exit, this jumps to the shared cleanup blocks
+// generated by gen_cleanup, which resume here once they're done.
+static void
+gen_exit_defers(struct gen_context *ctx, struct gen_scope *until)
+{
+	struct gen_scope *first = NULL, *last = NULL;
+	for (struct gen_scope *scope = ctx->scope; scope; scope = scope->parent) {
+		if (scope->defers) {
+			if (last) {
+				last->onward = scope->defers;
+			} else {
+				first = scope;
+			}
+			last = scope;
+		}
+		if (scope == until || (!until
+				&& (scope->scope->class == SCOPE_DEFER
+				|| scope->scope->class == SCOPE_FUNC))) {
+			break;
+		}
+	}
+	if (!first) {
+		return;
+	}
+
+	if (!ctx->cleanup.name) {
+		ctx->cleanup = mkqtmp(ctx, &qbe_word, "cleanup.%d");
+	}
+	struct gen_exit *exit = xcalloc(1, sizeof(struct gen_exit));
+	exit->id = ctx->nexits++;
+	exit->next = last->exits;
+	last->exits = exit;
+
+	struct qbe_value id = constw(exit->id);
+	pushi(ctx->current, &ctx->cleanup, Q_COPY, &id, NULL);
+	pushi(ctx->current, NULL, Q_JMP,
+		defer_landing(ctx, first->defers), NULL);
+	struct qbe_statement lresume;
+	exit->resume = mklabel(ctx, &lresume, "resume.%d");
+	push(&ctx->current->body, &lresume);
+}
+
+// Generates a deferred expression. Its exits get a cleanup state of their own,
+// as the state of the exit which is running the defer is still needed after it.
+static void
+gen_deferred(struct gen_context *ctx, const struct gen_defer *defer)
+{
+	assert(defer->expr->type == EXPR_DEFER);
+	struct qbe_value cleanup = ctx->cleanup;
+	ctx->cleanup = (struct qbe_value){0};
+	push_scope(ctx, defer->expr->defer.scope);
+	gen_expr(ctx, defer->expr->defer.deferred);
+	pop_scope(ctx);
+	ctx->cleanup = cleanup;
+}
+
+// Generates the cleanup blocks of a scope which is being left, if any exit
+// needs them. Starting from the latest defer an exit jumps to, each defer runs
+// in turn, and then the exits which are done resume while the others go on to
+// the defers of the enclosing scopes.
+static void
+gen_cleanup(struct gen_context *ctx, struct gen_scope *scope)
+{
+	struct gen_defer *defer = scope->defers;
+	while (defer && !defer->landing.name) {
+		defer = defer->next;
+	}
+	if (!defer) {
+		assert(!scope->exits && !scope->onward);
+		return;
+	}
+
+	// Skip over the blocks if the code before can fall through
+	bool guard = true;
+	size_t ln = ctx->current->body.ln;
+	if (ln > 0) {
+		const struct qbe_statement *last =
+			&ctx->current->body.stmts[ln - 1];
+		guard = last->type != Q_INSTR || (last->instr != Q_JMP
+			&& last->instr != Q_JNZ && last->instr != Q_RET
+			&& last->instr != Q_HLT);
+	}
+	struct qbe_statement lskip;
+	struct qbe_value bskip = mklabel(ctx, &lskip, ".%d");
+	if (guard) {
+		pushi(ctx->current, NULL, Q_JMP, &bskip, NULL);
+	}
+
+	for (; defer; defer = defer->next) {
+		if (defer->landing.name) {
+			push(&ctx->current->body, &defer->llanding);
+		}
+		gen_deferred(ctx, defer);
+	}
+
+	for (struct gen_exit *exit = scope->exits; exit; exit = exit->next) {
+		if (!exit->next && !scope->onward) {
+			pushi(ctx->current, NULL, Q_JMP, &exit->resume, NULL);
+			break;
+		}
+		struct qbe_statement lnext;
+		struct qbe_value bnext = mklabel(ctx, &lnext, ".%d");
+		struct qbe_value id = constw(exit->id);
+		struct qbe_value match = mkqtmp(ctx, &qbe_word, ".%d");
+		pushi(ctx->current, &match, Q_CEQW, &ctx->cleanup, &id, NULL);
+		pushi(ctx->current, NULL, Q_JNZ, &match, &exit->resume, &bnext,
+			NULL);
+		push(&ctx->current->body, &lnext);
+	}
+	if (scope->onward) {
+		pushi(ctx->current, NULL, Q_JMP,
+			defer_landing(ctx, scope->onward), NULL);
+	}
+
+	if (guard) {
+		push(&ctx->current->body, &lskip);
+	}
+}
+
 static void
 gen_defers(struct gen_context *ctx, struct gen_scope *scope)
 {
@@ -74,11 +243,8 @@ gen_defers(struct gen_context *ctx, struct gen_scope *scope)
 	struct gen_defer *defers = scope->defers;
 	while (scope->defers) {
 		struct gen_defer *defer = scope->defers;
-		assert(defer->expr->type == EXPR_DEFER);
 		scope->defers = scope->defers->next;
-		push_scope(ctx, defer->expr->defer.scope);
-		gen_expr(ctx, defer->expr->defer.deferred);
-		pop_scope(ctx);
+		gen_deferred(ctx, defer);
 	}
 	scope->defers = defers;
 }
@@ -196,24 +362,172 @@ gen_load_tag(struct gen_context *ctx,
 	pushi(ctx->current, out, load, from, NULL);
 }
 
+// Generates the defers to run before aborting at this point, and the call to
+// rt.abort_fixed
 static void
-gen_fixed_abort(struct gen_context *ctx,
-	struct location loc, enum fixed_aborts reason)
+gen_abort_call(struct gen_context *ctx, struct qbe_value *path,
+	struct qbe_value *line, struct qbe_value *col,
+	enum fixed_aborts reason)
+{
+	gen_exit_defers(ctx, NULL);
+
+	struct qbe_value tmp = constl(reason);
+	pushi(ctx->current, NULL, Q_CALL, &ctx->rt.fixedabort,
+			path, line, col, &tmp, NULL);
+	pushi(ctx->current, NULL, Q_HLT, NULL);
+}
+
+static void
+abort_site_value(struct gen_cold *cold, struct qbe_value value)
+{
+	struct qbe_data_item *item = &cold->sites->data.items;
+	if (cold->last_site) {
+		item = cold->last_site->next = xcalloc(1, sizeof(*item));
+	}
+	item->type = QD_VALUE;
+	item->value = value;
+	cold->last_site = item;
+}
+
+// Adds a failure site to the current function's table, returning its index
+static size_t
+abort_site(struct gen_context *ctx, struct location loc)
+{
+	struct gen_cold *cold = &ctx->cold;
+	if (!cold->sites) {
+		cold->sites = xcalloc(1, sizeof(struct qbe_def));
+		cold->sites->kind = Q_DATA;
+		cold->sites->name = gen_name(&ctx->id, "abortsites.%d");
+		cold->sites->data.align = ctx->arch.ptr->size;
+		cold->sites->data.readonly = true;
+		cold->site = mkqtmp(ctx, ctx->arch.sz, "abortsite.%d");
+	}
+	abort_site_value(cold, mklval(ctx, &ctx->sources[loc.file]));
+	abort_site_value(cold, constw(loc.lineno));
+	abort_site_value(cold, constw(loc.colno));
+	return cold->nsites++;
+}
+
+// Returns the shared abort block for the given reason and the defers which
+// are pending here, generating it if there's none yet
+static struct gen_abort *
+abort_block(struct gen_context *ctx, enum fixed_aborts reason)
 {
+	struct gen_defer **defers = NULL;
+	size_t ndefers = 0;
 	for (struct gen_scope *scope = ctx->scope; scope; scope = scope->parent) {
-		gen_defers(ctx, scope);
-		if (scope->scope->class == SCOPE_DEFER) {
+		if (scope->defers) {
+			defers = xrealloc(defers, (ndefers + 1) * sizeof(*defers));
+			defers[ndefers++] = scope->defers;
+		}
+		if (scope->scope->class == SCOPE_DEFER
+				|| scope->scope->class == SCOPE_FUNC) {
 			break;
 		}
 	}
 
-	struct qbe_value path = mklval(ctx, &ctx->sources[loc.file]);
-	struct qbe_value line = constl(loc.lineno);
-	struct qbe_value col = constl(loc.colno);
-	struct qbe_value tmp = constl(reason);
-	pushi(ctx->current, NULL, Q_CALL, &ctx->rt.fixedabort,
-			&path, &line, &col, &tmp, NULL);
-	pushi(ctx->current, NULL, Q_HLT, NULL);
+	for (struct gen_abort *blk = ctx->cold.aborts; blk; blk = blk->next) {
+		if (blk->reason == reason && blk->ndefers == ndefers
+				&& (ndefers == 0 || memcmp(blk->defers, defers,
+					ndefers * sizeof(*defers)) == 0)) {
+			free(defers);
+			return blk;
+		}
+	}
+
+	struct gen_abort *blk = xcalloc(1, sizeof(struct gen_abort));
+	blk->reason = reason;
+	blk->defers = defers;
+	blk->ndefers = ndefers;
+	blk->next = ctx->cold.aborts;
+	ctx->cold.aborts = blk;
+
+	struct qbe_statements hot = ctx->current->body;
+	ctx->current->body = ctx->cold.body;
+	ctx->cold.active = true;
+	ctx->nchecked = 0;
+
+	struct qbe_statement lblock;
+	blk->label = mklabel(ctx, &lblock, "abort.%d");
+	push(&ctx->current->body, &lblock);
+
+	// Each site is a pointer to the path followed by the line and column
+	// as words
+	struct qbe_value table = {
+		.kind = QV_GLOBAL,
+		.type = ctx->arch.ptr,
+		.name = xstrdup(ctx->cold.sites->name),
+	};
+	struct qbe_value entry = mkqtmp(ctx, ctx->arch.ptr, ".%d");
+	struct qbe_value path = mkqtmp(ctx, ctx->arch.ptr, ".%d");
+	struct qbe_value addr = mkqtmp(ctx, ctx->arch.ptr, ".%d");
+	struct qbe_value line = mkqtmp(ctx, &qbe_long, ".%d");
+	struct qbe_value col = mkqtmp(ctx, &qbe_long, ".%d");
+	struct qbe_value size = constl(ctx->arch.ptr->size + 8);
+	struct qbe_value lineoff = constl(ctx->arch.ptr->size);
+	struct qbe_value coloff = constl(ctx->arch.ptr->size + 4);
+	pushi(ctx->current, &entry, Q_MUL, &ctx->cold.site, &size, NULL);
+	pushi(ctx->current, &entry, Q_ADD, &table, &entry, NULL);
+	enum qbe_instr ptrload = load_for_type(ctx, &builtin_type_uintptr);
+	pushi(ctx->current, &path, ptrload, &entry, NULL);
+	pushi(ctx->current, &addr, Q_ADD, &entry, &lineoff, NULL);
+	pushi(ctx->current, &line, Q_LOADUW, &addr, NULL);
+	pushi(ctx->current, &addr, Q_ADD, &entry, &coloff, NULL);
+	pushi(ctx->current, &col, Q_LOADUW, &addr, NULL);
+	gen_abort_call(ctx, &path, &line, &col, reason);
+
+	ctx->cold.active = false;
+	ctx->cold.body = ctx->current->body;
+	ctx->current->body = hot;
+	ctx->nchecked = 0;
+	return blk;
+}
+
+// Moves the out-of-line blocks to the end of the current function
+static void
+gen_cold_blocks(struct gen_context *ctx)
+{
+	struct gen_cold *cold = &ctx->cold;
+	struct qbe_statements *body = &ctx->current->body;
+	if (cold->body.ln > 0) {
+		body->sz = body->ln + cold->body.ln + 1;
+		body->stmts = xrealloc(body->stmts,
+			body->sz * sizeof(struct qbe_statement));
+		memcpy(&body->stmts[body->ln], cold->body.stmts,
+			cold->body.ln * sizeof(struct qbe_statement));
+		body->ln += cold->body.ln;
+	}
+	free(cold->body.stmts);
+
+	if (cold->sites) {
+		qbe_append_def(ctx->out, cold->sites);
+	}
+	for (struct gen_abort *blk = cold->aborts; blk; /* n/a */) {
+		struct gen_abort *next = blk->next;
+		free(blk->defers);
+		free(blk);
+		blk = next;
+	}
+	*cold = (struct gen_cold){0};
+}
+
+static void
+gen_fixed_abort(struct gen_context *ctx,
+	struct location loc, enum fixed_aborts reason)
+{
+	if (ctx->cold.active) {
+		// Already out of line
+		struct qbe_value path = mklval(ctx, &ctx->sources[loc.file]);
+		struct qbe_value line = constl(loc.lineno);
+		struct qbe_value col = constl(loc.colno);
+		gen_abort_call(ctx, &path, &line, &col, reason);
+		return;
+	}
+
+	struct qbe_value index = constl(abort_site(ctx, loc));
+	struct gen_abort *blk = abort_block(ctx, reason);
+	pushi(ctx->current, &ctx->cold.site, Q_COPY, &index, NULL);
+	pushi(ctx->current, NULL, Q_JMP, &blk->label, NULL);
 }
 
 static struct gen_value
@@ -262,25 +576,89 @@ load_slice_data(struct gen_context *ctx, struct gen_slice *slobj,
 	}
 }
 
+static struct gen_reach *
+reach_lookup(struct gen_context *ctx, const char *symbol)
+{
+	uint32_t hash = fnv1a_s(FNV1A_INIT, symbol);
+	for (struct gen_reach *r = ctx->reach[hash % REACH_BUCKETS];
+			r; r = r->next) {
+		if (strcmp(r->decl->symbol, symbol) == 0) {
+			return r;
+		}
+	}
+	return NULL;
+}
+
+// Notes that generated code refers to the declaration with the given symbol,
+// which must then be generated as well
+static void
+gen_reach(struct gen_context *ctx, const char *symbol)
+{
+	struct gen_reach *r = reach_lookup(ctx, symbol);
+	if (!r || r->reached) {
+		return;
+	}
+	r->reached = true;
+	if (ctx->npending == ctx->pending_sz) {
+		ctx->pending_sz = ctx->pending_sz ? ctx->pending_sz * 2 : 64;
+		ctx->pending = xrealloc(ctx->pending,
+			ctx->pending_sz * sizeof(*ctx->pending));
+	}
+	ctx->pending[ctx->npending++] = r->decl;
+}
+
+static struct gen_binding **
+binding_bucket(struct gen_context *ctx, const struct scope_object *obj)
+{
+	uint32_t hash = fnv1a_u64(FNV1A_INIT, (uintptr_t)obj);
+	return &ctx->bound[hash % BINDING_BUCKETS];
+}
+
+static void
+push_binding(struct gen_context *ctx, struct gen_binding *gb)
+{
+	struct gen_binding **bucket = binding_bucket(ctx, gb->object);
+	gb->bnext = *bucket;
+	*bucket = gb;
+	gb->next = ctx->bindings;
+	ctx->bindings = gb;
+}
+
+// Forgets the bindings made since the given one, or all of them if NULL
+static void
+pop_bindings(struct gen_context *ctx, struct gen_binding *until)
+{
+	while (ctx->bindings != until) {
+		struct gen_binding *gb = ctx->bindings;
+		struct gen_binding **bucket = binding_bucket(ctx, gb->object);
+		assert(*bucket == gb);
+		*bucket = gb->bnext;
+		ctx->bindings = gb->next;
+		free(gb);
+	}
+}
+
 static struct gen_value
 gen_access_ident(struct gen_context *ctx, const struct scope_object *obj)
 {
 	switch (obj->otype) {
 	case O_BIND:
-		for (const struct gen_binding *gb = ctx->bindings;
-				gb; gb = gb->next) {
+		for (const struct gen_binding *gb = *binding_bucket(ctx, obj);
+				gb; gb = gb->bnext) {
 			if (gb->object == obj) {
 				return gb->value;
 			}
 		}
 		return gv_void;
-	case O_DECL:
-		return (struct gen_value){
+	case O_DECL:;
+		struct gen_value val = {
 			.kind = GV_GLOBAL,
 			.type = obj->type,
 			.name = ident_to_sym(&obj->ident),
 			.threadlocal = obj->flags & SO_THREADLOCAL,
 		};
+		gen_reach(ctx, val.name);
+		return val;
 	case O_CONST:
 	case O_TYPE:
 	case O_SCAN:
@@ -309,19 +687,66 @@ gen_indexing_bounds_check(struct gen_context *ctx,
 	push(&ctx->current->body, &lvalid);
 }
 
+// Returns the binding an indexing expression's object or index reads, if it
+// can only be modified by an assignment to it
+static const struct scope_object *
+checked_object(const struct expression *expr)
+{
+	if (expr->type == EXPR_CAST && expr->cast.lowered) {
+		expr = expr->cast.value;
+	}
+	if (expr->type != EXPR_ACCESS || expr->access.type != ACCESS_IDENTIFIER
+			|| expr->access.object->otype != O_BIND
+			|| expr->access.object->flags & SO_ADDRESS_TAKEN) {
+		return NULL;
+	}
+	return expr->access.object;
+}
+
+// Reports whether the same index into the same object has already been bounds
+// checked in the current basic block. Assignments reset the list of checked
+// accesses, and any label since the check ends the block.
+static bool
+checked_before(struct gen_context *ctx,
+	const struct scope_object *array, const struct scope_object *index)
+{
+	const struct qbe_statements *body = &ctx->current->body;
+	for (size_t i = 0; i < ctx->nchecked; i++) {
+		const struct gen_checked *checked = &ctx->checked[i];
+		if (checked->array != array || checked->index != index) {
+			continue;
+		}
+		for (size_t j = checked->pos; j < body->ln; j++) {
+			if (body->stmts[j].type == Q_LABEL) {
+				return false;
+			}
+		}
+		return true;
+	}
+	return false;
+}
+
 static struct gen_value
 gen_access_index(struct gen_context *ctx, const struct expression *expr)
 {
+	bool checkbounds = !expr->access.bounds_checked;
+	const struct scope_object *aobj = checked_object(expr->access.array);
+	const struct scope_object *iobj = checked_object(expr->access.index);
+	if (checkbounds && aobj && iobj
+			&& checked_before(ctx, aobj, iobj)) {
+		checkbounds = false;
+	}
+
 	struct gen_value glval = gen_expr(ctx, expr->access.array);
 	glval = gen_autoderef(ctx, glval);
 	struct qbe_value qival = mkqtmp(ctx, ctx->arch.ptr, ".%d");
-	bool checkbounds = !expr->access.bounds_checked;
 	struct qbe_value length, qlval;
 	const struct type *ty = type_dealias(NULL, glval.type);
 	switch (ty->storage) {
 	case STORAGE_SLICE:;
 		struct gen_slice sl = gen_slice_ptrs(ctx, glval);
-		load_slice_data(ctx, &sl, &qlval, &length, NULL);
+		load_slice_data(ctx, &sl, &qlval,
+			checkbounds ? &length : NULL, NULL);
 		break;
 	case STORAGE_ARRAY:
 		qlval = mkqval(ctx, &glval);
@@ -343,6 +768,16 @@ gen_access_index(struct gen_context *ctx, const struct expression *expr)
 
 	if (checkbounds) {
 		gen_indexing_bounds_check(ctx, expr->loc, Q_CULTL, &qindex, &length);
+		if (aobj && iobj) {
+			if (ctx->nchecked == CHECKED_MAX) {
+				ctx->nchecked = 0;
+			}
+			ctx->checked[ctx->nchecked++] = (struct gen_checked){
+				.array = aobj,
+				.index = iobj,
+				.pos = ctx->current->body.ln,
+			};
+		}
 	}
 
 	return (struct gen_value){
@@ -551,9 +986,15 @@ gen_expr_alloc_init_with(struct gen_context *ctx,
 	struct qbe_value sz = constl(objtype->size);
 	struct gen_value result = mkgtemp(ctx, expr->result, ".%d");
 	struct qbe_value qresult = mkqval(ctx, &result);
-	pushi(ctx->current, &qresult, Q_CALL, &ctx->rt.malloc, &sz, NULL);
+	if (expr->alloc.on_stack) {
+		enum qbe_instr alloc = alloc_for_align(objtype->align);
+		pushprei(ctx->current, &qresult, alloc, &sz, NULL);
+	} else {
+		pushi(ctx->current, &qresult, Q_CALL, &ctx->rt.malloc, &sz, NULL);
+	}
 
-	if (!(type_dealias(NULL, expr->result)->pointer.flags & PTR_NULLABLE)) {
+	if (!expr->alloc.on_stack && !(type_dealias(NULL, expr->result)
+			->pointer.flags & PTR_NULLABLE)) {
 		struct qbe_statement linvalid, lvalid;
 		struct qbe_value cmpres = mkqtmp(ctx, &qbe_word, ".%d");
 		struct qbe_value zero = constl(0);
@@ -707,13 +1148,7 @@ gen_expr_assert(struct gen_context *ctx, const struct expression *expr)
 
 	if (expr->assert.message) {
 		struct gen_value msg = gen_expr(ctx, expr->assert.message);
-		for (struct gen_scope *scope = ctx->scope;
-				scope; scope = scope->parent) {
-			gen_defers(ctx, scope);
-			if (scope->scope->class == SCOPE_DEFER) {
-				break;
-			}
-		}
+		gen_exit_defers(ctx, NULL);
 		struct qbe_value path =
 			mklval(ctx, &ctx->sources[expr->loc.file]);
 		struct qbe_value line = constl(expr->loc.lineno);
@@ -976,6 +1411,181 @@ bool bin_extend[BIN_LAST + 1][2] = {
 	[BIN_BXOR] = { false, false },
 };
 
+static struct qbe_value
+const_of(const struct qbe_type *qtype, uint64_t v)
+{
+	return qtype->stype == Q_LONG ? constl(v) : constw((uint32_t)v);
+}
+
+// Computes the quotient of a word-sized x divided by d, which is not a power
+// of two, by multiplying with a magic number in long arithmetic. The result
+// is the truncated quotient of the magnitudes, as a long.
+static struct qbe_value
+gen_div_magic(struct gen_context *ctx, struct qbe_value *xl,
+	uint64_t d, bool is_signed)
+{
+	// Pick the smallest p for which m = ceil(2^p / d) gives the exact
+	// quotient for all operands, see Granlund & Montgomery, "Division by
+	// invariant integers using multiplication".
+	int p = is_signed ? 31 : 32;
+	uint64_t m;
+	for (;; ++p) {
+		uint64_t below = p == 64 ? UINT64_MAX : (UINT64_C(1) << p) - 1;
+		uint64_t err = d - 1 - below % d;
+		m = below / d + 1;
+		if (is_signed ? err < UINT64_C(1) << (p - 31)
+				: err <= UINT64_C(1) << (p - 32)) {
+			break;
+		}
+	}
+
+	struct qbe_value t = mkqtmp(ctx, &qbe_long, ".%d");
+	struct qbe_value q = mkqtmp(ctx, &qbe_long, ".%d");
+	if (is_signed) {
+		// floor(x * m / 2^p), plus one for negative x
+		struct qbe_value sign = mkqtmp(ctx, &qbe_long, ".%d");
+		struct qbe_value qm = constl(m), qp = constw(p);
+		struct qbe_value s63 = constw(63);
+		pushi(ctx->current, &t, Q_MUL, xl, &qm, NULL);
+		pushi(ctx->current, &q, Q_SAR, &t, &qp, NULL);
+		pushi(ctx->current, &sign, Q_SHR, xl, &s63, NULL);
+		pushi(ctx->current, &q, Q_ADD, &q, &sign, NULL);
+	} else if (m < UINT64_C(1) << 32) {
+		struct qbe_value qm = constl(m), qp = constw(p);
+		pushi(ctx->current, &t, Q_MUL, xl, &qm, NULL);
+		pushi(ctx->current, &q, Q_SHR, &t, &qp, NULL);
+	} else {
+		// m has 33 bits: x * m = x * 2^32 + x * (m - 2^32)
+		struct qbe_value qm = constl(m - (UINT64_C(1) << 32));
+		struct qbe_value s32 = constw(32), qp = constw(p - 32);
+		pushi(ctx->current, &t, Q_MUL, xl, &qm, NULL);
+		pushi(ctx->current, &t, Q_SHR, &t, &s32, NULL);
+		pushi(ctx->current, &t, Q_ADD, xl, &t, NULL);
+		pushi(ctx->current, &q, Q_SHR, &t, &qp, NULL);
+	}
+	return q;
+}
+
+// Generates x * c, x / c or x % c for an integer constant c with shifts,
+// masks and multiplications. Returns false, emitting nothing, if the generic
+// instruction should be used instead.
+static bool
+gen_arith_const(struct gen_context *ctx, struct qbe_value *out,
+	enum binarithm_operator op, const struct type *type,
+	struct qbe_value *x, const struct expression *c)
+{
+	if (op != BIN_TIMES && op != BIN_DIV && op != BIN_MODULO) {
+		return false;
+	}
+	// Negative constants are not folded by check
+	bool negate = false;
+	while (c->type == EXPR_UNARITHM && c->unarithm.op == UN_MINUS) {
+		negate = !negate;
+		c = c->unarithm.operand;
+	}
+	if (c->type != EXPR_LITERAL || c->literal.object != NULL
+			|| !type_is_integer(NULL, type)) {
+		return false;
+	}
+	const struct qbe_type *qtype = qtype_lookup(ctx, type, false);
+	assert(qtype->stype == Q_WORD || qtype->stype == Q_LONG);
+	int bits = qtype->stype == Q_LONG ? 64 : 32;
+	bool is_signed = type_is_signed(NULL, type);
+	if (negate && !is_signed) {
+		return false;
+	}
+
+	uint64_t d;
+	bool neg = false;
+	if (is_signed) {
+		int64_t v = negate ? (int64_t)-(uint64_t)c->literal.ival
+			: c->literal.ival;
+		neg = v < 0;
+		d = neg ? -(uint64_t)v : (uint64_t)v;
+		if (d >= UINT64_C(1) << (bits - 1)) {
+			return false;
+		}
+	} else {
+		d = c->literal.uval;
+		if (bits == 32) {
+			d &= UINT32_MAX;
+		}
+	}
+	if (d < 2) {
+		return false;
+	}
+
+	bool pow2 = (d & (d - 1)) == 0;
+	int k = 0;
+	while (pow2 && (UINT64_C(1) << k) != d) {
+		++k;
+	}
+	if (op == BIN_TIMES) {
+		if (!pow2) {
+			return false;
+		}
+		struct qbe_value qk = constw(k);
+		pushi(ctx->current, out, Q_SHL, x, &qk, NULL);
+		if (neg) {
+			pushi(ctx->current, out, Q_NEG, out, NULL);
+		}
+		return true;
+	}
+
+	if (pow2) {
+		struct qbe_value qk = constw(k);
+		if (!is_signed) {
+			if (op == BIN_DIV) {
+				pushi(ctx->current, out, Q_SHR, x, &qk, NULL);
+			} else {
+				struct qbe_value mask = const_of(qtype, d - 1);
+				pushi(ctx->current, out, Q_AND, x, &mask, NULL);
+			}
+			return true;
+		}
+		// Round towards zero by biasing negative x with d - 1
+		struct qbe_value bias = mkqtmp(ctx, qtype, ".%d");
+		struct qbe_value t = mkqtmp(ctx, qtype, ".%d");
+		struct qbe_value sign = constw(bits - 1);
+		struct qbe_value fill = constw(bits - k);
+		pushi(ctx->current, &bias, Q_SAR, x, &sign, NULL);
+		pushi(ctx->current, &bias, Q_SHR, &bias, &fill, NULL);
+		pushi(ctx->current, &t, Q_ADD, x, &bias, NULL);
+		if (op == BIN_DIV) {
+			pushi(ctx->current, out, Q_SAR, &t, &qk, NULL);
+			if (neg) {
+				pushi(ctx->current, out, Q_NEG, out, NULL);
+			}
+		} else {
+			struct qbe_value mask = const_of(qtype, -d);
+			pushi(ctx->current, &t, Q_AND, &t, &mask, NULL);
+			pushi(ctx->current, out, Q_SUB, x, &t, NULL);
+		}
+		return true;
+	}
+
+	// QBE has no high multiply, so only word-sized operands, whose
+	// products fit in a long, use a magic number
+	if (bits != 32) {
+		return false;
+	}
+	struct qbe_value xl = mkqtmp(ctx, &qbe_long, ".%d");
+	pushi(ctx->current, &xl, is_signed ? Q_EXTSW : Q_EXTUW, x, NULL);
+	struct qbe_value q = gen_div_magic(ctx, &xl, d, is_signed);
+	if (op == BIN_DIV) {
+		if (neg) {
+			pushi(ctx->current, &q, Q_NEG, &q, NULL);
+		}
+		pushi(ctx->current, out, Q_COPY, &q, NULL);
+	} else {
+		struct qbe_value qd = constl(d);
+		pushi(ctx->current, &q, Q_MUL, &q, &qd, NULL);
+		pushi(ctx->current, &q, Q_SUB, &xl, &q, NULL);
+		pushi(ctx->current, out, Q_COPY, &q, NULL);
+	}
+	return true;
+}
+
 static struct gen_value
 gen_expr_assign(struct gen_context *ctx, const struct expression *expr)
 {
@@ -1033,7 +1643,10 @@ gen_expr_assign(struct gen_context *ctx, const struct expression *expr)
 		if (bin_extend[expr->assign.op][1]) {
 			qrval = extend(ctx, qrval, rvalue.type);
 		}
-		pushi(ctx->current, &qlval, instr, &ilval, &qrval, NULL);
+		if (!gen_arith_const(ctx, &qlval, expr->assign.op,
+				lvalue.type, &ilval, value)) {
+			pushi(ctx->current, &qlval, instr, &ilval, &qrval, NULL);
+		}
 		gen_store(ctx, obj, lvalue);
 	}
 
@@ -1097,6 +1710,14 @@ gen_expr_binarithm(struct gen_context *ctx, const struct expression *expr)
 		}
 		return result;
 	}
+	if (gen_arith_const(ctx, &qresult, expr->binarithm.op, ltype,
+			&qlval, expr->binarithm.rvalue)) {
+		return result;
+	}
+	if (expr->binarithm.op == BIN_TIMES && gen_arith_const(ctx, &qresult,
+			BIN_TIMES, ltype, &qrval, expr->binarithm.lvalue)) {
+		return result;
+	}
 	enum qbe_instr instr = binarithm_for_op(ctx, expr->binarithm.op,
 		expr->binarithm.lvalue->result);
 	pushi(ctx->current, &qresult, instr, &qlval, &qrval, NULL);
@@ -1134,6 +1755,21 @@ done:
 	}
 }
 
+static const struct declaration *inline_callee(struct gen_context *ctx,
+	const struct expression *expr);
+
+// Reports whether a binding can take over the object its initializer results
+// in, rather than copying it to storage of its own. This is the case for
+// aggregates returned by calls, which QBE stores in the caller's frame, in a
+// place reserved for each call site. An inlined call may result in an object
+// which is still in use.
+static bool
+adopts_result(struct gen_context *ctx, const struct expression *init)
+{
+	return init->type == EXPR_CALL && type_is_aggregate(init->result)
+		&& init->result->size != 0 && !inline_callee(ctx, init);
+}
+
 static void
 gen_expr_binding_unpack(struct gen_context *ctx,
 	const struct expression_binding *binding)
@@ -1141,13 +1777,19 @@ gen_expr_binding_unpack(struct gen_context *ctx,
 	assert(binding->object == NULL);
 
 	const struct type *type = binding->initializer->result;
-	struct gen_value tuple_gv = mkgtemp(ctx, type, "tupleunpack.%d");
+	struct gen_value tuple_gv;
+	bool adopted = adopts_result(ctx, binding->initializer);
+	if (adopted) {
+		tuple_gv = gen_expr(ctx, binding->initializer);
+	} else {
+		tuple_gv = mkgtemp(ctx, type, "tupleunpack.%d");
+		struct qbe_value tuple_qv = mklval(ctx, &tuple_gv);
+		struct qbe_value sz = constl(type->size);
+		enum qbe_instr alloc = alloc_for_align(type->align);
+		pushprei(ctx->current, &tuple_qv, alloc, &sz, NULL);
+		gen_expr_at(ctx, binding->initializer, tuple_gv);
+	}
 	struct qbe_value tuple_qv = mklval(ctx, &tuple_gv);
-	struct qbe_value sz = constl(type->size);
-	enum qbe_instr alloc = alloc_for_align(type->align);
-	pushprei(ctx->current, &tuple_qv, alloc, &sz, NULL);
-
-	gen_expr_at(ctx, binding->initializer, tuple_gv);
 
 	for (const struct binding_unpack *unpack = binding->unpack;
 			unpack; unpack = unpack->next) {
@@ -1159,11 +1801,14 @@ gen_expr_binding_unpack(struct gen_context *ctx,
 		struct gen_binding *gb = xcalloc(1, sizeof(struct gen_binding));
 		gb->value = mkgtemp(ctx, unpack->object->type, "binding.%d");
 		gb->object = unpack->object;
-		gb->next = ctx->bindings;
-		ctx->bindings = gb;
+		push_binding(ctx, gb);
 		struct qbe_value item_qv = mklval(ctx, &gb->value);
 		struct qbe_value offs = constl(unpack->offset);
-		pushprei(ctx->current, &item_qv, Q_ADD, &tuple_qv, &offs, NULL);
+		if (adopted) {
+			pushi(ctx->current, &item_qv, Q_ADD, &tuple_qv, &offs, NULL);
+		} else {
+			pushprei(ctx->current, &item_qv, Q_ADD, &tuple_qv, &offs, NULL);
+		}
 	}
 }
 
@@ -1202,10 +1847,15 @@ gen_expr_binding(struct gen_context *ctx, const struct expression *expr)
 		}
 
 		struct gen_binding *gb = xcalloc(1, sizeof(struct gen_binding));
-		gb->value = mkgtemp(ctx, type, "binding.%d");
 		gb->object = binding->object;
-		gb->next = ctx->bindings;
-		ctx->bindings = gb;
+		if (adopts_result(ctx, binding->initializer)) {
+			gb->value = gen_expr(ctx, binding->initializer);
+			gb->value.type = type;
+			push_binding(ctx, gb);
+			continue;
+		}
+		gb->value = mkgtemp(ctx, type, "binding.%d");
+		push_binding(ctx, gb);
 
 		struct qbe_value qv = mklval(ctx, &gb->value);
 		struct qbe_value sz = constl(type->size);
@@ -1231,14 +1881,7 @@ gen_expr_control(struct gen_context *ctx, const struct expression *expr)
 		}
 	}
 
-	struct gen_scope *deferred = ctx->scope;
-	while (deferred != NULL) {
-		gen_defers(ctx, deferred);
-		if (deferred == scope) {
-			break;
-		}
-		deferred = deferred->parent;
-	}
+	gen_exit_defers(ctx, scope);
 
 	switch (expr->type) {
 	case EXPR_BREAK:
@@ -1258,9 +1901,95 @@ gen_expr_control(struct gen_context *ctx, const struct expression *expr)
 	return gv_void;
 }
 
+// Returns the declaration of the function called by a call expression, if it
+// may be inlined
+static const struct declaration *
+inline_callee(struct gen_context *ctx, const struct expression *expr)
+{
+	const struct expression *lvalue = expr->call.lvalue;
+	if (lvalue->type != EXPR_ACCESS
+			|| lvalue->access.type != ACCESS_IDENTIFIER
+			|| lvalue->access.object->otype != O_DECL) {
+		return NULL;
+	}
+	const struct identifier *ident = &lvalue->access.object->ident;
+	uint32_t hash = identifier_hash(FNV1A_INIT, ident);
+	for (struct gen_inline *in = ctx->inlines[hash % INLINE_BUCKETS];
+			in; in = in->next) {
+		if (identifier_eq(&in->decl->ident, ident)) {
+			return in->decl;
+		}
+	}
+	return NULL;
+}
+
+// Generates the body of a small leaf function in place of a call to it. Its
+// parameters are bound to copies of the arguments, and its function scope
+// stands in for the function: returns leave it like a yield, and defers run
+// on an abort stop there.
+static struct gen_value
+gen_call_inline(struct gen_context *ctx, const struct expression *expr,
+	const struct declaration *decl)
+{
+	const struct function_decl *func = &decl->func;
+	struct gen_binding *bindings = ctx->bindings, *params = NULL;
+	const struct scope_object *obj = func->scope->objects;
+	for (struct call_argument *carg = expr->call.args;
+			carg; carg = carg->next, obj = obj->lnext) {
+		struct gen_value arg = gen_expr(ctx, carg->value);
+		if (carg->value->result->storage == STORAGE_NEVER) {
+			return gv_void;
+		}
+		if (obj->type->size == 0) {
+			continue;
+		}
+		struct gen_binding *gb = xcalloc(1, sizeof(struct gen_binding));
+		gb->value = mkgtemp(ctx, obj->type, "param.%d");
+		gb->object = obj;
+		gb->next = params;
+		params = gb;
+
+		struct qbe_value qv = mklval(ctx, &gb->value);
+		struct qbe_value sz = constl(obj->type->size);
+		enum qbe_instr alloc = alloc_for_align(obj->type->align);
+		pushprei(ctx->current, &qv, alloc, &sz, NULL);
+		gen_store(ctx, gb->value, arg);
+	}
+	// Bound only once all arguments are evaluated, since they may inline
+	// the same function
+	while (params) {
+		struct gen_binding *next = params->next;
+		push_binding(ctx, params);
+		params = next;
+	}
+
+	struct qbe_statement lend;
+	struct qbe_value bend = mklabel(ctx, &lend, ".%d");
+	struct gen_scope *scope = push_scope(ctx, func->scope);
+	scope->end = &bend;
+	scope->result = mkgtemp(ctx, func->type->func.result, ".%d");
+	struct gen_value result = scope->result;
+
+	// The checked accesses may refer to the parameters of an earlier
+	// inlined call
+	ctx->nchecked = 0;
+	struct gen_value ret = gen_expr(ctx, func->body);
+	branch_copyresult(ctx, ret, result, NULL);
+	pop_scope(ctx);
+	push(&ctx->current->body, &lend);
+
+	pop_bindings(ctx, bindings);
+	return result;
+}
+
 static struct gen_value
 gen_expr_call(struct gen_context *ctx, const struct expression *expr)
 {
+	const struct declaration *callee = inline_callee(ctx, expr);
+	if (callee) {
+		return gen_call_inline(ctx, expr, callee);
+	}
+
 	struct gen_value lvalue = gen_expr(ctx, expr->call.lvalue);
 	lvalue = gen_autoderef(ctx, lvalue);
 
@@ -1311,13 +2040,7 @@ gen_expr_call(struct gen_context *ctx, const struct expression *expr)
 	}
 
 	if (rtype->func.result->storage == STORAGE_NEVER) {
-		for (struct gen_scope *scope = ctx->scope; scope;
-				scope = scope->parent) {
-			gen_defers(ctx, scope);
-			if (scope->scope->class == SCOPE_DEFER) {
-				break;
-			}
-		}
+		gen_exit_defers(ctx, NULL);
 	}
 
 	push(&ctx->current->body, &call);
@@ -1969,25 +2692,69 @@ gen_literal_slice_at(struct gen_context *ctx,
 	pushi(ctx->current, NULL, store, &ln, &qptr, NULL);
 }
 
-static struct qbe_data_item *gen_data_item(struct gen_context *,
-	const struct expression *, struct qbe_data_item *);
+static struct qbe_data_item *gen_data_item(struct gen_context *,
+	const struct expression *, struct qbe_data_item *);
+
+// Returns the pool entry for the given string contents, emitting a read-only
+// data definition for them the first time they're seen
+static struct strpool_entry *
+strpool_lookup(struct gen_context *ctx, const char *str, size_t len)
+{
+	uint32_t hash = fnv1a_size(FNV1A_INIT, len);
+	for (size_t i = 0; i < len; i++) {
+		hash = fnv1a(hash, str[i]);
+	}
+	struct strpool_entry **next = &ctx->strpool[hash % STRPOOL_BUCKETS];
+	for (; *next; next = &(*next)->next) {
+		if ((*next)->len == len && memcmp((*next)->str, str, len) == 0) {
+			return *next;
+		}
+	}
+
+	struct strpool_entry *entry = xcalloc(1, sizeof(struct strpool_entry));
+	entry->len = len;
+	*next = entry;
+	if (len == 0) {
+		return entry;
+	}
+
+	struct qbe_def *def = xcalloc(1, sizeof(struct qbe_def));
+	def->name = gen_name(&ctx->id, "strdata.%d");
+	def->kind = Q_DATA;
+	def->data.align = ALIGN_UNDEFINED;
+	def->data.readonly = true;
+	def->data.items.type = QD_STRING;
+	def->data.items.str = xcalloc(len, 1);
+	def->data.items.sz = len;
+	memcpy(def->data.items.str, str, len);
+	qbe_append_def(ctx->out, def);
+	entry->str = def->data.items.str;
+	entry->data = def->name;
+	return entry;
+}
 
 static struct gen_value
 gen_literal_string(struct gen_context *ctx, const struct expression *expr)
 {
-	struct qbe_def *str = xcalloc(1, sizeof(struct qbe_def));
-	str->kind = Q_DATA;
-	str->data.align = ALIGN_UNDEFINED;
-	str->exported = false;
-	str->name = gen_name(&ctx->id, "strliteral.%d");
-	str->file = expr->loc.file;
-	gen_data_item(ctx, expr, &str->data.items);
-	qbe_append_def(ctx->out, str);
+	struct strpool_entry *entry = strpool_lookup(ctx,
+		expr->literal.string.value, expr->literal.string.len);
+	if (!entry->literal) {
+		struct qbe_def *str = xcalloc(1, sizeof(struct qbe_def));
+		str->kind = Q_DATA;
+		str->data.align = ALIGN_UNDEFINED;
+		str->data.readonly = true;
+		str->exported = false;
+		str->name = gen_name(&ctx->id, "strliteral.%d");
+		str->file = expr->loc.file;
+		gen_data_item(ctx, expr, &str->data.items);
+		qbe_append_def(ctx->out, str);
+		entry->literal = str->name;
+	}
 
 	return (struct gen_value){
 		.kind = GV_GLOBAL,
 		.type = expr->result,
-		.name = xstrdup(str->name),
+		.name = xstrdup(entry->literal),
 	};
 }
 
@@ -2232,8 +2999,9 @@ gen_expr_for(struct gen_context *ctx, const struct expression *expr)
 	struct qbe_value bend = mklabel(ctx, &lend, ".%d");
 	struct qbe_value bafter = mklabel(ctx, &lafter, "after.%d");
 
-	struct gen_value gcur_object, ginitializer, gptr;
-	struct qbe_value qcur_object, qinitializer, qptr, qcur_idx, qlength;
+	struct gen_value gcur_object, ginitializer, gelem;
+	struct qbe_value qcur_object, qinitializer, qptr, qlength, qend;
+	bool in_place = false;
 
 	enum for_kind kind = expr->_for.kind;
 
@@ -2256,17 +3024,8 @@ gen_expr_for(struct gen_context *ctx, const struct expression *expr)
 				expr->_for.bindings->binding.object->type);
 		}
 
-		gcur_object = mkgtemp(ctx, var_type, "cur_object.%d");
-		qcur_object = mklval(ctx, &gcur_object);
-
-		struct qbe_value qcur_object_sz = constl(var_type->size);
-		enum qbe_instr alloc = alloc_for_align(var_type->align);
-		pushprei(ctx->current, &qcur_object, alloc, &qcur_object_sz, NULL);
-
 		if (initializer_type->storage == STORAGE_ARRAY) {
-			gptr = mkgtemp(ctx, &builtin_type_uintptr, ".%d");
-			qptr = mklval(ctx, &gptr);
-
+			qptr = mkqtmp(ctx, ctx->arch.ptr, "ptr.%d");
 			pushi(ctx->current, &qptr, Q_COPY, &qinitializer, NULL);
 			qlength = constl(initializer_type->array.length);
 		} else {
@@ -2276,17 +3035,35 @@ gen_expr_for(struct gen_context *ctx, const struct expression *expr)
 			struct gen_slice slice = gen_slice_ptrs(ctx,
 				ginitializer);
 			load_slice_data(ctx, &slice, &qptr, &qlength, NULL);
+		}
+		gelem = (struct gen_value){
+			.kind = GV_TEMP,
+			.type = initializer_type->array.members,
+			.name = qptr.name,
+		};
 
-			gptr = (struct gen_value){
-				.kind = GV_TEMP,
-				.type = &builtin_type_uintptr,
-				.name = qptr.name
-			};
+		// Aggregates which the body can't modify are used in place,
+		// other values are copied to a binding each iteration
+		in_place = kind == FOR_EACH_VALUE && expr->_for.in_place
+			&& type_is_aggregate(type_dealias(NULL, var_type))
+			&& var_type->size == gelem.type->size;
+		if (in_place) {
+			gcur_object = gelem;
+			gcur_object.type = var_type;
+			qcur_object = mklval(ctx, &gcur_object);
+		} else {
+			gcur_object = mkgtemp(ctx, var_type, "cur_object.%d");
+			qcur_object = mklval(ctx, &gcur_object);
+			struct qbe_value qcur_object_sz = constl(var_type->size);
+			enum qbe_instr alloc = alloc_for_align(var_type->align);
+			pushprei(ctx->current, &qcur_object, alloc,
+				&qcur_object_sz, NULL);
 		}
 
-		struct qbe_value qzero = constl(0);
-		qcur_idx = mkqtmp(ctx, ctx->arch.sz, "cur_idx.%d");
-		pushi(ctx->current, &qcur_idx, Q_COPY, &qzero, NULL);
+		struct qbe_value qmember_sz = constl(gelem.type->size);
+		qend = mkqtmp(ctx, ctx->arch.ptr, "end.%d");
+		pushi(ctx->current, &qend, Q_MUL, &qlength, &qmember_sz, NULL);
+		pushi(ctx->current, &qend, Q_ADD, &qptr, &qend, NULL);
 	}
 
 	push_scope(ctx, expr->_for.scope);
@@ -2300,7 +3077,7 @@ gen_expr_for(struct gen_context *ctx, const struct expression *expr)
 	case FOR_EACH_POINTER: {
 		struct qbe_value qvalid = mkqtmp(ctx, &qbe_word, "valid.%d");
 
-		pushi(ctx->current, &qvalid, Q_CULTL, &qcur_idx, &qlength, NULL);
+		pushi(ctx->current, &qvalid, Q_CULTL, &qptr, &qend, NULL);
 		pushi(ctx->current, NULL, Q_JNZ, &qvalid, &bvalid, &bend, NULL);
 		push(&ctx->current->body, &lvalid);
 
@@ -2312,13 +3089,15 @@ gen_expr_for(struct gen_context *ctx, const struct expression *expr)
 					xcalloc(1, sizeof(struct gen_binding));
 				gb->object = binding->object;
 				gb->value = gcur_object;
-				gb->next = ctx->bindings;
-				ctx->bindings = gb;
+				push_binding(ctx, gb);
 			}
 		}
 
 		if (kind == FOR_EACH_VALUE) {
-			gen_copy_aligned(ctx, gcur_object, gptr);
+			if (!in_place && gcur_object.type->size != 0) {
+				gen_store(ctx, gcur_object,
+					gen_load(ctx, gelem));
+			}
 
 			struct binding_unpack *unpack =
 				expr->_for.bindings->binding.unpack;
@@ -2336,8 +3115,7 @@ gen_expr_for(struct gen_context *ctx, const struct expression *expr)
 						cur_unpack->object->type,
 						"unpack.%d");
 					gb->object = cur_unpack->object;
-					gb->next = ctx->bindings;
-					ctx->bindings = gb;
+					push_binding(ctx, gb);
 
 					struct qbe_value qoff =
 						constl(cur_unpack->offset);
@@ -2354,8 +3132,6 @@ gen_expr_for(struct gen_context *ctx, const struct expression *expr)
 				&qcur_object, NULL);
 		}
 
-		struct qbe_value qone = constl(1);
-		pushi(ctx->current, &qcur_idx, Q_ADD, &qcur_idx, &qone, NULL);
 		break;
 	}
 	case FOR_EACH_ITERATOR:
@@ -2418,8 +3194,7 @@ gen_expr_for(struct gen_context *ctx, const struct expression *expr)
 				gb->value = mkgtemp(ctx, cur_unpack->object->type,
 					"unpack.%d");
 				gb->object = cur_unpack->object;
-				gb->next = ctx->bindings;
-				ctx->bindings = gb;
+				push_binding(ctx, gb);
 
 				struct qbe_value qoff =	constl(cur_unpack->offset);
 				struct qbe_value qitem = mklval(ctx, &gb->value);
@@ -2440,8 +3215,7 @@ gen_expr_for(struct gen_context *ctx, const struct expression *expr)
 					.type = binding->object->type,
 					.name = qptr.name,
 				};
-				gb->next = ctx->bindings;
-				ctx->bindings = gb;
+				push_binding(ctx, gb);
 			}
 		}
 		break;
@@ -2479,7 +3253,7 @@ static struct gen_value
 gen_expr_free(struct gen_context *ctx, const struct expression *expr)
 {
 	const struct type *type = type_dealias(NULL, expr->free.expr->result);
-	if (type->storage == STORAGE_NULL) {
+	if (type->storage == STORAGE_NULL || expr->free.on_stack) {
 		return gv_void;
 	}
 	struct gen_value val = gen_expr(ctx, expr->free.expr);
@@ -2557,7 +3331,7 @@ gen_expr_append_insert(struct gen_context *ctx, const struct expression *expr)
 	slice = gen_autoderef(ctx, slice);
 	struct qbe_value prevlen, cap;
 	struct gen_slice sl = gen_slice_ptrs(ctx, slice);
-	load_slice_data(ctx, &sl, NULL, &prevlen, expr->append.is_static ? &cap : NULL);
+	load_slice_data(ctx, &sl, NULL, &prevlen, NULL);
 
 	enum qbe_instr load = load_for_type(ctx, &builtin_type_size);
 	struct qbe_value qindex, *qindex_ptr;
@@ -2616,9 +3390,23 @@ gen_expr_append_insert(struct gen_context *ctx, const struct expression *expr)
 	struct qbe_value ptr = mkqtmp(ctx, ctx->arch.ptr, ".%d");
 	const struct type *mtype = type_dealias(NULL, slice.type)->array.members;
 	struct qbe_value membsz = constl(mtype->size);
+	// The operands may have reallocated the slice, so its capacity is only
+	// loaded now
+	load_slice_data(ctx, &sl, NULL, NULL, &cap);
 	if (!expr->append.is_static) {
+		// Only call rt.ensure if the slice has to grow
+		struct qbe_statement lfits, lgrow;
+		struct qbe_value bfits = mklabel(ctx, &lfits, ".%d");
+		struct qbe_value bgrow = mklabel(ctx, &lgrow, ".%d");
+		struct qbe_value fits = mkqtmp(ctx, &qbe_word, ".%d");
+		pushi(ctx->current, &fits, Q_CULEL, &newlen, &cap, NULL);
+		pushi(ctx->current, NULL, Q_JNZ, &fits, &bfits, &bgrow, NULL);
+
+		push(&ctx->current->body, &lgrow);
 		struct qbe_value lval = mklval(ctx, &slice);
 		pushi(ctx->current, NULL, Q_CALL, &ctx->rt.ensure, &lval, &membsz, NULL);
+		pushi(ctx->current, NULL, Q_JMP, &bfits, NULL);
+		push(&ctx->current->body, &lfits);
 	} else {
 		struct qbe_statement lvalid, linvalid;
 		struct qbe_value bvalid = mklabel(ctx, &lvalid, ".%d");
@@ -2691,6 +3479,119 @@ gen_expr_append_insert(struct gen_context *ctx, const struct expression *expr)
 	return gv_void;
 }
 
+// Switches and matches with at most this many case ranges are lowered to a
+// chain of compares; larger ones to a balanced binary tree of compares. QBE
+// has no indirect branches, so jump tables aren't an option.
+#define SWITCH_LINEAR_MAX 4
+
+// A run of consecutive case values which all lead to the same case
+struct switch_range {
+	int64_t lo, hi;
+	size_t ncase;
+};
+
+static bool
+switch_is_integral(const struct type *type)
+{
+	type = type_dealias(NULL, type);
+	return type->storage == STORAGE_RUNE
+		|| (type_is_integer(NULL, type)
+			&& type->storage != STORAGE_ERROR);
+}
+
+// Returns the value of an integer constant, sign- or zero-extended from the
+// width of its type, such that constants of the same type compare with the
+// ordering of the type
+static int64_t
+switch_key(const struct expression *value, const struct type *type)
+{
+	uint64_t v = value->literal.uval;
+	if (type->size >= 8) {
+		return (int64_t)v;
+	}
+	int bits = type->size * 8;
+	v &= ((uint64_t)1 << bits) - 1;
+	if (type_is_signed(NULL, type) && v >> (bits - 1)) {
+		v |= ~(((uint64_t)1 << bits) - 1);
+	}
+	return (int64_t)v;
+}
+
+static bool is_signed_switch;
+
+static int
+switch_range_cmp(const void *_a, const void *_b)
+{
+	const struct switch_range *a = _a, *b = _b;
+	if (is_signed_switch) {
+		return (a->lo > b->lo) - (a->lo < b->lo);
+	}
+	return ((uint64_t)a->lo > (uint64_t)b->lo)
+		- ((uint64_t)a->lo < (uint64_t)b->lo);
+}
+
+static struct qbe_value
+switch_const(const struct qbe_type *qtype, int64_t v)
+{
+	if (qtype->stype == Q_LONG) {
+		return constl((uint64_t)v);
+	}
+	return constw((uint32_t)v);
+}
+
+static void
+gen_switch_tree(struct gen_context *ctx,
+	const struct type *type,
+	struct qbe_value *value,
+	const struct switch_range *ranges, size_t nranges,
+	const struct qbe_value *bcases,
+	struct qbe_value *bdefault)
+{
+	const struct qbe_type *qtype = qtype_lookup(ctx, type, false);
+	if (nranges <= SWITCH_LINEAR_MAX) {
+		enum qbe_instr eq = binarithm_for_op(ctx, BIN_LEQUAL, type);
+		enum qbe_instr ule = qtype->stype == Q_LONG ? Q_CULEL : Q_CULEW;
+		for (size_t i = 0; i < nranges; i++) {
+			const struct switch_range *r = &ranges[i];
+			struct qbe_statement lnext;
+			struct qbe_value bnext = mklabel(ctx, &lnext, ".%d");
+			struct qbe_value cond = mkqtmp(ctx, &qbe_word, ".%d");
+			if (r->lo == r->hi) {
+				struct qbe_value c = switch_const(qtype, r->lo);
+				pushi(ctx->current, &cond, eq, value, &c, NULL);
+			} else {
+				// lo <= value <= hi, as value - lo <= hi - lo
+				struct qbe_value lo = switch_const(qtype, r->lo);
+				struct qbe_value span = switch_const(qtype,
+					(int64_t)((uint64_t)r->hi - (uint64_t)r->lo));
+				struct qbe_value off = mkqtmp(ctx, qtype, ".%d");
+				pushi(ctx->current, &off, Q_SUB, value, &lo, NULL);
+				pushi(ctx->current, &cond, ule, &off, &span, NULL);
+			}
+			pushi(ctx->current, NULL, Q_JNZ, &cond,
+				&bcases[r->ncase], &bnext, NULL);
+			push(&ctx->current->body, &lnext);
+		}
+		pushi(ctx->current, NULL, Q_JMP, bdefault, NULL);
+		return;
+	}
+
+	size_t mid = nranges / 2;
+	struct qbe_statement lleft, lright;
+	struct qbe_value bleft = mklabel(ctx, &lleft, "switch.lt.%d");
+	struct qbe_value bright = mklabel(ctx, &lright, "switch.ge.%d");
+	struct qbe_value pivot = switch_const(qtype, ranges[mid].lo);
+	struct qbe_value cond = mkqtmp(ctx, &qbe_word, ".%d");
+	enum qbe_instr lt = binarithm_for_op(ctx, BIN_LESS, type);
+	pushi(ctx->current, &cond, lt, value, &pivot, NULL);
+	pushi(ctx->current, NULL, Q_JNZ, &cond, &bleft, &bright, NULL);
+	push(&ctx->current->body, &lleft);
+	gen_switch_tree(ctx, type, value, ranges, mid, bcases, bdefault);
+	push(&ctx->current->body, &lright);
+	gen_switch_tree(ctx, type, value, &ranges[mid], nranges - mid,
+		bcases, bdefault);
+}
+
 enum match_compat {
 	// The case type is a member of the match object type and can be used
 	// directly from the match object's tagged union storage area.
@@ -2825,6 +3726,110 @@ gen_subset_match_tests(struct gen_context *ctx,
 	return match;
 }
 
+// Returns true if a case of the given type matches an object of the given
+// tagged union type whose tag is the given member's type ID. If further
+// tests of the tags of inner tagged unions are needed, *nested is set.
+static bool
+match_case_selects(const struct type *objtype, const struct type *casetype,
+	const struct type *memb, bool *nested)
+{
+	*nested = false;
+	const struct type *subtype =
+		tagged_select_subtype(NULL, objtype, casetype, false);
+	if (subtype) {
+		if (subtype->id != memb->id) {
+			return false;
+		}
+		*nested = subtype->id != casetype->id
+			&& type_dealias(NULL, subtype)->id != casetype->id;
+		return true;
+	}
+	casetype = type_dealias(NULL, casetype);
+	assert(casetype->storage == STORAGE_TAGGED);
+	for (const struct type_tagged_union *tu = &casetype->tagged;
+			tu; tu = tu->next) {
+		if (tu->type->id == memb->id) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Branches to the label of the case of a match which selects the object, by
+// a binary search over the type IDs of the members of the object's type.
+// Cases which only select some values of an inner tagged union are tested in
+// turn once the outer tag is known.
+static void
+gen_match_dispatch(struct gen_context *ctx,
+	const struct expression *expr,
+	struct gen_value object,
+	struct qbe_value tag,
+	const struct qbe_value *bcases,
+	struct qbe_value *bdefault)
+{
+	const struct type *objtype = expr->match.value->result;
+	size_t nmembs = 0;
+	for (const struct type_tagged_union *tu =
+			&type_dealias(NULL, objtype)->tagged; tu; tu = tu->next) {
+		nmembs++;
+	}
+	struct qbe_statement *lmembs =
+		xcalloc(nmembs, sizeof(struct qbe_statement));
+	struct qbe_value *bmembs = xcalloc(nmembs, sizeof(struct qbe_value));
+	struct switch_range *ranges =
+		xcalloc(nmembs, sizeof(struct switch_range));
+	size_t i = 0;
+	for (const struct type_tagged_union *tu =
+			&type_dealias(NULL, objtype)->tagged;
+			tu; tu = tu->next, i++) {
+		bmembs[i] = mklabel(ctx, &lmembs[i], "member.%d");
+		ranges[i] = (struct switch_range){
+			.lo = tu->type->id,
+			.hi = tu->type->id,
+			.ncase = i,
+		};
+	}
+
+	is_signed_switch = false;
+	qsort(ranges, nmembs, sizeof(struct switch_range), switch_range_cmp);
+	gen_switch_tree(ctx, &builtin_type_u32, &tag,
+		ranges, nmembs, bmembs, bdefault);
+
+	i = 0;
+	for (const struct type_tagged_union *tu =
+			&type_dealias(NULL, objtype)->tagged;
+			tu; tu = tu->next, i++) {
+		push(&ctx->current->body, &lmembs[i]);
+		size_t ncase = 0;
+		bool matched = false;
+		for (const struct match_case *_case = expr->match.cases;
+				_case; _case = _case->next, ncase++) {
+			bool nested;
+			if (!_case->type || !match_case_selects(objtype,
+					_case->type, tu->type, &nested)) {
+				continue;
+			}
+			if (!nested) {
+				pushi(ctx->current, NULL, Q_JMP,
+					&bcases[ncase], NULL);
+				matched = true;
+				break;
+			}
+			struct qbe_statement lnext;
+			struct qbe_value bnext = mklabel(ctx, &lnext, "next.%d");
+			gen_nested_match_tests(ctx, object, bcases[ncase],
+				bnext, tag, _case->type);
+			push(&ctx->current->body, &lnext);
+		}
+		if (!matched) {
+			pushi(ctx->current, NULL, Q_JMP, bdefault, NULL);
+		}
+	}
+	free(lmembs);
+	free(bmembs);
+	free(ranges);
+}
+
 static struct gen_value
 gen_match_with_tagged(struct gen_context *ctx,
 	const struct expression *expr,
@@ -2841,46 +3846,47 @@ gen_match_with_tagged(struct gen_context *ctx,
 	struct qbe_value tag = mkqtmp(ctx, ctx->arch.sz, "tag.%d");
 	gen_load_tag(ctx, &tag, &qobject, objtype);
 
-	struct qbe_statement lout;
+	struct qbe_statement lout, labort;
 	struct qbe_value bout = mklabel(ctx, &lout, ".%d");
+	struct qbe_value babort = mklabel(ctx, &labort, ".%d");
 
-	struct gen_value bval;
-	const struct match_case *_default = NULL;
+	size_t ncases = 0;
 	for (const struct match_case *_case = expr->match.cases;
 			_case; _case = _case->next) {
+		ncases++;
+	}
+	struct qbe_statement *lcases =
+		xcalloc(ncases, sizeof(struct qbe_statement));
+	struct qbe_value *bcases = xcalloc(ncases, sizeof(struct qbe_value));
+	struct qbe_value *bdefault = &babort;
+	size_t i = 0;
+	for (const struct match_case *_case = expr->match.cases;
+			_case; _case = _case->next, i++) {
+		bcases[i] = mklabel(ctx, &lcases[i], "matches.%d");
 		if (!_case->type) {
-			_default = _case;
-			continue;
-		}
-
-		struct qbe_statement lmatch, lnext;
-		struct qbe_value bmatch = mklabel(ctx, &lmatch, "matches.%d");
-		struct qbe_value bnext = mklabel(ctx, &lnext, "next.%d");
-		const struct type *subtype =
-			tagged_select_subtype(NULL, objtype, _case->type, false);
-		enum match_compat compat = COMPAT_SUBTYPE;
-		if (subtype) {
-			gen_nested_match_tests(ctx, object,
-				bmatch, bnext, tag, _case->type);
-		} else {
-			assert(type_dealias(NULL, _case->type)->storage == STORAGE_TAGGED);
-			assert(tagged_subset_compat(NULL, objtype, _case->type));
-			compat = COMPAT_SUBSET;
-			const struct type *casetype = type_dealias(NULL, _case->type);
-			gen_subset_match_tests(ctx, bmatch, bnext, tag, casetype);
+			bdefault = &bcases[i];
 		}
+	}
 
-		push(&ctx->current->body, &lmatch);
+	gen_match_dispatch(ctx, expr, object, tag, bcases, bdefault);
 
-		if (!_case->object || _case->type->size == 0) {
+	i = 0;
+	for (const struct match_case *_case = expr->match.cases;
+			_case; _case = _case->next, i++) {
+		push(&ctx->current->body, &lcases[i]);
+		if (!_case->type || !_case->object || _case->type->size == 0) {
 			goto next;
 		}
 
+		enum match_compat compat = COMPAT_SUBTYPE;
+		if (!tagged_select_subtype(NULL, objtype, _case->type, false)) {
+			compat = COMPAT_SUBSET;
+		}
+
 		struct gen_binding *gb = xcalloc(1, sizeof(struct gen_binding));
 		gb->value = mkgtemp(ctx, _case->type, "binding.%d");
 		gb->object = _case->object;
-		gb->next = ctx->bindings;
-		ctx->bindings = gb;
+		push_binding(ctx, gb);
 
 		struct qbe_value qv = mklval(ctx, &gb->value);
 		enum qbe_instr alloc = alloc_for_align(_case->type->align);
@@ -2909,26 +3915,20 @@ gen_match_with_tagged(struct gen_context *ctx,
 			break;
 		}
 
-next:
-		bval = gen_expr_with(ctx, _case->value, out);
+next:;
+		struct gen_value bval = gen_expr_with(ctx, _case->value, out);
 		branch_copyresult(ctx, bval, gvout, out);
 		if (_case->value->result->storage != STORAGE_NEVER) {
 			pushi(ctx->current, NULL, Q_JMP, &bout, NULL);
 		}
-		push(&ctx->current->body, &lnext);
 	}
 
-	if (_default) {
-		bval = gen_expr_with(ctx, _default->value, out);
-		branch_copyresult(ctx, bval, gvout, out);
-	} else {
-		struct qbe_statement labort;
-		mklabel(ctx, &labort, ".%d");
-		push(&ctx->current->body, &labort);
-		gen_fixed_abort(ctx, expr->loc, ABORT_UNREACHABLE);
-	}
+	push(&ctx->current->body, &labort);
+	gen_fixed_abort(ctx, expr->loc, ABORT_UNREACHABLE);
 
 	push(&ctx->current->body, &lout);
+	free(lcases);
+	free(bcases);
 	return gvout;
 }
 
@@ -2980,8 +3980,7 @@ gen_match_with_nullable(struct gen_context *ctx,
 		struct gen_binding *gb = xcalloc(1, sizeof(struct gen_binding));
 		gb->value = mkgtemp(ctx, _case->type, "binding.%d");
 		gb->object = _case->object;
-		gb->next = ctx->bindings;
-		ctx->bindings = gb;
+		push_binding(ctx, gb);
 
 		enum qbe_instr store = store_for_type(ctx, _case->type);
 		enum qbe_instr alloc = alloc_for_align(_case->type->align);
@@ -3057,9 +4056,17 @@ gen_expr_return(struct gen_context *ctx, const struct expression *expr)
 	if (expr->_return.value->result->storage == STORAGE_NEVER) {
 		return gv_void;
 	}
-	for (struct gen_scope *scope = ctx->scope; scope; scope = scope->parent) {
-		gen_defers(ctx, scope);
+	struct gen_scope *inlined = ctx->scope;
+	while (inlined && inlined->scope->class != SCOPE_FUNC) {
+		inlined = inlined->parent;
+	}
+	if (inlined) {
+		branch_copyresult(ctx, ret, inlined->result, NULL);
+		gen_exit_defers(ctx, inlined);
+		pushi(ctx->current, NULL, Q_JMP, inlined->end, NULL);
+		return gv_void;
 	}
+	gen_exit_defers(ctx, NULL);
 	if (ret.type->size == 0) {
 		pushi(ctx->current, NULL, Q_RET, NULL);
 	} else {
@@ -3121,11 +4128,328 @@ gen_expr_struct(struct gen_context *ctx, const struct expression *expr)
 	return gv_void;
 }
 
+// A case value of a switch over strings
+struct switch_string {
+	const struct expression *value;
+	size_t ncase;
+};
+
+static size_t string_index;
+
+static int
+switch_string_cmp(const void *_a, const void *_b)
+{
+	const struct switch_string *a = _a, *b = _b;
+	size_t alen = a->value->literal.string.len;
+	size_t blen = b->value->literal.string.len;
+	if (alen != blen) {
+		return (alen > blen) - (alen < blen);
+	}
+	if (alen <= string_index) {
+		return 0;
+	}
+	unsigned char ac = a->value->literal.string.value[string_index];
+	unsigned char bc = b->value->literal.string.value[string_index];
+	return (ac > bc) - (ac < bc);
+}
+
+// Dispatches on a byte position which tells apart the most of the given
+// strings, all of the same length, until one candidate remains, which is then
+// compared in full. This takes one call to rt.strcmp at most.
+static void
+gen_switch_strings(struct gen_context *ctx,
+	struct gen_value *value,
+	struct qbe_value *data,
+	struct switch_string *strings, size_t nstrings,
+	const struct qbe_value *bcases,
+	struct qbe_value *bdefault)
+{
+	size_t len = strings[0].value->literal.string.len;
+	if (nstrings == 1) {
+		if (len == 0) {
+			pushi(ctx->current, NULL, Q_JMP,
+				&bcases[strings[0].ncase], NULL);
+			return;
+		}
+		struct gen_value test = gen_expr_literal(ctx, strings[0].value);
+		struct qbe_value qvalue = mkqval(ctx, value);
+		struct qbe_value qtest = mkqval(ctx, &test);
+		struct qbe_value cond = mkqtmp(ctx, &qbe_word, ".%d");
+		pushi(ctx->current, &cond, Q_CALL, &ctx->rt.strcmp,
+			&qvalue, &qtest, NULL);
+		pushi(ctx->current, NULL, Q_JNZ, &cond,
+			&bcases[strings[0].ncase], bdefault, NULL);
+		return;
+	}
+
+	size_t best = 0, best_distinct = 0;
+	for (size_t i = 0; i < len; i++) {
+		bool seen[256] = {0};
+		size_t distinct = 0;
+		for (size_t j = 0; j < nstrings; j++) {
+			unsigned char c = strings[j].value->literal.string.value[i];
+			if (!seen[c]) {
+				seen[c] = true;
+				distinct++;
+			}
+		}
+		if (distinct > best_distinct) {
+			best = i;
+			best_distinct = distinct;
+		}
+	}
+	// Duplicate cases are rejected by check
+	assert(best_distinct > 1);
+
+	string_index = best;
+	qsort(strings, nstrings, sizeof(struct switch_string),
+		switch_string_cmp);
+
+	struct qbe_statement *lgroups =
+		xcalloc(best_distinct, sizeof(struct qbe_statement));
+	struct qbe_value *bgroups =
+		xcalloc(best_distinct, sizeof(struct qbe_value));
+	struct switch_range *ranges =
+		xcalloc(best_distinct, sizeof(struct switch_range));
+	size_t *starts = xcalloc(best_distinct + 1, sizeof(size_t));
+	size_t ngroups = 0;
+	for (size_t i = 0; i < nstrings; i++) {
+		unsigned char c = strings[i].value->literal.string.value[best];
+		if (ngroups > 0 && ranges[ngroups - 1].lo == c) {
+			continue;
+		}
+		bgroups[ngroups] = mklabel(ctx, &lgroups[ngroups], "string.%d");
+		ranges[ngroups] = (struct switch_range){
+			.lo = c,
+			.hi = c,
+			.ncase = ngroups,
+		};
+		starts[ngroups++] = i;
+	}
+	starts[ngroups] = nstrings;
+
+	struct qbe_value ptr = mkqtmp(ctx, ctx->arch.ptr, ".%d");
+	struct qbe_value offs = constl(best);
+	struct qbe_value byte = mkqtmp(ctx, &qbe_word, ".%d");
+	pushi(ctx->current, &ptr, Q_ADD, data, &offs, NULL);
+	pushi(ctx->current, &byte, Q_LOADUB, &ptr, NULL);
+	gen_switch_tree(ctx, &builtin_type_u8, &byte,
+		ranges, ngroups, bgroups, bdefault);
+
+	for (size_t i = 0; i < ngroups; i++) {
+		push(&ctx->current->body, &lgroups[i]);
+		gen_switch_strings(ctx, value, data, &strings[starts[i]],
+			starts[i + 1] - starts[i], bcases, bdefault);
+	}
+	free(lgroups);
+	free(bgroups);
+	free(ranges);
+	free(starts);
+}
+
+static void
+gen_switch_dispatch_strings(struct gen_context *ctx,
+	const struct expression *expr,
+	struct gen_value value,
+	const struct qbe_value *bcases,
+	struct qbe_value *bdefault)
+{
+	size_t nstrings = 0;
+	for (const struct switch_case *_case = expr->_switch.cases;
+			_case; _case = _case->next) {
+		for (struct case_option *opt = _case->options;
+				opt; opt = opt->next) {
+			nstrings++;
+		}
+	}
+	struct switch_string *strings =
+		xcalloc(nstrings, sizeof(struct switch_string));
+	size_t ncase = 0, n = 0;
+	for (const struct switch_case *_case = expr->_switch.cases;
+			_case; _case = _case->next, ncase++) {
+		for (struct case_option *opt = _case->options;
+				opt; opt = opt->next) {
+			strings[n++] = (struct switch_string){
+				.value = opt->value,
+				.ncase = ncase,
+			};
+		}
+	}
+	if (nstrings == 0) {
+		pushi(ctx->current, NULL, Q_JMP, bdefault, NULL);
+		free(strings);
+		return;
+	}
+
+	string_index = 0;
+	qsort(strings, nstrings, sizeof(struct switch_string),
+		switch_string_cmp);
+
+	struct gen_slice sl = gen_slice_ptrs(ctx, value);
+	struct qbe_value data, len;
+	load_slice_data(ctx, &sl, &data, &len, NULL);
+
+	// Dispatch on the length first, then within each length
+	struct qbe_statement *lgroups =
+		xcalloc(nstrings, sizeof(struct qbe_statement));
+	struct qbe_value *bgroups = xcalloc(nstrings, sizeof(struct qbe_value));
+	struct switch_range *ranges =
+		xcalloc(nstrings, sizeof(struct switch_range));
+	size_t *starts = xcalloc(nstrings + 1, sizeof(size_t));
+	size_t ngroups = 0;
+	for (size_t i = 0; i < nstrings; i++) {
+		int64_t slen = strings[i].value->literal.string.len;
+		if (ngroups > 0 && ranges[ngroups - 1].lo == slen) {
+			continue;
+		}
+		bgroups[ngroups] = mklabel(ctx, &lgroups[ngroups], "string.%d");
+		ranges[ngroups] = (struct switch_range){
+			.lo = slen,
+			.hi = slen,
+			.ncase = ngroups,
+		};
+		starts[ngroups++] = i;
+	}
+	starts[ngroups] = nstrings;
+
+	gen_switch_tree(ctx, &builtin_type_size, &len,
+		ranges, ngroups, bgroups, bdefault);
+	for (size_t i = 0; i < ngroups; i++) {
+		push(&ctx->current->body, &lgroups[i]);
+		gen_switch_strings(ctx, &value, &data, &strings[starts[i]],
+			starts[i + 1] - starts[i], bcases, bdefault);
+	}
+	free(lgroups);
+	free(bgroups);
+	free(ranges);
+	free(starts);
+	free(strings);
+}
+
+static void
+gen_switch_dispatch_integral(struct gen_context *ctx,
+	const struct expression *expr,
+	struct gen_value value,
+	const struct qbe_value *bcases,
+	struct qbe_value *bdefault)
+{
+	const struct type *type = type_dealias(NULL, value.type);
+	struct qbe_value qvalue = mkqval(ctx, &value);
+	qvalue = extend(ctx, qvalue, type);
+
+	size_t nranges = 0;
+	for (const struct switch_case *_case = expr->_switch.cases;
+			_case; _case = _case->next) {
+		for (struct case_option *opt = _case->options;
+				opt; opt = opt->next) {
+			nranges++;
+		}
+	}
+	struct switch_range *ranges =
+		xcalloc(nranges, sizeof(struct switch_range));
+	size_t ncase = 0, n = 0;
+	for (const struct switch_case *_case = expr->_switch.cases;
+			_case; _case = _case->next, ncase++) {
+		for (struct case_option *opt = _case->options;
+				opt; opt = opt->next) {
+			int64_t key = switch_key(opt->value, type);
+			ranges[n++] = (struct switch_range){
+				.lo = key,
+				.hi = key,
+				.ncase = ncase,
+			};
+		}
+	}
+
+	is_signed_switch = type_is_signed(NULL, type);
+	qsort(ranges, nranges, sizeof(struct switch_range), switch_range_cmp);
+	size_t nmerged = 0;
+	for (size_t i = 0; i < nranges; i++) {
+		struct switch_range *prev = nmerged ? &ranges[nmerged - 1] : NULL;
+		if (prev && prev->ncase == ranges[i].ncase
+				&& (uint64_t)prev->hi + 1 == (uint64_t)ranges[i].lo) {
+			prev->hi = ranges[i].lo;
+			continue;
+		}
+		ranges[nmerged++] = ranges[i];
+	}
+
+	gen_switch_tree(ctx, type, &qvalue, ranges, nmerged, bcases, bdefault);
+	free(ranges);
+}
+
+// Lowers a switch over integers, runes, enums, or strings by sorting the case
+// values and dispatching with a binary search, rather than testing each value
+// in turn.
+static struct gen_value
+gen_expr_switch_sorted(struct gen_context *ctx,
+	const struct expression *expr,
+	struct gen_value *out)
+{
+	struct gen_value gvout = gv_void;
+	if (!out) {
+		gvout = mkgtemp(ctx, expr->result, ".%d");
+	}
+
+	struct qbe_statement lout, labort;
+	struct qbe_value bout = mklabel(ctx, &lout, ".%d");
+	struct qbe_value babort = mklabel(ctx, &labort, ".%d");
+	struct gen_value value = gen_expr(ctx, expr->_switch.value);
+
+	size_t ncases = 0;
+	for (const struct switch_case *_case = expr->_switch.cases;
+			_case; _case = _case->next) {
+		ncases++;
+	}
+	struct qbe_statement *lcases =
+		xcalloc(ncases, sizeof(struct qbe_statement));
+	struct qbe_value *bcases = xcalloc(ncases, sizeof(struct qbe_value));
+	struct qbe_value *bdefault = &babort;
+	size_t i = 0;
+	for (const struct switch_case *_case = expr->_switch.cases;
+			_case; _case = _case->next, i++) {
+		bcases[i] = mklabel(ctx, &lcases[i], "matches.%d");
+		if (!_case->options) {
+			bdefault = &bcases[i];
+		}
+	}
+
+	if (type_dealias(NULL, value.type)->storage == STORAGE_STRING) {
+		gen_switch_dispatch_strings(ctx, expr, value, bcases, bdefault);
+	} else {
+		gen_switch_dispatch_integral(ctx, expr, value, bcases, bdefault);
+	}
+
+	i = 0;
+	for (const struct switch_case *_case = expr->_switch.cases;
+			_case; _case = _case->next, i++) {
+		push(&ctx->current->body, &lcases[i]);
+		struct gen_value bval = gen_expr_with(ctx, _case->value, out);
+		branch_copyresult(ctx, bval, gvout, out);
+		if (_case->value->result->storage != STORAGE_NEVER) {
+			pushi(ctx->current, NULL, Q_JMP, &bout, NULL);
+		}
+	}
+
+	push(&ctx->current->body, &labort);
+	gen_fixed_abort(ctx, expr->loc, ABORT_UNREACHABLE);
+
+	push(&ctx->current->body, &lout);
+	free(lcases);
+	free(bcases);
+	return gvout;
+}
+
 static struct gen_value
 gen_expr_switch_with(struct gen_context *ctx,
 	const struct expression *expr,
 	struct gen_value *out)
 {
+	const struct type *type = type_dealias(NULL, expr->_switch.value->result);
+	if (switch_is_integral(type) || type->storage == STORAGE_STRING) {
+		return gen_expr_switch_sorted(ctx, expr, out);
+	}
+
 	struct gen_value gvout = gv_void;
 	if (!out) {
 		gvout = mkgtemp(ctx, expr->result, ".%d");
@@ -3364,7 +4688,7 @@ gen_expr_vastart_at(struct gen_context *ctx,
 static struct gen_value
 gen_expr(struct gen_context *ctx, const struct expression *expr)
 {
-	if (expr->loc.file && expr->loc.lineno) {
+	if (expr->loc.file == ctx->file && expr->loc.lineno) {
 		struct qbe_value qline = constl(expr->loc.lineno);
 		struct qbe_value qcol = constl(expr->loc.colno);
 		pushi(ctx->current, NULL, Q_DBGLOC, &qline, &qcol, NULL);
@@ -3381,12 +4705,14 @@ gen_expr(struct gen_context *ctx, const struct expression *expr)
 	case EXPR_APPEND:
 	case EXPR_INSERT:
 		out = gen_expr_append_insert(ctx, expr);
+		ctx->nchecked = 0;
 		break;
 	case EXPR_ASSERT:
 		out = gen_expr_assert(ctx, expr);
 		break;
 	case EXPR_ASSIGN:
 		out = gen_expr_assign(ctx, expr);
+		ctx->nchecked = 0;
 		break;
 	case EXPR_BINARITHM:
 		out = gen_expr_binarithm(ctx, expr);
@@ -3416,6 +4742,7 @@ gen_expr(struct gen_context *ctx, const struct expression *expr)
 		break;
 	case EXPR_DELETE:
 		out = gen_expr_delete(ctx, expr);
+		ctx->nchecked = 0;
 		break;
 	case EXPR_FOR:
 		out = gen_expr_for(ctx, expr);
@@ -3558,6 +4885,11 @@ gen_function_decl(struct gen_context *ctx, const struct declaration *decl)
 	qdef->kind = Q_FUNC;
 	qdef->exported = decl->exported;
 	ctx->current = &qdef->func;
+	ctx->file = decl->file;
+	ctx->nchecked = 0;
+	ctx->nexits = 0;
+	ctx->cleanup = (struct qbe_value){0};
+	pop_bindings(ctx, NULL);
 
 	qdef->name = decl->symbol ? xstrdup(decl->symbol)
 		: ident_to_sym(&decl->ident);
@@ -3613,8 +4945,7 @@ gen_function_decl(struct gen_context *ctx, const struct declaration *decl)
 			gen_store(ctx, gb->value, src);
 		}
 
-		gb->next = ctx->bindings;
-		ctx->bindings = gb;
+		push_binding(ctx, gb);
 		next = &param->next;
 	}
 
@@ -3638,6 +4969,7 @@ gen_function_decl(struct gen_context *ctx, const struct declaration *decl)
 	} else {
 		pushi(ctx->current, NULL, Q_RET, NULL);
 	}
+	gen_cold_blocks(ctx);
 
 	qbe_append_def(ctx->out, qdef);
 
@@ -3743,6 +5075,7 @@ gen_data_item(struct gen_context *ctx, const struct expression *expr,
 		item->type = QD_SYMOFFS;
 		item->sym = ident_to_sym(&literal->object->ident);
 		item->offset = literal->ival;
+		gen_reach(ctx, item->sym);
 		return item;
 	}
 
@@ -3810,24 +5143,15 @@ gen_data_item(struct gen_context *ctx, const struct expression *expr,
 		}
 		break;
 	case STORAGE_STRING:
-		def = xcalloc(1, sizeof(struct qbe_def));
-		def->name = gen_name(&ctx->id, "strdata.%d");
-		def->kind = Q_DATA;
-		def->data.align = ALIGN_UNDEFINED;
-		def->data.items.type = QD_STRING;
-		def->data.items.str = xcalloc(expr->literal.string.len, 1);
-		def->data.items.sz = expr->literal.string.len;
-		memcpy(def->data.items.str, expr->literal.string.value,
-			expr->literal.string.len);
-
 		item->type = QD_VALUE;
 		if (expr->literal.string.len != 0) {
-			qbe_append_def(ctx->out, def);
+			struct strpool_entry *entry = strpool_lookup(ctx,
+				expr->literal.string.value,
+				expr->literal.string.len);
 			item->value.kind = QV_GLOBAL;
 			item->value.type = &qbe_long;
-			item->value.name = xstrdup(def->name);
+			item->value.name = xstrdup(entry->data);
 		} else {
-			free(def);
 			item->value = constl(0);
 		}
 
@@ -4036,8 +5360,29 @@ gen_decl(struct gen_context *ctx, const struct declaration *decl)
 	}
 }
 
+// Reports whether a declaration is only generated if it's reached, as nothing
+// outside the unit can refer to it
+static bool
+is_droppable(const struct declaration *decl)
+{
+	if (decl->exported || decl->has_symbol || !decl->symbol) {
+		return false;
+	}
+	switch (decl->decl_type) {
+	case DECL_FUNC:
+		return decl->func.flags == 0 && decl->func.body != NULL;
+	case DECL_GLOBAL:
+		return decl->global.value != NULL;
+	case DECL_TYPE:
+	case DECL_CONST:
+		return false;
+	}
+	abort(); // Invariant
+}
+
 void
-gen(const struct unit *unit, type_store *store, struct qbe_program *out)
+gen(const struct unit *unit, type_store *store, struct qbe_program *out,
+	bool inline_calls)
 {
 	struct gen_context ctx = {
 		.out = out,
@@ -4049,6 +5394,7 @@ gen(const struct unit *unit, type_store *store, struct qbe_program *out)
 		},
 	};
 	ctx.out->next = &ctx.out->defs;
+	ctx.out->next_type = &ctx.out->types;
 	rtfunc_init(&ctx);
 
 	ctx.sources = xcalloc(nsources + 1, sizeof(struct gen_value));
@@ -4058,9 +5404,59 @@ gen(const struct unit *unit, type_store *store, struct qbe_program *out)
 		ctx.sources[i] = gen_literal_string(&ctx, &eloc);
 	}
 
-	const struct declarations *decls = unit->declarations;
-	while (decls) {
-		gen_decl(&ctx, &decls->decl);
-		decls = decls->next;
+	for (const struct declarations *decls = unit->declarations;
+			inline_calls && decls; decls = decls->next) {
+		const struct declaration *decl = &decls->decl;
+		if (decl->decl_type != DECL_FUNC || !decl->func.body
+				|| !decl->func.inlinable) {
+			continue;
+		}
+		uint32_t hash = identifier_hash(FNV1A_INIT, &decl->ident);
+		struct gen_inline **bucket = &ctx.inlines[hash % INLINE_BUCKETS];
+		struct gen_inline *in = xcalloc(1, sizeof(struct gen_inline));
+		in->decl = decl;
+		in->next = *bucket;
+		*bucket = in;
+	}
+
+	// Only the declarations which may be referred to from outside the
+	// unit are generated up front, and the others once they're reached
+	// from those
+	const struct declarations *decls;
+	for (decls = unit->declarations; decls; decls = decls->next) {
+		const struct declaration *decl = &decls->decl;
+		if (!is_droppable(decl)) {
+			continue;
+		}
+		uint32_t hash = fnv1a_s(FNV1A_INIT, decl->symbol);
+		struct gen_reach **bucket = &ctx.reach[hash % REACH_BUCKETS];
+		struct gen_reach *r = xcalloc(1, sizeof(struct gen_reach));
+		r->decl = decl;
+		r->next = *bucket;
+		*bucket = r;
+	}
+
+	for (decls = unit->declarations; decls; decls = decls->next) {
+		if (!is_droppable(&decls->decl)) {
+			gen_decl(&ctx, &decls->decl);
+		}
+	}
+	while (ctx.npending > 0) {
+		gen_decl(&ctx, ctx.pending[--ctx.npending]);
+	}
+	free(ctx.pending);
+
+	for (decls = unit->declarations; decls; decls = decls->next) {
+		if (is_droppable(&decls->decl)
+				&& !reach_lookup(&ctx, decls->decl.symbol)->reached) {
+			stats_dropped(decls->decl.symbol);
+		}
+	}
+	for (size_t i = 0; i < REACH_BUCKETS; i++) {
+		for (struct gen_reach *r = ctx.reach[i]; r; /* n/a */) {
+			struct gen_reach *next = r->next;
+			free(r);
+			r = next;
+		}
 	}
 }
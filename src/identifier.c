@@ -4,6 +4,20 @@
 #include <string.h>
 #include "identifier.h"
 #include "util.h"
+#ifdef ALLOC_PROFILE
+#undef identifier_unparse
+#undef ident_to_sym
+#undef identifier_dup
+
+// Allocations are charged to the file which called into this one
+static const char *caller = __FILE__;
+#undef xcalloc
+#undef xrealloc
+#undef xstrdup
+#define xcalloc(n, s) xcalloc_profiled((n), (s), caller)
+#define xrealloc(p, s) xrealloc_profiled((p), (s), caller)
+#define xstrdup(s) xstrdup_profiled((s), caller)
+#endif
 
 uint32_t
 identifier_hash(uint32_t init, const struct identifier *ident)
@@ -97,3 +111,32 @@ identifier_eq(const struct identifier *a, const struct identifier *b)
 	}
 	return identifier_eq(a->ns, b->ns);
 }
+
+#ifdef ALLOC_PROFILE
+char *
+identifier_unparse_profiled(const struct identifier *ident, const char *file)
+{
+	caller = file;
+	char *buf = identifier_unparse(ident);
+	caller = __FILE__;
+	return buf;
+}
+
+char *
+ident_to_sym_profiled(const struct identifier *ident, const char *file)
+{
+	caller = file;
+	char *buf = ident_to_sym(ident);
+	caller = __FILE__;
+	return buf;
+}
+
+void
+identifier_dup_profiled(struct identifier *new,
+	const struct identifier *ident, const char *file)
+{
+	caller = file;
+	identifier_dup(new, ident);
+	caller = __FILE__;
+}
+#endif
@@ -1,17 +1,22 @@
 #include <assert.h>
 #include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include "ast.h"
+#include "astcache.h"
 #include "check.h"
 #include "emit.h"
 #include "gen.h"
 #include "lex.h"
+#include "mod.h"
 #include "parse.h"
 #include "qbe.h"
+#include "stats.h"
 #include "type_store.h"
 #include "typedef.h"
 #include "util.h"
@@ -20,21 +25,155 @@ static void
 usage(const char *argv_0)
 {
 	xfprintf(stderr,
-		"Usage: %s [-a arch] [-D ident[:type]=value] [-M path] [-m symbol] [-N namespace] [-o output] [-T] [-t typedefs] [-v] input.ha...\n\n",
+		"Usage: %s [-a arch] [-D ident[:type]=value] [-d depfile] [-f option] [-H] [-I] [-M path] [-m symbol] [-N namespace] [-O level] [-o output] [-S] [-T] [-t typedefs] [-v] input.ha...\n\n",
 		argv_0);
 	xfprintf(stderr,
 		"-a: set target architecture\n"
 		"-D: define a constant\n"
+		"-d: write make-style dependencies of the outputs to file\n"
+		"-f: set code generation option, no-inline to never inline calls\n"
+		"-H: print a hash of the module interface to stdout\n"
 		"-h: print this help text\n"
+		"-I: only resolve declarations and emit typedefs, without checking\n"
+		"    or generating function bodies\n"
 		"-M: set module path prefix, to be stripped from error messages\n"
 		"-m: set symbol of hosted main function\n"
 		"-N: override namespace for module\n"
+		"-O: set optimization level of the generated IR, 0 or 1 (the\n"
+		"    default)\n"
 		"-o: set output file name\n"
+		"-S: print timing and memory statistics as JSON to stderr\n"
 		"-T: emit tests\n"
-		"-t: emit typedefs to file\n"
+		"-t: emit typedefs to file, leaving it untouched if unchanged\n"
 		"-v: print version and exit\n");
 }
 
+// Writes the typedefs to path, unless the file already has the same contents,
+// so that its mtime only changes when the module's interface does. It's
+// replaced by renaming a temporary file over it, so that concurrent builds
+// never see it half-written.
+static void
+write_if_changed(const char *path, const char *buf, size_t sz)
+{
+	FILE *f = fopen(path, "r");
+	if (f) {
+		bool same = true;
+		size_t off = 0;
+		char tmp[4096];
+		size_t n;
+		while (same && (n = fread(tmp, 1, sizeof(tmp), f)) > 0) {
+			same = off + n <= sz && memcmp(tmp, buf + off, n) == 0;
+			off += n;
+		}
+		same = same && !ferror(f) && off == sz;
+		fclose(f);
+		if (same) {
+			return;
+		}
+	}
+
+	size_t tmpsz = strlen(path) + 32;
+	char *tmp = xcalloc(tmpsz, 1);
+	snprintf(tmp, tmpsz, "%s.%ld.tmp", path, (long)getpid());
+	f = fopen(tmp, "w");
+	if (!f) {
+		xfprintf(stderr, "Unable to open %s for writing: %s\n",
+				tmp, strerror(errno));
+		exit(EXIT_ABNORMAL);
+	}
+	bool ok = fwrite(buf, 1, sz, f) == sz;
+	if (fclose(f) != 0 || !ok) {
+		xfprintf(stderr, "Unable to write %s: %s\n",
+				tmp, strerror(errno));
+		remove(tmp);
+		exit(EXIT_ABNORMAL);
+	}
+	if (rename(tmp, path) != 0) {
+		xfprintf(stderr, "Unable to rename %s to %s: %s\n",
+				tmp, path, strerror(errno));
+		remove(tmp);
+		exit(EXIT_ABNORMAL);
+	}
+	free(tmp);
+}
+
+static void
+emit_dep_path(FILE *out, const char *path)
+{
+	for (; *path; path++) {
+		switch (*path) {
+		case ' ':
+		case '\t':
+		case '#':
+			xfprintf(out, "\\%c", *path);
+			break;
+		case '$':
+			xfprintf(out, "$$");
+			break;
+		default:
+			xfprintf(out, "%c", *path);
+			break;
+		}
+	}
+}
+
+static void
+write_depfile(const char *path, const char *output, const char *typedefs,
+	char *const inputs[], size_t ninputs)
+{
+	FILE *out = fopen(path, "w");
+	if (!out) {
+		xfprintf(stderr, "Unable to open %s for writing: %s\n",
+				path, strerror(errno));
+		exit(EXIT_ABNORMAL);
+	}
+
+	const char *targets[] = { output, typedefs };
+	const char *sep = "";
+	for (size_t i = 0; i < sizeof(targets) / sizeof(targets[0]); i++) {
+		if (targets[i]) {
+			xfprintf(out, "%s", sep);
+			emit_dep_path(out, targets[i]);
+			sep = " ";
+		}
+	}
+	xfprintf(out, ":");
+	for (size_t i = 0; i < ninputs; i++) {
+		if (strcmp(inputs[i], "-") == 0) {
+			continue;
+		}
+		xfprintf(out, " \\\n\t");
+		emit_dep_path(out, inputs[i]);
+	}
+	for (size_t i = 0; i < nmodule_paths; i++) {
+		xfprintf(out, " \\\n\t");
+		emit_dep_path(out, module_paths[i]);
+	}
+	xfprintf(out, "\n");
+	if (fclose(out) != 0) {
+		xfprintf(stderr, "Unable to write %s: %s\n",
+				path, strerror(errno));
+		exit(EXIT_ABNORMAL);
+	}
+}
+
+static void
+report_stats(const char *path)
+{
+	if (!path) {
+		stats_report(stderr);
+		return;
+	}
+	FILE *out = fopen(path, "w");
+	if (!out) {
+		xfprintf(stderr, "Unable to open %s for writing: %s\n",
+				path, strerror(errno));
+		exit(EXIT_ABNORMAL);
+	}
+	stats_report(out);
+	fclose(out);
+}
+
 static struct ast_global_decl *
 parse_define(const char *argv_0, const char *in)
 {
@@ -72,17 +211,20 @@ parse_define(const char *argv_0, const char *in)
 int
 main(int argc, char *argv[])
 {
-	const char *output = NULL, *typedefs = NULL;
+	const char *output = NULL, *typedefs = NULL, *depfile = NULL;
 	const char *target = DEFAULT_TARGET;
 	const char *modpath = NULL;
 	const char *mainsym = "main";
-	bool is_test = false;
+	const char *astcache = getenv("HAREC_AST_CACHE");
+	const char *statsfile = getenv("HAREC_STATS");
+	bool is_test = false, print_hash = false, interface_only = false;
+	bool optimize = true, inline_calls = true;
 	struct unit unit = {0};
 	struct lexer lexer;
 	struct ast_global_decl *defines = NULL, **next_def = &defines;
 
 	int c;
-	while ((c = getopt(argc, argv, "a:D:hM:m:N:o:Tt:v")) != -1) {
+	while ((c = getopt(argc, argv, "a:D:d:f:HhIM:m:N:O:o:STt:v")) != -1) {
 		switch (c) {
 		case 'a':
 			target = optarg;
@@ -91,6 +233,15 @@ main(int argc, char *argv[])
 			*next_def = parse_define(argv[0], optarg);
 			next_def = &(*next_def)->next;
 			break;
+		case 'd':
+			depfile = optarg;
+			break;
+		case 'H':
+			print_hash = true;
+			break;
+		case 'I':
+			interface_only = true;
+			break;
 		case 'h':
 			usage(argv[0]);
 			return EXIT_SUCCESS;
@@ -118,9 +269,26 @@ main(int argc, char *argv[])
 				lex_finish(&lexer);
 			}
 			break;
+		case 'f':
+			if (strcmp(optarg, "no-inline") != 0) {
+				usage(argv[0]);
+				return EXIT_USER;
+			}
+			inline_calls = false;
+			break;
+		case 'O':
+			if (strcmp(optarg, "0") != 0 && strcmp(optarg, "1") != 0) {
+				usage(argv[0]);
+				return EXIT_USER;
+			}
+			optimize = optarg[0] == '1';
+			break;
 		case 'o':
 			output = optarg;
 			break;
+		case 'S':
+			stats_enabled = true;
+			break;
 		case 'T':
 			is_test = true;
 			break;
@@ -136,6 +304,12 @@ main(int argc, char *argv[])
 		}
 	}
 
+	if (statsfile && *statsfile) {
+		stats_enabled = true;
+	} else {
+		statsfile = NULL;
+	}
+
 	builtin_types_init(target);
 
 	nsources = argc - optind;
@@ -143,6 +317,21 @@ main(int argc, char *argv[])
 		usage(argv[0]);
 		return EXIT_USER;
 	}
+	if (interface_only) {
+		if (!typedefs && !print_hash) {
+			xfprintf(stderr, "-I requires -t or -H\n");
+			return EXIT_USER;
+		}
+		output = NULL;
+	}
+	if (depfile && !output && !typedefs) {
+		xfprintf(stderr, "-d requires -o or -t to name a target\n");
+		return EXIT_USER;
+	}
+	if (print_hash && !output && !interface_only) {
+		xfprintf(stderr, "-H requires -o, since the hash is printed to stdout\n");
+		return EXIT_USER;
+	}
 
 	struct ast_unit aunit = {0};
 	struct ast_subunit *subunit = &aunit.subunits;
@@ -184,32 +373,80 @@ main(int argc, char *argv[])
 			return EXIT_ABNORMAL;
 		}
 
-		lex_init(&lexer, in,  i + 1);
-		parse(&lexer, subunit);
+		stats_begin("parse", sources[i + 1]);
+		if (astcache && *astcache && in != stdin) {
+			astcache_parse(astcache, in, i + 1, subunit);
+		} else {
+			lex_init(&lexer, in,  i + 1);
+			parse(&lexer, subunit);
+			lex_finish(&lexer);
+		}
+		stats_end();
 		if (i + 1 < nsources) {
 			*next = xcalloc(1, sizeof(struct ast_subunit));
 			subunit = *next;
 			next = &subunit->next;
 		}
-		lex_finish(&lexer);
 	}
 
 	static type_store ts = {0};
-	check(&ts, is_test, mainsym, defines, &aunit, &unit);
+	stats_begin("check", NULL);
+	check(&ts, is_test, interface_only, mainsym, defines, &aunit, &unit);
+	stats_end();
 
-	if (typedefs) {
-		FILE *out = fopen(typedefs, "w");
+	if (typedefs || print_hash) {
+		char *buf = NULL;
+		size_t sz = 0;
+		FILE *out = open_memstream(&buf, &sz);
 		if (!out) {
-			xfprintf(stderr, "Unable to open %s for writing: %s\n",
-					typedefs, strerror(errno));
+			xfprintf(stderr, "Unable to open memstream: %s\n",
+					strerror(errno));
 			return EXIT_ABNORMAL;
 		}
+		stats_begin("typedefs", NULL);
 		emit_typedefs(&unit, out);
 		fclose(out);
+
+		if (typedefs) {
+			write_if_changed(typedefs, buf, sz);
+		}
+		if (print_hash) {
+			uint32_t hash = FNV1A_INIT;
+			for (size_t i = 0; i < sz; i++) {
+				hash = fnv1a(hash, (unsigned char)buf[i]);
+			}
+			xfprintf(stdout, "%08" PRIx32 "\n", hash);
+		}
+		free(buf);
+		stats_end();
+	}
+
+	if (depfile) {
+		write_depfile(depfile, output, typedefs,
+			argv + optind, argc - optind);
+	}
+
+	if (interface_only) {
+		if (stats_enabled) {
+			report_stats(statsfile);
+		}
+		return EXIT_SUCCESS;
 	}
 
 	struct qbe_program prog = {0};
-	gen(&unit, &ts, &prog);
+	stats_begin("gen", NULL);
+	gen(&unit, &ts, &prog, inline_calls);
+	stats_end();
+
+	if (optimize) {
+		stats_begin("optimize", NULL);
+		for (struct qbe_def *def = prog.defs; def; def = def->next) {
+			if (def->kind == Q_FUNC) {
+				qbe_optimize(&def->func);
+			}
+		}
+		stats_end();
+	}
 
 	FILE *out;
 	if (!output) {
@@ -222,7 +459,13 @@ main(int argc, char *argv[])
 			return EXIT_ABNORMAL;
 		}
 	}
-	emit(&prog, out);
+	stats_begin("emit", NULL);
+	stats_counters.output_bytes = emit(&prog, out);
 	fclose(out);
+	stats_end();
+
+	if (stats_enabled) {
+		report_stats(statsfile);
+	}
 	return EXIT_SUCCESS;
 }
@@ -11,12 +11,17 @@
 #include "mod.h"
 #include "parse.h"
 #include "scope.h"
+#include "stats.h"
 #include "util.h"
 
 // unfortunately necessary since this is used in an array declaration, and we
 // don't want a VLA
 #define strlen_HARE_TD_ (sizeof("HARE_TD_") - 1)
 
+const char **module_paths;
+size_t nmodule_paths;
+static size_t module_paths_cap;
+
 struct scope *
 module_resolve(struct context *ctx,
 	const struct ast_global_decl *defines,
@@ -45,6 +50,7 @@ module_resolve(struct context *ctx,
 		exit(EXIT_USER);
 	}
 
+	stats_begin("module_resolve", &env[strlen_HARE_TD_]);
 	FILE *f = fopen(path, "r");
 	if (!f) {
 		xfprintf(stderr, "Could not open module '%s' for reading from %s: %s\n",
@@ -52,6 +58,13 @@ module_resolve(struct context *ctx,
 		exit(EXIT_ABNORMAL);
 	}
 
+	if (nmodule_paths == module_paths_cap) {
+		module_paths_cap = module_paths_cap ? module_paths_cap * 2 : 16;
+		module_paths = xrealloc(module_paths,
+			module_paths_cap * sizeof(const char *));
+	}
+	module_paths[nmodule_paths++] = path;
+
 	const char *old = sources[0];
 	sources[0] = path;
 	lex_init(&lexer, f, 0);
@@ -61,7 +74,7 @@ module_resolve(struct context *ctx,
 	// TODO: Free unused bits
 	struct unit u = {0};
 	struct scope *scope = check_internal(ctx->store, ctx->modcache,
-		ctx->is_test, ctx->mainsym, defines, &aunit, &u, true);
+		ctx->is_test, false, ctx->mainsym, defines, &aunit, &u, true);
 
 	sources[0] = old;
 	bucket = &ctx->modcache[hash % MODCACHE_BUCKETS];
@@ -70,5 +83,6 @@ module_resolve(struct context *ctx,
 	item->scope = scope;
 	item->next = *bucket;
 	*bucket = item;
+	stats_end();
 	return scope;
 }
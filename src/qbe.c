@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "qbe.h"
+#include "stats.h"
 #include "util.h"
 
 // Simple type singletons
@@ -142,6 +143,11 @@ const char *qbe_instr[Q_LAST_INSTR] = {
 void
 qbe_append_def(struct qbe_program *prog, struct qbe_def *def)
 {
+	if (def->kind == Q_TYPE) {
+		*prog->next_type = def;
+		prog->next_type = &def->next;
+		return;
+	}
 	*prog->next = def;
 	prog->next = &def->next;
 }
@@ -194,6 +200,7 @@ push(struct qbe_statements *stmts, struct qbe_statement *stmt)
 			sizeof(struct qbe_statement) * stmts->sz);
 	}
 	stmts->stmts[stmts->ln++] = *stmt;
+	stats_counters.statements++;
 }
 
 void
@@ -0,0 +1,884 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "qbe.h"
+#include "util.h"
+
+// Peephole optimizations of the IR of a function, cleaning up the redundancy
+// which the code generator leaves behind so that qbe has less to parse and
+// optimize itself. Temporaries which are defined by a single instruction are
+// treated as SSA values; those defined more than once are left alone.
+
+struct temp {
+	const char *name;
+	size_t defs, uses;
+	enum qbe_stype stype;
+	const struct qbe_statement *def; // If defined once
+	bool replaced;
+	struct qbe_value repl; // Value to use instead, if replaced
+	struct temp *next;
+};
+
+struct label {
+	const char *name;
+	size_t block; // Index of the block it begins
+	bool live;
+	const char *target; // Label which a jump from here ends up at
+	struct label *next;
+};
+
+struct qopt {
+	struct qbe_func *func;
+	struct temp **temps;
+	struct label **labels;
+	size_t nbuckets;
+};
+
+static struct temp *
+temp_lookup(struct qopt *opt, const char *name, bool insert)
+{
+	uint32_t hash = fnv1a_s(FNV1A_INIT, name);
+	struct temp **bucket = &opt->temps[hash & (opt->nbuckets - 1)];
+	for (struct temp *temp = *bucket; temp; temp = temp->next) {
+		if (strcmp(temp->name, name) == 0) {
+			return temp;
+		}
+	}
+	if (!insert) {
+		return NULL;
+	}
+	struct temp *temp = xcalloc(1, sizeof(struct temp));
+	temp->name = name;
+	temp->next = *bucket;
+	*bucket = temp;
+	return temp;
+}
+
+static struct label *
+label_lookup(struct qopt *opt, const char *name, bool insert)
+{
+	uint32_t hash = fnv1a_s(FNV1A_INIT, name);
+	struct label **bucket = &opt->labels[hash & (opt->nbuckets - 1)];
+	for (struct label *label = *bucket; label; label = label->next) {
+		if (strcmp(label->name, name) == 0) {
+			return label;
+		}
+	}
+	if (!insert) {
+		return NULL;
+	}
+	struct label *label = xcalloc(1, sizeof(struct label));
+	label->name = name;
+	label->next = *bucket;
+	*bucket = label;
+	return label;
+}
+
+static void
+labels_free(struct qopt *opt)
+{
+	for (size_t i = 0; i < opt->nbuckets; i++) {
+		for (struct label *label = opt->labels[i]; label; /* n/a */) {
+			struct label *next = label->next;
+			free(label);
+			label = next;
+		}
+		opt->labels[i] = NULL;
+	}
+}
+
+static void
+tables_free(struct qopt *opt)
+{
+	for (size_t i = 0; i < opt->nbuckets; i++) {
+		for (struct temp *temp = opt->temps[i]; temp; /* n/a */) {
+			struct temp *next = temp->next;
+			free(temp);
+			temp = next;
+		}
+		opt->temps[i] = NULL;
+	}
+	labels_free(opt);
+}
+
+static void
+count_stmts(struct qopt *opt, const struct qbe_statements *stmts)
+{
+	for (size_t i = 0; i < stmts->ln; i++) {
+		const struct qbe_statement *stmt = &stmts->stmts[i];
+		if (stmt->type != Q_INSTR) {
+			continue;
+		}
+		if (stmt->out) {
+			struct temp *temp = temp_lookup(opt,
+				stmt->out->name, true);
+			temp->defs++;
+			temp->def = stmt;
+			temp->stype = stmt->out->type->stype;
+		}
+		for (const struct qbe_arguments *arg = stmt->args; arg;
+				arg = arg->next) {
+			if (arg->value.kind == QV_TEMPORARY) {
+				temp_lookup(opt, arg->value.name, true)->uses++;
+			}
+		}
+	}
+}
+
+// Counts the definitions and uses of each temporary. The passes never
+// introduce temporaries, so those of the last count are reset and reused.
+static void
+count_temps(struct qopt *opt)
+{
+	for (size_t i = 0; i < opt->nbuckets; i++) {
+		for (struct temp *temp = opt->temps[i]; temp;
+				temp = temp->next) {
+			temp->defs = temp->uses = 0;
+			temp->stype = 0;
+			temp->def = NULL;
+			temp->replaced = false;
+		}
+	}
+	for (const struct qbe_func_param *param = opt->func->params; param;
+			param = param->next) {
+		struct temp *temp = temp_lookup(opt, param->name, true);
+		temp->stype = param->type->stype == Q__AGGREGATE
+			|| param->type->stype == Q__UNION
+			? Q_LONG : param->type->stype;
+	}
+	count_stmts(opt, &opt->func->prelude);
+	count_stmts(opt, &opt->func->body);
+}
+
+static bool
+const_int(const struct qbe_value *val, uint64_t *out)
+{
+	if (val->kind != QV_CONST) {
+		return false;
+	}
+	switch (val->type->stype) {
+	case Q_BYTE:
+	case Q_HALF:
+	case Q_WORD:
+		*out = val->wval;
+		return true;
+	case Q_LONG:
+		*out = val->lval;
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool
+is_int(enum qbe_stype stype)
+{
+	return stype == Q_WORD || stype == Q_LONG;
+}
+
+// Turns an instruction into a copy of the given value
+static void
+make_copy(struct qbe_statement *stmt, struct qbe_value value)
+{
+	stmt->instr = Q_COPY;
+	stmt->args->value = value;
+	stmt->args->next = NULL;
+}
+
+static struct qbe_value
+const_of(enum qbe_stype stype, uint64_t val)
+{
+	return stype == Q_WORD ? constw((uint32_t)val) : constl(val);
+}
+
+static bool
+fold_cmp(enum qbe_instr instr, uint64_t a, uint64_t b, uint64_t *out)
+{
+	uint32_t wa = a, wb = b;
+	int32_t sa = wa, sb = wb;
+	int64_t la = a, lb = b;
+	switch (instr) {
+	case Q_CEQW: *out = wa == wb; break;
+	case Q_CNEW: *out = wa != wb; break;
+	case Q_CSGEW: *out = sa >= sb; break;
+	case Q_CSGTW: *out = sa > sb; break;
+	case Q_CSLEW: *out = sa <= sb; break;
+	case Q_CSLTW: *out = sa < sb; break;
+	case Q_CUGEW: *out = wa >= wb; break;
+	case Q_CUGTW: *out = wa > wb; break;
+	case Q_CULEW: *out = wa <= wb; break;
+	case Q_CULTW: *out = wa < wb; break;
+	case Q_CEQL: *out = a == b; break;
+	case Q_CNEL: *out = a != b; break;
+	case Q_CSGEL: *out = la >= lb; break;
+	case Q_CSGTL: *out = la > lb; break;
+	case Q_CSLEL: *out = la <= lb; break;
+	case Q_CSLTL: *out = la < lb; break;
+	case Q_CUGEL: *out = a >= b; break;
+	case Q_CUGTL: *out = a > b; break;
+	case Q_CULEL: *out = a <= b; break;
+	case Q_CULTL: *out = a < b; break;
+	default:
+		return false;
+	}
+	return true;
+}
+
+static bool
+fold_unary(enum qbe_instr instr, uint64_t a, uint64_t *out)
+{
+	switch (instr) {
+	case Q_NEG: *out = -a; break;
+	case Q_EXTSB: *out = (int64_t)(int8_t)a; break;
+	case Q_EXTUB: *out = (uint8_t)a; break;
+	case Q_EXTSH: *out = (int64_t)(int16_t)a; break;
+	case Q_EXTUH: *out = (uint16_t)a; break;
+	case Q_EXTSW: *out = (int64_t)(int32_t)a; break;
+	case Q_EXTUW: *out = (uint32_t)a; break;
+	default:
+		return false;
+	}
+	return true;
+}
+
+static bool
+fold_binary(enum qbe_instr instr, bool word, uint64_t a, uint64_t b,
+	uint64_t *out)
+{
+	if (word) {
+		a = (uint32_t)a, b = (uint32_t)b;
+	}
+	int64_t sa = word ? (int64_t)(int32_t)a : (int64_t)a;
+	int64_t sb = word ? (int64_t)(int32_t)b : (int64_t)b;
+	uint64_t shift = b & (word ? 31 : 63);
+	switch (instr) {
+	case Q_ADD: *out = a + b; break;
+	case Q_SUB: *out = a - b; break;
+	case Q_MUL: *out = a * b; break;
+	case Q_AND: *out = a & b; break;
+	case Q_OR: *out = a | b; break;
+	case Q_XOR: *out = a ^ b; break;
+	case Q_SHL: *out = a << shift; break;
+	case Q_SHR: *out = a >> shift; break;
+	case Q_SAR: *out = (uint64_t)(sa >> shift); break;
+	case Q_UDIV:
+	case Q_UREM:
+		if (b == 0) {
+			return false;
+		}
+		*out = instr == Q_UDIV ? a / b : a % b;
+		break;
+	case Q_DIV:
+	case Q_REM:
+		if (sb == 0 || (sb == -1 && sa == (word ? INT32_MIN
+				: INT64_MIN))) {
+			return false;
+		}
+		*out = (uint64_t)(instr == Q_DIV ? sa / sb : sa % sb);
+		break;
+	default:
+		return false;
+	}
+	return true;
+}
+
+// Returns the operand which an instruction with the other operand constant
+// passes through unchanged, like x + 0 or x * 1
+static const struct qbe_value *
+fold_identity(enum qbe_instr instr, const struct qbe_value *a,
+	const struct qbe_value *b)
+{
+	uint64_t v;
+	switch (instr) {
+	case Q_ADD:
+	case Q_OR:
+	case Q_XOR:
+		if (const_int(a, &v) && v == 0) {
+			return b;
+		}
+		// fallthrough
+	case Q_SUB:
+	case Q_SHL:
+	case Q_SHR:
+	case Q_SAR:
+		return const_int(b, &v) && v == 0 ? a : NULL;
+	case Q_MUL:
+		if (const_int(a, &v) && v == 1) {
+			return b;
+		}
+		// fallthrough
+	case Q_DIV:
+	case Q_UDIV:
+		return const_int(b, &v) && v == 1 ? a : NULL;
+	default:
+		return NULL;
+	}
+}
+
+// Folds arithmetic on constants, and identities
+static bool
+fold(struct qopt *opt, struct qbe_statement *stmt)
+{
+	if (!stmt->out || !is_int(stmt->out->type->stype) || !stmt->args) {
+		return false;
+	}
+	enum qbe_stype stype = stmt->out->type->stype;
+	const struct qbe_value *a = &stmt->args->value;
+	const struct qbe_value *b = stmt->args->next
+		? &stmt->args->next->value : NULL;
+	uint64_t x, y, r;
+	if (!b) {
+		if (const_int(a, &x) && fold_unary(stmt->instr, x, &r)) {
+			make_copy(stmt, const_of(stype, r));
+			return true;
+		}
+		return false;
+	}
+	if (const_int(a, &x) && const_int(b, &y)) {
+		if (fold_cmp(stmt->instr, x, y, &r) || fold_binary(stmt->instr,
+				stype == Q_WORD, x, y, &r)) {
+			make_copy(stmt, const_of(stype, r));
+			return true;
+		}
+		return false;
+	}
+
+	const struct qbe_value *same = fold_identity(stmt->instr, a, b);
+	if (!same) {
+		return false;
+	}
+	if (same->kind == QV_TEMPORARY) {
+		struct temp *temp = temp_lookup(opt, same->name, false);
+		if (!temp || temp->stype != stype) {
+			return false;
+		}
+	} else if (same->kind != QV_CONST) {
+		return false;
+	}
+	make_copy(stmt, *same);
+	return true;
+}
+
+// Whether a copy of a constant or global may be substituted for a temporary
+// used by this instruction
+static bool
+accepts_const(enum qbe_instr instr)
+{
+	switch (instr) {
+	case Q_BLIT:
+	case Q_CAST:
+	case Q_VAARG:
+	case Q_VASTART:
+		return false;
+	default:
+		return true;
+	}
+}
+
+// Finds the value a temporary is a copy of, following chains of copies
+static bool
+copy_source(struct qopt *opt, struct temp *temp, struct qbe_value *out)
+{
+	for (int depth = 0; depth < 64; depth++) {
+		if (temp->replaced) {
+			*out = temp->repl;
+			return true;
+		}
+		if (temp->defs != 1 || temp->def->instr != Q_COPY) {
+			return depth > 0;
+		}
+		const struct qbe_value *src = &temp->def->args->value;
+		uint64_t v;
+		switch (src->kind) {
+		case QV_CONST:
+			if (!const_int(src, &v) || !is_int(temp->stype)) {
+				return depth > 0;
+			}
+			*out = const_of(temp->stype, v);
+			return true;
+		case QV_GLOBAL:
+			if (src->threadlocal) {
+				return depth > 0;
+			}
+			*out = *src;
+			return true;
+		case QV_TEMPORARY:;
+			struct temp *from = temp_lookup(opt, src->name, false);
+			if (!from || from == temp || from->defs > 1
+					|| from->stype != temp->stype) {
+				return depth > 0;
+			}
+			*out = *src;
+			temp = from;
+			break;
+		default:
+			return depth > 0;
+		}
+	}
+	return true;
+}
+
+// Substitutes the sources of copies for their uses, folding each instruction
+// as its operands become known so that later uses see the result in the same
+// pass
+static bool
+propagate(struct qopt *opt, struct qbe_statements *stmts)
+{
+	bool changed = false;
+	for (size_t i = 0; i < stmts->ln; i++) {
+		struct qbe_statement *stmt = &stmts->stmts[i];
+		if (stmt->type != Q_INSTR) {
+			continue;
+		}
+		for (struct qbe_arguments *arg = stmt->args; arg;
+				arg = arg->next) {
+			if (arg->value.kind != QV_TEMPORARY) {
+				continue;
+			}
+			struct temp *temp = temp_lookup(opt,
+				arg->value.name, false);
+			struct qbe_value src;
+			if (!temp || !copy_source(opt, temp, &src)) {
+				continue;
+			}
+			temp->replaced = true;
+			temp->repl = src;
+
+			const struct qbe_type *type = arg->value.type;
+			uint64_t v;
+			if (src.kind == QV_TEMPORARY) {
+				src.type = type;
+			} else if (!accepts_const(stmt->instr)
+					|| type->stype == Q__AGGREGATE
+					|| type->stype == Q__UNION) {
+				continue;
+			} else if (src.kind == QV_GLOBAL) {
+				src.type = type;
+			} else if (const_int(&src, &v)) {
+				if (type->stype == Q_LONG) {
+					src = constl(v);
+				} else if (type->stype == Q_WORD
+						|| type->stype == Q_HALF
+						|| type->stype == Q_BYTE) {
+					src = constw((uint32_t)v);
+					src.type = type;
+				} else {
+					continue;
+				}
+			}
+			arg->value = src;
+			changed = true;
+		}
+		changed |= fold(opt, stmt);
+	}
+	return changed;
+}
+
+static bool
+is_load(enum qbe_instr instr)
+{
+	switch (instr) {
+	case Q_LOADD:
+	case Q_LOADL:
+	case Q_LOADS:
+	case Q_LOADSB:
+	case Q_LOADSH:
+	case Q_LOADSW:
+	case Q_LOADUB:
+	case Q_LOADUH:
+	case Q_LOADUW:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool
+writes_memory(enum qbe_instr instr)
+{
+	switch (instr) {
+	case Q_BLIT:
+	case Q_CALL:
+	case Q_STOREB:
+	case Q_STORED:
+	case Q_STOREH:
+	case Q_STOREL:
+	case Q_STORES:
+	case Q_STOREW:
+	case Q_VAARG:
+	case Q_VASTART:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool
+same_value(const struct qbe_value *a, const struct qbe_value *b)
+{
+	if (a->kind != b->kind) {
+		return false;
+	}
+	switch (a->kind) {
+	case QV_GLOBAL:
+		if (a->threadlocal != b->threadlocal) {
+			return false;
+		}
+		// fallthrough
+	case QV_TEMPORARY:
+		return strcmp(a->name, b->name) == 0;
+	default:
+		return false;
+	}
+}
+
+#define LOADS_MAX 16
+
+// Replaces loads from an address which was already loaded from in the same
+// block, with nothing written to memory in between, by copies
+static bool
+forward_loads(struct qbe_statements *stmts)
+{
+	bool changed = false;
+	const struct qbe_statement *loads[LOADS_MAX];
+	size_t nloads = 0;
+	for (size_t i = 0; i < stmts->ln; i++) {
+		struct qbe_statement *stmt = &stmts->stmts[i];
+		if (stmt->type == Q_LABEL) {
+			nloads = 0;
+		}
+		if (stmt->type != Q_INSTR) {
+			continue;
+		}
+		if (writes_memory(stmt->instr)) {
+			nloads = 0;
+		}
+
+		const struct qbe_statement *prev = NULL;
+		if (is_load(stmt->instr)) {
+			for (size_t j = 0; j < nloads; j++) {
+				if (loads[j]->instr == stmt->instr
+						&& loads[j]->out->type->stype
+							== stmt->out->type->stype
+						&& same_value(&loads[j]->args->value,
+							&stmt->args->value)) {
+					prev = loads[j];
+					break;
+				}
+			}
+		}
+
+		// Forget the loads which this redefines the address or result of
+		if (stmt->out) {
+			size_t n = 0;
+			for (size_t j = 0; j < nloads; j++) {
+				const struct qbe_value *addr =
+					&loads[j]->args->value;
+				if (strcmp(loads[j]->out->name,
+						stmt->out->name) == 0
+						|| (addr->kind == QV_TEMPORARY
+						&& strcmp(addr->name,
+							stmt->out->name) == 0)) {
+					continue;
+				}
+				loads[n++] = loads[j];
+			}
+			nloads = n;
+		}
+
+		if (prev && strcmp(prev->out->name, stmt->out->name) != 0) {
+			struct qbe_value src = *prev->out;
+			make_copy(stmt, src);
+			changed = true;
+		} else if (is_load(stmt->instr) && nloads < LOADS_MAX
+				&& !(stmt->args->value.kind == QV_TEMPORARY
+				&& strcmp(stmt->args->value.name,
+					stmt->out->name) == 0)) {
+			loads[nloads++] = stmt;
+		}
+	}
+	return changed;
+}
+
+static bool
+is_terminator(const struct qbe_statement *stmt)
+{
+	if (stmt->type != Q_INSTR) {
+		return false;
+	}
+	switch (stmt->instr) {
+	case Q_HLT:
+	case Q_JMP:
+	case Q_JNZ:
+	case Q_RET:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Follows the chain of blocks consisting of nothing but a jump
+static const char *
+jump_target(struct qopt *opt, const char *name)
+{
+	for (int depth = 0; depth < 64; depth++) {
+		struct label *label = label_lookup(opt, name, false);
+		if (!label || !label->target) {
+			return name;
+		}
+		name = label->target;
+	}
+	return name;
+}
+
+// Retargets jumps to blocks which only jump elsewhere, and turns conditional
+// jumps on constants or to the same place into unconditional ones, returning
+// whether any conditions were dropped
+static bool
+thread_jumps(struct qopt *opt, struct qbe_statements *stmts)
+{
+	bool changed = false;
+	labels_free(opt);
+	for (size_t i = 0; i < stmts->ln; i++) {
+		if (stmts->stmts[i].type != Q_LABEL) {
+			continue;
+		}
+		struct label *label = label_lookup(opt,
+			stmts->stmts[i].label, true);
+		for (size_t j = i + 1; j < stmts->ln; j++) {
+			const struct qbe_statement *next = &stmts->stmts[j];
+			if (next->type == Q_LABEL || next->type == Q_COMMENT
+					|| (next->type == Q_INSTR
+					&& next->instr == Q_DBGLOC)) {
+				continue;
+			}
+			if (next->type == Q_INSTR && next->instr == Q_JMP
+					&& strcmp(next->args->value.name,
+						label->name) != 0) {
+				label->target = next->args->value.name;
+			}
+			break;
+		}
+	}
+
+	for (size_t i = 0; i < stmts->ln; i++) {
+		struct qbe_statement *stmt = &stmts->stmts[i];
+		if (stmt->type != Q_INSTR || (stmt->instr != Q_JMP
+				&& stmt->instr != Q_JNZ)) {
+			continue;
+		}
+		for (struct qbe_arguments *arg = stmt->args; arg;
+				arg = arg->next) {
+			if (arg->value.kind == QV_LABEL) {
+				arg->value.name = (char *)jump_target(opt,
+					arg->value.name);
+			}
+		}
+		if (stmt->instr != Q_JNZ) {
+			continue;
+		}
+		struct qbe_arguments *cond = stmt->args;
+		struct qbe_arguments *bt = cond->next, *bf = bt->next;
+		uint64_t v;
+		if (const_int(&cond->value, &v)) {
+			stmt->instr = Q_JMP;
+			stmt->args = (cond->value.type->stype == Q_WORD
+				? (uint32_t)v : v) ? bt : bf;
+			stmt->args->next = NULL;
+			changed = true;
+		} else if (strcmp(bt->value.name, bf->value.name) == 0) {
+			stmt->instr = Q_JMP;
+			stmt->args = bt;
+			bt->next = NULL;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+static void
+mark_live(struct qopt *opt, const char *name, size_t *stack, size_t *depth)
+{
+	struct label *label = label_lookup(opt, name, false);
+	assert(label);
+	if (!label->live) {
+		label->live = true;
+		stack[(*depth)++] = label->block;
+	}
+}
+
+// Removes the blocks which can't be reached from the start of the function,
+// and the instructions after a jump in the same block
+static bool
+remove_dead_blocks(struct qopt *opt, struct qbe_statements *stmts)
+{
+	// Blocks are numbered by the index of their first statement, and the
+	// first block of the body is reached from the prelude
+	labels_free(opt);
+	for (size_t i = 0; i < stmts->ln; i++) {
+		if (stmts->stmts[i].type == Q_LABEL) {
+			label_lookup(opt, stmts->stmts[i].label, true)->block = i;
+		}
+	}
+
+	bool *live = xcalloc(stmts->ln + 1, sizeof(bool));
+	// Each block may be pushed once as a jump target, and once when the
+	// block before falls through to it
+	size_t *stack = xcalloc(2 * (stmts->ln + 1), sizeof(size_t));
+	size_t depth = 0;
+	stack[depth++] = 0;
+	while (depth > 0) {
+		size_t i = stack[--depth];
+		if (i >= stmts->ln || live[i]) {
+			continue;
+		}
+		live[i] = true;
+		if (stmts->stmts[i].type == Q_LABEL) {
+			label_lookup(opt, stmts->stmts[i].label, false)->live = true;
+		}
+		size_t j = i + 1;
+		for (; j < stmts->ln; j++) {
+			const struct qbe_statement *stmt = &stmts->stmts[j];
+			if (stmt->type == Q_LABEL) {
+				break;
+			}
+			live[j] = true;
+			if (is_terminator(stmt)) {
+				break;
+			}
+		}
+		if (j >= stmts->ln) {
+			continue;
+		}
+		const struct qbe_statement *last = &stmts->stmts[j];
+		if (!is_terminator(last)) {
+			stack[depth++] = j; // Falls through
+			continue;
+		}
+		for (const struct qbe_arguments *arg = last->args; arg;
+				arg = arg->next) {
+			if (arg->value.kind == QV_LABEL) {
+				mark_live(opt, arg->value.name, stack, &depth);
+			}
+		}
+	}
+
+	size_t n = 0;
+	for (size_t i = 0; i < stmts->ln; i++) {
+		if (live[i]) {
+			stmts->stmts[n++] = stmts->stmts[i];
+		}
+	}
+	bool changed = n != stmts->ln;
+	stmts->ln = n;
+	free(live);
+	free(stack);
+	return changed;
+}
+
+static bool
+is_pure(enum qbe_instr instr)
+{
+	switch (instr) {
+	case Q_ALLOC16:
+	case Q_ALLOC4:
+	case Q_ALLOC8:
+	case Q_BLIT:
+	case Q_CALL:
+	case Q_DBGLOC:
+	case Q_DIV:
+	case Q_HLT:
+	case Q_JMP:
+	case Q_JNZ:
+	case Q_REM:
+	case Q_RET:
+	case Q_STOREB:
+	case Q_STORED:
+	case Q_STOREH:
+	case Q_STOREL:
+	case Q_STORES:
+	case Q_STOREW:
+	case Q_UDIV:
+	case Q_UREM:
+	case Q_VAARG:
+	case Q_VASTART:
+		return false;
+	default:
+		return true;
+	}
+}
+
+// Removes instructions without side effects whose results are unused. Going
+// backwards, the operands of each one removed lose their use before their own
+// definitions are reached, so the counts stay accurate for another round.
+static bool
+remove_dead_code(struct qopt *opt, struct qbe_statements *stmts)
+{
+	bool *dead = xcalloc(stmts->ln + 1, sizeof(bool));
+	for (size_t i = stmts->ln; i-- > 0; /* n/a */) {
+		const struct qbe_statement *stmt = &stmts->stmts[i];
+		if (stmt->type != Q_INSTR || !stmt->out
+				|| !is_pure(stmt->instr)) {
+			continue;
+		}
+		struct temp *temp = temp_lookup(opt, stmt->out->name, false);
+		if (temp->uses != 0) {
+			continue;
+		}
+		dead[i] = true;
+		for (const struct qbe_arguments *arg = stmt->args; arg;
+				arg = arg->next) {
+			if (arg->value.kind == QV_TEMPORARY) {
+				temp_lookup(opt, arg->value.name, false)->uses--;
+			}
+		}
+	}
+
+	size_t n = 0;
+	for (size_t i = 0; i < stmts->ln; i++) {
+		if (!dead[i]) {
+			stmts->stmts[n++] = stmts->stmts[i];
+		}
+	}
+	free(dead);
+	bool changed = n != stmts->ln;
+	stmts->ln = n;
+	return changed;
+}
+
+void
+qbe_optimize(struct qbe_func *func)
+{
+	struct qopt opt = { .func = func };
+	opt.nbuckets = 64;
+	while (opt.nbuckets < func->body.ln) {
+		opt.nbuckets *= 2;
+	}
+	opt.temps = xcalloc(opt.nbuckets, sizeof(struct temp *));
+	opt.labels = xcalloc(opt.nbuckets, sizeof(struct label *));
+
+	bool stale = true;
+	for (int round = 0; round < 4 && stale; round++) {
+		count_temps(&opt);
+		stale = propagate(&opt, &func->body);
+		stale |= forward_loads(&func->body);
+	}
+
+	// The counts of the last round still hold unless it changed something,
+	// or conditions or whole blocks are dropped here
+	stale |= thread_jumps(&opt, &func->body);
+	stale |= remove_dead_blocks(&opt, &func->body);
+	if (stale) {
+		count_temps(&opt);
+	}
+	for (int round = 0; round < 4; round++) {
+		if (!remove_dead_code(&opt, &func->body)) {
+			break;
+		}
+	}
+
+	tables_free(&opt);
+	free(opt.temps);
+	free(opt.labels);
+}
@@ -135,9 +135,10 @@ tagged_qtype(struct gen_context *ctx,
 static const struct qbe_type *
 aggregate_lookup(struct gen_context *ctx, const struct type *type)
 {
-	for (struct qbe_def *def = ctx->out->defs; def; def = def->next) {
-		if (def->kind == Q_TYPE && def->type.base == type) {
-			return &def->type;
+	for (struct qtype_bucket *bucket = ctx->qtypes[type->id % QTYPE_BUCKETS];
+			bucket; bucket = bucket->next) {
+		if (bucket->qtype->base == type) {
+			return bucket->qtype;
 		}
 	}
 
@@ -252,6 +253,12 @@ aggregate_lookup(struct gen_context *ctx, const struct type *type)
 	}
 
 	qbe_append_def(ctx->out, def);
+
+	// Looking up the types of members may have added to this bucket
+	struct qtype_bucket *bucket = xcalloc(1, sizeof(struct qtype_bucket));
+	bucket->qtype = &def->type;
+	bucket->next = ctx->qtypes[type->id % QTYPE_BUCKETS];
+	ctx->qtypes[type->id % QTYPE_BUCKETS] = bucket;
 	return &def->type;
 }
 
@@ -4,6 +4,7 @@
 #include "expr.h"
 #include "identifier.h"
 #include "scope.h"
+#include "stats.h"
 #include "util.h"
 
 static uint32_t
@@ -16,6 +17,7 @@ struct scope *
 scope_push(struct scope **stack, enum scope_class class)
 {
 	struct scope *new = xcalloc(1, sizeof(struct scope));
+	stats_counters.scopes++;
 	new->class = class;
 	new->next = &new->objects;
 	new->parent = *stack;
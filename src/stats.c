@@ -0,0 +1,155 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include "stats.h"
+#include "util.h"
+
+struct stats_counters stats_counters = {
+	.output_bytes = -1,
+};
+
+bool stats_enabled;
+
+struct stats_phase {
+	const char *phase;
+	char *subject;
+	int depth;
+	uint64_t wall_ns, cpu_ns, alloc_bytes;
+};
+
+static struct stats_phase *phases;
+static size_t nphases, phases_sz;
+
+static char **dropped;
+static size_t ndropped, dropped_sz;
+
+// Indices into phases of the phases which haven't ended yet
+static size_t open_phases[64];
+static int nopen;
+
+static uint64_t
+now(clockid_t clock)
+{
+	struct timespec ts;
+	if (clock_gettime(clock, &ts) != 0) {
+		return 0;
+	}
+	return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+void
+stats_begin(const char *phase, const char *subject)
+{
+	if (!stats_enabled) {
+		return;
+	}
+	assert(nopen < (int)(sizeof(open_phases) / sizeof(open_phases[0])));
+	if (nphases == phases_sz) {
+		phases_sz = phases_sz ? phases_sz * 2 : 64;
+		phases = xrealloc(phases, phases_sz * sizeof(struct stats_phase));
+	}
+	struct stats_phase *p = &phases[nphases];
+	p->phase = phase;
+	p->subject = subject ? xstrdup(subject) : NULL;
+	p->depth = nopen;
+	open_phases[nopen++] = nphases++;
+	// Taken last, so that the bookkeeping above isn't attributed to the
+	// phase
+	p->alloc_bytes = stats_counters.alloc_bytes;
+	p->cpu_ns = now(CLOCK_PROCESS_CPUTIME_ID);
+	p->wall_ns = now(CLOCK_MONOTONIC);
+}
+
+void
+stats_end(void)
+{
+	if (!stats_enabled) {
+		return;
+	}
+	uint64_t wall = now(CLOCK_MONOTONIC);
+	uint64_t cpu = now(CLOCK_PROCESS_CPUTIME_ID);
+	assert(nopen > 0);
+	struct stats_phase *p = &phases[open_phases[--nopen]];
+	p->wall_ns = wall - p->wall_ns;
+	p->cpu_ns = cpu - p->cpu_ns;
+	p->alloc_bytes = stats_counters.alloc_bytes - p->alloc_bytes;
+}
+
+void
+stats_dropped(const char *symbol)
+{
+	if (!stats_enabled) {
+		return;
+	}
+	if (ndropped == dropped_sz) {
+		dropped_sz = dropped_sz ? dropped_sz * 2 : 64;
+		dropped = xrealloc(dropped, dropped_sz * sizeof(*dropped));
+	}
+	dropped[ndropped++] = xstrdup(symbol);
+}
+
+static void
+emit_json_string(FILE *out, const char *s)
+{
+	xfprintf(out, "\"");
+	for (; *s; s++) {
+		unsigned char c = *s;
+		if (c == '"' || c == '\\') {
+			xfprintf(out, "\\%c", c);
+		} else if (c < 0x20) {
+			xfprintf(out, "\\u%04x", c);
+		} else {
+			xfprintf(out, "%c", c);
+		}
+	}
+	xfprintf(out, "\"");
+}
+
+void
+stats_report(FILE *out)
+{
+	xfprintf(out, "{\n\t\"version\": ");
+	emit_json_string(out, VERSION);
+	xfprintf(out, ",\n\t\"phases\": [");
+	for (size_t i = 0; i < nphases; i++) {
+		const struct stats_phase *p = &phases[i];
+		xfprintf(out, "%s\n\t\t{\"phase\": ", i ? "," : "");
+		emit_json_string(out, p->phase);
+		if (p->subject) {
+			xfprintf(out, ", \"subject\": ");
+			emit_json_string(out, p->subject);
+		}
+		xfprintf(out, ", \"depth\": %d, \"wall_ns\": %" PRIu64
+			", \"cpu_ns\": %" PRIu64 ", \"alloc_bytes\": %" PRIu64 "}",
+			p->depth, p->wall_ns, p->cpu_ns, p->alloc_bytes);
+	}
+	xfprintf(out, "\n\t],\n\t\"dropped\": [");
+	for (size_t i = 0; i < ndropped; i++) {
+		xfprintf(out, "%s", i ? ", " : "");
+		emit_json_string(out, dropped[i]);
+	}
+	xfprintf(out, "],\n\t\"counts\": {\n");
+	xfprintf(out, "\t\t\"allocations\": %" PRIu64 ",\n", stats_counters.allocs);
+	xfprintf(out, "\t\t\"alloc_bytes\": %" PRIu64 ",\n", stats_counters.alloc_bytes);
+	xfprintf(out, "\t\t\"types\": %" PRIu64 ",\n", stats_counters.types);
+	xfprintf(out, "\t\t\"scopes\": %" PRIu64 ",\n", stats_counters.scopes);
+	xfprintf(out, "\t\t\"ir_statements\": %" PRIu64 ",\n", stats_counters.statements);
+	if (stats_counters.output_bytes < 0) {
+		xfprintf(out, "\t\t\"output_bytes\": null,\n");
+	} else {
+		xfprintf(out, "\t\t\"output_bytes\": %" PRId64 ",\n",
+			stats_counters.output_bytes);
+	}
+	struct rusage ru;
+	if (getrusage(RUSAGE_SELF, &ru) != 0) {
+		xfprintf(out, "\t\t\"max_rss_kb\": null\n");
+	} else {
+		xfprintf(out, "\t\t\"max_rss_kb\": %ld\n", ru.ru_maxrss);
+	}
+	xfprintf(out, "\t}\n}\n");
+}
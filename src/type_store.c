@@ -6,6 +6,7 @@
 #include "check.h"
 #include "eval.h"
 #include "scope.h"
+#include "stats.h"
 #include "type_store.h"
 #include "types.h"
 #include "util.h"
@@ -1021,6 +1022,7 @@ _type_store_lookup_type(
 	bucket = *next = xcalloc(1, sizeof(struct type_bucket));
 	bucket->type = *type;
 	bucket->type.id = hash;
+	stats_counters.types++;
 
 	if (dims == NULL) {
 		add_padding(&bucket->type.size, type->align);
@@ -1,4 +1,5 @@
 #include <sys/stat.h>
+#include <inttypes.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdlib.h>
@@ -6,12 +7,20 @@
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
+#include "stats.h"
 #include "util.h"
 // Remove safety macros:
 #undef malloc
 #undef calloc
 #undef realloc
 #undef strdup
+#ifdef ALLOC_PROFILE
+#undef xcalloc
+#undef xrealloc
+#undef xstrdup
+#undef free
+#undef gen_name
+#endif
 
 const char **sources;
 size_t nsources;
@@ -94,6 +103,8 @@ xcalloc(size_t n, size_t s)
 	if (!p && s) {
 		abort();
 	}
+	stats_counters.allocs++;
+	stats_counters.alloc_bytes += n * s;
 	return p;
 }
 
@@ -104,6 +115,8 @@ xrealloc(void *p, size_t s)
 	if (!p && s) {
 		abort();
 	}
+	stats_counters.allocs++;
+	stats_counters.alloc_bytes += s;
 	return p;
 }
 
@@ -114,9 +127,224 @@ xstrdup(const char *s)
 	if (!ret) {
 		abort();
 	}
+	stats_counters.allocs++;
+	stats_counters.alloc_bytes += strlen(s) + 1;
 	return ret;
 }
 
+#ifdef ALLOC_PROFILE
+static const struct {
+	const char *file;
+	const char *subsystem;
+} subsystems[] = {
+	{ "lex.c", "lexer" },
+	{ "utf8.c", "lexer" },
+	{ "parse.c", "parser" },
+	{ "astcache.c", "parser" },
+	{ "scope.c", "scope" },
+	{ "type_store.c", "type store" },
+	{ "types.c", "type store" },
+	{ "check.c", "check" },
+	{ "eval.c", "check" },
+	{ "expr.c", "check" },
+	{ "mod.c", "check" },
+	{ "gen.c", "gen" },
+	{ "genutil.c", "gen" },
+	{ "qbe.c", "gen" },
+	{ "qinstr.c", "gen" },
+	{ "qtype.c", "gen" },
+	{ "qopt.c", "optimize" },
+	{ "emit.c", "emit" },
+	{ "typedef.c", "typedef" },
+};
+
+#define NTAGS (sizeof(subsystems) / sizeof(subsystems[0]) + 1)
+
+static struct alloc_tag {
+	const char *name;
+	uint64_t allocs, bytes, live, peak;
+} tags[NTAGS];
+
+static uint64_t total_live, total_peak;
+
+// Live allocations, in an open-addressed table keyed by address
+struct alloc_entry {
+	void *p;
+	size_t sz;
+	size_t tag;
+};
+
+#define TOMBSTONE ((void *)-1)
+
+static struct alloc_entry *live;
+static size_t live_sz, live_used;
+
+static size_t
+lookup_tag(const char *file)
+{
+	// __FILE__ is the same string literal for every call site in a
+	// translation unit, so the last few results are cached by address
+	static const char *cache_file[8];
+	static size_t cache_tag[8], cache_next;
+	for (size_t i = 0; i < 8; i++) {
+		if (cache_file[i] == file) {
+			return cache_tag[i];
+		}
+	}
+
+	const char *base = strrchr(file, '/');
+	base = base ? base + 1 : file;
+	size_t tag = NTAGS - 1;
+	for (size_t i = 0; i < NTAGS - 1; i++) {
+		if (strcmp(base, subsystems[i].file) != 0) {
+			continue;
+		}
+		// Files of the same subsystem share the first entry's tag
+		for (tag = 0; tag < i; tag++) {
+			if (strcmp(subsystems[tag].subsystem,
+					subsystems[i].subsystem) == 0) {
+				break;
+			}
+		}
+		break;
+	}
+	cache_file[cache_next] = file;
+	cache_tag[cache_next] = tag;
+	cache_next = (cache_next + 1) % 8;
+	return tag;
+}
+
+static size_t
+live_slot(void *p)
+{
+	return ((uintptr_t)p >> 4) * 2654435761u % live_sz;
+}
+
+static void
+profile_report(void)
+{
+	fprintf(stderr, "%-12s %12s %14s %14s\n",
+		"subsystem", "allocations", "bytes", "peak live");
+	for (size_t i = 0; i < NTAGS; i++) {
+		const struct alloc_tag *t = &tags[i];
+		if (t->allocs == 0) {
+			continue;
+		}
+		fprintf(stderr, "%-12s %12" PRIu64 " %14" PRIu64 " %14" PRIu64 "\n",
+			t->name, t->allocs, t->bytes, t->peak);
+	}
+	fprintf(stderr, "peak live bytes: %" PRIu64 "\n", total_peak);
+}
+
+static void
+profile_insert(void *p, size_t sz, size_t tag)
+{
+	if (!p) {
+		return;
+	}
+	if (!live) {
+		for (size_t i = 0; i < NTAGS - 1; i++) {
+			tags[i].name = subsystems[i].subsystem;
+		}
+		tags[NTAGS - 1].name = "other";
+		atexit(profile_report);
+	}
+	if ((live_used + 1) * 2 > live_sz) {
+		struct alloc_entry *old = live;
+		size_t old_sz = live_sz;
+		live_sz = live_sz ? live_sz * 2 : 4096;
+		live = calloc(live_sz, sizeof(struct alloc_entry));
+		if (!live) {
+			abort();
+		}
+		live_used = 0;
+		for (size_t i = 0; i < old_sz; i++) {
+			if (old[i].p && old[i].p != TOMBSTONE) {
+				size_t j = live_slot(old[i].p);
+				while (live[j].p) {
+					j = (j + 1) % live_sz;
+				}
+				live[j] = old[i];
+				live_used++;
+			}
+		}
+		free(old);
+	}
+
+	size_t i = live_slot(p);
+	while (live[i].p && live[i].p != TOMBSTONE) {
+		i = (i + 1) % live_sz;
+	}
+	if (!live[i].p) {
+		live_used++;
+	}
+	live[i] = (struct alloc_entry){ .p = p, .sz = sz, .tag = tag };
+
+	struct alloc_tag *t = &tags[tag];
+	t->allocs++;
+	t->bytes += sz;
+	t->live += sz;
+	if (t->live > t->peak) {
+		t->peak = t->live;
+	}
+	total_live += sz;
+	if (total_live > total_peak) {
+		total_peak = total_live;
+	}
+}
+
+static void
+profile_remove(void *p)
+{
+	if (!p || !live) {
+		return;
+	}
+	size_t i = live_slot(p);
+	while (live[i].p) {
+		if (live[i].p == p) {
+			tags[live[i].tag].live -= live[i].sz;
+			total_live -= live[i].sz;
+			live[i].p = TOMBSTONE;
+			return;
+		}
+		i = (i + 1) % live_sz;
+	}
+	// Not allocated by us, e.g. an open_memstream buffer
+}
+
+void *
+xcalloc_profiled(size_t n, size_t s, const char *file)
+{
+	void *p = xcalloc(n, s);
+	profile_insert(p, n * s, lookup_tag(file));
+	return p;
+}
+
+void *
+xrealloc_profiled(void *p, size_t s, const char *file)
+{
+	profile_remove(p);
+	p = xrealloc(p, s);
+	profile_insert(p, s, lookup_tag(file));
+	return p;
+}
+
+char *
+xstrdup_profiled(const char *s, const char *file)
+{
+	char *p = xstrdup(s);
+	profile_insert(p, strlen(s) + 1, lookup_tag(file));
+	return p;
+}
+
+void
+xfree_profiled(void *p)
+{
+	profile_remove(p);
+	free(p);
+}
+#endif
+
 char *
 gen_name(int *id, const char *fmt)
 {
@@ -127,6 +355,16 @@ gen_name(int *id, const char *fmt)
 	return str;
 }
 
+#ifdef ALLOC_PROFILE
+char *
+gen_name_profiled(int *id, const char *fmt, const char *file)
+{
+	char *str = gen_name(id, fmt);
+	profile_insert(str, strlen(str) + 1, lookup_tag(file));
+	return str;
+}
+#endif
+
 void
 errline(struct location loc)
 {
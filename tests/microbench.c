@@ -0,0 +1,529 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "check.h"
+#include "identifier.h"
+#include "lex.h"
+#include "scope.h"
+#include "type_store.h"
+#include "types.h"
+#include "util.h"
+
+// Microbenchmarks for the compiler's hot data structures and for the memory
+// routines and allocator of the runtime in rt/. Each benchmark runs a fixed
+// batch of operations; the batch is run a few times to warm up, then timed
+// repeatedly, and the distribution of the per-operation time is reported.
+//
+// Usage: microbench [-r repetitions] [name...]
+//
+// If any names are given, only the benchmarks whose names start with one of
+// them are run.
+
+#define WARMUP 3
+
+static int repetitions = 31;
+static char **filters;
+static int nfilters;
+
+struct bench {
+	const char *name;
+	// Runs one batch, returning the number of operations performed
+	size_t (*run)(void *arg);
+	void *arg;
+};
+
+static uint64_t
+now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+static int
+cmp_double(const void *_a, const void *_b)
+{
+	double a = *(const double *)_a, b = *(const double *)_b;
+	return (a > b) - (a < b);
+}
+
+static double
+percentile(const double *sorted, int n, int pct)
+{
+	int i = (n - 1) * pct / 100;
+	return sorted[i];
+}
+
+static bool
+selected(const char *name)
+{
+	if (nfilters == 0) {
+		return true;
+	}
+	for (int i = 0; i < nfilters; i++) {
+		if (strncmp(name, filters[i], strlen(filters[i])) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void
+measure(const struct bench *b)
+{
+	if (!selected(b->name)) {
+		return;
+	}
+	size_t ops = 0;
+	for (int i = 0; i < WARMUP; i++) {
+		ops = b->run(b->arg);
+	}
+	double *samples = xcalloc(repetitions, sizeof(double));
+	for (int i = 0; i < repetitions; i++) {
+		uint64_t start = now();
+		ops = b->run(b->arg);
+		samples[i] = (double)(now() - start) / (double)ops;
+	}
+	qsort(samples, repetitions, sizeof(double), cmp_double);
+	printf("%-28s %9zu %9.2f %9.2f %9.2f %9.2f %9.2f\n", b->name, ops,
+		samples[0], percentile(samples, repetitions, 50),
+		percentile(samples, repetitions, 90),
+		percentile(samples, repetitions, 99),
+		samples[repetitions - 1]);
+	free(samples);
+}
+
+// Keeps the compiler from optimizing away results
+static volatile uint32_t sink;
+
+static const char lex_sample[] =
+	"use rt;\n"
+	"\n"
+	"// A comment which the lexer has to skip over\n"
+	"export type point = struct {\n"
+	"\tx: int,\n"
+	"\ty: int,\n"
+	"};\n"
+	"\n"
+	"export fn distance(a: *point, b: *point) (f64 | error) = {\n"
+	"\tlet dx = (a.x - b.x): f64, dy = (a.y - b.y): f64;\n"
+	"\tif (dx == 0.0 && dy == 0.0) {\n"
+	"\t\treturn 0x10u8: error;\n"
+	"\t};\n"
+	"\tconst s = \"a string literal with \\\"escapes\\\"\\n\";\n"
+	"\tfor (let i = 0z; i < len(s); i += 1) {\n"
+	"\t\tswitch (s[i]) {\n"
+	"\t\tcase 'a' =>\n"
+	"\t\t\tyield 1e10;\n"
+	"\t\tcase => void;\n"
+	"\t\t};\n"
+	"\t};\n"
+	"\treturn dx * dx + dy * dy;\n"
+	"};\n"
+	"\n";
+
+struct lex_arg {
+	char *src;
+	size_t len;
+};
+
+static size_t
+bench_lex(void *_arg)
+{
+	struct lex_arg *arg = _arg;
+	FILE *in = fmemopen(arg->src, arg->len, "r");
+	if (!in) {
+		perror("fmemopen");
+		exit(EXIT_ABNORMAL);
+	}
+	struct lexer lexer;
+	lex_init(&lexer, in, 0);
+	struct token tok;
+	size_t ntokens = 0;
+	while (lex(&lexer, &tok) != T_EOF) {
+		token_finish(&tok);
+		ntokens++;
+	}
+	lex_finish(&lexer);
+	return ntokens;
+}
+
+#define NIDENTS 4096
+
+static struct identifier idents[NIDENTS];
+
+static void
+idents_init(void)
+{
+	static struct identifier namespaces[3] = {
+		{ .name = "rt" },
+		{ .name = "unix" },
+		{ .name = "net", .ns = &namespaces[1] },
+	};
+	for (size_t i = 0; i < NIDENTS; i++) {
+		char buf[32];
+		snprintf(buf, sizeof(buf), "name_%zu", i);
+		idents[i].name = xstrdup(buf);
+		// Mix unqualified names with one and two levels of namespacing
+		switch (i % 4) {
+		case 0:
+		case 1:
+			idents[i].ns = NULL;
+			break;
+		case 2:
+			idents[i].ns = &namespaces[0];
+			break;
+		case 3:
+			idents[i].ns = &namespaces[2];
+			break;
+		}
+	}
+}
+
+static size_t
+bench_identifier_hash(void *arg)
+{
+	(void)arg;
+	uint32_t hash = 0;
+	for (size_t i = 0; i < NIDENTS; i++) {
+		hash ^= identifier_hash(FNV1A_INIT, &idents[i]);
+	}
+	sink = hash;
+	return NIDENTS;
+}
+
+struct scope_arg {
+	size_t size;
+	struct scope *scope;
+};
+
+static size_t
+bench_scope_insert(void *_arg)
+{
+	struct scope_arg *arg = _arg;
+	struct scope *stack = NULL;
+	struct scope *scope = scope_push(&stack, SCOPE_COMPOUND);
+	for (size_t i = 0; i < arg->size; i++) {
+		scope_insert(scope, O_BIND, &idents[i], &idents[i],
+			&builtin_type_int, NULL);
+	}
+	scope_free(scope);
+	return arg->size;
+}
+
+static size_t
+bench_scope_lookup(void *_arg)
+{
+	struct scope_arg *arg = _arg;
+	if (!arg->scope) {
+		struct scope *stack = NULL;
+		arg->scope = scope_push(&stack, SCOPE_COMPOUND);
+		for (size_t i = 0; i < arg->size; i++) {
+			scope_insert(arg->scope, O_BIND, &idents[i], &idents[i],
+				&builtin_type_int, NULL);
+		}
+	}
+	// Every lookup hits, in an order unrelated to the insertion order
+	size_t n = 0;
+	for (size_t i = 0; i < NIDENTS; i++) {
+		size_t j = (i * 2654435761u) % arg->size;
+		n += scope_lookup(arg->scope, &idents[j]) != NULL;
+	}
+	sink = n;
+	return NIDENTS;
+}
+
+#define NTYPES 1024
+
+static struct context ctx;
+static const struct type *types[NTYPES];
+
+static size_t
+bench_lookup_pointer(void *arg)
+{
+	(void)arg;
+	for (size_t i = 0; i < NTYPES; i++) {
+		sink = type_store_lookup_pointer(&ctx, (struct location){0},
+			types[i], i % 2 ? PTR_NULLABLE : 0)->id;
+	}
+	return NTYPES;
+}
+
+static size_t
+bench_lookup_array(void *arg)
+{
+	(void)arg;
+	for (size_t i = 0; i < NTYPES; i++) {
+		sink = type_store_lookup_array(&ctx, (struct location){0},
+			&builtin_type_int, i, false)->id;
+	}
+	return NTYPES;
+}
+
+static size_t
+bench_lookup_slice(void *arg)
+{
+	(void)arg;
+	for (size_t i = 0; i < NTYPES; i++) {
+		sink = type_store_lookup_slice(&ctx, (struct location){0},
+			types[i])->id;
+	}
+	return NTYPES;
+}
+
+static size_t
+bench_lookup_tagged(void *arg)
+{
+	(void)arg;
+	for (size_t i = 0; i < NTYPES; i++) {
+		struct type_tagged_union tags[2] = {
+			{ .type = types[i], .next = &tags[1] },
+			{ .type = &builtin_type_str },
+		};
+		sink = type_store_lookup_tagged(&ctx, (struct location){0},
+			tags)->id;
+	}
+	return NTYPES;
+}
+
+static size_t
+bench_type_hash(void *arg)
+{
+	(void)arg;
+	uint32_t hash = 0;
+	for (size_t i = 0; i < NTYPES; i++) {
+		hash ^= type_hash(types[i]);
+	}
+	sink = hash;
+	return NTYPES;
+}
+
+// The runtime's memory routines and allocator, built without its startup code
+void rt_memcpy(void *dest, const void *src, size_t n) __asm__("rt.memcpy");
+void rt_memmove(void *dest, const void *src, size_t n) __asm__("rt.memmove");
+void rt_memset(void *dest, unsigned char val, size_t n) __asm__("rt.memset");
+void *rt_malloc(size_t n) __asm__("rt.malloc");
+void rt_free(void *p) __asm__("rt.free");
+
+enum mem_op {
+	MEM_COPY,
+	MEM_MOVE_FORWARD,
+	MEM_MOVE_BACKWARD,
+	MEM_SET,
+};
+
+struct mem_arg {
+	enum mem_op op;
+	size_t size;
+	// Offsets of the destination and source from an aligned address
+	size_t dest_off, src_off;
+	char name[48];
+};
+
+#define MEM_BATCH (1 << 20)
+
+static unsigned char *mem_dest, *mem_src;
+
+static size_t
+bench_mem(void *_arg)
+{
+	struct mem_arg *arg = _arg;
+	unsigned char *dest = mem_dest + arg->dest_off;
+	unsigned char *src = mem_src + arg->src_off;
+	size_t n = MEM_BATCH / arg->size;
+	for (size_t i = 0; i < n; i++) {
+		switch (arg->op) {
+		case MEM_COPY:
+			rt_memcpy(dest, src, arg->size);
+			break;
+		case MEM_MOVE_FORWARD:
+			rt_memmove(dest, dest + 8, arg->size);
+			break;
+		case MEM_MOVE_BACKWARD:
+			rt_memmove(dest + 8, dest, arg->size);
+			break;
+		case MEM_SET:
+			rt_memset(dest, (unsigned char)i, arg->size);
+			break;
+		}
+	}
+	sink = dest[arg->size / 2];
+	return n;
+}
+
+// Largest size of each of the allocator's bins, see bin_getsize in
+// rt/malloc.ha
+#define MALLOC_BINS 9
+#define MALLOC_BINSZ(bin) (((bin) == 0 ? 0 : (size_t)1 << ((bin) - 1)) * 16 + 8)
+
+struct malloc_arg {
+	size_t size;
+	char name[48];
+};
+
+#define MALLOC_BATCH (1 << 16)
+// Blocks kept allocated throughout, so that each free and malloc pair works
+// on a freelist which isn't otherwise empty
+#define MALLOC_LIVE 64
+
+static size_t
+bench_malloc(void *_arg)
+{
+	struct malloc_arg *arg = _arg;
+	unsigned char *live[MALLOC_LIVE];
+	for (size_t i = 0; i < MALLOC_LIVE; i++) {
+		live[i] = rt_malloc(arg->size);
+	}
+	for (size_t i = 0; i < MALLOC_BATCH; i++) {
+		size_t j = i % MALLOC_LIVE;
+		rt_free(live[j]);
+		live[j] = rt_malloc(arg->size);
+		live[j][0] = (unsigned char)i;
+	}
+	unsigned char sum = 0;
+	for (size_t i = 0; i < MALLOC_LIVE; i++) {
+		sum += live[i][0];
+		rt_free(live[i]);
+	}
+	sink = sum;
+	return MALLOC_BATCH;
+}
+
+int
+main(int argc, char *argv[])
+{
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+			repetitions = atoi(argv[++i]);
+			if (repetitions < 1) {
+				fprintf(stderr, "Invalid repetition count\n");
+				return EXIT_USER;
+			}
+		} else {
+			filters = &argv[i];
+			nfilters = argc - i;
+			break;
+		}
+	}
+
+	builtin_types_init("x86_64");
+	static type_store ts = {0};
+	ctx.store = &ts;
+	sources = (const char *[1]){"<microbench>"};
+	idents_init();
+
+	// Types for the type store benchmarks: a mix of (nullable) pointers
+	// nested up to four deep
+	const struct type *prims[] = {
+		&builtin_type_int, &builtin_type_u8, &builtin_type_u32,
+		&builtin_type_f64, &builtin_type_str, &builtin_type_rune,
+		&builtin_type_size, &builtin_type_bool,
+	};
+	for (size_t i = 0; i < NTYPES; i++) {
+		types[i] = prims[i % (sizeof(prims) / sizeof(prims[0]))];
+		for (size_t j = 0; j < i / 8 % 4 + 1; j++) {
+			types[i] = type_store_lookup_pointer(&ctx,
+				(struct location){0}, types[i],
+				i % 2 ? PTR_NULLABLE : 0);
+		}
+	}
+
+	struct lex_arg lex_arg;
+	size_t repeat = 1024;
+	lex_arg.len = (sizeof(lex_sample) - 1) * repeat;
+	lex_arg.src = xcalloc(lex_arg.len, 1);
+	for (size_t i = 0; i < repeat; i++) {
+		memcpy(lex_arg.src + i * (sizeof(lex_sample) - 1), lex_sample,
+			sizeof(lex_sample) - 1);
+	}
+
+	static struct scope_arg scope_args[] = {
+		{ .size = 16 },
+		{ .size = 256 },
+		{ .size = 4096 },
+	};
+
+	// Sizes from a few words up to past the L1 cache, with the source and
+	// destination equally aligned, equally misaligned and misaligned
+	// relative to each other
+	static const size_t mem_sizes[] = { 8, 32, 128, 1024, 16384, 262144 };
+	static const size_t mem_offsets[][2] = { {0, 0}, {3, 3}, {0, 5} };
+	static const char *mem_names[] = {
+		[MEM_COPY] = "memcpy",
+		[MEM_MOVE_FORWARD] = "memmove_fwd",
+		[MEM_MOVE_BACKWARD] = "memmove_bwd",
+		[MEM_SET] = "memset",
+	};
+	size_t nsizes = sizeof(mem_sizes) / sizeof(mem_sizes[0]);
+	size_t noffsets = sizeof(mem_offsets) / sizeof(mem_offsets[0]);
+	struct mem_arg *mem_args = xcalloc((MEM_SET + 1) * nsizes * noffsets,
+		sizeof(struct mem_arg));
+	size_t nmem_args = 0;
+	for (enum mem_op op = MEM_COPY; op <= MEM_SET; op++) {
+		for (size_t i = 0; i < nsizes; i++) {
+			for (size_t j = 0; j < noffsets; j++) {
+				if (op != MEM_COPY && j == 2) {
+					// Only memcpy has two independent pointers
+					continue;
+				}
+				struct mem_arg *arg = &mem_args[nmem_args++];
+				arg->op = op;
+				arg->size = mem_sizes[i];
+				arg->dest_off = mem_offsets[j][0];
+				arg->src_off = mem_offsets[j][1];
+				snprintf(arg->name, sizeof(arg->name), "%s/%zu/%zu:%zu",
+					mem_names[op], arg->size,
+					arg->dest_off, arg->src_off);
+			}
+		}
+	}
+	size_t mem_len = mem_sizes[nsizes - 1] + 128;
+	mem_dest = xcalloc(mem_len, 1);
+	mem_src = xcalloc(mem_len, 1);
+
+	// A free followed by an allocation of the same size, at the largest
+	// size of each bin
+	struct malloc_arg malloc_args[MALLOC_BINS];
+	for (size_t i = 0; i < MALLOC_BINS; i++) {
+		malloc_args[i].size = MALLOC_BINSZ(i);
+		snprintf(malloc_args[i].name, sizeof(malloc_args[i].name),
+			"malloc_free/%zu", malloc_args[i].size);
+	}
+
+	const struct bench benches[] = {
+		{ "lex", bench_lex, &lex_arg },
+		{ "identifier_hash", bench_identifier_hash, NULL },
+		{ "scope_insert/16", bench_scope_insert, &scope_args[0] },
+		{ "scope_insert/256", bench_scope_insert, &scope_args[1] },
+		{ "scope_insert/4096", bench_scope_insert, &scope_args[2] },
+		{ "scope_lookup/16", bench_scope_lookup, &scope_args[0] },
+		{ "scope_lookup/256", bench_scope_lookup, &scope_args[1] },
+		{ "scope_lookup/4096", bench_scope_lookup, &scope_args[2] },
+		{ "type_hash", bench_type_hash, NULL },
+		{ "type_store_lookup_pointer", bench_lookup_pointer, NULL },
+		{ "type_store_lookup_array", bench_lookup_array, NULL },
+		{ "type_store_lookup_slice", bench_lookup_slice, NULL },
+		{ "type_store_lookup_tagged", bench_lookup_tagged, NULL },
+	};
+
+	printf("%-28s %9s %9s %9s %9s %9s %9s\n", "benchmark (ns/op)", "ops",
+		"min", "median", "p90", "p99", "max");
+	for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+		measure(&benches[i]);
+	}
+	for (size_t i = 0; i < nmem_args; i++) {
+		measure(&(struct bench){
+			mem_args[i].name, bench_mem, &mem_args[i],
+		});
+	}
+	for (size_t i = 0; i < MALLOC_BINS; i++) {
+		measure(&(struct bench){
+			malloc_args[i].name, bench_malloc, &malloc_args[i],
+		});
+	}
+	return EXIT_SUCCESS;
+}